@@ -1,4822 +1,10 @@
-/* created by GBA Tile Editor
-   regular map */
+/* GBA_Metroid_Title_Screen.h
+ * generated by tools/assets.py from GBA_Metroid_Title_Screen.png, the data is in the asset pack */
 
 #define GBA_Metroid_Title_Screen_width 256
 #define GBA_Metroid_Title_Screen_height 227
+#define GBA_Metroid_Title_Screen_data_bytes 59392
+#define GBA_Metroid_Title_Screen_palette_bytes 512
 
-const unsigned char GBA_Metroid_Title_Screen_data [] = {
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x04, 0x01, 0x01, 
-    0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x01, 0x03, 0x09, 0x0D, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0F, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0C, 
-    0x02, 0x03, 0x03, 0x03, 0x02, 0x10, 0x0E, 0x02, 0x06, 0x06, 0x06, 0x06, 
-    0x11, 0x12, 0x13, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0F, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0F, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x02, 0x10, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x14, 0x15, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x0B, 0x0E, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0C, 0x0E, 0x0B, 0x01, 
-    0x01, 0x01, 0x0B, 0x16, 0x0E, 0x0E, 0x0B, 0x01, 0x0B, 0x0B, 0x17, 0x16, 
-    0x0C, 0x01, 0x01, 0x01, 0x18, 0x18, 0x19, 0x1A, 0x01, 0x01, 0x01, 0x01, 
-    0x18, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x1B, 0x1C, 0x06, 0x06, 
-    0x06, 0x06, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0E, 0x10, 0x01, 0x01, 0x01, 0x0B, 
-    0x0B, 0x0B, 0x0E, 0x13, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 
-    0x01, 0x01, 0x02, 0x03, 0x06, 0x06, 0x06, 0x11, 0x03, 0x04, 0x11, 0x06, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 
-    0x06, 0x06, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x02, 0x0B, 0x04, 0x02, 
-    0x06, 0x06, 0x06, 0x06, 0x08, 0x0B, 0x1D, 0x14, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0E, 0x10, 0x0B, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x0B, 0x10, 0x0B, 
-    0x01, 0x01, 0x01, 0x0C, 0x01, 0x0B, 0x1A, 0x0B, 0x03, 0x03, 0x03, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x06, 0x06, 0x06, 0x06, 
-    0x06, 0x06, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x01, 
-    0x0A, 0x11, 0x07, 0x06, 0x06, 0x11, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 0x1E, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0F, 0x0C, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x1F, 0x0C, 0x01, 0x02, 0x03, 0x03, 0x03, 
-    0x04, 0x1F, 0x0C, 0x01, 0x11, 0x06, 0x06, 0x07, 0x05, 0x0A, 0x09, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 
-    0x0E, 0x16, 0x0B, 0x01, 0x01, 0x0C, 0x0E, 0x01, 0x0E, 0x10, 0x0E, 0x0B, 
-    0x01, 0x0C, 0x0F, 0x0C, 0x16, 0x0F, 0x0B, 0x0B, 0x01, 0x0E, 0x16, 0x20, 
-    0x16, 0x0B, 0x01, 0x01, 0x0B, 0x1F, 0x21, 0x20, 0x0E, 0x01, 0x01, 0x01, 
-    0x18, 0x22, 0x22, 0x1F, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 
-    0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0E, 0x0E, 0x0B, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0E, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0C, 0x0B, 
-    0x01, 0x01, 0x01, 0x0B, 0x0C, 0x10, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0E, 0x0F, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x23, 0x0C, 
-    0x0B, 0x01, 0x01, 0x01, 0x0F, 0x0B, 0x0B, 0x21, 0x0C, 0x01, 0x01, 0x01, 
-    0x0B, 0x01, 0x01, 0x0F, 0x18, 0x0C, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x18, 0x1E, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x0C, 0x1E, 0x01, 0x01, 0x0B, 0x0B, 
-    0x0C, 0x20, 0x0E, 0x04, 0x01, 0x01, 0x0C, 0x0C, 0x18, 0x16, 0x0B, 0x1E, 
-    0x01, 0x01, 0x1F, 0x19, 0x20, 0x0E, 0x0B, 0x24, 0x01, 0x0B, 0x1A, 0x22, 
-    0x20, 0x0B, 0x0B, 0x25, 0x01, 0x18, 0x26, 0x18, 0x0B, 0x0B, 0x0C, 0x25, 
-    0x05, 0x27, 0x27, 0x27, 0x27, 0x28, 0x29, 0x07, 0x05, 0x27, 0x2A, 0x2A, 
-    0x2A, 0x27, 0x27, 0x27, 0x05, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x05, 0x27, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x05, 0x2A, 0x2A, 0x2A, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x05, 0x27, 0x27, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x05, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x27, 0x05, 0x29, 0x28, 0x2A, 
-    0x2A, 0x2A, 0x2A, 0x27, 0x1C, 0x0D, 0x02, 0x1D, 0x0D, 0x11, 0x29, 0x29, 
-    0x28, 0x28, 0x11, 0x29, 0x28, 0x2A, 0x27, 0x27, 0x27, 0x27, 0x2A, 0x27, 
-    0x27, 0x27, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x28, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x28, 0x28, 0x28, 0x2A, 0x27, 0x2A, 0x2A, 0x2A, 0x27, 0x27, 0x27, 0x27, 
-    0x2B, 0x09, 0x1E, 0x05, 0x2A, 0x2A, 0x2A, 0x27, 0x07, 0x0A, 0x1E, 0x05, 
-    0x2A, 0x2A, 0x2A, 0x27, 0x07, 0x2C, 0x25, 0x05, 0x2A, 0x2A, 0x2A, 0x27, 
-    0x07, 0x12, 0x2D, 0x05, 0x2A, 0x2A, 0x2A, 0x2A, 0x06, 0x12, 0x2D, 0x05, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x14, 0x0A, 0x2E, 0x05, 0x2A, 0x28, 0x28, 0x2A, 
-    0x2F, 0x0A, 0x2D, 0x05, 0x27, 0x28, 0x28, 0x2A, 0x14, 0x09, 0x1E, 0x05, 
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2A, 0x2A, 0x2A, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x27, 0x2A, 0x2A, 0x2A, 0x27, 0x27, 0x27, 0x27, 
-    0x2A, 0x2A, 0x27, 0x28, 0x06, 0x06, 0x06, 0x06, 0x27, 0x2A, 0x27, 0x29, 
-    0x1D, 0x03, 0x03, 0x02, 0x2A, 0x2A, 0x27, 0x29, 0x09, 0x01, 0x0C, 0x30, 
-    0x28, 0x27, 0x27, 0x29, 0x0D, 0x0A, 0x2C, 0x2C, 0x28, 0x2A, 0x2A, 0x29, 
-    0x07, 0x07, 0x07, 0x07, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x28, 0x15, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x27, 0x28, 0x0D, 0x27, 0x27, 0x27, 0x27, 
-    0x27, 0x27, 0x28, 0x0D, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x14, 0x0D, 
-    0x2C, 0x02, 0x31, 0x32, 0x02, 0x02, 0x02, 0x03, 0x17, 0x0C, 0x1B, 0x30, 
-    0x01, 0x0B, 0x0B, 0x01, 0x0A, 0x0A, 0x33, 0x12, 0x0A, 0x0A, 0x09, 0x02, 
-    0x07, 0x07, 0x06, 0x07, 0x07, 0x29, 0x2F, 0x0D, 0x17, 0x1C, 0x27, 0x27, 
-    0x27, 0x27, 0x27, 0x27, 0x1E, 0x08, 0x28, 0x2A, 0x28, 0x28, 0x28, 0x28, 
-    0x0B, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x0D, 0x0D, 0x01, 0x01, 0x0C, 0x0E, 
-    0x01, 0x30, 0x1F, 0x1E, 0x01, 0x0B, 0x1F, 0x1A, 0x0B, 0x21, 0x17, 0x25, 
-    0x18, 0x0E, 0x0C, 0x0C, 0x0B, 0x16, 0x16, 0x25, 0x0B, 0x0C, 0x0C, 0x0B, 
-    0x0B, 0x0B, 0x0B, 0x34, 0x01, 0x0B, 0x16, 0x0E, 0x0C, 0x0B, 0x0C, 0x2E, 
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x28, 0x2A, 0x2A, 0x2A, 
-    0x2A, 0x28, 0x28, 0x28, 0x08, 0x28, 0x27, 0x2A, 0x2A, 0x05, 0x0D, 0x0D, 
-    0x0D, 0x28, 0x27, 0x2A, 0x28, 0x08, 0x1E, 0x0B, 0x1C, 0x28, 0x27, 0x28, 
-    0x28, 0x08, 0x01, 0x0B, 0x1C, 0x29, 0x27, 0x28, 0x28, 0x08, 0x0C, 0x18, 
-    0x0D, 0x2B, 0x2A, 0x28, 0x28, 0x08, 0x1A, 0x1F, 0x1C, 0x2B, 0x27, 0x28, 
-    0x28, 0x08, 0x35, 0x35, 0x27, 0x27, 0x27, 0x07, 0x04, 0x04, 0x06, 0x27, 
-    0x28, 0x28, 0x2A, 0x14, 0x04, 0x04, 0x11, 0x27, 0x1C, 0x1C, 0x1C, 0x1C, 
-    0x01, 0x04, 0x06, 0x27, 0x01, 0x0C, 0x16, 0x0C, 0x01, 0x03, 0x06, 0x27, 
-    0x16, 0x1B, 0x26, 0x18, 0x01, 0x04, 0x11, 0x27, 0x21, 0x36, 0x19, 0x0B, 
-    0x01, 0x04, 0x06, 0x27, 0x35, 0x37, 0x22, 0x01, 0x01, 0x03, 0x06, 0x27, 
-    0x1A, 0x38, 0x1A, 0x0B, 0x01, 0x04, 0x11, 0x2A, 0x27, 0x27, 0x27, 0x27, 
-    0x27, 0x27, 0x27, 0x27, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x2A, 0x2A, 0x2A, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2A, 0x2A, 0x29, 0x06, 
-    0x06, 0x06, 0x06, 0x06, 0x2A, 0x27, 0x07, 0x09, 0x03, 0x03, 0x02, 0x15, 
-    0x2A, 0x27, 0x07, 0x02, 0x01, 0x01, 0x39, 0x15, 0x2A, 0x27, 0x07, 0x0A, 
-    0x01, 0x01, 0x39, 0x15, 0x2A, 0x2A, 0x06, 0x0A, 0x0B, 0x01, 0x39, 0x3A, 
-    0x27, 0x27, 0x27, 0x27, 0x08, 0x25, 0x1D, 0x28, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x08, 0x0E, 0x1D, 0x29, 0x2A, 0x2A, 0x2A, 0x2A, 0x08, 0x34, 0x2C, 0x2B, 
-    0x28, 0x2A, 0x27, 0x2A, 0x08, 0x3B, 0x3C, 0x2F, 0x28, 0x27, 0x2A, 0x2A, 
-    0x08, 0x35, 0x15, 0x2F, 0x28, 0x27, 0x2A, 0x2A, 0x08, 0x35, 0x3C, 0x2F, 
-    0x28, 0x27, 0x2A, 0x2A, 0x08, 0x17, 0x12, 0x2F, 0x28, 0x27, 0x27, 0x27, 
-    0x08, 0x0E, 0x1D, 0x2F, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 
-    0x27, 0x28, 0x28, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x27, 0x28, 0x28, 0x27, 
-    0x27, 0x27, 0x27, 0x27, 0x2A, 0x29, 0x28, 0x07, 0x06, 0x06, 0x06, 0x06, 
-    0x29, 0x29, 0x28, 0x05, 0x03, 0x02, 0x3D, 0x02, 0x29, 0x29, 0x28, 0x05, 
-    0x1E, 0x30, 0x3E, 0x18, 0x29, 0x29, 0x28, 0x05, 0x01, 0x39, 0x3F, 0x18, 
-    0x29, 0x29, 0x29, 0x05, 0x1E, 0x16, 0x3F, 0x18, 0x27, 0x27, 0x27, 0x27, 
-    0x2A, 0x27, 0x11, 0x01, 0x2A, 0x2A, 0x2A, 0x2A, 0x29, 0x27, 0x11, 0x01, 
-    0x27, 0x27, 0x2A, 0x2A, 0x29, 0x27, 0x11, 0x01, 0x06, 0x06, 0x28, 0x2A, 
-    0x28, 0x27, 0x11, 0x01, 0x03, 0x1D, 0x06, 0x2A, 0x28, 0x2A, 0x11, 0x1E, 
-    0x01, 0x0A, 0x2F, 0x2A, 0x28, 0x28, 0x05, 0x0F, 0x01, 0x09, 0x2F, 0x28, 
-    0x28, 0x28, 0x05, 0x24, 0x01, 0x09, 0x2F, 0x29, 0x28, 0x28, 0x05, 0x24, 
-    0x02, 0x07, 0x27, 0x27, 0x27, 0x06, 0x04, 0x04, 0x03, 0x07, 0x27, 0x2A, 
-    0x27, 0x06, 0x04, 0x04, 0x03, 0x07, 0x27, 0x2A, 0x27, 0x06, 0x04, 0x01, 
-    0x03, 0x06, 0x27, 0x2A, 0x2A, 0x06, 0x04, 0x04, 0x03, 0x07, 0x27, 0x28, 
-    0x28, 0x06, 0x04, 0x04, 0x02, 0x14, 0x2A, 0x2A, 0x28, 0x06, 0x04, 0x04, 
-    0x0A, 0x14, 0x28, 0x2A, 0x28, 0x06, 0x04, 0x04, 0x2C, 0x14, 0x29, 0x28, 
-    0x28, 0x14, 0x24, 0x24, 0x06, 0x27, 0x27, 0x27, 0x28, 0x07, 0x2B, 0x29, 
-    0x11, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x06, 0x27, 0x29, 0x07, 
-    0x07, 0x2A, 0x27, 0x28, 0x11, 0x2A, 0x05, 0x2C, 0x09, 0x05, 0x07, 0x2A, 
-    0x11, 0x2A, 0x05, 0x25, 0x1F, 0x25, 0x0A, 0x11, 0x11, 0x2A, 0x05, 0x25, 
-    0x0C, 0x0C, 0x1F, 0x02, 0x11, 0x2A, 0x05, 0x25, 0x1F, 0x0C, 0x0C, 0x02, 
-    0x11, 0x28, 0x05, 0x0F, 0x1F, 0x0C, 0x0B, 0x02, 0x11, 0x0D, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0C, 0x2A, 0x28, 0x1C, 0x01, 0x0B, 0x0B, 0x0B, 0x0C, 
-    0x28, 0x27, 0x06, 0x02, 0x0E, 0x0E, 0x0B, 0x0B, 0x28, 0x27, 0x2A, 0x1C, 
-    0x10, 0x0F, 0x0B, 0x0C, 0x29, 0x2A, 0x28, 0x1C, 0x0F, 0x10, 0x0E, 0x0C, 
-    0x14, 0x2A, 0x28, 0x0D, 0x01, 0x31, 0x23, 0x25, 0x14, 0x28, 0x2A, 0x05, 
-    0x04, 0x19, 0x3D, 0x1A, 0x14, 0x29, 0x28, 0x29, 0x1D, 0x30, 0x22, 0x40, 
-    0x18, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x16, 0x16, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x16, 0x10, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0F, 0x10, 0x16, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x16, 0x18, 
-    0x0B, 0x01, 0x01, 0x0C, 0x0E, 0x0B, 0x0E, 0x16, 0x18, 0x0B, 0x0B, 0x0B, 
-    0x1A, 0x0B, 0x0E, 0x19, 0x16, 0x0C, 0x0C, 0x0B, 0x38, 0x0C, 0x0C, 0x21, 
-    0x20, 0x1F, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x26, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x21, 0x35, 0x0B, 0x01, 0x01, 0x01, 
-    0x01, 0x16, 0x41, 0x21, 0x18, 0x18, 0x0C, 0x0C, 0x18, 0x19, 0x20, 0x0B, 
-    0x1A, 0x0F, 0x0C, 0x16, 0x20, 0x16, 0x0C, 0x0B, 0x01, 0x0B, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x10, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0E, 0x0E, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x23, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x0F, 0x01, 
-    0x0B, 0x0B, 0x01, 0x01, 0x0B, 0x0F, 0x1A, 0x1F, 0x0C, 0x0B, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0C, 0x16, 0x0F, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x16, 0x0E, 0x0B, 
-    0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x10, 0x0E, 0x0B, 0x23, 0x0B, 0x01, 0x01, 0x01, 0x0E, 0x1E, 0x01, 0x0E, 
-    0x0B, 0x01, 0x01, 0x01, 0x0F, 0x0E, 0x0E, 0x16, 0x0C, 0x0E, 0x0B, 0x0B, 
-    0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x16, 0x0E, 0x01, 0x0F, 0x0B, 0x0B, 0x0F, 
-    0x01, 0x16, 0x16, 0x0C, 0x1A, 0x0E, 0x0E, 0x10, 0x01, 0x0B, 0x16, 0x16, 
-    0x1A, 0x0C, 0x0B, 0x0C, 0x01, 0x01, 0x0F, 0x21, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x18, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 0x0E, 0x1A, 
-    0x01, 0x01, 0x01, 0x01, 0x0E, 0x0F, 0x16, 0x35, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x10, 0x0E, 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0E, 0x16, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x16, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0C, 0x16, 0x22, 
-    0x0C, 0x0B, 0x0B, 0x1F, 0x16, 0x16, 0x21, 0x42, 0x30, 0x1F, 0x16, 0x35, 
-    0x42, 0x21, 0x0E, 0x16, 0x35, 0x20, 0x26, 0x43, 0x43, 0x0E, 0x01, 0x01, 
-    0x19, 0x0E, 0x0E, 0x18, 0x0C, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x18, 0x0B, 0x0F, 0x20, 0x0E, 0x01, 0x01, 0x01, 
-    0x16, 0x22, 0x21, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x26, 0x19, 0x0C, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x19, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x18, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x16, 0x20, 0x1F, 0x01, 0x01, 0x0E, 0x0C, 0x01, 0x01, 0x01, 0x0B, 
-    0x0B, 0x01, 0x0F, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0F, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x23, 0x34, 0x01, 0x01, 0x01, 0x01, 0x18, 0x0C, 0x23, 0x0F, 
-    0x01, 0x01, 0x01, 0x0B, 0x21, 0x1F, 0x0F, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x26, 0x1A, 0x10, 0x0E, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x26, 0x26, 
-    0x0C, 0x01, 0x01, 0x0C, 0x0E, 0x0B, 0x37, 0x44, 0x0C, 0x01, 0x01, 0x39, 
-    0x1B, 0x0B, 0x37, 0x37, 0x18, 0x0B, 0x01, 0x45, 0x46, 0x0B, 0x37, 0x3E, 
-    0x0F, 0x0E, 0x01, 0x0B, 0x18, 0x18, 0x0C, 0x18, 0x0E, 0x0E, 0x0B, 0x0B, 
-    0x0C, 0x18, 0x1F, 0x1F, 0x0F, 0x10, 0x0C, 0x0B, 0x0B, 0x0B, 0x18, 0x30, 
-    0x0E, 0x10, 0x0E, 0x0B, 0x01, 0x01, 0x16, 0x37, 0x01, 0x0E, 0x10, 0x0E, 
-    0x0B, 0x01, 0x21, 0x3E, 0x01, 0x0F, 0x31, 0x16, 0x0B, 0x01, 0x21, 0x37, 
-    0x0B, 0x0B, 0x10, 0x17, 0x0C, 0x01, 0x21, 0x3E, 0x0E, 0x0B, 0x0B, 0x20, 
-    0x21, 0x0B, 0x16, 0x3F, 0x0B, 0x21, 0x42, 0x0C, 0x01, 0x0B, 0x0E, 0x0F, 
-    0x0B, 0x16, 0x42, 0x0C, 0x01, 0x0B, 0x0B, 0x1E, 0x0B, 0x0C, 0x17, 0x0B, 
-    0x0B, 0x01, 0x0C, 0x0F, 0x01, 0x0E, 0x35, 0x0B, 0x01, 0x0B, 0x1F, 0x23, 
-    0x01, 0x0E, 0x21, 0x0B, 0x01, 0x1A, 0x1A, 0x1E, 0x01, 0x0C, 0x30, 0x0B, 
-    0x0B, 0x0F, 0x1A, 0x1E, 0x01, 0x16, 0x26, 0x0B, 0x0F, 0x10, 0x17, 0x13, 
-    0x01, 0x18, 0x20, 0x0C, 0x10, 0x17, 0x35, 0x47, 0x05, 0x2B, 0x28, 0x27, 
-    0x28, 0x05, 0x05, 0x08, 0x05, 0x29, 0x28, 0x27, 0x07, 0x1D, 0x3B, 0x2D, 
-    0x05, 0x29, 0x28, 0x28, 0x2F, 0x1D, 0x19, 0x33, 0x05, 0x29, 0x2B, 0x48, 
-    0x2F, 0x1D, 0x1A, 0x33, 0x05, 0x29, 0x2B, 0x49, 0x2F, 0x0D, 0x1F, 0x4A, 
-    0x05, 0x29, 0x29, 0x48, 0x2F, 0x1D, 0x34, 0x4A, 0x4B, 0x2F, 0x2F, 0x49, 
-    0x2F, 0x0D, 0x34, 0x4A, 0x4B, 0x48, 0x48, 0x4C, 0x49, 0x0D, 0x34, 0x4A, 
-    0x11, 0x28, 0x28, 0x2A, 0x29, 0x05, 0x05, 0x08, 0x05, 0x28, 0x28, 0x28, 
-    0x2F, 0x0A, 0x1E, 0x04, 0x05, 0x28, 0x29, 0x29, 0x2F, 0x09, 0x0C, 0x4A, 
-    0x05, 0x29, 0x29, 0x2B, 0x49, 0x09, 0x0E, 0x4D, 0x05, 0x2B, 0x29, 0x2B, 
-    0x4C, 0x09, 0x34, 0x4D, 0x11, 0x48, 0x2F, 0x2B, 0x4C, 0x09, 0x0E, 0x4D, 
-    0x05, 0x48, 0x49, 0x2B, 0x4C, 0x09, 0x0E, 0x4D, 0x11, 0x2F, 0x4C, 0x49, 
-    0x4C, 0x09, 0x1F, 0x4D, 0x06, 0x28, 0x28, 0x28, 0x14, 0x2C, 0x2D, 0x05, 
-    0x11, 0x29, 0x29, 0x2B, 0x14, 0x2C, 0x2D, 0x05, 0x11, 0x29, 0x2B, 0x49, 
-    0x14, 0x2C, 0x2D, 0x05, 0x4B, 0x2F, 0x29, 0x49, 0x14, 0x2C, 0x4E, 0x05, 
-    0x4F, 0x48, 0x29, 0x48, 0x2F, 0x2C, 0x50, 0x4B, 0x4F, 0x2F, 0x29, 0x49, 
-    0x49, 0x2C, 0x51, 0x4B, 0x4F, 0x2F, 0x29, 0x4C, 0x4F, 0x2C, 0x32, 0x4B, 
-    0x4F, 0x4C, 0x2F, 0x4C, 0x4F, 0x12, 0x52, 0x4B, 0x29, 0x29, 0x2A, 0x29, 
-    0x28, 0x27, 0x28, 0x28, 0x29, 0x2B, 0x28, 0x28, 0x29, 0x28, 0x29, 0x28, 
-    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2F, 0x2B, 0x07, 
-    0x05, 0x05, 0x05, 0x05, 0x2B, 0x49, 0x2F, 0x2F, 0x0D, 0x0F, 0x53, 0x22, 
-    0x4C, 0x4C, 0x2B, 0x2B, 0x33, 0x17, 0x19, 0x35, 0x4C, 0x4C, 0x2B, 0x48, 
-    0x3C, 0x18, 0x26, 0x37, 0x4C, 0x4C, 0x2F, 0x4C, 0x08, 0x1C, 0x1C, 0x08, 
-    0x27, 0x27, 0x28, 0x27, 0x27, 0x27, 0x28, 0x0D, 0x27, 0x2A, 0x29, 0x29, 
-    0x2A, 0x28, 0x29, 0x0D, 0x28, 0x29, 0x29, 0x29, 0x28, 0x28, 0x2F, 0x0D, 
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x11, 0x05, 0x15, 0x54, 0x23, 0x2E, 0x2E, 
-    0x31, 0x3D, 0x20, 0x31, 0x19, 0x1A, 0x0F, 0x19, 0x30, 0x17, 0x35, 0x0E, 
-    0x1B, 0x38, 0x1A, 0x37, 0x37, 0x44, 0x35, 0x0C, 0x08, 0x15, 0x1C, 0x55, 
-    0x15, 0x15, 0x08, 0x1D, 0x0C, 0x19, 0x19, 0x16, 0x0B, 0x0C, 0x0C, 0x25, 
-    0x0C, 0x20, 0x20, 0x16, 0x0E, 0x56, 0x24, 0x25, 0x30, 0x19, 0x16, 0x18, 
-    0x24, 0x53, 0x2E, 0x34, 0x26, 0x1F, 0x0B, 0x0B, 0x0F, 0x51, 0x4A, 0x34, 
-    0x42, 0x0E, 0x0B, 0x0C, 0x0E, 0x0F, 0x2D, 0x34, 0x0F, 0x0F, 0x0F, 0x0F, 
-    0x24, 0x56, 0x2E, 0x2D, 0x24, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2D, 
-    0x34, 0x2E, 0x2E, 0x56, 0x2E, 0x4A, 0x4A, 0x24, 0x1C, 0x2F, 0x28, 0x28, 
-    0x29, 0x08, 0x37, 0x3E, 0x1C, 0x2B, 0x29, 0x2B, 0x2B, 0x08, 0x17, 0x35, 
-    0x1C, 0x48, 0x29, 0x48, 0x2F, 0x08, 0x2D, 0x13, 0x1C, 0x4C, 0x29, 0x48, 
-    0x49, 0x08, 0x0F, 0x34, 0x1C, 0x4C, 0x29, 0x2F, 0x4C, 0x08, 0x24, 0x25, 
-    0x1C, 0x4C, 0x48, 0x2F, 0x4C, 0x08, 0x2D, 0x25, 0x1C, 0x4C, 0x4C, 0x49, 
-    0x4C, 0x08, 0x2E, 0x24, 0x1C, 0x4C, 0x4C, 0x4C, 0x4C, 0x08, 0x2E, 0x56, 
-    0x57, 0x46, 0x34, 0x01, 0x01, 0x04, 0x11, 0x28, 0x58, 0x59, 0x30, 0x0E, 
-    0x1F, 0x02, 0x11, 0x29, 0x58, 0x5A, 0x1A, 0x20, 0x35, 0x4A, 0x11, 0x29, 
-    0x58, 0x58, 0x1A, 0x43, 0x43, 0x2E, 0x11, 0x2F, 0x58, 0x5A, 0x0E, 0x1A, 
-    0x1B, 0x31, 0x11, 0x48, 0x58, 0x5A, 0x0B, 0x25, 0x1A, 0x4A, 0x11, 0x48, 
-    0x45, 0x40, 0x20, 0x25, 0x1A, 0x4A, 0x11, 0x48, 0x25, 0x10, 0x22, 0x25, 
-    0x34, 0x02, 0x14, 0x48, 0x27, 0x2A, 0x14, 0x0A, 0x0C, 0x01, 0x39, 0x15, 
-    0x2A, 0x2A, 0x14, 0x2C, 0x1A, 0x0B, 0x38, 0x5B, 0x28, 0x29, 0x14, 0x2C, 
-    0x3B, 0x25, 0x16, 0x57, 0x2F, 0x29, 0x14, 0x12, 0x35, 0x0E, 0x16, 0x36, 
-    0x2F, 0x28, 0x14, 0x3A, 0x5C, 0x0C, 0x39, 0x5D, 0x2F, 0x29, 0x14, 0x0A, 
-    0x30, 0x25, 0x39, 0x59, 0x48, 0x29, 0x14, 0x33, 0x17, 0x1E, 0x45, 0x5E, 
-    0x4C, 0x29, 0x14, 0x12, 0x30, 0x25, 0x45, 0x5F, 0x29, 0x2A, 0x28, 0x28, 
-    0x08, 0x25, 0x1D, 0x49, 0x1C, 0x15, 0x1C, 0x1C, 0x0D, 0x0C, 0x1D, 0x4C, 
-    0x18, 0x21, 0x18, 0x0C, 0x0C, 0x34, 0x0D, 0x4C, 0x0C, 0x0B, 0x0C, 0x0C, 
-    0x0C, 0x25, 0x0D, 0x4C, 0x18, 0x25, 0x24, 0x24, 0x24, 0x25, 0x1D, 0x4C, 
-    0x18, 0x24, 0x2E, 0x2E, 0x56, 0x34, 0x0D, 0x4C, 0x18, 0x24, 0x4A, 0x2E, 
-    0x2E, 0x34, 0x0D, 0x4C, 0x39, 0x25, 0x4A, 0x56, 0x56, 0x34, 0x0D, 0x4C, 
-    0x29, 0x29, 0x48, 0x4B, 0x1E, 0x16, 0x5D, 0x18, 0x2F, 0x28, 0x48, 0x4B, 
-    0x0B, 0x39, 0x60, 0x1F, 0x49, 0x29, 0x48, 0x4B, 0x1E, 0x38, 0x60, 0x18, 
-    0x49, 0x2F, 0x4C, 0x4B, 0x25, 0x38, 0x60, 0x18, 0x4C, 0x4C, 0x4C, 0x4B, 
-    0x0F, 0x61, 0x60, 0x1F, 0x4C, 0x4C, 0x4C, 0x4B, 0x10, 0x61, 0x60, 0x1F, 
-    0x4C, 0x4C, 0x4C, 0x4B, 0x0D, 0x0D, 0x15, 0x1D, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x01, 0x09, 0x2F, 0x29, 0x29, 0x29, 0x05, 0x25, 
-    0x0B, 0x09, 0x2F, 0x29, 0x29, 0x29, 0x11, 0x1E, 0x0B, 0x12, 0x49, 0x2B, 
-    0x29, 0x29, 0x05, 0x01, 0x0B, 0x1D, 0x4C, 0x2B, 0x2B, 0x2F, 0x11, 0x01, 
-    0x25, 0x2C, 0x4C, 0x49, 0x2F, 0x48, 0x05, 0x1E, 0x25, 0x0A, 0x4C, 0x4C, 
-    0x2F, 0x4C, 0x4B, 0x0E, 0x1D, 0x1C, 0x4F, 0x4C, 0x49, 0x4C, 0x4B, 0x0E, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4F, 0x38, 0x02, 0x14, 0x29, 0x29, 
-    0x29, 0x11, 0x62, 0x56, 0x02, 0x14, 0x29, 0x29, 0x2B, 0x11, 0x63, 0x10, 
-    0x02, 0x14, 0x29, 0x48, 0x48, 0x14, 0x31, 0x2E, 0x03, 0x14, 0x29, 0x4C, 
-    0x48, 0x14, 0x04, 0x04, 0x02, 0x14, 0x2B, 0x49, 0x29, 0x11, 0x02, 0x24, 
-    0x02, 0x4F, 0x2F, 0x49, 0x2B, 0x14, 0x4A, 0x0F, 0x0A, 0x4F, 0x49, 0x4C, 
-    0x49, 0x14, 0x62, 0x21, 0x31, 0x4F, 0x4C, 0x4C, 0x48, 0x14, 0x10, 0x21, 
-    0x11, 0x29, 0x05, 0x1A, 0x0C, 0x0B, 0x0B, 0x25, 0x11, 0x29, 0x05, 0x0E, 
-    0x0C, 0x0B, 0x0E, 0x30, 0x11, 0x29, 0x05, 0x1E, 0x0C, 0x0C, 0x17, 0x44, 
-    0x11, 0x29, 0x05, 0x0E, 0x0E, 0x25, 0x38, 0x46, 0x4F, 0x2F, 0x05, 0x34, 
-    0x34, 0x1B, 0x60, 0x31, 0x4F, 0x2F, 0x05, 0x17, 0x26, 0x46, 0x57, 0x02, 
-    0x4F, 0x49, 0x05, 0x37, 0x35, 0x1A, 0x34, 0x1C, 0x4F, 0x4C, 0x4B, 0x20, 
-    0x51, 0x0D, 0x08, 0x4C, 0x0D, 0x2F, 0x29, 0x2B, 0x1D, 0x1E, 0x18, 0x64, 
-    0x12, 0x2F, 0x28, 0x2F, 0x09, 0x0C, 0x0E, 0x45, 0x33, 0x14, 0x29, 0x2F, 
-    0x1D, 0x0E, 0x0E, 0x1E, 0x4B, 0x2F, 0x28, 0x2F, 0x1D, 0x2D, 0x56, 0x24, 
-    0x4F, 0x2F, 0x29, 0x14, 0x2C, 0x2D, 0x2E, 0x56, 0x4F, 0x48, 0x2B, 0x1C, 
-    0x56, 0x2E, 0x4A, 0x56, 0x4C, 0x4C, 0x2F, 0x1C, 0x2E, 0x2E, 0x4A, 0x4A, 
-    0x4C, 0x4C, 0x49, 0x55, 0x53, 0x53, 0x4A, 0x4A, 0x57, 0x45, 0x39, 0x1A, 
-    0x17, 0x0E, 0x0E, 0x0C, 0x21, 0x22, 0x57, 0x37, 0x45, 0x1A, 0x0E, 0x0B, 
-    0x1E, 0x1E, 0x18, 0x5E, 0x65, 0x57, 0x1A, 0x0E, 0x0E, 0x0E, 0x0E, 0x45, 
-    0x66, 0x45, 0x0F, 0x0E, 0x24, 0x0F, 0x0E, 0x1E, 0x1E, 0x0F, 0x0F, 0x0B, 
-    0x24, 0x24, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x2E, 0x24, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x24, 0x4A, 0x2E, 0x24, 0x0E, 0x0E, 0x0E, 0x24, 0x2E, 
-    0x1A, 0x13, 0x34, 0x17, 0x19, 0x0B, 0x01, 0x0B, 0x19, 0x26, 0x17, 0x2E, 
-    0x0F, 0x0B, 0x0B, 0x0B, 0x57, 0x5D, 0x36, 0x1E, 0x25, 0x1F, 0x0E, 0x0B, 
-    0x46, 0x46, 0x21, 0x1E, 0x25, 0x1F, 0x18, 0x0B, 0x1E, 0x2D, 0x13, 0x34, 
-    0x25, 0x21, 0x21, 0x1E, 0x0E, 0x51, 0x47, 0x34, 0x0C, 0x21, 0x35, 0x0C, 
-    0x24, 0x62, 0x67, 0x13, 0x34, 0x1A, 0x1A, 0x0C, 0x24, 0x53, 0x68, 0x47, 
-    0x25, 0x21, 0x21, 0x0E, 0x01, 0x01, 0x17, 0x17, 0x18, 0x0B, 0x01, 0x0B, 
-    0x0B, 0x0B, 0x0F, 0x16, 0x16, 0x0B, 0x18, 0x0F, 0x0C, 0x0B, 0x01, 0x18, 
-    0x26, 0x0C, 0x0C, 0x0C, 0x0E, 0x0B, 0x01, 0x18, 0x37, 0x1F, 0x0C, 0x01, 
-    0x0E, 0x0B, 0x01, 0x0B, 0x3E, 0x39, 0x01, 0x0B, 0x1F, 0x0B, 0x01, 0x0B, 
-    0x3F, 0x39, 0x01, 0x0B, 0x1F, 0x0B, 0x01, 0x18, 0x60, 0x21, 0x01, 0x0B, 
-    0x19, 0x0C, 0x01, 0x0C, 0x60, 0x21, 0x01, 0x0B, 0x0F, 0x19, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x0C, 0x0F, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x18, 0x0B, 0x0E, 0x0E, 0x0B, 0x01, 0x01, 0x01, 0x18, 
-    0x0B, 0x0E, 0x0E, 0x0C, 0x0B, 0x0B, 0x01, 0x18, 0x0E, 0x16, 0x16, 0x16, 
-    0x0C, 0x0B, 0x01, 0x18, 0x0E, 0x10, 0x16, 0x16, 0x18, 0x0B, 0x01, 0x01, 
-    0x3E, 0x18, 0x0E, 0x16, 0x01, 0x01, 0x01, 0x0C, 0x5D, 0x16, 0x0B, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x5D, 0x16, 0x0E, 0x35, 0x01, 0x01, 0x01, 0x01, 
-    0x5D, 0x39, 0x0F, 0x1B, 0x0B, 0x01, 0x0B, 0x01, 0x5D, 0x39, 0x0F, 0x38, 
-    0x0B, 0x0F, 0x0E, 0x01, 0x3E, 0x1A, 0x21, 0x37, 0x0B, 0x0E, 0x0E, 0x1E, 
-    0x35, 0x0E, 0x45, 0x60, 0x0C, 0x0C, 0x0C, 0x1E, 0x19, 0x0F, 0x1B, 0x60, 
-    0x0C, 0x0E, 0x0F, 0x1E, 0x21, 0x0E, 0x01, 0x0B, 0x01, 0x0B, 0x0B, 0x01, 
-    0x19, 0x21, 0x01, 0x0C, 0x0C, 0x0C, 0x0B, 0x01, 0x21, 0x3E, 0x0C, 0x0B, 
-    0x0C, 0x18, 0x0B, 0x01, 0x21, 0x60, 0x18, 0x0E, 0x18, 0x18, 0x0B, 0x01, 
-    0x39, 0x57, 0x18, 0x19, 0x0F, 0x0B, 0x01, 0x01, 0x21, 0x57, 0x0E, 0x23, 
-    0x0E, 0x01, 0x01, 0x01, 0x21, 0x60, 0x0C, 0x10, 0x0E, 0x01, 0x01, 0x01, 
-    0x45, 0x5A, 0x18, 0x0E, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x18, 0x0B, 0x0C, 0x16, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x0C, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x18, 0x0C, 0x0C, 0x1A, 0x01, 0x01, 0x01, 0x01, 0x20, 0x0E, 0x0E, 0x20, 
-    0x01, 0x01, 0x01, 0x01, 0x21, 0x18, 0x0C, 0x10, 0x01, 0x0C, 0x0B, 0x01, 
-    0x22, 0x1F, 0x0B, 0x0C, 0x01, 0x0C, 0x0C, 0x0B, 0x36, 0x16, 0x0B, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0E, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x01, 0x01, 0x0C, 
-    0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0B, 0x01, 0x10, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0B, 0x01, 0x0E, 
-    0x01, 0x01, 0x01, 0x0C, 0x0E, 0x0B, 0x01, 0x0C, 0x01, 0x0C, 0x0C, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0E, 0x1F, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0E, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0E, 0x0B, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0B, 0x0E, 0x01, 
-    0x01, 0x01, 0x0B, 0x0E, 0x0F, 0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x18, 0x16, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x01, 
-    0x01, 0x01, 0x0C, 0x0B, 0x01, 0x0B, 0x0B, 0x0B, 0x01, 0x0B, 0x0F, 0x0E, 
-    0x16, 0x0F, 0x0E, 0x0B, 0x0B, 0x0B, 0x10, 0x0F, 0x16, 0x10, 0x16, 0x0B, 
-    0x0E, 0x10, 0x0F, 0x0F, 0x0E, 0x0F, 0x3D, 0x3D, 0x16, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x0F, 0x0F, 0x18, 0x0C, 0x0B, 0x18, 0x0C, 0x0B, 0x0B, 0x0C, 
-    0x18, 0x16, 0x0E, 0x30, 0x16, 0x0F, 0x21, 0x41, 0x0E, 0x18, 0x1F, 0x26, 
-    0x01, 0x0E, 0x16, 0x69, 0x1F, 0x3E, 0x21, 0x42, 0x01, 0x0E, 0x0C, 0x0B, 
-    0x0F, 0x3F, 0x16, 0x16, 0x0B, 0x0B, 0x0B, 0x01, 0x0E, 0x3E, 0x0F, 0x0E, 
-    0x0E, 0x0C, 0x17, 0x01, 0x16, 0x3F, 0x16, 0x0F, 0x01, 0x01, 0x01, 0x0B, 
-    0x1F, 0x19, 0x69, 0x0F, 0x0C, 0x0B, 0x0C, 0x19, 0x26, 0x17, 0x0E, 0x0E, 
-    0x30, 0x18, 0x30, 0x69, 0x26, 0x1F, 0x25, 0x0E, 0x21, 0x0C, 0x20, 0x37, 
-    0x1A, 0x0B, 0x16, 0x17, 0x21, 0x01, 0x16, 0x16, 0x0C, 0x0C, 0x38, 0x37, 
-    0x1A, 0x0B, 0x0C, 0x25, 0x0C, 0x38, 0x37, 0x37, 0x0F, 0x0C, 0x1A, 0x1A, 
-    0x1B, 0x3E, 0x3E, 0x21, 0x10, 0x0F, 0x17, 0x3E, 0x36, 0x36, 0x21, 0x16, 
-    0x38, 0x1F, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x18, 0x3E, 0x21, 0x01, 0x01, 
-    0x0B, 0x01, 0x01, 0x01, 0x3F, 0x1B, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 0x0B, 
-    0x3F, 0x45, 0x01, 0x0B, 0x0C, 0x0C, 0x0B, 0x0C, 0x3F, 0x45, 0x01, 0x01, 
-    0x0B, 0x0E, 0x0F, 0x1A, 0x21, 0x18, 0x01, 0x01, 0x0B, 0x0E, 0x0F, 0x23, 
-    0x0F, 0x18, 0x0B, 0x01, 0x0B, 0x0F, 0x17, 0x19, 0x16, 0x16, 0x0B, 0x01, 
-    0x0B, 0x1A, 0x19, 0x26, 0x10, 0x0C, 0x01, 0x21, 0x37, 0x0C, 0x1B, 0x1B, 
-    0x01, 0x01, 0x01, 0x39, 0x38, 0x24, 0x36, 0x45, 0x01, 0x0B, 0x01, 0x45, 
-    0x46, 0x25, 0x60, 0x46, 0x0C, 0x0C, 0x01, 0x45, 0x5C, 0x0B, 0x59, 0x58, 
-    0x21, 0x0E, 0x1E, 0x45, 0x36, 0x0C, 0x6A, 0x58, 0x41, 0x1A, 0x25, 0x38, 
-    0x40, 0x25, 0x58, 0x58, 0x43, 0x17, 0x34, 0x1B, 0x46, 0x25, 0x6A, 0x6A, 
-    0x42, 0x47, 0x13, 0x21, 0x1B, 0x0E, 0x58, 0x46, 0x0E, 0x10, 0x0E, 0x0E, 
-    0x18, 0x0B, 0x18, 0x1B, 0x0F, 0x62, 0x23, 0x1A, 0x0C, 0x01, 0x16, 0x37, 
-    0x1E, 0x10, 0x3D, 0x17, 0x1F, 0x01, 0x21, 0x3F, 0x1E, 0x0C, 0x0F, 0x20, 
-    0x26, 0x0B, 0x21, 0x5D, 0x0E, 0x0E, 0x0C, 0x10, 0x20, 0x25, 0x21, 0x3F, 
-    0x34, 0x13, 0x16, 0x45, 0x16, 0x1E, 0x0F, 0x1B, 0x2E, 0x23, 0x6B, 0x6C, 
-    0x16, 0x1E, 0x18, 0x1B, 0x4D, 0x62, 0x23, 0x10, 0x10, 0x25, 0x21, 0x3F, 
-    0x0B, 0x0E, 0x38, 0x25, 0x34, 0x35, 0x35, 0x13, 0x01, 0x16, 0x3F, 0x1A, 
-    0x1F, 0x60, 0x5D, 0x17, 0x01, 0x21, 0x5D, 0x38, 0x3B, 0x57, 0x60, 0x38, 
-    0x0B, 0x16, 0x37, 0x17, 0x38, 0x66, 0x58, 0x5A, 0x0B, 0x18, 0x17, 0x46, 
-    0x6D, 0x6D, 0x6D, 0x6E, 0x0C, 0x39, 0x6F, 0x64, 0x70, 0x71, 0x39, 0x0F, 
-    0x0C, 0x21, 0x59, 0x40, 0x31, 0x10, 0x2D, 0x2D, 0x0C, 0x18, 0x21, 0x2D, 
-    0x2D, 0x2E, 0x4A, 0x2E, 0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x0D, 0x34, 0x4A, 
-    0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x3C, 0x34, 0x4A, 0x4B, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x1C, 0x72, 0x73, 0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x1C, 0x74, 0x75, 
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x2C, 0x25, 0x24, 0x0F, 0x34, 0x34, 0x24, 
-    0x24, 0x2E, 0x4A, 0x2E, 0x56, 0x2E, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 
-    0x2E, 0x2E, 0x4A, 0x2E, 0x2E, 0x4A, 0x2E, 0x4A, 0x05, 0x48, 0x4C, 0x4C, 
-    0x4C, 0x09, 0x0E, 0x4D, 0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x09, 0x25, 0x4D, 
-    0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x09, 0x10, 0x76, 0x4F, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x09, 0x23, 0x33, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x2C, 0x25, 0x4A, 
-    0x24, 0x24, 0x24, 0x24, 0x0F, 0x0B, 0x56, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 
-    0x2E, 0x0B, 0x56, 0x4A, 0x4A, 0x2E, 0x2E, 0x4A, 0x2E, 0x0E, 0x53, 0x50, 
-    0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x3C, 0x32, 0x4B, 0x4F, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x12, 0x34, 0x4B, 0x4F, 0x4C, 0x4C, 0x4C, 0x4C, 0x2C, 0x25, 0x4B, 
-    0x4F, 0x4C, 0x4C, 0x4C, 0x4C, 0x2C, 0x25, 0x4B, 0x1C, 0x1C, 0x1C, 0x1C, 
-    0x1C, 0x2C, 0x24, 0x1C, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x4A, 0x4A, 0x2E, 0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x4D, 0x4D, 0x4E, 0x4E, 
-    0x4A, 0x4A, 0x4E, 0x73, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x1C, 0x1C, 0x1C, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2E, 0x2E, 0x2E, 0x67, 
-    0x68, 0x67, 0x67, 0x2E, 0x53, 0x74, 0x74, 0x2E, 0x0F, 0x24, 0x24, 0x0E, 
-    0x75, 0x73, 0x32, 0x56, 0x24, 0x24, 0x56, 0x2E, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4C, 0x1C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x0D, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x0D, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4C, 0x0D, 0x55, 0x55, 0x1C, 0x1C, 0x1C, 0x1C, 0x15, 0x12, 
-    0x2E, 0x56, 0x25, 0x0E, 0x1E, 0x18, 0x6A, 0x38, 0x0E, 0x24, 0x56, 0x2E, 
-    0x56, 0x0E, 0x6A, 0x1B, 0x4A, 0x4A, 0x53, 0x53, 0x4A, 0x0E, 0x6A, 0x38, 
-    0x62, 0x53, 0x4A, 0x4A, 0x4A, 0x4A, 0x2E, 0x2E, 0x10, 0x67, 0x73, 0x75, 
-    0x75, 0x50, 0x2E, 0x2D, 0x25, 0x2E, 0x67, 0x33, 0x33, 0x77, 0x53, 0x34, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x25, 0x74, 0x4E, 0x25, 0x0E, 0x0F, 0x2E, 0x0F, 
-    0x24, 0x77, 0x77, 0x2E, 0x25, 0x56, 0x2E, 0x4A, 0x56, 0x53, 0x78, 0x50, 
-    0x24, 0x4A, 0x4D, 0x4A, 0x4A, 0x56, 0x24, 0x53, 0x55, 0x4F, 0x4F, 0x55, 
-    0x55, 0x3C, 0x4A, 0x55, 0x1C, 0x4C, 0x4C, 0x4C, 0x4C, 0x08, 0x2D, 0x2D, 
-    0x1C, 0x4C, 0x4C, 0x4C, 0x4C, 0x08, 0x72, 0x52, 0x1C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4B, 0x68, 0x79, 0x1C, 0x4C, 0x4C, 0x4C, 0x4C, 0x08, 0x25, 0x24, 
-    0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x0D, 0x24, 0x0E, 0x56, 0x34, 0x0F, 0x34, 
-    0x2E, 0x4A, 0x2E, 0x2E, 0x32, 0x4D, 0x2E, 0x4A, 0x4A, 0x2E, 0x53, 0x4E, 
-    0x4C, 0x4F, 0x55, 0x7A, 0x75, 0x7B, 0x4F, 0x4F, 0x4A, 0x23, 0x10, 0x0E, 
-    0x1A, 0x02, 0x4F, 0x4C, 0x4D, 0x62, 0x23, 0x0F, 0x34, 0x4A, 0x4F, 0x4C, 
-    0x32, 0x62, 0x62, 0x0F, 0x34, 0x4D, 0x4F, 0x4C, 0x24, 0x0E, 0x0F, 0x2E, 
-    0x2E, 0x0A, 0x4F, 0x4C, 0x24, 0x0F, 0x56, 0x56, 0x2E, 0x4E, 0x1C, 0x1C, 
-    0x10, 0x62, 0x53, 0x2E, 0x2E, 0x4A, 0x4A, 0x2D, 0x4E, 0x62, 0x51, 0x2E, 
-    0x4D, 0x2E, 0x2E, 0x4A, 0x4F, 0x53, 0x3B, 0x55, 0x4F, 0x12, 0x50, 0x7C, 
-    0x4C, 0x48, 0x06, 0x09, 0x34, 0x1E, 0x45, 0x5F, 0x4C, 0x49, 0x49, 0x2C, 
-    0x34, 0x1E, 0x45, 0x7D, 0x4C, 0x4C, 0x4F, 0x2C, 0x2E, 0x25, 0x45, 0x7D, 
-    0x4C, 0x4C, 0x4C, 0x2C, 0x2D, 0x2D, 0x45, 0x5E, 0x1C, 0x1C, 0x1C, 0x2C, 
-    0x4A, 0x2D, 0x45, 0x5E, 0x2D, 0x2E, 0x2E, 0x4A, 0x4A, 0x25, 0x61, 0x5E, 
-    0x4D, 0x4A, 0x4A, 0x4A, 0x4E, 0x24, 0x39, 0x5A, 0x4F, 0x0D, 0x55, 0x55, 
-    0x4F, 0x15, 0x0D, 0x49, 0x18, 0x04, 0x2E, 0x56, 0x56, 0x2D, 0x0D, 0x4C, 
-    0x39, 0x2D, 0x2E, 0x56, 0x2E, 0x34, 0x0D, 0x4C, 0x39, 0x25, 0x2E, 0x2E, 
-    0x2E, 0x34, 0x0D, 0x4C, 0x18, 0x24, 0x2E, 0x2E, 0x2E, 0x2E, 0x0D, 0x4C, 
-    0x18, 0x24, 0x4A, 0x4E, 0x50, 0x50, 0x3C, 0x55, 0x18, 0x2E, 0x77, 0x52, 
-    0x73, 0x73, 0x4E, 0x51, 0x0F, 0x56, 0x4E, 0x4D, 0x4E, 0x4A, 0x2E, 0x53, 
-    0x15, 0x0D, 0x55, 0x55, 0x4C, 0x55, 0x55, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x55, 0x55, 0x55, 0x55, 0x1C, 0x15, 0x15, 0x1C, 
-    0x73, 0x76, 0x73, 0x2D, 0x1E, 0x40, 0x7E, 0x1F, 0x34, 0x24, 0x2D, 0x2D, 
-    0x2D, 0x40, 0x7F, 0x34, 0x76, 0x15, 0x55, 0x74, 0x2D, 0x21, 0x46, 0x0F, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x5A, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4C, 0x4B, 0x71, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x0E, 
-    0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4F, 0x4A, 0x1C, 0x1C, 0x1C, 0x1C, 
-    0x1C, 0x1C, 0x1C, 0x4A, 0x53, 0x53, 0x4A, 0x2E, 0x4A, 0x74, 0x74, 0x73, 
-    0x75, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x73, 0x74, 0x73, 0x73, 0x73, 
-    0x73, 0x2E, 0x25, 0x0E, 0x71, 0x4F, 0x4C, 0x4C, 0x48, 0x11, 0x31, 0x80, 
-    0x5B, 0x4F, 0x4C, 0x4C, 0x4C, 0x4F, 0x81, 0x71, 0x0A, 0x4C, 0x4C, 0x4C, 
-    0x4C, 0x4F, 0x31, 0x56, 0x2C, 0x4F, 0x4C, 0x4C, 0x4C, 0x4F, 0x02, 0x02, 
-    0x77, 0x1C, 0x55, 0x55, 0x1C, 0x1C, 0x4E, 0x2E, 0x73, 0x73, 0x73, 0x74, 
-    0x0E, 0x0E, 0x56, 0x2E, 0x4D, 0x2E, 0x2E, 0x56, 0x0F, 0x0F, 0x56, 0x32, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x56, 0x32, 0x4F, 0x4C, 0x4B, 0x4B, 
-    0x4B, 0x4C, 0x4C, 0x4C, 0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
-    0x4F, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4F, 0x4C, 0x4C, 0x4C, 
-    0x4F, 0x08, 0x08, 0x4B, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0x4A, 0x2E, 0x56, 
-    0x0F, 0x2E, 0x32, 0x50, 0x2E, 0x2E, 0x24, 0x24, 0x77, 0x74, 0x32, 0x51, 
-    0x2E, 0x56, 0x56, 0x56, 0x73, 0x74, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x4C, 0x4C, 0x4C, 0x0D, 0x67, 0x73, 0x53, 0x53, 0x4C, 0x4C, 0x08, 0x25, 
-    0x4E, 0x68, 0x68, 0x72, 0x4C, 0x4B, 0x1D, 0x25, 0x0F, 0x74, 0x32, 0x74, 
-    0x0D, 0x24, 0x0F, 0x24, 0x0E, 0x0E, 0x0B, 0x4A, 0x0F, 0x56, 0x4D, 0x2E, 
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x4E, 0x4A, 0x56, 0x56, 0x2E, 0x2E, 
-    0x56, 0x56, 0x4A, 0x2E, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x4A, 0x2E, 
-    0x56, 0x56, 0x56, 0x56, 0x4D, 0x4D, 0x56, 0x0F, 0x0E, 0x0E, 0x0F, 0x24, 
-    0x4E, 0x32, 0x53, 0x4A, 0x56, 0x24, 0x0E, 0x24, 0x79, 0x73, 0x4E, 0x4E, 
-    0x4D, 0x56, 0x24, 0x24, 0x68, 0x73, 0x77, 0x78, 0x50, 0x4D, 0x4A, 0x56, 
-    0x0E, 0x2D, 0x67, 0x75, 0x67, 0x77, 0x4E, 0x2E, 0x56, 0x56, 0x2E, 0x4A, 
-    0x32, 0x68, 0x73, 0x73, 0x2E, 0x56, 0x24, 0x0E, 0x24, 0x73, 0x77, 0x74, 
-    0x56, 0x56, 0x56, 0x56, 0x24, 0x0F, 0x0E, 0x25, 0x24, 0x25, 0x63, 0x47, 
-    0x25, 0x1B, 0x40, 0x25, 0x24, 0x0F, 0x20, 0x26, 0x0E, 0x60, 0x58, 0x1E, 
-    0x0E, 0x2D, 0x17, 0x7E, 0x39, 0x5A, 0x5A, 0x1E, 0x24, 0x2D, 0x10, 0x71, 
-    0x18, 0x5A, 0x5A, 0x25, 0x2E, 0x2E, 0x2E, 0x2D, 0x25, 0x46, 0x46, 0x1E, 
-    0x74, 0x4E, 0x4E, 0x51, 0x25, 0x1B, 0x38, 0x25, 0x67, 0x68, 0x75, 0x74, 
-    0x1E, 0x3F, 0x46, 0x1E, 0x53, 0x67, 0x74, 0x74, 0x24, 0x59, 0x6C, 0x01, 
-    0x19, 0x0C, 0x01, 0x0B, 0x60, 0x39, 0x01, 0x0B, 0x0E, 0x0C, 0x01, 0x0B, 
-    0x3F, 0x39, 0x01, 0x0B, 0x0F, 0x0C, 0x0B, 0x0B, 0x40, 0x18, 0x01, 0x0B, 
-    0x20, 0x0F, 0x01, 0x18, 0x5D, 0x16, 0x1E, 0x0C, 0x23, 0x0F, 0x0B, 0x18, 
-    0x82, 0x21, 0x0B, 0x0C, 0x0F, 0x1F, 0x0B, 0x18, 0x59, 0x45, 0x1F, 0x0C, 
-    0x19, 0x1B, 0x0C, 0x0B, 0x36, 0x35, 0x23, 0x0F, 0x20, 0x42, 0x18, 0x0B, 
-    0x26, 0x26, 0x19, 0x17, 0x0B, 0x0C, 0x0B, 0x0B, 0x0C, 0x0C, 0x0B, 0x01, 
-    0x0C, 0x10, 0x23, 0x10, 0x0B, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 
-    0x0B, 0x0C, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x18, 0x0B, 0x01, 0x18, 
-    0x0F, 0x10, 0x16, 0x0F, 0x0F, 0x19, 0x0E, 0x18, 0x16, 0x23, 0x10, 0x34, 
-    0x24, 0x26, 0x16, 0x16, 0x21, 0x21, 0x17, 0x1A, 0x26, 0x3F, 0x21, 0x18, 
-    0x57, 0x83, 0x59, 0x58, 0x84, 0x7E, 0x21, 0x18, 0x0E, 0x0F, 0x1B, 0x60, 
-    0x18, 0x0E, 0x16, 0x1E, 0x0E, 0x1E, 0x1B, 0x60, 0x0C, 0x25, 0x0E, 0x1E, 
-    0x19, 0x1E, 0x21, 0x3E, 0x0E, 0x0C, 0x18, 0x1E, 0x22, 0x0E, 0x16, 0x3E, 
-    0x0C, 0x66, 0x46, 0x1E, 0x36, 0x0F, 0x16, 0x37, 0x1E, 0x66, 0x46, 0x25, 
-    0x59, 0x18, 0x16, 0x37, 0x0E, 0x0E, 0x0E, 0x2D, 0x59, 0x18, 0x0F, 0x37, 
-    0x10, 0x4A, 0x4A, 0x4A, 0x59, 0x0F, 0x0E, 0x30, 0x2E, 0x4A, 0x2E, 0x2E, 
-    0x45, 0x59, 0x18, 0x01, 0x0B, 0x0B, 0x01, 0x0B, 0x40, 0x6C, 0x18, 0x0B, 
-    0x0B, 0x0B, 0x0C, 0x0C, 0x40, 0x85, 0x21, 0x0B, 0x01, 0x18, 0x1F, 0x18, 
-    0x46, 0x5F, 0x38, 0x0B, 0x0B, 0x1F, 0x17, 0x16, 0x36, 0x5E, 0x39, 0x1E, 
-    0x0B, 0x1F, 0x16, 0x19, 0x24, 0x18, 0x1F, 0x0B, 0x0B, 0x1F, 0x1F, 0x20, 
-    0x2D, 0x4A, 0x13, 0x0B, 0x01, 0x1A, 0x35, 0x69, 0x2D, 0x23, 0x19, 0x1A, 
-    0x0B, 0x16, 0x42, 0x5C, 0x0B, 0x0B, 0x0B, 0x0B, 0x37, 0x21, 0x1E, 0x0B, 
-    0x18, 0x18, 0x0B, 0x01, 0x3F, 0x40, 0x1E, 0x0E, 0x1F, 0x1A, 0x0B, 0x01, 
-    0x6A, 0x40, 0x1E, 0x0E, 0x20, 0x19, 0x0B, 0x01, 0x6A, 0x40, 0x1E, 0x0C, 
-    0x41, 0x26, 0x0B, 0x01, 0x57, 0x45, 0x0B, 0x0C, 0x69, 0x26, 0x0B, 0x0B, 
-    0x1B, 0x16, 0x1E, 0x0C, 0x69, 0x41, 0x0B, 0x0B, 0x37, 0x16, 0x1E, 0x0E, 
-    0x5C, 0x42, 0x0B, 0x0B, 0x3E, 0x38, 0x0C, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x18, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x16, 0x16, 0x0B, 0x01, 0x01, 0x0B, 0x0C, 0x0E, 
-    0x0E, 0x16, 0x0C, 0x01, 0x01, 0x01, 0x0B, 0x0F, 0x0C, 0x21, 0x0C, 0x0B, 
-    0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x0F, 0x0F, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x01, 0x0F, 0x18, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0B, 0x01, 0x18, 
-    0x0E, 0x0C, 0x0B, 0x01, 0x18, 0x0B, 0x01, 0x16, 0x16, 0x16, 0x18, 0x0B, 
-    0x18, 0x0E, 0x0B, 0x0C, 0x0F, 0x20, 0x19, 0x1F, 0x0E, 0x0E, 0x0E, 0x0B, 
-    0x0F, 0x19, 0x0B, 0x0C, 0x0E, 0x01, 0x0B, 0x0E, 0x10, 0x0F, 0x0C, 0x1A, 
-    0x0B, 0x01, 0x0B, 0x0F, 0x23, 0x0F, 0x0E, 0x17, 0x01, 0x01, 0x01, 0x0C, 
-    0x0F, 0x0E, 0x0B, 0x1A, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x0B, 0x1A, 
-    0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0F, 0x1A, 0x01, 0x01, 0x0B, 0x0F, 
-    0x20, 0x17, 0x19, 0x22, 0x0C, 0x0B, 0x18, 0x0E, 0x16, 0x34, 0x35, 0x3F, 
-    0x0E, 0x0E, 0x1A, 0x01, 0x16, 0x43, 0x16, 0x31, 0x0E, 0x0C, 0x1A, 0x1E, 
-    0x04, 0x0E, 0x25, 0x0E, 0x17, 0x16, 0x20, 0x0B, 0x16, 0x35, 0x0E, 0x0F, 
-    0x17, 0x16, 0x35, 0x0B, 0x1F, 0x1B, 0x0F, 0x24, 0x35, 0x41, 0x26, 0x1E, 
-    0x0F, 0x37, 0x0E, 0x0E, 0x26, 0x35, 0x1A, 0x01, 0x21, 0x3F, 0x0E, 0x0F, 
-    0x43, 0x35, 0x1A, 0x01, 0x21, 0x3F, 0x0E, 0x0F, 0x3F, 0x21, 0x0F, 0x1E, 
-    0x21, 0x46, 0x0E, 0x24, 0x3D, 0x62, 0x16, 0x37, 0x0B, 0x01, 0x01, 0x0C, 
-    0x0E, 0x0E, 0x0F, 0x0E, 0x0C, 0x0B, 0x0C, 0x0C, 0x0E, 0x10, 0x23, 0x34, 
-    0x0C, 0x0C, 0x0B, 0x0C, 0x0F, 0x34, 0x19, 0x20, 0x0C, 0x0B, 0x0B, 0x16, 
-    0x0F, 0x2D, 0x36, 0x3F, 0x0B, 0x01, 0x0C, 0x10, 0x0F, 0x2D, 0x57, 0x60, 
-    0x0B, 0x0B, 0x0B, 0x01, 0x24, 0x25, 0x57, 0x6A, 0x0C, 0x0E, 0x0B, 0x01, 
-    0x56, 0x24, 0x57, 0x58, 0x0F, 0x24, 0x0E, 0x0B, 0x18, 0x0E, 0x0B, 0x01, 
-    0x0C, 0x13, 0x26, 0x43, 0x19, 0x19, 0x0B, 0x01, 0x0B, 0x10, 0x3E, 0x60, 
-    0x20, 0x16, 0x0C, 0x01, 0x0B, 0x10, 0x43, 0x5D, 0x3D, 0x16, 0x0B, 0x01, 
-    0x01, 0x10, 0x3E, 0x6A, 0x3D, 0x17, 0x0C, 0x01, 0x01, 0x19, 0x5D, 0x7E, 
-    0x3D, 0x20, 0x0E, 0x0B, 0x0B, 0x13, 0x3F, 0x7F, 0x0F, 0x0F, 0x0C, 0x0B, 
-    0x0B, 0x19, 0x60, 0x7F, 0x21, 0x1A, 0x0E, 0x01, 0x0B, 0x35, 0x60, 0x7F, 
-    0x42, 0x41, 0x62, 0x1B, 0x40, 0x0E, 0x46, 0x36, 0x3F, 0x26, 0x23, 0x26, 
-    0x40, 0x0E, 0x20, 0x26, 0x5D, 0x37, 0x2D, 0x35, 0x44, 0x0E, 0x20, 0x20, 
-    0x7E, 0x57, 0x2E, 0x1B, 0x37, 0x0B, 0x57, 0x37, 0x7E, 0x60, 0x35, 0x37, 
-    0x57, 0x25, 0x60, 0x58, 0x82, 0x46, 0x34, 0x57, 0x6A, 0x01, 0x5A, 0x5A, 
-    0x65, 0x57, 0x25, 0x5A, 0x5E, 0x01, 0x86, 0x86, 0x65, 0x46, 0x25, 0x59, 
-    0x5F, 0x0C, 0x85, 0x86, 0x2D, 0x53, 0x2E, 0x4A, 0x2E, 0x1E, 0x45, 0x6C, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x25, 0x45, 0x6A, 0x2E, 0x2E, 0x2E, 0x4A, 
-    0x4A, 0x25, 0x45, 0x7E, 0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x25, 0x45, 0x82, 
-    0x2D, 0x4A, 0x4A, 0x2E, 0x2E, 0x1E, 0x21, 0x59, 0x2D, 0x4A, 0x4A, 0x2E, 
-    0x2E, 0x04, 0x21, 0x60, 0x25, 0x2E, 0x4A, 0x56, 0x2E, 0x25, 0x21, 0x60, 
-    0x25, 0x2E, 0x56, 0x56, 0x2E, 0x0E, 0x21, 0x3F, 0x0B, 0x18, 0x37, 0x2E, 
-    0x4A, 0x4A, 0x2E, 0x4A, 0x0C, 0x39, 0x60, 0x10, 0x4A, 0x4A, 0x2E, 0x2E, 
-    0x0B, 0x45, 0x82, 0x10, 0x4A, 0x4A, 0x2E, 0x2E, 0x0B, 0x45, 0x7D, 0x21, 
-    0x4A, 0x4A, 0x2E, 0x2E, 0x01, 0x40, 0x7D, 0x21, 0x4A, 0x4A, 0x2E, 0x56, 
-    0x01, 0x21, 0x87, 0x10, 0x24, 0x56, 0x4A, 0x53, 0x0B, 0x2E, 0x23, 0x4A, 
-    0x2E, 0x4A, 0x32, 0x77, 0x0C, 0x56, 0x4E, 0x4A, 0x32, 0x67, 0x68, 0x88, 
-    0x2E, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x4A, 0x4A, 0x2E, 0x2E, 0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x4A, 
-    0x4A, 0x4A, 0x2E, 0x2E, 0x56, 0x56, 0x4D, 0x32, 0x4D, 0x4A, 0x56, 0x4A, 
-    0x50, 0x78, 0x73, 0x67, 0x53, 0x53, 0x53, 0x32, 0x75, 0x79, 0x68, 0x74, 
-    0x74, 0x74, 0x68, 0x79, 0x89, 0x32, 0x24, 0x24, 0x79, 0x52, 0x79, 0x74, 
-    0x2E, 0x24, 0x0E, 0x24, 0x4A, 0x2E, 0x2E, 0x4A, 0x2D, 0x32, 0x79, 0x68, 
-    0x2E, 0x2E, 0x53, 0x77, 0x50, 0x74, 0x67, 0x53, 0x4A, 0x4A, 0x77, 0x68, 
-    0x67, 0x24, 0x24, 0x0E, 0x4D, 0x4A, 0x32, 0x74, 0x32, 0x0F, 0x56, 0x56, 
-    0x4D, 0x24, 0x24, 0x0E, 0x24, 0x2E, 0x4A, 0x56, 0x56, 0x24, 0x4D, 0x4A, 
-    0x24, 0x56, 0x4A, 0x56, 0x24, 0x2E, 0x32, 0x32, 0x56, 0x56, 0x4A, 0x53, 
-    0x24, 0x56, 0x4A, 0x4A, 0x56, 0x24, 0x56, 0x4E, 0x52, 0x4E, 0x79, 0x75, 
-    0x73, 0x79, 0x73, 0x67, 0x2E, 0x56, 0x32, 0x53, 0x32, 0x74, 0x53, 0x25, 
-    0x56, 0x53, 0x2E, 0x24, 0x0E, 0x24, 0x24, 0x0E, 0x4D, 0x74, 0x32, 0x56, 
-    0x24, 0x56, 0x56, 0x24, 0x56, 0x2D, 0x56, 0x2E, 0x2E, 0x56, 0x24, 0x24, 
-    0x2E, 0x4A, 0x56, 0x53, 0x2E, 0x56, 0x2E, 0x56, 0x52, 0x77, 0x4A, 0x4A, 
-    0x50, 0x74, 0x4D, 0x4A, 0x4E, 0x4E, 0x4A, 0x53, 0x74, 0x74, 0x53, 0x4A, 
-    0x73, 0x56, 0x24, 0x2E, 0x4A, 0x2E, 0x2E, 0x4A, 0x0F, 0x2E, 0x2E, 0x2E, 
-    0x4A, 0x2E, 0x2E, 0x4A, 0x24, 0x32, 0x73, 0x74, 0x4A, 0x2D, 0x24, 0x4A, 
-    0x24, 0x4A, 0x4D, 0x4A, 0x4A, 0x34, 0x56, 0x4A, 0x56, 0x56, 0x4D, 0x0D, 
-    0x4A, 0x15, 0x4E, 0x77, 0x2E, 0x2E, 0x32, 0x3C, 0x4A, 0x3C, 0x4A, 0x0A, 
-    0x4D, 0x4A, 0x4A, 0x2E, 0x32, 0x53, 0x4A, 0x4A, 0x53, 0x4A, 0x4A, 0x53, 
-    0x32, 0x78, 0x50, 0x73, 0x4D, 0x77, 0x52, 0x52, 0x78, 0x18, 0x3F, 0x35, 
-    0x2E, 0x53, 0x4D, 0x53, 0x4A, 0x24, 0x54, 0x23, 0x56, 0x56, 0x56, 0x56, 
-    0x24, 0x10, 0x8A, 0x23, 0x2E, 0x34, 0x2E, 0x2E, 0x34, 0x13, 0x13, 0x34, 
-    0x7A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x15, 0x2E, 0x2E, 0x2D, 0x2D, 0x25, 0x34, 0x4E, 0x4D, 
-    0x52, 0x4E, 0x50, 0x72, 0x50, 0x50, 0x50, 0x4A, 0x08, 0x4B, 0x08, 0x08, 
-    0x08, 0x7B, 0x75, 0x7A, 0x08, 0x7C, 0x8B, 0x7C, 0x7C, 0x7A, 0x51, 0x1C, 
-    0x55, 0x3A, 0x3A, 0x7C, 0x7C, 0x4F, 0x15, 0x1C, 0x2D, 0x2D, 0x2D, 0x4D, 
-    0x50, 0x78, 0x78, 0x78, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7A, 
-    0x55, 0x55, 0x55, 0x7A, 0x7A, 0x7A, 0x7A, 0x1C, 0x51, 0x32, 0x74, 0x50, 
-    0x32, 0x4A, 0x53, 0x34, 0x4A, 0x50, 0x74, 0x2E, 0x53, 0x4E, 0x78, 0x50, 
-    0x4C, 0x4F, 0x7A, 0x8B, 0x79, 0x8C, 0x4C, 0x8B, 0x7C, 0x3C, 0x0D, 0x4F, 
-    0x55, 0x12, 0x4F, 0x1C, 0x0D, 0x34, 0x3C, 0x4B, 0x4B, 0x0D, 0x55, 0x34, 
-    0x4E, 0x4A, 0x4A, 0x34, 0x51, 0x4E, 0x51, 0x4A, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x1C, 0x15, 0x55, 0x55, 0x7A, 0x7A, 0x8B, 0x8B, 
-    0x34, 0x4A, 0x4E, 0x79, 0x8D, 0x76, 0x68, 0x68, 0x4E, 0x52, 0x68, 0x79, 
-    0x8E, 0x75, 0x72, 0x75, 0x4C, 0x22, 0x61, 0x08, 0x8B, 0x8B, 0x7C, 0x7A, 
-    0x4F, 0x64, 0x8F, 0x08, 0x0D, 0x50, 0x3C, 0x4D, 0x55, 0x90, 0x6F, 0x55, 
-    0x3C, 0x25, 0x34, 0x56, 0x2E, 0x3E, 0x38, 0x4A, 0x32, 0x2D, 0x34, 0x34, 
-    0x1C, 0x1C, 0x1C, 0x55, 0x55, 0x55, 0x55, 0x55, 0x8B, 0x8B, 0x8B, 0x8B, 
-    0x8B, 0x8B, 0x8B, 0x8B, 0x68, 0x75, 0x76, 0x76, 0x91, 0x76, 0x75, 0x75, 
-    0x4E, 0x75, 0x89, 0x75, 0x4A, 0x75, 0x89, 0x76, 0x7C, 0x8B, 0x7C, 0x8B, 
-    0x4F, 0x3C, 0x1C, 0x11, 0x7C, 0x55, 0x08, 0x3C, 0x08, 0x7C, 0x31, 0x92, 
-    0x08, 0x0D, 0x55, 0x0D, 0x4F, 0x08, 0x12, 0x11, 0x4A, 0x4D, 0x4E, 0x53, 
-    0x50, 0x53, 0x4A, 0x4D, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x8B, 0x7A, 0x55, 0x55, 0x1C, 0x55, 0x7A, 0x7A, 0x89, 0x8D, 0x76, 0x51, 
-    0x2E, 0x4A, 0x51, 0x32, 0x8C, 0x93, 0x94, 0x50, 0x32, 0x4E, 0x72, 0x50, 
-    0x12, 0x1C, 0x7C, 0x7C, 0x7A, 0x7C, 0x7C, 0x55, 0x4F, 0x1C, 0x55, 0x08, 
-    0x0D, 0x55, 0x08, 0x3C, 0x4B, 0x0D, 0x15, 0x55, 0x4F, 0x55, 0x55, 0x3C, 
-    0x4A, 0x4A, 0x2D, 0x56, 0x4D, 0x56, 0x56, 0x24, 0x55, 0x55, 0x55, 0x1C, 
-    0x1C, 0x1C, 0x1C, 0x55, 0x8B, 0x7A, 0x7A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
-    0x74, 0x32, 0x74, 0x68, 0x68, 0x68, 0x67, 0x32, 0x4A, 0x4A, 0x53, 0x4A, 
-    0x4A, 0x4A, 0x4E, 0x50, 0x7A, 0x4F, 0x7A, 0x74, 0x2D, 0x20, 0x22, 0x25, 
-    0x2E, 0x4F, 0x1C, 0x25, 0x4A, 0x5C, 0x95, 0x4A, 0x34, 0x0D, 0x1C, 0x34, 
-    0x4A, 0x62, 0x63, 0x51, 0x34, 0x2E, 0x51, 0x51, 0x72, 0x72, 0x72, 0x72, 
-    0x55, 0x55, 0x7A, 0x7A, 0x7A, 0x8B, 0x7C, 0x7C, 0x7A, 0x7A, 0x55, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x4A, 0x2D, 0x34, 0x51, 0x51, 0x4A, 0x2E, 0x13, 
-    0x4A, 0x2E, 0x2E, 0x50, 0x74, 0x74, 0x4D, 0x4E, 0x0E, 0x25, 0x25, 0x1E, 
-    0x1E, 0x0E, 0x0E, 0x24, 0x4A, 0x4A, 0x53, 0x56, 0x24, 0x0F, 0x24, 0x56, 
-    0x4E, 0x32, 0x32, 0x4D, 0x4A, 0x4A, 0x4A, 0x56, 0x72, 0x51, 0x2E, 0x53, 
-    0x32, 0x4E, 0x32, 0x2E, 0x8B, 0x7A, 0x1C, 0x56, 0x2C, 0x3C, 0x2E, 0x15, 
-    0x0D, 0x0D, 0x15, 0x78, 0x68, 0x96, 0x4E, 0x3C, 0x34, 0x25, 0x34, 0x50, 
-    0x73, 0x32, 0x4D, 0x2D, 0x50, 0x4E, 0x2E, 0x24, 0x4D, 0x53, 0x4A, 0x4A, 
-    0x2E, 0x2E, 0x56, 0x24, 0x0F, 0x0F, 0x24, 0x0E, 0x53, 0x50, 0x50, 0x2E, 
-    0x56, 0x4A, 0x2E, 0x24, 0x4A, 0x78, 0x72, 0x4E, 0x4A, 0x4D, 0x53, 0x24, 
-    0x2E, 0x4A, 0x77, 0x73, 0x77, 0x50, 0x53, 0x56, 0x4A, 0x2D, 0x74, 0x67, 
-    0x77, 0x4D, 0x56, 0x24, 0x4A, 0x2E, 0x4A, 0x56, 0x56, 0x2E, 0x2E, 0x4A, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x32, 0x77, 0x78, 0x4D, 0x4A, 0x2E, 0x2E, 
-    0x4A, 0x32, 0x74, 0x32, 0x32, 0x72, 0x34, 0x56, 0x56, 0x56, 0x2E, 0x4A, 
-    0x32, 0x52, 0x2E, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x50, 0x75, 0x78, 0x4A, 
-    0x2E, 0x2E, 0x2E, 0x56, 0x4A, 0x74, 0x75, 0x4E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x25, 0x4A, 0x67, 0x4E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x24, 0x78, 0x73, 
-    0x4E, 0x4E, 0x4A, 0x2E, 0x4E, 0x24, 0x2E, 0x68, 0x73, 0x50, 0x4D, 0x4A, 
-    0x32, 0x2E, 0x0E, 0x32, 0x67, 0x72, 0x50, 0x4D, 0x56, 0x56, 0x56, 0x2E, 
-    0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x53, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x53, 0x53, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x53, 0x53, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x56, 0x2E, 0x53, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x4A, 0x2E, 0x2E, 0x4A, 0x4A, 0x53, 0x4A, 0x2E, 0x4A, 0x2E, 0x2E, 0x4A, 
-    0x56, 0x2E, 0x4A, 0x56, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x2E, 0x56, 
-    0x56, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x56, 0x2E, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x4A, 0x2E, 0x4A, 0x53, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x4A, 0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x56, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x24, 0x24, 0x0F, 0x2E, 0x0E, 0x58, 0x5D, 0x1E, 
-    0x56, 0x56, 0x0F, 0x25, 0x1E, 0x38, 0x1B, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x25, 0x36, 0x37, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x25, 0x46, 0x5C, 0x1E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x24, 0x1B, 0x36, 0x01, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x0E, 0x44, 0x57, 0x1E, 0x2E, 0x2E, 0x2E, 0x24, 0x04, 0x37, 0x57, 0x1E, 
-    0x56, 0x2E, 0x2E, 0x2E, 0x04, 0x57, 0x3F, 0x1E, 0x22, 0x87, 0x18, 0x1E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x22, 0x0E, 0x0E, 0x62, 0x24, 0x2E, 0x13, 
-    0x2E, 0x31, 0x0E, 0x0E, 0x67, 0x56, 0x32, 0x74, 0x31, 0x8A, 0x0E, 0x0E, 
-    0x2E, 0x0F, 0x74, 0x67, 0x31, 0x8A, 0x0B, 0x0E, 0x69, 0x16, 0x2E, 0x68, 
-    0x2E, 0x31, 0x0C, 0x0E, 0x46, 0x21, 0x01, 0x2E, 0x2E, 0x31, 0x0C, 0x0E, 
-    0x42, 0x20, 0x01, 0x0C, 0x10, 0x31, 0x0C, 0x0E, 0x3D, 0x2E, 0x0B, 0x0C, 
-    0x21, 0x57, 0x58, 0x58, 0x58, 0x57, 0x0E, 0x16, 0x2D, 0x25, 0x0E, 0x25, 
-    0x1E, 0x25, 0x2D, 0x21, 0x2E, 0x56, 0x34, 0x2D, 0x0E, 0x0F, 0x2D, 0x61, 
-    0x4E, 0x4A, 0x2E, 0x0F, 0x0F, 0x2E, 0x25, 0x45, 0x73, 0x32, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x24, 0x18, 0x67, 0x53, 0x2E, 0x2E, 0x53, 0x53, 0x56, 0x0B, 
-    0x0E, 0x0C, 0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 
-    0x0C, 0x0B, 0x0C, 0x0E, 0x64, 0x18, 0x0F, 0x35, 0x2E, 0x4A, 0x2E, 0x2E, 
-    0x90, 0x18, 0x0F, 0x26, 0x10, 0x56, 0x2D, 0x2E, 0x7D, 0x18, 0x0E, 0x16, 
-    0x0F, 0x32, 0x77, 0x4A, 0x97, 0x18, 0x0E, 0x16, 0x0B, 0x33, 0x98, 0x4A, 
-    0x36, 0x0E, 0x16, 0x36, 0x0C, 0x24, 0x2E, 0x2E, 0x25, 0x0B, 0x21, 0x3E, 
-    0x0C, 0x01, 0x0B, 0x0F, 0x34, 0x1E, 0x45, 0x5C, 0x0B, 0x0B, 0x0E, 0x0E, 
-    0x0C, 0x01, 0x40, 0x5E, 0x0C, 0x25, 0x0E, 0x0E, 0x2E, 0x25, 0x19, 0x26, 
-    0x0E, 0x17, 0x5D, 0x5D, 0x56, 0x25, 0x21, 0x40, 0x0E, 0x35, 0x5D, 0x7E, 
-    0x2E, 0x1E, 0x36, 0x5D, 0x0E, 0x1B, 0x59, 0x7E, 0x2E, 0x2D, 0x36, 0x59, 
-    0x30, 0x37, 0x7E, 0x59, 0x2E, 0x25, 0x40, 0x82, 0x57, 0x36, 0x7E, 0x82, 
-    0x2E, 0x25, 0x66, 0x5E, 0x3F, 0x18, 0x59, 0x7F, 0x2E, 0x25, 0x66, 0x5F, 
-    0x60, 0x30, 0x59, 0x65, 0x2E, 0x25, 0x66, 0x6C, 0x21, 0x30, 0x64, 0x7D, 
-    0x5D, 0x5C, 0x0E, 0x0B, 0x17, 0x0E, 0x25, 0x0E, 0x5D, 0x5C, 0x0E, 0x1E, 
-    0x62, 0x0F, 0x0E, 0x1A, 0x5D, 0x5C, 0x0E, 0x25, 0x62, 0x0F, 0x0E, 0x1A, 
-    0x5D, 0x3F, 0x25, 0x25, 0x17, 0x0E, 0x0E, 0x0E, 0x82, 0x59, 0x25, 0x25, 
-    0x62, 0x0F, 0x0F, 0x19, 0x7F, 0x59, 0x0E, 0x0C, 0x10, 0x0E, 0x0F, 0x17, 
-    0x7F, 0x59, 0x0E, 0x25, 0x10, 0x0F, 0x0E, 0x0E, 0x7F, 0x6A, 0x0E, 0x0B, 
-    0x19, 0x10, 0x24, 0x56, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x0B, 
-    0x01, 0x0C, 0x0E, 0x0B, 0x0C, 0x21, 0x19, 0x35, 0x01, 0x0B, 0x0E, 0x0E, 
-    0x0B, 0x0B, 0x0B, 0x18, 0x01, 0x01, 0x0B, 0x0E, 0x0E, 0x0B, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0F, 0x0E, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x0B, 
-    0x0B, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x01, 
-    0x18, 0x0B, 0x0B, 0x01, 0x01, 0x0C, 0x0E, 0x0C, 0x0C, 0x0B, 0x01, 0x01, 
-    0x01, 0x0E, 0x1A, 0x0E, 0x35, 0x16, 0x22, 0x19, 0x0E, 0x1B, 0x3F, 0x3F, 
-    0x16, 0x21, 0x20, 0x17, 0x16, 0x42, 0x3E, 0x37, 0x0B, 0x0E, 0x1F, 0x0E, 
-    0x0E, 0x16, 0x16, 0x0F, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1F, 0x17, 0x0F, 
-    0x0B, 0x0B, 0x01, 0x0B, 0x01, 0x0C, 0x1F, 0x20, 0x01, 0x0B, 0x01, 0x0B, 
-    0x1E, 0x17, 0x26, 0x69, 0x0F, 0x13, 0x0C, 0x17, 0x19, 0x41, 0x43, 0x69, 
-    0x10, 0x19, 0x19, 0x20, 0x41, 0x43, 0x43, 0x69, 0x5C, 0x21, 0x1F, 0x1E, 
-    0x21, 0x3F, 0x0E, 0x24, 0x10, 0x25, 0x0F, 0x0B, 0x45, 0x5D, 0x0F, 0x24, 
-    0x62, 0x25, 0x0E, 0x1E, 0x45, 0x5D, 0x0F, 0x24, 0x3D, 0x13, 0x34, 0x01, 
-    0x45, 0x5D, 0x0E, 0x2E, 0x99, 0x51, 0x34, 0x1E, 0x21, 0x6F, 0x0F, 0x4A, 
-    0x99, 0x13, 0x34, 0x0B, 0x39, 0x57, 0x0F, 0x56, 0x99, 0x23, 0x13, 0x25, 
-    0x16, 0x26, 0x0F, 0x56, 0x3D, 0x13, 0x13, 0x0B, 0x0F, 0x23, 0x0F, 0x56, 
-    0x34, 0x2D, 0x57, 0x58, 0x0F, 0x56, 0x0E, 0x0B, 0x56, 0x0F, 0x62, 0x63, 
-    0x24, 0x56, 0x2E, 0x25, 0x56, 0x0F, 0x75, 0x79, 0x24, 0x2E, 0x2E, 0x34, 
-    0x2E, 0x56, 0x32, 0x62, 0x56, 0x2E, 0x2E, 0x56, 0x2E, 0x2E, 0x0E, 0x0C, 
-    0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x24, 0x0F, 0x56, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x56, 0x56, 0x56, 0x32, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x2E, 
-    0x4A, 0x2E, 0x2E, 0x2E, 0x21, 0x35, 0x19, 0x01, 0x0E, 0x35, 0x5D, 0x7F, 
-    0x21, 0x22, 0x17, 0x0B, 0x0E, 0x26, 0x7E, 0x9A, 0x0F, 0x16, 0x35, 0x0E, 
-    0x0E, 0x37, 0x7E, 0x9B, 0x0F, 0x19, 0x5C, 0x16, 0x0B, 0x3E, 0x7D, 0x65, 
-    0x0F, 0x0E, 0x5C, 0x16, 0x0B, 0x38, 0x82, 0x7E, 0x0F, 0x0E, 0x39, 0x0F, 
-    0x25, 0x17, 0x7E, 0x82, 0x56, 0x56, 0x0E, 0x0B, 0x0E, 0x17, 0x7E, 0x5E, 
-    0x2E, 0x2E, 0x24, 0x0B, 0x1F, 0x1B, 0x82, 0x9B, 0x5F, 0x86, 0x25, 0x6B, 
-    0x71, 0x25, 0x5A, 0x46, 0x9C, 0x9D, 0x16, 0x25, 0x25, 0x24, 0x04, 0x0E, 
-    0x86, 0x21, 0x0F, 0x4E, 0x4D, 0x4A, 0x4D, 0x4A, 0x46, 0x2D, 0x24, 0x50, 
-    0x72, 0x4A, 0x4D, 0x4D, 0x16, 0x4A, 0x24, 0x4A, 0x74, 0x32, 0x32, 0x32, 
-    0x10, 0x4A, 0x0F, 0x25, 0x32, 0x67, 0x73, 0x32, 0x19, 0x4A, 0x2E, 0x2E, 
-    0x2E, 0x24, 0x24, 0x0E, 0x71, 0x56, 0x2E, 0x2E, 0x2E, 0x0E, 0x0E, 0x0E, 
-    0x2D, 0x4A, 0x2E, 0x2E, 0x2E, 0x0E, 0x0F, 0x3D, 0x2E, 0x4A, 0x53, 0x53, 
-    0x4D, 0x24, 0x0F, 0x23, 0x4A, 0x53, 0x2E, 0x32, 0x73, 0x2E, 0x16, 0x22, 
-    0x50, 0x53, 0x0F, 0x53, 0x74, 0x2D, 0x21, 0x5C, 0x74, 0x2E, 0x0E, 0x0E, 
-    0x0E, 0x1E, 0x40, 0x82, 0x0E, 0x0F, 0x0E, 0x0E, 0x25, 0x1E, 0x40, 0x7F, 
-    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1E, 0x40, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 
-    0x24, 0x1E, 0x66, 0x82, 0x0B, 0x2E, 0x77, 0x74, 0x67, 0x68, 0x68, 0x73, 
-    0x1E, 0x78, 0x79, 0x78, 0x53, 0x53, 0x4A, 0x56, 0x0E, 0x53, 0x77, 0x24, 
-    0x0E, 0x0E, 0x24, 0x2E, 0x0E, 0x0B, 0x1E, 0x0F, 0x24, 0x24, 0x2E, 0x74, 
-    0x18, 0x0E, 0x24, 0x56, 0x2E, 0x56, 0x24, 0x24, 0x18, 0x24, 0x2E, 0x2E, 
-    0x4A, 0x2E, 0x24, 0x0E, 0x18, 0x24, 0x4A, 0x4D, 0x53, 0x2E, 0x0F, 0x24, 
-    0x0E, 0x56, 0x53, 0x32, 0x32, 0x56, 0x0F, 0x24, 0x4A, 0x56, 0x56, 0x24, 
-    0x0E, 0x0E, 0x0F, 0x24, 0x0E, 0x24, 0x0E, 0x0E, 0x24, 0x0F, 0x0F, 0x2E, 
-    0x56, 0x24, 0x24, 0x24, 0x56, 0x2E, 0x4A, 0x53, 0x53, 0x4A, 0x4A, 0x4D, 
-    0x4D, 0x4E, 0x4D, 0x53, 0x2E, 0x32, 0x32, 0x4A, 0x2E, 0x4E, 0x78, 0x32, 
-    0x56, 0x77, 0x67, 0x32, 0x4A, 0x74, 0x75, 0x73, 0x24, 0x2E, 0x4A, 0x32, 
-    0x68, 0x91, 0x91, 0x89, 0x24, 0x0E, 0x24, 0x56, 0x32, 0x32, 0x32, 0x32, 
-    0x56, 0x4A, 0x4D, 0x4A, 0x2E, 0x4A, 0x4E, 0x4D, 0x4A, 0x74, 0x67, 0x74, 
-    0x4A, 0x32, 0x68, 0x75, 0x4A, 0x4E, 0x77, 0x67, 0x50, 0x4D, 0x74, 0x32, 
-    0x32, 0x73, 0x68, 0x75, 0x32, 0x2E, 0x4A, 0x4A, 0x72, 0x79, 0x88, 0x4E, 
-    0x4A, 0x53, 0x50, 0x67, 0x75, 0x75, 0x50, 0x53, 0x4D, 0x50, 0x52, 0x67, 
-    0x79, 0x4A, 0x2E, 0x53, 0x73, 0x73, 0x75, 0x50, 0x50, 0x2E, 0x2E, 0x74, 
-    0x68, 0x73, 0x4E, 0x4E, 0x2E, 0x4A, 0x2E, 0x53, 0x2E, 0x2E, 0x2E, 0x4A, 
-    0x9E, 0x77, 0x56, 0x56, 0x32, 0x73, 0x77, 0x77, 0x78, 0x53, 0x56, 0x24, 
-    0x53, 0x73, 0x78, 0x50, 0x24, 0x24, 0x56, 0x56, 0x24, 0x2E, 0x2E, 0x4A, 
-    0x50, 0x32, 0x53, 0x53, 0x53, 0x4E, 0x74, 0x74, 0x32, 0x50, 0x77, 0x9F, 
-    0x76, 0x68, 0x73, 0x75, 0x4A, 0x74, 0x68, 0x76, 0x91, 0x8C, 0x75, 0x75, 
-    0x4E, 0x50, 0x50, 0x50, 0x32, 0x73, 0x75, 0x89, 0x78, 0x78, 0x4D, 0x4A, 
-    0x4A, 0x72, 0x91, 0x9F, 0x68, 0x73, 0x4A, 0x24, 0x2E, 0x9F, 0x94, 0x9E, 
-    0x50, 0x78, 0x53, 0x53, 0x50, 0x96, 0xA0, 0x76, 0x32, 0x77, 0x73, 0x73, 
-    0x75, 0x8C, 0xA1, 0xA2, 0x74, 0x74, 0x75, 0x75, 0x75, 0xA2, 0x93, 0x8D, 
-    0x76, 0x91, 0xA2, 0xA2, 0x94, 0xA2, 0x93, 0xA3, 0x76, 0x91, 0xA2, 0xA4, 
-    0x8D, 0xA5, 0xA1, 0xA1, 0x7B, 0x94, 0xA2, 0xA4, 0xA6, 0xA7, 0xA1, 0xA1, 
-    0x52, 0x50, 0x4E, 0x4E, 0x73, 0x75, 0x75, 0x73, 0x74, 0x74, 0x32, 0x50, 
-    0x52, 0x78, 0x73, 0x76, 0x52, 0x73, 0x9F, 0x89, 0x89, 0x73, 0x75, 0x75, 
-    0x89, 0x89, 0x8C, 0xA2, 0xA2, 0x8C, 0xA8, 0x91, 0x91, 0x79, 0x8C, 0x94, 
-    0x8C, 0x89, 0x89, 0x91, 0x9E, 0x9E, 0x8C, 0xA2, 0xA2, 0x91, 0x91, 0xA2, 
-    0xA5, 0xA6, 0xA9, 0xAA, 0xAA, 0xA9, 0xA9, 0xA9, 0xAB, 0xA9, 0xA9, 0xAA, 
-    0xAA, 0xA6, 0xA9, 0xAC, 0x72, 0x72, 0x74, 0x74, 0x74, 0x75, 0x79, 0x75, 
-    0x9E, 0xAD, 0x76, 0x68, 0x91, 0x91, 0x91, 0x91, 0x91, 0xA0, 0xA6, 0xA6, 
-    0x8D, 0x91, 0x68, 0x7B, 0x75, 0x75, 0x9E, 0xAD, 0x76, 0x88, 0x89, 0x76, 
-    0x96, 0xA2, 0xAE, 0xAE, 0xA6, 0xAF, 0xA9, 0xA6, 0xA2, 0xA5, 0xA9, 0xA9, 
-    0xA9, 0xAC, 0xAA, 0xAA, 0xA9, 0xA6, 0xA6, 0xA6, 0xAC, 0xB0, 0xAA, 0xB0, 
-    0xAC, 0xB1, 0xB2, 0xB1, 0xB3, 0xB0, 0xB2, 0xB4, 0x72, 0x74, 0x68, 0x76, 
-    0x91, 0x8D, 0x8C, 0x91, 0x91, 0x68, 0x91, 0x94, 0x94, 0xA2, 0x8C, 0x94, 
-    0x94, 0xA0, 0xA2, 0x8D, 0xB5, 0x8D, 0xA2, 0xA0, 0x7B, 0xA2, 0xAE, 0xA1, 
-    0xAB, 0xA1, 0x8C, 0x79, 0xB6, 0xA6, 0xB7, 0xAF, 0xA7, 0xA7, 0xB7, 0xB6, 
-    0xAC, 0xAC, 0xB1, 0xB1, 0xB8, 0x93, 0xAF, 0xB0, 0xAC, 0xAC, 0xB9, 0xB1, 
-    0xAB, 0xAB, 0xAF, 0xB0, 0xBA, 0xBA, 0xBB, 0xBA, 0xB3, 0xAF, 0xB2, 0xB9, 
-    0x9F, 0x91, 0x89, 0x91, 0x75, 0x91, 0x89, 0x91, 0xA2, 0x94, 0x94, 0xA2, 
-    0xA4, 0xA2, 0x94, 0xA2, 0xA3, 0xA3, 0xB8, 0xB8, 0xB8, 0xB5, 0x8D, 0x94, 
-    0xA0, 0xA9, 0xAC, 0xA9, 0xA8, 0x96, 0x7B, 0x7B, 0xAC, 0xAC, 0xAC, 0xAC, 
-    0xAC, 0xA6, 0xA6, 0xB8, 0xAC, 0xAC, 0xAA, 0xAA, 0xB3, 0xAA, 0xAC, 0xB0, 
-    0xB0, 0xB0, 0xB0, 0xAC, 0xB3, 0xB2, 0xB0, 0xB0, 0xBA, 0xB9, 0xB9, 0xB2, 
-    0xB1, 0xB9, 0xB2, 0xAA, 0x8D, 0xB5, 0x94, 0x76, 0x76, 0x76, 0x91, 0x91, 
-    0x93, 0x93, 0x8D, 0x91, 0x91, 0x91, 0x76, 0x76, 0x93, 0xA1, 0xBC, 0xA0, 
-    0xA0, 0x8C, 0x68, 0x89, 0x93, 0xAB, 0xBD, 0x89, 0x8C, 0x89, 0x91, 0xA2, 
-    0xB8, 0xAF, 0xAF, 0xA6, 0xA5, 0xA6, 0xA6, 0xAB, 0xB3, 0xBA, 0xB1, 0xAC, 
-    0xAC, 0xAC, 0xAA, 0xA7, 0xB1, 0xBE, 0xB9, 0xA6, 0xB6, 0xB6, 0xAC, 0xA7, 
-    0xA7, 0xBE, 0xB9, 0xAA, 0xB0, 0xAC, 0xAA, 0xB1, 0x72, 0x72, 0x75, 0x75, 
-    0x78, 0x50, 0x73, 0x73, 0x91, 0x91, 0x7B, 0x91, 0x52, 0x73, 0x74, 0x50, 
-    0xBC, 0xAE, 0xA5, 0x98, 0x76, 0x76, 0x9E, 0x9E, 0x89, 0x76, 0x76, 0x76, 
-    0x9F, 0x91, 0x8E, 0xA8, 0xBC, 0xAE, 0xA6, 0xA2, 0x76, 0x89, 0x8C, 0x89, 
-    0xAF, 0xA9, 0xA9, 0xA4, 0x94, 0xA2, 0x8C, 0x8C, 0xA7, 0xB8, 0xB8, 0xA9, 
-    0xAC, 0xA9, 0xA9, 0xA9, 0xB9, 0xB2, 0xB1, 0xAA, 0xAC, 0xAC, 0xAC, 0xAA, 
-    0x75, 0x72, 0x50, 0x2E, 0x56, 0x2E, 0x73, 0x73, 0xAD, 0x9F, 0x72, 0x53, 
-    0x2E, 0x4A, 0x74, 0x74, 0x79, 0x76, 0x75, 0x76, 0x74, 0x4E, 0x4D, 0x2E, 
-    0xA8, 0x8C, 0x89, 0x91, 0x52, 0x76, 0xAD, 0x9F, 0x89, 0x89, 0x91, 0x76, 
-    0x75, 0x91, 0x91, 0x76, 0xA2, 0x89, 0xAD, 0x91, 0x91, 0x89, 0x7B, 0x91, 
-    0xA7, 0xA9, 0xA9, 0xA9, 0xB7, 0xA9, 0xA9, 0xA5, 0xAC, 0xAA, 0xAA, 0xA9, 
-    0xAC, 0xAC, 0xAC, 0xA6, 0x78, 0x4E, 0x53, 0x4E, 0x78, 0x50, 0x50, 0x32, 
-    0x53, 0x53, 0x4E, 0x68, 0x68, 0x68, 0x68, 0x4A, 0x4A, 0x53, 0x53, 0x4A, 
-    0x53, 0x32, 0x53, 0x4A, 0x53, 0x74, 0x32, 0x2E, 0x53, 0x32, 0x53, 0x4E, 
-    0x74, 0x74, 0x52, 0x74, 0x52, 0x4D, 0x56, 0x4A, 0x89, 0x8C, 0xA8, 0x91, 
-    0x73, 0x78, 0x32, 0x53, 0x94, 0xA2, 0xA2, 0x89, 0x73, 0x73, 0x76, 0x72, 
-    0xA2, 0xA2, 0xA2, 0xA8, 0x94, 0x75, 0x76, 0x67, 0x53, 0x4D, 0x4A, 0x2E, 
-    0x53, 0x4D, 0x4D, 0x4E, 0x4D, 0x78, 0x50, 0x74, 0x67, 0x73, 0x75, 0x73, 
-    0x32, 0x67, 0x73, 0x76, 0x68, 0x77, 0x4D, 0x4A, 0x53, 0x4E, 0x4E, 0x4D, 
-    0x4D, 0x4A, 0x2D, 0x24, 0x53, 0x4E, 0x53, 0x2E, 0x53, 0x50, 0x50, 0x4D, 
-    0x74, 0x75, 0x52, 0x32, 0x4E, 0x73, 0x73, 0x4D, 0x73, 0x68, 0x73, 0x74, 
-    0x56, 0x56, 0x56, 0x56, 0x74, 0x51, 0x53, 0x4A, 0x4A, 0x53, 0x53, 0x53, 
-    0x4A, 0x56, 0x56, 0x4A, 0x74, 0x52, 0x73, 0x32, 0x53, 0x56, 0x32, 0x4A, 
-    0x2D, 0x74, 0x88, 0x72, 0x56, 0x2D, 0x32, 0x53, 0x2E, 0x4D, 0x74, 0x68, 
-    0x56, 0x4A, 0x74, 0x74, 0x78, 0x4D, 0x4A, 0x67, 0x53, 0x78, 0x77, 0x52, 
-    0x73, 0x50, 0x4A, 0x24, 0x4A, 0x4E, 0x53, 0x4D, 0x74, 0x9F, 0x77, 0x77, 
-    0x56, 0x56, 0x24, 0x0E, 0x4D, 0x79, 0x79, 0x76, 0x2E, 0x53, 0x53, 0x53, 
-    0x4D, 0x4E, 0x32, 0x77, 0x4D, 0x4D, 0x2E, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 
-    0x4E, 0x32, 0x53, 0x4D, 0x4D, 0x2E, 0x56, 0x4A, 0x68, 0x67, 0x72, 0x50, 
-    0x74, 0x32, 0x4D, 0x53, 0x73, 0x68, 0x89, 0x76, 0x73, 0x73, 0x74, 0x74, 
-    0x24, 0x78, 0x88, 0x75, 0x8C, 0x8E, 0x73, 0x76, 0x32, 0x4D, 0x4A, 0x2D, 
-    0x73, 0x68, 0x73, 0x79, 0x52, 0x9F, 0x77, 0x4E, 0x56, 0x4A, 0x2D, 0x4A, 
-    0x79, 0x96, 0x96, 0x9E, 0x9F, 0x9F, 0x77, 0x4E, 0x56, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x4A, 0x2E, 0x2E, 0x4A, 0x4A, 0x4A, 0x2E, 0x2E, 0x50, 0x4A, 0x2E, 0x4A, 
-    0x4A, 0x2E, 0x2E, 0x2E, 0x52, 0x53, 0x32, 0x32, 0x32, 0x4A, 0x2E, 0x2E, 
-    0x91, 0x7B, 0x76, 0x77, 0x72, 0x32, 0x32, 0x32, 0x8E, 0x98, 0x7B, 0x91, 
-    0x8C, 0x68, 0x9F, 0x9F, 0x78, 0x4D, 0x24, 0x4D, 0x98, 0x89, 0x8C, 0x8E, 
-    0x56, 0x2E, 0x2E, 0x2E, 0x0E, 0x57, 0x57, 0x1E, 0x56, 0x2E, 0x56, 0x24, 
-    0x1E, 0x6A, 0x59, 0x24, 0x2E, 0x56, 0x56, 0x0E, 0x1E, 0x36, 0x3E, 0x56, 
-    0x56, 0x4A, 0x4A, 0x56, 0x24, 0x04, 0x24, 0x2E, 0x2E, 0x56, 0x56, 0x56, 
-    0x0E, 0x24, 0x2E, 0x4A, 0x2E, 0x2E, 0x56, 0x0F, 0x24, 0x24, 0x24, 0x24, 
-    0x74, 0x53, 0x4A, 0x2E, 0x56, 0x56, 0x24, 0x0E, 0x89, 0x52, 0x78, 0x4E, 
-    0x2E, 0x4A, 0x56, 0x24, 0x10, 0x23, 0x25, 0x0E, 0x5C, 0x45, 0x1E, 0x0E, 
-    0x2E, 0x2E, 0x25, 0x18, 0x82, 0x40, 0x0B, 0x21, 0x4A, 0x4A, 0x24, 0x18, 
-    0x82, 0x40, 0x1E, 0x21, 0x2E, 0x2E, 0x24, 0x0E, 0x5D, 0x45, 0x0E, 0x38, 
-    0x4A, 0x4A, 0x24, 0x0C, 0x5D, 0x45, 0x0E, 0x36, 0x56, 0x2E, 0x24, 0x0C, 
-    0x3E, 0x21, 0x0E, 0x3E, 0x0E, 0x0E, 0x0E, 0x04, 0x20, 0x13, 0x0F, 0x57, 
-    0x0E, 0x0E, 0x0E, 0x0B, 0x54, 0x20, 0x16, 0x90, 0x0C, 0x0C, 0x0C, 0x0C, 
-    0x0C, 0x0C, 0x0E, 0x24, 0x0E, 0x0E, 0x0E, 0x0F, 0x56, 0x0F, 0x56, 0x56, 
-    0x1F, 0x0E, 0x0E, 0x56, 0x4A, 0x2E, 0x2E, 0x2E, 0x1F, 0x0E, 0x0E, 0x56, 
-    0x53, 0x56, 0x56, 0x56, 0x16, 0x0E, 0x0E, 0x0F, 0x56, 0x53, 0x56, 0x0F, 
-    0x21, 0x0E, 0x0F, 0x0E, 0x24, 0x62, 0x2E, 0x56, 0x38, 0x0F, 0x2D, 0x0F, 
-    0x24, 0x56, 0x2E, 0x56, 0x46, 0x25, 0x2E, 0x0F, 0x24, 0x24, 0x2E, 0x24, 
-    0x0C, 0x1E, 0x66, 0x5F, 0x18, 0x1E, 0x0E, 0x0F, 0x24, 0x1E, 0x66, 0x5F, 
-    0x18, 0x0B, 0x0E, 0x0E, 0x24, 0x1E, 0x40, 0x82, 0x18, 0x0B, 0x0F, 0x0E, 
-    0x56, 0x2E, 0x0E, 0x18, 0x0B, 0x0C, 0x0F, 0x16, 0x2E, 0x62, 0x0E, 0x2D, 
-    0x0C, 0x0C, 0x0E, 0x0F, 0x56, 0x0F, 0x0E, 0x0F, 0x0E, 0x0E, 0x0F, 0x10, 
-    0x16, 0x20, 0x0E, 0x0F, 0x0C, 0x0C, 0x0F, 0x0F, 0x21, 0x36, 0x0E, 0x0E, 
-    0x0C, 0x0E, 0x0E, 0x0E, 0x13, 0x25, 0x66, 0x86, 0x1F, 0x1F, 0x6D, 0xBF, 
-    0x25, 0x1E, 0x71, 0x82, 0x3B, 0x1F, 0x6E, 0x97, 0x45, 0x0C, 0x46, 0x6C, 
-    0x34, 0x34, 0x36, 0x97, 0x6C, 0x39, 0x46, 0x64, 0x0F, 0x34, 0x10, 0xC0, 
-    0x86, 0x21, 0x71, 0x64, 0x0E, 0x2D, 0x10, 0xC0, 0x0F, 0x0E, 0x21, 0x22, 
-    0x0F, 0x2D, 0x10, 0xC0, 0x23, 0x19, 0x24, 0x2D, 0x56, 0x2D, 0x10, 0xC0, 
-    0x10, 0x10, 0x4A, 0x56, 0x2E, 0x4A, 0x21, 0xC1, 0x65, 0x6A, 0x0E, 0x0F, 
-    0x2E, 0x2E, 0x56, 0x2E, 0x65, 0x6A, 0x34, 0x51, 0x2E, 0x56, 0x56, 0x56, 
-    0x65, 0x58, 0x34, 0x51, 0x2E, 0x56, 0x56, 0x56, 0x5F, 0x6A, 0x0E, 0x53, 
-    0x4A, 0x56, 0x56, 0x56, 0x5F, 0x7E, 0x17, 0x53, 0x2E, 0x4A, 0x56, 0x0F, 
-    0x7D, 0x7E, 0x17, 0x51, 0x2E, 0x4A, 0x56, 0x0E, 0x7D, 0x7E, 0x17, 0x51, 
-    0x4A, 0x4A, 0x56, 0x25, 0x7D, 0x58, 0x2D, 0x2E, 0x4A, 0x24, 0x25, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 
-    0x01, 0x0B, 0x0B, 0x0B, 0x01, 0x0C, 0x0C, 0x01, 0x0B, 0x0C, 0x0C, 0x0B, 
-    0x0B, 0x0B, 0x0B, 0x01, 0x0C, 0x0C, 0x0C, 0x01, 0x18, 0x0C, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x16, 0x17, 0x17, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x16, 0x19, 0x26, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x20, 0x69, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x0C, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0F, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0F, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x18, 0x16, 0x16, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x19, 0x20, 0x22, 
-    0x20, 0x41, 0x43, 0x3E, 0x3E, 0x3F, 0x42, 0x47, 0x42, 0x42, 0x42, 0x3F, 
-    0x5D, 0x3E, 0x26, 0x10, 0x69, 0x69, 0x20, 0x1A, 0x16, 0x0E, 0x01, 0x0B, 
-    0x1E, 0x13, 0x47, 0x20, 0x20, 0x20, 0x0E, 0x0C, 0x10, 0x17, 0x20, 0x20, 
-    0x47, 0x41, 0x41, 0x0F, 0x19, 0x41, 0x19, 0x20, 0x0E, 0x20, 0x54, 0x0F, 
-    0x16, 0x10, 0x0F, 0x20, 0x38, 0x37, 0x5C, 0x16, 0x20, 0x0E, 0x0E, 0x17, 
-    0x3E, 0x5C, 0x5D, 0x19, 0x34, 0x2E, 0x13, 0x0B, 0x0F, 0x62, 0x56, 0x56, 
-    0x2E, 0x2E, 0x13, 0x25, 0x0E, 0x62, 0x2E, 0x56, 0x0F, 0x13, 0x13, 0x0E, 
-    0x0E, 0x23, 0x10, 0x56, 0x0E, 0x34, 0x0F, 0x0B, 0x0F, 0x20, 0x0F, 0x2E, 
-    0x0B, 0x0F, 0x0E, 0x0B, 0x0F, 0x62, 0x2E, 0x2E, 0x01, 0x0E, 0x0E, 0x0C, 
-    0x0E, 0x23, 0x10, 0x0F, 0x0B, 0x0C, 0x0C, 0x0E, 0x0E, 0x0F, 0x0F, 0x0B, 
-    0x1E, 0x0E, 0x0E, 0x23, 0x10, 0x0C, 0x0E, 0x0C, 0x2E, 0x2E, 0x56, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x2E, 0x4E, 0x2E, 0x2E, 
-    0x4A, 0x56, 0x2E, 0x56, 0x77, 0x88, 0x4A, 0x56, 0x4A, 0x56, 0x24, 0x4A, 
-    0x4D, 0x53, 0x4A, 0x56, 0x53, 0x75, 0x50, 0x56, 0x56, 0x56, 0x4A, 0x4A, 
-    0x32, 0xA6, 0xA8, 0x24, 0x56, 0x56, 0x56, 0x4A, 0x02, 0xA4, 0xA8, 0x56, 
-    0x56, 0x4A, 0x56, 0x4A, 0x24, 0x53, 0x2E, 0x24, 0x53, 0x68, 0x4A, 0x56, 
-    0x2E, 0x2E, 0x2E, 0x25, 0x16, 0x60, 0x7F, 0x9B, 0x4A, 0x2E, 0x53, 0x4A, 
-    0x21, 0x6A, 0x7F, 0x9C, 0x4A, 0x4A, 0x74, 0x53, 0x39, 0x83, 0x7F, 0x9C, 
-    0x2E, 0x2E, 0x32, 0x2E, 0x21, 0x83, 0x7F, 0x9C, 0x4A, 0x56, 0x2E, 0x56, 
-    0x21, 0x83, 0x7F, 0x9D, 0x2E, 0x2E, 0x4A, 0x2D, 0x1B, 0x7F, 0x9A, 0x9D, 
-    0x4A, 0x4A, 0x56, 0x21, 0x8F, 0x9A, 0x97, 0xC1, 0x2E, 0x4A, 0x2E, 0x54, 
-    0x57, 0x65, 0xC2, 0xC2, 0x5F, 0x10, 0x4A, 0x2E, 0x2E, 0x0E, 0x0E, 0x0E, 
-    0x6D, 0x10, 0x2D, 0x2E, 0x2E, 0x0E, 0x0E, 0x0E, 0x6E, 0x10, 0x2D, 0x2E, 
-    0x2E, 0x0F, 0x56, 0x24, 0xBF, 0x10, 0x2E, 0x2E, 0x2E, 0x0F, 0x2E, 0x2E, 
-    0xC1, 0x16, 0x2E, 0x4A, 0x56, 0x24, 0x2E, 0x2E, 0x71, 0x0F, 0x4A, 0x2E, 
-    0x56, 0x56, 0x2E, 0x56, 0x16, 0x2D, 0x2E, 0x56, 0x24, 0x2E, 0x2E, 0x2E, 
-    0x16, 0x25, 0x2E, 0x34, 0x24, 0x56, 0x2E, 0x2E, 0x0F, 0x0F, 0x56, 0x10, 
-    0x0F, 0x0E, 0x0E, 0x16, 0x0F, 0x10, 0x56, 0x56, 0x56, 0x24, 0x0E, 0x24, 
-    0x56, 0x2E, 0x56, 0x56, 0x2E, 0x56, 0x56, 0x24, 0x56, 0x2E, 0x2E, 0x2E, 
-    0x56, 0x56, 0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x4A, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x53, 0x32, 0x4A, 0x4A, 0x2E, 0x2E, 0x4A, 0x2E, 0x4E, 
-    0x78, 0x4D, 0x4A, 0x2E, 0x2E, 0x4A, 0x2E, 0x4E, 0x72, 0x53, 0x2E, 0x2E, 
-    0x0E, 0x56, 0x2E, 0x2E, 0x56, 0x24, 0x0F, 0x0F, 0x10, 0x2E, 0x24, 0x0F, 
-    0x56, 0x56, 0x56, 0x2E, 0x56, 0x10, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x2E, 
-    0x56, 0x2E, 0x56, 0x2E, 0x56, 0x56, 0x56, 0x2E, 0x56, 0x2E, 0x2E, 0x56, 
-    0x56, 0x56, 0x56, 0x2E, 0x2E, 0x4A, 0x4A, 0x4D, 0x56, 0x56, 0x2E, 0x2E, 
-    0x2E, 0x4A, 0x4A, 0x4D, 0x56, 0x0F, 0x24, 0x24, 0x24, 0x0F, 0x56, 0x24, 
-    0x56, 0x56, 0x24, 0x56, 0x56, 0x56, 0x4A, 0x53, 0x2E, 0x56, 0x24, 0x56, 
-    0x2E, 0x53, 0x78, 0x75, 0x2E, 0x10, 0x0F, 0x56, 0x4A, 0x32, 0x9F, 0x91, 
-    0x2E, 0x56, 0x56, 0x2E, 0x53, 0x77, 0x89, 0x74, 0x2E, 0x4A, 0x4D, 0x74, 
-    0x9E, 0x91, 0x68, 0x4E, 0x4A, 0x4A, 0x4E, 0x9F, 0x89, 0x68, 0x56, 0x2E, 
-    0x4E, 0x4E, 0x77, 0x79, 0x73, 0x32, 0x50, 0x4D, 0x32, 0x74, 0x53, 0x4D, 
-    0x4E, 0x53, 0x4D, 0x68, 0x78, 0x4A, 0x56, 0x56, 0x4A, 0x4A, 0x32, 0x74, 
-    0x76, 0x4D, 0x56, 0x4A, 0x78, 0x77, 0x72, 0x50, 0x79, 0x4D, 0x2E, 0x4D, 
-    0x78, 0x68, 0x68, 0x78, 0x4A, 0x4D, 0x4A, 0x4D, 0x50, 0x78, 0x74, 0x72, 
-    0x4D, 0x50, 0x32, 0x32, 0x53, 0x53, 0x77, 0x68, 0x50, 0x78, 0x78, 0x77, 
-    0x78, 0x78, 0x72, 0x76, 0x74, 0x75, 0x77, 0x73, 0x76, 0x76, 0x76, 0x7B, 
-    0x76, 0x68, 0x75, 0x72, 0x75, 0x91, 0x89, 0xA3, 0x32, 0x72, 0x91, 0x96, 
-    0x8C, 0xA3, 0xAE, 0xA3, 0x74, 0x76, 0x89, 0xA2, 0xA5, 0xA3, 0x8D, 0xA6, 
-    0x52, 0x91, 0x8D, 0x93, 0xA1, 0xA1, 0x93, 0xA7, 0x72, 0x91, 0x8D, 0xA1, 
-    0xAB, 0x93, 0x93, 0xAF, 0x96, 0x89, 0xA3, 0xA1, 0xA1, 0x93, 0x93, 0xAB, 
-    0xA2, 0x94, 0xA5, 0x93, 0x93, 0xB5, 0x8D, 0xA4, 0xA0, 0x91, 0x91, 0xA1, 
-    0x93, 0x94, 0xBC, 0xA0, 0xA9, 0xAA, 0xAA, 0xAC, 0xAC, 0xB1, 0xA1, 0x93, 
-    0xAC, 0xAC, 0xB3, 0xB0, 0xB2, 0xB4, 0xBA, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 
-    0xB4, 0xBE, 0xB4, 0xBA, 0xAC, 0xAC, 0xB9, 0xB4, 0xBE, 0xBE, 0xB4, 0xBA, 
-    0xB3, 0xB3, 0xB4, 0xBB, 0xBE, 0xBE, 0xBB, 0xBA, 0xAF, 0xB1, 0xBA, 0xBA, 
-    0xB4, 0xBE, 0xBE, 0xB4, 0xA7, 0xA6, 0xB1, 0xAF, 0xB7, 0xB1, 0xBA, 0xB1, 
-    0xA3, 0x94, 0xAF, 0xA6, 0xA6, 0xA7, 0xA7, 0xB8, 0xB6, 0x8B, 0xBD, 0xB3, 
-    0xAC, 0xAC, 0xAA, 0xAC, 0xBD, 0xAA, 0xB1, 0xBA, 0xB9, 0xB9, 0xB3, 0xB2, 
-    0xB4, 0xBA, 0xB9, 0xBE, 0xBE, 0xBB, 0xB1, 0xB4, 0xBA, 0xBA, 0xBA, 0xBE, 
-    0xC3, 0xB4, 0xAA, 0xB4, 0xA9, 0xB1, 0xB4, 0xBE, 0xBE, 0xBB, 0xAF, 0xB9, 
-    0xAA, 0xB2, 0xBE, 0xBE, 0xBE, 0xBE, 0xAF, 0xB9, 0xAA, 0xB1, 0xB4, 0xB4, 
-    0xBB, 0xBE, 0xB9, 0xB9, 0xA9, 0xA9, 0xA9, 0xA9, 0xBA, 0xC3, 0xC3, 0xB9, 
-    0xAC, 0xB3, 0xB2, 0xB2, 0xB3, 0xB3, 0xB2, 0xB4, 0xB9, 0xB9, 0xB9, 0xB9, 
-    0xBA, 0xBA, 0xB2, 0xB0, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xB2, 0xB0, 
-    0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xB4, 0xC4, 0xB9, 0xBB, 0xBE, 0xBE, 
-    0xBB, 0xB4, 0xBE, 0xC3, 0xB4, 0xBB, 0xBE, 0xC3, 0xBA, 0xB1, 0xBB, 0xBE, 
-    0xBB, 0xBE, 0xBE, 0xBA, 0xB1, 0xBA, 0xBA, 0xBA, 0xAA, 0xBB, 0xBB, 0xAA, 
-    0xB3, 0xB3, 0xB3, 0xB2, 0xC4, 0xB4, 0xBE, 0xBB, 0xB3, 0xB3, 0xB9, 0xBE, 
-    0xB0, 0xB2, 0xBE, 0xB4, 0xB3, 0xAC, 0xB2, 0xC3, 0xB0, 0xB9, 0xC3, 0xB4, 
-    0xB3, 0xB3, 0xB9, 0xBE, 0xB9, 0xB4, 0xBE, 0xBB, 0xB1, 0xB9, 0xBB, 0xBE, 
-    0xBB, 0xBB, 0xBE, 0xBB, 0xBB, 0xBB, 0xBE, 0xBE, 0xBA, 0xB2, 0xC4, 0xBB, 
-    0xBE, 0xBE, 0xBA, 0xBB, 0xB2, 0xAC, 0xB9, 0xBB, 0xC3, 0xBB, 0xB3, 0xB1, 
-    0xB3, 0xAA, 0xB4, 0xBB, 0xB2, 0xB3, 0xB0, 0xB0, 0xBE, 0xBE, 0xBB, 0xB9, 
-    0xB9, 0xBE, 0xBB, 0xAF, 0xBE, 0xBE, 0xBE, 0xB4, 0xB4, 0xBB, 0xBB, 0xB1, 
-    0xBE, 0xBE, 0xBE, 0xC3, 0xBE, 0xBE, 0xBE, 0xB4, 0xBE, 0xBB, 0xB4, 0xB4, 
-    0xBE, 0xBE, 0xBE, 0xBB, 0xBE, 0xB9, 0xAC, 0xAA, 0xBB, 0xBE, 0xBE, 0xC3, 
-    0xC3, 0xBA, 0xAC, 0xB3, 0xBE, 0xBE, 0xB4, 0xB4, 0xBB, 0xB2, 0xAA, 0xB3, 
-    0xC4, 0xB9, 0xB0, 0xB0, 0xC5, 0xB3, 0xAF, 0xB1, 0xC6, 0xC5, 0xB0, 0xB0, 
-    0xA7, 0xBE, 0xBA, 0xB0, 0xB0, 0xB0, 0xB0, 0xB9, 0xA7, 0xBE, 0xB9, 0xB0, 
-    0xB0, 0xB0, 0xB9, 0xBB, 0xA9, 0xBE, 0xB9, 0xB0, 0xB0, 0xB0, 0xB4, 0xBE, 
-    0xB1, 0xBE, 0xB4, 0xB9, 0xC4, 0xB4, 0xBE, 0xBE, 0xBE, 0xBE, 0xBB, 0xBB, 
-    0xC3, 0xB4, 0xBB, 0xBE, 0xBE, 0xBE, 0xB4, 0xB2, 0xB4, 0xB1, 0xAB, 0xBE, 
-    0xB4, 0xBE, 0xB4, 0xB0, 0xB2, 0xB9, 0xA1, 0xBA, 0xB3, 0xB4, 0xB4, 0xB0, 
-    0xB0, 0xB1, 0x93, 0xA9, 0xBB, 0xBA, 0xB4, 0xB3, 0xAC, 0xAC, 0xAC, 0xAF, 
-    0xBB, 0xB2, 0xAA, 0xB3, 0xBA, 0xBB, 0xB4, 0xB4, 0xBE, 0xBE, 0xB2, 0xB3, 
-    0xBA, 0xBE, 0xBB, 0xB4, 0xBE, 0xBE, 0xB9, 0xB3, 0xB2, 0xB2, 0xB2, 0xB4, 
-    0xBE, 0xBE, 0xB4, 0xB3, 0xB3, 0xC4, 0xC7, 0xBA, 0xC3, 0xBE, 0xBE, 0xB4, 
-    0xB3, 0xB2, 0xB2, 0xBA, 0xB4, 0xBE, 0xBE, 0xBB, 0xB1, 0xB2, 0xB2, 0xBB, 
-    0xB1, 0xBB, 0xBE, 0xBB, 0xBA, 0xBB, 0xBE, 0xBE, 0xAA, 0xAC, 0xAC, 0xAC, 
-    0xAC, 0xAC, 0xAC, 0xAC, 0xBB, 0xB4, 0xB2, 0xB0, 0xAC, 0xB3, 0xB3, 0xB3, 
-    0xBE, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9, 0xB1, 0xBE, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBE, 0xB4, 0xB9, 0xBE, 0xBE, 0xBA, 0xB1, 0xBA, 0xB4, 0xBE, 0xBE, 
-    0xBE, 0xBE, 0xBB, 0xBA, 0xB4, 0xBA, 0xBB, 0xBE, 0xBE, 0xB4, 0xB4, 0xBA, 
-    0xBA, 0xAF, 0xB1, 0xB4, 0xBB, 0xAF, 0xAC, 0xAC, 0xB3, 0xAC, 0xB1, 0xBA, 
-    0xA9, 0xAC, 0xAC, 0xA9, 0xA6, 0x8C, 0x89, 0x89, 0xB9, 0xB2, 0xAC, 0xAC, 
-    0xAC, 0xA6, 0xA2, 0xB5, 0xBB, 0xBA, 0xAA, 0xA6, 0xAC, 0xA6, 0xB5, 0x93, 
-    0xBE, 0xBB, 0xB2, 0xB3, 0xB2, 0xA7, 0x93, 0x93, 0xBE, 0xBE, 0xBB, 0xB4, 
-    0xB9, 0xB1, 0x93, 0x93, 0xBE, 0xB4, 0xBB, 0xBA, 0xB1, 0xAF, 0x93, 0x93, 
-    0xB1, 0xA9, 0xBA, 0xAF, 0xB7, 0xA5, 0xB8, 0x93, 0xAF, 0xA9, 0xB1, 0xA9, 
-    0xA4, 0x94, 0x93, 0x93, 0x91, 0x73, 0x74, 0x74, 0x73, 0x68, 0x68, 0x32, 
-    0xB5, 0x76, 0x68, 0x9E, 0x74, 0x78, 0x4E, 0x4A, 0xB5, 0x8D, 0xA2, 0x91, 
-    0x75, 0x72, 0x32, 0x32, 0x93, 0x93, 0xA2, 0x89, 0x91, 0x89, 0x9F, 0x74, 
-    0x93, 0x8D, 0x91, 0xAD, 0x75, 0x73, 0x78, 0x4E, 0x93, 0xA1, 0x8D, 0x96, 
-    0x72, 0x4E, 0x72, 0x50, 0xB5, 0x94, 0x94, 0x7B, 0x96, 0x76, 0x68, 0x75, 
-    0x8D, 0x9E, 0xAD, 0x7B, 0x7B, 0x76, 0x75, 0x73, 0x4D, 0x78, 0x73, 0x73, 
-    0x74, 0x56, 0x24, 0x4A, 0x4D, 0x78, 0x78, 0x78, 0x50, 0x2E, 0x24, 0x24, 
-    0x53, 0x4A, 0x4A, 0x2E, 0x50, 0x50, 0x32, 0x53, 0x74, 0x32, 0x4A, 0x56, 
-    0x77, 0x73, 0x52, 0x50, 0x75, 0x68, 0x76, 0x76, 0x76, 0x9E, 0x9F, 0x50, 
-    0x76, 0x89, 0x91, 0x68, 0x91, 0x8E, 0x8E, 0x52, 0x4E, 0x50, 0x4E, 0x4A, 
-    0x2E, 0x73, 0x73, 0x50, 0x52, 0x75, 0x75, 0x9F, 0x77, 0x50, 0x4D, 0x53, 
-    0x68, 0x8C, 0x8C, 0x8C, 0x89, 0x7B, 0x7B, 0x76, 0x56, 0x4D, 0x53, 0x53, 
-    0x32, 0x89, 0x7B, 0x7B, 0x2E, 0x56, 0x56, 0x24, 0x24, 0x32, 0x56, 0x77, 
-    0x78, 0x32, 0x2E, 0x53, 0x4A, 0x24, 0x24, 0x24, 0x50, 0x32, 0x53, 0x53, 
-    0x53, 0x53, 0x4E, 0x4A, 0x73, 0x73, 0x75, 0x9E, 0x52, 0x32, 0x32, 0x32, 
-    0x50, 0x73, 0x75, 0x68, 0x68, 0x32, 0x32, 0x32, 0x4E, 0x4E, 0x4A, 0x2E, 
-    0x73, 0x68, 0x68, 0x32, 0x7B, 0x7B, 0x78, 0x78, 0x2E, 0x24, 0x68, 0x68, 
-    0xA4, 0xA4, 0x96, 0x3C, 0x77, 0x50, 0x78, 0x4E, 0xA8, 0xA2, 0x8C, 0x96, 
-    0xAD, 0x9E, 0x91, 0x91, 0x32, 0x8C, 0x8C, 0x89, 0x79, 0x91, 0x94, 0x94, 
-    0x56, 0x24, 0x56, 0x56, 0x04, 0x4A, 0x79, 0x91, 0x53, 0x4A, 0x2E, 0x56, 
-    0x56, 0x56, 0x04, 0x24, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x4A, 0x56, 
-    0x53, 0x4A, 0x4A, 0x4A, 0x4A, 0x53, 0x32, 0x53, 0x73, 0x76, 0x7B, 0x78, 
-    0x53, 0x53, 0x4D, 0x2E, 0x4A, 0x73, 0x8C, 0x91, 0x77, 0x53, 0x32, 0x4A, 
-    0x73, 0x4A, 0x4A, 0x53, 0x67, 0x77, 0x52, 0x4E, 0x91, 0x77, 0x4E, 0x4A, 
-    0x50, 0x79, 0x88, 0x74, 0x7B, 0x76, 0x73, 0x74, 0x4D, 0x77, 0x74, 0x4A, 
-    0x53, 0x79, 0x68, 0x68, 0x67, 0x4D, 0x24, 0x0E, 0x56, 0x32, 0x32, 0x53, 
-    0x53, 0x74, 0x74, 0x4D, 0x2E, 0x24, 0x56, 0x2E, 0x56, 0x73, 0x73, 0x50, 
-    0x24, 0x24, 0x25, 0x0B, 0x64, 0x46, 0x0E, 0x22, 0x56, 0x2E, 0x25, 0x0C, 
-    0x7F, 0x46, 0x04, 0x2D, 0x2E, 0x2E, 0x2D, 0x0B, 0x5E, 0x66, 0x1E, 0x4A, 
-    0x2E, 0x2E, 0x24, 0x0B, 0x82, 0x40, 0x1E, 0x2E, 0x56, 0x2D, 0x25, 0x0B, 
-    0x3E, 0x21, 0x25, 0x2E, 0x24, 0x24, 0x0E, 0x0B, 0x69, 0x10, 0x24, 0x2E, 
-    0x4A, 0x2E, 0x24, 0x0B, 0x20, 0x2E, 0x24, 0x51, 0x50, 0x4E, 0x56, 0x0C, 
-    0x17, 0x34, 0x0E, 0x24, 0x10, 0x56, 0x2E, 0x56, 0x24, 0x24, 0x2E, 0x2D, 
-    0x56, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x2E, 0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x53, 0x53, 0x2E, 0x2D, 0x4A, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x2E, 0x2D, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x2E, 0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x56, 0x56, 0x24, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x0E, 0x1E, 
-    0x2E, 0x53, 0x2E, 0x2E, 0x2E, 0x56, 0x0E, 0x1E, 0x22, 0x5C, 0x0C, 0x0B, 
-    0x0F, 0x0E, 0x0E, 0x0F, 0x6B, 0x6C, 0x0C, 0x0E, 0x0F, 0x0E, 0x0F, 0x10, 
-    0x66, 0x7F, 0x1F, 0x56, 0x10, 0x56, 0x24, 0x0F, 0x66, 0x65, 0x21, 0x56, 
-    0x56, 0x2E, 0x56, 0x24, 0x66, 0x9B, 0x22, 0x2E, 0x4A, 0x2E, 0x2E, 0x56, 
-    0x66, 0x7D, 0x1B, 0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x66, 0x65, 0x0E, 0x4A, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x66, 0x5E, 0x0E, 0x4A, 0x4A, 0x2E, 0x4A, 0x4A, 
-    0x24, 0x24, 0x2E, 0x56, 0x56, 0x4A, 0x31, 0xC1, 0x0F, 0x56, 0x56, 0x56, 
-    0x2E, 0x2D, 0x31, 0xC8, 0x56, 0x24, 0x56, 0x56, 0x2E, 0x2D, 0x31, 0xC8, 
-    0x24, 0x56, 0x2E, 0x56, 0x56, 0x2D, 0x31, 0xC8, 0x56, 0x56, 0x56, 0x2E, 
-    0x2E, 0x2D, 0x21, 0xC9, 0x56, 0x24, 0x56, 0x2E, 0x56, 0x4A, 0x2E, 0x21, 
-    0x56, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x2D, 0x2E, 0x56, 0x56, 0x56, 
-    0x0F, 0x2E, 0x2E, 0x2E, 0x7D, 0x58, 0x2D, 0x4A, 0x4A, 0x0F, 0x0B, 0x0B, 
-    0xC1, 0x5A, 0x34, 0x56, 0x24, 0x0E, 0x0B, 0x0B, 0xC8, 0x87, 0x25, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0B, 0xC8, 0x71, 0x25, 0x2E, 0x2E, 0x56, 0x0E, 0x0B, 
-    0x70, 0x5A, 0x2D, 0x4A, 0x2E, 0x24, 0x0B, 0x0C, 0x21, 0x10, 0x4A, 0x24, 
-    0x56, 0x0F, 0x0B, 0x0C, 0x2D, 0x4A, 0x56, 0x56, 0x56, 0x0F, 0x0B, 0x0C, 
-    0x56, 0x2E, 0x2E, 0x2E, 0x56, 0x0E, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x0B, 
-    0x18, 0x0B, 0x16, 0x17, 0x01, 0x01, 0x0B, 0x0C, 0x19, 0x16, 0x0C, 0x0E, 
-    0x01, 0x0C, 0x16, 0x10, 0x3D, 0x47, 0x0E, 0x0F, 0x0C, 0x1F, 0x19, 0x19, 
-    0x23, 0x3D, 0x10, 0x0E, 0x18, 0x16, 0x19, 0x0E, 0x0E, 0x10, 0x0F, 0x20, 
-    0x0F, 0x19, 0x10, 0x10, 0x20, 0x0F, 0x0B, 0x3E, 0x0B, 0x0C, 0x01, 0x0E, 
-    0x10, 0x0E, 0x21, 0x41, 0x0C, 0x16, 0x0C, 0x0F, 0x0C, 0x0B, 0x0F, 0x2D, 
-    0x0E, 0x0E, 0x0F, 0x41, 0x10, 0x24, 0x19, 0x3B, 0x0F, 0x17, 0x41, 0x43, 
-    0x3F, 0x5D, 0x5C, 0x0F, 0x41, 0x41, 0x43, 0x3F, 0x5D, 0x5C, 0x20, 0x0B, 
-    0x47, 0x41, 0x43, 0x5D, 0x6C, 0x21, 0x01, 0x0B, 0x41, 0x43, 0x3F, 0x5D, 
-    0x46, 0x1F, 0x0C, 0x0C, 0x6A, 0x83, 0x7E, 0x5D, 0x0E, 0x24, 0x2E, 0x0F, 
-    0x3E, 0x3F, 0x5D, 0x3E, 0x0E, 0x56, 0x2E, 0x2E, 0x35, 0x37, 0x3E, 0x3E, 
-    0x0F, 0x2E, 0x4A, 0x2E, 0x37, 0x7E, 0x3F, 0x26, 0x0F, 0x2E, 0x4A, 0x2E, 
-    0x0C, 0x16, 0x10, 0x16, 0x0E, 0x0E, 0x0E, 0x0C, 0x0E, 0x0F, 0x0F, 0x0E, 
-    0x0C, 0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x0C, 0x0C, 0x0C, 0x0E, 0x10, 0x1A, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x17, 0x0F, 0x10, 0x16, 0x1A, 
-    0x0E, 0x1A, 0x38, 0x35, 0x0F, 0x0E, 0x0E, 0x10, 0x16, 0x26, 0x69, 0x21, 
-    0x24, 0x0F, 0x0E, 0x0E, 0x0E, 0x16, 0x16, 0x0C, 0x4D, 0x2E, 0x0E, 0x0C, 
-    0x0E, 0x25, 0x0B, 0x0E, 0x0E, 0x0B, 0x0C, 0x56, 0x4A, 0x74, 0x4A, 0x2E, 
-    0x0C, 0x0E, 0x0E, 0x24, 0x91, 0x96, 0x2E, 0x56, 0x1A, 0x0F, 0x0E, 0x24, 
-    0xA4, 0xA4, 0x4A, 0x56, 0x20, 0x17, 0x0B, 0x24, 0xA8, 0x8C, 0x4D, 0x2E, 
-    0x19, 0x0E, 0x25, 0x25, 0x0E, 0x24, 0x2E, 0x4A, 0x0C, 0x0E, 0x0E, 0x0E, 
-    0x0B, 0x0E, 0x2E, 0x4A, 0x0B, 0x0E, 0x0F, 0x0F, 0x0F, 0x34, 0x2E, 0x4D, 
-    0x0E, 0x0F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x4A, 0x2E, 0x2D, 
-    0x44, 0x9B, 0xCA, 0xC2, 0x4A, 0x4A, 0x2E, 0x2D, 0x40, 0x9B, 0xCA, 0xCA, 
-    0x2E, 0x4A, 0x2E, 0x24, 0x40, 0x9B, 0xC2, 0xCB, 0x2E, 0x56, 0x2E, 0x24, 
-    0x45, 0x7F, 0x6B, 0x23, 0x53, 0x2E, 0x56, 0x24, 0x16, 0x60, 0x19, 0x2D, 
-    0x53, 0x4A, 0x56, 0x24, 0x1A, 0x43, 0x10, 0x56, 0x4A, 0x4A, 0x4A, 0x24, 
-    0x10, 0x41, 0x2E, 0x24, 0x4A, 0x4A, 0x53, 0x56, 0x56, 0x62, 0x2E, 0x0F, 
-    0x16, 0x2D, 0x2E, 0x24, 0x24, 0x56, 0x56, 0x2E, 0x16, 0x2D, 0x2E, 0x0F, 
-    0x56, 0x56, 0x2E, 0x2E, 0x10, 0x2E, 0x2E, 0x0F, 0x56, 0x56, 0x2E, 0x2E, 
-    0x10, 0x2E, 0x56, 0x2E, 0x2E, 0x56, 0x2E, 0x10, 0x10, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x53, 0x4A, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x24, 0x56, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x4A, 0x4A, 0x2E, 0x56, 0x4A, 0x78, 0x75, 0x50, 0x53, 0x32, 
-    0x2E, 0x2E, 0x4D, 0x78, 0x89, 0x9F, 0x78, 0x32, 0x2E, 0x56, 0x4A, 0x4D, 
-    0x73, 0x68, 0x75, 0x75, 0x2E, 0x24, 0x24, 0x24, 0x0E, 0x74, 0x89, 0x8E, 
-    0x2E, 0x4A, 0x2E, 0x2E, 0x2E, 0x4A, 0x4E, 0x32, 0x4A, 0x50, 0x78, 0x50, 
-    0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x72, 0x72, 0x68, 0x91, 0x91, 0x79, 0x89, 
-    0x53, 0x53, 0x2D, 0x4A, 0x4A, 0x4D, 0x4D, 0x4D, 0x4A, 0x56, 0x56, 0x4A, 
-    0x56, 0x4A, 0x4D, 0x4D, 0x53, 0x2E, 0x56, 0x2E, 0x4A, 0x78, 0x68, 0x68, 
-    0x73, 0x78, 0x50, 0x75, 0x91, 0x96, 0x7B, 0x8C, 0x8C, 0x8C, 0xA2, 0xA4, 
-    0x8E, 0x8E, 0x68, 0x4D, 0x4E, 0x74, 0x68, 0x75, 0x4E, 0x4A, 0x4D, 0x4E, 
-    0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x52, 0x76, 0x89, 0x89, 0x89, 0x89, 
-    0x8C, 0x89, 0x89, 0x91, 0x4D, 0x4D, 0x4E, 0x4E, 0x50, 0x50, 0x72, 0x50, 
-    0x77, 0x68, 0x68, 0x79, 0x4E, 0x4E, 0x75, 0x52, 0x89, 0x8C, 0x79, 0x4D, 
-    0x2E, 0x78, 0x91, 0x9E, 0x8E, 0x77, 0x4A, 0x4A, 0x53, 0x53, 0x72, 0x74, 
-    0x4D, 0x2E, 0x2E, 0x4E, 0x78, 0x2E, 0x50, 0x72, 0x4E, 0x50, 0x78, 0x73, 
-    0x52, 0x4A, 0x76, 0xAD, 0x76, 0x76, 0x9F, 0x68, 0x77, 0x4D, 0x76, 0x76, 
-    0x89, 0x89, 0x75, 0x4E, 0x4D, 0x4D, 0x76, 0x76, 0x77, 0x73, 0x78, 0x4A, 
-    0x2E, 0x4A, 0x76, 0x76, 0x78, 0x77, 0x78, 0x74, 0x73, 0x73, 0x76, 0x96, 
-    0x4D, 0x53, 0x78, 0x68, 0x76, 0x52, 0x77, 0x73, 0x32, 0x32, 0x78, 0x9F, 
-    0x73, 0x77, 0x67, 0x76, 0x74, 0x75, 0x52, 0x32, 0x32, 0x75, 0x89, 0x68, 
-    0x75, 0x89, 0x91, 0x78, 0x74, 0x77, 0x9E, 0x9F, 0x32, 0x72, 0x52, 0x74, 
-    0x32, 0x50, 0x32, 0x74, 0x4A, 0x4A, 0x4E, 0x77, 0x32, 0x77, 0x9F, 0x76, 
-    0x32, 0x53, 0x4E, 0x32, 0x50, 0x77, 0x77, 0x73, 0x91, 0x76, 0x91, 0xA1, 
-    0x93, 0x96, 0x8C, 0xA8, 0x73, 0x73, 0x89, 0xA1, 0xA3, 0x7B, 0xA2, 0x7B, 
-    0x76, 0x76, 0x7B, 0xA1, 0xA3, 0x96, 0x7B, 0x7B, 0x76, 0x76, 0x7B, 0xA1, 
-    0xA3, 0x94, 0x8C, 0xAD, 0x73, 0x77, 0x89, 0xA1, 0xA3, 0x94, 0xA8, 0x96, 
-    0x75, 0x73, 0x7B, 0xA1, 0xA3, 0x96, 0x94, 0xA8, 0x89, 0x68, 0x7B, 0x93, 
-    0xA3, 0xA3, 0x8C, 0xA8, 0x9F, 0xCC, 0x91, 0xAB, 0xA3, 0x93, 0x91, 0x89, 
-    0xA5, 0x96, 0x96, 0x96, 0x94, 0xAB, 0xA7, 0xA7, 0xA5, 0x7B, 0x7B, 0x91, 
-    0x94, 0xA0, 0xAE, 0xAB, 0x96, 0xA8, 0xA3, 0x94, 0x8C, 0xAD, 0x94, 0xAB, 
-    0x9F, 0xA8, 0xA3, 0x7B, 0x96, 0x7B, 0xA0, 0xAB, 0x7B, 0xA4, 0xA3, 0x7B, 
-    0x7B, 0xA2, 0x93, 0xAB, 0xA8, 0xA6, 0xA3, 0x7B, 0x7B, 0x94, 0xA4, 0xAB, 
-    0xA8, 0xA8, 0xB7, 0x96, 0x96, 0x9E, 0x91, 0xAB, 0x89, 0x9F, 0x94, 0x9E, 
-    0x76, 0x75, 0x89, 0xA1, 0xA7, 0xA9, 0xA9, 0xB8, 0xBA, 0xBB, 0xBB, 0xBA, 
-    0xB7, 0x7B, 0xA2, 0xB8, 0xB1, 0xB3, 0xAA, 0xAF, 0xAE, 0x9E, 0xA8, 0xB8, 
-    0xA9, 0xB0, 0xAC, 0xB8, 0xAE, 0x76, 0xA8, 0xB8, 0xA9, 0xB0, 0xAC, 0xB8, 
-    0xAE, 0xAD, 0xA8, 0xA9, 0xA9, 0xB0, 0xAC, 0xB8, 0xAE, 0xAD, 0xA8, 0xA9, 
-    0xAA, 0xB0, 0xAC, 0xB8, 0xAE, 0x94, 0xA5, 0xB8, 0xA9, 0xB0, 0xAC, 0xB8, 
-    0xAE, 0x94, 0xA5, 0xB8, 0xA9, 0xAC, 0xA9, 0xB8, 0xA7, 0xB4, 0xBE, 0xB3, 
-    0xAA, 0xAC, 0xB1, 0xC4, 0xA7, 0xBB, 0xC3, 0xB3, 0xAA, 0xAC, 0xAF, 0xB2, 
-    0xA9, 0xB3, 0xB2, 0xAA, 0xB3, 0xAA, 0xAC, 0xB3, 0xA9, 0xAA, 0xAC, 0xB0, 
-    0xAA, 0xA6, 0xAF, 0xB3, 0xA7, 0xB0, 0xB0, 0xB0, 0xB7, 0x8D, 0xAF, 0xAA, 
-    0xA7, 0xB0, 0xB0, 0xB0, 0xB7, 0xA4, 0xAA, 0xAA, 0xB8, 0xB0, 0xB0, 0xB0, 
-    0xAA, 0xB7, 0xAA, 0xAA, 0xB8, 0xB0, 0xB0, 0xB0, 0xAC, 0xA8, 0xA8, 0xAA, 
-    0xB1, 0xA9, 0xB4, 0xBE, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xB8, 0xBA, 0xC4, 
-    0xB3, 0xB0, 0xB0, 0xB0, 0xA9, 0xB8, 0xB3, 0xB0, 0xB3, 0xB0, 0xB0, 0xB0, 
-    0xA9, 0xA7, 0xB3, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xA9, 0xA9, 0xB3, 0xB0, 
-    0xB0, 0xB3, 0xB0, 0xB0, 0xA9, 0xB8, 0xB3, 0xB3, 0xB3, 0xB0, 0xB0, 0xB0, 
-    0xA9, 0xA9, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB0, 0xA9, 0xB8, 0xAA, 0xB3, 
-    0xB3, 0xB0, 0xB3, 0xB3, 0xC7, 0xB3, 0xA7, 0xAF, 0xC4, 0xC5, 0xB0, 0xB0, 
-    0xB3, 0xAA, 0xA7, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAA, 0x93, 0xA7, 
-    0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xAA, 0xA1, 0xA7, 0xB3, 0xB3, 0xB0, 0xB0, 
-    0xB0, 0xAA, 0xA1, 0xA7, 0xB3, 0xB3, 0xB0, 0xB0, 0xB0, 0xAA, 0x93, 0xA7, 
-    0xB3, 0xB3, 0xB3, 0xB0, 0xB0, 0xAA, 0x93, 0xA7, 0xB3, 0xB0, 0xB3, 0xB0, 
-    0xB0, 0xAA, 0x93, 0xA7, 0xB3, 0xB3, 0xB0, 0xB0, 0xB0, 0xBA, 0xBB, 0xB0, 
-    0xB3, 0xB7, 0xA1, 0xAB, 0xB0, 0xB2, 0xB9, 0xB0, 0xB0, 0xB7, 0xAB, 0xAF, 
-    0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xA9, 0xAB, 0xA7, 0xB0, 0xB0, 0xB0, 0xB0, 
-    0xB0, 0xA9, 0x93, 0xA7, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB7, 0x93, 0xA7, 
-    0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xBD, 0x93, 0xB8, 0xB0, 0xB0, 0xB0, 0xB0, 
-    0xB0, 0xAF, 0x93, 0xB8, 0xB3, 0xB0, 0xB0, 0xB0, 0xB0, 0xA9, 0xA4, 0xA3, 
-    0xB1, 0xBA, 0xC3, 0xBB, 0xB1, 0xBA, 0xBB, 0xBE, 0xAA, 0xB2, 0xBE, 0xBB, 
-    0xB3, 0xA9, 0xA7, 0xBA, 0xAC, 0xB0, 0xB3, 0xB3, 0xAC, 0xA6, 0x8D, 0xA1, 
-    0xAA, 0xB0, 0xAC, 0xAC, 0xAC, 0x8B, 0xA2, 0xA1, 0xAA, 0xB0, 0xB0, 0xB0, 
-    0xAC, 0xA4, 0x98, 0xA1, 0xAC, 0xB0, 0xB0, 0xB0, 0xAC, 0xA6, 0xA0, 0xA1, 
-    0xAC, 0xB0, 0xB0, 0xB0, 0xAC, 0xA9, 0xAE, 0xA1, 0xAA, 0xB0, 0xB0, 0xB0, 
-    0xAC, 0xB7, 0xA4, 0xA1, 0xBB, 0xAA, 0xAC, 0xAC, 0xAA, 0xAA, 0xAF, 0xBA, 
-    0xBA, 0xAA, 0xAC, 0xA6, 0xB7, 0xB7, 0xA6, 0xA7, 0x93, 0xAC, 0xAC, 0x7B, 
-    0xAE, 0xAE, 0xA4, 0xB8, 0x93, 0xAC, 0xAC, 0x94, 0xA2, 0xA4, 0xB5, 0xB8, 
-    0xAB, 0xAC, 0xA9, 0x94, 0x96, 0xA4, 0xB8, 0xB8, 0xAB, 0xAC, 0xAC, 0x94, 
-    0x96, 0x94, 0xB5, 0xB8, 0xA7, 0xAC, 0xA9, 0xA4, 0xAD, 0xAD, 0x7B, 0xB8, 
-    0x93, 0xAC, 0xA9, 0xA6, 0x76, 0x76, 0x96, 0xB8, 0xB7, 0x7B, 0xB7, 0xA4, 
-    0xA8, 0x91, 0xA3, 0xA1, 0xA5, 0x96, 0xB6, 0xA8, 0x8E, 0x76, 0xB5, 0x93, 
-    0xA5, 0x91, 0x76, 0x76, 0x7B, 0x98, 0x93, 0x93, 0xA3, 0x96, 0x91, 0x91, 
-    0xA8, 0x8C, 0xA3, 0x93, 0xA3, 0x94, 0xAE, 0x94, 0xAE, 0x91, 0xA3, 0x93, 
-    0xB5, 0xA2, 0x98, 0x8C, 0xBC, 0x7B, 0x93, 0x93, 0xA3, 0x96, 0x76, 0x76, 
-    0x96, 0x7B, 0x93, 0x93, 0xB8, 0x91, 0x68, 0x68, 0xAD, 0x94, 0x93, 0x93, 
-    0x8D, 0xAD, 0x75, 0x96, 0x91, 0x72, 0x32, 0x32, 0x8D, 0x68, 0x73, 0x73, 
-    0x73, 0x74, 0x50, 0x74, 0xA2, 0x75, 0x76, 0x73, 0x74, 0x73, 0x68, 0x72, 
-    0xA2, 0x91, 0x89, 0x76, 0x52, 0x74, 0x68, 0x50, 0xA2, 0x91, 0x89, 0x68, 
-    0x73, 0x4E, 0x4E, 0x32, 0xA2, 0x72, 0x73, 0x73, 0x74, 0x52, 0x9F, 0x9E, 
-    0xA2, 0x4E, 0x74, 0x75, 0x52, 0x68, 0x89, 0x89, 0xAE, 0x76, 0x50, 0x73, 
-    0x72, 0x52, 0x73, 0x52, 0x78, 0x72, 0x76, 0x76, 0x75, 0x73, 0x73, 0x73, 
-    0x32, 0x4A, 0x53, 0x53, 0x4A, 0x4A, 0x53, 0x53, 0x4E, 0x4A, 0x2E, 0x2E, 
-    0x24, 0x24, 0x24, 0x24, 0x2E, 0x4A, 0x4A, 0x4D, 0x4A, 0x4A, 0x53, 0x4A, 
-    0x53, 0x53, 0x53, 0x78, 0x50, 0x50, 0x77, 0x78, 0x9E, 0x78, 0x4E, 0x73, 
-    0x75, 0x77, 0x77, 0x78, 0x91, 0x9F, 0x78, 0x77, 0x75, 0x76, 0x89, 0x75, 
-    0x72, 0x75, 0x73, 0x4D, 0x4D, 0x74, 0x89, 0x91, 0x75, 0x73, 0x32, 0x4D, 
-    0x50, 0x73, 0x68, 0x78, 0x53, 0x4E, 0x77, 0x77, 0x32, 0x2D, 0x4A, 0x32, 
-    0x0F, 0x24, 0x56, 0x4A, 0x4A, 0x0F, 0x0E, 0x2D, 0x56, 0x24, 0x24, 0x24, 
-    0x2E, 0x56, 0x0F, 0x24, 0x53, 0x53, 0x56, 0x56, 0x32, 0x2E, 0x53, 0x2E, 
-    0x32, 0x53, 0x56, 0x4D, 0x73, 0x74, 0x32, 0x4A, 0x77, 0x78, 0x32, 0x4D, 
-    0x75, 0x75, 0x78, 0x53, 0x91, 0x75, 0x74, 0x4D, 0x50, 0x79, 0x9F, 0x74, 
-    0x74, 0x32, 0x53, 0x53, 0x4D, 0x4A, 0x53, 0x4A, 0x79, 0x75, 0x52, 0x73, 
-    0x32, 0x4D, 0x53, 0x4D, 0x53, 0x53, 0x53, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 
-    0x25, 0x0E, 0x24, 0x0F, 0x24, 0x56, 0x56, 0x2E, 0x0E, 0x56, 0x2E, 0x2E, 
-    0x77, 0x77, 0x74, 0x32, 0x24, 0x24, 0x24, 0x56, 0x53, 0x32, 0x53, 0x32, 
-    0x4A, 0x56, 0x24, 0x24, 0x0E, 0x0F, 0x24, 0x2E, 0x53, 0x2E, 0x2E, 0x4A, 
-    0x4A, 0x24, 0x24, 0x0F, 0x2E, 0x2E, 0x53, 0x53, 0x2E, 0x4A, 0x74, 0x73, 
-    0x4A, 0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x53, 0x32, 0x4A, 0x4A, 0x2E, 0x2E, 
-    0x4A, 0x2E, 0x2E, 0x2E, 0x53, 0x4A, 0x4A, 0x4A, 0x4A, 0x2E, 0x2E, 0x4A, 
-    0x32, 0x53, 0x4A, 0x4A, 0x53, 0x4A, 0x2E, 0x4A, 0x74, 0x77, 0x50, 0x4A, 
-    0x2E, 0x56, 0x2E, 0x2E, 0x2E, 0x77, 0x73, 0x32, 0x2E, 0x56, 0x56, 0x56, 
-    0x0E, 0x23, 0x74, 0x73, 0x50, 0x53, 0x56, 0x24, 0x50, 0x2E, 0x0F, 0x0E, 
-    0x69, 0x16, 0x01, 0x24, 0x53, 0x2E, 0x24, 0x0E, 0x46, 0x21, 0x1E, 0x2E, 
-    0x2E, 0x2E, 0x24, 0x0C, 0x60, 0x45, 0x25, 0x2E, 0x2E, 0x2E, 0x24, 0x0C, 
-    0x6C, 0x36, 0x1E, 0x2E, 0x4A, 0x2E, 0x25, 0x0C, 0x97, 0x66, 0x1E, 0x2E, 
-    0x4A, 0x2E, 0x25, 0x0C, 0x97, 0x71, 0x01, 0x56, 0x24, 0x24, 0x25, 0x0C, 
-    0x64, 0x66, 0x1E, 0x2E, 0x24, 0x24, 0x25, 0x0C, 0x86, 0x66, 0x25, 0x2E, 
-    0x2E, 0x53, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x1E, 0x56, 0x24, 0x2E, 0x53, 
-    0x2E, 0x56, 0x2E, 0x1E, 0x56, 0x24, 0x2E, 0x32, 0x53, 0x2E, 0x2E, 0x1E, 
-    0x2E, 0x56, 0x2D, 0x74, 0x74, 0x53, 0x2E, 0x25, 0x2E, 0x2E, 0x4A, 0x77, 
-    0x77, 0x32, 0x51, 0x25, 0x2E, 0x2E, 0x2E, 0x4A, 0x52, 0x74, 0x51, 0x25, 
-    0x2E, 0x2E, 0x2E, 0x56, 0x73, 0x73, 0x51, 0x25, 0x2E, 0x56, 0x2E, 0x56, 
-    0x77, 0x73, 0x2E, 0x0F, 0x71, 0x90, 0x0E, 0x2D, 0x2E, 0x2E, 0x4A, 0x56, 
-    0x6B, 0x90, 0x0E, 0x2D, 0x24, 0x24, 0x2E, 0x2E, 0x6B, 0x90, 0x0E, 0x24, 
-    0x0E, 0x0E, 0x56, 0x2E, 0x6B, 0x80, 0x0E, 0x0E, 0x0C, 0x0C, 0x0E, 0x56, 
-    0x1B, 0x5C, 0x0E, 0x0E, 0x0E, 0x0C, 0x0C, 0x24, 0x19, 0x69, 0x0E, 0x0E, 
-    0x0C, 0x0C, 0x0C, 0x0E, 0x23, 0x3D, 0x0C, 0x0E, 0x0E, 0x0C, 0x0C, 0x0E, 
-    0x10, 0x23, 0x0C, 0x0F, 0x0F, 0x0E, 0x0E, 0x0C, 0x2E, 0x2E, 0x56, 0x56, 
-    0x56, 0x2E, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x56, 0x56, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x56, 0x56, 0x56, 0x2E, 0x56, 0x2E, 0x2E, 0x56, 0x56, 0x56, 0x2E, 
-    0x0F, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x0C, 0x0F, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x0E, 0x0B, 0x0F, 0x2E, 0x4A, 0x2E, 0x56, 0x0E, 0x0E, 
-    0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x0E, 0x0B, 0x0E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x24, 0x0E, 0x0B, 0x0B, 0x56, 0x56, 0x2E, 0x56, 0x0E, 0x0E, 0x0B, 0x0C, 
-    0x56, 0x56, 0x0F, 0x0E, 0x0E, 0x0E, 0x0B, 0x0E, 0x56, 0x0F, 0x0E, 0x0E, 
-    0x0F, 0x0B, 0x0B, 0x0C, 0x0F, 0x0C, 0x0E, 0x10, 0x0F, 0x0C, 0x0E, 0x0C, 
-    0x0C, 0x0E, 0x0F, 0x0F, 0x0B, 0x0B, 0x0E, 0x0C, 0x0F, 0x0E, 0x0F, 0x0C, 
-    0x0B, 0x0B, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0E, 0x16, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0F, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0C, 0x0E, 0x01, 0x01, 0x01, 0x0C, 
-    0x0E, 0x0E, 0x16, 0x19, 0x01, 0x0B, 0x0C, 0x0C, 0x16, 0x0F, 0x19, 0x41, 
-    0x19, 0x0E, 0x19, 0x69, 0x20, 0x34, 0x69, 0x42, 0x20, 0x20, 0x20, 0x69, 
-    0x47, 0x19, 0x42, 0x3F, 0x19, 0x26, 0x20, 0x19, 0x19, 0x20, 0x42, 0x3F, 
-    0x0E, 0x19, 0x19, 0x01, 0x10, 0x20, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x34, 0x47, 0x0C, 0x16, 0x10, 0x0F, 0x0F, 0x25, 0x34, 0x3B, 
-    0x21, 0x69, 0x41, 0x17, 0x35, 0x1B, 0x3E, 0x37, 0x41, 0x42, 0x43, 0x26, 
-    0x36, 0x5D, 0x59, 0x7E, 0x6A, 0x7F, 0x40, 0x25, 0x56, 0x2E, 0x2E, 0x4A, 
-    0x7E, 0x65, 0x37, 0x34, 0x56, 0x2E, 0x2E, 0x4A, 0x37, 0x45, 0x1A, 0x24, 
-    0x2E, 0x2E, 0x2E, 0x4A, 0x17, 0x1E, 0x34, 0x0F, 0x56, 0x2E, 0x2E, 0x4A, 
-    0x37, 0x3F, 0x26, 0x0E, 0x2E, 0x2E, 0x4A, 0x4A, 0x3E, 0x6C, 0x22, 0x25, 
-    0x2E, 0x2E, 0x53, 0x53, 0x3F, 0x5D, 0x22, 0x1E, 0x24, 0x53, 0x32, 0x32, 
-    0x59, 0x5D, 0x22, 0x01, 0x0C, 0x0F, 0x0F, 0x0F, 0x50, 0x53, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x4E, 0x4D, 0x24, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x4E, 0x53, 0x2E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x4E, 0x53, 0x24, 0x0E, 
-    0x0E, 0x0E, 0x56, 0x56, 0x4E, 0x53, 0x0E, 0x0C, 0x0E, 0x0F, 0x56, 0x2E, 
-    0x4E, 0x2E, 0x0E, 0x0E, 0x0E, 0x24, 0x56, 0x56, 0x53, 0x0E, 0x0C, 0x0E, 
-    0x0E, 0x24, 0x2E, 0x10, 0x0F, 0x0C, 0x0C, 0x0E, 0x0F, 0x2E, 0x2E, 0x56, 
-    0x0F, 0x2E, 0x4A, 0x4A, 0x4D, 0x4D, 0x4A, 0x4A, 0x24, 0x53, 0x4E, 0x53, 
-    0x4D, 0x4D, 0x4A, 0x53, 0x24, 0x4A, 0x32, 0x53, 0x53, 0x4A, 0x4A, 0x53, 
-    0x24, 0x0E, 0x56, 0x74, 0x75, 0x72, 0x72, 0x73, 0x2E, 0x10, 0x56, 0x32, 
-    0x72, 0x75, 0x75, 0x73, 0x2E, 0x2E, 0x24, 0x24, 0x0E, 0x2E, 0x2E, 0x24, 
-    0x2E, 0x56, 0x56, 0x56, 0x56, 0x0F, 0x0F, 0x0F, 0x56, 0x2E, 0x4A, 0x2E, 
-    0x4A, 0x2E, 0x24, 0x0F, 0x4A, 0x53, 0x32, 0x2E, 0x24, 0x51, 0x2E, 0x0F, 
-    0x4D, 0x74, 0x73, 0x53, 0x0F, 0x35, 0x1A, 0x0F, 0x32, 0x74, 0x50, 0x2D, 
-    0x16, 0x57, 0x21, 0x0E, 0x67, 0x53, 0x2E, 0x25, 0x16, 0x5D, 0x45, 0x0E, 
-    0x32, 0x2D, 0x34, 0x25, 0x16, 0x95, 0x36, 0x34, 0x24, 0x0F, 0x0F, 0x24, 
-    0x0F, 0x21, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x56, 0x56, 0x2E, 0x2E, 0x2E, 
-    0x0F, 0x56, 0x2E, 0x10, 0x2E, 0x4A, 0x4A, 0x74, 0x0F, 0x24, 0x2E, 0x4A, 
-    0x4A, 0x4D, 0x50, 0x77, 0x0E, 0x25, 0x53, 0x73, 0x77, 0x77, 0x77, 0x32, 
-    0x0F, 0x24, 0x2E, 0x4E, 0x32, 0x32, 0x4A, 0x56, 0x34, 0x34, 0x0F, 0x2D, 
-    0x24, 0x24, 0x4A, 0x4A, 0x0F, 0x0F, 0x24, 0x24, 0x2E, 0x4A, 0x4A, 0x2E, 
-    0x56, 0x4A, 0x32, 0x56, 0x2E, 0x53, 0x4A, 0x4A, 0x4A, 0x4D, 0x32, 0x4A, 
-    0x56, 0x2E, 0x4A, 0x53, 0x78, 0x4A, 0x2E, 0x4A, 0x56, 0x2E, 0x4A, 0x32, 
-    0x32, 0x2D, 0x2E, 0x56, 0x24, 0x2D, 0x24, 0x0E, 0x56, 0x4A, 0x53, 0x4A, 
-    0x53, 0x72, 0x78, 0x4A, 0x56, 0x4A, 0x53, 0x53, 0x50, 0x9E, 0x9F, 0x4D, 
-    0x4A, 0x53, 0x53, 0x53, 0x78, 0x73, 0x4E, 0x24, 0x4A, 0x53, 0x4E, 0x53, 
-    0x74, 0x77, 0x4A, 0x0F, 0x53, 0x53, 0x32, 0x77, 0x4E, 0x56, 0x2E, 0x0F, 
-    0x50, 0x50, 0x75, 0x79, 0x4E, 0x24, 0x10, 0x56, 0x73, 0x91, 0x89, 0x72, 
-    0x2E, 0x56, 0x2E, 0x24, 0x25, 0x24, 0x56, 0x0E, 0x25, 0x4A, 0x4A, 0x4A, 
-    0x24, 0x56, 0x4D, 0x56, 0x24, 0x4D, 0x4D, 0x4D, 0x0F, 0x56, 0x4E, 0x56, 
-    0x24, 0x4D, 0x4D, 0x4A, 0x0F, 0x56, 0x4A, 0x24, 0x24, 0x4E, 0x50, 0x77, 
-    0x0F, 0x24, 0x24, 0x56, 0x4A, 0x4D, 0x78, 0x68, 0x0F, 0x56, 0x2E, 0x32, 
-    0x32, 0x4A, 0x4D, 0x74, 0x2E, 0x53, 0x4D, 0x4E, 0x50, 0x4D, 0x53, 0x4E, 
-    0x4A, 0x77, 0x50, 0x4E, 0x50, 0x4D, 0x50, 0x78, 0x2D, 0x2D, 0x2E, 0x4A, 
-    0x4A, 0x4D, 0x76, 0x91, 0x4E, 0x50, 0x50, 0x53, 0x4E, 0x4E, 0x9F, 0x73, 
-    0x78, 0x75, 0x77, 0x4E, 0x4E, 0x50, 0x76, 0x73, 0x32, 0x4D, 0x50, 0x74, 
-    0x77, 0x52, 0x91, 0x75, 0x78, 0x4E, 0x50, 0x77, 0x76, 0x76, 0x68, 0x77, 
-    0x32, 0x77, 0x77, 0x4E, 0x74, 0x73, 0x75, 0x9E, 0x4E, 0x78, 0x78, 0x53, 
-    0x50, 0x78, 0x74, 0x74, 0x78, 0x78, 0x50, 0x78, 0x32, 0x78, 0x77, 0x77, 
-    0x74, 0x50, 0x50, 0x32, 0x32, 0x32, 0x50, 0x32, 0x4E, 0x73, 0x52, 0x4E, 
-    0x53, 0x32, 0x50, 0x72, 0x51, 0x50, 0x50, 0x32, 0x78, 0x32, 0x50, 0x75, 
-    0x50, 0x32, 0x50, 0x75, 0x75, 0x50, 0x78, 0x78, 0x72, 0x68, 0x76, 0x76, 
-    0x9F, 0x78, 0x78, 0x78, 0x77, 0x9F, 0x9F, 0x52, 0x78, 0x78, 0x50, 0x78, 
-    0x78, 0x50, 0x32, 0x50, 0x78, 0x78, 0x72, 0x50, 0x52, 0x78, 0x78, 0x77, 
-    0x52, 0x52, 0x9F, 0x73, 0x50, 0x4E, 0x91, 0xAB, 0xA3, 0x93, 0x91, 0xCC, 
-    0x9F, 0x72, 0x7B, 0xAB, 0xA5, 0xA0, 0x68, 0x52, 0x96, 0x75, 0x7B, 0xA1, 
-    0xA0, 0xCC, 0x52, 0x9F, 0x52, 0x78, 0x91, 0xA1, 0xA0, 0x78, 0x75, 0x91, 
-    0x78, 0xCC, 0x96, 0x93, 0xA0, 0x78, 0x52, 0x9E, 0x9F, 0x9F, 0x7B, 0x93, 
-    0xA4, 0x75, 0x75, 0x9E, 0x52, 0x52, 0x91, 0x93, 0xA4, 0x75, 0x76, 0xAD, 
-    0x52, 0xCC, 0x76, 0x93, 0x98, 0xCC, 0x52, 0x78, 0xCC, 0x98, 0xAE, 0x9F, 
-    0x9F, 0x76, 0xA2, 0xA1, 0xCC, 0xAE, 0xA7, 0x9F, 0x9F, 0x75, 0x96, 0xAB, 
-    0xCC, 0xA4, 0xAE, 0x9F, 0x73, 0x73, 0x75, 0xAB, 0x9E, 0xA8, 0xAE, 0x9F, 
-    0x52, 0x9F, 0x75, 0xAE, 0xAD, 0xA4, 0xA5, 0xCC, 0x52, 0x9F, 0xAD, 0xAE, 
-    0xAD, 0xA8, 0xA4, 0x9E, 0x76, 0x76, 0x96, 0xAB, 0x9E, 0x7B, 0x94, 0x76, 
-    0x76, 0xAD, 0x96, 0x93, 0xCC, 0x98, 0xA5, 0xAD, 0x76, 0xAD, 0x7B, 0x93, 
-    0xAE, 0x9F, 0xA4, 0xB8, 0xA9, 0xBD, 0xA9, 0xB8, 0xAE, 0x72, 0xA8, 0xB8, 
-    0xA9, 0xAC, 0xA9, 0xB8, 0xAE, 0xCC, 0x8C, 0xA9, 0xA9, 0xAA, 0xA9, 0xB8, 
-    0xA2, 0x7B, 0xA6, 0xA9, 0xA9, 0xAC, 0xA9, 0xB8, 0xA8, 0xA8, 0xA9, 0xA9, 
-    0xA9, 0xB7, 0xA9, 0xB8, 0xA0, 0xA8, 0xA9, 0xA9, 0xA9, 0xB7, 0xA9, 0xB8, 
-    0x98, 0xA8, 0xAF, 0xA9, 0xA9, 0xA9, 0xA9, 0xB8, 0xA0, 0xAD, 0xA8, 0xA9, 
-    0xA9, 0xA7, 0xA6, 0xA6, 0xB8, 0xB0, 0xB0, 0xB0, 0xBD, 0x76, 0x7B, 0xA9, 
-    0xB8, 0xB0, 0xB0, 0xB0, 0xB7, 0x96, 0x7B, 0xB7, 0xB8, 0xB0, 0xB0, 0xB0, 
-    0xBD, 0x96, 0x94, 0xA6, 0xB8, 0xB0, 0xB0, 0xB0, 0xBD, 0x96, 0x96, 0x96, 
-    0xB8, 0xB0, 0xB0, 0xB0, 0xB7, 0x96, 0x91, 0xAD, 0xB8, 0xB0, 0xB0, 0xB0, 
-    0xBD, 0x96, 0x96, 0x96, 0xA9, 0xB0, 0xB0, 0xB3, 0xBD, 0x96, 0x96, 0x96, 
-    0xA9, 0xB3, 0xB0, 0xB3, 0xBD, 0x96, 0x96, 0x98, 0xA9, 0xA9, 0xA9, 0xAA, 
-    0xB3, 0xB3, 0xB0, 0xB0, 0xA9, 0xA9, 0xA9, 0xAA, 0xB0, 0xB3, 0xB3, 0xB3, 
-    0xA4, 0xA7, 0xA9, 0xAA, 0xB3, 0xB0, 0xB3, 0xBD, 0xA4, 0xA9, 0xA9, 0xAF, 
-    0xB2, 0xB1, 0xCD, 0x8A, 0x98, 0xA9, 0xA9, 0xB1, 0xCE, 0x99, 0x41, 0x35, 
-    0xA4, 0xAF, 0xB1, 0x8A, 0x47, 0x30, 0x17, 0x30, 0xAE, 0xB7, 0xCF, 0x3B, 
-    0x17, 0x18, 0x18, 0x1A, 0xCE, 0x99, 0x3B, 0x30, 0x30, 0x1F, 0x18, 0x1F, 
-    0xB0, 0xAA, 0x93, 0x93, 0xB3, 0xB0, 0xB0, 0xB0, 0xB3, 0xAF, 0x93, 0xA9, 
-    0xAA, 0xB3, 0xB3, 0xB0, 0xCD, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xAF, 0xB3, 
-    0x43, 0x41, 0x41, 0x41, 0x26, 0x69, 0xCE, 0xB1, 0x30, 0x30, 0x30, 0x30, 
-    0x18, 0x1B, 0x26, 0x42, 0x1F, 0x1F, 0x18, 0x18, 0x1F, 0x30, 0x30, 0x1F, 
-    0x1F, 0x18, 0x1F, 0x18, 0x18, 0x1F, 0x30, 0x0C, 0x18, 0x18, 0x18, 0x18, 
-    0x18, 0x1F, 0x16, 0x18, 0xB0, 0xC5, 0xB3, 0xB0, 0xB3, 0xA9, 0xA8, 0xA3, 
-    0xB0, 0xB0, 0xAA, 0xAA, 0xB0, 0xA7, 0xA5, 0xB8, 0xC5, 0xB0, 0xAC, 0xAA, 
-    0xAA, 0xB8, 0x94, 0xB8, 0xB2, 0xB3, 0xA9, 0xAA, 0xAA, 0xA6, 0x7B, 0xA3, 
-    0x8A, 0xBC, 0xA9, 0xAC, 0xAA, 0xB7, 0x7B, 0xB8, 0x35, 0x54, 0xBC, 0xAF, 
-    0xAA, 0xB8, 0x7B, 0xB5, 0x1A, 0x17, 0x63, 0xCD, 0xA7, 0xB8, 0x96, 0x96, 
-    0x18, 0x0E, 0x30, 0x63, 0xBC, 0xB7, 0x96, 0x96, 0xAA, 0xB0, 0xB0, 0xB0, 
-    0xAC, 0xB7, 0xA0, 0xA1, 0xAA, 0xB0, 0xB0, 0xB0, 0xAC, 0xB7, 0xAE, 0xA1, 
-    0xA9, 0xB0, 0xB0, 0xB0, 0xAC, 0xA9, 0xA5, 0xA1, 0xA9, 0xB0, 0xB0, 0xB0, 
-    0xAC, 0xB7, 0xA3, 0xA1, 0xB8, 0xB0, 0xB0, 0xB0, 0xAC, 0xB7, 0x8D, 0xA5, 
-    0xB7, 0xB0, 0xB0, 0xB0, 0xAC, 0xA9, 0xAE, 0xA3, 0xB6, 0xB3, 0xB0, 0xB0, 
-    0xAC, 0xB8, 0xAB, 0xA1, 0xB6, 0xB0, 0xB0, 0xB0, 0xAC, 0xA3, 0x8D, 0xA1, 
-    0xA7, 0xAC, 0xA9, 0xA6, 0xAD, 0x76, 0xAD, 0xA5, 0xA7, 0xAC, 0xAC, 0xA3, 
-    0x94, 0xAD, 0xAD, 0xA8, 0xA7, 0xAC, 0xB7, 0xA8, 0xB7, 0x7B, 0x9E, 0xAE, 
-    0xA7, 0xA9, 0xA9, 0xA4, 0xA9, 0xA6, 0x96, 0xA5, 0xA9, 0xAC, 0xAC, 0xA9, 
-    0xA9, 0xA6, 0x96, 0xA5, 0xA9, 0xAC, 0xA9, 0xA9, 0xAC, 0xA9, 0x96, 0xA0, 
-    0xA9, 0xAC, 0xB7, 0xA4, 0xA6, 0xA4, 0x96, 0x96, 0xA9, 0xA9, 0xA6, 0x9F, 
-    0x9E, 0x9E, 0xAD, 0x94, 0xA5, 0x75, 0x75, 0x73, 0x9E, 0x8C, 0x93, 0x93, 
-    0xA4, 0x68, 0x79, 0x76, 0x9F, 0x9F, 0xA0, 0xA1, 0xA3, 0x9F, 0x52, 0x9F, 
-    0x9F, 0xCC, 0xA0, 0xA1, 0xB8, 0x9F, 0x72, 0x76, 0x9E, 0x9F, 0xAE, 0xA1, 
-    0xB8, 0x9E, 0x52, 0x9F, 0x52, 0x9F, 0xAE, 0xA1, 0xA7, 0xAD, 0x9F, 0x75, 
-    0x68, 0x9E, 0xA0, 0x93, 0x7B, 0x76, 0x9F, 0x9E, 0x91, 0xAD, 0xAE, 0x93, 
-    0xA4, 0xAD, 0x52, 0x52, 0x52, 0x52, 0x98, 0x93, 0xA0, 0xAD, 0x50, 0x50, 
-    0x50, 0x4E, 0x4E, 0x4E, 0xA2, 0x9F, 0x50, 0x72, 0x73, 0x73, 0x9F, 0x75, 
-    0xA2, 0x78, 0x50, 0x72, 0x77, 0x73, 0x9F, 0x9E, 0xA8, 0x4D, 0x50, 0x50, 
-    0x50, 0x50, 0x50, 0x50, 0x8C, 0x4E, 0x78, 0x50, 0x50, 0x50, 0x50, 0x50, 
-    0xA8, 0x50, 0x78, 0x78, 0x78, 0x78, 0x78, 0x77, 0xA8, 0x50, 0x77, 0x52, 
-    0x52, 0x77, 0x77, 0x9E, 0x94, 0x78, 0x73, 0x9F, 0x77, 0x77, 0x9F, 0x9F, 
-    0x4E, 0x78, 0x50, 0x50, 0x78, 0x4E, 0x50, 0x79, 0x75, 0x75, 0x9F, 0x76, 
-    0x91, 0x75, 0x50, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 0x75, 0x9F, 0x77, 0x78, 
-    0x50, 0x32, 0x32, 0x32, 0x4E, 0x50, 0x75, 0x77, 0x78, 0x78, 0x50, 0x50, 
-    0x50, 0x50, 0x78, 0x78, 0x52, 0x77, 0x52, 0x52, 0x77, 0x50, 0x50, 0x50, 
-    0x9F, 0x77, 0x78, 0x78, 0x52, 0x77, 0x78, 0x78, 0x77, 0x52, 0x52, 0x52, 
-    0x52, 0x77, 0x78, 0x77, 0x89, 0x73, 0x74, 0x78, 0x78, 0x89, 0x75, 0x74, 
-    0x50, 0x4D, 0x4E, 0x73, 0x73, 0x75, 0x91, 0x73, 0x50, 0x4A, 0x4A, 0x74, 
-    0x32, 0x4E, 0x91, 0x76, 0x72, 0x32, 0x53, 0x4E, 0x4A, 0x4E, 0x73, 0x68, 
-    0x78, 0x68, 0x76, 0x50, 0x4E, 0x53, 0x4A, 0x32, 0x78, 0x77, 0x78, 0x73, 
-    0x77, 0x4E, 0x4E, 0x4E, 0x78, 0x32, 0x32, 0x73, 0x73, 0x78, 0x77, 0x32, 
-    0x78, 0x50, 0x50, 0x50, 0x50, 0x78, 0x73, 0x78, 0x2E, 0x2E, 0x2E, 0x32, 
-    0x32, 0x4A, 0x2E, 0x2E, 0x32, 0x51, 0x2E, 0x4A, 0x74, 0x74, 0x74, 0x32, 
-    0x73, 0x74, 0x2E, 0x24, 0x74, 0x74, 0x78, 0x53, 0x76, 0x74, 0x2E, 0x24, 
-    0x56, 0x24, 0x25, 0x2E, 0x79, 0x32, 0x53, 0x53, 0x53, 0x2E, 0x24, 0x56, 
-    0x53, 0x50, 0x75, 0x73, 0x32, 0x4E, 0x53, 0x2E, 0x2E, 0x4D, 0x75, 0x75, 
-    0x74, 0x50, 0x32, 0x32, 0x32, 0x2E, 0x53, 0x74, 0x32, 0x74, 0x73, 0x74, 
-    0x24, 0x0F, 0x24, 0x67, 0x74, 0x4E, 0x2E, 0x2E, 0x56, 0x0F, 0x0F, 0x53, 
-    0x32, 0x32, 0x32, 0x32, 0x2E, 0x56, 0x0F, 0x24, 0x56, 0x32, 0x78, 0x77, 
-    0x62, 0x32, 0x53, 0x74, 0x56, 0x4A, 0x74, 0x77, 0x53, 0x2E, 0x2E, 0x53, 
-    0x56, 0x24, 0x24, 0x24, 0x56, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 
-    0x32, 0x53, 0x2E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x32, 0x4E, 0x53, 0x4D, 
-    0x2E, 0x56, 0x0F, 0x0F, 0x2E, 0x2E, 0x0F, 0x0C, 0x5F, 0x66, 0x1E, 0x2E, 
-    0x4E, 0x32, 0x2E, 0x0E, 0x5F, 0x66, 0x1E, 0x2E, 0x76, 0x9E, 0x4A, 0x1F, 
-    0x7D, 0x71, 0x1E, 0x2E, 0x67, 0x67, 0x4A, 0x18, 0x7D, 0x71, 0x1E, 0x2E, 
-    0x24, 0x56, 0x3D, 0x16, 0x86, 0x66, 0x1E, 0x2E, 0x0F, 0x0E, 0x20, 0x10, 
-    0x24, 0x10, 0x2E, 0x56, 0x0F, 0x24, 0x24, 0x24, 0x53, 0x3D, 0x13, 0x2E, 
-    0x0F, 0x24, 0x0F, 0x0E, 0x10, 0x74, 0x62, 0x19, 0x2E, 0x2E, 0x2E, 0x24, 
-    0x77, 0x75, 0x13, 0x34, 0x56, 0x2E, 0x56, 0x4D, 0x91, 0x73, 0x13, 0x24, 
-    0x2E, 0x2E, 0x56, 0x4D, 0x96, 0x50, 0x13, 0x24, 0x2E, 0x2E, 0x2E, 0x4A, 
-    0x72, 0x51, 0x2E, 0x0F, 0x2E, 0x2E, 0x56, 0x4A, 0x75, 0x32, 0x10, 0x25, 
-    0x56, 0x2E, 0x56, 0x4A, 0x91, 0x50, 0x34, 0x0E, 0x2E, 0x2E, 0x0F, 0x56, 
-    0x73, 0x4D, 0x0F, 0x0E, 0x10, 0x10, 0x20, 0x0F, 0x24, 0x56, 0x0F, 0x0E, 
-    0x0F, 0x17, 0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x23, 0x20, 0x0E, 0x10, 
-    0x23, 0x0C, 0x0E, 0x0F, 0x10, 0x19, 0x0E, 0x0F, 0x10, 0x0E, 0x0E, 0x0F, 
-    0x17, 0x20, 0x0E, 0x0C, 0x0C, 0x0F, 0x17, 0x13, 0x63, 0x54, 0x0C, 0x0E, 
-    0x0C, 0x1F, 0x19, 0x1A, 0x31, 0x22, 0x0E, 0x34, 0x0F, 0x0E, 0x17, 0x19, 
-    0x0B, 0x0B, 0x0F, 0x2E, 0x0F, 0x0E, 0x0F, 0x17, 0x0E, 0x0F, 0x56, 0x4A, 
-    0x56, 0x24, 0x0E, 0x0C, 0x0E, 0x0C, 0x0F, 0x2E, 0x56, 0x24, 0x0B, 0x0E, 
-    0x10, 0x0E, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0F, 0x0E, 0x0C, 
-    0x0C, 0x0E, 0x0F, 0x10, 0x10, 0x17, 0x0F, 0x0E, 0x0E, 0x0E, 0x16, 0x19, 
-    0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 0x19, 0x0E, 0x17, 0x0F, 0x34, 0x34, 
-    0x1A, 0x19, 0x19, 0x0C, 0x19, 0x26, 0x38, 0x16, 0x26, 0x21, 0x0E, 0x0B, 
-    0x16, 0x36, 0x1B, 0x21, 0x22, 0x0E, 0x0B, 0x0E, 0x10, 0x0C, 0x0C, 0x0B, 
-    0x0B, 0x0E, 0x0E, 0x0B, 0x10, 0x0E, 0x0C, 0x0B, 0x0C, 0x0E, 0x0B, 0x0B, 
-    0x0F, 0x0C, 0x0B, 0x0E, 0x0E, 0x0B, 0x0B, 0x0B, 0x0E, 0x0B, 0x0B, 0x0E, 
-    0x0E, 0x0B, 0x0B, 0x01, 0x0C, 0x0C, 0x0B, 0x0E, 0x0F, 0x0B, 0x0B, 0x01, 
-    0x0B, 0x0C, 0x0B, 0x0E, 0x0F, 0x0C, 0x0B, 0x01, 0x0C, 0x0E, 0x0C, 0x0B, 
-    0x0B, 0x0B, 0x0B, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0B, 0x0B, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0C, 0x0F, 0x0E, 0x0F, 0x20, 
-    0x01, 0x01, 0x01, 0x01, 0x0E, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0E, 0x16, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x0C, 0x16, 0x69, 
-    0x36, 0x3E, 0x46, 0x46, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x1E, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x17, 0x41, 0x0B, 0x01, 0x0B, 0x0F, 
-    0x10, 0x10, 0x17, 0x35, 0x0B, 0x0B, 0x0C, 0x62, 0x51, 0x47, 0x13, 0x34, 
-    0x1E, 0x10, 0x19, 0x47, 0x47, 0x3D, 0x62, 0x13, 0x0B, 0x17, 0x26, 0x43, 
-    0x42, 0x69, 0x69, 0x26, 0x0B, 0x0F, 0x17, 0x35, 0x17, 0x26, 0x43, 0x3E, 
-    0x46, 0x18, 0x01, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0C, 0x0C, 
-    0x0C, 0x0E, 0x0E, 0x0F, 0x69, 0x42, 0x42, 0x0E, 0x0B, 0x0F, 0x16, 0x16, 
-    0x43, 0x43, 0x42, 0x21, 0x0E, 0x0E, 0x1A, 0x10, 0x35, 0x35, 0x19, 0x5C, 
-    0x22, 0x1E, 0x0E, 0x10, 0x37, 0x3E, 0x42, 0x5C, 0x21, 0x01, 0x0C, 0x0E, 
-    0x3F, 0x3F, 0x5D, 0x3F, 0x43, 0x10, 0x0C, 0x0E, 0x3F, 0x3F, 0x5D, 0x3F, 
-    0x42, 0x23, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F, 0x0F, 0x56, 0x2E, 0x56, 
-    0x0C, 0x0C, 0x0E, 0x0F, 0x2E, 0x56, 0x2E, 0x2E, 0x0E, 0x0C, 0x0E, 0x10, 
-    0x2E, 0x2E, 0x2E, 0x56, 0x10, 0x0E, 0x0F, 0x10, 0x2E, 0x4A, 0x4A, 0x56, 
-    0x19, 0x1A, 0x0E, 0x0F, 0x53, 0x53, 0x53, 0x53, 0x10, 0x23, 0x1F, 0x0E, 
-    0x2E, 0x53, 0x32, 0x32, 0x10, 0x19, 0x19, 0x0E, 0x0B, 0x56, 0x53, 0x53, 
-    0x0E, 0x1A, 0x35, 0x16, 0x0C, 0x0E, 0x0E, 0x0C, 0x56, 0x2E, 0x4A, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x53, 0x4D, 0x50, 0x73, 
-    0x2E, 0x53, 0x53, 0x53, 0x32, 0x78, 0x74, 0x73, 0x4A, 0x4E, 0x32, 0x32, 
-    0x78, 0x73, 0x74, 0x2E, 0x32, 0x32, 0x32, 0x78, 0x73, 0x68, 0x32, 0x0B, 
-    0x78, 0x78, 0x78, 0x67, 0x68, 0x2E, 0x0F, 0x0C, 0x32, 0x73, 0x73, 0x32, 
-    0x2E, 0x0E, 0x0C, 0x0C, 0x0F, 0x53, 0x2E, 0x0E, 0x0C, 0x0E, 0x0E, 0x0E, 
-    0x56, 0x56, 0x2E, 0x2E, 0x4D, 0x53, 0x53, 0x4D, 0x2E, 0x2E, 0x53, 0x50, 
-    0x74, 0x4E, 0x4A, 0x4A, 0x24, 0x24, 0x53, 0x78, 0x32, 0x4D, 0x2E, 0x2E, 
-    0x0E, 0x0B, 0x0E, 0x56, 0x77, 0x67, 0x74, 0x32, 0x0E, 0x0E, 0x0C, 0x0E, 
-    0x56, 0x2E, 0x53, 0x53, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x24, 0x24, 
-    0x0C, 0x0F, 0x0F, 0x0F, 0x24, 0x24, 0x56, 0x2E, 0x0E, 0x56, 0x56, 0x56, 
-    0x56, 0x56, 0x4A, 0x32, 0x4D, 0x4A, 0x2E, 0x2E, 0x53, 0x50, 0x4E, 0x78, 
-    0x4A, 0x53, 0x4A, 0x4A, 0x50, 0x72, 0x73, 0x68, 0x4D, 0x50, 0x72, 0x74, 
-    0x73, 0x68, 0x8C, 0x79, 0x74, 0x79, 0x89, 0x79, 0x68, 0x79, 0x88, 0x4A, 
-    0x53, 0x74, 0x74, 0x4D, 0x24, 0x24, 0x2D, 0x4A, 0x0F, 0x25, 0x56, 0x2E, 
-    0x2E, 0x2E, 0x4E, 0x78, 0x2E, 0x2E, 0x4D, 0x32, 0x32, 0x4E, 0x73, 0x73, 
-    0x32, 0x74, 0x4E, 0x50, 0x72, 0x72, 0x68, 0x68, 0x75, 0x89, 0x89, 0x4D, 
-    0x2E, 0x2E, 0x2E, 0x56, 0x91, 0x73, 0x4E, 0x4A, 0x2E, 0x4A, 0x2E, 0x56, 
-    0x68, 0x4D, 0x0F, 0x56, 0x4A, 0x32, 0x4D, 0x2E, 0x4A, 0x4D, 0x32, 0x4A, 
-    0x4A, 0x72, 0x78, 0x2E, 0x74, 0x73, 0x74, 0x53, 0x4A, 0x73, 0x52, 0x32, 
-    0x68, 0x68, 0x74, 0x2E, 0x53, 0x32, 0x74, 0x73, 0x73, 0x72, 0x32, 0x4A, 
-    0x4D, 0x9F, 0x89, 0x9F, 0x4A, 0x4A, 0x32, 0x72, 0x73, 0x75, 0x68, 0x73, 
-    0x4A, 0x78, 0x32, 0x32, 0x50, 0x4D, 0x50, 0x78, 0x56, 0x4D, 0x53, 0x50, 
-    0x50, 0x50, 0x32, 0x50, 0x2E, 0x53, 0x53, 0x50, 0x50, 0x50, 0x32, 0x78, 
-    0x4D, 0x4E, 0x32, 0x78, 0x32, 0x32, 0x78, 0x77, 0x77, 0x32, 0x74, 0x74, 
-    0x32, 0x50, 0x78, 0x77, 0x67, 0x74, 0x78, 0x32, 0x74, 0x78, 0x50, 0x78, 
-    0x78, 0x78, 0x32, 0x32, 0x72, 0x78, 0x50, 0x32, 0x78, 0x4E, 0x4E, 0x50, 
-    0x74, 0x78, 0x74, 0x78, 0x78, 0x78, 0x50, 0x74, 0x78, 0x77, 0x75, 0x9F, 
-    0x78, 0x74, 0x32, 0x32, 0x32, 0x50, 0x78, 0x78, 0x74, 0x74, 0x74, 0x78, 
-    0x78, 0x50, 0x78, 0x77, 0x78, 0x78, 0x73, 0x77, 0x78, 0x78, 0x78, 0x78, 
-    0x78, 0x50, 0x77, 0x52, 0x74, 0x74, 0x77, 0x52, 0x78, 0x50, 0x78, 0x72, 
-    0x52, 0x77, 0x73, 0x75, 0x50, 0x72, 0x72, 0x78, 0x77, 0x77, 0x77, 0x9F, 
-    0x72, 0x74, 0x74, 0x74, 0x77, 0x77, 0x73, 0x75, 0x9F, 0x78, 0x72, 0x52, 
-    0x52, 0xCC, 0x9F, 0x9F, 0x52, 0x9F, 0x77, 0x77, 0x9F, 0x9F, 0x9F, 0x52, 
-    0x73, 0xCC, 0xCC, 0x52, 0x52, 0x9F, 0x9F, 0x9F, 0x52, 0x52, 0x78, 0x78, 
-    0x78, 0x52, 0x52, 0x52, 0x52, 0x75, 0x9F, 0x72, 0x52, 0x9F, 0x52, 0x52, 
-    0x9F, 0x9F, 0x9E, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x73, 0x52, 0x96, 0x93, 0xA2, 0x9F, 0x9F, 0x9F, 0xCC, 0x52, 0x91, 0xA3, 
-    0xA2, 0x9E, 0xAD, 0xAD, 0x52, 0x52, 0x91, 0xA3, 0xA2, 0x9E, 0x76, 0xAD, 
-    0x73, 0x52, 0x96, 0x93, 0xA2, 0x9E, 0x76, 0xAD, 0x52, 0x72, 0xAD, 0xA3, 
-    0xA2, 0x9E, 0xAD, 0xAD, 0x75, 0x75, 0x96, 0xA3, 0xA2, 0x9F, 0xAD, 0x96, 
-    0x9E, 0x9E, 0x96, 0xA3, 0xA2, 0x9F, 0x9E, 0x8E, 0x75, 0x9F, 0x96, 0xA3, 
-    0xAE, 0x8E, 0x8E, 0x99, 0xCC, 0xA2, 0xA5, 0xAD, 0x76, 0xAD, 0x96, 0x93, 
-    0x9E, 0xA4, 0xA5, 0xAD, 0xAD, 0xAD, 0x96, 0x93, 0x9E, 0xA4, 0xA5, 0xAD, 
-    0x76, 0xAD, 0x96, 0x93, 0x9E, 0xA4, 0xA5, 0x9E, 0x9E, 0x9E, 0x96, 0x93, 
-    0x9E, 0xA4, 0xA5, 0xAD, 0xAD, 0xAD, 0x7B, 0xA7, 0x9E, 0xA2, 0x93, 0xA3, 
-    0xA3, 0xA3, 0xA3, 0xA1, 0xCD, 0xBC, 0xA5, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 
-    0x8A, 0x8A, 0x63, 0x41, 0x41, 0x41, 0x41, 0x41, 0xA4, 0x9F, 0x8C, 0xA9, 
-    0xA9, 0xAB, 0xA4, 0xA4, 0xA4, 0x9F, 0x8C, 0xA9, 0xB8, 0xA6, 0x7B, 0x8D, 
-    0xA2, 0x9E, 0xA8, 0xB8, 0xB8, 0x94, 0xAD, 0xB5, 0xA2, 0x9F, 0x94, 0xA9, 
-    0xA9, 0x94, 0x96, 0xA4, 0xA2, 0x9E, 0xA8, 0xA9, 0xB8, 0x94, 0x96, 0xA4, 
-    0x93, 0xA3, 0xB7, 0xB8, 0x93, 0x7B, 0xAD, 0x8D, 0xBC, 0xBC, 0xBC, 0xB7, 
-    0xA3, 0xAE, 0x8E, 0xA4, 0x41, 0x41, 0x41, 0x8A, 0xCE, 0xB1, 0xBC, 0xA5, 
-    0xA9, 0xB0, 0xB0, 0xB3, 0xBD, 0x96, 0x96, 0xCE, 0xA9, 0xB0, 0xB0, 0xB0, 
-    0xBD, 0x91, 0x89, 0x8A, 0xA9, 0xB0, 0xB0, 0xB3, 0xBD, 0x79, 0x8A, 0x41, 
-    0xA9, 0xB3, 0xB3, 0xB3, 0xAC, 0x88, 0x43, 0x35, 0xA9, 0xB3, 0xB0, 0xB0, 
-    0xAF, 0x88, 0x26, 0x30, 0xA9, 0xB0, 0xB0, 0xB3, 0xCD, 0x54, 0x26, 0x3B, 
-    0xA9, 0xB3, 0xB3, 0xB3, 0x8A, 0x44, 0x17, 0x34, 0xA9, 0xB0, 0xB3, 0xB3, 
-    0x3A, 0x1B, 0x34, 0x34, 0x99, 0x51, 0x3B, 0x18, 0x18, 0x1F, 0x18, 0x0C, 
-    0x41, 0x3B, 0x3B, 0x30, 0x18, 0x0C, 0x0C, 0x18, 0x3B, 0x3B, 0x35, 0x1A, 
-    0x1F, 0x18, 0x18, 0x18, 0x34, 0x0E, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 
-    0x1F, 0x1A, 0x17, 0x17, 0x30, 0x30, 0x18, 0x18, 0x17, 0x1B, 0x44, 0x44, 
-    0x38, 0x17, 0x30, 0x18, 0x17, 0x8F, 0x87, 0xD0, 0x84, 0x8F, 0x38, 0x18, 
-    0x61, 0x5C, 0xAA, 0xD1, 0x70, 0x7E, 0x6F, 0x44, 0x18, 0x18, 0x18, 0x18, 
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-    0x18, 0x18, 0x18, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 
-    0x18, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x17, 0x18, 0x1F, 0x0C, 0x18, 
-    0x1F, 0x1F, 0x17, 0x44, 0x30, 0x1F, 0x1F, 0x1F, 0x0C, 0x38, 0x8F, 0x6A, 
-    0x18, 0x0C, 0x30, 0x17, 0x8A, 0xBC, 0x7B, 0x96, 0x18, 0x1F, 0x1A, 0x30, 
-    0x1A, 0xCF, 0x8E, 0x7B, 0x18, 0x16, 0x19, 0x1A, 0x30, 0x43, 0x54, 0x89, 
-    0x1F, 0x1F, 0x1A, 0x1A, 0x1A, 0x17, 0x42, 0xCF, 0x30, 0x17, 0x16, 0x3B, 
-    0x3B, 0x3B, 0x1B, 0x54, 0x38, 0x37, 0x8F, 0x1B, 0x3B, 0x34, 0x17, 0x42, 
-    0x8F, 0x95, 0xD2, 0x59, 0x44, 0x34, 0x1A, 0x37, 0x70, 0xD3, 0xD4, 0xD5, 
-    0x38, 0x34, 0x34, 0x38, 0xB6, 0xB0, 0xB0, 0xAC, 0xA9, 0xA3, 0xA2, 0xAB, 
-    0xB6, 0xB0, 0xB0, 0xB0, 0xA9, 0xB5, 0x94, 0xAB, 0xB6, 0xB0, 0xB0, 0xB0, 
-    0xAA, 0xB5, 0x94, 0x93, 0xB6, 0xB0, 0xB0, 0xB0, 0xAA, 0xB5, 0x8C, 0x93, 
-    0xB6, 0xB0, 0xB0, 0xB0, 0xAA, 0xB5, 0x94, 0x93, 0xD6, 0xB3, 0xB0, 0xB0, 
-    0xAA, 0xA5, 0x94, 0x93, 0x42, 0xB1, 0xB0, 0xB0, 0xAA, 0xA5, 0xA2, 0x93, 
-    0x69, 0xB3, 0xB3, 0xB0, 0xAA, 0x93, 0xA3, 0xA3, 0xA7, 0xA9, 0xA6, 0xAD, 
-    0x76, 0x96, 0x94, 0xB5, 0xA7, 0xA9, 0xA6, 0x96, 0xAD, 0x94, 0xA9, 0xB8, 
-    0xB8, 0xB8, 0xA4, 0x96, 0xAD, 0x94, 0xB8, 0xB8, 0xB8, 0xA9, 0xAE, 0xAD, 
-    0xAD, 0x94, 0xB8, 0xB8, 0xB8, 0xA9, 0xA6, 0xAD, 0xAD, 0x7B, 0xB8, 0xB8, 
-    0xA9, 0xA7, 0x93, 0xA5, 0xA3, 0xA3, 0x93, 0xB8, 0x93, 0xBC, 0xBC, 0xBC, 
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x54, 0x43, 0x69, 0x69, 0x41, 0x3D, 0x63, 
-    0xB5, 0xAD, 0x9F, 0x73, 0x9F, 0x73, 0xAD, 0x94, 0xA6, 0x96, 0x76, 0x75, 
-    0x76, 0x9E, 0xA8, 0x93, 0xA6, 0x96, 0x76, 0xAD, 0x76, 0x9E, 0xA2, 0xA1, 
-    0xB5, 0xAD, 0x76, 0x76, 0xAD, 0x9E, 0xA2, 0x93, 0xA6, 0xAD, 0xAD, 0x76, 
-    0xAD, 0x9E, 0xA2, 0xA1, 0xB8, 0xA5, 0x8D, 0xAD, 0xAD, 0xAD, 0xA8, 0x93, 
-    0xBC, 0xA3, 0xBC, 0xCE, 0xCE, 0x91, 0x9E, 0x96, 0x69, 0x3D, 0x69, 0x8A, 
-    0x8A, 0x88, 0xA0, 0xA5, 0x7B, 0x52, 0x52, 0x73, 0x52, 0x9F, 0x77, 0x78, 
-    0x8C, 0x72, 0x73, 0x73, 0x73, 0x9F, 0x77, 0x52, 0x94, 0x52, 0x73, 0x75, 
-    0x73, 0x52, 0x52, 0x9E, 0x8C, 0x78, 0x77, 0x52, 0x52, 0x77, 0x52, 0x9E, 
-    0xA8, 0x72, 0x73, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x94, 0x9F, 0xAD, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x96, 0x9E, 0xAD, 0x75, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x94, 0xCC, 0x75, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x72, 0x72, 0x52, 0x73, 
-    0x52, 0x77, 0x77, 0x73, 0x52, 0x72, 0x73, 0x73, 0x73, 0x73, 0x52, 0x78, 
-    0x9E, 0x9F, 0x73, 0x73, 0x73, 0x52, 0x78, 0x78, 0x9E, 0x9F, 0x72, 0x72, 
-    0x72, 0x73, 0x77, 0x77, 0x9E, 0x9E, 0x9F, 0x9E, 0x9F, 0x9F, 0x73, 0x77, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x75, 0x73, 0x77, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x73, 0x73, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x75, 
-    0x77, 0x50, 0x78, 0x78, 0x32, 0x32, 0x73, 0x78, 0x73, 0x73, 0x52, 0x72, 
-    0x32, 0x4E, 0x52, 0x78, 0x52, 0x77, 0x73, 0x77, 0x78, 0x76, 0x73, 0x50, 
-    0x77, 0x78, 0x74, 0x74, 0x72, 0x89, 0x68, 0x50, 0x77, 0x74, 0x74, 0x73, 
-    0x52, 0x77, 0x74, 0x32, 0x77, 0x77, 0x72, 0x77, 0x77, 0x32, 0x4D, 0x4D, 
-    0x77, 0x73, 0x77, 0x74, 0x74, 0x74, 0x78, 0x53, 0x77, 0x77, 0x77, 0x74, 
-    0x74, 0x77, 0x77, 0x50, 0x4E, 0x53, 0x4D, 0x2E, 0x56, 0x32, 0x67, 0x32, 
-    0x4E, 0x4E, 0x52, 0x52, 0x2E, 0x56, 0x56, 0x4D, 0x32, 0x4E, 0x72, 0x52, 
-    0x4E, 0x56, 0x24, 0x4D, 0x77, 0x53, 0x4E, 0x50, 0x78, 0x4D, 0x4A, 0x4D, 
-    0x77, 0x77, 0x50, 0x4A, 0x74, 0x32, 0x4D, 0x4D, 0x77, 0x76, 0x78, 0x4D, 
-    0x4E, 0x53, 0x74, 0x4D, 0x78, 0x73, 0x73, 0x78, 0x50, 0x4D, 0x77, 0x78, 
-    0x50, 0x72, 0x9F, 0x77, 0x74, 0x4D, 0x52, 0x75, 0x4D, 0x4A, 0x32, 0x50, 
-    0x32, 0x2E, 0x24, 0x56, 0x74, 0x4D, 0x77, 0x75, 0x78, 0x32, 0x53, 0x4D, 
-    0x73, 0x4E, 0x77, 0x73, 0x78, 0x74, 0x74, 0x78, 0x68, 0x74, 0x4A, 0x4A, 
-    0x24, 0x24, 0x24, 0x56, 0x74, 0x74, 0x78, 0x53, 0x0F, 0x0E, 0x0E, 0x24, 
-    0x4D, 0x75, 0x76, 0x73, 0x24, 0x0F, 0x0F, 0x56, 0x53, 0x68, 0x76, 0x52, 
-    0x24, 0x0F, 0x0E, 0x56, 0x78, 0x78, 0x78, 0x4A, 0x24, 0x0F, 0x0F, 0x24, 
-    0x0F, 0x0F, 0x0F, 0x24, 0x56, 0x32, 0x3D, 0x26, 0x4D, 0x56, 0x56, 0x2E, 
-    0x56, 0x24, 0x17, 0x3E, 0x74, 0x4D, 0x56, 0x2E, 0x2E, 0x56, 0x24, 0x19, 
-    0x32, 0x32, 0x2E, 0x56, 0x4A, 0x2E, 0x24, 0x25, 0x53, 0x56, 0x0F, 0x24, 
-    0x4A, 0x2E, 0x0F, 0x0F, 0x4E, 0x2E, 0x0F, 0x0E, 0x24, 0x24, 0x0E, 0x0E, 
-    0x32, 0x56, 0x56, 0x2E, 0x56, 0x0F, 0x0E, 0x24, 0x56, 0x56, 0x53, 0x32, 
-    0x4A, 0x24, 0x0E, 0x24, 0x19, 0x51, 0x3D, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 
-    0x3E, 0x0F, 0x24, 0x56, 0x56, 0x0F, 0x0E, 0x0F, 0x20, 0x24, 0x24, 0x0F, 
-    0x24, 0x56, 0x56, 0x56, 0x56, 0x53, 0x53, 0x56, 0x24, 0x73, 0x77, 0x24, 
-    0x4A, 0x32, 0x53, 0x2E, 0x24, 0x32, 0x32, 0x56, 0x56, 0x53, 0x32, 0x32, 
-    0x4A, 0x56, 0x56, 0x2E, 0x24, 0x24, 0x53, 0x77, 0x78, 0x32, 0x4D, 0x4A, 
-    0x2E, 0x0F, 0x2E, 0x74, 0x74, 0x32, 0x53, 0x4A, 0x56, 0x2E, 0x4A, 0x4A, 
-    0x4A, 0x2E, 0x56, 0x24, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 
-    0x4A, 0x4A, 0x4A, 0x56, 0x56, 0x2E, 0x2E, 0x2E, 0x74, 0x32, 0x4D, 0x4A, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x74, 0x78, 0x32, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x67, 0x9F, 0x32, 0x53, 0x4A, 0x2E, 0x56, 0x56, 0x79, 0x7B, 0x73, 0x32, 
-    0x32, 0x4D, 0x4A, 0x2E, 0x79, 0xA8, 0x91, 0x77, 0x78, 0x32, 0x4A, 0x2E, 
-    0x0E, 0x0C, 0x0E, 0x1E, 0x0B, 0x0B, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0B, 0x0B, 0x0E, 0x0E, 0x24, 0x24, 0x0F, 0x0E, 0x0E, 0x0C, 0x0C, 0x0E, 
-    0x56, 0x56, 0x0F, 0x0C, 0x0C, 0x0C, 0x0B, 0x0E, 0x2E, 0x56, 0x0E, 0x0C, 
-    0x0C, 0x0E, 0x0C, 0x0C, 0x4A, 0x56, 0x0F, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 
-    0x4A, 0x2E, 0x0F, 0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x2E, 0x2E, 0x0E, 0x0C, 
-    0x0E, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0B, 0x0B, 
-    0x0E, 0x0E, 0x0E, 0x0C, 0x0E, 0x0F, 0x0B, 0x01, 0x0E, 0x0C, 0x0B, 0x0B, 
-    0x0F, 0x0F, 0x0E, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x56, 0x0F, 0x0E, 0x0E, 
-    0x0C, 0x0F, 0x0E, 0x0E, 0x0F, 0x0E, 0x0C, 0x0E, 0x0C, 0x0C, 0x0E, 0x0B, 
-    0x0E, 0x0C, 0x0C, 0x0F, 0x0B, 0x0E, 0x0E, 0x0C, 0x0F, 0x0E, 0x0C, 0x0E, 
-    0x0C, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0E, 0x1A, 0x1F, 0x26, 0x43, 0x3E, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x1F, 0x0C, 0x1F, 0x01, 0x01, 0x0B, 0x0C, 
-    0x1A, 0x17, 0x19, 0x17, 0x01, 0x01, 0x0E, 0x17, 0x19, 0x19, 0x1B, 0x19, 
-    0x01, 0x01, 0x0C, 0x1A, 0x0F, 0x1E, 0x17, 0x19, 0x01, 0x01, 0x0C, 0x0E, 
-    0x0E, 0x19, 0x41, 0x41, 0x01, 0x0B, 0x0B, 0x0C, 0x17, 0x69, 0x54, 0x69, 
-    0x01, 0x01, 0x01, 0x0C, 0x35, 0x43, 0x69, 0x41, 0x3F, 0x60, 0x5D, 0x26, 
-    0x42, 0x19, 0x0B, 0x0C, 0x37, 0x37, 0x26, 0x19, 0x42, 0x17, 0x1E, 0x0E, 
-    0x0F, 0x21, 0x38, 0x26, 0x42, 0x1A, 0x01, 0x0E, 0x16, 0x3E, 0x3E, 0x3E, 
-    0x42, 0x42, 0x39, 0x0B, 0x69, 0x69, 0x41, 0x41, 0x3E, 0x90, 0x36, 0x25, 
-    0x41, 0x41, 0x43, 0x3F, 0x3F, 0x7D, 0x40, 0x2D, 0x41, 0x43, 0x3E, 0x3F, 
-    0x5D, 0x90, 0x66, 0x25, 0x41, 0x3F, 0x6A, 0x7E, 0x82, 0x97, 0x36, 0x25, 
-    0x0C, 0x0E, 0x20, 0x16, 0x0C, 0x18, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x0F, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x0C, 0x0C, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 
-    0x0C, 0x0C, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0E, 0x0E, 0x0E, 0x0C, 
-    0x0C, 0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0F, 0x0E, 0x0C, 0x0E, 0x0E, 0x0C, 
-    0x34, 0x24, 0x0F, 0x0E, 0x0C, 0x0E, 0x0E, 0x0C, 0x24, 0x25, 0x0F, 0x0E, 
-    0x0C, 0x0E, 0x0E, 0x0E, 0x0C, 0x0B, 0x0C, 0x0E, 0x0E, 0x10, 0x0F, 0x0F, 
-    0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x23, 0x10, 
-    0x0F, 0x0F, 0x17, 0x19, 0x10, 0x0F, 0x10, 0x0F, 0x17, 0x35, 0x21, 0x20, 
-    0x23, 0x0F, 0x0F, 0x1A, 0x17, 0x26, 0x21, 0x0E, 0x0F, 0x17, 0x35, 0x37, 
-    0x26, 0x16, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x19, 0x16, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x25, 0x0E, 0x0F, 0x0F, 0x0E, 0x2E, 0x2E, 0x2E, 
-    0x4A, 0x53, 0x50, 0x73, 0x0E, 0x2E, 0x2E, 0x2E, 0x4A, 0x53, 0x32, 0x32, 
-    0x0E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x0E, 0x2E, 0x2E, 0x2E, 
-    0x56, 0x2E, 0x2E, 0x56, 0x0E, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x2E, 0x2E, 
-    0x0F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x0F, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x10, 0x10, 0x2E, 0x0E, 0x2E, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x67, 0x32, 0x32, 0x50, 0x75, 0x75, 0x4D, 0x4D, 0x32, 0x53, 0x50, 0x52, 
-    0x73, 0x74, 0x2E, 0x24, 0x2E, 0x4E, 0x73, 0x68, 0x53, 0x2E, 0x78, 0x73, 
-    0x56, 0x32, 0x78, 0x32, 0x4A, 0x2E, 0x52, 0x76, 0x2E, 0x2E, 0x4D, 0x32, 
-    0x53, 0x4D, 0x73, 0x68, 0x2E, 0x2E, 0x32, 0x78, 0x4E, 0x4E, 0x78, 0x74, 
-    0x2E, 0x2E, 0x50, 0x50, 0x32, 0x53, 0x50, 0x4D, 0x4A, 0x4A, 0x50, 0x32, 
-    0x2E, 0x4A, 0x68, 0x73, 0x56, 0x2E, 0x74, 0x72, 0x52, 0x52, 0x74, 0x50, 
-    0x2E, 0x53, 0x74, 0x4A, 0x4E, 0x73, 0x74, 0x4A, 0x4A, 0x32, 0x50, 0x2D, 
-    0x53, 0x73, 0x74, 0x2E, 0x4A, 0x32, 0x74, 0x56, 0x32, 0x73, 0x74, 0x4A, 
-    0x4A, 0x4D, 0x4E, 0x2D, 0x32, 0x52, 0x74, 0x4A, 0x2E, 0x2E, 0x2E, 0x24, 
-    0x50, 0x73, 0x74, 0x2E, 0x56, 0x2E, 0x2E, 0x24, 0x50, 0x73, 0x74, 0x2E, 
-    0x24, 0x2E, 0x2E, 0x24, 0x32, 0x73, 0x32, 0x4A, 0x32, 0x4E, 0x50, 0x50, 
-    0x32, 0x78, 0x77, 0x78, 0x53, 0x32, 0x32, 0x32, 0x50, 0x50, 0x78, 0x78, 
-    0x4E, 0x32, 0x32, 0x32, 0x50, 0x32, 0x50, 0x78, 0x50, 0x78, 0x74, 0x50, 
-    0x32, 0x32, 0x78, 0x73, 0x32, 0x78, 0x52, 0x72, 0x32, 0x32, 0x52, 0x75, 
-    0x50, 0x50, 0x32, 0x32, 0x50, 0x78, 0x52, 0x75, 0x50, 0x32, 0x32, 0x32, 
-    0x50, 0x74, 0x52, 0x75, 0x74, 0x32, 0x4E, 0x74, 0x78, 0x74, 0x77, 0x73, 
-    0x74, 0x72, 0x77, 0x77, 0x77, 0x67, 0x73, 0x75, 0x77, 0x77, 0x74, 0x77, 
-    0x77, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77, 0x77, 0x73, 0x77, 0x73, 0x75, 
-    0x73, 0x77, 0x77, 0x73, 0x77, 0x77, 0x73, 0x73, 0x73, 0x77, 0x9F, 0x73, 
-    0x77, 0x77, 0x77, 0x73, 0x73, 0x77, 0x73, 0x74, 0x74, 0x73, 0x73, 0x75, 
-    0x73, 0x77, 0x73, 0x75, 0x73, 0x73, 0x73, 0x9E, 0x76, 0x73, 0x73, 0x91, 
-    0x76, 0x77, 0x73, 0x75, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x75, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x75, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 
-    0x75, 0x9E, 0x9E, 0x9E, 0xAD, 0x9E, 0x9E, 0x79, 0x9E, 0x75, 0x9E, 0x9E, 
-    0x9E, 0xAD, 0x9F, 0x88, 0x9E, 0x75, 0x9E, 0x9E, 0x9E, 0x9E, 0x68, 0x88, 
-    0x75, 0x9E, 0x9E, 0x9E, 0xAD, 0x9F, 0x99, 0x8A, 0x9E, 0x73, 0xAD, 0xA5, 
-    0xBC, 0xCE, 0x8A, 0x41, 0x9E, 0x9F, 0x8E, 0xCE, 0x8A, 0x43, 0x1B, 0x17, 
-    0xAD, 0x89, 0x8A, 0x5C, 0x3F, 0x37, 0x17, 0x1F, 0x76, 0xCE, 0x8A, 0x37, 
-    0x3E, 0x17, 0x1F, 0x0E, 0xCF, 0x99, 0x41, 0x3B, 0x41, 0x17, 0x18, 0x0E, 
-    0xCE, 0x35, 0x35, 0x30, 0x41, 0x16, 0x01, 0x0F, 0x47, 0x3B, 0x3B, 0x1F, 
-    0x16, 0x0E, 0x01, 0x0E, 0x35, 0x17, 0x19, 0x0E, 0x0B, 0x0B, 0x0B, 0x0E, 
-    0x26, 0x26, 0x43, 0x26, 0x35, 0x69, 0x26, 0x35, 0x17, 0x17, 0x17, 0x17, 
-    0x35, 0x35, 0x3B, 0x17, 0x1F, 0x0C, 0x0C, 0x19, 0x26, 0x3B, 0x1A, 0x17, 
-    0x18, 0x18, 0x30, 0x17, 0x17, 0x17, 0x17, 0x17, 0x23, 0x17, 0x30, 0x17, 
-    0x17, 0x17, 0x17, 0x17, 0x63, 0x47, 0x1A, 0x17, 0x17, 0x17, 0x30, 0x17, 
-    0x30, 0x30, 0x17, 0x17, 0x30, 0x17, 0x17, 0x30, 0x1A, 0x17, 0x17, 0x17, 
-    0x17, 0x30, 0x17, 0x17, 0x35, 0x35, 0x35, 0x41, 0x41, 0x99, 0xCF, 0xA3, 
-    0x17, 0x1A, 0x1A, 0x3B, 0x3B, 0x35, 0x41, 0xCF, 0x17, 0x17, 0x17, 0x1F, 
-    0x34, 0x3B, 0x3B, 0x47, 0x17, 0x1F, 0x62, 0x8A, 0x88, 0x51, 0x25, 0x35, 
-    0x30, 0x1F, 0x2E, 0x3D, 0x3D, 0x13, 0x1F, 0x17, 0x17, 0x16, 0x0E, 0x25, 
-    0x0C, 0x0E, 0x0C, 0x1F, 0x17, 0x30, 0x1F, 0x0E, 0x0C, 0x0C, 0x0B, 0x0B, 
-    0x30, 0x30, 0x1A, 0x1A, 0x0C, 0x0C, 0x0C, 0x0C, 0xAA, 0xB0, 0xB3, 0xAF, 
-    0x3A, 0x44, 0x3B, 0x3B, 0xAF, 0xB3, 0xB3, 0xB1, 0x3A, 0x44, 0x38, 0x3B, 
-    0x99, 0xBD, 0xAF, 0xAF, 0x3A, 0x44, 0x37, 0x3B, 0x41, 0xD7, 0xAF, 0xAA, 
-    0xD8, 0x57, 0x60, 0x38, 0x47, 0x99, 0xD7, 0xAA, 0xAF, 0x54, 0x8F, 0x6F, 
-    0x17, 0x17, 0x63, 0xAF, 0xA4, 0x74, 0x35, 0x57, 0x0C, 0x30, 0x19, 0xD7, 
-    0x79, 0x34, 0x34, 0x30, 0x0B, 0x0E, 0x10, 0x2E, 0x0F, 0x0B, 0x0B, 0x0C, 
-    0x38, 0x87, 0xA9, 0xB1, 0xC3, 0xC6, 0x82, 0x84, 0x38, 0x87, 0xA7, 0xBA, 
-    0xC3, 0xC6, 0xD9, 0xC9, 0x38, 0x54, 0xB1, 0xBA, 0xC3, 0xC6, 0xC3, 0xDA, 
-    0x17, 0x17, 0x8A, 0xB2, 0xBA, 0xBE, 0xBB, 0xDB, 0x44, 0x38, 0x3E, 0x63, 
-    0xB6, 0xB4, 0xC6, 0xC3, 0x83, 0xDC, 0x8F, 0x1B, 0x3D, 0xB6, 0xB4, 0xC3, 
-    0x6F, 0xDD, 0xDD, 0xDC, 0xDC, 0x6B, 0xB6, 0xB2, 0x0B, 0x61, 0xDC, 0xDE, 
-    0xDD, 0xDE, 0x66, 0x92, 0x44, 0x30, 0x17, 0x30, 0x17, 0x44, 0x83, 0xD9, 
-    0x57, 0x39, 0x61, 0x61, 0x61, 0x95, 0xD9, 0xDA, 0xD2, 0xC0, 0xC0, 0xC0, 
-    0xC0, 0xDA, 0xDB, 0xC6, 0xDB, 0xDB, 0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xC3, 
-    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xBB, 0xB4, 0xBA, 0xC3, 0xC3, 0xC3, 0xC3, 
-    0xC3, 0xBA, 0xB9, 0xBC, 0xC3, 0xDB, 0xC3, 0xC3, 0xBB, 0xB1, 0xBD, 0x69, 
-    0xC4, 0xC3, 0xC3, 0xBE, 0xBA, 0xBC, 0x54, 0xDC, 0xDB, 0xDF, 0xAC, 0x92, 
-    0x1B, 0x3B, 0x1F, 0x38, 0xDB, 0xC6, 0xB2, 0xD6, 0x1B, 0x3B, 0x17, 0x37, 
-    0xDB, 0xC3, 0xBA, 0xCE, 0x35, 0x3B, 0x44, 0x57, 0xBB, 0xBA, 0xA0, 0x47, 
-    0x3B, 0x38, 0x6F, 0x60, 0xBA, 0x8E, 0x47, 0x35, 0x44, 0x6F, 0x84, 0x3F, 
-    0x99, 0x37, 0x8F, 0xDC, 0xDE, 0x6F, 0x38, 0x23, 0x8F, 0xDE, 0xDD, 0xDE, 
-    0x6F, 0x21, 0x1E, 0x25, 0xDD, 0xDE, 0x84, 0x40, 0x0C, 0x0B, 0x0C, 0x0B, 
-    0x69, 0xBD, 0xB3, 0xB3, 0xAA, 0x93, 0x8E, 0x3D, 0x69, 0xAA, 0xAA, 0xB3, 
-    0xB1, 0xCE, 0x99, 0x35, 0x63, 0xAF, 0xAA, 0xBD, 0xCE, 0x47, 0x35, 0x3B, 
-    0x63, 0xBD, 0xB1, 0xBD, 0x69, 0x35, 0x3B, 0x13, 0xB6, 0xAF, 0xBD, 0x8A, 
-    0x26, 0x3B, 0x34, 0x1A, 0x89, 0xAF, 0xCE, 0x17, 0x3B, 0x1F, 0x0C, 0x0E, 
-    0x53, 0x8E, 0x99, 0x3B, 0x0E, 0x0B, 0x0B, 0x0C, 0x0E, 0x2E, 0x13, 0x0C, 
-    0x0B, 0x0C, 0x0C, 0x0C, 0x69, 0x41, 0x26, 0x47, 0x26, 0x26, 0x26, 0x41, 
-    0x35, 0x3B, 0x1A, 0x3B, 0x3B, 0x3B, 0x17, 0x26, 0x34, 0x34, 0x1A, 0x30, 
-    0x17, 0x17, 0x1A, 0x17, 0x99, 0x88, 0x67, 0x30, 0x17, 0x1A, 0x3B, 0x17, 
-    0x32, 0x77, 0x62, 0x30, 0x17, 0x17, 0x17, 0x17, 0x0C, 0x0C, 0x30, 0x17, 
-    0x17, 0x30, 0x17, 0x17, 0x0C, 0x1F, 0x30, 0x17, 0x17, 0x30, 0x17, 0x30, 
-    0x0B, 0x30, 0x17, 0x30, 0x17, 0x17, 0x17, 0x17, 0x35, 0x35, 0x43, 0x43, 
-    0x26, 0x41, 0x8A, 0xCD, 0x26, 0x3B, 0x1A, 0x30, 0x1A, 0x30, 0x38, 0x3F, 
-    0x35, 0x19, 0x0C, 0x0B, 0x0C, 0x1E, 0x1A, 0x38, 0x17, 0x17, 0x1F, 0x0E, 
-    0x0C, 0x0E, 0x17, 0x17, 0x17, 0x17, 0x1A, 0x0F, 0x62, 0x34, 0x0E, 0x1F, 
-    0x17, 0x17, 0x30, 0x62, 0x99, 0x56, 0x0B, 0x18, 0x30, 0x30, 0x1A, 0x1A, 
-    0x34, 0x0E, 0x0B, 0x0B, 0x30, 0x30, 0x17, 0x17, 0x1A, 0x1F, 0x0C, 0x0C, 
-    0x8E, 0x68, 0x75, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xE0, 0xCE, 0x88, 0x9E, 
-    0x9E, 0xAD, 0x9E, 0x9E, 0x5D, 0x5D, 0x54, 0x96, 0x9E, 0x75, 0x76, 0x76, 
-    0x37, 0x44, 0x54, 0xCD, 0x79, 0x9F, 0x75, 0x75, 0x26, 0x17, 0x26, 0x54, 
-    0xCF, 0x91, 0x9F, 0x9E, 0x22, 0x17, 0x3B, 0x35, 0x8A, 0xCF, 0x9F, 0x9E, 
-    0x21, 0x0F, 0x34, 0x1A, 0x20, 0x8A, 0x68, 0x9E, 0x0B, 0x1F, 0x17, 0x1F, 
-    0x30, 0x54, 0xD8, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0xAD, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xAD, 0x9E, 0x9E, 0xAD, 
-    0xAD, 0x9E, 0x9F, 0x73, 0x9E, 0xAD, 0x76, 0x9E, 0xAD, 0x9E, 0x73, 0x73, 
-    0x9E, 0x76, 0xAD, 0xAD, 0x9E, 0x75, 0x73, 0x77, 0x76, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x75, 0x73, 0x77, 0x75, 0x9E, 0x75, 0x9E, 0x9E, 0x75, 0x73, 0x77, 
-    0x9E, 0x75, 0x75, 0x9E, 0x9E, 0x75, 0x77, 0x77, 0x73, 0x77, 0x77, 0x77, 
-    0x77, 0x77, 0x77, 0x78, 0x73, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x77, 0x77, 0x74, 0x77, 
-    0x73, 0x77, 0x78, 0x74, 0x77, 0x77, 0x77, 0x72, 0x73, 0x77, 0x78, 0x78, 
-    0x77, 0x77, 0x77, 0x74, 0x77, 0x77, 0x52, 0x50, 0x77, 0x73, 0x77, 0x52, 
-    0x52, 0x73, 0x9E, 0x78, 0x73, 0x77, 0x52, 0x91, 0x76, 0x72, 0x72, 0x78, 
-    0x32, 0x78, 0x77, 0x74, 0x72, 0x4E, 0x52, 0x68, 0x32, 0x50, 0x74, 0x74, 
-    0x78, 0x4E, 0x68, 0x91, 0x32, 0x32, 0x50, 0x52, 0x73, 0x4E, 0x68, 0x91, 
-    0x50, 0x32, 0x50, 0x76, 0x76, 0x50, 0x76, 0x76, 0x50, 0x50, 0x50, 0x76, 
-    0x75, 0x4E, 0x76, 0x76, 0x50, 0x50, 0x50, 0x72, 0x50, 0x53, 0x76, 0x76, 
-    0x50, 0x50, 0x72, 0x52, 0x4E, 0x4E, 0x79, 0x91, 0x32, 0x50, 0x73, 0x75, 
-    0x50, 0x50, 0x73, 0x75, 0x78, 0x32, 0x32, 0x56, 0x56, 0x10, 0x0F, 0x0E, 
-    0x78, 0x4E, 0x53, 0x24, 0x56, 0x10, 0x0F, 0x0F, 0x78, 0x50, 0x4E, 0x24, 
-    0x56, 0x24, 0x24, 0x24, 0x78, 0x78, 0x72, 0x53, 0x2E, 0x56, 0x2E, 0x2E, 
-    0x78, 0x72, 0x73, 0x32, 0x2E, 0x2E, 0x32, 0x53, 0x72, 0x73, 0x79, 0x50, 
-    0x2E, 0x56, 0x32, 0x32, 0x72, 0x52, 0x68, 0x67, 0x2E, 0x56, 0x53, 0x53, 
-    0x73, 0x78, 0x9F, 0x68, 0x53, 0x2E, 0x56, 0x56, 0x24, 0x4A, 0x32, 0x32, 
-    0x4A, 0x0F, 0x0E, 0x0F, 0x56, 0x77, 0x50, 0x32, 0x2E, 0x0F, 0x0E, 0x24, 
-    0x4A, 0x68, 0x78, 0x2E, 0x24, 0x0F, 0x0F, 0x24, 0x4A, 0x78, 0x4A, 0x0F, 
-    0x0E, 0x0F, 0x0F, 0x56, 0x32, 0x4E, 0x2E, 0x0F, 0x0E, 0x0F, 0x56, 0x2E, 
-    0x68, 0x72, 0x32, 0x4A, 0x0F, 0x0F, 0x56, 0x56, 0x73, 0x74, 0x53, 0x2E, 
-    0x0F, 0x0F, 0x24, 0x24, 0x74, 0x73, 0x4E, 0x2E, 0x0F, 0x0F, 0x24, 0x2E, 
-    0x23, 0x10, 0x10, 0x0F, 0x0F, 0x0E, 0x0E, 0x24, 0x2E, 0x10, 0x56, 0x56, 
-    0x0F, 0x0E, 0x0E, 0x0F, 0x0E, 0x0F, 0x23, 0x23, 0x23, 0x0F, 0x0F, 0x10, 
-    0x56, 0x0F, 0x10, 0x23, 0x2E, 0x56, 0x0F, 0x10, 0x32, 0x2E, 0x0F, 0x0F, 
-    0x0F, 0x0F, 0x56, 0x10, 0x2E, 0x56, 0x0F, 0x0F, 0x0F, 0x0F, 0x24, 0x24, 
-    0x24, 0x0F, 0x0F, 0x24, 0x24, 0x56, 0x0F, 0x0F, 0x4A, 0x2E, 0x2E, 0x4A, 
-    0x56, 0x0F, 0x24, 0x24, 0x73, 0x79, 0x8C, 0x76, 0x75, 0x77, 0x53, 0x4A, 
-    0x56, 0x2D, 0x68, 0x91, 0x96, 0x75, 0x32, 0x32, 0x0E, 0x0E, 0x50, 0x75, 
-    0x73, 0x74, 0x2E, 0x56, 0x10, 0x10, 0x24, 0x0E, 0x0E, 0x0E, 0x0C, 0x0C, 
-    0x2E, 0x2E, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x24, 0x0F, 0x0F, 0x56, 
-    0x56, 0x24, 0x24, 0x0F, 0x0F, 0x0F, 0x56, 0x56, 0x56, 0x56, 0x0F, 0x0E, 
-    0x56, 0x24, 0x2E, 0x53, 0x53, 0x4A, 0x56, 0x56, 0x2E, 0x56, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0C, 0x0C, 0x2E, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x0C, 0x0C, 
-    0x0F, 0x0E, 0x0F, 0x24, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F, 0x2E, 0x56, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x56, 0x2E, 0x56, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0F, 0x56, 0x10, 0x0F, 0x0E, 0x1A, 0x1A, 0x0E, 0x0E, 0x24, 0x0F, 0x0E, 
-    0x0E, 0x17, 0x16, 0x0E, 0x24, 0x10, 0x2E, 0x56, 0x0F, 0x17, 0x20, 0x10, 
-    0x0F, 0x0F, 0x0E, 0x0F, 0x0F, 0x0C, 0x0C, 0x0B, 0x10, 0x0F, 0x0E, 0x0F, 
-    0x0E, 0x0C, 0x0C, 0x0B, 0x0E, 0x0E, 0x0E, 0x0F, 0x0C, 0x0C, 0x0C, 0x0E, 
-    0x0E, 0x0E, 0x0F, 0x10, 0x0C, 0x0C, 0x0F, 0x24, 0x0F, 0x10, 0x10, 0x0E, 
-    0x0C, 0x0C, 0x0F, 0x56, 0x10, 0x19, 0x0F, 0x0B, 0x0C, 0x0E, 0x0F, 0x2E, 
-    0x10, 0x10, 0x0E, 0x0C, 0x0E, 0x0F, 0x56, 0x2E, 0x0E, 0x0C, 0x0E, 0x0E, 
-    0x0E, 0x0F, 0x2E, 0x2E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x16, 0x35, 0x26, 0x3B, 0x01, 0x01, 0x01, 0x01, 
-    0x0E, 0x1F, 0x21, 0x41, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x0E, 0x0F, 0x69, 
-    0x01, 0x01, 0x01, 0x0B, 0x0F, 0x3D, 0x20, 0x42, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0B, 0x18, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0F, 
-    0x01, 0x01, 0x01, 0x01, 0x0E, 0x19, 0x1F, 0x22, 0x01, 0x01, 0x01, 0x0B, 
-    0x0C, 0x0E, 0x0F, 0x0E, 0x26, 0x59, 0x7E, 0x7E, 0x5E, 0x97, 0x66, 0x25, 
-    0x26, 0x3E, 0x60, 0x83, 0x7E, 0x97, 0x66, 0x1E, 0x41, 0x34, 0x43, 0x6A, 
-    0x83, 0x90, 0x66, 0x25, 0x20, 0x19, 0x3F, 0x59, 0x7E, 0x82, 0x45, 0x2D, 
-    0x0E, 0x17, 0x19, 0x35, 0x35, 0x26, 0x0F, 0x2D, 0x0C, 0x21, 0x40, 0x40, 
-    0x36, 0x40, 0x21, 0x0F, 0x38, 0x60, 0x82, 0x7E, 0x7E, 0x7D, 0x90, 0x0E, 
-    0x20, 0x42, 0x3F, 0x3F, 0x5D, 0x5F, 0x97, 0x0E, 0x24, 0x0E, 0x24, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x2E, 0x24, 0x56, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 
-    0x2E, 0x0F, 0x2E, 0x0E, 0x0C, 0x0E, 0x56, 0x24, 0x2E, 0x0B, 0x10, 0x0E, 
-    0x0E, 0x0E, 0x0F, 0x56, 0x13, 0x0E, 0x56, 0x0E, 0x0F, 0x0E, 0x10, 0x56, 
-    0x2E, 0x0E, 0x56, 0x0E, 0x56, 0x24, 0x56, 0x56, 0x24, 0x0C, 0x0F, 0x0E, 
-    0x0F, 0x56, 0x56, 0x10, 0x25, 0x0B, 0x0E, 0x0C, 0x0F, 0x10, 0x2E, 0x10, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x56, 0x2E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x24, 0x2E, 
-    0x24, 0x2E, 0x4A, 0x56, 0x24, 0x0E, 0x0E, 0x0F, 0x2E, 0x67, 0x74, 0x56, 
-    0x2E, 0x0F, 0x0E, 0x0E, 0x4A, 0x76, 0x77, 0x24, 0x2E, 0x0F, 0x0E, 0x0E, 
-    0x56, 0x77, 0x32, 0x24, 0x56, 0x24, 0x0E, 0x0E, 0x0F, 0x24, 0x0F, 0x2E, 
-    0x2E, 0x56, 0x0F, 0x0C, 0x0E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x53, 
-    0x56, 0x10, 0x2E, 0x2E, 0x23, 0x23, 0x53, 0x50, 0x2E, 0x2E, 0x2E, 0x4A, 
-    0x53, 0x4E, 0x77, 0x76, 0x53, 0x2E, 0x53, 0x73, 0x32, 0x32, 0x67, 0x75, 
-    0x2E, 0x53, 0x2E, 0x4A, 0x24, 0x0E, 0x24, 0x24, 0x0E, 0x0F, 0x0E, 0x0F, 
-    0x0F, 0x0F, 0x10, 0x10, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x20, 0x69, 
-    0x0E, 0x0F, 0x10, 0x23, 0x19, 0x62, 0x67, 0x3D, 0x32, 0x53, 0x32, 0x53, 
-    0x2E, 0x2E, 0x76, 0x9F, 0x50, 0x53, 0x4D, 0x2E, 0x2E, 0x4A, 0x68, 0x52, 
-    0x78, 0x53, 0x4A, 0x56, 0x2E, 0x4E, 0x76, 0x74, 0x4D, 0x2E, 0x4A, 0x56, 
-    0x4A, 0x76, 0x75, 0x24, 0x24, 0x24, 0x24, 0x24, 0x53, 0x88, 0x75, 0x24, 
-    0x10, 0x10, 0x10, 0x20, 0x32, 0x79, 0x4A, 0x0F, 0x69, 0x3D, 0x3D, 0x69, 
-    0x53, 0x79, 0x56, 0x24, 0x3D, 0x67, 0x3D, 0x62, 0x4A, 0x4E, 0x56, 0x24, 
-    0x24, 0x2E, 0x2E, 0x24, 0x32, 0x73, 0x78, 0x2E, 0x24, 0x2E, 0x2E, 0x24, 
-    0x32, 0x73, 0x78, 0x56, 0x24, 0x2E, 0x2E, 0x24, 0x32, 0x73, 0x72, 0x2E, 
-    0x53, 0x53, 0x2E, 0x24, 0x4A, 0x77, 0x74, 0x2E, 0x4A, 0x53, 0x2E, 0x24, 
-    0x56, 0x78, 0x74, 0x2E, 0x2E, 0x2E, 0x56, 0x0F, 0x56, 0x4A, 0x53, 0x2E, 
-    0x56, 0x24, 0x0E, 0x0F, 0x56, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x0E, 0x56, 
-    0x4A, 0x4A, 0x2E, 0x4A, 0x53, 0x32, 0x50, 0x78, 0x32, 0x74, 0x52, 0x9F, 
-    0x2E, 0x53, 0x32, 0x32, 0x74, 0x74, 0x52, 0x73, 0x2E, 0x53, 0x50, 0x50, 
-    0x78, 0x52, 0x52, 0x77, 0x2E, 0x4E, 0x78, 0x78, 0x78, 0x52, 0x52, 0x73, 
-    0x2E, 0x4E, 0x78, 0x50, 0x50, 0x74, 0x74, 0x73, 0x2E, 0x4E, 0x78, 0x32, 
-    0x78, 0x74, 0x74, 0x77, 0x2E, 0x4D, 0x74, 0x32, 0x78, 0x52, 0x74, 0x67, 
-    0x4A, 0x4E, 0x50, 0x4E, 0x32, 0x77, 0x52, 0x75, 0x89, 0x73, 0x74, 0x76, 
-    0x75, 0x73, 0x77, 0x73, 0x75, 0x73, 0x73, 0x77, 0x73, 0x73, 0x73, 0x9E, 
-    0x74, 0x73, 0x73, 0x73, 0x77, 0x77, 0x9F, 0x9E, 0x73, 0x77, 0x73, 0x77, 
-    0x77, 0x73, 0x9F, 0x9E, 0x73, 0x52, 0x77, 0x77, 0x77, 0x73, 0x73, 0x9F, 
-    0x73, 0x77, 0x74, 0x74, 0x77, 0x73, 0x73, 0x9F, 0x73, 0x73, 0x73, 0x77, 
-    0x77, 0x73, 0x73, 0x9F, 0x67, 0x73, 0x76, 0x73, 0x77, 0x73, 0x9F, 0x9F, 
-    0x75, 0x9E, 0x9E, 0x9E, 0x9E, 0x8C, 0xCF, 0x43, 0x9E, 0x75, 0x75, 0x9E, 
-    0x9E, 0x8E, 0x99, 0x17, 0x9E, 0x9E, 0x9E, 0x9E, 0xAD, 0x54, 0x3E, 0x3B, 
-    0x75, 0x75, 0x9E, 0x9E, 0xAD, 0x5C, 0x6F, 0x19, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0xAD, 0x42, 0x57, 0x19, 0x9E, 0x75, 0x9E, 0x9E, 0xAD, 0x5C, 0x58, 0x1F, 
-    0x9E, 0x75, 0x9E, 0xAD, 0x9E, 0x5C, 0x57, 0x0C, 0x75, 0x9E, 0x9E, 0x9E, 
-    0xAD, 0x62, 0x17, 0x1F, 0x17, 0x17, 0x38, 0x30, 0x0B, 0x0B, 0x0C, 0x1F, 
-    0x17, 0x17, 0x38, 0x18, 0x0B, 0x0C, 0x1F, 0x30, 0x17, 0x16, 0x1A, 0x0B, 
-    0x18, 0x1F, 0x30, 0x17, 0x35, 0x0C, 0x1F, 0x1F, 0x1F, 0x30, 0x17, 0x17, 
-    0x26, 0x0C, 0x1F, 0x30, 0x30, 0x30, 0x30, 0x17, 0x30, 0x1F, 0x30, 0x1B, 
-    0x1B, 0x1B, 0x38, 0x17, 0x0B, 0x1F, 0x38, 0x3F, 0x3F, 0x5C, 0x37, 0x1A, 
-    0x18, 0x30, 0x30, 0x1A, 0x1A, 0x30, 0x17, 0x17, 0x3B, 0x3B, 0x30, 0x30, 
-    0x1A, 0x17, 0x30, 0x30, 0x17, 0x17, 0x17, 0x17, 0x30, 0x17, 0x17, 0x17, 
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x35, 0x35, 0x17, 0x17, 0x17, 0x17, 
-    0x17, 0x17, 0x17, 0x1B, 0x17, 0x30, 0x17, 0x17, 0x30, 0x38, 0x17, 0x3F, 
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x3E, 0x6A, 0x83, 0x17, 0x30, 0x3B, 0x1B, 
-    0x44, 0x6A, 0x9A, 0x9A, 0x17, 0x30, 0x17, 0x6F, 0x7F, 0x9A, 0x9A, 0x9B, 
-    0x30, 0x1A, 0x1A, 0x1A, 0x0C, 0x0C, 0x0C, 0x0C, 0x17, 0x17, 0x17, 0x17, 
-    0x17, 0x17, 0x1F, 0x0C, 0x35, 0x35, 0x35, 0x35, 0x3B, 0x17, 0x17, 0x18, 
-    0x1B, 0x1B, 0x35, 0x35, 0x19, 0x19, 0x17, 0x17, 0x83, 0x83, 0x83, 0x1B, 
-    0x35, 0x35, 0x17, 0x17, 0xDE, 0xDE, 0xDD, 0x6A, 0x60, 0x3E, 0x17, 0x17, 
-    0x9A, 0x9A, 0x7F, 0x83, 0xDD, 0x7E, 0x60, 0x57, 0x9B, 0x9B, 0x9B, 0x65, 
-    0x9A, 0x7E, 0x7E, 0x6A, 0x0C, 0x0C, 0x0E, 0x0B, 0x01, 0x01, 0x0C, 0x1F, 
-    0x0B, 0x0B, 0x0C, 0x0C, 0x01, 0x0B, 0x0B, 0x18, 0x18, 0x01, 0x0C, 0x0B, 
-    0x0B, 0x01, 0x0B, 0x18, 0x0E, 0x01, 0x0C, 0x0B, 0x0B, 0x01, 0x0B, 0x1F, 
-    0x0E, 0x0C, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x0B, 0x17, 0x18, 0x01, 0x01, 
-    0x01, 0x0B, 0x0B, 0x01, 0x30, 0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x01, 
-    0x38, 0x39, 0x0B, 0x0B, 0x0B, 0x0B, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x61, 
-    0xDC, 0xDD, 0xDE, 0x5B, 0x0C, 0x0B, 0x0B, 0x01, 0x01, 0xE1, 0xDD, 0x66, 
-    0x1F, 0x0C, 0x0C, 0x0B, 0x0B, 0x01, 0xDC, 0x65, 0x1F, 0x18, 0x18, 0x18, 
-    0x01, 0x01, 0x39, 0x84, 0x18, 0x1F, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x39, 
-    0x0C, 0x1F, 0x18, 0x18, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x18, 0x1F, 0x1F, 
-    0x18, 0x0B, 0x01, 0x0C, 0x0B, 0x0C, 0x18, 0x1F, 0x18, 0x0C, 0x0B, 0x0C, 
-    0xB6, 0xC3, 0xDB, 0xB4, 0xAB, 0x99, 0x84, 0xDE, 0x8B, 0xB2, 0xBB, 0xB1, 
-    0xB6, 0x59, 0xDE, 0x66, 0xD5, 0x92, 0xBA, 0xA3, 0x63, 0xDD, 0xE1, 0x18, 
-    0xDC, 0xE0, 0xBA, 0xCE, 0x8F, 0x6F, 0x18, 0x01, 0xE2, 0x9C, 0x64, 0xE3, 
-    0x84, 0x45, 0x01, 0x0B, 0x45, 0x71, 0x71, 0x71, 0x45, 0x01, 0x01, 0x0B, 
-    0x25, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x18, 0x0B, 0x0C, 0x01, 0x01, 0x01, 
-    0x0B, 0x0C, 0x18, 0x0B, 0xDC, 0x61, 0x0B, 0x01, 0x01, 0x0C, 0x0C, 0x0B, 
-    0x18, 0x01, 0x01, 0x0B, 0x0C, 0x18, 0x0C, 0x01, 0x0B, 0x0B, 0x0B, 0x0B, 
-    0x18, 0x18, 0x0C, 0x0B, 0x01, 0x0B, 0x0B, 0x18, 0x30, 0x18, 0x0B, 0x0B, 
-    0x01, 0x01, 0x0C, 0x30, 0x1F, 0x0C, 0x01, 0x01, 0x01, 0x0C, 0x18, 0x1F, 
-    0x18, 0x0B, 0x01, 0x01, 0x0C, 0x18, 0x1F, 0x1F, 0x0B, 0x01, 0x01, 0x01, 
-    0x1F, 0x30, 0x1F, 0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x01, 0x0B, 0x17, 0x0B, 
-    0x0B, 0x0B, 0x0B, 0x0C, 0x01, 0x0B, 0x0F, 0x0B, 0x01, 0x0B, 0x1A, 0x17, 
-    0x01, 0x01, 0x0E, 0x0C, 0x0B, 0x0C, 0x17, 0x17, 0x01, 0x01, 0x0C, 0x0B, 
-    0x18, 0x17, 0x17, 0x19, 0x0B, 0x01, 0x01, 0x01, 0x18, 0x17, 0x3B, 0x35, 
-    0x01, 0x01, 0x01, 0x18, 0x17, 0x17, 0x17, 0x44, 0x01, 0x01, 0x0B, 0x18, 
-    0x1A, 0x1B, 0x6A, 0x6A, 0x0C, 0x01, 0x01, 0x18, 0x38, 0x8F, 0x83, 0x83, 
-    0x0C, 0x30, 0x30, 0x30, 0x30, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 
-    0x3B, 0x17, 0x17, 0x17, 0x17, 0x19, 0x17, 0x17, 0x35, 0x35, 0x35, 0x17, 
-    0x19, 0x17, 0x35, 0x1B, 0x1B, 0x35, 0x35, 0x17, 0x35, 0x35, 0x3F, 0x60, 
-    0x6A, 0x60, 0x1B, 0x35, 0x6A, 0x6A, 0x83, 0xDE, 0x83, 0x83, 0x83, 0x6A, 
-    0xDE, 0xDE, 0x7F, 0x9A, 0x9A, 0x9A, 0x7F, 0x7F, 0x7F, 0x9A, 0x9B, 0x9B, 
-    0x9B, 0x9B, 0x9A, 0x9A, 0x30, 0x17, 0x17, 0x30, 0x30, 0x30, 0x0C, 0x0C, 
-    0x30, 0x17, 0x30, 0x30, 0x17, 0x30, 0x1F, 0x18, 0x17, 0x17, 0x30, 0x17, 
-    0x17, 0x30, 0x30, 0x30, 0x17, 0x30, 0x17, 0x17, 0x30, 0x17, 0x17, 0x17, 
-    0x17, 0x17, 0x30, 0x30, 0x17, 0x17, 0x17, 0x30, 0x35, 0x3B, 0x17, 0x17, 
-    0x17, 0x30, 0x38, 0x1B, 0x60, 0x1B, 0x17, 0x30, 0x17, 0x30, 0x38, 0x42, 
-    0x7F, 0x6A, 0x1B, 0x17, 0x17, 0x17, 0x1A, 0x30, 0x0B, 0x18, 0x3B, 0x3B, 
-    0x16, 0x37, 0x88, 0x8C, 0x0B, 0x0B, 0x1A, 0x19, 0x1A, 0x1A, 0x99, 0x8E, 
-    0x18, 0x0C, 0x1F, 0x1A, 0x38, 0x17, 0x45, 0x87, 0x30, 0x18, 0x0C, 0x0B, 
-    0x1B, 0x35, 0x40, 0x59, 0x30, 0x30, 0x1F, 0x0C, 0x1B, 0x35, 0x1B, 0x59, 
-    0x1B, 0x1B, 0x17, 0x1F, 0x0E, 0x1A, 0x40, 0x82, 0x3F, 0x46, 0x1B, 0x1F, 
-    0x0C, 0x0C, 0x44, 0x59, 0x1A, 0x1A, 0x17, 0x17, 0x1F, 0x0E, 0x17, 0x19, 
-    0x9F, 0x75, 0x75, 0x75, 0x9E, 0x73, 0x73, 0x73, 0x9F, 0x9F, 0x9E, 0x75, 
-    0x9E, 0x73, 0x73, 0x77, 0x75, 0x9E, 0x9E, 0x9F, 0x9F, 0x73, 0x77, 0x77, 
-    0x75, 0x9E, 0x75, 0x9E, 0x9E, 0x73, 0x77, 0x77, 0x67, 0x9E, 0x9F, 0x9E, 
-    0x9E, 0x9F, 0x73, 0x73, 0x67, 0x9E, 0x9E, 0x75, 0x9E, 0x9F, 0x9F, 0x75, 
-    0x67, 0x9E, 0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x73, 0x9E, 0x75, 0x9E, 
-    0x9F, 0x75, 0x9F, 0x73, 0x73, 0x77, 0x9F, 0x8C, 0x89, 0x72, 0x32, 0x50, 
-    0x77, 0x77, 0x9F, 0x89, 0x91, 0x72, 0x50, 0x50, 0x73, 0x9F, 0x73, 0x9F, 
-    0x9F, 0x73, 0x52, 0x78, 0x77, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x52, 0x74, 
-    0x73, 0x9F, 0x9F, 0x9F, 0x73, 0x74, 0x73, 0x77, 0x75, 0x9F, 0x9F, 0x9F, 
-    0x52, 0x78, 0x52, 0x77, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x77, 0x52, 0x73, 
-    0x75, 0x75, 0x73, 0x9F, 0x9F, 0x52, 0x9F, 0x9F, 0x50, 0x78, 0x52, 0x9F, 
-    0x50, 0x50, 0x72, 0x75, 0x50, 0x50, 0x72, 0x9F, 0x50, 0x32, 0x74, 0x75, 
-    0x50, 0x50, 0x78, 0x73, 0x78, 0x4E, 0x78, 0x76, 0x50, 0x32, 0x50, 0x73, 
-    0x50, 0x4E, 0x78, 0x75, 0x50, 0x32, 0x50, 0x52, 0x32, 0x4E, 0x74, 0x74, 
-    0x50, 0x32, 0x50, 0x52, 0x32, 0x4E, 0x78, 0x74, 0x74, 0x32, 0x50, 0x72, 
-    0x32, 0x4A, 0x50, 0x78, 0x77, 0x74, 0x32, 0x78, 0x50, 0x4A, 0x53, 0x4A, 
-    0x68, 0x72, 0x52, 0x68, 0x75, 0x2E, 0x56, 0x0F, 0x76, 0x52, 0x74, 0x52, 
-    0x73, 0x32, 0x2E, 0x24, 0x91, 0x52, 0x52, 0x72, 0x75, 0x73, 0x72, 0x53, 
-    0x91, 0x73, 0x52, 0x50, 0x68, 0x79, 0x9F, 0x50, 0x72, 0x73, 0x73, 0x50, 
-    0x73, 0x9F, 0x68, 0x76, 0x78, 0x74, 0x74, 0x52, 0x52, 0x72, 0x52, 0x52, 
-    0x52, 0x72, 0x74, 0x73, 0x73, 0x72, 0x4E, 0x4D, 0x75, 0x91, 0x74, 0x74, 
-    0x73, 0x52, 0x74, 0x32, 0x2E, 0x74, 0x50, 0x4A, 0x0F, 0x56, 0x4A, 0x4A, 
-    0x2E, 0x74, 0x78, 0x2E, 0x0F, 0x2E, 0x53, 0x4A, 0x53, 0x73, 0x78, 0x2E, 
-    0x0F, 0x56, 0x53, 0x4A, 0x53, 0x75, 0x78, 0x2E, 0x0F, 0x56, 0x4A, 0x4A, 
-    0x78, 0x77, 0x32, 0x2E, 0x24, 0x24, 0x56, 0x2E, 0x74, 0x75, 0x72, 0x2E, 
-    0x56, 0x24, 0x24, 0x2E, 0x78, 0x89, 0x89, 0x78, 0x53, 0x2E, 0x24, 0x56, 
-    0x50, 0x68, 0x79, 0x52, 0x32, 0x4D, 0x56, 0x24, 0x4A, 0x4A, 0x4A, 0x53, 
-    0x56, 0x0F, 0x24, 0x24, 0x4A, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x2E, 0x2E, 
-    0x4A, 0x2E, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x4A, 0x2E, 0x56, 0x2E, 
-    0x2E, 0x56, 0x56, 0x56, 0x2E, 0x2E, 0x56, 0x56, 0x2E, 0x56, 0x56, 0x56, 
-    0x4A, 0x4D, 0x74, 0x74, 0x74, 0x53, 0x56, 0x24, 0x56, 0x2E, 0x32, 0x74, 
-    0x32, 0x53, 0x56, 0x0F, 0x0E, 0x24, 0x24, 0x2E, 0x2E, 0x56, 0x56, 0x2E, 
-    0x56, 0x56, 0x2E, 0x32, 0x32, 0x4A, 0x2E, 0x2E, 0x24, 0x56, 0x53, 0x74, 
-    0x78, 0x4E, 0x4A, 0x2E, 0x56, 0x4A, 0x32, 0x78, 0x77, 0x77, 0x32, 0x4A, 
-    0x56, 0x4A, 0x32, 0x74, 0x77, 0x78, 0x32, 0x53, 0x56, 0x53, 0x32, 0x78, 
-    0x78, 0x50, 0x53, 0x53, 0x56, 0x53, 0x32, 0x50, 0x77, 0x74, 0x4A, 0x56, 
-    0x24, 0x4A, 0x32, 0x50, 0x77, 0x32, 0x56, 0x0E, 0x2E, 0x53, 0x32, 0x77, 
-    0x74, 0x2E, 0x0F, 0x0E, 0x24, 0x0F, 0x56, 0x2E, 0x24, 0x0F, 0x19, 0x10, 
-    0x24, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x23, 0x56, 0x0F, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x23, 0x2E, 0x10, 0x0F, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 
-    0x56, 0x0F, 0x0E, 0x0E, 0x56, 0x10, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 
-    0x2E, 0x2E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x2E, 0x2E, 0x0F, 0x0F, 
-    0x0E, 0x0E, 0x0E, 0x0F, 0x56, 0x2E, 0x2E, 0x2E, 0x0E, 0x0C, 0x0E, 0x0E, 
-    0x0F, 0x2E, 0x2E, 0x2E, 0x0E, 0x0C, 0x0E, 0x0F, 0x56, 0x2E, 0x56, 0x0F, 
-    0x10, 0x0F, 0x0E, 0x56, 0x4A, 0x56, 0x0F, 0x0E, 0x2E, 0x10, 0x34, 0x10, 
-    0x10, 0x0F, 0x0F, 0x0F, 0x2E, 0x23, 0x23, 0x10, 0x0E, 0x0F, 0x56, 0x56, 
-    0x2E, 0x2E, 0x62, 0x62, 0x24, 0x24, 0x4D, 0x4D, 0x53, 0x32, 0x24, 0x56, 
-    0x56, 0x2E, 0x4E, 0x53, 0x2E, 0x56, 0x24, 0x24, 0x4A, 0x53, 0x4E, 0x53, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x0B, 0x0F, 
-    0x0C, 0x19, 0x69, 0x25, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0E, 0x17, 0x0E, 
-    0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0E, 0x1A, 0x0B, 0x0C, 0x01, 0x0B, 0x20, 
-    0x10, 0x20, 0x69, 0x0E, 0x0B, 0x01, 0x01, 0x0B, 0x01, 0x0B, 0x0B, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x0F, 0x21, 0x16, 0x24, 0x0C, 0x0B, 0x0F, 0x1A, 
-    0x19, 0x5C, 0x5C, 0x17, 0x0B, 0x01, 0x0C, 0x0E, 0x0F, 0x19, 0x17, 0x0F, 
-    0x35, 0x42, 0x3F, 0x5D, 0x60, 0x5F, 0x90, 0x0B, 0x1F, 0x35, 0x19, 0x35, 
-    0x60, 0x7D, 0x6E, 0x0E, 0x0F, 0x13, 0x13, 0x35, 0x60, 0x7D, 0x6E, 0x0F, 
-    0x26, 0x42, 0x43, 0x3F, 0x5D, 0x7D, 0xBF, 0x24, 0x1A, 0x35, 0x35, 0x35, 
-    0x37, 0x5A, 0x5A, 0x56, 0x62, 0x47, 0x35, 0x44, 0x6F, 0x86, 0x71, 0x2E, 
-    0x41, 0x42, 0x42, 0x7E, 0x9A, 0xC8, 0xD2, 0x2D, 0x23, 0x47, 0x42, 0x7F, 
-    0x9B, 0xC8, 0xD2, 0x56, 0x25, 0x0E, 0x0E, 0x0C, 0x0E, 0x0F, 0x2E, 0x2E, 
-    0x4A, 0x56, 0x0E, 0x0B, 0x0B, 0x0F, 0x23, 0x32, 0x4A, 0x24, 0x0E, 0x0E, 
-    0x0C, 0x0E, 0x0F, 0x53, 0x4A, 0x56, 0x0E, 0x0F, 0x56, 0x0C, 0x0E, 0x2E, 
-    0x4D, 0x24, 0x0F, 0x10, 0x2E, 0x0E, 0x0E, 0x0E, 0x4D, 0x2E, 0x24, 0x24, 
-    0x2E, 0x0F, 0x0E, 0x0C, 0x4D, 0x4D, 0x24, 0x0F, 0x2E, 0x56, 0x0F, 0x0F, 
-    0x4A, 0x4D, 0x56, 0x0E, 0x0E, 0x0E, 0x0E, 0x23, 0x0F, 0x0E, 0x0F, 0x2E, 
-    0x2E, 0x0F, 0x0F, 0x0E, 0x2E, 0x0F, 0x2E, 0x2E, 0x56, 0x0F, 0x10, 0x0F, 
-    0x2E, 0x2E, 0x62, 0x56, 0x24, 0x56, 0x23, 0x0F, 0x23, 0x2E, 0x56, 0x0E, 
-    0x0E, 0x56, 0x23, 0x10, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x24, 0x24, 0x0F, 
-    0x0C, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x24, 0x0F, 0x0E, 0x0E, 0x0F, 0x2E, 
-    0x2E, 0x0F, 0x0F, 0x56, 0x0F, 0x0E, 0x2E, 0x53, 0x74, 0x2E, 0x56, 0x56, 
-    0x0E, 0x0F, 0x19, 0x20, 0x62, 0x67, 0x67, 0x4E, 0x0E, 0x56, 0x62, 0x74, 
-    0x77, 0x73, 0x73, 0x4D, 0x0F, 0x2E, 0x32, 0x78, 0x78, 0x4D, 0x56, 0x56, 
-    0x2E, 0x2E, 0x32, 0x74, 0x2E, 0x0F, 0x0F, 0x4A, 0x4A, 0x4A, 0x32, 0x62, 
-    0x0E, 0x0B, 0x24, 0x53, 0x4A, 0x53, 0x32, 0x32, 0x24, 0x0E, 0x24, 0x53, 
-    0x2E, 0x2E, 0x53, 0x32, 0x10, 0x24, 0x56, 0x53, 0x2E, 0x0F, 0x2E, 0x32, 
-    0x2E, 0x24, 0x24, 0x2E, 0x4E, 0x4A, 0x4E, 0x50, 0x4A, 0x24, 0x0F, 0x0F, 
-    0x4E, 0x4A, 0x50, 0x32, 0x4A, 0x56, 0x56, 0x56, 0x4A, 0x53, 0x4E, 0x4A, 
-    0x4A, 0x56, 0x2E, 0x4A, 0x56, 0x2E, 0x53, 0x4A, 0x4A, 0x2E, 0x56, 0x56, 
-    0x2E, 0x2E, 0x2E, 0x4A, 0x53, 0x2E, 0x56, 0x24, 0x4A, 0x56, 0x2E, 0x53, 
-    0x4E, 0x2E, 0x24, 0x56, 0x4A, 0x4A, 0x4A, 0x53, 0x32, 0x56, 0x24, 0x2E, 
-    0x4A, 0x53, 0x53, 0x53, 0x2E, 0x24, 0x24, 0x56, 0x56, 0x0F, 0x56, 0x4D, 
-    0x53, 0x2E, 0x4A, 0x4A, 0x56, 0x0E, 0x56, 0x4E, 0x4E, 0x4A, 0x4A, 0x53, 
-    0x2E, 0x0E, 0x56, 0x4E, 0x50, 0x77, 0x53, 0x53, 0x4A, 0x0F, 0x56, 0x4D, 
-    0x50, 0x75, 0x4D, 0x53, 0x56, 0x24, 0x2E, 0x4E, 0x78, 0x75, 0x4D, 0x53, 
-    0x0F, 0x24, 0x2E, 0x32, 0x73, 0x68, 0x72, 0x4E, 0x24, 0x24, 0x4A, 0x78, 
-    0x77, 0x75, 0x73, 0x4E, 0x56, 0x53, 0x32, 0x78, 0x78, 0x76, 0x75, 0x53, 
-    0x50, 0x74, 0x50, 0x78, 0x72, 0x77, 0x77, 0x77, 0x4E, 0x4E, 0x50, 0x52, 
-    0x52, 0x52, 0x73, 0x77, 0x53, 0x4E, 0x78, 0x72, 0x72, 0x76, 0x68, 0x77, 
-    0x4E, 0x50, 0x78, 0x78, 0x78, 0x91, 0x91, 0x74, 0x52, 0x78, 0x52, 0x52, 
-    0x72, 0x75, 0x76, 0x52, 0x75, 0x52, 0x72, 0x52, 0x73, 0x75, 0x73, 0x73, 
-    0xAD, 0x52, 0x52, 0x73, 0x75, 0x91, 0x68, 0x73, 0x76, 0x52, 0x73, 0x76, 
-    0x73, 0x75, 0x73, 0x77, 0x77, 0x73, 0x96, 0x77, 0x77, 0x73, 0x75, 0x9E, 
-    0x77, 0x9E, 0x96, 0x77, 0x77, 0x77, 0x9F, 0x9F, 0x77, 0xAD, 0x96, 0x77, 
-    0x77, 0x73, 0x9F, 0x9F, 0x73, 0x76, 0x73, 0x77, 0x77, 0x73, 0x9F, 0x9E, 
-    0x77, 0x73, 0x77, 0x77, 0x73, 0x73, 0x9F, 0x9F, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x9F, 0x9E, 0x9E, 0x77, 0x77, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x74, 0x72, 0x9F, 0x9E, 0x9E, 0x9F, 0x52, 0x9F, 0x9E, 0x9E, 0x75, 0x9E, 
-    0x9E, 0x51, 0x3B, 0x1A, 0x9E, 0x9E, 0x9E, 0x9E, 0xAD, 0x74, 0x38, 0x17, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0xAD, 0x54, 0x60, 0x3B, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0xAD, 0x54, 0x6A, 0x44, 0x9E, 0x9E, 0x9E, 0x9E, 0xAD, 0x8A, 0x82, 0x84, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0xAD, 0x88, 0x87, 0xE2, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x96, 0xD7, 0xD0, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x96, 0x33, 
-    0x0E, 0x3B, 0x44, 0x6A, 0x6A, 0x83, 0x6A, 0x17, 0x17, 0x37, 0x83, 0x9A, 
-    0x9A, 0x9A, 0x7F, 0x44, 0x35, 0x59, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x6F, 
-    0x57, 0x7F, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x6A, 0xDD, 0x9A, 0x9A, 0x9A, 
-    0x9A, 0x9A, 0x9A, 0x83, 0xDD, 0xBF, 0xC0, 0xDD, 0xDD, 0x70, 0xC2, 0xDE, 
-    0xBF, 0xBF, 0xC8, 0x9D, 0x9C, 0xC8, 0xE4, 0xDD, 0x80, 0xC0, 0xE4, 0xE5, 
-    0xE4, 0xE4, 0xE4, 0xC2, 0x3B, 0x17, 0x37, 0x83, 0xE2, 0x58, 0x84, 0x65, 
-    0x17, 0x17, 0x60, 0x7F, 0x84, 0x8F, 0x58, 0x65, 0x37, 0x1B, 0xDD, 0x9A, 
-    0x9B, 0x9B, 0x9B, 0x9B, 0x1B, 0x6F, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 
-    0x1B, 0x6A, 0x9B, 0x9A, 0x9B, 0x9B, 0x9B, 0x9B, 0x6F, 0xDE, 0x9C, 0xBF, 
-    0x9B, 0x9A, 0x9B, 0x9B, 0xDD, 0xDD, 0x6E, 0xE5, 0x6D, 0x6D, 0xBF, 0xE3, 
-    0xCA, 0xCA, 0xE4, 0xE5, 0xCB, 0xE4, 0xE6, 0xCA, 0x9B, 0x9B, 0x9B, 0x9B, 
-    0x9B, 0x9A, 0x7F, 0x7F, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9C, 0x9B, 0x9B, 0x9B, 0x9D, 0xBF, 
-    0x9C, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0xBF, 0xCB, 0xE3, 0x9D, 0xBF, 0xBF, 
-    0xC0, 0xC0, 0xE3, 0x9C, 0x6D, 0xE4, 0xE5, 0x6E, 0xC0, 0xE4, 0xCA, 0xE4, 
-    0xE6, 0xCB, 0x80, 0x39, 0xE4, 0x27, 0x27, 0xE5, 0xE7, 0x16, 0x1E, 0x25, 
-    0x6A, 0x45, 0x01, 0x0C, 0x18, 0x18, 0x0B, 0x01, 0x7F, 0x40, 0x01, 0x0B, 
-    0x18, 0x18, 0x0B, 0x01, 0x65, 0x40, 0x01, 0x0B, 0x16, 0x17, 0x1F, 0x1F, 
-    0x65, 0x40, 0x1E, 0x0B, 0x16, 0x44, 0x61, 0x30, 0xE2, 0x18, 0x01, 0x0B, 
-    0x0B, 0x8F, 0x83, 0x61, 0x45, 0x25, 0x0C, 0x0C, 0x0E, 0x38, 0x83, 0xDE, 
-    0x1E, 0x0E, 0x38, 0x44, 0x38, 0x0E, 0x44, 0xDD, 0x17, 0x61, 0x6F, 0xDE, 
-    0x6F, 0x39, 0x1F, 0x8F, 0x01, 0x0B, 0x18, 0x30, 0x1F, 0x18, 0x18, 0x0C, 
-    0x0B, 0x0B, 0x18, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x0C, 0x18, 0x1F, 
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x1F, 0x30, 0x1F, 0x1F, 0x30, 0x30, 
-    0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x1F, 0x1F, 0x8F, 0x61, 0x0C, 0x1F, 
-    0x30, 0x30, 0x18, 0x18, 0xDD, 0xDC, 0x61, 0x30, 0x1F, 0x0E, 0x1F, 0x18, 
-    0xDE, 0xDD, 0xDD, 0xDC, 0x8F, 0x1F, 0x1F, 0x30, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0B, 0x0C, 0x18, 0x18, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x1F, 
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x1F, 0x1F, 0x30, 0x1F, 0x1F, 0x1F, 0x1F, 
-    0x1F, 0x1F, 0x1F, 0x30, 0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x30, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 
-    0x18, 0x1F, 0x30, 0x30, 0x1F, 0x18, 0x1F, 0x1F, 0x30, 0x30, 0x18, 0x1F, 
-    0x1F, 0x30, 0x18, 0x01, 0x0B, 0x01, 0x01, 0x0B, 0x1F, 0x1F, 0x18, 0x0B, 
-    0x0B, 0x0B, 0x0B, 0x18, 0x1F, 0x30, 0x1F, 0x0C, 0x0C, 0x0C, 0x18, 0x17, 
-    0x18, 0x30, 0x1F, 0x0C, 0x0C, 0x18, 0x39, 0x44, 0x30, 0x30, 0x1F, 0x30, 
-    0x1F, 0x61, 0xDC, 0x6F, 0x1F, 0x30, 0x30, 0x39, 0x8F, 0x84, 0xDE, 0x44, 
-    0x39, 0x1F, 0x39, 0x6F, 0xDE, 0xDE, 0xDC, 0x18, 0x44, 0x6F, 0x83, 0xDE, 
-    0xDE, 0xDC, 0x39, 0x30, 0x18, 0x0C, 0x01, 0x39, 0x83, 0xE2, 0x7F, 0x7F, 
-    0x18, 0x0C, 0x01, 0x61, 0x84, 0xE3, 0x9B, 0x9B, 0x16, 0x0C, 0x01, 0x45, 
-    0xDD, 0x9A, 0x9B, 0x9B, 0x38, 0x0C, 0x01, 0x45, 0x7F, 0x9B, 0x9B, 0x9B, 
-    0x1F, 0x0C, 0x0B, 0x0B, 0x61, 0x9D, 0x9D, 0x9B, 0x0F, 0x0E, 0x0B, 0x0B, 
-    0x01, 0xE8, 0xE4, 0xCA, 0x16, 0x21, 0x39, 0x18, 0x0C, 0x18, 0x5B, 0xE7, 
-    0x57, 0x83, 0x83, 0x40, 0x0B, 0x0B, 0x01, 0x01, 0xE3, 0x9B, 0x9B, 0x9B, 
-    0x9B, 0x9B, 0x7E, 0x60, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x6A, 0x1B, 
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9C, 0x9D, 0x9B, 
-    0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9D, 0xC0, 0xE3, 0x9A, 0x9B, 0x9B, 0x9B, 
-    0xBF, 0xE3, 0x9C, 0x9B, 0xC1, 0x9D, 0x9A, 0x9B, 0xE4, 0xE4, 0xCA, 0xC8, 
-    0xCA, 0x6E, 0x9D, 0x9C, 0x81, 0xE9, 0xE6, 0xE6, 0xE4, 0xE4, 0xE5, 0xE4, 
-    0x6A, 0x7E, 0x37, 0x17, 0x17, 0x1A, 0x57, 0x83, 0x44, 0x7F, 0x83, 0x44, 
-    0x38, 0x17, 0x83, 0x9A, 0x9B, 0x9B, 0x9A, 0x6F, 0x35, 0x3B, 0x7E, 0x9A, 
-    0x9B, 0x9B, 0x9B, 0x6A, 0x44, 0x38, 0x7E, 0x9A, 0x9B, 0x9B, 0x9B, 0x6A, 
-    0x44, 0x6F, 0x65, 0x9B, 0x65, 0x9C, 0x9B, 0x83, 0x83, 0xDE, 0xBF, 0xC8, 
-    0xE3, 0xE4, 0xBF, 0xDE, 0xDE, 0xDE, 0xC0, 0xCA, 0xCB, 0xE5, 0xE4, 0xC9, 
-    0xC2, 0xCA, 0xE4, 0xE6, 0x83, 0x83, 0x57, 0x17, 0x3B, 0x1A, 0x17, 0x13, 
-    0x9A, 0x9A, 0x7E, 0x8F, 0x30, 0x0F, 0x1B, 0x19, 0x9A, 0x9A, 0x9A, 0x9A, 
-    0x8F, 0x34, 0x57, 0x7E, 0x9A, 0x9A, 0x9A, 0x9A, 0x83, 0x1B, 0x6F, 0x7F, 
-    0x9A, 0x9A, 0x9A, 0x9B, 0x9A, 0x84, 0x83, 0x7E, 0x9A, 0x9A, 0xC2, 0xC1, 
-    0xE3, 0x85, 0x65, 0x6C, 0x9B, 0x6D, 0xE4, 0xCB, 0x6D, 0x64, 0xE0, 0x75, 
-    0xE4, 0xE4, 0xE4, 0xC1, 0x9D, 0x54, 0x67, 0x9E, 0x9F, 0x75, 0x9F, 0x75, 
-    0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 
-    0x63, 0x9E, 0x9E, 0x9F, 0x9E, 0x9E, 0x9F, 0x9E, 0x63, 0x9E, 0x9E, 0x75, 
-    0x9E, 0x9E, 0x9F, 0x9F, 0x67, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 
-    0x67, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x75, 
-    0x9E, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x52, 0x73, 
-    0x91, 0x75, 0x73, 0x9F, 0x9F, 0x52, 0x9F, 0x77, 0x68, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x73, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9F, 0x52, 
-    0x9E, 0x91, 0x9E, 0x9F, 0x9F, 0x9F, 0x52, 0x52, 0x9E, 0x79, 0xAD, 0x73, 
-    0x9F, 0x9F, 0x73, 0x52, 0x73, 0x9F, 0x76, 0x75, 0x9F, 0x9F, 0x73, 0x9F, 
-    0x52, 0x75, 0x89, 0xAD, 0x9F, 0x9F, 0x52, 0x76, 0x73, 0x9F, 0x9E, 0x73, 
-    0x73, 0x52, 0x52, 0x79, 0x52, 0x78, 0x50, 0x50, 0x32, 0x4A, 0x4A, 0x4A, 
-    0x52, 0x78, 0x4E, 0x4E, 0x53, 0x2E, 0x4A, 0x2E, 0x52, 0x52, 0x74, 0x4E, 
-    0x4D, 0x2E, 0x4A, 0x4D, 0x9F, 0x9F, 0x52, 0x50, 0x4E, 0x4A, 0x4A, 0x78, 
-    0x9F, 0x52, 0x52, 0x52, 0x78, 0x4E, 0x50, 0x75, 0x9F, 0x52, 0x77, 0x52, 
-    0x52, 0x50, 0x78, 0x76, 0x9F, 0x73, 0x52, 0x78, 0x78, 0x72, 0x73, 0x76, 
-    0x75, 0x52, 0x74, 0x78, 0x78, 0x68, 0x76, 0x73, 0x75, 0x91, 0x52, 0x74, 
-    0x74, 0x73, 0x73, 0x72, 0x74, 0x91, 0x75, 0x74, 0x74, 0x73, 0x52, 0x52, 
-    0x4E, 0x91, 0x75, 0x72, 0x74, 0x50, 0x9F, 0x9F, 0x76, 0xAD, 0x72, 0x72, 
-    0x72, 0x32, 0x73, 0x73, 0x76, 0x73, 0x50, 0x32, 0x78, 0x50, 0x78, 0x73, 
-    0x9E, 0x73, 0x50, 0x32, 0x32, 0x32, 0x50, 0x68, 0x73, 0x72, 0x78, 0x50, 
-    0x50, 0x32, 0x50, 0x76, 0x52, 0x72, 0x50, 0x50, 0x4E, 0x32, 0x50, 0x74, 
-    0x32, 0x4D, 0x73, 0x89, 0x73, 0x53, 0x2E, 0x56, 0x32, 0x4D, 0x73, 0x8C, 
-    0x9E, 0x32, 0x53, 0x4A, 0x50, 0x4D, 0x73, 0x8E, 0x76, 0x50, 0x4E, 0x4A, 
-    0x50, 0x32, 0x50, 0x79, 0x76, 0x50, 0x4E, 0x2E, 0x52, 0x32, 0x4E, 0x9F, 
-    0x76, 0x74, 0x53, 0x2E, 0x76, 0x50, 0x32, 0x52, 0x79, 0x50, 0x53, 0x4A, 
-    0x76, 0x50, 0x53, 0x52, 0x91, 0x50, 0x32, 0x53, 0x75, 0x74, 0x32, 0x73, 
-    0x91, 0x50, 0x53, 0x53, 0x24, 0x56, 0x53, 0x53, 0x4A, 0x56, 0x4A, 0x73, 
-    0x2E, 0x2E, 0x4E, 0x4E, 0x4A, 0x32, 0x74, 0x73, 0x2E, 0x2D, 0x4E, 0x78, 
-    0x2E, 0x32, 0x32, 0x2E, 0x2E, 0x24, 0x4D, 0x32, 0x56, 0x56, 0x56, 0x56, 
-    0x2E, 0x56, 0x56, 0x4A, 0x56, 0x4A, 0x74, 0x4A, 0x2E, 0x32, 0x50, 0x4D, 
-    0x56, 0x4A, 0x53, 0x2E, 0x50, 0x76, 0x76, 0x74, 0x2E, 0x56, 0x24, 0x2E, 
-    0x4E, 0x75, 0x75, 0x74, 0x4A, 0x0F, 0x0F, 0x56, 0x73, 0x72, 0x73, 0x74, 
-    0x2E, 0x0F, 0x0F, 0x0F, 0x74, 0x73, 0x67, 0x53, 0x0F, 0x0F, 0x0F, 0x0F, 
-    0x2E, 0x2D, 0x4E, 0x2E, 0x0F, 0x34, 0x0E, 0x0E, 0x24, 0x0F, 0x53, 0x2E, 
-    0x0F, 0x0F, 0x0F, 0x0F, 0x56, 0x56, 0x2E, 0x0F, 0x0F, 0x0E, 0x24, 0x56, 
-    0x2E, 0x2E, 0x0F, 0x0E, 0x0F, 0x0E, 0x24, 0x2E, 0x53, 0x2E, 0x0F, 0x0F, 
-    0x0E, 0x24, 0x2E, 0x2E, 0x56, 0x56, 0x0F, 0x0F, 0x0F, 0x56, 0x2E, 0x53, 
-    0x0E, 0x0F, 0x0F, 0x10, 0x56, 0x2E, 0x32, 0x53, 0x0F, 0x2E, 0x2E, 0x0F, 
-    0x0F, 0x2E, 0x62, 0x2E, 0x56, 0x2E, 0x2E, 0x56, 0x0F, 0x24, 0x0E, 0x0E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x0F, 0x0F, 0x2E, 0x2E, 0x2E, 0x56, 
-    0x2E, 0x56, 0x56, 0x0F, 0x56, 0x56, 0x2E, 0x56, 0x56, 0x56, 0x56, 0x56, 
-    0x2E, 0x56, 0x24, 0x56, 0x56, 0x0F, 0x56, 0x32, 0x2E, 0x56, 0x0F, 0x56, 
-    0x10, 0x24, 0x2E, 0x32, 0x0F, 0x0E, 0x56, 0x2E, 0x53, 0x4E, 0x4E, 0x53, 
-    0x0E, 0x0F, 0x2E, 0x53, 0x53, 0x4E, 0x53, 0x53, 0x0F, 0x24, 0x2E, 0x53, 
-    0x53, 0x4E, 0x53, 0x4A, 0x0E, 0x2E, 0x4A, 0x53, 0x53, 0x53, 0x4A, 0x24, 
-    0x24, 0x2E, 0x53, 0x53, 0x53, 0x53, 0x56, 0x25, 0x2E, 0x4A, 0x53, 0x53, 
-    0x53, 0x2E, 0x24, 0x0E, 0x32, 0x4A, 0x53, 0x53, 0x2E, 0x24, 0x24, 0x0F, 
-    0x32, 0x2E, 0x2E, 0x2E, 0x24, 0x24, 0x2E, 0x2E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0F, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0F, 0x0E, 0x01, 0x01, 0x0B, 0x0C, 
-    0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x0B, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0F, 0x0F, 0x0C, 0x01, 0x01, 0x0B, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x0C, 0x18, 0x0B, 0x0F, 0x0E, 0x1E, 0x1E, 0x0E, 
-    0x0E, 0x10, 0x0F, 0x20, 0x20, 0x1F, 0x19, 0x43, 0x0E, 0x0E, 0x1A, 0x19, 
-    0x41, 0x35, 0x26, 0x60, 0x20, 0x35, 0x19, 0x47, 0x41, 0x43, 0x3F, 0x6A, 
-    0x0B, 0x17, 0x23, 0x25, 0x19, 0x26, 0x37, 0x3F, 0x0E, 0x20, 0x47, 0x47, 
-    0x41, 0x35, 0x34, 0x47, 0x16, 0x26, 0x26, 0x43, 0x43, 0x43, 0x3B, 0x26, 
-    0x0B, 0x1F, 0x26, 0x43, 0x3E, 0x43, 0x43, 0x60, 0x3B, 0x35, 0x43, 0x7F, 
-    0x9B, 0xC9, 0xD2, 0x24, 0x37, 0x6A, 0x59, 0x5E, 0x7D, 0x86, 0x5B, 0x4A, 
-    0x60, 0x7F, 0x5F, 0x7D, 0x7D, 0x18, 0x2D, 0x4D, 0x59, 0x85, 0x65, 0x9D, 
-    0x7D, 0x18, 0x2D, 0x4D, 0xE2, 0x85, 0x6D, 0x9D, 0x7D, 0x45, 0x4A, 0x4A, 
-    0x59, 0x7F, 0x9D, 0x66, 0x46, 0xE0, 0x4A, 0x4A, 0x3E, 0x58, 0x97, 0x46, 
-    0x2D, 0x4A, 0x2E, 0x4D, 0x1B, 0x44, 0x90, 0x40, 0x4A, 0x4A, 0x4D, 0x4A, 
-    0x4D, 0x4D, 0x4A, 0x56, 0x0E, 0x0E, 0x0F, 0x10, 0x4D, 0x4D, 0x4D, 0x4A, 
-    0x0F, 0x0E, 0x0E, 0x0F, 0x4D, 0x4E, 0x4E, 0x4A, 0x56, 0x0F, 0x0E, 0x0F, 
-    0x4E, 0x50, 0x78, 0x53, 0x2E, 0x0F, 0x0C, 0x0E, 0x53, 0x50, 0x78, 0x32, 
-    0x2E, 0x10, 0x2E, 0x0F, 0x53, 0x50, 0x50, 0x32, 0x56, 0x32, 0x74, 0x24, 
-    0x4E, 0x50, 0x78, 0x53, 0x2E, 0x50, 0x73, 0x24, 0x53, 0x50, 0x78, 0x32, 
-    0x2E, 0x32, 0x73, 0x24, 0x0F, 0x0F, 0x2E, 0x4E, 0x52, 0x4A, 0x0F, 0x10, 
-    0x23, 0x0F, 0x0F, 0x2E, 0x74, 0x2E, 0x0F, 0x56, 0x19, 0x0E, 0x34, 0x2E, 
-    0x2E, 0x24, 0x56, 0x56, 0x19, 0x0F, 0x56, 0x2E, 0x24, 0x24, 0x24, 0x56, 
-    0x20, 0x23, 0x32, 0x74, 0x77, 0x2E, 0x24, 0x24, 0x0F, 0x56, 0x2E, 0x4A, 
-    0x4D, 0x53, 0x50, 0x4A, 0x0E, 0x0E, 0x0E, 0x56, 0x2E, 0x50, 0x76, 0x50, 
-    0x0E, 0x0F, 0x0F, 0x4A, 0x53, 0x73, 0x89, 0x74, 0x2E, 0x10, 0x2E, 0x62, 
-    0x56, 0x56, 0x0E, 0x0F, 0x2E, 0x10, 0x2E, 0x2E, 0x24, 0x56, 0x56, 0x24, 
-    0x4A, 0x0F, 0x0F, 0x0E, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x0F, 0x0E, 0x0E, 
-    0x0F, 0x2E, 0x2E, 0x4A, 0x0F, 0x0F, 0x2E, 0x56, 0x0F, 0x0F, 0x2E, 0x32, 
-    0x0F, 0x0F, 0x53, 0x2E, 0x0F, 0x0F, 0x2E, 0x53, 0x0F, 0x56, 0x53, 0x2E, 
-    0x24, 0x0F, 0x0F, 0x2E, 0x25, 0x24, 0x53, 0x53, 0x2E, 0x24, 0x0F, 0x56, 
-    0x24, 0x2E, 0x2E, 0x2E, 0x0E, 0x24, 0x24, 0x56, 0x0E, 0x0E, 0x0F, 0x24, 
-    0x24, 0x2E, 0x4A, 0x53, 0x2E, 0x4A, 0x53, 0x4A, 0x4A, 0x53, 0x4D, 0x53, 
-    0x53, 0x4D, 0x4D, 0x4D, 0x4A, 0x53, 0x50, 0x4E, 0x32, 0x32, 0x4D, 0x53, 
-    0x4E, 0x32, 0x74, 0x52, 0x32, 0x77, 0x78, 0x74, 0x52, 0x52, 0x78, 0x76, 
-    0x4D, 0x32, 0x78, 0x72, 0x74, 0x52, 0x52, 0x75, 0x2E, 0x4A, 0x4E, 0x32, 
-    0x2E, 0x50, 0x76, 0x91, 0x2E, 0x32, 0x78, 0x74, 0x74, 0x68, 0x75, 0x50, 
-    0x32, 0x74, 0x78, 0x52, 0x75, 0x72, 0x78, 0x52, 0x32, 0x74, 0x74, 0x67, 
-    0x68, 0x50, 0x77, 0x9E, 0x78, 0x9E, 0x76, 0x74, 0x32, 0x50, 0x75, 0x76, 
-    0x52, 0x91, 0x68, 0x4E, 0x32, 0x78, 0x76, 0x78, 0x76, 0x4D, 0x4D, 0x50, 
-    0x78, 0x77, 0x75, 0x73, 0x74, 0x4A, 0x53, 0x4D, 0x50, 0x77, 0x9F, 0x79, 
-    0x4E, 0x4A, 0x4A, 0x4D, 0x50, 0x77, 0x75, 0x89, 0x79, 0x9F, 0x9F, 0x75, 
-    0x73, 0x74, 0x74, 0x73, 0x89, 0x75, 0x73, 0x73, 0x52, 0x73, 0x77, 0x77, 
-    0x75, 0x78, 0x73, 0x75, 0x74, 0x77, 0x52, 0x52, 0x75, 0x78, 0x73, 0x75, 
-    0x78, 0x77, 0x52, 0x73, 0x78, 0x75, 0x9E, 0x75, 0x78, 0x77, 0x73, 0x73, 
-    0x78, 0x76, 0x9F, 0x72, 0x72, 0x52, 0x77, 0x52, 0x78, 0x75, 0x9F, 0x72, 
-    0x72, 0x73, 0x73, 0x72, 0x78, 0x73, 0x9F, 0x72, 0x72, 0x76, 0x91, 0x75, 
-    0x52, 0x74, 0x52, 0x9F, 0x9F, 0x52, 0x52, 0x9F, 0x74, 0x74, 0x52, 0x52, 
-    0x52, 0x9F, 0x52, 0x9F, 0x74, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x74, 0x74, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x77, 0x77, 0x52, 0x9F, 
-    0x52, 0x52, 0x73, 0x52, 0x77, 0x77, 0x52, 0x9F, 0x9F, 0x52, 0x9F, 0x9F, 
-    0x52, 0x52, 0x52, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x72, 0x52, 0x9F, 
-    0x52, 0x73, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x76, 0xAD, 0x9E, 
-    0x9F, 0x9E, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0xAD, 0x9E, 0x9E, 0x75, 0x75, 
-    0x9E, 0x9E, 0x9E, 0xAD, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x75, 0x9F, 0x9E, 0x9F, 0x9F, 
-    0x9E, 0x75, 0x9E, 0x9E, 0x9E, 0x9E, 0x75, 0x9E, 0x9E, 0x75, 0x9E, 0x9E, 
-    0x9E, 0x75, 0x9E, 0x9F, 0x75, 0x9E, 0x9E, 0x9E, 0xEA, 0x6E, 0x5A, 0xEB, 
-    0xE6, 0xE5, 0xE5, 0xE5, 0x68, 0x87, 0x85, 0xC0, 0xC0, 0xC2, 0xE5, 0xE5, 
-    0xAD, 0x68, 0x63, 0x54, 0x26, 0x71, 0xE7, 0xE7, 0x9E, 0x9F, 0xAD, 0xA3, 
-    0xCE, 0x20, 0x01, 0x01, 0x75, 0x9E, 0xAD, 0xB5, 0xCE, 0x26, 0x39, 0x18, 
-    0x9E, 0x9E, 0xAD, 0xB5, 0xCE, 0x22, 0x46, 0x45, 0x9E, 0x9E, 0xAD, 0xB5, 
-    0x8A, 0x36, 0x0B, 0x0C, 0xAD, 0x9E, 0xAD, 0xA6, 0x8A, 0x37, 0x01, 0x01, 
-    0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE6, 0xE5, 0xEC, 0xE6, 0xE6, 
-    0xE5, 0xE5, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xEB, 0xE5, 0xE6, 0xE6, 0xE8, 
-    0x01, 0x01, 0x01, 0x81, 0xE7, 0xE7, 0xE7, 0x31, 0x01, 0x0B, 0x0B, 0x0B, 
-    0x18, 0x18, 0x18, 0x45, 0x01, 0x01, 0x18, 0x60, 0x83, 0x83, 0x83, 0xDE, 
-    0x18, 0x0B, 0x18, 0x6F, 0xDD, 0x7F, 0x7F, 0x65, 0x0B, 0x0B, 0x0C, 0x6F, 
-    0xDD, 0xE3, 0xE3, 0xBF, 0xE6, 0xE5, 0xED, 0x81, 0x25, 0x0E, 0x34, 0x1A, 
-    0xEC, 0x6B, 0x16, 0x0E, 0x3B, 0x17, 0x3B, 0x17, 0x0F, 0x1E, 0x25, 0x3B, 
-    0x17, 0x47, 0x47, 0x44, 0x25, 0x1E, 0x0E, 0x17, 0x17, 0x79, 0xA2, 0x31, 
-    0x57, 0x66, 0x45, 0x3B, 0x47, 0x89, 0xB5, 0xD8, 0x7F, 0x9A, 0x7F, 0x42, 
-    0x8A, 0xA8, 0xA4, 0x7B, 0xC0, 0xC1, 0x6E, 0x5A, 0x54, 0x8C, 0xA0, 0x7B, 
-    0xE6, 0x27, 0xE6, 0xC0, 0x71, 0x88, 0x8D, 0x7B, 0x38, 0x6F, 0xDE, 0xDE, 
-    0x83, 0x6F, 0x44, 0x18, 0x8F, 0xDE, 0x9A, 0x9A, 0xDD, 0xDE, 0xDC, 0x8F, 
-    0x85, 0x9D, 0x70, 0xBF, 0x9D, 0x9B, 0xDD, 0xDC, 0xC1, 0xC8, 0x86, 0x86, 
-    0x86, 0x6D, 0xE3, 0xE3, 0xD2, 0x80, 0x84, 0x6F, 0x58, 0xBF, 0xC1, 0x9D, 
-    0x7A, 0xD5, 0xD2, 0xD2, 0x6E, 0x86, 0xD2, 0xE4, 0xB5, 0xB2, 0xED, 0xE4, 
-    0xC2, 0x86, 0x66, 0xE7, 0xB5, 0xAA, 0xE9, 0xBF, 0x86, 0xE1, 0x66, 0x58, 
-    0x39, 0xDC, 0xDE, 0xDD, 0xDE, 0x8F, 0x44, 0x30, 0x38, 0x39, 0x17, 0x8F, 
-    0xDD, 0xDD, 0xDD, 0x44, 0x8F, 0x44, 0x30, 0x38, 0x8F, 0x8F, 0xDD, 0xDE, 
-    0xE3, 0x84, 0x44, 0x61, 0x30, 0x3B, 0x8F, 0xDD, 0x9D, 0x65, 0x7E, 0x84, 
-    0x57, 0x17, 0x3B, 0x39, 0xC2, 0x9D, 0x9B, 0x65, 0xDE, 0x8F, 0x44, 0x61, 
-    0xCB, 0xC8, 0x9D, 0x7D, 0x65, 0xDD, 0xDE, 0xDE, 0x86, 0xC9, 0xCA, 0xCA, 
-    0xC8, 0x6D, 0x9A, 0xDD, 0x18, 0x1F, 0x30, 0x18, 0x1F, 0x1F, 0x44, 0x44, 
-    0x30, 0x39, 0x30, 0x1F, 0x39, 0x61, 0x84, 0xDE, 0xDE, 0x8F, 0x1F, 0x61, 
-    0xDE, 0xDE, 0xDD, 0xDC, 0xDD, 0xDE, 0xDC, 0xDC, 0xDD, 0xDE, 0xDC, 0x61, 
-    0x84, 0x9A, 0x9A, 0xDD, 0xDD, 0x61, 0x17, 0x38, 0x39, 0x39, 0x17, 0x38, 
-    0x61, 0x30, 0x38, 0x6F, 0x38, 0x3B, 0x3B, 0x3B, 0x3B, 0x57, 0x6F, 0xDD, 
-    0xDC, 0x8F, 0x6F, 0x8F, 0x8F, 0xDD, 0x9A, 0x9D, 0x6F, 0xDE, 0x7F, 0xDC, 
-    0x61, 0x17, 0x39, 0x6F, 0xDE, 0x8F, 0x61, 0x40, 0x21, 0x38, 0x6F, 0xDE, 
-    0x8F, 0x39, 0x3B, 0x39, 0x8F, 0x6F, 0xDD, 0xE3, 0x16, 0x39, 0x44, 0x8F, 
-    0xDD, 0x9B, 0xE3, 0x9D, 0x40, 0x84, 0xDE, 0x9A, 0x9B, 0x9D, 0xBF, 0x6D, 
-    0xDE, 0xDD, 0xDD, 0x9D, 0xCA, 0xCA, 0xEE, 0x86, 0x9A, 0x9A, 0x9C, 0xC1, 
-    0xC2, 0xD2, 0x71, 0x80, 0xC1, 0xC0, 0xC2, 0xE9, 0x6E, 0x86, 0xE1, 0x6F, 
-    0x83, 0xDE, 0xDD, 0x6F, 0x39, 0x1F, 0x30, 0x0C, 0xDD, 0x9A, 0x9A, 0xDE, 
-    0x8F, 0x17, 0x30, 0x39, 0x9D, 0xBF, 0xBF, 0x9D, 0x85, 0x44, 0x3D, 0x47, 
-    0x86, 0x86, 0x5A, 0xBF, 0x9D, 0x57, 0x99, 0x67, 0x58, 0x58, 0x58, 0x86, 
-    0xBF, 0x46, 0x89, 0x98, 0x86, 0x6E, 0xC0, 0xE8, 0x54, 0x73, 0x7B, 0xA2, 
-    0xCA, 0xE4, 0x27, 0xED, 0x8C, 0x9F, 0x7B, 0xA2, 0x6D, 0x6D, 0xC0, 0xD4, 
-    0xA8, 0x9F, 0x91, 0xA2, 0x01, 0x31, 0xEB, 0xE5, 0xE5, 0xE6, 0xE5, 0xE5, 
-    0x18, 0x0B, 0x18, 0x6B, 0xEF, 0xE5, 0xE5, 0xE5, 0x17, 0x18, 0x25, 0x0B, 
-    0x31, 0xE8, 0xE5, 0xE6, 0x3D, 0x17, 0x0B, 0x01, 0x01, 0x5B, 0xE7, 0xE7, 
-    0x99, 0x1A, 0x40, 0x8F, 0x61, 0x61, 0x18, 0x18, 0x99, 0x38, 0xDE, 0xDD, 
-    0xDD, 0xDD, 0xDE, 0x83, 0x8A, 0x5A, 0xC1, 0xC1, 0xBF, 0xBF, 0xE3, 0xDE, 
-    0xD8, 0xC0, 0xE5, 0x27, 0x27, 0xC8, 0x6D, 0x9A, 0xE5, 0xEB, 0xE5, 0xE5, 
-    0xE5, 0xE6, 0xE6, 0xE6, 0xE5, 0xE5, 0xE5, 0xEC, 0xE5, 0xEC, 0xE5, 0xE4, 
-    0xEB, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x5B, 0x81, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x62, 0x18, 0x0C, 0x01, 0x0B, 0x0B, 0x18, 0x45, 0x3D, 
-    0x6A, 0x57, 0x18, 0x0B, 0x01, 0x40, 0x7E, 0x22, 0x7E, 0x6F, 0x18, 0x01, 
-    0x0B, 0x18, 0x18, 0x3D, 0x7F, 0x60, 0x30, 0x0B, 0x0C, 0x01, 0x01, 0x37, 
-    0xE6, 0xE5, 0x6E, 0x86, 0x87, 0x73, 0x9E, 0x75, 0xCB, 0x6E, 0xE2, 0x5D, 
-    0x63, 0x9E, 0x9E, 0x9E, 0x19, 0x62, 0x67, 0x67, 0x75, 0x9E, 0x9E, 0x9E, 
-    0x79, 0xAD, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x68, 0x75, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x76, 0x9E, 0xAD, 0x75, 0x76, 0x9E, 0x9E, 0x9E, 
-    0x54, 0x67, 0x9E, 0xAD, 0xAD, 0x9E, 0xAD, 0x9E, 0x6C, 0x63, 0x9E, 0xAD, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x52, 0x73, 
-    0x9E, 0x9E, 0x9E, 0x75, 0x9E, 0x9E, 0x9F, 0x73, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9F, 0x73, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x73, 0x73, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x77, 0x73, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x75, 0x73, 0x77, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x73, 0x77, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x52, 0x52, 0x73, 0x77, 0x72, 0x52, 0x73, 
-    0x73, 0x73, 0x52, 0x79, 0x74, 0x52, 0x9F, 0x91, 0x96, 0x9E, 0x72, 0x73, 
-    0x77, 0x73, 0x9F, 0x91, 0x91, 0x68, 0x72, 0x73, 0x73, 0x52, 0x72, 0x9F, 
-    0x75, 0x75, 0x73, 0x68, 0x77, 0x52, 0x72, 0x72, 0x50, 0x78, 0x72, 0x75, 
-    0x77, 0x52, 0x52, 0x52, 0x50, 0x50, 0x52, 0x52, 0x73, 0x52, 0x72, 0x52, 
-    0x72, 0x72, 0x52, 0x52, 0x77, 0x52, 0x72, 0x77, 0x73, 0x52, 0x78, 0x78, 
-    0x75, 0x52, 0x52, 0x52, 0x73, 0x79, 0x52, 0x72, 0x73, 0x73, 0x52, 0x73, 
-    0x72, 0x72, 0x72, 0x78, 0x68, 0x73, 0x72, 0x73, 0x78, 0x50, 0x72, 0x72, 
-    0x91, 0x52, 0x74, 0x72, 0x72, 0x72, 0x50, 0x72, 0x89, 0x79, 0x76, 0x76, 
-    0x73, 0x72, 0x50, 0x52, 0x73, 0x73, 0x9F, 0x91, 0x68, 0x75, 0x72, 0x73, 
-    0x52, 0x52, 0x52, 0x52, 0x74, 0x72, 0x50, 0x72, 0x72, 0x52, 0x52, 0x78, 
-    0x52, 0x52, 0x32, 0x32, 0x72, 0x78, 0x32, 0x50, 0x50, 0x74, 0x74, 0x4E, 
-    0x50, 0x72, 0x50, 0x50, 0x50, 0x74, 0x74, 0x32, 0x72, 0x72, 0x72, 0x78, 
-    0x50, 0x74, 0x74, 0x32, 0x50, 0x4E, 0x78, 0x74, 0x50, 0x50, 0x32, 0x32, 
-    0x72, 0x4E, 0x4E, 0x32, 0x75, 0x73, 0x50, 0x32, 0x75, 0x52, 0x50, 0x50, 
-    0x72, 0x73, 0x78, 0x74, 0x52, 0x72, 0x32, 0x32, 0x53, 0x32, 0x74, 0x52, 
-    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x50, 0x76, 0x73, 0x4E, 0x52, 
-    0x68, 0x32, 0x32, 0x50, 0x75, 0x73, 0x32, 0x76, 0x91, 0x32, 0x53, 0x32, 
-    0x32, 0x32, 0x50, 0x79, 0x68, 0x32, 0x53, 0x4D, 0x50, 0x32, 0x50, 0x79, 
-    0x68, 0x32, 0x4A, 0x4A, 0x50, 0x52, 0x67, 0x72, 0x50, 0x53, 0x4A, 0x4A, 
-    0x74, 0x72, 0x73, 0x50, 0x4E, 0x4D, 0x4A, 0x4A, 0x72, 0x78, 0x72, 0x78, 
-    0x78, 0x32, 0x4A, 0x4A, 0x72, 0x72, 0x78, 0x72, 0x78, 0x4E, 0x4A, 0x4D, 
-    0x74, 0x4A, 0x53, 0x4A, 0x4A, 0x2E, 0x56, 0x2E, 0x74, 0x4A, 0x2E, 0x4A, 
-    0x4E, 0x4A, 0x56, 0x2E, 0x4D, 0x4A, 0x2E, 0x53, 0x73, 0x4D, 0x56, 0x2E, 
-    0x4A, 0x4A, 0x4A, 0x4D, 0x50, 0x2E, 0x0F, 0x0F, 0x2E, 0x4A, 0x53, 0x32, 
-    0x4D, 0x2E, 0x0F, 0x0F, 0x2E, 0x4A, 0x53, 0x32, 0x4A, 0x56, 0x0F, 0x0F, 
-    0x4A, 0x4A, 0x2E, 0x2E, 0x56, 0x0F, 0x0F, 0x0F, 0x78, 0x32, 0x56, 0x0F, 
-    0x0F, 0x0F, 0x0F, 0x0F, 0x2E, 0x0F, 0x0F, 0x2E, 0x24, 0x56, 0x2E, 0x2E, 
-    0x2E, 0x24, 0x56, 0x53, 0x56, 0x0F, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x53, 
-    0x53, 0x2E, 0x56, 0x56, 0x0F, 0x0F, 0x2E, 0x32, 0x32, 0x53, 0x2E, 0x56, 
-    0x0F, 0x24, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x4A, 0x24, 0x2E, 0x2E, 0x2E, 
-    0x56, 0x24, 0x53, 0x32, 0x0F, 0x2E, 0x2E, 0x56, 0x2E, 0x4A, 0x74, 0x50, 
-    0x56, 0x2E, 0x2E, 0x0F, 0x2E, 0x32, 0x78, 0x50, 0x2E, 0x56, 0x56, 0x0F, 
-    0x56, 0x56, 0x53, 0x32, 0x56, 0x0F, 0x2E, 0x4E, 0x4D, 0x2E, 0x2E, 0x2E, 
-    0x56, 0x24, 0x4D, 0x9F, 0x72, 0x2E, 0x2E, 0x4A, 0x56, 0x2E, 0x4A, 0x32, 
-    0x4E, 0x4A, 0x4A, 0x56, 0x32, 0x53, 0x2E, 0x2E, 0x4A, 0x4A, 0x56, 0x0E, 
-    0x74, 0x53, 0x2E, 0x2E, 0x2E, 0x2E, 0x24, 0x0E, 0x4D, 0x4A, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x0F, 0x0E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x2E, 0x0E, 
-    0x53, 0x2E, 0x10, 0x24, 0x24, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x0E, 0x0F, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x0E, 0x24, 0x2E, 0x4A, 0x2E, 0x2E, 0x2E, 
-    0x0F, 0x0E, 0x56, 0x32, 0x4E, 0x2E, 0x2E, 0x4A, 0x0E, 0x56, 0x2E, 0x50, 
-    0x50, 0x4A, 0x2E, 0x4A, 0x0E, 0x0F, 0x2E, 0x78, 0x50, 0x4D, 0x4A, 0x4A, 
-    0x0E, 0x0E, 0x2E, 0x32, 0x50, 0x4E, 0x4E, 0x4E, 0x0E, 0x0F, 0x2E, 0x78, 
-    0x72, 0x50, 0x50, 0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x0E, 0x0C, 0x01, 0x0B, 0x01, 0x01, 
-    0x01, 0x01, 0x0E, 0x0B, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0C, 0x0E, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0B, 0x18, 0x0E, 
-    0x01, 0x0C, 0x18, 0x35, 0x43, 0x43, 0x3F, 0x7F, 0x01, 0x0B, 0x01, 0x1E, 
-    0x0E, 0x1B, 0x60, 0x7F, 0x0E, 0x0F, 0x01, 0x01, 0x1E, 0x1F, 0x1B, 0x57, 
-    0x10, 0x20, 0x1F, 0x0C, 0x0E, 0x3F, 0x57, 0x45, 0x0E, 0x19, 0x41, 0x37, 
-    0x37, 0x6A, 0x6A, 0x35, 0x1E, 0x0B, 0x38, 0x60, 0x6A, 0x6F, 0x6A, 0x1B, 
-    0x19, 0x3D, 0x20, 0x21, 0x40, 0x57, 0x7E, 0x5E, 0x16, 0x20, 0x23, 0x1E, 
-    0x57, 0x60, 0x59, 0x58, 0x9A, 0x5F, 0x97, 0x18, 0x4A, 0x4A, 0x4D, 0x4A, 
-    0x9A, 0x9C, 0x97, 0x18, 0x4A, 0x4D, 0x4D, 0x4A, 0x7F, 0x9C, 0x97, 0x18, 
-    0x4A, 0x4D, 0x4D, 0x4A, 0x7E, 0x9C, 0x97, 0x18, 0x4A, 0x4D, 0x4D, 0x4A, 
-    0x59, 0x9C, 0xBF, 0x18, 0x4A, 0x4D, 0x4A, 0x4A, 0x59, 0x9C, 0xC1, 0x18, 
-    0x4A, 0x4D, 0x4D, 0x4A, 0x5F, 0x9C, 0x90, 0x18, 0x4A, 0x32, 0x32, 0x53, 
-    0x90, 0x6B, 0x16, 0x0F, 0x56, 0x56, 0x56, 0x24, 0x53, 0x78, 0x50, 0x32, 
-    0x56, 0x2E, 0x56, 0x0F, 0x4A, 0x32, 0x78, 0x32, 0x56, 0x0F, 0x0E, 0x0E, 
-    0x4A, 0x4D, 0x4E, 0x53, 0x0E, 0x0F, 0x0F, 0x0F, 0x4A, 0x4A, 0x2E, 0x0E, 
-    0x0E, 0x0E, 0x0F, 0x0E, 0x4A, 0x4A, 0x56, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x56, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x56, 0x24, 0x24, 0x24, 0x56, 
-    0x0F, 0x0E, 0x24, 0x56, 0x0E, 0x0F, 0x0E, 0x56, 0x0F, 0x0E, 0x56, 0x2E, 
-    0x0F, 0x0E, 0x0F, 0x24, 0x56, 0x32, 0x78, 0x2E, 0x0E, 0x0E, 0x0E, 0x0F, 
-    0x24, 0x0E, 0x25, 0x24, 0x24, 0x56, 0x56, 0x4A, 0x56, 0x56, 0x4A, 0x2E, 
-    0x0E, 0x56, 0x4A, 0x4A, 0x56, 0x2E, 0x4D, 0x2E, 0x0F, 0x10, 0x2E, 0x32, 
-    0x2E, 0x2E, 0x4E, 0x2E, 0x56, 0x2E, 0x53, 0x67, 0x50, 0x2E, 0x78, 0x53, 
-    0x56, 0x2E, 0x53, 0x75, 0x50, 0x4A, 0x73, 0x4E, 0x2E, 0x2E, 0x53, 0x68, 
-    0x32, 0x56, 0x72, 0x74, 0x0F, 0x24, 0x56, 0x56, 0x2E, 0x24, 0x2E, 0x56, 
-    0x24, 0x24, 0x24, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x56, 0x10, 0x0E, 
-    0x0E, 0x0F, 0x0E, 0x0F, 0x0F, 0x24, 0x2E, 0x2E, 0x0E, 0x0E, 0x0E, 0x0F, 
-    0x0F, 0x56, 0x2E, 0x2E, 0x0F, 0x2E, 0x2E, 0x56, 0x0F, 0x56, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x4A, 0x24, 0x56, 0x24, 0x2E, 0x53, 0x53, 0x4D, 0x53, 
-    0x32, 0x2D, 0x0F, 0x56, 0x2E, 0x74, 0x78, 0x32, 0x0F, 0x0F, 0x0F, 0x0F, 
-    0x0F, 0x4A, 0x78, 0x74, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x24, 0x24, 
-    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x4A, 0x0E, 0x2E, 0x4A, 0x2E, 
-    0x2E, 0x32, 0x4D, 0x32, 0x56, 0x4A, 0x4A, 0x2E, 0x4A, 0x32, 0x32, 0x32, 
-    0x4A, 0x4D, 0x4D, 0x53, 0x53, 0x53, 0x32, 0x32, 0x2E, 0x53, 0x32, 0x74, 
-    0x74, 0x78, 0x78, 0x77, 0x50, 0x74, 0x77, 0x75, 0x76, 0x76, 0x76, 0x75, 
-    0x4D, 0x4A, 0x32, 0x78, 0x50, 0x78, 0x68, 0x79, 0x4D, 0x4D, 0x78, 0x77, 
-    0x77, 0x73, 0x68, 0x77, 0x32, 0x78, 0x74, 0x77, 0x77, 0x79, 0x79, 0x78, 
-    0x74, 0x74, 0x74, 0x77, 0x77, 0x79, 0x68, 0x78, 0x74, 0x74, 0x78, 0x33, 
-    0xD8, 0x73, 0x52, 0x78, 0x74, 0x79, 0x33, 0x77, 0x33, 0x50, 0x72, 0x72, 
-    0x68, 0x73, 0x33, 0x76, 0x78, 0x78, 0x74, 0x72, 0x68, 0x78, 0x52, 0x7B, 
-    0x77, 0x78, 0x72, 0x72, 0x78, 0x77, 0x52, 0x72, 0x72, 0x73, 0x75, 0x75, 
-    0x78, 0x72, 0x72, 0x52, 0x72, 0x52, 0x75, 0x9F, 0x78, 0x52, 0x72, 0x72, 
-    0x52, 0x72, 0x52, 0x52, 0x78, 0x52, 0x52, 0x72, 0x52, 0x78, 0x78, 0x72, 
-    0x52, 0x72, 0x78, 0x78, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 
-    0x72, 0x75, 0x9F, 0x52, 0x72, 0x78, 0x52, 0x68, 0x72, 0x75, 0x75, 0x52, 
-    0x52, 0x78, 0x52, 0x91, 0x52, 0x68, 0x68, 0x52, 0x72, 0x73, 0x76, 0x76, 
-    0x72, 0x73, 0x9F, 0x9F, 0x72, 0x73, 0x75, 0x76, 0x73, 0x73, 0x9F, 0x9F, 
-    0x52, 0x72, 0x52, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x75, 0x89, 
-    0x9E, 0x9F, 0x9F, 0x9F, 0x52, 0x52, 0x9F, 0x91, 0x75, 0x9F, 0x9F, 0x9F, 
-    0x73, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x72, 0x52, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x72, 0x72, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9E, 0x75, 0x9E, 0x9E, 0x75, 0x9E, 0x9F, 0x9F, 0x9F, 0x9E, 
-    0x75, 0x9F, 0x9E, 0x75, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x75, 0x9E, 0x9E, 
-    0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x75, 0x75, 0x9E, 0x9F, 0x9F, 0x9E, 0x75, 
-    0x75, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0xAD, 
-    0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0xAD, 0xA6, 0x8A, 0x37, 0x01, 0x01, 
-    0x75, 0x9E, 0x96, 0xA6, 0x8A, 0x40, 0x01, 0x0B, 0x76, 0x9E, 0x96, 0xA5, 
-    0x8A, 0x37, 0x01, 0x18, 0xAD, 0x9E, 0x96, 0xA5, 0x8A, 0x36, 0x01, 0x0B, 
-    0x9E, 0x9E, 0x96, 0xA5, 0x8A, 0x36, 0x0B, 0x01, 0x75, 0x9E, 0x96, 0xA5, 
-    0xCE, 0x43, 0x0B, 0x01, 0x9F, 0x9E, 0xAD, 0xA5, 0xCF, 0x35, 0x0B, 0x18, 
-    0x91, 0x96, 0x96, 0xAE, 0x67, 0x1E, 0x01, 0x40, 0x0B, 0x01, 0x0C, 0x6F, 
-    0xDE, 0x6D, 0xC0, 0xCA, 0x01, 0x18, 0x36, 0x7E, 0x5E, 0xC8, 0xE6, 0xE6, 
-    0x01, 0x39, 0x6F, 0x85, 0xC1, 0xCB, 0xCA, 0xE6, 0x18, 0x57, 0x84, 0x6D, 
-    0xCA, 0xE6, 0xE6, 0xE5, 0x18, 0x83, 0x9A, 0x97, 0xE5, 0xE6, 0xE6, 0xE5, 
-    0x61, 0xDE, 0xE3, 0x6E, 0xE5, 0xE6, 0xE6, 0xE6, 0x84, 0x9A, 0xCA, 0xE4, 
-    0xE6, 0xE6, 0xE6, 0xEC, 0xDD, 0xDD, 0xE4, 0xE6, 0xE6, 0xE6, 0xEB, 0xF0, 
-    0xE6, 0xE6, 0xE6, 0xE5, 0xC0, 0x33, 0x8D, 0x7B, 0xE6, 0xE6, 0xE6, 0xE7, 
-    0x33, 0x89, 0x8D, 0x7B, 0xE6, 0xE6, 0xE6, 0xF0, 0x9F, 0x89, 0x8D, 0x8C, 
-    0xE6, 0xE6, 0xEB, 0x7B, 0x9E, 0x89, 0x8D, 0x8C, 0xE6, 0xED, 0xD7, 0x9E, 
-    0xAD, 0x91, 0x98, 0x94, 0xEB, 0xB3, 0xA2, 0x9E, 0xAD, 0x96, 0x96, 0x7B, 
-    0x92, 0xA8, 0xA2, 0xAD, 0xAD, 0xAD, 0xAD, 0x89, 0xAD, 0xA4, 0xA4, 0x9E, 
-    0xAD, 0x76, 0x9E, 0x8C, 0xB8, 0xB8, 0xF1, 0x6D, 0xE2, 0x6E, 0xC8, 0xC2, 
-    0xA6, 0xB8, 0xBD, 0xF1, 0xC0, 0xCA, 0xC0, 0x80, 0xB8, 0xA6, 0xB8, 0xB8, 
-    0xC5, 0xEB, 0x71, 0x61, 0xB8, 0xB8, 0xB8, 0xB8, 0xA6, 0x33, 0x6B, 0x86, 
-    0xB8, 0xB8, 0xA6, 0xA9, 0xA5, 0x9E, 0xE0, 0xC2, 0xB8, 0xB8, 0xA9, 0xA9, 
-    0xA6, 0xAD, 0x68, 0xE8, 0xB8, 0xB8, 0xB7, 0xB8, 0xA6, 0xAD, 0xAD, 0xD7, 
-    0xB8, 0xA6, 0xB7, 0xB8, 0xA0, 0x75, 0x96, 0xAD, 0xCB, 0x45, 0xE7, 0xF2, 
-    0xF2, 0xC2, 0xC1, 0xE3, 0x36, 0x25, 0x21, 0x6B, 0x66, 0xD9, 0xF2, 0xE9, 
-    0x38, 0x0E, 0x35, 0x8F, 0xE1, 0x66, 0x71, 0xEF, 0x5A, 0x39, 0x40, 0xE3, 
-    0x9C, 0x84, 0xE1, 0x71, 0xC0, 0x5A, 0x8F, 0x6E, 0xBF, 0xBF, 0x6E, 0x84, 
-    0xE9, 0x64, 0x8F, 0x71, 0xC2, 0xE5, 0xE4, 0x9D, 0xF3, 0x37, 0x39, 0x0B, 
-    0x80, 0xCB, 0xC2, 0xE4, 0x79, 0x42, 0x38, 0x1F, 0x61, 0x8F, 0x40, 0xC2, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xE3, 0x6D, 0xC8, 0xC0, 0xC0, 0xCB, 0xC8, 
-    0xC0, 0xC9, 0xEB, 0xED, 0xED, 0xEC, 0xEC, 0xEC, 0xE5, 0xED, 0xE8, 0x71, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE1, 0xDC, 0xE1, 0xE1, 0xDC, 0xDC, 
-    0xDC, 0xDC, 0xE3, 0x9C, 0x6D, 0x6D, 0x6D, 0x9C, 0x9C, 0x6D, 0xCA, 0xE4, 
-    0xCA, 0xCA, 0xC8, 0xCA, 0xCA, 0xCA, 0xE4, 0xC0, 0xE5, 0xE5, 0xE5, 0xE5, 
-    0xE5, 0xEB, 0x71, 0xE1, 0xED, 0xE5, 0xE9, 0x6B, 0xE8, 0xCA, 0xC8, 0x86, 
-    0xE8, 0x81, 0x31, 0x01, 0x16, 0x81, 0xCB, 0xCA, 0xDC, 0x8F, 0x39, 0x1E, 
-    0x1F, 0x61, 0x71, 0xCA, 0x65, 0x9B, 0x66, 0x39, 0x66, 0x5A, 0x71, 0x33, 
-    0xBF, 0xC1, 0x5A, 0xE1, 0x70, 0xC8, 0xD5, 0xAD, 0xE6, 0xE8, 0x8F, 0x59, 
-    0xCB, 0xE4, 0xD8, 0xAD, 0x80, 0x45, 0x25, 0x38, 0xEA, 0xC5, 0xBD, 0xAD, 
-    0x40, 0x30, 0x1F, 0x37, 0xD8, 0x96, 0x96, 0xAD, 0xE2, 0xE2, 0xD6, 0xA9, 
-    0x94, 0x9F, 0x91, 0x94, 0xCA, 0xE7, 0xB8, 0xB8, 0xA2, 0x9F, 0x91, 0x94, 
-    0xEB, 0xAA, 0xB8, 0xB8, 0xA2, 0x9F, 0x91, 0x8C, 0xB6, 0xB8, 0xB8, 0xB8, 
-    0xA2, 0x9E, 0x91, 0x94, 0xA4, 0xB8, 0xB8, 0xB8, 0xA2, 0x9E, 0x91, 0x94, 
-    0xA4, 0xB8, 0xB8, 0xB8, 0xA2, 0x9E, 0x91, 0x8C, 0xA4, 0xB8, 0xB8, 0xB8, 
-    0xA2, 0x9F, 0x91, 0x94, 0xA4, 0xB8, 0xB8, 0xB8, 0xA2, 0x9F, 0x91, 0x94, 
-    0x92, 0xEC, 0xE6, 0xE6, 0xE6, 0xE4, 0xCA, 0xBF, 0xA5, 0xB6, 0xE5, 0x27, 
-    0xE6, 0x27, 0xE6, 0xCA, 0xB5, 0xA9, 0xE5, 0xE6, 0xE6, 0xE6, 0xE6, 0xCA, 
-    0xB5, 0xA9, 0xD4, 0xE5, 0xE6, 0xE6, 0xE6, 0xE5, 0xB5, 0x93, 0xD7, 0xEE, 
-    0xE6, 0xE6, 0xE6, 0xE6, 0xA3, 0x93, 0xA2, 0xF0, 0xEF, 0xE6, 0xE6, 0xE6, 
-    0xA3, 0x93, 0xA2, 0x9F, 0xD8, 0xED, 0xE6, 0xE5, 0xA3, 0x93, 0xA2, 0x9E, 
-    0xAD, 0xF0, 0xEB, 0xE6, 0xDE, 0x6A, 0x38, 0x0C, 0x0B, 0x01, 0x0B, 0x26, 
-    0x64, 0x7E, 0x44, 0x0C, 0x0C, 0x0B, 0x01, 0x26, 0xCA, 0xE3, 0x84, 0x38, 
-    0x18, 0x01, 0x01, 0x37, 0xCA, 0xE3, 0x7F, 0x6A, 0x39, 0x01, 0x1E, 0x37, 
-    0xE6, 0xBF, 0x7F, 0x6A, 0x18, 0x01, 0x0B, 0x26, 0xE6, 0xC0, 0x9A, 0x83, 
-    0x38, 0x01, 0x01, 0x69, 0xE6, 0xE6, 0xC2, 0x7F, 0x8F, 0x0B, 0x0B, 0x20, 
-    0xE5, 0xE6, 0xE6, 0x7D, 0x7E, 0x38, 0x1E, 0x01, 0x6C, 0x63, 0xAD, 0x9E, 
-    0x9E, 0xAD, 0x9E, 0x9E, 0x6C, 0x33, 0x9E, 0x9E, 0xAD, 0x9E, 0x9E, 0xAD, 
-    0x6C, 0x33, 0x9E, 0x9E, 0xAD, 0x9E, 0x9E, 0xAD, 0x6C, 0x33, 0xAD, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x6C, 0x67, 0xAD, 0x9E, 0x9E, 0xAD, 0x9E, 0x9E, 
-    0xE0, 0x76, 0xAD, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x99, 0x76, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0xAD, 0x9E, 0x77, 0x96, 0xAD, 0xAD, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x73, 0x73, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x73, 0x77, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x77, 0x77, 
-    0x9E, 0x9E, 0x9E, 0x75, 0x9F, 0x73, 0x52, 0x77, 0x9E, 0x9E, 0x75, 0x75, 
-    0x9F, 0x9F, 0x9F, 0x73, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9E, 0x9F, 0x73, 
-    0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x73, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9F, 0x9F, 0x77, 0x52, 0x72, 0x77, 0x73, 0x73, 0x72, 0x50, 
-    0x77, 0x52, 0x72, 0x52, 0x78, 0x72, 0x52, 0x72, 0x77, 0x52, 0x72, 0x52, 
-    0x78, 0x72, 0x52, 0x52, 0x77, 0x52, 0x72, 0x72, 0x52, 0x52, 0x52, 0x52, 
-    0x77, 0x77, 0x52, 0x52, 0x32, 0x78, 0x52, 0x52, 0x73, 0x52, 0x78, 0x78, 
-    0x53, 0x50, 0x9F, 0x52, 0x77, 0x77, 0x50, 0x53, 0x53, 0x50, 0x9F, 0x52, 
-    0x74, 0x78, 0x4E, 0x4A, 0x53, 0x50, 0x52, 0x73, 0x78, 0x52, 0x52, 0x52, 
-    0x75, 0x73, 0x32, 0x32, 0x52, 0x73, 0x52, 0x52, 0x78, 0x78, 0x78, 0x72, 
-    0x78, 0x73, 0x52, 0x72, 0x74, 0x50, 0x72, 0x52, 0x78, 0x73, 0x73, 0x72, 
-    0x72, 0x52, 0x73, 0x73, 0x72, 0x52, 0x73, 0x72, 0x72, 0x75, 0x9E, 0x52, 
-    0x78, 0x52, 0x52, 0x72, 0xCC, 0x76, 0x9F, 0x72, 0x78, 0x52, 0x73, 0x73, 
-    0x73, 0x52, 0x72, 0x72, 0x52, 0x52, 0x52, 0x73, 0x73, 0x73, 0x72, 0x32, 
-    0x50, 0x50, 0x50, 0x50, 0x32, 0x32, 0x4E, 0x32, 0x72, 0x72, 0x74, 0x72, 
-    0x50, 0x50, 0x78, 0x52, 0x52, 0x52, 0x52, 0x72, 0x50, 0x32, 0x50, 0x52, 
-    0x52, 0x52, 0x52, 0x52, 0x72, 0x74, 0x74, 0x72, 0x75, 0x73, 0x72, 0x52, 
-    0x52, 0x72, 0x75, 0x73, 0x68, 0x75, 0x72, 0x52, 0x52, 0x77, 0x74, 0x78, 
-    0x52, 0x52, 0x52, 0x52, 0x78, 0x74, 0x32, 0x4D, 0x72, 0x72, 0x72, 0x52, 
-    0x78, 0x4D, 0x53, 0x4A, 0x74, 0x72, 0x74, 0x74, 0x50, 0x4A, 0x32, 0x75, 
-    0x52, 0x52, 0x74, 0x74, 0x32, 0x4D, 0x67, 0x68, 0x75, 0x73, 0x4E, 0x4E, 
-    0x50, 0x76, 0x68, 0x52, 0x72, 0x74, 0x4E, 0x9F, 0x8C, 0x89, 0x76, 0x78, 
-    0x74, 0x78, 0x4E, 0x91, 0xA2, 0x96, 0x75, 0x74, 0x4E, 0x72, 0x76, 0x91, 
-    0x7B, 0x76, 0x77, 0x74, 0x4A, 0x68, 0xA2, 0x7B, 0x76, 0x77, 0x74, 0x32, 
-    0x76, 0x94, 0x7B, 0x96, 0x75, 0x74, 0x32, 0x53, 0x78, 0x32, 0x2E, 0x0F, 
-    0x0F, 0x0F, 0x0F, 0x0E, 0x77, 0x53, 0x56, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 
-    0x74, 0x53, 0x56, 0x0F, 0x24, 0x56, 0x0F, 0x0F, 0x74, 0x53, 0x0F, 0x0F, 
-    0x4D, 0x4A, 0x56, 0x0F, 0x74, 0x2E, 0x0F, 0x56, 0x77, 0x74, 0x2E, 0x0F, 
-    0x32, 0x2E, 0x56, 0x56, 0x74, 0x74, 0x56, 0x0E, 0x2E, 0x56, 0x2E, 0x32, 
-    0x4E, 0x4A, 0x56, 0x0E, 0x53, 0x24, 0x2E, 0x73, 0x32, 0x2E, 0x0F, 0x0E, 
-    0x56, 0x2E, 0x2E, 0x2E, 0x53, 0x32, 0x50, 0x32, 0x0F, 0x2E, 0x24, 0x2E, 
-    0x74, 0x32, 0x50, 0x32, 0x56, 0x2E, 0x24, 0x2E, 0x74, 0x32, 0x32, 0x50, 
-    0x56, 0x23, 0x0F, 0x53, 0x73, 0x32, 0x32, 0x50, 0x56, 0x2E, 0x24, 0x53, 
-    0x73, 0x32, 0x32, 0x32, 0x56, 0x56, 0x0E, 0x53, 0x75, 0x72, 0x32, 0x32, 
-    0x56, 0x2E, 0x0E, 0x2E, 0x67, 0x75, 0x72, 0x32, 0x24, 0x2E, 0x23, 0x0F, 
-    0x2E, 0x67, 0x73, 0x74, 0x53, 0x53, 0x2E, 0x4A, 0x4A, 0x2E, 0x2E, 0x56, 
-    0x32, 0x53, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x32, 0x4A, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x50, 0x53, 0x2E, 0x2E, 0x13, 0x2E, 0x2E, 0x2E, 
-    0x50, 0x32, 0x53, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x50, 0x50, 0x50, 0x50, 
-    0x53, 0x2E, 0x2E, 0x2E, 0x32, 0x32, 0x50, 0x50, 0x4E, 0x4E, 0x53, 0x2E, 
-    0x74, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x4E, 0x0E, 0x0E, 0x24, 0x32, 
-    0x32, 0x50, 0x50, 0x53, 0x0E, 0x0C, 0x0E, 0x24, 0x2E, 0x53, 0x4A, 0x4D, 
-    0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0F, 0x2E, 0x4A, 0x2E, 0x2E, 0x0F, 0x0E, 
-    0x0C, 0x0E, 0x0F, 0x0F, 0x2E, 0x4A, 0x2E, 0x0F, 0x0E, 0x0C, 0x0C, 0x0C, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x0F, 0x0E, 0x0C, 0x0C, 0x2E, 0x2E, 0x2E, 0x4A, 
-    0x2E, 0x2E, 0x0E, 0x0C, 0x4A, 0x2E, 0x2E, 0x4A, 0x4A, 0x2E, 0x0E, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x18, 0x20, 0x20, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0E, 0x21, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0B, 0x16, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0F, 0x17, 
-    0x0B, 0x0E, 0x0B, 0x01, 0x0B, 0x21, 0x17, 0x0E, 0x0C, 0x0E, 0x0B, 0x01, 
-    0x0E, 0x17, 0x35, 0x17, 0x0B, 0x0C, 0x0B, 0x0B, 0x34, 0x19, 0x3E, 0x3F, 
-    0x0B, 0x0B, 0x01, 0x0E, 0x0E, 0x35, 0x3F, 0x60, 0x16, 0x39, 0x18, 0x0F, 
-    0x5C, 0x6A, 0x7F, 0x65, 0x5C, 0x3E, 0x36, 0x0C, 0x34, 0x38, 0x85, 0x9C, 
-    0x3F, 0x3F, 0x3F, 0x39, 0x1B, 0x44, 0xE2, 0x7D, 0x3E, 0x5D, 0x6A, 0x59, 
-    0x5E, 0x65, 0x7D, 0x97, 0x0E, 0x26, 0x60, 0x58, 0x5E, 0x7D, 0x9D, 0x97, 
-    0x1A, 0x17, 0x6A, 0x7E, 0x85, 0x9C, 0x9D, 0x6E, 0x3F, 0x3F, 0x6A, 0x7E, 
-    0x86, 0x5A, 0x39, 0x0E, 0x82, 0x3F, 0x57, 0x9C, 0xBF, 0x6E, 0x01, 0x25, 
-    0x97, 0x6B, 0x25, 0x0F, 0x0E, 0x0E, 0x0E, 0x0C, 0x97, 0x66, 0x1E, 0x0E, 
-    0x0B, 0x0E, 0x0F, 0x0E, 0x71, 0x21, 0x25, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 
-    0x18, 0x1E, 0x24, 0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x39, 0x1E, 0x4A, 0x24, 
-    0x10, 0x0F, 0x0E, 0x0E, 0x18, 0x1E, 0x4A, 0x2E, 0x10, 0x0F, 0x0E, 0x0E, 
-    0x24, 0x56, 0x2E, 0x53, 0x0F, 0x0E, 0x0E, 0x0F, 0x2E, 0x4D, 0x32, 0x2E, 
-    0x0F, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x56, 0x2E, 0x2E, 
-    0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x2E, 0x2E, 0x2E, 0x0E, 0x0E, 0x0F, 0x56, 
-    0x56, 0x2E, 0x2E, 0x53, 0x0E, 0x0E, 0x0F, 0x2E, 0x2E, 0x4A, 0x74, 0x32, 
-    0x0E, 0x0E, 0x0F, 0x24, 0x2E, 0x32, 0x32, 0x53, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0F, 0x56, 0x2E, 0x4E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x53, 0x73, 
-    0x0E, 0x0E, 0x0E, 0x0F, 0x4A, 0x32, 0x72, 0x73, 0x2E, 0x53, 0x53, 0x32, 
-    0x2E, 0x24, 0x4E, 0x50, 0x32, 0x32, 0x2E, 0x53, 0x32, 0x4A, 0x4E, 0x50, 
-    0x74, 0x53, 0x53, 0x73, 0x78, 0x4D, 0x50, 0x50, 0x2E, 0x4D, 0x52, 0x75, 
-    0x50, 0x4A, 0x32, 0x50, 0x2E, 0x74, 0x73, 0x72, 0x4E, 0x4E, 0x32, 0x32, 
-    0x74, 0x73, 0x73, 0x4D, 0x4A, 0x32, 0x78, 0x74, 0x52, 0x50, 0x4E, 0x53, 
-    0x53, 0x53, 0x78, 0x74, 0x50, 0x4D, 0x53, 0x4E, 0x4D, 0x50, 0x50, 0x78, 
-    0x74, 0x4E, 0x53, 0x4A, 0x53, 0x32, 0x74, 0x74, 0x74, 0x67, 0x68, 0x68, 
-    0x68, 0x4E, 0x4A, 0x56, 0x78, 0x72, 0x78, 0x72, 0x78, 0x2E, 0x2E, 0x56, 
-    0x78, 0x32, 0x32, 0x73, 0x73, 0x2E, 0x4A, 0x4E, 0x78, 0x78, 0x4E, 0x68, 
-    0x79, 0x4A, 0x4E, 0x77, 0x32, 0x78, 0x96, 0x76, 0x4E, 0x24, 0x4A, 0x4E, 
-    0x78, 0x75, 0x98, 0x76, 0x25, 0x24, 0x4A, 0x53, 0x76, 0x76, 0x7B, 0x68, 
-    0x56, 0x24, 0x4A, 0x50, 0x72, 0x75, 0x68, 0x68, 0x68, 0x68, 0x91, 0x52, 
-    0x2E, 0x4A, 0x4D, 0x50, 0x50, 0x78, 0x75, 0x77, 0x56, 0x56, 0x24, 0x4A, 
-    0x53, 0x32, 0x75, 0x77, 0x4D, 0x4A, 0x56, 0x4D, 0x32, 0x50, 0x75, 0x77, 
-    0x50, 0x73, 0x32, 0x56, 0x2E, 0x4E, 0x78, 0x74, 0x50, 0x68, 0x74, 0x24, 
-    0x4A, 0x4A, 0x2E, 0x53, 0x78, 0x68, 0x75, 0x67, 0x74, 0x4A, 0x2E, 0x32, 
-    0x50, 0x76, 0x73, 0x72, 0x74, 0x72, 0x72, 0x50, 0x78, 0x72, 0x9F, 0x68, 
-    0x77, 0x72, 0x72, 0x72, 0x74, 0x52, 0x76, 0x75, 0x78, 0x74, 0x72, 0x72, 
-    0x78, 0x9F, 0x68, 0x77, 0x78, 0x74, 0x72, 0x78, 0x78, 0x67, 0x77, 0x78, 
-    0x74, 0x74, 0x72, 0x72, 0x52, 0x75, 0x52, 0x32, 0x78, 0x74, 0x78, 0x67, 
-    0x50, 0x73, 0x74, 0x32, 0x74, 0x72, 0x52, 0x73, 0x32, 0x74, 0x32, 0x32, 
-    0x50, 0x9F, 0x68, 0x72, 0x53, 0x53, 0x32, 0x78, 0x73, 0x73, 0x52, 0x72, 
-    0x52, 0x52, 0x52, 0x91, 0x9F, 0x73, 0x91, 0x76, 0x78, 0x68, 0x75, 0x75, 
-    0x52, 0x72, 0x91, 0x68, 0x72, 0x91, 0x75, 0x50, 0x74, 0x72, 0x91, 0x76, 
-    0x72, 0x68, 0x73, 0x72, 0x72, 0x72, 0x91, 0x76, 0x75, 0x72, 0x74, 0x72, 
-    0x72, 0x9F, 0x91, 0x76, 0x73, 0x72, 0x72, 0x72, 0x76, 0x76, 0x76, 0x9F, 
-    0x72, 0x74, 0x72, 0x72, 0x89, 0x75, 0x50, 0x52, 0x72, 0x72, 0x72, 0x72, 
-    0x89, 0x75, 0x51, 0x52, 0x52, 0x52, 0x52, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x52, 0x75, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x75, 0x75, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x73, 0x73, 0x52, 0x52, 0x73, 0x9F, 
-    0x73, 0x73, 0x73, 0x73, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x73, 0x73, 
-    0x52, 0x52, 0x52, 0x52, 0x73, 0x52, 0x73, 0x72, 0x52, 0x73, 0x52, 0x52, 
-    0x9F, 0x52, 0x52, 0x78, 0x72, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9E, 0x9F, 
-    0x9E, 0x9E, 0x9F, 0x96, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0x76, 
-    0x9F, 0x9F, 0x9F, 0x9E, 0x75, 0x9F, 0x68, 0xCE, 0x9F, 0x9F, 0x9E, 0x9E, 
-    0x9F, 0x9F, 0x68, 0x99, 0x9F, 0x9F, 0x9F, 0x75, 0x9E, 0x9F, 0x79, 0x63, 
-    0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x68, 0x99, 0x9F, 0x9F, 0x9E, 0x9E, 
-    0x9F, 0x99, 0x3D, 0x0F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x54, 0x37, 0x0E, 
-    0xAE, 0xBC, 0xAE, 0xBC, 0x73, 0x1E, 0x0B, 0x16, 0x88, 0x88, 0xA3, 0x98, 
-    0x2E, 0x0C, 0x0C, 0x0C, 0x69, 0x3D, 0x8E, 0x79, 0x0B, 0x0C, 0x0C, 0x40, 
-    0x38, 0x1F, 0x62, 0xCF, 0x0E, 0x0C, 0x0C, 0x57, 0x1A, 0x17, 0x17, 0x62, 
-    0x0E, 0x0B, 0x0B, 0x39, 0x10, 0x1A, 0x10, 0x23, 0x0E, 0x0B, 0x0B, 0x01, 
-    0x1A, 0x13, 0x0F, 0x0F, 0x0E, 0x0B, 0x0B, 0x0B, 0x17, 0x1A, 0x0E, 0x0B, 
-    0x0B, 0x0B, 0x0B, 0x18, 0x40, 0x8F, 0x80, 0xE8, 0x80, 0xE7, 0xC5, 0x7B, 
-    0x39, 0x61, 0x61, 0xDC, 0xDC, 0x6B, 0x92, 0x7B, 0x83, 0xE2, 0x6E, 0xC0, 
-    0x9D, 0x6D, 0x81, 0x96, 0x9A, 0x9D, 0xE5, 0xE6, 0xE4, 0xD2, 0x3A, 0xAD, 
-    0x58, 0x86, 0xE9, 0xCA, 0xD3, 0xB7, 0x96, 0xAD, 0x0B, 0x18, 0x18, 0x0F, 
-    0x68, 0xB5, 0x96, 0xAD, 0x16, 0x36, 0x54, 0xD7, 0xA4, 0xB5, 0x7B, 0xAD, 
-    0x18, 0x18, 0x0F, 0x74, 0x7B, 0xA6, 0x7B, 0x9E, 0x73, 0xA4, 0xA4, 0x9E, 
-    0x76, 0xAD, 0x9E, 0x94, 0x9E, 0xA2, 0xA2, 0xAD, 0xAD, 0xAD, 0x9E, 0x7B, 
-    0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8C, 0xAD, 0x76, 0x9E, 0xAD, 
-    0x76, 0xAD, 0x9E, 0x8C, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x9E, 0x7B, 
-    0xAD, 0xAD, 0x76, 0x76, 0xAD, 0xAD, 0xAD, 0x94, 0xAD, 0x76, 0xAD, 0xAD, 
-    0xAD, 0xAD, 0x9E, 0x7B, 0xAD, 0xAD, 0xAD, 0x76, 0x76, 0xAD, 0xAD, 0xAD, 
-    0xB8, 0xA5, 0xB7, 0xB8, 0xA0, 0x9E, 0x76, 0x96, 0xB8, 0xB8, 0xA3, 0xB8, 
-    0xA0, 0xAD, 0x76, 0x96, 0xA3, 0xB8, 0xB8, 0xB8, 0xA0, 0x9E, 0xAD, 0x91, 
-    0xB8, 0xB8, 0xB8, 0xB8, 0xAE, 0xAD, 0xAD, 0x79, 0xB8, 0xB8, 0xB8, 0xB8, 
-    0xA4, 0xAD, 0xAD, 0x88, 0xB8, 0xB7, 0xA9, 0xA7, 0xA4, 0xAD, 0xAD, 0x79, 
-    0x93, 0xBD, 0x8A, 0xCE, 0xD7, 0x76, 0xAD, 0x68, 0xA8, 0xCD, 0x61, 0x99, 
-    0xBC, 0x96, 0x91, 0xCF, 0x89, 0x87, 0x57, 0x39, 0x64, 0x85, 0xE1, 0x5A, 
-    0xCF, 0x87, 0x57, 0x45, 0x6D, 0x9C, 0x9C, 0xE2, 0xD0, 0x36, 0x13, 0x16, 
-    0xD2, 0xC2, 0xC8, 0xC1, 0xD0, 0x6F, 0x38, 0x34, 0x45, 0x86, 0xC2, 0xE4, 
-    0x90, 0x84, 0x8F, 0x34, 0x1B, 0x6F, 0x6F, 0xD2, 0x95, 0x6F, 0x57, 0x30, 
-    0x8F, 0x7F, 0xDC, 0xDC, 0x62, 0x3B, 0x17, 0x46, 0x6E, 0x6D, 0x5E, 0xDD, 
-    0x3D, 0x3B, 0x3B, 0x61, 0x86, 0xC2, 0xCA, 0xC1, 0xE9, 0xCB, 0xCB, 0xCB, 
-    0xCB, 0x80, 0xE1, 0xE2, 0xE1, 0xE1, 0x66, 0xE1, 0xE1, 0x71, 0xBF, 0xBF, 
-    0xBF, 0xBF, 0xC0, 0xC1, 0xC1, 0xC1, 0xC8, 0xCA, 0xCA, 0xE4, 0xE4, 0xE4, 
-    0xE4, 0xE4, 0xC2, 0x80, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xCA, 0x86, 0x38, 
-    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x66, 0x8F, 0x7E, 0x84, 0xDC, 0x84, 0x84, 
-    0xDC, 0xE2, 0x85, 0x5F, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xBF, 0xE4, 0xCA, 
-    0x6D, 0x40, 0x21, 0x5D, 0x8A, 0x96, 0xAD, 0xAD, 0xBF, 0x58, 0x1B, 0x5D, 
-    0xE0, 0x7B, 0x96, 0xAD, 0xC1, 0x61, 0x3B, 0x1B, 0xE0, 0xD8, 0x96, 0xAD, 
-    0x6B, 0x1E, 0x38, 0x8F, 0x64, 0xD5, 0x96, 0xAD, 0x17, 0x25, 0x37, 0xDE, 
-    0x85, 0x80, 0x96, 0xAD, 0x59, 0x1F, 0x40, 0xDC, 0xE2, 0xE0, 0x96, 0xAD, 
-    0x6D, 0x60, 0x38, 0x16, 0x16, 0x99, 0x79, 0xAD, 0x6E, 0x61, 0x17, 0x17, 
-    0x1A, 0xCF, 0x88, 0x9E, 0xA4, 0xB8, 0xB8, 0xB8, 0xA2, 0x9E, 0x91, 0x94, 
-    0xA4, 0xB8, 0xB8, 0xB8, 0xA2, 0x9F, 0x91, 0x8C, 0xA4, 0xB8, 0xB8, 0xB8, 
-    0xA2, 0x9E, 0x96, 0xAD, 0xA4, 0xB8, 0xB8, 0xB8, 0xA2, 0xAD, 0xAD, 0xAD, 
-    0xA4, 0xB8, 0xB8, 0xB8, 0xA2, 0xAD, 0x96, 0xAD, 0xA4, 0xA7, 0xA7, 0x93, 
-    0xA2, 0x9E, 0x76, 0xAD, 0xA4, 0xA3, 0x8A, 0xCE, 0xA8, 0xAD, 0x76, 0x96, 
-    0xA4, 0xAE, 0x45, 0x5D, 0x8A, 0xAD, 0xAD, 0x76, 0x7B, 0x93, 0xA2, 0x9E, 
-    0x96, 0x9F, 0xF1, 0xEE, 0x96, 0xA3, 0xA2, 0x9E, 0x76, 0x96, 0xD8, 0x5B, 
-    0x96, 0x93, 0xA2, 0x9E, 0xAD, 0xAD, 0x33, 0x64, 0x91, 0xA3, 0xA2, 0xAD, 
-    0x96, 0xAD, 0x3A, 0xD2, 0x96, 0xA5, 0xA2, 0xAD, 0xAD, 0x96, 0x9E, 0x7B, 
-    0x96, 0xA5, 0xA2, 0xAD, 0xAD, 0x96, 0xAD, 0x94, 0x96, 0xA5, 0xA2, 0xAD, 
-    0x96, 0xAD, 0xAD, 0xA8, 0x96, 0xA5, 0xA2, 0xAD, 0x96, 0x96, 0xAD, 0x94, 
-    0xD5, 0xE8, 0xE8, 0x46, 0x26, 0x30, 0x0B, 0x0B, 0x61, 0x8F, 0x44, 0x38, 
-    0x17, 0x1F, 0x0B, 0x01, 0x9B, 0xBF, 0xBF, 0x86, 0x6F, 0x44, 0x0B, 0x25, 
-    0xC8, 0xE6, 0xE6, 0xC8, 0x65, 0x57, 0x01, 0x0F, 0xDF, 0xE4, 0xE4, 0xE8, 
-    0x46, 0x39, 0x0B, 0x23, 0x8D, 0x04, 0x0B, 0x1F, 0x1F, 0x1E, 0x0C, 0x10, 
-    0xB5, 0x88, 0x3D, 0x1E, 0x34, 0x25, 0x0E, 0x16, 0xB5, 0x99, 0x19, 0x34, 
-    0x34, 0x0C, 0x0B, 0x0E, 0x77, 0xB6, 0xBC, 0xA8, 0x9F, 0x75, 0x9E, 0x9E, 
-    0x73, 0x88, 0xCF, 0x98, 0x9E, 0x9E, 0x9E, 0x9E, 0x88, 0x63, 0x23, 0x8A, 
-    0x8A, 0x9F, 0x9F, 0x9E, 0x99, 0x13, 0x3B, 0x37, 0x42, 0x75, 0x9E, 0x9E, 
-    0x20, 0x34, 0x13, 0x26, 0x54, 0x75, 0x9F, 0x9E, 0x10, 0x3B, 0x34, 0x20, 
-    0x54, 0x73, 0x9E, 0x9E, 0x17, 0x30, 0x1A, 0x0E, 0x19, 0x5C, 0x63, 0x9E, 
-    0x19, 0x17, 0x1F, 0x0E, 0x17, 0x7E, 0x69, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9E, 0x9E, 0x9F, 0x73, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x73, 
-    0x9E, 0x9E, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0x9E, 0x9E, 0x9F, 0x75, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x75, 0x52, 0x73, 0x9F, 0x9F, 0x73, 0x73, 
-    0x9E, 0x9E, 0x9F, 0x75, 0x73, 0x73, 0x73, 0x73, 0x75, 0x9E, 0x75, 0x9F, 
-    0x73, 0x52, 0x52, 0x73, 0x9E, 0x9E, 0x75, 0x9F, 0x52, 0x73, 0x9F, 0x9F, 
-    0x74, 0x78, 0x50, 0x53, 0x53, 0x78, 0x9F, 0x73, 0x74, 0x74, 0x77, 0x4E, 
-    0x53, 0x78, 0x77, 0x9F, 0x77, 0x52, 0x74, 0x4E, 0x53, 0x32, 0x78, 0x9F, 
-    0x73, 0x73, 0x52, 0x78, 0x32, 0x53, 0x50, 0x9F, 0x9F, 0x73, 0x52, 0x52, 
-    0x74, 0x53, 0x4E, 0x72, 0x73, 0x73, 0x52, 0x52, 0x72, 0x32, 0x4E, 0x78, 
-    0x73, 0x9F, 0x52, 0x78, 0x72, 0x74, 0x50, 0x50, 0x9F, 0x9F, 0x52, 0x32, 
-    0x74, 0x77, 0x32, 0x2E, 0x52, 0x78, 0x52, 0x73, 0x52, 0x52, 0x73, 0x72, 
-    0x52, 0x78, 0x73, 0x52, 0x50, 0x72, 0x73, 0x72, 0x9F, 0x72, 0x72, 0x72, 
-    0x78, 0x50, 0x50, 0x50, 0x52, 0x78, 0x50, 0x72, 0x74, 0x72, 0x72, 0x32, 
-    0x52, 0x72, 0x74, 0x78, 0x73, 0x73, 0x72, 0x74, 0x73, 0x72, 0x74, 0x50, 
-    0x74, 0x73, 0x50, 0x50, 0x74, 0x72, 0x52, 0x50, 0x74, 0x73, 0x72, 0x75, 
-    0x32, 0x72, 0x52, 0x72, 0x50, 0x50, 0x73, 0x68, 0x72, 0x72, 0x72, 0x78, 
-    0x78, 0x4A, 0x2E, 0x68, 0x74, 0x72, 0x72, 0x74, 0x4D, 0x56, 0x4D, 0x98, 
-    0x50, 0x72, 0x74, 0x50, 0x4D, 0x2E, 0x4A, 0x8C, 0x32, 0x74, 0x50, 0x4E, 
-    0x52, 0x72, 0x50, 0x79, 0x32, 0x53, 0x78, 0x73, 0x91, 0x96, 0x52, 0x67, 
-    0x52, 0x72, 0x75, 0x76, 0x91, 0x91, 0x78, 0x4D, 0x79, 0x68, 0x76, 0xAD, 
-    0x76, 0x75, 0x51, 0x4A, 0x52, 0x72, 0x72, 0x72, 0x74, 0x50, 0x53, 0x74, 
-    0x8C, 0x94, 0x7B, 0x74, 0x74, 0x50, 0x53, 0x53, 0xA8, 0x7B, 0x7B, 0x77, 
-    0x78, 0x50, 0x53, 0x56, 0x7B, 0x77, 0x77, 0x78, 0x78, 0x32, 0x56, 0x0E, 
-    0x76, 0x74, 0x32, 0x32, 0x32, 0x4A, 0x24, 0x0F, 0x75, 0x52, 0x78, 0x32, 
-    0x2E, 0x0F, 0x0F, 0x24, 0x53, 0x53, 0x4A, 0x56, 0x24, 0x24, 0x24, 0x2E, 
-    0x24, 0x0F, 0x0F, 0x0F, 0x56, 0x4A, 0x4A, 0x2E, 0x74, 0x53, 0x2E, 0x0F, 
-    0x2E, 0x32, 0x32, 0x4A, 0x2E, 0x0F, 0x2E, 0x32, 0x4A, 0x56, 0x0F, 0x0E, 
-    0x0E, 0x2E, 0x4A, 0x56, 0x24, 0x0E, 0x0F, 0x0E, 0x0F, 0x2E, 0x56, 0x24, 
-    0x24, 0x0F, 0x0F, 0x0E, 0x0F, 0x0F, 0x0F, 0x56, 0x2E, 0x56, 0x0F, 0x0F, 
-    0x56, 0x0E, 0x0F, 0x2E, 0x4D, 0x2E, 0x0E, 0x0E, 0x2E, 0x24, 0x56, 0x4A, 
-    0x4A, 0x2E, 0x0E, 0x0E, 0x2E, 0x24, 0x24, 0x2E, 0x2E, 0x0F, 0x0E, 0x0E, 
-    0x2E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x10, 
-    0x25, 0x2E, 0x74, 0x73, 0x0E, 0x0F, 0x0F, 0x23, 0x2E, 0x25, 0x2E, 0x4A, 
-    0x0E, 0x0F, 0x0F, 0x2E, 0x2E, 0x0C, 0x0E, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 
-    0x10, 0x0E, 0x0E, 0x0E, 0x0F, 0x0E, 0x0C, 0x0F, 0x23, 0x0F, 0x0E, 0x0E, 
-    0x2E, 0x0F, 0x0E, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x2E, 0x0F, 0x0F, 0x0E, 
-    0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 
-    0x74, 0x74, 0x74, 0x73, 0x67, 0x73, 0x74, 0x73, 0x4A, 0x4A, 0x56, 0x2E, 
-    0x53, 0x2E, 0x2E, 0x53, 0x4A, 0x4A, 0x2E, 0x2E, 0x24, 0x0E, 0x0F, 0x0F, 
-    0x0F, 0x2E, 0x53, 0x53, 0x4A, 0x56, 0x0F, 0x0E, 0x0E, 0x0F, 0x4A, 0x4D, 
-    0x4D, 0x4A, 0x2E, 0x24, 0x0E, 0x0E, 0x56, 0x53, 0x53, 0x53, 0x4A, 0x2E, 
-    0x0F, 0x10, 0x0F, 0x56, 0x2E, 0x53, 0x53, 0x4A, 0x17, 0x10, 0x0F, 0x0E, 
-    0x0F, 0x2E, 0x53, 0x4D, 0x32, 0x2E, 0x2E, 0x4A, 0x4A, 0x2E, 0x0E, 0x0C, 
-    0x53, 0x32, 0x53, 0x4A, 0x4A, 0x2E, 0x0E, 0x0C, 0x2E, 0x4E, 0x32, 0x2E, 
-    0x4A, 0x2E, 0x24, 0x0E, 0x0E, 0x0E, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x56, 0x56, 0x4A, 0x2E, 0x0E, 0x56, 0x0F, 0x0E, 0x0E, 
-    0x0E, 0x2E, 0x2E, 0x0E, 0x53, 0x56, 0x0F, 0x0E, 0x0E, 0x24, 0x0F, 0x0C, 
-    0x4D, 0x2E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0C, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0C, 0x16, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x17, 0x17, 
-    0x0C, 0x0B, 0x01, 0x0E, 0x41, 0x3E, 0x3F, 0x3F, 0x01, 0x01, 0x0F, 0x16, 
-    0x43, 0x3E, 0x3F, 0x3F, 0x01, 0x01, 0x16, 0x19, 0x26, 0x42, 0x3E, 0x3E, 
-    0x0C, 0x0E, 0x1F, 0x1A, 0x19, 0x42, 0x3F, 0x3F, 0x0B, 0x0E, 0x19, 0x41, 
-    0x43, 0x43, 0x60, 0x6A, 0x0E, 0x16, 0x37, 0x3F, 0x3F, 0x43, 0x5D, 0x9A, 
-    0x17, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x7E, 0x7F, 0x1A, 0x37, 0x3F, 0x42, 
-    0x3E, 0x3E, 0x59, 0x9A, 0x59, 0x57, 0x58, 0xBF, 0xC1, 0xBF, 0x0B, 0x25, 
-    0x26, 0x6F, 0x9C, 0xC1, 0xBF, 0x6B, 0x0B, 0x0E, 0x3E, 0x86, 0x9D, 0xC1, 
-    0x71, 0x1E, 0x56, 0x34, 0x7E, 0xBF, 0xC1, 0xC0, 0x6B, 0x01, 0x24, 0x0F, 
-    0x64, 0xC1, 0x6E, 0x01, 0x0B, 0x10, 0x62, 0x2E, 0x97, 0xC1, 0x66, 0x25, 
-    0x24, 0x10, 0x10, 0x56, 0x9D, 0xC1, 0x0C, 0x25, 0x56, 0x10, 0x0F, 0x0E, 
-    0x9D, 0xC1, 0x18, 0x1E, 0x0E, 0x0E, 0x0E, 0x0E, 0x24, 0x4D, 0x32, 0x2E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x2E, 0x2E, 0x2E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x20, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x23, 0x0F, 0x0E, 0x0F, 
-    0x2E, 0x56, 0x0E, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 0x2E, 0x56, 0x0E, 0x0F, 
-    0x0F, 0x0F, 0x56, 0x56, 0x56, 0x10, 0x0F, 0x0E, 0x56, 0x56, 0x56, 0x2E, 
-    0x10, 0x24, 0x24, 0x0F, 0x56, 0x56, 0x56, 0x2E, 0x56, 0x0F, 0x0F, 0x0F, 
-    0x0E, 0x0F, 0x56, 0x2E, 0x74, 0x76, 0x9F, 0x4E, 0x2E, 0x74, 0x77, 0x77, 
-    0x32, 0x50, 0x4E, 0x4D, 0x2E, 0x74, 0x72, 0x74, 0x4E, 0x2E, 0x4A, 0x4D, 
-    0x2E, 0x53, 0x53, 0x53, 0x53, 0x4D, 0x4D, 0x4D, 0x56, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x4D, 0x4D, 0x4D, 0x2E, 0x4A, 0x2E, 0x2E, 0x2E, 0x4A, 0x4D, 0x4D, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x4D, 0x78, 0x0F, 0x2E, 0x4A, 0x4A, 
-    0x4A, 0x4A, 0x4D, 0x75, 0x4D, 0x53, 0x4D, 0x4D, 0x4E, 0x74, 0x73, 0x76, 
-    0x4D, 0x4D, 0x53, 0x4D, 0x53, 0x4E, 0x9F, 0x8C, 0x4D, 0x4D, 0x4D, 0x4D, 
-    0x50, 0x67, 0x91, 0x8C, 0x4D, 0x4A, 0x4E, 0x52, 0x9F, 0x8C, 0x8C, 0x78, 
-    0x4D, 0x4D, 0x78, 0x96, 0x7B, 0xA8, 0x68, 0x56, 0x50, 0xCC, 0x96, 0x89, 
-    0x79, 0x68, 0x4D, 0x4A, 0x77, 0x68, 0x8C, 0x68, 0x4A, 0x56, 0x4A, 0x4E, 
-    0x79, 0x75, 0x32, 0x4A, 0x2E, 0x4A, 0x4D, 0x32, 0x7B, 0x8C, 0x68, 0x4A, 
-    0x2E, 0x2E, 0x2E, 0x4E, 0x89, 0x32, 0x4A, 0x56, 0x2E, 0x4A, 0x4A, 0x2E, 
-    0x79, 0x24, 0x10, 0x53, 0x50, 0x74, 0x53, 0x4A, 0x2E, 0x2E, 0x2E, 0x4A, 
-    0x4A, 0x4A, 0x2E, 0x2E, 0x56, 0x32, 0x2E, 0x24, 0x56, 0x56, 0x4A, 0x2E, 
-    0x4D, 0x74, 0x56, 0x24, 0x56, 0x53, 0x77, 0x77, 0x32, 0x4A, 0x24, 0x24, 
-    0x56, 0x4A, 0x4A, 0x4D, 0x32, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x2E, 
-    0x4E, 0x77, 0x78, 0x53, 0x32, 0x52, 0x75, 0x73, 0x4A, 0x32, 0x53, 0x53, 
-    0x50, 0x32, 0x72, 0x75, 0x53, 0x50, 0x77, 0x74, 0x4E, 0x51, 0x32, 0x9F, 
-    0x78, 0x77, 0x67, 0x73, 0x4E, 0x32, 0x32, 0x50, 0x2E, 0x4E, 0x32, 0x32, 
-    0x32, 0x4E, 0x32, 0x32, 0x78, 0x68, 0x79, 0x73, 0x50, 0x73, 0x32, 0x32, 
-    0x4D, 0x4D, 0x53, 0x32, 0x52, 0x75, 0x50, 0x4E, 0x2E, 0x4A, 0x4A, 0x4E, 
-    0x52, 0x73, 0x32, 0x53, 0x4E, 0x51, 0x74, 0x73, 0x68, 0x73, 0x72, 0x72, 
-    0x72, 0x9F, 0x76, 0x75, 0x72, 0x50, 0x72, 0x72, 0x73, 0x9E, 0x9F, 0x72, 
-    0x50, 0x32, 0x74, 0x72, 0x50, 0x50, 0x50, 0x78, 0x74, 0x74, 0x74, 0x74, 
-    0x4E, 0x32, 0x74, 0x78, 0x74, 0x74, 0x74, 0x74, 0x50, 0x50, 0x50, 0x50, 
-    0x78, 0x74, 0x74, 0x74, 0x32, 0x50, 0x50, 0x50, 0x78, 0x74, 0x74, 0x78, 
-    0x53, 0x74, 0x74, 0x78, 0x74, 0x74, 0x52, 0x75, 0x72, 0x72, 0x74, 0x72, 
-    0x91, 0x9F, 0x72, 0x73, 0x72, 0x74, 0x72, 0x75, 0x91, 0x73, 0x77, 0x73, 
-    0x72, 0x74, 0x72, 0x91, 0x76, 0x72, 0x72, 0x77, 0x74, 0x73, 0x75, 0x73, 
-    0x72, 0x78, 0x78, 0x72, 0x72, 0x75, 0x79, 0x50, 0x50, 0x50, 0x32, 0x50, 
-    0x73, 0x75, 0x52, 0x74, 0x74, 0x32, 0x32, 0x50, 0x73, 0x67, 0x4E, 0x32, 
-    0x50, 0x74, 0x50, 0x78, 0x75, 0x4E, 0x32, 0x4E, 0x32, 0x32, 0x50, 0x72, 
-    0x52, 0x52, 0x52, 0x72, 0x52, 0x73, 0x73, 0x73, 0x52, 0x72, 0x73, 0x72, 
-    0x52, 0x9F, 0x9F, 0x52, 0x73, 0x72, 0x52, 0x72, 0x52, 0x9F, 0x9F, 0x73, 
-    0x73, 0x52, 0x73, 0x72, 0x52, 0x9F, 0x9F, 0x9F, 0x52, 0x73, 0x73, 0x73, 
-    0x73, 0x9F, 0x9F, 0x9F, 0x52, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x52, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x74, 0x72, 0x73, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x9F, 0x9F, 0x9E, 0x9E, 0x54, 0x37, 0x25, 
-    0x73, 0x9E, 0x9F, 0x75, 0x73, 0x69, 0x1B, 0x0C, 0x9F, 0x9F, 0x9E, 0x67, 
-    0x20, 0x0C, 0x18, 0x1F, 0x73, 0x73, 0x9F, 0x3D, 0x43, 0x1F, 0x18, 0x1F, 
-    0x73, 0x9F, 0x9E, 0x67, 0x43, 0x18, 0x18, 0x16, 0x73, 0x9F, 0x9E, 0x67, 
-    0x37, 0x0C, 0x1F, 0x43, 0x9F, 0x9F, 0x9F, 0x63, 0x43, 0x0C, 0x1F, 0x43, 
-    0x9F, 0x9F, 0x9F, 0x63, 0x37, 0x0C, 0x1F, 0x43, 0x26, 0x19, 0x0B, 0x0B, 
-    0x0B, 0x01, 0x0B, 0x0C, 0x35, 0x19, 0x10, 0x0C, 0x0B, 0x01, 0x0B, 0x0B, 
-    0x38, 0x19, 0x2E, 0x0E, 0x0B, 0x0B, 0x01, 0x0B, 0x69, 0x3D, 0x4A, 0x56, 
-    0x0E, 0x0B, 0x01, 0x0B, 0x69, 0x3D, 0x4A, 0x56, 0x56, 0x24, 0x56, 0x0F, 
-    0x10, 0x24, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x24, 0x10, 0x2E, 0x4A, 0x2D, 
-    0x4A, 0x4A, 0x4A, 0x2E, 0x10, 0x2E, 0x4A, 0x2E, 0x32, 0x2E, 0x2E, 0x4E, 
-    0x0C, 0x0B, 0x01, 0x04, 0x68, 0xD7, 0x96, 0xAD, 0x0B, 0x0B, 0x0B, 0x01, 
-    0x2E, 0x8A, 0x68, 0xAD, 0x01, 0x01, 0x01, 0x2E, 0x20, 0x54, 0x68, 0xAD, 
-    0x0B, 0x01, 0x01, 0x63, 0x99, 0x99, 0x99, 0x76, 0x24, 0x24, 0x24, 0x56, 
-    0x67, 0x99, 0x54, 0x67, 0x24, 0x4A, 0x4A, 0x35, 0x38, 0x0E, 0x5C, 0x33, 
-    0x4A, 0x50, 0x74, 0x3E, 0x1B, 0x0E, 0x3E, 0x63, 0x50, 0x74, 0x67, 0x5C, 
-    0x1B, 0x0E, 0x3E, 0x63, 0x76, 0xAD, 0x76, 0xAD, 0xAD, 0xAD, 0xAD, 0x96, 
-    0x76, 0x9E, 0x76, 0xAD, 0xAD, 0xAD, 0xAD, 0x88, 0x76, 0xAD, 0xAD, 0xAD, 
-    0x76, 0xAD, 0xAD, 0x3A, 0xAD, 0x76, 0x76, 0xAD, 0x76, 0xAD, 0xAD, 0x54, 
-    0xAD, 0x76, 0x76, 0xAD, 0xAD, 0xAD, 0x76, 0x6C, 0xAD, 0x76, 0xAD, 0x76, 
-    0xAD, 0xAD, 0x68, 0x82, 0xAD, 0xAD, 0x76, 0x76, 0xAD, 0xAD, 0x99, 0x82, 
-    0xAD, 0x76, 0xAD, 0xAD, 0xAD, 0x76, 0x54, 0x82, 0x3A, 0xE0, 0x1F, 0x99, 
-    0xBC, 0x68, 0xA2, 0xBC, 0xE0, 0x6C, 0x38, 0x23, 0x31, 0x23, 0x79, 0x73, 
-    0x95, 0x59, 0x38, 0x1F, 0x18, 0x1F, 0x10, 0x0C, 0x82, 0x45, 0x30, 0x1A, 
-    0x0C, 0x1E, 0x0B, 0x0B, 0x59, 0x1F, 0x17, 0x35, 0x1A, 0x0B, 0x01, 0x01, 
-    0x59, 0x1F, 0x17, 0x35, 0x16, 0x0C, 0x0B, 0x0B, 0x5A, 0x1F, 0x3B, 0x35, 
-    0x16, 0x0C, 0x0C, 0x0B, 0x58, 0x34, 0x17, 0x30, 0x1A, 0x17, 0x0E, 0x0B, 
-    0x63, 0x17, 0x1B, 0x17, 0x58, 0xCB, 0xE5, 0xE5, 0x0F, 0x1B, 0x6F, 0x38, 
-    0x38, 0x66, 0xD2, 0xE9, 0x01, 0x18, 0x58, 0x6F, 0x6F, 0x84, 0x61, 0x6B, 
-    0x01, 0x01, 0x18, 0x85, 0x9C, 0x9B, 0xE2, 0xE1, 0x01, 0x1E, 0x01, 0x6B, 
-    0x70, 0x9D, 0xC1, 0xE3, 0x0B, 0x0C, 0x0C, 0x01, 0x45, 0xC0, 0xE4, 0xC2, 
-    0x0B, 0x0B, 0x0C, 0x1E, 0x21, 0x6E, 0xC0, 0xCA, 0x0B, 0x0B, 0x0B, 0x0C, 
-    0x01, 0x66, 0x9D, 0xE3, 0xCA, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xC8, 
-    0xE5, 0xE6, 0xE6, 0xE5, 0xEC, 0xEB, 0x80, 0x8F, 0xEE, 0xE4, 0xE4, 0xE4, 
-    0xEE, 0x71, 0x61, 0x57, 0x66, 0x40, 0x66, 0x40, 0xE1, 0x8F, 0x5D, 0x90, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x5E, 0x6E, 0xC8, 0x9D, 0x9D, 0x9D, 0x9D, 
-    0xBF, 0xC8, 0xC2, 0xC1, 0xE4, 0xCA, 0xCA, 0xCA, 0xE4, 0xEB, 0xC0, 0x6E, 
-    0xE4, 0xE6, 0xE6, 0xE6, 0xE5, 0xC0, 0x6E, 0x80, 0x86, 0x1F, 0x17, 0x38, 
-    0x38, 0xCE, 0xCE, 0x9F, 0x38, 0x1B, 0x40, 0x40, 0x1A, 0x63, 0x63, 0x67, 
-    0x6F, 0x58, 0x59, 0x45, 0x01, 0x01, 0x1F, 0x23, 0x6D, 0x6D, 0x45, 0x01, 
-    0x01, 0x0B, 0x01, 0x01, 0xC1, 0x86, 0x0C, 0x01, 0x0B, 0x01, 0x01, 0x01, 
-    0x71, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0B, 0x0C, 0x6B, 0x01, 0x01, 0x0B, 
-    0x0B, 0x01, 0x0B, 0x18, 0x01, 0x0C, 0x0C, 0x0B, 0x0B, 0x01, 0x0B, 0x16, 
-    0x98, 0xA0, 0x30, 0x59, 0xE0, 0x96, 0xAD, 0xAD, 0x67, 0x67, 0x17, 0x59, 
-    0xE0, 0x8A, 0x68, 0xAD, 0x24, 0x1F, 0x17, 0x60, 0x6C, 0xE0, 0x67, 0xAD, 
-    0x01, 0x1A, 0x16, 0x1B, 0x3F, 0x95, 0x68, 0xAD, 0x18, 0x26, 0x38, 0x0E, 
-    0x1B, 0x6C, 0x68, 0xAD, 0x18, 0x43, 0x35, 0x34, 0x26, 0x6C, 0x54, 0xAD, 
-    0x1F, 0x35, 0x35, 0x1A, 0x38, 0x82, 0x6C, 0x33, 0x17, 0x30, 0x17, 0x1A, 
-    0x21, 0x82, 0x82, 0x33, 0x96, 0xA5, 0xA2, 0xAD, 0xAD, 0x96, 0xAD, 0x94, 
-    0x96, 0xA5, 0xA8, 0xAD, 0x96, 0x96, 0xAD, 0xD7, 0x96, 0xA5, 0xA8, 0xAD, 
-    0x96, 0x96, 0x96, 0xEA, 0x96, 0xA3, 0xA8, 0xAD, 0x96, 0x96, 0x7B, 0xE4, 
-    0x96, 0xB7, 0xA8, 0xAD, 0x96, 0xAD, 0x68, 0xE4, 0x96, 0xA3, 0xA8, 0x9E, 
-    0x96, 0x96, 0x7B, 0xE5, 0x96, 0xA3, 0xA8, 0x9E, 0x96, 0xAD, 0x96, 0xE5, 
-    0x7B, 0xB7, 0xA8, 0x9E, 0xAD, 0xAD, 0x96, 0xE7, 0xA6, 0x69, 0x1B, 0x35, 
-    0x3F, 0x40, 0x1E, 0x0F, 0xD0, 0x7E, 0x7F, 0x7E, 0x83, 0x60, 0x17, 0x17, 
-    0x7D, 0x9A, 0x9A, 0xDD, 0x6F, 0x44, 0x17, 0x0F, 0xCA, 0xBF, 0x9C, 0x9A, 
-    0xDE, 0x6A, 0x17, 0x1A, 0x27, 0xC8, 0xC1, 0x9B, 0xDD, 0x7E, 0x38, 0x3B, 
-    0x27, 0xCA, 0xCA, 0xC0, 0x9B, 0xDD, 0x6F, 0x17, 0xE6, 0xCB, 0xCB, 0xE6, 
-    0xC0, 0x9A, 0xDD, 0x17, 0xEC, 0xE4, 0xE4, 0xE6, 0xC0, 0x9A, 0x7F, 0x8F, 
-    0x3E, 0x35, 0x17, 0x38, 0x17, 0x7E, 0x63, 0xAD, 0x5C, 0x26, 0x1B, 0x37, 
-    0x1A, 0x5D, 0x54, 0x67, 0x17, 0x17, 0x26, 0x26, 0x3B, 0x17, 0x60, 0x54, 
-    0x17, 0x19, 0x17, 0x17, 0x17, 0x3B, 0x6F, 0x5C, 0x17, 0x35, 0x17, 0x17, 
-    0x17, 0x3B, 0x6F, 0x5C, 0x17, 0x17, 0x17, 0x17, 0x17, 0x30, 0x6F, 0x42, 
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x58, 0x5C, 0x17, 0x17, 0x17, 0x17, 
-    0x17, 0x3B, 0x6F, 0x6B, 0x9F, 0x9E, 0x9E, 0x9F, 0x52, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9E, 0x9F, 0x9F, 0x9F, 0x73, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 
-    0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x73, 0x73, 0x9F, 0x9F, 
-    0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9F, 0x9E, 0x9E, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x74, 
-    0x78, 0x52, 0x78, 0x53, 0x9F, 0x9F, 0x73, 0x72, 0x78, 0x52, 0x77, 0x32, 
-    0x9F, 0x9F, 0x9F, 0x52, 0x72, 0x52, 0x78, 0x4E, 0x9F, 0x9F, 0x9F, 0x73, 
-    0x52, 0x74, 0x78, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x74, 0x74, 0x77, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x78, 0x32, 0x78, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x78, 0x32, 0x32, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x74, 0x32, 
-    0x53, 0x78, 0x52, 0x74, 0x78, 0x50, 0x75, 0x73, 0x4D, 0x78, 0x73, 0x78, 
-    0x32, 0x72, 0x52, 0x74, 0x53, 0x50, 0x78, 0x78, 0x74, 0x73, 0x74, 0x32, 
-    0x78, 0x4E, 0x4E, 0x78, 0x72, 0x73, 0x52, 0x32, 0x52, 0x50, 0x53, 0x74, 
-    0x52, 0x73, 0x73, 0x74, 0x74, 0x78, 0x4E, 0x74, 0x74, 0x78, 0x52, 0x50, 
-    0x74, 0x78, 0x4E, 0x74, 0x32, 0x4E, 0x72, 0x78, 0x78, 0x50, 0x4D, 0x72, 
-    0x78, 0x32, 0x50, 0x32, 0x72, 0x50, 0x50, 0x32, 0x32, 0x72, 0x76, 0x75, 
-    0x72, 0x50, 0x32, 0x32, 0x4E, 0x72, 0x67, 0x74, 0x50, 0x74, 0x50, 0x78, 
-    0x77, 0x32, 0x53, 0x2E, 0x32, 0x74, 0x50, 0x78, 0x91, 0x52, 0x78, 0x4E, 
-    0x53, 0x4A, 0x50, 0x89, 0x89, 0x73, 0x50, 0x32, 0x4E, 0x2E, 0x78, 0x98, 
-    0x89, 0x9F, 0x72, 0x32, 0x72, 0x4E, 0x50, 0x98, 0x8C, 0x76, 0x73, 0x74, 
-    0x72, 0x73, 0x52, 0x89, 0x89, 0x76, 0x52, 0x32, 0x74, 0x4A, 0x2E, 0x0F, 
-    0x24, 0x2E, 0x2E, 0x56, 0x2E, 0x34, 0x0F, 0x0F, 0x0F, 0x24, 0x24, 0x0F, 
-    0x0F, 0x0F, 0x0F, 0x0F, 0x2E, 0x53, 0x4D, 0x53, 0x4A, 0x4A, 0x4A, 0x2E, 
-    0x24, 0x2E, 0x4D, 0x32, 0x4E, 0x4D, 0x4E, 0x53, 0x24, 0x0F, 0x56, 0x53, 
-    0x32, 0x50, 0x72, 0x78, 0x53, 0x2E, 0x56, 0x2E, 0x53, 0x50, 0x75, 0x77, 
-    0x4E, 0x2E, 0x56, 0x24, 0x53, 0x78, 0x9F, 0x78, 0x53, 0x2E, 0x0F, 0x24, 
-    0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 
-    0x0E, 0x2E, 0x2E, 0x2E, 0x53, 0x2E, 0x24, 0x0F, 0x0F, 0x10, 0x2E, 0x56, 
-    0x50, 0x32, 0x53, 0x2E, 0x24, 0x24, 0x24, 0x0E, 0x32, 0x74, 0x74, 0x32, 
-    0x4A, 0x2E, 0x56, 0x56, 0x53, 0x53, 0x53, 0x53, 0x4A, 0x4A, 0x53, 0x4D, 
-    0x2E, 0x2E, 0x53, 0x53, 0x53, 0x4A, 0x53, 0x53, 0x56, 0x2E, 0x53, 0x32, 
-    0x53, 0x4A, 0x53, 0x53, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0F, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x24, 0x2E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 
-    0x56, 0x56, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x2E, 0x2E, 0x56, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0F, 0x4A, 0x2E, 0x2E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0F, 
-    0x2E, 0x2E, 0x56, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 
-    0x0F, 0x0F, 0x56, 0x2E, 0x0F, 0x0F, 0x13, 0x10, 0x0F, 0x0C, 0x0F, 0x2E, 
-    0x10, 0x23, 0x19, 0x17, 0x0F, 0x10, 0x10, 0x10, 0x0E, 0x10, 0x19, 0x19, 
-    0x10, 0x20, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0E, 
-    0x2E, 0x2E, 0x0F, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x10, 0x0F, 0x0F, 0x0F, 
-    0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x24, 0x2E, 
-    0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0F, 0x2E, 0x0E, 0x0E, 0x0E, 0x23, 
-    0x31, 0x10, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 0x31, 0x31, 0x23, 0x0E, 0x0F, 
-    0x0E, 0x34, 0x0F, 0x31, 0x3D, 0x23, 0x0C, 0x0E, 0x0E, 0x0F, 0x34, 0x0F, 
-    0x0F, 0x0E, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x16, 0x19, 0x26, 
-    0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0E, 0x0E, 0x20, 0x01, 0x01, 0x0B, 0x0C, 
-    0x0B, 0x0B, 0x0B, 0x0E, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0F, 0x0F, 0x20, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x1A, 0x41, 0x01, 0x01, 0x01, 0x01, 
-    0x18, 0x0F, 0x19, 0x26, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x10, 0x41, 0x20, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0F, 0x0F, 0x41, 0x26, 0x43, 0x3E, 
-    0x43, 0x69, 0x5D, 0x9A, 0x26, 0x41, 0x3D, 0x3E, 0x5D, 0x5D, 0x59, 0x82, 
-    0x0E, 0x34, 0x25, 0x18, 0x18, 0x39, 0x39, 0x18, 0x26, 0x41, 0x17, 0x45, 
-    0x5D, 0x58, 0x59, 0x58, 0x43, 0x43, 0x69, 0x5D, 0x7E, 0x7E, 0x7D, 0x6E, 
-    0x69, 0x43, 0x42, 0x5D, 0x7E, 0x7E, 0x90, 0x70, 0x17, 0x19, 0x47, 0x43, 
-    0x6A, 0x83, 0x9D, 0xC1, 0x0B, 0x51, 0x47, 0x13, 0x60, 0x7E, 0x5F, 0xC1, 
-    0xBF, 0xC1, 0x18, 0x1E, 0x0E, 0x0E, 0x0F, 0x10, 0x7D, 0x95, 0x0B, 0x01, 
-    0x0C, 0x0E, 0x10, 0x10, 0x18, 0x0B, 0x0B, 0x0C, 0x0C, 0x0E, 0x23, 0x0F, 
-    0x0E, 0x63, 0x16, 0x01, 0x0C, 0x0E, 0x19, 0x0F, 0x6B, 0x54, 0x22, 0x0B, 
-    0x0C, 0x0E, 0x0F, 0x0F, 0x86, 0x0B, 0x69, 0x42, 0x0C, 0x0B, 0x0B, 0x0B, 
-    0x71, 0x25, 0x19, 0x40, 0x36, 0x22, 0x0C, 0x0E, 0x71, 0x25, 0x25, 0x0E, 
-    0x22, 0x36, 0x0E, 0x0F, 0x2E, 0x10, 0x10, 0x56, 0x0F, 0x2E, 0x2E, 0x0E, 
-    0x23, 0x0F, 0x0E, 0x24, 0x0F, 0x2E, 0x2E, 0x0F, 0x0E, 0x0E, 0x0F, 0x56, 
-    0x2E, 0x2E, 0x2E, 0x0F, 0x0E, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x0E, 0x0E, 
-    0x0F, 0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x0E, 0x0E, 0x24, 0x2E, 0x2E, 0x56, 
-    0x56, 0x0F, 0x0E, 0x0E, 0x0E, 0x0B, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 
-    0x10, 0x22, 0x31, 0x0C, 0x0E, 0x0F, 0x0F, 0x2E, 0x0E, 0x56, 0x2E, 0x2E, 
-    0x2E, 0x4D, 0x77, 0x68, 0x0E, 0x0E, 0x56, 0x2E, 0x2E, 0x32, 0x76, 0x77, 
-    0x0E, 0x0E, 0x0F, 0x2E, 0x53, 0x32, 0x91, 0x4E, 0x0E, 0x0E, 0x0F, 0x2E, 
-    0x53, 0x32, 0x77, 0x53, 0x0E, 0x0E, 0x24, 0x2E, 0x2E, 0x74, 0x4A, 0x4A, 
-    0x24, 0x0E, 0x0F, 0x2E, 0x2E, 0x53, 0x4A, 0x24, 0x2E, 0x0E, 0x0E, 0x0F, 
-    0x53, 0x56, 0x0F, 0x0E, 0x2E, 0x0E, 0x0E, 0x0F, 0x4A, 0x0F, 0x0E, 0x0F, 
-    0x79, 0x4E, 0x24, 0x2E, 0x4A, 0x4A, 0x78, 0x73, 0x4E, 0x4A, 0x4A, 0x53, 
-    0x4D, 0x4A, 0x32, 0x73, 0x56, 0x2E, 0x4A, 0x53, 0x4D, 0x4A, 0x32, 0x73, 
-    0x2E, 0x4A, 0x4A, 0x2E, 0x2E, 0x50, 0x50, 0x4A, 0x4A, 0x4A, 0x53, 0x2E, 
-    0x4A, 0x73, 0x72, 0x34, 0x2E, 0x4A, 0x53, 0x53, 0x74, 0x32, 0x4A, 0x2E, 
-    0x2E, 0x2E, 0x4A, 0x32, 0x73, 0x2E, 0x34, 0x2E, 0x56, 0x2E, 0x2E, 0x32, 
-    0x74, 0x2E, 0x56, 0x56, 0x56, 0x0E, 0x56, 0x2E, 0x56, 0x56, 0x4E, 0x4E, 
-    0x56, 0x24, 0x56, 0x2E, 0x2E, 0x4A, 0x50, 0x4E, 0x56, 0x56, 0x2E, 0x2E, 
-    0x2E, 0x4D, 0x50, 0x72, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x4D, 0x77, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x73, 0x2E, 0x2E, 0x2E, 0x53, 
-    0x4A, 0x2E, 0x4A, 0x78, 0x2E, 0x2E, 0x4A, 0x32, 0x53, 0x2E, 0x2E, 0x4A, 
-    0x2E, 0x2E, 0x53, 0x32, 0x32, 0x4A, 0x4A, 0x4A, 0x2E, 0x2E, 0x53, 0x32, 
-    0x74, 0x72, 0x53, 0x32, 0x4A, 0x53, 0x53, 0x32, 0x72, 0x74, 0x32, 0x32, 
-    0x4D, 0x4A, 0x53, 0x32, 0x72, 0x74, 0x32, 0x78, 0x50, 0x4A, 0x53, 0x78, 
-    0x74, 0x50, 0x53, 0x74, 0x50, 0x4A, 0x4E, 0x77, 0x73, 0x4A, 0x2E, 0x74, 
-    0x4D, 0x4A, 0x53, 0x4E, 0x50, 0x74, 0x4E, 0x74, 0x4A, 0x4A, 0x4A, 0x4D, 
-    0x50, 0x67, 0x50, 0x77, 0x53, 0x53, 0x4A, 0x53, 0x78, 0x75, 0x50, 0x74, 
-    0x4E, 0x74, 0x77, 0x77, 0x72, 0x74, 0x52, 0x68, 0x78, 0x77, 0x77, 0x77, 
-    0x77, 0x77, 0x9F, 0x52, 0x78, 0x77, 0x77, 0x74, 0x74, 0x75, 0x89, 0x50, 
-    0x77, 0x77, 0x77, 0x78, 0x78, 0x75, 0x75, 0x53, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x74, 0x32, 0x4E, 0x77, 0x77, 0x77, 0x77, 0x67, 0x4A, 0x4D, 0x4E, 
-    0x77, 0x77, 0x77, 0x77, 0x67, 0x56, 0x2E, 0x53, 0x77, 0x77, 0x77, 0x79, 
-    0x4D, 0x24, 0x4A, 0x53, 0x68, 0x4E, 0x32, 0x50, 0x4E, 0x4E, 0x50, 0x77, 
-    0x78, 0x4E, 0x32, 0x32, 0x4E, 0x4E, 0x74, 0x77, 0x4A, 0x53, 0x53, 0x53, 
-    0x32, 0x32, 0x74, 0x52, 0x53, 0x4E, 0x4D, 0x4E, 0x78, 0x50, 0x50, 0x72, 
-    0x50, 0x74, 0x50, 0x50, 0x72, 0x78, 0x32, 0x74, 0x4E, 0x32, 0x4E, 0x32, 
-    0x78, 0x74, 0x74, 0x72, 0x53, 0x53, 0x32, 0x32, 0x74, 0x74, 0x72, 0x73, 
-    0x53, 0x4E, 0x72, 0x72, 0x52, 0x73, 0x73, 0x52, 0x74, 0x72, 0x9F, 0x9F, 
-    0x9F, 0x91, 0x76, 0x73, 0x74, 0x72, 0x9F, 0x73, 0x9F, 0x7B, 0x76, 0x52, 
-    0x74, 0x72, 0x73, 0x73, 0x9F, 0xAD, 0x9E, 0x73, 0x74, 0x74, 0x73, 0x9F, 
-    0x73, 0x9F, 0x73, 0x73, 0x52, 0x73, 0x73, 0x9F, 0x73, 0x73, 0x73, 0x73, 
-    0x52, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x68, 0x9F, 0x9F, 0x73, 
-    0x52, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x73, 0x9F, 0x9F, 0x63, 0x43, 0x0C, 0x0E, 0x43, 0x73, 0x9F, 0x9F, 0x67, 
-    0x43, 0x0C, 0x18, 0x37, 0x73, 0x9F, 0x9E, 0x67, 0x37, 0x0C, 0x1F, 0x43, 
-    0x9F, 0x9F, 0x9F, 0x67, 0x3E, 0x0C, 0x0E, 0x37, 0x73, 0x9F, 0x9F, 0x67, 
-    0x26, 0x0C, 0x1F, 0x43, 0x73, 0x9F, 0x9F, 0x73, 0x74, 0x23, 0x0E, 0x19, 
-    0x73, 0x9F, 0x9F, 0x9F, 0x75, 0x3D, 0x0C, 0x0B, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9E, 0x62, 0x0C, 0x10, 0x17, 0x2E, 0x4A, 0x74, 0x99, 0x0F, 0x69, 0x62, 
-    0x10, 0x4A, 0x2E, 0x74, 0x79, 0x24, 0x3E, 0x62, 0x10, 0x4A, 0x4A, 0x74, 
-    0x79, 0x0E, 0x3E, 0x62, 0x17, 0x4A, 0x4A, 0x74, 0x79, 0x25, 0x69, 0x62, 
-    0x10, 0x2E, 0x4D, 0x74, 0x88, 0x2D, 0x88, 0x73, 0x0F, 0x2E, 0x4A, 0x72, 
-    0x88, 0x2D, 0x88, 0x75, 0x25, 0x13, 0x51, 0x75, 0x79, 0x25, 0xCF, 0x76, 
-    0x62, 0x24, 0x32, 0x8E, 0x88, 0x25, 0xCF, 0x8E, 0x50, 0x72, 0x67, 0x5C, 
-    0x44, 0x0E, 0x3E, 0x67, 0x72, 0x74, 0x67, 0x3F, 0x1B, 0x0E, 0x3E, 0x67, 
-    0x72, 0x51, 0x67, 0x5D, 0x1B, 0x0E, 0x3E, 0x33, 0x72, 0x72, 0x54, 0x59, 
-    0x1B, 0x0E, 0x3E, 0x67, 0x50, 0x72, 0x5C, 0x7E, 0x44, 0x25, 0x43, 0x67, 
-    0x50, 0x72, 0x54, 0x57, 0x20, 0x68, 0x67, 0x68, 0x72, 0x72, 0x5C, 0x21, 
-    0x89, 0xA3, 0xAD, 0x75, 0x8E, 0x75, 0x5C, 0x1B, 0x7B, 0xA3, 0x76, 0x75, 
-    0xAD, 0x76, 0x76, 0xAD, 0xAD, 0x88, 0x87, 0x42, 0xAD, 0x75, 0x76, 0xAD, 
-    0xAD, 0x3A, 0x6C, 0x26, 0xAD, 0x76, 0x76, 0xAD, 0xAD, 0x8A, 0x82, 0x1B, 
-    0xAD, 0x76, 0xAD, 0xAD, 0xAD, 0x8A, 0xE2, 0x35, 0xAD, 0x76, 0x76, 0xAD, 
-    0xAD, 0x8A, 0x58, 0x35, 0xAD, 0x76, 0x76, 0xAD, 0xAD, 0x8A, 0x58, 0x1B, 
-    0xAD, 0x76, 0x76, 0xAD, 0x96, 0x8A, 0x59, 0x17, 0xAD, 0x76, 0x76, 0xAD, 
-    0xAD, 0x8A, 0x58, 0x30, 0x3F, 0x21, 0x1A, 0x1A, 0x1A, 0x19, 0x3B, 0x0B, 
-    0x42, 0x37, 0x17, 0x17, 0x1A, 0x19, 0x1A, 0x0B, 0x43, 0x37, 0x17, 0x17, 
-    0x17, 0x41, 0x16, 0x01, 0x43, 0x36, 0x17, 0x17, 0x38, 0x3E, 0x3E, 0x1F, 
-    0x3E, 0x36, 0x17, 0x17, 0x17, 0x3F, 0x59, 0x38, 0x42, 0x1B, 0x17, 0x17, 
-    0x17, 0x3F, 0x83, 0x57, 0x17, 0x17, 0x3B, 0x17, 0x17, 0x60, 0x7E, 0x82, 
-    0x17, 0x17, 0x17, 0x3B, 0x38, 0x7E, 0x9A, 0x9A, 0x18, 0x0C, 0x0E, 0x1F, 
-    0x1E, 0x81, 0xE9, 0x6D, 0x0C, 0x0C, 0x0E, 0x0C, 0x1E, 0x31, 0xCB, 0xCA, 
-    0x0B, 0x0C, 0x0B, 0x0B, 0x0C, 0x01, 0xE8, 0xEC, 0x0B, 0x0C, 0x0C, 0x0C, 
-    0x0C, 0x01, 0x5B, 0xE5, 0x1E, 0x0B, 0x0B, 0x0B, 0x0C, 0x01, 0x5B, 0xE5, 
-    0x16, 0x0C, 0x01, 0x0B, 0x0E, 0x1E, 0x31, 0xE4, 0x46, 0x0C, 0x0B, 0x0B, 
-    0x0C, 0x0C, 0x01, 0x81, 0x57, 0x0B, 0x0C, 0x0B, 0x0E, 0x0E, 0x01, 0x5B, 
-    0xCB, 0xE4, 0xE4, 0xE4, 0xEE, 0x86, 0xC0, 0x81, 0x86, 0xE2, 0xE3, 0xE2, 
-    0x6D, 0xCA, 0xE4, 0x6B, 0xE4, 0xE4, 0xE4, 0xCA, 0xE4, 0xE6, 0xCB, 0x01, 
-    0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE5, 0xCB, 0x0B, 0xEC, 0xE5, 0xEB, 0xE5, 
-    0xE5, 0xE5, 0xE7, 0x01, 0xEC, 0xEB, 0xE5, 0xE5, 0xE5, 0xEC, 0x81, 0x01, 
-    0xEC, 0xE5, 0xE5, 0xEB, 0xE5, 0xEB, 0x01, 0x1E, 0xEE, 0xE6, 0xEB, 0xE5, 
-    0xEC, 0xD5, 0x01, 0x0B, 0x01, 0x0C, 0x0C, 0x0C, 0x0B, 0x01, 0x0C, 0x20, 
-    0x01, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x21, 0x1E, 0x0C, 0x0B, 0x0B, 
-    0x0B, 0x0B, 0x0B, 0x69, 0x0B, 0x0C, 0x0C, 0x0B, 0x0B, 0x18, 0x57, 0x3F, 
-    0x0B, 0x0B, 0x0B, 0x0B, 0x01, 0x18, 0x7E, 0x83, 0x0C, 0x0C, 0x0B, 0x0B, 
-    0x1F, 0x57, 0x7F, 0x7E, 0x0C, 0x0B, 0x0B, 0x0B, 0x21, 0x7E, 0x7F, 0x7E, 
-    0x0E, 0x0B, 0x0B, 0x0B, 0x21, 0x7E, 0xDD, 0x9A, 0x17, 0x17, 0x17, 0x16, 
-    0x26, 0x5D, 0x6C, 0x63, 0x17, 0x17, 0x17, 0x17, 0x43, 0x35, 0x5D, 0x54, 
-    0x26, 0x17, 0x17, 0x19, 0x3E, 0x35, 0x5D, 0x5C, 0x37, 0x17, 0x3B, 0x35, 
-    0x3E, 0x35, 0x5D, 0x5B, 0x37, 0x3B, 0x3B, 0x38, 0x3F, 0x35, 0x42, 0x71, 
-    0x37, 0x3B, 0x17, 0x17, 0x37, 0x26, 0x1B, 0x59, 0x57, 0x17, 0x35, 0x17, 
-    0x17, 0x17, 0x17, 0x59, 0x6A, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5A, 
-    0x7B, 0xA3, 0xA8, 0x9E, 0x76, 0x96, 0x96, 0x96, 0x7B, 0xA3, 0xA8, 0x9E, 
-    0x76, 0xAD, 0xAD, 0x96, 0x79, 0xB7, 0xA8, 0x9E, 0xAD, 0xAD, 0xAD, 0x91, 
-    0x7B, 0xA3, 0xA2, 0xAD, 0x76, 0x76, 0xAD, 0x89, 0x3A, 0xB8, 0xA2, 0x9E, 
-    0x76, 0xAD, 0xAD, 0x8C, 0x81, 0xB8, 0xA2, 0x9F, 0xAD, 0xAD, 0xAD, 0x8C, 
-    0xE0, 0xB8, 0xA8, 0x9E, 0xAD, 0x76, 0xAD, 0x8C, 0xE0, 0xB8, 0xA8, 0x9E, 
-    0x76, 0x76, 0xAD, 0x8C, 0xD3, 0xE6, 0xE6, 0xE6, 0xCA, 0x6E, 0x9A, 0x7F, 
-    0xD4, 0xE6, 0xE6, 0xE6, 0xE6, 0xE4, 0xE3, 0xDD, 0xDF, 0xEC, 0xE5, 0xE5, 
-    0xE6, 0xE4, 0x6E, 0x85, 0xB1, 0xF1, 0xEC, 0xE6, 0xE6, 0xE6, 0xC0, 0x9A, 
-    0x93, 0x7A, 0xE5, 0xE6, 0xE6, 0xE6, 0xE4, 0x9B, 0xA3, 0x7A, 0xED, 0xE5, 
-    0xE6, 0xE6, 0xE5, 0xBF, 0xA7, 0x8C, 0xD5, 0xEC, 0xE6, 0xE6, 0xE6, 0xCA, 
-    0xA7, 0x96, 0x9F, 0xED, 0xE5, 0xE6, 0x27, 0xE6, 0x17, 0x17, 0x17, 0x17, 
-    0x17, 0x17, 0x6F, 0x42, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x6A, 0x5C, 
-    0x44, 0x17, 0x17, 0x17, 0x38, 0x3F, 0x5C, 0x3D, 0x7E, 0x17, 0x17, 0x17, 
-    0x17, 0x5D, 0x63, 0x9F, 0x83, 0x17, 0x17, 0x17, 0x38, 0x5D, 0x63, 0x9E, 
-    0x7F, 0x1B, 0x17, 0x3B, 0x17, 0x5D, 0x63, 0x9E, 0x85, 0x44, 0x17, 0x17, 
-    0x38, 0x5D, 0x63, 0x9E, 0x7D, 0x1B, 0x3B, 0x17, 0x57, 0x6C, 0x63, 0x9F, 
-    0x9F, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9E, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9F, 0x9F, 0x75, 0x9F, 0x9F, 0x75, 
-    0x75, 0x9F, 0x9F, 0x9F, 0x73, 0x9F, 0x9F, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x75, 0x75, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x75, 0x75, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x72, 0x78, 0x74, 0x74, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x72, 0x74, 0x72, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x52, 0x52, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x52, 0x72, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x52, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x73, 0x9F, 0x73, 0x52, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x52, 
-    0x9F, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x78, 0x4D, 0x4D, 0x74, 
-    0x52, 0x50, 0x53, 0x4E, 0x78, 0x4D, 0x4D, 0x32, 0x74, 0x78, 0x53, 0x32, 
-    0x74, 0x53, 0x53, 0x4D, 0x72, 0x78, 0x53, 0x4E, 0x74, 0x74, 0x4E, 0x4A, 
-    0x52, 0x72, 0x32, 0x32, 0x72, 0x72, 0x32, 0x4D, 0x77, 0x74, 0x53, 0x50, 
-    0x74, 0x52, 0x74, 0x53, 0x32, 0x32, 0x2E, 0x50, 0x72, 0x72, 0x78, 0x53, 
-    0x32, 0x74, 0x53, 0x4E, 0x72, 0x74, 0x78, 0x53, 0x32, 0x78, 0x53, 0x53, 
-    0x72, 0x91, 0x75, 0x4E, 0x73, 0x91, 0x9F, 0x32, 0x74, 0x68, 0x75, 0x4A, 
-    0x52, 0x8C, 0x76, 0x52, 0x72, 0x68, 0x76, 0x4E, 0x72, 0x68, 0x68, 0x73, 
-    0x50, 0x68, 0x91, 0x50, 0x53, 0x4E, 0x76, 0x73, 0x73, 0x50, 0x76, 0x50, 
-    0x53, 0x4E, 0x91, 0x75, 0x91, 0x50, 0x75, 0x50, 0x4E, 0x4E, 0x68, 0x75, 
-    0x68, 0x50, 0x75, 0x78, 0x4E, 0x51, 0x32, 0x68, 0x4D, 0x4E, 0x75, 0x74, 
-    0x78, 0x4E, 0x51, 0x73, 0x32, 0x50, 0x50, 0x4D, 0x53, 0x2E, 0x0F, 0x0F, 
-    0x50, 0x50, 0x4E, 0x4D, 0x4A, 0x2E, 0x56, 0x0F, 0x78, 0x50, 0x53, 0x53, 
-    0x4A, 0x56, 0x2E, 0x2E, 0x72, 0x50, 0x32, 0x4A, 0x2E, 0x2E, 0x2E, 0x53, 
-    0x72, 0x32, 0x53, 0x4A, 0x2E, 0x56, 0x56, 0x4E, 0x72, 0x32, 0x53, 0x4D, 
-    0x2E, 0x56, 0x56, 0x32, 0x72, 0x50, 0x53, 0x4A, 0x2E, 0x56, 0x4A, 0x53, 
-    0x78, 0x53, 0x4A, 0x2E, 0x2E, 0x56, 0x2E, 0x2E, 0x24, 0x56, 0x32, 0x74, 
-    0x32, 0x50, 0x32, 0x53, 0x0F, 0x24, 0x4A, 0x32, 0x72, 0x68, 0x52, 0x78, 
-    0x0F, 0x0F, 0x56, 0x53, 0x9F, 0x89, 0x96, 0x52, 0x56, 0x0F, 0x0F, 0x4A, 
-    0x52, 0x7B, 0x91, 0x74, 0x2E, 0x0F, 0x0F, 0x56, 0x50, 0x7B, 0x89, 0x75, 
-    0x2E, 0x0F, 0x0F, 0x24, 0x4D, 0x68, 0x89, 0x91, 0x2E, 0x0F, 0x0F, 0x24, 
-    0x4D, 0x4D, 0x52, 0x91, 0x2E, 0x0F, 0x0F, 0x2E, 0x53, 0x4A, 0x50, 0x68, 
-    0x53, 0x2E, 0x56, 0x56, 0x32, 0x56, 0x0E, 0x0E, 0x53, 0x2E, 0x56, 0x2E, 
-    0x77, 0x4D, 0x56, 0x0F, 0x32, 0x32, 0x4A, 0x2E, 0x74, 0x4D, 0x56, 0x0F, 
-    0x32, 0x32, 0x32, 0x2E, 0x53, 0x4A, 0x56, 0x0F, 0x78, 0x32, 0x32, 0x53, 
-    0x24, 0x0F, 0x0F, 0x0F, 0x72, 0x32, 0x32, 0x53, 0x24, 0x0E, 0x0F, 0x0F, 
-    0x73, 0x50, 0x50, 0x53, 0x2E, 0x24, 0x0E, 0x0F, 0x75, 0x72, 0x50, 0x32, 
-    0x53, 0x24, 0x0E, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x23, 0x10, 0x0E, 
-    0x0E, 0x0E, 0x0F, 0x10, 0x0F, 0x0F, 0x0F, 0x0E, 0x34, 0x0F, 0x56, 0x23, 
-    0x0F, 0x0E, 0x0F, 0x24, 0x34, 0x0F, 0x2E, 0x62, 0x0F, 0x0C, 0x0E, 0x56, 
-    0x0E, 0x0F, 0x10, 0x2E, 0x0F, 0x0E, 0x0F, 0x56, 0x0E, 0x10, 0x10, 0x0E, 
-    0x0E, 0x0F, 0x10, 0x2E, 0x10, 0x10, 0x10, 0x0E, 0x0F, 0x0F, 0x2E, 0x2E, 
-    0x23, 0x0E, 0x0F, 0x0F, 0x2E, 0x2E, 0x2E, 0x2E, 0x0E, 0x0F, 0x13, 0x0F, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x56, 0x23, 0x0F, 0x0C, 0x0E, 0x0E, 0x0E, 0x0F, 0x2E, 0x2E, 0x0F, 0x0C, 
-    0x0C, 0x0E, 0x0F, 0x0F, 0x2E, 0x2E, 0x0E, 0x0B, 0x0C, 0x24, 0x56, 0x56, 
-    0x2E, 0x24, 0x0C, 0x0C, 0x0B, 0x0F, 0x2E, 0x56, 0x2E, 0x0E, 0x0B, 0x0B, 
-    0x0B, 0x0F, 0x2E, 0x56, 0x2E, 0x0F, 0x0B, 0x0F, 0x0F, 0x0C, 0x0F, 0x2E, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x0B, 0x0C, 0x1A, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x30, 0x17, 0x35, 
-    0x01, 0x01, 0x01, 0x0B, 0x16, 0x1B, 0x26, 0x41, 0x01, 0x01, 0x0B, 0x0C, 
-    0x16, 0x20, 0x21, 0x26, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x0E, 0x16, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x13, 0x51, 0x13, 0x60, 0x7E, 0x5F, 0xC1, 
-    0x1A, 0x1A, 0x47, 0x41, 0x60, 0x83, 0x6E, 0xC1, 0x35, 0x3B, 0x47, 0x43, 
-    0x60, 0x83, 0x9D, 0xC1, 0x41, 0x26, 0x47, 0x69, 0x60, 0x6A, 0x64, 0xC1, 
-    0x69, 0x41, 0x41, 0x43, 0x3E, 0x3F, 0x3E, 0x6C, 0x20, 0x47, 0x47, 0x35, 
-    0x35, 0x37, 0x3E, 0x59, 0x0B, 0x0B, 0x0B, 0x0B, 0x21, 0x1B, 0x8F, 0x6F, 
-    0x01, 0x0B, 0x01, 0x0B, 0x22, 0x37, 0x37, 0x6A, 0x71, 0x1E, 0x34, 0x0E, 
-    0x0E, 0x0F, 0x34, 0x0E, 0x71, 0x1E, 0x34, 0x0E, 0x0B, 0x34, 0x13, 0x0E, 
-    0x71, 0x01, 0x0F, 0x0F, 0x0E, 0x0F, 0x2E, 0x0E, 0x6B, 0x1E, 0x0F, 0x0E, 
-    0x0E, 0x13, 0x34, 0x0E, 0x6B, 0x01, 0x13, 0x0F, 0x0B, 0x2E, 0x34, 0x0C, 
-    0x58, 0x39, 0x0F, 0x0F, 0x0C, 0x2E, 0x2E, 0x0C, 0x5F, 0x90, 0x18, 0x25, 
-    0x0E, 0x0F, 0x2E, 0x0C, 0x9C, 0x97, 0x0E, 0x25, 0x0C, 0x2E, 0x2E, 0x0C, 
-    0x20, 0x5C, 0x5C, 0x0E, 0x0E, 0x0E, 0x2E, 0x2E, 0x23, 0x26, 0x5C, 0x5C, 
-    0x21, 0x1E, 0x0F, 0x0E, 0x0E, 0x25, 0x20, 0x42, 0x37, 0x16, 0x0E, 0x0E, 
-    0x0F, 0x34, 0x13, 0x19, 0x5C, 0x5D, 0x0F, 0x2E, 0x0F, 0x34, 0x34, 0x13, 
-    0x26, 0x43, 0x10, 0x4A, 0x0F, 0x2E, 0x0E, 0x2D, 0x19, 0x41, 0x10, 0x2E, 
-    0x0F, 0x2E, 0x0F, 0x56, 0x19, 0x36, 0x10, 0x2E, 0x0F, 0x2E, 0x25, 0x2D, 
-    0x19, 0x59, 0x37, 0x2D, 0x10, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x56, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x56, 0x0F, 0x0E, 0x0E, 0x0F, 
-    0x0F, 0x0F, 0x0F, 0x0F, 0x2E, 0x56, 0x0E, 0x0F, 0x0E, 0x0F, 0x0F, 0x0F, 
-    0x4A, 0x4A, 0x56, 0x56, 0x0F, 0x0F, 0x0F, 0x0F, 0x4A, 0x2E, 0x4A, 0x4A, 
-    0x2E, 0x0F, 0x0F, 0x0F, 0x4A, 0x4A, 0x4A, 0x2E, 0x53, 0x56, 0x0F, 0x0F, 
-    0x4A, 0x4A, 0x4A, 0x4A, 0x53, 0x53, 0x2E, 0x4A, 0x0F, 0x0F, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x0F, 0x0F, 0x0E, 0x0F, 0x24, 0x24, 0x56, 0x53, 
-    0x0F, 0x0F, 0x2E, 0x32, 0x4A, 0x24, 0x2E, 0x32, 0x0F, 0x24, 0x2E, 0x32, 
-    0x4A, 0x0F, 0x56, 0x53, 0x24, 0x0F, 0x0F, 0x2E, 0x56, 0x2E, 0x56, 0x2E, 
-    0x24, 0x0F, 0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x0F, 0x24, 0x0F, 0x0F, 0x0F, 
-    0x4A, 0x53, 0x53, 0x24, 0x2E, 0x0F, 0x0F, 0x24, 0x2E, 0x53, 0x53, 0x0F, 
-    0x2E, 0x2E, 0x4A, 0x53, 0x32, 0x53, 0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x32, 
-    0x32, 0x32, 0x53, 0x4D, 0x2E, 0x56, 0x2E, 0x4A, 0x32, 0x74, 0x74, 0x78, 
-    0x2E, 0x56, 0x2E, 0x2E, 0x32, 0x78, 0x78, 0x77, 0x2E, 0x56, 0x56, 0x56, 
-    0x2E, 0x32, 0x78, 0x77, 0x56, 0x4A, 0x56, 0x0F, 0x56, 0x24, 0x2E, 0x32, 
-    0x2E, 0x78, 0x2E, 0x0F, 0x2E, 0x0F, 0x56, 0x53, 0x56, 0x32, 0x4A, 0x56, 
-    0x32, 0x2E, 0x56, 0x4A, 0x4E, 0x53, 0x53, 0x4E, 0x77, 0x76, 0x4E, 0x32, 
-    0x4D, 0x4A, 0x4E, 0x73, 0x68, 0x78, 0x53, 0x78, 0x4D, 0x4A, 0x4E, 0x73, 
-    0x75, 0x4A, 0x53, 0x78, 0x77, 0x4D, 0x53, 0x77, 0x73, 0x53, 0x4D, 0x78, 
-    0x77, 0x78, 0x32, 0x78, 0x74, 0x4D, 0x4D, 0x78, 0x78, 0x76, 0x33, 0x50, 
-    0x4D, 0x4D, 0x53, 0x32, 0x78, 0x77, 0x77, 0x74, 0x50, 0x4E, 0x4A, 0x53, 
-    0x50, 0x32, 0x4E, 0x74, 0x77, 0x67, 0x32, 0x53, 0x78, 0x78, 0x9F, 0x68, 
-    0x4E, 0x56, 0x53, 0x53, 0x78, 0x77, 0x73, 0x78, 0x4A, 0x56, 0x53, 0x4E, 
-    0x78, 0x77, 0x77, 0x4A, 0x56, 0x56, 0x53, 0x4E, 0x77, 0x68, 0x4D, 0x24, 
-    0x2E, 0x56, 0x53, 0x53, 0x77, 0x89, 0x4D, 0x56, 0x2E, 0x56, 0x4A, 0x53, 
-    0x9F, 0x7B, 0x4D, 0x56, 0x2E, 0x56, 0x53, 0x4E, 0x32, 0x77, 0x4A, 0x2E, 
-    0x2E, 0x56, 0x53, 0x53, 0x2E, 0x56, 0x56, 0x2E, 0x2E, 0x24, 0x53, 0x53, 
-    0x50, 0x50, 0x72, 0x72, 0x9F, 0x68, 0x75, 0x72, 0x78, 0x78, 0x78, 0x74, 
-    0x72, 0x52, 0x73, 0x77, 0x74, 0x74, 0x78, 0x72, 0x32, 0x72, 0x77, 0x77, 
-    0x78, 0x74, 0x77, 0x72, 0x72, 0x74, 0x77, 0x52, 0x78, 0x74, 0x78, 0x74, 
-    0x77, 0x77, 0x52, 0x52, 0x78, 0x74, 0x74, 0x77, 0x77, 0x52, 0x52, 0x52, 
-    0x78, 0x74, 0x77, 0x73, 0x52, 0x72, 0x78, 0x78, 0x50, 0x78, 0x77, 0x77, 
-    0x78, 0x78, 0x77, 0x52, 0x74, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x73, 0x72, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x72, 0x73, 0x9F, 
-    0x73, 0x73, 0x9F, 0x9F, 0x77, 0x74, 0x73, 0x9F, 0x73, 0x73, 0x73, 0x73, 
-    0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x9F, 0x9F, 0x52, 0x52, 0x73, 0x73, 
-    0x73, 0x73, 0x9F, 0x9F, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x9F, 0x9E, 
-    0x77, 0x73, 0x73, 0x9F, 0x73, 0x9F, 0x9F, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9E, 0x3D, 0x16, 0x24, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x69, 0x21, 0x01, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x69, 0x45, 0x0B, 0x9F, 0x9F, 0x73, 0x73, 
-    0x9E, 0x69, 0x21, 0x1E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x69, 0x21, 0x01, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x69, 0x21, 0x01, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9E, 0x69, 0x21, 0x1E, 0x9E, 0x9F, 0x73, 0x9F, 0x9E, 0x69, 0x69, 0x67, 
-    0x10, 0x0F, 0x4E, 0x67, 0x62, 0x25, 0x77, 0x68, 0x0B, 0x23, 0x67, 0x62, 
-    0x0E, 0x3D, 0x67, 0x34, 0x0B, 0x51, 0x99, 0x47, 0x1F, 0x63, 0x79, 0x34, 
-    0x01, 0x53, 0x99, 0x51, 0x0C, 0x67, 0x88, 0x2E, 0x0F, 0x74, 0x8E, 0x88, 
-    0x1E, 0x62, 0x88, 0x67, 0x2E, 0x62, 0x79, 0x73, 0x2E, 0x2E, 0x53, 0x32, 
-    0x32, 0x89, 0x8C, 0x68, 0x79, 0x79, 0x99, 0x79, 0x74, 0x68, 0x62, 0x25, 
-    0x0E, 0x0E, 0x1E, 0x1E, 0x67, 0x74, 0x87, 0x1B, 0x7B, 0xA3, 0x76, 0x76, 
-    0x13, 0x32, 0x3D, 0x23, 0x89, 0xA3, 0xAD, 0x9E, 0x51, 0x3D, 0x51, 0x4A, 
-    0x89, 0xA3, 0x76, 0x75, 0x4A, 0x3D, 0x54, 0x51, 0x7B, 0xA3, 0x76, 0x9E, 
-    0x72, 0x67, 0x54, 0x23, 0x7B, 0xA3, 0xAD, 0x75, 0x51, 0x67, 0x54, 0x19, 
-    0x89, 0xA3, 0xAD, 0x9E, 0x8E, 0xCF, 0x51, 0x4A, 0x89, 0xB7, 0xAD, 0x9E, 
-    0x24, 0x67, 0x73, 0x75, 0x89, 0xA3, 0xAD, 0x9E, 0xAD, 0x76, 0xAD, 0xAD, 
-    0xAD, 0x8A, 0x58, 0x17, 0xAD, 0x76, 0xAD, 0xAD, 0x96, 0x54, 0x58, 0x17, 
-    0xAD, 0xAD, 0xAD, 0xAD, 0x96, 0x54, 0x5D, 0x17, 0xAD, 0x76, 0xAD, 0xAD, 
-    0x96, 0xE0, 0x6A, 0x30, 0x76, 0x76, 0xAD, 0xAD, 0xAD, 0x87, 0x6A, 0x17, 
-    0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x87, 0x6A, 0x3B, 0x76, 0x76, 0xAD, 0xAD, 
-    0xAD, 0x87, 0x6A, 0x17, 0x76, 0xAD, 0xAD, 0xAD, 0xAD, 0x87, 0x6A, 0x17, 
-    0x17, 0x17, 0x17, 0x3B, 0x1B, 0xDD, 0x9A, 0x9A, 0x17, 0x17, 0x17, 0x17, 
-    0x35, 0xDD, 0x9A, 0x9A, 0x17, 0x17, 0x17, 0x17, 0x38, 0xDD, 0x9A, 0x9A, 
-    0x17, 0x17, 0x17, 0x35, 0x3E, 0x9A, 0x9A, 0x9B, 0x17, 0x17, 0x17, 0x17, 
-    0x44, 0x9A, 0x9A, 0x9A, 0x17, 0x17, 0x35, 0x17, 0x37, 0x9A, 0x9A, 0x9A, 
-    0x17, 0x17, 0x17, 0x35, 0x7E, 0x9A, 0x9A, 0x70, 0x17, 0x17, 0x17, 0x1B, 
-    0x7F, 0xDD, 0x9A, 0xE4, 0x5A, 0x0C, 0x0C, 0x0B, 0x0E, 0x0F, 0x1E, 0x01, 
-    0x5F, 0x5A, 0x18, 0x01, 0x0E, 0x0C, 0x0B, 0x01, 0x97, 0x5E, 0x45, 0x0B, 
-    0x0E, 0x0F, 0x0E, 0x01, 0xEE, 0xE3, 0xE3, 0x21, 0x0E, 0x20, 0x0E, 0x01, 
-    0xEE, 0x6D, 0x9A, 0x45, 0x0E, 0x31, 0x62, 0x23, 0xE4, 0x6D, 0x9A, 0x5A, 
-    0x46, 0x42, 0x8A, 0xCE, 0xEC, 0x6D, 0xDD, 0xC9, 0x70, 0x6A, 0xE0, 0xE0, 
-    0xE6, 0x6D, 0x9A, 0x6E, 0x6E, 0x5E, 0x9A, 0x65, 0xD5, 0xE5, 0xEB, 0xE6, 
-    0xEC, 0x01, 0x1E, 0x0C, 0x5B, 0xED, 0xE6, 0xE5, 0xE8, 0x0B, 0x25, 0x1E, 
-    0x01, 0xF1, 0xEB, 0xD4, 0x31, 0x1E, 0x0E, 0x0E, 0x4E, 0x96, 0xAD, 0x96, 
-    0x4D, 0x01, 0x25, 0x19, 0x75, 0x96, 0x96, 0x96, 0x7B, 0x33, 0x33, 0x3D, 
-    0x88, 0x96, 0x96, 0xAD, 0xA8, 0xB7, 0xA5, 0xCF, 0x99, 0x96, 0x96, 0x96, 
-    0x96, 0xD7, 0xE0, 0x87, 0x87, 0x96, 0x96, 0x96, 0xD8, 0xE7, 0xE3, 0x9A, 
-    0x1F, 0x0C, 0x0C, 0x0C, 0x44, 0x7F, 0x9A, 0x9A, 0x0C, 0x0E, 0x1E, 0x3E, 
-    0x82, 0x9A, 0x9A, 0x9A, 0x0C, 0x0B, 0x39, 0x6A, 0x97, 0x7D, 0x9A, 0x9A, 
-    0x34, 0x1F, 0x83, 0xDD, 0xC8, 0xC1, 0x9A, 0x9A, 0x3B, 0x38, 0x9A, 0xDD, 
-    0xC8, 0xC1, 0x9A, 0x9A, 0x42, 0x60, 0xDD, 0xDD, 0xCA, 0xC1, 0xDD, 0x9A, 
-    0x82, 0xC9, 0x6D, 0xDD, 0xC2, 0xE4, 0x6E, 0x9A, 0x5F, 0xC1, 0x6D, 0xDD, 
-    0xCB, 0xE6, 0xC0, 0xDD, 0x83, 0x17, 0x3B, 0x17, 0x17, 0x17, 0x17, 0x59, 
-    0x59, 0x17, 0x3B, 0x17, 0x38, 0x17, 0x17, 0x59, 0xE2, 0x30, 0x3B, 0x17, 
-    0x38, 0x17, 0x17, 0x59, 0x7F, 0x1B, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5A, 
-    0x7F, 0x35, 0x17, 0x17, 0x17, 0x17, 0x17, 0x59, 0x85, 0x38, 0x17, 0x17, 
-    0x17, 0x17, 0x17, 0xE2, 0x9A, 0x57, 0x17, 0x35, 0x17, 0x17, 0x17, 0xE2, 
-    0x9A, 0x6F, 0x3B, 0x17, 0x17, 0x35, 0x17, 0x5A, 0xE0, 0xB8, 0xA8, 0x9F, 
-    0xAD, 0xAD, 0xAD, 0x8C, 0x81, 0xB8, 0xA2, 0x9F, 0x76, 0x76, 0xAD, 0xA8, 
-    0xE0, 0xB8, 0xA8, 0x9E, 0x76, 0x76, 0x9E, 0x8C, 0x87, 0xB8, 0xA2, 0x9E, 
-    0x76, 0xAD, 0x9E, 0xA8, 0x87, 0x93, 0xA2, 0x9E, 0x76, 0x76, 0x9E, 0xA8, 
-    0x87, 0xB8, 0xA8, 0x9E, 0x76, 0x76, 0x9E, 0xA8, 0x87, 0xA6, 0xA8, 0x9E, 
-    0x76, 0xAD, 0x76, 0xAD, 0x80, 0xB7, 0xA2, 0x9E, 0x76, 0xAD, 0x76, 0x76, 
-    0x93, 0x7B, 0xAD, 0x3A, 0xD4, 0xE6, 0xE5, 0xCB, 0x93, 0x7B, 0x9E, 0x9F, 
-    0xD4, 0xE5, 0x7D, 0x8F, 0xA7, 0x7B, 0x9E, 0x9F, 0xF1, 0xD3, 0x7E, 0x8F, 
-    0xA7, 0x96, 0x9E, 0xAD, 0x9E, 0x50, 0x25, 0x0F, 0xAB, 0x7B, 0x9F, 0xAD, 
-    0xAD, 0x72, 0x38, 0x38, 0xAB, 0x7B, 0x9F, 0x9E, 0x76, 0xE0, 0x82, 0x83, 
-    0xAD, 0x75, 0x75, 0x9E, 0x8C, 0xDF, 0xC9, 0xC0, 0x9E, 0x76, 0x76, 0x9E, 
-    0x96, 0xD8, 0xEA, 0xC2, 0x71, 0x17, 0x17, 0x17, 0x57, 0x7E, 0x67, 0x9F, 
-    0x17, 0x17, 0x17, 0x17, 0x57, 0x59, 0x67, 0x9E, 0x17, 0x17, 0x17, 0x30, 
-    0x57, 0x6C, 0x67, 0x9F, 0x0F, 0x1A, 0x38, 0x26, 0x58, 0x59, 0x63, 0x9F, 
-    0x45, 0x21, 0x36, 0x3F, 0x46, 0x59, 0x5D, 0x77, 0x83, 0x6F, 0x38, 0x44, 
-    0x38, 0x57, 0x5D, 0x73, 0x90, 0x58, 0x1B, 0x30, 0x1A, 0x35, 0x69, 0x73, 
-    0xCA, 0x5E, 0x6F, 0x1A, 0x3B, 0x20, 0x73, 0x75, 0x9F, 0x9F, 0x75, 0x75, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x75, 0x9F, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x75, 0x75, 0x75, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x75, 0x75, 0x9F, 0x9F, 0x75, 
-    0x9F, 0x9F, 0x9F, 0x75, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x75, 0x75, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x9F, 0x9F, 0x73, 0x73, 0x73, 0x73, 
-    0x9F, 0x75, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x52, 0x73, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x52, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x72, 0x52, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x73, 0x52, 0x72, 0x74, 0x73, 0x9F, 0x73, 0x73, 0x72, 0x52, 0x73, 0x72, 
-    0x73, 0x73, 0x52, 0x74, 0x74, 0x52, 0x52, 0x72, 0x73, 0x73, 0x72, 0x32, 
-    0x74, 0x74, 0x52, 0x52, 0x78, 0x74, 0x32, 0x4D, 0x4E, 0x50, 0x53, 0x53, 
-    0x50, 0x4E, 0x4A, 0x4A, 0x4D, 0x50, 0x4A, 0x4A, 0x50, 0x4E, 0x4A, 0x4A, 
-    0x4D, 0x4D, 0x4E, 0x4A, 0x52, 0x74, 0x4D, 0x53, 0x4E, 0x4A, 0x32, 0x4A, 
-    0x72, 0x74, 0x4E, 0x4E, 0x50, 0x4A, 0x4A, 0x2E, 0x72, 0x74, 0x53, 0x4A, 
-    0x32, 0x4A, 0x4D, 0x4A, 0x72, 0x4E, 0x2E, 0x4A, 0x4D, 0x2E, 0x50, 0x50, 
-    0x72, 0x4D, 0x53, 0x50, 0x4D, 0x4A, 0x4E, 0x4E, 0x2E, 0x4E, 0x75, 0x72, 
-    0x89, 0x76, 0x4A, 0x2E, 0x4D, 0x4E, 0x73, 0x52, 0x91, 0x73, 0x4A, 0x53, 
-    0x53, 0x32, 0x73, 0x78, 0x4D, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x78, 0x74, 
-    0x32, 0x56, 0x24, 0x2E, 0x2E, 0x2E, 0x4A, 0x32, 0x78, 0x50, 0x2E, 0x56, 
-    0x2E, 0x2E, 0x2E, 0x4D, 0x77, 0x74, 0x2E, 0x4A, 0x2E, 0x2E, 0x4A, 0x4D, 
-    0x77, 0x78, 0x4A, 0x53, 0x4A, 0x2E, 0x2E, 0x4D, 0x77, 0x74, 0x4A, 0x4D, 
-    0x53, 0x53, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x56, 0x53, 0x53, 0x2E, 0x2E, 
-    0x2E, 0x56, 0x56, 0x56, 0x53, 0x53, 0x2E, 0x56, 0x56, 0x56, 0x56, 0x56, 
-    0x4A, 0x4A, 0x4A, 0x56, 0x56, 0x56, 0x56, 0x56, 0x2E, 0x4A, 0x4D, 0x4A, 
-    0x2E, 0x2E, 0x56, 0x56, 0x53, 0x4A, 0x4A, 0x4A, 0x2E, 0x2E, 0x56, 0x56, 
-    0x50, 0x4A, 0x2E, 0x4A, 0x2E, 0x2E, 0x2E, 0x56, 0x4E, 0x4A, 0x2E, 0x4A, 
-    0x53, 0x32, 0x4D, 0x56, 0x2E, 0x2E, 0x56, 0x24, 0x53, 0x4A, 0x4A, 0x4E, 
-    0x56, 0x2E, 0x56, 0x0F, 0x4A, 0x2E, 0x2E, 0x4A, 0x2E, 0x2E, 0x56, 0x24, 
-    0x4A, 0x4A, 0x2E, 0x2E, 0x2E, 0x4A, 0x56, 0x24, 0x2E, 0x4A, 0x4A, 0x2E, 
-    0x2E, 0x4A, 0x2E, 0x24, 0x56, 0x4D, 0x2E, 0x2E, 0x4A, 0x4A, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x4A, 0x4E, 0x50, 0x4E, 0x53, 0x53, 0x2E, 0x2E, 0x74, 
-    0x32, 0x74, 0x53, 0x4A, 0x4D, 0x4E, 0x50, 0x75, 0x79, 0x73, 0x78, 0x53, 
-    0x53, 0x56, 0x0E, 0x10, 0x77, 0x73, 0x52, 0x4E, 0x53, 0x56, 0x0E, 0x0E, 
-    0x4A, 0x78, 0x73, 0x50, 0x32, 0x56, 0x0E, 0x0E, 0x4A, 0x72, 0x76, 0x72, 
-    0x32, 0x53, 0x0F, 0x0F, 0x4A, 0x73, 0x76, 0x78, 0x50, 0x53, 0x0F, 0x0F, 
-    0x4E, 0x73, 0x73, 0x32, 0x32, 0x32, 0x56, 0x0E, 0x9F, 0x75, 0x72, 0x4E, 
-    0x32, 0x53, 0x56, 0x0F, 0x76, 0x73, 0x74, 0x32, 0x2E, 0x56, 0x0F, 0x0F, 
-    0x10, 0x0E, 0x0F, 0x2E, 0x2E, 0x10, 0x56, 0x56, 0x0E, 0x0E, 0x56, 0x2E, 
-    0x2E, 0x2E, 0x10, 0x56, 0x0E, 0x0E, 0x2E, 0x53, 0x2E, 0x2E, 0x10, 0x10, 
-    0x0F, 0x0F, 0x10, 0x2E, 0x56, 0x0F, 0x10, 0x10, 0x0E, 0x0F, 0x56, 0x2E, 
-    0x2E, 0x2E, 0x10, 0x2E, 0x0E, 0x0F, 0x56, 0x2E, 0x32, 0x2E, 0x0F, 0x34, 
-    0x0F, 0x24, 0x56, 0x24, 0x4A, 0x32, 0x13, 0x0F, 0x0F, 0x24, 0x2E, 0x24, 
-    0x4A, 0x32, 0x13, 0x0F, 0x0F, 0x0E, 0x0B, 0x0F, 0x0F, 0x0B, 0x0E, 0x23, 
-    0x0E, 0x0C, 0x0E, 0x0E, 0x0E, 0x0B, 0x0E, 0x10, 0x0E, 0x0C, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0C, 0x0B, 0x0F, 0x0E, 0x0E, 0x0C, 0x0C, 0x0E, 0x0C, 0x0B, 
-    0x0F, 0x0F, 0x0E, 0x0B, 0x0C, 0x0C, 0x0C, 0x0B, 0x2E, 0x10, 0x0F, 0x0C, 
-    0x0C, 0x0C, 0x0B, 0x0B, 0x0F, 0x34, 0x0F, 0x0F, 0x0F, 0x0C, 0x0B, 0x01, 
-    0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x18, 0x16, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x16, 0x21, 
-    0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x21, 0x21, 0x16, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0C, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x16, 0x41, 0x26, 0x20, 0x3B, 0x35, 0x35, 0x3E, 0x0E, 0x16, 0x16, 0x16, 
-    0x1A, 0x37, 0x3F, 0x59, 0x01, 0x0C, 0x19, 0x17, 0x19, 0x3E, 0x6A, 0x7E, 
-    0x10, 0x20, 0x3D, 0x3D, 0x41, 0x41, 0x3F, 0x6A, 0x20, 0x47, 0x47, 0x47, 
-    0x47, 0x47, 0x43, 0x3F, 0x0C, 0x0E, 0x0E, 0x0F, 0x10, 0x0F, 0x23, 0x26, 
-    0x10, 0x19, 0x17, 0x20, 0x47, 0x0F, 0x0F, 0x34, 0x10, 0x20, 0x19, 0x20, 
-    0x41, 0x69, 0x47, 0x34, 0x7D, 0x97, 0x45, 0x0C, 0x0C, 0x0F, 0x0F, 0x0E, 
-    0x9C, 0xBF, 0x90, 0x0B, 0x25, 0x0E, 0x0E, 0x0C, 0x5F, 0xBF, 0x64, 0x18, 
-    0x18, 0x0E, 0x0E, 0x0E, 0x7F, 0x9C, 0x7D, 0x70, 0x45, 0x01, 0x0E, 0x0E, 
-    0x60, 0x6A, 0x5E, 0x97, 0x45, 0x01, 0x0E, 0x0E, 0x3E, 0x60, 0x83, 0x5E, 
-    0x90, 0x5B, 0x0B, 0x25, 0x47, 0x43, 0x60, 0x5F, 0xC1, 0x71, 0x1E, 0x0E, 
-    0x20, 0x3E, 0x3F, 0x5E, 0x97, 0x71, 0x1E, 0x0E, 0x0E, 0x0E, 0x0E, 0x25, 
-    0x20, 0x6A, 0x58, 0x10, 0x0C, 0x0E, 0x0E, 0x25, 0x1B, 0x3F, 0x5E, 0x46, 
-    0x0F, 0x10, 0x0F, 0x23, 0x42, 0x19, 0x46, 0x5C, 0x10, 0x62, 0x2E, 0x16, 
-    0x20, 0x34, 0x25, 0x41, 0x10, 0x2E, 0x2E, 0x34, 0x34, 0x34, 0x25, 0x1A, 
-    0x0E, 0x10, 0x23, 0x34, 0x34, 0x0F, 0x0E, 0x0E, 0x0E, 0x10, 0x23, 0x0F, 
-    0x0F, 0x0F, 0x0E, 0x34, 0x0E, 0x0C, 0x0F, 0x16, 0x1A, 0x0E, 0x25, 0x34, 
-    0x4A, 0x4A, 0x4A, 0x4D, 0x4A, 0x4A, 0x4A, 0x53, 0x2D, 0x4D, 0x4D, 0x2E, 
-    0x2E, 0x4A, 0x4A, 0x4D, 0x22, 0x2E, 0x4A, 0x2E, 0x4A, 0x4A, 0x4A, 0x2E, 
-    0x6C, 0x22, 0x50, 0x96, 0xAD, 0x4D, 0x2E, 0x2E, 0x46, 0x36, 0x73, 0xA8, 
-    0xA8, 0x77, 0x2E, 0x4A, 0x23, 0x20, 0x74, 0xA8, 0xA4, 0x76, 0x56, 0x2E, 
-    0x1A, 0x34, 0x32, 0x98, 0xB6, 0x68, 0x56, 0x4A, 0x34, 0x1A, 0x36, 0x87, 
-    0x33, 0x4D, 0x2E, 0x4A, 0x2E, 0x4A, 0x56, 0x56, 0x2E, 0x4A, 0x2E, 0x24, 
-    0x4A, 0x32, 0x32, 0x2E, 0x56, 0x2E, 0x2E, 0x2E, 0x53, 0x32, 0x53, 0x2E, 
-    0x56, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x32, 0x74, 0x74, 0x53, 0x24, 0x0F, 
-    0x4A, 0x4A, 0x53, 0x32, 0x75, 0x32, 0x24, 0x24, 0x4A, 0x4A, 0x53, 0x32, 
-    0x75, 0x32, 0x56, 0x53, 0x4A, 0x4A, 0x4A, 0x4D, 0x75, 0x50, 0x24, 0x53, 
-    0x2E, 0x2E, 0x4A, 0x4D, 0x75, 0x32, 0x24, 0x2E, 0x56, 0x53, 0x56, 0x56, 
-    0x32, 0x2E, 0x56, 0x32, 0x53, 0x4A, 0x56, 0x2E, 0x53, 0x56, 0x56, 0x74, 
-    0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x2E, 0x78, 0x56, 0x53, 0x53, 0x53, 
-    0x4D, 0x24, 0x2E, 0x32, 0x56, 0x56, 0x56, 0x53, 0x53, 0x24, 0x56, 0x32, 
-    0x2E, 0x0F, 0x56, 0x53, 0x53, 0x56, 0x4A, 0x78, 0x32, 0x56, 0x56, 0x2E, 
-    0x4A, 0x2E, 0x53, 0x74, 0x2E, 0x0F, 0x56, 0x53, 0x2E, 0x4A, 0x32, 0x78, 
-    0x78, 0x32, 0x53, 0x32, 0x73, 0x68, 0x68, 0x67, 0x74, 0x74, 0x53, 0x32, 
-    0x78, 0x74, 0x77, 0x77, 0x78, 0x77, 0x74, 0x32, 0x4E, 0x53, 0x53, 0x53, 
-    0x78, 0x78, 0x77, 0x77, 0x50, 0x78, 0x32, 0x4D, 0x74, 0x32, 0x50, 0x77, 
-    0x76, 0x77, 0x32, 0x32, 0x78, 0x32, 0x50, 0x78, 0x68, 0x77, 0x32, 0x32, 
-    0x78, 0x74, 0x78, 0x4E, 0x78, 0x74, 0x32, 0x53, 0x78, 0x78, 0x74, 0x32, 
-    0x78, 0x78, 0x32, 0x53, 0x77, 0x33, 0x56, 0x2E, 0x2E, 0x24, 0x56, 0x4A, 
-    0x9F, 0x76, 0x4D, 0x2E, 0x2E, 0x24, 0x56, 0x53, 0x77, 0x96, 0x89, 0x77, 
-    0x4A, 0x2D, 0x56, 0x2E, 0x78, 0x76, 0x7B, 0x7B, 0x7B, 0x67, 0x24, 0x56, 
-    0x78, 0x77, 0x68, 0x76, 0x7B, 0x7B, 0x78, 0x24, 0x32, 0x77, 0x77, 0x12, 
-    0x3C, 0x7B, 0x68, 0x4A, 0x53, 0x4D, 0x78, 0x77, 0x76, 0x96, 0x68, 0x88, 
-    0x53, 0x2E, 0x32, 0x78, 0x77, 0x3C, 0x76, 0x79, 0x32, 0x74, 0x77, 0x77, 
-    0x74, 0x78, 0x77, 0x73, 0x32, 0x78, 0x77, 0x77, 0x74, 0x52, 0x52, 0x73, 
-    0x53, 0x74, 0x74, 0x77, 0x77, 0x77, 0x77, 0x9F, 0x2E, 0x53, 0x4D, 0x4E, 
-    0x73, 0x74, 0x78, 0x52, 0x56, 0x2E, 0x4D, 0x73, 0x79, 0x75, 0x52, 0x52, 
-    0x2E, 0x2E, 0x4A, 0x4D, 0x4E, 0x76, 0x79, 0x76, 0x4D, 0x56, 0x4A, 0x4A, 
-    0x53, 0x78, 0x76, 0x75, 0x32, 0x4A, 0x4A, 0x4D, 0x32, 0x53, 0x4E, 0x52, 
-    0x73, 0x73, 0x9F, 0x9F, 0x73, 0x9F, 0x9F, 0x9F, 0x73, 0x77, 0x9F, 0x73, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x9F, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x73, 0x73, 0x73, 0x9F, 0x73, 0x9F, 0x9F, 0x9F, 0x73, 0x77, 0x52, 0x9F, 
-    0x9F, 0x73, 0x9F, 0x9F, 0x73, 0x72, 0x9F, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 
-    0x91, 0x68, 0x73, 0x72, 0x72, 0x9F, 0x9F, 0x73, 0x75, 0x50, 0x73, 0x76, 
-    0x75, 0x72, 0x52, 0x52, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x3D, 0x3D, 0x72, 
-    0x9F, 0x9F, 0x9F, 0x72, 0x7B, 0xA0, 0x68, 0x25, 0x9F, 0x73, 0x9E, 0x96, 
-    0x98, 0xA1, 0x8C, 0x50, 0x9F, 0xCC, 0x91, 0xBC, 0xA5, 0x93, 0xA2, 0xA0, 
-    0x9E, 0x89, 0x8E, 0xA3, 0xA3, 0xAB, 0xAB, 0xA3, 0x9F, 0x79, 0x89, 0xA3, 
-    0xA7, 0xAB, 0xA3, 0xA5, 0x75, 0x91, 0x96, 0xAE, 0xA3, 0xAB, 0xAE, 0xA5, 
-    0x76, 0x8C, 0x7B, 0xA4, 0xA5, 0xAB, 0xA3, 0xA5, 0x53, 0x2D, 0x0E, 0x24, 
-    0x24, 0x24, 0x24, 0x2E, 0x4E, 0x4E, 0x24, 0x25, 0x04, 0x0B, 0x25, 0x4A, 
-    0x8C, 0x89, 0x76, 0x4A, 0x2E, 0x2E, 0x4A, 0x9F, 0xA1, 0xAE, 0x94, 0x9E, 
-    0x72, 0x78, 0x9E, 0xA2, 0x93, 0xB7, 0x93, 0x93, 0x8D, 0x7B, 0xB5, 0xB5, 
-    0xA3, 0x7B, 0xA3, 0x93, 0xB5, 0x94, 0x93, 0xA1, 0xA3, 0xA2, 0x93, 0x93, 
-    0xB5, 0x94, 0xA3, 0xAB, 0xA9, 0xA6, 0xAF, 0xBA, 0xBA, 0xBA, 0xBA, 0xAF, 
-    0x0E, 0x1E, 0x50, 0x68, 0x8C, 0xA3, 0x76, 0xAD, 0x78, 0x8E, 0x89, 0x73, 
-    0x89, 0xA3, 0xAD, 0x9E, 0x8C, 0x93, 0xAE, 0x79, 0x7B, 0xA3, 0xAD, 0x75, 
-    0x8D, 0x8D, 0xA0, 0x8C, 0x8C, 0xB7, 0xAD, 0x76, 0x8D, 0xA3, 0xA7, 0xA5, 
-    0xBD, 0xB1, 0x76, 0x9E, 0xA5, 0x89, 0xB7, 0xA0, 0xA8, 0x98, 0xAD, 0x9E, 
-    0xAB, 0x89, 0xA0, 0x8D, 0xBC, 0xBC, 0x9E, 0x9E, 0xA9, 0xA3, 0xB7, 0xA6, 
-    0xBC, 0xB1, 0xA8, 0x98, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x6C, 0x6A, 0x3B, 
-    0xAD, 0x76, 0xAD, 0xAD, 0xAD, 0x87, 0x6A, 0x17, 0x76, 0x76, 0xAD, 0xAD, 
-    0xAD, 0x87, 0x6A, 0x3B, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x87, 0x6A, 0x3B, 
-    0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x87, 0x6A, 0x17, 0x76, 0xAD, 0xAD, 0xAD, 
-    0xAD, 0x87, 0x6A, 0x17, 0x76, 0x76, 0x9E, 0xAD, 0xAD, 0x87, 0x6A, 0x30, 
-    0x9F, 0x75, 0x76, 0x76, 0xAD, 0x33, 0x5C, 0x3F, 0x17, 0x17, 0x17, 0x38, 
-    0x7F, 0xDD, 0x9A, 0xE4, 0x17, 0x17, 0x17, 0x1B, 0x7F, 0xDD, 0xDD, 0xE4, 
-    0x17, 0x17, 0x17, 0x1B, 0x7F, 0x9B, 0x6D, 0xEB, 0x17, 0x17, 0x17, 0x38, 
-    0x7F, 0xC8, 0xC8, 0xE5, 0x17, 0x17, 0x17, 0x38, 0xE2, 0xCA, 0xE6, 0xE5, 
-    0x17, 0x17, 0x17, 0x38, 0xE2, 0xC2, 0xE6, 0x6E, 0x17, 0x17, 0x17, 0x38, 
-    0x84, 0xCA, 0xE6, 0xE3, 0x17, 0x17, 0x17, 0x38, 0x84, 0xC2, 0xE6, 0xE3, 
-    0xE6, 0x6D, 0x9A, 0xC8, 0xE4, 0xC0, 0xDD, 0x97, 0xCA, 0x9B, 0xE3, 0xC2, 
-    0xE6, 0xC8, 0x85, 0xD2, 0x6D, 0x9A, 0xC0, 0xE4, 0xE6, 0xE6, 0xE5, 0xF2, 
-    0x6D, 0xDD, 0xC2, 0xE5, 0xE5, 0xE5, 0xE6, 0xF2, 0x6E, 0xDD, 0xC8, 0xE5, 
-    0xE5, 0xE5, 0xE6, 0xD4, 0xE3, 0xC1, 0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xD4, 
-    0x9A, 0xC0, 0xE4, 0xE5, 0xE5, 0xE6, 0xE6, 0xDF, 0xE3, 0xE4, 0xE5, 0xE5, 
-    0xE5, 0xE6, 0xE6, 0xC7, 0x80, 0xAD, 0x96, 0x96, 0x92, 0xF4, 0x9B, 0x65, 
-    0xF0, 0x96, 0x96, 0x96, 0xA8, 0xF3, 0x9D, 0xBF, 0xD7, 0xAD, 0x96, 0x96, 
-    0xA4, 0xD4, 0xE5, 0xEC, 0xD7, 0xAD, 0x96, 0x96, 0xA2, 0xD4, 0xE6, 0xE5, 
-    0x98, 0xAD, 0x96, 0x96, 0xA4, 0xDF, 0xE5, 0xE5, 0x98, 0xAD, 0x96, 0x96, 
-    0xA4, 0xC7, 0xE5, 0xEC, 0xA8, 0xAD, 0x96, 0x96, 0xA4, 0xB2, 0xD4, 0xE5, 
-    0xA4, 0xAD, 0xAD, 0x96, 0xA6, 0xA3, 0xBD, 0xEC, 0xEB, 0xCA, 0x6D, 0xDD, 
-    0xCA, 0xE6, 0xC0, 0xDD, 0xE5, 0xE6, 0xC0, 0xDD, 0xC0, 0xEB, 0xC0, 0xDD, 
-    0xE5, 0xE6, 0xCB, 0xE3, 0xDD, 0xCA, 0xC8, 0xE3, 0xE5, 0xE5, 0xEB, 0x6D, 
-    0xDD, 0xCA, 0xE4, 0xCA, 0xE5, 0xE5, 0xE4, 0x6D, 0xE3, 0xE4, 0xE6, 0xE5, 
-    0xE5, 0xE6, 0xE5, 0xC2, 0xE3, 0x86, 0xCB, 0xE5, 0xE5, 0xE5, 0xE5, 0xCB, 
-    0xE3, 0xDD, 0xCB, 0xE6, 0xE6, 0xE5, 0xE5, 0xEB, 0x6E, 0xDD, 0xC8, 0xE6, 
-    0x9A, 0x58, 0x3B, 0x17, 0x17, 0x17, 0x17, 0x59, 0x9A, 0x58, 0x3B, 0x17, 
-    0x17, 0x17, 0x17, 0x59, 0x9B, 0x6F, 0x3B, 0x35, 0x17, 0x35, 0x17, 0xE2, 
-    0x9D, 0x6F, 0x3B, 0x17, 0x17, 0x17, 0x17, 0x59, 0x9C, 0x6F, 0x3B, 0x17, 
-    0x35, 0x17, 0x17, 0xE2, 0x9C, 0x6F, 0x3B, 0x17, 0x35, 0x17, 0x3B, 0xE2, 
-    0x5F, 0x6F, 0x17, 0x35, 0x3B, 0x35, 0x36, 0x85, 0xE3, 0xDC, 0x35, 0x35, 
-    0x3B, 0x44, 0x59, 0x69, 0x95, 0xB7, 0xA2, 0x9E, 0x75, 0x96, 0xAD, 0x91, 
-    0x87, 0xB7, 0xA2, 0x9E, 0x75, 0x89, 0x96, 0x96, 0x95, 0xA7, 0xA2, 0x9E, 
-    0xAD, 0x91, 0x96, 0x96, 0x87, 0xA0, 0x8C, 0xAD, 0x76, 0xAD, 0x76, 0x76, 
-    0x81, 0xA4, 0x7B, 0xAD, 0x76, 0x76, 0x76, 0x9E, 0x87, 0xA3, 0xA8, 0x9E, 
-    0x76, 0x76, 0xAD, 0x8C, 0x87, 0xA3, 0xA2, 0x75, 0x76, 0x76, 0x9E, 0xA2, 
-    0x88, 0xA3, 0xA8, 0x9E, 0xAD, 0xAD, 0x9E, 0xA8, 0xA0, 0x91, 0x9F, 0xAD, 
-    0xAD, 0x43, 0x83, 0xC8, 0xA3, 0x7B, 0x9E, 0x96, 0x67, 0xE2, 0x9A, 0xC1, 
-    0xAE, 0x91, 0x9E, 0x33, 0x87, 0xE3, 0x9D, 0xCA, 0x7B, 0x96, 0x67, 0x86, 
-    0xC8, 0xE4, 0xE4, 0xE5, 0x96, 0x3A, 0x86, 0xC1, 0xCA, 0xC8, 0xC0, 0x6E, 
-    0xB6, 0x95, 0xBF, 0xC8, 0x70, 0x71, 0x66, 0x39, 0xCD, 0x6D, 0xE3, 0x71, 
-    0x45, 0x1E, 0x25, 0x25, 0xB1, 0x90, 0xDE, 0x8F, 0x17, 0x34, 0x34, 0x25, 
-    0xE4, 0x65, 0x6F, 0x34, 0x38, 0x5C, 0x67, 0x9F, 0xE4, 0xE3, 0x57, 0x34, 
-    0x38, 0x5D, 0x67, 0x9F, 0xE4, 0x65, 0x6F, 0x34, 0x1B, 0x59, 0x67, 0x9F, 
-    0xE4, 0x9D, 0xDC, 0x3B, 0x1B, 0x59, 0x67, 0x9E, 0xEC, 0xE4, 0x85, 0x1B, 
-    0x1B, 0x59, 0x67, 0x9F, 0xE8, 0xE4, 0x90, 0x38, 0x26, 0x59, 0x67, 0x9F, 
-    0x61, 0xC1, 0xC8, 0x1B, 0x40, 0x7E, 0x67, 0x9F, 0x40, 0xC8, 0xC2, 0x57, 
-    0x6A, 0x82, 0x77, 0x9F, 0x73, 0x73, 0x9F, 0x73, 0x73, 0x73, 0x73, 0x73, 
-    0x73, 0x9F, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x73, 0x9F, 0x9F, 0x73, 0x73, 
-    0x9F, 0x9F, 0x9F, 0x77, 0x9F, 0x9F, 0x73, 0x73, 0x9F, 0x9F, 0x73, 0x77, 
-    0x9F, 0x9F, 0x9F, 0x52, 0x9F, 0x73, 0x77, 0x77, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x73, 0x77, 0x77, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x73, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x77, 0x77, 0x74, 0x32, 
-    0x72, 0x74, 0x52, 0x72, 0x77, 0x52, 0x74, 0x74, 0x73, 0x52, 0x52, 0x50, 
-    0x77, 0x52, 0x78, 0x72, 0x52, 0x74, 0x52, 0x50, 0x77, 0x52, 0x78, 0x78, 
-    0x52, 0x32, 0x50, 0x32, 0x77, 0x77, 0x78, 0x74, 0x72, 0x32, 0x4A, 0x4A, 
-    0x77, 0x77, 0x50, 0x50, 0x72, 0x53, 0x2E, 0x2E, 0x77, 0x77, 0x74, 0x78, 
-    0x74, 0x53, 0x2E, 0x4A, 0x77, 0x77, 0x77, 0x74, 0x78, 0x53, 0x2E, 0x4A, 
-    0x32, 0x4A, 0x50, 0x73, 0x32, 0x2E, 0x4A, 0x4D, 0x4A, 0x2E, 0x53, 0x50, 
-    0x4E, 0x2E, 0x2E, 0x32, 0x4A, 0x2E, 0x2E, 0x2E, 0x53, 0x4A, 0x4A, 0x50, 
-    0x4A, 0x4A, 0x4A, 0x53, 0x32, 0x4D, 0x32, 0x50, 0x4A, 0x50, 0x74, 0x4A, 
-    0x4A, 0x4D, 0x78, 0x32, 0x4A, 0x32, 0x74, 0x4A, 0x2E, 0x4D, 0x78, 0x32, 
-    0x32, 0x4E, 0x53, 0x4A, 0x4A, 0x4E, 0x52, 0x78, 0x78, 0x4E, 0x2E, 0x4A, 
-    0x4D, 0x78, 0x52, 0x32, 0x32, 0x4A, 0x4A, 0x32, 0x74, 0x32, 0x4A, 0x2E, 
-    0x73, 0x4A, 0x4A, 0x73, 0x52, 0x32, 0x4A, 0x56, 0x73, 0x2E, 0x4A, 0x9F, 
-    0x73, 0x78, 0x53, 0x2E, 0x32, 0x4A, 0x4A, 0x50, 0x77, 0x74, 0x32, 0x4A, 
-    0x4A, 0x4A, 0x4D, 0x4A, 0x32, 0x72, 0x74, 0x53, 0x4D, 0x32, 0x52, 0x50, 
-    0x32, 0x74, 0x32, 0x4A, 0x4D, 0x74, 0x75, 0x72, 0x50, 0x74, 0x53, 0x4A, 
-    0x53, 0x32, 0x78, 0x4E, 0x53, 0x50, 0x4E, 0x77, 0x4A, 0x2E, 0x4A, 0x4D, 
-    0x53, 0x32, 0x53, 0x2E, 0x2E, 0x2E, 0x2E, 0x53, 0x32, 0x4D, 0x53, 0x56, 
-    0x56, 0x2E, 0x2E, 0x4A, 0x2E, 0x4D, 0x74, 0x50, 0x56, 0x2E, 0x4A, 0x4A, 
-    0x2E, 0x4E, 0x73, 0x73, 0x2E, 0x56, 0x4A, 0x50, 0x73, 0x75, 0x75, 0x77, 
-    0x4A, 0x50, 0x75, 0x79, 0x89, 0x79, 0x52, 0x78, 0x4E, 0x88, 0x89, 0x76, 
-    0x9E, 0x75, 0x77, 0x4E, 0x76, 0x68, 0x76, 0x77, 0x74, 0x78, 0x78, 0x4E, 
-    0x4A, 0x4D, 0x4A, 0x2E, 0x72, 0x68, 0x77, 0x72, 0x53, 0x68, 0x68, 0x75, 
-    0x67, 0x75, 0x78, 0x78, 0x75, 0x89, 0x76, 0x73, 0x72, 0x50, 0x32, 0x32, 
-    0x52, 0x9F, 0x78, 0x32, 0x74, 0x32, 0x2E, 0x53, 0x74, 0x32, 0x32, 0x32, 
-    0x53, 0x2E, 0x2E, 0x2E, 0x78, 0x4A, 0x2E, 0x4A, 0x50, 0x74, 0x32, 0x32, 
-    0x4D, 0x4A, 0x2E, 0x4D, 0x68, 0x8C, 0x91, 0x68, 0x53, 0x56, 0x32, 0x88, 
-    0x89, 0x9E, 0x77, 0x78, 0x72, 0x32, 0x32, 0x51, 0x2E, 0x0F, 0x0F, 0x0E, 
-    0x32, 0x32, 0x53, 0x2E, 0x2E, 0x24, 0x0F, 0x0E, 0x32, 0x32, 0x2E, 0x0F, 
-    0x56, 0x56, 0x10, 0x0F, 0x4D, 0x2E, 0x2E, 0x24, 0x24, 0x0F, 0x0F, 0x0F, 
-    0x2E, 0x2E, 0x24, 0x0E, 0x0F, 0x0E, 0x0E, 0x56, 0x50, 0x32, 0x53, 0x0F, 
-    0x0E, 0x24, 0x2E, 0x2E, 0x68, 0x76, 0x77, 0x32, 0x0E, 0x0E, 0x0F, 0x56, 
-    0x50, 0x4E, 0x53, 0x74, 0x2E, 0x0E, 0x0C, 0x0E, 0x0E, 0x24, 0x24, 0x0E, 
-    0x53, 0x74, 0x2E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x2E, 0x2E, 0x0F, 0x0E, 
-    0x0E, 0x0F, 0x2E, 0x2E, 0x0E, 0x0E, 0x0E, 0x0E, 0x56, 0x2E, 0x53, 0x2E, 
-    0x0E, 0x0E, 0x0F, 0x2E, 0x23, 0x56, 0x0F, 0x0F, 0x24, 0x0F, 0x2E, 0x2E, 
-    0x23, 0x0E, 0x0C, 0x0E, 0x56, 0x2E, 0x2E, 0x2E, 0x0F, 0x0F, 0x0E, 0x0F, 
-    0x2E, 0x2E, 0x0F, 0x0F, 0x0F, 0x0F, 0x2E, 0x2E, 0x53, 0x2E, 0x0F, 0x0F, 
-    0x0C, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 
-    0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0F, 0x0F, 0x0E, 0x0C, 
-    0x2E, 0x56, 0x0F, 0x0F, 0x10, 0x0F, 0x0B, 0x0C, 0x2E, 0x2E, 0x2E, 0x56, 
-    0x0E, 0x0E, 0x0C, 0x0E, 0x56, 0x2E, 0x10, 0x0E, 0x0B, 0x0B, 0x1E, 0x0B, 
-    0x56, 0x2E, 0x0E, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x56, 0x10, 0x25, 0x0B, 
-    0x21, 0x59, 0x83, 0x5D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x1F, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x1F, 0x0C, 0x0C, 0x0E, 0x20, 
-    0x41, 0x41, 0x26, 0x3B, 0x01, 0x01, 0x0B, 0x10, 0x19, 0x17, 0x35, 0x35, 
-    0x01, 0x01, 0x0B, 0x0C, 0x0F, 0x19, 0x35, 0x35, 0x01, 0x01, 0x01, 0x0C, 
-    0x20, 0x69, 0x41, 0x41, 0x0B, 0x0B, 0x0B, 0x01, 0x16, 0x22, 0x69, 0x69, 
-    0x0C, 0x0C, 0x0B, 0x01, 0x0C, 0x0B, 0x17, 0x41, 0x18, 0x0C, 0x01, 0x01, 
-    0x01, 0x01, 0x0F, 0x23, 0x0E, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x3E, 0x83, 0x59, 0x5E, 0xBF, 0xBF, 0x66, 0x0B, 0x3E, 0x83, 0x60, 0x59, 
-    0x5E, 0x97, 0x5A, 0x01, 0x35, 0x26, 0x43, 0x43, 0x6A, 0x7E, 0x59, 0x87, 
-    0x26, 0x19, 0x35, 0x35, 0x3F, 0x6A, 0x59, 0x7D, 0x69, 0x19, 0x25, 0x21, 
-    0x17, 0x17, 0x26, 0x6C, 0x41, 0x20, 0x16, 0x5D, 0x3E, 0x24, 0x60, 0x82, 
-    0x19, 0x10, 0x1F, 0x36, 0x21, 0x25, 0x3E, 0x6A, 0x01, 0x0B, 0x1E, 0x1E, 
-    0x25, 0x0B, 0x17, 0x44, 0x0E, 0x0C, 0x21, 0x3E, 0x3E, 0x26, 0x19, 0x16, 
-    0x0E, 0x0F, 0x0F, 0x17, 0x20, 0x69, 0x69, 0x20, 0x45, 0x13, 0x34, 0x25, 
-    0x0E, 0x56, 0x10, 0x17, 0x6C, 0x34, 0x13, 0x0F, 0x0E, 0x0F, 0x24, 0x34, 
-    0x6C, 0x0E, 0x0F, 0x0F, 0x0E, 0x2E, 0x2E, 0x2E, 0x86, 0x80, 0x36, 0x34, 
-    0x0E, 0x56, 0x2E, 0x2E, 0x64, 0x70, 0x46, 0x25, 0x34, 0x56, 0x2E, 0x2E, 
-    0x5A, 0x6E, 0x45, 0x25, 0x1F, 0x24, 0x4A, 0x2E, 0x0E, 0x17, 0x3F, 0x59, 
-    0x18, 0x25, 0x4A, 0x4A, 0x19, 0x20, 0x16, 0x21, 0x0E, 0x24, 0x4A, 0x4A, 
-    0x3D, 0x54, 0x26, 0x16, 0x24, 0x2E, 0x2E, 0x2E, 0x34, 0x1A, 0x5C, 0x3F, 
-    0x34, 0x2E, 0x2E, 0x24, 0x0F, 0x0E, 0x35, 0x3E, 0x0F, 0x56, 0x56, 0x0F, 
-    0x2E, 0x0F, 0x16, 0x3E, 0x16, 0x2D, 0x56, 0x24, 0x2E, 0x0E, 0x38, 0x60, 
-    0x1B, 0x24, 0x0F, 0x24, 0x0F, 0x24, 0x16, 0x60, 0x60, 0x37, 0x0E, 0x0F, 
-    0x2E, 0x4A, 0x4A, 0x4D, 0x73, 0x32, 0x56, 0x24, 0x2E, 0x4A, 0x2E, 0x53, 
-    0x74, 0x32, 0x53, 0x56, 0x4A, 0x4A, 0x2E, 0x4A, 0x74, 0x4D, 0x53, 0x2E, 
-    0x4A, 0x32, 0x2E, 0x4A, 0x50, 0x4D, 0x53, 0x56, 0x4A, 0x4A, 0x2E, 0x53, 
-    0x50, 0x4A, 0x53, 0x56, 0x4A, 0x2E, 0x2E, 0x53, 0x74, 0x56, 0x24, 0x24, 
-    0x2E, 0x2E, 0x56, 0x2E, 0x2E, 0x0E, 0x0F, 0x0F, 0x24, 0x24, 0x2E, 0x2E, 
-    0x0E, 0x0E, 0x0F, 0x24, 0x56, 0x24, 0x24, 0x2E, 0x2E, 0x53, 0x32, 0x74, 
-    0x24, 0x24, 0x56, 0x56, 0x56, 0x32, 0x32, 0x4D, 0x0F, 0x56, 0x56, 0x56, 
-    0x2E, 0x53, 0x53, 0x56, 0x56, 0x4A, 0x4A, 0x56, 0x56, 0x4A, 0x4A, 0x53, 
-    0x24, 0x53, 0x32, 0x4A, 0x4A, 0x2E, 0x53, 0x53, 0x56, 0x4A, 0x4D, 0x53, 
-    0x53, 0x56, 0x24, 0x2E, 0x56, 0x2E, 0x56, 0x2E, 0x4A, 0x24, 0x0F, 0x56, 
-    0x0F, 0x24, 0x24, 0x24, 0x56, 0x0F, 0x0F, 0x56, 0x74, 0x78, 0x78, 0x74, 
-    0x74, 0x78, 0x78, 0x53, 0x53, 0x32, 0x32, 0x32, 0x78, 0x74, 0x32, 0x32, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x53, 0x53, 0x32, 0x32, 0x32, 0x32, 0x4A, 0x53, 
-    0x2E, 0x56, 0x2E, 0x56, 0x4D, 0x74, 0x73, 0x74, 0x2E, 0x4A, 0x2E, 0x56, 
-    0x4A, 0x53, 0x32, 0x74, 0x73, 0x73, 0x4A, 0x56, 0x53, 0x2E, 0x2E, 0x4D, 
-    0x50, 0x72, 0x50, 0x2E, 0x4E, 0x53, 0x2E, 0x2E, 0x2E, 0x32, 0x75, 0x53, 
-    0x4A, 0x2E, 0x53, 0x32, 0x78, 0x73, 0x68, 0x79, 0x32, 0x4A, 0x4A, 0x4D, 
-    0x4E, 0x77, 0x33, 0x77, 0x53, 0x4A, 0x2E, 0x4A, 0x4D, 0x78, 0x76, 0x77, 
-    0x56, 0x4A, 0x32, 0x4D, 0x4D, 0x78, 0x75, 0x73, 0x56, 0x4D, 0x73, 0x74, 
-    0x4D, 0x78, 0x76, 0x74, 0x4A, 0x4A, 0x75, 0x73, 0x4D, 0x50, 0x76, 0x78, 
-    0x53, 0x4A, 0x75, 0x73, 0x4D, 0x78, 0x68, 0x78, 0x4A, 0x53, 0x75, 0x73, 
-    0x4D, 0x78, 0x68, 0x78, 0x53, 0x4A, 0x32, 0x4E, 0x67, 0x32, 0x4A, 0x67, 
-    0x4A, 0x4D, 0x78, 0x50, 0x4E, 0x2E, 0x4A, 0x50, 0x4D, 0x4A, 0x32, 0x4E, 
-    0x2E, 0x2E, 0x2E, 0x4D, 0x32, 0x4A, 0x4E, 0x53, 0x4A, 0x2E, 0x2E, 0x4D, 
-    0x4A, 0x32, 0x77, 0x32, 0x4A, 0x2E, 0x4A, 0x50, 0x2E, 0x32, 0x78, 0x53, 
-    0x2E, 0x2E, 0x4A, 0x50, 0x2E, 0x4D, 0x53, 0x32, 0x2E, 0x4A, 0x4A, 0x4A, 
-    0x56, 0x4A, 0x32, 0x32, 0x4A, 0x50, 0x78, 0x4D, 0x73, 0x4E, 0x72, 0x75, 
-    0x68, 0x73, 0x75, 0x75, 0x50, 0x32, 0x50, 0x50, 0x72, 0x72, 0x72, 0x75, 
-    0x4D, 0x53, 0x4E, 0x4E, 0x72, 0x72, 0x52, 0x76, 0x50, 0x50, 0x73, 0x50, 
-    0x8C, 0xA2, 0x98, 0x91, 0x68, 0x4E, 0x75, 0x50, 0x73, 0x75, 0x75, 0x76, 
-    0x77, 0x4E, 0x73, 0x50, 0x72, 0x72, 0x50, 0x91, 0x4A, 0x4A, 0x4E, 0x4D, 
-    0x52, 0x7B, 0x7B, 0x96, 0x2E, 0x53, 0x50, 0x50, 0x9E, 0x8C, 0x8C, 0x91, 
-    0x9F, 0x9F, 0x52, 0xA2, 0xB8, 0xAB, 0xA3, 0xA6, 0x73, 0x72, 0x72, 0x76, 
-    0xA2, 0xAB, 0xA3, 0xA5, 0x76, 0x68, 0x8C, 0x75, 0x9F, 0xAB, 0xA5, 0x98, 
-    0x9F, 0x91, 0x89, 0x75, 0x9E, 0xA1, 0xA0, 0x8C, 0x75, 0x72, 0x72, 0x89, 
-    0xA8, 0xAB, 0xA6, 0xA6, 0x79, 0x72, 0x96, 0xA0, 0xA0, 0xAB, 0xA7, 0xA6, 
-    0x94, 0xA2, 0xA3, 0xA7, 0xB7, 0xB1, 0xAB, 0xA4, 0x89, 0xA2, 0xB8, 0xAA, 
-    0xB1, 0xBA, 0xAB, 0xB5, 0xA9, 0xAC, 0xB2, 0xC3, 0xC3, 0xC3, 0xC3, 0xB9, 
-    0xA9, 0xAC, 0xB2, 0xC3, 0xC3, 0xC3, 0xC3, 0xBA, 0xAA, 0xAA, 0xB2, 0xC3, 
-    0xC3, 0xC3, 0xC3, 0xBA, 0xA9, 0xAC, 0xB1, 0xC3, 0xC3, 0xC3, 0xC3, 0xBA, 
-    0xA7, 0xAC, 0xB2, 0xC3, 0xC3, 0xC3, 0xC3, 0xBA, 0xA6, 0xAC, 0xB1, 0xBE, 
-    0xC3, 0xC3, 0xC3, 0xBA, 0xA2, 0xA9, 0xB3, 0xC6, 0xDB, 0xDB, 0xBE, 0xAF, 
-    0xB5, 0xAA, 0xB3, 0xDF, 0xF5, 0xDA, 0xBE, 0xA4, 0xA9, 0xA9, 0xA9, 0xB8, 
-    0xAF, 0xB9, 0xB0, 0xB3, 0xA9, 0xA8, 0xA8, 0xA9, 0xB9, 0xC3, 0xAC, 0xB7, 
-    0xAA, 0xA4, 0xA4, 0xA9, 0xBA, 0xC3, 0xAF, 0xA6, 0xAA, 0xAA, 0xB1, 0xB4, 
-    0xBE, 0xC3, 0xBE, 0xB2, 0xA9, 0xB6, 0xB1, 0xBA, 0xBB, 0xC3, 0xDB, 0xC5, 
-    0xA6, 0x96, 0xAE, 0x93, 0xB1, 0xBE, 0xBA, 0xB3, 0xB7, 0xA6, 0xB8, 0xA3, 
-    0xAB, 0xB4, 0xAF, 0xAF, 0xA6, 0x93, 0xA6, 0xB5, 0xB8, 0xB7, 0xA4, 0xA0, 
-    0x8C, 0x7B, 0x75, 0x76, 0xAD, 0x9E, 0x99, 0x60, 0xBC, 0x8C, 0x77, 0x75, 
-    0x9E, 0xAD, 0x8A, 0x60, 0x7B, 0x96, 0x68, 0x89, 0xA4, 0x8B, 0xD7, 0x60, 
-    0xAC, 0xAC, 0xA4, 0x7B, 0xA2, 0xA4, 0xCF, 0x7E, 0xAA, 0xA9, 0xA8, 0x52, 
-    0x73, 0x9F, 0x75, 0x6C, 0xB7, 0xB7, 0xA8, 0x9E, 0x75, 0x9E, 0x76, 0x6C, 
-    0x96, 0x9E, 0x75, 0x75, 0x75, 0xAD, 0xCF, 0x6C, 0x75, 0x9F, 0x75, 0x9E, 
-    0x9F, 0x76, 0xCE, 0x5C, 0x17, 0x17, 0x17, 0x44, 0x64, 0xE4, 0xCB, 0x9A, 
-    0x30, 0x17, 0x17, 0x44, 0x6D, 0xE5, 0xCA, 0xDD, 0x30, 0x17, 0x17, 0x44, 
-    0x90, 0xE4, 0xC8, 0xDD, 0x57, 0x17, 0x17, 0x57, 0xEE, 0xCA, 0x9A, 0xE3, 
-    0x6A, 0x17, 0x17, 0x57, 0xEE, 0xC2, 0xDD, 0xC1, 0x6F, 0x3B, 0x17, 0x61, 
-    0x80, 0x70, 0xDD, 0xC1, 0x57, 0x34, 0x17, 0x83, 0x82, 0xE3, 0xBF, 0xE4, 
-    0x1B, 0x34, 0x1A, 0x84, 0x7F, 0xDD, 0xC0, 0xE6, 0x6D, 0xE5, 0xE5, 0xE5, 
-    0xE6, 0xE5, 0xEB, 0xB3, 0x6D, 0xE4, 0xE6, 0xE5, 0xE5, 0xE5, 0xF6, 0xB8, 
-    0xC1, 0xE5, 0xE6, 0xE6, 0xE5, 0xE5, 0xC5, 0xA3, 0xC0, 0xE5, 0xE5, 0xE6, 
-    0xED, 0x92, 0xB7, 0xB8, 0xE5, 0xE6, 0xE5, 0xE6, 0xEB, 0x8C, 0xB8, 0xB8, 
-    0xE6, 0xE6, 0xE5, 0xE5, 0xED, 0x8C, 0xB8, 0xB8, 0xE5, 0xE5, 0xE6, 0xED, 
-    0x92, 0x7B, 0xB8, 0xB8, 0xE5, 0xE5, 0xE6, 0xEB, 0x9E, 0x94, 0xB8, 0xB8, 
-    0xA2, 0xAD, 0x96, 0xAD, 0xA6, 0xB8, 0xBD, 0xEC, 0xA2, 0xAD, 0x96, 0xAD, 
-    0xA4, 0xB8, 0xBD, 0xE5, 0xA4, 0xAD, 0xAD, 0xAD, 0xA5, 0xB8, 0xBD, 0xEF, 
-    0xA4, 0x9E, 0xAD, 0xAD, 0xA6, 0xB8, 0xA6, 0x89, 0xA4, 0x9E, 0xAD, 0x96, 
-    0xAE, 0xA9, 0xA3, 0x96, 0xA4, 0xAD, 0x76, 0xAD, 0xA0, 0xA7, 0xA3, 0x96, 
-    0xA4, 0xAD, 0x76, 0xAD, 0x7B, 0xA7, 0xA5, 0xAD, 0xA4, 0xAD, 0x96, 0xAD, 
-    0x7B, 0xA7, 0xAE, 0x96, 0xE5, 0xE5, 0xE6, 0xE6, 0xC0, 0xDD, 0xC0, 0xCA, 
-    0xE5, 0xE5, 0xE5, 0xE6, 0xC0, 0xDD, 0x6E, 0xEC, 0xEC, 0xE5, 0xEC, 0xE6, 
-    0xEB, 0x6D, 0x6D, 0xE4, 0xD4, 0xE5, 0xE6, 0xE5, 0xE5, 0x6D, 0xE2, 0xC0, 
-    0xF3, 0xE5, 0xE6, 0xE5, 0xE5, 0xCA, 0xE3, 0x6E, 0xF1, 0xE5, 0xE5, 0xE5, 
-    0xE5, 0xE5, 0x86, 0xE3, 0xD8, 0xEB, 0xE5, 0xEC, 0xE5, 0xE5, 0xC0, 0x85, 
-    0x9E, 0xF0, 0xED, 0xE5, 0xE5, 0xE5, 0xE4, 0x6D, 0x6E, 0xDD, 0x1B, 0x3B, 
-    0x3B, 0x44, 0x59, 0x73, 0xE9, 0xDE, 0x1B, 0x3B, 0x3B, 0x44, 0x95, 0x7A, 
-    0xE9, 0x83, 0x1B, 0x3B, 0x35, 0x44, 0xEA, 0xB0, 0xEB, 0x5E, 0x44, 0x3B, 
-    0x1B, 0x7E, 0x5B, 0x7B, 0xEB, 0x5F, 0x44, 0x3B, 0x1B, 0x7F, 0x42, 0x9F, 
-    0xC2, 0x66, 0x38, 0x3B, 0x1B, 0x7F, 0x42, 0xAD, 0x70, 0x5A, 0x44, 0x3B, 
-    0x1B, 0x5E, 0x87, 0x79, 0xE2, 0x7E, 0x46, 0x0E, 0x16, 0x46, 0xE0, 0x88, 
-    0x96, 0xA3, 0xA2, 0x9E, 0xAD, 0xAD, 0xAD, 0x89, 0x7B, 0xA3, 0xA8, 0x9E, 
-    0xAD, 0xAD, 0x96, 0x96, 0x8B, 0xA5, 0xA2, 0x9E, 0xAD, 0x96, 0xAD, 0xA8, 
-    0x7B, 0xA3, 0xA2, 0x9E, 0xAD, 0xAD, 0xAD, 0xA8, 0x76, 0xA3, 0xA2, 0x9E, 
-    0xAD, 0x96, 0xAD, 0xA8, 0x96, 0xA3, 0xA2, 0x9E, 0xAD, 0x96, 0x9E, 0xA8, 
-    0xAD, 0xA3, 0xA2, 0x9E, 0xAD, 0xAD, 0xAD, 0x96, 0xAD, 0xA3, 0xA2, 0x9E, 
-    0xAD, 0x96, 0xAD, 0xAD, 0xBD, 0xD3, 0x9C, 0xE2, 0x8F, 0x3B, 0x13, 0x1F, 
-    0x94, 0x8C, 0xD2, 0xC1, 0x6D, 0xDC, 0x44, 0x39, 0xAB, 0x7B, 0xE8, 0xC8, 
-    0xC1, 0x9D, 0x64, 0x71, 0xAB, 0x7B, 0x9F, 0x3A, 0xEC, 0xEC, 0xED, 0xF2, 
-    0xAB, 0x7B, 0x9E, 0xAD, 0x3A, 0x33, 0x98, 0xA7, 0xAB, 0x7B, 0x9E, 0x75, 
-    0x9E, 0x9F, 0x94, 0xB8, 0x7B, 0x76, 0x75, 0x76, 0xAD, 0x9E, 0xA4, 0xB8, 
-    0x7B, 0x96, 0x75, 0x76, 0x75, 0x9E, 0x7B, 0xA3, 0x84, 0xC1, 0xCA, 0x86, 
-    0x65, 0x85, 0x73, 0x9E, 0x6D, 0xC0, 0xCA, 0xEF, 0xD5, 0x3D, 0x73, 0x9E, 
-    0xCA, 0x27, 0xE5, 0xEA, 0x67, 0x9F, 0x9F, 0x9F, 0xEB, 0xE4, 0xF1, 0xCC, 
-    0x52, 0x75, 0x9E, 0x75, 0x98, 0x77, 0xCC, 0x9E, 0x75, 0x9F, 0x9F, 0x9F, 
-    0x8D, 0xCC, 0x9F, 0x75, 0x9F, 0x9F, 0x9F, 0x9F, 0x8D, 0x9F, 0x9F, 0x9E, 
-    0x9F, 0x73, 0x9F, 0x9F, 0x8D, 0x52, 0x9F, 0x9E, 0x75, 0x73, 0x73, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x73, 
-    0x73, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9F, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 
-    0x73, 0x9F, 0x9F, 0x9F, 0x77, 0x77, 0x77, 0x77, 0x50, 0x53, 0x2E, 0x4A, 
-    0x73, 0x77, 0x77, 0x77, 0x52, 0x32, 0x2E, 0x2E, 0x9F, 0x73, 0x77, 0x77, 
-    0x74, 0x74, 0x73, 0x75, 0x9F, 0x9F, 0x73, 0x73, 0x77, 0x73, 0x68, 0x76, 
-    0x9F, 0x52, 0x73, 0x9F, 0x73, 0x73, 0x78, 0x4D, 0x9F, 0x9F, 0x73, 0x73, 
-    0x9F, 0x73, 0x74, 0x4A, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x74, 0x53, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x72, 0x32, 0x50, 0x53, 0x2E, 0x4A, 
-    0x77, 0x77, 0x77, 0x78, 0x4D, 0x2E, 0x2E, 0x4D, 0x73, 0x74, 0x74, 0x50, 
-    0x73, 0x50, 0x50, 0x75, 0x73, 0x78, 0x4E, 0x53, 0x68, 0x50, 0x50, 0x75, 
-    0x78, 0x53, 0x53, 0x4E, 0x4D, 0x4A, 0x2E, 0x53, 0x50, 0x4E, 0x4A, 0x4E, 
-    0x4A, 0x4A, 0x4A, 0x32, 0x32, 0x32, 0x2E, 0x4A, 0x4A, 0x32, 0x4E, 0x4E, 
-    0x78, 0x74, 0x2E, 0x4A, 0x4A, 0x78, 0x50, 0x4E, 0x52, 0x74, 0x4A, 0x53, 
-    0x53, 0x4E, 0x50, 0x4A, 0x2E, 0x52, 0x8C, 0x89, 0x4D, 0x50, 0x78, 0x4E, 
-    0x68, 0x79, 0x79, 0x75, 0x4A, 0x53, 0x4D, 0x78, 0x8E, 0x79, 0x77, 0x78, 
-    0x4E, 0x4A, 0x4D, 0x78, 0x76, 0x73, 0x77, 0x74, 0x32, 0x53, 0x78, 0x79, 
-    0x67, 0x74, 0x74, 0x32, 0x4D, 0x4E, 0x78, 0x68, 0x73, 0x50, 0x32, 0x4D, 
-    0x74, 0x53, 0x4E, 0x67, 0x72, 0x4E, 0x4D, 0x4D, 0x74, 0x53, 0x4E, 0x74, 
-    0x4E, 0x53, 0x4D, 0x4E, 0x68, 0x9F, 0x77, 0x74, 0x78, 0x53, 0x53, 0x4D, 
-    0x77, 0x77, 0x78, 0x74, 0x32, 0x4E, 0x2E, 0x4A, 0x74, 0x74, 0x32, 0x53, 
-    0x53, 0x4D, 0x4A, 0x88, 0x50, 0x32, 0x32, 0x4D, 0x4A, 0x78, 0xA8, 0x8B, 
-    0x4D, 0x4E, 0x32, 0x53, 0x24, 0x3C, 0xA6, 0x7A, 0x53, 0x32, 0x4A, 0x4A, 
-    0x4E, 0x79, 0xA4, 0x7B, 0x74, 0x74, 0x4A, 0x50, 0x98, 0x98, 0x7B, 0x9F, 
-    0x32, 0x4E, 0x78, 0x89, 0x98, 0x7B, 0x76, 0x77, 0x4D, 0x74, 0x68, 0x89, 
-    0x9F, 0x78, 0x78, 0x53, 0x78, 0x88, 0x7B, 0x68, 0x78, 0x78, 0x32, 0x53, 
-    0x8C, 0x7B, 0x77, 0x56, 0x4A, 0x4A, 0x53, 0x4E, 0x8C, 0x76, 0x32, 0x2E, 
-    0x4A, 0x4A, 0x53, 0x53, 0x91, 0x78, 0x32, 0x4E, 0x4A, 0x2E, 0x2E, 0x4A, 
-    0x9F, 0x78, 0x32, 0x53, 0x2E, 0x4A, 0x2E, 0x4A, 0x77, 0x32, 0x53, 0x4A, 
-    0x2E, 0x4A, 0x4A, 0x4D, 0x4D, 0x4D, 0x4A, 0x4A, 0x4A, 0x2E, 0x4D, 0x4D, 
-    0x4A, 0x4A, 0x53, 0x32, 0x74, 0x56, 0x0E, 0x0E, 0x53, 0x4A, 0x4A, 0x4A, 
-    0x53, 0x2E, 0x0E, 0x0F, 0x4A, 0x53, 0x4A, 0x4A, 0x2E, 0x56, 0x0E, 0x56, 
-    0x4A, 0x4A, 0x4A, 0x4A, 0x56, 0x0F, 0x24, 0x4A, 0x2E, 0x4A, 0x4A, 0x56, 
-    0x24, 0x56, 0x53, 0x53, 0x4A, 0x4A, 0x2E, 0x24, 0x24, 0x4A, 0x32, 0x32, 
-    0x53, 0x56, 0x24, 0x24, 0x56, 0x53, 0x53, 0x53, 0x2E, 0x0F, 0x0F, 0x2E, 
-    0x32, 0x32, 0x53, 0x53, 0x0F, 0x56, 0x2E, 0x4A, 0x53, 0x2E, 0x0F, 0x56, 
-    0x2E, 0x53, 0x53, 0x53, 0x53, 0x53, 0x56, 0x0E, 0x4A, 0x53, 0x32, 0x32, 
-    0x32, 0x51, 0x2D, 0x36, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x35, 0x6C, 
-    0x2E, 0x4A, 0x56, 0x10, 0x24, 0x0E, 0x82, 0x5F, 0x53, 0x56, 0x2E, 0x56, 
-    0x0F, 0x5A, 0x65, 0x65, 0x4A, 0x10, 0x2E, 0x2D, 0x18, 0x5F, 0x65, 0x82, 
-    0x53, 0x2E, 0x24, 0x21, 0x71, 0x97, 0x7D, 0x7E, 0x2D, 0x0E, 0x3E, 0x59, 
-    0x6C, 0x59, 0x6A, 0x43, 0x17, 0x3E, 0x82, 0x7F, 0x59, 0x3F, 0x3F, 0x41, 
-    0x82, 0x65, 0x82, 0x5D, 0x3E, 0x47, 0x20, 0x47, 0x5F, 0x9A, 0x7E, 0x3F, 
-    0x42, 0x47, 0x19, 0x47, 0x7F, 0x7E, 0x3E, 0x41, 0x41, 0x47, 0x62, 0x20, 
-    0x7F, 0x6A, 0x26, 0x41, 0x41, 0x13, 0x34, 0x1A, 0x83, 0x6A, 0x3F, 0x42, 
-    0x42, 0x35, 0x17, 0x13, 0x6A, 0x5F, 0x5F, 0x65, 0x7F, 0x3F, 0x37, 0x17, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x0C, 
-    0x01, 0x0C, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x0B, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0F, 0x16, 0x37, 
-    0x37, 0x16, 0x26, 0x3F, 0x0F, 0x0E, 0x19, 0x43, 0x3E, 0x26, 0x1B, 0x60, 
-    0x0E, 0x0F, 0x20, 0x1A, 0x0F, 0x0F, 0x34, 0x35, 0x0B, 0x16, 0x20, 0x19, 
-    0x3D, 0x69, 0x3B, 0x1B, 0x0B, 0x0E, 0x16, 0x26, 0x69, 0x54, 0x3B, 0x37, 
-    0x0B, 0x0B, 0x18, 0x20, 0x21, 0x19, 0x34, 0x17, 0x01, 0x01, 0x01, 0x0B, 
-    0x0B, 0x17, 0x20, 0x1B, 0x01, 0x01, 0x01, 0x21, 0x26, 0x42, 0x5D, 0x6A, 
-    0x57, 0x5A, 0x71, 0x46, 0x0E, 0x24, 0x4A, 0x2E, 0x7E, 0x7D, 0xC1, 0x86, 
-    0x25, 0x2D, 0x4A, 0x4A, 0x60, 0x7F, 0xBF, 0x64, 0x0B, 0x0E, 0x24, 0x56, 
-    0x83, 0x7F, 0x9D, 0xBF, 0x6E, 0x21, 0x2D, 0x24, 0x7E, 0x7F, 0x9D, 0xBF, 
-    0xC1, 0x21, 0x25, 0x24, 0x60, 0x7E, 0x9D, 0xBF, 0x97, 0x21, 0x25, 0x24, 
-    0x6A, 0x82, 0x9D, 0xBF, 0xC1, 0x21, 0x25, 0x24, 0x82, 0x7F, 0x9D, 0xBF, 
-    0xC1, 0x23, 0x4A, 0x0F, 0x2E, 0x4A, 0x0F, 0x60, 0x6A, 0x3F, 0x25, 0x25, 
-    0x4A, 0x56, 0x0C, 0x1B, 0x60, 0x3F, 0x38, 0x21, 0x4A, 0x0F, 0x0E, 0x0E, 
-    0x26, 0x60, 0x59, 0x6A, 0x2E, 0x24, 0x0E, 0x13, 0x19, 0x35, 0x26, 0x46, 
-    0x2E, 0x24, 0x0E, 0x1A, 0x34, 0x17, 0x22, 0x5C, 0x2E, 0x0F, 0x0E, 0x0F, 
-    0x34, 0x22, 0x54, 0x3D, 0x56, 0x24, 0x0E, 0x0E, 0x62, 0x62, 0x17, 0x13, 
-    0x24, 0x24, 0x0F, 0x0E, 0x62, 0x13, 0x30, 0x1F, 0x0F, 0x25, 0x0E, 0x0E, 
-    0x25, 0x0E, 0x0F, 0x0F, 0x21, 0x16, 0x18, 0x1F, 0x0E, 0x0E, 0x0E, 0x25, 
-    0x6A, 0x6A, 0x7E, 0x7F, 0x7E, 0x6A, 0x40, 0x45, 0x3F, 0x37, 0x59, 0x59, 
-    0x6A, 0x3F, 0x3E, 0x42, 0x37, 0x20, 0x35, 0x47, 0x19, 0x23, 0x47, 0x1B, 
-    0x1A, 0x17, 0x19, 0x19, 0x17, 0x3B, 0x47, 0x3F, 0x1A, 0x1A, 0x1A, 0x1A, 
-    0x23, 0x47, 0x47, 0x26, 0x1A, 0x1A, 0x1A, 0x1A, 0x47, 0x47, 0x47, 0x41, 
-    0x0F, 0x0F, 0x0F, 0x2E, 0x2E, 0x10, 0x24, 0x56, 0x25, 0x0E, 0x0F, 0x10, 
-    0x2E, 0x2E, 0x56, 0x0F, 0x45, 0x18, 0x56, 0x2E, 0x2E, 0x2E, 0x56, 0x0F, 
-    0x42, 0x0F, 0x25, 0x56, 0x2E, 0x2E, 0x56, 0x56, 0x3E, 0x69, 0x36, 0x21, 
-    0x56, 0x56, 0x2E, 0x2E, 0x59, 0x7E, 0x5F, 0x5D, 0x25, 0x2E, 0x2E, 0x0F, 
-    0x59, 0x7F, 0x9B, 0x65, 0x5C, 0x1A, 0x56, 0x56, 0x5D, 0x7E, 0x7E, 0xBF, 
-    0x70, 0x44, 0x25, 0x56, 0x2E, 0x32, 0x4E, 0x2E, 0x2E, 0x50, 0x73, 0x53, 
-    0x0F, 0x56, 0x4D, 0x53, 0x2E, 0x50, 0x72, 0x4A, 0x0F, 0x24, 0x4A, 0x4A, 
-    0x4A, 0x50, 0x73, 0x74, 0x56, 0x56, 0x2E, 0x4A, 0x4A, 0x50, 0x73, 0x68, 
-    0x56, 0x2E, 0x2E, 0x2E, 0x2E, 0x32, 0x73, 0x75, 0x56, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x4A, 0x52, 0x75, 0x2E, 0x2E, 0x56, 0x2E, 0x4A, 0x4A, 0x52, 0x75, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x74, 0x75, 0x2E, 0x4A, 0x73, 0x73, 
-    0x4A, 0x78, 0x9F, 0x32, 0x4A, 0x4A, 0x9F, 0x73, 0x4A, 0x77, 0x68, 0x74, 
-    0x4D, 0x32, 0x75, 0x73, 0x4A, 0x78, 0x73, 0x75, 0x4A, 0x53, 0x75, 0x74, 
-    0x2E, 0x4D, 0x4D, 0x75, 0x2E, 0x53, 0x74, 0x4D, 0x2E, 0x4A, 0x4A, 0x78, 
-    0x56, 0x56, 0x2E, 0x2E, 0x2E, 0x53, 0x4D, 0x4D, 0x56, 0x56, 0x2E, 0x2E, 
-    0x4A, 0x74, 0x74, 0x56, 0x56, 0x4A, 0x53, 0x4D, 0x4D, 0x52, 0x72, 0x2E, 
-    0x2E, 0x2E, 0x53, 0x4A, 0x4D, 0x78, 0x77, 0x50, 0x4D, 0x4A, 0x53, 0x4A, 
-    0x4D, 0x50, 0x78, 0x4E, 0x67, 0x4D, 0x53, 0x4D, 0x4A, 0x4E, 0x32, 0x53, 
-    0x76, 0x50, 0x53, 0x53, 0x53, 0x32, 0x50, 0x4D, 0x68, 0x77, 0x4E, 0x53, 
-    0x4D, 0x4D, 0x4E, 0x4E, 0x77, 0x68, 0x68, 0x78, 0x4D, 0x4D, 0x53, 0x53, 
-    0x78, 0x68, 0x77, 0x78, 0x53, 0x53, 0x4D, 0x4D, 0x78, 0x75, 0x53, 0x77, 
-    0x53, 0x53, 0x4D, 0x4D, 0x4D, 0x4E, 0x78, 0x8C, 0x91, 0xCC, 0x89, 0x8C, 
-    0x4A, 0x53, 0x50, 0x76, 0x75, 0x76, 0x8E, 0x89, 0x53, 0x4E, 0x74, 0x72, 
-    0x52, 0x52, 0x9F, 0x52, 0x53, 0x50, 0x52, 0x77, 0x77, 0x52, 0x52, 0x73, 
-    0x4E, 0x50, 0x74, 0x52, 0x77, 0x52, 0x77, 0x77, 0x4D, 0x4E, 0x78, 0x52, 
-    0x52, 0x77, 0x52, 0x52, 0x53, 0x4D, 0x50, 0x72, 0x52, 0x77, 0x52, 0x77, 
-    0x4D, 0x4D, 0x4E, 0x32, 0x74, 0x52, 0x77, 0x77, 0xAE, 0xA5, 0xA7, 0xB2, 
-    0xBE, 0xC3, 0xB4, 0xB2, 0x8E, 0x8C, 0x98, 0xB1, 0xB9, 0xBB, 0xBA, 0xB4, 
-    0x72, 0x72, 0x9F, 0xA8, 0xB8, 0xA7, 0xB6, 0xB7, 0xCC, 0x8E, 0xCE, 0x7B, 
-    0xA3, 0xAB, 0xAB, 0xA4, 0xCC, 0x8E, 0x8E, 0x9F, 0x76, 0xA7, 0xB7, 0xAE, 
-    0x77, 0xCC, 0x9F, 0x73, 0x9F, 0xA7, 0xA0, 0xA8, 0x77, 0x52, 0x73, 0x77, 
-    0x9E, 0xA7, 0xBC, 0x8E, 0x9F, 0x9F, 0x73, 0x52, 0x9F, 0xA7, 0xBC, 0xA2, 
-    0xB2, 0xB1, 0xB1, 0xC4, 0xF5, 0xDA, 0xBE, 0xA4, 0xB9, 0xB2, 0xB4, 0xC3, 
-    0xC3, 0xC6, 0xC6, 0x8B, 0xA6, 0xB7, 0xBA, 0xBE, 0xBE, 0xBE, 0xC4, 0xA6, 
-    0x8C, 0xA4, 0xA9, 0xB0, 0xBB, 0xC3, 0xBE, 0xB1, 0xA9, 0xB8, 0xAC, 0xB0, 
-    0xC4, 0xC3, 0xC3, 0xB2, 0xA7, 0xB8, 0xAA, 0xB0, 0xC6, 0xC3, 0xC6, 0xC4, 
-    0xA0, 0xA6, 0xAA, 0xB0, 0xC6, 0xC3, 0xC6, 0xB1, 0xA0, 0xAE, 0xB3, 0xB0, 
-    0xC6, 0xC3, 0xC4, 0xAF, 0xA5, 0xAB, 0xA4, 0x7B, 0xA6, 0xA3, 0xAD, 0x9E, 
-    0xA5, 0xA1, 0xA5, 0xCC, 0xA4, 0xB7, 0x75, 0x75, 0xB8, 0x93, 0xA4, 0xCC, 
-    0x98, 0xB7, 0x9F, 0x75, 0xA7, 0x93, 0xA6, 0xA8, 0xAE, 0xAF, 0xA8, 0x9E, 
-    0xA7, 0xA6, 0xB7, 0xB7, 0xAE, 0xAF, 0xA8, 0x75, 0xAF, 0x96, 0x91, 0x76, 
-    0x98, 0xB7, 0x9F, 0x75, 0xA4, 0x8D, 0xA3, 0x7B, 0x8E, 0xB7, 0x9F, 0x75, 
-    0xA4, 0xA4, 0xA4, 0x96, 0x98, 0xB7, 0x9F, 0x9E, 0x75, 0x75, 0x75, 0x76, 
-    0x9E, 0x76, 0xCE, 0x20, 0x9E, 0x75, 0x75, 0x9E, 0x9E, 0x76, 0xCF, 0x20, 
-    0x75, 0x75, 0x75, 0x75, 0x9E, 0x76, 0x88, 0x20, 0x75, 0x75, 0x75, 0x75, 
-    0xAD, 0x76, 0x99, 0x19, 0x9F, 0x52, 0x73, 0x76, 0x9E, 0x76, 0x99, 0x16, 
-    0x75, 0x9E, 0xAD, 0x76, 0x9E, 0x76, 0x63, 0x13, 0x9F, 0xA2, 0x8C, 0x9F, 
-    0xAD, 0xAD, 0x74, 0x34, 0x9F, 0xA2, 0x94, 0x9F, 0x76, 0x76, 0x74, 0x34, 
-    0x0E, 0x0E, 0x25, 0x38, 0x6C, 0xE3, 0xC0, 0xE5, 0x30, 0x0C, 0x0E, 0x1F, 
-    0x38, 0x58, 0x6E, 0xE5, 0x1F, 0x0E, 0x37, 0x38, 0x3B, 0x61, 0x86, 0xEC, 
-    0x39, 0x57, 0x59, 0x5A, 0x40, 0x38, 0x8F, 0x6E, 0x5A, 0x5F, 0x5A, 0x5E, 
-    0x97, 0x38, 0x39, 0x86, 0x71, 0x86, 0x18, 0x8F, 0x70, 0x5A, 0x1A, 0x39, 
-    0x5A, 0x86, 0x1A, 0x57, 0x70, 0x64, 0x1F, 0x25, 0x71, 0x86, 0x30, 0x5A, 
-    0xC2, 0xCB, 0x6B, 0x1E, 0xE6, 0xE5, 0xE5, 0xD4, 0xAD, 0x94, 0xB8, 0x93, 
-    0xE6, 0xE5, 0xEB, 0x15, 0xAD, 0x94, 0xB8, 0xB8, 0xE6, 0xE6, 0xEB, 0x96, 
-    0xAD, 0x94, 0xB8, 0xB8, 0xE5, 0xE6, 0xEB, 0x96, 0xAD, 0x94, 0x93, 0xB8, 
-    0xEB, 0xE5, 0xE5, 0xD7, 0xA0, 0x94, 0xB8, 0xB8, 0x5B, 0x81, 0x3A, 0x8C, 
-    0x7B, 0x94, 0xB8, 0xB8, 0x16, 0x45, 0x78, 0x96, 0xAD, 0xA8, 0xB8, 0xB8, 
-    0x86, 0x97, 0x5B, 0x96, 0xAD, 0xA8, 0xB8, 0x93, 0xA4, 0xAD, 0x76, 0xAD, 
-    0x7B, 0xA7, 0xAE, 0xAD, 0xA4, 0xAD, 0x76, 0x96, 0x91, 0xA7, 0xAE, 0xAD, 
-    0xA4, 0xAD, 0x76, 0xAD, 0x96, 0xA7, 0xAE, 0xAD, 0xA4, 0xAD, 0x76, 0xAD, 
-    0x91, 0xB7, 0xAE, 0x96, 0xA4, 0x76, 0x76, 0xAD, 0x7B, 0xA7, 0xAE, 0xAD, 
-    0xA4, 0x76, 0x76, 0xAD, 0x7B, 0xA7, 0xAE, 0x9E, 0xA4, 0x76, 0x76, 0xAD, 
-    0x7B, 0xB7, 0xAE, 0xAD, 0xA4, 0x76, 0x76, 0xAD, 0x7B, 0xA7, 0xAE, 0xAD, 
-    0xAD, 0xF0, 0xF2, 0xEC, 0xE5, 0xE6, 0xE4, 0x9D, 0xAD, 0x91, 0xF1, 0xEC, 
-    0xEC, 0xE5, 0xE5, 0x5A, 0x76, 0x9E, 0xF0, 0xEC, 0xE5, 0xEC, 0xCA, 0x66, 
-    0x76, 0xAD, 0xF0, 0xE5, 0xE6, 0xCA, 0x71, 0x39, 0x7B, 0x94, 0xF0, 0xE5, 
-    0xE5, 0xCB, 0x61, 0x30, 0x91, 0x91, 0x33, 0xD5, 0xD5, 0x31, 0x18, 0x21, 
-    0xAD, 0x96, 0x9E, 0x62, 0x21, 0x0F, 0x3B, 0x21, 0xAD, 0x96, 0x33, 0xC0, 
-    0xC8, 0x21, 0x0E, 0xE8, 0xE2, 0x8F, 0x0E, 0x0E, 0x0E, 0x17, 0x54, 0x99, 
-    0x8F, 0x17, 0x1A, 0x0E, 0x0E, 0x38, 0x42, 0x99, 0x3B, 0x3B, 0x1B, 0x17, 
-    0x25, 0x17, 0x42, 0x99, 0x38, 0x57, 0x59, 0x58, 0x40, 0x38, 0x69, 0x99, 
-    0x86, 0x7D, 0x86, 0x85, 0x5F, 0x61, 0x69, 0x99, 0xC9, 0x86, 0x30, 0x39, 
-    0x5F, 0x61, 0x41, 0x3D, 0xD2, 0x6E, 0x17, 0x17, 0x7D, 0x45, 0x13, 0x67, 
-    0xEB, 0xBF, 0x38, 0x21, 0x7D, 0x61, 0x17, 0x3D, 0x96, 0xA3, 0xA2, 0x9E, 
-    0xAD, 0x96, 0xA8, 0x96, 0xAD, 0xA3, 0xA8, 0x9E, 0xAD, 0x96, 0xAE, 0x7B, 
-    0xAD, 0xA3, 0xA2, 0x9E, 0xAD, 0x91, 0xA0, 0x7B, 0xAD, 0xA3, 0xA2, 0x9E, 
-    0xAD, 0x96, 0xAD, 0x96, 0xAD, 0xA3, 0xA2, 0xAD, 0xAD, 0xAD, 0x9E, 0x96, 
-    0x96, 0xA3, 0xA2, 0xAD, 0x76, 0xAD, 0x9F, 0x96, 0x76, 0xA3, 0xA2, 0x9E, 
-    0x9E, 0x7B, 0x7B, 0x96, 0x76, 0xA3, 0xA2, 0x9E, 0x9E, 0xA2, 0xA0, 0x96, 
-    0xB7, 0x8C, 0x9E, 0x75, 0x75, 0x9E, 0xCC, 0xA0, 0xB7, 0x8C, 0x9F, 0x9E, 
-    0x76, 0x9E, 0x9F, 0xA0, 0xB7, 0x8C, 0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0xA0, 
-    0xB7, 0x8C, 0x9F, 0x9E, 0x9E, 0x9E, 0x9F, 0xA0, 0xB7, 0x8C, 0x9F, 0x76, 
-    0x75, 0x9E, 0x9F, 0xA0, 0xB7, 0x8A, 0x63, 0x9E, 0x75, 0x75, 0x9F, 0xA0, 
-    0xCD, 0x90, 0x54, 0x9F, 0x9F, 0x9E, 0x9F, 0xA0, 0xCD, 0x7D, 0x54, 0x9F, 
-    0x75, 0x9E, 0x9F, 0xA0, 0xA0, 0x9F, 0x9E, 0x75, 0x73, 0x73, 0x73, 0x9F, 
-    0xA0, 0x9F, 0x9E, 0x75, 0x75, 0x73, 0x73, 0x9F, 0xA0, 0x52, 0x9E, 0x75, 
-    0x75, 0x73, 0x73, 0x9F, 0xA0, 0x9F, 0x9F, 0x9F, 0x75, 0x73, 0x73, 0x9F, 
-    0xA0, 0x9F, 0x73, 0x67, 0x9F, 0x73, 0x73, 0x9F, 0xA0, 0xCC, 0xEA, 0xD3, 
-    0x78, 0x52, 0x73, 0x9F, 0xA0, 0x50, 0xE7, 0xEE, 0x32, 0x72, 0x77, 0x73, 
-    0xA0, 0xCC, 0xF1, 0xD4, 0x79, 0x91, 0x89, 0x89, 0x9F, 0x9F, 0x9F, 0x73, 
-    0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x9F, 0x9F, 0x73, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 
-    0x73, 0x73, 0x73, 0x9F, 0x9F, 0x9F, 0x75, 0x75, 0x73, 0x73, 0x73, 0x73, 
-    0x9F, 0x73, 0x75, 0x75, 0x9F, 0x75, 0x75, 0x9F, 0x73, 0x77, 0x73, 0x77, 
-    0x52, 0x73, 0x73, 0x52, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x9F, 0x52, 0x73, 0x78, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x73, 0x74, 0x4D, 
-    0x9F, 0x9F, 0x9F, 0x9F, 0x52, 0x52, 0x74, 0x4A, 0x9F, 0x9F, 0x9F, 0x9F, 
-    0x52, 0x32, 0x4A, 0x4A, 0x9F, 0x9F, 0x9F, 0x9F, 0x78, 0x53, 0x4A, 0x32, 
-    0x52, 0x52, 0x52, 0x72, 0x2E, 0x24, 0x2E, 0x51, 0x89, 0x89, 0x89, 0x89, 
-    0x91, 0x68, 0x68, 0x91, 0x4D, 0x72, 0x50, 0x53, 0x78, 0x74, 0x53, 0x4D, 
-    0x4A, 0x32, 0x4E, 0x56, 0x4E, 0x74, 0x53, 0x4A, 0x2E, 0x2E, 0x2E, 0x24, 
-    0x53, 0x74, 0x4A, 0x2E, 0x2E, 0x4A, 0x4A, 0x56, 0x4D, 0x74, 0x53, 0x2E, 
-    0x4D, 0x32, 0x50, 0x4A, 0x4D, 0x74, 0x4D, 0x56, 0x4A, 0x4A, 0x53, 0x2E, 
-    0x2E, 0x2E, 0x2E, 0x56, 0x2D, 0x2D, 0x2E, 0x24, 0x2D, 0x2E, 0x2E, 0x2D, 
-    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x78, 0x53, 0x53, 0x74, 
-    0x4E, 0x53, 0x53, 0x4D, 0x74, 0x4E, 0x4E, 0x74, 0x4E, 0x4E, 0x53, 0x4A, 
-    0x4A, 0x4A, 0x4E, 0x77, 0x4E, 0x53, 0x4D, 0x4A, 0x2E, 0x32, 0x4E, 0x78, 
-    0x78, 0x2E, 0x78, 0x98, 0x4D, 0x73, 0x32, 0x53, 0x32, 0x2E, 0x50, 0xA6, 
-    0x53, 0x77, 0x4A, 0x2E, 0x4A, 0x4A, 0x89, 0xB6, 0x4A, 0x77, 0x4A, 0x4A, 
-    0x4A, 0x4D, 0xA6, 0xA6, 0x68, 0x91, 0x68, 0x68, 0x68, 0x76, 0x98, 0x7B, 
-    0x2D, 0x68, 0x98, 0x89, 0x91, 0x9F, 0x74, 0x32, 0x77, 0x89, 0x98, 0x89, 
-    0x68, 0x77, 0x32, 0x32, 0xB6, 0x98, 0x7B, 0x91, 0x73, 0x78, 0x53, 0x53, 
-    0xA6, 0xA8, 0x7B, 0x75, 0x78, 0x53, 0x2E, 0x56, 0xA4, 0x8C, 0x76, 0x78, 
-    0x74, 0x53, 0x56, 0x56, 0xA4, 0x8C, 0x77, 0x50, 0x32, 0x4A, 0x56, 0x56, 
-    0xA8, 0x76, 0x77, 0x78, 0x32, 0x2E, 0x56, 0x56, 0x96, 0x77, 0x32, 0x4D, 
-    0x4A, 0x56, 0x56, 0x56, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4D, 0x32, 0x53, 
-    0x53, 0x32, 0x53, 0x53, 0x78, 0x74, 0x4D, 0x56, 0x53, 0x53, 0x53, 0x32, 
-    0x32, 0x53, 0x24, 0x0F, 0x56, 0x56, 0x56, 0x56, 0x24, 0x24, 0x0F, 0x0E, 
-    0x24, 0x24, 0x24, 0x0F, 0x0F, 0x24, 0x24, 0x34, 0x24, 0x56, 0x24, 0x0E, 
-    0x0E, 0x56, 0x4A, 0x24, 0x24, 0x56, 0x24, 0x0E, 0x0F, 0x56, 0x4A, 0x2E, 
-    0x56, 0x4A, 0x2E, 0x0F, 0x0E, 0x56, 0x4A, 0x2E, 0x0F, 0x0F, 0x0F, 0x53, 
-    0x4E, 0x32, 0x32, 0x4A, 0x0F, 0x0F, 0x2E, 0x53, 0x53, 0x4E, 0x4A, 0x2E, 
-    0x0F, 0x2E, 0x53, 0x53, 0x53, 0x32, 0x4A, 0x2E, 0x0F, 0x53, 0x32, 0x53, 
-    0x4D, 0x53, 0x53, 0x2E, 0x0F, 0x2E, 0x2E, 0x53, 0x53, 0x4A, 0x2E, 0x2D, 
-    0x0F, 0x0F, 0x2E, 0x53, 0x53, 0x4A, 0x2D, 0x3A, 0x0F, 0x0F, 0x0F, 0x2E, 
-    0x2E, 0x56, 0x1E, 0xD8, 0x0F, 0x34, 0x0F, 0x0F, 0x0F, 0x24, 0x1E, 0xD8, 
-    0x2E, 0x56, 0x1E, 0x6B, 0x97, 0x9C, 0x9C, 0x5E, 0x2E, 0x56, 0x5B, 0xD2, 
-    0x97, 0x9A, 0xE3, 0xC9, 0x4A, 0x2D, 0x5A, 0xC1, 0xD2, 0xE2, 0x6D, 0xC2, 
-    0x2E, 0x31, 0x80, 0x71, 0x1B, 0x44, 0x5F, 0xC8, 0x31, 0xD3, 0xED, 0xE8, 
-    0x44, 0x26, 0x95, 0x70, 0xDF, 0xF5, 0xF5, 0xEE, 0xD2, 0x44, 0xE2, 0x70, 
-    0xDB, 0xF5, 0xDB, 0xF2, 0xC8, 0x8F, 0x57, 0x58, 0xDB, 0xDA, 0xDB, 0xDA, 
-    0xE9, 0x58, 0x44, 0x44, 0x5F, 0x9D, 0x7D, 0x9A, 0x9A, 0x7F, 0x6A, 0x35, 
-    0xE9, 0xC1, 0x97, 0x9A, 0x9A, 0x7F, 0x59, 0x35, 0xE9, 0xC1, 0xBF, 0x9C, 
-    0x9A, 0x44, 0x35, 0x47, 0xC1, 0x9D, 0x9C, 0x9C, 0x9A, 0x6F, 0x43, 0x43, 
-    0x9C, 0x9A, 0x9B, 0x7F, 0x7F, 0x7E, 0x3F, 0x3E, 0x85, 0xDE, 0x7E, 0x44, 
-    0x1B, 0x38, 0x19, 0x1B, 0x57, 0x44, 0x61, 0x17, 0x17, 0x17, 0x35, 0x1B, 
-    0x38, 0x8F, 0x58, 0x57, 0x8F, 0x8F, 0x6F, 0x1B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x26, 0x43, 0x37, 0x60, 0x6A, 
-    0x01, 0x0C, 0x16, 0x21, 0x26, 0x43, 0x57, 0x57, 0x18, 0x0C, 0x0F, 0x1A, 
-    0x17, 0x35, 0x17, 0x13, 0x18, 0x0C, 0x10, 0x22, 0x42, 0x87, 0x35, 0x3B, 
-    0x01, 0x01, 0x01, 0x0C, 0x0E, 0x1F, 0x0E, 0x0F, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x0E, 0x0F, 0x0E, 0x01, 0x01, 0x0C, 0x1A, 0x10, 0x26, 0x35, 0x1F, 
-    0x01, 0x0B, 0x0E, 0x41, 0x26, 0x42, 0x42, 0x1F, 0x7F, 0x65, 0x9D, 0xBF, 
-    0xC1, 0x23, 0x4D, 0x0F, 0x7E, 0x5F, 0x7D, 0xBF, 0xC1, 0x10, 0x4D, 0x0F, 
-    0x3B, 0x1B, 0x37, 0x90, 0xC1, 0x10, 0x4E, 0x0F, 0x42, 0x37, 0x35, 0x64, 
-    0xC1, 0x10, 0x4E, 0x24, 0x3F, 0x60, 0x44, 0x58, 0x58, 0x0F, 0x4D, 0x2E, 
-    0x3B, 0x35, 0x6A, 0xE2, 0x90, 0x21, 0x2D, 0x10, 0x17, 0x37, 0x82, 0x9D, 
-    0x70, 0x45, 0x1E, 0x56, 0x46, 0x65, 0x9B, 0x9D, 0x70, 0x45, 0x1E, 0x24, 
-    0x0E, 0x0E, 0x0F, 0x23, 0x10, 0x1F, 0x30, 0x1A, 0x0E, 0x0C, 0x0E, 0x62, 
-    0x1A, 0x1F, 0x1A, 0x1A, 0x0E, 0x0C, 0x0E, 0x34, 0x1A, 0x1F, 0x1A, 0x1A, 
-    0x0E, 0x0E, 0x0E, 0x34, 0x0F, 0x0E, 0x17, 0x23, 0x0F, 0x0E, 0x0E, 0x34, 
-    0x34, 0x1A, 0x17, 0x17, 0x0F, 0x0F, 0x19, 0x13, 0x1F, 0x1A, 0x17, 0x1A, 
-    0x2E, 0x0F, 0x22, 0x5D, 0x36, 0x25, 0x1A, 0x1A, 0x2E, 0x0E, 0x22, 0x82, 
-    0x46, 0x1E, 0x1A, 0x1A, 0x1A, 0x1F, 0x1F, 0x1A, 0x19, 0x47, 0x3F, 0x6A, 
-    0x1A, 0x1A, 0x1A, 0x17, 0x35, 0x47, 0x60, 0x83, 0x1A, 0x0F, 0x62, 0x47, 
-    0x41, 0x37, 0x60, 0x83, 0x1A, 0x34, 0x23, 0x62, 0x42, 0x3F, 0x3E, 0x44, 
-    0x1A, 0x23, 0x23, 0x23, 0x47, 0x43, 0x3F, 0x6F, 0x17, 0x62, 0x51, 0x47, 
-    0x19, 0x37, 0x82, 0x70, 0x17, 0x19, 0x62, 0x3D, 0x19, 0x57, 0x5F, 0xCA, 
-    0x1A, 0x1A, 0x17, 0x17, 0x17, 0x60, 0x64, 0xCA, 0x7E, 0x9A, 0x7F, 0x9D, 
-    0xC1, 0x90, 0x87, 0x56, 0x7F, 0x9B, 0x9A, 0x9A, 0xBF, 0xCA, 0xE9, 0x10, 
-    0x83, 0x7E, 0x7F, 0x9B, 0xC1, 0xCA, 0xE9, 0x10, 0x8F, 0x8F, 0x8F, 0x84, 
-    0xBF, 0xC2, 0xE9, 0x10, 0x70, 0xC9, 0xD2, 0x86, 0xDC, 0x6E, 0xEE, 0x16, 
-    0xEB, 0xF5, 0xED, 0xEE, 0x84, 0x5A, 0xD9, 0xC6, 0xEB, 0xDA, 0xDA, 0xF5, 
-    0x64, 0x6E, 0xEF, 0xDB, 0xEB, 0xDB, 0xDB, 0xDA, 0xC9, 0x6E, 0xEB, 0xDA, 
-    0x56, 0x2E, 0x4A, 0x4A, 0x4A, 0x4A, 0x72, 0x75, 0x4A, 0x2E, 0x4A, 0x4A, 
-    0x4A, 0x4A, 0x72, 0x75, 0x2D, 0x2E, 0x2E, 0x2E, 0x4A, 0x2E, 0x72, 0x75, 
-    0x2D, 0x56, 0x56, 0x2E, 0x4A, 0x2E, 0x72, 0x75, 0x0E, 0x56, 0x2E, 0x2E, 
-    0x2E, 0x2E, 0x72, 0x75, 0xE0, 0x1E, 0x2E, 0x2E, 0x2E, 0x4A, 0x74, 0x75, 
-    0xF1, 0x1E, 0x2E, 0x2E, 0x4A, 0x2E, 0x78, 0x73, 0xEA, 0x25, 0x2E, 0x2E, 
-    0x4A, 0x56, 0x72, 0x75, 0x2E, 0x2E, 0x4E, 0x53, 0x4A, 0x74, 0x74, 0x2E, 
-    0x2E, 0x2E, 0x53, 0x4A, 0x2E, 0x74, 0x74, 0x2E, 0x2E, 0x56, 0x53, 0x2E, 
-    0x56, 0x50, 0x50, 0x4A, 0x2E, 0x56, 0x4D, 0x4A, 0x4A, 0x78, 0x74, 0x4A, 
-    0x2E, 0x2E, 0x4A, 0x2E, 0x4A, 0x32, 0x32, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x4A, 0x4E, 0x4A, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x32, 0x4D, 
-    0x4A, 0x2E, 0x2E, 0x2E, 0x4A, 0x4A, 0x32, 0x4E, 0x78, 0x76, 0x32, 0x67, 
-    0x53, 0x4D, 0x53, 0x4D, 0x32, 0x67, 0x4D, 0x4D, 0x74, 0x78, 0x53, 0x53, 
-    0x4A, 0x4E, 0x53, 0x4A, 0x77, 0x77, 0x53, 0x53, 0x4A, 0x4D, 0x32, 0x53, 
-    0x4E, 0x50, 0x53, 0x4E, 0x4A, 0x4D, 0x32, 0x32, 0x4D, 0x73, 0x74, 0x4D, 
-    0x4A, 0x4A, 0x4D, 0x32, 0x4E, 0x74, 0x32, 0x53, 0x4A, 0x4A, 0x4A, 0x4D, 
-    0x4D, 0x4D, 0x53, 0x53, 0x78, 0x4E, 0x4A, 0x53, 0x53, 0x4A, 0x4A, 0x4A, 
-    0x4D, 0x53, 0x53, 0x53, 0x74, 0x77, 0x52, 0x52, 0x4D, 0x4D, 0x53, 0x53, 
-    0x4E, 0x74, 0x77, 0x77, 0x4D, 0x4D, 0x53, 0x53, 0x53, 0x74, 0x74, 0x77, 
-    0x4D, 0x53, 0x4D, 0x53, 0x53, 0x74, 0x52, 0x68, 0x53, 0x53, 0x4D, 0x4E, 
-    0x4E, 0x50, 0xCC, 0x79, 0x53, 0x53, 0x53, 0x53, 0x4D, 0x67, 0x67, 0x50, 
-    0x53, 0x53, 0x53, 0x53, 0x4A, 0x73, 0x75, 0x50, 0x4A, 0x53, 0x4D, 0x4E, 
-    0x75, 0x9F, 0x78, 0x4E, 0x52, 0x9F, 0x9F, 0x77, 0x9F, 0xA7, 0xAE, 0xA8, 
-    0x52, 0x52, 0x32, 0x76, 0xAE, 0xA7, 0xA0, 0xCC, 0x72, 0x73, 0x89, 0x96, 
-    0x7B, 0xA7, 0x98, 0x4E, 0x91, 0x68, 0xA2, 0x91, 0x52, 0xB7, 0x98, 0x50, 
-    0x8E, 0xAD, 0x72, 0x73, 0x9F, 0xA3, 0xA4, 0x50, 0x78, 0x72, 0x72, 0x9F, 
-    0x9F, 0xB7, 0x98, 0x50, 0x32, 0x4E, 0x78, 0xCC, 0x9E, 0xB7, 0x98, 0xCC, 
-    0x67, 0xF3, 0x33, 0x72, 0x9E, 0xB7, 0x98, 0x50, 0xBC, 0xA3, 0xAA, 0xB0, 
-    0xC6, 0xBE, 0xB9, 0xB1, 0xAE, 0xB8, 0xAA, 0xC5, 0xDB, 0xB4, 0xB1, 0xA6, 
-    0xA5, 0xB8, 0xB3, 0xC7, 0xDB, 0xBA, 0xAF, 0xA8, 0x98, 0xA5, 0xAA, 0xB3, 
-    0xC7, 0xAB, 0xB8, 0x9F, 0x9F, 0x94, 0xA7, 0xAC, 0xB2, 0xB8, 0xA3, 0x76, 
-    0x9F, 0x98, 0xB7, 0xAA, 0xB1, 0xB8, 0xA3, 0x98, 0x9F, 0x9F, 0xCC, 0xB6, 
-    0xB1, 0xB8, 0xB8, 0x91, 0x52, 0x52, 0x52, 0x76, 0x7B, 0x93, 0xA7, 0x77, 
-    0xA9, 0x7B, 0xAD, 0x9F, 0xA4, 0xB7, 0x9F, 0x9E, 0xA6, 0x7B, 0x9E, 0x9F, 
-    0xCD, 0xB9, 0x9F, 0x9F, 0x94, 0xAD, 0x9E, 0x9E, 0xD7, 0xCD, 0x9F, 0x75, 
-    0xCC, 0x75, 0x9E, 0x9E, 0x89, 0x88, 0x75, 0x9E, 0x91, 0x73, 0x9F, 0xAD, 
-    0xC4, 0xDF, 0x9F, 0x9E, 0xBC, 0x9F, 0x9F, 0x9F, 0xF1, 0xF7, 0x9F, 0x9E, 
-    0x91, 0x9F, 0x9E, 0xCC, 0x92, 0xF4, 0x3C, 0x9E, 0x72, 0x73, 0x9F, 0xCC, 
-    0x92, 0xF4, 0x9F, 0x9E, 0x9E, 0x98, 0xA2, 0x9F, 0x75, 0x9E, 0x72, 0x0F, 
-    0x9E, 0x89, 0x7B, 0x75, 0x9E, 0x76, 0x3D, 0x30, 0x76, 0x9F, 0x9F, 0x75, 
-    0x9E, 0x68, 0xE0, 0x38, 0x9E, 0x76, 0x75, 0x9E, 0x76, 0x3A, 0x87, 0x44, 
-    0x76, 0x76, 0x76, 0x9F, 0x68, 0xD3, 0x95, 0x44, 0x76, 0x75, 0x75, 0x76, 
-    0xD7, 0xD0, 0x6C, 0x1B, 0x76, 0x75, 0x9E, 0x8C, 0xD1, 0x65, 0x7F, 0x1B, 
-    0x76, 0x76, 0x9E, 0xD8, 0xD9, 0x65, 0x7F, 0x44, 0x71, 0x86, 0x61, 0x86, 
-    0xE4, 0xED, 0x80, 0x45, 0x86, 0x64, 0xDC, 0x6E, 0xE4, 0xE4, 0x6E, 0x90, 
-    0x86, 0x6D, 0xDE, 0xC0, 0xE4, 0xEE, 0xD2, 0xBF, 0x71, 0x9D, 0x6D, 0xE4, 
-    0xEC, 0xC9, 0x86, 0xC1, 0x71, 0xC1, 0xC0, 0xE5, 0xEE, 0x6E, 0xD2, 0xE9, 
-    0x71, 0xC1, 0xC0, 0xE5, 0xC0, 0x6E, 0xEE, 0x6E, 0x71, 0xC1, 0x6E, 0xC0, 
-    0x9D, 0xE9, 0xEB, 0xE3, 0x5A, 0x97, 0xE2, 0xE2, 0xC0, 0xE5, 0xEC, 0xE3, 
-    0x86, 0x9C, 0x5B, 0xAD, 0xAD, 0x94, 0xB8, 0x93, 0xC2, 0x84, 0xE0, 0xCD, 
-    0x8C, 0x94, 0xA9, 0xB8, 0xD2, 0x57, 0x80, 0xE7, 0x88, 0x94, 0xA9, 0xB8, 
-    0xD2, 0x5A, 0xE2, 0x90, 0xD8, 0x94, 0xA9, 0xB8, 0xCB, 0x58, 0x6C, 0xE3, 
-    0x95, 0xD7, 0xB8, 0xA7, 0x85, 0x5E, 0x7D, 0x9B, 0x9C, 0xEA, 0xB8, 0x93, 
-    0xDD, 0x9A, 0x9B, 0xE3, 0xC8, 0xD4, 0xA9, 0x93, 0x9A, 0xE3, 0x9B, 0x9B, 
-    0xCA, 0x28, 0xB7, 0x93, 0xA4, 0x76, 0x76, 0xAD, 0x7B, 0xA7, 0xAE, 0xAD, 
-    0xA4, 0xAD, 0x76, 0x76, 0x7B, 0xA7, 0xAE, 0xAD, 0xA4, 0x76, 0x91, 0x96, 
-    0x7B, 0xB7, 0xAE, 0x76, 0xA4, 0x75, 0x76, 0x96, 0x7B, 0xA7, 0xAE, 0x76, 
-    0xA4, 0x76, 0x76, 0x96, 0x94, 0xA7, 0xA5, 0x76, 0xA4, 0xAD, 0x76, 0x96, 
-    0x7B, 0xA7, 0xA5, 0x68, 0xA4, 0x9E, 0x76, 0xAD, 0x8C, 0xA9, 0xA5, 0xD8, 
-    0xA4, 0x9E, 0x76, 0xAD, 0x94, 0xA9, 0xA5, 0xD8, 0x76, 0xAD, 0x77, 0xC8, 
-    0xCA, 0x6B, 0x61, 0xC2, 0xAD, 0xD7, 0xF0, 0x5A, 0x6E, 0xEE, 0x5A, 0xCB, 
-    0x96, 0xCE, 0xD0, 0x57, 0x80, 0xEE, 0x84, 0xEE, 0x91, 0x8A, 0x87, 0x42, 
-    0x87, 0xEE, 0x86, 0x6E, 0xE0, 0x90, 0x6D, 0x46, 0x71, 0xEB, 0xEF, 0x6D, 
-    0x80, 0x6D, 0x9C, 0x5F, 0x85, 0x64, 0xE9, 0xC8, 0xE9, 0x6D, 0x6D, 0x70, 
-    0x5F, 0xDE, 0xE9, 0xE5, 0xEB, 0x9D, 0x9C, 0x6D, 0xE3, 0xDD, 0xC2, 0xE5, 
-    0xE5, 0x70, 0x6F, 0x45, 0x7D, 0x61, 0x13, 0x47, 0xE6, 0xC2, 0x85, 0x6F, 
-    0x7D, 0x61, 0x21, 0x3D, 0xE5, 0xE4, 0x6E, 0x83, 0x90, 0x61, 0x3F, 0x54, 
-    0xE4, 0xE5, 0xC8, 0xE3, 0x7D, 0x1B, 0x5A, 0xD0, 0xC0, 0xE5, 0xE4, 0x6D, 
-    0x7D, 0x44, 0x58, 0xD0, 0x6D, 0xCB, 0xEC, 0x6E, 0x97, 0x44, 0x46, 0x80, 
-    0xBF, 0x6D, 0xD2, 0x5F, 0x97, 0x44, 0x60, 0xE2, 0xE4, 0x6E, 0xE2, 0xDD, 
-    0x90, 0x44, 0x60, 0x9A, 0x96, 0xB8, 0xA2, 0x9E, 0x9E, 0x98, 0xA0, 0x7B, 
-    0x96, 0xA3, 0xA2, 0x9E, 0x9E, 0xA8, 0x8E, 0x7B, 0x96, 0xA3, 0xA8, 0x9E, 
-    0x76, 0xAD, 0x9E, 0x7B, 0xD7, 0xB5, 0xA8, 0x9E, 0x76, 0xAD, 0x9E, 0x7B, 
-    0xD7, 0xA5, 0xA8, 0x9E, 0xAD, 0xAD, 0xAD, 0x7B, 0xD1, 0xAF, 0x94, 0x9F, 
-    0x76, 0xAD, 0xAD, 0x7B, 0xD2, 0xBD, 0x94, 0x9F, 0x76, 0xAD, 0x9E, 0x7B, 
-    0x9D, 0xB2, 0xA8, 0x9F, 0x76, 0xAD, 0xAD, 0x7B, 0xAF, 0xE0, 0x3D, 0x9E, 
-    0x9E, 0x9E, 0x9F, 0xA0, 0x93, 0x7B, 0x9F, 0x9E, 0x75, 0x9E, 0x9F, 0xA0, 
-    0x93, 0x7B, 0x9F, 0x9E, 0x75, 0x9E, 0x9F, 0x98, 0x93, 0x7B, 0x9F, 0x9E, 
-    0x75, 0x9F, 0x9F, 0x98, 0xA7, 0x89, 0x9F, 0x9E, 0x75, 0x9E, 0x9E, 0xA0, 
-    0x93, 0x89, 0x52, 0x75, 0x9E, 0x9E, 0x9F, 0xA0, 0x93, 0x7B, 0x9F, 0x75, 
-    0x75, 0x9E, 0x9F, 0x98, 0xA7, 0x89, 0x9F, 0x9E, 0x75, 0x9E, 0x9F, 0x98, 
-    0xA0, 0x50, 0xEA, 0xF4, 0xA0, 0x8D, 0xAE, 0xAE, 0xA0, 0x4E, 0xF1, 0xEF, 
-    0x9F, 0x9F, 0x73, 0x9F, 0xAE, 0x76, 0xF1, 0xD4, 0x9F, 0x72, 0x72, 0x68, 
-    0xBC, 0x8C, 0xF1, 0xD4, 0xA4, 0x8D, 0x8D, 0xAE, 0xAE, 0xCC, 0xEA, 0xD4, 
-    0xA8, 0x94, 0x7B, 0x96, 0xAE, 0xCC, 0xF1, 0xF4, 0xA8, 0xAD, 0x4A, 0x4D, 
-    0xAE, 0x76, 0xD3, 0xF4, 0xA8, 0xAD, 0x4D, 0x4E, 0xAE, 0xAD, 0xD3, 0xF5, 
-    0xA8, 0x96, 0x4D, 0x50, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 
-    0x52, 0x73, 0x9F, 0x52, 0x73, 0x9F, 0x52, 0x72, 0x79, 0x50, 0x75, 0x68, 
-    0x72, 0x9F, 0x9F, 0x72, 0xA5, 0xA0, 0xAE, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 
-    0x96, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x96, 0x4D, 0x4A, 0x4A, 0x4A, 
-    0x4A, 0x4A, 0x4A, 0x4A, 0x32, 0x72, 0x76, 0x76, 0x91, 0x96, 0x96, 0x91, 
-    0x4E, 0x76, 0xA0, 0xA2, 0x8E, 0x98, 0xA0, 0xA2, 0xAE, 0xAE, 0xAE, 0xA0, 
-    0xAE, 0xA0, 0xA0, 0xA0, 0x72, 0x52, 0x52, 0x72, 0x72, 0x72, 0xCC, 0x72, 
-    0x68, 0x73, 0x72, 0x91, 0x9F, 0x4E, 0x76, 0x75, 0xAE, 0x8D, 0x8D, 0xAE, 
-    0x8D, 0x8D, 0x8D, 0x8D, 0x76, 0x91, 0x91, 0x91, 0x91, 0x91, 0x68, 0x68, 
-    0x4A, 0x4D, 0x4D, 0x4A, 0x2D, 0x4A, 0x4A, 0x4A, 0x68, 0x72, 0x4E, 0x72, 
-    0x89, 0x89, 0x89, 0x76, 0xA0, 0x68, 0x4A, 0x72, 0x8C, 0xA2, 0x98, 0x8C, 
-    0x8D, 0xAE, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x72, 0x72, 0x72, 0x72, 
-    0x72, 0x72, 0x72, 0x74, 0x4E, 0x72, 0x75, 0x72, 0x72, 0x73, 0x72, 0x72, 
-    0xA0, 0xA0, 0xAE, 0x8D, 0x8D, 0xA5, 0x8D, 0xA2, 0x91, 0x91, 0x96, 0x68, 
-    0x76, 0x76, 0x76, 0x76, 0x4D, 0x4A, 0x2D, 0x2E, 0x2D, 0x2D, 0x2D, 0x2E, 
-    0x50, 0x4D, 0x4A, 0x4D, 0x73, 0x68, 0x75, 0x32, 0x50, 0x4A, 0x4A, 0x4E, 
-    0x68, 0x89, 0x79, 0x72, 0xA0, 0xA0, 0x8C, 0x8C, 0x8C, 0x94, 0xA8, 0x96, 
-    0x72, 0x72, 0x72, 0x4A, 0x4E, 0x50, 0x52, 0x75, 0x72, 0x9F, 0x50, 0x2E, 
-    0x4E, 0x4E, 0x4D, 0x73, 0xA2, 0xA2, 0x72, 0x4A, 0x4E, 0x53, 0x4A, 0x73, 
-    0x76, 0x9E, 0x50, 0x4A, 0x50, 0x4E, 0x4D, 0x75, 0x4A, 0x4A, 0x4A, 0x4A, 
-    0x53, 0x4A, 0x4A, 0x77, 0x4A, 0x4D, 0x4E, 0x4D, 0x4A, 0x56, 0x56, 0x4A, 
-    0x4A, 0x4D, 0x32, 0x4E, 0x2E, 0x56, 0x56, 0x4A, 0x73, 0x74, 0x4E, 0x4A, 
-    0x2E, 0x56, 0x56, 0x24, 0x32, 0x53, 0x4A, 0x2E, 0x4A, 0x4A, 0x56, 0x24, 
-    0x53, 0x4A, 0x53, 0x4E, 0x50, 0x53, 0x2E, 0x56, 0x32, 0x4D, 0x74, 0x75, 
-    0x75, 0x74, 0x2E, 0x0F, 0x32, 0x4A, 0x74, 0x67, 0x73, 0x32, 0x24, 0x0F, 
-    0x4E, 0x4A, 0x4A, 0x4A, 0x4A, 0x2E, 0x24, 0x56, 0x32, 0x53, 0x2E, 0x2E, 
-    0x2E, 0x56, 0x24, 0x2E, 0x32, 0x32, 0x4A, 0x2E, 0x2E, 0x56, 0x56, 0x4A, 
-    0x4A, 0x74, 0x53, 0x0F, 0x0F, 0x2E, 0x53, 0x4A, 0x4A, 0x52, 0x32, 0x24, 
-    0x0F, 0x0F, 0x2E, 0x53, 0x2E, 0x74, 0x53, 0x24, 0x0F, 0x0F, 0x0F, 0x2E, 
-    0x24, 0x2E, 0x56, 0x0F, 0x0E, 0x0F, 0x0F, 0x56, 0x0F, 0x56, 0x0F, 0x0F, 
-    0x0F, 0x0F, 0x24, 0x0F, 0x2E, 0x2E, 0x56, 0x0F, 0x24, 0x24, 0x56, 0x56, 
-    0x4A, 0x2E, 0x56, 0x24, 0x2E, 0x4A, 0x53, 0x53, 0x2E, 0x56, 0x24, 0x2D, 
-    0x32, 0x74, 0x32, 0x32, 0x56, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1E, 0xD8, 
-    0x4A, 0x2E, 0x56, 0x24, 0x0F, 0x0F, 0x1E, 0x3A, 0x4A, 0x2E, 0x2E, 0x56, 
-    0x0F, 0x0F, 0x1E, 0x3A, 0x2E, 0x56, 0x0F, 0x0F, 0x0F, 0x0E, 0x04, 0xD5, 
-    0x56, 0x0F, 0x0E, 0x0F, 0x0F, 0x01, 0xEA, 0xE9, 0x0F, 0x0E, 0x0F, 0x0F, 
-    0x0E, 0x24, 0x21, 0x66, 0x0F, 0x0E, 0x0F, 0x0F, 0x0F, 0x1E, 0x31, 0x70, 
-    0x24, 0x0E, 0x0F, 0x0E, 0x24, 0x25, 0x21, 0x6C, 0xDB, 0xDA, 0xDB, 0xDA, 
-    0xE9, 0x86, 0x58, 0x6A, 0xDB, 0xF5, 0xF5, 0xF2, 0xC2, 0x86, 0x58, 0x66, 
-    0xDB, 0xF5, 0xE5, 0xE4, 0x70, 0x5A, 0x21, 0xD5, 0xF5, 0xED, 0xE4, 0xC8, 
-    0x97, 0x58, 0x31, 0xDB, 0xE7, 0xEE, 0xC8, 0x9D, 0xDD, 0x58, 0x31, 0xF7, 
-    0x58, 0x5F, 0x6E, 0x71, 0x44, 0x1B, 0x62, 0xF4, 0x97, 0x84, 0x8F, 0x37, 
-    0x1A, 0x16, 0x21, 0xF5, 0x5A, 0x38, 0x26, 0x95, 0x46, 0x5C, 0xE2, 0x81, 
-    0x61, 0x71, 0xC2, 0xC8, 0x9C, 0x65, 0x60, 0x19, 0x80, 0xE7, 0xED, 0xE4, 
-    0x70, 0x7D, 0x5E, 0x58, 0xDA, 0xF2, 0xF2, 0xEC, 0xC8, 0x9C, 0x9D, 0x7F, 
-    0xDB, 0xF5, 0xED, 0xEB, 0xC8, 0x5F, 0x5E, 0x84, 0xDA, 0xF2, 0xED, 0xEF, 
-    0xC9, 0xE2, 0x59, 0x59, 0xED, 0xF2, 0xF2, 0xE9, 0x90, 0x59, 0x64, 0x95, 
-    0xED, 0xF2, 0xE9, 0x9D, 0xDC, 0x43, 0x5C, 0xE0, 0xD3, 0xE9, 0xBF, 0x7D, 
-    0x58, 0x8F, 0x3F, 0x59, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0C, 0x16, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x19, 
-    0x01, 0x18, 0x0E, 0x16, 0x1B, 0x43, 0x42, 0x0E, 0x0B, 0x0C, 0x0F, 0x20, 
-    0x17, 0x25, 0x34, 0x25, 0x0C, 0x0C, 0x0F, 0x26, 0x35, 0x1A, 0x17, 0x17, 
-    0x18, 0x26, 0x35, 0x1B, 0x60, 0x60, 0x60, 0x3F, 0x0B, 0x38, 0x26, 0x3E, 
-    0x60, 0x60, 0x60, 0x59, 0x0C, 0x19, 0x34, 0x1B, 0x3F, 0x60, 0x60, 0x7E, 
-    0x16, 0x26, 0x35, 0x26, 0x13, 0x13, 0x3E, 0x59, 0x36, 0x3E, 0x3E, 0x5D, 
-    0x26, 0x1B, 0x59, 0x7E, 0x58, 0x9B, 0x9C, 0x9D, 0x70, 0x45, 0x01, 0x0F, 
-    0x45, 0x58, 0x58, 0x5F, 0xC1, 0x45, 0x01, 0x23, 0x35, 0x57, 0x57, 0x64, 
-    0xC1, 0x45, 0x1E, 0x17, 0x44, 0x7E, 0x7E, 0x5E, 0xC1, 0x45, 0x01, 0x19, 
-    0x58, 0x58, 0x5A, 0x85, 0xC1, 0x21, 0x01, 0x26, 0x7D, 0xBF, 0xC8, 0xC8, 
-    0xC8, 0x21, 0x1E, 0x36, 0x9B, 0x9D, 0xC8, 0xC0, 0x80, 0x18, 0x1E, 0x22, 
-    0x9C, 0x9D, 0xC8, 0x80, 0x01, 0x01, 0x0E, 0x3B, 0x0F, 0x25, 0x34, 0x59, 
-    0x46, 0x1E, 0x1F, 0x30, 0x20, 0x25, 0x2E, 0x5D, 0x46, 0x0B, 0x1F, 0x30, 
-    0x19, 0x25, 0x1A, 0x59, 0x46, 0x0B, 0x0E, 0x1F, 0x35, 0x0F, 0x60, 0x82, 
-    0x36, 0x1E, 0x1F, 0x30, 0x37, 0x21, 0x60, 0x57, 0x1F, 0x25, 0x1F, 0x30, 
-    0x5C, 0x10, 0x19, 0x42, 0x1F, 0x0E, 0x1F, 0x1F, 0x42, 0x13, 0x19, 0x5C, 
-    0x1A, 0x0C, 0x1F, 0x1F, 0x36, 0x59, 0x3E, 0x3F, 0x30, 0x0E, 0x0F, 0x0F, 
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x6F, 0x5E, 0xC2, 0x30, 0x30, 0x30, 0x30, 
-    0x30, 0x6F, 0x5E, 0x70, 0x30, 0x30, 0x30, 0x30, 0x1A, 0x17, 0x16, 0x40, 
-    0x30, 0x30, 0x30, 0x30, 0x17, 0x17, 0x17, 0x37, 0x30, 0x30, 0x1A, 0x23, 
-    0x22, 0x5C, 0x3F, 0x5C, 0x1A, 0x13, 0x23, 0x62, 0x51, 0x19, 0x17, 0x10, 
-    0x62, 0x74, 0x32, 0x23, 0x13, 0x3B, 0x34, 0x0E, 0x62, 0x23, 0x34, 0x0E, 
-    0x1A, 0x1A, 0x13, 0x13, 0xEC, 0xF5, 0xF2, 0xEF, 0x81, 0x80, 0xEF, 0xDB, 
-    0xC0, 0xCA, 0xED, 0x81, 0x66, 0x90, 0x95, 0x95, 0x58, 0x5A, 0x71, 0x66, 
-    0x71, 0x90, 0x6C, 0x8F, 0x46, 0x37, 0x1B, 0x26, 0x47, 0x47, 0x69, 0x3E, 
-    0x19, 0x34, 0x13, 0x2E, 0x51, 0x47, 0x47, 0x41, 0x23, 0x51, 0x51, 0x62, 
-    0x51, 0x51, 0x47, 0x41, 0x23, 0x51, 0x62, 0x47, 0x13, 0x13, 0x51, 0x47, 
-    0x10, 0x23, 0x23, 0x62, 0x13, 0x23, 0x47, 0x47, 0xEA, 0x25, 0x2E, 0x2E, 
-    0x4A, 0x4D, 0x50, 0x32, 0x6B, 0x2D, 0x4A, 0x2E, 0x4A, 0x74, 0x53, 0x4A, 
-    0x1B, 0x2D, 0x56, 0x56, 0x4A, 0x32, 0x32, 0x4A, 0x3E, 0x1B, 0x22, 0x21, 
-    0x56, 0x4A, 0x4D, 0x4A, 0x3F, 0x82, 0x7F, 0x60, 0x23, 0x56, 0x4A, 0x4A, 
-    0x43, 0x7F, 0x7F, 0x82, 0x64, 0x71, 0x10, 0x4A, 0x47, 0x3E, 0x6A, 0x5D, 
-    0x65, 0x5E, 0x5C, 0x23, 0x41, 0x43, 0x60, 0x7E, 0x5E, 0x5F, 0x97, 0x5A, 
-    0x2E, 0x2E, 0x4A, 0x53, 0x4A, 0x2E, 0x4A, 0x50, 0x4A, 0x2E, 0x4A, 0x32, 
-    0x4E, 0x2E, 0x4A, 0x53, 0x2E, 0x2E, 0x4A, 0x32, 0x32, 0x56, 0x56, 0x2E, 
-    0x2E, 0x2E, 0x4A, 0x4E, 0x4A, 0x24, 0x32, 0x73, 0x4A, 0x2E, 0x4D, 0x68, 
-    0x79, 0x68, 0x89, 0x89, 0x4D, 0x4D, 0x78, 0x68, 0x91, 0x96, 0x96, 0x76, 
-    0x4A, 0x74, 0x73, 0x50, 0x50, 0x50, 0x4E, 0x53, 0x34, 0x53, 0x4E, 0x51, 
-    0x53, 0x4E, 0x53, 0x4A, 0x77, 0x53, 0x4A, 0x53, 0x4A, 0x4A, 0x4A, 0x2E, 
-    0x78, 0x53, 0x4A, 0x53, 0x78, 0x79, 0x89, 0x89, 0x53, 0x50, 0x75, 0x91, 
-    0xA0, 0x8D, 0xA2, 0x8C, 0x4A, 0x4E, 0x68, 0x68, 0x91, 0x8C, 0x8D, 0xA2, 
-    0x4E, 0x4D, 0x4A, 0x4A, 0x4A, 0x51, 0x32, 0x51, 0x4E, 0x4E, 0x4E, 0x4A, 
-    0x4D, 0x4A, 0x4A, 0x4A, 0x4A, 0x50, 0x50, 0x4A, 0x4A, 0x52, 0x76, 0x91, 
-    0x2E, 0x4D, 0x4D, 0x4A, 0x4A, 0x89, 0x94, 0x94, 0x4A, 0x73, 0x7B, 0x7B, 
-    0xA0, 0x91, 0x50, 0x4D, 0x89, 0xA2, 0x8D, 0xA2, 0x75, 0x50, 0x78, 0x4E, 
-    0x89, 0x91, 0x91, 0xAD, 0x72, 0x50, 0x50, 0x4D, 0x89, 0x8C, 0x8D, 0x8D, 
-    0x8D, 0x8C, 0x50, 0x4D, 0x72, 0x75, 0xA2, 0x8D, 0x8D, 0xA2, 0x91, 0x91, 
-    0x51, 0x51, 0x50, 0x72, 0x51, 0x8C, 0x8D, 0x8D, 0x4E, 0x2D, 0x4E, 0x4E, 
-    0x4A, 0x72, 0x75, 0x75, 0x91, 0x91, 0x8C, 0x73, 0x2D, 0x51, 0x72, 0x4A, 
-    0x33, 0xF5, 0x3A, 0x50, 0x9E, 0xB7, 0xA2, 0x50, 0x33, 0xF5, 0x3A, 0xCC, 
-    0x9E, 0xB7, 0x98, 0x4E, 0x33, 0xF5, 0x3A, 0x50, 0x9E, 0xB7, 0x8E, 0x4E, 
-    0x33, 0xF5, 0x3A, 0x50, 0x9E, 0xB7, 0x8E, 0x50, 0x98, 0xC6, 0x33, 0x50, 
-    0x9E, 0xA7, 0x8E, 0x4A, 0xA3, 0x8C, 0x4E, 0x72, 0x9F, 0xB7, 0x98, 0x9F, 
-    0x91, 0x75, 0x50, 0xCC, 0x9F, 0xB7, 0x98, 0x9F, 0x51, 0x75, 0x72, 0xCC, 
-    0x9F, 0xB7, 0x98, 0x4A, 0x52, 0x52, 0x73, 0x78, 0x76, 0x93, 0xB8, 0x9F, 
-    0x52, 0x73, 0x73, 0x77, 0x9E, 0xB5, 0xB5, 0x9F, 0x73, 0x52, 0x73, 0x52, 
-    0x76, 0xA7, 0xB7, 0x52, 0x52, 0x52, 0x73, 0x72, 0x68, 0xBB, 0xBA, 0x9F, 
-    0x72, 0x52, 0x52, 0xCC, 0x68, 0xAB, 0xA3, 0x9F, 0x76, 0x9F, 0x52, 0x78, 
-    0x91, 0xB8, 0xB5, 0x73, 0x75, 0x72, 0x52, 0x78, 0x91, 0xA9, 0xA6, 0x77, 
-    0x50, 0x74, 0x52, 0xCC, 0x68, 0xBE, 0xBB, 0x77, 0x52, 0x73, 0x9F, 0xCC, 
-    0xF1, 0xF4, 0x9F, 0x75, 0x52, 0x9F, 0x9F, 0xCC, 0xF3, 0xEF, 0x9F, 0x9E, 
-    0x52, 0x9F, 0x9F, 0xCC, 0xF3, 0xD4, 0x8E, 0x89, 0x52, 0x9F, 0x9F, 0xCC, 
-    0xF3, 0xD4, 0xA0, 0xA8, 0x52, 0x73, 0x9F, 0xCC, 0xD3, 0xD4, 0xA4, 0x94, 
-    0x77, 0x73, 0x9F, 0xCC, 0xF3, 0xD4, 0xA0, 0x8C, 0x77, 0x73, 0x9F, 0xCC, 
-    0xF3, 0xD4, 0xA0, 0x89, 0x52, 0x73, 0x9F, 0xCC, 0xF3, 0xD4, 0xAE, 0xA2, 
-    0x75, 0xAD, 0x75, 0x95, 0x97, 0x7D, 0x5F, 0x6F, 0x76, 0xAD, 0x68, 0x90, 
-    0x9C, 0x7D, 0x7D, 0x5E, 0x9F, 0x9E, 0x68, 0xD2, 0x9C, 0x9C, 0x9C, 0x5E, 
-    0x9F, 0x9E, 0x68, 0xD2, 0x9C, 0x7D, 0x7D, 0x5E, 0x9F, 0x9E, 0x76, 0xD2, 
-    0xBF, 0x7D, 0x7D, 0x9C, 0x9F, 0x9E, 0x75, 0xD2, 0xC1, 0x9D, 0x9D, 0x9C, 
-    0x72, 0x9F, 0x9E, 0xD0, 0xBF, 0x9D, 0x7D, 0x7D, 0x91, 0x89, 0x89, 0xD0, 
-    0x97, 0x7D, 0x9C, 0x9C, 0x58, 0xE3, 0x6D, 0xC2, 0xEB, 0xE4, 0xCB, 0xE3, 
-    0x58, 0xE3, 0x6E, 0xEC, 0xE5, 0xCA, 0xE3, 0x65, 0x58, 0x9B, 0x6E, 0xE5, 
-    0xE5, 0xEE, 0x5F, 0x7D, 0x58, 0xE3, 0xBF, 0xEC, 0xE4, 0xBF, 0x6E, 0xC8, 
-    0xE2, 0xE3, 0x9D, 0xED, 0xC0, 0x9A, 0xC2, 0xE5, 0x85, 0xE3, 0x6D, 0xC0, 
-    0x6E, 0xD2, 0xE4, 0xE5, 0x85, 0x5F, 0x5F, 0xE3, 0x9D, 0xEB, 0xEC, 0xEC, 
-    0xE2, 0x5F, 0x6D, 0x6D, 0xC8, 0xEC, 0xEB, 0xEC, 0xE3, 0xCA, 0xC1, 0x9B, 
-    0xC8, 0xEB, 0xB7, 0xB8, 0x6E, 0xE4, 0xBF, 0x9B, 0xC8, 0xEC, 0xBD, 0xB8, 
-    0xC0, 0xE4, 0xC8, 0x5F, 0xC9, 0xE5, 0xC5, 0xA9, 0xE4, 0xE4, 0xE4, 0x90, 
-    0xC9, 0xE6, 0xC5, 0xA9, 0xE4, 0xC2, 0xEC, 0xE4, 0xEC, 0xE6, 0xC5, 0xA9, 
-    0xEB, 0xE9, 0xEC, 0xE5, 0xE5, 0xE5, 0xC5, 0xA9, 0xE5, 0xEC, 0xEC, 0xEC, 
-    0xEC, 0xEC, 0xC5, 0xA9, 0xE5, 0xEC, 0xEC, 0xEC, 0xEC, 0xD4, 0xB0, 0xAC, 
-    0xA4, 0x9E, 0x76, 0xAD, 0x94, 0xA9, 0xA6, 0xD8, 0xA4, 0x9E, 0x76, 0x96, 
-    0xA8, 0xA9, 0xAF, 0xF3, 0xA4, 0x76, 0x76, 0x7B, 0xA8, 0xA9, 0xB0, 0xF2, 
-    0xA4, 0xAD, 0x76, 0x96, 0xA8, 0xAA, 0xC5, 0xED, 0xA4, 0x76, 0x76, 0x96, 
-    0xA8, 0xA9, 0xB0, 0xED, 0xA4, 0x76, 0x76, 0x96, 0xA8, 0xAA, 0xB0, 0xED, 
-    0xA4, 0xAD, 0x96, 0x96, 0xA8, 0xAA, 0xB0, 0xED, 0xA4, 0xAD, 0x96, 0x96, 
-    0xA8, 0xAC, 0xB0, 0xD4, 0xEE, 0x9D, 0x9C, 0xC2, 0xCB, 0xDD, 0x6E, 0xEE, 
-    0xE4, 0x9D, 0x9D, 0xEB, 0xCB, 0xE3, 0x90, 0x6E, 0xEB, 0xC1, 0xC0, 0xE5, 
-    0xE4, 0xBF, 0xE3, 0xC0, 0xEB, 0xCB, 0xE4, 0xE5, 0xE4, 0xE4, 0xC8, 0x6E, 
-    0xEC, 0xEB, 0xEC, 0xEC, 0xE4, 0xE4, 0xEC, 0xBF, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0xE4, 0xEB, 0xEC, 0xCB, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEB, 0xEC, 0xEC, 
-    0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xE5, 0xEC, 0xE4, 0xBF, 0x9A, 
-    0x7E, 0x44, 0xE2, 0x9C, 0xE5, 0xE5, 0xC8, 0x9A, 0x83, 0x5A, 0x7D, 0x9D, 
-    0xED, 0xE5, 0xC8, 0x9A, 0x7E, 0x5A, 0x9D, 0x9D, 0xC0, 0xEC, 0xC2, 0x9A, 
-    0x7E, 0x5A, 0x9C, 0x7D, 0xE3, 0xE4, 0xCA, 0x9A, 0x7F, 0x85, 0x9D, 0x9D, 
-    0x6E, 0xC0, 0xC1, 0x9A, 0x7F, 0x5E, 0x9D, 0x9C, 0xC8, 0xE3, 0x9B, 0x9B, 
-    0x7E, 0x5E, 0x9D, 0x9C, 0xCA, 0x9C, 0x9C, 0x9B, 0x7F, 0x5E, 0x9D, 0x9C, 
-    0x9D, 0xD2, 0xD8, 0x9E, 0x76, 0xAD, 0x9E, 0x7B, 0x9D, 0x9C, 0x80, 0x9E, 
-    0xAD, 0xAD, 0x9E, 0x7B, 0x9C, 0x9D, 0x80, 0x9E, 0xAD, 0xAD, 0x9E, 0x7B, 
-    0x9C, 0xBF, 0x80, 0x9E, 0xAD, 0xAD, 0xAD, 0x7B, 0x9C, 0xBF, 0x80, 0x9E, 
-    0xAD, 0x76, 0x9E, 0x7B, 0x9D, 0xBF, 0x80, 0x9E, 0xAD, 0x76, 0xAD, 0x7B, 
-    0x9C, 0x9D, 0x80, 0x9F, 0x9E, 0x9E, 0x9F, 0x7B, 0x9C, 0x9D, 0xE8, 0x89, 
-    0x8C, 0x8C, 0x89, 0xA8, 0x93, 0x7B, 0x52, 0x75, 0x75, 0x9E, 0x9F, 0x98, 
-    0x93, 0x89, 0x9F, 0x75, 0x9E, 0x9F, 0xD5, 0xD3, 0xA7, 0x89, 0x9F, 0x75, 
-    0x9E, 0xCC, 0xF1, 0xF5, 0x93, 0x89, 0x52, 0x75, 0x9F, 0xCC, 0xD8, 0xD1, 
-    0xA7, 0x7B, 0x9F, 0x75, 0x75, 0x75, 0xCC, 0x89, 0xA7, 0x89, 0x77, 0x73, 
-    0x75, 0x75, 0x52, 0x8C, 0xA7, 0x7B, 0x9F, 0x75, 0x75, 0x75, 0x9F, 0x98, 
-    0xA7, 0x88, 0x73, 0x75, 0x73, 0x73, 0x9F, 0xBC, 0xAE, 0x9F, 0xE7, 0xF2, 
-    0xA8, 0x96, 0x4D, 0x4E, 0xA0, 0xCC, 0xE7, 0xF2, 0xA2, 0xAD, 0x4D, 0x50, 
-    0xAE, 0xCC, 0xF0, 0xC6, 0xA2, 0x96, 0x4D, 0x4E, 0xA5, 0x9F, 0x50, 0x8E, 
-    0x8D, 0x96, 0x4A, 0x4E, 0xA5, 0x9F, 0x50, 0x96, 0x94, 0x9E, 0x4D, 0x4E, 
-    0xA5, 0x9F, 0x78, 0x78, 0x78, 0x78, 0x4E, 0x4E, 0xA3, 0x52, 0x50, 0x78, 
-    0xF3, 0xF0, 0x4A, 0x4E, 0xB7, 0xCC, 0x50, 0x77, 0xF5, 0xEA, 0x4A, 0x50, 
-    0x4E, 0x76, 0xA2, 0x91, 0x91, 0x91, 0x76, 0x91, 0x4E, 0x68, 0x98, 0xAD, 
-    0x72, 0x51, 0x51, 0x96, 0x4D, 0x68, 0xA0, 0x9E, 0x51, 0x72, 0x74, 0x76, 
-    0x4D, 0x76, 0xA0, 0x9E, 0x72, 0x72, 0x72, 0x76, 0x4D, 0x68, 0xA0, 0x91, 
-    0x89, 0x89, 0x89, 0x94, 0x4D, 0x75, 0xA0, 0x8E, 0x8E, 0xA2, 0xA2, 0xA2, 
-    0x4E, 0x4E, 0x50, 0x72, 0x72, 0x72, 0x72, 0x72, 0x78, 0x78, 0x50, 0x50, 
-    0x50, 0x50, 0x50, 0x50, 0x8E, 0x91, 0x4E, 0x4E, 0x4A, 0x9F, 0x8C, 0x89, 
-    0x8E, 0x68, 0x4A, 0x72, 0x89, 0x8E, 0x8D, 0x89, 0xA2, 0x76, 0x4D, 0x72, 
-    0x9F, 0x72, 0x9F, 0x73, 0xA2, 0x76, 0x4A, 0x72, 0x89, 0x89, 0x89, 0x76, 
-    0xA2, 0x76, 0x2D, 0x75, 0xA5, 0xB5, 0xB5, 0xA2, 0x8E, 0x75, 0x4A, 0x9F, 
-    0x8D, 0x8D, 0x8D, 0x8C, 0x72, 0x4E, 0x4A, 0x4E, 0x72, 0x72, 0x72, 0x32, 
-    0x50, 0x50, 0x72, 0x72, 0x50, 0x50, 0x50, 0x4A, 0x50, 0x4D, 0x4A, 0x4E, 
-    0x4D, 0x4A, 0x4D, 0x51, 0x50, 0x4D, 0x4A, 0x4D, 0x68, 0x79, 0x79, 0x72, 
-    0x50, 0x4A, 0x4A, 0x4D, 0x68, 0x89, 0x89, 0x50, 0x4E, 0x4A, 0x4A, 0x4D, 
-    0x4A, 0x4A, 0x4A, 0x4A, 0x4E, 0x4A, 0x2E, 0x4A, 0x4D, 0x4E, 0x4E, 0x4D, 
-    0x4E, 0x4A, 0x2E, 0x4A, 0x4A, 0x78, 0x78, 0x53, 0x4E, 0x4A, 0x4A, 0x4A, 
-    0x2E, 0x4A, 0x4A, 0x2E, 0x2E, 0x4D, 0x4E, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 
-    0x2E, 0x4D, 0x4D, 0x2E, 0x56, 0x56, 0x2E, 0x2E, 0x4A, 0x53, 0x78, 0x4A, 
-    0x56, 0x56, 0x2E, 0x2E, 0x4A, 0x4D, 0x50, 0x4A, 0x56, 0x56, 0x56, 0x2E, 
-    0x4A, 0x4D, 0x50, 0x4A, 0x56, 0x2E, 0x56, 0x56, 0x4A, 0x4A, 0x4A, 0x2E, 
-    0x56, 0x56, 0x2E, 0x53, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 0x53, 
-    0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x4D, 0x53, 0x51, 0x4E, 0x4D, 0x4A, 0x2E, 
-    0x32, 0x78, 0x53, 0x2E, 0x4E, 0x32, 0x53, 0x2E, 0x2E, 0x2E, 0x56, 0x56, 
-    0x53, 0x32, 0x4A, 0x56, 0x24, 0x56, 0x24, 0x24, 0x53, 0x32, 0x4A, 0x24, 
-    0x24, 0x0F, 0x0F, 0x1A, 0x4E, 0x32, 0x4A, 0x24, 0x24, 0x16, 0x60, 0x7F, 
-    0x32, 0x78, 0x22, 0x36, 0x5D, 0x59, 0x7F, 0x7F, 0x32, 0x62, 0x6C, 0xE2, 
-    0x7E, 0x85, 0xE2, 0x3E, 0x22, 0x64, 0x85, 0x37, 0x1B, 0x60, 0x60, 0x26, 
-    0xEA, 0xC2, 0xC0, 0x6C, 0x26, 0x47, 0x47, 0x23, 0x24, 0x0E, 0x24, 0x32, 
-    0x52, 0x53, 0x32, 0x53, 0x24, 0x0E, 0x24, 0x67, 0x32, 0x34, 0x56, 0x0F, 
-    0x16, 0x0E, 0x0E, 0x10, 0x0F, 0x0F, 0x24, 0x0F, 0x7F, 0x6A, 0x5D, 0x60, 
-    0x5C, 0x10, 0x0F, 0x0F, 0x7E, 0x3F, 0x69, 0x22, 0x22, 0x3D, 0x74, 0x2D, 
-    0x26, 0x23, 0x51, 0x13, 0x13, 0x51, 0x74, 0x32, 0x13, 0x13, 0x3B, 0x1A, 
-    0x1F, 0x1F, 0x13, 0x62, 0x3B, 0x23, 0x23, 0x1A, 0x1A, 0x30, 0x1F, 0x10, 
-    0x56, 0x0F, 0x0F, 0x0E, 0x1E, 0x22, 0x95, 0x64, 0x10, 0x0F, 0x0E, 0x0E, 
-    0x1E, 0x6B, 0x97, 0x85, 0x0F, 0x10, 0x0F, 0x24, 0x1E, 0x6B, 0x70, 0xE2, 
-    0x24, 0x2E, 0x56, 0x24, 0x1E, 0x36, 0x70, 0xE2, 0x0F, 0x56, 0x2E, 0x56, 
-    0x25, 0x22, 0x70, 0xE2, 0x56, 0x0F, 0x0F, 0x0F, 0x0F, 0x22, 0x70, 0xE2, 
-    0x53, 0x56, 0x0F, 0x0F, 0x25, 0x21, 0xD0, 0x46, 0x62, 0x62, 0x0F, 0x0F, 
-    0x0F, 0x0F, 0x10, 0x0E, 0x60, 0x34, 0x51, 0x5C, 0x44, 0x46, 0x5E, 0x44, 
-    0x44, 0x3B, 0x35, 0x6C, 0x5C, 0x0E, 0x21, 0x37, 0x38, 0x21, 0x64, 0x90, 
-    0x3F, 0x25, 0x22, 0x6C, 0x17, 0x36, 0x7D, 0x5D, 0x17, 0x25, 0x19, 0x3E, 
-    0x35, 0x36, 0x7D, 0x3E, 0x34, 0x25, 0x0F, 0x51, 0x17, 0x40, 0x7D, 0x46, 
-    0x34, 0x0E, 0x1A, 0x75, 0x22, 0x95, 0x7D, 0x57, 0x17, 0x25, 0x1A, 0x62, 
-    0x20, 0x95, 0x6D, 0x5F, 0x5A, 0x39, 0x39, 0x35, 0x3E, 0x6E, 0xE2, 0x5E, 
-    0x9D, 0xC1, 0xC1, 0xE3, 0x37, 0x46, 0x57, 0x86, 0xC1, 0xC1, 0xBF, 0x9B, 
-    0x44, 0x5C, 0x90, 0x66, 0x64, 0xE2, 0x83, 0x59, 0x35, 0x17, 0x35, 0x47, 
-    0x26, 0x8F, 0x44, 0x36, 0x51, 0x51, 0x25, 0x1A, 0x22, 0x95, 0x64, 0x64, 
-    0x75, 0x47, 0x18, 0x0B, 0x0E, 0x21, 0x45, 0x45, 0x51, 0x13, 0x0C, 0x45, 
-    0x66, 0x65, 0x9A, 0x65, 0x17, 0x3B, 0x45, 0x90, 0x90, 0x85, 0xE2, 0xE2, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x16, 0x20, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x19, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0B, 0x38, 0x3E, 0x01, 0x01, 0x01, 0x01, 0x17, 0x35, 0x37, 0x59, 
-    0x01, 0x01, 0x01, 0x0C, 0x26, 0x37, 0x3F, 0x6A, 0x22, 0x3E, 0x5D, 0x60, 
-    0x60, 0x59, 0x7F, 0x7F, 0x25, 0x16, 0x37, 0x26, 0x26, 0x37, 0x6A, 0x6F, 
-    0x1A, 0x0E, 0x25, 0x0E, 0x0E, 0x30, 0x7E, 0xDD, 0x1A, 0x17, 0x38, 0x59, 
-    0x7E, 0x83, 0x5E, 0x6D, 0x37, 0x3E, 0x42, 0x3E, 0x5D, 0x9B, 0xC1, 0xC8, 
-    0x3F, 0x3F, 0x5D, 0x3F, 0x5D, 0x65, 0xBF, 0xC1, 0x7E, 0x83, 0x7E, 0x82, 
-    0x7F, 0x65, 0x5F, 0x9D, 0x60, 0x3F, 0x3E, 0x60, 0x7F, 0x7F, 0x9A, 0x7D, 
-    0x5F, 0x9D, 0xC8, 0x80, 0x1E, 0x0C, 0x0F, 0x35, 0x8F, 0x8F, 0x40, 0x16, 
-    0x0C, 0x1A, 0x17, 0x57, 0x85, 0xC0, 0x71, 0x1E, 0x34, 0x35, 0x44, 0x82, 
-    0x9D, 0xC2, 0xE8, 0x1E, 0x34, 0x44, 0x5A, 0x6D, 0xC8, 0xC2, 0xE8, 0x1E, 
-    0x25, 0x40, 0x86, 0x64, 0xC8, 0xC0, 0x5B, 0x25, 0x34, 0x37, 0x87, 0x17, 
-    0xC1, 0x71, 0x25, 0x34, 0x3B, 0x5D, 0x90, 0x17, 0xBF, 0x71, 0x25, 0x34, 
-    0x37, 0x85, 0x5F, 0x35, 0x60, 0x65, 0x60, 0x3E, 0x1F, 0x25, 0x2E, 0x53, 
-    0x82, 0x82, 0x35, 0x34, 0x0E, 0x2E, 0x53, 0x10, 0x82, 0x46, 0x0F, 0x2D, 
-    0x0F, 0x23, 0x2E, 0x30, 0x6C, 0x34, 0x0F, 0x0F, 0x2E, 0x2E, 0x1F, 0x30, 
-    0x66, 0x1E, 0x2D, 0x0F, 0x51, 0x13, 0x30, 0x30, 0x0B, 0x25, 0x34, 0x0F, 
-    0x51, 0x10, 0x1F, 0x30, 0x25, 0x25, 0x34, 0x0F, 0x34, 0x0E, 0x1F, 0x1F, 
-    0x25, 0x25, 0x24, 0x2E, 0x34, 0x0C, 0x1F, 0x1F, 0x2E, 0x0F, 0x1F, 0x30, 
-    0x30, 0x3B, 0x19, 0x13, 0x0E, 0x1F, 0x1F, 0x30, 0x30, 0x1A, 0x19, 0x17, 
-    0x30, 0x30, 0x30, 0x30, 0x1F, 0x1F, 0x1A, 0x1A, 0x30, 0x30, 0x30, 0x30, 
-    0x30, 0x30, 0x1F, 0x1F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1F, 0x17, 0x23, 
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x1F, 0x13, 0x62, 0x1F, 0x1F, 0x1F, 0x1F, 
-    0x1F, 0x30, 0x1F, 0x13, 0x1F, 0x1F, 0x1F, 0x1A, 0x1F, 0x1F, 0x1F, 0x1F, 
-    0x3B, 0x1A, 0x1A, 0x17, 0x47, 0x47, 0x47, 0x41, 0x3B, 0x30, 0x30, 0x1A, 
-    0x17, 0x47, 0x47, 0x47, 0x1A, 0x30, 0x30, 0x30, 0x30, 0x47, 0x47, 0x51, 
-    0x1A, 0x30, 0x30, 0x3B, 0x1A, 0x23, 0x47, 0x47, 0x13, 0x1A, 0x1A, 0x3B, 
-    0x3B, 0x17, 0x43, 0x3E, 0x23, 0x30, 0x17, 0x26, 0x3E, 0x3F, 0x60, 0x60, 
-    0x13, 0x30, 0x1A, 0x3B, 0x3E, 0x6A, 0x83, 0x83, 0x3B, 0x17, 0x35, 0x26, 
-    0x3E, 0x83, 0x9A, 0x7F, 0x42, 0x43, 0x3F, 0x82, 0x64, 0x5E, 0x85, 0x82, 
-    0x41, 0x3F, 0x5D, 0x3F, 0x59, 0x5E, 0x65, 0x7D, 0x26, 0x3F, 0x60, 0x6F, 
-    0x6F, 0x7F, 0x7E, 0x86, 0x6A, 0x83, 0xDD, 0x9A, 0x9D, 0xBF, 0x85, 0x84, 
-    0x83, 0xDD, 0x9A, 0x65, 0xC1, 0xC2, 0xC8, 0xC1, 0x6A, 0x7E, 0x9A, 0x65, 
-    0xC1, 0xCA, 0xE4, 0xE4, 0x83, 0x5E, 0x97, 0x6D, 0xC8, 0xCA, 0xE4, 0xE4, 
-    0x65, 0x7D, 0xC1, 0x6D, 0xC1, 0xC8, 0xCA, 0xE5, 0x6C, 0x19, 0x4E, 0x53, 
-    0x53, 0x4E, 0x53, 0x4A, 0x97, 0x87, 0x62, 0x4A, 0x53, 0x32, 0x53, 0x4A, 
-    0xC8, 0xEE, 0x6B, 0x2D, 0x53, 0x32, 0x4E, 0x4A, 0xC1, 0xC8, 0xD2, 0x6B, 
-    0x2D, 0x4D, 0x4D, 0x4A, 0xC1, 0xBF, 0xC2, 0x81, 0x2D, 0x4A, 0x4A, 0x4D, 
-    0xC1, 0xBF, 0xC2, 0x6B, 0x2D, 0x4A, 0x4A, 0x4A, 0xC8, 0x6E, 0x95, 0x95, 
-    0x31, 0x2D, 0x4A, 0x4A, 0xC2, 0xE2, 0x8F, 0x64, 0x5C, 0x23, 0x4A, 0x02, 
-    0x4A, 0x4A, 0x4A, 0x4A, 0x53, 0x50, 0xCC, 0x9E, 0x4A, 0x4A, 0x2E, 0x2E, 
-    0x4D, 0x89, 0x98, 0x89, 0x2E, 0x2E, 0x2E, 0x2E, 0x4A, 0x75, 0x76, 0x73, 
-    0x4A, 0x4A, 0x4A, 0x4A, 0x4D, 0x50, 0x50, 0x50, 0x4A, 0x4A, 0x4E, 0x4E, 
-    0x4A, 0x2E, 0x2E, 0x4A, 0x4D, 0x4A, 0x4E, 0x4E, 0x4A, 0x4A, 0x4A, 0x4A, 
-    0x4D, 0x4A, 0x4E, 0x4E, 0x4D, 0x4A, 0x32, 0x50, 0x4A, 0x4A, 0x4D, 0x4E, 
-    0x4D, 0x4A, 0x4A, 0x4D, 0x91, 0x91, 0x89, 0x91, 0xAD, 0x91, 0x75, 0x4A, 
-    0x75, 0x75, 0x75, 0x89, 0x8D, 0xA2, 0xA2, 0x8C, 0x89, 0x8D, 0xA2, 0x73, 
-    0x72, 0x73, 0x91, 0x8D, 0x50, 0x76, 0xA2, 0x89, 0x8C, 0xA2, 0xA2, 0xA2, 
-    0x4A, 0x4E, 0x9E, 0x91, 0x8C, 0x8E, 0x8D, 0x8D, 0x4A, 0x4A, 0x2E, 0x2E, 
-    0x4A, 0x50, 0x94, 0x8D, 0x4D, 0x4E, 0x4A, 0x2D, 0x32, 0x8E, 0x8D, 0x8D, 
-    0x4A, 0x4D, 0x78, 0x74, 0x78, 0xAE, 0x89, 0x73, 0x88, 0xCD, 0x74, 0x50, 
-    0x9E, 0xB7, 0xA4, 0x89, 0xD8, 0x3A, 0x4E, 0x72, 0x9E, 0xB7, 0x98, 0x76, 
-    0xD1, 0xF6, 0x88, 0x72, 0x9E, 0xA7, 0x98, 0x4D, 0xD1, 0xC6, 0x88, 0x50, 
-    0x9F, 0xA7, 0x98, 0x4E, 0xD1, 0xC6, 0x8E, 0x91, 0x8E, 0xBA, 0xD7, 0x50, 
-    0xDF, 0xD1, 0x91, 0x96, 0x89, 0xC4, 0xD7, 0x4E, 0xD1, 0xF3, 0x4D, 0x50, 
-    0x78, 0xD1, 0xF0, 0x4E, 0xF3, 0xF3, 0x4E, 0x4E, 0x77, 0xC7, 0xF0, 0x4E, 
-    0x89, 0x78, 0x74, 0xCC, 0x9F, 0xAE, 0xAE, 0x73, 0x76, 0x72, 0x74, 0x78, 
-    0xAD, 0xA5, 0xA4, 0x73, 0x78, 0x52, 0x52, 0x78, 0x68, 0xBA, 0xB1, 0x73, 
-    0x78, 0x78, 0x52, 0x78, 0xAD, 0xA7, 0xA3, 0x73, 0xCC, 0x72, 0x52, 0x78, 
-    0xAD, 0xB8, 0xB5, 0x9F, 0x72, 0x52, 0x78, 0x78, 0xAD, 0x93, 0xA3, 0x77, 
-    0x72, 0x72, 0xCC, 0x78, 0x96, 0xA9, 0xAF, 0x92, 0xCC, 0x78, 0x52, 0x50, 
-    0x96, 0xB8, 0xA9, 0xD7, 0x77, 0x73, 0x9F, 0xCC, 0xF3, 0xD4, 0x98, 0xA0, 
-    0x52, 0x73, 0x9F, 0xCC, 0xF3, 0xD4, 0xAD, 0x91, 0x52, 0x73, 0x9F, 0xCC, 
-    0xF3, 0xF4, 0xCD, 0x8C, 0x77, 0x73, 0x9F, 0xCC, 0xF3, 0xD4, 0xC5, 0x98, 
-    0x77, 0x77, 0x9F, 0xCC, 0xF3, 0xF5, 0xC7, 0x98, 0x52, 0x77, 0xCC, 0xCC, 
-    0xF3, 0xF7, 0xD8, 0xA8, 0x50, 0x77, 0xF0, 0x33, 0xF3, 0xD4, 0x96, 0x98, 
-    0x50, 0x33, 0xF2, 0x3A, 0xF1, 0xD4, 0x7B, 0xD7, 0xBC, 0xA0, 0xA0, 0xF1, 
-    0x9D, 0x9C, 0x9C, 0x9C, 0x91, 0x91, 0x96, 0xF0, 0x70, 0x7D, 0x7D, 0x9C, 
-    0x72, 0x9F, 0xAD, 0x92, 0xD3, 0x9D, 0x9C, 0x7D, 0x9E, 0x76, 0xAD, 0xD7, 
-    0xF3, 0x9D, 0x9D, 0x7D, 0xCD, 0xF0, 0xCC, 0x98, 0xF6, 0x90, 0x9D, 0x9C, 
-    0x92, 0xF3, 0xD6, 0xB2, 0xBD, 0x90, 0x9C, 0x7D, 0xD8, 0xDF, 0xF4, 0xBD, 
-    0xBD, 0x90, 0x9D, 0x7D, 0x75, 0x68, 0x88, 0xB6, 0xAF, 0x3A, 0x5B, 0x7D, 
-    0x5F, 0x9C, 0xC8, 0xEB, 0xEB, 0xEC, 0xEC, 0xEC, 0x9C, 0x9C, 0xE9, 0xED, 
-    0xEC, 0xEC, 0xEC, 0xEC, 0x9C, 0x9C, 0xE9, 0xED, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0x9C, 0x9C, 0xC2, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0x9C, 0x9C, 0xC2, 0xED, 
-    0xEC, 0xEC, 0xEC, 0xEC, 0x9C, 0x9C, 0xC2, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0x9C, 0x9C, 0xC9, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0x9C, 0x9C, 0xCB, 0xED, 
-    0xEC, 0xEB, 0xEB, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xE5, 0xD4, 0xAC, 0xAC, 
-    0xEC, 0xEC, 0xEC, 0xEC, 0xE5, 0xD4, 0xAC, 0xAC, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0xEB, 0xD4, 0xAC, 0xAC, 0xEC, 0xE5, 0xEC, 0xEC, 0xEE, 0xC5, 0xAC, 0xAA, 
-    0xEC, 0xEC, 0xEC, 0xE5, 0xD4, 0xAC, 0xAC, 0xAA, 0xEC, 0xEC, 0xE5, 0xE5, 
-    0xC5, 0xAC, 0xAC, 0xAA, 0xEB, 0xE5, 0xEB, 0xEF, 0xC5, 0xB0, 0xAC, 0xAC, 
-    0xEC, 0xE5, 0xD4, 0xF6, 0xB0, 0xB0, 0xAC, 0xAC, 0xA4, 0x76, 0x76, 0x96, 
-    0xA8, 0xAC, 0xAC, 0xC5, 0xA4, 0xAD, 0x68, 0x96, 0xA8, 0xAC, 0xAC, 0xC5, 
-    0xA4, 0xAD, 0x96, 0x96, 0xA8, 0xAC, 0xAC, 0xB3, 0xB6, 0xAD, 0x96, 0x96, 
-    0x7A, 0xAA, 0xB0, 0xAA, 0x98, 0xAD, 0x68, 0x7B, 0xA4, 0xAA, 0xB0, 0xAC, 
-    0xB6, 0xAD, 0x76, 0x7B, 0xA4, 0xB0, 0xB0, 0xB3, 0xB6, 0x9E, 0x9E, 0x7B, 
-    0x8B, 0xAA, 0xB0, 0xC5, 0x98, 0x88, 0x92, 0x7B, 0xA4, 0xB0, 0xAC, 0xB3, 
-    0xED, 0xEC, 0xED, 0xEC, 0xEC, 0xEC, 0xE5, 0xEC, 0xED, 0xEB, 0xED, 0xEC, 
-    0xEC, 0xEC, 0xEC, 0xEC, 0xF4, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0xB3, 0xEF, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xA9, 0xEF, 0xEC, 0xED, 
-    0xEC, 0xEC, 0xEC, 0xEC, 0xAF, 0xC5, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0xA9, 0xB0, 0xEB, 0xEC, 0xEC, 0xEB, 0xEC, 0xEC, 0xA9, 0xB0, 0xD4, 0xEC, 
-    0xEC, 0xEB, 0xEB, 0xEC, 0xEC, 0xEB, 0xE4, 0xBF, 0x65, 0x5F, 0x9C, 0x9C, 
-    0xEC, 0xEC, 0xEC, 0xBF, 0x9C, 0x9C, 0x9C, 0x9C, 0xE5, 0xEC, 0xEC, 0xBF, 
-    0x9C, 0x9C, 0x9C, 0x9C, 0xEC, 0xEC, 0xEC, 0xBF, 0x9C, 0x7D, 0x9C, 0x9C, 
-    0xEC, 0xEC, 0xEC, 0xBF, 0x9C, 0x9C, 0x9C, 0x9C, 0xEC, 0xEC, 0xEB, 0xBF, 
-    0x9C, 0x9C, 0x7D, 0x9C, 0xEB, 0xEC, 0xEB, 0xBF, 0x9C, 0x5F, 0x9C, 0x9C, 
-    0xEB, 0xEC, 0xE5, 0x6E, 0x9C, 0x9C, 0x6D, 0x46, 0x9D, 0x9D, 0xD0, 0xA0, 
-    0x8D, 0xAE, 0x8D, 0xA5, 0x9C, 0x9D, 0x3A, 0x96, 0x91, 0x91, 0x96, 0x94, 
-    0x97, 0xD0, 0x8C, 0x9F, 0x9E, 0xAD, 0x89, 0x7B, 0xD0, 0xAF, 0xA8, 0x9F, 
-    0x9E, 0x96, 0xA2, 0x7B, 0xD0, 0xA7, 0xA8, 0x9F, 0x9E, 0x7B, 0xA8, 0x7B, 
-    0xD0, 0xA7, 0xA8, 0x73, 0x9E, 0xAD, 0xAD, 0x7B, 0xD0, 0x93, 0xA8, 0x9F, 
-    0xAD, 0x9E, 0xCC, 0x7B, 0xCF, 0xA7, 0xA8, 0x9F, 0x9F, 0x9F, 0x9F, 0x7B, 
-    0xB7, 0xD0, 0x5C, 0x9F, 0x9F, 0x73, 0x9F, 0xBC, 0xB7, 0xD0, 0x5D, 0x52, 
-    0x9E, 0x75, 0x9E, 0xAE, 0xAF, 0xD0, 0x5C, 0x73, 0x75, 0x9F, 0x9F, 0xAE, 
-    0xAB, 0x88, 0x74, 0x9F, 0x75, 0x9F, 0x9E, 0xAE, 0xA7, 0x89, 0x78, 0x75, 
-    0x75, 0x9F, 0xCC, 0xAE, 0xA7, 0x89, 0x78, 0x9F, 0x9F, 0x9F, 0xD8, 0xBD, 
-    0xA7, 0x89, 0x78, 0x77, 0xCC, 0x12, 0xF4, 0xC4, 0xAF, 0x89, 0x50, 0x33, 
-    0xF6, 0x3C, 0x3A, 0xB4, 0xA3, 0xCC, 0x4E, 0x77, 0xF7, 0xEA, 0x4A, 0x77, 
-    0xA5, 0x72, 0x50, 0x12, 0xF5, 0xEA, 0x2D, 0x72, 0xB7, 0xCC, 0x4E, 0x77, 
-    0xF5, 0xEA, 0x2D, 0x50, 0xBC, 0xCC, 0x50, 0x77, 0xD1, 0xD8, 0x4A, 0x4E, 
-    0xB7, 0xCC, 0xCC, 0x78, 0x78, 0x50, 0x4E, 0x4E, 0xAE, 0xCC, 0x50, 0x78, 
-    0x92, 0xD8, 0x4A, 0x4E, 0xAE, 0xCC, 0x50, 0x2C, 0xF5, 0xEA, 0x2D, 0x4E, 
-    0xAE, 0xCC, 0x50, 0x12, 0xF7, 0xEA, 0x2D, 0x4E, 0x68, 0x78, 0x72, 0x76, 
-    0x75, 0x72, 0x73, 0x68, 0x52, 0x4A, 0x4A, 0x72, 0x78, 0x4A, 0x4D, 0x52, 
-    0x78, 0x4D, 0x4A, 0x50, 0x50, 0x4A, 0x53, 0x78, 0x50, 0x4D, 0x4A, 0x50, 
-    0x50, 0x4A, 0x4D, 0x50, 0x4E, 0x4A, 0x4A, 0x4E, 0x4D, 0x4A, 0x4A, 0x4D, 
-    0x4E, 0x4D, 0x4E, 0x32, 0x53, 0x4D, 0x4E, 0x32, 0x4E, 0x4E, 0x4E, 0x4E, 
-    0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x53, 0x4E, 
-    0x73, 0x52, 0x75, 0x75, 0x73, 0x75, 0x76, 0x4E, 0x4E, 0x4A, 0x50, 0x78, 
-    0x4A, 0x4D, 0x78, 0x53, 0x4E, 0x4A, 0x50, 0x32, 0x2E, 0x4A, 0x50, 0x53, 
-    0x4D, 0x2E, 0x4D, 0x4E, 0x4A, 0x4A, 0x4E, 0x53, 0x4A, 0x56, 0x4A, 0x4A, 
-    0x56, 0x2E, 0x4A, 0x2E, 0x4D, 0x4D, 0x4E, 0x4E, 0x4D, 0x4E, 0x50, 0x4E, 
-    0x53, 0x4E, 0x4E, 0x4E, 0x32, 0x62, 0x62, 0x62, 0x4E, 0x4D, 0x2E, 0x21, 
-    0x82, 0x82, 0x64, 0x5E, 0x2E, 0x4A, 0x32, 0x78, 0x78, 0x78, 0x78, 0x50, 
-    0x2E, 0x4A, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x2E, 0x4A, 0x53, 0x4E, 
-    0x4E, 0x4D, 0x4E, 0x4E, 0x2E, 0x2E, 0x4A, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 
-    0x2E, 0x2E, 0x4D, 0x4D, 0x4D, 0x4E, 0x4D, 0x4E, 0x4A, 0x4A, 0x4E, 0x4E, 
-    0x53, 0x4E, 0x4E, 0x4D, 0x2E, 0x4A, 0x2E, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 
-    0x5D, 0x2E, 0x4E, 0x53, 0x4E, 0x4E, 0x53, 0x4E, 0x78, 0x4E, 0x2E, 0x2E, 
-    0x53, 0x51, 0x32, 0xD0, 0x50, 0x4E, 0x2E, 0x4A, 0x4D, 0x4A, 0x31, 0x95, 
-    0x50, 0x50, 0x4A, 0x4E, 0x4A, 0x31, 0xC9, 0x5F, 0x50, 0x50, 0x2E, 0x4A, 
-    0x4A, 0x20, 0xC1, 0x6E, 0x50, 0x4E, 0x2E, 0x2E, 0x2D, 0x3D, 0x70, 0x9D, 
-    0x50, 0x53, 0x4A, 0x4A, 0x2D, 0x22, 0xC9, 0x86, 0x4E, 0x4D, 0x4A, 0x4A, 
-    0x4A, 0x87, 0x90, 0x5A, 0x50, 0x4D, 0x4A, 0x4A, 0x53, 0x95, 0x6F, 0x57, 
-    0xD9, 0xED, 0xEB, 0x97, 0x57, 0x35, 0x3E, 0x3F, 0x86, 0xEE, 0xC8, 0x85, 
-    0x6F, 0x6A, 0x83, 0x60, 0x58, 0xC2, 0x6E, 0xDE, 0x83, 0x7F, 0x7E, 0x3F, 
-    0x5A, 0x6E, 0x5E, 0x85, 0x5F, 0x82, 0x3F, 0x35, 0x7E, 0xE2, 0x85, 0xE2, 
-    0x5E, 0x3E, 0x35, 0x3B, 0x44, 0x6A, 0x83, 0x37, 0x3E, 0x35, 0x19, 0x3B, 
-    0x5D, 0x3F, 0x57, 0x35, 0x41, 0x3B, 0x3B, 0x13, 0x97, 0x40, 0x45, 0x46, 
-    0x3E, 0x3B, 0x3B, 0x21, 0x3B, 0x23, 0x47, 0x3B, 0x1A, 0x1A, 0x1F, 0x0E, 
-    0x35, 0x17, 0x17, 0x1A, 0x30, 0x30, 0x1A, 0x1F, 0x26, 0x30, 0x1F, 0x16, 
-    0x1A, 0x1A, 0x0E, 0x30, 0x3B, 0x1A, 0x1A, 0x1A, 0x1F, 0x1F, 0x45, 0x5A, 
-    0x3B, 0x17, 0x13, 0x1F, 0x39, 0x61, 0x90, 0x97, 0x17, 0x35, 0x17, 0x39, 
-    0x90, 0x97, 0x7D, 0x5F, 0x34, 0x40, 0x95, 0x70, 0x70, 0xC8, 0xBF, 0x65, 
-    0x86, 0x6E, 0x70, 0xC1, 0xBF, 0xBF, 0x7D, 0x7F, 0x10, 0x23, 0x0F, 0x0E, 
-    0x0E, 0x25, 0x25, 0x25, 0x34, 0x0E, 0x45, 0x36, 0x36, 0x36, 0x36, 0x36, 
-    0x39, 0x39, 0x3F, 0x59, 0x59, 0x5D, 0x6C, 0x5D, 0x7D, 0x5F, 0x82, 0x59, 
-    0x3F, 0x19, 0x47, 0x19, 0x7D, 0x65, 0xE2, 0x7F, 0x84, 0x1A, 0x3B, 0x3B, 
-    0x65, 0x7E, 0x60, 0x6A, 0x60, 0x41, 0x47, 0x3B, 0x82, 0x3F, 0x43, 0x26, 
-    0x41, 0x41, 0x3D, 0x35, 0x59, 0x3E, 0x35, 0x34, 0x3B, 0x3B, 0x13, 0x3B, 
-    0x25, 0x41, 0x5F, 0x7D, 0x7D, 0x90, 0x64, 0x71, 0x22, 0x41, 0x1B, 0x57, 
-    0xE2, 0x97, 0xC1, 0xC1, 0x5D, 0x3F, 0x13, 0x13, 0x26, 0x64, 0xC1, 0xC1, 
-    0x23, 0x23, 0x47, 0x99, 0x3D, 0x3D, 0x69, 0x95, 0x1A, 0x34, 0x1A, 0x51, 
-    0x51, 0x74, 0x74, 0x99, 0x30, 0x30, 0x1F, 0x1F, 0x1F, 0x0E, 0x2E, 0x77, 
-    0x30, 0x30, 0x30, 0x1F, 0x1F, 0x1F, 0x0E, 0x56, 0x30, 0x1A, 0x30, 0x1F, 
-    0x34, 0x1F, 0x1F, 0x0C, 0x46, 0x46, 0x90, 0x6E, 0x64, 0x21, 0x23, 0x21, 
-    0xC1, 0x70, 0x95, 0x40, 0x6F, 0x82, 0x85, 0x59, 0xBF, 0xC1, 0xD2, 0xD2, 
-    0x95, 0x7D, 0x7F, 0x3E, 0x71, 0x71, 0xEE, 0xEE, 0xD2, 0x59, 0x1B, 0x62, 
-    0x69, 0x46, 0x80, 0x71, 0x66, 0x5D, 0x86, 0x46, 0x3D, 0x5C, 0x64, 0x7D, 
-    0x5F, 0x70, 0x97, 0x7F, 0x51, 0x41, 0x5D, 0x5A, 0x64, 0x6E, 0x6D, 0x84, 
-    0x25, 0x51, 0x47, 0x35, 0x46, 0x58, 0x40, 0x19, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x39, 0x1B, 0x43, 0x37, 0x3E, 0x43, 0x01, 0x0B, 0x37, 0x3F, 
-    0x43, 0x43, 0x69, 0x19, 0x0C, 0x16, 0x37, 0x3E, 0x26, 0x19, 0x34, 0x25, 
-    0x1F, 0x16, 0x26, 0x38, 0x0E, 0x2D, 0x25, 0x1E, 0x0F, 0x0E, 0x0C, 0x0C, 
-    0x0B, 0x1E, 0x0E, 0x0E, 0x0B, 0x01, 0x01, 0x01, 0x0B, 0x1E, 0x0F, 0x34, 
-    0x01, 0x01, 0x01, 0x01, 0x0E, 0x34, 0x13, 0x17, 0x01, 0x01, 0x01, 0x1E, 
-    0x3B, 0x19, 0x26, 0x26, 0x26, 0x41, 0x41, 0x3E, 0x7F, 0x9A, 0x9A, 0x9D, 
-    0x25, 0x47, 0x41, 0x43, 0x59, 0x7E, 0x7F, 0xBF, 0x0E, 0x20, 0x43, 0x3E, 
-    0x57, 0x6A, 0x7F, 0x9D, 0x24, 0x1E, 0x3B, 0x41, 0x17, 0x37, 0x83, 0x5F, 
-    0x10, 0x17, 0x26, 0x43, 0x37, 0x59, 0x7E, 0x7D, 0x19, 0x41, 0x41, 0x3E, 
-    0x60, 0x7F, 0x65, 0x71, 0x26, 0x60, 0x60, 0x60, 0x7E, 0x65, 0x85, 0x0E, 
-    0x3E, 0x59, 0x7E, 0x5E, 0x85, 0x86, 0x58, 0x0E, 0xBF, 0x71, 0x25, 0x30, 
-    0x6F, 0x65, 0x90, 0x1A, 0xC1, 0x71, 0x25, 0x17, 0x5A, 0x5A, 0x22, 0x34, 
-    0xC1, 0x71, 0x25, 0x0C, 0x30, 0x0E, 0x25, 0x13, 0xC1, 0x86, 0x1E, 0x0C, 
-    0x46, 0x45, 0x25, 0x34, 0xC1, 0x71, 0x1E, 0x18, 0x86, 0x71, 0x25, 0x34, 
-    0x6B, 0x22, 0x25, 0x18, 0xE2, 0x86, 0x0E, 0x34, 0x41, 0x22, 0x01, 0x0B, 
-    0x66, 0x9D, 0x71, 0x25, 0x19, 0x46, 0x66, 0x71, 0x36, 0x66, 0x45, 0x34, 
-    0x25, 0x0B, 0x56, 0x62, 0x0F, 0x0C, 0x1F, 0x1F, 0x25, 0x0E, 0x13, 0x2E, 
-    0x0E, 0x0C, 0x1F, 0x1F, 0x25, 0x13, 0x51, 0x25, 0x0E, 0x1A, 0x1F, 0x1F, 
-    0x25, 0x24, 0x51, 0x0E, 0x0C, 0x13, 0x3B, 0x1F, 0x25, 0x0E, 0x51, 0x0E, 
-    0x0E, 0x13, 0x13, 0x1F, 0x25, 0x25, 0x51, 0x0E, 0x0E, 0x13, 0x13, 0x1F, 
-    0x34, 0x0E, 0x2E, 0x0E, 0x1F, 0x13, 0x0E, 0x0C, 0x34, 0x0B, 0x51, 0x0F, 
-    0x18, 0x1F, 0x1A, 0x17, 0x1F, 0x1F, 0x23, 0x51, 0x13, 0x1F, 0x1F, 0x1F, 
-    0x30, 0x1F, 0x23, 0x51, 0x23, 0x17, 0x1A, 0x1F, 0x30, 0x30, 0x1A, 0x1A, 
-    0x47, 0x19, 0x3B, 0x34, 0x1F, 0x1F, 0x34, 0x1F, 0x20, 0x13, 0x3B, 0x3B, 
-    0x1F, 0x1A, 0x13, 0x13, 0x10, 0x1A, 0x3B, 0x3B, 0x1F, 0x1F, 0x1A, 0x1A, 
-    0x3B, 0x3B, 0x17, 0x13, 0x1F, 0x0C, 0x0E, 0x1F, 0x30, 0x30, 0x1A, 0x51, 
-    0x0C, 0x18, 0x1F, 0x30, 0x1F, 0x30, 0x1A, 0x13, 0x3B, 0x17, 0x37, 0x60, 
-    0x83, 0x7F, 0x65, 0x7F, 0x3B, 0x37, 0x60, 0x83, 0x9A, 0x7E, 0x8F, 0x44, 
-    0x34, 0x37, 0x6A, 0x6A, 0x6A, 0x44, 0x1B, 0x44, 0x35, 0x3F, 0x7E, 0x6F, 
-    0x6F, 0xDC, 0x84, 0x5F, 0x37, 0x59, 0x82, 0x8F, 0xDC, 0x9D, 0xC0, 0xEB, 
-    0x20, 0x3E, 0x37, 0x6F, 0xE2, 0xC1, 0xE4, 0xF2, 0x35, 0x37, 0x35, 0x85, 
-    0xBF, 0xC8, 0xEC, 0xDB, 0x35, 0x3E, 0x60, 0x6D, 0xBF, 0xCA, 0xED, 0xDB, 
-    0x6F, 0x57, 0x58, 0xE2, 0xE3, 0xBF, 0xC8, 0xE5, 0x1B, 0x38, 0x8F, 0x84, 
-    0x85, 0x6D, 0xBF, 0xCA, 0x44, 0x8F, 0x44, 0x44, 0x8F, 0x85, 0x9D, 0xC1, 
-    0x90, 0x6E, 0x64, 0x8F, 0x44, 0x8F, 0x5E, 0x6D, 0xE5, 0xE5, 0xEE, 0x86, 
-    0x8F, 0x38, 0x44, 0x5A, 0xDA, 0xF5, 0xF2, 0xEF, 0x80, 0x38, 0x1B, 0x44, 
-    0xC3, 0xC3, 0xDB, 0xF2, 0xE8, 0x5A, 0x44, 0x17, 0xC3, 0xC3, 0xDB, 0xF2, 
-    0xD2, 0x90, 0x45, 0x3B, 0xC2, 0x59, 0x60, 0xC1, 0xC1, 0x6B, 0x25, 0x4A, 
-    0xC2, 0x57, 0x8F, 0x64, 0xC9, 0xE8, 0x34, 0x2D, 0x6E, 0xE1, 0x87, 0xD3, 
-    0xDB, 0xDB, 0xD5, 0x31, 0x85, 0xE1, 0xD9, 0xC3, 0xC3, 0xDB, 0xF2, 0xEA, 
-    0x6F, 0x71, 0xDA, 0xC3, 0xC3, 0xDB, 0xF2, 0xEA, 0x8F, 0x86, 0xDA, 0xC3, 
-    0xC3, 0xC3, 0xF5, 0xD5, 0x8F, 0x59, 0xC6, 0xC3, 0xC3, 0xC3, 0xF5, 0xD5, 
-    0x8F, 0xDC, 0xC9, 0xDB, 0xDB, 0xDB, 0xF5, 0xEA, 0x4A, 0x4A, 0x4E, 0x4E, 
-    0x53, 0x4A, 0x2E, 0x4A, 0x4D, 0x4A, 0x4E, 0x4D, 0x4A, 0x4A, 0x4A, 0x4A, 
-    0x4A, 0x4A, 0x4E, 0x4D, 0x4A, 0x56, 0x56, 0x56, 0x2D, 0x4A, 0x4E, 0x4D, 
-    0x4A, 0x4D, 0x4D, 0x4A, 0x2D, 0x4A, 0x4D, 0x4E, 0x50, 0xCC, 0xCC, 0x52, 
-    0x2D, 0x4A, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x2D, 0x4A, 0x4A, 0x4E, 
-    0x4D, 0x4A, 0x4A, 0x4A, 0x2D, 0x4A, 0x4D, 0x4E, 0x4D, 0x4A, 0x4D, 0x4E, 
-    0x4A, 0x4A, 0x8E, 0xCD, 0x4E, 0x8D, 0x91, 0xD0, 0x4A, 0x4A, 0x8E, 0xCD, 
-    0x4D, 0xA0, 0x91, 0xD3, 0x4A, 0x4A, 0xCF, 0xCE, 0x4D, 0xA0, 0x89, 0xA8, 
-    0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x91, 0x94, 0x94, 0xCC, 0x9F, 0xCC, 0xCC, 
-    0x52, 0x9F, 0x9F, 0xCC, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x4E, 0x4A, 
-    0x2E, 0x4A, 0x4A, 0x4A, 0x56, 0x56, 0x4A, 0x2D, 0x4E, 0x32, 0x32, 0x4D, 
-    0x4A, 0x4A, 0x4D, 0x4A, 0xF2, 0xF6, 0x4A, 0x51, 0x78, 0xC7, 0xF0, 0x4E, 
-    0xF5, 0xF6, 0x9F, 0x9E, 0x76, 0xC7, 0xD7, 0x9F, 0xF6, 0xB9, 0xA5, 0xB5, 
-    0xB5, 0xC4, 0xBD, 0x8D, 0xCD, 0xBA, 0xA8, 0x94, 0xA8, 0xC4, 0xCD, 0xA2, 
-    0xD7, 0xC4, 0x12, 0x2E, 0x33, 0xC7, 0x92, 0x4A, 0x92, 0xB4, 0x33, 0x56, 
-    0x12, 0xC4, 0x92, 0x31, 0xD7, 0xC7, 0xDF, 0x33, 0x78, 0xC4, 0x92, 0xF7, 
-    0x92, 0xC7, 0xF1, 0x67, 0x74, 0xC4, 0x92, 0x3A, 0x50, 0x50, 0x78, 0x4E, 
-    0x76, 0xA9, 0xB7, 0x68, 0x75, 0x9E, 0x9E, 0x9F, 0x7B, 0xB7, 0xA7, 0x33, 
-    0xB5, 0xA5, 0xB5, 0xA5, 0xA5, 0xA9, 0xA7, 0xD7, 0xA2, 0xA2, 0x8D, 0xA4, 
-    0xA8, 0xAF, 0xAF, 0xD1, 0x4E, 0x52, 0xA4, 0xA4, 0x76, 0xAF, 0xAF, 0xE8, 
-    0x31, 0x78, 0x94, 0x91, 0x73, 0xB1, 0xB1, 0xEA, 0xF3, 0x4D, 0x4E, 0x50, 
-    0x9E, 0xB2, 0xC4, 0xEA, 0x33, 0xCC, 0xCC, 0xCC, 0x9F, 0xB9, 0xD1, 0x33, 
-    0x74, 0x52, 0xF0, 0xD8, 0xD4, 0xF6, 0x96, 0xBC, 0x53, 0x33, 0x9F, 0xC7, 
-    0xD4, 0xCD, 0x91, 0xBC, 0xF0, 0xF4, 0x88, 0x7B, 0xB2, 0xBD, 0x8C, 0xCD, 
-    0xEF, 0xF2, 0xD7, 0x96, 0xB9, 0xC4, 0xD4, 0xF3, 0xC2, 0xEB, 0xD1, 0xA4, 
-    0xD1, 0xF7, 0xEC, 0xD3, 0xD2, 0xEC, 0xC5, 0xB5, 0xD1, 0xD3, 0xF3, 0xD3, 
-    0x6B, 0xD3, 0x92, 0x94, 0xD1, 0xF3, 0xF1, 0xD3, 0x50, 0x76, 0x89, 0x7B, 
-    0xD1, 0xF7, 0xF2, 0xF3, 0x77, 0x91, 0xAE, 0xB6, 0xAF, 0x96, 0x67, 0x7D, 
-    0x77, 0x68, 0x8E, 0xBD, 0xAA, 0x96, 0x67, 0x7D, 0x9E, 0x50, 0x77, 0xBD, 
-    0xAA, 0x76, 0x31, 0x97, 0xCC, 0x72, 0x74, 0xB6, 0xAA, 0x76, 0x31, 0x90, 
-    0xCC, 0x50, 0x74, 0xBD, 0xAF, 0x76, 0x67, 0x90, 0xCC, 0x88, 0x3A, 0xCD, 
-    0xAA, 0x68, 0x31, 0x97, 0x0A, 0xF6, 0xF0, 0xB6, 0xAA, 0x68, 0x6B, 0x97, 
-    0x50, 0xF6, 0xD8, 0xB6, 0xAF, 0x79, 0x80, 0xBF, 0x9C, 0xC9, 0xEB, 0xEC, 
-    0xEC, 0xEC, 0xEC, 0xEB, 0x9C, 0xEE, 0xED, 0xEC, 0xEB, 0xEC, 0xEC, 0xEB, 
-    0x9D, 0xE9, 0xED, 0xEC, 0xEC, 0xEB, 0xEC, 0xEC, 0x9C, 0xE9, 0xED, 0xEC, 
-    0xEC, 0xEB, 0xEC, 0xEC, 0x9C, 0xE9, 0xEC, 0xEC, 0xEC, 0xEC, 0xEB, 0xEC, 
-    0x9C, 0xE9, 0xEC, 0xEB, 0xEC, 0xEC, 0xEC, 0xEC, 0xBF, 0xEB, 0xEC, 0xEB, 
-    0xEC, 0xEC, 0xEC, 0xEF, 0xC0, 0xED, 0xED, 0xEC, 0xEC, 0xEC, 0xEC, 0xF3, 
-    0xE5, 0xE5, 0xD4, 0xA6, 0xB0, 0xB0, 0xB0, 0xAA, 0xEB, 0xE5, 0xD4, 0xA6, 
-    0xB0, 0xB0, 0xB0, 0xAA, 0xEC, 0xE7, 0x92, 0xA6, 0xB0, 0xB0, 0xB0, 0xAA, 
-    0xED, 0xD8, 0x94, 0xA6, 0xB0, 0xC5, 0xB0, 0xAC, 0xEE, 0xF1, 0xB6, 0xA6, 
-    0xB0, 0xC5, 0xB0, 0xAA, 0xEC, 0xD4, 0xB6, 0xA6, 0xB0, 0xC5, 0xB0, 0xAA, 
-    0xEB, 0xD4, 0xB6, 0xB6, 0xB0, 0xC5, 0xB0, 0xB3, 0xBD, 0xD4, 0xB3, 0xAA, 
-    0xC5, 0xC5, 0xB0, 0xB3, 0x98, 0xCE, 0xB9, 0x8C, 0xB6, 0xB0, 0xB0, 0xB0, 
-    0x98, 0xCF, 0xCD, 0x96, 0xA8, 0xAC, 0xB0, 0xB0, 0xB6, 0x8E, 0x96, 0x7B, 
-    0xA4, 0xAC, 0xB0, 0xF6, 0xBD, 0xB9, 0x68, 0xB6, 0xA6, 0xAC, 0xAC, 0xB0, 
-    0xBD, 0xC4, 0x79, 0xAC, 0xB6, 0xB0, 0xAC, 0xB0, 0xB6, 0xD6, 0x68, 0xB6, 
-    0xB6, 0xAC, 0xB0, 0xC5, 0x98, 0xAD, 0x91, 0x96, 0xA8, 0xB0, 0xAC, 0xB0, 
-    0xB6, 0x96, 0x91, 0x89, 0x98, 0xB0, 0xAC, 0xC5, 0xAA, 0xAC, 0xC5, 0xEC, 
-    0xEC, 0xEB, 0xEC, 0xEC, 0xF6, 0xB0, 0xC5, 0xEB, 0xED, 0xEC, 0xEC, 0xEB, 
-    0x95, 0xD6, 0xB0, 0xC5, 0xD4, 0xEC, 0xEC, 0xEC, 0xD1, 0xB2, 0xB0, 0xC5, 
-    0xD4, 0xEB, 0xEC, 0xEC, 0xB2, 0xAC, 0xB0, 0xC5, 0xD4, 0xE5, 0xEB, 0xEC, 
-    0xC5, 0xAC, 0xAC, 0xC5, 0xD4, 0xE5, 0xEC, 0xEB, 0xC5, 0xB3, 0xAC, 0xC5, 
-    0xC5, 0xEF, 0xEC, 0xED, 0xC5, 0xC5, 0xC5, 0xB3, 0xC5, 0xF1, 0xEB, 0xED, 
-    0xEB, 0xEB, 0xEC, 0xE9, 0xBF, 0x9C, 0x64, 0x62, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0xC0, 0x9C, 0x5E, 0x74, 0xEB, 0xEB, 0xEC, 0xEC, 0xC0, 0x9C, 0x5E, 0x74, 
-    0xEB, 0xEC, 0xEC, 0xEC, 0xC0, 0x9C, 0x64, 0x74, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0xC0, 0x9C, 0x64, 0x74, 0xEB, 0xEB, 0xEC, 0xEC, 0xC0, 0x7D, 0x6C, 0x72, 
-    0xEC, 0xEC, 0xEB, 0xED, 0xEE, 0x9D, 0x5F, 0x3D, 0xEB, 0xEC, 0xEB, 0xED, 
-    0xEB, 0x9D, 0x9C, 0x59, 0xA8, 0x93, 0xA8, 0x77, 0xF0, 0x92, 0xCD, 0xD8, 
-    0xA8, 0x93, 0xA8, 0x77, 0xF2, 0xF3, 0x33, 0x79, 0xA8, 0xA7, 0x98, 0x3C, 
-    0xEF, 0xEA, 0x4E, 0x91, 0x98, 0xAF, 0xB1, 0x68, 0xD4, 0xEA, 0x50, 0x96, 
-    0x98, 0xAB, 0xB6, 0x15, 0xEF, 0xF1, 0x4E, 0x96, 0xA8, 0xAF, 0xA6, 0xD7, 
-    0xEF, 0xD5, 0xF0, 0xF6, 0xA8, 0xAF, 0x98, 0x50, 0xEA, 0x33, 0xD6, 0xF1, 
-    0x8E, 0xAB, 0x98, 0x72, 0x74, 0x73, 0x72, 0x9F, 0xAF, 0x89, 0x4E, 0x33, 
-    0xF5, 0x33, 0x67, 0xC4, 0xAF, 0x89, 0x50, 0x33, 0xF2, 0x33, 0x63, 0xC6, 
-    0xB1, 0x8C, 0x4D, 0x33, 0xF5, 0x3A, 0x33, 0xC4, 0xB9, 0xD8, 0x02, 0x33, 
-    0xDF, 0x33, 0xCD, 0xBB, 0xB9, 0xF1, 0xD3, 0x33, 0xCC, 0x52, 0xBA, 0xB4, 
-    0xD1, 0xF5, 0xF5, 0x3A, 0xCC, 0x72, 0x88, 0xB9, 0xD1, 0xF1, 0xD8, 0x73, 
-    0xF1, 0x5B, 0x63, 0xC6, 0xB9, 0xD8, 0x50, 0x9F, 0xF4, 0xD5, 0x99, 0xDB, 
-    0xAE, 0xCC, 0x4D, 0x78, 0xD4, 0xF1, 0x4D, 0x4E, 0xAE, 0xCC, 0xD6, 0xD8, 
-    0xD4, 0xF1, 0x4E, 0x4E, 0xB6, 0x9F, 0x92, 0x3A, 0xD4, 0xF1, 0x4D, 0x4E, 
-    0xBC, 0xCC, 0x4E, 0x50, 0xF4, 0xF1, 0x4A, 0x4E, 0xAE, 0xCC, 0x72, 0xCC, 
-    0xF4, 0xF1, 0x4A, 0x4E, 0xAE, 0xCC, 0xCC, 0x50, 0xF4, 0xF1, 0x4A, 0x4E, 
-    0xB6, 0xCC, 0xCC, 0x50, 0xF5, 0xF1, 0x4A, 0x4E, 0xCD, 0x68, 0x78, 0x78, 
-    0xD4, 0xF1, 0x4A, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4E, 0x4E, 
-    0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x53, 0x4E, 0x31, 0x4E, 0x4E, 0x4E, 0x4E, 
-    0x4E, 0x4E, 0x4A, 0x81, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x32, 0x6B, 0xD0, 
-    0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x32, 0xC9, 0xC0, 0x78, 0x50, 0x4E, 0x4E, 
-    0x53, 0x35, 0xD2, 0xC1, 0xCC, 0x78, 0x4E, 0x4D, 0x6B, 0x90, 0x5A, 0x5A, 
-    0x72, 0x78, 0x4E, 0x4D, 0x81, 0x70, 0x58, 0x58, 0x53, 0x21, 0x64, 0x90, 
-    0x5E, 0x7E, 0x5D, 0x57, 0x80, 0x6E, 0xC9, 0xCB, 0x90, 0x5E, 0x6A, 0x26, 
-    0xC8, 0xC8, 0xED, 0xEB, 0x70, 0x9D, 0xE3, 0x6A, 0xC9, 0x86, 0xD2, 0xC9, 
-    0x5A, 0x5F, 0x5F, 0x7F, 0xE2, 0x8F, 0x87, 0x86, 0x5A, 0x84, 0x84, 0x57, 
-    0x85, 0x71, 0xF4, 0xEF, 0xEE, 0xD2, 0x5A, 0x44, 0x80, 0xDA, 0xF2, 0xED, 
-    0xED, 0xE4, 0xC8, 0x86, 0xD0, 0xF5, 0xEF, 0xF2, 0xED, 0xE4, 0xC8, 0x6D, 
-    0x3F, 0x3E, 0x3E, 0x4A, 0x4D, 0x4E, 0x4D, 0x4D, 0x41, 0x3E, 0x5C, 0x10, 
-    0x4A, 0x4A, 0x4A, 0x4A, 0x43, 0x35, 0x41, 0x43, 0x20, 0x4A, 0x4D, 0x4E, 
-    0x7E, 0x3E, 0x35, 0x5D, 0x22, 0x2E, 0x2E, 0x4D, 0x59, 0x60, 0x20, 0x46, 
-    0x57, 0x3F, 0x42, 0x4A, 0x57, 0x82, 0x57, 0x6F, 0x60, 0x59, 0x3F, 0x4A, 
-    0x57, 0x44, 0x37, 0x59, 0x57, 0x46, 0x46, 0x4A, 0x57, 0x34, 0x35, 0x7F, 
-    0x44, 0x57, 0x46, 0x4D, 0x4E, 0x4D, 0x4A, 0x4A, 0x4A, 0x64, 0x6F, 0x37, 
-    0x4D, 0x4D, 0x4A, 0x4A, 0x4A, 0x64, 0x58, 0x5D, 0x4E, 0x4D, 0x4A, 0x4A, 
-    0x2E, 0x87, 0x71, 0x97, 0x4E, 0x4D, 0x4A, 0x4A, 0x4A, 0x2E, 0x22, 0x90, 
-    0x4E, 0x4D, 0x4A, 0x4A, 0x4A, 0x4A, 0x62, 0x6B, 0x4E, 0x4D, 0x4A, 0x4A, 
-    0x4A, 0x4D, 0x4D, 0x4A, 0x4D, 0x4A, 0x4A, 0x4A, 0x4A, 0x4D, 0x50, 0x72, 
-    0x4E, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4D, 0x50, 0x90, 0x1B, 0x58, 0x5E, 
-    0x3F, 0x47, 0x13, 0x66, 0x97, 0x20, 0x6B, 0x85, 0x43, 0x35, 0x35, 0x57, 
-    0x97, 0x19, 0x58, 0x85, 0x41, 0x3B, 0xE0, 0xC9, 0x5C, 0x13, 0x6B, 0x59, 
-    0xE0, 0xF3, 0xF4, 0xEB, 0x51, 0x2D, 0x81, 0xD9, 0xC6, 0xDB, 0xDA, 0xEB, 
-    0x51, 0x2D, 0xD8, 0xDB, 0xDB, 0xDA, 0xEF, 0xEC, 0x51, 0x2D, 0x3A, 0xDB, 
-    0xF7, 0xDA, 0xEB, 0xC2, 0x4E, 0x62, 0xEA, 0xF5, 0xED, 0xEC, 0xCA, 0x80, 
-    0x9D, 0xBF, 0x6E, 0x86, 0x58, 0x58, 0x6F, 0x57, 0x58, 0x44, 0x44, 0x44, 
-    0x8F, 0x60, 0x60, 0x3F, 0x95, 0x1B, 0x60, 0x5E, 0x9D, 0x9D, 0x6A, 0x60, 
-    0xE9, 0x3F, 0x83, 0xE3, 0x65, 0x6D, 0x57, 0x35, 0xEE, 0x46, 0x83, 0x85, 
-    0x5E, 0x5F, 0x57, 0x35, 0xEF, 0x46, 0x57, 0x44, 0x40, 0x57, 0x26, 0x69, 
-    0xD2, 0x58, 0x57, 0x35, 0x38, 0x1B, 0x3B, 0x41, 0x58, 0x44, 0x57, 0x66, 
-    0x66, 0x6F, 0x44, 0x44, 0x40, 0x35, 0x17, 0x30, 0x34, 0x30, 0x1F, 0x34, 
-    0x3F, 0x35, 0x13, 0x3B, 0x34, 0x30, 0x3B, 0x51, 0x5D, 0x60, 0x3F, 0x17, 
-    0x34, 0x3B, 0x13, 0x51, 0x1B, 0x37, 0x60, 0x26, 0x19, 0x3B, 0x30, 0x1A, 
-    0x35, 0x47, 0x35, 0x47, 0x41, 0x3B, 0x1F, 0x30, 0x69, 0x47, 0x19, 0x13, 
-    0x3B, 0x17, 0x30, 0x1F, 0x54, 0x69, 0x47, 0x51, 0x19, 0x3B, 0x30, 0x1F, 
-    0x38, 0x3B, 0x41, 0x47, 0x47, 0x1A, 0x1F, 0x1F, 0x3B, 0x1A, 0x3B, 0x3B, 
-    0x1F, 0x1F, 0x1F, 0x0C, 0x51, 0x1A, 0x1A, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 
-    0x51, 0x30, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1A, 0x1F, 0x1A, 0x1F, 
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3B, 0x1A, 0x1F, 0x1F, 0x0C, 0x18, 
-    0x30, 0x30, 0x1F, 0x30, 0x1F, 0x0C, 0x0C, 0x18, 0x30, 0x1F, 0x1F, 0x1F, 
-    0x1F, 0x0C, 0x0B, 0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0C, 0x0B, 0x18, 
-    0x1F, 0x51, 0x51, 0x69, 0x64, 0x97, 0x71, 0x13, 0x0C, 0x0C, 0x25, 0x62, 
-    0x47, 0x47, 0x19, 0x51, 0x0C, 0x18, 0x25, 0x51, 0x47, 0x51, 0x47, 0x20, 
-    0x1F, 0x18, 0x0E, 0x51, 0x22, 0x5A, 0x86, 0x64, 0x1F, 0x0C, 0x0C, 0x1E, 
-    0x66, 0x70, 0x71, 0x45, 0x0C, 0x0C, 0x18, 0x0B, 0x6B, 0x70, 0x45, 0x01, 
-    0x0C, 0x0C, 0x0C, 0x0B, 0x0C, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0E, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x1E, 0x0E, 0x0B, 0x01, 0x01, 0x0C, 0x16, 
-    0x1B, 0x37, 0x3F, 0x3F, 0x01, 0x01, 0x0B, 0x16, 0x3E, 0x60, 0x60, 0x60, 
-    0x01, 0x01, 0x0B, 0x0E, 0x1A, 0x17, 0x1A, 0x01, 0x0B, 0x01, 0x0C, 0x0E, 
-    0x0E, 0x0F, 0x0F, 0x01, 0x0E, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1E, 0x01, 
-    0x0E, 0x0B, 0x0E, 0x0F, 0x01, 0x34, 0x13, 0x01, 0x01, 0x01, 0x0C, 0x0E, 
-    0x01, 0x34, 0x13, 0x01, 0x01, 0x01, 0x1E, 0x0B, 0x0B, 0x0F, 0x13, 0x01, 
-    0x3F, 0x42, 0x36, 0x87, 0x36, 0x1E, 0x25, 0x34, 0x60, 0x41, 0x1E, 0x1E, 
-    0x34, 0x1E, 0x25, 0x34, 0x25, 0x34, 0x1E, 0x25, 0x34, 0x1E, 0x34, 0x0F, 
-    0x25, 0x13, 0x1E, 0x25, 0x34, 0x1E, 0x0F, 0x0F, 0x24, 0x13, 0x0B, 0x0C, 
-    0x0F, 0x1E, 0x0E, 0x25, 0x2D, 0x34, 0x0B, 0x01, 0x1E, 0x0B, 0x0F, 0x0E, 
-    0x0E, 0x2E, 0x1E, 0x1E, 0x1E, 0x01, 0x0F, 0x0E, 0x0E, 0x56, 0x1E, 0x10, 
-    0x0F, 0x01, 0x0F, 0x0E, 0x13, 0x37, 0x6C, 0x64, 0x46, 0x25, 0x34, 0x13, 
-    0x25, 0x17, 0x41, 0x42, 0x5D, 0x37, 0x1A, 0x25, 0x01, 0x25, 0x51, 0x13, 
-    0x43, 0x59, 0x71, 0x19, 0x01, 0x01, 0x25, 0x34, 0x35, 0x5A, 0x70, 0x36, 
-    0x1E, 0x0E, 0x25, 0x25, 0x0F, 0x46, 0x86, 0x36, 0x01, 0x2E, 0x23, 0x13, 
-    0x25, 0x34, 0x22, 0x87, 0x01, 0x0B, 0x25, 0x0B, 0x01, 0x25, 0x13, 0x1B, 
-    0x01, 0x01, 0x0B, 0x0E, 0x1E, 0x1E, 0x1F, 0x5A, 0x13, 0x24, 0x13, 0x0E, 
-    0x0C, 0x1F, 0x1F, 0x13, 0x13, 0x13, 0x25, 0x0C, 0x1F, 0x18, 0x0C, 0x1F, 
-    0x2D, 0x13, 0x34, 0x0C, 0x1F, 0x1F, 0x0C, 0x0C, 0x25, 0x13, 0x13, 0x0C, 
-    0x0C, 0x0C, 0x0C, 0x0C, 0x13, 0x13, 0x34, 0x25, 0x0C, 0x45, 0x38, 0x45, 
-    0x19, 0x13, 0x36, 0x1B, 0x40, 0x58, 0x6A, 0x86, 0x17, 0x36, 0x82, 0x5E, 
-    0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x82, 0x60, 0x5D, 0x59, 0x5D, 0x59, 0x5D, 
-    0x34, 0x0E, 0x1F, 0x30, 0x1F, 0x1F, 0x13, 0x13, 0x17, 0x0F, 0x0C, 0x1F, 
-    0x34, 0x13, 0x13, 0x13, 0x0E, 0x0C, 0x0C, 0x1A, 0x23, 0x23, 0x13, 0x13, 
-    0x0C, 0x0C, 0x0B, 0x34, 0x13, 0x17, 0x17, 0x13, 0x45, 0x39, 0x18, 0x18, 
-    0x1F, 0x34, 0x1A, 0x3B, 0x70, 0xC1, 0x6E, 0xC0, 0x80, 0x17, 0x3B, 0x13, 
-    0x9D, 0x9D, 0x9D, 0x9D, 0x7D, 0x70, 0x36, 0x17, 0x5D, 0x7E, 0x7F, 0x7F, 
-    0x5F, 0x97, 0x5F, 0x5F, 0x47, 0x37, 0x83, 0x6D, 0xBF, 0xCA, 0xEB, 0xF2, 
-    0x35, 0x37, 0x59, 0x9D, 0xBF, 0xC8, 0xE4, 0xEB, 0x35, 0x37, 0x6A, 0xE3, 
-    0x9D, 0xC1, 0xC0, 0xC2, 0x47, 0x26, 0x6F, 0x84, 0x85, 0x9C, 0xBF, 0xC1, 
-    0x35, 0x35, 0x44, 0x59, 0x82, 0x85, 0x97, 0x64, 0x51, 0x47, 0x26, 0x1B, 
-    0x1B, 0x37, 0x36, 0x44, 0x0E, 0x34, 0x35, 0x3B, 0x3B, 0x3B, 0x3B, 0x44, 
-    0x61, 0x34, 0x3B, 0x35, 0x35, 0x35, 0x57, 0xE2, 0xF5, 0xDB, 0xDB, 0xF2, 
-    0xCB, 0x90, 0x40, 0x17, 0xF2, 0xF5, 0xF5, 0xF2, 0xD3, 0x86, 0x44, 0x44, 
-    0xEF, 0xEF, 0xED, 0xEF, 0xE8, 0x61, 0x57, 0x7E, 0xCA, 0xE4, 0xC2, 0x66, 
-    0x8F, 0x38, 0x60, 0x84, 0x80, 0x80, 0x71, 0x61, 0x57, 0x57, 0x44, 0x57, 
-    0x38, 0x44, 0x44, 0x38, 0x60, 0x82, 0x44, 0x61, 0x44, 0x38, 0x44, 0x7E, 
-    0x5E, 0x7D, 0x58, 0x39, 0x82, 0x1F, 0x39, 0x7F, 0x65, 0x97, 0x71, 0x0C, 
-    0x6A, 0x6F, 0xC9, 0xF2, 0xF5, 0xF5, 0xF2, 0xEA, 0x7E, 0x8F, 0x46, 0x64, 
-    0xD9, 0xEF, 0xF2, 0xD5, 0x65, 0x6A, 0x5D, 0x7F, 0x64, 0x80, 0x5B, 0x77, 
-    0x83, 0x8F, 0x1B, 0xE2, 0xC1, 0xCB, 0x62, 0x72, 0x59, 0x57, 0x38, 0x44, 
-    0x64, 0x80, 0x31, 0x2E, 0xE3, 0x97, 0x6C, 0x61, 0x85, 0x6D, 0xC2, 0x81, 
-    0xE2, 0x97, 0x64, 0x44, 0x85, 0xBF, 0xC2, 0xD5, 0x8F, 0x70, 0x95, 0x1F, 
-    0x44, 0xE2, 0xE9, 0xE8, 0x2D, 0x4A, 0x4D, 0x4D, 0x4D, 0x4A, 0x4A, 0x4D, 
-    0x2D, 0x4A, 0x4D, 0x4D, 0x4D, 0x4A, 0x4D, 0x4D, 0x4A, 0x4A, 0x4D, 0x4D, 
-    0x4A, 0x4A, 0x4E, 0x50, 0x4A, 0x4A, 0x4D, 0x4D, 0x4A, 0x4A, 0x4D, 0x4D, 
-    0x4A, 0x4A, 0x4A, 0x4D, 0x4D, 0x4A, 0x4D, 0x4D, 0x2D, 0x4A, 0x4D, 0x4E, 
-    0x4D, 0x4A, 0x4D, 0x4D, 0x2D, 0x4A, 0x4D, 0x4E, 0x4D, 0x4A, 0x4A, 0x4A, 
-    0x2D, 0x4A, 0x4D, 0x4E, 0x4D, 0x4A, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4D, 
-    0x4A, 0x4A, 0x2D, 0x2D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4A, 0x69, 0x6B, 
-    0x4E, 0x5B, 0x5B, 0x2E, 0x4D, 0x4A, 0x71, 0x86, 0x4D, 0x80, 0x97, 0x62, 
-    0x51, 0x4A, 0x5B, 0x80, 0x4E, 0x3A, 0xE0, 0x62, 0x4A, 0x2E, 0x62, 0x23, 
-    0x4D, 0x4A, 0x4A, 0x4A, 0x4A, 0x53, 0x4A, 0x2D, 0x4A, 0x4A, 0x4A, 0x4D, 
-    0x53, 0x4D, 0x2E, 0x62, 0x4A, 0x4A, 0x32, 0x32, 0x32, 0x4E, 0x20, 0x42, 
-    0x92, 0xC7, 0x2D, 0x34, 0x77, 0xB9, 0xF0, 0x25, 0xF6, 0xC4, 0x32, 0x31, 
-    0x3A, 0xB9, 0x92, 0x13, 0xF6, 0xC6, 0xD8, 0xE7, 0xD5, 0xB9, 0x92, 0x2D, 
-    0xF1, 0xF7, 0x92, 0xD5, 0xD5, 0xB2, 0xD7, 0x2D, 0x92, 0xDF, 0xF0, 0x33, 
-    0x33, 0xB2, 0xD7, 0x2D, 0x92, 0xC7, 0x4A, 0x25, 0x50, 0xB9, 0x92, 0x25, 
-    0xD6, 0xC7, 0x4E, 0x4A, 0x77, 0xB9, 0x92, 0x2D, 0xF3, 0xC7, 0x68, 0x9E, 
-    0x68, 0xC7, 0x92, 0xD3, 0x2D, 0x2E, 0x4A, 0x2E, 0x53, 0xBD, 0xB6, 0xCC, 
-    0x42, 0xD9, 0xE9, 0xCB, 0xD2, 0xB0, 0xB6, 0x72, 0x63, 0xD6, 0x8A, 0xE8, 
-    0xCB, 0xB2, 0xBD, 0xAD, 0x51, 0x13, 0x13, 0xEA, 0xF5, 0xBD, 0xB9, 0x89, 
-    0x51, 0x51, 0x4E, 0x99, 0xD6, 0xF4, 0xDA, 0x88, 0x51, 0x99, 0x99, 0x34, 
-    0x51, 0xF7, 0xF5, 0xEA, 0x51, 0x74, 0x51, 0x13, 0x41, 0xF5, 0xF5, 0xF4, 
-    0xEA, 0x51, 0x51, 0x63, 0xCB, 0xEF, 0xEA, 0x73, 0x9F, 0x9F, 0xC7, 0xD1, 
-    0xF4, 0xF4, 0xF1, 0xF3, 0x72, 0x92, 0xC6, 0x33, 0xF3, 0xF3, 0x88, 0xDA, 
-    0x72, 0xDF, 0xF7, 0xAD, 0xD1, 0xF3, 0x88, 0xDA, 0x72, 0xD3, 0xF5, 0x76, 
-    0xD1, 0xF3, 0x88, 0xF5, 0x72, 0xD1, 0xF5, 0x68, 0xDF, 0xF3, 0x33, 0xF5, 
-    0xD8, 0xF4, 0xF7, 0x91, 0xD1, 0xD1, 0xF1, 0xDA, 0xF4, 0xDA, 0xF4, 0x9F, 
-    0x99, 0xF5, 0xF5, 0xF5, 0x73, 0xD6, 0xF7, 0x9F, 0x3A, 0xF5, 0xF7, 0xF2, 
-    0x32, 0xF6, 0xD7, 0xB6, 0xAF, 0x68, 0x86, 0x9D, 0xF0, 0x33, 0x67, 0xB6, 
-    0xAF, 0x3A, 0x9D, 0xBF, 0xEA, 0x72, 0x9F, 0xBC, 0xAF, 0xE8, 0x9D, 0x70, 
-    0xF0, 0x9F, 0xD7, 0xB2, 0xB2, 0xD2, 0x97, 0x70, 0xF0, 0x9F, 0x79, 0xD1, 
-    0xD3, 0xC9, 0xC9, 0xC0, 0xF0, 0x9F, 0x91, 0xD1, 0xC9, 0xC9, 0xC9, 0xD2, 
-    0xF0, 0x96, 0x8C, 0xD3, 0x70, 0xC1, 0xC9, 0x70, 0xD6, 0x79, 0xF0, 0xC9, 
-    0x70, 0xC1, 0x70, 0xC9, 0xC0, 0xED, 0xED, 0xEB, 0xEB, 0xEC, 0xED, 0xD4, 
-    0xC0, 0xED, 0xED, 0xEC, 0xEC, 0xEC, 0xEC, 0xD4, 0xEE, 0xED, 0xEB, 0xEB, 
-    0xED, 0xEB, 0xEC, 0xD4, 0xED, 0xEF, 0xEB, 0xED, 0xED, 0xED, 0xED, 0xD4, 
-    0xED, 0xEB, 0xED, 0xED, 0xEB, 0xED, 0xEE, 0xD4, 0xED, 0xED, 0xEF, 0xEF, 
-    0xED, 0xEF, 0xC9, 0xD3, 0xEE, 0xED, 0xED, 0xEC, 0xED, 0xF2, 0xE9, 0xE9, 
-    0xC9, 0xE9, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEE, 0xB0, 0xDF, 0xBD, 0xB1, 
-    0xC5, 0xC5, 0xB0, 0xB3, 0xC5, 0xD4, 0xC7, 0xDF, 0xC7, 0xC5, 0xB0, 0xB3, 
-    0xC5, 0xD4, 0xC5, 0xC7, 0xC7, 0xC5, 0xB0, 0xB3, 0xC5, 0xC7, 0xC5, 0xC7, 
-    0xC7, 0xC5, 0xB0, 0xB3, 0xC5, 0xDF, 0xDF, 0xC4, 0xC7, 0xC5, 0xB0, 0xB3, 
-    0xC5, 0xDF, 0xF7, 0xF7, 0xDF, 0xC7, 0xC5, 0xB0, 0xD4, 0xD4, 0xDF, 0xF7, 
-    0xDA, 0xC4, 0xC5, 0xB0, 0xE9, 0xD4, 0xC7, 0xC6, 0xC6, 0xC5, 0xC5, 0xC5, 
-    0xB6, 0x7B, 0x89, 0x94, 0xA4, 0xB0, 0xAC, 0xC5, 0xB6, 0x89, 0x89, 0x94, 
-    0xA4, 0xB3, 0xAC, 0xB0, 0xB6, 0x91, 0x89, 0x94, 0xA4, 0xB0, 0xB0, 0xC5, 
-    0xB6, 0xA4, 0xA6, 0x8D, 0xA6, 0xB0, 0xC7, 0xC7, 0xB6, 0xA8, 0xBD, 0xBA, 
-    0xB6, 0xB0, 0xC7, 0xC7, 0xB6, 0x94, 0xCD, 0xBB, 0xB6, 0xC5, 0xC5, 0xC5, 
-    0xB6, 0x94, 0xCD, 0xC6, 0xB7, 0xC5, 0xC7, 0xDF, 0xBD, 0xA4, 0xB2, 0xBB, 
-    0xBD, 0xC5, 0xC7, 0xD4, 0xD4, 0xD4, 0xDF, 0xB3, 0xB3, 0xF3, 0xED, 0xEC, 
-    0xC5, 0xD4, 0xDF, 0xB3, 0xB2, 0xDF, 0xED, 0xEC, 0xC5, 0xC7, 0xC7, 0xB3, 
-    0xB2, 0xD4, 0xED, 0xEC, 0xC5, 0xC7, 0xC6, 0xB3, 0xB3, 0xC7, 0xED, 0xED, 
-    0xB0, 0xC7, 0xDB, 0xB2, 0xAA, 0xB2, 0xD4, 0xEB, 0xC5, 0xC5, 0xC6, 0xC4, 
-    0xB3, 0xC5, 0xD9, 0xEE, 0xC5, 0xB0, 0xC4, 0xBE, 0xD1, 0xD9, 0xC2, 0xEE, 
-    0xC7, 0xB0, 0xC4, 0xC3, 0xDF, 0xEE, 0xEB, 0xEB, 0xEB, 0xEC, 0xEB, 0xEC, 
-    0xE4, 0x9D, 0x9C, 0x86, 0xEC, 0xED, 0xEB, 0xED, 0xEE, 0x6E, 0x9D, 0x5E, 
-    0xEC, 0xEB, 0xEC, 0xED, 0xEB, 0xC2, 0x9D, 0x65, 0xED, 0xEB, 0xED, 0xEC, 
-    0xEC, 0xEB, 0xBF, 0x7D, 0xEC, 0xEC, 0xED, 0xEB, 0xED, 0xEE, 0x70, 0xC9, 
-    0xED, 0xED, 0xEC, 0xED, 0xED, 0xEE, 0x70, 0xE4, 0xF2, 0xED, 0xED, 0xEC, 
-    0xED, 0xEE, 0xC0, 0xE9, 0xEE, 0xEE, 0xEE, 0xEF, 0xE9, 0xE9, 0xC9, 0x70, 
-    0xD7, 0xAB, 0x98, 0x78, 0x77, 0x77, 0x73, 0x75, 0xD7, 0xAB, 0xA8, 0x74, 
-    0x77, 0x77, 0x72, 0x75, 0xF0, 0xAB, 0x98, 0x74, 0xCC, 0xD8, 0xF3, 0x76, 
-    0xF3, 0xB1, 0x98, 0x68, 0x79, 0x92, 0xF7, 0x68, 0xD3, 0xB1, 0x98, 0x91, 
-    0xF3, 0xF5, 0xF4, 0x92, 0xD2, 0xD1, 0xB6, 0x96, 0xF0, 0xF2, 0xEF, 0xD4, 
-    0x70, 0xD9, 0xD6, 0x96, 0xF0, 0xF2, 0xF1, 0xD6, 0xC9, 0xC9, 0xD0, 0x54, 
-    0xD5, 0xF2, 0xF3, 0xD6, 0xC4, 0xD8, 0x9F, 0x9E, 0x33, 0x76, 0x9F, 0x3A, 
-    0xC4, 0xD7, 0x9F, 0x9F, 0x9F, 0xAD, 0x72, 0xF1, 0xC4, 0xF0, 0xCC, 0xD8, 
-    0x92, 0x79, 0x33, 0xD4, 0xC4, 0xD7, 0xAD, 0xD1, 0xF4, 0x3A, 0xF4, 0xF5, 
-    0xF7, 0xD7, 0xAD, 0xD1, 0xF2, 0xD3, 0xF5, 0xF5, 0xF7, 0xD6, 0x92, 0xF4, 
-    0xF5, 0xF4, 0xF1, 0xF5, 0xDF, 0xD7, 0xF3, 0xF2, 0xDA, 0xD3, 0x3A, 0xDA, 
-    0xC7, 0xA8, 0xF1, 0xF5, 0xD8, 0x75, 0x88, 0xF5, 0x92, 0xD1, 0x78, 0x78, 
-    0xF4, 0xF1, 0x4A, 0x50, 0xF3, 0x33, 0xCC, 0x78, 0xF4, 0xF1, 0x4D, 0x50, 
-    0xF3, 0xCC, 0x9F, 0x78, 0xD4, 0xF1, 0x4D, 0x78, 0xF1, 0xCC, 0xCC, 0x78, 
-    0xF7, 0xD6, 0x4A, 0x50, 0xD3, 0xF0, 0x77, 0xCC, 0xF7, 0xD6, 0x4E, 0xD6, 
-    0xF2, 0xF2, 0x77, 0xCC, 0xF4, 0xD6, 0x78, 0xF7, 0xF2, 0xEF, 0x77, 0xCC, 
-    0xDF, 0xD6, 0x78, 0xF1, 0xED, 0xF2, 0x78, 0xCC, 0xF7, 0xF1, 0x4E, 0x4D, 
-    0x4E, 0x4E, 0x32, 0x4E, 0x22, 0x87, 0x6C, 0x58, 0x4E, 0x4E, 0x4E, 0x4E, 
-    0x87, 0xBF, 0xBF, 0x58, 0xF6, 0x3A, 0x4E, 0x4E, 0x20, 0x80, 0x97, 0x36, 
-    0xB9, 0x3A, 0x4E, 0x50, 0x4E, 0x63, 0x31, 0x32, 0xD8, 0x73, 0x50, 0x78, 
-    0x78, 0x50, 0x4E, 0x74, 0x3A, 0xCC, 0x50, 0x50, 0x50, 0x78, 0x72, 0x32, 
-    0x33, 0x50, 0x50, 0x78, 0x78, 0x50, 0x78, 0x32, 0x50, 0x72, 0x78, 0x78, 
-    0x78, 0x50, 0x78, 0x50, 0xE0, 0xDA, 0xF5, 0xF2, 0xF2, 0xE9, 0xC0, 0x6D, 
-    0x46, 0x95, 0xED, 0xEB, 0xEE, 0xC8, 0xC1, 0x6D, 0x95, 0x58, 0x6E, 0xBF, 
-    0x6E, 0x64, 0x85, 0x66, 0x95, 0x71, 0x64, 0x5E, 0x57, 0x35, 0x1B, 0x1A, 
-    0x95, 0x40, 0x71, 0x5F, 0x44, 0x34, 0x3B, 0x1B, 0x95, 0x64, 0x80, 0x5F, 
-    0x83, 0x8F, 0x44, 0x7E, 0x87, 0xC8, 0xCA, 0xC1, 0x7E, 0x82, 0x5E, 0x6D, 
-    0x87, 0xC2, 0xE4, 0x80, 0x66, 0xEE, 0xCA, 0x6D, 0x58, 0x34, 0x35, 0x82, 
-    0x44, 0x1B, 0x59, 0x62, 0x40, 0x34, 0x35, 0x82, 0x1B, 0x19, 0x7E, 0x23, 
-    0x1F, 0x3B, 0x3E, 0x7F, 0x45, 0x1B, 0x7F, 0x16, 0x17, 0x38, 0x6C, 0x58, 
-    0x16, 0x26, 0x6C, 0x16, 0x59, 0x60, 0x87, 0x1B, 0x41, 0x42, 0x2E, 0x4A, 
-    0x65, 0x58, 0x17, 0x34, 0x26, 0x41, 0x4A, 0x4D, 0xE3, 0x57, 0x34, 0x2D, 
-    0x2E, 0x2E, 0x4A, 0x4A, 0xE3, 0x3F, 0x3B, 0x13, 0x51, 0x4D, 0x4A, 0x4A, 
-    0x50, 0x4D, 0x4A, 0x4A, 0x4A, 0x4A, 0x4D, 0x50, 0x4E, 0x53, 0x4A, 0x4D, 
-    0x4A, 0x4A, 0x4D, 0x4E, 0x4E, 0x4A, 0x4A, 0x4D, 0x4A, 0x4A, 0x4A, 0x51, 
-    0x4D, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4E, 0x50, 0x4A, 0x4A, 0x56, 0x4A, 
-    0x4A, 0x4D, 0x50, 0x72, 0x4D, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4E, 0x51, 
-    0x4D, 0x4A, 0x4A, 0x4A, 0x4D, 0x4A, 0x4A, 0x54, 0x4A, 0x4A, 0x56, 0x4A, 
-    0x4A, 0x62, 0x5C, 0x64, 0x4A, 0xD5, 0xF5, 0xF2, 0xF5, 0xED, 0x80, 0x39, 
-    0x4A, 0xD5, 0xED, 0xE7, 0x87, 0x58, 0x57, 0x1B, 0x2D, 0x63, 0xF4, 0x80, 
-    0x8F, 0x8F, 0x44, 0x71, 0x62, 0x3E, 0x46, 0x6C, 0x8F, 0x38, 0x38, 0xE8, 
-    0x3D, 0x5F, 0x5F, 0x5F, 0x57, 0x3B, 0x39, 0xF4, 0x69, 0x86, 0x58, 0x37, 
-    0x40, 0x3B, 0x21, 0xE9, 0x70, 0x86, 0x8F, 0x5D, 0x86, 0x38, 0x39, 0xE9, 
-    0xC1, 0x64, 0xE2, 0x6D, 0x97, 0x60, 0x38, 0x21, 0x61, 0x61, 0x80, 0xE4, 
-    0xE4, 0xC0, 0x86, 0x5A, 0x5B, 0xD9, 0xEF, 0xF2, 0xED, 0xE4, 0xCA, 0xC1, 
-    0xE9, 0xDA, 0xDB, 0xDB, 0xF5, 0xE4, 0xCA, 0xC1, 0xF5, 0xDB, 0xC3, 0xDB, 
-    0xF2, 0xEB, 0xCA, 0xC1, 0xDB, 0xC3, 0xDB, 0xF5, 0xEF, 0xC2, 0xC8, 0xBF, 
-    0xF2, 0xF5, 0xF2, 0xEB, 0xE4, 0xC8, 0x70, 0x9D, 0xED, 0xEB, 0xEB, 0xEE, 
-    0xEE, 0xC0, 0x9D, 0x5F, 0x80, 0xBF, 0x9D, 0x97, 0x97, 0x5E, 0x85, 0x58, 
-    0x61, 0x35, 0x41, 0x47, 0x51, 0x1F, 0x30, 0x1F, 0x5E, 0x45, 0x1A, 0x19, 
-    0x13, 0x1F, 0x30, 0x30, 0x9C, 0x37, 0x26, 0x35, 0x3B, 0x1F, 0x1F, 0x30, 
-    0x5F, 0x3E, 0x43, 0x35, 0x34, 0x13, 0x13, 0x1F, 0xE3, 0x44, 0x43, 0x19, 
-    0x34, 0x2E, 0x62, 0x17, 0x85, 0x37, 0x42, 0x19, 0x13, 0x10, 0x10, 0x1A, 
-    0x82, 0x1B, 0x19, 0x1A, 0x1A, 0x13, 0x0E, 0x1F, 0x57, 0x17, 0x1F, 0x30, 
-    0x1F, 0x1F, 0x1F, 0x30, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0C, 0x0C, 0x0C, 
-    0x30, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x0C, 0x0C, 0x30, 0x1F, 0x1F, 0x1F, 
-    0x1F, 0x0C, 0x0B, 0x0B, 0x1F, 0x30, 0x1F, 0x1F, 0x0C, 0x0C, 0x0E, 0x0C, 
-    0x1F, 0x30, 0x30, 0x1F, 0x0C, 0x34, 0x10, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 
-    0x1F, 0x34, 0x0F, 0x0E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0C, 0x0C, 
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0C, 0x0C, 0x0B, 0x18, 0x18, 
-    0x0B, 0x01, 0x01, 0x01, 0x18, 0x0B, 0x0B, 0x18, 0x18, 0x01, 0x01, 0x01, 
-    0x18, 0x18, 0x0B, 0x0B, 0x18, 0x0B, 0x01, 0x01, 0x0B, 0x18, 0x18, 0x0B, 
-    0x0B, 0x01, 0x01, 0x01, 0x0B, 0x18, 0x18, 0x0B, 0x18, 0x01, 0x01, 0x01, 
-    0x18, 0x0B, 0x0B, 0x0B, 0x18, 0x86, 0x64, 0x86, 0x18, 0x0B, 0x18, 0x46, 
-    0x58, 0x5E, 0x65, 0x65, 0x0B, 0x36, 0x64, 0x7D, 0x7D, 0x65, 0x5F, 0x5E, 
-    0x01, 0x01, 0x01, 0x0B, 0x0F, 0x0B, 0x0E, 0x0B, 0x01, 0x01, 0x01, 0x0B, 
-    0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x1E, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x1E, 0x0E, 0x0B, 0x0E, 0x0E, 0x1E, 
-    0x0E, 0x0E, 0x01, 0x0E, 0x0E, 0x1E, 0x0C, 0x0E, 0x0E, 0x25, 0x01, 0x0B, 
-    0x25, 0x0C, 0x0B, 0x0E, 0x0E, 0x0C, 0x0B, 0x0E, 0x25, 0x0B, 0x01, 0x25, 
-    0x0C, 0x0C, 0x0B, 0x0E, 0x0B, 0x0C, 0x0C, 0x25, 0x01, 0x01, 0x0B, 0x1E, 
-    0x0B, 0x0E, 0x0B, 0x0E, 0x01, 0x01, 0x0E, 0x1E, 0x24, 0x0E, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0F, 0x0B, 0x01, 0x01, 0x1E, 0x25, 0x0B, 0x0E, 
-    0x0E, 0x01, 0x0F, 0x25, 0x1E, 0x1E, 0x0B, 0x0B, 0x0B, 0x01, 0x0E, 0x1E, 
-    0x13, 0x1E, 0x1E, 0x10, 0x0E, 0x0B, 0x25, 0x1E, 0x2E, 0x0B, 0x0B, 0x2E, 
-    0x1E, 0x0E, 0x34, 0x0B, 0x2E, 0x1E, 0x01, 0x0E, 0x0B, 0x0B, 0x0C, 0x1E, 
-    0x2E, 0x1E, 0x01, 0x1E, 0x1E, 0x0B, 0x0B, 0x1E, 0x0E, 0x0B, 0x0F, 0x10, 
-    0x01, 0x01, 0x0B, 0x01, 0x25, 0x0B, 0x0B, 0x25, 0x0B, 0x0B, 0x0B, 0x0B, 
-    0x01, 0x1E, 0x0E, 0x0E, 0x0E, 0x40, 0x59, 0x59, 0x0B, 0x0F, 0x1E, 0x21, 
-    0x5C, 0x5D, 0x5D, 0x3E, 0x0E, 0x0E, 0x0F, 0x26, 0x3E, 0x43, 0x41, 0x47, 
-    0x01, 0x0B, 0x3D, 0x47, 0x47, 0x51, 0x25, 0x34, 0x0B, 0x25, 0x23, 0x13, 
-    0x0E, 0x0E, 0x19, 0x26, 0x10, 0x10, 0x34, 0x0E, 0x1F, 0x17, 0x26, 0x26, 
-    0x2E, 0x10, 0x0E, 0x0E, 0x19, 0x19, 0x1A, 0x34, 0x0E, 0x25, 0x0E, 0x0E, 
-    0x0E, 0x0C, 0x1E, 0x0B, 0x59, 0x3F, 0x35, 0x42, 0x5D, 0x3E, 0x3E, 0x42, 
-    0x35, 0x47, 0x13, 0x19, 0x41, 0x19, 0x17, 0x19, 0x34, 0x25, 0x25, 0x25, 
-    0x34, 0x34, 0x34, 0x1A, 0x34, 0x0F, 0x1A, 0x17, 0x17, 0x0E, 0x1E, 0x1E, 
-    0x20, 0x41, 0x69, 0x69, 0x69, 0x26, 0x38, 0x22, 0x13, 0x23, 0x47, 0x19, 
-    0x41, 0x42, 0x5D, 0x6C, 0x25, 0x25, 0x0F, 0x0E, 0x1A, 0x43, 0x3F, 0x60, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x19, 0x26, 0x42, 0x3F, 0xE2, 0x85, 
-    0x85, 0x65, 0x9C, 0x9C, 0x19, 0x26, 0x59, 0x6F, 0x7E, 0x7F, 0x7F, 0x65, 
-    0x19, 0x3B, 0x35, 0x26, 0x60, 0x83, 0x7E, 0x7F, 0x0C, 0x1F, 0x13, 0x47, 
-    0x43, 0x60, 0x7E, 0x7E, 0x21, 0x18, 0x0F, 0x19, 0x41, 0x43, 0x37, 0x3E, 
-    0x3F, 0x38, 0x25, 0x3B, 0x41, 0x47, 0x41, 0x35, 0x60, 0x58, 0x40, 0x39, 
-    0x25, 0x3B, 0x43, 0x35, 0x3F, 0x7F, 0x7D, 0x5D, 0x25, 0x1F, 0x47, 0x35, 
-    0x82, 0x1B, 0x0E, 0x3B, 0x3B, 0x35, 0x6F, 0x65, 0x9C, 0x7D, 0x5D, 0x34, 
-    0x47, 0x37, 0x5A, 0x7D, 0x9A, 0x9C, 0x64, 0x45, 0x17, 0x1B, 0x64, 0x90, 
-    0x7E, 0xE3, 0x7D, 0x97, 0x86, 0x44, 0x64, 0x80, 0x6A, 0x7E, 0x65, 0x6D, 
-    0xBF, 0x57, 0x6C, 0x80, 0x83, 0x7F, 0x7F, 0x85, 0xC1, 0x6E, 0x64, 0x86, 
-    0x3F, 0x6A, 0x7E, 0x85, 0x6D, 0xC1, 0xC8, 0x6E, 0x41, 0x43, 0x3F, 0x7E, 
-    0x5E, 0xBF, 0xC8, 0x6E, 0xE2, 0x1F, 0x30, 0x82, 0x5F, 0x70, 0x71, 0x0C, 
-    0x82, 0x1F, 0x1F, 0x6A, 0x5E, 0x70, 0x6B, 0x0C, 0x57, 0x0C, 0x0E, 0x40, 
-    0x5A, 0x70, 0x6B, 0x0B, 0x18, 0x1E, 0x1E, 0x39, 0x5A, 0xC9, 0x71, 0x0B, 
-    0x18, 0x1E, 0x01, 0x21, 0x5A, 0xC9, 0x6B, 0x1E, 0x0C, 0x0B, 0x01, 0x0C, 
-    0x5A, 0xC9, 0x6B, 0x0B, 0x0C, 0x1E, 0x01, 0x18, 0x5A, 0xC9, 0x6B, 0x0B, 
-    0x18, 0x0B, 0x0B, 0x18, 0x5A, 0x70, 0x36, 0x25, 0x8F, 0x70, 0xE8, 0x1E, 
-    0x17, 0xE2, 0xEE, 0xE8, 0x6F, 0x70, 0xE8, 0x25, 0x38, 0xDD, 0xEE, 0xD5, 
-    0xDC, 0xC9, 0x80, 0x25, 0x17, 0x7F, 0xEE, 0xE8, 0xDC, 0xC9, 0x80, 0x25, 
-    0x44, 0xE3, 0xEB, 0xE8, 0x6F, 0xC9, 0x81, 0x30, 0x7E, 0x9B, 0xEB, 0xD5, 
-    0x6F, 0xC9, 0x81, 0x1F, 0x84, 0x9B, 0xEB, 0xE8, 0xE1, 0xC9, 0x80, 0x0C, 
-    0x83, 0x9C, 0xEB, 0xE7, 0x6F, 0xC9, 0x81, 0x1F, 0x84, 0x9B, 0xEE, 0xD2, 
-    0x2D, 0x4A, 0x4D, 0x4E, 0x4D, 0x4D, 0x50, 0x4E, 0x2D, 0x4A, 0x4D, 0x4E, 
-    0x4D, 0x4A, 0x50, 0x50, 0x2D, 0x4A, 0x4D, 0x4E, 0x4D, 0x4A, 0x50, 0x32, 
-    0x2D, 0x4A, 0x4D, 0x4E, 0x4D, 0x53, 0x50, 0x50, 0x2D, 0x4A, 0x4D, 0x50, 
-    0x4D, 0x4D, 0x50, 0x50, 0x25, 0x4A, 0x4D, 0x53, 0x4A, 0x2E, 0x32, 0x4E, 
-    0x5C, 0x20, 0x42, 0x82, 0x86, 0x6C, 0x3E, 0x3D, 0x70, 0x87, 0x5A, 0x9C, 
-    0x9B, 0x9B, 0x64, 0xD0, 0x4A, 0x4D, 0x32, 0x77, 0x50, 0x50, 0x50, 0x4A, 
-    0x4A, 0x4D, 0x4D, 0x3A, 0xD8, 0x50, 0x50, 0x51, 0x4A, 0x4D, 0x4A, 0xF0, 
-    0xD4, 0x53, 0x50, 0x51, 0x4A, 0x4A, 0x4D, 0xF0, 0xEF, 0x50, 0x50, 0xD0, 
-    0x4A, 0x2D, 0x2D, 0xF0, 0xF4, 0x50, 0xCC, 0xD3, 0x4A, 0xEA, 0xD3, 0xD4, 
-    0xD3, 0x2E, 0x32, 0xD0, 0xEA, 0xF5, 0xF5, 0xED, 0xEE, 0xF1, 0x95, 0x5E, 
-    0xD9, 0xC9, 0x97, 0x97, 0xEE, 0xF2, 0xC9, 0xE9, 0x92, 0xC5, 0x76, 0x9F, 
-    0x75, 0xC4, 0xF1, 0xEE, 0xD7, 0xAC, 0x67, 0x52, 0x75, 0xF7, 0xF3, 0xD3, 
-    0xD7, 0xC5, 0x99, 0xCC, 0x76, 0xF7, 0xF3, 0xD3, 0xF4, 0xEF, 0x54, 0x52, 
-    0x33, 0xF7, 0xF1, 0xD3, 0xF2, 0xEF, 0x95, 0x63, 0x3C, 0xF2, 0xD3, 0xF4, 
-    0xD9, 0xEF, 0x46, 0x47, 0x68, 0xF2, 0xED, 0xF2, 0xE9, 0xF5, 0x22, 0x62, 
-    0x33, 0xF5, 0xED, 0xED, 0xEF, 0xF5, 0xF4, 0xF5, 0xEF, 0xE9, 0xEF, 0xF2, 
-    0xEA, 0x51, 0x51, 0x5B, 0xEC, 0xCA, 0x81, 0x94, 0xEA, 0x51, 0x51, 0x73, 
-    0x3A, 0xD9, 0xE7, 0xBC, 0xEA, 0x8A, 0x92, 0xCC, 0x79, 0x88, 0x33, 0xD1, 
-    0xEA, 0xF0, 0xD1, 0x4E, 0x51, 0x51, 0x51, 0xF4, 0xEA, 0xCE, 0xD1, 0x79, 
-    0x89, 0x89, 0x68, 0xF4, 0xEA, 0xD5, 0xD1, 0xB9, 0xC7, 0xC7, 0xD6, 0xEA, 
-    0xF2, 0xEF, 0xF4, 0xF2, 0xF2, 0xF5, 0xEF, 0xD9, 0xEF, 0xEE, 0xF2, 0xED, 
-    0xED, 0xF2, 0xEE, 0xF2, 0x94, 0xCD, 0xDA, 0x75, 0x75, 0xD6, 0xC4, 0xF2, 
-    0xA3, 0xB4, 0xF4, 0x67, 0x75, 0xCD, 0xDF, 0xF2, 0xF4, 0xF4, 0xD1, 0xCD, 
-    0xD1, 0xA4, 0xC5, 0xF5, 0xED, 0xEF, 0xF6, 0xBD, 0xC6, 0xBD, 0xC7, 0xF5, 
-    0xF2, 0xF5, 0xF6, 0xBD, 0xC6, 0xC7, 0xF7, 0xF5, 0xD3, 0xF5, 0xDF, 0xD4, 
-    0xF5, 0xF4, 0xF4, 0xF5, 0xF4, 0xF2, 0xF2, 0xF2, 0xED, 0xF2, 0xEF, 0xF2, 
-    0xED, 0xF2, 0xED, 0xED, 0xEE, 0xF2, 0xED, 0xED, 0xF4, 0xD2, 0x70, 0xC1, 
-    0xC9, 0xD9, 0xC9, 0xEE, 0xEF, 0xC9, 0x70, 0x70, 0xC9, 0xE9, 0xC9, 0xE9, 
-    0xF4, 0xCB, 0xC9, 0xC9, 0xEE, 0xEF, 0xEF, 0xF2, 0xF4, 0xEE, 0xEF, 0xEE, 
-    0xEF, 0xF5, 0xF5, 0xF5, 0xEF, 0xEE, 0xF2, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 
-    0xEF, 0xEE, 0xF5, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xF2, 0xEB, 0xF2, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 
-    0xE9, 0xC9, 0xE9, 0xE9, 0xC9, 0xD9, 0xEF, 0xEF, 0xC9, 0xD9, 0xEE, 0xD9, 
-    0xD9, 0xEE, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xC9, 0xEF, 0xEF, 0xEE, 0xE9, 
-    0xF2, 0xEB, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0xEF, 0xF5, 0xF2, 
-    0xEF, 0xF5, 0xF5, 0xEF, 0xDA, 0xEF, 0xDA, 0xF5, 0xEF, 0xF5, 0xF5, 0xEF, 
-    0xF5, 0xEF, 0xF5, 0xF2, 0xEF, 0xEF, 0xF2, 0xEF, 0xED, 0xED, 0xED, 0xF2, 
-    0xED, 0xF2, 0xF2, 0xED, 0xE9, 0xD4, 0xC5, 0xC7, 0xDF, 0xC5, 0xB2, 0xDF, 
-    0xE9, 0xF4, 0xC7, 0xC7, 0xC7, 0xC5, 0xC5, 0xF7, 0xE9, 0xF4, 0xC7, 0xC5, 
-    0xC5, 0xF7, 0xF4, 0xF4, 0xEF, 0xF2, 0xF7, 0xDF, 0xD4, 0xF7, 0xF7, 0xD4, 
-    0xEF, 0xEF, 0xF2, 0xF5, 0xF2, 0xEF, 0xF2, 0xF5, 0xEF, 0xEF, 0xF2, 0xF2, 
-    0xF2, 0xEF, 0xEF, 0xF5, 0xED, 0xED, 0xEF, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 
-    0xED, 0xF2, 0xF2, 0xF2, 0xF2, 0xED, 0xF2, 0xF2, 0xB2, 0xBD, 0xBD, 0xB3, 
-    0xC7, 0xDF, 0xC5, 0xDF, 0xF7, 0xF7, 0xC5, 0xAC, 0xDF, 0xF2, 0xDF, 0xF7, 
-    0xF2, 0xF5, 0xC7, 0xA9, 0xC5, 0xF5, 0xF5, 0xF5, 0xDF, 0xDF, 0xC7, 0xAA, 
-    0xC5, 0xF7, 0xF5, 0xF5, 0xF7, 0xC6, 0xC7, 0xB2, 0xF7, 0xF4, 0xF5, 0xF5, 
-    0xF5, 0xF7, 0xF7, 0xF2, 0xF5, 0xF4, 0xF2, 0xF5, 0xED, 0xF2, 0xF2, 0xED, 
-    0xF2, 0xEF, 0xF2, 0xF5, 0xED, 0xED, 0xED, 0xF2, 0xF2, 0xED, 0xED, 0xF2, 
-    0xC7, 0xC5, 0xC4, 0xC3, 0xD3, 0xEE, 0xF2, 0xEB, 0xF7, 0xC5, 0xC4, 0xC3, 
-    0xF4, 0xE9, 0xEE, 0xEE, 0xDA, 0xDF, 0xC7, 0xC6, 0xF4, 0xEE, 0xEE, 0xEE, 
-    0xF7, 0xF7, 0xD4, 0xD4, 0xF7, 0xEF, 0xEF, 0xEF, 0xDA, 0xDA, 0xDA, 0xD4, 
-    0xF5, 0xEF, 0xEF, 0xF2, 0xDB, 0xDA, 0xF7, 0xF4, 0xF5, 0xEF, 0xEF, 0xEF, 
-    0xDA, 0xDA, 0xF4, 0xF4, 0xDA, 0xEF, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 
-    0xF5, 0xF2, 0xF2, 0xF2, 0xE9, 0xD9, 0xE9, 0xE9, 0xC9, 0xEE, 0xEE, 0xE9, 
-    0xE9, 0xE9, 0xD9, 0xE9, 0xC9, 0xE9, 0xE9, 0xE9, 0xEE, 0xE9, 0xC9, 0xC9, 
-    0xE9, 0xEF, 0xF2, 0xF2, 0xF5, 0xEF, 0xEE, 0xEF, 0xEF, 0xF5, 0xF5, 0xF5, 
-    0xEF, 0xEF, 0xF5, 0xEF, 0xF5, 0xDA, 0xDA, 0xDA, 0xEF, 0xF5, 0xF5, 0xEF, 
-    0xEF, 0xDA, 0xDA, 0xDA, 0xEF, 0xF5, 0xF2, 0xEF, 0xEF, 0xF2, 0xF2, 0xF5, 
-    0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xED, 0xED, 0xED, 0xE9, 0x70, 0x70, 0x90, 
-    0xE8, 0xF5, 0xF1, 0xD6, 0xE9, 0xC9, 0x70, 0x70, 0xD9, 0xF5, 0xF4, 0xDF, 
-    0xF2, 0xE9, 0xC9, 0x70, 0xEE, 0xF2, 0xDA, 0xC6, 0xF2, 0xEE, 0xEF, 0xD9, 
-    0xEE, 0xD3, 0xEA, 0xDB, 0xDA, 0xDA, 0xF5, 0xF2, 0xEB, 0xD3, 0xCE, 0xD1, 
-    0xDA, 0xDA, 0xDA, 0xEF, 0xEF, 0xF4, 0xD6, 0xF3, 0xF5, 0xF5, 0xF5, 0xF2, 
-    0xEF, 0xEF, 0xF2, 0xF2, 0xED, 0xED, 0xED, 0xF2, 0xED, 0xED, 0xED, 0xED, 
-    0xDF, 0xA8, 0xF3, 0xF4, 0xCC, 0x51, 0x88, 0xF5, 0xC4, 0x8E, 0xD6, 0xF4, 
-    0x92, 0x92, 0xF1, 0xF5, 0xA8, 0x96, 0xD6, 0xF5, 0xDA, 0xDA, 0xF2, 0xF5, 
-    0xA4, 0x96, 0xD6, 0xF5, 0x3A, 0xD8, 0xF4, 0xF2, 0xA8, 0x96, 0xF6, 0xD3, 
-    0x3D, 0x99, 0xF3, 0xF2, 0xD1, 0xDF, 0xEF, 0xEF, 0xD3, 0xD3, 0xEB, 0xF2, 
-    0xF2, 0xF2, 0xED, 0xF2, 0xF5, 0xF2, 0xED, 0xED, 0xEF, 0xF2, 0xED, 0xF2, 
-    0xEF, 0xCB, 0xF2, 0xED, 0xEF, 0xF3, 0xCC, 0x50, 0xC6, 0xF1, 0x53, 0x32, 
-    0x92, 0xCC, 0xCC, 0x74, 0xDF, 0xF1, 0xDF, 0xEA, 0xD6, 0x9F, 0xCC, 0x77, 
-    0xDF, 0xF1, 0xF3, 0xD5, 0xD6, 0xAD, 0x50, 0x50, 0xF7, 0x92, 0xCC, 0xCC, 
-    0xD6, 0xAD, 0x75, 0xF0, 0xF7, 0x92, 0x72, 0xCC, 0xF6, 0xAD, 0x99, 0xEA, 
-    0xF4, 0xF4, 0xCF, 0x72, 0xF4, 0xF3, 0xD3, 0xE7, 0xEF, 0xF2, 0xD9, 0xD0, 
-    0xED, 0xF2, 0xF2, 0xED, 0xED, 0xED, 0xF2, 0xF2, 0x32, 0x72, 0x78, 0x32, 
-    0x78, 0x32, 0x50, 0x50, 0x60, 0x69, 0x50, 0x78, 0x78, 0x32, 0x63, 0x99, 
-    0x46, 0x3D, 0x50, 0x74, 0x50, 0x74, 0xE0, 0x54, 0x50, 0x50, 0x78, 0x32, 
-    0x31, 0xD5, 0xE0, 0x3D, 0x50, 0x4E, 0x72, 0x50, 0x3A, 0xE7, 0x54, 0x3D, 
-    0xEA, 0xE8, 0x63, 0x51, 0x54, 0xE0, 0x69, 0x47, 0xEF, 0xEF, 0xD9, 0xD0, 
-    0xD9, 0xD9, 0x90, 0x5E, 0xF2, 0xF2, 0xF2, 0x70, 0xC9, 0xEE, 0x70, 0x70, 
-    0xE0, 0xC2, 0xE6, 0x80, 0x57, 0xEC, 0xE4, 0xE3, 0x54, 0xE8, 0xE5, 0xC0, 
-    0x8F, 0xEB, 0xE4, 0x6D, 0x3D, 0x23, 0x5B, 0x97, 0xE2, 0xEE, 0xE4, 0x6D, 
-    0x51, 0x51, 0x22, 0xBF, 0x5E, 0x90, 0x5F, 0x5E, 0x51, 0x51, 0x69, 0xBF, 
-    0xE2, 0x35, 0x47, 0x3B, 0x23, 0x51, 0x22, 0xC1, 0x86, 0x13, 0x13, 0x34, 
-    0x6C, 0x5A, 0x64, 0x9D, 0xE2, 0x57, 0x57, 0x57, 0x70, 0x65, 0xBF, 0xC1, 
-    0xBF, 0xBF, 0x9D, 0x6D, 0x9A, 0x60, 0x3B, 0x13, 0x4A, 0x4A, 0x4A, 0x4A, 
-    0xDD, 0x60, 0x47, 0x51, 0x4A, 0x4A, 0x4D, 0x4D, 0x85, 0x83, 0x43, 0x47, 
-    0x2E, 0x4A, 0x4A, 0x4E, 0x5F, 0x7D, 0x3E, 0x3B, 0x4A, 0x4A, 0x4A, 0x4E, 
-    0x86, 0x97, 0x3E, 0x51, 0x4A, 0x4A, 0x4A, 0x4E, 0x6C, 0x97, 0x3E, 0x47, 
-    0x34, 0x2E, 0x4A, 0x4E, 0x64, 0x97, 0x7E, 0x7E, 0xE2, 0x5A, 0x26, 0xE0, 
-    0xD2, 0x97, 0xE3, 0x9B, 0x9B, 0x85, 0x87, 0x70, 0x4D, 0x4A, 0x2E, 0x4A, 
-    0x2D, 0x87, 0x97, 0x85, 0x50, 0x4D, 0x4A, 0x4A, 0x5B, 0x90, 0x9D, 0x7E, 
-    0x50, 0x4D, 0x2D, 0x17, 0x70, 0xC1, 0x5F, 0x58, 0x78, 0x4A, 0x10, 0x95, 
-    0x70, 0x5F, 0x7E, 0x58, 0x72, 0x4A, 0x17, 0xBF, 0xC1, 0xE3, 0x7F, 0x59, 
-    0xCC, 0x4A, 0x22, 0x97, 0xBF, 0xE2, 0x84, 0x83, 0x87, 0x58, 0x70, 0xC1, 
-    0x6D, 0xE2, 0x83, 0x60, 0x5F, 0x70, 0xC2, 0xC1, 0x97, 0xE2, 0x83, 0x45, 
-    0x84, 0x84, 0x5E, 0x46, 0x36, 0x3F, 0x37, 0x17, 0x8F, 0x6A, 0x82, 0x57, 
-    0x3B, 0x37, 0x3F, 0x16, 0x7E, 0x7E, 0x84, 0x44, 0x34, 0x1B, 0x57, 0x1A, 
-    0x7F, 0x6F, 0x17, 0x13, 0x20, 0x37, 0x57, 0x26, 0x6F, 0x1B, 0x19, 0x17, 
-    0x3F, 0x37, 0x37, 0x35, 0x6F, 0x17, 0x47, 0x26, 0x3F, 0x35, 0x17, 0x1A, 
-    0x44, 0x30, 0x38, 0x5D, 0x3F, 0x1A, 0x34, 0x13, 0x1E, 0x26, 0x5D, 0x57, 
-    0x1B, 0x0E, 0x25, 0x0E, 0x5D, 0x5E, 0xE2, 0x5A, 0x5A, 0x58, 0x59, 0x57, 
-    0x10, 0x46, 0x57, 0x57, 0x57, 0x44, 0x35, 0x3B, 0x17, 0x3F, 0x6A, 0x58, 
-    0x58, 0x37, 0x3B, 0x34, 0x13, 0x1A, 0x13, 0x13, 0x34, 0x34, 0x1A, 0x3B, 
-    0x1F, 0x1A, 0x34, 0x1A, 0x3B, 0x34, 0x0E, 0x17, 0x1F, 0x1F, 0x1F, 0x0C, 
-    0x0F, 0x1A, 0x34, 0x34, 0x34, 0x0E, 0x1F, 0x25, 0x0F, 0x1A, 0x34, 0x0E, 
-    0x0E, 0x1F, 0x1F, 0x0C, 0x1A, 0x0E, 0x0C, 0x39, 0x17, 0x3B, 0x3B, 0x1F, 
-    0x1F, 0x30, 0x1F, 0x1F, 0x1A, 0x3B, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 
-    0x1F, 0x34, 0x3B, 0x34, 0x1F, 0x1F, 0x30, 0x1F, 0x3B, 0x1F, 0x25, 0x25, 
-    0x0C, 0x1F, 0x1F, 0x1F, 0x3B, 0x34, 0x45, 0x40, 0x39, 0x0C, 0x30, 0x1F, 
-    0x1F, 0x38, 0x59, 0x82, 0x46, 0x0C, 0x1F, 0x1F, 0x6A, 0x82, 0x59, 0x3E, 
-    0x21, 0x0E, 0x1F, 0x1F, 0x7E, 0x6A, 0x43, 0x17, 0x0C, 0x1F, 0x0C, 0x1F, 
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x25, 0x1F, 0x1F, 0x1F, 0x1F, 
-    0x1F, 0x0C, 0x18, 0x40, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0B, 0x46, 0x7D, 
-    0x1F, 0x1F, 0x1F, 0x1F, 0x0B, 0x66, 0x6E, 0x9C, 0x1F, 0x18, 0x1F, 0x1F, 
-    0x45, 0x86, 0x97, 0x85, 0x1F, 0x30, 0x1F, 0x39, 0x64, 0x5F, 0xE2, 0x60, 
-    0x18, 0x1F, 0x0C, 0x5A, 0x9D, 0x82, 0x3F, 0x43, 0x1F, 0x18, 0x39, 0x64, 
-    0x9C, 0x58, 0x43, 0x35, 0x46, 0xE2, 0x7D, 0x9B, 0x65, 0x7F, 0x85, 0xE2, 
-    0x5F, 0x9C, 0x9C, 0x9B, 0xE3, 0x83, 0x57, 0x57, 0x5F, 0x85, 0x5E, 0x59, 
-    0x3E, 0x26, 0x47, 0x13, 0x65, 0x82, 0x5D, 0x35, 0x17, 0x25, 0x2D, 0x34, 
-    0x59, 0x42, 0x35, 0x25, 0x34, 0x25, 0x2E, 0x51, 0x5D, 0x26, 0x34, 0x34, 
-    0x25, 0x25, 0x23, 0x51, 0x41, 0x1F, 0x25, 0x0E, 0x0B, 0x0C, 0x10, 0x23, 
-    0x34, 0x25, 0x25, 0x0B, 0x0C, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-};
-
-const unsigned short GBA_Metroid_Title_Screen_palette [] = {
-    0x7c1f, 0x0801, 0x0c61, 0x0c60, 0x0c40, 0x0ac5, 0x0b4b, 0x0bae, 0x0e43, 
-    0x0cc1, 0x0ca0, 0x0c02, 0x1002, 0x1142, 0x1402, 0x1422, 0x1c23, 0x0b27, 
-    0x1502, 0x2002, 0x0b69, 0x19a3, 0x1824, 0x1c04, 0x1003, 0x2024, 0x1803, 
-    0x2008, 0x11c2, 0x1121, 0x1001, 0x1403, 0x2445, 0x1825, 0x2068, 0x2043, 
-    0x1421, 0x1401, 0x2847, 0x07fd, 0x07f6, 0x07f2, 0x07fb, 0x07ef, 0x10e1, 
-    0x1821, 0x1c42, 0x07eb, 0x1804, 0x1ca5, 0x2482, 0x2d25, 0x1c02, 0x2406, 
-    0x1c69, 0x282a, 0x1c06, 0x1405, 0x2967, 0x2003, 0x1522, 0x2c86, 0x2c4c, 
-    0x2c4e, 0x182a, 0x3047, 0x308b, 0x3449, 0x200a, 0x1428, 0x206c, 0x3045, 
-    0x0be7, 0x0fe6, 0x1c41, 0x0ec3, 0x13e4, 0x1c61, 0x2061, 0x1343, 0x2481, 
-    0x2842, 0x28c1, 0x2062, 0x34eb, 0x1a02, 0x1842, 0x202d, 0x1c50, 0x2873, 
-    0x1c92, 0x1d2c, 0x30ad, 0x3091, 0x24b9, 0x20fc, 0x2c50, 0x1408, 0x2464, 
-    0x2ce6, 0x20f8, 0x20bc, 0x146c, 0x30e3, 0x3523, 0x3089, 0x2832, 0x1ccc, 
-    0x2cd5, 0x14fc, 0x197a, 0x2010, 0x261e, 0x18d0, 0x28a1, 0x2cc2, 0x28a2, 
-    0x30e2, 0x3502, 0x28c2, 0x24a1, 0x3d44, 0x2a83, 0x3982, 0x22c3, 0x251e, 
-    0x2856, 0x287a, 0x1d74, 0x1d6e, 0x2898, 0x2815, 0x1c14, 0x1c98, 0x1cf5, 
-    0x2cf2, 0x3d66, 0x4183, 0x456b, 0x36e4, 0x45c3, 0x5ea4, 0x4a05, 0x1c0d, 
-    0x257a, 0x3d42, 0x3a8d, 0x6fe7, 0x45e2, 0x2d76, 0x3541, 0x217e, 0x4e45, 
-    0x3907, 0x205d, 0x1c9e, 0x18ff, 0x193e, 0x30e1, 0x2cc1, 0x5a85, 0x7be9, 
-    0x4e44, 0x6767, 0x4ea4, 0x5f25, 0x4f45, 0x67e9, 0x4624, 0x57e8, 0x53ea, 
-    0x6fea, 0x47e9, 0x3101, 0x5ae6, 0x5beb, 0x43ec, 0x5bed, 0x53ef, 0x4bec, 
-    0x67f5, 0x6344, 0x4b08, 0x5f88, 0x63e6, 0x5bf2, 0x67f3, 0x6ff8, 0x6309, 
-    0x4f6b, 0x77fa, 0x157e, 0x161c, 0x15fe, 0x16de, 0x73fe, 0x57f6, 0x3bf1, 
-    0x53fa, 0x47f5, 0x167e, 0x269d, 0x12fe, 0x169b, 0x28a0, 0x4eed, 0x522b, 
-    0x49c8, 0x3615, 0x4b74, 0x221a, 0x3317, 0x2fb8, 0x21ee, 0x3eb0, 0x4269, 
-    0x31c9, 0x331c, 0x43ff, 0x57ff, 0x1812, 0x1c1b, 0x2017, 0x3fd7, 0x3570, 
-    0x100f, 0x1c76, 0x189c, 0x135e, 0x13ff, 0x0fff, 0x1a95, 0x1e14, 0x22fd, 
-    0x2e30, 0x1bbe, 0x1bff, 0x1fff, 0x235d, 0x2bbe, 0x322c, 0x2eb1, 0x2bff, 
-    0x36f3, 0x37bb, 0x37fe, 0x3f30, 0x43fb, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000
-};
-
+/* GBA_Metroid_Title_Screen_data is compressed, load it with asset_load(ASSET_GBA_METROID_TITLE_SCREEN_DATA, dest) */
+/* GBA_Metroid_Title_Screen_palette is compressed, load it with asset_load(ASSET_GBA_METROID_TITLE_SCREEN_PALETTE, dest) */
@@ -1,123 +1,8 @@
-/* created by GBA Tile Editor
-   regular map */
+/* MissionCompleteMap.h
+ * generated by tools/assets.py from MissionCompleteMap.csv, the data is in the asset pack */
 
 #define missionCompleteMap_width 32
 #define missionCompleteMap_height 32
+#define missionCompleteMap_bytes 2048
 
-const unsigned short missionCompleteMap [] = {
-    0x0078, 0x0078, 0x0078, 0x0078, 0x005e, 0x0078, 0x0078, 0x0007, 0x0078, 
-    0x0078, 0x0078, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 
-    0x0012, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x005e, 0x005e, 0x005e, 0x005e, 
-    0x005e, 0x0078, 0x0078, 0x0020, 0x0008, 0x0009, 0x000a, 0x0024, 0x0025, 
-    0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0039, 
-    0x0021, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 
-    0x0043, 0x0044, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0052, 0x003a, 0x0054, 0x0055, 0x0056, 
-    0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x006b, 0x0053, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 
-    0x0074, 0x0075, 0x0076, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0084, 0x0085, 0x0086, 0x0087, 
-    0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 
-    0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x00b6, 0x00b7, 0x00b8, 
-    0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 
-    0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x00e8, 0x00e9, 
-    0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 
-    0x00f3, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 
-    0x0107, 0x0108, 0x0109, 0x010a, 0x010b, 0x010c, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x011a, 
-    0x011b, 0x011c, 0x011d, 0x011e, 0x011f, 0x0120, 0x013a, 0x0122, 0x0123, 
-    0x0124, 0x0125, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 
-    0x0138, 0x0139, 0x013a, 0x013b, 0x013c, 0x013d, 0x013e, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x014c, 0x014d, 0x014e, 0x014f, 0x0150, 0x0151, 0x0152, 0x0153, 0x013b, 
-    0x0155, 0x0156, 0x0157, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0165, 0x0166, 0x0167, 0x0168, 
-    0x0169, 0x016a, 0x016b, 0x016c, 0x0154, 0x016e, 0x016f, 0x0170, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x017e, 0x017f, 0x0180, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 
-    0x0186, 0x0187, 0x0188, 0x0189, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0197, 0x0198, 0x0199, 
-    0x019a, 0x019b, 0x019c, 0x019d, 0x019e, 0x019f, 0x01a0, 0x01a1, 0x01a2, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x01b0, 0x01b1, 0x01b2, 0x01b3, 0x01b4, 0x01b5, 0x01b6, 
-    0x01b7, 0x01b8, 0x01b9, 0x01ba, 0x01bb, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x01c9, 0x01ca, 
-    0x01cb, 0x01cc, 0x01cd, 0x01ce, 0x01cf, 0x01d0, 0x01d1, 0x01d2, 0x01d3, 
-    0x01d4, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x01e2, 0x01e3, 0x01e4, 0x01e5, 0x01e6, 0x01e7, 
-    0x01e8, 0x01e9, 0x01e9, 0x01eb, 0x01ec, 0x01ed, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x01fb, 
-    0x01fc, 0x01fd, 0x01fe, 0x01ff, 0x0200, 0x0201, 0x0202, 0x01ea, 0x0204, 
-    0x0205, 0x0206, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0214, 0x0215, 0x0216, 0x0217, 0x0218, 
-    0x0219, 0x021a, 0x021b, 0x021c, 0x021d, 0x021e, 0x021f, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x022d, 0x022e, 0x022f, 0x0230, 0x0231, 0x0232, 0x0233, 0x0234, 0x0235, 
-    0x0236, 0x0237, 0x0238, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0246, 0x0247, 0x0248, 0x0249, 
-    0x024a, 0x024b, 0x024c, 0x024d, 0x024e, 0x024f, 0x0250, 0x0251, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0262, 0x0263, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 
-};
-
+extern const unsigned short missionCompleteMap [];
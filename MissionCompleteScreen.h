@@ -1,3375 +1,10 @@
 /* MissionCompleteScreen.h
- * generated by png2gba program */
+ * generated by tools/assets.py from MissionCompleteScreen.png, the data is in the asset pack */
 
 #define MissionCompleteScreen_width 200
 #define MissionCompleteScreen_height 200
+#define MissionCompleteScreen_data_bytes 40000
+#define MissionCompleteScreen_palette_bytes 512
 
-const unsigned char MissionCompleteScreen_data [] = {
-    0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
-    0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x04, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x09, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x08, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x0B, 0x0C, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x0C, 0x04, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x08, 0x03, 0x02, 0x01, 0x02, 0x0A, 
-    0x08, 0x0D, 0x03, 0x02, 0x05, 0x01, 0x01, 0x0C, 0x08, 0x03, 0x01, 0x01, 
-    0x05, 0x01, 0x03, 0x08, 0x06, 0x05, 0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 
-    0x01, 0x03, 0x04, 0x0E, 0x03, 0x02, 0x01, 0x02, 0x01, 0x0F, 0x10, 0x04, 
-    0x03, 0x02, 0x01, 0x02, 0x01, 0x0C, 0x10, 0x0F, 0x02, 0x01, 0x01, 0x02, 
-    0x01, 0x0C, 0x11, 0x04, 0x02, 0x01, 0x01, 0x02, 0x01, 0x0F, 0x12, 0x06, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x0F, 0x12, 0x0F, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x0F, 0x12, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x12, 0x0F, 
-    0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x13, 0x01, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x0A, 0x07, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x09, 
-    0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x09, 0x01, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x01, 0x09, 0x03, 0x03, 0x03, 0x03, 0x0E, 0x06, 0x0C, 0x01, 
-    0x03, 0x03, 0x03, 0x03, 0x0B, 0x06, 0x08, 0x01, 0x03, 0x03, 0x03, 0x03, 
-    0x0B, 0x06, 0x08, 0x01, 0x04, 0x01, 0x03, 0x01, 0x0E, 0x06, 0x0C, 0x01, 
-    0x0D, 0x01, 0x03, 0x01, 0x01, 0x06, 0x08, 0x01, 0x09, 0x05, 0x03, 0x01, 
-    0x03, 0x08, 0x0C, 0x01, 0x09, 0x02, 0x0E, 0x01, 0x03, 0x08, 0x0C, 0x01, 
-    0x09, 0x02, 0x01, 0x03, 0x0A, 0x08, 0x04, 0x02, 0x01, 0x01, 0x03, 0x04, 
-    0x03, 0x01, 0x02, 0x03, 0x03, 0x01, 0x13, 0x0C, 0x01, 0x02, 0x02, 0x0E, 
-    0x03, 0x02, 0x13, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x13, 0x08, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x08, 0x01, 0x02, 0x01, 0x04, 
-    0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x04, 0x04, 0x01, 0x01, 0x02, 0x02, 
-    0x02, 0x02, 0x08, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x0C, 
-    0x13, 0x03, 0x03, 0x03, 0x04, 0x13, 0x01, 0x02, 0x13, 0x03, 0x03, 0x06, 
-    0x06, 0x0E, 0x02, 0x01, 0x01, 0x01, 0x03, 0x06, 0x04, 0x01, 0x01, 0x01, 
-    0x04, 0x03, 0x03, 0x04, 0x01, 0x02, 0x01, 0x01, 0x06, 0x0C, 0x0C, 0x13, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0D, 0x0D, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0D, 0x0D, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x06, 0x0D, 0x06, 0x03, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 
-    0x01, 0x01, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x06, 0x06, 0x0C, 0x01, 0x02, 0x01, 0x02, 0x03, 0x13, 0x0D, 0x0D, 
-    0x01, 0x0E, 0x01, 0x03, 0x0C, 0x04, 0x09, 0x07, 0x01, 0x03, 0x01, 0x13, 
-    0x0D, 0x04, 0x07, 0x07, 0x01, 0x03, 0x01, 0x13, 0x0D, 0x04, 0x07, 0x07, 
-    0x01, 0x02, 0x0B, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0E, 0x04, 0x0C, 
-    0x01, 0x02, 0x01, 0x01, 0x04, 0x0C, 0x0C, 0x08, 0x01, 0x02, 0x01, 0x01, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x01, 0x02, 0x01, 0x02, 0x0D, 0x0C, 0x0C, 0x08, 
-    0x03, 0x01, 0x02, 0x0E, 0x0D, 0x13, 0x01, 0x0D, 0x0D, 0x04, 0x02, 0x04, 
-    0x0D, 0x06, 0x03, 0x0D, 0x0D, 0x13, 0x05, 0x0A, 0x0D, 0x13, 0x03, 0x0D, 
-    0x0D, 0x06, 0x01, 0x04, 0x01, 0x01, 0x06, 0x0A, 0x04, 0x06, 0x02, 0x01, 
-    0x01, 0x01, 0x06, 0x0A, 0x03, 0x13, 0x02, 0x02, 0x01, 0x02, 0x06, 0x04, 
-    0x03, 0x13, 0x03, 0x03, 0x01, 0x04, 0x08, 0x13, 0x06, 0x13, 0x0C, 0x08, 
-    0x04, 0x07, 0x0D, 0x13, 0x06, 0x13, 0x0C, 0x0D, 0x0D, 0x11, 0x0D, 0x13, 
-    0x06, 0x13, 0x0C, 0x0D, 0x0D, 0x11, 0x0D, 0x13, 0x06, 0x13, 0x0C, 0x0D, 
-    0x13, 0x0D, 0x08, 0x13, 0x06, 0x13, 0x07, 0x11, 0x01, 0x01, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x05, 0x02, 0x03, 0x03, 
-    0x02, 0x02, 0x06, 0x08, 0x04, 0x0C, 0x06, 0x03, 0x03, 0x08, 0x0D, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x04, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x13, 
-    0x06, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x08, 0x0D, 0x0D, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x14, 
-    0x0C, 0x04, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 0x04, 0x15, 0x01, 
-    0x01, 0x02, 0x04, 0x04, 0x04, 0x06, 0x13, 0x01, 0x01, 0x05, 0x0C, 0x08, 
-    0x04, 0x07, 0x09, 0x03, 0x0E, 0x05, 0x0C, 0x0D, 0x13, 0x07, 0x09, 0x0A, 
-    0x0B, 0x01, 0x08, 0x0D, 0x13, 0x07, 0x09, 0x0A, 0x03, 0x01, 0x08, 0x0D, 
-    0x06, 0x07, 0x14, 0x06, 0x03, 0x01, 0x06, 0x0D, 0x0D, 0x07, 0x16, 0x08, 
-    0x06, 0x0A, 0x09, 0x16, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x03, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x13, 0x04, 0x01, 
-    0x0B, 0x02, 0x01, 0x01, 0x0C, 0x0C, 0x0D, 0x03, 0x03, 0x01, 0x02, 0x01, 
-    0x08, 0x0D, 0x07, 0x06, 0x04, 0x01, 0x02, 0x01, 0x0D, 0x07, 0x07, 0x06, 
-    0x06, 0x01, 0x01, 0x02, 0x0D, 0x08, 0x0D, 0x08, 0x13, 0x01, 0x01, 0x01, 
-    0x11, 0x0D, 0x0D, 0x0D, 0x0C, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0C, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0D, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0D, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x04, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x03, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x0A, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x01, 0x01, 
-    0x02, 0x01, 0x03, 0x0E, 0x06, 0x01, 0x02, 0x02, 0x02, 0x03, 0x0D, 0x04, 
-    0x0C, 0x01, 0x0C, 0x0C, 0x03, 0x0E, 0x09, 0x06, 0x08, 0x03, 0x07, 0x08, 
-    0x03, 0x03, 0x07, 0x06, 0x03, 0x0A, 0x11, 0x07, 0x03, 0x03, 0x11, 0x0F, 
-    0x05, 0x04, 0x16, 0x09, 0x13, 0x03, 0x11, 0x0F, 0x02, 0x04, 0x14, 0x07, 
-    0x13, 0x0E, 0x11, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x0E, 
-    0x01, 0x02, 0x01, 0x01, 0x05, 0x02, 0x03, 0x06, 0x03, 0x01, 0x01, 0x01, 
-    0x02, 0x02, 0x03, 0x0D, 0x08, 0x13, 0x01, 0x01, 0x05, 0x02, 0x03, 0x13, 
-    0x08, 0x08, 0x01, 0x02, 0x05, 0x01, 0x01, 0x01, 0x0A, 0x08, 0x0D, 0x13, 
-    0x05, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0D, 0x08, 0x01, 0x01, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x0A, 0x02, 0x01, 0x01, 0x01, 
-    0x02, 0x02, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x0E, 
-    0x15, 0x05, 0x01, 0x01, 0x04, 0x01, 0x02, 0x01, 0x0F, 0x17, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x13, 0x04, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x05, 0x08, 0x08, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x05, 0x08, 0x08, 0x03, 0x01, 0x01, 0x01, 0x01, 0x05, 0x08, 0x0C, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x05, 0x08, 0x09, 0x06, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x03, 0x06, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x07, 0x06, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x13, 0x05, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x0D, 0x0C, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x0D, 0x06, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0D, 0x06, 0x05, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x0D, 0x06, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x0D, 0x06, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0D, 0x0C, 0x05, 0x01, 
-    0x01, 0x01, 0x01, 0x15, 0x0F, 0x12, 0x07, 0x08, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x18, 0x09, 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1A, 0x09, 0x12, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x15, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x05, 0x01, 0x13, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 
-    0x05, 0x13, 0x03, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x04, 0x07, 0x0A, 
-    0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x10, 0x07, 0x01, 0x03, 0x03, 0x02, 
-    0x0A, 0x06, 0x07, 0x07, 0x01, 0x03, 0x03, 0x01, 0x13, 0x0C, 0x10, 0x19, 
-    0x01, 0x01, 0x03, 0x03, 0x0A, 0x06, 0x16, 0x10, 0x0E, 0x03, 0x03, 0x01, 
-    0x04, 0x06, 0x12, 0x10, 0x0A, 0x0E, 0x01, 0x0B, 0x03, 0x01, 0x02, 0x19, 
-    0x09, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x19, 0x09, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x02, 0x19, 0x09, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x19, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x19, 0x09, 0x01, 0x01, 0x01, 
-    0x01, 0x03, 0x02, 0x09, 0x1B, 0x01, 0x01, 0x02, 0x05, 0x03, 0x01, 0x07, 
-    0x08, 0x0E, 0x02, 0x01, 0x06, 0x03, 0x01, 0x07, 0x08, 0x0E, 0x02, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x05, 0x04, 0x0D, 0x03, 0x01, 0x01, 0x01, 0x01, 0x15, 0x06, 0x11, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x15, 0x1C, 0x11, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x15, 0x1C, 0x11, 0x03, 0x01, 0x01, 0x01, 0x01, 0x15, 0x1C, 0x11, 0x0A, 
-    0x01, 0x02, 0x01, 0x01, 0x15, 0x1C, 0x11, 0x03, 0x01, 0x02, 0x01, 0x01, 
-    0x15, 0x1C, 0x11, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x16, 0x1B, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x1D, 0x1E, 0x10, 0x01, 0x01, 0x01, 0x02, 0x01, 0x1D, 0x1F, 0x12, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x1F, 0x10, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x08, 0x09, 0x04, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0D, 0x1D, 0x05, 
-    0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x01, 0x01, 0x05, 0x01, 0x03, 0x08, 
-    0x0C, 0x01, 0x01, 0x01, 0x15, 0x01, 0x03, 0x08, 0x0C, 0x02, 0x01, 0x01, 
-    0x20, 0x01, 0x01, 0x13, 0x0C, 0x02, 0x01, 0x01, 0x1A, 0x0A, 0x03, 0x0E, 
-    0x03, 0x01, 0x02, 0x01, 0x1A, 0x08, 0x13, 0x02, 0x02, 0x01, 0x01, 0x01, 
-    0x05, 0x08, 0x0C, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x06, 0x03, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x03, 0x1E, 0x1E, 0x06, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x1F, 0x12, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x12, 0x0C, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x10, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x07, 0x1E, 0x13, 0x03, 0x01, 0x01, 0x01, 0x1B, 0x1F, 0x1F, 0x03, 0x01, 
-    0x01, 0x01, 0x18, 0x10, 0x21, 0x10, 0x0A, 0x03, 0x01, 0x01, 0x22, 0x23, 
-    0x12, 0x22, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x07, 
-    0x0B, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x06, 0x03, 0x03, 0x17, 0x01, 
-    0x24, 0x03, 0x03, 0x03, 0x03, 0x17, 0x1A, 0x25, 0x26, 0x13, 0x01, 0x03, 
-    0x03, 0x04, 0x12, 0x27, 0x28, 0x23, 0x1A, 0x0B, 0x04, 0x0C, 0x29, 0x2A, 
-    0x2B, 0x19, 0x20, 0x0B, 0x13, 0x0D, 0x2C, 0x2A, 0x2B, 0x09, 0x20, 0x0B, 
-    0x04, 0x1E, 0x27, 0x2A, 0x2B, 0x09, 0x20, 0x0B, 0x09, 0x05, 0x01, 0x03, 
-    0x06, 0x08, 0x04, 0x02, 0x08, 0x02, 0x02, 0x04, 0x06, 0x04, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x13, 0x06, 0x04, 0x01, 0x02, 0x01, 0x01, 0x02, 0x03, 
-    0x04, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x04, 0x01, 0x02, 0x01, 
-    0x02, 0x01, 0x02, 0x01, 0x13, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 
-    0x13, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x0A, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x07, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x09, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0D, 0x08, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x02, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x06, 0x06, 0x07, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x06, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x13, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x0A, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x05, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x0E, 0x03, 0x0C, 0x04, 0x0B, 
-    0x03, 0x03, 0x01, 0x04, 0x04, 0x08, 0x04, 0x03, 0x03, 0x0B, 0x04, 0x07, 
-    0x04, 0x0F, 0x02, 0x04, 0x08, 0x04, 0x09, 0x07, 0x0D, 0x07, 0x05, 0x0B, 
-    0x06, 0x08, 0x07, 0x0D, 0x07, 0x1B, 0x05, 0x04, 0x07, 0x11, 0x09, 0x0C, 
-    0x07, 0x07, 0x01, 0x13, 0x07, 0x09, 0x0D, 0x07, 0x07, 0x07, 0x13, 0x13, 
-    0x09, 0x19, 0x08, 0x11, 0x07, 0x07, 0x04, 0x04, 0x09, 0x10, 0x08, 0x11, 
-    0x07, 0x07, 0x04, 0x08, 0x09, 0x16, 0x08, 0x11, 0x0D, 0x0C, 0x13, 0x08, 
-    0x09, 0x11, 0x08, 0x09, 0x13, 0x04, 0x06, 0x08, 0x0D, 0x0D, 0x08, 0x0D, 
-    0x13, 0x0C, 0x0D, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x13, 0x08, 0x0D, 0x07, 
-    0x09, 0x08, 0x0D, 0x0D, 0x08, 0x08, 0x0D, 0x19, 0x09, 0x08, 0x0D, 0x0D, 
-    0x08, 0x08, 0x0D, 0x19, 0x09, 0x08, 0x0D, 0x0D, 0x08, 0x08, 0x0D, 0x19, 
-    0x09, 0x08, 0x07, 0x07, 0x08, 0x08, 0x0D, 0x14, 0x1B, 0x07, 0x12, 0x16, 
-    0x0D, 0x0D, 0x0D, 0x19, 0x0D, 0x10, 0x1F, 0x10, 0x06, 0x08, 0x07, 0x06, 
-    0x0C, 0x0C, 0x07, 0x16, 0x0C, 0x08, 0x11, 0x11, 0x11, 0x09, 0x07, 0x16, 
-    0x0C, 0x08, 0x11, 0x19, 0x14, 0x11, 0x07, 0x14, 0x0D, 0x09, 0x19, 0x11, 
-    0x11, 0x09, 0x07, 0x19, 0x08, 0x09, 0x19, 0x11, 0x19, 0x11, 0x07, 0x10, 
-    0x09, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x19, 0x1F, 0x07, 0x09, 0x11, 
-    0x19, 0x09, 0x0D, 0x0D, 0x1E, 0x08, 0x14, 0x19, 0x09, 0x0D, 0x0D, 0x0D, 
-    0x07, 0x08, 0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x14, 0x07, 0x08, 0x0D, 0x0D, 
-    0x0D, 0x08, 0x07, 0x14, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x11, 
-    0x07, 0x0D, 0x0D, 0x0C, 0x0C, 0x08, 0x08, 0x0D, 0x09, 0x08, 0x09, 0x19, 
-    0x09, 0x09, 0x11, 0x0D, 0x07, 0x0D, 0x1E, 0x2D, 0x29, 0x2E, 0x1F, 0x07, 
-    0x0D, 0x0D, 0x1F, 0x2E, 0x2E, 0x2D, 0x2E, 0x1E, 0x08, 0x0D, 0x1F, 0x29, 
-    0x2E, 0x2F, 0x2E, 0x30, 0x0D, 0x07, 0x14, 0x07, 0x0D, 0x0C, 0x1E, 0x30, 
-    0x0D, 0x07, 0x16, 0x07, 0x0D, 0x0C, 0x1E, 0x2F, 0x07, 0x0D, 0x07, 0x0D, 
-    0x0D, 0x0C, 0x1E, 0x2F, 0x11, 0x11, 0x08, 0x0D, 0x0D, 0x08, 0x10, 0x2F, 
-    0x11, 0x11, 0x08, 0x0D, 0x0D, 0x08, 0x09, 0x10, 0x11, 0x11, 0x08, 0x0D, 
-    0x0D, 0x0D, 0x08, 0x31, 0x14, 0x11, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x06, 
-    0x16, 0x09, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x1E, 0x09, 0x08, 0x0D, 
-    0x08, 0x03, 0x03, 0x02, 0x1F, 0x16, 0x0D, 0x0D, 0x07, 0x0D, 0x06, 0x0A, 
-    0x1F, 0x10, 0x07, 0x31, 0x1E, 0x1F, 0x13, 0x13, 0x30, 0x1E, 0x0D, 0x31, 
-    0x1E, 0x30, 0x06, 0x0D, 0x1F, 0x12, 0x08, 0x31, 0x1E, 0x21, 0x04, 0x09, 
-    0x1E, 0x12, 0x0C, 0x0C, 0x1E, 0x2E, 0x07, 0x19, 0x10, 0x10, 0x08, 0x08, 
-    0x16, 0x32, 0x1F, 0x10, 0x12, 0x10, 0x0C, 0x0D, 0x0C, 0x16, 0x1E, 0x10, 
-    0x0A, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x31, 0x0E, 0x01, 0x0E, 0x01, 0x02, 0x01, 0x01, 0x10, 0x08, 0x0C, 0x08, 
-    0x13, 0x01, 0x02, 0x01, 0x30, 0x0C, 0x08, 0x0D, 0x0D, 0x04, 0x02, 0x01, 
-    0x2F, 0x10, 0x08, 0x0D, 0x08, 0x03, 0x02, 0x02, 0x2E, 0x1E, 0x14, 0x0D, 
-    0x08, 0x04, 0x02, 0x04, 0x02, 0x03, 0x06, 0x0D, 0x06, 0x0E, 0x08, 0x03, 
-    0x01, 0x02, 0x01, 0x08, 0x06, 0x03, 0x09, 0x04, 0x02, 0x02, 0x03, 0x08, 
-    0x13, 0x1C, 0x12, 0x06, 0x0E, 0x01, 0x01, 0x04, 0x0A, 0x1C, 0x1E, 0x09, 
-    0x13, 0x03, 0x02, 0x02, 0x05, 0x03, 0x1E, 0x12, 0x13, 0x03, 0x02, 0x01, 
-    0x01, 0x15, 0x04, 0x14, 0x03, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x09, 
-    0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 
-    0x02, 0x03, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x13, 0x0D, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x13, 0x0E, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x04, 0x03, 0x05, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x0A, 0x02, 
-    0x01, 0x01, 0x02, 0x01, 0x0E, 0x08, 0x08, 0x01, 0x01, 0x01, 0x01, 0x03, 
-    0x0C, 0x04, 0x01, 0x33, 0x2F, 0x23, 0x01, 0x01, 0x0D, 0x08, 0x01, 0x33, 
-    0x2D, 0x25, 0x1D, 0x01, 0x0D, 0x08, 0x01, 0x33, 0x2E, 0x23, 0x1D, 0x01, 
-    0x0D, 0x08, 0x01, 0x33, 0x2E, 0x12, 0x31, 0x03, 0x13, 0x0C, 0x01, 0x33, 
-    0x2E, 0x12, 0x31, 0x03, 0x03, 0x0B, 0x02, 0x33, 0x2E, 0x1E, 0x31, 0x04, 
-    0x03, 0x01, 0x02, 0x34, 0x2D, 0x23, 0x31, 0x04, 0x03, 0x01, 0x18, 0x35, 
-    0x36, 0x23, 0x31, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0E, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x0E, 0x09, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x13, 0x0E, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x06, 0x03, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x07, 0x08, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x07, 0x0D, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x08, 0x08, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x04, 0x08, 0x01, 0x04, 0x01, 0x02, 0x01, 0x02, 0x0A, 0x0C, 0x04, 
-    0x0C, 0x03, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x0C, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0E, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x0A, 0x0C, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x13, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x0F, 0x11, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x1B, 0x14, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x15, 0x08, 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x01, 
-    0x02, 0x03, 0x07, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x11, 0x03, 
-    0x02, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x08, 0x03, 0x01, 0x05, 0x10, 0x1E, 
-    0x16, 0x17, 0x22, 0x37, 0x01, 0x05, 0x04, 0x37, 0x12, 0x1C, 0x1A, 0x38, 
-    0x01, 0x01, 0x18, 0x01, 0x10, 0x07, 0x18, 0x37, 0x01, 0x01, 0x01, 0x03, 
-    0x03, 0x16, 0x08, 0x37, 0x02, 0x01, 0x01, 0x01, 0x1A, 0x09, 0x0D, 0x37, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x38, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x22, 0x38, 0x02, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x22, 0x38, 
-    0x1F, 0x0B, 0x05, 0x07, 0x08, 0x0E, 0x02, 0x03, 0x32, 0x19, 0x15, 0x07, 
-    0x08, 0x0E, 0x05, 0x13, 0x29, 0x30, 0x22, 0x19, 0x09, 0x0E, 0x05, 0x06, 
-    0x2F, 0x1E, 0x02, 0x19, 0x11, 0x0E, 0x05, 0x06, 0x2E, 0x1F, 0x18, 0x23, 
-    0x16, 0x01, 0x15, 0x13, 0x39, 0x30, 0x22, 0x10, 0x16, 0x1D, 0x20, 0x04, 
-    0x3A, 0x2D, 0x04, 0x07, 0x0C, 0x05, 0x15, 0x04, 0x3A, 0x29, 0x3B, 0x0D, 
-    0x0F, 0x03, 0x01, 0x06, 0x0A, 0x02, 0x01, 0x01, 0x02, 0x0E, 0x08, 0x11, 
-    0x09, 0x0E, 0x02, 0x01, 0x01, 0x05, 0x03, 0x12, 0x11, 0x03, 0x02, 0x01, 
-    0x01, 0x01, 0x03, 0x10, 0x09, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x10, 
-    0x11, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x10, 0x11, 0x03, 0x02, 0x01, 
-    0x01, 0x02, 0x03, 0x10, 0x09, 0x03, 0x02, 0x01, 0x01, 0x01, 0x03, 0x10, 
-    0x16, 0x03, 0x01, 0x01, 0x01, 0x03, 0x0A, 0x10, 0x01, 0x01, 0x02, 0x03, 
-    0x13, 0x01, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x06, 0x04, 0x01, 0x02, 0x01, 
-    0x01, 0x05, 0x0C, 0x0D, 0x04, 0x01, 0x02, 0x01, 0x01, 0x05, 0x06, 0x08, 
-    0x04, 0x01, 0x02, 0x01, 0x01, 0x15, 0x08, 0x0D, 0x03, 0x01, 0x02, 0x01, 
-    0x01, 0x15, 0x1B, 0x07, 0x0E, 0x01, 0x02, 0x01, 0x01, 0x15, 0x07, 0x09, 
-    0x0A, 0x01, 0x02, 0x05, 0x01, 0x05, 0x1C, 0x11, 0x08, 0x15, 0x03, 0x04, 
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x22, 0x23, 0x1E, 0x15, 0x03, 0x01, 
-    0x01, 0x01, 0x18, 0x09, 0x10, 0x15, 0x03, 0x01, 0x01, 0x01, 0x15, 0x09, 
-    0x10, 0x0E, 0x03, 0x01, 0x01, 0x01, 0x02, 0x09, 0x16, 0x15, 0x04, 0x3C, 
-    0x01, 0x01, 0x01, 0x09, 0x1F, 0x1B, 0x0A, 0x35, 0x02, 0x0B, 0x04, 0x09, 
-    0x2D, 0x21, 0x1D, 0x12, 0x01, 0x01, 0x06, 0x10, 0x2D, 0x1F, 0x1B, 0x2F, 
-    0x03, 0x03, 0x0F, 0x1F, 0x39, 0x21, 0x09, 0x30, 0x08, 0x2F, 0x3A, 0x2A, 
-    0x28, 0x09, 0x20, 0x0B, 0x0D, 0x32, 0x27, 0x3A, 0x3D, 0x06, 0x02, 0x01, 
-    0x09, 0x2E, 0x3E, 0x3F, 0x40, 0x01, 0x01, 0x01, 0x41, 0x2E, 0x42, 0x2C, 
-    0x24, 0x03, 0x02, 0x01, 0x2E, 0x2A, 0x39, 0x23, 0x15, 0x01, 0x01, 0x01, 
-    0x2C, 0x43, 0x32, 0x40, 0x0B, 0x01, 0x01, 0x01, 0x3A, 0x44, 0x2F, 0x22, 
-    0x0B, 0x01, 0x01, 0x01, 0x30, 0x45, 0x35, 0x05, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0B, 
-    0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x13, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x03, 0x13, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x04, 
-    0x01, 0x02, 0x03, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x06, 0x13, 
-    0x03, 0x01, 0x03, 0x01, 0x01, 0x02, 0x13, 0x13, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 
-    0x03, 0x04, 0x0B, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x04, 0x06, 0x46, 0x01, 
-    0x03, 0x01, 0x0A, 0x08, 0x13, 0x0F, 0x2F, 0x23, 0x02, 0x06, 0x06, 0x0D, 
-    0x08, 0x07, 0x3A, 0x45, 0x22, 0x07, 0x0D, 0x0D, 0x07, 0x11, 0x3A, 0x45, 
-    0x3C, 0x07, 0x0D, 0x0D, 0x0D, 0x16, 0x42, 0x45, 0x3B, 0x07, 0x0D, 0x08, 
-    0x04, 0x13, 0x0C, 0x08, 0x0A, 0x04, 0x0C, 0x07, 0x13, 0x06, 0x0C, 0x0D, 
-    0x06, 0x0C, 0x0D, 0x08, 0x0C, 0x13, 0x0C, 0x0D, 0x06, 0x0C, 0x0D, 0x0C, 
-    0x0D, 0x0C, 0x08, 0x0D, 0x06, 0x06, 0x0D, 0x06, 0x0D, 0x11, 0x07, 0x0D, 
-    0x06, 0x08, 0x0D, 0x08, 0x0D, 0x14, 0x07, 0x13, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x0D, 0x11, 0x07, 0x08, 0x0D, 0x08, 0x0D, 0x0D, 0x16, 0x0D, 0x08, 0x0D, 
-    0x0D, 0x07, 0x08, 0x07, 0x0D, 0x04, 0x0C, 0x0C, 0x21, 0x2D, 0x06, 0x0D, 
-    0x06, 0x0C, 0x07, 0x31, 0x30, 0x39, 0x06, 0x08, 0x13, 0x07, 0x14, 0x07, 
-    0x32, 0x39, 0x07, 0x1F, 0x13, 0x07, 0x14, 0x07, 0x29, 0x3E, 0x11, 0x2F, 
-    0x08, 0x07, 0x10, 0x07, 0x29, 0x3E, 0x19, 0x30, 0x08, 0x09, 0x1E, 0x09, 
-    0x29, 0x3E, 0x1E, 0x2F, 0x08, 0x09, 0x12, 0x10, 0x2C, 0x42, 0x2E, 0x36, 
-    0x07, 0x16, 0x21, 0x30, 0x29, 0x39, 0x39, 0x3A, 0x0D, 0x0D, 0x0D, 0x07, 
-    0x0D, 0x10, 0x1F, 0x12, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x11, 0x1F, 0x12, 
-    0x11, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x10, 0x07, 0x10, 0x0C, 0x0D, 0x0D, 
-    0x0D, 0x0D, 0x09, 0x0D, 0x19, 0x06, 0x0D, 0x0D, 0x0D, 0x0D, 0x09, 0x0D, 
-    0x19, 0x06, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x07, 0x10, 0x06, 0x07, 0x08, 
-    0x0D, 0x0D, 0x08, 0x07, 0x25, 0x31, 0x07, 0x09, 0x07, 0x0D, 0x08, 0x07, 
-    0x1E, 0x06, 0x1B, 0x16, 0x07, 0x08, 0x0D, 0x08, 0x10, 0x08, 0x13, 0x09, 
-    0x07, 0x0D, 0x07, 0x0D, 0x08, 0x0D, 0x0C, 0x0D, 0x08, 0x11, 0x21, 0x30, 
-    0x0D, 0x0D, 0x0C, 0x0D, 0x08, 0x16, 0x2F, 0x2E, 0x0D, 0x0D, 0x0C, 0x0D, 
-    0x0C, 0x1F, 0x2E, 0x2F, 0x09, 0x0D, 0x0C, 0x07, 0x09, 0x21, 0x2F, 0x2F, 
-    0x14, 0x0D, 0x13, 0x0C, 0x1E, 0x2F, 0x2E, 0x32, 0x12, 0x16, 0x07, 0x1E, 
-    0x30, 0x2F, 0x2F, 0x2F, 0x07, 0x11, 0x30, 0x36, 0x2D, 0x29, 0x29, 0x2F, 
-    0x09, 0x16, 0x2F, 0x36, 0x3A, 0x47, 0x39, 0x2E, 0x1E, 0x30, 0x29, 0x36, 
-    0x27, 0x48, 0x47, 0x29, 0x2F, 0x2E, 0x36, 0x29, 0x47, 0x49, 0x42, 0x36, 
-    0x2F, 0x2E, 0x36, 0x39, 0x48, 0x49, 0x4A, 0x47, 0x2E, 0x2F, 0x2E, 0x27, 
-    0x48, 0x48, 0x49, 0x2A, 0x29, 0x39, 0x3A, 0x39, 0x2D, 0x36, 0x42, 0x47, 
-    0x47, 0x27, 0x42, 0x47, 0x39, 0x29, 0x3A, 0x47, 0x1F, 0x16, 0x09, 0x07, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x30, 0x1E, 0x11, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x2E, 0x2F, 0x30, 0x12, 0x08, 0x0D, 0x0D, 0x07, 0x36, 0x36, 0x2E, 0x1E, 
-    0x08, 0x0D, 0x0D, 0x11, 0x36, 0x36, 0x36, 0x21, 0x16, 0x30, 0x30, 0x12, 
-    0x39, 0x36, 0x36, 0x30, 0x1E, 0x29, 0x29, 0x21, 0x3A, 0x4B, 0x36, 0x2E, 
-    0x2E, 0x2E, 0x29, 0x2E, 0x3E, 0x27, 0x29, 0x2E, 0x2E, 0x2E, 0x2E, 0x30, 
-    0x07, 0x0D, 0x08, 0x16, 0x1F, 0x1B, 0x07, 0x12, 0x0D, 0x0D, 0x08, 0x12, 
-    0x2F, 0x10, 0x0C, 0x10, 0x0D, 0x0D, 0x09, 0x12, 0x32, 0x21, 0x14, 0x10, 
-    0x0D, 0x0D, 0x0D, 0x10, 0x2E, 0x30, 0x07, 0x19, 0x08, 0x0D, 0x07, 0x10, 
-    0x2E, 0x30, 0x16, 0x16, 0x09, 0x08, 0x09, 0x10, 0x2E, 0x2E, 0x2F, 0x1E, 
-    0x07, 0x08, 0x09, 0x11, 0x29, 0x39, 0x2F, 0x1E, 0x07, 0x08, 0x09, 0x16, 
-    0x2C, 0x39, 0x32, 0x21, 0x32, 0x11, 0x12, 0x19, 0x08, 0x08, 0x0C, 0x0D, 
-    0x2F, 0x16, 0x1E, 0x29, 0x19, 0x0C, 0x07, 0x0D, 0x32, 0x16, 0x12, 0x36, 
-    0x21, 0x14, 0x0D, 0x0D, 0x21, 0x09, 0x10, 0x39, 0x2F, 0x12, 0x09, 0x12, 
-    0x1E, 0x0D, 0x10, 0x39, 0x32, 0x12, 0x12, 0x12, 0x09, 0x11, 0x10, 0x39, 
-    0x2F, 0x12, 0x12, 0x11, 0x0D, 0x10, 0x1E, 0x39, 0x32, 0x12, 0x21, 0x10, 
-    0x0D, 0x10, 0x1E, 0x2F, 0x2D, 0x1F, 0x1F, 0x30, 0x06, 0x02, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x0C, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x0D, 0x0D, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x09, 0x08, 0x04, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x07, 0x08, 0x08, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x07, 0x07, 0x0D, 0x04, 0x01, 0x01, 0x01, 0x01, 0x12, 0x1E, 0x09, 0x0C, 
-    0x03, 0x02, 0x02, 0x01, 0x30, 0x2F, 0x1E, 0x11, 0x06, 0x03, 0x01, 0x01, 
-    0x05, 0x08, 0x07, 0x03, 0x01, 0x02, 0x0E, 0x08, 0x02, 0x08, 0x07, 0x03, 
-    0x01, 0x03, 0x01, 0x0A, 0x02, 0x08, 0x1B, 0x0E, 0x06, 0x0D, 0x04, 0x02, 
-    0x05, 0x08, 0x09, 0x03, 0x06, 0x0D, 0x13, 0x02, 0x02, 0x13, 0x0D, 0x04, 
-    0x06, 0x0D, 0x0C, 0x0E, 0x02, 0x13, 0x06, 0x04, 0x06, 0x06, 0x06, 0x13, 
-    0x02, 0x04, 0x08, 0x13, 0x06, 0x06, 0x06, 0x06, 0x02, 0x0F, 0x0D, 0x04, 
-    0x06, 0x06, 0x06, 0x06, 0x03, 0x01, 0x15, 0x35, 0x36, 0x23, 0x31, 0x08, 
-    0x03, 0x01, 0x15, 0x35, 0x36, 0x23, 0x31, 0x0C, 0x01, 0x01, 0x1D, 0x35, 
-    0x29, 0x23, 0x31, 0x08, 0x01, 0x02, 0x0A, 0x37, 0x29, 0x12, 0x0C, 0x0D, 
-    0x01, 0x02, 0x06, 0x09, 0x2F, 0x12, 0x0C, 0x0D, 0x03, 0x03, 0x08, 0x0C, 
-    0x1A, 0x19, 0x12, 0x0C, 0x06, 0x06, 0x08, 0x07, 0x40, 0x4C, 0x39, 0x03, 
-    0x06, 0x13, 0x07, 0x07, 0x40, 0x4D, 0x27, 0x07, 0x0A, 0x13, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x0C, 0x07, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x15, 0x08, 0x11, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x08, 0x09, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x09, 0x09, 0x03, 0x01, 0x02, 0x01, 0x01, 
-    0x04, 0x07, 0x09, 0x13, 0x03, 0x02, 0x01, 0x01, 0x0C, 0x07, 0x14, 0x08, 
-    0x03, 0x02, 0x01, 0x01, 0x08, 0x0D, 0x11, 0x0C, 0x03, 0x02, 0x01, 0x01, 
-    0x01, 0x02, 0x02, 0x05, 0x13, 0x08, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 
-    0x04, 0x08, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x04, 0x13, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x13, 0x0D, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x0D, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x08, 0x14, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x15, 0x08, 0x14, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x15, 0x08, 0x11, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x06, 
-    0x04, 0x03, 0x01, 0x02, 0x01, 0x01, 0x05, 0x0E, 0x0D, 0x08, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x08, 0x0D, 0x04, 0x02, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x0D, 0x13, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 
-    0x02, 0x03, 0x07, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x07, 0x03, 
-    0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x02, 0x3C, 
-    0x01, 0x02, 0x01, 0x01, 0x06, 0x0A, 0x03, 0x1F, 0x09, 0x18, 0x1B, 0x04, 
-    0x06, 0x0A, 0x08, 0x39, 0x30, 0x06, 0x07, 0x08, 0x03, 0x03, 0x1B, 0x3A, 
-    0x32, 0x0D, 0x1F, 0x10, 0x01, 0x01, 0x0D, 0x3A, 0x2D, 0x0D, 0x2D, 0x1F, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x22, 0x38, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x05, 0x17, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x05, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x05, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1A, 0x03, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x3A, 0x2D, 0x25, 0x10, 0x08, 0x0C, 0x0E, 0x0F, 
-    0x12, 0x23, 0x4B, 0x1F, 0x13, 0x04, 0x05, 0x0F, 0x1A, 0x33, 0x39, 0x1E, 
-    0x06, 0x04, 0x05, 0x0F, 0x01, 0x33, 0x39, 0x21, 0x0D, 0x08, 0x01, 0x0F, 
-    0x04, 0x34, 0x3A, 0x32, 0x08, 0x06, 0x01, 0x0F, 0x0A, 0x34, 0x27, 0x32, 
-    0x06, 0x04, 0x0B, 0x0F, 0x18, 0x33, 0x36, 0x30, 0x08, 0x0A, 0x03, 0x0F, 
-    0x01, 0x01, 0x46, 0x30, 0x23, 0x3C, 0x04, 0x0A, 0x12, 0x03, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x10, 0x12, 0x03, 0x01, 0x02, 0x01, 0x02, 0x23, 0x1E, 
-    0x12, 0x03, 0x01, 0x01, 0x02, 0x22, 0x2F, 0x21, 0x12, 0x03, 0x01, 0x01, 
-    0x02, 0x22, 0x2F, 0x21, 0x12, 0x03, 0x01, 0x01, 0x02, 0x22, 0x32, 0x21, 
-    0x1F, 0x13, 0x01, 0x01, 0x02, 0x18, 0x2F, 0x21, 0x21, 0x07, 0x02, 0x01, 
-    0x01, 0x4E, 0x4C, 0x1E, 0x30, 0x1E, 0x01, 0x01, 0x01, 0x4E, 0x4C, 0x1F, 
-    0x01, 0x01, 0x05, 0x0C, 0x08, 0x15, 0x03, 0x09, 0x01, 0x15, 0x0C, 0x11, 
-    0x0C, 0x01, 0x03, 0x09, 0x01, 0x01, 0x07, 0x0D, 0x03, 0x01, 0x10, 0x09, 
-    0x01, 0x0A, 0x09, 0x0C, 0x05, 0x01, 0x1F, 0x09, 0x01, 0x03, 0x07, 0x0C, 
-    0x01, 0x15, 0x1E, 0x19, 0x0E, 0x0C, 0x13, 0x03, 0x01, 0x18, 0x1E, 0x19, 
-    0x01, 0x04, 0x03, 0x02, 0x01, 0x02, 0x1E, 0x19, 0x01, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x1F, 0x09, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x15, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x1A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x1A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x1A, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x02, 0x02, 0x1A, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 
-    0x1A, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x01, 0x0E, 0x03, 0x08, 0x1F, 
-    0x3A, 0x21, 0x1B, 0x30, 0x0E, 0x04, 0x08, 0x1F, 0x4B, 0x2E, 0x10, 0x12, 
-    0x0B, 0x03, 0x08, 0x1F, 0x4B, 0x36, 0x1E, 0x1D, 0x0B, 0x03, 0x08, 0x1F, 
-    0x4B, 0x36, 0x23, 0x22, 0x0E, 0x04, 0x08, 0x1F, 0x3A, 0x29, 0x0F, 0x05, 
-    0x0B, 0x0B, 0x06, 0x1F, 0x39, 0x32, 0x1A, 0x03, 0x0B, 0x03, 0x0F, 0x2F, 
-    0x36, 0x30, 0x1A, 0x03, 0x01, 0x0A, 0x0F, 0x29, 0x45, 0x04, 0x01, 0x01, 
-    0x1B, 0x40, 0x18, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0D, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x07, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0C, 0x07, 0x01, 0x01, 0x01, 0x02, 0x03, 0x08, 0x0D, 0x08, 
-    0x01, 0x01, 0x02, 0x04, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x02, 0x13, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x02, 0x13, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x01, 0x01, 0x02, 0x13, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x01, 0x06, 0x04, 
-    0x02, 0x01, 0x13, 0x13, 0x04, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x0F, 0x02, 
-    0x04, 0x04, 0x0D, 0x13, 0x03, 0x13, 0x07, 0x3B, 0x04, 0x04, 0x0D, 0x04, 
-    0x06, 0x07, 0x07, 0x3B, 0x04, 0x04, 0x0D, 0x0C, 0x13, 0x0D, 0x12, 0x1B, 
-    0x04, 0x04, 0x08, 0x0C, 0x06, 0x08, 0x1E, 0x1F, 0x04, 0x04, 0x13, 0x04, 
-    0x08, 0x07, 0x21, 0x2E, 0x04, 0x04, 0x08, 0x04, 0x0C, 0x11, 0x1F, 0x21, 
-    0x0D, 0x12, 0x3A, 0x25, 0x0A, 0x07, 0x0D, 0x08, 0x4F, 0x36, 0x10, 0x07, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x45, 0x3A, 0x0C, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x45, 0x3A, 0x08, 0x08, 0x0D, 0x0D, 0x08, 0x07, 0x45, 0x27, 0x08, 0x08, 
-    0x0D, 0x0D, 0x08, 0x07, 0x30, 0x36, 0x08, 0x08, 0x0D, 0x0D, 0x0D, 0x07, 
-    0x12, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x11, 0x0C, 0x0D, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x07, 0x10, 0x07, 0x08, 0x0D, 0x0D, 0x14, 0x07, 0x10, 
-    0x10, 0x07, 0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x1E, 0x10, 0x07, 0x0D, 0x0D, 
-    0x0D, 0x07, 0x12, 0x21, 0x12, 0x07, 0x0D, 0x0D, 0x0D, 0x16, 0x1E, 0x1F, 
-    0x12, 0x07, 0x0D, 0x0D, 0x0D, 0x14, 0x1E, 0x21, 0x12, 0x07, 0x0D, 0x0D, 
-    0x0D, 0x10, 0x1F, 0x21, 0x10, 0x07, 0x0D, 0x0D, 0x07, 0x1E, 0x21, 0x21, 
-    0x12, 0x07, 0x0D, 0x0D, 0x11, 0x1E, 0x21, 0x21, 0x1E, 0x1F, 0x2E, 0x2F, 
-    0x36, 0x4B, 0x47, 0x3A, 0x12, 0x1F, 0x2E, 0x2F, 0x2C, 0x48, 0x3E, 0x39, 
-    0x12, 0x1F, 0x2E, 0x50, 0x3A, 0x49, 0x3F, 0x1E, 0x12, 0x1F, 0x2E, 0x36, 
-    0x2A, 0x49, 0x25, 0x46, 0x1F, 0x30, 0x2F, 0x3A, 0x49, 0x47, 0x51, 0x08, 
-    0x30, 0x2F, 0x32, 0x36, 0x48, 0x19, 0x08, 0x07, 0x30, 0x2E, 0x2F, 0x3A, 
-    0x48, 0x51, 0x1B, 0x07, 0x2F, 0x2E, 0x2F, 0x47, 0x48, 0x52, 0x07, 0x14, 
-    0x12, 0x31, 0x07, 0x14, 0x09, 0x0D, 0x0D, 0x09, 0x12, 0x31, 0x07, 0x09, 
-    0x09, 0x08, 0x0C, 0x09, 0x11, 0x08, 0x08, 0x07, 0x09, 0x07, 0x16, 0x14, 
-    0x0D, 0x19, 0x11, 0x07, 0x09, 0x1E, 0x21, 0x12, 0x08, 0x16, 0x16, 0x07, 
-    0x19, 0x30, 0x2F, 0x1F, 0x08, 0x10, 0x16, 0x08, 0x11, 0x30, 0x2F, 0x1F, 
-    0x07, 0x10, 0x16, 0x12, 0x30, 0x2F, 0x30, 0x1E, 0x12, 0x12, 0x16, 0x2E, 
-    0x29, 0x2F, 0x21, 0x1E, 0x1E, 0x12, 0x12, 0x2E, 0x29, 0x2F, 0x2E, 0x36, 
-    0x12, 0x1E, 0x2F, 0x2E, 0x36, 0x32, 0x2D, 0x48, 0x1F, 0x30, 0x2D, 0x39, 
-    0x36, 0x21, 0x3A, 0x43, 0x2F, 0x29, 0x21, 0x42, 0x4A, 0x39, 0x2A, 0x43, 
-    0x2E, 0x2E, 0x29, 0x2A, 0x2A, 0x3A, 0x2A, 0x43, 0x2E, 0x2F, 0x2D, 0x4A, 
-    0x2A, 0x48, 0x43, 0x53, 0x2E, 0x39, 0x2E, 0x54, 0x55, 0x49, 0x56, 0x49, 
-    0x2E, 0x39, 0x57, 0x58, 0x59, 0x49, 0x43, 0x42, 0x49, 0x4A, 0x2A, 0x49, 
-    0x48, 0x3A, 0x39, 0x36, 0x43, 0x2A, 0x48, 0x49, 0x49, 0x48, 0x47, 0x39, 
-    0x5A, 0x44, 0x44, 0x49, 0x49, 0x4A, 0x4A, 0x47, 0x43, 0x5B, 0x5C, 0x43, 
-    0x5C, 0x43, 0x2A, 0x4A, 0x56, 0x5D, 0x59, 0x5C, 0x5E, 0x56, 0x43, 0x2A, 
-    0x53, 0x5D, 0x5C, 0x59, 0x5F, 0x5D, 0x60, 0x61, 0x44, 0x5D, 0x62, 0x56, 
-    0x63, 0x64, 0x60, 0x61, 0x60, 0x65, 0x5B, 0x5B, 0x63, 0x66, 0x63, 0x67, 
-    0x39, 0x39, 0x3A, 0x2D, 0x2F, 0x2D, 0x30, 0x1F, 0x2D, 0x3A, 0x2A, 0x29, 
-    0x2E, 0x29, 0x1F, 0x1F, 0x36, 0x3E, 0x43, 0x3A, 0x36, 0x2D, 0x30, 0x21, 
-    0x47, 0x3A, 0x5A, 0x44, 0x2A, 0x36, 0x29, 0x21, 0x48, 0x4A, 0x4A, 0x56, 
-    0x49, 0x39, 0x3A, 0x3A, 0x68, 0x49, 0x2A, 0x53, 0x49, 0x3A, 0x2A, 0x49, 
-    0x5D, 0x69, 0x2A, 0x43, 0x49, 0x3A, 0x2A, 0x49, 0x6A, 0x67, 0x6B, 0x59, 
-    0x43, 0x4B, 0x2A, 0x43, 0x16, 0x07, 0x12, 0x19, 0x3E, 0x47, 0x2F, 0x2F, 
-    0x1F, 0x12, 0x12, 0x11, 0x3A, 0x3A, 0x2F, 0x2F, 0x30, 0x21, 0x12, 0x19, 
-    0x26, 0x47, 0x30, 0x2E, 0x21, 0x30, 0x1E, 0x6C, 0x6D, 0x48, 0x21, 0x2E, 
-    0x2F, 0x2D, 0x2E, 0x07, 0x3F, 0x3A, 0x2F, 0x2F, 0x2E, 0x36, 0x2E, 0x11, 
-    0x30, 0x3A, 0x2E, 0x2F, 0x29, 0x36, 0x2E, 0x16, 0x12, 0x1F, 0x21, 0x32, 
-    0x42, 0x39, 0x29, 0x32, 0x1F, 0x10, 0x1E, 0x3F, 0x10, 0x1E, 0x1F, 0x16, 
-    0x29, 0x30, 0x1E, 0x2E, 0x10, 0x2E, 0x29, 0x19, 0x36, 0x32, 0x12, 0x30, 
-    0x12, 0x2E, 0x29, 0x14, 0x30, 0x1F, 0x1E, 0x30, 0x1F, 0x2F, 0x2E, 0x11, 
-    0x1F, 0x26, 0x1E, 0x30, 0x1F, 0x30, 0x29, 0x10, 0x3F, 0x49, 0x21, 0x30, 
-    0x4B, 0x32, 0x2E, 0x1F, 0x3F, 0x48, 0x2E, 0x2E, 0x48, 0x29, 0x2F, 0x30, 
-    0x39, 0x49, 0x36, 0x36, 0x49, 0x26, 0x2F, 0x2F, 0x39, 0x48, 0x39, 0x39, 
-    0x2E, 0x2F, 0x21, 0x1E, 0x0D, 0x08, 0x01, 0x01, 0x2E, 0x32, 0x21, 0x10, 
-    0x08, 0x08, 0x01, 0x02, 0x2E, 0x2F, 0x1E, 0x16, 0x19, 0x08, 0x06, 0x03, 
-    0x2E, 0x2F, 0x1E, 0x1E, 0x12, 0x08, 0x07, 0x13, 0x2E, 0x2F, 0x1F, 0x12, 
-    0x16, 0x08, 0x0D, 0x0C, 0x2F, 0x2F, 0x32, 0x21, 0x10, 0x0D, 0x0D, 0x0D, 
-    0x32, 0x2E, 0x2F, 0x2E, 0x1F, 0x16, 0x07, 0x0D, 0x2F, 0x2E, 0x2F, 0x2F, 
-    0x32, 0x12, 0x11, 0x07, 0x02, 0x08, 0x07, 0x04, 0x06, 0x06, 0x06, 0x06, 
-    0x02, 0x08, 0x09, 0x08, 0x06, 0x06, 0x06, 0x06, 0x02, 0x08, 0x11, 0x08, 
-    0x0C, 0x13, 0x06, 0x06, 0x02, 0x04, 0x08, 0x09, 0x09, 0x06, 0x0C, 0x13, 
-    0x03, 0x01, 0x03, 0x09, 0x1F, 0x09, 0x08, 0x07, 0x0D, 0x03, 0x04, 0x09, 
-    0x21, 0x06, 0x4C, 0x36, 0x0D, 0x03, 0x04, 0x07, 0x30, 0x06, 0x4D, 0x27, 
-    0x0D, 0x08, 0x04, 0x08, 0x12, 0x46, 0x4D, 0x27, 0x06, 0x04, 0x09, 0x16, 
-    0x46, 0x3F, 0x27, 0x10, 0x13, 0x0C, 0x09, 0x16, 0x46, 0x4D, 0x27, 0x09, 
-    0x13, 0x0C, 0x08, 0x07, 0x0C, 0x32, 0x2E, 0x2F, 0x06, 0x13, 0x13, 0x08, 
-    0x31, 0x30, 0x2F, 0x2C, 0x08, 0x06, 0x06, 0x0F, 0x22, 0x45, 0x30, 0x2C, 
-    0x04, 0x08, 0x13, 0x06, 0x13, 0x0C, 0x06, 0x32, 0x0C, 0x08, 0x13, 0x06, 
-    0x13, 0x0C, 0x07, 0x0C, 0x06, 0x08, 0x13, 0x06, 0x06, 0x13, 0x07, 0x0D, 
-    0x08, 0x08, 0x09, 0x08, 0x03, 0x02, 0x01, 0x01, 0x08, 0x07, 0x11, 0x08, 
-    0x03, 0x02, 0x01, 0x01, 0x3F, 0x6E, 0x11, 0x08, 0x03, 0x02, 0x01, 0x01, 
-    0x3A, 0x0C, 0x11, 0x08, 0x03, 0x02, 0x01, 0x01, 0x27, 0x1F, 0x12, 0x08, 
-    0x03, 0x02, 0x01, 0x02, 0x2C, 0x2E, 0x1E, 0x0C, 0x03, 0x01, 0x01, 0x01, 
-    0x1E, 0x4B, 0x1E, 0x0D, 0x06, 0x04, 0x06, 0x09, 0x21, 0x27, 0x1E, 0x08, 
-    0x08, 0x13, 0x06, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x08, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x13, 0x06, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x05, 0x0A, 0x04, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x03, 0x06, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x08, 
-    0x0A, 0x01, 0x02, 0x01, 0x01, 0x02, 0x03, 0x06, 0x03, 0x04, 0x03, 0x02, 
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 
-    0x01, 0x01, 0x08, 0x3A, 0x36, 0x12, 0x2E, 0x1F, 0x01, 0x20, 0x0F, 0x39, 
-    0x3A, 0x30, 0x30, 0x1F, 0x01, 0x01, 0x01, 0x19, 0x29, 0x30, 0x30, 0x2F, 
-    0x01, 0x01, 0x02, 0x15, 0x37, 0x1E, 0x2F, 0x2E, 0x01, 0x01, 0x01, 0x03, 
-    0x40, 0x45, 0x36, 0x29, 0x01, 0x01, 0x02, 0x03, 0x1A, 0x45, 0x36, 0x2F, 
-    0x01, 0x01, 0x02, 0x03, 0x1A, 0x45, 0x4B, 0x2E, 0x01, 0x01, 0x01, 0x0B, 
-    0x1A, 0x25, 0x32, 0x2E, 0x22, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x0C, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x6E, 0x0D, 0x0E, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x21, 0x0D, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x36, 0x07, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x12, 0x0C, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x39, 0x30, 0x08, 0x06, 0x01, 0x02, 0x01, 0x01, 
-    0x39, 0x21, 0x10, 0x0C, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1A, 0x29, 
-    0x30, 0x3C, 0x17, 0x18, 0x01, 0x01, 0x1A, 0x2C, 0x2D, 0x07, 0x04, 0x1A, 
-    0x01, 0x01, 0x24, 0x26, 0x2C, 0x10, 0x0D, 0x1A, 0x01, 0x01, 0x24, 0x6F, 
-    0x3E, 0x30, 0x0D, 0x1A, 0x01, 0x03, 0x24, 0x6F, 0x4A, 0x2F, 0x0D, 0x1A, 
-    0x01, 0x17, 0x24, 0x6D, 0x2A, 0x30, 0x0D, 0x22, 0x01, 0x17, 0x24, 0x6D, 
-    0x2A, 0x30, 0x08, 0x01, 0x01, 0x17, 0x24, 0x6D, 0x2A, 0x2F, 0x09, 0x05, 
-    0x1F, 0x1F, 0x02, 0x0B, 0x01, 0x4E, 0x4C, 0x21, 0x1F, 0x1E, 0x02, 0x03, 
-    0x01, 0x4E, 0x4C, 0x21, 0x1F, 0x1E, 0x15, 0x03, 0x18, 0x4E, 0x4C, 0x21, 
-    0x1F, 0x1E, 0x18, 0x03, 0x02, 0x4E, 0x4C, 0x1F, 0x1F, 0x1E, 0x22, 0x01, 
-    0x02, 0x18, 0x2F, 0x21, 0x1F, 0x1E, 0x22, 0x01, 0x02, 0x22, 0x32, 0x21, 
-    0x37, 0x08, 0x02, 0x01, 0x02, 0x22, 0x2F, 0x21, 0x05, 0x15, 0x01, 0x01, 
-    0x02, 0x22, 0x32, 0x21, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x1E, 0x09, 
-    0x01, 0x01, 0x01, 0x0B, 0x03, 0x04, 0x1F, 0x09, 0x01, 0x01, 0x01, 0x05, 
-    0x03, 0x08, 0x09, 0x04, 0x01, 0x02, 0x01, 0x19, 0x04, 0x04, 0x0A, 0x02, 
-    0x01, 0x02, 0x0A, 0x30, 0x1B, 0x04, 0x10, 0x04, 0x01, 0x02, 0x03, 0x30, 
-    0x1B, 0x04, 0x2E, 0x25, 0x01, 0x02, 0x03, 0x30, 0x09, 0x3C, 0x2D, 0x1F, 
-    0x01, 0x02, 0x0A, 0x1F, 0x1B, 0x22, 0x2E, 0x1F, 0x1A, 0x01, 0x01, 0x02, 
-    0x01, 0x04, 0x0D, 0x04, 0x1A, 0x01, 0x01, 0x02, 0x01, 0x13, 0x0D, 0x04, 
-    0x05, 0x01, 0x01, 0x02, 0x01, 0x13, 0x0D, 0x04, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x04, 0x0D, 0x0A, 0x15, 0x01, 0x01, 0x02, 0x01, 0x06, 0x0D, 0x04, 
-    0x1A, 0x01, 0x02, 0x02, 0x01, 0x06, 0x0D, 0x08, 0x1A, 0x03, 0x02, 0x02, 
-    0x01, 0x0C, 0x0D, 0x08, 0x1A, 0x03, 0x02, 0x01, 0x04, 0x0D, 0x0D, 0x0D, 
-    0x05, 0x03, 0x06, 0x12, 0x37, 0x22, 0x01, 0x02, 0x05, 0x0B, 0x04, 0x22, 
-    0x15, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x06, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x0C, 0x13, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x08, 0x0D, 0x01, 0x01, 0x02, 0x13, 
-    0x08, 0x0C, 0x0D, 0x08, 0x01, 0x01, 0x02, 0x13, 0x08, 0x04, 0x08, 0x0C, 
-    0x01, 0x01, 0x02, 0x0C, 0x08, 0x04, 0x08, 0x08, 0x01, 0x02, 0x01, 0x0D, 
-    0x08, 0x06, 0x09, 0x0D, 0x01, 0x05, 0x06, 0x11, 0x08, 0x08, 0x0D, 0x08, 
-    0x01, 0x05, 0x06, 0x11, 0x13, 0x0C, 0x07, 0x0D, 0x01, 0x05, 0x06, 0x11, 
-    0x06, 0x0C, 0x09, 0x09, 0x01, 0x05, 0x06, 0x09, 0x06, 0x0C, 0x11, 0x07, 
-    0x03, 0x07, 0x08, 0x01, 0x0C, 0x09, 0x12, 0x10, 0x03, 0x19, 0x19, 0x34, 
-    0x08, 0x07, 0x10, 0x09, 0x06, 0x07, 0x3A, 0x2D, 0x0A, 0x09, 0x10, 0x11, 
-    0x06, 0x31, 0x47, 0x2C, 0x22, 0x09, 0x10, 0x11, 0x08, 0x0C, 0x42, 0x2C, 
-    0x3C, 0x1F, 0x1E, 0x07, 0x09, 0x07, 0x47, 0x2C, 0x46, 0x29, 0x1E, 0x31, 
-    0x07, 0x2C, 0x39, 0x10, 0x0D, 0x2D, 0x1E, 0x0C, 0x11, 0x3E, 0x29, 0x0F, 
-    0x1F, 0x1F, 0x16, 0x0D, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x07, 
-    0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x0D, 0x08, 0x08, 0x0D, 0x0D, 0x0D, 
-    0x07, 0x09, 0x08, 0x07, 0x08, 0x0D, 0x09, 0x08, 0x11, 0x19, 0x0D, 0x10, 
-    0x08, 0x07, 0x12, 0x08, 0x07, 0x11, 0x07, 0x19, 0x0D, 0x0D, 0x12, 0x08, 
-    0x07, 0x14, 0x07, 0x16, 0x0D, 0x0D, 0x12, 0x08, 0x1B, 0x16, 0x1E, 0x16, 
-    0x0D, 0x07, 0x12, 0x07, 0x11, 0x1E, 0x30, 0x1F, 0x10, 0x07, 0x08, 0x09, 
-    0x10, 0x1E, 0x30, 0x1E, 0x07, 0x08, 0x09, 0x16, 0x1E, 0x2F, 0x2E, 0x1F, 
-    0x07, 0x08, 0x14, 0x1F, 0x21, 0x2E, 0x32, 0x1E, 0x07, 0x11, 0x1F, 0x21, 
-    0x1F, 0x30, 0x2F, 0x12, 0x09, 0x12, 0x21, 0x21, 0x1F, 0x30, 0x30, 0x1F, 
-    0x12, 0x1F, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x12, 0x1F, 0x21, 0x21, 
-    0x21, 0x21, 0x21, 0x21, 0x1F, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 
-    0x30, 0x2F, 0x50, 0x2A, 0x48, 0x1F, 0x14, 0x14, 0x21, 0x3A, 0x39, 0x57, 
-    0x2D, 0x1F, 0x16, 0x11, 0x1F, 0x42, 0x47, 0x70, 0x12, 0x1E, 0x16, 0x11, 
-    0x30, 0x2E, 0x4F, 0x32, 0x29, 0x21, 0x10, 0x16, 0x30, 0x30, 0x1F, 0x2E, 
-    0x36, 0x21, 0x12, 0x1E, 0x1F, 0x2F, 0x29, 0x36, 0x36, 0x21, 0x10, 0x12, 
-    0x21, 0x2F, 0x29, 0x36, 0x29, 0x1F, 0x1E, 0x1F, 0x30, 0x2E, 0x3A, 0x27, 
-    0x39, 0x2E, 0x21, 0x2F, 0x1E, 0x1E, 0x16, 0x2F, 0x36, 0x2E, 0x36, 0x30, 
-    0x1F, 0x1F, 0x11, 0x30, 0x39, 0x4B, 0x4A, 0x39, 0x10, 0x10, 0x11, 0x30, 
-    0x4B, 0x48, 0x2A, 0x39, 0x09, 0x11, 0x12, 0x2F, 0x4A, 0x53, 0x2A, 0x4B, 
-    0x1F, 0x2F, 0x2E, 0x3A, 0x49, 0x53, 0x2A, 0x3A, 0x30, 0x29, 0x36, 0x2A, 
-    0x44, 0x49, 0x3A, 0x3E, 0x30, 0x2D, 0x36, 0x2A, 0x43, 0x56, 0x42, 0x47, 
-    0x2F, 0x3A, 0x3E, 0x55, 0x59, 0x49, 0x2A, 0x49, 0x2D, 0x39, 0x27, 0x55, 
-    0x71, 0x53, 0x5C, 0x68, 0x2D, 0x4A, 0x49, 0x55, 0x5B, 0x59, 0x72, 0x73, 
-    0x3E, 0x48, 0x48, 0x74, 0x62, 0x5E, 0x75, 0x66, 0x42, 0x49, 0x2A, 0x28, 
-    0x5F, 0x63, 0x76, 0x76, 0x47, 0x2A, 0x4A, 0x28, 0x65, 0x76, 0x76, 0x76, 
-    0x2A, 0x2A, 0x6B, 0x67, 0x75, 0x76, 0x76, 0x76, 0x2A, 0x2A, 0x5C, 0x73, 
-    0x66, 0x76, 0x76, 0x76, 0x49, 0x48, 0x53, 0x73, 0x66, 0x76, 0x76, 0x76, 
-    0x5E, 0x75, 0x73, 0x64, 0x76, 0x76, 0x76, 0x76, 0x77, 0x76, 0x66, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x67, 0x61, 0x56, 0x5A, 0x42, 0x43, 0x44, 
-    0x76, 0x72, 0x5C, 0x49, 0x2A, 0x78, 0x71, 0x74, 0x76, 0x77, 0x62, 0x48, 
-    0x4A, 0x54, 0x77, 0x63, 0x66, 0x64, 0x5B, 0x55, 0x61, 0x2B, 0x6A, 0x77, 
-    0x76, 0x6A, 0x79, 0x43, 0x68, 0x5B, 0x75, 0x76, 0x76, 0x66, 0x77, 0x44, 
-    0x62, 0x63, 0x76, 0x76, 0x76, 0x66, 0x77, 0x62, 0x73, 0x76, 0x76, 0x66, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x44, 0x3A, 0x3A, 0x3A, 
-    0x30, 0x2F, 0x2F, 0x2E, 0x55, 0x42, 0x3A, 0x36, 0x2F, 0x2C, 0x2D, 0x30, 
-    0x59, 0x2A, 0x47, 0x4B, 0x30, 0x29, 0x29, 0x2E, 0x5C, 0x48, 0x2A, 0x3A, 
-    0x21, 0x2E, 0x27, 0x3E, 0x5E, 0x49, 0x4A, 0x2A, 0x32, 0x2F, 0x42, 0x48, 
-    0x73, 0x5A, 0x4A, 0x2A, 0x36, 0x2E, 0x3E, 0x48, 0x64, 0x44, 0x2A, 0x2A, 
-    0x4A, 0x3A, 0x3E, 0x5A, 0x6A, 0x60, 0x6B, 0x2A, 0x2A, 0x4A, 0x42, 0x53, 
-    0x49, 0x2C, 0x50, 0x32, 0x39, 0x48, 0x39, 0x39, 0x39, 0x3A, 0x2D, 0x2F, 
-    0x29, 0x3A, 0x36, 0x29, 0x2F, 0x39, 0x39, 0x29, 0x2E, 0x30, 0x2F, 0x39, 
-    0x2F, 0x2F, 0x2D, 0x4B, 0x2E, 0x2F, 0x2E, 0x39, 0x2F, 0x2F, 0x2F, 0x2F, 
-    0x2E, 0x2E, 0x2F, 0x39, 0x29, 0x2D, 0x2E, 0x2D, 0x30, 0x47, 0x3A, 0x39, 
-    0x36, 0x36, 0x2E, 0x36, 0x1F, 0x48, 0x47, 0x36, 0x49, 0x3A, 0x2F, 0x36, 
-    0x29, 0x48, 0x47, 0x39, 0x2F, 0x2E, 0x2F, 0x2F, 0x2E, 0x1F, 0x16, 0x09, 
-    0x30, 0x32, 0x2F, 0x2F, 0x2F, 0x30, 0x16, 0x07, 0x30, 0x1E, 0x2E, 0x2F, 
-    0x2D, 0x2F, 0x1E, 0x19, 0x21, 0x12, 0x2E, 0x32, 0x4B, 0x2D, 0x1E, 0x12, 
-    0x32, 0x30, 0x2E, 0x32, 0x3A, 0x29, 0x30, 0x1E, 0x36, 0x30, 0x36, 0x36, 
-    0x39, 0x29, 0x30, 0x1F, 0x2D, 0x1F, 0x2D, 0x2F, 0x39, 0x29, 0x30, 0x1F, 
-    0x39, 0x1F, 0x3F, 0x29, 0x39, 0x29, 0x2E, 0x1E, 0x07, 0x11, 0x0C, 0x08, 
-    0x07, 0x07, 0x2F, 0x2D, 0x19, 0x11, 0x0D, 0x07, 0x0D, 0x1F, 0x21, 0x0C, 
-    0x14, 0x11, 0x08, 0x0D, 0x04, 0x1F, 0x1F, 0x32, 0x09, 0x09, 0x0D, 0x0D, 
-    0x04, 0x1F, 0x1E, 0x29, 0x0D, 0x09, 0x0D, 0x0D, 0x04, 0x1F, 0x21, 0x3A, 
-    0x11, 0x09, 0x08, 0x0D, 0x0C, 0x10, 0x1E, 0x4A, 0x0D, 0x11, 0x08, 0x0D, 
-    0x0D, 0x08, 0x0C, 0x36, 0x10, 0x11, 0x07, 0x16, 0x16, 0x09, 0x0D, 0x7A, 
-    0x08, 0x0D, 0x0C, 0x06, 0x07, 0x08, 0x0C, 0x0A, 0x11, 0x0D, 0x0D, 0x0D, 
-    0x09, 0x08, 0x04, 0x13, 0x30, 0x6E, 0x07, 0x07, 0x14, 0x07, 0x13, 0x13, 
-    0x2D, 0x0A, 0x07, 0x0D, 0x14, 0x07, 0x08, 0x08, 0x39, 0x0D, 0x0D, 0x07, 
-    0x14, 0x07, 0x0D, 0x08, 0x39, 0x6C, 0x0D, 0x07, 0x14, 0x07, 0x08, 0x07, 
-    0x48, 0x6D, 0x1A, 0x07, 0x14, 0x07, 0x08, 0x07, 0x47, 0x78, 0x6C, 0x07, 
-    0x14, 0x07, 0x08, 0x0D, 0x25, 0x3A, 0x1E, 0x0C, 0x08, 0x08, 0x0F, 0x10, 
-    0x08, 0x10, 0x11, 0x08, 0x08, 0x08, 0x09, 0x30, 0x06, 0x08, 0x0C, 0x0C, 
-    0x04, 0x0C, 0x37, 0x52, 0x06, 0x0C, 0x06, 0x13, 0x06, 0x31, 0x23, 0x29, 
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x3B, 0x7B, 0x48, 0x07, 0x06, 0x13, 0x06, 
-    0x08, 0x3B, 0x7B, 0x48, 0x07, 0x08, 0x06, 0x13, 0x0D, 0x46, 0x7B, 0x48, 
-    0x0D, 0x0D, 0x0C, 0x0D, 0x07, 0x3B, 0x7B, 0x48, 0x1B, 0x0E, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x16, 0x1D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0D, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x05, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x7C, 0x22, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x7C, 0x22, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7C, 0x22, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x38, 0x1D, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x24, 0x1F, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0B, 0x22, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x1A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x22, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x36, 0x29, 0x30, 0x31, 
-    0x0E, 0x03, 0x01, 0x01, 0x1E, 0x42, 0x29, 0x11, 0x11, 0x08, 0x02, 0x01, 
-    0x51, 0x47, 0x2C, 0x09, 0x08, 0x13, 0x02, 0x01, 0x23, 0x4A, 0x3F, 0x08, 
-    0x04, 0x04, 0x01, 0x01, 0x38, 0x29, 0x2E, 0x07, 0x04, 0x04, 0x02, 0x02, 
-    0x05, 0x1A, 0x1F, 0x16, 0x06, 0x04, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x11, 
-    0x09, 0x06, 0x06, 0x01, 0x01, 0x01, 0x1A, 0x1E, 0x30, 0x13, 0x13, 0x03, 
-    0x01, 0x17, 0x24, 0x6D, 0x2A, 0x2E, 0x09, 0x15, 0x01, 0x17, 0x24, 0x6D, 
-    0x2A, 0x30, 0x09, 0x18, 0x01, 0x0B, 0x24, 0x26, 0x4A, 0x2E, 0x09, 0x15, 
-    0x01, 0x02, 0x01, 0x34, 0x30, 0x29, 0x38, 0x02, 0x01, 0x02, 0x03, 0x40, 
-    0x4F, 0x36, 0x19, 0x01, 0x01, 0x02, 0x03, 0x1A, 0x45, 0x3A, 0x10, 0x01, 
-    0x02, 0x02, 0x03, 0x1A, 0x4F, 0x3A, 0x10, 0x01, 0x03, 0x01, 0x01, 0x20, 
-    0x06, 0x47, 0x32, 0x22, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x10, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x19, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x1B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x1B, 0x10, 
-    0x03, 0x6E, 0x2E, 0x4F, 0x01, 0x1A, 0x19, 0x12, 0x0C, 0x07, 0x2E, 0x4F, 
-    0x01, 0x1A, 0x09, 0x12, 0x13, 0x0D, 0x2E, 0x41, 0x01, 0x1A, 0x19, 0x12, 
-    0x04, 0x09, 0x2D, 0x7D, 0x01, 0x1A, 0x09, 0x16, 0x37, 0x30, 0x4F, 0x35, 
-    0x01, 0x15, 0x08, 0x0C, 0x09, 0x21, 0x01, 0x22, 0x01, 0x05, 0x0C, 0x08, 
-    0x09, 0x1F, 0x0B, 0x01, 0x01, 0x1A, 0x09, 0x1F, 0x09, 0x1F, 0x0B, 0x01, 
-    0x1A, 0x03, 0x02, 0x0E, 0x08, 0x0D, 0x0D, 0x0C, 0x1A, 0x03, 0x02, 0x01, 
-    0x0C, 0x0D, 0x08, 0x02, 0x1A, 0x03, 0x02, 0x01, 0x04, 0x0D, 0x06, 0x02, 
-    0x1A, 0x0B, 0x02, 0x03, 0x06, 0x13, 0x01, 0x01, 0x15, 0x02, 0x04, 0x03, 
-    0x03, 0x03, 0x02, 0x01, 0x0B, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x03, 0x08, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x13, 
-    0x01, 0x01, 0x02, 0x01, 0x04, 0x03, 0x03, 0x01, 0x01, 0x01, 0x02, 0x03, 
-    0x08, 0x03, 0x03, 0x01, 0x01, 0x02, 0x0A, 0x0C, 0x08, 0x01, 0x02, 0x02, 
-    0x01, 0x01, 0x13, 0x11, 0x0D, 0x02, 0x01, 0x05, 0x01, 0x02, 0x13, 0x07, 
-    0x0A, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x08, 0x02, 0x02, 0x01, 0x02, 
-    0x01, 0x15, 0x08, 0x11, 0x13, 0x0C, 0x09, 0x07, 0x01, 0x15, 0x1B, 0x14, 
-    0x13, 0x08, 0x0D, 0x07, 0x01, 0x15, 0x1B, 0x14, 0x13, 0x08, 0x0D, 0x07, 
-    0x01, 0x15, 0x1B, 0x14, 0x13, 0x08, 0x0D, 0x07, 0x03, 0x0A, 0x1B, 0x14, 
-    0x13, 0x08, 0x0D, 0x07, 0x1C, 0x07, 0x09, 0x11, 0x13, 0x08, 0x0D, 0x07, 
-    0x04, 0x08, 0x08, 0x09, 0x13, 0x08, 0x0D, 0x07, 0x04, 0x08, 0x08, 0x09, 
-    0x06, 0x08, 0x0D, 0x07, 0x19, 0x27, 0x29, 0x16, 0x32, 0x1B, 0x0C, 0x0D, 
-    0x19, 0x3E, 0x2D, 0x0F, 0x32, 0x07, 0x08, 0x0D, 0x19, 0x3A, 0x3E, 0x32, 
-    0x1F, 0x07, 0x08, 0x0D, 0x19, 0x3A, 0x2A, 0x7E, 0x0C, 0x08, 0x0D, 0x0D, 
-    0x19, 0x3E, 0x3F, 0x24, 0x07, 0x0D, 0x0D, 0x0D, 0x19, 0x3E, 0x3F, 0x02, 
-    0x07, 0x0D, 0x0D, 0x08, 0x6C, 0x78, 0x2C, 0x22, 0x09, 0x07, 0x08, 0x11, 
-    0x11, 0x32, 0x1E, 0x0A, 0x0D, 0x0D, 0x0C, 0x10, 0x0D, 0x07, 0x12, 0x11, 
-    0x0D, 0x10, 0x2F, 0x30, 0x0D, 0x0D, 0x10, 0x08, 0x1F, 0x3E, 0x30, 0x30, 
-    0x0D, 0x0D, 0x16, 0x04, 0x4C, 0x43, 0x2E, 0x30, 0x0D, 0x0D, 0x16, 0x04, 
-    0x2F, 0x48, 0x2F, 0x2E, 0x08, 0x0D, 0x16, 0x0C, 0x2F, 0x48, 0x2F, 0x2F, 
-    0x1E, 0x1F, 0x14, 0x0D, 0x2F, 0x48, 0x2F, 0x2E, 0x2D, 0x2F, 0x19, 0x08, 
-    0x32, 0x48, 0x2E, 0x36, 0x36, 0x30, 0x14, 0x08, 0x2F, 0x48, 0x29, 0x27, 
-    0x21, 0x21, 0x21, 0x1F, 0x21, 0x21, 0x30, 0x1F, 0x21, 0x21, 0x30, 0x2F, 
-    0x1F, 0x30, 0x36, 0x2F, 0x1F, 0x1F, 0x30, 0x29, 0x30, 0x30, 0x39, 0x2E, 
-    0x30, 0x1F, 0x2E, 0x39, 0x30, 0x2F, 0x36, 0x2E, 0x1F, 0x21, 0x2E, 0x36, 
-    0x29, 0x29, 0x39, 0x39, 0x2D, 0x32, 0x32, 0x29, 0x36, 0x2D, 0x39, 0x2A, 
-    0x3A, 0x2E, 0x32, 0x29, 0x36, 0x29, 0x39, 0x48, 0x3A, 0x2E, 0x2F, 0x2F, 
-    0x2F, 0x29, 0x39, 0x48, 0x2F, 0x27, 0x2A, 0x2A, 0x3A, 0x2E, 0x2F, 0x2E, 
-    0x32, 0x42, 0x48, 0x4A, 0x3A, 0x39, 0x2F, 0x29, 0x2F, 0x4A, 0x48, 0x47, 
-    0x27, 0x3A, 0x2F, 0x39, 0x27, 0x48, 0x48, 0x2A, 0x27, 0x27, 0x39, 0x39, 
-    0x2A, 0x49, 0x49, 0x49, 0x42, 0x3A, 0x42, 0x39, 0x2A, 0x49, 0x49, 0x49, 
-    0x3E, 0x42, 0x4A, 0x39, 0x49, 0x49, 0x49, 0x49, 0x3E, 0x78, 0x2A, 0x36, 
-    0x49, 0x49, 0x5A, 0x49, 0x3E, 0x47, 0x2A, 0x39, 0x29, 0x4A, 0x48, 0x53, 
-    0x49, 0x47, 0x48, 0x49, 0x4A, 0x47, 0x4A, 0x5C, 0x7F, 0x47, 0x49, 0x49, 
-    0x2A, 0x48, 0x49, 0x5A, 0x80, 0x48, 0x49, 0x49, 0x4A, 0x74, 0x5C, 0x4A, 
-    0x4A, 0x48, 0x44, 0x49, 0x4A, 0x5A, 0x53, 0x2A, 0x2A, 0x55, 0x59, 0x48, 
-    0x4A, 0x5A, 0x53, 0x49, 0x2A, 0x2B, 0x5B, 0x28, 0x4A, 0x5A, 0x56, 0x48, 
-    0x48, 0x74, 0x5D, 0x5C, 0x4A, 0x5A, 0x59, 0x5A, 0x48, 0x28, 0x5D, 0x5D, 
-    0x49, 0x49, 0x68, 0x63, 0x66, 0x76, 0x76, 0x76, 0x49, 0x49, 0x5E, 0x77, 
-    0x66, 0x76, 0x76, 0x76, 0x43, 0x59, 0x5F, 0x64, 0x66, 0x76, 0x76, 0x76, 
-    0x74, 0x5F, 0x5F, 0x77, 0x66, 0x76, 0x76, 0x76, 0x7F, 0x5E, 0x63, 0x75, 
-    0x76, 0x76, 0x76, 0x76, 0x5B, 0x72, 0x75, 0x66, 0x76, 0x76, 0x76, 0x76, 
-    0x5E, 0x6A, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x75, 0x5E, 0x61, 0x4A, 0x2A, 0x3E, 0x36, 0x5A, 0x76, 0x64, 0x60, 0x81, 
-    0x2A, 0x42, 0x2D, 0x36, 0x76, 0x66, 0x65, 0x61, 0x2A, 0x42, 0x29, 0x2C, 
-    0x76, 0x66, 0x63, 0x28, 0x4A, 0x42, 0x29, 0x2C, 0x76, 0x66, 0x77, 0x5E, 
-    0x2A, 0x2A, 0x27, 0x27, 0x76, 0x76, 0x75, 0x72, 0x53, 0x48, 0x74, 0x5C, 
-    0x76, 0x76, 0x66, 0x75, 0x5E, 0x62, 0x5B, 0x73, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x72, 0x62, 0x66, 0x56, 0x7E, 0x50, 0x36, 0x29, 0x48, 0x42, 0x2F, 
-    0x5A, 0x3E, 0x2F, 0x36, 0x2D, 0x48, 0x2A, 0x2F, 0x43, 0x7E, 0x2D, 0x36, 
-    0x3E, 0x49, 0x5A, 0x36, 0x53, 0x48, 0x42, 0x3A, 0x43, 0x56, 0x49, 0x3A, 
-    0x7F, 0x43, 0x44, 0x48, 0x4A, 0x43, 0x43, 0x42, 0x62, 0x62, 0x53, 0x49, 
-    0x27, 0x48, 0x43, 0x3E, 0x72, 0x5E, 0x62, 0x53, 0x5A, 0x43, 0x53, 0x42, 
-    0x73, 0x82, 0x79, 0x53, 0x43, 0x48, 0x53, 0x55, 0x4B, 0x21, 0x3A, 0x4A, 
-    0x50, 0x2F, 0x2E, 0x1E, 0x2D, 0x1F, 0x2C, 0x27, 0x2F, 0x2F, 0x2E, 0x1E, 
-    0x3A, 0x32, 0x2C, 0x4A, 0x2E, 0x2F, 0x2E, 0x30, 0x3A, 0x36, 0x2C, 0x3E, 
-    0x39, 0x2F, 0x32, 0x2F, 0x36, 0x3A, 0x2E, 0x2D, 0x4A, 0x2E, 0x1F, 0x2F, 
-    0x3A, 0x47, 0x39, 0x39, 0x4A, 0x2E, 0x30, 0x2F, 0x47, 0x49, 0x47, 0x39, 
-    0x36, 0x29, 0x3A, 0x2F, 0x47, 0x49, 0x47, 0x39, 0x2F, 0x29, 0x2A, 0x2F, 
-    0x1E, 0x16, 0x07, 0x12, 0x12, 0x09, 0x09, 0x0B, 0x0D, 0x0D, 0x07, 0x0D, 
-    0x07, 0x16, 0x07, 0x83, 0x1F, 0x16, 0x31, 0x10, 0x10, 0x11, 0x07, 0x1A, 
-    0x29, 0x1F, 0x14, 0x1F, 0x1F, 0x07, 0x09, 0x01, 0x36, 0x29, 0x30, 0x10, 
-    0x1F, 0x11, 0x07, 0x08, 0x2E, 0x29, 0x21, 0x12, 0x30, 0x11, 0x1F, 0x30, 
-    0x2F, 0x2E, 0x1F, 0x12, 0x30, 0x30, 0x2E, 0x2E, 0x2F, 0x2E, 0x32, 0x1F, 
-    0x12, 0x2F, 0x36, 0x2E, 0x3E, 0x47, 0x1F, 0x10, 0x11, 0x07, 0x08, 0x0D, 
-    0x3A, 0x78, 0x50, 0x1E, 0x11, 0x07, 0x08, 0x0D, 0x3A, 0x2A, 0x50, 0x12, 
-    0x11, 0x07, 0x08, 0x0D, 0x2C, 0x3E, 0x30, 0x1E, 0x11, 0x07, 0x08, 0x07, 
-    0x19, 0x12, 0x29, 0x1E, 0x09, 0x07, 0x0D, 0x16, 0x11, 0x16, 0x3A, 0x21, 
-    0x09, 0x07, 0x08, 0x09, 0x1E, 0x06, 0x10, 0x1F, 0x09, 0x0D, 0x0D, 0x07, 
-    0x1E, 0x0C, 0x07, 0x19, 0x07, 0x08, 0x11, 0x16, 0x0D, 0x0D, 0x0D, 0x08, 
-    0x07, 0x46, 0x1F, 0x2A, 0x0D, 0x0D, 0x08, 0x0C, 0x0D, 0x08, 0x08, 0x1F, 
-    0x0D, 0x0D, 0x08, 0x0C, 0x0D, 0x0C, 0x08, 0x0D, 0x07, 0x0D, 0x0D, 0x0C, 
-    0x0D, 0x0D, 0x0D, 0x06, 0x09, 0x08, 0x0D, 0x08, 0x0C, 0x07, 0x08, 0x13, 
-    0x09, 0x08, 0x0D, 0x0D, 0x08, 0x11, 0x0D, 0x13, 0x14, 0x07, 0x08, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x09, 0x07, 0x07, 0x07, 0x0D, 0x0D, 0x07, 0x14, 
-    0x51, 0x46, 0x0C, 0x02, 0x01, 0x01, 0x01, 0x01, 0x09, 0x04, 0x0D, 0x0B, 
-    0x02, 0x01, 0x01, 0x01, 0x08, 0x13, 0x0C, 0x03, 0x02, 0x01, 0x01, 0x01, 
-    0x13, 0x13, 0x06, 0x03, 0x02, 0x01, 0x01, 0x01, 0x06, 0x06, 0x06, 0x03, 
-    0x02, 0x01, 0x01, 0x01, 0x13, 0x13, 0x06, 0x03, 0x02, 0x01, 0x01, 0x01, 
-    0x0C, 0x06, 0x06, 0x03, 0x02, 0x01, 0x01, 0x01, 0x14, 0x0D, 0x06, 0x06, 
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x04, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x0C, 0x04, 0x01, 0x01, 0x01, 0x02, 0x0E, 0x0D, 0x0D, 0x0C, 
-    0x01, 0x01, 0x01, 0x02, 0x0A, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 
-    0x02, 0x01, 0x01, 0x01, 0x0A, 0x0E, 0x01, 0x03, 0x04, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x24, 0x30, 0x36, 0x1B, 0x08, 0x06, 0x01, 0x01, 0x24, 0x30, 
-    0x39, 0x2F, 0x19, 0x04, 0x01, 0x01, 0x15, 0x09, 0x12, 0x2F, 0x10, 0x04, 
-    0x01, 0x01, 0x01, 0x05, 0x40, 0x25, 0x30, 0x46, 0x01, 0x01, 0x02, 0x03, 
-    0x1A, 0x1F, 0x2D, 0x12, 0x01, 0x01, 0x02, 0x01, 0x1A, 0x25, 0x30, 0x1F, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x20, 0x06, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x15, 0x03, 0x4A, 0x29, 0x22, 
-    0x04, 0x01, 0x01, 0x02, 0x0A, 0x4A, 0x26, 0x0C, 0x06, 0x01, 0x02, 0x02, 
-    0x02, 0x2A, 0x3E, 0x11, 0x0A, 0x01, 0x01, 0x02, 0x02, 0x4A, 0x3A, 0x08, 
-    0x37, 0x01, 0x0B, 0x05, 0x01, 0x47, 0x2C, 0x0D, 0x09, 0x02, 0x01, 0x02, 
-    0x01, 0x4A, 0x39, 0x11, 0x08, 0x13, 0x0B, 0x02, 0x02, 0x48, 0x3A, 0x6E, 
-    0x0A, 0x04, 0x02, 0x02, 0x18, 0x25, 0x32, 0x1B, 0x0B, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x06, 0x15, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x30, 0x19, 0x15, 0x01, 0x02, 0x01, 0x01, 0x01, 0x29, 0x1F, 0x22, 0x0B, 
-    0x02, 0x01, 0x01, 0x01, 0x2D, 0x1F, 0x22, 0x0B, 0x02, 0x01, 0x01, 0x01, 
-    0x2D, 0x1F, 0x22, 0x0B, 0x02, 0x01, 0x01, 0x01, 0x2D, 0x1F, 0x22, 0x0B, 
-    0x02, 0x01, 0x01, 0x02, 0x2E, 0x1F, 0x22, 0x0B, 0x02, 0x01, 0x01, 0x0A, 
-    0x01, 0x18, 0x19, 0x30, 0x09, 0x1F, 0x0B, 0x05, 0x01, 0x05, 0x19, 0x30, 
-    0x19, 0x1F, 0x0B, 0x15, 0x01, 0x15, 0x19, 0x29, 0x10, 0x08, 0x04, 0x02, 
-    0x0B, 0x22, 0x25, 0x29, 0x19, 0x1D, 0x06, 0x01, 0x0B, 0x22, 0x25, 0x29, 
-    0x19, 0x04, 0x04, 0x02, 0x01, 0x02, 0x19, 0x29, 0x19, 0x04, 0x0A, 0x01, 
-    0x0B, 0x18, 0x38, 0x2D, 0x16, 0x03, 0x01, 0x01, 0x0B, 0x18, 0x38, 0x39, 
-    0x51, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x0D, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x1E, 0x2E, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x45, 0x39, 0x01, 0x01, 0x01, 0x01, 0x03, 0x1D, 0x1F, 0x39, 
-    0x01, 0x02, 0x13, 0x08, 0x01, 0x02, 0x01, 0x02, 0x01, 0x05, 0x04, 0x08, 
-    0x01, 0x02, 0x01, 0x02, 0x01, 0x05, 0x06, 0x08, 0x01, 0x02, 0x01, 0x02, 
-    0x0E, 0x0B, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x02, 0x08, 0x06, 0x08, 0x03, 
-    0x02, 0x01, 0x01, 0x02, 0x10, 0x07, 0x0C, 0x01, 0x02, 0x01, 0x01, 0x02, 
-    0x1E, 0x07, 0x1C, 0x02, 0x01, 0x01, 0x01, 0x02, 0x12, 0x16, 0x07, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x04, 0x0D, 0x0D, 0x11, 0x08, 0x0C, 0x0D, 0x0D, 
-    0x04, 0x0D, 0x0D, 0x07, 0x08, 0x0C, 0x0D, 0x0D, 0x04, 0x0D, 0x0D, 0x0D, 
-    0x07, 0x0D, 0x0D, 0x0D, 0x04, 0x0D, 0x0D, 0x0D, 0x16, 0x11, 0x08, 0x0D, 
-    0x04, 0x0D, 0x08, 0x08, 0x16, 0x09, 0x08, 0x0D, 0x04, 0x08, 0x03, 0x08, 
-    0x14, 0x07, 0x06, 0x06, 0x04, 0x08, 0x01, 0x08, 0x14, 0x1B, 0x04, 0x06, 
-    0x0A, 0x06, 0x01, 0x08, 0x14, 0x1B, 0x04, 0x07, 0x09, 0x6E, 0x31, 0x08, 
-    0x0D, 0x0D, 0x0C, 0x10, 0x13, 0x0D, 0x07, 0x13, 0x08, 0x0D, 0x11, 0x30, 
-    0x04, 0x08, 0x0D, 0x06, 0x0D, 0x07, 0x1E, 0x36, 0x13, 0x08, 0x0D, 0x08, 
-    0x0D, 0x0D, 0x1E, 0x36, 0x13, 0x08, 0x0D, 0x0D, 0x0D, 0x09, 0x1E, 0x36, 
-    0x04, 0x08, 0x0D, 0x11, 0x07, 0x16, 0x21, 0x36, 0x04, 0x08, 0x07, 0x11, 
-    0x1E, 0x1E, 0x30, 0x36, 0x07, 0x07, 0x16, 0x11, 0x30, 0x2F, 0x21, 0x2E, 
-    0x36, 0x30, 0x14, 0x31, 0x2D, 0x48, 0x29, 0x27, 0x2E, 0x21, 0x14, 0x0D, 
-    0x3F, 0x48, 0x29, 0x27, 0x29, 0x1E, 0x11, 0x16, 0x1E, 0x30, 0x39, 0x27, 
-    0x36, 0x1F, 0x09, 0x16, 0x1E, 0x21, 0x36, 0x3A, 0x2D, 0x1E, 0x14, 0x12, 
-    0x1F, 0x30, 0x29, 0x39, 0x2D, 0x1E, 0x12, 0x12, 0x1F, 0x30, 0x36, 0x39, 
-    0x30, 0x21, 0x1E, 0x12, 0x1E, 0x30, 0x36, 0x4B, 0x21, 0x1F, 0x1F, 0x12, 
-    0x30, 0x32, 0x2D, 0x36, 0x3A, 0x2D, 0x2F, 0x36, 0x29, 0x39, 0x3A, 0x49, 
-    0x3A, 0x3A, 0x29, 0x3A, 0x27, 0x4B, 0x3A, 0x49, 0x27, 0x3A, 0x39, 0x3A, 
-    0x3A, 0x3A, 0x3A, 0x61, 0x3A, 0x3A, 0x47, 0x3E, 0x36, 0x39, 0x80, 0x5F, 
-    0x47, 0x4A, 0x4A, 0x27, 0x27, 0x4A, 0x2B, 0x73, 0x4A, 0x2A, 0x39, 0x39, 
-    0x3E, 0x81, 0x60, 0x73, 0x42, 0x4A, 0x3A, 0x3A, 0x3A, 0x81, 0x67, 0x73, 
-    0x42, 0x4A, 0x3A, 0x3E, 0x48, 0x81, 0x67, 0x73, 0x49, 0x53, 0x43, 0x49, 
-    0x80, 0x7F, 0x49, 0x2A, 0x49, 0x56, 0x43, 0x48, 0x80, 0x71, 0x44, 0x49, 
-    0x5C, 0x53, 0x44, 0x49, 0x74, 0x59, 0x44, 0x49, 0x62, 0x43, 0x49, 0x49, 
-    0x5E, 0x5E, 0x44, 0x49, 0x7F, 0x49, 0x43, 0x43, 0x62, 0x5B, 0x55, 0x7F, 
-    0x80, 0x44, 0x53, 0x59, 0x5B, 0x5B, 0x62, 0x62, 0x43, 0x59, 0x59, 0x5C, 
-    0x62, 0x62, 0x5D, 0x5B, 0x62, 0x59, 0x62, 0x5B, 0x5E, 0x79, 0x72, 0x79, 
-    0x47, 0x5A, 0x53, 0x49, 0x81, 0x74, 0x82, 0x73, 0x49, 0x43, 0x59, 0x28, 
-    0x62, 0x72, 0x64, 0x76, 0x49, 0x43, 0x5B, 0x63, 0x64, 0x76, 0x76, 0x76, 
-    0x43, 0x59, 0x5F, 0x64, 0x66, 0x76, 0x76, 0x76, 0x62, 0x5D, 0x64, 0x66, 
-    0x76, 0x76, 0x76, 0x76, 0x5B, 0x65, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x5E, 0x64, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x63, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x66, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x66, 0x76, 0x6A, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 
-    0x79, 0x28, 0x64, 0x66, 0x76, 0x76, 0x6A, 0x71, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x76, 0x73, 0x67, 0x67, 0x67, 0x84, 0x84, 0x84, 
-    0x77, 0x56, 0x85, 0x85, 0x86, 0x87, 0x87, 0x87, 0x60, 0x85, 0x88, 0x89, 
-    0x8A, 0x8B, 0x8B, 0x8B, 0x86, 0x57, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x66, 0x66, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x84, 0x8C, 0x77, 0x66, 
-    0x76, 0x76, 0x76, 0x76, 0x87, 0x8D, 0x84, 0x6A, 0x76, 0x76, 0x76, 0x76, 
-    0x8B, 0x8B, 0x8A, 0x84, 0x6A, 0x76, 0x76, 0x76, 0x8B, 0x8B, 0x8B, 0x87, 
-    0x84, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x73, 0x5F, 0x66, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x64, 0x63, 0x5B, 
-    0x43, 0x47, 0x54, 0x28, 0x76, 0x66, 0x75, 0x72, 0x59, 0x48, 0x48, 0x43, 
-    0x76, 0x76, 0x76, 0x6A, 0x5E, 0x68, 0x43, 0x56, 0x76, 0x76, 0x76, 0x66, 
-    0x64, 0x5E, 0x68, 0x59, 0x76, 0x76, 0x76, 0x76, 0x66, 0x73, 0x5D, 0x5F, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x64, 0x79, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x66, 0x75, 0x73, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 
-    0x4A, 0x49, 0x2A, 0x3E, 0x2F, 0x39, 0x2A, 0x2F, 0x49, 0x49, 0x2A, 0x3A, 
-    0x2A, 0x74, 0x4B, 0x2E, 0x43, 0x49, 0x2A, 0x36, 0x49, 0x43, 0x2E, 0x36, 
-    0x62, 0x2A, 0x49, 0x39, 0x48, 0x43, 0x39, 0x4B, 0x5F, 0x4A, 0x2A, 0x3A, 
-    0x48, 0x74, 0x3A, 0x39, 0x5D, 0x68, 0x48, 0x3E, 0x49, 0x28, 0x47, 0x3E, 
-    0x72, 0x43, 0x49, 0x2A, 0x53, 0x28, 0x4A, 0x47, 0x77, 0x5B, 0x47, 0x39, 
-    0x5A, 0x28, 0x4A, 0x4A, 0x2F, 0x2E, 0x2E, 0x30, 0x12, 0x2E, 0x2D, 0x32, 
-    0x32, 0x2F, 0x2E, 0x30, 0x12, 0x30, 0x2E, 0x2F, 0x2D, 0x2F, 0x29, 0x2D, 
-    0x1F, 0x1E, 0x1F, 0x2F, 0x36, 0x2E, 0x2E, 0x2F, 0x21, 0x21, 0x21, 0x32, 
-    0x36, 0x29, 0x2F, 0x30, 0x1F, 0x21, 0x1F, 0x2D, 0x39, 0x29, 0x30, 0x1F, 
-    0x21, 0x21, 0x12, 0x78, 0x3A, 0x29, 0x30, 0x1E, 0x1F, 0x30, 0x12, 0x3E, 
-    0x47, 0x29, 0x2E, 0x1F, 0x1F, 0x30, 0x12, 0x39, 0x1E, 0x08, 0x0C, 0x06, 
-    0x0D, 0x08, 0x11, 0x10, 0x1E, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x09, 
-    0x1E, 0x0A, 0x06, 0x0C, 0x08, 0x16, 0x16, 0x09, 0x1E, 0x04, 0x0C, 0x06, 
-    0x08, 0x16, 0x1E, 0x07, 0x2F, 0x07, 0x06, 0x08, 0x08, 0x16, 0x10, 0x0D, 
-    0x48, 0x1F, 0x07, 0x07, 0x08, 0x16, 0x16, 0x08, 0x49, 0x30, 0x14, 0x11, 
-    0x08, 0x10, 0x16, 0x0C, 0x3A, 0x30, 0x11, 0x11, 0x08, 0x14, 0x09, 0x08, 
-    0x11, 0x0D, 0x19, 0x09, 0x08, 0x0D, 0x07, 0x14, 0x10, 0x0D, 0x11, 0x09, 
-    0x08, 0x0D, 0x0D, 0x09, 0x12, 0x07, 0x11, 0x11, 0x0D, 0x0D, 0x0D, 0x08, 
-    0x12, 0x10, 0x14, 0x12, 0x07, 0x0D, 0x0D, 0x08, 0x07, 0x12, 0x12, 0x16, 
-    0x07, 0x08, 0x0D, 0x08, 0x07, 0x10, 0x16, 0x12, 0x11, 0x08, 0x0D, 0x08, 
-    0x16, 0x16, 0x07, 0x21, 0x14, 0x08, 0x0D, 0x0D, 0x16, 0x16, 0x07, 0x30, 
-    0x12, 0x0C, 0x0D, 0x0D, 0x11, 0x0D, 0x0C, 0x08, 0x01, 0x02, 0x01, 0x01, 
-    0x14, 0x0D, 0x0C, 0x08, 0x01, 0x02, 0x01, 0x01, 0x09, 0x0D, 0x0C, 0x08, 
-    0x01, 0x01, 0x01, 0x01, 0x11, 0x0D, 0x0C, 0x08, 0x01, 0x03, 0x03, 0x02, 
-    0x09, 0x0D, 0x0C, 0x08, 0x01, 0x0A, 0x04, 0x02, 0x09, 0x07, 0x0D, 0x08, 
-    0x01, 0x0A, 0x04, 0x02, 0x0D, 0x0D, 0x08, 0x03, 0x02, 0x0A, 0x04, 0x02, 
-    0x0D, 0x0D, 0x04, 0x01, 0x02, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 
-    0x0A, 0x0D, 0x08, 0x0D, 0x01, 0x01, 0x01, 0x02, 0x0A, 0x0D, 0x06, 0x07, 
-    0x01, 0x01, 0x01, 0x02, 0x03, 0x0D, 0x06, 0x07, 0x01, 0x01, 0x02, 0x02, 
-    0x0E, 0x06, 0x13, 0x07, 0x01, 0x01, 0x03, 0x01, 0x03, 0x06, 0x13, 0x07, 
-    0x01, 0x01, 0x04, 0x0E, 0x03, 0x06, 0x13, 0x0D, 0x01, 0x01, 0x13, 0x03, 
-    0x03, 0x06, 0x13, 0x08, 0x01, 0x01, 0x03, 0x01, 0x03, 0x06, 0x13, 0x06, 
-    0x14, 0x04, 0x01, 0x03, 0x08, 0x01, 0x01, 0x01, 0x10, 0x03, 0x01, 0x09, 
-    0x1B, 0x02, 0x01, 0x02, 0x10, 0x0E, 0x04, 0x30, 0x07, 0x0E, 0x02, 0x0E, 
-    0x10, 0x0A, 0x04, 0x30, 0x19, 0x01, 0x02, 0x06, 0x12, 0x13, 0x04, 0x30, 
-    0x19, 0x03, 0x01, 0x06, 0x11, 0x04, 0x0C, 0x30, 0x07, 0x0A, 0x01, 0x06, 
-    0x11, 0x03, 0x08, 0x30, 0x07, 0x04, 0x01, 0x06, 0x09, 0x03, 0x08, 0x30, 
-    0x07, 0x13, 0x04, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 
-    0x02, 0x15, 0x21, 0x10, 0x01, 0x01, 0x04, 0x04, 0x02, 0x33, 0x30, 0x19, 
-    0x01, 0x02, 0x03, 0x03, 0x15, 0x0B, 0x32, 0x2E, 0x01, 0x01, 0x02, 0x01, 
-    0x05, 0x01, 0x30, 0x2F, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x0E, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x15, 0x06, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x15, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x0F, 
-    0x2E, 0x1F, 0x22, 0x0B, 0x02, 0x02, 0x03, 0x07, 0x2E, 0x1F, 0x22, 0x01, 
-    0x01, 0x0B, 0x04, 0x07, 0x29, 0x23, 0x22, 0x01, 0x01, 0x03, 0x04, 0x09, 
-    0x2D, 0x19, 0x18, 0x01, 0x01, 0x03, 0x0A, 0x09, 0x21, 0x06, 0x01, 0x02, 
-    0x01, 0x03, 0x04, 0x07, 0x30, 0x1C, 0x01, 0x02, 0x01, 0x03, 0x03, 0x03, 
-    0x2F, 0x0F, 0x02, 0x02, 0x01, 0x03, 0x03, 0x03, 0x30, 0x1C, 0x05, 0x01, 
-    0x01, 0x03, 0x03, 0x03, 0x01, 0x20, 0x1B, 0x2E, 0x37, 0x1A, 0x01, 0x02, 
-    0x01, 0x02, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x03, 0x0C, 0x0A, 0x1F, 0x39, 0x01, 0x01, 0x05, 0x04, 
-    0x07, 0x04, 0x1E, 0x39, 0x01, 0x01, 0x05, 0x04, 0x07, 0x08, 0x09, 0x30, 
-    0x01, 0x01, 0x02, 0x13, 0x07, 0x08, 0x07, 0x1F, 0x01, 0x01, 0x02, 0x06, 
-    0x07, 0x08, 0x09, 0x1F, 0x01, 0x01, 0x01, 0x06, 0x0D, 0x08, 0x09, 0x1F, 
-    0x01, 0x01, 0x05, 0x13, 0x0D, 0x08, 0x09, 0x1F, 0x01, 0x01, 0x01, 0x04, 
-    0x0D, 0x0D, 0x09, 0x1F, 0x12, 0x14, 0x1B, 0x02, 0x01, 0x01, 0x01, 0x02, 
-    0x12, 0x11, 0x1B, 0x02, 0x01, 0x01, 0x01, 0x02, 0x10, 0x07, 0x07, 0x0A, 
-    0x03, 0x01, 0x01, 0x02, 0x16, 0x07, 0x16, 0x0A, 0x0B, 0x01, 0x01, 0x02, 
-    0x10, 0x07, 0x12, 0x06, 0x03, 0x01, 0x01, 0x02, 0x10, 0x07, 0x12, 0x07, 
-    0x06, 0x02, 0x01, 0x02, 0x10, 0x07, 0x12, 0x0D, 0x04, 0x01, 0x01, 0x02, 
-    0x10, 0x07, 0x12, 0x08, 0x03, 0x01, 0x01, 0x02, 0x06, 0x06, 0x01, 0x08, 
-    0x14, 0x07, 0x13, 0x07, 0x0C, 0x08, 0x01, 0x08, 0x14, 0x07, 0x13, 0x07, 
-    0x06, 0x08, 0x04, 0x08, 0x16, 0x09, 0x04, 0x07, 0x06, 0x08, 0x13, 0x0D, 
-    0x12, 0x16, 0x13, 0x07, 0x0C, 0x08, 0x04, 0x0D, 0x1E, 0x16, 0x08, 0x07, 
-    0x06, 0x08, 0x13, 0x08, 0x14, 0x1E, 0x16, 0x07, 0x0C, 0x0D, 0x04, 0x0D, 
-    0x12, 0x12, 0x11, 0x0D, 0x0F, 0x11, 0x13, 0x0D, 0x10, 0x10, 0x0D, 0x08, 
-    0x08, 0x30, 0x30, 0x09, 0x21, 0x2E, 0x2F, 0x30, 0x0C, 0x2F, 0x2D, 0x0D, 
-    0x21, 0x2E, 0x2E, 0x30, 0x6E, 0x29, 0x29, 0x08, 0x21, 0x2F, 0x2E, 0x30, 
-    0x3B, 0x29, 0x29, 0x0C, 0x30, 0x29, 0x36, 0x32, 0x3B, 0x2C, 0x29, 0x31, 
-    0x32, 0x39, 0x36, 0x2E, 0x07, 0x2D, 0x2D, 0x09, 0x30, 0x36, 0x36, 0x2E, 
-    0x1E, 0x1E, 0x30, 0x30, 0x2F, 0x36, 0x36, 0x29, 0x16, 0x10, 0x1F, 0x21, 
-    0x2E, 0x36, 0x36, 0x29, 0x1F, 0x29, 0x2F, 0x1F, 0x32, 0x2F, 0x32, 0x2E, 
-    0x1F, 0x3A, 0x2F, 0x1F, 0x2F, 0x2D, 0x2E, 0x2E, 0x1E, 0x3A, 0x2F, 0x30, 
-    0x2E, 0x3A, 0x36, 0x32, 0x1E, 0x3A, 0x32, 0x30, 0x39, 0x3A, 0x2E, 0x32, 
-    0x1F, 0x3A, 0x2F, 0x32, 0x3A, 0x27, 0x39, 0x2E, 0x1E, 0x3A, 0x4A, 0x2E, 
-    0x39, 0x47, 0x27, 0x3A, 0x21, 0x3A, 0x48, 0x2E, 0x2E, 0x3A, 0x47, 0x2A, 
-    0x2F, 0x3A, 0x48, 0x2E, 0x2E, 0x47, 0x2A, 0x2A, 0x42, 0x2A, 0x3A, 0x47, 
-    0x49, 0x81, 0x67, 0x73, 0x3A, 0x4A, 0x2A, 0x49, 0x49, 0x81, 0x67, 0x73, 
-    0x2E, 0x4A, 0x48, 0x49, 0x49, 0x8E, 0x67, 0x73, 0x29, 0x2A, 0x49, 0x49, 
-    0x5A, 0x5B, 0x5D, 0x63, 0x2D, 0x2A, 0x49, 0x49, 0x55, 0x5F, 0x5F, 0x5F, 
-    0x39, 0x4A, 0x44, 0x53, 0x56, 0x5F, 0x5F, 0x5F, 0x2A, 0x2A, 0x55, 0x59, 
-    0x5C, 0x5F, 0x5F, 0x5F, 0x2A, 0x49, 0x5C, 0x62, 0x72, 0x5F, 0x5F, 0x5F, 
-    0x5B, 0x62, 0x62, 0x62, 0x73, 0x76, 0x6A, 0x6A, 0x56, 0x5C, 0x62, 0x62, 
-    0x77, 0x64, 0x65, 0x65, 0x56, 0x5C, 0x62, 0x62, 0x79, 0x5B, 0x85, 0x85, 
-    0x62, 0x5E, 0x5B, 0x5C, 0x8F, 0x85, 0x90, 0x90, 0x5D, 0x5F, 0x62, 0x8F, 
-    0x91, 0x92, 0x92, 0x89, 0x5F, 0x5C, 0x8F, 0x92, 0x93, 0x93, 0x93, 0x4F, 
-    0x5E, 0x6B, 0x91, 0x52, 0x94, 0x41, 0x51, 0x1A, 0x56, 0x92, 0x7D, 0x95, 
-    0x7D, 0x7D, 0x94, 0x22, 0x76, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x5D, 
-    0x65, 0x67, 0x5E, 0x5E, 0x5E, 0x5D, 0x5B, 0x85, 0x85, 0x85, 0x85, 0x85, 
-    0x87, 0x87, 0x8D, 0x96, 0x88, 0x92, 0x89, 0x95, 0x1E, 0x6F, 0x29, 0x6F, 
-    0x96, 0x7D, 0x07, 0x2F, 0x4A, 0x43, 0x49, 0x61, 0x22, 0x94, 0x97, 0x90, 
-    0x90, 0x90, 0x90, 0x90, 0x7C, 0x89, 0x92, 0x90, 0x90, 0x92, 0x89, 0x89, 
-    0x4F, 0x91, 0x88, 0x92, 0x96, 0x98, 0x98, 0x98, 0x8E, 0x85, 0x2B, 0x64, 
-    0x66, 0x66, 0x63, 0x99, 0x8F, 0x85, 0x9A, 0x64, 0x76, 0x64, 0x4A, 0x8B, 
-    0x92, 0x91, 0x99, 0x64, 0x77, 0x89, 0x8B, 0x8B, 0x7B, 0x24, 0x86, 0x73, 
-    0x9B, 0x95, 0x8A, 0x9C, 0x90, 0x88, 0x85, 0x67, 0x84, 0x95, 0x8B, 0x9C, 
-    0x85, 0x90, 0x90, 0x85, 0x85, 0x95, 0x8B, 0x9D, 0x89, 0x89, 0x89, 0x90, 
-    0x92, 0x23, 0x9D, 0x52, 0x98, 0x98, 0x98, 0x96, 0x89, 0x89, 0x22, 0x1D, 
-    0x91, 0x8B, 0x95, 0x96, 0x94, 0x70, 0x94, 0x94, 0x8B, 0x8B, 0x22, 0x03, 
-    0x3C, 0x3C, 0x3C, 0x3C, 0x8A, 0x98, 0x04, 0x04, 0x03, 0x03, 0x03, 0x04, 
-    0x9E, 0x29, 0x40, 0x40, 0x04, 0x04, 0x04, 0x9F, 0x8C, 0xA0, 0xA1, 0xA2, 
-    0xA3, 0x05, 0x1A, 0x09, 0x9E, 0xA0, 0xA0, 0xA1, 0xA1, 0x9E, 0x9E, 0xA1, 
-    0x9C, 0x9A, 0x60, 0xA0, 0xA0, 0xA0, 0xA1, 0xA0, 0x37, 0xA4, 0x89, 0x8C, 
-    0xA0, 0x60, 0xA0, 0x62, 0x70, 0x94, 0x8B, 0x8A, 0xA5, 0x6A, 0x66, 0x76, 
-    0x22, 0x0A, 0x96, 0x8B, 0x8D, 0x8C, 0x76, 0x76, 0x1C, 0x0A, 0x35, 0x7C, 
-    0x50, 0x9D, 0x8C, 0x76, 0x83, 0xA6, 0xA7, 0xA8, 0x96, 0x9D, 0x9E, 0x76, 
-    0x9E, 0xA1, 0xA0, 0xA9, 0x9D, 0x9D, 0x9E, 0x76, 0x62, 0x5B, 0xA0, 0xA9, 
-    0xAA, 0x9D, 0x9E, 0x76, 0x84, 0xA0, 0xAB, 0x7C, 0x19, 0x9C, 0x9E, 0x76, 
-    0xA2, 0x21, 0xAC, 0x08, 0x0B, 0x95, 0x9A, 0x5E, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x66, 0x66, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x67, 0x67, 0x73, 0x66, 0x66, 0x66, 0x66, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x77, 0x65, 0x55, 0x57, 0x5A, 0x28, 0x4A, 0x3E, 
-    0x76, 0x76, 0x72, 0x55, 0x4A, 0x28, 0x43, 0x27, 0x76, 0x76, 0x64, 0x63, 
-    0x55, 0x42, 0x49, 0x4A, 0x76, 0x76, 0x66, 0x64, 0x5E, 0x47, 0x4A, 0x2A, 
-    0x76, 0x76, 0x76, 0x76, 0x73, 0x49, 0x48, 0x4A, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x5B, 0x49, 0x4A, 0x76, 0x76, 0x76, 0x76, 0x76, 0x5F, 0x74, 0x47, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x5F, 0x55, 0x47, 0x2D, 0x39, 0x36, 0x1E, 
-    0x1E, 0x30, 0x10, 0x69, 0x2E, 0x29, 0x29, 0x1E, 0x12, 0x1F, 0x52, 0x2B, 
-    0x3A, 0x36, 0x29, 0x30, 0x1F, 0x1F, 0x52, 0x2B, 0x2A, 0x2D, 0x2F, 0x2F, 
-    0x21, 0x21, 0x19, 0x2B, 0x48, 0x4A, 0x3A, 0x2F, 0x1F, 0x1F, 0x52, 0x2B, 
-    0x5A, 0x5A, 0x2A, 0x36, 0x21, 0x32, 0x52, 0x2B, 0x43, 0x5A, 0x2A, 0x3A, 
-    0x32, 0x2E, 0x52, 0x2B, 0x2A, 0x5A, 0x2A, 0x4B, 0x29, 0x2E, 0x52, 0x2B, 
-    0x48, 0x1E, 0x16, 0x09, 0x0D, 0x0D, 0x0D, 0x0C, 0x48, 0x1E, 0x16, 0x07, 
-    0x0D, 0x0D, 0x0D, 0x09, 0x48, 0x1E, 0x14, 0x14, 0x10, 0x07, 0x07, 0x2D, 
-    0x48, 0x1E, 0x14, 0x14, 0x16, 0x07, 0x07, 0x36, 0x48, 0x1E, 0x16, 0x14, 
-    0x11, 0x08, 0x07, 0x29, 0x48, 0x1E, 0x14, 0x11, 0x1E, 0x19, 0x09, 0x36, 
-    0x48, 0x1F, 0x10, 0x1E, 0x30, 0x12, 0x16, 0x2F, 0x44, 0x36, 0x1F, 0x2F, 
-    0x2E, 0x30, 0x07, 0x16, 0x16, 0x16, 0x07, 0x1E, 0x1E, 0x19, 0x0D, 0x0D, 
-    0x10, 0x10, 0x07, 0x0C, 0x45, 0x3A, 0x08, 0x08, 0x1F, 0x11, 0x09, 0x04, 
-    0x45, 0x4A, 0x09, 0x08, 0x1F, 0x07, 0x14, 0x04, 0x45, 0x47, 0x14, 0x08, 
-    0x1E, 0x0D, 0x1E, 0x10, 0x21, 0x4A, 0x1E, 0x0D, 0x1F, 0x12, 0x30, 0x12, 
-    0x1F, 0x47, 0x16, 0x08, 0x30, 0x21, 0x30, 0x1E, 0x1E, 0x42, 0x09, 0x08, 
-    0x21, 0x1F, 0x30, 0x1E, 0x1E, 0x42, 0x16, 0x08, 0x0D, 0x0D, 0x08, 0x03, 
-    0x02, 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x08, 0x03, 0x01, 0x06, 0x0C, 0x03, 
-    0x0D, 0x06, 0x06, 0x03, 0x01, 0x08, 0x07, 0x04, 0x0D, 0x13, 0x13, 0x03, 
-    0x01, 0x06, 0x0D, 0x13, 0x0D, 0x07, 0x0D, 0x03, 0x0E, 0x0C, 0x0D, 0x0C, 
-    0x08, 0x1E, 0x1E, 0x1D, 0x03, 0x0D, 0x0D, 0x0D, 0x13, 0x12, 0x1E, 0x02, 
-    0x04, 0x0D, 0x0D, 0x08, 0x08, 0x1E, 0x1E, 0x31, 0x08, 0x0D, 0x0D, 0x04, 
-    0x01, 0x01, 0x02, 0x02, 0x03, 0x06, 0x13, 0x06, 0x02, 0x01, 0x01, 0x02, 
-    0x03, 0x06, 0x06, 0x06, 0x02, 0x01, 0x01, 0x02, 0x03, 0x06, 0x06, 0x06, 
-    0x02, 0x01, 0x01, 0x02, 0x03, 0x06, 0x06, 0x13, 0x03, 0x01, 0x01, 0x02, 
-    0x03, 0x06, 0x06, 0x13, 0x0C, 0x02, 0x01, 0x02, 0x01, 0x06, 0x06, 0x13, 
-    0x03, 0x01, 0x01, 0x02, 0x03, 0x06, 0x06, 0x13, 0x05, 0x01, 0x01, 0x02, 
-    0x03, 0x06, 0x06, 0x04, 0x11, 0x08, 0x13, 0x30, 0x07, 0x04, 0x06, 0x06, 
-    0x0D, 0x08, 0x04, 0x32, 0x19, 0x0A, 0x06, 0x0C, 0x13, 0x03, 0x0A, 0x1F, 
-    0x19, 0x13, 0x06, 0x04, 0x08, 0x08, 0x01, 0x03, 0x13, 0x0C, 0x13, 0x04, 
-    0x08, 0x09, 0x01, 0x01, 0x01, 0x04, 0x06, 0x06, 0x08, 0x07, 0x01, 0x02, 
-    0x03, 0x06, 0x13, 0x06, 0x08, 0x1B, 0x02, 0x02, 0x01, 0x13, 0x06, 0x06, 
-    0x08, 0x1B, 0x05, 0x01, 0x0E, 0x06, 0x06, 0x06, 0x0A, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1A, 0x15, 0x01, 0x22, 
-    0x05, 0x01, 0x01, 0x01, 0x0F, 0x03, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 
-    0x15, 0x02, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x03, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x1A, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x22, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x47, 0x7C, 0x33, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x49, 0x7F, 0x3D, 0x40, 0x03, 0x01, 0x01, 0x01, 0x49, 0x71, 0xAD, 0x40, 
-    0x17, 0x02, 0x01, 0x01, 0x49, 0x71, 0xAD, 0x40, 0x03, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 
-    0x07, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x07, 0x14, 0x04, 0x05, 0x01, 
-    0x01, 0x02, 0x03, 0x07, 0x16, 0x06, 0x05, 0x01, 0x01, 0x02, 0x03, 0x07, 
-    0x16, 0x06, 0x05, 0x01, 0x01, 0x02, 0x04, 0x09, 0x14, 0x06, 0x05, 0x01, 
-    0x01, 0x02, 0x04, 0x14, 0x14, 0x06, 0x02, 0x15, 0x01, 0x01, 0x01, 0x07, 
-    0x14, 0x06, 0x02, 0x18, 0x02, 0x01, 0x08, 0x03, 0x04, 0x08, 0x09, 0x1F, 
-    0x02, 0x01, 0x0D, 0x03, 0x04, 0x0C, 0x09, 0x1F, 0x02, 0x01, 0x0C, 0x03, 
-    0x04, 0x08, 0x09, 0x1F, 0x02, 0x01, 0x06, 0x03, 0x04, 0x13, 0x09, 0x1F, 
-    0x01, 0x02, 0x06, 0x03, 0x04, 0x06, 0x09, 0x1F, 0x04, 0x0A, 0x04, 0x01, 
-    0x04, 0x0D, 0x07, 0x1E, 0x09, 0x07, 0x04, 0x01, 0x04, 0x0D, 0x0C, 0x11, 
-    0x19, 0x09, 0x03, 0x01, 0x04, 0x0D, 0x08, 0x07, 0x10, 0x0D, 0x16, 0x08, 
-    0x0E, 0x02, 0x01, 0x05, 0x10, 0x07, 0x16, 0x07, 0x0C, 0x01, 0x01, 0x0E, 
-    0x10, 0x07, 0x12, 0x16, 0x10, 0x03, 0x01, 0x0C, 0x10, 0x07, 0x19, 0x12, 
-    0x12, 0x03, 0x03, 0x08, 0x10, 0x0D, 0x07, 0x10, 0x12, 0x0E, 0x01, 0x08, 
-    0x16, 0x07, 0x08, 0x10, 0x12, 0x04, 0x06, 0x08, 0x10, 0x11, 0x08, 0x10, 
-    0x12, 0x0C, 0x0D, 0x0D, 0x1F, 0x10, 0x04, 0x10, 0x12, 0x06, 0x0D, 0x0D, 
-    0x0F, 0x11, 0x06, 0x08, 0x16, 0x10, 0x07, 0x0D, 0x08, 0x11, 0x06, 0x07, 
-    0x14, 0x07, 0x09, 0x11, 0x11, 0x08, 0x0D, 0x14, 0x09, 0x11, 0x09, 0x14, 
-    0x11, 0x06, 0x07, 0x07, 0x06, 0x11, 0x11, 0x1E, 0x11, 0x0C, 0x07, 0x07, 
-    0x06, 0x07, 0x11, 0x1E, 0x09, 0x08, 0x07, 0x14, 0x07, 0x09, 0x07, 0x10, 
-    0x0D, 0x0D, 0x09, 0x19, 0x19, 0x19, 0x11, 0x12, 0x0D, 0x08, 0x09, 0x14, 
-    0x19, 0x11, 0x09, 0x1F, 0x10, 0x10, 0x12, 0x1E, 0x2E, 0x36, 0x36, 0x29, 
-    0x16, 0x14, 0x1F, 0x1F, 0x32, 0x36, 0x36, 0x2D, 0x16, 0x19, 0x30, 0x1E, 
-    0x30, 0x36, 0x36, 0x2D, 0x1E, 0x12, 0x29, 0x1F, 0x2F, 0x39, 0x36, 0x2D, 
-    0x1E, 0x12, 0x29, 0x1F, 0x2D, 0x3E, 0x3A, 0x29, 0x12, 0x12, 0x29, 0x1E, 
-    0x2D, 0x3E, 0x27, 0x3A, 0x12, 0x12, 0x29, 0x1F, 0x2E, 0x3A, 0x3A, 0x27, 
-    0x30, 0x1E, 0x29, 0x32, 0x30, 0x39, 0x27, 0x3A, 0x2F, 0x3A, 0x49, 0x36, 
-    0x39, 0x2A, 0x2A, 0x2A, 0x29, 0x42, 0x48, 0x3A, 0x48, 0x2A, 0x2A, 0x2A, 
-    0x36, 0x2A, 0x48, 0x3A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2D, 0x27, 0x42, 0x29, 
-    0x4A, 0x2A, 0x2A, 0x4A, 0x2E, 0x3E, 0x3A, 0x39, 0x2A, 0x4A, 0x2A, 0x49, 
-    0x39, 0x47, 0x47, 0x3A, 0x2A, 0x48, 0x2A, 0x43, 0x27, 0x3A, 0x3A, 0x27, 
-    0x2A, 0x49, 0x47, 0x55, 0x3A, 0x3A, 0x3E, 0x2A, 0x2A, 0x2A, 0x7F, 0x59, 
-    0x2A, 0x43, 0x59, 0x5D, 0x65, 0x5E, 0x5B, 0x5F, 0x2A, 0x68, 0x5F, 0x77, 
-    0x5B, 0x5B, 0x5B, 0x68, 0x2A, 0x5C, 0x5E, 0x65, 0x5B, 0x5E, 0x5E, 0x8F, 
-    0x48, 0x5D, 0x5E, 0x62, 0x62, 0x72, 0x5D, 0x90, 0x5F, 0x5F, 0x5B, 0x62, 
-    0x5B, 0x5F, 0x5B, 0x85, 0x79, 0x5E, 0x59, 0x5E, 0x5F, 0x5F, 0x5F, 0x7F, 
-    0x62, 0x62, 0x62, 0x5E, 0x5F, 0x5E, 0x65, 0x79, 0x62, 0x62, 0x5B, 0x5D, 
-    0x5F, 0x5D, 0x72, 0x65, 0x8F, 0x93, 0x94, 0x7D, 0x95, 0x38, 0x17, 0x33, 
-    0x88, 0x98, 0x95, 0x7D, 0x95, 0x7C, 0x1A, 0x7D, 0x88, 0x94, 0x7D, 0x7D, 
-    0x95, 0x7C, 0x1A, 0x7D, 0x88, 0x94, 0x7D, 0x7D, 0x95, 0x7C, 0x1A, 0x7D, 
-    0x88, 0x94, 0x7D, 0x7D, 0x95, 0x7C, 0x1A, 0x7D, 0x88, 0x98, 0x95, 0x7D, 
-    0x95, 0x7C, 0x1A, 0x7D, 0x85, 0x96, 0x94, 0x7D, 0x7D, 0x51, 0x02, 0x35, 
-    0x6B, 0x93, 0x7D, 0x95, 0x7D, 0x95, 0x33, 0x0A, 0x96, 0x89, 0x96, 0x94, 
-    0x94, 0x95, 0x95, 0x95, 0x7D, 0x94, 0x94, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x95, 
-    0x94, 0x0F, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x95, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x95, 0x95, 0x95, 0x98, 0x93, 0x89, 0x1E, 0x01, 0x7D, 0x7D, 0x7D, 0x95, 
-    0x7D, 0x7D, 0x2E, 0x98, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x41, 0x2F, 0x51, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x41, 0x7C, 0x7D, 0x7D, 0x94, 0x38, 
-    0x95, 0x7D, 0x41, 0x04, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x95, 0x94, 0x3C, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x95, 0x94, 0x22, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x95, 0x94, 0x22, 0x18, 0x04, 0x0F, 0x0A, 0x3D, 0xA0, 0xA0, 0xAE, 
-    0x1A, 0x9F, 0x08, 0x33, 0x09, 0xA0, 0xA1, 0x1A, 0x22, 0x01, 0x13, 0x01, 
-    0x13, 0xA2, 0xAE, 0xA6, 0x1A, 0xAF, 0x01, 0x15, 0x15, 0x9D, 0x9D, 0x22, 
-    0x15, 0x04, 0x05, 0x20, 0x20, 0x1D, 0x03, 0x05, 0xAF, 0x01, 0x18, 0x9F, 
-    0x20, 0x20, 0x1A, 0x20, 0x01, 0x94, 0x35, 0x22, 0x20, 0x9F, 0x20, 0x20, 
-    0x9C, 0x8A, 0x93, 0x41, 0x94, 0x22, 0x02, 0x9F, 0xA3, 0xAC, 0xB0, 0x22, 
-    0x4E, 0x92, 0x85, 0x85, 0x04, 0x04, 0x40, 0x35, 0x93, 0x92, 0x88, 0x98, 
-    0x06, 0x03, 0x15, 0x7D, 0x95, 0x95, 0x4E, 0x3C, 0x0B, 0x05, 0x02, 0x1C, 
-    0x1A, 0x1A, 0x02, 0x7D, 0x20, 0x20, 0x15, 0x0E, 0x02, 0x02, 0x94, 0x95, 
-    0x20, 0x20, 0x15, 0x17, 0x35, 0x0A, 0x94, 0x7D, 0x20, 0x20, 0x15, 0x17, 
-    0x94, 0x3B, 0x94, 0x7D, 0x20, 0x20, 0x15, 0x0B, 0x95, 0x7C, 0x01, 0x7D, 
-    0x85, 0x85, 0x69, 0x77, 0x73, 0x75, 0x63, 0x76, 0x83, 0xB1, 0x24, 0x40, 
-    0x87, 0x86, 0x85, 0x65, 0x97, 0x88, 0x92, 0x92, 0x92, 0x89, 0x93, 0x88, 
-    0x92, 0x92, 0x90, 0x90, 0x90, 0x90, 0x89, 0x9C, 0x98, 0x96, 0x93, 0x93, 
-    0x92, 0x85, 0x88, 0x89, 0x7D, 0x7D, 0x94, 0x98, 0x96, 0xB2, 0x96, 0x89, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x41, 0x4F, 0x7D, 0x38, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x94, 0x7D, 0x95, 0x7D, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x66, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x8C, 0x6A, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x88, 0xA2, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x89, 0x9C, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x96, 0x97, 0x77, 0x66, 0x76, 0x76, 0x76, 0x76, 
-    0x96, 0x88, 0x61, 0x64, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x5B, 0x74, 0x47, 0x76, 0x76, 0x76, 0x76, 0x76, 0x5B, 0x74, 0x3A, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x5B, 0x74, 0x3A, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x5B, 0x74, 0x2A, 0x76, 0x76, 0x76, 0x76, 0x76, 0x5B, 0x74, 0x49, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x5B, 0x74, 0x49, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x5D, 0x5C, 0x49, 0x76, 0x76, 0x76, 0x76, 0x76, 0x5F, 0x5C, 0x44, 
-    0x3E, 0x48, 0x2A, 0x39, 0x32, 0x2E, 0x52, 0x2B, 0x27, 0x2A, 0x49, 0x4A, 
-    0x2C, 0x2E, 0x1F, 0x2B, 0x3A, 0x2A, 0x49, 0x49, 0x4A, 0x29, 0x50, 0x2B, 
-    0x4A, 0x4A, 0x4A, 0x49, 0x47, 0x36, 0x2F, 0x28, 0x49, 0x2A, 0x48, 0x49, 
-    0x47, 0x29, 0x36, 0x74, 0x49, 0x48, 0x43, 0x43, 0x47, 0x27, 0x2A, 0x48, 
-    0x49, 0x48, 0x43, 0x43, 0x2A, 0x2A, 0x2A, 0x27, 0x49, 0x49, 0x49, 0x2A, 
-    0x4A, 0x2A, 0x2A, 0x3A, 0x43, 0x39, 0x21, 0x2F, 0x2E, 0x2F, 0x16, 0x10, 
-    0x48, 0x39, 0x1F, 0x2F, 0x2E, 0x2E, 0x1E, 0x16, 0x5A, 0x39, 0x1F, 0x2F, 
-    0x2F, 0x2F, 0x12, 0x07, 0x43, 0x39, 0x1F, 0x2F, 0x3A, 0x39, 0x1E, 0x09, 
-    0x49, 0x39, 0x1F, 0x2E, 0x3E, 0x39, 0x2E, 0x12, 0x4A, 0x42, 0x2D, 0x2E, 
-    0x3E, 0x39, 0x36, 0x2F, 0x3E, 0x49, 0x2C, 0x2F, 0x3A, 0x36, 0x36, 0x29, 
-    0x42, 0x44, 0x42, 0x39, 0x3A, 0x2E, 0x29, 0x36, 0x30, 0x21, 0x21, 0x30, 
-    0x2C, 0x42, 0x16, 0x08, 0x1F, 0x21, 0x1E, 0x26, 0x49, 0x2E, 0x09, 0x07, 
-    0x1F, 0x30, 0x1E, 0x26, 0x48, 0x1E, 0x07, 0x09, 0x16, 0x1E, 0x19, 0x6F, 
-    0x49, 0x21, 0x07, 0x07, 0x0D, 0x07, 0x46, 0x29, 0x49, 0x21, 0x0D, 0x09, 
-    0x10, 0x0D, 0xA4, 0x29, 0x49, 0x2F, 0x07, 0x09, 0x12, 0x09, 0xA4, 0x29, 
-    0x43, 0x2C, 0x19, 0x11, 0x29, 0x12, 0x11, 0x16, 0x32, 0x36, 0x21, 0x10, 
-    0x08, 0x1E, 0x1F, 0x0D, 0x0D, 0x0D, 0x0D, 0x13, 0x0D, 0x12, 0x1F, 0x07, 
-    0x0D, 0x04, 0x08, 0x13, 0x07, 0x12, 0x1F, 0x07, 0x0D, 0x03, 0x08, 0x13, 
-    0x11, 0x1E, 0x1F, 0x07, 0x0D, 0x03, 0x08, 0x13, 0x07, 0x12, 0x1E, 0x0D, 
-    0x08, 0x03, 0x08, 0x13, 0x07, 0x11, 0x10, 0x08, 0x06, 0x03, 0x08, 0x13, 
-    0x07, 0x14, 0x10, 0x08, 0x0C, 0x03, 0x08, 0x13, 0x0D, 0x14, 0x10, 0x08, 
-    0x0C, 0x03, 0x08, 0x13, 0x02, 0x01, 0x01, 0x02, 0x01, 0x03, 0x04, 0x06, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 0x0D, 0x08, 0x0E, 0x02, 
-    0x01, 0x04, 0x13, 0x03, 0x08, 0x13, 0x04, 0x01, 0x01, 0x02, 0x03, 0x0A, 
-    0x08, 0x06, 0x04, 0x03, 0x01, 0x02, 0x13, 0x13, 0x08, 0x06, 0x04, 0x03, 
-    0x01, 0x02, 0x04, 0x06, 0x08, 0x06, 0x04, 0x03, 0x01, 0x02, 0x04, 0x04, 
-    0x08, 0x06, 0x04, 0x03, 0x01, 0x02, 0x04, 0x04, 0x08, 0x06, 0x04, 0x03, 
-    0x01, 0x02, 0x13, 0x04, 0x08, 0x06, 0x04, 0x0B, 0x01, 0x02, 0x04, 0x0D, 
-    0x03, 0x03, 0x01, 0x02, 0x01, 0x01, 0x22, 0x17, 0x04, 0x06, 0x01, 0x02, 
-    0x02, 0x17, 0x24, 0x4D, 0x0A, 0x06, 0x03, 0x02, 0x03, 0x40, 0x2D, 0x43, 
-    0x13, 0x06, 0x03, 0x01, 0x22, 0x23, 0x2A, 0x49, 0x04, 0x06, 0x04, 0x17, 
-    0x24, 0x39, 0x49, 0x47, 0x01, 0x13, 0x06, 0x02, 0x51, 0x49, 0x44, 0x39, 
-    0x02, 0x0C, 0x06, 0x22, 0x41, 0x43, 0x78, 0x1E, 0x08, 0x06, 0x22, 0x23, 
-    0x49, 0x53, 0x29, 0x1B, 0x23, 0x1C, 0x02, 0x37, 0x17, 0x02, 0x01, 0x01, 
-    0x43, 0x1E, 0x4E, 0x3E, 0x21, 0x1A, 0x01, 0x01, 0x53, 0x10, 0x34, 0x4A, 
-    0x3F, 0x3B, 0x01, 0x01, 0x29, 0x08, 0x34, 0x3A, 0x30, 0x1D, 0x01, 0x01, 
-    0xB3, 0x0F, 0x03, 0x1F, 0x09, 0x02, 0x01, 0x01, 0x16, 0x0F, 0x04, 0x21, 
-    0x09, 0x02, 0x01, 0x01, 0x06, 0x06, 0x12, 0x21, 0x1B, 0x0A, 0x03, 0x01, 
-    0x03, 0x0F, 0x30, 0x1E, 0x06, 0x06, 0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x8E, 0x71, 0xAD, 0x24, 0x08, 0x02, 0x01, 0x02, 0x6B, 0x5C, 0xAD, 0x24, 
-    0x0F, 0x02, 0x01, 0x02, 0x26, 0x49, 0x4D, 0x24, 0x0F, 0x05, 0x01, 0x02, 
-    0x32, 0x48, 0x7B, 0x22, 0x08, 0x05, 0x01, 0x02, 0x32, 0x48, 0x7B, 0x22, 
-    0x08, 0x02, 0x01, 0x02, 0x32, 0x48, 0x7B, 0x1E, 0x09, 0x1A, 0x01, 0x02, 
-    0x32, 0x48, 0x7B, 0x30, 0x23, 0x1A, 0x01, 0x02, 0x3F, 0x48, 0x7B, 0x21, 
-    0x19, 0x20, 0x0B, 0x02, 0x01, 0x04, 0x0A, 0x07, 0x16, 0x06, 0x02, 0x15, 
-    0x01, 0x04, 0x03, 0x10, 0x1E, 0x08, 0x0A, 0x18, 0x01, 0x04, 0x03, 0x12, 
-    0x1E, 0x09, 0x08, 0x18, 0x01, 0x03, 0x20, 0x12, 0x1E, 0x09, 0x06, 0x18, 
-    0x01, 0x06, 0x02, 0x10, 0x1E, 0x11, 0x06, 0x15, 0x03, 0x06, 0x03, 0x07, 
-    0x07, 0x11, 0x06, 0x15, 0x03, 0x06, 0x03, 0x04, 0x13, 0x11, 0x0D, 0x01, 
-    0x03, 0x0C, 0x13, 0x13, 0x04, 0x08, 0x08, 0x03, 0x19, 0x09, 0x0E, 0x01, 
-    0x04, 0x0D, 0x0C, 0x07, 0x19, 0x09, 0x0E, 0x01, 0x04, 0x08, 0x0C, 0x07, 
-    0x19, 0x09, 0x0E, 0x01, 0x04, 0x0D, 0x06, 0x14, 0x19, 0x09, 0x03, 0x01, 
-    0x04, 0x0D, 0x08, 0x16, 0x09, 0x07, 0x01, 0x01, 0x04, 0x0D, 0x08, 0x11, 
-    0x1B, 0x07, 0x01, 0x0E, 0x04, 0x0D, 0x0C, 0x07, 0x1B, 0x08, 0x02, 0x06, 
-    0x04, 0x03, 0x04, 0x09, 0x06, 0x0D, 0x1B, 0x08, 0x03, 0x01, 0x0F, 0x16, 
-    0x1F, 0x10, 0x04, 0x10, 0x12, 0x0C, 0x0D, 0x0D, 0x1F, 0x10, 0x04, 0x10, 
-    0x12, 0x0D, 0x0D, 0x0D, 0x21, 0x10, 0x04, 0x10, 0x12, 0x08, 0x0D, 0x0D, 
-    0x1F, 0x10, 0x08, 0x12, 0x14, 0x08, 0x0D, 0x0D, 0x12, 0x10, 0x14, 0x10, 
-    0x07, 0x0D, 0x0D, 0x0D, 0x12, 0x19, 0x19, 0x10, 0x08, 0x0D, 0x0D, 0x0D, 
-    0x07, 0x0C, 0x16, 0x14, 0x08, 0x0D, 0x0D, 0x0D, 0x0C, 0x09, 0x16, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x09, 0x09, 0x11, 0x07, 0x09, 0x30, 
-    0x0D, 0x08, 0x11, 0x07, 0x08, 0x0D, 0x1F, 0x2E, 0x0D, 0x0D, 0x11, 0x07, 
-    0x09, 0x16, 0x21, 0x30, 0x0D, 0x07, 0x19, 0x0D, 0x1F, 0x1F, 0x10, 0x1E, 
-    0x0D, 0x08, 0x07, 0x0F, 0x42, 0x6D, 0x6C, 0x30, 0x0D, 0x07, 0x16, 0x09, 
-    0x48, 0x6D, 0x52, 0x1F, 0x0D, 0x07, 0x10, 0x16, 0x48, 0x47, 0x39, 0x4F, 
-    0x0D, 0x07, 0x10, 0x10, 0x42, 0x2C, 0x39, 0x1F, 0x32, 0x1F, 0x32, 0x2E, 
-    0x2F, 0x29, 0x3A, 0x3A, 0x2F, 0x1F, 0x32, 0x2E, 0x2F, 0x29, 0x3A, 0x3A, 
-    0x2F, 0x30, 0x32, 0x2E, 0x2F, 0x29, 0x3A, 0x3A, 0x2E, 0x30, 0x32, 0x2E, 
-    0x32, 0x29, 0x3A, 0x3A, 0x2E, 0x30, 0x32, 0x2F, 0x32, 0x3A, 0x27, 0x3A, 
-    0x2E, 0x30, 0x32, 0x30, 0x2F, 0x3A, 0x3A, 0x3A, 0x1F, 0x21, 0x2F, 0x36, 
-    0x29, 0x3A, 0x27, 0x27, 0x12, 0x2F, 0x2F, 0x49, 0x49, 0x4B, 0x3A, 0x3E, 
-    0x3A, 0x3A, 0x48, 0x53, 0x2A, 0x2A, 0x5F, 0x5E, 0x3A, 0x3A, 0x48, 0x43, 
-    0x2A, 0x2A, 0x5E, 0x5E, 0x3A, 0x3A, 0x48, 0x53, 0x2A, 0x54, 0x5F, 0x5E, 
-    0x3A, 0x3E, 0x48, 0x43, 0x2A, 0x54, 0x5F, 0x5B, 0x3A, 0x49, 0x49, 0x4A, 
-    0x4A, 0x54, 0x5F, 0x5B, 0x3A, 0x48, 0x49, 0x2A, 0x4A, 0x54, 0x5F, 0x5B, 
-    0x3A, 0x48, 0x49, 0x4A, 0x4A, 0x54, 0x5F, 0x5B, 0x2A, 0x49, 0x49, 0x2A, 
-    0x4A, 0x54, 0x5F, 0x5B, 0x62, 0x62, 0x65, 0x72, 0x5D, 0x5D, 0x79, 0x6A, 
-    0x62, 0x62, 0x72, 0x63, 0x5F, 0x72, 0x65, 0x75, 0x62, 0x62, 0x72, 0x65, 
-    0x5F, 0x73, 0x63, 0x75, 0x5E, 0x5B, 0x72, 0x79, 0x5F, 0x75, 0x5F, 0x65, 
-    0x5E, 0x5B, 0x72, 0x79, 0x79, 0x75, 0x72, 0x63, 0x5E, 0x5B, 0x72, 0x72, 
-    0x79, 0x75, 0x63, 0x73, 0x5E, 0x5F, 0x5F, 0x5F, 0x5D, 0x75, 0x63, 0x63, 
-    0x5E, 0x5F, 0x5D, 0x5E, 0x79, 0x64, 0x63, 0x63, 0x67, 0x87, 0x96, 0x98, 
-    0x7D, 0x95, 0x7C, 0x02, 0x72, 0x8E, 0x91, 0x93, 0x4F, 0xAA, 0x4F, 0x06, 
-    0x6A, 0x60, 0x85, 0x92, 0xB2, 0x2F, 0xB2, 0x37, 0x76, 0x63, 0x6B, 0x91, 
-    0x3F, 0x4C, 0x4C, 0x13, 0x76, 0x66, 0x63, 0x93, 0xA6, 0x22, 0x22, 0x15, 
-    0x76, 0x76, 0x76, 0x72, 0x7E, 0xA6, 0x02, 0x15, 0x77, 0x76, 0x76, 0x66, 
-    0x77, 0x87, 0xB1, 0x33, 0x73, 0x76, 0x76, 0x76, 0x79, 0x86, 0x16, 0x7D, 
-    0x38, 0x95, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x35, 0x95, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x35, 0x95, 0x7D, 0x95, 0x95, 0x95, 0x7D, 0x7D, 
-    0x33, 0x94, 0x94, 0x94, 0x94, 0x98, 0x1F, 0x30, 0x1A, 0x1A, 0x1A, 0x1A, 
-    0x1A, 0x1A, 0x06, 0x37, 0x20, 0x03, 0x04, 0x04, 0x03, 0x05, 0x1A, 0x02, 
-    0x0B, 0x08, 0x51, 0x51, 0x07, 0x01, 0x37, 0x21, 0x94, 0x37, 0x38, 0x35, 
-    0x22, 0x94, 0x7D, 0x29, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x95, 0x37, 0xA3, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x51, 0xB1, 0x96, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x95, 0x04, 0xA3, 0x54, 0x1F, 0x41, 0x94, 0x23, 0x06, 0x02, 0x17, 0x96, 
-    0x7C, 0x7C, 0x06, 0x03, 0x1A, 0x01, 0x03, 0x0B, 0x22, 0x18, 0x1A, 0x04, 
-    0x06, 0x02, 0x01, 0x03, 0xAC, 0x24, 0x03, 0x12, 0x4F, 0x41, 0x1B, 0x0B, 
-    0x7E, 0x6D, 0x50, 0x50, 0x30, 0x21, 0x52, 0x04, 0x9A, 0x92, 0x8A, 0x8A, 
-    0x9D, 0x94, 0x03, 0x1A, 0x5B, 0x5F, 0x69, 0x58, 0x97, 0x8A, 0xAA, 0x35, 
-    0x5D, 0x79, 0x72, 0x72, 0x62, 0x47, 0x97, 0x8A, 0x8B, 0x8A, 0x58, 0x5D, 
-    0x72, 0x65, 0x60, 0x55, 0x9D, 0x9D, 0x91, 0x9A, 0x99, 0x55, 0x5F, 0x79, 
-    0x22, 0x1D, 0xAA, 0x9C, 0x8A, 0x8B, 0x55, 0x28, 0x0B, 0x01, 0xB1, 0xB1, 
-    0x7D, 0x7D, 0x96, 0x8B, 0x0A, 0x01, 0x01, 0x0B, 0x15, 0x18, 0x01, 0x3C, 
-    0xAF, 0xAF, 0x01, 0x0A, 0x96, 0x8B, 0x09, 0x38, 0x1D, 0x22, 0x22, 0x3B, 
-    0xAA, 0x9A, 0x2A, 0x7C, 0x8A, 0x8A, 0x8A, 0x8B, 0x8A, 0xB4, 0x59, 0x54, 
-    0x80, 0x8A, 0x8B, 0x8A, 0xB4, 0x60, 0x5F, 0x28, 0x5F, 0x2B, 0x2B, 0x69, 
-    0x60, 0x73, 0x67, 0xB4, 0x62, 0x5F, 0x5F, 0x5F, 0x5F, 0x60, 0x39, 0x8A, 
-    0xB4, 0x62, 0x28, 0x28, 0x28, 0xB4, 0x9D, 0x09, 0x9D, 0x8A, 0x8A, 0x8A, 
-    0x8A, 0x95, 0xB1, 0x1D, 0x7D, 0x7D, 0x7D, 0x94, 0x3C, 0x38, 0x7D, 0x95, 
-    0x7D, 0x7D, 0x7D, 0x7D, 0x38, 0x22, 0x94, 0x95, 0xAA, 0x7D, 0x7D, 0x7D, 
-    0x95, 0x34, 0x94, 0x95, 0xAA, 0x7D, 0x7D, 0x7D, 0x95, 0x35, 0x94, 0x95, 
-    0x7C, 0x35, 0x95, 0x7D, 0x7D, 0x98, 0x94, 0x95, 0x0F, 0x7C, 0x95, 0x7D, 
-    0x7D, 0x95, 0x7D, 0x7D, 0x22, 0x38, 0x95, 0x7D, 0x7D, 0x94, 0x94, 0x96, 
-    0x37, 0x98, 0x95, 0x94, 0x95, 0x96, 0xB3, 0x8A, 0x38, 0x88, 0x8E, 0x64, 
-    0x66, 0x76, 0x76, 0x76, 0x98, 0x88, 0x8E, 0x64, 0x66, 0x76, 0x76, 0x76, 
-    0x98, 0x88, 0x8E, 0x64, 0x66, 0x76, 0x76, 0x76, 0x98, 0x92, 0x8E, 0x64, 
-    0x66, 0x76, 0x76, 0x76, 0x94, 0x91, 0x8E, 0x64, 0x66, 0x76, 0x76, 0x76, 
-    0x98, 0x8D, 0x8F, 0x64, 0x66, 0x76, 0x76, 0x76, 0xB4, 0x67, 0x73, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x5A, 0x6A, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x5F, 0x59, 0x44, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x5F, 0x5E, 0x43, 0x76, 0x76, 0x76, 0x76, 0x77, 0x5D, 0x62, 0x62, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x5F, 0x5E, 0x62, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x5F, 0x5E, 0x62, 0x76, 0x76, 0x76, 0x76, 0x76, 0x5F, 0x5E, 0x62, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x5F, 0x5E, 0x62, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x5F, 0x5E, 0x62, 0x49, 0x49, 0x48, 0x42, 0x42, 0x5A, 0x47, 0x39, 
-    0x49, 0x49, 0x43, 0x53, 0x49, 0x5A, 0x2A, 0x2A, 0x5A, 0x49, 0x49, 0x2A, 
-    0x3E, 0x4A, 0x2A, 0x49, 0x5C, 0x43, 0x48, 0x4A, 0x2A, 0x2A, 0x4A, 0x49, 
-    0x62, 0x43, 0x49, 0x5A, 0x49, 0x49, 0x2A, 0x49, 0x62, 0x43, 0x49, 0x48, 
-    0x3A, 0x49, 0x49, 0x49, 0x62, 0x43, 0x49, 0x48, 0x2A, 0x49, 0x49, 0x49, 
-    0x62, 0x62, 0x53, 0x43, 0x43, 0x43, 0x49, 0x49, 0x47, 0x5A, 0x42, 0x4B, 
-    0x39, 0x2F, 0x29, 0x29, 0x49, 0x49, 0x2A, 0x3E, 0x39, 0x30, 0x32, 0x30, 
-    0x49, 0x49, 0x2A, 0x3E, 0x39, 0x21, 0x32, 0x32, 0x49, 0x49, 0x48, 0x3E, 
-    0x3A, 0x30, 0x2F, 0x2F, 0x49, 0x49, 0x49, 0x2A, 0x3A, 0x2F, 0x2E, 0x2F, 
-    0x49, 0x49, 0x49, 0x4A, 0x39, 0x2E, 0x2E, 0x30, 0x49, 0x49, 0x49, 0x49, 
-    0x2A, 0x29, 0x2E, 0x30, 0x49, 0x49, 0x49, 0x49, 0x3E, 0x36, 0x36, 0x2F, 
-    0x2D, 0x12, 0x11, 0x0C, 0x51, 0x3A, 0x39, 0x21, 0x21, 0x1E, 0x10, 0x0D, 
-    0x25, 0x3A, 0x2D, 0x1E, 0x2F, 0x30, 0x1E, 0x07, 0x07, 0x1F, 0x12, 0x30, 
-    0x2E, 0x2F, 0x12, 0x07, 0x08, 0x07, 0x16, 0x29, 0x39, 0x4B, 0x1E, 0x10, 
-    0x0D, 0x07, 0x08, 0x2D, 0x29, 0x39, 0x1E, 0x1F, 0x09, 0x0C, 0x08, 0x2E, 
-    0x29, 0x39, 0x30, 0x30, 0x09, 0x08, 0x07, 0x12, 0x2E, 0x29, 0x2E, 0x30, 
-    0x09, 0x0D, 0x0D, 0x08, 0x11, 0x10, 0x10, 0x08, 0x0C, 0x03, 0x08, 0x13, 
-    0x12, 0x1E, 0x10, 0x08, 0x06, 0x03, 0x08, 0x13, 0x30, 0x1F, 0x10, 0x08, 
-    0x0D, 0x03, 0x08, 0x13, 0x2F, 0x12, 0x10, 0x08, 0x0D, 0x03, 0x08, 0x13, 
-    0x1E, 0x0D, 0x10, 0x08, 0x06, 0x03, 0x08, 0x06, 0x25, 0x16, 0x10, 0x08, 
-    0x0C, 0x03, 0x0C, 0x0A, 0x11, 0x12, 0x10, 0x08, 0x0D, 0x08, 0x06, 0x04, 
-    0x11, 0x10, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x02, 0x01, 0x01, 0x02, 
-    0x01, 0x0E, 0x0E, 0x06, 0x02, 0x01, 0x01, 0x02, 0x0E, 0x06, 0x01, 0x13, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x13, 0x02, 0x01, 0x05, 0x05, 
-    0x01, 0x01, 0x0E, 0x06, 0x02, 0x02, 0x04, 0x04, 0x02, 0x01, 0x03, 0x13, 
-    0x02, 0x15, 0x09, 0x09, 0x05, 0x03, 0x01, 0x04, 0x03, 0x05, 0x09, 0x11, 
-    0x02, 0x01, 0x01, 0x04, 0x08, 0x18, 0x09, 0x16, 0x06, 0x04, 0x01, 0x04, 
-    0x08, 0x06, 0x04, 0x01, 0x01, 0x01, 0x05, 0x0F, 0x08, 0x06, 0x04, 0x01, 
-    0x01, 0x01, 0x05, 0x1C, 0x08, 0x06, 0x04, 0x01, 0x01, 0x01, 0x05, 0x06, 
-    0x08, 0x04, 0x03, 0x01, 0x01, 0x01, 0x05, 0x06, 0x0D, 0x06, 0x03, 0x01, 
-    0x01, 0x01, 0x02, 0x0A, 0x0D, 0x08, 0x03, 0x01, 0x01, 0x01, 0x02, 0x03, 
-    0x0D, 0x08, 0x03, 0x01, 0x01, 0x02, 0x03, 0x06, 0x08, 0x13, 0x04, 0x03, 
-    0x01, 0x02, 0x03, 0x0C, 0x09, 0x03, 0x40, 0x7B, 0x43, 0x3A, 0x30, 0x19, 
-    0x07, 0x03, 0x40, 0x7B, 0x49, 0x2F, 0x1E, 0x09, 0x09, 0x03, 0x40, 0x7B, 
-    0x44, 0x48, 0x2D, 0x08, 0x07, 0x03, 0x1A, 0x4F, 0x48, 0x2A, 0x30, 0x07, 
-    0x08, 0x17, 0x24, 0x23, 0x42, 0x2E, 0x09, 0x08, 0x07, 0x02, 0x1E, 0x7E, 
-    0x3A, 0x2E, 0x14, 0x31, 0x0C, 0x24, 0x29, 0x48, 0x29, 0x2E, 0x0D, 0x1E, 
-    0x03, 0x40, 0x29, 0x2A, 0x29, 0x29, 0x07, 0x1F, 0x0A, 0x1C, 0x1F, 0x16, 
-    0x04, 0x06, 0x06, 0x04, 0x03, 0x04, 0x08, 0x04, 0x06, 0x06, 0x06, 0x04, 
-    0x04, 0x03, 0x08, 0x06, 0x06, 0x13, 0x06, 0x04, 0x03, 0x13, 0x12, 0x07, 
-    0x01, 0x03, 0x06, 0x04, 0x0A, 0x09, 0x12, 0x08, 0x01, 0x03, 0x06, 0x04, 
-    0x12, 0x1F, 0x14, 0x0C, 0x01, 0x03, 0x06, 0x13, 0x29, 0x10, 0x08, 0x06, 
-    0x03, 0x03, 0x03, 0x03, 0x29, 0x12, 0x08, 0x04, 0x03, 0x04, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x06, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x30, 0x49, 0x7B, 0x1F, 0x23, 0x15, 0x03, 0x05, 
-    0x30, 0x49, 0x7B, 0x24, 0x01, 0x1A, 0x03, 0x03, 0x2F, 0x2A, 0x29, 0x37, 
-    0x25, 0xB5, 0x24, 0x24, 0x2D, 0x3E, 0x2A, 0x2A, 0x55, 0x69, 0x96, 0x7B, 
-    0x29, 0x42, 0x3A, 0x39, 0x7E, 0x43, 0x48, 0x74, 0x2C, 0x49, 0x29, 0x2D, 
-    0x29, 0x39, 0x49, 0x28, 0xB4, 0x49, 0x36, 0x29, 0x36, 0x36, 0x3A, 0x5A, 
-    0x97, 0x49, 0x36, 0x2D, 0x2D, 0x2E, 0x36, 0x3A, 0x03, 0x08, 0x0D, 0x04, 
-    0x0A, 0x0D, 0x07, 0x04, 0x03, 0x08, 0x0D, 0x04, 0x04, 0x08, 0x16, 0x16, 
-    0x03, 0x0D, 0x0D, 0x04, 0x04, 0x08, 0x16, 0x10, 0x1C, 0x06, 0x0D, 0x04, 
-    0x04, 0x08, 0x16, 0x10, 0x4F, 0x22, 0x07, 0x04, 0x04, 0x08, 0x16, 0x10, 
-    0x7D, 0x1A, 0x06, 0x03, 0x04, 0x08, 0x07, 0x06, 0x55, 0x1F, 0x1A, 0x04, 
-    0x04, 0x0D, 0x08, 0x01, 0x71, 0xAE, 0x24, 0x1C, 0x03, 0x0C, 0x0C, 0x0E, 
-    0x0A, 0x08, 0x12, 0x04, 0x0B, 0x03, 0x06, 0x16, 0x0E, 0x06, 0x10, 0x04, 
-    0x01, 0x01, 0x06, 0x16, 0x0A, 0x06, 0x10, 0x04, 0x01, 0x06, 0x08, 0x0D, 
-    0x0A, 0x06, 0x10, 0x04, 0x04, 0x0D, 0x0D, 0x0D, 0x0A, 0x06, 0x12, 0x04, 
-    0x0B, 0x0D, 0x0D, 0x0D, 0x0E, 0x08, 0x07, 0x03, 0x01, 0x0D, 0x0D, 0x0D, 
-    0x0B, 0x0D, 0x08, 0x02, 0x04, 0x0D, 0x0D, 0x0D, 0x04, 0x0D, 0x08, 0x01, 
-    0x04, 0x0D, 0x0D, 0x11, 0x06, 0x19, 0x10, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x08, 0x09, 0x16, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x16, 0x16, 0x08, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x16, 0x10, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x0D, 0x14, 0x11, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x14, 0x09, 0x08, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x09, 0x07, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x09, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x07, 0x10, 0x12, 
-    0x39, 0x32, 0x32, 0x1E, 0x0D, 0x07, 0x10, 0x10, 0x27, 0x3A, 0x39, 0x1F, 
-    0x0D, 0x07, 0x10, 0x10, 0x42, 0x42, 0x3E, 0x1F, 0x0D, 0x07, 0x10, 0x10, 
-    0x4A, 0x26, 0x52, 0x12, 0x0D, 0x07, 0x10, 0x12, 0x2A, 0x27, 0x26, 0x1E, 
-    0x0D, 0x07, 0x10, 0x10, 0x48, 0x47, 0x36, 0x1F, 0x0D, 0x07, 0x10, 0x10, 
-    0x48, 0x2A, 0x70, 0x12, 0x0D, 0x07, 0x10, 0x10, 0x48, 0x2A, 0x52, 0x1F, 
-    0x1F, 0x2F, 0x50, 0x48, 0x49, 0x39, 0x27, 0x42, 0x30, 0x2E, 0x2F, 0x48, 
-    0x44, 0x42, 0x42, 0x49, 0x21, 0x2E, 0x2F, 0x27, 0x43, 0x43, 0x3E, 0x49, 
-    0x21, 0x2E, 0x2F, 0x39, 0x49, 0x43, 0x3E, 0x49, 0x30, 0x2E, 0x2F, 0x4A, 
-    0x56, 0x5A, 0x3E, 0x48, 0x30, 0x2E, 0x2F, 0x78, 0x56, 0x5A, 0x3E, 0x4A, 
-    0x2F, 0x2F, 0x2F, 0x48, 0x43, 0x4A, 0x27, 0x2A, 0x2E, 0x2F, 0x2F, 0x49, 
-    0x49, 0x39, 0x27, 0x49, 0x48, 0x49, 0x49, 0x2A, 0x4A, 0x54, 0x5F, 0x5E, 
-    0x49, 0x49, 0x2A, 0x2A, 0x4A, 0x54, 0x5F, 0x5E, 0x49, 0x49, 0x2A, 0x2A, 
-    0x4A, 0x54, 0x5F, 0x5B, 0x49, 0x49, 0x2A, 0x2A, 0x4A, 0x54, 0x5F, 0x5B, 
-    0x49, 0x49, 0x2A, 0x2A, 0x4A, 0x54, 0x5F, 0x5B, 0x48, 0x49, 0x2A, 0x2A, 
-    0x4A, 0x54, 0x5F, 0x5B, 0x49, 0x49, 0x2A, 0x2A, 0x4A, 0x54, 0x5F, 0x5B, 
-    0x49, 0x49, 0x48, 0x2A, 0x4A, 0x54, 0x5F, 0x5B, 0x5D, 0x5F, 0x5E, 0x5E, 
-    0x5F, 0x63, 0x73, 0x63, 0x5D, 0x5F, 0x5F, 0x5F, 0x65, 0x73, 0x63, 0x63, 
-    0x5E, 0x5F, 0x5F, 0x65, 0x73, 0x5F, 0x79, 0x75, 0x5E, 0x5E, 0x72, 0x63, 
-    0x72, 0x5D, 0x72, 0x64, 0x5E, 0x5E, 0x72, 0x72, 0x5E, 0x5D, 0x72, 0x63, 
-    0x5E, 0x5F, 0x72, 0x72, 0x5D, 0x5D, 0x72, 0x73, 0x5E, 0x5D, 0x72, 0x72, 
-    0x5D, 0x5D, 0x72, 0x73, 0x5E, 0x5D, 0x72, 0x72, 0x5D, 0x5D, 0x72, 0x73, 
-    0x73, 0x76, 0x76, 0x76, 0x79, 0x86, 0x96, 0x7D, 0x73, 0x76, 0x76, 0x76, 
-    0x79, 0x86, 0x96, 0x7D, 0x66, 0x76, 0x76, 0x76, 0x79, 0x86, 0x96, 0x7D, 
-    0x75, 0x76, 0x76, 0x76, 0x79, 0x86, 0x96, 0x7D, 0x73, 0x76, 0x76, 0x76, 
-    0x79, 0x86, 0x96, 0x7D, 0x73, 0x76, 0x76, 0x76, 0x79, 0x86, 0x96, 0x94, 
-    0x73, 0x66, 0x76, 0x76, 0x79, 0x86, 0x4F, 0x7D, 0x73, 0x64, 0x76, 0x66, 
-    0x67, 0xB6, 0x04, 0x35, 0x7D, 0x95, 0x95, 0x38, 0x33, 0x41, 0xB6, 0xA2, 
-    0x7D, 0x7D, 0x94, 0x1C, 0x7D, 0x41, 0x8D, 0x8C, 0x7D, 0x7D, 0x7D, 0x34, 
-    0x96, 0x96, 0x92, 0x67, 0x7D, 0x95, 0x94, 0x01, 0xB3, 0x91, 0x2B, 0x66, 
-    0x95, 0x94, 0x3B, 0x94, 0x93, 0x89, 0x79, 0x76, 0x95, 0x38, 0x08, 0x89, 
-    0x85, 0x60, 0x6A, 0x76, 0x41, 0x37, 0x51, 0x92, 0x85, 0x72, 0x76, 0x76, 
-    0x0A, 0x05, 0x07, 0x8D, 0x60, 0x76, 0x76, 0x76, 0x64, 0x5E, 0x80, 0x3E, 
-    0x3E, 0x3E, 0x3A, 0x2E, 0x66, 0x75, 0x62, 0x56, 0x5C, 0x53, 0x53, 0x48, 
-    0x66, 0x76, 0x79, 0x53, 0x55, 0x48, 0x49, 0x48, 0x76, 0x76, 0x66, 0x63, 
-    0x68, 0x68, 0x48, 0x48, 0x76, 0x76, 0x76, 0x76, 0x77, 0x5E, 0x80, 0x69, 
-    0x76, 0x76, 0x76, 0x76, 0x66, 0x73, 0x62, 0x7F, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x79, 0x8E, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x62, 
-    0x1E, 0x09, 0x13, 0x04, 0x04, 0x0B, 0x03, 0x03, 0x41, 0x10, 0x94, 0x19, 
-    0x0D, 0x0B, 0x03, 0x03, 0x47, 0x42, 0x2F, 0x1E, 0x41, 0x03, 0x03, 0x03, 
-    0x78, 0x78, 0x2D, 0x16, 0x31, 0x03, 0x01, 0x03, 0x7E, 0x50, 0x2E, 0x30, 
-    0x16, 0x1B, 0x38, 0x1D, 0x48, 0x3F, 0x21, 0x19, 0x07, 0x12, 0x19, 0x1D, 
-    0x43, 0x49, 0x26, 0x16, 0x1E, 0x09, 0x0D, 0x0B, 0x5A, 0x36, 0x30, 0x12, 
-    0x1E, 0x16, 0x08, 0x02, 0x3C, 0x34, 0x34, 0x34, 0x35, 0x34, 0x1D, 0x7C, 
-    0x03, 0x02, 0x02, 0x02, 0x01, 0x3C, 0x7C, 0x95, 0x03, 0x04, 0x03, 0x03, 
-    0x17, 0x02, 0x98, 0x8B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x94, 0x51, 
-    0x03, 0x03, 0x03, 0x03, 0x01, 0x4F, 0x25, 0x04, 0x04, 0x03, 0x17, 0x0E, 
-    0x1C, 0x95, 0x37, 0x94, 0x01, 0x0B, 0x22, 0x22, 0x96, 0x92, 0x93, 0x94, 
-    0x03, 0xB1, 0x98, 0x29, 0x55, 0x85, 0x88, 0x93, 0x41, 0x4F, 0x7D, 0x41, 
-    0x50, 0x4C, 0x8A, 0xA5, 0x94, 0x1C, 0x4E, 0x34, 0x40, 0x94, 0x42, 0x73, 
-    0x7C, 0x1A, 0x22, 0x35, 0x3D, 0x84, 0x6A, 0x76, 0x22, 0x34, 0x08, 0x87, 
-    0x67, 0x66, 0x76, 0x76, 0x51, 0x41, 0x94, 0x86, 0x65, 0x66, 0x76, 0x76, 
-    0x95, 0x7D, 0xAA, 0x86, 0x63, 0x66, 0x76, 0x76, 0x7D, 0x7D, 0xAA, 0x86, 
-    0x63, 0x66, 0x76, 0x76, 0x7D, 0x7D, 0xAA, 0x86, 0x63, 0x66, 0x76, 0x76, 
-    0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x5F, 0x5E, 0x62, 
-    0x76, 0x76, 0x76, 0x76, 0x77, 0x5F, 0x5E, 0x62, 0x76, 0x76, 0x66, 0x64, 
-    0x65, 0x63, 0x5E, 0x62, 0x76, 0x76, 0x66, 0x77, 0x77, 0x63, 0x5B, 0x62, 
-    0x76, 0x76, 0x66, 0x77, 0x75, 0x63, 0x59, 0x62, 0x76, 0x76, 0x66, 0x77, 
-    0x75, 0x63, 0x59, 0x62, 0x76, 0x76, 0x76, 0x77, 0x64, 0x5F, 0x5B, 0x5E, 
-    0x76, 0x66, 0x64, 0x79, 0x5E, 0x62, 0x79, 0x65, 0x62, 0x59, 0x44, 0x47, 
-    0x2A, 0x43, 0x48, 0x49, 0x62, 0x62, 0x62, 0x2B, 0x49, 0x43, 0x2A, 0x49, 
-    0x62, 0x62, 0x62, 0x55, 0x78, 0x43, 0x2A, 0x49, 0x62, 0x59, 0x44, 0x43, 
-    0x43, 0x43, 0x2A, 0x49, 0x62, 0x59, 0x43, 0x49, 0x2A, 0x43, 0x2A, 0x49, 
-    0x62, 0x62, 0x5C, 0x49, 0x49, 0x43, 0x2A, 0x49, 0x62, 0x5B, 0x74, 0x27, 
-    0x78, 0x53, 0x2A, 0x49, 0x62, 0x62, 0x5C, 0x48, 0x49, 0x5A, 0x2A, 0x48, 
-    0x49, 0x49, 0x48, 0x3E, 0x3A, 0x3A, 0x36, 0x2F, 0x49, 0x49, 0x2A, 0x39, 
-    0x4A, 0x42, 0x36, 0x2F, 0x49, 0x49, 0x42, 0xB3, 0x48, 0x4A, 0x36, 0x36, 
-    0x48, 0x2A, 0x4A, 0x30, 0x49, 0x3E, 0x4B, 0x27, 0x48, 0x3E, 0x47, 0x45, 
-    0x48, 0x3E, 0x36, 0x39, 0x47, 0x36, 0x2E, 0x30, 0x5A, 0x78, 0x2E, 0x2E, 
-    0x42, 0x2E, 0x30, 0x50, 0x5C, 0x58, 0x57, 0x2E, 0x48, 0x54, 0x50, 0x96, 
-    0x5C, 0x58, 0x57, 0x2E, 0x2F, 0x32, 0x2F, 0x32, 0x1E, 0x07, 0x0D, 0x0D, 
-    0x30, 0x2E, 0x2F, 0x2E, 0x30, 0x0D, 0x0D, 0x0D, 0x2D, 0x2F, 0x2F, 0x2F, 
-    0x1F, 0x07, 0x0D, 0x0D, 0x2D, 0x2F, 0x2F, 0x32, 0x1F, 0x16, 0x0D, 0x0D, 
-    0x2D, 0x2F, 0x2F, 0x2F, 0x2F, 0x1F, 0x09, 0x0D, 0x2E, 0x2F, 0x2F, 0x2E, 
-    0x30, 0x21, 0x11, 0x08, 0x2F, 0x2F, 0x2F, 0x2E, 0x2F, 0x21, 0x16, 0x0D, 
-    0x2F, 0x2F, 0x2F, 0x32, 0x2E, 0x30, 0x12, 0x11, 0x07, 0x07, 0x0D, 0x0D, 
-    0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x07, 0x11, 0x09, 0x0D, 0x0D, 
-    0x0D, 0x0D, 0x08, 0x16, 0x16, 0x09, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x07, 
-    0x14, 0x09, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x09, 0x14, 0x09, 0x0D, 0x31, 
-    0x0D, 0x0D, 0x08, 0x09, 0x14, 0x09, 0x0D, 0x1A, 0x0D, 0x0D, 0x08, 0x09, 
-    0x14, 0x09, 0x07, 0x22, 0x08, 0x0D, 0x08, 0x09, 0x19, 0x08, 0x1E, 0x08, 
-    0x06, 0x09, 0x12, 0x19, 0x0D, 0x0C, 0x15, 0x03, 0x0C, 0x30, 0x1F, 0x07, 
-    0x07, 0x0C, 0x02, 0x04, 0x07, 0x16, 0x19, 0x11, 0x0D, 0x0C, 0x01, 0x03, 
-    0x22, 0x29, 0x3F, 0x0C, 0x09, 0x0C, 0x01, 0x01, 0x45, 0x3A, 0x7B, 0x0D, 
-    0x11, 0x0C, 0x01, 0x02, 0x48, 0x78, 0x46, 0x16, 0x11, 0x06, 0x05, 0x01, 
-    0x48, 0x3E, 0x0D, 0x16, 0x11, 0x06, 0x05, 0x01, 0x2A, 0x3E, 0x16, 0x10, 
-    0x0D, 0x13, 0x02, 0x01, 0x0D, 0x0C, 0x0A, 0x03, 0x01, 0x0E, 0x04, 0x0C, 
-    0x0D, 0x08, 0x03, 0x03, 0x17, 0x9F, 0xA6, 0x83, 0x08, 0x06, 0x04, 0x02, 
-    0x40, 0x78, 0x49, 0x2A, 0x03, 0x13, 0x0E, 0x08, 0x6D, 0x55, 0x56, 0x5A, 
-    0x01, 0x01, 0x24, 0x12, 0x82, 0x44, 0x48, 0x39, 0x01, 0x03, 0x40, 0x12, 
-    0x62, 0x49, 0x2D, 0x10, 0x01, 0x03, 0x24, 0x23, 0x71, 0x2A, 0x52, 0x12, 
-    0x0B, 0x18, 0x19, 0x58, 0x53, 0x3A, 0x08, 0x2F, 0x06, 0x40, 0x3F, 0x48, 
-    0x4B, 0x39, 0x6E, 0x4F, 0x24, 0x4F, 0x47, 0x48, 0x47, 0x27, 0x1F, 0x09, 
-    0x48, 0x49, 0x48, 0x2A, 0x2A, 0x2C, 0x1E, 0x0A, 0x78, 0x26, 0x2F, 0x2A, 
-    0x2A, 0x21, 0x46, 0x08, 0x83, 0x0C, 0x1E, 0x2A, 0x2A, 0x32, 0x02, 0x03, 
-    0x07, 0x21, 0x32, 0x2A, 0x2A, 0x32, 0x18, 0x0A, 0x30, 0x29, 0x30, 0x4A, 
-    0x2A, 0x30, 0x01, 0x04, 0x36, 0x30, 0x4C, 0x39, 0x32, 0x19, 0x06, 0x0A, 
-    0x36, 0x12, 0x08, 0x04, 0x01, 0x03, 0x0E, 0x01, 0x30, 0x12, 0x06, 0x04, 
-    0x01, 0x04, 0x0E, 0x01, 0x08, 0x12, 0x06, 0x04, 0x01, 0x13, 0x0B, 0x06, 
-    0x1B, 0x12, 0x06, 0x04, 0x01, 0x13, 0x0B, 0x0C, 0x1B, 0x12, 0x08, 0x04, 
-    0x03, 0x04, 0x0B, 0x0C, 0x1B, 0x12, 0x0C, 0x04, 0x01, 0x03, 0x01, 0x0C, 
-    0x1B, 0x12, 0x06, 0x04, 0x01, 0x02, 0x0F, 0x14, 0x1B, 0x12, 0x06, 0x04, 
-    0x01, 0x01, 0x16, 0x10, 0x08, 0x08, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x11, 0x0D, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x11, 0x06, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x07, 0x04, 0x03, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x09, 0x13, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x11, 0x13, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x07, 0x13, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x08, 0x13, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x2C, 0x49, 0x29, 0x42, 
-    0x47, 0x50, 0x47, 0x2A, 0x2C, 0x49, 0x2F, 0x43, 0x49, 0x98, 0x32, 0x4C, 
-    0x2C, 0x49, 0x39, 0x53, 0x80, 0x24, 0x1F, 0x21, 0x3F, 0x49, 0x2A, 0x53, 
-    0x78, 0x24, 0x1F, 0x1F, 0x2F, 0x48, 0x48, 0x48, 0x3A, 0x22, 0x21, 0x21, 
-    0x1F, 0x2A, 0x48, 0x48, 0x3A, 0x46, 0x21, 0x1F, 0x1E, 0x47, 0x48, 0x44, 
-    0x3A, 0x46, 0x21, 0x1F, 0x2D, 0x48, 0x48, 0x5A, 0x3A, 0x22, 0x21, 0x21, 
-    0x53, 0x45, 0x24, 0x1C, 0x03, 0x04, 0x13, 0x01, 0x49, 0x7E, 0x12, 0x02, 
-    0x03, 0x04, 0x06, 0x01, 0xAA, 0x60, 0xA5, 0x40, 0x0C, 0x01, 0x13, 0x01, 
-    0x9C, 0x60, 0xA5, 0xA3, 0x09, 0x03, 0x06, 0x01, 0xAA, 0x60, 0xA5, 0xAC, 
-    0x09, 0x0A, 0x06, 0x01, 0x50, 0x74, 0x78, 0x19, 0x09, 0x0A, 0x06, 0x01, 
-    0x32, 0x44, 0x3E, 0x0F, 0x37, 0x0A, 0x06, 0x03, 0x52, 0x49, 0x49, 0x40, 
-    0x1D, 0x06, 0x08, 0x04, 0x03, 0x0D, 0x0D, 0x03, 0x0B, 0x06, 0x07, 0x14, 
-    0x0A, 0x0D, 0x0D, 0x03, 0x01, 0x04, 0x07, 0x14, 0x0A, 0x0D, 0x08, 0x0E, 
-    0x04, 0x09, 0x14, 0x09, 0x0A, 0x0D, 0x13, 0x01, 0x04, 0x07, 0x09, 0x07, 
-    0x0A, 0x0D, 0x13, 0x01, 0x04, 0x08, 0x0D, 0x0D, 0x0A, 0x0D, 0x06, 0x01, 
-    0x04, 0x0D, 0x0D, 0x0D, 0x04, 0x0D, 0x0D, 0x03, 0x04, 0x07, 0x0D, 0x0D, 
-    0x03, 0x0C, 0x0C, 0x01, 0x04, 0x07, 0x0D, 0x0D, 0x11, 0x0D, 0x0D, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x0D, 0x0D, 0x0D, 0x14, 0x07, 0x0C, 0x14, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x12, 0x21, 0x21, 0x12, 0x08, 0x0D, 0x0D, 0x08, 
-    0x12, 0x29, 0x2E, 0x10, 0x0D, 0x0D, 0x0D, 0x08, 0x12, 0x2D, 0x2D, 0x21, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x12, 0x2D, 0x29, 0x30, 0x0D, 0x0D, 0x0D, 0x08, 
-    0x12, 0x2E, 0x2E, 0x21, 0x0D, 0x0D, 0x0D, 0x08, 0x12, 0x21, 0x21, 0x21, 
-    0x08, 0x07, 0x10, 0x16, 0x29, 0x2D, 0x12, 0x30, 0x11, 0x07, 0x10, 0x10, 
-    0x3E, 0x3A, 0x12, 0x30, 0x10, 0x07, 0x10, 0x16, 0x4A, 0x2A, 0x52, 0x30, 
-    0x10, 0x07, 0x10, 0x16, 0x4A, 0x2A, 0x52, 0x30, 0x1E, 0x0D, 0x10, 0x10, 
-    0x48, 0x2A, 0x1E, 0x30, 0x1F, 0x08, 0x07, 0x14, 0x36, 0x29, 0x1F, 0x30, 
-    0x1F, 0x0D, 0x07, 0x07, 0x10, 0x1F, 0x1F, 0x30, 0x30, 0x11, 0x09, 0x07, 
-    0x1E, 0x30, 0x1F, 0x3F, 0x2E, 0x2F, 0x2F, 0x2A, 0x48, 0x4B, 0x4A, 0x48, 
-    0x29, 0x2F, 0x2F, 0x2E, 0x29, 0x4B, 0x53, 0x5A, 0x39, 0x2E, 0x2F, 0x2F, 
-    0x2E, 0x4B, 0x59, 0x43, 0x3A, 0x2E, 0x2F, 0x2F, 0x2E, 0x4B, 0x53, 0x43, 
-    0x39, 0x2E, 0x2F, 0x2F, 0x2E, 0x4B, 0x53, 0x43, 0x36, 0x2D, 0x2F, 0x2F, 
-    0x2D, 0x4B, 0x53, 0x43, 0x39, 0x2E, 0x2F, 0x2F, 0x2E, 0x39, 0x43, 0x5A, 
-    0x2A, 0x2E, 0x32, 0x2E, 0x32, 0x2D, 0x2A, 0x2A, 0x4A, 0x43, 0x49, 0x4A, 
-    0x4A, 0x54, 0x5F, 0x5B, 0x47, 0x49, 0x49, 0x2A, 0x4A, 0x54, 0x5F, 0x5B, 
-    0x47, 0x5A, 0x5A, 0x4A, 0x4A, 0x54, 0x5F, 0x5E, 0x47, 0x44, 0x44, 0x4A, 
-    0x4A, 0x54, 0x5F, 0x5F, 0x4A, 0x2A, 0x2A, 0x2A, 0x4A, 0x54, 0x5F, 0x5F, 
-    0x47, 0x5A, 0x49, 0x4A, 0x4A, 0x54, 0x5F, 0x5F, 0x47, 0x49, 0x48, 0x2A, 
-    0x4A, 0x54, 0x5F, 0x5F, 0x2A, 0x47, 0x4A, 0x2A, 0x4A, 0x54, 0x5F, 0x5F, 
-    0x5E, 0x5D, 0x72, 0x72, 0x5D, 0x5D, 0x72, 0x73, 0x5E, 0x5F, 0x72, 0x72, 
-    0x5F, 0x5D, 0x72, 0x73, 0x5D, 0x5F, 0x5D, 0x65, 0x77, 0x5D, 0x72, 0x73, 
-    0x5F, 0x5F, 0x5D, 0x65, 0x76, 0x5F, 0x72, 0x73, 0x5F, 0x5F, 0x5D, 0x65, 
-    0x75, 0x5D, 0x72, 0x73, 0x5F, 0x5F, 0x5D, 0x72, 0x76, 0x5F, 0x5F, 0x5F, 
-    0x5F, 0x5F, 0x5F, 0x5E, 0x77, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x72, 
-    0x63, 0x5F, 0x5F, 0x5F, 0x79, 0x65, 0x73, 0x77, 0xA0, 0x24, 0x01, 0x22, 
-    0x79, 0x73, 0x73, 0xA0, 0xB7, 0xB8, 0x01, 0x01, 0x65, 0x73, 0x63, 0xA0, 
-    0x40, 0x0B, 0x02, 0x01, 0x5F, 0x73, 0xA0, 0x9E, 0xA8, 0xB0, 0x02, 0x01, 
-    0x63, 0x63, 0xA1, 0xA8, 0xA8, 0xB9, 0xAF, 0x01, 0x67, 0xA1, 0x9E, 0xA8, 
-    0x24, 0x02, 0x01, 0x01, 0x5E, 0xB7, 0x3B, 0xA8, 0xBA, 0xA7, 0xA6, 0x1D, 
-    0x72, 0xB7, 0xA6, 0xA8, 0xA7, 0xA8, 0x9F, 0x01, 0x15, 0xAF, 0xA8, 0xA9, 
-    0x9B, 0x66, 0x76, 0x76, 0x01, 0xB0, 0xA8, 0xBA, 0x9B, 0x66, 0x76, 0x76, 
-    0x01, 0xAF, 0x31, 0xA1, 0x9B, 0x66, 0x76, 0x76, 0x01, 0xAF, 0xA8, 0x9E, 
-    0x9B, 0x66, 0x76, 0x76, 0x01, 0x01, 0xB0, 0xB1, 0xA1, 0x75, 0x66, 0x76, 
-    0x01, 0x1D, 0x1D, 0x7A, 0xBA, 0x9B, 0x76, 0x76, 0xAF, 0xB9, 0xA9, 0xB0, 
-    0xA8, 0xA1, 0x75, 0x76, 0x02, 0x02, 0xA7, 0xB0, 0xB1, 0xA1, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x73, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x66, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x64, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x64, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x64, 0x76, 0x76, 0x76, 0x66, 0x66, 0x6A, 0x65, 0x79, 
-    0x76, 0x76, 0x76, 0x73, 0x84, 0x84, 0x82, 0x7F, 0x76, 0x66, 0x73, 0x8E, 
-    0x8D, 0xB1, 0xA2, 0x7B, 0x53, 0x78, 0x39, 0x21, 0x1C, 0x12, 0x1F, 0x1E, 
-    0x56, 0x44, 0x2A, 0x2C, 0x16, 0x14, 0x10, 0x30, 0x5B, 0x3E, 0x32, 0x08, 
-    0x12, 0x12, 0x09, 0x09, 0x5D, 0x49, 0x39, 0x19, 0x10, 0x25, 0x12, 0x09, 
-    0x62, 0x29, 0x10, 0x12, 0x1E, 0x25, 0x07, 0x1F, 0x71, 0x49, 0x4B, 0x23, 
-    0x0D, 0x1E, 0x12, 0x0D, 0x2A, 0x6D, 0x32, 0x1F, 0x12, 0x51, 0x1E, 0x12, 
-    0x70, 0x16, 0x19, 0x08, 0x1E, 0x4F, 0x0D, 0x1F, 0x1F, 0x1E, 0x96, 0x60, 
-    0x79, 0x85, 0x90, 0x89, 0x30, 0x1F, 0x89, 0x64, 0x63, 0x85, 0x8F, 0x89, 
-    0x25, 0x07, 0x89, 0x64, 0x76, 0x5B, 0x8E, 0x91, 0x19, 0x6C, 0x86, 0x64, 
-    0x76, 0x5D, 0x85, 0x89, 0x30, 0x1E, 0x9A, 0x63, 0x76, 0x64, 0x28, 0x90, 
-    0x11, 0x6E, 0xB2, 0x65, 0x76, 0x66, 0x67, 0x85, 0x12, 0x16, 0xB2, 0x79, 
-    0x76, 0x66, 0x63, 0x90, 0x30, 0x1F, 0x3A, 0x59, 0x76, 0x66, 0x64, 0x8E, 
-    0x94, 0x7D, 0xAA, 0x86, 0x63, 0x66, 0x76, 0x76, 0x94, 0x7D, 0xAA, 0x86, 
-    0x63, 0x66, 0x76, 0x76, 0x7D, 0x95, 0xAA, 0x86, 0x63, 0x66, 0x76, 0x76, 
-    0x0A, 0x94, 0xAA, 0x86, 0x63, 0x66, 0x76, 0x76, 0x92, 0x34, 0x70, 0x86, 
-    0x63, 0x66, 0x76, 0x76, 0x88, 0x94, 0x0D, 0x86, 0x65, 0x66, 0x76, 0x76, 
-    0xB4, 0x1A, 0xB0, 0xB6, 0x84, 0x66, 0x76, 0x76, 0x93, 0x22, 0x01, 0xA6, 
-    0xB2, 0x65, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x64, 0x5E, 
-    0x5B, 0x59, 0x79, 0x72, 0x76, 0x66, 0x64, 0x5E, 0x5B, 0x59, 0x79, 0x72, 
-    0x76, 0x66, 0x64, 0x5E, 0x5B, 0x59, 0x79, 0x72, 0x76, 0x66, 0x64, 0x5E, 
-    0x5B, 0x59, 0x79, 0x72, 0x76, 0x66, 0x64, 0x5E, 0x5B, 0x59, 0x79, 0x72, 
-    0x76, 0x66, 0x64, 0x5E, 0x5B, 0x59, 0x79, 0x72, 0x76, 0x76, 0x73, 0x5D, 
-    0x5B, 0x59, 0x5D, 0x79, 0x76, 0x76, 0x72, 0x5F, 0x5B, 0x62, 0x5B, 0x5F, 
-    0x62, 0x62, 0x59, 0x44, 0x49, 0x2A, 0x2A, 0x9A, 0x56, 0x5B, 0x74, 0x4A, 
-    0x2A, 0x48, 0x2A, 0x48, 0x5C, 0x62, 0x5C, 0x2A, 0x4B, 0x36, 0x42, 0x48, 
-    0x62, 0x59, 0x68, 0x5A, 0x3A, 0x3A, 0x3A, 0x81, 0x62, 0x62, 0x5C, 0x49, 
-    0x3E, 0x47, 0x4B, 0x60, 0x62, 0x5B, 0x5E, 0x5A, 0x48, 0x47, 0x4B, 0x5D, 
-    0x62, 0x5B, 0x5E, 0x5A, 0x48, 0x47, 0x36, 0x60, 0x62, 0x5B, 0x5E, 0x49, 
-    0x4A, 0x4A, 0x47, 0x62, 0x69, 0x60, 0xB3, 0x30, 0x5C, 0x58, 0x57, 0x2E, 
-    0x55, 0x74, 0x50, 0x30, 0x5C, 0x58, 0x57, 0x2E, 0x80, 0x74, 0x50, 0x50, 
-    0x28, 0x69, 0x57, 0x2E, 0x55, 0x74, 0x50, 0x50, 0x28, 0x69, 0x57, 0x2E, 
-    0x5E, 0x55, 0x2F, 0x2F, 0x5C, 0x80, 0x57, 0x2E, 0x62, 0x2A, 0x30, 0x3F, 
-    0x5B, 0x69, 0x57, 0x2E, 0x62, 0x2A, 0x30, 0x50, 0x28, 0x28, 0x97, 0x32, 
-    0x7F, 0x47, 0x2E, 0x2F, 0x5C, 0x80, 0x57, 0x2E, 0x2F, 0x2F, 0x2E, 0x29, 
-    0x2E, 0x2F, 0x1E, 0x16, 0x2F, 0x2F, 0x2F, 0x3A, 0x3F, 0x1F, 0x1E, 0x08, 
-    0x2F, 0x2F, 0x2E, 0x42, 0x30, 0x1E, 0x1F, 0x07, 0x2F, 0x2F, 0x2E, 0x3E, 
-    0x32, 0x0D, 0x1E, 0x10, 0x2F, 0x2F, 0x2E, 0x47, 0x2C, 0x1E, 0x16, 0x07, 
-    0x2F, 0x2F, 0x2E, 0x47, 0x3A, 0x1F, 0x07, 0x08, 0x2E, 0x2F, 0x2E, 0x47, 
-    0x3A, 0x1F, 0x07, 0x0D, 0x2F, 0x2F, 0x2E, 0x47, 0x3A, 0x1F, 0x07, 0x0D, 
-    0x08, 0x0D, 0x08, 0x09, 0x14, 0x0C, 0x1E, 0x09, 0x0D, 0x0D, 0x08, 0x07, 
-    0x19, 0x1E, 0x21, 0x09, 0x0D, 0x0D, 0x0D, 0x08, 0x11, 0x30, 0x1F, 0x31, 
-    0x08, 0x0D, 0x0D, 0x08, 0x11, 0x2D, 0x1E, 0x6E, 0x0D, 0x0D, 0x0D, 0x08, 
-    0x14, 0x48, 0x2D, 0xB1, 0x0D, 0x0D, 0x0D, 0x08, 0x14, 0x48, 0x29, 0x46, 
-    0x0D, 0x08, 0x0D, 0x08, 0x14, 0x49, 0x3A, 0x10, 0x07, 0x09, 0x0D, 0x08, 
-    0x11, 0x2A, 0x4A, 0xB3, 0x42, 0x3E, 0x11, 0x10, 0x0D, 0x0A, 0x02, 0x01, 
-    0x47, 0x3E, 0x07, 0x10, 0x0D, 0x0A, 0x05, 0x02, 0x47, 0x3E, 0x09, 0x1E, 
-    0x07, 0x04, 0x03, 0x01, 0x47, 0x3E, 0x16, 0x1E, 0x0D, 0x13, 0x0C, 0x03, 
-    0x47, 0x3E, 0x19, 0x1E, 0x0D, 0x13, 0x06, 0x03, 0x2A, 0x3E, 0x07, 0x1E, 
-    0x0D, 0x04, 0x13, 0x03, 0x48, 0x3E, 0x07, 0x1E, 0x0D, 0x0C, 0x0F, 0x03, 
-    0x48, 0x3E, 0x07, 0x1E, 0x07, 0x14, 0x1B, 0x0E, 0x03, 0x1A, 0xB3, 0x62, 
-    0x53, 0x3E, 0x08, 0x32, 0x03, 0x1A, 0x4F, 0x28, 0x56, 0x78, 0x70, 0x3A, 
-    0x03, 0x1A, 0x4F, 0x28, 0x53, 0x3A, 0x2F, 0x2A, 0x03, 0x1A, 0x4F, 0x5C, 
-    0x53, 0x3A, 0x2D, 0x2A, 0x03, 0x1A, 0x4F, 0x43, 0x43, 0x3A, 0x2E, 0x2A, 
-    0x03, 0x1A, 0x4F, 0x43, 0x44, 0x3E, 0x2D, 0x2A, 0x0B, 0x1A, 0x23, 0x43, 
-    0x5A, 0x3E, 0x2D, 0x2A, 0x03, 0x1A, 0x23, 0x43, 0x53, 0x3A, 0x2E, 0x2A, 
-    0x4B, 0x19, 0x42, 0x3A, 0x10, 0x08, 0x06, 0x03, 0x47, 0x10, 0x4A, 0x42, 
-    0x1E, 0x1B, 0x03, 0x03, 0x42, 0x19, 0x26, 0x29, 0x1E, 0x08, 0x01, 0x1B, 
-    0x47, 0x30, 0x21, 0x1E, 0x1F, 0x08, 0x01, 0x09, 0x2A, 0x4A, 0x21, 0x10, 
-    0x1F, 0x07, 0x01, 0x09, 0x47, 0x36, 0x11, 0x12, 0x1F, 0x07, 0x01, 0x09, 
-    0x3E, 0x52, 0x19, 0x10, 0x1E, 0x07, 0x03, 0x09, 0x42, 0xB3, 0x10, 0x10, 
-    0x1F, 0x0F, 0x1D, 0x16, 0x1B, 0x12, 0x13, 0x03, 0x02, 0x22, 0x11, 0x10, 
-    0x1B, 0x09, 0x04, 0x01, 0x02, 0x1B, 0x16, 0x07, 0x10, 0x08, 0x0A, 0x0E, 
-    0x02, 0x21, 0x25, 0x04, 0x1E, 0x07, 0x01, 0x02, 0x05, 0x21, 0x25, 0x31, 
-    0x1E, 0x07, 0x03, 0x01, 0x05, 0x21, 0x25, 0x31, 0x1E, 0x07, 0x13, 0x01, 
-    0x02, 0x21, 0x1E, 0x0C, 0x1E, 0x16, 0x08, 0x01, 0x0B, 0x1E, 0x14, 0x08, 
-    0x12, 0x07, 0x04, 0x0E, 0x01, 0x08, 0x0D, 0x06, 0x06, 0x04, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x06, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x08, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x08, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x0D, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x08, 0x04, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x13, 0x08, 0x04, 0x03, 0x01, 
-    0x39, 0x2A, 0x4A, 0x49, 0x3A, 0x16, 0x10, 0x12, 0x3A, 0x49, 0x2A, 0x49, 
-    0x3E, 0x30, 0x09, 0x10, 0x3A, 0x44, 0x48, 0x49, 0x3E, 0x1F, 0x09, 0x10, 
-    0x3A, 0x49, 0x4A, 0x49, 0x3E, 0x1E, 0x1E, 0x12, 0x3A, 0x2A, 0x50, 0x43, 
-    0x3E, 0x1E, 0x2F, 0x1F, 0x29, 0x2A, 0x1F, 0x43, 0x3E, 0x1E, 0x2F, 0x1F, 
-    0x1E, 0x27, 0x21, 0x43, 0x27, 0x52, 0x2E, 0x1F, 0x1E, 0x3A, 0x96, 0x43, 
-    0x2A, 0x1E, 0x2D, 0x2E, 0x52, 0x49, 0x2A, 0x3A, 0x23, 0x02, 0x0C, 0x06, 
-    0x1F, 0x2A, 0x42, 0x49, 0x4D, 0x24, 0x1C, 0x04, 0x1F, 0x2A, 0x47, 0x48, 
-    0x4D, 0x24, 0x1C, 0x04, 0x1F, 0x2A, 0x42, 0x48, 0x4D, 0x1A, 0x0F, 0x0F, 
-    0x1E, 0x47, 0x2A, 0x53, 0x4D, 0x24, 0x22, 0x24, 0x12, 0x2C, 0x4A, 0x56, 
-    0x7E, 0x98, 0x4C, 0x6F, 0xA4, 0x6C, 0x2D, 0x49, 0x49, 0x4A, 0x2A, 0x5C, 
-    0x78, 0x3D, 0x10, 0x4B, 0x4A, 0x48, 0x3E, 0x2A, 0x03, 0x01, 0x13, 0x01, 
-    0x04, 0x11, 0x0D, 0x0D, 0x03, 0x02, 0x0C, 0x03, 0x03, 0x09, 0x08, 0x0D, 
-    0x03, 0x02, 0x06, 0x04, 0x04, 0x08, 0x13, 0x0D, 0x0F, 0x0B, 0x06, 0x0D, 
-    0x0C, 0x0A, 0x0A, 0x08, 0x24, 0x1A, 0x04, 0x08, 0x13, 0x05, 0x0E, 0x08, 
-    0xAD, 0x25, 0x1A, 0x08, 0x13, 0x02, 0x03, 0x08, 0x82, 0x78, 0xAC, 0x07, 
-    0x04, 0x02, 0x03, 0x08, 0x43, 0x62, 0x60, 0xA3, 0x01, 0x01, 0x0E, 0x08, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x12, 0x30, 0x30, 0x21, 0x0D, 0x0D, 0x0D, 0x08, 
-    0x12, 0x30, 0x30, 0x21, 0x0D, 0x0D, 0x0D, 0x08, 0x12, 0x30, 0x30, 0x21, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x12, 0x30, 0x30, 0x1F, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x14, 0x12, 0x12, 0x1F, 0x0D, 0x0D, 0x0D, 0x0D, 0x07, 0x19, 0x12, 0x1F, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x09, 0x12, 0x1F, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x08, 0x09, 0x12, 0x1F, 0x32, 0x14, 0x09, 0x07, 0x1E, 0x21, 0x1F, 0x3F, 
-    0x30, 0x16, 0x07, 0x07, 0x1F, 0x21, 0x1F, 0x30, 0x1F, 0x16, 0x0C, 0x10, 
-    0x21, 0x21, 0x21, 0x1F, 0x21, 0x16, 0x0C, 0x16, 0x21, 0x21, 0x21, 0x1F, 
-    0x21, 0x16, 0x08, 0x12, 0x21, 0x21, 0x21, 0x1E, 0x21, 0x16, 0x09, 0x10, 
-    0x21, 0x1F, 0x21, 0x3F, 0x21, 0x16, 0x09, 0x14, 0x1E, 0x30, 0x21, 0x3A, 
-    0x21, 0x16, 0x08, 0x07, 0x1E, 0x30, 0x29, 0x3A, 0x49, 0x2E, 0x2F, 0x2E, 
-    0x2F, 0x29, 0x27, 0x4A, 0x2A, 0x55, 0x2C, 0x30, 0x21, 0x36, 0x27, 0x3A, 
-    0x36, 0x5C, 0x6D, 0x1E, 0x21, 0x3A, 0x27, 0x3A, 0x2D, 0x43, 0x26, 0x52, 
-    0x30, 0x3A, 0x27, 0x3A, 0x2F, 0x43, 0x26, 0x52, 0x30, 0x3A, 0x27, 0x3A, 
-    0x3A, 0x59, 0xAD, 0xB3, 0x2E, 0x39, 0x3A, 0x4B, 0x49, 0x71, 0x6D, 0x50, 
-    0x2E, 0x29, 0x36, 0x36, 0x42, 0x5B, 0x54, 0x36, 0x2F, 0x29, 0x2E, 0x2E, 
-    0x48, 0x49, 0x2A, 0x2A, 0x4A, 0x54, 0x5F, 0x5F, 0x2A, 0x53, 0x2A, 0x2A, 
-    0x4A, 0x48, 0x72, 0x65, 0x2A, 0x53, 0x2A, 0x2A, 0x4A, 0x48, 0x72, 0x72, 
-    0x2A, 0x53, 0x2A, 0x2A, 0x4A, 0x48, 0x72, 0x72, 0x2A, 0x43, 0x4A, 0x2A, 
-    0x4A, 0x48, 0x72, 0x72, 0x2A, 0x56, 0x49, 0x2A, 0x4A, 0x48, 0x72, 0x72, 
-    0x3A, 0x49, 0x53, 0x48, 0x47, 0x48, 0x72, 0x65, 0x39, 0x27, 0x43, 0x48, 
-    0x4A, 0x48, 0x72, 0x72, 0x5F, 0x5D, 0x79, 0x73, 0x63, 0x5F, 0x5F, 0xA0, 
-    0x5D, 0x5D, 0x72, 0x73, 0x5F, 0x5F, 0x5F, 0xA0, 0x5D, 0x5F, 0x5F, 0x72, 
-    0x5F, 0x5F, 0x5F, 0xA0, 0x5D, 0x5F, 0x5F, 0x5D, 0x5F, 0x5F, 0x5F, 0xA0, 
-    0x5D, 0x5F, 0x5F, 0x5F, 0x65, 0x5F, 0x5F, 0xA0, 0x5D, 0x5F, 0x5F, 0x5F, 
-    0x63, 0x5F, 0x5F, 0x5F, 0x5D, 0x5F, 0x5F, 0x5F, 0x79, 0x5F, 0x5F, 0x5F, 
-    0x5D, 0x5F, 0x5F, 0x5F, 0x5D, 0x5F, 0x5F, 0x5F, 0xA1, 0xA7, 0x3B, 0xA8, 
-    0x3B, 0xA6, 0x02, 0x01, 0xB7, 0xB0, 0xB9, 0xA8, 0x01, 0x05, 0x05, 0x01, 
-    0xB7, 0xB0, 0x02, 0xA8, 0xB0, 0x9F, 0x05, 0x01, 0xB7, 0xB0, 0x9F, 0xB0, 
-    0xA8, 0x9F, 0x05, 0x01, 0xBA, 0xB9, 0x9F, 0x1D, 0xA8, 0x9F, 0x05, 0x01, 
-    0xA0, 0xB1, 0x0A, 0x01, 0xA8, 0x9F, 0x05, 0x01, 0xA0, 0xA7, 0x3B, 0xB9, 
-    0xA8, 0x9F, 0x05, 0x01, 0xA0, 0x9E, 0xA7, 0xB9, 0xA8, 0x9F, 0x05, 0x01, 
-    0x01, 0x02, 0xB0, 0x1D, 0x3B, 0xBA, 0xA0, 0x76, 0x01, 0x02, 0xB0, 0xA8, 
-    0x01, 0xB1, 0xA1, 0x66, 0x01, 0xAF, 0xA8, 0xA8, 0x01, 0xB1, 0xA0, 0x76, 
-    0x01, 0xAF, 0xA8, 0x1D, 0x0B, 0xB1, 0xA0, 0x6A, 0x01, 0xAF, 0xA8, 0x01, 
-    0x0B, 0xB1, 0xA0, 0x77, 0x01, 0x02, 0xB0, 0x01, 0x40, 0x9E, 0xA0, 0x59, 
-    0x01, 0x02, 0x0B, 0xB0, 0xA8, 0xA1, 0x79, 0x8E, 0x01, 0xAF, 0xA8, 0xA8, 
-    0xA7, 0xA1, 0x5E, 0x85, 0x76, 0x77, 0x61, 0x99, 0x2C, 0x50, 0xAA, 0x40, 
-    0x64, 0x68, 0x85, 0x88, 0x93, 0x93, 0x93, 0x23, 0x72, 0x90, 0x90, 0x88, 
-    0x96, 0x98, 0x41, 0x25, 0x43, 0x85, 0x90, 0x88, 0x96, 0x7D, 0x7D, 0x08, 
-    0x85, 0x90, 0x90, 0x92, 0x98, 0x95, 0x94, 0x02, 0x85, 0x90, 0x90, 0x93, 
-    0x94, 0x95, 0x94, 0x18, 0x90, 0x90, 0x89, 0x95, 0x7D, 0x7D, 0x37, 0x1A, 
-    0x90, 0x90, 0x7D, 0x94, 0x7D, 0x7D, 0x1D, 0x1C, 0x01, 0x10, 0x21, 0x12, 
-    0x1B, 0x1E, 0x10, 0x07, 0x0B, 0x18, 0x06, 0x1F, 0x4F, 0x08, 0x1F, 0x12, 
-    0x0B, 0x15, 0x1A, 0x1B, 0x21, 0x12, 0x07, 0x21, 0x20, 0x01, 0x02, 0x1A, 
-    0x09, 0x30, 0x1E, 0x1B, 0x02, 0x18, 0x02, 0xAF, 0x02, 0x19, 0x30, 0x09, 
-    0x38, 0x38, 0x18, 0x01, 0x15, 0x03, 0x30, 0x1E, 0x38, 0x51, 0x05, 0x01, 
-    0x01, 0x18, 0x09, 0x10, 0x23, 0x0C, 0x05, 0x01, 0x01, 0x1A, 0x37, 0x16, 
-    0x11, 0x11, 0x09, 0x78, 0x76, 0x75, 0x60, 0x85, 0x19, 0x10, 0x08, 0x3E, 
-    0xA1, 0x73, 0x28, 0x87, 0x30, 0x30, 0x1F, 0x48, 0xB5, 0xA2, 0x2B, 0x88, 
-    0x09, 0x11, 0x07, 0x3E, 0x19, 0xA3, 0x49, 0x8F, 0x0C, 0x12, 0x19, 0x3E, 
-    0x09, 0x34, 0x54, 0x8F, 0x14, 0x30, 0x1F, 0x3A, 0x37, 0x1A, 0x1F, 0x80, 
-    0x16, 0x21, 0x21, 0x23, 0x02, 0xA6, 0x3A, 0x5E, 0x19, 0x1F, 0x21, 0x0B, 
-    0x22, 0x4E, 0x92, 0x5E, 0x95, 0x7D, 0x33, 0x0A, 0x98, 0x93, 0x77, 0x76, 
-    0x38, 0x7D, 0x38, 0x33, 0x95, 0x98, 0x86, 0x67, 0x89, 0x96, 0x7D, 0x51, 
-    0x94, 0x41, 0x87, 0x84, 0x88, 0x96, 0x7D, 0x94, 0x37, 0x7D, 0x87, 0x84, 
-    0x88, 0xB2, 0x4F, 0x94, 0x38, 0x41, 0x87, 0x84, 0x85, 0xB4, 0x1F, 0x95, 
-    0x95, 0x94, 0x87, 0x84, 0x8E, 0x85, 0x89, 0x94, 0x7D, 0x41, 0x87, 0x84, 
-    0x5D, 0x8E, 0x85, 0x89, 0x93, 0x0D, 0x87, 0x84, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x64, 
-    0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x64, 0x66, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x66, 0x64, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x64, 
-    0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x75, 0x66, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x63, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x63, 0x5E, 
-    0x77, 0x63, 0x5F, 0x5D, 0x5B, 0x62, 0x62, 0x5B, 0x72, 0x5F, 0x5D, 0x62, 
-    0x5D, 0x5F, 0x62, 0x62, 0x5F, 0x5F, 0x5D, 0x62, 0x5D, 0x63, 0x5B, 0x62, 
-    0x5F, 0x5F, 0x5F, 0x5B, 0x5D, 0x63, 0x5E, 0x62, 0x5F, 0x5F, 0x5F, 0x5F, 
-    0x5F, 0x65, 0x62, 0x62, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x65, 0x62, 0x62, 
-    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x65, 0x62, 0x62, 0x5F, 0x5D, 0x5F, 0x5B, 
-    0x5D, 0x65, 0x62, 0x62, 0x62, 0x5E, 0x60, 0x2A, 0x42, 0x2A, 0x71, 0x62, 
-    0x62, 0x5E, 0x62, 0x2A, 0x2A, 0x55, 0x5B, 0x2A, 0x62, 0x5E, 0x82, 0x81, 
-    0x48, 0x55, 0x5B, 0x7E, 0x62, 0x5B, 0x74, 0x49, 0x48, 0x55, 0x71, 0x42, 
-    0x62, 0x28, 0x49, 0x49, 0x48, 0x55, 0x62, 0x3E, 0x62, 0x5B, 0x74, 0x49, 
-    0x49, 0x49, 0x2A, 0x29, 0x62, 0x62, 0x5C, 0x49, 0x48, 0x5A, 0x4A, 0x2E, 
-    0x62, 0x5B, 0x74, 0x49, 0x28, 0x49, 0x48, 0x2D, 0x44, 0x3E, 0x2E, 0x50, 
-    0x5C, 0x58, 0x57, 0x2F, 0x3E, 0x39, 0x30, 0x96, 0x5C, 0x58, 0x57, 0x30, 
-    0x36, 0x36, 0x30, 0x96, 0x5C, 0x58, 0x57, 0x30, 0x29, 0x39, 0x30, 0x96, 
-    0x5C, 0x58, 0x57, 0x21, 0x2E, 0x2F, 0x21, 0x96, 0x5C, 0x58, 0x57, 0x30, 
-    0x2F, 0x1F, 0x1F, 0x96, 0x5C, 0x58, 0x57, 0x21, 0x32, 0x1F, 0x30, 0x96, 
-    0x5C, 0x58, 0x57, 0x2E, 0x32, 0x21, 0x30, 0x96, 0x5C, 0x58, 0x57, 0x27, 
-    0x2E, 0x2F, 0x2F, 0x39, 0x36, 0x1F, 0x07, 0x0C, 0x32, 0x36, 0x39, 0x32, 
-    0x2F, 0x21, 0x07, 0x12, 0x29, 0x3A, 0x3A, 0x2F, 0x2F, 0x21, 0x09, 0x1F, 
-    0x36, 0x3E, 0x3A, 0x2F, 0x29, 0x30, 0x08, 0x09, 0x39, 0x27, 0x3A, 0x2E, 
-    0x4B, 0x2F, 0x09, 0x1F, 0x39, 0x27, 0x3A, 0x36, 0x29, 0x2F, 0x1E, 0x16, 
-    0x39, 0x27, 0x3A, 0x39, 0x30, 0x30, 0x21, 0x1E, 0x3A, 0x3A, 0x3A, 0x29, 
-    0x30, 0x21, 0x21, 0x1E, 0x10, 0x10, 0x08, 0x08, 0x10, 0x4A, 0x44, 0x6F, 
-    0x12, 0x10, 0x08, 0x08, 0x12, 0x4A, 0x43, 0x6D, 0x10, 0x08, 0x06, 0x1B, 
-    0x12, 0x2A, 0x44, 0x2C, 0x10, 0x07, 0x13, 0x31, 0x19, 0x2A, 0x44, 0x26, 
-    0x16, 0x07, 0x0C, 0x0F, 0x30, 0x48, 0x43, 0x7E, 0x16, 0x16, 0x22, 0x4D, 
-    0x43, 0x49, 0x49, 0x4C, 0x14, 0x09, 0x24, 0x6F, 0x56, 0x5A, 0x4A, 0x4C, 
-    0x10, 0x14, 0x24, 0x6F, 0x56, 0x53, 0x78, 0x27, 0x48, 0x3E, 0x07, 0x1E, 
-    0x07, 0x16, 0x1B, 0x02, 0x2A, 0x3E, 0x07, 0x1E, 0x07, 0x10, 0x09, 0x15, 
-    0x48, 0x78, 0x11, 0x1E, 0x08, 0x10, 0x09, 0x18, 0x48, 0x2A, 0x10, 0x1F, 
-    0x0C, 0x16, 0x0F, 0x15, 0x48, 0x54, 0x10, 0x1E, 0x0D, 0x11, 0x0F, 0x05, 
-    0x48, 0x78, 0x07, 0x14, 0x08, 0x0C, 0x04, 0x02, 0x49, 0x3E, 0x0C, 0x09, 
-    0x08, 0x03, 0x01, 0x01, 0x2A, 0x2F, 0x09, 0x07, 0x08, 0x04, 0x03, 0x03, 
-    0x0B, 0x1A, 0x23, 0x28, 0x49, 0x3A, 0x39, 0x48, 0x03, 0x1A, 0x25, 0x2B, 
-    0x39, 0x3A, 0x43, 0x2B, 0x03, 0x1A, 0x25, 0x2B, 0x39, 0x3A, 0x53, 0x2B, 
-    0x03, 0x1A, 0x25, 0x2B, 0x39, 0x3A, 0x53, 0x2B, 0x03, 0x1A, 0x4F, 0x2B, 
-    0x39, 0x3A, 0x53, 0x2B, 0x03, 0x1A, 0x25, 0x28, 0x36, 0x3A, 0x53, 0x2B, 
-    0x03, 0x20, 0x19, 0x80, 0x2F, 0x39, 0x56, 0x69, 0x03, 0x20, 0x1B, 0x3A, 
-    0x21, 0x3A, 0x53, 0x2B, 0x3E, 0x1E, 0x1E, 0x36, 0x30, 0x1D, 0x03, 0x09, 
-    0x50, 0x1E, 0x32, 0x2E, 0x09, 0x0A, 0x08, 0x08, 0xB3, 0x1E, 0x2F, 0x16, 
-    0x0A, 0x04, 0x0D, 0x08, 0xB3, 0x1E, 0x30, 0x1B, 0x03, 0x0D, 0x0D, 0x08, 
-    0xB3, 0x12, 0x07, 0x06, 0x08, 0x0D, 0x0D, 0x08, 0x50, 0x1E, 0x0A, 0x04, 
-    0x08, 0x0D, 0x0D, 0x08, 0xA6, 0x1B, 0x0A, 0x13, 0x0D, 0x0D, 0x0D, 0x0C, 
-    0x4F, 0x08, 0x13, 0x0D, 0x0D, 0x0D, 0x08, 0x04, 0x07, 0x04, 0x03, 0x03, 
-    0x13, 0x06, 0x06, 0x04, 0x03, 0x03, 0x03, 0x04, 0x08, 0x08, 0x08, 0x04, 
-    0x03, 0x03, 0x13, 0x06, 0x13, 0x0C, 0x0C, 0x13, 0x04, 0x03, 0x0C, 0x08, 
-    0x13, 0x06, 0x06, 0x04, 0x0A, 0x03, 0x13, 0x01, 0x02, 0x02, 0x02, 0x01, 
-    0x03, 0x03, 0x04, 0x02, 0x04, 0x09, 0x09, 0x1B, 0x04, 0x01, 0x01, 0x03, 
-    0x08, 0x16, 0x12, 0x12, 0x03, 0x01, 0x01, 0x06, 0x09, 0x11, 0x16, 0x1E, 
-    0x02, 0x01, 0x1B, 0x14, 0x0D, 0x04, 0x03, 0x01, 0x02, 0x03, 0x12, 0x09, 
-    0x06, 0x04, 0x03, 0x01, 0x05, 0x03, 0x12, 0x09, 0x0C, 0x08, 0x04, 0x01, 
-    0x01, 0x03, 0x12, 0x09, 0x08, 0x08, 0x04, 0x01, 0x15, 0x01, 0x10, 0x09, 
-    0x08, 0x08, 0x04, 0x01, 0x09, 0x12, 0x11, 0x0D, 0x0D, 0x08, 0x04, 0x01, 
-    0x10, 0x12, 0x0D, 0x0D, 0x0D, 0x04, 0x03, 0x01, 0x07, 0x08, 0x0D, 0x0D, 
-    0x0D, 0x04, 0x01, 0x01, 0x23, 0x3E, 0xB4, 0x2A, 0x2A, 0x2F, 0x2E, 0x2C, 
-    0x10, 0x3A, 0x49, 0x2E, 0x36, 0x3A, 0x32, 0x57, 0x1E, 0x3A, 0x49, 0x29, 
-    0x39, 0x2C, 0x30, 0x2E, 0x1E, 0x3A, 0x49, 0x2D, 0x3A, 0x3A, 0x2F, 0x30, 
-    0x30, 0x3A, 0x49, 0x2D, 0x39, 0x2C, 0x2F, 0x2F, 0x36, 0x3A, 0x49, 0x29, 
-    0x2F, 0x10, 0x30, 0x2F, 0x2F, 0x3A, 0x49, 0x2C, 0x30, 0x09, 0x2F, 0x2F, 
-    0x2F, 0x2C, 0x48, 0x39, 0x30, 0x09, 0x2E, 0x32, 0x82, 0xA2, 0x70, 0x47, 
-    0x3A, 0x78, 0x48, 0x49, 0x5C, 0xAD, 0x70, 0x32, 0x3B, 0x34, 0x39, 0x39, 
-    0x78, 0x3D, 0x07, 0x19, 0x04, 0x0A, 0x36, 0x39, 0x7A, 0x09, 0x07, 0x0A, 
-    0x04, 0x04, 0x39, 0x29, 0x31, 0x09, 0x07, 0x01, 0x04, 0x04, 0x36, 0x2C, 
-    0x31, 0x09, 0x07, 0x01, 0x04, 0x0A, 0x39, 0x29, 0x31, 0x09, 0x07, 0x01, 
-    0x04, 0x04, 0x39, 0x2D, 0x31, 0x11, 0x0D, 0x01, 0x04, 0x0A, 0x36, 0x39, 
-    0x49, 0x43, 0x74, 0x54, 0x3D, 0x40, 0x04, 0x08, 0x50, 0x4B, 0x61, 0x82, 
-    0xA2, 0x40, 0x13, 0x08, 0x2E, 0x27, 0x61, 0x82, 0xA2, 0x40, 0x1C, 0x08, 
-    0x1E, 0x36, 0x61, 0x82, 0xA2, 0x40, 0x04, 0x0C, 0x21, 0x39, 0x61, 0x82, 
-    0xA2, 0x40, 0x0C, 0x09, 0x1F, 0x27, 0x61, 0x82, 0xA2, 0x40, 0x08, 0x16, 
-    0x12, 0x3A, 0x61, 0x82, 0xA2, 0x40, 0x08, 0x16, 0x2F, 0x3A, 0x4A, 0x82, 
-    0xA2, 0x40, 0x08, 0x16, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x09, 0x12, 0x1F, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x09, 0x12, 0x1F, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x08, 0x07, 0x10, 0x1F, 0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x1E, 0x10, 0x1F, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x1F, 0x16, 0x1F, 0x07, 0x0D, 0x0D, 0x08, 
-    0x07, 0x1F, 0x1F, 0x1F, 0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x1F, 0x1E, 0x21, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x07, 0x10, 0x12, 0x2E, 0x21, 0x16, 0x08, 0x11, 
-    0x12, 0x30, 0x29, 0x30, 0x21, 0x16, 0x09, 0x14, 0x11, 0x1F, 0x32, 0x1E, 
-    0x21, 0x16, 0x07, 0x14, 0x14, 0x21, 0x2F, 0x1E, 0x1F, 0x16, 0x07, 0x14, 
-    0x14, 0x1F, 0x32, 0x1E, 0x21, 0x16, 0x07, 0x19, 0x16, 0x1E, 0x2F, 0x1E, 
-    0x1F, 0x16, 0x07, 0x14, 0x19, 0x1F, 0x2F, 0x1E, 0x1F, 0x14, 0x07, 0x14, 
-    0x11, 0x30, 0x2E, 0x1E, 0x2E, 0x16, 0x07, 0x14, 0x11, 0x30, 0x2E, 0x1E, 
-    0x9A, 0x5B, 0x74, 0x42, 0x2F, 0x2E, 0x2F, 0x2E, 0x9A, 0x5E, 0x71, 0x81, 
-    0x21, 0x2E, 0x2F, 0x2E, 0x3A, 0x55, 0x62, 0x69, 0xB3, 0x2E, 0x2F, 0x2E, 
-    0x3A, 0x4A, 0x53, 0x2B, 0xB3, 0x2E, 0x2F, 0x2E, 0x39, 0x4A, 0x53, 0x74, 
-    0x42, 0x29, 0x2F, 0x2E, 0x2E, 0x3E, 0x44, 0x53, 0x43, 0x29, 0x2F, 0x36, 
-    0x2E, 0x4B, 0x3E, 0x5A, 0x56, 0x26, 0x2D, 0x39, 0x2D, 0x3A, 0x27, 0x49, 
-    0x43, 0x43, 0x47, 0x50, 0x4B, 0x27, 0x53, 0x71, 0x43, 0x5A, 0x5E, 0x5B, 
-    0x4B, 0x27, 0x53, 0x28, 0x48, 0x49, 0x53, 0x5E, 0x4B, 0x3E, 0x59, 0x68, 
-    0x74, 0x53, 0x56, 0x5E, 0x4B, 0x3A, 0x49, 0x43, 0x62, 0x56, 0x53, 0x5E, 
-    0x4B, 0x27, 0x4A, 0x42, 0x2B, 0x56, 0x55, 0x5E, 0x36, 0x39, 0x2A, 0x47, 
-    0x2B, 0x56, 0x5A, 0x5E, 0x29, 0x36, 0x2A, 0x47, 0x2B, 0x62, 0x55, 0x62, 
-    0x39, 0x36, 0x4A, 0x47, 0x2B, 0x56, 0x7F, 0x62, 0x5D, 0x5F, 0x5F, 0x5F, 
-    0x5F, 0x79, 0x5D, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x63, 0x79, 0x5F, 
-    0x5F, 0x5F, 0x5F, 0x5D, 0x79, 0x64, 0x72, 0x5D, 0x65, 0x5F, 0x5F, 0x5D, 
-    0x79, 0x75, 0x79, 0x5D, 0x63, 0x5F, 0x5F, 0x5D, 0x79, 0x76, 0x79, 0x5D, 
-    0x63, 0x5F, 0x5F, 0x5D, 0x5F, 0x77, 0x72, 0x5D, 0x65, 0x5F, 0x5D, 0x5F, 
-    0x5F, 0x5F, 0x5F, 0x5D, 0x65, 0x5F, 0x5D, 0x5F, 0x5F, 0x5D, 0x5F, 0x5D, 
-    0xA1, 0xBA, 0xA7, 0xB9, 0xA8, 0x9F, 0x05, 0x01, 0x84, 0x9E, 0xA7, 0xB9, 
-    0xA8, 0x9F, 0x05, 0x01, 0x79, 0xA0, 0xB1, 0xA8, 0xA8, 0x9F, 0x05, 0x01, 
-    0x5F, 0x9B, 0xBA, 0xB9, 0xA8, 0x9F, 0x05, 0x01, 0x67, 0xA1, 0xA9, 0x40, 
-    0xAF, 0x20, 0x15, 0x05, 0x67, 0x9E, 0x40, 0xB0, 0xB9, 0x9F, 0x05, 0x05, 
-    0x5F, 0xA1, 0x40, 0xA8, 0xA8, 0xAF, 0x01, 0x01, 0x5F, 0xA1, 0x24, 0xA8, 
-    0xA8, 0xAF, 0x01, 0x01, 0x01, 0xAF, 0xA8, 0xA8, 0xA7, 0xA1, 0x5D, 0x85, 
-    0x01, 0x02, 0xB0, 0xB9, 0xBA, 0xA0, 0x5B, 0x85, 0x01, 0x02, 0xA8, 0xB9, 
-    0x9E, 0x63, 0x62, 0x85, 0x01, 0x01, 0xB0, 0xBA, 0xA0, 0x73, 0x5B, 0x85, 
-    0x15, 0xAF, 0xA6, 0xA9, 0x9E, 0x67, 0x5B, 0x85, 0x9F, 0xB0, 0xB0, 0xA6, 
-    0xB7, 0x9B, 0x5F, 0x85, 0xAF, 0xA8, 0xB0, 0xA6, 0x9E, 0x75, 0x79, 0x85, 
-    0xAF, 0xB9, 0xB0, 0xA6, 0xBA, 0x9B, 0x77, 0x43, 0x88, 0x88, 0x95, 0x7D, 
-    0x7D, 0x7D, 0x1D, 0x7C, 0x98, 0x89, 0x93, 0x98, 0x7D, 0x7D, 0x03, 0x0F, 
-    0x98, 0x88, 0x90, 0x92, 0x96, 0x94, 0x0A, 0x35, 0x93, 0x88, 0x90, 0x92, 
-    0x98, 0x95, 0x1D, 0x7C, 0x90, 0x90, 0x90, 0x89, 0x98, 0x95, 0x1D, 0x7C, 
-    0x90, 0x90, 0x92, 0x95, 0x7D, 0x7D, 0x1D, 0x7C, 0x90, 0x90, 0x88, 0x94, 
-    0x95, 0x7D, 0x01, 0x7C, 0x90, 0x90, 0x88, 0x9D, 0x7D, 0x7D, 0x1D, 0x7C, 
-    0x95, 0x37, 0x22, 0x01, 0x01, 0x1A, 0x37, 0x16, 0x41, 0x7D, 0x35, 0x18, 
-    0x0B, 0x18, 0x0F, 0x21, 0x41, 0x7D, 0x4F, 0x14, 0x1A, 0x22, 0x09, 0x30, 
-    0x95, 0x7D, 0x7D, 0x41, 0x09, 0x22, 0x30, 0xAB, 0x95, 0x7D, 0x94, 0x45, 
-    0x4F, 0x22, 0x1E, 0x34, 0x95, 0x7D, 0x7D, 0x7D, 0x4C, 0x4D, 0x1A, 0x05, 
-    0x95, 0x7D, 0x7D, 0xAA, 0x39, 0x3E, 0x40, 0x0B, 0x95, 0x7D, 0x7D, 0xAA, 
-    0x29, 0x49, 0x3F, 0x7A, 0x09, 0x1F, 0x0A, 0xAF, 0x02, 0x01, 0x93, 0x55, 
-    0x30, 0x09, 0x20, 0xAF, 0x15, 0x03, 0x96, 0x96, 0x1E, 0x22, 0x05, 0x02, 
-    0x22, 0x51, 0x7D, 0x7D, 0xB1, 0x01, 0xAF, 0x15, 0x35, 0x7D, 0x7D, 0x7D, 
-    0x20, 0x01, 0x1A, 0x02, 0x12, 0x7D, 0x7D, 0x7D, 0x0B, 0x1A, 0x34, 0x16, 
-    0x41, 0x7D, 0x7D, 0x94, 0x1A, 0x1C, 0x1E, 0x21, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x25, 0x30, 0x1F, 0x25, 0x7D, 0x7D, 0x7D, 0x7D, 0x65, 0x43, 0x85, 0x90, 
-    0x99, 0x45, 0x87, 0x84, 0x49, 0x5D, 0x81, 0x85, 0x90, 0x92, 0xB6, 0x8C, 
-    0x99, 0x65, 0x28, 0x85, 0x90, 0x90, 0x8D, 0x8C, 0xB3, 0x81, 0x5F, 0x62, 
-    0x85, 0x90, 0x96, 0xA5, 0x94, 0x87, 0x64, 0x5E, 0x85, 0x90, 0x4C, 0x9D, 
-    0x96, 0x92, 0x63, 0x77, 0x74, 0x86, 0x21, 0x96, 0x41, 0x8D, 0x67, 0x66, 
-    0x73, 0x86, 0x23, 0x04, 0x41, 0xB6, 0x67, 0x66, 0x64, 0x5B, 0x8F, 0x89, 
-    0x66, 0x76, 0x76, 0x76, 0x76, 0x73, 0x65, 0x5F, 0x66, 0x76, 0x76, 0x76, 
-    0x63, 0x63, 0x63, 0x5D, 0x66, 0x76, 0x76, 0x63, 0x5E, 0x63, 0x63, 0x5E, 
-    0x77, 0x76, 0x73, 0x5E, 0x5D, 0x65, 0x65, 0x5E, 0x2B, 0x6A, 0x63, 0x5D, 
-    0x5F, 0x5D, 0x5D, 0x5F, 0xA2, 0x77, 0x73, 0x5D, 0x5F, 0x5F, 0x5F, 0x5F, 
-    0x13, 0x36, 0x5B, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x94, 0x93, 0x6B, 0x62, 
-    0x5F, 0x5D, 0x5F, 0x5D, 0x5F, 0x5B, 0x5F, 0x5B, 0x5D, 0x63, 0x5B, 0x59, 
-    0x72, 0x65, 0x5D, 0x72, 0x5F, 0x5E, 0x5E, 0x5F, 0x63, 0x63, 0x5B, 0x65, 
-    0x63, 0x59, 0x72, 0x72, 0x65, 0x5F, 0x5E, 0x65, 0x72, 0x62, 0x72, 0x72, 
-    0x5D, 0x5F, 0x5D, 0x65, 0x73, 0x62, 0x72, 0x72, 0x5F, 0x5F, 0x5D, 0x72, 
-    0x63, 0x62, 0x72, 0x72, 0x5F, 0x5F, 0x5E, 0x77, 0x77, 0x62, 0x72, 0x72, 
-    0x5D, 0x5F, 0x5E, 0x77, 0x73, 0x62, 0x72, 0x72, 0x62, 0x5B, 0x7F, 0x28, 
-    0x5E, 0x49, 0x42, 0x2E, 0x59, 0x5B, 0x7F, 0x28, 0x5E, 0x2A, 0x3A, 0x2F, 
-    0x56, 0x5B, 0x7F, 0x28, 0x5E, 0x27, 0x29, 0x2F, 0x56, 0x5B, 0x62, 0x59, 
-    0x5E, 0x27, 0x2E, 0x50, 0x53, 0x5E, 0x5D, 0x62, 0x5E, 0x27, 0x2D, 0xB3, 
-    0x68, 0x5F, 0x79, 0x43, 0x74, 0x4A, 0x2E, 0xB3, 0x53, 0x5B, 0x5D, 0x48, 
-    0x48, 0x48, 0x29, 0xB3, 0x53, 0x59, 0x5B, 0x49, 0x49, 0x48, 0x2D, 0xB3, 
-    0x21, 0xB3, 0x2C, 0x2E, 0x2A, 0x2C, 0x2D, 0x27, 0x2C, 0x3A, 0x5A, 0x27, 
-    0x36, 0x1E, 0x2D, 0x27, 0x2A, 0x49, 0x43, 0x47, 0x3A, 0x21, 0x2D, 0x27, 
-    0x2A, 0x54, 0x49, 0x42, 0x4B, 0x30, 0x29, 0x3A, 0x69, 0x60, 0x97, 0x3A, 
-    0x3A, 0x30, 0x29, 0x3A, 0x69, 0x2B, 0x97, 0x27, 0x3A, 0x30, 0x29, 0x3A, 
-    0x69, 0x2B, 0x97, 0x27, 0x3A, 0x21, 0x2D, 0x3A, 0x69, 0x2B, 0x97, 0x27, 
-    0x3A, 0x21, 0x2D, 0x3A, 0x3A, 0x27, 0x36, 0x2F, 0x30, 0x29, 0x2D, 0x0C, 
-    0x3A, 0x27, 0x29, 0x30, 0x30, 0x29, 0x29, 0x1F, 0x3A, 0x3A, 0x3A, 0x39, 
-    0x21, 0x29, 0x29, 0x1E, 0x3A, 0x3A, 0x3A, 0x29, 0x30, 0x29, 0x2E, 0x46, 
-    0x3A, 0x3A, 0x3A, 0x29, 0x2F, 0x2E, 0x1F, 0x07, 0x3A, 0x3A, 0x3A, 0x2D, 
-    0x2F, 0x2F, 0x10, 0x07, 0x3A, 0x3A, 0x3A, 0x2E, 0x30, 0x30, 0x10, 0x0C, 
-    0x3A, 0x3A, 0x2E, 0x30, 0x32, 0x1F, 0x10, 0x0C, 0x10, 0x21, 0x7A, 0x6F, 
-    0x56, 0x3E, 0x29, 0x42, 0x19, 0x14, 0x24, 0x6F, 0x56, 0x2C, 0x2E, 0x3A, 
-    0x16, 0x14, 0x22, 0x6F, 0x56, 0x4A, 0x39, 0x29, 0x19, 0x2C, 0x7E, 0x26, 
-    0x53, 0x2A, 0x32, 0x1E, 0x16, 0x2C, 0x2A, 0x39, 0x43, 0x2A, 0x2F, 0x16, 
-    0x16, 0x29, 0x78, 0x36, 0x43, 0x2A, 0x2F, 0x2F, 0x19, 0x29, 0x48, 0x47, 
-    0x53, 0x27, 0x2E, 0x39, 0x19, 0x29, 0x48, 0x48, 0x56, 0x49, 0x2D, 0x29, 
-    0x27, 0x1E, 0x11, 0x07, 0x04, 0x04, 0x24, 0x24, 0x4C, 0x12, 0x09, 0x08, 
-    0x1C, 0x24, 0x32, 0x54, 0x25, 0x10, 0x07, 0x06, 0x24, 0x7B, 0x43, 0x49, 
-    0x2F, 0x1F, 0x07, 0x06, 0xA6, 0x78, 0x5A, 0x39, 0x32, 0x1F, 0x07, 0x1A, 
-    0x32, 0x43, 0x42, 0x36, 0x2E, 0x12, 0x07, 0x24, 0x6F, 0x43, 0x29, 0x2E, 
-    0x30, 0x10, 0x09, 0x24, 0x6F, 0x43, 0x2F, 0x12, 0x21, 0x10, 0x08, 0x1F, 
-    0x48, 0x43, 0x3A, 0x19, 0xA6, 0x24, 0x19, 0x3A, 0x4F, 0x3A, 0x53, 0x28, 
-    0x78, 0x29, 0x08, 0x2E, 0x25, 0x3A, 0x53, 0x5C, 0x3A, 0x2C, 0x10, 0x2D, 
-    0x4F, 0x3A, 0x43, 0x43, 0x50, 0x30, 0x21, 0x39, 0x1E, 0x36, 0x48, 0x43, 
-    0x2E, 0x30, 0x1F, 0x30, 0x21, 0x4B, 0x2A, 0x43, 0x1E, 0x1E, 0x1E, 0x31, 
-    0x32, 0x3A, 0x3E, 0x43, 0x07, 0x12, 0x1F, 0x6E, 0x3F, 0x57, 0x2E, 0x43, 
-    0x11, 0x10, 0x1E, 0x0D, 0x32, 0x30, 0x11, 0x2F, 0x3A, 0x10, 0x08, 0x07, 
-    0x0D, 0x0D, 0x13, 0x04, 0x3E, 0x1E, 0x31, 0x07, 0x0D, 0x0D, 0x03, 0x05, 
-    0x3A, 0x10, 0x08, 0x0D, 0x0D, 0x0D, 0x0A, 0x0F, 0x3A, 0x19, 0x08, 0x08, 
-    0x04, 0x08, 0x4F, 0x41, 0x3A, 0x09, 0x0C, 0x1C, 0x04, 0x30, 0x2E, 0x10, 
-    0x3A, 0x09, 0x08, 0x0E, 0x09, 0x29, 0xB3, 0x1F, 0x39, 0x0F, 0x08, 0x0E, 
-    0x37, 0x29, 0x32, 0x1F, 0x07, 0x13, 0x0F, 0x22, 0x4F, 0x48, 0x3A, 0x12, 
-    0x04, 0x03, 0x15, 0x13, 0x0D, 0x09, 0x14, 0x10, 0x1A, 0x1A, 0x09, 0x19, 
-    0x08, 0x08, 0x08, 0x08, 0x1E, 0x1F, 0x12, 0x16, 0x07, 0x0D, 0x0D, 0x0D, 
-    0x2C, 0x39, 0x19, 0x13, 0x0D, 0x0D, 0x0D, 0x0D, 0x16, 0x10, 0x07, 0x04, 
-    0x08, 0x0D, 0x0D, 0x0D, 0x1F, 0x1E, 0x07, 0x03, 0x08, 0x0D, 0x0D, 0x0D, 
-    0x21, 0x10, 0x13, 0x13, 0x08, 0x08, 0x13, 0x08, 0x12, 0x09, 0x04, 0x0A, 
-    0x08, 0x08, 0x0A, 0x06, 0x07, 0x09, 0x08, 0x08, 0x06, 0x04, 0x01, 0x01, 
-    0x0D, 0x08, 0x06, 0x13, 0x13, 0x01, 0x03, 0x01, 0x0D, 0x08, 0x06, 0x04, 
-    0x03, 0x01, 0x04, 0x0E, 0x0D, 0x08, 0x04, 0x03, 0x05, 0x0F, 0x07, 0x02, 
-    0x0D, 0x04, 0x0B, 0x0B, 0x02, 0x0F, 0x11, 0x06, 0x0D, 0x13, 0x01, 0x01, 
-    0x05, 0x06, 0x11, 0x08, 0x04, 0x0B, 0x01, 0x01, 0x05, 0x0F, 0x07, 0x0E, 
-    0x03, 0x02, 0x01, 0x01, 0x05, 0x0F, 0x11, 0x13, 0x30, 0x2D, 0x36, 0x2F, 
-    0x32, 0x16, 0x2D, 0x2F, 0x2F, 0x32, 0x2E, 0x2E, 0x2F, 0x09, 0x21, 0x21, 
-    0x36, 0x36, 0x32, 0x1F, 0x1F, 0x07, 0x08, 0x11, 0x3A, 0x3A, 0x1E, 0x16, 
-    0x12, 0x07, 0x08, 0x11, 0x29, 0x3A, 0x2C, 0x1F, 0x14, 0x08, 0x31, 0x12, 
-    0x2D, 0x3A, 0x4A, 0x29, 0x1E, 0x08, 0x19, 0x1E, 0x16, 0x2F, 0x39, 0x48, 
-    0x3A, 0x1A, 0x1F, 0x12, 0x0D, 0x12, 0x21, 0x4A, 0x47, 0x45, 0x30, 0x1E, 
-    0x6E, 0x16, 0x09, 0x01, 0x04, 0x03, 0x36, 0x48, 0x31, 0x10, 0x16, 0x01, 
-    0x04, 0x04, 0x36, 0x48, 0x0C, 0x16, 0x16, 0x01, 0x04, 0x04, 0x2D, 0x48, 
-    0x08, 0x10, 0x16, 0x01, 0x04, 0x04, 0x36, 0x48, 0x12, 0x16, 0x19, 0x0E, 
-    0x04, 0x04, 0x2C, 0x48, 0x10, 0x07, 0x07, 0x01, 0x13, 0x08, 0x29, 0x4A, 
-    0x08, 0x16, 0x07, 0x0E, 0x04, 0x0D, 0x29, 0x47, 0x08, 0x16, 0x09, 0x01, 
-    0x04, 0x0D, 0x29, 0x47, 0x27, 0x39, 0x42, 0x62, 0xAD, 0x40, 0x08, 0x16, 
-    0x2A, 0x3E, 0x4A, 0x71, 0xAE, 0x40, 0x08, 0x16, 0x43, 0x49, 0x89, 0x59, 
-    0xAE, 0x40, 0x0C, 0x0D, 0x43, 0x49, 0x29, 0x59, 0xAE, 0x40, 0x1C, 0x04, 
-    0x43, 0x49, 0x29, 0x59, 0xAE, 0x40, 0x17, 0x04, 0x43, 0x49, 0x29, 0x59, 
-    0xAE, 0x40, 0x17, 0x04, 0x43, 0x49, 0x29, 0x5C, 0xAE, 0x24, 0x17, 0x04, 
-    0x43, 0x49, 0x29, 0x53, 0x6F, 0x83, 0x0B, 0x04, 0x0D, 0x0D, 0x0D, 0x08, 
-    0x07, 0x16, 0x1F, 0x36, 0x07, 0x0D, 0x0D, 0x08, 0x07, 0x16, 0x1F, 0x36, 
-    0x08, 0x0D, 0x0D, 0x08, 0x07, 0x12, 0x21, 0x36, 0x08, 0x0D, 0x0D, 0x08, 
-    0x09, 0x12, 0x21, 0x36, 0x08, 0x0D, 0x0D, 0x08, 0x14, 0x12, 0x21, 0x36, 
-    0x08, 0x0D, 0x0D, 0x0D, 0x14, 0x12, 0x21, 0x36, 0x08, 0x0D, 0x09, 0x11, 
-    0x16, 0x21, 0x30, 0x29, 0x08, 0x0D, 0x09, 0x11, 0x14, 0x30, 0x2E, 0x2F, 
-    0x36, 0x12, 0x07, 0x14, 0x14, 0x1F, 0x30, 0x1E, 0x29, 0x12, 0x07, 0x14, 
-    0x14, 0x1F, 0x1F, 0x1E, 0x29, 0x12, 0x07, 0x14, 0x14, 0x1E, 0x1F, 0x1E, 
-    0x29, 0x12, 0x07, 0x14, 0x19, 0x1F, 0x30, 0x12, 0x29, 0x12, 0x07, 0x19, 
-    0x11, 0x1F, 0x30, 0x12, 0x29, 0x10, 0x07, 0x12, 0x16, 0x1E, 0x21, 0x12, 
-    0x29, 0x11, 0x07, 0x12, 0x10, 0x1E, 0x21, 0x12, 0x29, 0x11, 0x07, 0x14, 
-    0x09, 0x12, 0x21, 0x1E, 0x2D, 0x42, 0x3A, 0x3A, 0x4B, 0x49, 0x74, 0x7E, 
-    0x2E, 0x36, 0x36, 0x3A, 0x3A, 0x42, 0x71, 0x60, 0x2E, 0x36, 0x36, 0x29, 
-    0x39, 0x39, 0x48, 0x5C, 0x1F, 0x29, 0x2E, 0x2E, 0x29, 0x36, 0x39, 0x55, 
-    0x1F, 0x29, 0x2E, 0x36, 0x36, 0x29, 0x2C, 0x61, 0x1F, 0x29, 0x2E, 0x2E, 
-    0x36, 0x36, 0x39, 0x81, 0x1E, 0x30, 0x2E, 0x36, 0x36, 0x36, 0x39, 0x42, 
-    0x12, 0x1E, 0x2D, 0x36, 0x36, 0x36, 0x29, 0x9A, 0x2E, 0x36, 0x27, 0x47, 
-    0x2B, 0x56, 0x5C, 0x62, 0x50, 0x29, 0x3E, 0x4A, 0x7F, 0x56, 0x5C, 0x62, 
-    0x5A, 0x29, 0x27, 0x4A, 0x74, 0x56, 0x5C, 0x62, 0x71, 0x2A, 0x27, 0x4A, 
-    0x49, 0x43, 0x5C, 0x62, 0x5B, 0x28, 0x3E, 0x4A, 0x48, 0x49, 0x5C, 0x62, 
-    0x5B, 0x5D, 0x3E, 0x4A, 0x43, 0x59, 0x5C, 0x62, 0x74, 0x62, 0x3E, 0x4A, 
-    0x74, 0x62, 0x53, 0x5C, 0x74, 0x62, 0x27, 0x4A, 0x49, 0x53, 0x53, 0x68, 
-    0x65, 0x5F, 0x5D, 0x5F, 0x5F, 0x5F, 0x5D, 0x72, 0x65, 0x5F, 0x5D, 0x5F, 
-    0x5F, 0x5F, 0x5E, 0x63, 0x65, 0x5F, 0x5D, 0x5F, 0x5F, 0x5F, 0x5D, 0x63, 
-    0x65, 0x5F, 0x5D, 0x5F, 0x5F, 0x5F, 0x5D, 0x63, 0x65, 0x5F, 0x5D, 0x5F, 
-    0x5F, 0x5F, 0x5D, 0x65, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x65, 
-    0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x65, 0x5E, 0x5F, 0x5F, 0x5F, 
-    0x5D, 0x5D, 0x5D, 0x65, 0x77, 0xA1, 0x40, 0xA8, 0xA8, 0xAF, 0x01, 0x01, 
-    0x75, 0xA1, 0xBA, 0xA8, 0x01, 0x05, 0x9F, 0x15, 0x75, 0xA1, 0xBA, 0xA7, 
-    0xA8, 0xB0, 0x01, 0xAF, 0x75, 0xA1, 0xA8, 0xB9, 0xA8, 0x9F, 0x02, 0xAF, 
-    0x77, 0xA1, 0xA8, 0xA7, 0xA8, 0x9F, 0x02, 0xAF, 0x63, 0xA1, 0xBA, 0xA1, 
-    0xA8, 0x9F, 0x01, 0xAF, 0x63, 0xA1, 0xBA, 0xA1, 0xA8, 0x9F, 0x01, 0xAF, 
-    0x63, 0xA1, 0xA7, 0xA1, 0xA7, 0x9F, 0x01, 0xAF, 0xAF, 0xA8, 0xB0, 0x40, 
-    0xBA, 0x9B, 0x66, 0x73, 0xAF, 0x02, 0xA8, 0xA9, 0x9E, 0x9B, 0x66, 0x64, 
-    0xB0, 0xA8, 0xA8, 0xBA, 0x9E, 0x9B, 0x66, 0x76, 0xB0, 0xA8, 0x0A, 0x24, 
-    0xBA, 0x9B, 0x66, 0x76, 0xB0, 0xA8, 0xB9, 0xB7, 0xBA, 0x9B, 0x66, 0x76, 
-    0xB0, 0x22, 0xA1, 0x84, 0x9E, 0x9B, 0x66, 0x76, 0xB0, 0x3C, 0x9E, 0xA0, 
-    0xBA, 0x9B, 0x66, 0x66, 0xB0, 0xA8, 0xA9, 0x9E, 0xA0, 0x64, 0x66, 0x64, 
-    0x85, 0x90, 0x90, 0x89, 0x98, 0x7D, 0x1D, 0x7C, 0x68, 0x88, 0x90, 0x92, 
-    0x7C, 0x95, 0x01, 0x7C, 0x77, 0x8E, 0x85, 0x92, 0x98, 0x95, 0x01, 0x7C, 
-    0x64, 0x8E, 0x85, 0x92, 0x98, 0x95, 0x3B, 0x7C, 0x77, 0x8E, 0x85, 0x92, 
-    0x98, 0x95, 0x35, 0x7C, 0x64, 0x8E, 0x85, 0x92, 0x98, 0x95, 0x98, 0x7C, 
-    0x75, 0x2B, 0x90, 0x89, 0x94, 0x95, 0x98, 0x34, 0x64, 0x77, 0x7F, 0x85, 
-    0x93, 0x7D, 0x98, 0x34, 0x95, 0x7D, 0x7D, 0xAA, 0xB2, 0x71, 0x80, 0x78, 
-    0x95, 0x7D, 0x7D, 0xAA, 0x89, 0x5E, 0x59, 0x56, 0x95, 0x7D, 0x7D, 0xAA, 
-    0x89, 0x5F, 0x5B, 0x68, 0x95, 0x7D, 0x7D, 0xAA, 0x89, 0x5F, 0x5B, 0x68, 
-    0x95, 0x7D, 0x7D, 0x41, 0x97, 0x72, 0x62, 0x68, 0x95, 0x7D, 0x94, 0x96, 
-    0x91, 0x77, 0x77, 0x59, 0x95, 0x7D, 0x94, 0x89, 0x61, 0x64, 0x6A, 0x5B, 
-    0x95, 0x94, 0x41, 0x8F, 0x77, 0x76, 0x66, 0x63, 0x3A, 0x2F, 0x30, 0x4F, 
-    0x4F, 0x4F, 0x41, 0x7D, 0x3E, 0x50, 0x30, 0x1F, 0x21, 0x21, 0x41, 0x7D, 
-    0x43, 0x47, 0x2F, 0x21, 0x30, 0x30, 0x41, 0x7D, 0x56, 0x5A, 0x3A, 0x30, 
-    0x2F, 0x32, 0x4F, 0x7D, 0x49, 0x42, 0x2A, 0x21, 0x10, 0x04, 0x09, 0x7D, 
-    0x43, 0x7F, 0x56, 0x3A, 0x21, 0x25, 0x1F, 0x7D, 0x68, 0x53, 0x56, 0x2A, 
-    0x2F, 0x21, 0x1F, 0x41, 0x62, 0x61, 0x99, 0x4D, 0x21, 0x2D, 0x30, 0x21, 
-    0x95, 0xAA, 0x80, 0x77, 0x66, 0x73, 0x85, 0x92, 0x7D, 0x12, 0x86, 0x5F, 
-    0x66, 0x79, 0x86, 0x6C, 0x7D, 0x52, 0x88, 0x79, 0x66, 0x73, 0x25, 0xA4, 
-    0x7D, 0x52, 0x88, 0x79, 0x66, 0x64, 0xAB, 0xB2, 0x7D, 0x52, 0x88, 0x79, 
-    0x66, 0x64, 0xAB, 0x94, 0x7D, 0x52, 0x85, 0x72, 0x6A, 0x8C, 0x57, 0x21, 
-    0x7D, 0x52, 0x85, 0x65, 0x64, 0x8F, 0x3A, 0x3F, 0x7D, 0x52, 0x88, 0x72, 
-    0x76, 0x77, 0x29, 0x93, 0x34, 0x37, 0x87, 0x61, 0x79, 0x72, 0x5D, 0x79, 
-    0x02, 0x6E, 0x87, 0x80, 0x64, 0x77, 0x5E, 0x72, 0x38, 0x41, 0x87, 0x55, 
-    0x6A, 0x77, 0x5E, 0x72, 0x96, 0x41, 0x87, 0x58, 0x6A, 0x77, 0x5E, 0x72, 
-    0x41, 0x23, 0x8D, 0x54, 0x6A, 0x77, 0x5E, 0x72, 0x31, 0x93, 0x6B, 0x5E, 
-    0x6A, 0x77, 0x5E, 0x72, 0x89, 0x85, 0x5E, 0x76, 0x75, 0x63, 0x5E, 0x72, 
-    0x65, 0x77, 0x75, 0x75, 0x5F, 0x5E, 0x5D, 0x65, 0x72, 0x5F, 0x5D, 0x72, 
-    0x5F, 0x62, 0x72, 0x72, 0x73, 0x5F, 0x5E, 0x65, 0x79, 0x62, 0x72, 0x72, 
-    0x73, 0x5F, 0x5E, 0x65, 0x79, 0x62, 0x65, 0x5F, 0x73, 0x5F, 0x5E, 0x65, 
-    0x79, 0x62, 0x65, 0x79, 0x73, 0x5F, 0x5E, 0x65, 0x79, 0x62, 0x79, 0x5F, 
-    0x73, 0x5F, 0x5E, 0x65, 0x79, 0x62, 0x62, 0x53, 0x63, 0x5D, 0x5E, 0x72, 
-    0x79, 0x62, 0x59, 0x53, 0x79, 0x62, 0x5F, 0x5E, 0x5B, 0x62, 0x62, 0x5C, 
-    0x56, 0x53, 0x43, 0x49, 0x48, 0x2A, 0x29, 0xAA, 0x56, 0x53, 0x56, 0x5A, 
-    0x3A, 0x39, 0x29, 0x69, 0x68, 0x53, 0x53, 0x49, 0x2A, 0x3A, 0x57, 0x65, 
-    0x53, 0x56, 0x5A, 0x47, 0x39, 0x3A, 0x9A, 0x67, 0x53, 0x56, 0x44, 0x27, 
-    0x50, 0x54, 0x71, 0x5A, 0x53, 0x53, 0x43, 0x42, 0x2E, 0x26, 0x62, 0x80, 
-    0x53, 0x56, 0x5A, 0x3E, 0x39, 0x2C, 0x59, 0x55, 0x53, 0x43, 0x5A, 0x3E, 
-    0x36, 0x2C, 0x59, 0x54, 0x69, 0x2B, 0x97, 0x27, 0x3A, 0x21, 0x2D, 0x3A, 
-    0x55, 0x58, 0x4B, 0x27, 0x3A, 0x21, 0x2D, 0x3A, 0x49, 0x4B, 0x3A, 0x3A, 
-    0x3A, 0x1F, 0x2D, 0x3A, 0x48, 0x4B, 0x3A, 0x3A, 0x3A, 0x2F, 0x2D, 0x3A, 
-    0x27, 0x3A, 0x3A, 0x3A, 0x27, 0x39, 0x36, 0x3A, 0x4B, 0x3A, 0x3A, 0x3A, 
-    0x3A, 0x39, 0x36, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x39, 0x39, 0x3A, 
-    0x4B, 0x3A, 0x3A, 0x3A, 0x3A, 0x80, 0x3E, 0x57, 0x3A, 0x3A, 0x21, 0x21, 
-    0x2E, 0x1E, 0x10, 0x6E, 0x3A, 0x3A, 0x30, 0x32, 0x2F, 0x1E, 0x12, 0x46, 
-    0x3A, 0x3A, 0x30, 0x36, 0x30, 0x10, 0x16, 0x6E, 0x3A, 0x3A, 0x30, 0x39, 
-    0x30, 0x12, 0x16, 0x6E, 0x27, 0x39, 0x30, 0x36, 0x1E, 0x12, 0x19, 0x3B, 
-    0x36, 0x2D, 0x30, 0x39, 0x32, 0x32, 0x21, 0x0D, 0x2E, 0x39, 0x3A, 0x5A, 
-    0x43, 0x53, 0x59, 0x2C, 0x2E, 0x2C, 0x2A, 0x42, 0x3A, 0x47, 0x49, 0x39, 
-    0x21, 0x39, 0x3E, 0x43, 0x43, 0x4A, 0x29, 0x36, 0x2E, 0x3A, 0x3A, 0x43, 
-    0x43, 0x39, 0x2E, 0x29, 0x32, 0x3A, 0x4B, 0x43, 0x48, 0x2D, 0x2D, 0x2D, 
-    0x32, 0x3A, 0x2A, 0x48, 0x3F, 0x1F, 0x2E, 0x2F, 0x2F, 0x27, 0x49, 0x42, 
-    0x21, 0x30, 0x29, 0x2F, 0x32, 0x3A, 0x3A, 0x3E, 0x32, 0x1F, 0x2D, 0x21, 
-    0x2F, 0x3A, 0x3A, 0x27, 0x32, 0x12, 0x14, 0x1E, 0x2E, 0x3A, 0x3A, 0x27, 
-    0x32, 0x12, 0x14, 0x1E, 0x1E, 0x11, 0x24, 0x3E, 0x71, 0x71, 0x3E, 0x11, 
-    0x1E, 0x12, 0x24, 0x78, 0x62, 0x80, 0x2C, 0x11, 0x12, 0x1E, 0x24, 0x78, 
-    0x28, 0x50, 0x12, 0x11, 0x19, 0x16, 0x24, 0x78, 0x28, 0x2F, 0x10, 0x11, 
-    0x19, 0x16, 0x24, 0x78, 0x62, 0x29, 0x10, 0x11, 0x11, 0x16, 0x1A, 0x3A, 
-    0x7F, 0x30, 0x16, 0x11, 0x1E, 0x11, 0x0A, 0x4C, 0x36, 0x07, 0x14, 0x11, 
-    0x1E, 0x08, 0x22, 0x4C, 0x3A, 0x07, 0x14, 0x11, 0x11, 0x10, 0x1E, 0x12, 
-    0x19, 0x0F, 0x0D, 0x16, 0x11, 0x10, 0x1E, 0x16, 0x11, 0x04, 0x09, 0x12, 
-    0x11, 0x16, 0x12, 0x0F, 0x16, 0x06, 0x07, 0x1E, 0x09, 0x12, 0x1E, 0x0C, 
-    0x07, 0x13, 0x08, 0x19, 0x09, 0x12, 0x1E, 0x04, 0x08, 0x0A, 0x22, 0xA4, 
-    0x14, 0x09, 0x08, 0x17, 0x08, 0x10, 0x29, 0x3A, 0x14, 0x1B, 0x04, 0x08, 
-    0x40, 0x8C, 0x71, 0x61, 0x14, 0x1B, 0x04, 0x0B, 0x7B, 0x2B, 0x48, 0x30, 
-    0x04, 0x06, 0x0F, 0x1A, 0x45, 0x49, 0x3A, 0x19, 0x0C, 0x03, 0x1B, 0x09, 
-    0x4F, 0x48, 0x39, 0x09, 0x0C, 0x0E, 0x09, 0x2F, 0x4C, 0x42, 0x32, 0x16, 
-    0x13, 0x1D, 0x51, 0x42, 0x4A, 0x1F, 0x11, 0x16, 0x0C, 0x6C, 0x3A, 0x47, 
-    0x29, 0x07, 0x09, 0x19, 0x2F, 0x78, 0x43, 0x39, 0x11, 0x14, 0x19, 0x14, 
-    0xB3, 0x80, 0x43, 0x30, 0x0D, 0x19, 0x11, 0x11, 0x1B, 0x3E, 0x29, 0x12, 
-    0x07, 0x09, 0x09, 0x06, 0x09, 0x08, 0x04, 0x08, 0x07, 0x08, 0x13, 0x04, 
-    0x0D, 0x04, 0x01, 0x10, 0x11, 0x08, 0x0C, 0x01, 0x14, 0x0D, 0x01, 0x16, 
-    0x09, 0x08, 0x08, 0x02, 0x16, 0x1B, 0x01, 0x16, 0x09, 0x13, 0x06, 0x02, 
-    0x07, 0x04, 0x01, 0x16, 0x1B, 0x03, 0x04, 0x05, 0x07, 0x04, 0x02, 0x16, 
-    0x37, 0x01, 0x13, 0x05, 0x06, 0x03, 0x06, 0x09, 0x1C, 0x03, 0x13, 0x15, 
-    0x0E, 0x06, 0x11, 0x13, 0x03, 0x03, 0x04, 0x02, 0x03, 0x02, 0x01, 0x01, 
-    0x05, 0x0F, 0x07, 0x0A, 0x0B, 0x01, 0x02, 0x01, 0x05, 0x08, 0x1B, 0x01, 
-    0x0B, 0x04, 0x01, 0x01, 0x04, 0x08, 0x08, 0x0E, 0x04, 0x0C, 0x01, 0x01, 
-    0x08, 0x04, 0x0A, 0x03, 0x09, 0x16, 0x02, 0x03, 0x08, 0x13, 0x04, 0x03, 
-    0x09, 0x10, 0x01, 0x03, 0x08, 0x04, 0x03, 0x01, 0x09, 0x10, 0x05, 0x04, 
-    0x13, 0x0B, 0x03, 0x01, 0x09, 0x19, 0x05, 0x03, 0x04, 0x0A, 0x03, 0x01, 
-    0x10, 0x16, 0x12, 0x3F, 0x47, 0x2A, 0x2E, 0x12, 0x12, 0x12, 0x07, 0x7A, 
-    0x26, 0x49, 0x29, 0x1F, 0x16, 0x30, 0x16, 0x31, 0x4C, 0x3A, 0x32, 0x2F, 
-    0x16, 0x1F, 0x16, 0x08, 0x51, 0x11, 0x11, 0x09, 0x14, 0x1F, 0x12, 0x08, 
-    0x2F, 0x42, 0x51, 0x6E, 0x07, 0x10, 0x21, 0x52, 0xAD, 0x5C, 0x41, 0x31, 
-    0x07, 0x07, 0x1F, 0x52, 0xAD, 0x5C, 0x25, 0x0C, 0x0D, 0x08, 0x1E, 0x52, 
-    0xAD, 0x5C, 0x25, 0x07, 0x08, 0x14, 0x11, 0x01, 0x04, 0x08, 0x29, 0x47, 
-    0x16, 0x14, 0x19, 0x01, 0x08, 0x12, 0x2F, 0x27, 0x1F, 0x16, 0x19, 0x05, 
-    0x09, 0x21, 0x19, 0x6F, 0x16, 0x16, 0x0D, 0x02, 0x09, 0x21, 0x16, 0x21, 
-    0x1E, 0x12, 0x06, 0x02, 0x1B, 0x32, 0x10, 0x94, 0x1E, 0x12, 0x04, 0x02, 
-    0x08, 0x1F, 0x19, 0x23, 0x10, 0x10, 0x04, 0x01, 0x0A, 0x12, 0x16, 0x25, 
-    0x12, 0x10, 0x0A, 0x01, 0x04, 0x16, 0x16, 0x23, 0x43, 0x49, 0x29, 0x53, 
-    0x6F, 0x7A, 0x0B, 0x04, 0x53, 0x49, 0x29, 0x53, 0x6F, 0xA4, 0x17, 0x04, 
-    0x56, 0x49, 0x29, 0x56, 0xAE, 0x40, 0x0B, 0x02, 0x43, 0x49, 0x57, 0x59, 
-    0xAE, 0x24, 0x08, 0x0F, 0x5A, 0x49, 0x29, 0x53, 0x7E, 0x39, 0x3E, 0x39, 
-    0x42, 0x4A, 0x2C, 0x53, 0x6D, 0x39, 0x2A, 0x4A, 0x27, 0x42, 0x29, 0x49, 
-    0x3F, 0x10, 0x30, 0x21, 0x3E, 0x2D, 0x12, 0x2D, 0x1E, 0x31, 0x08, 0x08, 
-    0x08, 0x08, 0x07, 0x19, 0x14, 0x30, 0x2E, 0x2E, 0x0D, 0x0D, 0x07, 0x14, 
-    0x11, 0x1F, 0x2F, 0x2E, 0x04, 0x0C, 0x07, 0x14, 0x19, 0x1E, 0x30, 0x2E, 
-    0x0F, 0x07, 0x09, 0x19, 0x14, 0x1E, 0x30, 0x2E, 0x3A, 0x2C, 0x51, 0x14, 
-    0x14, 0x30, 0x2F, 0x2F, 0x4A, 0x42, 0x29, 0xB3, 0xA3, 0x41, 0x2F, 0x1F, 
-    0x21, 0x30, 0x7E, 0x58, 0x58, 0x58, 0x50, 0x1F, 0x08, 0x52, 0x54, 0x5C, 
-    0x5B, 0x82, 0x4A, 0x41, 0x29, 0x16, 0x09, 0x14, 0x11, 0x1E, 0x21, 0x12, 
-    0x2D, 0x16, 0x11, 0x14, 0x11, 0x1E, 0x21, 0x12, 0x2F, 0x10, 0x11, 0x14, 
-    0x11, 0x1E, 0x21, 0x12, 0x2F, 0x16, 0x11, 0x14, 0x09, 0x1E, 0x21, 0x12, 
-    0x32, 0x10, 0x11, 0x14, 0x11, 0x1E, 0x21, 0x10, 0x32, 0x1F, 0x12, 0x14, 
-    0x16, 0x12, 0x12, 0x16, 0x2F, 0x21, 0x1E, 0x11, 0x16, 0x1E, 0x16, 0x16, 
-    0x2F, 0x21, 0x1E, 0x11, 0x14, 0x1F, 0x10, 0x14, 0x1E, 0x1F, 0x32, 0x36, 
-    0x36, 0x36, 0x2E, 0x9A, 0x1E, 0x1F, 0x32, 0x36, 0x36, 0x36, 0x2E, 0x39, 
-    0x12, 0x1F, 0x2E, 0x36, 0x29, 0x36, 0x2D, 0x36, 0x1E, 0x52, 0x21, 0x2E, 
-    0x2E, 0x36, 0x36, 0x36, 0xB3, 0x58, 0x7E, 0xB3, 0x2F, 0x29, 0x2E, 0x2E, 
-    0xB3, 0x2B, 0x54, 0xB3, 0x2F, 0x2D, 0x3A, 0x29, 0xB3, 0x55, 0x78, 0x50, 
-    0x2E, 0x2F, 0x39, 0x29, 0xB3, 0x55, 0x78, 0xB3, 0x2F, 0x2E, 0x32, 0x2F, 
-    0x74, 0x62, 0x4A, 0x4A, 0x43, 0x56, 0x53, 0x68, 0x74, 0x62, 0x42, 0x47, 
-    0x48, 0x53, 0x56, 0x68, 0x47, 0x62, 0x74, 0x54, 0x48, 0x56, 0x5A, 0x43, 
-    0x3A, 0x80, 0x62, 0x69, 0x7F, 0x5E, 0x44, 0x5C, 0x39, 0x39, 0x5C, 0x74, 
-    0x2A, 0x59, 0x62, 0x5C, 0x36, 0x27, 0x5C, 0x69, 0x9A, 0x2A, 0x5A, 0x59, 
-    0x36, 0x27, 0x5C, 0x2B, 0x27, 0x42, 0x54, 0x74, 0x29, 0x3A, 0x49, 0x7F, 
-    0x48, 0x3A, 0x4A, 0x2A, 0x5E, 0x5F, 0x5F, 0x5D, 0x65, 0x72, 0x5E, 0x65, 
-    0x5E, 0x5F, 0x5F, 0x5D, 0x63, 0x63, 0x5E, 0x65, 0x5E, 0x5F, 0x5F, 0x5D, 
-    0x63, 0x63, 0x5E, 0x63, 0x5D, 0x5F, 0x5F, 0x5D, 0x63, 0x65, 0x5E, 0x79, 
-    0x5E, 0x5F, 0x5F, 0x5D, 0x63, 0x65, 0x5D, 0x5D, 0x5E, 0x5F, 0x5F, 0x5D, 
-    0x63, 0x65, 0x5D, 0x5F, 0x5E, 0x5F, 0x5F, 0x5D, 0x63, 0x65, 0x5D, 0x5F, 
-    0x62, 0x5E, 0x5F, 0x5D, 0x63, 0x63, 0x5D, 0x5F, 0x73, 0xA0, 0x9E, 0xB9, 
-    0x02, 0x9F, 0x15, 0x9F, 0x73, 0x63, 0x9E, 0x9E, 0xA8, 0x9F, 0x15, 0x02, 
-    0x73, 0x63, 0xBA, 0xA1, 0xA7, 0xA6, 0x02, 0xAF, 0x73, 0x63, 0xBA, 0xA1, 
-    0xA7, 0x9F, 0x01, 0xAF, 0x79, 0x63, 0xBA, 0xA1, 0xA7, 0x9F, 0x01, 0xAF, 
-    0x63, 0x63, 0xBA, 0xA1, 0xA7, 0x9F, 0x01, 0xAF, 0x63, 0x63, 0xBA, 0xA1, 
-    0xA7, 0x9F, 0x01, 0xAF, 0x63, 0x63, 0xBA, 0xA1, 0xA7, 0x9F, 0x01, 0xAF, 
-    0x01, 0x01, 0xA7, 0xB7, 0x9B, 0x66, 0x77, 0x65, 0x0E, 0xA6, 0x9E, 0xA1, 
-    0x9B, 0x66, 0x63, 0x63, 0xB0, 0xA8, 0xBA, 0xA0, 0x77, 0x77, 0x63, 0x73, 
-    0xB0, 0x01, 0xBA, 0xA0, 0x63, 0x63, 0x63, 0x63, 0xB0, 0xA8, 0xBA, 0xA0, 
-    0x77, 0x76, 0x73, 0x63, 0xB0, 0xA8, 0xBA, 0xA0, 0x64, 0x64, 0x63, 0x73, 
-    0xB0, 0xA8, 0xBA, 0xA0, 0x77, 0x77, 0x63, 0x73, 0xB0, 0xA8, 0xBA, 0xA0, 
-    0x72, 0x63, 0x73, 0x63, 0x63, 0x63, 0x5B, 0x85, 0x90, 0x96, 0x7C, 0x0B, 
-    0x73, 0x73, 0x5E, 0x85, 0x99, 0x41, 0x09, 0x01, 0x63, 0x73, 0x5E, 0x90, 
-    0x92, 0x35, 0x33, 0x13, 0x63, 0x73, 0x5E, 0x8F, 0x49, 0x97, 0x7D, 0x01, 
-    0x63, 0x73, 0x5E, 0x81, 0x8E, 0x92, 0x1F, 0x06, 0x63, 0x63, 0x72, 0x72, 
-    0x8E, 0x91, 0x4F, 0x40, 0x63, 0x63, 0x73, 0x65, 0x61, 0x91, 0xAC, 0xAE, 
-    0x63, 0x73, 0x63, 0x5E, 0x8F, 0x91, 0xAC, 0x74, 0x38, 0x06, 0x7D, 0x8F, 
-    0x75, 0x76, 0x76, 0x76, 0x0A, 0x04, 0x7A, 0x99, 0x64, 0x76, 0x76, 0x76, 
-    0x07, 0x41, 0x52, 0x89, 0x64, 0x66, 0x76, 0x76, 0x04, 0x51, 0x9D, 0x99, 
-    0x64, 0x66, 0x76, 0x76, 0x1B, 0x09, 0x9D, 0x99, 0x75, 0x66, 0x76, 0x76, 
-    0x40, 0x0A, 0x9D, 0x99, 0x77, 0x76, 0x76, 0x77, 0xA2, 0x1E, 0xAA, 0x6B, 
-    0x5B, 0x73, 0x66, 0x77, 0x82, 0x3E, 0x9C, 0x6B, 0x5D, 0x73, 0x64, 0x65, 
-    0x5F, 0x67, 0x84, 0x3A, 0x2F, 0x1F, 0x1F, 0x1F, 0x73, 0x62, 0x71, 0x56, 
-    0x42, 0x52, 0x1B, 0x19, 0x76, 0x5B, 0x68, 0x56, 0x48, 0x36, 0x1F, 0x3C, 
-    0x76, 0x73, 0x56, 0x56, 0x48, 0x36, 0x1F, 0x07, 0x76, 0x75, 0x5B, 0x68, 
-    0x48, 0x29, 0x1F, 0x14, 0x73, 0x76, 0x5D, 0x56, 0x54, 0x70, 0x0F, 0x16, 
-    0x5F, 0x66, 0x75, 0x79, 0x5C, 0x47, 0x29, 0x1F, 0x79, 0x76, 0x66, 0x72, 
-    0x68, 0x56, 0x3A, 0x1F, 0x7D, 0x52, 0x88, 0x79, 0x66, 0x66, 0x77, 0x77, 
-    0x52, 0x23, 0x88, 0x79, 0x76, 0x76, 0x66, 0x66, 0x0A, 0x13, 0xAA, 0x79, 
-    0x66, 0x76, 0x76, 0x76, 0x23, 0x41, 0x92, 0x79, 0x66, 0x76, 0x66, 0x6A, 
-    0x1F, 0x1F, 0x85, 0x79, 0x76, 0x66, 0x63, 0x26, 0x4F, 0x1E, 0x88, 0x79, 
-    0x66, 0x77, 0xA1, 0x8D, 0x1F, 0x1F, 0x85, 0x79, 0x66, 0x8C, 0xB6, 0xB2, 
-    0x1F, 0x1F, 0x85, 0x5F, 0x63, 0x45, 0x12, 0x93, 0x76, 0x66, 0x66, 0x75, 
-    0x79, 0x5F, 0x5D, 0x72, 0x76, 0x76, 0x76, 0x65, 0x5D, 0x5F, 0x5D, 0x65, 
-    0x76, 0x76, 0x75, 0x5E, 0x5F, 0x5D, 0x79, 0x63, 0x75, 0x66, 0x75, 0x5E, 
-    0x5F, 0x5D, 0x79, 0x72, 0x28, 0x6A, 0x75, 0x5E, 0x5F, 0x5D, 0x79, 0x65, 
-    0x28, 0x6A, 0x75, 0x5E, 0x5F, 0x5D, 0x79, 0x65, 0x28, 0x6A, 0x75, 0x5E, 
-    0x5F, 0x5D, 0x79, 0x65, 0x68, 0x75, 0x75, 0x5E, 0x5F, 0x5D, 0x79, 0x65, 
-    0x72, 0x62, 0x5B, 0x62, 0x62, 0x62, 0x62, 0x5C, 0x72, 0x5E, 0x5E, 0x5B, 
-    0x62, 0x62, 0x62, 0x5C, 0x5F, 0x62, 0x62, 0x62, 0x62, 0x62, 0x59, 0x61, 
-    0x5D, 0x5B, 0x62, 0x62, 0x62, 0x62, 0x62, 0x28, 0x5B, 0x62, 0x62, 0x62, 
-    0x62, 0x62, 0x62, 0x59, 0x62, 0x5E, 0x5F, 0x5E, 0x62, 0x5B, 0x28, 0x2A, 
-    0x62, 0x5D, 0x5D, 0x62, 0x62, 0x62, 0x59, 0x44, 0x5E, 0x5F, 0x5D, 0x5E, 
-    0x5B, 0x62, 0x59, 0x5B, 0x53, 0x49, 0x42, 0x42, 0x3A, 0x42, 0x59, 0x78, 
-    0x44, 0x2A, 0x29, 0x42, 0x55, 0x5B, 0x47, 0x3A, 0x49, 0x2A, 0x2E, 0x42, 
-    0x74, 0x5E, 0x81, 0x27, 0x5A, 0x2A, 0x2E, 0x42, 0x55, 0x62, 0x81, 0x27, 
-    0x48, 0x47, 0x2D, 0x2A, 0x55, 0x59, 0x48, 0x3A, 0x2A, 0x42, 0x2E, 0x4A, 
-    0x7F, 0x62, 0x28, 0x42, 0x81, 0x9A, 0x3A, 0x5B, 0x5C, 0x55, 0x3E, 0x3A, 
-    0x5E, 0x60, 0x5E, 0x5B, 0x49, 0x48, 0x3E, 0x3A, 0x4B, 0x3A, 0x3A, 0x3A, 
-    0x3E, 0x5C, 0x26, 0x2F, 0x3A, 0x3A, 0x3A, 0x4B, 0x55, 0x80, 0xB3, 0x36, 
-    0x3A, 0x3A, 0x3A, 0x3A, 0x5A, 0x48, 0xB3, 0x27, 0x3A, 0x3A, 0x3A, 0x29, 
-    0x2A, 0x48, 0x30, 0x3A, 0x3A, 0x3A, 0x3A, 0x50, 0x3E, 0x2A, 0x30, 0x3A, 
-    0x3A, 0x3A, 0x3A, 0x2F, 0x42, 0x2A, 0x30, 0x3A, 0x3A, 0x3A, 0x3A, 0x2F, 
-    0x3A, 0x47, 0x30, 0x3A, 0x3A, 0x3A, 0x3A, 0x2D, 0x29, 0x3E, 0x30, 0x3E, 
-    0x2E, 0x36, 0x48, 0x47, 0x36, 0x39, 0x4A, 0x36, 0x4A, 0x49, 0x2C, 0x27, 
-    0x39, 0x36, 0x36, 0x2F, 0x48, 0x43, 0x39, 0x29, 0x36, 0x36, 0x36, 0x2F, 
-    0x48, 0x49, 0x39, 0x29, 0x36, 0x36, 0x2F, 0xA5, 0x49, 0x43, 0x39, 0x29, 
-    0x36, 0x29, 0x36, 0x7F, 0x48, 0x49, 0x39, 0x36, 0x36, 0x3A, 0x74, 0x71, 
-    0x48, 0x2A, 0x36, 0x36, 0x57, 0x43, 0x59, 0x43, 0x42, 0x36, 0x36, 0x36, 
-    0x57, 0x49, 0x43, 0x48, 0x2D, 0x3A, 0x3A, 0x3A, 0x32, 0x12, 0x16, 0x1F, 
-    0x32, 0x3A, 0x4B, 0x36, 0x30, 0x12, 0x10, 0x30, 0x2F, 0x27, 0x3A, 0x36, 
-    0x30, 0x1E, 0x32, 0x1F, 0x80, 0x48, 0x42, 0x36, 0x30, 0x1E, 0x32, 0x1E, 
-    0x7F, 0x49, 0x3E, 0x2F, 0x30, 0x21, 0x2F, 0x09, 0x48, 0x27, 0x3E, 0x52, 
-    0x12, 0x21, 0x30, 0x19, 0x49, 0x3E, 0x3A, 0x6C, 0x21, 0x30, 0x10, 0x02, 
-    0x48, 0x39, 0x2E, 0x16, 0x1F, 0x30, 0x31, 0x45, 0x1E, 0x08, 0x22, 0x4C, 
-    0x39, 0x07, 0x14, 0x11, 0x1E, 0x0C, 0x22, 0x4C, 0x3A, 0x07, 0x14, 0x14, 
-    0x12, 0x0C, 0x1A, 0x4C, 0x39, 0x08, 0x11, 0x10, 0x11, 0x0F, 0x19, 0x36, 
-    0x3A, 0x1E, 0x16, 0x08, 0x31, 0x06, 0x2E, 0x3A, 0x3A, 0x39, 0x19, 0x1D, 
-    0x13, 0x94, 0x29, 0x2E, 0x1F, 0x16, 0x08, 0x06, 0x21, 0x55, 0x57, 0x1B, 
-    0x0C, 0x2E, 0x1E, 0x14, 0x69, 0xA5, 0xB3, 0x1B, 0x03, 0x2F, 0x21, 0x12, 
-    0x14, 0x1B, 0x0A, 0xA3, 0x55, 0x59, 0x4A, 0x23, 0x11, 0x08, 0x0A, 0x35, 
-    0x49, 0x43, 0x48, 0x1F, 0x08, 0x13, 0x0A, 0x35, 0x49, 0x43, 0x49, 0x1F, 
-    0x06, 0x06, 0x0A, 0x35, 0x49, 0x43, 0x49, 0x1F, 0x06, 0x06, 0x0A, 0x35, 
-    0x49, 0x43, 0x48, 0x1F, 0x04, 0x03, 0x31, 0x35, 0x49, 0x43, 0x49, 0x2F, 
-    0x16, 0x08, 0x11, 0x35, 0x49, 0x56, 0x43, 0x45, 0x10, 0x08, 0x1E, 0x7C, 
-    0x49, 0x43, 0x49, 0x1F, 0x02, 0x2C, 0x36, 0x1F, 0x0C, 0x07, 0x13, 0x06, 
-    0x1A, 0x3A, 0x3E, 0x1F, 0x0A, 0x07, 0x08, 0x06, 0x1A, 0x2C, 0x27, 0x21, 
-    0x02, 0x19, 0x1E, 0x0C, 0x22, 0x2C, 0x4B, 0x1E, 0x01, 0x19, 0x1F, 0x0C, 
-    0x22, 0x2C, 0x29, 0x16, 0x04, 0x09, 0x1F, 0x04, 0x24, 0x39, 0x36, 0x21, 
-    0x19, 0x31, 0x16, 0x07, 0x1A, 0x3F, 0x2F, 0x1E, 0x19, 0x02, 0x06, 0x16, 
-    0x3C, 0x19, 0x11, 0x16, 0x09, 0x01, 0x08, 0x06, 0x01, 0x06, 0x09, 0x0A, 
-    0x03, 0x0B, 0x01, 0x03, 0x01, 0x06, 0x09, 0x03, 0x03, 0x0B, 0x01, 0x04, 
-    0x01, 0x06, 0x07, 0x03, 0x03, 0x0B, 0x01, 0x04, 0x01, 0x0A, 0x08, 0x04, 
-    0x0B, 0x0B, 0x02, 0x04, 0x03, 0x03, 0x08, 0x0B, 0x03, 0x03, 0x01, 0x01, 
-    0x06, 0x03, 0x04, 0x0B, 0x03, 0x04, 0x03, 0x05, 0x13, 0x01, 0x04, 0x0B, 
-    0x03, 0x03, 0x01, 0x02, 0x01, 0x04, 0x06, 0x0B, 0x03, 0x03, 0x01, 0x01, 
-    0x07, 0x06, 0x01, 0x03, 0x04, 0x03, 0x03, 0x01, 0x03, 0x01, 0x03, 0x03, 
-    0x03, 0x03, 0x01, 0x02, 0x03, 0x03, 0x03, 0x0B, 0x03, 0x04, 0x01, 0x02, 
-    0x03, 0x0B, 0x0B, 0x04, 0x03, 0x01, 0x01, 0x02, 0x04, 0x13, 0x04, 0x03, 
-    0x03, 0x02, 0x02, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x04, 
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x04, 0x0C, 0x0E, 0x09, 0xA4, 0xAE, 0x5C, 0x2F, 0xB3, 
-    0x08, 0x0B, 0x08, 0x3C, 0x7B, 0x48, 0x2E, 0x2F, 0x08, 0x04, 0x1C, 0x6E, 
-    0x25, 0x27, 0x32, 0x30, 0x0D, 0x0C, 0x17, 0x02, 0x25, 0x2A, 0x45, 0x10, 
-    0x0D, 0x06, 0x03, 0x0A, 0x09, 0x39, 0x47, 0x2F, 0x08, 0x06, 0x01, 0x04, 
-    0x1B, 0x25, 0x29, 0x2C, 0x18, 0x01, 0x04, 0x13, 0x0C, 0x22, 0xB3, 0xA5, 
-    0x1E, 0x09, 0x01, 0x03, 0x1C, 0x01, 0x4C, 0x78, 0x41, 0x16, 0x0F, 0x04, 
-    0x0A, 0x10, 0x16, 0x1E, 0x23, 0x16, 0x11, 0x08, 0x01, 0x07, 0x11, 0x16, 
-    0x11, 0x0D, 0x03, 0x01, 0x03, 0x08, 0x11, 0x12, 0x2D, 0x37, 0x01, 0x01, 
-    0x03, 0x08, 0x31, 0x21, 0x70, 0x08, 0x0A, 0x03, 0x0A, 0x06, 0x31, 0x1F, 
-    0xAE, 0x38, 0x01, 0x03, 0x03, 0x0B, 0x03, 0x09, 0x5E, 0x4D, 0x24, 0x1C, 
-    0x01, 0x03, 0x02, 0x08, 0x82, 0xAE, 0x24, 0x1C, 0x01, 0x04, 0x04, 0x03, 
-    0x3A, 0x1F, 0x16, 0x21, 0x10, 0x10, 0x12, 0x10, 0x1E, 0x11, 0x10, 0x32, 
-    0xA3, 0x24, 0x24, 0x83, 0x3F, 0x6F, 0x29, 0x29, 0xA5, 0xA5, 0xA5, 0x6D, 
-    0x2A, 0x49, 0x5A, 0x9A, 0x59, 0x82, 0x5B, 0x5B, 0x29, 0x42, 0x43, 0x3A, 
-    0x33, 0x29, 0x4A, 0x74, 0x1F, 0x3A, 0x47, 0x2D, 0x1F, 0x1F, 0x3E, 0x48, 
-    0x1F, 0x3F, 0x2C, 0x39, 0x30, 0x04, 0x1F, 0x3A, 0x0C, 0x16, 0x39, 0x2A, 
-    0x32, 0x3B, 0x34, 0x4C, 0x16, 0x16, 0x30, 0x4B, 0x49, 0x59, 0x43, 0x2A, 
-    0x07, 0x07, 0x08, 0x32, 0x49, 0x49, 0x44, 0x5E, 0x38, 0x0C, 0x14, 0x2E, 
-    0x49, 0x5A, 0x68, 0x5E, 0x6F, 0x70, 0xA4, 0x30, 0x2A, 0x49, 0x43, 0x5E, 
-    0x62, 0x42, 0x3D, 0x21, 0x29, 0x47, 0x49, 0x5E, 0x2A, 0x55, 0x82, 0xA5, 
-    0x6C, 0x2C, 0x81, 0x5E, 0x48, 0x48, 0x62, 0xA5, 0x41, 0x3A, 0x81, 0x5E, 
-    0x4A, 0x4A, 0x43, 0x2A, 0x42, 0x47, 0x47, 0x5E, 0x29, 0x1F, 0x1E, 0x19, 
-    0x14, 0x1F, 0x1E, 0x16, 0x78, 0x94, 0x1F, 0x11, 0x14, 0x1F, 0x21, 0x1E, 
-    0x54, 0x94, 0x1F, 0x0D, 0x14, 0x1F, 0x21, 0x1E, 0x54, 0xAA, 0x1F, 0x07, 
-    0x16, 0x1E, 0x1E, 0x12, 0x54, 0x94, 0x1F, 0x0D, 0x16, 0x12, 0x12, 0x12, 
-    0x7E, 0x6C, 0x1F, 0x07, 0x16, 0x1E, 0x12, 0x12, 0x54, 0xA4, 0x12, 0x0D, 
-    0x16, 0x12, 0x12, 0x12, 0x78, 0x6C, 0x12, 0x07, 0x10, 0x1E, 0x1E, 0x1E, 
-    0xB3, 0x80, 0x48, 0x48, 0x78, 0x50, 0x3F, 0x2F, 0x30, 0x27, 0x2A, 0x7F, 
-    0x74, 0x2C, 0x50, 0x2F, 0x1F, 0x2F, 0x27, 0x3E, 0x55, 0x54, 0x3A, 0x2F, 
-    0x1E, 0x1E, 0x3E, 0x2A, 0x4B, 0x48, 0x43, 0xB3, 0x1E, 0x1F, 0x47, 0x48, 
-    0x3A, 0x48, 0x5A, 0x26, 0x1E, 0x1F, 0x3E, 0x43, 0x4A, 0x3A, 0x43, 0x55, 
-    0x12, 0x21, 0x39, 0x47, 0x3A, 0x3E, 0x47, 0x27, 0x12, 0x1F, 0x2E, 0x3A, 
-    0x3A, 0x47, 0x43, 0x48, 0x2D, 0x3A, 0x3A, 0x49, 0x56, 0x3E, 0x3A, 0x47, 
-    0x2D, 0x3A, 0x3A, 0x47, 0x5C, 0x78, 0x36, 0x47, 0x2D, 0x39, 0x4A, 0x2A, 
-    0x3E, 0x49, 0x48, 0x3A, 0x29, 0x36, 0x48, 0x2A, 0x39, 0x49, 0x43, 0x36, 
-    0x2D, 0x36, 0x4B, 0x3A, 0x39, 0x47, 0x43, 0x29, 0x36, 0x29, 0x27, 0x42, 
-    0x29, 0x47, 0x49, 0x27, 0x36, 0x36, 0x48, 0x47, 0x39, 0x4B, 0x42, 0x44, 
-    0x39, 0x29, 0x3A, 0x49, 0x47, 0x36, 0x29, 0x48, 0x49, 0x62, 0x5F, 0x5F, 
-    0x5F, 0x5F, 0x5F, 0x5D, 0x49, 0x68, 0x5D, 0x73, 0x5F, 0x5E, 0x5F, 0x5D, 
-    0x3A, 0x61, 0x5E, 0x73, 0x65, 0x79, 0x5D, 0x5D, 0x39, 0x2A, 0x62, 0x63, 
-    0x73, 0x63, 0x5D, 0x5F, 0x3A, 0x2A, 0x44, 0x59, 0x63, 0x65, 0x5D, 0x5F, 
-    0x39, 0x2A, 0x44, 0x5C, 0x63, 0x63, 0x5D, 0x5F, 0x42, 0x2A, 0x44, 0x59, 
-    0x63, 0x63, 0x5D, 0x5F, 0x59, 0x3E, 0x48, 0x61, 0x65, 0x63, 0x5D, 0x5D, 
-    0x63, 0x63, 0xBA, 0xA1, 0xA7, 0x9F, 0x01, 0xAF, 0x5F, 0x63, 0xBA, 0xA1, 
-    0xA7, 0x9F, 0x01, 0xAF, 0x5F, 0x63, 0xBA, 0xA1, 0xA7, 0x9F, 0x01, 0xAF, 
-    0x5F, 0xA0, 0x9E, 0xA1, 0xA7, 0x02, 0x1D, 0x01, 0x67, 0xA1, 0x9E, 0xA1, 
-    0xA7, 0xB9, 0x02, 0xA6, 0x67, 0xA0, 0xA1, 0xA1, 0xA7, 0xB9, 0xA7, 0xA7, 
-    0x67, 0xA1, 0xA7, 0x9E, 0xA1, 0xA1, 0x9E, 0x9E, 0x5F, 0x84, 0xBA, 0xA9, 
-    0xA9, 0xA9, 0xB0, 0xB0, 0xB0, 0xA8, 0xBA, 0xA0, 0x63, 0x73, 0x63, 0x63, 
-    0xB0, 0xA8, 0xBA, 0xA0, 0x73, 0x63, 0x77, 0x63, 0xB0, 0xA8, 0xBA, 0xA0, 
-    0x63, 0x77, 0x76, 0x63, 0xB0, 0xA8, 0xBA, 0xA0, 0x63, 0x75, 0x76, 0x63, 
-    0x01, 0x3B, 0xBA, 0xA0, 0x63, 0x75, 0x76, 0x63, 0xA7, 0xA7, 0x9E, 0xA0, 
-    0x65, 0x75, 0x76, 0x63, 0x9E, 0x9E, 0xA7, 0xBA, 0xA0, 0x75, 0x76, 0x63, 
-    0xA8, 0xBA, 0x9E, 0x9E, 0x9B, 0x66, 0x76, 0x63, 0x73, 0x79, 0x63, 0x5F, 
-    0x8F, 0x96, 0x4C, 0x2A, 0x73, 0x72, 0x63, 0x5E, 0x8F, 0x94, 0x92, 0x92, 
-    0x63, 0x73, 0x73, 0x79, 0x99, 0x38, 0x88, 0x92, 0x63, 0x63, 0x73, 0x79, 
-    0x4D, 0x4E, 0x90, 0x88, 0x73, 0x63, 0x73, 0x79, 0x89, 0x24, 0x92, 0x88, 
-    0x63, 0x63, 0x63, 0x79, 0x99, 0x24, 0x4C, 0x88, 0x77, 0x77, 0x64, 0x79, 
-    0x81, 0x37, 0x1A, 0x96, 0x75, 0x76, 0x79, 0x44, 0x90, 0x45, 0x09, 0x40, 
-    0x9A, 0x2C, 0x96, 0x6B, 0x5E, 0x5F, 0x5F, 0x5E, 0xAC, 0x4F, 0x96, 0x8E, 
-    0x5E, 0x79, 0x5D, 0x5F, 0x7D, 0x30, 0x41, 0x6B, 0x72, 0x72, 0x5D, 0x5F, 
-    0x95, 0x21, 0x09, 0x4D, 0x5D, 0x79, 0x72, 0x5D, 0x95, 0x30, 0x1C, 0xB2, 
-    0x5E, 0x79, 0x72, 0x65, 0x96, 0x23, 0xA3, 0x6D, 0x65, 0x79, 0x5E, 0x65, 
-    0x7D, 0x22, 0xA3, 0x69, 0x63, 0x73, 0x72, 0x5B, 0x02, 0x18, 0x35, 0x4A, 
-    0x5E, 0x5F, 0x5F, 0x8E, 0x79, 0x76, 0x76, 0x73, 0x81, 0x44, 0x6F, 0x07, 
-    0x5F, 0x65, 0x65, 0x65, 0xAD, 0x2A, 0x29, 0x1A, 0x5F, 0x5E, 0x79, 0x84, 
-    0xB7, 0x7D, 0x34, 0x1A, 0x5F, 0x5F, 0x5F, 0x58, 0x9C, 0x40, 0x1A, 0x9F, 
-    0x79, 0x5B, 0x8F, 0x85, 0x88, 0xB5, 0x37, 0x15, 0x5E, 0x8F, 0x85, 0x90, 
-    0x85, 0x8F, 0x45, 0x35, 0x8F, 0x85, 0x90, 0x90, 0x92, 0xB2, 0x95, 0x7D, 
-    0x85, 0x90, 0x90, 0x90, 0x93, 0x38, 0x7D, 0x7D, 0x09, 0x38, 0x93, 0x2A, 
-    0x2C, 0x9C, 0x12, 0x93, 0x15, 0x20, 0x1A, 0xAC, 0x7D, 0x41, 0xAA, 0x58, 
-    0xAF, 0x20, 0x04, 0x7D, 0x95, 0x94, 0x86, 0x5B, 0x40, 0x03, 0x51, 0x7D, 
-    0x7D, 0x25, 0x85, 0x28, 0x22, 0x38, 0x95, 0x95, 0x41, 0x9C, 0x54, 0x5F, 
-    0x02, 0x51, 0x95, 0xA6, 0x3D, 0x2A, 0x65, 0x77, 0x1D, 0x37, 0x41, 0x93, 
-    0x69, 0x5F, 0x63, 0x63, 0x98, 0x08, 0x1F, 0x65, 0x72, 0x5D, 0x63, 0x63, 
-    0x68, 0x75, 0x76, 0x5E, 0x5F, 0x5D, 0x79, 0x65, 0x5F, 0x75, 0x64, 0x5E, 
-    0x5F, 0x5D, 0x79, 0x65, 0x73, 0x75, 0x63, 0x5D, 0x5F, 0x5D, 0x79, 0x65, 
-    0x63, 0x73, 0x63, 0x5D, 0x5F, 0x5D, 0x79, 0x65, 0x77, 0x73, 0x63, 0x5D, 
-    0x5F, 0x5D, 0x79, 0x65, 0x75, 0x77, 0x72, 0x5D, 0x5F, 0x5D, 0x79, 0x65, 
-    0x5F, 0x79, 0x5D, 0x5F, 0x5F, 0x5D, 0x79, 0x65, 0x5E, 0x65, 0x63, 0x5D, 
-    0x5F, 0x5D, 0x5F, 0x5E, 0x5D, 0x5D, 0x5B, 0x5F, 0x5D, 0x5D, 0x5B, 0x62, 
-    0x5E, 0x5E, 0x5B, 0x5F, 0x5F, 0x73, 0x5F, 0x56, 0x62, 0x5E, 0x5B, 0x5F, 
-    0x5F, 0x72, 0x5E, 0x5E, 0x5B, 0x5E, 0x5B, 0x5F, 0x5B, 0x62, 0x5E, 0x5F, 
-    0x5B, 0x5E, 0x5B, 0x5F, 0x59, 0x68, 0x28, 0x5F, 0x5B, 0x5E, 0x5E, 0x5F, 
-    0x5B, 0x5B, 0x5B, 0x5F, 0x62, 0x5F, 0x79, 0x5E, 0x5B, 0x62, 0x7F, 0x5B, 
-    0x62, 0x79, 0x65, 0x7F, 0x80, 0x42, 0x80, 0x5B, 0x5E, 0x5E, 0x5F, 0x74, 
-    0x48, 0x27, 0x3A, 0x3A, 0x5A, 0x55, 0x5F, 0x62, 0x74, 0x4B, 0x3A, 0x3A, 
-    0x5B, 0x43, 0x5D, 0x58, 0x3E, 0x3A, 0x3A, 0x3A, 0x5C, 0x7F, 0x5B, 0x78, 
-    0x39, 0x3A, 0x3A, 0x3A, 0x43, 0x48, 0x47, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 
-    0x5C, 0x48, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x54, 0x3E, 0x3A, 0x3A, 
-    0x3A, 0x3A, 0x3A, 0x3A, 0x3E, 0x4B, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 
-    0x3A, 0x3A, 0x3A, 0x2D, 0x29, 0x47, 0x30, 0x3E, 0x3A, 0x27, 0x36, 0x2E, 
-    0x3E, 0x47, 0x30, 0x42, 0x3A, 0x3A, 0x32, 0x39, 0x2A, 0x42, 0x30, 0x47, 
-    0x3A, 0x39, 0x30, 0x36, 0x2A, 0x42, 0x30, 0x2A, 0x27, 0x3A, 0x30, 0x36, 
-    0x2A, 0x42, 0x2F, 0x2A, 0x39, 0x36, 0x21, 0x39, 0x2A, 0x42, 0x30, 0x48, 
-    0x29, 0x36, 0x32, 0x2E, 0x47, 0x42, 0x30, 0x48, 0x29, 0x3A, 0x32, 0x29, 
-    0x2A, 0x42, 0xB3, 0x48, 0x27, 0x29, 0x29, 0x80, 0x74, 0x74, 0x43, 0x48, 
-    0x42, 0x2D, 0x3A, 0x7F, 0x5C, 0x49, 0x48, 0x81, 0x2A, 0x29, 0x48, 0x5C, 
-    0x7F, 0x48, 0x7F, 0x5E, 0x47, 0x97, 0x43, 0x7F, 0x54, 0x49, 0x43, 0x69, 
-    0x5A, 0x55, 0x2A, 0x47, 0x36, 0x48, 0x49, 0x97, 0x5C, 0x60, 0x80, 0x48, 
-    0x2A, 0x49, 0x49, 0x4D, 0x43, 0x81, 0x2A, 0x48, 0x5A, 0x49, 0x26, 0xA4, 
-    0x43, 0x49, 0x32, 0x3A, 0x4A, 0x2E, 0x94, 0x11, 0x48, 0x36, 0x30, 0x12, 
-    0x11, 0x10, 0x3C, 0x2C, 0x9A, 0x2F, 0x21, 0x12, 0x12, 0x1E, 0x46, 0x4C, 
-    0x6F, 0x94, 0x21, 0x14, 0x1F, 0x1E, 0x3B, 0x4C, 0x3D, 0x52, 0x1E, 0x16, 
-    0x1F, 0x1E, 0x3B, 0x4C, 0x52, 0x12, 0x10, 0x16, 0x1F, 0x1E, 0x02, 0x4C, 
-    0x16, 0x10, 0x10, 0x16, 0x1F, 0x12, 0x22, 0x4C, 0x14, 0x11, 0x11, 0x10, 
-    0x12, 0x14, 0x22, 0x45, 0x14, 0x11, 0x16, 0x1E, 0x1E, 0x16, 0x22, 0x45, 
-    0x7F, 0x50, 0x30, 0x10, 0x13, 0x10, 0x1E, 0x12, 0x43, 0x36, 0x39, 0x32, 
-    0x04, 0x11, 0x12, 0x11, 0x43, 0x29, 0x50, 0x1E, 0x13, 0x14, 0x16, 0x0D, 
-    0x43, 0x2D, 0x1E, 0x09, 0x0A, 0x11, 0x16, 0x08, 0x43, 0x2D, 0x1F, 0x12, 
-    0x05, 0x13, 0x04, 0x0B, 0x43, 0x29, 0x1F, 0x16, 0x05, 0x01, 0x01, 0x01, 
-    0x43, 0x29, 0x08, 0x0A, 0x01, 0x02, 0x02, 0x01, 0x48, 0x1E, 0x08, 0x0B, 
-    0x01, 0x01, 0x03, 0x01, 0x10, 0x08, 0x10, 0x35, 0x49, 0x43, 0x2A, 0x1E, 
-    0x07, 0x1B, 0x08, 0x34, 0x48, 0x53, 0x48, 0x1E, 0x04, 0x04, 0x04, 0x4E, 
-    0x2A, 0x53, 0x47, 0x4F, 0x13, 0x06, 0x04, 0xA3, 0x48, 0x48, 0x2F, 0x25, 
-    0x13, 0x04, 0x0A, 0xA3, 0x48, 0x7E, 0x70, 0x25, 0x01, 0x03, 0x01, 0xA6, 
-    0x48, 0x7E, 0x2F, 0x4A, 0x01, 0x01, 0x01, 0x4E, 0x48, 0x6D, 0x50, 0x3A, 
-    0x02, 0x0B, 0x05, 0xAF, 0x2F, 0x2F, 0x2A, 0x42, 0x01, 0x08, 0x12, 0x12, 
-    0x1B, 0x03, 0x08, 0x02, 0x1D, 0x08, 0x32, 0x1F, 0x31, 0x04, 0x08, 0x03, 
-    0x02, 0x1F, 0x30, 0x1F, 0x10, 0x10, 0x10, 0x0A, 0x1D, 0x21, 0x21, 0x1F, 
-    0x1F, 0x1F, 0x12, 0x03, 0x37, 0x21, 0x21, 0x08, 0x1E, 0x1F, 0x10, 0x0A, 
-    0x29, 0x16, 0x21, 0x36, 0x1F, 0x07, 0x06, 0x04, 0x2E, 0x1E, 0x21, 0x36, 
-    0x1F, 0x6E, 0x17, 0x03, 0x1F, 0x30, 0x2F, 0x2F, 0x1F, 0x04, 0x03, 0x03, 
-    0x04, 0x11, 0x07, 0x01, 0x03, 0x01, 0x02, 0x01, 0x16, 0x16, 0x07, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x06, 0x06, 0x04, 0x03, 0x01, 0x02, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x05, 0x03, 0x0C, 0x03, 0x01, 0x15, 0x02, 0x0C, 
-    0x08, 0x08, 0x0A, 0x22, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x02, 0x03, 
-    0x13, 0x02, 0x01, 0x04, 0x01, 0x05, 0x0F, 0x07, 0x06, 0x01, 0x01, 0x08, 
-    0x01, 0x02, 0x1B, 0x08, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x13, 0x04, 
-    0x01, 0x03, 0x06, 0x06, 0x05, 0x20, 0x01, 0x01, 0x08, 0x08, 0x0D, 0x0C, 
-    0x0A, 0x07, 0x10, 0x09, 0x0A, 0x0D, 0x0D, 0x06, 0x39, 0x32, 0x0A, 0x0B, 
-    0x17, 0x3C, 0x4C, 0x78, 0x36, 0x29, 0x30, 0x17, 0x03, 0x22, 0x4C, 0x78, 
-    0x36, 0x36, 0x36, 0x19, 0x02, 0x1A, 0xB3, 0x78, 0x30, 0x36, 0x36, 0x1F, 
-    0x03, 0x22, 0xB3, 0x78, 0x1F, 0x29, 0x23, 0x06, 0x17, 0xBB, 0x41, 0x7E, 
-    0xBC, 0x1F, 0x08, 0x06, 0x03, 0x01, 0x6C, 0xBD, 0x06, 0x04, 0xBE, 0x09, 
-    0xBB, 0x1D, 0x52, 0xBD, 0x16, 0x30, 0xBC, 0x21, 0xBF, 0x04, 0x50, 0xBD, 
-    0x82, 0xAE, 0x40, 0x17, 0x02, 0x01, 0x03, 0x04, 0x82, 0xAE, 0x24, 0x07, 
-    0x0E, 0x02, 0x06, 0x08, 0x82, 0xAE, 0x24, 0x07, 0x03, 0x02, 0x0A, 0x08, 
-    0x82, 0xAE, 0x24, 0x07, 0x03, 0x05, 0x01, 0x04, 0x5D, 0xAE, 0x24, 0x07, 
-    0x03, 0x01, 0x01, 0x01, 0x71, 0x4D, 0x1A, 0x07, 0x08, 0x04, 0x01, 0x05, 
-    0x82, 0xAE, 0x24, 0x07, 0x08, 0x06, 0x01, 0x01, 0x82, 0xAE, 0x24, 0x07, 
-    0x08, 0x06, 0x01, 0x01, 0x08, 0x14, 0x2D, 0x2C, 0x12, 0x04, 0x06, 0x06, 
-    0x0D, 0x09, 0x0D, 0x08, 0x0D, 0x04, 0x06, 0x04, 0x08, 0x13, 0x09, 0x16, 
-    0x11, 0x07, 0x13, 0x06, 0x04, 0x06, 0x06, 0x07, 0x11, 0x09, 0x04, 0x04, 
-    0x03, 0x08, 0x0D, 0x08, 0x0C, 0x08, 0x0A, 0x0B, 0x01, 0x03, 0x04, 0x06, 
-    0x04, 0x08, 0x09, 0x06, 0x01, 0x01, 0x03, 0x04, 0x04, 0x08, 0x09, 0x1B, 
-    0x01, 0x05, 0x01, 0x0B, 0x04, 0x08, 0x0C, 0x09, 0x1F, 0x29, 0x43, 0x2A, 
-    0x4A, 0x3E, 0x4C, 0x5B, 0x6E, 0x12, 0x2A, 0x3E, 0x47, 0x3E, 0x50, 0x5E, 
-    0x0F, 0x0D, 0x6C, 0x3A, 0x43, 0x42, 0x3A, 0x28, 0x06, 0x1B, 0x3B, 0x3F, 
-    0x48, 0x42, 0x47, 0xC0, 0x04, 0x04, 0x08, 0x6E, 0x19, 0x39, 0x27, 0x2C, 
-    0x06, 0x12, 0x0D, 0x06, 0x08, 0x2F, 0x3E, 0x48, 0x06, 0x10, 0x1B, 0x04, 
-    0x06, 0x11, 0x2E, 0x3A, 0x08, 0x0F, 0x12, 0x06, 0x06, 0x0C, 0x19, 0x2F, 
-    0x7E, 0x24, 0x1E, 0x0D, 0x16, 0x12, 0x1E, 0x1F, 0x54, 0x41, 0x1E, 0x94, 
-    0x41, 0x95, 0x09, 0x12, 0x56, 0x49, 0x2A, 0x60, 0x60, 0x5E, 0x3D, 0x6C, 
-    0x42, 0xC1, 0xC1, 0x5C, 0x53, 0x82, 0xA0, 0x1F, 0x2D, 0x27, 0xC2, 0x53, 
-    0xC1, 0x5A, 0x5B, 0x36, 0x2D, 0xC3, 0x78, 0x48, 0x49, 0x44, 0xC4, 0x69, 
-    0x2A, 0x26, 0x50, 0x36, 0x2E, 0x48, 0xC1, 0x53, 0x4A, 0x49, 0x49, 0x49, 
-    0x3A, 0x50, 0x2A, 0xC1, 0x12, 0x10, 0x30, 0x36, 0x36, 0x39, 0x4A, 0x49, 
-    0x10, 0x11, 0x1F, 0x29, 0x36, 0x2D, 0x3A, 0x47, 0x12, 0x16, 0x1F, 0x30, 
-    0x2D, 0x32, 0x27, 0x47, 0x23, 0x1E, 0xBC, 0x1E, 0x30, 0x2F, 0x3A, 0x3E, 
-    0xA3, 0x70, 0x6C, 0x23, 0x30, 0x2F, 0x29, 0x29, 0x58, 0x58, 0x58, 0x2C, 
-    0x1B, 0x2F, 0x36, 0x36, 0x71, 0x71, 0x5E, 0x2B, 0x08, 0x1F, 0x29, 0x2E, 
-    0xC1, 0xC1, 0x5B, 0x5D, 0x7E, 0xAA, 0x2C, 0x1F, 0x42, 0x2E, 0x3A, 0x56, 
-    0x2A, 0x29, 0x29, 0x3A, 0x39, 0x29, 0x36, 0x49, 0x4A, 0x57, 0x36, 0x36, 
-    0x36, 0x36, 0x39, 0x49, 0x74, 0x69, 0x29, 0x36, 0x36, 0x36, 0x39, 0x48, 
-    0xC1, 0x49, 0x29, 0x36, 0x36, 0x36, 0x2D, 0x27, 0x4A, 0x4A, 0x36, 0x36, 
-    0x36, 0x36, 0x2A, 0x42, 0x39, 0x3A, 0x36, 0x36, 0x2D, 0x36, 0xC1, 0x49, 
-    0x57, 0x29, 0x36, 0x36, 0x2D, 0x36, 0x2A, 0x47, 0x2D, 0x36, 0x36, 0x39, 
-    0x49, 0x80, 0x49, 0x49, 0x5B, 0x5E, 0x5D, 0x5D, 0x3E, 0x74, 0x48, 0x43, 
-    0x68, 0x5D, 0x65, 0x5F, 0x36, 0x48, 0x59, 0x49, 0x48, 0x5E, 0x63, 0x79, 
-    0x39, 0x2A, 0xC1, 0xC1, 0x47, 0x44, 0x79, 0x72, 0x36, 0x4B, 0x49, 0x53, 
-    0x48, 0x43, 0x65, 0x79, 0x36, 0x36, 0x2A, 0xC2, 0x71, 0xC2, 0x79, 0x63, 
-    0x4B, 0x36, 0x3A, 0x3E, 0x43, 0x53, 0x5E, 0x63, 0x4A, 0x3A, 0x3A, 0x3A, 
-    0x3E, 0x49, 0x53, 0x65, 0x5F, 0x67, 0xA0, 0x9E, 0xA9, 0xA7, 0x9F, 0xA6, 
-    0x5E, 0x72, 0xA0, 0xA1, 0xA9, 0xA7, 0xB9, 0x0A, 0x5D, 0x5F, 0x65, 0xA1, 
-    0xBA, 0xA8, 0xB0, 0xB0, 0x5D, 0x5E, 0x65, 0xA0, 0xA1, 0x9E, 0xA9, 0xA9, 
-    0x5E, 0x5D, 0x65, 0x64, 0xA0, 0xB7, 0xC5, 0xC5, 0x72, 0x5D, 0x5F, 0xC6, 
-    0xC7, 0x9B, 0x9B, 0x9B, 0x63, 0x5D, 0x5D, 0x5F, 0xC6, 0xC6, 0x6A, 0x66, 
-    0x63, 0x5F, 0x5F, 0x5D, 0x5F, 0x65, 0xC7, 0x66, 0xA7, 0xA9, 0x9E, 0xA0, 
-    0x64, 0x76, 0x75, 0x77, 0xB0, 0xB9, 0x9E, 0x9B, 0x66, 0x76, 0x76, 0x75, 
-    0xB0, 0xA9, 0xA1, 0x76, 0x76, 0x76, 0x76, 0x66, 0x9E, 0xA1, 0x9B, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0xB7, 0xA1, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x9B, 0x76, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 0x66, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x73, 0x8E, 0x85, 0x88, 0x94, 0x4C, 0x4F, 0x64, 0x7F, 0x85, 0x88, 
-    0x93, 0x7C, 0x92, 0xB4, 0x64, 0x81, 0x85, 0x92, 0xAC, 0x7D, 0x92, 0x92, 
-    0x64, 0x61, 0x85, 0x92, 0x98, 0x7D, 0x92, 0x92, 0x64, 0x61, 0x85, 0x92, 
-    0x98, 0x7D, 0x92, 0x92, 0x64, 0x8E, 0x85, 0x92, 0x98, 0x7D, 0x92, 0x92, 
-    0x64, 0x5B, 0x90, 0x92, 0x98, 0x7D, 0x92, 0x92, 0x76, 0x76, 0x44, 0x86, 
-    0x98, 0x7D, 0x92, 0x92, 0x0A, 0x0B, 0x0F, 0x92, 0x5C, 0x5F, 0x59, 0x8F, 
-    0xA4, 0x08, 0x33, 0x8D, 0x62, 0x65, 0x90, 0x90, 0x46, 0x09, 0x04, 0xAA, 
-    0x78, 0x28, 0x90, 0x90, 0x46, 0x41, 0x1B, 0x35, 0x89, 0xC8, 0x90, 0x90, 
-    0x46, 0x7D, 0x38, 0x35, 0x88, 0x8E, 0x90, 0x88, 0x46, 0x41, 0x0D, 0x7C, 
-    0xC9, 0x8E, 0x88, 0x89, 0x0C, 0x41, 0x07, 0x35, 0x99, 0x8E, 0x90, 0x92, 
-    0x0C, 0x41, 0x19, 0x9C, 0x2B, 0x5D, 0x8E, 0x86, 0x90, 0x90, 0x88, 0x89, 
-    0x93, 0x7D, 0x7D, 0x7D, 0x90, 0x88, 0xAC, 0x33, 0x35, 0x98, 0x7D, 0x95, 
-    0x90, 0x93, 0x4E, 0x94, 0x98, 0x94, 0x7D, 0x51, 0x90, 0x96, 0x35, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x41, 0x93, 0x35, 0x94, 0x7D, 0x7D, 0x7D, 0x41, 0x9C, 
-    0x94, 0x35, 0x7D, 0x7D, 0x7D, 0x7D, 0x41, 0x9C, 0x94, 0x34, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0xC3, 0x89, 0x94, 0x7D, 0x7D, 0x7D, 0x41, 0x9C, 0x60, 
-    0x94, 0x93, 0x47, 0x73, 0x65, 0x5E, 0x63, 0x65, 0x94, 0x93, 0x6B, 0x63, 
-    0x65, 0x5E, 0x63, 0x63, 0x9C, 0xA5, 0x79, 0x73, 0x65, 0x5E, 0x63, 0x73, 
-    0x9C, 0x69, 0xCA, 0xCA, 0x65, 0x5E, 0x63, 0x63, 0xA5, 0xCA, 0x63, 0xCA, 
-    0x65, 0x5E, 0x63, 0xCA, 0xA5, 0x72, 0x63, 0xCA, 0x5F, 0x5D, 0x63, 0x63, 
-    0x69, 0x5F, 0x5F, 0x5F, 0x5D, 0x5D, 0x63, 0x63, 0x63, 0x5D, 0x5F, 0x5F, 
-    0x5F, 0x5D, 0x65, 0x65, 0x5E, 0x63, 0x63, 0x5D, 0x5F, 0x5D, 0x5F, 0x5E, 
-    0x72, 0x63, 0x63, 0x5D, 0x5F, 0x5F, 0x5D, 0x5B, 0x73, 0x73, 0x63, 0x5D, 
-    0x5F, 0x5F, 0x62, 0x5B, 0x63, 0xCA, 0x63, 0x5D, 0x5F, 0x5D, 0x5D, 0x5F, 
-    0x63, 0x63, 0x63, 0x5D, 0x5F, 0x5F, 0x5F, 0x5B, 0x5F, 0x65, 0x63, 0x5D, 
-    0x5E, 0x5B, 0x59, 0x55, 0x5E, 0x5F, 0x5F, 0x5F, 0x5B, 0x59, 0x49, 0x2A, 
-    0x5D, 0x5D, 0x5F, 0x5B, 0x59, 0xCB, 0x5A, 0x49, 0x5C, 0x5F, 0x72, 0x74, 
-    0x2A, 0x2A, 0x55, 0x5B, 0x5F, 0x5F, 0x5E, 0x5D, 0x54, 0x2A, 0x74, 0x5B, 
-    0x72, 0x5B, 0x62, 0x28, 0x4A, 0x48, 0x59, 0x59, 0x5B, 0x59, 0x49, 0x48, 
-    0xC1, 0x5C, 0xCC, 0x2A, 0x59, 0xCC, 0x48, 0x49, 0xC2, 0x48, 0x42, 0x3E, 
-    0x48, 0x4A, 0x48, 0x53, 0xC1, 0x48, 0x4A, 0x27, 0x4A, 0x49, 0xC1, 0x48, 
-    0x2A, 0x4A, 0x3A, 0x3A, 0xC2, 0x48, 0x48, 0x4A, 0x2A, 0x47, 0x3E, 0x39, 
-    0x42, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x42, 0x3A, 0x3A, 0x39, 
-    0x3A, 0x3A, 0x3A, 0x3A, 0x3E, 0x3A, 0x36, 0x2D, 0x3A, 0x3A, 0x3A, 0x39, 
-    0x3A, 0x3A, 0x39, 0x36, 0x3A, 0x27, 0x4B, 0x21, 0x3A, 0x27, 0x39, 0x29, 
-    0x3A, 0x3A, 0x2D, 0x21, 0x3A, 0x39, 0x3A, 0x39, 0x3A, 0x3A, 0x2D, 0x21, 
-    0x36, 0x39, 0x27, 0x27, 0x3A, 0x27, 0x39, 0x21, 0x2F, 0x39, 0x3A, 0x3A, 
-    0x39, 0x29, 0x2D, 0x2E, 0x29, 0x2E, 0x30, 0x39, 0x2A, 0x3E, 0x29, 0x5A, 
-    0x29, 0x2E, 0x3A, 0x42, 0x2A, 0x3A, 0x4B, 0x44, 0x2E, 0x2E, 0x47, 0x2A, 
-    0x2A, 0x3A, 0x39, 0x43, 0x2F, 0x2D, 0x42, 0x4A, 0x4B, 0x47, 0x2A, 0x49, 
-    0x2D, 0x2D, 0x42, 0x27, 0x2E, 0x2A, 0x48, 0x4B, 0x42, 0x2A, 0x39, 0x39, 
-    0x2D, 0x2A, 0x2A, 0x29, 0x3E, 0x2A, 0x36, 0x36, 0x2D, 0x2A, 0x48, 0x21, 
-    0x42, 0x3A, 0x2D, 0x36, 0x2E, 0x48, 0x2A, 0x1E, 0x43, 0x2A, 0x1E, 0x1F, 
-    0x30, 0x12, 0x12, 0x16, 0x43, 0x3A, 0x10, 0x10, 0x14, 0x12, 0x1E, 0x1E, 
-    0x44, 0x39, 0x10, 0x12, 0x1E, 0x12, 0x12, 0x19, 0x7E, 0x1F, 0x23, 0x11, 
-    0x14, 0x70, 0x41, 0x49, 0x29, 0x10, 0x10, 0x14, 0xCD, 0xA5, 0x58, 0x71, 
-    0x2D, 0x19, 0x11, 0x09, 0x24, 0x54, 0xCC, 0x54, 0x1E, 0x08, 0x0D, 0x07, 
-    0xBB, 0x4B, 0x36, 0xB3, 0xBC, 0x08, 0x04, 0x06, 0x06, 0xBC, 0x1E, 0x08, 
-    0x12, 0x10, 0x16, 0x12, 0x10, 0x14, 0x6E, 0x25, 0x1E, 0x10, 0x07, 0x08, 
-    0x09, 0x11, 0x08, 0x31, 0x10, 0x10, 0x07, 0x09, 0x07, 0x07, 0x04, 0x13, 
-    0x26, 0xB3, 0x3A, 0x1E, 0x04, 0x04, 0x0B, 0x0F, 0x54, 0x42, 0x48, 0x1F, 
-    0x03, 0x03, 0x03, 0x40, 0x48, 0x49, 0x3A, 0x1B, 0x01, 0x17, 0x24, 0xAD, 
-    0x36, 0x30, 0x0B, 0x06, 0x03, 0x17, 0x24, 0x69, 0x06, 0x02, 0x03, 0x04, 
-    0x1C, 0x24, 0xBE, 0x48, 0x29, 0x10, 0x0D, 0x03, 0x02, 0x01, 0x0B, 0x83, 
-    0x31, 0x07, 0x0C, 0x0B, 0x03, 0x01, 0x24, 0x26, 0x07, 0x08, 0x03, 0x03, 
-    0x02, 0xAC, 0x3E, 0x49, 0x09, 0x0F, 0x1C, 0x1A, 0x09, 0x3A, 0xC1, 0x49, 
-    0x24, 0x24, 0x24, 0x34, 0x3E, 0xC2, 0xC1, 0x49, 0x7E, 0x26, 0xC3, 0x2D, 
-    0x49, 0x49, 0x49, 0x3E, 0x43, 0x49, 0x48, 0x2A, 0x49, 0x49, 0x39, 0x50, 
-    0x3A, 0x2F, 0x48, 0x49, 0x2A, 0x36, 0x2F, 0x2E, 0x33, 0x24, 0xB8, 0x37, 
-    0x09, 0x21, 0x78, 0x2C, 0x3E, 0x3E, 0x2C, 0x29, 0x30, 0x12, 0x19, 0x16, 
-    0x48, 0x43, 0x42, 0x30, 0x1F, 0x30, 0x29, 0x2D, 0x47, 0x39, 0x2F, 0xBE, 
-    0x2E, 0x39, 0x3A, 0x36, 0x2D, 0xBE, 0x21, 0x30, 0x3E, 0x3A, 0x2F, 0x30, 
-    0x1F, 0x2F, 0x2E, 0x29, 0x2E, 0x12, 0x1E, 0x10, 0x2E, 0x2F, 0x2F, 0x36, 
-    0x2E, 0x14, 0x16, 0x09, 0x2F, 0x2F, 0x2F, 0x2F, 0x10, 0x12, 0x19, 0x14, 
-    0x10, 0x10, 0x30, 0x30, 0x10, 0x0C, 0x06, 0x01, 0x11, 0x10, 0x30, 0x14, 
-    0x07, 0x04, 0x22, 0x06, 0x2E, 0x1E, 0x1E, 0x14, 0x07, 0x08, 0x25, 0x1E, 
-    0x2D, 0x12, 0x09, 0x09, 0x07, 0x1F, 0x2F, 0xCE, 0x10, 0x09, 0x14, 0x07, 
-    0x09, 0xBE, 0x07, 0x04, 0x19, 0x11, 0x09, 0x10, 0x1E, 0x16, 0x03, 0x04, 
-    0x11, 0x11, 0x12, 0x1F, 0x1F, 0x1B, 0x01, 0x1C, 0x07, 0x19, 0x30, 0x16, 
-    0x0C, 0x06, 0x03, 0x08, 0x15, 0x17, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x09, 
-    0x09, 0x1F, 0x10, 0x02, 0x1A, 0x02, 0x23, 0x30, 0x12, 0x19, 0x13, 0x1F, 
-    0x2F, 0x16, 0x1E, 0x1E, 0x06, 0x6E, 0xA3, 0x58, 0x80, 0x70, 0x09, 0xBC, 
-    0x1C, 0x02, 0x34, 0x4A, 0x29, 0x08, 0x06, 0x04, 0x03, 0x0F, 0xB3, 0x47, 
-    0x29, 0x07, 0x06, 0x04, 0x03, 0x3A, 0x4A, 0x2A, 0x3F, 0x07, 0x04, 0x04, 
-    0xCF, 0x48, 0x47, 0x2E, 0x10, 0x31, 0x04, 0x17, 0x1F, 0x30, 0x1F, 0x19, 
-    0x13, 0x13, 0x04, 0x03, 0x21, 0x1E, 0x06, 0x03, 0x06, 0x03, 0x01, 0x01, 
-    0x08, 0x02, 0x13, 0x06, 0x04, 0x0E, 0x04, 0x07, 0x07, 0x04, 0x04, 0x06, 
-    0x0F, 0x34, 0x06, 0x09, 0x01, 0x03, 0x06, 0x6E, 0x10, 0x2F, 0x09, 0x04, 
-    0x03, 0x03, 0x16, 0x23, 0x19, 0xCE, 0x08, 0x06, 0x03, 0x04, 0xBE, 0x30, 
-    0x11, 0x6E, 0x03, 0x01, 0x15, 0x03, 0x1F, 0x1E, 0x09, 0x06, 0x0A, 0x06, 
-    0xBC, 0x2D, 0x09, 0x29, 0xC3, 0x0A, 0x2E, 0xBD, 0x1E, 0x21, 0x07, 0x2D, 
-    0xC3, 0x0A, 0x2E, 0xBD, 0x23, 0xBC, 0x09, 0x36, 0xC3, 0x03, 0x2E, 0xBD, 
-    0x30, 0x2D, 0x4B, 0x36, 0xBF, 0x0A, 0x1F, 0x4D, 0x09, 0xD0, 0xD1, 0x34, 
-    0x1A, 0x06, 0xBC, 0x2F, 0x1F, 0x2E, 0x2F, 0x4D, 0x30, 0x1A, 0x17, 0x37, 
-    0x30, 0x3E, 0x48, 0x49, 0x2A, 0xD1, 0x37, 0x09, 0x19, 0x1F, 0x3F, 0x30, 
-    0x6D, 0xC1, 0xC0, 0x1E, 0x82, 0xAE, 0x7A, 0x07, 0x08, 0x06, 0x01, 0x01, 
-    0x82, 0xAE, 0xAC, 0x07, 0x03, 0x04, 0x01, 0x01, 0x53, 0x7B, 0x6C, 0x1B, 
-    0x05, 0x01, 0x01, 0x01, 0x53, 0x7B, 0x07, 0x1B, 0x01, 0x01, 0x05, 0x01, 
-    0x48, 0x7B, 0x46, 0x04, 0x20, 0x01, 0x01, 0x01, 0x35, 0x09, 0x14, 0x19, 
-    0x0F, 0x15, 0x01, 0x01, 0x0C, 0x2F, 0x3A, 0x47, 0x2F, 0xBB, 0x17, 0x0B, 
-    0x21, 0x21, 0x2E, 0x3A, 0x21, 0x12, 0xD2, 0x1A, 0x01, 0x01, 0x05, 0x01, 
-    0x0A, 0x08, 0x0D, 0x08, 0x01, 0x01, 0x01, 0x05, 0x05, 0x04, 0x04, 0x08, 
-    0x01, 0x01, 0x05, 0x01, 0x03, 0x05, 0x05, 0x06, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x05, 0x03, 0x08, 0x06, 0x01, 
-    0x05, 0x05, 0x05, 0x05, 0x01, 0x08, 0x06, 0x03, 0x0B, 0x17, 0x03, 0x0B, 
-    0x01, 0x17, 0x1C, 0x17, 0x1A, 0x40, 0x40, 0x1A, 0x1A, 0x40, 0x40, 0x40, 
-    0x0C, 0x1B, 0x1E, 0xBC, 0x0D, 0x04, 0x08, 0x09, 0x08, 0x08, 0xBC, 0x21, 
-    0x1E, 0x08, 0x04, 0x06, 0x06, 0x03, 0x08, 0x10, 0xBE, 0x19, 0x03, 0x06, 
-    0x0B, 0x0B, 0x03, 0x06, 0x12, 0xBC, 0x09, 0x04, 0x0B, 0x03, 0x04, 0x06, 
-    0x0A, 0xBC, 0x12, 0x0C, 0x05, 0x01, 0x03, 0x03, 0x04, 0x06, 0x0D, 0x08, 
-    0x17, 0x17, 0x03, 0x04, 0x04, 0x06, 0x07, 0x07, 0x40, 0x40, 0x15, 0x15, 
-    0x01, 0x04, 0x11, 0x07, 0x2F, 0x48, 0x2A, 0x47, 0x49, 0x36, 0x39, 0x2A, 
-    0x11, 0xB3, 0x2E, 0x3A, 0x4A, 0xC1, 0xC1, 0x78, 0x04, 0x07, 0x30, 0x39, 
-    0x3A, 0x48, 0xC2, 0xC1, 0x06, 0x08, 0x08, 0x1E, 0x2E, 0x2D, 0x27, 0x49, 
-    0x06, 0x04, 0x04, 0x07, 0x1F, 0x36, 0x39, 0x3A, 0x06, 0x0F, 0x0F, 0x06, 
-    0x08, 0x12, 0x21, 0x29, 0x04, 0x24, 0x24, 0xBB, 0x3B, 0x0A, 0x19, 0x21, 
-    0x07, 0x4D, 0xBD, 0xBD, 0xBE, 0xBE, 0x1F, 0x07, 0x53, 0xC1, 0xC1, 0x43, 
-    0x5E, 0xA5, 0xC3, 0x2F, 0x3E, 0xC2, 0xC2, 0xC1, 0x62, 0x5E, 0x78, 0x41, 
-    0x4A, 0xC1, 0x5C, 0x59, 0xC4, 0x5E, 0x5B, 0x27, 0x49, 0xCC, 0xCB, 0xCB, 
-    0x59, 0x59, 0x59, 0xCB, 0x47, 0x48, 0x2A, 0x2A, 0x49, 0x44, 0x61, 0x59, 
-    0x42, 0x2A, 0x4A, 0x2A, 0x48, 0xCC, 0x53, 0xC1, 0x3E, 0x3E, 0x36, 0x4A, 
-    0x4B, 0x69, 0x5A, 0xC1, 0xBE, 0x2F, 0x2F, 0x39, 0x27, 0x39, 0x36, 0xC1, 
-    0x2D, 0x36, 0x39, 0x36, 0x36, 0x36, 0x36, 0x29, 0x29, 0x36, 0x29, 0x36, 
-    0x36, 0x36, 0x36, 0x36, 0x57, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 
-    0x6D, 0x2E, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x5B, 0x39, 0x2D, 0x36, 
-    0x36, 0x36, 0x36, 0x36, 0x43, 0xCB, 0x39, 0x50, 0xC3, 0xC3, 0x36, 0x2C, 
-    0xC1, 0xC2, 0x55, 0x58, 0x58, 0x58, 0x57, 0xC3, 0x53, 0x53, 0x59, 0x5E, 
-    0x5E, 0x5E, 0x80, 0x58, 0x3E, 0x47, 0x39, 0x3A, 0x39, 0x4A, 0x53, 0x5F, 
-    0x2D, 0x3E, 0x4A, 0x39, 0x27, 0x42, 0x48, 0xC4, 0x29, 0x39, 0x47, 0x47, 
-    0x39, 0x4B, 0x48, 0x61, 0x36, 0x29, 0x39, 0x49, 0x3A, 0x36, 0x49, 0x49, 
-    0x36, 0x36, 0x36, 0x4B, 0x3A, 0x39, 0x36, 0x3A, 0x36, 0x36, 0x36, 0x2D, 
-    0x3A, 0x47, 0x3A, 0x3A, 0x29, 0x29, 0x36, 0x36, 0x36, 0x3A, 0x42, 0xC9, 
-    0x78, 0x2E, 0x29, 0x29, 0x29, 0x2D, 0x39, 0x69, 0xCA, 0x65, 0x5E, 0x5F, 
-    0x5D, 0x72, 0x64, 0x64, 0x63, 0x63, 0x5F, 0x5D, 0x5D, 0x5F, 0x65, 0xCA, 
-    0xCA, 0xC7, 0x63, 0x63, 0x63, 0x63, 0x63, 0xC6, 0x5B, 0x79, 0x65, 0x65, 
-    0x63, 0xCA, 0x63, 0x63, 0xC4, 0xC4, 0x59, 0x5D, 0x5F, 0x65, 0xCA, 0x63, 
-    0x78, 0x49, 0x5A, 0x5C, 0x59, 0x5F, 0x79, 0x63, 0xC9, 0x9A, 0x48, 0x49, 
-    0x5A, 0x5B, 0x5E, 0x65, 0xCB, 0x60, 0xCC, 0x49, 0x49, 0x49, 0x44, 0x5D, 
-    0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0x76, 0x64, 0x64, 0x66, 0x76, 0x76, 0x76, 0x76, 0x76, 
-    0x63, 0x63, 0x64, 0xC7, 0x64, 0xC7, 0x76, 0x76, 0xCA, 0xCA, 0x63, 0x65, 
-    0xCA, 0x76, 0x76, 0x76, 0x5F, 0x65, 0xCA, 0xCA, 0xCA, 0xC6, 0xC6, 0xCA, 
-    0x62, 0x62, 0x5D, 0x5E, 0x5F, 0xCA, 0x63, 0xCA, 0x5E, 0x5A, 0x81, 0x81, 
-    0x55, 0x5E, 0xCA, 0x66, 0x76, 0x76, 0x5E, 0x92, 0x98, 0x7D, 0x92, 0x92, 
-    0x76, 0x76, 0x64, 0x99, 0xAC, 0x7D, 0x92, 0x92, 0x76, 0x76, 0xC7, 0x61, 
-    0x9D, 0x94, 0x92, 0x92, 0x76, 0x76, 0xC7, 0x8E, 0x87, 0xD0, 0x92, 0x92, 
-    0x76, 0x76, 0x76, 0x65, 0xC8, 0x7D, 0x92, 0x92, 0x64, 0x66, 0x76, 0x6A, 
-    0x43, 0x8D, 0x92, 0x92, 0x64, 0xC7, 0x63, 0xC6, 0xCC, 0x8D, 0xB4, 0x92, 
-    0x66, 0x64, 0x64, 0x6A, 0xC1, 0x87, 0x39, 0x92, 0x0C, 0x7D, 0x41, 0xA3, 
-    0x67, 0x64, 0x60, 0x85, 0x0C, 0x41, 0x94, 0x87, 0x65, 0x76, 0x60, 0x85, 
-    0x0C, 0x41, 0xAA, 0x99, 0x64, 0x76, 0x67, 0x61, 0x08, 0x41, 0x9D, 0x88, 
-    0x64, 0x66, 0x64, 0x2B, 0x0C, 0x7D, 0x89, 0x67, 0x76, 0x76, 0x76, 0x67, 
-    0x0C, 0x9C, 0x6B, 0x64, 0x66, 0x76, 0x66, 0x72, 0x0C, 0x9C, 0x81, 0x64, 
-    0xC6, 0x63, 0xCA, 0x5B, 0x31, 0x9C, 0x99, 0x64, 0xC6, 0x65, 0xCA, 0x5B, 
-    0x90, 0x93, 0x94, 0x7D, 0x7D, 0x9C, 0x6D, 0x5D, 0x90, 0x93, 0x94, 0x7D, 
-    0xD1, 0x9C, 0x80, 0x65, 0xC8, 0x93, 0x94, 0x7D, 0x94, 0xB2, 0x67, 0x76, 
-    0x85, 0x93, 0x94, 0x41, 0x8D, 0x2B, 0x6A, 0x76, 0x85, 0x93, 0x94, 0x94, 
-    0x8D, 0xCB, 0x6A, 0x76, 0x85, 0x93, 0x94, 0xCE, 0x8D, 0xCC, 0x6A, 0x76, 
-    0x85, 0x93, 0x94, 0x94, 0x93, 0x60, 0x6A, 0x76, 0x85, 0x93, 0x94, 0x9C, 
-    0xA2, 0x6A, 0x76, 0x76, 0x79, 0x5E, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 
-    0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x76, 0x76, 0x76, 0x76, 
-    0x76, 0x76, 0x76, 0xC7, 0x76, 0x76, 0xC7, 0x64, 0xC7, 0xC7, 0xC7, 0x64, 
-    0x76, 0x76, 0x64, 0xC6, 0x65, 0x63, 0x63, 0x63, 0x76, 0x76, 0x66, 0x66, 
-    0x64, 0x63, 0x72, 0x5F, 0x76, 0xC7, 0xC7, 0x76, 0xC7, 0x63, 0x63, 0x5D, 
-    0xC7, 0x72, 0x65, 0x76, 0xC6, 0x72, 0x5D, 0x2B, 0x5D, 0x5F, 0x5F, 0x59, 
-    0xC4, 0x43, 0xC1, 0x55, 0x79, 0x5D, 0x5B, 0x5C, 0x5B, 0x5B, 0x5B, 0x5B, 
-    0x72, 0x59, 0x59, 0x5B, 0x5F, 0x5C, 0xC1, 0x49, 0x72, 0x5F, 0x5F, 0x5B, 
-    0x62, 0x5A, 0x49, 0x5A, 0x5F, 0x5B, 0x5E, 0x5B, 0x5C, 0x5A, 0x49, 0x5A, 
-    0x5B, 0x59, 0x53, 0x48, 0x48, 0x49, 0x49, 0x27, 0x55, 0x48, 0x47, 0x3E, 
-    0x2A, 0x48, 0x4B, 0x3A, 0x27, 0x3A, 0x3A, 0x4A, 0x2A, 0x9A, 0x2A, 0xCB, 
-    0x49, 0x2A, 0x4A, 0x2A, 0x42, 0x3A, 0x4A, 0x39, 0x61, 0x2A, 0x4A, 0x2A, 
-    0x27, 0x42, 0x39, 0x36, 0x49, 0x49, 0x2A, 0x2A, 0x27, 0x3A, 0x36, 0x36, 
-    0x49, 0x48, 0x47, 0x3E, 0x3A, 0x29, 0x29, 0x36, 0x2A, 0x39, 0x39, 0x39, 
-    0x39, 0x3A, 0x3A, 0x3A, 0x57, 0x29, 0x29, 0x2D, 0x2C, 0x2A, 0x27, 0x3E, 
-    0x54, 0x39, 0x2F, 0x27, 0xCC, 0x2A, 0x3A, 0x3A, 0xCB, 0x4A, 0x49, 0xC1, 
-    0x48, 0x42, 0x3A, 0x29, 0x2E, 0x36, 0x29, 0x2D, 0x2E, 0x39, 0x39, 0x36, 
-    0x4B, 0x29, 0x3A, 0x47, 0x42, 0x3A, 0x36, 0x36, 0x36, 0x39, 0x4A, 0x49, 
-    0x2A, 0x39, 0x2E, 0x2E, 0x50, 0x55, 0x69, 0x9A, 0x39, 0x2E, 0x2D, 0x2F, 
-    0x47, 0xC1, 0x7E, 0xB3, 0x2F, 0xBE, 0x21, 0x1F, 0x49, 0x27, 0x36, 0x2F, 
-    0x2E, 0x1F, 0xBC, 0x19, 0x29, 0xBE, 0x30, 0x96, 0xB3, 0x41, 0x6C, 0x1F, 
-    0x30, 0x10, 0x41, 0xA5, 0xA5, 0x7E, 0x2C, 0x2A, 0x39, 0x2E, 0x2D, 0x27, 
-    0x4A, 0x57, 0x1F, 0x11, 0x2D, 0x2F, 0x2E, 0x29, 0x29, 0x19, 0x07, 0x14, 
-    0x2F, 0x1F, 0xBE, 0x10, 0xCF, 0x09, 0x14, 0x09, 0x30, 0xBE, 0xBC, 0x1F, 
-    0x23, 0x19, 0x07, 0x07, 0x12, 0x12, 0xBC, 0x10, 0x11, 0x09, 0x08, 0x0D, 
-    0x3F, 0x2C, 0x09, 0x19, 0x14, 0x07, 0x08, 0x24, 0x3E, 0x3E, 0xCF, 0x11, 
-    0x14, 0x0D, 0x04, 0x3F, 0x47, 0x1E, 0x19, 0x14, 0x46, 0x24, 0x38, 0x43, 
-    0x16, 0x07, 0x04, 0x04, 0x08, 0xCD, 0x04, 0x94, 0x09, 0x08, 0x06, 0x06, 
-    0x03, 0xD0, 0x26, 0x5A, 0x08, 0x06, 0x04, 0x0F, 0x1A, 0x3A, 0x48, 0x3A, 
-    0x08, 0x08, 0x06, 0x0F, 0x1A, 0x2C, 0x39, 0x1E, 0x06, 0x1D, 0xBB, 0x02, 
-    0x1A, 0x2C, 0x2F, 0x04, 0x35, 0x21, 0x2F, 0x1F, 0xBB, 0x2C, 0x2F, 0x02, 
-    0x7E, 0x27, 0x29, 0x2F, 0x02, 0xBF, 0x1E, 0x14, 0x5C, 0x3E, 0x09, 0x0C, 
-    0x04, 0x04, 0x0F, 0x04, 0x34, 0x33, 0x04, 0x04, 0xBB, 0xD1, 0x47, 0x2A, 
-    0x2A, 0x78, 0x12, 0x16, 0xBF, 0x48, 0x49, 0x47, 0x3F, 0x2F, 0x10, 0x70, 
-    0x69, 0x49, 0x49, 0x2A, 0x19, 0x31, 0x12, 0x39, 0x5A, 0x3A, 0x80, 0x43, 
-    0x16, 0x19, 0x26, 0x49, 0x48, 0x3E, 0xC2, 0x48, 0x08, 0x2D, 0x49, 0x2A, 
-    0x47, 0x47, 0xC1, 0x3A, 0x0F, 0x39, 0x49, 0x3E, 0x4A, 0xC1, 0x2C, 0xBC, 
-    0x39, 0x3A, 0x2C, 0x2F, 0x3A, 0x3A, 0x2E, 0x1F, 0x42, 0x3A, 0x39, 0x2E, 
-    0x50, 0x2E, 0x2E, 0x2F, 0x2A, 0x42, 0x39, 0x42, 0x3E, 0x3E, 0x2F, 0x2F, 
-    0x2D, 0x39, 0x47, 0x2A, 0x2A, 0x3E, 0x2F, 0x2F, 0x3A, 0x3E, 0x2A, 0x4A, 
-    0x3E, 0x2D, 0x2E, 0x2E, 0x36, 0x36, 0x2A, 0x48, 0x2D, 0x2D, 0x2E, 0x1F, 
-    0x2D, 0x39, 0x48, 0x48, 0x2F, 0xBC, 0x10, 0x11, 0x29, 0x2A, 0x2A, 0x2F, 
-    0x10, 0x10, 0x07, 0x09, 0x3A, 0x47, 0x1E, 0x10, 0x12, 0xBC, 0x10, 0x08, 
-    0x2F, 0x2F, 0x2F, 0x1F, 0x10, 0x14, 0x09, 0x08, 0x2E, 0x2F, 0x2E, 0x1F, 
-    0x10, 0x10, 0x08, 0x01, 0x2E, 0x30, 0x1F, 0x10, 0x14, 0x12, 0x11, 0x03, 
-    0x2F, 0xBC, 0x07, 0x08, 0x16, 0x11, 0x08, 0x01, 0x10, 0x11, 0x08, 0x07, 
-    0x16, 0x08, 0x04, 0x01, 0x09, 0x06, 0x08, 0x08, 0x06, 0x06, 0x03, 0x0B, 
-    0x09, 0x04, 0x08, 0x09, 0x04, 0x06, 0x04, 0x1A, 0x04, 0x08, 0x09, 0x08, 
-    0x06, 0x04, 0x1C, 0x24, 0x06, 0x09, 0x14, 0x07, 0x01, 0x17, 0x0A, 0x38, 
-    0x04, 0x08, 0x04, 0x0A, 0x03, 0x03, 0x24, 0x7B, 0x06, 0x04, 0x0B, 0x17, 
-    0x03, 0x09, 0x09, 0xC0, 0x01, 0x01, 0xBB, 0xBB, 0x40, 0x30, 0x39, 0x21, 
-    0x01, 0x0A, 0xD0, 0x41, 0x41, 0x2E, 0xC3, 0x09, 0x20, 0x83, 0x2A, 0x49, 
-    0x48, 0x39, 0x0B, 0x09, 0xD0, 0x78, 0xC1, 0x2A, 0x3E, 0x19, 0x02, 0x0F, 
-    0x4D, 0xC1, 0x3E, 0xBC, 0xCF, 0x03, 0x01, 0x08, 0x3F, 0x2A, 0x36, 0x1F, 
-    0x07, 0x04, 0x1C, 0x0A, 0x53, 0x47, 0x2F, 0x19, 0x04, 0x1A, 0x40, 0xC0, 
-    0x4A, 0x2E, 0x1E, 0x08, 0x0A, 0x29, 0x7B, 0x2E, 0x3A, 0x12, 0x09, 0x03, 
-    0x04, 0xC2, 0x54, 0x2D, 0x09, 0x6E, 0x6E, 0x01, 0x1D, 0xC2, 0x7E, 0x1E, 
-    0x30, 0x30, 0x30, 0x37, 0xBB, 0x2A, 0x3F, 0x40, 0x19, 0x12, 0x1F, 0x19, 
-    0x09, 0xB8, 0x01, 0x0B, 0x01, 0x06, 0x10, 0x21, 0xBE, 0x06, 0x01, 0x03, 
-    0x7A, 0x38, 0x1F, 0x19, 0x0A, 0x02, 0x08, 0x07, 0x80, 0x3A, 0x19, 0x07, 
-    0x09, 0x19, 0x16, 0x1B, 0x49, 0x3E, 0x0C, 0x09, 0x07, 0x0F, 0x0F, 0x0F, 
-    0x47, 0x1E, 0x04, 0x06, 0x04, 0x0B, 0x15, 0x1A, 0x29, 0x1D, 0x01, 0x0B, 
-    0x03, 0x01, 0x37, 0xBF, 0x33, 0x03, 0x03, 0x03, 0x1C, 0x1A, 0xCE, 0x3A, 
-    0x01, 0x04, 0x0B, 0x03, 0x1A, 0xCE, 0x29, 0x10, 0x03, 0x04, 0x0A, 0x03, 
-    0x24, 0xBD, 0x2A, 0x09, 0x0C, 0x0C, 0x0D, 0x24, 0xAE, 0x53, 0xBE, 0x08, 
-    0x11, 0x11, 0x16, 0x46, 0xD3, 0x49, 0xBC, 0x2F, 0x09, 0x11, 0x09, 0x6E, 
-    0xCE, 0x3A, 0x10, 0x29, 0x0C, 0x10, 0x1E, 0x0D, 0x1C, 0x16, 0x14, 0xBC, 
-    0x09, 0x16, 0x10, 0x0D, 0xA8, 0x04, 0x1E, 0x2F, 0x0D, 0x07, 0x1D, 0xA7, 
-    0xA9, 0xA6, 0xBE, 0x30, 0xAF, 0xD4, 0xA8, 0xA8, 0xA7, 0xC5, 0xB9, 0x1A, 
-    0x0B, 0x04, 0x0C, 0xA8, 0xA7, 0xA9, 0x14, 0xC0, 0x1E, 0x1F, 0x2E, 0xB2, 
-    0x1F, 0x2F, 0xBF, 0x2F, 0x42, 0x38, 0x2D, 0x48, 0x49, 0x2A, 0x42, 0x3A, 
-    0x2A, 0x49, 0x3F, 0x52, 0x42, 0x3E, 0x39, 0x2E, 0x21, 0x2A, 0x3E, 0x3F, 
-    0x09, 0xBF, 0x2F, 0x2E, 0x30, 0x3A, 0x2A, 0x2A, 0x1F, 0x07, 0xBE, 0x2F, 
-    0x2F, 0x2A, 0x2A, 0x47, 0x2F, 0xBC, 0x10, 0x07, 0x1A, 0x3F, 0x29, 0x7B, 
-    0xBC, 0x19, 0x0A, 0x03, 0xC0, 0x2C, 0x30, 0xCE, 0x21, 0x2F, 0x03, 0x02, 
-    0x30, 0x4D, 0x4D, 0xBF, 0xCE, 0xC3, 0x26, 0x2C, 0x49, 0x49, 0x2A, 0x2F, 
-    0x2F, 0x36, 0x2A, 0x49, 0xBE, 0x12, 0xBE, 0x42, 0x3A, 0x08, 0x6C, 0xC0, 
-    0x2C, 0x3F, 0x2D, 0x42, 0x2F, 0x36, 0x2D, 0x1E, 0x36, 0x2D, 0x1F, 0x1E, 
-    0x07, 0xC0, 0x30, 0x12, 0x0C, 0x0C, 0x0C, 0x0D, 0x09, 0x0A, 0xCD, 0x21, 
-    0x0A, 0x03, 0x01, 0x02, 0x0A, 0x02, 0x05, 0x06, 0x01, 0x02, 0x6C, 0xD0, 
-    0xD0, 0xD0, 0x38, 0x1D, 0x26, 0x4D, 0x6C, 0x1B, 0x01, 0x04, 0x19, 0x1F, 
-    0x49, 0xC1, 0x5A, 0x48, 0x1F, 0x03, 0x11, 0x2E, 0x2D, 0x39, 0x2A, 0x49, 
-    0x55, 0x23, 0x3B, 0x1F, 0xBC, 0x41, 0x3E, 0x49, 0xCC, 0x2E, 0x09, 0x10, 
-    0xBC, 0xC0, 0x39, 0x3E, 0xCC, 0x2C, 0x21, 0x1E, 0x30, 0x3A, 0xB4, 0xC9, 
-    0x49, 0x1F, 0xCE, 0x12, 0x16, 0x39, 0x3E, 0x49, 0xCC, 0xCE, 0x09, 0x19, 
-    0x31, 0x12, 0x1F, 0x26, 0xCC, 0xCE, 0x03, 0x0C, 0x26, 0x49, 0x44, 0x44, 
-    0x39, 0x21, 0x2F, 0xBF, 0x2A, 0x5A, 0x48, 0x3E, 0x3A, 0x3A, 0x3A, 0xC3, 
-    0x2E, 0x2A, 0xC1, 0x2D, 0x2C, 0x53, 0x53, 0x43, 0x31, 0x1E, 0x36, 0x36, 
-    0x36, 0x2A, 0x5A, 0x5B, 0x0D, 0x07, 0x1E, 0x27, 0x4A, 0x39, 0x4A, 0xC2, 
-    0x46, 0xBB, 0x46, 0x1F, 0x39, 0x3A, 0x2A, 0x49, 0x23, 0x3F, 0x4D, 0x29, 
-    0x19, 0x07, 0x21, 0x3A, 0x1F, 0x47, 0x48, 0x49, 0x2F, 0xBB, 0x08, 0x23, 
-    0x1E, 0x21, 0x2E, 0x2E, 0x27, 0x2A, 0x3E, 0x47, 0x94, 0x1F, 0x21, 0x1F, 
-    0x2E, 0x27, 0x44, 0x39, 0xD3, 0x24, 0x46, 0x6E, 0x10, 0x39, 0xC9, 0x48, 
-    0x80, 0x4D, 0xBD, 0x12, 0x09, 0x30, 0x2F, 0x42, 0xC1, 0xC2, 0xC1, 0x29, 
-    0x08, 0x1F, 0x1E, 0x39, 0x53, 0xC2, 0x53, 0x5A, 0x52, 0xBC, 0x16, 0x10, 
-    0x48, 0xC1, 0xC1, 0x48, 0x38, 0x04, 0x08, 0x08, 0x2D, 0x2A, 0x2F, 0xCE, 
-    0x06, 0x04, 0x04, 0x02, 0x48, 0x49, 0xC2, 0x59, 0x59, 0x59, 0x62, 0x5C, 
-    0x39, 0x3A, 0x2A, 0x5A, 0x5B, 0x5D, 0x5E, 0x43, 0x48, 0x2A, 0x48, 0x49, 
-    0x48, 0x49, 0xC1, 0x5B, 0x42, 0x49, 0x53, 0x53, 0x48, 0x47, 0x81, 0xCB, 
-    0x27, 0x4A, 0x48, 0x48, 0xC1, 0xC2, 0x48, 0x4A, 0xBE, 0xBE, 0x30, 0x39, 
-    0x2A, 0xC2, 0x3E, 0x39, 0x1F, 0xBE, 0x21, 0x2D, 0x2D, 0xC1, 0x2A, 0x2C, 
-    0x08, 0x19, 0x12, 0x21, 0x1F, 0x3A, 0x3A, 0x36, 0x5A, 0x42, 0x3E, 0x3E, 
-    0x3E, 0x3E, 0x42, 0x69, 0x49, 0x5A, 0x5A, 0x5A, 0x49, 0x48, 0x48, 0x4A, 
-    0x5E, 0x59, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5B, 0x5E, 0x5E, 0x5B, 0x59, 
-    0x59, 0x59, 0x59, 0x5B, 0xC1, 0x5F, 0x72, 0x5E, 0x5D, 0x5D, 0x5D, 0x5E, 
-    0x49, 0xC1, 0x5F, 0x63, 0x65, 0x65, 0x63, 0x63, 0xC1, 0x61, 0x71, 0x5E, 
-    0x5B, 0x5B, 0x5F, 0x5E, 0x48, 0x48, 0x5A, 0x43, 0x5D, 0x5F, 0x5D, 0x65, 
-    0x69, 0x2B, 0x59, 0xCB, 0x49, 0x49, 0x49, 0xCC, 0x4A, 0x2A, 0x80, 0x5C, 
-    0x5A, 0x55, 0x5A, 0x48, 0x5E, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x79, 0x72, 
-    0x5E, 0x5B, 0x5B, 0x5B, 0x5E, 0x5B, 0x79, 0x65, 0x5E, 0x5E, 0x5D, 0x5B, 
-    0x59, 0x59, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0xCA, 0xCA, 0x63, 0x63, 
-    0x5E, 0x5D, 0x5E, 0x5D, 0x72, 0x72, 0x65, 0x65, 0x65, 0x5D, 0x72, 0x65, 
-    0x72, 0x65, 0x5F, 0x5E, 0x2B, 0x60, 0xCB, 0x5C, 0xCC, 0xC1, 0x79, 0xC6, 
-    0x6B, 0xCB, 0x5F, 0xCA, 0xCA, 0x63, 0x65, 0x79, 0x72, 0x79, 0x72, 0xC7, 
-    0x64, 0xCA, 0xCA, 0xCA, 0x65, 0x65, 0x72, 0x79, 0x79, 0x72, 0x72, 0x79, 
-    0x62, 0x5E, 0x5D, 0x5D, 0x79, 0x65, 0x65, 0x65, 0x63, 0xCA, 0xCA, 0x5F, 
-    0x63, 0xCA, 0xCA, 0xCA, 0x65, 0x72, 0x72, 0x5E, 0x79, 0x65, 0x65, 0x63, 
-    0x5F, 0x65, 0x65, 0x72, 0x5D, 0x5E, 0x5D, 0xCA, 0xC6, 0xC6, 0x64, 0xC7, 
-    0x5B, 0x89, 0x50, 0xB2, 0x63, 0x65, 0x72, 0x64, 0xCA, 0x90, 0xAA, 0xBF, 
-    0xCA, 0x72, 0x5F, 0x64, 0xCA, 0x85, 0xAA, 0x7D, 0x65, 0xCA, 0x63, 0x64, 
-    0xC6, 0x85, 0xAA, 0x7D, 0x63, 0xCA, 0xCA, 0x63, 0x5D, 0xC8, 0xAA, 0x41, 
-    0x65, 0x65, 0x65, 0x72, 0x5B, 0xC8, 0xAA, 0xD1, 0x5F, 0x5E, 0x5E, 0x79, 
-    0x5B, 0xC8, 0xAA, 0x9C, 0xCA, 0xC7, 0xC7, 0x63, 0x5E, 0xC8, 0x96, 0x3E, 
-    0x7C, 0xC0, 0x60, 0xCA, 0xCA, 0x63, 0xCA, 0x5B, 0x98, 0xD3, 0x72, 0xCA, 
-    0xCA, 0x63, 0xCA, 0x5B, 0x0D, 0x8D, 0x43, 0x6A, 0x76, 0x63, 0x63, 0x62, 
-    0x07, 0x9D, 0x44, 0x64, 0x64, 0xCA, 0x67, 0xC8, 0x0D, 0x9D, 0xC1, 0xC7, 
-    0xCA, 0x59, 0x49, 0x85, 0x0D, 0x8D, 0x43, 0x76, 0x79, 0x85, 0x85, 0x90, 
-    0x0D, 0x8D, 0x43, 0x64, 0xCB, 0x85, 0x88, 0x92, 0x1F, 0x8D, 0xCC, 0xCA, 
-    0x5C, 0x85, 0x92, 0xAA, 0x85, 0x93, 0x41, 0xB6, 0xA2, 0x66, 0x64, 0x76, 
-    0x85, 0x93, 0x94, 0x9C, 0xAD, 0x64, 0xC6, 0x63, 0x85, 0x93, 0x41, 0x9C, 
-    0xAD, 0xCA, 0x79, 0x5D, 0x88, 0x96, 0x09, 0xA3, 0xAD, 0x64, 0xC7, 0xC7, 
-    0x88, 0x35, 0x38, 0x06, 0xC3, 0x67, 0x64, 0xC6, 0x90, 0x93, 0x98, 0x41, 
-    0x9C, 0x58, 0x64, 0xC7, 0x89, 0x93, 0x96, 0x7D, 0x7C, 0x7E, 0x72, 0x63, 
-    0x24, 0x7D, 0x92, 0x7D, 0xB1, 0xB6, 0x84, 0x6A, 0x76, 0xC7, 0xC7, 0x65, 
-    0x69, 0x54, 0x78, 0x9A, 0xCA, 0xCA, 0xCA, 0xCB, 0x9A, 0x3E, 0x26, 0x80, 
-    0x5F, 0x5F, 0x5E, 0x79, 0x72, 0x5F, 0x5D, 0x72, 0x64, 0x65, 0x72, 0xCA, 
-    0xCA, 0x65, 0x65, 0x63, 0xC6, 0xCA, 0xCA, 0x63, 0x63, 0x63, 0xCA, 0x65, 
-    0xC7, 0xC7, 0xC7, 0x63, 0x5F, 0x5F, 0x5D, 0x72, 0x63, 0x65, 0x72, 0xCA, 
-    0xCA, 0xC6, 0x64, 0xCA, 0x64, 0x79, 0x5E, 0x79, 0x5F, 0x63, 0xCA, 0x79, 
-    0x4B, 0x9A, 0x4B, 0x27, 0x42, 0x2B, 0x55, 0x78, 0x5C, 0xCC, 0x43, 0x80, 
-    0x59, 0x5D, 0x78, 0x2D, 0xCA, 0xCA, 0x63, 0x5D, 0x5F, 0x5B, 0x5B, 0x5B, 
-    0x72, 0x72, 0x72, 0x5D, 0x5D, 0x72, 0x65, 0x65, 0x5E, 0x5D, 0x5D, 0x5F, 
-    0x5F, 0x79, 0x79, 0x79, 0xCA, 0xCA, 0x5F, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 
-    0x63, 0x65, 0x5F, 0x5E, 0x5D, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x5F, 0x65, 
-    0x79, 0x5D, 0x5D, 0x5B, 0xC9, 0x3A, 0x5C, 0x4A, 0x2A, 0x2F, 0x21, 0x1F, 
-    0x26, 0x26, 0x78, 0x3A, 0x26, 0xD3, 0x7B, 0x2F, 0x5B, 0x5B, 0x5B, 0x59, 
-    0x59, 0x59, 0x59, 0xC2, 0x65, 0x5F, 0x5D, 0x5E, 0x5E, 0x79, 0x62, 0xC4, 
-    0x79, 0x5F, 0x5F, 0x5E, 0x5B, 0x79, 0x59, 0xC4, 0x5D, 0x5E, 0x62, 0x5C, 
-    0xC2, 0xC4, 0xC4, 0xC2, 0x5F, 0x5B, 0x69, 0x81, 0xC1, 0x59, 0x82, 0x49, 
-    0x5B, 0xCC, 0x54, 0x42, 0x49, 0x58, 0x58, 0xD3, 0xBC, 0xB3, 0x54, 0x5F, 
-    0x5F, 0x5F, 0x5B, 0x48, 0xC0, 0xCC, 0x5B, 0xC2, 0x5C, 0x43, 0x54, 0x49, 
-    0x59, 0xC2, 0xC1, 0xC1, 0x44, 0x49, 0x42, 0x3E, 0x59, 0x5C, 0x48, 0xC1, 
-    0x5A, 0x47, 0x36, 0x2E, 0x53, 0xCB, 0x3E, 0x2A, 0xC1, 0x49, 0x36, 0x2E, 
-    0xC2, 0x78, 0x4B, 0xC1, 0x2A, 0x42, 0x36, 0xBC, 0x39, 0x2D, 0x3A, 0xC1, 
-    0x3E, 0x2E, 0x23, 0xD2, 0x09, 0x36, 0x27, 0x49, 0x2C, 0x12, 0x6E, 0x24, 
-    0x3E, 0x1E, 0x19, 0x07, 0x4D, 0x78, 0x39, 0x4A, 0x3E, 0x1F, 0x14, 0x38, 
-    0x54, 0x5C, 0x4A, 0x36, 0x1F, 0x07, 0x0C, 0x24, 0x3E, 0x39, 0x21, 0xBE, 
-    0x1F, 0x46, 0x3F, 0xA5, 0x4B, 0x29, 0x12, 0x1D, 0x1F, 0x24, 0x7E, 0x5E, 
-    0xB3, 0x19, 0x06, 0x0F, 0x0F, 0x24, 0x58, 0x60, 0x52, 0x11, 0x0A, 0x0F, 
-    0x2C, 0x29, 0x2D, 0x27, 0xBC, 0x07, 0x31, 0x2F, 0x42, 0x3E, 0xC3, 0x3A, 
-    0x0C, 0x23, 0x21, 0x2F, 0x3A, 0xBF, 0x0F, 0x06, 0x1A, 0x09, 0xD1, 0xBF, 
-    0x30, 0x31, 0x06, 0x09, 0x09, 0x2F, 0x47, 0x2D, 0x16, 0x04, 0xB3, 0x78, 
-    0xC1, 0x2C, 0x1F, 0x1E, 0x1F, 0xCE, 0x3A, 0x49, 0x49, 0x2D, 0xBC, 0x10, 
-    0x30, 0xD0, 0x78, 0xC2, 0x3A, 0x37, 0x19, 0x1A, 0x10, 0x1D, 0x2D, 0x3A, 
-    0xBE, 0xB1, 0x46, 0x3F, 0xBE, 0x02, 0x10, 0x19, 0xCD, 0xD1, 0x4D, 0x49, 
-    0x10, 0x1D, 0x0A, 0x06, 0x40, 0x58, 0x59, 0x2A, 0x3F, 0x2D, 0x2F, 0x46, 
-    0x2F, 0x42, 0x42, 0x30, 0x0C, 0x21, 0x36, 0x19, 0x1F, 0x39, 0x3A, 0xBE, 
-    0x12, 0x30, 0x27, 0x39, 0x4B, 0x36, 0x12, 0x23, 0x14, 0x10, 0x3F, 0x3F, 
-    0x2D, 0x3F, 0xBC, 0x12, 0x6C, 0x21, 0x1F, 0x09, 0x6C, 0x6C, 0x10, 0x10, 
-    0x48, 0x2A, 0x39, 0x3F, 0xBD, 0xAD, 0x39, 0x2F, 0xC1, 0x2A, 0x1F, 0x26, 
-    0xC1, 0xCC, 0x3E, 0x2F, 0x2D, 0x2F, 0x07, 0x1F, 0x36, 0x50, 0x2F, 0x12, 
-    0x21, 0x3F, 0xBC, 0x12, 0x12, 0x10, 0x14, 0x07, 0x19, 0x23, 0x12, 0x12, 
-    0x12, 0x10, 0x08, 0x06, 0x1E, 0x12, 0x10, 0x12, 0x10, 0x07, 0x04, 0x04, 
-    0x19, 0xBC, 0xBE, 0x10, 0x07, 0x04, 0x04, 0x08, 0x21, 0x2F, 0x2F, 0x11, 
-    0x04, 0x0B, 0x1B, 0x0D, 0x30, 0xBE, 0x0C, 0x06, 0x03, 0x01, 0x06, 0x07, 
-    0x11, 0x11, 0x04, 0x04, 0x01, 0x01, 0x06, 0x09, 0x1B, 0x1B, 0x03, 0x0B, 
-    0x05, 0x01, 0x0A, 0x04, 0x04, 0x06, 0x11, 0x08, 0x04, 0x08, 0x15, 0x0F, 
-    0x04, 0x06, 0x09, 0x08, 0x04, 0x08, 0x1A, 0x23, 0x06, 0x06, 0x06, 0x06, 
-    0x04, 0x08, 0x1A, 0x16, 0x07, 0x07, 0x06, 0x04, 0x04, 0x08, 0x15, 0x19, 
-    0x07, 0x1B, 0x04, 0x06, 0x08, 0x08, 0x02, 0x09, 0x19, 0x1B, 0x03, 0x06, 
-    0x0D, 0x08, 0x02, 0x1B, 0x10, 0x1B, 0x03, 0x04, 0x01, 0x02, 0xBB, 0x1B, 
-    0x07, 0x08, 0x03, 0x05, 0x09, 0xBF, 0x19, 0x12, 0x3E, 0x48, 0x1F, 0x1E, 
-    0x04, 0x0A, 0xCE, 0x21, 0x36, 0x29, 0x10, 0x14, 0x0A, 0x19, 0x2E, 0x1F, 
-    0x12, 0xBB, 0x01, 0x08, 0x04, 0x01, 0x11, 0x23, 0x10, 0x04, 0x08, 0x07, 
-    0x04, 0x0F, 0x23, 0x08, 0x09, 0x09, 0x10, 0x04, 0x0A, 0x09, 0x19, 0x04, 
-    0x1E, 0x19, 0x06, 0x01, 0x04, 0x04, 0x03, 0x03, 0x10, 0x02, 0x01, 0x03, 
-    0x03, 0x0B, 0x03, 0x03, 0x10, 0x15, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x1C, 0x08, 0x09, 0x04, 0x04, 0x0B, 0x03, 0x03, 0x04, 0x04, 0x06, 0x01, 
-    0x01, 0x0B, 0x03, 0x03, 0x06, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x01, 0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x17, 0x17, 0x19, 
-    0x03, 0x03, 0x03, 0x03, 0x05, 0x23, 0xBE, 0x12, 0x0B, 0x0B, 0x03, 0x03, 
-    0x15, 0x0F, 0x09, 0x1C, 0x03, 0x01, 0x04, 0x1A, 0x1F, 0x2A, 0x3A, 0x34, 
-    0x03, 0x03, 0x04, 0x1A, 0x1F, 0x2C, 0x10, 0x1C, 0x03, 0x03, 0x0B, 0x1A, 
-    0x12, 0xD1, 0x1A, 0x03, 0x0B, 0x01, 0x06, 0x04, 0x19, 0xBF, 0x02, 0x03, 
-    0x06, 0x05, 0x0F, 0x06, 0x23, 0xBF, 0xD2, 0x17, 0x19, 0x02, 0x03, 0xD2, 
-    0x19, 0xCE, 0xD2, 0x03, 0x0F, 0x0B, 0x02, 0x10, 0x10, 0x02, 0x0B, 0x01, 
-    0x03, 0x0B, 0x05, 0x19, 0x09, 0x05, 0x03, 0x03, 0x24, 0x40, 0x40, 0xA8, 
-    0xA8, 0xB1, 0x1E, 0x4B, 0x29, 0x3F, 0xD3, 0x09, 0x02, 0x04, 0x09, 0x10, 
-    0x48, 0x48, 0x49, 0x3F, 0x34, 0x04, 0x19, 0x1F, 0x23, 0x09, 0x1F, 0x42, 
-    0x2E, 0x40, 0x19, 0x1E, 0x12, 0xBE, 0x2F, 0x2E, 0x29, 0x78, 0x38, 0x23, 
-    0x39, 0x3E, 0x4A, 0x39, 0xAD, 0x59, 0x94, 0x04, 0x19, 0xBC, 0x30, 0xD1, 
-    0x6D, 0x43, 0x94, 0xBB, 0x2F, 0x30, 0x11, 0x6C, 0x6D, 0x53, 0xBF, 0x40, 
-    0x48, 0x53, 0x49, 0x4A, 0x2A, 0x42, 0x23, 0xA6, 0x2C, 0x5A, 0x2A, 0x39, 
-    0x2F, 0x0F, 0x2C, 0x5A, 0x2F, 0x52, 0x27, 0x3A, 0x10, 0x33, 0x7B, 0x2A, 
-    0x2F, 0xBE, 0x1E, 0xBC, 0xBB, 0x03, 0x0F, 0xAA, 0xBE, 0x1E, 0xA8, 0xB1, 
-    0x4E, 0xAF, 0x09, 0x10, 0x09, 0x1B, 0xA8, 0xA8, 0xD4, 0xD4, 0x6E, 0x0A, 
-    0x03, 0x05, 0x6E, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x0B, 0x05, 0x01, 0xCD, 
-    0xBB, 0xA8, 0xA8, 0xA8, 0xA6, 0x09, 0x2B, 0x2B, 0x2B, 0x2B, 0x58, 0xAC, 
-    0x49, 0x49, 0xC2, 0x2E, 0x3F, 0x29, 0x49, 0x44, 0x49, 0x48, 0x7E, 0x52, 
-    0x2D, 0x2A, 0x44, 0xC1, 0x2D, 0x2E, 0x70, 0x2C, 0x42, 0x47, 0x4A, 0x2A, 
-    0x07, 0x19, 0x4E, 0x39, 0x2D, 0x46, 0x09, 0x1E, 0xA8, 0xA7, 0xD3, 0x58, 
-    0xAB, 0xB3, 0x21, 0x07, 0xA8, 0xB7, 0xA1, 0xA0, 0xA9, 0x57, 0x29, 0x6E, 
-    0x3B, 0xB9, 0x9E, 0x9E, 0xA8, 0x21, 0x2C, 0x14, 0x35, 0x33, 0xCD, 0x2F, 
-    0x5A, 0xCE, 0x04, 0x16, 0xC1, 0x80, 0x24, 0xD0, 0x48, 0xCE, 0x02, 0x09, 
-    0xC1, 0xCB, 0x54, 0xAB, 0xD1, 0x37, 0x01, 0x01, 0x2A, 0x59, 0x71, 0x80, 
-    0x29, 0x06, 0x01, 0x01, 0x29, 0x48, 0xC2, 0x53, 0xC1, 0xD0, 0x1A, 0x0B, 
-    0xB3, 0x2A, 0xC1, 0xC2, 0xC1, 0x09, 0x02, 0x0B, 0xD0, 0x2D, 0x2A, 0xC2, 
-    0xC1, 0xBF, 0x0A, 0x06, 0x11, 0xBC, 0x3A, 0x49, 0xC1, 0x39, 0x09, 0x24, 
-    0x0A, 0xD0, 0x21, 0x36, 0x48, 0x2C, 0x08, 0x31, 0x04, 0x06, 0x07, 0xD0, 
-    0x36, 0x49, 0xBD, 0xCE, 0x04, 0x04, 0x03, 0x07, 0x23, 0x29, 0x4A, 0x2A, 
-    0x01, 0x01, 0x01, 0x01, 0x1D, 0xCF, 0x2C, 0x2C, 0x01, 0x05, 0x01, 0x01, 
-    0x01, 0x0F, 0x1B, 0x1B, 0x01, 0x01, 0x01, 0x1C, 0x0F, 0x06, 0x38, 0xD1, 
-    0x04, 0x04, 0x06, 0x07, 0x11, 0x0D, 0x2F, 0x42, 0x08, 0x11, 0x11, 0x07, 
-    0x07, 0x10, 0x12, 0x10, 0x10, 0x21, 0x09, 0x0C, 0x04, 0x04, 0x06, 0x1E, 
-    0xBC, 0x2E, 0x1E, 0x06, 0x04, 0x04, 0x06, 0x2F, 0x09, 0x04, 0x0F, 0x06, 
-    0x06, 0x06, 0x06, 0x46, 0x08, 0x20, 0x24, 0x40, 0x24, 0x24, 0xBB, 0x34, 
-    0xBB, 0xB5, 0x1F, 0xAB, 0xAB, 0xAB, 0xBC, 0xBE, 0x41, 0x69, 0x82, 0x82, 
-    0x5B, 0x71, 0xC1, 0x81, 0x42, 0xCB, 0x58, 0x96, 0xB2, 0x44, 0x53, 0xCB, 
-    0xBE, 0x48, 0x48, 0x78, 0x2C, 0x2C, 0x48, 0x5C, 0x21, 0x37, 0x07, 0xBC, 
-    0x12, 0x1F, 0x29, 0x2E, 0x2C, 0x36, 0x1E, 0x19, 0xBC, 0x30, 0x36, 0x39, 
-    0x0C, 0x30, 0x36, 0x2D, 0x29, 0x2D, 0x4A, 0xCC, 0x2D, 0x39, 0x47, 0x47, 
-    0x48, 0x48, 0x43, 0x5B, 0x48, 0x81, 0x48, 0x2A, 0xCC, 0x62, 0x62, 0x62, 
-    0x59, 0x5F, 0x5E, 0x59, 0x59, 0x62, 0x62, 0x62, 0x5B, 0x5F, 0x5E, 0x62, 
-    0x62, 0x62, 0x62, 0x62, 0x53, 0xC4, 0x53, 0x78, 0x69, 0x5B, 0x62, 0x62, 
-    0x2D, 0x39, 0x36, 0x9A, 0x5B, 0x5B, 0x5E, 0x5F, 0x81, 0x48, 0xCC, 0x5E, 
-    0x5E, 0x5E, 0x5E, 0x5E, 0x79, 0x72, 0x65, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 
-    0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x59, 0x59, 0x79, 0x65, 
-    0x65, 0x65, 0x65, 0x65, 0x5B, 0x82, 0x5E, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 
-    0xCC, 0x3E, 0x55, 0x79, 0x72, 0x79, 0x79, 0x79, 0xCB, 0x60, 0xCB, 0x5F, 
-    0x5D, 0x79, 0x79, 0x79, 0x5F, 0x5E, 0x72, 0xCA, 0x63, 0xCA, 0x63, 0x5F, 
-    0x5E, 0x5E, 0x5E, 0x5D, 0x5D, 0x5D, 0x5F, 0x5D, 0xCA, 0xCA, 0x63, 0x5F, 
-    0x5F, 0x5F, 0x5F, 0x5F, 0x79, 0x79, 0x79, 0x5F, 0x5D, 0x5D, 0x5F, 0x5F, 
-    0x65, 0x65, 0x65, 0x63, 0x5D, 0x5B, 0x5E, 0x5F, 0x5B, 0x5D, 0x5E, 0x5E, 
-    0x5E, 0x5E, 0x5F, 0x5F, 0x79, 0x65, 0x72, 0x5E, 0x49, 0x6B, 0x5E, 0x5F, 
-    0x79, 0x79, 0x72, 0x5F, 0x5E, 0x5E, 0x5D, 0x5B, 0x5D, 0x65, 0x72, 0x5F, 
-    0x79, 0x63, 0x63, 0xCA, 0x5B, 0x5B, 0x5B, 0x5D, 0x5D, 0x72, 0x63, 0x63, 
-    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 0x5F, 0x5D, 0x5B, 
-    0x5E, 0x5E, 0x5B, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0x79, 0x79, 0x5D, 0x79, 
-    0x5D, 0x5E, 0x5D, 0x5D, 0x5D, 0x5E, 0x5D, 0x63, 0x79, 0x65, 0x65, 0x65, 
-    0x65, 0x65, 0x72, 0x5F, 0x5E, 0x79, 0x5F, 0x79, 0x79, 0x79, 0x63, 0x5F, 
-    0x72, 0x79, 0xCA, 0x65, 0x5E, 0xC8, 0xB2, 0x6B, 0x79, 0x5E, 0x5D, 0x5D, 
-    0x5E, 0x54, 0xAA, 0x7D, 0x5D, 0x5F, 0x5F, 0x5E, 0x4A, 0xC9, 0x88, 0x88, 
-    0x5D, 0x5D, 0x5F, 0x5D, 0x42, 0x9D, 0xC9, 0xC9, 0x5F, 0x5F, 0x5F, 0x5D, 
-    0x6B, 0x9D, 0x6E, 0x04, 0xCA, 0xCA, 0x5F, 0x5E, 0x8E, 0x91, 0x41, 0x1F, 
-    0x72, 0x79, 0x5F, 0x79, 0x8E, 0x91, 0x0F, 0x34, 0x5F, 0x5D, 0x79, 0x72, 
-    0x6B, 0x9C, 0x06, 0x04, 0xB2, 0x91, 0xCC, 0x6A, 0x60, 0x85, 0x90, 0xB4, 
-    0x7D, 0x2F, 0x60, 0x6A, 0x60, 0x85, 0x90, 0x90, 0x88, 0xB2, 0xAB, 0xC7, 
-    0x8C, 0x86, 0x89, 0xAA, 0xB2, 0x96, 0xB7, 0x9B, 0x69, 0x91, 0xBC, 0x1A, 
-    0x1D, 0x02, 0x41, 0xCC, 0xBD, 0x24, 0x04, 0x0B, 0x96, 0x1F, 0x96, 0x55, 
-    0xA5, 0xD1, 0x34, 0x20, 0x35, 0x37, 0x7D, 0x69, 0x82, 0x5C, 0x4D, 0xBB, 
-    0x01, 0x1A, 0x7C, 0x69, 0x62, 0x5B, 0x58, 0xA3, 0x0D, 0x38, 0x94, 0xBB, 
-    0x09, 0x9C, 0x69, 0x6A, 0x96, 0x0D, 0x03, 0x37, 0xCE, 0x94, 0xB2, 0x5B, 
-    0x41, 0xD0, 0x98, 0x7D, 0x7D, 0x7D, 0x96, 0xC9, 0x07, 0xBF, 0x39, 0xD1, 
-    0x94, 0x7D, 0x94, 0x98, 0x05, 0xB8, 0x29, 0x89, 0x91, 0x93, 0x7D, 0x7D, 
-    0xAF, 0xD2, 0x4E, 0x96, 0x89, 0x89, 0x92, 0x94, 0x09, 0x0B, 0x02, 0xBB, 
-    0x35, 0x7D, 0x7D, 0x03, 0x07, 0x01, 0x15, 0x0B, 0xBB, 0x1A, 0x1A, 0x05, 
-    0xC7, 0x79, 0x5D, 0x63, 0x63, 0x65, 0x65, 0x63, 0x63, 0x79, 0x5D, 0x65, 
-    0x63, 0x63, 0x63, 0x65, 0x7E, 0xCB, 0x5F, 0x5F, 0x5D, 0x5D, 0x5D, 0x5D, 
-    0x9D, 0xB4, 0x58, 0x62, 0x5F, 0x5F, 0x5F, 0x5F, 0x96, 0x93, 0x8A, 0x49, 
-    0x5E, 0x5D, 0x5D, 0x5D, 0x01, 0x93, 0x50, 0x89, 0x5E, 0x79, 0x79, 0x79, 
-    0x0B, 0x34, 0x4E, 0x35, 0x8C, 0x5F, 0x72, 0xCA, 0x05, 0xBB, 0x0B, 0x1A, 
-    0xAA, 0x60, 0x5B, 0x5F, 0x63, 0x79, 0x65, 0x63, 0x5F, 0x5F, 0xCB, 0x42, 
-    0x63, 0x5F, 0x5F, 0x5D, 0x5E, 0x5D, 0x5E, 0x62, 0x5D, 0x5F, 0x5D, 0x5F, 
-    0x72, 0x72, 0x72, 0x72, 0x5F, 0x5F, 0x5D, 0x72, 0xCA, 0xCA, 0xCA, 0xCA, 
-    0x5D, 0x5F, 0x5F, 0x5F, 0x5E, 0x5D, 0x5B, 0x5B, 0x72, 0x5F, 0x5E, 0x5D, 
-    0x5F, 0x5F, 0x79, 0x5F, 0xCA, 0x65, 0x65, 0x72, 0x5D, 0x5F, 0xCA, 0x65, 
-    0x72, 0x63, 0xCA, 0x72, 0x5E, 0x5F, 0x5F, 0x5F, 0x54, 0x47, 0x57, 0x78, 
-    0x49, 0x50, 0xA6, 0x6C, 0x5B, 0x62, 0x5A, 0x43, 0x81, 0x81, 0x6B, 0x48, 
-    0x65, 0x72, 0x5E, 0x5E, 0x5F, 0x79, 0x79, 0x72, 0xCA, 0x63, 0x5E, 0x5B, 
-    0x5D, 0x79, 0x5D, 0x5D, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x59, 0x59, 
-    0x5F, 0x5D, 0x72, 0xCA, 0x63, 0x65, 0x5E, 0x59, 0x5D, 0x5D, 0x5F, 0x72, 
-    0x5E, 0x5B, 0x5B, 0x62, 0x5F, 0x65, 0x5F, 0x5B, 0x59, 0x59, 0x62, 0x62, 
-    0x19, 0x36, 0xC3, 0x52, 0x4E, 0xB8, 0x33, 0xA6, 0x81, 0x80, 0x4A, 0x42, 
-    0x2A, 0x47, 0x47, 0x2A, 0x5B, 0x5E, 0x62, 0x59, 0x53, 0xC2, 0x59, 0xC1, 
-    0x5E, 0x5B, 0xCB, 0x55, 0x49, 0x48, 0x55, 0xC1, 0x59, 0x62, 0x5C, 0xC4, 
-    0xC1, 0x48, 0x2A, 0x59, 0x62, 0x62, 0x59, 0xC2, 0xC2, 0x53, 0xC4, 0xC4, 
-    0x62, 0x59, 0x5B, 0x5C, 0xC2, 0xC2, 0x5D, 0x5E, 0x5E, 0x5E, 0x59, 0x5C, 
-    0xC2, 0x5C, 0x5F, 0x5F, 0x19, 0x12, 0x07, 0x10, 0x0A, 0x10, 0x1F, 0x0F, 
-    0x2F, 0x98, 0x12, 0x19, 0x07, 0x19, 0x0C, 0x0A, 0x2A, 0xCB, 0x7E, 0xAC, 
-    0x08, 0x1B, 0x23, 0x1E, 0x48, 0x55, 0x2A, 0x3A, 0x3E, 0x3E, 0x39, 0x2D, 
-    0xC1, 0x4A, 0x2A, 0x48, 0x48, 0x2A, 0x2A, 0x3E, 0xC4, 0xC4, 0x59, 0x59, 
-    0x44, 0x44, 0x5A, 0x48, 0x5E, 0x5D, 0x5B, 0x59, 0x5C, 0x5C, 0xC2, 0xC1, 
-    0x5F, 0x79, 0x59, 0xC2, 0x59, 0xC2, 0xC2, 0x53, 0x04, 0x03, 0x03, 0x1C, 
-    0x40, 0x55, 0x53, 0x4B, 0x03, 0x01, 0x03, 0x0F, 0xBB, 0x3E, 0x3E, 0x70, 
-    0x06, 0x04, 0x04, 0x31, 0x07, 0x26, 0x2F, 0x07, 0x2D, 0x2E, 0x2D, 0x2D, 
-    0x2E, 0x49, 0x3A, 0x12, 0x42, 0x36, 0x29, 0x29, 0x36, 0x42, 0x4B, 0x39, 
-    0x2A, 0x3E, 0x3E, 0x3E, 0x3E, 0x3A, 0x3A, 0x3A, 0xC1, 0x44, 0x49, 0x49, 
-    0x44, 0x48, 0x2A, 0x2A, 0xC1, 0x2A, 0x2A, 0x2A, 0x2A, 0x42, 0x27, 0x39, 
-    0xCE, 0x04, 0x08, 0xCE, 0x12, 0x14, 0x1F, 0x09, 0xBC, 0x10, 0x10, 0x1F, 
-    0x16, 0x0D, 0x07, 0x03, 0x06, 0x0A, 0x03, 0x03, 0x02, 0x03, 0x01, 0x01, 
-    0x1E, 0xBF, 0xCE, 0xBF, 0xBF, 0x19, 0x09, 0x0F, 0x3A, 0x3A, 0x27, 0x36, 
-    0x2E, 0x21, 0x1E, 0x09, 0x27, 0x3A, 0x39, 0x36, 0x21, 0x10, 0x38, 0x14, 
-    0x2A, 0x42, 0x2D, 0x3E, 0x42, 0x36, 0x3A, 0x4B, 0x39, 0x3A, 0x3A, 0x29, 
-    0x36, 0x36, 0x39, 0x29, 0x03, 0x08, 0x06, 0x0B, 0x03, 0x03, 0x01, 0x03, 
-    0x08, 0xBC, 0x0F, 0x03, 0x08, 0x03, 0x01, 0x0B, 0x08, 0x19, 0x06, 0x01, 
-    0x04, 0x04, 0x01, 0x02, 0x03, 0x04, 0x17, 0x17, 0x20, 0x24, 0x19, 0x1E, 
-    0xB7, 0xB7, 0xB7, 0xB1, 0x2C, 0x27, 0x36, 0x2E, 0x10, 0x10, 0x10, 0xBE, 
-    0x48, 0x2A, 0x2D, 0x21, 0x2D, 0x50, 0x47, 0xC2, 0x4A, 0x2E, 0x1F, 0x07, 
-    0x10, 0x04, 0x3F, 0x3E, 0x2D, 0x21, 0x1F, 0x0F, 0x08, 0x08, 0x03, 0x05, 
-    0x1F, 0x2F, 0x19, 0x0F, 0x04, 0x04, 0x03, 0x15, 0x07, 0x08, 0x01, 0x01, 
-    0x05, 0x1A, 0x15, 0x0F, 0x06, 0x03, 0x0B, 0x03, 0x08, 0x19, 0xBC, 0x30, 
-    0x08, 0x01, 0x03, 0x03, 0xBC, 0x10, 0x1F, 0x12, 0x06, 0x0B, 0x03, 0x01, 
-    0x12, 0x04, 0x03, 0x01, 0x0B, 0x03, 0x0B, 0x09, 0x0A, 0x03, 0x0B, 0x03, 
-    0x03, 0x0B, 0x05, 0x1E, 0x0B, 0x0B, 0x03, 0x03, 0x01, 0x0B, 0x06, 0x14, 
-    0x04, 0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x0B, 0x02, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x0B, 0x03, 0x04, 
-    0x03, 0x03, 0x0B, 0x01, 0x04, 0x06, 0x01, 0x0A, 0x01, 0x01, 0x04, 0x08, 
-    0x04, 0x04, 0x0B, 0x03, 0x0F, 0x03, 0x07, 0x08, 0x03, 0x0B, 0x0A, 0x6E, 
-    0x09, 0x1D, 0x08, 0x03, 0x03, 0x0B, 0xD4, 0xA8, 0x06, 0x15, 0x05, 0x01, 
-    0x01, 0x04, 0x0A, 0x04, 0x03, 0x03, 0x03, 0x01, 0x08, 0x12, 0x14, 0x03, 
-    0x23, 0x16, 0x15, 0x02, 0x21, 0x1F, 0x19, 0x1C, 0x09, 0x09, 0x23, 0xBC, 
-    0x10, 0x03, 0x15, 0x03, 0x03, 0x08, 0x23, 0x09, 0x03, 0x01, 0x03, 0x03, 
-    0x06, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x04, 0x03, 0x03, 0x03, 
-    0x03, 0x01, 0x01, 0x05, 0xD5, 0x01, 0x0B, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x06, 0x0F, 0x06, 0x01, 0x0B, 0x17, 0x03, 0xAF, 0x01, 0x03, 0x0B, 0x0A, 
-    0x02, 0x03, 0x03, 0x03, 0x01, 0x01, 0x04, 0x06, 0x01, 0x03, 0x01, 0x01, 
-    0x03, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x1C, 0x08, 0x03, 0x05, 0x01, 0x04, 
-    0x03, 0x01, 0x07, 0x09, 0x0B, 0x05, 0x04, 0x06, 0x04, 0x06, 0x08, 0x01, 
-    0x01, 0x01, 0x04, 0x04, 0x0A, 0x04, 0x0B, 0x01, 0x05, 0x05, 0x03, 0x03, 
-    0x05, 0x05, 0x01, 0x04, 0x1C, 0x1B, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x04, 
-    0x36, 0x2F, 0x10, 0x19, 0x6D, 0x44, 0x3A, 0x3F, 0xB9, 0x1F, 0x19, 0x0C, 
-    0x30, 0x39, 0x2A, 0x3A, 0x0C, 0xBC, 0x21, 0x10, 0x10, 0x2D, 0x29, 0x7E, 
-    0x0B, 0x0C, 0x2E, 0x21, 0x6E, 0x21, 0x29, 0x4A, 0x03, 0xD5, 0x19, 0x12, 
-    0x08, 0x0C, 0x1F, 0x3E, 0x06, 0xB9, 0x0C, 0x2F, 0x39, 0x39, 0x36, 0x2E, 
-    0xA8, 0xA8, 0x6E, 0xD0, 0x1E, 0x1E, 0x12, 0x09, 0xA8, 0xD4, 0x03, 0x3B, 
-    0xBB, 0x0C, 0x0D, 0xD5, 0xBB, 0x0B, 0x01, 0x09, 0x19, 0x07, 0xA8, 0xA8, 
-    0xA6, 0x04, 0x03, 0x23, 0x1F, 0x38, 0xD4, 0xA8, 0xA5, 0xA3, 0x01, 0x1D, 
-    0xB8, 0xA9, 0xA7, 0xA8, 0x54, 0xA3, 0x1D, 0x04, 0x17, 0xA7, 0xA8, 0xA8, 
-    0x3E, 0x34, 0x40, 0x40, 0x1C, 0x4E, 0xA6, 0x40, 0x19, 0xA6, 0xA9, 0x9E, 
-    0xA8, 0xA7, 0xB7, 0xAE, 0x6E, 0xD4, 0x9E, 0x9E, 0x04, 0xAB, 0xC5, 0xA5, 
-    0x7A, 0xC5, 0x9E, 0xB1, 0x33, 0x10, 0x0C, 0x7B, 0x6E, 0xA8, 0xA8, 0x1F, 
-    0x12, 0x2E, 0x2A, 0x3A, 0x0D, 0x33, 0x1A, 0x1F, 0x2F, 0xBC, 0x2D, 0x36, 
-    0xD4, 0xD5, 0x02, 0x1F, 0x2F, 0x07, 0x16, 0x2D, 0x06, 0x01, 0x02, 0x1E, 
-    0x21, 0x06, 0x09, 0x21, 0x40, 0xB8, 0x1D, 0x04, 0x31, 0x09, 0x2E, 0x36, 
-    0xA2, 0xB1, 0x9C, 0x19, 0x03, 0x07, 0x1F, 0x2F, 0x82, 0xAD, 0xA2, 0xB3, 
-    0x08, 0x0F, 0x0A, 0x08, 0xCC, 0xCB, 0x69, 0xA3, 0xD0, 0x09, 0x03, 0x03, 
-    0x19, 0x19, 0x29, 0x48, 0xC2, 0x48, 0x39, 0x6D, 0x37, 0x3B, 0x23, 0x39, 
-    0xC1, 0x48, 0x2A, 0x71, 0xBE, 0x1F, 0x3B, 0x2E, 0xC2, 0x2A, 0x3A, 0xC1, 
-    0xBE, 0x1F, 0x0C, 0xBC, 0x78, 0x47, 0x29, 0xC1, 0x37, 0x31, 0x09, 0x3B, 
-    0x09, 0x3A, 0x2E, 0x48, 0x37, 0x02, 0x04, 0x04, 0x1C, 0x37, 0x10, 0x2E, 
-    0x03, 0x03, 0x03, 0x06, 0x08, 0x04, 0x1D, 0x12, 0x05, 0x05, 0x01, 0x01, 
-    0x03, 0x05, 0xD2, 0x0F, 0x1F, 0xBB, 0x0C, 0x08, 0x08, 0x10, 0x10, 0x10, 
-    0x42, 0x21, 0x2C, 0xBD, 0xBD, 0xBD, 0x30, 0x04, 0x3E, 0x2F, 0x39, 0x3A, 
-    0x3A, 0x42, 0x39, 0x2E, 0x2C, 0x24, 0x04, 0x08, 0x08, 0x19, 0x2D, 0x2A, 
-    0x4D, 0x1A, 0x0D, 0x0C, 0x31, 0x19, 0x2F, 0xC9, 0x2F, 0x0C, 0x08, 0x0D, 
-    0x10, 0x12, 0xBC, 0x30, 0x21, 0x16, 0x06, 0x0F, 0x09, 0x11, 0x1B, 0xBC, 
-    0x08, 0x0A, 0x02, 0xBB, 0xBB, 0x3B, 0xBB, 0xA3, 0xBE, 0x42, 0x48, 0x49, 
-    0x7E, 0x70, 0x3A, 0x48, 0x09, 0x1E, 0x52, 0x2D, 0x3A, 0x2F, 0x30, 0x2F, 
-    0x2F, 0x08, 0x12, 0x30, 0x29, 0x2F, 0x1F, 0x1F, 0x2A, 0x1F, 0x39, 0x3A, 
-    0x3F, 0x83, 0x2C, 0x3A, 0x3E, 0x3E, 0x3A, 0x39, 0x2D, 0x3E, 0x49, 0x48, 
-    0x21, 0x36, 0x3E, 0x4A, 0x47, 0xC2, 0xC1, 0x49, 0x1F, 0x2F, 0x2F, 0x3E, 
-    0x49, 0x49, 0x5A, 0x49, 0x58, 0x5F, 0x5D, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 
-    0x48, 0x49, 0x5B, 0x5B, 0x5B, 0x62, 0x62, 0x62, 0x2D, 0x47, 0x54, 0xA5, 
-    0x58, 0x59, 0x59, 0x5C, 0x2D, 0x39, 0x9A, 0x3E, 0x48, 0xC4, 0xC2, 0xC4, 
-    0x4A, 0x49, 0xC2, 0x53, 0x53, 0x5C, 0x53, 0xC2, 0x47, 0x49, 0x53, 0xC2, 
-    0x5C, 0x5B, 0x59, 0xC2, 0xC2, 0x48, 0xC1, 0x53, 0xC2, 0xC4, 0xC4, 0xC4, 
-    0x44, 0x2A, 0x48, 0x5A, 0x5A, 0x5A, 0x62, 0x5E, 0x79, 0x79, 0x5F, 0x59, 
-    0xC2, 0xC2, 0x5B, 0x79, 0x5D, 0x5D, 0x5C, 0xC4, 0xC4, 0x5C, 0x5B, 0x59, 
-    0x5D, 0x65, 0x5F, 0x59, 0xC2, 0xC4, 0xCC, 0x47, 0x5C, 0x5E, 0x5E, 0x5B, 
-    0x65, 0x79, 0xCB, 0x80, 0xC2, 0xC4, 0xC4, 0x53, 0x5B, 0x5E, 0x5B, 0x71, 
-    0xC2, 0xC2, 0xC2, 0xC4, 0x44, 0x5B, 0x5E, 0x79, 0xC2, 0x5C, 0x53, 0x59, 
-    0x53, 0x5C, 0xC2, 0x79, 0x59, 0x59, 0x59, 0x5B, 0x53, 0xC2, 0xC2, 0x59, 
-    0x79, 0x62, 0x62, 0x62, 0x59, 0x62, 0x62, 0x53, 0x5B, 0x5E, 0x5E, 0x5E, 
-    0x5F, 0x5D, 0x5D, 0x5F, 0x9A, 0x27, 0x3A, 0x27, 0x5B, 0x5E, 0x5E, 0x65, 
-    0x80, 0x80, 0x80, 0x80, 0x5B, 0x5F, 0x5F, 0x5D, 0x53, 0x53, 0x53, 0x53, 
-    0x53, 0x5C, 0x53, 0x5C, 0x5B, 0xC4, 0x5C, 0x53, 0xC2, 0xC2, 0xC2, 0x53, 
-    0x5E, 0xC4, 0x5C, 0xC2, 0xC2, 0x53, 0xC2, 0x26, 0x62, 0x5E, 0x5E, 0x5E, 
-    0x59, 0x55, 0xC0, 0xBB, 0x5C, 0x5B, 0x69, 0x69, 0x3E, 0x2F, 0x24, 0x0B, 
-    0x65, 0x65, 0x5D, 0x5D, 0x5E, 0x65, 0xCA, 0x65, 0x65, 0x65, 0x5F, 0x5F, 
-    0x5F, 0x72, 0x72, 0x5B, 0x5D, 0x5D, 0x5F, 0x5D, 0x5B, 0x62, 0x5B, 0x59, 
-    0x5B, 0x2B, 0x2B, 0x60, 0xCA, 0xCA, 0x5B, 0xC2, 0x58, 0x52, 0x52, 0xAB, 
-    0xA0, 0x72, 0x5B, 0x59, 0x7D, 0xD0, 0x1F, 0x6C, 0x93, 0x67, 0x5D, 0x62, 
-    0xCD, 0x04, 0x16, 0x70, 0x55, 0x5F, 0x5B, 0x5E, 0x08, 0x0C, 0x9C, 0x78, 
-    0x71, 0x62, 0x62, 0x62, 0x64, 0xC6, 0x5D, 0x82, 0x99, 0xAC, 0x2D, 0x21, 
-    0x5F, 0xCA, 0x5D, 0xC1, 0x89, 0x98, 0x2F, 0xAA, 0x62, 0x5F, 0x5D, 0x6B, 
-    0x8A, 0xC3, 0x41, 0x7D, 0x59, 0x5B, 0x5B, 0x81, 0x91, 0xD1, 0x35, 0x7D, 
-    0x53, 0x65, 0x79, 0xB4, 0x91, 0x50, 0x7D, 0x7D, 0x5F, 0xCA, 0x65, 0xAA, 
-    0x93, 0x96, 0x94, 0x7D, 0xCA, 0xCA, 0x67, 0x9C, 0xC9, 0x96, 0xAA, 0x7D, 
-    0x5E, 0x5F, 0x60, 0xAC, 0x19, 0xB2, 0x89, 0x89, 0x41, 0x1D, 0x9C, 0x60, 
-    0x5F, 0x5D, 0x62, 0x88, 0xBC, 0x14, 0xA3, 0xA5, 0x5D, 0x65, 0x72, 0x5F, 
-    0x41, 0x41, 0x37, 0xB2, 0x5E, 0x72, 0x79, 0x72, 0x7C, 0x7D, 0x98, 0x92, 
-    0x5E, 0x5F, 0x5F, 0x5F, 0x41, 0x41, 0xCE, 0x87, 0x79, 0xCA, 0x65, 0x63, 
-    0x41, 0x7D, 0xD1, 0xA6, 0x60, 0x63, 0x5E, 0x5B, 0x7D, 0x41, 0x1E, 0x24, 
-    0x2B, 0x5F, 0x62, 0x62, 0x89, 0x50, 0xBF, 0x40, 0x2B, 0x5C, 0xC1, 0x59, 
-    0xD1, 0x0D, 0x08, 0x04, 0x0B, 0x0B, 0x0B, 0x01, 0x58, 0xAC, 0x12, 0x09, 
-    0x0B, 0x05, 0x01, 0x01, 0x5E, 0x2C, 0xBC, 0x19, 0x03, 0x01, 0x01, 0x05, 
-    0x5D, 0x48, 0x39, 0xBC, 0x09, 0x1B, 0x03, 0x01, 0x5E, 0x59, 0x7E, 0x19, 
-    0x07, 0x06, 0x07, 0x03, 0x59, 0x71, 0x54, 0xB3, 0x14, 0x04, 0x08, 0x06, 
-    0x62, 0x59, 0x59, 0x80, 0x7D, 0x0C, 0x04, 0x06, 0x5B, 0x5E, 0x59, 0x5B, 
-    0x78, 0x52, 0x19, 0x04, 0x01, 0x01, 0x03, 0xBB, 0xAA, 0x60, 0x72, 0xCA, 
-    0x01, 0x01, 0x0B, 0xBB, 0x94, 0x69, 0x5F, 0x79, 0x01, 0x01, 0x01, 0x05, 
-    0x03, 0x7D, 0x9A, 0x59, 0x01, 0x01, 0x05, 0x01, 0x05, 0x1A, 0x1A, 0x7B, 
-    0x05, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x05, 0x83, 0x03, 0x01, 0x05, 0x01, 
-    0x01, 0x01, 0x01, 0x15, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x04, 0x03, 0x05, 0x01, 0x01, 0x01, 0x05, 0xCA, 0x72, 0x79, 0x79, 
-    0x79, 0x5F, 0x5E, 0x5B, 0xCA, 0x65, 0x79, 0x79, 0x72, 0x5B, 0x62, 0x5B, 
-    0x5C, 0x59, 0x59, 0xC4, 0xC2, 0xC4, 0xC2, 0x5B, 0xCC, 0xCC, 0x59, 0x5C, 
-    0xC2, 0xC2, 0xC2, 0x62, 0x12, 0x50, 0x69, 0x2B, 0x59, 0x53, 0x5C, 0x72, 
-    0x34, 0x1F, 0x2E, 0xC3, 0x54, 0xC1, 0xC1, 0xCC, 0x1A, 0x03, 0x08, 0x08, 
-    0x7C, 0x94, 0x35, 0x6D, 0x01, 0x01, 0x20, 0x15, 0xBB, 0xBB, 0x40, 0xBF, 
-    0x5F, 0x5D, 0x5E, 0x5E, 0x5E, 0x5B, 0x62, 0x59, 0x72, 0x72, 0x63, 0xC6, 
-    0x63, 0x5E, 0x62, 0x5E, 0x79, 0x72, 0x5F, 0x62, 0x59, 0x5C, 0x5F, 0x5F, 
-    0x5E, 0x5B, 0x5B, 0x5C, 0x5C, 0x53, 0x5C, 0x53, 0x63, 0x63, 0x63, 0x5E, 
-    0xC4, 0xC4, 0xC4, 0xC2, 0x59, 0x59, 0x59, 0xC4, 0x62, 0x5B, 0x5B, 0x53, 
-    0x71, 0xC2, 0x5C, 0xC2, 0x5B, 0x5E, 0x62, 0xC2, 0x26, 0x2D, 0x58, 0x71, 
-    0x82, 0x5F, 0x5C, 0xC4, 0x62, 0x5C, 0xC2, 0x53, 0x53, 0x53, 0xC2, 0xC4, 
-    0x5B, 0x62, 0x5B, 0x5E, 0x5E, 0x5E, 0x5E, 0x5B, 0x5F, 0x5E, 0x5B, 0x5B, 
-    0x5B, 0x5B, 0x5B, 0x5B, 0x53, 0xC2, 0xC2, 0x5C, 0x5C, 0x5C, 0x53, 0x53, 
-    0xC2, 0x59, 0x62, 0x5E, 0x5D, 0x5B, 0x59, 0x59, 0xC2, 0x5C, 0x5C, 0x5C, 
-    0x5C, 0xC1, 0x61, 0x44, 0x59, 0x62, 0x62, 0x5C, 0xC2, 0xC2, 0x43, 0x43, 
-    0x5E, 0x65, 0x65, 0x5D, 0x59, 0x5B, 0x5E, 0x5E, 0xC4, 0xC4, 0xC2, 0xC2, 
-    0xC2, 0xC2, 0xC2, 0xC2, 0x59, 0x5C, 0xC2, 0xC2, 0x5C, 0x5C, 0x53, 0xC2, 
-    0x5C, 0x5C, 0xC2, 0x5C, 0x5F, 0x5B, 0x53, 0xC2, 0x53, 0xC2, 0x53, 0xC2, 
-    0x55, 0x5A, 0x49, 0x49, 0x5C, 0xC1, 0xC1, 0xC1, 0x49, 0x49, 0x49, 0x61, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x48, 0x48, 0xCC, 0x82, 0x48, 0x4A, 0x48, 0x48, 
-    0x49, 0x48, 0x55, 0xCC, 0x59, 0xC2, 0x53, 0x53, 0x53, 0xC1, 0x49, 0x42, 
-    0x5C, 0x59, 0x59, 0x53, 0x48, 0x48, 0x48, 0x4B, 0xC2, 0xC4, 0xC4, 0x49, 
-    0x5A, 0xC1, 0x44, 0x49, 0x5C, 0x59, 0xCB, 0x48, 0xC1, 0x53, 0xC2, 0x53, 
-    0xC1, 0x5C, 0x53, 0xC1, 0x48, 0x48, 0x48, 0x48, 0x44, 0xC4, 0xC2, 0xC2, 
-    0x59, 0x59, 0xC2, 0x53, 0x5B, 0x5B, 0x59, 0xC1, 0x55, 0xCC, 0x44, 0x44, 
-    0x69, 0x69, 0x5C, 0xC1, 0xCC, 0x43, 0x5C, 0x5A, 0x47, 0x81, 0xC1, 0xC2, 
-    0x59, 0x5C, 0x53, 0xC1, 0x47, 0x4A, 0x39, 0x36, 0x39, 0x2F, 0x70, 0x10, 
-    0xC1, 0x49, 0x2A, 0x47, 0x48, 0x2A, 0x48, 0x39, 0xC1, 0x44, 0xC2, 0x49, 
-    0x5A, 0x49, 0x49, 0x27, 0x2A, 0x4A, 0x4A, 0x2A, 0x27, 0x39, 0x36, 0x4B, 
-    0x5A, 0x48, 0x49, 0x48, 0x2A, 0x2A, 0x2A, 0x2A, 0xC1, 0xC1, 0xC1, 0x53, 
-    0x53, 0x53, 0x53, 0x53, 0x5A, 0xC1, 0xC1, 0x49, 0x5A, 0x49, 0xC1, 0xC2, 
-    0x5A, 0xC2, 0xC1, 0x48, 0x49, 0x49, 0x44, 0xC2, 0x23, 0xCD, 0x12, 0x52, 
-    0x0C, 0x04, 0x46, 0xBB, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1F, 0x21, 0xBE, 
-    0x2E, 0x36, 0x36, 0x36, 0x36, 0x36, 0x39, 0x39, 0x39, 0x4B, 0x4B, 0x4B, 
-    0x39, 0x29, 0x2D, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x4A, 0x2A, 0x42, 
-    0x53, 0x53, 0x53, 0x53, 0x53, 0xC2, 0x44, 0x2A, 0xC2, 0xC2, 0xC2, 0xC2, 
-    0xC2, 0x53, 0x5A, 0x2A, 0xC2, 0xC2, 0xC2, 0xC2, 0x53, 0x53, 0xC2, 0xC1, 
-    0x02, 0x04, 0x03, 0x17, 0x08, 0x07, 0x10, 0x04, 0x10, 0x1A, 0xD2, 0x04, 
-    0x01, 0x05, 0x03, 0x03, 0x2E, 0xCE, 0xBF, 0xBC, 0x09, 0x09, 0x0F, 0x03, 
-    0x3A, 0x3A, 0x3A, 0x3A, 0x39, 0x39, 0x30, 0xBB, 0x2D, 0x29, 0x29, 0x36, 
-    0x36, 0x36, 0x2F, 0x1E, 0x39, 0x3E, 0x3A, 0x36, 0x36, 0x36, 0x3A, 0x3A, 
-    0x48, 0x49, 0x3E, 0xBC, 0xBC, 0xBC, 0x1F, 0xBE, 0xC1, 0x53, 0xC1, 0x2A, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x01, 0x03, 0x04, 0x01, 0x05, 0x05, 0x08, 0x10, 
-    0x01, 0x03, 0x04, 0x01, 0x03, 0x0B, 0x03, 0x04, 0x0B, 0x04, 0x03, 0x01, 
-    0x0A, 0x03, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x01, 0x01, 0x0A, 0xA8, 0x04, 
-    0x09, 0x06, 0x06, 0x04, 0x0B, 0xA8, 0xA8, 0xA8, 0x2E, 0x16, 0x08, 0x04, 
-    0x01, 0xD4, 0x31, 0xA8, 0x1F, 0x12, 0x1B, 0x09, 0x09, 0x1B, 0xAF, 0x1A, 
-    0x42, 0x2F, 0x2A, 0x2A, 0x48, 0x2A, 0x2F, 0x2F, 0x10, 0x23, 0x04, 0x01, 
-    0x06, 0x23, 0x08, 0x3B, 0x04, 0x03, 0x01, 0x0B, 0x01, 0x01, 0x1D, 0xA8, 
-    0x01, 0x01, 0x03, 0x0B, 0x01, 0x05, 0xD5, 0x02, 0x04, 0x06, 0x04, 0x06, 
-    0x0A, 0x03, 0x03, 0xD5, 0xD4, 0x06, 0x03, 0x05, 0x02, 0x01, 0x05, 0x01, 
-    0xA8, 0x0A, 0x0B, 0x1B, 0x0F, 0x03, 0x01, 0x05, 0x1D, 0x04, 0x0A, 0x10, 
-    0x11, 0x04, 0x01, 0x01, 0x1F, 0x03, 0x03, 0x17, 0x03, 0x03, 0x03, 0x01, 
-    0x31, 0x07, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0xA8, 0x0B, 0x03, 0x03, 
-    0x04, 0x04, 0x04, 0x05, 0xA8, 0xB9, 0x9F, 0x0B, 0x04, 0x03, 0x1B, 0x09, 
-    0xA8, 0xA8, 0xA8, 0xD4, 0x0B, 0xD2, 0xCE, 0x1E, 0xAF, 0x02, 0xA8, 0x1D, 
-    0x0B, 0xBB, 0xCE, 0xD1, 0x05, 0x01, 0x17, 0x04, 0x04, 0x04, 0x12, 0xD1, 
-    0x01, 0x0B, 0x04, 0x06, 0x04, 0x06, 0x08, 0x08, 0x0B, 0x03, 0x03, 0x01, 
-    0x01, 0x01, 0x05, 0x05, 0xA8, 0xA8, 0xA8, 0xA8, 0x17, 0x08, 0x0F, 0xD4, 
-    0x0A, 0xA8, 0x31, 0xA8, 0x01, 0x01, 0x40, 0xA7, 0xD4, 0xD4, 0x0B, 0x0A, 
-    0x03, 0x03, 0x01, 0x6E, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x0B, 0x01, 0x01, 
-    0xD5, 0xD5, 0x01, 0x05, 0x05, 0x05, 0x05, 0x01, 0xA8, 0xA8, 0x1D, 0xAF, 
-    0x01, 0x03, 0x03, 0x9F, 0x0A, 0x0A, 0x03, 0x0A, 0xA6, 0xA9, 0xA9, 0xD4, 
-    0xD5, 0xAF, 0x03, 0x04, 0xA6, 0xA9, 0x9E, 0x9E, 0xA7, 0xC5, 0xC5, 0xA8, 
-    0x0B, 0x04, 0x04, 0xB7, 0x9E, 0x9E, 0xA8, 0x02, 0x01, 0xAF, 0x0A, 0xA8, 
-    0xA7, 0xA7, 0x0A, 0xAF, 0xD5, 0xA8, 0xA8, 0xA8, 0xD5, 0xAF, 0x05, 0x05, 
-    0xD5, 0xA8, 0xB9, 0xC5, 0x02, 0x01, 0x0B, 0x33, 0x0B, 0xD4, 0x6E, 0xA7, 
-    0xAF, 0xD4, 0xA8, 0xB7, 0xD4, 0xAF, 0x06, 0x6C, 0xD4, 0xB9, 0xA7, 0xAB, 
-    0x07, 0x0A, 0x06, 0x0D, 0xA7, 0x24, 0xD3, 0x55, 0x14, 0x6E, 0x06, 0x0F, 
-    0xAB, 0x96, 0x94, 0x6E, 0xD2, 0x04, 0x06, 0x34, 0xB1, 0xB7, 0xCE, 0x1E, 
-    0x1E, 0x1E, 0x1F, 0x36, 0xA9, 0x9E, 0xAB, 0x52, 0xBC, 0x2E, 0x39, 0x39, 
-    0xA9, 0xA6, 0x08, 0x0D, 0x0C, 0x2F, 0x39, 0x4B, 0xA7, 0xD5, 0x20, 0x1D, 
-    0xB9, 0x11, 0x14, 0x2E, 0x06, 0x09, 0xAB, 0xAB, 0xAB, 0x11, 0x07, 0x2F, 
-    0x0C, 0x11, 0x70, 0xA2, 0xA1, 0xBE, 0x2E, 0x39, 0xA8, 0xB7, 0xB7, 0xA9, 
-    0xA9, 0x16, 0x2F, 0x39, 0x37, 0x1C, 0x04, 0x04, 0x1C, 0x37, 0x37, 0x34, 
-    0x29, 0x2E, 0x2D, 0x2D, 0x2E, 0x2D, 0x36, 0x39, 0x36, 0x36, 0x48, 0x47, 
-    0x4B, 0x3A, 0x3E, 0x48, 0x39, 0x3A, 0x42, 0x3E, 0x48, 0x3E, 0x3A, 0x42, 
-    0x39, 0x3A, 0x29, 0x42, 0x49, 0x3E, 0x3A, 0x3A, 0x47, 0xC1, 0x48, 0x49, 
-    0x49, 0x3A, 0x3A, 0x3A, 0x39, 0x3A, 0x3A, 0x3A, 0x27, 0x3A, 0x3A, 0x3A, 
-    0x36, 0x2E, 0x2E, 0x2E, 0x36, 0x27, 0x3A, 0x3A, 0x35, 0xD0, 0xCE, 0xBF, 
-    0xBF, 0xD1, 0x7B, 0x2C, 0x39, 0x39, 0x39, 0x42, 0x48, 0x48, 0xC1, 0xC2, 
-    0x3E, 0x2A, 0x2A, 0x48, 0xC2, 0xC2, 0xC4, 0xC4, 0x3E, 0x44, 0xC2, 0xC2, 
-    0x53, 0x5C, 0x59, 0x62, 0x3A, 0x4A, 0x48, 0x44, 0x43, 0xCC, 0x5B, 0x5B, 
-    0x3A, 0x3A, 0x3A, 0x3A, 0x4A, 0xC2, 0x81, 0x9A, 0x3A, 0x42, 0x48, 0x48, 
-    0x49, 0x53, 0x5A, 0x49, 0x3A, 0x42, 0x48, 0xC1, 0x53, 0xC2, 0xC2, 0x53, 
-    0x69, 0x5D, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5E, 0xC2, 0x5C, 0xC4, 0xC4, 
-    0xC4, 0xC4, 0x5C, 0x5C, 0xC4, 0xC2, 0xC2, 0x59, 0x5B, 0x59, 0x5D, 0x65, 
-    0x59, 0x53, 0xC2, 0xC4, 0xC4, 0xC4, 0xC4, 0xC2, 0x62, 0x53, 0xC2, 0x5B, 
-    0x5B, 0x5B, 0x59, 0xC2, 0x44, 0xC2, 0x53, 0x5B, 0x5B, 0x5B, 0x5C, 0x53, 
-    0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x53, 0xC2, 0x5A, 0xC2, 0xC1, 0xC2, 0x53, 
-    0xC2, 0x5A, 0x48, 0xB3, 0x79, 0x67, 0x5B, 0x53, 0xC2, 0xC2, 0x59, 0x5F, 
-    0x53, 0x53, 0x5C, 0x59, 0x59, 0x59, 0x59, 0x59, 0x65, 0x65, 0x65, 0x65, 
-    0x65, 0x65, 0x65, 0x79, 0xC2, 0xC2, 0xC2, 0xC2, 0xC1, 0x53, 0x49, 0x3A, 
-    0xC2, 0x59, 0x59, 0x71, 0x80, 0x2C, 0x30, 0x6E, 0x53, 0x80, 0x80, 0x80, 
-    0x3A, 0x52, 0x09, 0x17, 0x80, 0x2F, 0xD1, 0x21, 0x10, 0x17, 0xD5, 0x15, 
-    0xBC, 0x30, 0x1E, 0x09, 0x0F, 0x05, 0x05, 0x01, 0x79, 0x62, 0x59, 0x59, 
-    0x5B, 0x82, 0x71, 0x42, 0x59, 0x62, 0x62, 0x5C, 0xA5, 0xAD, 0xAD, 0xD5, 
-    0xA5, 0x3F, 0x26, 0x2C, 0x52, 0xD1, 0x4E, 0xBB, 0x2F, 0x52, 0x1E, 0x19, 
-    0x01, 0x17, 0x17, 0x01, 0x19, 0x1C, 0x04, 0x03, 0x01, 0x05, 0x01, 0x01, 
-    0x05, 0x20, 0x15, 0x15, 0x05, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x4D, 0x2F, 0x24, 0x40, 0x40, 0x40, 0x01, 0x0B, 0x40, 0xBB, 0x17, 0x17, 
-    0x03, 0x04, 0x04, 0x0F, 0x17, 0xD5, 0x05, 0x05, 0x05, 0x01, 0x04, 0x46, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x08, 0x41, 0x01, 0x01, 0x01, 0x05, 
-    0x03, 0x0D, 0x24, 0x54, 0x01, 0x01, 0x01, 0x01, 0x08, 0x6C, 0x9A, 0xC1, 
-    0x05, 0x0B, 0x06, 0x0D, 0x24, 0xAD, 0x5B, 0x5B, 0x05, 0x03, 0x06, 0x07, 
-    0xC3, 0x60, 0x5F, 0x5B, 0x06, 0x7A, 0xA5, 0x65, 0x65, 0x79, 0x5F, 0x65, 
-    0x3B, 0x2F, 0x5C, 0x5E, 0x5E, 0x5B, 0x5B, 0x5F, 0x70, 0x6B, 0x61, 0x8E, 
-    0x8E, 0x48, 0xC1, 0x44, 0x2B, 0x5D, 0x5E, 0x5F, 0x5B, 0x2A, 0x78, 0x2A, 
-    0x5D, 0x79, 0x79, 0x72, 0x5E, 0x53, 0x53, 0x53, 0xC4, 0x61, 0x61, 0x44, 
-    0xC4, 0xC2, 0xC2, 0xC2, 0x5B, 0x55, 0x49, 0x49, 0xC1, 0x53, 0xC2, 0xC2, 
-    0x5B, 0x5C, 0x53, 0x53, 0x53, 0xC2, 0xC2, 0xC2, 0x65, 0x5F, 0x5E, 0xAC, 
-    0xBB, 0x09, 0xD1, 0x96, 0x79, 0x5F, 0x60, 0xA3, 0x01, 0x20, 0x1A, 0x1A, 
-    0xC2, 0x5C, 0xC2, 0xBD, 0x24, 0x17, 0x0B, 0x0B, 0x49, 0x44, 0x3A, 0x1E, 
-    0xBB, 0x0B, 0x01, 0x01, 0x5A, 0x2A, 0x1F, 0x06, 0x04, 0x03, 0x01, 0x01, 
-    0xC2, 0xC2, 0x2A, 0x1B, 0x0A, 0x03, 0x05, 0x05, 0xC2, 0x53, 0x26, 0x0A, 
-    0x03, 0x01, 0x05, 0x01, 0xC2, 0x59, 0x10, 0x1A, 0x04, 0x01, 0x05, 0x01, 
-    0xBF, 0x7C, 0x05, 0x24, 0x69, 0x71, 0x59, 0x59, 0x1A, 0xBB, 0xD5, 0x24, 
-    0x5A, 0x61, 0x5A, 0x62, 0x0B, 0x0B, 0x01, 0x24, 0x5A, 0xC2, 0x43, 0x5B, 
-    0x01, 0x01, 0x05, 0xBB, 0xC3, 0x49, 0xC2, 0xC1, 0x01, 0x05, 0x01, 0x01, 
-    0x40, 0x47, 0xC2, 0xC1, 0x01, 0x0B, 0x01, 0x03, 0x33, 0x2A, 0xC2, 0xC4, 
-    0x01, 0x0B, 0x03, 0x04, 0x0B, 0x48, 0x5B, 0x5E, 0x01, 0x01, 0x01, 0x03, 
-    0x4E, 0x48, 0x5E, 0x72, 0x5B, 0x5B, 0x62, 0x59, 0xCC, 0x2E, 0x1E, 0x07, 
-    0x62, 0x59, 0x62, 0x59, 0x59, 0x43, 0x29, 0x23, 0x5D, 0x65, 0x65, 0x65, 
-    0x63, 0x72, 0x80, 0x7D, 0x53, 0x59, 0x59, 0x59, 0x59, 0x5C, 0x5B, 0x6D, 
-    0x53, 0x59, 0x53, 0xC2, 0xC2, 0xC4, 0xCB, 0x80, 0xC4, 0x53, 0xC2, 0xC4, 
-    0xC2, 0xC2, 0xC1, 0xC1, 0x62, 0x62, 0x5E, 0x62, 0x53, 0xC2, 0x53, 0xC2, 
-    0x72, 0x72, 0x72, 0x72, 0x62, 0xC2, 0xC2, 0xC1, 0x0A, 0x01, 0x01, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x1B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x11, 0x06, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x83, 0x10, 0x1B, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x2F, 0x06, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 
-    0x2A, 0x1F, 0x1E, 0x1B, 0x02, 0x01, 0x05, 0x01, 0x53, 0x2A, 0x70, 0x16, 
-    0x0D, 0x06, 0x03, 0x03, 0xC1, 0x5A, 0xBD, 0x12, 0x0F, 0x03, 0x04, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x1A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x05, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x0B, 0x03, 
-    0x03, 0x05, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x03, 0x01, 0x01, 0x01, 
-    0x03, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x01, 0x01, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x46, 0x09, 0x4D, 0x6D, 0xA5, 0x69, 0x5C, 0x53, 
-    0x03, 0x01, 0x24, 0xBB, 0xA3, 0x41, 0x3A, 0x7E, 0x05, 0x05, 0x0B, 0x33, 
-    0x17, 0x09, 0x21, 0x2E, 0x01, 0x01, 0x01, 0x05, 0x05, 0x03, 0x08, 0x09, 
-    0x05, 0x05, 0x01, 0x01, 0x01, 0x05, 0x20, 0x20, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 
-    0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x53, 0x53, 0x61, 0x44, 
-    0x49, 0xC1, 0x44, 0x44, 0x6D, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 
-    0xB3, 0x2A, 0x5A, 0x48, 0x48, 0x49, 0x48, 0x42, 0x06, 0xCE, 0xB3, 0xBC, 
-    0x39, 0x49, 0x48, 0x4A, 0x1A, 0x37, 0xD1, 0xBF, 0xD1, 0xD1, 0x2E, 0x42, 
-    0x01, 0xD2, 0x1A, 0x1A, 0x1A, 0x1E, 0x2F, 0x2F, 0x05, 0x01, 0x0B, 0x0B, 
-    0x0B, 0x33, 0x0B, 0x20, 0x01, 0x01, 0x01, 0x01, 0x05, 0x15, 0x05, 0x01, 
-    0xC1, 0x44, 0x44, 0x44, 0x49, 0x47, 0x2A, 0x48, 0x47, 0x2E, 0x36, 0x47, 
-    0x3E, 0x48, 0xC2, 0xC1, 0x2A, 0x3E, 0x42, 0x61, 0xC4, 0xC4, 0xC4, 0xC4, 
-    0x48, 0xC1, 0xC1, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0xC2, 0xC2, 0x5E, 
-    0x5E, 0x5E, 0x5E, 0x5E, 0x3E, 0x48, 0x78, 0x2A, 0xC1, 0x5A, 0xC1, 0xC1, 
-    0x9F, 0xB8, 0x09, 0x3A, 0x48, 0x2A, 0x2A, 0x44, 0x01, 0x1D, 0xD0, 0xD0, 
-    0x37, 0x52, 0x29, 0x4B, 0xC1, 0x53, 0xC2, 0xC2, 0x5C, 0xC2, 0xC4, 0xC2, 
-    0xC1, 0xC2, 0xC2, 0xC2, 0x5C, 0x59, 0x59, 0x59, 0x5C, 0x59, 0x59, 0x62, 
-    0x5E, 0x5E, 0x5E, 0x5E, 0x59, 0x59, 0x5C, 0xC2, 0xC2, 0x53, 0x49, 0x49, 
-    0x5E, 0x5E, 0x62, 0xC2, 0xC1, 0xC1, 0x48, 0x48, 0x49, 0x48, 0x55, 0x5A, 
-    0x48, 0x42, 0x49, 0x48, 0xC1, 0xC2, 0xC2, 0x53, 0x53, 0xC2, 0xC2, 0xC2, 
-    0x47, 0x49, 0x5A, 0x49, 0x49, 0x49, 0xC1, 0xC1, 0xC2, 0xC2, 0x44, 0xC1, 
-    0xC1, 0x44, 0x48, 0x2A, 0x59, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5A, 0x4A, 
-    0x5E, 0xCB, 0x48, 0x48, 0x49, 0x48, 0xC1, 0x49, 0x44, 0x49, 0x49, 0xC1, 
-    0x53, 0xC2, 0xC2, 0xC1, 0x48, 0x48, 0x49, 0xC1, 0x44, 0xC1, 0x53, 0x53, 
-    0x42, 0x3A, 0x47, 0x49, 0x49, 0x49, 0x49, 0x48, 0x49, 0x48, 0xC1, 0xC1, 
-    0x49, 0x49, 0x2A, 0x3E, 0x4A, 0xC2, 0x53, 0x48, 0x3A, 0x39, 0x3A, 0x78, 
-    0xC2, 0x53, 0xC2, 0xC2, 0x49, 0x5A, 0x48, 0x2A, 0x5A, 0x44, 0xC1, 0x53, 
-    0x5A, 0x48, 0x48, 0x5A, 0x39, 0x29, 0x48, 0xC1, 0x3E, 0x42, 0x48, 0x59, 
-    0x48, 0x49, 0x44, 0x48, 0x47, 0x2A, 0x48, 0x49, 0xC1, 0x44, 0x49, 0x48, 
-    0x48, 0x2A, 0x2A, 0x3A, 0x3E, 0x36, 0x39, 0x39, 0x2E, 0x1F, 0x2F, 0x2A, 
-    0x3E, 0x29, 0x39, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x3E, 0x2E, 0x2C, 0x7E, 
-    0x3A, 0x3E, 0x26, 0x36, 0xC1, 0xC1, 0xC1, 0xC4, 0x53, 0x53, 0x44, 0x48, 
-    0xC1, 0xC1, 0xC1, 0x5B, 0xC2, 0xC2, 0x5A, 0x42, 0x59, 0x59, 0x59, 0x62, 
-    0xCB, 0x59, 0x5A, 0x49, 0x48, 0x47, 0x47, 0x49, 0x49, 0x2A, 0x3E, 0x3E, 
-    0x29, 0xB3, 0x2F, 0x3E, 0x42, 0x39, 0x2E, 0x2E, 0x2A, 0x2A, 0x2A, 0x3E, 
-    0x2D, 0x36, 0x3A, 0x36, 0x27, 0x27, 0x3A, 0x39, 0x2D, 0x2D, 0x2D, 0x3E, 
-    0x2F, 0x2F, 0x2D, 0x2C, 0x39, 0x39, 0x2C, 0x39, 0x47, 0x49, 0x53, 0x49, 
-    0x2A, 0x47, 0x27, 0x4B, 0x42, 0x48, 0x2A, 0x42, 0x4B, 0x3A, 0x3A, 0x3A, 
-    0x48, 0x47, 0x36, 0x39, 0x36, 0x3A, 0x3A, 0x3A, 0x3E, 0x42, 0x3F, 0xBC, 
-    0x1F, 0x2A, 0x48, 0x48, 0x2E, 0x2F, 0x1E, 0x1E, 0x2E, 0x42, 0x47, 0x47, 
-    0x36, 0x2D, 0x12, 0x1F, 0x2E, 0x2F, 0x50, 0x50, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x2A, 0x2A, 0x2A, 0x48, 0x26, 0x26, 0x26, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 
-    0x1F, 0x09, 0x08, 0x02, 0x15, 0x15, 0xD2, 0x01, 0x2D, 0x2D, 0x2F, 0xBF, 
-    0xCE, 0xCE, 0xCE, 0x04, 0x39, 0x2D, 0x2D, 0x2D, 0x2D, 0x36, 0x36, 0xBF, 
-    0x48, 0x48, 0x2A, 0x42, 0x42, 0x3F, 0x2F, 0x2F, 0x47, 0x47, 0x2C, 0x1E, 
-    0x1F, 0x19, 0x19, 0x09, 0x2F, 0x2F, 0x2F, 0x2D, 0x2E, 0x29, 0x36, 0x2E, 
-    0x3A, 0x50, 0x2F, 0x2D, 0x39, 0x36, 0x36, 0x36, 0x2D, 0x27, 0x42, 0x29, 
-    0x2F, 0x2F, 0x2E, 0x2E, 0x01, 0x03, 0x04, 0x06, 0x08, 0x04, 0x03, 0x01, 
-    0x05, 0x03, 0x05, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 
-    0x05, 0x01, 0x0B, 0x0B, 0x0F, 0xD2, 0x01, 0x0B, 0x03, 0x03, 0x03, 0x03, 
-    0x06, 0x06, 0x06, 0x05, 0xD2, 0x01, 0x0B, 0x01, 0x1F, 0x1E, 0x12, 0x19, 
-    0x09, 0x08, 0x01, 0x01, 0x36, 0x2F, 0x1F, 0x1F, 0x1F, 0x19, 0x02, 0x01, 
-    0x1F, 0x19, 0x1B, 0x1B, 0x08, 0x0F, 0x01, 0x01, 0xA8, 0xA8, 0x1D, 0x01, 
-    0xA6, 0xA9, 0x9E, 0x9E, 0xA8, 0x1D, 0x1D, 0x1D, 0x0B, 0xA8, 0xC5, 0xA1, 
-    0xA8, 0xD4, 0xA8, 0xA8, 0x0B, 0xD4, 0xA8, 0xA8, 0xA8, 0xA8, 0xD4, 0xAF, 
-    0xD5, 0xA8, 0xA8, 0x0B, 0xD4, 0xA8, 0xD4, 0xD5, 0x05, 0xD2, 0xB1, 0x15, 
-    0x01, 0x02, 0x01, 0x05, 0x06, 0x10, 0xBF, 0xBC, 0x02, 0x07, 0x16, 0x14, 
-    0x10, 0x1E, 0x2F, 0x2E, 0x19, 0x12, 0xBC, 0x12, 0x12, 0x12, 0x1E, 0x1F, 
-    0xA1, 0xC5, 0x9E, 0x60, 0x9E, 0x17, 0x0B, 0x03, 0xA1, 0x8C, 0x42, 0x69, 
-    0xA1, 0xA9, 0xA6, 0x02, 0xB7, 0xAE, 0x42, 0xBD, 0x24, 0x01, 0xBB, 0x10, 
-    0x33, 0x20, 0x02, 0x1A, 0x02, 0x09, 0xCE, 0xBE, 0x1A, 0x09, 0xCE, 0xCE, 
-    0x19, 0x1F, 0x21, 0x1F, 0x1E, 0x21, 0x2E, 0x2E, 0x2D, 0x2E, 0x2F, 0x2F, 
-    0x2E, 0x26, 0x3A, 0x3A, 0x2C, 0x2F, 0x2E, 0xBE, 0x2F, 0x48, 0x49, 0x49, 
-    0x47, 0x2F, 0x2F, 0x2F, 0x6E, 0x6E, 0xA7, 0xA7, 0x40, 0xB1, 0x2E, 0x39, 
-    0x20, 0xA6, 0x24, 0x41, 0x39, 0x36, 0x3A, 0x47, 0x1F, 0xBD, 0x7E, 0x2A, 
-    0x49, 0x48, 0x48, 0x48, 0x21, 0x2A, 0xC1, 0x5A, 0xC1, 0xC1, 0xC1, 0x44, 
-    0x1F, 0x1F, 0xBE, 0x1F, 0x30, 0x1F, 0x30, 0xB3, 0x1E, 0x39, 0x47, 0x47, 
-    0x47, 0x42, 0x2E, 0x21, 0x10, 0x29, 0x39, 0x2C, 0x39, 0x2C, 0x21, 0xBE, 
-    0x2F, 0x21, 0x1F, 0x1F, 0x1F, 0x1F, 0x21, 0x1F, 0x2D, 0x36, 0x57, 0x47, 
-    0x48, 0x48, 0x27, 0x3E, 0x48, 0xC1, 0xC1, 0xC2, 0x59, 0x3A, 0x36, 0x5A, 
-    0xC2, 0x53, 0x53, 0xC2, 0xC1, 0x3E, 0x2A, 0xC1, 0xC1, 0x44, 0x5A, 0x48, 
-    0x3E, 0x42, 0x2A, 0x2A, 0x47, 0x48, 0x3A, 0x36, 0x2F, 0x1F, 0x1F, 0x29, 
-    0x2F, 0x36, 0x2D, 0x2F, 0x2F, 0x29, 0x36, 0x29, 0x1F, 0x2F, 0x2E, 0x2E, 
-    0x2E, 0x2F, 0x2E, 0x10, 0x23, 0x1F, 0xBE, 0x12, 0x10, 0x08, 0xCD, 0x1D, 
-    0x42, 0x42, 0x36, 0x42, 0xC2, 0xC2, 0x53, 0xC2, 0xC2, 0xC1, 0xC2, 0xC1, 
-    0x53, 0x5A, 0x2C, 0x3A, 0xC2, 0xC1, 0xC1, 0xC1, 0x5A, 0x48, 0x2D, 0x36, 
-    0x2A, 0x4A, 0x42, 0x3A, 0x52, 0x38, 0x37, 0x08, 0x39, 0x2F, 0xBC, 0x12, 
-    0x11, 0x0A, 0x04, 0x06, 0x2D, 0xBC, 0x3B, 0x04, 0x01, 0x03, 0x0B, 0x04, 
-    0x02, 0x04, 0x17, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 
-    0x06, 0x04, 0x04, 0x01, 0x2A, 0x39, 0x49, 0xC1, 0xC1, 0x2E, 0x1F, 0x2F, 
-    0x2F, 0x1F, 0x36, 0x29, 0x29, 0x2F, 0x21, 0x2F, 0x2F, 0x14, 0x0A, 0x40, 
-    0x40, 0xAF, 0xD5, 0xAF, 0x1B, 0x04, 0x03, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x06, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x06, 0x04, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0xBF, 0x37, 0x1A, 
-    0x20, 0x01, 0x01, 0x01, 0xBE, 0x01, 0xBB, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0xAF, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x17, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x01, 0x05, 
-    0x01, 0x04, 0x0A, 0x1A, 0x01, 0x01, 0x05, 0x01, 0x15, 0x04, 0x12, 0x39, 
-    0x01, 0x01, 0x05, 0x04, 0x08, 0x0F, 0x39, 0x48, 0x01, 0x05, 0x0B, 0x17, 
-    0x04, 0x19, 0x29, 0x39, 0x01, 0x04, 0x3B, 0x1F, 0xC2, 0xC4, 0x61, 0x61, 
-    0x1C, 0x46, 0xC0, 0x5A, 0x44, 0x49, 0x49, 0x49, 0x1D, 0xBF, 0x2A, 0xC2, 
-    0xC2, 0xC1, 0x49, 0xC2, 0x19, 0xC3, 0x49, 0xC1, 0x53, 0x53, 0x53, 0x53, 
-    0x10, 0x2F, 0x30, 0x39, 0x4A, 0x78, 0x4A, 0x2A, 0x49, 0x49, 0x49, 0x49, 
-    0x2A, 0x48, 0x48, 0x49, 0x78, 0x78, 0x78, 0x78, 0x48, 0x5A, 0x42, 0x3E, 
-    0x52, 0x52, 0x1E, 0x21, 0x2E, 0x2E, 0x2E, 0x27, 0x61, 0x5A, 0xC1, 0x5A, 
-    0xC1, 0x53, 0x53, 0xC2, 0x5A, 0x5C, 0x5B, 0x62, 0x62, 0x3E, 0x26, 0x26, 
-    0x53, 0xC2, 0x48, 0x48, 0x2A, 0x29, 0x50, 0x2E, 0xC2, 0x47, 0x29, 0x36, 
-    0x3A, 0x4A, 0x47, 0x2A, 0x3E, 0x2E, 0x2E, 0x2E, 0x49, 0xC2, 0xC2, 0xC2, 
-    0x4A, 0x29, 0x48, 0x49, 0xC1, 0x49, 0x47, 0x49, 0x3E, 0x27, 0x47, 0x2A, 
-    0x2A, 0x39, 0x2F, 0x49, 0x2A, 0x2A, 0x47, 0x36, 0x2D, 0x29, 0x4B, 0x44, 
-    0x44, 0x5C, 0x1E, 0x40, 0x01, 0x05, 0x01, 0x01, 0x27, 0xCC, 0x1E, 0x20, 
-    0x06, 0x0B, 0x05, 0x01, 0x30, 0x1F, 0x1C, 0x02, 0x03, 0x01, 0x01, 0x01, 
-    0x2C, 0xD1, 0x17, 0x15, 0x05, 0x05, 0x01, 0x01, 0x44, 0x2A, 0x09, 0xD2, 
-    0x03, 0x01, 0x01, 0x01, 0x7E, 0x09, 0x04, 0x03, 0x03, 0x01, 0x05, 0x01, 
-    0x7E, 0x24, 0x03, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x78, 0xA6, 0x01, 0x01, 
-    0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0xB8, 0x2A, 0xC4, 0xC4, 
-    0x01, 0x01, 0x01, 0x01, 0xA6, 0x42, 0x53, 0xC2, 0x01, 0x01, 0x01, 0x01, 
-    0x15, 0xCE, 0x2C, 0x47, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x40, 0xCE, 0x29, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x1A, 0x2F, 0x3E, 0x01, 0x01, 0x05, 0x01, 
-    0x17, 0x02, 0xBF, 0x2E, 0x01, 0x01, 0x05, 0x01, 0x0A, 0x04, 0x46, 0x7B, 
-    0x01, 0x01, 0x01, 0x05, 0x01, 0x20, 0x4E, 0x48, 0xC2, 0xC2, 0x53, 0xC1, 
-    0x43, 0xC1, 0x2A, 0x3A, 0xC2, 0xC1, 0x47, 0x27, 0x27, 0x3E, 0x39, 0x29, 
-    0x47, 0x27, 0x47, 0x48, 0x3A, 0x3A, 0x3A, 0x4B, 0x2D, 0x36, 0x47, 0x2A, 
-    0x3A, 0x4B, 0x47, 0x48, 0x3A, 0x3A, 0x3A, 0x4B, 0x3A, 0x2A, 0x49, 0xC2, 
-    0x48, 0x49, 0x49, 0x49, 0x49, 0x44, 0x5A, 0x49, 0x5A, 0x48, 0x78, 0x2A, 
-    0x78, 0x4B, 0x48, 0x44, 0xC1, 0x42, 0x3A, 0x3A, 0x3A, 0x3E, 0x42, 0x42, 
-    0x3E, 0x5A, 0x49, 0x1E, 0x0C, 0x04, 0x03, 0x05, 0x3A, 0x39, 0x47, 0x49, 
-    0x39, 0x2F, 0x03, 0x01, 0x4A, 0x48, 0x49, 0x49, 0x47, 0x2D, 0x16, 0x05, 
-    0x49, 0x49, 0x48, 0x49, 0x48, 0x23, 0xB1, 0x0B, 0x48, 0x4A, 0x3E, 0x4A, 
-    0x3E, 0x2D, 0x21, 0x1B, 0x48, 0x3A, 0x48, 0x49, 0x5A, 0xC2, 0x3E, 0xBC, 
-    0x48, 0x3A, 0x78, 0x3A, 0x3A, 0x3A, 0x39, 0x2E, 0x47, 0x27, 0x2D, 0x52, 
-    0x52, 0x70, 0x36, 0x2D, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 
-    0x03, 0x04, 0x04, 0x04, 0x01, 0x0B, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x1A, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x15, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x03, 0xAF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x05, 0x01, 0x05, 0x05, 0x05, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x01, 0x01, 0x05, 0x01, 
-    0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x01, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x0A, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x04, 0x04, 0x04, 0x0B, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x01, 
-    0x04, 0x04, 0x04, 0x01, 0x04, 0x06, 0x0A, 0x09, 0xD0, 0x09, 0xBE, 0x1E, 
-    0x01, 0x03, 0x03, 0x19, 0x1F, 0x04, 0x40, 0x40, 0x0A, 0x03, 0x05, 0x15, 
-    0x20, 0x05, 0x0B, 0x0B, 0x0A, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 
-    0x05, 0x03, 0x04, 0x03, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x03, 0x03, 0x01, 0x01, 
-    0x05, 0x05, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0xC0, 0x96, 0x2F, 0x4B, 
-    0x4B, 0x36, 0x47, 0xC1, 0x37, 0xC0, 0x2D, 0x3A, 0x2D, 0xBE, 0x1F, 0x30, 
-    0x01, 0xD5, 0xD5, 0x20, 0x1D, 0x1E, 0x2F, 0x2F, 0x01, 0x01, 0x01, 0x01, 
-    0x17, 0x37, 0xD0, 0xD0, 0x05, 0x05, 0x05, 0x01, 0x15, 0x1A, 0x1A, 0x15, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 
-    0x49, 0x49, 0x48, 0x27, 0x36, 0x2D, 0x2F, 0x2F, 0xBE, 0x39, 0x2A, 0x4A, 
-    0x47, 0x27, 0x39, 0x27, 0x30, 0x39, 0x48, 0x2A, 0x39, 0x2D, 0x2E, 0x36, 
-    0xD0, 0x38, 0x34, 0x2E, 0x3A, 0x2D, 0x2E, 0x2D, 0x02, 0x03, 0xCD, 0xCE, 
-    0x39, 0x39, 0x2D, 0x39, 0x0B, 0x03, 0x05, 0x1C, 0x19, 0x1F, 0x36, 0x29, 
-    0x05, 0x05, 0x01, 0x0B, 0x15, 0x01, 0x19, 0xCE, 0x01, 0x01, 0x01, 0x03, 
-    0x04, 0x0B, 0x1A, 0x1A, 0x2E, 0x2F, 0x2F, 0x50, 0x2F, 0x50, 0x2F, 0x29, 
-    0x4A, 0x2F, 0x2F, 0x2A, 0x49, 0x48, 0x48, 0x48, 0x39, 0x39, 0x39, 0x3A, 
-    0x3A, 0x3A, 0x3A, 0x2D, 0x39, 0x2C, 0x2F, 0x21, 0x21, 0x1F, 0x30, 0x16, 
-    0x2A, 0x2E, 0x1F, 0x30, 0x30, 0x1F, 0x10, 0xBC, 0x3A, 0x47, 0x47, 0x47, 
-    0x47, 0x4A, 0x48, 0x49, 0xBF, 0x1F, 0xBE, 0xB3, 0x2E, 0x42, 0x48, 0x2A, 
-    0x1A, 0x09, 0x1F, 0xD1, 0x1E, 0x1F, 0x2F, 0x29, 0x2D, 0x2D, 0x42, 0x49, 
-    0x2A, 0x2A, 0x48, 0xBE, 0x48, 0x2A, 0x3A, 0x39, 0x2D, 0x3F, 0x1F, 0x23, 
-    0x1F, 0xBE, 0xBF, 0x10, 0x12, 0x19, 0x2F, 0x3F, 0x09, 0xCE, 0xCE, 0x12, 
-    0x12, 0xBF, 0x3E, 0x4A, 0x36, 0x3A, 0x4B, 0x4B, 0x4B, 0x39, 0x2D, 0x2D, 
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x48, 0x27, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x2A, 0x2A, 0x48, 0x4A, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x36, 0x2A, 0x48, 
-    0x6C, 0x09, 0x1E, 0xC0, 0xC0, 0xB3, 0xC0, 0xC3, 0x1E, 0xBE, 0x42, 0x48, 
-    0x48, 0x5A, 0xC1, 0xC1, 0x2C, 0x2A, 0x39, 0x39, 0x27, 0x3A, 0x3A, 0x3A, 
-    0x47, 0x3E, 0x39, 0x3A, 0x3A, 0x2D, 0x29, 0x29, 0x39, 0x36, 0x3A, 0x36, 
-    0x36, 0x36, 0x36, 0x36, 0x2E, 0x29, 0x29, 0x30, 0x21, 0x29, 0x36, 0x36, 
-    0x3E, 0x27, 0x39, 0x3F, 0x1F, 0xBE, 0x2D, 0x39, 0x49, 0xC1, 0xC1, 0xC1, 
-    0x7E, 0x7A, 0x19, 0x30, 0x2D, 0x49, 0x49, 0x27, 0x36, 0x39, 0x2D, 0x39, 
-    0xC1, 0x49, 0x48, 0x48, 0x48, 0x48, 0x27, 0x29, 0x3A, 0x3A, 0x3A, 0x3A, 
-    0x3A, 0x3A, 0x39, 0x39, 0x36, 0x2E, 0x2F, 0x2F, 0x2E, 0x36, 0x36, 0x48, 
-    0x2D, 0x10, 0x19, 0x07, 0x10, 0x36, 0x2A, 0x48, 0x2E, 0xBE, 0x2F, 0x39, 
-    0x47, 0x47, 0x3E, 0x27, 0x4B, 0x4B, 0x3A, 0x39, 0x2C, 0x29, 0x2D, 0x3A, 
-    0x2F, 0x2F, 0x3F, 0x1F, 0x09, 0x09, 0x3F, 0x42, 0x16, 0x1A, 0x1D, 0x02, 
-    0x03, 0x03, 0x03, 0x03, 0x2F, 0x1E, 0x1F, 0xBC, 0x14, 0x10, 0x0F, 0x04, 
-    0x42, 0x3A, 0x36, 0x29, 0xBC, 0x10, 0x08, 0x01, 0x44, 0x48, 0x3A, 0x2E, 
-    0x1E, 0x1F, 0x23, 0x08, 0x42, 0x3E, 0x3A, 0x2E, 0x2D, 0x2D, 0x12, 0x10, 
-    0x2D, 0x29, 0x36, 0x3A, 0x27, 0x3A, 0x42, 0x3A, 0x3A, 0x39, 0x2F, 0x2F, 
-    0x2F, 0x3F, 0x2F, 0x1F, 0x47, 0x39, 0x0C, 0x07, 0x0C, 0x07, 0xBF, 0x09, 
-    0x1F, 0x1F, 0x12, 0x12, 0x12, 0x19, 0x19, 0x11, 0x10, 0x23, 0xBE, 0x36, 
-    0x36, 0x1F, 0x19, 0x19, 0x42, 0x42, 0x42, 0x2D, 0x30, 0xBC, 0x30, 0x2F, 
-    0x29, 0x29, 0x30, 0x1E, 0x09, 0x08, 0x10, 0xBC, 0x50, 0x39, 0x4A, 0x2A, 
-    0x42, 0x39, 0x26, 0x39, 0x2F, 0x2C, 0x3E, 0x3A, 0x3A, 0x47, 0x2A, 0x2A, 
-    0x09, 0x04, 0xD2, 0xBB, 0x46, 0x1E, 0x1F, 0x1F, 0x02, 0x01, 0x17, 0x1C, 
-    0x04, 0x1B, 0x09, 0x37, 0xBC, 0x2E, 0x2D, 0x39, 0x36, 0x29, 0xBE, 0x1E, 
-    0x14, 0x06, 0x2E, 0x3A, 0x47, 0x48, 0x3A, 0x3A, 0xBE, 0x3A, 0x42, 0x4A, 
-    0x48, 0x49, 0x44, 0x44, 0xBC, 0x30, 0x7B, 0x7B, 0x30, 0x21, 0x3F, 0x2C, 
-    0x39, 0x2C, 0x2C, 0x36, 0x36, 0x29, 0x36, 0x36, 0x2A, 0x2A, 0x2A, 0x3A, 
-    0x29, 0x29, 0x29, 0x2F, 0x1F, 0x1F, 0x1F, 0x21, 0x30, 0x30, 0xBE, 0x0F, 
-    0x37, 0x37, 0x37, 0xD0, 0xBF, 0xBF, 0xBF, 0x37, 0x12, 0x2F, 0x47, 0x47, 
-    0x2A, 0x48, 0x2A, 0x42, 0x3A, 0x42, 0x48, 0x48, 0x39, 0x29, 0x2D, 0x2E, 
-    0x48, 0x2A, 0x47, 0x3A, 0xB3, 0x12, 0xBE, 0xD1, 0x36, 0x36, 0x39, 0x39, 
-    0xB3, 0x12, 0x35, 0x34, 0x19, 0x11, 0x14, 0x09, 0x1B, 0x06, 0xD2, 0x15, 
-    0x09, 0x08, 0x08, 0x03, 0x1A, 0x20, 0x01, 0x01, 0x02, 0x05, 0x05, 0x01, 
-    0x01, 0x03, 0x0A, 0x05, 0x05, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 
-    0x3A, 0x39, 0x39, 0x2D, 0xBE, 0x0F, 0x17, 0x17, 0x2D, 0x1F, 0xCE, 0xCE, 
-    0xCE, 0x0A, 0x01, 0x0B, 0x0D, 0x11, 0x0D, 0x1A, 0x20, 0x01, 0x03, 0x01, 
-    0x1C, 0x17, 0x03, 0x0B, 0x01, 0x03, 0x04, 0x04, 0x15, 0x15, 0x01, 0x03, 
-    0x03, 0x03, 0x04, 0x03, 0x01, 0x01, 0x03, 0x04, 0x04, 0x01, 0x05, 0x05, 
-    0x01, 0x04, 0x03, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x01, 0x05, 0x01, 
-    0x03, 0x06, 0x0A, 0x01, 0x0B, 0x01, 0x05, 0x01, 0x03, 0x06, 0x01, 0x05, 
-    0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x01, 0x05, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x05, 0x04, 0x04, 0x04, 0x03, 0x05, 0x01, 0x05, 0x01, 
-    0x03, 0x03, 0x03, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x05, 0x05, 0x05, 
-    0x01, 0x01, 0x01, 0x1B, 0x01, 0x01, 0x01, 0x01, 0x01, 0xD5, 0xBB, 0x34, 
-    0x05, 0x05, 0x03, 0x04, 0x04, 0x1D, 0x6C, 0x4D, 0x04, 0x03, 0x0B, 0x04, 
-    0xD2, 0x3F, 0x48, 0x49, 0x05, 0x03, 0x02, 0x06, 0x2C, 0x42, 0x42, 0x47, 
-    0x05, 0x1D, 0x34, 0xCE, 0x39, 0x3A, 0x3E, 0x47, 0x01, 0x19, 0x3E, 0x48, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x1A, 0x10, 0x2C, 0x26, 0x3E, 0x26, 0x26, 0x26, 
-    0x14, 0x21, 0x29, 0x2D, 0x2D, 0x4A, 0x48, 0x48, 0x2E, 0x29, 0x2D, 0x36, 
-    0x36, 0x39, 0x3A, 0x3A, 0x78, 0x78, 0x47, 0x2A, 0x48, 0x3A, 0x3E, 0x3E, 
-    0x49, 0x44, 0xC2, 0x6D, 0x26, 0x44, 0x53, 0xC2, 0x47, 0x47, 0x4A, 0x3A, 
-    0x4A, 0x2A, 0x2A, 0x49, 0x47, 0x47, 0x47, 0x39, 0x27, 0x42, 0x4B, 0x3A, 
-    0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x26, 0x26, 0x26, 0x26, 
-    0x2A, 0x78, 0x26, 0x3A, 0x48, 0x48, 0x48, 0x47, 0x36, 0x2D, 0x50, 0x50, 
-    0x3A, 0x3A, 0x3A, 0x39, 0x21, 0x50, 0x2F, 0x2F, 0x3E, 0x3E, 0x3E, 0x3E, 
-    0x42, 0x3E, 0x3A, 0x27, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x4A, 0x2D, 0x2C, 
-    0x48, 0x3A, 0x3A, 0x39, 0x36, 0x36, 0x36, 0x30, 0x39, 0x36, 0x3A, 0x4A, 
-    0x39, 0x36, 0x29, 0xD0, 0x48, 0x49, 0x27, 0x3A, 0x39, 0x36, 0x39, 0xD1, 
-    0x3A, 0x47, 0x39, 0x2D, 0x36, 0x36, 0x2D, 0x19, 0x2F, 0x29, 0x29, 0x3A, 
-    0x48, 0x4B, 0x1F, 0xBB, 0x2F, 0x2D, 0x2D, 0x29, 0x39, 0x2D, 0xBF, 0x0A, 
-    0x42, 0x42, 0x3E, 0x42, 0x3A, 0x23, 0xBB, 0x0B, 0x2C, 0x2C, 0x2C, 0x3F, 
-    0x2F, 0x09, 0x04, 0x03, 0xB5, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x40, 0x0B, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x04, 0x03, 
-    0x05, 0x01, 0x01, 0x01, 0xD2, 0x03, 0x03, 0x01, 0x05, 0x01, 0x01, 0x01, 
-    0x03, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x0B, 0x0B, 
-    0x05, 0x05, 0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x01, 0x01, 
-    0x0B, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x05, 0x17, 0xB5, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x40, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0B, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x17, 
-    0x01, 0x01, 0x01, 0x05, 0x01, 0x03, 0x04, 0x04, 0x01, 0x01, 0x01, 0x03, 
-    0x04, 0x04, 0x04, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x03, 0x04, 0x01, 
-    0x2F, 0x48, 0xC1, 0xC1, 0x49, 0xC1, 0x3F, 0xCF, 0x1E, 0x36, 0x36, 0x36, 
-    0x36, 0x36, 0x2E, 0x39, 0x21, 0x39, 0x29, 0x36, 0x36, 0x36, 0x36, 0x3A, 
-    0x1B, 0x21, 0x36, 0x36, 0x2E, 0x2F, 0x2D, 0x29, 0xBB, 0xCE, 0x42, 0x48, 
-    0x4A, 0x4A, 0x48, 0x49, 0x0A, 0x19, 0xC3, 0x29, 0x39, 0x3A, 0x3A, 0x3A, 
-    0x01, 0xD5, 0x7B, 0x3A, 0x3E, 0x3E, 0x3E, 0x3E, 0x15, 0x33, 0xBE, 0x4A, 
-    0xC2, 0x49, 0x5A, 0x44, 0x09, 0x09, 0x10, 0x3E, 0x2A, 0x48, 0x4A, 0x27, 
-    0x3A, 0x2F, 0x2F, 0x2A, 0x4A, 0x4A, 0x27, 0x3A, 0x47, 0x39, 0x36, 0x3E, 
-    0x39, 0x27, 0x48, 0x49, 0x2D, 0x36, 0x36, 0x47, 0x27, 0x2D, 0x26, 0x26, 
-    0x39, 0x2D, 0x39, 0x4A, 0x2A, 0x48, 0x48, 0x2A, 0x2D, 0x2F, 0x2E, 0x50, 
-    0x29, 0x3A, 0x2A, 0x47, 0x7E, 0x78, 0x78, 0x78, 0x7E, 0x3A, 0x2E, 0xB2, 
-    0x49, 0x48, 0x3A, 0x48, 0xC1, 0x2A, 0xD0, 0x07, 0x2D, 0x19, 0x04, 0x15, 
-    0x01, 0x01, 0x01, 0x01, 0x3A, 0x2F, 0x09, 0x0B, 0x05, 0x01, 0x05, 0x05, 
-    0x49, 0x48, 0x42, 0x1E, 0x1A, 0x0B, 0x01, 0x01, 0x3A, 0x3E, 0x3F, 0x34, 
-    0x02, 0x0B, 0x04, 0x04, 0x29, 0x2D, 0x30, 0x1B, 0x05, 0x03, 0x04, 0x03, 
-    0x36, 0x39, 0x2D, 0xBF, 0x15, 0x15, 0xBB, 0x01, 0x2D, 0x2E, 0x12, 0x07, 
-    0x19, 0x08, 0xD0, 0x15, 0x1B, 0x06, 0x08, 0x09, 0x07, 0x19, 0x12, 0x01, 
-    0x01, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0B, 0x05, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 
-    0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x05, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x03, 0x0A, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x05, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x01, 0x03, 0x0B, 0x0B, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0B, 0x0B, 0x0B, 0x03, 0x03, 0x04, 0x04, 0x0B, 0x05, 0x05, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x01, 0x05, 0x01, 0x01, 0x04, 0x04, 0x01, 0x05, 
-    0x05, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x04, 0x04, 0x04, 0x01, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 
-    0x04, 0x04, 0x0B, 0x0B, 0x01, 0x05, 0x05, 0x05, 0x01, 0x04, 0x06, 0x06, 
-    0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x05, 0x05, 0x04, 0x04, 0x0A, 0x01, 
-    0x01, 0x01, 0x03, 0x03, 0x03, 0x04, 0x06, 0x04, 0x04, 0x03, 0x03, 0x03, 
-    0x05, 0x0B, 0x03, 0x0B, 0x0B, 0x05, 0x05, 0x05, 0x01, 0x05, 0x01, 0x03, 
-    0x03, 0x03, 0x01, 0x01, 0x05, 0x01, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 
-    0x0B, 0x0B, 0x03, 0x0B, 0x0B, 0x0B, 0x03, 0x03, 0x04, 0x1C, 0x34, 0x10, 
-    0xBE, 0x30, 0x2D, 0x36, 0x05, 0x15, 0xD2, 0x04, 0x19, 0xCE, 0xCE, 0x16, 
-    0x03, 0x03, 0x01, 0x15, 0x1A, 0x1A, 0x1A, 0x19, 0x03, 0x0B, 0x01, 0x01, 
-    0x01, 0x0A, 0x04, 0x04, 0x05, 0x05, 0x01, 0x05, 0x01, 0x03, 0x03, 0x04, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x01, 0x04, 0x01, 0x05, 0x05, 
-    0x05, 0x05, 0x01, 0x01, 0x03, 0x03, 0x0B, 0x0B, 0x0B, 0x0B, 0x01, 0x05, 
-    0x29, 0x36, 0x36, 0x36, 0x39, 0x47, 0x42, 0x27, 0x23, 0x2E, 0x39, 0x36, 
-    0x39, 0x39, 0x36, 0x36, 0x12, 0x30, 0x2F, 0x50, 0xC0, 0x3F, 0x2C, 0x2C, 
-    0x06, 0x17, 0x0C, 0xC0, 0xC0, 0x39, 0x27, 0x27, 0x0A, 0x05, 0x1C, 0x09, 
-    0x37, 0x0B, 0xB8, 0x0B, 0x01, 0x04, 0x04, 0x02, 0x1A, 0x05, 0x04, 0x06, 
-    0x05, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x01, 0x01, 0x05, 0x05, 
-    0x01, 0x01, 0x0B, 0x0B, 0x42, 0xC1, 0x53, 0x53, 0x44, 0x42, 0x3E, 0x39, 
-    0x2C, 0x3A, 0x39, 0x2C, 0x42, 0x47, 0x3A, 0x3A, 0x2C, 0x2C, 0x3A, 0x2E, 
-    0x21, 0x2F, 0x2F, 0x2F, 0x3A, 0x39, 0x2C, 0x2F, 0x30, 0x2F, 0x2F, 0x2F, 
-    0xAF, 0x1B, 0x2E, 0x2E, 0x39, 0x2A, 0x4A, 0x47, 0x0A, 0x09, 0x4D, 0x4D, 
-    0x2C, 0x26, 0x2C, 0x26, 0x04, 0x05, 0x40, 0x40, 0x1A, 0xCF, 0xCF, 0x1F, 
-    0x01, 0x03, 0x03, 0x0B, 0x1C, 0x09, 0x37, 0xBF, 0x29, 0x2E, 0x21, 0x2F, 
-    0x2F, 0xBC, 0x1B, 0x37, 0x3A, 0x36, 0x36, 0x2E, 0x21, 0x1E, 0xBE, 0x21, 
-    0x2F, 0x2F, 0x2E, 0x39, 0x26, 0x2C, 0x36, 0x36, 0x2F, 0xD1, 0x1E, 0x39, 
-    0x4A, 0x42, 0x36, 0x2E, 0x47, 0x39, 0x1E, 0x06, 0x09, 0x08, 0x09, 0x19, 
-    0x26, 0x39, 0xCE, 0x1A, 0x01, 0x15, 0x03, 0x04, 0x2D, 0xC3, 0x30, 0xBC, 
-    0x04, 0x03, 0x04, 0x04, 0x21, 0xBE, 0x12, 0x09, 0x03, 0x03, 0x01, 0x05, 
-    0x09, 0x08, 0x0D, 0x10, 0x2F, 0x1E, 0x1E, 0x19, 0x21, 0x2F, 0x1E, 0x12, 
-    0x2F, 0xCE, 0xBB, 0x04, 0x39, 0x39, 0x2D, 0x30, 0x09, 0x0A, 0x01, 0x01, 
-    0x1F, 0x37, 0x37, 0x35, 0x37, 0x03, 0x05, 0x01, 0x16, 0x10, 0x1B, 0xBB, 
-    0xD2, 0x05, 0x01, 0x04, 0x1B, 0x07, 0x04, 0x01, 0x01, 0x01, 0x05, 0x01, 
-    0x01, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 
-};
-
-const unsigned short MissionCompleteScreen_palette [] = {
-    0x7c1f, 0x1c84, 0x1c83, 0x1ca5, 0x20a6, 0x1883, 0x20c7, 0x24e9, 0x24c8, 
-    0x24ea, 0x20a5, 0x1c85, 0x24c7, 0x24e8, 0x1ca4, 0x20c8, 0x290c, 0x28ea, 
-    0x290d, 0x20c6, 0x28eb, 0x1882, 0x290b, 0x1ca6, 0x1c81, 0x24eb, 0x1840, 
-    0x24c9, 0x20a7, 0x20a4, 0x292e, 0x292f, 0x1861, 0x2950, 0x1c80, 0x250c, 
-    0x1c00, 0x250e, 0x29d6, 0x29d8, 0x3afd, 0x2994, 0x2a3a, 0x3adc, 0x29b5, 
-    0x2974, 0x2973, 0x2952, 0x2951, 0x24c6, 0x2972, 0x1c87, 0x1ca8, 0x1ca9, 
-    0x2995, 0x20c9, 0x20ca, 0x29b6, 0x29d7, 0x20a3, 0x20a1, 0x2db1, 0x29f8, 
-    0x2993, 0x1800, 0x20ee, 0x29f9, 0x2ebd, 0x2a9d, 0x2531, 0x24a4, 0x2a19, 
-    0x2a5b, 0x2a7c, 0x2a1a, 0x29b7, 0x2553, 0x2593, 0x1c46, 0x250f, 0x2532, 
-    0x20ec, 0x24ed, 0x2ede, 0x2e5a, 0x329c, 0x2efe, 0x2554, 0x329a, 0x371e, 
-    0x2e9c, 0x3f3e, 0x32fe, 0x477e, 0x435e, 0x4b7e, 0x431d, 0x267c, 0x3b1e, 
-    0x5bbe, 0x6bdf, 0x579e, 0x7bff, 0x4f5d, 0x26de, 0x36bb, 0x73ff, 0x221b, 
-    0x24a9, 0x29f6, 0x24c5, 0x29d5, 0x24ac, 0x371f, 0x539e, 0x5fbf, 0x36dd, 
-    0x73df, 0x77ff, 0x67de, 0x2a39, 0x4f7e, 0x2045, 0x2570, 0x1c8a, 0x1cce, 
-    0x2a18, 0x32bd, 0x2e7b, 0x265b, 0x3f5f, 0x2043, 0x4efb, 0x019d, 0x0158, 
-    0x00b5, 0x0d9b, 0x1956, 0x1c14, 0x2095, 0x46b9, 0x0412, 0x1e5d, 0x15fd, 
-    0x0dbd, 0x1116, 0x1578, 0x1913, 0x1ccd, 0x1ccf, 0x1cf1, 0x2576, 0x1cab, 
-    0x19d9, 0x25d8, 0x67ba, 0x180c, 0x1c30, 0x3e4a, 0x1843, 0x4f34, 0x46ce, 
-    0x3a53, 0x1c07, 0x24a6, 0x3237, 0x1803, 0x2d66, 0x2924, 0x31c8, 0x1c8d, 
-    0x2dad, 0x1c49, 0x3214, 0x29f2, 0x1863, 0x24e4, 0x24c0, 0x2154, 0x2510, 
-    0x1d98, 0x210a, 0x040b, 0x2d80, 0x1c65, 0x24e3, 0x3a07, 0x1c60, 0x290e, 
-    0x29d4, 0x2930, 0x250d, 0x2130, 0x2abd, 0x2ade, 0x2552, 0x26be, 0x3607, 
-    0x67be, 0x73de, 0x11fd, 0x2176, 0x5fbe, 0x36fd, 0x32dd, 0x2081, 0x24ec, 
-    0x2486, 0x20cc, 0x210f, 0x1c61, 0x29b1, 0x20e4, 0x1884, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x7fff, 0x0000
-};
-
+/* MissionCompleteScreen_data is compressed, load it with asset_load(ASSET_MISSIONCOMPLETESCREEN_DATA, dest) */
+/* MissionCompleteScreen_palette is compressed, load it with asset_load(ASSET_MISSIONCOMPLETESCREEN_PALETTE, dest) */
@@ -0,0 +1,22 @@
+/* assets.h
+ * generated by tools/assets.py, the names of the entries in the asset pack */
+
+#define ASSET_BACKGROUND_DATA 0xb0d50466
+#define ASSET_BACKGROUND_PALETTE 0x93c2ef61
+#define ASSET_GBA_SPRITES_DATA 0xc47dbe63
+#define ASSET_GBA_SPRITES_PALETTE 0xe027aba2
+#define ASSET_SCORE_BACKGROUND_DATA 0x58bfc2b3
+#define ASSET_SCORE_BACKGROUND_PALETTE 0xd24cb912
+#define ASSET_MISSIONCOMPLETESCREEN_DATA 0x83ff5dd7
+#define ASSET_MISSIONCOMPLETESCREEN_PALETTE 0x4e7f5186
+#define ASSET_GBA_METROID_TITLE_SCREEN_DATA 0xeea2e387
+#define ASSET_GBA_METROID_TITLE_SCREEN_PALETTE 0xde2a1a56
+#define ASSET_MAP 0xdfa2efb1
+#define ASSET_MAP1_METATILES 0x3d541635
+#define ASSET_MAP1 0x8d7f0680
+#define ASSET_MAP2_METATILES 0x93652e28
+#define ASSET_MAP2 0x907f0b39
+#define ASSET_GBATITLESCREENMAP 0x10107e63
+#define ASSET_GBATITLESCREENFINAL 0xdb8c0a59
+#define ASSET_MISSIONCOMPLETEMAP 0x4182f1e0
+#define ASSET_MUS_MAIN_18K_MONO 0xcc9f68ed
@@ -0,0 +1,38 @@
+/* assets.s */
+/* generated by tools/assets.py from assets.txt */
+
+/* the pack and everything in it start on a word so they can be copied with 32 bit DMA */
+/* (no @ comments, so the host build can assemble it too) */
+.section .rodata
+.balign 4
+.global asset_pack
+.type asset_pack,%object
+asset_pack:
+	.incbin "data/assets.pak"
+.size asset_pack,.-asset_pack
+
+.global GbaTitleScreenMap
+.set GbaTitleScreenMap,asset_pack+312
+.global map1_metatiles
+.set map1_metatiles,asset_pack+2360
+.global missionCompleteMap
+.set missionCompleteMap,asset_pack+3240
+.global map1
+.set map1,asset_pack+39228
+.global map2
+.set map2,asset_pack+39484
+.global map2_metatiles
+.set map2_metatiles,asset_pack+39996
+.global gba_sprites_data
+.set gba_sprites_data,asset_pack+53016
+.global mus_main_18K_mono
+.set mus_main_18K_mono,asset_pack+58136
+.global GbaTitleScreenFinal
+.set GbaTitleScreenFinal,asset_pack+217992
+.global map
+.set map,asset_pack+220608
+.global gba_sprites_palette
+.set gba_sprites_palette,asset_pack+222656
+
+/* nothing here runs from the stack, without this the host linker makes it executable */
+.section .note.GNU-stack,"",%progbits
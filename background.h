@@ -1,3242 +1,10 @@
 /* background.h
- * generated by png2gba program */
+ * generated by tools/assets.py from background.png, the data is in the asset pack */
 
 #define background_width 240
 #define background_height 160
+#define background_data_bytes 38400
+#define background_palette_bytes 512
 
-const unsigned char background_data [] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 
-    0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 
-    0x02, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x03, 0x02, 0x02, 0x03, 
-    0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 
-    0x03, 0x02, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x04, 0x05, 0x06, 0x06, 
-    0x06, 0x04, 0x03, 0x02, 0x04, 0x05, 0x06, 0x06, 0x06, 0x03, 0x02, 0x02, 
-    0x04, 0x05, 0x06, 0x06, 0x06, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 
-    0x05, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x04, 0x05, 0x05, 0x03, 0x03, 0x04, 0x04, 0x02, 0x03, 0x03, 0x03, 
-    0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 
-    0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x03, 0x03, 0x02, 0x03, 
-    0x04, 0x05, 0x05, 0x06, 0x02, 0x03, 0x03, 0x02, 0x04, 0x05, 0x05, 0x05, 
-    0x03, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x03, 
-    0x03, 0x03, 0x04, 0x04, 0x03, 0x05, 0x04, 0x04, 0x04, 0x04, 0x02, 0x03, 
-    0x04, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0x02, 0x05, 0x06, 0x05, 0x05, 
-    0x04, 0x04, 0x03, 0x02, 0x06, 0x06, 0x06, 0x05, 0x03, 0x04, 0x05, 0x05, 
-    0x06, 0x06, 0x05, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 
-    0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x07, 0x07, 0x06, 0x06, 0x07, 0x06, 
-    0x05, 0x07, 0x06, 0x06, 0x06, 0x06, 0x03, 0x06, 0x05, 0x05, 0x06, 0x06, 
-    0x06, 0x06, 0x05, 0x06, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 
-    0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 
-    0x05, 0x03, 0x08, 0x01, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0x08, 0x00, 
-    0x06, 0x05, 0x05, 0x04, 0x04, 0x03, 0x08, 0x00, 0x06, 0x06, 0x05, 0x04, 
-    0x03, 0x08, 0x01, 0x00, 0x06, 0x06, 0x05, 0x04, 0x08, 0x01, 0x01, 0x00, 
-    0x06, 0x05, 0x04, 0x03, 0x08, 0x01, 0x00, 0x00, 0x05, 0x04, 0x03, 0x08, 
-    0x01, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x08, 0x08, 0x05, 0x06, 0x06, 0x06, 0x08, 0x00, 0x00, 0x00, 0x08, 
-    0x08, 0x08, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07, 0x07, 0x07, 
-    0x06, 0x06, 0x06, 0x04, 0x01, 0x08, 0x08, 0x08, 0x07, 0x06, 0x06, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x08, 0x07, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x08, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x06, 0x05, 0x04, 0x04, 0x04, 0x03, 0x04, 0x06, 0x06, 0x06, 0x05, 
-    0x04, 0x04, 0x03, 0x04, 0x06, 0x06, 0x06, 0x06, 0x05, 0x03, 0x04, 0x05, 
-    0x07, 0x07, 0x07, 0x05, 0x04, 0x03, 0x04, 0x05, 0x08, 0x08, 0x08, 0x04, 
-    0x03, 0x04, 0x05, 0x07, 0x00, 0x00, 0x00, 0x08, 0x04, 0x05, 0x06, 0x06, 
-    0x00, 0x00, 0x00, 0x08, 0x05, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x08, 
-    0x05, 0x06, 0x06, 0x05, 0x04, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 0x04, 
-    0x05, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 
-    0x04, 0x06, 0x05, 0x05, 0x07, 0x07, 0x07, 0x07, 0x04, 0x06, 0x05, 0x05, 
-    0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 0x06, 0x04, 0x06, 0x06, 0x06, 0x06, 
-    0x07, 0x05, 0x04, 0x03, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 
-    0x04, 0x07, 0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 0x04, 0x03, 0x02, 0x02, 
-    0x03, 0x04, 0x08, 0x08, 0x04, 0x03, 0x03, 0x03, 0x03, 0x05, 0x08, 0x00, 
-    0x04, 0x03, 0x04, 0x03, 0x03, 0x05, 0x08, 0x00, 0x04, 0x03, 0x04, 0x04, 
-    0x03, 0x08, 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x08, 0x01, 0x00, 
-    0x04, 0x05, 0x05, 0x04, 0x04, 0x08, 0x00, 0x00, 0x05, 0x05, 0x06, 0x04, 
-    0x04, 0x08, 0x00, 0x00, 0x05, 0x05, 0x06, 0x07, 0x08, 0x01, 0x00, 0x00, 
-    0x07, 0x07, 0x05, 0x05, 0x05, 0x04, 0x03, 0x02, 0x08, 0x08, 0x08, 0x05, 
-    0x04, 0x03, 0x02, 0x04, 0x00, 0x00, 0x00, 0x08, 0x03, 0x02, 0x03, 0x04, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x04, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 
-    0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x06, 
-    0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 
-    0x06, 0x06, 0x07, 0x04, 0x05, 0x06, 0x05, 0x03, 0x05, 0x05, 0x04, 0x04, 
-    0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 
-    0x04, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x03, 0x03, 0x02, 0x03, 
-    0x03, 0x04, 0x06, 0x06, 0x03, 0x03, 0x02, 0x03, 0x04, 0x06, 0x05, 0x05, 
-    0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 0x01, 0x04, 0x04, 0x04, 0x04, 
-    0x04, 0x02, 0x02, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x01, 0x04, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x04, 0x02, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 
-    0x07, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x02, 0x05, 0x05, 0x06, 0x07, 
-    0x05, 0x04, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
-    0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 
-    0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x03, 
-    0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 
-    0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x04, 0x04, 
-    0x03, 0x03, 0x04, 0x04, 0x03, 0x04, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x04, 0x04, 0x03, 0x02, 
-    0x01, 0x02, 0x01, 0x01, 0x05, 0x04, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x01, 0x01, 0x02, 0x02, 
-    0x03, 0x04, 0x05, 0x05, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 
-    0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x04, 0x05, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 
-    0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x04, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 
-    0x05, 0x04, 0x04, 0x05, 0x04, 0x04, 0x03, 0x03, 0x05, 0x03, 0x04, 0x05, 
-    0x05, 0x04, 0x03, 0x03, 0x04, 0x03, 0x04, 0x05, 0x05, 0x05, 0x04, 0x03, 
-    0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x04, 0x03, 0x03, 0x04, 0x04, 0x04, 
-    0x05, 0x05, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x03, 
-    0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x08, 0x03, 0x04, 0x04, 0x04, 
-    0x04, 0x03, 0x04, 0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x05, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x04, 0x04, 0x04, 
-    0x04, 0x05, 0x06, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 
-    0x06, 0x06, 0x06, 0x05, 0x05, 0x04, 0x05, 0x02, 0x06, 0x06, 0x06, 0x06, 
-    0x06, 0x04, 0x05, 0x02, 0x05, 0x05, 0x06, 0x06, 0x06, 0x04, 0x03, 0x03, 
-    0x07, 0x07, 0x05, 0x05, 0x04, 0x03, 0x03, 0x05, 0x06, 0x06, 0x07, 0x07, 
-    0x07, 0x05, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x04, 0x06, 
-    0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x05, 0x06, 0x04, 0x05, 0x06, 0x06, 
-    0x06, 0x06, 0x05, 0x04, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x08, 0x08, 
-    0x03, 0x04, 0x04, 0x03, 0x03, 0x08, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 
-    0x08, 0x01, 0x00, 0x00, 0x05, 0x05, 0x04, 0x08, 0x01, 0x00, 0x00, 0x00, 
-    0x06, 0x06, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x05, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x08, 0x05, 0x06, 0x06, 0x05, 0x00, 0x00, 0x00, 0x01, 
-    0x08, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x05, 0x05, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 
-    0x05, 0x05, 0x08, 0x08, 0x05, 0x05, 0x05, 0x08, 0x08, 0x08, 0x01, 0x01, 
-    0x00, 0x08, 0x08, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x07, 0x08, 
-    0x01, 0x00, 0x00, 0x00, 0x04, 0x08, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x07, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05, 0x03, 
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x03, 0x03, 0x06, 0x06, 0x06, 0x07, 
-    0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x01, 0x01, 
-    0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x02, 0x04, 
-    0x06, 0x05, 0x05, 0x05, 0x03, 0x04, 0x06, 0x06, 0x05, 0x05, 0x05, 0x06, 
-    0x04, 0x07, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x08, 0x08, 0x07, 0x05, 
-    0x05, 0x04, 0x05, 0x05, 0x00, 0x01, 0x08, 0x07, 0x07, 0x05, 0x05, 0x05, 
-    0x00, 0x00, 0x00, 0x08, 0x08, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x04, 0x02, 0x06, 0x06, 0x05, 0x05, 
-    0x05, 0x06, 0x04, 0x02, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 
-    0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x05, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x04, 0x03, 0x07, 0x07, 0x07, 0x07, 0x04, 0x03, 0x03, 0x03, 
-    0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x08, 0x08, 0x08, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 
-    0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x03, 0x04, 0x05, 0x05, 
-    0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 
-    0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 
-    0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-    0x05, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 
-    0x03, 0x02, 0x02, 0x01, 0x05, 0x05, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 
-    0x04, 0x03, 0x03, 0x04, 0x03, 0x03, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 
-    0x04, 0x03, 0x02, 0x03, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 
-    0x06, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x07, 0x06, 0x05, 0x04, 
-    0x04, 0x04, 0x03, 0x03, 0x05, 0x07, 0x06, 0x05, 0x04, 0x04, 0x08, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 
-    0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 
-    0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 
-    0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 
-    0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 
-    0x01, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x01, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x03, 0x03, 0x03, 0x02, 
-    0x02, 0x03, 0x05, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 
-    0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 
-    0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 
-    0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 
-    0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 
-    0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x02, 0x03, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x03, 0x04, 0x05, 0x05, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 
-    0x04, 0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x05, 0x04, 0x04, 0x03, 
-    0x02, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 
-    0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x03, 0x02, 0x01, 0x01, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x03, 0x04, 0x04, 
-    0x04, 0x03, 0x02, 0x02, 0x03, 0x04, 0x05, 0x04, 0x04, 0x03, 0x02, 0x02, 
-    0x04, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 
-    0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 
-    0x01, 0x02, 0x03, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 
-    0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x02, 
-    0x02, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x04, 0x05, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 
-    0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x03, 0x04, 0x04, 0x05, 
-    0x05, 0x06, 0x06, 0x06, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 
-    0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x05, 0x06, 0x02, 0x02, 0x03, 0x03, 
-    0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x08, 0x00, 
-    0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x08, 0x00, 0x07, 0x05, 0x06, 0x06, 
-    0x06, 0x07, 0x08, 0x00, 0x07, 0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x00, 
-    0x06, 0x07, 0x05, 0x07, 0x07, 0x00, 0x00, 0x00, 0x06, 0x06, 0x07, 0x08, 
-    0x08, 0x00, 0x00, 0x00, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x04, 0x04, 
-    0x04, 0x05, 0x06, 0x06, 0x08, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 
-    0x00, 0x00, 0x08, 0x04, 0x05, 0x06, 0x06, 0x06, 0x00, 0x00, 0x01, 0x08, 
-    0x08, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x08, 0x08, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x04, 0x08, 0x06, 0x06, 0x06, 0x06, 
-    0x05, 0x08, 0x08, 0x01, 0x06, 0x06, 0x05, 0x05, 0x08, 0x01, 0x00, 0x00, 
-    0x05, 0x05, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-    0x08, 0x05, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x00, 0x08, 0x05, 0x05, 
-    0x07, 0x07, 0x06, 0x06, 0x00, 0x00, 0x08, 0x08, 0x05, 0x05, 0x07, 0x07, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x06, 0x05, 
-    0x04, 0x04, 0x08, 0x08, 0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x08, 0x08, 
-    0x06, 0x06, 0x06, 0x06, 0x05, 0x08, 0x00, 0x08, 0x07, 0x06, 0x05, 0x05, 
-    0x08, 0x00, 0x00, 0x00, 0x05, 0x05, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 
-    0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 
-    0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 
-    0x01, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 
-    0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 
-    0x03, 0x02, 0x03, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x03, 0x04, 0x03, 
-    0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x04, 0x04, 0x03, 0x04, 0x02, 0x02, 
-    0x03, 0x04, 0x04, 0x05, 0x03, 0x04, 0x03, 0x02, 0x03, 0x04, 0x05, 0x05, 
-    0x05, 0x04, 0x03, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x03, 0x02, 
-    0x04, 0x05, 0x05, 0x06, 0x06, 0x05, 0x03, 0x02, 0x04, 0x05, 0x06, 0x06, 
-    0x06, 0x06, 0x05, 0x02, 0x03, 0x04, 0x05, 0x07, 0x06, 0x06, 0x05, 0x02, 
-    0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 
-    0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x04, 0x05, 0x05, 
-    0x02, 0x05, 0x04, 0x02, 0x03, 0x04, 0x05, 0x05, 0x03, 0x03, 0x02, 0x02, 
-    0x03, 0x04, 0x05, 0x06, 0x03, 0x03, 0x03, 0x02, 0x03, 0x05, 0x05, 0x05, 
-    0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x05, 0x03, 0x03, 0x03, 0x04, 
-    0x04, 0x02, 0x03, 0x04, 0x04, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 
-    0x06, 0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x06, 0x04, 0x03, 0x03, 
-    0x03, 0x02, 0x01, 0x02, 0x06, 0x05, 0x04, 0x04, 0x03, 0x02, 0x02, 0x02, 
-    0x06, 0x06, 0x06, 0x07, 0x04, 0x03, 0x02, 0x03, 0x06, 0x06, 0x06, 0x06, 
-    0x07, 0x04, 0x03, 0x03, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x04, 0x03, 
-    0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x08, 0x03, 0x04, 0x04, 0x04, 
-    0x04, 0x05, 0x05, 0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 
-    0x03, 0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 
-    0x06, 0x05, 0x05, 0x05, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 
-    0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 
-    0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-    0x05, 0x05, 0x04, 0x04, 0x03, 0x02, 0x02, 0x03, 0x05, 0x05, 0x04, 0x03, 
-    0x03, 0x02, 0x02, 0x04, 0x04, 0x03, 0x03, 0x04, 0x03, 0x03, 0x02, 0x04, 
-    0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x05, 0x05, 0x05, 0x04, 0x04, 
-    0x04, 0x03, 0x02, 0x05, 0x06, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 
-    0x07, 0x06, 0x05, 0x04, 0x04, 0x04, 0x03, 0x06, 0x05, 0x07, 0x06, 0x05, 
-    0x04, 0x04, 0x08, 0x08, 0x04, 0x05, 0x05, 0x05, 0x04, 0x03, 0x03, 0x02, 
-    0x05, 0x05, 0x06, 0x05, 0x04, 0x04, 0x03, 0x03, 0x05, 0x05, 0x04, 0x05, 
-    0x04, 0x04, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 
-    0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 
-    0x07, 0x05, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x05, 0x05, 
-    0x08, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x02, 0x03, 0x04, 0x03, 
-    0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 
-    0x02, 0x03, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 
-    0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 
-    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 
-    0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x08, 0x08, 
-    0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x04, 0x03, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x05, 0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 
-    0x04, 0x05, 0x05, 0x04, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 
-    0x06, 0x07, 0x07, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x08, 0x08, 0x08, 
-    0x06, 0x07, 0x07, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x05, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00, 0x01, 
-    0x08, 0x08, 0x08, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x09, 0x01, 0x01, 0x09, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0A, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0C, 0x01, 0x01, 0x01, 0x0A, 
-    0x0B, 0x0A, 0x09, 0x0B, 0x09, 0x01, 0x0A, 0x0C, 0x0A, 0x0A, 0x0B, 0x0C, 
-    0x01, 0x01, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A, 0x0C, 0x0A, 0x01, 0x0A, 0x0C, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 
-    0x04, 0x04, 0x03, 0x02, 0x03, 0x01, 0x02, 0x01, 0x04, 0x04, 0x04, 0x03, 
-    0x03, 0x02, 0x03, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x01, 
-    0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x02, 0x04, 0x06, 0x06, 0x06, 
-    0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 
-    0x04, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x04, 0x04, 0x03, 0x02, 0x03, 
-    0x02, 0x02, 0x03, 0x04, 0x04, 0x03, 0x03, 0x03, 0x01, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x01, 
-    0x02, 0x03, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x04, 0x04, 0x03, 
-    0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 
-    0x04, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 
-    0x03, 0x02, 0x01, 0x04, 0x03, 0x03, 0x04, 0x04, 0x03, 0x03, 0x01, 0x04, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x04, 0x05, 0x04, 0x04, 0x04, 
-    0x04, 0x03, 0x02, 0x04, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 
-    0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 
-    0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x06, 0x06, 
-    0x04, 0x05, 0x07, 0x06, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x04, 0x04, 
-    0x05, 0x05, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x02, 0x02, 
-    0x02, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x04, 0x05, 
-    0x03, 0x03, 0x03, 0x02, 0x03, 0x04, 0x05, 0x06, 0x04, 0x03, 0x03, 0x02, 
-    0x03, 0x03, 0x05, 0x06, 0x06, 0x04, 0x03, 0x02, 0x03, 0x03, 0x03, 0x05, 
-    0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x04, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x06, 0x06, 0x06, 0x05, 
-    0x05, 0x05, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x04, 
-    0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x05, 0x04, 0x06, 0x05, 0x04, 0x07, 
-    0x06, 0x06, 0x05, 0x04, 0x04, 0x05, 0x05, 0x05, 0x07, 0x07, 0x08, 0x01, 
-    0x03, 0x04, 0x05, 0x08, 0x08, 0x08, 0x01, 0x01, 0x02, 0x03, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x05, 0x06, 0x06, 
-    0x06, 0x06, 0x06, 0x06, 0x08, 0x05, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 
-    0x00, 0x08, 0x05, 0x05, 0x07, 0x07, 0x06, 0x06, 0x00, 0x00, 0x08, 0x08, 
-    0x05, 0x05, 0x07, 0x07, 0x00, 0x00, 0x01, 0x01, 0x08, 0x08, 0x05, 0x05, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x05, 0x06, 0x05, 0x04, 0x04, 0x08, 0x01, 0x06, 0x06, 0x06, 0x06, 
-    0x05, 0x04, 0x08, 0x00, 0x06, 0x06, 0x06, 0x06, 0x05, 0x08, 0x01, 0x00, 
-    0x07, 0x06, 0x05, 0x05, 0x08, 0x01, 0x00, 0x00, 0x05, 0x05, 0x08, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x0A, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x09, 0x0B, 0x09, 0x01, 0x00, 0x08, 0x08, 0x05, 0x06, 0x06, 0x06, 0x08, 
-    0x00, 0x01, 0x09, 0x08, 0x08, 0x08, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x09, 0x09, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0C, 0x08, 0x08, 0x08, 0x08, 
-    0x08, 0x08, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 
-    0x0A, 0x0A, 0x01, 0x01, 0x0C, 0x0A, 0x01, 0x0A, 0x0B, 0x0C, 0x01, 0x01, 
-    0x0B, 0x09, 0x0A, 0x0C, 0x0C, 0x0B, 0x01, 0x01, 0x0C, 0x0C, 0x0C, 0x0C, 
-    0x0C, 0x09, 0x01, 0x01, 0x0C, 0x0C, 0x0B, 0x0B, 0x0C, 0x01, 0x01, 0x09, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x01, 0x01, 0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0A, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x09, 0x0C, 0x0B, 0x0A, 
-    0x09, 0x01, 0x09, 0x01, 0x01, 0x0C, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0C, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x09, 0x01, 0x01, 
-    0x01, 0x09, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x01, 0x09, 
-    0x0B, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0A, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x09, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x0B, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0C, 0x0C, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0D, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0A, 0x0A, 0x0A, 0x0B, 
-    0x0A, 0x01, 0x0A, 0x0C, 0x0B, 0x0A, 0x0A, 0x0C, 0x0C, 0x09, 0x0A, 0x0C, 
-    0x0C, 0x0B, 0x0B, 0x0C, 0x0C, 0x0A, 0x0C, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 
-    0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 
-    0x0D, 0x0E, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0F, 0x10, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 
-    0x05, 0x04, 0x06, 0x06, 0x06, 0x04, 0x03, 0x02, 0x06, 0x05, 0x04, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x06, 0x06, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 
-    0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x04, 0x04, 
-    0x03, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 
-    0x04, 0x05, 0x04, 0x04, 0x03, 0x02, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 
-    0x03, 0x02, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x02, 0x01, 0x04, 
-    0x05, 0x05, 0x04, 0x04, 0x03, 0x02, 0x01, 0x05, 0x05, 0x05, 0x05, 0x04, 
-    0x03, 0x02, 0x01, 0x01, 0x05, 0x05, 0x05, 0x03, 0x03, 0x02, 0x02, 0x01, 
-    0x03, 0x03, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x03, 0x03, 0x04, 0x02, 
-    0x03, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x08, 0x05, 0x06, 0x06, 0x06, 
-    0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 
-    0x05, 0x07, 0x07, 0x07, 0x05, 0x06, 0x07, 0x04, 0x05, 0x06, 0x06, 0x06, 
-    0x07, 0x05, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-    0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x04, 0x05, 0x05, 
-    0x06, 0x06, 0x06, 0x06, 0x08, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 
-    0x07, 0x05, 0x04, 0x04, 0x04, 0x03, 0x02, 0x04, 0x06, 0x07, 0x04, 0x04, 
-    0x04, 0x03, 0x02, 0x04, 0x06, 0x06, 0x07, 0x04, 0x04, 0x03, 0x02, 0x05, 
-    0x06, 0x06, 0x07, 0x04, 0x04, 0x03, 0x02, 0x05, 0x06, 0x06, 0x06, 0x07, 
-    0x05, 0x03, 0x02, 0x04, 0x06, 0x06, 0x06, 0x07, 0x05, 0x03, 0x02, 0x03, 
-    0x06, 0x06, 0x06, 0x06, 0x04, 0x03, 0x02, 0x07, 0x05, 0x05, 0x05, 0x05, 
-    0x04, 0x08, 0x08, 0x08, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
-    0x06, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 
-    0x04, 0x04, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x07, 0x07, 
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x04, 0x02, 
-    0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x06, 0x06, 0x04, 0x03, 0x03, 0x03, 
-    0x06, 0x05, 0x05, 0x05, 0x07, 0x04, 0x08, 0x08, 0x04, 0x05, 0x05, 0x07, 
-    0x08, 0x00, 0x00, 0x00, 0x05, 0x07, 0x07, 0x08, 0x01, 0x00, 0x00, 0x00, 
-    0x07, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 
-    0x06, 0x06, 0x06, 0x08, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x08, 
-    0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x08, 0x01, 0x00, 0x00, 0x00, 0x08, 
-    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0B, 0x01, 
-    0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0C, 0x01, 0x0A, 0x09, 0x01, 
-    0x01, 0x0C, 0x0C, 0x0C, 0x01, 0x09, 0x09, 0x01, 0x01, 0x0A, 0x0C, 0x09, 
-    0x01, 0x0B, 0x0A, 0x09, 0x01, 0x0A, 0x0C, 0x01, 0x01, 0x0C, 0x0A, 0x09, 
-    0x01, 0x0C, 0x0C, 0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x0C, 0x01, 
-    0x01, 0x0C, 0x0B, 0x0B, 0x0B, 0x0C, 0x0B, 0x01, 0x0C, 0x0C, 0x0A, 0x0A, 
-    0x0B, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 0x0C, 0x09, 0x01, 0x01, 0x09, 0x0A, 
-    0x0A, 0x0C, 0x0C, 0x0A, 0x01, 0x01, 0x0B, 0x09, 0x01, 0x01, 0x0C, 0x0A, 
-    0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x0C, 0x09, 
-    0x01, 0x01, 0x01, 0x0A, 0x0A, 0x0A, 0x0C, 0x01, 0x01, 0x01, 0x09, 0x0A, 
-    0x0B, 0x0B, 0x0C, 0x01, 0x09, 0x0A, 0x0A, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0C, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x0C, 0x0B, 0x0B, 
-    0x01, 0x01, 0x01, 0x09, 0x0B, 0x0C, 0x0A, 0x01, 0x0A, 0x01, 0x09, 0x09, 
-    0x0B, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x09, 0x01, 0x01, 0x01, 
-    0x01, 0x0A, 0x0C, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0C, 0x0C, 
-    0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0C, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x01, 0x01, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0A, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x0A, 0x09, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0A, 
-    0x0A, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x0C, 0x0A, 0x01, 0x0B, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x09, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x0A, 0x09, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 
-    0x0A, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0C, 0x0A, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x09, 
-    0x0A, 0x0B, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x0C, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x09, 0x0D, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x10, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 
-    0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0C, 0x0D, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0F, 0x11, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0E, 0x10, 0x11, 
-    0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0E, 0x10, 0x11, 0x0B, 0x0C, 0x0C, 0x0D, 
-    0x0D, 0x0E, 0x0E, 0x10, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x04, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 
-    0x04, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x06, 0x05, 0x05, 
-    0x07, 0x07, 0x07, 0x07, 0x04, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 
-    0x05, 0x04, 0x06, 0x04, 0x06, 0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 0x03, 
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x05, 0x04, 0x04, 0x07, 0x06, 0x06, 
-    0x06, 0x07, 0x05, 0x04, 0x04, 0x03, 0x02, 0x02, 0x03, 0x04, 0x08, 0x00, 
-    0x04, 0x03, 0x03, 0x03, 0x03, 0x05, 0x08, 0x00, 0x04, 0x03, 0x04, 0x03, 
-    0x03, 0x05, 0x08, 0x00, 0x04, 0x03, 0x04, 0x04, 0x03, 0x08, 0x01, 0x00, 
-    0x03, 0x04, 0x04, 0x04, 0x04, 0x08, 0x00, 0x00, 0x04, 0x05, 0x05, 0x04, 
-    0x04, 0x08, 0x00, 0x00, 0x05, 0x05, 0x06, 0x04, 0x04, 0x08, 0x00, 0x00, 
-    0x05, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 
-    0x08, 0x08, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x05, 0x04, 0x08, 0x08, 0x01, 0x00, 0x00, 0x08, 0x08, 0x08, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x09, 0x0C, 0x0A, 
-    0x0C, 0x0C, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0A, 0x0B, 
-    0x01, 0x0C, 0x09, 0x0B, 0x0C, 0x0B, 0x0A, 0x0B, 0x0B, 0x0C, 0x09, 0x0B, 
-    0x0C, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x09, 0x01, 0x01, 0x0C, 
-    0x0B, 0x0A, 0x0C, 0x0B, 0x09, 0x01, 0x01, 0x0D, 0x01, 0x09, 0x09, 0x09, 
-    0x01, 0x0A, 0x0A, 0x0D, 0x0C, 0x0C, 0x09, 0x0C, 0x0C, 0x0C, 0x0B, 0x0A, 
-    0x0C, 0x0B, 0x09, 0x0C, 0x0B, 0x0C, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x0C, 
-    0x0B, 0x0A, 0x0B, 0x0B, 0x0C, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 
-    0x0B, 0x0A, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0B, 0x0C, 
-    0x0C, 0x0C, 0x0C, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 
-    0x0B, 0x0A, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0A, 0x0A, 0x0A, 0x0B, 
-    0x0C, 0x0C, 0x0B, 0x0B, 0x0A, 0x09, 0x0A, 0x0B, 0x0C, 0x0A, 0x0A, 0x0B, 
-    0x0C, 0x0C, 0x0C, 0x0A, 0x0A, 0x09, 0x0A, 0x09, 0x0D, 0x0D, 0x0C, 0x0A, 
-    0x09, 0x09, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0A, 0x09, 0x09, 0x0B, 0x0C, 
-    0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0D, 0x0C, 0x0D, 0x0D, 0x0E, 0x0D, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0E, 
-    0x0B, 0x0A, 0x0A, 0x01, 0x09, 0x0B, 0x0A, 0x0A, 0x0C, 0x0C, 0x0B, 0x09, 
-    0x01, 0x01, 0x0A, 0x0C, 0x0C, 0x0C, 0x0B, 0x0A, 0x01, 0x09, 0x01, 0x0C, 
-    0x0C, 0x0D, 0x0C, 0x0B, 0x09, 0x0B, 0x0A, 0x0B, 0x0D, 0x0D, 0x0D, 0x0C, 
-    0x0B, 0x0C, 0x0C, 0x0A, 0x0D, 0x0E, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0A, 
-    0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C, 0x0D, 0x0C, 0x0E, 0x0E, 0x0E, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x01, 0x01, 0x09, 0x0A, 0x0B, 0x0A, 0x09, 
-    0x0C, 0x0A, 0x01, 0x01, 0x0B, 0x0A, 0x0B, 0x01, 0x0B, 0x09, 0x01, 0x01, 
-    0x09, 0x0A, 0x09, 0x01, 0x0A, 0x09, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01, 
-    0x0A, 0x0A, 0x09, 0x01, 0x0C, 0x0C, 0x01, 0x01, 0x0B, 0x0A, 0x0A, 0x01, 
-    0x0C, 0x0C, 0x01, 0x09, 0x0C, 0x0C, 0x0B, 0x09, 0x0C, 0x0D, 0x0A, 0x09, 
-    0x0D, 0x0D, 0x0C, 0x0C, 0x0D, 0x0D, 0x0C, 0x0A, 0x01, 0x01, 0x0C, 0x0A, 
-    0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0B, 0x0C, 0x09, 0x09, 
-    0x01, 0x01, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x0B, 
-    0x0A, 0x09, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x09, 0x0C, 0x0A, 
-    0x09, 0x09, 0x01, 0x01, 0x0B, 0x09, 0x0B, 0x0C, 0x01, 0x09, 0x09, 0x09, 
-    0x0B, 0x0B, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x09, 0x09, 0x0B, 0x09, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x09, 0x0C, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0A, 0x01, 0x09, 0x01, 0x01, 0x01, 
-    0x09, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 
-    0x09, 0x0A, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 
-    0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0B, 0x01, 0x09, 
-    0x01, 0x0A, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0A, 0x0B, 0x0C, 0x0C, 
-    0x0C, 0x0C, 0x0C, 0x0C, 0x0A, 0x0C, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 
-    0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 
-    0x0C, 0x0A, 0x09, 0x01, 0x0C, 0x0A, 0x01, 0x09, 0x0B, 0x09, 0x0A, 0x0B, 
-    0x0B, 0x0A, 0x01, 0x01, 0x0C, 0x0B, 0x0A, 0x0A, 0x0C, 0x0A, 0x01, 0x0A, 
-    0x0C, 0x0A, 0x0A, 0x0A, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0C, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0D, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0A, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0D, 0x0E, 
-    0x01, 0x0A, 0x0C, 0x0D, 0x0D, 0x0D, 0x0C, 0x0D, 0x01, 0x01, 0x0B, 0x0B, 
-    0x0C, 0x0B, 0x0A, 0x0A, 0x0A, 0x09, 0x0B, 0x09, 0x09, 0x0A, 0x09, 0x0B, 
-    0x0B, 0x0A, 0x0A, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x09, 0x0A, 0x0B, 0x01, 
-    0x01, 0x0A, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 
-    0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x06, 
-    0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x08, 0x08, 
-    0x05, 0x05, 0x05, 0x08, 0x08, 0x08, 0x01, 0x01, 0x08, 0x08, 0x08, 0x01, 
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x07, 0x08, 0x01, 0x00, 0x00, 0x00, 
-    0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0A, 0x0B, 0x09, 0x01, 0x0B, 0x0C, 0x0D, 0x0A, 0x0B, 0x0A, 0x01, 
-    0x01, 0x0C, 0x0D, 0x0D, 0x0A, 0x0C, 0x0C, 0x01, 0x09, 0x0D, 0x0D, 0x0E, 
-    0x01, 0x0C, 0x0C, 0x0A, 0x0C, 0x0D, 0x0E, 0x0E, 0x01, 0x0A, 0x0C, 0x0D, 
-    0x0D, 0x0E, 0x0E, 0x0E, 0x01, 0x01, 0x0B, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 
-    0x01, 0x01, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x10, 0x01, 0x01, 0x09, 0x0C, 
-    0x0D, 0x0F, 0x10, 0x11, 0x0A, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 
-    0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0F, 0x0E, 0x0F, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x10, 0x0F, 0x0F, 0x0F, 
-    0x0F, 0x0E, 0x0E, 0x0E, 0x11, 0x11, 0x10, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 
-    0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0E, 
-    0x10, 0x0F, 0x0E, 0x0E, 0x0F, 0x0E, 0x0F, 0x0F, 0x10, 0x10, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0E, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0A, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0D, 0x0C, 0x0A, 0x0E, 0x0D, 0x0C, 0x0D, 
-    0x0E, 0x0D, 0x0C, 0x0C, 0x0E, 0x0E, 0x0D, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0C, 0x0A, 0x0A, 
-    0x0A, 0x01, 0x01, 0x0A, 0x0D, 0x0C, 0x0D, 0x0C, 0x0B, 0x09, 0x01, 0x01, 
-    0x0E, 0x0D, 0x0D, 0x0C, 0x0B, 0x0A, 0x0A, 0x09, 0x0E, 0x0E, 0x0D, 0x0C, 
-    0x0C, 0x0B, 0x0A, 0x09, 0x0E, 0x0E, 0x0D, 0x0B, 0x0C, 0x0B, 0x0A, 0x0C, 
-    0x0B, 0x09, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x09, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x09, 0x01, 0x01, 0x01, 
-    0x0B, 0x09, 0x01, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0A, 0x09, 0x0C, 0x0B, 0x0A, 0x0B, 0x09, 0x09, 0x0A, 
-    0x09, 0x0C, 0x0A, 0x0B, 0x0D, 0x0D, 0x0C, 0x0C, 0x09, 0x0C, 0x0C, 0x0D, 
-    0x0F, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C, 0x0D, 0x0E, 0x0F, 0x0E, 0x0D, 0x0D, 
-    0x0B, 0x0A, 0x0C, 0x0D, 0x0F, 0x0E, 0x0E, 0x0E, 0x0A, 0x0C, 0x0D, 0x0F, 
-    0x10, 0x0E, 0x0E, 0x0F, 0x0C, 0x0C, 0x0E, 0x10, 0x10, 0x0E, 0x0E, 0x0F, 
-    0x0C, 0x0C, 0x0D, 0x10, 0x10, 0x10, 0x0F, 0x10, 0x0C, 0x0C, 0x0D, 0x0C, 
-    0x0C, 0x0C, 0x0C, 0x0A, 0x0C, 0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0B, 
-    0x0D, 0x0E, 0x0E, 0x0D, 0x0D, 0x0B, 0x0B, 0x0C, 0x0E, 0x0E, 0x0E, 0x0D, 
-    0x0D, 0x0C, 0x0C, 0x0D, 0x0F, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0D, 
-    0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0E, 0x10, 0x0E, 0x0E, 0x0F, 
-    0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x0E, 0x0E, 0x10, 0x0F, 0x0E, 0x0E, 0x10, 
-    0x0C, 0x0A, 0x01, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A, 0x0C, 0x0A, 0x09, 0x0C, 
-    0x0C, 0x0A, 0x0A, 0x0B, 0x0D, 0x0C, 0x0A, 0x0C, 0x0C, 0x0B, 0x0B, 0x0C, 
-    0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0D, 0x0C, 
-    0x0C, 0x0D, 0x0D, 0x0D, 0x0F, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0E, 0x0D, 
-    0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x09, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0B, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0C, 0x0C, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x0D, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 
-    0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x10, 0x11, 0x11, 0x09, 0x0B, 0x0C, 0x0D, 
-    0x0F, 0x11, 0x11, 0x11, 0x09, 0x0B, 0x0D, 0x0E, 0x11, 0x11, 0x11, 0x11, 
-    0x0B, 0x0C, 0x0C, 0x0F, 0x11, 0x11, 0x11, 0x11, 0x01, 0x0C, 0x0C, 0x0F, 
-    0x11, 0x11, 0x11, 0x11, 0x01, 0x0B, 0x0C, 0x0F, 0x11, 0x11, 0x11, 0x11, 
-    0x01, 0x01, 0x0C, 0x0F, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x09, 0x0C, 0x0E, 
-    0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x10, 0x10, 0x10, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x10, 0x10, 
-    0x10, 0x10, 0x0E, 0x0F, 0x10, 0x0F, 0x10, 0x11, 0x11, 0x10, 0x0F, 0x0F, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0F, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x0F, 0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0F, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0F, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x10, 0x11, 0x11, 
-    0x0E, 0x0E, 0x0E, 0x0F, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x0E, 0x0D, 0x0C, 
-    0x0C, 0x0C, 0x01, 0x09, 0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x0C, 0x01, 0x01, 
-    0x0E, 0x0F, 0x0E, 0x10, 0x0E, 0x0D, 0x0C, 0x01, 0x0E, 0x10, 0x0F, 0x10, 
-    0x0F, 0x0D, 0x0C, 0x0C, 0x10, 0x10, 0x11, 0x10, 0x0E, 0x0C, 0x0C, 0x0C, 
-    0x10, 0x11, 0x11, 0x11, 0x10, 0x0E, 0x0D, 0x0C, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x0F, 0x0D, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0E, 0x0D, 
-    0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x09, 
-    0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x0B, 0x09, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x0A, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x0C, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x0A, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0E, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x0C, 0x0D, 0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0B, 0x0C, 0x0E, 0x10, 
-    0x11, 0x11, 0x11, 0x11, 0x09, 0x0A, 0x0C, 0x0F, 0x11, 0x11, 0x11, 0x11, 
-    0x0C, 0x0C, 0x0C, 0x0E, 0x10, 0x11, 0x11, 0x11, 0x0A, 0x0A, 0x0A, 0x0D, 
-    0x0F, 0x11, 0x11, 0x11, 0x09, 0x0B, 0x0C, 0x0E, 0x10, 0x10, 0x11, 0x11, 
-    0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0D, 0x0F, 0x11, 0x10, 0x0F, 0x10, 0x10, 
-    0x10, 0x0E, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x10, 0x10, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 
-    0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x10, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0D, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 
-    0x11, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x11, 0x10, 0x0E, 0x0E, 
-    0x0E, 0x0D, 0x0C, 0x0C, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 
-    0x10, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0D, 0x0D, 0x0C, 0x0B, 0x0C, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0B, 0x0A, 
-    0x09, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x0B, 0x0A, 0x0A, 0x01, 0x01, 0x01, 
-    0x0C, 0x0B, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0C, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0B, 0x0B, 0x0D, 0x0E, 0x11, 0x11, 0x11, 0x0A, 0x0B, 0x0C, 0x0A, 
-    0x0D, 0x10, 0x10, 0x11, 0x0A, 0x0B, 0x0C, 0x09, 0x0C, 0x0F, 0x11, 0x11, 
-    0x09, 0x09, 0x0C, 0x0A, 0x0B, 0x0E, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0E, 0x11, 0x11, 0x0A, 0x09, 0x01, 0x0A, 0x0D, 0x10, 0x11, 0x11, 
-    0x01, 0x0B, 0x0B, 0x0D, 0x0E, 0x11, 0x11, 0x11, 0x01, 0x0B, 0x0B, 0x0C, 
-    0x0D, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0F, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x11, 0x0F, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x11, 0x11, 0x11, 
-    0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x10, 0x11, 0x11, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x10, 0x11, 0x11, 0x11, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x11, 0x11, 0x11, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x11, 0x11, 0x11, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0F, 0x10, 0x10, 0x11, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x10, 0x11, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x0F, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0D, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0E, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x0D, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0D, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0E, 
-    0x01, 0x09, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x0A, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0B, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0A, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 
-    0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x0B, 0x0A, 0x0C, 0x0C, 0x0D, 0x0F, 
-    0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0B, 0x0C, 0x0D, 0x0B, 0x0B, 0x0A, 0x09, 
-    0x09, 0x0B, 0x0B, 0x0C, 0x0C, 0x0A, 0x09, 0x09, 0x01, 0x0A, 0x0C, 0x0C, 
-    0x0A, 0x0A, 0x01, 0x09, 0x0A, 0x0A, 0x0A, 0x0C, 0x0B, 0x0C, 0x01, 0x01, 
-    0x0B, 0x0B, 0x09, 0x0A, 0x09, 0x0B, 0x0B, 0x09, 0x01, 0x01, 0x0A, 0x09, 
-    0x01, 0x09, 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x11, 0x10, 0x0E, 0x0F, 0x10, 0x0F, 0x0F, 0x10, 0x10, 0x0E, 0x0E, 
-    0x0D, 0x0D, 0x0C, 0x0D, 0x0E, 0x0F, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 
-    0x0D, 0x0D, 0x0C, 0x0A, 0x0C, 0x0B, 0x0A, 0x09, 0x0A, 0x0C, 0x0C, 0x0C, 
-    0x0A, 0x0C, 0x0A, 0x01, 0x09, 0x0C, 0x0C, 0x0B, 0x0A, 0x0B, 0x0A, 0x09, 
-    0x09, 0x0A, 0x09, 0x09, 0x0B, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 0x0B, 0x0E, 0x0D, 0x0E, 0x0E, 
-    0x0D, 0x0C, 0x0C, 0x0A, 0x0D, 0x0C, 0x0D, 0x0D, 0x0D, 0x0C, 0x0A, 0x01, 
-    0x0A, 0x0A, 0x0B, 0x0C, 0x0B, 0x0B, 0x01, 0x01, 0x0B, 0x09, 0x0A, 0x09, 
-    0x09, 0x0B, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 
-    0x0C, 0x0C, 0x0A, 0x01, 0x01, 0x0B, 0x0A, 0x09, 0x0A, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x09, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0A, 0x0B, 0x0C, 0x0F, 0x11, 0x11, 0x01, 0x01, 0x0C, 0x0B, 
-    0x0C, 0x0F, 0x11, 0x11, 0x01, 0x0A, 0x0B, 0x0B, 0x0C, 0x0F, 0x11, 0x11, 
-    0x09, 0x0B, 0x0C, 0x0C, 0x0E, 0x10, 0x11, 0x11, 0x0A, 0x0C, 0x0B, 0x0C, 
-    0x0F, 0x11, 0x11, 0x11, 0x09, 0x0C, 0x0B, 0x0D, 0x0F, 0x11, 0x11, 0x11, 
-    0x09, 0x09, 0x0B, 0x0C, 0x0E, 0x10, 0x11, 0x11, 0x01, 0x01, 0x0C, 0x0C, 
-    0x0C, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x0E, 
-    0x11, 0x10, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x11, 0x10, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x11, 0x11, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x11, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x10, 0x11, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0D, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0D, 0x10, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x0E, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 
-    0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x0E, 0x10, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x10, 0x10, 0x11, 0x10, 0x0E, 0x0D, 
-    0x0B, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0D, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x09, 0x01, 0x09, 0x01, 0x01, 0x01, 
-    0x0A, 0x0A, 0x0C, 0x01, 0x09, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0C, 0x09, 
-    0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x09, 
-    0x0B, 0x0B, 0x01, 0x09, 0x0B, 0x0C, 0x0D, 0x0C, 0x0A, 0x0B, 0x01, 0x0A, 
-    0x0C, 0x0C, 0x0D, 0x0C, 0x0A, 0x01, 0x0A, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x0B, 0x0C, 0x0D, 0x0B, 0x0D, 0x0E, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x0A, 0x09, 0x01, 0x01, 0x01, 
-    0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A, 
-    0x0A, 0x09, 0x01, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x01, 0x01, 0x0B, 
-    0x0B, 0x09, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0D, 0x0C, 0x0B, 0x0C, 0x0C, 
-    0x0D, 0x0D, 0x0D, 0x0E, 0x01, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0A, 
-    0x0A, 0x09, 0x09, 0x01, 0x0A, 0x01, 0x09, 0x0C, 0x0B, 0x01, 0x0A, 0x0A, 
-    0x0B, 0x0A, 0x01, 0x0B, 0x0B, 0x0B, 0x0C, 0x0A, 0x0C, 0x0A, 0x09, 0x0C, 
-    0x0D, 0x0C, 0x0C, 0x0C, 0x0D, 0x0B, 0x0A, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x0D, 0x0C, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x0C, 0x0B, 0x0C, 0x0E, 0x11, 0x11, 0x01, 0x01, 0x0C, 0x0C, 
-    0x0D, 0x10, 0x10, 0x11, 0x09, 0x01, 0x0A, 0x0C, 0x0C, 0x0F, 0x11, 0x11, 
-    0x01, 0x01, 0x09, 0x0C, 0x0C, 0x0F, 0x11, 0x11, 0x01, 0x01, 0x01, 0x0C, 
-    0x0D, 0x0F, 0x11, 0x11, 0x01, 0x01, 0x01, 0x0B, 0x0D, 0x0F, 0x11, 0x11, 
-    0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0E, 0x11, 0x11, 0x01, 0x01, 0x01, 0x0B, 
-    0x0C, 0x0D, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0E, 
-    0x11, 0x10, 0x11, 0x11, 0x10, 0x10, 0x0F, 0x0E, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x0E, 0x0E, 0x0E, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 
-    0x11, 0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x10, 0x10, 0x10, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x11, 
-    0x10, 0x0E, 0x0D, 0x0C, 0x0E, 0x0E, 0x0E, 0x0F, 0x0E, 0x0D, 0x0C, 0x0C, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0D, 0x0C, 0x0A, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0A, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0D, 0x0C, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 0x09, 
-    0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0C, 0x0A, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x09, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x0B, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x0A, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0D, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0D, 0x0E, 0x0F, 0x0D, 0x0E, 0x0E, 0x0D, 
-    0x0D, 0x0F, 0x10, 0x0E, 0x0E, 0x10, 0x10, 0x0E, 0x0E, 0x10, 0x10, 0x10, 
-    0x0D, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x10, 0x0E, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x0D, 0x0C, 0x0C, 0x0D, 0x0E, 0x0D, 0x0D, 0x0F, 0x0D, 0x0C, 0x0C, 0x0E, 
-    0x10, 0x0E, 0x0E, 0x0F, 0x0E, 0x0D, 0x0E, 0x10, 0x11, 0x11, 0x10, 0x10, 
-    0x10, 0x0E, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x0D, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0C, 0x0D, 
-    0x0E, 0x0D, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x0E, 0x0D, 0x0D, 
-    0x0E, 0x0D, 0x0E, 0x0E, 0x11, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x10, 0x10, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x11, 0x11, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0C, 0x0C, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0E, 0x0D, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0D, 0x0C, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x0D, 0x0C, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x0D, 0x0A, 0x09, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0C, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x0D, 0x0C, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x01, 0x01, 0x01, 0x0C, 
-    0x0B, 0x0C, 0x0C, 0x0D, 0x01, 0x01, 0x01, 0x09, 0x09, 0x0C, 0x0B, 0x0B, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0B, 0x0C, 0x0B, 0x0A, 0x0A, 
-    0x01, 0x01, 0x0A, 0x0B, 0x0A, 0x0A, 0x0C, 0x0B, 0x0A, 0x01, 0x01, 0x09, 
-    0x01, 0x09, 0x0B, 0x0C, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 
-    0x0C, 0x0B, 0x09, 0x01, 0x0F, 0x10, 0x11, 0x11, 0x10, 0x10, 0x0E, 0x0E, 
-    0x0D, 0x0D, 0x0F, 0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0B, 0x0C, 0x0D, 0x0E, 
-    0x0F, 0x0E, 0x0E, 0x0E, 0x0A, 0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 
-    0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x01, 0x01, 0x0B, 0x0B, 
-    0x0B, 0x0B, 0x0C, 0x0D, 0x01, 0x09, 0x0C, 0x0C, 0x09, 0x0A, 0x0A, 0x0B, 
-    0x01, 0x01, 0x0A, 0x0B, 0x0C, 0x0B, 0x0B, 0x01, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0D, 0x0A, 0x0C, 0x0C, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x0C, 0x01, 0x09, 0x09, 0x0B, 0x0C, 0x0C, 0x0B, 0x0B, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 
-    0x0C, 0x0B, 0x0B, 0x0A, 0x0C, 0x0C, 0x0D, 0x0D, 0x0C, 0x0C, 0x0B, 0x0A, 
-    0x09, 0x0A, 0x0B, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0D, 0x0D, 0x0C, 0x0C, 0x0D, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x09, 
-    0x0C, 0x0D, 0x0C, 0x0C, 0x0B, 0x0B, 0x09, 0x01, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0D, 0x0C, 0x0B, 0x0C, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 
-    0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0A, 0x0C, 0x0B, 0x0E, 0x0D, 0x0D, 0x0C, 
-    0x09, 0x01, 0x09, 0x0A, 0x0D, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0C, 
-    0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x09, 0x0C, 0x0C, 0x01, 0x01, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x01, 
-    0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x09, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0D, 0x0E, 0x10, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0D, 0x10, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x0C, 0x0D, 0x10, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0D, 0x0F, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0D, 0x0E, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0C, 0x0D, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0D, 0x0D, 0x0E, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 0x0D, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x0F, 0x0E, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0x0E, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0E, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0E, 0x0E, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0D, 0x0D, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0D, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x0D, 0x0C, 0x01, 0x01, 0x01, 0x01, 
-    0x0E, 0x0D, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0D, 0x0C, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x0D, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 
-    0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01, 0x09, 0x01, 
-    0x01, 0x09, 0x0A, 0x0B, 0x09, 0x01, 0x09, 0x01, 0x01, 0x0A, 0x0B, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 
-    0x09, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x0A, 0x01, 0x01, 0x09, 0x01, 0x09, 
-    0x0A, 0x0B, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 
-    0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x09, 
-    0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x0A, 0x0C, 0x0A, 
-    0x01, 0x01, 0x0A, 0x0A, 0x09, 0x01, 0x0C, 0x0C, 0x01, 0x01, 0x0C, 0x0B, 
-    0x0A, 0x01, 0x0A, 0x0C, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0A, 0x09, 0x0B, 
-    0x01, 0x01, 0x09, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x09, 0x01, 0x01, 0x0C, 
-    0x0B, 0x0B, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x0C, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 0x09, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 
-    0x0A, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x01, 
-    0x09, 0x0B, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x0C, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x09, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 
-    0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0B, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x0A, 0x01, 0x01, 0x09, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 0x01, 
-    0x0B, 0x01, 0x01, 0x0A, 0x0C, 0x0A, 0x09, 0x01, 0x0A, 0x0C, 0x0B, 0x0B, 
-    0x09, 0x09, 0x0B, 0x0C, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x0A, 0x0C, 0x0A, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 
-    0x01, 0x0B, 0x09, 0x09, 0x0B, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x0A, 0x0B, 0x0B, 0x0C, 0x09, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x0B, 0x09, 
-    0x0B, 0x09, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x09, 0x09, 0x09, 0x0A, 0x0A, 
-    0x0B, 0x0B, 0x0A, 0x0A, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0A, 0x09, 0x0B, 
-    0x0B, 0x0C, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x01, 0x09, 0x0B, 0x0B, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x0A, 0x0A, 0x09, 0x01, 0x01, 
-    0x0B, 0x0B, 0x0A, 0x09, 0x09, 0x09, 0x0A, 0x0B, 0x01, 0x01, 0x0B, 0x0A, 
-    0x01, 0x0A, 0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A, 0x01, 
-    0x0A, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x01, 0x0B, 0x0C, 0x0C, 0x0A, 
-    0x01, 0x01, 0x0A, 0x09, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x0B, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01, 
-    0x01, 0x0B, 0x09, 0x01, 0x0A, 0x09, 0x0A, 0x0A, 0x0C, 0x0B, 0x01, 0x01, 
-    0x01, 0x01, 0x0A, 0x0A, 0x0A, 0x01, 0x01, 0x09, 0x01, 0x01, 0x0A, 0x0B, 
-    0x0B, 0x0C, 0x0A, 0x01, 0x0A, 0x0C, 0x0C, 0x0B, 0x0C, 0x0C, 0x09, 0x01, 
-    0x09, 0x0B, 0x0A, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x0A, 0x0C, 0x0A, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x0A, 0x09, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x09, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0C, 0x0C, 0x0D, 0x10, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x0C, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x09, 0x0D, 0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x0C, 0x0D, 0x0F, 
-    0x10, 0x11, 0x11, 0x11, 0x01, 0x09, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x10, 
-    0x01, 0x01, 0x0B, 0x0A, 0x0A, 0x0D, 0x0E, 0x0E, 0x0A, 0x01, 0x09, 0x0B, 
-    0x0B, 0x0B, 0x0C, 0x0D, 0x0C, 0x0B, 0x01, 0x0A, 0x0B, 0x0A, 0x09, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x10, 
-    0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x0E, 0x0E, 
-    0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0D, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0E, 0x0E, 0x0C, 0x0D, 0x0D, 0x0D, 
-    0x0C, 0x0C, 0x0D, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 
-    0x10, 0x11, 0x11, 0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x10, 0x10, 
-    0x0E, 0x0E, 0x0E, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 
-    0x0E, 0x0D, 0x0D, 0x0C, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 
-    0x0D, 0x0D, 0x0D, 0x0C, 0x09, 0x09, 0x0A, 0x0C, 0x0E, 0x0D, 0x0D, 0x0C, 
-    0x01, 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0B, 0x0C, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x0D, 0x0C, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x0C, 0x0B, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x0A, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 
-    0x09, 0x09, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x09, 0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0B, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x01, 0x01, 0x0B, 0x0A, 0x0A, 0x0C, 0x0C, 0x0A, 0x09, 0x01, 0x01, 
-    0x09, 0x0C, 0x0C, 0x0C, 0x09, 0x0B, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 0x0A, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x0C, 0x0C, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x0C, 0x0C, 0x01, 
-    0x01, 0x09, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0C, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x08, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x12, 0x12, 
-    0x00, 0x00, 0x00, 0x08, 0x13, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x01, 
-    0x12, 0x00, 0x00, 0x12, 0x13, 0x13, 0x13, 0x08, 0x08, 0x08, 0x14, 0x13, 
-    0x12, 0x12, 0x12, 0x13, 0x13, 0x14, 0x08, 0x08, 0x12, 0x12, 0x12, 0x12, 
-    0x12, 0x12, 0x13, 0x14, 0x05, 0x06, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x12, 0x08, 
-    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x14, 0x13, 0x12, 
-    0x00, 0x00, 0x00, 0x15, 0x14, 0x14, 0x12, 0x16, 0x00, 0x00, 0x00, 0x15, 
-    0x14, 0x13, 0x12, 0x12, 0x00, 0x00, 0x00, 0x15, 0x14, 0x14, 0x13, 0x13, 
-    0x00, 0x00, 0x00, 0x15, 0x14, 0x13, 0x16, 0x16, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x15, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x16, 0x15, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x16, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x14, 0x13, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x13, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x14, 0x13, 0x16, 0x00, 0x00, 0x15, 0x15, 
-    0x15, 0x15, 0x14, 0x13, 0x00, 0x15, 0x13, 0x12, 0x13, 0x14, 0x15, 0x14, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x14, 0x13, 0x12, 0x00, 0x00, 0x00, 0x15, 0x14, 0x14, 0x12, 0x16, 
-    0x00, 0x00, 0x00, 0x15, 0x14, 0x13, 0x12, 0x12, 0x00, 0x00, 0x00, 0x15, 
-    0x14, 0x14, 0x13, 0x13, 0x00, 0x00, 0x00, 0x15, 0x14, 0x13, 0x16, 0x16, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x15, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x16, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x15, 0x15, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x14, 0x13, 0x15, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0B, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0C, 0x0B, 0x0A, 
-    0x09, 0x0A, 0x01, 0x01, 0x09, 0x0A, 0x0A, 0x0B, 0x09, 0x09, 0x0A, 0x01, 
-    0x01, 0x01, 0x09, 0x0A, 0x0A, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0B, 0x0A, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x09, 0x0A, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0A, 
-    0x01, 0x01, 0x0B, 0x09, 0x09, 0x0A, 0x0C, 0x0C, 0x01, 0x01, 0x09, 0x01, 
-    0x0A, 0x09, 0x0A, 0x0B, 0x01, 0x01, 0x0A, 0x0C, 0x0C, 0x0A, 0x0A, 0x0B, 
-    0x01, 0x09, 0x09, 0x0A, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 0x0A, 0x09, 0x01, 
-    0x01, 0x0B, 0x0C, 0x0C, 0x0B, 0x0B, 0x0C, 0x0C, 0x0B, 0x0C, 0x0B, 0x0A, 
-    0x0C, 0x09, 0x09, 0x0B, 0x0A, 0x09, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x09, 0x01, 0x0B, 0x0C, 0x0C, 
-    0x0B, 0x09, 0x01, 0x01, 0x0A, 0x0C, 0x0B, 0x0A, 0x0A, 0x09, 0x01, 0x09, 
-    0x0A, 0x0B, 0x0B, 0x0A, 0x0C, 0x0A, 0x01, 0x0A, 0x0B, 0x0B, 0x0C, 0x0A, 
-    0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0A, 0x01, 0x0B, 0x0B, 0x0B, 0x0B, 
-    0x0B, 0x01, 0x01, 0x01, 0x09, 0x0A, 0x0C, 0x0B, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x0C, 0x0C, 0x0C, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 
-    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x14, 0x13, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x08, 0x08, 0x00, 0x00, 0x12, 0x00, 
-    0x00, 0x08, 0x13, 0x13, 0x00, 0x00, 0x13, 0x14, 0x08, 0x12, 0x12, 0x12, 
-    0x00, 0x08, 0x08, 0x08, 0x12, 0x12, 0x12, 0x12, 0x08, 0x13, 0x12, 0x12, 
-    0x12, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x08, 0x14, 0x12, 0x12, 0x05, 
-    0x00, 0x13, 0x00, 0x08, 0x14, 0x13, 0x12, 0x12, 0x00, 0x14, 0x00, 0x08, 
-    0x04, 0x14, 0x13, 0x13, 0x08, 0x08, 0x08, 0x04, 0x03, 0x04, 0x05, 0x07, 
-    0x13, 0x13, 0x14, 0x05, 0x04, 0x03, 0x04, 0x05, 0x12, 0x12, 0x13, 0x14, 
-    0x05, 0x03, 0x04, 0x05, 0x12, 0x12, 0x13, 0x14, 0x04, 0x04, 0x03, 0x04, 
-    0x12, 0x13, 0x13, 0x14, 0x04, 0x04, 0x03, 0x04, 0x04, 0x07, 0x12, 0x12, 
-    0x12, 0x13, 0x13, 0x04, 0x07, 0x07, 0x13, 0x12, 0x13, 0x07, 0x05, 0x04, 
-    0x12, 0x06, 0x06, 0x13, 0x07, 0x05, 0x04, 0x03, 0x13, 0x06, 0x06, 0x07, 
-    0x05, 0x04, 0x06, 0x04, 0x07, 0x07, 0x07, 0x05, 0x04, 0x06, 0x12, 0x13, 
-    0x05, 0x05, 0x05, 0x05, 0x04, 0x06, 0x13, 0x13, 0x05, 0x05, 0x05, 0x05, 
-    0x04, 0x05, 0x13, 0x14, 0x04, 0x05, 0x05, 0x05, 0x04, 0x05, 0x13, 0x14, 
-    0x14, 0x13, 0x13, 0x12, 0x08, 0x00, 0x00, 0x00, 0x14, 0x13, 0x13, 0x13, 
-    0x04, 0x08, 0x00, 0x00, 0x04, 0x14, 0x14, 0x13, 0x04, 0x08, 0x00, 0x00, 
-    0x03, 0x04, 0x04, 0x04, 0x04, 0x08, 0x00, 0x00, 0x14, 0x03, 0x04, 0x04, 
-    0x03, 0x08, 0x00, 0x00, 0x14, 0x03, 0x04, 0x03, 0x03, 0x05, 0x08, 0x00, 
-    0x04, 0x03, 0x03, 0x03, 0x03, 0x05, 0x08, 0x00, 0x04, 0x03, 0x02, 0x02, 
-    0x03, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x08, 0x08, 0x08, 
-    0x13, 0x00, 0x00, 0x08, 0x08, 0x13, 0x13, 0x13, 0x14, 0x08, 0x08, 0x14, 
-    0x13, 0x12, 0x12, 0x12, 0x08, 0x14, 0x14, 0x14, 0x13, 0x12, 0x12, 0x12, 
-    0x08, 0x14, 0x14, 0x14, 0x14, 0x13, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x13, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x08, 0x08, 0x00, 0x12, 0x00, 0x00, 
-    0x12, 0x12, 0x13, 0x13, 0x08, 0x13, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 
-    0x13, 0x08, 0x08, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x04, 0x08, 
-    0x00, 0x00, 0x15, 0x15, 0x15, 0x14, 0x15, 0x15, 0x00, 0x15, 0x12, 0x12, 
-    0x14, 0x15, 0x15, 0x14, 0x15, 0x12, 0x16, 0x12, 0x14, 0x14, 0x15, 0x15, 
-    0x15, 0x13, 0x12, 0x13, 0x14, 0x14, 0x15, 0x15, 0x15, 0x12, 0x13, 0x14, 
-    0x14, 0x13, 0x15, 0x15, 0x00, 0x13, 0x16, 0x16, 0x16, 0x15, 0x15, 0x14, 
-    0x12, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x14, 0x08, 0x08, 0x14, 0x15, 
-    0x15, 0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x13, 0x15, 0x00, 0x00, 0x00, 
-    0x14, 0x15, 0x15, 0x13, 0x12, 0x15, 0x00, 0x00, 0x14, 0x00, 0x00, 0x15, 
-    0x15, 0x15, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 
-    0x14, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x15, 0x15, 0x13, 0x12, 0x16, 
-    0x12, 0x13, 0x14, 0x15, 0x15, 0x13, 0x12, 0x12, 0x13, 0x14, 0x14, 0x15, 
-    0x15, 0x16, 0x14, 0x13, 0x14, 0x14, 0x15, 0x13, 0x00, 0x15, 0x16, 0x16, 
-    0x16, 0x15, 0x14, 0x12, 0x15, 0x14, 0x15, 0x14, 0x14, 0x15, 0x14, 0x13, 
-    0x15, 0x13, 0x14, 0x14, 0x14, 0x14, 0x16, 0x14, 0x13, 0x15, 0x15, 0x15, 
-    0x14, 0x14, 0x15, 0x16, 0x12, 0x15, 0x00, 0x15, 0x13, 0x14, 0x14, 0x14, 
-    0x14, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x16, 0x12, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x15, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x13, 0x16, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x16, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x15, 0x15, 0x15, 0x14, 0x15, 0x15, 
-    0x00, 0x15, 0x12, 0x12, 0x14, 0x15, 0x15, 0x14, 0x15, 0x12, 0x16, 0x12, 
-    0x14, 0x14, 0x15, 0x15, 0x15, 0x13, 0x12, 0x13, 0x14, 0x14, 0x15, 0x15, 
-    0x15, 0x16, 0x13, 0x14, 0x14, 0x13, 0x15, 0x15, 0x00, 0x15, 0x16, 0x16, 
-    0x16, 0x15, 0x15, 0x14, 0x12, 0x13, 0x14, 0x14, 0x14, 0x15, 0x15, 0x14, 
-    0x13, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x13, 
-    0x15, 0x00, 0x00, 0x00, 0x14, 0x15, 0x15, 0x13, 0x12, 0x15, 0x00, 0x00, 
-    0x14, 0x00, 0x00, 0x15, 0x15, 0x15, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x09, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x12, 0x12, 0x00, 0x00, 
-    0x00, 0x00, 0x15, 0x14, 0x12, 0x16, 0x12, 0x00, 0x00, 0x00, 0x15, 0x14, 
-    0x13, 0x12, 0x13, 0x14, 0x00, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-    0x00, 0x15, 0x12, 0x12, 0x13, 0x14, 0x14, 0x15, 0x15, 0x12, 0x16, 0x12, 
-    0x14, 0x13, 0x15, 0x00, 0x00, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x12, 0x12, 0x12, 0x15, 0x00, 0x00, 0x00, 0x13, 0x12, 0x16, 0x12, 
-    0x13, 0x15, 0x00, 0x00, 0x14, 0x13, 0x12, 0x12, 0x14, 0x15, 0x00, 0x00, 
-    0x15, 0x14, 0x13, 0x14, 0x16, 0x15, 0x00, 0x00, 0x15, 0x14, 0x16, 0x16, 
-    0x15, 0x00, 0x00, 0x00, 0x15, 0x14, 0x14, 0x15, 0x00, 0x15, 0x00, 0x00, 
-    0x15, 0x14, 0x14, 0x15, 0x15, 0x13, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x14, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 
-    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x12, 0x00, 0x00, 
-    0x00, 0x15, 0x15, 0x00, 0x14, 0x13, 0x00, 0x00, 0x15, 0x12, 0x12, 0x15, 
-    0x00, 0x13, 0x00, 0x00, 0x12, 0x16, 0x12, 0x13, 0x15, 0x14, 0x13, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x12, 0x13, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 
-    0x13, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x00, 
-    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x00, 0x14, 0x00, 0x00, 
-    0x00, 0x00, 0x14, 0x13, 0x13, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 
-    0x13, 0x00, 0x14, 0x00, 0x12, 0x00, 0x00, 0x0F, 0x13, 0x13, 0x14, 0x00, 
-    0x13, 0x12, 0x00, 0x00, 0x14, 0x13, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x12, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x12, 0x14, 0x00, 0x13, 0x14, 0x14, 0x00, 0x00, 0x13, 0x14, 0x13, 0x14, 
-    0x14, 0x00, 0x00, 0x00, 0x13, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x12, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x13, 0x08, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 
-    0x08, 0x08, 0x08, 0x00, 0x12, 0x00, 0x00, 0x13, 0x12, 0x12, 0x12, 0x08, 
-    0x08, 0x08, 0x00, 0x14, 0x12, 0x12, 0x12, 0x12, 0x13, 0x14, 0x08, 0x08, 
-    0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x03, 0x03, 0x12, 0x12, 0x06, 0x05, 
-    0x06, 0x12, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 
-    0x00, 0x00, 0x12, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x13, 0x08, 
-    0x08, 0x12, 0x12, 0x12, 0x00, 0x00, 0x08, 0x13, 0x12, 0x12, 0x12, 0x12, 
-    0x08, 0x08, 0x07, 0x13, 0x13, 0x12, 0x12, 0x12, 0x04, 0x07, 0x05, 0x13, 
-    0x12, 0x12, 0x12, 0x12, 0x03, 0x04, 0x06, 0x06, 0x12, 0x12, 0x13, 0x12, 
-    0x03, 0x03, 0x02, 0x04, 0x12, 0x13, 0x12, 0x13, 0x14, 0x00, 0x14, 0x00, 
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x14, 0x14, 0x14, 0x05, 
-    0x12, 0x12, 0x13, 0x13, 0x14, 0x03, 0x03, 0x04, 0x12, 0x12, 0x12, 0x12, 
-    0x13, 0x14, 0x04, 0x03, 0x12, 0x12, 0x12, 0x12, 0x13, 0x14, 0x14, 0x03, 
-    0x12, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x03, 0x12, 0x12, 0x13, 0x13, 
-    0x14, 0x12, 0x14, 0x03, 0x13, 0x13, 0x13, 0x14, 0x12, 0x14, 0x14, 0x02, 
-    0x14, 0x13, 0x13, 0x13, 0x12, 0x13, 0x12, 0x13, 0x06, 0x14, 0x14, 0x04, 
-    0x13, 0x12, 0x13, 0x13, 0x05, 0x05, 0x05, 0x04, 0x14, 0x13, 0x13, 0x14, 
-    0x04, 0x04, 0x04, 0x04, 0x05, 0x14, 0x14, 0x14, 0x04, 0x03, 0x04, 0x04, 
-    0x05, 0x05, 0x14, 0x04, 0x03, 0x02, 0x03, 0x04, 0x05, 0x04, 0x14, 0x04, 
-    0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 0x03, 
-    0x05, 0x04, 0x04, 0x04, 0x12, 0x13, 0x14, 0x14, 0x04, 0x03, 0x03, 0x03, 
-    0x13, 0x13, 0x14, 0x05, 0x05, 0x04, 0x03, 0x03, 0x14, 0x14, 0x05, 0x05, 
-    0x04, 0x03, 0x03, 0x02, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 
-    0x14, 0x03, 0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x04, 0x03, 0x03, 0x03, 
-    0x02, 0x02, 0x03, 0x12, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03, 0x12, 0x12, 
-    0x03, 0x02, 0x03, 0x02, 0x03, 0x14, 0x13, 0x13, 0x04, 0x04, 0x05, 0x05, 
-    0x04, 0x05, 0x14, 0x14, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x14, 0x04, 
-    0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 
-    0x03, 0x04, 0x04, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x13, 0x14, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x13, 0x05, 0x04, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x05, 0x04, 0x06, 0x06, 0x06, 0x04, 0x03, 0x02, 
-    0x03, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x08, 0x03, 0x02, 0x02, 0x01, 
-    0x03, 0x03, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x03, 0x03, 0x04, 0x03, 
-    0x03, 0x02, 0x01, 0x01, 0x05, 0x05, 0x05, 0x03, 0x03, 0x02, 0x01, 0x05, 
-    0x05, 0x05, 0x05, 0x03, 0x03, 0x02, 0x01, 0x04, 0x05, 0x05, 0x04, 0x03, 
-    0x03, 0x02, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03, 0x04, 
-    0x05, 0x03, 0x03, 0x02, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x12, 
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x12, 0x13, 0x14, 0x14, 0x14, 0x14, 
-    0x14, 0x14, 0x13, 0x12, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 
-    0x04, 0x14, 0x14, 0x14, 0x14, 0x14, 0x05, 0x07, 0x14, 0x04, 0x14, 0x14, 
-    0x14, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 
-    0x03, 0x04, 0x14, 0x14, 0x04, 0x03, 0x04, 0x05, 0x12, 0x12, 0x12, 0x12, 
-    0x12, 0x12, 0x05, 0x04, 0x12, 0x12, 0x12, 0x06, 0x06, 0x12, 0x05, 0x12, 
-    0x13, 0x13, 0x13, 0x06, 0x06, 0x07, 0x04, 0x13, 0x13, 0x06, 0x07, 0x07, 
-    0x07, 0x05, 0x04, 0x14, 0x07, 0x07, 0x05, 0x05, 0x04, 0x03, 0x03, 0x05, 
-    0x05, 0x05, 0x12, 0x12, 0x13, 0x04, 0x03, 0x03, 0x13, 0x12, 0x12, 0x12, 
-    0x13, 0x04, 0x05, 0x02, 0x13, 0x12, 0x13, 0x14, 0x14, 0x04, 0x05, 0x02, 
-    0x04, 0x04, 0x08, 0x12, 0x13, 0x13, 0x15, 0x14, 0x07, 0x05, 0x08, 0x13, 
-    0x12, 0x14, 0x15, 0x15, 0x12, 0x07, 0x05, 0x08, 0x12, 0x14, 0x16, 0x15, 
-    0x13, 0x12, 0x05, 0x08, 0x14, 0x14, 0x16, 0x15, 0x05, 0x05, 0x04, 0x08, 
-    0x14, 0x16, 0x15, 0x15, 0x04, 0x04, 0x04, 0x04, 0x08, 0x14, 0x12, 0x14, 
-    0x03, 0x04, 0x04, 0x03, 0x03, 0x08, 0x13, 0x14, 0x02, 0x03, 0x03, 0x03, 
-    0x04, 0x03, 0x08, 0x08, 0x15, 0x14, 0x13, 0x13, 0x13, 0x14, 0x00, 0x00, 
-    0x15, 0x13, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x15, 0x14, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x15, 0x15, 
-    0x15, 0x00, 0x00, 0x00, 0x01, 0x15, 0x14, 0x16, 0x12, 0x15, 0x00, 0x00, 
-    0x08, 0x12, 0x14, 0x13, 0x13, 0x14, 0x15, 0x15, 0x15, 0x00, 0x00, 0x15, 
-    0x13, 0x14, 0x13, 0x15, 0x00, 0x00, 0x00, 0x15, 0x13, 0x14, 0x12, 0x15, 
-    0x00, 0x00, 0x00, 0x15, 0x14, 0x13, 0x12, 0x15, 0x00, 0x00, 0x00, 0x15, 
-    0x14, 0x13, 0x14, 0x15, 0x00, 0x00, 0x00, 0x15, 0x14, 0x12, 0x14, 0x15, 
-    0x00, 0x00, 0x00, 0x15, 0x14, 0x12, 0x14, 0x15, 0x15, 0x15, 0x00, 0x15, 
-    0x14, 0x13, 0x14, 0x15, 0x12, 0x13, 0x15, 0x15, 0x14, 0x14, 0x15, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 
-    0x12, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x14, 0x15, 0x15, 0x15, 
-    0x15, 0x15, 0x00, 0x15, 0x14, 0x00, 0x15, 0x12, 0x13, 0x13, 0x15, 0x14, 
-    0x00, 0x15, 0x13, 0x16, 0x12, 0x14, 0x15, 0x15, 0x00, 0x15, 0x12, 0x12, 
-    0x12, 0x14, 0x16, 0x15, 0x00, 0x15, 0x16, 0x13, 0x14, 0x14, 0x16, 0x15, 
-    0x00, 0x00, 0x15, 0x16, 0x16, 0x16, 0x15, 0x15, 0x15, 0x00, 0x00, 0x15, 
-    0x14, 0x14, 0x15, 0x14, 0x13, 0x15, 0x00, 0x15, 0x14, 0x13, 0x15, 0x14, 
-    0x14, 0x13, 0x15, 0x15, 0x14, 0x13, 0x15, 0x14, 0x15, 0x14, 0x13, 0x13, 
-    0x13, 0x14, 0x00, 0x00, 0x15, 0x13, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 
-    0x15, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x00, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x14, 0x16, 
-    0x12, 0x15, 0x00, 0x00, 0x00, 0x15, 0x14, 0x13, 0x13, 0x14, 0x15, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x12, 0x12, 0x15, 0x15, 
-    0x00, 0x00, 0x15, 0x14, 0x12, 0x16, 0x12, 0x15, 0x00, 0x00, 0x15, 0x14, 
-    0x13, 0x12, 0x13, 0x14, 0x00, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-    0x00, 0x15, 0x12, 0x12, 0x13, 0x14, 0x14, 0x15, 0x15, 0x12, 0x16, 0x12, 
-    0x14, 0x13, 0x15, 0x00, 0x00, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x12, 0x12, 0x12, 0x15, 0x00, 0x00, 0x00, 0x13, 0x12, 0x16, 0x12, 
-    0x13, 0x15, 0x00, 0x00, 0x14, 0x13, 0x12, 0x12, 0x14, 0x15, 0x00, 0x00, 
-    0x15, 0x14, 0x13, 0x14, 0x16, 0x15, 0x00, 0x00, 0x15, 0x14, 0x16, 0x16, 
-    0x15, 0x00, 0x00, 0x12, 0x15, 0x14, 0x14, 0x15, 0x00, 0x15, 0x00, 0x13, 
-    0x15, 0x14, 0x14, 0x15, 0x15, 0x13, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x14, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x13, 0x00, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x14, 0x13, 0x00, 0x14, 0x00, 0x12, 0x00, 0x00, 0x00, 
-    0x13, 0x13, 0x14, 0x00, 0x13, 0x12, 0x00, 0x00, 0x14, 0x13, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x12, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x00, 0x13, 0x14, 0x14, 0x00, 0x00, 
-    0x13, 0x14, 0x13, 0x14, 0x14, 0x00, 0x00, 0x00, 0x13, 0x14, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x13, 0x12, 0x13, 0x14, 0x14, 0x15, 0x00, 0x15, 0x14, 0x13, 0x14, 
-    0x14, 0x14, 0x15, 0x00, 0x00, 0x15, 0x14, 0x14, 0x14, 0x14, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x14, 0x14, 0x15, 0x00, 0x00, 0x13, 0x15, 0x00, 0x15, 
-    0x14, 0x15, 0x00, 0x00, 0x15, 0x13, 0x15, 0x12, 0x14, 0x15, 0x13, 0x00, 
-    0x00, 0x15, 0x14, 0x13, 0x14, 0x14, 0x08, 0x08, 0x13, 0x08, 0x08, 0x08, 
-    0x08, 0x08, 0x14, 0x13, 0x00, 0x15, 0x14, 0x13, 0x14, 0x15, 0x00, 0x15, 
-    0x00, 0x15, 0x14, 0x14, 0x15, 0x00, 0x00, 0x15, 0x00, 0x15, 0x14, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x13, 0x15, 0x00, 0x00, 0x00, 0x00, 
-    0x12, 0x15, 0x13, 0x15, 0x00, 0x00, 0x00, 0x00, 0x13, 0x15, 0x13, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x13, 0x12, 0x0E, 0x00, 0x12, 
-    0x13, 0x14, 0x14, 0x08, 0x08, 0x13, 0x00, 0x13, 0x13, 0x12, 0x12, 0x14, 
-    0x15, 0x14, 0x13, 0x14, 0x14, 0x13, 0x13, 0x14, 0x15, 0x00, 0x14, 0x14, 
-    0x15, 0x14, 0x14, 0x14, 0x15, 0x00, 0x14, 0x15, 0x00, 0x15, 0x14, 0x15, 
-    0x15, 0x00, 0x15, 0x13, 0x00, 0x12, 0x14, 0x13, 0x12, 0x0E, 0x13, 0x12, 
-    0x00, 0x13, 0x13, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x14, 
-    0x13, 0x13, 0x13, 0x14, 0x08, 0x14, 0x13, 0x12, 0x06, 0x05, 0x12, 0x13, 
-    0x14, 0x00, 0x13, 0x12, 0x13, 0x00, 0x00, 0x00, 0x14, 0x13, 0x12, 0x16, 
-    0x12, 0x13, 0x00, 0x00, 0x14, 0x14, 0x13, 0x12, 0x13, 0x14, 0x00, 0x00, 
-    0x12, 0x13, 0x15, 0x14, 0x14, 0x14, 0x00, 0x13, 0x13, 0x12, 0x13, 0x12, 
-    0x14, 0x14, 0x00, 0x14, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 
-    0x14, 0x14, 0x14, 0x14, 0x14, 0x08, 0x00, 0x00, 0x13, 0x13, 0x14, 0x14, 
-    0x14, 0x08, 0x13, 0x00, 0x00, 0x13, 0x12, 0x00, 0x14, 0x13, 0x14, 0x00, 
-    0x00, 0x14, 0x13, 0x00, 0x14, 0x14, 0x14, 0x13, 0x00, 0x00, 0x14, 0x00, 
-    0x00, 0x14, 0x14, 0x13, 0x00, 0x00, 0x14, 0x12, 0x00, 0x14, 0x14, 0x14, 
-    0x13, 0x00, 0x14, 0x13, 0x00, 0x14, 0x14, 0x12, 0x14, 0x13, 0x14, 0x14, 
-    0x11, 0x13, 0x08, 0x08, 0x00, 0x13, 0x14, 0x08, 0x08, 0x08, 0x13, 0x13, 
-    0x00, 0x08, 0x08, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x14, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x13, 0x13, 0x12, 0x12, 0x00, 0x00, 0x00, 0x13, 0x14, 0x14, 0x14, 
-    0x14, 0x12, 0x00, 0x00, 0x14, 0x14, 0x12, 0x00, 0x00, 0x13, 0x12, 0x00, 
-    0x08, 0x14, 0x13, 0x00, 0x00, 0x12, 0x13, 0x00, 0x14, 0x08, 0x08, 0x08, 
-    0x00, 0x13, 0x00, 0x00, 0x12, 0x12, 0x13, 0x14, 0x08, 0x14, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 
-    0x00, 0x13, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x14, 0x08, 0x08, 0x05, 
-    0x12, 0x12, 0x13, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x14, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x14, 0x00, 0x12, 0x00, 0x12, 
-    0x00, 0x08, 0x04, 0x14, 0x00, 0x13, 0x00, 0x13, 0x08, 0x03, 0x04, 0x14, 
-    0x00, 0x14, 0x00, 0x08, 0x03, 0x02, 0x03, 0x14, 0x08, 0x08, 0x08, 0x05, 
-    0x04, 0x03, 0x02, 0x04, 0x07, 0x07, 0x05, 0x14, 0x14, 0x04, 0x03, 0x02, 
-    0x13, 0x12, 0x07, 0x04, 0x05, 0x06, 0x13, 0x03, 0x12, 0x13, 0x07, 0x07, 
-    0x06, 0x06, 0x06, 0x05, 0x13, 0x12, 0x12, 0x06, 0x06, 0x06, 0x06, 0x05, 
-    0x13, 0x13, 0x12, 0x06, 0x06, 0x06, 0x05, 0x04, 0x13, 0x14, 0x13, 0x05, 
-    0x05, 0x05, 0x05, 0x04, 0x14, 0x13, 0x14, 0x05, 0x05, 0x05, 0x04, 0x03, 
-    0x14, 0x14, 0x14, 0x04, 0x04, 0x04, 0x03, 0x03, 0x14, 0x14, 0x04, 0x04, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x12, 0x13, 0x05, 0x05, 
-    0x03, 0x03, 0x02, 0x03, 0x13, 0x13, 0x06, 0x06, 0x04, 0x03, 0x02, 0x03, 
-    0x14, 0x13, 0x04, 0x05, 0x03, 0x03, 0x02, 0x03, 0x03, 0x14, 0x03, 0x04, 
-    0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 
-    0x05, 0x05, 0x04, 0x04, 0x02, 0x02, 0x03, 0x03, 0x13, 0x13, 0x12, 0x12, 
-    0x14, 0x14, 0x14, 0x03, 0x12, 0x12, 0x05, 0x14, 0x14, 0x14, 0x14, 0x02, 
-    0x05, 0x05, 0x14, 0x14, 0x14, 0x14, 0x04, 0x02, 0x04, 0x14, 0x14, 0x14, 
-    0x14, 0x04, 0x04, 0x01, 0x04, 0x14, 0x14, 0x14, 0x14, 0x04, 0x03, 0x01, 
-    0x04, 0x04, 0x14, 0x14, 0x04, 0x04, 0x03, 0x01, 0x04, 0x04, 0x04, 0x04, 
-    0x04, 0x02, 0x02, 0x01, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 0x01, 
-    0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x04, 0x02, 0x02, 0x03, 0x03, 
-    0x05, 0x03, 0x04, 0x03, 0x01, 0x02, 0x02, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x01, 0x02, 0x03, 0x02, 0x03, 0x03, 0x05, 0x03, 0x01, 0x01, 0x02, 0x03, 
-    0x02, 0x03, 0x04, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x03, 0x02, 0x03, 0x02, 0x03, 0x14, 0x14, 0x05, 
-    0x02, 0x02, 0x03, 0x02, 0x03, 0x14, 0x14, 0x05, 0x03, 0x02, 0x02, 0x02, 
-    0x03, 0x14, 0x14, 0x05, 0x02, 0x02, 0x01, 0x02, 0x03, 0x04, 0x14, 0x03, 
-    0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x14, 0x03, 0x02, 0x01, 0x01, 0x01, 
-    0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x06, 0x06, 0x06, 
-    0x05, 0x04, 0x03, 0x02, 0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x02, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x01, 0x04, 0x04, 0x04, 0x03, 
-    0x03, 0x02, 0x03, 0x01, 0x04, 0x04, 0x03, 0x02, 0x03, 0x01, 0x02, 0x01, 
-    0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x02, 0x03, 0x04, 0x04, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 
-    0x04, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x14, 0x14, 0x03, 0x04, 0x04, 0x04, 
-    0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x05, 0x05, 
-    0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 
-    0x04, 0x14, 0x13, 0x13, 0x05, 0x02, 0x03, 0x03, 0x04, 0x14, 0x13, 0x13, 
-    0x13, 0x02, 0x02, 0x03, 0x04, 0x14, 0x13, 0x13, 0x13, 0x03, 0x02, 0x02, 
-    0x04, 0x14, 0x14, 0x13, 0x13, 0x04, 0x03, 0x02, 0x05, 0x13, 0x14, 0x14, 
-    0x14, 0x04, 0x03, 0x02, 0x04, 0x14, 0x14, 0x14, 0x04, 0x04, 0x03, 0x02, 
-    0x03, 0x14, 0x14, 0x04, 0x04, 0x04, 0x02, 0x03, 0x03, 0x04, 0x04, 0x03, 
-    0x03, 0x03, 0x04, 0x04, 0x03, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x04, 
-    0x02, 0x03, 0x03, 0x02, 0x04, 0x05, 0x05, 0x05, 0x03, 0x03, 0x02, 0x03, 
-    0x04, 0x05, 0x05, 0x06, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 
-    0x03, 0x04, 0x04, 0x04, 0x04, 0x13, 0x13, 0x13, 0x04, 0x04, 0x14, 0x13, 
-    0x12, 0x12, 0x12, 0x12, 0x14, 0x13, 0x13, 0x12, 0x13, 0x12, 0x12, 0x12, 
-    0x14, 0x13, 0x12, 0x13, 0x12, 0x13, 0x13, 0x12, 0x14, 0x13, 0x13, 0x12, 
-    0x13, 0x06, 0x13, 0x12, 0x05, 0x14, 0x14, 0x13, 0x06, 0x06, 0x12, 0x12, 
-    0x06, 0x06, 0x14, 0x03, 0x04, 0x04, 0x13, 0x13, 0x06, 0x06, 0x06, 0x05, 
-    0x03, 0x04, 0x13, 0x13, 0x14, 0x08, 0x08, 0x14, 0x12, 0x16, 0x15, 0x00, 
-    0x13, 0x14, 0x03, 0x08, 0x13, 0x15, 0x00, 0x00, 0x12, 0x13, 0x14, 0x03, 
-    0x08, 0x14, 0x15, 0x00, 0x12, 0x12, 0x13, 0x14, 0x08, 0x12, 0x00, 0x00, 
-    0x12, 0x12, 0x13, 0x14, 0x03, 0x08, 0x00, 0x00, 0x12, 0x13, 0x13, 0x14, 
-    0x04, 0x03, 0x08, 0x00, 0x13, 0x14, 0x14, 0x04, 0x04, 0x03, 0x08, 0x00, 
-    0x14, 0x14, 0x04, 0x04, 0x05, 0x03, 0x08, 0x00, 0x15, 0x15, 0x13, 0x15, 
-    0x14, 0x14, 0x15, 0x13, 0x00, 0x15, 0x13, 0x15, 0x14, 0x14, 0x12, 0x15, 
-    0x00, 0x15, 0x13, 0x14, 0x14, 0x14, 0x13, 0x15, 0x00, 0x00, 0x15, 0x14, 
-    0x14, 0x13, 0x14, 0x08, 0x00, 0x00, 0x12, 0x14, 0x14, 0x08, 0x08, 0x14, 
-    0x00, 0x00, 0x13, 0x14, 0x08, 0x14, 0x13, 0x13, 0x12, 0x15, 0x14, 0x14, 
-    0x08, 0x13, 0x12, 0x12, 0x13, 0x08, 0x08, 0x08, 0x04, 0x12, 0x12, 0x12, 
-    0x14, 0x15, 0x12, 0x13, 0x12, 0x12, 0x15, 0x00, 0x15, 0x13, 0x13, 0x15, 
-    0x15, 0x12, 0x00, 0x13, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-    0x14, 0x14, 0x13, 0x04, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x04, 
-    0x13, 0x12, 0x12, 0x12, 0x05, 0x12, 0x12, 0x04, 0x12, 0x06, 0x06, 0x06, 
-    0x12, 0x06, 0x05, 0x07, 0x06, 0x06, 0x06, 0x05, 0x06, 0x12, 0x05, 0x07, 
-    0x06, 0x06, 0x05, 0x04, 0x15, 0x13, 0x12, 0x15, 0x14, 0x13, 0x15, 0x14, 
-    0x15, 0x14, 0x13, 0x12, 0x14, 0x12, 0x15, 0x12, 0x08, 0x08, 0x14, 0x13, 
-    0x14, 0x12, 0x15, 0x13, 0x13, 0x14, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-    0x12, 0x13, 0x14, 0x04, 0x03, 0x04, 0x04, 0x14, 0x12, 0x12, 0x13, 0x14, 
-    0x03, 0x03, 0x14, 0x14, 0x06, 0x12, 0x12, 0x14, 0x03, 0x03, 0x14, 0x13, 
-    0x13, 0x06, 0x13, 0x14, 0x03, 0x03, 0x14, 0x13, 0x00, 0x15, 0x14, 0x14, 
-    0x14, 0x16, 0x15, 0x00, 0x00, 0x15, 0x15, 0x16, 0x16, 0x15, 0x00, 0x00, 
-    0x00, 0x00, 0x15, 0x12, 0x13, 0x14, 0x00, 0x00, 0x08, 0x08, 0x14, 0x13, 
-    0x14, 0x14, 0x00, 0x15, 0x14, 0x14, 0x08, 0x08, 0x08, 0x00, 0x00, 0x15, 
-    0x13, 0x13, 0x13, 0x13, 0x14, 0x08, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 
-    0x13, 0x14, 0x08, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x08, 0x13, 
-    0x15, 0x13, 0x12, 0x13, 0x14, 0x14, 0x15, 0x00, 0x15, 0x14, 0x13, 0x14, 
-    0x14, 0x14, 0x15, 0x00, 0x00, 0x15, 0x14, 0x14, 0x14, 0x14, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x14, 0x14, 0x15, 0x00, 0x00, 0x13, 0x12, 0x00, 0x15, 
-    0x12, 0x15, 0x00, 0x00, 0x15, 0x13, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 
-    0x00, 0x08, 0x08, 0x14, 0x13, 0x13, 0x13, 0x14, 0x08, 0x14, 0x13, 0x12, 
-    0x06, 0x05, 0x12, 0x13, 0x00, 0x15, 0x14, 0x13, 0x14, 0x15, 0x00, 0x00, 
-    0x00, 0x15, 0x14, 0x14, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x14, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x15, 0x13, 0x15, 0x00, 0x00, 0x00, 0x13, 
-    0x13, 0x15, 0x13, 0x12, 0x00, 0x00, 0x00, 0x14, 0x08, 0x08, 0x08, 0x08, 
-    0x08, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x08, 0x00, 0x00, 
-    0x13, 0x13, 0x14, 0x14, 0x14, 0x08, 0x13, 0x00, 0x00, 0x13, 0x12, 0x00, 
-    0x14, 0x13, 0x14, 0x12, 0x00, 0x14, 0x13, 0x00, 0x14, 0x14, 0x14, 0x13, 
-    0x00, 0x00, 0x14, 0x00, 0x14, 0x14, 0x08, 0x08, 0x00, 0x12, 0x14, 0x13, 
-    0x08, 0x08, 0x13, 0x13, 0x13, 0x13, 0x08, 0x08, 0x13, 0x13, 0x12, 0x12, 
-    0x14, 0x08, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x08, 0x13, 0x12, 0x12, 
-    0x12, 0x12, 0x12, 0x12, 0x08, 0x07, 0x13, 0x06, 0x12, 0x12, 0x13, 0x13, 
-    0x13, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x12, 0x08, 0x08, 0x13, 0x12, 0x12, 0x00, 0x00, 0x00, 
-    0x13, 0x14, 0x08, 0x08, 0x14, 0x12, 0x00, 0x00, 0x12, 0x13, 0x13, 0x14, 
-    0x08, 0x13, 0x12, 0x00, 0x12, 0x13, 0x12, 0x13, 0x14, 0x08, 0x13, 0x00, 
-    0x13, 0x13, 0x13, 0x13, 0x14, 0x14, 0x08, 0x00, 0x13, 0x05, 0x13, 0x14, 
-    0x14, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x12, 0x00, 0x00, 
-    0x00, 0x00, 0x12, 0x13, 0x14, 0x13, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 
-    0x00, 0x13, 0x00, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0x12, 0x13, 0x00, 
-    0x00, 0x12, 0x13, 0x00, 0x00, 0x13, 0x14, 0x08, 0x08, 0x08, 0x08, 0x13, 
-    0x14, 0x08, 0x08, 0x05, 0x12, 0x12, 0x13, 0x08, 0x12, 0x13, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x13, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x13, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x00, 0x00, 0x00, 0x13, 0x14, 0x00, 
-    0x13, 0x14, 0x12, 0x00, 0x13, 0x14, 0x00, 0x00, 0x14, 0x14, 0x13, 0x13, 
-    0x13, 0x00, 0x00, 0x12, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x13, 
-    0x08, 0x14, 0x14, 0x14, 0x13, 0x14, 0x13, 0x13, 0x03, 0x14, 0x13, 0x13, 
-    0x12, 0x12, 0x13, 0x12, 0x14, 0x13, 0x14, 0x12, 0x12, 0x12, 0x12, 0x12, 
-    0x13, 0x12, 0x13, 0x12, 0x06, 0x12, 0x06, 0x12, 0x05, 0x06, 0x12, 0x06, 
-    0x07, 0x05, 0x12, 0x05, 0x05, 0x07, 0x07, 0x07, 0x05, 0x06, 0x07, 0x04, 
-    0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 
-    0x06, 0x06, 0x06, 0x06, 0x12, 0x13, 0x14, 0x14, 0x04, 0x08, 0x08, 0x08, 
-    0x13, 0x12, 0x13, 0x14, 0x04, 0x03, 0x02, 0x05, 0x12, 0x13, 0x12, 0x13, 
-    0x05, 0x03, 0x02, 0x04, 0x12, 0x06, 0x12, 0x07, 0x05, 0x03, 0x02, 0x04, 
-    0x06, 0x12, 0x07, 0x04, 0x04, 0x03, 0x02, 0x04, 0x06, 0x06, 0x07, 0x04, 
-    0x04, 0x03, 0x02, 0x03, 0x06, 0x07, 0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 
-    0x07, 0x05, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 0x13, 0x12, 0x12, 0x12, 
-    0x05, 0x04, 0x12, 0x12, 0x07, 0x12, 0x12, 0x06, 0x06, 0x12, 0x12, 0x12, 
-    0x05, 0x13, 0x07, 0x12, 0x12, 0x12, 0x12, 0x12, 0x05, 0x05, 0x05, 0x07, 
-    0x12, 0x07, 0x04, 0x13, 0x05, 0x05, 0x05, 0x13, 0x05, 0x13, 0x04, 0x03, 
-    0x04, 0x05, 0x05, 0x05, 0x13, 0x04, 0x03, 0x14, 0x04, 0x05, 0x05, 0x05, 
-    0x13, 0x04, 0x03, 0x14, 0x03, 0x04, 0x05, 0x05, 0x05, 0x04, 0x03, 0x04, 
-    0x12, 0x12, 0x14, 0x13, 0x14, 0x04, 0x08, 0x08, 0x12, 0x14, 0x13, 0x13, 
-    0x14, 0x14, 0x04, 0x04, 0x13, 0x13, 0x13, 0x14, 0x14, 0x04, 0x03, 0x03, 
-    0x13, 0x13, 0x13, 0x14, 0x14, 0x04, 0x03, 0x03, 0x13, 0x14, 0x14, 0x14, 
-    0x03, 0x03, 0x03, 0x03, 0x14, 0x14, 0x13, 0x13, 0x14, 0x03, 0x02, 0x03, 
-    0x13, 0x14, 0x14, 0x14, 0x03, 0x03, 0x02, 0x03, 0x14, 0x14, 0x04, 0x03, 
-    0x03, 0x02, 0x02, 0x03, 0x08, 0x12, 0x12, 0x12, 0x13, 0x14, 0x12, 0x12, 
-    0x05, 0x14, 0x13, 0x13, 0x05, 0x04, 0x13, 0x12, 0x05, 0x06, 0x14, 0x14, 
-    0x04, 0x05, 0x14, 0x13, 0x04, 0x05, 0x04, 0x04, 0x03, 0x05, 0x05, 0x14, 
-    0x04, 0x04, 0x04, 0x03, 0x03, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x03, 
-    0x02, 0x04, 0x05, 0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x04, 0x04, 
-    0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x06, 0x06, 0x12, 0x13, 0x12, 0x13, 
-    0x14, 0x08, 0x08, 0x08, 0x12, 0x12, 0x13, 0x14, 0x03, 0x03, 0x04, 0x13, 
-    0x13, 0x13, 0x14, 0x03, 0x03, 0x03, 0x03, 0x05, 0x14, 0x14, 0x04, 0x03, 
-    0x03, 0x02, 0x03, 0x05, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 0x03, 0x04, 
-    0x04, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x03, 0x03, 0x03, 
-    0x02, 0x02, 0x02, 0x04, 0x06, 0x06, 0x04, 0x03, 0x02, 0x02, 0x02, 0x03, 
-    0x08, 0x05, 0x12, 0x12, 0x12, 0x13, 0x13, 0x14, 0x12, 0x12, 0x12, 0x12, 
-    0x12, 0x07, 0x05, 0x05, 0x13, 0x13, 0x13, 0x13, 0x14, 0x05, 0x04, 0x04, 
-    0x14, 0x13, 0x14, 0x14, 0x04, 0x04, 0x03, 0x03, 0x05, 0x13, 0x14, 0x05, 
-    0x04, 0x04, 0x03, 0x03, 0x05, 0x14, 0x04, 0x05, 0x04, 0x04, 0x03, 0x03, 
-    0x05, 0x14, 0x06, 0x05, 0x04, 0x04, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 
-    0x04, 0x03, 0x03, 0x02, 0x05, 0x05, 0x13, 0x13, 0x06, 0x06, 0x08, 0x05, 
-    0x04, 0x12, 0x12, 0x12, 0x12, 0x05, 0x06, 0x04, 0x03, 0x13, 0x12, 0x12, 
-    0x13, 0x05, 0x04, 0x03, 0x03, 0x03, 0x13, 0x13, 0x14, 0x04, 0x03, 0x02, 
-    0x03, 0x03, 0x13, 0x14, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x14, 0x04, 
-    0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x04, 0x13, 0x03, 0x02, 0x02, 0x02, 
-    0x02, 0x03, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x06, 0x06, 0x12, 0x13, 
-    0x13, 0x14, 0x04, 0x03, 0x07, 0x13, 0x12, 0x12, 0x13, 0x13, 0x14, 0x03, 
-    0x04, 0x07, 0x13, 0x12, 0x12, 0x12, 0x13, 0x13, 0x03, 0x04, 0x07, 0x13, 
-    0x12, 0x12, 0x12, 0x13, 0x02, 0x03, 0x04, 0x04, 0x05, 0x12, 0x13, 0x13, 
-    0x02, 0x03, 0x03, 0x03, 0x04, 0x13, 0x13, 0x14, 0x02, 0x03, 0x03, 0x03, 
-    0x04, 0x13, 0x14, 0x14, 0x02, 0x03, 0x02, 0x03, 0x03, 0x14, 0x14, 0x04, 
-    0x02, 0x14, 0x04, 0x03, 0x03, 0x03, 0x02, 0x05, 0x03, 0x02, 0x03, 0x03, 
-    0x03, 0x03, 0x02, 0x05, 0x05, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 
-    0x04, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 
-    0x05, 0x02, 0x02, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05, 0x05, 0x02, 0x03, 
-    0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x04, 0x03, 0x04, 0x04, 
-    0x04, 0x03, 0x02, 0x03, 0x06, 0x06, 0x07, 0x05, 0x04, 0x03, 0x02, 0x03, 
-    0x06, 0x12, 0x12, 0x06, 0x05, 0x04, 0x02, 0x03, 0x05, 0x12, 0x13, 0x13, 
-    0x05, 0x04, 0x02, 0x02, 0x05, 0x13, 0x13, 0x14, 0x04, 0x03, 0x02, 0x02, 
-    0x04, 0x14, 0x13, 0x14, 0x04, 0x03, 0x02, 0x02, 0x04, 0x03, 0x14, 0x04, 
-    0x04, 0x03, 0x02, 0x02, 0x04, 0x03, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 
-    0x03, 0x03, 0x03, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x03, 
-    0x02, 0x03, 0x02, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 
-    0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x01, 0x03, 0x03, 0x02, 0x03, 
-    0x02, 0x01, 0x02, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 
-    0x03, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 
-    0x02, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x14, 0x14, 0x14, 0x14, 0x04, 0x03, 0x02, 
-    0x04, 0x04, 0x04, 0x14, 0x14, 0x03, 0x03, 0x02, 0x04, 0x06, 0x06, 0x06, 
-    0x06, 0x03, 0x03, 0x02, 0x04, 0x04, 0x06, 0x06, 0x06, 0x05, 0x03, 0x02, 
-    0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x03, 0x02, 0x03, 0x03, 0x03, 0x05, 
-    0x05, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x02, 
-    0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 
-    0x03, 0x03, 0x04, 0x05, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04, 
-    0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x04, 0x02, 0x02, 0x02, 0x02, 
-    0x02, 0x02, 0x03, 0x02, 0x03, 0x05, 0x13, 0x13, 0x13, 0x02, 0x02, 0x01, 
-    0x03, 0x14, 0x13, 0x13, 0x13, 0x13, 0x03, 0x01, 0x03, 0x04, 0x14, 0x14, 
-    0x13, 0x14, 0x03, 0x01, 0x03, 0x03, 0x04, 0x04, 0x14, 0x14, 0x02, 0x02, 
-    0x06, 0x06, 0x06, 0x05, 0x03, 0x03, 0x14, 0x14, 0x05, 0x05, 0x05, 0x04, 
-    0x02, 0x03, 0x14, 0x05, 0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 0x14, 0x04, 
-    0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x14, 0x14, 0x02, 0x02, 0x03, 0x02, 
-    0x02, 0x02, 0x14, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x02, 0x02, 0x03, 0x14, 0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 0x08, 
-    0x05, 0x06, 0x04, 0x04, 0x03, 0x02, 0x03, 0x14, 0x05, 0x05, 0x04, 0x04, 
-    0x03, 0x02, 0x03, 0x13, 0x04, 0x03, 0x04, 0x04, 0x03, 0x02, 0x02, 0x04, 
-    0x03, 0x03, 0x04, 0x03, 0x03, 0x02, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 
-    0x03, 0x02, 0x02, 0x04, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x04, 
-    0x02, 0x03, 0x02, 0x03, 0x02, 0x01, 0x01, 0x04, 0x08, 0x13, 0x14, 0x03, 
-    0x04, 0x06, 0x12, 0x06, 0x13, 0x12, 0x12, 0x03, 0x04, 0x04, 0x06, 0x06, 
-    0x12, 0x12, 0x13, 0x03, 0x04, 0x04, 0x04, 0x03, 0x12, 0x13, 0x03, 0x03, 
-    0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 
-    0x04, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x03, 0x02, 0x03, 
-    0x03, 0x04, 0x03, 0x02, 0x04, 0x02, 0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 
-    0x12, 0x05, 0x07, 0x06, 0x06, 0x06, 0x05, 0x04, 0x04, 0x07, 0x06, 0x12, 
-    0x12, 0x06, 0x06, 0x07, 0x04, 0x05, 0x12, 0x12, 0x12, 0x12, 0x12, 0x06, 
-    0x03, 0x05, 0x13, 0x12, 0x12, 0x12, 0x13, 0x05, 0x02, 0x03, 0x05, 0x14, 
-    0x13, 0x13, 0x14, 0x04, 0x02, 0x03, 0x03, 0x04, 0x14, 0x14, 0x04, 0x04, 
-    0x02, 0x03, 0x03, 0x03, 0x04, 0x14, 0x04, 0x04, 0x02, 0x03, 0x03, 0x03, 
-    0x03, 0x04, 0x04, 0x04, 0x07, 0x13, 0x06, 0x05, 0x03, 0x03, 0x14, 0x13, 
-    0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x03, 0x13, 0x06, 0x05, 0x05, 0x04, 
-    0x03, 0x02, 0x03, 0x13, 0x05, 0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 0x03, 
-    0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 
-    0x03, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x02, 0x03, 0x04, 
-    0x04, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x12, 0x12, 0x06, 0x12, 
-    0x12, 0x12, 0x04, 0x08, 0x12, 0x13, 0x12, 0x06, 0x07, 0x07, 0x03, 0x05, 
-    0x13, 0x12, 0x06, 0x07, 0x06, 0x06, 0x03, 0x04, 0x13, 0x12, 0x12, 0x06, 
-    0x06, 0x04, 0x03, 0x04, 0x13, 0x13, 0x13, 0x13, 0x04, 0x04, 0x03, 0x04, 
-    0x14, 0x13, 0x14, 0x14, 0x04, 0x04, 0x02, 0x03, 0x04, 0x14, 0x04, 0x04, 
-    0x04, 0x03, 0x02, 0x03, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 
-    0x13, 0x12, 0x12, 0x12, 0x05, 0x04, 0x12, 0x12, 0x07, 0x12, 0x12, 0x06, 
-    0x06, 0x12, 0x12, 0x12, 0x05, 0x13, 0x07, 0x12, 0x12, 0x12, 0x12, 0x12, 
-    0x05, 0x05, 0x05, 0x07, 0x12, 0x07, 0x04, 0x13, 0x05, 0x05, 0x05, 0x13, 
-    0x05, 0x13, 0x04, 0x03, 0x04, 0x05, 0x05, 0x05, 0x13, 0x04, 0x03, 0x14, 
-    0x04, 0x05, 0x05, 0x05, 0x13, 0x04, 0x03, 0x14, 0x03, 0x04, 0x05, 0x05, 
-    0x05, 0x04, 0x03, 0x04, 0x12, 0x12, 0x14, 0x13, 0x14, 0x04, 0x08, 0x08, 
-    0x12, 0x14, 0x13, 0x13, 0x14, 0x14, 0x04, 0x03, 0x13, 0x13, 0x13, 0x14, 
-    0x14, 0x04, 0x03, 0x03, 0x13, 0x13, 0x13, 0x14, 0x14, 0x04, 0x03, 0x03, 
-    0x13, 0x14, 0x14, 0x14, 0x03, 0x03, 0x03, 0x02, 0x14, 0x14, 0x13, 0x13, 
-    0x14, 0x03, 0x02, 0x02, 0x13, 0x14, 0x14, 0x14, 0x03, 0x03, 0x02, 0x02, 
-    0x14, 0x14, 0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 0x05, 0x07, 0x06, 0x12, 
-    0x06, 0x13, 0x06, 0x13, 0x05, 0x06, 0x12, 0x06, 0x06, 0x06, 0x06, 0x06, 
-    0x05, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x12, 0x04, 0x05, 0x06, 0x06, 
-    0x06, 0x06, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 
-    0x03, 0x04, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x04, 0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x13, 
-    0x05, 0x07, 0x06, 0x14, 0x14, 0x14, 0x08, 0x08, 0x07, 0x06, 0x14, 0x14, 
-    0x14, 0x14, 0x03, 0x13, 0x06, 0x05, 0x13, 0x14, 0x14, 0x04, 0x03, 0x05, 
-    0x05, 0x05, 0x04, 0x13, 0x04, 0x03, 0x02, 0x05, 0x03, 0x04, 0x04, 0x04, 
-    0x14, 0x03, 0x02, 0x04, 0x04, 0x03, 0x03, 0x13, 0x03, 0x03, 0x02, 0x04, 
-    0x05, 0x05, 0x04, 0x03, 0x03, 0x02, 0x02, 0x04, 0x13, 0x14, 0x04, 0x04, 
-    0x03, 0x02, 0x02, 0x03, 0x08, 0x05, 0x12, 0x12, 0x12, 0x13, 0x13, 0x14, 
-    0x12, 0x12, 0x12, 0x12, 0x12, 0x07, 0x05, 0x05, 0x13, 0x13, 0x13, 0x13, 
-    0x14, 0x05, 0x04, 0x04, 0x14, 0x13, 0x14, 0x14, 0x04, 0x04, 0x03, 0x03, 
-    0x05, 0x13, 0x14, 0x05, 0x04, 0x04, 0x03, 0x03, 0x05, 0x14, 0x04, 0x05, 
-    0x04, 0x04, 0x03, 0x03, 0x05, 0x14, 0x06, 0x05, 0x04, 0x04, 0x03, 0x03, 
-    0x04, 0x05, 0x05, 0x05, 0x04, 0x03, 0x03, 0x02, 0x05, 0x05, 0x13, 0x13, 
-    0x06, 0x06, 0x08, 0x08, 0x04, 0x12, 0x12, 0x12, 0x12, 0x05, 0x06, 0x05, 
-    0x03, 0x13, 0x12, 0x12, 0x13, 0x05, 0x04, 0x04, 0x03, 0x03, 0x13, 0x13, 
-    0x14, 0x04, 0x03, 0x04, 0x03, 0x03, 0x13, 0x14, 0x03, 0x03, 0x02, 0x04, 
-    0x02, 0x03, 0x14, 0x04, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x13, 
-    0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 
-    0x05, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 
-    0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x03, 0x04, 0x04, 0x03, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 
-    0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 
-    0x03, 0x03, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x01, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 
-    0x05, 0x04, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x05, 0x04, 0x03, 0x04, 
-    0x02, 0x03, 0x03, 0x04, 0x04, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 
-    0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 
-    0x01, 0x02, 0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x14, 0x04, 0x14, 0x03, 0x02, 0x03, 0x02, 0x02, 0x04, 0x04, 0x04, 0x03, 
-    0x03, 0x02, 0x03, 0x02, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 
-    0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x02, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x06, 0x06, 
-    0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x05, 0x06, 0x03, 0x02, 0x01, 0x01, 
-    0x02, 0x03, 0x05, 0x05, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x05, 
-    0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x06, 0x04, 0x03, 
-    0x02, 0x02, 0x02, 0x03, 0x06, 0x05, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 
-    0x05, 0x04, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x03, 
-    0x02, 0x01, 0x02, 0x02, 0x04, 0x04, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 
-    0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x04, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x02, 0x03, 0x04, 0x05, 0x04, 
-    0x04, 0x03, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03, 0x02, 0x02, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x04, 0x03, 
-    0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 
-    0x01, 0x02, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 
-    0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 
-    0x03, 0x03, 0x04, 0x05, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x04, 0x04, 
-    0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x02, 0x02, 
-    0x01, 0x02, 0x03, 0x03, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 
-    0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 
-    0x03, 0x03, 0x02, 0x03, 0x03, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 
-    0x02, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 
-    0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 
-    0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 
-    0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 
-    0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 
-    0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x03, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x04, 0x04, 
-    0x14, 0x05, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04, 0x05, 0x04, 0x02, 0x02, 
-    0x03, 0x02, 0x03, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 
-    0x03, 0x04, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x03, 0x01, 0x01, 
-    0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 
-    0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 
-    0x05, 0x06, 0x06, 0x06, 0x06, 0x03, 0x02, 0x02, 0x03, 0x05, 0x06, 0x06, 
-    0x05, 0x04, 0x03, 0x02, 0x02, 0x03, 0x05, 0x05, 0x04, 0x04, 0x03, 0x02, 
-    0x02, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x03, 0x01, 0x02, 0x01, 
-    0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
-    0x02, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 
-    0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 
-    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 
-    0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 
-    0x04, 0x02, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 
-    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x02, 0x03, 
-    0x03, 0x03, 0x05, 0x05, 0x01, 0x02, 0x01, 0x03, 0x03, 0x03, 0x04, 0x05, 
-    0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x04, 0x04, 0x01, 0x02, 0x01, 0x02, 
-    0x03, 0x02, 0x04, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x03, 0x04, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x05, 0x03, 0x02, 0x02, 0x03, 
-    0x05, 0x05, 0x05, 0x05, 0x03, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x04, 
-    0x03, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x02, 
-    0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x04, 0x04, 0x03, 0x03, 
-    0x02, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 
-    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x03, 0x04, 0x05, 0x05, 0x05, 0x04, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 
-    0x05, 0x04, 0x03, 0x04, 0x02, 0x03, 0x03, 0x04, 0x04, 0x03, 0x02, 0x03, 
-    0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 
-    0x03, 0x02, 0x02, 0x03, 0x01, 0x02, 0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 
-    0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x14, 0x04, 0x14, 0x03, 0x02, 0x03, 0x02, 0x02, 
-    0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x03, 0x02, 0x04, 0x03, 0x03, 0x03, 
-    0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 
-    0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x04, 0x04, 
-    0x03, 0x04, 0x14, 0x13, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x04, 0x14, 
-    0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x14, 0x03, 0x02, 0x03, 0x03, 
-    0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x03, 
-    0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 
-    0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
-    0x14, 0x14, 0x04, 0x03, 0x02, 0x01, 0x01, 0x03, 0x14, 0x04, 0x03, 0x02, 
-    0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 
-    0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x04, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x02, 
-    0x03, 0x04, 0x05, 0x04, 0x04, 0x03, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 
-    0x04, 0x03, 0x02, 0x02, 0x03, 0x04, 0x03, 0x04, 0x03, 0x03, 0x02, 0x01, 
-    0x02, 0x03, 0x04, 0x03, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 
-    0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 
-    0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x01, 0x02, 
-    0x01, 0x02, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 
-    0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
-
-};
-
-const unsigned short background_palette [] = {
-    0x7c1f, 0x0000, 0x2008, 0x200c, 0x2110, 0x2218, 0x429c, 0x439c, 0x0010, 
-    0x0088, 0x2084, 0x2088, 0x2108, 0x218c, 0x2210, 0x4210, 0x4214, 0x4294, 
-    0x2394, 0x228c, 0x0188, 0x0104, 0x2398, 0x7fff, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x7fff, 0x0000
-};
-
+/* background_data is compressed, load it with asset_load(ASSET_BACKGROUND_DATA, dest) */
+/* background_palette is compressed, load it with asset_load(ASSET_BACKGROUND_PALETTE, dest) */
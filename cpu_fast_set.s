@@ -0,0 +1,12 @@
+@cpu_fast_set.s
+
+/* a function to copy or fill memory with the BIOS CpuFastSet call */
+/* cpu_fast_set(source, dest, mode) */
+/* this moves 8 words at a time, so both addresses must be word aligned and */
+/* the number of words in the low 21 bits of mode is rounded up to a multiple of 8 */
+/* bit 24 of mode fills with the word at source rather than copying */
+
+.global cpu_fast_set
+cpu_fast_set:
+	swi 0x0C0000 /* the BIOS takes source, dest and mode in r0-r2 */
+	mov pc,lr
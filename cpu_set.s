@@ -0,0 +1,11 @@
+@cpu_set.s
+
+/* a function to copy or fill memory with the BIOS CpuSet call */
+/* cpu_set(source, dest, mode) */
+/* mode is the number of units in the low 21 bits, bit 24 to fill with */
+/* the value at source rather than copy, and bit 26 to use words not halfwords */
+
+.global cpu_set
+cpu_set:
+	swi 0x0B0000 /* the BIOS takes source, dest and mode in r0-r2 */
+	mov pc,lr
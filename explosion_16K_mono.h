@@ -1,984 +0,0 @@
-/* explosion_16K_mono.h
- * generated by raw2gba */
-
-#define explosion_16K_mono_bytes 11703
-
-const signed char explosion_16K_mono [] = {
-    0xFC, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 
-    0xF9, 0xF9, 0xF9, 0xF8, 0xF9, 0xFA, 0xF9, 0xFB, 0xFA, 0xFD, 0x01, 0x11, 
-    0x22, 0x31, 0x38, 0x3D, 0x42, 0x40, 0x3D, 0x3C, 0x3F, 0x42, 0x44, 0x41, 
-    0x41, 0x3E, 0x3D, 0x3E, 0x41, 0x3F, 0x38, 0x31, 0x2C, 0x2B, 0x2B, 0x2E, 
-    0x32, 0x39, 0x3C, 0x3E, 0x3B, 0x39, 0x38, 0x38, 0x3A, 0x3A, 0x39, 0x36, 
-    0x35, 0x36, 0x37, 0x37, 0x36, 0x33, 0x32, 0x33, 0x34, 0x37, 0x36, 0x33, 
-    0x2F, 0x30, 0x32, 0x37, 0x33, 0x2B, 0x1C, 0x0F, 0xFF, 0xF1, 0xEF, 0xE2, 
-    0xE1, 0xE2, 0xE3, 0xEF, 0xFA, 0x06, 0x16, 0x27, 0x35, 0x31, 0x30, 0x2D, 
-    0x2A, 0x28, 0x26, 0x1B, 0x0A, 0xF7, 0xEC, 0xE7, 0xE2, 0xE3, 0xE6, 0xEB, 
-    0xEC, 0xEA, 0xE5, 0xE7, 0xE6, 0xEC, 0xF6, 0x00, 0x12, 0x20, 0x2E, 0x2D, 
-    0x2E, 0x2C, 0x1E, 0x13, 0x06, 0xF6, 0xE5, 0xDA, 0xDD, 0xDD, 0xDE, 0xEA, 
-    0xFB, 0x0F, 0x10, 0x06, 0xF8, 0xED, 0xE5, 0xDF, 0xDC, 0xDC, 0xDF, 0xDF, 
-    0xE1, 0xE3, 0xE7, 0xEA, 0xF2, 0xF7, 0xFB, 0xF1, 0xEB, 0xE3, 0xE0, 0xDB, 
-    0xD9, 0xE7, 0xE6, 0xF4, 0xF8, 0xF9, 0xFB, 0xF6, 0xEF, 0xE3, 0xED, 0x02, 
-    0x1D, 0x27, 0x27, 0x20, 0x11, 0x0F, 0xFE, 0xEB, 0xE1, 0xDE, 0xDE, 0xDD, 
-    0xDE, 0xDE, 0xDF, 0xDE, 0xDF, 0xDE, 0xDF, 0xDF, 0xDE, 0xE0, 0xE4, 0xE7, 
-    0xE7, 0xE4, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xDF, 0xDE, 0xE0, 0xE3, 0xE7, 
-    0xE7, 0xEB, 0xEA, 0xEB, 0xE8, 0xE6, 0xE2, 0xE2, 0xDE, 0xDF, 0xDE, 0xEA, 
-    0xEF, 0xFB, 0x10, 0x10, 0x2A, 0x1F, 0x06, 0xEF, 0xE4, 0xE3, 0xDF, 0xE1, 
-    0xDF, 0xE1, 0xE0, 0xE2, 0xE1, 0xE2, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 
-    0xE2, 0xE1, 0xE2, 0xE1, 0xE2, 0xE0, 0xE6, 0xF5, 0x04, 0x0E, 0x06, 0x01, 
-    0xFA, 0xF2, 0xE9, 0xDF, 0xDF, 0xE2, 0xE6, 0xE5, 0xE0, 0xDD, 0xE2, 0xEE, 
-    0xF9, 0xFB, 0x07, 0x0C, 0x0F, 0x09, 0xF8, 0xE9, 0xDF, 0xE2, 0xE3, 0xE4, 
-    0xE2, 0xE1, 0xE1, 0xE3, 0xE3, 0xE4, 0xE4, 0xE3, 0xE2, 0xE2, 0xE3, 0xE4, 
-    0xE4, 0xE3, 0xE3, 0xE6, 0xEA, 0xEF, 0xFA, 0xFC, 0x08, 0x15, 0x1E, 0x26, 
-    0x2A, 0x2B, 0x1F, 0x16, 0x08, 0xFA, 0xEA, 0xE2, 0xE4, 0xE3, 0xE4, 0xE3, 
-    0xE3, 0xE1, 0xE5, 0xE9, 0xEE, 0xF2, 0xF6, 0xF9, 0xF6, 0xF2, 0xEC, 0xE9, 
-    0xE6, 0xE4, 0xE4, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 
-    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 
-    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 
-    0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 
-    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE9, 0xE8, 0xE9, 0xE8, 0xE9, 0xE9, 
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xE9, 0xEE, 
-    0xF1, 0xF6, 0xF7, 0xFA, 0xFA, 0xFD, 0xFE, 0x01, 0x0C, 0x0D, 0x1A, 0x22, 
-    0x25, 0x26, 0x26, 0x29, 0x2B, 0x2F, 0x30, 0x30, 0x31, 0x32, 0x31, 0x31, 
-    0x31, 0x31, 0x30, 0x30, 0x2F, 0x30, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E, 0x2E, 
-    0x2E, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 
-    0x29, 0x28, 0x29, 0x28, 0x28, 0x26, 0x24, 0x23, 0x20, 0x1F, 0x1D, 0x1B, 
-    0x0F, 0x04, 0xF9, 0xF4, 0xEE, 0xEA, 0xE9, 0xE9, 0xE9, 0xE4, 0xE5, 0xE0, 
-    0xDE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDB, 0xDB, 0xDC, 0xDD, 0xDC, 0xDC, 
-    0xDC, 0xDC, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDE, 
-    0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDF, 0xDE, 0xDF, 0xDF, 0xDF, 0xDF, 
-    0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 
-    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 
-    0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 
-    0xE3, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE5, 0xE5, 0xE5, 
-    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE6, 
-    0xE6, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 
-    0xE7, 0xE7, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 
-    0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xEA, 
-    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 
-    0xEB, 0xEB, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEC, 0xEC, 
-    0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xED, 0xEC, 0xED, 0xEC, 0xED, 0xED, 0xED, 
-    0xEC, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 
-    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 
-    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 
-    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 
-    0xF1, 0xF1, 0xF1, 0xF2, 0xF4, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xF5, 
-    0xF4, 0xF2, 0xF3, 0xF0, 0xF4, 0xF6, 0xFA, 0x07, 0x1C, 0x2E, 0x36, 0x34, 
-    0x31, 0x30, 0x35, 0x38, 0x33, 0x33, 0x21, 0x14, 0x0E, 0x1A, 0x24, 0x2B, 
-    0x2F, 0x34, 0x35, 0x31, 0x2E, 0x2D, 0x32, 0x36, 0x39, 0x37, 0x37, 0x34, 
-    0x36, 0x36, 0x37, 0x34, 0x32, 0x2E, 0x2B, 0x26, 0x23, 0x22, 0x26, 0x29, 
-    0x2A, 0x2F, 0x2F, 0x31, 0x31, 0x31, 0x30, 0x30, 0x2F, 0x2E, 0x2D, 0x2D, 
-    0x2C, 0x2C, 0x2C, 0x2C, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2B, 
-    0x2A, 0x29, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 
-    0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 
-    0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x22, 0x22, 0x21, 0x21, 0x21, 
-    0x21, 0x21, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 
-    0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 
-    0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 
-    0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 
-    0x14, 0x14, 0x13, 0x12, 0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x10, 0x0E, 
-    0x0B, 0x09, 0x08, 0x07, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x0F, 0x09, 0x06, 
-    0x00, 0xFB, 0xF5, 0xF6, 0xFA, 0xFB, 0x01, 0x01, 0x03, 0x03, 0x01, 0xFC, 
-    0xFA, 0xFA, 0xFA, 0xFC, 0xFE, 0x00, 0x03, 0x05, 0x05, 0x09, 0x06, 0x02, 
-    0xF8, 0xEF, 0xE4, 0xDB, 0xD3, 0xDA, 0xED, 0xFA, 0x03, 0x03, 0x09, 0x08, 
-    0x09, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x05, 0xFF, 0xFB, 
-    0xFA, 0xF9, 0xF8, 0xFA, 0xFC, 0x01, 0x04, 0x05, 0x04, 0x03, 0x02, 0x00, 
-    0xFF, 0xFF, 0x00, 0x00, 0x02, 0x03, 0x04, 0x06, 0x06, 0x07, 0x07, 0x06, 
-    0x05, 0x02, 0x00, 0xFC, 0xFA, 0xFA, 0xFC, 0xFF, 0x00, 0x00, 0x01, 0x02, 
-    0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 
-    0xF9, 0xF9, 0xF8, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 
-    0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF4, 0xF5, 0xF4, 0xF5, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 
-    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF3, 
-    0xF3, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF2, 0xF3, 0xF2, 0xF3, 
-    0xF2, 0xF3, 0xF2, 0xF3, 0xF2, 0xF3, 0xF2, 0xF3, 0xF2, 0xF2, 0xF2, 0xF2, 
-    0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 
-    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 
-    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 
-    0xF1, 0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 
-    0xF0, 0xF0, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 
-    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xEF, 
-    0xEF, 0xED, 0xEE, 0xEF, 0xF0, 0xEC, 0xE6, 0xD9, 0xD2, 0xBD, 0xB7, 0xB1, 
-    0xA6, 0xB2, 0xB4, 0xC2, 0xD1, 0xE5, 0xEE, 0xEE, 0xF0, 0xF2, 0xEE, 0xF1, 
-    0xE2, 0xD6, 0xD0, 0xB8, 0xB3, 0xAA, 0xA8, 0xA6, 0xA7, 0xA7, 0xA9, 0xA9, 
-    0xAB, 0xAC, 0xAF, 0xB1, 0xB2, 0xB2, 0xAE, 0xAC, 0xAA, 0xAC, 0xAC, 0xAD, 
-    0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB0, 0xB0, 0xB1, 
-    0xB1, 0xB1, 0xB2, 0xB2, 0xB3, 0xB3, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 
-    0xB6, 0xB6, 0xB6, 0xB6, 0xB7, 0xB7, 0xB8, 0xB8, 0xB9, 0xB9, 0xB9, 0xBA, 
-    0xBA, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xBC, 0xBD, 0xBD, 0xBD, 0xBD, 
-    0xBE, 0xBE, 0xBF, 0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC2, 
-    0xC2, 0xC2, 0xC3, 0xC3, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 
-    0xC5, 0xC6, 0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC8, 0xC8, 0xC8, 0xC9, 0xC9, 
-    0xC9, 0xCA, 0xCA, 0xCA, 0xCA, 0xCB, 0xCB, 0xCC, 0xCC, 0xCC, 0xCD, 0xCD, 
-    0xCD, 0xCD, 0xCD, 0xCD, 0xCE, 0xCE, 0xCF, 0xCF, 0xCF, 0xCF, 0xD0, 0xD0, 
-    0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD3, 
-    0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 
-    0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xD9, 
-    0xD9, 0xD9, 0xD9, 0xD9, 0xDA, 0xDA, 0xDB, 0xDA, 0xDB, 0xDB, 0xDC, 0xDC, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDE, 0xDE, 
-    0xDF, 0xE0, 0xE0, 0xE3, 0xE5, 0xE9, 0xEC, 0xEF, 0xF0, 0xF3, 0xF3, 0xF3, 
-    0xEF, 0xEE, 0xEC, 0xED, 0xEC, 0xE7, 0xE2, 0xDC, 0xEA, 0xFE, 0x0F, 0x13, 
-    0x1D, 0x2A, 0x31, 0x2A, 0x26, 0x1B, 0x0D, 0xFB, 0xED, 0xE7, 0xE1, 0xE5, 
-    0xED, 0x01, 0x06, 0x10, 0x22, 0x29, 0x32, 0x28, 0x19, 0x0C, 0x06, 0x07, 
-    0x04, 0x13, 0x22, 0x33, 0x29, 0x22, 0x1E, 0x0D, 0x04, 0xF3, 0xEB, 0xE8, 
-    0xE7, 0xE8, 0xF1, 0xF9, 0x04, 0x10, 0x1E, 0x26, 0x2A, 0x29, 0x27, 0x27, 
-    0x27, 0x29, 0x2A, 0x2A, 0x28, 0x29, 0x28, 0x29, 0x27, 0x27, 0x26, 0x26, 
-    0x25, 0x24, 0x23, 0x22, 0x22, 0x22, 0x23, 0x24, 0x25, 0x26, 0x26, 0x26, 
-    0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 
-    0x24, 0x22, 0x22, 0x21, 0x21, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x23, 0x23, 0x23, 0x22, 0x22, 0x21, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x1F, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1C, 0x1D, 
-    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1C, 0x1B, 
-    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 
-    0x1A, 0x1A, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 
-    0x16, 0x14, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 
-    0x14, 0x15, 0x15, 0x15, 0x14, 0x14, 0x13, 0x13, 0x12, 0x11, 0x10, 0x0E, 
-    0x0C, 0x09, 0x0A, 0x0C, 0x0E, 0x0F, 0x0B, 0x09, 0x06, 0x05, 0x03, 0x03, 
-    0x04, 0x05, 0x06, 0x07, 0x0A, 0x09, 0x0C, 0x0C, 0x0E, 0x0E, 0x0F, 0x0E, 
-    0x0A, 0xFF, 0xF2, 0xE8, 0xDE, 0xD9, 0xD1, 0xE2, 0xE3, 0xEE, 0xF2, 0xE1, 
-    0xD7, 0xCD, 0xD2, 0xCF, 0xD2, 0xD2, 0xD3, 0xD8, 0xE3, 0xF0, 0xF5, 0xF5, 
-    0xF5, 0xF1, 0xEA, 0xE0, 0xD6, 0xD2, 0xD2, 0xD6, 0xD6, 0xD7, 0xD5, 0xD6, 
-    0xD5, 0xD7, 0xD7, 0xD8, 0xDB, 0xDE, 0xDF, 0xDE, 0xDD, 0xDA, 0xD7, 0xD3, 
-    0xD4, 0xD7, 0xDB, 0xDB, 0xD9, 0xD6, 0xD5, 0xD4, 0xD4, 0xD5, 0xD8, 0xDA, 
-    0xE0, 0xE8, 0xF5, 0x01, 0x07, 0x00, 0xF7, 0xF2, 0xE6, 0xE6, 0xDE, 0xDC, 
-    0xE1, 0xE4, 0xE5, 0xE2, 0xE0, 0xDF, 0xDF, 0xE0, 0xE0, 0xE1, 0xE0, 0xE5, 
-    0xE8, 0xEB, 0xF4, 0xFB, 0x07, 0x10, 0x15, 0x17, 0x17, 0x15, 0x11, 0x0A, 
-    0x03, 0xF3, 0xEB, 0xE2, 0xE9, 0xFB, 0x0B, 0x16, 0x16, 0x1C, 0x1B, 0x1C, 
-    0x1C, 0x1B, 0x1A, 0x1A, 0x15, 0x10, 0x09, 0x08, 0x08, 0x09, 0x0C, 0x0E, 
-    0x11, 0x12, 0x15, 0x15, 0x16, 0x17, 0x19, 0x19, 0x1D, 0x1F, 0x1E, 0x1E, 
-    0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1B, 0x1B, 
-    0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 
-    0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 
-    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x16, 0x17, 0x0E, 
-    0x0B, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 
-    0x0A, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
-    0x04, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 
-    0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 
-    0x00, 0xFF, 0x00, 0xFE, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 
-    0xFC, 0xFC, 0xFF, 0x00, 0xFF, 0xFD, 0xFA, 0xFC, 0xFE, 0x02, 0x00, 0xF6, 
-    0xEA, 0xE1, 0xE1, 0xDF, 0xE4, 0xEB, 0xF7, 0xFE, 0x00, 0xFD, 0xFB, 0xFB, 
-    0xFC, 0xFD, 0xFE, 0xFE, 0xFB, 0xFB, 0xFA, 0xFB, 0xFB, 0xF9, 0xF6, 0xF4, 
-    0xF6, 0xFA, 0xFD, 0xFA, 0xF9, 0xF7, 0xF5, 0xF5, 0xF3, 0xF3, 0xF5, 0xF8, 
-    0xFA, 0xFB, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB, 0xFB, 0xFB, 0xFA, 0xF9, 0xFA, 
-    0xF8, 0xF7, 0xE8, 0xD7, 0xC7, 0xCF, 0xDB, 0xE3, 0xEF, 0xF6, 0x01, 0xFE, 
-    0xFE, 0xF7, 0xF7, 0xF7, 0xFD, 0xFB, 0xF4, 0xE9, 0xDD, 0xCE, 0xBD, 0xB7, 
-    0xBC, 0xD0, 0xD2, 0xE2, 0xF1, 0xF9, 0x02, 0xF5, 0xE5, 0xD5, 0xCF, 0xC7, 
-    0xB7, 0xB9, 0xB9, 0xBA, 0xC1, 0xC4, 0xC7, 0xD2, 0xDE, 0xEF, 0xF7, 0xF9, 
-    0xF9, 0xE9, 0xDE, 0xCF, 0xC3, 0xBB, 0xB8, 0xB4, 0xB3, 0xB2, 0xB3, 0xB8, 
-    0xC9, 0xDB, 0xE7, 0xE0, 0xD4, 0xCC, 0xC4, 0xBE, 0xB6, 0xBA, 0xBB, 0xBF, 
-    0xBC, 0xBA, 0xB6, 0xB7, 0xBE, 0xC4, 0xC7, 0xC5, 0xC2, 0xBE, 0xBD, 0xBB, 
-    0xBC, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBF, 
-    0xBF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC2, 
-    0xC2, 0xC2, 0xC3, 0xC3, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xC5, 0xC5, 0xC5, 
-    0xC5, 0xC6, 0xC6, 0xC7, 0xC7, 0xC7, 0xC8, 0xC8, 0xC8, 0xC9, 0xC9, 0xC9, 
-    0xC9, 0xCA, 0xC9, 0xCB, 0xD4, 0xD5, 0xD4, 0xD5, 0xD5, 0xD5, 0xD6, 0xCE, 
-    0xCB, 0xCC, 0xCC, 0xCC, 0xCD, 0xCC, 0xD2, 0xD8, 0xD7, 0xD8, 0xD8, 0xD9, 
-    0xDA, 0xD6, 0xCF, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD1, 0xD1, 
-    0xD1, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 
-    0xD4, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 
-    0xD7, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xDA, 
-    0xDA, 0xDA, 0xDA, 0xDA, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 
-    0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE1, 0xE0, 0xE2, 0xE1, 0xE6, 0xED, 0xEC, 
-    0xED, 0xEC, 0xEC, 0xEB, 0xEC, 0xED, 0xF2, 0xF6, 0xF8, 0xF3, 0xF0, 0xEF, 
-    0xF3, 0xF7, 0xF9, 0xFB, 0xFF, 0x05, 0x04, 0x02, 0xFB, 0x08, 0x19, 0x2D, 
-    0x2E, 0x29, 0x1C, 0x09, 0xFD, 0xEE, 0xEE, 0xE7, 0xE9, 0xEE, 0xF2, 0xFA, 
-    0xFF, 0x08, 0x0E, 0x15, 0x11, 0x02, 0xF2, 0xEE, 0x00, 0x03, 0x11, 0x1E, 
-    0x22, 0x30, 0x2C, 0x2A, 0x24, 0x21, 0x1A, 0x14, 0x18, 0x20, 0x2C, 0x1C, 
-    0x1C, 0x06, 0xF2, 0xF4, 0xFB, 0x0A, 0x13, 0x21, 0x29, 0x2F, 0x2B, 0x29, 
-    0x28, 0x2B, 0x2C, 0x2E, 0x2C, 0x28, 0x26, 0x25, 0x29, 0x28, 0x29, 0x26, 
-    0x26, 0x25, 0x2A, 0x2B, 0x23, 0x12, 0x04, 0x03, 0xFC, 0xFC, 0x01, 0x09, 
-    0x18, 0x22, 0x27, 0x2D, 0x2D, 0x2D, 0x2F, 0x31, 0x30, 0x2D, 0x26, 0x1D, 
-    0x1A, 0x16, 0x10, 0x13, 0x19, 0x1E, 0x20, 0x20, 0x21, 0x20, 0x20, 0x1F, 
-    0x1F, 0x1F, 0x1F, 0x1E, 0x1B, 0x15, 0x11, 0x0F, 0x16, 0x19, 0x1A, 0x21, 
-    0x26, 0x29, 0x29, 0x23, 0x1D, 0x1F, 0x1D, 0x1D, 0x1C, 0x1B, 0x1B, 0x18, 
-    0x15, 0x11, 0x13, 0x14, 0x16, 0x17, 0x19, 0x1A, 0x1A, 0x1A, 0x19, 0x18, 
-    0x17, 0x16, 0x14, 0x12, 0x10, 0x0E, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 
-    0x0C, 0x0F, 0x12, 0x16, 0x15, 0x12, 0x10, 0x0F, 0x10, 0x10, 0x13, 0x14, 
-    0x16, 0x17, 0x17, 0x16, 0x15, 0x13, 0x11, 0x0E, 0x0A, 0x06, 0x03, 0x02, 
-    0x03, 0x05, 0x07, 0x0E, 0x10, 0x13, 0x0C, 0x03, 0xFE, 0xFF, 0xF7, 0xEF, 
-    0xFC, 0x0C, 0x1B, 0x18, 0x15, 0x10, 0x08, 0xFF, 0xF7, 0xFA, 0xFE, 0xFE, 
-    0x01, 0x05, 0x07, 0x06, 0x05, 0x02, 0xFC, 0xF3, 0xE5, 0xDC, 0xD7, 0xDD, 
-    0xDA, 0xE0, 0xE4, 0xDE, 0xDA, 0xE1, 0xEB, 0xF3, 0xFF, 0x0B, 0x18, 0x0F, 
-    0x07, 0xFE, 0xF3, 0xF2, 0xE1, 0xD8, 0xDA, 0xDB, 0xDE, 0xDB, 0xD9, 0xD9, 
-    0xE0, 0xEB, 0xF2, 0xF3, 0xF0, 0xEA, 0xE8, 0xE4, 0xDE, 0xDA, 0xD9, 0xD9, 
-    0xD8, 0xD8, 0xD6, 0xD7, 0xD7, 0xD9, 0xDA, 0xD8, 0xD6, 0xD5, 0xD5, 0xD5, 
-    0xD6, 0xD8, 0xD9, 0xDB, 0xDA, 0xDA, 0xD6, 0xD6, 0xD4, 0xD3, 0xD4, 0xDA, 
-    0xE4, 0xE4, 0xED, 0xEB, 0xE9, 0xE7, 0xE4, 0xE1, 0xDE, 0xE0, 0xE4, 0xE6, 
-    0xE2, 0xDB, 0xDE, 0xE6, 0xE5, 0xEA, 0xEB, 0xE7, 0xE5, 0xE0, 0xE0, 0xEB, 
-    0xF5, 0xFF, 0x0D, 0x13, 0x1A, 0x22, 0x1E, 0x1D, 0x18, 0x10, 0x0C, 0x0A, 
-    0x02, 0x01, 0x05, 0x06, 0x09, 0x06, 0x02, 0x06, 0x07, 0x02, 0x00, 0x00, 
-    0x00, 0x01, 0xFF, 0xFF, 0x07, 0x0C, 0x0F, 0x12, 0x13, 0x17, 0x20, 0x20, 
-    0x1F, 0x1F, 0x1E, 0x1D, 0x1C, 0x12, 0x0F, 0x10, 0x0E, 0x0D, 0x07, 0x02, 
-    0xFC, 0x00, 0x02, 0x05, 0x0C, 0x0D, 0x14, 0x17, 0x17, 0x18, 0x17, 0x17, 
-    0x17, 0x16, 0x16, 0x15, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0F, 
-    0x10, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x11, 0x11, 0x12, 0x11, 0x12, 0x1B, 0x1A, 0x19, 0x19, 
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x18, 0x18, 
-    0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 
-    0x17, 0x17, 0x16, 0x16, 0x15, 0x14, 0x14, 0x13, 0x12, 0x12, 0x13, 0x14, 
-    0x14, 0x14, 0x14, 0x13, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 
-    0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x08, 0x07, 0x06, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 
-    0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x03, 
-    0x01, 0x07, 0x0D, 0x0B, 0x0B, 0x0A, 0x09, 0x0A, 0x07, 0xFF, 0x01, 0x01, 
-    0x01, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFE, 
-    0xFD, 0xFC, 0xFB, 0xFB, 0xFB, 0xFC, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFE, 
-    0xFD, 0xFB, 0xF9, 0xF7, 0xF7, 0xF6, 0xF7, 0xF9, 0xFA, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFB, 0xFB, 0xFA, 0xFA, 0xF9, 0xF9, 0xF9, 0xFA, 0xFC, 0xFA, 0x00, 
-    0x06, 0x03, 0x03, 0x02, 0x01, 0x02, 0x00, 0xF8, 0xF8, 0xF3, 0xEF, 0xEB, 
-    0xE8, 0xE6, 0xE3, 0xEB, 0xF2, 0xFB, 0xF7, 0xF0, 0xE9, 0xDE, 0xD3, 0xC7, 
-    0xC3, 0xC1, 0xC1, 0xC2, 0xC7, 0xCB, 0xCB, 0xCF, 0xD2, 0xD3, 0xCF, 0xC6, 
-    0xC1, 0xC1, 0xD2, 0xDD, 0xE7, 0xE2, 0xE5, 0xE5, 0xD4, 0xD3, 0xBD, 0xBF, 
-    0xC3, 0xC6, 0xC9, 0xCA, 0xCD, 0xC9, 0xC7, 0xC1, 0xC3, 0xBC, 0xB7, 0xB9, 
-    0xB9, 0xBA, 0xBB, 0xBB, 0xBB, 0xBA, 0xBC, 0xBD, 0xBF, 0xC0, 0xC2, 0xC3, 
-    0xC4, 0xC3, 0xC5, 0xC4, 0xC5, 0xC5, 0xC4, 0xD4, 0xE5, 0xF7, 0xF4, 0xEE, 
-    0xE5, 0xD9, 0xCC, 0xC1, 0xC0, 0xC0, 0xC4, 0xC3, 0xC6, 0xC4, 0xC5, 0xC6, 
-    0xC9, 0xCB, 0xCD, 0xD0, 0xD2, 0xDB, 0xDB, 0xD8, 0xD7, 0xD6, 0xD6, 0xD6, 
-    0xD7, 0xD9, 0xDA, 0xD9, 0xD7, 0xD4, 0xD8, 0xD7, 0xD2, 0xD1, 0xCE, 0xCB, 
-    0xC9, 0xC9, 0xC7, 0xC6, 0xC6, 0xC7, 0xC8, 0xC9, 0xC9, 0xC9, 0xCA, 0xCB, 
-    0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xCF, 0xCF, 0xCE, 0xCE, 0xCC, 0xCC, 0xCB, 
-    0xD1, 0xD9, 0xD8, 0xD7, 0xD6, 0xD5, 0xD7, 0xD5, 0xCD, 0xCD, 0xCE, 0xCE, 
-    0xCE, 0xCE, 0xCE, 0xD7, 0xDC, 0xDD, 0xDE, 0xDB, 0xDB, 0xDB, 0xD5, 0xCF, 
-    0xD1, 0xD0, 0xD1, 0xD0, 0xD2, 0xD3, 0xD5, 0xD5, 0xD5, 0xD6, 0xD5, 0xD4, 
-    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xD5, 0xD5, 0xD6, 0xD7, 0xD7, 
-    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD5, 0xD6, 0xD5, 0xD7, 0xD7, 0xDD, 0xE6, 
-    0xEC, 0xF2, 0xF7, 0xF3, 0xF0, 0xEA, 0xDF, 0xDA, 0xD9, 0xD8, 0xD8, 0xD9, 
-    0xD9, 0xE2, 0xE5, 0xE5, 0xE8, 0xEB, 0xED, 0xEF, 0xE7, 0xE0, 0xE0, 0xDF, 
-    0xDF, 0xDD, 0xDD, 0xDC, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDE, 0xE0, 
-    0xE1, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xEA, 0xEE, 0xEC, 0xED, 0xED, 0xEE, 
-    0xF1, 0xF6, 0xFA, 0xFB, 0xF8, 0xF8, 0xF7, 0xF5, 0xF2, 0xF1, 0xF1, 0xF2, 
-    0xF2, 0xF0, 0xED, 0xEC, 0xEE, 0xF0, 0xF2, 0xF1, 0xF0, 0xEE, 0xF0, 0xE9, 
-    0xE8, 0xEC, 0xEE, 0xF2, 0xF2, 0xF1, 0xED, 0xEB, 0xE7, 0xE6, 0xE4, 0xE4, 
-    0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xE7, 0xE7, 0xE7, 0xE6, 0xE9, 0xEA, 0xEC, 
-    0xF0, 0xF3, 0xF6, 0xF5, 0xFD, 0x03, 0x01, 0x01, 0xFF, 0xFD, 0xFA, 0xF7, 
-    0xF4, 0xF2, 0xF1, 0xF1, 0xF2, 0xF5, 0xF8, 0xF9, 0xFF, 0x05, 0x0A, 0x06, 
-    0x03, 0xFF, 0xFC, 0xF8, 0xF5, 0xF9, 0xFC, 0xFE, 0x02, 0xFE, 0xFB, 0xFC, 
-    0xFB, 0xFB, 0xF9, 0xF7, 0xF4, 0xF2, 0xF0, 0xF0, 0xF0, 0xF5, 0xF8, 0xFF, 
-    0x08, 0x07, 0x07, 0x06, 0x03, 0x00, 0xFF, 0xF6, 0xF5, 0xF6, 0xF8, 0xFA, 
-    0xFC, 0xFA, 0xF9, 0xF7, 0xF6, 0xF5, 0xF4, 0xF6, 0xFB, 0x01, 0x04, 0x03, 
-    0x01, 0xFF, 0xFF, 0xFC, 0xFF, 0x06, 0x05, 0x06, 0x07, 0x0E, 0x15, 0x19, 
-    0x0C, 0x06, 0x03, 0xFE, 0xF9, 0xF6, 0xFC, 0xFC, 0x03, 0x09, 0x12, 0x16, 
-    0x14, 0x13, 0x0D, 0x09, 0x00, 0xF9, 0xFA, 0x02, 0x0C, 0x17, 0x27, 0x2C, 
-    0x30, 0x32, 0x31, 0x31, 0x30, 0x27, 0x22, 0x1F, 0x14, 0x0D, 0x02, 0xF8, 
-    0xEC, 0xE6, 0xEB, 0xEA, 0xF2, 0xFD, 0xFF, 0x0F, 0x15, 0x1B, 0x20, 0x1A, 
-    0x10, 0x00, 0xFC, 0xFF, 0x01, 0x04, 0x10, 0x1C, 0x25, 0x28, 0x1E, 0x1D, 
-    0x1D, 0x1B, 0x1A, 0x19, 0x18, 0x1E, 0x24, 0x22, 0x23, 0x21, 0x21, 0x20, 
-    0x1F, 0x21, 0x25, 0x29, 0x29, 0x29, 0x29, 0x22, 0x12, 0x0B, 0x09, 0x09, 
-    0x0D, 0x0F, 0x16, 0x18, 0x1A, 0x1D, 0x1B, 0x1A, 0x1A, 0x19, 0x20, 0x25, 
-    0x22, 0x20, 0x1F, 0x21, 0x22, 0x23, 0x22, 0x22, 0x21, 0x22, 0x23, 0x26, 
-    0x1E, 0x0D, 0x02, 0xFB, 0xF3, 0xF0, 0xF3, 0xFF, 0x0C, 0x13, 0x14, 0x12, 
-    0x10, 0x10, 0x0D, 0x12, 0x14, 0x0B, 0x06, 0xFF, 0xFC, 0xF4, 0xF5, 0xFC, 
-    0x00, 0x03, 0x07, 0x0E, 0x13, 0x0E, 0xFC, 0xF4, 0xF0, 0xEE, 0xED, 0xF0, 
-    0xF3, 0xF7, 0xFA, 0xFA, 0xFA, 0xF8, 0xF5, 0xEA, 0xEA, 0xEA, 0xE8, 0xE8, 
-    0xEA, 0xF1, 0xF6, 0xF9, 0xF4, 0xF5, 0xF1, 0xED, 0xEC, 0xE6, 0xE9, 0xEC, 
-    0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xE7, 0xE6, 0xEA, 0xED, 0xEF, 0xF0, 
-    0xEF, 0xF7, 0xFD, 0xFC, 0xFC, 0xF9, 0xF2, 0xEE, 0xEB, 0xEA, 0xF0, 0xF2, 
-    0xF0, 0xF0, 0xEF, 0xF1, 0xFA, 0xFD, 0xFC, 0xFC, 0xFA, 0xF7, 0xF3, 0xE8, 
-    0xE3, 0xE2, 0xE2, 0xE3, 0xE5, 0xE4, 0xEB, 0xF5, 0xF7, 0xFA, 0xFA, 0xF6, 
-    0xF5, 0xF2, 0xEB, 0xEE, 0xEC, 0xE7, 0xE3, 0xE5, 0xEB, 0xF4, 0xFD, 0xFB, 
-    0xFD, 0xFB, 0xFB, 0xFA, 0xF5, 0xF9, 0x08, 0x13, 0x11, 0x0E, 0x02, 0x02, 
-    0x06, 0xFD, 0xF7, 0xF7, 0xFA, 0xFE, 0xF9, 0xEF, 0xED, 0xF4, 0x01, 0x0E, 
-    0x13, 0x13, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x21, 0x1B, 0x18, 0x1B, 
-    0x1B, 0x1E, 0x1E, 0x1F, 0x1C, 0x17, 0x14, 0x13, 0x0C, 0x0A, 0x07, 0x0C, 
-    0x1B, 0x1F, 0x23, 0x24, 0x25, 0x25, 0x22, 0x21, 0x1E, 0x1C, 0x1B, 0x18, 
-    0x1A, 0x1C, 0x1E, 0x1F, 0x20, 0x21, 0x21, 0x22, 0x22, 0x23, 0x24, 0x25, 
-    0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x26, 0x27, 0x28, 0x28, 0x29, 
-    0x2A, 0x2A, 0x29, 0x29, 0x28, 0x27, 0x24, 0x22, 0x21, 0x21, 0x20, 0x20, 
-    0x1F, 0x20, 0x21, 0x23, 0x25, 0x26, 0x27, 0x27, 0x28, 0x28, 0x28, 0x27, 
-    0x26, 0x25, 0x24, 0x23, 0x23, 0x23, 0x24, 0x24, 0x24, 0x24, 0x23, 0x23, 
-    0x23, 0x23, 0x23, 0x22, 0x21, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x20, 
-    0x20, 0x1F, 0x1F, 0x1E, 0x1D, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x16, 0x14, 
-    0x14, 0x13, 0x13, 0x13, 0x11, 0x18, 0x1C, 0x1A, 0x1A, 0x18, 0x17, 0x17, 
-    0x13, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 
-    0x0E, 0x0E, 0x0F, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x09, 0x08, 0x08, 0x08, 
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x00, 0xFE, 0xFE, 0xFD, 0xFE, 0xFE, 
-    0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xFC, 0xFD, 0x00, 0x01, 0x03, 0x03, 0x04, 
-    0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0xFE, 0xFC, 0xFC, 0xFA, 
-    0xFB, 0xFE, 0x01, 0x03, 0x04, 0x05, 0x05, 0x03, 0x00, 0xFF, 0xFD, 0xFA, 
-    0xF6, 0xF5, 0xF5, 0xF6, 0xF7, 0xF9, 0xFB, 0xFC, 0xFD, 0xFC, 0xFB, 0xF7, 
-    0xF5, 0xF3, 0xED, 0xF2, 0xF9, 0xF8, 0xF7, 0xF6, 0xF6, 0xF8, 0xFA, 0xFC, 
-    0xFB, 0xFC, 0xFC, 0xFB, 0xFA, 0xF9, 0xF9, 0xF8, 0xF8, 0xF9, 0xFC, 0xFD, 
-    0x00, 0xFB, 0xF6, 0xF8, 0xF6, 0xF5, 0xF4, 0xF3, 0xF3, 0xF2, 0xF3, 0xF4, 
-    0xF6, 0xF6, 0xF5, 0xF4, 0xF2, 0xEE, 0xEA, 0xE9, 0xEB, 0xED, 0xEE, 0xF0, 
-    0xF3, 0xF4, 0xF6, 0xF8, 0xF9, 0xF9, 0xF6, 0xF2, 0xF0, 0xF1, 0xF2, 0xF2, 
-    0xF0, 0xEF, 0xEE, 0xEE, 0xF2, 0xF4, 0xF6, 0xF4, 0xF3, 0xF3, 0xF4, 0xF4, 
-    0xF5, 0xF5, 0xF6, 0xF5, 0xF4, 0xF2, 0xEF, 0xED, 0xEC, 0xEA, 0xE8, 0xE6, 
-    0xE4, 0xE3, 0xE5, 0xE7, 0xE9, 0xE9, 0xEB, 0xEE, 0xEF, 0xF9, 0x01, 0x0A, 
-    0x0D, 0x16, 0x14, 0x09, 0xFF, 0xF8, 0xF4, 0xEF, 0xEE, 0xFA, 0x02, 0x02, 
-    0x0A, 0x15, 0x1E, 0x1E, 0x13, 0x03, 0xFE, 0xF5, 0xF1, 0xED, 0xEF, 0xF2, 
-    0xF3, 0xF4, 0xF5, 0xF5, 0xF6, 0xF5, 0xF6, 0xFB, 0xF6, 0xED, 0xEE, 0xFB, 
-    0x02, 0x0E, 0x0E, 0x14, 0x18, 0x15, 0x16, 0x10, 0x0A, 0xFF, 0xF7, 0xF3, 
-    0xF3, 0xF4, 0xF4, 0xF2, 0xF0, 0xF2, 0xF6, 0xFE, 0x04, 0x05, 0x0C, 0x12, 
-    0x13, 0x09, 0x03, 0xFA, 0xF3, 0xE8, 0xE5, 0xE7, 0xE6, 0xE9, 0xEB, 0xEF, 
-    0xEF, 0xF3, 0xF8, 0xFD, 0x00, 0x04, 0x06, 0x06, 0x04, 0x03, 0x04, 0x08, 
-    0x0A, 0x0B, 0x02, 0xFE, 0xFA, 0xF2, 0xEF, 0xE8, 0xE6, 0xE5, 0xE3, 0xE5, 
-    0xE9, 0xED, 0xEE, 0xEB, 0xE9, 0xEA, 0xEC, 0xEC, 0xEF, 0xEF, 0xF2, 0xF2, 
-    0xF0, 0xEC, 0xEA, 0xF1, 0xF0, 0xF1, 0xF3, 0xF8, 0x00, 0x03, 0x05, 0x09, 
-    0x0D, 0x08, 0xFF, 0xF3, 0xF2, 0xEF, 0xEB, 0xED, 0xEB, 0xEB, 0xEA, 0xEA, 
-    0xED, 0xF5, 0xF3, 0xF3, 0xF1, 0xF3, 0xF4, 0xF6, 0xF9, 0xFB, 0xFF, 0x04, 
-    0x0F, 0x16, 0x1B, 0x0F, 0x0A, 0x0A, 0x05, 0x04, 0x00, 0x00, 0x01, 0x01, 
-    0x02, 0x02, 0x03, 0x03, 0x04, 0x03, 0x05, 0x05, 0x07, 0x09, 0x07, 0x06, 
-    0x04, 0x03, 0x02, 0x01, 0x02, 0x04, 0x06, 0x07, 0x09, 0x09, 0x0A, 0x09, 
-    0x09, 0x08, 0x08, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x08, 0x0A, 
-    0x0C, 0x0E, 0x0D, 0x0A, 0x06, 0x03, 0x01, 0x00, 0x00, 0xFE, 0xFC, 0xFA, 
-    0xF9, 0xF6, 0xF7, 0xF7, 0xFC, 0xFC, 0xFF, 0xFF, 0x04, 0x0A, 0x05, 0x03, 
-    0x00, 0xFF, 0x00, 0xFD, 0xF6, 0xFA, 0xFB, 0x00, 0x01, 0x03, 0x07, 0x0B, 
-    0x08, 0x02, 0x00, 0xFC, 0xFB, 0xFA, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFB, 
-    0xFE, 0xF9, 0xF3, 0xF6, 0xF8, 0xF9, 0xFC, 0xFB, 0x00, 0x07, 0x03, 0x00, 
-    0x00, 0xFF, 0xFF, 0xFE, 0xF5, 0xF3, 0xF5, 0xF6, 0xFA, 0xFB, 0xFA, 0xF8, 
-    0xF7, 0xF5, 0xF5, 0xF4, 0xF4, 0xF4, 0xF4, 0xF2, 0xEF, 0xEC, 0xE9, 0xEA, 
-    0xED, 0xEE, 0xEF, 0xED, 0xED, 0xEB, 0xEB, 0xEA, 0xE9, 0xEA, 0xE9, 0xEA, 
-    0xED, 0xEE, 0xF0, 0xF3, 0xF4, 0xF4, 0xF2, 0xEE, 0xEB, 0xEA, 0xE9, 0xEA, 
-    0xE9, 0xEA, 0xEB, 0xEC, 0xEC, 0xEC, 0xED, 0xEC, 0xEB, 0xEB, 0xEC, 0xF0, 
-    0xF3, 0xF4, 0xFD, 0xFF, 0xFE, 0xFD, 0xFA, 0xF8, 0xF5, 0xF1, 0xEF, 0xF1, 
-    0xF3, 0xF6, 0xF8, 0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0xFD, 0xFC, 0xFD, 0xFB, 
-    0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF2, 0xF9, 0xFB, 0xF9, 0xFB, 0xFA, 
-    0xFB, 0xFE, 0x00, 0x02, 0x05, 0x09, 0x0B, 0x0B, 0x0A, 0x0A, 0x0B, 0x0C, 
-    0x0D, 0x0E, 0x0D, 0x0E, 0x0D, 0x05, 0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 
-    0x04, 0x03, 0x02, 0x02, 0x00, 0x01, 0x03, 0x07, 0x08, 0x07, 0x06, 0x05, 
-    0x04, 0x04, 0x04, 0x04, 0x06, 0x07, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x09, 
-    0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x08, 0x08, 
-    0x08, 0x08, 0x07, 0x08, 0x07, 0x07, 0x06, 0x0A, 0x12, 0x10, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x07, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06, 
-    0x06, 0x06, 0x06, 0x05, 0x01, 0x06, 0x0B, 0x0B, 0x0C, 0x0D, 0x0F, 0x11, 
-    0x11, 0x10, 0x0F, 0x0D, 0x0D, 0x0C, 0x0C, 0x0B, 0x02, 0x02, 0x03, 0x03, 
-    0x03, 0x03, 0x04, 0x03, 0x04, 0x02, 0x02, 0xFF, 0xFD, 0xF6, 0xFA, 0xFC, 
-    0xFB, 0xF8, 0xF9, 0xFF, 0x04, 0x05, 0xFE, 0x01, 0x01, 0x01, 0x01, 0x00, 
-    0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFA, 0xF8, 0xF6, 0xF4, 0xF2, 
-    0xF1, 0xF0, 0xF0, 0xEF, 0xF3, 0xF7, 0xFA, 0xF9, 0xF6, 0xF3, 0xF1, 0xF2, 
-    0xF1, 0xF3, 0xF5, 0xF7, 0xF9, 0xFB, 0xFD, 0xFC, 0xF8, 0xF6, 0xF4, 0xEF, 
-    0xE5, 0xE6, 0xE7, 0xE8, 0xEF, 0xF3, 0xFC, 0x02, 0x09, 0x09, 0x08, 0x07, 
-    0x00, 0xFE, 0xFA, 0xF2, 0xEA, 0xE8, 0xE8, 0xE6, 0xE7, 0xE7, 0xEB, 0xF4, 
-    0xF9, 0xFA, 0xFD, 0xFF, 0xFF, 0x01, 0xFC, 0xF8, 0xFA, 0xF9, 0xFA, 0xFC, 
-    0xFB, 0x01, 0x05, 0x02, 0xFF, 0xFD, 0xF7, 0xF6, 0xF1, 0xE2, 0xDB, 0xDC, 
-    0xE3, 0xE8, 0xEB, 0xEA, 0xF4, 0xF2, 0xED, 0xE8, 0xE6, 0xE7, 0xE6, 0xE8, 
-    0xE9, 0xEC, 0xEF, 0xF6, 0xFB, 0x03, 0x00, 0xF8, 0xF5, 0xF1, 0xE9, 0xE2, 
-    0xDD, 0xE2, 0xE3, 0xE4, 0xE8, 0xEA, 0xEE, 0xEC, 0xE7, 0xE1, 0xE1, 0xE5, 
-    0xE7, 0xE9, 0xEA, 0xEC, 0xE9, 0xE8, 0xE6, 0xE2, 0xE2, 0xE1, 0xE3, 0xE4, 
-    0xE9, 0xEB, 0xED, 0xEC, 0xED, 0xEB, 0xED, 0xF3, 0xF2, 0xF0, 0xED, 0xE9, 
-    0xEA, 0xEE, 0xE9, 0xEA, 0xEC, 0xEE, 0xEE, 0xEE, 0xED, 0xF4, 0xF9, 0xF7, 
-    0xF9, 0xF7, 0xF7, 0xF6, 0xF6, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 
-    0xF7, 0xF6, 0xF6, 0xF6, 0xF7, 0xF7, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF4, 0xF3, 0xF3, 0xF2, 0xF3, 
-    0xF2, 0xF4, 0xF3, 0xF5, 0xF3, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEB, 
-    0xF4, 0xF6, 0xF5, 0xF5, 0xF5, 0xF5, 0xF6, 0xEF, 0xE9, 0xEB, 0xEA, 0xEB, 
-    0xEA, 0xEB, 0xEA, 0xEC, 0xED, 0xED, 0xEC, 0xEB, 0xEB, 0xEA, 0xEA, 0xEA, 
-    0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEB, 0xEC, 0xEB, 0xEB, 0xEA, 0xEB, 0xE9, 
-    0xF0, 0xF5, 0xF4, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 
-    0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xEE, 0xEB, 
-    0xED, 0xEC, 0xEC, 0xEB, 0xEC, 0xEC, 0xED, 0xED, 0xEE, 0xEF, 0xF1, 0xF1, 
-    0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0, 
-    0xEF, 0xEE, 0xED, 0xED, 0xEE, 0xED, 0xEF, 0xEF, 0xF2, 0xF1, 0xF8, 0xFF, 
-    0xFE, 0xFE, 0xFC, 0xFC, 0xFB, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xFC, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xF7, 0xF4, 0xF5, 0xF4, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF3, 0xF1, 0xEF, 0xF0, 0xF1, 0xF4, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 
-    0xFC, 0xF5, 0xF0, 0xF2, 0xF0, 0xEF, 0xEE, 0xEE, 0xEF, 0xF2, 0xF2, 0xF2, 
-    0xEE, 0xEE, 0xED, 0xF2, 0xFA, 0xFA, 0xF9, 0xF8, 0xF9, 0xFA, 0xFA, 0xF3, 
-    0xF3, 0xF5, 0xF5, 0xF5, 0xF4, 0xF4, 0xF2, 0xF2, 0xF2, 0xF4, 0xF8, 0xF9, 
-    0xFA, 0xF8, 0xF5, 0xF4, 0xF2, 0xF2, 0xF1, 0xF1, 0xEF, 0xEE, 0xED, 0xED, 
-    0xEC, 0xEE, 0xEF, 0xF0, 0xFA, 0xFC, 0xFD, 0xFD, 0xFB, 0xF7, 0xF8, 0xF4, 
-    0xF4, 0xF9, 0xF9, 0xFA, 0xF8, 0xF6, 0xF2, 0xF2, 0xF0, 0xF0, 0xEF, 0xF0, 
-    0xF1, 0xF4, 0xFF, 0x01, 0x03, 0x06, 0x02, 0xFF, 0xFD, 0xF7, 0xF6, 0xF9, 
-    0xFB, 0xFC, 0xFE, 0xFD, 0xF8, 0xF4, 0xF1, 0xF1, 0xF1, 0xF3, 0xF4, 0xFA, 
-    0x04, 0x03, 0x06, 0x07, 0x07, 0x04, 0x01, 0xFF, 0xFE, 0xFC, 0xFC, 0x02, 
-    0x07, 0x0C, 0x03, 0x01, 0x02, 0x00, 0xFE, 0xFC, 0xF9, 0xFE, 0x01, 0xFF, 
-    0x03, 0x06, 0x09, 0x09, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0A, 0x08, 
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFA, 0xFA, 
-    0xF8, 0xF8, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0x00, 0xFF, 0x03, 0x0A, 0x07, 
-    0x07, 0x05, 0x05, 0x04, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0A, 0x09, 0x0A, 
-    0x01, 0xFE, 0xFE, 0xFC, 0xFB, 0xFB, 0xFA, 0x01, 0x07, 0x06, 0x07, 0x06, 
-    0x08, 0x07, 0x08, 0x07, 0x08, 0x06, 0x07, 0x06, 0x07, 0x06, 0xFD, 0xFD, 
-    0xFE, 0xFD, 0xFD, 0xFD, 0xFC, 0x04, 0x07, 0x06, 0x06, 0x06, 0x05, 0x06, 
-    0x00, 0xFA, 0xFB, 0xFB, 0xFB, 0xFB, 0xFA, 0xFD, 0x06, 0x05, 0x06, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x03, 0x00, 0x00, 0xF8, 0xF5, 
-    0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xFD, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 
-    0xFD, 0xF3, 0xF5, 0xF3, 0xF4, 0xF3, 0xF4, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 
-    0xF7, 0xF7, 0xF5, 0xFD, 0xFF, 0xFC, 0xFB, 0xF9, 0xF8, 0xFB, 0xF6, 0xF1, 
-    0xF5, 0xF4, 0xF5, 0xF4, 0xF2, 0xF2, 0xF9, 0xF6, 0xF4, 0xF5, 0xF6, 0xF7, 
-    0xF8, 0xF9, 0xFA, 0xFB, 0xFB, 0xFB, 0xFA, 0xFC, 0xF4, 0xF0, 0xF0, 0xEF, 
-    0xEE, 0xEF, 0xEE, 0xF3, 0xFB, 0xFA, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xFC, 
-    0xFC, 0xFB, 0xFC, 0xFB, 0xFC, 0xFB, 0xFB, 0xFA, 0xFA, 0xFA, 0xF9, 0xFA, 
-    0xF9, 0xFA, 0xF9, 0xFA, 0xF9, 0xFA, 0xF9, 0xFB, 0xF6, 0xEF, 0xF0, 0xEF, 
-    0xEF, 0xF0, 0xEF, 0xF2, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 
-    0xFD, 0xF8, 0xF2, 0xF2, 0xF1, 0xF0, 0xF1, 0xF0, 0xF2, 0xFB, 0xFB, 0xFC, 
-    0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC, 0xFB, 0xFC, 0xFB, 0xFC, 0xFC, 
-    0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xF8, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 
-    0xF1, 0xF3, 0xFC, 0xFB, 0xFB, 0xFC, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFD, 0xFD, 0xFC, 0xFD, 0xF6, 0xF1, 0xF3, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 
-    0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF6, 0xF5, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xFD, 
-    0xFC, 0xFD, 0xFC, 0xFF, 0xFB, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xFC, 0xFE, 0xFD, 0xFF, 0xFE, 
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFE, 0x00, 0xFC, 0xF4, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 
-    0xFD, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-    0xFE, 0x00, 0xFC, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xFE, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0xF6, 0xF4, 0xF5, 0xF4, 0xF5, 
-    0xF4, 0xF5, 0xF4, 0xF6, 0xF4, 0xF6, 0xF4, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0xFF, 0xFE, 0xF6, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xFC, 0x00, 
-    0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0xFA, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 
-    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xF6, 0xF4, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF4, 0xFC, 0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0xFA, 0xF4, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-    0xFE, 0xF6, 0xF4, 0xF5, 0xF4, 0xF5, 0xF5, 0xF4, 0xFB, 0x00, 0xFE, 0xFF, 
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF4, 0xFB, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0xF5, 
-    0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF5, 0xF4, 0xF8, 
-    0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xF7, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF5, 0xF4, 
-    0xF6, 0xF4, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xF5, 0xF4, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xFC, 0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 
-    0xFA, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0xF6, 0xF4, 0xF5, 0xF4, 0xF5, 0xF4, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xFC, 0x00, 0xFE, 0xFF, 
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFE, 0xF4, 0xFB, 0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF7, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF8, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xFC, 0xFF, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFC, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 
-    0xF7, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF7, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF6, 0xF5, 0xFB, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFB, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xFA, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFA, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xF8, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 
-    0xF9, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF9, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF7, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF8, 0xFF, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xF7, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xFC, 
-    0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFA, 0xF5, 0xF6, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF8, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF6, 0xF5, 0xFC, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFA, 
-    0xF5, 0xF6, 0xF5, 0xF5, 0xF6, 0xF5, 0xF8, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF7, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xFF, 0xFD, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xFB, 0xFF, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFB, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF5, 0xFA, 0xFE, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFE, 0xFB, 0xF6, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 
-    0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFA, 0xF6, 0xF7, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 
-    0xFD, 0xFE, 0xFD, 0xFE, 0xFA, 0xF5, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xF7, 0xF5, 0xFA, 0xFE, 0xFD, 
-    0xFD, 0xFE, 0xFD, 0xFE, 0xFC, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xFC, 0xFE, 0xFD, 0xFE, 0xFD, 0xFD, 0xFE, 0xF9, 0xF5, 0xF7, 0xF6, 0xF7, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xF7, 0xF5, 0xF9, 0xFE, 0xFD, 0xFD, 0xFE, 
-    0xFD, 0xFE, 0xFC, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xFC, 0xFE, 
-    0xFD, 0xFE, 0xFD, 0xFD, 0xFE, 0xF9, 0xF5, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xFC, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 
-    0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xF8, 0xF6, 0xF7, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xFC, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xF8, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 
-    0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF5, 0xF8, 0xFE, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFE, 0xFD, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xF7, 
-    0xF6, 0xF8, 0xFE, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xF7, 0xF6, 0xF7, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF8, 0xFE, 0xFD, 0xFD, 0xFE, 0xFD, 
-    0xFE, 0xFD, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF8, 
-    0xFE, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xFB, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 
-    0xFD, 0xFE, 0xFD, 0xFE, 0xFC, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xFB, 0xFE, 0xFD, 0xFE, 0xFD, 
-    0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFC, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 
-    0xFB, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 
-    0xFD, 0xFE, 0xFD, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF7, 0xF5, 0xFB, 0xFE, 0xFD, 0xFE, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFE, 0xF8, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF5, 0xFA, 0xFE, 
-    0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xFB, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 
-    0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFD, 0xFE, 0xF8, 0xF6, 0xF7, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xFA, 0xFE, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xFB, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFD, 
-    0xFE, 0xF8, 0xF6, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 0xFA, 0xFE, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFE, 0xFB, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xFD, 
-    0xFE, 0xFD, 0xFE, 0xFD, 0xFD, 0xFE, 0xF8, 0xF5, 0xF7, 0xF6, 0xF7, 0xF6, 
-    0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF8, 0xFE, 0xFD, 0xFE, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 
-    0xFD, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xFB, 0xFE, 0xFD, 0xFE, 0xFD, 0xFD, 0xFE, 0xFB, 0xF5, 0xF7, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 
-    0xF9, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xF9, 0xF5, 
-    0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF6, 0xFC, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFE, 0xFA, 0xF5, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF6, 0xF7, 0xF7, 0xF7, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFD, 0xF9, 
-    0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFD, 
-    0xFC, 0xFD, 0xF9, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF9, 0xFD, 0xFC, 
-    0xFD, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xFA, 0xFD, 0xFC, 0xFD, 0xFD, 0xFC, 0xFD, 
-    0xFB, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xF9, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFC, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFC, 
-    0xFD, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFB, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 
-    0xFD, 0xFC, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF6, 0xF9, 0xFD, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF6, 0xFB, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFC, 0xFD, 0xFC, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xFA, 0xFD, 0xFC, 0xFD, 0xFD, 
-    0xFC, 0xFD, 0xFB, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xFD, 
-    0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 
-    0xFB, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFC, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xFA, 0xFD, 
-    0xFC, 0xFD, 0xFD, 0xFC, 0xFD, 0xFB, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 
-    0xFD, 0xFC, 0xFD, 0xFA, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF6, 0xF8, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 
-    0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 
-    0xFD, 0xFC, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFC, 0xFD, 0xFC, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xF9, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xFB, 0xFD, 0xFC, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xFA, 0xFD, 0xFC, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF8, 0xF6, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 
-    0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF9, 0xF6, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xF8, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xF9, 0xFD, 0xFC, 0xFD, 
-    0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 
-    0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xF9, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF8, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xF7, 0xF7, 0xFA, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 
-    0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF7, 0xF7, 0xFC, 0xFD, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF9, 0xF7, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF7, 0xF9, 0xFD, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF7, 0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xF7, 0xF8, 
-    0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 
-    0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF7, 0xF9, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF9, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 
-    0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 
-    0xF9, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFA, 0xF7, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF9, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xF9, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFA, 
-    0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xF8, 0xF7, 0xF8, 0xF7, 0xF8, 0xF7, 0xF8, 0xF7, 0xF8, 0xF7, 
-    0xF8, 0xF7, 0xF8, 0xF7, 0xF9, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF9, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF7, 0xF9, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF7, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xFB, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xF7, 0xF9, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 
-    0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xF7, 0xF8, 0xF7, 0xF9, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFA, 0xF7, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF7, 0xF9, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFB, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF7, 0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 
-    0xFC, 0xFC, 0xFA, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF9, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF9, 0xF8, 
-    0xFA, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xFA, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xF9, 0xF8, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF9, 0xF8, 0xFA, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFA, 0xF8, 0xF9, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFC, 0xFA, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFA, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF9, 0xF8, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xF9, 0xF8, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF9, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF9, 0xF8, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF9, 0xF8, 0xFA, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xFA, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFC, 0xFA, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF9, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xFA, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFA, 0xF8, 0xF9, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xFA, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFC, 0xFA, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF9, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xFA, 
-    0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFA, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFA, 0xF8, 0xF9, 
-    0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF8, 
-    0xF9, 0xF8, 0xF8, 0xF9, 0xF8, 0xFA, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xFA, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFA, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF9, 0xFC, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
-    0xFC, 0xFA, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 
-    0xFA, 0xFA, 0xFA
-};
-
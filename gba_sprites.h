@@ -1,468 +1,10 @@
 /* gba_sprites.h
- * generated by png2gba program */
+ * generated by tools/assets.py from gba_sprites.png, the data is in the asset pack */
 
 #define gba_sprites_width 16
 #define gba_sprites_height 320
+#define gba_sprites_data_bytes 5120
+#define gba_sprites_palette_bytes 512
 
-const unsigned char gba_sprites_data [] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x07, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-    0x06, 0x0C, 0x0D, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x06, 0x05, 0x06, 0x05, 
-    0x00, 0x00, 0x00, 0x06, 0x0F, 0x0F, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x12, 0x13, 0x08, 0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0x06, 0x0E, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x06, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 
-    0x0D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x15, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x16, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x06, 0x18, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x0F, 0x06, 0x0C, 0x19, 0x1A, 0x1B, 0x00, 
-    0x06, 0x1A, 0x1C, 0x04, 0x07, 0x1A, 0x11, 0x1A, 0x05, 0x1D, 0x1E, 0x1F, 
-    0x1E, 0x10, 0x20, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x06, 0x05, 
-    0x00, 0x00, 0x00, 0x00, 0x23, 0x0E, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x23, 0x17, 0x25, 0x26, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0E, 0x27, 0x24, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x0D, 0x16, 0x29, 0x00, 0x00, 0x00, 0x00, 
-    0x28, 0x28, 0x19, 0x06, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x24, 0x00, 
-    0x00, 0x00, 0x00, 0x28, 0x28, 0x0D, 0x25, 0x00, 0x28, 0x11, 0x11, 0x1B, 
-    0x2A, 0x2B, 0x14, 0x1A, 0x05, 0x2B, 0x2B, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 
-    0x06, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x28, 0x28, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x25, 0x0D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x24, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x12, 0x29, 0x19, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x07, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x2F, 0x07, 0x0E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2F, 
-    0x19, 0x2D, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x17, 0x2E, 0x00, 0x00, 
-    0x00, 0x00, 0x28, 0x07, 0x09, 0x28, 0x00, 0x00, 0x00, 0x00, 0x21, 0x2D, 
-    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x09, 0x2E, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x24, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x31, 
-    0x23, 0x28, 0x00, 0x00, 0x21, 0x28, 0x22, 0x05, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x19, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x07, 0x28, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x05, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x28, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0x15, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x28, 0x15, 0x23, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x33, 0x0D, 
-    0x00, 0x00, 0x00, 0x00, 0x34, 0x28, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x22, 0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x2B, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x35, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x12, 0x10, 0x36, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2C, 0x17, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x12, 0x2C, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x17, 0x28, 0x02, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x37, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x17, 0x0F, 0x2C, 0x23, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2B, 0x11, 0x28, 
-    0x28, 0x34, 0x1A, 0x00, 0x06, 0x11, 0x38, 0x10, 0x39, 0x20, 0x1F, 0x1A, 
-    0x28, 0x10, 0x3A, 0x11, 0x1F, 0x1A, 0x1A, 0x1A, 0x0A, 0x34, 0x14, 0x12, 
-    0x14, 0x2B, 0x12, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x28, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x06, 0x06, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x05, 0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 
-    0x19, 0x07, 0x3C, 0x21, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x04, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x07, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x22, 0x3E, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x35, 0x19, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-    0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x22, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x06, 
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x05, 0x05, 0x2F, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x21, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x35, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0D, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x3C, 0x05, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x28, 0x0D, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x04, 0x07, 0x3C, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x06, 0x33, 0x09, 0x00, 0x00, 0x00, 0x00, 0x34, 0x28, 0x0E, 0x17, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x22, 0x06, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x1A, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x12, 0x11, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2C, 0x17, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x19, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x06, 0x24, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x06, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0x06, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x06, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x2C, 0x0C, 0x3E, 0x00, 0x00, 0x00, 
-    0x05, 0x2B, 0x1F, 0x07, 0x28, 0x1A, 0x1B, 0x00, 0x06, 0x11, 0x41, 0x10, 
-    0x1C, 0x1F, 0x1F, 0x1A, 0x28, 0x11, 0x1F, 0x2A, 0x11, 0x1B, 0x1B, 0x1A, 
-    0x2E, 0x10, 0x14, 0x0F, 0x12, 0x0F, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x32, 0x0E, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x42, 0x19, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3B, 0x19, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x0D, 0x0E, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0E, 0x05, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x35, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x06, 0x21, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x19, 0x07, 0x22, 0x00, 
-    0x34, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x2F, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x24, 0x2D, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x06, 0x07, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x04, 0x19, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x07, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0E, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x17, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x07, 
-    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x19, 0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2F, 0x28, 0x0D, 
-    0x2F, 0x00, 0x00, 0x28, 0x00, 0x00, 0x2C, 0x05, 0x06, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x07, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x22, 0x2F, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x06, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x2C, 0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x19, 0x08, 
-    0x00, 0x00, 0x00, 0x06, 0x06, 0x05, 0x28, 0x0C, 0x00, 0x00, 0x00, 0x06, 
-    0x34, 0x06, 0x06, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x0B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x35, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
-    0x06, 0x12, 0x2B, 0x36, 0x00, 0x00, 0x43, 0x44, 0x43, 0x12, 0x2B, 0x17, 
-    0x00, 0x00, 0x43, 0x43, 0x00, 0x12, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x34, 0x29, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x29, 0x06, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x0E, 0x0E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x06, 
-    0x39, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x22, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x17, 0x06, 0x2C, 0x40, 0x35, 0x00, 0x00, 0x00, 
-    0x28, 0x34, 0x11, 0x07, 0x28, 0x34, 0x1A, 0x00, 0x06, 0x1A, 0x1E, 0x10, 
-    0x39, 0x10, 0x20, 0x1A, 0x28, 0x13, 0x3A, 0x11, 0x1D, 0x11, 0x11, 0x1A, 
-    0x22, 0x34, 0x1B, 0x2B, 0x45, 0x12, 0x12, 0x00, 0x0F, 0x04, 0x04, 0x2F, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x22, 0x05, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x06, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-    0x3C, 0x05, 0x2C, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x28, 0x06, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x05, 0x07, 0x21, 0x2C, 0x0E, 0x09, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x35, 0x0D, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x28, 0x0C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0D, 0x28, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x31, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x46, 0x47, 0x00, 0x47, 0x00, 0x00, 0x00, 0x48, 0x3E, 0x42, 0x49, 0x49, 
-    0x00, 0x00, 0x00, 0x00, 0x46, 0x0E, 0x4A, 0x4B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x4C, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x4A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x48, 0x31, 0x37, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x37, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x4D, 0x11, 0x11, 0x00, 0x4E, 0x13, 0x13, 0x13, 0x4F, 0x1D, 0x50, 0x1A, 
-    0x10, 0x10, 0x1A, 0x39, 0x50, 0x1C, 0x1F, 0x1B, 0x51, 0x39, 0x13, 0x51, 
-    0x00, 0x20, 0x52, 0x10, 0x3A, 0x10, 0x11, 0x53, 0x00, 0x54, 0x54, 0x1F, 
-    0x50, 0x55, 0x56, 0x57, 0x1A, 0x58, 0x52, 0x4F, 0x55, 0x59, 0x55, 0x56, 
-    0x13, 0x5A, 0x5B, 0x2A, 0x5C, 0x5D, 0x5D, 0x5E, 0x4D, 0x5F, 0x36, 0x11, 
-    0x3A, 0x49, 0x60, 0x50, 0x00, 0x4E, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x1A, 0x11, 0x11, 0x11, 0x4E, 0x00, 0x00, 0x00, 0x1A, 0x1D, 0x1E, 0x3A, 
-    0x61, 0x00, 0x00, 0x00, 0x1A, 0x3A, 0x62, 0x5E, 0x4E, 0x00, 0x00, 0x00, 
-    0x11, 0x50, 0x56, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x11, 0x63, 0x64, 0x63, 
-    0x2E, 0x00, 0x00, 0x00, 0x11, 0x65, 0x66, 0x63, 0x4D, 0x00, 0x00, 0x00, 
-    0x53, 0x25, 0x67, 0x16, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x39, 0x27, 
-    0x1F, 0x68, 0x60, 0x41, 0x00, 0x4E, 0x25, 0x69, 0x6A, 0x62, 0x59, 0x6B, 
-    0x00, 0x00, 0x10, 0x6C, 0x6D, 0x00, 0x61, 0x1F, 0x00, 0x00, 0x13, 0x26, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x27, 0x24, 0x6E, 0x39, 0x00, 0x00, 0x00, 0x00, 0x69, 0x2D, 0x2E, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x10, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x70, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x72, 0x73, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x74, 0x75, 
-    0x00, 0x00, 0x00, 0x00, 0x76, 0x4A, 0x3B, 0x73, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x4A, 0x3B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x3B, 0x73, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x4A, 0x76, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x78, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x79, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 
-    0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x7A, 0x7B, 0x7A, 0x00, 0x00, 
-    0x00, 0x00, 0x7C, 0x7D, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0x4E, 0x68, 0x5C, 
-    0x80, 0x81, 0x64, 0x4E, 0x00, 0x7B, 0x5C, 0x82, 0x83, 0x34, 0x04, 0x39, 
-    0x00, 0x84, 0x84, 0x81, 0x81, 0x3C, 0x16, 0x4E, 0x00, 0x7C, 0x85, 0x7E, 
-    0x83, 0x80, 0x86, 0x87, 0x00, 0x4E, 0x4E, 0x88, 0x80, 0x81, 0x80, 0x87, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x7E, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x4E, 0x89, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x88, 0x81, 0x81, 0x83, 0x87, 
-    0x00, 0x00, 0x84, 0x4D, 0x2E, 0x80, 0x7E, 0x4E, 0x00, 0x00, 0x6E, 0x16, 
-    0x36, 0x4D, 0x81, 0x2E, 0x00, 0x79, 0x16, 0x5F, 0x6E, 0x4D, 0x8A, 0x2E, 
-    0x00, 0x6E, 0x8B, 0x16, 0x00, 0x39, 0x34, 0x16, 0x00, 0x61, 0x82, 0x00, 
-    0x00, 0x16, 0x2E, 0x6E, 0x00, 0x82, 0x83, 0x4E, 0x78, 0x16, 0x16, 0x73, 
-    0x00, 0x7D, 0x83, 0x8C, 0x8D, 0x30, 0x4E, 0x5F, 0x7A, 0x16, 0x89, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0x2E, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x6E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x87, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x85, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x5F, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2E, 0x4E, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x39, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x7C, 0x7E, 0x81, 0x16, 0x30, 0x4D, 0x7E, 0x00, 0x8C, 0x7D, 0x83, 
-    0x3C, 0x3C, 0x87, 0x7D, 0x00, 0x4E, 0x7C, 0x7D, 0x82, 0x7E, 0x7D, 0x7A, 
-    0x00, 0x00, 0x00, 0x4E, 0x7C, 0x7D, 0x84, 0x7E, 0x00, 0x00, 0x00, 0x4E, 
-    0x7C, 0x7E, 0x7E, 0x8A, 0x00, 0x00, 0x00, 0x4E, 0x7D, 0x83, 0x84, 0x80, 
-    0x00, 0x00, 0x4E, 0x7C, 0x83, 0x81, 0x7C, 0x80, 0x00, 0x4E, 0x5C, 0x84, 
-    0x7E, 0x8A, 0x7D, 0x7D, 0x81, 0x13, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x8A, 0x34, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x8A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x7E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x7F, 0x8F, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x82, 0x7E, 0x4E, 0x00, 0x00, 0x00, 0x00, 
-    0x7E, 0x7F, 0x83, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x7D, 0x85, 
-    0x87, 0x4D, 0x7D, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x85, 0x85, 0x87, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x73, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x73, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x73, 0x73, 0x90, 0x08, 0x3B, 0x00, 0x00, 0x00, 0x37, 
-    0x74, 0x17, 0x3B, 0x49, 0x00, 0x00, 0x79, 0x74, 0x42, 0x42, 0x3B, 0x49, 
-    0x00, 0x00, 0x79, 0x74, 0x3B, 0x49, 0x49, 0x3B, 0x00, 0x00, 0x73, 0x42, 
-    0x4A, 0x4B, 0x4B, 0x4A, 0x00, 0x00, 0x90, 0x33, 0x49, 0x4B, 0x4B, 0x49, 
-    0x00, 0x00, 0x00, 0x17, 0x4A, 0x4B, 0x4B, 0x4A, 0x00, 0x00, 0x73, 0x42, 
-    0x69, 0x4A, 0x49, 0x3B, 0x37, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x3B, 0x37, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x08, 0x78, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x42, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x74, 0x37, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x08, 0x78, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x3B, 0x37, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x42, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x74, 
-    0x42, 0x3B, 0x4A, 0x42, 0x00, 0x00, 0x78, 0x17, 0x0E, 0x3B, 0x49, 0x42, 
-    0x00, 0x00, 0x49, 0x79, 0x17, 0x08, 0x37, 0x33, 0x00, 0x00, 0x00, 0x78, 
-    0x77, 0x79, 0x75, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0E, 0x31, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x08, 0x78, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x31, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x79, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x91, 0x1E, 0x00, 
-    0x00, 0x00, 0x00, 0x1E, 0x92, 0x93, 0x92, 0x94, 0x00, 0x00, 0x64, 0x95, 
-    0x5D, 0x26, 0x20, 0x92, 0x00, 0x00, 0x3A, 0x96, 0x49, 0x15, 0x06, 0x97, 
-    0x00, 0x1E, 0x98, 0x99, 0x6E, 0x4C, 0x03, 0x29, 0x00, 0x9A, 0x98, 0x22, 
-    0x23, 0x9B, 0x23, 0x22, 0x00, 0x9A, 0x98, 0x15, 0x3E, 0x03, 0x23, 0x3D, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x98, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x98, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x9A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x92, 0x54, 0x32, 0x05, 0x32, 0x1F, 
-    0x00, 0x00, 0x9A, 0x92, 0x9C, 0x24, 0x99, 0x92, 0x00, 0x00, 0x64, 0x96, 
-    0x5D, 0x60, 0x5D, 0x96, 0x00, 0x00, 0x00, 0x64, 0x64, 0x00, 0x9D, 0x9D, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1E, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const unsigned short gba_sprites_palette [] = {
-    0x7c1f, 0x2010, 0x0098, 0x0010, 0x010c, 0x008c, 0x0088, 0x0110, 0x229c, 
-    0x0218, 0x0094, 0x4304, 0x0118, 0x0194, 0x021c, 0x2004, 0x218c, 0x2188, 
-    0x0000, 0x210c, 0x0104, 0x2094, 0x2194, 0x029c, 0x2014, 0x0198, 0x2108, 
-    0x2104, 0x4210, 0x420c, 0x4290, 0x220c, 0x2208, 0x200c, 0x0090, 0x2118, 
-    0x018c, 0x0210, 0x0188, 0x0214, 0x0114, 0x0108, 0x2184, 0x2084, 0x2008, 
-    0x0190, 0x2110, 0x2090, 0x2198, 0x219c, 0x2114, 0x221c, 0x2088, 0x019c, 
-    0x2214, 0x231c, 0x4294, 0x2190, 0x428c, 0x239c, 0x208c, 0x2098, 0x211c, 
-    0x2218, 0x2018, 0x4314, 0x031c, 0x7ee0, 0x7f98, 0x0100, 0x609c, 0x611c, 
-    0x601c, 0x7bff, 0x439c, 0x7fff, 0x411c, 0x410c, 0x4110, 0x4204, 0x4208, 
-    0x4214, 0x0290, 0x4188, 0x0208, 0x628c, 0x6288, 0x4184, 0x030c, 0x630c, 
-    0x2298, 0x0314, 0x6290, 0x6378, 0x4288, 0x4194, 0x6314, 0x418c, 0x6310, 
-    0x028c, 0x5294, 0x2314, 0x2398, 0x2318, 0x7b34, 0x03ff, 0x2210, 0x2310, 
-    0x0298, 0x020c, 0x4218, 0x0318, 0x4118, 0x0294, 0x0398, 0x421c, 0x039c, 
-    0x419c, 0x619c, 0x431c, 0x629c, 0x429c, 0x6214, 0x620c, 0x6210, 0x6190, 
-    0x610c, 0x6108, 0x608c, 0x4088, 0x4108, 0x6088, 0x618c, 0x6194, 0x4114, 
-    0x6110, 0x6114, 0x4198, 0x4084, 0x4190, 0x6294, 0x4298, 0x4094, 0x408c, 
-    0x621c, 0x238c, 0x2388, 0x4388, 0x4310, 0x438c, 0x4390, 0x2204, 0x2308, 
-    0x228c, 0x430c, 0x209c, 0x230c, 0x6318, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000
-};
-
+extern const unsigned char gba_sprites_data [];
+extern const unsigned short gba_sprites_palette [];
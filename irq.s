@@ -0,0 +1,95 @@
+@irq.s
+
+/* the interrupt handler the BIOS jumps to through 0x3007FFC */
+/* it finds the highest priority interrupt that is both enabled and pending, */
+/* acknowledges it in IF and in the BIOS copy of IF (which IntrWait checks), */
+/* then calls the C function for it from irq_table */
+/* handlers run in system mode so they get the normal stack rather than the */
+/* small IRQ one, and sources in irq_nest_mask may interrupt other handlers */
+
+/* it runs from IWRAM and in ARM mode, since the BIOS calls it that way */
+.section .iwram,"ax",%progbits
+.arm
+.align 2
+
+.global irq_dispatch
+irq_dispatch:
+	mov r0,#0x4000000
+	ldr r1,[r0,#0x200] /* IE in the low half, IF in the high half */
+	and r1,r1,r1,lsr #16 /* r1 = the enabled interrupts which happened */
+
+	/* the lowest bit wins, which is the order the hardware numbers them in */
+	ldr r2,=irq_table
+	mov r3,#1
+.find:
+	tst r1,r3
+	bne .found
+	add r2,r2,#4
+	mov r3,r3,lsl #1
+	cmp r3,#0x4000 /* there are 14 sources */
+	bne .find
+
+	/* not one we know, acknowledge whatever it was and leave */
+	strh r1,[r0,#0x202]
+	mov pc,lr
+
+.found:
+	/* acknowledge it, writing a 1 to IF clears that bit */
+	strh r3,[r0,#0x202]
+	ldr r1,=0x3007FF8
+	ldrh r12,[r1]
+	orr r12,r12,r3
+	strh r12,[r1]
+
+	/* nothing to call if there is no handler */
+	ldr r2,[r2]
+	cmp r2,#0
+	moveq pc,lr
+
+	/* while this handler runs only the other nesting sources may interrupt it */
+	ldrh r12,[r0,#0x200]
+	ldr r1,=irq_nest_mask
+	ldrh r1,[r1]
+	bic r1,r1,r3
+	and r1,r1,r12
+	strh r1,[r0,#0x200]
+
+	/* save what a nested interrupt would overwrite, along with IE before and
+	 * after narrowing it (four registers keeps the stack 8 byte aligned) */
+	mrs r3,spsr
+	stmfd sp!,{r1,r3,r12,lr}
+
+	/* switch to system mode, leaving interrupts off if nothing can nest */
+	mrs r3,cpsr
+	bic r3,r3,#0xDF
+	orr r3,r3,#0x1F
+	cmp r1,#0
+	orreq r3,r3,#0x80
+	msr cpsr_c,r3
+
+	/* call the handler, pushing two registers so a C handler gets the 8 byte
+	 * aligned stack it expects */
+	stmfd sp!,{r3,lr}
+	mov lr,pc
+	bx r2
+	ldmfd sp!,{r3,lr}
+
+	/* back to IRQ mode with interrupts off, then put everything back */
+	mov r3,#0x92
+	msr cpsr_c,r3
+	ldmfd sp!,{r1,r3,r12,lr}
+	mov r0,#0x4000000
+
+	/* IE goes back to how it was, except for bits the handler changed itself
+	 * (like a one shot timer turning itself off), which are kept:
+	 * IE = saved & ~changed | current & changed */
+	ldrh r2,[r0,#0x200]
+	eor r1,r1,r2
+	bic r12,r12,r1
+	and r2,r2,r1
+	orr r12,r12,r2
+	strh r12,[r0,#0x200]
+	msr spsr_cf,r3
+	mov pc,lr
+
+.pool
@@ -0,0 +1,10 @@
+@lz77_uncomp_vram.s
+
+/* a function to decompress LZ77 data with the BIOS LZ77UnCompVram call */
+/* lz77_uncomp_vram(source, dest) */
+/* it writes a halfword at a time, so it works for VRAM (which ignores byte writes) */
+
+.global lz77_uncomp_vram
+lz77_uncomp_vram:
+	swi 0x120000 /* the BIOS takes source and dest in r0-r1 */
+	mov pc,lr
@@ -0,0 +1,10 @@
+@lz77_uncomp_wram.s
+
+/* a function to decompress LZ77 data with the BIOS LZ77UnCompWram call */
+/* lz77_uncomp_wram(source, dest) */
+/* it writes a byte at a time, so dest must be work RAM and not VRAM */
+
+.global lz77_uncomp_wram
+lz77_uncomp_wram:
+	swi 0x110000 /* the BIOS takes source and dest in r0-r1 */
+	mov pc,lr
@@ -1,123 +1,8 @@
-/* created by GBA Tile Editor
-   regular map */
-
-#define map_width 32
-#define map_height 32
-
-const unsigned short map [] = {
-    0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 
-    0x0005, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00a9, 
-    0x00aa, 0x00ab, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00aa, 0x00ab, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00bd, 0x00a0, 0x0005, 0x0005, 0x0086, 
-    0x00f6, 0x00f6, 0x00f6, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00f6, 
-    0x0005, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00c7, 0x00c8, 0x00c9, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 
-    0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00f6, 0x00f6, 0x00f6, 0x00c6, 
-    0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00f6, 0x0005, 0x0005, 0x0005, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 
-    0x00c2, 0x00c3, 0x00f6, 0x00f6, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 
-    0x00f6, 0x0005, 0x00f6, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x00f6, 0x0005, 0x00f6, 0x00f6, 
-    0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x00f6, 0x00f6, 
-    0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x00f6, 0x0005, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0120, 0x0121, 0x0122, 0x0123, 
-    0x0124, 0x00f6, 0x0005, 0x00f6, 0x00f6, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 
-    0x00fd, 0x00fe, 0x00ff, 0x0005, 0x0005, 0x00f6, 0x0002, 0x0002, 0x00f6, 
-    0x00f6, 0x0005, 0x0005, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 0x0005, 0x00f6, 
-    0x00f6, 0x0117, 0x0118, 0x0119, 0x00fc, 0x011b, 0x011c, 0x011d, 0x0005, 
-    0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0005, 0x0163, 
-    0x0164, 0x0165, 0x0166, 0x0167, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x0005, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x0135, 0x0136, 0x0119, 
-    0x011a, 0x0139, 0x013a, 0x013b, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 
-    0x0002, 0x0002, 0x0002, 0x0005, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 0x0005, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 
-    0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x00f6, 
-    0x019f, 0x01a0, 0x01a1, 0x01a2, 0x01a3, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0171, 0x0172, 
-    0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x0002, 0x0002, 0x0002, 0x0002, 
-    0x0002, 0x0002, 0x0002, 0x0002, 0x0005, 0x0005, 0x01be, 0x01bf, 0x01c0, 
-    0x01c1, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x018f, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194, 
-    0x0195, 0x0002, 0x0002, 0x00f6, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 
-    0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x00f6, 0x00f6, 
-    0x00f6, 0x0005, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 0x0005, 0x0005, 
-    0x0005, 0x0005, 0x00f6, 0x00a8, 0x00a9, 0x00aa, 0x0005, 0x0005, 0x0086, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0145, 0x0146, 0x0147, 0x0148, 
-    0x0149, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 
-    0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 
-    0x00c2, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0181, 0x0182, 0x0183, 
-    0x0184, 0x0185, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00ff, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 
-    0x00f6, 0x00f6, 0x019f, 0x01a0, 0x01a1, 0x01a2, 0x01a3, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 
-    0x00fd, 0x00fe, 0x011d, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x00f6, 0x00f6, 0x00f6, 0x01be, 
-    0x01bf, 0x01c0, 0x01c1, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x0117, 0x0118, 0x0119, 0x011a, 0x011b, 0x011c, 0x011d, 0x00f6, 
-    0x0132, 0x0132, 0x0132, 0x0132, 0x0132, 0x0181, 0x0182, 0x0183, 0x0184, 
-    0x0185, 0x017f, 0x017f, 0x017f, 0x017f, 0x017f, 0x017f, 0x017f, 0x017f, 
-    0x017f, 0x017f, 0x017f, 0x017f, 0x017f, 0x0134, 0x0135, 0x0136, 0x0137, 
-    0x0138, 0x0139, 0x013a, 0x013b, 0x013c, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x019f, 0x01a0, 0x01a1, 0x01a2, 0x01a3, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x01be, 0x01bf, 
-    0x01c0, 0x01c1, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0171, 0x0172, 
-    0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x0005, 0x0005, 0x0005, 0x0005, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x018f, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194, 
-    0x0195, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 0x0005, 
-    0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 
-    0x0005, 0x0005, 0x0005, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x0005, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x0086, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00bd, 0x00be, 0x00bf, 0x00c0, 
-    0x00c1, 0x00c2, 0x00c3, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00c6, 
-    0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x0108, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 
-    0x0108, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f9, 0x00fa, 0x00fb, 
-    0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x0127, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x0116, 0x0117, 0x0118, 0x0119, 0x011a, 0x011b, 0x011c, 0x011d, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0145, 0x0146, 
-    0x0147, 0x0148, 0x0149, 0x00f6, 0x00f6, 0x0120, 0x0121, 0x0122, 0x0123, 
-    0x0124, 0x0125, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0134, 0x0135, 0x0136, 
-    0x0137, 0x0138, 0x0139, 0x013a, 0x013b, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 
-    0x0159, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0181, 
-    0x0182, 0x0183, 0x0184, 0x0185, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0170, 0x0171, 
-    0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x019f, 0x01a0, 0x01a1, 0x01a2, 0x01a3, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 
-    0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0191, 0x0192, 0x0193, 
-    0x0194, 0x0195, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x00f6, 0x0005, 
-    0x0005, 0x01be, 0x01bf, 0x01c0, 0x01c1, 0x00f6, 0x00f6, 
-};
-
+/* map.h
+ * generated by tools/assets.py from map.csv, the data is in the asset pack */
+
+#define map_width 32
+#define map_height 32
+#define map_bytes 2048
+
+extern const unsigned short map [];
@@ -1,237 +1,11 @@
-/* created by GBA Tile Editor
-   regular map */
-
-#define map2_width 64
-#define map2_height 32
-
-const unsigned short map2 [] = {
-    0x0d81, 0x0d82, 0x0d82, 0x0d84, 0x0d85, 0x0d86, 0x0d85, 0x0d88, 0x0d89, 
-    0x0d8a, 0x0d8b, 0x0d8c, 0x0d8d, 0x0d8e, 0x0d8f, 0x0d81, 0x0d82, 0x0d83, 
-    0x0d84, 0x0d85, 0x0d86, 0x0d87, 0x0d88, 0x0d89, 0x0d8a, 0x0d8b, 0x0d8c, 
-    0x0d8d, 0x0d8e, 0x0d8f, 0x0d81, 0x0d82, 0x0da1, 0x0da2, 0x0da3, 0x0da4, 
-    0x0da5, 0x0da6, 0x0da7, 0x0da8, 0x0da9, 0x0daa, 0x0dab, 0x0dac, 0x0dad, 
-    0x0dae, 0x0daf, 0x0da1, 0x0da2, 0x0da3, 0x0d85, 0x0da5, 0x0da6, 0x0da7, 
-    0x0da8, 0x0da9, 0x0daa, 0x0dab, 0x0dac, 0x0dad, 0x0dae, 0x0daf, 0x0da1, 
-    0x0da2, 0x0dc1, 0x0dc2, 0x0dc3, 0x0dc4, 0x0dc5, 0x0dc6, 0x0dc7, 0x0a32, 
-    0x0dc9, 0x0dca, 0x0dcb, 0x0dcc, 0x0dcd, 0x0dce, 0x0dcf, 0x0dc1, 0x0dc2, 
-    0x0dc3, 0x0dc4, 0x0dc5, 0x0dc6, 0x0dc7, 0x0a32, 0x0dc9, 0x0dca, 0x0dcb, 
-    0x0dcc, 0x0dcd, 0x0dce, 0x0dcf, 0x0dc1, 0x0dc2, 0x0a32, 0x0de2, 0x0de3, 
-    0x0de4, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0dec, 
-    0x0ded, 0x0dee, 0x0a32, 0x0a32, 0x0de2, 0x0de3, 0x0de4, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0dec, 0x0ded, 0x0dee, 0x0a32, 
-    0x0a32, 0x0de2, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0567, 0x0568, 0x0569, 0x056a, 0x056b, 0x056c, 0x056d, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0587, 0x0588, 0x0589, 
-    0x058a, 0x058b, 0x058c, 0x058d, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x05a7, 0x05a8, 0x05a9, 0x05aa, 0x05ab, 0x05ac, 0x05ad, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x06ce, 0x06cf, 0x0998, 0x0998, 0x0998, 0x0998, 0x06d6, 
-    0x06d7, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x06ee, 0x06ef, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x06f6, 0x06f7, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0bb3, 0x0b55, 0x0b57, 
-    0x0998, 0x0998, 0x0998, 0x070e, 0x070f, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0716, 0x0717, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0703, 0x0704, 
-    0x0705, 0x0998, 0x0bca, 0x0bcb, 0x0bcc, 0x0bcd, 0x0bce, 0x0727, 0x0728, 
-    0x0bd1, 0x0bd2, 0x0bd3, 0x0bd4, 0x0bd5, 0x0bd6, 0x0bd7, 0x099a, 0x072e, 
-    0x072f, 0x099a, 0x0727, 0x0728, 0x099a, 0x0736, 0x0737, 0x0ac1, 0x099a, 
-    0x099a, 0x0d08, 0x0bcb, 0x0723, 0x0724, 0x0724, 0x099a, 0x0bea, 0x0beb, 
-    0x0bec, 0x0bed, 0x0bee, 0x0bef, 0x0bf0, 0x0bf1, 0x0bf2, 0x0bf3, 0x0bf4, 
-    0x0bf5, 0x0bf6, 0x0bf7, 0x0bf0, 0x0ae1, 0x0ae2, 0x0bee, 0x0bef, 0x0bf0, 
-    0x0bf1, 0x0bee, 0x0bef, 0x0bec, 0x0bed, 0x0bf3, 0x0bea, 0x0beb, 0x0bec, 
-    0x0bed, 0x0bee, 0x0bef, 0x0c0a, 0x0c0b, 0x0c0c, 0x0c0d, 0x0c0e, 0x0c0f, 
-    0x0c10, 0x0c11, 0x0c12, 0x0c13, 0x0c14, 0x0c15, 0x0c16, 0x0c17, 0x0c11, 
-    0x0c0e, 0x0c0f, 0x0b4f, 0x0b10, 0x0b0f, 0x0b10, 0x0b10, 0x0b0e, 0x0b11, 
-    0x0c74, 0x0c75, 0x0c0a, 0x0c0b, 0x0c0c, 0x0c0d, 0x0c0e, 0x0c0f, 0x0c74, 
-    0x0c4b, 0x0c4c, 0x0c4d, 0x0c4e, 0x0c4f, 0x0c50, 0x0c51, 0x0c52, 0x0c53, 
-    0x0c54, 0x0c55, 0x0c56, 0x0c57, 0x0c4c, 0x0c4d, 0x0c4e, 0x0c4f, 0x0c50, 
-    0x0c51, 0x0c52, 0x0c53, 0x0c54, 0x0c55, 0x0c56, 0x0c57, 0x0c4a, 0x0c4b, 
-    0x0c4c, 0x0c4d, 0x0c4e, 0x0c4f, 0x0c94, 0x0c6b, 0x0c6c, 0x0c6d, 0x0c6e, 
-    0x0c6f, 0x0c70, 0x0c71, 0x0c72, 0x0c73, 0x0c74, 0x0c75, 0x0c76, 0x0c77, 
-    0x0c6c, 0x0c6d, 0x0c6e, 0x0c6f, 0x0c70, 0x0c71, 0x0c72, 0x0c73, 0x0c74, 
-    0x0c75, 0x0c76, 0x0c77, 0x0c72, 0x0c6b, 0x0c6c, 0x0c6d, 0x0c6e, 0x0c6f, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0c93, 0x0c94, 0x0c95, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0c93, 0x0c94, 0x0c95, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0d83, 0x0d84, 
-    0x0d85, 0x0d86, 0x0d87, 0x0d88, 0x0d89, 0x0d8a, 0x0d8b, 0x0d8c, 0x0d8d, 
-    0x0d8e, 0x0d8f, 0x0d81, 0x0d82, 0x0d83, 0x0d83, 0x0d84, 0x0d85, 0x0d86, 
-    0x0d87, 0x0d88, 0x0d89, 0x0d8a, 0x0d8b, 0x0d8c, 0x0d8d, 0x0d8e, 0x0d8f, 
-    0x0da2, 0x0da5, 0x0da6, 0x0da3, 0x0da4, 0x0da5, 0x0da6, 0x0da7, 0x0da8, 
-    0x0da9, 0x0daa, 0x0dab, 0x0dac, 0x0dad, 0x0dae, 0x0daf, 0x0da1, 0x0da2, 
-    0x0da2, 0x0da3, 0x0da4, 0x0da5, 0x0da6, 0x0da7, 0x0da8, 0x0da9, 0x0daa, 
-    0x0dab, 0x0dac, 0x0dad, 0x0dae, 0x0daf, 0x0dc4, 0x0dc5, 0x0dc6, 0x0dc3, 
-    0x0dc4, 0x0dc5, 0x0dc6, 0x0dc7, 0x0a32, 0x0dc9, 0x0dca, 0x0dcb, 0x0dcc, 
-    0x0dcd, 0x0dce, 0x0dcf, 0x0a32, 0x0dc1, 0x0dc2, 0x0dc3, 0x0dc4, 0x0dc5, 
-    0x0dc6, 0x0dc7, 0x0a32, 0x0dc9, 0x0dca, 0x0dcb, 0x0dcc, 0x0dcd, 0x0dce, 
-    0x0dcf, 0x0a32, 0x0a32, 0x0a32, 0x0de3, 0x0de4, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0dec, 0x0ded, 0x0dee, 0x0a32, 0x0a32, 
-    0x0de1, 0x0de2, 0x0de3, 0x0de4, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0dec, 0x0ded, 0x0dee, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0cb0, 0x0cb1, 0x0cb2, 0x0cb4, 0x0cb3, 0x0cb4, 
-    0x0cb5, 0x0cb6, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0cd0, 
-    0x0cd1, 0x0cd1, 0x0cd2, 0x0cd3, 0x0cd4, 0x0cd5, 0x0cd6, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x058e, 0x058f, 0x0590, 0x0591, 0x0592, 
-    0x0592, 0x0593, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x05b1, 0x05b2, 0x05b2, 0x05b3, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x06d6, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x06d2, 0x06d3, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x06d2, 0x06d3, 0x0998, 0x06f6, 
-    0x06f7, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x06f2, 
-    0x06f3, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x070a, 0x070b, 0x070c, 
-    0x0717, 0x06f2, 0x0713, 0x0717, 0x0716, 0x0717, 0x0998, 0x0998, 0x0998, 
-    0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0998, 0x0b54, 0x0b55, 
-    0x0b57, 0x0998, 0x0998, 0x0711, 0x0712, 0x0713, 0x070a, 0x070b, 0x070c, 
-    0x0727, 0x0727, 0x072a, 0x072b, 0x072c, 0x0736, 0x0732, 0x0713, 0x0736, 
-    0x0736, 0x0737, 0x099a, 0x0a29, 0x0bcb, 0x0bcd, 0x0bcd, 0x0bcc, 0x0bcf, 
-    0x0bd0, 0x0bd1, 0x0bd2, 0x0bd3, 0x0bf6, 0x0bd5, 0x0bd6, 0x0727, 0x0728, 
-    0x0732, 0x0733, 0x072a, 0x072b, 0x0bca, 0x0bf0, 0x0bf1, 0x0bf2, 0x0bf3, 
-    0x0bd4, 0x0bd5, 0x0bec, 0x0bed, 0x0bee, 0x0bef, 0x0bf2, 0x0bf3, 0x0bea, 
-    0x0beb, 0x0bec, 0x0bed, 0x0bee, 0x0bef, 0x0bf0, 0x0bf1, 0x0bf2, 0x0bf3, 
-    0x0bf4, 0x0bf5, 0x0bf6, 0x0bee, 0x0bef, 0x0bf0, 0x0bf1, 0x0bee, 0x0bef, 
-    0x0bea, 0x0c10, 0x0c11, 0x0c12, 0x0c13, 0x0c0c, 0x0c0d, 0x0c0e, 0x0c0f, 
-    0x0c0e, 0x0c0f, 0x0c12, 0x0c13, 0x0c0a, 0x0c0b, 0x0c0c, 0x0c0d, 0x0c0e, 
-    0x0c0f, 0x0c10, 0x0c11, 0x0c12, 0x0c13, 0x0c14, 0x0c16, 0x0c17, 0x0c0e, 
-    0x0c0f, 0x0c10, 0x0c11, 0x0c0e, 0x0c0f, 0x0c0a, 0x0c50, 0x0c51, 0x0c52, 
-    0x0c53, 0x0c54, 0x0c55, 0x0c56, 0x0c57, 0x0c4a, 0x0c4b, 0x0c4c, 0x0c4d, 
-    0x0c4e, 0x0c4f, 0x0c50, 0x0c51, 0x0c52, 0x0c53, 0x0c54, 0x0c55, 0x0c56, 
-    0x0c57, 0x0c4a, 0x0c4b, 0x0c4c, 0x0c4d, 0x0c4e, 0x0c4f, 0x0c52, 0x0c51, 
-    0x0c52, 0x0c53, 0x0c70, 0x0c71, 0x0c72, 0x0c73, 0x0c74, 0x0c75, 0x0c76, 
-    0x0c77, 0x0c72, 0x0c6b, 0x0c6c, 0x0c6d, 0x0c6e, 0x0c6f, 0x0c70, 0x0c71, 
-    0x0c72, 0x0c73, 0x0c74, 0x0c75, 0x0c76, 0x0c77, 0x0c72, 0x0c6b, 0x0c6c, 
-    0x0c6d, 0x0c6e, 0x0c6f, 0x0c70, 0x0c71, 0x0c72, 0x0c73, 0x0a32, 0x0a32, 
-    0x0a32, 0x0c93, 0x0c94, 0x0c95, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0c93, 0x0c94, 0x0c95, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-    0x0a32, 0x0a32, 0x0a32, 0x0a32, 0x0a32, 
-};
-
+/* map2.h
+ * generated by tools/assets.py from map2.csv, the data is in the asset pack */
+
+#define map2_width 64
+#define map2_height 32
+#define map2_metatile_count 152
+#define map2_metatiles_bytes 2432
+#define map2_bytes 512
+
+extern const unsigned short map2_metatiles [];
+extern const unsigned char map2 [];
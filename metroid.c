@@ -3,6 +3,15 @@
  * program which demonstrates sprites colliding with tiles
  */
  #include <stdio.h>
+#include <stdint.h>
+
+/* the host build (see tools/gba_host.c) runs the game as a Linux program with
+ * plain memory mapped at the hardware addresses, so it needs a couple of hooks */
+#ifdef HOST
+#include <stdlib.h>
+#include "tools/gba_host.h"
+#define main game_main
+#endif
 
 #define SCREEN_WIDTH 240
 #define SCREEN_HEIGHT 160
@@ -28,17 +37,23 @@
 
 /* Score background*/
 #include "score_background.h"
-#include "basic_shot_16K_mono.h"
-#include "mus_main_16K_mono.h"
-#include "explosion_16K_mono.h"
+#include "mus_main_18K_mono.h"
+
+/* the hashes of the names of everything in the asset pack */
+#include "assets.h"
 
 /* using a manual map so text can be updated(the original tile map was a const)*/
-unsigned short TextMap [32*32];
+/* it is word aligned so it can be cleared a word at a time */
+unsigned short TextMap [32*32] __attribute__((aligned(4)));
 
 /**Assembly function declaration*/
 int calc_offset(int offset, int tileWidth);
 int get_index(int row, int col);
 
+/* BIOS memory copy and fill calls (cpu_set.s and cpu_fast_set.s) */
+void cpu_set(const void* source, void* dest, unsigned int mode);
+void cpu_fast_set(const void* source, void* dest, unsigned int mode);
+
 /*Hits and Lives*/
 int numEnemies = 6;
 int currentLife = 3;
@@ -68,7 +83,7 @@ volatile unsigned short* bg3_control = (volatile unsigned short*) 0x400000e;
 #define NUM_SPRITES 128
 
 /* the display control pointer points to the gba graphics register */
-volatile unsigned long* display_control = (volatile unsigned long*) 0x4000000;
+volatile unsigned int* display_control = (volatile unsigned int*) 0x4000000;
 
 /* the memory location which controls sprite attributes */
 volatile unsigned short* sprite_attribute_memory = (volatile unsigned short*) 0x7000000;
@@ -111,22 +126,105 @@ volatile short* bg2_y_scroll = (unsigned short*) 0x400001a;
  * much of the screen has been drawn */
 volatile unsigned short* scanline_counter = (volatile unsigned short*) 0x4000006;
 
-/* wait for the screen to be fully drawn so we can do something during vblank */
+/* the number of vblanks so far, counted by the vblank interrupt */
+volatile unsigned int vblank_count = 0;
+
+/* wait for the screen to be fully drawn so we can do something during vblank
+ *
+ * this waits for the interrupt to count the next vblank rather than for the
+ * scanline counter to reach 160: the counter stays there for all of vblank,
+ * so a frame which finished early would go round twice in the same one */
 void wait_vblank() {
-    /* wait until all 160 lines have been updated */
-    while (*scanline_counter < 160) { }
+    unsigned int seen = vblank_count;
+    while (vblank_count == seen) {
+#ifdef HOST
+        host_wait_vblank();
+#endif
+    }
 }
 
-/* this function checks whether a particular button has been pressed */
-unsigned char button_pressed(unsigned short button) {
-    /* and the button register with the button constant we want */
-    unsigned short pressed = *buttons & button;
+/* all ten button bits */
+#define BUTTON_ALL 0x03ff
+
+/* the key state is latched once per frame in on_vblank() so that every check
+ * during a frame sees the same snapshot and the register is only read once
+ * these hold set bits for pressed buttons (the register itself is active low) */
+volatile unsigned short keys_current = 0;
+volatile unsigned short keys_previous = 0;
+
+/* buttons which have auto-repeated this frame */
+volatile unsigned short keys_repeated = 0;
+
+/* auto-repeat timing in frames: the first repeat fires after the delay
+ * and then again every interval frames while the button stays held */
+int key_repeat_delay = 20;
+int key_repeat_interval = 6;
+
+/* the frames until each button next repeats, so pressing or letting go of
+ * one doesn't hold up another which is being held */
+#define BUTTON_COUNT 10
+unsigned char key_repeat_counters[BUTTON_COUNT];
+
+/* read the button register once and update the edge masks */
+void key_poll() {
+    keys_previous = keys_current;
+    keys_current = ~(*buttons) & BUTTON_ALL;
+
+    unsigned short repeated = 0;
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        unsigned short bit = 1 << i;
+        if (!(keys_current & bit)) {
+            continue;
+        }
 
-    /* if this value is zero, then it's not pressed */
-    if (pressed == 0) {
-        return 1;
-    } else {
+        if (!(keys_previous & bit)) {
+            /* just pressed, which counts as the first repeat */
+            key_repeat_counters[i] = key_repeat_delay;
+            repeated |= bit;
+        } else if (key_repeat_counters[i] <= 1) {
+            key_repeat_counters[i] = key_repeat_interval;
+            repeated |= bit;
+        } else {
+            key_repeat_counters[i]--;
+        }
+    }
+    keys_repeated = repeated;
+}
+
+/* change how long a button must be held before it repeats and how often,
+ * buttons already held carry on with the timing they started with */
+void key_repeat_limits(int delay, int interval) {
+    key_repeat_delay = delay;
+    key_repeat_interval = interval;
+}
+
+/* buttons held down this frame */
+unsigned short key_held(unsigned short button) {
+    return keys_current & button;
+}
+
+/* buttons which went down this frame */
+unsigned short key_pressed(unsigned short button) {
+    return keys_current & ~keys_previous & button;
+}
+
+/* buttons which came up this frame */
+unsigned short key_released(unsigned short button) {
+    return ~keys_current & keys_previous & button;
+}
+
+/* buttons which were just pressed or are auto-repeating this frame */
+unsigned short key_repeat(unsigned short button) {
+    return keys_repeated & button;
+}
+
+/* this function checks whether a particular button is being held down */
+unsigned char button_pressed(unsigned short button) {
+    /* and the latched key state with the button constant we want */
+    if (key_held(button) == 0) {
         return 0;
+    } else {
+        return 1;
     }
 }
 
@@ -155,7 +253,9 @@ volatile unsigned short* timer0_control = (volatile unsigned short*) 0x4000102;
 
 /* the GBA clock speed is fixed at this rate */
 #define CLOCK 16777216
-#define CYCLES_PER_BLANK 280806
+
+/* the cycles from one vblank to the next, 228 lines of 1232 cycles */
+#define CYCLES_PER_BLANK 280896
 
 /* flag for turning on DMA */
 #define DMA_ENABLE 0x80000000
@@ -167,6 +267,9 @@ volatile unsigned short* timer0_control = (volatile unsigned short*) 0x4000102;
 /* this causes the DMA destination to be the same each time rather than increment */
 #define DMA_DEST_FIXED 0x400000
 
+/* the same for the source, which turns a copy into a fill */
+#define DMA_SOURCE_FIXED 0x1000000
+
 /* this causes the DMA to repeat the transfer automatically on some interval */
 #define DMA_REPEAT 0x2000000
 
@@ -191,11 +294,24 @@ volatile unsigned int* dma3_destination = (volatile unsigned int*) 0x40000D8;
 /* pointer to the DMA count/control */
 volatile unsigned int* dma3_control = (volatile unsigned int*) 0x40000DC;
 
-/* copy data using DMA */
-void memcpy16_dma(unsigned short* dest, unsigned short* source, int amount) {
-    *dma3_source = (unsigned int) source;
-    *dma3_destination = (unsigned int) dest;
+/* start a DMA 3 copy, the CPU waits until it is done */
+void dma3_copy16(unsigned short* dest, const unsigned short* source, int amount) {
+    *dma3_source = (uintptr_t) source;
+    *dma3_destination = (uintptr_t) dest;
     *dma3_control = amount | DMA_16 | DMA_ENABLE;
+#ifdef HOST
+    host_dma(3);
+#endif
+}
+
+/* the same a word at a time, which takes half the transfers */
+void dma3_copy32(unsigned int* dest, const unsigned int* source, int amount) {
+    *dma3_source = (uintptr_t) source;
+    *dma3_destination = (uintptr_t) dest;
+    *dma3_control = amount | DMA_32 | DMA_ENABLE;
+#ifdef HOST
+    host_dma(3);
+#endif
 }
 
 /* the global interrupt enable register */
@@ -213,243 +329,1829 @@ volatile unsigned int* interrupt_callback = (unsigned int*) 0x3007FFC;
 /* this register needs a bit set to tell the hardware to send the vblank interrupt */
 volatile unsigned short* display_interrupts = (unsigned short*) 0x4000004;
 
-/* the interrupts are identified by number, we only care about this one */
-#define INTERRUPT_VBLANK 0x1
+/* the interrupt sources, numbered by their bit in the registers above */
+#define IRQ_VBLANK 0
+#define IRQ_HBLANK 1
+#define IRQ_VCOUNT 2
+#define IRQ_TIMER0 3
+#define IRQ_TIMER1 4
+#define IRQ_TIMER2 5
+#define IRQ_TIMER3 6
+#define IRQ_SERIAL 7
+#define IRQ_DMA0 8
+#define IRQ_DMA1 9
+#define IRQ_DMA2 10
+#define IRQ_DMA3 11
+#define IRQ_KEYPAD 12
+#define IRQ_GAMEPAK 13
+#define IRQ_COUNT 14
+
+/* the function to call for each source, the dispatcher in irq.s (which the
+ * BIOS calls for every interrupt) acknowledges the interrupt before calling
+ * it, so the handlers are plain functions */
+void (*irq_table[IRQ_COUNT])(void);
+
+/* the sources which may interrupt another source's handler, for the ones
+ * which can't wait until the handler which is running finishes */
+unsigned short irq_nest_mask = 0;
+
+/* the assembly dispatcher */
+void irq_dispatch(void);
+
+/* set up the dispatcher with no handlers */
+void irq_init() {
+    *interrupt_enable = 0;
+    for (int i = 0; i < IRQ_COUNT; i++) {
+        irq_table[i] = 0;
+    }
+    irq_nest_mask = 0;
+    *interrupt_selection = 0;
+    *interrupt_callback = (uintptr_t) &irq_dispatch;
+    *interrupt_enable = 1;
+}
 
-/* allows turning on and off sound for the GBA altogether */
-volatile unsigned short* master_sound = (volatile unsigned short*) 0x4000084;
-#define SOUND_MASTER_ENABLE 0x80
+/* set the function for a source, nested lets it interrupt other handlers */
+void irq_set(int source, void (*handler)(void), int nested) {
+    unsigned short ime = *interrupt_enable;
+    *interrupt_enable = 0;
+    irq_table[source] = handler;
+    if (nested) {
+        irq_nest_mask |= 1 << source;
+    } else {
+        irq_nest_mask &= ~(1 << source);
+    }
+    *interrupt_enable = ime;
+}
 
-/* has various bits for controlling the direct sound channels */
-volatile unsigned short* sound_control = (volatile unsigned short*) 0x4000082;
+/* the display and timers also need their own bit set to send interrupts
+ * (for serial, DMA and the keypad that is part of setting them up) */
+void irq_source_control(int source, int on) {
+    volatile unsigned short* control = 0;
+    unsigned short bit = 0;
+
+    if (source == IRQ_VBLANK || source == IRQ_HBLANK || source == IRQ_VCOUNT) {
+        control = display_interrupts;
+        bit = 0x08 << source;
+    } else if (source >= IRQ_TIMER0 && source <= IRQ_TIMER3) {
+        control = (volatile unsigned short*) (uintptr_t) (0x4000102 + 4 * (source - IRQ_TIMER0));
+        bit = 0x40;
+    }
 
-/* bit patterns for the sound control register */
-#define SOUND_A_RIGHT_CHANNEL 0x100
-#define SOUND_A_LEFT_CHANNEL 0x200
-#define SOUND_A_FIFO_RESET 0x800
-#define SOUND_B_RIGHT_CHANNEL 0x1000
-#define SOUND_B_LEFT_CHANNEL 0x2000
-#define SOUND_B_FIFO_RESET 0x8000
+    if (control) {
+        if (on) {
+            *control |= bit;
+        } else {
+            *control &= ~bit;
+        }
+    }
+}
 
-/* the location of where sound samples are placed for each channel */
-volatile unsigned char* fifo_buffer_a  = (volatile unsigned char*) 0x40000A0;
-volatile unsigned char* fifo_buffer_b  = (volatile unsigned char*) 0x40000A4;
+/* turn a source's interrupt on or off */
+void irq_enable(int source) {
+    unsigned short ime = *interrupt_enable;
+    *interrupt_enable = 0;
+    irq_source_control(source, 1);
+    *interrupt_selection |= 1 << source;
+    *interrupt_enable = ime;
+}
 
-/* global variables to keep track of how much longer the sounds are to play */
-unsigned int channel_a_vblanks_remaining = 0;
-unsigned int channel_a_total_vblanks = 0;
-unsigned int channel_b_vblanks_remaining = 0;
+void irq_disable(int source) {
+    unsigned short ime = *interrupt_enable;
+    *interrupt_enable = 0;
+    irq_source_control(source, 0);
+    *interrupt_selection &= ~(1 << source);
+    *interrupt_enable = ime;
+}
 
-/* play a sound with a number of samples, and sample rate on one channel 'A' or 'B' */
-void play_sound(const signed char* sound, int total_samples, int sample_rate, char channel) {
-    /* start by disabling the timer and dma controller (to reset a previous sound) */
-    *timer0_control = 0;
-    if (channel == 'A') {
-        *dma1_control = 0;
-    } else if (channel == 'B') {
-        *dma2_control = 0;
-    }
+/* flags for the mode passed to the BIOS copies */
+#define CPU_SET_FILL 0x1000000
+#define CPU_SET_32 0x4000000
+
+/* the word a DMA fill reads from over and over */
+volatile unsigned int dma_fill_value;
+
+/* the most units one DMA can move, a count of 0 means 0x10000 */
+#define DMA_MAX_COUNT 0xffff
 
-    /* output to both sides and reset the FIFO */
-    if (channel == 'A') {
-        *sound_control |= SOUND_A_RIGHT_CHANNEL | SOUND_A_LEFT_CHANNEL | SOUND_A_FIFO_RESET;
-    } else if (channel == 'B') {
-        *sound_control |= SOUND_B_RIGHT_CHANNEL | SOUND_B_LEFT_CHANNEL | SOUND_B_FIFO_RESET;
+/* copy any number of bytes with the fastest method the alignment allows:
+ * word aligned copies use 32 bit DMA, which needs half the bus transfers of
+ * 16 bit, halfword aligned ones fall back to 16 bit DMA and anything else
+ * (which can't be going to video memory) is copied a byte at a time
+ * copies longer than one DMA can do are split up */
+void mem_copy(volatile void* dest, const void* source, int bytes) {
+    uintptr_t alignment = (uintptr_t) dest | (uintptr_t) source | bytes;
+
+    if (bytes <= 0) {
+        return;
+    }
+    if (alignment & 1) {
+        for (int i = 0; i < bytes; i++) {
+            ((volatile unsigned char*) dest)[i] = ((const unsigned char*) source)[i];
+        }
+        return;
     }
 
-    /* enable all sound */
-    *master_sound = SOUND_MASTER_ENABLE;
+    /* DMA 3 is shared with the vblank interrupt, so hold it off while the
+     * registers are set up */
+    int unit = alignment & 2 ? 2 : 4;
+    while (bytes > 0) {
+        int count = bytes / unit > DMA_MAX_COUNT ? DMA_MAX_COUNT : bytes / unit;
+        unsigned short ime = *interrupt_enable;
+        *interrupt_enable = 0;
+        if (unit == 2) {
+            dma3_copy16((unsigned short*) dest, source, count);
+        } else {
+            dma3_copy32((unsigned int*) dest, source, count);
+        }
+        *interrupt_enable = ime;
 
-    /* set the dma channel to transfer from the sound array to the sound buffer */
-    if (channel == 'A') {
-        *dma1_source = (unsigned int) sound;
-        *dma1_destination = (unsigned int) fifo_buffer_a;
-        *dma1_control = DMA_DEST_FIXED | DMA_REPEAT | DMA_32 | DMA_SYNC_TO_TIMER | DMA_ENABLE;
-    } else if (channel == 'B') {
-        *dma2_source = (unsigned int) sound;
-        *dma2_destination = (unsigned int) fifo_buffer_b;
-        *dma2_control = DMA_DEST_FIXED | DMA_REPEAT | DMA_32 | DMA_SYNC_TO_TIMER | DMA_ENABLE;
+        dest = (volatile unsigned char*) dest + count * unit;
+        source = (const unsigned char*) source + count * unit;
+        bytes -= count * unit;
+    }
+}
+
+/* fill memory with a halfword value, again picking the fastest method:
+ * CpuFastSet writes 8 words per instruction so it wins for word aligned
+ * blocks of 32 bytes, other word aligned fills use a 32 bit DMA from a
+ * fixed source and the rest go through CpuSet a halfword at a time
+ * dest has to be halfword aligned and bytes even, as video memory can't be
+ * written a byte at a time - an odd last byte is left alone */
+void mem_fill(volatile void* dest, unsigned short value, int bytes) {
+    uintptr_t alignment = (uintptr_t) dest | bytes;
+    unsigned int word = value | (value << 16);
+
+    if (bytes <= 0) {
+        return;
+    }
+    if (((uintptr_t) dest & 3) == 0 && (bytes & 31) == 0) {
+        cpu_fast_set(&word, (void*) dest, (bytes / 4) | CPU_SET_FILL);
+    } else if ((alignment & 3) == 0) {
+        dma_fill_value = word;
+        while (bytes > 0) {
+            int count = bytes / 4 > DMA_MAX_COUNT ? DMA_MAX_COUNT : bytes / 4;
+            unsigned short ime = *interrupt_enable;
+            *interrupt_enable = 0;
+            *dma3_source = (uintptr_t) &dma_fill_value;
+            *dma3_destination = (uintptr_t) dest;
+            *dma3_control = count | DMA_32 | DMA_SOURCE_FIXED | DMA_ENABLE;
+#ifdef HOST
+            host_dma(3);
+#endif
+            *interrupt_enable = ime;
+
+            dest = (volatile unsigned char*) dest + count * 4;
+            bytes -= count * 4;
+        }
+    } else {
+        cpu_set(&value, (void*) dest, (bytes / 2) | CPU_SET_FILL);
     }
+}
 
-    /* set the timer so that it increments once each time a sample is due
-     * we divide the clock (ticks/second) by the sample rate (samples/second)
-     * to get the number of ticks/samples */
-    unsigned short ticks_per_sample = CLOCK / sample_rate;
+/* the asset pack built by tools/assets.py and linked in by assets.s: a magic
+ * word, the number of entries, the entries sorted by the hash of their names
+ * and then their data, so any asset can be found by name with a binary search
+ * and a pack with different contents needs no change to the code */
+#define ASSET_PACK_MAGIC 0x4b415041
+
+/* what an entry holds */
+#define ASSET_TYPE_TILES 1
+#define ASSET_TYPE_PALETTE 2
+#define ASSET_TYPE_MAP 3
+#define ASSET_TYPE_SAMPLES 4
+#define ASSET_TYPE_METATILES 5
+#define ASSET_TYPE_METAMAP 6
+#define ASSET_TYPE_PATTERNS 7
+#define ASSET_TYPE_ORDER 8
+
+/* how it is stored */
+#define ASSET_COMPRESSION_NONE 0
+#define ASSET_COMPRESSION_LZ77 1
+
+struct AssetEntry {
+    unsigned int hash;
+    /* from the start of the pack */
+    unsigned int offset;
+    /* as stored, the LZ77 header has the size once decompressed */
+    unsigned int size;
+    unsigned char type;
+    unsigned char compression;
+    /* as a power of 2 */
+    unsigned char align;
+    unsigned char reserved;
+};
 
-    /* the timers all count up to 65536 and overflow at that point, so we count up to that
-     * now the timer will trigger each time we need a sample, and cause DMA to give it one! */
-    *timer0_data = 65536 - ticks_per_sample;
+struct AssetPack {
+    unsigned int magic;
+    unsigned int count;
+    struct AssetEntry entries[];
+};
+
+extern const struct AssetPack asset_pack;
 
-    /* determine length of playback in vblanks
-     * this is the total number of samples, times the number of clock ticks per sample,
-     * divided by the number of machine cycles per vblank (a constant) */
-    if (channel == 'A') {
-        channel_a_vblanks_remaining = total_samples * ticks_per_sample * (1.0 / CYCLES_PER_BLANK);
-        channel_a_total_vblanks = channel_a_vblanks_remaining;
-    } else if (channel == 'B') {
-        channel_b_vblanks_remaining = total_samples * ticks_per_sample * (1.0 / CYCLES_PER_BLANK);
+/* BIOS LZ77 decompression calls (lz77_uncomp_wram.s and lz77_uncomp_vram.s) */
+void lz77_uncomp_wram(const void* source, void* dest);
+void lz77_uncomp_vram(const void* source, void* dest);
+
+/* the FNV-1a hash of an asset's name, which assets.h has for each of them */
+unsigned int asset_hash(const char* name) {
+    unsigned int hash = 0x811c9dc5;
+    while (*name) {
+        hash = (hash ^ (unsigned char) *name++) * 0x01000193;
     }
+    return hash;
+}
 
-    /* enable the timer */
-    *timer0_control = TIMER_ENABLE | TIMER_FREQ_1;
+/* find an entry by the hash of its name, or return 0 if there isn't one */
+const struct AssetEntry* asset_find(unsigned int hash) {
+    int low = 0, high;
+
+    if (asset_pack.magic != ASSET_PACK_MAGIC) {
+        return 0;
+    }
+    high = asset_pack.count - 1;
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        unsigned int found = asset_pack.entries[middle].hash;
+        if (found == hash) {
+            return &asset_pack.entries[middle];
+        } else if (found < hash) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return 0;
 }
 
-/* function to setup background 0 for this program */
-void setup_background() {
+/* where an entry's data is, as stored */
+const void* asset_data(const struct AssetEntry* entry) {
+    return (const unsigned char*) &asset_pack + entry->offset;
+}
 
-    /* load the palette from the image into palette memory*/
-    memcpy16_dma((unsigned short*) bg_palette, (unsigned short*) background_palette, PALETTE_SIZE);
+/* the size of an entry once it is loaded */
+unsigned int asset_size(const struct AssetEntry* entry) {
+    if (entry->compression == ASSET_COMPRESSION_LZ77) {
+        return *(const unsigned int*) asset_data(entry) >> 8;
+    }
+    return entry->size;
+}
 
-    /* load the image into char block 0 */
-    memcpy16_dma((unsigned short*) char_block(0), (unsigned short*) background_data,
-            (background_width * background_height) / 2);
+/* load an asset into VRAM, palette memory or work RAM, decompressing it if it
+ * has to be, returns the number of bytes loaded or -1 if there is no such asset */
+int asset_load(unsigned int hash, volatile void* dest) {
+    const struct AssetEntry* entry = asset_find(hash);
 
-    /* set all control the bits in this register */
-    *bg0_control = 2 |    /* priority, 0 is highest, 3 is lowest */
-        (0 << 2)  |       /* the char block the image data is stored in */
-        (0 << 6)  |       /* the mosaic flag */
-        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
-        (21 << 8) |       /* the screen block the tile data is stored in */
-        (1 << 13) |       /* wrapping flag */
-        (0 << 14);        /* bg size, 0 is 256x256 */
+    if (!entry) {
+        return -1;
+    }
+    if (entry->compression == ASSET_COMPRESSION_LZ77) {
+        /* video memory can't be written a byte at a time */
+        if ((uintptr_t) dest >= 0x5000000) {
+            lz77_uncomp_vram(asset_data(entry), (void*) dest);
+        } else {
+            lz77_uncomp_wram(asset_data(entry), (void*) dest);
+        }
+    } else {
+        mem_copy(dest, asset_data(entry), entry->size);
+    }
+    return asset_size(entry);
+}
 
-    *bg1_control = 1 |
-        (0 << 2)  |
-        (0 << 6)  |
-        (1 << 7)  |
-        (22 << 8) |
-        (1 << 13) |
-        (0 << 14);
+/* copies to video memory during the frame are queued up and done in the next
+ * vblank, so the screen never shows them half done - the queue is drained in
+ * priority order (lowest number first) */
+#define DMA_PRIORITY_OAM 0
+#define DMA_PRIORITY_PALETTE 1
+#define DMA_PRIORITY_TILES 2
+#define DMA_PRIORITY_MAP 3
+#define DMA_PRIORITIES 4
+#define DMA_QUEUE_SIZE 16
+
+/* vblank lasts 68 lines of 1232 cycles, the queue gets most of that and
+ * leaves the rest for the other work in the interrupt - the cost of each
+ * copy is estimated from its size, a halfword from ROM to VRAM costing 4
+ * cycles, and anything which doesn't fit carries over to the next vblank */
+#define VBLANK_CYCLES 83776
+#define DMA_VBLANK_BUDGET 50000
+#define DMA_SETUP_CYCLES 16
+#define DMA_CYCLES_PER_HALFWORD 4
+
+/* one queued copy, done is set to 1 once it has been made (it can be 0) */
+struct DmaTransfer {
+    unsigned short* dest;
+    const unsigned short* source;
+    int amount;
+    unsigned char* done;
+};
 
-    /* load the tile data into screen block 16 */
-    memcpy16_dma((unsigned short*) screen_block(21), (unsigned short*) map, map_width * map_height);
-    memcpy16_dma((unsigned short*) screen_block(22), (unsigned short*) map1, map1_width * map1_height);
+struct DmaTransfer dma_queue[DMA_PRIORITIES][DMA_QUEUE_SIZE];
+int dma_queue_head[DMA_PRIORITIES];
+int dma_queue_count[DMA_PRIORITIES];
+
+/* how many copies are waiting, how many bytes the last vblank moved, and
+ * how many copies were turned away because the queue was full */
+int dma_queue_depth = 0;
+int dma_bytes_transferred = 0;
+int dma_queue_full = 0;
+
+/* copy some halfwords with DMA 3, a word at a time when both ends are word
+ * aligned and there are a whole number of words, which is nearly always */
+void dma3_copy(unsigned short* dest, const unsigned short* source, int amount) {
+    if ((((uintptr_t) dest | (uintptr_t) source) & 3) == 0 && (amount & 1) == 0) {
+        dma3_copy32((unsigned int*) dest, (const unsigned int*) source, amount >> 1);
+    } else {
+        dma3_copy16(dest, source, amount);
+    }
 }
 
-/* function for title background*/
-/* function to setup background 0 for this program */
-void setup_title_background() {
+/* queue a copy of some halfwords for the next vblank
+ * asking for the same copy twice before it happens only does it once
+ * returns 0 if there is no room, then nothing is copied and it's up to the
+ * caller to ask again later - copying it now would show it half done
+ * only the sprite frames can fill their queue, the rest ask for the same
+ * copy every time */
+int dma_queue_push(unsigned short* dest, const unsigned short* source, int amount,
+        int priority, unsigned char* done) {
+    /* the queue is shared with the vblank interrupt */
+    unsigned short ime = *interrupt_enable;
+    *interrupt_enable = 0;
 
-    /* load the palette from the image into palette memory*/
-    memcpy16_dma((unsigned short*) bg_palette, (unsigned short*) GBA_Metroid_Title_Screen_palette, PALETTE_SIZE);
+    for (int i = 0; i < dma_queue_count[priority]; i++) {
+        struct DmaTransfer* queued = &dma_queue[priority][(dma_queue_head[priority] + i) % DMA_QUEUE_SIZE];
+        if (queued->dest == dest && queued->source == source && queued->amount == amount && queued->done == done) {
+            *interrupt_enable = ime;
+            return 1;
+        }
+    }
 
-    /* load the image into char block 0 */
-    memcpy16_dma((unsigned short*) char_block(0), (unsigned short*) GBA_Metroid_Title_Screen_data,
-            (GBA_Metroid_Title_Screen_width * GBA_Metroid_Title_Screen_height) / 2);
+    if (dma_queue_count[priority] == DMA_QUEUE_SIZE) {
+        dma_queue_full++;
+        *interrupt_enable = ime;
+        return 0;
+    }
 
-    /* set all control the bits in this register */
-    *bg0_control = 1 |    /* priority, 0 is highest, 3 is lowest */
-        (0 << 2)  |       /* the char block the image data is stored in */
-        (0 << 6)  |       /* the mosaic flag */
-        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
-        (30 << 8) |       /* the screen block the tile data is stored in */
-        (1 << 13) |       /* wrapping flag */
-        (0 << 14);        /* bg size, 0 is 256x256 */
+    struct DmaTransfer* transfer = &dma_queue[priority][(dma_queue_head[priority] + dma_queue_count[priority]) % DMA_QUEUE_SIZE];
+    transfer->dest = dest;
+    transfer->source = source;
+    transfer->amount = amount;
+    transfer->done = done;
+    dma_queue_count[priority]++;
+    dma_queue_depth++;
 
-    
+    *interrupt_enable = ime;
+    return 1;
+}
 
-    /* load the tile data into screen block 16 */
-    /* MAY HAVE TO CHANGE MAP NAME*/
-    memcpy16_dma((unsigned short*) screen_block(30), (unsigned short*) GbaTitleScreenFinal, GbaTitleScreenFinal_width * GbaTitleScreenFinal_height);
+/* forget any queued copies which would set done, for when what it belongs to
+ * is reused before they have been made - they stay in the queue, copying
+ * nothing, so the others don't have to move */
+void dma_queue_cancel(unsigned char* done) {
+    unsigned short ime = *interrupt_enable;
+    *interrupt_enable = 0;
+
+    for (int priority = 0; priority < DMA_PRIORITIES; priority++) {
+        for (int i = 0; i < dma_queue_count[priority]; i++) {
+            struct DmaTransfer* queued = &dma_queue[priority][(dma_queue_head[priority] + i) % DMA_QUEUE_SIZE];
+            if (queued->done == done) {
+                queued->amount = 0;
+                queued->done = 0;
+            }
+        }
+    }
+
+    *interrupt_enable = ime;
 }
-/* function for mission complete background*/
-/* function to setup background 0 for this program */
-void setup_complete_background() {
 
-    /* load the palette from the image into palette memory*/
-    memcpy16_dma((unsigned short*) bg_palette, (unsigned short*) MissionCompleteScreen_palette, PALETTE_SIZE);
+/* make queued copies until the cycle budget runs out, called in vblank */
+void dma_queue_flush(int budget) {
+    dma_bytes_transferred = 0;
 
-    /* load the image into char block 0 */
-    memcpy16_dma((unsigned short*) char_block(0), (unsigned short*) MissionCompleteScreen_data,
-            (MissionCompleteScreen_width * MissionCompleteScreen_height) / 2);
+    for (int priority = 0; priority < DMA_PRIORITIES; priority++) {
+        while (dma_queue_count[priority] > 0) {
+            struct DmaTransfer* transfer = &dma_queue[priority][dma_queue_head[priority]];
 
-    /* set all control the bits in this register */
-    *bg2_control = 1 |    /* priority, 0 is highest, 3 is lowest */
-        (0 << 2)  |       /* the char block the image data is stored in */
-        (0 << 6)  |       /* the mosaic flag */
-        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
-        (21 << 8) |       /* the screen block the tile data is stored in */
-        (1 << 13) |       /* wrapping flag */
-        (0 << 14);        /* bg size, 0 is 256x256 */
+            /* a cancelled copy, a count of 0 would copy 0x4000 units */
+            if (transfer->amount == 0) {
+                dma_queue_head[priority] = (dma_queue_head[priority] + 1) % DMA_QUEUE_SIZE;
+                dma_queue_count[priority]--;
+                dma_queue_depth--;
+                continue;
+            }
 
-    
+            /* how much of it we can afford */
+            int amount = (budget - DMA_SETUP_CYCLES) / DMA_CYCLES_PER_HALFWORD;
+            if (amount <= 0) {
+                return;
+            }
+            if (amount >= transfer->amount) {
+                amount = transfer->amount;
+            } else if (amount > 1) {
+                /* split on a word so the rest can go a word at a time too */
+                amount &= ~1;
+            }
 
-    /* load the tile data into screen block 21 */
-    /* MAY HAVE TO CHANGE MAP NAME*/
-    memcpy16_dma((unsigned short*) screen_block(21), (unsigned short*) missionCompleteMap, missionCompleteMap_width * missionCompleteMap_height);
+            dma3_copy(transfer->dest, transfer->source, amount);
+            budget -= DMA_SETUP_CYCLES + amount * DMA_CYCLES_PER_HALFWORD;
+            dma_bytes_transferred += amount * 2;
+
+            /* leave the rest of a partly done copy at the front for next time */
+            if (amount < transfer->amount) {
+                transfer->dest += amount;
+                transfer->source += amount;
+                transfer->amount -= amount;
+                return;
+            }
+
+            if (transfer->done) {
+                *transfer->done = 1;
+            }
+            dma_queue_head[priority] = (dma_queue_head[priority] + 1) % DMA_QUEUE_SIZE;
+            dma_queue_count[priority]--;
+            dma_queue_depth--;
+        }
+    }
 }
-/* function for setting up the scoring tile*/
-/* function to setup score background 0 for this program */
-void setup_score_background() {
 
-    /* have to use the original game palette, only one palette of 256 can be active at a time*/
-    
-   
-    /* load the image into char block 0 */
-    memcpy16_dma((unsigned short*) char_block(3), (unsigned short*) score_background_data,
-            (score_background_width * score_background_height) / 2);
+/* allows turning on and off sound for the GBA altogether */
+volatile unsigned short* master_sound = (volatile unsigned short*) 0x4000084;
+#define SOUND_MASTER_ENABLE 0x80
 
-    /* set all control the bits in this register */
-    *bg3_control = 0 |    /* priority, 0 is highest, 3 is lowest */
-        (3 << 2)  |       /* the char block the image data is stored in */
-        (0 << 6)  |       /* the mosaic flag */
-        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
-        (30 << 8) |       /* the screen block the tile data is stored in */
-        (1 << 13) |       /* wrapping flag */
-        (0 << 14);        /* bg size, 0 is 256x256 */
+/* has various bits for controlling the direct sound channels */
+volatile unsigned short* sound_control = (volatile unsigned short*) 0x4000082;
 
-    
+/* bit patterns for the sound control register */
+#define SOUND_A_RIGHT_CHANNEL 0x100
+#define SOUND_A_LEFT_CHANNEL 0x200
+#define SOUND_A_FIFO_RESET 0x800
+#define SOUND_B_RIGHT_CHANNEL 0x1000
+#define SOUND_B_LEFT_CHANNEL 0x2000
+#define SOUND_B_FIFO_RESET 0x8000
 
-    /* using a manual textMap vs tile editor, because it needs to be updated*/
-        
+/* the volume of the four PSG channels as a whole */
+#define SOUND_PSG_QUARTER 0x0
+#define SOUND_PSG_HALF 0x1
+#define SOUND_PSG_FULL 0x2
 
-}
-/* function to set text on the screen at a given location */
-void set_text(char* str, int row, int col) {  
-	/*clear previous text in textMap*/
-	for(int i = 0; i < 32*32; i++){
-		TextMap[i]=0;
-	} 
-	/* assembly call to get the index*/                 
-    /* find the index in the texmap to draw to */
-    int index = get_index(row,col);
-    /*int index = row * 32 + col;*/
+/* the location of where sound samples are placed for each channel */
+volatile unsigned char* fifo_buffer_a  = (volatile unsigned char*) 0x40000A0;
+volatile unsigned char* fifo_buffer_b  = (volatile unsigned char*) 0x40000A4;
 
-    /* the first 32 characters are missing from the map (controls etc.) */
-    int missing = 32; 
+/* the sound timer ticks once per sample for the direct sound channels
+ * the rate is locked to the frame: 924 cycles gives 18157 samples a second
+ * and exactly 304 samples each frame, which is also a whole number of the
+ * 16 byte blocks DMA moves into the FIFO, so restarting the DMA each vblank
+ * never repeats or skips samples - sounds are resampled to this rate by
+ * tools/raw2gba.py (see there for the other rates which work) */
+#define SOUND_TICKS_PER_SAMPLE 924
+#define SOUND_RATE (CLOCK / SOUND_TICKS_PER_SAMPLE)
+
+/* the four PSG channels, the sound hardware of the older Game Boys, which
+ * make tones and noise on their own so sound effects need no DMA or mixing */
+#define PSG_SQUARE1 0
+#define PSG_SQUARE2 1
+#define PSG_WAVE 2
+#define PSG_NOISE 3
+#define PSG_CHANNELS 4
+
+/* square 1: the sweep, the duty/length/envelope and the frequency/restart registers */
+volatile unsigned short* psg_square1_sweep = (volatile unsigned short*) 0x4000060;
+volatile unsigned short* psg_square1_control = (volatile unsigned short*) 0x4000062;
+volatile unsigned short* psg_square1_frequency = (volatile unsigned short*) 0x4000064;
+
+/* square 2 is the same without the sweep */
+volatile unsigned short* psg_square2_control = (volatile unsigned short*) 0x4000068;
+volatile unsigned short* psg_square2_frequency = (volatile unsigned short*) 0x400006C;
+
+/* the wave channel plays 32 four bit samples from wave RAM */
+volatile unsigned short* psg_wave_select = (volatile unsigned short*) 0x4000070;
+volatile unsigned short* psg_wave_control = (volatile unsigned short*) 0x4000072;
+volatile unsigned short* psg_wave_frequency = (volatile unsigned short*) 0x4000074;
+volatile unsigned short* psg_wave_ram = (volatile unsigned short*) 0x4000090;
+
+/* the noise channel: length/envelope and the clock/restart registers */
+volatile unsigned short* psg_noise_control = (volatile unsigned short*) 0x4000078;
+volatile unsigned short* psg_noise_frequency = (volatile unsigned short*) 0x400007C;
+
+/* the master volume of the PSG channels and which sides each one plays on */
+volatile unsigned short* psg_output = (volatile unsigned short*) 0x4000080;
+
+/* bits of the frequency registers, restart starts the sound over */
+#define PSG_RESTART 0x8000
+
+/* the square wave duty cycles */
+#define PSG_DUTY_12 0
+#define PSG_DUTY_25 1
+#define PSG_DUTY_50 2
+#define PSG_DUTY_75 3
+
+/* the envelope changes the volume by 1 every step time / 64 seconds
+ * it gets quieter unless this is set */
+#define PSG_ENVELOPE_UP 0x8
+
+/* the sweep changes the frequency every sweep time / 128 seconds
+ * the sweep register is time << 4 | direction | shift */
+#define PSG_SWEEP_DOWN 0x8
+
+/* wave channel bits: play the sample bank, which bank plays, and the volumes */
+#define PSG_WAVE_ENABLE 0x80
+#define PSG_WAVE_BANK1 0x40
+#define PSG_WAVE_FULL 0x2000
+#define PSG_WAVE_HALF 0x4000
+#define PSG_WAVE_QUARTER 0x6000
+
+/* the frequency value for a tone in Hz, for the squares and the wave channel
+ * (which plays its 32 samples 4 times slower than this) */
+#define PSG_RATE(hz) (2048 - 131072 / (hz))
+
+/* the noise clock is shift << 4 | ratio, with this set for the short
+ * 7 bit pattern which sounds more like a tone */
+#define PSG_NOISE_SHORT 0x8
+
+/* a change of pitch partway through a sound, held for a number of frames */
+struct PsgStep {
+    unsigned short rate;
+    unsigned char frames;
+};
 
-    
-    /* for each character */
-    while (*str) {
-        /* place this character in the map */
-        TextMap[index] = *str - missing;
+/* a sound effect for one of the PSG channels, it plays for frames and then
+ * the channel is silenced, changing pitch by the steps if there are any
+ * (ending with one of 0 frames) - sweep is only for square 1 and wave only
+ * for the wave channel, where volume is one of the PSG_WAVE volumes
+ * a square sound without a sweep can play on either square channel
+ * priority decides which sound keeps a channel when they compete for it, and
+ * the sound won't start again until cooldown frames after it last did */
+struct PsgSound {
+    unsigned char channel;
+    unsigned char duty;
+    unsigned char volume;
+    unsigned char envelope;
+    unsigned char sweep;
+    unsigned char frames;
+    unsigned short rate;
+    const struct PsgStep* steps;
+    const unsigned short* wave;
+    unsigned char priority;
+    unsigned char cooldown;
+};
 
-        /* move onto the next character */
-        index++;
-        str++;
-    }
-    /* need to call the DMA copy with the manual textMap*/   
-    memcpy16_dma((unsigned short*) screen_block(30), (unsigned short*) TextMap, 32 * 32);
+/* what each channel is playing */
+struct PsgVoice {
+    const struct PsgSound* sound;
+    const struct PsgStep* step;
+    unsigned char step_frames;
+    unsigned char frames;
+};
+
+struct PsgVoice psg_voices[PSG_CHANNELS];
 
+/* sounds are panned from -64 (left) to 64 (right) */
+#define PAN_LEFT -64
+#define PAN_CENTRE 0
+#define PAN_RIGHT 64
+
+/* the pan for something at a position on the screen */
+int sound_pan(int screen_x) {
+    int pan = (screen_x - SCREEN_WIDTH / 2) * 64 / (SCREEN_WIDTH / 2);
+    return pan < PAN_LEFT ? PAN_LEFT : pan > PAN_RIGHT ? PAN_RIGHT : pan;
 }
 
-/* just kill time */
-void delay(unsigned int amount) {
-    for (int i = 0; i < amount * 10; i++);
+/* the PSG channels can only play on the left, the right or both, so the
+ * middle third of the pan range is both */
+void psg_set_pan(int channel, int pan) {
+    unsigned short sides = 0;
+    if (pan < PAN_RIGHT / 3) {
+        sides |= 0x1000 << channel;
+    }
+    if (pan > PAN_LEFT / 3) {
+        sides |= 0x100 << channel;
+    }
+    *psg_output = (*psg_output & ~(0x1100 << channel)) | sides;
 }
 
-/* a sprite is a moveable image on the screen */
-struct Sprite {
-    unsigned short attribute0;
-    unsigned short attribute1;
-    unsigned short attribute2;
-    unsigned short attribute3;
-};
+/* the sample bank last loaded into wave RAM, to skip loading it again */
+const unsigned short* psg_wave_loaded = 0;
 
-/* array of all the sprites available on the GBA */
+/* set the frequency (and maybe restart) a channel */
+void psg_set_rate(int channel, unsigned short rate, unsigned short restart) {
+    switch (channel) {
+        case PSG_SQUARE1:
+            *psg_square1_frequency = rate | restart;
+            break;
+        case PSG_SQUARE2:
+            *psg_square2_frequency = rate | restart;
+            break;
+        case PSG_WAVE:
+            *psg_wave_frequency = rate | restart;
+            break;
+        case PSG_NOISE:
+            *psg_noise_frequency = rate | restart;
+            break;
+    }
+}
+
+/* silence a channel, a volume of 0 with the envelope going down turns it off */
+void psg_stop(int channel) {
+    switch (channel) {
+        case PSG_SQUARE1:
+            *psg_square1_sweep = 0;
+            *psg_square1_control = 0;
+            *psg_square1_frequency = PSG_RESTART;
+            break;
+        case PSG_SQUARE2:
+            *psg_square2_control = 0;
+            *psg_square2_frequency = PSG_RESTART;
+            break;
+        case PSG_WAVE:
+            *psg_wave_select = 0;
+            break;
+        case PSG_NOISE:
+            *psg_noise_control = 0;
+            *psg_noise_frequency = PSG_RESTART;
+            break;
+    }
+    psg_voices[channel].sound = 0;
+}
+
+/* frames counted by the sound effects, for the cooldowns */
+unsigned int sfx_frame = 0;
+
+/* the frame each sound last started on, kept apart from the channels so the
+ * cooldown still holds after the sound has ended or lost its channel
+ * there are only a few sounds, when the table is full the one started
+ * longest ago makes room */
+#define SFX_SOUNDS 8
+
+struct SfxStarted {
+    const struct PsgSound* sound;
+    unsigned int frame;
+};
+
+struct SfxStarted sfx_started[SFX_SOUNDS];
+
+/* the entry for a sound, or the one to reuse for it */
+struct SfxStarted* sfx_started_find(const struct PsgSound* sound) {
+    struct SfxStarted* oldest = &sfx_started[0];
+    for (int i = 0; i < SFX_SOUNDS; i++) {
+        if (sfx_started[i].sound == sound) {
+            return &sfx_started[i];
+        }
+        if (!sfx_started[i].sound) {
+            oldest = &sfx_started[i];
+        } else if (oldest->sound && sfx_frame - sfx_started[i].frame > sfx_frame - oldest->frame) {
+            oldest = &sfx_started[i];
+        }
+    }
+    return oldest;
+}
+
+/* start a sound effect on a channel, cutting off whatever it was playing */
+void psg_play(const struct PsgSound* sound, int channel, int pan) {
+    struct PsgVoice* voice = &psg_voices[channel];
+    unsigned short envelope = (sound->volume << 12) | (sound->envelope << 8);
+
+    psg_set_pan(channel, pan);
+
+    switch (channel) {
+        case PSG_SQUARE1:
+            *psg_square1_sweep = sound->sweep;
+            *psg_square1_control = envelope | (sound->duty << 6);
+            break;
+        case PSG_SQUARE2:
+            *psg_square2_control = envelope | (sound->duty << 6);
+            break;
+        case PSG_WAVE:
+            /* wave RAM writes go to the bank which isn't playing */
+            if (sound->wave != psg_wave_loaded) {
+                *psg_wave_select = PSG_WAVE_BANK1;
+                for (int i = 0; i < 8; i++) {
+                    psg_wave_ram[i] = sound->wave[i];
+                }
+                psg_wave_loaded = sound->wave;
+            }
+            *psg_wave_select = PSG_WAVE_ENABLE;
+            *psg_wave_control = sound->volume;
+            break;
+        case PSG_NOISE:
+            *psg_noise_control = envelope;
+            break;
+    }
+    psg_set_rate(channel, sound->rate, PSG_RESTART);
+
+    struct SfxStarted* started = sfx_started_find(sound);
+    started->sound = sound;
+    started->frame = sfx_frame;
+
+    voice->sound = sound;
+    voice->step = sound->steps;
+    voice->step_frames = 0;
+    voice->frames = sound->frames;
+}
+
+/* move the sound effects on a frame, called in vblank */
+void psg_update() {
+    for (int channel = 0; channel < PSG_CHANNELS; channel++) {
+        struct PsgVoice* voice = &psg_voices[channel];
+        if (!voice->sound) {
+            continue;
+        }
+
+        if (voice->frames == 0 || --voice->frames == 0) {
+            psg_stop(channel);
+            continue;
+        }
+
+        /* the next step of the pitch, without restarting the envelope */
+        if (voice->step && voice->step->frames && voice->step_frames == 0) {
+            psg_set_rate(channel, voice->step->rate, 0);
+            voice->step_frames = voice->step->frames;
+            voice->step++;
+        }
+        if (voice->step_frames) {
+            voice->step_frames--;
+        }
+    }
+}
+
+/* a triangle wave for the wave channel, two samples per byte */
+const unsigned short psg_wave_triangle[8] = {
+    0x2301, 0x6745, 0xab89, 0xefcd, 0xdcfe, 0x98ba, 0x5476, 0x1032
+};
+
+/* the blaster: a square wave which sweeps down in pitch as it fades */
+const struct PsgSound shot_sound = {
+    PSG_SQUARE1, PSG_DUTY_50, 12, 1, (2 << 4) | PSG_SWEEP_DOWN | 2, 12, PSG_RATE(1400), 0, 0, 1, 4
+};
+
+/* an enemy being hit: a burst of noise which gets lower as it dies away */
+const struct PsgStep hit_steps[] = {
+    {(4 << 4) | 4, 6}, {(5 << 4) | 5, 8}, {0, 0}
+};
+
+const struct PsgSound hit_sound = {
+    PSG_NOISE, 0, 15, 2, 0, 30, (3 << 4) | 3, hit_steps, 0, 2, 2
+};
+
+/* Samus being hurt: a low square wave which drops in pitch twice */
+const struct PsgStep hurt_steps[] = {
+    {PSG_RATE(220), 6}, {PSG_RATE(160), 8}, {0, 0}
+};
+
+const struct PsgSound hurt_sound = {
+    PSG_SQUARE2, PSG_DUTY_25, 13, 2, 0, 20, PSG_RATE(330), hurt_steps, 0, 3, 10
+};
+
+/* sound effects are asked for during the frame and started together in the
+ * next vblank, so asking for one several times in a frame only plays it once
+ * and the channels are only reprogrammed for the sounds which win them */
+#define SFX_QUEUE_SIZE 8
+
+struct SfxRequest {
+    const struct PsgSound* sound;
+    int pan;
+};
+
+struct SfxRequest sfx_queue[SFX_QUEUE_SIZE];
+int sfx_queue_count = 0;
+
+/* requests merged into another, ones still cooling down and ones which couldn't get a channel */
+int sfx_coalesced = 0;
+int sfx_cooling = 0;
+int sfx_dropped = 0;
+
+/* ask for a sound effect to be played at the next vblank */
+void sfx_request(const struct PsgSound* sound, int pan) {
+    /* the queue is shared with the vblank interrupt */
+    unsigned short ime = *interrupt_enable;
+    *interrupt_enable = 0;
+
+    int i;
+    for (i = 0; i < sfx_queue_count; i++) {
+        if (sfx_queue[i].sound == sound) {
+            /* the same sound twice in a frame plays once, from the latest position */
+            sfx_queue[i].pan = pan;
+            sfx_coalesced++;
+            break;
+        }
+    }
+
+    if (i == sfx_queue_count) {
+        if (sfx_queue_count < SFX_QUEUE_SIZE) {
+            sfx_queue[sfx_queue_count].sound = sound;
+            sfx_queue[sfx_queue_count].pan = pan;
+            sfx_queue_count++;
+        } else {
+            sfx_dropped++;
+        }
+    }
+
+    *interrupt_enable = ime;
+}
+
+/* the channel a sound should go on: a free one it can use, otherwise the one
+ * playing the least important sound if that is no more important than it,
+ * or -1 if it has to be dropped */
+int sfx_channel(const struct PsgSound* sound) {
+    int channels[2] = {sound->channel, -1};
+    if (sound->channel == PSG_SQUARE2 || (sound->channel == PSG_SQUARE1 && !sound->sweep)) {
+        channels[1] = sound->channel == PSG_SQUARE1 ? PSG_SQUARE2 : PSG_SQUARE1;
+    }
+
+    int best = -1;
+    for (int i = 0; i < 2 && channels[i] >= 0; i++) {
+        const struct PsgSound* playing = psg_voices[channels[i]].sound;
+        if (!playing) {
+            return channels[i];
+        }
+        if (playing->priority <= sound->priority &&
+                (best < 0 || playing->priority < psg_voices[best].sound->priority)) {
+            best = channels[i];
+        }
+    }
+    return best;
+}
+
+/* start the sounds asked for during the frame, most important first */
+void sfx_commit() {
+    sfx_frame++;
+
+    while (sfx_queue_count > 0) {
+        /* take the most important request */
+        int next = 0;
+        for (int i = 1; i < sfx_queue_count; i++) {
+            if (sfx_queue[i].sound->priority > sfx_queue[next].sound->priority) {
+                next = i;
+            }
+        }
+        struct SfxRequest request = sfx_queue[next];
+        sfx_queue[next] = sfx_queue[--sfx_queue_count];
+
+        /* skip it if it started too recently */
+        struct SfxStarted* started = sfx_started_find(request.sound);
+        if (started->sound == request.sound && sfx_frame - started->frame < request.sound->cooldown) {
+            sfx_cooling++;
+            continue;
+        }
+
+        int channel = sfx_channel(request.sound);
+        if (channel < 0) {
+            sfx_dropped++;
+        } else {
+            psg_play(request.sound, channel, request.pan);
+        }
+    }
+}
+
+/* in stereo the mixer's left side goes to direct sound channel A and its
+ * right side to channel B, otherwise channel A plays on both sides */
+int sound_stereo = 1;
+
+/* start the sample timer and the sound hardware, the music mixer feeds
+ * the direct sound channels and sound effects use the PSG channels */
+void sound_init(int stereo) {
+    *timer0_control = 0;
+    *dma1_control = 0;
+    *dma2_control = 0;
+
+    /* enable all sound, this has to come first or the other registers can't be written */
+    *master_sound = SOUND_MASTER_ENABLE;
+    sound_stereo = stereo;
+    if (stereo) {
+        *sound_control = SOUND_PSG_FULL | SOUND_A_LEFT_CHANNEL | SOUND_A_FIFO_RESET |
+            SOUND_B_RIGHT_CHANNEL | SOUND_B_FIFO_RESET;
+    } else {
+        *sound_control = SOUND_PSG_FULL | SOUND_A_RIGHT_CHANNEL | SOUND_A_LEFT_CHANNEL | SOUND_A_FIFO_RESET;
+    }
+
+    /* all four PSG channels on both sides at full volume */
+    *psg_output = 0xff77;
+    for (int channel = 0; channel < PSG_CHANNELS; channel++) {
+        psg_stop(channel);
+    }
+
+    /* the timers all count up to 65536 and overflow at that point, so we count up to that
+     * now the timer will trigger each time we need a sample, and cause DMA to give it one! */
+    *timer0_data = 65536 - SOUND_TICKS_PER_SAMPLE;
+    *timer0_control = TIMER_ENABLE | TIMER_FREQ_1;
+}
+
+/* timers 2 and 3 chained together count cycles, for measuring how long things take */
+volatile unsigned short* timer2_data = (volatile unsigned short*) 0x4000108;
+volatile unsigned short* timer2_control = (volatile unsigned short*) 0x400010A;
+volatile unsigned short* timer3_data = (volatile unsigned short*) 0x400010C;
+volatile unsigned short* timer3_control = (volatile unsigned short*) 0x400010E;
+
+/* this makes a timer count the overflows of the one before it */
+#define TIMER_CASCADE 0x4
+
+/* start counting cycles from zero */
+void profile_start() {
+#ifdef HOST
+    host_profile_start();
+    return;
+#endif
+    *timer2_control = 0;
+    *timer3_control = 0;
+    *timer2_data = 0;
+    *timer3_data = 0;
+    *timer3_control = TIMER_ENABLE | TIMER_CASCADE;
+    *timer2_control = TIMER_ENABLE | TIMER_FREQ_1;
+}
+
+/* stop counting and return the cycles since profile_start() */
+unsigned int profile_stop() {
+#ifdef HOST
+    return host_profile_stop();
+#endif
+    *timer2_control = 0;
+    *timer3_control = 0;
+    return *timer2_data | (*timer3_data << 16);
+}
+
+/* the music is a tracker song: patterns of notes which trigger short
+ * instrument samples, mixed in software into channel A once a frame
+ * tools/mod2gba.py converts a 4 channel MOD file into these structures */
+
+/* an instrument sample, loop_length is 0 if it plays once
+ * rate is the samples per second it plays at for MUSIC_BASE_NOTE */
+struct Instrument {
+    const signed char* data;
+    int length;
+    int loop_start;
+    int loop_length;
+    int rate;
+    unsigned char volume;
+};
+
+/* one channel of one row of a pattern, note and instrument are 0 when not
+ * given (instruments count from 1) and effect is one of the MUSIC_EFFECT ones */
+struct Note {
+    unsigned char note;
+    unsigned char instrument;
+    unsigned char effect;
+    unsigned char param;
+};
+
+/* notes are numbered in semitones from 1, and this is the note an
+ * instrument's rate is given for (C-2 in tracker terms) */
+#define MUSIC_BASE_NOTE 13
+
+/* the effects the sequencer knows, numbered as in MOD files */
+#define MUSIC_EFFECT_NONE 0x0
+#define MUSIC_EFFECT_PAN 0x8
+#define MUSIC_EFFECT_VOLUME_SLIDE 0xA
+#define MUSIC_EFFECT_JUMP 0xB
+#define MUSIC_EFFECT_VOLUME 0xC
+#define MUSIC_EFFECT_BREAK 0xD
+#define MUSIC_EFFECT_SPEED 0xF
+
+/* patterns are stored one after the other, each being rows * channels notes
+ * the order lists the patterns to play, going back to restart at the end
+ * speed is ticks per row and tempo sets ticks per second (tempo * 2 / 5) */
+struct Song {
+    const struct Instrument* instruments;
+    const struct Note* patterns;
+    const unsigned char* order;
+    unsigned char length;
+    unsigned char restart;
+    unsigned char channels;
+    unsigned char rows;
+    unsigned char speed;
+    unsigned char tempo;
+};
+
+/* the mixer has one voice per song channel */
+#define MIX_VOICES 4
+
+/* each frame mixes exactly as many samples as channel A plays in a frame */
+#define MIX_SAMPLES (CYCLES_PER_BLANK / SOUND_TICKS_PER_SAMPLE)
+
+/* a voice playing an instrument, position and step are in samples with
+ * 12 bits of fraction */
+struct Voice {
+    const struct Instrument* instrument;
+    unsigned int position;
+    unsigned int step;
+    unsigned char active;
+    unsigned char volume;
+    unsigned char effect;
+    unsigned char param;
+    signed char pan;
+};
+
+struct Voice voices[MIX_VOICES];
+
+/* the song playing and where it is up to */
+const struct Song* music_song = 0;
+int music_order = 0;
+int music_row = 0;
+int music_tick = 0;
+int music_speed = 6;
+int music_tempo = 125;
+int music_tick_time = 0;
+int music_next_order = -1;
+int music_next_row = 0;
+
+/* the direct sound channels play one buffer while the other is mixed, the
+ * right side is only used in stereo */
+signed char mix_buffers[2][MIX_SAMPLES] __attribute__((aligned(4)));
+signed char mix_buffers_right[2][MIX_SAMPLES] __attribute__((aligned(4)));
+int mix_buffer_next = 0;
+
+/* the voices are mixed as a sum and, for any which aren't centred, a
+ * difference which takes away from one side and adds to the other
+ * so the left side is total - pan and the right total + pan */
+int mix_total[MIX_SAMPLES];
+int mix_pan[MIX_SAMPLES];
+
+/* the cycles the last frame of music took, and the most any frame took */
+unsigned int music_cycles = 0;
+unsigned int music_cycles_peak = 0;
+
+/* 2 to the power of n/12 for each semitone of an octave, as 16.16 fixed point */
+const unsigned int semitone_ratios[12] = {
+    65536, 69433, 73562, 77936, 82570, 87480, 92682, 98193, 104032, 110218, 116772, 123715
+};
+
+/* the step through an instrument's samples for each mixed sample to play a note */
+unsigned int music_step(const struct Instrument* instrument, int note) {
+    int semitones = note - MUSIC_BASE_NOTE + 120;
+    int octave = semitones / 12 - 10;
+    unsigned int step = ((unsigned int) instrument->rate << 12) / SOUND_RATE;
+    step = (step * semitone_ratios[semitones % 12]) >> 16;
+    return octave >= 0 ? step << octave : step >> -octave;
+}
+
+/* act on one row of the current pattern */
+void music_row_start() {
+    const struct Song* song = music_song;
+    const struct Note* notes = song->patterns +
+        (song->order[music_order] * song->rows + music_row) * song->channels;
+
+    for (int i = 0; i < song->channels; i++) {
+        const struct Note* note = &notes[i];
+        struct Voice* voice = &voices[i];
+
+        /* an instrument on its own resets the volume */
+        if (note->instrument) {
+            voice->instrument = &song->instruments[note->instrument - 1];
+            voice->volume = voice->instrument->volume;
+        }
+        if (note->note && voice->instrument && voice->instrument->length) {
+            voice->position = 0;
+            voice->step = music_step(voice->instrument, note->note);
+            voice->active = 1;
+        }
+
+        voice->effect = note->effect;
+        voice->param = note->param;
+        switch (note->effect) {
+            case MUSIC_EFFECT_VOLUME:
+                voice->volume = note->param > 64 ? 64 : note->param;
+                break;
+            case MUSIC_EFFECT_PAN:
+                /* 0 is left and 255 right */
+                voice->pan = (note->param - 128) / 2;
+                break;
+            case MUSIC_EFFECT_SPEED:
+                /* small values are ticks per row, the rest the tempo */
+                if (note->param == 0) {
+                    break;
+                } else if (note->param < 32) {
+                    music_speed = note->param;
+                } else {
+                    music_tempo = note->param;
+                }
+                break;
+            case MUSIC_EFFECT_JUMP:
+                music_next_order = note->param;
+                music_next_row = 0;
+                break;
+            case MUSIC_EFFECT_BREAK:
+                /* the row is written in decimal digits */
+                if (music_next_order < 0) {
+                    music_next_order = music_order + 1;
+                }
+                music_next_row = (note->param >> 4) * 10 + (note->param & 0xf);
+                break;
+        }
+    }
+}
+
+/* effects which carry on between rows */
+void music_tick_effects() {
+    for (int i = 0; i < music_song->channels; i++) {
+        struct Voice* voice = &voices[i];
+        if (voice->effect == MUSIC_EFFECT_VOLUME_SLIDE) {
+            int volume = voice->volume + (voice->param >> 4) - (voice->param & 0xf);
+            voice->volume = volume < 0 ? 0 : volume > 64 ? 64 : volume;
+        }
+    }
+}
+
+/* move the song on by one tick */
+void music_advance() {
+    if (++music_tick < music_speed) {
+        music_tick_effects();
+        return;
+    }
+    music_tick = 0;
+
+    /* on to the next row, or wherever a jump or break said */
+    if (music_next_order >= 0) {
+        music_order = music_next_order;
+        music_row = music_next_row;
+        music_next_order = -1;
+    } else if (++music_row >= music_song->rows) {
+        music_order++;
+        music_row = 0;
+    }
+    if (music_order >= music_song->length) {
+        music_order = music_song->restart;
+    }
+    if (music_row >= music_song->rows) {
+        music_row = 0;
+    }
+
+    music_row_start();
+}
+
+/* start a song from the beginning */
+void music_play(const struct Song* song) {
+    for (int i = 0; i < MIX_VOICES; i++) {
+        voices[i].instrument = 0;
+        voices[i].active = 0;
+        voices[i].effect = MUSIC_EFFECT_NONE;
+        voices[i].pan = PAN_CENTRE;
+    }
+    music_song = song;
+    music_order = 0;
+    music_row = 0;
+    music_tick = 0;
+    music_speed = song->speed;
+    music_tempo = song->tempo;
+    music_tick_time = 0;
+    music_next_order = -1;
+    music_row_start();
+}
+
+/* mix a frame of samples from all the voices, into the left and right
+ * buffers in stereo or just the left one otherwise */
+void music_mix(signed char* left, signed char* right) {
+    int panned = 0;
+
+    for (int i = 0; i < MIX_SAMPLES; i++) {
+        mix_total[i] = 0;
+    }
+
+    for (int v = 0; v < MIX_VOICES; v++) {
+        struct Voice* voice = &voices[v];
+        if (!voice->active || voice->volume == 0) {
+            continue;
+        }
+
+        const signed char* data = voice->instrument->data;
+        unsigned int position = voice->position;
+        unsigned int step = voice->step;
+        unsigned int end = voice->instrument->length << 12;
+        unsigned int loop = voice->instrument->loop_length << 12;
+        int volume = voice->volume;
+
+        /* a panned voice also adds into the difference */
+        int pan_volume = right ? volume * voice->pan / 64 : 0;
+        if (pan_volume && !panned) {
+            for (int i = 0; i < MIX_SAMPLES; i++) {
+                mix_pan[i] = 0;
+            }
+            panned = 1;
+        }
+
+        for (int i = 0; i < MIX_SAMPLES; i++) {
+            int sample = data[position >> 12];
+            mix_total[i] += sample * volume;
+            if (pan_volume) {
+                mix_pan[i] += sample * pan_volume;
+            }
+            position += step;
+            if (position >= end) {
+                if (!loop) {
+                    voice->active = 0;
+                    break;
+                }
+                position -= loop;
+            }
+        }
+        voice->position = position;
+    }
+
+    /* volumes go up to 64, so that is one voice at full volume */
+    for (int i = 0; i < MIX_SAMPLES; i++) {
+        int sample = mix_total[i] >> 6;
+        if (!right) {
+            left[i] = sample < -128 ? -128 : sample > 127 ? 127 : sample;
+        } else if (!panned) {
+            left[i] = right[i] = sample < -128 ? -128 : sample > 127 ? 127 : sample;
+        } else {
+            int difference = mix_pan[i] >> 6;
+            int l = sample - difference;
+            int r = sample + difference;
+            left[i] = l < -128 ? -128 : l > 127 ? 127 : l;
+            right[i] = r < -128 ? -128 : r > 127 ? 127 : r;
+        }
+    }
+}
+
+/* called first thing each vblank: start the direct sound channels on the
+ * frame mixed last time - this has to happen the same number of cycles after
+ * vblank starts every frame, or the buffer swap drops or repeats samples, so
+ * nothing which takes a varying amount of time may run before it */
+void music_restart() {
+    /* restarting the DMA each frame keeps it in step with the mixing */
+    *dma1_control = 0;
+    *dma1_source = (uintptr_t) mix_buffers[mix_buffer_next];
+    *dma1_destination = (uintptr_t) fifo_buffer_a;
+    *dma1_control = DMA_DEST_FIXED | DMA_REPEAT | DMA_32 | DMA_SYNC_TO_TIMER | DMA_ENABLE;
+#ifdef HOST
+    host_sound_dma(1, MIX_SAMPLES);
+#endif
+    if (sound_stereo) {
+        *dma2_control = 0;
+        *dma2_source = (uintptr_t) mix_buffers_right[mix_buffer_next];
+        *dma2_destination = (uintptr_t) fifo_buffer_b;
+        *dma2_control = DMA_DEST_FIXED | DMA_REPEAT | DMA_32 | DMA_SYNC_TO_TIMER | DMA_ENABLE;
+#ifdef HOST
+        host_sound_dma(2, MIX_SAMPLES);
+#endif
+    }
+    mix_buffer_next ^= 1;
+}
+
+/* called later in vblank: run the sequencer for this frame's ticks and mix the next buffer */
+void music_vblank() {
+    profile_start();
+
+    /* tempo * 2 / 5 ticks a second, which is seldom a whole number per frame */
+    if (music_song) {
+        music_tick_time += music_tempo * 2 * CYCLES_PER_BLANK;
+        while (music_tick_time >= 5 * CLOCK) {
+            music_tick_time -= 5 * CLOCK;
+            music_advance();
+        }
+    }
+    music_mix(mix_buffers[mix_buffer_next], sound_stereo ? mix_buffers_right[mix_buffer_next] : 0);
+
+    music_cycles = profile_stop();
+    if (music_cycles > music_cycles_peak) {
+        music_cycles_peak = music_cycles;
+    }
+}
+
+/* until the soundtrack is converted from a module the music is the old
+ * recording, as one instrument looping forever - pattern 0 starts it and
+ * the song then repeats the empty pattern 1 */
+const struct Instrument main_theme_instruments[] = {
+    {mus_main_18K_mono, mus_main_18K_mono_bytes, 0, mus_main_18K_mono_bytes, SOUND_RATE, 64},
+};
+
+const struct Note main_theme_patterns[] = {
+    {MUSIC_BASE_NOTE, 1, MUSIC_EFFECT_NONE, 0},
+    {0, 0, MUSIC_EFFECT_NONE, 0},
+};
+
+const unsigned char main_theme_order[] = {0, 1};
+
+const struct Song main_theme = {
+    main_theme_instruments, main_theme_patterns, main_theme_order,
+    2, 1, 1, 1, 6, 125
+};
+
+/* the level is stored as 16x16 metatiles rather than 8x8 tiles: each metatile
+ * is four tile entries and what it does when things touch it, and the map is
+ * a byte per metatile, a quarter of the size of a tile map */
+struct Metatile {
+    /* top left, top right, bottom left, bottom right */
+    unsigned short tiles[4];
+    /* the height profile of each quarter, in the same order */
+    unsigned char shapes[4];
+    /* a bit for each quarter which isn't empty, in the same order */
+    unsigned char collision;
+    unsigned char surface;
+    unsigned char flags;
+    unsigned char reserved;
+};
+
+/* the quarters of a metatile in its collision byte */
+#define COLLISION_TOP_LEFT 0x1
+#define COLLISION_TOP_RIGHT 0x2
+#define COLLISION_BOTTOM_LEFT 0x4
+#define COLLISION_BOTTOM_RIGHT 0x8
+#define COLLISION_SOLID 0xf
+
+/* the height profiles a quarter can have, from the table below */
+#define SHAPE_EMPTY 0
+#define SHAPE_SOLID 1
+#define SHAPE_HALF 2
+#define SHAPE_SLOPE_UP_RIGHT 3
+#define SHAPE_SLOPE_UP_LEFT 4
+#define SHAPE_SLOPE_LOW_UP_RIGHT 5
+#define SHAPE_SLOPE_HIGH_UP_RIGHT 6
+#define SHAPE_SLOPE_HIGH_UP_LEFT 7
+#define SHAPE_SLOPE_LOW_UP_LEFT 8
+/* the shapes from here on can only be stood on from above */
+#define SHAPE_ONE_WAY 9
+#define SHAPE_ONE_WAY_HALF 10
+#define SHAPE_COUNT 11
+
+/* how many pixels of each column of an 8x8 tile are solid, from the bottom */
+const unsigned char height_profiles[SHAPE_COUNT][8] = {
+    {0, 0, 0, 0, 0, 0, 0, 0},
+    {8, 8, 8, 8, 8, 8, 8, 8},
+    {4, 4, 4, 4, 4, 4, 4, 4},
+    {1, 2, 3, 4, 5, 6, 7, 8},
+    {8, 7, 6, 5, 4, 3, 2, 1},
+    {1, 1, 2, 2, 3, 3, 4, 4},
+    {5, 5, 6, 6, 7, 7, 8, 8},
+    {8, 8, 7, 7, 6, 6, 5, 5},
+    {4, 4, 3, 3, 2, 2, 1, 1},
+    {8, 8, 8, 8, 8, 8, 8, 8},
+    {4, 4, 4, 4, 4, 4, 4, 4}
+};
+
+/* what a metatile is made of */
+#define SURFACE_NONE 0
+#define SURFACE_ROCK 1
+
+/* metatile flags */
+#define METATILE_DAMAGE 0x1
+
+struct MetatileMap {
+    const struct Metatile* metatiles;
+    const unsigned char* cells;
+    /* in metatiles */
+    int width;
+    int height;
+};
+
+/* the level being played */
+struct MetatileMap level_map;
+
+/* find a metatile map in the asset pack from the hashes of its two arrays and
+ * its size in tiles, returns 0 if it isn't there */
+int metatile_map_find(struct MetatileMap* map, unsigned int metatiles, unsigned int cells,
+        int width, int height) {
+    const struct AssetEntry* table = asset_find(metatiles);
+    const struct AssetEntry* entry = asset_find(cells);
+
+    if (!table || !entry || table->compression != ASSET_COMPRESSION_NONE ||
+            entry->compression != ASSET_COMPRESSION_NONE) {
+        return 0;
+    }
+    map->metatiles = asset_data(table);
+    map->cells = asset_data(entry);
+    map->width = width / 2;
+    map->height = height / 2;
+    return 1;
+}
+
+/* expand a metatile map into screen blocks, 32x32 tiles each: the right half
+ * of a map 64 tiles wide goes in the next block (0x400 entries on) and the
+ * bottom half of one 64 tiles tall goes after the top's one or two blocks, the
+ * order the hardware wraps through them in when the background is that size */
+void metatile_map_load(const struct MetatileMap* map, volatile unsigned short* dest) {
+    for (int my = 0; my < map->height; my++) {
+        for (int mx = 0; mx < map->width; mx++) {
+            const struct Metatile* metatile = &map->metatiles[map->cells[my * map->width + mx]];
+            int x = mx * 2, y = my * 2;
+            int offset = 0;
+
+            if (x >= 32) {
+                x -= 32;
+                offset += 0x400;
+            }
+            if (y >= 32) {
+                y -= 32;
+                offset = calc_offset(offset, map->width * 2);
+            }
+
+            volatile unsigned short* entry = dest + offset + y * 32 + x;
+            entry[0] = metatile->tiles[0];
+            entry[1] = metatile->tiles[1];
+            entry[32] = metatile->tiles[2];
+            entry[33] = metatile->tiles[3];
+        }
+    }
+}
+
+/* the metatile under a point of the map, wrapping around the edges */
+const struct Metatile* metatile_at(const struct MetatileMap* map, int x, int y) {
+    x >>= 4;
+    y >>= 4;
+
+    while (x >= map->width) {
+        x -= map->width;
+    }
+    while (y >= map->height) {
+        y -= map->height;
+    }
+    while (x < 0) {
+        x += map->width;
+    }
+    while (y < 0) {
+        y += map->height;
+    }
+    return &map->metatiles[map->cells[y * map->width + x]];
+}
+
+/* whether a point of the map is in a quarter of its metatile which isn't empty */
+int metatile_solid(const struct MetatileMap* map, int x, int y) {
+    int quarter = ((x >> 3) & 1) | (((y >> 3) & 1) << 1);
+    return (metatile_at(map, x, y)->collision >> quarter) & 1;
+}
+
+/* the shape of the 8x8 tile a point of the map is in */
+int metatile_shape(const struct MetatileMap* map, int x, int y) {
+    int quarter = ((x >> 3) & 1) | (((y >> 3) & 1) << 1);
+    return metatile_at(map, x, y)->shapes[quarter];
+}
+
+/* whether a box touches a metatile which hurts, giving the x of the middle
+ * of the first one found so whatever it hurts can be knocked away from it */
+int metatile_damage(const struct MetatileMap* map, int x, int y, int width, int height, int* hit_x) {
+    for (int my = y >> 4; my <= (y + height - 1) >> 4; my++) {
+        for (int mx = x >> 4; mx <= (x + width - 1) >> 4; mx++) {
+            if (metatile_at(map, mx << 4, my << 4)->flags & METATILE_DAMAGE) {
+                *hit_x = (mx << 4) + 8;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* no ground was found */
+#define NO_GROUND 0x7fffffff
+
+/* the y of the top of the ground in one 8x8 tile at column x, or NO_GROUND
+ * if the column is empty or it is a one way platform which from (where the
+ * feet were before moving) was below */
+int tile_ground(const struct MetatileMap* map, int x, int top, int from) {
+    int shape = metatile_shape(map, x, top);
+    int height = height_profiles[shape][x & 7];
+
+    if (!height || (shape >= SHAPE_ONE_WAY && from > top + 8 - height)) {
+        return NO_GROUND;
+    }
+    return top + 8 - height;
+}
+
+/* find the ground under feet at (x, y), which were at from before moving:
+ * the tile the feet are in is checked, then the one above if that is full
+ * so slopes can be walked up, or the one below if it is empty so they can
+ * be walked down - so it is never more than two table lookups */
+int ground_find(const struct MetatileMap* map, int x, int y, int from) {
+    int top = y & ~7;
+    int ground = tile_ground(map, x, top, from);
+
+    if (ground == top) {
+        int above = tile_ground(map, x, top - 8, from);
+        if (above != NO_GROUND) {
+            return above;
+        }
+    } else if (ground == NO_GROUND) {
+        return tile_ground(map, x, top + 8, from);
+    }
+    return ground;
+}
+
+/* which 8x8 tiles of the level block sight, a bit for each - the maps are
+ * 32 or 64 tiles each way like the screen blocks they are loaded into, so
+ * wrapping around is just a mask */
+#define SOLID_GRID_SIZE 64
+unsigned int solid_grid[SOLID_GRID_SIZE][SOLID_GRID_SIZE / 32];
+int solid_grid_width = 0;
+int solid_grid_height = 0;
+
+/* whether the solid grid covers the level, without it nothing blocks sight
+ * and enemies which fire would shoot through walls, so they don't look */
+int ranged_ai_enabled = 1;
+
+/* whether a tile is solid, the coordinates wrapping around the edges of the
+ * level the way the background does */
+int solid_grid_at(int x, int y) {
+    x &= solid_grid_width - 1;
+    y &= solid_grid_height - 1;
+    return (solid_grid[y][x >> 5] >> (x & 31)) & 1;
+}
+
+/* the result of a line of sight check between two tiles, the terrain never
+ * changes so an entry only stops being used when one of the ends moves to
+ * another tile and the key stops matching */
+#define SIGHT_CACHE_SIZE 32
+
+struct SightEntry {
+    short from_x, from_y;
+    short to_x, to_y;
+    unsigned char used;
+    unsigned char clear;
+};
+
+struct SightEntry sight_cache[SIGHT_CACHE_SIZE];
+
+/* how many checks were answered from the cache, and how many cast a ray */
+int sight_cache_hits = 0;
+int sight_cache_misses = 0;
+
+/* fill in the solid grid from the collision bits of a map, and forget what
+ * was worked out for the last one - returns 0 for a map which isn't a power
+ * of two tiles each way, up to SOLID_GRID_SIZE, as wrapping around wouldn't
+ * work, and then nothing blocks sight */
+int solid_grid_build(const struct MetatileMap* map) {
+    int width = map->width * 2;
+    int height = map->height * 2;
+    int fits = width > 0 && width <= SOLID_GRID_SIZE && (width & (width - 1)) == 0 &&
+        height > 0 && height <= SOLID_GRID_SIZE && (height & (height - 1)) == 0;
+
+    solid_grid_width = fits ? width : 1;
+    solid_grid_height = fits ? height : 1;
+
+    for (int y = 0; y < solid_grid_height; y++) {
+        for (int word = 0; word < SOLID_GRID_SIZE / 32; word++) {
+            solid_grid[y][word] = 0;
+        }
+        for (int x = 0; fits && x < solid_grid_width; x++) {
+            if (metatile_solid(map, x << 3, y << 3)) {
+                solid_grid[y][x >> 5] |= 1 << (x & 31);
+            }
+        }
+    }
+
+    for (int i = 0; i < SIGHT_CACHE_SIZE; i++) {
+        sight_cache[i].used = 0;
+    }
+    return fits;
+}
+
+/* walk the tiles a ray from (x0, y0) to (x1, y1) passes through, in the order
+ * it enters them, and stop at the first solid one - returning 1 with the
+ * tile in hit_x and hit_y, or 0 if it gets through
+ * the tiles the ends are in aren't checked, as enemies on the ceiling are
+ * right up against it
+ * the distances to the next tile edge on each axis are kept scaled by the
+ * ray's length on the other axis, so choosing which edge comes first is
+ * just a comparison and there is no division (they are doubled so they can
+ * be measured from the middle of the pixel) */
+int raycast(int x0, int y0, int x1, int y1, int* hit_x, int* hit_y) {
+    int tile_x = x0 >> 3;
+    int tile_y = y0 >> 3;
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int step_x = dx < 0 ? -1 : 1;
+    int step_y = dy < 0 ? -1 : 1;
+    int length_x = dx < 0 ? -dx : dx;
+    int length_y = dy < 0 ? -dy : dy;
+    int steps = ((x1 >> 3) - tile_x) * step_x + ((y1 >> 3) - tile_y) * step_y;
+
+    int edge_x = dx < 0 ? 2 * (x0 & 7) + 1 : 15 - 2 * (x0 & 7);
+    int edge_y = dy < 0 ? 2 * (y0 & 7) + 1 : 15 - 2 * (y0 & 7);
+    int next_x = length_x ? edge_x * length_y : 0x7fffffff;
+    int next_y = length_y ? edge_y * length_x : 0x7fffffff;
+
+    /* the last step enters the tile the ray ends in */
+    for (int i = 1; i < steps; i++) {
+        if (next_x <= next_y) {
+            tile_x += step_x;
+            next_x += 16 * length_y;
+        } else {
+            tile_y += step_y;
+            next_y += 16 * length_x;
+        }
+
+        if (solid_grid_at(tile_x, tile_y)) {
+            *hit_x = tile_x;
+            *hit_y = tile_y;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* the cache entry for a line between two points, keyed by their tiles */
+struct SightEntry* sight_entry(int x0, int y0, int x1, int y1) {
+    int index = ((x0 >> 3) * 7 + (y0 >> 3) * 13 + (x1 >> 3) * 3 + (y1 >> 3)) & (SIGHT_CACHE_SIZE - 1);
+    return &sight_cache[index];
+}
+
+/* whether the cache already knows about a line */
+int sight_cached(int x0, int y0, int x1, int y1) {
+    struct SightEntry* entry = sight_entry(x0, y0, x1, y1);
+    return entry->used && entry->from_x == x0 >> 3 && entry->from_y == y0 >> 3 &&
+        entry->to_x == x1 >> 3 && entry->to_y == y1 >> 3;
+}
+
+/* whether nothing solid is between two points, from the cache if the ends
+ * are in the same tiles as the last time it was asked about */
+int line_of_sight(int x0, int y0, int x1, int y1) {
+    struct SightEntry* entry = sight_entry(x0, y0, x1, y1);
+
+    if (sight_cached(x0, y0, x1, y1)) {
+        sight_cache_hits++;
+        return entry->clear;
+    }
+    sight_cache_misses++;
+
+    int hit_x, hit_y;
+    entry->from_x = x0 >> 3;
+    entry->from_y = y0 >> 3;
+    entry->to_x = x1 >> 3;
+    entry->to_y = y1 >> 3;
+    entry->used = 1;
+    entry->clear = !raycast(x0, y0, x1, y1, &hit_x, &hit_y);
+    return entry->clear;
+}
+
+/* function to setup background 0 for this program */
+void setup_background() {
+
+    /* load the palette from the image into palette memory*/
+    asset_load(ASSET_BACKGROUND_PALETTE, bg_palette);
+
+    /* load the image into char block 0 */
+    asset_load(ASSET_BACKGROUND_DATA, char_block(0));
+
+    /* set all control the bits in this register */
+    *bg0_control = 2 |    /* priority, 0 is highest, 3 is lowest */
+        (0 << 2)  |       /* the char block the image data is stored in */
+        (0 << 6)  |       /* the mosaic flag */
+        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
+        (21 << 8) |       /* the screen block the tile data is stored in */
+        (1 << 13) |       /* wrapping flag */
+        (0 << 14);        /* bg size, 0 is 256x256 */
+
+    *bg1_control = 1 |
+        (0 << 2)  |
+        (0 << 6)  |
+        (1 << 7)  |
+        (22 << 8) |
+        (1 << 13) |
+        (0 << 14);
+
+    /* load the tile data into screen block 16 */
+    asset_load(ASSET_MAP, screen_block(21));
+    metatile_map_find(&level_map, ASSET_MAP1_METATILES, ASSET_MAP1, map1_width, map1_height);
+    metatile_map_load(&level_map, screen_block(22));
+    ranged_ai_enabled = solid_grid_build(&level_map);
+#ifdef HOST
+    if (!ranged_ai_enabled) {
+        fprintf(stderr, "the level is %dx%d tiles, sight needs a power of two up to %d each way\n",
+                level_map.width * 2, level_map.height * 2, SOLID_GRID_SIZE);
+        exit(1);
+    }
+#endif
+}
+
+/* function for title background*/
+/* function to setup background 0 for this program */
+void setup_title_background() {
+
+    /* load the palette from the image into palette memory*/
+    asset_load(ASSET_GBA_METROID_TITLE_SCREEN_PALETTE, bg_palette);
+
+    /* load the image into char block 0 */
+    asset_load(ASSET_GBA_METROID_TITLE_SCREEN_DATA, char_block(0));
+
+    /* set all control the bits in this register */
+    *bg0_control = 1 |    /* priority, 0 is highest, 3 is lowest */
+        (0 << 2)  |       /* the char block the image data is stored in */
+        (0 << 6)  |       /* the mosaic flag */
+        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
+        (30 << 8) |       /* the screen block the tile data is stored in */
+        (1 << 13) |       /* wrapping flag */
+        (0 << 14);        /* bg size, 0 is 256x256 */
+
+    
+
+    /* load the tile data into screen block 16 */
+    /* MAY HAVE TO CHANGE MAP NAME*/
+    asset_load(ASSET_GBATITLESCREENFINAL, screen_block(30));
+}
+/* function for mission complete background*/
+/* function to setup background 0 for this program */
+void setup_complete_background() {
+
+    /* load the palette from the image into palette memory*/
+    asset_load(ASSET_MISSIONCOMPLETESCREEN_PALETTE, bg_palette);
+
+    /* load the image into char block 0 */
+    asset_load(ASSET_MISSIONCOMPLETESCREEN_DATA, char_block(0));
+
+    /* set all control the bits in this register */
+    *bg2_control = 1 |    /* priority, 0 is highest, 3 is lowest */
+        (0 << 2)  |       /* the char block the image data is stored in */
+        (0 << 6)  |       /* the mosaic flag */
+        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
+        (21 << 8) |       /* the screen block the tile data is stored in */
+        (1 << 13) |       /* wrapping flag */
+        (0 << 14);        /* bg size, 0 is 256x256 */
+
+    
+
+    /* load the tile data into screen block 21 */
+    /* MAY HAVE TO CHANGE MAP NAME*/
+    asset_load(ASSET_MISSIONCOMPLETEMAP, screen_block(21));
+}
+/* function for setting up the scoring tile*/
+/* function to setup score background 0 for this program */
+void setup_score_background() {
+
+    /* have to use the original game palette, only one palette of 256 can be active at a time*/
+    
+   
+    /* load the image into char block 0 */
+    asset_load(ASSET_SCORE_BACKGROUND_DATA, char_block(3));
+
+    /* set all control the bits in this register */
+    *bg3_control = 0 |    /* priority, 0 is highest, 3 is lowest */
+        (3 << 2)  |       /* the char block the image data is stored in */
+        (0 << 6)  |       /* the mosaic flag */
+        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
+        (30 << 8) |       /* the screen block the tile data is stored in */
+        (1 << 13) |       /* wrapping flag */
+        (0 << 14);        /* bg size, 0 is 256x256 */
+
+    
+
+    /* using a manual textMap vs tile editor, because it needs to be updated*/
+        
+
+}
+/* function to set text on the screen at a given location */
+void set_text(char* str, int row, int col) {  
+	/*clear previous text in textMap*/
+	mem_fill(TextMap, 0, sizeof(TextMap));
+	/* assembly call to get the index*/                 
+    /* find the index in the texmap to draw to */
+    int index = get_index(row,col);
+    /*int index = row * 32 + col;*/
+
+    /* the first 32 characters are missing from the map (controls etc.) */
+    int missing = 32; 
+
+    
+    /* for each character */
+    while (*str) {
+        /* place this character in the map */
+        TextMap[index] = *str - missing;
+
+        /* move onto the next character */
+        index++;
+        str++;
+    }
+    /* queue the copy of the manual textMap for the next vblank */
+    dma_queue_push((unsigned short*) screen_block(30), TextMap, 32 * 32, DMA_PRIORITY_MAP, 0);
+
+}
+
+/* just kill time */
+void delay(unsigned int amount) {
+    for (int i = 0; i < amount * 10; i++);
+}
+
+/* a sprite is a moveable image on the screen */
+struct Sprite {
+    unsigned short attribute0;
+    unsigned short attribute1;
+    unsigned short attribute2;
+    unsigned short attribute3;
+};
+
+/* array of all the sprites available on the GBA */
 struct Sprite sprites[NUM_SPRITES];
 int next_sprite_index = 0;
 
+/* sprites which have been given back, these get reused before new ones */
+unsigned char sprite_free_list[NUM_SPRITES];
+int sprite_free_count = 0;
+
+/* where each sprite is in the world, the camera is only taken off when
+ * the sprites are copied to OAM so nothing has to move when it scrolls */
+int sprite_world_x[NUM_SPRITES];
+int sprite_world_y[NUM_SPRITES];
+
+/* the camera is the world position of the top left corner of the screen */
+struct Camera {
+    int x, y;
+
+    /* how close to either side of the screen the target can get before
+     * the camera starts to follow it */
+    int deadzone;
+
+    /* each frame the camera closes 1/2^smoothing of the gap to where it
+     * wants to be, so it eases in rather than jerking */
+    int smoothing;
+};
+
+struct Camera camera;
+
 /* the different sizes of sprites which are possible */
 enum SpriteSize {
     SIZE_8_8,
@@ -470,8 +2172,13 @@ enum SpriteSize {
 struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
         int horizontal_flip, int vertical_flip, int tile_index, int priority) {
 
-    /* grab the next index */
-    int index = next_sprite_index++;
+    /* grab a sprite which was given back, or else the next index */
+    int index;
+    if (sprite_free_count > 0) {
+        index = sprite_free_list[--sprite_free_count];
+    } else {
+        index = next_sprite_index++;
+    }
 
     /* setup the bits used for each shape/size possible */
     int size_bits, shape_bits;
@@ -493,8 +2200,12 @@ struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
     int h = horizontal_flip ? 1 : 0;
     int v = vertical_flip ? 1 : 0;
 
+    /* remember where it is in the world */
+    sprite_world_x[index] = x;
+    sprite_world_y[index] = y;
+
     /* set up the first attribute */
-    sprites[index].attribute0 = y |             /* y coordinate */
+    sprites[index].attribute0 = (y & 0xff) |    /* y coordinate */
         (0 << 8) |          /* rendering mode */
         (0 << 10) |         /* gfx mode */
         (0 << 12) |         /* mosaic */
@@ -502,7 +2213,7 @@ struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
         (shape_bits << 14); /* shape */
 
     /* set up the second attribute */
-    sprites[index].attribute1 = x |             /* x coordinate */
+    sprites[index].attribute1 = (x & 0x1ff) |   /* x coordinate */
         (0 << 9) |          /* affine flag */
         (h << 12) |         /* horizontal flip flag */
         (v << 13) |         /* vertical flip flag */
@@ -517,16 +2228,141 @@ struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
     return &sprites[index];
 }
 
+/* this bit in attribute0 hides a (non-affine) sprite */
+#define SPRITE_DISABLE 0x200
+
+/* sprite widths and heights in pixels, indexed by [shape][size] */
+const unsigned char sprite_widths[3][4] = {
+    {8, 16, 32, 64},
+    {16, 32, 32, 64},
+    {8, 8, 16, 32}
+};
+const unsigned char sprite_heights[3][4] = {
+    {8, 16, 32, 64},
+    {8, 8, 16, 32},
+    {16, 32, 32, 64}
+};
+
+/* the hardware only has this many cycles on each scanline to draw sprites,
+ * a regular sprite costs one per pixel of width and an affine one 10 plus
+ * two per pixel of its box - sprites past the limit just don't get drawn */
+#define SPRITE_LINE_CYCLES 1210
+
+/* the sprites placed on screen, and then in the order they are copied to OAM */
+struct Sprite sprite_placed[NUM_SPRITES];
+struct Sprite oam_buffer[NUM_SPRITES];
+
+/* how far the order is rotated, this only moves when a line is over budget
+ * so the sprites which drop out change from frame to frame (flicker)
+ * rather than the same one vanishing */
+int sprite_rotation = 0;
+
+/* how many frames needed flicker, and how many lines were over budget last frame */
+int sprite_flicker_frames = 0;
+int sprite_overloaded_lines = 0;
+
 /* update all of the spries on the screen */
 void sprite_update_all() {
-    /* copy them all over */
-    memcpy16_dma((unsigned short*) sprite_attribute_memory, (unsigned short*) sprites, NUM_SPRITES * 4);
+    /* the change in sprite cycles at each of the 256 lines sprite y can be */
+    short coverage[257];
+    int count = next_sprite_index;
+
+    for (int line = 0; line < 257; line++) {
+        coverage[line] = 0;
+    }
+
+    for (int i = 0; i < count; i++) {
+        struct Sprite placed = sprites[i];
+        int affine = placed.attribute0 & 0x100;
+        int shape = placed.attribute0 >> 14;
+        if ((!affine && (placed.attribute0 & SPRITE_DISABLE)) || shape == 3) {
+            sprite_placed[i] = placed;
+            continue;
+        }
+
+        int size = placed.attribute1 >> 14;
+        int width = sprite_widths[shape][size];
+        int height = sprite_heights[shape][size];
+        int cost = width;
+        if (affine) {
+            /* double size sprites have a box twice as big */
+            if (placed.attribute0 & SPRITE_DISABLE) {
+                width *= 2;
+                height *= 2;
+            }
+            cost = 10 + 2 * width;
+        }
+
+        /* take the camera off to get the screen position */
+        int x = sprite_world_x[i] - camera.x;
+        int y = sprite_world_y[i] - camera.y;
+
+        /* sprites the camera can't see are switched off */
+        if (x >= SCREEN_WIDTH || x + width <= 0 || y >= SCREEN_HEIGHT || y + height <= 0) {
+            placed.attribute0 = SPRITE_DISABLE;
+            placed.attribute1 = 0;
+            sprite_placed[i] = placed;
+            continue;
+        }
+
+        placed.attribute0 = (placed.attribute0 & 0xff00) | (y & 0xff);
+        placed.attribute1 = (placed.attribute1 & 0xfe00) | (x & 0x1ff);
+        sprite_placed[i] = placed;
+
+        /* add the sprite's cost where it starts and take it off where it ends,
+         * y wraps around at 256 */
+        int top = y & 0xff;
+        int bottom = top + height;
+        coverage[top] += cost;
+        if (bottom <= 256) {
+            coverage[bottom] -= cost;
+        } else {
+            coverage[256] -= cost;
+            coverage[0] += cost;
+            coverage[bottom - 256] -= cost;
+        }
+    }
+
+    /* add them up down the visible lines */
+    int cycles = 0;
+    sprite_overloaded_lines = 0;
+    for (int line = 0; line < SCREEN_HEIGHT; line++) {
+        cycles += coverage[line];
+        if (cycles > SPRITE_LINE_CYCLES) {
+            sprite_overloaded_lines++;
+        }
+    }
+
+    if (sprite_overloaded_lines > 0 && count > 0) {
+        sprite_flicker_frames++;
+        sprite_rotation = (sprite_rotation + 1) % count;
+    } else {
+        sprite_rotation = 0;
+    }
+
+    /* lay the sprites out in OAM starting from the rotation point */
+    int source = sprite_rotation;
+    for (int i = 0; i < count; i++) {
+        oam_buffer[i] = sprite_placed[source];
+        source++;
+        if (source == count) {
+            source = 0;
+        }
+    }
+    for (int i = count; i < NUM_SPRITES; i++) {
+        oam_buffer[i] = sprites[i];
+    }
+
+    /* copy them all over in the next vblank */
+    dma_queue_push((unsigned short*) sprite_attribute_memory, (unsigned short*) oam_buffer,
+            NUM_SPRITES * 4, DMA_PRIORITY_OAM, 0);
 }
 
 /* setup all sprites */
 void sprite_clear() {
     /* clear the index counter */
     next_sprite_index = 0;
+    sprite_free_count = 0;
 
     /* move all sprites offscreen to hide them */
     for(int i = 0; i < NUM_SPRITES; i++) {
@@ -535,31 +2371,56 @@ void sprite_clear() {
     }
 }
 
-/* set a sprite postion */
-void sprite_position(struct Sprite* sprite, int x, int y) {
-    /* clear out the y coordinate */
-    sprite->attribute0 &= 0xff00;
-
-    /* set the new y coordinate */
-    sprite->attribute0 |= (y & 0xff);
-
-    /* clear out the x coordinate */
-    sprite->attribute1 &= 0xfe00;
+/* give a sprite back, it is hidden until it is handed out again */
+void sprite_free(struct Sprite* sprite) {
+    sprite->attribute0 = SPRITE_DISABLE;
+    sprite->attribute1 = 0;
+    sprite_free_list[sprite_free_count++] = sprite - sprites;
+}
 
-    /* set the new x coordinate */
-    sprite->attribute1 |= (x & 0x1ff);
+/* set a sprite postion in the world */
+void sprite_position(struct Sprite* sprite, int x, int y) {
+    int index = sprite - sprites;
+    sprite_world_x[index] = x;
+    sprite_world_y[index] = y;
 }
 
 /* move a sprite in a direction */
 void sprite_move(struct Sprite* sprite, int dx, int dy) {
-    /* get the current y coordinate */
-    int y = sprite->attribute0 & 0xff;
-
-    /* get the current x coordinate */
-    int x = sprite->attribute1 & 0x1ff;
+    int index = sprite - sprites;
 
     /* move to the new location */
-    sprite_position(sprite, x + dx, y + dy);
+    sprite_position(sprite, sprite_world_x[index] + dx, sprite_world_y[index] + dy);
+}
+
+/* set up the camera at the left of the world */
+void camera_init(struct Camera* camera, int deadzone, int smoothing) {
+    camera->x = 0;
+    camera->y = 0;
+    camera->deadzone = deadzone;
+    camera->smoothing = smoothing;
+}
+
+/* move the camera towards keeping a target of some width out of the deadzones */
+void camera_follow(struct Camera* camera, int x, int width) {
+    int left = camera->x + camera->deadzone;
+    int right = camera->x + SCREEN_WIDTH - width - camera->deadzone;
+
+    /* work out where the camera would need to be */
+    int goal = camera->x;
+    if (x < left) {
+        goal = x - camera->deadzone;
+    } else if (x > right) {
+        goal = x + width + camera->deadzone - SCREEN_WIDTH;
+    }
+
+    /* close part of the gap, but always at least a pixel */
+    int gap = goal - camera->x;
+    int step = gap >> camera->smoothing;
+    if (step == 0 && gap != 0) {
+        step = gap > 0 ? 1 : -1;
+    }
+    camera->x += step;
 }
 
 /* change the vertical flip flag */
@@ -584,6 +2445,15 @@ void sprite_set_horizontal_flip(struct Sprite* sprite, int horizontal_flip) {
     }
 }
 
+/* show or hide a sprite */
+void sprite_set_visible(struct Sprite* sprite, int visible) {
+    if (visible) {
+        sprite->attribute0 &= ~SPRITE_DISABLE;
+    } else {
+        sprite->attribute0 |= SPRITE_DISABLE;
+    }
+}
+
 /* change the tile offset of a sprite */
 void sprite_set_offset(struct Sprite* sprite, int offset) {
     /* clear the old offset */
@@ -593,13 +2463,301 @@ void sprite_set_offset(struct Sprite* sprite, int offset) {
     sprite->attribute2 |= (offset & 0x03ff);
 }
 
-/* setup the sprite image and palette */
+/* sprite image memory is split into slots which each hold one frame of
+ * animation, and frames are copied in from the sprite sheet in ROM only when
+ * a sprite starts showing them - a slot holds a 16x32 256 color frame */
+#define SPRITE_SLOTS 64
+#define SPRITE_SLOT_TILES 16
+#define SPRITE_SLOT_BYTES (SPRITE_SLOT_TILES * 32)
+#define SPRITE_SLOT_NONE 0xff
+#define SPRITE_SOURCE_NONE 0xffff
+
+/* the most bytes of sprite frames copied in one vblank, anything
+ * beyond this waits for the next one */
+#define SPRITE_UPLOAD_BUDGET 2048
+
+/* a slot of sprite image memory */
+struct SpriteSlot {
+    /* the tile offset of the frame in the sprite sheet */
+    unsigned short source;
+
+    /* how many sprites are using it, slots nobody uses keep their frame
+     * so it can be picked up again without another copy */
+    unsigned char refs;
+
+    /* whether the frame has been copied in yet, and whether it is waiting to be */
+    unsigned char ready;
+    unsigned char queued;
+};
+
+struct SpriteSlot sprite_slots[SPRITE_SLOTS];
+
+/* the slots waiting to be copied in during vblank */
+unsigned char sprite_upload_queue[SPRITE_SLOTS];
+int sprite_upload_head = 0;
+int sprite_upload_count = 0;
+
+/* where the search for a slot to reuse starts */
+int sprite_slot_clock = 0;
+
+/* bytes of sprite frames copied in the last vblank */
+int sprite_upload_bytes = 0;
+
+/* forget every frame in sprite image memory */
+void sprite_vram_reset() {
+    for (int i = 0; i < SPRITE_SLOTS; i++) {
+        sprite_slots[i].source = SPRITE_SOURCE_NONE;
+        sprite_slots[i].refs = 0;
+        sprite_slots[i].ready = 0;
+        sprite_slots[i].queued = 0;
+    }
+    sprite_upload_head = 0;
+    sprite_upload_count = 0;
+    sprite_slot_clock = 0;
+}
+
+/* get a slot holding the frame at a tile offset of the sprite sheet,
+ * returns SPRITE_SLOT_NONE if every slot is in use */
+int sprite_vram_acquire(int source) {
+    /* share the frame if it is already in memory */
+    for (int i = 0; i < SPRITE_SLOTS; i++) {
+        if (sprite_slots[i].source == source) {
+            sprite_slots[i].refs++;
+            return i;
+        }
+    }
+
+    /* otherwise take over a slot nobody is using, going round so the
+     * frames released longest ago get replaced first */
+    for (int n = 0; n < SPRITE_SLOTS; n++) {
+        int i = sprite_slot_clock;
+        sprite_slot_clock = (sprite_slot_clock + 1) % SPRITE_SLOTS;
+        if (sprite_slots[i].refs == 0) {
+            /* the queue is shared with the vblank interrupt */
+            unsigned short ime = *interrupt_enable;
+            *interrupt_enable = 0;
+
+            /* a copy of the frame it held could still be queued, which
+             * would mark it ready before the new one is copied */
+            dma_queue_cancel(&sprite_slots[i].ready);
+            sprite_slots[i].source = source;
+            sprite_slots[i].refs = 1;
+            sprite_slots[i].ready = 0;
+            if (!sprite_slots[i].queued) {
+                sprite_slots[i].queued = 1;
+                sprite_upload_queue[(sprite_upload_head + sprite_upload_count) % SPRITE_SLOTS] = i;
+                sprite_upload_count++;
+            }
+
+            *interrupt_enable = ime;
+            return i;
+        }
+    }
+    return SPRITE_SLOT_NONE;
+}
+
+/* stop using a slot, its frame stays around in case it's wanted again */
+void sprite_vram_release(int slot) {
+    if (slot != SPRITE_SLOT_NONE && sprite_slots[slot].refs > 0) {
+        sprite_slots[slot].refs--;
+    }
+}
+
+/* the tile offset in sprite image memory of a slot */
+int sprite_vram_tile(int slot) {
+    return slot * SPRITE_SLOT_TILES;
+}
+
+/* copy waiting frames into sprite image memory, up to a number of bytes
+ * this is called in vblank so the copies don't show up half done */
+void sprite_vram_flush(int budget) {
+    sprite_upload_bytes = 0;
+    while (sprite_upload_count > 0 && sprite_upload_bytes + SPRITE_SLOT_BYTES <= budget) {
+        int slot = sprite_upload_queue[sprite_upload_head];
+
+        /* the slot is marked ready when the copy has actually been made,
+         * if the DMA queue is full it waits here for the next vblank */
+        if (!dma_queue_push((unsigned short*) sprite_image_memory + slot * (SPRITE_SLOT_BYTES / 2),
+                (const unsigned short*) (gba_sprites_data + sprite_slots[slot].source * 32),
+                SPRITE_SLOT_BYTES / 2, DMA_PRIORITY_TILES, &sprite_slots[slot].ready)) {
+            break;
+        }
+        sprite_upload_head = (sprite_upload_head + 1) % SPRITE_SLOTS;
+        sprite_upload_count--;
+        sprite_slots[slot].queued = 0;
+        sprite_upload_bytes += SPRITE_SLOT_BYTES;
+    }
+}
+
+/* setup the sprite palette, the images are copied in as they are needed */
 void setup_sprite_image() {
     /* load the palette from the image into palette memory*/
-    memcpy16_dma((unsigned short*) sprite_palette, (unsigned short*) gba_sprites_palette, PALETTE_SIZE);
+    asset_load(ASSET_GBA_SPRITES_PALETTE, sprite_palette);
+
+    /* nothing is in sprite image memory yet */
+    sprite_vram_reset();
+}
+
+/* flags for an animation frame, the low bits are flips which are applied on
+ * top of whatever flip the sprite already has (so facing still works) and
+ * the top four bits are an event raised when the frame is shown */
+#define ANIM_HFLIP 0x1
+#define ANIM_VFLIP 0x2
+#define ANIM_EVENT_SHIFT 4
+#define ANIM_EVENT(event) ((event) << ANIM_EVENT_SHIFT)
+
+/* the events animation frames can raise */
+#define ANIM_EVENT_NONE 0
+#define ANIM_EVENT_DONE 1
+
+/* one frame of an animation clip */
+struct AnimFrame {
+    /* the tile offset of the image in sprite image memory */
+    unsigned short tile;
+
+    /* how many frames it is shown for, 0 holds it forever */
+    unsigned char duration;
+
+    /* flip and event bits */
+    unsigned char flags;
+};
+
+/* a clip is a run of frames which goes back to loop_to after the last */
+struct AnimClip {
+    const struct AnimFrame* frames;
+    unsigned char length;
+    unsigned char loop_to;
+};
+
+/* the playback state kept for each animated sprite */
+struct AnimPlayer {
+    /* the clip playing and the frame of it being shown */
+    const struct AnimClip* clip;
+    const struct AnimFrame* frame;
+    unsigned char index;
+
+    /* the sprite image slot on screen, and the one for the new
+     * frame while it waits to be copied in */
+    unsigned char slot;
+    unsigned char pending;
+
+    /* frames left before moving on */
+    unsigned char timer;
+
+    /* the event raised by the latest update, if any */
+    unsigned char event;
+};
+
+/* the animation clips, these all live in ROM */
+const struct AnimFrame samus_idle_frames[] = {{0, 0, 0}};
+const struct AnimFrame samus_walk_frames[] = {{16, 8, 0}, {32, 8, 0}};
+const struct AnimFrame samus_fall_frames[] = {{48, 0, 0}};
+const struct AnimFrame zeela_idle_frames[] = {{84, 0, 0}};
+const struct AnimFrame zombie_idle_frames[] = {{112, 0, 0}};
+const struct AnimFrame metroid_idle_frames[] = {{144, 0, 0}};
+const struct AnimFrame explosion_frames[] = {{128, 4, 0}, {128, 0, ANIM_EVENT(ANIM_EVENT_DONE)}};
+const struct AnimFrame projectile_frames[] = {{64, 0, 0}};
+
+const struct AnimClip samus_idle_clip = {samus_idle_frames, 1, 0};
+const struct AnimClip samus_walk_clip = {samus_walk_frames, 2, 0};
+const struct AnimClip samus_fall_clip = {samus_fall_frames, 1, 0};
+const struct AnimClip zeela_idle_clip = {zeela_idle_frames, 1, 0};
+const struct AnimClip zombie_idle_clip = {zombie_idle_frames, 1, 0};
+const struct AnimClip metroid_idle_clip = {metroid_idle_frames, 1, 0};
+const struct AnimClip explosion_clip = {explosion_frames, 2, 1};
+const struct AnimClip projectile_clip = {projectile_frames, 1, 0};
+
+/* set up a player with nothing showing yet */
+void anim_init(struct AnimPlayer* player) {
+    player->clip = 0;
+    player->frame = 0;
+    player->index = 0;
+    player->timer = 0;
+    player->event = ANIM_EVENT_NONE;
+    player->slot = SPRITE_SLOT_NONE;
+    player->pending = SPRITE_SLOT_NONE;
+}
+
+/* once the pending frame is in sprite image memory, switch the sprite to it */
+void anim_commit(struct AnimPlayer* player, struct Sprite* sprite) {
+    if (player->pending == SPRITE_SLOT_NONE || !sprite_slots[player->pending].ready) {
+        return;
+    }
+
+    /* the sprite is hidden until its first frame arrives */
+    if (player->slot == SPRITE_SLOT_NONE) {
+        sprite->attribute0 &= ~SPRITE_DISABLE;
+    }
+
+    sprite_vram_release(player->slot);
+    player->slot = player->pending;
+    player->pending = SPRITE_SLOT_NONE;
+    sprite_set_offset(sprite, sprite_vram_tile(player->slot));
+}
+
+/* show an animation frame on a sprite, only writing what changed */
+void anim_show(struct AnimPlayer* player, struct Sprite* sprite, const struct AnimFrame* frame) {
+    const struct AnimFrame* old = player->frame;
+    int old_flags = old ? old->flags : 0;
+
+    if (!old || old->tile != frame->tile) {
+        /* when memory is full keep showing the old frame */
+        int slot = sprite_vram_acquire(frame->tile);
+        if (slot != SPRITE_SLOT_NONE) {
+            /* a frame still waiting to be copied is no longer wanted */
+            sprite_vram_release(player->pending);
+            player->pending = slot;
+            if (player->slot == SPRITE_SLOT_NONE) {
+                sprite->attribute0 |= SPRITE_DISABLE;
+            }
+            anim_commit(player, sprite);
+        }
+    }
 
-    /* load the image into sprite image memory */
-    memcpy16_dma((unsigned short*) sprite_image_memory, (unsigned short*) gba_sprites_data, (gba_sprites_width * gba_sprites_height) / 2);
+    /* toggle the flip bits which differ from the last frame */
+    int flips = (old_flags ^ frame->flags) & (ANIM_HFLIP | ANIM_VFLIP);
+    if (flips) {
+        sprite->attribute1 ^= flips << 12;
+    }
+
+    player->frame = frame;
+    player->timer = frame->duration;
+    player->event = frame->flags >> ANIM_EVENT_SHIFT;
+}
+
+/* start playing a clip, returns 0 if it was already playing */
+int anim_play(struct AnimPlayer* player, struct Sprite* sprite, const struct AnimClip* clip) {
+    if (player->clip == clip) {
+        return 0;
+    }
+    player->clip = clip;
+    player->index = 0;
+    anim_show(player, sprite, &clip->frames[0]);
+    return 1;
+}
+
+/* stop animating and give back the sprite image memory */
+void anim_stop(struct AnimPlayer* player) {
+    sprite_vram_release(player->slot);
+    sprite_vram_release(player->pending);
+    anim_init(player);
+}
+
+/* advance an animation by one frame */
+void anim_update(struct AnimPlayer* player, struct Sprite* sprite) {
+    player->event = ANIM_EVENT_NONE;
+    anim_commit(player, sprite);
+
+    /* held frames and frames with time left don't change anything */
+    if (player->timer == 0 || --player->timer > 0) {
+        return;
+    }
+
+    player->index++;
+    if (player->index == player->clip->length) {
+        player->index = player->clip->loop_to;
+    }
+    anim_show(player, sprite, &player->clip->frames[player->index]);
 }
 
 /* a struct for Samus' logic and behavior */
@@ -616,28 +2774,43 @@ struct Samus {
     /* Samus' y acceleration in 1/256 pixels/second^2 */
     int gravity; 
 
-    /* which frame of the animation he is on */
-    int frame;
-
-    /* the number of frames to wait before flipping */
-    int animation_delay;
-
-    /* the animation counter counts how many frames until we flip */
-    int counter;
+    /* the animation being played */
+    struct AnimPlayer anim;
 
     /* whether Samus is moving right now or not */
     int move;
 
-    /* the number of pixels away from the edge of the screen Samus stays */
-    int border;
-
     /* if Samus is currently falling */
     int falling;
 
     /* if Samus is facing backwards or not */ 
     int facing;
+
+    /* frames left which she can't be hurt for, and of being pushed back by
+     * a hit at knockback pixels a frame */
+    int invulnerable;
+    int knockback_frames;
+    int knockback;
 };
 
+/* after a hit Samus blinks and can't be hurt again for a while */
+#define SAMUS_INVULNERABLE_FRAMES 90
+#define SAMUS_KNOCKBACK_FRAMES 10
+#define SAMUS_KNOCKBACK_SPEED 2
+#define SAMUS_KNOCKBACK_HOP -600
+
+/* how much attention an enemy gets depends on how far it is from the camera */
+#define ENEMY_ASLEEP 0
+#define ENEMY_NEARBY 1
+#define ENEMY_ACTIVE 2
+
+/* enemies within the active margin of the screen are updated every frame and
+ * can be hit, ones within the wake margin are updated every few frames so
+ * they are ready when they come into view, and the rest are left alone */
+#define ENEMY_ACTIVE_MARGIN 16
+#define ENEMY_WAKE_MARGIN 96
+#define ENEMY_NEARBY_RATE 4
+
 /* Struct for enemy */
 struct Enemy {
     struct Sprite* sprite;
@@ -645,36 +2818,146 @@ struct Enemy {
     int y;
     int height;
     int offset;
-    int frame;
     int alive;
-    int explosion;
+    struct AnimPlayer anim;
+
+    /* how close it is to the camera */
+    int activity;
+
+    /* whether this slot holds an enemy, and which spawn in the level it came from */
+    int used;
+    int spawn;
+
+    /* the row of the sprite which stands on the ground, 0 if it doesn't */
+    int feet;
+
+    /* its kind, what it is doing (one of the AI states), the frames until it
+     * stops waiting or fires again, and which way it is walking */
+    const struct EnemyType* type;
+    int state;
+    int timer;
+    int dir;
+
+    /* where it started, where it last saw Samus, and the frame it can next think on */
+    int home;
+    int target_x, target_y;
+    int think_frame;
+};
+
+/* the enemies which are around the camera right now, they come and go as
+ * the camera moves so this only needs to hold what fits around the screen */
+#define MAX_ENEMIES 16
+struct Enemy enemies[MAX_ENEMIES];
+
+/* the kinds of enemy */
+#define ENEMY_ZEELA 0
+#define ENEMY_ZOMBIE 1
+#define ENEMY_METROID 2
+
+/* how an enemy gets around and attacks */
+#define AI_WALKS 0x1
+#define AI_FLIES 0x2
+#define AI_FIRES 0x4
+
+/* the states of an enemy's behavior:
+ * patrol - walk back and forth up to patrol pixels either side of home
+ * wait - stand still for a while, then go back to patrolling
+ * chase - go after where Samus was last seen
+ * fire - stay put and shoot at where Samus was last seen
+ * enemies chase or fire when they see Samus, and wait when they lose her */
+#define AI_PATROL 0
+#define AI_WAIT 1
+#define AI_CHASE 2
+#define AI_FIRE 3
+
+/* what is the same for every enemy of a kind: the height and offset of
+ * the part which can be hit, what it looks like, the row of its sprite
+ * which stands on the ground (0 for ones on the ceiling or flying), and its
+ * behavior - how far it patrols, how far from home it chases, how far it
+ * sees, how long it waits and the frames between shots */
+struct EnemyType {
+    int height;
+    int offset;
+    const struct AnimClip* clip;
+    int feet;
+    int flags;
+    int patrol;
+    int leash;
+    int sight;
+    int wait;
+    int fire_rate;
+};
+
+const struct EnemyType enemy_types[] = {
+    {8, 0, &zeela_idle_clip, 0, AI_FIRES, 0, 0, 144, 60, 120},
+    {32, 0, &zombie_idle_clip, 25, AI_WALKS, 32, 64, 96, 60, 0},
+    {8, 8, &metroid_idle_clip, 0, AI_FLIES, 0, 48, 112, 30, 0}
+};
+
+/* one enemy placed in a level */
+struct Spawn {
+    short x;
+    short y;
+    unsigned char type;
+};
+
+/* a level lists its enemies in ROM sorted by x */
+struct Level {
+    const struct Spawn* spawns;
+    int spawn_count;
+};
+
+const struct Spawn level1_spawns[] = {
+    {144, 1, ENEMY_ZEELA},
+    {200, 119, ENEMY_ZOMBIE},
+    {225, 48, ENEMY_METROID},
+    {405, 1, ENEMY_ZEELA},
+    {460, 119, ENEMY_ZOMBIE},
+    {485, 48, ENEMY_METROID}
 };
 
+const struct Level level1 = {level1_spawns, sizeof(level1_spawns) / sizeof(level1_spawns[0])};
+
+/* counts the frames of game play, for spreading out updates */
+int game_frame = 0;
+
 /* struct for projectile */
 struct Projectile {
     struct Sprite* sprite;
     int x;
     int dx;
     int y;
-    int frame;
     int count;
     int alive;
+    struct AnimPlayer anim;
 };
 
 /* initialize enemy sprites */
-void enemy_init(struct Enemy* enemy, int x, int y, int height, int offset,  int frame) {
+void enemy_init(struct Enemy* enemy, int x, int y, int height, int offset, const struct AnimClip* clip) {
     enemy->x = x;
     enemy->y = y;
     enemy->height = height;
     enemy->offset = offset;
     enemy->alive = 1;
-    enemy->explosion = 3;
-    enemy->frame = frame;
-    enemy->sprite = sprite_init(enemy->x, enemy->y, SIZE_16_32, 0, 0, enemy->frame, 1);
+    enemy->activity = ENEMY_ACTIVE;
+    enemy->used = 1;
+    enemy->spawn = -1;
+    enemy->feet = 0;
+    enemy->type = 0;
+    enemy->state = AI_PATROL;
+    enemy->timer = 0;
+    enemy->dir = -1;
+    enemy->home = x;
+    enemy->target_x = x;
+    enemy->target_y = y;
+    enemy->think_frame = 0;
+    anim_init(&enemy->anim);
+    enemy->sprite = sprite_init(enemy->x, enemy->y, SIZE_16_32, 0, 0, 0, 1);
+    anim_play(&enemy->anim, enemy->sprite, clip);
 }
 
 /* initialize projectile sprite */
-void projectile_init(struct Projectile* projectile, struct Samus* samus, int frame) {
+void projectile_init(struct Projectile* projectile, struct Samus* samus, const struct AnimClip* clip) {
    
     if (samus->move) {
         if (samus->falling) {
@@ -692,8 +2975,16 @@ void projectile_init(struct Projectile* projectile, struct Samus* samus, int fra
         }
     }
 
-    projectile->frame = frame;
     projectile->alive = 1;
+
+    /* the sprite is created by the first shot */
+    if (projectile->count < 1) {
+        projectile->count++;
+        projectile->sprite = sprite_init(projectile->x, projectile->y, SIZE_16_32, 0, 0, 0, 0);
+        anim_init(&projectile->anim);
+    }
+    anim_play(&projectile->anim, projectile->sprite, clip);
+
     if (samus->facing) {
         projectile->x = samus->x - 8;
         projectile->dx = -4;
@@ -703,10 +2994,6 @@ void projectile_init(struct Projectile* projectile, struct Samus* samus, int fra
         projectile->dx = 4;
         sprite_set_horizontal_flip(projectile->sprite, 0);
     }
-    if (projectile->count < 1) {
-        projectile->count++;
-        projectile->sprite = sprite_init(projectile->x, projectile->y, SIZE_16_32, 0, 0, projectile->frame, 0);
-    }
 }
 
 /* initialize Samus */
@@ -715,18 +3002,24 @@ void samus_init(struct Samus* samus) {
     samus->y = 113;
     samus->yvel = 0;
     samus->gravity = 30;
-    samus->border = 40;
-    samus->frame = 0;
     samus->move = 0;
-    samus->counter = 0;
     samus->falling = 0;
     samus->facing = 0;
-    samus->animation_delay = 8;
-    samus->sprite = sprite_init(samus->x, samus->y, SIZE_16_32, 0, 0, samus->frame, 0);
+    samus->invulnerable = 0;
+    samus->knockback_frames = 0;
+    samus->knockback = 0;
+    anim_init(&samus->anim);
+    samus->sprite = sprite_init(samus->x, samus->y, SIZE_16_32, 0, 0, 0, 0);
+    anim_play(&samus->anim, samus->sprite, &samus_idle_clip);
 }
 
-/* move Samus left or right returns if it is at edge of the screen */
-int samus_left(struct Samus* samus) {
+/* move Samus left or right, the camera follows her
+ * she can't steer while she is being knocked back */
+void samus_left(struct Samus* samus) {
+    if (samus->knockback_frames) {
+        return;
+    }
+
     /* face left */
     sprite_set_horizontal_flip(samus->sprite, 1);
     samus->move = 1;
@@ -734,44 +3027,27 @@ int samus_left(struct Samus* samus) {
     /* to flip projectile */
     samus->facing = 1;
 
-    /* if we are at the left end, just scroll the screen */
-    if (samus->x < samus->border) {
-        return 1;
-    } else {
-        /* else move left */
-        samus->x--;
-        return 0;
-    }
+    samus->x--;
 }
 
-int samus_right(struct Samus* samus) {
+void samus_right(struct Samus* samus) {
+    if (samus->knockback_frames) {
+        return;
+    }
+
     /* face right */
     sprite_set_horizontal_flip(samus->sprite, 0);
     samus->move = 1;
 
     /* to flip projectile */
     samus->facing = 0;
-
-    /* if we are at the right end, just scroll the screen */
-    if (samus->x > (SCREEN_WIDTH - 16 - samus->border)) {
-        return 1;
-    } else {
-        /* else move right */
-        samus->x++;
-        return 0;
-    }
+
+    samus->x++;
 }
 
 /* stop Samus from walking left/right */
 void samus_stop(struct Samus* samus) {
     samus->move = 0;
-    if (samus->falling) {
-        samus->frame = 48;
-    } else {
-        samus->frame = 0;
-    }
-    samus->counter = 7;
-    sprite_set_offset(samus->sprite, samus->frame);
 }
 
 /* start Samus jumping, unless already falling */
@@ -779,71 +3055,42 @@ void samus_jump(struct Samus* samus) {
     if (!samus->falling) {
         samus->yvel = -1000;
         samus->falling = 1;
-        samus->frame = 48;
-        sprite_set_offset(samus->sprite, samus->frame);
     }
 }
 
-/* finds which tile a screen coordinate maps to, taking scroll into acco  unt */
-unsigned short tile_lookup(int x, int y, int xscroll, int yscroll,
-        const unsigned short* tilemap, int tilemap_w, int tilemap_h) {
-
-    /* adjust for the scroll */
-    x += xscroll;
-    y += yscroll;
-
-    /* convert from screen coordinates to tile coordinates */
-    x >>= 3;
-    y >>= 3;
-
-    /* account for wraparound */
-    while (x >= tilemap_w) {
-        x -= tilemap_w;
-    }
-    while (y >= tilemap_h) {
-        y -= tilemap_h;
-    }
-    while (x < 0) {
-        x += tilemap_w;
-    }
-    while (y < 0) {
-        y += tilemap_h;
+/* take a life from Samus for being touched by something at x, which pushes
+ * her away from it with a small hop */
+void samus_hurt(struct Samus* samus, int x) {
+    if (samus->invulnerable) {
+        return;
     }
 
-    /* the larger screen maps (bigger than 32x32) are made of multiple stitched
-       together - the offset is used for finding which screen block we are in
-       for these cases */
-    int offset = 0;
+    currentLife--;
+    samus->invulnerable = SAMUS_INVULNERABLE_FRAMES;
+    samus->knockback_frames = SAMUS_KNOCKBACK_FRAMES;
+    samus->knockback = x < samus->x + 8 ? SAMUS_KNOCKBACK_SPEED : -SAMUS_KNOCKBACK_SPEED;
+    samus->yvel = SAMUS_KNOCKBACK_HOP;
+    samus->falling = 1;
+    sfx_request(&hurt_sound, sound_pan(samus->x - camera.x));
+}
 
-    /* if the width is 64, add 0x400 offset to get to tile maps on right   */
-    if (tilemap_w == 64 && x >= 32) {
-        x -= 32;
-        offset += 0x400;
-    }
+/* the bottom row of Samus' sprite is empty, so the row above it stands on the ground */
+#define SAMUS_FEET 31
 
-    /* if height is 64 and were down there */
-    if (tilemap_h == 64 && y >= 32) {
-        y -= 32;
+/* update Samus */
+void samus_update(struct Samus* samus) {
+    int from = samus->y + SAMUS_FEET;
 
-        /*call the assembly function for the code that is commented out below*/
-        offset= calc_offset(offset, tilemap_w);
-        /* if width is also 64 add 0x800, else just 0x400 */
-       /* if (tilemap_w == 64) {
-            offset += 0x800;
-        } else {
-            offset += 0x400;
-        }*/
+    /* get pushed back from a hit, and blink while she can't be hurt */
+    if (samus->knockback_frames) {
+        samus->knockback_frames--;
+        samus->x += samus->knockback;
+    }
+    if (samus->invulnerable) {
+        samus->invulnerable--;
+        sprite_set_visible(samus->sprite, !(samus->invulnerable & 4));
     }
 
-    /* find the index in this tile map */
-    int index = y * 32 + x;
-
-    /* return the tile */
-    return tilemap[index + offset];
-}
-
-/* update Samus */
-void samus_update(struct Samus* samus, int xscroll) {
     /* update y position and speed if falling */
     if (samus->falling) {
        
@@ -855,86 +3102,125 @@ void samus_update(struct Samus* samus, int xscroll) {
 
         samus->yvel += samus->gravity;
     }
-    /* check which tile Samus' feet are over */
-    unsigned short tile = tile_lookup(samus->x + 8, samus->y + 32, xscroll, 0, map1,
-            map1_width, map1_height);
-
-    /* if it's block tile
-     * these numbers refer to the tile indices of the blocks the koopa can walk on */
-    
-    if ((tile >= 540 && tile <= 551) || (tile >= 556 && tile <= 569)) {
-        /* stop the fall! */
-        if(samus->falling) {
-            samus->falling = 0;
-        }
-        samus->yvel = 0;
-        
-
-        /* make her line up with the top of a block works by clearing out the lower bits to 0 */
-        samus->y &= ~0x3;
 
-        /* move her down one because there is a one pixel gap in the image */
-        samus->y++;
+    /* she can only land while coming down, and when she is already on the
+     * ground she follows it down slopes rather than falling off them */
+    int feet = samus->y + SAMUS_FEET;
+    int ground = NO_GROUND;
+    if (samus->yvel >= 0) {
+        ground = ground_find(&level_map, samus->x + 8, feet, from);
+    }
 
+    if (ground != NO_GROUND && (feet >= ground || !samus->falling)) {
+        /* stop the fall and stand on the ground */
+        samus->falling = 0;
+        samus->yvel = 0;
+        samus->y = ground - SAMUS_FEET;
     } else {
         /* she is falling now */
         samus->falling = 1;        
     }
 
-    /* update animation if moving */
-    
-    if (samus->move) {
-        samus->counter++;
-        if (samus->falling) {
-            samus->frame = 48;
-
-        } else if (samus->counter >= samus->animation_delay) {
-            samus->frame = samus->frame + 16;
-            if (samus->frame > 32) {
-                samus->frame = 16;
-            }
-            sprite_set_offset(samus->sprite, samus->frame);
-            samus->counter = 0;
-        }
-        if (!samus->falling) {
-            samus->y++;
-        }
-        
-    } else if(!samus->falling) {
-        samus->y--;
-    }
-
     /* set on screen position */
     sprite_position(samus->sprite, samus->x, samus->y);
 }
 
-void samus_falling(struct Samus* samus) {
+/* pick Samus' animation for what she is doing and advance it */
+void samus_animate(struct Samus* samus) {
+    const struct AnimClip* clip;
     if (samus->falling) {
-        samus->frame = 48;
-        sprite_set_offset(samus->sprite, samus->frame);
+        clip = &samus_fall_clip;
+    } else if (samus->move) {
+        clip = &samus_walk_clip;
+    } else {
+        clip = &samus_idle_clip;
+    }
+
+    if (!anim_play(&samus->anim, samus->sprite, clip)) {
+        anim_update(&samus->anim, samus->sprite);
     }
 }
 
-void enemy_move(struct Enemy* enemy1, struct Enemy* enemy2, struct Enemy* enemy3, struct Enemy* enemy4,
-        struct Enemy* enemy5, struct Enemy* enemy6, int xscroll) {
-    enemy1->x += xscroll;
-    sprite_position(enemy1->sprite, enemy1->x, enemy1->y);
-    
-    enemy2->x += xscroll;
-    sprite_position(enemy2->sprite, enemy2->x, enemy2->y);
+/* shots fired by enemies fly in a straight line until they hit Samus or
+ * something solid, or leave the screen */
+#define MAX_ENEMY_SHOTS 4
+
+/* how fast they fly in 1/256 pixels a frame */
+#define ENEMY_SHOT_SPEED 512
+
+struct EnemyShot {
+    struct Sprite* sprite;
+
+    /* the position and speed in 1/256 pixels */
+    int x, y;
+    int xvel, yvel;
+    int alive;
+    struct AnimPlayer anim;
+};
+
+struct EnemyShot enemy_shots[MAX_ENEMY_SHOTS];
+
+/* fire a shot from (x, y) towards (target_x, target_y), if there is a free one */
+void enemy_shot_fire(int x, int y, int target_x, int target_y) {
+    int dx = target_x - x;
+    int dy = target_y - y;
+    int distance = dx < 0 ? -dx : dx;
+    if (dy > distance || -dy > distance) {
+        distance = dy < 0 ? -dy : dy;
+    }
+    if (!distance) {
+        return;
+    }
 
-    enemy3->x += xscroll;
-    sprite_position(enemy3->sprite, enemy3->x, enemy3->y);
+    for (int i = 0; i < MAX_ENEMY_SHOTS; i++) {
+        struct EnemyShot* shot = &enemy_shots[i];
+        if (shot->alive) {
+            continue;
+        }
+
+        /* the shot image sits in the middle of its sprite */
+        shot->x = (x - 6) << 8;
+        shot->y = (y - 14) << 8;
+        shot->xvel = dx * ENEMY_SHOT_SPEED / distance;
+        shot->yvel = dy * ENEMY_SHOT_SPEED / distance;
+        shot->alive = 1;
+        shot->sprite = sprite_init(shot->x >> 8, shot->y >> 8, SIZE_16_32, 0, 0, 0, 1);
+        anim_init(&shot->anim);
+        anim_play(&shot->anim, shot->sprite, &projectile_clip);
+        sfx_request(&shot_sound, sound_pan(x - camera.x));
+        return;
+    }
+}
+
+/* take a shot out of the game */
+void enemy_shot_clear(struct EnemyShot* shot) {
+    anim_stop(&shot->anim);
+    sprite_free(shot->sprite);
+    shot->alive = 0;
+}
 
-    enemy4->x += xscroll;
-    sprite_position(enemy4->sprite, enemy4->x, enemy4->y);
+/* move the enemy shots, they stop at anything solid or the edge of the screen */
+void enemy_shots_update() {
+    for (int i = 0; i < MAX_ENEMY_SHOTS; i++) {
+        struct EnemyShot* shot = &enemy_shots[i];
+        if (!shot->alive) {
+            continue;
+        }
 
-    enemy5->x += xscroll;
-    sprite_position(enemy5->sprite, enemy5->x, enemy5->y);
+        shot->x += shot->xvel;
+        shot->y += shot->yvel;
+        int x = shot->x >> 8;
+        int y = shot->y >> 8;
 
-    enemy6->x += xscroll;
-    sprite_position(enemy6->sprite, enemy6->x, enemy6->y);
-} 
+        if (x + 16 <= camera.x || x >= camera.x + SCREEN_WIDTH || y + 32 <= camera.y ||
+                y >= camera.y + SCREEN_HEIGHT || metatile_solid(&level_map, x + 6, y + 14)) {
+            enemy_shot_clear(shot);
+        } else {
+            anim_update(&shot->anim, shot->sprite);
+            sprite_position(shot->sprite, x, y);
+        }
+    }
+}
 
 void clear_projectile(struct Projectile* projectile) {
         projectile->x = 125;
@@ -944,43 +3230,177 @@ void clear_projectile(struct Projectile* projectile) {
         projectile->dx = 0; 
 }
 
-int enemy_hit(struct Projectile* projectile, struct Enemy* enemy) {
-    
-    if (projectile->x >= enemy->x && projectile->x <= enemy->x + 8) {
-        if (projectile->y + 16 >= enemy->y + enemy->offset && projectile->y <= enemy->y + enemy->offset + enemy->height){  
-            clear_projectile(projectile);
-            enemy->frame = 128;
-            enemy->alive = 0;
-            sprite_set_offset(enemy->sprite, enemy->frame);
-            play_sound(explosion_16K_mono, explosion_16K_mono_bytes, 16000, 'B');
-            return 1;
+void projectile_update(struct Projectile* projectile) {
+
+    /* the sprite only exists after the first shot */
+    if (projectile->count) {
+        anim_update(&projectile->anim, projectile->sprite);
+    }
+
+    if (projectile->alive && (projectile->x - camera.x + 12 <= 4 || projectile->x - camera.x >= SCREEN_WIDTH - 3)) {
+        /* it has gone off the edge of the screen */
+        clear_projectile(projectile);
+
+    } else if (projectile->alive) {
+        projectile->x += projectile->dx;
+        sprite_position(projectile->sprite, projectile->x, projectile->y);
+    }   
+}
+
+/* the layers a box can be on, each box also has a mask of the layers it can
+ * touch, so a pair is only tested when each is on a layer the other touches */
+#define LAYER_PLAYER 0x1
+#define LAYER_ENEMY 0x2
+#define LAYER_PLAYER_SHOT 0x4
+#define LAYER_ENEMY_SHOT 0x8
+#define LAYER_PICKUP 0x10
+
+#define MASK_PLAYER (LAYER_ENEMY | LAYER_ENEMY_SHOT | LAYER_PICKUP)
+#define MASK_ENEMY (LAYER_PLAYER | LAYER_PLAYER_SHOT)
+#define MASK_PLAYER_SHOT LAYER_ENEMY
+#define MASK_ENEMY_SHOT LAYER_PLAYER
+#define MASK_PICKUP LAYER_PLAYER
+
+/* a box which can touch other boxes, made fresh each frame from what is in
+ * the game - the edges are inclusive, so a box of width 0 is a line
+ * when two boxes touch, each one's hit function is called with the other,
+ * and a box which is taken out of the game sets its layer to 0 */
+struct Hitbox {
+    int x, y;
+    int width, height;
+    unsigned char layer;
+    unsigned char mask;
+    void* owner;
+    void (*hit)(struct Hitbox* box, struct Hitbox* other);
+};
+
+/* Samus, her shot and every enemy, with room for more shots and pickups */
+#define MAX_HITBOXES (MAX_ENEMIES + 8)
+struct Hitbox hitboxes[MAX_HITBOXES];
+int hitbox_count = 0;
+
+/* how many pairs were near each other last frame, and how many of them were box tested */
+int hitbox_pairs = 0;
+int hitbox_tests = 0;
+
+/* put a box in for this frame */
+void hitbox_add(int layer, int mask, int x, int y, int width, int height, void* owner,
+        void (*hit)(struct Hitbox* box, struct Hitbox* other)) {
+    if (hitbox_count == MAX_HITBOXES) {
+        return;
+    }
+
+    /* keep them sorted by left edge, they are nearly in order already */
+    int i = hitbox_count++;
+    while (i > 0 && hitboxes[i - 1].x > x) {
+        hitboxes[i] = hitboxes[i - 1];
+        i--;
+    }
+
+    struct Hitbox* box = &hitboxes[i];
+    box->x = x;
+    box->y = y;
+    box->width = width;
+    box->height = height;
+    box->layer = layer;
+    box->mask = mask;
+    box->owner = owner;
+    box->hit = hit;
+}
+
+/* find every pair of boxes which touch in one sweep along x: the boxes are
+ * sorted by their left edge, so the boxes which can reach a box are the ones
+ * after it which start before it ends - of those, only pairs on layers which
+ * want each other are tested on y */
+void hitbox_resolve() {
+    hitbox_pairs = 0;
+    hitbox_tests = 0;
+
+    for (int i = 0; i < hitbox_count; i++) {
+        struct Hitbox* a = &hitboxes[i];
+
+        for (int j = i + 1; j < hitbox_count && hitboxes[j].x <= a->x + a->width; j++) {
+            struct Hitbox* b = &hitboxes[j];
+            hitbox_pairs++;
+
+            if (!(a->mask & b->layer) || !(b->mask & a->layer)) {
+                continue;
+            }
+            hitbox_tests++;
+
+            if (a->y <= b->y + b->height && b->y <= a->y + a->height) {
+                a->hit(a, b);
+                b->hit(b, a);
+            }
         }
     }
-    return 0;
 }
 
-void projectile_update(struct Projectile* projectile, struct Samus* samus, struct Enemy* enemy1, struct Enemy* enemy2, struct Enemy* enemy3,
-        struct Enemy* enemy4, struct Enemy* enemy5, struct Enemy* enemy6) {
-    
-    if (enemy_hit(projectile, enemy1)) {
+/* Samus is hurt by enemies and their shots */
+void samus_hit(struct Hitbox* box, struct Hitbox* other) {
+    if (other->layer & (LAYER_ENEMY | LAYER_ENEMY_SHOT)) {
+        samus_hurt(box->owner, other->x + other->width / 2);
+        box->layer = 0;
+    }
+}
 
-    } else if (enemy_hit(projectile, enemy2)) {
+/* an enemy is killed by Samus' shot */
+void enemy_hit(struct Hitbox* box, struct Hitbox* other) {
+    struct Enemy* enemy = box->owner;
 
-    } else if (enemy_hit(projectile, enemy3)) {
+    if (other->layer & LAYER_PLAYER_SHOT) {
+        enemy->alive = 0;
+        anim_play(&enemy->anim, enemy->sprite, &explosion_clip);
+        sfx_request(&hit_sound, sound_pan(enemy->x - camera.x));
+        box->layer = 0;
+    }
+}
 
-    } else if (enemy_hit(projectile, enemy4)) {
-    
-    } else if (enemy_hit(projectile, enemy5)) {
+/* a shot is used up by the first thing it hits */
+void projectile_hit(struct Hitbox* box, struct Hitbox* other) {
+    (void) other;
+    clear_projectile(box->owner);
+    box->layer = 0;
+}
 
-    } else if (enemy_hit(projectile, enemy6)) {
+void enemy_shot_hit(struct Hitbox* box, struct Hitbox* other) {
+    (void) other;
+    enemy_shot_clear(box->owner);
+    box->layer = 0;
+}
 
-    } else if (projectile->x + 12 >= 0 && projectile->x + 12 <= 4 || projectile->x <= SCREEN_WIDTH && projectile->x >= SCREEN_WIDTH - 3) {
-        clear_projectile(projectile);
+/* check everything which can touch this frame
+ * Samus can't be touched while she is blinking, and only live enemies
+ * around the screen can touch or be hit */
+void collide_all(struct Samus* samus, struct Projectile* projectile) {
+    hitbox_count = 0;
 
-    } else if (projectile->alive) {
-        projectile->x += projectile->dx;
-        sprite_position(projectile->sprite, projectile->x, projectile->y);
-    }   
+    /* the level hurts her too, where she is or where she is standing */
+    int hit_x;
+    if (!samus->invulnerable && metatile_damage(&level_map, samus->x + 4, samus->y + 4, 8, SAMUS_FEET - 3, &hit_x)) {
+        samus_hurt(samus, hit_x);
+    }
+
+    if (!samus->invulnerable) {
+        hitbox_add(LAYER_PLAYER, MASK_PLAYER, samus->x + 4, samus->y + 4, 8, SAMUS_FEET - 4, samus, samus_hit);
+    }
+    if (projectile->alive) {
+        hitbox_add(LAYER_PLAYER_SHOT, MASK_PLAYER_SHOT, projectile->x, projectile->y, 0, 16, projectile, projectile_hit);
+    }
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        struct Enemy* enemy = &enemies[i];
+        if (enemy->used && enemy->alive && enemy->activity == ENEMY_ACTIVE) {
+            hitbox_add(LAYER_ENEMY, MASK_ENEMY, enemy->x, enemy->y + enemy->offset, 8, enemy->height, enemy, enemy_hit);
+        }
+    }
+    for (int i = 0; i < MAX_ENEMY_SHOTS; i++) {
+        struct EnemyShot* shot = &enemy_shots[i];
+        if (shot->alive) {
+            hitbox_add(LAYER_ENEMY_SHOT, MASK_ENEMY_SHOT, (shot->x >> 8) + 3, (shot->y >> 8) + 13, 6, 3, shot, enemy_shot_hit);
+        }
+    }
+
+    hitbox_resolve();
 }
 
 /* Once the Number of Enemies or Number of Lives get to 0, game is over */
@@ -995,6 +3415,10 @@ int isThereAWinner (){
 	    playerWon = 1;
 	    return 1;
 	}
+	else if (currentLife <= 0){
+	    playerWon = 0;
+	    return 1;
+	}
 	return 0; 
 }
 
@@ -1010,76 +3434,439 @@ void updateHitsandLives(){
 	set_text(msg, 0,0);
 }
 
+/* the level being played and which of its spawns are in the game */
+const struct Level* level;
+
+/* the spawns between the two cursors have been reached by the camera */
+int spawn_left = 0;
+int spawn_right = 0;
+
+/* which enemy slot each spawn is using, and the spawns which have been killed */
+#define MAX_SPAWNS 64
+signed char spawn_enemy[MAX_SPAWNS];
+unsigned char spawn_killed[MAX_SPAWNS];
+
+/* how many of the level's spawns are used, a level with more than MAX_SPAWNS
+ * only gets the first ones */
+int spawn_count = 0;
+
+/* take an enemy out of the game, giving back its slot and sprite */
+void enemy_release(struct Enemy* enemy) {
+    if (enemy->spawn >= 0) {
+        spawn_enemy[enemy->spawn] = -1;
+    }
+    anim_stop(&enemy->anim);
+    sprite_free(enemy->sprite);
+    enemy->used = 0;
+}
+
+/* take a dead enemy out of the game for good */
 void enemy_kill(struct Enemy* enemy) {
-    if (enemy->explosion == 0){
-        enemy->x = 115;
-        enemy->y = -95;
-        sprite_position(enemy->sprite, enemy->x, enemy->y);
-        numEnemies--;
-        enemy->explosion = 3;
-        enemy->alive = 1;
-        return;
+    if (enemy->spawn >= 0) {
+        spawn_killed[enemy->spawn] = 1;
+    }
+    enemy_release(enemy);
+    numEnemies--;
+}
+
+/* keep an enemy which walks standing on the ground, following slopes up and
+ * down and falling a tile at a time if there is none */
+void enemy_ground(struct Enemy* enemy) {
+    int feet = enemy->y + enemy->feet;
+    int ground = ground_find(&level_map, enemy->x + 8, feet, feet);
+
+    if (ground == NO_GROUND) {
+        enemy->y += 8;
+    } else {
+        enemy->y = ground - enemy->feet;
     }
-    enemy->explosion--;
+    sprite_position(enemy->sprite, enemy->x, enemy->y);
 }
 
-void remove_enemies(struct Enemy* enemy1, struct Enemy* enemy2, struct Enemy* enemy3,
-        struct Enemy* enemy4, struct Enemy* enemy5, struct Enemy* enemy6) {
+/* deciding what to do (picking a target and checking it can be seen) is the
+ * slow part of the AI, so enemies take turns thinking: each frame the ones
+ * which are due think in turn, starting from the first one left out last
+ * frame, until the frame's cycle budget is spent
+ * the costs are estimates added up as the work is planned rather than timed,
+ * so the same enemies think on the same frames every time the game is played */
+#define AI_THINK_CYCLES 300
+#define AI_SIGHT_TILE_CYCLES 40
+#define AI_SIGHT_CACHED_CYCLES 40
+
+/* an enemy thinks at most this often, in between it keeps doing what it decided */
+#define AI_THINK_INTERVAL 8
+
+/* the cycles the AI may spend thinking each frame */
+int ai_cycle_budget = 2400;
+
+/* the cycles left for the first enemy to think each frame, which is never made to wait */
+#define AI_NO_LIMIT 0x7fffffff
+
+/* the cycles spent thinking last frame, how many enemies thought, and how many had to wait */
+int ai_cycles = 0;
+int ai_thinks = 0;
+int ai_deferred = 0;
+
+/* the enemy slot the next frame's thinking starts from */
+int ai_next = 0;
+
+/* decide what an enemy does about Samus, if it can be done in the cycles
+ * left, returning the cycles it took or -1 if it has to wait */
+int ai_think(struct Enemy* enemy, struct Samus* samus, int cycles_left) {
+    const struct EnemyType* type = enemy->type;
+    int eye_x = enemy->x + 8;
+    int eye_y = enemy->y + enemy->offset + enemy->height / 2;
+    int target_x = samus->x + 8;
+    int target_y = samus->y + 16;
+    int dx = target_x - eye_x;
+    int dy = target_y - eye_y;
+    int distance = dx < 0 ? -dx : dx;
+    if (dy > distance || -dy > distance) {
+        distance = dy < 0 ? -dy : dy;
+    }
+
+    /* she is only a target in range, and walkers only go after her on their own level */
+    int target = distance <= type->sight && (!(type->flags & AI_WALKS) || (dy < 32 && dy > -32));
+    if ((type->flags & AI_FIRES) && !ranged_ai_enabled) {
+        target = 0;
+    }
+    /* a ray costs a step for each tile it crosses, unless the answer is cached */
+    int cycles = AI_THINK_CYCLES;
+    if (target && sight_cached(eye_x, eye_y, target_x, target_y)) {
+        cycles += AI_SIGHT_CACHED_CYCLES;
+    } else if (target) {
+        int tiles_x = (target_x >> 3) - (eye_x >> 3);
+        int tiles_y = (target_y >> 3) - (eye_y >> 3);
+        cycles += ((tiles_x < 0 ? -tiles_x : tiles_x) + (tiles_y < 0 ? -tiles_y : tiles_y)) * AI_SIGHT_TILE_CYCLES;
+    }
+    if (cycles > cycles_left) {
+        return -1;
+    }
 
-    if (!enemy1->alive) {
-        enemy_kill(enemy1);
+    if (target && line_of_sight(eye_x, eye_y, target_x, target_y)) {
+        enemy->target_x = target_x;
+        enemy->target_y = target_y;
+        if (type->flags & AI_FIRES) {
+            if (enemy->state != AI_FIRE) {
+                enemy->state = AI_FIRE;
+                enemy->timer = type->fire_rate / 2;
+            }
+        } else {
+            enemy->state = AI_CHASE;
+        }
+    } else if (enemy->state == AI_CHASE || enemy->state == AI_FIRE) {
+        enemy->state = AI_WAIT;
+        enemy->timer = type->wait;
+    }
+    return cycles;
+}
 
-    } else if (!enemy2->alive) {
-        enemy_kill(enemy2);
+/* let the enemies around the screen which are due think, within the budget */
+void ai_update(struct Samus* samus) {
+    int next = ai_next;
+    ai_cycles = 0;
+    ai_thinks = 0;
+    ai_deferred = 0;
+
+    for (int n = 0; n < MAX_ENEMIES; n++) {
+        int i = (ai_next + n) % MAX_ENEMIES;
+        struct Enemy* enemy = &enemies[i];
+        if (!enemy->used || !enemy->alive || !enemy->type || enemy->activity != ENEMY_ACTIVE ||
+                game_frame < enemy->think_frame) {
+            continue;
+        }
 
-    } else if (!enemy3->alive) {
-        enemy_kill(enemy3);
+        /* the first one always gets to think, so one slow enemy can't hold the rest up forever */
+        int cycles = ai_think(enemy, samus, ai_thinks ? ai_cycle_budget - ai_cycles : AI_NO_LIMIT);
+        if (cycles < 0) {
+            if (!ai_deferred++) {
+                next = i;
+            }
+            continue;
+        }
 
-    } else if (!enemy4->alive) {
-        enemy_kill(enemy4);
+        ai_cycles += cycles;
+        ai_thinks++;
+        enemy->think_frame = game_frame + AI_THINK_INTERVAL;
+        if (!ai_deferred) {
+            next = i + 1;
+        }
+    }
+    ai_next = next % MAX_ENEMIES;
+}
 
-    } else if (!enemy5->alive) {
-        enemy_kill(enemy5);
+/* take a step along the ground, unless it ends in a wall or off an edge */
+int enemy_walk(struct Enemy* enemy, int dir) {
+    int feet = enemy->y + enemy->feet;
+    int ground = ground_find(&level_map, enemy->x + 8 + dir * 6, feet, feet);
 
-    } else if (!enemy6->alive) {
-        enemy_kill(enemy6);
+    if (ground == NO_GROUND || ground < feet - 4 || ground > feet + 8) {
+        return 0;
     }
+    enemy->x += dir;
+    sprite_set_horizontal_flip(enemy->sprite, dir > 0);
+    return 1;
 }
 
-void on_vblank() {
-    /* disable interrupts for now and save current state of interrupt */
-    *interrupt_enable = 0;
-    unsigned short temp = *interrupt_state;
+/* fly a pixel towards a point, one axis at a time so it slides along walls */
+void enemy_fly(struct Enemy* enemy, int x, int y) {
+    int dx = x > enemy->x + 8 ? 1 : x < enemy->x + 8 ? -1 : 0;
+    int dy = y > enemy->y + enemy->offset ? 1 : y < enemy->y + enemy->offset ? -1 : 0;
+    int middle = enemy->y + enemy->offset + enemy->height / 2;
 
-    /* look for vertical refresh */
-    if ((*interrupt_state & INTERRUPT_VBLANK) == INTERRUPT_VBLANK) {
-        
-        /* update channel A */
-        if (channel_a_vblanks_remaining == 0) {
-            /* restart the sound again when it runs out */
-            channel_a_vblanks_remaining = channel_a_total_vblanks;
-            *dma1_control = 0;
-            *dma1_source = (unsigned int) mus_main_16K_mono;
-            *dma1_control = DMA_DEST_FIXED | DMA_REPEAT | DMA_32 |
-                DMA_SYNC_TO_TIMER | DMA_ENABLE;
-        } else {
-            channel_a_vblanks_remaining--;
+    if (dx && !metatile_solid(&level_map, enemy->x + 8 + dx * 8, middle)) {
+        enemy->x += dx;
+    }
+    if (dy && !metatile_solid(&level_map, enemy->x + 8, middle + dy * 8)) {
+        enemy->y += dy;
+    }
+}
+
+/* carry on with what the enemy decided to do, this runs every frame */
+void enemy_act(struct Enemy* enemy) {
+    const struct EnemyType* type = enemy->type;
+
+    switch (enemy->state) {
+        case AI_PATROL: {
+            /* walkers patrol at half speed */
+            if (!type->patrol || (game_frame & 1)) {
+                break;
+            }
+            int next = enemy->x + enemy->dir;
+            if (next < enemy->home - type->patrol || next > enemy->home + type->patrol ||
+                    !enemy_walk(enemy, enemy->dir)) {
+                enemy->state = AI_WAIT;
+                enemy->timer = type->wait;
+                enemy->dir = -enemy->dir;
+            }
+            break;
+        }
+
+        case AI_WAIT:
+            if (enemy->timer) {
+                enemy->timer--;
+            } else {
+                enemy->state = AI_PATROL;
+            }
+            break;
+
+        case AI_CHASE: {
+            /* they don't follow her further than their leash from home */
+            int target_x = enemy->target_x;
+            if (target_x < enemy->home + 8 - type->leash) {
+                target_x = enemy->home + 8 - type->leash;
+            } else if (target_x > enemy->home + 8 + type->leash) {
+                target_x = enemy->home + 8 + type->leash;
+            }
+
+            if (type->flags & AI_WALKS) {
+                int dir = target_x > enemy->x + 8 ? 1 : -1;
+                if (target_x != enemy->x + 8) {
+                    enemy_walk(enemy, dir);
+                }
+                enemy->dir = dir;
+            } else if (!(game_frame & 1)) {
+                enemy_fly(enemy, target_x, enemy->target_y);
+            }
+            break;
+        }
+
+        case AI_FIRE:
+            if (enemy->timer) {
+                enemy->timer--;
+            } else {
+                enemy_shot_fire(enemy->x + 8, enemy->y + enemy->offset + enemy->height,
+                        enemy->target_x, enemy->target_y);
+                enemy->timer = type->fire_rate;
+            }
+            break;
+    }
+    sprite_position(enemy->sprite, enemy->x, enemy->y);
+}
+
+/* advance an enemy's animation, and take it away once its explosion is done
+ * only the enemies around the screen act on what they decided */
+void enemy_update(struct Enemy* enemy) {
+    if (enemy->alive && enemy->type && enemy->activity == ENEMY_ACTIVE) {
+        enemy_act(enemy);
+    }
+    if (enemy->alive && enemy->feet) {
+        enemy_ground(enemy);
+    }
+    anim_update(&enemy->anim, enemy->sprite);
+    if (!enemy->alive && enemy->anim.event == ANIM_EVENT_DONE) {
+        enemy_kill(enemy);
+    }
+}
+
+/* work out how close an enemy is to what the camera sees */
+int enemy_activity(struct Enemy* enemy) {
+    int left = enemy->x - camera.x;
+    int top = enemy->y - camera.y;
+    int right = left + 16;
+    int bottom = top + 32;
+
+    if (right > -ENEMY_ACTIVE_MARGIN && left < SCREEN_WIDTH + ENEMY_ACTIVE_MARGIN &&
+            bottom > -ENEMY_ACTIVE_MARGIN && top < SCREEN_HEIGHT + ENEMY_ACTIVE_MARGIN) {
+        return ENEMY_ACTIVE;
+    }
+    if (right > -ENEMY_WAKE_MARGIN && left < SCREEN_WIDTH + ENEMY_WAKE_MARGIN &&
+            bottom > -ENEMY_WAKE_MARGIN && top < SCREEN_HEIGHT + ENEMY_WAKE_MARGIN) {
+        return ENEMY_NEARBY;
+    }
+    return ENEMY_ASLEEP;
+}
+
+/* update the enemies depending on how close they are to the camera
+ * the activity only depends on positions, so enemies always wake at the same spot */
+void update_enemies() {
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        struct Enemy* enemy = &enemies[i];
+        if (!enemy->used) {
+            continue;
         }
 
-        /* update channel B */
-        if (channel_b_vblanks_remaining == 0) {
-            /* disable the sound and DMA transfer on channel B */
-            *sound_control &= ~(SOUND_B_RIGHT_CHANNEL | SOUND_B_LEFT_CHANNEL | SOUND_B_FIFO_RESET);
-            *dma2_control = 0;
+        /* sleeping enemies are kept out of OAM altogether */
+        int activity = enemy_activity(enemy);
+        if (activity != enemy->activity) {
+            if (activity == ENEMY_ASLEEP) {
+                enemy->sprite->attribute0 |= SPRITE_DISABLE;
+            } else if (enemy->activity == ENEMY_ASLEEP && enemy->anim.slot != SPRITE_SLOT_NONE) {
+                enemy->sprite->attribute0 &= ~SPRITE_DISABLE;
+            }
+            enemy->activity = activity;
         }
-        else {
-            channel_b_vblanks_remaining--;
+
+        /* nearby enemies take turns updating so they don't all land on the same frame */
+        if (activity == ENEMY_ACTIVE ||
+                (activity == ENEMY_NEARBY && ((game_frame + i) & (ENEMY_NEARBY_RATE - 1)) == 0)) {
+            enemy_update(enemy);
         }
     }
+}
 
-    /* restore/enable interrupts */
-    *interrupt_state = temp;
-    *interrupt_enable = 1;
+/* spawns are brought in when they get this close to the screen, which is
+ * when they would start waking up, and dropped once they are a bit further
+ * away than that so one on the edge doesn't keep coming and going */
+#define SPAWN_MARGIN ENEMY_WAKE_MARGIN
+#define RELEASE_MARGIN (ENEMY_WAKE_MARGIN + 32)
+
+/* create the enemy for a spawn, unless it was killed or there's no room */
+void spawn_start(int index) {
+    if (spawn_killed[index] || spawn_enemy[index] >= 0) {
+        return;
+    }
+
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (!enemies[i].used) {
+            const struct Spawn* spawn = &level->spawns[index];
+            const struct EnemyType* type = &enemy_types[spawn->type];
+            enemy_init(&enemies[i], spawn->x, spawn->y, type->height, type->offset, type->clip);
+            enemies[i].spawn = index;
+            enemies[i].feet = type->feet;
+            enemies[i].type = type;
+            spawn_enemy[index] = i;
+            return;
+        }
+    }
+}
+
+/* drop the enemy for a spawn the camera has left behind, if it was dying
+ * already it counts as killed */
+void spawn_stop(int index) {
+    if (spawn_enemy[index] < 0) {
+        return;
+    }
+
+    struct Enemy* enemy = &enemies[spawn_enemy[index]];
+    if (!enemy->alive) {
+        enemy_kill(enemy);
+    } else {
+        enemy_release(enemy);
+    }
+}
+
+/* move the spawn cursors along with the camera, each spawn is only looked
+ * at when a cursor passes it so this doesn't depend on the level length */
+void level_update() {
+    int count = spawn_count;
+    int near_left = camera.x - SPAWN_MARGIN;
+    int near_right = camera.x + SCREEN_WIDTH + SPAWN_MARGIN;
+    int far_left = camera.x - RELEASE_MARGIN;
+    int far_right = camera.x + SCREEN_WIDTH + RELEASE_MARGIN;
+
+    /* drop spawns which have fallen off either end */
+    while (spawn_left < spawn_right && level->spawns[spawn_left].x + 16 <= far_left) {
+        spawn_stop(spawn_left++);
+    }
+    while (spawn_right > spawn_left && level->spawns[spawn_right - 1].x >= far_right) {
+        spawn_stop(--spawn_right);
+    }
+
+    /* the cursors can pass each other if nothing is in range */
+    if (spawn_left == spawn_right) {
+        while (spawn_left < count && level->spawns[spawn_left].x + 16 <= near_left) {
+            spawn_left++;
+        }
+        while (spawn_left > 0 && level->spawns[spawn_left - 1].x + 16 > near_left) {
+            spawn_left--;
+        }
+        spawn_right = spawn_left;
+    }
+
+    /* bring in spawns coming up on either side */
+    while (spawn_right < count && level->spawns[spawn_right].x < near_right) {
+        spawn_start(spawn_right++);
+    }
+    while (spawn_left > 0 && level->spawns[spawn_left - 1].x + 16 > near_left) {
+        spawn_start(--spawn_left);
+    }
+}
+
+/* start playing a level from the left, with nothing killed yet */
+void level_start(const struct Level* new_level) {
+    level = new_level;
+    spawn_left = 0;
+    spawn_right = 0;
+    spawn_count = level->spawn_count < MAX_SPAWNS ? level->spawn_count : MAX_SPAWNS;
+    for (int i = 0; i < spawn_count; i++) {
+        spawn_enemy[i] = -1;
+        spawn_killed[i] = 0;
+    }
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        enemies[i].used = 0;
+    }
+
+    /* every enemy in the level has to be killed to win */
+    numEnemies = spawn_count;
+    level_update();
+}
+
+/* keep the sound going, called once a frame */
+void sound_vblank() {
+    /* channel A plays the music */
+    music_vblank();
+
+    /* and the PSG the sound effects, starting any asked for this frame */
+    psg_update();
+    sfx_commit();
+}
+
+/* the vblank handler, the dispatcher has already acknowledged the interrupt */
+void on_vblank() {
+    /* swap the sound buffers before anything else so it happens at the same time every frame */
+    music_restart();
+    vblank_count++;
+
+    /* latch the buttons for the coming frame */
+    key_poll();
+
+    /* queue up any new frames of animation, then make the copies
+     * the game asked for during the frame */
+    sprite_vram_flush(SPRITE_UPLOAD_BUDGET);
+    dma_queue_flush(DMA_VBLANK_BUDGET);
+
+    sound_vblank();
 }
 
 /* the main function */
@@ -1093,13 +3880,13 @@ int main() {
     // setup_score_background();
     // set_text("Press Start",10,5);
 
-    *interrupt_enable = 0;
-    *interrupt_callback = (unsigned int) &on_vblank;
-    *interrupt_selection |= INTERRUPT_VBLANK;
-    *display_interrupts |= 0x08;
-    *interrupt_enable = 1;
+    /* run on_vblank each frame */
+    irq_init();
+    irq_set(IRQ_VBLANK, on_vblank, 0);
+    irq_enable(IRQ_VBLANK);
 
-    *sound_control = 0;
+    /* the music is silent until a song is played */
+    sound_init(1);
 
     /*forever loop for tile screen until 'START' is hit to start game*/
     while(1) {
@@ -1133,84 +3920,75 @@ int main() {
     /* create the koopa */
     struct Samus samus;
     samus_init(&samus);
-    struct Projectile projectile;
-    struct Enemy zeela;
-    enemy_init(&zeela, 144, 1, 8, 0, 84);
-    struct Enemy zeela2;
-    enemy_init(&zeela2, 405, 1, 8, 0, 84);
-    struct Enemy zombie;
-    enemy_init(&zombie, 200, 119, 32, 0, 112);
-    struct Enemy zombie2;
-    enemy_init(&zombie2, 460, 119, 32, 0, 112);
-    struct Enemy metroid;
-    enemy_init(&metroid, 485, 48, 8, 8, 144);
-    struct Enemy metroid2;
-    enemy_init(&metroid2, 225, 48, 8, 8, 144);
-
-    /* set initial scroll to 0 */
-    int xscroll = 0;
-    int xxscroll = 0;
-    
-    play_sound(mus_main_16K_mono, mus_main_16K_mono_bytes, 16000, 'A');
+    struct Projectile projectile = {0};
+
+    /* the camera keeps Samus 40 pixels from the edges of the screen */
+    camera_init(&camera, 40, 2);
+
+    /* bring in the enemies around the start of the level */
+    level_start(&level1);
+
+    /* holding the blaster fires a shot every 12 frames */
+    key_repeat_limits(12, 12);
+
+    /* copy the first frames in now rather than over the first few vblanks */
+    sprite_vram_flush(SPRITE_SLOTS * SPRITE_SLOT_BYTES);
+    dma_queue_flush(VBLANK_CYCLES * 4);
+
+    music_play(&main_theme);
     
     /* loop forever */
     while (1) {
-        /* clear dead enemies from the screen */        
-        remove_enemies(&zeela, &zeela2, &zombie, &zombie2, &metroid, &metroid2);
+        game_frame++;
+
+        /* bring in enemies the camera is getting close to and drop ones it left */
+        level_update();
+
+        /* update the enemies near the screen and clear dead ones */
+        update_enemies();
         /* update Samus */
-        samus_update(&samus, xxscroll);
+        samus_update(&samus);
+        /* the enemies which are due decide what to do about her, and their shots fly */
+        ai_update(&samus);
+        enemy_shots_update();
+        /* resolve everything touching */
+        collide_all(&samus, &projectile);
         /* update projectile */
-        projectile_update(&projectile, &samus, &zeela, &zeela2, &zombie, &zombie2, &metroid, &metroid2);
+        projectile_update(&projectile);
 
         /* now the arrow keys move the koopa */
         if (button_pressed(BUTTON_RIGHT)) {
-            if (samus_right(&samus)) {
-                xscroll++;
-                xxscroll += 2;
-                if (projectile.dx < 0) {
-                    projectile.dx = -6;
-                }
-                enemy_move(&zeela, &zeela2, &zombie, &zombie2, &metroid, &metroid2, -2);
-            }
-            
+            samus_right(&samus);
         } else if (button_pressed(BUTTON_LEFT)) {
-
-            if (samus_left(&samus)) {
-                xscroll--;
-                xxscroll -= 2;
-                if (projectile.dx > 0) {
-                    projectile.dx = 6;
-                }
-                enemy_move(&zeela, &zeela2, &zombie, &zombie2, &metroid, &metroid2, 2);
-            }
-            
+            samus_left(&samus);
         } else {
             samus_stop(&samus);
-            if (projectile.dx > 0) {
-                projectile.dx = 4;
-            } else if (projectile.dx < 0) {
-                projectile.dx = -4;
-            }
         }
 
-        /* check for blaster */
-        if (button_pressed(BUTTON_B)) {
-             projectile_init(&projectile, &samus, 64);
-             play_sound(basic_shot_16K_mono, basic_shot_16K_mono_bytes, 16000, 'B');
+        /* check for blaster, holding B fires again at the repeat rate */
+        if (key_repeat(BUTTON_B)) {
+             projectile_init(&projectile, &samus, &projectile_clip);
+             sfx_request(&shot_sound, sound_pan(samus.x - camera.x));
         }
 
         /* check for jumping */
-        if (button_pressed(BUTTON_A)) {
+        if (key_held(BUTTON_A)) {
             samus_jump(&samus);
         }
         updateHitsandLives();
         
-        samus_falling(&samus);
-        /* wait for vblank before scrolling and moving sprites */
-        wait_vblank();
-        *bg0_x_scroll = xscroll;
-        *bg1_x_scroll = xxscroll;
+        samus_animate(&samus);
+
+        /* scroll to keep Samus in view */
+        camera_follow(&camera, samus.x, 16);
+
+        /* queue the sprites to be copied in the coming vblank */
         sprite_update_all();
+
+        /* wait for vblank before scrolling, the far background moves at half speed */
+        wait_vblank();
+        *bg0_x_scroll = camera.x >> 1;
+        *bg1_x_scroll = camera.x;
         
         /* delay some */
         delay(300);
@@ -1237,7 +4015,7 @@ int main() {
 
     while(1){
         wait_vblank();
-        if(button_pressed(BUTTON_A)){
+        if(key_pressed(BUTTON_A)){
         	break;
         }
     }
@@ -1,11742 +0,0 @@
-/* mus_main_16K_mono.h
- * generated by raw2gba */
-
-#define mus_main_16K_mono_bytes 140799
-
-const signed char mus_main_16K_mono [] = {
-    0x13, 0x17, 0x1B, 0x18, 0x18, 0x18, 0x1A, 0x1A, 0x16, 0x13, 0x10, 0x0B, 
-    0x07, 0x04, 0x01, 0x02, 0x04, 0x03, 0x02, 0x00, 0x02, 0x00, 0xFD, 0xF9, 
-    0xF5, 0xF5, 0xF8, 0xFE, 0x04, 0x04, 0x02, 0xFB, 0xF4, 0xF2, 0xF4, 0xFA, 
-    0x00, 0x05, 0x09, 0x0B, 0x09, 0x06, 0x00, 0xF8, 0xF1, 0xEF, 0xEE, 0xF1, 
-    0xF3, 0xF3, 0xF1, 0xEF, 0xEF, 0xEF, 0xF1, 0xF3, 0xF3, 0xF0, 0xEB, 0xE7, 
-    0xE4, 0xE6, 0xEB, 0xF1, 0xF5, 0xF4, 0xF4, 0xF3, 0xF2, 0xF3, 0xF6, 0xFB, 
-    0x02, 0x06, 0x0C, 0x0E, 0x0B, 0x01, 0xF9, 0xF8, 0xF8, 0xFC, 0x01, 0x05, 
-    0x06, 0x04, 0xFF, 0xFA, 0xF7, 0xFB, 0xFE, 0x01, 0x06, 0x09, 0x05, 0xFF, 
-    0xFF, 0xFF, 0x00, 0xFC, 0xF8, 0xF7, 0xFA, 0xFC, 0xFC, 0xF8, 0xF7, 0xFA, 
-    0xFE, 0xFF, 0xFB, 0xF2, 0xE6, 0xDE, 0xD5, 0xD1, 0xD3, 0xDA, 0xE3, 0xEA, 
-    0xE9, 0xE3, 0xDD, 0xDA, 0xDB, 0xDD, 0xE0, 0xE2, 0xE4, 0xE8, 0xEA, 0xEC, 
-    0xEB, 0xE8, 0xE6, 0xE6, 0xEA, 0xEE, 0xF1, 0xEF, 0xEF, 0xEF, 0xF1, 0xF5, 
-    0xF5, 0xF5, 0xF5, 0xF1, 0xEE, 0xEC, 0xEA, 0xE9, 0xE9, 0xEB, 0xEE, 0xEF, 
-    0xEF, 0xED, 0xEB, 0xEA, 0xEB, 0xEE, 0xF2, 0xF7, 0xFB, 0xFE, 0xFF, 0xFE, 
-    0xF7, 0xF3, 0xF2, 0xF7, 0xFE, 0x01, 0x06, 0x06, 0x03, 0xFE, 0xFA, 0xF6, 
-    0xF3, 0xED, 0xE9, 0xE8, 0xE9, 0xE9, 0xEA, 0xEC, 0xED, 0xEF, 0xF0, 0xF3, 
-    0xF6, 0xF6, 0xF7, 0xF9, 0xFA, 0xF9, 0xFB, 0xFE, 0x02, 0x08, 0x09, 0x07, 
-    0x03, 0x00, 0x03, 0x08, 0x0C, 0x12, 0x18, 0x20, 0x24, 0x21, 0x1A, 0x15, 
-    0x16, 0x18, 0x1A, 0x1A, 0x19, 0x16, 0x14, 0x11, 0x0F, 0x0F, 0x12, 0x15, 
-    0x19, 0x1B, 0x1A, 0x18, 0x14, 0x15, 0x18, 0x1D, 0x1F, 0x1C, 0x1A, 0x1B, 
-    0x1D, 0x1D, 0x1C, 0x1D, 0x20, 0x26, 0x29, 0x26, 0x1D, 0x13, 0x0C, 0x0A, 
-    0x08, 0x0A, 0x0E, 0x13, 0x17, 0x17, 0x12, 0x0D, 0x08, 0x06, 0x09, 0x0B, 
-    0x0E, 0x10, 0x0D, 0x0B, 0x0A, 0x0B, 0x0B, 0x09, 0x09, 0x09, 0x07, 0x06, 
-    0x05, 0x07, 0x0A, 0x10, 0x15, 0x16, 0x16, 0x11, 0x0C, 0x0A, 0x08, 0x07, 
-    0x08, 0x0B, 0x0B, 0x0C, 0x0B, 0x08, 0x05, 0x01, 0xFB, 0xFB, 0xFD, 0x02, 
-    0x03, 0x01, 0x00, 0xFC, 0xF8, 0xF3, 0xEE, 0xEE, 0xFC, 0x06, 0x0D, 0x0F, 
-    0x0B, 0x07, 0x02, 0x01, 0xFF, 0xFB, 0xF7, 0xF3, 0xF2, 0xEF, 0xED, 0xEF, 
-    0xEF, 0xF1, 0xF1, 0xF0, 0xEC, 0xEB, 0xEA, 0xEB, 0xEB, 0xE9, 0xEE, 0xF3, 
-    0xFD, 0xFE, 0x01, 0xFB, 0xF1, 0xF2, 0xF0, 0xF7, 0xFB, 0xFD, 0x01, 0x06, 
-    0x0F, 0x14, 0x0F, 0x0C, 0x07, 0x08, 0x0C, 0x0D, 0x0B, 0x09, 0x04, 0x01, 
-    0x01, 0xFB, 0xFB, 0xFD, 0xFA, 0x00, 0xFE, 0xF9, 0xF6, 0xF3, 0xF6, 0xF7, 
-    0xFC, 0xF8, 0xF5, 0xF1, 0xEE, 0xEF, 0xEE, 0xF2, 0xF3, 0xF7, 0xF9, 0xF4, 
-    0xF1, 0xEA, 0xE6, 0xE5, 0xE0, 0xDE, 0xE1, 0xE6, 0xEC, 0xED, 0xE7, 0xE3, 
-    0xDF, 0xDD, 0xDE, 0xE1, 0xE4, 0xE8, 0xE9, 0xEA, 0xE8, 0xEA, 0xEB, 0xEB, 
-    0xF1, 0xEC, 0xEB, 0xED, 0xEE, 0xED, 0xE9, 0xEC, 0xEE, 0xF4, 0xF9, 0xFD, 
-    0xF9, 0xF4, 0xEF, 0xEC, 0xED, 0xEE, 0xED, 0xF2, 0xF3, 0xF1, 0xED, 0xEA, 
-    0xEB, 0xED, 0xF2, 0xF4, 0xF8, 0xFA, 0xF7, 0xF7, 0xF5, 0xF3, 0xF5, 0xF5, 
-    0xF9, 0xFB, 0x03, 0x04, 0x02, 0x01, 0xFC, 0xFC, 0xFB, 0xFC, 0xFC, 0xFC, 
-    0xF7, 0xF4, 0xF1, 0xED, 0xEE, 0xF2, 0xF5, 0xFB, 0xF9, 0xF3, 0xF1, 0xEF, 
-    0xF1, 0xF0, 0xF3, 0xF6, 0xFC, 0xFD, 0x00, 0xFD, 0xF8, 0xF7, 0xF5, 0xFB, 
-    0x00, 0x06, 0x08, 0x0A, 0x0F, 0x13, 0x16, 0x18, 0x19, 0x1C, 0x1F, 0x22, 
-    0x23, 0x21, 0x23, 0x1E, 0x1C, 0x18, 0x18, 0x1B, 0x1C, 0x1C, 0x1C, 0x19, 
-    0x13, 0x12, 0x13, 0x17, 0x1E, 0x1F, 0x22, 0x20, 0x1B, 0x17, 0x17, 0x19, 
-    0x1D, 0x1F, 0x1C, 0x1C, 0x19, 0x17, 0x10, 0x0A, 0x06, 0x07, 0x0B, 0x0E, 
-    0x0F, 0x10, 0x0F, 0x0D, 0x0D, 0x0B, 0x0C, 0x0C, 0x11, 0x14, 0x17, 0x16, 
-    0x10, 0x0D, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x0C, 0x0C, 0x0B, 0x09, 0x06, 
-    0x06, 0x0D, 0x15, 0x1D, 0x1B, 0x16, 0x0D, 0x0A, 0x0B, 0x0E, 0x10, 0x0F, 
-    0x0F, 0x0B, 0x07, 0xFE, 0xF8, 0xF4, 0xF7, 0xF9, 0xFC, 0xFA, 0xF7, 0xF5, 
-    0xF4, 0xF4, 0xF1, 0xF1, 0xF1, 0xF6, 0xF7, 0xFB, 0xF9, 0xF6, 0xF5, 0xF5, 
-    0xF6, 0xF7, 0xF8, 0xF9, 0xFB, 0xF9, 0xF8, 0xF3, 0xF0, 0xEF, 0xF3, 0xF8, 
-    0xFA, 0xF8, 0xF1, 0xED, 0xEA, 0xEB, 0xEF, 0xF5, 0xFA, 0xFC, 0xFD, 0xFC, 
-    0xFE, 0xFC, 0xFD, 0xFE, 0xFF, 0x04, 0x09, 0x0A, 0x07, 0x04, 0x04, 0x06, 
-    0x08, 0x09, 0x0A, 0x0A, 0x09, 0x0B, 0x09, 0x08, 0x05, 0x04, 0x04, 0x04, 
-    0x06, 0x03, 0x01, 0xFE, 0xFC, 0xFB, 0xFA, 0xFB, 0xFA, 0xFB, 0xF9, 0xFB, 
-    0xF8, 0xF6, 0xF2, 0xF1, 0xF5, 0xF5, 0xF8, 0xF6, 0xF3, 0xF2, 0xEE, 0xE8, 
-    0xE5, 0xE5, 0xE6, 0xEC, 0xEC, 0xEA, 0xE3, 0xDF, 0xDE, 0xDD, 0xDF, 0xE0, 
-    0xE0, 0xE3, 0xE4, 0xE3, 0xE4, 0xDF, 0xDE, 0xDF, 0xE3, 0xE5, 0xE5, 0xE3, 
-    0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xEB, 0xF0, 0xF5, 0xF5, 0xF5, 0xF3, 0xF2, 
-    0xF3, 0xF9, 0xFE, 0xFF, 0xFF, 0xFE, 0xFC, 0xF7, 0xF2, 0xED, 0xEC, 0xEF, 
-    0xF4, 0xF8, 0xF7, 0xF7, 0xF3, 0xF2, 0xF4, 0xF7, 0xFC, 0x01, 0x04, 0x02, 
-    0x00, 0xFC, 0xF9, 0xF7, 0xF5, 0xF9, 0xFA, 0xFA, 0xF6, 0xF0, 0xED, 0xEA, 
-    0xED, 0xF2, 0xF5, 0xF9, 0xFA, 0xF7, 0xF4, 0xF1, 0xF2, 0xF3, 0xF7, 0xFE, 
-    0x02, 0x05, 0x05, 0x05, 0x04, 0x03, 0x03, 0x05, 0x05, 0x09, 0x0B, 0x0C, 
-    0x0A, 0x09, 0x09, 0x09, 0x0C, 0x12, 0x16, 0x19, 0x19, 0x17, 0x16, 0x18, 
-    0x18, 0x18, 0x1C, 0x1F, 0x20, 0x1B, 0x16, 0x12, 0x0F, 0x0E, 0x0F, 0x11, 
-    0x14, 0x14, 0x12, 0x11, 0x10, 0x11, 0x10, 0x0F, 0x0F, 0x11, 0x14, 0x13, 
-    0x11, 0x0E, 0x10, 0x12, 0x13, 0x13, 0x14, 0x15, 0x15, 0x15, 0x11, 0x0D, 
-    0x0A, 0x0B, 0x0D, 0x0E, 0x0D, 0x0D, 0x0E, 0x11, 0x12, 0x11, 0x10, 0x0F, 
-    0x12, 0x16, 0x19, 0x17, 0x16, 0x12, 0x11, 0x11, 0x10, 0x10, 0x10, 0x0F, 
-    0x0F, 0x0E, 0x0B, 0x08, 0x06, 0x06, 0x08, 0x0B, 0x0D, 0x0D, 0x0D, 0x09, 
-    0x06, 0x04, 0x02, 0x03, 0x05, 0x07, 0x07, 0x06, 0x03, 0xFF, 0xFD, 0xFD, 
-    0xFE, 0x02, 0x02, 0x01, 0xFE, 0xFA, 0xF9, 0xF6, 0xF4, 0xF3, 0xF4, 0xF6, 
-    0xF7, 0xF4, 0xF0, 0xEB, 0xE9, 0xEA, 0xED, 0xEF, 0xF0, 0xF2, 0xF1, 0xEF, 
-    0xEB, 0xE7, 0xE7, 0xEA, 0xF0, 0xF6, 0xF8, 0xF7, 0xF4, 0xF3, 0xF1, 0xF3, 
-    0xF7, 0xF9, 0xFC, 0xFC, 0xFB, 0xFA, 0xF8, 0xF9, 0xFB, 0x00, 0x06, 0x0C, 
-    0x0D, 0x0A, 0x07, 0x05, 0x06, 0x08, 0x09, 0x0B, 0x0D, 0x0C, 0x09, 0x04, 
-    0xFD, 0xFA, 0xFA, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x00, 0xFF, 
-    0xFF, 0x01, 0x03, 0x01, 0xFE, 0xF8, 0xF2, 0xEE, 0xEE, 0xEE, 0xED, 0xEB, 
-    0xE9, 0xE7, 0xE5, 0xE3, 0xDF, 0xDE, 0xDF, 0xE2, 0xE4, 0xE3, 0xE2, 0xE2, 
-    0xE1, 0xE2, 0xE3, 0xE5, 0xE9, 0xEC, 0xEE, 0xED, 0xED, 0xEA, 0xE8, 0xE7, 
-    0xE8, 0xE8, 0xE9, 0xE8, 0xE8, 0xE9, 0xEA, 0xEA, 0xE9, 0xE8, 0xE7, 0xE8, 
-    0xEB, 0xEF, 0xF3, 0xF3, 0xF1, 0xF0, 0xF0, 0xF1, 0xF2, 0xF1, 0xF0, 0xEF, 
-    0xEE, 0xEE, 0xEC, 0xEC, 0xF0, 0xF5, 0xFA, 0xFC, 0xF8, 0xF4, 0xF3, 0xF2, 
-    0xF2, 0xF1, 0xF2, 0xF2, 0xF5, 0xF9, 0xF9, 0xF5, 0xF1, 0xF0, 0xF0, 0xF3, 
-    0xF6, 0xF8, 0xF8, 0xF7, 0xF3, 0xF0, 0xEF, 0xEF, 0xF2, 0xF7, 0xFB, 0xFE, 
-    0x00, 0x01, 0x05, 0x09, 0x0D, 0x0F, 0x10, 0x10, 0x11, 0x10, 0x0E, 0x09, 
-    0x08, 0x09, 0x0D, 0x13, 0x19, 0x1A, 0x17, 0x12, 0x0D, 0x0D, 0x12, 0x18, 
-    0x1D, 0x1D, 0x1C, 0x19, 0x16, 0x15, 0x14, 0x17, 0x19, 0x1C, 0x1D, 0x1B, 
-    0x1A, 0x1B, 0x1D, 0x1C, 0x1A, 0x17, 0x16, 0x17, 0x18, 0x15, 0x10, 0x0C, 
-    0x09, 0x0A, 0x0D, 0x0F, 0x0D, 0x08, 0x06, 0x05, 0x05, 0x05, 0x09, 0x0C, 
-    0x0C, 0x0C, 0x0C, 0x0A, 0x07, 0x05, 0x05, 0x07, 0x0B, 0x0E, 0x10, 0x13, 
-    0x13, 0x13, 0x0F, 0x0A, 0x08, 0x09, 0x0A, 0x0A, 0x09, 0x07, 0x04, 0x04, 
-    0x08, 0x0C, 0x0F, 0x0D, 0x0B, 0x08, 0x08, 0x09, 0x0B, 0x0C, 0x0B, 0x09, 
-    0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x06, 0x08, 
-    0x07, 0x04, 0x01, 0xFE, 0xFE, 0xFF, 0xFD, 0xFC, 0xFB, 0xFA, 0xFA, 0xF9, 
-    0xF7, 0xF3, 0xF0, 0xEE, 0xED, 0xED, 0xEF, 0xF0, 0xF1, 0xEE, 0xEB, 0xEC, 
-    0xEF, 0xF1, 0xF3, 0xF6, 0xF8, 0xFA, 0xFB, 0xFC, 0x00, 0x03, 0x05, 0x04, 
-    0xFF, 0xFD, 0xFD, 0xFE, 0xFB, 0xF8, 0xF6, 0xF8, 0xFB, 0xFF, 0x00, 0xFE, 
-    0xFB, 0xFB, 0xFD, 0x02, 0x05, 0x06, 0x06, 0x07, 0x04, 0xFF, 0xF8, 0xF5, 
-    0xF4, 0xF5, 0xF8, 0xFB, 0xFA, 0xF8, 0xF7, 0xF8, 0xF9, 0xFB, 0xFB, 0xF9, 
-    0xF6, 0xF3, 0xF0, 0xEE, 0xEB, 0xEB, 0xEE, 0xF1, 0xF3, 0xF4, 0xF1, 0xEE, 
-    0xEA, 0xEA, 0xE9, 0xEA, 0xED, 0xEE, 0xEB, 0xE8, 0xE4, 0xE2, 0xE2, 0xE2, 
-    0xE4, 0xE7, 0xEC, 0xF0, 0xF2, 0xF4, 0xF3, 0xF1, 0xEE, 0xEE, 0xF1, 0xF3, 
-    0xF2, 0xEE, 0xE8, 0xE4, 0xE5, 0xEA, 0xEF, 0xF3, 0xF3, 0xF1, 0xEF, 0xF1, 
-    0xF2, 0xF3, 0xF3, 0xF6, 0xF7, 0xF8, 0xF8, 0xF4, 0xF1, 0xF3, 0xF5, 0xF4, 
-    0xF6, 0xF9, 0xFD, 0x01, 0x03, 0x02, 0xFF, 0xFC, 0xFB, 0xFB, 0xFC, 0xF9, 
-    0xF9, 0xF9, 0xF8, 0xF6, 0xF3, 0xF2, 0xF1, 0xF2, 0xF3, 0xF4, 0xF4, 0xF2, 
-    0xF2, 0xF2, 0xF2, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF6, 0xF5, 0xF6, 0xF9, 
-    0xFE, 0x03, 0x08, 0x0C, 0x0D, 0x0C, 0x09, 0x05, 0x05, 0x05, 0x04, 0x05, 
-    0x06, 0x09, 0x0E, 0x12, 0x13, 0x13, 0x13, 0x15, 0x1A, 0x1F, 0x23, 0x24, 
-    0x22, 0x1E, 0x1A, 0x17, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x17, 
-    0x1A, 0x1D, 0x20, 0x21, 0x21, 0x22, 0x21, 0x1C, 0x16, 0x12, 0x14, 0x16, 
-    0x18, 0x19, 0x1A, 0x17, 0x13, 0x0E, 0x0D, 0x0F, 0x12, 0x14, 0x11, 0x10, 
-    0x0F, 0x0D, 0x0A, 0x06, 0x05, 0x08, 0x0C, 0x10, 0x12, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x0E, 0x0C, 0x0A, 0x08, 0x05, 0x01, 0xFC, 0xFA, 0xFB, 0xFF, 
-    0x03, 0x05, 0x05, 0x06, 0x04, 0x01, 0x00, 0x00, 0x04, 0x05, 0x05, 0x01, 
-    0xFE, 0xFB, 0xF9, 0xF6, 0xF4, 0xF6, 0xF8, 0xFB, 0xFD, 0xFE, 0xFE, 0xFC, 
-    0xF9, 0xF5, 0xF4, 0xF9, 0xFB, 0xFA, 0xF6, 0xF1, 0xF1, 0xF2, 0xF3, 0xF3, 
-    0xF1, 0xF2, 0xF5, 0xF7, 0xF7, 0xF4, 0xF2, 0xF3, 0xF7, 0xFA, 0xF9, 0xF8, 
-    0xF6, 0xF4, 0xF2, 0xF1, 0xF1, 0xF5, 0xFB, 0x00, 0x04, 0x03, 0x00, 0xFD, 
-    0xFC, 0xFB, 0xFB, 0xF9, 0xF8, 0xF8, 0xFA, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 
-    0x03, 0x05, 0x07, 0x08, 0x09, 0x07, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0x02, 
-    0x01, 0xFD, 0xFA, 0xF9, 0xF8, 0xF9, 0xFA, 0xFE, 0xFE, 0xFC, 0xFB, 0xF9, 
-    0xF8, 0xF5, 0xF1, 0xEF, 0xEE, 0xED, 0xED, 0xEC, 0xE9, 0xE6, 0xE4, 0xE1, 
-    0xE1, 0xE2, 0xE5, 0xE8, 0xE6, 0xE1, 0xDB, 0xD9, 0xDA, 0xDC, 0xDD, 0xDC, 
-    0xDD, 0xE0, 0xE3, 0xE8, 0xEA, 0xEA, 0xE9, 0xE7, 0xE7, 0xE6, 0xE7, 0xE5, 
-    0xE2, 0xDF, 0xDF, 0xE1, 0xE7, 0xEC, 0xF0, 0xF3, 0xF3, 0xF4, 0xF5, 0xF7, 
-    0xFA, 0xFE, 0x01, 0x01, 0x00, 0xFD, 0xFD, 0xFC, 0xF9, 0xF7, 0xF7, 0xF7, 
-    0xF8, 0xF9, 0xF9, 0xF9, 0xF7, 0xF5, 0xF4, 0xF5, 0xF7, 0xFB, 0xFB, 0xF6, 
-    0xF3, 0xF1, 0xF3, 0xF5, 0xF7, 0xF9, 0xF8, 0xF7, 0xF4, 0xF3, 0xF3, 0xF4, 
-    0xF6, 0xF8, 0xF8, 0xF9, 0xFA, 0xFB, 0xFA, 0xF8, 0xF8, 0xFB, 0xFF, 0x03, 
-    0x07, 0x0B, 0x0E, 0x0E, 0x0A, 0x06, 0x06, 0x0A, 0x0C, 0x0B, 0x08, 0x06, 
-    0x07, 0x08, 0x07, 0x08, 0x0A, 0x0E, 0x11, 0x12, 0x14, 0x15, 0x17, 0x18, 
-    0x16, 0x15, 0x13, 0x15, 0x17, 0x17, 0x14, 0x10, 0x0E, 0x10, 0x16, 0x1B, 
-    0x1D, 0x1B, 0x18, 0x15, 0x14, 0x13, 0x14, 0x13, 0x11, 0x11, 0x12, 0x12, 
-    0x11, 0x0F, 0x10, 0x12, 0x10, 0x10, 0x10, 0x13, 0x17, 0x18, 0x17, 0x15, 
-    0x14, 0x14, 0x13, 0x12, 0x10, 0x0D, 0x0C, 0x0D, 0x0D, 0x0E, 0x0F, 0x11, 
-    0x12, 0x10, 0x0D, 0x08, 0x05, 0x02, 0x00, 0xFE, 0x00, 0x04, 0x08, 0x08, 
-    0x07, 0x04, 0x03, 0x05, 0x07, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 0x08, 0x06, 
-    0x04, 0x02, 0x03, 0x04, 0x04, 0x03, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 
-    0xFD, 0xFD, 0xFE, 0xFD, 0xFA, 0xF5, 0xF2, 0xF1, 0xF2, 0xF4, 0xF4, 0xF2, 
-    0xF0, 0xEF, 0xEC, 0xE7, 0xE6, 0xEA, 0xF0, 0xF4, 0xF4, 0xF0, 0xEC, 0xEB, 
-    0xEC, 0xED, 0xEF, 0xF2, 0xF6, 0xFB, 0xFF, 0x00, 0xFD, 0xF9, 0xF6, 0xF7, 
-    0xF9, 0xFA, 0xF6, 0xF2, 0xF0, 0xF2, 0xF6, 0xFA, 0xFD, 0x00, 0x03, 0x07, 
-    0x0A, 0x0C, 0x0E, 0x10, 0x11, 0x11, 0x12, 0x13, 0x14, 0x13, 0x0C, 0x06, 
-    0xFF, 0xFC, 0xFB, 0xFB, 0xFA, 0xFA, 0xF9, 0xF5, 0xF2, 0xF0, 0xF1, 0xF2, 
-    0xF3, 0xF2, 0xF2, 0xF1, 0xF0, 0xEE, 0xEC, 0xEB, 0xEB, 0xEC, 0xEE, 0xEE, 
-    0xED, 0xEB, 0xE9, 0xEA, 0xEC, 0xEC, 0xED, 0xED, 0xEC, 0xEA, 0xE9, 0xE8, 
-    0xE6, 0xE6, 0xE9, 0xED, 0xEF, 0xEE, 0xED, 0xEA, 0xE7, 0xE4, 0xE3, 0xE1, 
-    0xE0, 0xE0, 0xE3, 0xE6, 0xE7, 0xE6, 0xE4, 0xE4, 0xE6, 0xE9, 0xEE, 0xF2, 
-    0xF6, 0xF6, 0xF4, 0xF3, 0xF2, 0xF1, 0xF2, 0xF6, 0xF7, 0xF6, 0xF3, 0xF0, 
-    0xF0, 0xF3, 0xF6, 0xF7, 0xF6, 0xF7, 0xF8, 0xF9, 0xF7, 0xF3, 0xEF, 0xEC, 
-    0xF0, 0xF5, 0xF8, 0xF9, 0xFA, 0xFB, 0xFD, 0xFF, 0x02, 0x05, 0x09, 0x0C, 
-    0x0F, 0x0F, 0x0E, 0x0C, 0x09, 0x06, 0x03, 0x04, 0x04, 0x05, 0x05, 0x03, 
-    0x02, 0x00, 0xFF, 0x00, 0x01, 0x03, 0x02, 0x01, 0xFF, 0xFD, 0xFC, 0xFF, 
-    0x04, 0x0A, 0x0E, 0x10, 0x11, 0x10, 0x11, 0x13, 0x17, 0x1A, 0x1D, 0x1F, 
-    0x1F, 0x1D, 0x1B, 0x19, 0x19, 0x18, 0x18, 0x16, 0x15, 0x15, 0x16, 0x17, 
-    0x16, 0x15, 0x13, 0x14, 0x18, 0x1A, 0x18, 0x14, 0x10, 0x0D, 0x0D, 0x0C, 
-    0x0B, 0x0A, 0x0A, 0x0C, 0x0D, 0x0B, 0x07, 0x07, 0x08, 0x0C, 0x0D, 0x0E, 
-    0x0D, 0x0A, 0x08, 0x07, 0x05, 0x03, 0x03, 0x05, 0x09, 0x0B, 0x0C, 0x09, 
-    0x07, 0x06, 0x06, 0x07, 0x05, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 
-    0x06, 0x08, 0x0C, 0x0F, 0x12, 0x16, 0x19, 0x1A, 0x18, 0x17, 0x17, 0x17, 
-    0x16, 0x13, 0x0D, 0x06, 0xFF, 0xFB, 0xFA, 0xFB, 0xFC, 0xFA, 0xFB, 0xFA, 
-    0xF8, 0xF7, 0xF6, 0xF5, 0xF3, 0xF3, 0xF3, 0xF5, 0xF7, 0xF6, 0xF7, 0xF7, 
-    0xFA, 0xFD, 0xFF, 0x00, 0xFF, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC, 0xFB, 0xFA, 
-    0xF9, 0xF9, 0xF9, 0xF8, 0xF7, 0xF9, 0xFA, 0xFA, 0xFB, 0xFD, 0xFE, 0xFE, 
-    0xFE, 0xFB, 0xF7, 0xF2, 0xF2, 0xF5, 0xFA, 0xFB, 0xFA, 0xF9, 0xFA, 0xFB, 
-    0xFD, 0xFF, 0x04, 0x07, 0x09, 0x0A, 0x09, 0x07, 0x03, 0x00, 0xFE, 0xFA, 
-    0xF8, 0xF3, 0xF1, 0xF0, 0xF1, 0xF2, 0xF2, 0xF2, 0xF3, 0xF6, 0xFA, 0xF8, 
-    0xF3, 0xEE, 0xEB, 0xEC, 0xF0, 0xF2, 0xF3, 0xF3, 0xF6, 0xF9, 0xFA, 0xF9, 
-    0xF8, 0xF8, 0xF9, 0xFC, 0xFE, 0xFE, 0xFB, 0xF5, 0xF1, 0xED, 0xEA, 0xE8, 
-    0xE8, 0xEA, 0xEB, 0xE8, 0xE3, 0xE1, 0xE2, 0xE5, 0xE7, 0xE5, 0xE2, 0xDD, 
-    0xDB, 0xDD, 0xDF, 0xE2, 0xE5, 0xEA, 0xEE, 0xF3, 0xF5, 0xF5, 0xF6, 0xF7, 
-    0xF8, 0xFB, 0xFE, 0x00, 0xFF, 0xFD, 0xFB, 0xF8, 0xF5, 0xF0, 0xEC, 0xEC, 
-    0xEF, 0xF1, 0xF2, 0xF2, 0xF4, 0xF6, 0xF7, 0xF8, 0xF8, 0xF7, 0xF5, 0xF4, 
-    0xF4, 0xF3, 0xF4, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFD, 0xFF, 0x01, 0xFF, 
-    0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFC, 0xF9, 0xF6, 0xF3, 0xF3, 0xF7, 0xFB, 
-    0xFE, 0x00, 0x03, 0x05, 0x09, 0x0B, 0x0A, 0x08, 0x04, 0x03, 0x06, 0x0C, 
-    0x12, 0x15, 0x16, 0x17, 0x18, 0x1A, 0x1D, 0x21, 0x24, 0x27, 0x28, 0x27, 
-    0x26, 0x24, 0x22, 0x1F, 0x1C, 0x19, 0x14, 0x10, 0x0E, 0x0E, 0x0F, 0x10, 
-    0x12, 0x14, 0x16, 0x16, 0x14, 0x11, 0x0C, 0x08, 0x06, 0x08, 0x0C, 0x0F, 
-    0x12, 0x13, 0x12, 0x11, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x12, 0x0F, 
-    0x0C, 0x0A, 0x0A, 0x09, 0x07, 0x04, 0x03, 0x05, 0x08, 0x09, 0x08, 0x07, 
-    0x09, 0x0A, 0x0B, 0x0A, 0x06, 0x02, 0xFE, 0xFD, 0xFE, 0x01, 0x03, 0x03, 
-    0x01, 0xFF, 0xFE, 0x00, 0x02, 0x04, 0x07, 0x0A, 0x0B, 0x09, 0x06, 0x03, 
-    0x01, 0xFD, 0xF9, 0xF4, 0xF2, 0xF4, 0xF7, 0xFA, 0xF8, 0xF8, 0xF9, 0xFD, 
-    0x00, 0xFF, 0xFE, 0xFB, 0xF9, 0xFA, 0xFC, 0xFE, 0x00, 0x02, 0x02, 0x03, 
-    0x04, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x07, 0x04, 0x02, 0xFE, 0xFB, 
-    0xF9, 0xF6, 0xF5, 0xF8, 0xFB, 0xFC, 0xF9, 0xF7, 0xFA, 0xFD, 0x00, 0xFE, 
-    0xF8, 0xF4, 0xF2, 0xF3, 0xF7, 0xFB, 0xFE, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 
-    0x01, 0x02, 0x04, 0x07, 0x08, 0x07, 0x05, 0x03, 0x00, 0xFC, 0xF7, 0xF2, 
-    0xF0, 0xF1, 0xF2, 0xF3, 0xF2, 0xF4, 0xF6, 0xF9, 0xFB, 0xF9, 0xF5, 0xF1, 
-    0xEF, 0xEE, 0xEC, 0xED, 0xEE, 0xEF, 0xEE, 0xEA, 0xE6, 0xE3, 0xE5, 0xEA, 
-    0xED, 0xEC, 0xEA, 0xE8, 0xE8, 0xE9, 0xE7, 0xE4, 0xE2, 0xE0, 0xE0, 0xE3, 
-    0xE6, 0xE8, 0xEA, 0xEA, 0xEA, 0xEC, 0xED, 0xED, 0xEC, 0xEB, 0xE9, 0xE9, 
-    0xEB, 0xF0, 0xF7, 0xFB, 0xFD, 0xFB, 0xFA, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 
-    0xFF, 0x00, 0x01, 0x00, 0xFE, 0xFA, 0xF8, 0xF4, 0xF1, 0xEE, 0xED, 0xEF, 
-    0xF1, 0xF0, 0xF2, 0xF5, 0xF9, 0xFB, 0xF9, 0xF6, 0xF3, 0xF2, 0xF3, 0xF5, 
-    0xF7, 0xFA, 0xFA, 0xFA, 0xF9, 0xF6, 0xF6, 0xF8, 0xFA, 0xFB, 0xFC, 0xFE, 
-    0xFF, 0xFF, 0xFE, 0xFB, 0xF9, 0xF8, 0xF9, 0xFC, 0x01, 0x04, 0x05, 0x03, 
-    0x05, 0x07, 0x0A, 0x0C, 0x0C, 0x0B, 0x09, 0x09, 0x08, 0x0A, 0x0C, 0x0F, 
-    0x10, 0x10, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x10, 0x11, 0x12, 
-    0x13, 0x13, 0x10, 0x0C, 0x09, 0x08, 0x09, 0x0C, 0x0F, 0x10, 0x0F, 0x11, 
-    0x14, 0x17, 0x19, 0x18, 0x15, 0x12, 0x11, 0x14, 0x19, 0x1C, 0x1D, 0x1B, 
-    0x1A, 0x18, 0x17, 0x15, 0x14, 0x14, 0x13, 0x13, 0x15, 0x16, 0x16, 0x14, 
-    0x11, 0x0F, 0x0B, 0x07, 0x04, 0xFE, 0xFA, 0xF6, 0xF5, 0xF7, 0xFC, 0x02, 
-    0x06, 0x08, 0x04, 0xFD, 0xF7, 0xF6, 0xF9, 0xFE, 0x00, 0xFD, 0xF9, 0xF7, 
-    0xFB, 0x02, 0x07, 0x07, 0x02, 0xFE, 0x00, 0x04, 0x09, 0x0B, 0x09, 0x06, 
-    0x02, 0xFD, 0xF9, 0xF7, 0xF7, 0xF8, 0xFB, 0xFD, 0x01, 0x07, 0x06, 0x02, 
-    0xFC, 0xF6, 0xF6, 0xF7, 0xF5, 0xF4, 0xF9, 0xFF, 0x05, 0x02, 0xFB, 0xEF, 
-    0xED, 0xEE, 0xF4, 0xFF, 0x03, 0x08, 0x08, 0x05, 0x01, 0xFB, 0xF8, 0xFA, 
-    0xFF, 0x0B, 0x13, 0x19, 0x1A, 0x14, 0x0D, 0x07, 0x04, 0x04, 0x02, 0xFE, 
-    0xFD, 0x01, 0x06, 0x0C, 0x0A, 0x04, 0xFE, 0xFA, 0xFB, 0xFB, 0x00, 0x02, 
-    0x03, 0xFF, 0xFA, 0xF5, 0xF0, 0xED, 0xE7, 0xE8, 0xEA, 0xEE, 0xF3, 0xF4, 
-    0xF3, 0xF0, 0xEF, 0xF1, 0xF2, 0xF2, 0xF3, 0xF7, 0xFB, 0xFE, 0xF9, 0xEF, 
-    0xE5, 0xDF, 0xDE, 0xE2, 0xE7, 0xEC, 0xEE, 0xF1, 0xF1, 0xEC, 0xE8, 0xE0, 
-    0xDD, 0xDE, 0xE5, 0xED, 0xF3, 0xF7, 0xF5, 0xEE, 0xE7, 0xE4, 0xE2, 0xE2, 
-    0xE3, 0xE4, 0xEA, 0xF4, 0xF4, 0xF1, 0xE3, 0xD8, 0xD2, 0xD1, 0xD7, 0xDE, 
-    0xE6, 0xEA, 0xEC, 0xEA, 0xE4, 0xDF, 0xDE, 0xE2, 0xEE, 0xFD, 0x10, 0x1E, 
-    0x26, 0x22, 0x1B, 0x11, 0x0B, 0x08, 0x03, 0x05, 0x08, 0x12, 0x17, 0x19, 
-    0x13, 0x09, 0x03, 0x06, 0x0D, 0x17, 0x1E, 0x24, 0x25, 0x20, 0x1A, 0x0D, 
-    0x06, 0x01, 0x01, 0x02, 0x08, 0x0F, 0x15, 0x17, 0x11, 0x0A, 0x06, 0x09, 
-    0x0A, 0x09, 0x08, 0x0A, 0x13, 0x18, 0x14, 0x08, 0xF9, 0xF1, 0xF5, 0xFF, 
-    0x0A, 0x12, 0x17, 0x17, 0x13, 0x0D, 0x03, 0xFB, 0xF9, 0xFB, 0x02, 0x0D, 
-    0x13, 0x14, 0x0F, 0x05, 0x00, 0x00, 0x04, 0x06, 0x0D, 0x0F, 0x14, 0x1B, 
-    0x18, 0x0F, 0x00, 0xF7, 0xF5, 0xFD, 0x04, 0x0C, 0x14, 0x1A, 0x1C, 0x18, 
-    0x10, 0x08, 0x05, 0x05, 0x09, 0x11, 0x1B, 0x21, 0x25, 0x23, 0x1D, 0x19, 
-    0x14, 0x0F, 0x08, 0x06, 0x0C, 0x18, 0x20, 0x1C, 0x0F, 0xFD, 0xF3, 0xF5, 
-    0xFA, 0x03, 0x0D, 0x17, 0x1D, 0x21, 0x1E, 0x19, 0x15, 0x12, 0x14, 0x18, 
-    0x1D, 0x21, 0x23, 0x21, 0x1F, 0x1B, 0x1B, 0x1C, 0x1A, 0x19, 0x17, 0x1C, 
-    0x25, 0x2A, 0x26, 0x1D, 0x15, 0x14, 0x16, 0x16, 0x13, 0x12, 0x12, 0x14, 
-    0x13, 0x10, 0x0B, 0x03, 0x01, 0x03, 0x0C, 0x17, 0x1E, 0x1E, 0x19, 0x15, 
-    0x13, 0x12, 0x0E, 0x05, 0xFD, 0xFA, 0x01, 0x03, 0xFA, 0xE8, 0xD7, 0xCC, 
-    0xCE, 0xDA, 0xE6, 0xF4, 0xFC, 0xFF, 0xFD, 0xF7, 0xF2, 0xEF, 0xEF, 0xF1, 
-    0xF5, 0xFB, 0x01, 0x05, 0x08, 0x08, 0x06, 0x05, 0x07, 0x06, 0x06, 0x05, 
-    0x09, 0x11, 0x0F, 0x05, 0xF5, 0xE8, 0xE0, 0xE0, 0xE2, 0xE9, 0xF3, 0xFF, 
-    0x08, 0x08, 0x03, 0xF7, 0xEE, 0xE6, 0xE5, 0xE8, 0xF0, 0xF9, 0xFE, 0xFE, 
-    0xFB, 0xF9, 0xF8, 0xFB, 0xFD, 0x00, 0x06, 0x10, 0x16, 0x13, 0x09, 0xF9, 
-    0xEF, 0xEC, 0xF1, 0xF8, 0xFF, 0x03, 0x04, 0x03, 0xFD, 0xF6, 0xF2, 0xEF, 
-    0xF0, 0xF3, 0xF7, 0xFC, 0xFF, 0x00, 0xFE, 0xFD, 0xFD, 0xFD, 0xF9, 0xF4, 
-    0xF2, 0xF9, 0x07, 0x0D, 0x06, 0xF5, 0xE4, 0xDC, 0xDA, 0xDF, 0xE5, 0xEB, 
-    0xF2, 0xF7, 0xF5, 0xEE, 0xE4, 0xDA, 0xD7, 0xDA, 0xE4, 0xEF, 0xFB, 0xFF, 
-    0xFA, 0xF1, 0xE7, 0xE3, 0xE4, 0xE8, 0xEE, 0xF2, 0xFC, 0x05, 0x07, 0xFF, 
-    0xF0, 0xE6, 0xE7, 0xF1, 0xFB, 0x00, 0x03, 0x04, 0x04, 0x01, 0xFC, 0xF6, 
-    0xF2, 0xF0, 0xF0, 0xF1, 0xF3, 0xF7, 0xF9, 0xFA, 0xF9, 0xF7, 0xF7, 0xF5, 
-    0xF4, 0xF1, 0xF3, 0xFD, 0x07, 0x08, 0xFF, 0xF1, 0xE7, 0xE7, 0xF0, 0xFB, 
-    0x04, 0x07, 0x08, 0x05, 0xFE, 0xF3, 0xE9, 0xE2, 0xE3, 0xEB, 0xF6, 0x02, 
-    0x09, 0x09, 0x04, 0x01, 0x00, 0x04, 0x05, 0x04, 0x03, 0x07, 0x0E, 0x09, 
-    0xFA, 0xE5, 0xD5, 0xD2, 0xDB, 0xE9, 0xF1, 0xF3, 0xF5, 0xF9, 0xFC, 0xFB, 
-    0xF7, 0xF2, 0xEF, 0xF1, 0xF5, 0xFD, 0x04, 0x08, 0x04, 0xFD, 0xF6, 0xF3, 
-    0xF5, 0xF5, 0xF6, 0xF8, 0x03, 0x10, 0x0F, 0x02, 0xED, 0xDD, 0xDC, 0xE9, 
-    0xFA, 0x04, 0x07, 0x06, 0x05, 0x02, 0xFD, 0xF7, 0xF2, 0xF2, 0xF4, 0xF8, 
-    0xFA, 0xF9, 0xF4, 0xED, 0xE8, 0xE7, 0xE9, 0xEB, 0xEC, 0xEB, 0xF0, 0xFA, 
-    0xFF, 0xFD, 0xF2, 0xE6, 0xE2, 0xE8, 0xF4, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 
-    0xFE, 0xF9, 0xF5, 0xF0, 0xEE, 0xF1, 0xFB, 0x08, 0x0E, 0x0C, 0x03, 0xF9, 
-    0xF4, 0xF3, 0xF2, 0xF3, 0xF7, 0x03, 0x0C, 0x09, 0xF7, 0xDE, 0xCD, 0xCA, 
-    0xD8, 0xEA, 0xF4, 0xF5, 0xF3, 0xEE, 0xE9, 0xE3, 0xDE, 0xDE, 0xE3, 0xE9, 
-    0xF0, 0xF5, 0xF8, 0xF7, 0xF3, 0xF1, 0xF1, 0xF3, 0xF4, 0xF2, 0xEF, 0xF1, 
-    0xF8, 0xFA, 0xF3, 0xE3, 0xD2, 0xCB, 0xD1, 0xE1, 0xEE, 0xF2, 0xF0, 0xED, 
-    0xEE, 0xEF, 0xEE, 0xEA, 0xE5, 0xE4, 0xE9, 0xF4, 0x01, 0x0A, 0x0B, 0x0A, 
-    0x0A, 0x0E, 0x14, 0x16, 0x17, 0x18, 0x21, 0x28, 0x25, 0x16, 0x01, 0xF1, 
-    0xEF, 0xF9, 0x05, 0x0B, 0x09, 0x04, 0x00, 0x00, 0x02, 0x04, 0x05, 0x06, 
-    0x08, 0x0C, 0x11, 0x15, 0x15, 0x0F, 0x0C, 0x0A, 0x0B, 0x0D, 0x0C, 0x0C, 
-    0x11, 0x1C, 0x24, 0x1F, 0x0E, 0xF8, 0xEB, 0xED, 0xFE, 0x0E, 0x12, 0x0E, 
-    0x06, 0x02, 0x01, 0x02, 0x03, 0x01, 0x03, 0x06, 0x0C, 0x12, 0x14, 0x10, 
-    0x09, 0x06, 0x08, 0x0D, 0x10, 0x11, 0x10, 0x13, 0x17, 0x15, 0x0E, 0x03, 
-    0xFC, 0xFD, 0x08, 0x17, 0x1F, 0x1D, 0x17, 0x11, 0x0F, 0x10, 0x10, 0x0E, 
-    0x0A, 0x08, 0x08, 0x0B, 0x11, 0x15, 0x17, 0x16, 0x17, 0x19, 0x1B, 0x18, 
-    0x15, 0x16, 0x1F, 0x26, 0x24, 0x17, 0x06, 0xFA, 0xFA, 0x04, 0x13, 0x17, 
-    0x12, 0x0B, 0x05, 0x05, 0x06, 0x08, 0x09, 0x09, 0x0C, 0x10, 0x13, 0x16, 
-    0x17, 0x16, 0x15, 0x17, 0x1C, 0x21, 0x23, 0x25, 0x28, 0x2D, 0x2C, 0x24, 
-    0x16, 0x09, 0x06, 0x0A, 0x15, 0x1E, 0x1D, 0x18, 0x14, 0x12, 0x11, 0x11, 
-    0x0F, 0x0C, 0x0C, 0x0E, 0x12, 0x14, 0x13, 0x10, 0x0E, 0x0F, 0x12, 0x16, 
-    0x15, 0x13, 0x10, 0x14, 0x18, 0x15, 0x0A, 0xF9, 0xEC, 0xE9, 0xF1, 0xFC, 
-    0x00, 0xFA, 0xF1, 0xEB, 0xE9, 0xEC, 0xF0, 0xF3, 0xF4, 0xF2, 0xF2, 0xF6, 
-    0xF9, 0xFC, 0xFA, 0xF8, 0xF6, 0xF5, 0xF5, 0xF4, 0xF4, 0xF7, 0xFE, 0x02, 
-    0x01, 0xF8, 0xEC, 0xE4, 0xE5, 0xEF, 0xFA, 0xFD, 0xF7, 0xF2, 0xF0, 0xF2, 
-    0xF3, 0xF2, 0xF3, 0xF5, 0xF8, 0xFD, 0x02, 0x04, 0x02, 0xFE, 0xFC, 0x00, 
-    0x06, 0x09, 0x09, 0x07, 0x08, 0x0B, 0x0A, 0x01, 0xF2, 0xE5, 0xE3, 0xEB, 
-    0xFB, 0x07, 0x07, 0xFE, 0xF4, 0xF2, 0xF4, 0xF7, 0xFA, 0xFA, 0xF8, 0xF7, 
-    0xF5, 0xF6, 0xF7, 0xF7, 0xF5, 0xF4, 0xF6, 0xF7, 0xF8, 0xF6, 0xF6, 0xFC, 
-    0x01, 0xFE, 0xF4, 0xE8, 0xE2, 0xE7, 0xF0, 0xFA, 0xFD, 0xF9, 0xF3, 0xF1, 
-    0xF1, 0xF1, 0xF2, 0xF3, 0xF3, 0xF2, 0xF2, 0xF6, 0xF9, 0xF8, 0xF4, 0xF0, 
-    0xF1, 0xF5, 0xF8, 0xFA, 0xF9, 0xFB, 0x02, 0x06, 0x03, 0xF5, 0xE6, 0xDE, 
-    0xE3, 0xEF, 0xFA, 0xF9, 0xF1, 0xEA, 0xE7, 0xEB, 0xF2, 0xF8, 0xFB, 0xFB, 
-    0xFA, 0xFA, 0xFC, 0xFD, 0xFB, 0xF9, 0xF9, 0xFD, 0xFE, 0xFB, 0xF9, 0xFB, 
-    0x02, 0x07, 0x03, 0xF7, 0xE9, 0xE3, 0xE7, 0xF2, 0xFD, 0x01, 0xFB, 0xF2, 
-    0xED, 0xEC, 0xEE, 0xF0, 0xF3, 0xF3, 0xF2, 0xF1, 0xF2, 0xF5, 0xF6, 0xF5, 
-    0xF5, 0xF8, 0xFD, 0x01, 0x00, 0xFD, 0xFF, 0x05, 0x08, 0x04, 0xF9, 0xEC, 
-    0xE6, 0xE7, 0xEF, 0xF8, 0xFA, 0xF5, 0xEF, 0xED, 0xEE, 0xF1, 0xF2, 0xF2, 
-    0xF1, 0xF0, 0xF2, 0xF5, 0xFB, 0x01, 0x06, 0x0A, 0x0B, 0x0B, 0x0A, 0x0B, 
-    0x0F, 0x16, 0x1B, 0x17, 0x09, 0xF6, 0xE8, 0xE6, 0xED, 0xF8, 0xFE, 0xF9, 
-    0xEE, 0xE5, 0xE0, 0xE1, 0xE5, 0xE8, 0xEA, 0xE8, 0xE5, 0xE4, 0xE4, 0xE5, 
-    0xE4, 0xE6, 0xE9, 0xEE, 0xF1, 0xF0, 0xEE, 0xF0, 0xF6, 0xFB, 0xFA, 0xF3, 
-    0xEC, 0xEB, 0xF2, 0xFC, 0x07, 0x09, 0x05, 0x02, 0x02, 0x05, 0x09, 0x0D, 
-    0x11, 0x13, 0x10, 0x0C, 0x08, 0x06, 0x05, 0x04, 0x00, 0xFC, 0xF9, 0xF4, 
-    0xF3, 0xF7, 0x01, 0x0B, 0x0B, 0x01, 0xF2, 0xE6, 0xE4, 0xE8, 0xF2, 0xF8, 
-    0xF7, 0xF1, 0xEA, 0xE4, 0xE2, 0xE4, 0xE6, 0xE9, 0xE9, 0xE8, 0xE6, 0xE7, 
-    0xE9, 0xEA, 0xEB, 0xEB, 0xEB, 0xEC, 0xEC, 0xED, 0xF2, 0xFA, 0xFD, 0xF9, 
-    0xF0, 0xE7, 0xE2, 0xE6, 0xEF, 0xF9, 0xFF, 0xFB, 0xF3, 0xED, 0xE9, 0xE9, 
-    0xEB, 0xED, 0xEE, 0xEF, 0xF0, 0xF0, 0xF1, 0xF2, 0xF6, 0xFA, 0x01, 0x07, 
-    0x08, 0x07, 0x07, 0x0D, 0x13, 0x11, 0x09, 0x00, 0xFA, 0xFC, 0x03, 0x0E, 
-    0x14, 0x14, 0x0D, 0x06, 0x03, 0x02, 0x02, 0x04, 0x05, 0x05, 0x02, 0xFF, 
-    0xFC, 0xFD, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x0A, 0x11, 0x15, 
-    0x13, 0x0B, 0x01, 0xF7, 0xF5, 0xFA, 0x06, 0x11, 0x13, 0x0F, 0x09, 0x06, 
-    0x05, 0x07, 0x0C, 0x10, 0x13, 0x12, 0x10, 0x0F, 0x0D, 0x0A, 0x08, 0x07, 
-    0x0A, 0x0E, 0x0F, 0x13, 0x19, 0x1D, 0x1C, 0x14, 0x09, 0x00, 0xFF, 0x05, 
-    0x0D, 0x13, 0x12, 0x0E, 0x0A, 0x0A, 0x0C, 0x11, 0x18, 0x1F, 0x24, 0x25, 
-    0x23, 0x21, 0x1E, 0x1A, 0x19, 0x1A, 0x1F, 0x21, 0x1D, 0x17, 0x14, 0x18, 
-    0x1B, 0x17, 0x0F, 0x03, 0xFC, 0xFB, 0xFF, 0x07, 0x0D, 0x0C, 0x07, 0x00, 
-    0xFC, 0xFD, 0x01, 0x05, 0x08, 0x0A, 0x0B, 0x0A, 0x09, 0x0A, 0x0C, 0x0D, 
-    0x10, 0x13, 0x15, 0x19, 0x1D, 0x24, 0x2A, 0x2C, 0x27, 0x1E, 0x15, 0x12, 
-    0x14, 0x1B, 0x23, 0x2A, 0x28, 0x1F, 0x15, 0x0F, 0x0D, 0x0F, 0x10, 0x0E, 
-    0x0D, 0x0C, 0x0D, 0x0C, 0x08, 0x05, 0x07, 0x0B, 0x12, 0x16, 0x19, 0x1B, 
-    0x1D, 0x1D, 0x18, 0x10, 0x06, 0xFD, 0xF9, 0xFC, 0x01, 0x07, 0x04, 0xFC, 
-    0xF1, 0xEA, 0xE8, 0xEA, 0xEE, 0xF2, 0xF3, 0xEF, 0xEA, 0xE5, 0xE3, 0xE4, 
-    0xE6, 0xEA, 0xF0, 0xF5, 0xF8, 0xFA, 0xFF, 0x07, 0x0B, 0x07, 0xFD, 0xF4, 
-    0xF2, 0xF6, 0xFD, 0x02, 0x05, 0x02, 0xFD, 0xF9, 0xFA, 0xFB, 0xFE, 0x02, 
-    0x05, 0x08, 0x07, 0x04, 0xFF, 0xF9, 0xF5, 0xF3, 0xF4, 0xF8, 0xFB, 0xFE, 
-    0x03, 0x08, 0x0A, 0x06, 0xFC, 0xF2, 0xEB, 0xEA, 0xEF, 0xF7, 0xFF, 0x04, 
-    0xFF, 0xF4, 0xE8, 0xE3, 0xE7, 0xEE, 0xF4, 0xF7, 0xF6, 0xF4, 0xF2, 0xF0, 
-    0xEE, 0xEC, 0xEF, 0xF5, 0xFB, 0xFD, 0xFC, 0xFC, 0xFF, 0x01, 0xFD, 0xF5, 
-    0xEE, 0xEC, 0xF3, 0xFD, 0x04, 0x05, 0x00, 0xF7, 0xF0, 0xED, 0xEE, 0xF1, 
-    0xF5, 0xF9, 0xFA, 0xF8, 0xF4, 0xEF, 0xED, 0xEB, 0xED, 0xF1, 0xF8, 0xFA, 
-    0xFB, 0xFA, 0xFC, 0x00, 0x00, 0xFC, 0xF6, 0xF1, 0xF1, 0xF8, 0x02, 0x0C, 
-    0x12, 0x0E, 0x04, 0xFC, 0xF9, 0xFD, 0x01, 0x04, 0x07, 0x07, 0x01, 0xF8, 
-    0xEE, 0xE5, 0xE2, 0xE2, 0xE8, 0xEE, 0xF1, 0xF3, 0xF6, 0xFC, 0xFD, 0xF7, 
-    0xEC, 0xE3, 0xE2, 0xE9, 0xF2, 0xFA, 0xFE, 0xFE, 0xF8, 0xF0, 0xE9, 0xE8, 
-    0xEE, 0xF9, 0x00, 0x02, 0x00, 0xFB, 0xF7, 0xF3, 0xEE, 0xEE, 0xF3, 0xFA, 
-    0x01, 0x01, 0x00, 0x01, 0x03, 0x04, 0x01, 0xFA, 0xF4, 0xF2, 0xF4, 0xFA, 
-    0xFF, 0x00, 0xFB, 0xF2, 0xEC, 0xEC, 0xF2, 0xF8, 0xFD, 0x01, 0x05, 0x05, 
-    0x01, 0xFA, 0xF5, 0xF4, 0xF8, 0xFE, 0x04, 0x05, 0x03, 0x05, 0x09, 0x0A, 
-    0x05, 0xFD, 0xF4, 0xF0, 0xF2, 0xFA, 0x03, 0x08, 0x07, 0xFF, 0xF2, 0xE9, 
-    0xE6, 0xEA, 0xF2, 0xF7, 0xFB, 0xFC, 0xFC, 0xF8, 0xF2, 0xEA, 0xE6, 0xE9, 
-    0xF2, 0xFB, 0xFE, 0xFC, 0xF9, 0xF6, 0xF4, 0xEF, 0xE8, 0xE4, 0xE5, 0xEE, 
-    0xFB, 0x05, 0x0C, 0x0C, 0x06, 0x01, 0xFF, 0x01, 0x06, 0x0C, 0x13, 0x15, 
-    0x12, 0x0B, 0x02, 0xFC, 0xFA, 0xFB, 0xFE, 0x02, 0x04, 0x01, 0xFE, 0xFE, 
-    0xFE, 0xFB, 0xF3, 0xE7, 0xDF, 0xDC, 0xDF, 0xE2, 0xE3, 0xE1, 0xDF, 0xDC, 
-    0xDA, 0xDC, 0xE0, 0xE6, 0xEA, 0xEE, 0xF0, 0xF0, 0xEC, 0xE6, 0xE0, 0xDE, 
-    0xE1, 0xE9, 0xF3, 0xF7, 0xFA, 0xFD, 0x02, 0x04, 0xFF, 0xF6, 0xEC, 0xE8, 
-    0xEB, 0xF0, 0xF6, 0xFA, 0xFB, 0xF7, 0xEF, 0xE9, 0xE6, 0xEB, 0xF3, 0xFC, 
-    0x01, 0x01, 0x00, 0xFB, 0xF5, 0xEF, 0xEE, 0xF2, 0xFC, 0x04, 0x08, 0x0A, 
-    0x0E, 0x13, 0x14, 0x10, 0x0B, 0x04, 0x03, 0x07, 0x0F, 0x14, 0x14, 0x0D, 
-    0x02, 0xFA, 0xF6, 0xF6, 0xFA, 0xFE, 0x03, 0x06, 0x07, 0x06, 0x05, 0x04, 
-    0x04, 0x04, 0x06, 0x0B, 0x0C, 0x0E, 0x0E, 0x0F, 0x0E, 0x09, 0x04, 0xFC, 
-    0xF8, 0xF7, 0xFB, 0x02, 0x08, 0x0B, 0x09, 0x02, 0xFA, 0xF3, 0xF1, 0xF6, 
-    0x00, 0x06, 0x05, 0x01, 0xFC, 0xF8, 0xF7, 0xF9, 0xFE, 0x07, 0x10, 0x18, 
-    0x21, 0x27, 0x28, 0x23, 0x1B, 0x12, 0x0B, 0x0B, 0x12, 0x1F, 0x2B, 0x2F, 
-    0x2A, 0x1E, 0x13, 0x0D, 0x0D, 0x12, 0x19, 0x1F, 0x22, 0x20, 0x1A, 0x10, 
-    0x07, 0x00, 0xFF, 0x04, 0x0D, 0x14, 0x18, 0x1A, 0x1B, 0x1D, 0x1C, 0x15, 
-    0x0C, 0x05, 0x05, 0x0D, 0x16, 0x1B, 0x1A, 0x14, 0x0E, 0x0A, 0x09, 0x09, 
-    0x0C, 0x12, 0x17, 0x19, 0x18, 0x14, 0x0D, 0x07, 0x05, 0x05, 0x09, 0x0C, 
-    0x0E, 0x12, 0x18, 0x21, 0x27, 0x28, 0x23, 0x1A, 0x16, 0x19, 0x22, 0x2B, 
-    0x2F, 0x2C, 0x22, 0x18, 0x0F, 0x0C, 0x0E, 0x12, 0x15, 0x16, 0x14, 0x11, 
-    0x0B, 0x07, 0x02, 0xFF, 0xFD, 0xFF, 0x02, 0x03, 0x06, 0x05, 0x02, 0x00, 
-    0xFE, 0xFD, 0xFF, 0x02, 0x09, 0x13, 0x1B, 0x1E, 0x1A, 0x12, 0x09, 0x05, 
-    0x05, 0x0B, 0x12, 0x16, 0x14, 0x0E, 0x08, 0x00, 0xF9, 0xF3, 0xF0, 0xEF, 
-    0xF0, 0xEF, 0xEE, 0xEF, 0xF0, 0xF0, 0xEC, 0xE5, 0xDB, 0xD6, 0xD8, 0xE1, 
-    0xEC, 0xF5, 0xF8, 0xF7, 0xF2, 0xEF, 0xF0, 0xF4, 0xFA, 0x03, 0x0D, 0x14, 
-    0x16, 0x14, 0x0E, 0x07, 0x04, 0x04, 0x0B, 0x12, 0x1A, 0x20, 0x24, 0x25, 
-    0x1E, 0x10, 0xFE, 0xF1, 0xED, 0xF2, 0xFA, 0x02, 0x04, 0x01, 0xF9, 0xEF, 
-    0xE7, 0xE5, 0xEA, 0xF3, 0xFC, 0x00, 0xFF, 0xF9, 0xF0, 0xE5, 0xDC, 0xD8, 
-    0xDB, 0xE5, 0xEE, 0xF5, 0xF6, 0xF4, 0xF1, 0xEC, 0xE5, 0xDD, 0xD9, 0xDB, 
-    0xE4, 0xEE, 0xF4, 0xF3, 0xEB, 0xE2, 0xDC, 0xDB, 0xE1, 0xEB, 0xF6, 0x01, 
-    0x08, 0x0D, 0x0D, 0x08, 0x01, 0xFB, 0xFA, 0xFF, 0x06, 0x0B, 0x10, 0x14, 
-    0x14, 0x0E, 0x05, 0xFC, 0xF6, 0xF6, 0xF9, 0xFE, 0x05, 0x07, 0x05, 0xFD, 
-    0xF3, 0xEC, 0xE8, 0xE9, 0xED, 0xF3, 0xFA, 0xFD, 0xFD, 0xF9, 0xF1, 0xEB, 
-    0xE9, 0xEC, 0xF2, 0xF6, 0xFB, 0x00, 0x06, 0x09, 0x07, 0xFE, 0xF3, 0xED, 
-    0xEF, 0xF8, 0x02, 0x08, 0x07, 0x00, 0xF4, 0xE7, 0xDD, 0xDC, 0xE2, 0xEF, 
-    0xFA, 0xFE, 0xFC, 0xF6, 0xEE, 0xE8, 0xE6, 0xEA, 0xF5, 0x01, 0x0C, 0x11, 
-    0x11, 0x0F, 0x09, 0x01, 0xF9, 0xF4, 0xF4, 0xF9, 0xFF, 0x04, 0x05, 0x00, 
-    0xF7, 0xEB, 0xE2, 0xE1, 0xE6, 0xEE, 0xF3, 0xF7, 0xF8, 0xF5, 0xEF, 0xE6, 
-    0xDE, 0xDE, 0xE4, 0xEF, 0xF9, 0x00, 0x07, 0x0C, 0x0F, 0x0E, 0x08, 0xFE, 
-    0xF6, 0xF5, 0xFE, 0x0A, 0x15, 0x19, 0x14, 0x08, 0xF9, 0xF0, 0xED, 0xF0, 
-    0xF8, 0xFF, 0x03, 0x03, 0xFB, 0xEE, 0xE0, 0xD5, 0xD2, 0xD7, 0xE0, 0xEA, 
-    0xF5, 0xFD, 0x00, 0xFB, 0xF2, 0xE9, 0xE4, 0xE9, 0xF7, 0x08, 0x14, 0x1A, 
-    0x18, 0x11, 0x07, 0x00, 0x00, 0x08, 0x16, 0x22, 0x29, 0x27, 0x1F, 0x12, 
-    0x06, 0xFC, 0xF7, 0xF7, 0xFB, 0xFF, 0x00, 0x01, 0xFE, 0xF9, 0xF3, 0xEB, 
-    0xE5, 0xDF, 0xDE, 0xE4, 0xED, 0xF5, 0xF7, 0xF2, 0xE8, 0xDD, 0xD7, 0xD6, 
-    0xDD, 0xE7, 0xF2, 0xFA, 0xFE, 0xFC, 0xF5, 0xEA, 0xDC, 0xD5, 0xD6, 0xDD, 
-    0xE5, 0xEC, 0xEF, 0xF0, 0xEE, 0xE7, 0xDE, 0xD4, 0xCF, 0xD6, 0xE4, 0xF4, 
-    0xFE, 0x03, 0x00, 0xF7, 0xEC, 0xE5, 0xE6, 0xED, 0xFA, 0x06, 0x0E, 0x0F, 
-    0x08, 0xFE, 0xF2, 0xE9, 0xEA, 0xF3, 0x00, 0x08, 0x0E, 0x0D, 0x07, 0xFD, 
-    0xF4, 0xED, 0xEA, 0xEC, 0xF4, 0xFE, 0x05, 0x08, 0x02, 0xF9, 0xEF, 0xEB, 
-    0xED, 0xF6, 0x02, 0x0D, 0x15, 0x16, 0x13, 0x0D, 0x08, 0x03, 0x04, 0x0A, 
-    0x14, 0x1C, 0x20, 0x22, 0x20, 0x1C, 0x15, 0x0C, 0x04, 0xFF, 0x00, 0x06, 
-    0x0E, 0x11, 0x10, 0x09, 0xFE, 0xF4, 0xEF, 0xF0, 0xF7, 0x01, 0x09, 0x0F, 
-    0x0F, 0x0C, 0x05, 0xFD, 0xF8, 0xF6, 0xFD, 0x08, 0x12, 0x1B, 0x1F, 0x1E, 
-    0x1A, 0x15, 0x0C, 0x06, 0x08, 0x0E, 0x19, 0x20, 0x23, 0x1B, 0x0F, 0xFF, 
-    0xF1, 0xEA, 0xEF, 0xF9, 0x0A, 0x1A, 0x1F, 0x1C, 0x14, 0x0B, 0x05, 0x08, 
-    0x0F, 0x18, 0x22, 0x27, 0x28, 0x29, 0x20, 0x1A, 0x13, 0x0D, 0x0D, 0x12, 
-    0x1F, 0x27, 0x2D, 0x28, 0x1E, 0x10, 0x00, 0xFA, 0xFA, 0xFE, 0x0B, 0x0F, 
-    0x12, 0x12, 0x12, 0x0F, 0x0D, 0x0A, 0x08, 0x11, 0x20, 0x2D, 0x3D, 0x45, 
-    0x45, 0x42, 0x36, 0x33, 0x24, 0x1F, 0x27, 0x2C, 0x38, 0x3F, 0x3D, 0x39, 
-    0x2E, 0x20, 0x1B, 0x16, 0x1A, 0x1B, 0x20, 0x23, 0x1E, 0x1A, 0x13, 0x09, 
-    0x0A, 0x07, 0x0C, 0x0D, 0x0A, 0x0D, 0x08, 0x03, 0xFE, 0xFB, 0xF5, 0xF6, 
-    0xF9, 0x00, 0x08, 0x12, 0x12, 0x0A, 0x02, 0xF3, 0xEC, 0xEF, 0xF3, 0xFD, 
-    0x09, 0x08, 0x08, 0xFF, 0xF8, 0xF1, 0xEB, 0xED, 0xF2, 0xFE, 0x05, 0x0B, 
-    0x0E, 0x0C, 0x07, 0x01, 0xFF, 0x01, 0x08, 0x12, 0x20, 0x21, 0x22, 0x19, 
-    0x08, 0xFB, 0xEA, 0xE7, 0xEA, 0xF8, 0x06, 0x11, 0x19, 0x19, 0x15, 0x0C, 
-    0x02, 0xFE, 0x00, 0x04, 0x0D, 0x0D, 0x11, 0x0E, 0x09, 0xFE, 0xF1, 0xE6, 
-    0xD9, 0xD9, 0xDE, 0xEE, 0xFC, 0x04, 0x01, 0xFD, 0xF4, 0xF2, 0xF0, 0xF4, 
-    0x02, 0x0A, 0x1A, 0x19, 0x15, 0x0C, 0xFE, 0xF9, 0xF5, 0xF6, 0xFA, 0x00, 
-    0x06, 0x07, 0x03, 0xFD, 0xF3, 0xE8, 0xE5, 0xE2, 0xE4, 0xE9, 0xEC, 0xEC, 
-    0xE3, 0xDA, 0xD3, 0xCC, 0xD2, 0xDC, 0xE9, 0xF6, 0xF7, 0xF8, 0xF4, 0xF3, 
-    0xE9, 0xE5, 0xE4, 0xEB, 0xF7, 0xFE, 0x04, 0x00, 0xFB, 0xF1, 0xEB, 0xE3, 
-    0xD7, 0xD5, 0xD5, 0xDC, 0xE7, 0xEB, 0xF1, 0xED, 0xE5, 0xDA, 0xD2, 0xD3, 
-    0xDB, 0xEF, 0xFE, 0x07, 0x0C, 0x08, 0xFF, 0xF4, 0xEA, 0xE6, 0xE7, 0xF3, 
-    0xFB, 0x01, 0x07, 0x02, 0xFC, 0xF0, 0xE7, 0xE1, 0xDC, 0xE2, 0xE8, 0xF1, 
-    0xF4, 0xEC, 0xE3, 0xD5, 0xC9, 0xBF, 0xC0, 0xC7, 0xD4, 0xDF, 0xE9, 0xF2, 
-    0xF5, 0xF9, 0xF8, 0xF9, 0xFE, 0x09, 0x12, 0x1C, 0x26, 0x2B, 0x2C, 0x25, 
-    0x20, 0x16, 0x0C, 0x04, 0x01, 0x02, 0xFC, 0xFB, 0xF3, 0xEA, 0xE5, 0xDE, 
-    0xE3, 0xEB, 0xFA, 0x06, 0x0C, 0x0E, 0x05, 0x00, 0xF7, 0xF8, 0xF7, 0xFC, 
-    0x06, 0x0A, 0x10, 0x0F, 0x09, 0x01, 0xFB, 0xF6, 0xF6, 0xF7, 0xF6, 0xFA, 
-    0xFD, 0xFE, 0xFC, 0xEE, 0xE9, 0xDE, 0xDE, 0xE2, 0xEA, 0xF9, 0x03, 0x0F, 
-    0x14, 0x15, 0x0F, 0x0C, 0x04, 0x05, 0x0B, 0x19, 0x27, 0x35, 0x38, 0x39, 
-    0x38, 0x2A, 0x22, 0x18, 0x11, 0x17, 0x20, 0x2A, 0x31, 0x31, 0x2B, 0x20, 
-    0x17, 0x0A, 0x0D, 0x10, 0x17, 0x19, 0x1D, 0x1C, 0x18, 0x14, 0x0B, 0x0E, 
-    0x0C, 0x13, 0x11, 0x13, 0x11, 0x0E, 0x0E, 0x0D, 0x09, 0x08, 0x09, 0x0D, 
-    0x11, 0x11, 0x14, 0x0D, 0x0A, 0x01, 0xFC, 0xF5, 0xF5, 0xF6, 0xFC, 0xFE, 
-    0x03, 0x03, 0x05, 0x04, 0x02, 0x04, 0x02, 0x0E, 0x17, 0x1F, 0x1F, 0x1A, 
-    0x10, 0x08, 0xFE, 0xF6, 0xEE, 0xEC, 0xEF, 0xF5, 0xFB, 0x02, 0x00, 0xF7, 
-    0xEF, 0xE7, 0xEC, 0xF1, 0xFE, 0x06, 0x15, 0x19, 0x1B, 0x16, 0x0E, 0x04, 
-    0xF9, 0xF5, 0xF6, 0xFC, 0x01, 0x05, 0x05, 0x04, 0x01, 0xFF, 0xF9, 0xF3, 
-    0xF1, 0xFA, 0x02, 0x0E, 0x12, 0x11, 0x09, 0x02, 0xF8, 0xF5, 0xF6, 0xF7, 
-    0x01, 0x05, 0x0D, 0x0A, 0x09, 0x04, 0xF8, 0xF5, 0xF1, 0xF3, 0xF8, 0xFB, 
-    0xFF, 0xFB, 0xF9, 0xF4, 0xF2, 0xF2, 0xF1, 0xF2, 0xF1, 0xEF, 0xED, 0xEA, 
-    0xE7, 0xE5, 0xE0, 0xE0, 0xE2, 0xE9, 0xF4, 0xF6, 0xF8, 0xF4, 0xED, 0xEF, 
-    0xEC, 0xEE, 0xF1, 0xF6, 0xF8, 0xFC, 0xFD, 0xF9, 0xF4, 0xF0, 0xEB, 0xE6, 
-    0xE4, 0xE4, 0xE9, 0xF0, 0xF4, 0xF2, 0xE8, 0xDD, 0xD2, 0xC8, 0xC8, 0xC9, 
-    0xD5, 0xDF, 0xEA, 0xF3, 0xF1, 0xEE, 0xE6, 0xDE, 0xDD, 0xDF, 0xEB, 0xF6, 
-    0x01, 0x0A, 0x07, 0x03, 0xF5, 0xEA, 0xDD, 0xD5, 0xD0, 0xCF, 0xD6, 0xDC, 
-    0xDC, 0xDD, 0xD9, 0xD8, 0xD5, 0xD7, 0xDC, 0xE6, 0xF4, 0xFE, 0x0A, 0x0E, 
-    0x0B, 0x07, 0x02, 0xFF, 0x01, 0x02, 0x04, 0x0A, 0x0C, 0x0F, 0x15, 0x13, 
-    0x12, 0x0D, 0x07, 0x06, 0x03, 0xFF, 0xFC, 0xFA, 0xF3, 0xEF, 0xEC, 0xEB, 
-    0xF4, 0xFB, 0x04, 0x07, 0x07, 0x05, 0x03, 0x07, 0x0A, 0x0E, 0x13, 0x15, 
-    0x19, 0x1A, 0x18, 0x12, 0x0B, 0x06, 0x03, 0x03, 0x04, 0x08, 0x0C, 0x0F, 
-    0x0D, 0x0B, 0x02, 0xFE, 0xF3, 0xEE, 0xF2, 0xF3, 0x00, 0x08, 0x13, 0x16, 
-    0x12, 0x0D, 0xFD, 0xF8, 0xF4, 0xF9, 0x06, 0x11, 0x1A, 0x1F, 0x20, 0x1D, 
-    0x1D, 0x16, 0x13, 0x0E, 0x11, 0x1A, 0x21, 0x28, 0x24, 0x1D, 0x13, 0x05, 
-    0xFB, 0xF5, 0xF4, 0xFB, 0x02, 0x0A, 0x0A, 0x0D, 0x11, 0x19, 0x1C, 0x1F, 
-    0x25, 0x22, 0x28, 0x2A, 0x2E, 0x30, 0x2A, 0x26, 0x1C, 0x12, 0x07, 0xFD, 
-    0xF5, 0xF0, 0xED, 0xF0, 0xED, 0xEC, 0xF0, 0xF4, 0xFB, 0x00, 0x06, 0x08, 
-    0x0D, 0x0C, 0x0D, 0x0C, 0x0D, 0x10, 0x13, 0x17, 0x19, 0x1A, 0x13, 0x0A, 
-    0x02, 0xFA, 0xF8, 0xF8, 0xF8, 0xFC, 0xFF, 0x02, 0x04, 0x04, 0x03, 0xFB, 
-    0xF6, 0xF1, 0xF8, 0x04, 0x0C, 0x19, 0x1E, 0x1B, 0x10, 0x08, 0x00, 0xFA, 
-    0xF9, 0xF8, 0xFA, 0xFC, 0x00, 0x04, 0x02, 0xFF, 0xF6, 0xEE, 0xEA, 0xE6, 
-    0xEF, 0xF5, 0x01, 0x0B, 0x07, 0x04, 0xFA, 0xF0, 0xEC, 0xE9, 0xEC, 0xEE, 
-    0xF5, 0xF8, 0xFC, 0xFE, 0xFC, 0xF5, 0xF1, 0xEF, 0xEE, 0xF0, 0xF1, 0xF4, 
-    0xF8, 0xFD, 0x02, 0x03, 0x06, 0x03, 0x01, 0xFE, 0xFC, 0xFC, 0xF9, 0xFB, 
-    0xF4, 0xEE, 0xE4, 0xDD, 0xDB, 0xDE, 0xE1, 0xDF, 0xE2, 0xE1, 0xE3, 0xE5, 
-    0xE7, 0xEA, 0xF3, 0xF8, 0x00, 0x01, 0x01, 0x01, 0xFA, 0xF7, 0xEF, 0xE8, 
-    0xE6, 0xE8, 0xEA, 0xF0, 0xF0, 0xE8, 0xDE, 0xD1, 0xC8, 0xC5, 0xD2, 0xDE, 
-    0xED, 0xFA, 0xFF, 0x00, 0xFF, 0xFA, 0xF6, 0xF3, 0xF0, 0xFB, 0xFB, 0x06, 
-    0x09, 0x07, 0x04, 0xF6, 0xEE, 0xE1, 0xDA, 0xD4, 0xD6, 0xDB, 0xE2, 0xE8, 
-    0xEA, 0xE9, 0xDD, 0xD9, 0xD3, 0xD1, 0xD5, 0xE1, 0xEC, 0xF0, 0xF7, 0xF3, 
-    0xF3, 0xEC, 0xEA, 0xE2, 0xE3, 0xEA, 0xED, 0xF7, 0xFC, 0x02, 0x06, 0x07, 
-    0x06, 0x02, 0x00, 0x03, 0x03, 0x08, 0x08, 0x06, 0x01, 0xFC, 0xF8, 0xFD, 
-    0x01, 0x08, 0x07, 0x08, 0x07, 0x06, 0x0A, 0x09, 0x0B, 0x0A, 0x10, 0x10, 
-    0x12, 0x10, 0x0E, 0x08, 0x06, 0x05, 0x02, 0x07, 0x0A, 0x12, 0x1A, 0x1B, 
-    0x1A, 0x11, 0x06, 0xFC, 0xF3, 0xF1, 0xF3, 0xFC, 0x05, 0x0C, 0x0F, 0x0A, 
-    0x03, 0xF9, 0xF6, 0xF9, 0x03, 0x13, 0x1D, 0x29, 0x2E, 0x32, 0x30, 0x2A, 
-    0x26, 0x1C, 0x1C, 0x1C, 0x1F, 0x22, 0x21, 0x21, 0x1A, 0x12, 0x07, 0xFF, 
-    0xFB, 0xFF, 0x02, 0x0A, 0x11, 0x14, 0x1E, 0x22, 0x24, 0x28, 0x24, 0x22, 
-    0x21, 0x1D, 0x1C, 0x1B, 0x1A, 0x13, 0x0E, 0x03, 0xF7, 0xED, 0xE5, 0xDF, 
-    0xE1, 0xE7, 0xE9, 0xEC, 0xEC, 0xF3, 0xF9, 0x01, 0x0A, 0x11, 0x13, 0x19, 
-    0x16, 0x17, 0x17, 0x12, 0x13, 0x14, 0x1E, 0x1E, 0x1C, 0x12, 0x08, 0xFF, 
-    0xFA, 0xFC, 0xFE, 0x03, 0x07, 0x0C, 0x0E, 0x0F, 0x0D, 0x04, 0xFE, 0xF7, 
-    0xF7, 0xFE, 0x08, 0x12, 0x17, 0x1C, 0x17, 0x11, 0x09, 0x01, 0xFB, 0xFA, 
-    0xFC, 0x01, 0x05, 0x07, 0x0A, 0x0C, 0x08, 0x05, 0xFF, 0xF7, 0xF8, 0xFB, 
-    0x04, 0x08, 0x12, 0x0F, 0x0A, 0x02, 0xF7, 0xEF, 0xE9, 0xEE, 0xEE, 0xF5, 
-    0xFB, 0xFC, 0xFC, 0xFB, 0xF9, 0xF8, 0xF6, 0xFB, 0xFC, 0x05, 0x06, 0x09, 
-    0x0C, 0x09, 0x0A, 0x04, 0xFF, 0xF5, 0xF0, 0xE4, 0xE6, 0xE3, 0xE2, 0xDE, 
-    0xD5, 0xD0, 0xCD, 0xD0, 0xCE, 0xD3, 0xD8, 0xDB, 0xDE, 0xE1, 0xE2, 0xE7, 
-    0xEE, 0xF4, 0xFE, 0x03, 0x04, 0x03, 0xFD, 0xFC, 0xF6, 0xF0, 0xEC, 0xE4, 
-    0xEB, 0xEE, 0xF2, 0xF4, 0xF1, 0xEA, 0xDE, 0xDC, 0xDC, 0xE6, 0xF1, 0xFC, 
-    0x01, 0x04, 0x03, 0x01, 0xFE, 0xF7, 0xF5, 0xF3, 0xF9, 0xFD, 0x02, 0x01, 
-    0xFD, 0xF8, 0xF3, 0xED, 0xE8, 0xE1, 0xDC, 0xDE, 0xE2, 0xE9, 0xED, 0xF2, 
-    0xEE, 0xED, 0xE6, 0xDE, 0xE1, 0xE2, 0xEF, 0xF6, 0xFD, 0xFD, 0xFA, 0xF7, 
-    0xF0, 0xEC, 0xE7, 0xEA, 0xEC, 0xF4, 0xF4, 0xF5, 0xFB, 0xF9, 0xFD, 0xFC, 
-    0xFA, 0xFF, 0x04, 0x0C, 0x13, 0x12, 0x13, 0x07, 0x00, 0xFD, 0xFA, 0xFD, 
-    0xFC, 0xFE, 0xF8, 0xF6, 0xF2, 0xF1, 0xF3, 0xF6, 0xF9, 0xFE, 0x03, 0x06, 
-    0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x10, 0x10, 0x11, 0x0C, 
-    0x0A, 0x00, 0xFD, 0xF5, 0xF5, 0xF7, 0xFD, 0x03, 0x08, 0x0F, 0x0D, 0x0C, 
-    0x08, 0x06, 0x09, 0x16, 0x1E, 0x2B, 0x2D, 0x31, 0x2C, 0x27, 0x24, 0x1B, 
-    0x14, 0x0F, 0x09, 0x08, 0x0C, 0x12, 0x12, 0x0E, 0x06, 0x00, 0xFD, 0xFD, 
-    0x05, 0x0A, 0x13, 0x16, 0x1D, 0x20, 0x24, 0x25, 0x22, 0x23, 0x23, 0x27, 
-    0x25, 0x23, 0x24, 0x22, 0x1C, 0x17, 0x0A, 0x03, 0xFA, 0xF4, 0xF5, 0xF7, 
-    0xFB, 0xFE, 0xFD, 0xF8, 0xF8, 0xFA, 0x02, 0x07, 0x0A, 0x0E, 0x12, 0x14, 
-    0x1B, 0x15, 0x12, 0x13, 0x10, 0x17, 0x12, 0x0D, 0x07, 0xFD, 0xFA, 0xFA, 
-    0xFA, 0xFB, 0xFC, 0xFE, 0xFD, 0xFE, 0xFD, 0xFC, 0xFA, 0xF6, 0xF3, 0xEF, 
-    0xF2, 0xF7, 0xFC, 0x02, 0x03, 0x01, 0xFE, 0xFB, 0xFB, 0xFB, 0xFD, 0x03, 
-    0x0A, 0x12, 0x17, 0x17, 0x17, 0x17, 0x14, 0x0F, 0x0A, 0x06, 0x06, 0x0D, 
-    0x14, 0x15, 0x14, 0x0A, 0xFE, 0xF4, 0xE9, 0xE9, 0xEB, 0xF2, 0xF7, 0xFB, 
-    0xFD, 0xFE, 0xFE, 0xFC, 0xFD, 0xFE, 0x03, 0x09, 0x0C, 0x11, 0x0F, 0x0D, 
-    0x0E, 0x08, 0x06, 0xFC, 0xF5, 0xF0, 0xE9, 0xED, 0xEE, 0xED, 0xEA, 0xE4, 
-    0xDF, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE2, 0xE7, 0xE6, 0xE6, 0xE7, 0xE7, 
-    0xED, 0xEE, 0xF1, 0xEC, 0xEC, 0xE8, 0xE7, 0xEA, 0xE6, 0xE8, 0xE4, 0xE4, 
-    0xE6, 0xE7, 0xEB, 0xE8, 0xE6, 0xDE, 0xDA, 0xDE, 0xE6, 0xED, 0xF3, 0xF9, 
-    0xF8, 0xF7, 0xF6, 0xF0, 0xEB, 0xED, 0xF0, 0xF6, 0xFC, 0x00, 0xFC, 0xF9, 
-    0xF5, 0xF2, 0xED, 0xE9, 0xE4, 0xE4, 0xE8, 0xF2, 0xFA, 0xFE, 0xFE, 0xF5, 
-    0xEF, 0xE4, 0xE1, 0xE1, 0xE7, 0xEF, 0xF6, 0xFC, 0xF8, 0xF7, 0xF0, 0xEB, 
-    0xEA, 0xE8, 0xEF, 0xF2, 0xF6, 0xF8, 0xF7, 0xFB, 0xFD, 0xFF, 0xFA, 0xF8, 
-    0xF5, 0xF8, 0xFD, 0x02, 0x08, 0x08, 0x04, 0x00, 0xFF, 0x00, 0x05, 0x04, 
-    0x08, 0x05, 0x09, 0x0C, 0x0F, 0x10, 0x0E, 0x11, 0x11, 0x19, 0x19, 0x16, 
-    0x14, 0x15, 0x14, 0x13, 0x0C, 0x07, 0xFF, 0xFC, 0xFB, 0xFC, 0x01, 0xFF, 
-    0xFD, 0xF3, 0xF2, 0xF3, 0xF9, 0x02, 0x0A, 0x11, 0x11, 0x10, 0x0A, 0x03, 
-    0xFD, 0xFE, 0x03, 0x0C, 0x12, 0x10, 0x12, 0x0D, 0x09, 0x05, 0x03, 0x01, 
-    0xFA, 0xFE, 0xFD, 0x04, 0x0D, 0x0F, 0x11, 0x0A, 0x02, 0xFE, 0x00, 0x09, 
-    0x14, 0x1C, 0x24, 0x26, 0x2C, 0x32, 0x2F, 0x2C, 0x28, 0x26, 0x28, 0x28, 
-    0x2A, 0x29, 0x27, 0x27, 0x1F, 0x1A, 0x0E, 0x05, 0xFF, 0x00, 0x02, 0x02, 
-    0x06, 0xFD, 0xFC, 0xF4, 0xF1, 0xF1, 0xF1, 0xF9, 0xFD, 0x06, 0x08, 0x0C, 
-    0x0D, 0x0F, 0x11, 0x15, 0x17, 0x1A, 0x1D, 0x15, 0x15, 0x11, 0x11, 0x12, 
-    0x0F, 0x07, 0xFF, 0xFB, 0xF9, 0xFC, 0xFC, 0xF9, 0xF0, 0xED, 0xE5, 0xE3, 
-    0xE4, 0xE9, 0xF0, 0xF1, 0xF2, 0xF0, 0xF0, 0xF0, 0xF4, 0xFA, 0x01, 0x0B, 
-    0x12, 0x18, 0x1B, 0x1C, 0x17, 0x10, 0x06, 0xFE, 0xF9, 0xF6, 0xF8, 0xF9, 
-    0xFC, 0xFB, 0xF5, 0xED, 0xE7, 0xE7, 0xE8, 0xEE, 0xF2, 0xF6, 0xFC, 0xFD, 
-    0x04, 0x03, 0x01, 0xFF, 0x00, 0x06, 0x0C, 0x10, 0x13, 0x16, 0x15, 0x1B, 
-    0x18, 0x11, 0x08, 0xFA, 0xF4, 0xF0, 0xF4, 0xF9, 0xFC, 0xFB, 0xF2, 0xEA, 
-    0xE5, 0xE0, 0xE1, 0xDF, 0xE4, 0xE7, 0xE9, 0xE8, 0xE6, 0xE6, 0xE4, 0xE3, 
-    0xE6, 0xE6, 0xE3, 0xE6, 0xE7, 0xEA, 0xEC, 0xEC, 0xEB, 0xEA, 0xE9, 0xEC, 
-    0xF1, 0xF1, 0xF1, 0xEE, 0xE7, 0xE5, 0xE4, 0xE7, 0xED, 0xEE, 0xF2, 0xF3, 
-    0xF4, 0xF5, 0xF5, 0xF6, 0xF6, 0xF9, 0x01, 0x00, 0x04, 0x03, 0x02, 0x02, 
-    0x00, 0xFC, 0xF6, 0xF7, 0xF3, 0xF1, 0xED, 0xF3, 0xF5, 0xF3, 0xEE, 0xE2, 
-    0xD6, 0xCB, 0xC9, 0xCB, 0xD3, 0xDA, 0xDF, 0xDF, 0xE2, 0xE1, 0xE4, 0xE5, 
-    0xE4, 0xEC, 0xF2, 0xFB, 0xFF, 0x03, 0x04, 0x04, 0x01, 0xF9, 0xF3, 0xE8, 
-    0xE8, 0xEE, 0xF8, 0xFF, 0x01, 0x02, 0xFE, 0xFD, 0xFD, 0xFA, 0xFD, 0xFD, 
-    0x00, 0x07, 0x0A, 0x13, 0x13, 0x16, 0x18, 0x19, 0x1E, 0x1F, 0x1E, 0x1D, 
-    0x1D, 0x1E, 0x1E, 0x17, 0x0E, 0x06, 0xFF, 0xFD, 0xFD, 0x00, 0x02, 0x04, 
-    0xFF, 0xFB, 0xFC, 0xFD, 0x05, 0x08, 0x0A, 0x09, 0x05, 0x01, 0xFF, 0xFE, 
-    0xFF, 0x07, 0x0E, 0x13, 0x15, 0x15, 0x13, 0x14, 0x13, 0x14, 0x10, 0x0D, 
-    0x0C, 0x0B, 0x0D, 0x0F, 0x11, 0x0F, 0x0A, 0x01, 0xFE, 0xFA, 0xFE, 0x02, 
-    0x0A, 0x10, 0x11, 0x19, 0x1A, 0x1B, 0x18, 0x15, 0x0F, 0x14, 0x19, 0x1E, 
-    0x23, 0x26, 0x2A, 0x28, 0x24, 0x1B, 0x0F, 0x09, 0x0B, 0x0E, 0x12, 0x13, 
-    0x0F, 0x07, 0xFD, 0xF3, 0xF1, 0xF0, 0xF3, 0xF8, 0x00, 0x04, 0x04, 0x05, 
-    0x08, 0x10, 0x13, 0x19, 0x1B, 0x17, 0x15, 0x13, 0x15, 0x17, 0x19, 0x19, 
-    0x11, 0x0C, 0x06, 0x04, 0x02, 0x01, 0xFF, 0xFC, 0xF9, 0xF2, 0xF3, 0xF2, 
-    0xEF, 0xF1, 0xF1, 0xF3, 0xF7, 0xF6, 0xFC, 0xFE, 0x04, 0x07, 0x0B, 0x11, 
-    0x15, 0x17, 0x13, 0x13, 0x0F, 0x0A, 0x06, 0xFD, 0xFC, 0xFF, 0x01, 0x0B, 
-    0x0B, 0x08, 0x01, 0xF9, 0xF4, 0xF4, 0xF6, 0xF6, 0xFB, 0xFB, 0xFC, 0xFA, 
-    0xF7, 0xF5, 0xF6, 0xF9, 0xFC, 0xFF, 0x04, 0x06, 0x09, 0x0A, 0x0D, 0x0C, 
-    0x07, 0x00, 0xF4, 0xEC, 0xE6, 0xE8, 0xED, 0xEE, 0xEC, 0xE8, 0xE0, 0xDD, 
-    0xD6, 0xD7, 0xD5, 0xD9, 0xDC, 0xDB, 0xE1, 0xE0, 0xE5, 0xE5, 0xEA, 0xEB, 
-    0xEF, 0xF4, 0xF7, 0xFA, 0xFF, 0x01, 0x03, 0xFD, 0xF7, 0xF5, 0xEF, 0xEB, 
-    0xE7, 0xE5, 0xE0, 0xE1, 0xDC, 0xDD, 0xE1, 0xE3, 0xE6, 0xE9, 0xEC, 0xED, 
-    0xF1, 0xF6, 0xFB, 0xFE, 0x03, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x14, 
-    0x15, 0x14, 0x0E, 0x03, 0xFE, 0xF9, 0xFC, 0xFE, 0xFD, 0xF6, 0xE9, 0xE0, 
-    0xDA, 0xD6, 0xD5, 0xD7, 0xD8, 0xE1, 0xE4, 0xE7, 0xE8, 0xE6, 0xE7, 0xE9, 
-    0xEF, 0xF2, 0xF5, 0xF8, 0xF6, 0xF7, 0xF9, 0xF9, 0xF8, 0xF1, 0xED, 0xEA, 
-    0xED, 0xF2, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xF7, 0xF3, 0xEF, 0xF1, 
-    0xF4, 0xF9, 0x00, 0x06, 0x09, 0x0D, 0x0E, 0x0E, 0x10, 0x12, 0x15, 0x1C, 
-    0x25, 0x29, 0x28, 0x22, 0x18, 0x11, 0x0E, 0x0A, 0x0F, 0x10, 0x12, 0x0E, 
-    0x0B, 0x0A, 0x03, 0x04, 0x01, 0x01, 0x02, 0xFF, 0xFD, 0xF9, 0xF9, 0xFF, 
-    0x00, 0x06, 0x0A, 0x0E, 0x12, 0x11, 0x14, 0x18, 0x1C, 0x19, 0x14, 0x0E, 
-    0x08, 0x08, 0x09, 0x0A, 0x0C, 0x07, 0x07, 0x05, 0x05, 0x04, 0x03, 0x04, 
-    0x04, 0x0B, 0x0E, 0x14, 0x18, 0x1B, 0x1B, 0x1C, 0x20, 0x27, 0x2D, 0x32, 
-    0x34, 0x39, 0x3D, 0x39, 0x31, 0x26, 0x1C, 0x17, 0x17, 0x18, 0x19, 0x12, 
-    0x0B, 0xFF, 0xF9, 0xF5, 0xF1, 0xF0, 0xEF, 0xF0, 0xF6, 0xFC, 0x00, 0x02, 
-    0x04, 0x08, 0x08, 0x09, 0x04, 0x01, 0xFF, 0x01, 0x05, 0x09, 0x08, 0x03, 
-    0xFB, 0xF2, 0xEF, 0xEF, 0xF7, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF6, 0xF4, 
-    0xF4, 0xF4, 0xF6, 0xF9, 0xFB, 0xFE, 0x00, 0x05, 0x05, 0x09, 0x0B, 0x0E, 
-    0x13, 0x13, 0x17, 0x18, 0x17, 0x15, 0x11, 0x10, 0x10, 0x11, 0x15, 0x13, 
-    0x11, 0x0D, 0x06, 0x04, 0x03, 0x03, 0x01, 0xFE, 0xFC, 0xFB, 0xF9, 0xF9, 
-    0xF4, 0xF6, 0xFA, 0xFA, 0x00, 0x01, 0x01, 0x05, 0x09, 0x0E, 0x16, 0x15, 
-    0x0A, 0x00, 0xF5, 0xF4, 0xF7, 0xFB, 0xFD, 0xFB, 0xF5, 0xF0, 0xEA, 0xE6, 
-    0xE0, 0xDF, 0xDE, 0xDC, 0xDF, 0xDE, 0xDF, 0xDE, 0xDD, 0xDC, 0xDF, 0xE2, 
-    0xE5, 0xE8, 0xED, 0xF1, 0xF5, 0xF7, 0xF5, 0xED, 0xE7, 0xE4, 0xDE, 0xDF, 
-    0xDD, 0xDB, 0xDD, 0xDC, 0xDE, 0xDE, 0xE0, 0xE1, 0xDE, 0xDF, 0xDF, 0xE4, 
-    0xEB, 0xF1, 0xF7, 0xF9, 0xFE, 0xFF, 0x01, 0xFE, 0xFE, 0x01, 0x04, 0x09, 
-    0x08, 0x05, 0xFF, 0xF8, 0xF7, 0xF9, 0xFE, 0x01, 0x00, 0xFA, 0xF2, 0xEF, 
-    0xE8, 0xE8, 0xE9, 0xE7, 0xE8, 0xE6, 0xE5, 0xE7, 0xE8, 0xE7, 0xE7, 0xE5, 
-    0xE7, 0xE6, 0xE9, 0xEA, 0xEE, 0xF2, 0xF5, 0xF6, 0xF2, 0xEF, 0xEE, 0xEF, 
-    0xF4, 0xF7, 0xF4, 0xF6, 0xF9, 0xFD, 0xFD, 0xF8, 0xF3, 0xF3, 0xF6, 0xFC, 
-    0x01, 0x06, 0x0B, 0x10, 0x15, 0x14, 0x14, 0x14, 0x16, 0x1A, 0x1D, 0x24, 
-    0x2C, 0x2C, 0x2A, 0x21, 0x16, 0x0E, 0x09, 0x0C, 0x0C, 0x0A, 0x09, 0x06, 
-    0x06, 0x06, 0x03, 0x04, 0xFC, 0xFA, 0xF8, 0xF7, 0xF9, 0xFA, 0x02, 0x06, 
-    0x07, 0x07, 0x04, 0x03, 0x09, 0x0A, 0x11, 0x14, 0x13, 0x12, 0x0A, 0x04, 
-    0x00, 0xFE, 0xFD, 0xFE, 0x00, 0x01, 0x02, 0x04, 0x02, 0x03, 0x03, 0x04, 
-    0x07, 0x0C, 0x13, 0x19, 0x1D, 0x1C, 0x1F, 0x23, 0x27, 0x2D, 0x2F, 0x33, 
-    0x38, 0x3C, 0x3F, 0x3E, 0x37, 0x31, 0x2C, 0x27, 0x28, 0x28, 0x24, 0x20, 
-    0x1C, 0x19, 0x14, 0x10, 0x0D, 0x0A, 0x08, 0x07, 0x06, 0x06, 0x0B, 0x12, 
-    0x15, 0x16, 0x11, 0x09, 0x04, 0x03, 0x04, 0x07, 0x08, 0x06, 0x03, 0xF9, 
-    0xF0, 0xE8, 0xE3, 0xE1, 0xE2, 0xE5, 0xE9, 0xED, 0xF0, 0xF1, 0xEF, 0xED, 
-    0xEA, 0xEC, 0xED, 0xF3, 0xF8, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0xFB, 0xF6, 
-    0xF8, 0xF7, 0xFD, 0x02, 0x04, 0x04, 0x02, 0xFF, 0xFE, 0x01, 0x06, 0x07, 
-    0x10, 0x13, 0x19, 0x1C, 0x1B, 0x1D, 0x17, 0x19, 0x17, 0x15, 0x12, 0x11, 
-    0x0F, 0x0F, 0x0C, 0x09, 0x06, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x04, 0xFE, 
-    0xF5, 0xEE, 0xEB, 0xE9, 0xEC, 0xEB, 0xEF, 0xF1, 0xF3, 0xF5, 0xF5, 0xF7, 
-    0xF5, 0xF6, 0xF4, 0xF4, 0xF2, 0xF1, 0xF0, 0xEF, 0xF0, 0xEE, 0xE9, 0xE1, 
-    0xDD, 0xDB, 0xDD, 0xE1, 0xE2, 0xE4, 0xE5, 0xE4, 0xDE, 0xDB, 0xD9, 0xD8, 
-    0xDF, 0xE7, 0xF1, 0xF7, 0xFA, 0xF9, 0xF7, 0xF5, 0xF4, 0xF4, 0xF6, 0xFD, 
-    0xFF, 0x01, 0x01, 0xFE, 0xFA, 0xF4, 0xEF, 0xEB, 0xE9, 0xEE, 0xF1, 0xF5, 
-    0xF3, 0xEF, 0xEC, 0xE7, 0xE6, 0xE5, 0xE7, 0xE5, 0xE3, 0xE0, 0xDE, 0xDE, 
-    0xE1, 0xE1, 0xE6, 0xE6, 0xE8, 0xE7, 0xE6, 0xE8, 0xEB, 0xEE, 0xF2, 0xF4, 
-    0xF5, 0xF6, 0xF3, 0xF1, 0xEF, 0xF3, 0xF3, 0xF6, 0xF0, 0xEB, 0xE7, 0xE5, 
-    0xE4, 0xE4, 0xE8, 0xE8, 0xEE, 0xF3, 0xFB, 0xFB, 0xFF, 0xFF, 0x01, 0x09, 
-    0x0C, 0x12, 0x18, 0x1B, 0x1D, 0x1E, 0x1F, 0x1F, 0x20, 0x20, 0x1E, 0x21, 
-    0x23, 0x22, 0x1F, 0x14, 0x0A, 0x06, 0x00, 0xFF, 0xFF, 0x01, 0x05, 0x08, 
-    0x0A, 0x0A, 0x0B, 0x0D, 0x0C, 0x0E, 0x0C, 0x0F, 0x14, 0x16, 0x1D, 0x1C, 
-    0x1B, 0x15, 0x12, 0x0D, 0x0C, 0x0C, 0x0E, 0x0D, 0x0A, 0x05, 0xFB, 0xF3, 
-    0xF0, 0xEF, 0xEC, 0xED, 0xEF, 0xF1, 0xF4, 0xF6, 0xF6, 0xFB, 0xFB, 0xFD, 
-    0xFF, 0x00, 0x06, 0x06, 0x0C, 0x0E, 0x12, 0x16, 0x1A, 0x1D, 0x1D, 0x1D, 
-    0x1D, 0x1F, 0x21, 0x24, 0x21, 0x1E, 0x1A, 0x19, 0x15, 0x15, 0x13, 0x15, 
-    0x14, 0x14, 0x16, 0x16, 0x19, 0x14, 0x18, 0x16, 0x1B, 0x1F, 0x26, 0x29, 
-    0x25, 0x1F, 0x17, 0x13, 0x10, 0x0F, 0x0D, 0x10, 0x0D, 0x0D, 0x05, 0xFB, 
-    0xEE, 0xE8, 0xE7, 0xEA, 0xEC, 0xEF, 0xF0, 0xEF, 0xF1, 0xF1, 0xF3, 0xF4, 
-    0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xF7, 0xF6, 0xF1, 0xF1, 0xEF, 0xF2, 0xF4, 
-    0xF8, 0xFA, 0xF8, 0xF8, 0xF7, 0xF9, 0xF5, 0xF7, 0xF4, 0xF7, 0xF8, 0xFD, 
-    0x03, 0x09, 0x0E, 0x0F, 0x0F, 0x0F, 0x10, 0x0D, 0x0B, 0x08, 0x07, 0x04, 
-    0x06, 0x05, 0x05, 0x03, 0xFE, 0xFA, 0xF6, 0xFA, 0xF9, 0xF8, 0xF5, 0xF0, 
-    0xEA, 0xE7, 0xE5, 0xE6, 0xE9, 0xEC, 0xEF, 0xF1, 0xF3, 0xF2, 0xF4, 0xF5, 
-    0xF5, 0xF4, 0xF4, 0xF4, 0xF6, 0xFA, 0xF9, 0xF8, 0xF1, 0xEC, 0xEB, 0xEA, 
-    0xEC, 0xEC, 0xEC, 0xED, 0xED, 0xEC, 0xEA, 0xE8, 0xE6, 0xE5, 0xE9, 0xEB, 
-    0xEC, 0xF1, 0xF5, 0xF7, 0xF8, 0xF9, 0xF6, 0xF5, 0xFA, 0xFC, 0xFE, 0xFC, 
-    0xFA, 0xF7, 0xF6, 0xF4, 0xF2, 0xEF, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xF1, 
-    0xF2, 0xF2, 0xF1, 0xF0, 0xED, 0xEF, 0xEF, 0xEC, 0xE8, 0xE5, 0xE7, 0xE6, 
-    0xED, 0xEC, 0xED, 0xEB, 0xE7, 0xE8, 0xE7, 0xEC, 0xE9, 0xE9, 0xE4, 0xE1, 
-    0xE0, 0xE0, 0xE4, 0xE6, 0xEA, 0xEA, 0xEE, 0xF0, 0xEE, 0xED, 0xE7, 0xE5, 
-    0xE5, 0xE5, 0xEA, 0xED, 0xF1, 0xF2, 0xF1, 0xF1, 0xF1, 0xF4, 0xFA, 0xFD, 
-    0x01, 0x06, 0x02, 0x02, 0x01, 0x02, 0x05, 0x0B, 0x12, 0x14, 0x14, 0x15, 
-    0x15, 0x14, 0x12, 0x0D, 0x09, 0x0B, 0x0E, 0x11, 0x13, 0x14, 0x16, 0x17, 
-    0x1B, 0x1C, 0x1D, 0x1E, 0x1A, 0x19, 0x13, 0x13, 0x13, 0x14, 0x13, 0x11, 
-    0x0E, 0x0A, 0x08, 0x05, 0x05, 0x07, 0x05, 0x04, 0x05, 0x03, 0x03, 0x03, 
-    0x01, 0xFD, 0x00, 0x03, 0x0B, 0x11, 0x14, 0x15, 0x15, 0x13, 0x15, 0x16, 
-    0x15, 0x16, 0x13, 0x12, 0x11, 0x0D, 0x0A, 0x0C, 0x0A, 0x0E, 0x0D, 0x0F, 
-    0x11, 0x10, 0x10, 0x0F, 0x0E, 0x0B, 0x0B, 0x0D, 0x0E, 0x0F, 0x14, 0x15, 
-    0x17, 0x17, 0x1A, 0x1A, 0x1C, 0x1D, 0x1C, 0x1D, 0x1D, 0x1F, 0x1A, 0x15, 
-    0x0B, 0x05, 0x01, 0xFD, 0xFE, 0xFE, 0xFD, 0xFA, 0xF9, 0xF7, 0xF7, 0xF6, 
-    0xF7, 0xF7, 0xFC, 0xFE, 0xFF, 0x04, 0x08, 0x0A, 0x0B, 0x0A, 0x0B, 0x0D, 
-    0x0D, 0x0C, 0x09, 0x04, 0x02, 0x01, 0xFE, 0xFD, 0xF8, 0xF5, 0xF5, 0xF5, 
-    0xF6, 0xF7, 0xF8, 0xFC, 0xFD, 0x01, 0x00, 0xFE, 0xFE, 0xFE, 0x02, 0x06, 
-    0x0A, 0x0F, 0x12, 0x11, 0x11, 0x10, 0x0E, 0x0B, 0x07, 0x03, 0x04, 0x05, 
-    0x04, 0x00, 0xFC, 0xF8, 0xF9, 0xFF, 0xFE, 0x01, 0xFC, 0xF3, 0xEF, 0xEB, 
-    0xEF, 0xEE, 0xEF, 0xF2, 0xF0, 0xF4, 0xF8, 0xFA, 0xFD, 0xFC, 0xFB, 0xFC, 
-    0xFE, 0xFF, 0xFD, 0xFA, 0xF7, 0xF5, 0xF4, 0xF2, 0xEE, 0xE8, 0xE5, 0xE1, 
-    0xE1, 0xE1, 0xE0, 0xE1, 0xE1, 0xE2, 0xE0, 0xE1, 0xE0, 0xE3, 0xE5, 0xEA, 
-    0xEF, 0xF3, 0xF9, 0xFD, 0x01, 0x05, 0x09, 0x0D, 0x0E, 0x0E, 0x0E, 0x0B, 
-    0x09, 0x05, 0xFD, 0xF7, 0xEF, 0xE6, 0xE4, 0xE4, 0xE6, 0xE4, 0xE2, 0xDF, 
-    0xDC, 0xE1, 0xE2, 0xE5, 0xE5, 0xE3, 0xE3, 0xE6, 0xED, 0xF3, 0xF8, 0xFD, 
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFB, 0xF8, 0xF7, 0xF6, 0xF2, 0xEC, 0xE8, 0xE3, 
-    0xE0, 0xE1, 0xE1, 0xE1, 0xDD, 0xDD, 0xD9, 0xD8, 0xD9, 0xD6, 0xDA, 0xDD, 
-    0xE5, 0xEA, 0xED, 0xF0, 0xF2, 0xF9, 0xFD, 0x06, 0x0C, 0x10, 0x13, 0x12, 
-    0x13, 0x13, 0x11, 0x0D, 0x09, 0x05, 0x02, 0x00, 0x00, 0x00, 0xFE, 0xF9, 
-    0xF4, 0xF3, 0xF2, 0xF5, 0xF4, 0xF5, 0xF6, 0xF8, 0xFC, 0x03, 0x0A, 0x11, 
-    0x18, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1D, 0x1E, 0x1B, 0x16, 0x10, 0x08, 
-    0x04, 0x05, 0x07, 0x09, 0x0D, 0x0D, 0x0B, 0x0A, 0x07, 0x05, 0x04, 0x01, 
-    0x02, 0x03, 0x03, 0x05, 0x07, 0x0B, 0x0C, 0x10, 0x15, 0x1B, 0x21, 0x22, 
-    0x21, 0x20, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x20, 0x22, 0x22, 0x23, 0x22, 
-    0x21, 0x1D, 0x1B, 0x1A, 0x19, 0x18, 0x14, 0x12, 0x0E, 0x0E, 0x0D, 0x0C, 
-    0x11, 0x12, 0x15, 0x1A, 0x1B, 0x1F, 0x20, 0x22, 0x22, 0x1F, 0x1A, 0x12, 
-    0x0C, 0x0A, 0x0A, 0x0C, 0x0E, 0x0D, 0x0A, 0x05, 0x02, 0xFB, 0xF8, 0xF5, 
-    0xF3, 0xF1, 0xF1, 0xF1, 0xF2, 0xF5, 0xF7, 0xFB, 0xFA, 0xFD, 0xFE, 0xFD, 
-    0xFD, 0xFA, 0xFA, 0xF8, 0xF9, 0xF6, 0xF5, 0xF5, 0xF5, 0xF7, 0xF6, 0xF9, 
-    0xF8, 0xF9, 0xFC, 0xFD, 0xFC, 0xFA, 0xFA, 0xFB, 0xFE, 0x03, 0x06, 0x08, 
-    0x0C, 0x0C, 0x0E, 0x0D, 0x0D, 0x0A, 0x08, 0x07, 0x01, 0xFE, 0xF8, 0xF6, 
-    0xF3, 0xF1, 0xF3, 0xF6, 0xF9, 0xFE, 0x01, 0xFD, 0xFB, 0xFA, 0xF8, 0xF9, 
-    0xFE, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0x07, 0x09, 
-    0x0A, 0x06, 0x03, 0xFE, 0xFC, 0xF9, 0xF5, 0xEF, 0xEA, 0xEA, 0xE8, 0xEB, 
-    0xEC, 0xEF, 0xF0, 0xF4, 0xF4, 0xF4, 0xF0, 0xEE, 0xF0, 0xEF, 0xF5, 0xF6, 
-    0xFA, 0xFC, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0xFC, 0xF8, 0xF7, 0xF3, 
-    0xF0, 0xEA, 0xE2, 0xDF, 0xDE, 0xDC, 0xDC, 0xDE, 0xDD, 0xDC, 0xDE, 0xE0, 
-    0xE1, 0xE5, 0xE2, 0xE3, 0xE2, 0xE1, 0xE3, 0xE5, 0xEA, 0xEC, 0xF2, 0xF4, 
-    0xF5, 0xF6, 0xF4, 0xF3, 0xF4, 0xF4, 0xF2, 0xF1, 0xED, 0xEC, 0xE9, 0xE8, 
-    0xE5, 0xE2, 0xE3, 0xE2, 0xDD, 0xDB, 0xD7, 0xD5, 0xD8, 0xDC, 0xE3, 0xE7, 
-    0xF1, 0xF5, 0xF8, 0xFE, 0xFF, 0x04, 0x0A, 0x11, 0x15, 0x16, 0x14, 0x15, 
-    0x18, 0x15, 0x16, 0x11, 0x0C, 0x09, 0x09, 0x07, 0x05, 0x02, 0xFE, 0xFD, 
-    0xFD, 0xFE, 0xFD, 0x00, 0xFF, 0x02, 0x08, 0x0B, 0x12, 0x18, 0x1C, 0x1E, 
-    0x1C, 0x1B, 0x1A, 0x1C, 0x1E, 0x1B, 0x1E, 0x1F, 0x1A, 0x14, 0x0D, 0x03, 
-    0xFD, 0xFA, 0xFC, 0xFB, 0xFC, 0xFE, 0xFE, 0x00, 0xFE, 0xFC, 0xFC, 0xFE, 
-    0x00, 0x05, 0x06, 0x04, 0x05, 0x08, 0x0E, 0x14, 0x1B, 0x21, 0x24, 0x22, 
-    0x21, 0x21, 0x1E, 0x1A, 0x17, 0x12, 0x0F, 0x10, 0x13, 0x17, 0x1B, 0x18, 
-    0x19, 0x17, 0x14, 0x16, 0x15, 0x18, 0x16, 0x16, 0x16, 0x16, 0x17, 0x17, 
-    0x19, 0x1B, 0x20, 0x22, 0x26, 0x26, 0x22, 0x21, 0x20, 0x1C, 0x16, 0x0F, 
-    0x09, 0x05, 0x06, 0x09, 0x0B, 0x0D, 0x0D, 0x08, 0x05, 0x04, 0x01, 0x03, 
-    0x07, 0x07, 0x08, 0x08, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0E, 0x0B, 0x08, 
-    0x05, 0x03, 0x06, 0x05, 0x05, 0xFF, 0xF9, 0xF5, 0xF5, 0xF5, 0xF8, 0xFA, 
-    0xF8, 0xF6, 0xF3, 0xF4, 0xF1, 0xF2, 0xF5, 0xF9, 0xFA, 0xF8, 0xF8, 0xF5, 
-    0xF8, 0xF8, 0xFC, 0x01, 0x04, 0x04, 0x00, 0xFF, 0xFC, 0xFB, 0xF9, 0xF7, 
-    0xF3, 0xF0, 0xEF, 0xF2, 0xF6, 0xF6, 0xF4, 0xEE, 0xEA, 0xE8, 0xEA, 0xEE, 
-    0xF1, 0xF6, 0xF8, 0xF9, 0xF9, 0xFA, 0xFC, 0x02, 0x06, 0x0B, 0x0F, 0x0D, 
-    0x09, 0x05, 0x03, 0x01, 0x00, 0xFB, 0xF4, 0xEB, 0xE4, 0xE0, 0xE1, 0xE5, 
-    0xE8, 0xED, 0xEC, 0xEC, 0xEC, 0xED, 0xEE, 0xF3, 0xF4, 0xF8, 0xFB, 0xFF, 
-    0x03, 0x05, 0x0B, 0x0C, 0x0F, 0x0E, 0x0D, 0x09, 0x04, 0x01, 0xFC, 0xF9, 
-    0xF0, 0xE7, 0xE1, 0xDD, 0xE0, 0xE2, 0xE6, 0xE6, 0xE2, 0xE2, 0xDF, 0xE1, 
-    0xE3, 0xE5, 0xE9, 0xEA, 0xE9, 0xE7, 0xE6, 0xE9, 0xEC, 0xF3, 0xF5, 0xF7, 
-    0xF8, 0xF2, 0xED, 0xE8, 0xE5, 0xE3, 0xE0, 0xD9, 0xD6, 0xD4, 0xD5, 0xD9, 
-    0xDC, 0xDC, 0xDA, 0xD8, 0xD4, 0xD4, 0xD4, 0xD9, 0xDD, 0xE6, 0xEC, 0xF2, 
-    0xF8, 0xFB, 0xFD, 0xFE, 0x05, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 0x0A, 0x0C, 
-    0x0C, 0x09, 0x03, 0xFA, 0xF7, 0xF7, 0xFB, 0xFC, 0xFA, 0xF7, 0xF2, 0xF1, 
-    0xF2, 0xF6, 0xFB, 0x00, 0x06, 0x0B, 0x0F, 0x14, 0x17, 0x18, 0x1A, 0x1B, 
-    0x1D, 0x1E, 0x1C, 0x1B, 0x1D, 0x1E, 0x1D, 0x18, 0x13, 0x0E, 0x0B, 0x0C, 
-    0x0D, 0x0F, 0x11, 0x0E, 0x09, 0x04, 0x03, 0x04, 0x07, 0x0A, 0x0D, 0x10, 
-    0x10, 0x0F, 0x0D, 0x0D, 0x10, 0x16, 0x1C, 0x22, 0x23, 0x22, 0x1E, 0x1B, 
-    0x1A, 0x18, 0x15, 0x11, 0x0A, 0x05, 0x07, 0x09, 0x07, 0x04, 0x00, 0xFB, 
-    0xFA, 0xFA, 0xFD, 0x00, 0x02, 0x08, 0x0D, 0x10, 0x12, 0x16, 0x1A, 0x1C, 
-    0x1E, 0x1F, 0x1F, 0x1F, 0x1D, 0x1B, 0x1C, 0x19, 0x13, 0x0A, 0x02, 0xFD, 
-    0xFC, 0x01, 0x02, 0x05, 0x04, 0x00, 0xFE, 0xFD, 0xFD, 0xFD, 0x01, 0x05, 
-    0x08, 0x0A, 0x0D, 0x0F, 0x0D, 0x0A, 0x09, 0x0A, 0x0C, 0x0C, 0x05, 0x00, 
-    0xFB, 0xFC, 0xFD, 0xFC, 0xFA, 0xF5, 0xF3, 0xF3, 0xF8, 0xFA, 0xFB, 0xF9, 
-    0xF7, 0xF8, 0xF8, 0xFB, 0xFD, 0x00, 0x02, 0x05, 0x06, 0x04, 0x05, 0x06, 
-    0x09, 0x0A, 0x09, 0x09, 0x08, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFE, 0xF9, 
-    0xF4, 0xF2, 0xF1, 0xF4, 0xF4, 0xF1, 0xED, 0xE7, 0xE7, 0xE6, 0xEA, 0xEC, 
-    0xF0, 0xF3, 0xF6, 0xFA, 0xF8, 0xF7, 0xF5, 0xF6, 0xF9, 0xFF, 0x04, 0x05, 
-    0x04, 0x01, 0x00, 0xFE, 0xFA, 0xF1, 0xE7, 0xE0, 0xDE, 0xDF, 0xE2, 0xE6, 
-    0xE7, 0xE8, 0xE5, 0xE3, 0xE4, 0xE6, 0xEB, 0xF1, 0xF6, 0xF9, 0xFB, 0xFD, 
-    0x00, 0xFF, 0x01, 0x03, 0x04, 0x04, 0x01, 0xFD, 0xF9, 0xF6, 0xF2, 0xEE, 
-    0xE5, 0xDE, 0xDA, 0xDF, 0xE5, 0xEA, 0xE8, 0xE3, 0xDE, 0xDC, 0xDF, 0xE3, 
-    0xE5, 0xE5, 0xE6, 0xE9, 0xEB, 0xEC, 0xEE, 0xF1, 0xF8, 0xFD, 0x03, 0x05, 
-    0x05, 0x02, 0xFC, 0xF9, 0xF5, 0xF2, 0xEE, 0xE8, 0xE3, 0xE0, 0xE0, 0xE1, 
-    0xE3, 0xE4, 0xE1, 0xDC, 0xD8, 0xD7, 0xDB, 0xDF, 0xE9, 0xEF, 0xF4, 0xF8, 
-    0xF8, 0xF9, 0xFA, 0xFD, 0x00, 0x03, 0x06, 0x08, 0x07, 0x06, 0x05, 0x00, 
-    0xF8, 0xEE, 0xE8, 0xE5, 0xE8, 0xED, 0xF3, 0xF5, 0xF6, 0xF4, 0xF3, 0xF5, 
-    0xFB, 0x01, 0x07, 0x0B, 0x0D, 0x10, 0x11, 0x12, 0x13, 0x13, 0x14, 0x15, 
-    0x16, 0x16, 0x17, 0x17, 0x18, 0x1B, 0x19, 0x15, 0x0E, 0x09, 0x06, 0x06, 
-    0x07, 0x07, 0x07, 0x06, 0x05, 0x04, 0x05, 0x04, 0x05, 0x08, 0x09, 0x0B, 
-    0x0C, 0x0B, 0x0C, 0x0E, 0x13, 0x18, 0x1D, 0x1F, 0x1F, 0x1D, 0x1E, 0x1E, 
-    0x1E, 0x1C, 0x17, 0x13, 0x10, 0x10, 0x14, 0x16, 0x17, 0x13, 0x0D, 0x09, 
-    0x08, 0x09, 0x09, 0x0C, 0x0E, 0x13, 0x18, 0x1D, 0x22, 0x22, 0x24, 0x24, 
-    0x22, 0x23, 0x23, 0x23, 0x21, 0x1D, 0x17, 0x0E, 0x0A, 0x01, 0xFC, 0xFB, 
-    0xFE, 0x02, 0x06, 0x06, 0x01, 0xFB, 0xF5, 0xF2, 0xF1, 0xF3, 0xF6, 0xFB, 
-    0x01, 0x05, 0x04, 0x06, 0x06, 0x09, 0x0C, 0x0E, 0x0D, 0x09, 0x05, 0x02, 
-    0x01, 0xFE, 0xFB, 0xF7, 0xF2, 0xED, 0xED, 0xED, 0xEF, 0xF0, 0xF0, 0xF3, 
-    0xF3, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFC, 0xFF, 0x00, 0x00, 0x02, 
-    0x02, 0x04, 0x04, 0x04, 0x06, 0x08, 0x08, 0x06, 0x03, 0xFF, 0xF7, 0xF1, 
-    0xED, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF3, 0xF7, 0xFE, 
-    0x05, 0x09, 0x0B, 0x0C, 0x09, 0x07, 0x04, 0x05, 0x07, 0x0A, 0x0C, 0x09, 
-    0x05, 0x02, 0xFE, 0xF9, 0xF5, 0xEE, 0xE9, 0xE5, 0xE6, 0xEA, 0xEE, 0xED, 
-    0xE9, 0xE5, 0xE2, 0xE4, 0xE9, 0xEE, 0xF2, 0xF3, 0xF5, 0xF6, 0xF8, 0xF9, 
-    0xF8, 0xF7, 0xF6, 0xF6, 0xF6, 0xF5, 0xF3, 0xF1, 0xEE, 0xEC, 0xE9, 0xE8, 
-    0xE6, 0xE4, 0xE4, 0xE3, 0xE3, 0xE5, 0xE3, 0xE3, 0xE1, 0xDF, 0xDD, 0xDC, 
-    0xDD, 0xE0, 0xE5, 0xE9, 0xED, 0xF1, 0xF5, 0xF8, 0xFB, 0xFC, 0xFF, 0xFE, 
-    0xFE, 0xFB, 0xF8, 0xF4, 0xF0, 0xEA, 0xE3, 0xDD, 0xD9, 0xDA, 0xDD, 0xE2, 
-    0xE0, 0xDE, 0xDA, 0xD7, 0xD9, 0xDC, 0xE4, 0xEB, 0xF5, 0xFC, 0x00, 0x02, 
-    0x01, 0x04, 0x09, 0x0A, 0x0F, 0x12, 0x12, 0x12, 0x10, 0x0D, 0x07, 0x00, 
-    0xF9, 0xF5, 0xF4, 0xF5, 0xF7, 0xFA, 0xFB, 0xFB, 0xFC, 0xFD, 0x02, 0x06, 
-    0x0B, 0x0F, 0x10, 0x13, 0x16, 0x19, 0x19, 0x18, 0x16, 0x15, 0x17, 0x19, 
-    0x1A, 0x1A, 0x18, 0x17, 0x17, 0x15, 0x11, 0x09, 0x01, 0xFC, 0xFA, 0xFD, 
-    0xFE, 0x02, 0x04, 0x04, 0x04, 0x02, 0x04, 0x07, 0x0B, 0x0E, 0x11, 0x12, 
-    0x14, 0x16, 0x19, 0x1C, 0x1D, 0x1E, 0x1D, 0x1D, 0x1E, 0x1F, 0x1D, 0x1A, 
-    0x16, 0x11, 0x0C, 0x07, 0x05, 0x06, 0x09, 0x09, 0x08, 0x04, 0x03, 0x05, 
-    0x09, 0x0E, 0x12, 0x16, 0x1A, 0x1E, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x21, 
-    0x22, 0x21, 0x1E, 0x1B, 0x17, 0x12, 0x0E, 0x0B, 0x09, 0x07, 0x07, 0x09, 
-    0x0B, 0x0B, 0x08, 0x06, 0x04, 0x02, 0x00, 0xFE, 0xFF, 0x01, 0x04, 0x08, 
-    0x0B, 0x0C, 0x0A, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0B, 0x08, 0x07, 0x06, 
-    0x06, 0x04, 0xFE, 0xF6, 0xEE, 0xEB, 0xEC, 0xEF, 0xF2, 0xF2, 0xF1, 0xEF, 
-    0xEC, 0xEB, 0xEA, 0xEC, 0xF0, 0xF6, 0xFD, 0x01, 0x03, 0x05, 0x06, 0x08, 
-    0x09, 0x0B, 0x0E, 0x12, 0x15, 0x13, 0x0E, 0x06, 0xFE, 0xF6, 0xEE, 0xEA, 
-    0xE8, 0xE7, 0xE6, 0xE5, 0xE7, 0xE9, 0xEB, 0xED, 0xF1, 0xF7, 0xFD, 0x02, 
-    0x05, 0x06, 0x07, 0x06, 0x05, 0x05, 0x05, 0x06, 0x08, 0x09, 0x07, 0x02, 
-    0xFD, 0xF8, 0xF3, 0xEE, 0xE9, 0xE4, 0xE1, 0xE1, 0xE5, 0xE9, 0xEC, 0xEC, 
-    0xED, 0xED, 0xED, 0xED, 0xEE, 0xF0, 0xF5, 0xFA, 0xFC, 0xFB, 0xF8, 0xF6, 
-    0xF5, 0xF7, 0xF7, 0xF8, 0xF9, 0xFC, 0xFD, 0xFC, 0xF7, 0xF0, 0xE9, 0xE4, 
-    0xE2, 0xE4, 0xE8, 0xED, 0xF0, 0xEF, 0xEC, 0xE9, 0xE7, 0xE6, 0xE7, 0xEA, 
-    0xED, 0xF1, 0xF3, 0xF3, 0xF1, 0xEF, 0xF0, 0xF3, 0xFA, 0x01, 0x0B, 0x12, 
-    0x16, 0x17, 0x12, 0x0B, 0x01, 0xF9, 0xF4, 0xF1, 0xF2, 0xF5, 0xFB, 0x00, 
-    0x03, 0x05, 0x05, 0x04, 0x03, 0x05, 0x07, 0x08, 0x06, 0x03, 0x01, 0x02, 
-    0x04, 0x08, 0x0B, 0x0D, 0x0D, 0x0C, 0x0D, 0x0E, 0x0D, 0x0C, 0x0C, 0x0B, 
-    0x0A, 0x08, 0x07, 0x08, 0x0C, 0x10, 0x12, 0x13, 0x12, 0x11, 0x12, 0x11, 
-    0x12, 0x13, 0x13, 0x15, 0x16, 0x15, 0x14, 0x15, 0x16, 0x1A, 0x1F, 0x25, 
-    0x28, 0x2C, 0x2D, 0x2A, 0x26, 0x1F, 0x18, 0x12, 0x0F, 0x0F, 0x12, 0x16, 
-    0x19, 0x1A, 0x18, 0x13, 0x0E, 0x0D, 0x0F, 0x12, 0x16, 0x1A, 0x1D, 0x1E, 
-    0x1D, 0x1E, 0x1D, 0x1D, 0x18, 0x0F, 0x04, 0xFB, 0xF5, 0xF4, 0xF6, 0xFC, 
-    0x04, 0x0A, 0x0E, 0x0D, 0x0A, 0x06, 0x00, 0xFA, 0xF8, 0xF9, 0xFD, 0x03, 
-    0x0B, 0x12, 0x16, 0x18, 0x16, 0x12, 0x0F, 0x0D, 0x0A, 0x08, 0x08, 0x0A, 
-    0x0C, 0x0D, 0x0C, 0x08, 0x05, 0x02, 0xFE, 0xFA, 0xF7, 0xF7, 0xF8, 0xFD, 
-    0x02, 0x07, 0x0A, 0x0A, 0x08, 0x03, 0xFD, 0xFA, 0xFA, 0xFC, 0xFE, 0xFF, 
-    0x00, 0xFE, 0xFB, 0xF7, 0xF6, 0xF7, 0xF9, 0xFB, 0xFD, 0x00, 0x02, 0x03, 
-    0x00, 0xFC, 0xF8, 0xF6, 0xF4, 0xF4, 0xF5, 0xF9, 0xFC, 0xFD, 0xFA, 0xF7, 
-    0xF5, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 
-    0x00, 0x03, 0x07, 0x09, 0x0A, 0x08, 0x04, 0x00, 0xFC, 0xF7, 0xF0, 0xEA, 
-    0xE6, 0xE6, 0xE8, 0xEA, 0xEB, 0xEA, 0xEA, 0xE8, 0xE6, 0xE4, 0xE3, 0xE2, 
-    0xE3, 0xE6, 0xE8, 0xEC, 0xED, 0xED, 0xEA, 0xE9, 0xE8, 0xEA, 0xEB, 0xEA, 
-    0xE9, 0xE7, 0xE5, 0xE1, 0xDE, 0xDD, 0xDE, 0xE0, 0xE1, 0xE1, 0xE0, 0xE0, 
-    0xDF, 0xDD, 0xDD, 0xDE, 0xE1, 0xE4, 0xE7, 0xE8, 0xE8, 0xE7, 0xE6, 0xE6, 
-    0xE9, 0xED, 0xF3, 0xF7, 0xFA, 0xFB, 0xFB, 0xF8, 0xF5, 0xF1, 0xED, 0xEC, 
-    0xEB, 0xED, 0xEF, 0xEF, 0xED, 0xEB, 0xEA, 0xE9, 0xEA, 0xEB, 0xED, 0xEF, 
-    0xF0, 0xF1, 0xF0, 0xEF, 0xF0, 0xF1, 0xF3, 0xF5, 0xF7, 0xFA, 0xFD, 0x01, 
-    0x05, 0x09, 0x09, 0x07, 0x03, 0xFD, 0xF9, 0xF6, 0xF4, 0xF6, 0xF9, 0xFB, 
-    0xFD, 0x00, 0x02, 0x04, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0B, 0x0A, 
-    0x06, 0x04, 0x04, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x09, 0x09, 0x0B, 
-    0x0D, 0x0F, 0x12, 0x16, 0x1A, 0x1C, 0x1A, 0x14, 0x0E, 0x0C, 0x0C, 0x0D, 
-    0x0D, 0x0C, 0x09, 0x07, 0x08, 0x09, 0x0B, 0x0D, 0x11, 0x17, 0x1B, 0x1C, 
-    0x1B, 0x19, 0x18, 0x17, 0x18, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1C, 0x1C, 
-    0x1B, 0x18, 0x17, 0x16, 0x15, 0x16, 0x18, 0x1B, 0x1D, 0x1D, 0x1A, 0x18, 
-    0x17, 0x16, 0x13, 0x0F, 0x0D, 0x0B, 0x0A, 0x08, 0x06, 0x03, 0x01, 0x00, 
-    0x00, 0xFE, 0xFD, 0xFD, 0x03, 0x09, 0x0E, 0x10, 0x11, 0x0F, 0x0D, 0x0A, 
-    0x07, 0x07, 0x09, 0x0E, 0x13, 0x15, 0x14, 0x13, 0x0F, 0x0C, 0x0A, 0x0B, 
-    0x0D, 0x0F, 0x10, 0x11, 0x0F, 0x0C, 0x07, 0x03, 0x00, 0xFE, 0xFF, 0xFE, 
-    0xFF, 0xFD, 0xF9, 0xF5, 0xF2, 0xF2, 0xF5, 0xFB, 0x01, 0x06, 0x08, 0x07, 
-    0x05, 0x02, 0xFF, 0xFD, 0xFC, 0xFD, 0xFC, 0xFA, 0xF8, 0xF6, 0xF4, 0xF1, 
-    0xEE, 0xEE, 0xEF, 0xEF, 0xEE, 0xEE, 0xEF, 0xF2, 0xF6, 0xF8, 0xF8, 0xF9, 
-    0xFA, 0xFC, 0xFE, 0x00, 0x02, 0x05, 0x09, 0x0C, 0x0C, 0x09, 0x05, 0x02, 
-    0x01, 0x02, 0x03, 0x05, 0x05, 0x03, 0x00, 0xFC, 0xF8, 0xF4, 0xF2, 0xF2, 
-    0xF4, 0xF5, 0xF6, 0xF4, 0xF1, 0xEB, 0xE6, 0xE2, 0xE0, 0xE0, 0xE1, 0xE2, 
-    0xE3, 0xE2, 0xE3, 0xE5, 0xE7, 0xEA, 0xEC, 0xED, 0xED, 0xEC, 0xEC, 0xEE, 
-    0xED, 0xEB, 0xE9, 0xE7, 0xE6, 0xE8, 0xEA, 0xEB, 0xEA, 0xEA, 0xE9, 0xEA, 
-    0xE9, 0xEA, 0xEA, 0xE9, 0xEB, 0xEC, 0xEB, 0xEB, 0xEA, 0xE9, 0xEB, 0xEE, 
-    0xF0, 0xF4, 0xF7, 0xF9, 0xFA, 0xF9, 0xF8, 0xF6, 0xF3, 0xEF, 0xED, 0xEA, 
-    0xE9, 0xE8, 0xE5, 0xE2, 0xE0, 0xDD, 0xDD, 0xDE, 0xDF, 0xE1, 0xE3, 0xE5, 
-    0xE8, 0xEA, 0xE9, 0xEA, 0xEB, 0xED, 0xF0, 0xF3, 0xF6, 0xF9, 0xFE, 0x03, 
-    0x09, 0x0D, 0x0F, 0x0E, 0x0A, 0x06, 0x02, 0xFF, 0xFE, 0xFC, 0xFA, 0xF9, 
-    0xF7, 0xF6, 0xF6, 0xFA, 0xFE, 0x02, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 
-    0x08, 0x08, 0x07, 0x07, 0x03, 0xFF, 0xFD, 0xFE, 0x02, 0x05, 0x08, 0x0D, 
-    0x10, 0x11, 0x10, 0x0F, 0x0E, 0x0D, 0x0C, 0x0D, 0x0F, 0x11, 0x10, 0x12, 
-    0x13, 0x16, 0x17, 0x16, 0x17, 0x18, 0x1B, 0x1C, 0x1D, 0x1C, 0x1B, 0x1C, 
-    0x1E, 0x21, 0x22, 0x20, 0x1C, 0x18, 0x16, 0x13, 0x15, 0x18, 0x1B, 0x1E, 
-    0x20, 0x1F, 0x1C, 0x18, 0x15, 0x13, 0x13, 0x14, 0x13, 0x12, 0x10, 0x0F, 
-    0x0E, 0x0D, 0x09, 0x08, 0x05, 0x03, 0x00, 0xFE, 0xFE, 0xFD, 0xFE, 0xFE, 
-    0x00, 0x02, 0x07, 0x0B, 0x10, 0x12, 0x14, 0x16, 0x17, 0x18, 0x16, 0x12, 
-    0x0E, 0x0C, 0x0C, 0x0C, 0x0A, 0x07, 0x05, 0x05, 0x09, 0x0C, 0x0F, 0x11, 
-    0x13, 0x12, 0x13, 0x13, 0x11, 0x0D, 0x09, 0x05, 0x02, 0xFF, 0xFE, 0xFC, 
-    0xF8, 0xF5, 0xF0, 0xED, 0xED, 0xEE, 0xF1, 0xF4, 0xF8, 0xFA, 0xFC, 0xFF, 
-    0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x05, 0x07, 0x06, 0x04, 
-    0x01, 0xFF, 0xFC, 0xFB, 0xFC, 0xFE, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0xFD, 
-    0xFB, 0xFD, 0x01, 0x04, 0x08, 0x0A, 0x0A, 0x09, 0x06, 0x03, 0x00, 0xFE, 
-    0xFF, 0xFE, 0xFD, 0xF9, 0xF5, 0xF2, 0xEF, 0xEC, 0xEB, 0xEB, 0xEC, 0xEE, 
-    0xEE, 0xED, 0xE9, 0xE6, 0xE2, 0xE1, 0xE2, 0xE5, 0xE7, 0xE7, 0xE6, 0xE4, 
-    0xE3, 0xE4, 0xE6, 0xEA, 0xEE, 0xF0, 0xEF, 0xED, 0xEC, 0xEC, 0xED, 0xEC, 
-    0xEA, 0xE7, 0xE6, 0xE8, 0xEA, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0xEB, 0xE9, 
-    0xE8, 0xE9, 0xEA, 0xEA, 0xEB, 0xEE, 0xF0, 0xEF, 0xED, 0xEA, 0xEB, 0xED, 
-    0xEE, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF1, 0xEF, 0xEC, 0xEC, 0xED, 0xEF, 
-    0xF2, 0xF5, 0xF8, 0xF9, 0xFA, 0xF8, 0xF5, 0xF3, 0xF3, 0xF4, 0xF6, 0xF5, 
-    0xF2, 0xF0, 0xF0, 0xF2, 0xF3, 0xF3, 0xF2, 0xF3, 0xF5, 0xF9, 0xFD, 0x02, 
-    0x06, 0x0A, 0x0C, 0x0D, 0x0C, 0x0C, 0x0D, 0x0B, 0x07, 0xFF, 0xF9, 0xF3, 
-    0xF2, 0xF1, 0xF3, 0xF6, 0xF8, 0xFA, 0xFA, 0xFB, 0xFC, 0xFE, 0x02, 0x07, 
-    0x0C, 0x12, 0x16, 0x18, 0x16, 0x13, 0x12, 0x10, 0x10, 0x0F, 0x0D, 0x0E, 
-    0x0D, 0x0F, 0x0F, 0x10, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x11, 
-    0x15, 0x16, 0x15, 0x14, 0x14, 0x14, 0x15, 0x14, 0x12, 0x10, 0x11, 0x13, 
-    0x16, 0x17, 0x18, 0x17, 0x16, 0x17, 0x18, 0x1B, 0x1D, 0x1E, 0x1E, 0x1D, 
-    0x19, 0x17, 0x15, 0x16, 0x18, 0x19, 0x19, 0x19, 0x1A, 0x1B, 0x1B, 0x1A, 
-    0x1B, 0x1B, 0x1B, 0x19, 0x16, 0x13, 0x11, 0x0D, 0x0A, 0x08, 0x07, 0x09, 
-    0x09, 0x08, 0x07, 0x05, 0x06, 0x08, 0x0A, 0x0B, 0x0C, 0x0C, 0x0C, 0x0F, 
-    0x10, 0x0F, 0x0B, 0x06, 0x04, 0x03, 0x04, 0x03, 0x02, 0x01, 0x00, 0xFE, 
-    0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0x03, 0x05, 0x04, 
-    0x03, 0x00, 0xFC, 0xF9, 0xF8, 0xF8, 0xF9, 0xFB, 0xFC, 0xFD, 0xFC, 0xFD, 
-    0xFC, 0xFD, 0xFD, 0xFD, 0xFE, 0xFF, 0x00, 0x01, 0x00, 0xFC, 0xF7, 0xF2, 
-    0xF1, 0xF1, 0xF2, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 0xF6, 0xF5, 
-    0xF7, 0xFA, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x07, 0x09, 0x07, 
-    0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x03, 0x02, 0x00, 0xFE, 0xFE, 0xFF, 
-    0xFE, 0xF9, 0xF4, 0xF1, 0xEF, 0xED, 0xEC, 0xE9, 0xE7, 0xE5, 0xE4, 0xE3, 
-    0xE2, 0xE3, 0xE4, 0xE6, 0xE9, 0xEB, 0xEA, 0xE9, 0xE6, 0xE4, 0xE1, 0xDE, 
-    0xDC, 0xDA, 0xDA, 0xDB, 0xDE, 0xE0, 0xE0, 0xDF, 0xDE, 0xDE, 0xE0, 0xE2, 
-    0xE5, 0xE8, 0xEC, 0xF2, 0xF6, 0xFA, 0xFB, 0xFA, 0xF8, 0xF6, 0xF5, 0xF5, 
-    0xF4, 0xF4, 0xF4, 0xF3, 0xF2, 0xF0, 0xEF, 0xF0, 0xEF, 0xEE, 0xED, 0xEF, 
-    0xF1, 0xF3, 0xF0, 0xEC, 0xE7, 0xE6, 0xE4, 0xE5, 0xE6, 0xE7, 0xE7, 0xE5, 
-    0xE3, 0xE3, 0xE4, 0xE6, 0xE9, 0xED, 0xF0, 0xF3, 0xF6, 0xF8, 0xFB, 0xFD, 
-    0x01, 0x04, 0x06, 0x08, 0x0C, 0x10, 0x11, 0x12, 0x11, 0x10, 0x0E, 0x0C, 
-    0x0B, 0x09, 0x06, 0x04, 0x01, 0x00, 0x03, 0x05, 0x09, 0x0D, 0x10, 0x12, 
-    0x13, 0x15, 0x13, 0x11, 0x0F, 0x0D, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 
-    0x13, 0x17, 0x1A, 0x1A, 0x15, 0x0F, 0x09, 0x07, 0x05, 0x04, 0x03, 0x02, 
-    0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0x04, 0x09, 0x0F, 0x15, 0x19, 0x1B, 
-    0x1C, 0x1D, 0x20, 0x22, 0x22, 0x21, 0x22, 0x25, 0x28, 0x2B, 0x2A, 0x26, 
-    0x21, 0x1D, 0x19, 0x16, 0x13, 0x0F, 0x0C, 0x0A, 0x0A, 0x0A, 0x0A, 0x09, 
-    0x08, 0x07, 0x07, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 
-    0x05, 0x04, 0x05, 0x06, 0x07, 0x06, 0x05, 0x04, 0x05, 0x07, 0x08, 0x0C, 
-    0x10, 0x13, 0x15, 0x15, 0x15, 0x14, 0x13, 0x13, 0x14, 0x13, 0x13, 0x12, 
-    0x12, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0D, 0x09, 
-    0x06, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x03, 0x02, 0x00, 0xFA, 0xF6, 
-    0xF1, 0xEF, 0xEE, 0xEE, 0xEE, 0xED, 0xEB, 0xE8, 0xE7, 0xE8, 0xE9, 0xEA, 
-    0xEC, 0xF0, 0xF4, 0xFA, 0x00, 0x05, 0x07, 0x06, 0x07, 0x07, 0x08, 0x07, 
-    0x04, 0x01, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 
-    0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xF9, 0xF6, 0xF4, 0xF3, 0xF3, 0xF2, 0xF1, 
-    0xF0, 0xEF, 0xED, 0xEB, 0xE7, 0xE4, 0xE2, 0xE2, 0xE1, 0xE0, 0xE0, 0xE2, 
-    0xE4, 0xE5, 0xE5, 0xE6, 0xE8, 0xEA, 0xEB, 0xEC, 0xEB, 0xEC, 0xEB, 0xEA, 
-    0xEA, 0xEB, 0xEE, 0xF0, 0xF0, 0xEF, 0xEF, 0xF0, 0xEF, 0xEF, 0xF1, 0xF4, 
-    0xF8, 0xFA, 0xFD, 0xFE, 0xFE, 0xFC, 0xF8, 0xF5, 0xF3, 0xF2, 0xF2, 0xF1, 
-    0xF0, 0xEE, 0xED, 0xEE, 0xED, 0xEB, 0xE9, 0xE8, 0xE7, 0xE8, 0xEA, 0xEA, 
-    0xE8, 0xE4, 0xDF, 0xDC, 0xDA, 0xD9, 0xDA, 0xDB, 0xDC, 0xE0, 0xE3, 0xE6, 
-    0xE8, 0xEB, 0xEE, 0xF1, 0xF3, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFB, 0xFE, 
-    0x01, 0x03, 0x04, 0x05, 0x08, 0x0D, 0x10, 0x10, 0x0E, 0x0C, 0x0A, 0x09, 
-    0x05, 0xFF, 0xFC, 0xFB, 0xFD, 0xFE, 0xFF, 0x00, 0x00, 0x02, 0x03, 0x06, 
-    0x09, 0x0A, 0x0B, 0x0A, 0x09, 0x08, 0x06, 0x05, 0x05, 0x06, 0x09, 0x0E, 
-    0x14, 0x19, 0x1B, 0x19, 0x16, 0x15, 0x14, 0x13, 0x12, 0x10, 0x0E, 0x0C, 
-    0x0B, 0x08, 0x07, 0x07, 0x0B, 0x0F, 0x14, 0x17, 0x19, 0x1A, 0x1A, 0x1C, 
-    0x1D, 0x1E, 0x1F, 0x20, 0x22, 0x25, 0x28, 0x29, 0x2B, 0x2A, 0x27, 0x24, 
-    0x20, 0x1B, 0x17, 0x13, 0x10, 0x0E, 0x0F, 0x0F, 0x0E, 0x0A, 0x06, 0x04, 
-    0x05, 0x06, 0x08, 0x0A, 0x0B, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x15, 
-    0x16, 0x15, 0x13, 0x10, 0x0A, 0x04, 0x00, 0xFE, 0xFD, 0xFD, 0xFE, 0xFF, 
-    0x01, 0x02, 0x01, 0x00, 0x01, 0x02, 0x05, 0x06, 0x05, 0x04, 0x02, 0x01, 
-    0x01, 0x00, 0x02, 0x03, 0x04, 0x06, 0x08, 0x0C, 0x0E, 0x0F, 0x0D, 0x0A, 
-    0x07, 0x06, 0x05, 0x03, 0x01, 0x01, 0x03, 0x06, 0x08, 0x08, 0x06, 0x05, 
-    0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF8, 0xF7, 0xF5, 0xF6, 0xF7, 
-    0xFA, 0xFF, 0x03, 0x07, 0x09, 0x09, 0x09, 0x08, 0x07, 0x06, 0x02, 0xFF, 
-    0xFD, 0xFC, 0xFC, 0xFC, 0xFA, 0xF9, 0xF8, 0xF7, 0xF7, 0xF6, 0xF5, 0xF3, 
-    0xF3, 0xF4, 0xF5, 0xF4, 0xF2, 0xF0, 0xEE, 0xEF, 0xEF, 0xF2, 0xF6, 0xF7, 
-    0xF6, 0xF4, 0xF5, 0xF8, 0xFB, 0xFC, 0xFA, 0xF8, 0xF5, 0xF4, 0xF2, 0xF0, 
-    0xED, 0xEA, 0xE9, 0xE9, 0xEA, 0xE9, 0xE7, 0xE4, 0xE1, 0xDE, 0xDD, 0xDD, 
-    0xE0, 0xE4, 0xE6, 0xE8, 0xEB, 0xEC, 0xED, 0xEC, 0xED, 0xEF, 0xF2, 0xF4, 
-    0xF6, 0xF7, 0xF8, 0xF9, 0xFC, 0xFE, 0xFF, 0xFD, 0xFC, 0xFA, 0xF8, 0xF7, 
-    0xF8, 0xF8, 0xF9, 0xFA, 0xFB, 0xF9, 0xF8, 0xF5, 0xF3, 0xF3, 0xF6, 0xF9, 
-    0xF9, 0xF4, 0xEF, 0xEA, 0xE6, 0xE3, 0xE0, 0xDF, 0xE1, 0xE3, 0xE6, 0xE8, 
-    0xEA, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF2, 0xF3, 0xF5, 0xF4, 0xF4, 0xF5, 
-    0xF6, 0xFA, 0xFE, 0x02, 0x05, 0x07, 0x08, 0x06, 0x04, 0x02, 0x03, 0x03, 
-    0x04, 0x03, 0x03, 0x04, 0x06, 0x0A, 0x0D, 0x10, 0x13, 0x17, 0x1D, 0x21, 
-    0x21, 0x1F, 0x1C, 0x1A, 0x18, 0x14, 0x10, 0x0B, 0x09, 0x09, 0x0A, 0x09, 
-    0x08, 0x06, 0x03, 0x02, 0x01, 0x01, 0x02, 0x00, 0xFE, 0xFC, 0xFA, 0xFB, 
-    0xFB, 0xFC, 0xFC, 0xFD, 0xFF, 0x02, 0x04, 0x07, 0x0B, 0x0F, 0x13, 0x16, 
-    0x17, 0x19, 0x1A, 0x1C, 0x1F, 0x23, 0x28, 0x2B, 0x2D, 0x2E, 0x30, 0x32, 
-    0x30, 0x2C, 0x29, 0x26, 0x24, 0x22, 0x21, 0x1F, 0x1D, 0x1C, 0x1A, 0x18, 
-    0x16, 0x15, 0x17, 0x17, 0x18, 0x17, 0x16, 0x15, 0x12, 0x10, 0x0F, 0x10, 
-    0x10, 0x0E, 0x0A, 0x05, 0xFF, 0xFB, 0xF8, 0xF6, 0xF5, 0xF4, 0xF1, 0xF0, 
-    0xEF, 0xF0, 0xF2, 0xF4, 0xF5, 0xF4, 0xF4, 0xF4, 0xF3, 0xF4, 0xF4, 0xF7, 
-    0xFB, 0xFE, 0x01, 0x03, 0x08, 0x0E, 0x16, 0x1B, 0x1E, 0x1D, 0x1B, 0x18, 
-    0x14, 0x10, 0x0A, 0x05, 0x03, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0xFD, 0xFB, 
-    0xF9, 0xF6, 0xF4, 0xF2, 0xF1, 0xF0, 0xEF, 0xED, 0xEC, 0xEC, 0xED, 0xEC, 
-    0xEE, 0xF2, 0xF9, 0xFF, 0x02, 0x00, 0xFD, 0xFC, 0xFE, 0x00, 0x00, 0xFD, 
-    0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFC, 0xFE, 0x00, 0x03, 0x04, 0x03, 0x02, 
-    0x04, 0x05, 0x03, 0xFF, 0xFA, 0xF6, 0xF3, 0xF4, 0xF5, 0xF6, 0xF6, 0xF5, 
-    0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF4, 0xF0, 0xEC, 0xE8, 0xE7, 0xE6, 0xE5, 
-    0xE2, 0xE0, 0xDF, 0xE0, 0xE2, 0xE4, 0xE2, 0xE0, 0xDE, 0xDE, 0xDE, 0xDF, 
-    0xDE, 0xDC, 0xDF, 0xE3, 0xE8, 0xEC, 0xEE, 0xF0, 0xF1, 0xF3, 0xF5, 0xFA, 
-    0xFE, 0x02, 0x05, 0x05, 0x06, 0x05, 0x04, 0x02, 0xFF, 0xFB, 0xF7, 0xF3, 
-    0xF0, 0xEF, 0xED, 0xEC, 0xE9, 0xE9, 0xE8, 0xE9, 0xEB, 0xEE, 0xF0, 0xEF, 
-    0xEB, 0xE6, 0xE2, 0xE0, 0xDF, 0xDC, 0xD8, 0xD7, 0xD7, 0xD9, 0xDE, 0xE2, 
-    0xE6, 0xE8, 0xEA, 0xEB, 0xEC, 0xEF, 0xF2, 0xF4, 0xF5, 0xF4, 0xF6, 0xF8, 
-    0xFB, 0xFF, 0x04, 0x08, 0x0D, 0x13, 0x17, 0x19, 0x1A, 0x19, 0x16, 0x14, 
-    0x13, 0x12, 0x10, 0x0F, 0x10, 0x14, 0x18, 0x1C, 0x1E, 0x21, 0x23, 0x23, 
-    0x21, 0x1F, 0x1C, 0x19, 0x15, 0x11, 0x0D, 0x0A, 0x06, 0x03, 0x03, 0x05, 
-    0x07, 0x07, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0xF9, 0xF6, 0xF7, 
-    0xF8, 0xF9, 0xF9, 0xFA, 0xFD, 0x01, 0x05, 0x0A, 0x11, 0x15, 0x18, 0x18, 
-    0x18, 0x19, 0x1A, 0x1B, 0x1D, 0x1F, 0x21, 0x23, 0x24, 0x23, 0x22, 0x21, 
-    0x21, 0x21, 0x23, 0x23, 0x22, 0x23, 0x23, 0x22, 0x20, 0x1E, 0x1F, 0x20, 
-    0x1F, 0x1D, 0x1B, 0x1D, 0x20, 0x21, 0x20, 0x1F, 0x1C, 0x19, 0x17, 0x17, 
-    0x18, 0x18, 0x14, 0x0E, 0x08, 0x03, 0x00, 0xFD, 0xFB, 0xFB, 0xFD, 0xFF, 
-    0x01, 0x01, 0xFF, 0xFE, 0xFB, 0xFA, 0xFA, 0xF9, 0xF8, 0xF8, 0xF7, 0xF5, 
-    0xF4, 0xF4, 0xF6, 0xF8, 0xFD, 0x03, 0x08, 0x0B, 0x0D, 0x0C, 0x0A, 0x06, 
-    0x04, 0x03, 0x02, 0x03, 0x02, 0xFF, 0xFD, 0xFE, 0xFF, 0x01, 0x05, 0x08, 
-    0x0B, 0x08, 0x04, 0x00, 0xFD, 0xFC, 0xFB, 0xFC, 0xFE, 0x01, 0x02, 0x03, 
-    0x07, 0x0C, 0x0F, 0x10, 0x11, 0x12, 0x10, 0x0D, 0x08, 0x04, 0x01, 0xFB, 
-    0xF4, 0xEF, 0xED, 0xED, 0xEE, 0xEF, 0xEE, 0xEE, 0xED, 0xEB, 0xEB, 0xED, 
-    0xEF, 0xEF, 0xEE, 0xEC, 0xEC, 0xEB, 0xEA, 0xEB, 0xED, 0xF2, 0xF7, 0xFA, 
-    0xFB, 0xFC, 0xFC, 0xFD, 0xFA, 0xF6, 0xF2, 0xF2, 0xF5, 0xF7, 0xF8, 0xF7, 
-    0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF9, 0xFC, 0xFC, 0xFA, 0xF6, 0xF3, 0xEF, 
-    0xED, 0xEE, 0xF0, 0xF2, 0xF1, 0xF0, 0xEF, 0xED, 0xEB, 0xEC, 0xF2, 0xFA, 
-    0xFC, 0xF6, 0xED, 0xE9, 0xEB, 0xF0, 0xF1, 0xF0, 0xED, 0xE8, 0xE4, 0xE1, 
-    0xE1, 0xE3, 0xE6, 0xEC, 0xEF, 0xEF, 0xEB, 0xE8, 0xE7, 0xE8, 0xE7, 0xE9, 
-    0xF0, 0xF7, 0xF8, 0xF0, 0xE6, 0xE1, 0xE3, 0xE9, 0xEF, 0xF7, 0xFE, 0x03, 
-    0x02, 0xFD, 0xF6, 0xEE, 0xEC, 0xF1, 0xF6, 0xFB, 0xFB, 0xF8, 0xF2, 0xE9, 
-    0xE3, 0xE1, 0xE9, 0xF4, 0xFC, 0xFF, 0xFE, 0xFC, 0xFB, 0xFB, 0xFC, 0xFF, 
-    0x01, 0x02, 0x00, 0xFF, 0x00, 0x04, 0x0F, 0x1A, 0x20, 0x21, 0x1D, 0x19, 
-    0x14, 0x0D, 0x09, 0x0A, 0x12, 0x18, 0x15, 0x0D, 0x07, 0x08, 0x10, 0x18, 
-    0x1E, 0x22, 0x25, 0x25, 0x22, 0x1A, 0x11, 0x0C, 0x0B, 0x0D, 0x10, 0x12, 
-    0x14, 0x17, 0x13, 0x0C, 0x05, 0x07, 0x11, 0x18, 0x16, 0x0B, 0x01, 0xFD, 
-    0xFD, 0xFD, 0xFC, 0xFC, 0x00, 0x08, 0x0F, 0x0F, 0x0B, 0x08, 0x09, 0x0B, 
-    0x0D, 0x0C, 0x0D, 0x0F, 0x0D, 0x0A, 0x0A, 0x14, 0x21, 0x27, 0x22, 0x1A, 
-    0x18, 0x20, 0x2C, 0x37, 0x3D, 0x3F, 0x3F, 0x3D, 0x38, 0x31, 0x2B, 0x28, 
-    0x2A, 0x2B, 0x29, 0x22, 0x1A, 0x13, 0x0C, 0x03, 0xFF, 0x01, 0x04, 0x01, 
-    0xF6, 0xEC, 0xE8, 0xE9, 0xE9, 0xE7, 0xE5, 0xE7, 0xEA, 0xED, 0xED, 0xEC, 
-    0xEA, 0xEB, 0xEE, 0xEF, 0xEE, 0xEF, 0xF2, 0xF5, 0xF7, 0xF8, 0xFE, 0x08, 
-    0x0D, 0x08, 0xFE, 0xF7, 0xF6, 0xFC, 0x01, 0x06, 0x0E, 0x14, 0x14, 0x11, 
-    0x0B, 0x04, 0x00, 0x02, 0x07, 0x0C, 0x0D, 0x0C, 0x0D, 0x0C, 0x09, 0x09, 
-    0x11, 0x1D, 0x22, 0x1C, 0x0D, 0x02, 0xFE, 0xFE, 0xFC, 0xF8, 0xF4, 0xF2, 
-    0xF2, 0xF3, 0xF3, 0xF1, 0xEE, 0xED, 0xEB, 0xE6, 0xE2, 0xE2, 0xE4, 0xE6, 
-    0xE4, 0xE5, 0xED, 0xF4, 0xF3, 0xE9, 0xE0, 0xE0, 0xEB, 0xF8, 0x01, 0x05, 
-    0x07, 0x05, 0x00, 0xF9, 0xF0, 0xEA, 0xE8, 0xEB, 0xF0, 0xF4, 0xF5, 0xF5, 
-    0xF1, 0xE9, 0xE3, 0xE5, 0xF1, 0xF9, 0xF9, 0xEF, 0xE6, 0xE3, 0xE5, 0xE8, 
-    0xE9, 0xED, 0xF2, 0xF7, 0xFA, 0xFA, 0xF8, 0xF6, 0xF6, 0xF8, 0xFA, 0xFA, 
-    0xF5, 0xF2, 0xEE, 0xEA, 0xE7, 0xE8, 0xEC, 0xEB, 0xE2, 0xD8, 0xD5, 0xDB, 
-    0xE4, 0xE8, 0xE9, 0xE8, 0xE4, 0xDF, 0xDA, 0xD7, 0xD9, 0xDE, 0xE8, 0xF3, 
-    0xFB, 0xFE, 0xFD, 0xF9, 0xF2, 0xEB, 0xE8, 0xEE, 0xF8, 0xFB, 0xF4, 0xEA, 
-    0xE4, 0xE3, 0xE3, 0xE4, 0xE7, 0xEF, 0xF6, 0xF8, 0xF5, 0xF0, 0xEC, 0xEA, 
-    0xEC, 0xF0, 0xF5, 0xFB, 0x02, 0x07, 0x07, 0x03, 0x03, 0x0B, 0x12, 0x10, 
-    0x05, 0xFE, 0xFE, 0x08, 0x16, 0x22, 0x2C, 0x30, 0x2D, 0x26, 0x1D, 0x17, 
-    0x14, 0x12, 0x14, 0x16, 0x17, 0x14, 0x12, 0x0B, 0x03, 0xFD, 0x00, 0x0A, 
-    0x0E, 0x09, 0xFD, 0xF5, 0xF1, 0xF4, 0xF6, 0xF9, 0x00, 0x07, 0x0C, 0x0E, 
-    0x0E, 0x0C, 0x09, 0x06, 0x05, 0x08, 0x0F, 0x17, 0x1B, 0x17, 0x0F, 0x0A, 
-    0x10, 0x19, 0x1B, 0x12, 0x08, 0x09, 0x12, 0x1D, 0x22, 0x24, 0x27, 0x2A, 
-    0x27, 0x1E, 0x13, 0x0C, 0x0C, 0x14, 0x1E, 0x22, 0x24, 0x22, 0x1F, 0x1A, 
-    0x16, 0x18, 0x26, 0x31, 0x30, 0x22, 0x13, 0x0A, 0x09, 0x0C, 0x0B, 0x0E, 
-    0x18, 0x22, 0x26, 0x22, 0x19, 0x0D, 0x06, 0x02, 0x00, 0xFE, 0xFD, 0x00, 
-    0x04, 0x05, 0x01, 0xFE, 0x03, 0x04, 0x01, 0xFB, 0xFC, 0x02, 0x0B, 0x10, 
-    0x10, 0x11, 0x14, 0x14, 0x0F, 0x07, 0x02, 0x02, 0x06, 0x0B, 0x0C, 0x0D, 
-    0x0C, 0x0B, 0x06, 0xFD, 0xF5, 0xF7, 0x01, 0x07, 0x00, 0xF3, 0xE9, 0xE6, 
-    0xEA, 0xED, 0xF1, 0xF8, 0xFF, 0x01, 0xFE, 0xF8, 0xF1, 0xEE, 0xF2, 0xF8, 
-    0xFE, 0x03, 0x0A, 0x0E, 0x0B, 0x02, 0xF7, 0xF7, 0xF9, 0xF7, 0xED, 0xE4, 
-    0xE3, 0xEC, 0xF7, 0xFA, 0xF8, 0xF3, 0xF2, 0xF2, 0xF3, 0xF2, 0xF0, 0xEE, 
-    0xF0, 0xF4, 0xFA, 0xFF, 0x04, 0x08, 0x08, 0x07, 0x0A, 0x14, 0x16, 0x0E, 
-    0xFE, 0xF2, 0xED, 0xED, 0xED, 0xEB, 0xEC, 0xF2, 0xFA, 0xFF, 0xFD, 0xF6, 
-    0xED, 0xE7, 0xE7, 0xEB, 0xF0, 0xF5, 0xF7, 0xF5, 0xF0, 0xEA, 0xED, 0xF3, 
-    0xF4, 0xEE, 0xE8, 0xEC, 0xF7, 0x04, 0x0B, 0x0D, 0x0C, 0x0D, 0x0A, 0x02, 
-    0xF9, 0xEF, 0xE9, 0xEA, 0xEA, 0xEB, 0xE8, 0xE6, 0xE6, 0xE5, 0xE2, 0xE0, 
-    0xE3, 0xE6, 0xE1, 0xD5, 0xC9, 0xC5, 0xC9, 0xCF, 0xD4, 0xD9, 0xE2, 0xED, 
-    0xF3, 0xF6, 0xF4, 0xF0, 0xEC, 0xEB, 0xE9, 0xE9, 0xEB, 0xF3, 0xFA, 0xF8, 
-    0xF0, 0xEA, 0xEE, 0xF3, 0xF3, 0xEE, 0xEA, 0xEC, 0xF3, 0xFB, 0xFB, 0xF8, 
-    0xF7, 0xF7, 0xF8, 0xF9, 0xF9, 0xF9, 0xFA, 0xFA, 0xF9, 0xFA, 0xFB, 0xFF, 
-    0x01, 0xFF, 0xFE, 0x06, 0x12, 0x16, 0x0D, 0xFD, 0xF1, 0xEF, 0xF6, 0x01, 
-    0x08, 0x0B, 0x0E, 0x0D, 0x0C, 0x08, 0x04, 0xFF, 0xFD, 0xFE, 0x01, 0x08, 
-    0x11, 0x17, 0x15, 0x10, 0x0C, 0x11, 0x17, 0x16, 0x10, 0x0A, 0x0D, 0x16, 
-    0x20, 0x24, 0x21, 0x1F, 0x1F, 0x21, 0x24, 0x25, 0x21, 0x1A, 0x13, 0x0E, 
-    0x0A, 0x0B, 0x0F, 0x14, 0x18, 0x19, 0x1F, 0x28, 0x2B, 0x23, 0x15, 0x0A, 
-    0x05, 0x08, 0x0D, 0x0F, 0x10, 0x13, 0x16, 0x15, 0x12, 0x0F, 0x0F, 0x14, 
-    0x1B, 0x21, 0x23, 0x24, 0x24, 0x24, 0x1E, 0x17, 0x18, 0x1E, 0x21, 0x1D, 
-    0x16, 0x12, 0x12, 0x16, 0x1B, 0x1B, 0x1A, 0x1A, 0x17, 0x13, 0x10, 0x10, 
-    0x11, 0x0F, 0x0A, 0x05, 0x04, 0x09, 0x14, 0x1B, 0x1C, 0x1A, 0x1B, 0x1C, 
-    0x14, 0x05, 0xF6, 0xEF, 0xF0, 0xF8, 0x00, 0x04, 0x07, 0x09, 0x06, 0x03, 
-    0x01, 0x02, 0x02, 0xFF, 0xF9, 0xF5, 0xF7, 0xFD, 0x00, 0xFC, 0xF4, 0xF2, 
-    0xFB, 0x06, 0x07, 0x00, 0xF7, 0xF3, 0xF7, 0x00, 0x08, 0x0B, 0x0C, 0x0E, 
-    0x0F, 0x10, 0x10, 0x0F, 0x0A, 0x03, 0xFB, 0xF6, 0xF4, 0xF3, 0xF1, 0xED, 
-    0xE9, 0xEC, 0xF4, 0xF4, 0xE9, 0xD9, 0xCE, 0xD0, 0xDD, 0xEB, 0xF0, 0xED, 
-    0xEC, 0xED, 0xEE, 0xF0, 0xF2, 0xF4, 0xF8, 0xFC, 0xFE, 0x00, 0x03, 0x07, 
-    0x09, 0x07, 0x04, 0x05, 0x07, 0x04, 0xFA, 0xF1, 0xED, 0xEE, 0xF3, 0xF6, 
-    0xF6, 0xF5, 0xF7, 0xFB, 0xFD, 0xFC, 0xFA, 0xF7, 0xF4, 0xF2, 0xF0, 0xF0, 
-    0xF4, 0xF8, 0xFB, 0xFA, 0xFC, 0x02, 0x06, 0x01, 0xF5, 0xEC, 0xE7, 0xE7, 
-    0xEB, 0xF0, 0xF3, 0xF3, 0xEF, 0xE7, 0xE0, 0xDB, 0xDB, 0xDE, 0xE0, 0xDF, 
-    0xDB, 0xD9, 0xD9, 0xDD, 0xDD, 0xDC, 0xDE, 0xE6, 0xEB, 0xEA, 0xE4, 0xE0, 
-    0xE1, 0xE7, 0xF1, 0xF8, 0xF9, 0xF6, 0xF4, 0xF2, 0xF4, 0xF7, 0xF7, 0xF4, 
-    0xF0, 0xEA, 0xE7, 0xEA, 0xF1, 0xF7, 0xF5, 0xF0, 0xEF, 0xF5, 0xF5, 0xEF, 
-    0xE5, 0xE0, 0xE4, 0xED, 0xF8, 0xFD, 0xFC, 0xF9, 0xF6, 0xF5, 0xF5, 0xF5, 
-    0xF3, 0xF2, 0xF5, 0xF9, 0xFC, 0x00, 0x02, 0x00, 0xFD, 0xFC, 0x04, 0x0D, 
-    0x0D, 0x01, 0xF2, 0xED, 0xF0, 0xF8, 0x00, 0x02, 0x03, 0x03, 0x05, 0x09, 
-    0x0D, 0x10, 0x0F, 0x0F, 0x10, 0x12, 0x11, 0x12, 0x14, 0x15, 0x16, 0x17, 
-    0x1C, 0x1B, 0x12, 0x05, 0xFF, 0x04, 0x10, 0x1B, 0x1F, 0x1C, 0x17, 0x15, 
-    0x15, 0x15, 0x15, 0x14, 0x14, 0x16, 0x18, 0x17, 0x15, 0x16, 0x1A, 0x1E, 
-    0x20, 0x23, 0x27, 0x27, 0x23, 0x19, 0x13, 0x12, 0x15, 0x1D, 0x22, 0x25, 
-    0x26, 0x26, 0x24, 0x21, 0x1E, 0x1C, 0x19, 0x1A, 0x17, 0x13, 0x0E, 0x0C, 
-    0x0D, 0x0B, 0x08, 0x07, 0x0A, 0x09, 0x01, 0xF3, 0xE9, 0xEA, 0xF4, 0x03, 
-    0x0A, 0x08, 0x03, 0xFF, 0x01, 0x06, 0x0C, 0x10, 0x13, 0x12, 0x10, 0x0E, 
-    0x0D, 0x0F, 0x10, 0x10, 0x13, 0x1B, 0x21, 0x1E, 0x13, 0x05, 0xFE, 0x01, 
-    0x09, 0x0F, 0x0D, 0x04, 0xFE, 0xFD, 0x01, 0x04, 0x02, 0xFD, 0xFA, 0xFA, 
-    0xFD, 0x00, 0x02, 0x01, 0xFB, 0xF5, 0xF5, 0xFD, 0x01, 0xFC, 0xF0, 0xE9, 
-    0xED, 0xF9, 0x05, 0x0A, 0x06, 0xFF, 0xFB, 0xFB, 0xFB, 0xF6, 0xEF, 0xEA, 
-    0xEB, 0xEB, 0xE9, 0xE2, 0xDE, 0xDF, 0xE3, 0xEA, 0xF6, 0xFF, 0x01, 0xFC, 
-    0xF2, 0xEF, 0xF5, 0x01, 0x0E, 0x14, 0x11, 0x0C, 0x09, 0x0C, 0x0E, 0x0E, 
-    0x0D, 0x0A, 0x09, 0x05, 0xFF, 0xF9, 0xF9, 0xFB, 0xFA, 0xF8, 0xF7, 0xF7, 
-    0xF2, 0xE9, 0xE0, 0xDF, 0xE5, 0xEE, 0xF5, 0xF6, 0xF0, 0xEB, 0xE9, 0xEB, 
-    0xEF, 0xF1, 0xF2, 0xF1, 0xF0, 0xEE, 0xEC, 0xEB, 0xEE, 0xEF, 0xEF, 0xF1, 
-    0xF7, 0xFB, 0xF6, 0xE6, 0xD6, 0xD0, 0xD5, 0xE3, 0xEF, 0xF1, 0xEA, 0xE1, 
-    0xDD, 0xDD, 0xDF, 0xE0, 0xE3, 0xE7, 0xEC, 0xEF, 0xF0, 0xF2, 0xF6, 0xF7, 
-    0xF8, 0xFC, 0x03, 0x03, 0xF9, 0xEA, 0xE1, 0xE3, 0xEF, 0xFB, 0xFE, 0xF6, 
-    0xEA, 0xE2, 0xE3, 0xE8, 0xEC, 0xEB, 0xE8, 0xE6, 0xE5, 0xE4, 0xE5, 0xEA, 
-    0xEF, 0xF3, 0xF7, 0x01, 0x0B, 0x0E, 0x07, 0xFC, 0xF6, 0xFA, 0x06, 0x10, 
-    0x10, 0x08, 0x01, 0xFF, 0x01, 0x01, 0xFD, 0xFA, 0xFA, 0xFC, 0xFE, 0xFD, 
-    0xFB, 0xFA, 0xF7, 0xF6, 0xF9, 0x01, 0x06, 0x01, 0xF6, 0xEC, 0xEB, 0xF3, 
-    0x01, 0x0D, 0x11, 0x0D, 0x0A, 0x0B, 0x10, 0x18, 0x1E, 0x20, 0x20, 0x1E, 
-    0x1B, 0x18, 0x18, 0x1B, 0x1F, 0x23, 0x2A, 0x2D, 0x29, 0x1B, 0x0B, 0x02, 
-    0x04, 0x0E, 0x19, 0x1F, 0x1B, 0x13, 0x0D, 0x0D, 0x10, 0x14, 0x18, 0x1B, 
-    0x1C, 0x1A, 0x16, 0x14, 0x15, 0x14, 0x13, 0x12, 0x16, 0x1B, 0x1B, 0x16, 
-    0x0F, 0x0B, 0x0F, 0x19, 0x25, 0x2A, 0x25, 0x1A, 0x13, 0x0F, 0x10, 0x11, 
-    0x13, 0x16, 0x17, 0x14, 0x0D, 0x09, 0x08, 0x0A, 0x0B, 0x0F, 0x17, 0x1D, 
-    0x1A, 0x0E, 0x02, 0xFF, 0x07, 0x16, 0x24, 0x27, 0x1E, 0x14, 0x0C, 0x08, 
-    0x09, 0x0D, 0x11, 0x12, 0x0F, 0x08, 0x01, 0xFE, 0xFD, 0xFC, 0xFA, 0xFC, 
-    0x02, 0x03, 0xFA, 0xEC, 0xE1, 0xE1, 0xE7, 0xF2, 0xF8, 0xF7, 0xF2, 0xED, 
-    0xED, 0xF0, 0xF5, 0xF8, 0xFA, 0xFA, 0xF8, 0xF7, 0xF6, 0xF8, 0xFA, 0xFB, 
-    0xFE, 0x05, 0x0C, 0x0A, 0xFF, 0xF1, 0xEA, 0xEE, 0xF6, 0xFE, 0x02, 0xFF, 
-    0xF9, 0xF1, 0xEA, 0xEA, 0xED, 0xF4, 0xFA, 0xFE, 0xFE, 0xFB, 0xF8, 0xF8, 
-    0xFA, 0xFC, 0x00, 0x07, 0x0C, 0x09, 0xFF, 0xF5, 0xF2, 0xF9, 0x05, 0x10, 
-    0x11, 0x09, 0xFD, 0xF3, 0xEF, 0xF0, 0xF2, 0xF4, 0xF6, 0xF6, 0xF3, 0xEF, 
-    0xEF, 0xF3, 0xFB, 0x00, 0x05, 0x09, 0x0A, 0x05, 0xFB, 0xF3, 0xF1, 0xF9, 
-    0x04, 0x0C, 0x0B, 0x01, 0xF6, 0xF0, 0xEF, 0xF3, 0xF9, 0xFC, 0xFC, 0xF7, 
-    0xF0, 0xE8, 0xE3, 0xE0, 0xDF, 0xDF, 0xE5, 0xEB, 0xED, 0xE5, 0xD5, 0xC8, 
-    0xC6, 0xD0, 0xDD, 0xE6, 0xE8, 0xE4, 0xE2, 0xE2, 0xE4, 0xEA, 0xF2, 0xF8, 
-    0xF9, 0xF7, 0xF4, 0xF0, 0xF0, 0xF0, 0xEF, 0xF0, 0xF3, 0xF5, 0xED, 0xDE, 
-    0xCF, 0xC8, 0xD0, 0xDE, 0xEC, 0xF2, 0xEF, 0xE7, 0xE1, 0xE2, 0xE8, 0xF1, 
-    0xF8, 0xFD, 0xFF, 0xFE, 0xFB, 0xF7, 0xF7, 0xF8, 0xFB, 0x01, 0x08, 0x0A, 
-    0x05, 0xFB, 0xF2, 0xF0, 0xF8, 0x04, 0x0E, 0x13, 0x10, 0x08, 0x02, 0xFE, 
-    0xFE, 0xFF, 0x01, 0x04, 0x05, 0x03, 0x02, 0x01, 0x04, 0x06, 0x07, 0x0D, 
-    0x15, 0x1B, 0x19, 0x11, 0x0A, 0x0C, 0x17, 0x25, 0x2D, 0x2B, 0x21, 0x17, 
-    0x12, 0x14, 0x18, 0x1E, 0x23, 0x25, 0x20, 0x17, 0x0D, 0x08, 0x08, 0x0A, 
-    0x10, 0x1A, 0x22, 0x21, 0x17, 0x09, 0x01, 0x04, 0x10, 0x1B, 0x23, 0x22, 
-    0x1C, 0x15, 0x10, 0x0E, 0x0E, 0x10, 0x12, 0x12, 0x0E, 0x0B, 0x0A, 0x0C, 
-    0x0E, 0x0F, 0x0F, 0x12, 0x15, 0x12, 0x0A, 0xFE, 0xFA, 0x00, 0x0E, 0x19, 
-    0x1E, 0x1A, 0x12, 0x0D, 0x0D, 0x11, 0x14, 0x18, 0x1A, 0x1A, 0x14, 0x0C, 
-    0x06, 0x03, 0x04, 0x08, 0x10, 0x1A, 0x1F, 0x1A, 0x0D, 0x01, 0xFF, 0x07, 
-    0x15, 0x20, 0x22, 0x18, 0x0C, 0x03, 0xFE, 0xFB, 0xFD, 0x04, 0x0A, 0x0E, 
-    0x0B, 0x05, 0x02, 0x04, 0x05, 0x06, 0x0A, 0x0D, 0x0D, 0x05, 0xFA, 0xF4, 
-    0xF7, 0x00, 0x09, 0x0C, 0x08, 0xFD, 0xF3, 0xEF, 0xEF, 0xF1, 0xF6, 0xFC, 
-    0xFC, 0xF6, 0xED, 0xE6, 0xE6, 0xEA, 0xEF, 0xF4, 0xFB, 0xFF, 0xFD, 0xF3, 
-    0xE6, 0xDE, 0xE0, 0xEC, 0xF9, 0x03, 0x05, 0xFF, 0xF8, 0xF4, 0xF5, 0xF9, 
-    0xFF, 0x05, 0x0A, 0x0A, 0x06, 0x01, 0x01, 0x00, 0x00, 0x01, 0x05, 0x06, 
-    0x01, 0xF4, 0xE7, 0xE2, 0xE8, 0xF4, 0xFC, 0xFF, 0xF9, 0xF0, 0xEC, 0xED, 
-    0xF2, 0xF9, 0xFE, 0x00, 0xFD, 0xF4, 0xEA, 0xE4, 0xE6, 0xED, 0xF4, 0xFC, 
-    0x03, 0x04, 0xFC, 0xF1, 0xE9, 0xE9, 0xF1, 0xFB, 0x03, 0x03, 0xFA, 0xEE, 
-    0xE5, 0xE1, 0xE1, 0xE4, 0xE8, 0xEB, 0xEA, 0xE8, 0xE5, 0xE5, 0xE6, 0xE7, 
-    0xEA, 0xF0, 0xF6, 0xF8, 0xF5, 0xED, 0xE8, 0xEB, 0xF4, 0xFD, 0x02, 0x00, 
-    0xF9, 0xF1, 0xEB, 0xEB, 0xEE, 0xF3, 0xF6, 0xF6, 0xEE, 0xE4, 0xDC, 0xDB, 
-    0xDF, 0xE6, 0xEE, 0xF6, 0xF9, 0xF5, 0xEA, 0xDF, 0xDA, 0xDF, 0xEB, 0xF6, 
-    0xFA, 0xF7, 0xEC, 0xE2, 0xDD, 0xDF, 0xE7, 0xF1, 0xFA, 0xFE, 0xFC, 0xF6, 
-    0xF2, 0xF2, 0xF3, 0xF4, 0xF6, 0xFB, 0xFD, 0xFB, 0xF5, 0xF2, 0xF4, 0xFB, 
-    0x04, 0x0D, 0x11, 0x0F, 0x08, 0x05, 0x08, 0x0F, 0x17, 0x1D, 0x1F, 0x1B, 
-    0x17, 0x12, 0x11, 0x14, 0x17, 0x1D, 0x24, 0x2A, 0x28, 0x1D, 0x0D, 0x05, 
-    0x08, 0x12, 0x1E, 0x26, 0x27, 0x1E, 0x12, 0x09, 0x06, 0x0A, 0x14, 0x1F, 
-    0x25, 0x23, 0x1C, 0x17, 0x17, 0x19, 0x19, 0x1D, 0x22, 0x26, 0x25, 0x1B, 
-    0x0F, 0x09, 0x0D, 0x16, 0x1C, 0x1D, 0x17, 0x0D, 0x04, 0xFF, 0x02, 0x08, 
-    0x0D, 0x0E, 0x0A, 0x03, 0xFE, 0xFF, 0x08, 0x11, 0x19, 0x1F, 0x22, 0x21, 
-    0x18, 0x0C, 0x04, 0x04, 0x0C, 0x17, 0x1F, 0x23, 0x1F, 0x13, 0x06, 0xFF, 
-    0x02, 0x0B, 0x14, 0x1A, 0x19, 0x12, 0x08, 0x01, 0xFF, 0xFE, 0x01, 0x06, 
-    0x09, 0x08, 0x00, 0xF5, 0xEE, 0xEF, 0xF3, 0xFA, 0x00, 0x03, 0x00, 0xFA, 
-    0xF6, 0xFA, 0x01, 0x09, 0x0C, 0x0A, 0x01, 0xF6, 0xEE, 0xEE, 0xF6, 0x01, 
-    0x0A, 0x0E, 0x0B, 0x02, 0xF7, 0xEE, 0xED, 0xF4, 0xFE, 0x06, 0x08, 0x06, 
-    0xFD, 0xF2, 0xEC, 0xF0, 0xFA, 0x07, 0x10, 0x11, 0x0A, 0xFF, 0xF8, 0xF6, 
-    0xF8, 0xFB, 0xFF, 0x03, 0x06, 0x04, 0xFE, 0xF6, 0xF4, 0xF7, 0xFE, 0x04, 
-    0x07, 0x05, 0xFD, 0xF3, 0xEF, 0xF4, 0xFC, 0x02, 0x03, 0xFE, 0xF6, 0xF2, 
-    0xF4, 0xF9, 0xFF, 0x03, 0x06, 0x06, 0xFF, 0xF2, 0xE5, 0xDE, 0xE2, 0xED, 
-    0xF9, 0xFF, 0xFD, 0xF3, 0xE4, 0xDA, 0xDA, 0xE5, 0xF4, 0x01, 0x06, 0x01, 
-    0xF7, 0xEC, 0xE6, 0xE6, 0xE9, 0xEE, 0xF3, 0xF4, 0xF0, 0xE9, 0xE1, 0xDD, 
-    0xE0, 0xE6, 0xED, 0xF2, 0xF2, 0xED, 0xE7, 0xE4, 0xE8, 0xEF, 0xF6, 0xFB, 
-    0xFC, 0xF4, 0xEC, 0xE5, 0xE7, 0xED, 0xF5, 0xFA, 0xF9, 0xF4, 0xEA, 0xE0, 
-    0xD9, 0xDC, 0xE3, 0xEE, 0xF6, 0xFB, 0xF8, 0xED, 0xE1, 0xDC, 0xE1, 0xED, 
-    0xFB, 0x04, 0x06, 0xFF, 0xF5, 0xEC, 0xEC, 0xF1, 0xFB, 0x04, 0x0A, 0x09, 
-    0x00, 0xF4, 0xEB, 0xEC, 0xF2, 0xFB, 0x04, 0x0A, 0x09, 0xFE, 0xF4, 0xF1, 
-    0xF6, 0xFC, 0xFF, 0xFE, 0xF8, 0xF1, 0xEC, 0xED, 0xF4, 0xFD, 0x06, 0x0B, 
-    0x0B, 0x06, 0xFE, 0xF8, 0xF9, 0x00, 0x0D, 0x1A, 0x23, 0x23, 0x18, 0x09, 
-    0xFF, 0x04, 0x11, 0x1E, 0x25, 0x24, 0x1D, 0x12, 0x06, 0xFF, 0xFD, 0x01, 
-    0x09, 0x11, 0x16, 0x12, 0x09, 0xFF, 0xFA, 0xFF, 0x0A, 0x16, 0x1E, 0x21, 
-    0x1D, 0x16, 0x13, 0x16, 0x1D, 0x25, 0x28, 0x24, 0x1C, 0x14, 0x10, 0x14, 
-    0x19, 0x1E, 0x22, 0x22, 0x1F, 0x16, 0x0C, 0x05, 0x07, 0x12, 0x1D, 0x22, 
-    0x1F, 0x14, 0x06, 0xFC, 0xFA, 0x04, 0x11, 0x1C, 0x23, 0x1F, 0x14, 0x08, 
-    0x01, 0x02, 0x09, 0x15, 0x1F, 0x22, 0x1D, 0x13, 0x08, 0x02, 0x02, 0x07, 
-    0x0F, 0x15, 0x19, 0x17, 0x0D, 0x02, 0xFD, 0x00, 0x07, 0x0D, 0x0F, 0x0A, 
-    0x04, 0x01, 0x02, 0x06, 0x09, 0x0B, 0x0B, 0x09, 0x04, 0xFD, 0xF7, 0xF8, 
-    0x01, 0x0D, 0x14, 0x12, 0x06, 0xF5, 0xE6, 0xE0, 0xE5, 0xF1, 0xFE, 0x06, 
-    0x06, 0xFD, 0xEF, 0xE3, 0xE2, 0xE8, 0xF1, 0xFB, 0x01, 0x01, 0xFA, 0xEE, 
-    0xE2, 0xDE, 0xE4, 0xF2, 0xFF, 0x05, 0x02, 0xF9, 0xF0, 0xEE, 0xF1, 0xF8, 
-    0xFD, 0x01, 0x00, 0xFB, 0xF4, 0xF0, 0xF2, 0xF6, 0xFD, 0x02, 0x04, 0x03, 
-    0x01, 0xFC, 0xFA, 0xFC, 0x04, 0x0A, 0x09, 0x02, 0xF5, 0xE6, 0xDD, 0xE1, 
-    0xED, 0xFC, 0x07, 0x0B, 0x04, 0xF7, 0xE9, 0xE1, 0xE5, 0xEF, 0xFC, 0x03, 
-    0x02, 0xF9, 0xEB, 0xDB, 0xD3, 0xD5, 0xE1, 0xEF, 0xF8, 0xFA, 0xF2, 0xE3, 
-    0xD7, 0xD2, 0xD6, 0xDD, 0xE4, 0xE9, 0xE5, 0xDD, 0xD6, 0xD4, 0xD7, 0xDD, 
-    0xE3, 0xE5, 0xE4, 0xE0, 0xDB, 0xD9, 0xDD, 0xE5, 0xF0, 0xF7, 0xF6, 0xEE, 
-    0xE3, 0xD9, 0xD7, 0xDE, 0xE9, 0xF6, 0xFB, 0xF8, 0xEF, 0xE6, 0xE2, 0xE8, 
-    0xF6, 0x07, 0x16, 0x1D, 0x1A, 0x0E, 0xFE, 0xF0, 0xEB, 0xF0, 0xFC, 0x06, 
-    0x0A, 0x06, 0xFC, 0xF2, 0xF0, 0xF8, 0x05, 0x14, 0x1D, 0x1F, 0x17, 0x0D, 
-    0x06, 0x03, 0x04, 0x09, 0x0F, 0x11, 0x12, 0x0F, 0x09, 0x04, 0x07, 0x10, 
-    0x17, 0x1A, 0x15, 0x0B, 0xFF, 0xFB, 0x00, 0x0C, 0x16, 0x1D, 0x1C, 0x15, 
-    0x0C, 0x04, 0x05, 0x0D, 0x19, 0x24, 0x2A, 0x27, 0x1D, 0x0E, 0x02, 0xFE, 
-    0x04, 0x10, 0x1C, 0x23, 0x23, 0x1B, 0x0E, 0x05, 0x03, 0x09, 0x14, 0x1D, 
-    0x20, 0x1C, 0x13, 0x0B, 0x08, 0x09, 0x0C, 0x12, 0x18, 0x1D, 0x1B, 0x17, 
-    0x11, 0x12, 0x19, 0x21, 0x25, 0x24, 0x1E, 0x15, 0x0D, 0x0C, 0x10, 0x17, 
-    0x1F, 0x22, 0x1D, 0x12, 0x06, 0x00, 0x01, 0x07, 0x0F, 0x16, 0x18, 0x16, 
-    0x0D, 0x02, 0xFC, 0x02, 0x0D, 0x19, 0x1E, 0x1E, 0x19, 0x10, 0x09, 0x09, 
-    0x10, 0x1C, 0x29, 0x2F, 0x2E, 0x24, 0x19, 0x14, 0x12, 0x13, 0x17, 0x1B, 
-    0x1D, 0x1C, 0x15, 0x0C, 0x05, 0x05, 0x0A, 0x12, 0x18, 0x1C, 0x1C, 0x17, 
-    0x14, 0x16, 0x1B, 0x20, 0x20, 0x1A, 0x0F, 0x05, 0xFF, 0x02, 0x09, 0x13, 
-    0x1D, 0x23, 0x26, 0x20, 0x14, 0x07, 0x01, 0x01, 0x07, 0x0C, 0x0C, 0x05, 
-    0xF8, 0xEA, 0xE4, 0xE6, 0xF1, 0xFF, 0x09, 0x0C, 0x06, 0xFC, 0xF3, 0xEF, 
-    0xF1, 0xF5, 0xFB, 0x01, 0x05, 0x04, 0xFF, 0xF9, 0xF9, 0xFE, 0x07, 0x0B, 
-    0x0B, 0x06, 0xFD, 0xF5, 0xF2, 0xF2, 0xF8, 0xFF, 0x01, 0xFF, 0xF7, 0xF2, 
-    0xF0, 0xF5, 0xF9, 0xFF, 0x04, 0x05, 0x03, 0xFA, 0xEF, 0xE8, 0xEB, 0xF5, 
-    0xFF, 0x03, 0x03, 0xFD, 0xF4, 0xEE, 0xEE, 0xF6, 0x02, 0x0D, 0x11, 0x0D, 
-    0x03, 0xF8, 0xF2, 0xEF, 0xF1, 0xF9, 0x03, 0x09, 0x07, 0xFC, 0xF0, 0xEA, 
-    0xED, 0xF5, 0xFC, 0x00, 0xFF, 0xFA, 0xF1, 0xEB, 0xEA, 0xEE, 0xF4, 0xF8, 
-    0xF7, 0xF2, 0xED, 0xEA, 0xEE, 0xF4, 0xFB, 0x00, 0x03, 0x02, 0xFC, 0xF3, 
-    0xEB, 0xEB, 0xF3, 0xFE, 0x06, 0x06, 0xFC, 0xEE, 0xE1, 0xDD, 0xE3, 0xEE, 
-    0xF9, 0x01, 0x01, 0xFC, 0xF4, 0xEF, 0xEC, 0xEC, 0xEF, 0xF5, 0xFA, 0xFD, 
-    0xF8, 0xEC, 0xE3, 0xE3, 0xEB, 0xF5, 0xFD, 0x00, 0xFE, 0xF9, 0xF3, 0xF0, 
-    0xF2, 0xF5, 0xF7, 0xF7, 0xF3, 0xEC, 0xE5, 0xE2, 0xE5, 0xEA, 0xF1, 0xF7, 
-    0xFA, 0xF7, 0xEF, 0xE6, 0xE2, 0xE7, 0xF2, 0xFB, 0xFE, 0xFC, 0xF5, 0xED, 
-    0xEA, 0xF0, 0xFC, 0x08, 0x10, 0x10, 0x0D, 0x05, 0xFA, 0xF4, 0xF2, 0xF6, 
-    0xFE, 0x06, 0x09, 0x04, 0xF9, 0xEE, 0xEA, 0xEF, 0xF8, 0x00, 0x02, 0x00, 
-    0xFA, 0xF4, 0xF1, 0xF2, 0xF5, 0xF9, 0xFC, 0xFE, 0x00, 0xFE, 0xFC, 0xFC, 
-    0xFD, 0xFE, 0x01, 0x01, 0xFF, 0xFA, 0xF3, 0xEE, 0xF1, 0xFA, 0x03, 0x08, 
-    0x06, 0xFD, 0xEF, 0xE5, 0xE1, 0xE7, 0xF1, 0xFA, 0xFE, 0xFB, 0xF4, 0xED, 
-    0xE8, 0xE7, 0xEA, 0xF2, 0xFC, 0x04, 0x07, 0x02, 0xF9, 0xF1, 0xF0, 0xF7, 
-    0xFF, 0x04, 0x04, 0xFE, 0xF6, 0xEF, 0xED, 0xF0, 0xF4, 0xF5, 0xF4, 0xF0, 
-    0xEA, 0xE6, 0xE4, 0xE5, 0xE7, 0xEC, 0xF2, 0xF5, 0xF3, 0xEF, 0xEA, 0xEA, 
-    0xED, 0xF3, 0xF6, 0xF4, 0xEF, 0xE7, 0xE0, 0xDE, 0xE3, 0xEC, 0xF6, 0xFC, 
-    0xFE, 0xFC, 0xF6, 0xF0, 0xED, 0xED, 0xF0, 0xF5, 0xF9, 0xFA, 0xF3, 0xE4, 
-    0xD8, 0xD4, 0xDA, 0xE4, 0xEE, 0xF3, 0xF4, 0xEF, 0xE9, 0xE5, 0xE5, 0xE8, 
-    0xEA, 0xED, 0xEE, 0xED, 0xEC, 0xEC, 0xED, 0xF0, 0xF5, 0xFB, 0xFE, 0xFD, 
-    0xF7, 0xEE, 0xE8, 0xEA, 0xEF, 0xF4, 0xF6, 0xF4, 0xED, 0xE3, 0xDE, 0xE0, 
-    0xE8, 0xF1, 0xF7, 0xF9, 0xF6, 0xEF, 0xE9, 0xE7, 0xEA, 0xF0, 0xF8, 0x01, 
-    0x08, 0x0D, 0x0B, 0x06, 0x02, 0x03, 0x0A, 0x11, 0x16, 0x15, 0x0D, 0x02, 
-    0xF9, 0xF7, 0xF9, 0xFD, 0x01, 0x03, 0x01, 0xFC, 0xF6, 0xF4, 0xF7, 0xFA, 
-    0xFF, 0x04, 0x07, 0x09, 0x05, 0xFE, 0xFC, 0xFF, 0x07, 0x0E, 0x11, 0x0F, 
-    0x09, 0x03, 0x02, 0x05, 0x0C, 0x13, 0x16, 0x14, 0x0E, 0x08, 0x04, 0x07, 
-    0x0E, 0x17, 0x1E, 0x24, 0x24, 0x1D, 0x10, 0x03, 0xFF, 0x03, 0x0E, 0x16, 
-    0x1B, 0x19, 0x13, 0x0F, 0x0D, 0x10, 0x13, 0x16, 0x17, 0x16, 0x13, 0x10, 
-    0x0D, 0x0C, 0x0D, 0x0E, 0x14, 0x1B, 0x1E, 0x1C, 0x15, 0x0F, 0x11, 0x17, 
-    0x1E, 0x21, 0x1E, 0x15, 0x0B, 0x06, 0x07, 0x0D, 0x13, 0x17, 0x19, 0x17, 
-    0x13, 0x0E, 0x09, 0x07, 0x07, 0x0B, 0x13, 0x19, 0x1A, 0x15, 0x0F, 0x0F, 
-    0x17, 0x23, 0x2D, 0x33, 0x30, 0x26, 0x1B, 0x13, 0x10, 0x12, 0x15, 0x19, 
-    0x1A, 0x18, 0x15, 0x11, 0x0F, 0x10, 0x12, 0x16, 0x1B, 0x1E, 0x1B, 0x14, 
-    0x0C, 0x09, 0x0A, 0x10, 0x14, 0x17, 0x16, 0x12, 0x10, 0x10, 0x13, 0x16, 
-    0x18, 0x18, 0x15, 0x10, 0x0B, 0x0A, 0x0E, 0x12, 0x17, 0x1B, 0x1F, 0x1E, 
-    0x17, 0x0C, 0x03, 0x02, 0x05, 0x0C, 0x10, 0x12, 0x0D, 0x04, 0xFB, 0xF6, 
-    0xF5, 0xF8, 0xFD, 0x01, 0x03, 0x02, 0x01, 0x01, 0x05, 0x07, 0x09, 0x0E, 
-    0x14, 0x15, 0x10, 0x09, 0x04, 0x06, 0x0C, 0x12, 0x14, 0x12, 0x0A, 0x01, 
-    0xFB, 0xFA, 0xFC, 0xFD, 0xFD, 0xFC, 0xFA, 0xF8, 0xF8, 0xFA, 0xFC, 0xFE, 
-    0x01, 0x05, 0x06, 0x02, 0xFA, 0xF1, 0xEE, 0xF4, 0xFC, 0x02, 0x03, 0xFF, 
-    0xF8, 0xF2, 0xF1, 0xF3, 0xF7, 0xFA, 0xFB, 0xFB, 0xF6, 0xF0, 0xEB, 0xE9, 
-    0xEA, 0xEA, 0xEF, 0xF7, 0xFF, 0x00, 0xFA, 0xF3, 0xEF, 0xF2, 0xF8, 0xFE, 
-    0x01, 0xFF, 0xF9, 0xF6, 0xF7, 0xFD, 0x03, 0x04, 0x01, 0xFD, 0xFA, 0xF9, 
-    0xFA, 0xFB, 0xFB, 0xFC, 0xFE, 0x01, 0xFF, 0xF7, 0xEC, 0xE6, 0xEB, 0xF6, 
-    0x01, 0x07, 0x07, 0x00, 0xF8, 0xF3, 0xF1, 0xF2, 0xF6, 0xFA, 0xFC, 0xFB, 
-    0xF8, 0xF5, 0xF7, 0xFA, 0xFB, 0xFC, 0xFE, 0x00, 0xFF, 0xF8, 0xEF, 0xEA, 
-    0xED, 0xF4, 0xFD, 0x02, 0x01, 0xFC, 0xF5, 0xF2, 0xF1, 0xF1, 0xF0, 0xF1, 
-    0xF0, 0xEC, 0xE9, 0xE7, 0xE8, 0xEB, 0xED, 0xF0, 0xF4, 0xF7, 0xF6, 0xF0, 
-    0xEB, 0xEB, 0xF1, 0xFB, 0x02, 0x02, 0xFC, 0xF2, 0xED, 0xEB, 0xF0, 0xF6, 
-    0xFB, 0xFE, 0xFC, 0xF7, 0xF2, 0xEE, 0xEB, 0xEA, 0xEB, 0xF1, 0xFA, 0xFE, 
-    0xFA, 0xF2, 0xED, 0xEE, 0xF4, 0xFC, 0x02, 0x02, 0xFD, 0xF6, 0xF2, 0xF2, 
-    0xF4, 0xF6, 0xF7, 0xF6, 0xF5, 0xF5, 0xF5, 0xF8, 0xFC, 0xFD, 0xFF, 0x01, 
-    0x03, 0xFF, 0xF7, 0xED, 0xE8, 0xEA, 0xF1, 0xFB, 0x02, 0x03, 0xFD, 0xF7, 
-    0xF3, 0xF3, 0xF5, 0xF7, 0xF8, 0xF8, 0xF7, 0xF5, 0xF4, 0xF6, 0xFB, 0xFF, 
-    0x06, 0x0C, 0x11, 0x10, 0x09, 0x01, 0xFE, 0x00, 0x05, 0x09, 0x0C, 0x0C, 
-    0x06, 0xFF, 0xF8, 0xF5, 0xF7, 0xFA, 0xFC, 0xFA, 0xF3, 0xED, 0xE9, 0xEA, 
-    0xEA, 0xE7, 0xE5, 0xE6, 0xE8, 0xE9, 0xE7, 0xE2, 0xE2, 0xE8, 0xF0, 0xF5, 
-    0xF4, 0xEC, 0xE3, 0xDC, 0xDA, 0xDD, 0xE3, 0xE7, 0xE9, 0xE9, 0xE6, 0xE5, 
-    0xE5, 0xE6, 0xE8, 0xEA, 0xEF, 0xF4, 0xF5, 0xF0, 0xE8, 0xE0, 0xDF, 0xE4, 
-    0xEB, 0xF4, 0xF9, 0xF9, 0xF6, 0xF3, 0xF1, 0xF1, 0xF1, 0xF0, 0xED, 0xE9, 
-    0xE8, 0xE8, 0xEA, 0xEE, 0xF1, 0xF6, 0xFB, 0x00, 0x00, 0xF9, 0xF0, 0xEA, 
-    0xEB, 0xF1, 0xF7, 0xF9, 0xF6, 0xF1, 0xEC, 0xEA, 0xEA, 0xEC, 0xEF, 0xF1, 
-    0xEF, 0xEA, 0xE9, 0xE9, 0xEC, 0xEE, 0xF0, 0xF3, 0xF9, 0xFE, 0xFE, 0xF9, 
-    0xF4, 0xF5, 0xFE, 0x0A, 0x15, 0x1B, 0x1A, 0x14, 0x0D, 0x08, 0x06, 0x07, 
-    0x09, 0x0B, 0x0C, 0x0A, 0x06, 0x04, 0x04, 0x01, 0xFC, 0xF9, 0xFB, 0xFD, 
-    0xFD, 0xF9, 0xF4, 0xF4, 0xFA, 0x03, 0x0A, 0x0D, 0x09, 0x06, 0x04, 0x04, 
-    0x08, 0x0E, 0x13, 0x13, 0x0F, 0x08, 0x02, 0x01, 0x05, 0x0A, 0x0E, 0x12, 
-    0x18, 0x19, 0x15, 0x0C, 0x04, 0x03, 0x07, 0x0F, 0x14, 0x13, 0x10, 0x0C, 
-    0x0C, 0x0D, 0x0F, 0x11, 0x12, 0x13, 0x10, 0x0A, 0x06, 0x05, 0x07, 0x0A, 
-    0x0D, 0x11, 0x15, 0x17, 0x13, 0x0C, 0x07, 0x0A, 0x13, 0x1B, 0x1E, 0x1C, 
-    0x17, 0x12, 0x10, 0x0F, 0x10, 0x10, 0x12, 0x13, 0x14, 0x13, 0x14, 0x17, 
-    0x1B, 0x1E, 0x20, 0x24, 0x25, 0x21, 0x1B, 0x15, 0x15, 0x1B, 0x27, 0x33, 
-    0x39, 0x35, 0x2C, 0x21, 0x19, 0x16, 0x15, 0x14, 0x15, 0x13, 0x10, 0x0D, 
-    0x0C, 0x0E, 0x0F, 0x10, 0x0F, 0x11, 0x12, 0x0F, 0x09, 0x04, 0x04, 0x07, 
-    0x0D, 0x10, 0x0F, 0x0A, 0x06, 0x03, 0x03, 0x07, 0x0C, 0x11, 0x13, 0x0F, 
-    0x08, 0x02, 0x02, 0x05, 0x09, 0x0B, 0x0F, 0x15, 0x18, 0x18, 0x12, 0x0C, 
-    0x0B, 0x10, 0x17, 0x1D, 0x1D, 0x17, 0x11, 0x0C, 0x0B, 0x0B, 0x0C, 0x0D, 
-    0x0F, 0x0D, 0x0A, 0x08, 0x08, 0x08, 0x07, 0x05, 0x07, 0x0B, 0x0B, 0x04, 
-    0xFA, 0xF5, 0xF8, 0x01, 0x0A, 0x0E, 0x0A, 0x06, 0x02, 0x03, 0x02, 0x02, 
-    0x00, 0xFD, 0xFA, 0xF5, 0xF3, 0xF4, 0xFA, 0x00, 0x04, 0x07, 0x0A, 0x0B, 
-    0x06, 0xFC, 0xF2, 0xEF, 0xF4, 0xFC, 0x04, 0x06, 0x02, 0xFF, 0xFC, 0xFB, 
-    0xFB, 0xFC, 0xFD, 0xFF, 0xFF, 0xFE, 0xFA, 0xF7, 0xF6, 0xF2, 0xEF, 0xEF, 
-    0xF2, 0xF6, 0xF7, 0xF4, 0xF0, 0xF1, 0xF5, 0xFA, 0xFD, 0xFC, 0xF9, 0xF7, 
-    0xF6, 0xF7, 0xF8, 0xFB, 0xFD, 0xFE, 0xFC, 0xFA, 0xF7, 0xF5, 0xF5, 0xF6, 
-    0xF7, 0xFA, 0xFC, 0xF9, 0xF2, 0xEB, 0xEA, 0xEF, 0xF7, 0xFE, 0xFF, 0xFC, 
-    0xF9, 0xF5, 0xF2, 0xF0, 0xF1, 0xF3, 0xF6, 0xF6, 0xF4, 0xF1, 0xF0, 0xF2, 
-    0xF3, 0xF4, 0xF5, 0xF9, 0xFD, 0xFF, 0xFB, 0xF3, 0xEF, 0xF0, 0xF7, 0xFC, 
-    0xFD, 0xFC, 0xFD, 0xFE, 0xFD, 0xF9, 0xF5, 0xF4, 0xF3, 0xF1, 0xEE, 0xEE, 
-    0xF2, 0xF7, 0xFA, 0xFB, 0xFD, 0x02, 0x07, 0x07, 0x02, 0xFD, 0xFE, 0x04, 
-    0x0E, 0x14, 0x11, 0x09, 0x02, 0xFD, 0xF8, 0xF6, 0xF6, 0xF7, 0xFA, 0xFA, 
-    0xF4, 0xEE, 0xEB, 0xEA, 0xEB, 0xEC, 0xED, 0xF0, 0xEF, 0xEC, 0xE7, 0xE4, 
-    0xE5, 0xEB, 0xF1, 0xF3, 0xF1, 0xEE, 0xED, 0xEC, 0xED, 0xEC, 0xED, 0xF0, 
-    0xF2, 0xF3, 0xF4, 0xF7, 0xFB, 0xFD, 0xFD, 0xFD, 0xFF, 0x00, 0xFF, 0xF8, 
-    0xF1, 0xEC, 0xED, 0xF2, 0xF8, 0xFA, 0xFA, 0xF9, 0xF8, 0xF9, 0xFA, 0xFC, 
-    0xFE, 0x01, 0x01, 0xFE, 0xF8, 0xF5, 0xF3, 0xF4, 0xF5, 0xFA, 0x03, 0x0A, 
-    0x09, 0x03, 0xFA, 0xF7, 0xFB, 0x01, 0x07, 0x07, 0x04, 0xFF, 0xFA, 0xF7, 
-    0xF6, 0xF5, 0xF5, 0xF6, 0xF5, 0xF4, 0xF5, 0xF6, 0xF9, 0xFA, 0xF7, 0xF4, 
-    0xF4, 0xF3, 0xEF, 0xE9, 0xE6, 0xEB, 0xF2, 0xFA, 0xFC, 0xFA, 0xF7, 0xF3, 
-    0xF0, 0xED, 0xEB, 0xE9, 0xE9, 0xEA, 0xE9, 0xEA, 0xE9, 0xEA, 0xE8, 0xE5, 
-    0xE4, 0xE8, 0xF0, 0xF3, 0xEF, 0xE6, 0xE1, 0xE4, 0xEB, 0xF0, 0xF3, 0xF3, 
-    0xF2, 0xF2, 0xF1, 0xF0, 0xF1, 0xF1, 0xF1, 0xF3, 0xF3, 0xF1, 0xED, 0xEA, 
-    0xE8, 0xE9, 0xEC, 0xF1, 0xF4, 0xF2, 0xEC, 0xE7, 0xE9, 0xED, 0xF3, 0xF7, 
-    0xF4, 0xF0, 0xED, 0xEB, 0xEA, 0xE9, 0xEA, 0xEB, 0xEC, 0xEB, 0xE9, 0xE6, 
-    0xE3, 0xE1, 0xE2, 0xE3, 0xE5, 0xEA, 0xF0, 0xF2, 0xF0, 0xED, 0xEE, 0xF3, 
-    0xFC, 0x04, 0x09, 0x0D, 0x10, 0x10, 0x0B, 0x04, 0xFD, 0xFB, 0xFC, 0x01, 
-    0x05, 0x09, 0x0D, 0x11, 0x13, 0x11, 0x11, 0x14, 0x16, 0x14, 0x11, 0x0E, 
-    0x0F, 0x14, 0x1A, 0x1C, 0x1B, 0x16, 0x10, 0x0C, 0x08, 0x06, 0x05, 0x05, 
-    0x04, 0x01, 0xFB, 0xF7, 0xF7, 0xF8, 0xF9, 0xF9, 0xFE, 0x04, 0x07, 0x06, 
-    0x00, 0xFC, 0xFA, 0xFE, 0x03, 0x05, 0x02, 0xFE, 0xFC, 0xFE, 0x00, 0x01, 
-    0x02, 0x04, 0x08, 0x0D, 0x10, 0x12, 0x13, 0x11, 0x0D, 0x0C, 0x11, 0x17, 
-    0x1A, 0x16, 0x12, 0x11, 0x13, 0x16, 0x18, 0x17, 0x15, 0x14, 0x13, 0x12, 
-    0x11, 0x10, 0x10, 0x13, 0x17, 0x17, 0x16, 0x15, 0x16, 0x17, 0x17, 0x19, 
-    0x1E, 0x22, 0x20, 0x19, 0x12, 0x11, 0x17, 0x20, 0x28, 0x2C, 0x2D, 0x2B, 
-    0x28, 0x24, 0x1D, 0x16, 0x12, 0x13, 0x15, 0x13, 0x12, 0x12, 0x13, 0x13, 
-    0x10, 0x0D, 0x11, 0x14, 0x13, 0x10, 0x0E, 0x11, 0x17, 0x1B, 0x1B, 0x1B, 
-    0x1A, 0x19, 0x17, 0x14, 0x13, 0x13, 0x14, 0x15, 0x14, 0x12, 0x0F, 0x0D, 
-    0x0B, 0x07, 0x02, 0x04, 0x09, 0x0D, 0x0C, 0x06, 0x01, 0x03, 0x08, 0x0E, 
-    0x13, 0x15, 0x14, 0x10, 0x0D, 0x0B, 0x0A, 0x09, 0x09, 0x08, 0x08, 0x07, 
-    0x06, 0x05, 0x02, 0xFF, 0xFF, 0x03, 0x07, 0x07, 0x01, 0xFA, 0xF6, 0xF9, 
-    0xFF, 0x05, 0x07, 0x06, 0x04, 0x03, 0x02, 0x01, 0xFF, 0xFC, 0xFA, 0xF7, 
-    0xF6, 0xF2, 0xF0, 0xEF, 0xF0, 0xF1, 0xF6, 0xFF, 0x05, 0x05, 0x00, 0xFA, 
-    0xFA, 0xFE, 0x06, 0x09, 0x0B, 0x0D, 0x0E, 0x0C, 0x07, 0x01, 0xFC, 0xFB, 
-    0xFD, 0x00, 0x01, 0x01, 0xFF, 0xFA, 0xF5, 0xF2, 0xF4, 0xFB, 0x00, 0xFF, 
-    0xFD, 0xFD, 0x01, 0x07, 0x0A, 0x08, 0x05, 0x01, 0xFD, 0xF9, 0xF5, 0xF1, 
-    0xEF, 0xF1, 0xF5, 0xF7, 0xF5, 0xF4, 0xF2, 0xF1, 0xF0, 0xF1, 0xF6, 0xFA, 
-    0xF8, 0xF2, 0xEB, 0xE7, 0xEA, 0xEE, 0xF1, 0xF3, 0xF2, 0xF2, 0xEF, 0xED, 
-    0xEB, 0xE9, 0xE8, 0xEB, 0xF0, 0xF3, 0xF5, 0xF5, 0xF6, 0xF5, 0xF4, 0xF4, 
-    0xFA, 0x00, 0x01, 0xFE, 0xF8, 0xF4, 0xF3, 0xF4, 0xF4, 0xF5, 0xF7, 0xF8, 
-    0xF8, 0xF7, 0xF7, 0xF5, 0xF6, 0xF7, 0xF8, 0xF8, 0xF7, 0xF6, 0xF5, 0xF3, 
-    0xF0, 0xF2, 0xF9, 0xFD, 0xFA, 0xF4, 0xEF, 0xF0, 0xF8, 0x01, 0x07, 0x0B, 
-    0x0D, 0x0C, 0x07, 0x00, 0xF9, 0xF4, 0xF5, 0xF8, 0xFA, 0xFA, 0xF8, 0xF7, 
-    0xF4, 0xF0, 0xEB, 0xEC, 0xF2, 0xF4, 0xF2, 0xEE, 0xEE, 0xF3, 0xF9, 0xFD, 
-    0x00, 0x03, 0x06, 0x07, 0x05, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x01, 
-    0x01, 0xFE, 0xF9, 0xF4, 0xF2, 0xF7, 0xFC, 0xFA, 0xF3, 0xEB, 0xE8, 0xEA, 
-    0xED, 0xEF, 0xF0, 0xF3, 0xF7, 0xF8, 0xF7, 0xF4, 0xF1, 0xF1, 0xF6, 0xFA, 
-    0xFD, 0xFB, 0xF8, 0xF4, 0xEF, 0xEC, 0xEE, 0xF5, 0xFD, 0xFE, 0xFA, 0xF5, 
-    0xF4, 0xF6, 0xF9, 0xFB, 0xFC, 0xFE, 0xFE, 0xFE, 0xFC, 0xFB, 0xF9, 0xF8, 
-    0xF9, 0xF7, 0xF6, 0xF5, 0xF5, 0xF6, 0xF4, 0xF3, 0xF8, 0x00, 0x04, 0x02, 
-    0xFC, 0xFA, 0xFC, 0x02, 0x06, 0x09, 0x0C, 0x0F, 0x0C, 0x05, 0xFB, 0xF2, 
-    0xEC, 0xEB, 0xEB, 0xEC, 0xEE, 0xEF, 0xEE, 0xEA, 0xE4, 0xE1, 0xE4, 0xEC, 
-    0xF2, 0xF1, 0xEE, 0xEC, 0xED, 0xEF, 0xF0, 0xF2, 0xF4, 0xF4, 0xF2, 0xEE, 
-    0xEA, 0xE8, 0xE7, 0xE8, 0xEA, 0xEB, 0xEC, 0xEB, 0xE8, 0xE5, 0xE2, 0xE3, 
-    0xEA, 0xED, 0xEC, 0xE7, 0xE3, 0xE5, 0xEA, 0xEE, 0xF0, 0xF1, 0xF2, 0xF0, 
-    0xEC, 0xE8, 0xE5, 0xE5, 0xE6, 0xEC, 0xF2, 0xF7, 0xF9, 0xF8, 0xF6, 0xF3, 
-    0xEF, 0xEF, 0xF3, 0xF6, 0xF4, 0xEE, 0xE9, 0xE7, 0xE8, 0xE9, 0xEA, 0xEF, 
-    0xF5, 0xFA, 0xFC, 0xFA, 0xF7, 0xF4, 0xF3, 0xF4, 0xF3, 0xF5, 0xF7, 0xFA, 
-    0xFB, 0xFC, 0xFD, 0x02, 0x09, 0x0D, 0x0B, 0x06, 0x04, 0x05, 0x0B, 0x12, 
-    0x18, 0x1E, 0x20, 0x1F, 0x1B, 0x17, 0x15, 0x15, 0x15, 0x15, 0x13, 0x11, 
-    0x0F, 0x0D, 0x09, 0x05, 0x02, 0x05, 0x0A, 0x0B, 0x09, 0x06, 0x07, 0x08, 
-    0x0C, 0x0F, 0x13, 0x16, 0x16, 0x13, 0x10, 0x0F, 0x0E, 0x0D, 0x0C, 0x0C, 
-    0x0D, 0x0D, 0x0C, 0x0B, 0x06, 0x01, 0xFD, 0xFE, 0x00, 0x00, 0xFF, 0xFD, 
-    0xFD, 0xFF, 0x04, 0x08, 0x0B, 0x0B, 0x0A, 0x08, 0x06, 0x04, 0x03, 0x04, 
-    0x09, 0x0F, 0x13, 0x14, 0x12, 0x0D, 0x09, 0x08, 0x0D, 0x14, 0x18, 0x18, 
-    0x16, 0x14, 0x16, 0x18, 0x19, 0x1C, 0x1F, 0x21, 0x21, 0x20, 0x1D, 0x1A, 
-    0x16, 0x14, 0x12, 0x12, 0x11, 0x10, 0x0F, 0x0F, 0x0E, 0x0F, 0x15, 0x1C, 
-    0x20, 0x20, 0x1F, 0x20, 0x25, 0x29, 0x2A, 0x2B, 0x2B, 0x2A, 0x24, 0x1E, 
-    0x18, 0x13, 0x10, 0x11, 0x12, 0x15, 0x16, 0x15, 0x11, 0x0B, 0x05, 0x04, 
-    0x09, 0x0E, 0x11, 0x10, 0x0F, 0x0D, 0x0B, 0x07, 0x03, 0x05, 0x09, 0x0B, 
-    0x08, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x06, 0x09, 0x0B, 0x0B, 0x07, 0x01, 
-    0xFC, 0xF9, 0xFB, 0xFC, 0xFA, 0xF5, 0xF0, 0xED, 0xEE, 0xEF, 0xF0, 0xF2, 
-    0xF7, 0xFB, 0xFD, 0xFB, 0xFA, 0xFB, 0xFC, 0x00, 0x04, 0x05, 0x04, 0x01, 
-    0xFC, 0xF8, 0xF6, 0xF9, 0xFF, 0x02, 0x00, 0xFA, 0xF4, 0xF1, 0xEF, 0xEE, 
-    0xF0, 0xF5, 0xFC, 0x02, 0x05, 0x03, 0xFF, 0xFA, 0xF7, 0xF7, 0xFA, 0xFD, 
-    0x00, 0xFE, 0xFA, 0xF6, 0xF4, 0xF5, 0xF9, 0xFC, 0xFC, 0xF9, 0xF7, 0xF9, 
-    0xFD, 0x01, 0x06, 0x09, 0x0A, 0x0B, 0x07, 0x00, 0xF9, 0xF6, 0xF7, 0xFA, 
-    0xFE, 0xFF, 0xFC, 0xF7, 0xF1, 0xEC, 0xEB, 0xF0, 0xF7, 0xFA, 0xF9, 0xF7, 
-    0xF6, 0xF5, 0xF5, 0xF6, 0xFA, 0x00, 0x03, 0x03, 0x00, 0xFA, 0xF6, 0xF4, 
-    0xF4, 0xF7, 0xFA, 0xFC, 0xFB, 0xF9, 0xF5, 0xF1, 0xF0, 0xF3, 0xF5, 0xF4, 
-    0xF1, 0xEF, 0xF0, 0xEE, 0xEB, 0xE9, 0xE8, 0xE8, 0xE8, 0xE5, 0xE0, 0xDB, 
-    0xDB, 0xDE, 0xE2, 0xE7, 0xED, 0xEF, 0xED, 0xE9, 0xE3, 0xE2, 0xE7, 0xF1, 
-    0xF6, 0xF6, 0xF2, 0xEF, 0xEF, 0xEE, 0xED, 0xEF, 0xF4, 0xF8, 0xF9, 0xF7, 
-    0xF2, 0xEC, 0xE8, 0xE8, 0xEA, 0xED, 0xEF, 0xF0, 0xEF, 0xEC, 0xEA, 0xE7, 
-    0xE9, 0xEF, 0xF2, 0xF2, 0xF0, 0xF0, 0xF6, 0xFF, 0x07, 0x10, 0x16, 0x1B, 
-    0x1D, 0x1C, 0x19, 0x15, 0x11, 0x0F, 0x0E, 0x0C, 0x08, 0x03, 0x00, 0xFC, 
-    0xFA, 0xFA, 0xFF, 0x04, 0x04, 0xFF, 0xF7, 0xF1, 0xED, 0xEA, 0xEB, 0xF1, 
-    0xF7, 0xFC, 0xFD, 0xFD, 0xFC, 0xFD, 0x00, 0x06, 0x0F, 0x16, 0x1B, 0x1D, 
-    0x1C, 0x18, 0x12, 0x10, 0x0F, 0x0D, 0x07, 0xFF, 0xFA, 0xF9, 0xFA, 0xFB, 
-    0xFD, 0x00, 0x01, 0x00, 0xFD, 0xFA, 0xFA, 0xFD, 0x02, 0x08, 0x0E, 0x12, 
-    0x12, 0x10, 0x0C, 0x09, 0x09, 0x0E, 0x14, 0x17, 0x13, 0x0D, 0x09, 0x08, 
-    0x09, 0x09, 0x0D, 0x13, 0x17, 0x18, 0x16, 0x15, 0x14, 0x15, 0x16, 0x19, 
-    0x1D, 0x20, 0x1F, 0x1A, 0x11, 0x08, 0x02, 0x01, 0x02, 0x01, 0xFD, 0xFA, 
-    0xFC, 0x01, 0x08, 0x0F, 0x16, 0x1C, 0x20, 0x21, 0x1D, 0x18, 0x13, 0x11, 
-    0x10, 0x0C, 0x06, 0x01, 0xFC, 0xF7, 0xF3, 0xF0, 0xF3, 0xFA, 0x01, 0x04, 
-    0x02, 0xFF, 0xFF, 0x00, 0x03, 0x06, 0x09, 0x0B, 0x0A, 0x08, 0x04, 0x00, 
-    0xFE, 0x00, 0x03, 0x06, 0x09, 0x09, 0x08, 0x04, 0xFF, 0xFB, 0xFB, 0xFC, 
-    0xFB, 0xF7, 0xF3, 0xF2, 0xF5, 0xFA, 0xFE, 0x01, 0x03, 0x01, 0xFF, 0xFA, 
-    0xF4, 0xF0, 0xF0, 0xF4, 0xF9, 0xFD, 0xFC, 0xF8, 0xF3, 0xED, 0xE8, 0xE8, 
-    0xF0, 0xFA, 0xFF, 0xFE, 0xF9, 0xF5, 0xF1, 0xF0, 0xF2, 0xF6, 0xF8, 0xF8, 
-    0xF5, 0xF2, 0xEF, 0xED, 0xEE, 0xF2, 0xF7, 0xFB, 0xFD, 0xFC, 0xF8, 0xF2, 
-    0xEE, 0xEF, 0xF6, 0xFF, 0x02, 0x00, 0xFA, 0xF8, 0xFA, 0xFC, 0xFF, 0x03, 
-    0x06, 0x08, 0x08, 0x06, 0x03, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFB, 
-    0xF6, 0xF0, 0xEA, 0xE9, 0xEB, 0xED, 0xEA, 0xE4, 0xE0, 0xDE, 0xDD, 0xDC, 
-    0xDE, 0xE0, 0xE3, 0xE2, 0xDF, 0xDB, 0xDA, 0xDD, 0xE4, 0xED, 0xF7, 0xFF, 
-    0x02, 0x02, 0xFD, 0xF8, 0xF3, 0xF3, 0xF5, 0xF4, 0xEE, 0xE5, 0xDF, 0xDC, 
-    0xDC, 0xDD, 0xE0, 0xE3, 0xE4, 0xE3, 0xE2, 0xE1, 0xE1, 0xE3, 0xE6, 0xE9, 
-    0xEA, 0xEA, 0xE7, 0xE3, 0xDF, 0xE0, 0xE6, 0xF2, 0x00, 0x09, 0x0E, 0x10, 
-    0x12, 0x13, 0x15, 0x16, 0x17, 0x18, 0x18, 0x16, 0x11, 0x0B, 0x06, 0x03, 
-    0x01, 0xFF, 0xFE, 0xFF, 0xFD, 0xFA, 0xF5, 0xF2, 0xF3, 0xFA, 0x00, 0x03, 
-    0x03, 0x02, 0x03, 0x03, 0x06, 0x0B, 0x13, 0x1C, 0x22, 0x25, 0x24, 0x23, 
-    0x20, 0x1D, 0x19, 0x16, 0x13, 0x0E, 0x07, 0xFF, 0xF9, 0xF8, 0xFB, 0x00, 
-    0x00, 0xFC, 0xFA, 0xFB, 0xFD, 0xFE, 0x00, 0x04, 0x09, 0x0B, 0x0A, 0x07, 
-    0x05, 0x06, 0x0C, 0x12, 0x19, 0x1E, 0x22, 0x22, 0x1E, 0x18, 0x12, 0x11, 
-    0x15, 0x16, 0x13, 0x0E, 0x08, 0x05, 0x02, 0x00, 0x00, 0x04, 0x0A, 0x0F, 
-    0x11, 0x12, 0x10, 0x0D, 0x0B, 0x08, 0x07, 0x07, 0x05, 0xFF, 0xF7, 0xEF, 
-    0xEC, 0xF0, 0xFA, 0x04, 0x0A, 0x0C, 0x0C, 0x0D, 0x0C, 0x0E, 0x0F, 0x0F, 
-    0x0F, 0x0C, 0x06, 0xFC, 0xF3, 0xEE, 0xF0, 0xF8, 0x01, 0x08, 0x0B, 0x0D, 
-    0x0A, 0x05, 0x01, 0x02, 0x08, 0x0E, 0x10, 0x0F, 0x0D, 0x0E, 0x0F, 0x10, 
-    0x13, 0x15, 0x17, 0x16, 0x15, 0x11, 0x0E, 0x0C, 0x0B, 0x0B, 0x0C, 0x0A, 
-    0x07, 0x02, 0xFB, 0xF6, 0xF3, 0xF4, 0xF9, 0xFD, 0xFB, 0xF9, 0xF7, 0xF4, 
-    0xF2, 0xF3, 0xF7, 0xFA, 0xFC, 0xFB, 0xF8, 0xF5, 0xF5, 0xF7, 0xFB, 0x02, 
-    0x08, 0x0B, 0x09, 0x03, 0xFC, 0xF7, 0xF7, 0xFA, 0xFC, 0xF9, 0xF1, 0xE9, 
-    0xE3, 0xDF, 0xDC, 0xE0, 0xE8, 0xEF, 0xF2, 0xF0, 0xED, 0xEB, 0xED, 0xEF, 
-    0xF1, 0xF4, 0xF7, 0xF7, 0xF5, 0xF1, 0xED, 0xEC, 0xF0, 0xF7, 0xFB, 0xFB, 
-    0xF8, 0xF4, 0xF4, 0xF6, 0xFA, 0x01, 0x07, 0x0A, 0x08, 0x02, 0xFC, 0xF9, 
-    0xF8, 0xF9, 0xFB, 0xFD, 0xFC, 0xF9, 0xF4, 0xEC, 0xE5, 0xE2, 0xE6, 0xEB, 
-    0xEF, 0xEE, 0xE9, 0xE5, 0xE2, 0xE4, 0xE9, 0xF2, 0xFD, 0x05, 0x08, 0x07, 
-    0x05, 0x04, 0x06, 0x07, 0x07, 0x05, 0xFE, 0xF4, 0xE8, 0xDE, 0xDA, 0xD9, 
-    0xE0, 0xE9, 0xEF, 0xEF, 0xEC, 0xE8, 0xE4, 0xE3, 0xE6, 0xEA, 0xEF, 0xEF, 
-    0xEE, 0xEB, 0xEB, 0xEE, 0xF4, 0xFC, 0x03, 0x08, 0x0A, 0x0A, 0x07, 0x05, 
-    0x07, 0x0C, 0x13, 0x18, 0x19, 0x13, 0x0A, 0x00, 0xF9, 0xF6, 0xF8, 0xFC, 
-    0xFD, 0xFA, 0xF6, 0xF1, 0xED, 0xEA, 0xEB, 0xEF, 0xF6, 0xFC, 0xFE, 0xFC, 
-    0xF7, 0xF3, 0xF3, 0xF9, 0x03, 0x0B, 0x0E, 0x0D, 0x0A, 0x08, 0x08, 0x0A, 
-    0x0D, 0x10, 0x0F, 0x0B, 0x04, 0xFD, 0xF9, 0xFA, 0xFF, 0x05, 0x0C, 0x10, 
-    0x0D, 0x07, 0x00, 0xFD, 0xFE, 0x04, 0x0E, 0x14, 0x15, 0x14, 0x13, 0x12, 
-    0x16, 0x1E, 0x27, 0x2D, 0x2E, 0x2B, 0x26, 0x21, 0x1D, 0x1B, 0x1D, 0x20, 
-    0x21, 0x1D, 0x16, 0x0C, 0x01, 0xFA, 0xF9, 0x00, 0x06, 0x0B, 0x0B, 0x09, 
-    0x08, 0x08, 0x0B, 0x11, 0x18, 0x1C, 0x1A, 0x12, 0x09, 0x02, 0xFF, 0xFF, 
-    0x03, 0x08, 0x0E, 0x10, 0x0E, 0x08, 0x02, 0x00, 0x03, 0x08, 0x08, 0x03, 
-    0xF8, 0xEE, 0xE6, 0xE4, 0xEA, 0xF4, 0xFE, 0x02, 0xFF, 0xF8, 0xF1, 0xEC, 
-    0xEC, 0xF0, 0xF6, 0xFE, 0x03, 0x02, 0xFF, 0xFC, 0xFB, 0xFD, 0x03, 0x0B, 
-    0x0F, 0x0C, 0x06, 0xFE, 0xFA, 0xFB, 0xFF, 0x06, 0x09, 0x08, 0x01, 0xFA, 
-    0xF6, 0xF5, 0xF7, 0xFC, 0x01, 0x05, 0x06, 0x03, 0xFC, 0xF4, 0xF0, 0xF1, 
-    0xFB, 0x05, 0x08, 0x04, 0xFF, 0xFA, 0xFA, 0xFF, 0x05, 0x0D, 0x11, 0x10, 
-    0x0A, 0x01, 0xFA, 0xF9, 0xFB, 0xFF, 0x03, 0x01, 0xFC, 0xF2, 0xE7, 0xDF, 
-    0xDD, 0xE2, 0xED, 0xF6, 0xF7, 0xF2, 0xEC, 0xE8, 0xE8, 0xED, 0xF5, 0xFD, 
-    0x01, 0x01, 0xFC, 0xF8, 0xF8, 0xFE, 0x04, 0x08, 0x0B, 0x08, 0x02, 0xF9, 
-    0xF1, 0xED, 0xED, 0xF5, 0xFF, 0x04, 0x03, 0xFD, 0xF6, 0xF1, 0xEF, 0xF3, 
-    0xF9, 0xFD, 0xFA, 0xF1, 0xE8, 0xE2, 0xE0, 0xE2, 0xE5, 0xE9, 0xEC, 0xEA, 
-    0xE4, 0xDB, 0xD0, 0xCA, 0xCB, 0xD5, 0xE1, 0xE8, 0xE9, 0xE5, 0xE1, 0xE2, 
-    0xE8, 0xF0, 0xF6, 0xF8, 0xF5, 0xED, 0xE3, 0xDD, 0xDE, 0xE4, 0xEE, 0xF6, 
-    0xFA, 0xFA, 0xF5, 0xEE, 0xE7, 0xE2, 0xE7, 0xF2, 0xFB, 0xFE, 0xF9, 0xF5, 
-    0xF3, 0xF9, 0x02, 0x0C, 0x13, 0x15, 0x13, 0x0C, 0x05, 0x02, 0x04, 0x0B, 
-    0x14, 0x1B, 0x1D, 0x1B, 0x15, 0x0F, 0x09, 0x08, 0x0B, 0x11, 0x13, 0x0F, 
-    0x04, 0xF8, 0xEF, 0xEE, 0xF2, 0xF9, 0xFF, 0x01, 0xFF, 0xFC, 0xFA, 0xFA, 
-    0xFF, 0x05, 0x0C, 0x12, 0x16, 0x15, 0x10, 0x09, 0x05, 0x06, 0x0C, 0x12, 
-    0x12, 0x0A, 0xFF, 0xF3, 0xED, 0xEF, 0xF7, 0x01, 0x05, 0x04, 0xFC, 0xF3, 
-    0xEC, 0xEA, 0xEC, 0xF3, 0xFB, 0x03, 0x07, 0x08, 0x06, 0x04, 0x06, 0x0C, 
-    0x14, 0x1B, 0x1A, 0x13, 0x0A, 0x04, 0x05, 0x0C, 0x17, 0x1F, 0x23, 0x22, 
-    0x1B, 0x15, 0x10, 0x0F, 0x11, 0x14, 0x18, 0x1B, 0x18, 0x13, 0x0D, 0x0B, 
-    0x0E, 0x15, 0x1F, 0x25, 0x22, 0x19, 0x11, 0x0B, 0x0A, 0x0D, 0x12, 0x16, 
-    0x15, 0x11, 0x0B, 0x06, 0x02, 0x01, 0x02, 0x05, 0x07, 0x05, 0xFD, 0xF4, 
-    0xEB, 0xE7, 0xEB, 0xF5, 0x03, 0x0B, 0x09, 0x01, 0xF7, 0xF2, 0xF3, 0xF9, 
-    0x01, 0x07, 0x09, 0x07, 0x05, 0x04, 0x07, 0x0C, 0x12, 0x19, 0x1D, 0x1A, 
-    0x11, 0x07, 0x00, 0xFF, 0x02, 0x08, 0x0C, 0x0B, 0x05, 0xFC, 0xF5, 0xF4, 
-    0xF9, 0x00, 0x06, 0x08, 0x05, 0xFB, 0xF0, 0xEA, 0xEA, 0xF0, 0xF6, 0xFC, 
-    0xFF, 0xFD, 0xF6, 0xEE, 0xE8, 0xE8, 0xEC, 0xF4, 0xFB, 0xFA, 0xF4, 0xEC, 
-    0xE8, 0xE9, 0xF0, 0xF5, 0xF9, 0xF9, 0xF6, 0xF0, 0xEA, 0xE7, 0xE9, 0xEF, 
-    0xF9, 0x02, 0x06, 0x03, 0xFA, 0xF2, 0xED, 0xF0, 0xF6, 0x01, 0x09, 0x0A, 
-    0x06, 0x00, 0xFF, 0x05, 0x0E, 0x17, 0x19, 0x14, 0x0B, 0x02, 0xFC, 0xFA, 
-    0xFE, 0x06, 0x0E, 0x12, 0x10, 0x07, 0xFF, 0xF8, 0xF6, 0xF9, 0x00, 0x06, 
-    0x07, 0x00, 0xF4, 0xE8, 0xE4, 0xE8, 0xF0, 0xF8, 0xFA, 0xF8, 0xF2, 0xEA, 
-    0xE0, 0xDA, 0xD9, 0xDF, 0xE6, 0xEA, 0xE9, 0xE5, 0xE3, 0xE3, 0xE5, 0xEA, 
-    0xF1, 0xF5, 0xF3, 0xEB, 0xE1, 0xD9, 0xD7, 0xDC, 0xE3, 0xEB, 0xEF, 0xEF, 
-    0xE9, 0xE2, 0xDE, 0xDF, 0xE3, 0xEA, 0xF0, 0xF0, 0xEB, 0xE2, 0xDB, 0xD6, 
-    0xD8, 0xE0, 0xED, 0xF7, 0xF8, 0xF2, 0xEC, 0xEA, 0xF1, 0xFC, 0x09, 0x15, 
-    0x18, 0x15, 0x0E, 0x0A, 0x0B, 0x0F, 0x16, 0x1E, 0x24, 0x24, 0x1D, 0x14, 
-    0x0A, 0x04, 0x01, 0x03, 0x08, 0x0B, 0x09, 0x01, 0xF8, 0xF4, 0xF7, 0x00, 
-    0x0A, 0x11, 0x12, 0x0E, 0x0A, 0x09, 0x0A, 0x0C, 0x0F, 0x13, 0x15, 0x11, 
-    0x08, 0xFF, 0xF9, 0xF8, 0xFC, 0x04, 0x0D, 0x0F, 0x09, 0xFC, 0xF2, 0xF1, 
-    0xF6, 0xFF, 0x08, 0x0F, 0x12, 0x10, 0x0B, 0x09, 0x0A, 0x0F, 0x17, 0x1F, 
-    0x23, 0x1F, 0x16, 0x0D, 0x08, 0x09, 0x0F, 0x1A, 0x23, 0x25, 0x1D, 0x11, 
-    0x0A, 0x0A, 0x0F, 0x13, 0x15, 0x13, 0x0F, 0x08, 0x01, 0xFE, 0x00, 0x07, 
-    0x0F, 0x12, 0x11, 0x0B, 0x02, 0xFA, 0xF4, 0xF2, 0xF4, 0xFB, 0x01, 0x01, 
-    0xFA, 0xF2, 0xF0, 0xF5, 0xFE, 0x06, 0x0A, 0x06, 0xFE, 0xF4, 0xEB, 0xE6, 
-    0xE8, 0xF0, 0xFA, 0x01, 0x02, 0xFF, 0xFA, 0xF7, 0xF8, 0xFE, 0x07, 0x11, 
-    0x18, 0x18, 0x12, 0x0A, 0x08, 0x0D, 0x17, 0x22, 0x2A, 0x2A, 0x24, 0x1C, 
-    0x14, 0x12, 0x14, 0x18, 0x1A, 0x17, 0x10, 0x07, 0xFD, 0xF7, 0xF6, 0xFD, 
-    0x08, 0x10, 0x11, 0x0A, 0x01, 0xF9, 0xF9, 0xFF, 0x08, 0x0D, 0x0C, 0x06, 
-    0xFC, 0xF5, 0xF2, 0xF3, 0xF9, 0xFF, 0x05, 0x06, 0x03, 0xFC, 0xF3, 0xEC, 
-    0xEB, 0xEF, 0xF6, 0xFB, 0xF7, 0xEB, 0xE0, 0xDA, 0xDC, 0xE3, 0xEC, 0xF1, 
-    0xF1, 0xEC, 0xE6, 0xE1, 0xDF, 0xE2, 0xE9, 0xF3, 0xFA, 0xFC, 0xFA, 0xF5, 
-    0xEF, 0xEC, 0xF0, 0xF8, 0x01, 0x04, 0xFF, 0xF5, 0xED, 0xEB, 0xF0, 0xF9, 
-    0x02, 0x08, 0x09, 0x04, 0xFD, 0xF7, 0xF4, 0xF9, 0x02, 0x0A, 0x0D, 0x08, 
-    0xFE, 0xF5, 0xEF, 0xEF, 0xF5, 0xFF, 0x06, 0x05, 0xFE, 0xF2, 0xE9, 0xE5, 
-    0xE8, 0xEE, 0xF4, 0xF8, 0xF6, 0xF0, 0xEB, 0xE8, 0xE9, 0xEE, 0xF3, 0xF8, 
-    0xF8, 0xF2, 0xE8, 0xE0, 0xDB, 0xDB, 0xE0, 0xE8, 0xEE, 0xEF, 0xE9, 0xE3, 
-    0xE0, 0xE4, 0xEE, 0xFB, 0x05, 0x07, 0x03, 0xFB, 0xF3, 0xF0, 0xF0, 0xF6, 
-    0xFF, 0x06, 0x09, 0x06, 0x00, 0xFD, 0xFB, 0xFF, 0x07, 0x11, 0x17, 0x14, 
-    0x0C, 0x03, 0xFF, 0x02, 0x0A, 0x15, 0x1D, 0x1E, 0x18, 0x0E, 0x06, 0x03, 
-    0x03, 0x08, 0x0C, 0x0C, 0x06, 0xFC, 0xF3, 0xEB, 0xE8, 0xEA, 0xF3, 0xFA, 
-    0xFB, 0xF6, 0xEF, 0xEA, 0xEB, 0xF1, 0xF8, 0xFF, 0x02, 0x02, 0xFD, 0xF6, 
-    0xF2, 0xF4, 0xFB, 0x03, 0x09, 0x0A, 0x06, 0x00, 0xFB, 0xF7, 0xF8, 0x00, 
-    0x0D, 0x1A, 0x1F, 0x1C, 0x15, 0x10, 0x11, 0x18, 0x21, 0x2A, 0x2F, 0x2F, 
-    0x28, 0x20, 0x1D, 0x1D, 0x20, 0x25, 0x27, 0x25, 0x21, 0x19, 0x10, 0x0A, 
-    0x0A, 0x0F, 0x16, 0x1A, 0x15, 0x0A, 0x01, 0xFE, 0x03, 0x0B, 0x15, 0x1D, 
-    0x1F, 0x1C, 0x14, 0x0C, 0x08, 0x09, 0x10, 0x17, 0x19, 0x16, 0x0E, 0x05, 
-    0x00, 0xFF, 0x03, 0x0A, 0x10, 0x10, 0x09, 0xFF, 0xF5, 0xEE, 0xED, 0xEE, 
-    0xF2, 0xF4, 0xF2, 0xED, 0xE8, 0xE6, 0xE9, 0xF1, 0xFC, 0x07, 0x0D, 0x0C, 
-    0x06, 0xFF, 0xF9, 0xF8, 0xFB, 0x02, 0x09, 0x0D, 0x0D, 0x09, 0x05, 0x05, 
-    0x0B, 0x12, 0x1A, 0x1A, 0x13, 0x08, 0xFE, 0xF9, 0xFA, 0x00, 0x08, 0x0E, 
-    0x0E, 0x09, 0x02, 0xFD, 0xFC, 0xFF, 0x04, 0x0B, 0x0F, 0x0E, 0x06, 0xFE, 
-    0xF8, 0xF9, 0xFF, 0x06, 0x0F, 0x12, 0x0F, 0x06, 0xFE, 0xFB, 0xFD, 0x00, 
-    0x04, 0x04, 0x02, 0xFD, 0xF6, 0xF0, 0xEC, 0xEC, 0xF1, 0xF6, 0xF7, 0xF1, 
-    0xE8, 0xE3, 0xE3, 0xEA, 0xF3, 0xFD, 0x04, 0x07, 0x04, 0xFF, 0xFC, 0xFB, 
-    0xFF, 0x05, 0x09, 0x0C, 0x08, 0x02, 0xFC, 0xF8, 0xF8, 0xFB, 0x02, 0x07, 
-    0x08, 0x03, 0xFB, 0xF4, 0xF1, 0xF4, 0xFB, 0x02, 0x06, 0x03, 0xFA, 0xF2, 
-    0xED, 0xEF, 0xF4, 0xFA, 0xFE, 0xFE, 0xF9, 0xF1, 0xE7, 0xE1, 0xDF, 0xDF, 
-    0xDF, 0xE0, 0xDE, 0xD7, 0xD1, 0xCD, 0xCF, 0xD6, 0xDE, 0xE6, 0xEA, 0xE9, 
-    0xE5, 0xE0, 0xDE, 0xE1, 0xE6, 0xEB, 0xED, 0xED, 0xE8, 0xE3, 0xE2, 0xE5, 
-    0xEC, 0xF6, 0x00, 0x06, 0x06, 0x00, 0xFA, 0xF6, 0xF6, 0xFB, 0x02, 0x09, 
-    0x0D, 0x0A, 0x04, 0x00, 0x00, 0x04, 0x0A, 0x0F, 0x0F, 0x0D, 0x07, 0x00, 
-    0xFB, 0xFB, 0xFD, 0x02, 0x08, 0x0C, 0x0D, 0x08, 0x03, 0x00, 0x05, 0x0D, 
-    0x13, 0x16, 0x12, 0x0B, 0x04, 0x01, 0x01, 0x05, 0x09, 0x0C, 0x0C, 0x07, 
-    0x00, 0xF9, 0xF6, 0xF8, 0xFC, 0x00, 0x03, 0x02, 0xFC, 0xF8, 0xF4, 0xF4, 
-    0xF8, 0xFF, 0x04, 0x06, 0x01, 0xF9, 0xF1, 0xEE, 0xEF, 0xF3, 0xF8, 0xFC, 
-    0xFF, 0x00, 0xFF, 0xFC, 0xFA, 0xFB, 0x00, 0x07, 0x0E, 0x11, 0x0D, 0x09, 
-    0x05, 0x06, 0x0D, 0x15, 0x1B, 0x1C, 0x18, 0x13, 0x0F, 0x11, 0x16, 0x1D, 
-    0x21, 0x21, 0x1D, 0x17, 0x0F, 0x07, 0x07, 0x0C, 0x13, 0x18, 0x19, 0x16, 
-    0x11, 0x10, 0x10, 0x13, 0x18, 0x1D, 0x20, 0x1D, 0x15, 0x0C, 0x06, 0x05, 
-    0x08, 0x0E, 0x13, 0x14, 0x12, 0x0D, 0x08, 0x03, 0xFF, 0xFC, 0xFC, 0xFC, 
-    0xFA, 0xF4, 0xEE, 0xEC, 0xEE, 0xF4, 0xFB, 0x00, 0x04, 0x03, 0x00, 0xFB, 
-    0xF9, 0xFB, 0xFF, 0x04, 0x08, 0x09, 0x08, 0x07, 0x05, 0x05, 0x08, 0x0B, 
-    0x12, 0x15, 0x11, 0x08, 0xFE, 0xF9, 0xFB, 0x02, 0x0C, 0x12, 0x13, 0x0D, 
-    0x04, 0xFD, 0xF9, 0xF9, 0xFB, 0xFE, 0xFC, 0xF8, 0xF1, 0xEE, 0xEC, 0xED, 
-    0xED, 0xEF, 0xF4, 0xF5, 0xF3, 0xED, 0xE8, 0xE7, 0xEA, 0xEF, 0xF3, 0xF4, 
-    0xF2, 0xEE, 0xEC, 0xEC, 0xEF, 0xF5, 0xFB, 0x00, 0x02, 0x00, 0xFB, 0xF7, 
-    0xF4, 0xF4, 0xF7, 0xFD, 0x01, 0x01, 0xFE, 0xFB, 0xFB, 0xFE, 0x05, 0x0E, 
-    0x15, 0x17, 0x13, 0x0C, 0x03, 0xFE, 0xFD, 0xFF, 0x02, 0x05, 0x05, 0x03, 
-    0xFF, 0xFB, 0xFB, 0xFD, 0x01, 0x06, 0x07, 0x04, 0xFD, 0xF7, 0xF5, 0xF5, 
-    0xF8, 0xFB, 0xFF, 0x00, 0xFD, 0xFA, 0xF7, 0xF6, 0xF8, 0xFB, 0xFD, 0xFB, 
-    0xF3, 0xE9, 0xE2, 0xDE, 0xE0, 0xE3, 0xE7, 0xEA, 0xEC, 0xEB, 0xE6, 0xE1, 
-    0xDF, 0xE1, 0xE6, 0xEB, 0xED, 0xEA, 0xE5, 0xDD, 0xD9, 0xD8, 0xDD, 0xE3, 
-    0xE8, 0xE8, 0xE5, 0xE2, 0xE1, 0xE2, 0xE2, 0xE2, 0xE6, 0xED, 0xF1, 0xF1, 
-    0xED, 0xEC, 0xEF, 0xF5, 0xFB, 0xFF, 0x01, 0x00, 0xFD, 0xF9, 0xF9, 0xFE, 
-    0x05, 0x0D, 0x12, 0x13, 0x14, 0x13, 0x14, 0x16, 0x16, 0x15, 0x16, 0x17, 
-    0x14, 0x0E, 0x07, 0x04, 0x04, 0x08, 0x10, 0x17, 0x19, 0x16, 0x0F, 0x0A, 
-    0x08, 0x0A, 0x0E, 0x13, 0x14, 0x13, 0x0E, 0x0A, 0x05, 0x03, 0x04, 0x07, 
-    0x0B, 0x0B, 0x07, 0x01, 0xFC, 0xFB, 0xFD, 0xFF, 0x02, 0x04, 0x02, 0xFF, 
-    0xFD, 0xFD, 0xFF, 0x01, 0x05, 0x0B, 0x11, 0x14, 0x15, 0x13, 0x12, 0x11, 
-    0x12, 0x15, 0x16, 0x14, 0x10, 0x0B, 0x09, 0x0C, 0x10, 0x15, 0x19, 0x1B, 
-    0x18, 0x12, 0x08, 0x00, 0xF9, 0xF4, 0xF0, 0xED, 0xEA, 0xE4, 0xDF, 0xDC, 
-    0xDC, 0xE0, 0xE6, 0xEF, 0xF7, 0xFB, 0xF9, 0xF5, 0xF5, 0xF7, 0xFC, 0x04, 
-    0x0B, 0x0E, 0x0C, 0x07, 0x02, 0xFF, 0xFE, 0xFF, 0x03, 0x07, 0x08, 0x08, 
-    0x07, 0x08, 0x09, 0x0A, 0x09, 0x08, 0x08, 0x05, 0xFF, 0xF9, 0xF8, 0xFA, 
-    0xFE, 0x04, 0x0A, 0x0E, 0x0D, 0x0A, 0x07, 0x07, 0x0A, 0x0D, 0x0E, 0x0F, 
-    0x0F, 0x0D, 0x0A, 0x04, 0xFE, 0xFB, 0xFA, 0xFC, 0xFD, 0xFB, 0xF9, 0xF6, 
-    0xF6, 0xFB, 0x02, 0x07, 0x09, 0x09, 0x06, 0x00, 0xFB, 0xF6, 0xF5, 0xF8, 
-    0xFD, 0xFF, 0xFE, 0xFA, 0xF8, 0xF7, 0xF6, 0xF7, 0xFB, 0xFF, 0xFF, 0xFA, 
-    0xF3, 0xF0, 0xF1, 0xF2, 0xF4, 0xF5, 0xF4, 0xF1, 0xED, 0xE8, 0xE4, 0xE3, 
-    0xE3, 0xE5, 0xE6, 0xE8, 0xE7, 0xE5, 0xE4, 0xE4, 0xE7, 0xEC, 0xF3, 0xF8, 
-    0xFA, 0xF7, 0xF1, 0xED, 0xEE, 0xF2, 0xF9, 0xFE, 0x01, 0x03, 0x02, 0x00, 
-    0xFC, 0xF9, 0xF9, 0xFC, 0x00, 0x03, 0x04, 0x03, 0x00, 0xFE, 0xFD, 0xFD, 
-    0xFD, 0xFC, 0xFB, 0xF9, 0xF9, 0xFB, 0xFE, 0x02, 0x04, 0x05, 0x04, 0xFF, 
-    0xF7, 0xEE, 0xEA, 0xED, 0xF6, 0xFF, 0x05, 0x04, 0x01, 0xFF, 0xFB, 0xFA, 
-    0xF8, 0xF9, 0xF9, 0xF7, 0xF1, 0xEB, 0xE7, 0xE8, 0xEE, 0xF5, 0xFC, 0x02, 
-    0x05, 0x03, 0xFE, 0xF8, 0xF3, 0xF0, 0xF1, 0xF5, 0xF9, 0xFA, 0xFB, 0xFA, 
-    0xF9, 0xFA, 0xFD, 0x02, 0x05, 0x06, 0x04, 0x01, 0xFE, 0xFC, 0xFC, 0xFE, 
-    0x01, 0xFF, 0xFA, 0xF4, 0xF0, 0xF0, 0xF3, 0xF7, 0xF9, 0xFB, 0xFA, 0xF6, 
-    0xF1, 0xEA, 0xE4, 0xDF, 0xE1, 0xE9, 0xF0, 0xF3, 0xF0, 0xEA, 0xEA, 0xEF, 
-    0xF4, 0xFA, 0xFF, 0x02, 0x02, 0xFF, 0xFC, 0xF9, 0xF9, 0xFD, 0x03, 0x06, 
-    0x06, 0x04, 0x01, 0x01, 0x02, 0x03, 0x04, 0x06, 0x05, 0x00, 0xF7, 0xEE, 
-    0xEB, 0xED, 0xF2, 0xF7, 0xFC, 0xFE, 0xFD, 0xF9, 0xF5, 0xF3, 0xF5, 0xFA, 
-    0x00, 0x03, 0x05, 0x03, 0xFF, 0xFB, 0xF5, 0xF2, 0xF1, 0xF2, 0xF0, 0xEC, 
-    0xE6, 0xE3, 0xE6, 0xEC, 0xF3, 0xF8, 0xFC, 0xFC, 0xF9, 0xF2, 0xE9, 0xE5, 
-    0xE5, 0xE9, 0xEC, 0xED, 0xEC, 0xEA, 0xE7, 0xE6, 0xE7, 0xEC, 0xF2, 0xF9, 
-    0xFD, 0xFB, 0xF7, 0xF3, 0xF3, 0xF4, 0xF7, 0xF7, 0xF4, 0xED, 0xE5, 0xDD, 
-    0xD8, 0xD8, 0xDC, 0xE2, 0xE6, 0xE6, 0xE3, 0xDE, 0xDA, 0xD9, 0xD9, 0xDC, 
-    0xE1, 0xE7, 0xE7, 0xE4, 0xE0, 0xE0, 0xE7, 0xF1, 0xFD, 0x09, 0x12, 0x18, 
-    0x1A, 0x18, 0x17, 0x15, 0x16, 0x17, 0x16, 0x14, 0x11, 0x0F, 0x0A, 0x08, 
-    0x09, 0x0F, 0x14, 0x16, 0x12, 0x0A, 0x04, 0x01, 0x03, 0x06, 0x0A, 0x0F, 
-    0x11, 0x11, 0x0F, 0x0C, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x0F, 0x0B, 0x05, 
-    0x00, 0x00, 0x04, 0x0A, 0x0E, 0x0C, 0x07, 0x02, 0x02, 0x06, 0x0B, 0x10, 
-    0x15, 0x16, 0x14, 0x0E, 0x04, 0xFB, 0xF7, 0xF9, 0xFF, 0x06, 0x0B, 0x0E, 
-    0x0D, 0x0C, 0x0C, 0x0F, 0x13, 0x19, 0x1D, 0x1D, 0x19, 0x15, 0x13, 0x14, 
-    0x17, 0x17, 0x16, 0x15, 0x14, 0x11, 0x0E, 0x0B, 0x09, 0x0B, 0x10, 0x12, 
-    0x11, 0x0F, 0x0C, 0x0A, 0x08, 0x0A, 0x0E, 0x13, 0x16, 0x14, 0x0E, 0x09, 
-    0x07, 0x0A, 0x10, 0x17, 0x1B, 0x1B, 0x17, 0x14, 0x11, 0x12, 0x16, 0x1B, 
-    0x21, 0x24, 0x22, 0x1D, 0x17, 0x13, 0x14, 0x1A, 0x22, 0x28, 0x29, 0x26, 
-    0x1F, 0x18, 0x14, 0x11, 0x10, 0x13, 0x16, 0x17, 0x15, 0x11, 0x0F, 0x10, 
-    0x16, 0x1C, 0x20, 0x22, 0x21, 0x20, 0x1E, 0x1C, 0x1C, 0x1E, 0x22, 0x23, 
-    0x1F, 0x18, 0x13, 0x13, 0x18, 0x1D, 0x22, 0x26, 0x27, 0x24, 0x1C, 0x13, 
-    0x0B, 0x06, 0x04, 0x03, 0x04, 0x04, 0x00, 0xF8, 0xF0, 0xEC, 0xEC, 0xF1, 
-    0xF8, 0xFD, 0xFE, 0xFB, 0xF8, 0xF8, 0xFC, 0x02, 0x08, 0x0C, 0x0E, 0x0D, 
-    0x09, 0x03, 0xFD, 0xFB, 0xFB, 0xFC, 0xFB, 0xF7, 0xF1, 0xEA, 0xE7, 0xE6, 
-    0xE8, 0xED, 0xF3, 0xF6, 0xF4, 0xF1, 0xF1, 0xF5, 0xFB, 0xFF, 0x02, 0x06, 
-    0x07, 0x04, 0x01, 0xFE, 0xFF, 0x03, 0x08, 0x0D, 0x10, 0x0F, 0x0C, 0x09, 
-    0x07, 0x07, 0x09, 0x0D, 0x10, 0x0E, 0x07, 0xFE, 0xF9, 0xF5, 0xF4, 0xF6, 
-    0xF7, 0xFA, 0xFB, 0xF9, 0xF6, 0xF3, 0xF2, 0xF4, 0xF6, 0xF9, 0xFA, 0xF9, 
-    0xFA, 0xFB, 0xFD, 0xFE, 0xFF, 0x01, 0x01, 0xFE, 0xF7, 0xEF, 0xEB, 0xED, 
-    0xF4, 0xFB, 0xFF, 0xFD, 0xF8, 0xF0, 0xEA, 0xE6, 0xE4, 0xE5, 0xE7, 0xE9, 
-    0xEB, 0xE8, 0xE5, 0xE4, 0xE7, 0xED, 0xF5, 0xFF, 0x05, 0x05, 0x00, 0xFC, 
-    0xFC, 0x00, 0x03, 0x05, 0x03, 0xFF, 0xFA, 0xF5, 0xF2, 0xF0, 0xF1, 0xF4, 
-    0xF7, 0xF9, 0xF9, 0xF6, 0xF2, 0xEE, 0xEB, 0xEB, 0xEC, 0xEF, 0xF1, 0xEF, 
-    0xEC, 0xEA, 0xEC, 0xF1, 0xF8, 0xFE, 0x00, 0xFD, 0xF7, 0xF4, 0xF4, 0xF5, 
-    0xF7, 0xF9, 0xFC, 0xFF, 0xFD, 0xF9, 0xF4, 0xF3, 0xF6, 0xFC, 0x05, 0x0A, 
-    0x0A, 0x04, 0xFC, 0xF6, 0xF3, 0xF2, 0xF1, 0xF2, 0xF4, 0xF6, 0xF5, 0xF3, 
-    0xF3, 0xF6, 0xFB, 0x00, 0x02, 0x02, 0xFF, 0xFC, 0xF8, 0xF8, 0xFB, 0x02, 
-    0x0A, 0x0E, 0x0B, 0x05, 0x01, 0xFF, 0x01, 0x04, 0x06, 0x05, 0x02, 0xFE, 
-    0xFC, 0xFA, 0xF8, 0xF5, 0xF4, 0xF6, 0xF7, 0xF7, 0xF4, 0xF0, 0xEC, 0xE9, 
-    0xE8, 0xEC, 0xF1, 0xF7, 0xF7, 0xF3, 0xF1, 0xF1, 0xF4, 0xF6, 0xF8, 0xF7, 
-    0xF5, 0xF1, 0xED, 0xEA, 0xEA, 0xEC, 0xF0, 0xF5, 0xF6, 0xF6, 0xF4, 0xF2, 
-    0xF1, 0xF0, 0xF0, 0xF3, 0xF6, 0xF6, 0xF1, 0xEB, 0xE8, 0xEA, 0xEF, 0xF4, 
-    0xF9, 0xFB, 0xFA, 0xF7, 0xF7, 0xFA, 0xFE, 0x00, 0x02, 0x05, 0x07, 0x05, 
-    0x01, 0xFE, 0xFE, 0xFE, 0x00, 0x03, 0x05, 0x03, 0xFD, 0xF5, 0xF1, 0xF0, 
-    0xF1, 0xF1, 0xF0, 0xF0, 0xEF, 0xEF, 0xED, 0xEA, 0xE8, 0xE9, 0xEC, 0xF0, 
-    0xF2, 0xF0, 0xED, 0xEB, 0xEC, 0xEE, 0xF1, 0xF4, 0xF5, 0xF3, 0xF0, 0xEF, 
-    0xF2, 0xF6, 0xFA, 0xFC, 0xFA, 0xF6, 0xF2, 0xED, 0xE7, 0xE4, 0xE2, 0xE3, 
-    0xE4, 0xE5, 0xE3, 0xDF, 0xDC, 0xDB, 0xDF, 0xE4, 0xEB, 0xF1, 0xF3, 0xF2, 
-    0xEE, 0xED, 0xF0, 0xF5, 0xFB, 0xFF, 0x03, 0x05, 0x05, 0x04, 0x02, 0x00, 
-    0x00, 0x02, 0x05, 0x08, 0x09, 0x08, 0x06, 0x04, 0x02, 0x02, 0x03, 0x05, 
-    0x05, 0x02, 0xFD, 0xFA, 0xF8, 0xF9, 0xF9, 0xFA, 0xF9, 0xF9, 0xFA, 0xFC, 
-    0xFE, 0x02, 0x05, 0x07, 0x08, 0x07, 0x05, 0x05, 0x04, 0x06, 0x08, 0x0A, 
-    0x0E, 0x10, 0x0E, 0x0A, 0x07, 0x08, 0x0B, 0x0F, 0x12, 0x13, 0x11, 0x0D, 
-    0x0B, 0x08, 0x06, 0x05, 0x08, 0x0D, 0x12, 0x14, 0x14, 0x13, 0x13, 0x15, 
-    0x19, 0x1E, 0x22, 0x23, 0x20, 0x1C, 0x1B, 0x1C, 0x1E, 0x1D, 0x1A, 0x18, 
-    0x16, 0x15, 0x15, 0x14, 0x13, 0x13, 0x14, 0x15, 0x14, 0x0F, 0x09, 0x04, 
-    0x04, 0x06, 0x0A, 0x10, 0x14, 0x17, 0x16, 0x14, 0x12, 0x11, 0x12, 0x11, 
-    0x12, 0x11, 0x0E, 0x0B, 0x09, 0x0A, 0x0B, 0x0D, 0x0F, 0x12, 0x12, 0x10, 
-    0x0C, 0x09, 0x07, 0x07, 0x0A, 0x11, 0x15, 0x15, 0x11, 0x0C, 0x0B, 0x0C, 
-    0x0E, 0x11, 0x14, 0x16, 0x14, 0x12, 0x12, 0x16, 0x1B, 0x1F, 0x22, 0x24, 
-    0x27, 0x29, 0x2B, 0x28, 0x25, 0x22, 0x21, 0x22, 0x20, 0x1D, 0x18, 0x16, 
-    0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1C, 0x1A, 0x15, 0x11, 0x0F, 0x0E, 0x0D, 
-    0x0A, 0x08, 0x09, 0x08, 0x06, 0x02, 0xFF, 0xFE, 0xFF, 0x01, 0xFE, 0xF9, 
-    0xF3, 0xF0, 0xF2, 0xF5, 0xF7, 0xF8, 0xF7, 0xF7, 0xF8, 0xF7, 0xF8, 0xFB, 
-    0xFF, 0x04, 0x06, 0x05, 0x01, 0xFC, 0xF9, 0xF9, 0xFB, 0xFE, 0x02, 0x06, 
-    0x07, 0x04, 0x02, 0x03, 0x06, 0x0A, 0x0C, 0x0B, 0x0A, 0x08, 0x06, 0x02, 
-    0xFF, 0xFC, 0xFC, 0xFB, 0xFC, 0xFB, 0xF9, 0xF8, 0xF6, 0xF6, 0xF5, 0xF7, 
-    0xFA, 0xFC, 0xFA, 0xF6, 0xF1, 0xEE, 0xEF, 0xF1, 0xF4, 0xF6, 0xF6, 0xF5, 
-    0xF5, 0xF6, 0xF5, 0xF4, 0xF2, 0xF1, 0xF1, 0xF3, 0xF4, 0xF5, 0xF5, 0xF6, 
-    0xF9, 0xFD, 0xFF, 0xFD, 0xF9, 0xF5, 0xF4, 0xF5, 0xF7, 0xFB, 0xFD, 0xFE, 
-    0xFC, 0xF8, 0xF4, 0xF4, 0xF6, 0xF6, 0xF7, 0xF9, 0xF9, 0xFA, 0xFA, 0xF9, 
-    0xF8, 0xF7, 0xFA, 0x00, 0x06, 0x09, 0x0A, 0x09, 0x08, 0x08, 0x07, 0x06, 
-    0x05, 0x03, 0xFE, 0xF8, 0xF6, 0xF8, 0xF9, 0xF8, 0xF7, 0xF6, 0xF6, 0xF5, 
-    0xF4, 0xF3, 0xF1, 0xF0, 0xF0, 0xF1, 0xF3, 0xF2, 0xF0, 0xF0, 0xF1, 0xF3, 
-    0xF4, 0xF4, 0xF3, 0xF1, 0xEE, 0xEC, 0xEB, 0xEB, 0xED, 0xED, 0xEE, 0xED, 
-    0xED, 0xEC, 0xEB, 0xEA, 0xEA, 0xEE, 0xF4, 0xFB, 0xFF, 0xFC, 0xF7, 0xF3, 
-    0xF2, 0xF3, 0xF2, 0xF1, 0xF1, 0xF3, 0xF4, 0xF6, 0xF8, 0xFB, 0xFD, 0xFE, 
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x03, 0x05, 0x06, 0x03, 0xFD, 
-    0xF9, 0xF9, 0xFC, 0xFF, 0xFF, 0xFD, 0xFA, 0xF8, 0xF7, 0xF8, 0xF9, 0xFA, 
-    0xFA, 0xF9, 0xFB, 0xFE, 0xFD, 0xFA, 0xF8, 0xF6, 0xF5, 0xF6, 0xF8, 0xF8, 
-    0xF7, 0xF6, 0xF5, 0xF4, 0xF5, 0xF7, 0xF9, 0xF9, 0xFA, 0xF9, 0xF8, 0xF7, 
-    0xF6, 0xF7, 0xF9, 0xFA, 0xFB, 0xFA, 0xF9, 0xF8, 0xF6, 0xF6, 0xF5, 0xF8, 
-    0xFB, 0xFD, 0xFB, 0xF9, 0xF6, 0xF6, 0xF9, 0xFB, 0xFD, 0xFC, 0xFC, 0xFB, 
-    0xFC, 0xFC, 0xFD, 0xFE, 0xFD, 0xFC, 0xFA, 0xF8, 0xF4, 0xF2, 0xF1, 0xF1, 
-    0xF3, 0xF6, 0xF7, 0xF5, 0xF1, 0xEE, 0xEA, 0xE7, 0xE7, 0xE6, 0xE7, 0xE4, 
-    0xE1, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xDE, 0xE0, 0xE2, 0xE6, 0xE9, 0xEA, 
-    0xE9, 0xEA, 0xEC, 0xF0, 0xF3, 0xF5, 0xF5, 0xF4, 0xF6, 0xF8, 0xFB, 0xFD, 
-    0xFE, 0xFC, 0xF8, 0xF5, 0xF3, 0xF2, 0xF1, 0xF1, 0xF2, 0xF2, 0xF3, 0xF3, 
-    0xF1, 0xEF, 0xEF, 0xF2, 0xF5, 0xF9, 0xFA, 0xFA, 0xF8, 0xF6, 0xF6, 0xF7, 
-    0xFA, 0xFB, 0xFC, 0xFB, 0xFA, 0xF9, 0xF9, 0xFA, 0xFB, 0xFC, 0xFC, 0xFB, 
-    0xF9, 0xF7, 0xF8, 0xFA, 0xFB, 0xFE, 0x03, 0x08, 0x09, 0x08, 0x06, 0x06, 
-    0x07, 0x09, 0x08, 0x04, 0x00, 0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 
-    0x07, 0x06, 0x05, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x06, 0x06, 0x03, 
-    0xFE, 0xFC, 0xFC, 0xFF, 0x02, 0x03, 0x02, 0x01, 0x02, 0x03, 0x05, 0x06, 
-    0x06, 0x08, 0x0B, 0x0F, 0x14, 0x16, 0x17, 0x18, 0x18, 0x1A, 0x1D, 0x1F, 
-    0x1D, 0x19, 0x14, 0x13, 0x14, 0x16, 0x15, 0x10, 0x0A, 0x07, 0x07, 0x0A, 
-    0x0D, 0x10, 0x13, 0x15, 0x15, 0x13, 0x10, 0x0E, 0x0D, 0x0E, 0x0E, 0x11, 
-    0x14, 0x17, 0x16, 0x13, 0x11, 0x11, 0x13, 0x14, 0x14, 0x12, 0x12, 0x13, 
-    0x14, 0x15, 0x15, 0x15, 0x15, 0x14, 0x15, 0x16, 0x15, 0x13, 0x10, 0x0F, 
-    0x11, 0x14, 0x15, 0x14, 0x13, 0x13, 0x14, 0x14, 0x15, 0x13, 0x12, 0x10, 
-    0x0F, 0x0E, 0x10, 0x12, 0x13, 0x12, 0x13, 0x14, 0x15, 0x14, 0x12, 0x12, 
-    0x12, 0x13, 0x15, 0x17, 0x18, 0x16, 0x11, 0x0D, 0x0C, 0x0D, 0x0F, 0x11, 
-    0x10, 0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x0A, 0x09, 0x07, 0x05, 0x03, 0x02, 
-    0x03, 0x04, 0x06, 0x07, 0x09, 0x0C, 0x0E, 0x0E, 0x0C, 0x08, 0x07, 0x08, 
-    0x09, 0x08, 0x04, 0xFF, 0xFB, 0xF9, 0xF8, 0xF8, 0xF7, 0xF7, 0xF6, 0xF7, 
-    0xF7, 0xF9, 0xFB, 0xFC, 0xFD, 0xFC, 0xFE, 0x01, 0x04, 0x04, 0x03, 0x03, 
-    0x05, 0x09, 0x0C, 0x0E, 0x0C, 0x0A, 0x09, 0x09, 0x0A, 0x0C, 0x0B, 0x08, 
-    0x03, 0x01, 0xFF, 0xFE, 0xFD, 0xF9, 0xF5, 0xF3, 0xF5, 0xF7, 0xF6, 0xF2, 
-    0xEE, 0xEB, 0xEA, 0xEC, 0xEC, 0xE8, 0xE3, 0xDF, 0xDF, 0xE1, 0xE4, 0xE9, 
-    0xEC, 0xEF, 0xF1, 0xF2, 0xF5, 0xF8, 0xFA, 0xFC, 0xFF, 0x02, 0x06, 0x08, 
-    0x08, 0x04, 0x00, 0xFE, 0xFC, 0xFC, 0xFA, 0xF7, 0xF4, 0xF0, 0xEE, 0xF0, 
-    0xF3, 0xF5, 0xF5, 0xF4, 0xF4, 0xF5, 0xF8, 0xFB, 0xFD, 0xFF, 0xFE, 0x00, 
-    0x02, 0x04, 0x04, 0x03, 0x01, 0x01, 0x02, 0x02, 0xFF, 0xFB, 0xF6, 0xF2, 
-    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF3, 0xF3, 0xF4, 0xF6, 0xF7, 0xF8, 0xF8, 
-    0xF7, 0xF9, 0xF9, 0xF6, 0xF3, 0xF2, 0xF4, 0xF5, 0xF8, 0xFC, 0xFF, 0x01, 
-    0xFF, 0xFD, 0xFE, 0x00, 0x05, 0x07, 0x06, 0x03, 0xFF, 0xFD, 0xFB, 0xF9, 
-    0xF5, 0xF2, 0xF1, 0xF3, 0xF6, 0xF7, 0xF6, 0xF4, 0xF4, 0xF3, 0xF2, 0xF0, 
-    0xEC, 0xEA, 0xE9, 0xEB, 0xF0, 0xF5, 0xFA, 0xFD, 0xFC, 0xFB, 0xFA, 0xFC, 
-    0xFE, 0xFF, 0xFF, 0xFD, 0xFE, 0x00, 0x00, 0xFD, 0xF8, 0xF4, 0xF3, 0xF4, 
-    0xF4, 0xF2, 0xF1, 0xF1, 0xF0, 0xF1, 0xF2, 0xF4, 0xF7, 0xF7, 0xF6, 0xF4, 
-    0xF3, 0xF2, 0xF2, 0xF4, 0xF5, 0xF7, 0xFB, 0x00, 0x03, 0x03, 0x01, 0x00, 
-    0x00, 0x03, 0x05, 0x03, 0x01, 0xFE, 0xFD, 0xFD, 0xFE, 0xFF, 0xFD, 0xFB, 
-    0xF9, 0xFB, 0xFE, 0xFF, 0x00, 0x00, 0x02, 0x04, 0x05, 0x04, 0x02, 0x01, 
-    0x02, 0x05, 0x07, 0x08, 0x08, 0x06, 0x04, 0x04, 0x05, 0x05, 0x07, 0x06, 
-    0x05, 0x02, 0xFF, 0xFD, 0xFB, 0xF7, 0xF3, 0xF1, 0xF1, 0xF1, 0xF3, 0xF3, 
-    0xF3, 0xF1, 0xF1, 0xEE, 0xEC, 0xEA, 0xE6, 0xE4, 0xE0, 0xDD, 0xDA, 0xD9, 
-    0xDB, 0xDD, 0xDF, 0xE0, 0xE2, 0xE5, 0xE7, 0xE9, 0xEA, 0xEC, 0xF0, 0xF4, 
-    0xF8, 0xF9, 0xF7, 0xF4, 0xF3, 0xF3, 0xF3, 0xF1, 0xEE, 0xEA, 0xE8, 0xE8, 
-    0xEA, 0xEB, 0xEC, 0xED, 0xEF, 0xF0, 0xF1, 0xF1, 0xF3, 0xF6, 0xF7, 0xF8, 
-    0xFA, 0xFD, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFE, 0xFD, 0xFA, 0xF8, 0xF6, 
-    0xF4, 0xF2, 0xEF, 0xEC, 0xEB, 0xEA, 0xEA, 0xEC, 0xF0, 0xF4, 0xF7, 0xFA, 
-    0xFB, 0xFB, 0xFC, 0xFF, 0x00, 0xFF, 0xFD, 0xFD, 0xFF, 0x02, 0x04, 0x06, 
-    0x09, 0x0B, 0x0D, 0x10, 0x13, 0x16, 0x1A, 0x1D, 0x20, 0x21, 0x20, 0x1D, 
-    0x19, 0x15, 0x12, 0x10, 0x0F, 0x10, 0x10, 0x0F, 0x0C, 0x0A, 0x09, 0x08, 
-    0x06, 0x03, 0x00, 0xFE, 0xFD, 0xFF, 0x01, 0x04, 0x05, 0x07, 0x09, 0x0B, 
-    0x0A, 0x09, 0x0A, 0x0D, 0x0E, 0x0D, 0x0B, 0x09, 0x08, 0x06, 0x03, 0x01, 
-    0x00, 0xFF, 0xFC, 0xFB, 0xF9, 0xFA, 0xFB, 0xFE, 0x01, 0x05, 0x0A, 0x0B, 
-    0x0C, 0x0A, 0x09, 0x08, 0x07, 0x06, 0x07, 0x09, 0x0D, 0x12, 0x16, 0x18, 
-    0x18, 0x17, 0x18, 0x19, 0x1B, 0x1C, 0x1B, 0x1A, 0x1B, 0x1B, 0x1A, 0x18, 
-    0x16, 0x13, 0x10, 0x0F, 0x10, 0x14, 0x18, 0x18, 0x16, 0x16, 0x18, 0x19, 
-    0x1A, 0x19, 0x1A, 0x1D, 0x20, 0x21, 0x20, 0x1E, 0x1C, 0x1B, 0x1C, 0x1F, 
-    0x21, 0x23, 0x22, 0x1E, 0x1B, 0x17, 0x14, 0x0F, 0x0B, 0x08, 0x06, 0x07, 
-    0x08, 0x0A, 0x0B, 0x0A, 0x09, 0x09, 0x0B, 0x0E, 0x0D, 0x09, 0x05, 0x02, 
-    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x06, 0x06, 0x08, 0x0B, 0x0E, 0x10, 
-    0x12, 0x15, 0x18, 0x19, 0x19, 0x16, 0x14, 0x11, 0x10, 0x0E, 0x0C, 0x09, 
-    0x07, 0x05, 0x04, 0x03, 0x02, 0x00, 0xFE, 0xFB, 0xF9, 0xFA, 0xFB, 0xFE, 
-    0xFE, 0xFF, 0xFE, 0x00, 0x01, 0x01, 0x00, 0xFE, 0xFD, 0xFC, 0xFD, 0xFC, 
-    0xFA, 0xF7, 0xF3, 0xF2, 0xF1, 0xF2, 0xF2, 0xF3, 0xF2, 0xF3, 0xF4, 0xF7, 
-    0xFC, 0x01, 0x03, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x05, 0x06, 
-    0x06, 0x04, 0x03, 0x02, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0A, 0x0E, 0x0F, 
-    0x0F, 0x0D, 0x0B, 0x09, 0x06, 0x04, 0x03, 0x01, 0x00, 0xFE, 0xFD, 0xFA, 
-    0xF6, 0xF2, 0xEF, 0xED, 0xEE, 0xED, 0xEC, 0xEB, 0xEC, 0xF0, 0xF3, 0xF3, 
-    0xF2, 0xF0, 0xEE, 0xEE, 0xF0, 0xF2, 0xF5, 0xF8, 0xF9, 0xF9, 0xF7, 0xF5, 
-    0xF4, 0xF4, 0xF4, 0xF2, 0xEF, 0xEE, 0xED, 0xEE, 0xED, 0xEF, 0xF1, 0xF4, 
-    0xF7, 0xF7, 0xF5, 0xF4, 0xF3, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 0xF9, 0xFA, 
-    0xFA, 0xFA, 0xFA, 0xFD, 0x01, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x05, 
-    0x03, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFA, 0xF7, 0xF7, 
-    0xF7, 0xF8, 0xFA, 0xFE, 0x01, 0x03, 0x04, 0x03, 0x00, 0xFE, 0xFD, 0xFF, 
-    0x00, 0x03, 0x06, 0x09, 0x08, 0x01, 0xFB, 0xF5, 0xF3, 0xF3, 0xF1, 0xF0, 
-    0xEF, 0xF1, 0xF2, 0xF4, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0, 0xED, 0xEB, 0xEA, 
-    0xEB, 0xED, 0xEF, 0xF1, 0xF2, 0xF1, 0xF0, 0xEE, 0xED, 0xEC, 0xEE, 0xEF, 
-    0xF0, 0xF2, 0xF5, 0xFA, 0x00, 0x07, 0x0F, 0x14, 0x14, 0x10, 0x0B, 0x06, 
-    0xFF, 0xF9, 0xF7, 0xFB, 0x04, 0x07, 0x01, 0xF7, 0xF0, 0xED, 0xF0, 0xF5, 
-    0xFB, 0x01, 0x06, 0x08, 0x08, 0x06, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 
-    0xFC, 0xF9, 0xF7, 0xF3, 0xEF, 0xEC, 0xEC, 0xED, 0xEC, 0xE8, 0xE3, 0xDE, 
-    0xDE, 0xE0, 0xE5, 0xEA, 0xEC, 0xEF, 0xF1, 0xEE, 0xEB, 0xE9, 0xE9, 0xEC, 
-    0xEE, 0xF1, 0xF0, 0xF0, 0xEF, 0xF0, 0xF1, 0xF2, 0xF1, 0xEF, 0xF2, 0xF6, 
-    0xFA, 0xFB, 0xFA, 0xF9, 0xF9, 0xF8, 0xF7, 0xF7, 0xF8, 0xFA, 0xFB, 0xF9, 
-    0xF4, 0xEF, 0xEA, 0xEC, 0xF0, 0xF1, 0xEB, 0xE1, 0xD9, 0xD6, 0xD8, 0xDC, 
-    0xE4, 0xEF, 0xF7, 0xF7, 0xF1, 0xE8, 0xE3, 0xE1, 0xE3, 0xE4, 0xE5, 0xE7, 
-    0xED, 0xF4, 0xFA, 0xF9, 0xF4, 0xED, 0xE9, 0xEA, 0xEE, 0xF4, 0xFC, 0x04, 
-    0x0C, 0x0F, 0x0F, 0x0F, 0x11, 0x12, 0x0F, 0x08, 0xFF, 0xFC, 0xFF, 0x06, 
-    0x0E, 0x12, 0x15, 0x18, 0x19, 0x19, 0x17, 0x13, 0x0E, 0x0C, 0x0E, 0x14, 
-    0x1C, 0x20, 0x22, 0x20, 0x1A, 0x12, 0x0B, 0x09, 0x0B, 0x0B, 0x08, 0x04, 
-    0x01, 0x02, 0x04, 0x07, 0x0A, 0x0D, 0x0F, 0x10, 0x0F, 0x0E, 0x0B, 0x09, 
-    0x07, 0x0B, 0x10, 0x11, 0x0D, 0x09, 0x09, 0x0B, 0x0C, 0x09, 0x06, 0x09, 
-    0x0C, 0x0B, 0x06, 0x00, 0xFA, 0xF9, 0xFD, 0x00, 0x03, 0x07, 0x0B, 0x0E, 
-    0x0E, 0x0B, 0x07, 0x05, 0x06, 0x08, 0x07, 0x05, 0x04, 0x07, 0x0C, 0x0F, 
-    0x0F, 0x0D, 0x10, 0x16, 0x1A, 0x1B, 0x1B, 0x1F, 0x23, 0x22, 0x1A, 0x11, 
-    0x11, 0x19, 0x25, 0x2E, 0x31, 0x2C, 0x21, 0x14, 0x0C, 0x0A, 0x0D, 0x10, 
-    0x12, 0x15, 0x14, 0x14, 0x15, 0x1A, 0x23, 0x24, 0x20, 0x16, 0x11, 0x10, 
-    0x15, 0x1A, 0x1E, 0x1F, 0x1F, 0x1E, 0x1B, 0x18, 0x11, 0x06, 0xFE, 0xFC, 
-    0x00, 0x07, 0x0D, 0x11, 0x13, 0x11, 0x0F, 0x0B, 0x0C, 0x13, 0x1A, 0x1D, 
-    0x19, 0x12, 0x0F, 0x10, 0x12, 0x13, 0x12, 0x15, 0x1D, 0x23, 0x22, 0x1B, 
-    0x11, 0x0D, 0x0D, 0x0F, 0x11, 0x10, 0x0D, 0x09, 0x06, 0x00, 0xFA, 0xF7, 
-    0xFE, 0x06, 0x09, 0x02, 0xF8, 0xF2, 0xF2, 0xF7, 0xFD, 0x01, 0x06, 0x07, 
-    0x02, 0xF8, 0xEE, 0xE7, 0xE6, 0xE9, 0xED, 0xF0, 0xF4, 0xF7, 0xFA, 0xFB, 
-    0xF9, 0xF7, 0xF8, 0xFF, 0x06, 0x07, 0xFF, 0xF3, 0xEA, 0xE7, 0xEA, 0xF0, 
-    0xF6, 0xF9, 0xFB, 0xFA, 0xF9, 0xF8, 0xF8, 0xFC, 0x02, 0x08, 0x0B, 0x09, 
-    0x01, 0xF9, 0xF5, 0xF8, 0x01, 0x0D, 0x1A, 0x22, 0x1E, 0x0F, 0xFD, 0xF1, 
-    0xEF, 0xF7, 0x02, 0x08, 0x07, 0x05, 0x05, 0x07, 0x07, 0x04, 0xFD, 0xF6, 
-    0xF1, 0xF0, 0xF3, 0xF9, 0x01, 0x07, 0x08, 0x02, 0xF8, 0xF2, 0xF6, 0xF8, 
-    0xF5, 0xEF, 0xEC, 0xEF, 0xF4, 0xF6, 0xF4, 0xF2, 0xF3, 0xF7, 0xF9, 0xF7, 
-    0xF1, 0xED, 0xEB, 0xED, 0xF1, 0xF4, 0xF7, 0xF6, 0xF6, 0xF4, 0xEE, 0xE8, 
-    0xE7, 0xEF, 0xF5, 0xF5, 0xEF, 0xEA, 0xE7, 0xE6, 0xE8, 0xEA, 0xEE, 0xF4, 
-    0xFC, 0xFF, 0xFF, 0xFC, 0xF5, 0xEF, 0xEA, 0xE9, 0xED, 0xF6, 0xFF, 0x07, 
-    0x0B, 0x08, 0x02, 0xFD, 0x00, 0x05, 0x05, 0xFD, 0xEF, 0xE4, 0xE1, 0xE6, 
-    0xED, 0xF2, 0xF6, 0xFA, 0xFD, 0xFE, 0xFD, 0xFA, 0xF5, 0xF1, 0xF2, 0xF8, 
-    0xFF, 0x03, 0x04, 0x03, 0xFD, 0xF3, 0xEA, 0xEB, 0xF2, 0xF6, 0xF2, 0xE9, 
-    0xE2, 0xE0, 0xE0, 0xE1, 0xDE, 0xDF, 0xEA, 0xF9, 0x05, 0x0A, 0x08, 0x00, 
-    0xF7, 0xF1, 0xEF, 0xF1, 0xF9, 0x03, 0x0B, 0x0B, 0x04, 0xFD, 0x00, 0x09, 
-    0x0E, 0x08, 0xFA, 0xEF, 0xEE, 0xF7, 0x02, 0x0B, 0x10, 0x13, 0x13, 0x0F, 
-    0x08, 0xFF, 0xF9, 0xF9, 0xFC, 0x01, 0x04, 0x05, 0x01, 0xFE, 0xFA, 0xF7, 
-    0xF3, 0xF1, 0xF2, 0xF1, 0xEE, 0xE6, 0xDF, 0xDF, 0xE5, 0xEE, 0xF5, 0xF5, 
-    0xF4, 0xF4, 0xF2, 0xEF, 0xED, 0xEA, 0xEB, 0xED, 0xF0, 0xF1, 0xEF, 0xEE, 
-    0xF0, 0xF5, 0xF7, 0xF2, 0xEB, 0xEC, 0xF1, 0xF4, 0xF0, 0xE5, 0xDF, 0xE2, 
-    0xEB, 0xF6, 0xFB, 0xFC, 0xFB, 0xFB, 0xFC, 0xFE, 0xFF, 0xFE, 0xFC, 0xF8, 
-    0xF2, 0xEE, 0xEF, 0xF4, 0xF7, 0xF5, 0xEF, 0xED, 0xF3, 0xFC, 0xFE, 0xF5, 
-    0xE9, 0xE3, 0xE5, 0xEB, 0xF2, 0xF3, 0xF2, 0xF3, 0xF5, 0xF5, 0xF2, 0xEE, 
-    0xED, 0xF1, 0xF6, 0xF8, 0xF5, 0xEE, 0xE7, 0xE3, 0xE1, 0xE3, 0xE8, 0xF2, 
-    0xFC, 0xFE, 0xF5, 0xE4, 0xD5, 0xD0, 0xD7, 0xE8, 0xF9, 0x03, 0x06, 0x02, 
-    0xFD, 0xF5, 0xEE, 0xE8, 0xE7, 0xEC, 0xF5, 0xFC, 0xFF, 0x00, 0x00, 0x01, 
-    0x02, 0x04, 0x07, 0x10, 0x16, 0x17, 0x11, 0x08, 0x04, 0x06, 0x0A, 0x0F, 
-    0x10, 0x0F, 0x10, 0x10, 0x0F, 0x0C, 0x09, 0x0C, 0x12, 0x18, 0x16, 0x0E, 
-    0x06, 0x02, 0x05, 0x0B, 0x0F, 0x13, 0x19, 0x1A, 0x14, 0x08, 0xFB, 0xF6, 
-    0xF9, 0x04, 0x11, 0x1A, 0x1D, 0x18, 0x0F, 0x04, 0xFD, 0xFD, 0x00, 0x00, 
-    0xFE, 0xFA, 0xF7, 0xF7, 0xFC, 0x03, 0x05, 0x04, 0x05, 0x0D, 0x16, 0x18, 
-    0x0E, 0x02, 0xFB, 0xFD, 0x05, 0x0E, 0x13, 0x13, 0x12, 0x13, 0x18, 0x1F, 
-    0x22, 0x1F, 0x19, 0x16, 0x15, 0x15, 0x16, 0x19, 0x1D, 0x20, 0x1F, 0x1C, 
-    0x1D, 0x22, 0x26, 0x26, 0x23, 0x1F, 0x1A, 0x16, 0x11, 0x10, 0x0F, 0x12, 
-    0x19, 0x20, 0x23, 0x1D, 0x10, 0xFF, 0xF4, 0xF1, 0xF7, 0x04, 0x11, 0x1A, 
-    0x1A, 0x11, 0x03, 0xFB, 0xF9, 0xFA, 0xFB, 0xFB, 0xFD, 0x03, 0x0C, 0x15, 
-    0x1A, 0x1A, 0x16, 0x12, 0x0E, 0x0A, 0x09, 0x0A, 0x0D, 0x12, 0x18, 0x1B, 
-    0x1D, 0x1D, 0x1D, 0x1C, 0x19, 0x17, 0x19, 0x22, 0x29, 0x2B, 0x25, 0x1E, 
-    0x1A, 0x19, 0x1B, 0x20, 0x25, 0x24, 0x21, 0x19, 0x10, 0x0B, 0x08, 0x0A, 
-    0x0D, 0x0E, 0x0C, 0x08, 0x07, 0x09, 0x0B, 0x0A, 0x04, 0xFF, 0xFD, 0xFC, 
-    0xF7, 0xED, 0xE3, 0xDF, 0xE7, 0xF6, 0x06, 0x0E, 0x0A, 0x00, 0xF8, 0xF5, 
-    0xF7, 0xFE, 0x03, 0x05, 0x03, 0xFF, 0xFB, 0xF8, 0xF9, 0xFD, 0x01, 0x04, 
-    0x07, 0x0C, 0x11, 0x0F, 0x05, 0xF7, 0xED, 0xEC, 0xF2, 0xFB, 0x00, 0xFF, 
-    0xF8, 0xF0, 0xEC, 0xEF, 0xF8, 0x03, 0x0C, 0x0F, 0x0A, 0xFE, 0xF2, 0xEC, 
-    0xF0, 0xFA, 0x05, 0x0D, 0x15, 0x19, 0x11, 0xFE, 0xE8, 0xDB, 0xDB, 0xE6, 
-    0xF7, 0x08, 0x11, 0x0E, 0x03, 0xF5, 0xE9, 0xE1, 0xE2, 0xEA, 0xF7, 0x04, 
-    0x0B, 0x0D, 0x0B, 0x06, 0xFD, 0xF2, 0xEB, 0xEC, 0xF4, 0xFB, 0xFB, 0xF5, 
-    0xEB, 0xE4, 0xE2, 0xE8, 0xF1, 0xFB, 0xFF, 0xFD, 0xF8, 0xF3, 0xF1, 0xF5, 
-    0xFA, 0xFE, 0x00, 0xFE, 0xFC, 0xF9, 0xF7, 0xF7, 0xFA, 0xFB, 0xFD, 0x03, 
-    0x08, 0x08, 0x01, 0xF6, 0xEC, 0xEA, 0xF1, 0x01, 0x12, 0x19, 0x15, 0x0D, 
-    0x03, 0xFD, 0xFB, 0xFB, 0xFD, 0x01, 0x05, 0x05, 0x02, 0xFE, 0xFD, 0xFE, 
-    0xFB, 0xF9, 0xFF, 0x02, 0xFC, 0xEE, 0xDC, 0xD3, 0xD3, 0xDC, 0xEA, 0xF4, 
-    0xF5, 0xEF, 0xE9, 0xE4, 0xE3, 0xE6, 0xE9, 0xEC, 0xEE, 0xEE, 0xEC, 0xEA, 
-    0xEB, 0xED, 0xEF, 0xF2, 0xF6, 0xFA, 0xFD, 0xFB, 0xF5, 0xEC, 0xE4, 0xDE, 
-    0xDC, 0xDF, 0xE6, 0xEF, 0xF7, 0xFF, 0x05, 0x09, 0x09, 0x05, 0x00, 0xFD, 
-    0xFB, 0xFE, 0x06, 0x13, 0x20, 0x29, 0x27, 0x19, 0x07, 0xF6, 0xE8, 0xDF, 
-    0xDD, 0xE4, 0xF3, 0x02, 0x0C, 0x0E, 0x07, 0xF8, 0xE9, 0xE1, 0xE3, 0xED, 
-    0xF9, 0x02, 0x06, 0x06, 0x03, 0xFD, 0xF7, 0xF6, 0xF8, 0xF9, 0xF7, 0xF7, 
-    0xFB, 0xFF, 0xFD, 0xF7, 0xF0, 0xEC, 0xED, 0xF3, 0xFD, 0x04, 0x07, 0x06, 
-    0x08, 0x07, 0x05, 0x02, 0x02, 0x01, 0xFF, 0xFB, 0xF7, 0xF7, 0xF9, 0xF9, 
-    0xF3, 0xEC, 0xE9, 0xEF, 0xF3, 0xF2, 0xE9, 0xDF, 0xDB, 0xDF, 0xE7, 0xF0, 
-    0xF9, 0xFE, 0xFD, 0xFA, 0xF6, 0xF4, 0xF1, 0xEF, 0xEB, 0xE8, 0xE5, 0xE4, 
-    0xE4, 0xE1, 0xDD, 0xDA, 0xDA, 0xE1, 0xEC, 0xF5, 0xF3, 0xE9, 0xDE, 0xD9, 
-    0xDC, 0xE6, 0xF1, 0xF9, 0xFC, 0xF7, 0xEE, 0xE9, 0xEB, 0xF2, 0xFB, 0x01, 
-    0x04, 0xFC, 0xEF, 0xDF, 0xD6, 0xD8, 0xE2, 0xF0, 0xFF, 0x0A, 0x0D, 0x01, 
-    0xEA, 0xD3, 0xC4, 0xC5, 0xD4, 0xEB, 0x03, 0x11, 0x0F, 0x00, 0xEF, 0xE2, 
-    0xDD, 0xDE, 0xE6, 0xF4, 0x03, 0x0F, 0x16, 0x19, 0x19, 0x15, 0x0F, 0x0A, 
-    0x0A, 0x11, 0x1A, 0x1C, 0x1A, 0x16, 0x16, 0x1A, 0x1D, 0x1E, 0x1B, 0x12, 
-    0x09, 0x03, 0x04, 0x0A, 0x11, 0x15, 0x12, 0x09, 0xFD, 0xF3, 0xEF, 0xF2, 
-    0xF8, 0xFC, 0xFC, 0xFD, 0xFF, 0xFF, 0xFB, 0xF3, 0xEC, 0xEC, 0xF2, 0xFD, 
-    0x08, 0x10, 0x13, 0x10, 0x0A, 0x08, 0x0B, 0x0D, 0x0C, 0x08, 0x04, 0xFF, 
-    0xFC, 0xFB, 0xFD, 0x00, 0x01, 0x02, 0x07, 0x0F, 0x17, 0x16, 0x0F, 0x05, 
-    0x02, 0x05, 0x0E, 0x1B, 0x27, 0x2D, 0x2C, 0x29, 0x27, 0x24, 0x20, 0x1C, 
-    0x18, 0x18, 0x17, 0x12, 0x0D, 0x08, 0x06, 0x05, 0x03, 0x05, 0x0D, 0x19, 
-    0x22, 0x21, 0x18, 0x0B, 0x02, 0x00, 0x04, 0x0D, 0x1A, 0x24, 0x27, 0x24, 
-    0x1D, 0x16, 0x10, 0x0D, 0x0D, 0x0F, 0x12, 0x17, 0x1E, 0x25, 0x2C, 0x2F, 
-    0x2C, 0x26, 0x1F, 0x14, 0x07, 0xFB, 0xF8, 0x04, 0x17, 0x2A, 0x34, 0x32, 
-    0x22, 0x09, 0xF2, 0xE7, 0xEC, 0xFB, 0x0F, 0x1F, 0x29, 0x28, 0x20, 0x16, 
-    0x0E, 0x0B, 0x0C, 0x0E, 0x15, 0x1F, 0x25, 0x24, 0x1A, 0x0C, 0x03, 0xFF, 
-    0x03, 0x09, 0x0C, 0x09, 0x00, 0xF9, 0xFA, 0x02, 0x0C, 0x13, 0x14, 0x11, 
-    0x0B, 0x04, 0x01, 0x04, 0x0B, 0x13, 0x19, 0x1C, 0x1B, 0x15, 0x08, 0xF9, 
-    0xEC, 0xE8, 0xF0, 0xFD, 0x07, 0x08, 0x01, 0xF6, 0xEC, 0xEB, 0xF0, 0xF4, 
-    0xF7, 0xF9, 0xF9, 0xF8, 0xF6, 0xF3, 0xF1, 0xF4, 0xF9, 0xFC, 0xFE, 0x05, 
-    0x0D, 0x0F, 0x09, 0x00, 0xFB, 0xFB, 0xFF, 0x04, 0x0B, 0x10, 0x11, 0x0E, 
-    0x0B, 0x0D, 0x12, 0x16, 0x15, 0x0F, 0x05, 0xF9, 0xF0, 0xEB, 0xEF, 0xFA, 
-    0x07, 0x12, 0x19, 0x1A, 0x11, 0xFE, 0xE9, 0xD8, 0xD5, 0xE0, 0xF5, 0x0C, 
-    0x1C, 0x20, 0x13, 0xFE, 0xE7, 0xD6, 0xCF, 0xD2, 0xDF, 0xF0, 0x00, 0x09, 
-    0x0A, 0x04, 0xFC, 0xF0, 0xE6, 0xE1, 0xE4, 0xEA, 0xEE, 0xEB, 0xE5, 0xE5, 
-    0xEC, 0xF8, 0xFF, 0xFE, 0xF5, 0xE6, 0xD7, 0xD3, 0xDB, 0xEE, 0x04, 0x13, 
-    0x1A, 0x16, 0x0A, 0xFD, 0xF7, 0xF9, 0xFF, 0x08, 0x13, 0x1E, 0x21, 0x19, 
-    0x05, 0xED, 0xDE, 0xDD, 0xE6, 0xF2, 0xFA, 0xFD, 0xF9, 0xF3, 0xF0, 0xF2, 
-    0xF5, 0xF7, 0xF9, 0xFB, 0xF9, 0xF6, 0xF2, 0xF1, 0xF5, 0xFC, 0x02, 0x06, 
-    0x08, 0x07, 0x00, 0xF5, 0xEC, 0xEB, 0xF4, 0x01, 0x0A, 0x0C, 0x09, 0x02, 
-    0xF9, 0xF5, 0xF9, 0x02, 0x0B, 0x12, 0x13, 0x0E, 0x04, 0xF8, 0xEE, 0xEA, 
-    0xEC, 0xF0, 0xF2, 0xF4, 0xF8, 0xFC, 0xFB, 0xF3, 0xE6, 0xDE, 0xDD, 0xE1, 
-    0xE7, 0xF1, 0xFB, 0x03, 0x07, 0x05, 0xFE, 0xF4, 0xEA, 0xE3, 0xE0, 0xE2, 
-    0xE9, 0xF3, 0xFE, 0x07, 0x08, 0x00, 0xF5, 0xEC, 0xE6, 0xE1, 0xDF, 0xE0, 
-    0xEA, 0xFA, 0x0B, 0x15, 0x16, 0x11, 0x02, 0xF0, 0xE3, 0xE0, 0xE8, 0xF8, 
-    0x08, 0x16, 0x1D, 0x1B, 0x13, 0x06, 0xFA, 0xEE, 0xE6, 0xE8, 0xF4, 0x03, 
-    0x0B, 0x06, 0xF9, 0xEB, 0xE5, 0xE5, 0xEA, 0xF0, 0xF4, 0xF4, 0xEF, 0xEC, 
-    0xEC, 0xF2, 0xFA, 0x00, 0x05, 0x05, 0x01, 0xFC, 0xF7, 0xF9, 0x00, 0x0A, 
-    0x18, 0x24, 0x28, 0x1E, 0x06, 0xEE, 0xDF, 0xDF, 0xEB, 0xFC, 0x09, 0x11, 
-    0x10, 0x05, 0xF9, 0xF0, 0xED, 0xF0, 0xF8, 0xFF, 0x02, 0xFE, 0xF5, 0xEA, 
-    0xE3, 0xE0, 0xE2, 0xE7, 0xED, 0xF0, 0xEE, 0xE8, 0xDE, 0xD4, 0xD3, 0xDA, 
-    0xE5, 0xEB, 0xEC, 0xEA, 0xE3, 0xDE, 0xDD, 0xE3, 0xEF, 0xFA, 0xFD, 0xF5, 
-    0xE8, 0xD9, 0xD1, 0xD3, 0xDE, 0xEB, 0xF5, 0xF9, 0xF7, 0xEF, 0xE4, 0xD7, 
-    0xCF, 0xD2, 0xE2, 0xF9, 0x0D, 0x19, 0x1A, 0x0F, 0xFC, 0xEC, 0xE1, 0xDF, 
-    0xE3, 0xEB, 0xF5, 0xFD, 0x01, 0xFF, 0xFB, 0xF5, 0xEC, 0xE0, 0xD9, 0xDC, 
-    0xE9, 0xF7, 0x02, 0x06, 0x0A, 0x11, 0x16, 0x18, 0x15, 0x0E, 0x03, 0xFB, 
-    0xFD, 0x06, 0x14, 0x21, 0x2B, 0x2F, 0x2D, 0x24, 0x1A, 0x11, 0x0C, 0x0A, 
-    0x0C, 0x13, 0x20, 0x2C, 0x31, 0x2C, 0x1D, 0x0C, 0x01, 0x00, 0x05, 0x0C, 
-    0x13, 0x17, 0x14, 0x0D, 0x04, 0xFB, 0xF7, 0xF8, 0xFE, 0x03, 0x04, 0x03, 
-    0xFF, 0xFC, 0xFD, 0x00, 0x05, 0x0C, 0x12, 0x11, 0x07, 0xF8, 0xE9, 0xE6, 
-    0xEE, 0xFB, 0x06, 0x0E, 0x11, 0x0C, 0x02, 0xFA, 0xFA, 0x04, 0x12, 0x1E, 
-    0x23, 0x1F, 0x16, 0x0B, 0x03, 0x03, 0x09, 0x13, 0x1F, 0x2B, 0x2F, 0x28, 
-    0x19, 0x07, 0xFE, 0xFE, 0x0A, 0x19, 0x28, 0x30, 0x2C, 0x1E, 0x0F, 0x05, 
-    0x00, 0x03, 0x08, 0x0D, 0x10, 0x11, 0x12, 0x14, 0x18, 0x18, 0x14, 0x0C, 
-    0x01, 0xF7, 0xF0, 0xEE, 0xF4, 0x01, 0x16, 0x2B, 0x37, 0x37, 0x2C, 0x1A, 
-    0x07, 0xFA, 0xF9, 0x04, 0x15, 0x26, 0x31, 0x35, 0x32, 0x2B, 0x22, 0x19, 
-    0x12, 0x0D, 0x0E, 0x15, 0x21, 0x2B, 0x2E, 0x2A, 0x25, 0x21, 0x1D, 0x18, 
-    0x13, 0x10, 0x0E, 0x0C, 0x0B, 0x0D, 0x11, 0x16, 0x18, 0x15, 0x0F, 0x08, 
-    0x02, 0xFF, 0x01, 0x01, 0x02, 0x05, 0x0A, 0x11, 0x11, 0x0A, 0xFD, 0xF1, 
-    0xE9, 0xE6, 0xE8, 0xEB, 0xF0, 0xF6, 0xF8, 0xF5, 0xEE, 0xE4, 0xDD, 0xDE, 
-    0xE5, 0xF0, 0xFA, 0x00, 0x02, 0xFF, 0xFA, 0xF7, 0xFB, 0x04, 0x0D, 0x12, 
-    0x11, 0x08, 0xFB, 0xF0, 0xEB, 0xEE, 0xF4, 0xFA, 0xFF, 0x00, 0xFC, 0xF7, 
-    0xF4, 0xF4, 0xF8, 0xFF, 0x05, 0x08, 0x05, 0xFF, 0xFC, 0xFF, 0x07, 0x10, 
-    0x16, 0x17, 0x12, 0x09, 0xFC, 0xF1, 0xED, 0xF6, 0x08, 0x1A, 0x28, 0x2B, 
-    0x21, 0x0D, 0xF7, 0xE9, 0xE6, 0xF1, 0x02, 0x13, 0x1F, 0x20, 0x19, 0x0D, 
-    0x02, 0xF6, 0xEE, 0xEB, 0xEB, 0xEA, 0xE6, 0xE2, 0xE1, 0xE6, 0xF1, 0xFD, 
-    0x07, 0x07, 0xFE, 0xEF, 0xE0, 0xD8, 0xDC, 0xE7, 0xF5, 0x00, 0x05, 0x03, 
-    0xFA, 0xF0, 0xE7, 0xE3, 0xE1, 0xE4, 0xEA, 0xF0, 0xF5, 0xF7, 0xF6, 0xF3, 
-    0xF0, 0xF0, 0xF5, 0xFB, 0xFD, 0xFA, 0xF8, 0xF7, 0xFB, 0x01, 0x06, 0x08, 
-    0x08, 0x09, 0x07, 0x02, 0xFA, 0xF4, 0xF3, 0xF5, 0xF8, 0xFC, 0xFF, 0xFF, 
-    0xFD, 0xF7, 0xF1, 0xEB, 0xEA, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xEF, 0xEC, 
-    0xEB, 0xEA, 0xEB, 0xEE, 0xF2, 0xF7, 0xFA, 0xFA, 0xFA, 0xF8, 0xF6, 0xF5, 
-    0xF8, 0xFF, 0x08, 0x0C, 0x09, 0xFF, 0xF4, 0xEB, 0xE7, 0xEA, 0xF5, 0x05, 
-    0x14, 0x1A, 0x14, 0x07, 0xFA, 0xF2, 0xF2, 0xF8, 0x01, 0x0C, 0x13, 0x15, 
-    0x13, 0x0D, 0x05, 0xFE, 0xFA, 0xF7, 0xF6, 0xF1, 0xEB, 0xE6, 0xE6, 0xED, 
-    0xF8, 0x04, 0x0B, 0x0A, 0x02, 0xF1, 0xE0, 0xD7, 0xDA, 0xE5, 0xF6, 0x06, 
-    0x11, 0x13, 0x0B, 0xFC, 0xEE, 0xE3, 0xDD, 0xE0, 0xE6, 0xED, 0xF0, 0xEC, 
-    0xE6, 0xE2, 0xE6, 0xF1, 0xFE, 0x08, 0x0A, 0x04, 0xF8, 0xEC, 0xE7, 0xEA, 
-    0xF5, 0x02, 0x0D, 0x12, 0x0D, 0x01, 0xF2, 0xEA, 0xE8, 0xEB, 0xF3, 0xFB, 
-    0x01, 0x02, 0xFD, 0xF5, 0xEE, 0xED, 0xF3, 0xFB, 0x01, 0x04, 0x04, 0x02, 
-    0xFC, 0xF9, 0xFA, 0xFE, 0x04, 0x07, 0x08, 0x05, 0x00, 0xF9, 0xF5, 0xF3, 
-    0xF5, 0xFA, 0x01, 0x06, 0x0A, 0x09, 0x04, 0xFD, 0xF8, 0xF8, 0xF8, 0xF9, 
-    0xF8, 0xF9, 0xF6, 0xEF, 0xE7, 0xE3, 0xE1, 0xE0, 0xE1, 0xE0, 0xE0, 0xDF, 
-    0xDE, 0xE1, 0xE5, 0xE9, 0xEA, 0xEB, 0xE9, 0xE7, 0xE5, 0xE0, 0xDD, 0xDB, 
-    0xE0, 0xE9, 0xF5, 0xFF, 0x04, 0x00, 0xF3, 0xE2, 0xD4, 0xCE, 0xD1, 0xDB, 
-    0xEB, 0xFB, 0x04, 0x06, 0x01, 0xF9, 0xEF, 0xE9, 0xEA, 0xF2, 0xFD, 0x05, 
-    0x09, 0x06, 0x00, 0xFE, 0x02, 0x0B, 0x12, 0x15, 0x11, 0x07, 0xFA, 0xF1, 
-    0xEC, 0xF1, 0xFD, 0x0C, 0x17, 0x18, 0x13, 0x09, 0xFE, 0xF5, 0xF0, 0xF2, 
-    0xFB, 0x07, 0x0E, 0x0D, 0x05, 0xFB, 0xF8, 0xFB, 0x04, 0x10, 0x1A, 0x20, 
-    0x1C, 0x13, 0x0B, 0x0A, 0x10, 0x19, 0x22, 0x27, 0x27, 0x20, 0x16, 0x0E, 
-    0x0C, 0x0F, 0x17, 0x22, 0x29, 0x27, 0x1E, 0x10, 0x06, 0x02, 0x04, 0x0B, 
-    0x12, 0x16, 0x16, 0x0F, 0x04, 0xFE, 0xFF, 0x07, 0x10, 0x16, 0x17, 0x12, 
-    0x09, 0xFF, 0xFA, 0xFB, 0xFF, 0x05, 0x0D, 0x13, 0x14, 0x0F, 0x04, 0xF9, 
-    0xF4, 0xF7, 0x01, 0x0C, 0x16, 0x19, 0x16, 0x0A, 0xFC, 0xF2, 0xEE, 0xF0, 
-    0xF7, 0x00, 0x0B, 0x16, 0x1E, 0x23, 0x26, 0x25, 0x1E, 0x15, 0x0C, 0x05, 
-    0xFE, 0xF5, 0xEE, 0xEA, 0xEC, 0xEE, 0xF1, 0xF4, 0xF8, 0xFA, 0xFC, 0xFD, 
-    0x00, 0x07, 0x0E, 0x17, 0x22, 0x2D, 0x37, 0x3D, 0x41, 0x43, 0x43, 0x3F, 
-    0x3E, 0x40, 0x45, 0x48, 0x46, 0x3F, 0x36, 0x30, 0x2D, 0x2F, 0x34, 0x38, 
-    0x38, 0x30, 0x22, 0x16, 0x0C, 0x05, 0x02, 0x04, 0x0A, 0x10, 0x13, 0x12, 
-    0x0E, 0x0A, 0x07, 0x07, 0x08, 0x09, 0x09, 0x05, 0xFB, 0xEE, 0xE5, 0xE4, 
-    0xEA, 0xF4, 0xFF, 0x07, 0x07, 0xFE, 0xF2, 0xE8, 0xE6, 0xEA, 0xF3, 0xFC, 
-    0x02, 0x02, 0xFD, 0xF3, 0xEA, 0xE3, 0xE2, 0xE7, 0xF0, 0xF6, 0xF5, 0xEB, 
-    0xDF, 0xD7, 0xD7, 0xDF, 0xEB, 0xF8, 0x01, 0x04, 0x00, 0xFB, 0xF9, 0xFC, 
-    0x01, 0x06, 0x0A, 0x0B, 0x07, 0x01, 0xFC, 0xFC, 0xFE, 0x00, 0x03, 0x05, 
-    0x04, 0xFE, 0xF4, 0xEA, 0xE6, 0xEC, 0xF6, 0x01, 0x07, 0x06, 0xFE, 0xF2, 
-    0xE9, 0xE7, 0xEC, 0xF4, 0xFE, 0x06, 0x0A, 0x06, 0xFE, 0xF7, 0xF3, 0xF6, 
-    0xFC, 0x04, 0x09, 0x0D, 0x0B, 0x06, 0x01, 0xFE, 0x02, 0x08, 0x11, 0x17, 
-    0x1A, 0x18, 0x12, 0x0B, 0x07, 0x06, 0x08, 0x09, 0x07, 0x04, 0x00, 0xFD, 
-    0xFA, 0xF9, 0xF9, 0xF8, 0xF6, 0xF4, 0xF0, 0xED, 0xEA, 0xE6, 0xE4, 0xE5, 
-    0xE9, 0xED, 0xF1, 0xF6, 0xF9, 0xF8, 0xF1, 0xEB, 0xE8, 0xEB, 0xEF, 0xF1, 
-    0xEF, 0xEB, 0xE9, 0xE5, 0xE2, 0xDE, 0xDA, 0xD7, 0xD8, 0xDB, 0xE0, 0xE0, 
-    0xDC, 0xD6, 0xD4, 0xD7, 0xE1, 0xEA, 0xF2, 0xF7, 0xF4, 0xEE, 0xE6, 0xE3, 
-    0xE5, 0xEA, 0xF1, 0xF7, 0xF9, 0xF5, 0xED, 0xE3, 0xDB, 0xD5, 0xD2, 0xD6, 
-    0xDE, 0xE6, 0xE8, 0xE2, 0xD8, 0xD0, 0xD5, 0xE4, 0xF8, 0x09, 0x14, 0x17, 
-    0x0F, 0x05, 0xFE, 0xFD, 0x00, 0x07, 0x10, 0x16, 0x16, 0x0E, 0x04, 0xFE, 
-    0x00, 0x06, 0x0F, 0x18, 0x1E, 0x1F, 0x18, 0x0D, 0x05, 0x04, 0x0C, 0x18, 
-    0x1F, 0x20, 0x1A, 0x0F, 0x04, 0xFF, 0x01, 0x09, 0x12, 0x19, 0x19, 0x14, 
-    0x0A, 0x02, 0xFF, 0x04, 0x0C, 0x16, 0x1C, 0x1E, 0x1B, 0x13, 0x09, 0x01, 
-    0xFF, 0x04, 0x0D, 0x14, 0x15, 0x0D, 0x00, 0xF4, 0xEE, 0xF2, 0xFD, 0x08, 
-    0x10, 0x11, 0x0E, 0x09, 0x07, 0x09, 0x10, 0x17, 0x1D, 0x22, 0x26, 0x2A, 
-    0x2A, 0x24, 0x1B, 0x17, 0x18, 0x1D, 0x21, 0x21, 0x1E, 0x18, 0x0E, 0x08, 
-    0x06, 0x07, 0x07, 0x03, 0xFD, 0xF6, 0xF1, 0xEE, 0xEA, 0xE8, 0xE7, 0xE7, 
-    0xEB, 0xF5, 0x01, 0x09, 0x08, 0x01, 0xFB, 0xFA, 0xFD, 0x02, 0x06, 0x09, 
-    0x08, 0x04, 0x02, 0x02, 0x03, 0x05, 0x06, 0x08, 0x0B, 0x0C, 0x0B, 0x08, 
-    0x05, 0x04, 0x03, 0x06, 0x0D, 0x16, 0x19, 0x14, 0x09, 0xFE, 0xFB, 0xFF, 
-    0x07, 0x10, 0x15, 0x13, 0x0A, 0xFF, 0xF5, 0xF1, 0xF2, 0xF9, 0x05, 0x0E, 
-    0x11, 0x0C, 0x04, 0xFD, 0xF9, 0xF8, 0xFA, 0xFE, 0x04, 0x07, 0x02, 0xF5, 
-    0xE7, 0xE2, 0xEA, 0xF9, 0x07, 0x0D, 0x0B, 0x01, 0xF5, 0xEB, 0xE5, 0xE7, 
-    0xEE, 0xF8, 0xFE, 0xFD, 0xF7, 0xF0, 0xEF, 0xF2, 0xF6, 0xFA, 0x01, 0x08, 
-    0x0B, 0x06, 0xFB, 0xEE, 0xE9, 0xEE, 0xF9, 0x03, 0x08, 0x05, 0xFD, 0xF2, 
-    0xEB, 0xEB, 0xF1, 0xFA, 0xFE, 0xFC, 0xF5, 0xED, 0xE8, 0xE8, 0xEC, 0xF1, 
-    0xF4, 0xF5, 0xF6, 0xF3, 0xEC, 0xE3, 0xDB, 0xDA, 0xE1, 0xEC, 0xF6, 0xFB, 
-    0xFA, 0xF3, 0xEA, 0xE7, 0xED, 0xF8, 0x03, 0x08, 0x06, 0x03, 0xFF, 0xFB, 
-    0xF7, 0xF4, 0xF5, 0xF4, 0xF2, 0xF2, 0xF4, 0xF4, 0xF0, 0xE9, 0xE2, 0xE1, 
-    0xE3, 0xE6, 0xE7, 0xE7, 0xE3, 0xDE, 0xDB, 0xDE, 0xE3, 0xE9, 0xED, 0xF1, 
-    0xF3, 0xF3, 0xF2, 0xF2, 0xF1, 0xEF, 0xEB, 0xE6, 0xE6, 0xE9, 0xED, 0xEC, 
-    0xE6, 0xDE, 0xD8, 0xD9, 0xDF, 0xE9, 0xF2, 0xF9, 0xFC, 0xFF, 0x02, 0x04, 
-    0x04, 0x05, 0x07, 0x09, 0x09, 0x08, 0x06, 0x04, 0x02, 0x00, 0xFD, 0xFD, 
-    0x01, 0x05, 0x04, 0xFD, 0xF3, 0xEE, 0xF2, 0xFC, 0x06, 0x0C, 0x0C, 0x07, 
-    0xFF, 0xF7, 0xF3, 0xF7, 0x00, 0x0A, 0x10, 0x13, 0x11, 0x0D, 0x0A, 0x0C, 
-    0x10, 0x13, 0x14, 0x19, 0x1D, 0x1B, 0x12, 0x06, 0x00, 0x03, 0x10, 0x1E, 
-    0x28, 0x2A, 0x20, 0x12, 0x06, 0x01, 0x04, 0x0B, 0x10, 0x12, 0x0F, 0x0A, 
-    0x06, 0x04, 0x08, 0x0F, 0x16, 0x1D, 0x25, 0x2A, 0x26, 0x1B, 0x0D, 0x04, 
-    0x06, 0x0F, 0x1A, 0x1F, 0x1D, 0x15, 0x0A, 0x03, 0x03, 0x07, 0x0D, 0x12, 
-    0x0F, 0x0A, 0x04, 0xFF, 0xFC, 0xFB, 0xFC, 0xFB, 0xFA, 0xF7, 0xF4, 0xF0, 
-    0xED, 0xEA, 0xEB, 0xF2, 0xFD, 0x09, 0x12, 0x16, 0x11, 0x0A, 0x04, 0x01, 
-    0x03, 0x05, 0x06, 0x06, 0x03, 0x00, 0xFD, 0xFB, 0xFE, 0x01, 0x01, 0xFE, 
-    0xFD, 0xFD, 0xFE, 0xFC, 0xF6, 0xEF, 0xEC, 0xF0, 0xF8, 0x01, 0x05, 0x07, 
-    0x06, 0x05, 0x06, 0x07, 0x07, 0x05, 0x04, 0x03, 0xFF, 0xFC, 0xFB, 0xFD, 
-    0x00, 0xFE, 0xFD, 0xFD, 0x04, 0x0C, 0x0F, 0x0C, 0x04, 0xFB, 0xF8, 0xFB, 
-    0x03, 0x0A, 0x0B, 0x07, 0x02, 0xFD, 0xFE, 0x00, 0x03, 0x05, 0x05, 0x04, 
-    0x01, 0xFD, 0xF9, 0xF7, 0xF6, 0xF5, 0xF6, 0xFB, 0x00, 0x00, 0xF9, 0xEE, 
-    0xE5, 0xE6, 0xEF, 0xFC, 0x05, 0x06, 0x00, 0xF8, 0xF5, 0xF7, 0xFC, 0xFF, 
-    0x01, 0x01, 0x01, 0xFE, 0xF6, 0xED, 0xE7, 0xE6, 0xE8, 0xEB, 0xF0, 0xF4, 
-    0xF2, 0xE9, 0xDC, 0xD5, 0xD5, 0xDE, 0xEA, 0xF5, 0xFA, 0xF7, 0xEE, 0xE7, 
-    0xE6, 0xE8, 0xEB, 0xEE, 0xF3, 0xF5, 0xF1, 0xEB, 0xE7, 0xE8, 0xED, 0xF0, 
-    0xF0, 0xED, 0xEC, 0xEA, 0xE6, 0xE0, 0xDB, 0xDD, 0xE7, 0xF2, 0xFA, 0xFB, 
-    0xF7, 0xF4, 0xF2, 0xF2, 0xF4, 0xF6, 0xF7, 0xF7, 0xF4, 0xF1, 0xEF, 0xF0, 
-    0xF8, 0x02, 0x07, 0x08, 0x05, 0x04, 0x05, 0x01, 0xF8, 0xEE, 0xE9, 0xEA, 
-    0xEE, 0xF1, 0xF0, 0xED, 0xEB, 0xEB, 0xF1, 0xFB, 0x05, 0x0D, 0x10, 0x0E, 
-    0x08, 0x03, 0x00, 0x01, 0x04, 0x07, 0x06, 0x03, 0x02, 0x04, 0x04, 0xFF, 
-    0xF7, 0xF1, 0xF1, 0xF7, 0xFD, 0x01, 0x01, 0xFC, 0xF9, 0xF9, 0xFA, 0xFC, 
-    0xFB, 0xFC, 0xFD, 0x00, 0x03, 0x05, 0x06, 0x07, 0x07, 0x0A, 0x0E, 0x15, 
-    0x1C, 0x1D, 0x18, 0x0F, 0x08, 0x07, 0x0B, 0x13, 0x17, 0x17, 0x13, 0x0F, 
-    0x0B, 0x06, 0x03, 0x01, 0x00, 0x01, 0x03, 0x05, 0x05, 0x03, 0x04, 0x08, 
-    0x0D, 0x0F, 0x11, 0x14, 0x16, 0x14, 0x11, 0x0E, 0x0F, 0x16, 0x1D, 0x23, 
-    0x25, 0x22, 0x1C, 0x16, 0x13, 0x14, 0x18, 0x1D, 0x20, 0x21, 0x1C, 0x16, 
-    0x10, 0x0D, 0x0E, 0x0D, 0x0A, 0x06, 0x03, 0x00, 0xFA, 0xF0, 0xE9, 0xEA, 
-    0xF1, 0xFE, 0x09, 0x0E, 0x0D, 0x07, 0x03, 0x03, 0x07, 0x0E, 0x14, 0x15, 
-    0x10, 0x07, 0xFF, 0xFA, 0xFA, 0xFE, 0x03, 0x07, 0x09, 0x0C, 0x0D, 0x0C, 
-    0x06, 0xFD, 0xF3, 0xF1, 0xF6, 0xFC, 0xFF, 0xFD, 0xF8, 0xF7, 0xF9, 0xFF, 
-    0x06, 0x0A, 0x0B, 0x07, 0x02, 0xFD, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFA, 
-    0xFC, 0xFF, 0xFE, 0xF9, 0xEF, 0xE9, 0xE9, 0xEE, 0xF5, 0xF7, 0xF6, 0xF3, 
-    0xF1, 0xF2, 0xF6, 0xF9, 0xFB, 0xFC, 0xFE, 0x01, 0x01, 0x02, 0x00, 0x00, 
-    0x02, 0x04, 0x06, 0x07, 0x08, 0x07, 0x03, 0xFF, 0xFB, 0xF9, 0xFB, 0x00, 
-    0x06, 0x0D, 0x11, 0x11, 0x0D, 0x08, 0x06, 0x05, 0x08, 0x0B, 0x0E, 0x0D, 
-    0x07, 0x01, 0xFD, 0xFD, 0xFF, 0xFE, 0xFB, 0xF9, 0xFA, 0xF7, 0xF1, 0xE6, 
-    0xDD, 0xD9, 0xDD, 0xE6, 0xEC, 0xED, 0xE7, 0xDF, 0xD8, 0xD7, 0xD8, 0xDC, 
-    0xE0, 0xE2, 0xE2, 0xE0, 0xE0, 0xE3, 0xE9, 0xEF, 0xF2, 0xF2, 0xF2, 0xF2, 
-    0xF0, 0xE8, 0xDE, 0xD7, 0xD8, 0xE2, 0xEF, 0xF8, 0xFA, 0xF8, 0xF7, 0xF7, 
-    0xFA, 0xFF, 0x05, 0x0A, 0x0A, 0x05, 0xFB, 0xF3, 0xEF, 0xF1, 0xF4, 0xF9, 
-    0xFC, 0x00, 0x03, 0x00, 0xF6, 0xEA, 0xE3, 0xE2, 0xE7, 0xED, 0xEF, 0xEC, 
-    0xE5, 0xDE, 0xDC, 0xE0, 0xE7, 0xEE, 0xF2, 0xF6, 0xF9, 0xFA, 0xFA, 0xF9, 
-    0xFB, 0xFF, 0x03, 0x07, 0x0B, 0x0E, 0x0E, 0x09, 0x02, 0xFF, 0x01, 0x07, 
-    0x0C, 0x0E, 0x0F, 0x0E, 0x0C, 0x0A, 0x07, 0x03, 0x00, 0xFE, 0x01, 0x05, 
-    0x09, 0x09, 0x08, 0x0A, 0x0F, 0x14, 0x16, 0x14, 0x14, 0x17, 0x1A, 0x1A, 
-    0x17, 0x13, 0x10, 0x10, 0x11, 0x10, 0x0E, 0x0A, 0x05, 0x00, 0xFD, 0xFF, 
-    0x01, 0x03, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0xFA, 0xF7, 0xFB, 
-    0x04, 0x0A, 0x0A, 0x03, 0x00, 0x02, 0x0A, 0x13, 0x1A, 0x1C, 0x1C, 0x1A, 
-    0x19, 0x19, 0x19, 0x18, 0x15, 0x11, 0x0F, 0x0E, 0x0D, 0x0A, 0x08, 0x08, 
-    0x09, 0x0C, 0x10, 0x13, 0x11, 0x08, 0xFB, 0xEF, 0xEB, 0xEC, 0xF2, 0xF9, 
-    0xFE, 0xFF, 0xFF, 0x00, 0x06, 0x0E, 0x14, 0x15, 0x15, 0x14, 0x14, 0x12, 
-    0x0E, 0x0B, 0x0A, 0x0A, 0x0C, 0x0F, 0x14, 0x17, 0x14, 0x0D, 0x05, 0x02, 
-    0x06, 0x0C, 0x10, 0x0C, 0x03, 0xFB, 0xF8, 0xF9, 0xFC, 0xFC, 0xFD, 0xFE, 
-    0x00, 0x03, 0x04, 0x01, 0xFD, 0xFC, 0xFD, 0xFF, 0xFD, 0xF9, 0xF5, 0xF0, 
-    0xEC, 0xE7, 0xE3, 0xE3, 0xE7, 0xEE, 0xF3, 0xF4, 0xF4, 0xF3, 0xF4, 0xF4, 
-    0xF6, 0xF8, 0xF9, 0xF8, 0xF9, 0xFB, 0xFF, 0x03, 0x08, 0x0C, 0x0E, 0x0E, 
-    0x12, 0x19, 0x1D, 0x1C, 0x14, 0x0C, 0x09, 0x0B, 0x0E, 0x0F, 0x0C, 0x06, 
-    0x00, 0xFC, 0xFA, 0xF9, 0xF8, 0xF6, 0xF5, 0xF5, 0xF7, 0xFB, 0xFE, 0xFE, 
-    0xFB, 0xF6, 0xF3, 0xF2, 0xF5, 0xF6, 0xF2, 0xEC, 0xE6, 0xE4, 0xE5, 0xE8, 
-    0xEA, 0xEA, 0xE9, 0xE9, 0xE8, 0xE7, 0xE6, 0xE4, 0xE0, 0xDE, 0xDE, 0xE0, 
-    0xE3, 0xE6, 0xE8, 0xEB, 0xEE, 0xF1, 0xF7, 0x02, 0x09, 0x09, 0x02, 0xF6, 
-    0xF0, 0xF1, 0xF7, 0xFC, 0xFD, 0xFA, 0xF8, 0xF8, 0xFA, 0xFC, 0xFE, 0x00, 
-    0x02, 0x05, 0x07, 0x07, 0x03, 0xFD, 0xF9, 0xF6, 0xF2, 0xF0, 0xEF, 0xF0, 
-    0xEE, 0xE9, 0xE4, 0xE4, 0xE6, 0xEA, 0xEE, 0xEE, 0xEC, 0xE8, 0xE4, 0xE0, 
-    0xDE, 0xDE, 0xE0, 0xE6, 0xEE, 0xF5, 0xFB, 0xFE, 0x01, 0x03, 0x04, 0x03, 
-    0x01, 0x02, 0x06, 0x08, 0x06, 0x01, 0xFD, 0xFD, 0x02, 0x08, 0x0B, 0x0A, 
-    0x06, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFD, 0xFB, 0xF8, 0xF7, 0xF8, 
-    0xFA, 0xFD, 0x00, 0x00, 0x01, 0x05, 0x09, 0x0C, 0x0A, 0x08, 0x09, 0x10, 
-    0x17, 0x1C, 0x1C, 0x19, 0x18, 0x16, 0x15, 0x14, 0x12, 0x0F, 0x0D, 0x0D, 
-    0x0E, 0x0F, 0x0E, 0x10, 0x12, 0x13, 0x0F, 0x0A, 0x0B, 0x0E, 0x0E, 0x08, 
-    0x01, 0xFC, 0xFC, 0x00, 0x06, 0x0A, 0x0D, 0x10, 0x13, 0x15, 0x15, 0x14, 
-    0x13, 0x12, 0x11, 0x10, 0x11, 0x10, 0x11, 0x0F, 0x0C, 0x09, 0x07, 0x0B, 
-    0x11, 0x13, 0x11, 0x0B, 0x04, 0xFE, 0xFC, 0xFF, 0x03, 0x04, 0x04, 0x03, 
-    0x03, 0x04, 0x07, 0x0A, 0x0C, 0x0D, 0x0F, 0x12, 0x15, 0x16, 0x15, 0x12, 
-    0x0D, 0x09, 0x09, 0x0B, 0x0C, 0x0A, 0x06, 0x03, 0x02, 0x07, 0x0C, 0x0E, 
-    0x0C, 0x09, 0x06, 0x02, 0xFD, 0xF8, 0xF7, 0xF8, 0xF9, 0xFC, 0xFD, 0xFD, 
-    0xFE, 0xFD, 0xFB, 0xF6, 0xF2, 0xF1, 0xF4, 0xF6, 0xF2, 0xE9, 0xE1, 0xDF, 
-    0xE3, 0xEB, 0xF1, 0xF3, 0xF5, 0xF6, 0xF7, 0xF7, 0xF8, 0xFB, 0xFF, 0x03, 
-    0x05, 0x06, 0x04, 0x03, 0x04, 0x06, 0x06, 0x04, 0x03, 0x07, 0x0A, 0x0A, 
-    0x08, 0x04, 0x06, 0x09, 0x0D, 0x0F, 0x0E, 0x0D, 0x0E, 0x0D, 0x0A, 0x03, 
-    0xFC, 0xF5, 0xF2, 0xF0, 0xEF, 0xEE, 0xED, 0xEF, 0xF2, 0xF2, 0xF0, 0xED, 
-    0xED, 0xEF, 0xF2, 0xF3, 0xF3, 0xF1, 0xEF, 0xF3, 0xF8, 0xFB, 0xFD, 0xFA, 
-    0xF6, 0xF2, 0xEF, 0xED, 0xEA, 0xE6, 0xE3, 0xE0, 0xDD, 0xDC, 0xDC, 0xDF, 
-    0xDF, 0xDC, 0xD9, 0xD9, 0xDF, 0xE5, 0xE9, 0xE9, 0xE7, 0xE8, 0xED, 0xF2, 
-    0xF4, 0xF3, 0xF3, 0xF5, 0xF7, 0xF8, 0xF8, 0xF7, 0xF9, 0xFD, 0x02, 0x05, 
-    0x07, 0x09, 0x08, 0x06, 0xFF, 0xF9, 0xF6, 0xF9, 0xFC, 0xFB, 0xF5, 0xEF, 
-    0xEB, 0xEC, 0xF0, 0xF2, 0xF3, 0xF3, 0xF2, 0xEF, 0xEC, 0xE8, 0xE5, 0xE1, 
-    0xDE, 0xDD, 0xDE, 0xE1, 0xE4, 0xE8, 0xEA, 0xEB, 0xEA, 0xEC, 0xF3, 0xFA, 
-    0xFC, 0xF9, 0xF6, 0xF5, 0xF7, 0xFB, 0xFF, 0x01, 0x03, 0x05, 0x08, 0x09, 
-    0x0A, 0x07, 0x04, 0x02, 0x04, 0x09, 0x0A, 0x09, 0x09, 0x0C, 0x0F, 0x13, 
-    0x15, 0x17, 0x19, 0x1B, 0x1A, 0x17, 0x15, 0x14, 0x16, 0x1A, 0x1D, 0x1E, 
-    0x1F, 0x1E, 0x1D, 0x19, 0x14, 0x0F, 0x0A, 0x08, 0x04, 0x01, 0x01, 0x04, 
-    0x09, 0x09, 0x03, 0xFB, 0xF8, 0xFC, 0x00, 0x00, 0xFA, 0xF3, 0xF2, 0xF6, 
-    0xFD, 0x00, 0x01, 0x03, 0x05, 0x06, 0x05, 0x04, 0x03, 0x03, 0x02, 0x03, 
-    0x05, 0x0A, 0x0E, 0x10, 0x10, 0x10, 0x0E, 0x10, 0x15, 0x1A, 0x1E, 0x1D, 
-    0x1D, 0x1D, 0x1F, 0x21, 0x1F, 0x1B, 0x17, 0x14, 0x13, 0x12, 0x10, 0x0D, 
-    0x0A, 0x09, 0x0B, 0x0E, 0x12, 0x14, 0x14, 0x12, 0x0D, 0x06, 0x00, 0x02, 
-    0x06, 0x07, 0x00, 0xF4, 0xEC, 0xEC, 0xF0, 0xF4, 0xF5, 0xF5, 0xF7, 0xFA, 
-    0xFB, 0xFB, 0xF8, 0xF5, 0xF5, 0xFB, 0x02, 0x09, 0x0D, 0x10, 0x13, 0x13, 
-    0x14, 0x12, 0x12, 0x10, 0x0D, 0x07, 0xFE, 0xF8, 0xF6, 0xF6, 0xF6, 0xF4, 
-    0xF4, 0xF8, 0xFA, 0xF9, 0xF3, 0xEC, 0xEA, 0xEC, 0xF1, 0xF5, 0xF5, 0xF6, 
-    0xFA, 0xFD, 0x00, 0x00, 0xFF, 0x01, 0x07, 0x0C, 0x0D, 0x08, 0x02, 0x00, 
-    0x02, 0x09, 0x0E, 0x10, 0x0D, 0x09, 0x07, 0x05, 0x06, 0x06, 0x04, 0x00, 
-    0xFE, 0xFD, 0xFC, 0xFD, 0xFE, 0xFC, 0xFA, 0xF7, 0xF5, 0xF9, 0xFD, 0xFD, 
-    0xF6, 0xEE, 0xEA, 0xED, 0xF3, 0xF5, 0xF4, 0xF3, 0xF5, 0xF7, 0xF7, 0xF3, 
-    0xEE, 0xEB, 0xEB, 0xED, 0xEC, 0xEB, 0xE9, 0xE9, 0xE7, 0xE3, 0xDF, 0xDE, 
-    0xE0, 0xE4, 0xE4, 0xDE, 0xD9, 0xD7, 0xDA, 0xE1, 0xE5, 0xE7, 0xEA, 0xED, 
-    0xF3, 0xFA, 0x00, 0x02, 0x03, 0x04, 0x08, 0x0B, 0x0D, 0x0E, 0x0D, 0x0C, 
-    0x08, 0x04, 0x02, 0x05, 0x09, 0x0A, 0x05, 0xFE, 0xF6, 0xF2, 0xF0, 0xED, 
-    0xEB, 0xEB, 0xED, 0xEF, 0xEE, 0xEA, 0xE3, 0xDF, 0xDF, 0xE2, 0xE4, 0xE4, 
-    0xE2, 0xE2, 0xE4, 0xE6, 0xE5, 0xE3, 0xE1, 0xE2, 0xE4, 0xE4, 0xE0, 0xDC, 
-    0xDC, 0xE0, 0xE7, 0xEF, 0xF6, 0xFB, 0x00, 0x03, 0x05, 0x06, 0x07, 0x0A, 
-    0x10, 0x14, 0x18, 0x1A, 0x1B, 0x1B, 0x19, 0x14, 0x10, 0x11, 0x19, 0x21, 
-    0x22, 0x1C, 0x16, 0x13, 0x16, 0x1A, 0x1C, 0x1D, 0x1E, 0x1E, 0x1C, 0x17, 
-    0x12, 0x0E, 0x0C, 0x0D, 0x0F, 0x0F, 0x0C, 0x07, 0x03, 0xFD, 0xF7, 0xF1, 
-    0xEE, 0xF1, 0xF6, 0xFA, 0xFA, 0xF9, 0xF8, 0xFA, 0xFD, 0x01, 0x07, 0x0E, 
-    0x14, 0x18, 0x16, 0x11, 0x0A, 0x06, 0x06, 0x0A, 0x0E, 0x11, 0x14, 0x15, 
-    0x14, 0x0F, 0x0B, 0x0A, 0x10, 0x17, 0x19, 0x15, 0x0D, 0x08, 0x08, 0x0C, 
-    0x12, 0x15, 0x18, 0x1A, 0x1B, 0x1A, 0x17, 0x14, 0x11, 0x0F, 0x11, 0x13, 
-    0x12, 0x11, 0x0F, 0x0D, 0x0A, 0x05, 0x00, 0xFD, 0xFF, 0x00, 0xFF, 0xFC, 
-    0xF9, 0xF7, 0xF8, 0xF9, 0xF9, 0xFB, 0xFF, 0x01, 0xFE, 0xF9, 0xF3, 0xF0, 
-    0xF1, 0xF5, 0xFA, 0xFE, 0x01, 0x02, 0x05, 0x06, 0x05, 0x01, 0x01, 0x06, 
-    0x0C, 0x0E, 0x08, 0x01, 0xFE, 0x00, 0x02, 0x01, 0x01, 0x02, 0x04, 0x04, 
-    0x02, 0xFF, 0xFA, 0xF7, 0xF5, 0xF5, 0xF6, 0xFA, 0xFC, 0xFB, 0xFA, 0xF5, 
-    0xF3, 0xF5, 0xFD, 0x07, 0x0C, 0x0E, 0x0B, 0x09, 0x09, 0x0A, 0x0C, 0x0E, 
-    0x11, 0x14, 0x14, 0x10, 0x0A, 0x05, 0x02, 0x04, 0x07, 0x08, 0x07, 0x03, 
-    0xFE, 0xF9, 0xF4, 0xF0, 0xEC, 0xEC, 0xF1, 0xF6, 0xF7, 0xF4, 0xF0, 0xED, 
-    0xEF, 0xF1, 0xF5, 0xF8, 0xFB, 0xFC, 0xFA, 0xF5, 0xEE, 0xE7, 0xE0, 0xDD, 
-    0xDE, 0xE1, 0xE3, 0xE2, 0xE1, 0xDE, 0xDC, 0xDC, 0xDF, 0xE5, 0xEB, 0xED, 
-    0xEB, 0xE6, 0xE4, 0xE5, 0xE8, 0xEE, 0xF3, 0xF8, 0xFB, 0xFA, 0xF6, 0xF1, 
-    0xEE, 0xF0, 0xF5, 0xFA, 0xFD, 0xFF, 0x00, 0x01, 0x03, 0x02, 0x00, 0xFE, 
-    0x00, 0x04, 0x06, 0x03, 0xFC, 0xF8, 0xF8, 0xFA, 0xFA, 0xFB, 0xFB, 0xFB, 
-    0xF8, 0xF1, 0xEA, 0xE6, 0xE3, 0xE3, 0xE6, 0xE9, 0xEE, 0xF2, 0xF3, 0xF1, 
-    0xF0, 0xED, 0xEB, 0xED, 0xF0, 0xF1, 0xEF, 0xE9, 0xE5, 0xE4, 0xE8, 0xEC, 
-    0xEF, 0xF3, 0xF9, 0xFE, 0x02, 0x02, 0x00, 0xFD, 0xFB, 0xFA, 0xFD, 0x00, 
-    0x03, 0x07, 0x06, 0x0C, 0x0F, 0x0B, 0x08, 0x0D, 0x10, 0x0F, 0x0B, 0x04, 
-    0x01, 0x02, 0x04, 0x07, 0x0C, 0x14, 0x15, 0x0C, 0x06, 0xFB, 0xFE, 0x06, 
-    0x09, 0x0E, 0x10, 0x16, 0x17, 0x19, 0x15, 0x0C, 0x0A, 0x0D, 0x17, 0x21, 
-    0x21, 0x1C, 0x18, 0x17, 0x15, 0x15, 0x0C, 0x0C, 0x10, 0x13, 0x19, 0x14, 
-    0x11, 0x07, 0x04, 0xFC, 0xFC, 0x04, 0x06, 0x0C, 0x0E, 0x12, 0x15, 0x17, 
-    0x19, 0x19, 0x10, 0x0E, 0x0B, 0x07, 0x0B, 0x06, 0x02, 0x02, 0x06, 0x09, 
-    0x0C, 0x0B, 0x03, 0x0C, 0x11, 0x17, 0x12, 0x0D, 0x0D, 0x0C, 0x08, 0x05, 
-    0x0C, 0x0B, 0x15, 0x1C, 0x27, 0x2C, 0x29, 0x27, 0x1A, 0x14, 0x14, 0x0E, 
-    0x1A, 0x1E, 0x1C, 0x17, 0x0C, 0x0E, 0x08, 0x02, 0xF9, 0xF5, 0xF7, 0xFF, 
-    0x00, 0xFA, 0xF1, 0xEC, 0xE7, 0xE3, 0xE5, 0xE8, 0xE8, 0xE9, 0xEB, 0xE1, 
-    0xDE, 0xD2, 0xD0, 0xCD, 0xC7, 0xCA, 0xCD, 0xD3, 0xD4, 0xD5, 0xD5, 0xD8, 
-    0xDA, 0xDC, 0xDD, 0xDF, 0xE3, 0xEB, 0xEE, 0xF7, 0xFA, 0xF4, 0xF3, 0xF1, 
-    0xF2, 0xF2, 0xF9, 0xFF, 0x0B, 0x0F, 0x0D, 0x0C, 0x0C, 0x0A, 0x02, 0xFB, 
-    0xFB, 0x00, 0x0C, 0x0E, 0x0D, 0x0A, 0x0B, 0x0D, 0x07, 0x00, 0xFA, 0xFD, 
-    0x02, 0x0D, 0x0F, 0x08, 0xFA, 0xEF, 0xE7, 0xE9, 0xF0, 0xF7, 0x01, 0x06, 
-    0x12, 0x17, 0x16, 0x10, 0x0A, 0x00, 0x01, 0x02, 0x07, 0x0E, 0x09, 0x02, 
-    0xFA, 0xF9, 0xF7, 0xF2, 0xED, 0xF1, 0xF9, 0x04, 0x03, 0xF8, 0xED, 0xE7, 
-    0xE6, 0xE3, 0xED, 0xF2, 0xFC, 0xFD, 0xFC, 0xFC, 0xF9, 0xF8, 0xF6, 0xF5, 
-    0xF2, 0xF4, 0xF1, 0xF3, 0xEE, 0xE2, 0xDC, 0xDD, 0xE5, 0xEB, 0xEF, 0xE8, 
-    0xE8, 0xF0, 0xFC, 0x01, 0xFC, 0xF5, 0xEC, 0xE9, 0xE6, 0xE4, 0xE1, 0xE1, 
-    0xE5, 0xEF, 0xF5, 0xF6, 0xF8, 0xEF, 0xEA, 0xE3, 0xE0, 0xE2, 0xE8, 0xEF, 
-    0xF0, 0xF3, 0xED, 0xE1, 0xD6, 0xD2, 0xD4, 0xD9, 0xE5, 0xEC, 0xEE, 0xEB, 
-    0xE7, 0xE2, 0xDD, 0xE0, 0xE9, 0xF8, 0x03, 0x0E, 0x13, 0x13, 0x13, 0x12, 
-    0x0F, 0x0D, 0x0E, 0x18, 0x25, 0x2C, 0x30, 0x2E, 0x33, 0x39, 0x3F, 0x3E, 
-    0x37, 0x36, 0x3A, 0x40, 0x43, 0x40, 0x36, 0x33, 0x34, 0x38, 0x3C, 0x3C, 
-    0x39, 0x3B, 0x3E, 0x3E, 0x40, 0x3B, 0x38, 0x30, 0x26, 0x1C, 0x13, 0x0E, 
-    0x0A, 0x0A, 0x0A, 0x11, 0x16, 0x18, 0x18, 0x17, 0x16, 0x1A, 0x1C, 0x17, 
-    0x10, 0x02, 0xF7, 0xF2, 0xF0, 0xEF, 0xF3, 0xF6, 0xFF, 0x08, 0x10, 0x14, 
-    0x0F, 0x09, 0x04, 0x03, 0x05, 0x0B, 0x0E, 0x12, 0x12, 0x13, 0x12, 0x0A, 
-    0x06, 0xFF, 0x00, 0x07, 0x13, 0x19, 0x0F, 0xFD, 0xEA, 0xDF, 0xD9, 0xDD, 
-    0xE0, 0xE8, 0xF2, 0xF7, 0xFE, 0xFC, 0xFC, 0xF3, 0xEB, 0xE5, 0xE5, 0xE9, 
-    0xEB, 0xED, 0xE9, 0xE7, 0xE2, 0xDD, 0xD7, 0xD5, 0xD5, 0xDA, 0xE3, 0xE9, 
-    0xE5, 0xDD, 0xD5, 0xD2, 0xD6, 0xD9, 0xDB, 0xD9, 0xDF, 0xE8, 0xF1, 0xF3, 
-    0xF0, 0xE8, 0xDE, 0xD9, 0xD1, 0xD0, 0xCF, 0xD1, 0xD8, 0xDB, 0xDF, 0xE4, 
-    0xE4, 0xE3, 0xE0, 0xDE, 0xE4, 0xEF, 0xF7, 0xFA, 0xF5, 0xED, 0xE7, 0xE9, 
-    0xF0, 0xF8, 0xFD, 0x02, 0x09, 0x0E, 0x10, 0x0B, 0x02, 0xF9, 0xF8, 0xF9, 
-    0x01, 0x08, 0x0B, 0x0D, 0x0D, 0x11, 0x12, 0x12, 0x0D, 0x0B, 0x0E, 0x16, 
-    0x1F, 0x1C, 0x13, 0x05, 0xFD, 0xFB, 0xFC, 0x00, 0x02, 0x05, 0x0C, 0x13, 
-    0x14, 0x11, 0x0C, 0x03, 0xFD, 0xF9, 0xF8, 0xFA, 0xF9, 0xF9, 0xF8, 0xF7, 
-    0xF8, 0xF8, 0xF7, 0xF5, 0xF6, 0xFE, 0x0C, 0x1A, 0x1D, 0x16, 0x0A, 0x00, 
-    0xFF, 0x03, 0x06, 0x06, 0x08, 0x0B, 0x0F, 0x10, 0x0D, 0x09, 0x06, 0x03, 
-    0x01, 0x01, 0x02, 0x06, 0x08, 0x0D, 0x11, 0x11, 0x0A, 0x01, 0xFC, 0xFA, 
-    0xFE, 0x03, 0x03, 0xFD, 0xF4, 0xED, 0xEB, 0xEE, 0xEF, 0xEE, 0xF0, 0xF7, 
-    0x00, 0x04, 0x01, 0xF7, 0xEB, 0xE2, 0xDE, 0xE2, 0xE9, 0xF3, 0xFB, 0xFF, 
-    0x01, 0x00, 0xFE, 0xF9, 0xF3, 0xEE, 0xF0, 0xF9, 0x00, 0x02, 0xFA, 0xEF, 
-    0xE8, 0xEA, 0xF2, 0xFC, 0x05, 0x10, 0x1B, 0x24, 0x29, 0x29, 0x24, 0x1C, 
-    0x17, 0x14, 0x12, 0x12, 0x11, 0x12, 0x13, 0x14, 0x15, 0x13, 0x10, 0x0D, 
-    0x0D, 0x15, 0x22, 0x2E, 0x31, 0x2C, 0x23, 0x1C, 0x1A, 0x1C, 0x1E, 0x24, 
-    0x2D, 0x37, 0x3D, 0x3E, 0x3B, 0x2E, 0x21, 0x19, 0x16, 0x18, 0x1B, 0x1D, 
-    0x1F, 0x21, 0x24, 0x25, 0x21, 0x1D, 0x17, 0x17, 0x1F, 0x27, 0x29, 0x21, 
-    0x15, 0x09, 0x02, 0x01, 0x03, 0x07, 0x0D, 0x16, 0x1C, 0x1D, 0x1A, 0x15, 
-    0x0E, 0x07, 0x04, 0x03, 0x06, 0x0D, 0x13, 0x16, 0x14, 0x0C, 0x02, 0xF8, 
-    0xF0, 0xF0, 0xF8, 0x04, 0x09, 0x04, 0xF8, 0xEB, 0xE2, 0xE1, 0xE5, 0xEA, 
-    0xF0, 0xF8, 0x00, 0x03, 0xFF, 0xF6, 0xEA, 0xE0, 0xDB, 0xDC, 0xE0, 0xE4, 
-    0xE6, 0xE3, 0xDF, 0xDC, 0xDA, 0xD5, 0xCF, 0xC8, 0xC4, 0xC6, 0xCA, 0xCC, 
-    0xC8, 0xC2, 0xBB, 0xB5, 0xB3, 0xB4, 0xB8, 0xBF, 0xC9, 0xD2, 0xD6, 0xD4, 
-    0xCD, 0xC4, 0xBB, 0xB3, 0xB4, 0xBC, 0xC9, 0xD5, 0xDC, 0xDF, 0xDE, 0xDC, 
-    0xD6, 0xD1, 0xCE, 0xD3, 0xDE, 0xE7, 0xE7, 0xDD, 0xD0, 0xC4, 0xC2, 0xC5, 
-    0xCC, 0xD6, 0xE3, 0xEE, 0xF4, 0xF2, 0xEB, 0xE3, 0xDF, 0xDD, 0xDE, 0xE2, 
-    0xE6, 0xEA, 0xEC, 0xEC, 0xEA, 0xE9, 0xE6, 0xE4, 0xE2, 0xE3, 0xEB, 0xF5, 
-    0xFC, 0xFC, 0xF5, 0xEB, 0xE5, 0xE5, 0xE6, 0xEA, 0xF2, 0xFD, 0x08, 0x0B, 
-    0x08, 0x00, 0xF8, 0xF3, 0xF0, 0xF3, 0xF8, 0x00, 0x04, 0x08, 0x0A, 0x09, 
-    0x07, 0x02, 0x02, 0x05, 0x0C, 0x16, 0x1C, 0x1C, 0x15, 0x0D, 0x0A, 0x0D, 
-    0x12, 0x17, 0x1C, 0x23, 0x2E, 0x37, 0x3B, 0x3B, 0x35, 0x2F, 0x29, 0x27, 
-    0x2B, 0x33, 0x3F, 0x4A, 0x4F, 0x4E, 0x4B, 0x44, 0x3C, 0x35, 0x30, 0x32, 
-    0x38, 0x3C, 0x3C, 0x33, 0x26, 0x19, 0x13, 0x16, 0x1D, 0x29, 0x36, 0x3F, 
-    0x41, 0x3C, 0x30, 0x24, 0x1D, 0x19, 0x1A, 0x1B, 0x1D, 0x1C, 0x1B, 0x16, 
-    0x10, 0x09, 0x01, 0xFE, 0xFC, 0xFF, 0x05, 0x0D, 0x11, 0x0F, 0x0B, 0x09, 
-    0x09, 0x0C, 0x11, 0x19, 0x22, 0x29, 0x2E, 0x2E, 0x27, 0x1C, 0x0D, 0x00, 
-    0xF9, 0xF9, 0xFD, 0x04, 0x0A, 0x10, 0x13, 0x14, 0x12, 0x0E, 0x0B, 0x09, 
-    0x0D, 0x15, 0x19, 0x17, 0x0E, 0x03, 0xF9, 0xF7, 0xF8, 0xFD, 0x03, 0x0A, 
-    0x10, 0x11, 0x0D, 0x03, 0xF9, 0xF1, 0xEB, 0xEA, 0xEE, 0xF4, 0xFA, 0xFC, 
-    0xFA, 0xF6, 0xEF, 0xE7, 0xE2, 0xE0, 0xE1, 0xE7, 0xED, 0xEE, 0xE6, 0xD9, 
-    0xCB, 0xC2, 0xBF, 0xC3, 0xCA, 0xD3, 0xDE, 0xEA, 0xF2, 0xF3, 0xF0, 0xEB, 
-    0xE6, 0xE3, 0xE6, 0xEC, 0xF5, 0xFC, 0xFC, 0xF5, 0xEC, 0xE1, 0xD4, 0xCA, 
-    0xC4, 0xC5, 0xCB, 0xD2, 0xD3, 0xCD, 0xC4, 0xBE, 0xBE, 0xC4, 0xD0, 0xDF, 
-    0xED, 0xF6, 0xF8, 0xF4, 0xEC, 0xE4, 0xDE, 0xD9, 0xD5, 0xD4, 0xD5, 0xD8, 
-    0xD9, 0xDA, 0xD9, 0xD7, 0xD0, 0xC7, 0xBE, 0xBA, 0xBE, 0xC7, 0xCF, 0xCF, 
-    0xC8, 0xC2, 0xBE, 0xBE, 0xC3, 0xCB, 0xD6, 0xE3, 0xEB, 0xED, 0xE9, 0xE0, 
-    0xD6, 0xCD, 0xC9, 0xCF, 0xDB, 0xE7, 0xEF, 0xF1, 0xF0, 0xF1, 0xF3, 0xF4, 
-    0xF7, 0xFB, 0x00, 0x07, 0x0F, 0x13, 0x10, 0x07, 0xFF, 0xFE, 0x02, 0x0A, 
-    0x14, 0x1E, 0x22, 0x24, 0x22, 0x1D, 0x17, 0x11, 0x0A, 0x03, 0x01, 0x05, 
-    0x0E, 0x15, 0x1B, 0x1C, 0x1A, 0x14, 0x0E, 0x0B, 0x0B, 0x10, 0x17, 0x1D, 
-    0x1A, 0x10, 0x01, 0xF5, 0xF0, 0xF2, 0xFA, 0x05, 0x0E, 0x13, 0x13, 0x0D, 
-    0x06, 0x01, 0xFF, 0x01, 0x04, 0x0B, 0x13, 0x1A, 0x21, 0x24, 0x26, 0x27, 
-    0x27, 0x26, 0x21, 0x1D, 0x1F, 0x22, 0x25, 0x23, 0x1F, 0x1A, 0x16, 0x12, 
-    0x11, 0x17, 0x21, 0x2A, 0x2E, 0x2D, 0x29, 0x24, 0x20, 0x1D, 0x1C, 0x1D, 
-    0x1E, 0x1F, 0x20, 0x1F, 0x1C, 0x16, 0x0D, 0x05, 0xFF, 0xFB, 0xFF, 0x06, 
-    0x0C, 0x0B, 0x04, 0xFE, 0xFA, 0xF9, 0xFC, 0x03, 0x0F, 0x1A, 0x22, 0x23, 
-    0x1E, 0x15, 0x0A, 0x00, 0xF8, 0xF5, 0xF6, 0xF7, 0xF6, 0xF4, 0xF3, 0xF4, 
-    0xF7, 0xF7, 0xF6, 0xF3, 0xEF, 0xF0, 0xF5, 0xFB, 0xFE, 0xFE, 0xFD, 0xFA, 
-    0xF6, 0xF7, 0xFB, 0x03, 0x0D, 0x14, 0x17, 0x14, 0x0C, 0x01, 0xF7, 0xEE, 
-    0xEB, 0xED, 0xF4, 0xFD, 0x06, 0x0C, 0x0F, 0x0D, 0x08, 0x05, 0x05, 0x0A, 
-    0x12, 0x18, 0x19, 0x12, 0x07, 0xFC, 0xF3, 0xEF, 0xF2, 0xFB, 0x05, 0x0E, 
-    0x13, 0x14, 0x10, 0x09, 0x04, 0x01, 0x02, 0x05, 0x07, 0x0A, 0x0D, 0x0F, 
-    0x0F, 0x0E, 0x08, 0xFF, 0xF2, 0xE7, 0xE3, 0xE5, 0xE9, 0xEC, 0xEB, 0xE7, 
-    0xE1, 0xDB, 0xDC, 0xE5, 0xF7, 0x0A, 0x1A, 0x23, 0x23, 0x1C, 0x13, 0x0D, 
-    0x0B, 0x0F, 0x15, 0x1B, 0x1D, 0x1C, 0x18, 0x11, 0x09, 0x00, 0xF9, 0xF6, 
-    0xF7, 0xFB, 0x01, 0x02, 0xFD, 0xF6, 0xF0, 0xEB, 0xE9, 0xEB, 0xF1, 0xFB, 
-    0x06, 0x0F, 0x13, 0x11, 0x09, 0xFD, 0xF3, 0xEC, 0xEA, 0xED, 0xF2, 0xF7, 
-    0xFB, 0xFE, 0xFB, 0xF4, 0xE9, 0xE1, 0xDF, 0xE6, 0xF3, 0xFF, 0x05, 0x02, 
-    0xF8, 0xEA, 0xDE, 0xDB, 0xE2, 0xF2, 0x05, 0x14, 0x1B, 0x17, 0x0B, 0xFD, 
-    0xF2, 0xED, 0xF1, 0xF8, 0x00, 0x04, 0x02, 0xFE, 0xFA, 0xF6, 0xF1, 0xEF, 
-    0xF0, 0xF4, 0xFB, 0x00, 0xFF, 0xF5, 0xE9, 0xE0, 0xDA, 0xD8, 0xDE, 0xE8, 
-    0xF4, 0xFE, 0x01, 0x02, 0x00, 0xFA, 0xF4, 0xF1, 0xEF, 0xF3, 0xFA, 0x01, 
-    0x07, 0x0A, 0x0A, 0x05, 0xFD, 0xF4, 0xEE, 0xEA, 0xED, 0xF7, 0x01, 0x06, 
-    0x02, 0xF7, 0xEA, 0xDD, 0xD7, 0xDC, 0xEB, 0xFC, 0x08, 0x0B, 0x05, 0xF9, 
-    0xEB, 0xE0, 0xDB, 0xDD, 0xE5, 0xEF, 0xF5, 0xFA, 0xFA, 0xF8, 0xF2, 0xEA, 
-    0xE3, 0xE1, 0xE6, 0xF1, 0xFD, 0x05, 0x04, 0xFC, 0xF0, 0xE4, 0xD9, 0xD7, 
-    0xDE, 0xED, 0xFE, 0x0C, 0x11, 0x0E, 0x06, 0xFB, 0xF2, 0xEC, 0xED, 0xF5, 
-    0x01, 0x0A, 0x0E, 0x0D, 0x09, 0x03, 0xFC, 0xF7, 0xF4, 0xF9, 0x04, 0x0D, 
-    0x0E, 0x06, 0xFA, 0xEE, 0xE5, 0xE1, 0xE6, 0xF0, 0xFC, 0x05, 0x0A, 0x09, 
-    0x03, 0xFC, 0xF6, 0xF4, 0xF3, 0xF4, 0xF7, 0xFB, 0xFE, 0x01, 0x02, 0x04, 
-    0x03, 0x01, 0xFD, 0xFC, 0x03, 0x10, 0x1C, 0x21, 0x1C, 0x11, 0x02, 0xF5, 
-    0xF1, 0xF7, 0x06, 0x19, 0x28, 0x31, 0x32, 0x29, 0x1C, 0x0D, 0x04, 0x05, 
-    0x0F, 0x1E, 0x2A, 0x30, 0x2E, 0x23, 0x14, 0x04, 0xF9, 0xF5, 0xF9, 0x02, 
-    0x0B, 0x10, 0x0C, 0x00, 0xF2, 0xE6, 0xDF, 0xE3, 0xF1, 0x04, 0x16, 0x1F, 
-    0x1F, 0x18, 0x0E, 0x04, 0xFC, 0xF7, 0xF8, 0xFC, 0x03, 0x09, 0x0B, 0x0B, 
-    0x07, 0xFC, 0xEF, 0xE5, 0xE1, 0xE6, 0xF0, 0xFB, 0x00, 0xFD, 0xF4, 0xEA, 
-    0xE1, 0xDE, 0xE2, 0xEF, 0xFF, 0x0E, 0x17, 0x17, 0x0F, 0x04, 0xF9, 0xF0, 
-    0xEF, 0xF2, 0xFA, 0x02, 0x07, 0x08, 0x06, 0x01, 0xF9, 0xF2, 0xF0, 0xF4, 
-    0xFE, 0x0C, 0x15, 0x14, 0x0C, 0x01, 0xF4, 0xEA, 0xE8, 0xEE, 0xFE, 0x10, 
-    0x1E, 0x24, 0x21, 0x16, 0x07, 0xFB, 0xF6, 0xFA, 0x03, 0x0E, 0x16, 0x1B, 
-    0x18, 0x10, 0x04, 0xF8, 0xF0, 0xF0, 0xF8, 0x05, 0x0F, 0x0F, 0x01, 0xED, 
-    0xDA, 0xCC, 0xC9, 0xD1, 0xE2, 0xF5, 0x04, 0x0A, 0x09, 0x03, 0xFA, 0xF5, 
-    0xF5, 0xFC, 0x06, 0x10, 0x18, 0x1D, 0x1C, 0x17, 0x10, 0x07, 0xFF, 0xF9, 
-    0xF6, 0xFA, 0x01, 0x08, 0x0A, 0x06, 0x00, 0xF8, 0xF0, 0xEF, 0xF5, 0x03, 
-    0x15, 0x25, 0x2D, 0x2D, 0x23, 0x12, 0x03, 0xFB, 0xFD, 0x05, 0x0F, 0x16, 
-    0x18, 0x13, 0x09, 0xFB, 0xEC, 0xE2, 0xDF, 0xE9, 0xF9, 0x06, 0x09, 0x01, 
-    0xF0, 0xE0, 0xD2, 0xCF, 0xD8, 0xE9, 0xFB, 0x08, 0x0B, 0x05, 0xFA, 0xED, 
-    0xE3, 0xDE, 0xE1, 0xEB, 0xF7, 0x00, 0x06, 0x06, 0x05, 0x05, 0x04, 0x03, 
-    0x03, 0x09, 0x14, 0x20, 0x27, 0x26, 0x20, 0x17, 0x0B, 0x01, 0xFC, 0xFE, 
-    0x07, 0x12, 0x1A, 0x1C, 0x16, 0x0A, 0xFE, 0xF6, 0xF5, 0xFB, 0x06, 0x10, 
-    0x16, 0x18, 0x15, 0x10, 0x0C, 0x09, 0x08, 0x0B, 0x11, 0x1A, 0x22, 0x22, 
-    0x19, 0x0B, 0xFA, 0xEB, 0xE3, 0xE6, 0xF0, 0xFC, 0x07, 0x0D, 0x0C, 0x07, 
-    0x00, 0xF8, 0xF4, 0xF4, 0xFB, 0x05, 0x0E, 0x13, 0x13, 0x0E, 0x05, 0xFA, 
-    0xF0, 0xEB, 0xED, 0xF6, 0x03, 0x0C, 0x0A, 0x00, 0xF1, 0xE2, 0xD8, 0xD8, 
-    0xE2, 0xF4, 0x06, 0x13, 0x14, 0x0C, 0xFD, 0xED, 0xE5, 0xE4, 0xEC, 0xF9, 
-    0x03, 0x05, 0x01, 0xF8, 0xF1, 0xED, 0xEB, 0xEC, 0xED, 0xEF, 0xF3, 0xF8, 
-    0xFA, 0xF7, 0xF2, 0xEC, 0xE7, 0xE5, 0xE7, 0xED, 0xF6, 0xFE, 0x04, 0x05, 
-    0x00, 0xF8, 0xED, 0xE3, 0xDD, 0xDC, 0xDF, 0xE4, 0xE9, 0xEE, 0xEF, 0xEB, 
-    0xE2, 0xD7, 0xD1, 0xD2, 0xDC, 0xEA, 0xF7, 0xFD, 0xFB, 0xF2, 0xE6, 0xDD, 
-    0xDB, 0xE4, 0xF4, 0x07, 0x17, 0x1E, 0x1B, 0x11, 0x05, 0xFD, 0xFC, 0x03, 
-    0x0D, 0x16, 0x1B, 0x19, 0x13, 0x0B, 0x05, 0x02, 0x01, 0x02, 0x06, 0x0D, 
-    0x14, 0x17, 0x12, 0x07, 0xF8, 0xEB, 0xE2, 0xE0, 0xE7, 0xF2, 0xFF, 0x08, 
-    0x0A, 0x04, 0xFB, 0xF1, 0xEC, 0xED, 0xF3, 0xFC, 0x04, 0x09, 0x0B, 0x08, 
-    0x01, 0xF8, 0xEE, 0xE7, 0xE4, 0xE9, 0xF2, 0xFC, 0xFE, 0xF9, 0xF1, 0xE9, 
-    0xE4, 0xE4, 0xEA, 0xF5, 0x04, 0x11, 0x1B, 0x1E, 0x19, 0x10, 0x07, 0x02, 
-    0x03, 0x08, 0x0F, 0x16, 0x1B, 0x1E, 0x1D, 0x1A, 0x11, 0x05, 0xFC, 0xF8, 
-    0xFD, 0x07, 0x0F, 0x0F, 0x08, 0xFC, 0xEE, 0xE1, 0xDC, 0xE2, 0xF0, 0x02, 
-    0x0F, 0x13, 0x0C, 0xFE, 0xEF, 0xE6, 0xE5, 0xEC, 0xF7, 0x02, 0x09, 0x0C, 
-    0x09, 0x03, 0xFD, 0xF8, 0xF8, 0xFE, 0x06, 0x10, 0x18, 0x17, 0x0D, 0xFF, 
-    0xF4, 0xED, 0xED, 0xF5, 0xFF, 0x09, 0x0E, 0x0F, 0x09, 0xFF, 0xF6, 0xF2, 
-    0xF2, 0xF7, 0xFF, 0x08, 0x0E, 0x10, 0x0F, 0x0C, 0x0B, 0x09, 0x08, 0x06, 
-    0x09, 0x12, 0x1E, 0x28, 0x29, 0x22, 0x15, 0x07, 0xFB, 0xF5, 0xF7, 0x01, 
-    0x0F, 0x1C, 0x22, 0x21, 0x18, 0x0E, 0x06, 0x01, 0x02, 0x08, 0x12, 0x1A, 
-    0x1E, 0x1C, 0x16, 0x0D, 0x02, 0xF8, 0xF0, 0xEF, 0xF7, 0x02, 0x09, 0x07, 
-    0xFD, 0xF0, 0xE5, 0xDF, 0xDF, 0xE6, 0xF1, 0xFE, 0x08, 0x0B, 0x07, 0xFD, 
-    0xF2, 0xE7, 0xE0, 0xDF, 0xE3, 0xEB, 0xF3, 0xF8, 0xFA, 0xF9, 0xF2, 0xEA, 
-    0xE3, 0xE2, 0xEB, 0xF8, 0x04, 0x0A, 0x06, 0xFC, 0xF3, 0xEB, 0xEA, 0xEF, 
-    0xF9, 0x07, 0x13, 0x19, 0x16, 0x0D, 0x01, 0xF6, 0xEF, 0xED, 0xEF, 0xF5, 
-    0xF9, 0xFB, 0xFC, 0xFD, 0xFE, 0xFB, 0xF4, 0xEE, 0xED, 0xF4, 0xFF, 0x07, 
-    0x09, 0x03, 0xFA, 0xEF, 0xE2, 0xDB, 0xDC, 0xE7, 0xF7, 0x06, 0x0F, 0x0E, 
-    0x04, 0xF7, 0xEE, 0xEB, 0xF0, 0xFB, 0x07, 0x0F, 0x11, 0x0D, 0x06, 0x00, 
-    0xFB, 0xFC, 0x00, 0x08, 0x13, 0x1B, 0x19, 0x0C, 0xFB, 0xED, 0xE3, 0xE1, 
-    0xE6, 0xF2, 0x02, 0x11, 0x1A, 0x1B, 0x17, 0x0F, 0x09, 0x07, 0x08, 0x0E, 
-    0x16, 0x1C, 0x1D, 0x1A, 0x15, 0x0D, 0x04, 0xF9, 0xF0, 0xEB, 0xEB, 0xF3, 
-    0xFE, 0x04, 0x04, 0x00, 0xF9, 0xF1, 0xEE, 0xF0, 0xFA, 0x09, 0x19, 0x25, 
-    0x26, 0x22, 0x18, 0x0F, 0x07, 0x04, 0x05, 0x09, 0x0E, 0x10, 0x10, 0x0E, 
-    0x0B, 0x03, 0xFA, 0xF4, 0xF5, 0xFE, 0x09, 0x0E, 0x0A, 0x00, 0xF5, 0xEA, 
-    0xE4, 0xE5, 0xED, 0xFA, 0x07, 0x0E, 0x0D, 0x05, 0xF8, 0xEC, 0xE3, 0xE0, 
-    0xE1, 0xE8, 0xF1, 0xF8, 0xFD, 0xFF, 0xFF, 0xFC, 0xF8, 0xF6, 0xF8, 0x00, 
-    0x0A, 0x11, 0x11, 0x09, 0xFD, 0xF3, 0xEB, 0xE9, 0xED, 0xF7, 0x06, 0x12, 
-    0x16, 0x10, 0x03, 0xF7, 0xF0, 0xF0, 0xF6, 0xFF, 0x09, 0x0E, 0x0C, 0x07, 
-    0x03, 0x00, 0xFD, 0xFB, 0xFA, 0xFC, 0x03, 0x0C, 0x12, 0x0F, 0x04, 0xF6, 
-    0xE9, 0xDD, 0xD7, 0xD9, 0xE3, 0xF4, 0x06, 0x12, 0x16, 0x12, 0x08, 0xFE, 
-    0xF9, 0xFA, 0x03, 0x0F, 0x19, 0x1D, 0x1C, 0x16, 0x0C, 0x00, 0xF6, 0xF1, 
-    0xF4, 0xFD, 0x09, 0x0E, 0x0C, 0x02, 0xF6, 0xED, 0xE8, 0xE9, 0xF0, 0xFD, 
-    0x0B, 0x14, 0x14, 0x09, 0xFA, 0xEE, 0xE6, 0xE6, 0xEB, 0xF2, 0xF8, 0xF9, 
-    0xF5, 0xEF, 0xEA, 0xE5, 0xE2, 0xDF, 0xDF, 0xE3, 0xEB, 0xF0, 0xEF, 0xEA, 
-    0xE4, 0xDF, 0xDB, 0xD9, 0xDC, 0xE5, 0xF2, 0xFD, 0x05, 0x04, 0xFC, 0xF0, 
-    0xE4, 0xDE, 0xDE, 0xE4, 0xED, 0xF8, 0x00, 0x03, 0x02, 0xFD, 0xF4, 0xF0, 
-    0xEC, 0xF1, 0xFE, 0x0A, 0x10, 0x0D, 0x03, 0xF9, 0xF0, 0xE8, 0xE6, 0xED, 
-    0xFB, 0x0A, 0x16, 0x1D, 0x1A, 0x10, 0x06, 0xFB, 0xF9, 0xFF, 0x08, 0x11, 
-    0x18, 0x1D, 0x1D, 0x1A, 0x15, 0x0D, 0x0A, 0x0A, 0x12, 0x23, 0x2E, 0x32, 
-    0x29, 0x19, 0x08, 0xFB, 0xEF, 0xEF, 0xF7, 0x02, 0x13, 0x1C, 0x21, 0x18, 
-    0x13, 0x08, 0x00, 0x04, 0x05, 0x0F, 0x14, 0x15, 0x14, 0x0F, 0x09, 0x04, 
-    0xFD, 0xFA, 0xF8, 0xFD, 0x07, 0x09, 0x05, 0x00, 0xF7, 0xF2, 0xF2, 0xF2, 
-    0xF9, 0x03, 0x0B, 0x1A, 0x1E, 0x1D, 0x19, 0x12, 0x0F, 0x0A, 0x0E, 0x11, 
-    0x1A, 0x1D, 0x20, 0x20, 0x1C, 0x17, 0x09, 0x03, 0xFE, 0x01, 0x11, 0x1D, 
-    0x25, 0x24, 0x1A, 0x0C, 0x00, 0xF7, 0xF7, 0x00, 0x0A, 0x18, 0x1D, 0x18, 
-    0x0D, 0xFE, 0xEE, 0xE6, 0xE5, 0xE9, 0xF0, 0xF9, 0xFD, 0xF8, 0xF8, 0xEE, 
-    0xEB, 0xE6, 0xE7, 0xEC, 0xF3, 0xFD, 0x01, 0xFE, 0xF6, 0xF1, 0xEB, 0xEC, 
-    0xED, 0xF3, 0xFC, 0x04, 0x08, 0x0E, 0x09, 0x02, 0xF9, 0xF1, 0xF1, 0xF3, 
-    0xFB, 0x00, 0x06, 0x07, 0x08, 0x0A, 0x0A, 0x08, 0x07, 0x08, 0x0E, 0x15, 
-    0x1D, 0x1B, 0x16, 0x0A, 0x00, 0xFB, 0xF4, 0xF5, 0xFA, 0x05, 0x0E, 0x18, 
-    0x1C, 0x17, 0x0D, 0x03, 0xF9, 0xF5, 0xF5, 0xFA, 0xFC, 0xF8, 0xF5, 0xEF, 
-    0xEA, 0xE4, 0xE3, 0xE2, 0xEC, 0xF8, 0x05, 0x10, 0x0D, 0x04, 0xF4, 0xE8, 
-    0xE1, 0xDD, 0xE0, 0xE5, 0xEE, 0xF9, 0xFD, 0xFB, 0xEF, 0xE2, 0xD5, 0xCD, 
-    0xD1, 0xD9, 0xE5, 0xF0, 0xF6, 0xFA, 0xF7, 0xF3, 0xED, 0xE7, 0xE5, 0xEA, 
-    0xF5, 0x02, 0x0B, 0x08, 0xFF, 0xF6, 0xEA, 0xE1, 0xDD, 0xDA, 0xE0, 0xE9, 
-    0xEF, 0xF3, 0xF0, 0xEC, 0xE4, 0xDE, 0xDC, 0xDE, 0xE4, 0xEC, 0xF2, 0xF8, 
-    0xFB, 0xFB, 0xF9, 0xF1, 0xEA, 0xE3, 0xE5, 0xEC, 0xF3, 0xF5, 0xEF, 0xE9, 
-    0xE4, 0xE0, 0xDD, 0xDB, 0xE0, 0xE8, 0xF6, 0xFF, 0x01, 0xFD, 0xF6, 0xF0, 
-    0xE9, 0xEC, 0xF2, 0xFF, 0x08, 0x10, 0x10, 0x0E, 0x09, 0x04, 0x00, 0x00, 
-    0x08, 0x14, 0x22, 0x27, 0x25, 0x19, 0x0E, 0x05, 0x02, 0x04, 0x0B, 0x15, 
-    0x1F, 0x28, 0x29, 0x26, 0x1A, 0x13, 0x0D, 0x0B, 0x0D, 0x14, 0x1A, 0x1E, 
-    0x20, 0x1E, 0x1E, 0x1A, 0x15, 0x0F, 0x0E, 0x13, 0x1B, 0x21, 0x20, 0x1A, 
-    0x0E, 0x06, 0x00, 0xFA, 0xF9, 0xFA, 0xFF, 0x05, 0x0B, 0x0C, 0x0A, 0x03, 
-    0xFC, 0xF9, 0xF8, 0xFE, 0x09, 0x15, 0x1D, 0x1F, 0x1F, 0x1D, 0x17, 0x0F, 
-    0x09, 0x05, 0x09, 0x11, 0x18, 0x1B, 0x17, 0x12, 0x0D, 0x0D, 0x0F, 0x11, 
-    0x16, 0x1B, 0x20, 0x21, 0x1B, 0x11, 0x07, 0x03, 0x00, 0x03, 0x07, 0x0C, 
-    0x0F, 0x0B, 0x06, 0xFD, 0xF6, 0xEF, 0xEF, 0xF3, 0xFF, 0x0D, 0x18, 0x1B, 
-    0x13, 0x08, 0xFC, 0xF9, 0xF8, 0xFB, 0x01, 0x05, 0x09, 0x09, 0x02, 0xF9, 
-    0xF0, 0xE7, 0xE2, 0xE1, 0xE5, 0xEB, 0xF1, 0xF0, 0xF0, 0xEF, 0xF0, 0xF3, 
-    0xF6, 0xF9, 0xFF, 0x07, 0x11, 0x17, 0x16, 0x10, 0x09, 0x06, 0x05, 0x04, 
-    0x02, 0x03, 0x08, 0x0F, 0x13, 0x12, 0x0C, 0x06, 0x00, 0xFD, 0xFD, 0x02, 
-    0x07, 0x0D, 0x11, 0x12, 0x12, 0x0E, 0x09, 0x04, 0x04, 0x06, 0x11, 0x1C, 
-    0x1F, 0x18, 0x0A, 0xFF, 0xF6, 0xF4, 0xF4, 0xF3, 0xF5, 0xF8, 0xFB, 0xFB, 
-    0xF7, 0xED, 0xE3, 0xDD, 0xDD, 0xE1, 0xE6, 0xE9, 0xE7, 0xE3, 0xDD, 0xD9, 
-    0xD7, 0xD7, 0xDA, 0xDD, 0xE4, 0xED, 0xF2, 0xEF, 0xE5, 0xDA, 0xD4, 0xD2, 
-    0xD4, 0xD7, 0xDA, 0xE0, 0xE6, 0xEA, 0xEA, 0xE8, 0xE5, 0xE2, 0xE2, 0xE4, 
-    0xEA, 0xEF, 0xF3, 0xF2, 0xEF, 0xEB, 0xE9, 0xE6, 0xE3, 0xE2, 0xE2, 0xEB, 
-    0xF4, 0xFB, 0xF9, 0xF1, 0xEA, 0xE8, 0xE9, 0xE8, 0xE7, 0xE7, 0xEC, 0xF3, 
-    0xFA, 0xFB, 0xF9, 0xF6, 0xF3, 0xF2, 0xF4, 0xF8, 0xFD, 0x03, 0x05, 0x04, 
-    0x02, 0xFE, 0xFA, 0xFA, 0xFA, 0x00, 0x0A, 0x12, 0x12, 0x0A, 0xFE, 0xF2, 
-    0xEB, 0xE7, 0xE8, 0xEC, 0xF6, 0x02, 0x0E, 0x17, 0x18, 0x15, 0x12, 0x11, 
-    0x13, 0x17, 0x1B, 0x1B, 0x18, 0x13, 0x0E, 0x0B, 0x08, 0x06, 0x05, 0x07, 
-    0x0E, 0x14, 0x15, 0x0F, 0x04, 0xFD, 0xFC, 0x02, 0x09, 0x0F, 0x13, 0x18, 
-    0x1E, 0x21, 0x21, 0x1D, 0x16, 0x0F, 0x0B, 0x0A, 0x0D, 0x13, 0x16, 0x19, 
-    0x18, 0x16, 0x13, 0x0E, 0x0A, 0x09, 0x0A, 0x12, 0x1A, 0x1E, 0x1B, 0x11, 
-    0x07, 0x01, 0xFE, 0xFE, 0xFE, 0x00, 0x04, 0x09, 0x0B, 0x08, 0x03, 0xFC, 
-    0xF9, 0xFB, 0x00, 0x07, 0x0B, 0x0D, 0x0D, 0x0D, 0x0B, 0x08, 0x05, 0x05, 
-    0x07, 0x0E, 0x16, 0x1A, 0x18, 0x0F, 0x03, 0xFB, 0xF8, 0xFA, 0xFA, 0xFB, 
-    0xFD, 0x01, 0x05, 0x08, 0x08, 0x04, 0xFF, 0xFC, 0xFC, 0xFF, 0x03, 0x05, 
-    0x03, 0x01, 0x00, 0xFD, 0xFA, 0xFA, 0xFD, 0x03, 0x0D, 0x15, 0x19, 0x14, 
-    0x0B, 0x02, 0x00, 0x03, 0x06, 0x07, 0x07, 0x08, 0x07, 0x07, 0x04, 0xFE, 
-    0xF7, 0xF3, 0xF2, 0xF5, 0xF7, 0xF8, 0xF7, 0xF7, 0xFA, 0xFD, 0xFF, 0x00, 
-    0x01, 0x02, 0x08, 0x12, 0x19, 0x19, 0x10, 0x04, 0xFB, 0xF8, 0xFA, 0xFD, 
-    0xFF, 0x01, 0x03, 0x06, 0x08, 0x06, 0xFF, 0xF5, 0xEF, 0xEF, 0xF5, 0xFE, 
-    0x03, 0x06, 0x05, 0x01, 0xFD, 0xF7, 0xF3, 0xF0, 0xF1, 0xF7, 0xFD, 0xFD, 
-    0xF5, 0xE9, 0xDF, 0xDC, 0xDE, 0xE2, 0xE4, 0xE5, 0xE4, 0xE4, 0xE3, 0xE2, 
-    0xDF, 0xDC, 0xDA, 0xD9, 0xDB, 0xDC, 0xDB, 0xD8, 0xD4, 0xD2, 0xD1, 0xD2, 
-    0xD2, 0xD0, 0xD0, 0xD3, 0xDC, 0xE6, 0xEA, 0xE7, 0xE2, 0xDF, 0xE1, 0xE6, 
-    0xEB, 0xED, 0xEC, 0xEE, 0xF1, 0xF3, 0xF2, 0xEF, 0xEC, 0xEB, 0xED, 0xF3, 
-    0xFB, 0x01, 0x03, 0x00, 0xFB, 0xF6, 0xF0, 0xEB, 0xE9, 0xED, 0xF7, 0x02, 
-    0x07, 0x07, 0x02, 0xFF, 0x01, 0x05, 0x0C, 0x12, 0x14, 0x17, 0x1B, 0x1E, 
-    0x1D, 0x19, 0x15, 0x12, 0x11, 0x13, 0x15, 0x16, 0x14, 0x0F, 0x09, 0x06, 
-    0x04, 0x01, 0xFE, 0xFE, 0x03, 0x0F, 0x18, 0x1A, 0x13, 0x07, 0xFF, 0xFE, 
-    0x01, 0x06, 0x07, 0x06, 0x07, 0x0A, 0x0C, 0x0D, 0x0A, 0x06, 0x03, 0x03, 
-    0x04, 0x07, 0x0B, 0x0B, 0x0B, 0x0A, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x13, 
-    0x18, 0x1B, 0x18, 0x13, 0x0D, 0x0B, 0x0D, 0x0F, 0x0F, 0x0D, 0x0B, 0x0B, 
-    0x0C, 0x0E, 0x0E, 0x0A, 0x05, 0x02, 0x04, 0x08, 0x0E, 0x11, 0x11, 0x10, 
-    0x0F, 0x0D, 0x07, 0x01, 0xFC, 0xFE, 0x04, 0x08, 0x07, 0xFE, 0xF1, 0xE6, 
-    0xE1, 0xE1, 0xE5, 0xE9, 0xEC, 0xEF, 0xF3, 0xF6, 0xF7, 0xF8, 0xF7, 0xF8, 
-    0xFA, 0xFE, 0x04, 0x09, 0x09, 0x06, 0x01, 0xFD, 0xFC, 0xFC, 0xFD, 0xFF, 
-    0x05, 0x0B, 0x0F, 0x0E, 0x08, 0x04, 0x02, 0x05, 0x08, 0x0A, 0x08, 0x07, 
-    0x09, 0x0C, 0x0F, 0x0F, 0x0D, 0x09, 0x07, 0x05, 0x04, 0x02, 0x01, 0x01, 
-    0x03, 0x04, 0x05, 0x05, 0x04, 0x04, 0x08, 0x10, 0x17, 0x19, 0x13, 0x0A, 
-    0x03, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0xF9, 0xF8, 0xF8, 0xF9, 0xF8, 0xF4, 
-    0xF1, 0xF0, 0xF1, 0xF4, 0xF9, 0xFB, 0xFC, 0xFA, 0xF8, 0xF7, 0xF4, 0xF3, 
-    0xF2, 0xF5, 0xFC, 0xFF, 0xFE, 0xF7, 0xEE, 0xE9, 0xE8, 0xEB, 0xEE, 0xEF, 
-    0xEE, 0xEF, 0xF1, 0xF0, 0xEC, 0xE8, 0xE5, 0xE5, 0xE9, 0xED, 0xF1, 0xF4, 
-    0xF4, 0xF2, 0xEF, 0xEB, 0xE7, 0xE5, 0xE4, 0xE6, 0xEC, 0xF1, 0xF2, 0xEF, 
-    0xE8, 0xE3, 0xE2, 0xE5, 0xEB, 0xED, 0xEA, 0xE5, 0xE3, 0xE4, 0xE7, 0xEA, 
-    0xEC, 0xEB, 0xEA, 0xE9, 0xE9, 0xEB, 0xEC, 0xEC, 0xEB, 0xE9, 0xE7, 0xE2, 
-    0xDF, 0xDE, 0xE3, 0xEE, 0xF8, 0xFF, 0x03, 0x06, 0x0A, 0x0E, 0x12, 0x16, 
-    0x18, 0x1B, 0x1E, 0x20, 0x20, 0x1D, 0x1A, 0x17, 0x15, 0x14, 0x15, 0x16, 
-    0x17, 0x16, 0x14, 0x11, 0x0F, 0x0F, 0x10, 0x13, 0x18, 0x21, 0x2A, 0x2D, 
-    0x28, 0x1E, 0x15, 0x12, 0x14, 0x17, 0x19, 0x17, 0x15, 0x15, 0x15, 0x16, 
-    0x16, 0x14, 0x11, 0x0E, 0x0B, 0x0A, 0x09, 0x08, 0x07, 0x07, 0x06, 0x04, 
-    0x00, 0xFE, 0xFD, 0xFF, 0x04, 0x09, 0x0A, 0x05, 0xFE, 0xF8, 0xF6, 0xF5, 
-    0xF8, 0xF9, 0xF9, 0xFB, 0xFE, 0x02, 0x03, 0x03, 0x02, 0x00, 0x01, 0x02, 
-    0x05, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0C, 0x0A, 0x07, 0x04, 0x05, 0x0A, 
-    0x0C, 0x0B, 0x06, 0x01, 0xFD, 0xFD, 0xFE, 0x00, 0xFF, 0xFE, 0xFD, 0xFF, 
-    0x03, 0x06, 0x07, 0x06, 0x05, 0x05, 0x06, 0x07, 0x06, 0x05, 0x02, 0xFE, 
-    0xF9, 0xF5, 0xF3, 0xF4, 0xF7, 0xFC, 0xFF, 0xFE, 0xF9, 0xF3, 0xEF, 0xEE, 
-    0xF1, 0xF8, 0xFD, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0xFF, 0xFC, 0xFA, 
-    0xF9, 0xFA, 0xF9, 0xF9, 0xF8, 0xFA, 0xFE, 0x02, 0x03, 0x03, 0x02, 0x05, 
-    0x0B, 0x0F, 0x0F, 0x0B, 0x06, 0x00, 0xFD, 0xFC, 0xFC, 0xFB, 0xFA, 0xF9, 
-    0xFB, 0xFD, 0xFD, 0xFA, 0xF6, 0xF2, 0xEF, 0xF1, 0xF4, 0xF9, 0xFB, 0xFC, 
-    0xFD, 0xFE, 0xFE, 0xFF, 0xFE, 0xFE, 0x00, 0x03, 0x03, 0xFE, 0xF7, 0xEF, 
-    0xEC, 0xEB, 0xED, 0xEF, 0xEC, 0xE8, 0xE5, 0xE3, 0xE2, 0xE2, 0xE2, 0xE3, 
-    0xE3, 0xE5, 0xE8, 0xE9, 0xE9, 0xE8, 0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xE7, 
-    0xE8, 0xED, 0xF1, 0xF2, 0xF1, 0xEF, 0xEC, 0xEB, 0xED, 0xF3, 0xF7, 0xF8, 
-    0xF7, 0xF5, 0xF4, 0xF5, 0xF7, 0xF9, 0xFC, 0xFF, 0x04, 0x09, 0x0C, 0x0C, 
-    0x0A, 0x06, 0x02, 0xFE, 0xFA, 0xF8, 0xF8, 0xFC, 0x01, 0x06, 0x0A, 0x0E, 
-    0x11, 0x14, 0x15, 0x16, 0x18, 0x18, 0x17, 0x15, 0x13, 0x10, 0x0C, 0x09, 
-    0x05, 0x00, 0xFE, 0xFB, 0xF9, 0xF9, 0xF9, 0xFA, 0xFB, 0xFD, 0xFC, 0xFE, 
-    0x01, 0x07, 0x10, 0x18, 0x1C, 0x1B, 0x18, 0x14, 0x12, 0x15, 0x1A, 0x1E, 
-    0x1E, 0x1C, 0x1A, 0x18, 0x17, 0x16, 0x16, 0x16, 0x18, 0x19, 0x1B, 0x1A, 
-    0x18, 0x16, 0x15, 0x16, 0x16, 0x18, 0x1A, 0x1C, 0x1E, 0x20, 0x1F, 0x1C, 
-    0x17, 0x12, 0x0E, 0x0B, 0x0D, 0x10, 0x11, 0x11, 0x0E, 0x0B, 0x08, 0x08, 
-    0x07, 0x05, 0x04, 0x03, 0x04, 0x06, 0x06, 0x04, 0x02, 0xFF, 0xFE, 0xFC, 
-    0xFA, 0xF7, 0xF5, 0xF9, 0xFD, 0x00, 0xFE, 0xF8, 0xF3, 0xEF, 0xED, 0xF0, 
-    0xF4, 0xF6, 0xF6, 0xF5, 0xF4, 0xF6, 0xFA, 0xFD, 0xFF, 0xFE, 0xFC, 0xFA, 
-    0xFB, 0xFD, 0xFE, 0xFC, 0xF9, 0xF7, 0xF5, 0xF6, 0xF7, 0xFA, 0xFD, 0xFF, 
-    0xFF, 0xFD, 0xFB, 0xF8, 0xF8, 0xF9, 0xFE, 0x02, 0x04, 0x05, 0x04, 0x02, 
-    0x00, 0xFF, 0xFE, 0xFF, 0x01, 0x02, 0x01, 0xFE, 0xFA, 0xF8, 0xF8, 0xFA, 
-    0xFC, 0xFD, 0xFE, 0x00, 0x05, 0x07, 0x04, 0xFD, 0xF4, 0xED, 0xE9, 0xE7, 
-    0xEA, 0xEE, 0xEF, 0xEF, 0xEE, 0xED, 0xEE, 0xF0, 0xF4, 0xF6, 0xF7, 0xF8, 
-    0xF9, 0xFA, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0x00, 
-    0x04, 0x02, 0xFC, 0xF3, 0xEC, 0xE8, 0xE9, 0xEB, 0xED, 0xED, 0xEC, 0xEB, 
-    0xEB, 0xE9, 0xE7, 0xE5, 0xE4, 0xE4, 0xE7, 0xEA, 0xEC, 0xEB, 0xEA, 0xEA, 
-    0xEC, 0xED, 0xED, 0xEB, 0xE7, 0xE7, 0xEA, 0xEC, 0xEC, 0xE9, 0xE6, 0xE3, 
-    0xE2, 0xE4, 0xE9, 0xEA, 0xE7, 0xE1, 0xDB, 0xD9, 0xDB, 0xDF, 0xE5, 0xE8, 
-    0xEC, 0xEF, 0xF1, 0xF2, 0xF1, 0xEE, 0xED, 0xEB, 0xE8, 0xE7, 0xE8, 0xEE, 
-    0xF7, 0x01, 0x07, 0x09, 0x0B, 0x0E, 0x13, 0x18, 0x1C, 0x1F, 0x1E, 0x1A, 
-    0x14, 0x0F, 0x0A, 0x08, 0x08, 0x0A, 0x0C, 0x0E, 0x0E, 0x0D, 0x0C, 0x0A, 
-    0x0C, 0x10, 0x13, 0x16, 0x18, 0x1C, 0x20, 0x25, 0x29, 0x29, 0x23, 0x1C, 
-    0x15, 0x12, 0x11, 0x12, 0x12, 0x10, 0x0C, 0x08, 0x06, 0x03, 0x00, 0xFD, 
-    0xFC, 0xFB, 0xFA, 0xFA, 0xFA, 0xFC, 0xFE, 0x03, 0x07, 0x09, 0x09, 0x0B, 
-    0x0F, 0x15, 0x1B, 0x1B, 0x16, 0x0D, 0x08, 0x08, 0x0C, 0x11, 0x15, 0x16, 
-    0x14, 0x11, 0x0F, 0x0D, 0x0D, 0x0F, 0x11, 0x12, 0x13, 0x12, 0x10, 0x0D, 
-    0x09, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x05, 0x08, 0x09, 0x07, 0x03, 
-    0xFF, 0xFD, 0xFF, 0x03, 0x08, 0x0C, 0x0C, 0x09, 0x04, 0x02, 0x02, 0x06, 
-    0x09, 0x0B, 0x0B, 0x09, 0x05, 0x01, 0xFD, 0xF8, 0xF4, 0xF1, 0xEE, 0xEC, 
-    0xEA, 0xED, 0xF3, 0xF8, 0xF8, 0xF4, 0xF0, 0xEF, 0xF1, 0xF6, 0xFC, 0x01, 
-    0x04, 0x03, 0x01, 0xFF, 0xFD, 0xFC, 0xFA, 0xF8, 0xF6, 0xF4, 0xF3, 0xF1, 
-    0xF2, 0xF1, 0xF2, 0xF4, 0xF6, 0xF8, 0xFA, 0xFD, 0x03, 0x0A, 0x0D, 0x0B, 
-    0x06, 0x03, 0x01, 0x01, 0x03, 0x07, 0x0A, 0x09, 0x07, 0x05, 0x04, 0x04, 
-    0x05, 0x06, 0x07, 0x06, 0x04, 0x00, 0xFC, 0xF9, 0xF8, 0xF8, 0xF9, 0xFA, 
-    0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xF5, 0xEC, 0xE3, 0xDE, 0xDB, 0xDD, 0xE1, 
-    0xE3, 0xE3, 0xE0, 0xDB, 0xD9, 0xD9, 0xDB, 0xDC, 0xDC, 0xDD, 0xE1, 0xE6, 
-    0xEA, 0xED, 0xED, 0xEC, 0xEB, 0xED, 0xF0, 0xF2, 0xF3, 0xF6, 0xFB, 0xFC, 
-    0xF9, 0xF3, 0xEB, 0xE6, 0xE4, 0xE6, 0xEA, 0xEE, 0xF0, 0xED, 0xE9, 0xE6, 
-    0xE5, 0xE7, 0xEC, 0xF3, 0xF8, 0xFD, 0x01, 0x04, 0x02, 0xFD, 0xF8, 0xF3, 
-    0xF0, 0xEE, 0xEF, 0xF0, 0xF6, 0xFC, 0x00, 0x01, 0x02, 0x03, 0x08, 0x0F, 
-    0x15, 0x18, 0x17, 0x11, 0x0A, 0x05, 0x02, 0x02, 0x02, 0x05, 0x08, 0x08, 
-    0x07, 0x04, 0x01, 0xFE, 0xFD, 0xFC, 0xFF, 0x04, 0x0A, 0x0E, 0x14, 0x19, 
-    0x1C, 0x1D, 0x1C, 0x1A, 0x19, 0x19, 0x1A, 0x1C, 0x1C, 0x1A, 0x15, 0x10, 
-    0x0C, 0x0A, 0x0B, 0x0A, 0x0C, 0x0D, 0x0E, 0x0E, 0x0C, 0x0A, 0x08, 0x0A, 
-    0x0F, 0x15, 0x18, 0x1A, 0x1C, 0x21, 0x25, 0x25, 0x20, 0x18, 0x11, 0x0F, 
-    0x11, 0x14, 0x16, 0x15, 0x12, 0x0C, 0x07, 0x03, 0x01, 0x00, 0x01, 0x00, 
-    0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC, 0xFF, 0x02, 0x05, 0x05, 0x03, 
-    0x03, 0x04, 0x04, 0x02, 0xFE, 0xFC, 0xFB, 0xFE, 0x02, 0x04, 0x04, 0x01, 
-    0xFD, 0xFB, 0xFC, 0xFF, 0x00, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0xFE, 
-    0xFC, 0xFB, 0xFA, 0xF9, 0xFA, 0xFA, 0xFD, 0x02, 0x06, 0x07, 0x06, 0x04, 
-    0x03, 0x04, 0x08, 0x0D, 0x10, 0x11, 0x0F, 0x0D, 0x0C, 0x0C, 0x0D, 0x0C, 
-    0x09, 0x05, 0x01, 0xFD, 0xF9, 0xF4, 0xF1, 0xEE, 0xEC, 0xED, 0xEF, 0xF0, 
-    0xF1, 0xF4, 0xF6, 0xF5, 0xF2, 0xEE, 0xED, 0xEF, 0xF3, 0xF7, 0xF8, 0xF8, 
-    0xF5, 0xF2, 0xF2, 0xF4, 0xF8, 0xFB, 0xFD, 0xFD, 0xFC, 0xFA, 0xF6, 0xF5, 
-    0xF4, 0xF5, 0xF7, 0xFA, 0xFC, 0xFD, 0xFC, 0xFB, 0xFC, 0xF9, 0xF5, 0xF1, 
-    0xEE, 0xEF, 0xF2, 0xF5, 0xF9, 0xFA, 0xF9, 0xF6, 0xF3, 0xF4, 0xF5, 0xF7, 
-    0xF5, 0xF2, 0xEF, 0xEE, 0xEF, 0xEE, 0xEC, 0xEA, 0xE9, 0xEA, 0xEC, 0xEB, 
-    0xE8, 0xE6, 0xE8, 0xEB, 0xEB, 0xE6, 0xE0, 0xDD, 0xDE, 0xE2, 0xE6, 0xE8, 
-    0xE9, 0xE8, 0xE5, 0xE2, 0xE0, 0xE1, 0xE4, 0xE9, 0xEE, 0xF2, 0xF5, 0xF8, 
-    0xFA, 0xFA, 0xF9, 0xF6, 0xF4, 0xF1, 0xEF, 0xF1, 0xF4, 0xFA, 0xFE, 0x00, 
-    0x00, 0xFF, 0x01, 0x05, 0x0B, 0x0F, 0x11, 0x0F, 0x09, 0x02, 0xFF, 0x00, 
-    0x03, 0x07, 0x0B, 0x0E, 0x0F, 0x0E, 0x0D, 0x0C, 0x0C, 0x0F, 0x13, 0x17, 
-    0x19, 0x1A, 0x1B, 0x1F, 0x23, 0x24, 0x21, 0x1D, 0x19, 0x18, 0x18, 0x19, 
-    0x18, 0x15, 0x10, 0x0A, 0x05, 0x04, 0x05, 0x07, 0x09, 0x09, 0x09, 0x08, 
-    0x07, 0x06, 0x07, 0x0A, 0x0E, 0x11, 0x13, 0x14, 0x16, 0x18, 0x1D, 0x20, 
-    0x1E, 0x17, 0x0D, 0x05, 0x04, 0x08, 0x0B, 0x0E, 0x0E, 0x0C, 0x09, 0x07, 
-    0x08, 0x0B, 0x0D, 0x0E, 0x0E, 0x0F, 0x10, 0x0E, 0x0C, 0x0B, 0x0B, 0x0C, 
-    0x0F, 0x10, 0x10, 0x0F, 0x0E, 0x10, 0x10, 0x0D, 0x07, 0x00, 0xFD, 0x00, 
-    0x04, 0x08, 0x08, 0x05, 0xFF, 0xF9, 0xF6, 0xF7, 0xFA, 0xFD, 0xFD, 0xFB, 
-    0xF8, 0xF5, 0xF3, 0xF3, 0xF1, 0xF0, 0xEF, 0xF0, 0xEF, 0xED, 0xEE, 0xF1, 
-    0xF4, 0xF5, 0xF3, 0xF0, 0xF0, 0xF4, 0xF9, 0x00, 0x03, 0x04, 0x04, 0x03, 
-    0x02, 0x01, 0x02, 0x03, 0x05, 0x05, 0x04, 0x03, 0x00, 0xFD, 0xFB, 0xF9, 
-    0xF7, 0xF8, 0xFA, 0xFD, 0x01, 0x06, 0x0B, 0x0F, 0x0D, 0x07, 0x00, 0xFD, 
-    0xFF, 0x04, 0x09, 0x0C, 0x0C, 0x08, 0x03, 0x01, 0x00, 0x01, 0x01, 0x00, 
-    0xFE, 0xFC, 0xF8, 0xF3, 0xEF, 0xEC, 0xED, 0xEE, 0xF1, 0xF2, 0xF3, 0xF2, 
-    0xF4, 0xF4, 0xF2, 0xED, 0xE5, 0xE1, 0xDF, 0xE2, 0xE6, 0xE8, 0xE8, 0xEB, 
-    0xE9, 0xE2, 0xE4, 0xE7, 0xEB, 0xEB, 0xED, 0xF0, 0xF0, 0xEF, 0xE9, 0xE7, 
-    0xE4, 0xE6, 0xE2, 0xE4, 0xE2, 0xE1, 0xE9, 0xE8, 0xEC, 0xEC, 0xE9, 0xE3, 
-    0xE2, 0xE7, 0xE8, 0xED, 0xF2, 0xED, 0xED, 0xEC, 0xEC, 0xF1, 0xF8, 0x00, 
-    0x06, 0x04, 0x01, 0x00, 0xFC, 0xFE, 0xF9, 0xF8, 0xF3, 0xF3, 0xF3, 0xF4, 
-    0xFE, 0xFF, 0x00, 0x00, 0xFE, 0xF8, 0xF9, 0xF6, 0x01, 0x02, 0x07, 0x14, 
-    0x0C, 0x0E, 0x05, 0x09, 0x09, 0x0E, 0x17, 0x15, 0x1B, 0x12, 0x0D, 0x11, 
-    0x09, 0x0E, 0x08, 0x12, 0x18, 0x11, 0x12, 0x0F, 0x15, 0x14, 0x13, 0x15, 
-    0x19, 0x10, 0x17, 0x19, 0x17, 0x21, 0x21, 0x17, 0x19, 0x19, 0x18, 0x1A, 
-    0x1E, 0x23, 0x1F, 0x1C, 0x18, 0x15, 0x0E, 0x12, 0x0D, 0x0F, 0x0E, 0x11, 
-    0x0E, 0x0C, 0x13, 0x0D, 0x0E, 0x09, 0x03, 0xF6, 0xEF, 0xEE, 0xF4, 0xF7, 
-    0xF1, 0xEC, 0xE3, 0xE0, 0xE1, 0xE3, 0xE7, 0xEF, 0xF4, 0xF8, 0xF7, 0xED, 
-    0xEC, 0xE2, 0xE3, 0xF0, 0xEF, 0xF8, 0xF4, 0xF3, 0xF6, 0xF7, 0xFA, 0xF8, 
-    0xFC, 0xF9, 0xF8, 0xF8, 0xFC, 0xFD, 0xFB, 0x03, 0xFE, 0x00, 0xFC, 0xFE, 
-    0x02, 0x04, 0x0B, 0x0B, 0x0C, 0x0E, 0x0D, 0x08, 0x10, 0x0C, 0x13, 0x16, 
-    0x15, 0x16, 0x13, 0x19, 0x22, 0x22, 0x1D, 0x15, 0x0C, 0x10, 0x15, 0x1B, 
-    0x1C, 0x1E, 0x22, 0x1D, 0x18, 0x1C, 0x16, 0x17, 0x1D, 0x1F, 0x24, 0x1D, 
-    0x18, 0x0E, 0x0F, 0x0F, 0x0C, 0x0E, 0x11, 0x0E, 0x0B, 0x08, 0x08, 0x04, 
-    0x03, 0x04, 0xF9, 0xFD, 0xF9, 0x02, 0x02, 0x07, 0x03, 0x02, 0xFF, 0xF2, 
-    0xF7, 0xEE, 0xF4, 0xF0, 0xF2, 0xEE, 0xE7, 0xDA, 0xD2, 0xD1, 0xD2, 0xD9, 
-    0xDD, 0xDA, 0xD7, 0xD9, 0xD4, 0xD9, 0xD8, 0xD1, 0xCC, 0xCC, 0xCC, 0xD2, 
-    0xD6, 0xD4, 0xD5, 0xD2, 0xD3, 0xD3, 0xD0, 0xD3, 0xD8, 0xDB, 0xDF, 0xDC, 
-    0xD9, 0xD8, 0xD3, 0xD5, 0xD1, 0xD5, 0xD7, 0xD8, 0xDC, 0xDC, 0xE1, 0xE2, 
-    0xEC, 0xE9, 0xE8, 0xE1, 0xDE, 0xE1, 0xDE, 0xEA, 0xEB, 0xEC, 0xF0, 0xF1, 
-    0xEC, 0xEB, 0xEB, 0xF1, 0xFB, 0x04, 0x09, 0x04, 0x01, 0xFA, 0x00, 0x02, 
-    0x09, 0x0F, 0x12, 0x1B, 0x1A, 0x24, 0x1F, 0x23, 0x22, 0x1E, 0x1F, 0x1F, 
-    0x27, 0x27, 0x30, 0x2D, 0x2E, 0x28, 0x26, 0x25, 0x2B, 0x30, 0x34, 0x38, 
-    0x33, 0x35, 0x2B, 0x2C, 0x29, 0x27, 0x26, 0x29, 0x29, 0x28, 0x23, 0x1F, 
-    0x1A, 0x19, 0x1C, 0x14, 0x15, 0x12, 0x14, 0x15, 0x16, 0x12, 0x10, 0x0C, 
-    0x06, 0x00, 0xFB, 0xFD, 0xFF, 0x08, 0x0C, 0x0A, 0x0B, 0x07, 0x03, 0x00, 
-    0xFD, 0x02, 0x01, 0xFF, 0xFB, 0xFA, 0xF5, 0xF8, 0xFC, 0xF9, 0xF4, 0xEF, 
-    0xEC, 0xEB, 0xF1, 0xF1, 0xF0, 0xEA, 0xE6, 0xE3, 0xE0, 0xE0, 0xE7, 0xEC, 
-    0xF1, 0xFB, 0xFD, 0xFE, 0xF9, 0xF3, 0xEE, 0xEA, 0xF0, 0xF2, 0xF3, 0xF7, 
-    0xFA, 0xFE, 0x01, 0xFF, 0xF8, 0xFA, 0xF4, 0xF3, 0xF7, 0xF1, 0xF3, 0xEE, 
-    0xEB, 0xE9, 0xE3, 0xE4, 0xE1, 0xE9, 0xF0, 0xF4, 0xF1, 0xF3, 0xED, 0xE8, 
-    0xED, 0xE8, 0xF6, 0xF7, 0xFA, 0x01, 0xFF, 0x00, 0x05, 0x09, 0x0E, 0x0A, 
-    0x0A, 0x08, 0x03, 0x0F, 0x0C, 0x12, 0x11, 0x11, 0x0F, 0x11, 0x11, 0x11, 
-    0x17, 0x1A, 0x1E, 0x1F, 0x1C, 0x1A, 0x19, 0x13, 0x17, 0x15, 0x16, 0x1C, 
-    0x1E, 0x22, 0x23, 0x1F, 0x20, 0x20, 0x1D, 0x1C, 0x19, 0x19, 0x19, 0x18, 
-    0x18, 0x12, 0x0D, 0x09, 0x03, 0x04, 0x06, 0x0B, 0x0E, 0x11, 0x0F, 0x09, 
-    0x00, 0xFA, 0xF0, 0xF4, 0xF5, 0xF6, 0xF7, 0xF2, 0xF8, 0xFC, 0x00, 0x01, 
-    0xFC, 0xF6, 0xF3, 0xF2, 0xF3, 0xF0, 0xF5, 0xED, 0xED, 0xEB, 0xE3, 0xE3, 
-    0xDC, 0xE4, 0xE5, 0xEA, 0xE7, 0xE8, 0xE1, 0xDB, 0xD9, 0xCA, 0xD0, 0xCD, 
-    0xD3, 0xD5, 0xD6, 0xD7, 0xDA, 0xDB, 0xD8, 0xD8, 0xD0, 0xD4, 0xD0, 0xD5, 
-    0xD9, 0xDC, 0xDC, 0xDF, 0xDB, 0xDB, 0xDB, 0xD8, 0xDB, 0xDC, 0xE3, 0xE2, 
-    0xE1, 0xDB, 0xDD, 0xD9, 0xE3, 0xE9, 0xF1, 0xF7, 0xF5, 0xFB, 0xFB, 0xFC, 
-    0xFC, 0xFB, 0xF7, 0xF8, 0xFA, 0xFA, 0x01, 0x08, 0x0B, 0x0B, 0x07, 0x06, 
-    0x05, 0x0D, 0x0E, 0x13, 0x18, 0x18, 0x1C, 0x1C, 0x17, 0x17, 0x15, 0x19, 
-    0x1F, 0x23, 0x28, 0x28, 0x30, 0x31, 0x35, 0x33, 0x35, 0x33, 0x32, 0x32, 
-    0x35, 0x34, 0x36, 0x38, 0x36, 0x39, 0x2E, 0x2C, 0x24, 0x25, 0x2A, 0x30, 
-    0x35, 0x36, 0x2E, 0x27, 0x26, 0x1F, 0x23, 0x22, 0x21, 0x23, 0x27, 0x27, 
-    0x2A, 0x2B, 0x27, 0x27, 0x26, 0x28, 0x28, 0x2C, 0x30, 0x2C, 0x24, 0x1B, 
-    0x13, 0x0E, 0x10, 0x10, 0x15, 0x19, 0x1A, 0x1A, 0x15, 0x0F, 0x07, 0x02, 
-    0x01, 0x02, 0x01, 0xFF, 0xFB, 0xF7, 0xF9, 0xF9, 0xF5, 0xF1, 0xF0, 0xEF, 
-    0xEC, 0xE9, 0xE7, 0xE7, 0xE6, 0xE8, 0xE8, 0xE9, 0xE8, 0xE7, 0xEC, 0xEE, 
-    0xF2, 0xF3, 0xF1, 0xEC, 0xE2, 0xD9, 0xD1, 0xD4, 0xD6, 0xDB, 0xE0, 0xDF, 
-    0xE4, 0xE5, 0xE7, 0xE5, 0xDF, 0xD9, 0xD8, 0xDA, 0xE3, 0xEC, 0xEB, 0xEC, 
-    0xE7, 0xDF, 0xDE, 0xDB, 0xDA, 0xE0, 0xE3, 0xE8, 0xE7, 0xE7, 0xE1, 0xDE, 
-    0xDD, 0xDE, 0xDF, 0xE1, 0xE5, 0xE4, 0xEA, 0xE9, 0xE6, 0xE3, 0xE1, 0xE1, 
-    0xE6, 0xEA, 0xEC, 0xF0, 0xF0, 0xF4, 0xF0, 0xEE, 0xEF, 0xEA, 0xEB, 0xF0, 
-    0xF3, 0xFB, 0xFE, 0xFA, 0xF8, 0xF1, 0xE8, 0xE5, 0xE6, 0xEA, 0xEB, 0xE8, 
-    0xE9, 0xE3, 0xE6, 0xE8, 0xE6, 0xE8, 0xE6, 0xEA, 0xEC, 0xF0, 0xF2, 0xF5, 
-    0xF4, 0xEE, 0xED, 0xE9, 0xE9, 0xEB, 0xF2, 0xFA, 0xFD, 0xFF, 0xFE, 0x01, 
-    0xFB, 0xF7, 0xF4, 0xF4, 0xF7, 0xFB, 0x03, 0x06, 0x0C, 0x0E, 0x0C, 0x08, 
-    0x05, 0x03, 0x09, 0x0D, 0x15, 0x17, 0x1A, 0x18, 0x12, 0x10, 0x0C, 0x0C, 
-    0x0D, 0x12, 0x19, 0x1D, 0x1B, 0x17, 0x0C, 0x06, 0x03, 0x02, 0x0B, 0x11, 
-    0x13, 0x15, 0x12, 0x13, 0x11, 0x12, 0x13, 0x10, 0x13, 0x17, 0x1A, 0x1A, 
-    0x1C, 0x1B, 0x19, 0x15, 0x12, 0x10, 0x12, 0x19, 0x19, 0x1E, 0x1C, 0x19, 
-    0x18, 0x15, 0x16, 0x13, 0x12, 0x13, 0x14, 0x18, 0x1B, 0x1E, 0x1C, 0x1A, 
-    0x19, 0x17, 0x15, 0x19, 0x1E, 0x20, 0x24, 0x25, 0x24, 0x23, 0x20, 0x1C, 
-    0x19, 0x1A, 0x20, 0x25, 0x28, 0x29, 0x24, 0x1B, 0x13, 0x0B, 0x07, 0x08, 
-    0x08, 0x0B, 0x0D, 0x0A, 0x0C, 0x0A, 0x04, 0x05, 0x03, 0x02, 0x05, 0x0A, 
-    0x0D, 0x0B, 0x07, 0x00, 0xF5, 0xEE, 0xE9, 0xE7, 0xED, 0xF3, 0xF7, 0xFA, 
-    0xF7, 0xF4, 0xED, 0xE9, 0xEC, 0xEF, 0xF0, 0xF2, 0xF0, 0xF0, 0xF1, 0xEF, 
-    0xEE, 0xEE, 0xED, 0xEE, 0xF4, 0xF9, 0xFA, 0xFB, 0xF8, 0xF7, 0xF8, 0xF7, 
-    0xF9, 0xF9, 0xF8, 0xF9, 0xFD, 0x01, 0xFE, 0xFB, 0xF5, 0xEC, 0xE6, 0xE2, 
-    0xDE, 0xDF, 0xDF, 0xDF, 0xDD, 0xDA, 0xDC, 0xD9, 0xD5, 0xD0, 0xCB, 0xCF, 
-    0xD4, 0xDA, 0xDE, 0xE1, 0xDE, 0xD8, 0xD5, 0xD1, 0xD5, 0xDA, 0xE3, 0xEC, 
-    0xF1, 0xF0, 0xE8, 0xE3, 0xDC, 0xDE, 0xDF, 0xE4, 0xE9, 0xED, 0xF4, 0xF1, 
-    0xF0, 0xEF, 0xEE, 0xF0, 0xF0, 0xF4, 0xF9, 0xFE, 0x00, 0xFC, 0xF7, 0xF6, 
-    0xF3, 0xF4, 0xF8, 0xF9, 0xFD, 0x02, 0x07, 0x09, 0x07, 0x00, 0xFA, 0xF4, 
-    0xF4, 0xF3, 0xF6, 0xF4, 0xF1, 0xF0, 0xEC, 0xEC, 0xE9, 0xEA, 0xE8, 0xE8, 
-    0xE9, 0xEB, 0xF0, 0xF2, 0xF2, 0xF1, 0xED, 0xE9, 0xE6, 0xE4, 0xE5, 0xEA, 
-    0xF1, 0xF5, 0xF7, 0xF0, 0xEB, 0xE8, 0xE7, 0xE8, 0xEA, 0xEE, 0xEF, 0xF4, 
-    0xF7, 0xFC, 0xFD, 0xFA, 0xF6, 0xF5, 0xF6, 0xFB, 0x03, 0x09, 0x0E, 0x0C, 
-    0x0A, 0x0A, 0x08, 0x09, 0x0A, 0x0F, 0x16, 0x1D, 0x20, 0x1E, 0x15, 0x0C, 
-    0x03, 0x00, 0x03, 0x0A, 0x10, 0x11, 0x0E, 0x08, 0x06, 0x02, 0x06, 0x05, 
-    0x09, 0x0B, 0x0D, 0x12, 0x10, 0x0B, 0x04, 0xFE, 0xFA, 0xF8, 0xF9, 0xFE, 
-    0x00, 0x03, 0x03, 0x04, 0x01, 0x00, 0x03, 0x02, 0x03, 0x04, 0x00, 0xFF, 
-    0x01, 0x01, 0x05, 0x09, 0x0C, 0x0E, 0x0A, 0x08, 0x05, 0x0B, 0x11, 0x15, 
-    0x18, 0x15, 0x16, 0x14, 0x11, 0x0F, 0x11, 0x19, 0x1D, 0x26, 0x26, 0x21, 
-    0x1C, 0x10, 0x0A, 0x0A, 0x0A, 0x11, 0x13, 0x13, 0x11, 0x0E, 0x07, 0x04, 
-    0x06, 0x08, 0x0D, 0x11, 0x16, 0x16, 0x17, 0x14, 0x0E, 0x08, 0x06, 0x05, 
-    0x09, 0x11, 0x15, 0x16, 0x11, 0x0B, 0x05, 0x05, 0x05, 0x0A, 0x0B, 0x0D, 
-    0x0E, 0x0C, 0x0E, 0x12, 0x15, 0x17, 0x1A, 0x17, 0x1A, 0x1B, 0x1C, 0x1D, 
-    0x19, 0x14, 0x13, 0x13, 0x13, 0x14, 0x12, 0x16, 0x19, 0x1C, 0x21, 0x23, 
-    0x21, 0x1C, 0x17, 0x12, 0x11, 0x0F, 0x10, 0x0D, 0x0A, 0x0A, 0x07, 0x0A, 
-    0x0B, 0x0B, 0x0A, 0x07, 0x08, 0x0B, 0x0F, 0x14, 0x13, 0x10, 0x0D, 0x05, 
-    0x02, 0x02, 0x04, 0x09, 0x0D, 0x0F, 0x10, 0x0E, 0x09, 0x03, 0x01, 0x00, 
-    0xFD, 0xFF, 0xFD, 0xFD, 0xFE, 0xFF, 0xFC, 0xFB, 0xFB, 0xFC, 0x00, 0x06, 
-    0x0A, 0x09, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0x04, 0x08, 0x10, 0x13, 0x13, 
-    0x0C, 0x08, 0x04, 0xFF, 0xFD, 0x00, 0x01, 0x01, 0xFD, 0xF7, 0xF2, 0xEE, 
-    0xF3, 0xF4, 0xFC, 0xFD, 0xFC, 0xFA, 0xF4, 0xF1, 0xEF, 0xEC, 0xE9, 0xE7, 
-    0xE2, 0xDF, 0xDE, 0xDC, 0xE1, 0xE4, 0xE5, 0xE5, 0xE3, 0xE1, 0xDD, 0xDB, 
-    0xD6, 0xD1, 0xD1, 0xD1, 0xD6, 0xDA, 0xDD, 0xDF, 0xDE, 0xDA, 0xD7, 0xD7, 
-    0xDA, 0xDE, 0xE2, 0xE0, 0xDC, 0xD7, 0xD4, 0xD4, 0xD3, 0xD8, 0xDD, 0xE2, 
-    0xE7, 0xE6, 0xE3, 0xDB, 0xD2, 0xCC, 0xCD, 0xD1, 0xD3, 0xD1, 0xCF, 0xCB, 
-    0xCA, 0xCD, 0xD2, 0xD6, 0xDB, 0xDF, 0xE3, 0xE7, 0xE9, 0xEB, 0xE8, 0xE8, 
-    0xE5, 0xE4, 0xE4, 0xE7, 0xEC, 0xF1, 0xF5, 0xF3, 0xF2, 0xF0, 0xF3, 0xF5, 
-    0xF8, 0xFC, 0xFF, 0xFD, 0xFB, 0xFC, 0xFD, 0x01, 0x08, 0x0D, 0x11, 0x13, 
-    0x11, 0x0F, 0x0F, 0x0D, 0x0A, 0x09, 0x05, 0x07, 0x06, 0x04, 0x04, 0x06, 
-    0x0B, 0x0F, 0x12, 0x13, 0x10, 0x0E, 0x0C, 0x08, 0x06, 0x05, 0x04, 0x05, 
-    0x07, 0x06, 0x09, 0x09, 0x0C, 0x09, 0x0C, 0x0D, 0x0F, 0x18, 0x1A, 0x1C, 
-    0x16, 0x0D, 0x09, 0x07, 0x08, 0x0E, 0x17, 0x1D, 0x20, 0x1C, 0x15, 0x0E, 
-    0x0A, 0x0C, 0x13, 0x19, 0x1C, 0x1A, 0x15, 0x14, 0x14, 0x18, 0x1C, 0x1F, 
-    0x20, 0x21, 0x24, 0x24, 0x21, 0x1B, 0x17, 0x17, 0x1A, 0x1E, 0x1F, 0x1F, 
-    0x1E, 0x1D, 0x1B, 0x1B, 0x17, 0x13, 0x11, 0x11, 0x0E, 0x0B, 0x09, 0x05, 
-    0x08, 0x07, 0x07, 0x0C, 0x0D, 0x12, 0x10, 0x0B, 0x07, 0x08, 0x0D, 0x11, 
-    0x12, 0x0F, 0x09, 0x04, 0xFE, 0xFB, 0x00, 0x06, 0x10, 0x17, 0x16, 0x14, 
-    0x10, 0x0E, 0x0C, 0x0B, 0x0E, 0x10, 0x10, 0x0E, 0x0C, 0x0D, 0x0E, 0x10, 
-    0x11, 0x12, 0x14, 0x17, 0x1A, 0x1C, 0x1A, 0x15, 0x10, 0x0B, 0x0B, 0x0A, 
-    0x0B, 0x0E, 0x10, 0x10, 0x0C, 0x07, 0xFF, 0xFB, 0xFA, 0xF7, 0xF6, 0xF6, 
-    0xF3, 0xEF, 0xE7, 0xE0, 0xDE, 0xE2, 0xE4, 0xE7, 0xEA, 0xEB, 0xEC, 0xEB, 
-    0xE8, 0xE5, 0xE1, 0xE0, 0xDE, 0xDD, 0xDE, 0xDD, 0xDE, 0xE1, 0xE4, 0xE3, 
-    0xE2, 0xE3, 0xE3, 0xE6, 0xEA, 0xE9, 0xE9, 0xE7, 0xE8, 0xEA, 0xF0, 0xF4, 
-    0xF7, 0xF6, 0xF2, 0xF0, 0xEF, 0xF0, 0xF5, 0xF7, 0xF6, 0xF4, 0xEF, 0xEC, 
-    0xE8, 0xEB, 0xEF, 0xF5, 0xFB, 0xFF, 0xFE, 0xFB, 0xF3, 0xEB, 0xE6, 0xE7, 
-    0xEC, 0xF0, 0xEE, 0xEA, 0xE7, 0xE2, 0xE2, 0xE1, 0xE2, 0xE7, 0xEB, 0xF0, 
-    0xF3, 0xF1, 0xED, 0xE6, 0xE2, 0xE5, 0xE8, 0xED, 0xF2, 0xF6, 0xF9, 0xFB, 
-    0xF8, 0xF5, 0xF3, 0xF5, 0xF8, 0xFC, 0xFE, 0xFF, 0xFE, 0xFC, 0xFA, 0xFB, 
-    0x03, 0x0B, 0x13, 0x19, 0x19, 0x19, 0x1A, 0x1B, 0x1D, 0x1D, 0x1A, 0x15, 
-    0x13, 0x14, 0x17, 0x18, 0x1A, 0x1B, 0x1E, 0x1F, 0x1E, 0x1D, 0x19, 0x17, 
-    0x18, 0x19, 0x1B, 0x1A, 0x18, 0x17, 0x15, 0x16, 0x14, 0x14, 0x15, 0x19, 
-    0x19, 0x18, 0x17, 0x10, 0x0C, 0x05, 0xFE, 0xF8, 0xF5, 0xF8, 0xFF, 0x08, 
-    0x11, 0x16, 0x15, 0x0F, 0x08, 0x05, 0x06, 0x09, 0x0D, 0x10, 0x11, 0x11, 
-    0x12, 0x12, 0x10, 0x12, 0x11, 0x12, 0x15, 0x19, 0x1B, 0x1B, 0x17, 0x12, 
-    0x0D, 0x0C, 0x10, 0x14, 0x1B, 0x1E, 0x1D, 0x17, 0x10, 0x0B, 0x08, 0x06, 
-    0x06, 0x09, 0x0C, 0x0C, 0x08, 0x00, 0xF9, 0xF8, 0xFB, 0x01, 0x04, 0x05, 
-    0x04, 0x01, 0xFE, 0xFC, 0xFC, 0xFD, 0xFE, 0xFC, 0xF9, 0xF6, 0xF2, 0xF2, 
-    0xF3, 0xF7, 0xFC, 0x00, 0x01, 0xFC, 0xF7, 0xF1, 0xF2, 0xF6, 0xF9, 0xFB, 
-    0xFC, 0xFF, 0x04, 0x07, 0x06, 0x02, 0x00, 0x03, 0x07, 0x0D, 0x0E, 0x0C, 
-    0x05, 0xFD, 0xF8, 0xF5, 0xFA, 0x01, 0x0A, 0x10, 0x10, 0x0D, 0x04, 0xFE, 
-    0xFC, 0xFA, 0xFB, 0xFA, 0xF9, 0xF5, 0xED, 0xE8, 0xE3, 0xE3, 0xE8, 0xEE, 
-    0xF1, 0xF2, 0xF2, 0xEF, 0xEC, 0xE7, 0xE6, 0xE2, 0xE2, 0xDF, 0xDD, 0xDC, 
-    0xDA, 0xDB, 0xDB, 0xDC, 0xDB, 0xDA, 0xD8, 0xD8, 0xD9, 0xDB, 0xDB, 0xD9, 
-    0xD6, 0xD4, 0xD6, 0xD9, 0xDF, 0xE3, 0xE6, 0xE8, 0xE8, 0xE8, 0xE7, 0xE8, 
-    0xE9, 0xEA, 0xE9, 0xE8, 0xE7, 0xE8, 0xEB, 0xED, 0xEC, 0xEA, 0xE9, 0xE8, 
-    0xE9, 0xE7, 0xE6, 0xE7, 0xE8, 0xE9, 0xE7, 0xE7, 0xE6, 0xE9, 0xEE, 0xF2, 
-    0xF4, 0xF4, 0xF4, 0xF3, 0xF6, 0xF9, 0xFA, 0xF9, 0xF6, 0xF4, 0xF2, 0xF2, 
-    0xF6, 0xFA, 0x00, 0x05, 0x06, 0x06, 0x03, 0x00, 0xFF, 0x00, 0x02, 0x06, 
-    0x06, 0x03, 0xFE, 0xFB, 0xFC, 0x02, 0x08, 0x0F, 0x13, 0x14, 0x12, 0x0D, 
-    0x07, 0x03, 0x01, 0x01, 0x03, 0x07, 0x0B, 0x0E, 0x0E, 0x0A, 0x08, 0x05, 
-    0x03, 0x05, 0x09, 0x0D, 0x0E, 0x0B, 0x08, 0x05, 0x04, 0x04, 0x05, 0x0B, 
-    0x13, 0x18, 0x1A, 0x1B, 0x1B, 0x1D, 0x1E, 0x1F, 0x1D, 0x1B, 0x18, 0x14, 
-    0x11, 0x0E, 0x0E, 0x10, 0x14, 0x18, 0x18, 0x16, 0x16, 0x17, 0x19, 0x1A, 
-    0x19, 0x18, 0x16, 0x15, 0x14, 0x16, 0x19, 0x1C, 0x1E, 0x20, 0x21, 0x1F, 
-    0x1D, 0x19, 0x15, 0x12, 0x10, 0x11, 0x12, 0x15, 0x16, 0x17, 0x17, 0x15, 
-    0x12, 0x11, 0x0F, 0x0E, 0x0D, 0x0B, 0x08, 0x05, 0x01, 0xFE, 0xFC, 0xFB, 
-    0xFC, 0xFF, 0x04, 0x09, 0x0B, 0x0B, 0x09, 0x07, 0x08, 0x07, 0x06, 0x02, 
-    0xFF, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 
-    0x06, 0x07, 0x07, 0x03, 0xFF, 0xFE, 0x01, 0x06, 0x0C, 0x10, 0x13, 0x14, 
-    0x14, 0x13, 0x11, 0x11, 0x0F, 0x0B, 0x06, 0xFF, 0xFD, 0xFE, 0x01, 0x02, 
-    0x03, 0x01, 0xFC, 0xF6, 0xF0, 0xEC, 0xEA, 0xEC, 0xF0, 0xF2, 0xF1, 0xED, 
-    0xE8, 0xE6, 0xE7, 0xEB, 0xEF, 0xF4, 0xF7, 0xF9, 0xF9, 0xF5, 0xEE, 0xE7, 
-    0xE4, 0xE4, 0xE6, 0xEA, 0xEE, 0xEE, 0xEC, 0xEB, 0xEA, 0xED, 0xEE, 0xF0, 
-    0xF1, 0xF3, 0xF3, 0xF0, 0xEB, 0xE7, 0xE6, 0xE9, 0xF0, 0xF7, 0xFD, 0xFE, 
-    0xFC, 0xF8, 0xF5, 0xF5, 0xF5, 0xF4, 0xF3, 0xF2, 0xF0, 0xED, 0xEB, 0xEA, 
-    0xEB, 0xEE, 0xEE, 0xEB, 0xE7, 0xE1, 0xDE, 0xDD, 0xDD, 0xDC, 0xDD, 0xDC, 
-    0xDB, 0xD8, 0xD8, 0xDA, 0xDD, 0xE3, 0xE9, 0xED, 0xF1, 0xF4, 0xF6, 0xF5, 
-    0xF3, 0xEE, 0xEC, 0xEC, 0xF0, 0xF5, 0xF8, 0xF9, 0xFA, 0xFB, 0xFA, 0xF9, 
-    0xF9, 0xFB, 0xFF, 0x03, 0x06, 0x08, 0x07, 0x05, 0x04, 0x06, 0x0C, 0x12, 
-    0x17, 0x1C, 0x1D, 0x1D, 0x1C, 0x19, 0x16, 0x12, 0x10, 0x0E, 0x10, 0x15, 
-    0x1A, 0x1B, 0x19, 0x16, 0x10, 0x0C, 0x08, 0x06, 0x07, 0x09, 0x09, 0x06, 
-    0x02, 0xFD, 0xFA, 0xFA, 0xFE, 0x03, 0x06, 0x09, 0x0A, 0x07, 0x03, 0x00, 
-    0xFD, 0xFD, 0xFC, 0xFB, 0xF8, 0xF6, 0xF6, 0xF7, 0xF9, 0xFD, 0xFE, 0xFF, 
-    0x01, 0x02, 0x03, 0x05, 0x07, 0x0B, 0x0D, 0x0F, 0x10, 0x11, 0x13, 0x14, 
-    0x16, 0x17, 0x19, 0x1D, 0x1F, 0x1F, 0x1C, 0x17, 0x12, 0x0E, 0x0C, 0x0E, 
-    0x12, 0x16, 0x19, 0x17, 0x11, 0x09, 0x02, 0xFF, 0x00, 0x02, 0x04, 0x06, 
-    0x04, 0xFE, 0xF7, 0xF2, 0xF1, 0xF4, 0xF9, 0xFF, 0x04, 0x06, 0x04, 0x00, 
-    0xFB, 0xF8, 0xF6, 0xF6, 0xF7, 0xF8, 0xFA, 0xF8, 0xF7, 0xF8, 0xFB, 0xFE, 
-    0x01, 0x03, 0x04, 0x04, 0x01, 0xFF, 0xFD, 0xFD, 0xFC, 0xFD, 0xFE, 0x02, 
-    0x08, 0x0B, 0x0D, 0x0D, 0x0E, 0x0D, 0x0C, 0x0B, 0x09, 0x06, 0x02, 0xFE, 
-    0xFA, 0xF9, 0xF9, 0xF8, 0xF8, 0xF7, 0xF8, 0xF8, 0xF6, 0xF3, 0xF1, 0xF3, 
-    0xF6, 0xF7, 0xF4, 0xF0, 0xEE, 0xED, 0xEC, 0xED, 0xED, 0xEE, 0xF0, 0xF1, 
-    0xF2, 0xF2, 0xF0, 0xEA, 0xE4, 0xDF, 0xE0, 0xE5, 0xEB, 0xEF, 0xEF, 0xEC, 
-    0xEB, 0xED, 0xEF, 0xEC, 0xE7, 0xE5, 0xE7, 0xF1, 0xF7, 0xFB, 0xFF, 0x07, 
-    0x0E, 0x19, 0x1D, 0x1D, 0x1A, 0x14, 0x0C, 0x02, 0xFE, 0xF8, 0x01, 0x0B, 
-    0x13, 0x15, 0x0D, 0x04, 0xFF, 0xFD, 0x00, 0x02, 0x03, 0x04, 0x04, 0x06, 
-    0x04, 0x00, 0xFB, 0xFA, 0xF9, 0xFC, 0x00, 0x02, 0x06, 0x07, 0x08, 0x08, 
-    0x06, 0x08, 0x06, 0x06, 0x02, 0xFD, 0xFA, 0xF5, 0xFB, 0x03, 0x0E, 0x12, 
-    0x11, 0x09, 0x00, 0xFD, 0xF9, 0xFE, 0x05, 0x0D, 0x1B, 0x25, 0x26, 0x20, 
-    0x14, 0x0B, 0x06, 0x06, 0x0C, 0x15, 0x1D, 0x21, 0x21, 0x1E, 0x1A, 0x17, 
-    0x13, 0x12, 0x12, 0x19, 0x1B, 0x1D, 0x1A, 0x17, 0x19, 0x15, 0x0F, 0x03, 
-    0xFC, 0xFA, 0xFD, 0x01, 0x04, 0x04, 0x07, 0x0D, 0x0F, 0x10, 0x0B, 0x03, 
-    0xFE, 0xFF, 0x03, 0x09, 0x0A, 0x0B, 0x0A, 0x09, 0x0A, 0x0A, 0x09, 0x07, 
-    0x06, 0x06, 0x04, 0x06, 0x0B, 0x13, 0x1A, 0x1A, 0x1B, 0x17, 0x14, 0x0B, 
-    0x03, 0xFE, 0xFB, 0xFF, 0x06, 0x0E, 0x0F, 0x0D, 0x04, 0xFA, 0xF3, 0xF0, 
-    0xED, 0xED, 0xF0, 0xF9, 0xFE, 0xFE, 0xFA, 0xF5, 0xF2, 0xEE, 0xEB, 0xE5, 
-    0xE3, 0xE3, 0xE7, 0xF1, 0xFF, 0x06, 0x03, 0xF9, 0xED, 0xE6, 0xE6, 0xE9, 
-    0xEE, 0xF4, 0xFA, 0x03, 0x06, 0x07, 0xFF, 0xF7, 0xF2, 0xF2, 0xF7, 0xFD, 
-    0x05, 0x08, 0x08, 0x06, 0x02, 0xFC, 0xF8, 0xF5, 0xF0, 0xF1, 0xF0, 0xEE, 
-    0xE9, 0xE5, 0xE9, 0xF1, 0xF9, 0xF8, 0xF1, 0xE6, 0xDE, 0xDA, 0xDD, 0xE1, 
-    0xE6, 0xEB, 0xEF, 0xF0, 0xED, 0xE7, 0xDD, 0xD9, 0xD8, 0xDF, 0xE9, 0xF2, 
-    0xF8, 0xF9, 0xF6, 0xF3, 0xF1, 0xEC, 0xE8, 0xE5, 0xE2, 0xE4, 0xE5, 0xE7, 
-    0xED, 0xF8, 0x03, 0x05, 0xFD, 0xEF, 0xE2, 0xD9, 0xD7, 0xD8, 0xDF, 0xE8, 
-    0xF3, 0xFC, 0xFD, 0xF5, 0xE5, 0xDA, 0xD6, 0xDB, 0xE5, 0xEF, 0xF8, 0x00, 
-    0x05, 0x06, 0x02, 0xFC, 0xF9, 0xFA, 0x02, 0x0A, 0x13, 0x16, 0x19, 0x1A, 
-    0x19, 0x16, 0x0B, 0xFC, 0xEC, 0xE3, 0xE0, 0xE6, 0xEF, 0xFB, 0x04, 0x0A, 
-    0x0A, 0x04, 0xFC, 0xF4, 0xEF, 0xEC, 0xEF, 0xF5, 0xFD, 0x05, 0x07, 0x06, 
-    0x05, 0x04, 0x02, 0x02, 0x00, 0x01, 0x04, 0x05, 0x0C, 0x17, 0x21, 0x26, 
-    0x23, 0x19, 0x0E, 0x02, 0x01, 0x08, 0x11, 0x1C, 0x23, 0x28, 0x2B, 0x2C, 
-    0x27, 0x21, 0x1A, 0x19, 0x1C, 0x22, 0x29, 0x2E, 0x2F, 0x2B, 0x27, 0x22, 
-    0x1C, 0x15, 0x12, 0x11, 0x14, 0x15, 0x16, 0x1F, 0x29, 0x31, 0x2E, 0x20, 
-    0x09, 0xF2, 0xE6, 0xE4, 0xEE, 0xFA, 0x08, 0x0F, 0x11, 0x0B, 0xFE, 0xF5, 
-    0xEF, 0xF3, 0xFB, 0x06, 0x12, 0x19, 0x1C, 0x18, 0x0F, 0x08, 0x03, 0x01, 
-    0x02, 0x05, 0x09, 0x0D, 0x10, 0x13, 0x1B, 0x20, 0x23, 0x1F, 0x15, 0x08, 
-    0xFD, 0xFA, 0x00, 0x0C, 0x17, 0x21, 0x25, 0x21, 0x15, 0x06, 0xFD, 0xFB, 
-    0xFF, 0x05, 0x0C, 0x15, 0x1A, 0x17, 0x0D, 0x00, 0xF6, 0xF1, 0xF1, 0xF4, 
-    0xF7, 0xFB, 0xFC, 0xFF, 0x06, 0x0B, 0x0F, 0x0A, 0xFE, 0xED, 0xE0, 0xD7, 
-    0xD7, 0xDF, 0xEA, 0xF6, 0x01, 0x06, 0x01, 0xF5, 0xE6, 0xDC, 0xD9, 0xDD, 
-    0xE7, 0xF5, 0x00, 0x06, 0x05, 0xFD, 0xF3, 0xEB, 0xE5, 0xE3, 0xE2, 0xE3, 
-    0xE8, 0xEE, 0xF9, 0x03, 0x05, 0xFF, 0xF1, 0xE2, 0xD7, 0xD6, 0xDE, 0xE9, 
-    0xF5, 0xFC, 0x00, 0x03, 0x00, 0xF7, 0xEC, 0xE3, 0xDE, 0xDF, 0xE7, 0xF1, 
-    0xFA, 0xFE, 0xFB, 0xF6, 0xF0, 0xEB, 0xE6, 0xE3, 0xE2, 0xE4, 0xE7, 0xEA, 
-    0xEE, 0xF5, 0xFA, 0xF8, 0xEE, 0xDE, 0xD0, 0xC9, 0xCC, 0xD5, 0xDF, 0xE7, 
-    0xEB, 0xEC, 0xEA, 0xE3, 0xDB, 0xD7, 0xD7, 0xD9, 0xDD, 0xE2, 0xEA, 0xF3, 
-    0xF8, 0xF8, 0xF4, 0xF0, 0xED, 0xED, 0xEF, 0xF2, 0xF6, 0xFD, 0x09, 0x19, 
-    0x2A, 0x31, 0x2B, 0x1B, 0x05, 0xF4, 0xED, 0xEE, 0xF5, 0xFD, 0x03, 0x07, 
-    0x05, 0xFD, 0xF1, 0xE7, 0xE1, 0xE0, 0xE6, 0xF3, 0x02, 0x0C, 0x0D, 0x04, 
-    0xFB, 0xF3, 0xF0, 0xF0, 0xF0, 0xF3, 0xF8, 0xFE, 0x05, 0x0F, 0x17, 0x1B, 
-    0x16, 0x0B, 0xFD, 0xF1, 0xED, 0xEF, 0xF9, 0x06, 0x10, 0x17, 0x19, 0x15, 
-    0x0B, 0x01, 0xFC, 0xFE, 0x07, 0x15, 0x21, 0x2A, 0x2E, 0x2A, 0x23, 0x1C, 
-    0x17, 0x17, 0x1A, 0x1C, 0x1F, 0x20, 0x20, 0x24, 0x2D, 0x35, 0x36, 0x2F, 
-    0x21, 0x16, 0x0F, 0x0F, 0x13, 0x18, 0x1C, 0x1D, 0x1E, 0x1D, 0x15, 0x09, 
-    0xFD, 0xF6, 0xF6, 0xFB, 0x05, 0x0F, 0x18, 0x1D, 0x1C, 0x16, 0x0F, 0x09, 
-    0x06, 0x05, 0x05, 0x06, 0x0A, 0x11, 0x1B, 0x22, 0x1F, 0x12, 0xFE, 0xEF, 
-    0xEA, 0xED, 0xF7, 0x02, 0x0C, 0x12, 0x15, 0x14, 0x0E, 0x06, 0x00, 0xFC, 
-    0xFC, 0x01, 0x0B, 0x16, 0x1E, 0x1F, 0x17, 0x0F, 0x09, 0x05, 0x02, 0xFE, 
-    0xFB, 0xFB, 0xFE, 0x06, 0x0E, 0x15, 0x16, 0x0D, 0xFF, 0xF1, 0xEA, 0xEB, 
-    0xF4, 0xFC, 0x02, 0x04, 0x07, 0x08, 0x04, 0xFB, 0xF1, 0xED, 0xEF, 0xF6, 
-    0xFD, 0x00, 0x02, 0x00, 0xFC, 0xFA, 0xF8, 0xF8, 0xFA, 0xFC, 0xFB, 0xFB, 
-    0xFB, 0xFB, 0xFE, 0x03, 0x09, 0x09, 0xFE, 0xED, 0xDB, 0xD2, 0xD2, 0xD9, 
-    0xE2, 0xE9, 0xEF, 0xF4, 0xF3, 0xEA, 0xDD, 0xD5, 0xD3, 0xD8, 0xE2, 0xED, 
-    0xF6, 0xF9, 0xF6, 0xEC, 0xE2, 0xDB, 0xD8, 0xDC, 0xE0, 0xE2, 0xE5, 0xE7, 
-    0xEE, 0xF9, 0x02, 0x02, 0xF7, 0xEA, 0xDF, 0xDA, 0xDA, 0xDE, 0xE6, 0xEF, 
-    0xF8, 0xFD, 0xFD, 0xF7, 0xEE, 0xE6, 0xE2, 0xE2, 0xE8, 0xEF, 0xF6, 0xF7, 
-    0xF2, 0xE8, 0xDE, 0xD7, 0xD4, 0xD6, 0xDA, 0xDE, 0xE2, 0xE6, 0xEA, 0xF1, 
-    0xF8, 0xFC, 0xFB, 0xF4, 0xEC, 0xEC, 0xF1, 0xFA, 0x01, 0x05, 0x09, 0x0B, 
-    0x0C, 0x07, 0xFF, 0xF6, 0xEF, 0xEE, 0xF0, 0xF3, 0xF6, 0xF6, 0xF6, 0xF4, 
-    0xF2, 0xF0, 0xEF, 0xEE, 0xEF, 0xF2, 0xF7, 0x00, 0x08, 0x12, 0x19, 0x1A, 
-    0x15, 0x0A, 0xFD, 0xF5, 0xF3, 0xF6, 0xFD, 0x05, 0x0B, 0x10, 0x12, 0x0D, 
-    0x07, 0x00, 0xFC, 0xFC, 0xFF, 0x05, 0x0C, 0x13, 0x1A, 0x1D, 0x1A, 0x14, 
-    0x0F, 0x0E, 0x13, 0x1A, 0x1E, 0x21, 0x26, 0x2D, 0x35, 0x38, 0x33, 0x26, 
-    0x17, 0x0A, 0x05, 0x07, 0x0E, 0x16, 0x1D, 0x22, 0x22, 0x1D, 0x12, 0x06, 
-    0xFF, 0xFF, 0x04, 0x0B, 0x0E, 0x0E, 0x0A, 0x03, 0xFC, 0xF6, 0xF3, 0xF5, 
-    0xFA, 0x01, 0x07, 0x0B, 0x0E, 0x13, 0x1B, 0x25, 0x29, 0x26, 0x1C, 0x12, 
-    0x09, 0x06, 0x06, 0x08, 0x0F, 0x16, 0x1E, 0x22, 0x1E, 0x14, 0x0B, 0x05, 
-    0x05, 0x08, 0x0F, 0x18, 0x1F, 0x20, 0x1B, 0x12, 0x0A, 0x04, 0x02, 0x04, 
-    0x06, 0x09, 0x0A, 0x09, 0x0A, 0x0B, 0x09, 0x02, 0xF8, 0xEE, 0xE6, 0xE0, 
-    0xDD, 0xDE, 0xE5, 0xF0, 0xFB, 0x01, 0xFD, 0xF4, 0xEC, 0xE9, 0xED, 0xF2, 
-    0xFA, 0x02, 0x09, 0x0F, 0x11, 0x0E, 0x06, 0xFD, 0xF7, 0xF8, 0xFD, 0x03, 
-    0x0A, 0x11, 0x16, 0x19, 0x18, 0x12, 0x06, 0xFA, 0xF1, 0xEF, 0xF3, 0xF8, 
-    0xFB, 0xFC, 0xFB, 0xF9, 0xF6, 0xEF, 0xE8, 0xE3, 0xE3, 0xE5, 0xE9, 0xEB, 
-    0xED, 0xF1, 0xF4, 0xF5, 0xF3, 0xF0, 0xEF, 0xEF, 0xF0, 0xF1, 0xF5, 0xF7, 
-    0xFA, 0xFE, 0x01, 0x04, 0x01, 0xF7, 0xEC, 0xE4, 0xE0, 0xDF, 0xE2, 0xE8, 
-    0xF0, 0xF6, 0xF5, 0xEE, 0xE6, 0xE2, 0xE2, 0xE5, 0xEA, 0xEF, 0xF2, 0xF2, 
-    0xF0, 0xEC, 0xE8, 0xE1, 0xDC, 0xD9, 0xD8, 0xDB, 0xDF, 0xE6, 0xEE, 0xF9, 
-    0x02, 0x06, 0x03, 0xF8, 0xED, 0xE7, 0xE7, 0xEC, 0xF4, 0xFF, 0x0B, 0x16, 
-    0x1B, 0x17, 0x0F, 0x09, 0x09, 0x0B, 0x0F, 0x12, 0x10, 0x0D, 0x06, 0x00, 
-    0xF8, 0xF0, 0xE7, 0xE2, 0xE3, 0xE8, 0xEE, 0xF2, 0xF4, 0xF4, 0xF8, 0xFD, 
-    0x02, 0x00, 0xF9, 0xF0, 0xEA, 0xEA, 0xEE, 0xF5, 0xFD, 0x05, 0x0A, 0x0C, 
-    0x08, 0x03, 0x02, 0x04, 0x08, 0x0B, 0x0E, 0x10, 0x10, 0x0E, 0x0B, 0x06, 
-    0x03, 0x03, 0x05, 0x0A, 0x0E, 0x15, 0x1B, 0x22, 0x2A, 0x32, 0x37, 0x34, 
-    0x2B, 0x21, 0x19, 0x15, 0x16, 0x19, 0x1C, 0x1E, 0x22, 0x21, 0x1C, 0x14, 
-    0x10, 0x0E, 0x0E, 0x0F, 0x0E, 0x10, 0x10, 0x11, 0x0F, 0x09, 0x01, 0xF7, 
-    0xF0, 0xEE, 0xEE, 0xF4, 0xF8, 0xFD, 0x05, 0x0C, 0x11, 0x11, 0x09, 0x00, 
-    0xF9, 0xF7, 0xFA, 0x00, 0x08, 0x0D, 0x0E, 0x0B, 0x04, 0xFE, 0xFB, 0xFD, 
-    0x03, 0x0A, 0x0F, 0x11, 0x0E, 0x09, 0x05, 0x02, 0x00, 0xFD, 0xFC, 0xFD, 
-    0xFF, 0x00, 0x01, 0x02, 0x06, 0x0E, 0x16, 0x19, 0x14, 0x09, 0xFD, 0xF5, 
-    0xF3, 0xF6, 0xFD, 0x06, 0x0D, 0x0E, 0x09, 0x02, 0xFB, 0xF8, 0xF6, 0xF8, 
-    0xFB, 0xFF, 0x03, 0x05, 0x04, 0x00, 0xFB, 0xF7, 0xF5, 0xF6, 0xF8, 0xF9, 
-    0xFA, 0xF9, 0xFA, 0xFE, 0x04, 0x08, 0x07, 0xFF, 0xF5, 0xED, 0xEA, 0xEB, 
-    0xED, 0xF2, 0xF7, 0xFC, 0xFB, 0xF4, 0xEC, 0xE7, 0xE6, 0xE9, 0xEE, 0xF2, 
-    0xF6, 0xF9, 0xF9, 0xF5, 0xEF, 0xEA, 0xE7, 0xE8, 0xEC, 0xF2, 0xF8, 0xFE, 
-    0x01, 0x05, 0x08, 0x0B, 0x0A, 0x03, 0xFA, 0xF0, 0xEB, 0xEA, 0xED, 0xF1, 
-    0xF6, 0xFA, 0xF9, 0xF2, 0xEB, 0xE8, 0xE7, 0xE7, 0xE8, 0xEA, 0xEE, 0xF2, 
-    0xF4, 0xF2, 0xEF, 0xEC, 0xE9, 0xE7, 0xEB, 0xEF, 0xF2, 0xF3, 0xF3, 0xF6, 
-    0xFC, 0x01, 0x04, 0x01, 0xF8, 0xF0, 0xE9, 0xE6, 0xE9, 0xED, 0xF2, 0xF8, 
-    0xFC, 0xFE, 0xFB, 0xF9, 0xFA, 0xFC, 0xFE, 0x00, 0x05, 0x0B, 0x0F, 0x0E, 
-    0x08, 0x02, 0xFC, 0xFA, 0xFB, 0xFE, 0x00, 0x01, 0x01, 0x02, 0x04, 0x06, 
-    0x09, 0x05, 0xFC, 0xF2, 0xEC, 0xEF, 0xF7, 0xFF, 0x06, 0x0D, 0x13, 0x15, 
-    0x12, 0x0C, 0x09, 0x0A, 0x0D, 0x11, 0x14, 0x16, 0x17, 0x14, 0x0D, 0x05, 
-    0xFD, 0xF9, 0xF8, 0xF9, 0xFB, 0xFC, 0xFD, 0x00, 0x04, 0x0B, 0x12, 0x14, 
-    0x13, 0x0F, 0x09, 0x07, 0x07, 0x0A, 0x0F, 0x13, 0x19, 0x1C, 0x1C, 0x1A, 
-    0x19, 0x19, 0x1B, 0x1E, 0x1F, 0x21, 0x24, 0x24, 0x21, 0x1A, 0x12, 0x0E, 
-    0x0C, 0x0E, 0x10, 0x10, 0x0F, 0x0D, 0x0E, 0x12, 0x17, 0x19, 0x14, 0x0C, 
-    0x03, 0xFC, 0xFB, 0xFD, 0x03, 0x08, 0x0D, 0x0D, 0x0B, 0x09, 0x06, 0x06, 
-    0x05, 0x06, 0x07, 0x0B, 0x0F, 0x11, 0x10, 0x0A, 0x05, 0xFF, 0xFA, 0xF8, 
-    0xF9, 0xFC, 0x00, 0x00, 0x01, 0x04, 0x08, 0x0C, 0x0B, 0x02, 0xF7, 0xEF, 
-    0xEE, 0xF1, 0xF4, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0, 0xEE, 0xEA, 0xE8, 0xE9, 
-    0xEC, 0xEF, 0xF0, 0xF2, 0xF2, 0xF0, 0xED, 0xED, 0xEF, 0xF3, 0xF7, 0xF8, 
-    0xF6, 0xF3, 0xF1, 0xF5, 0xFD, 0x05, 0x07, 0x01, 0xF7, 0xF1, 0xF0, 0xF3, 
-    0xF6, 0xF7, 0xFA, 0xFE, 0x00, 0xFE, 0xFA, 0xF7, 0xF5, 0xF6, 0xF7, 0xF6, 
-    0xF6, 0xF7, 0xFA, 0xFA, 0xF8, 0xF4, 0xF1, 0xF0, 0xF0, 0xEF, 0xEB, 0xE9, 
-    0xE9, 0xED, 0xF3, 0xF8, 0xFB, 0xF7, 0xF1, 0xEA, 0xE6, 0xE5, 0xE6, 0xE9, 
-    0xEB, 0xF0, 0xF4, 0xF4, 0xF3, 0xF0, 0xED, 0xEC, 0xEF, 0xF1, 0xF4, 0xF6, 
-    0xF5, 0xF2, 0xED, 0xEB, 0xEA, 0xEC, 0xF0, 0xF3, 0xF4, 0xF2, 0xEE, 0xEF, 
-    0xF4, 0xF9, 0xFC, 0xF8, 0xF1, 0xEB, 0xE5, 0xE3, 0xE3, 0xE4, 0xE6, 0xE9, 
-    0xEA, 0xEA, 0xEC, 0xEF, 0xF4, 0xF6, 0xF6, 0xF5, 0xF4, 0xF5, 0xF6, 0xF8, 
-    0xF9, 0xFA, 0xFC, 0xFF, 0x02, 0x04, 0x04, 0x03, 0x02, 0x02, 0x07, 0x0C, 
-    0x11, 0x13, 0x0E, 0x06, 0xFE, 0xFA, 0xF9, 0xF8, 0xF7, 0xFA, 0xFF, 0x04, 
-    0x07, 0x07, 0x06, 0x05, 0x04, 0x03, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 
-    0x02, 0x05, 0x09, 0x0D, 0x0E, 0x0C, 0x09, 0x08, 0x0E, 0x16, 0x1E, 0x21, 
-    0x1B, 0x13, 0x0D, 0x0D, 0x0F, 0x14, 0x1A, 0x1F, 0x22, 0x23, 0x23, 0x24, 
-    0x27, 0x29, 0x28, 0x26, 0x24, 0x22, 0x23, 0x20, 0x1A, 0x13, 0x0F, 0x10, 
-    0x11, 0x11, 0x0D, 0x07, 0x03, 0x00, 0x00, 0x02, 0x05, 0x09, 0x0A, 0x05, 
-    0xFE, 0xF8, 0xF5, 0xF3, 0xF1, 0xEE, 0xF0, 0xF3, 0xF7, 0xFD, 0x01, 0x02, 
-    0x03, 0x03, 0x05, 0x06, 0x08, 0x07, 0x06, 0x05, 0x07, 0x0D, 0x14, 0x18, 
-    0x19, 0x17, 0x13, 0x10, 0x10, 0x14, 0x1A, 0x20, 0x23, 0x1F, 0x15, 0x0B, 
-    0x03, 0xFF, 0xFC, 0xFA, 0xF8, 0xF8, 0xF9, 0xFB, 0xFB, 0xF8, 0xF7, 0xF5, 
-    0xF6, 0xF5, 0xF4, 0xF3, 0xF5, 0xF6, 0xF6, 0xF7, 0xF8, 0xFA, 0xFB, 0xFB, 
-    0xFD, 0xFF, 0x02, 0x07, 0x0C, 0x10, 0x13, 0x0F, 0x07, 0xFF, 0xF9, 0xF6, 
-    0xF5, 0xF6, 0xF7, 0xF9, 0xF9, 0xF8, 0xF8, 0xF9, 0xF8, 0xF5, 0xF0, 0xEC, 
-    0xE9, 0xE9, 0xE8, 0xE7, 0xE6, 0xE7, 0xEB, 0xF1, 0xF6, 0xF6, 0xF2, 0xED, 
-    0xEA, 0xEB, 0xF0, 0xF5, 0xF9, 0xF9, 0xF7, 0xF3, 0xF0, 0xEE, 0xED, 0xEE, 
-    0xF0, 0xF5, 0xF6, 0xF5, 0xF4, 0xF6, 0xFA, 0xFD, 0xFE, 0xFA, 0xF6, 0xF2, 
-    0xF2, 0xF3, 0xF5, 0xF7, 0xF9, 0xFA, 0xF9, 0xF5, 0xEF, 0xEA, 0xE7, 0xE6, 
-    0xE9, 0xEE, 0xF5, 0xF8, 0xF5, 0xEB, 0xE0, 0xD8, 0xD8, 0xDB, 0xDF, 0xE0, 
-    0xE1, 0xE4, 0xE7, 0xE9, 0xE9, 0xE8, 0xE9, 0xEA, 0xEB, 0xED, 0xF0, 0xF3, 
-    0xF4, 0xF6, 0xF9, 0xFD, 0x02, 0x06, 0x06, 0x04, 0x03, 0x02, 0x06, 0x0C, 
-    0x14, 0x1A, 0x1A, 0x14, 0x0C, 0x04, 0xFF, 0xFF, 0x00, 0x03, 0x05, 0x03, 
-    0x02, 0x04, 0x06, 0x09, 0x0A, 0x08, 0x05, 0x01, 0xFD, 0xFB, 0xF7, 0xF5, 
-    0xF6, 0xF8, 0xFB, 0xFE, 0xFF, 0xFD, 0xFB, 0xF9, 0xFB, 0x00, 0x05, 0x0A, 
-    0x0B, 0x0A, 0x08, 0x07, 0x05, 0x03, 0x04, 0x08, 0x0F, 0x16, 0x1B, 0x1E, 
-    0x21, 0x23, 0x25, 0x24, 0x22, 0x1D, 0x19, 0x19, 0x1C, 0x1F, 0x21, 0x21, 
-    0x21, 0x23, 0x26, 0x24, 0x21, 0x1E, 0x1D, 0x1E, 0x1F, 0x22, 0x22, 0x1E, 
-    0x17, 0x0E, 0x09, 0x08, 0x0A, 0x0D, 0x0D, 0x0B, 0x06, 0x04, 0x06, 0x09, 
-    0x0B, 0x0C, 0x0A, 0x06, 0x02, 0xFE, 0xFC, 0xFD, 0xFE, 0x00, 0xFF, 0xFD, 
-    0xFC, 0xFB, 0xFC, 0xFD, 0xFF, 0x02, 0x06, 0x09, 0x0B, 0x09, 0x04, 0x00, 
-    0xFD, 0xFD, 0x00, 0x02, 0x04, 0x03, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04, 
-    0x04, 0x02, 0xFE, 0xF8, 0xF4, 0xF3, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 0xF9, 
-    0xFA, 0xFC, 0xFD, 0x00, 0x09, 0x11, 0x18, 0x1A, 0x16, 0x0E, 0x07, 0x02, 
-    0x00, 0x01, 0x05, 0x06, 0x04, 0x00, 0xFE, 0x00, 0x03, 0x04, 0x02, 0xFE, 
-    0xFA, 0xF6, 0xF3, 0xF0, 0xEF, 0xEE, 0xEF, 0xF1, 0xF2, 0xF3, 0xF2, 0xF1, 
-    0xF1, 0xF3, 0xF6, 0xF7, 0xF9, 0xFA, 0xF8, 0xF4, 0xF0, 0xEE, 0xEB, 0xE8, 
-    0xE6, 0xE5, 0xE5, 0xE6, 0xE9, 0xEC, 0xEE, 0xEF, 0xEC, 0xE8, 0xE4, 0xE2, 
-    0xE1, 0xE1, 0xE2, 0xE3, 0xE6, 0xE8, 0xEC, 0xF1, 0xF3, 0xF4, 0xF4, 0xF3, 
-    0xF3, 0xF7, 0xFC, 0x02, 0x04, 0x01, 0xFC, 0xF7, 0xF4, 0xF3, 0xF1, 0xEE, 
-    0xEA, 0xE7, 0xE9, 0xEE, 0xF3, 0xF8, 0xF7, 0xF4, 0xEF, 0xEA, 0xE6, 0xE5, 
-    0xE8, 0xEC, 0xF1, 0xF5, 0xF6, 0xF7, 0xF5, 0xEF, 0xEC, 0xEA, 0xED, 0xF2, 
-    0xF6, 0xFB, 0xFE, 0xFE, 0xFC, 0xFA, 0xFA, 0xFB, 0xFD, 0xFE, 0xFE, 0xFD, 
-    0xFC, 0xFF, 0x03, 0x0C, 0x12, 0x13, 0x12, 0x0F, 0x0F, 0x10, 0x11, 0x12, 
-    0x15, 0x18, 0x1A, 0x1B, 0x1A, 0x15, 0x0F, 0x09, 0x06, 0x08, 0x0C, 0x10, 
-    0x12, 0x0E, 0x05, 0xFA, 0xF1, 0xEF, 0xF3, 0xF8, 0xF9, 0xF7, 0xF5, 0xF5, 
-    0xF9, 0x00, 0x07, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x14, 0x17, 
-    0x1A, 0x1D, 0x20, 0x21, 0x1F, 0x1C, 0x1A, 0x1D, 0x21, 0x25, 0x28, 0x26, 
-    0x21, 0x1B, 0x16, 0x13, 0x11, 0x13, 0x14, 0x16, 0x18, 0x1B, 0x1C, 0x1D, 
-    0x1A, 0x13, 0x0D, 0x08, 0x06, 0x04, 0x02, 0x00, 0x02, 0x06, 0x08, 0x06, 
-    0x05, 0x02, 0xFE, 0xF9, 0xF5, 0xF6, 0xFD, 0x06, 0x0C, 0x0E, 0x0A, 0x05, 
-    0x01, 0xFF, 0xFE, 0x00, 0x02, 0x04, 0x08, 0x0D, 0x11, 0x13, 0x15, 0x13, 
-    0x0D, 0x04, 0xFC, 0xF7, 0xF8, 0xFA, 0xFB, 0xFC, 0xFB, 0xF8, 0xF6, 0xF3, 
-    0xEF, 0xED, 0xEB, 0xEB, 0xEE, 0xF2, 0xF4, 0xF8, 0xF8, 0xF6, 0xF4, 0xF5, 
-    0xF7, 0xFB, 0xFD, 0xFC, 0xF8, 0xF7, 0xFA, 0xFE, 0x03, 0x07, 0x05, 0xFF, 
-    0xFB, 0xF7, 0xF5, 0xF4, 0xF7, 0xF7, 0xF9, 0xF9, 0xFB, 0xFC, 0xFB, 0xF8, 
-    0xF8, 0xF9, 0x04, 0x11, 0x1A, 0x20, 0x19, 0x1D, 0x00, 0xEF, 0xEA, 0xCE, 
-    0xCF, 0xD3, 0xD5, 0xE3, 0xF2, 0xF3, 0x01, 0x09, 0xF9, 0xF6, 0xEC, 0xEB, 
-    0xE6, 0xDA, 0xE2, 0xDB, 0xE6, 0xFA, 0x01, 0x20, 0x12, 0xF3, 0xEF, 0xF3, 
-    0xFB, 0xFC, 0x05, 0x02, 0xFD, 0xF6, 0xF0, 0xED, 0xEB, 0xE9, 0xE3, 0xE8, 
-    0xE0, 0xE1, 0xE4, 0xE3, 0xDE, 0xE2, 0xDD, 0xC2, 0xB5, 0xA9, 0xB0, 0xBD, 
-    0xC6, 0xD5, 0xE0, 0xE1, 0xEB, 0xEC, 0xEB, 0xEE, 0xEE, 0xF5, 0xF5, 0xF9, 
-    0x02, 0x08, 0x0B, 0x0B, 0x08, 0x01, 0x01, 0xFD, 0xFC, 0x08, 0x06, 0x0A, 
-    0xFE, 0x07, 0x0E, 0x0B, 0x0D, 0x0B, 0x12, 0x0E, 0x19, 0x22, 0x2C, 0x2B, 
-    0x28, 0x30, 0x28, 0x25, 0x21, 0x15, 0x10, 0x0C, 0x0A, 0x08, 0x0D, 0x0C, 
-    0x0C, 0x0C, 0x0B, 0x0C, 0x00, 0xF9, 0xF3, 0xF3, 0xEF, 0xED, 0xEF, 0xF0, 
-    0xF1, 0xFF, 0xFC, 0x00, 0xFE, 0xF3, 0xF8, 0xF4, 0xF9, 0xFC, 0x07, 0x0D, 
-    0x12, 0x0D, 0x0A, 0x03, 0x03, 0x06, 0x0A, 0x0C, 0x0B, 0x10, 0x16, 0x25, 
-    0x28, 0x2B, 0x20, 0x1A, 0x17, 0x17, 0x17, 0x18, 0x1D, 0x21, 0x20, 0x21, 
-    0x21, 0x1A, 0x19, 0x18, 0x17, 0x19, 0x1F, 0x1C, 0x1F, 0x1A, 0x1B, 0x18, 
-    0x15, 0x0E, 0x06, 0xFE, 0xFA, 0x0C, 0x18, 0x18, 0x1B, 0x19, 0x12, 0x09, 
-    0x05, 0x09, 0x01, 0x06, 0x03, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFE, 0xF7, 
-    0xF7, 0xEF, 0xE8, 0xE5, 0xE6, 0xEE, 0xF3, 0xF5, 0xF5, 0xF3, 0xF6, 0xF8, 
-    0xF8, 0xF6, 0xED, 0xE2, 0xEB, 0xF8, 0x05, 0x0C, 0xFE, 0xF3, 0xF6, 0xFE, 
-    0xFE, 0xFC, 0x01, 0x02, 0x05, 0x09, 0x03, 0x08, 0x08, 0x0D, 0x0E, 0x08, 
-    0xFD, 0xF7, 0x07, 0x05, 0x04, 0x00, 0x03, 0x04, 0x02, 0x00, 0xF4, 0xF3, 
-    0xEF, 0xED, 0xEB, 0xED, 0xF1, 0x00, 0x01, 0x07, 0x02, 0xFA, 0xFB, 0xF3, 
-    0xFF, 0xF4, 0xF2, 0xF2, 0x02, 0x06, 0xFF, 0xF3, 0xEE, 0xF4, 0xED, 0xF1, 
-    0xF4, 0xF8, 0xE2, 0xEB, 0xED, 0xDC, 0xE0, 0xDF, 0xF1, 0xF0, 0xE6, 0xE6, 
-    0xDF, 0xDE, 0xE4, 0xE9, 0xEF, 0xFE, 0xF4, 0xF6, 0xEC, 0xE6, 0xE8, 0xE1, 
-    0xE5, 0xE6, 0xEC, 0xEA, 0xF2, 0xEF, 0xEF, 0xEA, 0xEA, 0xE2, 0xE0, 0xED, 
-    0xEB, 0xF0, 0xF1, 0xEB, 0xF1, 0xFB, 0xF6, 0xF6, 0xEC, 0xE5, 0xE9, 0xE3, 
-    0xEF, 0xFA, 0x00, 0xF7, 0xF2, 0xEE, 0xEE, 0xEC, 0xF3, 0xF4, 0xE6, 0xEA, 
-    0xE4, 0xF8, 0xFF, 0x0D, 0x0A, 0xF8, 0xEB, 0xE1, 0xE3, 0xE8, 0xFE, 0x07, 
-    0x05, 0x00, 0x0B, 0x02, 0x06, 0x0E, 0x0A, 0x05, 0x09, 0x1A, 0x1D, 0x17, 
-    0x1F, 0x22, 0x1D, 0x15, 0x0A, 0x0A, 0x04, 0x0C, 0x14, 0x12, 0x16, 0x17, 
-    0x11, 0x16, 0x19, 0x11, 0x04, 0x07, 0x0C, 0x02, 0x05, 0x0B, 0x1D, 0x25, 
-    0x1B, 0x16, 0x0E, 0x09, 0x05, 0x06, 0x02, 0x03, 0x07, 0x0C, 0x14, 0x17, 
-    0x12, 0x0D, 0x0B, 0x05, 0x04, 0x07, 0xFE, 0xF3, 0xFD, 0x05, 0x0D, 0x0E, 
-    0x0F, 0x11, 0x09, 0xFD, 0xF9, 0x01, 0x19, 0x16, 0x1A, 0x1F, 0x1C, 0x21, 
-    0x10, 0x20, 0x24, 0x1C, 0x13, 0x18, 0x14, 0x10, 0x21, 0x32, 0x33, 0x28, 
-    0x24, 0x0E, 0x02, 0xFF, 0x00, 0x08, 0x0D, 0x0C, 0x16, 0x0F, 0x07, 0x0B, 
-    0xFE, 0xFC, 0x02, 0xF5, 0xF9, 0x02, 0x04, 0x06, 0x06, 0x08, 0x02, 0xF9, 
-    0xF6, 0xF8, 0xEC, 0xE6, 0xF3, 0x00, 0x04, 0x03, 0xF6, 0xF6, 0xFA, 0xF4, 
-    0xEE, 0xE6, 0xEB, 0xEE, 0xF6, 0xFD, 0xFC, 0xFF, 0x05, 0x02, 0xFE, 0xE9, 
-    0xE8, 0xF2, 0xEC, 0xFB, 0xFE, 0xFE, 0x05, 0x01, 0x00, 0xFA, 0xF7, 0xED, 
-    0xF3, 0xF1, 0xF4, 0xFC, 0xF9, 0x08, 0x0D, 0x11, 0x0D, 0x0D, 0x04, 0x03, 
-    0x00, 0x01, 0xFA, 0x05, 0x15, 0x0D, 0x19, 0x11, 0x02, 0xFC, 0xF2, 0xEC, 
-    0xF1, 0xFC, 0xFF, 0xF6, 0xF9, 0xF5, 0xFB, 0xFA, 0xEB, 0xEA, 0xE2, 0xDC, 
-    0xDC, 0xE4, 0xEA, 0xF4, 0xFF, 0xFD, 0xF6, 0xE8, 0xE7, 0xE2, 0xE0, 0xDE, 
-    0xDF, 0xEE, 0xF2, 0xF4, 0xF5, 0xF3, 0xE8, 0xEB, 0xDA, 0xD0, 0xD6, 0xDA, 
-    0xE3, 0xF1, 0xFF, 0xF5, 0xF6, 0xEF, 0xE0, 0xDF, 0xE9, 0xE4, 0xEE, 0xE7, 
-    0xE3, 0xF5, 0xF1, 0xFD, 0xFF, 0xF4, 0xF6, 0xF0, 0xEB, 0xDE, 0xE1, 0xEB, 
-    0xEA, 0xF6, 0xF1, 0xE8, 0xE6, 0xE6, 0xDA, 0xD9, 0xD9, 0xE2, 0xE6, 0xE9, 
-    0xF6, 0xFC, 0x06, 0xFF, 0x01, 0x03, 0xFB, 0x01, 0x01, 0x03, 0x05, 0x0A, 
-    0x18, 0x18, 0x19, 0x17, 0x12, 0x10, 0x0C, 0x0C, 0x10, 0x13, 0x0E, 0x08, 
-    0x12, 0x1A, 0x12, 0x0D, 0x08, 0x04, 0xFC, 0x05, 0x0B, 0x0A, 0x15, 0x21, 
-    0x1D, 0x1B, 0x1B, 0x14, 0x0E, 0x06, 0x09, 0x0D, 0x0E, 0x11, 0x1E, 0x21, 
-    0x1F, 0x16, 0x05, 0x01, 0x07, 0x09, 0x07, 0x07, 0x0F, 0x17, 0x14, 0x13, 
-    0x10, 0x09, 0x03, 0x04, 0x08, 0x07, 0x08, 0x10, 0x10, 0x12, 0x0B, 0x0C, 
-    0x0E, 0x07, 0x0D, 0x07, 0x09, 0x07, 0x08, 0x14, 0x17, 0x12, 0x10, 0x0C, 
-    0x01, 0xFF, 0xFC, 0xFF, 0x01, 0x01, 0x12, 0x11, 0x17, 0x1E, 0x15, 0x0D, 
-    0x07, 0x07, 0x08, 0x0A, 0x11, 0x10, 0x10, 0x12, 0x16, 0x16, 0x12, 0x0F, 
-    0x09, 0x07, 0x04, 0x0A, 0x02, 0x02, 0x02, 0x04, 0x07, 0x0A, 0x07, 0xFB, 
-    0xEC, 0xEA, 0xF3, 0xF9, 0xFF, 0xFD, 0x04, 0xFF, 0x06, 0x04, 0xFC, 0xEC, 
-    0xE1, 0xE8, 0xEC, 0xF1, 0xFA, 0xF8, 0xF5, 0xF7, 0xF8, 0xF0, 0xEF, 0xEE, 
-    0xDF, 0xDC, 0xE6, 0xFA, 0xFD, 0x08, 0xFF, 0xFD, 0x02, 0xF5, 0xF6, 0xF6, 
-    0xFA, 0xFC, 0x01, 0xFD, 0xFC, 0x05, 0x01, 0xFB, 0xEC, 0xF1, 0xF2, 0xEE, 
-    0xF9, 0xF3, 0x02, 0x03, 0x02, 0x09, 0xF4, 0xEF, 0xF5, 0xEE, 0xF5, 0xF0, 
-    0xE9, 0xF4, 0xFE, 0xFF, 0xFE, 0xFF, 0xFA, 0xF9, 0xF6, 0xF3, 0xF1, 0xF1, 
-    0xF0, 0xF7, 0xFA, 0x07, 0x02, 0xF5, 0xF6, 0xEB, 0xE8, 0xEE, 0xF7, 0xF5, 
-    0xF5, 0xEE, 0xEF, 0xEB, 0xE7, 0xEA, 0xEC, 0xF0, 0xE9, 0xE2, 0xDE, 0xE8, 
-    0xEE, 0xFA, 0x02, 0xFC, 0xF3, 0xEB, 0xE5, 0xE2, 0xDE, 0xDC, 0xDF, 0xE5, 
-    0xEB, 0xEA, 0xEE, 0xDF, 0xDF, 0xD5, 0xCF, 0xD0, 0xCF, 0xD9, 0xE3, 0xF0, 
-    0xE9, 0xF0, 0xEE, 0xEF, 0xED, 0xEB, 0xEE, 0xEE, 0xEF, 0xF8, 0x02, 0x00, 
-    0x09, 0x07, 0x0B, 0xFE, 0xFB, 0xFE, 0xFC, 0xFB, 0xF7, 0x05, 0x0F, 0x15, 
-    0x11, 0x0A, 0x00, 0xF9, 0xF9, 0xF9, 0x03, 0x05, 0x06, 0x12, 0x14, 0x16, 
-    0x16, 0x13, 0x13, 0x13, 0x10, 0x0D, 0x07, 0x07, 0x0E, 0x1A, 0x22, 0x1D, 
-    0x19, 0x19, 0x18, 0x1F, 0x20, 0x1B, 0x15, 0x19, 0x22, 0x23, 0x25, 0x23, 
-    0x21, 0x14, 0x06, 0x00, 0x04, 0x0D, 0x15, 0x1A, 0x1E, 0x1F, 0x1B, 0x16, 
-    0x11, 0x0B, 0x08, 0x07, 0x03, 0x03, 0x06, 0x18, 0x1B, 0x18, 0x17, 0x10, 
-    0x14, 0x12, 0x0F, 0x09, 0x02, 0x03, 0x14, 0x1A, 0x1C, 0x20, 0x15, 0x15, 
-    0x0D, 0x03, 0xFF, 0x04, 0x0B, 0x12, 0x1B, 0x1A, 0x13, 0x0D, 0x02, 0xFB, 
-    0xFE, 0xFE, 0x03, 0x02, 0x06, 0x0C, 0x0C, 0x08, 0x0B, 0x03, 0xF6, 0xF9, 
-    0xF8, 0xF3, 0xF0, 0xF4, 0xF8, 0xFF, 0x03, 0x0A, 0xFF, 0xF2, 0xEB, 0xE9, 
-    0xEB, 0xEA, 0xF6, 0xFE, 0x06, 0x08, 0x08, 0x07, 0xFC, 0xF7, 0xFC, 0xFE, 
-    0x01, 0x03, 0x0A, 0x10, 0x14, 0x0F, 0x09, 0x08, 0x03, 0xFC, 0xFB, 0xF9, 
-    0xF5, 0xFA, 0xFB, 0x02, 0x07, 0x09, 0x03, 0xF8, 0xED, 0xE6, 0xE4, 0xE4, 
-    0xEC, 0xED, 0xF0, 0xFB, 0xFC, 0xFA, 0xF7, 0xF2, 0xF3, 0xEB, 0xEB, 0xED, 
-    0xEF, 0xF7, 0xFF, 0x00, 0xFF, 0xF8, 0xF0, 0xEC, 0xE6, 0xEA, 0xEF, 0xEB, 
-    0xED, 0xF7, 0xFF, 0xFD, 0xF8, 0xEB, 0xDF, 0xDA, 0xD6, 0xDF, 0xE6, 0xF0, 
-    0xFA, 0xFD, 0x01, 0xFD, 0xF7, 0xF3, 0xE6, 0xDA, 0xDD, 0xE7, 0xF3, 0xFB, 
-    0xFF, 0x05, 0x03, 0x00, 0xF8, 0xEB, 0xE8, 0xE7, 0xEB, 0xF7, 0xFE, 0x02, 
-    0xFF, 0xF9, 0xFA, 0xF7, 0xF4, 0xED, 0xE9, 0xE9, 0xEF, 0xF9, 0xFF, 0x04, 
-    0x01, 0xF8, 0xEF, 0xE9, 0xE3, 0xDF, 0xE2, 0xE4, 0xE7, 0xE5, 0xE6, 0xF3, 
-    0xF5, 0xF6, 0xF1, 0xEB, 0xE8, 0xE4, 0xED, 0xEE, 0xF0, 0xF2, 0xF7, 0x03, 
-    0x03, 0xFC, 0xF3, 0xF0, 0xF1, 0xF2, 0xF3, 0xF8, 0x00, 0x08, 0x13, 0x0F, 
-    0x10, 0x14, 0x08, 0x03, 0xFE, 0xFD, 0x03, 0x14, 0x20, 0x25, 0x27, 0x28, 
-    0x23, 0x18, 0x16, 0x0D, 0x09, 0x0E, 0x15, 0x22, 0x2C, 0x33, 0x34, 0x2B, 
-    0x1F, 0x11, 0x07, 0x06, 0x0E, 0x13, 0x19, 0x21, 0x20, 0x1C, 0x18, 0x12, 
-    0x09, 0x08, 0x06, 0x0A, 0x0C, 0x0F, 0x14, 0x1D, 0x23, 0x22, 0x1F, 0x16, 
-    0x14, 0x14, 0x18, 0x19, 0x1E, 0x22, 0x28, 0x2C, 0x28, 0x21, 0x12, 0x0D, 
-    0x09, 0x08, 0x07, 0x04, 0x0A, 0x14, 0x15, 0x12, 0x10, 0x0B, 0x07, 0x04, 
-    0x06, 0x01, 0xFD, 0xFE, 0xFA, 0xFF, 0x09, 0x0D, 0x07, 0x04, 0x00, 0xFB, 
-    0xF9, 0xF5, 0xF1, 0xEF, 0xF5, 0xFF, 0x07, 0x08, 0x04, 0xF9, 0xED, 0xE9, 
-    0xE6, 0xE9, 0xF3, 0xFD, 0x07, 0x0D, 0x0D, 0x06, 0x02, 0xFB, 0xF6, 0xF3, 
-    0xED, 0xF3, 0xF9, 0x01, 0x09, 0x0D, 0x09, 0x02, 0xFB, 0xF5, 0xF1, 0xEC, 
-    0xEC, 0xEE, 0xFB, 0x02, 0x08, 0x05, 0xF4, 0xEC, 0xE4, 0xE2, 0xEA, 0xF2, 
-    0xF6, 0xFB, 0x01, 0x01, 0x00, 0x01, 0x01, 0xFE, 0xFD, 0x00, 0x03, 0x06, 
-    0x0D, 0x11, 0x0F, 0x12, 0x10, 0x0B, 0x05, 0xFF, 0xFB, 0xF4, 0xEF, 0xED, 
-    0xEB, 0xEE, 0xF4, 0xFB, 0xF5, 0xF1, 0xEA, 0xDF, 0xDC, 0xDE, 0xE3, 0xE6, 
-    0xE9, 0xEA, 0xF0, 0xEE, 0xEC, 0xEB, 0xE8, 0xE7, 0xE0, 0xE1, 0xE6, 0xE1, 
-    0xE2, 0xEB, 0xF2, 0xF7, 0xF5, 0xF3, 0xEB, 0xE8, 0xE6, 0xEA, 0xED, 0xF0, 
-    0xF9, 0x03, 0x09, 0x00, 0xF4, 0xE7, 0xDC, 0xD5, 0xDB, 0xE5, 0xED, 0xF6, 
-    0x02, 0x01, 0xF7, 0xEF, 0xE6, 0xDD, 0xDC, 0xDC, 0xE2, 0xE8, 0xF0, 0xF9, 
-    0xF8, 0xF5, 0xED, 0xE4, 0xE5, 0xEC, 0xF0, 0xF4, 0xF8, 0xFE, 0x03, 0x08, 
-    0x0B, 0x05, 0xFD, 0xF9, 0xF6, 0xF7, 0xF9, 0x02, 0x0D, 0x10, 0x15, 0x13, 
-    0x06, 0x03, 0x02, 0x01, 0x05, 0x08, 0x0A, 0x08, 0x07, 0x07, 0x0C, 0x0F, 
-    0x10, 0x0F, 0x0B, 0x0A, 0x0A, 0x07, 0x05, 0x0B, 0x0E, 0x12, 0x1A, 0x18, 
-    0x11, 0x0F, 0x0C, 0x0E, 0x0C, 0x0D, 0x0A, 0x0B, 0x16, 0x1A, 0x1E, 0x1B, 
-    0x15, 0x11, 0x0B, 0x07, 0x08, 0x0C, 0x12, 0x1A, 0x1E, 0x24, 0x25, 0x1F, 
-    0x17, 0x0E, 0x0C, 0x0B, 0x0E, 0x14, 0x19, 0x1F, 0x22, 0x23, 0x1F, 0x14, 
-    0x0A, 0xFE, 0xFB, 0xFF, 0x09, 0x17, 0x1F, 0x20, 0x18, 0x11, 0x0A, 0x02, 
-    0x02, 0x06, 0x09, 0x0F, 0x12, 0x16, 0x18, 0x16, 0x12, 0x0A, 0x03, 0x02, 
-    0x03, 0x08, 0x0E, 0x0C, 0x11, 0x13, 0x10, 0x0F, 0x05, 0xFB, 0xF7, 0xF4, 
-    0xF2, 0xF0, 0xF1, 0xEF, 0xF0, 0xF5, 0xF3, 0xED, 0xEE, 0xEC, 0xF0, 0xF5, 
-    0xF9, 0xF4, 0xF2, 0xF7, 0xF6, 0xF6, 0xFB, 0xFC, 0xF8, 0xF7, 0xF5, 0xF6, 
-    0xF7, 0xF5, 0xF3, 0xF6, 0xFD, 0x05, 0x09, 0x06, 0xFF, 0xF6, 0xEC, 0xEA, 
-    0xEA, 0xF2, 0xFD, 0x04, 0x0A, 0x06, 0x04, 0xFF, 0xF6, 0xF2, 0xF1, 0xF6, 
-    0xFC, 0xFE, 0x05, 0x09, 0x09, 0x07, 0x03, 0xFD, 0xF4, 0xF2, 0xF0, 0xF4, 
-    0xFC, 0xFD, 0xFC, 0xF9, 0xF1, 0xEA, 0xE7, 0xE5, 0xE4, 0xE0, 0xDC, 0xE1, 
-    0xE8, 0xF0, 0xF4, 0xF5, 0xF2, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xF4, 0xFA, 
-    0x01, 0x06, 0x05, 0xFD, 0xF8, 0xEE, 0xEC, 0xEE, 0xF1, 0xF8, 0xF6, 0xF4, 
-    0xF5, 0xF7, 0xF4, 0xF1, 0xEA, 0xE6, 0xE6, 0xE5, 0xE1, 0xDE, 0xE0, 0xE0, 
-    0xE6, 0xEB, 0xE7, 0xE8, 0xE7, 0xE3, 0xE2, 0xE2, 0xDE, 0xDF, 0xE4, 0xE9, 
-    0xF2, 0xF8, 0xF7, 0xF2, 0xE8, 0xE2, 0xDF, 0xDF, 0xE7, 0xEB, 0xF2, 0xF9, 
-    0xFF, 0x01, 0xFA, 0xF3, 0xED, 0xEB, 0xF0, 0xF4, 0xFB, 0x05, 0x09, 0x0D, 
-    0x0C, 0x07, 0x02, 0xFC, 0xFD, 0xFF, 0x00, 0x01, 0x05, 0x0A, 0x0B, 0x08, 
-    0x04, 0x02, 0xFF, 0x00, 0x03, 0x08, 0x0E, 0x12, 0x16, 0x1A, 0x1C, 0x1F, 
-    0x1F, 0x1D, 0x21, 0x1E, 0x1C, 0x1F, 0x22, 0x29, 0x28, 0x26, 0x25, 0x20, 
-    0x1C, 0x15, 0x14, 0x11, 0x10, 0x0F, 0x0C, 0x0D, 0x10, 0x12, 0x10, 0x11, 
-    0x0B, 0x08, 0x07, 0x0A, 0x10, 0x10, 0x0B, 0x0C, 0x10, 0x14, 0x19, 0x15, 
-    0x12, 0x13, 0x14, 0x0F, 0x0D, 0x0F, 0x10, 0x13, 0x15, 0x16, 0x16, 0x13, 
-    0x11, 0x0D, 0x08, 0x0A, 0x0B, 0x13, 0x17, 0x17, 0x17, 0x12, 0x0D, 0x0A, 
-    0x09, 0x08, 0x09, 0x0C, 0x0F, 0x0C, 0x0D, 0x0B, 0x09, 0x06, 0xFF, 0xFE, 
-    0xF5, 0xF2, 0xF3, 0xF6, 0xFB, 0xFD, 0xF8, 0xF1, 0xED, 0xEA, 0xEA, 0xEA, 
-    0xEA, 0xEE, 0xEE, 0xF2, 0xF8, 0xF9, 0xFA, 0xFB, 0xFA, 0xFA, 0xF9, 0xFA, 
-    0x01, 0x04, 0x06, 0x05, 0x06, 0x03, 0x01, 0xFF, 0xFE, 0xFD, 0xFC, 0xF9, 
-    0xF4, 0xF4, 0xF0, 0xEE, 0xED, 0xF0, 0xF5, 0xF8, 0xFC, 0xFE, 0xFC, 0xFD, 
-    0xFE, 0xFC, 0x00, 0x03, 0x06, 0x0A, 0x0A, 0x04, 0xFE, 0xFE, 0x00, 0x03, 
-    0x02, 0x00, 0xFC, 0xFB, 0xFD, 0x01, 0xFD, 0xF3, 0xEA, 0xE3, 0xE2, 0xE6, 
-    0xED, 0xF2, 0xF6, 0xF5, 0xF6, 0xF6, 0xF2, 0xED, 0xEC, 0xEC, 0xEE, 0xF0, 
-    0xF5, 0xFA, 0xFB, 0xFC, 0xF8, 0xF6, 0xED, 0xE5, 0xE3, 0xE4, 0xE6, 0xEA, 
-    0xEF, 0xF1, 0xF2, 0xF0, 0xEB, 0xE9, 0xE4, 0xE0, 0xDF, 0xE1, 0xE8, 0xEB, 
-    0xEF, 0xF0, 0xF0, 0xED, 0xEF, 0xF2, 0xF0, 0xF0, 0xF3, 0xF3, 0xF7, 0xFA, 
-    0xF9, 0xF6, 0xF1, 0xED, 0xEA, 0xE7, 0xE8, 0xEB, 0xEC, 0xEB, 0xE7, 0xE6, 
-    0xE7, 0xEC, 0xF2, 0xF8, 0xF8, 0xF3, 0xEE, 0xEB, 0xEB, 0xED, 0xF0, 0xF4, 
-    0xF9, 0xFC, 0x00, 0xFE, 0xFE, 0xFE, 0xFF, 0x00, 0x00, 0x06, 0x0C, 0x0F, 
-    0x0F, 0x0B, 0x05, 0xFD, 0xF9, 0xFA, 0xFE, 0x04, 0x0B, 0x11, 0x17, 0x1C, 
-    0x1B, 0x1C, 0x18, 0x14, 0x12, 0x10, 0x15, 0x1B, 0x1E, 0x1D, 0x1C, 0x1A, 
-    0x17, 0x14, 0x12, 0x10, 0x10, 0x12, 0x13, 0x19, 0x1D, 0x1D, 0x1A, 0x11, 
-    0x09, 0x04, 0x04, 0x09, 0x0F, 0x16, 0x1B, 0x1D, 0x1D, 0x1C, 0x1A, 0x17, 
-    0x16, 0x18, 0x1B, 0x1C, 0x1F, 0x20, 0x20, 0x1E, 0x1B, 0x17, 0x10, 0x0C, 
-    0x0A, 0x0C, 0x0D, 0x0E, 0x0E, 0x0D, 0x0E, 0x10, 0x12, 0x13, 0x11, 0x0D, 
-    0x0C, 0x07, 0x05, 0x05, 0x02, 0x00, 0x00, 0x05, 0x0A, 0x0A, 0x08, 0x04, 
-    0x00, 0xFA, 0xF6, 0xF4, 0xF8, 0xFB, 0xFF, 0xFF, 0xFC, 0xF9, 0xF4, 0xEF, 
-    0xEC, 0xE8, 0xE9, 0xEF, 0xF7, 0x01, 0x06, 0x09, 0x06, 0x00, 0xF9, 0xF6, 
-    0xF6, 0xF8, 0xFB, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFC, 0xF4, 
-    0xED, 0xED, 0xF3, 0xFA, 0xFC, 0xFC, 0xF9, 0xF4, 0xF0, 0xEC, 0xEB, 0xEE, 
-    0xF3, 0xFA, 0x01, 0x07, 0x09, 0x08, 0x05, 0x01, 0xFF, 0x02, 0x07, 0x0B, 
-    0x0D, 0x0B, 0x08, 0x05, 0x04, 0x02, 0xFB, 0xF9, 0xFB, 0xFC, 0xFB, 0xF7, 
-    0xF3, 0xF0, 0xEF, 0xF0, 0xF1, 0xF1, 0xF4, 0xF5, 0xF5, 0xF3, 0xF0, 0xEC, 
-    0xE8, 0xEA, 0xEE, 0xF1, 0xF3, 0xF1, 0xF1, 0xF0, 0xEF, 0xF1, 0xF0, 0xEF, 
-    0xEC, 0xE9, 0xEA, 0xEF, 0xF3, 0xF4, 0xF6, 0xF2, 0xEE, 0xEA, 0xEA, 0xEC, 
-    0xF2, 0xF6, 0xF7, 0xF4, 0xF2, 0xEE, 0xEB, 0xE8, 0xE4, 0xE1, 0xE3, 0xE8, 
-    0xEE, 0xEE, 0xEC, 0xE6, 0xE0, 0xDC, 0xD9, 0xDA, 0xDC, 0xE3, 0xE7, 0xE8, 
-    0xE8, 0xE5, 0xE3, 0xE1, 0xDE, 0xDE, 0xE2, 0xE9, 0xF2, 0xF8, 0xFA, 0xFA, 
-    0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xFA, 0x00, 0x07, 0x0D, 0x10, 0x13, 0x15, 
-    0x13, 0x10, 0x0A, 0x06, 0x09, 0x0B, 0x0D, 0x0E, 0x0D, 0x09, 0x07, 0x0A, 
-    0x0E, 0x11, 0x12, 0x13, 0x13, 0x12, 0x10, 0x10, 0x11, 0x13, 0x14, 0x17, 
-    0x1A, 0x1D, 0x1B, 0x19, 0x17, 0x16, 0x14, 0x12, 0x14, 0x16, 0x1B, 0x1F, 
-    0x1D, 0x19, 0x11, 0x0B, 0x0A, 0x09, 0x0B, 0x0D, 0x11, 0x16, 0x19, 0x1B, 
-    0x1B, 0x17, 0x10, 0x09, 0x06, 0x08, 0x0D, 0x12, 0x17, 0x19, 0x19, 0x19, 
-    0x13, 0x0A, 0x02, 0x00, 0x02, 0x06, 0x0F, 0x1A, 0x21, 0x20, 0x19, 0x13, 
-    0x0D, 0x0E, 0x10, 0x13, 0x17, 0x16, 0x15, 0x12, 0x10, 0x0E, 0x0F, 0x10, 
-    0x10, 0x0C, 0x07, 0x04, 0x02, 0x03, 0x02, 0xFF, 0xFC, 0xF9, 0xFA, 0xF9, 
-    0xF8, 0xF7, 0xF5, 0xF0, 0xEF, 0xF0, 0xF2, 0xF3, 0xF2, 0xF5, 0xF6, 0xF7, 
-    0xF7, 0xF9, 0xFA, 0xF7, 0xF4, 0xF2, 0xF1, 0xF4, 0xF8, 0xFC, 0xFF, 0xFF, 
-    0xFE, 0xFC, 0xFB, 0xF9, 0xFA, 0xFB, 0x00, 0x03, 0x04, 0x02, 0xFD, 0xF9, 
-    0xF4, 0xEE, 0xEC, 0xF4, 0xFA, 0x03, 0x07, 0x05, 0x03, 0x04, 0x02, 0x01, 
-    0x00, 0xFF, 0xFF, 0xFE, 0x01, 0x05, 0x05, 0x04, 0x00, 0xFF, 0xFD, 0xF9, 
-    0xF9, 0xF6, 0xF7, 0xF4, 0xF1, 0xEE, 0xED, 0xEC, 0xEE, 0xF1, 0xEF, 0xF2, 
-    0xF3, 0xF7, 0xF5, 0xF6, 0xF5, 0xF0, 0xF4, 0xF1, 0xF6, 0xF8, 0xF7, 0xF5, 
-    0xF0, 0xED, 0xED, 0xEC, 0xEF, 0xF1, 0xF5, 0xFB, 0xFB, 0xF8, 0xF2, 0xE6, 
-    0xDC, 0xDA, 0xDB, 0xE4, 0xF2, 0xF8, 0x04, 0x02, 0xFA, 0xF0, 0xE3, 0xDC, 
-    0xD3, 0xD4, 0xD7, 0xE4, 0xF1, 0xFC, 0xFF, 0xFE, 0xF9, 0xED, 0xE3, 0xDA, 
-    0xD4, 0xD9, 0xE2, 0xEF, 0xFF, 0x06, 0x04, 0xF9, 0xEC, 0xE0, 0xDC, 0xD8, 
-    0xE0, 0xE9, 0xF1, 0xF8, 0xFC, 0xFD, 0xFB, 0xF7, 0xF3, 0xF0, 0xF4, 0xF9, 
-    0xFB, 0x02, 0xFD, 0xFE, 0x00, 0x02, 0x03, 0x01, 0x04, 0x04, 0x02, 0xFF, 
-    0x00, 0xFD, 0x00, 0x04, 0x09, 0x11, 0x14, 0x12, 0x15, 0x16, 0x17, 0x15, 
-    0x14, 0x17, 0x18, 0x1C, 0x1C, 0x1E, 0x1F, 0x1D, 0x20, 0x21, 0x22, 0x22, 
-    0x1E, 0x1B, 0x16, 0x19, 0x18, 0x1A, 0x19, 0x13, 0x11, 0x0E, 0x0D, 0x0D, 
-    0x11, 0x11, 0x14, 0x16, 0x15, 0x13, 0x10, 0x0B, 0x09, 0x0A, 0x0F, 0x16, 
-    0x17, 0x18, 0x15, 0x12, 0x10, 0x10, 0x0B, 0x10, 0x15, 0x1B, 0x21, 0x21, 
-    0x21, 0x1B, 0x16, 0x0C, 0x04, 0x00, 0x02, 0x08, 0x13, 0x1A, 0x1D, 0x17, 
-    0x0C, 0xFE, 0xF0, 0xEA, 0xE8, 0xF1, 0xFB, 0x07, 0x10, 0x11, 0x0C, 0x05, 
-    0xF9, 0xEC, 0xE6, 0xE3, 0xE8, 0xF2, 0xF9, 0xFE, 0xFF, 0xFA, 0xF8, 0xF8, 
-    0xF6, 0xF7, 0xF5, 0xF6, 0xF7, 0xF7, 0xFB, 0xFE, 0x03, 0x06, 0x0A, 0x0B, 
-    0x09, 0x01, 0xFA, 0xF5, 0xF3, 0xF7, 0xFA, 0xFD, 0xFF, 0x03, 0x05, 0x06, 
-    0x05, 0xFE, 0xFA, 0xF7, 0xF6, 0xF8, 0xFA, 0xFB, 0xF9, 0xFF, 0x05, 0x0A, 
-    0x07, 0xFE, 0xF7, 0xF0, 0xF0, 0xF6, 0xFE, 0x04, 0x0D, 0x0E, 0x0C, 0x08, 
-    0x01, 0xFC, 0xF8, 0xF7, 0xF8, 0xFE, 0x03, 0x07, 0x07, 0x05, 0xFB, 0xF4, 
-    0xEE, 0xEC, 0xEF, 0xF3, 0xF7, 0xF7, 0xF4, 0xEF, 0xEF, 0xEC, 0xE7, 0xE2, 
-    0xE1, 0xE4, 0xE8, 0xEC, 0xF0, 0xF5, 0xF5, 0xF5, 0xEF, 0xEB, 0xE9, 0xEB, 
-    0xF0, 0xF4, 0xF7, 0xF4, 0xF2, 0xEF, 0xEC, 0xEC, 0xEC, 0xEF, 0xF4, 0xFB, 
-    0xFD, 0xFD, 0xF6, 0xED, 0xE4, 0xDB, 0xDB, 0xE1, 0xE9, 0xEF, 0xF0, 0xEF, 
-    0xEF, 0xED, 0xEF, 0xEC, 0xE7, 0xE3, 0xE6, 0xE8, 0xEA, 0xEA, 0xE9, 0xE9, 
-    0xE9, 0xEA, 0xE4, 0xE4, 0xE4, 0xEA, 0xF0, 0xF4, 0xF7, 0xF7, 0xFB, 0xFC, 
-    0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x04, 0x04, 0x05, 0x00, 0xFC, 0xFB, 0xFC, 
-    0x03, 0x10, 0x1E, 0x25, 0x28, 0x20, 0x16, 0x0B, 0x07, 0x07, 0x07, 0x0C, 
-    0x11, 0x16, 0x1B, 0x1D, 0x17, 0x13, 0x0B, 0x07, 0x0A, 0x0D, 0x12, 0x13, 
-    0x14, 0x14, 0x15, 0x17, 0x16, 0x12, 0x0E, 0x0C, 0x0C, 0x0D, 0x0F, 0x11, 
-    0x11, 0x13, 0x16, 0x17, 0x15, 0x13, 0x16, 0x1A, 0x1D, 0x1C, 0x17, 0x12, 
-    0x0F, 0x0E, 0x0F, 0x0E, 0x11, 0x12, 0x15, 0x17, 0x17, 0x16, 0x11, 0x10, 
-    0x0F, 0x15, 0x1C, 0x20, 0x1E, 0x13, 0x0A, 0x01, 0xFE, 0x01, 0x07, 0x11, 
-    0x19, 0x20, 0x20, 0x17, 0x08, 0xFA, 0xF0, 0xEC, 0xED, 0xF5, 0xFF, 0x08, 
-    0x0F, 0x10, 0x0E, 0x08, 0x01, 0xFD, 0xF7, 0xF6, 0xF7, 0xFA, 0x02, 0x08, 
-    0x0A, 0x08, 0x03, 0xFD, 0xF5, 0xEE, 0xEB, 0xEA, 0xEE, 0xF5, 0xFB, 0x00, 
-    0x03, 0xFF, 0xF7, 0xF2, 0xEE, 0xF0, 0xEF, 0xF0, 0xF1, 0xF4, 0xF8, 0xF8, 
-    0xF7, 0xF6, 0xF7, 0xFC, 0x02, 0x06, 0x07, 0x03, 0x00, 0xFE, 0xFE, 0x01, 
-    0x01, 0x02, 0x01, 0x04, 0x05, 0x04, 0x02, 0x04, 0x07, 0x0B, 0x0F, 0x0D, 
-    0x09, 0x05, 0x02, 0xFF, 0xFE, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
-    0xF9, 0xF5, 0xF2, 0xF1, 0xF1, 0xF3, 0xF1, 0xF2, 0xF4, 0xF3, 0xF2, 0xED, 
-    0xE7, 0xE4, 0xE5, 0xE7, 0xEB, 0xF0, 0xF4, 0xF7, 0xF8, 0xF4, 0xEF, 0xEB, 
-    0xE8, 0xE9, 0xEC, 0xF2, 0xFB, 0x02, 0x03, 0xFF, 0xF5, 0xEC, 0xE7, 0xEA, 
-    0xF0, 0xF7, 0xFC, 0xFE, 0xFC, 0xF8, 0xF0, 0xE7, 0xDB, 0xD2, 0xCD, 0xCE, 
-    0xD2, 0xD8, 0xE1, 0xE8, 0xEE, 0xF0, 0xEE, 0xE8, 0xE2, 0xDC, 0xD9, 0xDB, 
-    0xE1, 0xE8, 0xEE, 0xF2, 0xF2, 0xF3, 0xF2, 0xEF, 0xEA, 0xE8, 0xEB, 0xF2, 
-    0xF9, 0xFE, 0xFC, 0xFA, 0xF8, 0xF7, 0xFB, 0xFB, 0xFD, 0xFD, 0xFD, 0xFF, 
-    0x02, 0x03, 0x05, 0x09, 0x0E, 0x13, 0x14, 0x13, 0x0E, 0x0C, 0x0B, 0x0B, 
-    0x0C, 0x0D, 0x0E, 0x11, 0x13, 0x12, 0x0F, 0x0A, 0x06, 0x0B, 0x11, 0x18, 
-    0x1C, 0x1D, 0x1E, 0x1E, 0x1D, 0x1A, 0x15, 0x11, 0x10, 0x12, 0x15, 0x19, 
-    0x1F, 0x25, 0x2A, 0x29, 0x24, 0x1D, 0x17, 0x14, 0x13, 0x13, 0x12, 0x12, 
-    0x13, 0x13, 0x11, 0x0E, 0x09, 0x07, 0x07, 0x08, 0x0B, 0x0E, 0x0E, 0x0D, 
-    0x0C, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0D, 0x0F, 0x0F, 0x0E, 0x0B, 0x08, 
-    0x09, 0x0D, 0x14, 0x19, 0x1B, 0x1B, 0x1A, 0x16, 0x11, 0x0A, 0x02, 0xFB, 
-    0xF6, 0xF7, 0xFB, 0x01, 0x06, 0x0A, 0x0D, 0x0E, 0x0B, 0x05, 0xFF, 0xFB, 
-    0xF9, 0xFB, 0xFC, 0xFD, 0xFD, 0xFC, 0xFA, 0xF9, 0xF9, 0xFA, 0xFC, 0xFD, 
-    0xFC, 0xF9, 0xF7, 0xF6, 0xF5, 0xF2, 0xF2, 0xF4, 0xF6, 0xF9, 0xFD, 0xFD, 
-    0xFC, 0xF9, 0xF8, 0xFB, 0xFD, 0x02, 0x04, 0x05, 0x08, 0x07, 0x07, 0x05, 
-    0x02, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01, 0x03, 0x02, 
-    0xFF, 0xFC, 0xFB, 0xFB, 0xFC, 0xFB, 0xFA, 0xF8, 0xF6, 0xF5, 0xF6, 0xF6, 
-    0xF5, 0xF4, 0xF8, 0xFC, 0xFF, 0xFF, 0xFA, 0xF7, 0xF7, 0xFB, 0xFD, 0xFD, 
-    0xFB, 0xFB, 0xFA, 0xF9, 0xF7, 0xF5, 0xF2, 0xF1, 0xF4, 0xF8, 0xFA, 0xF9, 
-    0xF6, 0xF3, 0xF2, 0xF4, 0xF4, 0xF2, 0xF1, 0xF3, 0xF5, 0xF8, 0xF6, 0xF1, 
-    0xED, 0xE8, 0xE8, 0xE9, 0xEA, 0xEE, 0xF2, 0xF6, 0xF7, 0xF5, 0xF1, 0xE9, 
-    0xE1, 0xDC, 0xDA, 0xDC, 0xE2, 0xE8, 0xEE, 0xF1, 0xF2, 0xF2, 0xF0, 0xEE, 
-    0xEA, 0xE7, 0xE7, 0xEC, 0xF4, 0xF9, 0xFB, 0xF8, 0xF6, 0xF4, 0xF4, 0xF6, 
-    0xF7, 0xF6, 0xF4, 0xF4, 0xF6, 0xFA, 0xFB, 0xF9, 0xF6, 0xF3, 0xF1, 0xF2, 
-    0xF2, 0xF4, 0xF6, 0xF9, 0xFC, 0xFE, 0xFE, 0xFC, 0xFA, 0xFC, 0xFF, 0x04, 
-    0x08, 0x0A, 0x0B, 0x0D, 0x10, 0x11, 0x12, 0x13, 0x14, 0x16, 0x19, 0x1C, 
-    0x1B, 0x17, 0x14, 0x13, 0x12, 0x13, 0x12, 0x13, 0x13, 0x11, 0x0F, 0x0E, 
-    0x0F, 0x10, 0x13, 0x14, 0x16, 0x17, 0x16, 0x15, 0x12, 0x11, 0x10, 0x0F, 
-    0x10, 0x10, 0x10, 0x10, 0x0F, 0x0C, 0x0A, 0x09, 0x0B, 0x0E, 0x10, 0x10, 
-    0x0F, 0x0F, 0x0F, 0x10, 0x10, 0x0F, 0x10, 0x11, 0x11, 0x12, 0x16, 0x1C, 
-    0x20, 0x22, 0x20, 0x1C, 0x17, 0x14, 0x14, 0x16, 0x19, 0x19, 0x19, 0x18, 
-    0x17, 0x11, 0x07, 0xFC, 0xF4, 0xF1, 0xF4, 0xFA, 0xFE, 0xFF, 0xFE, 0xFC, 
-    0xFA, 0xF8, 0xF3, 0xED, 0xE7, 0xE9, 0xED, 0xF3, 0xFA, 0xFF, 0x02, 0x03, 
-    0x04, 0x03, 0x01, 0xFD, 0xFA, 0xF7, 0xF7, 0xF9, 0xFC, 0xFD, 0xFE, 0xFD, 
-    0xFB, 0xF9, 0xF9, 0xFA, 0xFC, 0x01, 0x05, 0x06, 0x04, 0x03, 0x03, 0x03, 
-    0x03, 0x02, 0x00, 0xFE, 0xFC, 0xF9, 0xF7, 0xF9, 0xFD, 0x01, 0x04, 0x03, 
-    0x02, 0x01, 0x00, 0xFC, 0xFB, 0xF9, 0xFA, 0xFD, 0xFE, 0xFF, 0xFE, 0xFE, 
-    0xFD, 0xFD, 0x00, 0x06, 0x0A, 0x0C, 0x0A, 0x08, 0x08, 0x0A, 0x08, 0x02, 
-    0xFD, 0xF9, 0xF8, 0xF8, 0xF6, 0xF6, 0xF5, 0xF6, 0xF7, 0xF6, 0xF2, 0xEE, 
-    0xED, 0xEA, 0xE8, 0xE6, 0xE5, 0xE6, 0xE7, 0xE5, 0xE2, 0xE0, 0xDF, 0xE0, 
-    0xE4, 0xE9, 0xF0, 0xF5, 0xF3, 0xEF, 0xEC, 0xEC, 0xEE, 0xF1, 0xF1, 0xF2, 
-    0xF1, 0xF0, 0xED, 0xE8, 0xE4, 0xE3, 0xE4, 0xE5, 0xE6, 0xE9, 0xEC, 0xEE, 
-    0xEF, 0xED, 0xEC, 0xEB, 0xEA, 0xE9, 0xE8, 0xE7, 0xE9, 0xEB, 0xEF, 0xF3, 
-    0xF6, 0xF8, 0xF6, 0xF2, 0xF0, 0xEF, 0xEE, 0xED, 0xEE, 0xEC, 0xEB, 0xEA, 
-    0xEB, 0xED, 0xF0, 0xF5, 0xFB, 0x00, 0x04, 0x06, 0x06, 0x07, 0x05, 0x04, 
-    0x04, 0x07, 0x0B, 0x0F, 0x11, 0x10, 0x0D, 0x0A, 0x08, 0x0A, 0x0F, 0x12, 
-    0x13, 0x12, 0x10, 0x0F, 0x10, 0x10, 0x0E, 0x0B, 0x09, 0x08, 0x08, 0x07, 
-    0x08, 0x0C, 0x10, 0x12, 0x13, 0x12, 0x11, 0x10, 0x0E, 0x0C, 0x0C, 0x0C, 
-    0x0F, 0x11, 0x11, 0x0F, 0x0C, 0x0B, 0x0D, 0x0F, 0x12, 0x14, 0x15, 0x14, 
-    0x13, 0x13, 0x15, 0x18, 0x17, 0x14, 0x10, 0x0E, 0x0E, 0x0D, 0x0B, 0x09, 
-    0x0D, 0x13, 0x17, 0x1A, 0x19, 0x16, 0x11, 0x0B, 0x07, 0x04, 0x05, 0x09, 
-    0x0C, 0x0D, 0x0B, 0x0A, 0x08, 0x04, 0xFF, 0xFA, 0xF9, 0xFA, 0xFB, 0xFC, 
-    0xFF, 0x05, 0x0A, 0x0A, 0x07, 0x03, 0xFF, 0xFC, 0xF9, 0xF9, 0xFF, 0x06, 
-    0x0C, 0x0D, 0x0C, 0x0A, 0x08, 0x03, 0xFD, 0xF8, 0xF6, 0xF6, 0xF7, 0xF8, 
-    0xF7, 0xF7, 0xF6, 0xF7, 0xF9, 0xFC, 0xFD, 0xFD, 0xFB, 0xFA, 0xF9, 0xF9, 
-    0xF9, 0xF9, 0xF6, 0xF1, 0xEE, 0xEF, 0xEF, 0xEF, 0xF1, 0xF4, 0xF9, 0xFD, 
-    0xFF, 0x00, 0xFF, 0xFD, 0xFC, 0xFD, 0xFE, 0x01, 0x04, 0x05, 0x04, 0x03, 
-    0x01, 0xFF, 0x01, 0x03, 0x06, 0x08, 0x06, 0x03, 0x00, 0xFE, 0xFF, 0xFC, 
-    0xF8, 0xF3, 0xEF, 0xED, 0xED, 0xEC, 0xEE, 0xF1, 0xF4, 0xF7, 0xF6, 0xF5, 
-    0xF2, 0xF0, 0xEE, 0xEB, 0xEC, 0xF0, 0xF5, 0xF8, 0xF8, 0xF6, 0xF5, 0xF3, 
-    0xF4, 0xF7, 0xFA, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFA, 0xF3, 0xED, 
-    0xEA, 0xEB, 0xEE, 0xEF, 0xEE, 0xEE, 0xF0, 0xF1, 0xF0, 0xEC, 0xE7, 0xE3, 
-    0xE3, 0xE4, 0xE6, 0xE7, 0xE6, 0xE7, 0xE5, 0xE3, 0xE0, 0xDD, 0xDB, 0xDE, 
-    0xE3, 0xE9, 0xEC, 0xEB, 0xE8, 0xE6, 0xE6, 0xE9, 0xEC, 0xEB, 0xE9, 0xE7, 
-    0xE9, 0xEC, 0xF1, 0xF6, 0xFA, 0xFE, 0x03, 0x08, 0x0A, 0x09, 0x05, 0x02, 
-    0x01, 0x03, 0x04, 0x04, 0x02, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x07, 
-    0x0B, 0x0B, 0x0A, 0x09, 0x0B, 0x0D, 0x0F, 0x0D, 0x08, 0x06, 0x07, 0x0A, 
-    0x0D, 0x0F, 0x10, 0x15, 0x1D, 0x21, 0x21, 0x1D, 0x1A, 0x19, 0x18, 0x16, 
-    0x13, 0x15, 0x18, 0x1A, 0x18, 0x13, 0x0E, 0x0E, 0x11, 0x17, 0x1A, 0x19, 
-    0x15, 0x13, 0x13, 0x15, 0x15, 0x13, 0x10, 0x0F, 0x10, 0x12, 0x10, 0x0D, 
-    0x0A, 0x0A, 0x0D, 0x0F, 0x0F, 0x0E, 0x0D, 0x0D, 0x0F, 0x0D, 0x0B, 0x06, 
-    0x04, 0x03, 0x03, 0x05, 0x06, 0x09, 0x0E, 0x14, 0x15, 0x10, 0x09, 0x03, 
-    0x02, 0x04, 0x08, 0x0A, 0x09, 0x0A, 0x0A, 0x08, 0x05, 0x01, 0x00, 0xFF, 
-    0x00, 0x02, 0x04, 0x06, 0x07, 0x05, 0x01, 0xFE, 0xFB, 0xFC, 0xFD, 0xFC, 
-    0xFA, 0xF6, 0xF3, 0xF2, 0xF3, 0xF6, 0xFB, 0x00, 0x03, 0x03, 0x03, 0x04, 
-    0x06, 0x07, 0x05, 0x00, 0xFA, 0xF8, 0xF7, 0xF5, 0xF5, 0xF8, 0xFC, 0x00, 
-    0x03, 0x04, 0x03, 0x01, 0xFE, 0xFC, 0xFB, 0xFD, 0xFF, 0x00, 0xFE, 0xFC, 
-    0xFC, 0xFB, 0xFC, 0xFE, 0x01, 0x01, 0xFF, 0xFC, 0xFB, 0xFB, 0xFD, 0xFD, 
-    0xFA, 0xF6, 0xF2, 0xF2, 0xF1, 0xEE, 0xEB, 0xEA, 0xED, 0xF1, 0xF5, 0xF8, 
-    0xFA, 0xFC, 0xF9, 0xF5, 0xF1, 0xEF, 0xF0, 0xF1, 0xF3, 0xF5, 0xF6, 0xF5, 
-    0xF5, 0xF6, 0xF8, 0xF9, 0xF7, 0xF5, 0xF4, 0xF6, 0xF9, 0xFB, 0xFD, 0xFB, 
-    0xF6, 0xF0, 0xEB, 0xE8, 0xE7, 0xEB, 0xF1, 0xF7, 0xFE, 0x00, 0xFE, 0xF8, 
-    0xF0, 0xE8, 0xE3, 0xE4, 0xE8, 0xED, 0xF3, 0xF5, 0xF7, 0xF5, 0xF1, 0xEF, 
-    0xED, 0xEE, 0xED, 0xEB, 0xEB, 0xED, 0xF1, 0xF5, 0xF6, 0xF4, 0xF0, 0xEE, 
-    0xEE, 0xEF, 0xF0, 0xF0, 0xF1, 0xF5, 0xFA, 0xFC, 0xFF, 0x01, 0x00, 0xFD, 
-    0xFA, 0xFA, 0xFC, 0xFF, 0x01, 0x01, 0x00, 0xFE, 0xFC, 0xFB, 0xFD, 0xFF, 
-    0x02, 0x03, 0x02, 0x02, 0x02, 0x05, 0x07, 0x07, 0x06, 0x04, 0x03, 0x02, 
-    0x03, 0x04, 0x06, 0x0B, 0x11, 0x16, 0x17, 0x18, 0x17, 0x15, 0x13, 0x10, 
-    0x10, 0x12, 0x16, 0x18, 0x16, 0x13, 0x12, 0x12, 0x16, 0x17, 0x15, 0x12, 
-    0x11, 0x13, 0x15, 0x17, 0x17, 0x16, 0x13, 0x10, 0x0D, 0x0B, 0x0A, 0x0B, 
-    0x0D, 0x11, 0x15, 0x18, 0x18, 0x18, 0x16, 0x13, 0x10, 0x10, 0x13, 0x17, 
-    0x1C, 0x20, 0x1E, 0x1A, 0x13, 0x0D, 0x0D, 0x10, 0x17, 0x1C, 0x1C, 0x19, 
-    0x14, 0x10, 0x0D, 0x08, 0x02, 0xFD, 0xFB, 0xFC, 0x00, 0x01, 0x03, 0x05, 
-    0x06, 0x05, 0x05, 0x03, 0xFE, 0xF9, 0xF3, 0xF0, 0xED, 0xEE, 0xF0, 0xF2, 
-    0xF3, 0xF2, 0xF1, 0xEF, 0xF0, 0xF3, 0xF6, 0xF5, 0xF4, 0xF5, 0xF8, 0xFB, 
-    0xFE, 0x00, 0xFF, 0xFD, 0xFB, 0xFA, 0xF9, 0xF9, 0xFA, 0xFE, 0x02, 0x05, 
-    0x07, 0x09, 0x0A, 0x09, 0x03, 0xFC, 0xF7, 0xF6, 0xF8, 0xFB, 0xFD, 0xFD, 
-    0xFC, 0xF9, 0xF5, 0xF5, 0xF6, 0xF9, 0xFA, 0xF9, 0xF8, 0xFA, 0xFE, 0x01, 
-    0x01, 0xFD, 0xFA, 0xF8, 0xF8, 0xFA, 0xFC, 0xFF, 0x02, 0x04, 0x06, 0x07, 
-    0x07, 0x07, 0x04, 0x01, 0x01, 0x00, 0x01, 0xFF, 0xFC, 0xF7, 0xF2, 0xEE, 
-    0xED, 0xF0, 0xF4, 0xF6, 0xF6, 0xF4, 0xF3, 0xF2, 0xF1, 0xF2, 0xF1, 0xF0, 
-    0xEE, 0xEC, 0xEA, 0xE8, 0xE6, 0xE3, 0xE2, 0xE3, 0xE6, 0xE8, 0xEB, 0xEF, 
-    0xF1, 0xF1, 0xEC, 0xE7, 0xE3, 0xE1, 0xE2, 0xE4, 0xE6, 0xE8, 0xEB, 0xF0, 
-    0xF8, 0xFC, 0xFC, 0xF8, 0xF4, 0xF3, 0xF4, 0xF6, 0xF7, 0xF6, 0xF3, 0xEE, 
-    0xEA, 0xE7, 0xE6, 0xE7, 0xE9, 0xEC, 0xF0, 0xF6, 0xF9, 0xF8, 0xF5, 0xF2, 
-    0xF0, 0xF2, 0xF6, 0xFA, 0xFE, 0x02, 0x02, 0x03, 0x02, 0x02, 0x05, 0x08, 
-    0x09, 0x0A, 0x0A, 0x0C, 0x0F, 0x12, 0x13, 0x12, 0x10, 0x0B, 0x06, 0x03, 
-    0x03, 0x05, 0x06, 0x07, 0x09, 0x0B, 0x0F, 0x11, 0x11, 0x10, 0x0D, 0x0D, 
-    0x0E, 0x0F, 0x0E, 0x0D, 0x0C, 0x0C, 0x0B, 0x09, 0x08, 0x09, 0x0C, 0x0D, 
-    0x0C, 0x0B, 0x0C, 0x0E, 0x10, 0x10, 0x0E, 0x0B, 0x09, 0x07, 0x06, 0x04, 
-    0x04, 0x07, 0x0D, 0x12, 0x15, 0x17, 0x19, 0x19, 0x16, 0x11, 0x0E, 0x0F, 
-    0x15, 0x1A, 0x1C, 0x1A, 0x19, 0x19, 0x1A, 0x1A, 0x15, 0x0F, 0x0B, 0x0B, 
-    0x0F, 0x14, 0x17, 0x18, 0x15, 0x0D, 0x05, 0xFE, 0xF9, 0xF7, 0xF8, 0xFC, 
-    0x03, 0x0C, 0x14, 0x16, 0x13, 0x0D, 0x07, 0x03, 0x01, 0xFE, 0xFB, 0xFA, 
-    0xFC, 0xFE, 0xFD, 0xFD, 0xFA, 0xF9, 0xF8, 0xFB, 0xFB, 0xF9, 0xF8, 0xF7, 
-    0xF8, 0xFB, 0xFD, 0xFD, 0xFB, 0xFA, 0xF9, 0xFA, 0xFC, 0xFE, 0xFF, 0x01, 
-    0x05, 0x06, 0x06, 0x02, 0xFC, 0xF5, 0xF2, 0xF3, 0xF6, 0xF6, 0xF3, 0xF0, 
-    0xEF, 0xEE, 0xEF, 0xF2, 0xF4, 0xF4, 0xF2, 0xEF, 0xF0, 0xF5, 0xFD, 0x02, 
-    0x03, 0x01, 0xFE, 0xF8, 0xF3, 0xF2, 0xF3, 0xF4, 0xF8, 0xFC, 0x00, 0x03, 
-    0x05, 0x05, 0x04, 0x02, 0xFF, 0xFE, 0xFD, 0xFF, 0x01, 0x03, 0x02, 0xFF, 
-    0xF8, 0xF3, 0xF2, 0xF3, 0xF5, 0xF6, 0xF5, 0xF7, 0xFA, 0xFC, 0xFC, 0xF9, 
-    0xF4, 0xF0, 0xEF, 0xEE, 0xEE, 0xF0, 0xF3, 0xF7, 0xFA, 0xFB, 0xF8, 0xF5, 
-    0xF4, 0xF3, 0xF3, 0xF4, 0xF5, 0xF8, 0xF9, 0xF8, 0xF5, 0xF0, 0xEA, 0xE8, 
-    0xEB, 0xEF, 0xF3, 0xF5, 0xF6, 0xF6, 0xF5, 0xF3, 0xF1, 0xEF, 0xEB, 0xE4, 
-    0xDC, 0xD7, 0xD8, 0xDB, 0xDE, 0xDF, 0xDF, 0xE1, 0xE4, 0xE9, 0xED, 0xEE, 
-    0xEC, 0xEB, 0xEC, 0xEF, 0xF1, 0xF3, 0xF5, 0xF8, 0xFA, 0xFA, 0xFC, 0xFF, 
-    0x02, 0x03, 0x03, 0x04, 0x07, 0x0B, 0x10, 0x10, 0x10, 0x0E, 0x0D, 0x09, 
-    0x04, 0x02, 0x03, 0x08, 0x0E, 0x13, 0x14, 0x14, 0x13, 0x10, 0x0C, 0x08, 
-    0x08, 0x0B, 0x0F, 0x10, 0x0E, 0x0C, 0x0A, 0x09, 0x09, 0x09, 0x0A, 0x0A, 
-    0x09, 0x08, 0x0A, 0x0F, 0x16, 0x1B, 0x1D, 0x1C, 0x19, 0x17, 0x16, 0x15, 
-    0x14, 0x14, 0x13, 0x14, 0x15, 0x16, 0x16, 0x17, 0x16, 0x13, 0x10, 0x0E, 
-    0x0F, 0x11, 0x12, 0x10, 0x0E, 0x0A, 0x09, 0x0A, 0x0D, 0x0D, 0x09, 0x04, 
-    0x00, 0xFE, 0xFF, 0x02, 0x05, 0x09, 0x0B, 0x0C, 0x0A, 0x05, 0x00, 0xFE, 
-    0xFF, 0x02, 0x05, 0x09, 0x0C, 0x0C, 0x09, 0x04, 0x01, 0xFE, 0xFD, 0xFD, 
-    0xFC, 0xFA, 0xF9, 0xF7, 0xF7, 0xF9, 0xFB, 0xF9, 0xFA, 0xFB, 0x00, 0x06, 
-    0x0B, 0x0D, 0x0A, 0x07, 0x00, 0xFC, 0xF9, 0xFA, 0xFF, 0x02, 0x08, 0x0A, 
-    0x0C, 0x0D, 0x0D, 0x07, 0x00, 0xF8, 0xF5, 0xF8, 0xFB, 0x03, 0x04, 0x03, 
-    0x01, 0xFA, 0xFC, 0x00, 0x09, 0x11, 0x10, 0x12, 0x0A, 0x07, 0x05, 0x03, 
-    0xFF, 0xFD, 0xFB, 0xFC, 0xFD, 0xFA, 0xF8, 0xF5, 0xF5, 0xF3, 0xEF, 0xED, 
-    0xED, 0xEF, 0xED, 0xED, 0xEE, 0xEB, 0xEF, 0xF3, 0xF4, 0xF9, 0xF8, 0xF5, 
-    0xF3, 0xEB, 0xF0, 0xED, 0xF6, 0xF8, 0xF9, 0xFA, 0xF2, 0xF3, 0xF1, 0xEE, 
-    0xE7, 0xE3, 0xEA, 0xEA, 0xEF, 0xF3, 0xEF, 0xFE, 0xFA, 0xFE, 0xFC, 0xF9, 
-    0xF9, 0xF7, 0xF7, 0xF8, 0xF3, 0xF2, 0xF6, 0xF0, 0xF5, 0xF8, 0xF7, 0xEE, 
-    0xEF, 0xE6, 0xE5, 0xE9, 0xF7, 0x06, 0x14, 0x1D, 0x1D, 0x13, 0x0A, 0x00, 
-    0xF5, 0xF3, 0xEF, 0xFA, 0xF6, 0x03, 0x04, 0x09, 0x10, 0x14, 0x14, 0x0A, 
-    0x09, 0x06, 0x0F, 0x15, 0x17, 0x13, 0x10, 0x11, 0x10, 0x0D, 0x11, 0x0D, 
-    0x0C, 0x0A, 0x00, 0x00, 0x04, 0x07, 0x18, 0x17, 0x14, 0x0F, 0xFE, 0xFE, 
-    0xF5, 0xF8, 0xF9, 0xFC, 0x05, 0x06, 0x08, 0x0E, 0x15, 0x0E, 0x0F, 0x08, 
-    0x01, 0x03, 0x03, 0x09, 0x0C, 0x10, 0x0F, 0x0E, 0x0C, 0x10, 0x0B, 0x0E, 
-    0x09, 0xFD, 0xFB, 0xF9, 0x0A, 0x1A, 0x26, 0x2B, 0x2F, 0x27, 0x24, 0x1E, 
-    0x15, 0x10, 0x11, 0x1C, 0x21, 0x2D, 0x31, 0x27, 0x27, 0x1C, 0x10, 0x0E, 
-    0x06, 0x0A, 0x10, 0x13, 0x17, 0x1A, 0x19, 0x19, 0x12, 0x13, 0x0F, 0x0C, 
-    0x10, 0x0E, 0x0F, 0x0E, 0x17, 0x1D, 0x25, 0x28, 0x26, 0x25, 0x1D, 0x1C, 
-    0x15, 0x18, 0x18, 0x1E, 0x22, 0x23, 0x26, 0x24, 0x26, 0x20, 0x1B, 0x0F, 
-    0x0E, 0x08, 0x0A, 0x12, 0x14, 0x13, 0x14, 0x0F, 0x07, 0x0C, 0x07, 0x03, 
-    0x04, 0xFD, 0xF9, 0xF7, 0xF4, 0xFE, 0x07, 0x0F, 0x11, 0x0B, 0x07, 0x06, 
-    0x04, 0x03, 0x07, 0x08, 0x12, 0x17, 0x1E, 0x22, 0x1D, 0x1B, 0x12, 0x0C, 
-    0x07, 0x05, 0x00, 0x05, 0x0A, 0x0E, 0x0F, 0x06, 0x04, 0xFA, 0xFE, 0x07, 
-    0x07, 0x08, 0xFC, 0xF1, 0xE8, 0xE8, 0xE8, 0xEC, 0xF2, 0xF2, 0xF1, 0xEE, 
-    0xE8, 0xDF, 0xDD, 0xD5, 0xDF, 0xE2, 0xEF, 0xF6, 0xFD, 0xFD, 0xF5, 0xF4, 
-    0xE8, 0xE9, 0xE6, 0xF3, 0xF7, 0xFF, 0x04, 0x05, 0x03, 0xFD, 0xF7, 0xF6, 
-    0xF5, 0xED, 0xEA, 0xE2, 0xE6, 0xE2, 0xE8, 0xF3, 0xFA, 0x02, 0x02, 0xFE, 
-    0xF8, 0xEE, 0xE6, 0xE4, 0xE6, 0xF3, 0xF8, 0x01, 0x01, 0xFA, 0xF6, 0xEA, 
-    0xE1, 0xDB, 0xDC, 0xE2, 0xEC, 0xF5, 0xF6, 0xF5, 0xF5, 0xF6, 0xF5, 0xF5, 
-    0xF5, 0xEF, 0xE6, 0xDD, 0xD8, 0xD7, 0xDE, 0xE6, 0xF3, 0xF8, 0xF9, 0xFB, 
-    0xF5, 0xEA, 0xE1, 0xDB, 0xDE, 0xEC, 0xFB, 0x08, 0x0C, 0x06, 0xF9, 0xF3, 
-    0xE7, 0xE1, 0xE1, 0xE2, 0xF0, 0xFE, 0x08, 0x0A, 0x07, 0xFE, 0xF5, 0xF9, 
-    0xF8, 0xF7, 0xF4, 0xEE, 0xE7, 0xEB, 0xF9, 0xFE, 0x0C, 0x0E, 0x08, 0x06, 
-    0xFF, 0xF5, 0xEB, 0xE5, 0xE4, 0xE9, 0xF2, 0xF8, 0xFB, 0xFE, 0xFA, 0xF3, 
-    0xEA, 0xE5, 0xD9, 0xE1, 0xE3, 0xED, 0xF5, 0xF0, 0xF6, 0xF5, 0xF5, 0xF7, 
-    0xFB, 0xF7, 0xF6, 0xE8, 0xEA, 0xE2, 0xEC, 0xF9, 0xFC, 0x03, 0xFF, 0x01, 
-    0xF9, 0xF3, 0xE6, 0xDD, 0xDA, 0xE0, 0xEC, 0xF6, 0x00, 0x06, 0xFE, 0xF6, 
-    0xF0, 0xE9, 0xE8, 0xE8, 0xEA, 0xF5, 0xFA, 0x05, 0x0B, 0x0B, 0x07, 0x06, 
-    0x09, 0x07, 0x05, 0xFF, 0xFB, 0xF4, 0xF8, 0xF8, 0x01, 0x08, 0x0B, 0x0F, 
-    0x0F, 0x0B, 0x00, 0xF5, 0xEF, 0xE8, 0xEF, 0xFC, 0xFF, 0x08, 0x04, 0x03, 
-    0x03, 0xFB, 0xF4, 0xEA, 0xE3, 0xE4, 0xEC, 0xF9, 0xFB, 0x02, 0x01, 0xFF, 
-    0x07, 0x02, 0x02, 0xF8, 0xF0, 0xE9, 0xE8, 0xEF, 0xFC, 0x09, 0x0C, 0x12, 
-    0x05, 0xFC, 0xF4, 0xE7, 0xE6, 0xE4, 0xE8, 0xF3, 0xFF, 0x0A, 0x12, 0x0E, 
-    0x0B, 0x01, 0xF4, 0xE9, 0xE2, 0xE2, 0xEC, 0xF3, 0xF7, 0xFC, 0xF6, 0xF6, 
-    0xF3, 0xF6, 0xF2, 0xEF, 0xE4, 0xDA, 0xD7, 0xDA, 0xEB, 0xF6, 0x05, 0x05, 
-    0x04, 0x01, 0xFA, 0xF6, 0xEE, 0xED, 0xEC, 0xF6, 0x04, 0x11, 0x1F, 0x23, 
-    0x1F, 0x0F, 0x02, 0xEF, 0xEA, 0xE9, 0xEF, 0x02, 0x0D, 0x14, 0x15, 0x0F, 
-    0x0A, 0x08, 0xFF, 0xFA, 0xED, 0xE8, 0xE1, 0xE7, 0xF0, 0xFC, 0x07, 0x09, 
-    0x06, 0xFB, 0xF0, 0xE3, 0xDE, 0xD6, 0xDC, 0xDC, 0xEB, 0xF7, 0x01, 0x07, 
-    0xFE, 0xFA, 0xF1, 0xEC, 0xEB, 0xEF, 0xF8, 0x0C, 0x16, 0x1A, 0x1B, 0x15, 
-    0x14, 0x16, 0x14, 0x09, 0x03, 0xF7, 0xED, 0xEC, 0xF1, 0xFA, 0x03, 0x0F, 
-    0x13, 0x10, 0x05, 0xFC, 0xEF, 0xEB, 0xEC, 0xEF, 0xFC, 0x08, 0x16, 0x1A, 
-    0x1B, 0x14, 0x09, 0x03, 0xFA, 0xFA, 0xFE, 0x09, 0x14, 0x1E, 0x22, 0x23, 
-    0x22, 0x23, 0x23, 0x1C, 0x12, 0x06, 0x00, 0xFA, 0xFE, 0x06, 0x0E, 0x17, 
-    0x16, 0x13, 0x0F, 0x0B, 0x05, 0xFD, 0xF8, 0xF5, 0xFA, 0xFF, 0x09, 0x13, 
-    0x15, 0x1F, 0x19, 0x17, 0x0F, 0x08, 0x08, 0x0E, 0x1C, 0x25, 0x2D, 0x30, 
-    0x38, 0x37, 0x39, 0x34, 0x22, 0x11, 0x02, 0xF9, 0xFD, 0x06, 0x13, 0x1C, 
-    0x23, 0x26, 0x1F, 0x19, 0x0E, 0x00, 0xF5, 0xF1, 0xF1, 0xFA, 0x0A, 0x15, 
-    0x20, 0x23, 0x1E, 0x15, 0x04, 0xF7, 0xF3, 0xF7, 0x05, 0x13, 0x1B, 0x22, 
-    0x23, 0x21, 0x24, 0x21, 0x1B, 0x13, 0x07, 0x00, 0x00, 0x06, 0x11, 0x1D, 
-    0x25, 0x28, 0x23, 0x1D, 0x11, 0x00, 0xF7, 0xF0, 0xF3, 0xFC, 0x08, 0x1A, 
-    0x27, 0x2D, 0x2B, 0x22, 0x10, 0x01, 0xF9, 0xF9, 0x02, 0x10, 0x21, 0x2B, 
-    0x30, 0x2F, 0x2D, 0x2B, 0x22, 0x1A, 0x0D, 0x04, 0x00, 0x0B, 0x1B, 0x27, 
-    0x33, 0x2F, 0x25, 0x18, 0x08, 0xFA, 0xEB, 0xE6, 0xE8, 0xED, 0xF9, 0x00, 
-    0x06, 0x07, 0x00, 0xF6, 0xE8, 0xDD, 0xD8, 0xD7, 0xDE, 0xE8, 0xEF, 0xF5, 
-    0xF4, 0xF4, 0xF5, 0xF4, 0xEF, 0xE3, 0xD7, 0xCF, 0xCA, 0xD4, 0xE0, 0xEA, 
-    0xF6, 0xFB, 0xF9, 0xF2, 0xEC, 0xE2, 0xD9, 0xD6, 0xD7, 0xDD, 0xEC, 0xF9, 
-    0x04, 0x0F, 0x0D, 0x08, 0xFC, 0xF2, 0xEA, 0xE7, 0xEC, 0xF1, 0x00, 0x08, 
-    0x10, 0x15, 0x14, 0x14, 0x0E, 0x03, 0xF6, 0xED, 0xE7, 0xE9, 0xF2, 0xFA, 
-    0x02, 0x07, 0x05, 0x00, 0xF7, 0xEF, 0xE8, 0xE2, 0xE1, 0xE5, 0xE9, 0xF1, 
-    0xF7, 0xFA, 0xFD, 0xFC, 0xF7, 0xF0, 0xE1, 0xD9, 0xDB, 0xE0, 0xEB, 0xF8, 
-    0xFF, 0x03, 0x08, 0x0B, 0x0C, 0x08, 0x00, 0xF0, 0xE2, 0xDC, 0xDC, 0xE8, 
-    0xF6, 0xFF, 0x06, 0x00, 0xFA, 0xF0, 0xE0, 0xD9, 0xD2, 0xD3, 0xDB, 0xE6, 
-    0xF1, 0xFB, 0x02, 0x03, 0x00, 0xF4, 0xE3, 0xD8, 0xD3, 0xD5, 0xDF, 0xE9, 
-    0xEE, 0xF4, 0xF6, 0xFA, 0xFD, 0xF6, 0xED, 0xE1, 0xD7, 0xD0, 0xD2, 0xDC, 
-    0xE8, 0xF4, 0xFC, 0xFB, 0xF6, 0xEE, 0xE8, 0xE4, 0xDE, 0xE2, 0xE8, 0xF4, 
-    0x05, 0x0D, 0x16, 0x1A, 0x18, 0x11, 0x05, 0xFC, 0xF1, 0xF1, 0xF2, 0xF9, 
-    0x03, 0x09, 0x11, 0x13, 0x13, 0x0C, 0x02, 0xF5, 0xE6, 0xDC, 0xD9, 0xE4, 
-    0xF1, 0x04, 0x0D, 0x0C, 0x0A, 0xFF, 0xF8, 0xF1, 0xEA, 0xE8, 0xEB, 0xF6, 
-    0x01, 0x0A, 0x14, 0x17, 0x14, 0x0C, 0x00, 0xF3, 0xED, 0xED, 0xF3, 0xFB, 
-    0x02, 0x07, 0x06, 0x03, 0xFE, 0xFA, 0xF3, 0xE8, 0xDC, 0xD0, 0xCA, 0xCF, 
-    0xDB, 0xEA, 0xF5, 0xF8, 0xF3, 0xEC, 0xE7, 0xE1, 0xE0, 0xDC, 0xDB, 0xDF, 
-    0xE9, 0xF5, 0x00, 0x0A, 0x09, 0x05, 0xFF, 0xF4, 0xEE, 0xEC, 0xEE, 0xF6, 
-    0x01, 0x07, 0x0C, 0x0F, 0x13, 0x18, 0x17, 0x0E, 0x02, 0xF5, 0xED, 0xEF, 
-    0xF8, 0x05, 0x11, 0x14, 0x14, 0x0B, 0x01, 0xF9, 0xF2, 0xEB, 0xE6, 0xE7, 
-    0xEC, 0xF2, 0xF7, 0xFA, 0xFA, 0xF9, 0xF5, 0xF0, 0xE9, 0xE5, 0xE3, 0xEB, 
-    0xF0, 0xF9, 0x01, 0x08, 0x12, 0x17, 0x1C, 0x19, 0x12, 0x04, 0xF9, 0xF3, 
-    0xF9, 0x01, 0x0D, 0x15, 0x19, 0x17, 0x11, 0x0A, 0xFD, 0xF3, 0xE7, 0xDE, 
-    0xDF, 0xE5, 0xE9, 0xF4, 0xFA, 0xFE, 0xFB, 0xF1, 0xE2, 0xD3, 0xCA, 0xC7, 
-    0xCB, 0xD1, 0xD7, 0xDE, 0xE4, 0xEC, 0xF3, 0xF1, 0xEA, 0xDB, 0xD3, 0xCF, 
-    0xD7, 0xE5, 0xF3, 0x04, 0x0D, 0x0F, 0x11, 0x0D, 0x08, 0x04, 0xFC, 0xF8, 
-    0xFB, 0x02, 0x0F, 0x20, 0x2A, 0x30, 0x2E, 0x29, 0x1C, 0x12, 0x09, 0x04, 
-    0x06, 0x0B, 0x10, 0x14, 0x1D, 0x24, 0x2A, 0x27, 0x1D, 0x0D, 0xFC, 0xEE, 
-    0xED, 0xF8, 0x06, 0x17, 0x21, 0x24, 0x23, 0x1E, 0x14, 0x0D, 0x04, 0xFE, 
-    0x01, 0x05, 0x11, 0x1F, 0x27, 0x2A, 0x27, 0x1D, 0x13, 0x05, 0xFA, 0xF5, 
-    0xF5, 0xFA, 0x00, 0x05, 0x09, 0x0D, 0x0D, 0x0A, 0x03, 0xFA, 0xF1, 0xE7, 
-    0xE8, 0xF1, 0xFE, 0x10, 0x1B, 0x1E, 0x1C, 0x14, 0x0F, 0x0B, 0x05, 0x01, 
-    0xFD, 0x01, 0x09, 0x11, 0x1C, 0x20, 0x22, 0x22, 0x19, 0x10, 0x06, 0x00, 
-    0xFC, 0x01, 0x0A, 0x0F, 0x17, 0x1D, 0x21, 0x22, 0x20, 0x19, 0x10, 0x09, 
-    0x02, 0x04, 0x0C, 0x1B, 0x24, 0x2B, 0x29, 0x23, 0x1F, 0x18, 0x15, 0x0E, 
-    0x0D, 0x11, 0x19, 0x22, 0x29, 0x2F, 0x30, 0x2D, 0x24, 0x1A, 0x0E, 0x09, 
-    0x06, 0x05, 0x06, 0x09, 0x10, 0x18, 0x20, 0x23, 0x26, 0x22, 0x1A, 0x10, 
-    0x07, 0x03, 0x06, 0x11, 0x1B, 0x25, 0x29, 0x29, 0x28, 0x22, 0x1B, 0x12, 
-    0x09, 0x05, 0x03, 0x07, 0x0B, 0x14, 0x1B, 0x1C, 0x1A, 0x12, 0x0A, 0x00, 
-    0xF4, 0xEE, 0xED, 0xF2, 0xF6, 0xFD, 0x03, 0x07, 0x07, 0xFE, 0xF0, 0xDF, 
-    0xD1, 0xCA, 0xCA, 0xD3, 0xE0, 0xEE, 0xF5, 0xF5, 0xEE, 0xE7, 0xE4, 0xDD, 
-    0xD4, 0xCF, 0xD0, 0xD8, 0xE4, 0xF3, 0xFF, 0x07, 0x0C, 0x09, 0x03, 0xF9, 
-    0xF0, 0xEB, 0xED, 0xF3, 0xFA, 0x03, 0x0D, 0x17, 0x1B, 0x1B, 0x10, 0x02, 
-    0xF1, 0xE3, 0xE0, 0xE2, 0xEE, 0xFC, 0x05, 0x09, 0x04, 0xFE, 0xF5, 0xEC, 
-    0xE3, 0xD9, 0xDB, 0xE2, 0xEA, 0xF8, 0x05, 0x0E, 0x12, 0x0D, 0xFF, 0xF1, 
-    0xE7, 0xE2, 0xE3, 0xEB, 0xF5, 0x00, 0x0E, 0x13, 0x14, 0x11, 0x04, 0xF5, 
-    0xE3, 0xD6, 0xCE, 0xD5, 0xDF, 0xED, 0xF7, 0xFC, 0xF8, 0xED, 0xE6, 0xD9, 
-    0xD2, 0xCB, 0xCA, 0xD2, 0xDB, 0xE9, 0xF6, 0xFD, 0x01, 0x01, 0xFB, 0xF2, 
-    0xE7, 0xDF, 0xDF, 0xE5, 0xED, 0xF6, 0x02, 0x0B, 0x0F, 0x0E, 0x08, 0xFF, 
-    0xF3, 0xE8, 0xE2, 0xE4, 0xEE, 0xFD, 0x0D, 0x14, 0x13, 0x0A, 0xFF, 0xF6, 
-    0xEE, 0xE7, 0xE0, 0xE3, 0xEC, 0xF8, 0x05, 0x0A, 0x0A, 0x07, 0xFF, 0xF4, 
-    0xE7, 0xE0, 0xDE, 0xE4, 0xEF, 0xF3, 0xFE, 0x06, 0x0D, 0x12, 0x0F, 0x0A, 
-    0xFE, 0xF5, 0xEE, 0xEF, 0xF6, 0xFF, 0x0B, 0x13, 0x14, 0x11, 0x09, 0x00, 
-    0xFA, 0xF0, 0xE8, 0xE5, 0xE4, 0xEA, 0xF3, 0xFA, 0xFE, 0xFE, 0xFB, 0xF2, 
-    0xE8, 0xDE, 0xD7, 0xD8, 0xDC, 0xE2, 0xE7, 0xF0, 0xF9, 0x00, 0x01, 0xFD, 
-    0xF3, 0xE8, 0xDF, 0xDA, 0xDE, 0xE9, 0xFB, 0x0B, 0x16, 0x19, 0x11, 0x0A, 
-    0x03, 0xF9, 0xF1, 0xEB, 0xEB, 0xF2, 0xFB, 0x03, 0x0A, 0x0D, 0x0C, 0x08, 
-    0xFE, 0xF3, 0xEC, 0xE9, 0xEB, 0xF1, 0xF7, 0x00, 0x09, 0x12, 0x16, 0x14, 
-    0x0D, 0x03, 0xF8, 0xEB, 0xE7, 0xEC, 0xF6, 0x08, 0x14, 0x19, 0x16, 0x0E, 
-    0x03, 0xF8, 0xEE, 0xE7, 0xE9, 0xEE, 0xFB, 0x06, 0x10, 0x18, 0x18, 0x12, 
-    0x07, 0xF8, 0xEC, 0xE5, 0xE5, 0xEB, 0xF1, 0xF8, 0x01, 0x0A, 0x0D, 0x0B, 
-    0xFF, 0xF0, 0xE0, 0xD5, 0xD2, 0xD7, 0xE0, 0xEE, 0xF8, 0xFD, 0x00, 0xF9, 
-    0xF4, 0xEB, 0xE1, 0xDD, 0xDE, 0xE6, 0xF5, 0x01, 0x0C, 0x13, 0x13, 0x12, 
-    0x0B, 0x02, 0xFA, 0xF5, 0xF4, 0xF8, 0xFC, 0x03, 0x0A, 0x12, 0x17, 0x14, 
-    0x0A, 0xFE, 0xF0, 0xE5, 0xE3, 0xE4, 0xEF, 0xFC, 0x07, 0x0F, 0x0C, 0x02, 
-    0xF7, 0xEB, 0xDE, 0xD6, 0xD4, 0xD9, 0xE5, 0xF3, 0xFE, 0x06, 0x08, 0x04, 
-    0xFF, 0xF8, 0xEE, 0xE8, 0xE8, 0xEC, 0xF5, 0xFA, 0x00, 0x04, 0x0B, 0x11, 
-    0x10, 0x0A, 0x03, 0xFC, 0xF6, 0xFB, 0x01, 0x0F, 0x1B, 0x23, 0x27, 0x24, 
-    0x1D, 0x14, 0x0B, 0x04, 0x02, 0x05, 0x0C, 0x15, 0x1D, 0x24, 0x26, 0x24, 
-    0x1F, 0x14, 0x07, 0xFD, 0xF9, 0xF9, 0x00, 0x08, 0x0C, 0x12, 0x18, 0x1C, 
-    0x1B, 0x13, 0x04, 0xF7, 0xEC, 0xEB, 0xF1, 0xFB, 0x09, 0x13, 0x18, 0x16, 
-    0x0F, 0x05, 0xFB, 0xF1, 0xEF, 0xF3, 0xFB, 0x07, 0x13, 0x1D, 0x24, 0x26, 
-    0x25, 0x21, 0x1B, 0x15, 0x0F, 0x0E, 0x11, 0x15, 0x1B, 0x21, 0x2B, 0x32, 
-    0x35, 0x2F, 0x24, 0x16, 0x08, 0x03, 0x03, 0x0B, 0x14, 0x1E, 0x25, 0x26, 
-    0x22, 0x1A, 0x10, 0x04, 0xF9, 0xF6, 0xFC, 0x09, 0x17, 0x24, 0x2B, 0x2B, 
-    0x27, 0x21, 0x17, 0x0C, 0x02, 0xFF, 0xFF, 0x06, 0x0D, 0x17, 0x24, 0x29, 
-    0x2D, 0x27, 0x1D, 0x14, 0x08, 0x01, 0x00, 0x05, 0x10, 0x1A, 0x22, 0x22, 
-    0x1C, 0x12, 0x09, 0x00, 0xF8, 0xF6, 0xF6, 0xFE, 0x07, 0x11, 0x17, 0x19, 
-    0x19, 0x11, 0x09, 0xFF, 0xF9, 0xF8, 0xFE, 0x06, 0x0F, 0x16, 0x1E, 0x27, 
-    0x30, 0x34, 0x2E, 0x24, 0x16, 0x0B, 0x07, 0x0F, 0x1C, 0x29, 0x31, 0x32, 
-    0x30, 0x29, 0x1D, 0x11, 0x04, 0xFB, 0xFB, 0xFE, 0x05, 0x0B, 0x0F, 0x0E, 
-    0x08, 0xFF, 0xF3, 0xE9, 0xE0, 0xDA, 0xD9, 0xDD, 0xE3, 0xE8, 0xEC, 0xEE, 
-    0xEF, 0xF0, 0xEF, 0xEC, 0xE6, 0xE1, 0xDF, 0xE4, 0xEF, 0xFA, 0x04, 0x09, 
-    0x07, 0x00, 0xF7, 0xEE, 0xE7, 0xE3, 0xE4, 0xE7, 0xED, 0xF2, 0xF6, 0xF9, 
-    0xF8, 0xF4, 0xEE, 0xE9, 0xE2, 0xDB, 0xD8, 0xD9, 0xDD, 0xE2, 0xEB, 0xF1, 
-    0xF6, 0xF8, 0xF6, 0xF0, 0xE9, 0xE3, 0xDD, 0xDC, 0xE0, 0xEA, 0xF4, 0xFE, 
-    0x04, 0x05, 0x03, 0xFE, 0xFA, 0xF5, 0xF3, 0xF6, 0xFD, 0x05, 0x0B, 0x0F, 
-    0x0E, 0x0F, 0x0C, 0x08, 0x00, 0xF9, 0xF4, 0xF3, 0xF7, 0xFA, 0xFD, 0xFE, 
-    0xFF, 0x01, 0x01, 0xFD, 0xF7, 0xF0, 0xE8, 0xE3, 0xE2, 0xE7, 0xEF, 0xF6, 
-    0xFB, 0xFB, 0xF9, 0xF8, 0xF4, 0xEA, 0xE1, 0xDC, 0xDB, 0xE3, 0xEE, 0xFA, 
-    0x02, 0x04, 0x03, 0xFF, 0xF8, 0xF0, 0xE8, 0xE2, 0xE3, 0xE8, 0xEC, 0xF0, 
-    0xF5, 0xFA, 0xFE, 0xFE, 0xF7, 0xEE, 0xE2, 0xDA, 0xD9, 0xDD, 0xE8, 0xF4, 
-    0xFD, 0x03, 0x04, 0x01, 0xFC, 0xF2, 0xEA, 0xE5, 0xE8, 0xEF, 0xF7, 0xFF, 
-    0x04, 0x05, 0x05, 0x01, 0xFB, 0xF4, 0xEE, 0xEB, 0xED, 0xF2, 0xF6, 0xF9, 
-    0xFA, 0xFF, 0x05, 0x0A, 0x08, 0x03, 0xFC, 0xF3, 0xF0, 0xF0, 0xF6, 0xFF, 
-    0x09, 0x0D, 0x0D, 0x08, 0x04, 0xFD, 0xF5, 0xF3, 0xF3, 0xF8, 0xFC, 0x00, 
-    0x02, 0x04, 0x05, 0x06, 0x03, 0xFE, 0xF8, 0xF2, 0xF0, 0xF0, 0xF2, 0xF4, 
-    0xF8, 0xFB, 0xFF, 0x03, 0x02, 0xFD, 0xF7, 0xF1, 0xED, 0xEE, 0xF3, 0xFC, 
-    0x04, 0x06, 0x04, 0xFC, 0xF5, 0xEC, 0xE5, 0xDF, 0xDE, 0xE4, 0xED, 0xF7, 
-    0xFE, 0x01, 0x03, 0x02, 0xFE, 0xF9, 0xF3, 0xEF, 0xEE, 0xF1, 0xF5, 0xF9, 
-    0xFE, 0x00, 0x04, 0x08, 0x09, 0x07, 0x01, 0xF8, 0xF0, 0xED, 0xEF, 0xF5, 
-    0xFC, 0x01, 0x02, 0xFF, 0xF9, 0xF3, 0xE9, 0xE3, 0xE1, 0xE2, 0xE8, 0xEF, 
-    0xF8, 0x00, 0x04, 0x02, 0xFB, 0xF3, 0xF0, 0xEF, 0xF0, 0xF5, 0xFD, 0x06, 
-    0x0B, 0x0E, 0x12, 0x17, 0x19, 0x17, 0x0E, 0x04, 0xFC, 0xF8, 0xF9, 0xFE, 
-    0x04, 0x0A, 0x0C, 0x0A, 0x07, 0x01, 0xFA, 0xF2, 0xEC, 0xEC, 0xEF, 0xF6, 
-    0xFD, 0x03, 0x07, 0x07, 0x04, 0xFD, 0xF4, 0xEE, 0xEC, 0xEC, 0xEE, 0xF0, 
-    0xF0, 0xF0, 0xF4, 0xFB, 0x01, 0x01, 0xFC, 0xF2, 0xE8, 0xE1, 0xE0, 0xE3, 
-    0xE9, 0xF1, 0xF6, 0xF9, 0xF6, 0xF0, 0xE7, 0xE0, 0xDC, 0xDD, 0xE3, 0xEA, 
-    0xF1, 0xF7, 0xFD, 0x00, 0xFE, 0xF9, 0xF2, 0xEE, 0xEC, 0xEE, 0xF4, 0xFB, 
-    0x02, 0x08, 0x0B, 0x0F, 0x15, 0x19, 0x19, 0x14, 0x0D, 0x09, 0x09, 0x0F, 
-    0x17, 0x20, 0x29, 0x2F, 0x32, 0x30, 0x2A, 0x20, 0x1A, 0x18, 0x1B, 0x1F, 
-    0x23, 0x27, 0x2B, 0x2C, 0x29, 0x22, 0x19, 0x11, 0x0C, 0x09, 0x0A, 0x0B, 
-    0x0D, 0x0F, 0x11, 0x14, 0x18, 0x1B, 0x1A, 0x15, 0x0F, 0x08, 0x05, 0x08, 
-    0x0E, 0x15, 0x19, 0x1B, 0x19, 0x15, 0x0D, 0x02, 0xF7, 0xF1, 0xF1, 0xF6, 
-    0xFE, 0x04, 0x08, 0x0A, 0x09, 0x06, 0xFF, 0xF8, 0xF3, 0xF3, 0xF4, 0xF6, 
-    0xF9, 0xFC, 0x01, 0x06, 0x0B, 0x0E, 0x10, 0x0F, 0x0B, 0x05, 0x03, 0x05, 
-    0x0C, 0x15, 0x1C, 0x22, 0x25, 0x27, 0x24, 0x1C, 0x13, 0x0B, 0x09, 0x0F, 
-    0x16, 0x1E, 0x25, 0x2B, 0x2D, 0x2E, 0x29, 0x1F, 0x16, 0x0F, 0x0E, 0x0F, 
-    0x14, 0x17, 0x18, 0x1C, 0x1D, 0x20, 0x21, 0x1B, 0x14, 0x0B, 0x02, 0xFE, 
-    0x02, 0x0C, 0x16, 0x1D, 0x23, 0x23, 0x23, 0x1B, 0x0E, 0x05, 0xFA, 0xF9, 
-    0xFA, 0xFF, 0x02, 0x08, 0x0E, 0x12, 0x11, 0x0C, 0x05, 0x04, 0xFE, 0xFF, 
-    0xFF, 0x00, 0x06, 0x0A, 0x0C, 0x0B, 0x0C, 0x05, 0xFD, 0xF2, 0xE8, 0xE1, 
-    0xE8, 0xF1, 0xFE, 0x03, 0x06, 0x03, 0xF8, 0xF5, 0xE8, 0xDC, 0xD8, 0xDB, 
-    0xE8, 0xF9, 0x03, 0x0E, 0x11, 0x13, 0x0F, 0x02, 0xFA, 0xEF, 0xE8, 0xEB, 
-    0xF1, 0x00, 0x0D, 0x13, 0x18, 0x14, 0x15, 0x0F, 0x09, 0xFF, 0xF5, 0xEB, 
-    0xEA, 0xF2, 0xFA, 0x00, 0xFF, 0xFB, 0xF5, 0xF5, 0xF1, 0xEB, 0xEA, 0xE9, 
-    0xED, 0xFC, 0x04, 0x0B, 0x0E, 0x0C, 0x0B, 0x05, 0x02, 0xF9, 0xF5, 0xF3, 
-    0xF2, 0xF7, 0xF9, 0xF7, 0xF5, 0xF5, 0xF5, 0xF7, 0xF3, 0xEF, 0xEA, 0xE4, 
-    0xE7, 0xE8, 0xF0, 0xF8, 0xFD, 0x04, 0x04, 0x03, 0xFE, 0xFD, 0xF7, 0xF4, 
-    0xF2, 0xF4, 0xFA, 0xFF, 0xFE, 0xFD, 0xF9, 0xF3, 0xF2, 0xEB, 0xE8, 0xE2, 
-    0xE4, 0xE2, 0xE0, 0xDB, 0xDA, 0xDE, 0xE5, 0xEC, 0xF0, 0xF0, 0xED, 0xEC, 
-    0xE5, 0xEB, 0xEA, 0xF5, 0xFC, 0x02, 0x09, 0x07, 0x05, 0xFC, 0xF3, 0xE7, 
-    0xE1, 0xE1, 0xE6, 0xE9, 0xEF, 0xF1, 0xED, 0xEE, 0xEB, 0xE7, 0xE1, 0xDA, 
-    0xD9, 0xD8, 0xDD, 0xE8, 0xF6, 0x04, 0x12, 0x1A, 0x24, 0x22, 0x1E, 0x13, 
-    0x08, 0x03, 0x00, 0x0B, 0x12, 0x1D, 0x1E, 0x1D, 0x16, 0x0E, 0x07, 0xFF, 
-    0xFD, 0xF8, 0xF6, 0xFB, 0xFD, 0x02, 0x01, 0x00, 0x01, 0xFC, 0xFA, 0xF8, 
-    0xFB, 0xFB, 0x04, 0x0D, 0x10, 0x18, 0x1C, 0x1D, 0x1E, 0x19, 0x12, 0x07, 
-    0xFF, 0xFC, 0xFC, 0x04, 0x0C, 0x11, 0x11, 0x0F, 0x0A, 0x00, 0xF7, 0xEF, 
-    0xEC, 0xEF, 0xF0, 0xFA, 0x03, 0x0C, 0x15, 0x16, 0x12, 0x0A, 0x01, 0xF7, 
-    0xF8, 0xF8, 0x01, 0x08, 0x0D, 0x0D, 0x0C, 0x0A, 0x07, 0x07, 0x02, 0x03, 
-    0xFD, 0xFF, 0x07, 0x0E, 0x12, 0x12, 0x13, 0x0A, 0x08, 0x06, 0x00, 0x03, 
-    0x03, 0x09, 0x12, 0x19, 0x23, 0x24, 0x25, 0x1D, 0x14, 0x08, 0xFD, 0xF6, 
-    0xEF, 0xF1, 0xF3, 0xF8, 0xFB, 0xFB, 0xFA, 0xF8, 0xF7, 0xF3, 0xF6, 0xF4, 
-    0xEF, 0xF0, 0xF0, 0xF9, 0x02, 0x0D, 0x19, 0x1C, 0x1B, 0x12, 0x0D, 0x07, 
-    0x01, 0xFE, 0xFE, 0xFD, 0x03, 0x09, 0x0D, 0x0E, 0x0C, 0x04, 0x00, 0xF9, 
-    0xF2, 0xF7, 0xF5, 0xF5, 0xF7, 0xF1, 0xEC, 0xEB, 0xEB, 0xEE, 0xEE, 0xEF, 
-    0xED, 0xEE, 0xED, 0xF2, 0xF9, 0x00, 0x07, 0x07, 0x08, 0x02, 0x01, 0xFB, 
-    0xFB, 0xF6, 0xF5, 0xF1, 0xEF, 0xF1, 0xF4, 0xFA, 0xFD, 0xFE, 0xFA, 0xF7, 
-    0xF3, 0xF0, 0xEA, 0xED, 0xEB, 0xEF, 0xF3, 0xF9, 0xFE, 0x03, 0x04, 0x01, 
-    0xFB, 0xF3, 0xF3, 0xF1, 0xF8, 0xFA, 0xFF, 0xFD, 0xFB, 0xFE, 0xFA, 0xF8, 
-    0xF3, 0xEC, 0xE9, 0xE7, 0xEB, 0xEF, 0xF7, 0xFC, 0x00, 0xFB, 0xF4, 0xF1, 
-    0xE8, 0xE9, 0xE7, 0xF1, 0xF3, 0xF8, 0xFD, 0x01, 0x05, 0x02, 0x01, 0xFC, 
-    0xF9, 0xF3, 0xEE, 0xEA, 0xE9, 0xEB, 0xEB, 0xEA, 0xE9, 0xE9, 0xE6, 0xDE, 
-    0xD4, 0xCA, 0xC9, 0xC9, 0xD0, 0xD9, 0xE3, 0xEA, 0xF2, 0xF8, 0xF7, 0xF8, 
-    0xF0, 0xF2, 0xF4, 0xFF, 0x08, 0x0F, 0x19, 0x1A, 0x1F, 0x20, 0x1F, 0x1C, 
-    0x14, 0x0A, 0x02, 0xFD, 0x00, 0x04, 0x0A, 0x0C, 0x0A, 0x08, 0xFF, 0xF6, 
-    0xEE, 0xEB, 0xF0, 0xF5, 0x00, 0x0B, 0x16, 0x20, 0x20, 0x20, 0x1F, 0x17, 
-    0x12, 0x0A, 0x08, 0x0C, 0x14, 0x14, 0x0F, 0x0B, 0x03, 0x02, 0x04, 0x08, 
-    0x06, 0x06, 0x02, 0xFE, 0xFE, 0x03, 0x0D, 0x13, 0x15, 0x16, 0x12, 0x11, 
-    0x0C, 0x0A, 0x0A, 0x0A, 0x10, 0x13, 0x17, 0x1A, 0x16, 0x10, 0x07, 0x00, 
-    0xFE, 0xFC, 0xFD, 0xFB, 0xFE, 0xFF, 0xFC, 0xFA, 0xFB, 0xFF, 0x03, 0x08, 
-    0x08, 0x02, 0x01, 0xFF, 0x01, 0x06, 0x0A, 0x0E, 0x0E, 0x11, 0x0F, 0x0F, 
-    0x0E, 0x07, 0x06, 0x04, 0x03, 0x03, 0x01, 0xFE, 0xFC, 0xFC, 0xF8, 0xFC, 
-    0xFB, 0xFA, 0xF9, 0xF5, 0xF6, 0xF9, 0xFB, 0xFA, 0xFE, 0xFE, 0x03, 0x0B, 
-    0x0D, 0x12, 0x11, 0x0D, 0x07, 0x01, 0xFF, 0xFE, 0x00, 0x04, 0x09, 0x0E, 
-    0x10, 0x0E, 0x09, 0x01, 0xF7, 0xF0, 0xF1, 0xF3, 0xFB, 0xFF, 0xFF, 0xFC, 
-    0xF5, 0xEF, 0xEF, 0xEF, 0xF6, 0xFD, 0x00, 0x09, 0x05, 0x08, 0x0A, 0x0F, 
-    0x15, 0x0F, 0x0E, 0x01, 0xF8, 0xF1, 0xEB, 0xF0, 0xF3, 0xF8, 0xF9, 0xF9, 
-    0xF4, 0xF1, 0xEA, 0xE5, 0xE0, 0xDD, 0xE0, 0xE4, 0xEC, 0xF3, 0xF8, 0xF9, 
-    0xF6, 0xF0, 0xEE, 0xEB, 0xEE, 0xF2, 0xF9, 0xF8, 0xF5, 0xF4, 0xF6, 0xFC, 
-    0xFC, 0xFF, 0xF5, 0xEF, 0xEC, 0xED, 0xF6, 0xFA, 0x02, 0x05, 0x06, 0x03, 
-    0xFF, 0xF9, 0xF3, 0xEA, 0xE6, 0xE6, 0xE9, 0xF6, 0xFC, 0x00, 0xFD, 0xFA, 
-    0xF3, 0xEF, 0xEE, 0xEB, 0xED, 0xEE, 0xF2, 0xF4, 0xF6, 0xF4, 0xF1, 0xED, 
-    0xE8, 0xE7, 0xE5, 0xE4, 0xE2, 0xDF, 0xE2, 0xE8, 0xEF, 0xF5, 0xF8, 0xF8, 
-    0xF4, 0xF4, 0xF2, 0xF3, 0xFB, 0xFD, 0x05, 0x0F, 0x15, 0x17, 0x17, 0x1A, 
-    0x19, 0x1B, 0x1B, 0x18, 0x14, 0x0D, 0x09, 0x01, 0xFC, 0xFA, 0xF4, 0xF0, 
-    0xED, 0xEE, 0xEE, 0xED, 0xEF, 0xED, 0xF2, 0xFE, 0x06, 0x0C, 0x0C, 0x09, 
-    0x09, 0x0B, 0x0D, 0x0F, 0x11, 0x0E, 0x0B, 0x0A, 0x0C, 0x0F, 0x0F, 0x0D, 
-    0x0B, 0x09, 0x09, 0x09, 0x07, 0x04, 0x06, 0x01, 0x02, 0x00, 0x01, 0x00, 
-    0x05, 0x0D, 0x12, 0x19, 0x18, 0x16, 0x11, 0x0F, 0x0B, 0x0D, 0x10, 0x11, 
-    0x14, 0x12, 0x10, 0x10, 0x0C, 0x06, 0x00, 0xFC, 0x00, 0x03, 0x0A, 0x0D, 
-    0x0A, 0x08, 0x09, 0x08, 0x07, 0x0A, 0x07, 0x03, 0x02, 0x00, 0x00, 0x06, 
-    0x09, 0x0F, 0x18, 0x1A, 0x17, 0x10, 0x09, 0x03, 0x03, 0xFF, 0x04, 0x02, 
-    0x04, 0x05, 0xFC, 0xFA, 0xF2, 0xEF, 0xEC, 0xEA, 0xED, 0xEF, 0xF4, 0xF7, 
-    0xFB, 0xFD, 0xFF, 0xFE, 0xFD, 0x00, 0xF9, 0xF9, 0xF6, 0xFC, 0xFA, 0xFF, 
-    0x01, 0x04, 0x0C, 0x10, 0x12, 0x0A, 0x09, 0x00, 0xFF, 0xFF, 0xFD, 0x02, 
-    0x05, 0x06, 0x06, 0xFA, 0xF7, 0xF1, 0xF2, 0xF5, 0xF8, 0xFE, 0x03, 0x05, 
-    0x06, 0x05, 0x00, 0xFF, 0xF9, 0xFA, 0xF8, 0xFC, 0xFC, 0xFD, 0xFA, 0xF8, 
-    0xF5, 0xF3, 0xF4, 0xF5, 0xF4, 0xEF, 0xEF, 0xE7, 0xEB, 0xED, 0xF2, 0xF8, 
-    0xFC, 0x02, 0x05, 0x03, 0x01, 0xFF, 0x00, 0x02, 0x05, 0x06, 0x04, 0x06, 
-    0x01, 0x00, 0xFA, 0xF5, 0xF4, 0xF2, 0xF4, 0xF0, 0xF3, 0xF5, 0xF4, 0xF6, 
-    0xF1, 0xF2, 0xF3, 0xF5, 0xFB, 0xF7, 0xF5, 0xED, 0xEC, 0xEF, 0xF0, 0xF3, 
-    0xF5, 0xF2, 0xF1, 0xF0, 0xEB, 0xEC, 0xE7, 0xE5, 0xE6, 0xE6, 0xEA, 0xEB, 
-    0xE6, 0xE5, 0xE2, 0xE3, 0xE3, 0xE7, 0xE8, 0xE9, 0xEC, 0xE8, 0xE7, 0xE6, 
-    0xE3, 0xE1, 0xE8, 0xED, 0xF4, 0xF6, 0xF7, 0xF5, 0xF3, 0xF6, 0xFB, 0xFE, 
-    0x04, 0x09, 0x0D, 0x14, 0x15, 0x1B, 0x1C, 0x22, 0x20, 0x1F, 0x19, 0x0E, 
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xF9, 0xF8, 0xF7, 0xF4, 
-    0xF9, 0xFD, 0x07, 0x12, 0x1A, 0x1A, 0x17, 0x12, 0x0E, 0x0D, 0x11, 0x13, 
-    0x16, 0x17, 0x15, 0x10, 0x0A, 0x07, 0x06, 0x02, 0xFE, 0xFB, 0xF3, 0xF4, 
-    0xF3, 0xF7, 0xF6, 0xFB, 0x05, 0x08, 0x0D, 0x0C, 0x09, 0x07, 0x09, 0x09, 
-    0x07, 0x0A, 0x0C, 0x0F, 0x13, 0x13, 0x12, 0x08, 0x08, 0x04, 0x06, 0x0A, 
-    0x09, 0x11, 0x0E, 0x11, 0x0C, 0x0E, 0x0C, 0x0D, 0x07, 0x00, 0x00, 0xFD, 
-    0x02, 0x05, 0x09, 0x08, 0x0D, 0x0C, 0x0C, 0x0F, 0x0E, 0x0B, 0x0A, 0x07, 
-    0x08, 0x0C, 0x0B, 0x0A, 0x0A, 0x08, 0x03, 0xFC, 0xF8, 0xF5, 0xF3, 0xF7, 
-    0xF5, 0xFC, 0x03, 0x03, 0x06, 0x00, 0xFD, 0xF6, 0xF7, 0xF9, 0xFD, 0x02, 
-    0x06, 0x07, 0x06, 0x06, 0x02, 0x05, 0x07, 0x0B, 0x0D, 0x13, 0x13, 0x12, 
-    0x0F, 0x08, 0x02, 0xFD, 0xFA, 0xF9, 0xFB, 0xFC, 0xFB, 0xF6, 0xF3, 0xEE, 
-    0xF1, 0xF4, 0xFD, 0x03, 0x01, 0xFF, 0xFA, 0xF9, 0xFB, 0xFB, 0xFB, 0xF9, 
-    0xF7, 0xF6, 0xF4, 0xF2, 0xF0, 0xEE, 0xED, 0xEE, 0xEA, 0xED, 0xEB, 0xEB, 
-    0xEB, 0xE8, 0xEA, 0xED, 0xF2, 0xFA, 0x00, 0x07, 0x08, 0x02, 0x04, 0x01, 
-    0x05, 0x08, 0x08, 0x06, 0x00, 0xFD, 0xF9, 0xF9, 0xFA, 0xF9, 0xFA, 0xF8, 
-    0xF3, 0xF0, 0xEE, 0xEE, 0xF0, 0xF3, 0xF9, 0xFD, 0xFF, 0x03, 0x05, 0x04, 
-    0xFE, 0xFB, 0xF5, 0xF6, 0xF7, 0xFB, 0x00, 0xFF, 0xFB, 0xF2, 0xF1, 0xEC, 
-    0xEB, 0xE9, 0xE8, 0xE5, 0xEA, 0xEC, 0xEE, 0xEF, 0xED, 0xEC, 0xE5, 0xE5, 
-    0xE1, 0xDF, 0xDF, 0xE0, 0xE3, 0xE6, 0xEB, 0xEB, 0xEC, 0xEC, 0xE8, 0xEB, 
-    0xE9, 0xEE, 0xF0, 0xF3, 0xF5, 0xF8, 0xFF, 0x00, 0x05, 0x05, 0x08, 0x07, 
-    0x0D, 0x0E, 0x12, 0x15, 0x17, 0x13, 0x11, 0x0F, 0x0B, 0x0A, 0x02, 0x04, 
-    0x01, 0xFF, 0xFB, 0xFC, 0xFC, 0x00, 0x07, 0x09, 0x0B, 0x09, 0x08, 0x09, 
-    0x05, 0x06, 0x06, 0x02, 0x09, 0x08, 0x11, 0x16, 0x16, 0x12, 0x07, 0xFB, 
-    0xFA, 0xFB, 0x05, 0x0C, 0x11, 0x14, 0x13, 0x11, 0x0F, 0x0F, 0x0B, 0x09, 
-    0x04, 0x03, 0x04, 0x07, 0x09, 0x0A, 0x09, 0x08, 0x08, 0x0D, 0x0D, 0x0E, 
-    0x0C, 0x09, 0x08, 0x0A, 0x0C, 0x0C, 0x12, 0x11, 0x14, 0x10, 0x09, 0x02, 
-    0xFF, 0x00, 0x02, 0x06, 0x0A, 0x0A, 0x08, 0x04, 0x05, 0x05, 0x06, 0x04, 
-    0x01, 0x00, 0xFC, 0xFB, 0xF8, 0xFB, 0xFB, 0xFF, 0x01, 0x00, 0x02, 0x02, 
-    0xFE, 0xFA, 0xF6, 0xF5, 0xF8, 0xF6, 0xFB, 0xFA, 0xFE, 0x00, 0xFF, 0xFA, 
-    0xF8, 0xFC, 0x01, 0x07, 0x08, 0x08, 0x07, 0x06, 0x07, 0x0A, 0x09, 0x0E, 
-    0x10, 0x15, 0x16, 0x14, 0x12, 0x10, 0x11, 0x0B, 0x0E, 0x09, 0x06, 0x03, 
-    0x01, 0x02, 0x00, 0xFF, 0xF5, 0xED, 0xEA, 0xEC, 0xF4, 0xFA, 0xFB, 0xFB, 
-    0xFC, 0xFE, 0xFD, 0xFF, 0x00, 0xFD, 0xFC, 0xFB, 0xFB, 0xFB, 0xFF, 0xFC, 
-    0xF6, 0xF2, 0xED, 0xEC, 0xEB, 0xEC, 0xF0, 0xF4, 0xFA, 0xFA, 0xF8, 0xFA, 
-    0xF9, 0xFB, 0xF8, 0xF1, 0xEF, 0xEB, 0xED, 0xF3, 0xFA, 0xFD, 0xFF, 0xFB, 
-    0xF1, 0xED, 0xE8, 0xEC, 0xEF, 0xF0, 0xF5, 0xF7, 0xFF, 0x00, 0x04, 0x02, 
-    0xFC, 0xFA, 0xFA, 0xFB, 0xFA, 0xFA, 0xFA, 0xFD, 0x00, 0x04, 0xFF, 0xFE, 
-    0xF6, 0xF4, 0xF0, 0xE9, 0xE5, 0xE2, 0xE5, 0xE8, 0xF0, 0xF3, 0xF7, 0xF2, 
-    0xEA, 0xE0, 0xDD, 0xDE, 0xE4, 0xE9, 0xEC, 0xEF, 0xF1, 0xF7, 0xF7, 0xF9, 
-    0xF2, 0xEF, 0xEB, 0xE9, 0xEC, 0xEA, 0xED, 0xF1, 0xFA, 0xFE, 0x02, 0x00, 
-    0xFF, 0xFD, 0x00, 0x03, 0x05, 0x0B, 0x0D, 0x14, 0x18, 0x17, 0x15, 0x10, 
-    0x0C, 0x02, 0xFF, 0x00, 0x01, 0x0B, 0x0B, 0x09, 0x07, 0x05, 0x05, 0x07, 
-    0x06, 0x05, 0x03, 0x00, 0xFE, 0xFA, 0xFB, 0xFA, 0xFD, 0xFC, 0xFD, 0xF8, 
-    0xF6, 0xF7, 0xFA, 0xFA, 0xFE, 0xFF, 0x01, 0x04, 0x06, 0x0D, 0x0D, 0x12, 
-    0x0C, 0x0D, 0x09, 0x0C, 0x10, 0x10, 0x13, 0x0F, 0x12, 0x13, 0x18, 0x1A, 
-    0x1A, 0x17, 0x13, 0x0F, 0x0F, 0x0D, 0x0A, 0x0C, 0x0A, 0x0E, 0x12, 0x12, 
-    0x11, 0x11, 0x12, 0x11, 0x10, 0x0C, 0x09, 0x07, 0x0A, 0x09, 0x0B, 0x0C, 
-    0x05, 0x01, 0xFB, 0xFA, 0xF8, 0xFD, 0xFF, 0x02, 0x05, 0x05, 0x08, 0x05, 
-    0x05, 0x00, 0xFD, 0xF6, 0xF5, 0xF2, 0xF0, 0xF2, 0xF4, 0xF7, 0xF9, 0xFC, 
-    0xFB, 0xFF, 0x01, 0x03, 0xFF, 0xFA, 0xF8, 0xF6, 0xF9, 0xFF, 0x03, 0x07, 
-    0x02, 0xFE, 0xFB, 0xF6, 0xFA, 0xFE, 0x06, 0x0A, 0x0D, 0x0E, 0x10, 0x0B, 
-    0x08, 0x05, 0xFE, 0xFB, 0xF7, 0xF6, 0xF4, 0xF6, 0xF9, 0xFD, 0x01, 0x02, 
-    0x02, 0x04, 0x04, 0x03, 0x04, 0x02, 0x04, 0x05, 0x03, 0x03, 0x04, 0x07, 
-    0x02, 0x01, 0xFA, 0xF1, 0xEF, 0xF2, 0xF7, 0xFB, 0xFE, 0xFC, 0xFD, 0xFD, 
-    0xFC, 0xFC, 0xF8, 0xF1, 0xEE, 0xE9, 0xE8, 0xE8, 0xE8, 0xEE, 0xF3, 0xF7, 
-    0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB, 0xF8, 0xFC, 0xFA, 0xF8, 0x00, 0xFE, 
-    0x02, 0x02, 0x00, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x00, 0x02, 0x03, 0x06, 
-    0x08, 0x08, 0x01, 0xF8, 0xEF, 0xEB, 0xE9, 0xE8, 0xE8, 0xE8, 0xE9, 0xE7, 
-    0xE7, 0xE1, 0xDB, 0xD8, 0xD6, 0xD4, 0xD3, 0xD5, 0xD6, 0xDC, 0xE0, 0xEA, 
-    0xEE, 0xEE, 0xF0, 0xED, 0xED, 0xEC, 0xF0, 0xF3, 0xF5, 0xF8, 0xF9, 0xFD, 
-    0x02, 0x00, 0x03, 0xFF, 0xFA, 0xF9, 0xFA, 0x05, 0x0A, 0x14, 0x1A, 0x1D, 
-    0x1A, 0x17, 0x11, 0x0D, 0x08, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x08, 0x0D, 
-    0x12, 0x12, 0x0C, 0x07, 0xFF, 0xFB, 0xFC, 0x02, 0x0A, 0x0B, 0x0C, 0x0C, 
-    0x0A, 0x09, 0x04, 0xFF, 0xF8, 0xF0, 0xED, 0xEC, 0xEF, 0xF5, 0xFD, 0x01, 
-    0x02, 0x05, 0x05, 0x03, 0x02, 0x03, 0x03, 0x05, 0x08, 0x0C, 0x12, 0x18, 
-    0x1D, 0x1E, 0x20, 0x15, 0x0E, 0x09, 0x06, 0x08, 0x0D, 0x09, 0x08, 0x08, 
-    0x07, 0x0B, 0x0C, 0x0B, 0x07, 0x05, 0x04, 0x05, 0x03, 0x07, 0x09, 0x0D, 
-    0x10, 0x11, 0x10, 0x0E, 0x0B, 0x09, 0x08, 0x04, 0x05, 0x07, 0x0B, 0x0D, 
-    0x0F, 0x0D, 0x0B, 0x03, 0xFB, 0xF7, 0xF4, 0xF4, 0xF7, 0xFC, 0xFC, 0xFF, 
-    0x04, 0x08, 0x0A, 0x08, 0x02, 0xFD, 0xFA, 0xF9, 0xF8, 0xFA, 0xF7, 0xFA, 
-    0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x02, 0x06, 0x0B, 0x0F, 
-    0x17, 0x18, 0x19, 0x12, 0x0A, 0xFD, 0xF4, 0xF2, 0xF0, 0xF1, 0xF8, 0xFA, 
-    0x02, 0x0B, 0x0D, 0x11, 0x0E, 0x09, 0x00, 0xFC, 0xF7, 0xF9, 0xFA, 0xFB, 
-    0xFF, 0xFF, 0xFD, 0xF8, 0xF2, 0xEC, 0xE9, 0xE6, 0xE3, 0xE1, 0xE1, 0xE5, 
-    0xF0, 0xF8, 0xFD, 0xFB, 0xF4, 0xED, 0xE9, 0xEB, 0xED, 0xF2, 0xF9, 0xFB, 
-    0x01, 0x06, 0x0C, 0x0E, 0x0C, 0x08, 0xFC, 0xF8, 0xF4, 0xF6, 0xF9, 0xFD, 
-    0x01, 0x03, 0x06, 0x05, 0x03, 0x01, 0xFC, 0xFA, 0xF7, 0xF4, 0xF5, 0xF9, 
-    0xFD, 0x00, 0x04, 0x01, 0xFD, 0xF5, 0xEF, 0xEE, 0xEF, 0xF0, 0xF3, 0xF7, 
-    0xFB, 0xFD, 0xFF, 0xFC, 0xF5, 0xED, 0xE2, 0xDA, 0xD4, 0xD5, 0xDA, 0xE0, 
-    0xE8, 0xEC, 0xEB, 0xED, 0xEA, 0xEA, 0xE8, 0xE5, 0xE8, 0xE9, 0xEF, 0xF2, 
-    0xF3, 0xF7, 0xF8, 0xF6, 0xF3, 0xED, 0xEC, 0xED, 0xEB, 0xEE, 0xF1, 0xF8, 
-    0x00, 0x05, 0x0B, 0x0B, 0x0D, 0x0C, 0x06, 0x01, 0xFD, 0xFC, 0x01, 0x07, 
-    0x0F, 0x15, 0x18, 0x18, 0x16, 0x15, 0x11, 0x10, 0x0D, 0x0E, 0x0D, 0x0B, 
-    0x0E, 0x0F, 0x11, 0x11, 0x0E, 0x06, 0x01, 0xFC, 0xF9, 0xF9, 0xFE, 0xFF, 
-    0xFF, 0x00, 0xFB, 0xFD, 0xFD, 0xFB, 0xF9, 0xF5, 0xEF, 0xEE, 0xF1, 0xFA, 
-    0x04, 0x09, 0x0D, 0x09, 0x0A, 0x0D, 0x10, 0x12, 0x0F, 0x0C, 0x0B, 0x09, 
-    0x0F, 0x12, 0x17, 0x1C, 0x1A, 0x19, 0x14, 0x12, 0x10, 0x13, 0x15, 0x13, 
-    0x14, 0x0F, 0x11, 0x17, 0x19, 0x1C, 0x17, 0x11, 0x0A, 0x07, 0x05, 0x04, 
-    0x05, 0x03, 0x04, 0x02, 0xFD, 0xF9, 0xF4, 0xEC, 0xE6, 0xE3, 0xE2, 0xE4, 
-    0xEA, 0xEF, 0xF7, 0xFC, 0xFE, 0xFD, 0xFB, 0xFA, 0xF7, 0xFA, 0xFB, 0xFE, 
-    0xFF, 0x04, 0x06, 0x07, 0x0A, 0x08, 0x08, 0x04, 0x01, 0xFD, 0xFD, 0xFE, 
-    0x02, 0x09, 0x12, 0x18, 0x1C, 0x1A, 0x14, 0x0D, 0x08, 0x04, 0xFF, 0xFB, 
-    0xF6, 0xF7, 0xFB, 0x03, 0x06, 0x06, 0x00, 0xFA, 0xF7, 0xF6, 0xF7, 0xF7, 
-    0xFA, 0xFC, 0x03, 0x05, 0x0B, 0x09, 0x07, 0x03, 0xFE, 0xF7, 0xF3, 0xF3, 
-    0xF5, 0xFA, 0xFB, 0xF9, 0xF5, 0xF0, 0xEC, 0xEB, 0xE9, 0xEB, 0xEA, 0xEF, 
-    0xF4, 0xF8, 0x02, 0x05, 0x08, 0x05, 0x00, 0xFA, 0xF6, 0xF6, 0xF8, 0xF9, 
-    0xFA, 0xFB, 0xFC, 0x01, 0x01, 0x02, 0x01, 0xFC, 0xF9, 0xF7, 0xF5, 0xF6, 
-    0xFC, 0xFD, 0x00, 0x00, 0xFB, 0xF9, 0xF6, 0xF4, 0xF5, 0xF5, 0xF5, 0xF8, 
-    0xFB, 0xFA, 0xFE, 0x03, 0x02, 0x03, 0xFC, 0xF5, 0xF0, 0xEF, 0xF0, 0xF4, 
-    0xF6, 0xF4, 0xF7, 0xF8, 0xF9, 0xF6, 0xF4, 0xF0, 0xE9, 0xE2, 0xE1, 0xDF, 
-    0xE1, 0xE5, 0xE5, 0xE9, 0xE7, 0xE5, 0xE3, 0xE2, 0xE4, 0xE4, 0xE6, 0xE9, 
-    0xEC, 0xF1, 0xF3, 0xF8, 0xFD, 0x05, 0x09, 0x09, 0x0A, 0x07, 0x09, 0x08, 
-    0x06, 0x05, 0x02, 0x05, 0x06, 0x09, 0x0B, 0x0A, 0x0B, 0x0C, 0x0D, 0x0C, 
-    0x0C, 0x0B, 0x0E, 0x13, 0x13, 0x12, 0x0F, 0x0C, 0x0D, 0x0B, 0x08, 0x06, 
-    0x04, 0x04, 0xFF, 0xFE, 0xFB, 0xFB, 0xFD, 0xF8, 0xF0, 0xEA, 0xE8, 0xED, 
-    0xF1, 0xF4, 0xFB, 0xFD, 0x05, 0x09, 0x0C, 0x0C, 0x07, 0x01, 0x00, 0x00, 
-    0x01, 0x07, 0x0A, 0x10, 0x12, 0x16, 0x14, 0x12, 0x11, 0x0A, 0x06, 0x00, 
-    0xFF, 0x05, 0x08, 0x0B, 0x12, 0x16, 0x1C, 0x19, 0x13, 0x0D, 0x0A, 0x0C, 
-    0x0C, 0x0D, 0x10, 0x12, 0x19, 0x1C, 0x1B, 0x1A, 0x10, 0x09, 0x01, 0xFD, 
-    0xFC, 0xFA, 0xFB, 0x00, 0x01, 0x04, 0x01, 0xFC, 0xF8, 0xEF, 0xEE, 0xE9, 
-    0xEA, 0xED, 0xF2, 0xF6, 0xFC, 0x03, 0x07, 0x07, 0x04, 0xFE, 0xFB, 0x01, 
-    0x02, 0x09, 0x0C, 0x0F, 0x11, 0x12, 0x0D, 0x05, 0xFE, 0xF5, 0xF0, 0xED, 
-    0xED, 0xF3, 0xFA, 0x03, 0x0B, 0x0E, 0x0D, 0x0C, 0x03, 0xFD, 0xFC, 0xFA, 
-    0xFB, 0xFD, 0xFF, 0x01, 0x04, 0x07, 0x0C, 0x0C, 0x06, 0xFF, 0xF7, 0xF8, 
-    0xF9, 0xFA, 0xFD, 0x01, 0x02, 0xFF, 0xFD, 0xF8, 0xF3, 0xEF, 0xEB, 0xEC, 
-    0xEC, 0xF1, 0xF8, 0xFE, 0xFF, 0xFF, 0xFC, 0xF9, 0xF7, 0xF4, 0xF5, 0xF6, 
-    0xF8, 0xF9, 0xFC, 0xFD, 0xFE, 0x00, 0x03, 0x01, 0xFD, 0xF8, 0xF5, 0xF6, 
-    0xF6, 0xFA, 0xF9, 0xFD, 0x01, 0x04, 0x05, 0x04, 0x01, 0xFD, 0xF9, 0xFC, 
-    0xFD, 0x01, 0x03, 0x01, 0x04, 0xFE, 0x00, 0xF7, 0xF3, 0xF0, 0xED, 0xEC, 
-    0xEB, 0xEA, 0xEA, 0xEB, 0xED, 0xF1, 0xF3, 0xF8, 0xFA, 0xF8, 0xF2, 0xF0, 
-    0xEB, 0xEA, 0xE4, 0xE3, 0xDF, 0xDE, 0xE0, 0xDE, 0xE1, 0xDF, 0xE2, 0xE3, 
-    0xE9, 0xED, 0xF0, 0xF2, 0xF3, 0xF6, 0xF6, 0xF5, 0xF2, 0xF2, 0xF5, 0xFB, 
-    0xFD, 0xFE, 0xFD, 0xFB, 0xFC, 0xF9, 0xFB, 0xFE, 0x00, 0xFD, 0xF6, 0xF2, 
-    0xED, 0xF0, 0xF4, 0xFB, 0x02, 0x08, 0x10, 0x16, 0x1B, 0x1B, 0x19, 0x16, 
-    0x16, 0x16, 0x16, 0x18, 0x1B, 0x20, 0x21, 0x1C, 0x14, 0x08, 0x02, 0xFF, 
-    0xFF, 0xFE, 0xF9, 0xFB, 0xFE, 0x03, 0x09, 0x0F, 0x11, 0x11, 0x0B, 0x04, 
-    0xFF, 0x02, 0x06, 0x0B, 0x0F, 0x13, 0x1A, 0x1E, 0x1D, 0x16, 0x0D, 0x03, 
-    0x00, 0xFE, 0x00, 0x03, 0x09, 0x0F, 0x15, 0x17, 0x13, 0x0D, 0x04, 0xFF, 
-    0xFA, 0xF8, 0xF3, 0xF7, 0xF8, 0xFE, 0x07, 0x10, 0x13, 0x13, 0x13, 0x09, 
-    0x0A, 0x07, 0x0A, 0x0E, 0x13, 0x17, 0x1D, 0x1F, 0x1B, 0x12, 0x09, 0xFF, 
-    0xF5, 0xF4, 0xF3, 0xF6, 0xF9, 0xF9, 0xFB, 0xFA, 0xF6, 0xF2, 0xEE, 0xEF, 
-    0xF4, 0xFD, 0x04, 0x09, 0x11, 0x13, 0x18, 0x19, 0x15, 0x13, 0x0A, 0x05, 
-    0x01, 0x00, 0x00, 0x01, 0x05, 0x04, 0x07, 0x05, 0x03, 0xFE, 0xFA, 0xF5, 
-    0xF2, 0xF3, 0xF8, 0xF9, 0xFC, 0x02, 0x04, 0x06, 0x06, 0xFE, 0xFB, 0xFA, 
-    0xFA, 0x00, 0x02, 0x08, 0x07, 0x08, 0x09, 0x0B, 0x0E, 0x0A, 0x03, 0xF7, 
-    0xEC, 0xE4, 0xE4, 0xE3, 0xE4, 0xE5, 0xE5, 0xE7, 0xEB, 0xEE, 0xEF, 0xF2, 
-    0xF4, 0xF9, 0xFB, 0x01, 0x01, 0x08, 0x05, 0x07, 0x05, 0x01, 0x01, 0x00, 
-    0x04, 0x04, 0x06, 0x00, 0xFC, 0xF6, 0xF3, 0xEF, 0xF1, 0xF2, 0xF3, 0xF3, 
-    0xEE, 0xEB, 0xEC, 0xF2, 0xF7, 0xFD, 0x00, 0x06, 0x0C, 0x13, 0x14, 0x12, 
-    0x0B, 0x07, 0x04, 0x03, 0xFE, 0xFD, 0xFB, 0xFC, 0xFD, 0xF9, 0xF2, 0xEC, 
-    0xE9, 0xE5, 0xE6, 0xE2, 0xE3, 0xE2, 0xE6, 0xE8, 0xEE, 0xF4, 0xFB, 0xFE, 
-    0xFB, 0xFA, 0xF7, 0xFA, 0xF8, 0xF8, 0xF7, 0xF8, 0xF7, 0xF5, 0xF1, 0xEB, 
-    0xE3, 0xE2, 0xE6, 0xE8, 0xEE, 0xF1, 0xF5, 0xF9, 0xFE, 0xFF, 0xFB, 0xF8, 
-    0xF4, 0xF3, 0xF4, 0xF7, 0xF6, 0xF6, 0xF8, 0xFD, 0xFF, 0x03, 0x04, 0x01, 
-    0xFC, 0xF2, 0xEC, 0xEA, 0xF1, 0xFB, 0x08, 0x0F, 0x16, 0x1A, 0x19, 0x16, 
-    0x0E, 0x09, 0x07, 0x09, 0x0C, 0x11, 0x16, 0x1A, 0x1A, 0x16, 0x0D, 0x04, 
-    0x02, 0x01, 0x02, 0x06, 0x0A, 0x0D, 0x15, 0x1A, 0x1C, 0x20, 0x21, 0x21, 
-    0x1D, 0x18, 0x11, 0x11, 0x13, 0x17, 0x18, 0x14, 0x12, 0x10, 0x0F, 0x0B, 
-    0x05, 0xFE, 0xFD, 0xFE, 0x07, 0x0C, 0x15, 0x1D, 0x20, 0x20, 0x18, 0x11, 
-    0x06, 0x02, 0x02, 0x03, 0x06, 0x05, 0x09, 0x0A, 0x0E, 0x0E, 0x0A, 0x06, 
-    0xFE, 0xFB, 0xF3, 0xF0, 0xEF, 0xF2, 0xFD, 0x02, 0x09, 0x08, 0x07, 0x05, 
-    0xFF, 0xFC, 0xF8, 0xF9, 0xFE, 0x02, 0x06, 0x06, 0x05, 0x03, 0xFD, 0xF8, 
-    0xF2, 0xEE, 0xF2, 0xF4, 0xF8, 0xFB, 0xFD, 0xFD, 0xFD, 0x00, 0x01, 0x02, 
-    0x01, 0xFE, 0xF8, 0xF5, 0xF0, 0xEE, 0xF3, 0xFC, 0x01, 0x05, 0x08, 0x0B, 
-    0x0E, 0x0F, 0x10, 0x0D, 0x10, 0x0F, 0x13, 0x14, 0x12, 0x11, 0x09, 0x00, 
-    0xF7, 0xEE, 0xE9, 0xE9, 0xEB, 0xEB, 0xED, 0xEC, 0xEB, 0xF1, 0xF4, 0xF7, 
-    0xF6, 0xF5, 0xF0, 0xEF, 0xF3, 0xF8, 0x00, 0x08, 0x0C, 0x11, 0x13, 0x13, 
-    0x12, 0x0A, 0x04, 0xFC, 0xF7, 0xF6, 0xFA, 0xFC, 0x02, 0x02, 0x03, 0x00, 
-    0xF9, 0xF6, 0xF0, 0xEC, 0xE8, 0xE4, 0xDF, 0xDF, 0xE2, 0xEB, 0xF1, 0xFB, 
-    0xFF, 0x00, 0xFD, 0xFB, 0xFB, 0xFB, 0x00, 0x03, 0x09, 0x09, 0x0C, 0x08, 
-    0x05, 0xFC, 0xEF, 0xE9, 0xE2, 0xE4, 0xE9, 0xEE, 0xF1, 0xF4, 0xF6, 0xF5, 
-    0xEF, 0xE9, 0xE0, 0xDD, 0xE1, 0xE7, 0xF0, 0xF9, 0x01, 0x07, 0x0D, 0x10, 
-    0x0F, 0x08, 0x00, 0xF9, 0xF1, 0xED, 0xEE, 0xF0, 0xF4, 0xF8, 0xF7, 0xF7, 
-    0xF3, 0xEC, 0xE6, 0xDE, 0xDC, 0xD9, 0xDE, 0xE4, 0xE9, 0xEE, 0xF0, 0xF4, 
-    0xF3, 0xF2, 0xF1, 0xF5, 0xFD, 0x06, 0x10, 0x15, 0x19, 0x1A, 0x1A, 0x18, 
-    0x13, 0x0C, 0x00, 0xF3, 0xEB, 0xE7, 0xEE, 0xF1, 0xF5, 0xFC, 0xFA, 0xFB, 
-    0xF9, 0xF7, 0xF5, 0xEF, 0xF0, 0xF2, 0xFB, 0x09, 0x11, 0x1A, 0x1E, 0x20, 
-    0x1F, 0x1E, 0x1C, 0x18, 0x17, 0x17, 0x15, 0x13, 0x11, 0x0F, 0x10, 0x13, 
-    0x16, 0x15, 0x12, 0x0A, 0x05, 0x04, 0x06, 0x05, 0x04, 0x04, 0x02, 0x06, 
-    0x06, 0x0A, 0x0C, 0x0F, 0x15, 0x1D, 0x23, 0x2A, 0x31, 0x33, 0x31, 0x2D, 
-    0x27, 0x1F, 0x17, 0x0C, 0x02, 0xFE, 0xFA, 0xFA, 0xFA, 0xF8, 0xF7, 0xF9, 
-    0xFC, 0xFA, 0xF7, 0xF2, 0xEB, 0xEA, 0xE8, 0xE9, 0xF1, 0xFC, 0x08, 0x10, 
-    0x16, 0x1A, 0x18, 0x15, 0x0D, 0x07, 0x01, 0xFD, 0xFC, 0xFE, 0xFF, 0xFE, 
-    0x01, 0xFE, 0xFC, 0xF5, 0xEF, 0xE8, 0xE5, 0xE4, 0xE2, 0xE4, 0xE2, 0xE8, 
-    0xEE, 0xF5, 0xFA, 0xFA, 0xFA, 0xF8, 0xFD, 0x03, 0x0B, 0x12, 0x17, 0x1B, 
-    0x19, 0x14, 0x0B, 0xFF, 0xF2, 0xE8, 0xE3, 0xE5, 0xE8, 0xEF, 0xF7, 0xFB, 
-    0xFC, 0xF8, 0xF8, 0xF1, 0xEB, 0xE9, 0xE7, 0xED, 0xF2, 0xF8, 0x02, 0x0D, 
-    0x17, 0x1D, 0x1D, 0x18, 0x10, 0x08, 0x03, 0xFF, 0xFE, 0xFF, 0x04, 0x0A, 
-    0x0B, 0x08, 0x04, 0xFC, 0xF3, 0xEA, 0xE5, 0xE4, 0xE9, 0xF0, 0xF5, 0xF7, 
-    0xF5, 0xF2, 0xEF, 0xEB, 0xE8, 0xED, 0xF4, 0xFE, 0x09, 0x14, 0x1B, 0x20, 
-    0x21, 0x1D, 0x18, 0x0D, 0x00, 0xF5, 0xEC, 0xE8, 0xE6, 0xEA, 0xEE, 0xF0, 
-    0xF0, 0xEA, 0xE5, 0xDE, 0xD9, 0xD3, 0xD1, 0xD3, 0xD9, 0xE2, 0xED, 0xF7, 
-    0xFC, 0x02, 0x04, 0x01, 0x00, 0xFA, 0xF9, 0xF8, 0xF6, 0xF6, 0xF1, 0xF0, 
-    0xEC, 0xEC, 0xEE, 0xEC, 0xE9, 0xE4, 0xE0, 0xE1, 0xE4, 0xE8, 0xE9, 0xEB, 
-    0xEA, 0xE9, 0xE7, 0xE7, 0xEB, 0xEF, 0xF5, 0xFC, 0x06, 0x10, 0x1B, 0x25, 
-    0x28, 0x28, 0x21, 0x18, 0x0C, 0x00, 0xF8, 0xF2, 0xF3, 0xEF, 0xF1, 0xF1, 
-    0xF7, 0xFD, 0x00, 0x04, 0x05, 0x03, 0xFF, 0xFD, 0xFD, 0xFD, 0xFF, 0x06, 
-    0x0A, 0x14, 0x1C, 0x1F, 0x23, 0x20, 0x1C, 0x17, 0x16, 0x15, 0x16, 0x19, 
-    0x1D, 0x20, 0x1F, 0x1C, 0x1A, 0x16, 0x12, 0x0D, 0x04, 0x00, 0xFF, 0x00, 
-    0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0xFD, 0xFF, 0x03, 0x0C, 0x17, 0x22, 
-    0x2C, 0x35, 0x37, 0x32, 0x29, 0x1C, 0x11, 0x06, 0x00, 0xF9, 0xFB, 0xFE, 
-    0x02, 0x08, 0x08, 0x09, 0x04, 0xFD, 0xF6, 0xEF, 0xE7, 0xEA, 0xEB, 0xF5, 
-    0x01, 0x0B, 0x17, 0x1F, 0x24, 0x1F, 0x1A, 0x11, 0x0C, 0x0C, 0x0B, 0x0D, 
-    0x0C, 0x0A, 0x07, 0x01, 0xFD, 0xF9, 0xF2, 0xEB, 0xE8, 0xE8, 0xEC, 0xF2, 
-    0xF9, 0xFD, 0xFF, 0xF9, 0xF2, 0xEB, 0xE3, 0xE3, 0xE7, 0xF1, 0xFB, 0x08, 
-    0x14, 0x1B, 0x23, 0x24, 0x1F, 0x16, 0x0A, 0xFB, 0xF6, 0xF2, 0xF3, 0xF5, 
-    0xF6, 0xF8, 0xF7, 0xF4, 0xF2, 0xED, 0xE8, 0xE3, 0xDF, 0xE3, 0xE7, 0xF0, 
-    0xF7, 0xFE, 0x04, 0x02, 0x06, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-    0xFE, 0x01, 0x01, 0x02, 0x03, 0x00, 0xFC, 0xFA, 0xF5, 0xF5, 0xF8, 0xFA, 
-    0xFD, 0xFC, 0xFC, 0xF8, 0xF5, 0xF0, 0xEC, 0xED, 0xEE, 0xF4, 0x01, 0x0D, 
-    0x1A, 0x22, 0x27, 0x28, 0x25, 0x22, 0x15, 0x0B, 0x04, 0xFC, 0xF5, 0xF4, 
-    0xF0, 0xEF, 0xEC, 0xEC, 0xEC, 0xEB, 0xE9, 0xE3, 0xDF, 0xDE, 0xE0, 0xE3, 
-    0xE8, 0xE9, 0xEE, 0xF4, 0xFA, 0x00, 0x02, 0x03, 0x03, 0x02, 0x03, 0x04, 
-    0x02, 0x01, 0x00, 0xFD, 0xFA, 0xF6, 0xF2, 0xEB, 0xE3, 0xDF, 0xDB, 0xDB, 
-    0xDA, 0xDA, 0xDC, 0xDC, 0xDF, 0xE0, 0xDF, 0xDB, 0xD8, 0xD9, 0xE1, 0xEB, 
-    0xF7, 0x01, 0x0D, 0x18, 0x1B, 0x1C, 0x1A, 0x12, 0x09, 0x02, 0xFB, 0xFA, 
-    0xF8, 0xFB, 0xFE, 0x02, 0x05, 0x02, 0xFF, 0xFB, 0xF9, 0xF7, 0xF9, 0xFA, 
-    0xFC, 0x02, 0x07, 0x0F, 0x16, 0x1C, 0x20, 0x1D, 0x1B, 0x19, 0x1C, 0x1D, 
-    0x1E, 0x1F, 0x1D, 0x1E, 0x1D, 0x1C, 0x1A, 0x15, 0x12, 0x10, 0x0A, 0x06, 
-    0x09, 0x0C, 0x12, 0x15, 0x18, 0x13, 0x0A, 0x02, 0xFB, 0xF8, 0xF5, 0xFD, 
-    0x05, 0x15, 0x21, 0x2C, 0x38, 0x3D, 0x3D, 0x33, 0x27, 0x1D, 0x12, 0x0E, 
-    0x0C, 0x0A, 0x09, 0x04, 0x01, 0xFC, 0xF6, 0xED, 0xE8, 0xE6, 0xE5, 0xE7, 
-    0xEC, 0xF2, 0xF8, 0xFE, 0x03, 0x05, 0x03, 0x00, 0xFE, 0xFC, 0xFA, 0xFE, 
-    0x00, 0x03, 0x03, 0x03, 0x00, 0xFD, 0xFB, 0xF6, 0xF3, 0xEE, 0xEB, 0xEB, 
-    0xF0, 0xF1, 0xF5, 0xF7, 0xF6, 0xF3, 0xED, 0xE7, 0xE3, 0xE2, 0xE1, 0xE6, 
-    0xEC, 0xFB, 0x08, 0x15, 0x1F, 0x22, 0x21, 0x1C, 0x16, 0x0E, 0x09, 0x03, 
-    0x01, 0xFF, 0xFC, 0xFD, 0xFC, 0xFA, 0xF8, 0xF5, 0xF3, 0xED, 0xEE, 0xEF, 
-    0xF3, 0xF9, 0xFB, 0xFC, 0xFB, 0xFC, 0x00, 0x04, 0x04, 0x04, 0x05, 0x0A, 
-    0x0C, 0x12, 0x12, 0x0F, 0x0D, 0x08, 0x02, 0xFB, 0xF4, 0xF0, 0xF2, 0xF0, 
-    0xEF, 0xED, 0xEB, 0xEB, 0xEE, 0xF0, 0xF1, 0xEF, 0xEB, 0xE7, 0xE4, 0xE7, 
-    0xE8, 0xF1, 0xF8, 0xFF, 0x06, 0x10, 0x1A, 0x1E, 0x1C, 0x15, 0x0F, 0x09, 
-    0x05, 0x01, 0xFC, 0xFA, 0xF8, 0xF6, 0xF5, 0xF0, 0xEC, 0xE8, 0xE6, 0xE4, 
-    0xE3, 0xE5, 0xE8, 0xEB, 0xEC, 0xF1, 0xF6, 0xFC, 0xFE, 0x00, 0xFE, 0xFF, 
-    0xFE, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0xFE, 0xFB, 0xF9, 0xF7, 0xF2, 0xEC, 
-    0xE8, 0xE8, 0xE5, 0xE7, 0xEA, 0xEC, 0xF0, 0xEF, 0xEB, 0xE6, 0xE0, 0xDD, 
-    0xDE, 0xE1, 0xE7, 0xF1, 0xFE, 0x0B, 0x18, 0x20, 0x24, 0x21, 0x1A, 0x12, 
-    0x0A, 0x07, 0x05, 0x05, 0x05, 0x03, 0x00, 0xFE, 0xFD, 0xF9, 0xF4, 0xEE, 
-    0xEA, 0xEB, 0xEF, 0xF4, 0xFB, 0x00, 0x06, 0x0B, 0x0C, 0x0A, 0x07, 0x09, 
-    0x0B, 0x0D, 0x0E, 0x0F, 0x13, 0x15, 0x17, 0x17, 0x12, 0x0C, 0x04, 0x00, 
-    0x01, 0x02, 0x08, 0x0C, 0x0D, 0x10, 0x11, 0x11, 0x0F, 0x0B, 0x03, 0xFD, 
-    0xFC, 0xFD, 0x04, 0x0B, 0x13, 0x1C, 0x26, 0x2E, 0x32, 0x2F, 0x29, 0x22, 
-    0x1D, 0x19, 0x14, 0x13, 0x0E, 0x0B, 0x08, 0x07, 0x03, 0xFD, 0xF6, 0xF0, 
-    0xF0, 0xF0, 0xF7, 0xFD, 0x02, 0x05, 0x07, 0x07, 0x08, 0x0A, 0x09, 0x08, 
-    0x07, 0x08, 0x0C, 0x0F, 0x10, 0x0F, 0x0D, 0x09, 0x06, 0x01, 0xF9, 0xF3, 
-    0xF0, 0xF1, 0xF1, 0xEE, 0xEB, 0xEA, 0xE9, 0xEA, 0xE7, 0xE7, 0xE3, 0xDC, 
-    0xD7, 0xD6, 0xDA, 0xDF, 0xE7, 0xEB, 0xF2, 0xFC, 0x05, 0x0D, 0x10, 0x0F, 
-    0x0D, 0x0C, 0x0A, 0x06, 0x04, 0x02, 0x01, 0x01, 0xFE, 0xFB, 0xF5, 0xF1, 
-    0xF3, 0xF5, 0xF6, 0xF6, 0xF4, 0xF6, 0xF8, 0xFD, 0x01, 0x02, 0x01, 0x00, 
-    0x00, 0x02, 0x03, 0x04, 0x07, 0x06, 0x05, 0x03, 0x03, 0x03, 0x02, 0xFD, 
-    0xF9, 0xF6, 0xF4, 0xF4, 0xF7, 0xF8, 0xF9, 0xFB, 0xFB, 0xFD, 0xFC, 0xFA, 
-    0xF7, 0xF5, 0xF3, 0xF2, 0xF6, 0xFE, 0x07, 0x13, 0x1C, 0x20, 0x22, 0x21, 
-    0x1E, 0x18, 0x12, 0x0A, 0x05, 0x00, 0xFD, 0xFB, 0xF8, 0xF4, 0xEF, 0xE7, 
-    0xDE, 0xD9, 0xD8, 0xD9, 0xDA, 0xDE, 0xE2, 0xE8, 0xEB, 0xEF, 0xF1, 0xEE, 
-    0xEC, 0xE9, 0xEB, 0xED, 0xF1, 0xF5, 0xF7, 0xF7, 0xF8, 0xF7, 0xF5, 0xF1, 
-    0xEB, 0xE7, 0xE6, 0xE7, 0xE9, 0xEC, 0xEE, 0xF0, 0xF1, 0xF3, 0xF4, 0xF2, 
-    0xEF, 0xE8, 0xE4, 0xE2, 0xE4, 0xE7, 0xED, 0xF7, 0xFF, 0x09, 0x0D, 0x0F, 
-    0x0F, 0x0F, 0x0F, 0x0E, 0x0C, 0x09, 0x09, 0x08, 0x09, 0x07, 0x04, 0xFC, 
-    0xF5, 0xEF, 0xEE, 0xF1, 0xF4, 0xFB, 0x04, 0x0D, 0x12, 0x12, 0x13, 0x14, 
-    0x14, 0x15, 0x16, 0x1A, 0x21, 0x28, 0x2B, 0x2A, 0x28, 0x25, 0x1F, 0x18, 
-    0x0F, 0x08, 0x04, 0x01, 0xFF, 0xFE, 0xFD, 0xFB, 0xFA, 0xF9, 0xFA, 0xF9, 
-    0xF8, 0xF2, 0xEF, 0xEE, 0xF2, 0xFB, 0x03, 0x0A, 0x0E, 0x15, 0x1C, 0x22, 
-    0x27, 0x27, 0x25, 0x21, 0x1D, 0x1A, 0x17, 0x15, 0x10, 0x0E, 0x0D, 0x0A, 
-    0x07, 0x00, 0xFA, 0xF5, 0xF5, 0xF8, 0xFC, 0x00, 0x02, 0x03, 0x06, 0x07, 
-    0x06, 0x02, 0xFF, 0xFE, 0x02, 0x08, 0x0B, 0x0C, 0x0A, 0x0B, 0x09, 0x07, 
-    0x02, 0xFE, 0xFB, 0xF9, 0xF9, 0xF9, 0xF8, 0xF7, 0xF9, 0xFA, 0xFC, 0xFA, 
-    0xFA, 0xF8, 0xF6, 0xF5, 0xF3, 0xF1, 0xF1, 0xF2, 0xF5, 0xFC, 0x07, 0x11, 
-    0x19, 0x19, 0x18, 0x17, 0x16, 0x13, 0x11, 0x0E, 0x0A, 0x07, 0x02, 0xFC, 
-    0xF7, 0xF3, 0xE9, 0xE4, 0xDD, 0xDD, 0xE1, 0xE4, 0xEA, 0xED, 0xF4, 0xF8, 
-    0xFB, 0xFB, 0xF8, 0xF6, 0xF7, 0xF9, 0xFC, 0xFE, 0x00, 0x04, 0x07, 0x08, 
-    0x04, 0xFB, 0xF3, 0xEC, 0xE9, 0xEB, 0xEF, 0xF4, 0xF7, 0xFA, 0xFB, 0xFB, 
-    0xFD, 0xFB, 0xF9, 0xF6, 0xF4, 0xF5, 0xF8, 0xFC, 0xFF, 0x05, 0x0B, 0x13, 
-    0x17, 0x18, 0x17, 0x14, 0x12, 0x0E, 0x0B, 0x06, 0x05, 0x02, 0x02, 0x01, 
-    0xFE, 0xF7, 0xEE, 0xE8, 0xE4, 0xE1, 0xE4, 0xE7, 0xED, 0xF5, 0xF8, 0xFE, 
-    0xFF, 0xFF, 0xFC, 0xF9, 0xFA, 0xFF, 0x05, 0x0A, 0x0A, 0x0A, 0x0C, 0x0D, 
-    0x0B, 0x04, 0xFB, 0xF3, 0xF0, 0xED, 0xEA, 0xE5, 0xE2, 0xE0, 0xE3, 0xE5, 
-    0xE4, 0xE1, 0xDB, 0xD7, 0xD3, 0xD2, 0xD3, 0xD9, 0xDE, 0xE4, 0xE7, 0xE9, 
-    0xF0, 0xF6, 0xFB, 0x00, 0x03, 0x08, 0x0E, 0x13, 0x14, 0x12, 0x10, 0x0D, 
-    0x0A, 0x05, 0x00, 0xFC, 0xFC, 0xFD, 0xFD, 0xFE, 0xFF, 0x02, 0x04, 0x09, 
-    0x0D, 0x0E, 0x0F, 0x0E, 0x0F, 0x11, 0x13, 0x17, 0x19, 0x1A, 0x1B, 0x1A, 
-    0x18, 0x15, 0x12, 0x0D, 0x06, 0x01, 0xFF, 0x00, 0x04, 0x06, 0x07, 0x06, 
-    0x05, 0x02, 0x02, 0x03, 0x04, 0x06, 0x05, 0x06, 0x0A, 0x0F, 0x15, 0x1D, 
-    0x26, 0x2B, 0x2F, 0x31, 0x31, 0x31, 0x30, 0x2F, 0x2D, 0x29, 0x24, 0x1E, 
-    0x18, 0x12, 0x0A, 0x01, 0xF7, 0xEF, 0xEC, 0xEC, 0xEB, 0xEA, 0xE9, 0xEA, 
-    0xEF, 0xF3, 0xF6, 0xF4, 0xF3, 0xF2, 0xF2, 0xF2, 0xF1, 0xF4, 0xF7, 0xFD, 
-    0x03, 0x08, 0x08, 0x05, 0xFF, 0xFA, 0xF6, 0xF5, 0xF9, 0xFD, 0x01, 0x02, 
-    0x01, 0xFF, 0xFD, 0xFB, 0xF9, 0xF7, 0xF3, 0xF0, 0xED, 0xEB, 0xEB, 0xEE, 
-    0xF3, 0xF6, 0xF8, 0xF9, 0xFC, 0x01, 0x07, 0x0B, 0x0B, 0x0A, 0x09, 0x08, 
-    0x09, 0x09, 0x06, 0x00, 0xF8, 0xEF, 0xEA, 0xEA, 0xEC, 0xF0, 0xF4, 0xF7, 
-    0xFE, 0x05, 0x0C, 0x0F, 0x10, 0x0E, 0x0B, 0x0B, 0x0E, 0x12, 0x17, 0x1B, 
-    0x1F, 0x1F, 0x1D, 0x16, 0x0D, 0x03, 0xF9, 0xF1, 0xEB, 0xE9, 0xE8, 0xE9, 
-    0xEA, 0xEB, 0xEA, 0xE4, 0xDC, 0xD6, 0xD4, 0xD9, 0xE0, 0xE7, 0xEB, 0xEE, 
-    0xF2, 0xF7, 0xFA, 0xFD, 0xFE, 0x00, 0x03, 0x07, 0x0C, 0x11, 0x13, 0x13, 
-    0x11, 0x0B, 0x06, 0xFF, 0xF8, 0xF1, 0xEC, 0xE9, 0xE8, 0xE9, 0xE9, 0xEB, 
-    0xEF, 0xF4, 0xF6, 0xF6, 0xF3, 0xF0, 0xEE, 0xED, 0xEE, 0xF0, 0xF6, 0xFD, 
-    0x06, 0x0E, 0x15, 0x19, 0x1A, 0x18, 0x16, 0x11, 0x0D, 0x08, 0x04, 0x03, 
-    0x02, 0x03, 0x02, 0x00, 0xFD, 0xFB, 0xFA, 0xFB, 0xFC, 0x01, 0x07, 0x0F, 
-    0x16, 0x1C, 0x21, 0x20, 0x1D, 0x17, 0x12, 0x0F, 0x10, 0x14, 0x18, 0x1C, 
-    0x1F, 0x1F, 0x1D, 0x17, 0x10, 0x0B, 0x09, 0x09, 0x09, 0x08, 0x0A, 0x0E, 
-    0x10, 0x0E, 0x09, 0x09, 0x0E, 0x12, 0x0D, 0x02, 0xF8, 0xF6, 0x00, 0x0D, 
-    0x16, 0x16, 0x11, 0x0B, 0x06, 0x00, 0xFB, 0xF6, 0xF7, 0xFE, 0x09, 0x14, 
-    0x18, 0x15, 0x0B, 0x01, 0xF9, 0xF8, 0xFC, 0x02, 0x08, 0x0C, 0x0F, 0x11, 
-    0x10, 0x0D, 0x07, 0x03, 0x03, 0x06, 0x0C, 0x13, 0x18, 0x16, 0x12, 0x0E, 
-    0x09, 0x04, 0x00, 0xFE, 0xFA, 0xF9, 0xF9, 0xFC, 0x00, 0x03, 0x05, 0x04, 
-    0x02, 0xFF, 0xFD, 0xFD, 0xFE, 0xFF, 0x02, 0x06, 0x0B, 0x0E, 0x0E, 0x0F, 
-    0x0F, 0x10, 0x10, 0x0D, 0x0A, 0x08, 0x08, 0x08, 0x07, 0x06, 0x03, 0x01, 
-    0xFF, 0xFD, 0xFE, 0x00, 0xFF, 0xFC, 0xF8, 0xF2, 0xEF, 0xED, 0xEF, 0xF1, 
-    0xF3, 0xF3, 0xF3, 0xF2, 0xEE, 0xE9, 0xE5, 0xE3, 0xE5, 0xEB, 0xF1, 0xF6, 
-    0xF9, 0xFD, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 
-    0x00, 0x01, 0x03, 0x06, 0x09, 0x0A, 0x08, 0x03, 0xFD, 0xF7, 0xF5, 0xF6, 
-    0xF8, 0xFA, 0xFB, 0xFC, 0xFB, 0xF9, 0xF2, 0xE9, 0xE3, 0xE0, 0xE0, 0xE4, 
-    0xEB, 0xF1, 0xF6, 0xF9, 0xFA, 0xF9, 0xF7, 0xF4, 0xF0, 0xEC, 0xEB, 0xEF, 
-    0xF6, 0xFE, 0x04, 0x09, 0x0B, 0x0A, 0x06, 0xFD, 0xF6, 0xF2, 0xF3, 0xF9, 
-    0x00, 0x04, 0x05, 0x03, 0x00, 0xFB, 0xF4, 0xEE, 0xEA, 0xEA, 0xEC, 0xEE, 
-    0xF0, 0xF1, 0xF1, 0xEF, 0xEC, 0xE9, 0xE4, 0xE2, 0xE0, 0xDF, 0xDD, 0xDB, 
-    0xDE, 0xE0, 0xE3, 0xE6, 0xEA, 0xEF, 0xF6, 0xFA, 0xFD, 0x01, 0x06, 0x0C, 
-    0x11, 0x13, 0x11, 0x0D, 0x0A, 0x08, 0x05, 0x02, 0x01, 0x02, 0x06, 0x0B, 
-    0x0F, 0x14, 0x15, 0x15, 0x13, 0x0F, 0x09, 0x02, 0xFD, 0xFB, 0xFB, 0xFC, 
-    0xFF, 0x02, 0x03, 0x04, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x0C, 0x0C, 0x0E, 
-    0x13, 0x18, 0x1A, 0x17, 0x15, 0x13, 0x11, 0x12, 0x16, 0x1B, 0x1F, 0x1C, 
-    0x16, 0x10, 0x10, 0x18, 0x22, 0x29, 0x27, 0x1E, 0x12, 0x09, 0x03, 0xFF, 
-    0xFE, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x05, 0x05, 0x00, 0xFA, 0xF5, 0xF6, 
-    0xFB, 0x01, 0x04, 0x02, 0xFD, 0xF8, 0xF2, 0xED, 0xEA, 0xEA, 0xEE, 0xF5, 
-    0xFD, 0x04, 0x0A, 0x0B, 0x09, 0x06, 0x03, 0x00, 0xFE, 0xFF, 0x00, 0x02, 
-    0x00, 0xFF, 0xFE, 0xFF, 0x02, 0x08, 0x0D, 0x0F, 0x0F, 0x0A, 0x03, 0xFC, 
-    0xF9, 0xF9, 0xFA, 0xF9, 0xF8, 0xF7, 0xF7, 0xF8, 0xF9, 0xF9, 0xF8, 0xF9, 
-    0xF8, 0xF9, 0xFC, 0x02, 0x07, 0x0B, 0x0D, 0x0B, 0x05, 0xFE, 0xFA, 0xF8, 
-    0xF7, 0xF7, 0xFA, 0xFD, 0x00, 0x04, 0x08, 0x0A, 0x08, 0x04, 0x00, 0xFE, 
-    0x01, 0x04, 0x07, 0x09, 0x08, 0x06, 0x07, 0x08, 0x07, 0x04, 0x01, 0x00, 
-    0x02, 0x05, 0x05, 0x04, 0x02, 0x00, 0xFE, 0xFB, 0xF7, 0xF4, 0xF2, 0xF2, 
-    0xF2, 0xF1, 0xEF, 0xED, 0xED, 0xEF, 0xF5, 0xF8, 0xF8, 0xF4, 0xF0, 0xED, 
-    0xEC, 0xEC, 0xEE, 0xEE, 0xEF, 0xEE, 0xED, 0xEB, 0xEA, 0xEA, 0xEB, 0xF0, 
-    0xF5, 0xFB, 0x01, 0x06, 0x07, 0x04, 0xFE, 0xF7, 0xF2, 0xEC, 0xE9, 0xE8, 
-    0xE8, 0xE9, 0xE8, 0xE8, 0xE6, 0xE6, 0xE8, 0xEA, 0xEB, 0xEA, 0xE8, 0xE9, 
-    0xEC, 0xF0, 0xF5, 0xFA, 0xFD, 0xFD, 0xFB, 0xF8, 0xF4, 0xF1, 0xEF, 0xF1, 
-    0xF6, 0xFB, 0xFF, 0xFF, 0xFD, 0xFA, 0xF6, 0xF5, 0xF6, 0xFA, 0x00, 0x07, 
-    0x0E, 0x11, 0x13, 0x13, 0x14, 0x14, 0x16, 0x17, 0x15, 0x0F, 0x07, 0xFE, 
-    0xF9, 0xF8, 0xFB, 0xFF, 0x01, 0x00, 0xFD, 0xFB, 0xFA, 0xFA, 0xFB, 0xFD, 
-    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x03, 0x07, 0x09, 0x0C, 0x0D, 0x0D, 
-    0x0D, 0x0C, 0x0E, 0x0F, 0x13, 0x16, 0x18, 0x1B, 0x1C, 0x1B, 0x14, 0x0E, 
-    0x0D, 0x12, 0x17, 0x18, 0x13, 0x0A, 0x03, 0x02, 0x08, 0x10, 0x17, 0x18, 
-    0x13, 0x08, 0xFA, 0xF0, 0xEC, 0xF2, 0xFE, 0x0A, 0x11, 0x11, 0x0C, 0x05, 
-    0xFD, 0xFA, 0xFA, 0xFE, 0x05, 0x0C, 0x12, 0x17, 0x19, 0x16, 0x10, 0x07, 
-    0xFF, 0xFB, 0xF9, 0xFB, 0x02, 0x0B, 0x14, 0x19, 0x1B, 0x18, 0x10, 0x07, 
-    0x01, 0xFF, 0x01, 0x04, 0x05, 0x06, 0x06, 0x05, 0x03, 0x01, 0xFE, 0xFB, 
-    0xFB, 0xFB, 0xFB, 0xFA, 0xF8, 0xF7, 0xF7, 0xF8, 0xF9, 0xF9, 0xF9, 0xF6, 
-    0xF1, 0xF0, 0xF2, 0xF7, 0xFD, 0x03, 0x06, 0x06, 0x02, 0xFF, 0xFD, 0xFD, 
-    0xFC, 0xFB, 0xFC, 0xFE, 0x00, 0x02, 0x01, 0x02, 0x03, 0x01, 0xFE, 0xF9, 
-    0xF6, 0xF7, 0xF8, 0xF6, 0xF4, 0xF2, 0xF3, 0xF7, 0xFB, 0xFD, 0xFD, 0xFA, 
-    0xF5, 0xF2, 0xF2, 0xF5, 0xFB, 0x00, 0x04, 0x05, 0x04, 0x01, 0xFF, 0xFE, 
-    0xFD, 0xFE, 0x02, 0x08, 0x0D, 0x10, 0x0E, 0x0A, 0x07, 0x05, 0x04, 0x04, 
-    0x03, 0x04, 0x05, 0x05, 0x03, 0xFF, 0xFB, 0xF8, 0xF8, 0xF7, 0xF5, 0xF2, 
-    0xEF, 0xEC, 0xEC, 0xEE, 0xF2, 0xF6, 0xF9, 0xFA, 0xF8, 0xF5, 0xF4, 0xF4, 
-    0xF3, 0xF0, 0xED, 0xEC, 0xEA, 0xE9, 0xE8, 0xE7, 0xE8, 0xE8, 0xE9, 0xEB, 
-    0xEB, 0xEA, 0xE7, 0xE3, 0xE2, 0xE5, 0xEC, 0xF3, 0xF8, 0xFA, 0xFB, 0xF9, 
-    0xF6, 0xF4, 0xF1, 0xF0, 0xF2, 0xF5, 0xF8, 0xF9, 0xF5, 0xEF, 0xEA, 0xE7, 
-    0xE6, 0xE8, 0xED, 0xF5, 0xFC, 0x01, 0x05, 0x07, 0x0A, 0x0C, 0x0C, 0x0A, 
-    0x08, 0x09, 0x0B, 0x0C, 0x09, 0x05, 0x03, 0x01, 0x02, 0x03, 0x06, 0x09, 
-    0x0B, 0x09, 0x07, 0x08, 0x0C, 0x13, 0x19, 0x1B, 0x19, 0x16, 0x14, 0x13, 
-    0x12, 0x12, 0x12, 0x14, 0x15, 0x15, 0x13, 0x10, 0x0F, 0x0E, 0x0F, 0x0E, 
-    0x0F, 0x10, 0x11, 0x13, 0x16, 0x16, 0x16, 0x13, 0x0F, 0x0A, 0x05, 0x00, 
-    0x00, 0x07, 0x12, 0x1C, 0x1F, 0x19, 0x0B, 0xFC, 0xEF, 0xE9, 0xEC, 0xF8, 
-    0x06, 0x11, 0x13, 0x0C, 0x00, 0xF5, 0xF0, 0xF1, 0xFA, 0x07, 0x15, 0x1E, 
-    0x1D, 0x15, 0x09, 0xFE, 0xF6, 0xF2, 0xF2, 0xF6, 0xFC, 0x01, 0x04, 0x01, 
-    0xFA, 0xF5, 0xF3, 0xF5, 0xF8, 0xF9, 0xFC, 0x01, 0x06, 0x09, 0x07, 0x03, 
-    0x01, 0x00, 0x01, 0x02, 0x04, 0x06, 0x07, 0x06, 0x06, 0x06, 0x07, 0x06, 
-    0x05, 0x03, 0x01, 0x02, 0x03, 0x05, 0x06, 0x08, 0x09, 0x0B, 0x09, 0x06, 
-    0x01, 0xFC, 0xFA, 0xFA, 0xFB, 0xFD, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0xFA, 
-    0xF9, 0xF8, 0xF9, 0xF8, 0xF9, 0xF8, 0xF8, 0xF7, 0xF5, 0xF6, 0xF8, 0xFA, 
-    0xFB, 0xFA, 0xF8, 0xF6, 0xF3, 0xF1, 0xF1, 0xF2, 0xF2, 0xF6, 0xF9, 0xFC, 
-    0xFC, 0xFB, 0xFA, 0xF9, 0xFA, 0xFD, 0x03, 0x08, 0x0A, 0x09, 0x03, 0xFC, 
-    0xF7, 0xF4, 0xF5, 0xF6, 0xFA, 0xFE, 0x00, 0xFE, 0xFA, 0xF4, 0xEF, 0xEE, 
-    0xED, 0xED, 0xEE, 0xF0, 0xF3, 0xF4, 0xF3, 0xF0, 0xEF, 0xEF, 0xF2, 0xF8, 
-    0xFD, 0x01, 0x03, 0x02, 0x01, 0xFE, 0xFC, 0xFA, 0xF9, 0xFC, 0xFE, 0xFC, 
-    0xF9, 0xF4, 0xF0, 0xEC, 0xE8, 0xE6, 0xE6, 0xE9, 0xEB, 0xEC, 0xED, 0xF0, 
-    0xF1, 0xF4, 0xF8, 0xFA, 0xFC, 0xFC, 0xFB, 0xFA, 0xF8, 0xF4, 0xF2, 0xF2, 
-    0xF1, 0xEF, 0xEC, 0xEA, 0xEA, 0xEB, 0xEE, 0xF0, 0xF2, 0xF6, 0xFB, 0xFC, 
-    0xFA, 0xF9, 0xFC, 0x02, 0x06, 0x0A, 0x0C, 0x0E, 0x10, 0x0E, 0x09, 0x05, 
-    0x03, 0x01, 0x01, 0x00, 0xFE, 0xFA, 0xF6, 0xF4, 0xF4, 0xF5, 0xF5, 0xF7, 
-    0xFB, 0x00, 0x04, 0x06, 0x05, 0x07, 0x0A, 0x0E, 0x12, 0x14, 0x14, 0x13, 
-    0x12, 0x10, 0x0E, 0x0F, 0x12, 0x14, 0x15, 0x15, 0x16, 0x1A, 0x1D, 0x1F, 
-    0x1C, 0x16, 0x0F, 0x09, 0x09, 0x0F, 0x1A, 0x25, 0x2C, 0x2D, 0x26, 0x18, 
-    0x08, 0xF8, 0xF0, 0xEF, 0xF7, 0x04, 0x12, 0x1C, 0x1C, 0x11, 0x00, 0xF3, 
-    0xEB, 0xEC, 0xF3, 0xFE, 0x0B, 0x17, 0x1C, 0x17, 0x09, 0xFA, 0xEE, 0xEA, 
-    0xF0, 0xF9, 0x04, 0x0B, 0x0C, 0x07, 0xFF, 0xF5, 0xEC, 0xE6, 0xE6, 0xED, 
-    0xF8, 0x04, 0x0A, 0x0A, 0x05, 0xFD, 0xF7, 0xF6, 0xF8, 0xFB, 0xFF, 0x01, 
-    0x01, 0xFE, 0xFA, 0xF4, 0xEE, 0xE9, 0xE8, 0xEC, 0xF6, 0xFF, 0x04, 0x05, 
-    0x04, 0x03, 0x02, 0x00, 0xFF, 0x01, 0x04, 0x07, 0x09, 0x08, 0x04, 0x00, 
-    0xFD, 0xFC, 0xFD, 0xFF, 0xFF, 0xFD, 0xFB, 0xFB, 0xFD, 0xFF, 0xFD, 0xFB, 
-    0xFA, 0xFA, 0xFD, 0xFF, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x03, 0x04, 
-    0x03, 0x03, 0x05, 0x06, 0x05, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 
-    0x02, 0x03, 0x04, 0x04, 0x02, 0xFF, 0xFE, 0x00, 0x02, 0x03, 0x02, 0xFD, 
-    0xF8, 0xF4, 0xF1, 0xF0, 0xEE, 0xEB, 0xE8, 0xE8, 0xE9, 0xEA, 0xE9, 0xE8, 
-    0xE8, 0xEA, 0xEE, 0xF2, 0xF6, 0xF7, 0xF6, 0xF3, 0xF1, 0xEF, 0xEF, 0xEE, 
-    0xED, 0xED, 0xEC, 0xED, 0xEC, 0xEB, 0xEA, 0xE8, 0xE6, 0xE6, 0xE7, 0xE7, 
-    0xE8, 0xE8, 0xEA, 0xEC, 0xED, 0xEE, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF7, 
-    0xF8, 0xF9, 0xFB, 0xFC, 0xFD, 0xFC, 0xFB, 0xFA, 0xFA, 0xFB, 0xFA, 0xFB, 
-    0xFC, 0xFF, 0x02, 0x04, 0x05, 0x03, 0x01, 0x02, 0x07, 0x0E, 0x12, 0x15, 
-    0x14, 0x13, 0x0F, 0x0D, 0x0C, 0x0D, 0x0E, 0x0E, 0x0C, 0x09, 0x06, 0x02, 
-    0xFF, 0xFE, 0x00, 0x03, 0x05, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 
-    0x03, 0x07, 0x09, 0x0A, 0x09, 0x05, 0x01, 0x01, 0x04, 0x0B, 0x12, 0x17, 
-    0x1A, 0x19, 0x17, 0x13, 0x0F, 0x09, 0x04, 0x00, 0x00, 0x03, 0x09, 0x11, 
-    0x18, 0x1C, 0x1A, 0x13, 0x09, 0x00, 0xFA, 0xFA, 0xFF, 0x07, 0x10, 0x19, 
-    0x1E, 0x1E, 0x17, 0x0A, 0xFD, 0xF3, 0xEF, 0xF3, 0xFE, 0x0C, 0x19, 0x20, 
-    0x1F, 0x16, 0x08, 0xFA, 0xF0, 0xEC, 0xEF, 0xF7, 0x01, 0x0B, 0x10, 0x11, 
-    0x0B, 0x01, 0xF6, 0xEE, 0xEE, 0xF5, 0x00, 0x0B, 0x14, 0x18, 0x18, 0x14, 
-    0x0D, 0x05, 0xFF, 0xFC, 0xFC, 0xFE, 0x00, 0x03, 0x06, 0x09, 0x08, 0x05, 
-    0xFF, 0xF9, 0xF5, 0xF4, 0xF5, 0xF7, 0xFA, 0xFE, 0x01, 0x00, 0xFB, 0xF6, 
-    0xF1, 0xEF, 0xEF, 0xF0, 0xF1, 0xF5, 0xF9, 0xFD, 0xFF, 0xFD, 0xF8, 0xF4, 
-    0xF1, 0xEF, 0xF0, 0xF4, 0xF9, 0xFC, 0xFC, 0xF9, 0xF8, 0xF9, 0xFB, 0xFC, 
-    0xFC, 0xFB, 0xFC, 0xFE, 0x02, 0x04, 0x05, 0x05, 0x04, 0x03, 0x02, 0x01, 
-    0x02, 0x05, 0x07, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x06, 0x05, 
-    0x04, 0x05, 0x05, 0x04, 0x02, 0x00, 0xFE, 0xFB, 0xF8, 0xF6, 0xF6, 0xF7, 
-    0xF8, 0xFA, 0xF8, 0xF6, 0xF5, 0xF7, 0xFA, 0xFD, 0xFF, 0x01, 0x02, 0x01, 
-    0x01, 0x00, 0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xFB, 0xFB, 0xF9, 0xF4, 0xEF, 
-    0xE9, 0xE3, 0xDF, 0xDE, 0xDF, 0xE1, 0xE1, 0xE0, 0xDF, 0xDF, 0xE0, 0xE1, 
-    0xE4, 0xE9, 0xED, 0xEF, 0xEF, 0xED, 0xEA, 0xE7, 0xE6, 0xE7, 0xE8, 0xEA, 
-    0xEC, 0xEF, 0xF2, 0xF5, 0xF6, 0xF8, 0xFA, 0xFD, 0x00, 0x03, 0x06, 0x08, 
-    0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0C, 0x0B, 0x09, 0x07, 0x08, 0x09, 0x0C, 
-    0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x04, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0B, 
-    0x0C, 0x0B, 0x0B, 0x0A, 0x0A, 0x09, 0x0A, 0x0D, 0x10, 0x12, 0x13, 0x15, 
-    0x18, 0x1B, 0x1E, 0x1E, 0x1D, 0x1C, 0x1E, 0x21, 0x1F, 0x1A, 0x13, 0x0D, 
-    0x0B, 0x0A, 0x0C, 0x0F, 0x12, 0x17, 0x19, 0x14, 0x0B, 0xFE, 0xF3, 0xEC, 
-    0xEB, 0xEF, 0xF7, 0x00, 0x09, 0x0E, 0x0D, 0x09, 0x01, 0xFA, 0xF4, 0xF3, 
-    0xF7, 0xFD, 0x06, 0x0C, 0x0E, 0x0E, 0x0B, 0x03, 0xFA, 0xF0, 0xEA, 0xEA, 
-    0xEE, 0xF7, 0xFF, 0x06, 0x09, 0x09, 0x05, 0xFE, 0xF7, 0xF2, 0xF2, 0xF6, 
-    0xFD, 0x04, 0x09, 0x0D, 0x0F, 0x10, 0x0C, 0x05, 0xFE, 0xFA, 0xFA, 0xFD, 
-    0x01, 0x04, 0x06, 0x07, 0x08, 0x07, 0x06, 0x05, 0x02, 0xFE, 0xFB, 0xFB, 
-    0xFF, 0x05, 0x0A, 0x0D, 0x0D, 0x09, 0x05, 0x01, 0xFE, 0xFB, 0xF9, 0xF9, 
-    0xFB, 0xFE, 0x00, 0x00, 0xFE, 0xFC, 0xF9, 0xF7, 0xF5, 0xF5, 0xF6, 0xF8, 
-    0xFB, 0xFB, 0xFC, 0xFB, 0xFA, 0xF9, 0xF8, 0xF7, 0xF6, 0xF5, 0xF4, 0xF3, 
-    0xF2, 0xF4, 0xF9, 0xFD, 0x00, 0xFE, 0xFC, 0xFC, 0xFB, 0xFB, 0xFA, 0xF8, 
-    0xF8, 0xF7, 0xF6, 0xF6, 0xF6, 0xF8, 0xFC, 0xFD, 0xFD, 0xFC, 0xFC, 0xFE, 
-    0x00, 0xFF, 0xFE, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0xFA, 0xF8, 0xF8, 0xF9, 
-    0xF8, 0xF9, 0xFA, 0xFD, 0xFE, 0xFD, 0xFA, 0xF9, 0xFA, 0xF9, 0xFA, 0xFB, 
-    0xFA, 0xFA, 0xF9, 0xF9, 0xF8, 0xF7, 0xF7, 0xF5, 0xF2, 0xEE, 0xED, 0xEE, 
-    0xF0, 0xF1, 0xF1, 0xF3, 0xF6, 0xF8, 0xF8, 0xF5, 0xF3, 0xF1, 0xF0, 0xEF, 
-    0xEE, 0xED, 0xED, 0xEF, 0xF1, 0xF3, 0xF4, 0xF3, 0xF2, 0xF2, 0xF1, 0xF0, 
-    0xF0, 0xF3, 0xF7, 0xF9, 0xF9, 0xFA, 0xFB, 0xFA, 0xF9, 0xF7, 0xF7, 0xFA, 
-    0xFD, 0x00, 0x01, 0x02, 0x03, 0x01, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 
-    0xFF, 0x00, 0x03, 0x07, 0x0C, 0x12, 0x14, 0x12, 0x10, 0x0D, 0x0A, 0x09, 
-    0x0A, 0x0C, 0x0E, 0x0F, 0x10, 0x10, 0x13, 0x14, 0x14, 0x13, 0x16, 0x1B, 
-    0x20, 0x1F, 0x1A, 0x12, 0x0D, 0x0D, 0x0F, 0x12, 0x15, 0x19, 0x1D, 0x1E, 
-    0x1A, 0x13, 0x0A, 0x03, 0x00, 0x01, 0x04, 0x09, 0x0F, 0x14, 0x19, 0x1A, 
-    0x17, 0x10, 0x09, 0x03, 0xFF, 0xFE, 0xFE, 0x02, 0x08, 0x0F, 0x15, 0x16, 
-    0x14, 0x0E, 0x07, 0xFF, 0xF9, 0xF5, 0xF7, 0xFA, 0xFD, 0x02, 0x04, 0x03, 
-    0xFE, 0xF6, 0xED, 0xE8, 0xE8, 0xEB, 0xEE, 0xF2, 0xF5, 0xF8, 0xFA, 0xFA, 
-    0xF9, 0xF6, 0xF4, 0xF2, 0xF1, 0xF2, 0xF4, 0xF7, 0xFB, 0xFD, 0xFF, 0x02, 
-    0x04, 0x06, 0x08, 0x09, 0x09, 0x08, 0x07, 0x06, 0x07, 0x08, 0x06, 0x02, 
-    0xFE, 0xFA, 0xF9, 0xFA, 0xFA, 0xF9, 0xF7, 0xF6, 0xF5, 0xF5, 0xF3, 0xF2, 
-    0xF3, 0xF5, 0xF7, 0xFA, 0xFC, 0xFC, 0xFB, 0xFA, 0xFB, 0xFB, 0xFA, 0xF9, 
-    0xFC, 0xFF, 0x03, 0x06, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0A, 
-    0x09, 0x08, 0x07, 0x08, 0x09, 0x09, 0x08, 0x07, 0x06, 0x03, 0x01, 0xFE, 
-    0xFA, 0xF6, 0xF4, 0xF2, 0xF3, 0xF4, 0xF4, 0xF5, 0xF4, 0xF3, 0xF0, 0xEE, 
-    0xEC, 0xEA, 0xEB, 0xEC, 0xEE, 0xF1, 0xF3, 0xF4, 0xF4, 0xF3, 0xF2, 0xF1, 
-    0xF0, 0xF0, 0xF2, 0xF6, 0xFA, 0xFE, 0x00, 0x00, 0xFE, 0xFC, 0xFA, 0xF8, 
-    0xF6, 0xF4, 0xF2, 0xF3, 0xF4, 0xF3, 0xF2, 0xF0, 0xF0, 0xF1, 0xF1, 0xEF, 
-    0xEE, 0xED, 0xF0, 0xF2, 0xF2, 0xF3, 0xF4, 0xF4, 0xF1, 0xEE, 0xEC, 0xEC, 
-    0xED, 0xEE, 0xF0, 0xF2, 0xF3, 0xF8, 0xFB, 0xFC, 0xFB, 0xF8, 0xF7, 0xF9, 
-    0xFD, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x04, 0x05, 
-    0x06, 0x0A, 0x0F, 0x14, 0x16, 0x15, 0x13, 0x10, 0x0E, 0x0D, 0x0E, 0x0E, 
-    0x0D, 0x0B, 0x0B, 0x0D, 0x0E, 0x0C, 0x09, 0x04, 0x02, 0x01, 0x03, 0x04, 
-    0x05, 0x08, 0x0C, 0x0F, 0x10, 0x0F, 0x0E, 0x0B, 0x06, 0x03, 0x01, 0x02, 
-    0x06, 0x0D, 0x14, 0x18, 0x18, 0x15, 0x10, 0x09, 0x03, 0x00, 0x01, 0x07, 
-    0x0E, 0x14, 0x18, 0x19, 0x17, 0x11, 0x0B, 0x04, 0x02, 0x02, 0x04, 0x07, 
-    0x0A, 0x0D, 0x0F, 0x11, 0x11, 0x0F, 0x0D, 0x0A, 0x07, 0x05, 0x04, 0x02, 
-    0x00, 0xFF, 0xFF, 0x00, 0xFE, 0xFD, 0xFE, 0x01, 0x03, 0x03, 0xFF, 0xFC, 
-    0xFD, 0xFE, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x05, 0x06, 0x05, 0x04, 0x02, 
-    0x01, 0xFF, 0xFD, 0xFB, 0xFA, 0xF8, 0xF7, 0xF9, 0xFB, 0xFE, 0xFE, 0xFC, 
-    0xF8, 0xF5, 0xF4, 0xF3, 0xF2, 0xF2, 0xF0, 0xF0, 0xF1, 0xF2, 0xF1, 0xF2, 
-    0xF0, 0xEE, 0xEB, 0xE8, 0xE9, 0xEC, 0xF2, 0xF6, 0xF9, 0xFA, 0xFA, 0xFB, 
-    0xFB, 0xFC, 0xFD, 0xFD, 0xFE, 0xFF, 0x02, 0x07, 0x0A, 0x0A, 0x09, 0x07, 
-    0x05, 0x05, 0x04, 0x07, 0x0A, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0B, 0x09, 
-    0x05, 0x00, 0xFD, 0xFB, 0xFB, 0xFA, 0xFB, 0xF9, 0xF8, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF3, 0xF3, 0xF4, 0xF5, 0xF7, 0xF9, 0xF9, 0xF8, 0xF9, 
-    0xFA, 0xF9, 0xF8, 0xF8, 0xFB, 0x00, 0x04, 0x05, 0x07, 0x06, 0x03, 0xFF, 
-    0xF9, 0xF5, 0xF2, 0xF1, 0xEF, 0xEF, 0xED, 0xEC, 0xEC, 0xEF, 0xEF, 0xED, 
-    0xEB, 0xE6, 0xE5, 0xE3, 0xE5, 0xE6, 0xE9, 0xEB, 0xEB, 0xED, 0xEF, 0xF3, 
-    0xF2, 0xF2, 0xF0, 0xEF, 0xF1, 0xF3, 0xF4, 0xF3, 0xF2, 0xEF, 0xEF, 0xEF, 
-    0xF5, 0xF8, 0xF6, 0xF6, 0xF4, 0xF5, 0xF8, 0xF8, 0xFD, 0xFE, 0x06, 0x0A, 
-    0x08, 0x04, 0xF9, 0xF0, 0xED, 0xF1, 0xF6, 0xFD, 0xFE, 0x01, 0x03, 0x09, 
-    0x0D, 0x0D, 0x0D, 0x08, 0x08, 0x0A, 0x0B, 0x10, 0x0E, 0x0D, 0x10, 0x13, 
-    0x1C, 0x25, 0x22, 0x25, 0x1F, 0x21, 0x22, 0x21, 0x26, 0x20, 0x24, 0x22, 
-    0x1F, 0x1F, 0x1C, 0x1B, 0x14, 0x10, 0x0F, 0x09, 0x17, 0x14, 0x16, 0x0F, 
-    0x02, 0xFE, 0xF7, 0xF7, 0xF3, 0xF1, 0xEF, 0xEF, 0xEE, 0xF9, 0xFF, 0x01, 
-    0x06, 0x05, 0xFA, 0xFA, 0xF7, 0xF1, 0xF1, 0xF3, 0xF8, 0xFC, 0x00, 0x09, 
-    0x0D, 0x0C, 0x12, 0x0B, 0x0B, 0x01, 0x05, 0x02, 0x03, 0x0B, 0x06, 0x0C, 
-    0x0B, 0x12, 0x0F, 0x0D, 0x11, 0x13, 0x19, 0x1F, 0x1F, 0x15, 0x0D, 0x08, 
-    0x01, 0x02, 0x02, 0x01, 0xFE, 0xF9, 0xF8, 0xFE, 0x00, 0x04, 0x06, 0xFC, 
-    0xFC, 0xF1, 0xEF, 0xEA, 0xE3, 0xE4, 0xE4, 0xEF, 0xF5, 0xFB, 0xFC, 0x03, 
-    0xFF, 0xF9, 0xF8, 0xEA, 0xE7, 0xE0, 0xE1, 0xE7, 0xEC, 0xF3, 0xF8, 0xFA, 
-    0xFE, 0xFB, 0x02, 0x0E, 0x0E, 0x10, 0x05, 0xFC, 0xF4, 0xF1, 0xF0, 0xF6, 
-    0xF8, 0xF9, 0xFE, 0xFC, 0x00, 0x04, 0x0D, 0x10, 0x11, 0x13, 0x0B, 0x07, 
-    0x0A, 0x02, 0xFD, 0xF5, 0xF1, 0xF8, 0xFE, 0x06, 0x0A, 0x0B, 0x08, 0x04, 
-    0xFE, 0xFC, 0xF4, 0xF2, 0xED, 0xEB, 0xEA, 0xEB, 0xF3, 0xF5, 0xFB, 0xFA, 
-    0xFE, 0x03, 0x0C, 0x0B, 0x07, 0xF8, 0xE9, 0xE7, 0xE6, 0xEF, 0xF1, 0xF7, 
-    0xF5, 0xF5, 0xF3, 0xF7, 0xFA, 0xFB, 0xFC, 0xFB, 0xF5, 0xF4, 0xF7, 0xF2, 
-    0xF6, 0xF4, 0xF1, 0xF9, 0xFE, 0x01, 0x03, 0x00, 0x00, 0xFF, 0xFE, 0xFC, 
-    0xF9, 0xF9, 0xFA, 0xF8, 0xF5, 0xF7, 0xFA, 0xFD, 0xFD, 0xFB, 0x04, 0x06, 
-    0x0C, 0x07, 0xFC, 0xEE, 0xE0, 0xD7, 0xD0, 0xD6, 0xD7, 0xDF, 0xE1, 0xE5, 
-    0xE8, 0xE8, 0xF1, 0xF1, 0xF2, 0xED, 0xE4, 0xDA, 0xD9, 0xD9, 0xDE, 0xE5, 
-    0xEC, 0xF3, 0xFC, 0x05, 0x05, 0x08, 0x04, 0x08, 0x08, 0x09, 0x0A, 0x06, 
-    0x0D, 0x0B, 0x15, 0x18, 0x1C, 0x1C, 0x21, 0x28, 0x2F, 0x3D, 0x40, 0x44, 
-    0x3B, 0x2E, 0x20, 0x1E, 0x1A, 0x19, 0x15, 0x11, 0x11, 0x0D, 0x19, 0x1F, 
-    0x24, 0x25, 0x1D, 0x13, 0x09, 0xFC, 0xF5, 0xEF, 0xEF, 0xF6, 0xF7, 0x01, 
-    0x07, 0x0C, 0x10, 0x0E, 0x08, 0x04, 0xFD, 0xF9, 0xF8, 0xF7, 0xF7, 0xF7, 
-    0xFD, 0x00, 0x05, 0x0B, 0x0D, 0x11, 0x13, 0x15, 0x13, 0x10, 0x05, 0xFC, 
-    0xF8, 0xF2, 0xF5, 0xF5, 0xF4, 0xF1, 0xF5, 0xF8, 0x04, 0x0F, 0x15, 0x1D, 
-    0x19, 0x10, 0x06, 0xFE, 0xF4, 0xF7, 0xF6, 0xFA, 0x01, 0x08, 0x14, 0x1A, 
-    0x1D, 0x17, 0x12, 0x0D, 0x02, 0xFF, 0xF9, 0xF0, 0xE6, 0xE6, 0xE7, 0xEB, 
-    0xFA, 0xFA, 0x04, 0x06, 0x06, 0x08, 0x02, 0xFC, 0xF2, 0xE6, 0xE1, 0xD9, 
-    0xDC, 0xDF, 0xE2, 0xE3, 0xE9, 0xEB, 0xF2, 0x00, 0xFE, 0x0B, 0x04, 0x00, 
-    0xFD, 0xF4, 0xF0, 0xF0, 0xF1, 0xFA, 0xFF, 0x0A, 0x12, 0x12, 0x1F, 0x1B, 
-    0x1E, 0x1C, 0x17, 0x12, 0x0D, 0x08, 0x00, 0xF9, 0xF9, 0xFD, 0x05, 0x0A, 
-    0x10, 0x12, 0x10, 0x17, 0x11, 0x08, 0xF9, 0xE8, 0xE3, 0xE0, 0xE0, 0xE4, 
-    0xE7, 0xE7, 0xE9, 0xF0, 0xF9, 0xFF, 0x02, 0x04, 0xFA, 0xED, 0xE3, 0xDF, 
-    0xDF, 0xE0, 0xDF, 0xE4, 0xE8, 0xF0, 0xF7, 0xF8, 0xFA, 0xF3, 0xF4, 0xEF, 
-    0xEE, 0xEF, 0xEC, 0xEF, 0xEB, 0xE8, 0xEA, 0xED, 0xF4, 0xFB, 0x07, 0x10, 
-    0x18, 0x24, 0x1F, 0x19, 0x0B, 0xFC, 0xF7, 0xEF, 0xF2, 0xF0, 0xF5, 0xF6, 
-    0xFF, 0x04, 0x0B, 0x0F, 0x06, 0x0B, 0xFD, 0xF2, 0xE3, 0xD7, 0xCF, 0xCC, 
-    0xCD, 0xD6, 0xE2, 0xEF, 0xFC, 0xFC, 0xFB, 0xF4, 0xEF, 0xE8, 0xE8, 0xE0, 
-    0xE0, 0xDF, 0xDC, 0xD9, 0xDB, 0xE5, 0xEC, 0xF6, 0xF8, 0xFE, 0xFF, 0x0A, 
-    0x0E, 0x0E, 0x05, 0xF7, 0xF4, 0xF2, 0xF6, 0xF7, 0xFA, 0xFE, 0x07, 0x16, 
-    0x21, 0x2F, 0x36, 0x38, 0x31, 0x29, 0x1B, 0x0D, 0x07, 0xFD, 0x02, 0x0A, 
-    0x11, 0x1D, 0x28, 0x2A, 0x2D, 0x26, 0x23, 0x1C, 0x14, 0x0C, 0x02, 0x00, 
-    0xFD, 0x04, 0x09, 0x12, 0x16, 0x19, 0x1E, 0x26, 0x25, 0x25, 0x1C, 0x0F, 
-    0x06, 0xF9, 0xFA, 0xF8, 0xFC, 0xFF, 0xFE, 0xFC, 0xFF, 0x01, 0x08, 0x12, 
-    0x0E, 0x12, 0x0D, 0x04, 0xFE, 0xF7, 0xF1, 0xEE, 0xF0, 0xF3, 0xFA, 0x02, 
-    0x0C, 0x14, 0x1C, 0x20, 0x1D, 0x13, 0x07, 0xFF, 0xF8, 0xF5, 0xEE, 0xF1, 
-    0xF8, 0x04, 0x12, 0x17, 0x1D, 0x1D, 0x1B, 0x1A, 0x0E, 0x00, 0xF2, 0xE4, 
-    0xDD, 0xDC, 0xDF, 0xE4, 0xEB, 0xF6, 0x01, 0x07, 0x07, 0x07, 0xFD, 0xF4, 
-    0xED, 0xE4, 0xE1, 0xD9, 0xD4, 0xD1, 0xD2, 0xD6, 0xDB, 0xE4, 0xEB, 0xF3, 
-    0xF9, 0xFB, 0x00, 0xFF, 0xFF, 0xFC, 0xF6, 0xF4, 0xEE, 0xEF, 0xF3, 0xFF, 
-    0x09, 0x16, 0x1E, 0x2A, 0x31, 0x31, 0x31, 0x23, 0x13, 0x05, 0xF8, 0xF1, 
-    0xF3, 0xF7, 0xFF, 0x07, 0x0E, 0x12, 0x12, 0x12, 0x0D, 0x04, 0xFB, 0xF4, 
-    0xEB, 0xEA, 0xE8, 0xEB, 0xF4, 0xF9, 0x02, 0x05, 0x07, 0x07, 0x06, 0x05, 
-    0x00, 0xF7, 0xF1, 0xEF, 0xEA, 0xEB, 0xED, 0xED, 0xEF, 0xF0, 0xF2, 0xF6, 
-    0xF9, 0xFD, 0x02, 0x07, 0x08, 0xFD, 0xF0, 0xE6, 0xDC, 0xDD, 0xDF, 0xE1, 
-    0xEA, 0xF0, 0xFE, 0x09, 0x0F, 0x12, 0x11, 0x0C, 0xFE, 0xF1, 0xE5, 0xE0, 
-    0xE1, 0xE6, 0xEF, 0xF6, 0x02, 0x0A, 0x13, 0x12, 0x10, 0x0A, 0x00, 0xF8, 
-    0xED, 0xEB, 0xE5, 0xE6, 0xE5, 0xE3, 0xE6, 0xED, 0xF5, 0xFB, 0xFB, 0xFB, 
-    0xF7, 0xF6, 0xF2, 0xE9, 0xE3, 0xDC, 0xDA, 0xD7, 0xD5, 0xD6, 0xD7, 0xDE, 
-    0xE9, 0xF2, 0xFD, 0x03, 0x04, 0x07, 0x02, 0xFD, 0xF9, 0xF4, 0xF3, 0xF1, 
-    0xF5, 0xFF, 0x09, 0x17, 0x23, 0x28, 0x2A, 0x27, 0x22, 0x1A, 0x12, 0x0D, 
-    0x06, 0x06, 0x0A, 0x0C, 0x16, 0x1C, 0x20, 0x24, 0x25, 0x23, 0x1D, 0x1A, 
-    0x13, 0x0E, 0x08, 0x02, 0x01, 0x02, 0x07, 0x10, 0x15, 0x19, 0x1E, 0x1F, 
-    0x1C, 0x1C, 0x19, 0x15, 0x12, 0x0A, 0x01, 0xFB, 0xF8, 0xF9, 0xFC, 0xFC, 
-    0x02, 0x08, 0x12, 0x19, 0x1A, 0x19, 0x16, 0x10, 0x0C, 0x07, 0xFF, 0xFD, 
-    0xFA, 0xFA, 0x02, 0x0C, 0x12, 0x1B, 0x22, 0x29, 0x2C, 0x2B, 0x25, 0x14, 
-    0x06, 0xFD, 0xFA, 0x02, 0x09, 0x0F, 0x17, 0x18, 0x1E, 0x1A, 0x16, 0x12, 
-    0x09, 0x04, 0xFE, 0xF6, 0xF0, 0xEC, 0xE9, 0xEB, 0xF0, 0xF1, 0xF4, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF0, 0xEA, 0xE3, 0xDD, 0xDF, 0xE0, 0xE0, 0xDB, 0xD7, 
-    0xD4, 0xD5, 0xDD, 0xE7, 0xF3, 0xFE, 0x07, 0x08, 0x04, 0xFA, 0xF2, 0xEB, 
-    0xE7, 0xE8, 0xE9, 0xF4, 0xFE, 0x07, 0x14, 0x19, 0x1E, 0x19, 0x14, 0x08, 
-    0xFB, 0xF4, 0xED, 0xEF, 0xF2, 0xF9, 0x00, 0x09, 0x10, 0x13, 0x17, 0x12, 
-    0x0E, 0x05, 0xFF, 0xFA, 0xF8, 0xFC, 0xFD, 0xFE, 0xFA, 0xF5, 0xF4, 0xF8, 
-    0xFD, 0x03, 0x05, 0x0A, 0x0C, 0x11, 0x12, 0x09, 0x00, 0xF9, 0xF4, 0xF1, 
-    0xEF, 0xED, 0xF0, 0xF8, 0x01, 0x09, 0x0B, 0x0B, 0x08, 0x04, 0xFB, 0xF1, 
-    0xEA, 0xE4, 0xE4, 0xE6, 0xEC, 0xF4, 0xFF, 0x09, 0x0D, 0x0D, 0x07, 0x00, 
-    0xFA, 0xF2, 0xEF, 0xEE, 0xF0, 0xF3, 0xF8, 0xFD, 0x01, 0x08, 0x0A, 0x0B, 
-    0x0B, 0x09, 0x05, 0x02, 0xFC, 0xF5, 0xEF, 0xE7, 0xE5, 0xE5, 0xE7, 0xEB, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xED, 0xED, 0xE7, 0xE2, 0xDD, 0xD1, 0xCC, 0xC7, 
-    0xC7, 0xCA, 0xCE, 0xD5, 0xDD, 0xE9, 0xF5, 0xFB, 0x01, 0x01, 0x02, 0xFD, 
-    0xFA, 0xF5, 0xF4, 0xF5, 0xF5, 0xFD, 0x03, 0x13, 0x20, 0x2B, 0x32, 0x34, 
-    0x32, 0x2A, 0x1D, 0x10, 0x0A, 0x0B, 0x13, 0x17, 0x1C, 0x20, 0x24, 0x24, 
-    0x24, 0x23, 0x1E, 0x1A, 0x1A, 0x13, 0x0F, 0x0B, 0x09, 0x09, 0x09, 0x0C, 
-    0x0C, 0x0E, 0x13, 0x16, 0x1A, 0x19, 0x17, 0x15, 0x11, 0x12, 0x11, 0x10, 
-    0x07, 0x02, 0xFC, 0xFA, 0x00, 0x05, 0x10, 0x1A, 0x1C, 0x1C, 0x1A, 0x10, 
-    0x06, 0xF9, 0xEE, 0xED, 0xF0, 0xF5, 0xFF, 0x07, 0x0E, 0x14, 0x1A, 0x19, 
-    0x14, 0x0E, 0x04, 0xFC, 0xF6, 0xF5, 0xF1, 0xF3, 0xFA, 0x03, 0x0E, 0x15, 
-    0x18, 0x19, 0x17, 0x11, 0x0E, 0x06, 0x04, 0x01, 0xFB, 0xF5, 0xEF, 0xEA, 
-    0xEA, 0xEA, 0xE9, 0xF2, 0xF9, 0x00, 0x06, 0x06, 0x02, 0xFC, 0xF4, 0xEA, 
-    0xE5, 0xDE, 0xDE, 0xDE, 0xE0, 0xE6, 0xEC, 0xF0, 0xF4, 0xF9, 0xFC, 0xFF, 
-    0xFD, 0xFC, 0xF2, 0xEA, 0xE9, 0xE8, 0xF1, 0xFB, 0x06, 0x10, 0x16, 0x1B, 
-    0x1D, 0x18, 0x12, 0x07, 0xFF, 0xFB, 0xF7, 0xF8, 0xFA, 0xFC, 0xFF, 0x02, 
-    0x04, 0x06, 0x08, 0x09, 0x09, 0x0B, 0x07, 0xFF, 0xF8, 0xF0, 0xEE, 0xEF, 
-    0xF2, 0xF1, 0xF2, 0xF3, 0xF8, 0xFE, 0x04, 0x06, 0x06, 0x06, 0xFF, 0xFA, 
-    0xEF, 0xE9, 0xE4, 0xDE, 0xE1, 0xE6, 0xF2, 0xF9, 0x02, 0x07, 0x08, 0x07, 
-    0x05, 0xFC, 0xF3, 0xEC, 0xE8, 0xEA, 0xEB, 0xF0, 0xEF, 0xF7, 0xFD, 0x08, 
-    0x13, 0x15, 0x15, 0x11, 0x0D, 0x06, 0x01, 0xFB, 0xFA, 0xFC, 0xFC, 0x01, 
-    0x03, 0x06, 0x09, 0x09, 0x09, 0x05, 0x03, 0x00, 0xFB, 0xF6, 0xED, 0xE6, 
-    0xE0, 0xDD, 0xDD, 0xDD, 0xE1, 0xE7, 0xEC, 0xF1, 0xF1, 0xF1, 0xEF, 0xEB, 
-    0xE5, 0xE0, 0xDA, 0xD3, 0xD2, 0xD1, 0xD4, 0xD8, 0xDD, 0xE6, 0xEE, 0xF6, 
-    0xFC, 0xFD, 0xF9, 0xF0, 0xEA, 0xE9, 0xEB, 0xEE, 0xF3, 0xFB, 0x05, 0x12, 
-    0x19, 0x1D, 0x1B, 0x17, 0x12, 0x0B, 0x04, 0xFE, 0xFA, 0xF9, 0xFD, 0x02, 
-    0x0A, 0x12, 0x15, 0x19, 0x18, 0x16, 0x14, 0x14, 0x17, 0x16, 0x14, 0x13, 
-    0x12, 0x0F, 0x0B, 0x09, 0x04, 0x04, 0x09, 0x10, 0x1C, 0x27, 0x2D, 0x2E, 
-    0x29, 0x1C, 0x12, 0x07, 0x00, 0xFB, 0xFB, 0xFF, 0x06, 0x13, 0x1C, 0x21, 
-    0x22, 0x1E, 0x16, 0x0D, 0x02, 0xF7, 0xF1, 0xF1, 0xF4, 0xFF, 0x09, 0x13, 
-    0x17, 0x1B, 0x1A, 0x13, 0x10, 0x08, 0x08, 0x06, 0x04, 0x06, 0x08, 0x09, 
-    0x0B, 0x0B, 0x09, 0x06, 0x04, 0x07, 0x08, 0x0D, 0x10, 0x11, 0x0B, 0x03, 
-    0xFA, 0xF6, 0xF4, 0xED, 0xE8, 0xE4, 0xE5, 0xED, 0xF5, 0xFF, 0x04, 0x03, 
-    0xFE, 0xF4, 0xE8, 0xDC, 0xD2, 0xCB, 0xCA, 0xD1, 0xDA, 0xE7, 0xF2, 0xFB, 
-    0xFF, 0xFF, 0xFD, 0xF9, 0xF6, 0xF3, 0xF2, 0xF5, 0xF9, 0xFF, 0x06, 0x0A, 
-    0x10, 0x11, 0x16, 0x18, 0x1B, 0x1A, 0x15, 0x10, 0x08, 0x04, 0x03, 0x04, 
-    0x03, 0x03, 0x00, 0x02, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0C, 0x09, 
-    0x06, 0x02, 0xFC, 0xF5, 0xF0, 0xEB, 0xED, 0xF1, 0xF7, 0xFD, 0x01, 0x04, 
-    0x04, 0x03, 0x01, 0xFF, 0xF6, 0xEC, 0xE2, 0xE0, 0xE5, 0xEC, 0xF3, 0xF8, 
-    0xFF, 0x04, 0x07, 0x06, 0xFE, 0xF5, 0xE7, 0xDB, 0xD9, 0xDB, 0xE3, 0xEC, 
-    0xF4, 0xFB, 0x00, 0x04, 0x05, 0x05, 0x05, 0x02, 0xFF, 0xFC, 0xFC, 0xFA, 
-    0xFB, 0xFA, 0xFA, 0xFD, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0x04, 0x08, 0x0A, 
-    0x0A, 0x07, 0x01, 0xF9, 0xEF, 0xE9, 0xE1, 0xDF, 0xE1, 0xE5, 0xF0, 0xF9, 
-    0x04, 0x0B, 0x09, 0xFE, 0xED, 0xDD, 0xD4, 0xCF, 0xCF, 0xD2, 0xDA, 0xE4, 
-    0xF2, 0xFA, 0x00, 0x02, 0xFF, 0xFB, 0xF3, 0xEE, 0xEB, 0xEC, 0xF3, 0xFA, 
-    0xFE, 0x03, 0x05, 0x08, 0x0C, 0x0C, 0x09, 0x05, 0x03, 0x06, 0x09, 0x0C, 
-    0x0E, 0x0C, 0x0A, 0x0B, 0x0C, 0x0B, 0x0C, 0x0A, 0x0D, 0x15, 0x1D, 0x23, 
-    0x25, 0x22, 0x1A, 0x0F, 0x08, 0x02, 0xFE, 0xFC, 0xFA, 0xFD, 0x07, 0x13, 
-    0x1E, 0x24, 0x22, 0x1C, 0x14, 0x09, 0xFF, 0xF6, 0xF0, 0xF0, 0xF6, 0xFE, 
-    0x06, 0x0E, 0x15, 0x19, 0x1B, 0x16, 0x10, 0x0B, 0x07, 0x06, 0x04, 0x04, 
-    0x07, 0x0A, 0x0E, 0x11, 0x13, 0x15, 0x1B, 0x1D, 0x1F, 0x21, 0x21, 0x20, 
-    0x1B, 0x14, 0x0E, 0x0C, 0x0B, 0x0B, 0x0A, 0x07, 0x0B, 0x12, 0x18, 0x1C, 
-    0x1A, 0x15, 0x0D, 0x08, 0x01, 0xF7, 0xEE, 0xE5, 0xE1, 0xDD, 0xE3, 0xEB, 
-    0xF4, 0xFD, 0x00, 0xFE, 0xFC, 0xF6, 0xEE, 0xE4, 0xDB, 0xD6, 0xD5, 0xDC, 
-    0xE5, 0xED, 0xF2, 0xF4, 0xF7, 0xFB, 0xFD, 0xF9, 0xF3, 0xEA, 0xE3, 0xE4, 
-    0xE8, 0xEE, 0xF5, 0xF9, 0xFD, 0x00, 0x03, 0x06, 0x09, 0x0C, 0x0C, 0x0A, 
-    0x05, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0xF9, 0xFA, 0xFB, 0x00, 0x07, 
-    0x0C, 0x12, 0x12, 0x11, 0x0D, 0x0A, 0x03, 0xFB, 0xF2, 0xED, 0xEE, 0xF4, 
-    0xFB, 0x03, 0x0A, 0x11, 0x16, 0x13, 0x0B, 0xFC, 0xF0, 0xE8, 0xE8, 0xEB, 
-    0xEE, 0xF2, 0xF3, 0xF6, 0xFF, 0x03, 0x06, 0x04, 0xFD, 0xF4, 0xEE, 0xEE, 
-    0xF0, 0xF4, 0xF7, 0xF6, 0xF4, 0xF2, 0xF2, 0xF2, 0xF6, 0xF9, 0xFC, 0xFF, 
-    0x01, 0x05, 0x04, 0x05, 0x02, 0xFD, 0xFB, 0xF7, 0xF7, 0xFA, 0xFC, 0x00, 
-    0x06, 0x0A, 0x0F, 0x0F, 0x0A, 0xFE, 0xF0, 0xE5, 0xDE, 0xD8, 0xD7, 0xDB, 
-    0xE0, 0xEC, 0xF5, 0xFD, 0x02, 0x01, 0xFC, 0xF3, 0xE7, 0xDD, 0xD9, 0xD7, 
-    0xD8, 0xDC, 0xE1, 0xE5, 0xEB, 0xEF, 0xF1, 0xF3, 0xF2, 0xF0, 0xF1, 0xF2, 
-    0xF4, 0xF8, 0xFB, 0xFD, 0xFD, 0xFF, 0x03, 0x05, 0x06, 0x08, 0x0C, 0x15, 
-    0x1E, 0x24, 0x24, 0x1F, 0x18, 0x12, 0x0F, 0x0D, 0x0C, 0x0B, 0x09, 0x0B, 
-    0x11, 0x18, 0x20, 0x23, 0x22, 0x1C, 0x18, 0x12, 0x0D, 0x07, 0x03, 0x02, 
-    0x01, 0x04, 0x08, 0x0C, 0x11, 0x16, 0x17, 0x13, 0x0C, 0x04, 0xFE, 0xFC, 
-    0xFC, 0xFF, 0x00, 0x03, 0x04, 0x06, 0x07, 0x08, 0x0A, 0x09, 0x0A, 0x0C, 
-    0x0A, 0x04, 0x01, 0xFF, 0x00, 0x02, 0x03, 0x05, 0x06, 0x0B, 0x10, 0x15, 
-    0x19, 0x1B, 0x1D, 0x1A, 0x18, 0x13, 0x10, 0x0C, 0x06, 0x02, 0xFE, 0xFF, 
-    0x05, 0x0D, 0x14, 0x1A, 0x1C, 0x19, 0x14, 0x0D, 0x05, 0xFA, 0xF2, 0xEC, 
-    0xEA, 0xED, 0xF2, 0xF8, 0xFE, 0x06, 0x0D, 0x0F, 0x0F, 0x09, 0x02, 0xF8, 
-    0xED, 0xE6, 0xE2, 0xE3, 0xE5, 0xE8, 0xEF, 0xF5, 0xF9, 0xFA, 0xF6, 0xF5, 
-    0xF2, 0xF1, 0xF1, 0xF2, 0xF4, 0xF7, 0xF8, 0xF9, 0xF9, 0xF8, 0xF9, 0xF9, 
-    0x00, 0x03, 0x07, 0x07, 0x04, 0x02, 0xFF, 0xFD, 0xFB, 0xFA, 0xF8, 0xFB, 
-    0x00, 0x02, 0x06, 0x08, 0x0A, 0x0E, 0x10, 0x0E, 0x07, 0xFE, 0xF3, 0xEC, 
-    0xE9, 0xE9, 0xEC, 0xF2, 0xFA, 0x01, 0x05, 0x05, 0x05, 0xFF, 0xFA, 0xF3, 
-    0xEE, 0xEC, 0xEC, 0xEF, 0xEF, 0xF2, 0xF2, 0xF2, 0xF1, 0xF1, 0xF2, 0xF3, 
-    0xF3, 0xF4, 0xF5, 0xF9, 0xFC, 0xFC, 0xFB, 0xF9, 0xF8, 0xF9, 0xF9, 0xF7, 
-    0xFA, 0x01, 0x0B, 0x17, 0x1E, 0x1C, 0x15, 0x0B, 0x00, 0xFA, 0xF8, 0xF5, 
-    0xF4, 0xF6, 0xF8, 0xFF, 0x05, 0x0A, 0x0E, 0x0B, 0x06, 0xFE, 0xF6, 0xF1, 
-    0xEC, 0xEC, 0xEB, 0xEB, 0xEA, 0xEE, 0xF3, 0xF5, 0xF6, 0xF5, 0xF4, 0xEF, 
-    0xE8, 0xE0, 0xDC, 0xDC, 0xDE, 0xDF, 0xE0, 0xE0, 0xE3, 0xE4, 0xE6, 0xEA, 
-    0xED, 0xF0, 0xF4, 0xF6, 0xF4, 0xEF, 0xEB, 0xEA, 0xEC, 0xF0, 0xF3, 0xF7, 
-    0xFE, 0x07, 0x0F, 0x17, 0x1A, 0x19, 0x15, 0x11, 0x0D, 0x0A, 0x09, 0x09, 
-    0x0A, 0x0A, 0x0E, 0x13, 0x19, 0x1E, 0x1F, 0x1D, 0x1B, 0x18, 0x15, 0x12, 
-    0x10, 0x0D, 0x0A, 0x08, 0x08, 0x0B, 0x0E, 0x11, 0x14, 0x16, 0x18, 0x1A, 
-    0x19, 0x14, 0x0C, 0x06, 0xFF, 0xFD, 0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 
-    0x08, 0x0C, 0x0F, 0x0E, 0x0D, 0x0C, 0x0A, 0x0B, 0x0A, 0x08, 0x06, 0x06, 
-    0x07, 0x07, 0x09, 0x0C, 0x0E, 0x10, 0x12, 0x10, 0x0F, 0x10, 0x0E, 0x0A, 
-    0x05, 0x01, 0x01, 0x03, 0x05, 0x07, 0x0B, 0x10, 0x16, 0x1A, 0x18, 0x0E, 
-    0x02, 0xF6, 0xEE, 0xEB, 0xED, 0xF2, 0xF7, 0xFA, 0xFF, 0x01, 0x03, 0x03, 
-    0x00, 0xFB, 0xF5, 0xF0, 0xEB, 0xE9, 0xEA, 0xEA, 0xEA, 0xE8, 0xE8, 0xEB, 
-    0xED, 0xF1, 0xF2, 0xF3, 0xF5, 0xF7, 0xFA, 0xFD, 0xFF, 0x00, 0xFD, 0xF8, 
-    0xF5, 0xF4, 0xF8, 0xFF, 0x06, 0x0E, 0x16, 0x1C, 0x1C, 0x15, 0x0A, 0xFE, 
-    0xF7, 0xF5, 0xF7, 0xFC, 0x00, 0x04, 0x09, 0x0E, 0x11, 0x12, 0x0E, 0x09, 
-    0x03, 0xFE, 0xFA, 0xF7, 0xF5, 0xF4, 0xF5, 0xF7, 0xF9, 0xFC, 0xFE, 0xFF, 
-    0xFD, 0xF9, 0xF4, 0xEF, 0xED, 0xEF, 0xF3, 0xF6, 0xF5, 0xEF, 0xEC, 0xEB, 
-    0xE9, 0xE8, 0xE6, 0xE6, 0xE9, 0xED, 0xF0, 0xF0, 0xEB, 0xE6, 0xE1, 0xDF, 
-    0xE0, 0xE2, 0xE6, 0xE8, 0xEA, 0xED, 0xF1, 0xF4, 0xF7, 0xF7, 0xF7, 0xF7, 
-    0xF3, 0xF0, 0xED, 0xED, 0xF0, 0xF5, 0xFB, 0x01, 0x07, 0x0B, 0x0C, 0x0E, 
-    0x0F, 0x11, 0x13, 0x16, 0x18, 0x1A, 0x19, 0x16, 0x13, 0x0C, 0x06, 0x01, 
-    0x02, 0x04, 0x08, 0x09, 0x04, 0x01, 0xF9, 0xF7, 0xF4, 0xF5, 0xF9, 0xF9, 
-    0xFA, 0xFC, 0xFE, 0x03, 0x09, 0x0E, 0x13, 0x14, 0x13, 0x0F, 0x09, 0x05, 
-    0x04, 0x01, 0x00, 0x02, 0x01, 0x07, 0x0B, 0x10, 0x14, 0x15, 0x14, 0x10, 
-    0x10, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 0x11, 0x13, 0x10, 0x0E, 0x0D, 0x0E, 
-    0x14, 0x15, 0x12, 0x0C, 0x06, 0x03, 0x04, 0x08, 0x0C, 0x0F, 0x10, 0x12, 
-    0x13, 0x16, 0x1B, 0x1E, 0x1B, 0x16, 0x12, 0x11, 0x10, 0x0F, 0x0C, 0x07, 
-    0x07, 0x04, 0x06, 0x08, 0x0A, 0x0E, 0x0F, 0x0F, 0x0C, 0x0A, 0x0A, 0x0B, 
-    0x0B, 0x08, 0x03, 0x00, 0x03, 0x07, 0x0B, 0x13, 0x1A, 0x20, 0x24, 0x23, 
-    0x1F, 0x17, 0x10, 0x0B, 0x0D, 0x13, 0x19, 0x21, 0x24, 0x27, 0x2C, 0x2F, 
-    0x30, 0x2E, 0x2B, 0x28, 0x29, 0x28, 0x24, 0x21, 0x1D, 0x1C, 0x1B, 0x1D, 
-    0x1B, 0x19, 0x15, 0x11, 0x0E, 0x0E, 0x0D, 0x0B, 0x0A, 0x0B, 0x0D, 0x0D, 
-    0x0B, 0x05, 0x00, 0xFE, 0xFF, 0x02, 0x08, 0x0B, 0x0E, 0x11, 0x10, 0x0E, 
-    0x08, 0x04, 0x01, 0x01, 0x02, 0x05, 0x07, 0x0B, 0x0D, 0x0F, 0x0C, 0x08, 
-    0x04, 0xFE, 0xFB, 0xF5, 0xF3, 0xF2, 0xF5, 0xFE, 0x04, 0x08, 0x0A, 0x09, 
-    0x05, 0x00, 0xFA, 0xF5, 0xF4, 0xF1, 0xF0, 0xEF, 0xEF, 0xEF, 0xF2, 0xF1, 
-    0xEF, 0xEC, 0xEA, 0xEB, 0xEE, 0xF2, 0xF4, 0xF5, 0xF1, 0xEC, 0xE7, 0xE5, 
-    0xE4, 0xE5, 0xE5, 0xE7, 0xEA, 0xEC, 0xF0, 0xF4, 0xF7, 0xF7, 0xF8, 0xF8, 
-    0xF5, 0xF2, 0xEC, 0xE8, 0xE9, 0xED, 0xF3, 0xF7, 0xFC, 0x00, 0x03, 0x04, 
-    0x00, 0xFD, 0xF6, 0xF3, 0xF2, 0xF4, 0xF8, 0xFD, 0x01, 0x04, 0x04, 0x01, 
-    0x01, 0x02, 0x03, 0x02, 0x00, 0xFD, 0xFB, 0xF8, 0xF7, 0xF3, 0xF3, 0xF3, 
-    0xF5, 0xF7, 0xF7, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF3, 0xF0, 0xED, 
-    0xE9, 0xE3, 0xDE, 0xDC, 0xDE, 0xE2, 0xE8, 0xEA, 0xEC, 0xED, 0xED, 0xED, 
-    0xEE, 0xEE, 0xED, 0xED, 0xEC, 0xEB, 0xEA, 0xEB, 0xEE, 0xF4, 0xFC, 0x01, 
-    0x04, 0x03, 0x01, 0xFC, 0xF7, 0xF1, 0xED, 0xEB, 0xEB, 0xEC, 0xEF, 0xF4, 
-    0xF8, 0xFA, 0xF7, 0xF4, 0xF2, 0xF3, 0xF7, 0xFB, 0xFB, 0xF6, 0xF2, 0xF0, 
-    0xF4, 0xFA, 0x00, 0x00, 0xFD, 0xFB, 0xFA, 0xFA, 0xF9, 0xFA, 0xFB, 0xFC, 
-    0xF8, 0xF6, 0xF4, 0xF1, 0xF0, 0xEE, 0xED, 0xEB, 0xEC, 0xEE, 0xEF, 0xF1, 
-    0xF0, 0xEE, 0xE8, 0xE3, 0xDE, 0xDC, 0xDD, 0xE0, 0xE4, 0xEB, 0xF2, 0xF8, 
-    0xFE, 0x02, 0x06, 0x08, 0x08, 0x05, 0x00, 0xFC, 0xFC, 0xFE, 0x03, 0x07, 
-    0x08, 0x09, 0x08, 0x08, 0x07, 0x05, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 
-    0x03, 0x01, 0xFF, 0xFB, 0xF7, 0xF6, 0xF8, 0xFB, 0xFC, 0xFA, 0xF7, 0xF2, 
-    0xEC, 0xE6, 0xE2, 0xE0, 0xDF, 0xDE, 0xE1, 0xE5, 0xEB, 0xF2, 0xF9, 0xFC, 
-    0xFE, 0xFE, 0xFD, 0xFD, 0xFB, 0xF8, 0xF4, 0xF2, 0xF4, 0xF8, 0xFE, 0x03, 
-    0x06, 0x08, 0x07, 0x04, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 
-    0xFF, 0xFA, 0xF4, 0xF0, 0xF1, 0xF3, 0xF3, 0xF2, 0xF0, 0xEF, 0xED, 0xEC, 
-    0xEA, 0xE9, 0xE9, 0xEA, 0xED, 0xF2, 0xF6, 0xFC, 0x01, 0x04, 0x06, 0x08, 
-    0x06, 0x02, 0xFD, 0xF8, 0xF6, 0xF3, 0xF3, 0xF3, 0xF6, 0xF8, 0xFB, 0xFB, 
-    0xF8, 0xF2, 0xF0, 0xEE, 0xEC, 0xE8, 0xE4, 0xE1, 0xE1, 0xE3, 0xE7, 0xEA, 
-    0xED, 0xF0, 0xF3, 0xF5, 0xF7, 0xF6, 0xF1, 0xEB, 0xE7, 0xE6, 0xE6, 0xE8, 
-    0xEA, 0xEC, 0xF0, 0xF6, 0xFD, 0x03, 0x08, 0x0C, 0x0F, 0x11, 0x15, 0x19, 
-    0x1D, 0x1F, 0x20, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x21, 0x1F, 0x1A, 0x14, 
-    0x0B, 0x04, 0xFF, 0xFA, 0xF7, 0xF2, 0xEE, 0xEC, 0xED, 0xEC, 0xEC, 0xEC, 
-    0xF0, 0xF7, 0xFD, 0x01, 0x00, 0xFC, 0xF8, 0xF5, 0xF5, 0xF8, 0xFC, 0x02, 
-    0x07, 0x0B, 0x0D, 0x10, 0x12, 0x13, 0x13, 0x12, 0x11, 0x0F, 0x0D, 0x0C, 
-    0x0B, 0x0D, 0x0F, 0x10, 0x12, 0x0F, 0x0C, 0x0A, 0x07, 0x09, 0x0B, 0x0F, 
-    0x13, 0x15, 0x14, 0x11, 0x0D, 0x0A, 0x09, 0x0C, 0x11, 0x16, 0x1A, 0x1C, 
-    0x1C, 0x18, 0x11, 0x0B, 0x07, 0x06, 0x04, 0x00, 0xFC, 0xFC, 0x01, 0x0A, 
-    0x14, 0x1A, 0x1D, 0x1E, 0x1C, 0x17, 0x13, 0x0F, 0x0C, 0x0A, 0x08, 0x0A, 
-    0x0D, 0x13, 0x17, 0x18, 0x17, 0x14, 0x11, 0x10, 0x12, 0x13, 0x15, 0x16, 
-    0x17, 0x18, 0x1A, 0x1C, 0x1D, 0x1C, 0x19, 0x16, 0x17, 0x1B, 0x21, 0x25, 
-    0x24, 0x20, 0x1B, 0x18, 0x17, 0x16, 0x15, 0x16, 0x17, 0x1B, 0x1F, 0x23, 
-    0x24, 0x21, 0x1D, 0x19, 0x14, 0x0F, 0x0A, 0x05, 0x03, 0x02, 0x03, 0x04, 
-    0x06, 0x07, 0x0A, 0x09, 0x09, 0x0B, 0x0E, 0x10, 0x0E, 0x0C, 0x0B, 0x0D, 
-    0x10, 0x13, 0x15, 0x14, 0x12, 0x10, 0x10, 0x11, 0x13, 0x11, 0x0A, 0x01, 
-    0xF9, 0xF2, 0xEE, 0xEB, 0xEA, 0xEA, 0xEB, 0xEF, 0xF3, 0xF7, 0xF9, 0xFB, 
-    0xFC, 0xFE, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x01, 0x03, 
-    0x04, 0x01, 0xFB, 0xF4, 0xEF, 0xEE, 0xEE, 0xEF, 0xEF, 0xEF, 0xEE, 0xEE, 
-    0xED, 0xEA, 0xE7, 0xE7, 0xE9, 0xED, 0xF2, 0xF2, 0xF0, 0xEC, 0xE9, 0xE8, 
-    0xE7, 0xE6, 0xE6, 0xE8, 0xEE, 0xF6, 0xFC, 0xFE, 0xFC, 0xFA, 0xF8, 0xFA, 
-    0xFD, 0xFF, 0x00, 0x00, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0x02, 
-    0x05, 0x06, 0x06, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xFD, 0xFB, 0xFC, 0xFB, 
-    0xF9, 0xF8, 0xF9, 0xFC, 0xFD, 0xFB, 0xF4, 0xED, 0xE7, 0xE2, 0xDD, 0xDA, 
-    0xD8, 0xDB, 0xE1, 0xE9, 0xEF, 0xF3, 0xF5, 0xF5, 0xF4, 0xF2, 0xF1, 0xF2, 
-    0xF3, 0xF4, 0xF5, 0xF6, 0xF8, 0xFC, 0x00, 0x02, 0x02, 0xFF, 0xFC, 0xFB, 
-    0xFA, 0xF9, 0xF9, 0xF6, 0xF4, 0xF3, 0xF4, 0xF3, 0xF0, 0xE9, 0xE1, 0xDA, 
-    0xD9, 0xDC, 0xE3, 0xE9, 0xED, 0xEF, 0xEE, 0xED, 0xEC, 0xEB, 0xEB, 0xED, 
-    0xF4, 0xFC, 0x00, 0xFF, 0xFC, 0xFA, 0xF9, 0xF7, 0xF5, 0xF5, 0xF6, 0xF7, 
-    0xF7, 0xF5, 0xF5, 0xF7, 0xFA, 0xFC, 0xFD, 0xFE, 0xFE, 0xFE, 0xFD, 0xFC, 
-    0xFB, 0xF9, 0xF7, 0xF6, 0xF5, 0xF7, 0xF8, 0xF6, 0xF5, 0xF5, 0xF7, 0xFB, 
-    0xFD, 0xFD, 0xFB, 0xF9, 0xF7, 0xF4, 0xF2, 0xF1, 0xF2, 0xF6, 0xFD, 0x06, 
-    0x0D, 0x10, 0x12, 0x11, 0x10, 0x12, 0x13, 0x13, 0x11, 0x0E, 0x0A, 0x09, 
-    0x08, 0x09, 0x0A, 0x0A, 0x09, 0x05, 0xFF, 0xFA, 0xF5, 0xF3, 0xF2, 0xF0, 
-    0xEF, 0xED, 0xEA, 0xE8, 0xE3, 0xDE, 0xDA, 0xDB, 0xE0, 0xE7, 0xEC, 0xED, 
-    0xEB, 0xE9, 0xE9, 0xEB, 0xED, 0xF1, 0xF5, 0xFB, 0x01, 0x05, 0x04, 0x02, 
-    0xFF, 0xFD, 0xFD, 0x00, 0x04, 0x06, 0x05, 0x00, 0xF9, 0xF4, 0xF3, 0xF2, 
-    0xF3, 0xF1, 0xEE, 0xED, 0xED, 0xEE, 0xF3, 0xF9, 0xFD, 0xFF, 0xFD, 0xFA, 
-    0xF9, 0xFA, 0xF8, 0xF5, 0xF4, 0xF5, 0xF9, 0xFE, 0xFE, 0xF8, 0xEF, 0xE8, 
-    0xE6, 0xE7, 0xEB, 0xF2, 0xF9, 0x01, 0x08, 0x0D, 0x0E, 0x0D, 0x0C, 0x0B, 
-    0x09, 0x09, 0x08, 0x05, 0x02, 0xFC, 0xF7, 0xF3, 0xF3, 0xF4, 0xF4, 0xF2, 
-    0xEE, 0xEC, 0xEA, 0xEB, 0xEC, 0xED, 0xED, 0xEB, 0xEB, 0xE8, 0xE5, 0xE1, 
-    0xDF, 0xE0, 0xE5, 0xEC, 0xF3, 0xF8, 0xFB, 0xFA, 0xFB, 0xFB, 0xFC, 0xFF, 
-    0x03, 0x07, 0x0B, 0x0F, 0x13, 0x15, 0x15, 0x15, 0x16, 0x15, 0x14, 0x13, 
-    0x12, 0x11, 0x0E, 0x08, 0x03, 0xFF, 0xFD, 0xFC, 0xFD, 0xFB, 0xFA, 0xF8, 
-    0xF6, 0xF6, 0xF8, 0xFC, 0x01, 0x03, 0x05, 0x07, 0x09, 0x0A, 0x09, 0x06, 
-    0x03, 0x05, 0x0A, 0x11, 0x12, 0x0D, 0x05, 0x00, 0xFF, 0x01, 0x02, 0x03, 
-    0x04, 0x08, 0x0D, 0x10, 0x11, 0x10, 0x0F, 0x12, 0x18, 0x20, 0x25, 0x26, 
-    0x22, 0x1D, 0x18, 0x17, 0x19, 0x1C, 0x1D, 0x1C, 0x1A, 0x16, 0x13, 0x0F, 
-    0x0D, 0x0C, 0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08, 0x0A, 0x0D, 
-    0x0F, 0x0F, 0x0D, 0x0B, 0x0A, 0x08, 0x05, 0x03, 0x04, 0x07, 0x07, 0x06, 
-    0x05, 0x05, 0x08, 0x0C, 0x11, 0x14, 0x16, 0x17, 0x16, 0x16, 0x13, 0x11, 
-    0x0F, 0x10, 0x14, 0x18, 0x1C, 0x1D, 0x1D, 0x1E, 0x1F, 0x22, 0x26, 0x2A, 
-    0x2C, 0x2C, 0x2B, 0x28, 0x26, 0x23, 0x1E, 0x19, 0x16, 0x16, 0x17, 0x16, 
-    0x12, 0x0C, 0x07, 0x05, 0x04, 0x05, 0x06, 0x09, 0x0B, 0x0E, 0x12, 0x17, 
-    0x19, 0x19, 0x18, 0x18, 0x1B, 0x1C, 0x1E, 0x1D, 0x1C, 0x1A, 0x17, 0x17, 
-    0x16, 0x16, 0x15, 0x14, 0x11, 0x0F, 0x0E, 0x0C, 0x0A, 0x07, 0x03, 0xFE, 
-    0xF7, 0xF1, 0xED, 0xE8, 0xE4, 0xE1, 0xDF, 0xE1, 0xE4, 0xE8, 0xEA, 0xEA, 
-    0xE8, 0xE7, 0xE8, 0xE9, 0xE8, 0xE6, 0xE4, 0xE6, 0xEB, 0xF0, 0xF3, 0xF6, 
-    0xFA, 0xFD, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 0xFD, 0xFE, 0x01, 0x03, 
-    0x01, 0xFD, 0xF9, 0xF8, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFA, 0xF4, 0xEF, 
-    0xEB, 0xE7, 0xE5, 0xE4, 0xE6, 0xEA, 0xEE, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 
-    0xF2, 0xF4, 0xF9, 0xFC, 0xFF, 0x03, 0x06, 0x0B, 0x0F, 0x12, 0x16, 0x18, 
-    0x17, 0x14, 0x0F, 0x0B, 0x09, 0x06, 0x02, 0x00, 0xFF, 0xFD, 0xF9, 0xF5, 
-    0xEF, 0xEA, 0xE8, 0xE9, 0xEB, 0xEC, 0xE9, 0xE3, 0xDE, 0xDA, 0xD8, 0xD6, 
-    0xD6, 0xD7, 0xDA, 0xDF, 0xE3, 0xE5, 0xE3, 0xE2, 0xE1, 0xE2, 0xE5, 0xE7, 
-    0xE9, 0xE8, 0xE7, 0xE7, 0xEA, 0xF0, 0xF5, 0xFA, 0xFE, 0x01, 0x03, 0x03, 
-    0x01, 0xFE, 0xFB, 0xF7, 0xF2, 0xF0, 0xEE, 0xED, 0xED, 0xED, 0xEF, 0xF2, 
-    0xF7, 0xFC, 0xFF, 0x00, 0x00, 0xFC, 0xF6, 0xF1, 0xEC, 0xE9, 0xE7, 0xE8, 
-    0xEA, 0xED, 0xF1, 0xF3, 0xF5, 0xF4, 0xF5, 0xF7, 0xFA, 0xFD, 0x00, 0x05, 
-    0x0A, 0x0F, 0x13, 0x15, 0x15, 0x15, 0x13, 0x12, 0x0F, 0x0D, 0x0B, 0x0A, 
-    0x07, 0x02, 0xFD, 0xF9, 0xF8, 0xF6, 0xF4, 0xF2, 0xF1, 0xF1, 0xF0, 0xF1, 
-    0xF4, 0xF6, 0xF6, 0xF2, 0xED, 0xE9, 0xE7, 0xE8, 0xEC, 0xF1, 0xF6, 0xFD, 
-    0x02, 0x07, 0x08, 0x06, 0x02, 0xFF, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xFE, 
-    0xFF, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x01, 0x00, 0xFD, 0xFA, 0xF8, 
-    0xF5, 0xF2, 0xF0, 0xF0, 0xF1, 0xF2, 0xF1, 0xF1, 0xF3, 0xF6, 0xF8, 0xF9, 
-    0xF8, 0xF6, 0xF4, 0xF2, 0xF1, 0xF0, 0xF1, 0xF0, 0xF2, 0xF4, 0xF7, 0xF9, 
-    0xFA, 0xFA, 0xF8, 0xF6, 0xF5, 0xF7, 0xFA, 0xFC, 0xFD, 0xFE, 0x02, 0x07, 
-    0x0B, 0x0B, 0x0A, 0x09, 0x0A, 0x09, 0x08, 0x04, 0x00, 0xFD, 0xFA, 0xF7, 
-    0xF6, 0xF5, 0xF5, 0xF6, 0xF7, 0xF8, 0xF7, 0xF7, 0xF8, 0xF8, 0xF8, 0xF7, 
-    0xF6, 0xF5, 0xF4, 0xF4, 0xF7, 0xF9, 0xFC, 0xFE, 0x01, 0x02, 0x01, 0xFE, 
-    0xFA, 0xF8, 0xF7, 0xF6, 0xF3, 0xF0, 0xED, 0xEC, 0xEC, 0xEE, 0xF0, 0xF4, 
-    0xF7, 0xF9, 0xF9, 0xF8, 0xF6, 0xF2, 0xED, 0xE9, 0xE6, 0xE4, 0xE6, 0xEA, 
-    0xF0, 0xF3, 0xF5, 0xF6, 0xF9, 0xFB, 0xFC, 0xFC, 0xFB, 0xFA, 0xFA, 0xFB, 
-    0xFC, 0xFE, 0x02, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0B, 0x0D, 0x0E, 0x0F, 
-    0x13, 0x17, 0x19, 0x19, 0x17, 0x17, 0x19, 0x1C, 0x1C, 0x1D, 0x1C, 0x1D, 
-    0x1C, 0x1B, 0x1A, 0x16, 0x12, 0x0C, 0x07, 0x05, 0x04, 0x05, 0x04, 0x04, 
-    0x03, 0x02, 0x02, 0x01, 0xFD, 0xF9, 0xF4, 0xF0, 0xEE, 0xED, 0xEE, 0xEF, 
-    0xF3, 0xF7, 0xFC, 0x01, 0x06, 0x09, 0x09, 0x09, 0x07, 0x06, 0x05, 0x06, 
-    0x05, 0x06, 0x08, 0x0B, 0x0E, 0x12, 0x17, 0x1E, 0x27, 0x2B, 0x2D, 0x2B, 
-    0x27, 0x22, 0x1E, 0x18, 0x14, 0x10, 0x11, 0x14, 0x17, 0x18, 0x19, 0x18, 
-    0x18, 0x19, 0x18, 0x14, 0x0F, 0x0B, 0x08, 0x05, 0x04, 0x01, 0x01, 0x02, 
-    0x06, 0x09, 0x0A, 0x09, 0x08, 0x08, 0x09, 0x0C, 0x0E, 0x10, 0x13, 0x16, 
-    0x18, 0x1B, 0x21, 0x26, 0x2B, 0x2E, 0x30, 0x32, 0x32, 0x31, 0x2E, 0x2B, 
-    0x2A, 0x29, 0x26, 0x22, 0x1F, 0x1E, 0x1C, 0x1A, 0x16, 0x12, 0x0C, 0x09, 
-    0x07, 0x06, 0x02, 0xFE, 0xFA, 0xF8, 0xF8, 0xF9, 0xFA, 0xFB, 0xFE, 0x02, 
-    0x05, 0x06, 0x07, 0x08, 0x09, 0x08, 0x07, 0x04, 0x04, 0x05, 0x09, 0x0E, 
-    0x14, 0x19, 0x1D, 0x20, 0x21, 0x21, 0x1F, 0x1C, 0x17, 0x10, 0x09, 0x04, 
-    0x04, 0x06, 0x08, 0x09, 0x08, 0x06, 0x04, 0x02, 0xFE, 0xFA, 0xF5, 0xF0, 
-    0xEB, 0xE7, 0xE5, 0xE3, 0xE4, 0xE3, 0xE4, 0xE4, 0xE6, 0xE8, 0xEA, 0xED, 
-    0xF0, 0xF1, 0xF2, 0xF4, 0xF7, 0xFB, 0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0x04, 
-    0x08, 0x0C, 0x0F, 0x0F, 0x0B, 0x07, 0x03, 0x00, 0xFB, 0xF6, 0xF2, 0xEF, 
-    0xF1, 0xF3, 0xF3, 0xF2, 0xF1, 0xF0, 0xEE, 0xEA, 0xE5, 0xE2, 0xE1, 0xE2, 
-    0xE2, 0xE1, 0xE2, 0xE7, 0xED, 0xF4, 0xF9, 0xFA, 0xFB, 0xFA, 0xF9, 0xF8, 
-    0xF6, 0xF5, 0xF7, 0xF9, 0xFB, 0xFC, 0xFD, 0xFF, 0x01, 0x04, 0x06, 0x05, 
-    0x03, 0x02, 0x01, 0xFE, 0xFA, 0xF4, 0xEE, 0xEB, 0xE9, 0xE8, 0xE7, 0xE6, 
-    0xE8, 0xEC, 0xF0, 0xF2, 0xF4, 0xF5, 0xF4, 0xF1, 0xEC, 0xE7, 0xE2, 0xE0, 
-    0xE0, 0xE3, 0xE7, 0xEC, 0xEF, 0xF0, 0xF1, 0xF0, 0xF1, 0xF3, 0xF4, 0xF5, 
-    0xF7, 0xF9, 0xFC, 0xFE, 0x00, 0x02, 0x03, 0x06, 0x08, 0x09, 0x09, 0x08, 
-    0x07, 0x05, 0x03, 0x00, 0xFD, 0xF9, 0xF5, 0xF2, 0xF0, 0xF1, 0xF2, 0xF3, 
-    0xF3, 0xF4, 0xF5, 0xF7, 0xF7, 0xF6, 0xF3, 0xF1, 0xEF, 0xED, 0xED, 0xEC, 
-    0xEC, 0xEF, 0xF3, 0xF6, 0xF8, 0xFA, 0xF9, 0xF7, 0xF3, 0xED, 0xE9, 0xE8, 
-    0xE9, 0xED, 0xF2, 0xF8, 0xFD, 0x02, 0x07, 0x0A, 0x08, 0x04, 0x00, 0xFC, 
-    0xF8, 0xF4, 0xF2, 0xF5, 0xF9, 0xFC, 0xFE, 0x00, 0x04, 0x07, 0x09, 0x08, 
-    0x05, 0x02, 0x00, 0xFF, 0xFE, 0xFD, 0xFA, 0xF8, 0xF6, 0xF7, 0xFB, 0xFF, 
-    0x00, 0xFD, 0xFA, 0xF9, 0xFB, 0xFE, 0xFD, 0xFB, 0xFA, 0xFA, 0xFB, 0xFC, 
-    0xFA, 0xF9, 0xFA, 0xFD, 0x02, 0x06, 0x08, 0x06, 0x02, 0xFD, 0xF9, 0xF6, 
-    0xF3, 0xF1, 0xF0, 0xF1, 0xF3, 0xF5, 0xF8, 0xFA, 0xF8, 0xF6, 0xF5, 0xF4, 
-    0xF5, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0, 0xF1, 0xF3, 0xF5, 0xF6, 0xF4, 0xF0, 
-    0xED, 0xEC, 0xEC, 0xEC, 0xEC, 0xEE, 0xEE, 0xED, 0xEC, 0xED, 0xF0, 0xF5, 
-    0xFB, 0x00, 0x03, 0x06, 0x09, 0x0A, 0x09, 0x06, 0x02, 0xFF, 0xFE, 0x00, 
-    0x02, 0x03, 0x04, 0x05, 0x09, 0x0B, 0x0C, 0x09, 0x06, 0x02, 0xFF, 0xFD, 
-    0xFA, 0xF7, 0xF2, 0xF1, 0xF3, 0xF7, 0xFA, 0xFD, 0xFE, 0xFD, 0xFC, 0xFB, 
-    0xF9, 0xF6, 0xF4, 0xF2, 0xF0, 0xF2, 0xF7, 0xFB, 0xFD, 0xFE, 0xFE, 0x00, 
-    0x03, 0x03, 0x01, 0xFD, 0xFA, 0xF8, 0xF6, 0xF3, 0xF1, 0xF0, 0xF1, 0xF1, 
-    0xF3, 0xF5, 0xF6, 0xF7, 0xF7, 0xF8, 0xF7, 0xF5, 0xF3, 0xF1, 0xEF, 0xED, 
-    0xEA, 0xE7, 0xE7, 0xE9, 0xEF, 0xF5, 0xF8, 0xF9, 0xF9, 0xFA, 0xFA, 0xF9, 
-    0xF8, 0xF8, 0xFA, 0xFD, 0x05, 0x0D, 0x16, 0x1C, 0x20, 0x24, 0x27, 0x29, 
-    0x2A, 0x28, 0x25, 0x21, 0x1E, 0x1D, 0x1D, 0x1B, 0x1A, 0x16, 0x13, 0x12, 
-    0x11, 0x12, 0x12, 0x11, 0x12, 0x13, 0x13, 0x11, 0x0F, 0x0B, 0x05, 0x00, 
-    0xFD, 0xFE, 0x02, 0x08, 0x0B, 0x0B, 0x0C, 0x0E, 0x10, 0x11, 0x0F, 0x0C, 
-    0x0A, 0x09, 0x0B, 0x0E, 0x13, 0x17, 0x1A, 0x1C, 0x1E, 0x1E, 0x1B, 0x17, 
-    0x13, 0x10, 0x0E, 0x0D, 0x0C, 0x0E, 0x0F, 0x10, 0x12, 0x14, 0x14, 0x12, 
-    0x10, 0x0E, 0x0E, 0x0C, 0x08, 0x04, 0x02, 0x01, 0x00, 0x01, 0x03, 0x06, 
-    0x0B, 0x0F, 0x10, 0x10, 0x0F, 0x0F, 0x10, 0x0E, 0x0B, 0x09, 0x07, 0x0A, 
-    0x10, 0x16, 0x1B, 0x20, 0x25, 0x2A, 0x2D, 0x2E, 0x2B, 0x25, 0x1E, 0x17, 
-    0x11, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0D, 0x0E, 0x0D, 0x0F, 0x0E, 0x0B, 
-    0x08, 0x06, 0x06, 0x07, 0x06, 0x07, 0x07, 0x09, 0x0C, 0x13, 0x19, 0x1E, 
-    0x1E, 0x1C, 0x1C, 0x19, 0x1A, 0x15, 0x15, 0x11, 0x12, 0x13, 0x13, 0x12, 
-    0x10, 0x0C, 0x05, 0x04, 0xFF, 0xFD, 0xFB, 0xFB, 0xFB, 0x03, 0x04, 0x09, 
-    0x01, 0x01, 0x01, 0xE7, 0xEF, 0xE1, 0xD3, 0xE2, 0xE5, 0xF1, 0xFD, 0xFD, 
-    0xF5, 0x02, 0xFF, 0xF1, 0xF8, 0xF8, 0xFE, 0xF6, 0xFD, 0x00, 0xF8, 0x07, 
-    0x04, 0x15, 0x27, 0x0C, 0xFC, 0xF9, 0x04, 0x07, 0x05, 0x06, 0xFC, 0xFF, 
-    0xFD, 0x01, 0x02, 0x00, 0xFC, 0xFC, 0xF7, 0xEE, 0xED, 0xE5, 0xE7, 0xE2, 
-    0xEB, 0xE5, 0xD7, 0xCC, 0xC0, 0xD3, 0xDD, 0xEB, 0xF9, 0xFC, 0xF9, 0xFB, 
-    0xFD, 0xFF, 0xFB, 0xFB, 0x02, 0x01, 0x08, 0x11, 0x13, 0x12, 0x17, 0x0E, 
-    0x09, 0x08, 0xFC, 0x02, 0x06, 0x0A, 0x04, 0xFF, 0x09, 0x01, 0x01, 0xFE, 
-    0x01, 0xFD, 0xFC, 0x04, 0x08, 0x09, 0xFE, 0x03, 0x0A, 0x03, 0x02, 0xF7, 
-    0xF1, 0xEF, 0xEB, 0xEC, 0xEC, 0xED, 0xEF, 0xF2, 0xEC, 0xEB, 0xE6, 0xE0, 
-    0xDD, 0xDC, 0xDC, 0xDD, 0xE0, 0xE3, 0xE3, 0xE5, 0xE5, 0xE0, 0xE7, 0xE0, 
-    0xE1, 0xE2, 0xDA, 0xD8, 0xDB, 0xE2, 0xE9, 0xEA, 0xE9, 0xEC, 0xEE, 0xF0, 
-    0xEC, 0xE7, 0xDC, 0xD6, 0xD8, 0xE9, 0xF7, 0x03, 0x05, 0x05, 0x05, 0x04, 
-    0x05, 0x04, 0x04, 0x02, 0x00, 0x02, 0x05, 0x06, 0x08, 0x03, 0x02, 0xFE, 
-    0x01, 0xFF, 0x02, 0xFF, 0xF8, 0xF6, 0xF0, 0xED, 0xE8, 0xEC, 0xE7, 0xE8, 
-    0xED, 0xEB, 0xF2, 0xFE, 0x02, 0x06, 0xFE, 0x01, 0x04, 0x05, 0x07, 0xFE, 
-    0xF6, 0xEC, 0xEA, 0xE4, 0xE9, 0xEC, 0xED, 0xEE, 0xE8, 0xEA, 0xE4, 0xE2, 
-    0xE6, 0xE2, 0xDD, 0xD6, 0xD2, 0xD1, 0xCE, 0xCD, 0xCF, 0xC7, 0xC3, 0xCF, 
-    0xD0, 0xD5, 0xC7, 0xB0, 0xB1, 0xC1, 0xCE, 0xCF, 0xD4, 0xDB, 0xDA, 0xDB, 
-    0xDC, 0xE1, 0xE8, 0xEF, 0xFC, 0xFF, 0xFE, 0xF3, 0xF9, 0x01, 0xF9, 0xF8, 
-    0xF7, 0xF7, 0xFA, 0xFF, 0xFA, 0xF9, 0xF5, 0xF4, 0xF5, 0xF7, 0xF9, 0xF7, 
-    0xF9, 0xF3, 0xF8, 0xEE, 0xEF, 0xE6, 0xEB, 0xF0, 0xE7, 0xE3, 0xED, 0x02, 
-    0xFA, 0xF3, 0xE7, 0xF3, 0xFC, 0xFD, 0xFE, 0x04, 0xF6, 0xED, 0xFF, 0xF3, 
-    0xF2, 0xF5, 0xFD, 0x0D, 0x00, 0xF9, 0xF5, 0xEF, 0xEC, 0xE7, 0xE9, 0xF2, 
-    0xFB, 0xF8, 0xFB, 0xEE, 0xEB, 0xE7, 0xE9, 0xEB, 0xEC, 0xEF, 0xEF, 0xED, 
-    0xEB, 0xE9, 0xE1, 0xDE, 0xD6, 0xE2, 0xEB, 0xF4, 0x04, 0xFF, 0xF7, 0x04, 
-    0x0F, 0x13, 0x1A, 0x13, 0x10, 0x06, 0xFE, 0x05, 0x14, 0x16, 0x14, 0x1D, 
-    0x1C, 0x1E, 0x1C, 0x23, 0x16, 0x14, 0x0E, 0x08, 0x13, 0x17, 0x2A, 0x1D, 
-    0x0F, 0x05, 0x01, 0x03, 0x0D, 0x17, 0x18, 0x13, 0x1E, 0x20, 0x16, 0x23, 
-    0x28, 0x1E, 0x16, 0x25, 0x2B, 0x1D, 0x1C, 0x1F, 0x19, 0x1D, 0x1A, 0x26, 
-    0x2A, 0x24, 0x2B, 0x29, 0x26, 0x2E, 0x31, 0x30, 0x37, 0x34, 0x2A, 0x2A, 
-    0x39, 0x2F, 0x21, 0x1B, 0x19, 0x23, 0x23, 0x22, 0x1E, 0x15, 0x0E, 0x0E, 
-    0x0A, 0x08, 0x08, 0x08, 0x05, 0xF9, 0xF8, 0xF8, 0xF4, 0xED, 0xE8, 0xED, 
-    0xF3, 0xEA, 0xED, 0xEF, 0xF1, 0xF4, 0xF3, 0xFD, 0xF7, 0xEF, 0xF2, 0xF2, 
-    0x06, 0x10, 0x00, 0x07, 0x04, 0x07, 0x01, 0x04, 0x11, 0x11, 0x10, 0x09, 
-    0x0D, 0xFE, 0xFF, 0x07, 0x09, 0xFE, 0x03, 0x06, 0xFB, 0xFE, 0xFF, 0x05, 
-    0x0B, 0x08, 0x0D, 0x15, 0x0D, 0x13, 0x0D, 0x05, 0x0B, 0x08, 0x00, 0x04, 
-    0x0A, 0x0E, 0x0E, 0x0B, 0x06, 0xFD, 0x01, 0x08, 0x09, 0xFD, 0xF7, 0x00, 
-    0x00, 0xF8, 0xF3, 0xEC, 0xF3, 0xF1, 0xEF, 0xE5, 0xE3, 0xE5, 0xE0, 0xE0, 
-    0xDB, 0xDD, 0xDC, 0xE7, 0xE9, 0xDD, 0xD3, 0xDE, 0xDB, 0xDC, 0xE8, 0xE3, 
-    0xE6, 0xE4, 0xE6, 0xE2, 0xE3, 0xDF, 0xDD, 0xE2, 0xDD, 0xE9, 0xDF, 0xE4, 
-    0xE7, 0xDF, 0xDA, 0xD4, 0xD4, 0xCD, 0xCF, 0xD0, 0xCE, 0xC9, 0xE7, 0xEB, 
-    0xEC, 0xF6, 0xE4, 0xE6, 0xE7, 0xE6, 0xE8, 0xF3, 0xFE, 0xF9, 0xF0, 0xF0, 
-    0xFA, 0x05, 0x04, 0xFC, 0xFC, 0xF5, 0xF0, 0xF8, 0xF5, 0xF8, 0x00, 0xFD, 
-    0x01, 0xFF, 0xFE, 0x05, 0xF8, 0xF3, 0xF1, 0xF6, 0xF8, 0xF6, 0xFD, 0x01, 
-    0xFB, 0xFD, 0xFD, 0xF2, 0xF9, 0xFA, 0xF4, 0xF0, 0xFC, 0xFF, 0x01, 0x09, 
-    0x06, 0xFC, 0x07, 0x10, 0x11, 0x18, 0x0B, 0x15, 0x20, 0x1F, 0x26, 0x1B, 
-    0x18, 0x1E, 0x1C, 0x12, 0x02, 0x02, 0xFC, 0x0A, 0x0A, 0x01, 0xFE, 0xFE, 
-    0x01, 0xF7, 0xFB, 0xF9, 0xFA, 0xF4, 0xF3, 0xF5, 0xF4, 0xF6, 0xED, 0xF5, 
-    0xFA, 0x05, 0x13, 0x0D, 0x11, 0x13, 0x1A, 0x20, 0x25, 0x2A, 0x28, 0x28, 
-    0x26, 0x2B, 0x35, 0x38, 0x2E, 0x22, 0x21, 0x2B, 0x2A, 0x2C, 0x32, 0x33, 
-    0x2E, 0x26, 0x26, 0x1E, 0x20, 0x21, 0x20, 0x23, 0x26, 0x26, 0x24, 0x1F, 
-    0x23, 0x28, 0x20, 0x19, 0x16, 0x1B, 0x1D, 0x1D, 0x12, 0x05, 0x06, 0x0B, 
-    0x0C, 0x08, 0x07, 0x07, 0x04, 0xFE, 0x03, 0x06, 0x02, 0x06, 0x0B, 0x0F, 
-    0x08, 0x07, 0x0C, 0x0A, 0x0A, 0x03, 0x0A, 0x02, 0x00, 0x03, 0xFE, 0xF9, 
-    0xEB, 0xF1, 0xF8, 0xF8, 0xF6, 0xF1, 0xEE, 0xE8, 0xE2, 0xDF, 0xE3, 0xDF, 
-    0xE7, 0xF7, 0xF2, 0xFE, 0xFC, 0xF4, 0xF0, 0xE7, 0xF1, 0xF6, 0xFF, 0x05, 
-    0x05, 0x05, 0x09, 0x0E, 0x10, 0x16, 0x0C, 0x07, 0xFC, 0x06, 0x0F, 0x06, 
-    0x02, 0xF8, 0xF8, 0xFB, 0xFF, 0xF4, 0xE5, 0xD8, 0xDB, 0xE3, 0xEC, 0xE9, 
-    0xEB, 0xE9, 0xED, 0xFB, 0xFC, 0xF5, 0xE6, 0xEB, 0xF1, 0xEB, 0xED, 0xEF, 
-    0xEE, 0xF6, 0xFD, 0xFC, 0xEF, 0xF6, 0xF0, 0xEC, 0xED, 0xFB, 0xF9, 0xF7, 
-    0xFC, 0xF6, 0x01, 0xF1, 0xEE, 0xED, 0xE8, 0xEB, 0xE7, 0xE7, 0xD6, 0xD5, 
-    0xDA, 0xDC, 0xDA, 0xD6, 0xE3, 0xD5, 0xD2, 0xD2, 0xCB, 0xD5, 0xD4, 0xE3, 
-    0xEA, 0xE2, 0xED, 0xE8, 0xE8, 0xEA, 0xE0, 0xE0, 0xE8, 0xEE, 0xE8, 0xEB, 
-    0xEF, 0xEC, 0xE8, 0xEB, 0xE6, 0xE7, 0xE4, 0xE9, 0xED, 0xEF, 0xFA, 0xF3, 
-    0xFB, 0xFC, 0xF9, 0xF7, 0xFB, 0x00, 0xFC, 0xF6, 0xF3, 0xF3, 0xEB, 0xEC, 
-    0xEE, 0xF6, 0xF6, 0xF5, 0xF1, 0xF3, 0xFE, 0x06, 0x15, 0x15, 0x16, 0x1C, 
-    0x27, 0x32, 0x35, 0x36, 0x34, 0x30, 0x30, 0x25, 0x26, 0x20, 0x1F, 0x26, 
-    0x1C, 0x1A, 0x10, 0x0D, 0x05, 0x06, 0x01, 0xFA, 0xFE, 0x00, 0x06, 0x01, 
-    0x01, 0x05, 0x07, 0x07, 0x13, 0x0D, 0x0C, 0x0F, 0x0F, 0x12, 0x10, 0x18, 
-    0x18, 0x17, 0x10, 0x10, 0x19, 0x19, 0x1B, 0x17, 0x10, 0x14, 0x14, 0x13, 
-    0x16, 0x14, 0x0E, 0x12, 0x1A, 0x17, 0x19, 0x13, 0x0E, 0x0E, 0x0C, 0x0D, 
-    0x09, 0x0C, 0x0F, 0x13, 0x1E, 0x23, 0x1C, 0x1C, 0x18, 0x19, 0x1D, 0x19, 
-    0x15, 0x11, 0x17, 0x16, 0x14, 0x13, 0x0E, 0x09, 0xFE, 0xF5, 0xFA, 0xFF, 
-    0x03, 0x02, 0x01, 0x07, 0x0B, 0x0D, 0x0F, 0x12, 0x0F, 0x10, 0x11, 0x0F, 
-    0x0B, 0x0F, 0x16, 0x0E, 0x09, 0x01, 0x03, 0x08, 0x05, 0xFB, 0xF0, 0xE8, 
-    0xEC, 0xF4, 0xEF, 0xF6, 0xF1, 0xF7, 0x00, 0x01, 0x00, 0xFC, 0xFA, 0xF6, 
-    0xFE, 0x03, 0x09, 0x0F, 0x0C, 0x04, 0x07, 0x05, 0x02, 0xFB, 0xF5, 0xF7, 
-    0xF8, 0xF3, 0xEF, 0xF5, 0xEB, 0xEF, 0xEF, 0xE7, 0xDD, 0xD9, 0xDA, 0xD6, 
-    0xD9, 0xE1, 0xEA, 0xE3, 0xDD, 0xDC, 0xE2, 0xDE, 0xE0, 0xE5, 0xE4, 0xE9, 
-    0xEC, 0xF4, 0xF7, 0xF3, 0xF8, 0xFF, 0x02, 0xFD, 0xF7, 0xFA, 0xFE, 0xFF, 
-    0xFB, 0xF9, 0xF5, 0xF2, 0xF0, 0xF9, 0xF2, 0xF1, 0xF1, 0xE9, 0xE7, 0xE8, 
-    0xEA, 0xE7, 0xEA, 0xE9, 0xE9, 0xE6, 0xE6, 0xE7, 0xE2, 0xE3, 0xE6, 0xE2, 
-    0xE4, 0xE6, 0xED, 0xEF, 0xF0, 0xF5, 0xF2, 0xF5, 0xFD, 0xFD, 0x00, 0x05, 
-    0xFF, 0x05, 0x00, 0xFA, 0x02, 0x02, 0xFA, 0xF7, 0xF7, 0xF3, 0xED, 0xE6, 
-    0xE1, 0xE4, 0xE6, 0xE8, 0xE9, 0xE7, 0xEA, 0xEA, 0xE9, 0xE7, 0xE2, 0xE4, 
-    0xE7, 0xE4, 0xE4, 0xE5, 0xE6, 0xE6, 0xE3, 0xEA, 0xF1, 0xF3, 0xF6, 0xF2, 
-    0xF6, 0xFA, 0xFF, 0x06, 0x0C, 0x17, 0x21, 0x20, 0x27, 0x2C, 0x32, 0x34, 
-    0x2E, 0x2F, 0x29, 0x2A, 0x2C, 0x2B, 0x28, 0x23, 0x17, 0x0B, 0x01, 0xF8, 
-    0xF7, 0xF7, 0xF6, 0xF5, 0xF3, 0xFA, 0x03, 0x03, 0x04, 0x06, 0x09, 0x06, 
-    0x0B, 0x12, 0x14, 0x18, 0x16, 0x22, 0x2F, 0x32, 0x2D, 0x29, 0x27, 0x29, 
-    0x29, 0x29, 0x2C, 0x2A, 0x2F, 0x31, 0x2E, 0x30, 0x2B, 0x22, 0x1F, 0x1B, 
-    0x1B, 0x1E, 0x23, 0x20, 0x1C, 0x1E, 0x20, 0x1D, 0x1C, 0x1D, 0x12, 0x12, 
-    0x0F, 0x0D, 0x11, 0x0E, 0x11, 0x11, 0x0D, 0x0D, 0x09, 0x07, 0x04, 0x00, 
-    0xFA, 0xFA, 0xFC, 0xFF, 0x02, 0x05, 0x02, 0xFD, 0xFB, 0xFB, 0xFC, 0xF8, 
-    0xF6, 0xF6, 0xFE, 0x05, 0x0E, 0x0F, 0x10, 0x13, 0x12, 0x15, 0x14, 0x12, 
-    0x0D, 0x0A, 0x07, 0x07, 0x03, 0xFA, 0xF7, 0xF5, 0xF3, 0xEE, 0xED, 0xF2, 
-    0xF4, 0xF2, 0xF5, 0xFA, 0xFA, 0xFC, 0x04, 0x06, 0x05, 0x06, 0x05, 0x03, 
-    0x09, 0x0D, 0x0C, 0x09, 0x09, 0x05, 0x05, 0x03, 0x01, 0xFD, 0xFB, 0xFC, 
-    0xF9, 0xF8, 0xF2, 0xF2, 0xEF, 0xEF, 0xF2, 0xEF, 0xEF, 0xEC, 0xE9, 0xEA, 
-    0xEA, 0xE8, 0xE3, 0xE3, 0xE3, 0xE8, 0xEA, 0xE7, 0xE9, 0xE7, 0xE9, 0xEA, 
-    0xE5, 0xE3, 0xE3, 0xE3, 0xE8, 0xE5, 0xE2, 0xDB, 0xD8, 0xDC, 0xE1, 0xE7, 
-    0xE2, 0xDE, 0xDD, 0xD9, 0xDA, 0xDD, 0xDD, 0xDF, 0xDE, 0xDE, 0xDA, 0xDA, 
-    0xDD, 0xDD, 0xDC, 0xDE, 0xE1, 0xE4, 0xEC, 0xF1, 0xEE, 0xED, 0xF4, 0xF6, 
-    0xF9, 0xF8, 0xF9, 0xFC, 0xFC, 0x03, 0x04, 0x06, 0x05, 0x07, 0x03, 0xFE, 
-    0x00, 0xF5, 0xEF, 0xED, 0xEE, 0xED, 0xED, 0xEB, 0xEE, 0xF4, 0xF5, 0xF8, 
-    0xF4, 0xF4, 0xF2, 0xF0, 0xF4, 0xF5, 0xEE, 0xF1, 0xF7, 0xFC, 0xFD, 0x00, 
-    0x04, 0x05, 0x08, 0x09, 0x0D, 0x0C, 0x0E, 0x0F, 0x13, 0x19, 0x1C, 0x1D, 
-    0x1F, 0x1E, 0x1C, 0x1E, 0x20, 0x1D, 0x20, 0x21, 0x19, 0x16, 0x13, 0x0E, 
-    0x0A, 0x03, 0xF9, 0xF7, 0xF1, 0xF1, 0xF1, 0xF0, 0xF1, 0xEF, 0xEC, 0xEE, 
-    0xF0, 0xF0, 0xF1, 0xF3, 0xF9, 0xFD, 0x09, 0x13, 0x19, 0x1E, 0x23, 0x26, 
-    0x25, 0x29, 0x2E, 0x2D, 0x2F, 0x32, 0x2C, 0x27, 0x29, 0x27, 0x25, 0x24, 
-    0x20, 0x1B, 0x18, 0x15, 0x17, 0x1A, 0x1A, 0x18, 0x14, 0x12, 0x13, 0x11, 
-    0x0A, 0x08, 0x0A, 0x08, 0x0F, 0x15, 0x11, 0x14, 0x14, 0x15, 0x18, 0x16, 
-    0x13, 0x0D, 0x0D, 0x12, 0x15, 0x19, 0x1A, 0x1B, 0x1C, 0x19, 0x16, 0x12, 
-    0x0E, 0x0C, 0x0A, 0x04, 0x04, 0x01, 0x02, 0x01, 0xFE, 0xFF, 0xFD, 0x00, 
-    0x02, 0x02, 0x02, 0xFE, 0xFE, 0xFB, 0xF6, 0xEF, 0xE6, 0xE3, 0xE1, 0xE1, 
-    0xE1, 0xE5, 0xE8, 0xEB, 0xF3, 0xF4, 0xEF, 0xF2, 0xF3, 0xF5, 0xF7, 0xF8, 
-    0xFA, 0xFB, 0x02, 0x09, 0x0C, 0x0C, 0x0F, 0x0D, 0x0E, 0x0B, 0x0A, 0x0A, 
-    0x03, 0x02, 0x00, 0xFA, 0xF6, 0xF7, 0xF4, 0xEE, 0xED, 0xEB, 0xE5, 0xE4, 
-    0xE5, 0xDF, 0xDB, 0xD9, 0xD8, 0xDC, 0xE0, 0xE0, 0xDC, 0xDF, 0xE6, 0xEB, 
-    0xEF, 0xF4, 0xF1, 0xF0, 0xF4, 0xF4, 0xF6, 0xF6, 0xF6, 0xF5, 0xF6, 0xF7, 
-    0xF9, 0xFD, 0xFB, 0xFA, 0xF4, 0xF4, 0xF7, 0xF4, 0xF6, 0xF1, 0xF2, 0xED, 
-    0xE7, 0xE3, 0xDF, 0xDC, 0xDA, 0xD6, 0xD5, 0xD4, 0xD4, 0xDA, 0xDB, 0xDC, 
-    0xDA, 0xDA, 0xD5, 0xD2, 0xD0, 0xD0, 0xD9, 0xDD, 0xE0, 0xE4, 0xE7, 0xE6, 
-    0xEB, 0xEA, 0xE9, 0xEB, 0xE9, 0xEE, 0xF2, 0xF1, 0xF2, 0xF3, 0xF9, 0xFD, 
-    0xFF, 0xFE, 0xFB, 0xF9, 0xF9, 0xFB, 0xFC, 0xFA, 0xF6, 0xEF, 0xEF, 0xEF, 
-    0xF1, 0xF1, 0xEF, 0xF1, 0xF1, 0xF2, 0xF9, 0x03, 0x05, 0x06, 0x03, 0x01, 
-    0x01, 0x06, 0x08, 0x03, 0x05, 0x06, 0x0B, 0x17, 0x1D, 0x22, 0x22, 0x1D, 
-    0x19, 0x19, 0x18, 0x17, 0x18, 0x16, 0x17, 0x1B, 0x1D, 0x21, 0x21, 0x1C, 
-    0x1A, 0x13, 0x10, 0x10, 0x0D, 0x08, 0x06, 0x0B, 0x0E, 0x11, 0x13, 0x13, 
-    0x13, 0x14, 0x13, 0x17, 0x18, 0x18, 0x1D, 0x1A, 0x19, 0x17, 0x15, 0x16, 
-    0x16, 0x10, 0x0B, 0x0A, 0x0A, 0x0B, 0x0B, 0x0D, 0x0B, 0x0C, 0x0F, 0x11, 
-    0x15, 0x18, 0x16, 0x12, 0x0E, 0x0C, 0x12, 0x13, 0x17, 0x18, 0x14, 0x18, 
-    0x1A, 0x1E, 0x1F, 0x1C, 0x1D, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x15, 0x13, 
-    0x0E, 0x0A, 0x09, 0x09, 0x03, 0x00, 0xFC, 0xF7, 0xF4, 0xF5, 0xF7, 0xF8, 
-    0xF7, 0xF6, 0xF9, 0xF9, 0xFA, 0xFB, 0xF7, 0xF7, 0xFA, 0xF8, 0xF6, 0xFB, 
-    0xFD, 0xFD, 0xFD, 0xFC, 0xFE, 0x03, 0x09, 0x0D, 0x0F, 0x13, 0x19, 0x1B, 
-    0x1E, 0x1A, 0x14, 0x11, 0x0B, 0x09, 0x0A, 0x0A, 0x06, 0x02, 0x02, 0x02, 
-    0x02, 0x04, 0xFE, 0xF7, 0xEC, 0xE6, 0xE1, 0xDD, 0xDF, 0xDC, 0xDB, 0xDC, 
-    0xDD, 0xDD, 0xDA, 0xDA, 0xD6, 0xD3, 0xD3, 0xD5, 0xD9, 0xDD, 0xE3, 0xE7, 
-    0xE9, 0xED, 0xF2, 0xF5, 0xF6, 0xF2, 0xF2, 0xF7, 0xFA, 0xFE, 0x01, 0x00, 
-    0xFF, 0xFF, 0xFD, 0xFB, 0xF8, 0xF9, 0xF4, 0xF3, 0xF1, 0xEF, 0xEE, 0xF0, 
-    0xEF, 0xEB, 0xE7, 0xE4, 0xE1, 0xDD, 0xDE, 0xDB, 0xDA, 0xD9, 0xD8, 0xDA, 
-    0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xDF, 0xDF, 0xE2, 0xE9, 0xEB, 0xEF, 0xF4, 
-    0xFB, 0xFF, 0x01, 0x01, 0x02, 0x05, 0x0B, 0x0C, 0x0D, 0x0C, 0x09, 0x0B, 
-    0x0A, 0x09, 0x07, 0x08, 0x05, 0x01, 0xFE, 0xFD, 0xF9, 0xF6, 0xF3, 0xEF, 
-    0xEA, 0xE2, 0xDF, 0xDC, 0xD8, 0xD5, 0xD6, 0xD8, 0xD8, 0xDC, 0xE2, 0xE9, 
-    0xF0, 0xF1, 0xF3, 0xF4, 0xF8, 0xFA, 0xFA, 0xFC, 0x02, 0x05, 0x0C, 0x16, 
-    0x18, 0x18, 0x1C, 0x23, 0x26, 0x29, 0x25, 0x23, 0x21, 0x1E, 0x1E, 0x1A, 
-    0x1B, 0x1B, 0x1B, 0x18, 0x14, 0x12, 0x0E, 0x0C, 0x09, 0x07, 0x06, 0x07, 
-    0x08, 0x0A, 0x0C, 0x0E, 0x0F, 0x0E, 0x11, 0x14, 0x17, 0x18, 0x18, 0x18, 
-    0x1A, 0x1B, 0x1D, 0x20, 0x25, 0x28, 0x2A, 0x29, 0x2A, 0x2D, 0x2D, 0x2F, 
-    0x2F, 0x2D, 0x2E, 0x2F, 0x2E, 0x2B, 0x24, 0x1F, 0x1C, 0x19, 0x17, 0x14, 
-    0x12, 0x14, 0x15, 0x16, 0x17, 0x16, 0x13, 0x0E, 0x0A, 0x06, 0x05, 0x07, 
-    0x07, 0x06, 0x04, 0x00, 0x01, 0x03, 0x03, 0x01, 0xFC, 0xF6, 0xF7, 0xFB, 
-    0xFE, 0x01, 0x04, 0x04, 0x03, 0x02, 0x02, 0x01, 0xFF, 0xF9, 0xF7, 0xF9, 
-    0xFC, 0xFF, 0x00, 0xFE, 0xFA, 0xF9, 0xF7, 0xF4, 0xF1, 0xEE, 0xF2, 0xF5, 
-    0xF9, 0xFE, 0x01, 0x03, 0x03, 0x00, 0xFD, 0xFC, 0xFB, 0xFC, 0xFA, 0xF8, 
-    0xF9, 0xFB, 0x00, 0x03, 0x04, 0x05, 0x02, 0xFE, 0xFD, 0xFC, 0xFC, 0xFD, 
-    0xFE, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFA, 0xF9, 0xFC, 0xFF, 
-    0xFF, 0xFD, 0xFC, 0xFC, 0xFC, 0xFB, 0xF8, 0xF4, 0xF2, 0xF3, 0xF7, 0xF9, 
-    0xF9, 0xF9, 0xF4, 0xF1, 0xEF, 0xEC, 0xE8, 0xE3, 0xE0, 0xDE, 0xDA, 0xDA, 
-    0xDB, 0xDA, 0xDA, 0xD7, 0xD3, 0xD0, 0xD1, 0xD2, 0xD2, 0xD5, 0xD9, 0xDC, 
-    0xDE, 0xDF, 0xE0, 0xE2, 0xE5, 0xE6, 0xE6, 0xE7, 0xE9, 0xEA, 0xEC, 0xED, 
-    0xEB, 0xEB, 0xED, 0xF0, 0xF1, 0xF0, 0xEE, 0xEC, 0xEE, 0xF0, 0xF4, 0xF4, 
-    0xF4, 0xF3, 0xF0, 0xF3, 0xF8, 0xFA, 0xF7, 0xF2, 0xF0, 0xEF, 0xF1, 0xF4, 
-    0xF5, 0xF4, 0xF2, 0xF3, 0xF4, 0xF5, 0xF7, 0xF8, 0xF8, 0xFA, 0xFC, 0xFD, 
-    0x00, 0x04, 0x07, 0x09, 0x0B, 0x0C, 0x0F, 0x11, 0x12, 0x10, 0x0D, 0x0E, 
-    0x0D, 0x0E, 0x0E, 0x0B, 0x0C, 0x0B, 0x0D, 0x11, 0x10, 0x11, 0x0F, 0x0C, 
-    0x08, 0x04, 0x02, 0xFE, 0xFC, 0xF8, 0xF4, 0xF6, 0xF8, 0xFB, 0xFC, 0xFC, 
-    0xFF, 0x01, 0x04, 0x07, 0x0A, 0x0E, 0x15, 0x1A, 0x1B, 0x1A, 0x1A, 0x1C, 
-    0x1E, 0x20, 0x23, 0x27, 0x2B, 0x2D, 0x2E, 0x2B, 0x26, 0x21, 0x1D, 0x1E, 
-    0x1E, 0x1E, 0x1D, 0x1D, 0x1B, 0x1B, 0x1B, 0x17, 0x13, 0x0C, 0x08, 0x06, 
-    0x03, 0x00, 0xFE, 0xFF, 0x02, 0x05, 0x09, 0x0E, 0x11, 0x0F, 0x0F, 0x11, 
-    0x14, 0x18, 0x1A, 0x1C, 0x1F, 0x23, 0x28, 0x2A, 0x28, 0x23, 0x22, 0x22, 
-    0x21, 0x25, 0x27, 0x28, 0x26, 0x23, 0x1F, 0x1E, 0x1F, 0x1D, 0x19, 0x13, 
-    0x0C, 0x07, 0x03, 0x02, 0x00, 0xFB, 0xF7, 0xF2, 0xED, 0xE8, 0xE3, 0xDC, 
-    0xD9, 0xD8, 0xDC, 0xE0, 0xE2, 0xE3, 0xE3, 0xE5, 0xE7, 0xE8, 0xE8, 0xEA, 
-    0xEF, 0xF4, 0xF9, 0xFD, 0xFD, 0xFE, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 
-    0x03, 0x02, 0x02, 0x01, 0x01, 0xFF, 0xFC, 0xFD, 0xFE, 0xFB, 0xF8, 0xF6, 
-    0xF7, 0xF8, 0xFB, 0xFB, 0xF8, 0xF2, 0xEE, 0xED, 0xEC, 0xEA, 0xE6, 0xE4, 
-    0xE4, 0xE6, 0xEA, 0xEB, 0xEC, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF2, 
-    0xF3, 0xF4, 0xF5, 0xF7, 0xF9, 0xF9, 0xF4, 0xEE, 0xE9, 0xE8, 0xED, 0xF2, 
-    0xF3, 0xF4, 0xF1, 0xF4, 0xF8, 0xF7, 0xF6, 0xF0, 0xEB, 0xE7, 0xE8, 0xE9, 
-    0xE9, 0xEA, 0xEC, 0xEC, 0xEC, 0xE6, 0xE3, 0xDF, 0xD7, 0xD4, 0xD2, 0xD3, 
-    0xD5, 0xD8, 0xD7, 0xDA, 0xDA, 0xDE, 0xE4, 0xE9, 0xEC, 0xEC, 0xF3, 0xF0, 
-    0xF4, 0xF6, 0xF7, 0xFB, 0xFA, 0xF9, 0xF7, 0xF6, 0xF8, 0xFA, 0xFB, 0xFA, 
-    0xF8, 0xFB, 0x00, 0x04, 0x06, 0x04, 0xFE, 0xFD, 0xFC, 0xF7, 0xFA, 0xF4, 
-    0xF1, 0xF3, 0xEF, 0xF1, 0xF0, 0xF3, 0xF4, 0xF5, 0xF7, 0xF6, 0xF8, 0xF7, 
-    0xF7, 0xF6, 0xFA, 0xFD, 0x00, 0x09, 0x0E, 0x15, 0x1B, 0x1A, 0x1D, 0x1C, 
-    0x19, 0x18, 0x1A, 0x1C, 0x1F, 0x1F, 0x23, 0x2D, 0x31, 0x36, 0x35, 0x35, 
-    0x35, 0x35, 0x32, 0x2E, 0x2A, 0x2A, 0x28, 0x28, 0x27, 0x20, 0x21, 0x1E, 
-    0x1D, 0x18, 0x12, 0x10, 0x0B, 0x08, 0x0A, 0x07, 0x03, 0x01, 0xFE, 0xFC, 
-    0xFD, 0xFD, 0x00, 0x07, 0x09, 0x0C, 0x0A, 0x0D, 0x0C, 0x0A, 0x0A, 0x0B, 
-    0x12, 0x15, 0x15, 0x18, 0x1A, 0x1D, 0x20, 0x21, 0x21, 0x20, 0x25, 0x24, 
-    0x26, 0x22, 0x22, 0x1F, 0x1B, 0x19, 0x18, 0x18, 0x12, 0x0F, 0x0A, 0x07, 
-    0x06, 0x03, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0xFC, 0xF8, 0xF7, 0xF9, 0xFB, 
-    0xFD, 0xFB, 0x00, 0xFF, 0x03, 0x05, 0x05, 0x05, 0x02, 0x02, 0x00, 0x02, 
-    0x02, 0x04, 0x07, 0x0B, 0x0C, 0x0C, 0x09, 0x08, 0x04, 0x00, 0xFE, 0xF9, 
-    0xFA, 0xF9, 0xFB, 0xFC, 0xF9, 0xF6, 0xF3, 0xEC, 0xE8, 0xE6, 0xDF, 0xDD, 
-    0xDA, 0xDB, 0xE0, 0xE6, 0xEA, 0xED, 0xEF, 0xED, 0xEB, 0xE7, 0xE6, 0xE5, 
-    0xE8, 0xEC, 0xF3, 0xFB, 0xFF, 0x04, 0x05, 0x07, 0x08, 0x07, 0x01, 0xFB, 
-    0xF7, 0xF5, 0xF5, 0xF6, 0xFA, 0xFA, 0xFE, 0xFE, 0xFC, 0xF7, 0xF0, 0xEB, 
-    0xE6, 0xE4, 0xDE, 0xD8, 0xD7, 0xD5, 0xD6, 0xD4, 0xD2, 0xD0, 0xCE, 0xCB, 
-    0xCD, 0xD0, 0xD2, 0xD8, 0xD9, 0xDF, 0xE2, 0xE6, 0xE8, 0xEA, 0xED, 0xF1, 
-    0xF4, 0xF3, 0xF2, 0xF4, 0xF9, 0xFA, 0xFF, 0xFF, 0x01, 0x02, 0x04, 0x05, 
-    0x05, 0x03, 0x00, 0x01, 0xFD, 0xFE, 0xFF, 0x03, 0x04, 0x03, 0xFB, 0xF7, 
-    0xF2, 0xEE, 0xEE, 0xEC, 0xEE, 0xEC, 0xEA, 0xE9, 0xEC, 0xEE, 0xEF, 0xF0, 
-    0xEB, 0xE7, 0xE6, 0xE9, 0xED, 0xF3, 0xF4, 0xF4, 0xF4, 0xF4, 0xF8, 0xF5, 
-    0xF2, 0xF1, 0xF4, 0xFA, 0x00, 0x05, 0x08, 0x06, 0x05, 0x05, 0x06, 0x04, 
-    0x05, 0x07, 0x09, 0x0A, 0x0D, 0x11, 0x10, 0x10, 0x0E, 0x0D, 0x0C, 0x0A, 
-    0x08, 0x04, 0x04, 0x03, 0x06, 0x0B, 0x0E, 0x12, 0x15, 0x19, 0x18, 0x16, 
-    0x14, 0x13, 0x17, 0x1A, 0x1F, 0x21, 0x26, 0x2A, 0x2F, 0x30, 0x31, 0x30, 
-    0x2F, 0x2E, 0x2C, 0x2B, 0x29, 0x2A, 0x2D, 0x2F, 0x30, 0x31, 0x2A, 0x25, 
-    0x20, 0x1D, 0x1C, 0x1A, 0x1A, 0x1B, 0x1F, 0x21, 0x20, 0x1D, 0x18, 0x11, 
-    0x0B, 0x07, 0x06, 0x07, 0x0B, 0x0E, 0x12, 0x13, 0x12, 0x0F, 0x09, 0x06, 
-    0x06, 0x04, 0x03, 0x05, 0x08, 0x0B, 0x0E, 0x10, 0x10, 0x10, 0x0D, 0x0C, 
-    0x0B, 0x0B, 0x08, 0x05, 0x03, 0x04, 0x07, 0x06, 0x06, 0x04, 0x04, 0x02, 
-    0xFF, 0xFC, 0xF9, 0xFA, 0xF7, 0xF7, 0xF5, 0xF3, 0xF4, 0xF3, 0xEE, 0xE8, 
-    0xE1, 0xDD, 0xDC, 0xDE, 0xE0, 0xE3, 0xE4, 0xE7, 0xE8, 0xEA, 0xEB, 0xEC, 
-    0xEE, 0xEF, 0xF2, 0xF4, 0xF6, 0xFB, 0xFE, 0x00, 0x04, 0x07, 0x07, 0x06, 
-    0x06, 0x03, 0x01, 0x03, 0x05, 0x07, 0x0A, 0x0D, 0x0C, 0x0C, 0x0B, 0x09, 
-    0x05, 0x02, 0x00, 0xFC, 0xF7, 0xF3, 0xF1, 0xEF, 0xED, 0xE9, 0xE6, 0xE6, 
-    0xE6, 0xEB, 0xEA, 0xE6, 0xDF, 0xD8, 0xD5, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 
-    0xDB, 0xDE, 0xE1, 0xDF, 0xDD, 0xDC, 0xDE, 0xE2, 0xE7, 0xEB, 0xEB, 0xEA, 
-    0xEA, 0xED, 0xEF, 0xF1, 0xF2, 0xF2, 0xF2, 0xF1, 0xEF, 0xED, 0xE9, 0xE7, 
-    0xE6, 0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 0xE1, 0xDD, 0xDB, 0xDA, 0xDA, 0xDB, 
-    0xDD, 0xDE, 0xE1, 0xE3, 0xE4, 0xE6, 0xE7, 0xE8, 0xEC, 0xF3, 0xFB, 0x02, 
-    0x06, 0x06, 0x04, 0x01, 0x00, 0x02, 0x06, 0x0C, 0x10, 0x12, 0x12, 0x13, 
-    0x13, 0x13, 0x11, 0x0B, 0x06, 0x02, 0x02, 0x05, 0x08, 0x09, 0x07, 0x04, 
-    0x01, 0xFF, 0xFD, 0xF9, 0xF4, 0xF2, 0xF2, 0xF7, 0xFE, 0x03, 0x05, 0x00, 
-    0xFC, 0xF7, 0xF4, 0xF5, 0xFA, 0xFF, 0x03, 0x09, 0x0E, 0x13, 0x15, 0x13, 
-    0x12, 0x0F, 0x10, 0x14, 0x17, 0x1A, 0x1C, 0x1E, 0x1F, 0x23, 0x25, 0x26, 
-    0x25, 0x21, 0x1E, 0x1D, 0x1E, 0x1C, 0x1B, 0x17, 0x15, 0x14, 0x14, 0x14, 
-    0x11, 0x0F, 0x0A, 0x07, 0x08, 0x09, 0x0B, 0x0E, 0x10, 0x11, 0x10, 0x11, 
-    0x15, 0x18, 0x1D, 0x1E, 0x1F, 0x20, 0x24, 0x2B, 0x30, 0x32, 0x30, 0x2C, 
-    0x2B, 0x2D, 0x2E, 0x2F, 0x2D, 0x2B, 0x2C, 0x2D, 0x2E, 0x30, 0x2F, 0x2C, 
-    0x28, 0x23, 0x1E, 0x1A, 0x16, 0x12, 0x0E, 0x09, 0x04, 0x02, 0x03, 0x01, 
-    0x00, 0xFC, 0xF9, 0xFA, 0xFB, 0xFC, 0xF9, 0xF4, 0xF3, 0xF4, 0xF6, 0xF7, 
-    0xF6, 0xF4, 0xF2, 0xF3, 0xF4, 0xF6, 0xF6, 0xF3, 0xF0, 0xEE, 0xF0, 0xF6, 
-    0xF9, 0xFB, 0xFB, 0xF9, 0xF8, 0xF6, 0xF4, 0xF2, 0xF1, 0xF1, 0xF1, 0xF1, 
-    0xF2, 0xF2, 0xEF, 0xEA, 0xE3, 0xDF, 0xDC, 0xDC, 0xDE, 0xE0, 0xE0, 0xDF, 
-    0xE0, 0xE3, 0xE8, 0xEA, 0xEC, 0xEB, 0xEB, 0xEC, 0xEE, 0xF1, 0xF4, 0xF7, 
-    0xF8, 0xF7, 0xFA, 0xFD, 0xFE, 0x00, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x00, 
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x01, 0xFE, 0xFC, 0xFB, 0xFC, 0xFC, 0xFB, 
-    0xF9, 0xF5, 0xF0, 0xEC, 0xE9, 0xEA, 0xED, 0xEB, 0xE8, 0xE7, 0xE8, 0xEB, 
-    0xED, 0xEC, 0xE9, 0xE8, 0xE7, 0xE6, 0xE6, 0xE9, 0xED, 0xEF, 0xEE, 0xEC, 
-    0xEA, 0xE9, 0xEA, 0xE8, 0xE5, 0xE5, 0xE9, 0xEE, 0xF1, 0xF1, 0xEE, 0xEC, 
-    0xEC, 0xEF, 0xF3, 0xF6, 0xF8, 0xF8, 0xF6, 0xF2, 0xEF, 0xEC, 0xE9, 0xE8, 
-    0xE9, 0xEA, 0xEB, 0xEE, 0xF0, 0xEE, 0xE9, 0xE4, 0xE4, 0xE9, 0xEF, 0xF3, 
-    0xF4, 0xF6, 0xF9, 0xFD, 0xFF, 0xFD, 0xFE, 0x00, 0x04, 0x08, 0x0B, 0x0E, 
-    0x0E, 0x0F, 0x0D, 0x0D, 0x0C, 0x0E, 0x11, 0x14, 0x18, 0x1B, 0x1D, 0x1E, 
-    0x20, 0x21, 0x20, 0x1F, 0x1D, 0x1C, 0x1E, 0x20, 0x22, 0x21, 0x20, 0x1D, 
-    0x19, 0x17, 0x16, 0x15, 0x10, 0x0B, 0x0A, 0x0D, 0x12, 0x14, 0x14, 0x11, 
-    0x0E, 0x0D, 0x0E, 0x10, 0x12, 0x11, 0x13, 0x15, 0x18, 0x1A, 0x18, 0x17, 
-    0x16, 0x18, 0x1D, 0x21, 0x25, 0x26, 0x24, 0x23, 0x24, 0x26, 0x28, 0x28, 
-    0x26, 0x25, 0x26, 0x27, 0x25, 0x21, 0x1C, 0x19, 0x16, 0x15, 0x15, 0x14, 
-    0x14, 0x12, 0x10, 0x0E, 0x0E, 0x0F, 0x10, 0x10, 0x0E, 0x0D, 0x0B, 0x09, 
-    0x09, 0x0D, 0x10, 0x12, 0x12, 0x11, 0x10, 0x10, 0x0F, 0x0D, 0x08, 0x05, 
-    0x05, 0x09, 0x0F, 0x11, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0C, 0x0A, 0x07, 
-    0x05, 0x04, 0x03, 0x04, 0x02, 0xFE, 0xF8, 0xF1, 0xED, 0xEC, 0xEA, 0xE4, 
-    0xDE, 0xDC, 0xDE, 0xE1, 0xE1, 0xDC, 0xD8, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 
-    0xDB, 0xDE, 0xE3, 0xEA, 0xEF, 0xF2, 0xF1, 0xEE, 0xEC, 0xEB, 0xEB, 0xEF, 
-    0xF5, 0xFA, 0xFB, 0xF9, 0xF8, 0xF8, 0xF9, 0xF7, 0xF2, 0xEE, 0xEC, 0xEC, 
-    0xEB, 0xE8, 0xE6, 0xE2, 0xDE, 0xDA, 0xD9, 0xD8, 0xD9, 0xD8, 0xD7, 0xD8, 
-    0xD9, 0xDC, 0xE0, 0xE2, 0xE3, 0xE4, 0xE5, 0xE7, 0xE8, 0xEB, 0xED, 0xF1, 
-    0xF6, 0xF9, 0xFB, 0xFA, 0xFA, 0xF7, 0xF6, 0xF6, 0xFB, 0xFF, 0x01, 0x01, 
-    0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0xFC, 0xF9, 0xF7, 0xF6, 0xF6, 
-    0xF6, 0xF0, 0xE8, 0xE2, 0xDF, 0xE0, 0xE1, 0xE2, 0xE1, 0xE2, 0xE6, 0xE8, 
-    0xE7, 0xE5, 0xE0, 0xDD, 0xDD, 0xE1, 0xE8, 0xEF, 0xF4, 0xF7, 0xF9, 0xFB, 
-    0xFB, 0xF9, 0xF6, 0xF4, 0xF5, 0xF7, 0xFB, 0xFF, 0x02, 0x02, 0xFF, 0xFD, 
-    0xFE, 0x01, 0x03, 0x03, 0x01, 0xFB, 0xF7, 0xF2, 0xF0, 0xEE, 0xED, 0xEE, 
-    0xEF, 0xF2, 0xF6, 0xF9, 0xF9, 0xF8, 0xF7, 0xF9, 0xFC, 0xFE, 0x01, 0x06, 
-    0x0D, 0x12, 0x16, 0x19, 0x1C, 0x20, 0x23, 0x26, 0x28, 0x29, 0x2C, 0x2D, 
-    0x2C, 0x2A, 0x26, 0x24, 0x25, 0x26, 0x27, 0x26, 0x27, 0x26, 0x28, 0x2A, 
-    0x2C, 0x2C, 0x2B, 0x29, 0x26, 0x24, 0x22, 0x23, 0x22, 0x20, 0x1D, 0x1B, 
-    0x1C, 0x1D, 0x1C, 0x1A, 0x16, 0x15, 0x17, 0x1A, 0x1C, 0x1B, 0x19, 0x18, 
-    0x17, 0x18, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x22, 0x21, 0x1F, 0x1B, 0x15, 
-    0x10, 0x0C, 0x0C, 0x0C, 0x0D, 0x0B, 0x09, 0x08, 0x07, 0x08, 0x0A, 0x0A, 
-    0x05, 0xFF, 0xFA, 0xF7, 0xF5, 0xF2, 0xEE, 0xEB, 0xE9, 0xE8, 0xE7, 0xE6, 
-    0xE3, 0xE0, 0xE0, 0xE2, 0xE5, 0xE8, 0xE9, 0xE8, 0xE8, 0xE9, 0xED, 0xF1, 
-    0xF4, 0xF6, 0xF8, 0xF9, 0xFA, 0xFB, 0xFA, 0xF7, 0xF4, 0xF0, 0xED, 0xED, 
-    0xED, 0xEF, 0xF0, 0xF1, 0xF1, 0xF1, 0xF4, 0xF8, 0xFD, 0xFD, 0xFB, 0xF8, 
-    0xF5, 0xF5, 0xF6, 0xF8, 0xF6, 0xF4, 0xF0, 0xEE, 0xEC, 0xEA, 0xE7, 0xE5, 
-    0xE8, 0xEB, 0xEF, 0xF0, 0xEE, 0xEC, 0xE9, 0xE6, 0xE4, 0xE4, 0xE6, 0xE9, 
-    0xEB, 0xED, 0xEE, 0xF0, 0xEF, 0xED, 0xEA, 0xE6, 0xE4, 0xE5, 0xE6, 0xE7, 
-    0xE8, 0xE9, 0xE8, 0xEA, 0xEC, 0xEF, 0xF1, 0xF0, 0xED, 0xE9, 0xE7, 0xE6, 
-    0xE7, 0xE5, 0xE2, 0xE2, 0xE1, 0xE3, 0xE4, 0xE4, 0xE3, 0xE2, 0xE0, 0xE3, 
-    0xE6, 0xEA, 0xEB, 0xEA, 0xE9, 0xE9, 0xEB, 0xED, 0xEE, 0xEF, 0xF1, 0xF7, 
-    0xFD, 0x02, 0x05, 0x05, 0x03, 0x00, 0xFD, 0xF9, 0xF7, 0xF9, 0xFB, 0xFF, 
-    0x04, 0x0A, 0x0F, 0x12, 0x10, 0x0B, 0x05, 0xFF, 0xFB, 0xF9, 0xF9, 0xFB, 
-    0xFF, 0x02, 0x02, 0x00, 0xFD, 0xFB, 0xF9, 0xF5, 0xF1, 0xEF, 0xF0, 0xF2, 
-    0xF4, 0xF2, 0xF2, 0xF3, 0xF6, 0xFB, 0xFE, 0x00, 0x02, 0x04, 0x06, 0x08, 
-    0x07, 0x07, 0x06, 0x08, 0x0A, 0x0D, 0x10, 0x14, 0x17, 0x19, 0x1A, 0x1C, 
-    0x1F, 0x22, 0x25, 0x22, 0x1F, 0x1A, 0x16, 0x15, 0x16, 0x13, 0x0E, 0x09, 
-    0x09, 0x0B, 0x0C, 0x0B, 0x0A, 0x09, 0x0C, 0x10, 0x13, 0x14, 0x15, 0x15, 
-    0x15, 0x19, 0x1C, 0x20, 0x24, 0x27, 0x2C, 0x31, 0x33, 0x34, 0x31, 0x2D, 
-    0x2C, 0x2E, 0x30, 0x31, 0x31, 0x32, 0x34, 0x36, 0x38, 0x38, 0x36, 0x33, 
-    0x32, 0x30, 0x2C, 0x26, 0x20, 0x1B, 0x18, 0x15, 0x10, 0x0C, 0x07, 0x03, 
-    0x01, 0xFF, 0xFD, 0xFB, 0xFB, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC, 0xFB, 
-    0xFA, 0xFC, 0xFE, 0x01, 0x03, 0x03, 0x00, 0xFE, 0xFD, 0xFC, 0xF9, 0xF6, 
-    0xF4, 0xF4, 0xF5, 0xF7, 0xF6, 0xF4, 0xF2, 0xF2, 0xF1, 0xF0, 0xEE, 0xEB, 
-    0xE8, 0xE4, 0xDF, 0xDB, 0xDA, 0xD8, 0xD6, 0xD5, 0xD4, 0xD5, 0xD7, 0xD9, 
-    0xDB, 0xDE, 0xE0, 0xE2, 0xE4, 0xE6, 0xE8, 0xEB, 0xED, 0xF0, 0xF3, 0xF7, 
-    0xFB, 0xFE, 0x01, 0x04, 0x07, 0x07, 0x05, 0x02, 0xFF, 0xFD, 0xFC, 0xFB, 
-    0xFC, 0xFD, 0xFE, 0xFE, 0xFD, 0xFD, 0xFF, 0x00, 0xFF, 0xFC, 0xF8, 0xF4, 
-    0xF1, 0xF0, 0xF0, 0xEF, 0xED, 0xEA, 0xE7, 0xE5, 0xE5, 0xE4, 0xE3, 0xE2, 
-    0xE2, 0xE4, 0xE6, 0xE8, 0xE8, 0xE9, 0xEA, 0xED, 0xF1, 0xF3, 0xF5, 0xF6, 
-    0xF9, 0xFA, 0xF9, 0xF6, 0xF2, 0xEF, 0xED, 0xEC, 0xEC, 0xED, 0xED, 0xEB, 
-    0xE8, 0xE5, 0xE4, 0xE3, 0xE3, 0xE7, 0xEA, 0xED, 0xED, 0xEC, 0xEB, 0xE9, 
-    0xE8, 0xE5, 0xE4, 0xE5, 0xE7, 0xEB, 0xEE, 0xF1, 0xF3, 0xF6, 0xF9, 0xF8, 
-    0xF6, 0xF5, 0xF7, 0xFB, 0xFE, 0x01, 0x03, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 
-    0x0C, 0x09, 0x07, 0x07, 0x08, 0x08, 0x0A, 0x0D, 0x12, 0x18, 0x1A, 0x1A, 
-    0x16, 0x14, 0x14, 0x17, 0x19, 0x19, 0x16, 0x14, 0x15, 0x18, 0x1A, 0x19, 
-    0x15, 0x12, 0x13, 0x15, 0x17, 0x16, 0x15, 0x14, 0x15, 0x15, 0x12, 0x10, 
-    0x0E, 0x0F, 0x12, 0x16, 0x18, 0x1A, 0x1C, 0x1F, 0x23, 0x25, 0x26, 0x25, 
-    0x22, 0x1D, 0x1A, 0x18, 0x18, 0x18, 0x17, 0x17, 0x16, 0x18, 0x1B, 0x1C, 
-    0x1B, 0x19, 0x18, 0x19, 0x18, 0x16, 0x16, 0x16, 0x17, 0x18, 0x18, 0x18, 
-    0x18, 0x19, 0x1A, 0x1A, 0x19, 0x19, 0x18, 0x17, 0x15, 0x13, 0x11, 0x0F, 
-    0x0D, 0x0C, 0x0B, 0x0D, 0x0E, 0x11, 0x12, 0x13, 0x14, 0x13, 0x11, 0x10, 
-    0x11, 0x10, 0x11, 0x13, 0x15, 0x15, 0x14, 0x13, 0x12, 0x11, 0x11, 0x0F, 
-    0x0C, 0x08, 0x04, 0x01, 0xFE, 0xFD, 0xFC, 0xFB, 0xF8, 0xF5, 0xF1, 0xEC, 
-    0xE6, 0xE2, 0xDD, 0xDB, 0xDB, 0xDC, 0xDB, 0xDA, 0xD8, 0xD8, 0xDA, 0xDD, 
-    0xE1, 0xE4, 0xE6, 0xEA, 0xF0, 0xF3, 0xF3, 0xF1, 0xEF, 0xEF, 0xF0, 0xF0, 
-    0xEE, 0xEB, 0xEA, 0xEB, 0xEC, 0xEF, 0xF0, 0xF1, 0xF3, 0xF3, 0xF0, 0xEB, 
-    0xE7, 0xE4, 0xE3, 0xE4, 0xE4, 0xE3, 0xE3, 0xE2, 0xDF, 0xDC, 0xDB, 0xDC, 
-    0xDF, 0xE3, 0xE6, 0xE6, 0xE4, 0xE4, 0xE7, 0xEA, 0xEC, 0xEE, 0xED, 0xEF, 
-    0xF3, 0xF6, 0xF9, 0xFA, 0xFB, 0xFC, 0xFC, 0xFE, 0xFF, 0x01, 0x04, 0x06, 
-    0x06, 0x08, 0x0B, 0x0E, 0x10, 0x0F, 0x0B, 0x06, 0x01, 0xFE, 0xFB, 0xF8, 
-    0xF5, 0xF2, 0xEE, 0xEB, 0xE8, 0xE4, 0xDF, 0xDA, 0xD7, 0xD5, 0xD5, 0xD6, 
-    0xD7, 0xD7, 0xD9, 0xDD, 0xE0, 0xE5, 0xEA, 0xEE, 0xF2, 0xF6, 0xF8, 0xFE, 
-    0x04, 0x07, 0x06, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFC, 0xFB, 0xFC, 
-    0xFE, 0xFF, 0xFF, 0xFE, 0xFA, 0xF6, 0xF4, 0xF0, 0xED, 0xEB, 0xEC, 0xEE, 
-    0xF3, 0xF8, 0xFB, 0xFD, 0xFC, 0xFC, 0xFB, 0xFB, 0xFB, 0xFE, 0x03, 0x08, 
-    0x0C, 0x0E, 0x10, 0x13, 0x16, 0x18, 0x19, 0x1B, 0x20, 0x25, 0x29, 0x2B, 
-    0x2C, 0x2B, 0x2A, 0x29, 0x27, 0x28, 0x29, 0x29, 0x28, 0x27, 0x2A, 0x2B, 
-    0x2C, 0x2C, 0x29, 0x27, 0x25, 0x24, 0x22, 0x1E, 0x1D, 0x1C, 0x1A, 0x1B, 
-    0x1A, 0x19, 0x18, 0x17, 0x16, 0x15, 0x13, 0x12, 0x10, 0x0C, 0x0A, 0x0B, 
-    0x0F, 0x15, 0x19, 0x1B, 0x1D, 0x20, 0x24, 0x27, 0x29, 0x29, 0x27, 0x22, 
-    0x1F, 0x1C, 0x19, 0x15, 0x11, 0x0C, 0x08, 0x07, 0x08, 0x08, 0x05, 0x01, 
-    0xFD, 0xF9, 0xF9, 0xF8, 0xF7, 0xF6, 0xF7, 0xF8, 0xFB, 0xFD, 0xFE, 0xFD, 
-    0xFB, 0xFA, 0xF9, 0xF8, 0xF7, 0xF8, 0xF9, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 
-    0xF8, 0xF6, 0xF5, 0xF4, 0xF5, 0xF6, 0xF7, 0xF6, 0xF6, 0xF5, 0xF6, 0xF7, 
-    0xF8, 0xF8, 0xF7, 0xF6, 0xF5, 0xF7, 0xFA, 0xFC, 0xFD, 0xFB, 0xF9, 0xF9, 
-    0xF8, 0xF5, 0xF1, 0xED, 0xEB, 0xED, 0xEF, 0xEF, 0xEF, 0xED, 0xEB, 0xE9, 
-    0xE6, 0xE5, 0xE4, 0xE3, 0xE0, 0xDA, 0xD6, 0xD7, 0xDB, 0xE0, 0xE3, 0xE3, 
-    0xE4, 0xE6, 0xE8, 0xEB, 0xEE, 0xEF, 0xED, 0xEB, 0xEA, 0xEA, 0xEB, 0xED, 
-    0xEF, 0xEF, 0xEE, 0xEF, 0xF1, 0xF3, 0xF5, 0xF3, 0xF0, 0xED, 0xEC, 0xEB, 
-    0xE9, 0xE8, 0xE6, 0xE6, 0xE7, 0xE8, 0xE9, 0xEC, 0xED, 0xEC, 0xEB, 0xEC, 
-    0xEE, 0xEF, 0xF0, 0xF0, 0xEE, 0xED, 0xED, 0xED, 0xEE, 0xEF, 0xF0, 0xF0, 
-    0xF1, 0xF2, 0xF5, 0xF7, 0xF8, 0xF8, 0xF9, 0xFC, 0xFE, 0xFF, 0xFF, 0x00, 
-    0x01, 0x05, 0x08, 0x0A, 0x0B, 0x09, 0x08, 0x07, 0x08, 0x08, 0x07, 0x02, 
-    0xFF, 0xFD, 0xFB, 0xFC, 0xFB, 0xFA, 0xF8, 0xF4, 0xEF, 0xED, 0xEC, 0xEA, 
-    0xE7, 0xE2, 0xE2, 0xE6, 0xEC, 0xF1, 0xF6, 0xFA, 0xFF, 0x02, 0x03, 0x04, 
-    0x06, 0x08, 0x0A, 0x0B, 0x0C, 0x0F, 0x15, 0x1A, 0x1E, 0x1F, 0x1E, 0x1E, 
-    0x1F, 0x1F, 0x1C, 0x17, 0x14, 0x14, 0x15, 0x14, 0x12, 0x10, 0x0F, 0x11, 
-    0x11, 0x12, 0x13, 0x13, 0x14, 0x13, 0x11, 0x10, 0x12, 0x15, 0x17, 0x18, 
-    0x17, 0x18, 0x1C, 0x1F, 0x22, 0x25, 0x27, 0x2A, 0x2E, 0x31, 0x34, 0x33, 
-    0x31, 0x2E, 0x2C, 0x2A, 0x29, 0x29, 0x28, 0x29, 0x28, 0x2A, 0x2C, 0x2F, 
-    0x30, 0x2D, 0x2B, 0x28, 0x26, 0x23, 0x1E, 0x17, 0x12, 0x0E, 0x0E, 0x0E, 
-    0x0D, 0x09, 0x05, 0x01, 0xFE, 0xFB, 0xF8, 0xF3, 0xEE, 0xEA, 0xE8, 0xE8, 
-    0xEA, 0xEE, 0xF3, 0xF7, 0xF9, 0xFA, 0xFD, 0xFF, 0x02, 0x03, 0x01, 0x00, 
-    0x01, 0x02, 0x03, 0x04, 0x01, 0xFD, 0xF9, 0xF6, 0xF6, 0xF4, 0xF5, 0xF2, 
-    0xF3, 0xF3, 0xF1, 0xF2, 0xEE, 0xEB, 0xE7, 0xE6, 0xE6, 0xE9, 0xEB, 0xEB, 
-    0xED, 0xED, 0xEF, 0xEF, 0xF2, 0xF4, 0xF4, 0xF4, 0xF1, 0xF2, 0xF4, 0xF7, 
-    0xF7, 0xFA, 0xF7, 0xF7, 0xF9, 0xFA, 0xFE, 0xF9, 0xF3, 0xED, 0xEA, 0xEC, 
-    0xE9, 0xEC, 0xED, 0xE9, 0xE9, 0xE9, 0xE9, 0xEB, 0xEC, 0xE8, 0xE6, 0xE2, 
-    0xE5, 0xEA, 0xEE, 0xF0, 0xEF, 0xF4, 0xF9, 0xFF, 0xFE, 0xF3, 0xEB, 0xDF, 
-    0xDE, 0xE9, 0xF0, 0xF5, 0xF3, 0xE8, 0xE2, 0xD8, 0xD8, 0xD9, 0xD8, 0xE0, 
-    0xDD, 0xE8, 0xF1, 0xF9, 0x03, 0x00, 0xFD, 0xF2, 0xEC, 0xEE, 0xEB, 0xFA, 
-    0xF8, 0xFC, 0xFB, 0xF5, 0xF8, 0xF6, 0xF6, 0xEB, 0xE5, 0xDD, 0xE1, 0xDF, 
-    0xEC, 0xF5, 0xFA, 0x07, 0x10, 0x14, 0x1B, 0x20, 0x18, 0x10, 0x0B, 0x0B, 
-    0x0C, 0x12, 0x18, 0x1D, 0x1C, 0x21, 0x1C, 0x1E, 0x18, 0x1C, 0x1C, 0x1B, 
-    0x26, 0x20, 0x21, 0x1A, 0x17, 0x11, 0x11, 0x12, 0x13, 0x14, 0x14, 0x15, 
-    0x14, 0x1B, 0x22, 0x21, 0x23, 0x22, 0x1B, 0x1B, 0x15, 0x14, 0x17, 0x16, 
-    0x1A, 0x22, 0x1E, 0x24, 0x1E, 0x18, 0x16, 0x0D, 0x0E, 0x0B, 0x11, 0x0F, 
-    0x0B, 0x06, 0x0C, 0x0D, 0x10, 0x19, 0x16, 0x19, 0x19, 0x1C, 0x1E, 0x22, 
-    0x25, 0x23, 0x20, 0x20, 0x1F, 0x21, 0x2A, 0x2A, 0x2F, 0x2D, 0x2A, 0x23, 
-    0x15, 0x04, 0xFC, 0xF9, 0xFC, 0x08, 0x0C, 0x0D, 0x05, 0xFF, 0xF7, 0xF9, 
-    0x02, 0x02, 0x02, 0x04, 0xFE, 0xFD, 0x01, 0x04, 0x0B, 0x0B, 0x05, 0xFF, 
-    0xFC, 0xFF, 0x01, 0x07, 0x0E, 0x0A, 0x0C, 0x07, 0x07, 0x03, 0x00, 0x00, 
-    0xFA, 0xFD, 0xF9, 0xFD, 0x00, 0x09, 0x0A, 0x0F, 0x0E, 0x07, 0x08, 0x02, 
-    0x02, 0xFE, 0xFC, 0xF9, 0xF9, 0xF7, 0xF9, 0xF9, 0xF5, 0xF6, 0xF7, 0xF2, 
-    0xEE, 0xEB, 0xDF, 0xDD, 0xDD, 0xDA, 0xDB, 0xD9, 0xD3, 0xD0, 0xCE, 0xD0, 
-    0xD4, 0xD8, 0xD8, 0xD7, 0xD5, 0xD7, 0xDC, 0xDE, 0xE3, 0xE6, 0xE4, 0xE4, 
-    0xE5, 0xED, 0xF1, 0xF9, 0xF9, 0xF2, 0xED, 0xE9, 0xE9, 0xE4, 0xE6, 0xE2, 
-    0xE3, 0xE0, 0xE1, 0xE1, 0xDC, 0xE1, 0xE0, 0xE2, 0xE2, 0xE0, 0xDB, 0xDA, 
-    0xD6, 0xD4, 0xD6, 0xD8, 0xDC, 0xDD, 0xE4, 0xE4, 0xED, 0xF0, 0xF8, 0xFC, 
-    0xFE, 0xFE, 0xF6, 0xF7, 0xED, 0xF0, 0xF7, 0xFF, 0x06, 0x0B, 0x09, 0xFA, 
-    0xF4, 0xED, 0xF0, 0xF3, 0xFB, 0x00, 0x07, 0x07, 0x04, 0x01, 0xFD, 0xFF, 
-    0xF7, 0xF5, 0xF2, 0xEC, 0xEF, 0xF2, 0xFA, 0xFF, 0xF8, 0xF1, 0xE2, 0xDB, 
-    0xDA, 0xD7, 0xDF, 0xE0, 0xE1, 0xE6, 0xE8, 0xEF, 0xF7, 0xFF, 0x06, 0x0B, 
-    0x0F, 0x10, 0x12, 0x14, 0x17, 0x12, 0x18, 0x18, 0x1C, 0x21, 0x24, 0x28, 
-    0x27, 0x26, 0x27, 0x28, 0x21, 0x24, 0x1F, 0x19, 0x15, 0x10, 0x0D, 0x0D, 
-    0x0D, 0x0E, 0x0E, 0x10, 0x0E, 0x13, 0x13, 0x0D, 0x0F, 0x09, 0x0B, 0x11, 
-    0x15, 0x1A, 0x19, 0x1D, 0x1F, 0x20, 0x26, 0x1F, 0x1E, 0x1F, 0x1E, 0x1A, 
-    0x1C, 0x1D, 0x1F, 0x27, 0x22, 0x21, 0x23, 0x25, 0x2E, 0x31, 0x32, 0x32, 
-    0x2C, 0x2C, 0x24, 0x23, 0x20, 0x21, 0x1F, 0x23, 0x21, 0x1E, 0x20, 0x17, 
-    0x20, 0x1E, 0x22, 0x22, 0x15, 0x01, 0xF2, 0xE6, 0xEB, 0xF2, 0xFE, 0x07, 
-    0xFF, 0xFD, 0xED, 0xE7, 0xE6, 0xEB, 0xF4, 0x00, 0x09, 0x0E, 0x0B, 0x06, 
-    0xFE, 0xFA, 0xF7, 0xFD, 0x05, 0x06, 0x11, 0x11, 0x13, 0x11, 0x0B, 0x0A, 
-    0x08, 0xFF, 0xFF, 0xF9, 0xF3, 0xF2, 0xF3, 0xF8, 0xFA, 0xFC, 0x02, 0x01, 
-    0xFE, 0xFB, 0xF6, 0xF4, 0xF0, 0xEF, 0xF2, 0xF8, 0xFB, 0xFC, 0xFB, 0xFB, 
-    0xF7, 0xFC, 0xFA, 0xFA, 0xFC, 0xF6, 0xF9, 0xF8, 0xF4, 0xF2, 0xEE, 0xEB, 
-    0xEA, 0xE9, 0xE9, 0xE6, 0xEE, 0xE8, 0xEC, 0xEA, 0xE8, 0xEA, 0xE5, 0xE9, 
-    0xE3, 0xE3, 0xDE, 0xE1, 0xE0, 0xE6, 0xEC, 0xE8, 0xEE, 0xEA, 0xEB, 0xE9, 
-    0xE4, 0xDC, 0xD9, 0xD5, 0xD9, 0xDC, 0xDB, 0xDF, 0xD8, 0xD6, 0xD5, 0xD4, 
-    0xD4, 0xDB, 0xD8, 0xDC, 0xDA, 0xD6, 0xD3, 0xD0, 0xD5, 0xD5, 0xDC, 0xDF, 
-    0xE8, 0xEC, 0xF7, 0xFE, 0x05, 0x08, 0xFE, 0xF7, 0xEA, 0xE5, 0xE4, 0xEC, 
-    0xF7, 0x02, 0x09, 0x05, 0xFD, 0xED, 0xE2, 0xDD, 0xE4, 0xF3, 0xFF, 0x0B, 
-    0x06, 0x04, 0xFB, 0xF3, 0xF0, 0xF0, 0xF0, 0xFA, 0x00, 0x05, 0x04, 0xFE, 
-    0xF9, 0xF3, 0xF3, 0xEF, 0xF1, 0xEC, 0xEF, 0xEB, 0xEC, 0xEC, 0xF5, 0xF8, 
-    0x01, 0x07, 0x0B, 0x13, 0x10, 0x16, 0x14, 0x1A, 0x1A, 0x1D, 0x1E, 0x1F, 
-    0x1E, 0x1D, 0x20, 0x1A, 0x1C, 0x1B, 0x1A, 0x1C, 0x1E, 0x18, 0x14, 0x11, 
-    0x0A, 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x04, 0x02, 0x00, 0x00, 0xFE, 
-    0x00, 0x00, 0x03, 0x05, 0x09, 0x0E, 0x10, 0x17, 0x19, 0x1E, 0x22, 0x22, 
-    0x26, 0x27, 0x26, 0x20, 0x1C, 0x18, 0x15, 0x17, 0x19, 0x1C, 0x1E, 0x1F, 
-    0x24, 0x23, 0x22, 0x25, 0x25, 0x27, 0x24, 0x20, 0x1B, 0x16, 0x14, 0x15, 
-    0x1B, 0x1D, 0x21, 0x22, 0x21, 0x27, 0x24, 0x26, 0x22, 0x18, 0x0D, 0xFF, 
-    0xF8, 0xF5, 0xFD, 0x07, 0x11, 0x0F, 0x0C, 0x01, 0xF2, 0xEE, 0xEB, 0xF2, 
-    0x03, 0x14, 0x20, 0x25, 0x1C, 0x10, 0xFF, 0xF7, 0xF3, 0xF4, 0xFF, 0x07, 
-    0x0F, 0x12, 0x0E, 0x01, 0xF7, 0xEE, 0xE6, 0xE9, 0xEB, 0xF0, 0xF4, 0xF2, 
-    0xF1, 0xF2, 0xF1, 0xF1, 0xF0, 0xF2, 0xF5, 0xF3, 0xF4, 0xF2, 0xF1, 0xF1, 
-    0xF1, 0xF2, 0xF4, 0xF8, 0xFD, 0x01, 0x04, 0x05, 0x02, 0xFB, 0xF7, 0xEE, 
-    0xEB, 0xE9, 0xE5, 0xE8, 0xE6, 0xEA, 0xED, 0xEF, 0xEE, 0xEE, 0xEB, 0xE7, 
-    0xE7, 0xE5, 0xE2, 0xDD, 0xDA, 0xDC, 0xDD, 0xE0, 0xE1, 0xE4, 0xE7, 0xEB, 
-    0xF0, 0xEF, 0xEE, 0xE8, 0xEA, 0xE8, 0xEA, 0xEB, 0xE7, 0xE7, 0xE5, 0xE5, 
-    0xE3, 0xE2, 0xE2, 0xDF, 0xDF, 0xE1, 0xE0, 0xE4, 0xE4, 0xE1, 0xDD, 0xD9, 
-    0xD9, 0xD8, 0xDB, 0xE0, 0xE3, 0xE9, 0xED, 0xF0, 0xF6, 0xF7, 0xF6, 0xF5, 
-    0xEE, 0xE6, 0xDF, 0xDC, 0xE4, 0xED, 0xF9, 0x00, 0xFD, 0xF4, 0xE9, 0xDE, 
-    0xD7, 0xD7, 0xE0, 0xED, 0xFF, 0x0C, 0x0F, 0x0E, 0x01, 0xF3, 0xE7, 0xE2, 
-    0xE9, 0xF2, 0x03, 0x0E, 0x14, 0x14, 0x08, 0xFD, 0xED, 0xE1, 0xDE, 0xDF, 
-    0xE8, 0xF6, 0x03, 0x07, 0x0A, 0x07, 0x01, 0x00, 0x01, 0x05, 0x0A, 0x12, 
-    0x1D, 0x24, 0x26, 0x25, 0x20, 0x1C, 0x1C, 0x1D, 0x1F, 0x24, 0x23, 0x22, 
-    0x1F, 0x17, 0x16, 0x12, 0x0B, 0x0B, 0x0B, 0x0D, 0x10, 0x13, 0x16, 0x17, 
-    0x18, 0x16, 0x0E, 0x0A, 0x08, 0x05, 0x0B, 0x0C, 0x10, 0x14, 0x12, 0x17, 
-    0x14, 0x12, 0x14, 0x13, 0x14, 0x19, 0x19, 0x1B, 0x1C, 0x1A, 0x18, 0x17, 
-    0x14, 0x10, 0x12, 0x13, 0x17, 0x1C, 0x1F, 0x21, 0x22, 0x20, 0x20, 0x1F, 
-    0x1E, 0x1D, 0x1A, 0x19, 0x19, 0x1F, 0x27, 0x2A, 0x2E, 0x2E, 0x2D, 0x2D, 
-    0x28, 0x22, 0x17, 0x0A, 0x02, 0xFC, 0x00, 0x06, 0x0D, 0x17, 0x16, 0x0F, 
-    0x01, 0xF4, 0xE8, 0xE4, 0xEB, 0xF6, 0x0C, 0x1B, 0x26, 0x28, 0x20, 0x11, 
-    0xFF, 0xF3, 0xEE, 0xF7, 0x02, 0x12, 0x1D, 0x23, 0x23, 0x16, 0x07, 0xF4, 
-    0xE4, 0xDF, 0xE1, 0xEC, 0xFB, 0x08, 0x14, 0x13, 0x0E, 0x06, 0xF9, 0xEF, 
-    0xEA, 0xEB, 0xEF, 0xF7, 0x00, 0x07, 0x04, 0xFF, 0xF6, 0xED, 0xE9, 0xE6, 
-    0xE9, 0xEE, 0xF3, 0xF6, 0xF4, 0xEF, 0xE8, 0xE2, 0xDE, 0xDE, 0xE1, 0xE5, 
-    0xED, 0xF2, 0xF4, 0xF3, 0xEC, 0xE7, 0xE3, 0xE1, 0xDE, 0xDF, 0xE1, 0xE2, 
-    0xE9, 0xEA, 0xEC, 0xEC, 0xE9, 0xE8, 0xE8, 0xE8, 0xEA, 0xEC, 0xEC, 0xEF, 
-    0xF3, 0xF3, 0xF2, 0xED, 0xE5, 0xDF, 0xDD, 0xDD, 0xE2, 0xE6, 0xE8, 0xEC, 
-    0xE6, 0xE3, 0xDE, 0xD7, 0xD2, 0xCF, 0xD1, 0xD6, 0xDF, 0xEC, 0xF5, 0xFB, 
-    0xFC, 0xFB, 0xF7, 0xF2, 0xEA, 0xE4, 0xE4, 0xE4, 0xF0, 0xF9, 0x07, 0x11, 
-    0x11, 0x0F, 0x04, 0xF7, 0xEA, 0xE1, 0xE0, 0xE5, 0xF0, 0x00, 0x07, 0x0D, 
-    0x09, 0x00, 0xF0, 0xE1, 0xDC, 0xDB, 0xE4, 0xF4, 0x00, 0x0C, 0x13, 0x11, 
-    0x0B, 0xFC, 0xEF, 0xE2, 0xDB, 0xDD, 0xE4, 0xF2, 0x03, 0x0E, 0x12, 0x0D, 
-    0x08, 0x01, 0xFB, 0xF9, 0xFB, 0x03, 0x0A, 0x18, 0x1F, 0x27, 0x2C, 0x28, 
-    0x24, 0x1D, 0x15, 0x14, 0x16, 0x19, 0x20, 0x22, 0x22, 0x21, 0x1D, 0x18, 
-    0x13, 0x10, 0x11, 0x10, 0x13, 0x14, 0x14, 0x13, 0x11, 0x0C, 0x07, 0x07, 
-    0x06, 0x08, 0x0A, 0x0E, 0x10, 0x15, 0x18, 0x1A, 0x17, 0x16, 0x17, 0x19, 
-    0x1C, 0x1D, 0x1D, 0x1C, 0x1F, 0x1D, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x20, 
-    0x25, 0x27, 0x27, 0x27, 0x23, 0x22, 0x1F, 0x1E, 0x1E, 0x22, 0x24, 0x27, 
-    0x2C, 0x30, 0x32, 0x32, 0x30, 0x24, 0x17, 0x0C, 0x00, 0xFC, 0xFD, 0x00, 
-    0x07, 0x0C, 0x0F, 0x0C, 0x01, 0xF3, 0xE4, 0xDA, 0xDB, 0xE1, 0xF0, 0x01, 
-    0x0D, 0x13, 0x11, 0x09, 0x00, 0xFA, 0xF5, 0xF4, 0xFB, 0x06, 0x13, 0x20, 
-    0x25, 0x25, 0x22, 0x1A, 0x0D, 0x01, 0xF7, 0xEF, 0xEF, 0xF3, 0xF9, 0x01, 
-    0x08, 0x07, 0x05, 0xFA, 0xF0, 0xE7, 0xDE, 0xDF, 0xE2, 0xEA, 0xF0, 0xF9, 
-    0xFF, 0x02, 0xFF, 0xFA, 0xF0, 0xE9, 0xE6, 0xE6, 0xEB, 0xEE, 0xF7, 0xFA, 
-    0x00, 0xFF, 0xFC, 0xFB, 0xF6, 0xEF, 0xE9, 0xE5, 0xE3, 0xE5, 0xE5, 0xE7, 
-    0xE7, 0xE4, 0xE5, 0xE4, 0xE3, 0xE1, 0xDF, 0xDF, 0xE0, 0xE3, 0xE5, 0xE7, 
-    0xE9, 0xE8, 0xE6, 0xE2, 0xDF, 0xDF, 0xDC, 0xDB, 0xD8, 0xDA, 0xDE, 0xE3, 
-    0xE6, 0xE5, 0xE4, 0xDE, 0xDE, 0xDE, 0xDD, 0xDB, 0xD8, 0xD7, 0xD8, 0xDC, 
-    0xE3, 0xE9, 0xEE, 0xF0, 0xF2, 0xF3, 0xF2, 0xF1, 0xEF, 0xEA, 0xE6, 0xE7, 
-    0xEC, 0xF6, 0x03, 0x0D, 0x10, 0x0D, 0x03, 0xF9, 0xEE, 0xE4, 0xDB, 0xD9, 
-    0xDF, 0xEC, 0xF9, 0x05, 0x0B, 0x05, 0xFB, 0xED, 0xE1, 0xD8, 0xD5, 0xDB, 
-    0xE5, 0xF2, 0x00, 0x0E, 0x15, 0x11, 0x07, 0xF5, 0xE7, 0xE1, 0xE0, 0xE7, 
-    0xF5, 0x00, 0x0B, 0x12, 0x11, 0x0F, 0x05, 0xFB, 0xF3, 0xF0, 0xF5, 0xFC, 
-    0x09, 0x17, 0x21, 0x27, 0x26, 0x1F, 0x18, 0x13, 0x0C, 0x08, 0x05, 0x05, 
-    0x0D, 0x14, 0x1C, 0x19, 0x18, 0x15, 0x13, 0x16, 0x10, 0x0E, 0x08, 0x04, 
-    0x07, 0x0B, 0x0D, 0x10, 0x11, 0x11, 0x12, 0x11, 0x13, 0x14, 0x14, 0x12, 
-    0x14, 0x16, 0x19, 0x1D, 0x1E, 0x21, 0x21, 0x21, 0x20, 0x1C, 0x19, 0x16, 
-    0x17, 0x1B, 0x1F, 0x23, 0x24, 0x21, 0x1C, 0x15, 0x11, 0x0D, 0x0E, 0x0D, 
-    0x10, 0x15, 0x19, 0x21, 0x26, 0x2B, 0x2B, 0x2A, 0x26, 0x20, 0x1F, 0x1A, 
-    0x14, 0x0F, 0x0B, 0x10, 0x14, 0x1B, 0x20, 0x21, 0x1D, 0x11, 0x00, 0xEF, 
-    0xE4, 0xE0, 0xE4, 0xED, 0xFC, 0x09, 0x16, 0x1C, 0x19, 0x10, 0x02, 0xF8, 
-    0xEF, 0xEF, 0xF5, 0xFF, 0x0D, 0x18, 0x1F, 0x20, 0x1A, 0x0F, 0xFF, 0xF1, 
-    0xE8, 0xE7, 0xEC, 0xF6, 0xFF, 0x07, 0x0A, 0x04, 0xFD, 0xF3, 0xE8, 0xE0, 
-    0xDA, 0xD9, 0xE0, 0xE9, 0xF0, 0xF8, 0x00, 0xFF, 0xFC, 0xF5, 0xEE, 0xED, 
-    0xEB, 0xED, 0xF0, 0xF7, 0xFD, 0x02, 0x05, 0x04, 0x00, 0xFC, 0xF6, 0xEF, 
-    0xE9, 0xE3, 0xDD, 0xDC, 0xDF, 0xE4, 0xE7, 0xE6, 0xE3, 0xDE, 0xDB, 0xDA, 
-    0xD8, 0xDA, 0xDC, 0xDD, 0xDF, 0xDF, 0xE1, 0xE1, 0xE4, 0xE3, 0xE3, 0xE2, 
-    0xE1, 0xE4, 0xE7, 0xED, 0xF2, 0xF5, 0xF5, 0xF6, 0xF4, 0xF2, 0xED, 0xE9, 
-    0xE4, 0xE3, 0xE2, 0xE5, 0xE8, 0xEC, 0xEF, 0xEF, 0xF0, 0xEF, 0xED, 0xE7, 
-    0xDE, 0xD6, 0xD2, 0xD5, 0xDE, 0xE7, 0xF0, 0xF7, 0xFD, 0x03, 0x06, 0x00, 
-    0xF7, 0xEB, 0xE1, 0xDF, 0xE2, 0xEC, 0xF9, 0x03, 0x09, 0x0C, 0x0A, 0x05, 
-    0xFE, 0xF5, 0xED, 0xE7, 0xE8, 0xEB, 0xF2, 0xFC, 0x03, 0x06, 0x05, 0xFE, 
-    0xF7, 0xF1, 0xEC, 0xEC, 0xEC, 0xED, 0xF0, 0xF6, 0xFD, 0xFF, 0xFD, 0xF6, 
-    0xEF, 0xEE, 0xF1, 0xF4, 0xF6, 0xF7, 0xF9, 0x02, 0x0C, 0x15, 0x18, 0x15, 
-    0x13, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1F, 0x22, 0x26, 0x28, 0x29, 
-    0x28, 0x25, 0x22, 0x20, 0x1D, 0x1C, 0x19, 0x17, 0x16, 0x15, 0x16, 0x15, 
-    0x14, 0x13, 0x13, 0x15, 0x17, 0x16, 0x14, 0x11, 0x0D, 0x0A, 0x0A, 0x0B, 
-    0x0E, 0x12, 0x12, 0x13, 0x15, 0x19, 0x1C, 0x21, 0x22, 0x21, 0x1E, 0x1A, 
-    0x18, 0x18, 0x1A, 0x1C, 0x1D, 0x1E, 0x21, 0x26, 0x2A, 0x2D, 0x2E, 0x2D, 
-    0x2B, 0x27, 0x22, 0x1E, 0x1B, 0x17, 0x12, 0x11, 0x16, 0x1D, 0x26, 0x28, 
-    0x24, 0x1B, 0x10, 0x02, 0xF2, 0xE5, 0xDF, 0xDF, 0xE6, 0xF4, 0x00, 0x09, 
-    0x08, 0x01, 0xF9, 0xF2, 0xEB, 0xE5, 0xE1, 0xE2, 0xEB, 0xF8, 0x06, 0x12, 
-    0x19, 0x17, 0x12, 0x09, 0x02, 0xFE, 0xFE, 0x02, 0x09, 0x11, 0x15, 0x15, 
-    0x12, 0x0D, 0x06, 0xFC, 0xF2, 0xEA, 0xE9, 0xEE, 0xF2, 0xF4, 0xF5, 0xF4, 
-    0xF3, 0xEF, 0xE9, 0xE3, 0xE0, 0xE1, 0xE4, 0xE9, 0xEE, 0xF3, 0xF4, 0xF3, 
-    0xF1, 0xF2, 0xF4, 0xF4, 0xF2, 0xEE, 0xEE, 0xEE, 0xF0, 0xF2, 0xF1, 0xEF, 
-    0xEC, 0xE9, 0xE8, 0xEA, 0xEE, 0xEF, 0xEE, 0xEC, 0xEA, 0xE8, 0xE5, 0xE3, 
-    0xDF, 0xDB, 0xD9, 0xD9, 0xDC, 0xE1, 0xE6, 0xE7, 0xE6, 0xE4, 0xE3, 0xE2, 
-    0xE1, 0xDD, 0xD8, 0xD6, 0xD7, 0xDC, 0xE4, 0xE7, 0xE6, 0xE2, 0xDE, 0xE0, 
-    0xE3, 0xE5, 0xE4, 0xE4, 0xE3, 0xE5, 0xE6, 0xE5, 0xE4, 0xE6, 0xEB, 0xF1, 
-    0xF8, 0xFF, 0x05, 0x09, 0x09, 0x04, 0xFB, 0xF4, 0xF2, 0xF6, 0xFB, 0xFF, 
-    0x02, 0x07, 0x0B, 0x0F, 0x0D, 0x07, 0xFE, 0xF4, 0xEC, 0xE9, 0xEA, 0xEC, 
-    0xF0, 0xF2, 0xF5, 0xFA, 0xFD, 0xFE, 0xFA, 0xF3, 0xEC, 0xE9, 0xE9, 0xEC, 
-    0xEE, 0xF0, 0xF1, 0xF3, 0xF7, 0xFB, 0xFD, 0xFD, 0xFC, 0xFB, 0xFA, 0xFC, 
-    0x02, 0x07, 0x0D, 0x10, 0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x17, 0x18, 
-    0x19, 0x1A, 0x1B, 0x1D, 0x1E, 0x1D, 0x1D, 0x1C, 0x1C, 0x19, 0x14, 0x10, 
-    0x0D, 0x0C, 0x0C, 0x0A, 0x07, 0x06, 0x09, 0x0E, 0x10, 0x11, 0x10, 0x0F, 
-    0x0E, 0x0D, 0x0C, 0x0E, 0x11, 0x14, 0x16, 0x17, 0x19, 0x1C, 0x21, 0x25, 
-    0x27, 0x26, 0x23, 0x21, 0x22, 0x22, 0x21, 0x22, 0x22, 0x24, 0x27, 0x28, 
-    0x29, 0x27, 0x25, 0x24, 0x23, 0x25, 0x26, 0x22, 0x1A, 0x13, 0x0F, 0x0F, 
-    0x10, 0x13, 0x16, 0x1A, 0x1D, 0x1F, 0x1D, 0x15, 0x0A, 0xFF, 0xF5, 0xF1, 
-    0xF1, 0xF4, 0xFC, 0x05, 0x0C, 0x0E, 0x0B, 0x06, 0x00, 0xFA, 0xF2, 0xEA, 
-    0xE8, 0xEA, 0xF1, 0xF9, 0xFF, 0x03, 0x03, 0x00, 0xFE, 0xFA, 0xF7, 0xF5, 
-    0xF1, 0xEE, 0xEF, 0xF2, 0xF7, 0xF7, 0xF4, 0xEF, 0xEC, 0xEC, 0xED, 0xEC, 
-    0xEA, 0xE8, 0xE9, 0xEC, 0xF0, 0xF3, 0xF4, 0xF3, 0xF1, 0xF1, 0xF1, 0xF2, 
-    0xF3, 0xF4, 0xF5, 0xF8, 0xFB, 0x00, 0x03, 0x05, 0x04, 0x01, 0xFF, 0xFE, 
-    0xFD, 0xF9, 0xF6, 0xF2, 0xF0, 0xEF, 0xF0, 0xF2, 0xF2, 0xF0, 0xEB, 0xE7, 
-    0xE4, 0xE2, 0xE1, 0xDF, 0xDD, 0xDD, 0xDF, 0xE0, 0xE1, 0xE0, 0xDF, 0xDE, 
-    0xDD, 0xDB, 0xDB, 0xDC, 0xDE, 0xE0, 0xE1, 0xE2, 0xE4, 0xE6, 0xE7, 0xE8, 
-    0xE9, 0xEA, 0xEC, 0xEE, 0xF0, 0xF3, 0xF5, 0xF4, 0xF2, 0xEE, 0xEA, 0xE5, 
-    0xE1, 0xDE, 0xDD, 0xDF, 0xE5, 0xEC, 0xF2, 0xF4, 0xF1, 0xEC, 0xE7, 0xE4, 
-    0xE1, 0xDD, 0xDD, 0xE1, 0xE9, 0xF2, 0xF8, 0xFC, 0xFF, 0xFF, 0xFE, 0xFC, 
-    0xF7, 0xF4, 0xF2, 0xF5, 0xFA, 0x00, 0x04, 0x06, 0x09, 0x09, 0x07, 0x05, 
-    0x03, 0x03, 0x04, 0x03, 0x00, 0xFC, 0xF9, 0xF7, 0xF7, 0xF6, 0xF7, 0xF7, 
-    0xF7, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFF, 0x00, 0x01, 0x04, 0x06, 0x08, 
-    0x0A, 0x0A, 0x0D, 0x11, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1D, 0x1F, 0x20, 
-    0x1F, 0x20, 0x1F, 0x1F, 0x1E, 0x1D, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 
-    0x1E, 0x1D, 0x1D, 0x1B, 0x19, 0x18, 0x17, 0x15, 0x14, 0x12, 0x12, 0x10, 
-    0x0F, 0x0D, 0x0B, 0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x11, 0x15, 0x18, 
-    0x1A, 0x1B, 0x1C, 0x1C, 0x1B, 0x1D, 0x21, 0x26, 0x2A, 0x2C, 0x2A, 0x29, 
-    0x26, 0x21, 0x1B, 0x16, 0x14, 0x17, 0x1D, 0x23, 0x29, 0x2D, 0x2D, 0x2A, 
-    0x23, 0x1A, 0x0F, 0x07, 0x03, 0x04, 0x09, 0x0E, 0x13, 0x18, 0x1A, 0x17, 
-    0x0E, 0x02, 0xF7, 0xF1, 0xEE, 0xED, 0xEF, 0xF3, 0xFA, 0x00, 0x03, 0x03, 
-    0xFF, 0xFA, 0xF6, 0xF3, 0xEF, 0xEB, 0xE9, 0xE7, 0xE7, 0xE8, 0xE9, 0xEB, 
-    0xEC, 0xEB, 0xEA, 0xE9, 0xE8, 0xE8, 0xEC, 0xF4, 0xF7, 0xF6, 0xF9, 0xFC, 
-    0xF9, 0xF5, 0xF3, 0xF1, 0xEF, 0xEB, 0xE8, 0xEB, 0xED, 0xF1, 0xF1, 0xF3, 
-    0xF3, 0xF1, 0xF4, 0xF1, 0xF0, 0xEF, 0xF0, 0xED, 0xEE, 0xF1, 0xEE, 0xF0, 
-    0xF2, 0xF2, 0xF0, 0xEE, 0xED, 0xEA, 0xEE, 0xF0, 0xEF, 0xEB, 0xE8, 0xEA, 
-    0xE9, 0xEB, 0xE8, 0xE5, 0xE4, 0xE6, 0xE3, 0xE8, 0xEA, 0xEA, 0xEF, 0xEE, 
-    0xF2, 0xEF, 0xEF, 0xF2, 0xF5, 0xF5, 0xF2, 0xF8, 0xFB, 0xFB, 0xF9, 0xF8, 
-    0xF7, 0xF9, 0xFB, 0xF4, 0xF5, 0xEF, 0xEC, 0xF1, 0xEC, 0xE3, 0xE1, 0xE5, 
-    0xEA, 0xE8, 0xE4, 0xE4, 0xE1, 0xE1, 0xE3, 0xE8, 0xF0, 0xF1, 0xF4, 0xF9, 
-    0xFA, 0x01, 0x00, 0x00, 0x05, 0x03, 0x05, 0x04, 0x05, 0x05, 0x03, 0x01, 
-    0xFF, 0xFE, 0xFC, 0xF9, 0xF5, 0xF0, 0xED, 0xEC, 0xE9, 0xE7, 0xE3, 0xDE, 
-    0xD8, 0xD9, 0xDD, 0xDE, 0xDA, 0xD6, 0xD8, 0xDA, 0xDD, 0xDF, 0xE2, 0xE3, 
-    0xE5, 0xE9, 0xEA, 0xF0, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 0xF9, 0xFE, 0x05, 
-    0x08, 0x0A, 0x0E, 0x12, 0x16, 0x16, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 
-    0x17, 0x19, 0x1D, 0x1D, 0x1C, 0x1C, 0x1C, 0x20, 0x22, 0x25, 0x28, 0x2A, 
-    0x2C, 0x2E, 0x2F, 0x2E, 0x2B, 0x27, 0x26, 0x26, 0x24, 0x22, 0x24, 0x27, 
-    0x2E, 0x34, 0x38, 0x3A, 0x3C, 0x3C, 0x39, 0x37, 0x37, 0x39, 0x39, 0x38, 
-    0x3B, 0x3E, 0x40, 0x3F, 0x3D, 0x3A, 0x36, 0x33, 0x32, 0x31, 0x31, 0x2E, 
-    0x2C, 0x29, 0x27, 0x26, 0x21, 0x1C, 0x15, 0x11, 0x0D, 0x0B, 0x0C, 0x0E, 
-    0x10, 0x0E, 0x0B, 0x07, 0x05, 0x05, 0x04, 0x00, 0xFD, 0xFA, 0xF9, 0xF9, 
-    0xF9, 0xF7, 0xF4, 0xF2, 0xEE, 0xEA, 0xE6, 0xE1, 0xDD, 0xD9, 0xD7, 0xD6, 
-    0xD5, 0xD4, 0xD1, 0xCF, 0xCE, 0xCC, 0xC9, 0xC8, 0xC7, 0xC8, 0xCB, 0xCC, 
-    0xCE, 0xD0, 0xD2, 0xD4, 0xD4, 0xD3, 0xD3, 0xD4, 0xD4, 0xD7, 0xD9, 0xD9, 
-    0xDA, 0xDC, 0xDF, 0xE1, 0xE0, 0xDD, 0xDD, 0xE0, 0xE5, 0xEC, 0xEF, 0xF2, 
-    0xF4, 0xF6, 0xFB, 0xFC, 0xFE, 0xFD, 0xFC, 0xFD, 0xFC, 0xFB, 0xFD, 0x00, 
-    0x03, 0x04, 0x04, 0x04, 0x05, 0x08, 0x08, 0x06, 0x03, 0x01, 0x01, 0xFF, 
-    0xFE, 0xFC, 0xFA, 0xF9, 0xF9, 0xFB, 0xFD, 0x00, 0x00, 0x01, 0x01, 0x02, 
-    0x05, 0x07, 0x06, 0x05, 0x07, 0x08, 0x09, 0x08, 0x08, 0x09, 0x0A, 0x0A, 
-    0x09, 0x08, 0x07, 0x06, 0x04, 0x02, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xF9, 
-    0xF8, 0xF9, 0xFA, 0xFA, 0xF8, 0xF5, 0xF4, 0xF5, 0xF7, 0xFA, 0xFC, 0xFB, 
-    0xF9, 0xF5, 0xF4, 0xF2, 0xEF, 0xEC, 0xEA, 0xE8, 0xE4, 0xE2, 0xE0, 0xDE, 
-    0xDD, 0xDC, 0xDD, 0xDE, 0xE0, 0xE1, 0xE0, 0xDE, 0xDB, 0xD9, 0xD9, 0xD7, 
-    0xD7, 0xD8, 0xD9, 0xD9, 0xDC, 0xDE, 0xE0, 0xE2, 0xE2, 0xE3, 0xE4, 0xE6, 
-    0xE6, 0xE8, 0xEA, 0xED, 0xF0, 0xF1, 0xF1, 0xEF, 0xEE, 0xEF, 0xF2, 0xF5, 
-    0xF6, 0xF8, 0xFD, 0x01, 0x02, 0xFF, 0xFE, 0xFE, 0x01, 0x04, 0x06, 0x0A, 
-    0x0D, 0x11, 0x16, 0x1D, 0x21, 0x23, 0x23, 0x24, 0x23, 0x21, 0x21, 0x21, 
-    0x23, 0x25, 0x26, 0x28, 0x2A, 0x2D, 0x2E, 0x30, 0x30, 0x30, 0x33, 0x34, 
-    0x35, 0x34, 0x34, 0x35, 0x37, 0x39, 0x3C, 0x3D, 0x3C, 0x3B, 0x3B, 0x3F, 
-    0x41, 0x42, 0x42, 0x40, 0x40, 0x3F, 0x3D, 0x39, 0x34, 0x31, 0x2F, 0x2F, 
-    0x30, 0x32, 0x34, 0x33, 0x2E, 0x29, 0x26, 0x26, 0x27, 0x27, 0x24, 0x20, 
-    0x1E, 0x1D, 0x1B, 0x18, 0x13, 0x10, 0x0F, 0x0C, 0x0A, 0x07, 0x05, 0x04, 
-    0x04, 0x02, 0x00, 0xFC, 0xF8, 0xF4, 0xED, 0xE8, 0xE6, 0xE6, 0xE7, 0xE4, 
-    0xE1, 0xE0, 0xE1, 0xE3, 0xE5, 0xE4, 0xE1, 0xE0, 0xE1, 0xE3, 0xE2, 0xE0, 
-    0xDE, 0xDD, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDA, 0xD9, 0xDA, 0xDB, 0xDD, 
-    0xE1, 0xE5, 0xE7, 0xE8, 0xE7, 0xE6, 0xE5, 0xE3, 0xE0, 0xDC, 0xD9, 0xD8, 
-    0xD9, 0xDB, 0xDE, 0xDF, 0xDF, 0xE0, 0xE0, 0xE1, 0xE0, 0xDF, 0xDB, 0xD9, 
-    0xDA, 0xDC, 0xDF, 0xE1, 0xE1, 0xE0, 0xE1, 0xE5, 0xE9, 0xED, 0xED, 0xEA, 
-    0xE6, 0xE6, 0xE8, 0xEB, 0xED, 0xEF, 0xF0, 0xF1, 0xF3, 0xF5, 0xF7, 0xF7, 
-    0xF8, 0xFA, 0xFE, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05, 0x03, 0x02, 0x02, 
-    0x00, 0x00, 0xFF, 0x01, 0x05, 0x08, 0x09, 0x09, 0x08, 0x08, 0x0C, 0x11, 
-    0x16, 0x19, 0x1A, 0x19, 0x1B, 0x1C, 0x1B, 0x18, 0x16, 0x14, 0x13, 0x12, 
-    0x14, 0x16, 0x16, 0x16, 0x15, 0x16, 0x15, 0x16, 0x14, 0x10, 0x0B, 0x07, 
-    0x07, 0x07, 0x08, 0x09, 0x08, 0x08, 0x0A, 0x0B, 0x0D, 0x0E, 0x0C, 0x0B, 
-    0x0A, 0x08, 0x06, 0x02, 0xFF, 0xFB, 0xF9, 0xFB, 0xFE, 0x01, 0x03, 0x04, 
-    0x04, 0x06, 0x08, 0x09, 0x09, 0x09, 0x07, 0x03, 0xFE, 0xF7, 0xF4, 0xF4, 
-    0xF7, 0xFB, 0xFD, 0xFF, 0x00, 0x01, 0x02, 0x04, 0x02, 0xFD, 0xF8, 0xF5, 
-    0xF5, 0xF8, 0xFA, 0xFA, 0xF9, 0xFA, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x02, 
-    0x04, 0x06, 0x06, 0x02, 0xFE, 0xFD, 0x01, 0x05, 0x09, 0x09, 0x0A, 0x0B, 
-    0x0E, 0x11, 0x14, 0x17, 0x18, 0x18, 0x14, 0x11, 0x0F, 0x0E, 0x0C, 0x09, 
-    0x06, 0x04, 0x06, 0x07, 0x06, 0x03, 0x02, 0x02, 0x03, 0x05, 0x04, 0x04, 
-    0x03, 0x04, 0x03, 0x05, 0x07, 0x0A, 0x0C, 0x09, 0x06, 0x01, 0xFD, 0xFA, 
-    0xF7, 0xF3, 0xF1, 0xF2, 0xF4, 0xF7, 0xFA, 0xFA, 0xF9, 0xF8, 0xF8, 0xFA, 
-    0xFA, 0xFA, 0xF7, 0xF3, 0xEF, 0xEC, 0xEB, 0xEC, 0xEE, 0xF1, 0xF2, 0xF1, 
-    0xF0, 0xF1, 0xF4, 0xF7, 0xF6, 0xF2, 0xEF, 0xF0, 0xF3, 0xF7, 0xF9, 0xF8, 
-    0xF6, 0xF7, 0xFB, 0xFF, 0x00, 0x01, 0x03, 0x05, 0x07, 0x08, 0x06, 0x03, 
-    0xFF, 0x00, 0x04, 0x0A, 0x0E, 0x11, 0x12, 0x14, 0x16, 0x18, 0x18, 0x16, 
-    0x12, 0x0F, 0x0C, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 
-    0x0F, 0x0F, 0x0C, 0x09, 0x08, 0x0B, 0x0D, 0x0F, 0x0B, 0x07, 0x04, 0x04, 
-    0x05, 0x06, 0x04, 0x03, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFC, 0xFA, 0xF9, 
-    0xFA, 0xFB, 0xFE, 0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFC, 0xFB, 0xF8, 0xF6, 
-    0xF3, 0xF1, 0xF0, 0xF1, 0xF3, 0xF5, 0xF8, 0xFA, 0xFD, 0xFF, 0x00, 0xFF, 
-    0xFB, 0xF8, 0xF6, 0xF7, 0xF7, 0xF8, 0xF6, 0xF2, 0xEF, 0xED, 0xEE, 0xED, 
-    0xEC, 0xEB, 0xEB, 0xED, 0xEF, 0xF0, 0xED, 0xE9, 0xE4, 0xE4, 0xE9, 0xEE, 
-    0xF1, 0xF2, 0xF1, 0xF2, 0xF4, 0xF5, 0xF6, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0, 
-    0xEF, 0xED, 0xED, 0xED, 0xEF, 0xF2, 0xF3, 0xF4, 0xF6, 0xF7, 0xF8, 0xF9, 
-    0xF8, 0xFA, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 
-    0xF8, 0xF6, 0xF2, 0xF0, 0xED, 0xEB, 0xEC, 0xEE, 0xF5, 0xFB, 0x01, 0x03, 
-    0x03, 0x05, 0x07, 0x09, 0x0B, 0x09, 0x07, 0x04, 0x02, 0x02, 0x01, 0x03, 
-    0x04, 0x05, 0x06, 0x06, 0x08, 0x0C, 0x10, 0x11, 0x12, 0x12, 0x13, 0x15, 
-    0x17, 0x16, 0x13, 0x0D, 0x0B, 0x0D, 0x0F, 0x11, 0x0F, 0x0D, 0x0E, 0x0E, 
-    0x0E, 0x0C, 0x0A, 0x09, 0x0C, 0x0F, 0x12, 0x15, 0x18, 0x1C, 0x1F, 0x20, 
-    0x21, 0x21, 0x21, 0x1F, 0x1B, 0x16, 0x12, 0x11, 0x0E, 0x0A, 0x06, 0x04, 
-    0x02, 0xFF, 0xFB, 0xF7, 0xF7, 0xF9, 0xFA, 0xFA, 0xFB, 0xFB, 0xFD, 0xFE, 
-    0xFC, 0xF9, 0xF5, 0xF4, 0xF5, 0xF6, 0xF4, 0xEF, 0xEA, 0xE8, 0xE9, 0xE8, 
-    0xE4, 0xE0, 0xDF, 0xE3, 0xE8, 0xEB, 0xEC, 0xED, 0xF0, 0xF2, 0xF4, 0xF5, 
-    0xF6, 0xF5, 0xF3, 0xF2, 0xF1, 0xF3, 0xF6, 0xF7, 0xF9, 0xF9, 0xF9, 0xF8, 
-    0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF6, 0xF7, 0xF6, 0xF4, 0xF2, 0xF1, 
-    0xF2, 0xF6, 0xFB, 0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0xFB, 0xF9, 
-    0xFA, 0xFB, 0xFE, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x06, 0x05, 
-    0x02, 0xFE, 0xFB, 0xF8, 0xF6, 0xF5, 0xF3, 0xF1, 0xEF, 0xEF, 0xEE, 0xED, 
-    0xEB, 0xEA, 0xE9, 0xE9, 0xEB, 0xED, 0xF0, 0xF2, 0xF1, 0xEF, 0xEF, 0xF2, 
-    0xF6, 0xF8, 0xF7, 0xF3, 0xF0, 0xED, 0xEB, 0xE9, 0xE6, 0xE4, 0xE5, 0xE7, 
-    0xEB, 0xEC, 0xED, 0xED, 0xEC, 0xEB, 0xEC, 0xED, 0xED, 0xEE, 0xEF, 0xEE, 
-    0xED, 0xEE, 0xF0, 0xF3, 0xF5, 0xF6, 0xF4, 0xF3, 0xF3, 0xF4, 0xF9, 0xFD, 
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x05, 0x09, 0x0C, 0x0F, 
-    0x11, 0x13, 0x15, 0x17, 0x19, 0x1A, 0x19, 0x1B, 0x1F, 0x25, 0x2A, 0x2C, 
-    0x2F, 0x31, 0x34, 0x35, 0x36, 0x34, 0x32, 0x30, 0x2E, 0x2D, 0x2B, 0x2B, 
-    0x2C, 0x2D, 0x2F, 0x30, 0x31, 0x32, 0x35, 0x37, 0x37, 0x36, 0x35, 0x34, 
-    0x35, 0x37, 0x38, 0x38, 0x36, 0x34, 0x33, 0x35, 0x38, 0x39, 0x38, 0x34, 
-    0x31, 0x2F, 0x2E, 0x2C, 0x29, 0x25, 0x24, 0x26, 0x2A, 0x2E, 0x2E, 0x2D, 
-    0x2C, 0x2A, 0x27, 0x24, 0x22, 0x20, 0x1D, 0x1B, 0x1A, 0x1B, 0x1E, 0x20, 
-    0x1F, 0x20, 0x1F, 0x1E, 0x1C, 0x1A, 0x19, 0x17, 0x16, 0x13, 0x0F, 0x0A, 
-    0x08, 0x05, 0x04, 0x03, 0x02, 0x00, 0xFF, 0xFE, 0xFD, 0xFC, 0xF9, 0xF5, 
-    0xF1, 0xEF, 0xEE, 0xEE, 0xED, 0xEC, 0xEC, 0xEA, 0xE8, 0xE7, 0xE8, 0xE9, 
-    0xE8, 0xE6, 0xE4, 0xE3, 0xE2, 0xDF, 0xDB, 0xD7, 0xD6, 0xD8, 0xD9, 0xD9, 
-    0xD6, 0xD4, 0xD2, 0xD1, 0xD0, 0xCF, 0xCE, 0xCF, 0xD0, 0xD3, 0xD5, 0xD6, 
-    0xD6, 0xD5, 0xD7, 0xD8, 0xD8, 0xD4, 0xD0, 0xCC, 0xCA, 0xC8, 0xC6, 0xC4, 
-    0xC1, 0xC1, 0xC2, 0xC6, 0xCB, 0xD0, 0xD2, 0xD4, 0xD6, 0xD7, 0xD8, 0xD6, 
-    0xD3, 0xD1, 0xCF, 0xCF, 0xD0, 0xD2, 0xD5, 0xD7, 0xD7, 0xD6, 0xD7, 0xDB, 
-    0xDD, 0xDF, 0xE0, 0xE1, 0xE2, 0xE4, 0xE4, 0xE3, 0xE5, 0xE6, 0xE5, 0xE4, 
-    0xE4, 0xE6, 0xE8, 0xE8, 0xE6, 0xE2, 0xE1, 0xE2, 0xE4, 0xE6, 0xE5, 0xE5, 
-    0xE8, 0xEC, 0xF1, 0xF5, 0xF6, 0xF6, 0xF7, 0xF6, 0xF6, 0xF7, 0xF9, 0xF9, 
-    0xF7, 0xF4, 0xF2, 0xF2, 0xF4, 0xF6, 0xF7, 0xF6, 0xF6, 0xF5, 0xF5, 0xF4, 
-    0xF3, 0xF2, 0xF3, 0xF4, 0xF8, 0xFB, 0xFD, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 
-    0xFE, 0xFD, 0xFF, 0x01, 0x03, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0x06, 
-    0x0B, 0x0E, 0x10, 0x13, 0x15, 0x15, 0x14, 0x12, 0x10, 0x0F, 0x11, 0x14, 
-    0x17, 0x1D, 0x24, 0x29, 0x2C, 0x2D, 0x2E, 0x2F, 0x2E, 0x2D, 0x2E, 0x2E, 
-    0x30, 0x2F, 0x2E, 0x2F, 0x30, 0x2F, 0x2F, 0x30, 0x33, 0x36, 0x39, 0x3A, 
-    0x39, 0x38, 0x38, 0x39, 0x38, 0x36, 0x34, 0x32, 0x31, 0x33, 0x36, 0x37, 
-    0x38, 0x38, 0x3A, 0x3B, 0x3C, 0x3B, 0x3A, 0x3B, 0x3A, 0x39, 0x38, 0x37, 
-    0x38, 0x38, 0x39, 0x38, 0x36, 0x34, 0x32, 0x2F, 0x2B, 0x27, 0x25, 0x23, 
-    0x24, 0x27, 0x29, 0x2B, 0x2B, 0x29, 0x27, 0x25, 0x22, 0x1F, 0x1C, 0x1A, 
-    0x17, 0x13, 0x0E, 0x0A, 0x07, 0x06, 0x04, 0x05, 0x08, 0x0A, 0x0A, 0x06, 
-    0x00, 0xFC, 0xF8, 0xF6, 0xF2, 0xEE, 0xEB, 0xEA, 0xEB, 0xED, 0xEF, 0xF0, 
-    0xEE, 0xED, 0xEB, 0xEA, 0xEB, 0xEB, 0xEA, 0xE9, 0xE5, 0xE3, 0xE2, 0xE4, 
-    0xE3, 0xE0, 0xDE, 0xDE, 0xDF, 0xE0, 0xDF, 0xDD, 0xDB, 0xDA, 0xDA, 0xD9, 
-    0xD8, 0xDA, 0xDB, 0xDD, 0xE0, 0xE4, 0xE7, 0xE9, 0xEA, 0xEA, 0xE9, 0xE7, 
-    0xE5, 0xE3, 0xE2, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE1, 0xE2, 0xE4, 0xE5, 
-    0xE7, 0xE9, 0xEA, 0xE8, 0xE6, 0xE4, 0xE3, 0xE4, 0xE4, 0xE5, 0xE5, 0xE6, 
-    0xE6, 0xE7, 0xE6, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xE9, 0xE8, 0xE9, 0xE8, 
-    0xE7, 0xE6, 0xE6, 0xE9, 0xEC, 0xEF, 0xEF, 0xED, 0xEA, 0xE8, 0xE5, 0xE2, 
-    0xDF, 0xDE, 0xDF, 0xE3, 0xE7, 0xEC, 0xF2, 0xF8, 0xFD, 0x00, 0xFF, 0xFE, 
-    0xFD, 0xFC, 0xFB, 0xF9, 0xF7, 0xF6, 0xF6, 0xF5, 0xF6, 0xF6, 0xF7, 0xFA, 
-    0xFC, 0xFC, 0xFC, 0xFA, 0xF9, 0xFA, 0xFA, 0xFB, 0xFB, 0xFC, 0xFD, 0xFC, 
-    0xFD, 0xFE, 0x01, 0x03, 0x03, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0xFF, 
-    0xFE, 0xFD, 0xFD, 0xFE, 0x02, 0x08, 0x0D, 0x10, 0x11, 0x10, 0x0F, 0x0E, 
-    0x0F, 0x0E, 0x0F, 0x11, 0x15, 0x19, 0x1E, 0x23, 0x26, 0x28, 0x26, 0x22, 
-    0x1F, 0x1E, 0x1F, 0x1F, 0x1B, 0x16, 0x13, 0x12, 0x14, 0x15, 0x17, 0x19, 
-    0x1C, 0x1E, 0x20, 0x1F, 0x1D, 0x1A, 0x17, 0x16, 0x17, 0x17, 0x18, 0x1A, 
-    0x1D, 0x20, 0x24, 0x26, 0x29, 0x2B, 0x2C, 0x2B, 0x2A, 0x2B, 0x2C, 0x2E, 
-    0x2E, 0x2E, 0x2C, 0x2A, 0x29, 0x29, 0x28, 0x27, 0x26, 0x25, 0x23, 0x1F, 
-    0x1B, 0x19, 0x19, 0x1A, 0x19, 0x1A, 0x1C, 0x20, 0x22, 0x23, 0x21, 0x1F, 
-    0x1D, 0x1A, 0x15, 0x12, 0x0E, 0x0C, 0x0A, 0x06, 0x03, 0x00, 0xFD, 0xFC, 
-    0xFE, 0x02, 0x06, 0x07, 0x06, 0x04, 0x01, 0x00, 0xFE, 0xFC, 0xF7, 0xF3, 
-    0xF1, 0xF2, 0xF2, 0xF3, 0xF0, 0xEB, 0xE7, 0xE4, 0xE3, 0xE0, 0xDC, 0xD7, 
-    0xD2, 0xD0, 0xCE, 0xCD, 0xCC, 0xCD, 0xD0, 0xD4, 0xD7, 0xD9, 0xD9, 0xD6, 
-    0xD2, 0xCE, 0xCC, 0xCD, 0xD0, 0xD2, 0xD4, 0xD7, 0xDC, 0xE2, 0xE7, 0xE9, 
-    0xEA, 0xEA, 0xE9, 0xEA, 0xE8, 0xE6, 0xE4, 0xE2, 0xE1, 0xDF, 0xDD, 0xDB, 
-    0xDA, 0xDC, 0xE0, 0xE3, 0xE3, 0xE2, 0xE2, 0xE4, 0xE7, 0xE8, 0xE7, 0xE4, 
-    0xE3, 0xE4, 0xE5, 0xE7, 0xE8, 0xE8, 0xE7, 0xE6, 0xE6, 0xE6, 0xE7, 0xE8, 
-    0xE8, 0xE8, 0xE7, 0xE9, 0xEC, 0xED, 0xEC, 0xEC, 0xED, 0xF1, 0xF5, 0xF6, 
-    0xF4, 0xF1, 0xEF, 0xED, 0xEC, 0xEB, 0xEC, 0xEF, 0xF3, 0xF6, 0xF8, 0xFA, 
-    0xF9, 0xF9, 0xF7, 0xF5, 0xF3, 0xF0, 0xEE, 0xED, 0xEC, 0xE9, 0xE7, 0xE5, 
-    0xE8, 0xEB, 0xEF, 0xF2, 0xF3, 0xF5, 0xF6, 0xF5, 0xF3, 0xF3, 0xF1, 0xF0, 
-    0xEE, 0xEE, 0xF1, 0xF4, 0xF6, 0xF7, 0xFA, 0xFE, 0x02, 0x06, 0x06, 0x05, 
-    0x03, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x04, 0x07, 0x0B, 0x0F, 0x10, 
-    0x11, 0x10, 0x11, 0x14, 0x17, 0x18, 0x19, 0x1C, 0x1F, 0x23, 0x26, 0x26, 
-    0x24, 0x23, 0x22, 0x23, 0x23, 0x22, 0x1F, 0x1C, 0x1B, 0x1A, 0x1B, 0x1B, 
-    0x1A, 0x19, 0x18, 0x1A, 0x1F, 0x25, 0x2A, 0x2D, 0x2F, 0x30, 0x31, 0x32, 
-    0x32, 0x31, 0x30, 0x2F, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x30, 0x2C, 0x29, 
-    0x27, 0x27, 0x26, 0x27, 0x26, 0x25, 0x24, 0x25, 0x27, 0x28, 0x29, 0x29, 
-    0x26, 0x23, 0x1E, 0x1A, 0x16, 0x12, 0x10, 0x0F, 0x10, 0x10, 0x13, 0x16, 
-    0x1A, 0x1D, 0x1F, 0x20, 0x21, 0x23, 0x24, 0x22, 0x1F, 0x1E, 0x1C, 0x1B, 
-    0x15, 0x10, 0x0D, 0x0D, 0x0E, 0x0F, 0x10, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 
-    0x08, 0x04, 0xFE, 0xFA, 0xF7, 0xF5, 0xF2, 0xEF, 0xEC, 0xEA, 0xEA, 0xEA, 
-    0xE9, 0xE8, 0xE5, 0xE3, 0xE0, 0xDF, 0xE0, 0xDF, 0xDE, 0xDE, 0xDE, 0xE0, 
-    0xE2, 0xE4, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEA, 0xEC, 0xEF, 0xF2, 0xF5, 
-    0xF5, 0xF4, 0xF5, 0xF5, 0xF4, 0xF1, 0xEA, 0xE4, 0xDF, 0xDC, 0xDB, 0xD8, 
-    0xD4, 0xD1, 0xCF, 0xCF, 0xD1, 0xD3, 0xD6, 0xD8, 0xDA, 0xDD, 0xDD, 0xDC, 
-    0xDA, 0xD8, 0xD5, 0xD4, 0xD3, 0xD5, 0xD8, 0xDB, 0xDC, 0xDE, 0xE3, 0xE8, 
-    0xED, 0xEE, 0xEF, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF2, 0xF1, 0xF0, 0xF0, 
-    0xF1, 0xF0, 0xF1, 0xEF, 0xED, 0xEB, 0xEA, 0xEB, 0xEA, 0xE9, 0xE8, 0xE9, 
-    0xE9, 0xE8, 0xE9, 0xE8, 0xE7, 0xE9, 0xEB, 0xED, 0xEE, 0xEE, 0xED, 0xEE, 
-    0xEE, 0xEF, 0xF0, 0xEF, 0xEE, 0xED, 0xEE, 0xF0, 0xF4, 0xF8, 0xFA, 0xFD, 
-    0x00, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0xFD, 0xFE, 0x00, 
-    0xFE, 0xFA, 0xF6, 0xF3, 0xF3, 0xF2, 0xF0, 0xEE, 0xEB, 0xEA, 0xEB, 0xEF, 
-    0xF2, 0xF3, 0xF4, 0xF4, 0xF5, 0xF6, 0xF7, 0xF5, 0xF5, 0xF4, 0xF6, 0xF8, 
-    0xFD, 0x03, 0x09, 0x0C, 0x0D, 0x11, 0x15, 0x1A, 0x1E, 0x20, 0x1E, 0x1C, 
-    0x1C, 0x1A, 0x19, 0x19, 0x17, 0x16, 0x15, 0x17, 0x1A, 0x1D, 0x21, 0x21, 
-    0x22, 0x23, 0x25, 0x26, 0x25, 0x23, 0x20, 0x1E, 0x1D, 0x1E, 0x1E, 0x1D, 
-    0x1C, 0x1C, 0x1E, 0x21, 0x23, 0x21, 0x21, 0x21, 0x22, 0x26, 0x27, 0x29, 
-    0x29, 0x27, 0x24, 0x23, 0x24, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x28, 
-    0x29, 0x2A, 0x27, 0x26, 0x23, 0x1E, 0x1B, 0x15, 0x0C, 0x08, 0x06, 0x06, 
-    0x08, 0x0A, 0x0D, 0x08, 0x08, 0x08, 0x05, 0x02, 0x03, 0x01, 0xFE, 0xFC, 
-    0xFF, 0x01, 0x01, 0xFC, 0xF6, 0xF5, 0xF5, 0xF6, 0xF0, 0xF6, 0xF3, 0xF4, 
-    0xF6, 0xF3, 0xF7, 0xFB, 0xFE, 0xFC, 0xFC, 0xF8, 0xF4, 0xF5, 0xF3, 0xEE, 
-    0xF3, 0xF4, 0xF7, 0xFB, 0x00, 0x00, 0xFE, 0xF6, 0xF4, 0xF4, 0xF1, 0xF4, 
-    0xF0, 0xF2, 0xEF, 0xF2, 0xED, 0xEB, 0xF0, 0xF0, 0xF5, 0xF6, 0xF8, 0xF7, 
-    0xF5, 0xF3, 0xF5, 0xED, 0xEE, 0xF0, 0xEA, 0xEB, 0xE4, 0xE2, 0xE4, 0xE9, 
-    0xE8, 0xEB, 0xEC, 0xE5, 0xED, 0xEB, 0xEC, 0xE8, 0xE9, 0xF1, 0xF2, 0xEF, 
-    0xE9, 0xE9, 0xE5, 0xEA, 0xEB, 0xF0, 0xF1, 0xED, 0xF5, 0xF3, 0xF6, 0xF7, 
-    0xE8, 0xEC, 0xE7, 0xE6, 0xE4, 0xE0, 0xE3, 0xE4, 0xEA, 0xE7, 0xE8, 0xE4, 
-    0xE6, 0xE5, 0xE2, 0xE3, 0xE5, 0xE4, 0xDF, 0xDB, 0xD9, 0xD6, 0xD7, 0xDE, 
-    0xDA, 0xDA, 0xCF, 0xD3, 0xDA, 0xE0, 0xE5, 0xE7, 0xEB, 0xE9, 0xEB, 0xEC, 
-    0xF2, 0xF6, 0xFC, 0xFB, 0xFA, 0xFB, 0xFD, 0xFD, 0x03, 0x03, 0x01, 0xFF, 
-    0x00, 0x00, 0xFD, 0xFA, 0xF3, 0xF4, 0xF4, 0xF6, 0xFA, 0xFB, 0xFB, 0xFC, 
-    0xFD, 0x02, 0x05, 0x0C, 0x0F, 0x11, 0x14, 0x15, 0x1A, 0x1D, 0x21, 0x21, 
-    0x22, 0x20, 0x23, 0x28, 0x29, 0x2C, 0x32, 0x37, 0x3F, 0x45, 0x4B, 0x51, 
-    0x4F, 0x4C, 0x46, 0x40, 0x39, 0x37, 0x2F, 0x2B, 0x23, 0x1B, 0x22, 0x24, 
-    0x2C, 0x2C, 0x2C, 0x30, 0x31, 0x32, 0x2D, 0x24, 0x1C, 0x15, 0x15, 0x18, 
-    0x1D, 0x21, 0x20, 0x23, 0x25, 0x2B, 0x31, 0x34, 0x3A, 0x39, 0x35, 0x33, 
-    0x2E, 0x2B, 0x2A, 0x27, 0x23, 0x1E, 0x12, 0x0D, 0x0C, 0x0D, 0x10, 0x11, 
-    0x0A, 0x03, 0xFE, 0xF9, 0xF5, 0xF2, 0xF3, 0xEF, 0xED, 0xE8, 0xE0, 0xDB, 
-    0xD5, 0xD4, 0xD7, 0xD9, 0xDD, 0xDF, 0xDF, 0xE2, 0xE6, 0xE9, 0xEA, 0xEB, 
-    0xEA, 0xE6, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xEB, 0xEC, 0xF3, 0xFA, 0xFF, 
-    0x02, 0x05, 0x08, 0x04, 0x03, 0xFE, 0xFA, 0xF3, 0xEE, 0xEB, 0xE5, 0xE2, 
-    0xE2, 0xE5, 0xE9, 0xED, 0xEE, 0xF0, 0xF0, 0xF3, 0xF3, 0xF5, 0xF4, 0xF2, 
-    0xF1, 0xEC, 0xEB, 0xE9, 0xEB, 0xEB, 0xF1, 0xF7, 0x01, 0x0B, 0x13, 0x1A, 
-    0x1B, 0x18, 0x13, 0x0E, 0x06, 0x05, 0x01, 0x01, 0xFE, 0xFB, 0x01, 0x07, 
-    0x0F, 0x15, 0x1A, 0x19, 0x1A, 0x1A, 0x16, 0x11, 0x0B, 0x05, 0x00, 0xFC, 
-    0xF5, 0xF3, 0xED, 0xEC, 0xEF, 0xF0, 0xF2, 0xF5, 0xF6, 0xF8, 0xFA, 0xFB, 
-    0xFA, 0xF6, 0xF3, 0xED, 0xE8, 0xE1, 0xDD, 0xD7, 0xD5, 0xD8, 0xDD, 0xE4, 
-    0xEB, 0xF4, 0xF9, 0xF9, 0xF2, 0xE8, 0xDE, 0xD7, 0xD5, 0xD5, 0xD9, 0xD6, 
-    0xD4, 0xD1, 0xD2, 0xD7, 0xDA, 0xE0, 0xDC, 0xD9, 0xD6, 0xD2, 0xCC, 0xC7, 
-    0xC5, 0xC1, 0xC3, 0xC5, 0xC6, 0xC3, 0xC1, 0xBF, 0xC5, 0xCC, 0xD1, 0xD4, 
-    0xD4, 0xD5, 0xD5, 0xD7, 0xD8, 0xD8, 0xD5, 0xD2, 0xCE, 0xCC, 0xC9, 0xC8, 
-    0xCB, 0xD1, 0xD7, 0xDE, 0xE4, 0xEB, 0xEF, 0xED, 0xE7, 0xE0, 0xE0, 0xE2, 
-    0xE9, 0xF1, 0xF8, 0xFD, 0x03, 0x0A, 0x12, 0x1B, 0x20, 0x25, 0x26, 0x25, 
-    0x21, 0x1B, 0x16, 0x11, 0x0E, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x18, 
-    0x1B, 0x21, 0x27, 0x2B, 0x2E, 0x2E, 0x30, 0x2F, 0x32, 0x33, 0x33, 0x32, 
-    0x31, 0x31, 0x34, 0x3A, 0x43, 0x4B, 0x4F, 0x55, 0x59, 0x5E, 0x5E, 0x58, 
-    0x4C, 0x3E, 0x33, 0x2E, 0x2F, 0x31, 0x30, 0x2E, 0x2C, 0x2B, 0x2D, 0x32, 
-    0x34, 0x36, 0x36, 0x37, 0x37, 0x30, 0x28, 0x1B, 0x11, 0x09, 0x08, 0x08, 
-    0x0A, 0x0D, 0x0F, 0x15, 0x18, 0x1C, 0x1D, 0x1E, 0x1F, 0x1F, 0x20, 0x21, 
-    0x22, 0x20, 0x1D, 0x18, 0x16, 0x14, 0x14, 0x16, 0x16, 0x15, 0x12, 0x11, 
-    0x0E, 0x0C, 0x05, 0xFB, 0xEE, 0xE2, 0xDA, 0xD6, 0xD5, 0xD6, 0xD7, 0xD9, 
-    0xE1, 0xE9, 0xF0, 0xF8, 0xFA, 0xFA, 0xF6, 0xF1, 0xEB, 0xE5, 0xDF, 0xD9, 
-    0xD5, 0xD3, 0xD4, 0xD6, 0xDA, 0xE1, 0xE7, 0xEF, 0xF5, 0xF9, 0xFE, 0x02, 
-    0x04, 0x05, 0x04, 0x02, 0x01, 0xFE, 0xFA, 0xF4, 0xEF, 0xEA, 0xEA, 0xEE, 
-    0xF1, 0xF5, 0xF8, 0xFD, 0x00, 0x00, 0xFC, 0xF3, 0xEA, 0xE3, 0xE2, 0xE4, 
-    0xE9, 0xEB, 0xEE, 0xF3, 0xFA, 0x04, 0x0C, 0x12, 0x15, 0x15, 0x14, 0x12, 
-    0x0E, 0x0B, 0x06, 0x03, 0xFE, 0xFC, 0xFC, 0xFF, 0x04, 0x08, 0x0D, 0x10, 
-    0x12, 0x15, 0x16, 0x19, 0x1C, 0x1D, 0x1B, 0x17, 0x0F, 0x06, 0xFC, 0xF4, 
-    0xEE, 0xED, 0xF1, 0xF8, 0xFD, 0x01, 0x05, 0x07, 0x09, 0x04, 0xFB, 0xF0, 
-    0xE7, 0xE3, 0xE1, 0xE1, 0xE4, 0xE6, 0xE9, 0xEF, 0xF5, 0xFB, 0xFF, 0xFF, 
-    0xFD, 0xF7, 0xF3, 0xEE, 0xE9, 0xE5, 0xE1, 0xDD, 0xDC, 0xDB, 0xDB, 0xDB, 
-    0xDC, 0xDF, 0xE3, 0xE4, 0xE2, 0xE0, 0xDE, 0xDC, 0xD9, 0xD6, 0xD0, 0xCB, 
-    0xC7, 0xC4, 0xC2, 0xC2, 0xC2, 0xC4, 0xCA, 0xCF, 0xD4, 0xD7, 0xDB, 0xDC, 
-    0xDA, 0xD6, 0xCE, 0xC6, 0xBF, 0xBD, 0xBE, 0xBF, 0xC1, 0xC5, 0xCC, 0xD5, 
-    0xDF, 0xE8, 0xEE, 0xF0, 0xEE, 0xEA, 0xE4, 0xDE, 0xDA, 0xD9, 0xDA, 0xDB, 
-    0xDF, 0xE2, 0xE7, 0xED, 0xF3, 0xFA, 0x01, 0x09, 0x0F, 0x11, 0x10, 0x0C, 
-    0x08, 0x03, 0x00, 0xFC, 0xF8, 0xF5, 0xF3, 0xF0, 0xF0, 0xF4, 0xF9, 0x00, 
-    0x05, 0x09, 0x0C, 0x0F, 0x0D, 0x06, 0xFF, 0xF8, 0xF6, 0xF8, 0xFB, 0xFD, 
-    0x00, 0x06, 0x10, 0x1E, 0x2B, 0x34, 0x3A, 0x3D, 0x3F, 0x3B, 0x33, 0x27, 
-    0x1A, 0x0F, 0x08, 0x06, 0x07, 0x0B, 0x11, 0x19, 0x20, 0x25, 0x29, 0x2B, 
-    0x2E, 0x30, 0x30, 0x2E, 0x2B, 0x25, 0x1F, 0x18, 0x14, 0x12, 0x13, 0x15, 
-    0x1C, 0x27, 0x31, 0x3A, 0x42, 0x49, 0x4E, 0x51, 0x52, 0x4D, 0x46, 0x3F, 
-    0x3C, 0x3D, 0x3C, 0x3D, 0x3D, 0x41, 0x45, 0x4A, 0x4C, 0x49, 0x43, 0x39, 
-    0x2C, 0x1F, 0x13, 0x09, 0x01, 0xFA, 0xF6, 0xF4, 0xF5, 0xF9, 0xFD, 0x02, 
-    0x08, 0x0D, 0x13, 0x18, 0x1D, 0x1E, 0x1D, 0x1C, 0x19, 0x15, 0x11, 0x0C, 
-    0x07, 0x04, 0x01, 0x02, 0x07, 0x0C, 0x10, 0x14, 0x19, 0x1E, 0x21, 0x20, 
-    0x19, 0x0E, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x05, 0x0A, 0x0E, 
-    0x10, 0x10, 0x0E, 0x0B, 0x05, 0xFC, 0xF5, 0xEE, 0xEA, 0xE8, 0xE5, 0xE3, 
-    0xE1, 0xDF, 0xDD, 0xDB, 0xDC, 0xDC, 0xDE, 0xDF, 0xE1, 0xE3, 0xE5, 0xE7, 
-    0xE6, 0xE2, 0xDD, 0xD7, 0xD1, 0xD0, 0xD1, 0xD9, 0xE4, 0xED, 0xF2, 0xF4, 
-    0xF5, 0xF4, 0xF1, 0xEA, 0xE0, 0xD6, 0xCE, 0xCA, 0xC6, 0xC3, 0xC3, 0xC5, 
-    0xCC, 0xD4, 0xDE, 0xE5, 0xEC, 0xF0, 0xF3, 0xF3, 0xEF, 0xE8, 0xDD, 0xD2, 
-    0xC9, 0xC3, 0xBE, 0xBC, 0xBE, 0xC1, 0xC6, 0xCB, 0xCE, 0xD1, 0xD1, 0xD1, 
-    0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xCE, 0xCD, 0xCF, 0xD5, 
-    0xDA, 0xDC, 0xD9, 0xD8, 0xD9, 0xD9, 0xD7, 0xD1, 0xCA, 0xC4, 0xC2, 0xC2, 
-    0xC4, 0xC8, 0xCD, 0xD5, 0xDF, 0xE9, 0xF1, 0xF6, 0xF7, 0xF6, 0xF2, 0xED, 
-    0xE8, 0xE2, 0xDC, 0xD6, 0xD1, 0xD1, 0xD3, 0xD7, 0xDC, 0xDF, 0xE3, 0xE6, 
-    0xEA, 0xEF, 0xF5, 0xF7, 0xF8, 0xF8, 0xF6, 0xF4, 0xF2, 0xF2, 0xF2, 0xF4, 
-    0xF7, 0xFD, 0x07, 0x11, 0x16, 0x17, 0x16, 0x17, 0x19, 0x1A, 0x18, 0x13, 
-    0x0E, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x17, 0x21, 0x29, 0x2F, 
-    0x32, 0x32, 0x2F, 0x29, 0x22, 0x19, 0x0F, 0x08, 0x05, 0x05, 0x09, 0x0E, 
-    0x16, 0x1F, 0x27, 0x2F, 0x35, 0x3C, 0x43, 0x47, 0x47, 0x44, 0x40, 0x3C, 
-    0x36, 0x2E, 0x26, 0x1F, 0x1C, 0x20, 0x27, 0x2D, 0x32, 0x34, 0x34, 0x35, 
-    0x35, 0x31, 0x2B, 0x21, 0x18, 0x12, 0x12, 0x13, 0x16, 0x19, 0x1D, 0x25, 
-    0x2D, 0x35, 0x3B, 0x3D, 0x3B, 0x36, 0x31, 0x2C, 0x27, 0x20, 0x1B, 0x17, 
-    0x15, 0x15, 0x17, 0x1A, 0x20, 0x26, 0x2B, 0x2F, 0x30, 0x30, 0x2D, 0x28, 
-    0x21, 0x18, 0x0F, 0x07, 0x00, 0xF9, 0xF3, 0xEF, 0xEF, 0xF5, 0xFB, 0x00, 
-    0x01, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0xF9, 0xF3, 0xEF, 0xEE, 0xEE, 0xEF, 
-    0xF1, 0xF6, 0xFD, 0x07, 0x10, 0x16, 0x18, 0x19, 0x16, 0x10, 0x09, 0x00, 
-    0xF8, 0xF3, 0xF1, 0xF0, 0xEF, 0xF0, 0xF3, 0xF8, 0xFC, 0xFF, 0x02, 0x04, 
-    0x06, 0x09, 0x0A, 0x0A, 0x06, 0x01, 0xF9, 0xF0, 0xE8, 0xE3, 0xE0, 0xDE, 
-    0xDF, 0xE5, 0xED, 0xF4, 0xF9, 0xFC, 0xFE, 0xFF, 0x00, 0x00, 0xFE, 0xF9, 
-    0xF3, 0xF1, 0xF1, 0xF2, 0xF5, 0xF9, 0xFE, 0x03, 0x06, 0x07, 0x04, 0x00, 
-    0xFC, 0xF7, 0xF2, 0xEC, 0xE8, 0xE4, 0xE2, 0xE0, 0xE0, 0xE3, 0xE8, 0xEF, 
-    0xF7, 0xFE, 0x02, 0x05, 0x08, 0x0A, 0x09, 0x07, 0x02, 0xFC, 0xF6, 0xF0, 
-    0xEA, 0xE6, 0xE3, 0xE6, 0xED, 0xF7, 0xFE, 0x02, 0x05, 0x05, 0x04, 0x00, 
-    0xFC, 0xF9, 0xF5, 0xF3, 0xF2, 0xF0, 0xEF, 0xED, 0xEF, 0xF2, 0xF8, 0x00, 
-    0x03, 0x04, 0x02, 0x00, 0xFE, 0xFB, 0xF6, 0xF0, 0xEB, 0xE6, 0xE3, 0xE0, 
-    0xE1, 0xE3, 0xE9, 0xF1, 0xFC, 0x06, 0x0E, 0x11, 0x11, 0x0E, 0x08, 0x02, 
-    0xFA, 0xF2, 0xEB, 0xE8, 0xE7, 0xE9, 0xED, 0xF3, 0xFB, 0x00, 0x03, 0x03, 
-    0x02, 0xFF, 0xFC, 0xF7, 0xF2, 0xEC, 0xE8, 0xE5, 0xE4, 0xE1, 0xE0, 0xDF, 
-    0xE3, 0xEB, 0xF4, 0xFC, 0x02, 0x06, 0x0A, 0x0E, 0x10, 0x11, 0x0E, 0x09, 
-    0x04, 0x01, 0xFE, 0xFD, 0xFC, 0xFD, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 
-    0xF9, 0xF4, 0xEE, 0xE9, 0xE5, 0xE1, 0xDD, 0xDA, 0xDA, 0xDD, 0xE5, 0xEF, 
-    0xFA, 0x03, 0x07, 0x0A, 0x0A, 0x0B, 0x09, 0x07, 0x03, 0xFE, 0xFA, 0xF8, 
-    0xF7, 0xF5, 0xF3, 0xF3, 0xF7, 0xFE, 0x06, 0x0D, 0x12, 0x13, 0x15, 0x16, 
-    0x16, 0x13, 0x0E, 0x07, 0x01, 0xFD, 0xFA, 0xFA, 0xFC, 0xFF, 0x03, 0x08, 
-    0x0F, 0x16, 0x1B, 0x1E, 0x1D, 0x1C, 0x19, 0x17, 0x15, 0x13, 0x0F, 0x0B, 
-    0x07, 0x05, 0x08, 0x0F, 0x17, 0x1E, 0x21, 0x22, 0x23, 0x21, 0x1E, 0x18, 
-    0x10, 0x06, 0xFD, 0xF6, 0xF2, 0xF0, 0xF0, 0xF4, 0xFB, 0x05, 0x0F, 0x15, 
-    0x16, 0x13, 0x0E, 0x0A, 0x05, 0x00, 0xFA, 0xF6, 0xF3, 0xF2, 0xF3, 0xF7, 
-    0xFC, 0x00, 0x03, 0x06, 0x0B, 0x10, 0x15, 0x18, 0x1A, 0x1A, 0x19, 0x19, 
-    0x19, 0x18, 0x16, 0x13, 0x0F, 0x0E, 0x12, 0x17, 0x1B, 0x1B, 0x18, 0x13, 
-    0x0D, 0x07, 0x01, 0xFC, 0xF6, 0xF0, 0xEB, 0xEA, 0xE9, 0xEA, 0xED, 0xF2, 
-    0xF9, 0x00, 0x06, 0x09, 0x0A, 0x08, 0x07, 0x05, 0x02, 0xFE, 0xF9, 0xF3, 
-    0xEE, 0xEB, 0xEB, 0xEE, 0xF0, 0xF4, 0xF6, 0xF8, 0xF9, 0xFB, 0xFD, 0xFF, 
-    0x01, 0x01, 0xFD, 0xF8, 0xF4, 0xF2, 0xF1, 0xEF, 0xED, 0xEF, 0xF4, 0xFA, 
-    0xFE, 0xFF, 0xFD, 0xF9, 0xF5, 0xF3, 0xF3, 0xF3, 0xF1, 0xEE, 0xEC, 0xEB, 
-    0xEB, 0xEC, 0xEE, 0xF1, 0xF5, 0xF7, 0xF9, 0xFA, 0xFA, 0xFA, 0xF9, 0xF6, 
-    0xF3, 0xF0, 0xEA, 0xE4, 0xDE, 0xD9, 0xD7, 0xDA, 0xDF, 0xE5, 0xEC, 0xF2, 
-    0xF6, 0xFA, 0xFC, 0xFD, 0xFC, 0xF9, 0xF4, 0xED, 0xE9, 0xE7, 0xE8, 0xE9, 
-    0xED, 0xF1, 0xF6, 0xFC, 0xFF, 0xFF, 0xF9, 0xF1, 0xEA, 0xE4, 0xE3, 0xE4, 
-    0xE6, 0xE9, 0xED, 0xF1, 0xF6, 0xFD, 0x03, 0x08, 0x0A, 0x0A, 0x07, 0x03, 
-    0xFD, 0xF6, 0xEE, 0xE4, 0xDB, 0xD2, 0xCD, 0xCC, 0xCB, 0xCB, 0xCE, 0xD2, 
-    0xDA, 0xE2, 0xE9, 0xEE, 0xF2, 0xF6, 0xFB, 0x00, 0x03, 0x03, 0x02, 0xFF, 
-    0xFD, 0xFD, 0xFF, 0x02, 0x07, 0x0B, 0x11, 0x16, 0x1A, 0x1B, 0x18, 0x14, 
-    0x0F, 0x0C, 0x0D, 0x0E, 0x0E, 0x0B, 0x08, 0x05, 0x06, 0x0A, 0x11, 0x17, 
-    0x1B, 0x1C, 0x1A, 0x17, 0x13, 0x0F, 0x0C, 0x09, 0x05, 0x03, 0x05, 0x09, 
-    0x0E, 0x11, 0x14, 0x17, 0x19, 0x1C, 0x1F, 0x22, 0x23, 0x27, 0x2B, 0x2F, 
-    0x31, 0x30, 0x2C, 0x26, 0x21, 0x1B, 0x17, 0x15, 0x17, 0x19, 0x1D, 0x22, 
-    0x27, 0x2B, 0x2C, 0x2C, 0x2A, 0x2B, 0x2B, 0x2D, 0x2C, 0x29, 0x25, 0x23, 
-    0x24, 0x29, 0x30, 0x36, 0x38, 0x36, 0x32, 0x2D, 0x28, 0x23, 0x1D, 0x18, 
-    0x12, 0x0E, 0x0D, 0x0E, 0x11, 0x14, 0x17, 0x18, 0x1A, 0x1B, 0x1C, 0x1A, 
-    0x16, 0x12, 0x0D, 0x09, 0x02, 0xFB, 0xF3, 0xED, 0xEA, 0xE9, 0xEC, 0xF2, 
-    0xF8, 0xFC, 0x00, 0x02, 0x03, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x04, 
-    0x04, 0x05, 0x04, 0x04, 0x05, 0x08, 0x0C, 0x0F, 0x0E, 0x0B, 0x06, 0x00, 
-    0xFD, 0xFA, 0xF9, 0xF7, 0xF5, 0xF5, 0xF4, 0xF5, 0xF7, 0xF8, 0xFA, 0xFD, 
-    0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFA, 0xF8, 0xF4, 0xEF, 0xEB, 0xE8, 0xE7, 
-    0xE7, 0xE8, 0xEC, 0xF0, 0xF3, 0xF3, 0xF2, 0xED, 0xE8, 0xE2, 0xDE, 0xDC, 
-    0xDC, 0xE0, 0xE4, 0xE6, 0xE8, 0xE9, 0xEA, 0xEA, 0xE8, 0xE6, 0xE5, 0xE6, 
-    0xE5, 0xE4, 0xE1, 0xDF, 0xE0, 0xE4, 0xE6, 0xE5, 0xE3, 0xE0, 0xDE, 0xDE, 
-    0xE0, 0xE2, 0xE4, 0xE5, 0xE6, 0xE6, 0xE5, 0xE4, 0xE2, 0xDF, 0xDB, 0xD8, 
-    0xD6, 0xD3, 0xD2, 0xD3, 0xD5, 0xD9, 0xDE, 0xE4, 0xEC, 0xF1, 0xF4, 0xF2, 
-    0xEC, 0xE5, 0xE0, 0xDC, 0xD8, 0xD5, 0xD0, 0xCC, 0xCA, 0xCC, 0xD0, 0xD5, 
-    0xDA, 0xDF, 0xE3, 0xE5, 0xE6, 0xE4, 0xDF, 0xDC, 0xD9, 0xD7, 0xD6, 0xD6, 
-    0xD9, 0xDD, 0xE2, 0xE7, 0xED, 0xF2, 0xF5, 0xF7, 0xF6, 0xF2, 0xEE, 0xEA, 
-    0xE6, 0xE4, 0xE1, 0xDD, 0xDA, 0xD9, 0xDA, 0xDC, 0xE0, 0xE5, 0xEC, 0xF4, 
-    0xFA, 0xFE, 0xFE, 0xFA, 0xF4, 0xEE, 0xEA, 0xEA, 0xED, 0xF2, 0xF5, 0xF8, 
-    0xFD, 0x04, 0x0D, 0x15, 0x1C, 0x1E, 0x1F, 0x1F, 0x1E, 0x1C, 0x19, 0x16, 
-    0x12, 0x11, 0x12, 0x13, 0x16, 0x19, 0x1A, 0x1D, 0x20, 0x21, 0x21, 0x1F, 
-    0x1A, 0x13, 0x0F, 0x0E, 0x10, 0x13, 0x14, 0x14, 0x15, 0x18, 0x1B, 0x1F, 
-    0x23, 0x25, 0x25, 0x25, 0x26, 0x25, 0x24, 0x21, 0x1C, 0x18, 0x16, 0x18, 
-    0x1D, 0x20, 0x20, 0x1F, 0x1F, 0x21, 0x26, 0x2C, 0x31, 0x35, 0x37, 0x39, 
-    0x3B, 0x3C, 0x3B, 0x39, 0x37, 0x33, 0x2E, 0x2A, 0x26, 0x24, 0x24, 0x23, 
-    0x25, 0x27, 0x2A, 0x2C, 0x2C, 0x2B, 0x2A, 0x29, 0x28, 0x26, 0x22, 0x1D, 
-    0x19, 0x17, 0x18, 0x1B, 0x1E, 0x20, 0x1E, 0x1B, 0x18, 0x14, 0x0F, 0x07, 
-    0xFF, 0xF7, 0xF4, 0xF5, 0xF7, 0xF8, 0xF9, 0xFC, 0xFF, 0x04, 0x0A, 0x0E, 
-    0x10, 0x0F, 0x0C, 0x08, 0x04, 0x01, 0xFD, 0xF9, 0xF5, 0xF2, 0xF1, 0xF2, 
-    0xF3, 0xF4, 0xF7, 0xFC, 0x01, 0x06, 0x08, 0x07, 0x06, 0x05, 0x02, 0xFF, 
-    0xFD, 0xFB, 0xFA, 0xFA, 0xFD, 0x01, 0x07, 0x10, 0x17, 0x1A, 0x18, 0x14, 
-    0x0E, 0x07, 0xFE, 0xF4, 0xEA, 0xE5, 0xE4, 0xE8, 0xEC, 0xEE, 0xEF, 0xEF, 
-    0xF0, 0xF3, 0xF6, 0xF8, 0xF6, 0xF2, 0xED, 0xE6, 0xE0, 0xDA, 0xD5, 0xD1, 
-    0xCE, 0xCE, 0xCF, 0xD3, 0xD7, 0xDD, 0xE2, 0xE6, 0xE9, 0xE9, 0xE7, 0xE6, 
-    0xE6, 0xE6, 0xE9, 0xEB, 0xED, 0xEB, 0xE9, 0xE6, 0xE4, 0xE4, 0xE6, 0xE9, 
-    0xEA, 0xEA, 0xE8, 0xE7, 0xE4, 0xE0, 0xDC, 0xD7, 0xD4, 0xD3, 0xD5, 0xD7, 
-    0xDA, 0xDA, 0xDB, 0xDC, 0xE0, 0xE4, 0xE8, 0xEA, 0xE9, 0xE5, 0xDF, 0xDA, 
-    0xD5, 0xD1, 0xCD, 0xCA, 0xC7, 0xC6, 0xC5, 0xC7, 0xCC, 0xD4, 0xDC, 0xE2, 
-    0xE7, 0xEA, 0xEC, 0xEE, 0xF0, 0xF0, 0xF0, 0xEE, 0xEC, 0xE8, 0xE5, 0xE3, 
-    0xE3, 0xE6, 0xEC, 0xF2, 0xF5, 0xF8, 0xFA, 0xF8, 0xF6, 0xF1, 0xEC, 0xE7, 
-    0xE4, 0xE3, 0xE5, 0xE7, 0xE8, 0xE8, 0xEA, 0xEF, 0xF5, 0xFD, 0x02, 0x06, 
-    0x07, 0x07, 0x05, 0x02, 0xFE, 0xF8, 0xF2, 0xED, 0xEA, 0xEB, 0xEF, 0xF6, 
-    0xFD, 0x06, 0x0E, 0x16, 0x1C, 0x1F, 0x20, 0x21, 0x20, 0x21, 0x20, 0x1F, 
-    0x1C, 0x18, 0x15, 0x14, 0x15, 0x18, 0x1D, 0x21, 0x25, 0x27, 0x29, 0x29, 
-    0x27, 0x23, 0x1F, 0x1B, 0x1A, 0x1B, 0x1F, 0x22, 0x23, 0x21, 0x1E, 0x1D, 
-    0x1E, 0x1F, 0x1E, 0x1C, 0x19, 0x16, 0x13, 0x12, 0x10, 0x0E, 0x0B, 0x0A, 
-    0x0A, 0x0B, 0x0D, 0x0F, 0x12, 0x17, 0x1C, 0x20, 0x24, 0x25, 0x25, 0x22, 
-    0x20, 0x1D, 0x1B, 0x19, 0x15, 0x13, 0x12, 0x14, 0x1A, 0x21, 0x28, 0x2B, 
-    0x2D, 0x2E, 0x2D, 0x2C, 0x2A, 0x27, 0x24, 0x22, 0x23, 0x26, 0x29, 0x28, 
-    0x24, 0x1F, 0x1B, 0x1B, 0x1C, 0x1D, 0x1C, 0x1B, 0x19, 0x17, 0x14, 0x10, 
-    0x0B, 0x05, 0x00, 0xFD, 0xFC, 0xFB, 0xFB, 0xFD, 0xFE, 0x02, 0x04, 0x05, 
-    0x06, 0x04, 0x03, 0x03, 0x01, 0xFE, 0xFC, 0xF7, 0xF2, 0xEC, 0xEB, 0xEB, 
-    0xEE, 0xF6, 0xFB, 0x00, 0x06, 0x0A, 0x0C, 0x0D, 0x09, 0x05, 0x01, 0xFC, 
-    0xFB, 0xFB, 0xFC, 0xFC, 0xFB, 0xFD, 0xFF, 0x06, 0x0A, 0x0E, 0x12, 0x11, 
-    0x11, 0x10, 0x0E, 0x09, 0x07, 0x03, 0xFF, 0xFE, 0xF8, 0xF8, 0xF6, 0xF9, 
-    0xF8, 0xFB, 0xF9, 0xF3, 0xF5, 0xEE, 0xEA, 0xE6, 0xDF, 0xDD, 0xD7, 0xD3, 
-    0xD1, 0xCD, 0xD0, 0xD2, 0xD7, 0xDF, 0xE1, 0xE3, 0xE5, 0xE2, 0xDF, 0xDE, 
-    0xDA, 0xD6, 0xD5, 0xCF, 0xD4, 0xD5, 0xD6, 0xD7, 0xD6, 0xD8, 0xD9, 0xE1, 
-    0xE4, 0xE9, 0xEB, 0xEC, 0xEE, 0xEF, 0xF0, 0xEB, 0xEB, 0xEA, 0xE6, 0xE8, 
-    0xE5, 0xE6, 0xE8, 0xEA, 0xEC, 0xED, 0xED, 0xEA, 0xE8, 0xE1, 0xE1, 0xDD, 
-    0xDA, 0xDA, 0xD8, 0xD7, 0xD5, 0xD6, 0xDC, 0xE3, 0xEB, 0xF3, 0xF3, 0xFA, 
-    0xF6, 0xF7, 0xF4, 0xF0, 0xEB, 0xE8, 0xEA, 0xEC, 0xF3, 0xF9, 0xFD, 0xFC, 
-    0xFF, 0xFE, 0xFD, 0xFC, 0xFA, 0xF2, 0xEE, 0xE7, 0xE2, 0xDF, 0xDC, 0xDB, 
-    0xD9, 0xDC, 0xDE, 0xE6, 0xED, 0xF4, 0xFA, 0xFF, 0x03, 0x05, 0x03, 0x02, 
-    0xFD, 0xFB, 0xF8, 0xF8, 0xFA, 0xF8, 0xFB, 0xF8, 0xFA, 0xFD, 0x05, 0x0C, 
-    0x12, 0x18, 0x18, 0x1A, 0x1C, 0x1A, 0x1A, 0x16, 0x14, 0x13, 0x14, 0x1A, 
-    0x1C, 0x1E, 0x1B, 0x1B, 0x17, 0x1A, 0x18, 0x17, 0x17, 0x14, 0x16, 0x13, 
-    0x13, 0x11, 0x0F, 0x0D, 0x0B, 0x09, 0x0B, 0x0E, 0x10, 0x12, 0x12, 0x12, 
-    0x12, 0x13, 0x12, 0x12, 0x10, 0x10, 0x13, 0x14, 0x16, 0x17, 0x14, 0x11, 
-    0x12, 0x12, 0x16, 0x1B, 0x1A, 0x1D, 0x1B, 0x19, 0x16, 0x14, 0x10, 0x0C, 
-    0x0B, 0x0A, 0x0F, 0x13, 0x19, 0x1A, 0x1B, 0x19, 0x19, 0x18, 0x18, 0x18, 
-    0x18, 0x18, 0x14, 0x15, 0x12, 0x11, 0x0F, 0x10, 0x0E, 0x10, 0x15, 0x17, 
-    0x1C, 0x1E, 0x1F, 0x1F, 0x20, 0x21, 0x20, 0x20, 0x1C, 0x19, 0x18, 0x17, 
-    0x15, 0x0F, 0x0A, 0x05, 0x05, 0x05, 0x0B, 0x0D, 0x0E, 0x0C, 0x08, 0x04, 
-    0xFD, 0xFA, 0xF4, 0xF3, 0xF1, 0xF5, 0xF9, 0x01, 0x05, 0x07, 0x04, 0xFE, 
-    0xFA, 0xF7, 0xF5, 0xF1, 0xEE, 0xE9, 0xE7, 0xE5, 0xE8, 0xE8, 0xEF, 0xF1, 
-    0xF7, 0xFE, 0x03, 0x0C, 0x0D, 0x10, 0x0D, 0x0B, 0x07, 0x04, 0x00, 0xFB, 
-    0xF9, 0xF6, 0xF7, 0xF8, 0xF8, 0xF6, 0xF5, 0xF5, 0xFA, 0x01, 0x08, 0x0D, 
-    0x0C, 0x08, 0x05, 0xFE, 0xF8, 0xF3, 0xEE, 0xEB, 0xE9, 0xEA, 0xED, 0xF0, 
-    0xF0, 0xEC, 0xE8, 0xE3, 0xE3, 0xE2, 0xE4, 0xE3, 0xE2, 0xE0, 0xDC, 0xDB, 
-    0xD9, 0xD9, 0xD7, 0xD7, 0xD7, 0xDA, 0xDF, 0xE4, 0xE9, 0xEA, 0xEB, 0xE9, 
-    0xE7, 0xE6, 0xE1, 0xE2, 0xE0, 0xE0, 0xE1, 0xE0, 0xE0, 0xDF, 0xE1, 0xE4, 
-    0xEC, 0xF1, 0xF7, 0xF7, 0xF7, 0xF2, 0xED, 0xE6, 0xDF, 0xDB, 0xD9, 0xD9, 
-    0xDA, 0xDF, 0xE2, 0xE8, 0xEB, 0xED, 0xED, 0xEF, 0xF3, 0xF7, 0xF9, 0xFC, 
-    0xFE, 0xFD, 0xFC, 0xFC, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0xFF, 0x00, 0x02, 
-    0x03, 0x01, 0xFE, 0xF9, 0xF6, 0xF5, 0xF5, 0xF8, 0xF9, 0xF8, 0xF6, 0xF5, 
-    0xF2, 0xF1, 0xF2, 0xF3, 0xF5, 0xF8, 0xF9, 0xFA, 0xFA, 0xF9, 0xF4, 0xF0, 
-    0xEC, 0xEB, 0xEC, 0xED, 0xF1, 0xF4, 0xF9, 0xFB, 0xFD, 0xFE, 0x00, 0x03, 
-    0x04, 0x08, 0x0B, 0x0E, 0x10, 0x10, 0x0F, 0x0E, 0x0C, 0x0B, 0x0A, 0x08, 
-    0x09, 0x0B, 0x0D, 0x0F, 0x10, 0x10, 0x12, 0x13, 0x16, 0x19, 0x1C, 0x1E, 
-    0x1E, 0x1C, 0x15, 0x0C, 0x05, 0xFF, 0xFE, 0xFE, 0x00, 0x02, 0x05, 0x0B, 
-    0x10, 0x16, 0x1A, 0x1D, 0x20, 0x24, 0x29, 0x2E, 0x30, 0x30, 0x2E, 0x29, 
-    0x24, 0x1E, 0x1B, 0x18, 0x16, 0x14, 0x13, 0x13, 0x14, 0x16, 0x17, 0x17, 
-    0x16, 0x16, 0x16, 0x17, 0x18, 0x17, 0x15, 0x12, 0x10, 0x0C, 0x0B, 0x09, 
-    0x08, 0x09, 0x0B, 0x0E, 0x12, 0x14, 0x14, 0x11, 0x11, 0x11, 0x14, 0x18, 
-    0x1A, 0x1C, 0x1B, 0x1A, 0x1A, 0x19, 0x17, 0x16, 0x16, 0x19, 0x1D, 0x22, 
-    0x24, 0x24, 0x22, 0x1D, 0x19, 0x15, 0x11, 0x0D, 0x0A, 0x06, 0x02, 0xFF, 
-    0xFE, 0xFF, 0x00, 0xFE, 0xFB, 0xF8, 0xF7, 0xF6, 0xF5, 0xF2, 0xEE, 0xEA, 
-    0xE6, 0xE4, 0xE4, 0xE5, 0xE4, 0xE5, 0xE4, 0xE5, 0xE6, 0xE8, 0xE8, 0xE7, 
-    0xE9, 0xEC, 0xF2, 0xF9, 0xFB, 0xFC, 0xFB, 0xF9, 0xFA, 0xF9, 0xFA, 0xFB, 
-    0xFC, 0xFE, 0x02, 0x05, 0x07, 0x07, 0x05, 0x02, 0xFF, 0xFE, 0xFD, 0xFE, 
-    0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFC, 0xFB, 0xF7, 0xF4, 0xF3, 0xF2, 0xF3, 
-    0xF4, 0xF4, 0xF2, 0xF0, 0xEE, 0xEC, 0xEC, 0xED, 0xED, 0xED, 0xEE, 0xEF, 
-    0xF1, 0xF2, 0xF3, 0xF3, 0xF2, 0xF2, 0xF3, 0xF4, 0xF4, 0xF2, 0xEE, 0xEB, 
-    0xE8, 0xE8, 0xE8, 0xEA, 0xEC, 0xEC, 0xED, 0xEE, 0xF0, 0xF2, 0xF1, 0xEF, 
-    0xEC, 0xEB, 0xEA, 0xE9, 0xE7, 0xE3, 0xDF, 0xDB, 0xDB, 0xDC, 0xDD, 0xDE, 
-    0xDD, 0xDD, 0xE0, 0xE3, 0xE6, 0xE9, 0xEB, 0xED, 0xEE, 0xF0, 0xF2, 0xF3, 
-    0xF4, 0xF4, 0xF5, 0xF4, 0xF4, 0xF3, 0xF4, 0xF5, 0xF5, 0xF6, 0xF7, 0xF9, 
-    0xFA, 0xF9, 0xF7, 0xF4, 0xF3, 0xF4, 0xF6, 0xF9, 0xFB, 0xFC, 0xFC, 0xFB, 
-    0xF9, 0xF6, 0xF1, 0xEC, 0xE7, 0xE6, 0xE6, 0xE9, 0xEE, 0xF3, 0xF8, 0xFB, 
-    0xFF, 0x03, 0x06, 0x08, 0x07, 0x03, 0x00, 0xFC, 0xFB, 0xF9, 0xF7, 0xF4, 
-    0xF2, 0xF2, 0xF4, 0xF9, 0xFF, 0x06, 0x0C, 0x10, 0x15, 0x1A, 0x20, 0x23, 
-    0x24, 0x24, 0x23, 0x21, 0x1F, 0x1C, 0x17, 0x11, 0x0C, 0x08, 0x05, 0x04, 
-    0x04, 0x04, 0x03, 0x04, 0x06, 0x08, 0x0A, 0x0A, 0x09, 0x0A, 0x0C, 0x11, 
-    0x15, 0x19, 0x1B, 0x1E, 0x21, 0x23, 0x23, 0x22, 0x1F, 0x1C, 0x1B, 0x1B, 
-    0x1B, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x17, 0x18, 0x1B, 0x1C, 0x1C, 0x1B, 
-    0x1B, 0x1E, 0x22, 0x26, 0x28, 0x26, 0x23, 0x20, 0x1D, 0x1B, 0x17, 0x12, 
-    0x0E, 0x0D, 0x0E, 0x11, 0x14, 0x16, 0x18, 0x18, 0x17, 0x18, 0x18, 0x19, 
-    0x17, 0x15, 0x13, 0x15, 0x18, 0x1A, 0x1A, 0x17, 0x15, 0x13, 0x12, 0x11, 
-    0x10, 0x0F, 0x0F, 0x10, 0x11, 0x12, 0x11, 0x10, 0x0D, 0x0C, 0x0C, 0x0E, 
-    0x10, 0x10, 0x0E, 0x0B, 0x08, 0x06, 0x02, 0xFD, 0xF8, 0xF3, 0xEE, 0xEB, 
-    0xE9, 0xE7, 0xE4, 0xE2, 0xE1, 0xE3, 0xE7, 0xEC, 0xF2, 0xF7, 0xFB, 0xFD, 
-    0xFF, 0x01, 0x01, 0xFF, 0xFD, 0xFA, 0xF8, 0xF8, 0xF9, 0xFB, 0xFD, 0xFE, 
-    0xFF, 0xFE, 0xFF, 0xFE, 0xFC, 0xFB, 0xF9, 0xF7, 0xF6, 0xF5, 0xF5, 0xF5, 
-    0xF3, 0xF1, 0xEF, 0xEE, 0xEE, 0xED, 0xEB, 0xE8, 0xE6, 0xE6, 0xE8, 0xEA, 
-    0xEA, 0xE8, 0xE7, 0xE7, 0xE8, 0xE8, 0xE8, 0xE9, 0xEB, 0xEE, 0xF2, 0xF8, 
-    0xFC, 0x01, 0x03, 0x04, 0x03, 0x01, 0xFE, 0xFC, 0xFA, 0xF8, 0xF7, 0xF6, 
-    0xF7, 0xF8, 0xF7, 0xF3, 0xEF, 0xEB, 0xE8, 0xE6, 0xE6, 0xE5, 0xE4, 0xE2, 
-    0xE0, 0xDE, 0xDC, 0xD9, 0xD8, 0xD7, 0xD9, 0xDB, 0xDE, 0xE0, 0xDF, 0xE1, 
-    0xE3, 0xE6, 0xE8, 0xE7, 0xE5, 0xE3, 0xE1, 0xDF, 0xDB, 0xD8, 0xD8, 0xDA, 
-    0xDE, 0xE4, 0xEC, 0xF5, 0xFE, 0x07, 0x0D, 0x0F, 0x0F, 0x0D, 0x08, 0x01, 
-    0xF8, 0xF0, 0xE9, 0xE4, 0xE0, 0xDF, 0xDE, 0xDF, 0xDF, 0xE0, 0xE3, 0xE6, 
-    0xEC, 0xF2, 0xF6, 0xFA, 0xFC, 0xFE, 0xFF, 0xFE, 0xFD, 0xFB, 0xF8, 0xF5, 
-    0xF3, 0xF0, 0xEE, 0xEF, 0xF0, 0xF2, 0xF6, 0xF8, 0xFA, 0xFD, 0xFE, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x03, 0x06, 0x0C, 0x12, 0x17, 0x1A, 0x1C, 0x1D, 0x1E, 
-    0x1D, 0x1A, 0x17, 0x15, 0x16, 0x17, 0x17, 0x16, 0x14, 0x12, 0x0F, 0x0C, 
-    0x0A, 0x07, 0x07, 0x08, 0x0B, 0x0D, 0x10, 0x11, 0x12, 0x12, 0x13, 0x14, 
-    0x15, 0x18, 0x1A, 0x1C, 0x1B, 0x1A, 0x1B, 0x1C, 0x1D, 0x1F, 0x1D, 0x1C, 
-    0x1B, 0x1C, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1D, 0x1E, 0x20, 0x21, 0x21, 
-    0x20, 0x21, 0x21, 0x20, 0x1E, 0x1A, 0x17, 0x15, 0x14, 0x14, 0x12, 0x11, 
-    0x10, 0x10, 0x10, 0x0F, 0x0D, 0x0B, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 
-    0x09, 0x09, 0x07, 0x08, 0x0A, 0x0E, 0x0F, 0x10, 0x0E, 0x0F, 0x12, 0x16, 
-    0x19, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x17, 0x14, 0x0E, 0x0A, 0x08, 0x09, 
-    0x0B, 0x0D, 0x0E, 0x0D, 0x09, 0x06, 0x03, 0x00, 0xFC, 0xF7, 0xF2, 0xEF, 
-    0xEE, 0xEE, 0xEF, 0xED, 0xEB, 0xE9, 0xE8, 0xE8, 0xE7, 0xE7, 0xE7, 0xE8, 
-    0xE9, 0xE9, 0xEA, 0xEB, 0xED, 0xEF, 0xF1, 0xF4, 0xF9, 0xFD, 0xFF, 0xFF, 
-    0x00, 0x01, 0x03, 0x04, 0x04, 0x02, 0xFF, 0xFC, 0xFA, 0xF8, 0xF6, 0xF3, 
-    0xEF, 0xEC, 0xEC, 0xEC, 0xEF, 0xF1, 0xF2, 0xF1, 0xF0, 0xEF, 0xF0, 0xEF, 
-    0xEC, 0xE8, 0xE7, 0xE7, 0xE8, 0xEA, 0xEC, 0xEE, 0xEF, 0xEE, 0xEF, 0xEE, 
-    0xEF, 0xEF, 0xF0, 0xF1, 0xF0, 0xEF, 0xEE, 0xED, 0xEB, 0xE7, 0xE4, 0xE1, 
-    0xE0, 0xE0, 0xE0, 0xE2, 0xE4, 0xE8, 0xEF, 0xF7, 0xFD, 0x00, 0xFF, 0xFC, 
-    0xF8, 0xF5, 0xEF, 0xE8, 0xE1, 0xDC, 0xD9, 0xD8, 0xD9, 0xD9, 0xD8, 0xD7, 
-    0xD8, 0xDB, 0xE1, 0xE5, 0xE9, 0xEE, 0xF4, 0xFA, 0xFF, 0x04, 0x06, 0x08, 
-    0x08, 0x05, 0x01, 0xFE, 0xFB, 0xF8, 0xF6, 0xF4, 0xF2, 0xF0, 0xEF, 0xEE, 
-    0xEF, 0xEF, 0xF0, 0xF2, 0xF3, 0xF4, 0xF2, 0xF1, 0xF0, 0xF1, 0xF1, 0xF0, 
-    0xEE, 0xEA, 0xE7, 0xE5, 0xE4, 0xE5, 0xE4, 0xE3, 0xE5, 0xE9, 0xEF, 0xF6, 
-    0xFB, 0xFD, 0xFE, 0xFF, 0x00, 0x03, 0x05, 0x05, 0x04, 0x05, 0x09, 0x0E, 
-    0x13, 0x18, 0x1B, 0x1C, 0x1C, 0x1A, 0x17, 0x15, 0x11, 0x0F, 0x0D, 0x0B, 
-    0x09, 0x08, 0x07, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0A, 0x0A, 0x0B, 
-    0x0B, 0x0D, 0x0F, 0x10, 0x11, 0x10, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 0x0D, 
-    0x0F, 0x13, 0x19, 0x1F, 0x23, 0x24, 0x23, 0x24, 0x25, 0x26, 0x25, 0x22, 
-    0x20, 0x1F, 0x20, 0x23, 0x26, 0x28, 0x29, 0x28, 0x26, 0x25, 0x22, 0x1F, 
-    0x1C, 0x1A, 0x19, 0x18, 0x19, 0x18, 0x19, 0x18, 0x17, 0x18, 0x19, 0x19, 
-    0x1A, 0x18, 0x16, 0x14, 0x13, 0x15, 0x17, 0x17, 0x13, 0x11, 0x10, 0x0F, 
-    0x10, 0x0E, 0x0D, 0x0C, 0x0D, 0x11, 0x16, 0x1A, 0x1A, 0x18, 0x17, 0x16, 
-    0x16, 0x15, 0x11, 0x0D, 0x0B, 0x0A, 0x0B, 0x0C, 0x0D, 0x0C, 0x0C, 0x0B, 
-    0x09, 0x04, 0x00, 0xFC, 0xF8, 0xF5, 0xF1, 0xED, 0xE9, 0xE7, 0xE5, 0xE4, 
-    0xE4, 0xE5, 0xE8, 0xE9, 0xE8, 0xE8, 0xE8, 0xE9, 0xEB, 0xEE, 0xF0, 0xEF, 
-    0xEC, 0xEC, 0xED, 0xED, 0xEE, 0xED, 0xEC, 0xEE, 0xF3, 0xF9, 0xFE, 0x01, 
-    0x02, 0x01, 0x00, 0x00, 0xFF, 0xFD, 0xFB, 0xF9, 0xF7, 0xF6, 0xF5, 0xF3, 
-    0xF0, 0xEC, 0xE6, 0xE1, 0xDC, 0xD8, 0xD7, 0xD8, 0xDA, 0xDD, 0xE0, 0xE2, 
-    0xE5, 0xEA, 0xEE, 0xF1, 0xF2, 0xF4, 0xF5, 0xF4, 0xF2, 0xEE, 0xE9, 0xE5, 
-    0xE3, 0xE1, 0xDE, 0xDA, 0xD8, 0xD9, 0xDE, 0xE4, 0xE9, 0xEE, 0xF4, 0xFB, 
-    0x03, 0x0C, 0x11, 0x13, 0x12, 0x0F, 0x0B, 0x07, 0x02, 0xF9, 0xF0, 0xE8, 
-    0xE2, 0xDF, 0xDD, 0xDB, 0xD9, 0xD8, 0xDA, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 
-    0xDD, 0xDD, 0xDB, 0xDA, 0xDB, 0xDD, 0xE0, 0xE3, 0xE7, 0xE9, 0xEC, 0xEE, 
-    0xF0, 0xF2, 0xF3, 0xF6, 0xFA, 0xFC, 0xFC, 0xF9, 0xF6, 0xF4, 0xF3, 0xF3, 
-    0xF4, 0xF4, 0xF6, 0xF9, 0xFD, 0x01, 0x01, 0xFF, 0xFA, 0xF5, 0xF0, 0xEB, 
-    0xE4, 0xDF, 0xDC, 0xDD, 0xE1, 0xE4, 0xE7, 0xEA, 0xEC, 0xEF, 0xF0, 0xF1, 
-    0xF0, 0xF0, 0xF1, 0xF4, 0xF8, 0xFA, 0xFC, 0xFE, 0x01, 0x06, 0x0B, 0x0F, 
-    0x12, 0x16, 0x18, 0x1A, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x1F, 0x1B, 0x17, 
-    0x14, 0x12, 0x13, 0x12, 0x11, 0x12, 0x12, 0x13, 0x16, 0x17, 0x16, 0x13, 
-    0x10, 0x0F, 0x0E, 0x0F, 0x0E, 0x0F, 0x10, 0x14, 0x18, 0x1C, 0x1F, 0x22, 
-    0x26, 0x29, 0x2A, 0x29, 0x27, 0x24, 0x22, 0x20, 0x1F, 0x1E, 0x1D, 0x1E, 
-    0x1F, 0x21, 0x25, 0x28, 0x2B, 0x2B, 0x2A, 0x29, 0x28, 0x27, 0x26, 0x25, 
-    0x22, 0x1D, 0x18, 0x13, 0x10, 0x0D, 0x0A, 0x08, 0x07, 0x08, 0x0B, 0x0F, 
-    0x14, 0x18, 0x19, 0x18, 0x16, 0x17, 0x17, 0x16, 0x14, 0x12, 0x11, 0x13, 
-    0x15, 0x16, 0x17, 0x18, 0x19, 0x1B, 0x1B, 0x19, 0x18, 0x15, 0x12, 0x0F, 
-    0x0D, 0x0B, 0x0A, 0x0A, 0x09, 0x0B, 0x0C, 0x0C, 0x0B, 0x09, 0x06, 0x04, 
-    0x01, 0xFF, 0xFD, 0xFA, 0xF5, 0xF0, 0xED, 0xEB, 0xEA, 0xEB, 0xEC, 0xED, 
-    0xEF, 0xF0, 0xF3, 0xF4, 0xF4, 0xF2, 0xED, 0xE9, 0xE7, 0xE8, 0xEB, 0xEC, 
-    0xEE, 0xF1, 0xF6, 0xFE, 0x06, 0x0C, 0x11, 0x14, 0x16, 0x16, 0x13, 0x0D, 
-    0x05, 0xFD, 0xF6, 0xEE, 0xE7, 0xE0, 0xDC, 0xDB, 0xDC, 0xDF, 0xE3, 0xE8, 
-    0xED, 0xF1, 0xF4, 0xF7, 0xFA, 0xFD, 0x01, 0x01, 0xFE, 0xF9, 0xF5, 0xF1, 
-    0xED, 0xE8, 0xE4, 0xDF, 0xDE, 0xDE, 0xE0, 0xE3, 0xE5, 0xE6, 0xE5, 0xE5, 
-    0xE8, 0xED, 0xEF, 0xF1, 0xF1, 0xF3, 0xF6, 0xF9, 0xFC, 0xFC, 0xFB, 0xFA, 
-    0xF9, 0xF8, 0xF6, 0xF3, 0xEE, 0xEB, 0xE8, 0xE7, 0xE6, 0xE5, 0xE6, 0xE6, 
-    0xE5, 0xE4, 0xE2, 0xE1, 0xDF, 0xDE, 0xDD, 0xDC, 0xDC, 0xDF, 0xE1, 0xE1, 
-    0xDE, 0xDA, 0xD9, 0xD9, 0xDA, 0xDD, 0xE0, 0xE2, 0xE6, 0xEB, 0xF0, 0xF5, 
-    0xF8, 0xF8, 0xF7, 0xF6, 0xF7, 0xF6, 0xF7, 0xF6, 0xF5, 0xF6, 0xF8, 0xFB, 
-    0xFE, 0x00, 0xFF, 0xFC, 0xF8, 0xF4, 0xF0, 0xEC, 0xE8, 0xE5, 0xE1, 0xDE, 
-    0xDC, 0xDD, 0xE0, 0xE4, 0xE8, 0xEC, 0xEF, 0xEF, 0xF0, 0xF1, 0xF2, 0xF2, 
-    0xF1, 0xF3, 0xF2, 0xF1, 0xEF, 0xEF, 0xEE, 0xF0, 0xF5, 0xFC, 0x04, 0x0C, 
-    0x12, 0x18, 0x1F, 0x23, 0x26, 0x27, 0x26, 0x24, 0x23, 0x23, 0x22, 0x20, 
-    0x1E, 0x1C, 0x1B, 0x1B, 0x1A, 0x19, 0x17, 0x15, 0x12, 0x0F, 0x0B, 0x09, 
-    0x08, 0x07, 0x06, 0x04, 0x03, 0x04, 0x06, 0x0A, 0x0D, 0x0E, 0x10, 0x11, 
-    0x14, 0x17, 0x1A, 0x1D, 0x1F, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x26, 
-    0x28, 0x2C, 0x30, 0x33, 0x36, 0x37, 0x38, 0x37, 0x35, 0x32, 0x30, 0x2C, 
-    0x28, 0x23, 0x1E, 0x19, 0x16, 0x14, 0x13, 0x11, 0x10, 0x0F, 0x0F, 0x0E, 
-    0x0D, 0x0C, 0x0B, 0x09, 0x08, 0x07, 0x04, 0x03, 0x02, 0x03, 0x05, 0x09, 
-    0x0C, 0x0F, 0x12, 0x14, 0x17, 0x18, 0x18, 0x17, 0x16, 0x12, 0x0D, 0x09, 
-    0x05, 0x01, 0x00, 0xFF, 0x00, 0x03, 0x08, 0x0E, 0x14, 0x19, 0x1C, 0x1C, 
-    0x1B, 0x18, 0x13, 0x0D, 0x05, 0xFB, 0xF2, 0xEA, 0xE3, 0xDE, 0xDA, 0xD8, 
-    0xD6, 0xD7, 0xD8, 0xDB, 0xDE, 0xE2, 0xE6, 0xEC, 0xF4, 0xFA, 0x00, 0x05, 
-    0x08, 0x09, 0x0A, 0x09, 0x09, 0x06, 0x02, 0xFC, 0xF7, 0xF4, 0xF3, 0xF4, 
-    0xF3, 0xF2, 0xF0, 0xEF, 0xF0, 0xF2, 0xF4, 0xF4, 0xF5, 0xF6, 0xF7, 0xF9, 
-    0xFA, 0xF8, 0xF6, 0xF4, 0xF2, 0xF0, 0xEF, 0xED, 0xEC, 0xEB, 0xEA, 0xEB, 
-    0xEE, 0xF1, 0xF4, 0xF6, 0xF7, 0xF6, 0xF4, 0xF3, 0xF0, 0xEE, 0xEC, 0xEB, 
-    0xEC, 0xEE, 0xEF, 0xF0, 0xF0, 0xF1, 0xF2, 0xF4, 0xF4, 0xF5, 0xF4, 0xF3, 
-    0xF3, 0xF4, 0xF5, 0xF6, 0xF5, 0xF2, 0xEE, 0xE9, 0xE6, 0xE4, 0xE2, 0xE1, 
-    0xE0, 0xE1, 0xE2, 0xE4, 0xE5, 0xE6, 0xE5, 0xE3, 0xE1, 0xE0, 0xDF, 0xE0, 
-    0xDF, 0xDF, 0xDE, 0xDF, 0xE4, 0xE9, 0xEE, 0xF0, 0xF2, 0xF1, 0xF1, 0xF1, 
-    0xF0, 0xEE, 0xEB, 0xE9, 0xE9, 0xE8, 0xE9, 0xE8, 0xE9, 0xEA, 0xED, 0xEF, 
-    0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF4, 0xF3, 0xF1, 0xEF, 0xEC, 0xE9, 0xE6, 
-    0xE5, 0xE6, 0xE8, 0xEA, 0xED, 0xF0, 0xF2, 0xF4, 0xF6, 0xF8, 0xF9, 0xFA, 
-    0xFA, 0xFC, 0xFD, 0xFE, 0x00, 0x02, 0x06, 0x08, 0x0D, 0x10, 0x13, 0x15, 
-    0x15, 0x13, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x0D, 0x0E, 0x10, 0x12, 0x16, 
-    0x18, 0x19, 0x1A, 0x1A, 0x1B, 0x1C, 0x1C, 0x1B, 0x1A, 0x18, 0x17, 0x16, 
-    0x14, 0x12, 0x0F, 0x0D, 0x0C, 0x0D, 0x10, 0x13, 0x16, 0x17, 0x18, 0x1A, 
-    0x1C, 0x1F, 0x21, 0x21, 0x20, 0x1D, 0x1C, 0x1E, 0x21, 0x23, 0x24, 0x24, 
-    0x26, 0x28, 0x2B, 0x2C, 0x2E, 0x2D, 0x2B, 0x28, 0x25, 0x22, 0x1C, 0x16, 
-    0x11, 0x0D, 0x08, 0x05, 0x02, 0x00, 0xFD, 0xFE, 0xFF, 0x02, 0x07, 0x0C, 
-    0x10, 0x13, 0x17, 0x18, 0x19, 0x18, 0x17, 0x13, 0x0E, 0x0C, 0x09, 0x05, 
-    0x05, 0x06, 0x01, 0x00, 0x04, 0x07, 0x0A, 0x0B, 0x0F, 0x10, 0x14, 0x15, 
-    0x1B, 0x1F, 0x25, 0x27, 0x26, 0x2C, 0x26, 0x2A, 0x22, 0x19, 0x12, 0x0A, 
-    0x04, 0xF7, 0xF4, 0xEA, 0xE3, 0xE6, 0xE1, 0xDC, 0xDB, 0xDA, 0xD8, 0xDB, 
-    0xDB, 0xDB, 0xD8, 0xD2, 0xD6, 0xD7, 0xDD, 0xDF, 0xE0, 0xE4, 0xE9, 0xF0, 
-    0xF1, 0xFC, 0x03, 0x09, 0x12, 0x18, 0x17, 0x1B, 0x1B, 0x1D, 0x23, 0x1C, 
-    0x23, 0x1F, 0x1D, 0x18, 0x12, 0x11, 0x0A, 0x0D, 0x05, 0x01, 0xFD, 0xF1, 
-    0xFA, 0xF4, 0xEC, 0xE7, 0xDC, 0xE6, 0xDF, 0xDC, 0xD9, 0xD7, 0xD4, 0xD6, 
-    0xD9, 0xE2, 0xE3, 0xE3, 0xED, 0xE7, 0xF0, 0xF3, 0xE9, 0xE7, 0xEA, 0xE6, 
-    0xE6, 0xE6, 0xE9, 0xE8, 0xE9, 0xEC, 0xF4, 0xF6, 0xFB, 0xFB, 0xF8, 0xFA, 
-    0xFB, 0x01, 0xF7, 0xFA, 0xF0, 0xE5, 0xE2, 0xE2, 0xE4, 0xDD, 0xDC, 0xDA, 
-    0xDB, 0xDC, 0xDC, 0xDB, 0xD6, 0xD5, 0xD1, 0xC9, 0xCB, 0xC6, 0xC3, 0xC5, 
-    0xBF, 0xC4, 0xC7, 0xC5, 0xD5, 0xD7, 0xDB, 0xE1, 0xDC, 0xE1, 0xDD, 0xDF, 
-    0xDB, 0xDC, 0xDC, 0xDA, 0xDE, 0xE2, 0xE8, 0xE6, 0xF0, 0xF4, 0xF9, 0xFD, 
-    0xFD, 0xFE, 0xF5, 0xFA, 0xF7, 0xF7, 0xF5, 0xF2, 0xE9, 0xED, 0xF2, 0xF5, 
-    0xFD, 0x01, 0x08, 0x0C, 0x11, 0x16, 0x1A, 0x18, 0x1D, 0x17, 0x18, 0x15, 
-    0x15, 0x17, 0x10, 0x19, 0x19, 0x16, 0x1D, 0x20, 0x20, 0x24, 0x23, 0x28, 
-    0x26, 0x23, 0x25, 0x23, 0x24, 0x20, 0x1D, 0x1D, 0x1A, 0x1B, 0x1D, 0x20, 
-    0x22, 0x20, 0x24, 0x21, 0x25, 0x24, 0x24, 0x22, 0x1E, 0x1C, 0x17, 0x19, 
-    0x0D, 0x0D, 0x08, 0x06, 0x07, 0x07, 0x0B, 0x0B, 0x0A, 0x07, 0x0A, 0x03, 
-    0xFF, 0xFF, 0xFC, 0xF7, 0xF9, 0xF2, 0xEF, 0xF4, 0xF2, 0xF8, 0xFB, 0xFE, 
-    0x01, 0x07, 0x08, 0x0D, 0x0D, 0x0C, 0x0B, 0x07, 0x04, 0x00, 0xFC, 0xF8, 
-    0xFA, 0xF7, 0xF8, 0xF8, 0xFD, 0x03, 0x0A, 0x11, 0x12, 0x10, 0x11, 0x12, 
-    0x0D, 0x0E, 0x07, 0x01, 0x04, 0x02, 0x08, 0x05, 0x0A, 0x12, 0x15, 0x1F, 
-    0x21, 0x20, 0x1C, 0x1C, 0x18, 0x1A, 0x18, 0x16, 0x12, 0x10, 0x0D, 0x12, 
-    0x15, 0x17, 0x1F, 0x1D, 0x27, 0x26, 0x2E, 0x2C, 0x29, 0x28, 0x20, 0x1C, 
-    0x16, 0x18, 0x11, 0x10, 0x0D, 0x0A, 0x0C, 0x0D, 0x10, 0x18, 0x1B, 0x19, 
-    0x1C, 0x18, 0x1D, 0x19, 0x19, 0x1A, 0x14, 0x12, 0x10, 0x12, 0x11, 0x10, 
-    0x10, 0x0D, 0x0D, 0x13, 0x0E, 0x10, 0x0E, 0x07, 0x07, 0x04, 0x01, 0xFF, 
-    0xFD, 0xF9, 0xF4, 0xF2, 0xF1, 0xEF, 0xEF, 0xEF, 0xEB, 0xEA, 0xEA, 0xE4, 
-    0xE4, 0xDD, 0xD9, 0xD3, 0xD1, 0xCE, 0xD1, 0xCF, 0xD0, 0xD4, 0xD4, 0xD9, 
-    0xDB, 0xE1, 0xDF, 0xE4, 0xDE, 0xDD, 0xDE, 0xDB, 0xD8, 0xD4, 0xCC, 0xC9, 
-    0xCB, 0xC9, 0xD0, 0xCF, 0xD4, 0xD8, 0xDB, 0xE0, 0xDF, 0xE3, 0xE0, 0xD7, 
-    0xD6, 0xD2, 0xCD, 0xC9, 0xC7, 0xC1, 0xC4, 0xC5, 0xC5, 0xD0, 0xD1, 0xD7, 
-    0xD7, 0xD7, 0xDB, 0xD6, 0xD9, 0xD4, 0xCF, 0xCF, 0xCE, 0xD0, 0xD2, 0xD9, 
-    0xD6, 0xE3, 0xE3, 0xED, 0xF7, 0xF9, 0x02, 0xFF, 0xFE, 0xFE, 0x02, 0x01, 
-    0x05, 0x00, 0x06, 0x03, 0x09, 0x11, 0x12, 0x17, 0x1A, 0x17, 0x15, 0x17, 
-    0x10, 0x0D, 0x07, 0x03, 0x00, 0xFC, 0xF7, 0xFC, 0xF6, 0xFD, 0x01, 0x02, 
-    0x0A, 0x0C, 0x0F, 0x16, 0x16, 0x17, 0x18, 0x14, 0x12, 0x0E, 0x10, 0x10, 
-    0x12, 0x16, 0x1B, 0x1A, 0x1E, 0x20, 0x24, 0x2A, 0x2C, 0x2E, 0x2E, 0x2A, 
-    0x29, 0x26, 0x26, 0x21, 0x1B, 0x19, 0x11, 0x16, 0x13, 0x17, 0x1A, 0x1A, 
-    0x19, 0x19, 0x14, 0x10, 0x0D, 0x0B, 0x05, 0x04, 0xFF, 0xF6, 0xF9, 0xF1, 
-    0xF5, 0xF0, 0xF2, 0xF3, 0xF7, 0xFB, 0x00, 0x06, 0x05, 0x10, 0x09, 0x0B, 
-    0x09, 0x02, 0x01, 0xFF, 0xFF, 0x01, 0x04, 0x07, 0x10, 0x15, 0x20, 0x27, 
-    0x2B, 0x2F, 0x2D, 0x2A, 0x27, 0x23, 0x1B, 0x18, 0x0E, 0x08, 0x00, 0x00, 
-    0xFF, 0x01, 0x01, 0x03, 0x05, 0x05, 0x09, 0x05, 0x0A, 0x07, 0x07, 0x08, 
-    0x04, 0x04, 0x03, 0x02, 0x01, 0x06, 0x0B, 0x12, 0x18, 0x1D, 0x23, 0x24, 
-    0x29, 0x27, 0x29, 0x24, 0x1D, 0x1C, 0x18, 0x18, 0x1C, 0x1B, 0x1B, 0x1F, 
-    0x20, 0x28, 0x29, 0x2F, 0x2C, 0x2B, 0x27, 0x24, 0x23, 0x22, 0x21, 0x1C, 
-    0x17, 0x15, 0x15, 0x14, 0x19, 0x16, 0x1C, 0x18, 0x1B, 0x1A, 0x17, 0x19, 
-    0x15, 0x14, 0x13, 0x13, 0x0D, 0x10, 0x0B, 0x09, 0x0A, 0x07, 0x07, 0x0A, 
-    0x0A, 0x08, 0x0B, 0x09, 0x08, 0x06, 0x07, 0x05, 0x00, 0x00, 0x01, 0x01, 
-    0x03, 0x03, 0x01, 0x03, 0x05, 0x07, 0x0A, 0x0A, 0x09, 0x04, 0x01, 0xFF, 
-    0xFC, 0xFD, 0xF8, 0xF3, 0xF0, 0xEE, 0xEF, 0xF0, 0xF2, 0xF2, 0xF0, 0xF1, 
-    0xF1, 0xF0, 0xEE, 0xEA, 0xE7, 0xDF, 0xDB, 0xD5, 0xD2, 0xD0, 0xCB, 0xCC, 
-    0xCD, 0xCE, 0xD1, 0xD6, 0xDB, 0xDF, 0xE3, 0xE3, 0xE4, 0xE5, 0xE2, 0xE2, 
-    0xDA, 0xD8, 0xD4, 0xD0, 0xD0, 0xD0, 0xD0, 0xD2, 0xD3, 0xD7, 0xDC, 0xD9, 
-    0xD9, 0xD6, 0xD0, 0xCE, 0xCD, 0xC9, 0xC8, 0xC5, 0xC6, 0xC8, 0xCD, 0xD3, 
-    0xD6, 0xDB, 0xDE, 0xE0, 0xDF, 0xE2, 0xDF, 0xDD, 0xDD, 0xD9, 0xD9, 0xD7, 
-    0xD6, 0xD8, 0xD9, 0xDA, 0xDC, 0xDE, 0xE0, 0xE1, 0xE0, 0xE3, 0xE2, 0xDE, 
-    0xDE, 0xDC, 0xD8, 0xD7, 0xD3, 0xD4, 0xD6, 0xDA, 0xE0, 0xE4, 0xEA, 0xF0, 
-    0xF4, 0xFB, 0xFE, 0xFB, 0xFC, 0xF6, 0xF4, 0xF4, 0xF6, 0xF8, 0xFA, 0xFC, 
-    0x01, 0x08, 0x0B, 0x13, 0x18, 0x1B, 0x1E, 0x21, 0x22, 0x24, 0x25, 0x24, 
-    0x26, 0x25, 0x22, 0x24, 0x23, 0x25, 0x26, 0x2B, 0x30, 0x32, 0x37, 0x37, 
-    0x3A, 0x3D, 0x3E, 0x3D, 0x38, 0x35, 0x30, 0x2A, 0x2B, 0x28, 0x26, 0x26, 
-    0x25, 0x28, 0x2A, 0x2E, 0x31, 0x35, 0x37, 0x37, 0x35, 0x34, 0x31, 0x32, 
-    0x33, 0x2E, 0x2C, 0x29, 0x2A, 0x2B, 0x2D, 0x30, 0x2F, 0x30, 0x33, 0x34, 
-    0x34, 0x33, 0x34, 0x32, 0x2E, 0x2B, 0x26, 0x24, 0x27, 0x28, 0x2B, 0x31, 
-    0x32, 0x34, 0x34, 0x35, 0x35, 0x33, 0x32, 0x2F, 0x2D, 0x2A, 0x27, 0x24, 
-    0x22, 0x23, 0x23, 0x22, 0x23, 0x26, 0x27, 0x2A, 0x2D, 0x2A, 0x27, 0x21, 
-    0x19, 0x12, 0x0C, 0x0A, 0x06, 0x02, 0xFF, 0xFF, 0x00, 0x05, 0x0A, 0x0A, 
-    0x0B, 0x0B, 0x07, 0x09, 0x00, 0xFB, 0xF6, 0xEE, 0xE8, 0xE6, 0xE2, 0xDE, 
-    0xDF, 0xDF, 0xE3, 0xE6, 0xEC, 0xEB, 0xEB, 0xEC, 0xEA, 0xEA, 0xEB, 0xE9, 
-    0xEA, 0xE4, 0xE2, 0xE0, 0xDD, 0xE1, 0xE2, 0xE2, 0xE4, 0xE7, 0xEB, 0xF0, 
-    0xF2, 0xF2, 0xF0, 0xEE, 0xE8, 0xE6, 0xE2, 0xDF, 0xDD, 0xD9, 0xD5, 0xD6, 
-    0xD4, 0xD3, 0xD3, 0xD0, 0xD0, 0xCF, 0xCF, 0xCA, 0xC7, 0xC6, 0xC3, 0xC2, 
-    0xC3, 0xC1, 0xC2, 0xC1, 0xC1, 0xC3, 0xC4, 0xC8, 0xC8, 0xC8, 0xCB, 0xCB, 
-    0xCD, 0xCF, 0xCF, 0xD1, 0xD0, 0xD2, 0xCE, 0xCE, 0xCF, 0xD1, 0xD7, 0xD9, 
-    0xDE, 0xE3, 0xE9, 0xED, 0xF1, 0xF1, 0xF0, 0xEE, 0xEA, 0xEB, 0xEA, 0xED, 
-    0xEB, 0xE9, 0xED, 0xED, 0xF1, 0xF6, 0xF6, 0xF6, 0xF2, 0xF0, 0xEF, 0xEB, 
-    0xEB, 0xE6, 0xDE, 0xDB, 0xD8, 0xD7, 0xD4, 0xD3, 0xD5, 0xD9, 0xDD, 0xE3, 
-    0xE8, 0xEC, 0xEF, 0xF0, 0xF1, 0xEE, 0xED, 0xE9, 0xE3, 0xDF, 0xDB, 0xDD, 
-    0xDE, 0xE1, 0xE3, 0xE6, 0xEC, 0xF2, 0xFB, 0xFF, 0x00, 0xFE, 0xFC, 0xFB, 
-    0xFA, 0xFB, 0xF7, 0xF7, 0xF6, 0xF4, 0xF7, 0xFA, 0x00, 0x05, 0x09, 0x0A, 
-    0x0C, 0x0E, 0x0F, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0C, 0x0B, 0x09, 0x09, 
-    0x0A, 0x08, 0x0B, 0x0B, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0E, 0x0D, 
-    0x0F, 0x10, 0x11, 0x15, 0x17, 0x1B, 0x1D, 0x1F, 0x20, 0x24, 0x24, 0x25, 
-    0x23, 0x20, 0x1F, 0x1A, 0x1A, 0x1A, 0x1C, 0x1E, 0x20, 0x20, 0x23, 0x25, 
-    0x2B, 0x30, 0x32, 0x32, 0x30, 0x2F, 0x2C, 0x2C, 0x29, 0x22, 0x21, 0x1E, 
-    0x1B, 0x1C, 0x1B, 0x1C, 0x1D, 0x21, 0x23, 0x23, 0x24, 0x22, 0x21, 0x20, 
-    0x1D, 0x1D, 0x18, 0x15, 0x11, 0x0B, 0x09, 0x06, 0x0A, 0x09, 0x0C, 0x0E, 
-    0x0F, 0x15, 0x17, 0x18, 0x18, 0x14, 0x10, 0x0C, 0x06, 0x02, 0x01, 0xFF, 
-    0xFD, 0xFD, 0xFF, 0x02, 0x07, 0x0E, 0x10, 0x12, 0x12, 0x13, 0x13, 0x15, 
-    0x16, 0x15, 0x16, 0x16, 0x16, 0x17, 0x19, 0x19, 0x1B, 0x1B, 0x1C, 0x1C, 
-    0x1A, 0x1C, 0x1A, 0x19, 0x18, 0x16, 0x12, 0x11, 0x0E, 0x0B, 0x0C, 0x0A, 
-    0x08, 0x09, 0x07, 0x07, 0x07, 0x04, 0x03, 0x00, 0xFC, 0xFC, 0xF7, 0xF5, 
-    0xF7, 0xF8, 0xFA, 0xFD, 0xFF, 0x03, 0x07, 0x0B, 0x0E, 0x0C, 0x0C, 0x06, 
-    0x01, 0xFE, 0xF9, 0xF9, 0xF6, 0xF7, 0xF8, 0xF8, 0xFA, 0xFD, 0xFE, 0x03, 
-    0x06, 0x08, 0x0B, 0x0B, 0x0F, 0x12, 0x13, 0x13, 0x11, 0x0F, 0x0C, 0x0A, 
-    0x0C, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x0D, 0x0D, 0x0D, 0x0E, 0x0B, 0x07, 
-    0x03, 0xFF, 0xFA, 0xF7, 0xF1, 0xEE, 0xEC, 0xE9, 0xEC, 0xEA, 0xEC, 0xED, 
-    0xEF, 0xF1, 0xF2, 0xF4, 0xF2, 0xF1, 0xF1, 0xF0, 0xEC, 0xEA, 0xE6, 0xE4, 
-    0xE0, 0xE0, 0xDF, 0xE0, 0xE3, 0xE1, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE3, 
-    0xE2, 0xE1, 0xDF, 0xE0, 0xDF, 0xDF, 0xE1, 0xE2, 0xE5, 0xE6, 0xE9, 0xEB, 
-    0xEB, 0xEC, 0xEB, 0xE9, 0xE4, 0xE0, 0xDD, 0xD9, 0xD8, 0xD6, 0xD5, 0xD6, 
-    0xD8, 0xDC, 0xDD, 0xDE, 0xDB, 0xD9, 0xD4, 0xCF, 0xCA, 0xC5, 0xC1, 0xBE, 
-    0xBB, 0xBB, 0xBB, 0xBC, 0xC0, 0xC3, 0xC8, 0xCE, 0xD5, 0xD8, 0xD9, 0xDA, 
-    0xD9, 0xD8, 0xDA, 0xD9, 0xD7, 0xD7, 0xD8, 0xD9, 0xDB, 0xDE, 0xE2, 0xE8, 
-    0xED, 0xF3, 0xF7, 0xFB, 0xFE, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0xFF, 0x02, 0x06, 0x0A, 0x0F, 0x12, 0x16, 0x16, 0x17, 0x19, 0x15, 
-    0x15, 0x13, 0x10, 0x0E, 0x0B, 0x07, 0x06, 0x04, 0x02, 0x01, 0xFE, 0xFE, 
-    0xFE, 0x03, 0x06, 0x08, 0x0B, 0x0B, 0x0B, 0x0D, 0x0C, 0x0A, 0x08, 0x04, 
-    0x00, 0x01, 0x00, 0x02, 0x04, 0x08, 0x0B, 0x0D, 0x13, 0x13, 0x15, 0x13, 
-    0x12, 0x15, 0x15, 0x17, 0x1A, 0x1D, 0x1E, 0x23, 0x24, 0x28, 0x2A, 0x2D, 
-    0x2E, 0x2D, 0x2C, 0x2B, 0x2D, 0x2C, 0x2B, 0x26, 0x23, 0x20, 0x1F, 0x1F, 
-    0x20, 0x22, 0x24, 0x27, 0x29, 0x2A, 0x29, 0x27, 0x22, 0x1F, 0x1A, 0x16, 
-    0x10, 0x0C, 0x09, 0x06, 0x08, 0x09, 0x0A, 0x0E, 0x14, 0x18, 0x18, 0x18, 
-    0x17, 0x16, 0x17, 0x13, 0x12, 0x0D, 0x09, 0x0A, 0x09, 0x0B, 0x0B, 0x0D, 
-    0x0E, 0x11, 0x14, 0x15, 0x16, 0x15, 0x15, 0x15, 0x17, 0x16, 0x17, 0x14, 
-    0x12, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12, 0x10, 
-    0x0D, 0x0B, 0x09, 0x09, 0x07, 0x06, 0x04, 0x01, 0xFD, 0xFD, 0xFB, 0xFC, 
-    0xFC, 0xFB, 0xFB, 0xFA, 0xFC, 0xFD, 0xFF, 0x00, 0xFD, 0xFC, 0xFB, 0xFB, 
-    0xFC, 0xF8, 0xF5, 0xEF, 0xEC, 0xEA, 0xEB, 0xE8, 0xE4, 0xE2, 0xDF, 0xDE, 
-    0xDD, 0xDF, 0xE0, 0xE1, 0xE3, 0xE5, 0xE6, 0xEB, 0xEF, 0xF4, 0xF7, 0xF9, 
-    0xFA, 0xFA, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xFE, 0xFA, 0xF7, 0xF5, 0xF4, 
-    0xF3, 0xF0, 0xF1, 0xF2, 0xF7, 0xF7, 0xF7, 0xF5, 0xF2, 0xEF, 0xEB, 0xE4, 
-    0xDD, 0xD8, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDE, 0xE1, 0xE6, 0xE7, 0xE8, 
-    0xE6, 0xE4, 0xE3, 0xE1, 0xDD, 0xDC, 0xD6, 0xD1, 0xCE, 0xC8, 0xC8, 0xC8, 
-    0xCB, 0xD0, 0xD4, 0xD7, 0xDB, 0xDE, 0xE5, 0xEA, 0xEB, 0xED, 0xED, 0xED, 
-    0xEF, 0xF1, 0xF0, 0xF0, 0xF1, 0xF4, 0xF8, 0xFE, 0x02, 0x02, 0x01, 0x01, 
-    0x00, 0xFF, 0x00, 0xFC, 0xFA, 0xF9, 0xF9, 0xFC, 0xFC, 0xFD, 0xFE, 0xFD, 
-    0xFD, 0xFD, 0xFB, 0xF9, 0xF9, 0xFB, 0xFC, 0xFC, 0xFE, 0xFE, 0x01, 0x06, 
-    0x07, 0x08, 0x08, 0x0A, 0x0F, 0x11, 0x14, 0x14, 0x16, 0x17, 0x17, 0x16, 
-    0x15, 0x14, 0x12, 0x14, 0x12, 0x13, 0x16, 0x18, 0x1C, 0x1E, 0x21, 0x25, 
-    0x29, 0x29, 0x27, 0x27, 0x26, 0x28, 0x28, 0x27, 0x25, 0x23, 0x26, 0x27, 
-    0x28, 0x28, 0x27, 0x26, 0x27, 0x29, 0x29, 0x28, 0x26, 0x22, 0x20, 0x1E, 
-    0x1A, 0x16, 0x0F, 0x0C, 0x08, 0x07, 0x09, 0x0C, 0x11, 0x15, 0x18, 0x1A, 
-    0x1C, 0x1C, 0x1E, 0x1F, 0x1C, 0x1A, 0x17, 0x13, 0x11, 0x0E, 0x0D, 0x0C, 
-    0x0A, 0x0B, 0x0D, 0x10, 0x13, 0x14, 0x15, 0x14, 0x15, 0x14, 0x15, 0x12, 
-    0x12, 0x12, 0x12, 0x15, 0x13, 0x13, 0x13, 0x15, 0x16, 0x17, 0x15, 0x12, 
-    0x0F, 0x0E, 0x0D, 0x0B, 0x09, 0x06, 0x03, 0x02, 0x02, 0x00, 0x00, 0xFE, 
-    0xFC, 0xF9, 0xF7, 0xF3, 0xEE, 0xED, 0xEB, 0xEC, 0xEE, 0xEE, 0xF0, 0xF1, 
-    0xF2, 0xF5, 0xF6, 0xF6, 0xF7, 0xF7, 0xF7, 0xF5, 0xF2, 0xED, 0xE8, 0xE3, 
-    0xE2, 0xE0, 0xDD, 0xDC, 0xDC, 0xE1, 0xE7, 0xED, 0xF0, 0xF1, 0xF3, 0xF6, 
-    0xFA, 0xFD, 0xFB, 0xF9, 0xF7, 0xF7, 0xF9, 0xF9, 0xF8, 0xF7, 0xF6, 0xF5, 
-    0xF3, 0xF1, 0xED, 0xEA, 0xE6, 0xE6, 0xE5, 0xE6, 0xE6, 0xE5, 0xE6, 0xE4, 
-    0xE3, 0xE1, 0xDE, 0xD9, 0xD5, 0xD2, 0xD0, 0xD1, 0xD5, 0xD9, 0xDB, 0xDB, 
-    0xDA, 0xDA, 0xDC, 0xDF, 0xE0, 0xE0, 0xDD, 0xDD, 0xDF, 0xE2, 0xE3, 0xE3, 
-    0xE1, 0xE0, 0xDF, 0xDF, 0xDF, 0xDE, 0xDF, 0xE0, 0xE1, 0xE4, 0xE6, 0xE9, 
-    0xEA, 0xEB, 0xEC, 0xEC, 0xEF, 0xF1, 0xF3, 0xF3, 0xF3, 0xF4, 0xF6, 0xF9, 
-    0xF8, 0xF7, 0xF4, 0xF2, 0xF0, 0xEE, 0xEC, 0xEA, 0xE8, 0xE5, 0xE4, 0xE6, 
-    0xEA, 0xED, 0xEC, 0xE8, 0xE2, 0xDF, 0xDE, 0xDE, 0xDE, 0xDD, 0xDC, 0xE0, 
-    0xE7, 0xED, 0xF3, 0xF6, 0xF5, 0xF6, 0xF6, 0xF7, 0xF6, 0xF3, 0xEF, 0xEC, 
-    0xE9, 0xE9, 0xE9, 0xEA, 0xEB, 0xEB, 0xEE, 0xF2, 0xF9, 0x00, 0x05, 0x08, 
-    0x0B, 0x10, 0x14, 0x19, 0x1C, 0x1F, 0x1F, 0x20, 0x20, 0x21, 0x23, 0x24, 
-    0x24, 0x25, 0x26, 0x29, 0x2D, 0x31, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 
-    0x31, 0x2E, 0x29, 0x26, 0x24, 0x22, 0x1E, 0x1A, 0x16, 0x15, 0x14, 0x15, 
-    0x15, 0x16, 0x17, 0x17, 0x18, 0x19, 0x1A, 0x1A, 0x1A, 0x19, 0x18, 0x18, 
-    0x18, 0x17, 0x17, 0x14, 0x12, 0x11, 0x12, 0x14, 0x16, 0x18, 0x19, 0x1A, 
-    0x1B, 0x1D, 0x1F, 0x22, 0x23, 0x24, 0x26, 0x2A, 0x30, 0x34, 0x35, 0x32, 
-    0x30, 0x2F, 0x31, 0x32, 0x30, 0x2B, 0x28, 0x27, 0x28, 0x29, 0x28, 0x25, 
-    0x23, 0x20, 0x1E, 0x1A, 0x16, 0x11, 0x0D, 0x08, 0x04, 0x00, 0xFD, 0xFA, 
-    0xF8, 0xF7, 0xF7, 0xF9, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFD, 
-    0xFB, 0xF8, 0xF6, 0xF4, 0xF1, 0xF0, 0xEF, 0xEF, 0xEE, 0xEF, 0xF3, 0xF8, 
-    0xFC, 0xFD, 0xFA, 0xF7, 0xF7, 0xF9, 0xFB, 0xFB, 0xF9, 0xF8, 0xF9, 0xFE, 
-    0x01, 0x03, 0x03, 0x01, 0x00, 0xFF, 0x00, 0xFE, 0xFC, 0xF9, 0xF6, 0xF4, 
-    0xF3, 0xF4, 0xF7, 0xF8, 0xF8, 0xF6, 0xF2, 0xEF, 0xED, 0xEA, 0xE6, 0xE4, 
-    0xE3, 0xE4, 0xE6, 0xE7, 0xE7, 0xE6, 0xE7, 0xE8, 0xE8, 0xE6, 0xE4, 0xE3, 
-    0xE4, 0xE4, 0xE6, 0xE7, 0xE5, 0xE1, 0xDE, 0xDC, 0xDC, 0xDD, 0xDE, 0xDE, 
-    0xDF, 0xE0, 0xE3, 0xE7, 0xEA, 0xEC, 0xED, 0xED, 0xEE, 0xEF, 0xEE, 0xED, 
-    0xEC, 0xEB, 0xEA, 0xEB, 0xEB, 0xEC, 0xEB, 0xEC, 0xED, 0xF0, 0xF4, 0xF5, 
-    0xF5, 0xF4, 0xF3, 0xF4, 0xF5, 0xF5, 0xF4, 0xF1, 0xED, 0xE8, 0xE3, 0xDF, 
-    0xDD, 0xDB, 0xDB, 0xDD, 0xE1, 0xE5, 0xE9, 0xED, 0xEF, 0xF0, 0xEF, 0xED, 
-    0xED, 0xEC, 0xEA, 0xE5, 0xDF, 0xDA, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD9, 
-    0xDC, 0xE1, 0xE4, 0xE7, 0xE9, 0xEB, 0xED, 0xEF, 0xF0, 0xF2, 0xF6, 0xF9, 
-    0xFC, 0xFF, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x03, 0x04, 0x03, 0x02, 
-    0x03, 0x04, 0x03, 0x04, 0x04, 0x03, 0x02, 0x01, 0x01, 0x03, 0x05, 0x05, 
-    0x04, 0x01, 0x00, 0x02, 0x05, 0x09, 0x0B, 0x0A, 0x0B, 0x0D, 0x10, 0x14, 
-    0x17, 0x18, 0x17, 0x16, 0x18, 0x1B, 0x1D, 0x1D, 0x1C, 0x1B, 0x1B, 0x1B, 
-    0x1B, 0x1A, 0x1B, 0x1A, 0x1B, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1D, 0x1E, 
-    0x20, 0x21, 0x20, 0x1E, 0x1C, 0x1B, 0x1A, 0x18, 0x16, 0x13, 0x12, 0x13, 
-    0x15, 0x17, 0x19, 0x19, 0x17, 0x17, 0x18, 0x1B, 0x1C, 0x19, 0x15, 0x11, 
-    0x10, 0x0D, 0x09, 0x04, 0xFD, 0xF7, 0xF5, 0xF5, 0xF7, 0xF9, 0xFC, 0xFD, 
-    0xFE, 0x00, 0x00, 0xFE, 0xF9, 0xF5, 0xF2, 0xF1, 0xF3, 0xF6, 0xF9, 0xFA, 
-    0xFD, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0xFB, 0xFB, 0xFE, 0x01, 0x01, 0xFD, 
-    0xF9, 0xF4, 0xF2, 0xF2, 0xF3, 0xF8, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0xFE, 0xFE, 0xFB, 0xF8, 0xF8, 0xF9, 0xFC, 0xFC, 0xFF, 0xFA, 0xFC, 
-    0xFC, 0xFA, 0xFB, 0xF7, 0xF7, 0xF6, 0xF5, 0xF4, 0xF1, 0xED, 0xEA, 0xEA, 
-    0xF3, 0xFD, 0x00, 0xFF, 0xF9, 0xF1, 0xED, 0xEA, 0xE5, 0xE4, 0xE2, 0xE2, 
-    0xE6, 0xE4, 0xE7, 0xE6, 0xE7, 0xE7, 0xE9, 0xEC, 0xEC, 0xE9, 0xE5, 0xE4, 
-    0xE4, 0xE9, 0xEC, 0xEF, 0xF3, 0xF2, 0xF2, 0xF1, 0xEF, 0xF0, 0xF0, 0xEF, 
-    0xEB, 0xE8, 0xE5, 0xE3, 0xE2, 0xE5, 0xE9, 0xE5, 0xDE, 0xD9, 0xD5, 0xD3, 
-    0xD0, 0xCB, 0xC7, 0xC4, 0xC8, 0xCA, 0xD1, 0xD4, 0xD2, 0xD5, 0xD5, 0xD9, 
-    0xD8, 0xD7, 0xD4, 0xD5, 0xD8, 0xDD, 0xE0, 0xE1, 0xE4, 0xE6, 0xEA, 0xED, 
-    0xF1, 0xF3, 0xF8, 0xF8, 0xFB, 0xFC, 0xFD, 0xFD, 0xFA, 0xFB, 0xFD, 0x01, 
-    0xFF, 0xFC, 0xF7, 0xF3, 0xF1, 0xF0, 0xED, 0xEC, 0xED, 0xF0, 0xF3, 0xF4, 
-    0xF2, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xEE, 0xE9, 0xE9, 0xEA, 0xEB, 0xEC, 
-    0xED, 0xF0, 0xF3, 0xF7, 0xFD, 0x00, 0x08, 0x0F, 0x12, 0x13, 0x0F, 0x08, 
-    0x02, 0xFF, 0x01, 0x09, 0x0F, 0x10, 0x0D, 0x06, 0x03, 0x03, 0x04, 0x04, 
-    0x04, 0x07, 0x0D, 0x13, 0x18, 0x1A, 0x1B, 0x1B, 0x1D, 0x20, 0x21, 0x20, 
-    0x1B, 0x18, 0x15, 0x12, 0x11, 0x13, 0x15, 0x18, 0x1A, 0x19, 0x1D, 0x1E, 
-    0x20, 0x22, 0x21, 0x20, 0x1E, 0x1B, 0x18, 0x1D, 0x23, 0x29, 0x2B, 0x2A, 
-    0x28, 0x23, 0x21, 0x1C, 0x17, 0x14, 0x12, 0x15, 0x17, 0x17, 0x15, 0x14, 
-    0x15, 0x18, 0x19, 0x1A, 0x15, 0x13, 0x11, 0x13, 0x17, 0x17, 0x17, 0x15, 
-    0x13, 0x11, 0x11, 0x14, 0x17, 0x19, 0x19, 0x1A, 0x18, 0x15, 0x0F, 0x0A, 
-    0x0C, 0x0F, 0x13, 0x10, 0x09, 0xFF, 0xF8, 0xF4, 0xF5, 0xF6, 0xF9, 0xFC, 
-    0x00, 0x03, 0x04, 0x05, 0x04, 0x06, 0x05, 0x07, 0x07, 0x07, 0x05, 0x04, 
-    0x04, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x09, 0x0A, 0x08, 0x0A, 0x0B, 
-    0x0B, 0x0A, 0x04, 0xFE, 0xFB, 0xFF, 0x08, 0x0F, 0x0F, 0x07, 0xFD, 0xF3, 
-    0xEF, 0xED, 0xF0, 0xF3, 0xF8, 0xFE, 0x03, 0x06, 0x05, 0x05, 0x01, 0xFF, 
-    0xFE, 0xFC, 0xF8, 0xF3, 0xEE, 0xED, 0xEE, 0xEF, 0xF0, 0xF2, 0xF5, 0xF6, 
-    0xF9, 0xFC, 0xFD, 0xFD, 0xFC, 0xF9, 0xF5, 0xF1, 0xED, 0xED, 0xF1, 0xFA, 
-    0x00, 0x01, 0xFD, 0xF8, 0xF4, 0xF1, 0xF0, 0xED, 0xED, 0xED, 0xEF, 0xF1, 
-    0xF5, 0xFA, 0xFA, 0xFA, 0xF9, 0xFA, 0xF7, 0xF3, 0xEC, 0xE8, 0xE6, 0xE6, 
-    0xE5, 0xE3, 0xE3, 0xE3, 0xE2, 0xE1, 0xE0, 0xE0, 0xE1, 0xE1, 0xE0, 0xDD, 
-    0xD7, 0xD1, 0xD0, 0xD7, 0xE2, 0xE9, 0xEA, 0xE6, 0xDE, 0xD7, 0xD3, 0xD4, 
-    0xD5, 0xD9, 0xDF, 0xE3, 0xE8, 0xEB, 0xEE, 0xEF, 0xF1, 0xF5, 0xF7, 0xF9, 
-    0xF7, 0xF4, 0xF3, 0xF5, 0xF7, 0xFA, 0xFD, 0x01, 0x07, 0x0A, 0x0E, 0x0D, 
-    0x0B, 0x08, 0x05, 0x01, 0xFB, 0xF5, 0xF1, 0xF3, 0xF8, 0xFE, 0xFF, 0xFE, 
-    0xFB, 0xF5, 0xF0, 0xEA, 0xE6, 0xE6, 0xE8, 0xEB, 0xED, 0xEE, 0xF0, 0xF2, 
-    0xF3, 0xF7, 0xFC, 0x03, 0x09, 0x0B, 0x0B, 0x0B, 0x0D, 0x0F, 0x12, 0x12, 
-    0x11, 0x11, 0x0E, 0x0C, 0x0B, 0x09, 0x09, 0x07, 0x06, 0x04, 0x00, 0xFD, 
-    0xFF, 0x07, 0x10, 0x16, 0x17, 0x13, 0x0D, 0x07, 0x02, 0xFE, 0xFC, 0xFD, 
-    0xFE, 0x01, 0x06, 0x0D, 0x14, 0x1B, 0x1E, 0x20, 0x1E, 0x1A, 0x16, 0x12, 
-    0x12, 0x12, 0x15, 0x17, 0x1B, 0x1E, 0x1F, 0x20, 0x21, 0x23, 0x25, 0x28, 
-    0x29, 0x27, 0x20, 0x1A, 0x14, 0x15, 0x1A, 0x1F, 0x20, 0x1D, 0x16, 0x0F, 
-    0x08, 0x02, 0xFF, 0xFE, 0x03, 0x09, 0x0E, 0x11, 0x13, 0x14, 0x16, 0x19, 
-    0x1A, 0x1B, 0x17, 0x12, 0x0E, 0x0B, 0x0A, 0x0C, 0x0F, 0x13, 0x15, 0x15, 
-    0x13, 0x11, 0x10, 0x0F, 0x0B, 0x04, 0xFC, 0xF5, 0xF0, 0xEE, 0xF4, 0x00, 
-    0x0A, 0x10, 0x0E, 0x09, 0x03, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0x05, 0x08, 
-    0x0C, 0x11, 0x13, 0x14, 0x13, 0x13, 0x11, 0x0C, 0x04, 0xFB, 0xF5, 0xF1, 
-    0xF0, 0xF1, 0xF0, 0xF2, 0xF3, 0xF4, 0xF5, 0xF5, 0xF6, 0xF8, 0xF6, 0xF4, 
-    0xF0, 0xED, 0xEC, 0xF1, 0xFA, 0x00, 0x03, 0x00, 0xFA, 0xF5, 0xEF, 0xED, 
-    0xEB, 0xEA, 0xEA, 0xE8, 0xE8, 0xED, 0xF4, 0xFA, 0x00, 0x02, 0x02, 0xFE, 
-    0xF5, 0xEB, 0xE2, 0xDF, 0xE1, 0xE8, 0xEE, 0xF4, 0xF7, 0xF9, 0xFA, 0xFB, 
-    0xFB, 0xFB, 0xF9, 0xF5, 0xEF, 0xE8, 0xE3, 0xE4, 0xED, 0xF7, 0xFC, 0xFC, 
-    0xF9, 0xF3, 0xEE, 0xEB, 0xE9, 0xEA, 0xEC, 0xEC, 0xEC, 0xEC, 0xEF, 0xF3, 
-    0xF7, 0xFA, 0xFB, 0xF9, 0xF5, 0xED, 0xE4, 0xE0, 0xDE, 0xE1, 0xE5, 0xE8, 
-    0xEB, 0xED, 0xF0, 0xF0, 0xEC, 0xE8, 0xE7, 0xE6, 0xE5, 0xE2, 0xDE, 0xD9, 
-    0xDA, 0xE1, 0xEB, 0xF2, 0xF2, 0xEC, 0xE5, 0xDF, 0xDD, 0xDC, 0xDE, 0xE1, 
-    0xE3, 0xE5, 0xE8, 0xEE, 0xF7, 0x00, 0x06, 0x0A, 0x0A, 0x06, 0x01, 0xFB, 
-    0xF8, 0xF8, 0xFA, 0xFD, 0x00, 0x03, 0x04, 0x06, 0x06, 0x04, 0x02, 0xFF, 
-    0xFC, 0xF9, 0xF3, 0xED, 0xE9, 0xEC, 0xF5, 0xFD, 0x00, 0xFC, 0xF5, 0xEF, 
-    0xED, 0xEE, 0xF0, 0xF3, 0xF7, 0xFB, 0x00, 0x08, 0x10, 0x18, 0x1F, 0x21, 
-    0x1F, 0x18, 0x0E, 0x03, 0xFB, 0xF5, 0xF2, 0xF4, 0xF8, 0xFF, 0x05, 0x09, 
-    0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x0F, 0x0D, 0x0A, 0x07, 0x07, 0x0D, 0x16, 
-    0x1D, 0x20, 0x20, 0x1D, 0x19, 0x15, 0x12, 0x11, 0x15, 0x1B, 0x1E, 0x20, 
-    0x21, 0x24, 0x29, 0x2E, 0x31, 0x2E, 0x27, 0x1F, 0x17, 0x11, 0x0E, 0x0F, 
-    0x14, 0x1A, 0x1D, 0x1E, 0x1F, 0x1F, 0x1D, 0x1A, 0x15, 0x10, 0x0C, 0x08, 
-    0x06, 0x04, 0x05, 0x0B, 0x13, 0x19, 0x1C, 0x1A, 0x15, 0x0F, 0x08, 0x04, 
-    0x03, 0x06, 0x0B, 0x0F, 0x12, 0x14, 0x1A, 0x1F, 0x25, 0x28, 0x25, 0x1F, 
-    0x16, 0x0D, 0x07, 0x02, 0xFD, 0xFB, 0xFB, 0xFD, 0x02, 0x07, 0x0A, 0x0C, 
-    0x0B, 0x09, 0x07, 0x04, 0x02, 0x01, 0x00, 0x02, 0x0A, 0x14, 0x1D, 0x21, 
-    0x1F, 0x17, 0x0E, 0x06, 0x00, 0xFE, 0xFE, 0xFD, 0xFA, 0xFA, 0xFD, 0x05, 
-    0x0D, 0x12, 0x12, 0x0C, 0x03, 0xFA, 0xF1, 0xE9, 0xE5, 0xE6, 0xEB, 0xF3, 
-    0xFB, 0x00, 0x02, 0x03, 0x03, 0x02, 0xFF, 0xF9, 0xF2, 0xEE, 0xEA, 0xE8, 
-    0xE8, 0xEC, 0xF3, 0xF8, 0xFA, 0xF7, 0xF1, 0xEB, 0xE5, 0xE3, 0xE5, 0xE7, 
-    0xE6, 0xE6, 0xE7, 0xEB, 0xF1, 0xF6, 0xFA, 0xFB, 0xF9, 0xF4, 0xEF, 0xEB, 
-    0xE8, 0xE8, 0xEA, 0xEE, 0xF3, 0xF7, 0xFC, 0xFE, 0x01, 0x01, 0xFF, 0xFC, 
-    0xF7, 0xF2, 0xEC, 0xE8, 0xE5, 0xE7, 0xEE, 0xF7, 0xFC, 0xFD, 0xF8, 0xEF, 
-    0xE6, 0xDF, 0xDD, 0xDF, 0xE2, 0xE3, 0xE4, 0xE5, 0xE8, 0xED, 0xF3, 0xF6, 
-    0xF5, 0xEE, 0xE5, 0xDE, 0xD8, 0xD4, 0xD1, 0xD3, 0xD6, 0xDC, 0xE3, 0xE8, 
-    0xEC, 0xEE, 0xED, 0xEB, 0xE9, 0xE7, 0xE4, 0xE0, 0xDE, 0xDD, 0xE3, 0xEE, 
-    0xFA, 0x03, 0x05, 0x00, 0xFA, 0xF4, 0xF1, 0xF2, 0xF5, 0xF8, 0xFB, 0x00, 
-    0x06, 0x0D, 0x13, 0x17, 0x18, 0x15, 0x0D, 0x04, 0xF9, 0xF0, 0xEA, 0xE7, 
-    0xE9, 0xEE, 0xF4, 0xF9, 0xFB, 0xFB, 0xF9, 0xF5, 0xF1, 0xEC, 0xE7, 0xE3, 
-    0xE3, 0xE6, 0xEB, 0xF4, 0xFF, 0x0A, 0x11, 0x13, 0x0F, 0x08, 0x02, 0xFE, 
-    0xFE, 0x01, 0x05, 0x07, 0x08, 0x0A, 0x0C, 0x0E, 0x11, 0x11, 0x0D, 0x05, 
-    0xFB, 0xF5, 0xF5, 0xF7, 0xFB, 0x01, 0x08, 0x0F, 0x16, 0x1C, 0x20, 0x23, 
-    0x21, 0x1E, 0x1A, 0x17, 0x14, 0x12, 0x10, 0x10, 0x17, 0x20, 0x2A, 0x2E, 
-    0x2C, 0x24, 0x1B, 0x12, 0x0C, 0x0D, 0x10, 0x14, 0x17, 0x18, 0x1B, 0x20, 
-    0x25, 0x27, 0x24, 0x1C, 0x11, 0x08, 0x02, 0x01, 0x00, 0x01, 0x04, 0x08, 
-    0x0E, 0x16, 0x1C, 0x1E, 0x1D, 0x1A, 0x18, 0x17, 0x16, 0x13, 0x0E, 0x0B, 
-    0x0E, 0x18, 0x24, 0x2B, 0x2B, 0x25, 0x1C, 0x13, 0x0C, 0x07, 0x03, 0x01, 
-    0x00, 0x00, 0x02, 0x06, 0x09, 0x0C, 0x0C, 0x0A, 0x05, 0xFE, 0xF5, 0xEF, 
-    0xEB, 0xEB, 0xEE, 0xF4, 0xFC, 0x04, 0x0A, 0x0C, 0x0A, 0x08, 0x06, 0x05, 
-    0x02, 0xFF, 0xFD, 0xFD, 0x00, 0x05, 0x0C, 0x12, 0x15, 0x15, 0x10, 0x08, 
-    0x00, 0xF7, 0xF1, 0xF0, 0xF1, 0xF5, 0xF9, 0xFD, 0xFE, 0xFE, 0xFF, 0xFD, 
-    0xFA, 0xF4, 0xEC, 0xE4, 0xE1, 0xE1, 0xE5, 0xE9, 0xED, 0xF1, 0xF5, 0xF9, 
-    0xFB, 0xFB, 0xF8, 0xF5, 0xF1, 0xED, 0xE8, 0xE6, 0xE6, 0xE7, 0xEB, 0xF2, 
-    0xF9, 0xFF, 0x01, 0xFF, 0xF8, 0xEF, 0xE8, 0xE4, 0xE6, 0xE8, 0xEC, 0xF1, 
-    0xF6, 0xFD, 0x04, 0x0A, 0x0B, 0x08, 0x01, 0xF8, 0xF0, 0xED, 0xEC, 0xEE, 
-    0xF0, 0xF4, 0xF9, 0xFF, 0x03, 0x04, 0x00, 0xF9, 0xF2, 0xEC, 0xE7, 0xE3, 
-    0xE0, 0xDE, 0xDF, 0xE6, 0xF0, 0xF9, 0xFD, 0xFA, 0xF4, 0xEC, 0xE4, 0xDE, 
-    0xDA, 0xD6, 0xD5, 0xD7, 0xDD, 0xE5, 0xEC, 0xF2, 0xF5, 0xF6, 0xF3, 0xEE, 
-    0xE5, 0xDE, 0xD9, 0xD6, 0xD8, 0xDC, 0xE2, 0xE9, 0xF0, 0xF4, 0xF5, 0xF4, 
-    0xF3, 0xF1, 0xF0, 0xED, 0xEA, 0xE7, 0xE7, 0xEB, 0xF4, 0xFD, 0x03, 0x06, 
-    0x06, 0x02, 0xFD, 0xF6, 0xF0, 0xEE, 0xF0, 0xF4, 0xF9, 0xFD, 0x02, 0x06, 
-    0x08, 0x09, 0x07, 0x01, 0xF8, 0xED, 0xE5, 0xE1, 0xE1, 0xE6, 0xEC, 0xF4, 
-    0xFA, 0xFF, 0x04, 0x07, 0x07, 0x07, 0x04, 0x02, 0x00, 0x01, 0x04, 0x07, 
-    0x0B, 0x12, 0x1B, 0x21, 0x23, 0x1F, 0x18, 0x0F, 0x07, 0x03, 0x01, 0x02, 
-    0x03, 0x06, 0x0A, 0x0F, 0x14, 0x18, 0x1B, 0x1B, 0x18, 0x13, 0x0E, 0x0B, 
-    0x0C, 0x0F, 0x13, 0x19, 0x1F, 0x25, 0x2B, 0x2E, 0x2D, 0x27, 0x21, 0x1D, 
-    0x1D, 0x1B, 0x17, 0x13, 0x11, 0x15, 0x1F, 0x27, 0x2C, 0x2B, 0x25, 0x1D, 
-    0x15, 0x0D, 0x07, 0x04, 0x03, 0x05, 0x0A, 0x12, 0x19, 0x20, 0x24, 0x26, 
-    0x23, 0x1C, 0x14, 0x0B, 0x05, 0x01, 0x01, 0x04, 0x09, 0x0F, 0x14, 0x17, 
-    0x18, 0x18, 0x17, 0x16, 0x14, 0x11, 0x0C, 0x09, 0x09, 0x0B, 0x0F, 0x14, 
-    0x19, 0x1B, 0x1A, 0x16, 0x10, 0x08, 0xFF, 0xF9, 0xF5, 0xF4, 0xF7, 0xFA, 
-    0xFF, 0x02, 0x03, 0x04, 0x04, 0x03, 0xFF, 0xF9, 0xF1, 0xED, 0xED, 0xF2, 
-    0xFA, 0x01, 0x08, 0x0E, 0x13, 0x17, 0x18, 0x16, 0x12, 0x0E, 0x0A, 0x06, 
-    0x04, 0x02, 0x03, 0x06, 0x0E, 0x14, 0x17, 0x15, 0x0C, 0x02, 0xF8, 0xEF, 
-    0xE9, 0xE4, 0xE3, 0xE6, 0xEB, 0xF2, 0xF7, 0xFB, 0xFD, 0xFA, 0xF4, 0xEA, 
-    0xDF, 0xD7, 0xD5, 0xD7, 0xDC, 0xE2, 0xE9, 0xEF, 0xF5, 0xFB, 0xFE, 0xFD, 
-    0xFA, 0xF7, 0xF5, 0xF3, 0xF1, 0xF0, 0xEF, 0xF2, 0xF8, 0xFE, 0x03, 0x03, 
-    0xFF, 0xF8, 0xF0, 0xE7, 0xDE, 0xD8, 0xD5, 0xD7, 0xDF, 0xE9, 0xF2, 0xF9, 
-    0xFD, 0xFE, 0xFD, 0xFA, 0xF3, 0xEC, 0xE4, 0xE0, 0xE0, 0xE4, 0xED, 0xF4, 
-    0xFA, 0xFD, 0xFE, 0xFE, 0xFC, 0xF8, 0xF3, 0xEC, 0xE4, 0xDD, 0xD9, 0xD9, 
-    0xDD, 0xE5, 0xEC, 0xF0, 0xF0, 0xED, 0xEA, 0xE5, 0xDF, 0xD9, 0xD4, 0xD4, 
-    0xD8, 0xDF, 0xE6, 0xEC, 0xF1, 0xF3, 0xF3, 0xF0, 0xEC, 0xE6, 0xE1, 0xDD, 
-    0xDE, 0xE3, 0xEB, 0xF3, 0xF7, 0xFA, 0xFB, 0xFD, 0xFE, 0xFC, 0xF9, 0xF5, 
-    0xF4, 0xF4, 0xF5, 0xF7, 0xFA, 0xFE, 0x04, 0x0A, 0x0D, 0x0E, 0x0B, 0x06, 
-    0xFF, 0xF7, 0xF0, 0xEC, 0xEC, 0xF0, 0xF6, 0xFC, 0x02, 0x05, 0x04, 0x02, 
-    0xFD, 0xF6, 0xED, 0xE5, 0xE0, 0xE0, 0xE4, 0xEC, 0xF5, 0xFD, 0x05, 0x0D, 
-    0x13, 0x17, 0x18, 0x17, 0x16, 0x14, 0x11, 0x0D, 0x0C, 0x0D, 0x12, 0x19, 
-    0x1F, 0x22, 0x21, 0x1E, 0x19, 0x14, 0x10, 0x0A, 0x05, 0x03, 0x06, 0x0D, 
-    0x15, 0x1D, 0x22, 0x24, 0x23, 0x20, 0x1A, 0x14, 0x0D, 0x09, 0x08, 0x09, 
-    0x0D, 0x12, 0x18, 0x1E, 0x23, 0x26, 0x27, 0x26, 0x24, 0x21, 0x1C, 0x18, 
-    0x13, 0x11, 0x11, 0x16, 0x1C, 0x22, 0x27, 0x29, 0x27, 0x22, 0x1C, 0x15, 
-    0x0D, 0x07, 0x04, 0x06, 0x0A, 0x10, 0x15, 0x1A, 0x1E, 0x1F, 0x1D, 0x17, 
-    0x10, 0x09, 0x05, 0x04, 0x07, 0x0D, 0x13, 0x18, 0x1C, 0x1E, 0x20, 0x20, 
-    0x1F, 0x1C, 0x18, 0x13, 0x0E, 0x08, 0x05, 0x05, 0x07, 0x0B, 0x0D, 0x0D, 
-    0x08, 0x00, 0xF8, 0xF0, 0xE9, 0xE4, 0xE2, 0xE4, 0xEA, 0xF2, 0xFC, 0x05, 
-    0x0C, 0x0D, 0x0A, 0x05, 0xFD, 0xF6, 0xF1, 0xF0, 0xF2, 0xF8, 0x01, 0x0C, 
-    0x16, 0x1E, 0x23, 0x23, 0x20, 0x19, 0x11, 0x0A, 0x04, 0xFF, 0xFA, 0xF6, 
-    0xF5, 0xF9, 0xFF, 0x06, 0x08, 0x05, 0xFE, 0xF4, 0xEB, 0xE4, 0xDF, 0xDC, 
-    0xDF, 0xE5, 0xEE, 0xF8, 0x00, 0x06, 0x07, 0x04, 0xFE, 0xF6, 0xED, 0xE5, 
-    0xE2, 0xE3, 0xE8, 0xEF, 0xF6, 0xFB, 0xFF, 0x01, 0x01, 0xFD, 0xF7, 0xF0, 
-    0xEA, 0xE4, 0xE0, 0xDD, 0xDD, 0xE0, 0xE5, 0xEC, 0xF1, 0xF2, 0xF0, 0xED, 
-    0xE9, 0xE4, 0xDF, 0xDA, 0xD9, 0xDD, 0xE5, 0xEE, 0xF7, 0xFC, 0xFE, 0xFB, 
-    0xF6, 0xEE, 0xE6, 0xDE, 0xD7, 0xD4, 0xD5, 0xD8, 0xDE, 0xE4, 0xE9, 0xEB, 
-    0xEB, 0xE9, 0xE4, 0xDF, 0xDA, 0xD6, 0xD3, 0xD2, 0xD3, 0xD7, 0xDC, 0xE5, 
-    0xEC, 0xF2, 0xF4, 0xF2, 0xED, 0xE8, 0xE3, 0xDD, 0xDA, 0xDB, 0xE2, 0xEB, 
-    0xF5, 0xFE, 0x03, 0x06, 0x04, 0xFE, 0xF7, 0xEE, 0xE4, 0xDD, 0xDB, 0xDE, 
-    0xE7, 0xF2, 0xFD, 0x04, 0x09, 0x0E, 0x11, 0x11, 0x0D, 0x08, 0x03, 0xFE, 
-    0xFB, 0xFB, 0xFD, 0x02, 0x0A, 0x10, 0x13, 0x10, 0x0B, 0x03, 0xFB, 0xF2, 
-    0xE8, 0xE0, 0xDD, 0xE2, 0xEB, 0xF5, 0xFF, 0x06, 0x0A, 0x0C, 0x0A, 0x05, 
-    0xFF, 0xF8, 0xF2, 0xF1, 0xF3, 0xF8, 0x01, 0x0C, 0x16, 0x1E, 0x23, 0x26, 
-    0x24, 0x20, 0x1D, 0x1B, 0x19, 0x16, 0x14, 0x13, 0x18, 0x1F, 0x24, 0x24, 
-    0x21, 0x1B, 0x13, 0x0D, 0x05, 0xFE, 0xFB, 0xFD, 0x02, 0x09, 0x11, 0x19, 
-    0x1E, 0x1E, 0x19, 0x12, 0x0B, 0x02, 0xFB, 0xF8, 0xF8, 0xFC, 0x03, 0x0F, 
-    0x1C, 0x27, 0x2E, 0x2E, 0x2B, 0x25, 0x1F, 0x19, 0x12, 0x0F, 0x0F, 0x13, 
-    0x1A, 0x23, 0x2D, 0x34, 0x36, 0x33, 0x2C, 0x23, 0x1A, 0x11, 0x09, 0x06, 
-    0x08, 0x0F, 0x18, 0x23, 0x2D, 0x31, 0x2E, 0x27, 0x1E, 0x15, 0x0E, 0x08, 
-    0x04, 0x03, 0x05, 0x0E, 0x19, 0x23, 0x28, 0x28, 0x23, 0x1C, 0x15, 0x0E, 
-    0x06, 0xFE, 0xF7, 0xF2, 0xF0, 0xF1, 0xF6, 0xFD, 0x02, 0x03, 0xFF, 0xF7, 
-    0xED, 0xE4, 0xDC, 0xD7, 0xD9, 0xDE, 0xE7, 0xF3, 0x00, 0x0D, 0x15, 0x16, 
-    0x10, 0x07, 0xFE, 0xF7, 0xF2, 0xF0, 0xF0, 0xF2, 0xF8, 0xFF, 0x05, 0x0A, 
-    0x0C, 0x0B, 0x08, 0x04, 0xFF, 0xF9, 0xF4, 0xF0, 0xED, 0xED, 0xEF, 0xF4, 
-    0xF8, 0xFD, 0xFF, 0xFD, 0xF8, 0xF1, 0xEA, 0xE2, 0xDF, 0xE2, 0xE9, 0xF2, 
-    0xFA, 0x03, 0x09, 0x0B, 0x07, 0x00, 0xF6, 0xEB, 0xE1, 0xDB, 0xD9, 0xDD, 
-    0xE5, 0xEF, 0xF7, 0xFC, 0xFE, 0xFC, 0xF9, 0xF4, 0xEF, 0xEB, 0xE8, 0xE6, 
-    0xE6, 0xE7, 0xE9, 0xED, 0xF4, 0xFB, 0x00, 0x02, 0xFD, 0xF5, 0xEE, 0xE6, 
-    0xDE, 0xDA, 0xDA, 0xDE, 0xE7, 0xF2, 0xFB, 0x00, 0x00, 0xFB, 0xF4, 0xEB, 
-    0xE1, 0xD7, 0xD0, 0xCD, 0xD0, 0xD8, 0xE2, 0xEC, 0xF2, 0xF3, 0xF3, 0xF1, 
-    0xEF, 0xEA, 0xE5, 0xE0, 0xDD, 0xDF, 0xE2, 0xE4, 0xE8, 0xEE, 0xF5, 0xFA, 
-    0xFA, 0xF6, 0xED, 0xE2, 0xD8, 0xD0, 0xCE, 0xD1, 0xD6, 0xDF, 0xEC, 0xFA, 
-    0x06, 0x0B, 0x0A, 0x03, 0xFB, 0xF2, 0xE9, 0xE4, 0xE4, 0xE8, 0xEF, 0xF7, 
-    0xFF, 0x07, 0x0B, 0x0C, 0x0A, 0x06, 0x01, 0xFD, 0xF8, 0xF4, 0xF4, 0xF6, 
-    0xF9, 0xFD, 0x02, 0x07, 0x0C, 0x0B, 0x06, 0x01, 0xFC, 0xF8, 0xF6, 0xF7, 
-    0xFD, 0x05, 0x10, 0x1B, 0x22, 0x25, 0x24, 0x1E, 0x16, 0x0E, 0x06, 0x01, 
-    0x00, 0x03, 0x09, 0x12, 0x1C, 0x24, 0x29, 0x2A, 0x26, 0x20, 0x1A, 0x15, 
-    0x10, 0x0C, 0x0A, 0x0A, 0x0B, 0x0E, 0x16, 0x1C, 0x23, 0x25, 0x21, 0x1C, 
-    0x14, 0x0C, 0x05, 0xFF, 0xFF, 0x02, 0x0A, 0x15, 0x1D, 0x22, 0x24, 0x1E, 
-    0x1A, 0x11, 0x06, 0x00, 0xF7, 0xF8, 0xF9, 0x02, 0x0D, 0x14, 0x18, 0x1B, 
-    0x19, 0x19, 0x18, 0x1B, 0x1D, 0x1E, 0x1E, 0x15, 0x23, 0x15, 0x10, 0x16, 
-    0xFE, 0x04, 0x08, 0x06, 0x0F, 0x0C, 0x04, 0x0C, 0x16, 0x0C, 0x15, 0x1D, 
-    0x2A, 0x31, 0x29, 0x36, 0x2D, 0x33, 0x37, 0x31, 0x44, 0x36, 0x1E, 0x1C, 
-    0x20, 0x2A, 0x23, 0x1E, 0x16, 0x0B, 0x0B, 0x00, 0xFC, 0xFD, 0xF6, 0xEC, 
-    0xEB, 0xDD, 0xDD, 0xDF, 0xE1, 0xE3, 0xE8, 0xED, 0xD8, 0xCC, 0xB1, 0xB0, 
-    0xB9, 0xC0, 0xD4, 0xE1, 0xEC, 0xFE, 0x08, 0x0C, 0x0D, 0x01, 0xFC, 0xF2, 
-    0xE8, 0xEA, 0xF1, 0xF5, 0x00, 0x0C, 0x0F, 0x19, 0x1D, 0x1E, 0x24, 0x1E, 
-    0x1B, 0x0A, 0x0F, 0x10, 0x06, 0x05, 0x04, 0x0A, 0x0B, 0x19, 0x21, 0x27, 
-    0x1F, 0x14, 0x0E, 0xFE, 0xEE, 0xE2, 0xD3, 0xCD, 0xD3, 0xD8, 0xE0, 0xE6, 
-    0xE5, 0xE4, 0xDF, 0xDB, 0xD5, 0xC9, 0xC9, 0xC7, 0xCA, 0xCD, 0xD2, 0xDA, 
-    0xDE, 0xE3, 0xE7, 0xE5, 0xEA, 0xE7, 0xE3, 0xE7, 0xDF, 0xDF, 0xDF, 0xE4, 
-    0xE9, 0xF2, 0xF4, 0xF8, 0xF9, 0xF7, 0xEE, 0xE6, 0xDA, 0xCB, 0xCC, 0xD6, 
-    0xEC, 0xF9, 0x05, 0x07, 0x10, 0x10, 0x11, 0x0E, 0x03, 0xFA, 0xEA, 0xE4, 
-    0xE6, 0xEB, 0xF3, 0xFA, 0x01, 0x02, 0x02, 0x03, 0xFD, 0xFE, 0xF4, 0xF4, 
-    0xF2, 0xEB, 0xE0, 0xDD, 0xDE, 0xE0, 0xED, 0xF1, 0xF0, 0xF5, 0xF3, 0xF2, 
-    0xEB, 0xE2, 0xE5, 0xE0, 0xE8, 0xEB, 0xF0, 0xEE, 0xF5, 0xF6, 0xF7, 0xF9, 
-    0xF2, 0xEF, 0xE1, 0xDF, 0xDC, 0xE0, 0xE7, 0xEB, 0xED, 0xF1, 0xF1, 0xF6, 
-    0xF6, 0xF0, 0xEE, 0xEA, 0xE3, 0xE7, 0xF0, 0xF5, 0xF9, 0xE8, 0xE6, 0xF8, 
-    0x12, 0x1E, 0x1F, 0x22, 0x19, 0x0C, 0x04, 0xFA, 0xF9, 0xF6, 0x08, 0x17, 
-    0x20, 0x23, 0x1F, 0x32, 0x31, 0x2B, 0x1F, 0x16, 0x0F, 0x17, 0x1E, 0x19, 
-    0x20, 0x22, 0x2C, 0x2B, 0x2F, 0x2E, 0x2C, 0x25, 0x28, 0x26, 0x1C, 0x1B, 
-    0x1B, 0x2C, 0x20, 0x1C, 0x17, 0x26, 0x2A, 0x1C, 0x0D, 0x02, 0x09, 0x0C, 
-    0x11, 0x16, 0x1C, 0x07, 0x13, 0x1C, 0x11, 0x1E, 0x1D, 0x2B, 0x24, 0x0F, 
-    0x0C, 0xFE, 0xFB, 0xF8, 0xF7, 0xFD, 0x0D, 0x13, 0x21, 0x20, 0x18, 0x16, 
-    0x0D, 0x0E, 0x07, 0x0B, 0x03, 0x03, 0x03, 0x06, 0x0A, 0x16, 0x17, 0x18, 
-    0x21, 0x1B, 0x1E, 0x19, 0x08, 0x07, 0x10, 0x0B, 0x14, 0x12, 0x0C, 0x10, 
-    0x08, 0x08, 0x0D, 0x10, 0x01, 0xF8, 0xFC, 0x01, 0xFC, 0x05, 0x07, 0xFC, 
-    0xFE, 0xF2, 0xFA, 0xF7, 0x04, 0x03, 0xF4, 0xF4, 0xF3, 0xF7, 0xFA, 0x08, 
-    0x0D, 0x11, 0x0E, 0x15, 0x05, 0xFD, 0x02, 0xF8, 0xEC, 0xED, 0xFB, 0xF2, 
-    0xEB, 0xF7, 0x00, 0x0B, 0x09, 0x0C, 0x14, 0x07, 0x04, 0xF8, 0xE9, 0xE4, 
-    0xE5, 0xE1, 0xF0, 0xFE, 0xFC, 0xFB, 0x0C, 0x14, 0x08, 0x05, 0x00, 0x07, 
-    0x09, 0x02, 0xFA, 0xF7, 0xF1, 0xF3, 0xF7, 0xF6, 0xF4, 0xEE, 0xEA, 0xE1, 
-    0xD9, 0xD5, 0xD9, 0xD8, 0xDE, 0xE7, 0xEF, 0xF0, 0xEA, 0xEF, 0xED, 0xE8, 
-    0xE5, 0xE4, 0xE0, 0xD8, 0xD2, 0xD2, 0xDE, 0xFA, 0xFA, 0xFC, 0xFF, 0xF7, 
-    0xFC, 0xEA, 0xEC, 0xE8, 0xD8, 0xCD, 0xD2, 0xD4, 0xD1, 0xE2, 0xF1, 0xF4, 
-    0xF4, 0xFF, 0xFD, 0xF7, 0xEF, 0xE9, 0xEB, 0xE4, 0xDC, 0xE5, 0xE1, 0xDE, 
-    0xED, 0xF4, 0xFC, 0x0C, 0x01, 0xFF, 0x03, 0xF8, 0xF2, 0xEF, 0xF2, 0xF0, 
-    0xF0, 0xF7, 0x04, 0xFC, 0xF6, 0xF9, 0xFA, 0xF2, 0xEE, 0xE3, 0xEA, 0xF7, 
-    0xF2, 0xF1, 0xE8, 0xEE, 0xF3, 0xF5, 0xF1, 0xE2, 0xDB, 0xD8, 0xD6, 0xD7, 
-    0xCB, 0xD0, 0xE4, 0xE6, 0xFC, 0x08, 0x06, 0x0A, 0x03, 0xFF, 0xF9, 0xF3, 
-    0xDE, 0xE2, 0xE1, 0xDF, 0xEC, 0xE8, 0xFE, 0x06, 0x0B, 0x0E, 0x12, 0x0D, 
-    0x08, 0x09, 0x07, 0xFB, 0x01, 0x12, 0x0B, 0x18, 0x11, 0x0D, 0x17, 0x14, 
-    0x12, 0x10, 0x16, 0x0F, 0x04, 0x02, 0x04, 0x16, 0x20, 0x1D, 0x1E, 0x1E, 
-    0x15, 0x11, 0x14, 0x13, 0x13, 0x14, 0x11, 0x13, 0x11, 0x1E, 0x27, 0x23, 
-    0x2A, 0x27, 0x2D, 0x25, 0x1F, 0x19, 0x0F, 0x06, 0x13, 0x14, 0x15, 0x1F, 
-    0x1F, 0x27, 0x30, 0x39, 0x2B, 0x2A, 0x23, 0x09, 0x05, 0x0D, 0x0B, 0x11, 
-    0x0B, 0x00, 0x13, 0x17, 0x1E, 0x25, 0x1D, 0x1E, 0x19, 0x15, 0xFA, 0xF4, 
-    0xF5, 0xF1, 0xFF, 0xFE, 0x03, 0x08, 0x0E, 0x08, 0x10, 0x0F, 0x15, 0x19, 
-    0x17, 0x1F, 0x1C, 0x22, 0x1A, 0x1A, 0x1E, 0x18, 0x23, 0x1F, 0x13, 0x0E, 
-    0xFD, 0x01, 0x02, 0x02, 0x06, 0x0C, 0x12, 0x14, 0x1B, 0x25, 0x21, 0x13, 
-    0x07, 0x02, 0xFC, 0xF3, 0xF3, 0xF3, 0xFE, 0x03, 0x0E, 0x13, 0x0E, 0x10, 
-    0x0C, 0x0A, 0x06, 0xFE, 0xF7, 0xEB, 0xDF, 0xE3, 0xEC, 0xE7, 0xE7, 0xF6, 
-    0x02, 0x06, 0x02, 0xF0, 0xE9, 0xF0, 0xF1, 0xF0, 0xE8, 0xEC, 0xEE, 0xED, 
-    0xEF, 0xF8, 0xFF, 0xFB, 0xFD, 0x03, 0x00, 0xF6, 0xFA, 0xF0, 0xF1, 0xF4, 
-    0xF7, 0xFA, 0xF4, 0xF8, 0xF0, 0xED, 0xE8, 0xE3, 0xE7, 0xE6, 0xE5, 0xE6, 
-    0xE8, 0xF2, 0xF7, 0xF1, 0xF8, 0xF6, 0xEA, 0xF1, 0xEC, 0xE2, 0xE1, 0xD9, 
-    0xDB, 0xDF, 0xE8, 0xF3, 0xFC, 0x0E, 0x13, 0x16, 0x10, 0x0D, 0x04, 0xFA, 
-    0xF5, 0xEB, 0xE2, 0xDC, 0xE5, 0xE5, 0xEA, 0xEB, 0xF1, 0xF6, 0xF9, 0xF7, 
-    0xEF, 0xE5, 0xE4, 0xE9, 0xF1, 0xF0, 0xE5, 0xE3, 0xDB, 0xE5, 0xF0, 0xF2, 
-    0xE8, 0xE6, 0xF0, 0xED, 0xEB, 0xF3, 0xED, 0xF0, 0xF2, 0xF8, 0xEF, 0xED, 
-    0xF3, 0xE4, 0xDE, 0xDB, 0xE1, 0xD5, 0xD9, 0xD7, 0xDE, 0xE9, 0xEA, 0xF6, 
-    0xF6, 0xFD, 0xFA, 0xF6, 0xEB, 0xE4, 0xEC, 0xEB, 0xEE, 0xE4, 0xF4, 0xF9, 
-    0xF3, 0xFE, 0xF9, 0x05, 0x02, 0xFC, 0x02, 0xF0, 0xED, 0xF5, 0xEB, 0xF2, 
-    0xF3, 0xF3, 0xFB, 0x06, 0x0A, 0x06, 0x0B, 0x11, 0x0F, 0x0E, 0x0A, 0x04, 
-    0xFE, 0xFB, 0x02, 0xFE, 0x07, 0x05, 0xFE, 0x05, 0x02, 0x05, 0x0B, 0x12, 
-    0x10, 0x13, 0x16, 0x18, 0x15, 0x0E, 0x14, 0x19, 0x1A, 0x15, 0x0B, 0x02, 
-    0x04, 0x02, 0x06, 0x0D, 0x0C, 0x10, 0x11, 0x17, 0x20, 0x22, 0x25, 0x20, 
-    0x16, 0x12, 0x0E, 0x0C, 0x00, 0x05, 0x09, 0x0D, 0x17, 0x1B, 0x1E, 0x24, 
-    0x2C, 0x22, 0x20, 0x1B, 0x17, 0x11, 0x0D, 0x0E, 0x0E, 0x09, 0x12, 0x1C, 
-    0x15, 0x1C, 0x19, 0x20, 0x1B, 0x19, 0x1E, 0x15, 0x16, 0x12, 0x17, 0x1F, 
-    0x21, 0x1E, 0x19, 0x1B, 0x1F, 0x20, 0x1A, 0x1C, 0x14, 0x0D, 0x16, 0x19, 
-    0x1E, 0x25, 0x26, 0x2B, 0x28, 0x20, 0x1C, 0x13, 0x11, 0x0E, 0x11, 0x15, 
-    0x11, 0x0F, 0x12, 0x16, 0x20, 0x22, 0x1C, 0x10, 0x06, 0x03, 0xFC, 0xFA, 
-    0xF8, 0x02, 0x09, 0x06, 0x0F, 0x1B, 0x20, 0x25, 0x24, 0x20, 0x1B, 0x12, 
-    0x0A, 0x03, 0xFB, 0xFB, 0xFA, 0xF8, 0xF9, 0xF3, 0xFB, 0xFB, 0xF7, 0xF2, 
-    0xF1, 0xFC, 0xFE, 0xFB, 0xF9, 0xF0, 0xE9, 0xF1, 0xEC, 0xF0, 0xF6, 0xEB, 
-    0xEE, 0xEE, 0xE8, 0xE2, 0xE3, 0xDF, 0xE2, 0xEB, 0xEF, 0xF1, 0xEF, 0xEE, 
-    0xF0, 0xF3, 0xEE, 0xE7, 0xDB, 0xD8, 0xD9, 0xDA, 0xD8, 0xE5, 0xF0, 0xF2, 
-    0x03, 0x06, 0xFB, 0xF6, 0xF9, 0xF3, 0xED, 0xEA, 0xED, 0xEC, 0xEA, 0xEC, 
-    0xF2, 0xFA, 0xFC, 0x06, 0x07, 0x03, 0xFE, 0xF8, 0xF5, 0xEF, 0xEC, 0xF2, 
-    0xF3, 0xF3, 0xF4, 0xF9, 0xFE, 0x02, 0xFD, 0xFC, 0xFC, 0xF7, 0xED, 0xEF, 
-    0xEF, 0xE7, 0xED, 0xEF, 0xF3, 0xEF, 0xEF, 0xE9, 0xE7, 0xE3, 0xE1, 0xE6, 
-    0xE5, 0xED, 0xF0, 0xF4, 0xF9, 0xF5, 0xF4, 0xF7, 0xF8, 0xF5, 0xE7, 0xDE, 
-    0xD4, 0xCD, 0xD1, 0xDB, 0xE2, 0xEA, 0xEC, 0xEA, 0xED, 0xEA, 0xEF, 0xF5, 
-    0xEC, 0xE5, 0xE3, 0xDD, 0xD8, 0xD7, 0xD9, 0xDD, 0xE3, 0xE8, 0xED, 0xEE, 
-    0xEE, 0xED, 0xEA, 0xF0, 0xEE, 0xEA, 0xED, 0xEA, 0xE5, 0xE4, 0xE5, 0xE6, 
-    0xE9, 0xE9, 0xF4, 0xF7, 0xFC, 0xFC, 0xF6, 0xFA, 0x03, 0x0C, 0x0F, 0x14, 
-    0x16, 0x10, 0x0C, 0x11, 0x15, 0x16, 0x0F, 0x0B, 0x05, 0xFE, 0x03, 0x09, 
-    0x14, 0x18, 0x17, 0x14, 0x12, 0x11, 0x0E, 0x0D, 0x09, 0x08, 0x08, 0x0A, 
-    0x16, 0x1C, 0x1B, 0x16, 0x1A, 0x23, 0x29, 0x2D, 0x20, 0x17, 0x0A, 0x05, 
-    0x0D, 0x0F, 0x13, 0x13, 0x15, 0x18, 0x1E, 0x21, 0x25, 0x24, 0x24, 0x21, 
-    0x19, 0x18, 0x1B, 0x12, 0x0F, 0x0F, 0x0E, 0x12, 0x18, 0x1C, 0x13, 0x14, 
-    0x17, 0x17, 0x18, 0x1D, 0x1C, 0x1A, 0x1A, 0x16, 0x1B, 0x1C, 0x1E, 0x1F, 
-    0x19, 0x10, 0x08, 0x09, 0x0D, 0x14, 0x17, 0x1A, 0x25, 0x28, 0x26, 0x28, 
-    0x25, 0x1D, 0x18, 0x16, 0x11, 0x0A, 0x02, 0xFA, 0xFE, 0x06, 0x0D, 0x14, 
-    0x12, 0x13, 0x12, 0x13, 0x0D, 0x09, 0x06, 0x05, 0x06, 0x06, 0x06, 0xFE, 
-    0x00, 0x05, 0x09, 0x0A, 0x09, 0x0A, 0x0A, 0x04, 0xFD, 0xFF, 0xFE, 0xFE, 
-    0x02, 0x06, 0x03, 0x01, 0xFF, 0xFA, 0xF9, 0xFB, 0xFD, 0xF8, 0xF5, 0xF1, 
-    0xED, 0xEC, 0xF0, 0xF3, 0xF4, 0xF8, 0xF6, 0xF5, 0xF0, 0xEE, 0xED, 0xEB, 
-    0xF0, 0xF0, 0xF2, 0xF5, 0xF7, 0xFB, 0xFD, 0xFF, 0xFC, 0xF8, 0xF6, 0xEF, 
-    0xE8, 0xDE, 0xDF, 0xE4, 0xEB, 0xF4, 0xF8, 0xF8, 0xFB, 0xFD, 0x00, 0x01, 
-    0xFE, 0xF7, 0xEE, 0xEE, 0xEC, 0xEA, 0xE9, 0xE5, 0xE9, 0xED, 0xF0, 0xF8, 
-    0xFA, 0xF8, 0xF3, 0xF3, 0xF1, 0xEF, 0xF3, 0xF3, 0xEE, 0xE7, 0xE7, 0xE6, 
-    0xE6, 0xEA, 0xEB, 0xE1, 0xDF, 0xDF, 0xE2, 0xE9, 0xF2, 0xFF, 0x02, 0x04, 
-    0x08, 0x05, 0x03, 0xFF, 0xFE, 0xF7, 0xF4, 0xEF, 0xE5, 0xE4, 0xE6, 0xEC, 
-    0xF0, 0xF5, 0xF3, 0xF3, 0xF3, 0xF3, 0xF2, 0xEF, 0xED, 0xE8, 0xE7, 0xEB, 
-    0xE6, 0xE2, 0xE5, 0xE6, 0xE8, 0xEA, 0xF2, 0xF2, 0xEC, 0xE5, 0xE1, 0xDE, 
-    0xD9, 0xDB, 0xE1, 0xE9, 0xEB, 0xEA, 0xEB, 0xEA, 0xEA, 0xF0, 0xF4, 0xF3, 
-    0xF1, 0xF5, 0xF2, 0xEC, 0xEE, 0xF2, 0xF2, 0xF7, 0xF4, 0xF2, 0xEE, 0xEC, 
-    0xEE, 0xEF, 0xF3, 0xF6, 0xF6, 0xF7, 0xFC, 0xF9, 0xF9, 0xFB, 0x01, 0x01, 
-    0xFF, 0xFD, 0xF6, 0xF2, 0xF3, 0xF9, 0x01, 0x06, 0x0D, 0x0F, 0x0E, 0x12, 
-    0x14, 0x10, 0x12, 0x11, 0x09, 0x06, 0x05, 0x03, 0x03, 0x03, 0x04, 0x0D, 
-    0x14, 0x19, 0x19, 0x17, 0x19, 0x1A, 0x18, 0x18, 0x1F, 0x1E, 0x1A, 0x1A, 
-    0x14, 0x12, 0x19, 0x1B, 0x1F, 0x1B, 0x17, 0x0D, 0x07, 0x0C, 0x10, 0x19, 
-    0x21, 0x29, 0x2D, 0x2C, 0x29, 0x22, 0x1E, 0x19, 0x17, 0x18, 0x19, 0x17, 
-    0x14, 0x15, 0x12, 0x16, 0x18, 0x17, 0x16, 0x10, 0x0C, 0x08, 0x08, 0x0A, 
-    0x0A, 0x0C, 0x0C, 0x0C, 0x0D, 0x0F, 0x13, 0x1A, 0x1D, 0x1B, 0x1C, 0x1B, 
-    0x11, 0x0F, 0x0F, 0x0D, 0x10, 0x14, 0x19, 0x1B, 0x1C, 0x1B, 0x19, 0x13, 
-    0x11, 0x0D, 0x09, 0x09, 0xFF, 0xFE, 0xFA, 0xF7, 0xFF, 0xFF, 0xFE, 0xFE, 
-    0xFD, 0xFA, 0xFD, 0xFF, 0xFB, 0xF9, 0xFD, 0xFF, 0xFB, 0xF7, 0xF0, 0xF3, 
-    0xFA, 0xFD, 0xF9, 0xF4, 0xF1, 0xEB, 0xE6, 0xEB, 0xF2, 0xF7, 0x01, 0x03, 
-    0x01, 0x00, 0xFC, 0xFA, 0xFB, 0xF8, 0xF5, 0xF2, 0xEE, 0xEE, 0xEF, 0xED, 
-    0xF2, 0xEF, 0xEF, 0xF0, 0xF1, 0xF2, 0xED, 0xEE, 0xEE, 0xEF, 0xF2, 0xF2, 
-    0xEF, 0xEF, 0xEA, 0xEA, 0xF2, 0xF6, 0xF9, 0xFB, 0xF9, 0xF0, 0xE9, 0xE5, 
-    0xE8, 0xEF, 0xF7, 0xFE, 0x02, 0xFF, 0xFD, 0xFC, 0xF5, 0xF3, 0xF0, 0xEC, 
-    0xED, 0xEC, 0xEB, 0xEB, 0xED, 0xEC, 0xEC, 0xED, 0xED, 0xEF, 0xEC, 0xE6, 
-    0xE2, 0xE0, 0xE2, 0xE7, 0xE8, 0xE8, 0xE4, 0xE6, 0xE8, 0xED, 0xF2, 0xF1, 
-    0xEE, 0xEC, 0xE9, 0xE4, 0xE3, 0xE4, 0xE7, 0xF0, 0xF8, 0xFA, 0xFB, 0xFA, 
-    0xF6, 0xF7, 0xF9, 0xF6, 0xF6, 0xF3, 0xED, 0xEA, 0xEC, 0xEC, 0xED, 0xEE, 
-    0xEA, 0xEC, 0xEE, 0xEF, 0xF4, 0xF2, 0xF4, 0xF5, 0xF0, 0xF0, 0xEE, 0xEC, 
-    0xE7, 0xE9, 0xEE, 0xF1, 0xF2, 0xEE, 0xEA, 0xE8, 0xE5, 0xE4, 0xE9, 0xEB, 
-    0xF5, 0xFC, 0xFC, 0xFC, 0xF9, 0xF9, 0xF9, 0xF5, 0xF2, 0xF3, 0xF7, 0xFA, 
-    0xFA, 0xFC, 0xFE, 0xFD, 0xFD, 0xFA, 0xFC, 0xFF, 0x01, 0x00, 0xFF, 0xFB, 
-    0xFB, 0xFE, 0xFD, 0x02, 0x00, 0x01, 0x06, 0x0C, 0x12, 0x0F, 0x0C, 0x0B, 
-    0x08, 0x08, 0x08, 0x0C, 0x12, 0x1A, 0x24, 0x24, 0x24, 0x21, 0x1F, 0x1C, 
-    0x1B, 0x18, 0x16, 0x13, 0x13, 0x14, 0x17, 0x18, 0x19, 0x1B, 0x1B, 0x1A, 
-    0x16, 0x15, 0x1A, 0x1E, 0x1B, 0x19, 0x19, 0x18, 0x19, 0x19, 0x18, 0x1A, 
-    0x1D, 0x1D, 0x17, 0x11, 0x0C, 0x07, 0x06, 0x06, 0x06, 0x0D, 0x14, 0x19, 
-    0x1D, 0x1D, 0x18, 0x12, 0x0E, 0x0F, 0x0E, 0x10, 0x10, 0x0F, 0x0E, 0x0E, 
-    0x11, 0x0F, 0x12, 0x13, 0x13, 0x14, 0x15, 0x16, 0x16, 0x19, 0x1B, 0x1C, 
-    0x1A, 0x16, 0x16, 0x13, 0x17, 0x1B, 0x1C, 0x1E, 0x1D, 0x1A, 0x16, 0x11, 
-    0x0D, 0x0F, 0x13, 0x16, 0x17, 0x16, 0x11, 0x0E, 0x09, 0x07, 0x06, 0x06, 
-    0x04, 0x00, 0x00, 0xFD, 0xFA, 0xF9, 0xFB, 0xF9, 0xF8, 0xF9, 0xF7, 0xF3, 
-    0xF3, 0xF4, 0xF3, 0xF7, 0xF9, 0xF8, 0xF7, 0xF4, 0xF1, 0xF5, 0xF8, 0xF7, 
-    0xF1, 0xE7, 0xE1, 0xDE, 0xE0, 0xE5, 0xEC, 0xF2, 0xF6, 0xFB, 0xFF, 0x02, 
-    0x01, 0xFE, 0xF8, 0xF5, 0xEF, 0xEE, 0xF0, 0xEE, 0xED, 0xEE, 0xEF, 0xF0, 
-    0xED, 0xEF, 0xEF, 0xEE, 0xEE, 0xEB, 0xEB, 0xE9, 0xE8, 0xE7, 0xE6, 0xE4, 
-    0xE3, 0xE5, 0xE9, 0xEF, 0xF2, 0xF2, 0xF3, 0xEE, 0xEC, 0xEB, 0xEE, 0xF4, 
-    0xF7, 0xFC, 0xFD, 0xFC, 0xF7, 0xF8, 0xFA, 0xF8, 0xF7, 0xF5, 0xF1, 0xF0, 
-    0xEF, 0xEE, 0xF0, 0xF2, 0xF3, 0xF3, 0xEE, 0xEB, 0xEB, 0xEA, 0xEC, 0xEA, 
-    0xE8, 0xE6, 0xE7, 0xE8, 0xEA, 0xEA, 0xEB, 0xF0, 0xF6, 0xF7, 0xF5, 0xF0, 
-    0xEC, 0xEA, 0xE8, 0xEA, 0xED, 0xF2, 0xF7, 0xF9, 0xF9, 0xF6, 0xF6, 0xF7, 
-    0xF7, 0xF6, 0xF3, 0xF3, 0xF1, 0xEF, 0xEF, 0xEC, 0xE7, 0xE6, 0xE5, 0xE6, 
-    0xE8, 0xE5, 0xE4, 0xE5, 0xE5, 0xE8, 0xEA, 0xED, 0xEE, 0xEC, 0xEA, 0xEC, 
-    0xF2, 0xF3, 0xF2, 0xEF, 0xEA, 0xE7, 0xE8, 0xEB, 0xF2, 0xF8, 0x00, 0x08, 
-    0x0B, 0x0B, 0x0A, 0x06, 0x00, 0xFC, 0xF9, 0xF9, 0xF8, 0xF6, 0xF5, 0xF6, 
-    0xF8, 0xFB, 0xFE, 0xFF, 0x00, 0x02, 0x06, 0x07, 0x09, 0x0D, 0x0E, 0x10, 
-    0x10, 0x10, 0x11, 0x11, 0x15, 0x1D, 0x20, 0x21, 0x20, 0x1D, 0x1A, 0x1A, 
-    0x1A, 0x1C, 0x1D, 0x1F, 0x21, 0x1E, 0x19, 0x15, 0x15, 0x18, 0x1A, 0x1D, 
-    0x1F, 0x1E, 0x1C, 0x1D, 0x1E, 0x20, 0x1E, 0x1D, 0x17, 0x15, 0x15, 0x15, 
-    0x16, 0x13, 0x12, 0x10, 0x12, 0x12, 0x13, 0x10, 0x11, 0x14, 0x18, 0x1A, 
-    0x17, 0x12, 0x0A, 0x04, 0x03, 0x05, 0x0B, 0x12, 0x18, 0x1C, 0x1C, 0x1D, 
-    0x1D, 0x1F, 0x1E, 0x1F, 0x1D, 0x1B, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x17, 
-    0x15, 0x13, 0x10, 0x0F, 0x12, 0x14, 0x15, 0x14, 0x13, 0x12, 0x10, 0x0C, 
-    0x07, 0x05, 0x07, 0x07, 0x06, 0x02, 0xFC, 0xF5, 0xF4, 0xF8, 0xFD, 0x04, 
-    0x09, 0x0E, 0x12, 0x12, 0x0E, 0x09, 0x06, 0x06, 0x04, 0x02, 0x01, 0x00, 
-    0xFD, 0xFB, 0xFC, 0x00, 0x01, 0xFF, 0xF9, 0xF5, 0xF4, 0xF0, 0xEE, 0xE9, 
-    0xE6, 0xE5, 0xE2, 0xDF, 0xDF, 0xDE, 0xDF, 0xE6, 0xEA, 0xEC, 0xED, 0xEA, 
-    0xE8, 0xE8, 0xEA, 0xEC, 0xEF, 0xF4, 0xF8, 0xFB, 0xFB, 0xF7, 0xF3, 0xF3, 
-    0xF4, 0xF9, 0xFB, 0xFB, 0xF9, 0xF7, 0xF5, 0xF3, 0xF1, 0xED, 0xE9, 0xE4, 
-    0xE1, 0xE2, 0xE6, 0xEB, 0xEF, 0xF0, 0xF1, 0xF4, 0xF7, 0xF9, 0xF9, 0xFA, 
-    0xFB, 0xFB, 0xFA, 0xF4, 0xEE, 0xE9, 0xE7, 0xEA, 0xEE, 0xF4, 0xF8, 0xFA, 
-    0xFA, 0xF8, 0xF6, 0xF6, 0xF3, 0xF4, 0xF3, 0xEE, 0xEC, 0xE9, 0xE6, 0xE4, 
-    0xE4, 0xE3, 0xE4, 0xE4, 0xE5, 0xE7, 0xE9, 0xEC, 0xEE, 0xF1, 0xF4, 0xF6, 
-    0xF5, 0xF6, 0xF5, 0xF2, 0xF3, 0xF7, 0xF9, 0xF8, 0xF2, 0xED, 0xEB, 0xEE, 
-    0xF3, 0xF6, 0xFA, 0xFA, 0xFB, 0xFD, 0xF9, 0xF6, 0xF2, 0xF0, 0xEF, 0xEE, 
-    0xEC, 0xEA, 0xE8, 0xE6, 0xE6, 0xEA, 0xED, 0xED, 0xEA, 0xE7, 0xE7, 0xE7, 
-    0xEA, 0xEB, 0xEC, 0xEB, 0xEA, 0xEA, 0xEA, 0xEC, 0xEE, 0xF6, 0xFC, 0xFF, 
-    0x00, 0xFF, 0xFD, 0xFA, 0xF7, 0xF7, 0xF9, 0xFC, 0xFE, 0x01, 0x00, 0xFE, 
-    0xFD, 0xFE, 0x00, 0x03, 0x07, 0x09, 0x0B, 0x0A, 0x0A, 0x0C, 0x0F, 0x10, 
-    0x11, 0x0F, 0x10, 0x12, 0x14, 0x17, 0x18, 0x1A, 0x1A, 0x1A, 0x1C, 0x1D, 
-    0x1B, 0x18, 0x19, 0x1A, 0x1B, 0x18, 0x14, 0x0F, 0x0E, 0x10, 0x14, 0x1A, 
-    0x20, 0x27, 0x2A, 0x2C, 0x28, 0x24, 0x22, 0x22, 0x22, 0x22, 0x21, 0x1E, 
-    0x1A, 0x18, 0x17, 0x15, 0x16, 0x17, 0x15, 0x15, 0x16, 0x18, 0x1E, 0x1E, 
-    0x1A, 0x18, 0x12, 0x0D, 0x08, 0x04, 0x03, 0x05, 0x0B, 0x0D, 0x10, 0x0E, 
-    0x08, 0x06, 0x05, 0x05, 0x09, 0x0D, 0x11, 0x19, 0x1E, 0x1D, 0x1D, 0x19, 
-    0x1B, 0x1B, 0x1C, 0x1B, 0x14, 0x14, 0x0E, 0x14, 0x17, 0x16, 0x15, 0x0F, 
-    0x0C, 0x0A, 0x07, 0x08, 0x07, 0x05, 0x06, 0x06, 0x08, 0x07, 0x04, 0x03, 
-    0x05, 0x01, 0x01, 0xFB, 0xF0, 0xEE, 0xEA, 0xEF, 0xF8, 0xFB, 0x00, 0x02, 
-    0x05, 0x01, 0xFC, 0xF7, 0xF3, 0xF5, 0xF3, 0xF4, 0xEF, 0xEF, 0xEB, 0xEA, 
-    0xEC, 0xE8, 0xEA, 0xE7, 0xE4, 0xE6, 0xE7, 0xE7, 0xE7, 0xEB, 0xEC, 0xF0, 
-    0xEE, 0xEF, 0xF1, 0xF1, 0xF5, 0xF8, 0xF9, 0xF7, 0xF4, 0xEF, 0xEE, 0xF0, 
-    0xF8, 0xF9, 0x02, 0x05, 0x04, 0x06, 0xFF, 0xFB, 0xF4, 0xF3, 0xF2, 0xF0, 
-    0xF1, 0xF6, 0xF5, 0xF3, 0xF2, 0xEF, 0xEF, 0xF0, 0xEE, 0xEE, 0xF1, 0xF0, 
-    0xF1, 0xF1, 0xF3, 0xF2, 0xF1, 0xEF, 0xED, 0xED, 0xEB, 0xEE, 0xF4, 0xF2, 
-    0xF1, 0xEE, 0xE9, 0xE6, 0xE4, 0xE6, 0xE6, 0xED, 0xF0, 0xF4, 0xF5, 0xF3, 
-    0xF0, 0xEE, 0xEC, 0xEA, 0xED, 0xEE, 0xEF, 0xF1, 0xEF, 0xEF, 0xEF, 0xED, 
-    0xF0, 0xEE, 0xEE, 0xEB, 0xEB, 0xEB, 0xEB, 0xEA, 0xE9, 0xEA, 0xE5, 0xE7, 
-    0xE6, 0xE8, 0xEB, 0xEC, 0xEC, 0xEA, 0xE7, 0xE4, 0xE1, 0xE1, 0xE7, 0xED, 
-    0xF5, 0xFA, 0xFE, 0xFD, 0xFB, 0xF6, 0xEF, 0xEE, 0xED, 0xF3, 0xF4, 0xF2, 
-    0xF0, 0xEE, 0xEC, 0xEF, 0xF4, 0xF5, 0xF7, 0xF4, 0xF5, 0xFA, 0xFE, 0x01, 
-    0x01, 0xFF, 0xFC, 0xFB, 0xFA, 0xFA, 0xF9, 0xFC, 0xFD, 0xFD, 0xFC, 0xFB, 
-    0xF9, 0xFA, 0xFE, 0x02, 0x0C, 0x0F, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 
-    0x14, 0x17, 0x18, 0x1A, 0x1B, 0x1C, 0x1C, 0x1B, 0x1B, 0x19, 0x1B, 0x1B, 
-    0x19, 0x19, 0x18, 0x19, 0x19, 0x1B, 0x1C, 0x1E, 0x1D, 0x1E, 0x1E, 0x1E, 
-    0x23, 0x24, 0x24, 0x1D, 0x17, 0x0F, 0x0A, 0x09, 0x0C, 0x10, 0x14, 0x17, 
-    0x18, 0x1B, 0x17, 0x15, 0x11, 0x0F, 0x0D, 0x0C, 0x08, 0x07, 0x08, 0x0A, 
-    0x0B, 0x0B, 0x0A, 0x0A, 0x0A, 0x08, 0x0C, 0x0C, 0x10, 0x12, 0x14, 0x15, 
-    0x15, 0x17, 0x16, 0x15, 0x14, 0x17, 0x17, 0x15, 0x11, 0x0E, 0x0C, 0x0E, 
-    0x15, 0x1A, 0x22, 0x25, 0x24, 0x24, 0x1F, 0x1A, 0x18, 0x14, 0x12, 0x12, 
-    0x12, 0x13, 0x12, 0x11, 0x0D, 0x09, 0x05, 0x03, 0x00, 0xFE, 0xFE, 0xFC, 
-    0xFD, 0xFB, 0xFD, 0xFB, 0xF9, 0xF9, 0xFA, 0xFC, 0xFD, 0x00, 0xFF, 0xFF, 
-    0xFB, 0xF8, 0xF4, 0xF0, 0xF1, 0xF1, 0xF6, 0xF9, 0xFB, 0xFC, 0xF9, 0xF8, 
-    0xF1, 0xED, 0xE9, 0xE9, 0xEB, 0xEE, 0xEF, 0xEF, 0xEF, 0xEC, 0xED, 0xEA, 
-    0xEA, 0xE8, 0xE7, 0xE6, 0xE8, 0xE8, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEE, 
-    0xEE, 0xF2, 0xF6, 0xFB, 0xFB, 0xF7, 0xF3, 0xF0, 0xEC, 0xEC, 0xEE, 0xF3, 
-    0xFB, 0x01, 0x06, 0x09, 0x07, 0x01, 0xFE, 0xFB, 0xFA, 0xFB, 0xFC, 0xFB, 
-    0xF9, 0xF7, 0xF5, 0xF4, 0xF1, 0xEF, 0xED, 0xEC, 0xEF, 0xEE, 0xF0, 0xF1, 
-    0xF2, 0xF5, 0xF1, 0xEE, 0xE8, 0xE7, 0xE7, 0xEB, 0xEE, 0xEB, 0xE8, 0xE4, 
-    0xE3, 0xE3, 0xE6, 0xEB, 0xF2, 0xF6, 0xF8, 0xF5, 0xF2, 0xF3, 0xF3, 0xF3, 
-    0xF2, 0xF3, 0xF5, 0xF7, 0xF9, 0xF9, 0xF7, 0xF4, 0xF1, 0xEE, 0xEC, 0xED, 
-    0xEF, 0xEE, 0xED, 0xEC, 0xED, 0xEE, 0xED, 0xEE, 0xEC, 0xEC, 0xED, 0xF1, 
-    0xF3, 0xF4, 0xF0, 0xEA, 0xE7, 0xE3, 0xE3, 0xE3, 0xE5, 0xE9, 0xEE, 0xF1, 
-    0xF0, 0xF0, 0xEF, 0xEE, 0xED, 0xED, 0xF0, 0xF2, 0xF7, 0xF9, 0xF9, 0xF6, 
-    0xF7, 0xF6, 0xF7, 0xF7, 0xF6, 0xF8, 0xF8, 0xFB, 0xFF, 0x01, 0x02, 0x03, 
-    0x02, 0x03, 0x03, 0x04, 0x08, 0x0D, 0x0F, 0x0E, 0x0C, 0x09, 0x08, 0x07, 
-    0x09, 0x0C, 0x13, 0x1B, 0x23, 0x25, 0x27, 0x27, 0x26, 0x26, 0x23, 0x22, 
-    0x23, 0x24, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1E, 0x1C, 0x1A, 0x19, 0x1A, 
-    0x1B, 0x1B, 0x1C, 0x1E, 0x1F, 0x1E, 0x1B, 0x18, 0x17, 0x18, 0x1A, 0x1A, 
-    0x17, 0x12, 0x0E, 0x0C, 0x0D, 0x0F, 0x12, 0x14, 0x17, 0x16, 0x13, 0x10, 
-    0x0C, 0x0A, 0x09, 0x0A, 0x0C, 0x0F, 0x11, 0x13, 0x11, 0x11, 0x0F, 0x0D, 
-    0x0C, 0x09, 0x08, 0x07, 0x08, 0x09, 0x09, 0x0C, 0x0D, 0x0E, 0x10, 0x12, 
-    0x10, 0x11, 0x13, 0x13, 0x13, 0x10, 0x0B, 0x07, 0x04, 0x07, 0x0B, 0x10, 
-    0x14, 0x17, 0x18, 0x16, 0x13, 0x0F, 0x0D, 0x0B, 0x09, 0x07, 0x05, 0x04, 
-    0x04, 0x02, 0xFF, 0xFC, 0xF7, 0xF5, 0xF3, 0xF2, 0xF1, 0xF1, 0xF4, 0xF6, 
-    0xF9, 0xFB, 0xFC, 0xFB, 0xFA, 0xF6, 0xF5, 0xF6, 0xF7, 0xF6, 0xF1, 0xEC, 
-    0xE8, 0xE6, 0xE7, 0xEC, 0xEF, 0xF2, 0xF5, 0xF6, 0xF6, 0xF4, 0xF3, 0xEF, 
-    0xEE, 0xEF, 0xEE, 0xEF, 0xF1, 0xF2, 0xF5, 0xF5, 0xF4, 0xF2, 0xF1, 0xF0, 
-    0xEE, 0xED, 0xED, 0xEE, 0xF1, 0xF4, 0xF6, 0xF6, 0xF6, 0xF4, 0xF1, 0xF2, 
-    0xF4, 0xF5, 0xF2, 0xEE, 0xEC, 0xEB, 0xEC, 0xEF, 0xF1, 0xF4, 0xF6, 0xF5, 
-    0xF4, 0xF1, 0xF0, 0xED, 0xED, 0xEC, 0xED, 0xED, 0xEE, 0xED, 0xEB, 0xEA, 
-    0xEB, 0xEA, 0xE9, 0xE7, 0xE5, 0xE5, 0xE7, 0xE9, 0xE8, 0xE9, 0xEC, 0xEF, 
-    0xF1, 0xF1, 0xF0, 0xEF, 0xEF, 0xF0, 0xEF, 0xED, 0xE9, 0xE5, 0xE4, 0xE7, 
-    0xEB, 0xEF, 0xF2, 0xF6, 0xFA, 0xFB, 0xFB, 0xFA, 0xF8, 0xF6, 0xF5, 0xF5, 
-    0xF6, 0xF5, 0xF4, 0xF2, 0xF2, 0xF3, 0xF5, 0xF5, 0xF1, 0xEE, 0xEB, 0xEB, 
-    0xED, 0xEE, 0xEE, 0xED, 0xEC, 0xEC, 0xEB, 0xEB, 0xEC, 0xEE, 0xF1, 0xF3, 
-    0xF3, 0xEF, 0xEB, 0xEA, 0xED, 0xEF, 0xF2, 0xF5, 0xF8, 0xFC, 0xFF, 0x00, 
-    0xFC, 0xF6, 0xF2, 0xF2, 0xF4, 0xF8, 0xF8, 0xF8, 0xFB, 0x02, 0x06, 0x07, 
-    0x06, 0x04, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x09, 0x0E, 0x10, 0x11, 
-    0x10, 0x0F, 0x10, 0x13, 0x12, 0x11, 0x10, 0x10, 0x11, 0x14, 0x19, 0x1E, 
-    0x22, 0x23, 0x24, 0x25, 0x26, 0x25, 0x25, 0x24, 0x24, 0x23, 0x23, 0x22, 
-    0x20, 0x1D, 0x1B, 0x1B, 0x1A, 0x19, 0x15, 0x0F, 0x0C, 0x0C, 0x0E, 0x0F, 
-    0x10, 0x11, 0x13, 0x13, 0x12, 0x12, 0x13, 0x16, 0x16, 0x14, 0x10, 0x0B, 
-    0x08, 0x08, 0x0C, 0x10, 0x13, 0x15, 0x16, 0x15, 0x14, 0x13, 0x10, 0x0B, 
-    0x09, 0x0B, 0x0E, 0x12, 0x15, 0x16, 0x15, 0x14, 0x12, 0x0F, 0x0E, 0x0D, 
-    0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0B, 0x09, 0x08, 0x06, 0x05, 0x05, 
-    0x07, 0x07, 0x05, 0x03, 0xFF, 0xFC, 0xF9, 0xF7, 0xF8, 0xFA, 0xFD, 0xFF, 
-    0xFF, 0xFC, 0xF8, 0xF5, 0xF4, 0xF6, 0xF6, 0xF6, 0xF4, 0xF1, 0xF1, 0xF4, 
-    0xF6, 0xF6, 0xF2, 0xEC, 0xE8, 0xE6, 0xE7, 0xE9, 0xEA, 0xEA, 0xEA, 0xEC, 
-    0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF6, 0xF8, 0xF7, 0xF4, 0xF0, 0xEE, 0xF1, 
-    0xF7, 0xFA, 0xF9, 0xF9, 0xFA, 0xFD, 0xFE, 0xFD, 0xFB, 0xFA, 0xF9, 0xF9, 
-    0xFC, 0xFC, 0xFB, 0xFA, 0xF8, 0xF7, 0xF9, 0xFC, 0xFD, 0xFC, 0xFA, 0xF7, 
-    0xF7, 0xF6, 0xF7, 0xF6, 0xF4, 0xF3, 0xF2, 0xF2, 0xF3, 0xF5, 0xF8, 0xFA, 
-    0xF7, 0xF0, 0xEA, 0xE8, 0xEA, 0xEE, 0xF0, 0xF1, 0xF2, 0xF4, 0xF5, 0xF3, 
-    0xF0, 0xEB, 0xE9, 0xE8, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xF0, 0xF1, 0xF1, 
-    0xEE, 0xEA, 0xE6, 0xE5, 0xE6, 0xEA, 0xEB, 0xE9, 0xE9, 0xE8, 0xEB, 0xED, 
-    0xED, 0xEF, 0xF1, 0xF3, 0xF3, 0xF1, 0xED, 0xE9, 0xE7, 0xE8, 0xEE, 0xF2, 
-    0xF4, 0xF6, 0xF9, 0xFB, 0xFA, 0xF7, 0xF3, 0xF1, 0xF3, 0xF5, 0xF4, 0xF4, 
-    0xF4, 0xF6, 0xF7, 0xF4, 0xF2, 0xEC, 0xE8, 0xE5, 0xE4, 0xE6, 0xE9, 0xE9, 
-    0xEA, 0xEE, 0xF2, 0xF3, 0xF3, 0xF4, 0xF7, 0xFA, 0xFC, 0xFA, 0xF7, 0xF5, 
-    0xF4, 0xF6, 0xFA, 0x00, 0x06, 0x0B, 0x0D, 0x0C, 0x0B, 0x0B, 0x0A, 0x09, 
-    0x07, 0x09, 0x0C, 0x10, 0x13, 0x14, 0x18, 0x1A, 0x1C, 0x1C, 0x1A, 0x16, 
-    0x15, 0x14, 0x15, 0x17, 0x18, 0x19, 0x19, 0x19, 0x18, 0x19, 0x19, 0x1A, 
-    0x1B, 0x1C, 0x19, 0x16, 0x14, 0x14, 0x15, 0x16, 0x16, 0x15, 0x14, 0x14, 
-    0x16, 0x15, 0x13, 0x0F, 0x0B, 0x09, 0x0A, 0x0E, 0x10, 0x10, 0x0F, 0x0F, 
-    0x10, 0x11, 0x0F, 0x0B, 0x06, 0x05, 0x08, 0x0D, 0x0D, 0x0D, 0x0C, 0x0D, 
-    0x0F, 0x10, 0x11, 0x12, 0x18, 0x1E, 0x20, 0x1C, 0x15, 0x10, 0x0E, 0x0F, 
-    0x12, 0x15, 0x17, 0x1A, 0x1B, 0x1B, 0x1A, 0x1A, 0x18, 0x14, 0x12, 0x11, 
-    0x11, 0x13, 0x13, 0x12, 0x0F, 0x0C, 0x0B, 0x0B, 0x0A, 0x0A, 0x08, 0x08, 
-    0x09, 0x08, 0x07, 0x02, 0xFE, 0xFC, 0xFD, 0xFE, 0xFD, 0xFB, 0xFA, 0xFB, 
-    0xFA, 0xF8, 0xF3, 0xEE, 0xEC, 0xEF, 0xF4, 0xF8, 0xF8, 0xF9, 0xF9, 0xFA, 
-    0xF8, 0xF4, 0xEF, 0xEB, 0xE9, 0xE9, 0xEB, 0xEC, 0xEB, 0xED, 0xEC, 0xEC, 
-    0xEB, 0xE9, 0xE6, 0xE4, 0xE5, 0xE7, 0xE9, 0xE7, 0xE6, 0xE6, 0xE7, 0xE9, 
-    0xEA, 0xED, 0xF3, 0xF8, 0xFA, 0xF9, 0xF5, 0xF2, 0xF0, 0xF4, 0xF9, 0xFC, 
-    0xFF, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0xFA, 0xF8, 0xF8, 0xFB, 0xFE, 0x01, 
-    0x03, 0x02, 0x02, 0x01, 0x00, 0xFE, 0xFA, 0xF7, 0xF7, 0xF8, 0xF8, 0xF5, 
-    0xF3, 0xEF, 0xED, 0xED, 0xEC, 0xEC, 0xEE, 0xF1, 0xF1, 0xEE, 0xE8, 0xE5, 
-    0xE3, 0xE3, 0xE6, 0xE9, 0xEF, 0xF4, 0xFA, 0xFF, 0x01, 0xFF, 0xFA, 0xF3, 
-    0xEF, 0xEE, 0xEE, 0xF0, 0xF0, 0xF1, 0xF4, 0xF9, 0xFA, 0xF8, 0xF4, 0xF1, 
-    0xF1, 0xF0, 0xF2, 0xF3, 0xF6, 0xF7, 0xF6, 0xF5, 0xF3, 0xF2, 0xF1, 0xF0, 
-    0xF1, 0xF0, 0xEF, 0xEE, 0xEC, 0xEA, 0xE9, 0xEA, 0xEE, 0xF1, 0xF5, 0xF5, 
-    0xF4, 0xF2, 0xF0, 0xED, 0xE8, 0xE4, 0xE4, 0xE8, 0xEC, 0xF1, 0xF3, 0xF5, 
-    0xF7, 0xFA, 0xF9, 0xF6, 0xF2, 0xEF, 0xF0, 0xF3, 0xF4, 0xF3, 0xF2, 0xF2, 
-    0xF4, 0xF7, 0xFA, 0xFD, 0x02, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0D, 
-    0x0F, 0x12, 0x18, 0x1C, 0x1F, 0x20, 0x1F, 0x1F, 0x20, 0x1F, 0x1E, 0x1D, 
-    0x1E, 0x20, 0x21, 0x22, 0x21, 0x20, 0x22, 0x22, 0x21, 0x1E, 0x1D, 0x1E, 
-    0x21, 0x24, 0x23, 0x20, 0x1E, 0x1D, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1C, 
-    0x1A, 0x17, 0x14, 0x12, 0x12, 0x12, 0x14, 0x17, 0x1A, 0x1D, 0x1C, 0x1C, 
-    0x1B, 0x17, 0x12, 0x0E, 0x0B, 0x0B, 0x0E, 0x11, 0x12, 0x11, 0x12, 0x11, 
-    0x10, 0x0E, 0x0C, 0x0A, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0C, 0x0B, 
-    0x0C, 0x10, 0x14, 0x16, 0x16, 0x15, 0x13, 0x12, 0x10, 0x0F, 0x0E, 0x0F, 
-    0x12, 0x13, 0x11, 0x0F, 0x0B, 0x09, 0x0A, 0x0A, 0x09, 0x08, 0x09, 0x0A, 
-    0x0C, 0x0E, 0x0F, 0x0E, 0x0F, 0x0F, 0x0E, 0x0B, 0x07, 0x05, 0x04, 0x02, 
-    0xFF, 0xFC, 0xF9, 0xF6, 0xF5, 0xF4, 0xF3, 0xF4, 0xF5, 0xF1, 0xEC, 0xE6, 
-    0xE3, 0xE3, 0xE4, 0xE7, 0xEB, 0xEF, 0xF2, 0xF4, 0xF5, 0xF6, 0xF6, 0xF3, 
-    0xF0, 0xEE, 0xEE, 0xF1, 0xF4, 0xF7, 0xFA, 0xFB, 0xFA, 0xFA, 0xFB, 0xFC, 
-    0xFC, 0xFB, 0xF9, 0xF8, 0xF9, 0xF9, 0xF9, 0xF7, 0xF6, 0xF7, 0xF9, 0xFB, 
-    0xFD, 0xFE, 0xFC, 0xF9, 0xF5, 0xF3, 0xF0, 0xF0, 0xF1, 0xF3, 0xF6, 0xF8, 
-    0xFB, 0xFA, 0xF7, 0xF3, 0xF0, 0xED, 0xEB, 0xEA, 0xEC, 0xEF, 0xF2, 0xF4, 
-    0xF4, 0xF5, 0xF4, 0xF2, 0xEF, 0xEC, 0xEA, 0xEA, 0xEA, 0xEB, 0xEB, 0xEA, 
-    0xEA, 0xE9, 0xE9, 0xEA, 0xED, 0xF0, 0xF2, 0xF3, 0xF4, 0xF4, 0xF6, 0xF8, 
-    0xFC, 0xFF, 0x01, 0x03, 0x05, 0x04, 0x02, 0x00, 0xFF, 0xFD, 0xF9, 0xF7, 
-    0xF6, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0, 0xEF, 0xEC, 0xEA, 0xE9, 0xE9, 0xEB, 
-    0xEC, 0xED, 0xED, 0xEC, 0xEC, 0xEB, 0xE9, 0xE9, 0xEC, 0xEF, 0xF2, 0xF2, 
-    0xF1, 0xF2, 0xF1, 0xEE, 0xED, 0xEC, 0xEE, 0xF1, 0xF5, 0xF6, 0xF7, 0xF6, 
-    0xF7, 0xF8, 0xF9, 0xF8, 0xF6, 0xF4, 0xF5, 0xF6, 0xF7, 0xF9, 0xFB, 0xFE, 
-    0xFE, 0xFC, 0xFA, 0xF8, 0xF9, 0xFC, 0xFE, 0xFF, 0x00, 0x02, 0x03, 0x05, 
-    0x07, 0x09, 0x0D, 0x11, 0x14, 0x15, 0x14, 0x10, 0x0E, 0x0F, 0x11, 0x15, 
-    0x19, 0x1E, 0x20, 0x21, 0x21, 0x20, 0x1E, 0x1C, 0x1A, 0x19, 0x1A, 0x1B, 
-    0x1D, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x22, 0x20, 0x1F, 0x1F, 0x21, 0x23, 
-    0x22, 0x20, 0x1D, 0x1B, 0x17, 0x16, 0x15, 0x14, 0x13, 0x0E, 0x09, 0x07, 
-    0x05, 0x06, 0x05, 0x06, 0x08, 0x0B, 0x0F, 0x11, 0x13, 0x15, 0x14, 0x12, 
-    0x10, 0x0C, 0x0B, 0x0C, 0x0E, 0x10, 0x11, 0x14, 0x16, 0x18, 0x1A, 0x19, 
-    0x18, 0x15, 0x15, 0x15, 0x14, 0x13, 0x10, 0x0D, 0x0B, 0x0B, 0x0C, 0x0D, 
-    0x0E, 0x0E, 0x0D, 0x0A, 0x06, 0x03, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 
-    0x03, 0x04, 0x03, 0x01, 0xFF, 0xFC, 0xF8, 0xF6, 0xF5, 0xF7, 0xF8, 0xF7, 
-    0xF5, 0xF3, 0xF2, 0xF1, 0xEF, 0xEC, 0xEA, 0xE9, 0xEB, 0xEC, 0xEB, 0xEB, 
-    0xEA, 0xE8, 0xE7, 0xE9, 0xED, 0xF1, 0xF3, 0xF2, 0xEF, 0xED, 0xEF, 0xF2, 
-    0xF7, 0xFA, 0xFD, 0x00, 0x04, 0x09, 0x0B, 0x0A, 0x07, 0x03, 0x00, 0xFD, 
-    0xFA, 0xF9, 0xFA, 0xFA, 0xF9, 0xF8, 0xF6, 0xF5, 0xF2, 0xF1, 0xF0, 0xEF, 
-    0xF0, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF3, 0xF4, 0xF4, 0xF5, 0xF7, 0xF7, 
-    0xF6, 0xF3, 0xF1, 0xF2, 0xF4, 0xF6, 0xF5, 0xF5, 0xF6, 0xF7, 0xF8, 0xF5, 
-    0xF1, 0xEB, 0xE9, 0xE7, 0xE5, 0xE6, 0xE8, 0xEB, 0xEE, 0xF1, 0xF3, 0xF4, 
-    0xF4, 0xF4, 0xF1, 0xEE, 0xEC, 0xEC, 0xED, 0xED, 0xEB, 0xE9, 0xE7, 0xE7, 
-    0xE9, 0xEC, 0xEF, 0xF2, 0xF4, 0xF3, 0xF1, 0xEE, 0xEB, 0xE8, 0xE7, 0xE9, 
-    0xEC, 0xF0, 0xF1, 0xF2, 0xF0, 0xEF, 0xEF, 0xF1, 0xF0, 0xEF, 0xED, 0xED, 
-    0xEF, 0xF3, 0xF5, 0xF6, 0xF7, 0xF7, 0xF8, 0xF7, 0xF6, 0xF6, 0xF6, 0xF7, 
-    0xF8, 0xF9, 0xF9, 0xF8, 0xF7, 0xF5, 0xF4, 0xF4, 0xF5, 0xF3, 0xEE, 0xEA, 
-    0xE7, 0xE7, 0xEA, 0xEE, 0xF1, 0xF5, 0xFA, 0xFE, 0xFF, 0xFD, 0xF9, 0xF7, 
-    0xF7, 0xF9, 0xFA, 0xFC, 0xFE, 0x02, 0x06, 0x0B, 0x0E, 0x10, 0x12, 0x13, 
-    0x13, 0x13, 0x12, 0x13, 0x12, 0x13, 0x14, 0x14, 0x13, 0x12, 0x11, 0x13, 
-    0x16, 0x19, 0x1C, 0x1B, 0x19, 0x17, 0x16, 0x17, 0x17, 0x19, 0x1B, 0x1E, 
-    0x20, 0x1F, 0x1C, 0x19, 0x16, 0x14, 0x10, 0x0C, 0x0B, 0x0C, 0x10, 0x13, 
-    0x14, 0x16, 0x17, 0x15, 0x11, 0x0C, 0x09, 0x08, 0x09, 0x08, 0x07, 0x08, 
-    0x0B, 0x0E, 0x10, 0x12, 0x14, 0x19, 0x1B, 0x19, 0x17, 0x13, 0x12, 0x11, 
-    0x13, 0x17, 0x1A, 0x1D, 0x1F, 0x21, 0x22, 0x23, 0x22, 0x21, 0x1E, 0x1B, 
-    0x16, 0x14, 0x15, 0x14, 0x14, 0x13, 0x12, 0x10, 0x0E, 0x0C, 0x0B, 0x09, 
-    0x08, 0x07, 0x05, 0x04, 0x05, 0x03, 0x00, 0xFE, 0xFE, 0x00, 0x03, 0x04, 
-    0x00, 0xFB, 0xF6, 0xF5, 0xF7, 0xFB, 0xFE, 0x01, 0x03, 0x05, 0x06, 0x03, 
-    0xFE, 0xF8, 0xF3, 0xEF, 0xEA, 0xE6, 0xE6, 0xEA, 0xEF, 0xF4, 0xF5, 0xF6, 
-    0xF5, 0xF4, 0xF2, 0xEF, 0xED, 0xEC, 0xED, 0xEC, 0xED, 0xEC, 0xEA, 0xE8, 
-    0xE7, 0xE9, 0xEC, 0xF1, 0xF3, 0xF2, 0xF1, 0xEF, 0xEE, 0xF0, 0xF3, 0xF5, 
-    0xF7, 0xF9, 0xFC, 0xFD, 0xFB, 0xF8, 0xF5, 0xF5, 0xF4, 0xF5, 0xF6, 0xF8, 
-    0xFB, 0x00, 0x05, 0x09, 0x0A, 0x09, 0x05, 0x02, 0x00, 0x00, 0x01, 0xFE, 
-    0xFB, 0xF9, 0xF9, 0xF9, 0xF8, 0xF6, 0xF4, 0xF5, 0xF4, 0xF4, 0xF0, 0xEC, 
-    0xE7, 0xE4, 0xE3, 0xE5, 0xE8, 0xEB, 0xEF, 0xF2, 0xF3, 0xF3, 0xF3, 0xF2, 
-    0xEF, 0xEC, 0xE9, 0xE8, 0xE9, 0xEB, 0xEE, 0xF0, 0xF1, 0xF0, 0xF0, 0xF1, 
-    0xF2, 0xF3, 0xF4, 0xF4, 0xF2, 0xF1, 0xF1, 0xF2, 0xF2, 0xF1, 0xEF, 0xEC, 
-    0xED, 0xEE, 0xEF, 0xEE, 0xEB, 0xE8, 0xE7, 0xE9, 0xEC, 0xF0, 0xF3, 0xF6, 
-    0xF8, 0xF6, 0xF3, 0xEE, 0xE9, 0xE6, 0xE5, 0xE6, 0xE6, 0xE8, 0xEB, 0xED, 
-    0xF0, 0xF2, 0xF4, 0xF5, 0xF3, 0xF0, 0xEF, 0xF0, 0xF0, 0xF1, 0xF0, 0xEF, 
-    0xF0, 0xF1, 0xF3, 0xF5, 0xF9, 0xFD, 0x00, 0x00, 0xFF, 0xFE, 0xFE, 0xFF, 
-    0x02, 0x05, 0x0A, 0x10, 0x16, 0x19, 0x1A, 0x18, 0x17, 0x13, 0x10, 0x10, 
-    0x15, 0x19, 0x1F, 0x25, 0x28, 0x2C, 0x2D, 0x2C, 0x25, 0x20, 0x1A, 0x14, 
-    0x14, 0x14, 0x16, 0x18, 0x1A, 0x19, 0x1A, 0x1C, 0x1B, 0x1C, 0x1A, 0x1D, 
-    0x1D, 0x1D, 0x18, 0x11, 0x0B, 0x0B, 0x10, 0x1B, 0x21, 0x1F, 0x1C, 0x13, 
-    0x0F, 0x10, 0x0F, 0x13, 0x12, 0x10, 0x0E, 0x08, 0x0C, 0x0B, 0x0E, 0x0F, 
-    0x0F, 0x10, 0x0F, 0x0E, 0x0E, 0x0A, 0x01, 0xFA, 0xF2, 0xF1, 0xEF, 0xF4, 
-    0xF8, 0xF9, 0xFD, 0xFB, 0x00, 0x06, 0x02, 0xFF, 0xF6, 0xEB, 0xED, 0xF2, 
-    0xFC, 0x09, 0x0E, 0x15, 0x12, 0x10, 0x08, 0xFE, 0xFA, 0xF5, 0xF9, 0xFF, 
-    0x06, 0x0B, 0x0F, 0x19, 0x14, 0x12, 0x10, 0x04, 0x0A, 0x07, 0x0C, 0x13, 
-    0x15, 0x16, 0x12, 0x12, 0x14, 0x0F, 0x08, 0x01, 0xF7, 0xF6, 0x00, 0x03, 
-    0x02, 0x07, 0x03, 0xFC, 0xF3, 0xEE, 0xE7, 0xE4, 0xE4, 0xEB, 0xEF, 0xF9, 
-    0xFE, 0xFA, 0xFA, 0xED, 0xEB, 0xDC, 0xE4, 0xE2, 0xE6, 0xEE, 0xEE, 0xF2, 
-    0xEB, 0xF2, 0xF5, 0xF9, 0xF5, 0xED, 0xE4, 0xDF, 0xE8, 0xEF, 0xF2, 0xFA, 
-    0xF8, 0xF8, 0xF8, 0xE9, 0xE2, 0xDC, 0xD4, 0xDF, 0xE5, 0xF1, 0xFE, 0x00, 
-    0x07, 0x01, 0xF9, 0xF0, 0xEA, 0xEA, 0xE7, 0xEB, 0xED, 0xF3, 0xED, 0xF0, 
-    0xF6, 0xF5, 0xF6, 0xE7, 0xDC, 0xCD, 0xCE, 0xD5, 0xDE, 0xE7, 0xEA, 0xE4, 
-    0xE1, 0xDB, 0xD1, 0xCF, 0xCA, 0xD3, 0xDA, 0xE6, 0xEE, 0xF9, 0xF8, 0xF9, 
-    0xF4, 0xEB, 0xE8, 0xE7, 0xEE, 0xED, 0xF7, 0xFB, 0xF4, 0xF6, 0xF9, 0xF9, 
-    0xFD, 0xF2, 0xE6, 0xD9, 0xD5, 0xDE, 0xEE, 0xFD, 0x02, 0xFF, 0xFB, 0xF3, 
-    0xE9, 0xE5, 0xDC, 0xDA, 0xD8, 0xE2, 0xEC, 0xF4, 0xF8, 0xF2, 0xEA, 0xDE, 
-    0xD6, 0xCC, 0xCF, 0xCA, 0xD3, 0xD7, 0xD9, 0xDC, 0xE1, 0xEC, 0xEE, 0xED, 
-    0xDF, 0xD6, 0xCD, 0xD1, 0xDC, 0xE6, 0xEA, 0xEF, 0xED, 0xE7, 0xEA, 0xE0, 
-    0xDA, 0xD6, 0xD6, 0xDE, 0xEC, 0xF8, 0x03, 0x05, 0xFE, 0xF5, 0xEC, 0xE4, 
-    0xE1, 0xDF, 0xE1, 0xEC, 0xEF, 0xF5, 0xF2, 0xF7, 0xF7, 0xEF, 0xE8, 0xD9, 
-    0xD7, 0xD9, 0xE8, 0xF0, 0xFB, 0x00, 0xFF, 0xF9, 0xE9, 0xE3, 0xD3, 0xCF, 
-    0xD2, 0xD6, 0xE7, 0xF6, 0x00, 0x07, 0x04, 0xF9, 0xEF, 0xE5, 0xE1, 0xE0, 
-    0xE6, 0xEB, 0xEF, 0xF7, 0xF6, 0xFF, 0xFD, 0xFC, 0xEE, 0xE3, 0xD8, 0xD0, 
-    0xD9, 0xE0, 0xEC, 0xF2, 0xFB, 0xF7, 0xF1, 0xE9, 0xE1, 0xDC, 0xD7, 0xDA, 
-    0xE1, 0xEE, 0xF4, 0xFC, 0xF7, 0xF1, 0xDE, 0xD3, 0xD4, 0xD0, 0xD9, 0xDA, 
-    0xDF, 0xE7, 0xEA, 0xF2, 0xF8, 0xF1, 0xEC, 0xD9, 0xCF, 0xCE, 0xD2, 0xE3, 
-    0xEC, 0xF6, 0xF9, 0xF9, 0xF5, 0xEC, 0xE6, 0xDE, 0xD8, 0xDF, 0xEB, 0xFC, 
-    0x0E, 0x1B, 0x1B, 0x14, 0x05, 0xF7, 0xED, 0xE7, 0xE2, 0xE6, 0xE8, 0xF0, 
-    0xFB, 0x03, 0x0E, 0x0D, 0x07, 0xF9, 0xF1, 0xED, 0xF4, 0x05, 0x11, 0x1B, 
-    0x24, 0x23, 0x20, 0x18, 0x0A, 0x00, 0xF7, 0xF6, 0xFF, 0x0D, 0x1F, 0x28, 
-    0x30, 0x2D, 0x22, 0x1D, 0x18, 0x14, 0x14, 0x1E, 0x1F, 0x27, 0x2B, 0x27, 
-    0x2F, 0x2E, 0x29, 0x1E, 0x11, 0x0B, 0x09, 0x13, 0x1C, 0x24, 0x2E, 0x2F, 
-    0x2B, 0x23, 0x1A, 0x07, 0x04, 0xFB, 0x01, 0x11, 0x17, 0x2B, 0x33, 0x31, 
-    0x29, 0x18, 0x09, 0x02, 0xFC, 0x07, 0x0A, 0x14, 0x1B, 0x1C, 0x26, 0x2D, 
-    0x2E, 0x27, 0x19, 0x0A, 0x04, 0x09, 0x16, 0x23, 0x2F, 0x32, 0x39, 0x35, 
-    0x31, 0x2A, 0x1B, 0x17, 0x17, 0x21, 0x32, 0x3C, 0x43, 0x46, 0x3F, 0x2E, 
-    0x20, 0x19, 0x13, 0x17, 0x1D, 0x25, 0x28, 0x2E, 0x31, 0x39, 0x39, 0x33, 
-    0x27, 0x19, 0x13, 0x11, 0x19, 0x26, 0x30, 0x37, 0x3B, 0x31, 0x2C, 0x21, 
-    0x17, 0x13, 0x0F, 0x1A, 0x2A, 0x3A, 0x47, 0x4B, 0x49, 0x37, 0x2E, 0x23, 
-    0x1A, 0x22, 0x21, 0x2C, 0x31, 0x38, 0x3C, 0x40, 0x41, 0x3B, 0x30, 0x1C, 
-    0x17, 0x0C, 0x11, 0x1C, 0x24, 0x31, 0x37, 0x3B, 0x34, 0x2C, 0x1E, 0x16, 
-    0x0F, 0x14, 0x1C, 0x25, 0x33, 0x38, 0x36, 0x30, 0x20, 0x10, 0x0C, 0x04, 
-    0x0A, 0x0A, 0x11, 0x13, 0x12, 0x13, 0x16, 0x15, 0x0B, 0x00, 0xEF, 0xEE, 
-    0xEF, 0xFC, 0x0B, 0x14, 0x1D, 0x21, 0x20, 0x17, 0x10, 0x04, 0xFC, 0x01, 
-    0x0B, 0x1A, 0x24, 0x2F, 0x29, 0x22, 0x12, 0xFC, 0xF4, 0xED, 0xED, 0xF6, 
-    0xFB, 0x00, 0x07, 0x0A, 0x15, 0x15, 0x12, 0x02, 0xF5, 0xEB, 0xE8, 0xEF, 
-    0xF7, 0x04, 0x0C, 0x11, 0x11, 0x0A, 0xFC, 0xF3, 0xE3, 0xE5, 0xE7, 0xF4, 
-    0x05, 0x0B, 0x14, 0x0D, 0x05, 0xF8, 0xEF, 0xEA, 0xEF, 0xF4, 0xF8, 0xFF, 
-    0xFF, 0x02, 0x07, 0x0B, 0x05, 0xFC, 0xEB, 0xDE, 0xD8, 0xDB, 0xE6, 0xF0, 
-    0xFD, 0x02, 0x03, 0xFE, 0xF8, 0xEA, 0xDD, 0xD6, 0xD6, 0xE4, 0xF1, 0xFE, 
-    0x02, 0xFE, 0xF6, 0xE5, 0xDC, 0xD3, 0xD2, 0xD9, 0xDF, 0xE7, 0xEC, 0xF3, 
-    0xF9, 0xFE, 0xFF, 0xF8, 0xE8, 0xDA, 0xCF, 0xD1, 0xD7, 0xE3, 0xF2, 0xFA, 
-    0xFF, 0xFA, 0xF2, 0xE7, 0xDA, 0xD1, 0xD0, 0xD8, 0xE5, 0xF5, 0x00, 0x04, 
-    0xFE, 0xEC, 0xE1, 0xD3, 0xD2, 0xD3, 0xD9, 0xDB, 0xE1, 0xE8, 0xF0, 0xFA, 
-    0xFD, 0xFE, 0xED, 0xE2, 0xDB, 0xD6, 0xDD, 0xE6, 0xEF, 0xFA, 0x02, 0x02, 
-    0xFB, 0xEF, 0xE4, 0xDA, 0xD9, 0xE0, 0xEB, 0xF6, 0x03, 0x06, 0x02, 0xF8, 
-    0xE3, 0xD6, 0xD1, 0xD1, 0xD7, 0xDD, 0xE2, 0xE8, 0xEC, 0xF2, 0xF7, 0xF5, 
-    0xED, 0xDC, 0xCE, 0xCB, 0xCD, 0xD6, 0xE4, 0xED, 0xF2, 0xF3, 0xEE, 0xE6, 
-    0xD9, 0xCC, 0xC5, 0xC8, 0xD6, 0xE5, 0xF1, 0xFB, 0xF9, 0xF2, 0xE5, 0xD7, 
-    0xD2, 0xCF, 0xD4, 0xDC, 0xE5, 0xEB, 0xEF, 0xF9, 0x01, 0x03, 0xFB, 0xEF, 
-    0xE0, 0xD8, 0xD6, 0xDC, 0xE6, 0xEE, 0xF8, 0xFA, 0xF9, 0xF1, 0xE9, 0xDF, 
-    0xD6, 0xD8, 0xDD, 0xE8, 0xF6, 0xFD, 0xFF, 0xF6, 0xE8, 0xDA, 0xCF, 0xD1, 
-    0xD3, 0xD9, 0xDE, 0xE2, 0xE9, 0xEF, 0xF6, 0xF8, 0xF2, 0xE8, 0xDA, 0xD4, 
-    0xD5, 0xD8, 0xE2, 0xEE, 0xF4, 0xFC, 0xFE, 0xF7, 0xEF, 0xDE, 0xD7, 0xD5, 
-    0xDA, 0xE8, 0xF4, 0xFF, 0x04, 0x04, 0xFA, 0xEC, 0xE3, 0xDB, 0xDB, 0xE1, 
-    0xE5, 0xEA, 0xF3, 0xF5, 0xFA, 0x00, 0xFE, 0xF6, 0xE7, 0xDD, 0xD6, 0xD8, 
-    0xDF, 0xE8, 0xF4, 0xF9, 0xFC, 0xF9, 0xF1, 0xE4, 0xDB, 0xD6, 0xD9, 0xE3, 
-    0xEC, 0xF7, 0xFD, 0xFD, 0xF3, 0xE6, 0xD7, 0xCE, 0xCF, 0xD7, 0xE6, 0xEE, 
-    0xF9, 0x00, 0x09, 0x14, 0x16, 0x0C, 0xFD, 0xE9, 0xDE, 0xE0, 0xE2, 0xED, 
-    0xFA, 0x02, 0x07, 0x09, 0x06, 0xFF, 0xF6, 0xF2, 0xF3, 0xFC, 0x0F, 0x1E, 
-    0x2B, 0x31, 0x2B, 0x21, 0x11, 0x06, 0x01, 0x01, 0x08, 0x0F, 0x12, 0x17, 
-    0x1E, 0x27, 0x2C, 0x27, 0x19, 0x0A, 0x02, 0xFF, 0x07, 0x0F, 0x17, 0x1F, 
-    0x24, 0x24, 0x1F, 0x13, 0x05, 0xFC, 0xF8, 0xFE, 0x0C, 0x1D, 0x29, 0x2D, 
-    0x29, 0x1E, 0x11, 0x07, 0xFE, 0xFF, 0x04, 0x0E, 0x19, 0x1F, 0x24, 0x2A, 
-    0x2D, 0x2E, 0x23, 0x16, 0x0D, 0x08, 0x0C, 0x15, 0x25, 0x2D, 0x37, 0x37, 
-    0x31, 0x28, 0x18, 0x10, 0x0D, 0x13, 0x1E, 0x2D, 0x3B, 0x43, 0x44, 0x3A, 
-    0x2B, 0x17, 0x0F, 0x0D, 0x10, 0x1B, 0x1F, 0x24, 0x29, 0x2D, 0x34, 0x33, 
-    0x2D, 0x20, 0x0F, 0x09, 0x08, 0x10, 0x1E, 0x2A, 0x33, 0x34, 0x35, 0x30, 
-    0x28, 0x1D, 0x1A, 0x1C, 0x25, 0x31, 0x3C, 0x46, 0x45, 0x3D, 0x2C, 0x1D, 
-    0x13, 0x0F, 0x15, 0x1B, 0x22, 0x26, 0x2A, 0x32, 0x39, 0x40, 0x3B, 0x2F, 
-    0x22, 0x1B, 0x1B, 0x1F, 0x27, 0x2C, 0x32, 0x34, 0x30, 0x2A, 0x21, 0x17, 
-    0x12, 0x13, 0x1D, 0x2A, 0x35, 0x3B, 0x3E, 0x37, 0x2B, 0x1E, 0x11, 0x0C, 
-    0x0E, 0x14, 0x1C, 0x25, 0x29, 0x32, 0x37, 0x38, 0x36, 0x2A, 0x1E, 0x12, 
-    0x0E, 0x11, 0x16, 0x1C, 0x21, 0x23, 0x22, 0x1A, 0x0E, 0xFE, 0xF3, 0xEF, 
-    0xF5, 0xF9, 0x00, 0x08, 0x0C, 0x10, 0x07, 0xFD, 0xF1, 0xEA, 0xEB, 0xF3, 
-    0xFB, 0x05, 0x0A, 0x10, 0x13, 0x17, 0x17, 0x11, 0x07, 0xF8, 0xF5, 0xF7, 
-    0xFC, 0x06, 0x0E, 0x12, 0x18, 0x18, 0x14, 0x0B, 0x01, 0xFE, 0x02, 0x0B, 
-    0x15, 0x1E, 0x25, 0x27, 0x21, 0x12, 0x03, 0xF8, 0xF1, 0xF3, 0xF6, 0xFE, 
-    0xFE, 0x01, 0x05, 0x07, 0x0D, 0x0B, 0xFF, 0xF5, 0xEC, 0xEA, 0xEE, 0xEF, 
-    0xF3, 0xF6, 0xF8, 0xF6, 0xF3, 0xE8, 0xDC, 0xD4, 0xD7, 0xDF, 0xEE, 0xFC, 
-    0x03, 0x04, 0xFF, 0xF6, 0xE8, 0xDF, 0xD6, 0xD7, 0xDD, 0xE7, 0xED, 0xF1, 
-    0xF5, 0xFD, 0x04, 0x03, 0xFD, 0xF0, 0xE6, 0xE2, 0xE5, 0xE9, 0xF1, 0xF5, 
-    0xF9, 0xFB, 0xF4, 0xE9, 0xDD, 0xD0, 0xCE, 0xD5, 0xDE, 0xEC, 0xF4, 0xF7, 
-    0xF6, 0xEE, 0xE3, 0xDA, 0xD4, 0xD1, 0xD6, 0xDC, 0xE6, 0xEB, 0xF0, 0xF5, 
-    0xF6, 0xFA, 0xF4, 0xE5, 0xD7, 0xCF, 0xD0, 0xD8, 0xE2, 0xEA, 0xF1, 0xF5, 
-    0xF7, 0xF2, 0xEA, 0xE1, 0xDD, 0xE2, 0xEA, 0xF5, 0x01, 0x06, 0x05, 0xFD, 
-    0xF4, 0xE8, 0xDE, 0xDA, 0xD7, 0xDB, 0xE1, 0xE5, 0xE9, 0xED, 0xF1, 0xF3, 
-    0xF1, 0xE7, 0xDB, 0xD4, 0xD3, 0xD7, 0xDF, 0xE4, 0xE7, 0xEA, 0xE6, 0xE6, 
-    0xDD, 0xD4, 0xD1, 0xD3, 0xDC, 0xE7, 0xF6, 0xFE, 0x01, 0xFC, 0xF1, 0xE2, 
-    0xDA, 0xD3, 0xD5, 0xD8, 0xE1, 0xE9, 0xF0, 0xF9, 0xFC, 0x03, 0x02, 0xFC, 
-    0xF2, 0xEA, 0xE7, 0xE9, 0xF0, 0xF4, 0xFA, 0xFB, 0xFB, 0xF9, 0xEE, 0xE4, 
-    0xD9, 0xD6, 0xD9, 0xE1, 0xEE, 0xF8, 0xFD, 0xFA, 0xF1, 0xE5, 0xDC, 0xD7, 
-    0xD8, 0xDA, 0xE0, 0xE5, 0xE9, 0xED, 0xF1, 0xF4, 0xF4, 0xEF, 0xE3, 0xDA, 
-    0xD4, 0xD5, 0xDA, 0xDF, 0xE6, 0xEB, 0xF0, 0xF1, 0xEC, 0xE2, 0xD9, 0xD8, 
-    0xDE, 0xE7, 0xF2, 0xFA, 0xFF, 0xFD, 0xF6, 0xE9, 0xDF, 0xDA, 0xDA, 0xE2, 
-    0xE6, 0xEC, 0xF1, 0xF8, 0xFF, 0x03, 0x04, 0xFE, 0xF4, 0xE7, 0xE1, 0xDD, 
-    0xE0, 0xE6, 0xED, 0xF4, 0xF6, 0xF7, 0xF1, 0xE6, 0xDB, 0xD5, 0xD8, 0xDF, 
-    0xE9, 0xF3, 0xF6, 0xF8, 0xF1, 0xE7, 0xDF, 0xD7, 0xD2, 0xD4, 0xD6, 0xD9, 
-    0xE1, 0xE3, 0xEA, 0xF0, 0xF8, 0xF9, 0xF2, 0xEB, 0xE6, 0xE8, 0xF1, 0xFA, 
-    0x01, 0x07, 0x0A, 0x0A, 0x06, 0xF8, 0xEA, 0xE2, 0xE4, 0xEB, 0xF2, 0x00, 
-    0x05, 0x0C, 0x0B, 0x05, 0x01, 0xF8, 0xF5, 0xF5, 0xFA, 0xFF, 0x08, 0x0E, 
-    0x16, 0x1E, 0x23, 0x24, 0x20, 0x15, 0x0E, 0x0D, 0x10, 0x18, 0x1E, 0x25, 
-    0x28, 0x28, 0x25, 0x1C, 0x0F, 0x06, 0x03, 0x08, 0x11, 0x1B, 0x23, 0x27, 
-    0x26, 0x20, 0x17, 0x0A, 0x01, 0xFC, 0xFB, 0x01, 0x08, 0x10, 0x17, 0x1F, 
-    0x24, 0x25, 0x23, 0x19, 0x0F, 0x09, 0x05, 0x0B, 0x12, 0x18, 0x1E, 0x1F, 
-    0x22, 0x1D, 0x16, 0x0C, 0x08, 0x0C, 0x14, 0x20, 0x28, 0x2E, 0x30, 0x2C, 
-    0x23, 0x1D, 0x14, 0x11, 0x14, 0x1B, 0x25, 0x2D, 0x35, 0x39, 0x3D, 0x40, 
-    0x3E, 0x38, 0x2C, 0x24, 0x21, 0x23, 0x2A, 0x2F, 0x34, 0x37, 0x36, 0x2E, 
-    0x23, 0x15, 0x0C, 0x0B, 0x0F, 0x18, 0x21, 0x2B, 0x2F, 0x2D, 0x25, 0x1B, 
-    0x16, 0x11, 0x11, 0x15, 0x18, 0x21, 0x26, 0x2A, 0x2E, 0x30, 0x31, 0x2D, 
-    0x25, 0x1B, 0x14, 0x14, 0x1A, 0x21, 0x27, 0x2D, 0x2E, 0x2D, 0x27, 0x1D, 
-    0x17, 0x15, 0x19, 0x22, 0x28, 0x2F, 0x32, 0x2E, 0x29, 0x21, 0x1B, 0x17, 
-    0x19, 0x1C, 0x22, 0x29, 0x2C, 0x31, 0x33, 0x38, 0x38, 0x34, 0x2C, 0x23, 
-    0x1D, 0x1B, 0x1B, 0x1E, 0x24, 0x29, 0x2A, 0x26, 0x1D, 0x13, 0x0D, 0x0B, 
-    0x0E, 0x14, 0x1C, 0x22, 0x26, 0x26, 0x1F, 0x15, 0x0B, 0x02, 0xFC, 0xFC, 
-    0xFD, 0x03, 0x07, 0x0C, 0x11, 0x15, 0x18, 0x18, 0x11, 0x0A, 0x03, 0xFD, 
-    0xFC, 0x02, 0x05, 0x08, 0x0A, 0x05, 0xFF, 0xF7, 0xEF, 0xEB, 0xED, 0xF2, 
-    0xF9, 0xFF, 0x07, 0x0A, 0x0A, 0x07, 0xFF, 0xFE, 0xFE, 0x01, 0x09, 0x0E, 
-    0x14, 0x17, 0x18, 0x18, 0x18, 0x15, 0x10, 0x06, 0xFD, 0xF8, 0xF9, 0xFF, 
-    0x02, 0x05, 0x05, 0x05, 0x04, 0xFF, 0xF7, 0xEF, 0xEB, 0xEC, 0xED, 0xF0, 
-    0xF2, 0xF1, 0xEC, 0xE3, 0xDA, 0xD2, 0xD2, 0xD4, 0xDA, 0xE1, 0xE8, 0xEB, 
-    0xEE, 0xF2, 0xF4, 0xF7, 0xF3, 0xEC, 0xE5, 0xDF, 0xDF, 0xE4, 0xE9, 0xED, 
-    0xF1, 0xF6, 0xF9, 0xF8, 0xF3, 0xEC, 0xE5, 0xE6, 0xEF, 0xF7, 0xFE, 0x01, 
-    0xFE, 0xF7, 0xEF, 0xE6, 0xE2, 0xE0, 0xE5, 0xEA, 0xEF, 0xF4, 0xF5, 0xF8, 
-    0xFD, 0xFF, 0x00, 0xFC, 0xF4, 0xF0, 0xEE, 0xEF, 0xF1, 0xF2, 0xF1, 0xF0, 
-    0xEB, 0xE3, 0xD8, 0xCB, 0xC5, 0xC6, 0xCF, 0xD9, 0xE1, 0xE7, 0xE9, 0xE7, 
-    0xE0, 0xD8, 0xD3, 0xD4, 0xD9, 0xDE, 0xE6, 0xEA, 0xED, 0xEF, 0xF2, 0xF5, 
-    0xF7, 0xF6, 0xEF, 0xE8, 0xE4, 0xE3, 0xE7, 0xEA, 0xED, 0xED, 0xEC, 0xEA, 
-    0xE3, 0xDC, 0xD7, 0xD5, 0xD5, 0xD9, 0xDE, 0xE1, 0xE5, 0xE4, 0xE1, 0xDD, 
-    0xD8, 0xDB, 0xE1, 0xE7, 0xEE, 0xF1, 0xF4, 0xF8, 0xFA, 0xFD, 0xFD, 0xFD, 
-    0xF8, 0xF0, 0xEB, 0xEA, 0xED, 0xF1, 0xF6, 0xF6, 0xF5, 0xF3, 0xF1, 0xEE, 
-    0xE9, 0xE7, 0xE7, 0xEB, 0xF1, 0xF7, 0xF9, 0xF6, 0xEF, 0xE5, 0xDB, 0xD6, 
-    0xD7, 0xDB, 0xE1, 0xE6, 0xED, 0xF2, 0xF7, 0xF8, 0xF8, 0xF7, 0xF0, 0xE9, 
-    0xE0, 0xDE, 0xDF, 0xE2, 0xE8, 0xEA, 0xE8, 0xE6, 0xE2, 0xDE, 0xD8, 0xD6, 
-    0xD6, 0xD9, 0xE0, 0xE6, 0xEC, 0xED, 0xE9, 0xE4, 0xE0, 0xDE, 0xE0, 0xE5, 
-    0xEB, 0xEF, 0xF3, 0xF4, 0xF5, 0xF7, 0xF9, 0xFA, 0xF7, 0xF3, 0xEC, 0xE8, 
-    0xEA, 0xEF, 0xF4, 0xF6, 0xF5, 0xF4, 0xEE, 0xE8, 0xE0, 0xDB, 0xD9, 0xD9, 
-    0xDD, 0xE1, 0xE4, 0xE5, 0xE3, 0xDD, 0xD8, 0xD5, 0xD5, 0xD9, 0xDD, 0xE3, 
-    0xE6, 0xEB, 0xEF, 0xF6, 0xFC, 0xFF, 0xFF, 0xF9, 0xF1, 0xEA, 0xE7, 0xE7, 
-    0xEA, 0xED, 0xEF, 0xF2, 0xF2, 0xEF, 0xEC, 0xE8, 0xE9, 0xED, 0xF4, 0xFC, 
-    0x01, 0x00, 0xFD, 0xF6, 0xEE, 0xE8, 0xE5, 0xE7, 0xEB, 0xF1, 0xF6, 0xFC, 
-    0x03, 0x08, 0x0E, 0x12, 0x13, 0x13, 0x0F, 0x0B, 0x08, 0x08, 0x0A, 0x0C, 
-    0x0F, 0x12, 0x13, 0x0E, 0x08, 0x03, 0x03, 0x08, 0x10, 0x17, 0x1D, 0x1F, 
-    0x1C, 0x16, 0x10, 0x0A, 0x07, 0x07, 0x0A, 0x0F, 0x13, 0x15, 0x16, 0x15, 
-    0x15, 0x15, 0x15, 0x14, 0x0F, 0x06, 0x02, 0xFE, 0xFF, 0x04, 0x08, 0x0E, 
-    0x11, 0x0F, 0x09, 0x04, 0x01, 0x03, 0x05, 0x0A, 0x0E, 0x11, 0x13, 0x13, 
-    0x13, 0x12, 0x12, 0x14, 0x17, 0x1C, 0x23, 0x26, 0x2A, 0x2E, 0x31, 0x34, 
-    0x37, 0x38, 0x34, 0x2D, 0x28, 0x26, 0x28, 0x2C, 0x2E, 0x2F, 0x30, 0x2F, 
-    0x2A, 0x26, 0x22, 0x20, 0x21, 0x23, 0x25, 0x24, 0x24, 0x1F, 0x1A, 0x13, 
-    0x0F, 0x0C, 0x0E, 0x14, 0x17, 0x1A, 0x1D, 0x21, 0x28, 0x30, 0x36, 0x39, 
-    0x37, 0x32, 0x2B, 0x27, 0x27, 0x29, 0x2C, 0x2F, 0x31, 0x30, 0x2A, 0x23, 
-    0x1D, 0x1C, 0x1E, 0x23, 0x2A, 0x2F, 0x2F, 0x2D, 0x29, 0x23, 0x21, 0x20, 
-    0x22, 0x25, 0x26, 0x25, 0x24, 0x23, 0x24, 0x27, 0x2A, 0x2B, 0x2A, 0x26, 
-    0x1E, 0x19, 0x16, 0x17, 0x18, 0x1B, 0x1C, 0x1C, 0x1A, 0x16, 0x12, 0x11, 
-    0x13, 0x16, 0x1A, 0x1D, 0x1E, 0x1D, 0x1C, 0x19, 0x1A, 0x19, 0x1B, 0x1D, 
-    0x1E, 0x1F, 0x1F, 0x21, 0x22, 0x26, 0x28, 0x29, 0x27, 0x20, 0x17, 0x0F, 
-    0x0D, 0x0D, 0x0E, 0x10, 0x12, 0x12, 0x0F, 0x08, 0x01, 0xFE, 0xFE, 0x00, 
-    0x02, 0x01, 0x00, 0xFF, 0xFF, 0xFC, 0xF8, 0xF3, 0xF2, 0xF4, 0xF9, 0xFD, 
-    0x00, 0x02, 0x03, 0x09, 0x0E, 0x13, 0x16, 0x13, 0x0E, 0x0A, 0x07, 0x05, 
-    0x06, 0x07, 0x09, 0x0B, 0x0A, 0x05, 0xFF, 0xFA, 0xFA, 0xFB, 0xFE, 0x00, 
-    0x01, 0x02, 0x01, 0xFE, 0xFA, 0xF5, 0xF2, 0xF1, 0xF0, 0xEF, 0xEC, 0xEA, 
-    0xE8, 0xEA, 0xEE, 0xF4, 0xFA, 0xFD, 0xFC, 0xF6, 0xF0, 0xEC, 0xEC, 0xEF, 
-    0xF3, 0xF4, 0xF2, 0xEC, 0xE3, 0xDF, 0xDD, 0xE0, 0xE3, 0xE5, 0xE7, 0xEA, 
-    0xEC, 0xEB, 0xEB, 0xEA, 0xEA, 0xEC, 0xEE, 0xF0, 0xF0, 0xEF, 0xEE, 0xEE, 
-    0xF0, 0xF2, 0xF4, 0xF5, 0xF2, 0xEE, 0xE9, 0xE7, 0xE9, 0xEB, 0xF0, 0xF3, 
-    0xF2, 0xED, 0xE5, 0xE2, 0xE2, 0xE5, 0xE8, 0xEB, 0xEC, 0xED, 0xEE, 0xEC, 
-    0xE9, 0xE5, 0xE4, 0xE5, 0xE8, 0xEA, 0xEC, 0xED, 0xEE, 0xEE, 0xF1, 0xF5, 
-    0xFA, 0xFD, 0xFD, 0xF8, 0xF3, 0xEE, 0xEC, 0xED, 0xEF, 0xF0, 0xF1, 0xED, 
-    0xE6, 0xDF, 0xDB, 0xDD, 0xDF, 0xE1, 0xE1, 0xE0, 0xDF, 0xDE, 0xDD, 0xDC, 
-    0xDA, 0xDA, 0xDA, 0xDB, 0xDD, 0xDD, 0xDF, 0xDF, 0xE1, 0xE6, 0xEA, 0xED, 
-    0xF0, 0xEE, 0xEB, 0xE9, 0xE7, 0xE6, 0xEB, 0xEE, 0xF0, 0xEF, 0xE9, 0xE4, 
-    0xE1, 0xE2, 0xE3, 0xE4, 0xE6, 0xE6, 0xE8, 0xEA, 0xE9, 0xE9, 0xE8, 0xE8, 
-    0xE7, 0xEB, 0xEE, 0xEF, 0xEE, 0xEB, 0xE8, 0xEC, 0xEF, 0xF1, 0xF6, 0xF2, 
-    0xF0, 0xED, 0xEC, 0xEC, 0xEF, 0xF0, 0xF2, 0xF2, 0xEE, 0xE6, 0xE4, 0xE1, 
-    0xE7, 0xEA, 0xE8, 0xEA, 0xEC, 0xF2, 0xF5, 0xFA, 0xF8, 0xF6, 0xF5, 0xF6, 
-    0xF6, 0xFB, 0xFA, 0xFB, 0xF9, 0xFB, 0x00, 0xFD, 0x08, 0x04, 0x00, 0xFC, 
-    0xF5, 0xF2, 0xF2, 0xF1, 0xF7, 0xFA, 0xFC, 0xFB, 0xF6, 0xF6, 0xF6, 0xF6, 
-    0xF7, 0xF2, 0xF1, 0xF0, 0xEC, 0xEA, 0xE2, 0xE2, 0xDF, 0xDD, 0xDD, 0xE1, 
-    0xE0, 0xDD, 0xDB, 0xDA, 0xE1, 0xE9, 0xF4, 0xF6, 0xFA, 0xF8, 0xF5, 0xF8, 
-    0xF9, 0xF9, 0xFC, 0xF9, 0xF6, 0xF4, 0xEE, 0xED, 0xEA, 0xEE, 0xED, 0xF2, 
-    0xF3, 0xEF, 0xF1, 0xF1, 0xF0, 0xF1, 0xF3, 0xF3, 0xF8, 0xFC, 0x00, 0xFF, 
-    0xFD, 0x02, 0x07, 0x14, 0x22, 0x2A, 0x32, 0x33, 0x31, 0x2E, 0x2C, 0x2A, 
-    0x27, 0x24, 0x20, 0x1D, 0x1B, 0x14, 0x13, 0x11, 0x0D, 0x0E, 0x09, 0x08, 
-    0x03, 0x03, 0x01, 0x04, 0x05, 0x09, 0x0E, 0x10, 0x15, 0x18, 0x1D, 0x1D, 
-    0x22, 0x22, 0x2A, 0x2B, 0x2C, 0x29, 0x24, 0x26, 0x27, 0x2E, 0x31, 0x30, 
-    0x2A, 0x21, 0x1B, 0x18, 0x16, 0x1B, 0x1E, 0x1E, 0x1F, 0x1C, 0x1A, 0x18, 
-    0x15, 0x17, 0x14, 0x14, 0x15, 0x13, 0x15, 0x15, 0x14, 0x14, 0x13, 0x16, 
-    0x19, 0x1C, 0x1E, 0x18, 0x16, 0x12, 0x11, 0x0F, 0x0F, 0x11, 0x0D, 0x0E, 
-    0x09, 0x0B, 0x09, 0x0B, 0x14, 0x13, 0x18, 0x17, 0x18, 0x1E, 0x1C, 0x1B, 
-    0x1A, 0x19, 0x16, 0x12, 0x10, 0x05, 0x00, 0xFD, 0xF6, 0xF8, 0xFD, 0x07, 
-    0x0C, 0x0F, 0x0E, 0x08, 0x04, 0xFE, 0xFC, 0xFA, 0xFD, 0xFD, 0xFA, 0xF7, 
-    0xF5, 0xF7, 0xFA, 0xF7, 0xF8, 0xF6, 0xF4, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 
-    0xFB, 0x02, 0x02, 0x09, 0x08, 0x08, 0x05, 0x08, 0x09, 0x0A, 0x0E, 0x0A, 
-    0x0B, 0x01, 0xFF, 0xFA, 0xF8, 0xFB, 0xFC, 0x02, 0xFD, 0xFA, 0xF9, 0xF5, 
-    0xF9, 0xF7, 0xF6, 0xF1, 0xEC, 0xE8, 0xE0, 0xDE, 0xD9, 0xDA, 0xDA, 0xE2, 
-    0xE8, 0xE6, 0xE4, 0xDC, 0xD4, 0xD2, 0xD5, 0xD6, 0xDD, 0xE2, 0xE4, 0xE8, 
-    0xE4, 0xE0, 0xDF, 0xDE, 0xE5, 0xE5, 0xE8, 0xEA, 0xEA, 0xEF, 0xF1, 0xF7, 
-    0xF8, 0xF5, 0xF1, 0xEF, 0xED, 0xEE, 0xEF, 0xF0, 0xF0, 0xF1, 0xF2, 0xF4, 
-    0xF4, 0xF1, 0xF4, 0xEE, 0xEE, 0xF4, 0xF8, 0xFA, 0xFD, 0xF8, 0xF6, 0xF4, 
-    0xF5, 0xF2, 0xF6, 0xF7, 0xF9, 0xFA, 0xF9, 0xF8, 0xF4, 0xF7, 0xF2, 0xF3, 
-    0xE9, 0xEB, 0xE5, 0xE9, 0xEA, 0xE9, 0xED, 0xEB, 0xF0, 0xF0, 0xF0, 0xEC, 
-    0xEB, 0xE9, 0xF0, 0xF1, 0xFC, 0x00, 0x02, 0x01, 0xFE, 0xFF, 0xFD, 0xFD, 
-    0xFB, 0xFC, 0xF9, 0xF7, 0xF0, 0xEE, 0xEB, 0xF0, 0xF0, 0xF2, 0xF2, 0xEB, 
-    0xE7, 0xE6, 0xE4, 0xE4, 0xE5, 0xE9, 0xEF, 0xF2, 0xF6, 0xF7, 0xF7, 0xF6, 
-    0xFD, 0x00, 0x09, 0x0E, 0x19, 0x1D, 0x1E, 0x1A, 0x16, 0x1A, 0x16, 0x1C, 
-    0x1C, 0x1F, 0x1E, 0x1D, 0x17, 0x12, 0x0E, 0x07, 0x02, 0xFE, 0xFE, 0x03, 
-    0x0C, 0x12, 0x14, 0x1B, 0x1B, 0x1C, 0x1C, 0x18, 0x17, 0x17, 0x1D, 0x22, 
-    0x2D, 0x2D, 0x33, 0x32, 0x2E, 0x2B, 0x22, 0x25, 0x1F, 0x21, 0x20, 0x1C, 
-    0x1D, 0x19, 0x1A, 0x1A, 0x1C, 0x1F, 0x20, 0x1E, 0x1D, 0x1D, 0x1D, 0x1E, 
-    0x1F, 0x20, 0x23, 0x24, 0x22, 0x24, 0x23, 0x22, 0x23, 0x1E, 0x1C, 0x20, 
-    0x1D, 0x1C, 0x18, 0x15, 0x13, 0x15, 0x14, 0x15, 0x17, 0x17, 0x17, 0x17, 
-    0x17, 0x13, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x0D, 0x0C, 0x0B, 0x0E, 0x0C, 
-    0x0F, 0x0C, 0x08, 0x04, 0xFC, 0xFB, 0xF2, 0xED, 0xEB, 0xED, 0xF5, 0xFC, 
-    0xFF, 0xFF, 0xFA, 0xF6, 0xEF, 0xEE, 0xEB, 0xEA, 0xEC, 0xED, 0xF1, 0xF2, 
-    0xF7, 0xFD, 0xFB, 0xFC, 0xFB, 0xFB, 0xFE, 0xFE, 0xFE, 0xFA, 0xFC, 0xFD, 
-    0x04, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x0E, 0x0E, 0x0A, 0x06, 0x01, 0xF7, 
-    0xF2, 0xED, 0xEB, 0xF0, 0xF4, 0xF9, 0xF8, 0xF5, 0xEF, 0xEF, 0xF0, 0xF3, 
-    0xF7, 0xF6, 0xF9, 0xF7, 0xF6, 0xF4, 0xEF, 0xED, 0xE9, 0xE9, 0xEC, 0xEB, 
-    0xEA, 0xE5, 0xDF, 0xDE, 0xDF, 0xE3, 0xE6, 0xEC, 0xEA, 0xEC, 0xEC, 0xEE, 
-    0xF1, 0xEF, 0xED, 0xEC, 0xEA, 0xEC, 0xEF, 0xEF, 0xF7, 0xF6, 0xF8, 0xF7, 
-    0xF4, 0xEE, 0xE3, 0xE1, 0xDB, 0xDC, 0xDE, 0xDD, 0xE0, 0xE1, 0xE5, 0xE5, 
-    0xE5, 0xE3, 0xE6, 0xE7, 0xE9, 0xE9, 0xE9, 0xEC, 0xEA, 0xEA, 0xE7, 0xE4, 
-    0xE3, 0xE5, 0xE7, 0xEC, 0xEB, 0xED, 0xED, 0xEE, 0xED, 0xEB, 0xE8, 0xE5, 
-    0xE6, 0xE5, 0xEF, 0xF0, 0xF6, 0xFA, 0xF7, 0xF9, 0xF4, 0xF4, 0xF3, 0xF0, 
-    0xF2, 0xF4, 0xF7, 0xFE, 0x01, 0x03, 0xFF, 0xF6, 0xF3, 0xEE, 0xEE, 0xED, 
-    0xF1, 0xEF, 0xF2, 0xF7, 0xF9, 0xFD, 0xFD, 0xFF, 0xFB, 0xF6, 0xEC, 0xE7, 
-    0xE3, 0xE1, 0xE3, 0xE4, 0xE7, 0xEF, 0xF4, 0xFC, 0xFE, 0xFD, 0xFB, 0xFC, 
-    0x05, 0x0A, 0x17, 0x1E, 0x25, 0x2E, 0x2D, 0x30, 0x32, 0x32, 0x2E, 0x29, 
-    0x25, 0x20, 0x1C, 0x18, 0x11, 0x0A, 0x02, 0xFE, 0xF7, 0xF3, 0xF5, 0xF5, 
-    0xFC, 0xFE, 0x03, 0x06, 0x09, 0x0E, 0x0B, 0x09, 0x09, 0x0B, 0x15, 0x1E, 
-    0x26, 0x2D, 0x2D, 0x29, 0x25, 0x21, 0x1B, 0x16, 0x13, 0x13, 0x14, 0x16, 
-    0x1B, 0x1F, 0x23, 0x23, 0x23, 0x21, 0x1B, 0x19, 0x13, 0x17, 0x19, 0x20, 
-    0x21, 0x24, 0x27, 0x27, 0x26, 0x1E, 0x1B, 0x18, 0x1A, 0x17, 0x18, 0x19, 
-    0x15, 0x11, 0x0C, 0x07, 0x09, 0x0A, 0x0B, 0x0B, 0x07, 0x09, 0x0B, 0x0F, 
-    0x14, 0x15, 0x17, 0x17, 0x15, 0x15, 0x19, 0x1A, 0x1C, 0x1D, 0x1D, 0x19, 
-    0x15, 0x11, 0x07, 0x03, 0xFC, 0xFB, 0xFB, 0xFE, 0x02, 0x08, 0x07, 0x08, 
-    0x02, 0xF8, 0xF7, 0xED, 0xEB, 0xE8, 0xE8, 0xED, 0xF7, 0x01, 0x07, 0x08, 
-    0x04, 0xFE, 0xF6, 0xF3, 0xEE, 0xED, 0xF2, 0xF3, 0xF8, 0xFC, 0x02, 0xFF, 
-    0x01, 0xFC, 0xF5, 0xED, 0xE8, 0xE9, 0xE5, 0xED, 0xEC, 0xED, 0xF0, 0xEF, 
-    0xEF, 0xF0, 0xEF, 0xF0, 0xEC, 0xF1, 0xF2, 0xF8, 0xFD, 0xFD, 0xFF, 0xFE, 
-    0xFC, 0xFE, 0xFF, 0xFF, 0x00, 0xFB, 0xFF, 0xF9, 0xFB, 0xF3, 0xF1, 0xE9, 
-    0xE5, 0xE1, 0xDD, 0xE2, 0xE5, 0xEB, 0xEC, 0xF3, 0xEE, 0xEC, 0xE7, 0xE3, 
-    0xE4, 0xE4, 0xE7, 0xEA, 0xED, 0xF4, 0xFA, 0xFD, 0xFD, 0xFA, 0xF6, 0xEE, 
-    0xEC, 0xE6, 0xE6, 0xE5, 0xE7, 0xEA, 0xED, 0xF1, 0xF1, 0xEF, 0xEB, 0xE3, 
-    0xE2, 0xE3, 0xE9, 0xED, 0xF0, 0xF7, 0xF6, 0xF8, 0xF5, 0xF5, 0xF3, 0xF0, 
-    0xED, 0xEB, 0xEA, 0xED, 0xF0, 0xEF, 0xF1, 0xEE, 0xEF, 0xF1, 0xF0, 0xF4, 
-    0xF5, 0xF1, 0xF2, 0xEE, 0xED, 0xE4, 0xE0, 0xD8, 0xD4, 0xD4, 0xD3, 0xDA, 
-    0xE3, 0xEC, 0xEE, 0xF5, 0xF2, 0xF0, 0xED, 0xEF, 0xF0, 0xF0, 0xF1, 0xF5, 
-    0xF7, 0xFE, 0x01, 0x00, 0x01, 0xF8, 0xF1, 0xE6, 0xE1, 0xDD, 0xDD, 0xE1, 
-    0xE6, 0xEC, 0xF1, 0xF7, 0xFB, 0xFC, 0xFC, 0xFA, 0xF8, 0xF9, 0xFD, 0x02, 
-    0x08, 0x0F, 0x13, 0x1B, 0x20, 0x23, 0x21, 0x1F, 0x1D, 0x1A, 0x1A, 0x1C, 
-    0x1A, 0x1C, 0x1C, 0x1E, 0x1A, 0x16, 0x11, 0x0F, 0x0C, 0x0A, 0x0C, 0x05, 
-    0x08, 0x06, 0x0B, 0x0A, 0x0E, 0x10, 0x0E, 0x14, 0x19, 0x22, 0x24, 0x2A, 
-    0x29, 0x26, 0x26, 0x24, 0x22, 0x1F, 0x1D, 0x1D, 0x1D, 0x23, 0x24, 0x26, 
-    0x26, 0x1D, 0x1B, 0x12, 0x12, 0x0F, 0x11, 0x11, 0x15, 0x15, 0x16, 0x1B, 
-    0x19, 0x18, 0x10, 0x0C, 0x01, 0x00, 0xFD, 0xFF, 0x03, 0x08, 0x0A, 0x0E, 
-    0x12, 0x12, 0x15, 0x11, 0x0E, 0x0C, 0x08, 0x06, 0x04, 0x07, 0x0C, 0x0E, 
-    0x16, 0x15, 0x1B, 0x21, 0x23, 0x28, 0x28, 0x29, 0x27, 0x29, 0x2A, 0x28, 
-    0x25, 0x21, 0x1B, 0x15, 0x11, 0x0C, 0x08, 0xFF, 0xF9, 0xF1, 0xED, 0xE8, 
-    0xE1, 0xE0, 0xDD, 0xDF, 0xE3, 0xEB, 0xF3, 0xFA, 0xFE, 0x00, 0x01, 0xFD, 
-    0xF8, 0xF6, 0xF5, 0xF8, 0xFF, 0x03, 0x0A, 0x0D, 0x11, 0x0F, 0x0A, 0x01, 
-    0xF6, 0xEF, 0xEA, 0xEC, 0xF0, 0xF4, 0xF5, 0xF9, 0xFD, 0xF9, 0xFB, 0xF5, 
-    0xF1, 0xEF, 0xE7, 0xE9, 0xEF, 0xF6, 0xFF, 0xFF, 0x03, 0x03, 0xFC, 0xFD, 
-    0xF5, 0xF2, 0xEE, 0xEA, 0xE7, 0xE6, 0xE8, 0xE5, 0xE3, 0xE0, 0xDC, 0xD9, 
-    0xD8, 0xD8, 0xDC, 0xDE, 0xE1, 0xE0, 0xE1, 0xE3, 0xE6, 0xE5, 0xE8, 0xEA, 
-    0xEA, 0xEE, 0xF4, 0xF9, 0xFC, 0xFC, 0xF6, 0xF2, 0xEC, 0xE4, 0xDE, 0xE0, 
-    0xDF, 0xE4, 0xEA, 0xF2, 0xF5, 0xFC, 0xFA, 0xF3, 0xEB, 0xE2, 0xDC, 0xD5, 
-    0xD6, 0xD8, 0xD9, 0xE1, 0xE9, 0xF0, 0xF6, 0xF7, 0xF3, 0xED, 0xED, 0xEB, 
-    0xF3, 0xF5, 0xFE, 0x00, 0x03, 0x03, 0xFE, 0xFD, 0xF2, 0xF2, 0xEC, 0xED, 
-    0xEB, 0xEB, 0xEB, 0xEA, 0xEB, 0xEC, 0xE9, 0xE9, 0xE9, 0xEC, 0xF3, 0xF2, 
-    0xFB, 0xFB, 0xFF, 0xFF, 0x00, 0xFC, 0xFA, 0xFA, 0xF8, 0xFA, 0xF8, 0xFC, 
-    0xFE, 0xFB, 0xF9, 0xF5, 0xE8, 0xE6, 0xDC, 0xDC, 0xDB, 0xDC, 0xE1, 0xE3, 
-    0xE7, 0xEC, 0xEF, 0xEF, 0xEF, 0xED, 0xED, 0xEF, 0xF5, 0xFD, 0x08, 0x0F, 
-    0x18, 0x1B, 0x1C, 0x1E, 0x1D, 0x1D, 0x1A, 0x19, 0x17, 0x1B, 0x22, 0x27, 
-    0x2A, 0x28, 0x27, 0x24, 0x20, 0x19, 0x10, 0x0D, 0x0C, 0x0F, 0x13, 0x17, 
-    0x1B, 0x1D, 0x20, 0x1D, 0x1B, 0x1A, 0x14, 0x16, 0x15, 0x16, 0x17, 0x18, 
-    0x17, 0x16, 0x19, 0x19, 0x1D, 0x1B, 0x1E, 0x23, 0x2A, 0x2E, 0x2B, 0x29, 
-    0x23, 0x19, 0x11, 0x09, 0x06, 0x0A, 0x0E, 0x19, 0x1D, 0x23, 0x28, 0x27, 
-    0x23, 0x1F, 0x19, 0x14, 0x15, 0x15, 0x18, 0x19, 0x17, 0x16, 0x16, 0x10, 
-    0x0E, 0x04, 0xFD, 0xF8, 0xF6, 0xF9, 0xFF, 0x07, 0x08, 0x10, 0x10, 0x13, 
-    0x13, 0x10, 0x12, 0x13, 0x19, 0x1C, 0x20, 0x24, 0x22, 0x23, 0x1F, 0x1C, 
-    0x17, 0x13, 0x0D, 0x05, 0x02, 0xFD, 0xF8, 0xF6, 0xF5, 0xF1, 0xEF, 0xEC, 
-    0xE7, 0xE4, 0xE4, 0xE5, 0xEB, 0xEE, 0xF1, 0xF3, 0xF3, 0xF9, 0xFA, 0xF9, 
-    0xFC, 0xFE, 0x07, 0x10, 0x16, 0x1B, 0x1A, 0x1A, 0x17, 0x15, 0x0E, 0x08, 
-    0x04, 0xFE, 0x00, 0x01, 0x03, 0x03, 0xFE, 0xFB, 0xF1, 0xEC, 0xE5, 0xE5, 
-    0xE5, 0xE8, 0xF2, 0xFD, 0x08, 0x0C, 0x10, 0x0D, 0x09, 0x00, 0xFB, 0xF5, 
-    0xF5, 0xF4, 0xF8, 0xFD, 0xFE, 0x03, 0x00, 0x01, 0xF9, 0xF7, 0xF2, 0xF0, 
-    0xED, 0xEA, 0xE7, 0xE4, 0xE1, 0xDA, 0xD8, 0xD6, 0xD9, 0xDD, 0xE3, 0xE8, 
-    0xF2, 0xF6, 0xFB, 0xFD, 0xFA, 0xFA, 0xF5, 0xF1, 0xED, 0xEA, 0xE8, 0xEA, 
-    0xE9, 0xE4, 0xDF, 0xD9, 0xD3, 0xCD, 0xC8, 0xC2, 0xC3, 0xC6, 0xCA, 0xD3, 
-    0xD9, 0xE2, 0xE6, 0xEB, 0xEF, 0xEF, 0xF4, 0xF4, 0xF5, 0xF7, 0xF9, 0x00, 
-    0x06, 0x0A, 0x0C, 0x09, 0x04, 0xFE, 0xF6, 0xF4, 0xEF, 0xED, 0xEF, 0xF2, 
-    0xF8, 0xFA, 0xFB, 0xFA, 0xF6, 0xF7, 0xF4, 0xF1, 0xF2, 0xF2, 0xF4, 0xF6, 
-    0xFA, 0xF9, 0xFF, 0xFC, 0xFF, 0x02, 0xFD, 0xFE, 0xFA, 0xFE, 0xFE, 0x00, 
-    0xFF, 0xFA, 0xF6, 0xEF, 0xE9, 0xE7, 0xE6, 0xE7, 0xEE, 0xED, 0xEE, 0xF1, 
-    0xEF, 0xF0, 0xEF, 0xED, 0xEE, 0xF2, 0xF8, 0x00, 0x06, 0x0C, 0x0D, 0x0F, 
-    0x10, 0x0A, 0x08, 0x06, 0x07, 0x08, 0x0A, 0x10, 0x16, 0x1E, 0x21, 0x24, 
-    0x21, 0x1D, 0x17, 0x11, 0x0D, 0x09, 0x06, 0x02, 0x00, 0x00, 0x02, 0x04, 
-    0x08, 0x09, 0x0B, 0x0B, 0x0B, 0x0D, 0x14, 0x1B, 0x1F, 0x23, 0x26, 0x25, 
-    0x27, 0x23, 0x1F, 0x1A, 0x11, 0x11, 0x13, 0x16, 0x17, 0x18, 0x17, 0x1A, 
-    0x16, 0x16, 0x16, 0x13, 0x18, 0x1A, 0x1E, 0x21, 0x23, 0x25, 0x26, 0x27, 
-    0x24, 0x1E, 0x1C, 0x1C, 0x1E, 0x20, 0x1E, 0x1B, 0x16, 0x0E, 0x07, 0x02, 
-    0x00, 0xF8, 0xF8, 0xFD, 0x01, 0x0B, 0x11, 0x16, 0x18, 0x19, 0x14, 0x0F, 
-    0x0B, 0x09, 0x12, 0x17, 0x1E, 0x26, 0x2C, 0x30, 0x32, 0x30, 0x2B, 0x22, 
-    0x1A, 0x14, 0x13, 0x11, 0x0E, 0x0B, 0x08, 0x01, 0x01, 0xFC, 0xF5, 0xF3, 
-    0xE7, 0xE6, 0xE3, 0xE5, 0xE4, 0xE5, 0xEA, 0xEA, 0xEA, 0xE9, 0xEC, 0xEA, 
-    0xF0, 0xF5, 0xF9, 0xFA, 0xFC, 0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFD, 0xFE, 
-    0x00, 0x09, 0x0A, 0x0C, 0x0A, 0x06, 0x02, 0xFB, 0xF4, 0xEB, 0xE5, 0xDF, 
-    0xE4, 0xED, 0xF6, 0xFF, 0x01, 0x02, 0xFE, 0xFF, 0xFD, 0xFA, 0xFC, 0xFB, 
-    0xFF, 0x04, 0x03, 0x06, 0x02, 0xFB, 0xF5, 0xEC, 0xE9, 0xE1, 0xDF, 0xE0, 
-    0xE2, 0xE4, 0xE8, 0xE9, 0xEA, 0xE8, 0xE5, 0xE5, 0xE4, 0xE3, 0xE6, 0xEC, 
-    0xF4, 0xFB, 0xFE, 0xFC, 0xFB, 0xF9, 0xF7, 0xF5, 0xF4, 0xF2, 0xED, 0xEC, 
-    0xE7, 0xE5, 0xDE, 0xDB, 0xD8, 0xD8, 0xD8, 0xD9, 0xDD, 0xE2, 0xE6, 0xE7, 
-    0xE8, 0xE6, 0xE8, 0xE8, 0xE7, 0xE8, 0xE9, 0xEB, 0xF2, 0xF9, 0x02, 0x07, 
-    0x07, 0x05, 0x00, 0x00, 0xF5, 0xF0, 0xEE, 0xEB, 0xEC, 0xEF, 0xED, 0xEF, 
-    0xF2, 0xED, 0xEB, 0xE4, 0xDE, 0xD8, 0xD6, 0xDB, 0xDD, 0xE2, 0xEB, 0xF1, 
-    0xF6, 0xFB, 0xFD, 0xFD, 0xFC, 0xF4, 0xF2, 0xF4, 0xF7, 0xFD, 0x01, 0x02, 
-    0xFF, 0xFD, 0xFC, 0xFE, 0xFB, 0xFA, 0xFA, 0xF9, 0xF7, 0xF7, 0xF8, 0xF2, 
-    0xEE, 0xEB, 0xE8, 0xEA, 0xEC, 0xF5, 0xFE, 0x05, 0x0C, 0x0D, 0x14, 0x11, 
-    0x11, 0x14, 0x12, 0x13, 0x13, 0x13, 0x1B, 0x1D, 0x1E, 0x1B, 0x16, 0x0E, 
-    0x08, 0x06, 0x01, 0x05, 0x08, 0x11, 0x16, 0x1A, 0x1E, 0x1D, 0x1A, 0x1B, 
-    0x15, 0x14, 0x12, 0x12, 0x19, 0x1D, 0x23, 0x24, 0x29, 0x2A, 0x2A, 0x24, 
-    0x1E, 0x16, 0x0F, 0x0B, 0x09, 0x0A, 0x0C, 0x10, 0x11, 0x10, 0x0F, 0x0D, 
-    0x0B, 0x0D, 0x0B, 0x10, 0x10, 0x10, 0x11, 0x10, 0x14, 0x12, 0x11, 0x13, 
-    0x11, 0x13, 0x14, 0x18, 0x1B, 0x1C, 0x1E, 0x18, 0x17, 0x13, 0x11, 0x0E, 
-    0x0C, 0x0D, 0x10, 0x19, 0x1F, 0x1E, 0x1B, 0x15, 0x0F, 0x0A, 0x04, 0x06, 
-    0x09, 0x13, 0x19, 0x22, 0x26, 0x27, 0x26, 0x20, 0x1F, 0x17, 0x10, 0x0B, 
-    0x0A, 0x11, 0x16, 0x1A, 0x1C, 0x18, 0x17, 0x11, 0x0C, 0x03, 0xF8, 0xF3, 
-    0xED, 0xF1, 0xF3, 0xF1, 0xF0, 0xEA, 0xEA, 0xEA, 0xEA, 0xEC, 0xED, 0xF3, 
-    0xF7, 0xFE, 0x03, 0x05, 0x06, 0x09, 0x09, 0x07, 0x05, 0xFF, 0xFF, 0xFD, 
-    0xFE, 0xFC, 0xF8, 0xF7, 0xF1, 0xF2, 0xF1, 0xF0, 0xF3, 0xF6, 0xFA, 0xFD, 
-    0xFF, 0x01, 0x01, 0xFF, 0xF9, 0xF3, 0xF0, 0xED, 0xF0, 0xF3, 0xF8, 0xFD, 
-    0xFF, 0x00, 0xFC, 0xF0, 0xE5, 0xDA, 0xCF, 0xCB, 0xC8, 0xCD, 0xD3, 0xDA, 
-    0xE0, 0xE6, 0xED, 0xED, 0xEE, 0xEB, 0xE7, 0xE5, 0xE6, 0xE9, 0xF1, 0xFA, 
-    0x00, 0x03, 0xFF, 0xFD, 0xF6, 0xF2, 0xEF, 0xED, 0xED, 0xEC, 0xE9, 0xE6, 
-    0xE2, 0xE2, 0xE0, 0xDC, 0xDD, 0xD8, 0xDA, 0xDB, 0xDF, 0xE1, 0xE3, 0xE3, 
-    0xE0, 0xE1, 0xE2, 0xE9, 0xEF, 0xF3, 0xF9, 0xFF, 0x06, 0x0B, 0x0B, 0x08, 
-    0x01, 0xFA, 0xF3, 0xF1, 0xF2, 0xF4, 0xFB, 0x01, 0x02, 0x02, 0x01, 0xFC, 
-    0xF4, 0xEC, 0xE4, 0xDF, 0xDD, 0xDE, 0xDF, 0xE2, 0xE7, 0xE9, 0xEE, 0xEF, 
-    0xF0, 0xED, 0xEC, 0xEC, 0xED, 0xF2, 0xF6, 0xFC, 0x01, 0x03, 0x01, 0xFB, 
-    0xF1, 0xE5, 0xDF, 0xDD, 0xDA, 0xDA, 0xD9, 0xDB, 0xDF, 0xE2, 0xE8, 0xEC, 
-    0xF0, 0xF1, 0xF2, 0xF3, 0xF8, 0xFE, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0E, 
-    0x0F, 0x13, 0x17, 0x1C, 0x1F, 0x21, 0x1E, 0x1A, 0x11, 0x0A, 0x02, 0xFC, 
-    0xFB, 0xFD, 0x05, 0x0B, 0x11, 0x14, 0x17, 0x15, 0x14, 0x10, 0x0F, 0x0D, 
-    0x10, 0x15, 0x19, 0x24, 0x2A, 0x2E, 0x2E, 0x2C, 0x27, 0x23, 0x1E, 0x1C, 
-    0x18, 0x18, 0x19, 0x1A, 0x21, 0x1F, 0x1F, 0x1E, 0x19, 0x14, 0x0F, 0x09, 
-    0x06, 0x09, 0x09, 0x0E, 0x12, 0x15, 0x19, 0x1A, 0x1A, 0x1B, 0x1A, 0x19, 
-    0x19, 0x19, 0x16, 0x16, 0x16, 0x0F, 0x11, 0x0F, 0x0D, 0x0E, 0x0D, 0x0D, 
-    0x0E, 0x0E, 0x0B, 0x0E, 0x0D, 0x0C, 0x05, 0xFE, 0xF9, 0xF6, 0xF9, 0x02, 
-    0x09, 0x11, 0x15, 0x13, 0x15, 0x14, 0x13, 0x11, 0x10, 0x13, 0x12, 0x18, 
-    0x1E, 0x1E, 0x1C, 0x15, 0x0D, 0x03, 0xFD, 0xF9, 0xF3, 0xF3, 0xF2, 0xFC, 
-    0x04, 0x0B, 0x10, 0x0C, 0x0B, 0x02, 0xFB, 0xF6, 0xF2, 0xF3, 0xF6, 0xFC, 
-    0xFE, 0x03, 0x05, 0x04, 0x06, 0x01, 0xFF, 0xF9, 0xF4, 0xF5, 0xF7, 0xF9, 
-    0xF7, 0xF4, 0xF4, 0xF8, 0xFC, 0xFE, 0xFC, 0xFB, 0xF9, 0xFB, 0xFD, 0x01, 
-    0x05, 0x06, 0x05, 0x01, 0xFA, 0xF6, 0xF8, 0xFB, 0xFF, 0xFE, 0xFE, 0xFE, 
-    0xFD, 0xF7, 0xF2, 0xEA, 0xE4, 0xE0, 0xDF, 0xE1, 0xE6, 0xEE, 0xEF, 0xF0, 
-    0xED, 0xEA, 0xE9, 0xE3, 0xDD, 0xD9, 0xD7, 0xDF, 0xE7, 0xF3, 0xFD, 0xFD, 
-    0xFC, 0xF3, 0xEB, 0xE3, 0xDB, 0xDB, 0xDB, 0xDD, 0xE3, 0xE7, 0xE9, 0xE7, 
-    0xE2, 0xDC, 0xD2, 0xC9, 0xC4, 0xC0, 0xC7, 0xCB, 0xD1, 0xD8, 0xD9, 0xE1, 
-    0xE6, 0xEC, 0xF1, 0xF5, 0xF6, 0xFA, 0x01, 0x07, 0x09, 0x0B, 0x06, 0x00, 
-    0xFC, 0xF4, 0xF0, 0xED, 0xED, 0xEE, 0xF2, 0xF1, 0xF0, 0xEF, 0xEC, 0xE9, 
-    0xE6, 0xE5, 0xE7, 0xEB, 0xF3, 0xFD, 0x03, 0x05, 0x06, 0x04, 0x01, 0x03, 
-    0xFF, 0xFB, 0xF7, 0xF5, 0xF6, 0xFC, 0x02, 0x07, 0x07, 0x00, 0xF4, 0xE6, 
-    0xDE, 0xDB, 0xDD, 0xE2, 0xE8, 0xEF, 0xF6, 0xFD, 0x03, 0x02, 0x01, 0xFC, 
-    0xFA, 0xF7, 0xF7, 0xFC, 0x01, 0x07, 0x08, 0x09, 0x08, 0x08, 0x05, 0x00, 
-    0xF9, 0xF5, 0xF5, 0xFA, 0x01, 0x04, 0x06, 0x03, 0x01, 0xFB, 0xF8, 0xF4, 
-    0xF6, 0xF8, 0xFD, 0xFF, 0x01, 0x05, 0x05, 0x06, 0x06, 0x06, 0x09, 0x0B, 
-    0x12, 0x16, 0x1C, 0x21, 0x21, 0x23, 0x1A, 0x19, 0x14, 0x13, 0x15, 0x15, 
-    0x17, 0x20, 0x29, 0x33, 0x3B, 0x3B, 0x39, 0x2F, 0x27, 0x1F, 0x19, 0x16, 
-    0x19, 0x1A, 0x1E, 0x1E, 0x1E, 0x1A, 0x15, 0x10, 0x09, 0x04, 0xFF, 0x04, 
-    0x09, 0x14, 0x1E, 0x25, 0x2B, 0x2D, 0x2E, 0x2B, 0x27, 0x20, 0x18, 0x15, 
-    0x17, 0x1A, 0x21, 0x23, 0x20, 0x1C, 0x12, 0x0B, 0x08, 0x09, 0x0B, 0x0D, 
-    0x10, 0x11, 0x15, 0x16, 0x15, 0x11, 0x0A, 0x05, 0x04, 0x07, 0x0C, 0x11, 
-    0x13, 0x13, 0x10, 0x0C, 0x08, 0x02, 0xFF, 0xFA, 0xF7, 0xFC, 0x00, 0x07, 
-    0x0B, 0x0E, 0x0D, 0x06, 0xFF, 0xF5, 0xEF, 0xED, 0xF1, 0xF8, 0x02, 0x08, 
-    0x08, 0x06, 0x01, 0xF7, 0xEF, 0xE7, 0xDF, 0xE0, 0xE4, 0xED, 0xF6, 0x00, 
-    0x05, 0x0C, 0x0E, 0x10, 0x0C, 0x05, 0xFE, 0xFB, 0xFC, 0x01, 0x04, 0x05, 
-    0x06, 0x01, 0xFC, 0xEF, 0xE8, 0xDE, 0xDB, 0xDD, 0xE3, 0xE6, 0xEC, 0xF2, 
-    0xF0, 0xF3, 0xEE, 0xEE, 0xEE, 0xEF, 0xF1, 0xF6, 0xF9, 0xFD, 0xFD, 0xFC, 
-    0xF8, 0xF3, 0xF0, 0xEB, 0xE7, 0xE6, 0xE8, 0xF2, 0xFB, 0xFE, 0xFD, 0xF7, 
-    0xED, 0xE4, 0xDC, 0xD8, 0xD9, 0xE2, 0xEE, 0xF9, 0x02, 0x03, 0x04, 0xF9, 
-    0xF1, 0xE7, 0xDF, 0xDA, 0xD9, 0xDF, 0xE3, 0xEE, 0xF1, 0xF4, 0xF0, 0xEC, 
-    0xE6, 0xE0, 0xDB, 0xD7, 0xD4, 0xD6, 0xDF, 0xE4, 0xE7, 0xE7, 0xE2, 0xDF, 
-    0xDB, 0xD5, 0xD7, 0xDA, 0xE4, 0xEB, 0xF2, 0xFA, 0xFB, 0xFF, 0xFA, 0xF6, 
-    0xEF, 0xE9, 0xE7, 0xE9, 0xEA, 0xEC, 0xEC, 0xE9, 0xE7, 0xE6, 0xE6, 0xE5, 
-    0xE8, 0xE9, 0xEE, 0xF5, 0x00, 0x08, 0x11, 0x11, 0x11, 0x0D, 0x05, 0x00, 
-    0xFA, 0xFC, 0xFF, 0x08, 0x0E, 0x12, 0x12, 0x0D, 0x00, 0xF6, 0xE9, 0xE7, 
-    0xE9, 0xED, 0xF3, 0xF9, 0x03, 0x09, 0x0D, 0x0A, 0x07, 0x00, 0xFB, 0xF7, 
-    0xF6, 0xF9, 0x03, 0x0D, 0x18, 0x1B, 0x1C, 0x13, 0x0C, 0x03, 0xFB, 0xF7, 
-    0xF6, 0xFA, 0xFA, 0xFD, 0xF8, 0xF6, 0xF1, 0xF1, 0xED, 0xEF, 0xF2, 0xF9, 
-    0x06, 0x0D, 0x19, 0x1D, 0x24, 0x24, 0x22, 0x20, 0x1E, 0x1D, 0x1C, 0x1B, 
-    0x1C, 0x19, 0x18, 0x18, 0x13, 0x11, 0x0C, 0x07, 0x03, 0x04, 0x09, 0x12, 
-    0x1E, 0x28, 0x2C, 0x2E, 0x2D, 0x27, 0x21, 0x1B, 0x18, 0x18, 0x1F, 0x24, 
-    0x29, 0x30, 0x33, 0x32, 0x2B, 0x21, 0x16, 0x10, 0x0A, 0x0A, 0x0D, 0x11, 
-    0x17, 0x1C, 0x1F, 0x1F, 0x1D, 0x18, 0x13, 0x0E, 0x0E, 0x12, 0x1A, 0x20, 
-    0x23, 0x26, 0x22, 0x1E, 0x16, 0x0F, 0x07, 0x04, 0x06, 0x06, 0x0A, 0x0C, 
-    0x0F, 0x12, 0x14, 0x14, 0x11, 0x0F, 0x0C, 0x0D, 0x0F, 0x13, 0x14, 0x12, 
-    0x10, 0x0C, 0x06, 0xFC, 0xF3, 0xF1, 0xF0, 0xF6, 0xFF, 0x04, 0x0C, 0x0D, 
-    0x10, 0x0B, 0x05, 0x01, 0xFC, 0xFE, 0x01, 0x09, 0x0D, 0x11, 0x11, 0x0C, 
-    0x07, 0xFC, 0xF3, 0xE7, 0xE1, 0xDD, 0xDF, 0xE5, 0xE9, 0xF1, 0xF4, 0xF8, 
-    0xFA, 0xF4, 0xEE, 0xE4, 0xDE, 0xDE, 0xE1, 0xE7, 0xEB, 0xEE, 0xEF, 0xED, 
-    0xEA, 0xE1, 0xD7, 0xD4, 0xD0, 0xD5, 0xDD, 0xE6, 0xEE, 0xF4, 0xFB, 0xFD, 
-    0xFD, 0xFD, 0xFA, 0xF5, 0xF6, 0xF6, 0xF9, 0xFD, 0xFF, 0xFA, 0xF5, 0xEF, 
-    0xE9, 0xE1, 0xDD, 0xE0, 0xE3, 0xED, 0xF3, 0xFB, 0xFC, 0xF9, 0xF6, 0xEF, 
-    0xEC, 0xED, 0xF0, 0xF4, 0xFA, 0xFF, 0x01, 0x06, 0x05, 0xFD, 0xF6, 0xE9, 
-    0xE0, 0xDA, 0xD8, 0xD7, 0xDD, 0xE6, 0xEF, 0xF6, 0xF8, 0xF5, 0xF0, 0xE8, 
-    0xE0, 0xDE, 0xDC, 0xE2, 0xE7, 0xEB, 0xED, 0xEC, 0xE7, 0xE6, 0xE0, 0xDE, 
-    0xDD, 0xDF, 0xEB, 0xF4, 0xFF, 0x05, 0x09, 0x07, 0x03, 0xFE, 0xF7, 0xEE, 
-    0xE9, 0xE4, 0xE5, 0xE6, 0xE9, 0xE9, 0xE7, 0xE6, 0xE1, 0xE2, 0xDF, 0xE5, 
-    0xE9, 0xF3, 0xFE, 0x06, 0x11, 0x12, 0x11, 0x0D, 0x07, 0xFF, 0xFD, 0xFD, 
-    0x01, 0x05, 0x0C, 0x0E, 0x0B, 0x09, 0x01, 0xFD, 0xFA, 0xF7, 0xF5, 0xF4, 
-    0xF7, 0xFF, 0x06, 0x0C, 0x0D, 0x09, 0x03, 0xFC, 0xF5, 0xF1, 0xF0, 0xF2, 
-    0xFB, 0x06, 0x0D, 0x16, 0x17, 0x18, 0x13, 0x11, 0x0F, 0x0E, 0x12, 0x13, 
-    0x17, 0x17, 0x15, 0x0F, 0x0A, 0x02, 0xFC, 0xF9, 0xF5, 0xF3, 0xF4, 0xFA, 
-    0x03, 0x0D, 0x15, 0x1C, 0x1F, 0x23, 0x24, 0x28, 0x2A, 0x2D, 0x34, 0x34, 
-    0x35, 0x31, 0x2C, 0x26, 0x1B, 0x15, 0x0D, 0x0C, 0x13, 0x18, 0x20, 0x23, 
-    0x24, 0x20, 0x1E, 0x19, 0x12, 0x0B, 0x07, 0x06, 0x07, 0x0C, 0x0F, 0x14, 
-    0x18, 0x1B, 0x1C, 0x1C, 0x18, 0x15, 0x16, 0x1C, 0x22, 0x29, 0x2F, 0x30, 
-    0x30, 0x27, 0x1F, 0x14, 0x09, 0x01, 0xFB, 0xFB, 0xFC, 0x02, 0x07, 0x09, 
-    0x0C, 0x0B, 0x0B, 0x0B, 0x0C, 0x0E, 0x12, 0x12, 0x14, 0x19, 0x1A, 0x1D, 
-    0x1D, 0x1D, 0x15, 0x11, 0x0C, 0x08, 0x0A, 0x08, 0x08, 0x07, 0x06, 0x06, 
-    0x05, 0x02, 0x02, 0xFF, 0x01, 0x05, 0x08, 0x0B, 0x08, 0x04, 0xFF, 0xF9, 
-    0xF2, 0xEF, 0xEB, 0xEC, 0xF0, 0xF5, 0xFA, 0x04, 0x0B, 0x0D, 0x0F, 0x0A, 
-    0x06, 0x02, 0xFA, 0xF4, 0xEE, 0xEA, 0xE5, 0xE3, 0xDD, 0xDA, 0xD7, 0xCF, 
-    0xCA, 0xC5, 0xC8, 0xCE, 0xD9, 0xE3, 0xEA, 0xEF, 0xF3, 0xF4, 0xF4, 0xF5, 
-    0xF2, 0xF1, 0xED, 0xED, 0xEB, 0xEA, 0xEA, 0xE9, 0xE9, 0xE8, 0xE6, 0xE6, 
-    0xE5, 0xE2, 0xE3, 0xE5, 0xE7, 0xEA, 0xEC, 0xEA, 0xE7, 0xE2, 0xDE, 0xDA, 
-    0xDA, 0xDA, 0xE0, 0xE9, 0xF2, 0xF8, 0xFA, 0xFF, 0xFF, 0x02, 0x01, 0x00, 
-    0xFF, 0xFF, 0xFD, 0xFB, 0xF7, 0xF1, 0xED, 0xE8, 0xE1, 0xD9, 0xD2, 0xCB, 
-    0xCC, 0xCF, 0xD5, 0xDE, 0xE3, 0xEB, 0xEE, 0xF0, 0xF3, 0xF5, 0xF7, 0xFA, 
-    0xFE, 0x04, 0x09, 0x0E, 0x0C, 0x08, 0x04, 0xFE, 0xF7, 0xEF, 0xE8, 0xE2, 
-    0xE2, 0xE1, 0xE7, 0xEF, 0xF3, 0xF9, 0xFC, 0xFE, 0xFA, 0xF9, 0xF7, 0xF7, 
-    0xF8, 0xF9, 0xFB, 0xFE, 0x00, 0x02, 0x05, 0x05, 0x07, 0x08, 0x0D, 0x0F, 
-    0x12, 0x14, 0x11, 0x0D, 0x07, 0x02, 0xF9, 0xF1, 0xE8, 0xE4, 0xE0, 0xE1, 
-    0xE3, 0xE4, 0xE6, 0xE7, 0xEA, 0xED, 0xF2, 0xF5, 0xF8, 0x00, 0x06, 0x0D, 
-    0x12, 0x18, 0x19, 0x16, 0x13, 0x0E, 0x05, 0xFC, 0xFA, 0xFB, 0xFE, 0x03, 
-    0x08, 0x0B, 0x0F, 0x10, 0x0D, 0x0B, 0x07, 0x06, 0x05, 0x08, 0x08, 0x0A, 
-    0x0C, 0x0E, 0x10, 0x12, 0x14, 0x19, 0x1A, 0x1C, 0x21, 0x24, 0x2D, 0x34, 
-    0x3A, 0x3A, 0x3A, 0x36, 0x32, 0x31, 0x2A, 0x29, 0x29, 0x28, 0x26, 0x23, 
-    0x1E, 0x17, 0x13, 0x10, 0x0D, 0x0D, 0x0E, 0x14, 0x17, 0x1F, 0x23, 0x2B, 
-    0x30, 0x32, 0x34, 0x30, 0x2E, 0x2B, 0x28, 0x28, 0x28, 0x25, 0x26, 0x20, 
-    0x1B, 0x13, 0x09, 0x04, 0x00, 0x02, 0x04, 0x09, 0x0C, 0x0B, 0x0C, 0x0A, 
-    0x0A, 0x06, 0x00, 0xFC, 0xF8, 0xF8, 0xFC, 0x01, 0x06, 0x0D, 0x15, 0x1B, 
-    0x1F, 0x20, 0x1D, 0x1D, 0x19, 0x17, 0x16, 0x13, 0x12, 0x0B, 0x07, 0xFE, 
-    0xF5, 0xF0, 0xE9, 0xE7, 0xE5, 0xE5, 0xE9, 0xEC, 0xF0, 0xF7, 0xFD, 0x03, 
-    0x06, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0A, 0x08, 0x04, 0xFF, 0xFB, 0xF4, 
-    0xF0, 0xEB, 0xE9, 0xE9, 0xE6, 0xE9, 0xEA, 0xE9, 0xE8, 0xE6, 0xE3, 0xE2, 
-    0xE1, 0xE0, 0xE4, 0xE6, 0xE9, 0xEC, 0xEC, 0xED, 0xEF, 0xF2, 0xF2, 0xF1, 
-    0xF1, 0xF4, 0xF9, 0xFC, 0xFE, 0x01, 0x02, 0x04, 0x05, 0x00, 0xF9, 0xF5, 
-    0xF0, 0xEF, 0xEB, 0xE8, 0xE7, 0xE6, 0xE7, 0xE5, 0xE3, 0xE3, 0xE2, 0xE2, 
-    0xE7, 0xEB, 0xF1, 0xF3, 0xF6, 0xF7, 0xF6, 0xF9, 0xF7, 0xF3, 0xED, 0xE7, 
-    0xE3, 0xE4, 0xE1, 0xDF, 0xDE, 0xDC, 0xDC, 0xDD, 0xDE, 0xDF, 0xDF, 0xE0, 
-    0xE4, 0xE6, 0xE8, 0xEB, 0xEA, 0xE7, 0xE5, 0xE2, 0xE0, 0xDE, 0xE2, 0xE8, 
-    0xF1, 0xF8, 0xFE, 0x04, 0x03, 0x06, 0x06, 0x03, 0xFE, 0xF7, 0xF4, 0xF2, 
-    0xF1, 0xEF, 0xEE, 0xED, 0xF0, 0xED, 0xEB, 0xEC, 0xEA, 0xEC, 0xF2, 0xF7, 
-    0xFE, 0x05, 0x0D, 0x11, 0x15, 0x17, 0x17, 0x16, 0x15, 0x17, 0x14, 0x15, 
-    0x14, 0x11, 0x0E, 0x0B, 0x07, 0x02, 0xFF, 0xFC, 0xF7, 0xF7, 0xF5, 0xF4, 
-    0xF5, 0xF5, 0xF8, 0xF5, 0xF7, 0xF4, 0xF3, 0xF5, 0xF5, 0xFA, 0x00, 0x04, 
-    0x07, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x04, 
-    0xFF, 0xF9, 0xF7, 0xF5, 0xF2, 0xEF, 0xEC, 0xED, 0xEE, 0xF3, 0xF9, 0xFF, 
-    0x06, 0x0F, 0x17, 0x1E, 0x23, 0x28, 0x2F, 0x33, 0x35, 0x37, 0x36, 0x34, 
-    0x31, 0x2E, 0x28, 0x23, 0x1D, 0x18, 0x15, 0x13, 0x14, 0x18, 0x1C, 0x1E, 
-    0x22, 0x22, 0x22, 0x1E, 0x1C, 0x1A, 0x18, 0x17, 0x15, 0x19, 0x1E, 0x21, 
-    0x24, 0x26, 0x26, 0x2B, 0x2D, 0x2F, 0x30, 0x30, 0x2F, 0x2D, 0x29, 0x1F, 
-    0x1A, 0x12, 0x0E, 0x09, 0x08, 0x06, 0x05, 0x05, 0x03, 0x03, 0xFF, 0xFE, 
-    0xFD, 0xFF, 0x03, 0x06, 0x0F, 0x16, 0x1D, 0x24, 0x28, 0x2C, 0x29, 0x28, 
-    0x23, 0x1C, 0x17, 0x10, 0x0E, 0x0C, 0x0A, 0x07, 0x03, 0xFE, 0xF9, 0xF5, 
-    0xF0, 0xE9, 0xE9, 0xE8, 0xEA, 0xED, 0xED, 0xEC, 0xEA, 0xE9, 0xEB, 0xF0, 
-    0xEE, 0xF2, 0xF5, 0xF7, 0xF6, 0xF6, 0xF6, 0xF9, 0xFC, 0xFC, 0xF9, 0xF5, 
-    0xF4, 0xF2, 0xF1, 0xED, 0xE9, 0xE2, 0xDE, 0xDA, 0xD5, 0xD0, 0xCD, 0xCE, 
-    0xD2, 0xD7, 0xDC, 0xE1, 0xE7, 0xEB, 0xF1, 0xF8, 0xFD, 0x01, 0xFF, 0xFC, 
-    0xF8, 0xF6, 0xF3, 0xF2, 0xEF, 0xEF, 0xEF, 0xEE, 0xEB, 0xE7, 0xE6, 0xE4, 
-    0xE7, 0xEA, 0xEE, 0xF2, 0xF3, 0xF5, 0xF5, 0xF3, 0xF1, 0xEE, 0xEE, 0xF1, 
-    0xF2, 0xF5, 0xF7, 0xFA, 0x00, 0x05, 0x06, 0x06, 0x03, 0x01, 0xFF, 0xFB, 
-    0xF6, 0xEF, 0xEA, 0xE7, 0xE6, 0xE3, 0xDF, 0xDA, 0xD7, 0xD7, 0xD9, 0xDA, 
-    0xDC, 0xDA, 0xDA, 0xDA, 0xDC, 0xDF, 0xE4, 0xE7, 0xEA, 0xEF, 0xEF, 0xF1, 
-    0xF3, 0xF4, 0xF2, 0xEE, 0xEB, 0xE9, 0xE7, 0xE7, 0xE6, 0xE6, 0xE5, 0xE7, 
-    0xE8, 0xE9, 0xEA, 0xED, 0xF0, 0xF2, 0xF5, 0xF6, 0xFA, 0xFC, 0xFE, 0xFE, 
-    0x00, 0x02, 0x05, 0x07, 0x09, 0x08, 0x0A, 0x0B, 0x0E, 0x14, 0x17, 0x19, 
-    0x18, 0x18, 0x11, 0x0D, 0x0B, 0x06, 0xFF, 0xF8, 0xF3, 0xEF, 0xED, 0xEC, 
-    0xEB, 0xED, 0xF1, 0xF4, 0xFA, 0xFE, 0x06, 0x0C, 0x12, 0x15, 0x16, 0x17, 
-    0x18, 0x17, 0x14, 0x12, 0x0F, 0x0D, 0x0D, 0x0C, 0x0A, 0x08, 0x06, 0x03, 
-    0x00, 0x01, 0x03, 0x05, 0x04, 0x05, 0x07, 0x0B, 0x0D, 0x0E, 0x10, 0x13, 
-    0x16, 0x1A, 0x1D, 0x1F, 0x21, 0x26, 0x2B, 0x30, 0x35, 0x35, 0x36, 0x35, 
-    0x30, 0x2B, 0x27, 0x25, 0x21, 0x1F, 0x1A, 0x16, 0x11, 0x0C, 0x08, 0x07, 
-    0x07, 0x05, 0x03, 0x03, 0x06, 0x0B, 0x10, 0x14, 0x1A, 0x21, 0x2B, 0x30, 
-    0x31, 0x31, 0x31, 0x31, 0x2F, 0x2A, 0x25, 0x1E, 0x18, 0x13, 0x0E, 0x0B, 
-    0x09, 0x07, 0x06, 0x03, 0x01, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 
-    0x02, 0x04, 0x05, 0x07, 0x09, 0x0E, 0x13, 0x17, 0x1B, 0x19, 0x19, 0x19, 
-    0x1C, 0x22, 0x23, 0x21, 0x1B, 0x16, 0x13, 0x0C, 0x08, 0x02, 0xFE, 0xFA, 
-    0xF8, 0xF9, 0xF8, 0xFA, 0xFA, 0xFC, 0xFE, 0x01, 0x04, 0x07, 0x08, 0x09, 
-    0x09, 0x0B, 0x0C, 0x0A, 0x08, 0x01, 0xFE, 0xF9, 0xF7, 0xF2, 0xF0, 0xEF, 
-    0xEB, 0xE9, 0xE3, 0xE1, 0xDF, 0xDE, 0xDD, 0xDA, 0xD8, 0xD8, 0xD9, 0xDA, 
-    0xDB, 0xDC, 0xDD, 0xDC, 0xDE, 0xDD, 0xDE, 0xE2, 0xE5, 0xE9, 0xEC, 0xEF, 
-    0xF3, 0xF4, 0xF5, 0xF7, 0xF9, 0xFA, 0xF8, 0xF6, 0xF4, 0xF1, 0xEF, 0xEA, 
-    0xE9, 0xE6, 0xE5, 0xE3, 0xE2, 0xE2, 0xE2, 0xE6, 0xE9, 0xEE, 0xF5, 0xFC, 
-    0x02, 0x05, 0x06, 0x06, 0x06, 0x05, 0x03, 0xFE, 0xFA, 0xF6, 0xF1, 0xEF, 
-    0xEB, 0xE6, 0xE6, 0xE7, 0xE8, 0xE7, 0xE7, 0xE7, 0xE8, 0xEA, 0xEA, 0xE7, 
-    0xE4, 0xE1, 0xE0, 0xE0, 0xE1, 0xE5, 0xEC, 0xF3, 0xF9, 0xFC, 0xFF, 0x01, 
-    0x00, 0x02, 0x02, 0x02, 0x00, 0xFF, 0xFE, 0xFA, 0xF8, 0xF3, 0xF1, 0xEE, 
-    0xEC, 0xEC, 0xE9, 0xE8, 0xE8, 0xEC, 0xF1, 0xF5, 0xFB, 0xFC, 0x00, 0x05, 
-    0x08, 0x0D, 0x0E, 0x10, 0x11, 0x13, 0x13, 0x12, 0x11, 0x0C, 0x06, 0x02, 
-    0xFD, 0xF9, 0xF4, 0xF0, 0xEC, 0xEA, 0xEB, 0xEB, 0xED, 0xEE, 0xF2, 0xF6, 
-    0xFB, 0xFF, 0x01, 0x02, 0x02, 0x03, 0x06, 0x07, 0x07, 0x08, 0x07, 0x07, 
-    0x09, 0x0C, 0x0E, 0x0F, 0x10, 0x12, 0x11, 0x11, 0x0D, 0x08, 0x04, 0x01, 
-    0xFD, 0xFA, 0xF6, 0xF3, 0xF3, 0xF2, 0xF4, 0xF5, 0xF6, 0xFA, 0x01, 0x0C, 
-    0x16, 0x1F, 0x2A, 0x30, 0x38, 0x38, 0x37, 0x37, 0x34, 0x33, 0x2D, 0x2C, 
-    0x28, 0x28, 0x2A, 0x29, 0x27, 0x27, 0x25, 0x23, 0x22, 0x21, 0x20, 0x1D, 
-    0x1B, 0x18, 0x16, 0x16, 0x16, 0x15, 0x17, 0x18, 0x1A, 0x1E, 0x23, 0x26, 
-    0x27, 0x27, 0x25, 0x24, 0x22, 0x20, 0x1F, 0x1A, 0x16, 0x10, 0x0B, 0x07, 
-    0x04, 0x02, 0xFE, 0xFC, 0xF8, 0xF6, 0xF4, 0xF5, 0xF6, 0xF9, 0xFA, 0xFC, 
-    0xFF, 0x05, 0x0C, 0x11, 0x14, 0x18, 0x1C, 0x23, 0x26, 0x26, 0x25, 0x1F, 
-    0x19, 0x13, 0x0F, 0x0A, 0x05, 0x00, 0xFA, 0xF4, 0xF4, 0xF3, 0xF6, 0xF9, 
-    0xFC, 0xFD, 0xFE, 0xFD, 0xFB, 0xFA, 0xFA, 0xFB, 0xFA, 0xF9, 0xF7, 0xF7, 
-    0xF5, 0xF7, 0xF6, 0xF6, 0xF9, 0xFB, 0xFE, 0xFF, 0x00, 0xFF, 0xFD, 0xFA, 
-    0xF3, 0xEE, 0xE7, 0xE1, 0xDD, 0xD8, 0xD7, 0xD9, 0xDA, 0xDC, 0xDF, 0xE2, 
-    0xE6, 0xE8, 0xEB, 0xF0, 0xF6, 0xFA, 0xFC, 0xFC, 0xFB, 0xF7, 0xF4, 0xF1, 
-    0xEF, 0xEF, 0xEF, 0xEE, 0xED, 0xEE, 0xF0, 0xF1, 0xF1, 0xEF, 0xEC, 0xEA, 
-    0xE9, 0xE9, 0xE8, 0xE7, 0xE6, 0xE5, 0xE8, 0xEA, 0xED, 0xF0, 0xF2, 0xF4, 
-    0xF5, 0xF7, 0xF8, 0xFB, 0xFB, 0xF9, 0xF8, 0xF5, 0xF6, 0xF7, 0xF6, 0xF3, 
-    0xEE, 0xE9, 0xE5, 0xE4, 0xE4, 0xE3, 0xE0, 0xDB, 0xD8, 0xD5, 0xD6, 0xD5, 
-    0xD7, 0xD9, 0xDC, 0xE0, 0xE4, 0xE9, 0xF1, 0xF8, 0xFF, 0x02, 0x01, 0xFF, 
-    0xFC, 0xFD, 0xFB, 0xF9, 0xF5, 0xF2, 0xEE, 0xEA, 0xE6, 0xE2, 0xE2, 0xE6, 
-    0xEA, 0xEF, 0xF4, 0xFA, 0x00, 0x03, 0x04, 0x04, 0x04, 0x05, 0x07, 0x09, 
-    0x0C, 0x0F, 0x12, 0x14, 0x15, 0x18, 0x1B, 0x1C, 0x1B, 0x18, 0x14, 0x12, 
-    0x10, 0x0C, 0x06, 0xFF, 0xF7, 0xEE, 0xE8, 0xE2, 0xE1, 0xE3, 0xE6, 0xE8, 
-    0xEB, 0xEF, 0xF5, 0xFD, 0x02, 0x07, 0x09, 0x0D, 0x10, 0x11, 0x12, 0x11, 
-    0x0E, 0x0B, 0x08, 0x08, 0x05, 0x01, 0xFD, 0xFA, 0xF9, 0xF8, 0xFA, 0xFD, 
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x00, 0x01, 0x02, 0x06, 0x0A, 0x11, 0x17, 
-    0x1E, 0x25, 0x2A, 0x2D, 0x2C, 0x2B, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2D, 
-    0x2C, 0x2A, 0x28, 0x25, 0x20, 0x1B, 0x17, 0x13, 0x10, 0x0F, 0x0F, 0x0E, 
-    0x0D, 0x0C, 0x0D, 0x0E, 0x0F, 0x12, 0x16, 0x1B, 0x21, 0x28, 0x2E, 0x30, 
-    0x31, 0x2F, 0x2D, 0x29, 0x22, 0x1A, 0x13, 0x0D, 0x0A, 0x05, 0xFE, 0xF6, 
-    0xEF, 0xE9, 0xE8, 0xE9, 0xE8, 0xEA, 0xEF, 0xF5, 0xFC, 0x00, 0x01, 0x02, 
-    0x03, 0x04, 0x04, 0x05, 0x08, 0x0D, 0x0F, 0x11, 0x10, 0x0D, 0x0A, 0x06, 
-    0x04, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xF7, 0xF5, 
-    0xF4, 0xF2, 0xF0, 0xF1, 0xF3, 0xF6, 0xF9, 0xFA, 0xF9, 0xF7, 0xF5, 0xF3, 
-    0xEF, 0xEB, 0xE8, 0xEA, 0xED, 0xEF, 0xF2, 0xF4, 0xF5, 0xF4, 0xF0, 0xEC, 
-    0xE9, 0xE7, 0xE5, 0xE4, 0xE2, 0xE1, 0xE1, 0xE2, 0xE4, 0xE6, 0xE6, 0xE5, 
-    0xE4, 0xE6, 0xE7, 0xE9, 0xEB, 0xEB, 0xEA, 0xE7, 0xE2, 0xDD, 0xD9, 0xD6, 
-    0xD5, 0xD7, 0xDA, 0xDE, 0xE5, 0xEA, 0xEF, 0xF2, 0xF3, 0xF6, 0xF8, 0xFA, 
-    0xFD, 0xFE, 0xFE, 0xFF, 0xFE, 0xFD, 0xFE, 0xFC, 0xFB, 0xFA, 0xF8, 0xF7, 
-    0xF6, 0xF7, 0xF6, 0xF8, 0xF7, 0xF5, 0xF2, 0xF0, 0xEC, 0xE8, 0xE5, 0xE4, 
-    0xE5, 0xE6, 0xE7, 0xE9, 0xEC, 0xEF, 0xF0, 0xEE, 0xEC, 0xEB, 0xE9, 0xE7, 
-    0xE5, 0xE4, 0xE7, 0xEB, 0xEF, 0xF1, 0xF2, 0xF3, 0xF2, 0xF0, 0xEE, 0xEE, 
-    0xF0, 0xF3, 0xF7, 0xFA, 0xFC, 0xFC, 0xF8, 0xF2, 0xED, 0xEB, 0xED, 0xF1, 
-    0xF7, 0xFF, 0x07, 0x0C, 0x0B, 0x05, 0xFC, 0xF6, 0xF3, 0xF3, 0xF6, 0xFB, 
-    0x01, 0x05, 0x07, 0x07, 0x08, 0x0A, 0x0D, 0x11, 0x16, 0x1D, 0x25, 0x2A, 
-    0x2B, 0x28, 0x20, 0x18, 0x11, 0x0A, 0x05, 0x04, 0x09, 0x10, 0x17, 0x1E, 
-    0x21, 0x22, 0x20, 0x1D, 0x19, 0x15, 0x14, 0x15, 0x17, 0x18, 0x17, 0x16, 
-    0x14, 0x14, 0x16, 0x18, 0x19, 0x19, 0x1A, 0x1C, 0x1E, 0x1F, 0x1F, 0x1D, 
-    0x1A, 0x19, 0x18, 0x19, 0x18, 0x17, 0x18, 0x1D, 0x23, 0x26, 0x29, 0x2A, 
-    0x2A, 0x2A, 0x28, 0x24, 0x1D, 0x13, 0x0A, 0x06, 0x0A, 0x12, 0x1D, 0x26, 
-    0x29, 0x25, 0x1A, 0x0C, 0x00, 0xFE, 0x07, 0x19, 0x2D, 0x3C, 0x40, 0x38, 
-    0x28, 0x14, 0x03, 0xFA, 0xFC, 0x08, 0x17, 0x24, 0x2B, 0x28, 0x1F, 0x11, 
-    0x02, 0xF8, 0xF2, 0xEE, 0xEC, 0xEA, 0xE8, 0xE7, 0xE6, 0xE6, 0xEB, 0xF2, 
-    0xF8, 0xFE, 0x02, 0x04, 0x05, 0x05, 0x04, 0x03, 0x01, 0xFE, 0xFC, 0xFB, 
-    0xF9, 0xF7, 0xF4, 0xF4, 0xF8, 0xFE, 0x05, 0x0A, 0x0E, 0x0E, 0x0D, 0x0B, 
-    0x07, 0x03, 0xFE, 0xFA, 0xF9, 0xFA, 0xFB, 0xFC, 0xFA, 0xF8, 0xF5, 0xF3, 
-    0xEF, 0xED, 0xED, 0xEF, 0xF3, 0xF5, 0xF4, 0xF2, 0xF0, 0xF0, 0xF0, 0xEC, 
-    0xE7, 0xE3, 0xE3, 0xE8, 0xF0, 0xF7, 0xFD, 0xFF, 0xFF, 0xFB, 0xF6, 0xF0, 
-    0xE9, 0xE3, 0xDE, 0xDC, 0xDB, 0xDD, 0xE1, 0xE5, 0xE7, 0xE5, 0xE3, 0xE1, 
-    0xE2, 0xE3, 0xE4, 0xE5, 0xE4, 0xE5, 0xE5, 0xE4, 0xE3, 0xDD, 0xD8, 0xD6, 
-    0xD8, 0xDD, 0xE2, 0xE7, 0xE9, 0xEB, 0xEA, 0xE7, 0xE5, 0xE5, 0xE7, 0xEA, 
-    0xED, 0xED, 0xEC, 0xE9, 0xE7, 0xE8, 0xE9, 0xEB, 0xEC, 0xED, 0xED, 0xEC, 
-    0xED, 0xEE, 0xEF, 0xF0, 0xEF, 0xEE, 0xED, 0xEB, 0xE8, 0xE4, 0xE2, 0xE2, 
-    0xE3, 0xE5, 0xE8, 0xED, 0xF2, 0xF5, 0xF5, 0xF4, 0xF1, 0xEF, 0xED, 0xEA, 
-    0xE8, 0xE7, 0xE9, 0xEC, 0xF0, 0xF1, 0xF1, 0xEE, 0xEB, 0xEB, 0xEE, 0xF2, 
-    0xF4, 0xF4, 0xF2, 0xF1, 0xF2, 0xF4, 0xF5, 0xF6, 0xF5, 0xF7, 0xF9, 0xFC, 
-    0x01, 0x05, 0x0A, 0x0C, 0x0B, 0x0A, 0x09, 0x07, 0x04, 0xFF, 0xFB, 0xFA, 
-    0xF9, 0xFA, 0xFC, 0xFD, 0xFF, 0x02, 0x08, 0x0E, 0x15, 0x1D, 0x23, 0x27, 
-    0x27, 0x23, 0x1C, 0x15, 0x0F, 0x0B, 0x09, 0x09, 0x0B, 0x0E, 0x10, 0x12, 
-    0x14, 0x16, 0x15, 0x14, 0x13, 0x14, 0x13, 0x12, 0x0E, 0x09, 0x03, 0xFF, 
-    0x00, 0x08, 0x14, 0x1F, 0x25, 0x25, 0x20, 0x19, 0x12, 0x0C, 0x09, 0x0B, 
-    0x13, 0x1E, 0x2A, 0x31, 0x2F, 0x26, 0x1A, 0x0E, 0x08, 0x08, 0x11, 0x1F, 
-    0x2D, 0x37, 0x3A, 0x35, 0x2B, 0x1B, 0x0C, 0x01, 0xFD, 0xFF, 0x08, 0x14, 
-    0x1E, 0x23, 0x21, 0x1B, 0x12, 0x0A, 0x06, 0x06, 0x0C, 0x15, 0x1D, 0x23, 
-    0x24, 0x22, 0x19, 0x10, 0x08, 0x05, 0x0A, 0x12, 0x1F, 0x2A, 0x2F, 0x2D, 
-    0x23, 0x16, 0x08, 0xFA, 0xF1, 0xEB, 0xEB, 0xEE, 0xF4, 0xFA, 0xFD, 0xFB, 
-    0xF7, 0xF2, 0xEF, 0xF0, 0xF6, 0xFF, 0x0A, 0x12, 0x15, 0x11, 0x09, 0x01, 
-    0xF7, 0xF1, 0xEE, 0xEE, 0xF2, 0xF6, 0xFC, 0x01, 0x03, 0x01, 0xFC, 0xF5, 
-    0xF0, 0xEF, 0xF0, 0xF2, 0xF3, 0xF2, 0xF3, 0xF5, 0xF6, 0xF3, 0xEF, 0xE9, 
-    0xE7, 0xEA, 0xF0, 0xF7, 0xFB, 0xFC, 0xFA, 0xF5, 0xF1, 0xEB, 0xE7, 0xE3, 
-    0xE3, 0xE6, 0xEC, 0xF2, 0xF6, 0xF8, 0xF8, 0xF6, 0xF0, 0xEB, 0xE8, 0xE5, 
-    0xE3, 0xE3, 0xE4, 0xE4, 0xE2, 0xE0, 0xDD, 0xDB, 0xDA, 0xD8, 0xD9, 0xDA, 
-    0xDD, 0xE1, 0xE4, 0xE4, 0xE2, 0xE0, 0xDD, 0xDB, 0xD9, 0xD8, 0xD8, 0xDB, 
-    0xE0, 0xE4, 0xEA, 0xEF, 0xF2, 0xF4, 0xF3, 0xF1, 0xEF, 0xEF, 0xF1, 0xF3, 
-    0xF4, 0xF3, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF1, 0xEF, 0xEF, 0xF0, 0xF2, 
-    0xF4, 0xF4, 0xF2, 0xF0, 0xEE, 0xEB, 0xE9, 0xE7, 0xE6, 0xE7, 0xE8, 0xE9, 
-    0xEA, 0xEC, 0xEE, 0xF0, 0xEE, 0xEB, 0xE9, 0xE8, 0xE9, 0xEB, 0xED, 0xEE, 
-    0xEF, 0xF0, 0xF2, 0xF4, 0xF5, 0xF2, 0xEE, 0xEA, 0xEA, 0xEC, 0xF0, 0xF4, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF2, 0xEF, 0xF0, 0xF5, 0xFC, 0x01, 
-    0x04, 0x05, 0x05, 0x04, 0x00, 0xFD, 0xFA, 0xF8, 0xF8, 0xF9, 0xFB, 0xFD, 
-    0xFF, 0x00, 0xFE, 0xF9, 0xF4, 0xF2, 0xF9, 0x04, 0x14, 0x22, 0x29, 0x2B, 
-    0x25, 0x1A, 0x0E, 0x05, 0x01, 0x04, 0x0D, 0x19, 0x27, 0x32, 0x37, 0x35, 
-    0x2D, 0x21, 0x15, 0x0F, 0x10, 0x15, 0x1E, 0x28, 0x2F, 0x32, 0x30, 0x2A, 
-    0x1F, 0x11, 0x06, 0x01, 0x04, 0x0D, 0x19, 0x24, 0x2D, 0x31, 0x2E, 0x25, 
-    0x1B, 0x12, 0x0C, 0x09, 0x09, 0x0D, 0x15, 0x1F, 0x26, 0x29, 0x25, 0x1E, 
-    0x13, 0x09, 0x03, 0x00, 0x02, 0x08, 0x0F, 0x15, 0x1A, 0x1D, 0x1E, 0x1B, 
-    0x14, 0x0D, 0x09, 0x0C, 0x12, 0x1A, 0x1F, 0x21, 0x21, 0x1D, 0x1A, 0x14, 
-    0x10, 0x0C, 0x0A, 0x0C, 0x12, 0x1B, 0x23, 0x27, 0x27, 0x20, 0x16, 0x0B, 
-    0x02, 0xFC, 0xFA, 0xF9, 0xFA, 0xFB, 0xFA, 0xFB, 0xFB, 0xF7, 0xEF, 0xE8, 
-    0xE5, 0xE7, 0xEC, 0xF4, 0xFB, 0x02, 0x07, 0x09, 0x08, 0x04, 0x01, 0xFE, 
-    0xFC, 0xFC, 0x01, 0x06, 0x0B, 0x0E, 0x0F, 0x10, 0x0D, 0x08, 0x04, 0x00, 
-    0xFD, 0xFB, 0xF8, 0xF8, 0xF8, 0xFB, 0xFF, 0x00, 0xFD, 0xF7, 0xF2, 0xEF, 
-    0xEE, 0xF0, 0xF2, 0xF3, 0xF4, 0xF4, 0xF4, 0xF2, 0xF0, 0xED, 0xEA, 0xE7, 
-    0xE7, 0xE8, 0xE9, 0xEC, 0xED, 0xED, 0xEB, 0xE7, 0xE3, 0xE1, 0xE0, 0xE2, 
-    0xE4, 0xE6, 0xE7, 0xEA, 0xEE, 0xF1, 0xF1, 0xEE, 0xEA, 0xE8, 0xE8, 0xEA, 
-    0xED, 0xEF, 0xF1, 0xF0, 0xEE, 0xEB, 0xE7, 0xE3, 0xDE, 0xDA, 0xD9, 0xDB, 
-    0xE0, 0xE6, 0xE9, 0xE9, 0xE6, 0xE2, 0xDF, 0xDE, 0xDD, 0xDC, 0xDD, 0xE1, 
-    0xE5, 0xEA, 0xEF, 0xF5, 0xF9, 0xF9, 0xF6, 0xF2, 0xF1, 0xF2, 0xF4, 0xF5, 
-    0xF5, 0xF4, 0xF3, 0xF2, 0xF1, 0xF1, 0xF0, 0xEF, 0xEE, 0xF0, 0xF6, 0xFC, 
-    0xFF, 0x00, 0xFE, 0xFC, 0xF9, 0xF6, 0xF4, 0xF5, 0xF7, 0xF9, 0xFA, 0xF8, 
-    0xF6, 0xF7, 0xF9, 0xF7, 0xF2, 0xEC, 0xE8, 0xE6, 0xE7, 0xE9, 0xEC, 0xF2, 
-    0xFA, 0x00, 0x04, 0x01, 0xFA, 0xF2, 0xE9, 0xE3, 0xE2, 0xE5, 0xEB, 0xF5, 
-    0xFD, 0x02, 0x01, 0xFD, 0xF7, 0xF1, 0xEC, 0xEA, 0xEA, 0xEC, 0xF3, 0xFF, 
-    0x0C, 0x14, 0x16, 0x14, 0x11, 0x0E, 0x0D, 0x0C, 0x0E, 0x12, 0x17, 0x1D, 
-    0x22, 0x25, 0x24, 0x24, 0x21, 0x1F, 0x1E, 0x1E, 0x1F, 0x1E, 0x1B, 0x16, 
-    0x11, 0x0D, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x11, 0x13, 0x14, 0x16, 
-    0x16, 0x17, 0x18, 0x1A, 0x1E, 0x22, 0x25, 0x26, 0x23, 0x20, 0x1E, 0x1C, 
-    0x1B, 0x1A, 0x1B, 0x1D, 0x21, 0x25, 0x29, 0x2C, 0x2B, 0x26, 0x20, 0x1B, 
-    0x18, 0x17, 0x16, 0x15, 0x15, 0x16, 0x1A, 0x1C, 0x1E, 0x1C, 0x19, 0x14, 
-    0x11, 0x11, 0x12, 0x15, 0x19, 0x1C, 0x1D, 0x1F, 0x1D, 0x19, 0x15, 0x12, 
-    0x13, 0x13, 0x12, 0x11, 0x12, 0x14, 0x15, 0x13, 0x0E, 0x07, 0x03, 0x01, 
-    0x03, 0x04, 0x03, 0x04, 0x02, 0x00, 0xFF, 0xFD, 0xFB, 0xF8, 0xF5, 0xF4, 
-    0xF4, 0xF6, 0xF8, 0xFA, 0xFB, 0xFC, 0xFB, 0xFA, 0xF8, 0xF7, 0xF9, 0xFB, 
-    0xFE, 0x01, 0x04, 0x06, 0x06, 0x04, 0xFF, 0xF9, 0xF3, 0xED, 0xE9, 0xE8, 
-    0xEA, 0xED, 0xEF, 0xEF, 0xF0, 0xF1, 0xF3, 0xF4, 0xF4, 0xF3, 0xF3, 0xF5, 
-    0xF7, 0xF8, 0xF7, 0xF4, 0xF2, 0xF3, 0xF5, 0xF7, 0xF6, 0xF6, 0xF7, 0xFA, 
-    0xFE, 0xFF, 0x00, 0xFC, 0xF8, 0xF3, 0xEF, 0xEC, 0xEA, 0xEA, 0xEA, 0xED, 
-    0xEE, 0xED, 0xEC, 0xEC, 0xEB, 0xEA, 0xE8, 0xE6, 0xE5, 0xE4, 0xE6, 0xEA, 
-    0xEC, 0xED, 0xED, 0xEA, 0xE6, 0xE0, 0xD9, 0xD3, 0xD2, 0xD3, 0xD5, 0xD7, 
-    0xDA, 0xDC, 0xDB, 0xDA, 0xD7, 0xD6, 0xD7, 0xD8, 0xDB, 0xDF, 0xE5, 0xEA, 
-    0xEF, 0xF3, 0xF7, 0xFA, 0xFC, 0xFC, 0xFB, 0xFC, 0xFF, 0x01, 0x00, 0xFD, 
-    0xF8, 0xF4, 0xEF, 0xEB, 0xEB, 0xED, 0xF2, 0xF7, 0xF8, 0xF6, 0xF2, 0xEB, 
-    0xE5, 0xDE, 0xDB, 0xDD, 0xE1, 0xE5, 0xEA, 0xEE, 0xF0, 0xEF, 0xEB, 0xE6, 
-    0xE4, 0xE4, 0xE5, 0xE6, 0xE8, 0xEC, 0xF2, 0xF8, 0xFC, 0xFC, 0xFA, 0xF7, 
-    0xF6, 0xF4, 0xF5, 0xF7, 0xF9, 0xFD, 0x00, 0x03, 0x05, 0x06, 0x04, 0x02, 
-    0xFF, 0xFD, 0xFA, 0xF6, 0xF5, 0xF7, 0xFB, 0x00, 0x02, 0x03, 0x04, 0x03, 
-    0x02, 0x01, 0x02, 0x01, 0x03, 0x06, 0x0A, 0x0E, 0x12, 0x15, 0x16, 0x16, 
-    0x13, 0x10, 0x0F, 0x0F, 0x11, 0x15, 0x19, 0x1B, 0x1A, 0x16, 0x11, 0x0D, 
-    0x0B, 0x0B, 0x0C, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1B, 
-    0x1C, 0x1D, 0x1C, 0x1C, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x14, 0x10, 0x0D, 
-    0x0D, 0x0F, 0x13, 0x17, 0x19, 0x1A, 0x1B, 0x1B, 0x19, 0x15, 0x12, 0x11, 
-    0x12, 0x13, 0x14, 0x15, 0x14, 0x13, 0x13, 0x14, 0x13, 0x12, 0x10, 0x0F, 
-    0x10, 0x12, 0x15, 0x17, 0x19, 0x18, 0x17, 0x18, 0x18, 0x1A, 0x1B, 0x1D, 
-    0x21, 0x24, 0x27, 0x28, 0x27, 0x25, 0x22, 0x1E, 0x1A, 0x18, 0x16, 0x14, 
-    0x13, 0x11, 0x0F, 0x0D, 0x09, 0x04, 0xFF, 0xFB, 0xF7, 0xF4, 0xF2, 0xF3, 
-    0xF4, 0xF5, 0xF6, 0xF4, 0xF3, 0xF1, 0xED, 0xE9, 0xE7, 0xE7, 0xEA, 0xED, 
-    0xF0, 0xF1, 0xF2, 0xF2, 0xF0, 0xED, 0xEB, 0xE9, 0xEA, 0xED, 0xF1, 0xF7, 
-    0xFC, 0x00, 0x03, 0x05, 0x06, 0x04, 0x00, 0xFD, 0xFD, 0xFE, 0xFE, 0xFD, 
-    0xFD, 0xFB, 0xFB, 0xF9, 0xF7, 0xF4, 0xF1, 0xEF, 0xF0, 0xF2, 0xF4, 0xF4, 
-    0xF3, 0xF2, 0xF0, 0xED, 0xEA, 0xE7, 0xE5, 0xE6, 0xE7, 0xEA, 0xEC, 0xEC, 
-    0xEB, 0xEA, 0xE9, 0xE9, 0xE8, 0xE7, 0xE6, 0xE7, 0xE8, 0xEB, 0xEE, 0xEF, 
-    0xEF, 0xEE, 0xEC, 0xE9, 0xE7, 0xE4, 0xE3, 0xE5, 0xE8, 0xEE, 0xF3, 0xF6, 
-    0xF4, 0xEF, 0xE7, 0xDF, 0xDA, 0xD9, 0xDB, 0xDF, 0xE4, 0xEA, 0xEF, 0xF6, 
-    0xF9, 0xFA, 0xF6, 0xF2, 0xEE, 0xEC, 0xEE, 0xF1, 0xF4, 0xF7, 0xF9, 0xF9, 
-    0xF7, 0xF5, 0xF0, 0xED, 0xEA, 0xEA, 0xEC, 0xEE, 0xEF, 0xED, 0xEA, 0xE7, 
-    0xE4, 0xE2, 0xE2, 0xE3, 0xE5, 0xE7, 0xE8, 0xEA, 0xEC, 0xEE, 0xF1, 0xF4, 
-    0xF5, 0xF5, 0xF6, 0xF5, 0xF6, 0xF6, 0xF5, 0xF4, 0xF3, 0xF2, 0xF2, 0xF1, 
-    0xF0, 0xEE, 0xEB, 0xEA, 0xEC, 0xEF, 0xF0, 0xF1, 0xF2, 0xF1, 0xF1, 0xF2, 
-    0xF1, 0xF2, 0xF4, 0xF6, 0xF9, 0xFC, 0xFF, 0x01, 0x04, 0x04, 0x03, 0xFF, 
-    0xFB, 0xF9, 0xFA, 0xFD, 0x02, 0x07, 0x0E, 0x13, 0x17, 0x1B, 0x1C, 0x1F, 
-    0x20, 0x22, 0x23, 0x24, 0x26, 0x2A, 0x2C, 0x2C, 0x2A, 0x25, 0x20, 0x1D, 
-    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x21, 0x22, 0x21, 0x1E, 0x19, 0x13, 0x10, 
-    0x0F, 0x10, 0x12, 0x13, 0x12, 0x11, 0x10, 0x0E, 0x0D, 0x0A, 0x07, 0x04, 
-    0x04, 0x08, 0x0C, 0x10, 0x11, 0x10, 0x0E, 0x0B, 0x09, 0x09, 0x0B, 0x0E, 
-    0x15, 0x1A, 0x1F, 0x21, 0x23, 0x27, 0x29, 0x29, 0x24, 0x21, 0x1F, 0x21, 
-    0x22, 0x21, 0x1E, 0x1B, 0x19, 0x18, 0x14, 0x0F, 0x0A, 0x06, 0x06, 0x08, 
-    0x0B, 0x0D, 0x0F, 0x10, 0x0E, 0x0C, 0x0A, 0x08, 0x08, 0x07, 0x08, 0x07, 
-    0x08, 0x07, 0x07, 0x08, 0x07, 0x04, 0xFF, 0xFB, 0xF9, 0xF8, 0xF9, 0xFA, 
-    0xFA, 0xFA, 0xFB, 0xFA, 0xF9, 0xF7, 0xF6, 0xF5, 0xF4, 0xF3, 0xF4, 0xF6, 
-    0xF7, 0xF6, 0xF5, 0xF2, 0xEF, 0xEE, 0xED, 0xEF, 0xF2, 0xF8, 0xFE, 0x01, 
-    0x03, 0x02, 0x03, 0x02, 0x00, 0xFD, 0xF9, 0xF6, 0xF8, 0xFA, 0xFC, 0xFE, 
-    0xFC, 0xFB, 0xF9, 0xF7, 0xF4, 0xF2, 0xEF, 0xEE, 0xEE, 0xED, 0xEA, 0xE8, 
-    0xE7, 0xE6, 0xE5, 0xE4, 0xE4, 0xE6, 0xE7, 0xE9, 0xE9, 0xEA, 0xEB, 0xED, 
-    0xF2, 0xF7, 0xF9, 0xF8, 0xF7, 0xF8, 0xF7, 0xF5, 0xF0, 0xEC, 0xE9, 0xE7, 
-    0xE6, 0xE2, 0xDE, 0xDC, 0xDA, 0xDB, 0xDD, 0xDF, 0xE0, 0xDF, 0xDE, 0xDC, 
-    0xDA, 0xD8, 0xD7, 0xD6, 0xD7, 0xD8, 0xD8, 0xDA, 0xDD, 0xE1, 0xE3, 0xE4, 
-    0xE5, 0xE4, 0xE6, 0xE9, 0xED, 0xF1, 0xF7, 0xFC, 0x00, 0x03, 0x03, 0x04, 
-    0x05, 0x06, 0x05, 0x04, 0x05, 0x07, 0x0A, 0x0B, 0x0B, 0x07, 0x02, 0xFE, 
-    0xF9, 0xF6, 0xF2, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEE, 0xEF, 0xEE, 0xED, 
-    0xEB, 0xE9, 0xE8, 0xE7, 0xE8, 0xE8, 0xE9, 0xEA, 0xE9, 0xE9, 0xE7, 0xE5, 
-    0xE4, 0xE4, 0xE8, 0xEB, 0xEF, 0xF0, 0xF0, 0xEF, 0xEE, 0xED, 0xEF, 0xF2, 
-    0xF5, 0xFA, 0xFF, 0x04, 0x08, 0x09, 0x0B, 0x0F, 0x14, 0x16, 0x16, 0x14, 
-    0x14, 0x16, 0x17, 0x16, 0x14, 0x12, 0x11, 0x10, 0x0E, 0x0B, 0x08, 0x06, 
-    0x09, 0x0C, 0x0F, 0x13, 0x15, 0x16, 0x15, 0x14, 0x13, 0x13, 0x13, 0x15, 
-    0x18, 0x19, 0x1A, 0x1B, 0x1D, 0x20, 0x22, 0x21, 0x1E, 0x1B, 0x1B, 0x1D, 
-    0x20, 0x21, 0x20, 0x20, 0x20, 0x21, 0x20, 0x1E, 0x1D, 0x1D, 0x1F, 0x21, 
-    0x23, 0x23, 0x22, 0x20, 0x1C, 0x18, 0x14, 0x12, 0x11, 0x12, 0x13, 0x14, 
-    0x15, 0x16, 0x17, 0x18, 0x17, 0x16, 0x17, 0x16, 0x17, 0x17, 0x18, 0x18, 
-    0x19, 0x19, 0x18, 0x18, 0x16, 0x15, 0x13, 0x12, 0x10, 0x10, 0x12, 0x14, 
-    0x15, 0x15, 0x12, 0x10, 0x0E, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x11, 0x11, 
-    0x12, 0x13, 0x14, 0x16, 0x17, 0x16, 0x13, 0x0F, 0x0D, 0x0A, 0x06, 0x01, 
-    0xFD, 0xF9, 0xF5, 0xF1, 0xEC, 0xE9, 0xE7, 0xE7, 0xEA, 0xEB, 0xEC, 0xEA, 
-    0xE7, 0xE3, 0xDE, 0xDC, 0xDD, 0xE1, 0xE7, 0xED, 0xF2, 0xF5, 0xF6, 0xF5, 
-    0xF6, 0xF4, 0xF2, 0xF1, 0xF2, 0xF6, 0xFD, 0x04, 0x09, 0x0B, 0x0A, 0x08, 
-    0x06, 0x05, 0x04, 0x03, 0x03, 0x05, 0x09, 0x0D, 0x0E, 0x0D, 0x08, 0x02, 
-    0xFD, 0xF9, 0xF5, 0xF1, 0xEC, 0xE9, 0xEA, 0xED, 0xEF, 0xEE, 0xEC, 0xEA, 
-    0xE8, 0xE5, 0xE2, 0xDF, 0xDE, 0xDD, 0xDD, 0xDC, 0xDB, 0xDC, 0xDE, 0xDF, 
-    0xDF, 0xDE, 0xDF, 0xDE, 0xE0, 0xE3, 0xE5, 0xE6, 0xE6, 0xE4, 0xE0, 0xDC, 
-    0xD9, 0xDA, 0xDD, 0xE2, 0xE5, 0xE6, 0xE6, 0xE8, 0xEA, 0xED, 0xF0, 0xF1, 
-    0xF0, 0xF0, 0xF1, 0xF2, 0xF5, 0xF6, 0xF6, 0xF5, 0xF4, 0xF5, 0xF4, 0xF2, 
-    0xEE, 0xEC, 0xEC, 0xEF, 0xF2, 0xF5, 0xF6, 0xF7, 0xF6, 0xF3, 0xF0, 0xED, 
-    0xEB, 0xEB, 0xED, 0xEF, 0xF2, 0xF4, 0xF5, 0xF5, 0xF4, 0xF2, 0xEF, 0xEE, 
-    0xED, 0xEE, 0xF1, 0xF3, 0xF4, 0xF2, 0xF0, 0xEF, 0xF0, 0xF1, 0xF0, 0xF1, 
-    0xF3, 0xF7, 0xFB, 0xFC, 0xFB, 0xFA, 0xF7, 0xF4, 0xF2, 0xF2, 0xF4, 0xF6, 
-    0xF8, 0xFB, 0xFC, 0xFD, 0xFC, 0xFD, 0x00, 0x02, 0x02, 0x01, 0x00, 0x02, 
-    0x04, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x07, 0x06, 0x07, 0x0A, 0x0E, 
-    0x13, 0x18, 0x1B, 0x1B, 0x1C, 0x1B, 0x19, 0x16, 0x15, 0x15, 0x17, 0x1C, 
-    0x21, 0x25, 0x28, 0x2B, 0x2C, 0x2C, 0x2C, 0x29, 0x25, 0x23, 0x22, 0x23, 
-    0x22, 0x20, 0x1E, 0x1C, 0x1B, 0x1A, 0x17, 0x13, 0x0F, 0x0D, 0x0C, 0x0D, 
-    0x0E, 0x10, 0x10, 0x0E, 0x0B, 0x08, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0F, 
-    0x11, 0x10, 0x11, 0x12, 0x13, 0x14, 0x14, 0x15, 0x18, 0x1C, 0x1F, 0x1F, 
-    0x1E, 0x1F, 0x21, 0x22, 0x21, 0x20, 0x21, 0x22, 0x26, 0x28, 0x29, 0x28, 
-    0x24, 0x1F, 0x16, 0x11, 0x0F, 0x13, 0x19, 0x1E, 0x1F, 0x18, 0x11, 0x06, 
-    0x00, 0xF7, 0xF4, 0xF3, 0xF3, 0xF6, 0xF8, 0xFB, 0xFB, 0xFE, 0x01, 0x08, 
-    0x0B, 0x0F, 0x0D, 0x07, 0x08, 0x07, 0x0A, 0x0C, 0x0B, 0x0C, 0x06, 0x02, 
-    0xFE, 0xF4, 0xEE, 0xE8, 0xE4, 0xE2, 0xE2, 0xE3, 0xE5, 0xE4, 0xE3, 0xE1, 
-    0xE2, 0xE3, 0xE1, 0xE2, 0xE0, 0xE2, 0xE2, 0xE1, 0xE6, 0xE7, 0xE7, 0xEB, 
-    0xEA, 0xE9, 0xEE, 0xED, 0xF8, 0xFF, 0x09, 0x12, 0x13, 0x18, 0x0F, 0x0E, 
-    0x08, 0x06, 0x08, 0x06, 0x0B, 0x0A, 0x10, 0x16, 0x0D, 0x10, 0x02, 0xFE, 
-    0xFA, 0xF1, 0xEE, 0xE6, 0xE6, 0xE3, 0xE0, 0xDF, 0xE0, 0xD8, 0xDC, 0xD4, 
-    0xCD, 0xCD, 0xCF, 0xCC, 0xD3, 0xD9, 0xD8, 0xD7, 0xD9, 0xD7, 0xD2, 0xD2, 
-    0xD2, 0xD4, 0xD6, 0xE1, 0xE1, 0xE9, 0xE2, 0xE7, 0xE3, 0xE6, 0xF0, 0xEA, 
-    0xF4, 0xF2, 0xFD, 0xF9, 0xFC, 0xFC, 0xFA, 0xFC, 0xFE, 0x00, 0xFA, 0xF7, 
-    0xF6, 0xF4, 0xF7, 0xFC, 0xF9, 0xFC, 0xF8, 0xF2, 0xF3, 0xE8, 0xE8, 0xEA, 
-    0xE9, 0xF3, 0xF5, 0xFB, 0xFF, 0xFC, 0xFD, 0xFA, 0xFA, 0xF9, 0xF6, 0xF4, 
-    0xF7, 0xF6, 0xF0, 0xF5, 0xF0, 0xF0, 0xEC, 0xE5, 0xE0, 0xDA, 0xD9, 0xDC, 
-    0xE2, 0xEB, 0xEE, 0xF0, 0xF5, 0xED, 0xEB, 0xE6, 0xE7, 0xEA, 0xEF, 0xF2, 
-    0xFD, 0x04, 0x07, 0x09, 0x06, 0x05, 0x00, 0xFF, 0xF8, 0xFB, 0xFF, 0xFD, 
-    0xFE, 0x06, 0x04, 0x06, 0x04, 0x00, 0x01, 0xFF, 0x03, 0x08, 0x11, 0x19, 
-    0x1E, 0x22, 0x24, 0x1E, 0x1B, 0x13, 0x11, 0x0E, 0x10, 0x18, 0x1A, 0x22, 
-    0x22, 0x26, 0x21, 0x24, 0x1C, 0x1D, 0x1A, 0x15, 0x1C, 0x17, 0x1C, 0x1B, 
-    0x1D, 0x1E, 0x20, 0x1C, 0x1C, 0x16, 0x11, 0x14, 0x15, 0x11, 0x12, 0x16, 
-    0x13, 0x1C, 0x1C, 0x18, 0x19, 0x18, 0x19, 0x1B, 0x1B, 0x1F, 0x25, 0x29, 
-    0x2C, 0x2A, 0x27, 0x24, 0x21, 0x1B, 0x1A, 0x1B, 0x1F, 0x21, 0x1D, 0x1F, 
-    0x18, 0x17, 0x0F, 0x06, 0x03, 0x03, 0x07, 0x09, 0x11, 0x10, 0x14, 0x0D, 
-    0x0D, 0x0A, 0x03, 0x07, 0x05, 0x0D, 0x17, 0x1F, 0x20, 0x25, 0x21, 0x1E, 
-    0x1E, 0x19, 0x16, 0x13, 0x12, 0x0D, 0x12, 0x0B, 0x0F, 0x0D, 0x0B, 0x0A, 
-    0xFC, 0xFD, 0xEF, 0xF3, 0xF4, 0xF6, 0xF9, 0xFC, 0x00, 0xFB, 0xFB, 0xF3, 
-    0xEF, 0xE8, 0xE8, 0xE8, 0xF1, 0xF2, 0xFA, 0xFC, 0xFD, 0x01, 0xF5, 0xF8, 
-    0xF0, 0xEF, 0xEE, 0xEE, 0xF1, 0xEF, 0xF1, 0xF4, 0xF4, 0xF5, 0xF1, 0xE8, 
-    0xE8, 0xE7, 0xEB, 0xF4, 0xF9, 0xFE, 0x05, 0x06, 0x06, 0x02, 0xFB, 0xF4, 
-    0xF1, 0xF4, 0xF7, 0xFE, 0x05, 0x08, 0x08, 0x05, 0x03, 0x01, 0xFB, 0xF4, 
-    0xF1, 0xF1, 0xF0, 0xF7, 0xF8, 0xFB, 0xFC, 0xFB, 0xF4, 0xEA, 0xDE, 0xD2, 
-    0xD4, 0xD4, 0xD7, 0xDD, 0xE0, 0xDE, 0xE0, 0xD8, 0xD1, 0xCC, 0xC7, 0xCA, 
-    0xCE, 0xD8, 0xDC, 0xE2, 0xEA, 0xE8, 0xE5, 0xE5, 0xDF, 0xE1, 0xE6, 0xEB, 
-    0xEC, 0xF2, 0xF2, 0xF7, 0xFC, 0xFA, 0xFC, 0xF5, 0xF5, 0xF0, 0xEE, 0xF1, 
-    0xF1, 0xFA, 0xFD, 0x01, 0xFD, 0xFE, 0xF7, 0xF0, 0xEE, 0xE5, 0xEE, 0xEE, 
-    0xF7, 0xFE, 0xFD, 0xFB, 0xF8, 0xF1, 0xF1, 0xE9, 0xE8, 0xE7, 0xE2, 0xEC, 
-    0xE8, 0xEB, 0xEC, 0xED, 0xED, 0xEA, 0xE3, 0xDE, 0xDA, 0xDF, 0xE5, 0xEE, 
-    0xF2, 0xF9, 0xFC, 0xFA, 0x00, 0xFA, 0xF9, 0xF9, 0xFA, 0x03, 0x0D, 0x11, 
-    0x17, 0x16, 0x14, 0x0E, 0x0D, 0x0C, 0x08, 0x06, 0x09, 0x08, 0x0B, 0x0A, 
-    0x06, 0x06, 0x01, 0xFF, 0xF8, 0xF5, 0xEE, 0xEE, 0xF1, 0xF8, 0xFA, 0xFF, 
-    0xFE, 0xFA, 0xF8, 0xF0, 0xF2, 0xF3, 0xF8, 0x01, 0x09, 0x11, 0x17, 0x1D, 
-    0x1B, 0x17, 0x18, 0x11, 0x17, 0x1B, 0x1F, 0x24, 0x22, 0x26, 0x25, 0x2B, 
-    0x29, 0x28, 0x1D, 0x18, 0x17, 0x11, 0x1A, 0x1A, 0x1F, 0x21, 0x24, 0x21, 
-    0x21, 0x1D, 0x1A, 0x17, 0x12, 0x19, 0x1A, 0x22, 0x27, 0x28, 0x26, 0x25, 
-    0x1A, 0x17, 0x14, 0x12, 0x12, 0x15, 0x18, 0x19, 0x1C, 0x1A, 0x1D, 0x19, 
-    0x18, 0x12, 0x10, 0x10, 0x0D, 0x12, 0x14, 0x19, 0x1D, 0x1E, 0x1C, 0x1A, 
-    0x18, 0x15, 0x16, 0x16, 0x1B, 0x1E, 0x25, 0x28, 0x24, 0x23, 0x19, 0x17, 
-    0x17, 0x15, 0x16, 0x18, 0x15, 0x19, 0x14, 0x13, 0x10, 0x0C, 0x06, 0xFB, 
-    0xF5, 0xEC, 0xED, 0xEC, 0xF4, 0xF7, 0xFB, 0xFB, 0xFD, 0xF7, 0xF4, 0xEF, 
-    0xE9, 0xED, 0xEE, 0xFA, 0xFD, 0x03, 0x05, 0x05, 0x04, 0x03, 0xFF, 0xFE, 
-    0x00, 0xFE, 0x02, 0xFF, 0xFE, 0xFD, 0xFF, 0xFB, 0xFA, 0xFB, 0xF5, 0xF6, 
-    0xF4, 0xF6, 0xF5, 0xF8, 0xFD, 0xFE, 0xFF, 0xFF, 0xFC, 0xF7, 0xF4, 0xEE, 
-    0xF0, 0xF0, 0xF1, 0xF4, 0xF3, 0xF3, 0xF0, 0xEC, 0xE9, 0xE5, 0xE3, 0xE6, 
-    0xE8, 0xEA, 0xF0, 0xF2, 0xF5, 0xF5, 0xF6, 0xF4, 0xED, 0xE7, 0xE5, 0xE5, 
-    0xE6, 0xED, 0xF0, 0xF3, 0xF4, 0xF1, 0xF2, 0xEE, 0xEA, 0xE8, 0xE9, 0xED, 
-    0xF4, 0xFA, 0xFA, 0xFD, 0xF7, 0xF4, 0xEF, 0xEA, 0xEB, 0xEB, 0xED, 0xEB, 
-    0xEC, 0xEA, 0xEC, 0xEA, 0xED, 0xE8, 0xDE, 0xDD, 0xD9, 0xDA, 0xDE, 0xDF, 
-    0xE2, 0xE8, 0xEB, 0xEF, 0xEE, 0xEB, 0xE6, 0xE3, 0xE4, 0xE8, 0xED, 0xF4, 
-    0xFA, 0xF8, 0xFA, 0xF8, 0xF4, 0xF5, 0xF5, 0xF5, 0xF6, 0xF6, 0xF5, 0xF7, 
-    0xFA, 0xFB, 0xF5, 0xEF, 0xE8, 0xDD, 0xD9, 0xD8, 0xD9, 0xDE, 0xE4, 0xE9, 
-    0xEF, 0xF0, 0xF1, 0xF0, 0xEB, 0xE8, 0xE4, 0xE4, 0xED, 0xF2, 0xFB, 0x04, 
-    0x05, 0x06, 0x01, 0x01, 0xFE, 0xFC, 0xF9, 0xF8, 0xFA, 0xFB, 0x03, 0x07, 
-    0x09, 0x07, 0x03, 0xFD, 0xF8, 0xF6, 0xF6, 0xFB, 0xFC, 0x02, 0x08, 0x0E, 
-    0x13, 0x13, 0x13, 0x0A, 0x09, 0x0B, 0x0D, 0x15, 0x1B, 0x1E, 0x1F, 0x1C, 
-    0x1E, 0x1A, 0x19, 0x1B, 0x19, 0x1B, 0x1A, 0x1B, 0x1A, 0x18, 0x18, 0x16, 
-    0x10, 0x0A, 0x02, 0x00, 0x00, 0x01, 0x08, 0x0A, 0x0D, 0x0F, 0x0C, 0x0B, 
-    0x06, 0x04, 0x05, 0x02, 0x07, 0x0E, 0x14, 0x18, 0x1D, 0x1D, 0x1B, 0x1B, 
-    0x18, 0x19, 0x1E, 0x23, 0x23, 0x28, 0x2B, 0x2B, 0x2E, 0x2D, 0x2C, 0x26, 
-    0x21, 0x1B, 0x1A, 0x1F, 0x21, 0x2A, 0x2C, 0x2F, 0x31, 0x2D, 0x29, 0x23, 
-    0x20, 0x1B, 0x1B, 0x1C, 0x1E, 0x24, 0x24, 0x23, 0x1E, 0x19, 0x14, 0x11, 
-    0x0E, 0x0F, 0x0F, 0x0F, 0x10, 0x0E, 0x0C, 0x0B, 0x04, 0xFD, 0xF2, 0xE8, 
-    0xEA, 0xED, 0xF3, 0xFB, 0x03, 0x04, 0x07, 0x08, 0x07, 0x03, 0xFE, 0xFC, 
-    0xF9, 0x01, 0x08, 0x0D, 0x13, 0x11, 0x10, 0x0C, 0x06, 0x06, 0x03, 0x02, 
-    0x03, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFD, 0xF6, 0xEE, 0xE8, 0xE2, 0xE2, 
-    0xE7, 0xE9, 0xED, 0xF1, 0xF3, 0xF5, 0xF6, 0xF0, 0xEC, 0xE5, 0xE2, 0xE4, 
-    0xE9, 0xEF, 0xF0, 0xF2, 0xF0, 0xEF, 0xF1, 0xF2, 0xF3, 0xF4, 0xF4, 0xF7, 
-    0xF7, 0xF6, 0xF5, 0xF1, 0xEE, 0xE8, 0xDE, 0xDA, 0xD5, 0xD5, 0xD7, 0xDE, 
-    0xE2, 0xE5, 0xEA, 0xEA, 0xEC, 0xE8, 0xE3, 0xE0, 0xDF, 0xE0, 0xE4, 0xEB, 
-    0xED, 0xEF, 0xEC, 0xEB, 0xE7, 0xE4, 0xE5, 0xE1, 0xE5, 0xE9, 0xED, 0xF0, 
-    0xF2, 0xF2, 0xF4, 0xF3, 0xF0, 0xE8, 0xE1, 0xE1, 0xE0, 0xE5, 0xED, 0xF4, 
-    0xF9, 0xFE, 0x00, 0xFE, 0xF8, 0xF4, 0xF2, 0xF3, 0xF6, 0xF8, 0xFB, 0xFB, 
-    0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF, 0xFE, 0xFE, 0xFD, 0xFC, 0xFB, 0xF7, 
-    0xF3, 0xF1, 0xE9, 0xE1, 0xD8, 0xD3, 0xD2, 0xD7, 0xDE, 0xE3, 0xE8, 0xE9, 
-    0xEC, 0xEF, 0xEE, 0xEB, 0xE9, 0xEA, 0xEC, 0xF3, 0xF8, 0xFE, 0x01, 0x01, 
-    0x04, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0E, 0x0F, 0x10, 0x12, 0x10, 0x0F, 
-    0x0A, 0x03, 0xFD, 0xFA, 0xFA, 0xFC, 0xFE, 0x02, 0x05, 0x09, 0x0B, 0x0D, 
-    0x0B, 0x05, 0x01, 0x00, 0x01, 0x01, 0x06, 0x06, 0x0B, 0x0B, 0x0A, 0x0A, 
-    0x08, 0x08, 0x0B, 0x10, 0x15, 0x18, 0x19, 0x1B, 0x1B, 0x1F, 0x1D, 0x1A, 
-    0x11, 0x0C, 0x0D, 0x0D, 0x11, 0x19, 0x1C, 0x21, 0x25, 0x23, 0x21, 0x1C, 
-    0x1C, 0x1C, 0x1D, 0x1E, 0x20, 0x25, 0x29, 0x2A, 0x29, 0x21, 0x1F, 0x1C, 
-    0x1C, 0x1A, 0x1B, 0x1E, 0x1D, 0x23, 0x20, 0x1F, 0x1F, 0x1A, 0x15, 0x11, 
-    0x09, 0x08, 0x09, 0x0E, 0x15, 0x1C, 0x1F, 0x23, 0x23, 0x21, 0x21, 0x1F, 
-    0x1F, 0x1C, 0x1F, 0x21, 0x24, 0x23, 0x24, 0x1D, 0x1A, 0x1C, 0x1C, 0x1F, 
-    0x21, 0x20, 0x1D, 0x1B, 0x16, 0x15, 0x0D, 0x08, 0x00, 0xF6, 0xF1, 0xF2, 
-    0xF4, 0xFA, 0x00, 0x01, 0x05, 0x06, 0x04, 0x03, 0x00, 0xFC, 0xFE, 0xFE, 
-    0x02, 0x05, 0x05, 0x06, 0x01, 0xFB, 0xF8, 0xF6, 0xF5, 0xF4, 0xF5, 0xF7, 
-    0xF9, 0xFD, 0x00, 0x00, 0xFE, 0xFA, 0xF0, 0xE8, 0xE4, 0xE4, 0xE8, 0xEC, 
-    0xF2, 0xF8, 0xFB, 0xFE, 0xFE, 0xFB, 0xFB, 0xF7, 0xF8, 0xF9, 0xFB, 0xFE, 
-    0x02, 0x04, 0x03, 0x00, 0xFB, 0xF7, 0xF8, 0xF9, 0xF7, 0xF9, 0xF7, 0xF9, 
-    0xF9, 0xFA, 0xF7, 0xF3, 0xEF, 0xE7, 0xE2, 0xDE, 0xDD, 0xDE, 0xE0, 0xDF, 
-    0xE1, 0xDF, 0xE0, 0xE0, 0xDC, 0xDC, 0xDA, 0xDC, 0xDC, 0xE0, 0xE3, 0xE4, 
-    0xE4, 0xE4, 0xE1, 0xDE, 0xDB, 0xDA, 0xDC, 0xE0, 0xE7, 0xEA, 0xF1, 0xF0, 
-    0xF0, 0xF1, 0xEE, 0xEB, 0xE5, 0xE1, 0xDF, 0xE2, 0xE6, 0xED, 0xF2, 0xF3, 
-    0xF7, 0xF8, 0xF7, 0xF6, 0xF4, 0xF4, 0xF6, 0xF9, 0xFB, 0xFC, 0xFC, 0xF9, 
-    0xF7, 0xF5, 0xF5, 0xF7, 0xF7, 0xF9, 0xFB, 0xFD, 0xFE, 0xFD, 0xFB, 0xF6, 
-    0xF2, 0xEA, 0xE3, 0xE0, 0xE0, 0xE5, 0xE9, 0xEF, 0xF5, 0xFD, 0x01, 0x03, 
-    0xFF, 0xFA, 0xF8, 0xF8, 0xFA, 0xFA, 0xFC, 0xFE, 0xFF, 0xFF, 0xFC, 0xF9, 
-    0xF9, 0xF6, 0xF7, 0xF6, 0xF8, 0xFA, 0xFC, 0xFF, 0xFE, 0xFF, 0xFC, 0xFA, 
-    0xF5, 0xF2, 0xF3, 0xF3, 0xF9, 0xFD, 0x03, 0x08, 0x0A, 0x0E, 0x0C, 0x09, 
-    0x06, 0x05, 0x06, 0x07, 0x0C, 0x0D, 0x10, 0x14, 0x11, 0x12, 0x13, 0x10, 
-    0x0F, 0x10, 0x0E, 0x12, 0x16, 0x19, 0x18, 0x17, 0x16, 0x12, 0x11, 0x0C, 
-    0x06, 0x04, 0x07, 0x0A, 0x0F, 0x13, 0x13, 0x15, 0x15, 0x12, 0x13, 0x13, 
-    0x17, 0x17, 0x1B, 0x1D, 0x1E, 0x24, 0x22, 0x23, 0x1E, 0x18, 0x17, 0x17, 
-    0x19, 0x1D, 0x1F, 0x20, 0x24, 0x23, 0x24, 0x21, 0x1C, 0x17, 0x15, 0x16, 
-    0x18, 0x1B, 0x1F, 0x26, 0x2B, 0x30, 0x32, 0x31, 0x2F, 0x2F, 0x31, 0x32, 
-    0x32, 0x31, 0x31, 0x2F, 0x2C, 0x28, 0x21, 0x1E, 0x1C, 0x19, 0x19, 0x19, 
-    0x16, 0x12, 0x0F, 0x0E, 0x0C, 0x07, 0x01, 0xF7, 0xF3, 0xEF, 0xEE, 0xF0, 
-    0xEE, 0xF2, 0xF3, 0xF9, 0xFD, 0xFE, 0xFD, 0xF9, 0xF8, 0xF7, 0xF7, 0xF9, 
-    0xFD, 0xFE, 0x00, 0xFD, 0xFC, 0xFC, 0xF9, 0xFB, 0xFC, 0xFE, 0xFE, 0xFE, 
-    0xFD, 0xFB, 0xFB, 0xF9, 0xF6, 0xF2, 0xEB, 0xEA, 0xEB, 0xEF, 0xF1, 0xF1, 
-    0xF3, 0xF6, 0xF6, 0xF7, 0xF7, 0xF1, 0xEF, 0xEC, 0xED, 0xEF, 0xF1, 0xF2, 
-    0xF2, 0xF2, 0xF0, 0xEE, 0xF0, 0xEF, 0xF1, 0xF1, 0xF0, 0xF3, 0xF4, 0xF5, 
-    0xF7, 0xF9, 0xF8, 0xF7, 0xF2, 0xEE, 0xEC, 0xEE, 0xF0, 0xF2, 0xF3, 0xF3, 
-    0xF2, 0xF2, 0xF3, 0xF2, 0xF0, 0xEF, 0xEE, 0xEE, 0xEF, 0xF2, 0xF0, 0xED, 
-    0xEA, 0xE7, 0xE7, 0xE6, 0xE5, 0xE2, 0xE3, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 
-    0xE7, 0xE6, 0xE3, 0xE0, 0xDF, 0xE1, 0xE1, 0xE4, 0xE5, 0xE8, 0xEB, 0xEF, 
-    0xF0, 0xF0, 0xEE, 0xEF, 0xF1, 0xF1, 0xF4, 0xF6, 0xF8, 0xF9, 0xF7, 0xF3, 
-    0xF1, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xED, 0xEF, 0xF1, 0xF1, 0xF1, 0xEE, 
-    0xE8, 0xE6, 0xE1, 0xE1, 0xE4, 0xE8, 0xEC, 0xF0, 0xF4, 0xF8, 0xFC, 0xFE, 
-    0xFD, 0xFB, 0xFB, 0xFC, 0xFD, 0xFD, 0xFE, 0xFC, 0xFE, 0xFF, 0xFD, 0xFF, 
-    0xFD, 0x00, 0x04, 0x05, 0x07, 0x05, 0x03, 0x02, 0x00, 0xFD, 0xFA, 0xF8, 
-    0xF6, 0xF6, 0xF9, 0xFC, 0xFF, 0x02, 0x03, 0x07, 0x0A, 0x0B, 0x0B, 0x07, 
-    0x04, 0x03, 0x05, 0x0B, 0x10, 0x13, 0x15, 0x17, 0x15, 0x15, 0x16, 0x13, 
-    0x15, 0x14, 0x14, 0x13, 0x11, 0x12, 0x13, 0x14, 0x11, 0x0D, 0x08, 0x05, 
-    0x06, 0x07, 0x0A, 0x0B, 0x0F, 0x13, 0x14, 0x14, 0x11, 0x0D, 0x0C, 0x0E, 
-    0x0F, 0x11, 0x14, 0x15, 0x16, 0x16, 0x14, 0x13, 0x12, 0x12, 0x15, 0x16, 
-    0x17, 0x1A, 0x1A, 0x1B, 0x1B, 0x18, 0x18, 0x14, 0x11, 0x10, 0x0F, 0x10, 
-    0x13, 0x15, 0x17, 0x19, 0x1B, 0x1C, 0x1A, 0x18, 0x16, 0x16, 0x18, 0x1B, 
-    0x1E, 0x21, 0x23, 0x24, 0x22, 0x20, 0x1D, 0x1F, 0x1E, 0x21, 0x23, 0x23, 
-    0x23, 0x20, 0x20, 0x1C, 0x19, 0x15, 0x0F, 0x09, 0x05, 0x03, 0x05, 0x06, 
-    0x06, 0x07, 0x09, 0x0A, 0x09, 0x07, 0x04, 0x04, 0x02, 0x03, 0x01, 0xFF, 
-    0xFE, 0xFB, 0xFC, 0xFA, 0xF6, 0xF5, 0xF2, 0xF3, 0xF4, 0xF3, 0xF2, 0xEF, 
-    0xEF, 0xEF, 0xEF, 0xEE, 0xE9, 0xE6, 0xE6, 0xE9, 0xEC, 0xEF, 0xF0, 0xF1, 
-    0xF3, 0xF4, 0xF4, 0xEE, 0xEA, 0xE7, 0xE5, 0xE6, 0xE8, 0xEA, 0xEC, 0xED, 
-    0xEF, 0xF0, 0xED, 0xED, 0xEC, 0xEF, 0xF2, 0xF6, 0xF9, 0xF8, 0xF6, 0xF4, 
-    0xF5, 0xF4, 0xF3, 0xEF, 0xEC, 0xEC, 0xEA, 0xEA, 0xEC, 0xED, 0xEF, 0xEE, 
-    0xEC, 0xE9, 0xE7, 0xE6, 0xE3, 0xE2, 0xE1, 0xE1, 0xE4, 0xE5, 0xE3, 0xE3, 
-    0xE2, 0xE3, 0xE4, 0xE6, 0xE6, 0xE8, 0xEA, 0xEB, 0xEB, 0xEA, 0xEB, 0xEA, 
-    0xED, 0xEC, 0xEA, 0xE9, 0xE8, 0xEB, 0xEF, 0xF4, 0xF7, 0xF6, 0xF5, 0xF4, 
-    0xF5, 0xF9, 0xF9, 0xFA, 0xFB, 0xFE, 0x00, 0x02, 0x01, 0xFD, 0xFA, 0xF6, 
-    0xF5, 0xF4, 0xF7, 0xF8, 0xF7, 0xF6, 0xF4, 0xF5, 0xF4, 0xF5, 0xF2, 0xEF, 
-    0xEB, 0xE8, 0xE7, 0xE6, 0xE7, 0xE9, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 
-    0xEE, 0xED, 0xEC, 0xEE, 0xED, 0xEF, 0xEE, 0xEE, 0xF0, 0xF2, 0xF6, 0xF9, 
-    0xFE, 0x02, 0x03, 0x03, 0xFF, 0xFD, 0xFC, 0xFA, 0xFA, 0xF7, 0xF4, 0xF2, 
-    0xF2, 0xF3, 0xF7, 0xFA, 0xFD, 0x02, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 
-    0x06, 0x06, 0x08, 0x09, 0x09, 0x08, 0x09, 0x0B, 0x0D, 0x11, 0x15, 0x19, 
-    0x1C, 0x1F, 0x20, 0x1F, 0x22, 0x23, 0x24, 0x25, 0x21, 0x20, 0x1D, 0x1A, 
-    0x1B, 0x1A, 0x19, 0x19, 0x18, 0x17, 0x14, 0x11, 0x10, 0x0F, 0x0D, 0x0C, 
-    0x0B, 0x0D, 0x0C, 0x0D, 0x0C, 0x0A, 0x0C, 0x0C, 0x0E, 0x13, 0x17, 0x17, 
-    0x17, 0x17, 0x17, 0x1A, 0x1D, 0x1D, 0x1C, 0x1A, 0x18, 0x1A, 0x1D, 0x1D, 
-    0x1D, 0x1D, 0x20, 0x21, 0x20, 0x1D, 0x1C, 0x1B, 0x1C, 0x1D, 0x1D, 0x1E, 
-    0x1C, 0x18, 0x14, 0x11, 0x10, 0x0F, 0x11, 0x12, 0x11, 0x10, 0x0E, 0x0B, 
-    0x09, 0x06, 0x06, 0x06, 0x03, 0x00, 0xFB, 0xFA, 0xFC, 0xFE, 0x00, 0x03, 
-    0x03, 0x07, 0x0A, 0x09, 0x09, 0x08, 0x07, 0x06, 0x04, 0x02, 0x00, 0xFE, 
-    0xFA, 0xF9, 0xFA, 0xFA, 0xFB, 0xFB, 0xFD, 0xFF, 0xFE, 0xFD, 0xFB, 0xFB, 
-    0xFD, 0xFD, 0xFD, 0xF8, 0xF5, 0xF5, 0xF5, 0xF7, 0xF5, 0xF4, 0xF7, 0xFA, 
-    0xFD, 0xFC, 0xF9, 0xF7, 0xF7, 0xF6, 0xF4, 0xF4, 0xF1, 0xF1, 0xEE, 0xEC, 
-    0xEC, 0xEB, 0xEB, 0xEB, 0xED, 0xEE, 0xEE, 0xED, 0xEC, 0xEE, 0xF0, 0xF1, 
-    0xF0, 0xEE, 0xEC, 0xE9, 0xEC, 0xEC, 0xEE, 0xEF, 0xEF, 0xF0, 0xF0, 0xED, 
-    0xE9, 0xE8, 0xE6, 0xE7, 0xE5, 0xE4, 0xE3, 0xE3, 0xE2, 0xE2, 0xE1, 0xE3, 
-    0xE4, 0xE4, 0xE6, 0xE7, 0xE8, 0xE7, 0xE5, 0xE3, 0xE3, 0xE3, 0xE3, 0xE1, 
-    0xE0, 0xE1, 0xE3, 0xE4, 0xE8, 0xEA, 0xEE, 0xF2, 0xF5, 0xF5, 0xF4, 0xF5, 
-    0xF7, 0xF9, 0xFA, 0xFA, 0xF7, 0xF5, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF4, 
-    0xF6, 0xF9, 0xFD, 0x00, 0x01, 0x01, 0x00, 0x02, 0x03, 0x03, 0x02, 0xFF, 
-    0xFB, 0xF7, 0xF4, 0xF2, 0xF3, 0xF4, 0xF7, 0xF6, 0xF5, 0xF5, 0xF5, 0xF8, 
-    0xF9, 0xF9, 0xF8, 0xFA, 0xFC, 0xFC, 0xFC, 0xFB, 0xFB, 0xFC, 0xFC, 0xFB, 
-    0xFB, 0xFA, 0xF9, 0xF9, 0xFA, 0xF9, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF8, 
-    0xFB, 0xFC, 0xFF, 0x01, 0x02, 0x04, 0x01, 0xFF, 0xFC, 0xFB, 0xFB, 0xFA, 
-    0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0x02, 0x05, 0x06, 0x08, 0x09, 0x0B, 
-    0x0D, 0x0C, 0x0C, 0x0B, 0x0C, 0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x11, 0x13, 
-    0x15, 0x18, 0x1C, 0x1E, 0x1E, 0x1C, 0x1B, 0x1D, 0x1E, 0x1E, 0x1D, 0x1C, 
-    0x1B, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x19, 0x15, 0x10, 0x0B, 0x05, 0x00, 
-    0xFE, 0xFE, 0x03, 0x07, 0x0B, 0x0D, 0x0C, 0x0D, 0x0F, 0x11, 0x13, 0x15, 
-    0x15, 0x14, 0x11, 0x10, 0x0C, 0x08, 0x04, 0xFD, 0xF8, 0xF6, 0xF5, 0xF6, 
-    0xF8, 0xF8, 0xF7, 0xF6, 0xF7, 0xF9, 0xFD, 0x02, 0x05, 0x04, 0x00, 0xFD, 
-    0xFC, 0xFC, 0xFF, 0x00, 0xFE, 0xFA, 0xF8, 0xF5, 0xF2, 0xF2, 0xF0, 0xF2, 
-    0xF2, 0xF2, 0xF0, 0xF0, 0xEE, 0xEB, 0xEC, 0xEA, 0xEB, 0xEC, 0xEE, 0xF0, 
-    0xF0, 0xF0, 0xF1, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xED, 0xEA, 0xEA, 0xEA, 
-    0xEA, 0xE9, 0xE5, 0xE2, 0xE2, 0xE2, 0xE6, 0xE7, 0xE9, 0xED, 0xF2, 0xF8, 
-    0xFA, 0xFC, 0xFA, 0xF7, 0xF5, 0xF4, 0xF3, 0xF2, 0xF2, 0xF1, 0xF1, 0xF1, 
-    0xF0, 0xF3, 0xF4, 0xF3, 0xF3, 0xF1, 0xEF, 0xED, 0xEC, 0xED, 0xEE, 0xED, 
-    0xEB, 0xE9, 0xE5, 0xE4, 0xE3, 0xE3, 0xE3, 0xE2, 0xE2, 0xE0, 0xE1, 0xE3, 
-    0xE3, 0xE7, 0xE3, 0xE2, 0xE1, 0xE1, 0xE2, 0xE0, 0xE0, 0xDF, 0xE1, 0xE1, 
-    0xE1, 0xDD, 0xDB, 0xD9, 0xD8, 0xD7, 0xD7, 0xD8, 0xDC, 0xDE, 0xDE, 0xDD, 
-    0xDA, 0xDD, 0xDF, 0xE2, 0xE4, 0xE6, 0xE7, 0xE7, 0xEA, 0xEC, 0xEC, 0xEC, 
-    0xE8, 0xE5, 0xE1, 0xDF, 0xDE, 0xDF, 0xE1, 0xE2, 0xE4, 0xE3, 0xE4, 0xE7, 
-    0xEA, 0xEC, 0xEB, 0xE8, 0xE5, 0xE5, 0xE7, 0xE7, 0xE6, 0xE2, 0xDE, 0xDD, 
-    0xDE, 0xE2, 0xE3, 0xE7, 0xE9, 0xEC, 0xED, 0xEE, 0xEF, 0xED, 0xEE, 0xEC, 
-    0xED, 0xE9, 0xE6, 0xE5, 0xE4, 0xE6, 0xE7, 0xE8, 0xE9, 0xE9, 0xEA, 0xEB, 
-    0xEB, 0xEA, 0xE7, 0xE8, 0xE7, 0xE6, 0xE5, 0xE2, 0xE2, 0xE2, 0xE2, 0xE3, 
-    0xE2, 0xE1, 0xE5, 0xE8, 0xEE, 0xF4, 0xF6, 0xF9, 0xFB, 0xFC, 0xFD, 0xFE, 
-    0xFD, 0xFE, 0xFE, 0xFB, 0xFB, 0xFA, 0xFC, 0xFB, 0xFA, 0xF8, 0xF5, 0xF4, 
-    0xF2, 0xF1, 0xF4, 0xF7, 0xFA, 0xFC, 0xFA, 0xF9, 0xF8, 0xF5, 0xF0, 0xED, 
-    0xEB, 0xEB, 0xEE, 0xEE, 0xED, 0xEC, 0xEA, 0xEA, 0xE9, 0xE9, 0xE8, 0xE7, 
-    0xE7, 0xE8, 0xEA, 0xEB, 0xEC, 0xEA, 0xE8, 0xE5, 0xE5, 0xE5, 0xE6, 0xE9, 
-    0xED, 0xF1, 0xF4, 0xF5, 0xF4, 0xF2, 0xEF, 0xF0, 0xF4, 0xFB, 0x01, 0x06, 
-    0x06, 0x05, 0x05, 0x05, 0x05, 0x03, 0x01, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 
-    0xFE, 0xFB, 0xFC, 0xFE, 0x01, 0x05, 0x06, 0x06, 0x04, 0x01, 0x00, 0x01, 
-    0x03, 0x04, 0x00, 0xFB, 0xF8, 0xF7, 0xF8, 0xFA, 0xF8, 0xF7, 0xF7, 0xF9, 
-    0xFC, 0x00, 0x03, 0x04, 0x03, 0x02, 0xFF, 0xFA, 0xF8, 0xF8, 0xFA, 0xFB, 
-    0xFD, 0xFF, 0x00, 0x01, 0x01, 0x02, 0x03, 0x05, 0x09, 0x0F, 0x15, 0x1A, 
-    0x1C, 0x1E, 0x1D, 0x1B, 0x18, 0x14, 0x12, 0x10, 0x10, 0x11, 0x13, 0x14, 
-    0x15, 0x15, 0x15, 0x15, 0x14, 0x16, 0x19, 0x1F, 0x24, 0x26, 0x26, 0x27, 
-    0x28, 0x2A, 0x2B, 0x28, 0x25, 0x22, 0x22, 0x24, 0x25, 0x26, 0x24, 0x21, 
-    0x1D, 0x1B, 0x1B, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x18, 0x1A, 0x1B, 0x1B, 
-    0x1A, 0x1A, 0x1B, 0x1A, 0x19, 0x17, 0x17, 0x18, 0x1A, 0x1D, 0x20, 0x22, 
-    0x21, 0x20, 0x1E, 0x1E, 0x1E, 0x1F, 0x20, 0x22, 0x23, 0x24, 0x23, 0x21, 
-    0x20, 0x1F, 0x20, 0x23, 0x25, 0x29, 0x2E, 0x32, 0x35, 0x37, 0x35, 0x33, 
-    0x2E, 0x2B, 0x2A, 0x29, 0x2B, 0x2B, 0x2B, 0x29, 0x29, 0x2B, 0x2B, 0x29, 
-    0x29, 0x27, 0x27, 0x29, 0x2B, 0x2F, 0x33, 0x36, 0x36, 0x34, 0x31, 0x2D, 
-    0x2B, 0x27, 0x24, 0x21, 0x20, 0x21, 0x22, 0x23, 0x23, 0x22, 0x1F, 0x1C, 
-    0x1A, 0x18, 0x16, 0x16, 0x17, 0x18, 0x1B, 0x1C, 0x1D, 0x1C, 0x19, 0x17, 
-    0x16, 0x14, 0x12, 0x11, 0x11, 0x10, 0x10, 0x10, 0x12, 0x16, 0x18, 0x1B, 
-    0x1D, 0x1E, 0x20, 0x21, 0x23, 0x23, 0x25, 0x25, 0x25, 0x25, 0x24, 0x23, 
-    0x20, 0x1E, 0x1C, 0x1B, 0x18, 0x16, 0x12, 0x0C, 0x06, 0x00, 0xFC, 0xF8, 
-    0xF6, 0xF8, 0xFC, 0x03, 0x09, 0x0B, 0x0A, 0x08, 0x06, 0x03, 0x00, 0xFE, 
-    0xFC, 0xFA, 0xFA, 0xFA, 0xFA, 0xF7, 0xF1, 0xEB, 0xE6, 0xE2, 0xE0, 0xDF, 
-    0xE0, 0xE1, 0xE3, 0xE5, 0xE8, 0xEA, 0xEB, 0xEA, 0xE8, 0xE6, 0xE6, 0xE8, 
-    0xEA, 0xED, 0xEE, 0xF0, 0xF1, 0xF2, 0xF0, 0xEF, 0xEF, 0xEE, 0xEE, 0xEF, 
-    0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEC, 0xEA, 0xE8, 0xE5, 0xE2, 0xE1, 0xE3, 
-    0xE6, 0xE9, 0xEA, 0xEC, 0xED, 0xEF, 0xEE, 0xED, 0xEB, 0xEB, 0xEE, 0xF2, 
-    0xF4, 0xF2, 0xEE, 0xEC, 0xEB, 0xEA, 0xEB, 0xE9, 0xE5, 0xE3, 0xE3, 0xE5, 
-    0xE9, 0xEF, 0xF1, 0xF1, 0xEE, 0xE9, 0xE6, 0xE3, 0xE2, 0xE1, 0xE1, 0xE3, 
-    0xE4, 0xE7, 0xE7, 0xE4, 0xE2, 0xE0, 0xDF, 0xDF, 0xDE, 0xDF, 0xDE, 0xDE, 
-    0xDD, 0xDE, 0xDF, 0xE1, 0xE1, 0xE3, 0xE5, 0xE7, 0xEA, 0xEC, 0xEE, 0xF0, 
-    0xF1, 0xEF, 0xED, 0xEC, 0xEC, 0xEF, 0xF1, 0xF3, 0xF3, 0xF2, 0xF0, 0xEE, 
-    0xED, 0xEC, 0xEA, 0xE7, 0xE5, 0xE6, 0xE8, 0xEB, 0xEE, 0xEE, 0xEF, 0xED, 
-    0xEB, 0xE8, 0xE5, 0xE2, 0xDF, 0xDD, 0xDC, 0xDC, 0xDD, 0xDE, 0xDE, 0xDB, 
-    0xD7, 0xD5, 0xD6, 0xD7, 0xD6, 0xD7, 0xD9, 0xDD, 0xE0, 0xE1, 0xE2, 0xE3, 
-    0xE2, 0xE1, 0xDF, 0xDE, 0xDD, 0xDD, 0xDE, 0xE1, 0xE2, 0xE3, 0xE2, 0xE2, 
-    0xE3, 0xE5, 0xE8, 0xE9, 0xEA, 0xEC, 0xED, 0xF0, 0xF2, 0xF4, 0xF4, 0xF4, 
-    0xF3, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF4, 0xF4, 0xF6, 0xF7, 0xF8, 0xF7, 
-    0xF6, 0xF6, 0xF8, 0xFD, 0x00, 0x02, 0x01, 0xFF, 0xFB, 0xF8, 0xF7, 0xF6, 
-    0xF7, 0xF8, 0xFB, 0xFD, 0x00, 0x04, 0x07, 0x08, 0x07, 0x03, 0xFF, 0xFB, 
-    0xF9, 0xF8, 0xF7, 0xF5, 0xF3, 0xF0, 0xEE, 0xED, 0xEC, 0xEA, 0xE6, 0xE3, 
-    0xE3, 0xE4, 0xE5, 0xE6, 0xE5, 0xE4, 0xE5, 0xE7, 0xEB, 0xF0, 0xF3, 0xF5, 
-    0xF6, 0xF7, 0xF7, 0xF8, 0xF8, 0xF6, 0xF3, 0xF1, 0xF3, 0xF7, 0xFA, 0xFC, 
-    0xFE, 0x02, 0x05, 0x06, 0x04, 0x01, 0xFE, 0xFA, 0xF8, 0xF8, 0xFA, 0xFD, 
-    0x00, 0x03, 0x05, 0x05, 0x03, 0x00, 0xFC, 0xF8, 0xF5, 0xF3, 0xF1, 0xF1, 
-    0xF2, 0xF4, 0xF5, 0xF6, 0xF4, 0xF3, 0xF1, 0xF1, 0xF0, 0xF0, 0xF2, 0xF5, 
-    0xF8, 0xF9, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xF7, 0xF4, 0xF2, 0xF3, 0xF5, 
-    0xF7, 0xF9, 0xFD, 0x01, 0x05, 0x09, 0x0C, 0x10, 0x14, 0x19, 0x1F, 0x24, 
-    0x29, 0x2E, 0x31, 0x31, 0x30, 0x2D, 0x2B, 0x2A, 0x27, 0x24, 0x21, 0x1C, 
-    0x17, 0x14, 0x14, 0x13, 0x12, 0x0F, 0x0F, 0x11, 0x16, 0x1D, 0x20, 0x21, 
-    0x20, 0x20, 0x21, 0x22, 0x22, 0x23, 0x26, 0x28, 0x29, 0x29, 0x2A, 0x2A, 
-    0x28, 0x25, 0x20, 0x1C, 0x1A, 0x1A, 0x19, 0x1A, 0x1B, 0x1A, 0x18, 0x16, 
-    0x15, 0x15, 0x13, 0x11, 0x0F, 0x10, 0x13, 0x18, 0x1C, 0x1E, 0x1D, 0x1E, 
-    0x1F, 0x1F, 0x1E, 0x1C, 0x1A, 0x1B, 0x1E, 0x20, 0x23, 0x25, 0x26, 0x27, 
-    0x29, 0x2C, 0x2E, 0x30, 0x31, 0x34, 0x37, 0x39, 0x38, 0x35, 0x34, 0x33, 
-    0x33, 0x31, 0x2D, 0x2D, 0x2E, 0x2F, 0x2E, 0x2C, 0x2A, 0x28, 0x27, 0x26, 
-    0x26, 0x25, 0x26, 0x26, 0x26, 0x27, 0x29, 0x2B, 0x2C, 0x2A, 0x26, 0x22, 
-    0x21, 0x20, 0x21, 0x20, 0x21, 0x22, 0x21, 0x1E, 0x1C, 0x1A, 0x17, 0x14, 
-    0x10, 0x0E, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x15, 0x17, 0x19, 0x19, 0x1A, 
-    0x19, 0x1A, 0x1C, 0x1D, 0x1E, 0x1D, 0x1E, 0x1F, 0x1E, 0x1D, 0x1A, 0x1B, 
-    0x1B, 0x1C, 0x1D, 0x1D, 0x1C, 0x1C, 0x1B, 0x19, 0x17, 0x17, 0x16, 0x16, 
-    0x16, 0x18, 0x18, 0x19, 0x17, 0x15, 0x10, 0x0A, 0x05, 0xFF, 0xF9, 0xF5, 
-    0xF5, 0xF8, 0xFC, 0xFF, 0x00, 0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xFD, 0xFF, 
-    0x01, 0x02, 0x03, 0x03, 0x02, 0x01, 0x00, 0xFD, 0xF8, 0xF2, 0xED, 0xEB, 
-    0xEC, 0xED, 0xEC, 0xEC, 0xEC, 0xED, 0xED, 0xED, 0xEE, 0xF0, 0xF3, 0xF5, 
-    0xF6, 0xF7, 0xF9, 0xFB, 0xFD, 0x00, 0x02, 0x06, 0x07, 0x06, 0x05, 0x06, 
-    0x09, 0x0B, 0x07, 0x01, 0xFB, 0xF8, 0xF7, 0xF6, 0xF4, 0xF2, 0xF0, 0xEF, 
-    0xEE, 0xEE, 0xEC, 0xEA, 0xE8, 0xE7, 0xE7, 0xE7, 0xE5, 0xE3, 0xE0, 0xDE, 
-    0xDD, 0xDD, 0xDB, 0xD8, 0xD4, 0xD1, 0xD1, 0xD0, 0xD1, 0xD5, 0xD8, 0xDB, 
-    0xDC, 0xDE, 0xDF, 0xDE, 0xDD, 0xDC, 0xDA, 0xDB, 0xDD, 0xE1, 0xE6, 0xEA, 
-    0xEB, 0xEC, 0xEC, 0xEB, 0xEA, 0xE6, 0xE3, 0xE3, 0xE5, 0xE8, 0xEA, 0xEB, 
-    0xEC, 0xED, 0xEE, 0xEE, 0xED, 0xEE, 0xF0, 0xF3, 0xF4, 0xF6, 0xF5, 0xF3, 
-    0xF1, 0xF0, 0xEE, 0xEC, 0xEA, 0xE8, 0xE6, 0xE8, 0xE9, 0xE9, 0xEA, 0xEA, 
-    0xEB, 0xEE, 0xF1, 0xF3, 0xF4, 0xF5, 0xF6, 0xF6, 0xF6, 0xF5, 0xF3, 0xEF, 
-    0xED, 0xEC, 0xED, 0xEC, 0xEB, 0xE9, 0xE9, 0xE9, 0xE9, 0xE6, 0xE2, 0xDD, 
-    0xD8, 0xD4, 0xD2, 0xD1, 0xD3, 0xD4, 0xD7, 0xD9, 0xDB, 0xDC, 0xDE, 0xDF, 
-    0xE0, 0xDE, 0xDC, 0xDC, 0xDE, 0xE1, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE9, 
-    0xEA, 0xE9, 0xEA, 0xEA, 0xEC, 0xF1, 0xF4, 0xF6, 0xF5, 0xF6, 0xF7, 0xF7, 
-    0xF7, 0xF6, 0xF5, 0xF6, 0xF9, 0xFA, 0xFA, 0xF9, 0xF7, 0xF6, 0xF6, 0xF5, 
-    0xF3, 0xF1, 0xF0, 0xEF, 0xEE, 0xEB, 0xE9, 0xE7, 0xE5, 0xE3, 0xE1, 0xE2, 
-    0xE5, 0xEA, 0xEE, 0xF2, 0xF4, 0xF6, 0xF6, 0xF5, 0xF2, 0xEE, 0xEB, 0xE8, 
-    0xE7, 0xE7, 0xE9, 0xEB, 0xED, 0xED, 0xEE, 0xF0, 0xF2, 0xF5, 0xF6, 0xF5, 
-    0xF5, 0xF7, 0xFA, 0xFD, 0xFF, 0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x03, 
-    0x04, 0x06, 0x05, 0x03, 0x00, 0xFD, 0xFB, 0xF8, 0xF5, 0xF4, 0xF4, 0xF7, 
-    0xFA, 0xFB, 0xFB, 0xFA, 0xFB, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0xFC, 0xFB, 
-    0xFC, 0xFB, 0xF9, 0xF7, 0xF4, 0xF2, 0xF0, 0xEE, 0xED, 0xEF, 0xF1, 0xF2, 
-    0xF0, 0xEE, 0xEE, 0xED, 0xEC, 0xEA, 0xE8, 0xE9, 0xEB, 0xEF, 0xF1, 0xF4, 
-    0xF8, 0xFB, 0xFB, 0xF9, 0xF6, 0xF4, 0xF3, 0xF4, 0xF6, 0xF8, 0xFB, 0xFE, 
-    0x02, 0x06, 0x08, 0x09, 0x08, 0x09, 0x0C, 0x11, 0x16, 0x1B, 0x20, 0x25, 
-    0x2A, 0x2C, 0x2C, 0x2C, 0x2B, 0x2B, 0x2A, 0x28, 0x25, 0x24, 0x25, 0x27, 
-    0x28, 0x28, 0x27, 0x27, 0x26, 0x25, 0x23, 0x21, 0x1F, 0x1B, 0x15, 0x10, 
-    0x0B, 0x09, 0x07, 0x06, 0x04, 0x04, 0x06, 0x08, 0x0B, 0x0C, 0x0D, 0x0E, 
-    0x0D, 0x0A, 0x07, 0x06, 0x05, 0x07, 0x0B, 0x0F, 0x14, 0x18, 0x19, 0x18, 
-    0x1A, 0x1B, 0x1B, 0x1C, 0x1A, 0x1A, 0x1D, 0x21, 0x24, 0x23, 0x20, 0x1C, 
-    0x1B, 0x19, 0x17, 0x15, 0x14, 0x16, 0x19, 0x1C, 0x1E, 0x1F, 0x20, 0x1F, 
-    0x20, 0x22, 0x25, 0x27, 0x28, 0x29, 0x2B, 0x2E, 0x30, 0x33, 0x34, 0x33, 
-    0x31, 0x30, 0x2F, 0x2F, 0x2E, 0x2C, 0x29, 0x26, 0x24, 0x22, 0x20, 0x1F, 
-    0x1E, 0x1E, 0x20, 0x22, 0x25, 0x27, 0x29, 0x28, 0x26, 0x24, 0x21, 0x1D, 
-    0x1A, 0x17, 0x15, 0x16, 0x18, 0x1A, 0x1C, 0x1C, 0x1D, 0x1C, 0x1C, 0x1B, 
-    0x1C, 0x1E, 0x22, 0x25, 0x27, 0x2A, 0x2E, 0x30, 0x30, 0x2E, 0x2C, 0x2A, 
-    0x29, 0x29, 0x29, 0x28, 0x29, 0x2B, 0x2B, 0x2A, 0x26, 0x21, 0x1C, 0x18, 
-    0x14, 0x13, 0x13, 0x14, 0x16, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x19, 0x14, 
-    0x10, 0x0D, 0x0B, 0x08, 0x03, 0xFB, 0xF3, 0xED, 0xE9, 0xE8, 0xE9, 0xE8, 
-    0xE9, 0xEB, 0xEC, 0xEF, 0xF0, 0xF0, 0xED, 0xEA, 0xE8, 0xE8, 0xE9, 0xEA, 
-    0xEA, 0xEC, 0xEF, 0xF1, 0xF2, 0xF2, 0xF3, 0xF4, 0xF6, 0xF7, 0xF8, 0xF9, 
-    0xFA, 0xFC, 0xFB, 0xF9, 0xF5, 0xF2, 0xF0, 0xF1, 0xF2, 0xF3, 0xF6, 0xF8, 
-    0xFC, 0x00, 0x02, 0x03, 0x02, 0xFF, 0xFC, 0xF7, 0xF1, 0xEE, 0xEC, 0xEE, 
-    0xF0, 0xF2, 0xF4, 0xF6, 0xF9, 0xFA, 0xF9, 0xF8, 0xF7, 0xF6, 0xF7, 0xF8, 
-    0xF7, 0xF5, 0xF3, 0xF2, 0xF1, 0xEE, 0xEB, 0xE9, 0xE7, 0xE6, 0xE5, 0xE4, 
-    0xE2, 0xDD, 0xDA, 0xD6, 0xD1, 0xCD, 0xCA, 0xC9, 0xCA, 0xCE, 0xD1, 0xD3, 
-    0xD4, 0xD3, 0xD4, 0xD6, 0xD8, 0xDA, 0xDB, 0xDD, 0xE1, 0xE5, 0xE8, 0xE9, 
-    0xE8, 0xE7, 0xE5, 0xE5, 0xE4, 0xE5, 0xE8, 0xEB, 0xEF, 0xF2, 0xF6, 0xFA, 
-    0xFD, 0xFD, 0xFA, 0xF7, 0xF6, 0xF7, 0xF6, 0xF4, 0xF3, 0xF2, 0xF3, 0xF3, 
-    0xF2, 0xF1, 0xF0, 0xEE, 0xEB, 0xE8, 0xE6, 0xE4, 0xE3, 0xDF, 0xDB, 0xD6, 
-    0xD3, 0xD1, 0xD1, 0xD2, 0xD5, 0xD9, 0xDB, 0xDD, 0xDE, 0xE0, 0xE1, 0xE3, 
-    0xE5, 0xE6, 0xE7, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEA, 0xEB, 0xEC, 0xEC, 
-    0xEC, 0xED, 0xEF, 0xF0, 0xF3, 0xF6, 0xF8, 0xF9, 0xF9, 0xF8, 0xF7, 0xF5, 
-    0xF3, 0xF1, 0xEF, 0xEF, 0xEE, 0xEF, 0xF0, 0xF1, 0xF0, 0xEE, 0xEB, 0xE9, 
-    0xE6, 0xE3, 0xE1, 0xE0, 0xE1, 0xE5, 0xE8, 0xEB, 0xED, 0xEE, 0xEE, 0xED, 
-    0xED, 0xEB, 0xE9, 0xE8, 0xE7, 0xE8, 0xE9, 0xE8, 0xE6, 0xE3, 0xE0, 0xDF, 
-    0xE0, 0xDF, 0xE0, 0xE1, 0xE2, 0xE5, 0xE6, 0xE6, 0xE6, 0xE6, 0xE7, 0xE9, 
-    0xEC, 0xEF, 0xF2, 0xF4, 0xF5, 0xF5, 0xF4, 0xF4, 0xF5, 0xF5, 0xF3, 0xF2, 
-    0xF3, 0xF7, 0xFB, 0xFD, 0xFC, 0xFA, 0xF9, 0xF8, 0xF7, 0xF6, 0xF7, 0xF8, 
-    0xFC, 0x01, 0x06, 0x0D, 0x12, 0x16, 0x19, 0x19, 0x17, 0x12, 0x0E, 0x0B, 
-    0x09, 0x09, 0x07, 0x05, 0x02, 0xFF, 0xFB, 0xF7, 0xF4, 0xF1, 0xF0, 0xF1, 
-    0xF5, 0xF7, 0xF9, 0xF9, 0xF7, 0xF2, 0xEE, 0xEB, 0xE9, 0xEA, 0xEA, 0xE9, 
-    0xEA, 0xEB, 0xEA, 0xE9, 0xE8, 0xE9, 0xE8, 0xE9, 0xEA, 0xED, 0xF0, 0xF2, 
-    0xF3, 0xF4, 0xF5, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFD, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xFE, 0xFA, 0xF6, 0xF5, 0xF6, 0xF8, 0xFA, 0xFC, 0xFF, 
-    0x02, 0x04, 0x05, 0x04, 0x05, 0x06, 0x07, 0x07, 0x09, 0x0C, 0x10, 0x13, 
-    0x16, 0x18, 0x17, 0x17, 0x16, 0x14, 0x12, 0x11, 0x12, 0x12, 0x13, 0x15, 
-    0x17, 0x17, 0x16, 0x14, 0x12, 0x11, 0x12, 0x15, 0x18, 0x1B, 0x1D, 0x1E, 
-    0x1F, 0x21, 0x22, 0x22, 0x20, 0x1C, 0x1B, 0x1A, 0x1B, 0x1A, 0x19, 0x18, 
-    0x16, 0x15, 0x16, 0x15, 0x16, 0x16, 0x19, 0x1D, 0x21, 0x24, 0x25, 0x25, 
-    0x22, 0x1F, 0x1E, 0x21, 0x25, 0x28, 0x2A, 0x2C, 0x2D, 0x2D, 0x2C, 0x29, 
-    0x25, 0x22, 0x1F, 0x1D, 0x1C, 0x1D, 0x1E, 0x20, 0x22, 0x23, 0x22, 0x20, 
-    0x1E, 0x1D, 0x1E, 0x1E, 0x1D, 0x1C, 0x1A, 0x18, 0x16, 0x15, 0x12, 0x0D, 
-    0x09, 0x07, 0x08, 0x0B, 0x0E, 0x10, 0x10, 0x11, 0x13, 0x16, 0x1A, 0x1D, 
-    0x1F, 0x1E, 0x1E, 0x20, 0x23, 0x24, 0x25, 0x26, 0x27, 0x2A, 0x2D, 0x2F, 
-    0x30, 0x30, 0x2F, 0x2E, 0x2D, 0x2B, 0x28, 0x24, 0x20, 0x1C, 0x1C, 0x1E, 
-    0x21, 0x24, 0x28, 0x2C, 0x31, 0x34, 0x35, 0x34, 0x34, 0x32, 0x31, 0x2E, 
-    0x2C, 0x2A, 0x2B, 0x2B, 0x2C, 0x2B, 0x29, 0x26, 0x21, 0x1C, 0x18, 0x15, 
-    0x15, 0x14, 0x15, 0x14, 0x14, 0x14, 0x13, 0x0F, 0x0B, 0x07, 0x05, 0x06, 
-    0x06, 0x05, 0x03, 0x02, 0x00, 0xFD, 0xFB, 0xF8, 0xF6, 0xF5, 0xF5, 0xF5, 
-    0xF7, 0xF9, 0xFA, 0xFB, 0xFB, 0xFA, 0xFB, 0xFC, 0xFC, 0xFC, 0xFD, 0xFF, 
-    0x01, 0x03, 0x02, 0x00, 0xFD, 0xFA, 0xF7, 0xF4, 0xF4, 0xF6, 0xFA, 0xFD, 
-    0xFE, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xF9, 0xF6, 0xF3, 0xF3, 0xF5, 0xF7, 
-    0xF9, 0xFA, 0xF9, 0xFA, 0xF9, 0xF9, 0xF6, 0xF4, 0xF0, 0xED, 0xEC, 0xEB, 
-    0xEA, 0xE9, 0xE7, 0xE3, 0xDF, 0xDA, 0xD8, 0xD9, 0xDB, 0xDE, 0xE2, 0xE5, 
-    0xE8, 0xEC, 0xEF, 0xF2, 0xF4, 0xF5, 0xF5, 0xF3, 0xF1, 0xF0, 0xEF, 0xEE, 
-    0xED, 0xEC, 0xEB, 0xEC, 0xED, 0xEE, 0xEE, 0xEF, 0xF1, 0xF2, 0xF1, 0xF0, 
-    0xEE, 0xEB, 0xE7, 0xE5, 0xE6, 0xE7, 0xEA, 0xEC, 0xED, 0xEF, 0xF0, 0xF0, 
-    0xED, 0xEB, 0xE8, 0xE5, 0xE4, 0xE3, 0xE5, 0xE7, 0xE9, 0xE9, 0xE8, 0xE7, 
-    0xE6, 0xE6, 0xE6, 0xE5, 0xE4, 0xE5, 0xE6, 0xE7, 0xE6, 0xE4, 0xE2, 0xE0, 
-    0xDD, 0xD9, 0xD7, 0xD6, 0xD5, 0xD4, 0xD3, 0xD4, 0xD7, 0xDA, 0xDB, 0xDB, 
-    0xD9, 0xD7, 0xD6, 0xD6, 0xD5, 0xD4, 0xD6, 0xD9, 0xDD, 0xE1, 0xE5, 0xE8, 
-    0xEA, 0xED, 0xEF, 0xF1, 0xF4, 0xF7, 0xFA, 0xFB, 0xFA, 0xF8, 0xF6, 0xF3, 
-    0xF2, 0xF4, 0xF7, 0xFA, 0xFD, 0x00, 0x03, 0x06, 0x07, 0x06, 0x05, 0x03, 
-    0x04, 0x02, 0x01, 0x00, 0xFF, 0xFF, 0xFB, 0xF5, 0xF0, 0xEF, 0xED, 0xE9, 
-    0xE6, 0xE1, 0xE5, 0xE8, 0xE9, 0xEE, 0xF1, 0xF5, 0xF5, 0xEF, 0xF1, 0xED, 
-    0xF1, 0xED, 0xED, 0xF0, 0xD6, 0xDA, 0xCC, 0xBA, 0xC7, 0xC6, 0xCF, 0xDC, 
-    0xE0, 0xD9, 0xEC, 0xEB, 0xE0, 0xEC, 0xEC, 0xF6, 0xED, 0xF4, 0xFB, 0xF2, 
-    0x05, 0x08, 0x1B, 0x2F, 0x19, 0x09, 0x08, 0x10, 0x10, 0x0D, 0x09, 0xFD, 
-    0xFC, 0xF7, 0xF3, 0xF0, 0xEE, 0xEC, 0xED, 0xF3, 0xF2, 0xF5, 0xF1, 0xEC, 
-    0xE6, 0xF0, 0xE7, 0xDA, 0xCB, 0xBE, 0xCF, 0xD6, 0xE1, 0xF2, 0xFA, 0xFE, 
-    0xFF, 0xF9, 0xFB, 0xF3, 0xF0, 0xF2, 0xEF, 0xEE, 0xF4, 0xF7, 0xFE, 0x07, 
-    0x08, 0x09, 0x08, 0x01, 0x08, 0x0B, 0x0D, 0x0A, 0x08, 0x13, 0x09, 0x0A, 
-    0x07, 0x08, 0x05, 0x07, 0x0A, 0x10, 0x13, 0x08, 0x10, 0x10, 0x0F, 0x12, 
-    0x0B, 0x00, 0xFB, 0xF5, 0xF0, 0xF5, 0xF7, 0xF8, 0xFD, 0xFD, 0x06, 0x05, 
-    0x03, 0x00, 0xFC, 0xF9, 0xFB, 0x00, 0x07, 0x12, 0x19, 0x23, 0x21, 0x28, 
-    0x1B, 0x15, 0x0E, 0x01, 0xFC, 0xF6, 0xFA, 0xFC, 0xFF, 0x02, 0x02, 0xFE, 
-    0x00, 0xF7, 0xEE, 0xDB, 0xD1, 0xD4, 0xE1, 0xF4, 0x02, 0x0B, 0x0F, 0x18, 
-    0x14, 0x13, 0x0C, 0x04, 0x06, 0x01, 0x04, 0x0B, 0x11, 0x1A, 0x1F, 0x29, 
-    0x2C, 0x2F, 0x2D, 0x2D, 0x24, 0x1A, 0x17, 0x13, 0x18, 0x15, 0x1F, 0x21, 
-    0x23, 0x27, 0x18, 0x0E, 0x0E, 0x11, 0x1C, 0x1B, 0x28, 0x2B, 0x2D, 0x37, 
-    0x35, 0x35, 0x29, 0x21, 0x16, 0x18, 0x14, 0x12, 0x13, 0x13, 0x17, 0x17, 
-    0x17, 0x1C, 0x1C, 0x17, 0x16, 0x10, 0x0C, 0x0A, 0x0B, 0x0E, 0x07, 0x01, 
-    0x02, 0xFC, 0xF2, 0xDA, 0xC1, 0xC0, 0xD0, 0xE6, 0xF2, 0xF5, 0xFB, 0xFC, 
-    0xFF, 0xF9, 0xEF, 0xE8, 0xE3, 0xE7, 0xEA, 0xEF, 0xE7, 0xF0, 0xFB, 0xFB, 
-    0xFF, 0x01, 0x02, 0x04, 0x0E, 0x0A, 0x0C, 0x0B, 0x0E, 0x12, 0x10, 0x13, 
-    0x17, 0x15, 0x10, 0x13, 0x07, 0x06, 0x00, 0x0B, 0x0C, 0xFD, 0xF5, 0xFA, 
-    0x0E, 0x09, 0xFF, 0xEF, 0xF0, 0xF1, 0xF4, 0xF6, 0x01, 0xF0, 0xE7, 0xFC, 
-    0xF4, 0xFA, 0x07, 0x10, 0x1A, 0x0B, 0xFD, 0xF5, 0xE6, 0xE0, 0xE0, 0xE6, 
-    0xF1, 0xF7, 0xF8, 0xFA, 0xEB, 0xE8, 0xE2, 0xE4, 0xE6, 0xEA, 0xEF, 0xF1, 
-    0xF8, 0xF6, 0xF7, 0xF0, 0xE9, 0xD8, 0xD6, 0xD8, 0xDC, 0xE9, 0xE5, 0xDF, 
-    0xED, 0xFB, 0xFF, 0x06, 0x00, 0xFB, 0xEE, 0xE1, 0xE3, 0xEE, 0xEE, 0xE9, 
-    0xF5, 0xFF, 0x05, 0xFF, 0x05, 0xF7, 0xF3, 0xF1, 0xED, 0xF9, 0x00, 0x12, 
-    0x08, 0x06, 0x05, 0xFF, 0xF6, 0xF1, 0xF1, 0xEE, 0xEA, 0xEF, 0xF4, 0xF0, 
-    0xFD, 0x02, 0xF9, 0xF3, 0x00, 0x04, 0xED, 0xE3, 0xDD, 0xDA, 0xDF, 0xE3, 
-    0xF5, 0xF8, 0xF3, 0xF2, 0xE7, 0xDD, 0xDA, 0xD2, 0xD3, 0xE2, 0xE9, 0xEC, 
-    0xF5, 0x0F, 0x13, 0x09, 0x04, 0xFE, 0x01, 0xFB, 0xF7, 0xF5, 0xF6, 0xFC, 
-    0x0A, 0x10, 0x0D, 0x08, 0x05, 0x04, 0xFC, 0xFD, 0xFB, 0x01, 0x03, 0x10, 
-    0x1D, 0x28, 0x26, 0x21, 0x24, 0x18, 0x16, 0x1A, 0x26, 0x28, 0x28, 0x27, 
-    0x28, 0x3B, 0x41, 0x26, 0x17, 0x06, 0xFF, 0xF3, 0xF2, 0xFF, 0xFF, 0xFE, 
-    0xFF, 0x03, 0xF6, 0xF7, 0xFF, 0x04, 0xFB, 0xFE, 0xFD, 0xF7, 0xF8, 0x01, 
-    0x0F, 0x17, 0x12, 0x0E, 0x0E, 0xFF, 0x02, 0x03, 0xFF, 0x08, 0x0E, 0x05, 
-    0x0F, 0x16, 0x12, 0x12, 0x11, 0x0C, 0x07, 0x02, 0x0B, 0x0E, 0x01, 0x00, 
-    0x0A, 0x13, 0x16, 0x12, 0x13, 0x1E, 0x18, 0x18, 0x0C, 0x0A, 0x0C, 0x0B, 
-    0x13, 0x13, 0x13, 0x18, 0x18, 0x13, 0x0B, 0xFD, 0x08, 0x0A, 0x0C, 0x1B, 
-    0x19, 0x20, 0x26, 0x2A, 0x2A, 0x23, 0x18, 0x0A, 0x0B, 0xFE, 0xFC, 0xF2, 
-    0xEE, 0xF6, 0xFC, 0xFF, 0x03, 0x09, 0x02, 0x00, 0xF7, 0xF3, 0xEA, 0xFF, 
-    0x08, 0x0D, 0x1B, 0x0E, 0x0E, 0x07, 0xFA, 0xF4, 0xF6, 0xF4, 0xE7, 0xE2, 
-    0xE9, 0xF9, 0x13, 0x1C, 0x21, 0x24, 0x19, 0x0B, 0x03, 0xFA, 0xF5, 0xFB, 
-    0xFE, 0x09, 0x0E, 0x11, 0x21, 0x1E, 0x20, 0x1B, 0x15, 0x0B, 0xFF, 0xFC, 
-    0x02, 0x04, 0x09, 0x0D, 0xFC, 0xFF, 0xF7, 0xE7, 0xDF, 0xE0, 0xE3, 0xE5, 
-    0xEE, 0xF0, 0xE8, 0xFA, 0x02, 0xF9, 0xF2, 0xD4, 0xCC, 0xC8, 0xC5, 0xCD, 
-    0xCE, 0xD4, 0xE3, 0xED, 0xE9, 0xDD, 0xE0, 0xDB, 0xDE, 0xDD, 0xD8, 0xD3, 
-    0xD4, 0xDF, 0xE4, 0xEF, 0xF0, 0xF3, 0xE9, 0xE8, 0xE9, 0xEA, 0xEA, 0xE0, 
-    0xEE, 0xF5, 0xFF, 0x0E, 0x0A, 0x08, 0xFA, 0xF9, 0xF5, 0xED, 0xF3, 0xF5, 
-    0xFD, 0x01, 0x08, 0x10, 0x1C, 0x1D, 0x15, 0x14, 0x12, 0x07, 0x02, 0x02, 
-    0x06, 0x09, 0x0C, 0x15, 0x0C, 0x07, 0x02, 0xF9, 0xF5, 0xF7, 0xF8, 0xF5, 
-    0xEE, 0xF1, 0xF7, 0xF7, 0xF8, 0xF8, 0xF8, 0xF2, 0xE6, 0xD6, 0xCB, 0xD2, 
-    0xDD, 0xE2, 0xE7, 0xE9, 0xF6, 0xF1, 0xF5, 0x03, 0x06, 0x02, 0xFC, 0xF9, 
-    0xF1, 0xE9, 0xEB, 0xF5, 0xF4, 0xF4, 0xEE, 0xF5, 0xF1, 0xF3, 0xFC, 0xF8, 
-    0xFA, 0xF0, 0xF3, 0xFA, 0xF9, 0xFB, 0xFF, 0x02, 0x01, 0xFC, 0xF4, 0xF3, 
-    0xED, 0xF6, 0x04, 0x06, 0x16, 0x1B, 0x21, 0x26, 0x2B, 0x33, 0x37, 0x35, 
-    0x2F, 0x29, 0x25, 0x25, 0x25, 0x1B, 0x13, 0x0D, 0x05, 0xFE, 0xFE, 0x00, 
-    0xF5, 0xF1, 0xF2, 0xF7, 0x01, 0x0F, 0x0F, 0x0A, 0x03, 0x08, 0x09, 0x0A, 
-    0x03, 0xFF, 0xFD, 0x02, 0x15, 0x1B, 0x1B, 0x14, 0x19, 0x1C, 0x14, 0x11, 
-    0x07, 0x01, 0x04, 0x0F, 0x16, 0x12, 0x1A, 0x14, 0x08, 0x03, 0x0C, 0x07, 
-    0x00, 0x02, 0x00, 0x11, 0x12, 0x16, 0x1F, 0x27, 0x28, 0x1E, 0x14, 0xFE, 
-    0xFF, 0x09, 0x0D, 0x0F, 0x0F, 0x22, 0x1D, 0x1F, 0x20, 0x1B, 0x1B, 0x0C, 
-    0x0D, 0x09, 0xFF, 0x0E, 0x0F, 0x12, 0x18, 0x0A, 0x06, 0x05, 0x05, 0xF9, 
-    0xF5, 0xF3, 0xF1, 0xF0, 0xF1, 0xF1, 0xF0, 0xEC, 0xEB, 0xE6, 0xDD, 0xE7, 
-    0xDF, 0xE5, 0xEB, 0xEF, 0xFB, 0x09, 0x15, 0x17, 0x16, 0x15, 0x1B, 0x13, 
-    0x10, 0x0C, 0x0B, 0x0E, 0x11, 0x10, 0x0E, 0x0B, 0x01, 0x03, 0x02, 0x00, 
-    0x04, 0x08, 0x0E, 0x11, 0x13, 0x1B, 0x1D, 0x1E, 0x11, 0x0A, 0xFD, 0xF3, 
-    0xF9, 0xF2, 0xF4, 0xF2, 0xF6, 0xF6, 0xFB, 0xF8, 0xF2, 0xFC, 0xFD, 0xFE, 
-    0xF3, 0xEF, 0xF0, 0xF0, 0xF2, 0xFC, 0xF3, 0xED, 0xEC, 0xE6, 0xE8, 0xE2, 
-    0xE8, 0xE6, 0xE7, 0xE5, 0xE6, 0xF0, 0xF1, 0xF3, 0xEE, 0xE9, 0xE2, 0xE1, 
-    0xDB, 0xD5, 0xD7, 0xD1, 0xD8, 0xE3, 0xE3, 0xEB, 0xEE, 0xF1, 0xF8, 0xFA, 
-    0xF9, 0xF0, 0xE8, 0xE7, 0xEC, 0xF6, 0xFA, 0xF1, 0xEC, 0xEA, 0xEE, 0xF7, 
-    0xF6, 0xEE, 0xE2, 0xE6, 0xE7, 0xEC, 0xF1, 0xF7, 0x00, 0xFF, 0xFE, 0x01, 
-    0x04, 0x05, 0x06, 0x04, 0x03, 0x03, 0x07, 0x08, 0x0A, 0x07, 0x09, 0x09, 
-    0x06, 0xFA, 0xF5, 0xF8, 0xF2, 0xF2, 0xF1, 0xF9, 0xFF, 0xFE, 0xF6, 0xF2, 
-    0xED, 0xF4, 0xF9, 0xF0, 0xF3, 0xEC, 0xF1, 0xFC, 0x00, 0xFE, 0xF8, 0xF0, 
-    0xE4, 0xE3, 0xE6, 0xE8, 0xEF, 0xF2, 0xF3, 0xFB, 0x02, 0x0C, 0x0C, 0x0B, 
-    0x0B, 0x05, 0xF9, 0xF5, 0xFD, 0xFB, 0x08, 0x13, 0x13, 0x0D, 0x0B, 0x0B, 
-    0x0B, 0x0B, 0x0F, 0x11, 0x0B, 0x0F, 0x14, 0x25, 0x28, 0x2A, 0x2C, 0x26, 
-    0x21, 0x18, 0x11, 0x0B, 0x04, 0x06, 0x0B, 0x0A, 0x0B, 0x07, 0x09, 0x06, 
-    0xFB, 0xEC, 0xE5, 0xDF, 0xDB, 0xE0, 0xEE, 0xF0, 0xF3, 0xF4, 0xF0, 0xF3, 
-    0xF8, 0xFF, 0x00, 0x00, 0xFE, 0x04, 0x07, 0x11, 0x18, 0x16, 0x19, 0x18, 
-    0x0F, 0x0B, 0x06, 0x08, 0x0A, 0x0A, 0x0E, 0x0D, 0x14, 0x1C, 0x1D, 0x1F, 
-    0x22, 0x1E, 0x22, 0x20, 0x1B, 0x25, 0x2A, 0x27, 0x25, 0x20, 0x17, 0x10, 
-    0x0D, 0x0F, 0x14, 0x13, 0x14, 0x19, 0x1D, 0x28, 0x2A, 0x2C, 0x2A, 0x20, 
-    0x1B, 0x15, 0x0A, 0x04, 0x08, 0x0E, 0x13, 0x10, 0x13, 0x16, 0x18, 0x1B, 
-    0x12, 0x08, 0x00, 0xFA, 0xFA, 0xFD, 0xFF, 0x01, 0xF9, 0xF4, 0xEF, 0xEB, 
-    0xEA, 0xE5, 0xE8, 0xE5, 0xE5, 0xE7, 0xEE, 0xF7, 0xFD, 0x02, 0x06, 0x05, 
-    0x00, 0xFF, 0xFC, 0xFA, 0xF6, 0xF2, 0xF8, 0xFE, 0xFA, 0xF9, 0xFC, 0x02, 
-    0xFF, 0xFC, 0xF9, 0xF1, 0xEE, 0xE6, 0xF0, 0xF9, 0xFD, 0xFE, 0xFC, 0xFB, 
-    0xFC, 0xFC, 0xFC, 0xFF, 0xFA, 0xF7, 0xF5, 0xF5, 0xFD, 0xFF, 0xFA, 0xF7, 
-    0xED, 0xE9, 0xE7, 0xEC, 0xE9, 0xE4, 0xE7, 0xED, 0xF3, 0xFB, 0x06, 0x03, 
-    0x07, 0x07, 0x02, 0xFF, 0xF5, 0xF2, 0xF1, 0xF1, 0xF6, 0xF5, 0xF1, 0xEB, 
-    0xE3, 0xDE, 0xE8, 0xF1, 0xF1, 0xF3, 0xF3, 0xF2, 0xF7, 0xFF, 0x05, 0x05, 
-    0xFD, 0xF3, 0xEC, 0xED, 0xE9, 0xEB, 0xEC, 0xF0, 0xF7, 0xFD, 0x06, 0x0C, 
-    0x0E, 0x07, 0x01, 0xF2, 0xED, 0xEB, 0xEC, 0xF6, 0xFA, 0xFE, 0xF7, 0xF1, 
-    0xF4, 0xF5, 0xF3, 0xF4, 0xF3, 0xEF, 0xED, 0xF2, 0xF7, 0xF9, 0xFB, 0xF8, 
-    0xF3, 0xEF, 0xEA, 0xE0, 0xDA, 0xD6, 0xD4, 0xD6, 0xD9, 0xDF, 0xE3, 0xE5, 
-    0xE9, 0xE9, 0xEA, 0xE9, 0xE7, 0xE3, 0xE7, 0xEE, 0xF4, 0xFB, 0xFE, 0xFC, 
-    0xF9, 0xFA, 0xF9, 0xFC, 0x03, 0x05, 0x06, 0x04, 0x02, 0x0A, 0x10, 0x14, 
-    0x13, 0x10, 0x0C, 0x0B, 0x0B, 0x0C, 0x0C, 0x0E, 0x10, 0x12, 0x19, 0x1E, 
-    0x22, 0x1D, 0x19, 0x18, 0x15, 0x1B, 0x21, 0x25, 0x27, 0x2A, 0x2C, 0x24, 
-    0x1F, 0x1B, 0x18, 0x15, 0x15, 0x17, 0x11, 0x0C, 0x0A, 0x01, 0xFB, 0xFC, 
-    0xF8, 0xF6, 0xF0, 0xEC, 0xEA, 0xE5, 0xED, 0xF4, 0xFA, 0xFC, 0xFF, 0x02, 
-    0x01, 0x07, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x05, 0x09, 0x0F, 0x15, 0x11, 
-    0x0F, 0x09, 0x07, 0x02, 0x02, 0x08, 0x0A, 0x03, 0x00, 0xFF, 0x00, 0x00, 
-    0x02, 0x03, 0x01, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0x0E, 0x17, 0x1B, 
-    0x1E, 0x20, 0x22, 0x24, 0x27, 0x26, 0x21, 0x24, 0x2D, 0x2A, 0x28, 0x27, 
-    0x1F, 0x17, 0x13, 0x13, 0x17, 0x17, 0x18, 0x17, 0x15, 0x16, 0x15, 0x15, 
-    0x1B, 0x1B, 0x16, 0x0E, 0x07, 0xFE, 0xF5, 0xF3, 0xF3, 0xF1, 0xF1, 0xF4, 
-    0xF5, 0xF5, 0xF3, 0xF4, 0xEE, 0xEE, 0xF2, 0xEF, 0xF1, 0xF9, 0xFC, 0x00, 
-    0x01, 0x01, 0xFE, 0xFD, 0xFE, 0x05, 0x0C, 0x0C, 0x0C, 0x0A, 0x0D, 0x13, 
-    0x15, 0x10, 0x11, 0x12, 0x0A, 0x06, 0x00, 0xF3, 0xF4, 0xF9, 0x00, 0x05, 
-    0x03, 0x00, 0xFA, 0xFA, 0xF8, 0xF1, 0xEC, 0xE8, 0xEC, 0xF3, 0xF7, 0xF9, 
-    0xF7, 0xF1, 0xEA, 0xE6, 0xE0, 0xE1, 0xE0, 0xE0, 0xDC, 0xD7, 0xD9, 0xDA, 
-    0xE4, 0xEA, 0xEC, 0xED, 0xE9, 0xE7, 0xE5, 0xE4, 0xE7, 0xEA, 0xF1, 0xF6, 
-    0xF8, 0xF9, 0xFD, 0xFC, 0xFB, 0xF9, 0xF4, 0xEF, 0xF5, 0xFA, 0xFD, 0x01, 
-    0xFF, 0xFC, 0xF5, 0xEF, 0xED, 0xEE, 0xF3, 0xFB, 0xFC, 0xFB, 0xF7, 0xF5, 
-    0xFF, 0x01, 0x05, 0x04, 0xFC, 0xF8, 0xF7, 0xF3, 0xF0, 0xF4, 0xF4, 0xF5, 
-    0xF7, 0xFE, 0xFD, 0xFD, 0xFC, 0xF6, 0xF5, 0xF7, 0xF9, 0xFA, 0x03, 0x09, 
-    0x06, 0x00, 0xFD, 0xF8, 0xF9, 0xFE, 0x01, 0x03, 0x01, 0xFD, 0xF8, 0xF5, 
-    0xF2, 0xF2, 0xF4, 0xF1, 0xEF, 0xE8, 0xE8, 0xEB, 0xE9, 0xEF, 0xF0, 0xF5, 
-    0xF6, 0xF6, 0xF9, 0xFA, 0xFA, 0xF8, 0xF5, 0xF5, 0xF5, 0xF7, 0x00, 0x01, 
-    0x00, 0xFB, 0xF8, 0xEF, 0xEA, 0xEC, 0xF1, 0xFC, 0x04, 0x06, 0x08, 0x0A, 
-    0x09, 0x11, 0x19, 0x1E, 0x20, 0x1B, 0x1A, 0x19, 0x17, 0x16, 0x19, 0x1C, 
-    0x1D, 0x1F, 0x1F, 0x21, 0x21, 0x1E, 0x1B, 0x16, 0x13, 0x12, 0x10, 0x10, 
-    0x0E, 0x0B, 0x06, 0xFD, 0xF9, 0xF8, 0xF9, 0xFB, 0x00, 0xFE, 0xF7, 0xF4, 
-    0xF5, 0xF9, 0x00, 0x05, 0x02, 0x03, 0x03, 0x02, 0x07, 0x07, 0x09, 0x0F, 
-    0x0E, 0x10, 0x11, 0x14, 0x17, 0x1B, 0x1A, 0x14, 0x14, 0x14, 0x19, 0x1C, 
-    0x1D, 0x1E, 0x17, 0x11, 0x0E, 0x0A, 0x07, 0x09, 0x10, 0x13, 0x14, 0x11, 
-    0x11, 0x12, 0x16, 0x15, 0x17, 0x15, 0x10, 0x12, 0x0A, 0x06, 0x04, 0x03, 
-    0x09, 0x0B, 0x0A, 0x09, 0x0B, 0x0D, 0x0A, 0x02, 0xFF, 0xFE, 0x02, 0x07, 
-    0x05, 0x04, 0xFD, 0xF5, 0xF2, 0xF0, 0xEE, 0xF0, 0xEF, 0xF1, 0xF2, 0xEF, 
-    0xF2, 0xF1, 0xF2, 0xF3, 0xF3, 0xF7, 0xF9, 0xF6, 0xF1, 0xED, 0xEE, 0xF0, 
-    0xF9, 0x01, 0x07, 0x0A, 0x0D, 0x0F, 0x10, 0x11, 0x11, 0x11, 0x10, 0x14, 
-    0x1A, 0x1B, 0x18, 0x15, 0x0F, 0x0C, 0x0A, 0x08, 0x0C, 0x12, 0x12, 0x0D, 
-    0x0A, 0x07, 0x04, 0x02, 0xFE, 0xFB, 0xF8, 0xF4, 0xEF, 0xEA, 0xE7, 0xE7, 
-    0xE7, 0xEB, 0xE9, 0xEB, 0xEE, 0xED, 0xEF, 0xF1, 0xF1, 0xEE, 0xEB, 0xEA, 
-    0xEA, 0xE7, 0xE8, 0xE3, 0xDE, 0xDB, 0xE0, 0xE7, 0xE9, 0xF1, 0xF4, 0xF3, 
-    0xF1, 0xEF, 0xED, 0xEE, 0xF1, 0xF1, 0xF0, 0xEB, 0xEA, 0xE7, 0xE3, 0xE2, 
-    0xE2, 0xE2, 0xE3, 0xE2, 0xDF, 0xDF, 0xDD, 0xDE, 0xDE, 0xDE, 0xDE, 0xE4, 
-    0xEA, 0xEF, 0xF4, 0xF4, 0xF2, 0xF0, 0xEF, 0xED, 0xF1, 0xF6, 0xF8, 0xFB, 
-    0xFD, 0xFE, 0xFF, 0x01, 0x04, 0x05, 0x03, 0x04, 0x03, 0x05, 0x07, 0x07, 
-    0x09, 0x0D, 0x0C, 0x0B, 0x0C, 0x0A, 0x0A, 0x06, 0x02, 0xFD, 0xF9, 0xF9, 
-    0xFA, 0xFD, 0xFC, 0xFC, 0xFD, 0xFB, 0xF6, 0xF3, 0xF0, 0xF1, 0xF4, 0xF6, 
-    0xF8, 0xF5, 0xF1, 0xF1, 0xF5, 0xF8, 0xFB, 0xFE, 0x00, 0xFE, 0xFD, 0xFD, 
-    0x00, 0x05, 0x09, 0x0C, 0x0D, 0x09, 0x05, 0x03, 0x02, 0x00, 0x00, 0x02, 
-    0x06, 0x0D, 0x0F, 0x12, 0x11, 0x10, 0x0B, 0x06, 0x07, 0x0C, 0x10, 0x12, 
-    0x16, 0x11, 0x0E, 0x0D, 0x0D, 0x0F, 0x12, 0x10, 0x0C, 0x06, 0x00, 0xFC, 
-    0xFA, 0xFA, 0xFB, 0xF8, 0xF4, 0xF0, 0xED, 0xEC, 0xED, 0xEB, 0xE9, 0xEC, 
-    0xF0, 0xF4, 0xFA, 0xFD, 0xFD, 0xFD, 0xF9, 0xF9, 0xFB, 0x02, 0x0A, 0x12, 
-    0x18, 0x18, 0x16, 0x14, 0x12, 0x12, 0x14, 0x19, 0x1C, 0x1B, 0x19, 0x16, 
-    0x15, 0x18, 0x1A, 0x1D, 0x1E, 0x1E, 0x20, 0x20, 0x20, 0x1E, 0x1C, 0x1A, 
-    0x18, 0x18, 0x1C, 0x1D, 0x1A, 0x15, 0x0D, 0x07, 0x05, 0x08, 0x0C, 0x12, 
-    0x17, 0x19, 0x18, 0x17, 0x16, 0x1A, 0x1E, 0x22, 0x26, 0x24, 0x1F, 0x1B, 
-    0x16, 0x12, 0x0E, 0x09, 0x04, 0xFF, 0xFB, 0xF8, 0xF7, 0xF5, 0xF3, 0xF3, 
-    0xF5, 0xF6, 0xF8, 0xF8, 0xF7, 0xF2, 0xEA, 0xE4, 0xDF, 0xE0, 0xE2, 0xEA, 
-    0xED, 0xED, 0xEA, 0xE7, 0xE6, 0xE6, 0xE5, 0xE8, 0xEE, 0xF0, 0xF3, 0xF3, 
-    0xF0, 0xF2, 0xF5, 0xF8, 0xFA, 0xFC, 0xFF, 0x02, 0x05, 0x07, 0x07, 0x06, 
-    0x08, 0x0A, 0x0D, 0x0E, 0x0D, 0x09, 0x01, 0xF9, 0xF4, 0xF4, 0xF8, 0xFC, 
-    0xFE, 0xFB, 0xF8, 0xF7, 0xF5, 0xF3, 0xF0, 0xF0, 0xEF, 0xEB, 0xE9, 0xE7, 
-    0xE8, 0xEA, 0xED, 0xEF, 0xF0, 0xF2, 0xF3, 0xF2, 0xF1, 0xF0, 0xF2, 0xF1, 
-    0xF3, 0xF6, 0xFB, 0x00, 0x02, 0x01, 0xFD, 0xFA, 0xF7, 0xF5, 0xF5, 0xFA, 
-    0x00, 0x05, 0x06, 0x02, 0xFD, 0xF7, 0xF2, 0xEF, 0xF0, 0xEF, 0xED, 0xEA, 
-    0xE8, 0xE5, 0xE5, 0xE9, 0xEC, 0xED, 0xEB, 0xE9, 0xE9, 0xEE, 0xF1, 0xF4, 
-    0xF2, 0xF3, 0xF5, 0xF5, 0xF4, 0xF3, 0xF1, 0xEC, 0xE8, 0xE7, 0xEB, 0xF1, 
-    0xF9, 0xFD, 0xFD, 0xF9, 0xF4, 0xF2, 0xF0, 0xF2, 0xF3, 0xF1, 0xF2, 0xF3, 
-    0xF2, 0xF4, 0xF4, 0xF3, 0xF2, 0xF4, 0xF5, 0xF7, 0xF9, 0xFC, 0xFD, 0xFD, 
-    0xFF, 0x00, 0x03, 0x05, 0x02, 0xFD, 0xF9, 0xF7, 0xF8, 0xF8, 0xFA, 0xFB, 
-    0x00, 0x06, 0x09, 0x08, 0x04, 0x03, 0x01, 0x04, 0x08, 0x0B, 0x0F, 0x0F, 
-    0x0F, 0x11, 0x13, 0x13, 0x11, 0x0F, 0x0D, 0x0B, 0x0C, 0x0C, 0x0D, 0x0F, 
-    0x0F, 0x11, 0x15, 0x19, 0x1D, 0x1F, 0x20, 0x1F, 0x1B, 0x17, 0x15, 0x14, 
-    0x17, 0x18, 0x15, 0x10, 0x0A, 0x05, 0x02, 0x00, 0xFF, 0xFF, 0x01, 0x02, 
-    0x02, 0x01, 0xFF, 0xFE, 0xFF, 0x01, 0x01, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 
-    0xFA, 0xF8, 0xF7, 0xF7, 0xF6, 0xF6, 0xF7, 0xF6, 0xF4, 0xEF, 0xEF, 0xF7, 
-    0x01, 0x08, 0x0E, 0x11, 0x12, 0x0F, 0x0B, 0x08, 0x07, 0x08, 0x0D, 0x10, 
-    0x13, 0x13, 0x13, 0x16, 0x1C, 0x1F, 0x1E, 0x1E, 0x1D, 0x1D, 0x1E, 0x1E, 
-    0x1F, 0x1F, 0x21, 0x23, 0x27, 0x27, 0x26, 0x22, 0x1B, 0x15, 0x10, 0x0E, 
-    0x0F, 0x12, 0x15, 0x18, 0x17, 0x12, 0x0D, 0x08, 0x04, 0xFF, 0xFC, 0xFB, 
-    0xFA, 0xFA, 0xF8, 0xF6, 0xF3, 0xF2, 0xF2, 0xEE, 0xEC, 0xEB, 0xED, 0xEF, 
-    0xF2, 0xF4, 0xFA, 0xFD, 0xFF, 0x01, 0xFE, 0xFB, 0xF9, 0xF5, 0xF2, 0xF1, 
-    0xF5, 0xFA, 0xFE, 0x04, 0x06, 0x06, 0x05, 0x04, 0x02, 0x01, 0x00, 0x00, 
-    0x02, 0x01, 0x00, 0xFB, 0xF9, 0xF4, 0xF0, 0xEC, 0xE8, 0xE4, 0xE4, 0xE9, 
-    0xEB, 0xEB, 0xEB, 0xE8, 0xE5, 0xE8, 0xE5, 0xE3, 0xDF, 0xDB, 0xD8, 0xD7, 
-    0xDC, 0xE0, 0xE8, 0xEE, 0xF2, 0xF5, 0xF3, 0xF2, 0xF3, 0xF3, 0xF5, 0xF8, 
-    0xFD, 0xFE, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0xFD, 0xFC, 0xF8, 0xFD, 
-    0xFC, 0xF9, 0xFC, 0xF8, 0xF9, 0xFB, 0xFC, 0xFC, 0xF9, 0xF6, 0xF2, 0xEE, 
-    0xEF, 0xF0, 0xF3, 0xF8, 0xF9, 0xF8, 0xF6, 0xF1, 0xED, 0xEB, 0xE6, 0xE7, 
-    0xE9, 0xEA, 0xF3, 0xF5, 0xF8, 0xFD, 0x01, 0x04, 0x02, 0x03, 0x00, 0x01, 
-    0xFF, 0xFF, 0xFC, 0xFA, 0xFD, 0xFB, 0x00, 0x01, 0xFD, 0xFB, 0xF5, 0xF4, 
-    0xF6, 0xF6, 0xF8, 0xFD, 0x01, 0x02, 0x02, 0xFC, 0xFA, 0xF5, 0xF0, 0xEA, 
-    0xE8, 0xE6, 0xE7, 0xE7, 0xE7, 0xE9, 0xEB, 0xED, 0xEA, 0xEB, 0xE6, 0xE9, 
-    0xED, 0xEF, 0xF1, 0xF0, 0xF6, 0xF9, 0xFB, 0x01, 0x05, 0x03, 0x01, 0xFE, 
-    0xFE, 0x02, 0x07, 0x0D, 0x16, 0x1B, 0x1D, 0x1B, 0x18, 0x15, 0x12, 0x11, 
-    0x10, 0x11, 0x11, 0x0E, 0x10, 0x11, 0x12, 0x15, 0x14, 0x12, 0x0C, 0x0C, 
-    0x09, 0x0C, 0x0E, 0x0E, 0x12, 0x12, 0x11, 0x13, 0x12, 0x0D, 0x0B, 0x0A, 
-    0x09, 0x0D, 0x12, 0x16, 0x1C, 0x1A, 0x18, 0x12, 0x0C, 0x0A, 0x07, 0x08, 
-    0x0B, 0x0E, 0x0E, 0x16, 0x18, 0x18, 0x17, 0x11, 0x0D, 0x05, 0x02, 0xFF, 
-    0xFF, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x02, 0x01, 
-    0xFD, 0xFF, 0x01, 0x04, 0x09, 0x08, 0x09, 0x09, 0x06, 0x01, 0xFF, 0xFC, 
-    0xFD, 0xFF, 0x04, 0x0D, 0x12, 0x13, 0x14, 0x13, 0x11, 0x0C, 0x06, 0x02, 
-    0x05, 0x0B, 0x13, 0x15, 0x14, 0x14, 0x14, 0x11, 0x0C, 0x08, 0x09, 0x0C, 
-    0x0E, 0x10, 0x0F, 0x0C, 0x09, 0x0A, 0x0A, 0x07, 0x01, 0xFA, 0xF7, 0xF4, 
-    0xF3, 0xF3, 0xF3, 0xF4, 0xF3, 0xF8, 0xFA, 0xFD, 0xFD, 0xFA, 0xF7, 0xF3, 
-    0xF2, 0xF4, 0xF8, 0xF7, 0xFA, 0xFB, 0xFF, 0x01, 0x02, 0x02, 0xFF, 0xFF, 
-    0xF8, 0xF5, 0xF2, 0xF6, 0xFB, 0x03, 0x04, 0x06, 0x03, 0xFE, 0xFA, 0xF4, 
-    0xF0, 0xEC, 0xED, 0xEE, 0xF1, 0xEF, 0xED, 0xEA, 0xEA, 0xEA, 0xED, 0xED, 
-    0xED, 0xEE, 0xED, 0xF0, 0xED, 0xEF, 0xEF, 0xF2, 0xF4, 0xF6, 0xF8, 0xF4, 
-    0xF1, 0xEB, 0xE7, 0xE5, 0xE8, 0xEE, 0xF5, 0xF9, 0xF8, 0xF5, 0xEF, 0xEF, 
-    0xEE, 0xEA, 0xE8, 0xE9, 0xED, 0xF2, 0xF5, 0xF6, 0xF6, 0xF3, 0xF1, 0xEE, 
-    0xEA, 0xE7, 0xEA, 0xEC, 0xEF, 0xF0, 0xF4, 0xF8, 0xFC, 0xFD, 0xFA, 0xF7, 
-    0xF3, 0xF1, 0xF0, 0xF2, 0xF7, 0xFE, 0x06, 0x0B, 0x10, 0x0B, 0x04, 0xFD, 
-    0xF5, 0xF4, 0xF4, 0xF8, 0xFC, 0x02, 0x05, 0x05, 0x03, 0xFF, 0xFC, 0xF8, 
-    0xF6, 0xF4, 0xF5, 0xF8, 0xFB, 0xFD, 0x00, 0x03, 0x03, 0x04, 0x04, 0x00, 
-    0xFA, 0xF6, 0xF3, 0xF5, 0xF9, 0xFD, 0x01, 0x03, 0x04, 0x02, 0xFF, 0xFC, 
-    0xF7, 0xF2, 0xF2, 0xF2, 0xF7, 0xFC, 0x03, 0x08, 0x0A, 0x0B, 0x0C, 0x07, 
-    0x02, 0x01, 0x02, 0x05, 0x06, 0x05, 0x03, 0x04, 0x04, 0x06, 0x06, 0x02, 
-    0xFD, 0xF5, 0xF1, 0xF2, 0xF6, 0xFC, 0x01, 0x06, 0x09, 0x08, 0x04, 0xFD, 
-    0xF9, 0xF7, 0xF9, 0xFC, 0x01, 0x06, 0x0B, 0x10, 0x11, 0x11, 0x11, 0x10, 
-    0x0D, 0x0B, 0x0A, 0x0E, 0x12, 0x16, 0x19, 0x1C, 0x20, 0x21, 0x22, 0x1F, 
-    0x1A, 0x16, 0x12, 0x12, 0x13, 0x15, 0x17, 0x1B, 0x1E, 0x1F, 0x1C, 0x16, 
-    0x0D, 0x06, 0x01, 0xFD, 0xFF, 0x04, 0x0B, 0x11, 0x14, 0x11, 0x0D, 0x09, 
-    0x03, 0xFF, 0xFB, 0xFA, 0xFF, 0x07, 0x0F, 0x15, 0x19, 0x19, 0x18, 0x14, 
-    0x11, 0x0D, 0x0C, 0x0D, 0x0E, 0x11, 0x14, 0x19, 0x18, 0x15, 0x10, 0x0B, 
-    0x06, 0x02, 0x02, 0x04, 0x07, 0x0A, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x08, 
-    0x03, 0xFE, 0xFB, 0xFA, 0xFA, 0xF8, 0xF4, 0xF2, 0xF2, 0xF3, 0xF4, 0xF5, 
-    0xF2, 0xEF, 0xEA, 0xEA, 0xEB, 0xEC, 0xEF, 0xF3, 0xF8, 0xFE, 0x00, 0xFF, 
-    0xFA, 0xF6, 0xF3, 0xF2, 0xF2, 0xF4, 0xF9, 0xFE, 0x03, 0x07, 0x09, 0x08, 
-    0x06, 0x01, 0xFC, 0xF9, 0xF7, 0xF7, 0xF8, 0xF8, 0xFA, 0xFB, 0xFC, 0xF9, 
-    0xF5, 0xF0, 0xEB, 0xE6, 0xE1, 0xE1, 0xE5, 0xEC, 0xF1, 0xF3, 0xF4, 0xF1, 
-    0xED, 0xEA, 0xE8, 0xE7, 0xE7, 0xE9, 0xEE, 0xF4, 0xF9, 0xFC, 0xFC, 0xFB, 
-    0xF9, 0xFA, 0xF9, 0xF8, 0xFB, 0xFF, 0x03, 0x03, 0x05, 0x07, 0x06, 0x05, 
-    0x01, 0xFA, 0xF4, 0xEE, 0xEC, 0xEE, 0xF3, 0xF9, 0xFF, 0x02, 0x02, 0x00, 
-    0xFB, 0xF5, 0xEE, 0xE9, 0xE7, 0xE8, 0xEA, 0xEF, 0xF4, 0xF7, 0xF6, 0xF0, 
-    0xEB, 0xE5, 0xE0, 0xDD, 0xDE, 0xE4, 0xEC, 0xF3, 0xF8, 0xFC, 0xFE, 0xFC, 
-    0xF8, 0xF5, 0xF0, 0xEE, 0xED, 0xEF, 0xF3, 0xF8, 0xFE, 0x03, 0x05, 0x03, 
-    0x01, 0xFF, 0xFA, 0xF6, 0xF4, 0xF4, 0xF5, 0xFA, 0xFE, 0x00, 0x01, 0xFF, 
-    0xFD, 0xF8, 0xF5, 0xF0, 0xEC, 0xEC, 0xEE, 0xF1, 0xF5, 0xFC, 0x00, 0x02, 
-    0x01, 0xFE, 0xFB, 0xF7, 0xF6, 0xF6, 0xF8, 0xFF, 0x07, 0x0E, 0x12, 0x13, 
-    0x12, 0x0E, 0x0A, 0x06, 0x04, 0x05, 0x07, 0x0B, 0x0E, 0x13, 0x12, 0x10, 
-    0x0C, 0x09, 0x08, 0x08, 0x05, 0x01, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFE, 
-    0x00, 0x01, 0xFF, 0xFC, 0xFA, 0xFA, 0xFD, 0x00, 0x04, 0x0A, 0x0E, 0x11, 
-    0x11, 0x10, 0x0C, 0x06, 0x00, 0xFC, 0xFA, 0xFB, 0x00, 0x07, 0x0E, 0x13, 
-    0x16, 0x17, 0x15, 0x11, 0x0C, 0x05, 0x02, 0x01, 0x03, 0x09, 0x0F, 0x13, 
-    0x16, 0x17, 0x14, 0x11, 0x0B, 0x04, 0x02, 0x03, 0x09, 0x0F, 0x16, 0x1D, 
-    0x20, 0x20, 0x1A, 0x12, 0x08, 0x02, 0x00, 0x01, 0x04, 0x09, 0x0F, 0x15, 
-    0x1A, 0x1C, 0x1A, 0x13, 0x0D, 0x08, 0x07, 0x0A, 0x0D, 0x0F, 0x11, 0x14, 
-    0x16, 0x16, 0x13, 0x0F, 0x0A, 0x05, 0x04, 0x09, 0x11, 0x17, 0x1D, 0x1D, 
-    0x1B, 0x17, 0x13, 0x0D, 0x06, 0x00, 0xFC, 0xFA, 0xFB, 0x00, 0x04, 0x05, 
-    0x03, 0xFF, 0xFA, 0xF4, 0xF1, 0xEF, 0xEF, 0xF0, 0xF4, 0xF9, 0xFE, 0x00, 
-    0xFF, 0x00, 0xFF, 0xFD, 0xFC, 0xFA, 0xF8, 0xFB, 0xFF, 0x03, 0x06, 0x06, 
-    0x03, 0xFC, 0xF4, 0xEB, 0xE5, 0xE0, 0xDF, 0xE3, 0xE7, 0xEC, 0xEE, 0xEF, 
-    0xED, 0xEB, 0xE8, 0xE3, 0xDF, 0xDB, 0xDA, 0xDC, 0xDF, 0xE3, 0xE8, 0xEC, 
-    0xED, 0xEE, 0xEF, 0xEE, 0xED, 0xE9, 0xE5, 0xE7, 0xED, 0xF7, 0x00, 0x05, 
-    0x05, 0x02, 0xFF, 0xF9, 0xF4, 0xF1, 0xEF, 0xF2, 0xF8, 0xFD, 0x03, 0x06, 
-    0x06, 0x04, 0x02, 0xFE, 0xF9, 0xF3, 0xF0, 0xF2, 0xF6, 0xFB, 0x00, 0x06, 
-    0x07, 0x06, 0x02, 0xFF, 0xFD, 0xFA, 0xF7, 0xF5, 0xF8, 0xFC, 0x01, 0x04, 
-    0x05, 0x03, 0x02, 0x00, 0xFB, 0xF6, 0xF2, 0xF0, 0xF3, 0xF6, 0xFA, 0xFC, 
-    0xFC, 0xFC, 0xFD, 0xFC, 0xF8, 0xF4, 0xF3, 0xF3, 0xF6, 0xF9, 0xFB, 0xFE, 
-    0x00, 0x00, 0x01, 0xFF, 0xFA, 0xF4, 0xF0, 0xEE, 0xEE, 0xEE, 0xF0, 0xF2, 
-    0xF5, 0xF5, 0xF5, 0xF4, 0xF1, 0xED, 0xEA, 0xE7, 0xE8, 0xEC, 0xF2, 0xF6, 
-    0xFA, 0xFD, 0xFC, 0xFB, 0xF9, 0xF6, 0xF4, 0xF4, 0xF7, 0xFA, 0xFD, 0x03, 
-    0x07, 0x07, 0x0A, 0x0F, 0x11, 0x11, 0x0D, 0x06, 0x00, 0x00, 0x02, 0x06, 
-    0x0A, 0x0E, 0x11, 0x11, 0x0F, 0x0B, 0x06, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 
-    0x05, 0x08, 0x08, 0x07, 0x05, 0x05, 0x05, 0x06, 0x06, 0x0A, 0x0E, 0x13, 
-    0x18, 0x19, 0x1A, 0x1B, 0x1B, 0x1A, 0x18, 0x16, 0x17, 0x16, 0x17, 0x1B, 
-    0x1F, 0x24, 0x25, 0x23, 0x20, 0x1B, 0x14, 0x0E, 0x0D, 0x0E, 0x10, 0x12, 
-    0x14, 0x15, 0x14, 0x13, 0x11, 0x10, 0x0E, 0x0D, 0x0C, 0x0B, 0x0B, 0x0A, 
-    0x0B, 0x0B, 0x07, 0x04, 0x01, 0xFE, 0xFB, 0xF9, 0xF9, 0xFC, 0x02, 0x09, 
-    0x0E, 0x10, 0x11, 0x11, 0x10, 0x0D, 0x07, 0x01, 0xFD, 0x00, 0x06, 0x0D, 
-    0x12, 0x14, 0x14, 0x13, 0x12, 0x0E, 0x08, 0x04, 0x04, 0x07, 0x0C, 0x0E, 
-    0x10, 0x11, 0x11, 0x0E, 0x0A, 0x05, 0x01, 0xFE, 0xFC, 0xFC, 0xFD, 0x01, 
-    0x05, 0x08, 0x09, 0x08, 0x07, 0x06, 0x03, 0x00, 0xFC, 0xF8, 0xF5, 0xF9, 
-    0x00, 0x04, 0x05, 0x06, 0x08, 0x09, 0x08, 0x05, 0x02, 0x00, 0xFE, 0xFD, 
-    0xFC, 0xFD, 0xFC, 0xF8, 0xF4, 0xF0, 0xEF, 0xEE, 0xEC, 0xE9, 0xE8, 0xEA, 
-    0xEE, 0xEF, 0xED, 0xE8, 0xE6, 0xE5, 0xE3, 0xE1, 0xDC, 0xD9, 0xD9, 0xDE, 
-    0xE4, 0xE9, 0xEC, 0xED, 0xEE, 0xEF, 0xEF, 0xED, 0xEE, 0xEE, 0xEF, 0xF0, 
-    0xF1, 0xF5, 0xF9, 0xFA, 0xFA, 0xF9, 0xF8, 0xF9, 0xF8, 0xF6, 0xF6, 0xF8, 
-    0xFC, 0x01, 0x02, 0x01, 0xFF, 0xFD, 0xFB, 0xF8, 0xF5, 0xF1, 0xF0, 0xF1, 
-    0xF5, 0xFA, 0xFD, 0xFF, 0x00, 0x01, 0xFF, 0xFB, 0xF6, 0xF1, 0xEF, 0xF0, 
-    0xF1, 0xF4, 0xF7, 0xFB, 0xFE, 0xFE, 0xFC, 0xFA, 0xF6, 0xF1, 0xF0, 0xF4, 
-    0xFD, 0x03, 0x07, 0x08, 0x07, 0x06, 0x03, 0xFE, 0xF9, 0xF4, 0xF4, 0xF8, 
-    0xFE, 0x02, 0x03, 0x03, 0x02, 0x00, 0xFD, 0xFA, 0xF7, 0xF4, 0xF3, 0xF2, 
-    0xF3, 0xF3, 0xF4, 0xF7, 0xF8, 0xF9, 0xF8, 0xF6, 0xF4, 0xF3, 0xF3, 0xF5, 
-    0xF9, 0xFE, 0x02, 0x05, 0x07, 0x06, 0x03, 0xFF, 0xFB, 0xF9, 0xFA, 0xFD, 
-    0x02, 0x06, 0x09, 0x0A, 0x08, 0x04, 0x00, 0xFC, 0xF7, 0xF4, 0xF6, 0xF7, 
-    0xF9, 0xFB, 0xFD, 0xFE, 0xFE, 0xFD, 0xFF, 0xFE, 0xFC, 0xF8, 0xF4, 0xF4, 
-    0xF7, 0xFB, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x06, 
-    0x0D, 0x15, 0x1C, 0x1F, 0x1E, 0x1E, 0x20, 0x21, 0x21, 0x21, 0x20, 0x22, 
-    0x24, 0x25, 0x26, 0x24, 0x22, 0x1F, 0x1D, 0x1D, 0x1A, 0x16, 0x11, 0x0D, 
-    0x0B, 0x0D, 0x11, 0x15, 0x19, 0x1A, 0x1B, 0x1A, 0x18, 0x15, 0x10, 0x0C, 
-    0x0C, 0x0E, 0x10, 0x10, 0x0F, 0x11, 0x11, 0x11, 0x0F, 0x0B, 0x08, 0x06, 
-    0x05, 0x05, 0x03, 0x03, 0x04, 0x05, 0x05, 0x03, 0x01, 0xFE, 0xFB, 0xF7, 
-    0xF4, 0xF2, 0xF6, 0xFC, 0x02, 0x04, 0x03, 0x01, 0x00, 0xFE, 0xFA, 0xF8, 
-    0xF8, 0xFA, 0xFD, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFD, 0xFB, 
-    0xFC, 0xFE, 0x02, 0x04, 0x05, 0x04, 0x02, 0x01, 0xFF, 0xFD, 0xFA, 0xF4, 
-    0xF0, 0xEE, 0xF2, 0xF9, 0x00, 0x06, 0x08, 0x08, 0x06, 0x01, 0xFB, 0xF5, 
-    0xF1, 0xF1, 0xF5, 0xF9, 0xFC, 0xFC, 0xFC, 0xFA, 0xF7, 0xF2, 0xEC, 0xE8, 
-    0xE6, 0xE5, 0xE6, 0xE8, 0xEB, 0xED, 0xEC, 0xE8, 0xE4, 0xE4, 0xE5, 0xE3, 
-    0xE1, 0xE1, 0xE5, 0xEE, 0xF5, 0xF8, 0xF8, 0xF9, 0xFA, 0xFB, 0xFA, 0xF7, 
-    0xF5, 0xF7, 0xFA, 0xFE, 0x02, 0x05, 0x06, 0x07, 0x06, 0x04, 0x00, 0xFC, 
-    0xFA, 0xF9, 0xF8, 0xF6, 0xF5, 0xF5, 0xF4, 0xF2, 0xF0, 0xEC, 0xE9, 0xE6, 
-    0xE4, 0xE4, 0xE5, 0xE7, 0xEC, 0xF3, 0xF6, 0xF6, 0xF3, 0xEF, 0xED, 0xEA, 
-    0xEB, 0xEF, 0xF4, 0xF8, 0xFB, 0xFE, 0x01, 0x04, 0x05, 0x03, 0xFF, 0xFA, 
-    0xF6, 0xF5, 0xF4, 0xF4, 0xF4, 0xF6, 0xF5, 0xF4, 0xF2, 0xF0, 0xEF, 0xF0, 
-    0xEF, 0xED, 0xED, 0xF1, 0xF7, 0xFB, 0xFE, 0x00, 0xFF, 0xFE, 0xFA, 0xF7, 
-    0xF4, 0xF5, 0xF7, 0xF9, 0xFC, 0xFE, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 
-    0x05, 0x04, 0x05, 0x07, 0x0A, 0x0B, 0x0D, 0x10, 0x11, 0x12, 0x0F, 0x09, 
-    0x04, 0xFE, 0xFC, 0xFE, 0x03, 0x07, 0x08, 0x06, 0x04, 0x03, 0x01, 0xFD, 
-    0xF8, 0xF2, 0xEF, 0xF2, 0xF5, 0xF9, 0xFB, 0xFC, 0xFB, 0xFA, 0xF9, 0xF7, 
-    0xF5, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xFC, 0xFF, 0x01, 0x02, 0x02, 0x03, 
-    0x03, 0x03, 0x03, 0x07, 0x0C, 0x14, 0x1A, 0x1E, 0x1F, 0x1E, 0x1C, 0x1A, 
-    0x19, 0x18, 0x17, 0x18, 0x19, 0x19, 0x19, 0x18, 0x17, 0x15, 0x12, 0x0C, 
-    0x06, 0x01, 0xFF, 0x00, 0x02, 0x05, 0x0A, 0x0D, 0x0F, 0x0E, 0x0C, 0x0A, 
-    0x09, 0x07, 0x05, 0x06, 0x09, 0x0F, 0x15, 0x18, 0x19, 0x16, 0x0F, 0x08, 
-    0x03, 0x01, 0x00, 0x01, 0x02, 0x04, 0x06, 0x06, 0x07, 0x08, 0x09, 0x08, 
-    0x06, 0x04, 0x04, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0A, 0x0A, 0x08, 0x05, 
-    0x02, 0x00, 0xFC, 0xF9, 0xFA, 0xFE, 0x03, 0x07, 0x07, 0x05, 0x03, 0xFF, 
-    0xFC, 0xFA, 0xF8, 0xFA, 0xFD, 0xFE, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0xFD, 
-    0xFB, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC, 0xFD, 0xFC, 0xFA, 0xF7, 
-    0xF4, 0xF1, 0xEC, 0xE8, 0xE5, 0xE6, 0xE9, 0xEE, 0xF1, 0xF1, 0xEE, 0xEA, 
-    0xE5, 0xE1, 0xDF, 0xDD, 0xDD, 0xDE, 0xDF, 0xE1, 0xE2, 0xE3, 0xE5, 0xE6, 
-    0xE6, 0xE6, 0xE8, 0xEC, 0xF2, 0xF7, 0xFA, 0xFD, 0x00, 0x04, 0x07, 0x08, 
-    0x06, 0x03, 0x01, 0xFF, 0xFF, 0x01, 0x03, 0x05, 0x05, 0x05, 0x03, 0x01, 
-    0xFF, 0xFB, 0xF6, 0xF2, 0xF1, 0xF3, 0xF8, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 
-    0x01, 0x02, 0x00, 0xFC, 0xF9, 0xF8, 0xF7, 0xFA, 0xFF, 0x02, 0x02, 0x01, 
-    0xFF, 0xFD, 0xFA, 0xF6, 0xF2, 0xF2, 0xF4, 0xF7, 0xF9, 0xFA, 0xF9, 0xF5, 
-    0xF0, 0xEC, 0xE8, 0xE5, 0xE4, 0xE4, 0xE4, 0xE5, 0xE8, 0xED, 0xF0, 0xF3, 
-    0xF1, 0xEE, 0xED, 0xED, 0xEE, 0xF0, 0xF2, 0xF4, 0xF9, 0xFE, 0x00, 0x00, 
-    0xFD, 0xFA, 0xF7, 0xF4, 0xF1, 0xEF, 0xF2, 0xF8, 0x01, 0x05, 0x05, 0x02, 
-    0xFE, 0xFC, 0xFB, 0xFA, 0xFB, 0xFD, 0x00, 0x05, 0x0A, 0x0D, 0x0F, 0x0E, 
-    0x0E, 0x0C, 0x0B, 0x09, 0x09, 0x0B, 0x0C, 0x0B, 0x0A, 0x09, 0x05, 0x02, 
-    0xFD, 0xF8, 0xF4, 0xF1, 0xF0, 0xEF, 0xF0, 0xF3, 0xF7, 0xFB, 0xFF, 0x00, 
-    0x01, 0x02, 0x00, 0xFF, 0xFF, 0x01, 0x04, 0x0A, 0x10, 0x15, 0x1A, 0x1E, 
-    0x1F, 0x1F, 0x1E, 0x1E, 0x1F, 0x22, 0x25, 0x27, 0x28, 0x2A, 0x2A, 0x2A, 
-    0x26, 0x20, 0x19, 0x12, 0x0E, 0x0B, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 
-    0x0A, 0x07, 0x04, 0x00, 0xFD, 0xFB, 0xFC, 0x00, 0x03, 0x06, 0x07, 0x08, 
-    0x07, 0x08, 0x07, 0x06, 0x06, 0x08, 0x0C, 0x0E, 0x0F, 0x10, 0x10, 0x11, 
-    0x0F, 0x0D, 0x08, 0x02, 0xFC, 0xF9, 0xFA, 0xFB, 0xFE, 0xFF, 0x00, 0xFF, 
-    0xFE, 0xFD, 0xFD, 0xFC, 0xFB, 0xFC, 0xFF, 0x01, 0x03, 0x04, 0x05, 0x06, 
-    0x07, 0x07, 0x05, 0x03, 0x02, 0x03, 0x02, 0x00, 0xFD, 0xFD, 0xFF, 0x02, 
-    0x04, 0x04, 0x02, 0xFF, 0xFB, 0xF9, 0xFA, 0xFF, 0x05, 0x0B, 0x0F, 0x10, 
-    0x10, 0x0E, 0x0B, 0x07, 0x05, 0x04, 0x04, 0x05, 0x05, 0x04, 0x04, 0x04, 
-    0x02, 0xFE, 0xF8, 0xF3, 0xEE, 0xEB, 0xE9, 0xE8, 0xE6, 0xE5, 0xE5, 0xE5, 
-    0xE4, 0xE3, 0xE1, 0xDE, 0xD9, 0xD4, 0xD0, 0xD0, 0xD4, 0xD8, 0xDD, 0xE1, 
-    0xE4, 0xE4, 0xE3, 0xE4, 0xE4, 0xE7, 0xEB, 0xF0, 0xF5, 0xF9, 0xFD, 0x02, 
-    0x07, 0x0A, 0x09, 0x07, 0x05, 0x03, 0x04, 0x06, 0x06, 0x07, 0x08, 0x07, 
-    0x05, 0x02, 0xFF, 0xFB, 0xF6, 0xF1, 0xED, 0xEC, 0xED, 0xF1, 0xF7, 0xFE, 
-    0x02, 0x02, 0xFF, 0xFA, 0xF5, 0xF2, 0xF2, 0xF5, 0xF9, 0xFC, 0x00, 0x03, 
-    0x05, 0x04, 0x01, 0xFA, 0xF4, 0xF1, 0xF1, 0xF3, 0xF5, 0xF7, 0xF8, 0xF8, 
-    0xF7, 0xF7, 0xF7, 0xF6, 0xF4, 0xF0, 0xEC, 0xED, 0xF1, 0xF7, 0xFC, 0xFE, 
-    0x00, 0x00, 0xFC, 0xF9, 0xF6, 0xF5, 0xF5, 0xF8, 0xFB, 0xFF, 0x03, 0x05, 
-    0x05, 0x02, 0xFE, 0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFE, 0x00, 0x02, 0x05, 
-    0x05, 0x04, 0x03, 0x00, 0xFF, 0xFB, 0xF9, 0xF7, 0xF9, 0xFB, 0xFD, 0xFF, 
-    0x00, 0x01, 0x00, 0xFD, 0xFA, 0xF6, 0xF5, 0xF5, 0xF7, 0xFA, 0xFC, 0xFD, 
-    0xFD, 0xFC, 0xFB, 0xFB, 0xF9, 0xF9, 0xF7, 0xF8, 0xFA, 0xFB, 0xFB, 0xFB, 
-    0xFC, 0xFE, 0x00, 0x02, 0x02, 0x00, 0xFF, 0x00, 0x04, 0x0B, 0x10, 0x15, 
-    0x19, 0x1F, 0x22, 0x23, 0x22, 0x21, 0x20, 0x20, 0x21, 0x21, 0x22, 0x23, 
-    0x24, 0x23, 0x22, 0x20, 0x1E, 0x1D, 0x1C, 0x1B, 0x1B, 0x1B, 0x19, 0x18, 
-    0x18, 0x17, 0x15, 0x14, 0x13, 0x11, 0x0D, 0x09, 0x05, 0x06, 0x09, 0x0C, 
-    0x0E, 0x0F, 0x0D, 0x0B, 0x0B, 0x0C, 0x0C, 0x0A, 0x08, 0x06, 0x05, 0x04, 
-    0x05, 0x05, 0x03, 0x01, 0xFE, 0xFB, 0xF9, 0xF9, 0xF9, 0xFA, 0xF9, 0xF7, 
-    0xF9, 0xFB, 0xFA, 0xF8, 0xF5, 0xF1, 0xED, 0xE9, 0xE6, 0xE6, 0xE6, 0xE8, 
-    0xEC, 0xEF, 0xF0, 0xEF, 0xF1, 0xF2, 0xF7, 0xFB, 0xFE, 0x01, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x05, 0x03, 0x02, 0x02, 0x02, 0x06, 0x0C, 0x10, 0x0F, 
-    0x0C, 0x06, 0x05, 0x03, 0x08, 0x11, 0x16, 0x1D, 0x19, 0x13, 0x0C, 0xFF, 
-    0xF8, 0xEE, 0xEE, 0xF5, 0xFA, 0x03, 0x03, 0xFF, 0xF7, 0xEA, 0xE1, 0xDE, 
-    0xDD, 0xE5, 0xEC, 0xF3, 0xF7, 0xF3, 0xF0, 0xEE, 0xF0, 0xF6, 0xF8, 0xFF, 
-    0x01, 0x01, 0x06, 0x01, 0xFF, 0x03, 0x01, 0x07, 0x04, 0x04, 0x05, 0x01, 
-    0x06, 0x01, 0x05, 0x04, 0x02, 0x03, 0x00, 0x00, 0xFD, 0xFE, 0x02, 0xFA, 
-    0xFE, 0xF4, 0xF3, 0xF7, 0xF2, 0xF8, 0xF3, 0xF1, 0xEE, 0xEB, 0xEC, 0xEB, 
-    0xE3, 0xE7, 0xE4, 0xE4, 0xE3, 0xE6, 0xE2, 0xE5, 0xE8, 0xE1, 0xE3, 0xE9, 
-    0xF1, 0xF5, 0xFB, 0xFD, 0x00, 0xFA, 0xFE, 0xF5, 0xF4, 0xEE, 0xF3, 0xF5, 
-    0xF5, 0xFF, 0xF4, 0xF4, 0xED, 0xEC, 0xE9, 0xEC, 0xF4, 0xF8, 0xFE, 0xFF, 
-    0xFD, 0xF6, 0xF1, 0xF3, 0xEF, 0xF4, 0xF8, 0xF7, 0xFA, 0xF4, 0xF4, 0xFB, 
-    0x00, 0x04, 0x09, 0xFF, 0x03, 0xFD, 0x02, 0x13, 0x1F, 0x38, 0x43, 0x4D, 
-    0x45, 0x37, 0x24, 0x1A, 0x14, 0x11, 0x22, 0x2D, 0x40, 0x47, 0x43, 0x35, 
-    0x20, 0x0F, 0x04, 0x00, 0x07, 0x0B, 0x11, 0x1E, 0x17, 0x14, 0x04, 0xFA, 
-    0xF6, 0xF2, 0xF4, 0xFA, 0x00, 0x01, 0x05, 0x02, 0xFE, 0xFB, 0xFB, 0xF7, 
-    0xF7, 0xFF, 0xFD, 0xFC, 0x04, 0x01, 0x06, 0x07, 0x04, 0x08, 0x06, 0x0B, 
-    0x0B, 0x0C, 0x0D, 0x0C, 0x0E, 0x12, 0x13, 0x17, 0x19, 0x17, 0x14, 0x12, 
-    0x18, 0x16, 0x1B, 0x18, 0x1A, 0x17, 0x18, 0x13, 0x12, 0x13, 0x0D, 0x10, 
-    0x0B, 0x0C, 0x0B, 0x0F, 0x11, 0x14, 0x13, 0x13, 0x11, 0x0C, 0x10, 0x14, 
-    0x12, 0x0F, 0x0D, 0xFE, 0xF9, 0xF5, 0xEC, 0xED, 0xEC, 0xEB, 0xEB, 0xE9, 
-    0xEE, 0xF2, 0xF5, 0xF7, 0xF4, 0xF0, 0xEB, 0xEA, 0xE9, 0xEF, 0xF4, 0xF8, 
-    0xFD, 0xFE, 0x04, 0xFE, 0xFD, 0xF5, 0xEE, 0xEB, 0xEA, 0xF0, 0xF7, 0x06, 
-    0x0F, 0x17, 0x0F, 0x07, 0xFB, 0xE9, 0xE3, 0xDD, 0xE2, 0xEF, 0xFC, 0x0A, 
-    0x14, 0x17, 0x0E, 0x03, 0xF4, 0xE5, 0xDF, 0xE6, 0xEE, 0x00, 0x0C, 0x15, 
-    0x18, 0x0F, 0x06, 0xF4, 0xF2, 0xEA, 0xF0, 0xFC, 0x02, 0x0B, 0x0D, 0x0D, 
-    0x01, 0xF8, 0xEB, 0xE4, 0xE1, 0xE3, 0xE9, 0xF1, 0xF3, 0xEF, 0xE9, 0xDF, 
-    0xDD, 0xD2, 0xD8, 0xDC, 0xE0, 0xE6, 0xE6, 0xEA, 0xED, 0xF0, 0xF2, 0xF2, 
-    0xF3, 0xF9, 0xF7, 0xFE, 0xFF, 0x02, 0x09, 0x0B, 0x0D, 0x0C, 0x06, 0x05, 
-    0x07, 0x08, 0x07, 0x01, 0xFD, 0xFA, 0xF8, 0xFF, 0x03, 0x03, 0xFE, 0xF6, 
-    0xF0, 0xEE, 0xED, 0xF0, 0xF4, 0xF5, 0xFD, 0x00, 0xFE, 0xFB, 0xF7, 0xF2, 
-    0xF1, 0xF0, 0xEF, 0xF3, 0xF8, 0xF9, 0xF9, 0xF5, 0xF0, 0xED, 0xEC, 0xEB, 
-    0xF0, 0xF4, 0xF9, 0xFC, 0xFD, 0xFC, 0xF7, 0xF6, 0xED, 0xE9, 0xE7, 0xE6, 
-    0xE5, 0xF3, 0xFD, 0x04, 0x0C, 0x02, 0xF8, 0xEB, 0xE1, 0xDD, 0xDD, 0xE5, 
-    0xEF, 0xF7, 0x03, 0x02, 0x02, 0xF7, 0xEB, 0xDD, 0xDC, 0xDD, 0xE3, 0xF8, 
-    0xFE, 0x16, 0x19, 0x1D, 0x1D, 0x14, 0x0F, 0x0D, 0x0D, 0x1A, 0x23, 0x2D, 
-    0x38, 0x34, 0x3B, 0x2F, 0x28, 0x1B, 0x12, 0x0D, 0x11, 0x19, 0x20, 0x26, 
-    0x28, 0x2A, 0x25, 0x1D, 0x17, 0x13, 0x06, 0x09, 0x05, 0x07, 0x0B, 0x05, 
-    0x05, 0x02, 0xFB, 0xFA, 0xF5, 0xEF, 0xED, 0xEE, 0xF6, 0xF9, 0xFB, 0x01, 
-    0xFF, 0x00, 0x02, 0x06, 0x0E, 0x12, 0x16, 0x17, 0x18, 0x17, 0x19, 0x1C, 
-    0x1F, 0x1C, 0x1C, 0x18, 0x14, 0x16, 0x14, 0x1A, 0x1D, 0x1E, 0x21, 0x21, 
-    0x1F, 0x1D, 0x1D, 0x18, 0x14, 0x18, 0x13, 0x17, 0x15, 0x0E, 0x0C, 0x03, 
-    0x00, 0xFC, 0xFB, 0xFF, 0x06, 0x0A, 0x0C, 0x0C, 0xFF, 0xFF, 0xF5, 0xF1, 
-    0xED, 0xEA, 0xED, 0xF1, 0xF7, 0xFB, 0xFD, 0xF5, 0xF2, 0xE5, 0xDF, 0xDB, 
-    0xDC, 0xE0, 0xEE, 0xF5, 0x01, 0x08, 0x09, 0x04, 0xFA, 0xF1, 0xE1, 0xDA, 
-    0xD1, 0xDC, 0xE5, 0xF9, 0x06, 0x0E, 0x13, 0x09, 0x02, 0xF3, 0xEB, 0xE8, 
-    0xED, 0xF3, 0xFC, 0x08, 0x0E, 0x11, 0x0C, 0x03, 0xF8, 0xF1, 0xEE, 0xE8, 
-    0xED, 0xF0, 0xFA, 0x06, 0x09, 0x0C, 0x0A, 0x04, 0x03, 0xFD, 0xFC, 0xFA, 
-    0xFB, 0xFF, 0x03, 0x0A, 0x0C, 0x0D, 0x0E, 0x0C, 0x06, 0x02, 0xFA, 0xFB, 
-    0xF6, 0xF8, 0xF7, 0xF5, 0xF6, 0xF0, 0xF1, 0xEB, 0xEB, 0xEA, 0xEA, 0xEC, 
-    0xEF, 0xEF, 0xEF, 0xF1, 0xEB, 0xEC, 0xEA, 0xE9, 0xEB, 0xEF, 0xF1, 0xF3, 
-    0xF6, 0xEF, 0xEA, 0xE3, 0xE3, 0xE5, 0xEB, 0xF3, 0xF8, 0xFC, 0xFE, 0xFD, 
-    0xFA, 0xF8, 0xF3, 0xF4, 0xF3, 0xF9, 0x00, 0x07, 0x0E, 0x0C, 0x0A, 0x06, 
-    0xFB, 0xF1, 0xEA, 0xE7, 0xEB, 0xF2, 0xF9, 0x02, 0x08, 0x0D, 0x0A, 0xFC, 
-    0xEA, 0xD8, 0xCF, 0xCC, 0xD8, 0xEB, 0xFE, 0x0C, 0x0E, 0x0A, 0xFF, 0xF1, 
-    0xE2, 0xD7, 0xD1, 0xD3, 0xDE, 0xEA, 0xFC, 0x04, 0x0A, 0x0A, 0x03, 0xFF, 
-    0xF3, 0xED, 0xE9, 0xEE, 0xF6, 0x03, 0x0C, 0x16, 0x1D, 0x19, 0x19, 0x0E, 
-    0x02, 0xFA, 0xF2, 0xEC, 0xEC, 0xEE, 0xF8, 0x00, 0x07, 0x09, 0x06, 0x05, 
-    0x03, 0x02, 0x01, 0x06, 0x08, 0x11, 0x19, 0x1F, 0x2A, 0x2F, 0x35, 0x37, 
-    0x32, 0x2D, 0x26, 0x22, 0x1F, 0x17, 0x15, 0x12, 0x0B, 0x08, 0x08, 0x02, 
-    0xFE, 0xF8, 0xF0, 0xEF, 0xF0, 0xF2, 0xF5, 0xF6, 0xF8, 0xF9, 0xFB, 0x01, 
-    0x04, 0x0A, 0x0E, 0x0D, 0x0C, 0x06, 0x01, 0x00, 0xFD, 0x00, 0x06, 0x0B, 
-    0x0D, 0x12, 0x14, 0x16, 0x17, 0x16, 0x16, 0x10, 0x12, 0x12, 0x1A, 0x21, 
-    0x26, 0x2A, 0x23, 0x18, 0x0A, 0x04, 0x01, 0x06, 0x11, 0x16, 0x1C, 0x22, 
-    0x24, 0x22, 0x1A, 0x0D, 0xFF, 0xF9, 0xFB, 0x02, 0x0D, 0x16, 0x20, 0x27, 
-    0x28, 0x25, 0x1C, 0x11, 0x0A, 0x05, 0x05, 0x06, 0x08, 0x10, 0x16, 0x19, 
-    0x1A, 0x10, 0x03, 0xF1, 0xE3, 0xDB, 0xD6, 0xD9, 0xE1, 0xE8, 0xED, 0xF4, 
-    0xF8, 0xFD, 0xFE, 0xFE, 0xF9, 0xF5, 0xF5, 0xF0, 0xF5, 0xF6, 0xF6, 0xF7, 
-    0xF9, 0xFD, 0xFB, 0xFB, 0xF5, 0xEF, 0xE9, 0xE0, 0xDC, 0xDB, 0xDC, 0xE4, 
-    0xEB, 0xF1, 0xF5, 0xF4, 0xF1, 0xF0, 0xF1, 0xF3, 0xF7, 0xF7, 0xF8, 0xF9, 
-    0xFB, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xF9, 0xF6, 0xF4, 0xF2, 0xF7, 0xFA, 
-    0xFF, 0x05, 0x04, 0x08, 0x07, 0x03, 0x03, 0x00, 0xFA, 0xF7, 0xF7, 0xFA, 
-    0xFE, 0x01, 0xFF, 0xF4, 0xEB, 0xE5, 0xDF, 0xE0, 0xE0, 0xE1, 0xE5, 0xE8, 
-    0xF2, 0xF8, 0xFE, 0x01, 0xFF, 0xF6, 0xEF, 0xE7, 0xE6, 0xEB, 0xF3, 0x00, 
-    0x0C, 0x13, 0x14, 0x16, 0x10, 0x08, 0xFE, 0xF3, 0xEB, 0xEC, 0xF1, 0xFD, 
-    0x07, 0x0F, 0x11, 0x11, 0x0A, 0x00, 0xF8, 0xEF, 0xE9, 0xE8, 0xEB, 0xEF, 
-    0xFB, 0x02, 0x0B, 0x0D, 0x0B, 0x05, 0xFA, 0xF0, 0xE9, 0xE2, 0xE2, 0xE2, 
-    0xE4, 0xE8, 0xEC, 0xF0, 0xEE, 0xF0, 0xEB, 0xEB, 0xE4, 0xDB, 0xD6, 0xD5, 
-    0xDA, 0xE3, 0xEB, 0xEE, 0xF1, 0xF1, 0xF2, 0xF1, 0xEF, 0xEF, 0xEB, 0xEA, 
-    0xEB, 0xEE, 0xF6, 0xFC, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFE, 
-    0x00, 0x03, 0x08, 0x0A, 0x0A, 0x0A, 0x08, 0x06, 0x02, 0xFF, 0xFA, 0xF9, 
-    0xF9, 0xFD, 0x03, 0x08, 0x0A, 0x07, 0x07, 0x09, 0x0E, 0x14, 0x1B, 0x1F, 
-    0x23, 0x29, 0x2C, 0x2F, 0x32, 0x30, 0x2B, 0x23, 0x1A, 0x0F, 0x09, 0x07, 
-    0x06, 0x0B, 0x0B, 0x0B, 0x0C, 0x09, 0x07, 0x02, 0xFC, 0xF6, 0xF5, 0xF7, 
-    0x01, 0x0F, 0x1B, 0x24, 0x26, 0x22, 0x18, 0x0E, 0x05, 0x01, 0xFD, 0xFD, 
-    0x01, 0x04, 0x0C, 0x13, 0x1A, 0x1B, 0x14, 0x08, 0xFC, 0xF5, 0xF7, 0xF8, 
-    0xFE, 0x05, 0x0F, 0x17, 0x1A, 0x1B, 0x19, 0x19, 0x12, 0x10, 0x0A, 0x0B, 
-    0x0C, 0x0A, 0x0D, 0x0C, 0x08, 0x05, 0x00, 0xFE, 0xFF, 0x01, 0x08, 0x0A, 
-    0x0D, 0x0E, 0x0F, 0x0E, 0x0E, 0x11, 0x11, 0x10, 0x12, 0x10, 0x11, 0x13, 
-    0x12, 0x11, 0x0B, 0x04, 0xFB, 0xF4, 0xEF, 0xEA, 0xE7, 0xE5, 0xE4, 0xE5, 
-    0xE4, 0xE8, 0xE9, 0xEC, 0xEF, 0xF1, 0xF3, 0xF0, 0xF4, 0xF8, 0xFE, 0x05, 
-    0x01, 0x00, 0x01, 0x00, 0x03, 0x02, 0x03, 0x05, 0x06, 0x02, 0x02, 0xFF, 
-    0xFB, 0xFA, 0xFA, 0xFC, 0xFD, 0x01, 0x03, 0x06, 0x08, 0x0B, 0x08, 0x03, 
-    0xFD, 0xF6, 0xF4, 0xF4, 0xF9, 0xF9, 0xFA, 0xF4, 0xF2, 0xEE, 0xEE, 0xEE, 
-    0xE8, 0xE3, 0xE0, 0xE0, 0xE5, 0xEF, 0xF2, 0xF7, 0xF6, 0xF2, 0xEE, 0xE8, 
-    0xE3, 0xE4, 0xE6, 0xEB, 0xF2, 0xF5, 0xFC, 0xFE, 0xFE, 0xFA, 0xF4, 0xED, 
-    0xE8, 0xE6, 0xE6, 0xE8, 0xEA, 0xF0, 0xF1, 0xF1, 0xF3, 0xF2, 0xF5, 0xF9, 
-    0xFA, 0xFC, 0xFB, 0xFC, 0xFF, 0x03, 0x09, 0x09, 0x08, 0x05, 0x00, 0xFE, 
-    0xFD, 0xFB, 0xFA, 0xFA, 0xF6, 0xF4, 0xF1, 0xEE, 0xEB, 0xE9, 0xE7, 0xE5, 
-    0xEA, 0xEF, 0xF4, 0xFC, 0x02, 0x02, 0x03, 0x00, 0xFA, 0xF6, 0xF5, 0xF6, 
-    0xF7, 0xFB, 0xFA, 0xFD, 0xFD, 0xFF, 0x00, 0xFC, 0xFC, 0xF6, 0xF3, 0xEE, 
-    0xED, 0xEF, 0xF1, 0xF4, 0xF9, 0xFA, 0xFC, 0xFD, 0xFD, 0xFE, 0xFB, 0xFB, 
-    0xF6, 0xF7, 0xF5, 0xF6, 0xFA, 0xF9, 0xF6, 0xF1, 0xED, 0xEA, 0xEB, 0xEB, 
-    0xEC, 0xED, 0xED, 0xF2, 0xF5, 0xF7, 0xF9, 0xFA, 0xFC, 0xFC, 0xFE, 0xFE, 
-    0xFD, 0xFD, 0xFD, 0xFE, 0x01, 0x04, 0x0A, 0x0F, 0x15, 0x1B, 0x1F, 0x1F, 
-    0x1C, 0x1A, 0x19, 0x1B, 0x1D, 0x1F, 0x20, 0x1F, 0x1E, 0x1C, 0x1A, 0x19, 
-    0x16, 0x14, 0x0E, 0x08, 0x02, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFB, 
-    0xFB, 0xFA, 0xFA, 0xFC, 0xFE, 0x04, 0x09, 0x0D, 0x12, 0x16, 0x1B, 0x1A, 
-    0x19, 0x16, 0x15, 0x16, 0x19, 0x1D, 0x1D, 0x1D, 0x19, 0x15, 0x13, 0x14, 
-    0x18, 0x18, 0x16, 0x15, 0x18, 0x1A, 0x19, 0x19, 0x15, 0x14, 0x14, 0x12, 
-    0x10, 0x10, 0x0D, 0x0F, 0x12, 0x10, 0x12, 0x0F, 0x0F, 0x0E, 0x0F, 0x0F, 
-    0x0B, 0x09, 0x07, 0x05, 0x06, 0x06, 0x02, 0xFE, 0xFA, 0xF4, 0xF3, 0xF4, 
-    0xF4, 0xF7, 0xF5, 0xF4, 0xEC, 0xED, 0xEE, 0xEB, 0xED, 0xE8, 0xE9, 0xE8, 
-    0xE6, 0xE7, 0xE8, 0xE8, 0xEB, 0xED, 0xED, 0xEF, 0xF1, 0xF7, 0xFC, 0xFD, 
-    0xFB, 0xF9, 0xF8, 0xF9, 0xFC, 0xFF, 0x03, 0x03, 0x05, 0x06, 0x03, 0xFF, 
-    0xFC, 0xF9, 0xF6, 0xF3, 0xF0, 0xEF, 0xF1, 0xF2, 0xF4, 0xF4, 0xF3, 0xF5, 
-    0xF3, 0xF1, 0xF0, 0xEF, 0xF1, 0xF5, 0xFA, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE, 
-    0xFB, 0xF5, 0xF4, 0xF3, 0xF9, 0xFF, 0x05, 0x08, 0x05, 0x03, 0xFD, 0xFC, 
-    0xF9, 0xFB, 0xFE, 0x00, 0x03, 0x05, 0x04, 0x05, 0x07, 0x03, 0x01, 0xFB, 
-    0xF7, 0xF5, 0xF5, 0xF7, 0xF7, 0xF8, 0xFA, 0xFB, 0xFC, 0xF9, 0xF6, 0xF2, 
-    0xF0, 0xEC, 0xE8, 0xE7, 0xEA, 0xF0, 0xF7, 0xFB, 0xF7, 0xF3, 0xED, 0xEA, 
-    0xEB, 0xEF, 0xF2, 0xF3, 0xF3, 0xF2, 0xF2, 0xF4, 0xF4, 0xF4, 0xF3, 0xF3, 
-    0xF7, 0xF7, 0xF7, 0xF8, 0xF9, 0xFB, 0xFD, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-    0xFD, 0xFA, 0xF6, 0xF3, 0xF5, 0xF7, 0xF8, 0xF7, 0xF3, 0xF0, 0xEC, 0xE9, 
-    0xE8, 0xE7, 0xE7, 0xE8, 0xE8, 0xEA, 0xEB, 0xEE, 0xF1, 0xF6, 0xF9, 0xFD, 
-    0x00, 0x02, 0x05, 0x04, 0x03, 0x01, 0x01, 0x01, 0x04, 0x05, 0x07, 0x0A, 
-    0x0C, 0x0B, 0x09, 0x07, 0x06, 0x06, 0x08, 0x09, 0x09, 0x08, 0x05, 0x03, 
-    0x03, 0x04, 0x08, 0x0A, 0x0B, 0x0D, 0x10, 0x13, 0x18, 0x19, 0x19, 0x1A, 
-    0x1B, 0x1D, 0x1E, 0x1C, 0x1A, 0x18, 0x15, 0x16, 0x16, 0x14, 0x11, 0x0E, 
-    0x0C, 0x0B, 0x06, 0x00, 0xFA, 0xF7, 0xF9, 0xFE, 0x02, 0x03, 0x01, 0xFC, 
-    0xF7, 0xF2, 0xF3, 0xF4, 0xF9, 0xFC, 0x01, 0x08, 0x0F, 0x14, 0x17, 0x18, 
-    0x18, 0x1A, 0x1B, 0x1B, 0x1B, 0x1C, 0x1E, 0x1F, 0x21, 0x21, 0x21, 0x21, 
-    0x1D, 0x1B, 0x14, 0x0D, 0x07, 0x04, 0x06, 0x08, 0x09, 0x05, 0x02, 0xFA, 
-    0xF5, 0xF3, 0xF2, 0xF5, 0xF9, 0x00, 0x08, 0x10, 0x15, 0x18, 0x18, 0x17, 
-    0x16, 0x16, 0x17, 0x1B, 0x1D, 0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 
-    0x1C, 0x19, 0x16, 0x11, 0x0D, 0x0A, 0x0A, 0x08, 0x08, 0x04, 0x00, 0xFA, 
-    0xF4, 0xEF, 0xEB, 0xEC, 0xEF, 0xF2, 0xF4, 0xF4, 0xF5, 0xF5, 0xF4, 0xF2, 
-    0xEE, 0xEB, 0xEB, 0xEE, 0xEE, 0xED, 0xED, 0xED, 0xF1, 0xF3, 0xF5, 0xF5, 
-    0xF5, 0xF6, 0xF6, 0xF4, 0xEF, 0xEC, 0xEC, 0xF1, 0xF7, 0xFB, 0xFB, 0xF6, 
-    0xF2, 0xEC, 0xE9, 0xE7, 0xE6, 0xE9, 0xED, 0xF3, 0xF7, 0xFA, 0xFB, 0xFA, 
-    0xFA, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xFA, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 
-    0xFC, 0xF9, 0xF5, 0xF2, 0xEE, 0xEC, 0xEC, 0xEF, 0xF5, 0xF9, 0xFB, 0xFB, 
-    0xF6, 0xF3, 0xF2, 0xF5, 0xFA, 0xFE, 0x01, 0x02, 0x03, 0x02, 0x03, 0x03, 
-    0x01, 0xFE, 0xFD, 0xFE, 0x00, 0x04, 0x03, 0x04, 0x02, 0x01, 0x00, 0x01, 
-    0x03, 0x04, 0x02, 0x00, 0xFC, 0xF7, 0xF4, 0xF4, 0xF6, 0xF9, 0xF9, 0xF8, 
-    0xF4, 0xF1, 0xF0, 0xF2, 0xF3, 0xF4, 0xF3, 0xF1, 0xEF, 0xEE, 0xEE, 0xEE, 
-    0xEB, 0xE9, 0xE8, 0xE9, 0xEB, 0xEC, 0xEC, 0xED, 0xEF, 0xF2, 0xF3, 0xF5, 
-    0xF6, 0xF7, 0xF6, 0xF4, 0xF1, 0xEE, 0xEC, 0xED, 0xF2, 0xF8, 0xFB, 0xFC, 
-    0xFB, 0xFA, 0xF7, 0xF5, 0xF4, 0xF3, 0xF7, 0xFD, 0x01, 0x04, 0x07, 0x08, 
-    0x07, 0x06, 0x02, 0xFE, 0xFC, 0xFB, 0xFA, 0xFA, 0xF9, 0xFA, 0xFC, 0xFD, 
-    0xFE, 0xFD, 0xFC, 0xFB, 0xF9, 0xF6, 0xF4, 0xF6, 0xFC, 0x05, 0x0D, 0x11, 
-    0x13, 0x13, 0x12, 0x11, 0x10, 0x11, 0x15, 0x19, 0x1F, 0x24, 0x27, 0x29, 
-    0x29, 0x27, 0x24, 0x20, 0x1C, 0x1B, 0x1C, 0x1C, 0x1E, 0x1E, 0x1E, 0x1C, 
-    0x19, 0x15, 0x11, 0x0F, 0x0C, 0x08, 0x04, 0x02, 0x04, 0x0A, 0x11, 0x12, 
-    0x0F, 0x07, 0xFE, 0xF7, 0xF4, 0xF4, 0xF7, 0xFC, 0x02, 0x07, 0x0C, 0x0D, 
-    0x0D, 0x0C, 0x09, 0x07, 0x04, 0x04, 0x05, 0x07, 0x09, 0x09, 0x08, 0x07, 
-    0x08, 0x09, 0x08, 0x07, 0x06, 0x07, 0x08, 0x08, 0x0A, 0x0E, 0x13, 0x16, 
-    0x15, 0x10, 0x0C, 0x09, 0x07, 0x06, 0x07, 0x0A, 0x0E, 0x12, 0x12, 0x10, 
-    0x0D, 0x0A, 0x07, 0x03, 0x00, 0xFD, 0xFA, 0xF7, 0xF6, 0xF5, 0xF6, 0xF6, 
-    0xF7, 0xF9, 0xFB, 0xFC, 0xFB, 0xF8, 0xF4, 0xF2, 0xF2, 0xF4, 0xF9, 0xFD, 
-    0xFC, 0xFA, 0xF7, 0xF4, 0xF4, 0xF3, 0xF4, 0xF8, 0xFE, 0x04, 0x06, 0x07, 
-    0x09, 0x0A, 0x0D, 0x0D, 0x0B, 0x08, 0x06, 0x05, 0x04, 0x03, 0x00, 0xFF, 
-    0xFE, 0xFF, 0xFF, 0xFC, 0xF8, 0xF4, 0xEF, 0xEA, 0xE6, 0xE3, 0xE4, 0xE6, 
-    0xE8, 0xE7, 0xE6, 0xE4, 0xE3, 0xE2, 0xE2, 0xE5, 0xE7, 0xEC, 0xF0, 0xF4, 
-    0xF8, 0xF8, 0xF6, 0xF4, 0xF3, 0xF2, 0xF3, 0xF6, 0xF9, 0xFD, 0x00, 0x01, 
-    0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x02, 0xFE, 0xFA, 0xF6, 0xF6, 0xFA, 
-    0xFE, 0xFE, 0xFB, 0xF7, 0xF2, 0xEE, 0xEC, 0xE9, 0xE9, 0xEA, 0xE9, 0xE8, 
-    0xE6, 0xE6, 0xE5, 0xE4, 0xE3, 0xE1, 0xE2, 0xE4, 0xE8, 0xED, 0xF3, 0xF7, 
-    0xF9, 0xFC, 0xFF, 0x02, 0x05, 0x05, 0x00, 0xFB, 0xF8, 0xF8, 0xFB, 0x00, 
-    0x06, 0x09, 0x09, 0x08, 0x05, 0x00, 0xFC, 0xFB, 0xFE, 0x02, 0x08, 0x0A, 
-    0x09, 0x06, 0x03, 0x00, 0xFE, 0xFC, 0xFA, 0xFA, 0xFC, 0xFF, 0x01, 0x00, 
-    0xFE, 0xFD, 0xFC, 0xFB, 0xF9, 0xF6, 0xF4, 0xF1, 0xEF, 0xED, 0xEC, 0xF0, 
-    0xF7, 0xFD, 0xFF, 0xFE, 0xF9, 0xF4, 0xF2, 0xF2, 0xF4, 0xF7, 0xFA, 0xFB, 
-    0xFC, 0xFD, 0xFD, 0xFC, 0xFA, 0xF7, 0xF6, 0xF9, 0xFD, 0x00, 0x03, 0x06, 
-    0x09, 0x0D, 0x10, 0x10, 0x0F, 0x0E, 0x0C, 0x0B, 0x0B, 0x0B, 0x0C, 0x0F, 
-    0x13, 0x16, 0x15, 0x10, 0x0A, 0x04, 0x01, 0xFE, 0xFE, 0x02, 0x08, 0x0F, 
-    0x13, 0x14, 0x14, 0x13, 0x12, 0x11, 0x12, 0x13, 0x14, 0x16, 0x18, 0x1C, 
-    0x1D, 0x1C, 0x18, 0x15, 0x12, 0x11, 0x12, 0x12, 0x13, 0x12, 0x13, 0x14, 
-    0x18, 0x1B, 0x1B, 0x18, 0x13, 0x0F, 0x0A, 0x07, 0x04, 0x04, 0x08, 0x0C, 
-    0x0E, 0x0E, 0x0C, 0x0A, 0x09, 0x08, 0x06, 0x07, 0x08, 0x0B, 0x0D, 0x0D, 
-    0x0B, 0x09, 0x08, 0x08, 0x0A, 0x0D, 0x10, 0x12, 0x12, 0x10, 0x0D, 0x0A, 
-    0x0A, 0x0D, 0x0F, 0x0D, 0x08, 0x01, 0xFB, 0xF7, 0xF4, 0xF3, 0xF4, 0xF7, 
-    0xFA, 0xFD, 0xFD, 0xFC, 0xFA, 0xF9, 0xF6, 0xF4, 0xF7, 0xF8, 0xF8, 0xF9, 
-    0xFE, 0xFC, 0xF9, 0xF6, 0xF4, 0xF4, 0xF1, 0xED, 0xEE, 0xEB, 0xEA, 0xE4, 
-    0xE5, 0xE9, 0xEC, 0xF2, 0xEE, 0xE8, 0xE2, 0xE1, 0xDF, 0xE4, 0xE9, 0xEC, 
-    0xF3, 0xF7, 0xF8, 0xF8, 0xF9, 0xFB, 0xFE, 0xFF, 0xFF, 0xFB, 0xF9, 0xFA, 
-    0x00, 0x07, 0x0A, 0x0A, 0x08, 0x05, 0x06, 0x03, 0x04, 0x01, 0xFD, 0xFF, 
-    0xFD, 0x03, 0x06, 0x07, 0x08, 0x09, 0x08, 0x03, 0x08, 0x08, 0x08, 0x09, 
-    0x0B, 0x0B, 0x0C, 0x0A, 0x00, 0xFE, 0xF5, 0xF0, 0xF4, 0xF2, 0xEF, 0xEF, 
-    0xF5, 0xFC, 0xFC, 0xFA, 0xFB, 0xF6, 0xF3, 0xF2, 0xF4, 0xF7, 0xF0, 0xED, 
-    0xEE, 0xEE, 0xF7, 0xF6, 0xF3, 0xF1, 0xEC, 0xEB, 0xE7, 0xE6, 0xE7, 0xEB, 
-    0xF2, 0xF8, 0xFF, 0xFF, 0xFB, 0xF6, 0xEF, 0xEB, 0xE9, 0xE6, 0xE7, 0xEA, 
-    0xED, 0xED, 0xEF, 0xF0, 0xEB, 0xE2, 0xDB, 0xDA, 0xD9, 0xD8, 0xD5, 0xD1, 
-    0xCF, 0xD1, 0xD7, 0xDC, 0xE1, 0xE2, 0xDD, 0xDB, 0xDB, 0xDB, 0xDC, 0xDF, 
-    0xE6, 0xEC, 0xF0, 0xF4, 0xF4, 0xF2, 0xF0, 0xEF, 0xF2, 0xF7, 0xFD, 0x05, 
-    0x0E, 0x14, 0x17, 0x17, 0x14, 0x12, 0x10, 0x0F, 0x10, 0x0F, 0x0D, 0x09, 
-    0x06, 0x05, 0x08, 0x0D, 0x12, 0x13, 0x10, 0x0B, 0x06, 0x03, 0x03, 0x07, 
-    0x0D, 0x13, 0x19, 0x1D, 0x1D, 0x1D, 0x1B, 0x18, 0x16, 0x16, 0x1A, 0x1E, 
-    0x24, 0x29, 0x2D, 0x2D, 0x2B, 0x2C, 0x2B, 0x29, 0x26, 0x27, 0x28, 0x27, 
-    0x27, 0x25, 0x25, 0x27, 0x2A, 0x29, 0x27, 0x23, 0x20, 0x1C, 0x17, 0x14, 
-    0x15, 0x18, 0x18, 0x18, 0x13, 0x0C, 0x05, 0x00, 0xFB, 0xF9, 0xF7, 0xF3, 
-    0xF1, 0xF1, 0xF1, 0xF0, 0xED, 0xE8, 0xE4, 0xE2, 0xE2, 0xE3, 0xE4, 0xE4, 
-    0xE1, 0xDD, 0xDE, 0xE2, 0xE9, 0xEF, 0xEE, 0xEA, 0xE7, 0xE6, 0xE6, 0xEA, 
-    0xEF, 0xF4, 0xFA, 0x00, 0x06, 0x07, 0x08, 0x08, 0x08, 0x07, 0x06, 0x07, 
-    0x09, 0x0D, 0x0F, 0x0D, 0x0A, 0x08, 0x06, 0x05, 0x03, 0x03, 0x02, 0x02, 
-    0x01, 0x02, 0x01, 0x01, 0x02, 0x05, 0x07, 0x06, 0x02, 0xFA, 0xF6, 0xF8, 
-    0xFE, 0x05, 0x0B, 0x0E, 0x0F, 0x0E, 0x0D, 0x09, 0x05, 0x03, 0x05, 0x08, 
-    0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x0E, 0x0D, 0x0B, 0x09, 0x09, 0x08, 0x08, 
-    0x06, 0x05, 0x05, 0x08, 0x0E, 0x13, 0x13, 0x0F, 0x08, 0x01, 0xFA, 0xF7, 
-    0xF8, 0xFA, 0xFD, 0x00, 0x02, 0x02, 0xFF, 0xFA, 0xF5, 0xF1, 0xEF, 0xF1, 
-    0xF4, 0xF9, 0xFE, 0x05, 0x08, 0x0B, 0x0B, 0x0A, 0x09, 0x08, 0x09, 0x0B, 
-    0x0B, 0x0A, 0x07, 0x04, 0x02, 0x01, 0x00, 0xFC, 0xF5, 0xEE, 0xE7, 0xE4, 
-    0xE3, 0xE7, 0xED, 0xF1, 0xF4, 0xF1, 0xEE, 0xEA, 0xE6, 0xE1, 0xDD, 0xDA, 
-    0xDA, 0xDB, 0xDD, 0xE0, 0xDF, 0xDD, 0xD8, 0xD1, 0xCD, 0xCA, 0xC9, 0xCA, 
-    0xCB, 0xCA, 0xC9, 0xC8, 0xC8, 0xCB, 0xCE, 0xD0, 0xCF, 0xCC, 0xCA, 0xCB, 
-    0xCE, 0xD2, 0xD6, 0xDA, 0xE1, 0xE7, 0xEB, 0xEC, 0xE7, 0xE1, 0xDF, 0xDE, 
-    0xE1, 0xE5, 0xEB, 0xF1, 0xF6, 0xF6, 0xF4, 0xF1, 0xF0, 0xF0, 0xF1, 0xF4, 
-    0xF7, 0xFB, 0xFD, 0x00, 0x01, 0x05, 0x0A, 0x0F, 0x13, 0x11, 0x0D, 0x09, 
-    0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x0D, 0x0B, 0x0A, 0x0B, 
-    0x0F, 0x14, 0x19, 0x1F, 0x23, 0x27, 0x29, 0x29, 0x27, 0x26, 0x25, 0x26, 
-    0x29, 0x2B, 0x29, 0x26, 0x23, 0x22, 0x24, 0x27, 0x27, 0x23, 0x1E, 0x19, 
-    0x17, 0x19, 0x1C, 0x20, 0x23, 0x25, 0x27, 0x28, 0x27, 0x24, 0x1F, 0x1B, 
-    0x1A, 0x1A, 0x1B, 0x1D, 0x1E, 0x1E, 0x1E, 0x1C, 0x18, 0x13, 0x0E, 0x0B, 
-    0x08, 0x06, 0x05, 0x04, 0x03, 0x04, 0x06, 0x07, 0x07, 0x05, 0x01, 0xFC, 
-    0xF9, 0xF9, 0xFB, 0xFD, 0xFD, 0xFE, 0xFC, 0xFB, 0xF7, 0xF3, 0xEF, 0xEB, 
-    0xEA, 0xEA, 0xEC, 0xF1, 0xF4, 0xF8, 0xF9, 0xF9, 0xF8, 0xF6, 0xF4, 0xF1, 
-    0xEF, 0xEE, 0xEF, 0xEF, 0xF0, 0xF1, 0xF3, 0xF6, 0xFA, 0xFB, 0xF9, 0xF4, 
-    0xF1, 0xF0, 0xF4, 0xFA, 0x01, 0x05, 0x09, 0x0B, 0x0D, 0x0C, 0x0A, 0x08, 
-    0x07, 0x09, 0x0D, 0x10, 0x14, 0x16, 0x19, 0x19, 0x18, 0x15, 0x12, 0x14, 
-    0x17, 0x1C, 0x21, 0x21, 0x21, 0x20, 0x21, 0x24, 0x27, 0x26, 0x21, 0x1B, 
-    0x14, 0x10, 0x0F, 0x11, 0x14, 0x16, 0x17, 0x15, 0x12, 0x0D, 0x07, 0x01, 
-    0xFD, 0xFC, 0xFD, 0x01, 0x05, 0x08, 0x0B, 0x0A, 0x07, 0x03, 0xFF, 0xFC, 
-    0xFA, 0xFB, 0xFC, 0xFB, 0xFA, 0xF9, 0xF9, 0xFB, 0xFC, 0xFE, 0xFF, 0xFD, 
-    0xFA, 0xF7, 0xF6, 0xF8, 0xFC, 0x00, 0x02, 0x06, 0x07, 0x06, 0x05, 0x01, 
-    0xFE, 0xFC, 0xFD, 0x00, 0x02, 0x03, 0x02, 0x00, 0xFD, 0xFA, 0xF7, 0xF3, 
-    0xF0, 0xEF, 0xEF, 0xF0, 0xEF, 0xED, 0xE9, 0xE7, 0xE6, 0xE7, 0xE6, 0xE1, 
-    0xDA, 0xD5, 0xD2, 0xD3, 0xD7, 0xDA, 0xDC, 0xDE, 0xE0, 0xE1, 0xDF, 0xDC, 
-    0xDA, 0xD9, 0xDA, 0xDB, 0xDD, 0xDE, 0xE1, 0xE4, 0xE7, 0xE6, 0xE2, 0xE0, 
-    0xE0, 0xE3, 0xE4, 0xE5, 0xE3, 0xE2, 0xE3, 0xE5, 0xE9, 0xEB, 0xEC, 0xE9, 
-    0xE2, 0xDC, 0xD8, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDA, 0xD8, 0xD5, 
-    0xD3, 0xD2, 0xD5, 0xDA, 0xE0, 0xE6, 0xEA, 0xEE, 0xF0, 0xF1, 0xF0, 0xEE, 
-    0xEC, 0xEA, 0xE9, 0xE8, 0xE9, 0xE8, 0xE7, 0xE6, 0xE6, 0xE7, 0xE9, 0xE9, 
-    0xE5, 0xDF, 0xDC, 0xDC, 0xE1, 0xE8, 0xEE, 0xF3, 0xF7, 0xF9, 0xF9, 0xF7, 
-    0xF2, 0xED, 0xEC, 0xEE, 0xF3, 0xF7, 0xFA, 0xFE, 0x00, 0x01, 0x01, 0x00, 
-    0x01, 0x01, 0x04, 0x07, 0x0A, 0x0D, 0x10, 0x14, 0x18, 0x1D, 0x21, 0x24, 
-    0x25, 0x24, 0x24, 0x26, 0x2A, 0x2F, 0x34, 0x39, 0x3D, 0x3F, 0x3F, 0x3D, 
-    0x3A, 0x37, 0x37, 0x38, 0x3B, 0x3D, 0x3C, 0x3D, 0x3C, 0x3B, 0x37, 0x32, 
-    0x2D, 0x2B, 0x2C, 0x2E, 0x30, 0x2F, 0x2D, 0x2A, 0x28, 0x28, 0x27, 0x25, 
-    0x21, 0x1C, 0x17, 0x15, 0x16, 0x19, 0x1B, 0x1C, 0x1B, 0x19, 0x15, 0x14, 
-    0x13, 0x12, 0x11, 0x13, 0x17, 0x1F, 0x25, 0x28, 0x28, 0x27, 0x26, 0x25, 
-    0x24, 0x22, 0x20, 0x21, 0x22, 0x21, 0x21, 0x20, 0x1E, 0x1C, 0x1B, 0x19, 
-    0x15, 0x11, 0x0C, 0x08, 0x05, 0x04, 0x05, 0x07, 0x09, 0x0B, 0x09, 0x06, 
-    0x01, 0xFE, 0xFC, 0xFD, 0xFF, 0x01, 0x02, 0x03, 0x02, 0x01, 0xFE, 0xFA, 
-    0xF7, 0xF4, 0xF1, 0xEF, 0xEF, 0xEF, 0xEE, 0xEA, 0xE7, 0xE5, 0xE7, 0xE9, 
-    0xE8, 0xE4, 0xDF, 0xDB, 0xD9, 0xDA, 0xD9, 0xDA, 0xDB, 0xDE, 0xE0, 0xE0, 
-    0xDD, 0xD8, 0xD4, 0xD1, 0xD2, 0xD4, 0xD8, 0xDA, 0xDC, 0xDE, 0xE1, 0xE1, 
-    0xDF, 0xDD, 0xDB, 0xDA, 0xD9, 0xD9, 0xD8, 0xD7, 0xD4, 0xD1, 0xD2, 0xD4, 
-    0xD7, 0xD7, 0xD4, 0xD0, 0xCD, 0xCC, 0xCD, 0xD0, 0xD1, 0xD2, 0xD4, 0xD5, 
-    0xD5, 0xD3, 0xD0, 0xCD, 0xCE, 0xD2, 0xD6, 0xD9, 0xDA, 0xDC, 0xDF, 0xE1, 
-    0xE0, 0xDD, 0xDB, 0xDC, 0xDE, 0xE1, 0xE3, 0xE5, 0xE6, 0xE7, 0xE9, 0xEA, 
-    0xEA, 0xE9, 0xE7, 0xE4, 0xE1, 0xE0, 0xE2, 0xE5, 0xEA, 0xF0, 0xF3, 0xF4, 
-    0xF3, 0xF1, 0xF0, 0xEF, 0xEE, 0xEF, 0xF4, 0xFA, 0x00, 0x02, 0x03, 0x02, 
-    0x00, 0xFE, 0xFD, 0xFB, 0xFA, 0xFB, 0xFA, 0xFB, 0xFA, 0xFA, 0xF9, 0xFB, 
-    0xFC, 0xFC, 0xFB, 0xF9, 0xF8, 0xFA, 0xFD, 0x02, 0x08, 0x0C, 0x10, 0x11, 
-    0x11, 0x0D, 0x08, 0x03, 0x00, 0x00, 0x02, 0x05, 0x09, 0x0A, 0x0B, 0x0A, 
-    0x08, 0x04, 0x01, 0x00, 0x02, 0x06, 0x08, 0x09, 0x08, 0x06, 0x05, 0x03, 
-    0x02, 0x01, 0xFF, 0xFD, 0xFB, 0xFA, 0xFB, 0xFE, 0x00, 0x03, 0x05, 0x07, 
-    0x08, 0x07, 0x08, 0x07, 0x07, 0x09, 0x0E, 0x16, 0x1D, 0x21, 0x24, 0x25, 
-    0x25, 0x25, 0x23, 0x1F, 0x1F, 0x21, 0x25, 0x27, 0x27, 0x26, 0x24, 0x22, 
-    0x1D, 0x18, 0x12, 0x0F, 0x0C, 0x0A, 0x08, 0x07, 0x08, 0x0B, 0x0D, 0x0D, 
-    0x0D, 0x0C, 0x0B, 0x0A, 0x0A, 0x0B, 0x0D, 0x10, 0x14, 0x18, 0x1B, 0x1D, 
-    0x1D, 0x1C, 0x1A, 0x16, 0x12, 0x10, 0x0F, 0x0E, 0x0C, 0x0A, 0x09, 0x0A, 
-    0x0D, 0x0F, 0x0E, 0x0C, 0x0A, 0x09, 0x08, 0x0A, 0x0C, 0x0F, 0x13, 0x13, 
-    0x12, 0x13, 0x12, 0x12, 0x11, 0x0E, 0x0C, 0x0B, 0x0E, 0x12, 0x14, 0x13, 
-    0x11, 0x0F, 0x0E, 0x0D, 0x0A, 0x06, 0x01, 0xFE, 0xFB, 0xFA, 0xF8, 0xF7, 
-    0xF6, 0xF9, 0xFD, 0x00, 0x01, 0x01, 0x00, 0xFE, 0xFF, 0x01, 0x05, 0x08, 
-    0x0A, 0x0B, 0x0B, 0x09, 0x07, 0x05, 0x05, 0x04, 0x06, 0x07, 0x08, 0x08, 
-    0x07, 0x07, 0x05, 0x03, 0xFF, 0xFC, 0xFB, 0xFA, 0xFB, 0xFC, 0xFB, 0xFA, 
-    0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF5, 0xF5, 0xF6, 0xF7, 0xFA, 0xFE, 0x02, 
-    0x05, 0x08, 0x09, 0x08, 0x06, 0x03, 0x02, 0x03, 0x05, 0x07, 0x0B, 0x0F, 
-    0x11, 0x14, 0x15, 0x13, 0x0F, 0x0C, 0x0A, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 
-    0x14, 0x14, 0x14, 0x11, 0x0C, 0x05, 0xFE, 0xFA, 0xF9, 0xFA, 0xFC, 0xFC, 
-    0xFB, 0xFA, 0xF9, 0xF9, 0xF8, 0xF7, 0xF6, 0xF6, 0xF8, 0xFB, 0xFE, 0xFE, 
-    0xFF, 0xFD, 0xF9, 0xF5, 0xF0, 0xEC, 0xEB, 0xEB, 0xEB, 0xED, 0xEF, 0xF2, 
-    0xF6, 0xF8, 0xF8, 0xF7, 0xF4, 0xF2, 0xF2, 0xF1, 0xF2, 0xF4, 0xF8, 0xFC, 
-    0xFE, 0xFF, 0xFD, 0xF9, 0xF5, 0xF1, 0xEE, 0xED, 0xED, 0xF0, 0xF2, 0xF3, 
-    0xF1, 0xEC, 0xE9, 0xE6, 0xE4, 0xE2, 0xE0, 0xDD, 0xDE, 0xDE, 0xE0, 0xE1, 
-    0xE1, 0xE1, 0xE0, 0xDE, 0xDA, 0xD7, 0xD4, 0xD3, 0xD5, 0xD9, 0xDC, 0xDE, 
-    0xDF, 0xDE, 0xDD, 0xDE, 0xDC, 0xD8, 0xD4, 0xD1, 0xD3, 0xD6, 0xD9, 0xDD, 
-    0xE0, 0xE2, 0xE4, 0xE6, 0xE7, 0xE7, 0xE6, 0xE6, 0xE5, 0xE6, 0xE7, 0xE9, 
-    0xE8, 0xE9, 0xEB, 0xEE, 0xF0, 0xEF, 0xEE, 0xEF, 0xF1, 0xF4, 0xF8, 0xFD, 
-    0x02, 0x07, 0x0B, 0x0C, 0x0D, 0x0C, 0x0B, 0x08, 0x04, 0x01, 0xFE, 0xFC, 
-    0xFA, 0xF9, 0xF7, 0xF6, 0xF8, 0xFA, 0xFC, 0xFE, 0xFF, 0x00, 0x01, 0x03, 
-    0x05, 0x06, 0x09, 0x0A, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x12, 0x17, 0x1C, 
-    0x21, 0x22, 0x23, 0x22, 0x21, 0x1F, 0x1C, 0x18, 0x14, 0x13, 0x13, 0x14, 
-    0x15, 0x15, 0x16, 0x15, 0x13, 0x11, 0x0E, 0x0E, 0x10, 0x13, 0x14, 0x14, 
-    0x16, 0x18, 0x1C, 0x1F, 0x22, 0x22, 0x1E, 0x1A, 0x16, 0x16, 0x18, 0x1A, 
-    0x1D, 0x1D, 0x1D, 0x1A, 0x17, 0x14, 0x11, 0x0D, 0x0B, 0x0D, 0x0F, 0x13, 
-    0x16, 0x18, 0x1A, 0x1B, 0x1A, 0x1A, 0x19, 0x17, 0x15, 0x13, 0x11, 0x11, 
-    0x11, 0x13, 0x14, 0x14, 0x12, 0x10, 0x0F, 0x0C, 0x0B, 0x09, 0x08, 0x07, 
-    0x07, 0x06, 0x04, 0x00, 0xFC, 0xF9, 0xF5, 0xF3, 0xF1, 0xF0, 0xF1, 0xF2, 
-    0xF4, 0xF6, 0xF7, 0xF6, 0xF7, 0xF7, 0xF8, 0xFA, 0xFC, 0x00, 0x04, 0x06, 
-    0x06, 0x07, 0x07, 0x07, 0x06, 0x05, 0x02, 0x00, 0xFE, 0xFD, 0xFF, 0xFF, 
-    0x00, 0xFF, 0xFC, 0xFA, 0xF8, 0xF6, 0xF4, 0xF1, 0xEE, 0xED, 0xEE, 0xF0, 
-    0xF2, 0xF3, 0xF3, 0xF2, 0xF0, 0xEE, 0xED, 0xEE, 0xEE, 0xEF, 0xEE, 0xEE, 
-    0xEF, 0xF0, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xEF, 0xF0, 0xF2, 0xF4, 0xF5, 
-    0xF6, 0xF7, 0xFA, 0xFD, 0xFF, 0x00, 0xFF, 0xFD, 0xFB, 0xF9, 0xF9, 0xFA, 
-    0xFC, 0xFD, 0xFC, 0xFA, 0xF8, 0xF6, 0xF5, 0xF3, 0xF0, 0xEE, 0xED, 0xEC, 
-    0xED, 0xEE, 0xEF, 0xEE, 0xEF, 0xF0, 0xEF, 0xED, 0xE9, 0xE5, 0xE2, 0xE1, 
-    0xE1, 0xE2, 0xE3, 0xE3, 0xE2, 0xE1, 0xE1, 0xE0, 0xDF, 0xDE, 0xDF, 0xE3, 
-    0xE6, 0xE8, 0xEB, 0xEE, 0xF1, 0xF3, 0xF5, 0xF6, 0xF7, 0xF7, 0xF8, 0xFA, 
-    0xFB, 0xFD, 0xFE, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0xFA, 0xF6, 0xF4, 0xF5, 
-    0xF4, 0xF5, 0xF4, 0xF3, 0xF4, 0xF4, 0xF3, 0xF2, 0xF2, 0xF2, 0xF3, 0xF5, 
-    0xF9, 0xFD, 0x01, 0x06, 0x0B, 0x0E, 0x0F, 0x0E, 0x0D, 0x0D, 0x0F, 0x11, 
-    0x13, 0x15, 0x17, 0x18, 0x18, 0x17, 0x15, 0x13, 0x11, 0x0F, 0x0D, 0x0E, 
-    0x10, 0x15, 0x1A, 0x1C, 0x1D, 0x1C, 0x1D, 0x1C, 0x1C, 0x1A, 0x18, 0x16, 
-    0x17, 0x17, 0x17, 0x18, 0x19, 0x1A, 0x1A, 0x1A, 0x19, 0x1A, 0x1A, 0x1B, 
-    0x1B, 0x1D, 0x20, 0x21, 0x21, 0x1F, 0x1E, 0x1D, 0x19, 0x14, 0x0E, 0x0B, 
-    0x0B, 0x0B, 0x0C, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x10, 0x10, 
-    0x13, 0x19, 0x1F, 0x21, 0x22, 0x22, 0x24, 0x25, 0x24, 0x20, 0x1B, 0x17, 
-    0x16, 0x15, 0x14, 0x11, 0x0D, 0x0A, 0x07, 0x03, 0xFF, 0xFB, 0xF6, 0xF3, 
-    0xF3, 0xF7, 0xFB, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0x01, 0x03, 0x04, 0x03, 
-    0x02, 0x02, 0x01, 0x00, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xF9, 0xF6, 0xF4, 
-    0xF0, 0xEC, 0xE9, 0xE7, 0xE5, 0xE3, 0xE2, 0xE2, 0xE3, 0xE2, 0xE1, 0xE0, 
-    0xE2, 0xE5, 0xE7, 0xEA, 0xEC, 0xEF, 0xF0, 0xEF, 0xEE, 0xEC, 0xED, 0xEC, 
-    0xEC, 0xED, 0xEE, 0xEF, 0xF1, 0xF2, 0xF3, 0xF2, 0xEF, 0xEC, 0xE9, 0xE6, 
-    0xE5, 0xE6, 0xE7, 0xE8, 0xE8, 0xE7, 0xE8, 0xE9, 0xE9, 0xE6, 0xE2, 0xDF, 
-    0xDD, 0xE0, 0xE5, 0xE9, 0xEC, 0xED, 0xEE, 0xEF, 0xF1, 0xF3, 0xF3, 0xF2, 
-    0xF3, 0xF5, 0xF7, 0xF9, 0xF9, 0xF8, 0xF8, 0xF9, 0xFA, 0xFB, 0xFA, 0xF8, 
-    0xF6, 0xF3, 0xF1, 0xF0, 0xEF, 0xED, 0xEC, 0xEC, 0xEB, 0xEA, 0xE7, 0xE4, 
-    0xE1, 0xE1, 0xE3, 0xE6, 0xE9, 0xED, 0xF0, 0xF1, 0xF0, 0xEF, 0xEE, 0xED, 
-    0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF1, 0xF2, 0xF3, 0xF3, 0xF1, 0xEE, 0xEC, 
-    0xEB, 0xEB, 0xEA, 0xEB, 0xED, 0xF0, 0xF3, 0xF6, 0xF7, 0xF7, 0xF6, 0xF4, 
-    0xF2, 0xF3, 0xF6, 0xF9, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0x00, 0x00, 0x01, 
-    0x03, 0x04, 0x06, 0x09, 0x0B, 0x0A, 0x08, 0x07, 0x06, 0x04, 0x01, 0xFE, 
-    0xFC, 0xFA, 0xF8, 0xF7, 0xF7, 0xF9, 0xF9, 0xF9, 0xFA, 0xFC, 0xFE, 0xFF, 
-    0x00, 0x04, 0x09, 0x10, 0x18, 0x1E, 0x21, 0x24, 0x27, 0x2A, 0x2C, 0x2C, 
-    0x29, 0x25, 0x24, 0x25, 0x27, 0x27, 0x25, 0x22, 0x20, 0x1D, 0x1A, 0x16, 
-    0x13, 0x11, 0x0F, 0x0D, 0x0B, 0x0A, 0x0B, 0x0E, 0x10, 0x11, 0x13, 0x14, 
-    0x14, 0x13, 0x12, 0x13, 0x16, 0x19, 0x1A, 0x1A, 0x19, 0x1B, 0x1C, 0x1D, 
-    0x1C, 0x1D, 0x1C, 0x1E, 0x20, 0x21, 0x22, 0x21, 0x20, 0x1F, 0x1E, 0x1B, 
-    0x1A, 0x1B, 0x1C, 0x1C, 0x1C, 0x1D, 0x1C, 0x1C, 0x1D, 0x1C, 0x1B, 0x1A, 
-    0x19, 0x17, 0x15, 0x14, 0x14, 0x16, 0x18, 0x19, 0x19, 0x16, 0x12, 0x0E, 
-    0x0B, 0x09, 0x07, 0x06, 0x06, 0x05, 0x04, 0x02, 0x00, 0xFE, 0xFB, 0xF7, 
-    0xF4, 0xF3, 0xF3, 0xF4, 0xF5, 0xF4, 0xF5, 0xF8, 0xFB, 0xFE, 0x00, 0x00, 
-    0x00, 0xFD, 0xFB, 0xFB, 0xFD, 0x02, 0x05, 0x06, 0x05, 0x03, 0x00, 0xFD, 
-    0xFA, 0xF6, 0xF2, 0xEE, 0xEB, 0xE9, 0xE7, 0xE5, 0xE3, 0xE3, 0xE2, 0xDF, 
-    0xDC, 0xD9, 0xDA, 0xDC, 0xDF, 0xE2, 0xE4, 0xE5, 0xE7, 0xE9, 0xEA, 0xEA, 
-    0xE8, 0xE5, 0xE2, 0xE1, 0xE3, 0xE5, 0xE7, 0xE6, 0xE6, 0xE6, 0xE7, 0xE8, 
-    0xE9, 0xE9, 0xE9, 0xEA, 0xEC, 0xEE, 0xEE, 0xEF, 0xEE, 0xEF, 0xEE, 0xED, 
-    0xEC, 0xEB, 0xED, 0xEE, 0xEF, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 
-    0xEE, 0xED, 0xEB, 0xEC, 0xEE, 0xF0, 0xF3, 0xF6, 0xF8, 0xFA, 0xFB, 0xFD, 
-    0xFE, 0xFD, 0xFC, 0xFB, 0xF9, 0xF8, 0xF9, 0xF8, 0xF7, 0xF5, 0xF4, 0xF2, 
-    0xF0, 0xEE, 0xED, 0xEE, 0xF0, 0xF1, 0xF3, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 
-    0xF8, 0xF9, 0xF7, 0xF5, 0xF4, 0xF6, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xF8, 
-    0xF5, 0xF2, 0xF0, 0xF0, 0xEF, 0xF0, 0xF1, 0xF1, 0xF2, 0xF2, 0xF3, 0xF5, 
-    0xF6, 0xF4, 0xF2, 0xF2, 0xF3, 0xF4, 0xF5, 0xF4, 0xF6, 0xF9, 0xFC, 0xFE, 
-    0xFF, 0xFE, 0xFD, 0xFD, 0xFE, 0x01, 0x03, 0x04, 0x05, 0x04, 0x03, 0x02, 
-    0x01, 0x02, 0x01, 0x00, 0xFD, 0xFC, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0x02, 
-    0x05, 0x07, 0x07, 0x06, 0x06, 0x08, 0x09, 0x09, 0x0A, 0x0C, 0x0F, 0x10, 
-    0x10, 0x11, 0x11, 0x13, 0x15, 0x17, 0x18, 0x1A, 0x1C, 0x1D, 0x1C, 0x19, 
-    0x15, 0x11, 0x0E, 0x0C, 0x0B, 0x0B, 0x0B, 0x0D, 0x0F, 0x11, 0x12, 0x15, 
-    0x18, 0x1A, 0x1C, 0x1E, 0x20, 0x21, 0x23, 0x24, 0x26, 0x26, 0x26, 0x23, 
-    0x21, 0x1D, 0x19, 0x15, 0x12, 0x14, 0x12, 0x0F, 0x08, 0x01, 0xFC, 0xFA, 
-    0xF9, 0xFA, 0xF9, 0xFC, 0xFD, 0xFF, 0x05, 0x04, 0xFE, 0xFD, 0xFF, 0xFD, 
-    0xFD, 0xFB, 0xF7, 0xF0, 0xF0, 0xF3, 0xFB, 0xFE, 0xFD, 0xF1, 0xEE, 0xED, 
-    0xEB, 0xF5, 0xF3, 0xF6, 0xF9, 0xFD, 0xFD, 0xFC, 0xFC, 0xF6, 0xF4, 0xF7, 
-    0xF8, 0x00, 0x05, 0x06, 0x06, 0x06, 0x06, 0x02, 0xFC, 0xF5, 0xF8, 0xFB, 
-    0x07, 0x09, 0x0A, 0x04, 0xFD, 0xFD, 0xF7, 0xFF, 0xFC, 0xFF, 0x03, 0x06, 
-    0x0A, 0x0B, 0x0A, 0x0A, 0x02, 0xFB, 0x02, 0xFF, 0x03, 0x05, 0x03, 0x06, 
-    0x07, 0x02, 0xF8, 0xEF, 0xDE, 0xDC, 0xE3, 0xEA, 0xEC, 0xE8, 0xEB, 0xE9, 
-    0xE7, 0xE2, 0xE7, 0xE8, 0xEF, 0xFD, 0x07, 0x12, 0x10, 0x11, 0x0B, 0x05, 
-    0x09, 0x04, 0x05, 0x09, 0x01, 0xFC, 0xEF, 0xEA, 0xE5, 0xE0, 0xD8, 0xD3, 
-    0xD4, 0xDD, 0xEA, 0xEC, 0xEB, 0xE7, 0xE4, 0xE0, 0xE2, 0xE4, 0xE8, 0xE9, 
-    0xF4, 0xF3, 0xF1, 0xE7, 0xD6, 0xCF, 0xC4, 0xC3, 0xC4, 0xCD, 0xD3, 0xDA, 
-    0xDF, 0xE3, 0xE4, 0xE2, 0xDD, 0xD4, 0xCF, 0xD5, 0xDE, 0xE9, 0xF3, 0xED, 
-    0xEA, 0xE9, 0xEB, 0xEB, 0xEC, 0xED, 0xF0, 0xF4, 0xF5, 0xF8, 0xFC, 0x02, 
-    0x08, 0x0F, 0x19, 0x21, 0x26, 0x28, 0x25, 0x24, 0x1F, 0x1D, 0x17, 0x13, 
-    0x0E, 0x12, 0x1B, 0x1F, 0x22, 0x1A, 0x0C, 0x05, 0x04, 0x07, 0x0E, 0x15, 
-    0x21, 0x2B, 0x34, 0x3A, 0x3B, 0x34, 0x2D, 0x24, 0x20, 0x24, 0x25, 0x32, 
-    0x3A, 0x45, 0x4A, 0x4B, 0x46, 0x39, 0x2A, 0x1E, 0x1B, 0x1E, 0x21, 0x1E, 
-    0x19, 0x12, 0x11, 0x0A, 0x07, 0x01, 0xFF, 0x01, 0x04, 0x0C, 0x12, 0x12, 
-    0x10, 0x0A, 0x03, 0x00, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x06, 0x01, 0xF9, 
-    0xF1, 0xE9, 0xE2, 0xEA, 0xF0, 0xF9, 0xF5, 0xF0, 0xE9, 0xE3, 0xE0, 0xDA, 
-    0xD6, 0xD6, 0xDA, 0xE1, 0xE9, 0xE5, 0xE3, 0xD9, 0xD5, 0xD2, 0xD1, 0xD5, 
-    0xD6, 0xDF, 0xE4, 0xE9, 0xEB, 0xE6, 0xE2, 0xDC, 0xDC, 0xDD, 0xE5, 0xF0, 
-    0xF5, 0xF7, 0xF3, 0xF2, 0xF0, 0xF3, 0xF5, 0xF9, 0xFB, 0xFA, 0xFF, 0xFE, 
-    0xFB, 0xF4, 0xED, 0xEB, 0xEE, 0xF1, 0xF8, 0xFC, 0x02, 0x08, 0x0C, 0x0F, 
-    0x0F, 0x11, 0x11, 0x16, 0x21, 0x2D, 0x33, 0x34, 0x2C, 0x24, 0x1D, 0x18, 
-    0x17, 0x19, 0x1B, 0x1E, 0x23, 0x21, 0x1F, 0x19, 0x11, 0x0A, 0x03, 0x00, 
-    0x03, 0x09, 0x13, 0x1F, 0x26, 0x28, 0x26, 0x1D, 0x14, 0x0B, 0x06, 0x07, 
-    0x09, 0x08, 0x08, 0x04, 0x00, 0x02, 0x04, 0x04, 0x05, 0x0A, 0x10, 0x16, 
-    0x17, 0x18, 0x15, 0x12, 0x0C, 0x04, 0xFD, 0xF8, 0xF6, 0xF3, 0xF2, 0xEE, 
-    0xED, 0xE5, 0xE0, 0xD9, 0xD6, 0xDB, 0xDE, 0xE1, 0xDB, 0xD5, 0xCD, 0xCD, 
-    0xD0, 0xD5, 0xDB, 0xE0, 0xEB, 0xF1, 0xF3, 0xEF, 0xE8, 0xDE, 0xD5, 0xCF, 
-    0xCB, 0xCF, 0xD4, 0xDC, 0xDF, 0xE1, 0xDF, 0xDA, 0xD5, 0xCC, 0xCA, 0xCA, 
-    0xD3, 0xDD, 0xE2, 0xE2, 0xDC, 0xD7, 0xD4, 0xD5, 0xD8, 0xDC, 0xE2, 0xEC, 
-    0xF1, 0xF8, 0xFA, 0xFC, 0xFD, 0xFE, 0x00, 0x05, 0x0D, 0x16, 0x1D, 0x1F, 
-    0x20, 0x1D, 0x18, 0x0E, 0x03, 0xFB, 0xF7, 0xFA, 0xFC, 0xF9, 0xF5, 0xF2, 
-    0xF3, 0xF8, 0x00, 0x08, 0x10, 0x18, 0x20, 0x24, 0x26, 0x25, 0x22, 0x1D, 
-    0x19, 0x17, 0x18, 0x20, 0x2A, 0x35, 0x3D, 0x42, 0x43, 0x40, 0x3C, 0x31, 
-    0x2A, 0x28, 0x29, 0x2B, 0x27, 0x21, 0x1E, 0x1F, 0x26, 0x2C, 0x2F, 0x33, 
-    0x36, 0x3A, 0x3C, 0x3B, 0x3A, 0x35, 0x30, 0x29, 0x23, 0x24, 0x26, 0x29, 
-    0x2B, 0x29, 0x26, 0x21, 0x1B, 0x18, 0x14, 0x15, 0x19, 0x1C, 0x1A, 0x12, 
-    0x07, 0xFC, 0xF8, 0xF5, 0xF3, 0xF1, 0xF3, 0xF6, 0xFA, 0xFA, 0xF6, 0xEF, 
-    0xE4, 0xD9, 0xCF, 0xCD, 0xD0, 0xDA, 0xE2, 0xE9, 0xEA, 0xEA, 0xE8, 0xE2, 
-    0xDF, 0xDD, 0xE2, 0xE9, 0xEF, 0xF3, 0xF1, 0xEE, 0xED, 0xED, 0xEB, 0xE8, 
-    0xE1, 0xDD, 0xDA, 0xD8, 0xD7, 0xD3, 0xD0, 0xCB, 0xC8, 0xC8, 0xC9, 0xCB, 
-    0xCF, 0xD1, 0xD4, 0xD7, 0xDC, 0xE1, 0xE5, 0xE6, 0xE7, 0xEC, 0xEE, 0xEE, 
-    0xEB, 0xE5, 0xE3, 0xE4, 0xEB, 0xF2, 0xF7, 0xFC, 0xFD, 0xFD, 0xFD, 0xF9, 
-    0xF5, 0xEF, 0xEA, 0xE6, 0xE9, 0xF2, 0xFD, 0x09, 0x11, 0x16, 0x19, 0x17, 
-    0x11, 0x06, 0xFE, 0xFA, 0xFD, 0x01, 0x02, 0x00, 0xFD, 0xFC, 0x01, 0x0A, 
-    0x13, 0x1D, 0x27, 0x2E, 0x34, 0x35, 0x36, 0x34, 0x2B, 0x22, 0x17, 0x10, 
-    0x0F, 0x11, 0x13, 0x13, 0x12, 0x12, 0x0F, 0x0A, 0x06, 0x05, 0x0C, 0x12, 
-    0x16, 0x14, 0x10, 0x0F, 0x12, 0x1A, 0x22, 0x26, 0x28, 0x27, 0x25, 0x20, 
-    0x1B, 0x16, 0x0F, 0x06, 0xFA, 0xF2, 0xEE, 0xF0, 0xF4, 0xF5, 0xF5, 0xF4, 
-    0xF2, 0xEF, 0xEC, 0xE8, 0xEC, 0xF2, 0xF5, 0xF3, 0xEB, 0xE2, 0xDF, 0xE2, 
-    0xE6, 0xE8, 0xE7, 0xE7, 0xE8, 0xE9, 0xEB, 0xEE, 0xF0, 0xF1, 0xF2, 0xF4, 
-    0xFA, 0x03, 0x0E, 0x17, 0x1C, 0x1B, 0x18, 0x14, 0x0D, 0x04, 0xFB, 0xF9, 
-    0xF6, 0xF1, 0xE7, 0xDA, 0xD1, 0xCE, 0xD4, 0xDD, 0xE3, 0xEB, 0xF4, 0xFD, 
-    0x04, 0x07, 0x07, 0x02, 0xFC, 0xF5, 0xEF, 0xEF, 0xF3, 0xF9, 0xFF, 0x05, 
-    0x07, 0x0A, 0x09, 0x05, 0xFE, 0xFB, 0xFD, 0xFE, 0xFC, 0xF7, 0xF0, 0xEB, 
-    0xED, 0xF6, 0xFE, 0x03, 0x08, 0x0B, 0x0F, 0x10, 0x11, 0x10, 0x0E, 0x0C, 
-    0x08, 0x04, 0x02, 0x04, 0x07, 0x0A, 0x0D, 0x0E, 0x0D, 0x08, 0x01, 0xFC, 
-    0xFD, 0xFF, 0x00, 0xFD, 0xF6, 0xF0, 0xEF, 0xF4, 0xFB, 0x00, 0x01, 0xFF, 
-    0xFB, 0xF8, 0xF4, 0xF1, 0xEF, 0xED, 0xEB, 0xEA, 0xEB, 0xEF, 0xF6, 0xFE, 
-    0x06, 0x09, 0x0B, 0x08, 0x05, 0x04, 0x09, 0x15, 0x1E, 0x22, 0x1D, 0x14, 
-    0x0E, 0x0C, 0x10, 0x14, 0x13, 0x12, 0x0F, 0x0D, 0x0C, 0x0A, 0x07, 0x04, 
-    0x00, 0xFC, 0xFA, 0xFA, 0xFD, 0x02, 0x08, 0x0C, 0x10, 0x11, 0x0F, 0x0C, 
-    0x0C, 0x12, 0x17, 0x19, 0x15, 0x0E, 0x08, 0x08, 0x0E, 0x17, 0x1B, 0x1B, 
-    0x19, 0x18, 0x18, 0x18, 0x17, 0x15, 0x11, 0x0D, 0x0A, 0x08, 0x08, 0x0A, 
-    0x0D, 0x0F, 0x11, 0x13, 0x11, 0x0D, 0x08, 0x05, 0x08, 0x08, 0x05, 0xFD, 
-    0xF5, 0xF1, 0xF3, 0xFA, 0x03, 0x0A, 0x0D, 0x11, 0x14, 0x15, 0x11, 0x0B, 
-    0x03, 0xFB, 0xF5, 0xF1, 0xEE, 0xEE, 0xEF, 0xF0, 0xF1, 0xF3, 0xF6, 0xF4, 
-    0xF1, 0xED, 0xEF, 0xF3, 0xF5, 0xF3, 0xEF, 0xEB, 0xED, 0xF3, 0xFD, 0x04, 
-    0x08, 0x0A, 0x09, 0x07, 0x02, 0xFB, 0xF5, 0xEF, 0xED, 0xEB, 0xE9, 0xE5, 
-    0xE3, 0xE1, 0xE2, 0xE4, 0xE6, 0xE6, 0xE2, 0xDE, 0xDE, 0xE4, 0xED, 0xF1, 
-    0xEF, 0xE8, 0xDF, 0xDB, 0xDB, 0xDE, 0xDF, 0xDD, 0xDD, 0xDE, 0xE0, 0xE2, 
-    0xE4, 0xE7, 0xEB, 0xEE, 0xF0, 0xF1, 0xF3, 0xF5, 0xFB, 0x01, 0x06, 0x08, 
-    0x04, 0xFE, 0xF8, 0xF6, 0xF9, 0xF7, 0xEF, 0xE2, 0xD4, 0xCD, 0xCF, 0xD8, 
-    0xE2, 0xE8, 0xEA, 0xEC, 0xED, 0xEF, 0xF0, 0xF0, 0xF2, 0xF4, 0xF7, 0xFA, 
-    0xFD, 0xFF, 0x02, 0x04, 0x05, 0x05, 0x01, 0xFC, 0xF7, 0xF7, 0xFC, 0x00, 
-    0x00, 0xF9, 0xF0, 0xEA, 0xED, 0xF5, 0x01, 0x0C, 0x11, 0x16, 0x1A, 0x1E, 
-    0x20, 0x1E, 0x18, 0x10, 0x09, 0x04, 0x01, 0x00, 0x02, 0x06, 0x0B, 0x12, 
-    0x18, 0x19, 0x17, 0x14, 0x15, 0x18, 0x1A, 0x17, 0x11, 0x0C, 0x0B, 0x0D, 
-    0x13, 0x18, 0x18, 0x14, 0x0F, 0x0B, 0x06, 0x01, 0xFC, 0xF8, 0xF6, 0xF7, 
-    0xF9, 0xFB, 0xFC, 0xFB, 0xFB, 0xFE, 0x03, 0x07, 0x08, 0x07, 0x08, 0x0F, 
-    0x17, 0x1A, 0x16, 0x0C, 0x01, 0xFA, 0xF9, 0xFD, 0x02, 0x04, 0x04, 0x03, 
-    0x00, 0xFD, 0xF9, 0xF7, 0xF5, 0xF7, 0xF9, 0xFB, 0xFD, 0xFE, 0x00, 0x04, 
-    0x0A, 0x0E, 0x0D, 0x08, 0x01, 0xFF, 0x04, 0x08, 0x08, 0x02, 0xF8, 0xF2, 
-    0xF2, 0xF8, 0x00, 0x05, 0x04, 0x02, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 
-    0xFD, 0xF9, 0xF5, 0xF2, 0xF1, 0xF1, 0xF4, 0xF6, 0xF6, 0xF1, 0xEB, 0xE7, 
-    0xE9, 0xEF, 0xF0, 0xED, 0xE4, 0xDC, 0xDC, 0xE4, 0xF2, 0x01, 0x0A, 0x0F, 
-    0x12, 0x15, 0x15, 0x15, 0x11, 0x0A, 0x02, 0xF9, 0xF1, 0xEC, 0xE8, 0xE6, 
-    0xE5, 0xE6, 0xE7, 0xE7, 0xE6, 0xE5, 0xE8, 0xF0, 0xF5, 0xF7, 0xF2, 0xEA, 
-    0xE6, 0xE9, 0xF2, 0xFC, 0x03, 0x04, 0x01, 0xFE, 0xFC, 0xFA, 0xF9, 0xF5, 
-    0xF3, 0xF1, 0xF1, 0xF0, 0xEE, 0xED, 0xEC, 0xED, 0xEF, 0xF1, 0xF3, 0xF4, 
-    0xF5, 0xFB, 0x03, 0x09, 0x0A, 0x06, 0x00, 0xFE, 0x01, 0x06, 0x0C, 0x0E, 
-    0x0D, 0x0A, 0x09, 0x08, 0x07, 0x08, 0x06, 0x07, 0x09, 0x0C, 0x10, 0x15, 
-    0x1A, 0x21, 0x28, 0x2E, 0x30, 0x2E, 0x2A, 0x27, 0x28, 0x29, 0x29, 0x24, 
-    0x1A, 0x10, 0x0C, 0x0D, 0x12, 0x17, 0x17, 0x15, 0x13, 0x13, 0x16, 0x1A, 
-    0x1F, 0x22, 0x26, 0x28, 0x2B, 0x2B, 0x2C, 0x2C, 0x2D, 0x30, 0x32, 0x32, 
-    0x2E, 0x29, 0x26, 0x25, 0x21, 0x19, 0x0D, 0xFF, 0xF9, 0xFA, 0x02, 0x0F, 
-    0x18, 0x1B, 0x1A, 0x18, 0x17, 0x17, 0x17, 0x15, 0x13, 0x10, 0x0D, 0x0C, 
-    0x0A, 0x08, 0x07, 0x09, 0x0B, 0x0C, 0x0B, 0x0A, 0x0D, 0x15, 0x1E, 0x23, 
-    0x23, 0x1C, 0x16, 0x13, 0x13, 0x15, 0x19, 0x19, 0x15, 0x11, 0x0E, 0x0D, 
-    0x0E, 0x0B, 0x04, 0xFB, 0xF2, 0xEB, 0xE6, 0xE2, 0xE1, 0xE2, 0xE4, 0xE7, 
-    0xE9, 0xE9, 0xEB, 0xF0, 0xF8, 0xFB, 0xFA, 0xF3, 0xEA, 0xE5, 0xE6, 0xEB, 
-    0xF1, 0xF4, 0xF1, 0xE9, 0xE1, 0xDC, 0xD9, 0xD8, 0xD6, 0xD5, 0xD6, 0xDB, 
-    0xE1, 0xE4, 0xE6, 0xE5, 0xE5, 0xE4, 0xE3, 0xE1, 0xDF, 0xDF, 0xE4, 0xE8, 
-    0xE8, 0xE4, 0xDA, 0xD4, 0xD2, 0xD7, 0xDE, 0xE3, 0xE5, 0xE1, 0xDE, 0xDD, 
-    0xDF, 0xE2, 0xE4, 0xE4, 0xE4, 0xE5, 0xE6, 0xE7, 0xE7, 0xE6, 0xE5, 0xE5, 
-    0xE7, 0xE8, 0xE6, 0xE5, 0xE5, 0xE8, 0xE9, 0xE4, 0xDC, 0xD3, 0xCE, 0xD0, 
-    0xD8, 0xE4, 0xF0, 0xF7, 0xF9, 0xFA, 0xFB, 0xFC, 0xFB, 0xF7, 0xF2, 0xEB, 
-    0xE7, 0xE4, 0xE1, 0xDF, 0xDB, 0xD6, 0xD2, 0xD1, 0xCF, 0xCF, 0xD2, 0xDB, 
-    0xE6, 0xED, 0xED, 0xE7, 0xDF, 0xDD, 0xE1, 0xEA, 0xF2, 0xF7, 0xF7, 0xF4, 
-    0xF1, 0xF2, 0xF4, 0xF8, 0xFB, 0xFE, 0x00, 0x01, 0x01, 0xFF, 0xFB, 0xF8, 
-    0xF6, 0xF7, 0xF8, 0xF8, 0xFC, 0x03, 0x0E, 0x17, 0x17, 0x11, 0x09, 0x05, 
-    0x07, 0x10, 0x18, 0x1E, 0x1B, 0x14, 0x0C, 0x07, 0x06, 0x09, 0x0D, 0x11, 
-    0x16, 0x1A, 0x1E, 0x21, 0x22, 0x22, 0x23, 0x22, 0x21, 0x1D, 0x1B, 0x1D, 
-    0x24, 0x2E, 0x31, 0x2E, 0x25, 0x1B, 0x16, 0x18, 0x1E, 0x26, 0x2B, 0x29, 
-    0x25, 0x21, 0x1E, 0x1D, 0x1B, 0x17, 0x14, 0x12, 0x15, 0x18, 0x1B, 0x1D, 
-    0x1F, 0x21, 0x23, 0x23, 0x20, 0x1D, 0x1F, 0x23, 0x26, 0x22, 0x18, 0x0C, 
-    0x05, 0x06, 0x0E, 0x1A, 0x24, 0x2B, 0x2B, 0x27, 0x24, 0x22, 0x23, 0x22, 
-    0x22, 0x22, 0x23, 0x20, 0x1A, 0x11, 0x09, 0x04, 0x02, 0x03, 0x05, 0x07, 
-    0x0C, 0x14, 0x1E, 0x23, 0x21, 0x19, 0x0F, 0x0B, 0x0C, 0x10, 0x15, 0x17, 
-    0x15, 0x0D, 0x05, 0xFC, 0xF4, 0xF1, 0xF0, 0xF1, 0xF1, 0xF0, 0xEF, 0xEB, 
-    0xE8, 0xE7, 0xE8, 0xEA, 0xEB, 0xE9, 0xE8, 0xEB, 0xF4, 0xFF, 0x06, 0x06, 
-    0x01, 0xFA, 0xF8, 0xFD, 0x03, 0x08, 0x0A, 0x06, 0xFF, 0xF6, 0xEE, 0xE9, 
-    0xE8, 0xEA, 0xEE, 0xF2, 0xF5, 0xF4, 0xF3, 0xF1, 0xF0, 0xF1, 0xF0, 0xED, 
-    0xE7, 0xE4, 0xE6, 0xEC, 0xF1, 0xEE, 0xE4, 0xD8, 0xD2, 0xD5, 0xE0, 0xEE, 
-    0xFA, 0xFF, 0xFF, 0xFB, 0xF6, 0xF5, 0xF5, 0xF9, 0xFC, 0x01, 0x03, 0x03, 
-    0x00, 0xFD, 0xFB, 0xFC, 0xFC, 0xFC, 0xF7, 0xF1, 0xEF, 0xEF, 0xF0, 0xEC, 
-    0xE3, 0xD8, 0xCF, 0xCD, 0xD5, 0xE1, 0xEC, 0xF4, 0xF6, 0xF5, 0xF2, 0xF3, 
-    0xF7, 0xFB, 0xFE, 0x00, 0x00, 0xFD, 0xF8, 0xF1, 0xE9, 0xE4, 0xE0, 0xDF, 
-    0xDF, 0xE0, 0xE3, 0xED, 0xF9, 0x04, 0x09, 0x08, 0x03, 0xFF, 0x00, 0x06, 
-    0x0F, 0x14, 0x14, 0x0D, 0x04, 0xFB, 0xF3, 0xEF, 0xED, 0xEE, 0xF0, 0xF3, 
-    0xF6, 0xF8, 0xF7, 0xF5, 0xF3, 0xF4, 0xF5, 0xF4, 0xF2, 0xF3, 0xF9, 0x00, 
-    0x03, 0x00, 0xF9, 0xF3, 0xF3, 0xF8, 0x01, 0x07, 0x09, 0x05, 0xFB, 0xF4, 
-    0xF1, 0xF3, 0xFA, 0x02, 0x0C, 0x13, 0x17, 0x19, 0x18, 0x16, 0x16, 0x18, 
-    0x1C, 0x22, 0x25, 0x26, 0x27, 0x2A, 0x2B, 0x25, 0x1C, 0x10, 0x09, 0x08, 
-    0x0F, 0x17, 0x1E, 0x20, 0x1D, 0x17, 0x10, 0x0D, 0x0C, 0x0F, 0x11, 0x13, 
-    0x13, 0x15, 0x15, 0x14, 0x12, 0x10, 0x0E, 0x0F, 0x0E, 0x0C, 0x0D, 0x11, 
-    0x18, 0x1A, 0x15, 0x0C, 0x02, 0xFF, 0x04, 0x0F, 0x1C, 0x26, 0x2B, 0x29, 
-    0x25, 0x22, 0x21, 0x22, 0x24, 0x25, 0x24, 0x21, 0x1B, 0x13, 0x08, 0xFC, 
-    0xF1, 0xEB, 0xE9, 0xE8, 0xEB, 0xF2, 0xFC, 0x05, 0x09, 0x08, 0x04, 0x02, 
-    0x06, 0x0E, 0x18, 0x1F, 0x20, 0x1B, 0x11, 0x07, 0x00, 0xFB, 0xFA, 0xFB, 
-    0xFB, 0xF9, 0xF7, 0xF4, 0xF2, 0xF0, 0xEE, 0xED, 0xEC, 0xEC, 0xEA, 0xE9, 
-    0xEB, 0xF0, 0xF3, 0xF2, 0xED, 0xE6, 0xE3, 0xE5, 0xEB, 0xF1, 0xF5, 0xF4, 
-    0xEC, 0xE3, 0xDB, 0xD6, 0xD4, 0xD6, 0xD9, 0xDC, 0xE0, 0xE3, 0xE4, 0xE4, 
-    0xE2, 0xE0, 0xDF, 0xE0, 0xE1, 0xE2, 0xE6, 0xEB, 0xF1, 0xF0, 0xEA, 0xE0, 
-    0xD6, 0xD4, 0xD9, 0xE2, 0xEC, 0xF4, 0xF7, 0xF5, 0xF0, 0xEC, 0xEA, 0xEC, 
-    0xF0, 0xF5, 0xF9, 0xFC, 0xFE, 0xFF, 0xFD, 0xFC, 0xFD, 0xFE, 0x00, 0xFC, 
-    0xF9, 0xF6, 0xF5, 0xF3, 0xEC, 0xE2, 0xD8, 0xD3, 0xD4, 0xDB, 0xE2, 0xEA, 
-    0xEF, 0xF0, 0xEE, 0xEF, 0xF3, 0xFB, 0x03, 0x09, 0x0C, 0x0B, 0x07, 0xFF, 
-    0xF6, 0xED, 0xE6, 0xE3, 0xE3, 0xE4, 0xE4, 0xE8, 0xEE, 0xF4, 0xF7, 0xF7, 
-    0xF3, 0xF1, 0xF5, 0xFC, 0x06, 0x0D, 0x11, 0x0D, 0x03, 0xF5, 0xEA, 0xE4, 
-    0xE2, 0xE5, 0xEA, 0xF0, 0xF6, 0xFB, 0xFC, 0xFA, 0xF7, 0xF5, 0xF6, 0xFA, 
-    0xFD, 0xFF, 0x05, 0x0C, 0x10, 0x10, 0x0A, 0x02, 0xFE, 0x00, 0x06, 0x0C, 
-    0x10, 0x11, 0x0C, 0x01, 0xF8, 0xF3, 0xF4, 0xF8, 0xFC, 0x01, 0x06, 0x0A, 
-    0x0E, 0x0E, 0x0C, 0x0A, 0x0A, 0x0C, 0x0E, 0x0F, 0x10, 0x12, 0x15, 0x14, 
-    0x10, 0x0A, 0x06, 0x07, 0x0E, 0x18, 0x20, 0x26, 0x27, 0x24, 0x1E, 0x1A, 
-    0x18, 0x18, 0x1A, 0x1B, 0x1D, 0x1F, 0x23, 0x26, 0x24, 0x21, 0x1E, 0x1C, 
-    0x1D, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x18, 0x10, 0x06, 0x00, 0xFF, 0x03, 
-    0x0B, 0x13, 0x1A, 0x1F, 0x20, 0x21, 0x21, 0x22, 0x23, 0x25, 0x26, 0x25, 
-    0x24, 0x21, 0x1B, 0x12, 0x09, 0x01, 0xFD, 0xFD, 0xFE, 0x04, 0x0B, 0x13, 
-    0x19, 0x19, 0x16, 0x10, 0x0E, 0x12, 0x1C, 0x27, 0x2C, 0x2C, 0x23, 0x14, 
-    0x06, 0xFC, 0xF6, 0xF5, 0xF7, 0xFA, 0xFC, 0xFD, 0xFB, 0xF4, 0xEC, 0xE5, 
-    0xE2, 0xE4, 0xE8, 0xED, 0xF3, 0xF8, 0xFC, 0xFC, 0xF6, 0xEC, 0xE2, 0xDE, 
-    0xE1, 0xE8, 0xEF, 0xF0, 0xEE, 0xE8, 0xE1, 0xDE, 0xE0, 0xE7, 0xF0, 0xFA, 
-    0x03, 0x09, 0x0B, 0x09, 0x03, 0xFC, 0xF6, 0xF5, 0xF4, 0xF1, 0xEF, 0xED, 
-    0xEB, 0xEA, 0xE5, 0xDD, 0xD4, 0xCE, 0xCF, 0xD8, 0xE5, 0xF0, 0xF5, 0xF4, 
-    0xED, 0xE5, 0xE0, 0xDF, 0xE2, 0xE9, 0xF2, 0xFB, 0x00, 0x00, 0xFA, 0xF2, 
-    0xEC, 0xEB, 0xF0, 0xF6, 0xFC, 0x02, 0x06, 0x06, 0x01, 0xF7, 0xEA, 0xDC, 
-    0xD7, 0xDC, 0xE9, 0xF8, 0x03, 0x09, 0x08, 0x02, 0xFB, 0xF6, 0xF5, 0xF6, 
-    0xFA, 0xFE, 0x02, 0x01, 0xFA, 0xEE, 0xE2, 0xDA, 0xD7, 0xD8, 0xD9, 0xDB, 
-    0xDE, 0xE3, 0xE7, 0xE8, 0xE6, 0xE2, 0xE1, 0xE6, 0xF2, 0x00, 0x0A, 0x0E, 
-    0x0C, 0x02, 0xF5, 0xEA, 0xE5, 0xE5, 0xE8, 0xEE, 0xF3, 0xF6, 0xF5, 0xF1, 
-    0xEB, 0xE7, 0xE7, 0xEC, 0xF3, 0xFA, 0x03, 0x0B, 0x13, 0x14, 0x0E, 0x01, 
-    0xF2, 0xE9, 0xEA, 0xF1, 0xFB, 0x02, 0x02, 0xFB, 0xEE, 0xE4, 0xDF, 0xE2, 
-    0xEA, 0xF4, 0xFF, 0x09, 0x10, 0x14, 0x12, 0x0D, 0x08, 0x06, 0x08, 0x0B, 
-    0x0E, 0x12, 0x14, 0x16, 0x15, 0x0F, 0x06, 0x00, 0x02, 0x0C, 0x17, 0x20, 
-    0x25, 0x25, 0x1E, 0x16, 0x11, 0x11, 0x16, 0x1E, 0x26, 0x2B, 0x2C, 0x29, 
-    0x22, 0x17, 0x0F, 0x0B, 0x0B, 0x0D, 0x0E, 0x0E, 0x0F, 0x0E, 0x0B, 0x03, 
-    0xF9, 0xEE, 0xEA, 0xED, 0xF8, 0x04, 0x0E, 0x14, 0x16, 0x14, 0x0F, 0x0C, 
-    0x0D, 0x11, 0x17, 0x1F, 0x26, 0x2A, 0x29, 0x22, 0x18, 0x0D, 0x07, 0x06, 
-    0x06, 0x08, 0x0A, 0x0D, 0x0F, 0x0F, 0x0C, 0x08, 0x06, 0x0B, 0x16, 0x24, 
-    0x2F, 0x35, 0x35, 0x2B, 0x1C, 0x10, 0x07, 0x04, 0x07, 0x0A, 0x0E, 0x0F, 
-    0x0B, 0x05, 0xFB, 0xF4, 0xF3, 0xF9, 0x06, 0x0F, 0x19, 0x1D, 0x1D, 0x1D, 
-    0x15, 0x0B, 0xFF, 0xF6, 0xF3, 0xF8, 0xFD, 0xFF, 0x01, 0xF9, 0xEE, 0xDF, 
-    0xD8, 0xD4, 0xDC, 0xE5, 0xEE, 0xFF, 0x01, 0x04, 0x00, 0xF7, 0xF3, 0xEF, 
-    0xF1, 0xF6, 0xF6, 0xF9, 0xF8, 0xF7, 0xF6, 0xEE, 0xE5, 0xDE, 0xD8, 0xD9, 
-    0xE1, 0xE8, 0xEE, 0xF3, 0xEE, 0xED, 0xE9, 0xE8, 0xEF, 0xF5, 0x01, 0x06, 
-    0x0F, 0x0F, 0x0F, 0x09, 0x01, 0xFC, 0xF9, 0xFE, 0xFC, 0x02, 0x04, 0x02, 
-    0x04, 0xFF, 0xFA, 0xF5, 0xEE, 0xEE, 0xF2, 0xF6, 0xFB, 0xFB, 0xF5, 0xF0, 
-    0xE7, 0xE1, 0xE3, 0xE9, 0xF1, 0xFB, 0x03, 0x0A, 0x09, 0x08, 0x02, 0xF7, 
-    0xF6, 0xEF, 0xEF, 0xED, 0xE9, 0xE3, 0xDC, 0xD8, 0xD1, 0xCC, 0xCB, 0xD1, 
-    0xDA, 0xEB, 0xF7, 0x01, 0x08, 0x09, 0x04, 0x02, 0x00, 0x03, 0x07, 0x0A, 
-    0x0C, 0x09, 0x02, 0xF6, 0xEA, 0xDE, 0xD6, 0xD7, 0xDD, 0xE5, 0xEF, 0xF4, 
-    0xF9, 0xF8, 0xF7, 0xF4, 0xF1, 0xF2, 0xF7, 0x03, 0x0D, 0x17, 0x19, 0x19, 
-    0x0F, 0x03, 0xF8, 0xF1, 0xEF, 0xF4, 0xF9, 0x00, 0x05, 0x06, 0x04, 0xFA, 
-    0xF6, 0xEF, 0xF1, 0xF6, 0xFB, 0x00, 0x04, 0x06, 0x06, 0x06, 0x02, 0x00, 
-    0xFB, 0xFD, 0x02, 0x08, 0x0C, 0x0D, 0x0A, 0x06, 0xFF, 0xFE, 0x01, 0x09, 
-    0x11, 0x15, 0x1B, 0x19, 0x18, 0x12, 0x0B, 0x09, 0x0A, 0x11, 0x1A, 0x1F, 
-    0x22, 0x21, 0x1C, 0x17, 0x13, 0x0C, 0x09, 0x0A, 0x0E, 0x17, 0x1F, 0x21, 
-    0x1F, 0x18, 0x0B, 0x01, 0xF9, 0xF9, 0xFB, 0x02, 0x08, 0x0E, 0x11, 0x12, 
-    0x0D, 0x0B, 0x06, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFF, 0xFA, 0xF7, 0xF4, 
-    0xEE, 0xED, 0xEF, 0xF4, 0xFD, 0x03, 0x0A, 0x0C, 0x0E, 0x0B, 0x0C, 0x0E, 
-    0x10, 0x18, 0x18, 0x19, 0x16, 0x12, 0x09, 0x01, 0xF9, 0xF5, 0xF5, 0xF7, 
-    0xFC, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0x0C, 0x16, 0x1B, 
-    0x1B, 0x16, 0x0E, 0x02, 0xF5, 0xEF, 0xE9, 0xEA, 0xEB, 0xED, 0xEF, 0xF1, 
-    0xEE, 0xED, 0xE9, 0xE8, 0xEE, 0xF4, 0xFE, 0x04, 0x08, 0x09, 0x09, 0x06, 
-    0x05, 0x01, 0xFB, 0xF9, 0xF8, 0xF9, 0xF8, 0xF6, 0xF2, 0xEE, 0xE9, 0xE3, 
-    0xE3, 0xE3, 0xE8, 0xED, 0xF2, 0xF9, 0xFF, 0x03, 0x06, 0x07, 0x09, 0x0E, 
-    0x10, 0x12, 0x10, 0x0C, 0x06, 0x03, 0xFD, 0xF9, 0xF4, 0xF2, 0xF4, 0xF5, 
-    0xFA, 0xF9, 0xFB, 0xF9, 0xF4, 0xF0, 0xEF, 0xF4, 0xFD, 0x09, 0x12, 0x19, 
-    0x19, 0x17, 0x0F, 0x04, 0xFA, 0xF3, 0xF1, 0xF1, 0xF4, 0xF5, 0xF3, 0xF2, 
-    0xEF, 0xEC, 0xE7, 0xE5, 0xE6, 0xEE, 0xF5, 0xFA, 0xFD, 0xFB, 0xF7, 0xEE, 
-    0xE5, 0xE1, 0xE1, 0xE4, 0xE9, 0xEB, 0xED, 0xED, 0xED, 0xEA, 0xE8, 0xE9, 
-    0xEC, 0xF3, 0xF7, 0xF9, 0xF6, 0xF3, 0xF0, 0xEE, 0xEB, 0xEC, 0xEE, 0xF6, 
-    0xFF, 0x07, 0x0B, 0x08, 0x04, 0xFF, 0xFA, 0xF6, 0xF7, 0xFC, 0x02, 0x08, 
-    0x0A, 0x09, 0x05, 0xFF, 0xF9, 0xF4, 0xF3, 0xF9, 0x01, 0x09, 0x11, 0x13, 
-    0x15, 0x15, 0x14, 0x13, 0x10, 0x11, 0x11, 0x15, 0x16, 0x13, 0x0E, 0x05, 
-    0xFD, 0xF4, 0xF0, 0xF0, 0xF5, 0xFD, 0x05, 0x0B, 0x10, 0x13, 0x14, 0x17, 
-    0x18, 0x1D, 0x23, 0x29, 0x2C, 0x29, 0x22, 0x1D, 0x16, 0x12, 0x0E, 0x09, 
-    0x07, 0x07, 0x09, 0x07, 0x03, 0xFE, 0xF8, 0xF4, 0xF4, 0xFA, 0x02, 0x0D, 
-    0x19, 0x22, 0x27, 0x28, 0x23, 0x1C, 0x15, 0x10, 0x0E, 0x0B, 0x0B, 0x09, 
-    0x02, 0xFD, 0xF6, 0xF3, 0xED, 0xEB, 0xEB, 0xEF, 0xF7, 0xFF, 0x07, 0x0A, 
-    0x0D, 0x0A, 0x08, 0x07, 0x08, 0x0C, 0x11, 0x16, 0x18, 0x17, 0x12, 0x0C, 
-    0x03, 0xFD, 0xFA, 0xF9, 0xF9, 0xF9, 0xF7, 0xF3, 0xF0, 0xED, 0xED, 0xEE, 
-    0xF1, 0xF5, 0xFD, 0x05, 0x0A, 0x0B, 0x06, 0xFE, 0xF6, 0xF0, 0xF0, 0xF5, 
-    0xFB, 0x00, 0x02, 0x01, 0xFD, 0xF5, 0xEC, 0xE6, 0xE3, 0xE7, 0xEE, 0xF5, 
-    0xFA, 0xF9, 0xF7, 0xF2, 0xEE, 0xEA, 0xE5, 0xE5, 0xE8, 0xEE, 0xF3, 0xF6, 
-    0xF6, 0xF3, 0xEF, 0xEA, 0xE8, 0xEA, 0xF0, 0xF7, 0xFE, 0x03, 0x06, 0x06, 
-    0x03, 0x00, 0xFE, 0xFE, 0x00, 0x02, 0x04, 0x04, 0x01, 0xFE, 0xFB, 0xF8, 
-    0xF6, 0xF5, 0xF9, 0xFE, 0x04, 0x07, 0x06, 0x03, 0xFE, 0xF9, 0xF4, 0xF4, 
-    0xFA, 0x03, 0x0B, 0x11, 0x12, 0x10, 0x0A, 0x02, 0xFB, 0xF8, 0xFA, 0xFF, 
-    0x07, 0x0D, 0x0D, 0x08, 0x01, 0xF9, 0xF1, 0xEC, 0xEA, 0xED, 0xF4, 0xFC, 
-    0x00, 0x00, 0xFB, 0xF3, 0xE9, 0xE1, 0xDE, 0xDF, 0xE5, 0xEC, 0xF1, 0xF5, 
-    0xF5, 0xF4, 0xF2, 0xF0, 0xF3, 0xF7, 0xFE, 0x05, 0x08, 0x08, 0x07, 0x04, 
-    0x00, 0xFB, 0xF6, 0xF4, 0xF5, 0xF7, 0xF8, 0xF4, 0xEE, 0xE7, 0xDE, 0xD9, 
-    0xD8, 0xDE, 0xE7, 0xF3, 0xFF, 0x07, 0x0C, 0x0D, 0x0C, 0x0B, 0x0B, 0x0D, 
-    0x11, 0x16, 0x1A, 0x17, 0x0F, 0x05, 0xF7, 0xEB, 0xE1, 0xDC, 0xDF, 0xE9, 
-    0xF5, 0x01, 0x09, 0x0D, 0x0B, 0x08, 0x05, 0x06, 0x0E, 0x18, 0x23, 0x2C, 
-    0x30, 0x2F, 0x2B, 0x23, 0x1C, 0x14, 0x10, 0x0E, 0x0F, 0x11, 0x10, 0x0D, 
-    0x08, 0x04, 0x01, 0x00, 0x03, 0x0B, 0x16, 0x20, 0x25, 0x26, 0x24, 0x1F, 
-    0x1A, 0x18, 0x19, 0x1E, 0x22, 0x25, 0x25, 0x20, 0x19, 0x10, 0x08, 0x02, 
-    0x01, 0x03, 0x06, 0x0B, 0x0E, 0x0D, 0x08, 0x03, 0xFF, 0xFC, 0xFD, 0x03, 
-    0x0D, 0x18, 0x1F, 0x21, 0x1D, 0x14, 0x08, 0xFE, 0xF7, 0xF5, 0xF8, 0xFD, 
-    0x04, 0x07, 0x07, 0x05, 0x00, 0xFB, 0xF8, 0xF7, 0xF9, 0xFD, 0x02, 0x04, 
-    0x04, 0x01, 0xFC, 0xF8, 0xF4, 0xF3, 0xF6, 0xFC, 0x01, 0x05, 0x05, 0x03, 
-    0xFE, 0xF9, 0xF7, 0xF8, 0xFE, 0x04, 0x09, 0x0B, 0x0A, 0x05, 0xFE, 0xF8, 
-    0xF4, 0xF2, 0xF3, 0xF5, 0xF7, 0xF7, 0xF4, 0xED, 0xE5, 0xDD, 0xD7, 0xD6, 
-    0xDB, 0xE4, 0xEE, 0xF6, 0xF9, 0xF7, 0xF2, 0xE8, 0xE0, 0xDD, 0xE0, 0xE7, 
-    0xED, 0xF3, 0xF7, 0xF6, 0xF3, 0xEE, 0xE8, 0xE5, 0xE5, 0xE8, 0xEB, 0xF0, 
-    0xF3, 0xF5, 0xF5, 0xF2, 0xEF, 0xEC, 0xED, 0xF1, 0xF9, 0xFF, 0x03, 0x03, 
-    0x01, 0xFC, 0xF6, 0xF3, 0xF5, 0xFA, 0x00, 0x04, 0x07, 0x08, 0x06, 0x03, 
-    0xFE, 0xFC, 0xFB, 0xFE, 0x03, 0x07, 0x09, 0x06, 0x02, 0xFB, 0xF4, 0xEE, 
-    0xEB, 0xEE, 0xF6, 0x01, 0x09, 0x0D, 0x0B, 0x04, 0xF8, 0xED, 0xE8, 0xE9, 
-    0xEE, 0xF6, 0xFC, 0x01, 0x02, 0x00, 0xFD, 0xFA, 0xF8, 0xF8, 0xFD, 0x03, 
-    0x0B, 0x0E, 0x0E, 0x0B, 0x05, 0xFE, 0xF6, 0xF1, 0xEF, 0xF2, 0xF5, 0xF6, 
-    0xF2, 0xED, 0xE6, 0xE0, 0xDD, 0xE1, 0xEA, 0xF4, 0xFF, 0x07, 0x0D, 0x0E, 
-    0x0D, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F, 0x10, 0x0F, 0x0A, 0x01, 0xF6, 0xEC, 
-    0xE3, 0xDF, 0xDF, 0xE5, 0xEE, 0xF6, 0xFD, 0x00, 0xFF, 0xFB, 0xF8, 0xFB, 
-    0x03, 0x0E, 0x1A, 0x24, 0x29, 0x2B, 0x27, 0x20, 0x18, 0x10, 0x0B, 0x09, 
-    0x08, 0x09, 0x0A, 0x09, 0x05, 0x01, 0xFB, 0xF6, 0xF6, 0xFB, 0x05, 0x10, 
-    0x1A, 0x21, 0x25, 0x23, 0x1E, 0x1B, 0x1A, 0x1C, 0x1F, 0x21, 0x22, 0x1F, 
-    0x1B, 0x15, 0x11, 0x10, 0x11, 0x14, 0x16, 0x17, 0x18, 0x17, 0x13, 0x0E, 
-    0x08, 0x05, 0x04, 0x08, 0x10, 0x18, 0x1F, 0x21, 0x1F, 0x18, 0x0E, 0x05, 
-    0x01, 0x04, 0x08, 0x0D, 0x12, 0x13, 0x12, 0x0E, 0x07, 0x00, 0xFC, 0xFA, 
-    0xFD, 0xFF, 0x03, 0x09, 0x0C, 0x0D, 0x0B, 0x06, 0x01, 0xFD, 0xFD, 0xFF, 
-    0x03, 0x07, 0x08, 0x08, 0x05, 0xFE, 0xF8, 0xF4, 0xF6, 0xF8, 0xFB, 0xFC, 
-    0xFA, 0xF7, 0xF4, 0xF1, 0xF0, 0xF1, 0xF2, 0xF3, 0xF2, 0xF3, 0xF1, 0xEE, 
-    0xE9, 0xE3, 0xE0, 0xDF, 0xE2, 0xE8, 0xF0, 0xF8, 0xFC, 0xFC, 0xF9, 0xF1, 
-    0xE9, 0xE6, 0xE8, 0xED, 0xF4, 0xF8, 0xF9, 0xF8, 0xF3, 0xED, 0xE8, 0xE5, 
-    0xE5, 0xE7, 0xEB, 0xEF, 0xF3, 0xF5, 0xF5, 0xF1, 0xEC, 0xE8, 0xE3, 0xE2, 
-    0xE5, 0xEB, 0xF2, 0xF6, 0xF7, 0xF5, 0xF0, 0xEC, 0xEB, 0xED, 0xF0, 0xF3, 
-    0xF6, 0xF7, 0xF8, 0xF6, 0xF5, 0xF6, 0xF8, 0xFA, 0xFC, 0xFD, 0xFD, 0xFD, 
-    0xFB, 0xF7, 0xF3, 0xEF, 0xED, 0xED, 0xF0, 0xF7, 0xFF, 0x05, 0x06, 0x02, 
-    0xFA, 0xF3, 0xF0, 0xF0, 0xF5, 0xF9, 0xFD, 0xFF, 0xFF, 0xFC, 0xF7, 0xF2, 
-    0xF1, 0xF3, 0xF8, 0xFF, 0x04, 0x09, 0x0B, 0x0A, 0x06, 0xFE, 0xF6, 0xEE, 
-    0xEB, 0xED, 0xF1, 0xF6, 0xF8, 0xF7, 0xF2, 0xEB, 0xE6, 0xE4, 0xE8, 0xEE, 
-    0xF5, 0xFC, 0x02, 0x06, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x07, 
-    0x01, 0xFB, 0xF4, 0xEC, 0xE4, 0xDD, 0xD9, 0xD9, 0xDE, 0xE4, 0xEA, 0xED, 
-    0xEF, 0xEF, 0xEF, 0xF1, 0xF8, 0x02, 0x0E, 0x18, 0x1D, 0x1F, 0x1D, 0x19, 
-    0x14, 0x0F, 0x0E, 0x0F, 0x11, 0x13, 0x15, 0x15, 0x13, 0x0F, 0x08, 0x01, 
-    0xFC, 0xFC, 0x02, 0x0D, 0x18, 0x21, 0x26, 0x26, 0x23, 0x1E, 0x1B, 0x1B, 
-    0x1E, 0x21, 0x22, 0x21, 0x1F, 0x1C, 0x19, 0x15, 0x12, 0x11, 0x11, 0x11, 
-    0x10, 0x0F, 0x0E, 0x0C, 0x08, 0x04, 0x02, 0x04, 0x09, 0x11, 0x19, 0x1F, 
-    0x22, 0x20, 0x1B, 0x15, 0x11, 0x0F, 0x12, 0x14, 0x17, 0x16, 0x14, 0x12, 
-    0x0E, 0x09, 0x07, 0x07, 0x0B, 0x0E, 0x11, 0x13, 0x14, 0x14, 0x12, 0x0D, 
-    0x07, 0x00, 0xFC, 0xFD, 0x02, 0x09, 0x0E, 0x0F, 0x0B, 0x04, 0xFD, 0xF9, 
-    0xF9, 0xFB, 0xFD, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0xFA, 0xF8, 0xF6, 0xF5, 
-    0xF4, 0xF2, 0xF1, 0xF1, 0xF1, 0xEE, 0xE9, 0xE5, 0xE2, 0xE5, 0xEC, 0xF3, 
-    0xF9, 0xFB, 0xF8, 0xF3, 0xEE, 0xEB, 0xEA, 0xEC, 0xF0, 0xF4, 0xF6, 0xF5, 
-    0xF2, 0xED, 0xE8, 0xE6, 0xE5, 0xE7, 0xE9, 0xEC, 0xEF, 0xF4, 0xF7, 0xF8, 
-    0xF5, 0xF0, 0xEC, 0xEA, 0xED, 0xF2, 0xF8, 0xFD, 0x00, 0xFD, 0xF8, 0xF1, 
-    0xEF, 0xEF, 0xF2, 0xF5, 0xFA, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 
-    0x01, 0x01, 0xFF, 0x00, 0x02, 0x04, 0x02, 0xFD, 0xF6, 0xEE, 0xED, 0xEF, 
-    0xF4, 0xF8, 0xFB, 0xF8, 0xF2, 0xEA, 0xE3, 0xE2, 0xE4, 0xE7, 0xEB, 0xEE, 
-    0xED, 0xED, 0xEC, 0xEC, 0xEB, 0xEC, 0xEE, 0xF3, 0xF9, 0xFE, 0x03, 0x05, 
-    0x03, 0xFC, 0xF3, 0xE9, 0xE2, 0xDF, 0xE0, 0xE4, 0xE8, 0xEA, 0xE7, 0xE1, 
-    0xDB, 0xD9, 0xDC, 0xE2, 0xEA, 0xF4, 0xFC, 0x04, 0x0A, 0x0E, 0x10, 0x11, 
-    0x12, 0x13, 0x11, 0x0D, 0x09, 0x06, 0x05, 0x02, 0xFB, 0xF3, 0xEA, 0xE5, 
-    0xE6, 0xEB, 0xF2, 0xF9, 0xFD, 0xFD, 0xFC, 0xFC, 0x01, 0x09, 0x12, 0x1A, 
-    0x20, 0x23, 0x24, 0x23, 0x21, 0x1C, 0x17, 0x14, 0x13, 0x12, 0x10, 0x0F, 
-    0x0E, 0x0C, 0x06, 0xFE, 0xF6, 0xF0, 0xF1, 0xF8, 0x02, 0x0D, 0x15, 0x1A, 
-    0x18, 0x15, 0x12, 0x12, 0x13, 0x17, 0x1A, 0x1B, 0x1B, 0x19, 0x18, 0x15, 
-    0x11, 0x0F, 0x0E, 0x10, 0x11, 0x12, 0x14, 0x15, 0x17, 0x16, 0x14, 0x0F, 
-    0x0B, 0x0B, 0x10, 0x15, 0x1A, 0x1D, 0x1B, 0x16, 0x12, 0x11, 0x11, 0x12, 
-    0x11, 0x0F, 0x0B, 0x08, 0x03, 0xFF, 0xFB, 0xF9, 0xF9, 0xFC, 0xFF, 0x02, 
-    0x05, 0x08, 0x0C, 0x0C, 0x09, 0x04, 0xFE, 0xFC, 0xFE, 0x05, 0x0C, 0x10, 
-    0x0F, 0x0A, 0x04, 0xFE, 0xFB, 0xF9, 0xF9, 0xFA, 0xFC, 0xFF, 0x00, 0x01, 
-    0x00, 0xFE, 0xFC, 0xFB, 0xFC, 0xFB, 0xFC, 0xFB, 0xFC, 0xFD, 0xFC, 0xF8, 
-    0xF2, 0xEB, 0xE8, 0xEA, 0xEF, 0xF5, 0xF7, 0xF5, 0xF1, 0xED, 0xED, 0xED, 
-    0xEF, 0xF0, 0xF1, 0xF3, 0xF4, 0xF3, 0xF1, 0xF1, 0xF2, 0xF5, 0xF9, 0xFC, 
-    0xFE, 0xFF, 0x01, 0x03, 0x06, 0x04, 0xFE, 0xF7, 0xF2, 0xF4, 0xF9, 0x00, 
-    0x04, 0x04, 0x00, 0xFA, 0xF6, 0xF3, 0xF3, 0xF3, 0xF4, 0xF5, 0xF8, 0xFA, 
-    0xFB, 0xF8, 0xF4, 0xF1, 0xF0, 0xF1, 0xF2, 0xF3, 0xF3, 0xF7, 0xFB, 0xFD, 
-    0xFC, 0xF6, 0xF1, 0xEE, 0xF1, 0xF7, 0xFD, 0x01, 0x01, 0xFD, 0xF9, 0xF6, 
-    0xF6, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFC, 0xFC, 0xFB, 0xFC, 0xFE, 0x03, 
-    0x08, 0x0B, 0x0B, 0x0A, 0x09, 0x06, 0x00, 0xF8, 0xEF, 0xE9, 0xE8, 0xEA, 
-    0xED, 0xEF, 0xEF, 0xEA, 0xE4, 0xDE, 0xDC, 0xDE, 0xE2, 0xE6, 0xEC, 0xF2, 
-    0xF8, 0xFC, 0xFE, 0xFF, 0x00, 0x01, 0x03, 0x04, 0x03, 0x01, 0xFF, 0xFD, 
-    0xFA, 0xF6, 0xF0, 0xE9, 0xE7, 0xE8, 0xEB, 0xF1, 0xF9, 0xFE, 0x00, 0x02, 
-    0x05, 0x0B, 0x10, 0x16, 0x1A, 0x1D, 0x1F, 0x20, 0x1F, 0x1C, 0x1A, 0x18, 
-    0x17, 0x16, 0x15, 0x12, 0x0F, 0x0D, 0x0C, 0x0A, 0x06, 0x01, 0xFF, 0x02, 
-    0x09, 0x11, 0x18, 0x1B, 0x1B, 0x19, 0x17, 0x16, 0x17, 0x1A, 0x1C, 0x1E, 
-    0x20, 0x21, 0x20, 0x1D, 0x18, 0x13, 0x10, 0x10, 0x12, 0x13, 0x12, 0x12, 
-    0x12, 0x11, 0x0E, 0x08, 0x00, 0xFA, 0xFA, 0xFF, 0x05, 0x0A, 0x0A, 0x08, 
-    0x07, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x06, 0x07, 0x06, 0x05, 0x04, 
-    0x02, 0x00, 0x01, 0x03, 0x06, 0x06, 0x07, 0x09, 0x08, 0x06, 0x03, 0x00, 
-    0x01, 0x06, 0x0D, 0x12, 0x13, 0x0F, 0x08, 0x03, 0xFF, 0xFE, 0xFE, 0xFF, 
-    0x01, 0x03, 0x03, 0x01, 0xFD, 0xF6, 0xF1, 0xEB, 0xE9, 0xE8, 0xEA, 0xEE, 
-    0xF1, 0xF4, 0xF4, 0xF3, 0xEE, 0xE8, 0xE5, 0xE8, 0xEE, 0xF4, 0xF9, 0xF9, 
-    0xF7, 0xF4, 0xF1, 0xEF, 0xEE, 0xED, 0xEC, 0xEC, 0xED, 0xED, 0xEC, 0xEB, 
-    0xE9, 0xE9, 0xEA, 0xED, 0xF0, 0xF2, 0xF5, 0xF7, 0xF9, 0xFA, 0xFA, 0xF6, 
-    0xF2, 0xF2, 0xF6, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0xF8, 0xF5, 0xF3, 0xF3, 
-    0xF5, 0xF8, 0xFA, 0xFE, 0x01, 0x00, 0xFE, 0xFC, 0xFB, 0xFC, 0xFF, 0x02, 
-    0x04, 0x05, 0x09, 0x0A, 0x0A, 0x06, 0xFE, 0xF7, 0xF5, 0xF7, 0xFB, 0x00, 
-    0x00, 0xFD, 0xF7, 0xF0, 0xEB, 0xE8, 0xE7, 0xE6, 0xE7, 0xE9, 0xED, 0xF0, 
-    0xF1, 0xF1, 0xF1, 0xF3, 0xF7, 0xFB, 0xFD, 0xFC, 0xFD, 0x00, 0x01, 0x00, 
-    0xFA, 0xF3, 0xED, 0xEB, 0xED, 0xF0, 0xF2, 0xF1, 0xEE, 0xE9, 0xE8, 0xEA, 
-    0xF0, 0xF7, 0xFB, 0x00, 0x06, 0x0B, 0x0D, 0x0D, 0x0B, 0x0B, 0x09, 0x08, 
-    0x05, 0x00, 0xFB, 0xF7, 0xF5, 0xF1, 0xEA, 0xE0, 0xD9, 0xD7, 0xDB, 0xE2, 
-    0xE9, 0xEE, 0xF1, 0xF4, 0xF7, 0xFD, 0x02, 0x09, 0x0D, 0x11, 0x16, 0x1A, 
-    0x1C, 0x1C, 0x1B, 0x19, 0x18, 0x16, 0x15, 0x11, 0x0D, 0x0A, 0x0A, 0x0A, 
-    0x09, 0x06, 0x02, 0x00, 0x03, 0x0B, 0x13, 0x19, 0x1B, 0x1B, 0x1A, 0x1B, 
-    0x1B, 0x1D, 0x1F, 0x20, 0x22, 0x21, 0x1F, 0x1C, 0x18, 0x13, 0x0F, 0x0E, 
-    0x0E, 0x10, 0x11, 0x10, 0x11, 0x14, 0x15, 0x14, 0x0F, 0x0A, 0x09, 0x0B, 
-    0x11, 0x18, 0x1C, 0x1D, 0x1D, 0x1B, 0x17, 0x13, 0x0E, 0x0C, 0x0B, 0x0D, 
-    0x0E, 0x0F, 0x0D, 0x0A, 0x09, 0x08, 0x07, 0x05, 0x01, 0xFF, 0xFF, 0x02, 
-    0x05, 0x05, 0x03, 0xFC, 0xF5, 0xF1, 0xF1, 0xF3, 0xF5, 0xF6, 0xF4, 0xF1, 
-    0xEF, 0xEE, 0xEF, 0xF1, 0xF2, 0xF4, 0xF5, 0xF6, 0xF6, 0xF7, 0xF7, 0xF8, 
-    0xFA, 0xFB, 0xFB, 0xF9, 0xF8, 0xF9, 0xFB, 0xFB, 0xF9, 0xF5, 0xF1, 0xF0, 
-    0xF3, 0xF7, 0xFC, 0xFE, 0xFE, 0xFB, 0xF5, 0xF0, 0xED, 0xEB, 0xEB, 0xED, 
-    0xF0, 0xF2, 0xF3, 0xF2, 0xF1, 0xF0, 0xF1, 0xF0, 0xEF, 0xEE, 0xEE, 0xF0, 
-    0xF5, 0xFA, 0xFC, 0xFC, 0xF7, 0xF1, 0xED, 0xED, 0xEF, 0xF4, 0xF6, 0xF7, 
-    0xF6, 0xF7, 0xF9, 0xFA, 0xFB, 0xFA, 0xFA, 0xFB, 0xFD, 0xFE, 0xFD, 0xFD, 
-    0xFD, 0xFE, 0xFF, 0xFE, 0xFC, 0xFB, 0xFB, 0xFE, 0x01, 0x02, 0x00, 0xFA, 
-    0xF6, 0xF4, 0xF6, 0xF9, 0xFB, 0xFD, 0xFC, 0xF9, 0xF6, 0xF2, 0xEF, 0xEE, 
-    0xEE, 0xF0, 0xF2, 0xF6, 0xFA, 0xFD, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 
-    0x02, 0x04, 0x07, 0x07, 0x03, 0xFC, 0xF3, 0xEC, 0xE8, 0xE6, 0xE6, 0xE7, 
-    0xE6, 0xE6, 0xE7, 0xE8, 0xEC, 0xEE, 0xF3, 0xF7, 0xFB, 0xFF, 0x02, 0x04, 
-    0x05, 0x06, 0x06, 0x06, 0x03, 0xFF, 0xFA, 0xF7, 0xF6, 0xF5, 0xF1, 0xEC, 
-    0xE6, 0xE3, 0xE4, 0xE9, 0xF0, 0xF8, 0xFD, 0x02, 0x05, 0x09, 0x0C, 0x0F, 
-    0x12, 0x14, 0x16, 0x18, 0x1B, 0x1D, 0x1E, 0x1D, 0x1B, 0x16, 0x12, 0x0A, 
-    0x04, 0x01, 0x01, 0x06, 0x0A, 0x0B, 0x05, 0x02, 0xFC, 0xFB, 0xFD, 0x00, 
-    0x04, 0x0A, 0x12, 0x14, 0x18, 0x1D, 0x20, 0x20, 0x1F, 0x20, 0x1C, 0x1C, 
-    0x18, 0x17, 0x18, 0x16, 0x13, 0x0B, 0x0B, 0x04, 0x08, 0x07, 0x08, 0x08, 
-    0x05, 0x05, 0xFA, 0xFD, 0xFC, 0xFD, 0x08, 0x06, 0x04, 0x06, 0x08, 0x0A, 
-    0x0E, 0x11, 0x14, 0x15, 0x11, 0x16, 0x16, 0x1B, 0x1D, 0x1B, 0x17, 0x14, 
-    0x11, 0x0B, 0x11, 0x12, 0x16, 0x1A, 0x1B, 0x14, 0x11, 0x0B, 0x08, 0x0F, 
-    0x09, 0x12, 0x11, 0x11, 0x10, 0x0A, 0x0B, 0x05, 0x04, 0xFE, 0xFB, 0xF9, 
-    0xEE, 0xFA, 0xFA, 0xF9, 0xF8, 0xEE, 0xF6, 0xEE, 0xE7, 0xE5, 0xE5, 0xE6, 
-    0xEB, 0xED, 0xF1, 0xED, 0xE9, 0xEE, 0xEB, 0xF3, 0xFA, 0xF2, 0xF0, 0xF8, 
-    0xF6, 0xF8, 0xF7, 0xFC, 0xFA, 0xFB, 0xFC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 
-    0xFD, 0xF8, 0xFB, 0xEE, 0xF6, 0xF4, 0xF2, 0xF3, 0xF2, 0xEB, 0xDC, 0xD7, 
-    0xD2, 0xD7, 0xD5, 0xD5, 0xD0, 0xCE, 0xD2, 0xD0, 0xD1, 0xD6, 0xD6, 0xDB, 
-    0xDD, 0xD9, 0xDB, 0xDE, 0xD5, 0xDE, 0xDB, 0xD6, 0xD8, 0xCE, 0xD7, 0xDA, 
-    0xE2, 0xE5, 0xE8, 0xE8, 0xE3, 0xE2, 0xE7, 0xF2, 0xEF, 0xFA, 0xFC, 0xFE, 
-    0x02, 0x04, 0x09, 0x08, 0x0C, 0x0D, 0x0F, 0x11, 0x17, 0x16, 0x1E, 0x1E, 
-    0x1A, 0x18, 0x0F, 0x0E, 0x0A, 0x0B, 0x0F, 0x17, 0x16, 0x15, 0x0F, 0x09, 
-    0x07, 0x09, 0x0B, 0x06, 0x0B, 0x0A, 0x07, 0x0F, 0x11, 0x0D, 0x11, 0x0D, 
-    0x11, 0x10, 0x0E, 0x13, 0x12, 0x17, 0x16, 0x0E, 0x0D, 0x09, 0x06, 0x08, 
-    0x08, 0x0E, 0x0B, 0x0F, 0x0A, 0x08, 0x08, 0x07, 0x09, 0x09, 0x0A, 0x03, 
-    0x09, 0x00, 0x03, 0xFF, 0xFA, 0xF8, 0xF3, 0xF6, 0xF6, 0xF6, 0xF4, 0xF8, 
-    0xF3, 0xEF, 0xEB, 0xE7, 0xE0, 0xE2, 0xE1, 0xE5, 0xF1, 0xF2, 0xF0, 0xF0, 
-    0xE9, 0xE5, 0xE5, 0xE5, 0xEA, 0xED, 0xF0, 0xF2, 0xF4, 0xF6, 0xF6, 0xF2, 
-    0xF0, 0xF1, 0xF1, 0xF7, 0xF9, 0xFD, 0xFE, 0xFF, 0x01, 0xFE, 0xFD, 0xFD, 
-    0x01, 0x02, 0x0B, 0x13, 0x13, 0x11, 0x09, 0x07, 0x01, 0x05, 0x0A, 0x0C, 
-    0x10, 0x13, 0x16, 0x16, 0x1B, 0x1A, 0x1F, 0x20, 0x23, 0x24, 0x27, 0x29, 
-    0x2E, 0x33, 0x2F, 0x31, 0x27, 0x25, 0x20, 0x24, 0x24, 0x24, 0x29, 0x24, 
-    0x23, 0x1B, 0x1B, 0x17, 0x17, 0x18, 0x18, 0x19, 0x18, 0x17, 0x1B, 0x21, 
-    0x20, 0x23, 0x1C, 0x1F, 0x1F, 0x1F, 0x26, 0x22, 0x22, 0x1B, 0x14, 0x0F, 
-    0x08, 0x04, 0x02, 0x03, 0x0A, 0x0B, 0x07, 0x05, 0xFE, 0xFC, 0xFD, 0xFC, 
-    0xFC, 0xF9, 0xF7, 0xF4, 0xF4, 0xF1, 0xEE, 0xED, 0xE8, 0xE3, 0xE4, 0xE9, 
-    0xEA, 0xEB, 0xE9, 0xE7, 0xE1, 0xDE, 0xD5, 0xD7, 0xD1, 0xD6, 0xDF, 0xE0, 
-    0xE0, 0xDB, 0xD7, 0xCF, 0xCF, 0xCA, 0xCB, 0xCB, 0xCA, 0xCC, 0xD1, 0xD1, 
-    0xD5, 0xD6, 0xD1, 0xD1, 0xD3, 0xD7, 0xDA, 0xE0, 0xE4, 0xE5, 0xE9, 0xE9, 
-    0xE3, 0xE3, 0xE0, 0xDF, 0xE3, 0xED, 0xEE, 0xF2, 0xEE, 0xE8, 0xEB, 0xE7, 
-    0xEB, 0xE8, 0xE8, 0xE7, 0xE3, 0xE6, 0xE5, 0xE5, 0xE6, 0xE4, 0xE3, 0xE4, 
-    0xED, 0xE8, 0xF2, 0xEE, 0xED, 0xF0, 0xE6, 0xEC, 0xEB, 0xEE, 0xF5, 0xFD, 
-    0x06, 0x0C, 0x06, 0x09, 0x01, 0x07, 0x0C, 0x0C, 0x12, 0x10, 0x14, 0x13, 
-    0x18, 0x17, 0x15, 0x15, 0x15, 0x16, 0x18, 0x1A, 0x1F, 0x1D, 0x1F, 0x1F, 
-    0x17, 0x16, 0x10, 0x0F, 0x14, 0x14, 0x1A, 0x1E, 0x1E, 0x1A, 0x18, 0x15, 
-    0x15, 0x14, 0x13, 0x14, 0x0D, 0x0F, 0x0D, 0x12, 0x13, 0x12, 0x11, 0x13, 
-    0x13, 0x18, 0x19, 0x1D, 0x1C, 0x1B, 0x1C, 0x12, 0x14, 0x0F, 0x10, 0x14, 
-    0x19, 0x20, 0x23, 0x1E, 0x19, 0x13, 0x13, 0x0F, 0x11, 0x0E, 0x08, 0x0C, 
-    0x07, 0x0C, 0x09, 0x08, 0x04, 0xFF, 0xFC, 0xFD, 0xFE, 0xFA, 0xFE, 0xF3, 
-    0xF0, 0xED, 0xE7, 0xE5, 0xE1, 0xE2, 0xE6, 0xED, 0xEF, 0xF2, 0xEC, 0xEC, 
-    0xF0, 0xF3, 0xFB, 0xFE, 0xFF, 0x03, 0x04, 0x02, 0x05, 0x01, 0x01, 0xFD, 
-    0x01, 0x02, 0x06, 0x07, 0x08, 0x08, 0x04, 0x04, 0xFC, 0xFC, 0xF9, 0xFA, 
-    0xFE, 0x02, 0x08, 0x0B, 0x09, 0x01, 0xFD, 0xFB, 0xFB, 0xFE, 0xFC, 0xFB, 
-    0xFB, 0xFF, 0x00, 0x05, 0x05, 0x01, 0x04, 0x03, 0x04, 0x0B, 0x0A, 0x0C, 
-    0x0E, 0x0D, 0x10, 0x0E, 0x0F, 0x0C, 0x10, 0x14, 0x1D, 0x23, 0x25, 0x22, 
-    0x1E, 0x19, 0x1A, 0x1E, 0x1A, 0x19, 0x10, 0x12, 0x0B, 0x0A, 0x09, 0x05, 
-    0x06, 0x07, 0x09, 0x0B, 0x0E, 0x0B, 0x10, 0x0D, 0x0A, 0x0A, 0x04, 0x04, 
-    0x09, 0x0E, 0x13, 0x1B, 0x1D, 0x1A, 0x14, 0x0E, 0x0E, 0x0D, 0x11, 0x11, 
-    0x0B, 0x09, 0x08, 0x05, 0x07, 0x04, 0xFF, 0xFE, 0xFB, 0xFE, 0xFD, 0xFF, 
-    0x01, 0xFF, 0xFE, 0xF9, 0xF5, 0xEF, 0xEB, 0xE9, 0xEA, 0xEB, 0xEC, 0xE8, 
-    0xE2, 0xDC, 0xD8, 0xD8, 0xDB, 0xDE, 0xD9, 0xD9, 0xDA, 0xDA, 0xDD, 0xD9, 
-    0xD5, 0xD4, 0xD0, 0xD3, 0xD4, 0xD8, 0xD8, 0xDB, 0xD8, 0xD7, 0xD6, 0xD0, 
-    0xD3, 0xD0, 0xD7, 0xDB, 0xE4, 0xE8, 0xE8, 0xE5, 0xE1, 0xDF, 0xE0, 0xE5, 
-    0xE1, 0xE1, 0xE4, 0xE1, 0xE1, 0xE2, 0xDC, 0xDB, 0xD9, 0xD9, 0xDA, 0xDA, 
-    0xDB, 0xDC, 0xDB, 0xDA, 0xD9, 0xD5, 0xD6, 0xD3, 0xD4, 0xD8, 0xDA, 0xE1, 
-    0xE3, 0xE3, 0xE2, 0xE1, 0xE5, 0xEB, 0xF1, 0xF4, 0xF5, 0xF5, 0xF8, 0xF7, 
-    0xF3, 0xF2, 0xF1, 0xF1, 0xF5, 0xF8, 0xFB, 0xFD, 0xFC, 0xFD, 0xFD, 0xFC, 
-    0xFA, 0xF5, 0xF7, 0xFD, 0x03, 0x12, 0x16, 0x19, 0x18, 0x14, 0x15, 0x15, 
-    0x17, 0x1A, 0x1F, 0x1F, 0x21, 0x22, 0x22, 0x23, 0x21, 0x24, 0x20, 0x22, 
-    0x25, 0x2A, 0x30, 0x2E, 0x30, 0x2C, 0x29, 0x23, 0x22, 0x21, 0x21, 0x28, 
-    0x2A, 0x2D, 0x2B, 0x27, 0x27, 0x28, 0x2D, 0x31, 0x30, 0x32, 0x30, 0x2E, 
-    0x2C, 0x28, 0x24, 0x1F, 0x1C, 0x1C, 0x1A, 0x1D, 0x1C, 0x1C, 0x1D, 0x18, 
-    0x17, 0x16, 0x13, 0x15, 0x16, 0x1A, 0x21, 0x22, 0x26, 0x21, 0x1E, 0x1F, 
-    0x22, 0x26, 0x26, 0x29, 0x28, 0x29, 0x28, 0x25, 0x20, 0x1F, 0x1A, 0x18, 
-    0x1B, 0x1A, 0x1C, 0x1C, 0x1C, 0x16, 0x0F, 0x09, 0x02, 0xFC, 0xFB, 0xFA, 
-    0xFE, 0xFF, 0x01, 0xFF, 0xF7, 0xF2, 0xEF, 0xEF, 0xEF, 0xF2, 0xF2, 0xF4, 
-    0xF6, 0xF4, 0xF2, 0xEF, 0xEC, 0xED, 0xED, 0xEE, 0xF0, 0xF0, 0xF1, 0xEF, 
-    0xEB, 0xE8, 0xE5, 0xE2, 0xE5, 0xE3, 0xE8, 0xF3, 0xF6, 0xF8, 0xF9, 0xF4, 
-    0xF1, 0xF3, 0xF6, 0xF7, 0xF5, 0xF7, 0xF3, 0xEF, 0xED, 0xE6, 0xE3, 0xE2, 
-    0xE0, 0xE5, 0xE5, 0xE6, 0xE7, 0xE3, 0xE4, 0xE2, 0xDD, 0xD8, 0xD5, 0xD2, 
-    0xD5, 0xD7, 0xDA, 0xDC, 0xDA, 0xD4, 0xD3, 0xD4, 0xD8, 0xDE, 0xE2, 0xE5, 
-    0xE8, 0xE6, 0xE4, 0xE2, 0xDC, 0xDA, 0xD7, 0xDB, 0xDA, 0xDC, 0xDE, 0xDF, 
-    0xDF, 0xDF, 0xDB, 0xD7, 0xD4, 0xD1, 0xD6, 0xD8, 0xE1, 0xE4, 0xE3, 0xE2, 
-    0xD9, 0xD7, 0xD8, 0xDA, 0xDE, 0xE1, 0xE5, 0xE4, 0xE7, 0xE4, 0xE2, 0xE2, 
-    0xDE, 0xE0, 0xE2, 0xE6, 0xE6, 0xEA, 0xEB, 0xEA, 0xE7, 0xE0, 0xDC, 0xD7, 
-    0xDB, 0xDD, 0xDF, 0xE9, 0xEB, 0xED, 0xEB, 0xE6, 0xE7, 0xEA, 0xF0, 0xF4, 
-    0xF2, 0xF3, 0xF4, 0xF3, 0xF4, 0xF5, 0xF4, 0xF4, 0xF7, 0xFB, 0x00, 0x00, 
-    0x01, 0xFF, 0xFE, 0xFD, 0xFC, 0xFE, 0x00, 0x06, 0x0B, 0x12, 0x19, 0x1C, 
-    0x1B, 0x18, 0x17, 0x1A, 0x20, 0x26, 0x29, 0x2D, 0x2F, 0x2D, 0x2A, 0x26, 
-    0x22, 0x1D, 0x1D, 0x1C, 0x1F, 0x24, 0x24, 0x24, 0x21, 0x1D, 0x18, 0x16, 
-    0x11, 0x0F, 0x10, 0x12, 0x1B, 0x1F, 0x1E, 0x1A, 0x14, 0x10, 0x11, 0x12, 
-    0x17, 0x1B, 0x1C, 0x21, 0x1F, 0x1C, 0x19, 0x16, 0x15, 0x16, 0x16, 0x18, 
-    0x18, 0x1A, 0x1B, 0x19, 0x17, 0x14, 0x14, 0x11, 0x13, 0x14, 0x1C, 0x21, 
-    0x24, 0x22, 0x1B, 0x1A, 0x17, 0x1D, 0x21, 0x23, 0x23, 0x20, 0x1C, 0x16, 
-    0x0E, 0x0B, 0x04, 0x02, 0x02, 0x03, 0x04, 0x01, 0x02, 0xFF, 0xF8, 0xF4, 
-    0xED, 0xE5, 0xE2, 0xDF, 0xE2, 0xE5, 0xE7, 0xE5, 0xDF, 0xD9, 0xD6, 0xD8, 
-    0xDC, 0xDF, 0xE3, 0xE6, 0xE8, 0xE9, 0xE7, 0xE4, 0xE0, 0xE1, 0xDF, 0xE0, 
-    0xE5, 0xE5, 0xEC, 0xEE, 0xED, 0xEB, 0xE7, 0xE6, 0xE5, 0xE6, 0xEA, 0xF3, 
-    0xFB, 0xFF, 0xFE, 0xFB, 0xF9, 0xF8, 0xFD, 0xFE, 0x01, 0x07, 0x0C, 0x0E, 
-    0x0D, 0x09, 0x03, 0x03, 0x02, 0x04, 0x05, 0x09, 0x0D, 0x0E, 0x0C, 0x09, 
-    0x03, 0xFD, 0xFB, 0xF8, 0xF9, 0xFC, 0x03, 0x07, 0x0C, 0x09, 0x04, 0x04, 
-    0x02, 0x04, 0x07, 0x07, 0x08, 0x0C, 0x08, 0x08, 0x02, 0xFF, 0xFE, 0xFD, 
-    0xFF, 0x02, 0x06, 0x08, 0x0A, 0x08, 0x08, 0x06, 0x04, 0x03, 0x00, 0x04, 
-    0x08, 0x0E, 0x15, 0x16, 0x13, 0x11, 0x10, 0x14, 0x17, 0x1B, 0x21, 0x21, 
-    0x22, 0x1E, 0x17, 0x13, 0x0D, 0x0B, 0x0C, 0x0E, 0x12, 0x15, 0x16, 0x14, 
-    0x0F, 0x0B, 0x00, 0xF9, 0xF4, 0xF1, 0xF3, 0xF9, 0xFD, 0xFC, 0xF9, 0xF1, 
-    0xEC, 0xEA, 0xED, 0xF0, 0xF5, 0xF9, 0xFC, 0xFF, 0xFC, 0xFC, 0xF6, 0xF5, 
-    0xF5, 0xF7, 0xF9, 0xFD, 0x03, 0x05, 0x06, 0x06, 0x06, 0x02, 0x03, 0x01, 
-    0x07, 0x0C, 0x17, 0x1E, 0x21, 0x21, 0x1C, 0x1F, 0x1F, 0x20, 0x20, 0x21, 
-    0x1F, 0x1C, 0x18, 0x12, 0x10, 0x0B, 0x06, 0x06, 0x04, 0x06, 0x07, 0x07, 
-    0x04, 0xFF, 0xFA, 0xF2, 0xED, 0xEA, 0xE9, 0xEB, 0xEF, 0xF5, 0xF6, 0xF3, 
-    0xEF, 0xEA, 0xEB, 0xEC, 0xEF, 0xF3, 0xF6, 0xF9, 0xF8, 0xF6, 0xEE, 0xE7, 
-    0xE2, 0xE0, 0xE3, 0xE6, 0xEA, 0xEC, 0xEE, 0xED, 0xEA, 0xE5, 0xDF, 0xDB, 
-    0xDA, 0xDC, 0xE2, 0xE9, 0xF0, 0xF0, 0xEF, 0xED, 0xED, 0xF1, 0xF1, 0xF5, 
-    0xF7, 0xFB, 0xFD, 0xFB, 0xF8, 0xF2, 0xEF, 0xE9, 0xE9, 0xEB, 0xEF, 0xF2, 
-    0xF2, 0xF3, 0xF0, 0xED, 0xEA, 0xE2, 0xDE, 0xDD, 0xDE, 0xE1, 0xE6, 0xEA, 
-    0xE9, 0xEA, 0xE6, 0xE2, 0xE3, 0xE3, 0xE4, 0xEA, 0xEB, 0xEA, 0xE6, 0xE0, 
-    0xDD, 0xD9, 0xD9, 0xD9, 0xDA, 0xDE, 0xE2, 0xE6, 0xEA, 0xE9, 0xE5, 0xE2, 
-    0xE1, 0xE1, 0xE6, 0xE9, 0xEF, 0xF6, 0xFA, 0xFB, 0xF7, 0xF8, 0xF6, 0xFD, 
-    0x01, 0x05, 0x0C, 0x0C, 0x0D, 0x0B, 0x05, 0x00, 0xFF, 0xFE, 0x04, 0x08, 
-    0x0A, 0x0C, 0x0B, 0x08, 0x05, 0x01, 0xFC, 0xF8, 0xF8, 0xFD, 0x01, 0x08, 
-    0x0B, 0x09, 0x04, 0xFE, 0xFD, 0xFE, 0x01, 0x05, 0x09, 0x0D, 0x0F, 0x0D, 
-    0x09, 0x01, 0xFB, 0xF9, 0xF7, 0xFB, 0xFF, 0x03, 0x07, 0x09, 0x0B, 0x07, 
-    0x03, 0x00, 0xFF, 0x03, 0x06, 0x0D, 0x15, 0x1C, 0x1F, 0x1E, 0x1E, 0x1D, 
-    0x1E, 0x1F, 0x22, 0x26, 0x27, 0x27, 0x22, 0x1A, 0x14, 0x12, 0x10, 0x14, 
-    0x15, 0x18, 0x1A, 0x1B, 0x1B, 0x14, 0x0E, 0x07, 0x04, 0x04, 0x04, 0x06, 
-    0x09, 0x0C, 0x0B, 0x07, 0x04, 0x01, 0x01, 0x04, 0x09, 0x0F, 0x17, 0x18, 
-    0x14, 0x0D, 0x03, 0xFD, 0xFB, 0xFC, 0x00, 0x06, 0x0B, 0x0D, 0x0F, 0x0F, 
-    0x0C, 0x09, 0x05, 0x06, 0x08, 0x0C, 0x11, 0x19, 0x1C, 0x1B, 0x18, 0x12, 
-    0x0F, 0x0E, 0x12, 0x16, 0x1A, 0x1E, 0x1D, 0x16, 0x0F, 0x08, 0x03, 0xFF, 
-    0x01, 0x03, 0x05, 0x0A, 0x0B, 0x0B, 0x09, 0x04, 0x00, 0xFD, 0xFC, 0xFC, 
-    0xFF, 0x04, 0x08, 0x0A, 0x04, 0xFF, 0xF9, 0xF8, 0xF9, 0xFE, 0x03, 0x09, 
-    0x0B, 0x08, 0x02, 0xFA, 0xF5, 0xF2, 0xF1, 0xF3, 0xF8, 0xFC, 0x02, 0x04, 
-    0x04, 0xFF, 0xF8, 0xF4, 0xF0, 0xF0, 0xF4, 0xF9, 0x00, 0x05, 0x04, 0x02, 
-    0xFD, 0xF9, 0xFB, 0xFE, 0x03, 0x0A, 0x0B, 0x0B, 0x07, 0xFF, 0xF7, 0xF3, 
-    0xF0, 0xF1, 0xF4, 0xF7, 0xFB, 0xFD, 0xFB, 0xF4, 0xED, 0xE5, 0xE0, 0xDF, 
-    0xE2, 0xE3, 0xE7, 0xEC, 0xEC, 0xEC, 0xE6, 0xE0, 0xE0, 0xE0, 0xE7, 0xF0, 
-    0xF4, 0xF5, 0xF2, 0xED, 0xE7, 0xE0, 0xDC, 0xD9, 0xDC, 0xE4, 0xEB, 0xF1, 
-    0xF4, 0xF5, 0xF7, 0xF5, 0xF4, 0xF3, 0xF3, 0xFA, 0x01, 0x0C, 0x12, 0x13, 
-    0x10, 0x0D, 0x0A, 0x06, 0x08, 0x0A, 0x0F, 0x13, 0x14, 0x11, 0x0A, 0x02, 
-    0xFC, 0xF9, 0xF9, 0xFD, 0x02, 0x06, 0x09, 0x08, 0x05, 0x00, 0xFA, 0xF6, 
-    0xF2, 0xF2, 0xF5, 0xF9, 0xFB, 0xFB, 0xFA, 0xF3, 0xEE, 0xEB, 0xEC, 0xF2, 
-    0xFB, 0x03, 0x08, 0x05, 0x00, 0xF8, 0xF1, 0xEE, 0xEC, 0xEF, 0xF4, 0xF9, 
-    0xFD, 0xFF, 0xFD, 0xFA, 0xF7, 0xF4, 0xF3, 0xF5, 0xF8, 0xFF, 0x06, 0x0D, 
-    0x11, 0x0E, 0x0B, 0x08, 0x07, 0x0A, 0x0D, 0x12, 0x14, 0x14, 0x11, 0x0C, 
-    0x06, 0x03, 0x00, 0xFE, 0x00, 0x01, 0x05, 0x05, 0x03, 0x00, 0xFB, 0xF8, 
-    0xF5, 0xF3, 0xF3, 0xF5, 0xFA, 0x00, 0x03, 0x01, 0xFC, 0xF8, 0xF6, 0xF9, 
-    0xFE, 0x04, 0x07, 0x08, 0x07, 0x02, 0xFC, 0xF5, 0xF1, 0xF2, 0xF4, 0xFC, 
-    0x02, 0x05, 0x08, 0x06, 0x02, 0xFC, 0xF8, 0xF6, 0xF8, 0xFF, 0x06, 0x0C, 
-    0x13, 0x16, 0x13, 0x10, 0x0E, 0x0E, 0x13, 0x17, 0x1E, 0x20, 0x20, 0x1E, 
-    0x17, 0x11, 0x0A, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x09, 0x08, 0x04, 
-    0x01, 0xFF, 0xFE, 0xFE, 0x01, 0x02, 0x04, 0x04, 0x01, 0xFC, 0xF7, 0xF5, 
-    0xF5, 0xFA, 0x01, 0x05, 0x05, 0x02, 0xFA, 0xF2, 0xEB, 0xE9, 0xE7, 0xE7, 
-    0xE9, 0xEB, 0xF0, 0xF3, 0xF2, 0xF0, 0xED, 0xEA, 0xE9, 0xEC, 0xF4, 0xFC, 
-    0x05, 0x0B, 0x0D, 0x09, 0x04, 0xFF, 0xFC, 0x00, 0x07, 0x0E, 0x13, 0x14, 
-    0x10, 0x0B, 0x05, 0x00, 0xFD, 0xFD, 0xFE, 0x01, 0x02, 0x03, 0x01, 0xFE, 
-    0xF9, 0xF2, 0xEC, 0xE6, 0xE6, 0xE8, 0xEA, 0xEB, 0xEA, 0xE7, 0xE1, 0xDE, 
-    0xDC, 0xDD, 0xE2, 0xE8, 0xED, 0xEF, 0xEB, 0xE4, 0xDD, 0xD8, 0xD5, 0xD4, 
-    0xD6, 0xDB, 0xDF, 0xE4, 0xE7, 0xE8, 0xE7, 0xE3, 0xE1, 0xE3, 0xE8, 0xEE, 
-    0xF5, 0xFC, 0x04, 0x0A, 0x0B, 0x07, 0x02, 0x01, 0x04, 0x0C, 0x13, 0x18, 
-    0x1B, 0x19, 0x15, 0x0C, 0x03, 0xFD, 0xFC, 0xFF, 0x02, 0x05, 0x07, 0x08, 
-    0x07, 0x03, 0x00, 0xFF, 0x00, 0x02, 0x04, 0x07, 0x09, 0x0B, 0x0B, 0x08, 
-    0x04, 0xFF, 0xFF, 0x04, 0x0C, 0x12, 0x15, 0x15, 0x10, 0x09, 0x01, 0xFD, 
-    0xFB, 0xFE, 0x02, 0x06, 0x07, 0x05, 0x01, 0xFC, 0xF8, 0xF7, 0xF9, 0xFC, 
-    0x00, 0x02, 0x04, 0x08, 0x0C, 0x0E, 0x0D, 0x08, 0x05, 0x07, 0x0D, 0x14, 
-    0x19, 0x19, 0x16, 0x11, 0x0A, 0x03, 0xFE, 0xFD, 0xFF, 0x01, 0x03, 0x02, 
-    0xFE, 0xFC, 0xFA, 0xF7, 0xF7, 0xF7, 0xF8, 0xFB, 0xFE, 0x00, 0x02, 0x03, 
-    0x01, 0xFF, 0xFD, 0xFE, 0x03, 0x08, 0x0E, 0x0E, 0x0B, 0x06, 0x00, 0xFA, 
-    0xF6, 0xF3, 0xF3, 0xF7, 0xFA, 0xFC, 0xFC, 0xFC, 0xFB, 0xFB, 0xFC, 0xFE, 
-    0x01, 0x04, 0x08, 0x0E, 0x15, 0x1A, 0x1D, 0x1B, 0x18, 0x18, 0x1C, 0x23, 
-    0x29, 0x2D, 0x2D, 0x2C, 0x27, 0x1F, 0x18, 0x12, 0x0E, 0x0E, 0x0F, 0x12, 
-    0x13, 0x12, 0x0F, 0x0B, 0x09, 0x06, 0x04, 0x02, 0x03, 0x02, 0x04, 0x08, 
-    0x0A, 0x0A, 0x05, 0x00, 0xFF, 0x02, 0x08, 0x0D, 0x0D, 0x0C, 0x08, 0x03, 
-    0xFE, 0xF9, 0xF6, 0xF6, 0xF7, 0xF8, 0xF7, 0xF6, 0xF5, 0xF6, 0xF4, 0xF2, 
-    0xF0, 0xF1, 0xF6, 0xFB, 0x01, 0x05, 0x08, 0x09, 0x07, 0x02, 0xFF, 0xFF, 
-    0x04, 0x0B, 0x10, 0x12, 0x11, 0x0D, 0x07, 0xFF, 0xF6, 0xF0, 0xED, 0xED, 
-    0xEE, 0xEF, 0xEF, 0xEE, 0xEB, 0xE6, 0xE3, 0xE0, 0xDF, 0xDF, 0xE0, 0xE4, 
-    0xE9, 0xEE, 0xEE, 0xEA, 0xE6, 0xE2, 0xE2, 0xE7, 0xED, 0xF2, 0xF3, 0xF1, 
-    0xEE, 0xE9, 0xE5, 0xE3, 0xE2, 0xE5, 0xE7, 0xE8, 0xE8, 0xE6, 0xE6, 0xE5, 
-    0xE4, 0xE4, 0xE6, 0xE9, 0xEE, 0xF2, 0xF7, 0xFA, 0xFC, 0xFA, 0xF7, 0xF4, 
-    0xF4, 0xF8, 0xFD, 0x01, 0x05, 0x07, 0x04, 0xFD, 0xF6, 0xF0, 0xED, 0xED, 
-    0xEF, 0xF2, 0xF6, 0xF9, 0xFB, 0xFB, 0xF9, 0xF7, 0xF5, 0xF3, 0xF4, 0xF7, 
-    0xFC, 0x02, 0x04, 0x03, 0xFD, 0xF9, 0xF5, 0xF5, 0xF8, 0xFC, 0x01, 0x04, 
-    0x06, 0x02, 0xFB, 0xF7, 0xF5, 0xF4, 0xF4, 0xF5, 0xF6, 0xF7, 0xF7, 0xF6, 
-    0xF5, 0xF3, 0xF3, 0xF5, 0xF8, 0xFE, 0x03, 0x09, 0x0D, 0x0F, 0x0E, 0x0C, 
-    0x0A, 0x0B, 0x0F, 0x15, 0x1C, 0x20, 0x21, 0x1D, 0x18, 0x11, 0x0B, 0x08, 
-    0x08, 0x09, 0x0B, 0x0C, 0x0B, 0x0A, 0x05, 0xFF, 0xF9, 0xF4, 0xF1, 0xF1, 
-    0xF2, 0xF3, 0xF7, 0xFB, 0xFC, 0xF9, 0xF4, 0xF0, 0xEF, 0xF4, 0xFB, 0x04, 
-    0x0B, 0x0F, 0x0E, 0x09, 0x03, 0xFB, 0xF5, 0xF4, 0xF8, 0xFF, 0x05, 0x09, 
-    0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x10, 0x15, 0x1C, 0x21, 0x23, 0x22, 0x1E, 
-    0x19, 0x17, 0x19, 0x1F, 0x26, 0x29, 0x28, 0x23, 0x1E, 0x19, 0x16, 0x15, 
-    0x13, 0x14, 0x15, 0x19, 0x1C, 0x18, 0x16, 0x11, 0x0C, 0x0A, 0x09, 0x0C, 
-    0x11, 0x18, 0x1B, 0x1F, 0x1F, 0x1C, 0x17, 0x0D, 0x02, 0xF7, 0xF5, 0xF1, 
-    0xFA, 0x05, 0x0B, 0x0E, 0x05, 0xFD, 0xF5, 0xF1, 0xF4, 0xF8, 0xFB, 0xFC, 
-    0xFA, 0xF9, 0xF7, 0xF1, 0xEF, 0xEC, 0xE8, 0xE9, 0xEA, 0xEC, 0xF3, 0xF6, 
-    0xF7, 0xF6, 0xEF, 0xEC, 0xEC, 0xF1, 0xF3, 0xF4, 0xF4, 0xEE, 0xEE, 0xF0, 
-    0xF5, 0xF5, 0xF1, 0xE9, 0xE2, 0xE1, 0xE2, 0xE5, 0xEA, 0xEA, 0xED, 0xF1, 
-    0xF4, 0xF6, 0xF6, 0xF6, 0xF7, 0xF7, 0xF4, 0xF2, 0xEE, 0xEF, 0xF2, 0xF5, 
-    0xF9, 0xFB, 0xF8, 0xF4, 0xEE, 0xED, 0xE9, 0xE7, 0xE8, 0xEB, 0xF6, 0xFA, 
-    0xF9, 0xEF, 0xE6, 0xDF, 0xDD, 0xDE, 0xE3, 0xE7, 0xEE, 0xF5, 0xF6, 0xF5, 
-    0xF3, 0xED, 0xE7, 0xE4, 0xE0, 0xE3, 0xE9, 0xF4, 0xFE, 0x04, 0x05, 0x02, 
-    0xFD, 0xF7, 0xF5, 0xF6, 0xF8, 0xFC, 0xFF, 0x07, 0x0E, 0x10, 0x0B, 0xFE, 
-    0xF3, 0xE9, 0xE8, 0xEB, 0xF1, 0xF7, 0xFE, 0x03, 0x01, 0xFD, 0xF4, 0xED, 
-    0xE9, 0xE7, 0xE5, 0xE6, 0xE7, 0xEE, 0xF1, 0xF3, 0xF2, 0xEF, 0xED, 0xEB, 
-    0xEE, 0xEC, 0xED, 0xEA, 0xEA, 0xEE, 0xF7, 0xFF, 0xFF, 0xF9, 0xF1, 0xE8, 
-    0xE4, 0xE5, 0xE8, 0xEB, 0xED, 0xF4, 0xFA, 0xFE, 0xFB, 0xF8, 0xF4, 0xEE, 
-    0xEB, 0xEA, 0xF2, 0xFF, 0x11, 0x23, 0x2F, 0x33, 0x33, 0x2F, 0x25, 0x1D, 
-    0x11, 0x09, 0x03, 0x03, 0x0D, 0x16, 0x1C, 0x17, 0x0B, 0xFC, 0xF2, 0xEE, 
-    0xF3, 0xFB, 0x05, 0x11, 0x1B, 0x20, 0x1E, 0x16, 0x0C, 0x04, 0xFD, 0xFD, 
-    0x01, 0x08, 0x11, 0x18, 0x1A, 0x17, 0x17, 0x13, 0x12, 0x11, 0x0E, 0x0E, 
-    0x0D, 0x0D, 0x11, 0x16, 0x19, 0x14, 0x0B, 0x01, 0xFA, 0xFA, 0xFE, 0x05, 
-    0x0D, 0x10, 0x11, 0x12, 0x10, 0x10, 0x0D, 0x0C, 0x0C, 0x0C, 0x0E, 0x12, 
-    0x18, 0x1C, 0x1F, 0x20, 0x22, 0x24, 0x28, 0x27, 0x25, 0x1F, 0x19, 0x10, 
-    0x0E, 0x11, 0x14, 0x14, 0x0C, 0xFF, 0xF2, 0xE8, 0xE2, 0xE6, 0xEC, 0xF8, 
-    0x02, 0x0B, 0x0E, 0x0B, 0x05, 0xFB, 0xF0, 0xE8, 0xE5, 0xE5, 0xEB, 0xF5, 
-    0xFD, 0x02, 0x05, 0x04, 0x00, 0xFC, 0xF6, 0xF3, 0xF4, 0xF5, 0xFE, 0x0C, 
-    0x17, 0x1C, 0x15, 0x04, 0xF1, 0xE3, 0xDF, 0xE6, 0xF1, 0xFE, 0x0A, 0x12, 
-    0x11, 0x08, 0xFA, 0xEC, 0xE1, 0xDE, 0xE1, 0xEA, 0xF7, 0x05, 0x0E, 0x11, 
-    0x0E, 0x07, 0xFE, 0xF4, 0xF0, 0xED, 0xED, 0xEF, 0xEF, 0xF8, 0xFF, 0x04, 
-    0x01, 0xF4, 0xE4, 0xD6, 0xD2, 0xD7, 0xE3, 0xF1, 0xFE, 0x08, 0x0C, 0x09, 
-    0xFF, 0xF3, 0xE7, 0xE0, 0xDE, 0xE1, 0xE9, 0xF2, 0xFA, 0x01, 0x05, 0x06, 
-    0x04, 0xFE, 0xF8, 0xF1, 0xEE, 0xEE, 0xF0, 0xF8, 0x07, 0x12, 0x15, 0x0B, 
-    0xF9, 0xE4, 0xD3, 0xCD, 0xD4, 0xE3, 0xF4, 0x05, 0x11, 0x14, 0x0E, 0x00, 
-    0xF1, 0xE4, 0xDB, 0xDB, 0xE3, 0xF1, 0x01, 0x10, 0x17, 0x16, 0x0F, 0x05, 
-    0xFA, 0xF0, 0xE9, 0xE9, 0xEE, 0xF9, 0x0A, 0x17, 0x1C, 0x14, 0x04, 0xEC, 
-    0xD8, 0xCF, 0xD4, 0xE3, 0xF4, 0x05, 0x10, 0x12, 0x0A, 0xF9, 0xE6, 0xD9, 
-    0xD3, 0xD4, 0xDA, 0xE5, 0xF4, 0x01, 0x09, 0x0C, 0x0B, 0x0A, 0x09, 0x0A, 
-    0x0B, 0x0E, 0x12, 0x17, 0x20, 0x2B, 0x2F, 0x2A, 0x19, 0x03, 0xF0, 0xE5, 
-    0xE8, 0xF4, 0x03, 0x10, 0x19, 0x1B, 0x16, 0x0C, 0xFF, 0xF4, 0xEE, 0xEE, 
-    0xF3, 0xFE, 0x0B, 0x16, 0x1D, 0x1D, 0x19, 0x12, 0x0A, 0x03, 0x00, 0xFF, 
-    0x01, 0x07, 0x11, 0x21, 0x2B, 0x2D, 0x23, 0x10, 0xFC, 0xEC, 0xEA, 0xF5, 
-    0x07, 0x17, 0x24, 0x2A, 0x27, 0x1B, 0x0A, 0xFB, 0xF2, 0xF2, 0xF9, 0x06, 
-    0x15, 0x24, 0x2C, 0x2D, 0x27, 0x1E, 0x14, 0x10, 0x0D, 0x0E, 0x12, 0x17, 
-    0x20, 0x2C, 0x35, 0x32, 0x22, 0x08, 0xED, 0xD9, 0xD4, 0xDD, 0xEE, 0xFF, 
-    0x09, 0x0A, 0x05, 0xF8, 0xE8, 0xDA, 0xD0, 0xCF, 0xD7, 0xE4, 0xF6, 0x05, 
-    0x0E, 0x0F, 0x08, 0xFF, 0xF5, 0xED, 0xEA, 0xE9, 0xED, 0xF3, 0xFB, 0x08, 
-    0x14, 0x1B, 0x15, 0x05, 0xEF, 0xDC, 0xD4, 0xD9, 0xE9, 0xFD, 0x0D, 0x17, 
-    0x17, 0x0C, 0xFB, 0xE7, 0xD7, 0xCD, 0xCB, 0xD2, 0xDF, 0xF1, 0x01, 0x0C, 
-    0x0F, 0x0B, 0x06, 0xFF, 0xFA, 0xF4, 0xF2, 0xF5, 0xFB, 0x09, 0x19, 0x21, 
-    0x1D, 0x0B, 0xF1, 0xD8, 0xCB, 0xCD, 0xDB, 0xEF, 0x02, 0x0E, 0x13, 0x0F, 
-    0x01, 0xEE, 0xDC, 0xD1, 0xD0, 0xD7, 0xE7, 0xF7, 0x06, 0x0D, 0x0E, 0x07, 
-    0xFB, 0xF0, 0xE8, 0xE5, 0xE4, 0xEA, 0xF1, 0xFF, 0x10, 0x1B, 0x1C, 0x11, 
-    0xFF, 0xE9, 0xDA, 0xD6, 0xDE, 0xED, 0x00, 0x0E, 0x14, 0x12, 0x09, 0xFE, 
-    0xF3, 0xEA, 0xE6, 0xE8, 0xF1, 0xFE, 0x08, 0x0F, 0x11, 0x0F, 0x0C, 0x08, 
-    0x01, 0xFB, 0xF5, 0xF1, 0xF3, 0xF8, 0x04, 0x0D, 0x0E, 0x07, 0xFA, 0xE8, 
-    0xD9, 0xD4, 0xD9, 0xE6, 0xF5, 0x03, 0x0B, 0x0F, 0x0A, 0xFF, 0xF0, 0xE4, 
-    0xDE, 0xDF, 0xE7, 0xF1, 0xFD, 0x07, 0x0D, 0x0C, 0x07, 0x01, 0xFB, 0xF8, 
-    0xF8, 0xFC, 0x06, 0x12, 0x23, 0x32, 0x39, 0x36, 0x2A, 0x17, 0x05, 0xFB, 
-    0xFB, 0x05, 0x12, 0x1E, 0x24, 0x23, 0x18, 0x05, 0xF2, 0xE3, 0xDB, 0xDC, 
-    0xE5, 0xF1, 0x00, 0x0D, 0x15, 0x16, 0x12, 0x0D, 0x07, 0x02, 0xFF, 0xFF, 
-    0x05, 0x0C, 0x17, 0x22, 0x26, 0x20, 0x14, 0x06, 0xFA, 0xF5, 0xF7, 0xFF, 
-    0x0E, 0x1E, 0x2B, 0x30, 0x2A, 0x1E, 0x0F, 0x01, 0xF7, 0xF3, 0xF8, 0x03, 
-    0x10, 0x1C, 0x22, 0x21, 0x1A, 0x11, 0x07, 0xFE, 0xF7, 0xF4, 0xF8, 0x00, 
-    0x0B, 0x1B, 0x26, 0x2A, 0x25, 0x19, 0x08, 0xFA, 0xF5, 0xFA, 0x08, 0x18, 
-    0x26, 0x2D, 0x2B, 0x1E, 0x0B, 0xF4, 0xE2, 0xD8, 0xD8, 0xE0, 0xEC, 0xFA, 
-    0x07, 0x0E, 0x0D, 0x07, 0xFC, 0xF1, 0xE9, 0xE6, 0xE9, 0xF1, 0xFC, 0x0B, 
-    0x16, 0x18, 0x0E, 0xFC, 0xE9, 0xD8, 0xD0, 0xD1, 0xDB, 0xEA, 0xFA, 0x06, 
-    0x0B, 0x06, 0xF9, 0xE9, 0xDB, 0xD4, 0xD4, 0xDA, 0xE3, 0xEE, 0xF8, 0xFD, 
-    0xFB, 0xF3, 0xE9, 0xE3, 0xE1, 0xE3, 0xE7, 0xEF, 0xF9, 0x07, 0x18, 0x21, 
-    0x20, 0x14, 0x04, 0xF4, 0xE8, 0xE4, 0xE8, 0xF2, 0xFF, 0x0A, 0x10, 0x0D, 
-    0x02, 0xF4, 0xE4, 0xD9, 0xD3, 0xD4, 0xD9, 0xE3, 0xEE, 0xF6, 0xFB, 0xFB, 
-    0xF7, 0xF2, 0xEB, 0xE6, 0xE4, 0xE7, 0xF0, 0xFB, 0x0B, 0x17, 0x1A, 0x13, 
-    0x05, 0xF7, 0xEB, 0xE6, 0xEA, 0xF5, 0x02, 0x0E, 0x14, 0x12, 0x09, 0xFC, 
-    0xED, 0xE2, 0xDD, 0xDF, 0xE7, 0xF5, 0x05, 0x10, 0x15, 0x13, 0x0A, 0x00, 
-    0xF8, 0xF3, 0xF1, 0xF1, 0xF5, 0xFA, 0x04, 0x0D, 0x0E, 0x06, 0xF8, 0xE9, 
-    0xDE, 0xDA, 0xDE, 0xE7, 0xF3, 0xFF, 0x08, 0x0A, 0x05, 0xFA, 0xEE, 0xE6, 
-    0xE4, 0xE9, 0xF1, 0xF9, 0x03, 0x0C, 0x13, 0x15, 0x11, 0x09, 0x02, 0xFE, 
-    0xFC, 0xFA, 0xFA, 0xFD, 0x06, 0x14, 0x1C, 0x1C, 0x13, 0x07, 0xFE, 0xF9, 
-    0xFB, 0x03, 0x0F, 0x1B, 0x25, 0x29, 0x27, 0x1E, 0x11, 0x04, 0xF8, 0xF1, 
-    0xF1, 0xF6, 0x00, 0x0B, 0x12, 0x13, 0x0E, 0x06, 0xFE, 0xF9, 0xF7, 0xF7, 
-    0xFD, 0x09, 0x18, 0x2A, 0x36, 0x38, 0x31, 0x21, 0x12, 0x05, 0xFF, 0x01, 
-    0x0B, 0x18, 0x27, 0x2F, 0x2F, 0x26, 0x18, 0x0A, 0xFF, 0xF8, 0xF8, 0xFD, 
-    0x08, 0x12, 0x19, 0x1B, 0x17, 0x10, 0x07, 0x01, 0xFF, 0xFE, 0x00, 0x03, 
-    0x09, 0x16, 0x23, 0x29, 0x23, 0x14, 0x04, 0xFA, 0xF8, 0xFC, 0x04, 0x10, 
-    0x1C, 0x27, 0x2C, 0x2A, 0x21, 0x12, 0x04, 0xF7, 0xF0, 0xEF, 0xF3, 0xF8, 
-    0xFD, 0xFF, 0xFF, 0xFA, 0xF0, 0xE6, 0xE0, 0xDC, 0xDB, 0xDD, 0xE3, 0xEF, 
-    0xFE, 0x0A, 0x0E, 0x08, 0xFD, 0xF1, 0xE9, 0xE7, 0xEB, 0xF5, 0x02, 0x0F, 
-    0x18, 0x18, 0x11, 0x04, 0xF6, 0xEA, 0xE3, 0xE2, 0xE8, 0xF4, 0x01, 0x08, 
-    0x07, 0x00, 0xF7, 0xEE, 0xE6, 0xDD, 0xD5, 0xD3, 0xD9, 0xE4, 0xF5, 0x02, 
-    0x08, 0x05, 0xFB, 0xF0, 0xE8, 0xE5, 0xE9, 0xF2, 0xFC, 0x05, 0x0C, 0x0D, 
-    0x08, 0xFC, 0xED, 0xE3, 0xDD, 0xDE, 0xE2, 0xEA, 0xF3, 0xFA, 0xFC, 0xF9, 
-    0xF1, 0xE7, 0xDF, 0xDC, 0xDB, 0xDB, 0xDF, 0xE6, 0xF4, 0x03, 0x0C, 0x0B, 
-    0x02, 0xF7, 0xEF, 0xE9, 0xE8, 0xEC, 0xF5, 0xFE, 0x05, 0x07, 0x05, 0xFD, 
-    0xEF, 0xE0, 0xD6, 0xD4, 0xD8, 0xE3, 0xED, 0xF6, 0xFB, 0xFD, 0xFC, 0xF6, 
-    0xEF, 0xEA, 0xE6, 0xE5, 0xE7, 0xEC, 0xF8, 0x08, 0x13, 0x13, 0x08, 0xFA, 
-    0xEF, 0xE9, 0xE7, 0xEB, 0xF3, 0x00, 0x0C, 0x13, 0x11, 0x07, 0xF9, 0xEB, 
-    0xE2, 0xDD, 0xDE, 0xE6, 0xF2, 0xFF, 0x07, 0x0B, 0x09, 0x04, 0xFC, 0xF6, 
-    0xF1, 0xF0, 0xF2, 0xF5, 0xFD, 0x0A, 0x11, 0x12, 0x09, 0xFC, 0xF2, 0xEE, 
-    0xF1, 0xF9, 0x04, 0x11, 0x1F, 0x2B, 0x30, 0x2B, 0x20, 0x12, 0x09, 0x06, 
-    0x0A, 0x13, 0x1D, 0x27, 0x2E, 0x30, 0x2C, 0x25, 0x19, 0x0E, 0x04, 0xFD, 
-    0xFA, 0xFA, 0xFF, 0x0B, 0x17, 0x1C, 0x17, 0x0A, 0xFE, 0xF6, 0xF3, 0xF6, 
-    0xFD, 0x08, 0x14, 0x20, 0x27, 0x26, 0x1E, 0x10, 0x06, 0xFF, 0xFD, 0x00, 
-    0x08, 0x13, 0x1F, 0x26, 0x28, 0x24, 0x1D, 0x14, 0x0B, 0x06, 0x06, 0x0B, 
-    0x13, 0x21, 0x30, 0x38, 0x36, 0x2A, 0x1A, 0x0C, 0x03, 0x00, 0x02, 0x0A, 
-    0x16, 0x22, 0x2C, 0x2F, 0x2A, 0x1E, 0x10, 0x04, 0x00, 0x00, 0x03, 0x0A, 
-    0x10, 0x13, 0x12, 0x0C, 0x05, 0xFB, 0xF1, 0xE9, 0xE5, 0xE6, 0xEB, 0xF2, 
-    0xFD, 0x04, 0x05, 0xFB, 0xED, 0xE2, 0xDB, 0xDC, 0xE3, 0xEE, 0xFB, 0x09, 
-    0x12, 0x18, 0x15, 0x0D, 0x02, 0xF7, 0xEE, 0xEA, 0xEB, 0xF0, 0xF9, 0x00, 
-    0x02, 0x01, 0xFB, 0xF3, 0xE9, 0xDE, 0xD6, 0xD2, 0xD3, 0xD7, 0xDF, 0xE8, 
-    0xED, 0xEC, 0xE5, 0xDE, 0xD8, 0xD7, 0xDB, 0xE5, 0xF2, 0xFF, 0x0B, 0x13, 
-    0x17, 0x14, 0x0B, 0x00, 0xF7, 0xF5, 0xF8, 0xFF, 0x08, 0x11, 0x15, 0x15, 
-    0x0F, 0x05, 0xF9, 0xED, 0xE4, 0xDD, 0xDC, 0xDF, 0xE8, 0xF5, 0xFD, 0xFC, 
-    0xF3, 0xE6, 0xDC, 0xD7, 0xDA, 0xE2, 0xEC, 0xF7, 0xFF, 0x04, 0x04, 0x00, 
-    0xF9, 0xF0, 0xE8, 0xE3, 0xE4, 0xEB, 0xF6, 0x00, 0x05, 0x03, 0xFD, 0xF4, 
-    0xEA, 0xE2, 0xDE, 0xDF, 0xE4, 0xEB, 0xF4, 0x02, 0x0B, 0x0C, 0x03, 0xF7, 
-    0xEB, 0xE3, 0xE2, 0xE7, 0xF0, 0xF9, 0x00, 0x04, 0x06, 0x03, 0xFA, 0xED, 
-    0xE1, 0xD9, 0xD8, 0xDC, 0xE3, 0xEE, 0xF8, 0xFD, 0xFD, 0xF9, 0xF3, 0xEF, 
-    0xED, 0xEA, 0xEA, 0xEC, 0xF3, 0x01, 0x0E, 0x13, 0x0D, 0x00, 0xF0, 0xE5, 
-    0xE1, 0xE5, 0xEE, 0xF9, 0x03, 0x0C, 0x14, 0x17, 0x13, 0x0B, 0x01, 0xF9, 
-    0xF6, 0xF8, 0x00, 0x0F, 0x1E, 0x28, 0x2C, 0x29, 0x23, 0x1C, 0x18, 0x15, 
-    0x14, 0x15, 0x17, 0x1F, 0x28, 0x2C, 0x26, 0x16, 0x04, 0xF7, 0xF2, 0xF3, 
-    0xF9, 0x03, 0x0D, 0x16, 0x1C, 0x1E, 0x1A, 0x12, 0x09, 0x00, 0xFD, 0x01, 
-    0x0A, 0x16, 0x22, 0x2B, 0x2D, 0x29, 0x22, 0x1B, 0x16, 0x13, 0x10, 0x0E, 
-    0x0D, 0x13, 0x1F, 0x27, 0x26, 0x1A, 0x09, 0xFC, 0xF6, 0xF4, 0xF6, 0xFA, 
-    0x00, 0x07, 0x0C, 0x0D, 0x09, 0x05, 0x00, 0xFB, 0xF7, 0xF6, 0xFB, 0x06, 
-    0x12, 0x1C, 0x20, 0x1E, 0x18, 0x11, 0x0B, 0x07, 0x02, 0x01, 0x01, 0x05, 
-    0x0F, 0x18, 0x1A, 0x13, 0x04, 0xF4, 0xEA, 0xE7, 0xE9, 0xEE, 0xF3, 0xFA, 
-    0x01, 0x08, 0x09, 0x04, 0xFB, 0xF3, 0xED, 0xEC, 0xF0, 0xF9, 0x03, 0x0B, 
-    0x0E, 0x0A, 0x02, 0xFA, 0xF4, 0xF1, 0xEF, 0xF1, 0xF3, 0xF8, 0x01, 0x0B, 
-    0x0F, 0x08, 0xF8, 0xE4, 0xD6, 0xD2, 0xD5, 0xDC, 0xE5, 0xF0, 0xF9, 0xFF, 
-    0x00, 0xFE, 0xF9, 0xF3, 0xEE, 0xEB, 0xEE, 0xF8, 0x04, 0x0F, 0x13, 0x10, 
-    0x09, 0x01, 0xF9, 0xF3, 0xEE, 0xEB, 0xEB, 0xED, 0xF4, 0xFD, 0x02, 0x01, 
-    0xF8, 0xEB, 0xE0, 0xDB, 0xDD, 0xE3, 0xEB, 0xF1, 0xF8, 0xFD, 0x01, 0x00, 
-    0xFA, 0xF0, 0xE8, 0xE5, 0xE7, 0xEF, 0xF9, 0x04, 0x0D, 0x0F, 0x0B, 0x04, 
-    0xFD, 0xF8, 0xF4, 0xF1, 0xF0, 0xF0, 0xF3, 0xFE, 0x07, 0x0D, 0x08, 0xFB, 
-    0xEC, 0xE3, 0xE2, 0xE7, 0xEF, 0xF5, 0xFA, 0xFD, 0xFF, 0xFF, 0xF8, 0xED, 
-    0xE4, 0xDE, 0xDF, 0xE5, 0xEE, 0xF9, 0x02, 0x06, 0x04, 0xFD, 0xF7, 0xF3, 
-    0xF1, 0xF1, 0xF2, 0xF6, 0xFC, 0x06, 0x10, 0x14, 0x13, 0x09, 0xFC, 0xF1, 
-    0xEE, 0xF1, 0xF7, 0xFD, 0x01, 0x03, 0x05, 0x05, 0x02, 0xFB, 0xF3, 0xEC, 
-    0xEA, 0xED, 0xF5, 0xFE, 0x06, 0x0A, 0x08, 0x04, 0x02, 0x01, 0x04, 0x09, 
-    0x0B, 0x0C, 0x0F, 0x15, 0x21, 0x2A, 0x2B, 0x25, 0x19, 0x10, 0x0B, 0x0B, 
-    0x0D, 0x10, 0x13, 0x16, 0x17, 0x16, 0x12, 0x0B, 0x05, 0xFE, 0xF9, 0xF9, 
-    0xFC, 0x04, 0x0C, 0x13, 0x17, 0x17, 0x15, 0x13, 0x13, 0x15, 0x15, 0x16, 
-    0x14, 0x17, 0x20, 0x28, 0x2C, 0x26, 0x1A, 0x0F, 0x09, 0x0A, 0x0F, 0x14, 
-    0x19, 0x1B, 0x1C, 0x1A, 0x17, 0x12, 0x09, 0x01, 0xFB, 0xFC, 0xFF, 0x07, 
-    0x0E, 0x14, 0x16, 0x14, 0x0F, 0x0C, 0x0B, 0x0E, 0x10, 0x10, 0x0F, 0x0E, 
-    0x13, 0x18, 0x18, 0x13, 0x09, 0xFD, 0xF3, 0xF1, 0xF1, 0xF4, 0xF7, 0xF9, 
-    0xF8, 0xF4, 0xF0, 0xEC, 0xE9, 0xE5, 0xE3, 0xE2, 0xE3, 0xE7, 0xEE, 0xF4, 
-    0xF7, 0xF6, 0xF2, 0xEF, 0xEE, 0xEF, 0xEE, 0xEE, 0xEE, 0xF0, 0xF6, 0x00, 
-    0x06, 0x08, 0x02, 0xF7, 0xEF, 0xEC, 0xED, 0xEF, 0xF2, 0xF6, 0xF9, 0xFC, 
-    0xFC, 0xF8, 0xF4, 0xED, 0xE8, 0xE5, 0xE5, 0xE9, 0xF0, 0xFA, 0x03, 0x08, 
-    0x05, 0xFF, 0xF9, 0xF8, 0xF9, 0xF8, 0xF9, 0xF8, 0xFD, 0x07, 0x0D, 0x0E, 
-    0x06, 0xF9, 0xED, 0xE6, 0xE6, 0xEA, 0xF0, 0xF6, 0xFC, 0xFF, 0xFF, 0xFB, 
-    0xF7, 0xF3, 0xEF, 0xEB, 0xEA, 0xED, 0xF3, 0xF8, 0xFD, 0xFF, 0xFD, 0xF9, 
-    0xF3, 0xEE, 0xEC, 0xEA, 0xEB, 0xEC, 0xED, 0xF2, 0xF7, 0xF8, 0xF7, 0xF1, 
-    0xEA, 0xE6, 0xE7, 0xEA, 0xEE, 0xF3, 0xF7, 0xFB, 0xFC, 0xFD, 0xFE, 0xFC, 
-    0xFA, 0xF6, 0xF1, 0xF0, 0xF2, 0xF6, 0xFB, 0xFF, 0x01, 0x00, 0xFB, 0xF6, 
-    0xF4, 0xF4, 0xF3, 0xF2, 0xF1, 0xF5, 0xFD, 0x03, 0x06, 0x03, 0xFE, 0xFA, 
-    0xF9, 0xFB, 0xFC, 0xFE, 0x00, 0x02, 0x02, 0x00, 0xFB, 0xF7, 0xF4, 0xF2, 
-    0xF0, 0xEF, 0xF0, 0xF5, 0xFA, 0xFF, 0x04, 0x06, 0x04, 0x02, 0x00, 0xFF, 
-    0xFE, 0xFD, 0xFF, 0x04, 0x11, 0x1C, 0x20, 0x1E, 0x15, 0x0F, 0x0D, 0x11, 
-    0x16, 0x1A, 0x1C, 0x1F, 0x20, 0x1F, 0x1C, 0x16, 0x11, 0x0B, 0x06, 0x03, 
-    0x01, 0x01, 0x05, 0x09, 0x0B, 0x09, 0x06, 0x02, 0xFF, 0xFE, 0xFE, 0xFF, 
-    0x02, 0x08, 0x12, 0x1A, 0x1E, 0x1E, 0x19, 0x13, 0x0D, 0x0B, 0x0E, 0x11, 
-    0x16, 0x1A, 0x1B, 0x1A, 0x17, 0x13, 0x10, 0x0B, 0x07, 0x04, 0x03, 0x05, 
-    0x0B, 0x12, 0x18, 0x1B, 0x1B, 0x18, 0x14, 0x11, 0x0D, 0x08, 0x05, 0x08, 
-    0x12, 0x1D, 0x22, 0x1F, 0x17, 0x0E, 0x08, 0x05, 0x05, 0x06, 0x09, 0x0B, 
-    0x0C, 0x0D, 0x0B, 0x08, 0x01, 0xFA, 0xF3, 0xEE, 0xEC, 0xED, 0xF3, 0xFC, 
-    0x02, 0x05, 0x03, 0x00, 0xFD, 0xFB, 0xF9, 0xF6, 0xF3, 0xF0, 0xF1, 0xF7, 
-    0xFA, 0xF9, 0xF4, 0xEC, 0xE6, 0xE0, 0xDE, 0xE0, 0xE4, 0xE9, 0xEC, 0xED, 
-    0xED, 0xEB, 0xE8, 0xE3, 0xDF, 0xDA, 0xD9, 0xDB, 0xE0, 0xE9, 0xF1, 0xF8, 
-    0xFC, 0xFD, 0xFD, 0xFC, 0xFB, 0xF7, 0xF4, 0xF2, 0xF6, 0xFF, 0x08, 0x0D, 
-    0x0A, 0x02, 0xF9, 0xF3, 0xF3, 0xF6, 0xF9, 0xFA, 0xFD, 0x00, 0x00, 0x01, 
-    0x01, 0x00, 0xFF, 0xFA, 0xF5, 0xF3, 0xF5, 0xFB, 0x01, 0x05, 0x07, 0x08, 
-    0x06, 0x00, 0xF9, 0xF3, 0xED, 0xEB, 0xEA, 0xF0, 0xF9, 0x00, 0x00, 0xF9, 
-    0xEF, 0xE5, 0xE1, 0xE3, 0xE8, 0xEC, 0xF1, 0xF5, 0xFA, 0xFC, 0xFA, 0xF6, 
-    0xF1, 0xEE, 0xEC, 0xEB, 0xEA, 0xED, 0xF2, 0xF7, 0xFA, 0xFB, 0xF9, 0xF5, 
-    0xF3, 0xEF, 0xEB, 0xEA, 0xEB, 0xF0, 0xF9, 0x00, 0x00, 0xFC, 0xF3, 0xEE, 
-    0xEC, 0xEE, 0xF4, 0xFA, 0xFF, 0x03, 0x05, 0x07, 0x07, 0x05, 0x00, 0xFB, 
-    0xF5, 0xF2, 0xF2, 0xF5, 0xFB, 0xFD, 0x01, 0xFF, 0xFF, 0xFB, 0xF9, 0xF9, 
-    0xF6, 0xF6, 0xF6, 0xF9, 0x08, 0x13, 0x1F, 0x1E, 0x14, 0x1B, 0x06, 0xFA, 
-    0x03, 0xED, 0xE9, 0xF7, 0xFD, 0x0C, 0x14, 0x13, 0x1A, 0x21, 0x11, 0x10, 
-    0x12, 0x12, 0x15, 0x0A, 0x19, 0x18, 0x23, 0x30, 0x2F, 0x44, 0x38, 0x1D, 
-    0x0E, 0x16, 0x27, 0x29, 0x2E, 0x24, 0x18, 0x0D, 0x06, 0x06, 0x07, 0x0F, 
-    0x0D, 0x0F, 0x0B, 0x0B, 0x09, 0x06, 0xFD, 0xF6, 0xF3, 0xDA, 0xD0, 0xC3, 
-    0xCC, 0xE3, 0xED, 0xFF, 0x05, 0x03, 0x03, 0xFE, 0xFB, 0xFD, 0xFE, 0x07, 
-    0x14, 0x1C, 0x26, 0x2A, 0x26, 0x21, 0x1A, 0x14, 0x17, 0x1D, 0x1F, 0x29, 
-    0x28, 0x28, 0x16, 0x16, 0x18, 0x0D, 0x0D, 0x0D, 0x0F, 0x0A, 0x17, 0x1F, 
-    0x26, 0x1E, 0x16, 0x22, 0x1E, 0x14, 0x0A, 0xFA, 0xEF, 0xE9, 0xEB, 0xF3, 
-    0xFE, 0xFF, 0xFD, 0xF2, 0xEB, 0xEC, 0xE7, 0xE7, 0xE4, 0xE2, 0xDC, 0xE1, 
-    0xE3, 0xE7, 0xE1, 0xE6, 0xE1, 0xDF, 0xDD, 0xD0, 0xD8, 0xD9, 0xE1, 0xE4, 
-    0xEE, 0xED, 0xF0, 0xE9, 0xE7, 0xE1, 0xDF, 0xE2, 0xE1, 0xE8, 0xE8, 0xED, 
-    0xF5, 0xFC, 0xF8, 0xF6, 0xEF, 0xF5, 0xF7, 0xFD, 0xFE, 0xFF, 0x03, 0x03, 
-    0x04, 0xFD, 0xF2, 0xEF, 0xED, 0xED, 0xF3, 0xFA, 0x0B, 0x10, 0x13, 0x0F, 
-    0x0B, 0x03, 0x01, 0xFC, 0xFA, 0xFA, 0xF9, 0x0B, 0x14, 0x15, 0x15, 0x09, 
-    0x01, 0xF9, 0xF6, 0x01, 0x03, 0x0B, 0x08, 0x01, 0xF6, 0xF4, 0xED, 0xE6, 
-    0xE6, 0xD9, 0xDB, 0xDB, 0xE4, 0xE6, 0xEA, 0xF3, 0xF6, 0xF4, 0xEF, 0xE9, 
-    0xE9, 0xE9, 0xE9, 0xEB, 0xE6, 0xE4, 0xEF, 0xFA, 0x02, 0x03, 0xEC, 0xDD, 
-    0xE0, 0xF1, 0xF8, 0xFD, 0x02, 0xFF, 0xF8, 0xFA, 0xF7, 0xF3, 0xF2, 0xF6, 
-    0xFD, 0xFB, 0xF5, 0xF1, 0x01, 0x06, 0x09, 0x0A, 0x0C, 0x08, 0x07, 0x02, 
-    0xF6, 0xF4, 0xEF, 0xF7, 0xFB, 0x02, 0x08, 0x0E, 0x02, 0xFD, 0xFC, 0xF5, 
-    0xFD, 0x00, 0x11, 0x10, 0x0A, 0x09, 0x19, 0x1C, 0x12, 0x08, 0x01, 0x0A, 
-    0x09, 0x0C, 0x18, 0x1F, 0x0A, 0x0D, 0x10, 0x00, 0x03, 0x01, 0x13, 0x19, 
-    0x0D, 0x13, 0x0F, 0x12, 0x10, 0x0B, 0x08, 0x0C, 0x07, 0x09, 0x0C, 0x0C, 
-    0x19, 0x1A, 0x1B, 0x15, 0x12, 0x09, 0x0D, 0x0A, 0x0A, 0x0D, 0x11, 0x0E, 
-    0x05, 0x0F, 0x0F, 0x17, 0x19, 0x0C, 0x0E, 0x15, 0x10, 0x15, 0x13, 0x0A, 
-    0x09, 0xFF, 0x07, 0x0D, 0x13, 0x07, 0x00, 0x07, 0x0E, 0x18, 0x1E, 0x1D, 
-    0x0A, 0x10, 0x06, 0x0E, 0x11, 0x1C, 0x1C, 0x0A, 0x04, 0x00, 0x06, 0x07, 
-    0x13, 0x14, 0x0C, 0x07, 0x09, 0xFC, 0xF7, 0xFE, 0xFE, 0xF2, 0xFD, 0x11, 
-    0x11, 0x06, 0x02, 0xFD, 0xF3, 0xEA, 0xE7, 0xF6, 0xF6, 0x02, 0x08, 0x05, 
-    0xFF, 0xF7, 0xEB, 0xEB, 0xEB, 0xE4, 0xE1, 0xF0, 0xFD, 0xF2, 0xEF, 0xEE, 
-    0xF6, 0xF8, 0xF1, 0xE8, 0xE1, 0xDE, 0xDE, 0xE5, 0xE9, 0xF3, 0xF6, 0xF8, 
-    0xF3, 0xED, 0xE5, 0xDE, 0xE2, 0xE4, 0xED, 0xF4, 0xF1, 0xE5, 0xE8, 0xE6, 
-    0xE6, 0xE5, 0xE6, 0xEC, 0xE9, 0xEE, 0xEC, 0xEB, 0x00, 0xFD, 0xF4, 0xF4, 
-    0xF1, 0xFE, 0xF8, 0x04, 0x08, 0x01, 0xFC, 0x07, 0x0D, 0x06, 0x13, 0x1B, 
-    0x12, 0x04, 0x06, 0xFD, 0xFB, 0x00, 0xFF, 0x07, 0x09, 0x00, 0x03, 0xFA, 
-    0xED, 0xF3, 0xEC, 0xEB, 0xF4, 0xE8, 0xEB, 0xF5, 0xFB, 0xFA, 0xFA, 0xFD, 
-    0xFA, 0xF6, 0xF4, 0xFB, 0xF1, 0xED, 0xF8, 0x02, 0xFD, 0xFC, 0xEB, 0xEE, 
-    0xF4, 0xF4, 0xFA, 0xF5, 0x00, 0xFB, 0xFD, 0xFC, 0xF0, 0xEC, 0xEF, 0xED, 
-    0xEE, 0xE2, 0xE3, 0xEF, 0xEC, 0xF2, 0xF4, 0xF1, 0xF5, 0xF5, 0xF6, 0xF3, 
-    0xF5, 0xEE, 0xF5, 0xF8, 0xF6, 0xF6, 0xEC, 0xF6, 0xF8, 0xFE, 0xFE, 0x05, 
-    0x08, 0x0B, 0x0D, 0x0D, 0x01, 0xFC, 0x05, 0xF8, 0x04, 0x05, 0xFF, 0x05, 
-    0x02, 0x00, 0x05, 0x12, 0x11, 0x03, 0x00, 0xFD, 0x08, 0x0D, 0x08, 0x0A, 
-    0x07, 0x06, 0x0D, 0x16, 0x16, 0x19, 0x17, 0x0E, 0x0E, 0x0A, 0x16, 0x1C, 
-    0x18, 0x17, 0x14, 0x1B, 0x18, 0x19, 0x14, 0x12, 0x10, 0x1B, 0x18, 0x12, 
-    0x1C, 0x1A, 0x18, 0x1C, 0x1F, 0x15, 0x11, 0x13, 0x09, 0x09, 0x1A, 0x18, 
-    0x1D, 0x16, 0x09, 0x0D, 0x0B, 0x07, 0x04, 0xFC, 0x05, 0x13, 0x1C, 0x13, 
-    0x11, 0x13, 0x08, 0x0B, 0x03, 0xFE, 0xF9, 0xFF, 0xFC, 0x00, 0x03, 0x00, 
-    0x05, 0x01, 0x05, 0x09, 0x11, 0x0D, 0x0F, 0x15, 0x12, 0x1B, 0x19, 0x1B, 
-    0x16, 0x0D, 0x12, 0x07, 0x01, 0x03, 0x08, 0x0D, 0x10, 0x11, 0x17, 0x14, 
-    0x05, 0xFE, 0x01, 0x05, 0xFE, 0xFE, 0xFB, 0xFB, 0xF7, 0xF8, 0xFB, 0xF5, 
-    0xF5, 0xF4, 0xF4, 0xF5, 0xF4, 0xF4, 0xEC, 0xE3, 0xE5, 0xE8, 0xE6, 0xE3, 
-    0xE5, 0xEA, 0xE4, 0xDC, 0xD4, 0xD4, 0xE6, 0xED, 0xEE, 0xE7, 0xE3, 0xDD, 
-    0xD4, 0xDA, 0xE4, 0xE5, 0xE3, 0xED, 0xF1, 0xED, 0xE5, 0xE9, 0xE6, 0xE7, 
-    0xE3, 0xE4, 0xE8, 0xE1, 0xED, 0xEC, 0xF3, 0xF4, 0xF2, 0xFB, 0xFA, 0xF9, 
-    0xF4, 0xEE, 0xF1, 0xF6, 0xF8, 0xFF, 0xFF, 0xF5, 0xFC, 0xF9, 0xFA, 0x07, 
-    0x05, 0x07, 0x06, 0x0A, 0x0B, 0x06, 0x0B, 0x02, 0xFB, 0xFB, 0xFB, 0xFE, 
-    0xFF, 0x05, 0x04, 0xFE, 0xF9, 0x05, 0x05, 0x02, 0xFF, 0xFB, 0xF8, 0xF9, 
-    0xF6, 0xF4, 0xF0, 0xF7, 0x04, 0x0B, 0x08, 0xFA, 0xF8, 0xEE, 0xF3, 0xFC, 
-    0xFB, 0xF2, 0xE9, 0xEB, 0xEA, 0xEA, 0xEE, 0xE7, 0xE6, 0xE7, 0xEB, 0xE3, 
-    0xE9, 0xF1, 0xEA, 0xEB, 0xF3, 0x06, 0x05, 0x07, 0xF8, 0xF1, 0xF2, 0xF1, 
-    0xFF, 0x0C, 0x17, 0x12, 0x09, 0xFA, 0xEC, 0xF3, 0xF4, 0xF1, 0xEF, 0xF9, 
-    0xFD, 0xF7, 0xFE, 0xF4, 0xF7, 0xF5, 0xF0, 0xFC, 0xF6, 0xF6, 0xFB, 0xF7, 
-    0x02, 0xFE, 0xF6, 0xFB, 0x03, 0x03, 0x00, 0x01, 0x02, 0x07, 0x0D, 0x14, 
-    0x1A, 0x19, 0x13, 0x10, 0x05, 0x0E, 0x0D, 0x09, 0x14, 0x12, 0x14, 0x18, 
-    0x20, 0x1E, 0x19, 0x13, 0x15, 0x1B, 0x19, 0x1E, 0x20, 0x1C, 0x15, 0x15, 
-    0x10, 0x1A, 0x24, 0x25, 0x28, 0x1A, 0x10, 0x10, 0x13, 0x19, 0x16, 0x16, 
-    0x14, 0x0E, 0x07, 0x03, 0x09, 0xFF, 0x09, 0x0D, 0x0C, 0x0C, 0x06, 0x08, 
-    0x0A, 0x0F, 0x06, 0x08, 0x08, 0x09, 0x0B, 0x0D, 0x16, 0x18, 0x12, 0x15, 
-    0x18, 0x0E, 0x0D, 0x06, 0x05, 0xFF, 0x02, 0x0B, 0x0B, 0x0B, 0x01, 0xFD, 
-    0xFC, 0xF8, 0xF7, 0xF5, 0xF5, 0xFA, 0x00, 0x01, 0x07, 0xFF, 0xF4, 0xF9, 
-    0xF6, 0xF4, 0xF7, 0xF8, 0xFE, 0x02, 0x00, 0xFD, 0xF6, 0xF3, 0xF4, 0xF5, 
-    0xF6, 0xF0, 0xEB, 0xF0, 0xF2, 0xFC, 0x00, 0xFB, 0xF6, 0xF2, 0xF4, 0xEB, 
-    0xEB, 0xEB, 0xF3, 0xF4, 0xEC, 0xE6, 0xE5, 0xEA, 0xEC, 0xED, 0xE7, 0xE3, 
-    0xDE, 0xDC, 0xE1, 0xE3, 0xE7, 0xE6, 0xE1, 0xDC, 0xD7, 0xE2, 0xE3, 0xDF, 
-    0xDA, 0xD8, 0xE4, 0xEE, 0xF5, 0xF6, 0xF2, 0xEE, 0xF7, 0xF1, 0xF0, 0xF2, 
-    0xEC, 0xF5, 0xFC, 0x00, 0x02, 0x01, 0xFA, 0xFA, 0xFD, 0xFD, 0xF8, 0xF6, 
-    0xF2, 0xF7, 0x01, 0x06, 0x06, 0xFF, 0xFF, 0x01, 0x00, 0xF9, 0xFC, 0xFA, 
-    0xF3, 0x02, 0x0D, 0x0C, 0x0C, 0x0A, 0xFF, 0xF6, 0xF1, 0xF9, 0xFB, 0x01, 
-    0x05, 0x0A, 0x0C, 0x02, 0x02, 0xFF, 0xFF, 0xFB, 0xF9, 0xFB, 0xF7, 0xF8, 
-    0xFF, 0x01, 0x03, 0xFE, 0x00, 0x02, 0x07, 0x03, 0xFF, 0x03, 0xFE, 0xFD, 
-    0x03, 0x07, 0x02, 0x05, 0xFD, 0xF5, 0xEF, 0xEE, 0xEA, 0xEA, 0xEA, 0xEB, 
-    0xEF, 0xE9, 0xEB, 0xE6, 0xE4, 0xE7, 0xE4, 0xE5, 0xE7, 0xE9, 0xF3, 0xF1, 
-    0xF3, 0xF3, 0xF0, 0xF9, 0xFE, 0xFC, 0xFE, 0xFA, 0xFA, 0x00, 0x01, 0x0E, 
-    0x1A, 0x15, 0x0E, 0x09, 0x03, 0xFE, 0xFF, 0x01, 0x04, 0x07, 0x08, 0x10, 
-    0x11, 0x12, 0x12, 0x0E, 0x0E, 0x0B, 0x0C, 0x16, 0x1B, 0x1A, 0x1C, 0x1F, 
-    0x1F, 0x1D, 0x19, 0x1C, 0x19, 0x1B, 0x1E, 0x1C, 0x22, 0x26, 0x26, 0x28, 
-    0x27, 0x23, 0x1A, 0x11, 0x16, 0x1C, 0x27, 0x28, 0x25, 0x23, 0x22, 0x23, 
-    0x24, 0x27, 0x23, 0x21, 0x1E, 0x1E, 0x1D, 0x1D, 0x1A, 0x13, 0x11, 0x0A, 
-    0x07, 0x11, 0x11, 0x0C, 0x09, 0x08, 0x0B, 0x0A, 0x11, 0x0E, 0x09, 0xFF, 
-    0xF6, 0xF8, 0xF5, 0xF3, 0xF1, 0xF7, 0xFD, 0x00, 0xFE, 0xFD, 0xFB, 0xF8, 
-    0xFD, 0xFB, 0xFD, 0x02, 0xFE, 0xFE, 0xFC, 0xFA, 0xFC, 0x00, 0x00, 0xF6, 
-    0xEF, 0xED, 0xEF, 0xEE, 0xF7, 0xFA, 0xF8, 0x01, 0xFE, 0xFA, 0xF0, 0xE8, 
-    0xE5, 0xE3, 0xE8, 0xEB, 0xED, 0xED, 0xEC, 0xE8, 0xE3, 0xE4, 0xE0, 0xDB, 
-    0xDD, 0xE2, 0xE8, 0xF1, 0xF5, 0xF2, 0xEA, 0xE3, 0xE2, 0xE9, 0xEC, 0xEE, 
-    0xED, 0xEA, 0xF5, 0xFE, 0x07, 0x0B, 0x0C, 0x09, 0x03, 0xFF, 0xFD, 0xFF, 
-    0xFD, 0x01, 0x07, 0x09, 0x03, 0xF9, 0xF6, 0xF7, 0xF4, 0xF2, 0xF3, 0xF3, 
-    0xF3, 0xF7, 0xFC, 0xFA, 0xF6, 0xF5, 0xED, 0xED, 0xF2, 0xF0, 0xED, 0xED, 
-    0xF0, 0xF4, 0xFB, 0x00, 0x01, 0xFF, 0xFC, 0xF9, 0xF7, 0xF3, 0xF4, 0xF4, 
-    0xF5, 0xFC, 0x02, 0x03, 0x05, 0x05, 0x02, 0x01, 0x01, 0xFD, 0xFE, 0x03, 
-    0x04, 0x07, 0x00, 0x01, 0xFF, 0xFA, 0xF7, 0xF4, 0xF3, 0xF4, 0xF5, 0xF9, 
-    0xFD, 0x03, 0x08, 0x04, 0x01, 0xF8, 0xF2, 0xF0, 0xEF, 0xF4, 0xF8, 0xFA, 
-    0xFC, 0xFA, 0xF3, 0xF0, 0xF1, 0xF0, 0xF1, 0xF4, 0xF9, 0xFC, 0xFF, 0x05, 
-    0x07, 0x08, 0x09, 0x08, 0x00, 0x02, 0x05, 0x04, 0x03, 0x03, 0x07, 0x06, 
-    0x05, 0x04, 0xFE, 0xFC, 0xF8, 0xF9, 0xF7, 0xFA, 0xFE, 0xFC, 0xFE, 0xFE, 
-    0xFD, 0xF9, 0xF8, 0xF7, 0xFD, 0xFF, 0x01, 0x08, 0x0B, 0x0D, 0x08, 0x07, 
-    0x0F, 0x0E, 0x10, 0x14, 0x16, 0x16, 0x11, 0x15, 0x17, 0x1F, 0x27, 0x2E, 
-    0x2E, 0x25, 0x1D, 0x1A, 0x1E, 0x20, 0x21, 0x23, 0x24, 0x24, 0x25, 0x22, 
-    0x19, 0x11, 0x15, 0x13, 0x11, 0x17, 0x1B, 0x1C, 0x1C, 0x16, 0x12, 0x10, 
-    0x0B, 0x0A, 0x08, 0x08, 0x09, 0x09, 0x0E, 0x19, 0x1C, 0x1A, 0x17, 0x14, 
-    0x0D, 0x08, 0x08, 0x05, 0x06, 0x0B, 0x10, 0x11, 0x0B, 0x06, 0xFF, 0xF9, 
-    0xFA, 0xFD, 0xFD, 0x05, 0x0B, 0x0A, 0x0A, 0x06, 0x01, 0xF9, 0xF5, 0xF3, 
-    0xF3, 0xF4, 0xF3, 0xEF, 0xEB, 0xEE, 0xF2, 0xF2, 0xF0, 0xF0, 0xEC, 0xE7, 
-    0xE9, 0xE7, 0xE3, 0xE6, 0xEA, 0xEF, 0xED, 0xEA, 0xE2, 0xDE, 0xE2, 0xE3, 
-    0xE4, 0xE3, 0xE3, 0xE5, 0xE8, 0xE9, 0xED, 0xF2, 0xF1, 0xEF, 0xEA, 0xE7, 
-    0xE8, 0xE9, 0xED, 0xED, 0xF4, 0xF8, 0xFA, 0xFB, 0xF5, 0xEF, 0xE7, 0xE4, 
-    0xE9, 0xED, 0xF7, 0xFA, 0xFB, 0xFB, 0xF7, 0xF5, 0xF2, 0xEE, 0xEA, 0xEF, 
-    0xF6, 0xF7, 0xFD, 0x01, 0xFD, 0xFB, 0xF7, 0xF7, 0xF9, 0xFA, 0xFB, 0xFA, 
-    0xFA, 0xFE, 0x08, 0x0E, 0x11, 0x0B, 0x09, 0x05, 0xFF, 0x02, 0x01, 0x02, 
-    0x08, 0x0C, 0x05, 0xFE, 0xF7, 0xED, 0xE9, 0xEE, 0xF2, 0xF2, 0xF5, 0xF5, 
-    0xF6, 0xF8, 0xF8, 0xF4, 0xF0, 0xF4, 0xF6, 0xF4, 0xF5, 0xEF, 0xE5, 0xE5, 
-    0xE8, 0xEF, 0xF5, 0xF8, 0xF8, 0xF9, 0xF9, 0xF7, 0xF7, 0xF8, 0xFB, 0x00, 
-    0xFF, 0x03, 0x00, 0xFD, 0xFC, 0xF5, 0xF4, 0xEF, 0xF3, 0xF8, 0xFD, 0x03, 
-    0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0xFC, 0xF8, 0xF7, 0xFA, 0xFC, 0x02, 
-    0x02, 0x04, 0x04, 0xFF, 0xF8, 0xF2, 0xED, 0xEC, 0xF7, 0x00, 0x08, 0x08, 
-    0x02, 0xFE, 0xFB, 0xFA, 0xFC, 0xFE, 0x02, 0x09, 0x13, 0x19, 0x1A, 0x18, 
-    0x16, 0x16, 0x17, 0x19, 0x19, 0x19, 0x1D, 0x1F, 0x22, 0x25, 0x26, 0x25, 
-    0x1D, 0x16, 0x14, 0x14, 0x13, 0x13, 0x12, 0x0F, 0x10, 0x14, 0x11, 0x0D, 
-    0x0A, 0x04, 0x07, 0x0A, 0x08, 0x0C, 0x0C, 0x0C, 0x0E, 0x10, 0x10, 0x11, 
-    0x13, 0x13, 0x17, 0x16, 0x12, 0x10, 0x0D, 0x10, 0x16, 0x18, 0x1B, 0x18, 
-    0x13, 0x0A, 0x07, 0x08, 0x09, 0x0C, 0x11, 0x15, 0x19, 0x15, 0x0C, 0x07, 
-    0xFE, 0xFD, 0xFD, 0xFB, 0xFE, 0xFE, 0x01, 0x02, 0x01, 0xFE, 0xFB, 0xF9, 
-    0xF6, 0xF1, 0xEE, 0xED, 0xED, 0xF3, 0xF5, 0xF7, 0xF5, 0xF0, 0xED, 0xE9, 
-    0xE4, 0xE5, 0xED, 0xF3, 0xFF, 0x03, 0x03, 0x01, 0xFB, 0xF9, 0xF4, 0xEF, 
-    0xF0, 0xF0, 0xF2, 0xF1, 0xF2, 0xED, 0xE7, 0xE4, 0xDF, 0xDD, 0xE0, 0xE3, 
-    0xE4, 0xE5, 0xE5, 0xE4, 0xE4, 0xE9, 0xEC, 0xEE, 0xEB, 0xEA, 0xE9, 0xE7, 
-    0xE9, 0xEA, 0xEB, 0xF2, 0xFA, 0xF7, 0xF4, 0xF4, 0xF4, 0xF5, 0xF9, 0xFA, 
-    0xFA, 0xFA, 0xFB, 0xF8, 0xF5, 0xF7, 0xF5, 0xF7, 0xF8, 0xF6, 0xF8, 0xF6, 
-    0xF5, 0xF9, 0x00, 0x05, 0x06, 0x05, 0x03, 0xFD, 0xFA, 0xF6, 0xF3, 0xF5, 
-    0xFA, 0x01, 0x00, 0x01, 0xFD, 0xF8, 0xF3, 0xEF, 0xEC, 0xEA, 0xEF, 0xF4, 
-    0xF6, 0xF8, 0xF4, 0xF3, 0xED, 0xEB, 0xED, 0xEE, 0xF4, 0xF9, 0xFB, 0xFF, 
-    0x02, 0x06, 0x0B, 0x07, 0x02, 0xFD, 0xFC, 0xF9, 0xF8, 0xFC, 0x03, 0x07, 
-    0x0A, 0x06, 0xFD, 0xF8, 0xF0, 0xEC, 0xEB, 0xEF, 0xF6, 0xFD, 0x00, 0xFE, 
-    0xF6, 0xF5, 0xF6, 0xF6, 0xFA, 0xF8, 0xF7, 0xF9, 0xFB, 0xFB, 0xFF, 0x02, 
-    0x05, 0x06, 0x01, 0x00, 0xFB, 0xF8, 0xF6, 0xF6, 0xF6, 0xF6, 0xF9, 0xFD, 
-    0x00, 0x00, 0xFF, 0xFC, 0xFC, 0xFC, 0x01, 0x0A, 0x0F, 0x12, 0x14, 0x15, 
-    0x14, 0x13, 0x13, 0x12, 0x10, 0x0E, 0x0C, 0x10, 0x12, 0x15, 0x1B, 0x1D, 
-    0x1B, 0x17, 0x12, 0x0C, 0x08, 0x06, 0x0A, 0x13, 0x19, 0x1E, 0x1E, 0x18, 
-    0x11, 0x09, 0x09, 0x0D, 0x13, 0x17, 0x1F, 0x26, 0x25, 0x24, 0x22, 0x1D, 
-    0x1A, 0x1B, 0x19, 0x1A, 0x18, 0x17, 0x19, 0x18, 0x18, 0x16, 0x12, 0x0D, 
-    0x09, 0x06, 0x05, 0x07, 0x0A, 0x0E, 0x0D, 0x09, 0x06, 0x04, 0x00, 0xFF, 
-    0xFD, 0xFC, 0xFD, 0xFD, 0x00, 0x01, 0x01, 0xFE, 0xFD, 0xFB, 0xFB, 0xFE, 
-    0x02, 0x04, 0x03, 0xFC, 0xFA, 0xF9, 0xFB, 0x00, 0x01, 0x00, 0xFF, 0xFE, 
-    0xFB, 0xF6, 0xF3, 0xF5, 0xFB, 0x00, 0x02, 0xFF, 0xFB, 0xF8, 0xF4, 0xEF, 
-    0xEC, 0xEA, 0xEA, 0xEC, 0xEE, 0xED, 0xED, 0xEB, 0xE7, 0xE5, 0xE1, 0xDE, 
-    0xDD, 0xDC, 0xDE, 0xE3, 0xE7, 0xE9, 0xEB, 0xE9, 0xE6, 0xE5, 0xE6, 0xEB, 
-    0xF2, 0xF6, 0xFC, 0x00, 0x03, 0x02, 0xFE, 0xF8, 0xF3, 0xF2, 0xF6, 0xFC, 
-    0xFF, 0x00, 0xFE, 0xFC, 0xF7, 0xF3, 0xEF, 0xEC, 0xED, 0xF3, 0xF8, 0xFD, 
-    0xFE, 0xFF, 0xFF, 0xFD, 0xFA, 0xF9, 0xF7, 0xF7, 0xF9, 0xF8, 0xF9, 0xF6, 
-    0xF7, 0xF9, 0xFC, 0xFD, 0xFE, 0xFE, 0xFD, 0xFC, 0xFC, 0xFB, 0xFA, 0xF9, 
-    0xF6, 0xF5, 0xF4, 0xF6, 0xF8, 0xFA, 0xFC, 0xFC, 0xF8, 0xF6, 0xF6, 0xFA, 
-    0xFF, 0x03, 0x05, 0x03, 0xFF, 0xFC, 0xFA, 0xF6, 0xF1, 0xED, 0xEE, 0xF3, 
-    0xF8, 0xFC, 0xFC, 0xF7, 0xF5, 0xF0, 0xEC, 0xEB, 0xED, 0xF1, 0xF7, 0xFB, 
-    0xFC, 0xFC, 0xF9, 0xF4, 0xF1, 0xF2, 0xF5, 0xFA, 0xFD, 0x01, 0x06, 0x0C, 
-    0x11, 0x14, 0x10, 0x09, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0x05, 0x0B, 0x0D, 
-    0x0A, 0x01, 0xFA, 0xF8, 0xF9, 0xFC, 0xFF, 0x03, 0x06, 0x06, 0x04, 0x04, 
-    0x05, 0x03, 0x02, 0x03, 0x06, 0x07, 0x08, 0x07, 0x09, 0x0E, 0x0F, 0x11, 
-    0x10, 0x0D, 0x0F, 0x0D, 0x0D, 0x0E, 0x0E, 0x10, 0x15, 0x17, 0x16, 0x18, 
-    0x19, 0x19, 0x1C, 0x1C, 0x19, 0x15, 0x15, 0x18, 0x1B, 0x1E, 0x1C, 0x19, 
-    0x16, 0x13, 0x11, 0x0E, 0x0B, 0x08, 0x07, 0x0C, 0x10, 0x15, 0x15, 0x14, 
-    0x0F, 0x08, 0x03, 0x01, 0x02, 0x06, 0x0D, 0x12, 0x16, 0x16, 0x14, 0x0C, 
-    0x04, 0xFE, 0xFD, 0x05, 0x0F, 0x15, 0x17, 0x15, 0x12, 0x0F, 0x0B, 0x07, 
-    0x04, 0x04, 0x06, 0x05, 0x06, 0x05, 0x07, 0x07, 0x04, 0xFF, 0xFB, 0xF9, 
-    0xF9, 0xFB, 0xFB, 0xFE, 0xFF, 0xFE, 0xFA, 0xF4, 0xF0, 0xED, 0xEC, 0xEC, 
-    0xED, 0xEF, 0xF2, 0xF4, 0xF5, 0xF3, 0xEF, 0xED, 0xEA, 0xE8, 0xEA, 0xEC, 
-    0xEC, 0xED, 0xEB, 0xEA, 0xE9, 0xE9, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 
-    0xE9, 0xE5, 0xE7, 0xED, 0xF1, 0xF5, 0xF6, 0xF5, 0xF3, 0xF0, 0xED, 0xED, 
-    0xEB, 0xEE, 0xF1, 0xF2, 0xF2, 0xF4, 0xF4, 0xF0, 0xED, 0xEC, 0xEC, 0xED, 
-    0xEE, 0xF4, 0xFA, 0x02, 0x06, 0x06, 0x02, 0xFC, 0xF8, 0xF6, 0xF6, 0xF9, 
-    0x01, 0x08, 0x0D, 0x0D, 0x06, 0xFF, 0xF9, 0xF8, 0xF7, 0xF8, 0xFA, 0xFD, 
-    0x00, 0x02, 0x00, 0xFD, 0xF6, 0xEE, 0xE9, 0xEC, 0xF2, 0xF8, 0xFC, 0xFF, 
-    0x00, 0xFE, 0xFB, 0xF6, 0xF4, 0xF1, 0xF4, 0xF7, 0xF7, 0xF9, 0xFA, 0xFB, 
-    0xFD, 0xFC, 0xFC, 0xFB, 0xFB, 0xFA, 0xFC, 0xFD, 0xFF, 0x00, 0x00, 0x00, 
-    0xFE, 0xFD, 0xFD, 0xFB, 0xF8, 0xFB, 0xFC, 0xFB, 0xF8, 0xF2, 0xEE, 0xF2, 
-    0xF5, 0xF5, 0xF7, 0xF4, 0xF4, 0xF2, 0xF2, 0xF6, 0xF8, 0xFC, 0xFF, 0x04, 
-    0x08, 0x04, 0x05, 0x01, 0xFC, 0xF8, 0xF5, 0xF6, 0xFB, 0x03, 0x06, 0x0C, 
-    0x0C, 0x0D, 0x09, 0x06, 0x05, 0x06, 0x0D, 0x0A, 0x11, 0x17, 0x1B, 0x20, 
-    0x1C, 0x16, 0x11, 0x0B, 0x0C, 0x0D, 0x10, 0x15, 0x18, 0x1C, 0x1D, 0x18, 
-    0x15, 0x12, 0x0C, 0x0D, 0x10, 0x13, 0x1B, 0x1C, 0x1A, 0x19, 0x11, 0x0E, 
-    0x0B, 0x10, 0x10, 0x0F, 0x0F, 0x0F, 0x11, 0x10, 0x11, 0x0D, 0x10, 0x0E, 
-    0x0D, 0x10, 0x0C, 0x0D, 0x0D, 0x0B, 0x0F, 0x11, 0x10, 0x0D, 0x0B, 0x09, 
-    0x0C, 0x0A, 0x08, 0x08, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x04, 0x03, 
-    0x02, 0x05, 0x00, 0x03, 0x01, 0xFF, 0x05, 0x05, 0x04, 0xFB, 0xF8, 0xF5, 
-    0xF3, 0xF1, 0xF2, 0xF3, 0xF8, 0xFE, 0x00, 0x00, 0xFF, 0xF9, 0xF6, 0xF8, 
-    0xF8, 0xF9, 0xF9, 0xFE, 0x01, 0x05, 0x05, 0x04, 0x00, 0xF8, 0xF6, 0xF6, 
-    0xF5, 0xF4, 0xF4, 0xF5, 0xF6, 0xF8, 0xF9, 0xF2, 0xED, 0xE5, 0xE2, 0xE2, 
-    0xE4, 0xE7, 0xEE, 0xF1, 0xF1, 0xF1, 0xEB, 0xE8, 0xE7, 0xE5, 0xE5, 0xE8, 
-    0xEB, 0xF5, 0xF5, 0xF5, 0xF1, 0xF0, 0xF1, 0xF1, 0xF1, 0xF2, 0xF8, 0xF7, 
-    0xF9, 0xF9, 0xFE, 0x02, 0x04, 0x04, 0x00, 0xFE, 0xFC, 0xF9, 0xF7, 0xF7, 
-    0xF5, 0xF7, 0xF9, 0xFD, 0xFB, 0xF9, 0xF6, 0xF2, 0xF0, 0xED, 0xEF, 0xF1, 
-    0xF4, 0xF8, 0xF8, 0xF7, 0xF5, 0xF0, 0xEB, 0xEA, 0xE7, 0xE8, 0xEB, 0xEB, 
-    0xEF, 0xF7, 0xFD, 0xFF, 0xFE, 0xF9, 0xF5, 0xF2, 0xF2, 0xF4, 0xF9, 0x01, 
-    0x07, 0x0B, 0x09, 0x03, 0xFB, 0xF8, 0xF5, 0xF5, 0xF6, 0xF8, 0xFB, 0xFE, 
-    0x00, 0xFE, 0xFD, 0xF7, 0xF3, 0xF3, 0xF5, 0xFB, 0xFE, 0x01, 0xFF, 0x00, 
-    0x03, 0x01, 0xFF, 0xF6, 0xF4, 0xF4, 0xFA, 0xFF, 0x06, 0x0A, 0x0D, 0x0E, 
-    0x0B, 0x09, 0x05, 0x04, 0x04, 0x06, 0x05, 0x08, 0x08, 0x0A, 0x09, 0x07, 
-    0x07, 0x06, 0x09, 0x08, 0x08, 0x05, 0x03, 0xFE, 0xFB, 0xFA, 0xFE, 0x04, 
-    0x04, 0x03, 0x01, 0x02, 0x02, 0x01, 0x00, 0x04, 0x0A, 0x11, 0x14, 0x14, 
-    0x10, 0x0C, 0x09, 0x09, 0x0C, 0x0E, 0x13, 0x16, 0x17, 0x18, 0x1B, 0x1C, 
-    0x1B, 0x1A, 0x16, 0x14, 0x10, 0x0F, 0x12, 0x14, 0x17, 0x1A, 0x1D, 0x19, 
-    0x13, 0x0B, 0x07, 0x08, 0x0B, 0x12, 0x17, 0x18, 0x19, 0x17, 0x12, 0x09, 
-    0x01, 0xFD, 0xFB, 0x00, 0x04, 0x09, 0x0D, 0x0F, 0x0D, 0x09, 0x06, 0x03, 
-    0x06, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x08, 0x08, 0x07, 0x05, 0x03, 0x00, 
-    0xFF, 0xFC, 0xFD, 0x02, 0x0C, 0x0F, 0x11, 0x0F, 0x09, 0x05, 0x00, 0xFF, 
-    0xFC, 0xFA, 0xF8, 0xF8, 0xF8, 0xF8, 0xF6, 0xF5, 0xF3, 0xF0, 0xEF, 0xEE, 
-    0xF0, 0xF0, 0xF1, 0xF0, 0xF2, 0xF5, 0xF8, 0xF6, 0xEF, 0xE9, 0xE5, 0xE3, 
-    0xE4, 0xE8, 0xEE, 0xF7, 0xFF, 0x01, 0xFC, 0xF5, 0xF1, 0xEF, 0xEF, 0xEE, 
-    0xED, 0xF0, 0xF4, 0xFA, 0xFD, 0xFB, 0xF8, 0xF2, 0xEC, 0xEB, 0xEC, 0xF0, 
-    0xF2, 0xF5, 0xFA, 0xFC, 0xFF, 0xFD, 0xFA, 0xF2, 0xEB, 0xE8, 0xE8, 0xF0, 
-    0xF8, 0x00, 0x05, 0x06, 0x04, 0xFC, 0xF2, 0xE9, 0xE6, 0xE7, 0xED, 0xF3, 
-    0xF7, 0xF9, 0xFA, 0xF9, 0xF7, 0xF7, 0xF6, 0xF8, 0xF9, 0xFA, 0xFD, 0xFD, 
-    0xFF, 0x03, 0x03, 0x01, 0xFD, 0xF9, 0xF4, 0xF0, 0xF0, 0xF3, 0xF8, 0xFD, 
-    0x01, 0x02, 0x00, 0xFB, 0xF2, 0xEB, 0xE7, 0xE8, 0xEB, 0xEE, 0xF2, 0xF6, 
-    0xF9, 0xF6, 0xF4, 0xF0, 0xED, 0xEC, 0xEF, 0xF4, 0xF7, 0xFB, 0xFE, 0x00, 
-    0x03, 0x05, 0x03, 0xFC, 0xF6, 0xF4, 0xF5, 0xF7, 0xFC, 0x06, 0x0F, 0x14, 
-    0x15, 0x10, 0x07, 0x00, 0xFB, 0xFB, 0xFD, 0x02, 0x09, 0x0F, 0x0F, 0x0C, 
-    0x07, 0x02, 0xFD, 0xFB, 0xFB, 0xFF, 0x03, 0x08, 0x0A, 0x0B, 0x0E, 0x0C, 
-    0x0A, 0x06, 0xFF, 0xFC, 0xFC, 0x00, 0x07, 0x0F, 0x16, 0x1B, 0x1B, 0x16, 
-    0x11, 0x0D, 0x0C, 0x0D, 0x0F, 0x12, 0x16, 0x1C, 0x20, 0x22, 0x1E, 0x19, 
-    0x16, 0x16, 0x19, 0x1B, 0x19, 0x14, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x04, 
-    0xFD, 0xF8, 0xF5, 0xF4, 0xF6, 0xFB, 0x04, 0x0C, 0x11, 0x10, 0x0D, 0x08, 
-    0x02, 0xFE, 0xFC, 0xFE, 0x01, 0x06, 0x0D, 0x12, 0x14, 0x12, 0x0D, 0x0A, 
-    0x08, 0x06, 0x05, 0x06, 0x07, 0x0B, 0x0F, 0x11, 0x11, 0x0F, 0x08, 0x01, 
-    0xFA, 0xF6, 0xFA, 0x01, 0x0A, 0x12, 0x15, 0x13, 0x0C, 0x03, 0xF9, 0xF2, 
-    0xF1, 0xF3, 0xF8, 0xFC, 0xFF, 0x00, 0xFF, 0xFC, 0xF7, 0xF2, 0xEB, 0xEB, 
-    0xEE, 0xF2, 0xF5, 0xF6, 0xFA, 0xFD, 0xFC, 0xFC, 0xF8, 0xF0, 0xEC, 0xEA, 
-    0xEB, 0xEF, 0xF3, 0xF9, 0x00, 0x01, 0xFF, 0xFA, 0xF5, 0xF1, 0xEF, 0xEE, 
-    0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xEB, 0xEA, 0xEB, 0xEB, 0xE9, 0xE7, 
-    0xE6, 0xE7, 0xEB, 0xF0, 0xF4, 0xF6, 0xF4, 0xEF, 0xEB, 0xE6, 0xE4, 0xE7, 
-    0xEE, 0xF6, 0xFF, 0x05, 0x09, 0x08, 0x02, 0xFE, 0xF9, 0xF6, 0xF5, 0xF7, 
-    0xFA, 0xFD, 0xFD, 0xFC, 0xFA, 0xF6, 0xF3, 0xF0, 0xF0, 0xF2, 0xF3, 0xF4, 
-    0xF7, 0xFD, 0x01, 0x01, 0xF9, 0xEF, 0xE7, 0xE2, 0xE3, 0xE8, 0xF0, 0xF9, 
-    0xFF, 0x02, 0x01, 0xFA, 0xF2, 0xEB, 0xE7, 0xE6, 0xEA, 0xEF, 0xF4, 0xFA, 
-    0xFC, 0xFD, 0xFB, 0xF9, 0xF8, 0xF9, 0xFA, 0xFD, 0xFF, 0x00, 0x02, 0x04, 
-    0x07, 0x09, 0x08, 0x06, 0x01, 0xFD, 0xFB, 0xFC, 0x00, 0x05, 0x09, 0x08, 
-    0x07, 0x02, 0xFC, 0xF8, 0xF5, 0xF5, 0xF6, 0xF8, 0xF9, 0xFB, 0xFC, 0xFD, 
-    0xFD, 0xFD, 0xFD, 0xFA, 0xF9, 0xFA, 0xFC, 0xFF, 0x00, 0x04, 0x0B, 0x11, 
-    0x15, 0x13, 0x0A, 0x05, 0x00, 0xFF, 0x03, 0x08, 0x0F, 0x14, 0x18, 0x18, 
-    0x13, 0x0C, 0x05, 0x01, 0x04, 0x0B, 0x12, 0x15, 0x17, 0x18, 0x16, 0x13, 
-    0x0F, 0x08, 0x04, 0x04, 0x06, 0x09, 0x0D, 0x12, 0x18, 0x1C, 0x1B, 0x14, 
-    0x0C, 0x02, 0xFB, 0xFA, 0xFF, 0x07, 0x10, 0x15, 0x16, 0x14, 0x10, 0x0B, 
-    0x07, 0x06, 0x08, 0x0D, 0x13, 0x17, 0x1B, 0x1B, 0x18, 0x13, 0x10, 0x0D, 
-    0x0D, 0x0F, 0x10, 0x0F, 0x0E, 0x0C, 0x0D, 0x0E, 0x0E, 0x0B, 0x05, 0xFE, 
-    0xF7, 0xF3, 0xF1, 0xF4, 0xF9, 0xFF, 0x03, 0x03, 0xFF, 0xFA, 0xF5, 0xF2, 
-    0xF1, 0xF2, 0xF5, 0xF9, 0xFD, 0x01, 0x04, 0x05, 0x06, 0x08, 0x07, 0x06, 
-    0x02, 0xFD, 0xFA, 0xFA, 0xFE, 0x03, 0x05, 0x02, 0xFD, 0xF7, 0xF1, 0xEA, 
-    0xE6, 0xE9, 0xF1, 0xF9, 0xFF, 0x01, 0xFD, 0xF6, 0xED, 0xE6, 0xE2, 0xE2, 
-    0xE7, 0xEC, 0xF1, 0xF4, 0xF4, 0xF3, 0xEF, 0xEA, 0xE7, 0xE6, 0xE8, 0xE9, 
-    0xEB, 0xEB, 0xEF, 0xF4, 0xF8, 0xFA, 0xF8, 0xF5, 0xF2, 0xF1, 0xF1, 0xF5, 
-    0xFC, 0x03, 0x08, 0x09, 0x08, 0x04, 0x00, 0xFD, 0xFB, 0xFB, 0xFE, 0x02, 
-    0x03, 0x00, 0xFB, 0xF4, 0xEF, 0xEE, 0xEF, 0xF0, 0xF0, 0xED, 0xEB, 0xE5, 
-    0xE3, 0xE6, 0xEA, 0xEF, 0xF1, 0xF0, 0xEC, 0xE9, 0xE6, 0xE7, 0xEE, 0xF5, 
-    0xFB, 0xFF, 0x01, 0x01, 0xFF, 0xFD, 0xFA, 0xF6, 0xF4, 0xF6, 0xF9, 0xFD, 
-    0x00, 0x00, 0xFB, 0xF9, 0xF9, 0xFA, 0xFA, 0xFB, 0xFA, 0xFB, 0xFD, 0x02, 
-    0x06, 0x08, 0x05, 0x00, 0xF8, 0xF0, 0xEB, 0xE9, 0xED, 0xF5, 0x00, 0x08, 
-    0x0B, 0x06, 0xFD, 0xF3, 0xEF, 0xED, 0xEF, 0xF3, 0xF9, 0xFF, 0x01, 0x00, 
-    0xFF, 0xFD, 0xFE, 0x00, 0x03, 0x07, 0x0A, 0x0C, 0x0D, 0x0E, 0x11, 0x14, 
-    0x16, 0x14, 0x10, 0x0B, 0x07, 0x06, 0x0A, 0x0F, 0x12, 0x14, 0x13, 0x11, 
-    0x0E, 0x08, 0x03, 0xFE, 0xFD, 0xFE, 0x01, 0x05, 0x05, 0x06, 0x05, 0x04, 
-    0x03, 0x03, 0x05, 0x07, 0x07, 0x05, 0x04, 0x08, 0x0F, 0x18, 0x1F, 0x1F, 
-    0x1B, 0x14, 0x0D, 0x08, 0x07, 0x09, 0x0F, 0x16, 0x1C, 0x1D, 0x1A, 0x12, 
-    0x0B, 0x04, 0x00, 0xFF, 0x02, 0x0A, 0x10, 0x15, 0x15, 0x12, 0x0F, 0x0E, 
-    0x0C, 0x0D, 0x0B, 0x09, 0x08, 0x08, 0x0E, 0x13, 0x14, 0x10, 0x08, 0x02, 
-    0xFA, 0xF6, 0xF6, 0xFA, 0x03, 0x0B, 0x11, 0x12, 0x0F, 0x0D, 0x0B, 0x0A, 
-    0x09, 0x09, 0x09, 0x0B, 0x0D, 0x0C, 0x08, 0x04, 0x01, 0xFF, 0xFF, 0x01, 
-    0x02, 0x01, 0xFE, 0xFB, 0xF9, 0xF9, 0xFB, 0xFA, 0xF6, 0xF3, 0xEE, 0xEB, 
-    0xE8, 0xE7, 0xEA, 0xEF, 0xF4, 0xF7, 0xF6, 0xF2, 0xEC, 0xE9, 0xE8, 0xE6, 
-    0xE5, 0xE6, 0xE8, 0xEB, 0xEF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF3, 0xF4, 0xF2, 
-    0xF0, 0xEE, 0xF1, 0xF7, 0xFD, 0x00, 0xFC, 0xF7, 0xF1, 0xEC, 0xEC, 0xEF, 
-    0xF5, 0xFB, 0x00, 0x04, 0x04, 0x00, 0xFB, 0xF4, 0xF0, 0xEF, 0xF2, 0xF6, 
-    0xFD, 0x01, 0x02, 0xFF, 0xF7, 0xF1, 0xEF, 0xEF, 0xEF, 0xEE, 0xF0, 0xF2, 
-    0xF6, 0xFA, 0xFD, 0xFF, 0xFE, 0xF9, 0xF4, 0xF1, 0xF2, 0xF6, 0xFB, 0x00, 
-    0x03, 0x06, 0x06, 0x02, 0xFC, 0xF7, 0xF4, 0xF5, 0xF7, 0xF9, 0xFA, 0xF9, 
-    0xF7, 0xF3, 0xF0, 0xEE, 0xED, 0xEE, 0xF1, 0xF3, 0xF4, 0xF3, 0xF1, 0xF2, 
-    0xF4, 0xF7, 0xF8, 0xF4, 0xEE, 0xE8, 0xE4, 0xE6, 0xEA, 0xF0, 0xF5, 0xF9, 
-    0xFD, 0xFF, 0xFF, 0xFC, 0xFA, 0xF8, 0xF9, 0xFB, 0xFD, 0x01, 0x03, 0x05, 
-    0x04, 0x05, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x09, 
-    0x0A, 0x06, 0xFF, 0xF6, 0xEE, 0xEA, 0xEC, 0xF3, 0xFD, 0x07, 0x0C, 0x0C, 
-    0x08, 0x04, 0xFF, 0xFD, 0xFE, 0xFE, 0x03, 0x09, 0x0F, 0x12, 0x12, 0x0F, 
-    0x0F, 0x13, 0x17, 0x1A, 0x1B, 0x19, 0x18, 0x1A, 0x1F, 0x23, 0x23, 0x1E, 
-    0x16, 0x10, 0x0C, 0x0C, 0x0E, 0x12, 0x14, 0x15, 0x16, 0x15, 0x12, 0x0E, 
-    0x0A, 0x08, 0x07, 0x07, 0x08, 0x07, 0x05, 0x03, 0x01, 0xFE, 0xFD, 0xFF, 
-    0x00, 0x04, 0x05, 0x05, 0x03, 0x00, 0xFF, 0x00, 0x04, 0x09, 0x0A, 0x08, 
-    0x03, 0xFF, 0xFD, 0x00, 0x05, 0x0B, 0x10, 0x11, 0x10, 0x0E, 0x0C, 0x0A, 
-    0x08, 0x06, 0x07, 0x09, 0x09, 0x08, 0x04, 0x00, 0xFD, 0xFD, 0xFC, 0xFA, 
-    0xF7, 0xF3, 0xF2, 0xF3, 0xF6, 0xFB, 0x01, 0x04, 0x02, 0xFB, 0xF0, 0xE8, 
-    0xE8, 0xEE, 0xF6, 0xFD, 0xFF, 0x01, 0x03, 0x03, 0xFF, 0xFB, 0xF8, 0xFA, 
-    0xFD, 0xFE, 0xFD, 0xFD, 0xFE, 0xFB, 0xF5, 0xF0, 0xEC, 0xEF, 0xF3, 0xF6, 
-    0xF8, 0xF7, 0xF6, 0xF5, 0xF8, 0xFA, 0xF9, 0xF5, 0xED, 0xE7, 0xE5, 0xE9, 
-    0xEF, 0xF4, 0xF6, 0xF8, 0xF7, 0xF3, 0xEE, 0xE9, 0xE7, 0xE8, 0xEB, 0xEF, 
-    0xF1, 0xF2, 0xF1, 0xF1, 0xF1, 0xF2, 0xF5, 0xF7, 0xFA, 0xFA, 0xF7, 0xF3, 
-    0xF3, 0xF7, 0xFD, 0x03, 0x05, 0x02, 0xFB, 0xF5, 0xF1, 0xF1, 0xF4, 0xF9, 
-    0xFE, 0x03, 0x04, 0x02, 0xFD, 0xF9, 0xF5, 0xF4, 0xF1, 0xEE, 0xEE, 0xF1, 
-    0xF6, 0xF8, 0xF7, 0xF4, 0xF2, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xFA, 
-    0x00, 0x06, 0x0A, 0x0C, 0x07, 0xFD, 0xF3, 0xEF, 0xF3, 0xF8, 0xFE, 0x02, 
-    0x03, 0x00, 0xFC, 0xF8, 0xF5, 0xF5, 0xF7, 0xF9, 0xFB, 0xFD, 0xFF, 0xFF, 
-    0xFB, 0xF9, 0xF8, 0xFA, 0xFD, 0xFE, 0xFD, 0xFC, 0xF9, 0xF7, 0xF9, 0xFD, 
-    0x00, 0x00, 0xFB, 0xF5, 0xF0, 0xF0, 0xF3, 0xF5, 0xF7, 0xFB, 0xFF, 0x02, 
-    0x03, 0x02, 0x02, 0x05, 0x08, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 
-    0x0E, 0x0D, 0x0F, 0x12, 0x14, 0x14, 0x12, 0x0F, 0x0F, 0x14, 0x19, 0x1C, 
-    0x1B, 0x16, 0x0E, 0x07, 0x04, 0x06, 0x0B, 0x12, 0x17, 0x18, 0x18, 0x15, 
-    0x11, 0x0D, 0x0B, 0x0B, 0x0D, 0x0F, 0x0F, 0x10, 0x0F, 0x0F, 0x0E, 0x0E, 
-    0x0D, 0x0D, 0x0E, 0x0F, 0x0E, 0x0C, 0x09, 0x09, 0x0C, 0x0F, 0x0E, 0x0A, 
-    0x03, 0xFE, 0xFF, 0x03, 0x08, 0x0D, 0x10, 0x10, 0x0D, 0x07, 0x02, 0x01, 
-    0x01, 0x03, 0x04, 0x04, 0x06, 0x07, 0x06, 0x02, 0xFC, 0xF7, 0xF5, 0xF8, 
-    0xFC, 0xFB, 0xF9, 0xF6, 0xF4, 0xF5, 0xF8, 0xFB, 0xFC, 0xFB, 0xF5, 0xF0, 
-    0xEC, 0xEB, 0xEF, 0xF4, 0xFA, 0xFF, 0x00, 0xFD, 0xF9, 0xF5, 0xF4, 0xF5, 
-    0xF6, 0xF7, 0xF6, 0xF8, 0xFB, 0xFD, 0xFC, 0xF9, 0xF4, 0xF3, 0xF4, 0xF3, 
-    0xF0, 0xEA, 0xE9, 0xED, 0xF4, 0xFB, 0xFE, 0xFB, 0xF4, 0xEC, 0xE7, 0xE6, 
-    0xEA, 0xF0, 0xF6, 0xFB, 0xFD, 0xFB, 0xF8, 0xF5, 0xF6, 0xF8, 0xFA, 0xFC, 
-    0xFE, 0x01, 0x04, 0x06, 0x05, 0x01, 0xFD, 0xFB, 0xFC, 0xFF, 0x00, 0x02, 
-    0x02, 0x01, 0x02, 0x03, 0x03, 0x00, 0xFA, 0xF0, 0xEA, 0xE9, 0xED, 0xF3, 
-    0xF8, 0xFC, 0xFB, 0xF8, 0xF5, 0xF2, 0xF1, 0xF1, 0xEF, 0xED, 0xEB, 0xEC, 
-    0xED, 0xEC, 0xEC, 0xEA, 0xEA, 0xEB, 0xEF, 0xF2, 0xF4, 0xF2, 0xEE, 0xEE, 
-    0xF2, 0xF9, 0xFE, 0x00, 0xFE, 0xFA, 0xF5, 0xF4, 0xF4, 0xF8, 0xFE, 0x03, 
-    0x05, 0x04, 0x03, 0x01, 0x02, 0x02, 0x00, 0xFB, 0xF7, 0xF4, 0xF6, 0xF9, 
-    0xFC, 0xFC, 0xFA, 0xF7, 0xF6, 0xF8, 0xF9, 0xF9, 0xF7, 0xF6, 0xF8, 0xFE, 
-    0x04, 0x08, 0x06, 0x00, 0xFB, 0xFA, 0xFC, 0x02, 0x07, 0x0B, 0x0D, 0x0E, 
-    0x0D, 0x0B, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x11, 0x12, 0x11, 0x0F, 0x0C, 
-    0x07, 0x03, 0x00, 0x05, 0x09, 0x0B, 0x0B, 0x07, 0x07, 0x0B, 0x10, 0x11, 
-    0x10, 0x0B, 0x05, 0x01, 0x01, 0x04, 0x0A, 0x0E, 0x10, 0x0E, 0x09, 0x07, 
-    0x08, 0x0A, 0x0B, 0x0B, 0x0A, 0x0A, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 
-    0x0E, 0x12, 0x17, 0x18, 0x16, 0x12, 0x10, 0x13, 0x18, 0x1C, 0x1C, 0x16, 
-    0x0D, 0x04, 0xFF, 0xFD, 0xFE, 0x01, 0x04, 0x08, 0x09, 0x09, 0x07, 0x04, 
-    0x03, 0x02, 0x02, 0x01, 0x03, 0x05, 0x07, 0x0A, 0x0A, 0x08, 0x06, 0x05, 
-    0x07, 0x09, 0x08, 0x05, 0x03, 0x06, 0x0A, 0x0F, 0x10, 0x0B, 0x01, 0xF6, 
-    0xED, 0xEB, 0xEF, 0xF8, 0xFE, 0x00, 0xFE, 0xF9, 0xF7, 0xF5, 0xF4, 0xF2, 
-    0xF1, 0xF2, 0xF6, 0xF8, 0xF7, 0xF5, 0xF1, 0xF0, 0xEF, 0xEE, 0xED, 0xEC, 
-    0xEA, 0xEB, 0xEA, 0xEB, 0xED, 0xF0, 0xF3, 0xF2, 0xEF, 0xEB, 0xE7, 0xE6, 
-    0xE8, 0xEC, 0xF0, 0xF4, 0xF5, 0xF5, 0xF4, 0xF3, 0xF6, 0xF8, 0xF9, 0xF8, 
-    0xF8, 0xFA, 0xFE, 0x02, 0x04, 0x03, 0x02, 0x01, 0x02, 0x02, 0x00, 0xFC, 
-    0xF8, 0xF6, 0xF8, 0xFD, 0x00, 0x02, 0x01, 0xFB, 0xF6, 0xF1, 0xF1, 0xF4, 
-    0xF8, 0xFC, 0xFF, 0x01, 0x03, 0x01, 0xFF, 0xFD, 0xFD, 0xFD, 0xFF, 0xFF, 
-    0xFE, 0xFD, 0xFD, 0xFF, 0xFD, 0xF9, 0xF4, 0xF2, 0xF2, 0xF5, 0xF6, 0xF5, 
-    0xF5, 0xF7, 0xFB, 0xFE, 0xFC, 0xF5, 0xEF, 0xEE, 0xF1, 0xF5, 0xFA, 0xFC, 
-    0xFC, 0xFA, 0xF9, 0xF7, 0xF6, 0xF6, 0xF5, 0xF4, 0xF3, 0xF5, 0xF6, 0xF5, 
-    0xF1, 0xEC, 0xE8, 0xE6, 0xE7, 0xEB, 0xEE, 0xF0, 0xEF, 0xEE, 0xF0, 0xF7, 
-    0xFF, 0x03, 0x02, 0xFE, 0xF9, 0xF6, 0xF5, 0xF8, 0xFC, 0x01, 0x04, 0x07, 
-    0x09, 0x09, 0x08, 0x09, 0x09, 0x0B, 0x0B, 0x0C, 0x0B, 0x0C, 0x0C, 0x0D, 
-    0x0E, 0x0D, 0x0B, 0x0C, 0x0D, 0x0D, 0x0B, 0x0A, 0x0A, 0x0D, 0x12, 0x16, 
-    0x16, 0x12, 0x0C, 0x0A, 0x0B, 0x0D, 0x10, 0x13, 0x16, 0x18, 0x19, 0x1A, 
-    0x18, 0x15, 0x12, 0x12, 0x11, 0x13, 0x16, 0x18, 0x18, 0x17, 0x14, 0x11, 
-    0x0E, 0x0E, 0x10, 0x11, 0x10, 0x0E, 0x0D, 0x0E, 0x10, 0x11, 0x0F, 0x0A, 
-    0x04, 0xFF, 0xFB, 0xF9, 0xFA, 0xFD, 0xFE, 0xFC, 0xF9, 0xF8, 0xF8, 0xFA, 
-    0xFB, 0xFC, 0xFD, 0xFF, 0x01, 0x04, 0x06, 0x05, 0x06, 0x07, 0x08, 0x07, 
-    0x08, 0x07, 0x07, 0x08, 0x07, 0x08, 0x0A, 0x0E, 0x10, 0x0E, 0x09, 0x04, 
-    0x02, 0x00, 0xFE, 0xFB, 0xFA, 0xFA, 0xF9, 0xFA, 0xFA, 0xFC, 0xFE, 0xFE, 
-    0xFC, 0xF9, 0xF7, 0xF6, 0xF8, 0xF8, 0xF6, 0xF4, 0xF4, 0xF3, 0xF3, 0xF2, 
-    0xEE, 0xEA, 0xE8, 0xEA, 0xEE, 0xF3, 0xF9, 0xFC, 0xFC, 0xFA, 0xF7, 0xF5, 
-    0xF6, 0xF9, 0xFA, 0xFC, 0xFD, 0xFC, 0xFA, 0xF8, 0xF6, 0xF5, 0xF6, 0xF7, 
-    0xF6, 0xF7, 0xF6, 0xF7, 0xF9, 0xF8, 0xF6, 0xF4, 0xF4, 0xF5, 0xF5, 0xF3, 
-    0xF1, 0xF0, 0xF0, 0xF4, 0xF6, 0xF7, 0xF4, 0xF0, 0xEF, 0xF2, 0xF6, 0xF7, 
-    0xF9, 0xFB, 0xFE, 0xFE, 0xFE, 0xFC, 0xFA, 0xF9, 0xF8, 0xF8, 0xF9, 0xFA, 
-    0xFB, 0xFC, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF7, 0xF0, 0xEC, 0xE9, 
-    0xE7, 0xEC, 0xF1, 0xF6, 0xF6, 0xF6, 0xF3, 0xF2, 0xF4, 0xF4, 0xF6, 0xF7, 
-    0xF9, 0xFA, 0xFB, 0xFD, 0x00, 0x00, 0xFD, 0xFA, 0xFA, 0xFF, 0x01, 0x04, 
-    0x01, 0xFF, 0xFE, 0xFD, 0x04, 0x0D, 0x1B, 0x23, 0x21, 0x22, 0x1C, 0x1C, 
-    0x1C, 0x19, 0x14, 0x10, 0x0C, 0x0E, 0x13, 0x16, 0x19, 0x18, 0x19, 0x16, 
-    0x13, 0x12, 0x10, 0x14, 0x13, 0x14, 0x15, 0x0F, 0x10, 0x13, 0x16, 0x1C, 
-    0x1C, 0x17, 0x12, 0x07, 0x09, 0x06, 0x0F, 0x15, 0x17, 0x1D, 0x1B, 0x1E, 
-    0x1D, 0x1B, 0x14, 0x0F, 0x17, 0x1B, 0x21, 0x2A, 0x25, 0x30, 0x2E, 0x2E, 
-    0x2E, 0x29, 0x27, 0x26, 0x26, 0x2C, 0x2B, 0x28, 0x28, 0x20, 0x24, 0x2A, 
-    0x2C, 0x27, 0x29, 0x1E, 0x18, 0x10, 0x14, 0x13, 0x18, 0x1B, 0x1C, 0x16, 
-    0x11, 0x10, 0x09, 0x0C, 0x06, 0x0D, 0x0A, 0x16, 0x18, 0x1A, 0x20, 0x24, 
-    0x28, 0x20, 0x1E, 0x1B, 0x1F, 0x26, 0x2B, 0x27, 0x22, 0x24, 0x23, 0x25, 
-    0x2A, 0x25, 0x1F, 0x17, 0x0C, 0x0D, 0x14, 0x16, 0x25, 0x21, 0x1B, 0x1A, 
-    0x10, 0x15, 0x0F, 0x0B, 0x0A, 0x0D, 0x14, 0x13, 0x14, 0x10, 0x18, 0x16, 
-    0x18, 0x17, 0x0E, 0x11, 0x0F, 0x15, 0x14, 0x15, 0x11, 0x0D, 0x0E, 0x14, 
-    0x13, 0x15, 0x14, 0x0B, 0x06, 0x03, 0x0B, 0x11, 0x16, 0x18, 0x21, 0x21, 
-    0x26, 0x23, 0x1E, 0x18, 0x17, 0x1A, 0x18, 0x1F, 0x1D, 0x17, 0x16, 0x16, 
-    0x0C, 0x09, 0xFA, 0xF3, 0xEF, 0xEB, 0xF0, 0xEB, 0xEB, 0xE7, 0xE6, 0xED, 
-    0xF2, 0xF7, 0xFA, 0xF9, 0xF7, 0xEF, 0xF0, 0xEF, 0xF5, 0xF9, 0xFB, 0xFD, 
-    0xF9, 0xF9, 0xF2, 0xF8, 0xF0, 0xF4, 0xF3, 0xF2, 0xF6, 0xF6, 0xFB, 0xFB, 
-    0xFB, 0xF5, 0xF2, 0xEC, 0xEB, 0xEF, 0xF2, 0xEC, 0xEC, 0xE7, 0xE1, 0xE9, 
-    0xEB, 0xF0, 0xF2, 0xEC, 0xE0, 0xD3, 0xCB, 0xD0, 0xDC, 0xE9, 0xEF, 0xEB, 
-    0xE8, 0xE6, 0xE3, 0xE2, 0xE0, 0xDC, 0xDE, 0xDD, 0xE1, 0xE7, 0xEA, 0xF0, 
-    0xEA, 0xE8, 0xE2, 0xE4, 0xE5, 0xEC, 0xF5, 0xF7, 0xF8, 0xF1, 0xF3, 0xEE, 
-    0xF3, 0xF9, 0xF6, 0xF0, 0xE3, 0xD6, 0xCF, 0xD3, 0xD8, 0xE5, 0xEC, 0xF0, 
-    0xEC, 0xE9, 0xE4, 0xDE, 0xDE, 0xD6, 0xDA, 0xD7, 0xDE, 0xDD, 0xE7, 0xEC, 
-    0xEA, 0xF2, 0xE9, 0xE8, 0xE1, 0xE6, 0xE7, 0xEB, 0xEB, 0xEB, 0xEC, 0xEA, 
-    0xE7, 0xEA, 0xE9, 0xDF, 0xDE, 0xD3, 0xD4, 0xCB, 0xCD, 0xD8, 0xE0, 0xEA, 
-    0xEB, 0xE6, 0xE2, 0xE1, 0xDD, 0xDF, 0xDC, 0xE3, 0xE0, 0xE1, 0xE2, 0xE0, 
-    0xE3, 0xE4, 0xE2, 0xE1, 0xE3, 0xE0, 0xE8, 0xEC, 0xEE, 0xEE, 0xEF, 0xED, 
-    0xE7, 0xEA, 0xEF, 0xF2, 0xF2, 0xED, 0xE3, 0xDD, 0xDB, 0xDE, 0xEA, 0xF1, 
-    0xF8, 0xFD, 0xFB, 0xFE, 0xFC, 0xFA, 0xF6, 0xF6, 0xF7, 0xF6, 0xFB, 0xF8, 
-    0xF8, 0xFB, 0xF6, 0xF4, 0xF4, 0xF1, 0xF9, 0xFD, 0x01, 0xFE, 0xF7, 0xF4, 
-    0xEC, 0xF4, 0xFA, 0xFD, 0xFF, 0xFC, 0xF2, 0xED, 0xEE, 0xEB, 0xF6, 0xFB, 
-    0xFF, 0x01, 0xFC, 0xFC, 0xFA, 0xF4, 0xF3, 0xEE, 0xED, 0xEC, 0xE9, 0xEA, 
-    0xE9, 0xEC, 0xED, 0xF3, 0xEC, 0xF2, 0xF1, 0xF6, 0xFB, 0xF0, 0xF0, 0xEE, 
-    0xEC, 0xF2, 0xFC, 0x03, 0x0A, 0xFF, 0xFC, 0xEA, 0xE6, 0xE8, 0xEA, 0xF9, 
-    0xFC, 0x03, 0x00, 0x00, 0xFA, 0xF8, 0xF6, 0xF4, 0xF4, 0xF3, 0xF1, 0xF5, 
-    0xF1, 0xF5, 0xF8, 0xF7, 0xFA, 0xF5, 0xF4, 0xF9, 0xFB, 0x00, 0x04, 0x01, 
-    0xFE, 0xFC, 0x04, 0x08, 0x0B, 0x0A, 0x04, 0xF6, 0xF1, 0xEB, 0xEC, 0xF4, 
-    0xFB, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFB, 0xFF, 0xFA, 0xFB, 
-    0xFA, 0xFB, 0x02, 0x01, 0xFF, 0x00, 0xFA, 0xF9, 0xFB, 0xFC, 0xF7, 0xF8, 
-    0xF8, 0xF3, 0xFF, 0x02, 0x0B, 0x07, 0x02, 0xF8, 0xEB, 0xE6, 0xE3, 0xEB, 
-    0xF1, 0xFF, 0xFC, 0xFB, 0xFC, 0xF7, 0xFA, 0xF6, 0xF6, 0xF4, 0xF8, 0xFB, 
-    0x02, 0x03, 0x03, 0x06, 0x03, 0x07, 0x0B, 0x0D, 0x15, 0x16, 0x11, 0x12, 
-    0x0F, 0x13, 0x14, 0x1E, 0x24, 0x2A, 0x25, 0x19, 0x0A, 0xFD, 0xFD, 0xFC, 
-    0x08, 0x0E, 0x13, 0x18, 0x1A, 0x20, 0x25, 0x26, 0x22, 0x21, 0x1B, 0x18, 
-    0x18, 0x16, 0x18, 0x15, 0x1B, 0x19, 0x1C, 0x1F, 0x1D, 0x22, 0x1F, 0x1C, 
-    0x1F, 0x1E, 0x22, 0x2D, 0x33, 0x3B, 0x35, 0x2E, 0x21, 0x1A, 0x16, 0x17, 
-    0x1F, 0x26, 0x2C, 0x29, 0x23, 0x20, 0x20, 0x1D, 0x21, 0x18, 0x17, 0x11, 
-    0x0F, 0x0E, 0x0C, 0x10, 0x11, 0x14, 0x11, 0x14, 0x12, 0x1A, 0x19, 0x13, 
-    0x0F, 0x09, 0x0A, 0x0F, 0x18, 0x19, 0x1D, 0x17, 0x0E, 0x06, 0x00, 0xFF, 
-    0x00, 0x09, 0x13, 0x17, 0x16, 0x18, 0x16, 0x1A, 0x19, 0x14, 0x10, 0x0C, 
-    0x0F, 0x11, 0x15, 0x1A, 0x1C, 0x1F, 0x1F, 0x20, 0x23, 0x26, 0x2A, 0x29, 
-    0x27, 0x25, 0x27, 0x2A, 0x34, 0x38, 0x36, 0x30, 0x26, 0x19, 0x11, 0x0D, 
-    0x0C, 0x10, 0x10, 0x13, 0x15, 0x17, 0x16, 0x14, 0x12, 0x0D, 0x0C, 0x0B, 
-    0x0C, 0x0E, 0x0D, 0x13, 0x15, 0x1B, 0x1E, 0x21, 0x25, 0x29, 0x2C, 0x2B, 
-    0x27, 0x21, 0x24, 0x24, 0x2F, 0x39, 0x37, 0x32, 0x26, 0x14, 0x08, 0xFD, 
-    0xF6, 0xF4, 0xF5, 0xFA, 0xF9, 0xF9, 0xF8, 0xF1, 0xEC, 0xE7, 0xE1, 0xDB, 
-    0xD9, 0xD7, 0xD9, 0xDE, 0xE1, 0xEA, 0xED, 0xEE, 0xF2, 0xF1, 0xF4, 0xF4, 
-    0xED, 0xEC, 0xEB, 0xEA, 0xF2, 0xFB, 0x01, 0x06, 0x02, 0xF8, 0xF0, 0xE7, 
-    0xE5, 0xE6, 0xEA, 0xEE, 0xEE, 0xF2, 0xF5, 0xF5, 0xFA, 0xF9, 0xF8, 0xF6, 
-    0xEE, 0xED, 0xEB, 0xED, 0xF3, 0xF9, 0xFB, 0xFD, 0xFE, 0xF9, 0xF8, 0xF4, 
-    0xF0, 0xEC, 0xEB, 0xEB, 0xEE, 0xF4, 0xFA, 0x00, 0xFC, 0xF5, 0xE8, 0xE2, 
-    0xE1, 0xDF, 0xE8, 0xEC, 0xF2, 0xF6, 0xF8, 0xFA, 0xF6, 0xF4, 0xEF, 0xE8, 
-    0xE3, 0xDD, 0xDB, 0xDF, 0xE1, 0xE7, 0xEA, 0xEA, 0xEC, 0xE9, 0xE7, 0xE3, 
-    0xDF, 0xDB, 0xD8, 0xD5, 0xD5, 0xD5, 0xDE, 0xE2, 0xE3, 0xE0, 0xD5, 0xD2, 
-    0xCD, 0xC9, 0xCB, 0xD1, 0xD3, 0xDB, 0xDF, 0xE0, 0xE1, 0xDF, 0xDD, 0xD8, 
-    0xD9, 0xD4, 0xD3, 0xD9, 0xDE, 0xE3, 0xEA, 0xED, 0xEC, 0xEA, 0xE7, 0xE3, 
-    0xE2, 0xE0, 0xE2, 0xE7, 0xE9, 0xEF, 0xF8, 0xFF, 0xFF, 0xFB, 0xED, 0xE1, 
-    0xDC, 0xD8, 0xD9, 0xDE, 0xE6, 0xEC, 0xF2, 0xF7, 0xF8, 0xF7, 0xF6, 0xF8, 
-    0xF4, 0xF1, 0xEE, 0xEA, 0xED, 0xEF, 0xF3, 0xF8, 0xF5, 0xF5, 0xF9, 0xFA, 
-    0xFB, 0xFB, 0xF7, 0xF5, 0xF6, 0xFC, 0x04, 0x0B, 0x12, 0x0E, 0x02, 0xF8, 
-    0xEB, 0xE6, 0xE7, 0xE7, 0xED, 0xEC, 0xF0, 0xF4, 0xF6, 0xF9, 0xF9, 0xF4, 
-    0xEF, 0xEA, 0xE5, 0xE3, 0xE2, 0xE6, 0xEC, 0xF0, 0xEE, 0xEC, 0xE9, 0xE7, 
-    0xE8, 0xE8, 0xE2, 0xE0, 0xDF, 0xE3, 0xEC, 0xF1, 0xF7, 0xF5, 0xF0, 0xE4, 
-    0xDC, 0xDA, 0xDB, 0xE0, 0xE8, 0xEA, 0xED, 0xF2, 0xFA, 0x03, 0x06, 0x09, 
-    0x09, 0x07, 0x07, 0x02, 0x01, 0x04, 0x08, 0x0F, 0x11, 0x13, 0x0E, 0x0D, 
-    0x0A, 0x06, 0x02, 0xFA, 0xF7, 0xF6, 0xFB, 0xFE, 0x06, 0x08, 0x04, 0xFA, 
-    0xEC, 0xE4, 0xDE, 0xE3, 0xE9, 0xED, 0xF5, 0xFB, 0x04, 0x0A, 0x0C, 0x0A, 
-    0x05, 0x01, 0xFB, 0xF5, 0xF7, 0xF9, 0xFD, 0x02, 0x06, 0x06, 0x03, 0x00, 
-    0xFD, 0xFD, 0xFA, 0xF8, 0xF5, 0xF3, 0xF3, 0xF6, 0xFF, 0x02, 0x00, 0xF6, 
-    0xE7, 0xDE, 0xDA, 0xDC, 0xE1, 0xE6, 0xEA, 0xEC, 0xF1, 0xF6, 0xFD, 0xFF, 
-    0xFC, 0xF4, 0xED, 0xE8, 0xE6, 0xEC, 0xEF, 0xF5, 0xFB, 0xFD, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xFC, 0xF9, 0xF9, 0xFC, 0x08, 0x16, 0x20, 0x21, 0x18, 
-    0x09, 0xFF, 0xF9, 0xFB, 0x04, 0x0B, 0x14, 0x16, 0x1A, 0x23, 0x2C, 0x30, 
-    0x2B, 0x23, 0x1D, 0x16, 0x16, 0x17, 0x18, 0x1B, 0x1A, 0x1A, 0x14, 0x14, 
-    0x13, 0x17, 0x15, 0x14, 0x14, 0x13, 0x1A, 0x1E, 0x29, 0x32, 0x36, 0x30, 
-    0x27, 0x1B, 0x15, 0x12, 0x16, 0x18, 0x18, 0x18, 0x1C, 0x23, 0x26, 0x2C, 
-    0x29, 0x22, 0x1C, 0x16, 0x0E, 0x0E, 0x0E, 0x11, 0x13, 0x15, 0x16, 0x15, 
-    0x13, 0x0F, 0x0C, 0x09, 0x06, 0x06, 0x05, 0x07, 0x0F, 0x15, 0x1D, 0x1A, 
-    0x17, 0x0B, 0x05, 0x04, 0x03, 0x0A, 0x0E, 0x10, 0x16, 0x1B, 0x1F, 0x24, 
-    0x22, 0x20, 0x1D, 0x1A, 0x16, 0x17, 0x16, 0x17, 0x1B, 0x20, 0x22, 0x24, 
-    0x26, 0x28, 0x2A, 0x2A, 0x28, 0x21, 0x20, 0x1D, 0x1F, 0x23, 0x2D, 0x31, 
-    0x2E, 0x23, 0x17, 0x12, 0x0F, 0x13, 0x12, 0x14, 0x17, 0x1F, 0x26, 0x2D, 
-    0x31, 0x2E, 0x2B, 0x22, 0x1C, 0x19, 0x16, 0x18, 0x1C, 0x1F, 0x23, 0x23, 
-    0x21, 0x1F, 0x1A, 0x15, 0x12, 0x0B, 0x05, 0x02, 0x03, 0x0A, 0x11, 0x17, 
-    0x16, 0x0B, 0x02, 0xFC, 0xFA, 0xFF, 0x03, 0x04, 0x04, 0x07, 0x0E, 0x16, 
-    0x1B, 0x1C, 0x18, 0x14, 0x0D, 0x06, 0x03, 0x01, 0x02, 0x08, 0x0C, 0x0E, 
-    0x10, 0x0D, 0x07, 0x01, 0xFD, 0xF4, 0xF0, 0xEE, 0xEC, 0xF2, 0xF9, 0x02, 
-    0x05, 0x00, 0xF1, 0xE4, 0xDB, 0xDC, 0xE0, 0xE4, 0xE8, 0xEE, 0xF7, 0xFF, 
-    0x08, 0x08, 0x05, 0x00, 0xFA, 0xF5, 0xF1, 0xF6, 0xFB, 0x01, 0x06, 0x07, 
-    0x02, 0x01, 0xFA, 0xF7, 0xF3, 0xF1, 0xF3, 0xF1, 0xF3, 0xF1, 0xFB, 0x03, 
-    0x06, 0x01, 0xF8, 0xEF, 0xE9, 0xEA, 0xEB, 0xF1, 0xF0, 0xF0, 0xF5, 0xF9, 
-    0xFD, 0xFF, 0xFB, 0xF4, 0xEB, 0xE1, 0xDB, 0xD9, 0xDB, 0xE1, 0xE6, 0xEA, 
-    0xEE, 0xEF, 0xEB, 0xE8, 0xE4, 0xE0, 0xDC, 0xD9, 0xD8, 0xDC, 0xE5, 0xEF, 
-    0xF7, 0xF5, 0xEA, 0xDE, 0xD5, 0xD3, 0xD7, 0xDF, 0xE4, 0xE6, 0xE8, 0xEA, 
-    0xEF, 0xF1, 0xED, 0xE5, 0xDE, 0xD6, 0xD5, 0xD7, 0xDA, 0xE2, 0xE9, 0xEE, 
-    0xF1, 0xF2, 0xF4, 0xF6, 0xF7, 0xF6, 0xF2, 0xEF, 0xED, 0xED, 0xEF, 0xF7, 
-    0xFF, 0x02, 0xFD, 0xEF, 0xE5, 0xDD, 0xDC, 0xDE, 0xDE, 0xDE, 0xDD, 0xE3, 
-    0xEA, 0xF2, 0xF5, 0xEF, 0xEA, 0xE1, 0xD5, 0xD2, 0xD2, 0xD8, 0xE5, 0xEE, 
-    0xF4, 0xF7, 0xF5, 0xF4, 0xF1, 0xEF, 0xEB, 0xE8, 0xEA, 0xEC, 0xF5, 0x00, 
-    0x0B, 0x0F, 0x0B, 0xFC, 0xEA, 0xE1, 0xDF, 0xE2, 0xE5, 0xE8, 0xE9, 0xEB, 
-    0xF5, 0xF8, 0xFD, 0xF8, 0xEF, 0xE8, 0xDF, 0xDE, 0xE0, 0xE5, 0xEC, 0xF7, 
-    0xFD, 0x01, 0xFF, 0xFD, 0xFE, 0xFC, 0xF9, 0xF4, 0xF2, 0xF2, 0xF5, 0xFC, 
-    0x08, 0x12, 0x14, 0x0C, 0xFE, 0xEE, 0xE5, 0xE5, 0xE8, 0xEC, 0xEF, 0xF5, 
-    0xFE, 0x07, 0x0C, 0x08, 0xFC, 0xEE, 0xE1, 0xD8, 0xDA, 0xE1, 0xEC, 0xF8, 
-    0xFF, 0x02, 0xFD, 0xF9, 0xF2, 0xEF, 0xEE, 0xE9, 0xEB, 0xEF, 0xF6, 0x02, 
-    0x0B, 0x17, 0x1A, 0x14, 0x06, 0xF9, 0xF3, 0xF2, 0xF8, 0xFE, 0x03, 0x08, 
-    0x0D, 0x0E, 0x10, 0x0A, 0xFF, 0xF2, 0xE7, 0xDF, 0xDD, 0xE1, 0xE4, 0xE9, 
-    0xED, 0xF0, 0xEF, 0xEA, 0xE6, 0xE4, 0xE2, 0xE1, 0xDD, 0xDC, 0xDF, 0xE7, 
-    0xF2, 0xFF, 0x06, 0x04, 0xFB, 0xEC, 0xE1, 0xDF, 0xE5, 0xEE, 0xFA, 0x04, 
-    0x0C, 0x15, 0x1A, 0x19, 0x12, 0x04, 0xF8, 0xF1, 0xF1, 0xF5, 0xFD, 0x04, 
-    0x0A, 0x0F, 0x0D, 0x08, 0x01, 0xFC, 0xF7, 0xF5, 0xF5, 0xF6, 0xFA, 0x01, 
-    0x06, 0x0C, 0x0F, 0x0C, 0x04, 0xF6, 0xEE, 0xE9, 0xEA, 0xF2, 0xF6, 0xFC, 
-    0x00, 0x03, 0x06, 0x08, 0x06, 0x00, 0xFC, 0xF2, 0xEF, 0xEF, 0xF3, 0xFD, 
-    0x05, 0x0C, 0x12, 0x13, 0x0F, 0x0C, 0x08, 0x05, 0x04, 0x03, 0x06, 0x0D, 
-    0x14, 0x21, 0x29, 0x2B, 0x24, 0x15, 0x08, 0xFD, 0xF9, 0xFB, 0xFE, 0x04, 
-    0x0F, 0x15, 0x1C, 0x1F, 0x1D, 0x17, 0x0F, 0x09, 0x08, 0x09, 0x12, 0x1B, 
-    0x23, 0x2C, 0x2F, 0x2E, 0x27, 0x21, 0x1C, 0x1A, 0x1A, 0x18, 0x19, 0x1B, 
-    0x1E, 0x23, 0x2A, 0x31, 0x31, 0x2A, 0x22, 0x17, 0x13, 0x10, 0x10, 0x18, 
-    0x1E, 0x26, 0x2B, 0x2F, 0x2F, 0x29, 0x1F, 0x12, 0x08, 0x04, 0x07, 0x10, 
-    0x1C, 0x25, 0x2E, 0x30, 0x2B, 0x23, 0x19, 0x10, 0x0B, 0x05, 0x03, 0x04, 
-    0x0B, 0x15, 0x1D, 0x23, 0x23, 0x1C, 0x0E, 0x05, 0xFC, 0xFD, 0x05, 0x0D, 
-    0x1A, 0x23, 0x29, 0x2A, 0x26, 0x1D, 0x14, 0x0D, 0x06, 0x05, 0x08, 0x0E, 
-    0x18, 0x21, 0x28, 0x28, 0x23, 0x1C, 0x17, 0x11, 0x0D, 0x0A, 0x05, 0x08, 
-    0x0E, 0x17, 0x21, 0x2A, 0x2D, 0x29, 0x1C, 0x0D, 0x01, 0xFA, 0xFB, 0x02, 
-    0x0E, 0x1B, 0x26, 0x2C, 0x2D, 0x27, 0x1E, 0x15, 0x0A, 0x04, 0x06, 0x0E, 
-    0x1B, 0x29, 0x34, 0x3A, 0x37, 0x2F, 0x24, 0x1A, 0x16, 0x14, 0x16, 0x1A, 
-    0x21, 0x27, 0x2E, 0x33, 0x34, 0x2D, 0x1D, 0x0E, 0x00, 0xFA, 0xF8, 0xF9, 
-    0xFE, 0x04, 0x0A, 0x0B, 0x0A, 0x05, 0xFE, 0xF2, 0xE7, 0xE0, 0xDE, 0xE1, 
-    0xE9, 0xF1, 0xFB, 0x02, 0x04, 0xFE, 0xF4, 0xEC, 0xE4, 0xDF, 0xD8, 0xD8, 
-    0xDE, 0xE4, 0xEF, 0xF8, 0xFF, 0x04, 0xFF, 0xF2, 0xE3, 0xD7, 0xD3, 0xD5, 
-    0xDE, 0xE9, 0xF2, 0xF8, 0xFC, 0xFB, 0xF4, 0xEA, 0xDE, 0xD5, 0xD0, 0xD4, 
-    0xDF, 0xEA, 0xF6, 0xF9, 0xF7, 0xF0, 0xE8, 0xE4, 0xE3, 0xE5, 0xE7, 0xE9, 
-    0xEC, 0xF3, 0xFB, 0x08, 0x11, 0x15, 0x11, 0x07, 0xFA, 0xF3, 0xF0, 0xF1, 
-    0xF4, 0xF5, 0xFE, 0x06, 0x0C, 0x10, 0x0C, 0x00, 0xF3, 0xE8, 0xE1, 0xDE, 
-    0xE2, 0xE8, 0xF1, 0xF9, 0xFB, 0xFC, 0xF8, 0xEE, 0xE5, 0xDC, 0xD6, 0xD3, 
-    0xD4, 0xD8, 0xDD, 0xE6, 0xEE, 0xF5, 0xF4, 0xEC, 0xE0, 0xD5, 0xD2, 0xD5, 
-    0xDD, 0xE8, 0xF3, 0xFD, 0x02, 0x00, 0xF9, 0xEF, 0xE4, 0xD9, 0xD1, 0xCC, 
-    0xCD, 0xD4, 0xDE, 0xE8, 0xEC, 0xEC, 0xE5, 0xDD, 0xD6, 0xD1, 0xCD, 0xCA, 
-    0xCD, 0xD1, 0xD9, 0xE3, 0xEB, 0xF2, 0xF4, 0xEF, 0xE3, 0xD8, 0xCE, 0xC9, 
-    0xC9, 0xCE, 0xD8, 0xE5, 0xF5, 0xFE, 0x03, 0x01, 0xF8, 0xED, 0xE4, 0xDF, 
-    0xE2, 0xEA, 0xF5, 0x03, 0x0E, 0x13, 0x11, 0x0A, 0x00, 0xF7, 0xF1, 0xEC, 
-    0xEC, 0xF2, 0xFB, 0x06, 0x0F, 0x14, 0x15, 0x12, 0x07, 0xFA, 0xED, 0xE5, 
-    0xE4, 0xE8, 0xF2, 0xFD, 0x07, 0x10, 0x15, 0x11, 0x05, 0xF5, 0xE6, 0xDF, 
-    0xDF, 0xE4, 0xED, 0xF7, 0x00, 0x07, 0x0A, 0x08, 0x00, 0xF6, 0xEC, 0xE6, 
-    0xE1, 0xDD, 0xDE, 0xE4, 0xED, 0xF8, 0xFE, 0xFF, 0xF8, 0xEB, 0xE1, 0xD7, 
-    0xD3, 0xD5, 0xDD, 0xE9, 0xF6, 0xFF, 0x04, 0x03, 0xFC, 0xF2, 0xEA, 0xE4, 
-    0xE1, 0xE5, 0xEC, 0xF7, 0x01, 0x09, 0x0B, 0x09, 0x02, 0xFB, 0xF5, 0xF0, 
-    0xEE, 0xEE, 0xF0, 0xF8, 0x02, 0x0D, 0x12, 0x12, 0x0C, 0x01, 0xF6, 0xF0, 
-    0xED, 0xEF, 0xF5, 0xFC, 0x04, 0x09, 0x0C, 0x0B, 0x07, 0x03, 0xFD, 0xF9, 
-    0xF5, 0xF4, 0xF4, 0xF8, 0xFE, 0x03, 0x08, 0x0A, 0x07, 0x03, 0xFE, 0xF7, 
-    0xF1, 0xEB, 0xEA, 0xEC, 0xF4, 0x00, 0x0A, 0x12, 0x15, 0x10, 0x04, 0xF9, 
-    0xED, 0xE7, 0xE8, 0xEE, 0xF9, 0x03, 0x09, 0x0A, 0x05, 0xF9, 0xEA, 0xDD, 
-    0xD6, 0xD6, 0xDD, 0xE7, 0xF3, 0xFD, 0x01, 0x02, 0xFE, 0xF8, 0xF2, 0xEF, 
-    0xED, 0xEB, 0xED, 0xF0, 0xF6, 0xFF, 0x07, 0x0E, 0x10, 0x0B, 0x03, 0xFA, 
-    0xF1, 0xEB, 0xE9, 0xED, 0xF8, 0x04, 0x0F, 0x17, 0x17, 0x14, 0x0C, 0x04, 
-    0xFC, 0xF7, 0xF8, 0xFE, 0x0A, 0x15, 0x1D, 0x20, 0x22, 0x20, 0x1B, 0x16, 
-    0x10, 0x0D, 0x0D, 0x10, 0x19, 0x26, 0x37, 0x43, 0x47, 0x42, 0x37, 0x29, 
-    0x1D, 0x13, 0x0E, 0x12, 0x1C, 0x28, 0x34, 0x3A, 0x38, 0x31, 0x24, 0x16, 
-    0x0C, 0x08, 0x0B, 0x13, 0x1F, 0x28, 0x2F, 0x2F, 0x2C, 0x26, 0x21, 0x1D, 
-    0x19, 0x15, 0x12, 0x10, 0x11, 0x15, 0x1B, 0x21, 0x23, 0x21, 0x19, 0x0E, 
-    0x04, 0xFD, 0xF9, 0xFB, 0x01, 0x0B, 0x14, 0x1A, 0x19, 0x14, 0x0D, 0x06, 
-    0x00, 0xFA, 0xF6, 0xF6, 0xFC, 0x07, 0x12, 0x1B, 0x1F, 0x1F, 0x1A, 0x12, 
-    0x0A, 0x03, 0xFF, 0x00, 0x04, 0x0B, 0x16, 0x21, 0x2A, 0x2C, 0x27, 0x1D, 
-    0x13, 0x0D, 0x09, 0x0A, 0x11, 0x1E, 0x2C, 0x35, 0x36, 0x30, 0x29, 0x21, 
-    0x1A, 0x13, 0x0F, 0x0E, 0x12, 0x18, 0x1F, 0x27, 0x29, 0x28, 0x23, 0x1C, 
-    0x18, 0x13, 0x10, 0x0E, 0x0E, 0x11, 0x18, 0x21, 0x2A, 0x31, 0x31, 0x2A, 
-    0x21, 0x18, 0x11, 0x0D, 0x11, 0x1B, 0x27, 0x32, 0x38, 0x37, 0x2D, 0x1F, 
-    0x0F, 0x03, 0xFA, 0xF5, 0xF6, 0xFE, 0x0A, 0x14, 0x19, 0x17, 0x0F, 0x05, 
-    0xFB, 0xF2, 0xEC, 0xE9, 0xEC, 0xF0, 0xF6, 0xFC, 0x02, 0x06, 0x06, 0xFD, 
-    0xF1, 0xE5, 0xDE, 0xDC, 0xDE, 0xE5, 0xF0, 0xFE, 0x09, 0x0E, 0x0C, 0x04, 
-    0xFA, 0xF2, 0xEB, 0xE7, 0xE8, 0xEE, 0xF6, 0x03, 0x09, 0x0B, 0x07, 0x00, 
-    0xF9, 0xF2, 0xED, 0xE7, 0xE1, 0xE1, 0xE6, 0xEF, 0xFE, 0x08, 0x0E, 0x0A, 
-    0xFD, 0xEA, 0xDC, 0xD2, 0xCF, 0xD5, 0xE3, 0xEF, 0xFD, 0x03, 0xFF, 0xF8, 
-    0xE7, 0xDD, 0xD7, 0xD9, 0xDF, 0xEA, 0xF9, 0x08, 0x16, 0x19, 0x15, 0x10, 
-    0x06, 0x02, 0xFD, 0xF8, 0xFA, 0xFD, 0x02, 0x02, 0x04, 0x00, 0xFC, 0xF8, 
-    0xED, 0xE1, 0xDC, 0xD6, 0xD8, 0xD9, 0xE1, 0xEC, 0xEC, 0xF6, 0xF4, 0xEF, 
-    0xE8, 0xE2, 0xE2, 0xE6, 0xE8, 0xEC, 0xF2, 0xF9, 0x01, 0x05, 0x09, 0x05, 
-    0xFF, 0xFD, 0xF8, 0xF3, 0xEE, 0xE8, 0xEA, 0xE8, 0xEE, 0xF2, 0xF7, 0xF9, 
-    0xF8, 0xF4, 0xEC, 0xEA, 0xE7, 0xEA, 0xED, 0xF3, 0xF9, 0x03, 0x07, 0x06, 
-    0x01, 0xF8, 0xEE, 0xED, 0xEB, 0xEA, 0xEE, 0xF0, 0xF9, 0xFC, 0xFE, 0xF8, 
-    0xF4, 0xF2, 0xEE, 0xED, 0xE8, 0xE3, 0xE2, 0xE9, 0xF2, 0xF9, 0x00, 0x05, 
-    0x05, 0xFD, 0xF8, 0xEE, 0xE9, 0xE9, 0xE9, 0xF2, 0xFC, 0x06, 0x0E, 0x12, 
-    0x0F, 0x05, 0xF9, 0xF1, 0xE8, 0xE5, 0xE1, 0xE4, 0xE9, 0xEA, 0xF1, 0xEF, 
-    0xEF, 0xEA, 0xEB, 0xE5, 0xE4, 0xE2, 0xE5, 0xF1, 0xFC, 0x08, 0x11, 0x19, 
-    0x16, 0x12, 0x02, 0xFA, 0xEF, 0xEA, 0xEC, 0xEC, 0xF6, 0xF9, 0xFB, 0xFB, 
-    0xF1, 0xE5, 0xD9, 0xD2, 0xD2, 0xD5, 0xDC, 0xE5, 0xED, 0xFA, 0x03, 0x07, 
-    0x06, 0xFF, 0xFB, 0xF4, 0xF0, 0xF1, 0xF3, 0xF8, 0xFE, 0x01, 0x08, 0x07, 
-    0x05, 0xFB, 0xEF, 0xE6, 0xDC, 0xDA, 0xD8, 0xE1, 0xE8, 0xF7, 0xFF, 0x01, 
-    0x01, 0xF5, 0xEC, 0xDD, 0xD5, 0xD2, 0xD4, 0xDD, 0xE4, 0xED, 0xF9, 0xFC, 
-    0xF9, 0xF4, 0xEC, 0xE5, 0xE2, 0xE4, 0xE5, 0xEB, 0xF0, 0xF2, 0xF4, 0xF4, 
-    0xF4, 0xEC, 0xE5, 0xE1, 0xDB, 0xDD, 0xE1, 0xE6, 0xEA, 0xEF, 0xF6, 0xF6, 
-    0xF5, 0xEC, 0xE1, 0xD9, 0xD0, 0xD2, 0xD6, 0xDD, 0xE4, 0xE7, 0xE8, 0xEC, 
-    0xED, 0xEB, 0xED, 0xEB, 0xEF, 0xF0, 0xEF, 0xE9, 0xE5, 0xE0, 0xDD, 0xE1, 
-    0xE2, 0xE4, 0xE0, 0xE0, 0xE2, 0xE4, 0xE4, 0xE9, 0xF3, 0xFA, 0x05, 0x11, 
-    0x13, 0x17, 0x15, 0x12, 0x14, 0x18, 0x20, 0x22, 0x26, 0x23, 0x20, 0x17, 
-    0x0C, 0x05, 0xF8, 0xF5, 0xF4, 0xF5, 0xF7, 0xF9, 0xFB, 0xFC, 0xFD, 0x00, 
-    0x08, 0x0F, 0x12, 0x16, 0x19, 0x20, 0x23, 0x26, 0x2E, 0x33, 0x36, 0x32, 
-    0x30, 0x2A, 0x23, 0x1E, 0x1A, 0x13, 0x10, 0x0B, 0x07, 0x07, 0x08, 0x0C, 
-    0x12, 0x15, 0x12, 0x15, 0x0E, 0x08, 0x06, 0x00, 0xFD, 0xFE, 0x02, 0x0A, 
-    0x15, 0x1F, 0x22, 0x25, 0x1A, 0x15, 0x11, 0x10, 0x15, 0x18, 0x21, 0x23, 
-    0x2C, 0x28, 0x29, 0x1D, 0x14, 0x0B, 0x00, 0x01, 0x00, 0x09, 0x12, 0x1A, 
-    0x1E, 0x1F, 0x19, 0x13, 0x06, 0x03, 0xFD, 0xFC, 0x00, 0x04, 0x0C, 0x14, 
-    0x1C, 0x24, 0x28, 0x24, 0x1F, 0x15, 0x0E, 0x05, 0x02, 0xFB, 0xFB, 0x01, 
-    0x06, 0x0B, 0x0A, 0x01, 0xF6, 0xEB, 0xE7, 0xE8, 0xF2, 0x02, 0x15, 0x27, 
-    0x33, 0x3C, 0x36, 0x2D, 0x1E, 0x15, 0x0C, 0x06, 0x04, 0x04, 0x0B, 0x0D, 
-    0x11, 0x10, 0x0B, 0xFE, 0xEF, 0xDF, 0xD4, 0xD3, 0xD3, 0xD8, 0xE5, 0xF1, 
-    0xFE, 0x04, 0x02, 0xF6, 0xEB, 0xE2, 0xE0, 0xE6, 0xEF, 0xFD, 0x06, 0x10, 
-    0x10, 0x11, 0x03, 0xFA, 0xEE, 0xE8, 0xE7, 0xE3, 0xEA, 0xE8, 0xEE, 0xF2, 
-    0xF3, 0xF9, 0xFB, 0xF9, 0xF7, 0xF0, 0xEF, 0xED, 0xEF, 0xF1, 0xF4, 0xF9, 
-    0xF8, 0xFA, 0xF4, 0xF2, 0xEC, 0xE7, 0xE5, 0xE4, 0xE8, 0xEA, 0xEB, 0xEA, 
-    0xF0, 0xF0, 0xED, 0xE7, 0xDF, 0xDB, 0xDE, 0xDF, 0xE1, 0xE5, 0xE6, 0xEB, 
-    0xF1, 0xF5, 0xF7, 0xF5, 0xF1, 0xEB, 0xE9, 0xEE, 0xF2, 0xF4, 0xEF, 0xEC, 
-    0xE4, 0xE4, 0xE5, 0xE7, 0xEB, 0xEB, 0xEE, 0xEE, 0xED, 0xEF, 0xEA, 0xE9, 
-    0xE5, 0xE4, 0xE5, 0xE1, 0xE0, 0xDB, 0xDC, 0xDB, 0xDA, 0xD9, 0xD9, 0xDD, 
-    0xE2, 0xEA, 0xF4, 0xF5, 0xFB, 0xFF, 0x02, 0x06, 0x07, 0x08, 0x06, 0x0D, 
-    0x13, 0x20, 0x2B, 0x31, 0x32, 0x2A, 0x1A, 0x08, 0xF8, 0xE9, 0xE4, 0xE6, 
-    0xEA, 0xFA, 0x07, 0x13, 0x19, 0x18, 0x17, 0x16, 0x15, 0x12, 0x14, 0x14, 
-    0x1A, 0x25, 0x2D, 0x38, 0x3B, 0x36, 0x2E, 0x1F, 0x14, 0x09, 0x03, 0x04, 
-    0x07, 0x12, 0x1C, 0x23, 0x25, 0x1F, 0x15, 0x07, 0x02, 0xFE, 0x01, 0x07, 
-    0x11, 0x1E, 0x29, 0x30, 0x32, 0x2E, 0x29, 0x26, 0x1C, 0x1C, 0x13, 0x11, 
-    0x15, 0x1B, 0x27, 0x29, 0x2E, 0x23, 0x18, 0x0D, 0x01, 0x01, 0x04, 0x0E, 
-    0x17, 0x20, 0x25, 0x26, 0x1E, 0x11, 0x00, 0xEF, 0xE6, 0xE0, 0xE4, 0xEB, 
-    0xF6, 0x03, 0x0A, 0x0C, 0x0E, 0x0A, 0x09, 0x07, 0x09, 0x08, 0x07, 0x0D, 
-    0x14, 0x1D, 0x1B, 0x1E, 0x13, 0x08, 0xFD, 0xF2, 0xF3, 0xF6, 0x02, 0x0C, 
-    0x15, 0x1D, 0x22, 0x28, 0x2C, 0x29, 0x24, 0x1C, 0x12, 0x12, 0x0F, 0x10, 
-    0x0F, 0x0F, 0x0D, 0x0A, 0x0A, 0x03, 0xFC, 0xF2, 0xEA, 0xE2, 0xE0, 0xDF, 
-    0xE3, 0xE7, 0xE8, 0xEC, 0xF1, 0xF6, 0xFD, 0x01, 0x04, 0x09, 0x0D, 0x0F, 
-    0x0C, 0x0B, 0x07, 0x0B, 0x0C, 0x0C, 0x0F, 0x07, 0x04, 0xFF, 0xFB, 0xF3, 
-    0xF0, 0xF2, 0xF2, 0xF6, 0xF7, 0xF4, 0xF2, 0xEE, 0xEC, 0xE9, 0xE3, 0xDF, 
-    0xD9, 0xD7, 0xD7, 0xDD, 0xE7, 0xF0, 0xF9, 0xF8, 0xF5, 0xF2, 0xEA, 0xE5, 
-    0xDB, 0xD5, 0xD6, 0xDC, 0xE5, 0xED, 0xF4, 0xF4, 0xED, 0xE2, 0xD9, 0xD6, 
-    0xD6, 0xDD, 0xE5, 0xED, 0xF6, 0xFF, 0x03, 0x02, 0xFE, 0xF0, 0xE6, 0xDA, 
-    0xD8, 0xD6, 0xDC, 0xE9, 0xF5, 0x02, 0x03, 0xFF, 0xF4, 0xE9, 0xDB, 0xD8, 
-    0xD7, 0xDA, 0xE1, 0xEB, 0xF4, 0xFB, 0xFD, 0xF4, 0xE9, 0xD9, 0xCE, 0xC8, 
-    0xC7, 0xD1, 0xDB, 0xEB, 0xF9, 0x04, 0x0E, 0x10, 0x0A, 0xFE, 0xF4, 0xEE, 
-    0xEB, 0xF1, 0xFD, 0x0B, 0x20, 0x2E, 0x33, 0x2D, 0x20, 0x13, 0x0A, 0x00, 
-    0x00, 0xFD, 0xFF, 0x0A, 0x0C, 0x12, 0x0E, 0x09, 0x00, 0xF4, 0xEE, 0xEA, 
-    0xEF, 0xF9, 0x07, 0x16, 0x24, 0x27, 0x27, 0x24, 0x16, 0x0C, 0x02, 0x02, 
-    0x01, 0x0B, 0x14, 0x1C, 0x27, 0x2D, 0x2D, 0x24, 0x1D, 0x0F, 0x09, 0x08, 
-    0x08, 0x10, 0x16, 0x1E, 0x27, 0x2A, 0x2D, 0x2A, 0x26, 0x1F, 0x15, 0x0F, 
-    0x0F, 0x0F, 0x16, 0x1D, 0x1F, 0x20, 0x18, 0x14, 0x0B, 0x09, 0x07, 0x0C, 
-    0x0C, 0x11, 0x12, 0x15, 0x1A, 0x1F, 0x23, 0x1E, 0x1B, 0x0F, 0x0A, 0x09, 
-    0x0A, 0x0E, 0x0E, 0x0F, 0x12, 0x12, 0x13, 0x0E, 0x08, 0x01, 0xFC, 0xFC, 
-    0xFC, 0x05, 0x0B, 0x14, 0x18, 0x1B, 0x1A, 0x14, 0x12, 0x0C, 0x09, 0x06, 
-    0xFF, 0xFE, 0xF5, 0xF5, 0xF6, 0xF9, 0x06, 0x09, 0x0F, 0x0D, 0x0D, 0x10, 
-    0x13, 0x13, 0x13, 0x0B, 0x07, 0x06, 0x02, 0x04, 0xFE, 0xF5, 0xF1, 0xE9, 
-    0xE6, 0xE2, 0xDC, 0xDE, 0xDD, 0xE3, 0xE6, 0xEF, 0xF3, 0xF8, 0xFB, 0xF6, 
-    0xF4, 0xF2, 0xF2, 0xF1, 0xF8, 0xFF, 0x09, 0x11, 0x14, 0x11, 0x09, 0x02, 
-    0xFE, 0xF7, 0xF5, 0xF3, 0xF0, 0xF5, 0xF7, 0xFB, 0xFC, 0xFB, 0xF7, 0xEF, 
-    0xE8, 0xE0, 0xDE, 0xDE, 0xE4, 0xED, 0xF5, 0xFE, 0x02, 0x05, 0xFF, 0xFC, 
-    0xF1, 0xE8, 0xE1, 0xDD, 0xE0, 0xE6, 0xF1, 0xF5, 0xF7, 0xF4, 0xEF, 0xE9, 
-    0xE5, 0xE3, 0xE3, 0xE4, 0xE6, 0xE9, 0xED, 0xF3, 0xF7, 0xF3, 0xE9, 0xE0, 
-    0xD1, 0xCD, 0xCA, 0xD1, 0xD8, 0xE4, 0xEF, 0xF2, 0xF7, 0xF2, 0xED, 0xE1, 
-    0xDC, 0xD3, 0xD0, 0xD7, 0xE0, 0xEC, 0xF8, 0x00, 0x01, 0xF8, 0xF1, 0xE6, 
-    0xE1, 0xE0, 0xDA, 0xE0, 0xDE, 0xE6, 0xEB, 0xF3, 0xF6, 0xF7, 0xF2, 0xEA, 
-    0xE8, 0xE5, 0xEC, 0xF3, 0xFE, 0x03, 0x0C, 0x0A, 0x08, 0x09, 0x05, 0x02, 
-    0xFF, 0xFF, 0x01, 0x0A, 0x0E, 0x17, 0x1F, 0x21, 0x20, 0x18, 0x12, 0x0A, 
-    0x01, 0xFF, 0xF8, 0xFF, 0x07, 0x0B, 0x11, 0x11, 0x15, 0x10, 0x10, 0x0B, 
-    0x07, 0x06, 0x09, 0x0D, 0x12, 0x1C, 0x1E, 0x22, 0x1E, 0x1D, 0x18, 0x1A, 
-    0x1B, 0x18, 0x1A, 0x15, 0x16, 0x16, 0x19, 0x1B, 0x1D, 0x1B, 0x15, 0x10, 
-    0x0C, 0x0A, 0x0E, 0x15, 0x17, 0x19, 0x13, 0x10, 0x0D, 0x0D, 0x11, 0x11, 
-    0x13, 0x0E, 0x0E, 0x0B, 0x0D, 0x0E, 0x12, 0x12, 0x12, 0x15, 0x14, 0x1C, 
-    0x1D, 0x1D, 0x1B, 0x14, 0x12, 0x12, 0x13, 0x19, 0x1A, 0x1C, 0x19, 0x0B, 
-    0x07, 0x01, 0x03, 0x04, 0x01, 0xFD, 0xF9, 0xFE, 0x05, 0x0D, 0x15, 0x15, 
-    0x16, 0x12, 0x0B, 0x04, 0x00, 0x01, 0x02, 0x08, 0x0A, 0x11, 0x12, 0x1B, 
-    0x20, 0x23, 0x21, 0x1D, 0x18, 0x14, 0x15, 0x14, 0x16, 0x14, 0x0E, 0x05, 
-    0x02, 0xF8, 0xF1, 0xEA, 0xE5, 0xDF, 0xE4, 0xE9, 0xF2, 0xFA, 0xFD, 0xFF, 
-    0xF7, 0xF3, 0xEB, 0xE3, 0xE3, 0xE5, 0xE8, 0xEF, 0xF9, 0x00, 0x02, 0x06, 
-    0x02, 0x02, 0xFA, 0xF8, 0xF3, 0xF0, 0xF0, 0xF1, 0xFB, 0xFE, 0x04, 0xFD, 
-    0xF4, 0xE8, 0xE1, 0xDC, 0xDE, 0xE3, 0xEC, 0xF3, 0xFB, 0xFF, 0x00, 0x00, 
-    0xF8, 0xF5, 0xED, 0xE9, 0xE5, 0xEB, 0xEE, 0xF5, 0xF9, 0xF9, 0xF8, 0xF4, 
-    0xF3, 0xEF, 0xE7, 0xE1, 0xDD, 0xD7, 0xDE, 0xE1, 0xED, 0xF5, 0xF6, 0xF3, 
-    0xE9, 0xDF, 0xDC, 0xDC, 0xE3, 0xEB, 0xF2, 0xF8, 0xFC, 0xFD, 0xFA, 0xF8, 
-    0xEE, 0xE8, 0xDE, 0xD9, 0xD8, 0xDB, 0xE3, 0xE8, 0xED, 0xEF, 0xF0, 0xF5, 
-    0xF5, 0xF5, 0xF0, 0xEC, 0xE8, 0xE8, 0xEA, 0xEB, 0xF0, 0xEF, 0xEE, 0xE8, 
-    0xE2, 0xDF, 0xE3, 0xEB, 0xF4, 0xFB, 0x03, 0x02, 0x04, 0x01, 0xFE, 0xFC, 
-    0xF8, 0xF5, 0xF2, 0xF6, 0xF7, 0xFE, 0xFF, 0x03, 0x06, 0x0A, 0x0F, 0x10, 
-    0x14, 0x16, 0x14, 0x15, 0x16, 0x19, 0x1B, 0x17, 0x14, 0x0D, 0x0C, 0x0C, 
-    0x0B, 0x06, 0x06, 0x07, 0x0C, 0x11, 0x10, 0x0B, 0x09, 0x07, 0x09, 0x0D, 
-    0x0C, 0x14, 0x16, 0x1C, 0x1E, 0x1D, 0x1D, 0x1F, 0x23, 0x22, 0x27, 0x26, 
-    0x27, 0x28, 0x27, 0x2A, 0x27, 0x25, 0x1B, 0x0F, 0x08, 0x03, 0x08, 0x0B, 
-    0x0C, 0x0B, 0x0A, 0x0B, 0x09, 0x0C, 0x0B, 0x08, 0x07, 0x09, 0x0C, 0x13, 
-    0x1B, 0x1F, 0x1F, 0x1D, 0x1B, 0x19, 0x16, 0x13, 0x12, 0x12, 0x13, 0x12, 
-    0x10, 0x12, 0x10, 0x0C, 0x04, 0xF6, 0xED, 0xE5, 0xE3, 0xE9, 0xF3, 0xFC, 
-    0x01, 0x04, 0x00, 0xFF, 0xFB, 0xFB, 0xFB, 0xFD, 0x00, 0x02, 0x0A, 0x10, 
-    0x19, 0x1C, 0x1C, 0x1B, 0x1E, 0x20, 0x21, 0x22, 0x21, 0x23, 0x24, 0x2A, 
-    0x27, 0x25, 0x19, 0x0F, 0x02, 0xF4, 0xEC, 0xE5, 0xEA, 0xED, 0xF5, 0xF6, 
-    0xF9, 0xF7, 0xF0, 0xE9, 0xE5, 0xE6, 0xED, 0xF7, 0xFE, 0x04, 0x07, 0x0D, 
-    0x0C, 0x0D, 0x04, 0x00, 0xFA, 0xF5, 0xF3, 0xEC, 0xEC, 0xEE, 0xF5, 0xFA, 
-    0xFD, 0xF9, 0xF4, 0xF1, 0xEF, 0xEF, 0xEE, 0xF3, 0xF3, 0xF9, 0xFE, 0xFE, 
-    0xFE, 0xF7, 0xF0, 0xE5, 0xE3, 0xE4, 0xE8, 0xF3, 0xF5, 0xF5, 0xF4, 0xF2, 
-    0xF3, 0xF1, 0xEE, 0xEA, 0xE6, 0xE3, 0xE0, 0xDC, 0xDE, 0xDC, 0xDD, 0xDB, 
-    0xD9, 0xD6, 0xD4, 0xD8, 0xDF, 0xE2, 0xE9, 0xEA, 0xEC, 0xEF, 0xED, 0xF1, 
-    0xED, 0xED, 0xE4, 0xE3, 0xDE, 0xE1, 0xE7, 0xE6, 0xEB, 0xE6, 0xE6, 0xE5, 
-    0xE8, 0xEC, 0xF0, 0xF4, 0xF6, 0xFA, 0xFE, 0xFF, 0xFA, 0xF8, 0xEE, 0xE9, 
-    0xE7, 0xE4, 0xE6, 0xE9, 0xF0, 0xF3, 0xF6, 0xF3, 0xF1, 0xEE, 0xEF, 0xED, 
-    0xEF, 0xF3, 0xEE, 0xEF, 0xEC, 0xF0, 0xF2, 0xF4, 0xF4, 0xF2, 0xF4, 0xF5, 
-    0xF9, 0xFA, 0xFF, 0x04, 0x0B, 0x10, 0x15, 0x15, 0x13, 0x13, 0x13, 0x17, 
-    0x1C, 0x20, 0x21, 0x23, 0x23, 0x20, 0x18, 0x0D, 0x03, 0xF9, 0xF5, 0xF7, 
-    0xF8, 0xFD, 0xFC, 0xFA, 0xFC, 0xF6, 0xF7, 0xF9, 0xFF, 0x05, 0x09, 0x0E, 
-    0x14, 0x17, 0x1C, 0x24, 0x23, 0x25, 0x1F, 0x1A, 0x16, 0x14, 0x18, 0x1B, 
-    0x22, 0x25, 0x24, 0x25, 0x21, 0x1A, 0x14, 0x09, 0x06, 0x05, 0x06, 0x0B, 
-    0x10, 0x19, 0x18, 0x17, 0x14, 0x0C, 0x0C, 0x0F, 0x15, 0x1C, 0x22, 0x23, 
-    0x27, 0x28, 0x27, 0x24, 0x1A, 0x0F, 0x05, 0xFB, 0xF5, 0xF1, 0xEF, 0xF2, 
-    0xF5, 0xF8, 0xF9, 0xF8, 0xF5, 0xF4, 0xF3, 0xF5, 0xF3, 0xFA, 0xFD, 0xFF, 
-    0x09, 0x07, 0x08, 0x04, 0x00, 0xFB, 0xFE, 0x06, 0x0C, 0x14, 0x1D, 0x26, 
-    0x28, 0x2C, 0x2B, 0x27, 0x21, 0x1B, 0x15, 0x12, 0x0F, 0x0D, 0x09, 0x04, 
-    0xFC, 0xF3, 0xEE, 0xE2, 0xDC, 0xD8, 0xD6, 0xD7, 0xDA, 0xE1, 0xE6, 0xEB, 
-    0xF0, 0xF7, 0xFD, 0xFE, 0xFF, 0xFC, 0xFB, 0xFB, 0x01, 0x04, 0x05, 0x06, 
-    0xFE, 0xFA, 0xF5, 0xEF, 0xF1, 0xF1, 0xF2, 0xF6, 0xF8, 0x00, 0x01, 0x03, 
-    0x02, 0xFE, 0xFD, 0xFA, 0xFA, 0xFB, 0xFD, 0xFB, 0xF9, 0xF6, 0xF1, 0xED, 
-    0xEA, 0xE9, 0xEA, 0xE9, 0xE4, 0xE2, 0xDD, 0xDB, 0xDE, 0xE4, 0xEC, 0xEB, 
-    0xE8, 0xE4, 0xE3, 0xE4, 0xE8, 0xEC, 0xED, 0xED, 0xEE, 0xEC, 0xEB, 0xE9, 
-    0xE9, 0xE9, 0xE6, 0xE9, 0xEA, 0xEE, 0xED, 0xEF, 0xEC, 0xE9, 0xE4, 0xE2, 
-    0xE5, 0xE7, 0xEB, 0xEB, 0xEE, 0xE8, 0xE7, 0xE8, 0xE9, 0xEB, 0xF1, 0xEE, 
-    0xEC, 0xEC, 0xE9, 0xEC, 0xED, 0xEE, 0xEA, 0xEB, 0xEA, 0xE9, 0xE9, 0xEA, 
-    0xEC, 0xEE, 0xF4, 0xF8, 0xFC, 0xFF, 0xFD, 0xFC, 0xFA, 0xF7, 0xF6, 0xF6, 
-    0xF6, 0xF6, 0xF6, 0xF6, 0xF9, 0xF4, 0xF0, 0xEE, 0xEE, 0xF1, 0xF7, 0x02, 
-    0x08, 0x11, 0x1E, 0x25, 0x2D, 0x2F, 0x2F, 0x2D, 0x29, 0x25, 0x1F, 0x1A, 
-    0x12, 0x0F, 0x0F, 0x09, 0x04, 0x01, 0xFB, 0xFD, 0xFB, 0xF8, 0xF8, 0xFA, 
-    0xFC, 0x01, 0x09, 0x0E, 0x15, 0x14, 0x14, 0x0F, 0x0B, 0x0E, 0x11, 0x16, 
-    0x1D, 0x1B, 0x1E, 0x20, 0x1F, 0x1F, 0x1D, 0x18, 0x11, 0x11, 0x0F, 0x12, 
-    0x10, 0x11, 0x10, 0x11, 0x0F, 0x0D, 0x0D, 0x0D, 0x10, 0x11, 0x0F, 0x0E, 
-    0x0D, 0x11, 0x1C, 0x20, 0x25, 0x20, 0x1B, 0x16, 0x15, 0x18, 0x19, 0x1C, 
-    0x1F, 0x1C, 0x19, 0x15, 0x11, 0x0F, 0x09, 0x09, 0x02, 0x06, 0x08, 0x0C, 
-    0x0D, 0x0C, 0x0C, 0x08, 0x08, 0x05, 0x03, 0x01, 0x00, 0x01, 0x03, 0x02, 
-    0x06, 0x08, 0x0C, 0x0D, 0x0E, 0x0F, 0x0E, 0x0D, 0x0B, 0x10, 0x15, 0x1C, 
-    0x21, 0x20, 0x1D, 0x15, 0x10, 0x0A, 0x02, 0xFB, 0xF6, 0xF4, 0xF5, 0xF7, 
-    0xF7, 0xF5, 0xF5, 0xF7, 0xF8, 0xFD, 0xFB, 0xFE, 0xFF, 0x01, 0x05, 0x04, 
-    0x05, 0xFE, 0xF9, 0xF4, 0xEE, 0xEA, 0xE5, 0xDF, 0xDC, 0xDD, 0xDD, 0xE0, 
-    0xE2, 0xE6, 0xE9, 0xEA, 0xEB, 0xEA, 0xEE, 0xF4, 0xF8, 0x01, 0x05, 0x0A, 
-    0x0D, 0x0C, 0x0B, 0x09, 0x08, 0x02, 0xFD, 0xF9, 0xF5, 0xF6, 0xF5, 0xF1, 
-    0xED, 0xE5, 0xE5, 0xE7, 0xE7, 0xEA, 0xE8, 0xE8, 0xE8, 0xEB, 0xEB, 0xED, 
-    0xF2, 0xF2, 0xF3, 0xF1, 0xEC, 0xEB, 0xEA, 0xE8, 0xE8, 0xE8, 0xE4, 0xE0, 
-    0xDE, 0xDE, 0xE0, 0xDE, 0xDD, 0xD8, 0xDA, 0xDF, 0xE2, 0xE7, 0xE8, 0xE9, 
-    0xEB, 0xED, 0xF2, 0xF7, 0xFA, 0x00, 0xFD, 0xFC, 0xF8, 0xF5, 0xF3, 0xF3, 
-    0xF6, 0xF8, 0xFA, 0xF8, 0xF7, 0xFB, 0xFB, 0xFE, 0xFC, 0xF9, 0xFA, 0xF9, 
-    0xFA, 0xF7, 0xF4, 0xED, 0xEC, 0xEA, 0xE5, 0xE1, 0xDB, 0xD5, 0xD2, 0xD5, 
-    0xD8, 0xDB, 0xE1, 0xEA, 0xF3, 0xFE, 0x06, 0x0B, 0x11, 0x16, 0x1A, 0x20, 
-    0x26, 0x2D, 0x31, 0x36, 0x34, 0x2F, 0x2A, 0x23, 0x1D, 0x1A, 0x15, 0x11, 
-    0x0E, 0x0B, 0x08, 0x08, 0x0B, 0x0B, 0x0A, 0x06, 0x05, 0x06, 0x0B, 0x12, 
-    0x17, 0x19, 0x18, 0x1B, 0x1E, 0x20, 0x1B, 0x15, 0x0A, 0x02, 0xFF, 0xFE, 
-    0x00, 0x02, 0x06, 0x0A, 0x0C, 0x0B, 0x0D, 0x0D, 0x0E, 0x0F, 0x14, 0x18, 
-    0x1D, 0x25, 0x28, 0x2C, 0x2B, 0x26, 0x21, 0x1D, 0x1B, 0x1C, 0x1D, 0x1E, 
-    0x1B, 0x1D, 0x1B, 0x18, 0x1C, 0x1A, 0x18, 0x12, 0x09, 0x02, 0xFF, 0x00, 
-    0x04, 0x07, 0x0A, 0x0B, 0x08, 0x08, 0x03, 0xFD, 0xFB, 0xF6, 0xF7, 0xF9, 
-    0xFA, 0xFE, 0x00, 0xFD, 0xFB, 0xF8, 0xF5, 0xF6, 0xF8, 0x00, 0x06, 0x0A, 
-    0x0C, 0x10, 0x13, 0x11, 0x13, 0x15, 0x13, 0x15, 0x11, 0x0B, 0x07, 0x06, 
-    0x08, 0x0B, 0x0E, 0x0B, 0x0C, 0x06, 0x04, 0xFE, 0xFD, 0x01, 0x05, 0x09, 
-    0x0D, 0x0D, 0x0A, 0x09, 0x02, 0x02, 0xFD, 0xF8, 0xF3, 0xF1, 0xF2, 0xEF, 
-    0xEC, 0xE9, 0xE3, 0xE0, 0xDE, 0xDE, 0xE0, 0xE6, 0xEB, 0xEC, 0xF0, 0xF0, 
-    0xF9, 0xFD, 0x04, 0x09, 0x08, 0x0B, 0x05, 0x03, 0x00, 0xFE, 0xFE, 0xFC, 
-    0xFA, 0xF3, 0xEF, 0xEC, 0xE8, 0xE8, 0xE3, 0xDF, 0xDE, 0xDB, 0xDE, 0xDF, 
-    0xDF, 0xE1, 0xE3, 0xE3, 0xE1, 0xE5, 0xE9, 0xEF, 0xF3, 0xF2, 0xEF, 0xEA, 
-    0xE7, 0xE9, 0xEA, 0xEB, 0xEB, 0xE7, 0xE6, 0xE4, 0xE1, 0xE0, 0xDD, 0xDC, 
-    0xDF, 0xE2, 0xE7, 0xED, 0xF0, 0xF3, 0xF3, 0xF3, 0xF1, 0xEF, 0xF0, 0xED, 
-    0xEB, 0xE5, 0xE0, 0xE1, 0xE0, 0xE1, 0xE5, 0xE7, 0xEC, 0xEB, 0xE9, 0xE8, 
-    0xE7, 0xED, 0xF1, 0xF9, 0xFF, 0x02, 0x04, 0xFE, 0xF5, 0xF1, 0xEA, 0xE9, 
-    0xE9, 0xEA, 0xEE, 0xEE, 0xEE, 0xEF, 0xED, 0xEF, 0xEB, 0xEA, 0xEE, 0xF1, 
-    0xFB, 0x03, 0x0C, 0x15, 0x1A, 0x1E, 0x22, 0x28, 0x2B, 0x28, 0x24, 0x1A, 
-    0x14, 0x13, 0x13, 0x16, 0x17, 0x12, 0x0B, 0x03, 0xFA, 0xF5, 0xF7, 0xFD, 
-    0x04, 0x0D, 0x12, 0x19, 0x1D, 0x20, 0x24, 0x22, 0x1D, 0x1B, 0x15, 0x11, 
-    0x13, 0x10, 0x10, 0x0E, 0x0C, 0x06, 0x04, 0x03, 0x03, 0x03, 0xFF, 0xFA, 
-    0xF7, 0xFD, 0x07, 0x10, 0x18, 0x1C, 0x19, 0x14, 0x10, 0x0E, 0x0E, 0x11, 
-    0x15, 0x1B, 0x1F, 0x21, 0x21, 0x1F, 0x1C, 0x16, 0x10, 0x0B, 0x08, 0x07, 
-    0x0B, 0x0E, 0x10, 0x10, 0x0D, 0x0B, 0x09, 0x0D, 0x11, 0x15, 0x16, 0x16, 
-    0x17, 0x19, 0x19, 0x1C, 0x1B, 0x1A, 0x1C, 0x1A, 0x16, 0x11, 0x0A, 0x05, 
-    0x00, 0xFE, 0xFB, 0xF8, 0xF5, 0xEC, 0xEB, 0xE4, 0xE7, 0xE5, 0xE4, 0xEB, 
-    0xF0, 0xF8, 0xFD, 0x01, 0x05, 0x09, 0x0A, 0x0E, 0x11, 0x18, 0x1D, 0x1A, 
-    0x13, 0x0A, 0x03, 0x00, 0x02, 0x02, 0xFF, 0xF9, 0xF1, 0xE8, 0xE3, 0xE1, 
-    0xE4, 0xE7, 0xEE, 0xF2, 0xF5, 0xF8, 0xF9, 0xFC, 0xFB, 0xFF, 0xFD, 0x00, 
-    0x04, 0x0A, 0x0B, 0x07, 0x03, 0xFA, 0xF9, 0xF6, 0xF5, 0xF5, 0xF2, 0xE9, 
-    0xDE, 0xD4, 0xCD, 0xCF, 0xD6, 0xDF, 0xE7, 0xEA, 0xED, 0xEF, 0xF1, 0xF3, 
-    0xF6, 0xF8, 0xF9, 0xFC, 0xFD, 0x01, 0x00, 0xFF, 0xFA, 0xF1, 0xEB, 0xE3, 
-    0xE0, 0xE0, 0xE3, 0xE8, 0xE9, 0xEC, 0xEE, 0xF3, 0xF7, 0xF7, 0xF7, 0xF3, 
-    0xEF, 0xEA, 0xE8, 0xEB, 0xED, 0xEF, 0xEE, 0xEC, 0xE9, 0xE4, 0xE0, 0xDA, 
-    0xD9, 0xDA, 0xE0, 0xE5, 0xEB, 0xEF, 0xF4, 0xF7, 0xFB, 0xFC, 0xF9, 0xF8, 
-    0xF5, 0xF8, 0xF9, 0xFB, 0xF8, 0xF6, 0xEF, 0xE8, 0xE4, 0xE3, 0xDE, 0xDC, 
-    0xDA, 0xD2, 0xD4, 0xD3, 0xD9, 0xE2, 0xE9, 0xF0, 0xF5, 0xF7, 0xF8, 0xF9, 
-    0xFE, 0x02, 0x05, 0x0A, 0x0E, 0x12, 0x12, 0x0E, 0x0B, 0x06, 0x00, 0xFC, 
-    0xF9, 0xF9, 0xFD, 0x07, 0x0C, 0x0E, 0x0C, 0x07, 0x07, 0x0B, 0x0D, 0x13, 
-    0x11, 0x11, 0x12, 0x14, 0x18, 0x1C, 0x22, 0x23, 0x28, 0x27, 0x28, 0x28, 
-    0x28, 0x29, 0x29, 0x2A, 0x29, 0x23, 0x1B, 0x16, 0x10, 0x0A, 0x05, 0xFA, 
-    0xF5, 0xF6, 0xF8, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x04, 0x0B, 0x16, 0x1B, 
-    0x1E, 0x1C, 0x1A, 0x18, 0x1D, 0x21, 0x26, 0x27, 0x23, 0x1F, 0x18, 0x12, 
-    0x09, 0x03, 0xFE, 0xFF, 0xFF, 0x03, 0x00, 0x04, 0x01, 0x04, 0x08, 0x08, 
-    0x0E, 0x11, 0x1B, 0x1E, 0x24, 0x25, 0x28, 0x2A, 0x2C, 0x2D, 0x30, 0x2D, 
-    0x29, 0x22, 0x15, 0x0A, 0x01, 0x00, 0xFF, 0xFE, 0xF9, 0xF4, 0xED, 0xEC, 
-    0xEE, 0xF2, 0xF6, 0xFB, 0x01, 0x09, 0x0E, 0x11, 0x12, 0x17, 0x1A, 0x19, 
-    0x16, 0x11, 0x10, 0x0E, 0x11, 0x0C, 0x0C, 0x06, 0x05, 0xFD, 0xF7, 0xF2, 
-    0xEC, 0xE9, 0xDF, 0xDC, 0xD9, 0xE1, 0xE9, 0xF1, 0xF7, 0xFC, 0x02, 0x07, 
-    0x0A, 0x0E, 0x0E, 0x11, 0x17, 0x16, 0x17, 0x12, 0x0D, 0x05, 0x00, 0xF8, 
-    0xEC, 0xE2, 0xDE, 0xDB, 0xDE, 0xDF, 0xDB, 0xD8, 0xD4, 0xD5, 0xD6, 0xDC, 
-    0xE2, 0xE9, 0xEF, 0xF2, 0xF3, 0xF6, 0xFD, 0x03, 0x09, 0x05, 0x02, 0xFD, 
-    0xF5, 0xF0, 0xE8, 0xE1, 0xE0, 0xE0, 0xE3, 0xE3, 0xE1, 0xDF, 0xDE, 0xDE, 
-    0xD9, 0xD9, 0xDF, 0xE8, 0xF3, 0xFB, 0xFF, 0xFE, 0xFF, 0x01, 0x02, 0x06, 
-    0x04, 0x01, 0xFB, 0xF3, 0xEB, 0xE7, 0xE6, 0xE7, 0xE9, 0xE7, 0xE4, 0xE3, 
-    0xE3, 0xE6, 0xE7, 0xEA, 0xEF, 0xF6, 0xFF, 0x01, 0x03, 0x03, 0xFE, 0xFB, 
-    0xF6, 0xF4, 0xF0, 0xF3, 0xF4, 0xF1, 0xF0, 0xE9, 0xE5, 0xE1, 0xE3, 0xE6, 
-    0xE7, 0xE7, 0xE4, 0xE7, 0xE8, 0xED, 0xF3, 0xFB, 0x02, 0x05, 0x08, 0x04, 
-    0x03, 0x00, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 
-    0x00, 0xFF, 0xFD, 0xFD, 0x01, 0x05, 0x09, 0x0B, 0x0C, 0x0B, 0x0A, 0x0D, 
-    0x0F, 0x0F, 0x11, 0x10, 0x10, 0x11, 0x11, 0x15, 0x1B, 0x21, 0x22, 0x24, 
-    0x23, 0x25, 0x27, 0x29, 0x2B, 0x29, 0x2C, 0x2A, 0x2B, 0x2A, 0x27, 0x25, 
-    0x1F, 0x16, 0x0B, 0x02, 0xFE, 0x01, 0x05, 0x07, 0x09, 0x08, 0x07, 0x0B, 
-    0x0E, 0x10, 0x12, 0x11, 0x0D, 0x0B, 0x0D, 0x0F, 0x16, 0x1E, 0x20, 0x24, 
-    0x27, 0x26, 0x27, 0x22, 0x20, 0x1E, 0x1D, 0x20, 0x22, 0x22, 0x20, 0x16, 
-    0x0D, 0x03, 0xFA, 0xF7, 0xF5, 0xF6, 0xF8, 0xF8, 0xF7, 0xF4, 0xF5, 0xFB, 
-    0xFE, 0x06, 0x07, 0x09, 0x08, 0x09, 0x0D, 0x0F, 0x15, 0x15, 0x18, 0x14, 
-    0x12, 0x0B, 0x07, 0x00, 0xF7, 0xF6, 0xF6, 0xFD, 0x03, 0x07, 0x01, 0xFB, 
-    0xF5, 0xF0, 0xEC, 0xEB, 0xE9, 0xE9, 0xEE, 0xF2, 0xF8, 0xFD, 0x02, 0x08, 
-    0x10, 0x15, 0x1A, 0x18, 0x16, 0x14, 0x11, 0x10, 0x0F, 0x0E, 0x0A, 0x04, 
-    0xF8, 0xF0, 0xE7, 0xE0, 0xDC, 0xDA, 0xDC, 0xDD, 0xE0, 0xE3, 0xE3, 0xE5, 
-    0xE6, 0xEB, 0xF2, 0xF5, 0xF7, 0xFB, 0xFF, 0x06, 0x0D, 0x0D, 0x0C, 0x09, 
-    0x06, 0x06, 0x06, 0x00, 0xF7, 0xEA, 0xE2, 0xDA, 0xDA, 0xD7, 0xD3, 0xD3, 
-    0xCD, 0xCB, 0xC9, 0xCB, 0xCE, 0xCD, 0xD2, 0xD4, 0xDA, 0xE4, 0xE8, 0xEF, 
-    0xF3, 0xF5, 0xF8, 0xFC, 0xFC, 0xFC, 0xFD, 0xFF, 0x01, 0x01, 0xFD, 0xF6, 
-    0xF0, 0xEE, 0xEC, 0xE7, 0xE2, 0xD9, 0xD3, 0xCF, 0xD0, 0xCF, 0xD0, 0xD5, 
-    0xD8, 0xE0, 0xE5, 0xEB, 0xEF, 0xF2, 0xF7, 0x01, 0x0A, 0x12, 0x19, 0x1A, 
-    0x17, 0x10, 0x0B, 0x05, 0x00, 0xF7, 0xEE, 0xEA, 0xE5, 0xE3, 0xE1, 0xDD, 
-    0xDB, 0xDA, 0xDD, 0xDC, 0xDB, 0xD8, 0xD6, 0xD8, 0xDB, 0xE2, 0xEA, 0xF6, 
-    0x01, 0x09, 0x0E, 0x14, 0x13, 0x14, 0x17, 0x1A, 0x21, 0x22, 0x23, 0x1F, 
-    0x16, 0x0E, 0x06, 0xFD, 0xF6, 0xEF, 0xEB, 0xE7, 0xE6, 0xE8, 0xE8, 0xEE, 
-    0xEF, 0xF6, 0xFF, 0x08, 0x10, 0x15, 0x19, 0x1B, 0x21, 0x28, 0x31, 0x37, 
-    0x3A, 0x39, 0x33, 0x2D, 0x25, 0x21, 0x1B, 0x17, 0x15, 0x10, 0x0E, 0x0A, 
-    0x0A, 0x07, 0x04, 0x00, 0xFF, 0xFD, 0xFC, 0x02, 0x08, 0x10, 0x15, 0x18, 
-    0x1F, 0x26, 0x2D, 0x33, 0x37, 0x38, 0x38, 0x38, 0x37, 0x38, 0x38, 0x35, 
-    0x30, 0x2B, 0x21, 0x17, 0x0E, 0x04, 0xFB, 0xF4, 0xF0, 0xED, 0xED, 0xEF, 
-    0xF1, 0xF4, 0xF6, 0xF9, 0xFD, 0x01, 0x04, 0x0B, 0x12, 0x19, 0x1F, 0x26, 
-    0x29, 0x2C, 0x2D, 0x2A, 0x2A, 0x25, 0x20, 0x18, 0x0D, 0x02, 0xF8, 0xF4, 
-    0xF2, 0xF2, 0xF0, 0xEC, 0xE4, 0xDC, 0xD8, 0xD4, 0xD5, 0xD7, 0xDB, 0xE2, 
-    0xEA, 0xF4, 0xFB, 0x03, 0x0A, 0x0C, 0x0F, 0x0F, 0x12, 0x13, 0x14, 0x13, 
-    0x0F, 0x0A, 0x02, 0xFD, 0xF8, 0xF3, 0xEC, 0xE4, 0xD9, 0xD2, 0xCE, 0xD1, 
-    0xD4, 0xDB, 0xE1, 0xE5, 0xE9, 0xEA, 0xF1, 0xF6, 0xFE, 0x04, 0x0C, 0x14, 
-    0x1C, 0x21, 0x24, 0x26, 0x21, 0x1A, 0x0E, 0x05, 0xFD, 0xF6, 0xF1, 0xE9, 
-    0xE3, 0xDD, 0xDE, 0xDE, 0xDB, 0xDB, 0xD8, 0xD2, 0xCE, 0xCE, 0xD4, 0xDC, 
-    0xE5, 0xEE, 0xF2, 0xF8, 0xF9, 0xFB, 0xFA, 0xFA, 0xFD, 0xFF, 0x06, 0x0B, 
-    0x0F, 0x0F, 0x0E, 0x09, 0xFF, 0xF1, 0xE7, 0xDD, 0xD5, 0xD2, 0xCA, 0xC8, 
-    0xC7, 0xCA, 0xCA, 0xCC, 0xCC, 0xCD, 0xD2, 0xD4, 0xDA, 0xE0, 0xEA, 0xF6, 
-    0x03, 0x0D, 0x12, 0x15, 0x15, 0x10, 0x0A, 0x04, 0x01, 0xFD, 0xFB, 0xF6, 
-    0xF3, 0xF2, 0xEE, 0xEB, 0xE5, 0xE0, 0xDA, 0xD3, 0xD2, 0xD2, 0xD5, 0xDE, 
-    0xE3, 0xEC, 0xF4, 0xFB, 0x05, 0x0C, 0x14, 0x1A, 0x1F, 0x25, 0x2A, 0x31, 
-    0x34, 0x35, 0x33, 0x2B, 0x21, 0x14, 0x09, 0x04, 0xFE, 0xF8, 0xF5, 0xF3, 
-    0xF2, 0xF4, 0xF7, 0xF7, 0xFA, 0xF9, 0xFB, 0x00, 0x04, 0x0C, 0x16, 0x22, 
-    0x27, 0x2C, 0x31, 0x33, 0x37, 0x3D, 0x40, 0x40, 0x3B, 0x31, 0x2A, 0x23, 
-    0x1F, 0x1A, 0x15, 0x10, 0x0A, 0x05, 0x02, 0xFF, 0xFB, 0xF7, 0xF2, 0xF4, 
-    0xF7, 0xFF, 0x05, 0x0D, 0x14, 0x16, 0x1E, 0x21, 0x26, 0x29, 0x2C, 0x2E, 
-    0x2E, 0x2C, 0x27, 0x29, 0x28, 0x26, 0x25, 0x1E, 0x15, 0x0C, 0x00, 0xF9, 
-    0xF4, 0xF2, 0xF2, 0xF1, 0xF3, 0xF3, 0xF4, 0xF6, 0xF9, 0xFF, 0x05, 0x0D, 
-    0x17, 0x1F, 0x28, 0x2E, 0x30, 0x34, 0x36, 0x38, 0x33, 0x2B, 0x23, 0x17, 
-    0x0C, 0x05, 0xFD, 0xF9, 0xF3, 0xEF, 0xED, 0xE9, 0xE6, 0xDE, 0xD6, 0xD2, 
-    0xD4, 0xDA, 0xE0, 0xE4, 0xEB, 0xF3, 0xFA, 0xFF, 0x02, 0x07, 0x0B, 0x13, 
-    0x1B, 0x23, 0x25, 0x25, 0x25, 0x22, 0x1C, 0x12, 0x04, 0xF4, 0xE4, 0xDA, 
-    0xD3, 0xD2, 0xCE, 0xCB, 0xC7, 0xC2, 0xC4, 0xC6, 0xCB, 0xCE, 0xD2, 0xD9, 
-    0xE4, 0xF1, 0xFC, 0x06, 0x0C, 0x13, 0x13, 0x14, 0x15, 0x10, 0x0D, 0x0A, 
-    0x07, 0x03, 0xFF, 0xFE, 0xF9, 0xF6, 0xF1, 0xE9, 0xDF, 0xD6, 0xD2, 0xCE, 
-    0xD0, 0xD1, 0xD3, 0xD8, 0xDB, 0xE0, 0xE6, 0xEF, 0xF7, 0xFB, 0xFF, 0x01, 
-    0x06, 0x0C, 0x0F, 0x14, 0x12, 0x11, 0x0D, 0x08, 0x01, 0xF4, 0xEB, 0xE5, 
-    0xE0, 0xDB, 0xD9, 0xD6, 0xD5, 0xD1, 0xD1, 0xCD, 0xCB, 0xCC, 0xCF, 0xD6, 
-    0xDC, 0xE6, 0xEE, 0xF9, 0x00, 0x05, 0x0E, 0x15, 0x1C, 0x1C, 0x19, 0x14, 
-    0x0F, 0x0A, 0x06, 0xFE, 0xF6, 0xEE, 0xE5, 0xE1, 0xD9, 0xD3, 0xCE, 0xCB, 
-    0xCA, 0xCA, 0xCC, 0xCF, 0xD4, 0xDA, 0xE2, 0xEB, 0xF1, 0xF7, 0xFD, 0x02, 
-    0x06, 0x0C, 0x11, 0x16, 0x1A, 0x1F, 0x22, 0x24, 0x24, 0x20, 0x19, 0x0E, 
-    0x05, 0xFD, 0xFC, 0xF6, 0xF4, 0xF0, 0xED, 0xED, 0xED, 0xEF, 0xF3, 0xFA, 
-    0xFF, 0x0A, 0x11, 0x1B, 0x25, 0x2F, 0x3A, 0x41, 0x45, 0x44, 0x43, 0x3D, 
-    0x3B, 0x35, 0x30, 0x2A, 0x25, 0x23, 0x1F, 0x1A, 0x14, 0x0D, 0x08, 0x00, 
-    0xFA, 0xF4, 0xF2, 0xF6, 0xF9, 0xFF, 0x03, 0x08, 0x12, 0x1C, 0x21, 0x23, 
-    0x27, 0x2B, 0x2E, 0x35, 0x38, 0x3C, 0x3F, 0x3D, 0x39, 0x2F, 0x22, 0x16, 
-    0x0C, 0x01, 0xF9, 0xF0, 0xEC, 0xEA, 0xEB, 0xEA, 0xE8, 0xE5, 0xE3, 0xE4, 
-    0xE3, 0xE8, 0xEA, 0xF3, 0xFD, 0x08, 0x10, 0x18, 0x22, 0x27, 0x28, 0x22, 
-    0x1A, 0x15, 0x14, 0x16, 0x17, 0x15, 0x0D, 0x07, 0x02, 0xF9, 0xF1, 0xE9, 
-    0xE2, 0xDD, 0xD9, 0xD7, 0xD9, 0xDD, 0xE1, 0xE7, 0xED, 0xF3, 0xF9, 0xFD, 
-    0xFE, 0x02, 0x03, 0x09, 0x11, 0x18, 0x1E, 0x20, 0x1F, 0x1C, 0x16, 0x0D, 
-    0x01, 0xF4, 0xED, 0xE8, 0xE4, 0xDF, 0xDA, 0xD5, 0xD1, 0xCE, 0xCB, 0xC9, 
-    0xCC, 0xD1, 0xD9, 0xE2, 0xEC, 0xF6, 0xFE, 0x07, 0x10, 0x17, 0x1C, 0x1B, 
-    0x15, 0x10, 0x0C, 0x0D, 0x0C, 0x09, 0x04, 0xFD, 0xF3, 0xEA, 0xE3, 0xDB, 
-    0xD4, 0xCD, 0xC7, 0xC3, 0xC3, 0xC4, 0xC7, 0xCA, 0xCF, 0xD5, 0xDB, 0xDF, 
-    0xE1, 0xE8, 0xF0, 0xF7, 0xFC, 0xFF, 0x05, 0x09, 0x0D, 0x0C, 0x0A, 0x05, 
-    0xFE, 0xF8, 0xF0, 0xEC, 0xE9, 0xE6, 0xE0, 0xDA, 0xD5, 0xD3, 0xD3, 0xD2, 
-    0xCE, 0xCC, 0xCF, 0xD4, 0xDD, 0xE8, 0xF2, 0xFA, 0x05, 0x0D, 0x12, 0x13, 
-    0x11, 0x0E, 0x0C, 0x0A, 0x08, 0x07, 0x04, 0x01, 0xFC, 0xF7, 0xF0, 0xEA, 
-    0xE5, 0xDF, 0xDA, 0xD5, 0xD6, 0xD6, 0xD8, 0xDD, 0xE1, 0xE8, 0xF1, 0xFA, 
-    0xFE, 0x00, 0x02, 0x04, 0x0C, 0x11, 0x1A, 0x21, 0x28, 0x2C, 0x2D, 0x29, 
-    0x21, 0x19, 0x12, 0x0C, 0x04, 0xFB, 0xF4, 0xF0, 0xED, 0xED, 0xE9, 0xE7, 
-    0xE3, 0xDF, 0xDE, 0xE2, 0xEA, 0xF4, 0x01, 0x0B, 0x15, 0x1F, 0x2A, 0x32, 
-    0x37, 0x36, 0x33, 0x31, 0x31, 0x33, 0x35, 0x36, 0x37, 0x35, 0x30, 0x29, 
-    0x1F, 0x16, 0x10, 0x0C, 0x07, 0x01, 0xFB, 0xFA, 0xFE, 0x04, 0x08, 0x09, 
-    0x0A, 0x0B, 0x0E, 0x13, 0x18, 0x20, 0x29, 0x31, 0x35, 0x37, 0x38, 0x37, 
-    0x34, 0x2C, 0x24, 0x1A, 0x14, 0x0E, 0x0A, 0x07, 0x04, 0x01, 0xFB, 0xF7, 
-    0xF1, 0xED, 0xEB, 0xEB, 0xED, 0xF2, 0xFB, 0x07, 0x11, 0x1B, 0x24, 0x28, 
-    0x2A, 0x29, 0x27, 0x23, 0x23, 0x22, 0x24, 0x23, 0x1F, 0x1A, 0x10, 0x06, 
-    0xFC, 0xF1, 0xE5, 0xDC, 0xD7, 0xD5, 0xD3, 0xD3, 0xD4, 0xD8, 0xDA, 0xDE, 
-    0xE1, 0xE2, 0xE6, 0xE8, 0xEE, 0xF3, 0xFA, 0x03, 0x0A, 0x0F, 0x13, 0x15, 
-    0x16, 0x15, 0x12, 0x0E, 0x0A, 0x07, 0x03, 0xFF, 0xFB, 0xF6, 0xF0, 0xEB, 
-    0xE6, 0xE1, 0xDB, 0xD6, 0xD4, 0xD6, 0xDC, 0xE4, 0xEC, 0xF7, 0xFF, 0x09, 
-    0x0D, 0x0E, 0x0F, 0x10, 0x15, 0x15, 0x13, 0x0E, 0x0D, 0x0B, 0x0A, 0x06, 
-    0xFE, 0xF5, 0xEB, 0xE4, 0xDF, 0xDC, 0xD7, 0xD6, 0xD5, 0xD9, 0xDD, 0xDF, 
-    0xE3, 0xE7, 0xEB, 0xEF, 0xF3, 0xF9, 0x00, 0x0A, 0x11, 0x14, 0x16, 0x17, 
-    0x18, 0x17, 0x12, 0x0A, 0x02, 0xF9, 0xEF, 0xE5, 0xDB, 0xD2, 0xCB, 0xC7, 
-    0xC5, 0xC1, 0xBD, 0xB6, 0xB3, 0xB3, 0xB9, 0xC4, 0xD1, 0xDE, 0xE7, 0xF2, 
-    0xFA, 0x02, 0x08, 0x0B, 0x0C, 0x0C, 0x0D, 0x10, 0x11, 0x13, 0x10, 0x0F, 
-    0x0A, 0x02, 0xFA, 0xF1, 0xEA, 0xE3, 0xE0, 0xDC, 0xDB, 0xDC, 0xDD, 0xDE, 
-    0xE2, 0xE5, 0xE9, 0xEA, 0xEB, 0xEF, 0xF9, 0x04, 0x0C, 0x11, 0x15, 0x18, 
-    0x1A, 0x1F, 0x20, 0x20, 0x1D, 0x19, 0x16, 0x14, 0x11, 0x0E, 0x0C, 0x09, 
-    0x05, 0xFD, 0xF8, 0xF3, 0xF0, 0xF1, 0xF4, 0xF9, 0x01, 0x0A, 0x14, 0x1E, 
-    0x28, 0x2F, 0x35, 0x37, 0x37, 0x3A, 0x3E, 0x43, 0x46, 0x46, 0x43, 0x3F, 
-    0x38, 0x2E, 0x24, 0x19, 0x0C, 0x03, 0xFC, 0xFB, 0xFD, 0xFD, 0xFD, 0xF9, 
-    0xF7, 0xF5, 0xF5, 0xF8, 0xFC, 0x01, 0x0A, 0x0F, 0x14, 0x19, 0x1D, 0x23, 
-    0x27, 0x2B, 0x2C, 0x2A, 0x27, 0x25, 0x22, 0x21, 0x1E, 0x1A, 0x15, 0x10, 
-    0x0A, 0x04, 0x01, 0xFB, 0xF4, 0xEE, 0xEB, 0xEC, 0xF1, 0xF7, 0xFC, 0x02, 
-    0x08, 0x0F, 0x13, 0x15, 0x18, 0x18, 0x1B, 0x1B, 0x1B, 0x1A, 0x1B, 0x1B, 
-    0x1B, 0x18, 0x13, 0x09, 0xFF, 0xF6, 0xEF, 0xEA, 0xE8, 0xE7, 0xE5, 0xE6, 
-    0xE3, 0xE5, 0xE8, 0xEB, 0xEF, 0xF2, 0xF7, 0xFE, 0x06, 0x0E, 0x13, 0x17, 
-    0x1C, 0x22, 0x25, 0x22, 0x1E, 0x19, 0x17, 0x13, 0x0B, 0xFE, 0xF2, 0xE8, 
-    0xE3, 0xDF, 0xDA, 0xD3, 0xCB, 0xC5, 0xBE, 0xBC, 0xBB, 0xC0, 0xC6, 0xCF, 
-    0xD9, 0xE2, 0xEF, 0xF6, 0xFC, 0xFE, 0xFF, 0x03, 0x09, 0x10, 0x16, 0x16, 
-    0x18, 0x17, 0x15, 0x0F, 0x06, 0xFC, 0xF4, 0xEF, 0xEB, 0xE8, 0xE4, 0xE4, 
-    0xE1, 0xE0, 0xDF, 0xDD, 0xDD, 0xDB, 0xDC, 0xE0, 0xE5, 0xED, 0xF3, 0xFA, 
-    0xFF, 0x03, 0x06, 0x06, 0x08, 0x06, 0x02, 0xFF, 0xFC, 0xF9, 0xF8, 0xF3, 
-    0xEF, 0xEA, 0xE5, 0xDF, 0xDA, 0xD7, 0xD3, 0xD1, 0xCF, 0xCF, 0xD3, 0xDB, 
-    0xE4, 0xF0, 0xFB, 0x03, 0x09, 0x0B, 0x0D, 0x10, 0x14, 0x17, 0x1A, 0x1C, 
-    0x1C, 0x1B, 0x19, 0x12, 0x06, 0xF6, 0xE6, 0xD9, 0xD1, 0xD0, 0xD1, 0xD1, 
-    0xCE, 0xC9, 0xC8, 0xC7, 0xC7, 0xC9, 0xCD, 0xD3, 0xDC, 0xE7, 0xEF, 0xF7, 
-    0xFD, 0x05, 0x0D, 0x16, 0x1E, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 
-    0x21, 0x1D, 0x17, 0x12, 0x0D, 0x07, 0x00, 0xFC, 0xF8, 0xF5, 0xF4, 0xF5, 
-    0xF9, 0x01, 0x09, 0x0F, 0x13, 0x16, 0x1A, 0x20, 0x25, 0x29, 0x2C, 0x2F, 
-    0x34, 0x39, 0x3E, 0x3E, 0x3A, 0x32, 0x27, 0x1C, 0x15, 0x13, 0x13, 0x14, 
-    0x13, 0x12, 0x0F, 0x0D, 0x0B, 0x0A, 0x0B, 0x0E, 0x13, 0x1A, 0x23, 0x2A, 
-    0x31, 0x34, 0x36, 0x37, 0x38, 0x36, 0x34, 0x31, 0x2D, 0x28, 0x20, 0x17, 
-    0x0D, 0x02, 0xFA, 0xF3, 0xEE, 0xE8, 0xE2, 0xDB, 0xD7, 0xD6, 0xD7, 0xD9, 
-    0xDC, 0xE2, 0xE8, 0xF1, 0xFA, 0x01, 0x06, 0x09, 0x0C, 0x10, 0x16, 0x1B, 
-    0x23, 0x28, 0x2C, 0x2A, 0x27, 0x21, 0x19, 0x10, 0x08, 0xFD, 0xF6, 0xF1, 
-    0xEE, 0xEB, 0xE8, 0xE6, 0xE3, 0xDE, 0xD9, 0xD4, 0xD4, 0xDA, 0xE3, 0xEC, 
-    0xF4, 0xFD, 0x04, 0x0A, 0x0D, 0x0E, 0x0E, 0x0D, 0x0E, 0x0E, 0x10, 0x11, 
-    0x0F, 0x0B, 0x04, 0xFC, 0xF0, 0xE4, 0xD8, 0xD0, 0xCE, 0xD2, 0xD9, 0xE2, 
-    0xEB, 0xF3, 0xFB, 0x00, 0x03, 0x01, 0xFB, 0xF2, 0xED, 0xED, 0xF2, 0xFB, 
-    0x03, 0x0A, 0x0E, 0x0F, 0x0C, 0x04, 0xF9, 0xEF, 0xE9, 0xE7, 0xE7, 0xE9, 
-    0xEE, 0xF2, 0xF4, 0xF2, 0xED, 0xE4, 0xDD, 0xDA, 0xDA, 0xDD, 0xDF, 0xE0, 
-    0xE1, 0xE3, 0xE4, 0xE4, 0xE4, 0xE2, 0xE1, 0xE0, 0xDE, 0xDF, 0xE2, 0xE8, 
-    0xEB, 0xEA, 0xE7, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE7, 0xE9, 0xEA, 
-    0xEB, 0xEB, 0xED, 0xEF, 0xF3, 0xF8, 0xFF, 0x07, 0x0D, 0x11, 0x14, 0x13, 
-    0x11, 0x10, 0x0E, 0x0F, 0x10, 0x0F, 0x0D, 0x09, 0x05, 0x01, 0x00, 0x02, 
-    0x04, 0x08, 0x0C, 0x0E, 0x11, 0x13, 0x12, 0x10, 0x0E, 0x0E, 0x0F, 0x15, 
-    0x1B, 0x20, 0x25, 0x28, 0x29, 0x27, 0x22, 0x1B, 0x17, 0x16, 0x15, 0x17, 
-    0x19, 0x1A, 0x1A, 0x18, 0x17, 0x14, 0x11, 0x0C, 0x08, 0x04, 0x02, 0x04, 
-    0x08, 0x0A, 0x0A, 0x09, 0x08, 0x08, 0x06, 0x03, 0x00, 0xFF, 0x01, 0x06, 
-    0x0B, 0x11, 0x15, 0x19, 0x1F, 0x25, 0x2B, 0x2E, 0x2F, 0x2D, 0x2A, 0x25, 
-    0x1F, 0x1C, 0x1F, 0x24, 0x28, 0x2C, 0x2A, 0x23, 0x15, 0x04, 0xF5, 0xEE, 
-    0xF0, 0xFA, 0x08, 0x15, 0x1E, 0x21, 0x1B, 0x0C, 0xFA, 0xE8, 0xDE, 0xDB, 
-    0xE0, 0xEC, 0xFB, 0x09, 0x11, 0x11, 0x0A, 0x00, 0xF6, 0xEF, 0xEB, 0xEC, 
-    0xF3, 0xFF, 0x0E, 0x1B, 0x23, 0x25, 0x20, 0x18, 0x0F, 0x04, 0xFD, 0xFD, 
-    0x01, 0x0A, 0x12, 0x16, 0x14, 0x0F, 0x07, 0xFC, 0xF2, 0xE9, 0xE6, 0xE9, 
-    0xEF, 0xF6, 0xFD, 0x01, 0x02, 0xFF, 0xFB, 0xF4, 0xEA, 0xE4, 0xE0, 0xE0, 
-    0xE1, 0xE3, 0xE7, 0xEC, 0xF0, 0xF0, 0xEC, 0xE7, 0xE4, 0xE1, 0xE0, 0xE2, 
-    0xE7, 0xF0, 0xF8, 0xFD, 0xFF, 0xFD, 0xFA, 0xF5, 0xF0, 0xEB, 0xE9, 0xE9, 
-    0xEC, 0xF1, 0xF6, 0xFA, 0xF9, 0xF6, 0xF2, 0xED, 0xE9, 0xE4, 0xE0, 0xDD, 
-    0xDC, 0xDD, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE3, 0xE6, 0xE8, 0xEA, 0xEB, 
-    0xEB, 0xED, 0xF2, 0xF6, 0xF7, 0xF6, 0xF3, 0xF2, 0xF0, 0xEF, 0xEE, 0xED, 
-    0xF0, 0xF5, 0xFB, 0x00, 0x02, 0x01, 0xFF, 0xFC, 0xF8, 0xF4, 0xEF, 0xED, 
-    0xED, 0xED, 0xEB, 0xE7, 0xE2, 0xDE, 0xDB, 0xDA, 0xD9, 0xDA, 0xDC, 0xDB, 
-    0xDB, 0xDC, 0xDE, 0xDF, 0xDF, 0xDE, 0xDC, 0xDC, 0xDD, 0xDF, 0xE2, 0xE6, 
-    0xED, 0xF8, 0x02, 0x0A, 0x10, 0x14, 0x17, 0x18, 0x1A, 0x19, 0x18, 0x15, 
-    0x12, 0x0E, 0x0C, 0x0B, 0x0C, 0x0F, 0x13, 0x16, 0x18, 0x19, 0x1A, 0x18, 
-    0x15, 0x14, 0x13, 0x14, 0x15, 0x15, 0x12, 0x0F, 0x0B, 0x07, 0x05, 0x05, 
-    0x07, 0x0A, 0x0C, 0x10, 0x13, 0x16, 0x1A, 0x1C, 0x1E, 0x1D, 0x1B, 0x18, 
-    0x15, 0x13, 0x12, 0x12, 0x13, 0x15, 0x17, 0x19, 0x1C, 0x1F, 0x1F, 0x1E, 
-    0x1B, 0x1B, 0x1D, 0x21, 0x24, 0x24, 0x22, 0x1F, 0x1F, 0x22, 0x26, 0x27, 
-    0x26, 0x23, 0x20, 0x1C, 0x19, 0x17, 0x15, 0x17, 0x1B, 0x1C, 0x18, 0x10, 
-    0x03, 0xF5, 0xEA, 0xE2, 0xE0, 0xE2, 0xE9, 0xF3, 0x00, 0x0C, 0x12, 0x10, 
-    0x0A, 0x02, 0xFB, 0xF7, 0xF6, 0xF6, 0xF5, 0xF8, 0xFB, 0xFF, 0x02, 0x02, 
-    0x00, 0xFF, 0x01, 0x04, 0x08, 0x0C, 0x10, 0x11, 0x12, 0x12, 0x0F, 0x0C, 
-    0x07, 0x03, 0xFE, 0xFA, 0xF5, 0xF0, 0xED, 0xEB, 0xEA, 0xEB, 0xEA, 0xEA, 
-    0xE9, 0xEA, 0xED, 0xF2, 0xF7, 0xFA, 0xFB, 0xFD, 0xFE, 0x00, 0x01, 0x03, 
-    0x05, 0x06, 0x08, 0x08, 0x09, 0x07, 0x06, 0x04, 0x03, 0x01, 0xFF, 0xFE, 
-    0xFE, 0xFF, 0x00, 0xFF, 0xFD, 0xF9, 0xF5, 0xF3, 0xF1, 0xEF, 0xED, 0xE9, 
-    0xE5, 0xE2, 0xE2, 0xE5, 0xE9, 0xEC, 0xEB, 0xE7, 0xE0, 0xDC, 0xD9, 0xD8, 
-    0xD9, 0xDB, 0xDF, 0xE3, 0xE6, 0xE7, 0xE7, 0xE6, 0xE7, 0xE9, 0xEC, 0xEF, 
-    0xF3, 0xF4, 0xF4, 0xF2, 0xF0, 0xEF, 0xEE, 0xEF, 0xF2, 0xF5, 0xF9, 0xFC, 
-    0xFB, 0xF8, 0xF3, 0xF2, 0xF1, 0xF1, 0xEF, 0xEB, 0xE9, 0xE9, 0xE8, 0xE5, 
-    0xE1, 0xDD, 0xDC, 0xDC, 0xDC, 0xDB, 0xDA, 0xD7, 0xD8, 0xD9, 0xDB, 0xDD, 
-    0xDF, 0xE1, 0xE3, 0xE4, 0xE5, 0xE5, 0xE7, 0xE9, 0xEA, 0xEC, 0xEE, 0xF0, 
-    0xF2, 0xF3, 0xF5, 0xFA, 0xFE, 0x04, 0x09, 0x0C, 0x0F, 0x13, 0x19, 0x1F, 
-    0x22, 0x20, 0x1D, 0x19, 0x15, 0x10, 0x0A, 0x05, 0x02, 0x03, 0x04, 0x03, 
-    0x04, 0x06, 0x09, 0x0A, 0x08, 0x05, 0x03, 0x03, 0x06, 0x09, 0x0B, 0x0E, 
-    0x10, 0x0F, 0x0D, 0x0B, 0x0B, 0x0C, 0x0F, 0x11, 0x14, 0x16, 0x17, 0x16, 
-    0x16, 0x14, 0x11, 0x10, 0x0F, 0x10, 0x12, 0x15, 0x17, 0x19, 0x1B, 0x19, 
-    0x16, 0x12, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x0A, 0x0A, 0x0C, 0x11, 0x14, 
-    0x15, 0x13, 0x12, 0x10, 0x13, 0x17, 0x1C, 0x20, 0x21, 0x21, 0x20, 0x20, 
-    0x23, 0x25, 0x27, 0x27, 0x26, 0x24, 0x1F, 0x17, 0x0F, 0x08, 0x04, 0x05, 
-    0x0A, 0x0F, 0x14, 0x16, 0x18, 0x17, 0x14, 0x11, 0x0C, 0x08, 0x05, 0x02, 
-    0xFF, 0xFA, 0xF7, 0xF6, 0xF5, 0xF6, 0xF8, 0xF9, 0xFA, 0xFA, 0xF9, 0xF9, 
-    0xFB, 0xFD, 0xFE, 0xFF, 0x01, 0x03, 0x05, 0x05, 0x04, 0x03, 0x02, 0x01, 
-    0xFE, 0xFB, 0xF8, 0xF5, 0xF1, 0xEB, 0xE7, 0xE8, 0xEB, 0xEE, 0xF0, 0xF3, 
-    0xF9, 0x01, 0x08, 0x0B, 0x0C, 0x0C, 0x0C, 0x0B, 0x07, 0x03, 0xFE, 0xFA, 
-    0xF7, 0xF8, 0xF7, 0xF6, 0xF4, 0xF2, 0xF1, 0xF0, 0xEE, 0xED, 0xEE, 0xEE, 
-    0xED, 0xEB, 0xEA, 0xEA, 0xEC, 0xEC, 0xEB, 0xE9, 0xEA, 0xEB, 0xEF, 0xF2, 
-    0xF6, 0xF9, 0xFB, 0xF8, 0xF2, 0xEF, 0xEF, 0xF2, 0xF7, 0xF9, 0xF8, 0xF7, 
-    0xF8, 0xFB, 0xFB, 0xF8, 0xF5, 0xF4, 0xF5, 0xF5, 0xF3, 0xF0, 0xEE, 0xED, 
-    0xEC, 0xED, 0xEF, 0xF1, 0xF2, 0xF2, 0xF0, 0xED, 0xEA, 0xE8, 0xEA, 0xEE, 
-    0xF2, 0xF4, 0xF3, 0xF0, 0xEE, 0xEC, 0xEA, 0xE8, 0xE7, 0xE7, 0xE6, 0xE5, 
-    0xE3, 0xE2, 0xE0, 0xDF, 0xDD, 0xDC, 0xDD, 0xDE, 0xE1, 0xE4, 0xE6, 0xEA, 
-    0xEF, 0xF2, 0xF2, 0xEF, 0xEA, 0xE6, 0xE2, 0xE0, 0xDF, 0xE2, 0xE8, 0xEF, 
-    0xF7, 0xFC, 0xFF, 0x00, 0x04, 0x09, 0x0E, 0x12, 0x15, 0x19, 0x1B, 0x1B, 
-    0x19, 0x16, 0x14, 0x13, 0x12, 0x12, 0x13, 0x14, 0x15, 0x15, 0x17, 0x19, 
-    0x1E, 0x23, 0x25, 0x24, 0x23, 0x24, 0x26, 0x28, 0x28, 0x25, 0x20, 0x1E, 
-    0x1D, 0x1E, 0x1C, 0x16, 0x11, 0x0D, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x11, 
-    0x13, 0x15, 0x16, 0x16, 0x15, 0x12, 0x10, 0x11, 0x13, 0x15, 0x14, 0x14, 
-    0x16, 0x18, 0x18, 0x15, 0x11, 0x10, 0x13, 0x15, 0x14, 0x12, 0x0F, 0x0E, 
-    0x0E, 0x11, 0x13, 0x15, 0x18, 0x1C, 0x20, 0x24, 0x26, 0x24, 0x20, 0x19, 
-    0x10, 0x07, 0x01, 0xFC, 0xFB, 0xFB, 0xFC, 0xFE, 0x00, 0x01, 0x00, 0xFE, 
-    0xFC, 0xFB, 0xFB, 0xFC, 0xFE, 0x00, 0x03, 0x05, 0x05, 0x01, 0xFE, 0xFE, 
-    0x00, 0x06, 0x0A, 0x0D, 0x0E, 0x0C, 0x0B, 0x0B, 0x0B, 0x0D, 0x0F, 0x0E, 
-    0x0F, 0x0D, 0x0C, 0x0B, 0x0A, 0x07, 0x03, 0xFD, 0xF8, 0xF4, 0xF0, 0xED, 
-    0xEB, 0xEA, 0xEC, 0xF0, 0xF4, 0xF9, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0x01, 0x04, 0x06, 0x04, 0x00, 0xFD, 0xFB, 0xFC, 0xFC, 0xFB, 0xF8, 
-    0xF7, 0xF3, 0xF0, 0xEC, 0xEA, 0xE9, 0xE9, 0xE7, 0xE5, 0xE4, 0xE3, 0xE4, 
-    0xE8, 0xEB, 0xEF, 0xF1, 0xF0, 0xEE, 0xEB, 0xE7, 0xE2, 0xDD, 0xDA, 0xDB, 
-    0xDA, 0xDC, 0xDE, 0xE2, 0xE6, 0xE5, 0xE3, 0xE2, 0xE5, 0xE9, 0xEB, 0xEA, 
-    0xEC, 0xEE, 0xF1, 0xF3, 0xF2, 0xF1, 0xF2, 0xF4, 0xF4, 0xF4, 0xF4, 0xF7, 
-    0xFB, 0xFE, 0xFF, 0xFD, 0xFB, 0xFA, 0xF9, 0xFA, 0xF9, 0xF8, 0xF6, 0xF5, 
-    0xF4, 0xF4, 0xF3, 0xF1, 0xEF, 0xEB, 0xE6, 0xE2, 0xDE, 0xDE, 0xE0, 0xE2, 
-    0xE5, 0xE8, 0xEB, 0xEE, 0xEE, 0xEA, 0xE5, 0xE2, 0xE2, 0xE5, 0xE7, 0xE9, 
-    0xEB, 0xED, 0xEF, 0xEF, 0xEE, 0xEE, 0xEF, 0xF3, 0xF9, 0xFE, 0x02, 0x04, 
-    0x05, 0x07, 0x0B, 0x10, 0x13, 0x13, 0x11, 0x0F, 0x0F, 0x11, 0x14, 0x15, 
-    0x13, 0x0F, 0x0A, 0x03, 0xFF, 0xFD, 0xFD, 0xFF, 0x00, 0x04, 0x09, 0x10, 
-    0x13, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1D, 0x1F, 0x20, 0x20, 0x1F, 0x1B, 
-    0x17, 0x14, 0x12, 0x14, 0x15, 0x15, 0x12, 0x0E, 0x0C, 0x0D, 0x11, 0x16, 
-    0x18, 0x17, 0x15, 0x14, 0x15, 0x17, 0x1A, 0x1C, 0x1E, 0x1D, 0x1E, 0x1D, 
-    0x1A, 0x18, 0x18, 0x17, 0x16, 0x16, 0x16, 0x17, 0x1A, 0x1D, 0x1F, 0x1F, 
-    0x20, 0x1E, 0x1C, 0x19, 0x17, 0x16, 0x13, 0x0F, 0x0C, 0x0C, 0x0E, 0x0E, 
-    0x0A, 0x02, 0xFB, 0xF7, 0xF8, 0xFA, 0xF9, 0xF6, 0xF2, 0xEF, 0xEE, 0xEF, 
-    0xF0, 0xF0, 0xF2, 0xF5, 0xFA, 0x01, 0x05, 0x07, 0x04, 0x00, 0xFE, 0xFC, 
-    0xFD, 0xFB, 0xFA, 0xFB, 0xFC, 0xFE, 0xFF, 0xFF, 0xFC, 0xFA, 0xF8, 0xF9, 
-    0xF9, 0xFA, 0xFB, 0xFB, 0xFC, 0xFD, 0xFC, 0xFA, 0xF7, 0xF4, 0xF3, 0xF3, 
-    0xF6, 0xFA, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x06, 0x05, 0x06, 0x05, 0x05, 
-    0x04, 0x01, 0x00, 0x00, 0x01, 0x03, 0x03, 0x00, 0xF9, 0xF4, 0xF1, 0xF0, 
-    0xF0, 0xEE, 0xED, 0xEB, 0xEA, 0xE9, 0xE9, 0xE9, 0xE8, 0xE7, 0xE5, 0xE4, 
-    0xE5, 0xE6, 0xE7, 0xE9, 0xEC, 0xEE, 0xF0, 0xF0, 0xEF, 0xED, 0xEB, 0xE8, 
-    0xE6, 0xE3, 0xE4, 0xE5, 0xE7, 0xE9, 0xE8, 0xE5, 0xE0, 0xDC, 0xDD, 0xE1, 
-    0xE8, 0xEF, 0xF3, 0xF5, 0xF3, 0xF0, 0xEE, 0xED, 0xEC, 0xEC, 0xEB, 0xEC, 
-    0xEC, 0xEB, 0xE9, 0xE8, 0xE7, 0xE9, 0xEC, 0xED, 0xED, 0xEB, 0xEA, 0xE8, 
-    0xE9, 0xEA, 0xEA, 0xE9, 0xE9, 0xEA, 0xEB, 0xEA, 0xEA, 0xE9, 0xEA, 0xEC, 
-    0xEE, 0xF0, 0xEF, 0xEC, 0xEB, 0xEB, 0xEB, 0xED, 0xEF, 0xF1, 0xF1, 0xF1, 
-    0xF0, 0xF2, 0xF7, 0xFD, 0x03, 0x08, 0x0D, 0x11, 0x17, 0x19, 0x1C, 0x1F, 
-    0x21, 0x22, 0x23, 0x22, 0x21, 0x21, 0x1F, 0x1B, 0x16, 0x11, 0x10, 0x11, 
-    0x13, 0x13, 0x13, 0x11, 0x0F, 0x0E, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0B, 
-    0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0A, 0x08, 0x06, 0x08, 0x0D, 0x11, 0x11, 
-    0x0F, 0x0A, 0x06, 0x03, 0x02, 0x03, 0x06, 0x09, 0x0A, 0x08, 0x05, 0x04, 
-    0x06, 0x0A, 0x0E, 0x11, 0x14, 0x15, 0x19, 0x1C, 0x1D, 0x1C, 0x1B, 0x1A, 
-    0x1A, 0x1B, 0x1C, 0x1E, 0x21, 0x21, 0x20, 0x1F, 0x1E, 0x1F, 0x1D, 0x1A, 
-    0x15, 0x0F, 0x0D, 0x0C, 0x0D, 0x0D, 0x0C, 0x0A, 0x07, 0x02, 0xFD, 0xF8, 
-    0xF5, 0xF5, 0xF8, 0xFC, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x06, 
-    0x09, 0x0B, 0x0B, 0x0A, 0x09, 0x09, 0x0A, 0x0C, 0x0B, 0x0A, 0x08, 0x06, 
-    0x02, 0xFD, 0xF9, 0xF6, 0xF4, 0xF2, 0xF3, 0xF4, 0xF3, 0xEF, 0xEA, 0xE8, 
-    0xE8, 0xE9, 0xED, 0xF2, 0xF6, 0xF9, 0xF9, 0xF7, 0xF4, 0xF2, 0xF0, 0xEE, 
-    0xED, 0xEC, 0xEB, 0xEC, 0xEF, 0xF4, 0xF9, 0xFD, 0xFE, 0xFE, 0xFF, 0x00, 
-    0x01, 0x02, 0x03, 0x04, 0x03, 0x01, 0xFF, 0xFC, 0xF9, 0xF4, 0xEE, 0xEA, 
-    0xE8, 0xE9, 0xE9, 0xEA, 0xE8, 0xE4, 0xE3, 0xE4, 0xE6, 0xE7, 0xE6, 0xE5, 
-    0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xED, 0xEF, 0xEF, 0xF0, 0xF0, 0xF1, 0xF5, 
-    0xF8, 0xF9, 0xFA, 0xFA, 0xFB, 0xFA, 0xFA, 0xF9, 0xFA, 0xFE, 0xFF, 0xFB, 
-    0xF6, 0xF3, 0xF2, 0xF3, 0xF2, 0xEF, 0xEC, 0xEC, 0xED, 0xEB, 0xE7, 0xE2, 
-    0xDE, 0xDC, 0xDD, 0xDC, 0xDB, 0xD8, 0xD7, 0xD6, 0xD7, 0xDA, 0xDE, 0xE4, 
-    0xE9, 0xEC, 0xEC, 0xEB, 0xEA, 0xE8, 0xE6, 0xE5, 0xE7, 0xE8, 0xEA, 0xE9, 
-    0xE8, 0xE7, 0xE7, 0xEB, 0xEF, 0xF2, 0xF5, 0xF7, 0xFB, 0xFE, 0x01, 0x05, 
-    0x0A, 0x10, 0x15, 0x17, 0x18, 0x18, 0x1C, 0x22, 0x27, 0x29, 0x28, 0x25, 
-    0x22, 0x1F, 0x1E, 0x1C, 0x1A, 0x17, 0x17, 0x19, 0x1B, 0x1E, 0x1D, 0x1A, 
-    0x15, 0x12, 0x11, 0x12, 0x14, 0x16, 0x15, 0x12, 0x11, 0x11, 0x13, 0x14, 
-    0x13, 0x12, 0x11, 0x0F, 0x0D, 0x0C, 0x0C, 0x0F, 0x12, 0x13, 0x12, 0x10, 
-    0x0F, 0x0E, 0x0E, 0x0D, 0x0C, 0x0B, 0x0C, 0x0E, 0x10, 0x12, 0x11, 0x10, 
-    0x0D, 0x0B, 0x08, 0x04, 0x05, 0x09, 0x0E, 0x12, 0x14, 0x15, 0x16, 0x16, 
-    0x14, 0x10, 0x0B, 0x07, 0x04, 0x03, 0x03, 0x06, 0x09, 0x0A, 0x09, 0x07, 
-    0x05, 0x04, 0x04, 0x02, 0x01, 0x01, 0x02, 0x05, 0x05, 0x03, 0xFE, 0xFB, 
-    0xFA, 0xF8, 0xF7, 0xF6, 0xF8, 0xFB, 0xFF, 0x02, 0x03, 0x02, 0x03, 0x02, 
-    0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x01, 0x00, 
-    0xFE, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x04, 0x04, 0x03, 
-    0xFF, 0xFA, 0xF7, 0xF5, 0xF5, 0xF6, 0xF7, 0xF8, 0xF7, 0xF6, 0xF4, 0xF2, 
-    0xF1, 0xF0, 0xEF, 0xF0, 0xF2, 0xF1, 0xEF, 0xED, 0xEE, 0xED, 0xEA, 0xE8, 
-    0xE6, 0xE8, 0xEA, 0xEA, 0xE9, 0xE7, 0xE6, 0xE5, 0xE4, 0xE3, 0xE2, 0xDF, 
-    0xDC, 0xDA, 0xDA, 0xDB, 0xDF, 0xE3, 0xE7, 0xEA, 0xEC, 0xEC, 0xED, 0xEE, 
-    0xEF, 0xF0, 0xF0, 0xEF, 0xF0, 0xEE, 0xED, 0xEE, 0xF0, 0xF3, 0xF5, 0xF6, 
-    0xF8, 0xFB, 0xFC, 0xFB, 0xF8, 0xF5, 0xF4, 0xF6, 0xF7, 0xF8, 0xF6, 0xF5, 
-    0xF4, 0xF4, 0xF3, 0xF1, 0xEE, 0xEB, 0xEA, 0xEB, 0xED, 0xEF, 0xEF, 0xEE, 
-    0xEC, 0xEA, 0xE9, 0xE8, 0xE7, 0xE8, 0xEA, 0xEB, 0xEB, 0xEC, 0xED, 0xEF, 
-    0xEF, 0xF0, 0xF0, 0xF1, 0xF2, 0xF3, 0xF2, 0xF1, 0xEF, 0xED, 0xEE, 0xF0, 
-    0xF3, 0xF4, 0xF4, 0xF2, 0xF0, 0xF0, 0xF2, 0xF8, 0xFE, 0x04, 0x09, 0x0D, 
-    0x0F, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1D, 0x1F, 0x21, 
-    0x21, 0x23, 0x25, 0x28, 0x2A, 0x2A, 0x29, 0x25, 0x21, 0x1F, 0x20, 0x21, 
-    0x20, 0x1B, 0x12, 0x0B, 0x08, 0x07, 0x07, 0x08, 0x07, 0x07, 0x08, 0x08, 
-    0x07, 0x05, 0x03, 0x03, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0F, 0x12, 0x13, 
-    0x14, 0x15, 0x18, 0x19, 0x18, 0x18, 0x18, 0x1B, 0x1E, 0x21, 0x22, 0x25, 
-    0x26, 0x26, 0x25, 0x23, 0x20, 0x1F, 0x1E, 0x1E, 0x1C, 0x1C, 0x1B, 0x19, 
-    0x17, 0x12, 0x0D, 0x07, 0x02, 0xFF, 0xFC, 0xFA, 0xF8, 0xF8, 0xF9, 0xF9, 
-    0xF7, 0xF3, 0xEF, 0xEC, 0xEA, 0xE9, 0xEA, 0xEE, 0xF2, 0xF5, 0xF6, 0xF7, 
-    0xF6, 0xF6, 0xF7, 0xF8, 0xF9, 0xFB, 0xFD, 0x00, 0x02, 0x04, 0x05, 0x06, 
-    0x08, 0x09, 0x09, 0x08, 0x07, 0x06, 0x07, 0x07, 0x06, 0x05, 0x04, 0x05, 
-    0x07, 0x06, 0x03, 0x02, 0x02, 0x04, 0x05, 0x04, 0x01, 0xFF, 0xFD, 0xFD, 
-    0xFC, 0xFB, 0xF9, 0xF8, 0xF8, 0xF6, 0xF3, 0xF3, 0xF5, 0xF7, 0xF9, 0xF8, 
-    0xF7, 0xF6, 0xF5, 0xF4, 0xF2, 0xF0, 0xED, 0xEC, 0xEA, 0xEB, 0xED, 0xF0, 
-    0xF0, 0xED, 0xEB, 0xEB, 0xEE, 0xF1, 0xF3, 0xF2, 0xEF, 0xEC, 0xEB, 0xEC, 
-    0xED, 0xEB, 0xE9, 0xE5, 0xE2, 0xE2, 0xE3, 0xE2, 0xE1, 0xDF, 0xE1, 0xE3, 
-    0xE4, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEE, 
-    0xF0, 0xEF, 0xEF, 0xEE, 0xEF, 0xF0, 0xF1, 0xF1, 0xF2, 0xF3, 0xF5, 0xF6, 
-    0xF8, 0xF8, 0xF7, 0xF4, 0xEF, 0xEC, 0xE9, 0xE8, 0xE8, 0xE8, 0xEA, 0xED, 
-    0xF0, 0xF1, 0xEE, 0xEC, 0xEA, 0xEB, 0xEB, 0xEC, 0xEC, 0xED, 0xEE, 0xF0, 
-    0xF2, 0xF3, 0xF1, 0xEF, 0xEE, 0xEE, 0xEE, 0xEF, 0xF3, 0xF8, 0xFE, 0x03, 
-    0x05, 0x06, 0x08, 0x0C, 0x0D, 0x0F, 0x11, 0x14, 0x18, 0x1C, 0x21, 0x25, 
-    0x28, 0x2A, 0x29, 0x2A, 0x29, 0x27, 0x23, 0x1F, 0x1B, 0x1B, 0x1D, 0x20, 
-    0x21, 0x21, 0x1E, 0x1A, 0x16, 0x14, 0x10, 0x0D, 0x09, 0x06, 0x05, 0x05, 
-    0x05, 0x06, 0x06, 0x04, 0x00, 0xFD, 0xFB, 0xFA, 0xFC, 0xFF, 0x01, 0x04, 
-    0x06, 0x08, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x13, 0x18, 0x1B, 0x1A, 
-    0x18, 0x18, 0x19, 0x1B, 0x1C, 0x1E, 0x21, 0x24, 0x24, 0x22, 0x20, 0x20, 
-    0x21, 0x22, 0x21, 0x1E, 0x1A, 0x16, 0x14, 0x12, 0x10, 0x0D, 0x0B, 0x0A, 
-    0x0A, 0x0B, 0x09, 0x07, 0x05, 0x03, 0x02, 0x01, 0x00, 0xFE, 0xFD, 0xFB, 
-    0xFA, 0xF9, 0xFB, 0xFD, 0xFD, 0xFC, 0xFD, 0xFF, 0x01, 0x02, 0x01, 0x01, 
-    0x00, 0xFF, 0xFC, 0xFA, 0xF8, 0xF6, 0xF3, 0xF2, 0xF1, 0xF2, 0xF3, 0xF5, 
-    0xF7, 0xF8, 0xFA, 0xF9, 0xF8, 0xF7, 0xF6, 0xFA, 0xFE, 0xFD, 0xFA, 0xFF, 
-    0x08, 0x0E, 0x09, 0x05, 0x03, 0x02, 0x02, 0x03, 0x06, 0x07, 0x08, 0x02, 
-    0xFC, 0xF8, 0xFE, 0x01, 0xFE, 0xFC, 0xF6, 0xF2, 0xEC, 0xE3, 0xE9, 0xEB, 
-    0xEC, 0xE7, 0xE0, 0xE3, 0xE2, 0xE0, 0xE0, 0xE5, 0xEB, 0xEE, 0xEC, 0xE9, 
-    0xE7, 0xE9, 0xF1, 0xF2, 0xF4, 0xF3, 0xF0, 0xEA, 0xE1, 0xE9, 0xEF, 0xF1, 
-    0xF4, 0xEF, 0xF3, 0xF7, 0xF3, 0xF8, 0xF6, 0xF9, 0xF8, 0xF1, 0xED, 0xEA, 
-    0xF0, 0xF4, 0xF7, 0xF7, 0xF8, 0xF4, 0xE9, 0xE4, 0xE8, 0xE6, 0xEC, 0xDF, 
-    0xE1, 0xE5, 0xE2, 0xE8, 0xEB, 0xF3, 0xF9, 0xF6, 0xF2, 0xED, 0xE0, 0xE7, 
-    0xE5, 0xE9, 0xED, 0xF3, 0xEC, 0xE9, 0xE6, 0xE6, 0xEB, 0xE9, 0xE6, 0xDE, 
-    0xE1, 0xE3, 0xE3, 0xE2, 0xEE, 0xE9, 0xEE, 0xE7, 0xE9, 0xE8, 0xE9, 0xF2, 
-    0xEF, 0xF9, 0xFA, 0xFD, 0xF4, 0xF6, 0x02, 0x09, 0x09, 0x0A, 0x0B, 0x0D, 
-    0x0F, 0x13, 0x18, 0x24, 0x2D, 0x2C, 0x2C, 0x20, 0x1C, 0x20, 0x1E, 0x22, 
-    0x28, 0x24, 0x24, 0x1A, 0x14, 0x1E, 0x1E, 0x1E, 0x16, 0x19, 0x1B, 0x18, 
-    0x16, 0x1B, 0x21, 0x1D, 0x1C, 0x0E, 0x0A, 0x07, 0x0B, 0x0F, 0x12, 0x15, 
-    0x14, 0x0E, 0x0A, 0x0D, 0x16, 0x21, 0x13, 0x0A, 0x00, 0x01, 0x00, 0x01, 
-    0x06, 0x0F, 0x13, 0x11, 0x0E, 0x06, 0x06, 0x05, 0x0C, 0x0D, 0x10, 0x14, 
-    0x0A, 0x03, 0x0D, 0x15, 0x1B, 0x11, 0x06, 0x06, 0x07, 0x07, 0x08, 0x0E, 
-    0x13, 0x11, 0x0E, 0x0E, 0x10, 0x17, 0x1C, 0x1E, 0x19, 0x1A, 0x16, 0x0B, 
-    0x08, 0x0B, 0x16, 0x15, 0x11, 0x01, 0x00, 0xFF, 0xFC, 0x04, 0x07, 0x0C, 
-    0x04, 0x00, 0xF9, 0xF5, 0xF2, 0xF5, 0xF5, 0xF3, 0xF6, 0xF3, 0xEB, 0xEC, 
-    0xF3, 0xF9, 0x00, 0xFA, 0xF5, 0xF7, 0xFF, 0x00, 0x01, 0x04, 0x07, 0x09, 
-    0x07, 0x02, 0x01, 0x04, 0x0D, 0x14, 0x0F, 0x10, 0x0B, 0x07, 0x05, 0x07, 
-    0x14, 0x0F, 0x06, 0xF9, 0xF1, 0xF3, 0xF3, 0xF4, 0xF6, 0xFF, 0xFA, 0xF5, 
-    0xE8, 0xE6, 0xE5, 0xE4, 0xEA, 0xE9, 0xE8, 0xE1, 0xD6, 0xCD, 0xD6, 0xE5, 
-    0xEB, 0xE4, 0xDB, 0xD8, 0xDF, 0xE6, 0xE6, 0xF0, 0xF0, 0xF1, 0xED, 0xE8, 
-    0xEA, 0xED, 0xFB, 0xF8, 0xFC, 0xF9, 0xF2, 0xEC, 0xE9, 0xF6, 0xFF, 0x03, 
-    0xF6, 0xEE, 0xEC, 0xEF, 0xF4, 0xFE, 0x04, 0x07, 0x00, 0xF1, 0xE8, 0xDF, 
-    0xEB, 0xEE, 0xEF, 0xED, 0xE7, 0xE3, 0xDD, 0xDA, 0xE6, 0xF3, 0xF8, 0xF4, 
-    0xE5, 0xE8, 0xEC, 0xEF, 0xF5, 0xF6, 0xF6, 0xF1, 0xEA, 0xE6, 0xE8, 0xF2, 
-    0xF9, 0xFB, 0xFC, 0xF6, 0xED, 0xE9, 0xE7, 0xF1, 0xF6, 0xED, 0xDD, 0xD2, 
-    0xD3, 0xDF, 0xEB, 0xEF, 0xF8, 0xFA, 0xF7, 0xEE, 0xE8, 0xE5, 0xEE, 0xF9, 
-    0xFD, 0x00, 0x03, 0xFE, 0xFC, 0xFF, 0x08, 0x18, 0x17, 0x0F, 0x08, 0x09, 
-    0x0F, 0x16, 0x1F, 0x23, 0x24, 0x27, 0x1D, 0x1B, 0x1D, 0x1D, 0x1C, 0x1C, 
-    0x18, 0x15, 0x17, 0x0C, 0x10, 0x1D, 0x26, 0x23, 0x11, 0x06, 0x06, 0x0A, 
-    0x17, 0x18, 0x21, 0x25, 0x20, 0x16, 0x10, 0x11, 0x14, 0x20, 0x1C, 0x23, 
-    0x1B, 0x15, 0x0E, 0x0D, 0x1C, 0x28, 0x22, 0x1D, 0x16, 0x16, 0x17, 0x14, 
-    0x20, 0x21, 0x26, 0x21, 0x19, 0x12, 0x15, 0x18, 0x1B, 0x18, 0x14, 0x0F, 
-    0x04, 0xFB, 0x00, 0x10, 0x13, 0x0D, 0xFA, 0xF0, 0xEE, 0xF4, 0xFF, 0x0A, 
-    0x10, 0x15, 0x11, 0x09, 0x02, 0x05, 0x0D, 0x10, 0x12, 0x11, 0x07, 0xF8, 
-    0xEF, 0xF2, 0x05, 0x0D, 0x07, 0xFB, 0xF3, 0xF0, 0xF3, 0xF6, 0xFA, 0xFD, 
-    0xFF, 0xFA, 0xF1, 0xF3, 0xF8, 0x04, 0x0A, 0x09, 0x09, 0x03, 0xF9, 0xF2, 
-    0xFC, 0x0C, 0x14, 0x13, 0xFF, 0xFC, 0xFF, 0x03, 0x13, 0x18, 0x1F, 0x16, 
-    0x09, 0xFA, 0xF9, 0xFA, 0x04, 0x0B, 0x03, 0x04, 0xF8, 0xEE, 0xE3, 0xE9, 
-    0xF5, 0xF9, 0xED, 0xE3, 0xDF, 0xDF, 0xE9, 0xEC, 0xF6, 0xFB, 0xF6, 0xEE, 
-    0xE5, 0xDE, 0xE6, 0xEE, 0xF4, 0xF5, 0xF5, 0xF2, 0xE9, 0xE5, 0xEC, 0xFC, 
-    0xF9, 0xEF, 0xDE, 0xD8, 0xDB, 0xDC, 0xEC, 0xF7, 0xFB, 0xFA, 0xF1, 0xE7, 
-    0xE4, 0xEE, 0xF7, 0xFF, 0xFE, 0xF9, 0xF0, 0xE1, 0xDC, 0xE3, 0xF6, 0xF4, 
-    0xE9, 0xDC, 0xD3, 0xD4, 0xDB, 0xE3, 0xF1, 0xF2, 0xF0, 0xE9, 0xE1, 0xE0, 
-    0xE4, 0xF0, 0xF5, 0xFC, 0xFC, 0xFB, 0xEE, 0xEB, 0xF2, 0x03, 0x01, 0xFA, 
-    0xEC, 0xE0, 0xE2, 0xE2, 0xF7, 0xFE, 0x04, 0xFA, 0xEB, 0xDE, 0xDE, 0xE4, 
-    0xEE, 0xF3, 0xED, 0xEB, 0xDE, 0xD3, 0xD3, 0xE7, 0xF8, 0x00, 0xFA, 0xEC, 
-    0xE6, 0xE2, 0xEA, 0xF8, 0x06, 0x0B, 0x06, 0xF9, 0xF4, 0xF5, 0x00, 0x0F, 
-    0x15, 0x1B, 0x19, 0x10, 0x06, 0x02, 0x11, 0x1B, 0x1D, 0x12, 0x03, 0xFC, 
-    0xF8, 0xFF, 0x0C, 0x19, 0x1A, 0x12, 0x04, 0x00, 0x06, 0x14, 0x21, 0x26, 
-    0x21, 0x14, 0x04, 0xF1, 0xF1, 0x01, 0x11, 0x14, 0x0B, 0x02, 0x00, 0x04, 
-    0x12, 0x24, 0x32, 0x2F, 0x28, 0x19, 0x15, 0x1B, 0x27, 0x34, 0x37, 0x3E, 
-    0x38, 0x30, 0x22, 0x21, 0x2C, 0x38, 0x37, 0x28, 0x25, 0x1D, 0x1D, 0x29, 
-    0x32, 0x36, 0x2D, 0x19, 0x07, 0xFC, 0x03, 0x0B, 0x12, 0x15, 0x15, 0x0E, 
-    0x03, 0xFA, 0xFA, 0x0D, 0x19, 0x18, 0x0F, 0x09, 0x06, 0x0A, 0x17, 0x24, 
-    0x2B, 0x22, 0x12, 0xFE, 0xF4, 0xFA, 0x02, 0x0C, 0x12, 0x15, 0x16, 0x0A, 
-    0xFB, 0xF9, 0x02, 0x05, 0xFC, 0xEC, 0xE2, 0xDF, 0xE1, 0xF2, 0x00, 0x0D, 
-    0x0C, 0xFE, 0xF6, 0xF0, 0xFB, 0x04, 0x0A, 0x0A, 0x0A, 0x05, 0xF6, 0xEF, 
-    0xF1, 0x04, 0x0E, 0x09, 0xFE, 0xF7, 0xF5, 0xF8, 0x07, 0x16, 0x1F, 0x19, 
-    0x09, 0xF7, 0xED, 0xF4, 0xF9, 0xFF, 0x01, 0x01, 0xFA, 0xEC, 0xE1, 0xE6, 
-    0xF6, 0xFF, 0xF5, 0xE8, 0xE0, 0xDA, 0xE0, 0xE9, 0xFA, 0x01, 0xF8, 0xE9, 
-    0xDC, 0xDB, 0xE9, 0xF7, 0x01, 0x04, 0x00, 0xFB, 0xF0, 0xEB, 0xFA, 0x0C, 
-    0x12, 0x05, 0xF5, 0xED, 0xEB, 0xF3, 0x00, 0x0D, 0x0D, 0x04, 0xF3, 0xE6, 
-    0xE6, 0xEF, 0xF6, 0xFB, 0xFE, 0xF5, 0xEE, 0xDF, 0xD4, 0xDE, 0xEB, 0xEE, 
-    0xDF, 0xD1, 0xC8, 0xC8, 0xD1, 0xDF, 0xF1, 0xF5, 0xF0, 0xE7, 0xE3, 0xEB, 
-    0xF9, 0x03, 0x00, 0xFA, 0xEF, 0xE1, 0xD4, 0xCD, 0xD8, 0xE7, 0xED, 0xE3, 
-    0xDA, 0xD5, 0xD7, 0xE0, 0xEB, 0xF7, 0xF5, 0xE8, 0xDA, 0xD1, 0xD8, 0xE7, 
-    0xF3, 0xFB, 0xFD, 0xF9, 0xF3, 0xE9, 0xE2, 0xEF, 0xFE, 0x03, 0xFE, 0xFA, 
-    0xF9, 0xFA, 0x05, 0x10, 0x17, 0x18, 0x09, 0xFB, 0xF5, 0xF7, 0x08, 0x15, 
-    0x1C, 0x1B, 0x12, 0x04, 0xF7, 0xF1, 0xFC, 0x08, 0x08, 0xFD, 0xF6, 0xF3, 
-    0xF4, 0xFE, 0x0A, 0x13, 0x12, 0x06, 0xF7, 0xF0, 0xF3, 0x03, 0x13, 0x1C, 
-    0x1F, 0x1A, 0x0E, 0x00, 0xFD, 0x0B, 0x1B, 0x22, 0x1B, 0x13, 0x10, 0x12, 
-    0x21, 0x33, 0x3D, 0x3B, 0x29, 0x1A, 0x12, 0x16, 0x28, 0x32, 0x37, 0x33, 
-    0x29, 0x1A, 0x0A, 0x08, 0x11, 0x1F, 0x1B, 0x0E, 0x03, 0xFE, 0x05, 0x14, 
-    0x27, 0x2B, 0x24, 0x0F, 0xFD, 0xF4, 0xF8, 0x0B, 0x19, 0x25, 0x26, 0x20, 
-    0x16, 0x0B, 0x0B, 0x17, 0x20, 0x1D, 0x0E, 0x04, 0x00, 0x01, 0x0E, 0x1B, 
-    0x20, 0x18, 0x09, 0xF7, 0xED, 0xF1, 0xFE, 0x0B, 0x0F, 0x0B, 0x01, 0xF4, 
-    0xEA, 0xEC, 0xFA, 0x04, 0xFF, 0xF3, 0xE8, 0xE3, 0xEA, 0xFA, 0x0A, 0x12, 
-    0x09, 0xFC, 0xF1, 0xEC, 0xF4, 0x01, 0x0B, 0x0C, 0x0B, 0x04, 0xF8, 0xEF, 
-    0xF1, 0xFF, 0x0C, 0x08, 0xF8, 0xEC, 0xE3, 0xE6, 0xF5, 0x01, 0x06, 0x00, 
-    0xF3, 0xEA, 0xE5, 0xE5, 0xED, 0xF1, 0xF1, 0xF0, 0xE6, 0xD9, 0xCE, 0xCF, 
-    0xE0, 0xEA, 0xE9, 0xE1, 0xD7, 0xD3, 0xDB, 0xEC, 0x00, 0x06, 0x00, 0xF4, 
-    0xE9, 0xE9, 0xF5, 0x04, 0x10, 0x14, 0x0D, 0x07, 0xF7, 0xF0, 0xF3, 0xFF, 
-    0x0A, 0x09, 0x02, 0xF9, 0xEE, 0xEF, 0xF9, 0x03, 0x08, 0xFA, 0xE9, 0xDA, 
-    0xD9, 0xE1, 0xF0, 0xFB, 0xFA, 0xF3, 0xE9, 0xD8, 0xCE, 0xD5, 0xE4, 0xF0, 
-    0xF0, 0xEA, 0xE2, 0xE0, 0xEB, 0xF9, 0x05, 0x03, 0xF5, 0xE7, 0xDA, 0xDD, 
-    0xE6, 0xF6, 0xFE, 0xFF, 0xF9, 0xE7, 0xDB, 0xCF, 0xD6, 0xE9, 0xED, 0xE8, 
-    0xDE, 0xD4, 0xD3, 0xDB, 0xEA, 0xF8, 0xFA, 0xEF, 0xE2, 0xD8, 0xDA, 0xE8, 
-    0xFA, 0x09, 0x0B, 0x08, 0xFE, 0xF1, 0xEA, 0xF3, 0xFF, 0x04, 0x00, 0xF7, 
-    0xF2, 0xF6, 0x07, 0x19, 0x27, 0x21, 0x0F, 0xF9, 0xEF, 0xF4, 0x00, 0x11, 
-    0x18, 0x17, 0x12, 0x0A, 0xFC, 0xF6, 0xFA, 0x04, 0x0A, 0x07, 0xFF, 0xFC, 
-    0xFE, 0x0D, 0x22, 0x2B, 0x28, 0x17, 0x07, 0x00, 0x06, 0x12, 0x21, 0x2A, 
-    0x2E, 0x2D, 0x23, 0x1C, 0x15, 0x1C, 0x29, 0x29, 0x25, 0x1D, 0x17, 0x1A, 
-    0x25, 0x35, 0x3E, 0x3A, 0x2A, 0x16, 0x09, 0x0C, 0x14, 0x22, 0x27, 0x22, 
-    0x1B, 0x11, 0x05, 0x01, 0x08, 0x10, 0x0E, 0x08, 0xFE, 0xF5, 0xF8, 0x03, 
-    0x17, 0x25, 0x28, 0x1C, 0x0E, 0x04, 0x04, 0x10, 0x1C, 0x1F, 0x1C, 0x16, 
-    0x09, 0x01, 0xF8, 0xFE, 0x06, 0x02, 0xFC, 0xF1, 0xEB, 0xEB, 0xF9, 0x0A, 
-    0x14, 0x10, 0x04, 0xF4, 0xEB, 0xEE, 0xF9, 0x0A, 0x12, 0x14, 0x09, 0xFD, 
-    0xF1, 0xF3, 0x05, 0x13, 0x17, 0x0F, 0x05, 0xFD, 0x01, 0x0D, 0x1D, 0x24, 
-    0x1C, 0x0E, 0xFF, 0xF9, 0xFE, 0x08, 0x12, 0x15, 0x10, 0x03, 0xF4, 0xE8, 
-    0xE5, 0xF1, 0xF9, 0xFA, 0xF5, 0xE9, 0xE2, 0xE4, 0xEF, 0xFD, 0x01, 0xF9, 
-    0xEA, 0xDD, 0xD9, 0xE3, 0xF2, 0xFE, 0x03, 0xFD, 0xF1, 0xE4, 0xD8, 0xDB, 
-    0xEA, 0xF9, 0xFB, 0xF7, 0xED, 0xE8, 0xEF, 0xFF, 0x0E, 0x12, 0x0B, 0xFC, 
-    0xEF, 0xEC, 0xF6, 0x04, 0x0F, 0x10, 0x0A, 0xFD, 0xED, 0xDF, 0xDA, 0xE1, 
-    0xE7, 0xE3, 0xDF, 0xDB, 0xDA, 0xE1, 0xEC, 0xF7, 0xF9, 0xEF, 0xE1, 0xD4, 
-    0xD3, 0xDF, 0xF2, 0x03, 0x0B, 0x0C, 0x02, 0xF4, 0xEA, 0xE7, 0xF2, 0xFC, 
-    0xFA, 0xF3, 0xEB, 0xE6, 0xF0, 0xFC, 0x05, 0x04, 0xF7, 0xE5, 0xD3, 0xD0, 
-    0xDB, 0xE9, 0xF8, 0x02, 0x00, 0xF6, 0xE6, 0xD9, 0xDB, 0xE4, 0xEA, 0xEA, 
-    0xE5, 0xE0, 0xE0, 0xEF, 0x02, 0x0D, 0x13, 0x06, 0xF8, 0xE9, 0xE7, 0xF4, 
-    0x04, 0x11, 0x17, 0x15, 0x0A, 0x00, 0xF9, 0xFD, 0x04, 0x06, 0xFE, 0xF5, 
-    0xEB, 0xEB, 0xF6, 0x09, 0x1A, 0x1A, 0x10, 0xFA, 0xEA, 0xE7, 0xF3, 0x04, 
-    0x0F, 0x15, 0x11, 0x09, 0x00, 0xFB, 0x01, 0x0A, 0x0B, 0x06, 0xF9, 0xF2, 
-    0xFC, 0x0E, 0x26, 0x34, 0x39, 0x31, 0x23, 0x1A, 0x1B, 0x2C, 0x3B, 0x45, 
-    0x47, 0x3E, 0x35, 0x2C, 0x2C, 0x32, 0x36, 0x32, 0x24, 0x16, 0x0D, 0x11, 
-    0x1D, 0x2A, 0x2F, 0x2B, 0x1C, 0x0C, 0x01, 0x01, 0x0D, 0x16, 0x1B, 0x1A, 
-    0x12, 0x08, 0x00, 0x03, 0x0C, 0x16, 0x18, 0x11, 0x09, 0x00, 0x04, 0x0F, 
-    0x1E, 0x25, 0x20, 0x12, 0x04, 0xFE, 0x01, 0x0C, 0x12, 0x12, 0x0E, 0x03, 
-    0xF8, 0xF1, 0xF2, 0xF9, 0xFF, 0xFF, 0xF6, 0xEE, 0xEA, 0xEE, 0xFA, 0x04, 
-    0x0A, 0x07, 0xFF, 0xF4, 0xF0, 0xF4, 0x02, 0x10, 0x18, 0x18, 0x0D, 0x00, 
-    0xF9, 0xF8, 0x01, 0x09, 0x0A, 0x06, 0xFE, 0xFC, 0xFE, 0x08, 0x15, 0x16, 
-    0x11, 0x05, 0xF5, 0xEF, 0xF3, 0x01, 0x0F, 0x18, 0x12, 0x04, 0xF1, 0xE5, 
-    0xE5, 0xEC, 0xF5, 0xF6, 0xF2, 0xE9, 0xE6, 0xEB, 0xF9, 0x01, 0x01, 0xF7, 
-    0xE8, 0xDC, 0xDA, 0xE2, 0xF3, 0x07, 0x13, 0x14, 0x06, 0xF4, 0xE8, 0xE8, 
-    0xF4, 0xFE, 0xFB, 0xF5, 0xE9, 0xE6, 0xEF, 0xFB, 0x04, 0xFF, 0xF1, 0xE1, 
-    0xD2, 0xCE, 0xD8, 0xE7, 0xF8, 0x01, 0xFE, 0xEE, 0xDE, 0xD2, 0xD3, 0xDD, 
-    0xE2, 0xE0, 0xD8, 0xCF, 0xCF, 0xDB, 0xEF, 0x01, 0x01, 0xF7, 0xE3, 0xD5, 
-    0xD5, 0xDF, 0xF1, 0x01, 0x08, 0x04, 0xF6, 0xE6, 0xDD, 0xDC, 0xE1, 0xE1, 
-    0xD9, 0xCE, 0xC3, 0xC7, 0xD8, 0xEE, 0xFD, 0xFB, 0xEE, 0xE0, 0xD7, 0xDA, 
-    0xE6, 0xF6, 0x06, 0x0C, 0x0B, 0x00, 0xF6, 0xF3, 0xFA, 0x02, 0x07, 0x02, 
-    0xF5, 0xEE, 0xF0, 0xFF, 0x11, 0x1F, 0x1E, 0x11, 0xFF, 0xF3, 0xF3, 0xFE, 
-    0x0E, 0x19, 0x1B, 0x12, 0x04, 0xFC, 0xFC, 0x03, 0x09, 0x06, 0xFC, 0xED, 
-    0xE6, 0xEB, 0xF8, 0x09, 0x11, 0x0C, 0x02, 0xFA, 0xFB, 0x02, 0x0C, 0x16, 
-    0x1A, 0x1B, 0x17, 0x0D, 0x08, 0x0A, 0x14, 0x1F, 0x21, 0x1A, 0x0E, 0x04, 
-    0x07, 0x14, 0x22, 0x2C, 0x2A, 0x21, 0x1A, 0x16, 0x1A, 0x21, 0x29, 0x30, 
-    0x2F, 0x28, 0x1B, 0x11, 0x0D, 0x14, 0x1C, 0x1E, 0x1A, 0x0D, 0x03, 0x01, 
-    0x09, 0x16, 0x1C, 0x1A, 0x0E, 0x05, 0x05, 0x10, 0x21, 0x2B, 0x2F, 0x29, 
-    0x1C, 0x0E, 0x05, 0x08, 0x13, 0x1E, 0x22, 0x1C, 0x11, 0x08, 0x0A, 0x10, 
-    0x17, 0x17, 0x09, 0xF8, 0xE9, 0xE5, 0xF1, 0x00, 0x0E, 0x15, 0x11, 0x06, 
-    0xF5, 0xED, 0xEF, 0xF9, 0x02, 0x04, 0x01, 0xFC, 0xFB, 0xFF, 0x07, 0x0D, 
-    0x0C, 0x03, 0xF4, 0xEE, 0xEF, 0xFD, 0x10, 0x1B, 0x22, 0x1D, 0x11, 0x03, 
-    0xFA, 0xFC, 0x03, 0x05, 0x01, 0xF6, 0xEE, 0xEB, 0xF3, 0x00, 0x09, 0x06, 
-    0xF7, 0xE6, 0xD9, 0xD8, 0xE1, 0xEF, 0xFE, 0x06, 0x08, 0x00, 0xF2, 0xE8, 
-    0xE7, 0xEB, 0xEC, 0xEA, 0xE4, 0xDE, 0xE1, 0xEC, 0xFC, 0x08, 0x0A, 0x01, 
-    0xF3, 0xE8, 0xE6, 0xEF, 0xFF, 0x0D, 0x13, 0x11, 0x07, 0xFD, 0xF6, 0xF8, 
-    0xFB, 0xFA, 0xF4, 0xE9, 0xE3, 0xE6, 0xF3, 0x03, 0x0B, 0x08, 0xF8, 0xE3, 
-    0xD4, 0xCF, 0xD8, 0xE2, 0xED, 0xF1, 0xF3, 0xEF, 0xE7, 0xE3, 0xE7, 0xEE, 
-    0xF0, 0xEB, 0xE0, 0xD8, 0xD9, 0xE3, 0xF3, 0x00, 0x03, 0xFB, 0xED, 0xE0, 
-    0xDA, 0xDE, 0xE4, 0xE9, 0xE9, 0xE7, 0xDF, 0xDB, 0xDB, 0xE2, 0xEB, 0xE7, 
-    0xDC, 0xCF, 0xC9, 0xCB, 0xD8, 0xE9, 0xF8, 0xFE, 0xF9, 0xF2, 0xED, 0xEF, 
-    0xF7, 0xFE, 0x03, 0x03, 0x03, 0xFF, 0xFC, 0xFE, 0x06, 0x0E, 0x0D, 0x05, 
-    0xF8, 0xEE, 0xF0, 0xF9, 0x06, 0x10, 0x11, 0x0D, 0x06, 0x03, 0x06, 0x0B, 
-    0x11, 0x13, 0x12, 0x0F, 0x07, 0xFF, 0xFE, 0x05, 0x0F, 0x12, 0x11, 0x0C, 
-    0x0B, 0x0E, 0x15, 0x1D, 0x1E, 0x19, 0x0E, 0x06, 0x07, 0x0E, 0x18, 0x1F, 
-    0x1F, 0x21, 0x1E, 0x1B, 0x19, 0x1A, 0x20, 0x24, 0x22, 0x1E, 0x1B, 0x1B, 
-    0x1F, 0x24, 0x2A, 0x24, 0x18, 0x0A, 0x02, 0x08, 0x15, 0x22, 0x2A, 0x2A, 
-    0x22, 0x18, 0x0E, 0x0A, 0x0C, 0x11, 0x11, 0x0A, 0x02, 0xFE, 0x00, 0x0B, 
-    0x18, 0x20, 0x1F, 0x12, 0x00, 0xF6, 0xFA, 0x0B, 0x1E, 0x29, 0x2D, 0x27, 
-    0x1B, 0x0D, 0x04, 0x03, 0x07, 0x09, 0xFF, 0xF3, 0xE8, 0xE7, 0xF2, 0x02, 
-    0x10, 0x11, 0x03, 0xED, 0xE0, 0xE3, 0xF5, 0x09, 0x1A, 0x21, 0x20, 0x18, 
-    0x0C, 0x04, 0x07, 0x10, 0x11, 0x0D, 0x05, 0xFE, 0x00, 0x0D, 0x1F, 0x2A, 
-    0x25, 0x0E, 0xF6, 0xE7, 0xE5, 0xF1, 0x00, 0x0A, 0x10, 0x10, 0x09, 0xFF, 
-    0xF9, 0xFE, 0x05, 0x07, 0xFB, 0xEA, 0xDE, 0xDF, 0xEE, 0x01, 0x0D, 0x0A, 
-    0xFB, 0xE6, 0xD8, 0xD5, 0xE0, 0xF0, 0xFB, 0xFE, 0xFA, 0xEF, 0xE9, 0xEA, 
-    0xF4, 0xFF, 0xFC, 0xEF, 0xDE, 0xD4, 0xD7, 0xE7, 0xFC, 0x0C, 0x0C, 0xFC, 
-    0xEB, 0xE1, 0xE2, 0xEB, 0xF6, 0xFF, 0xFE, 0xF8, 0xEE, 0xE9, 0xEE, 0xFA, 
-    0x04, 0xFF, 0xEE, 0xD9, 0xCC, 0xCD, 0xDD, 0xF3, 0x03, 0x01, 0xF2, 0xE1, 
-    0xD7, 0xDA, 0xE6, 0xF2, 0xF7, 0xF7, 0xF1, 0xEA, 0xE7, 0xEC, 0xFB, 0x06, 
-    0x04, 0xF9, 0xEC, 0xE2, 0xE0, 0xE9, 0xF3, 0xF8, 0xF1, 0xE1, 0xD1, 0xC8, 
-    0xCE, 0xDC, 0xE9, 0xEF, 0xEE, 0xE4, 0xDB, 0xD5, 0xDB, 0xEC, 0xFD, 0x03, 
-    0xFB, 0xEE, 0xE5, 0xE3, 0xEE, 0xFF, 0x09, 0x06, 0xF8, 0xE9, 0xE6, 0xF1, 
-    0x03, 0x10, 0x11, 0x07, 0xFA, 0xF0, 0xED, 0xF3, 0x01, 0x0E, 0x0F, 0x05, 
-    0xFA, 0xF0, 0xF2, 0xFF, 0x0E, 0x16, 0x12, 0x03, 0xF2, 0xEB, 0xF5, 0x08, 
-    0x18, 0x1C, 0x16, 0x0B, 0xFE, 0xF8, 0xFC, 0x0A, 0x16, 0x16, 0x0E, 0x02, 
-    0xFC, 0x03, 0x14, 0x27, 0x2E, 0x26, 0x16, 0x07, 0x06, 0x13, 0x27, 0x38, 
-    0x40, 0x3E, 0x35, 0x25, 0x19, 0x19, 0x20, 0x28, 0x24, 0x1A, 0x12, 0x0E, 
-    0x15, 0x24, 0x31, 0x32, 0x24, 0x0D, 0xFA, 0xF2, 0xFA, 0x0A, 0x1B, 0x25, 
-    0x25, 0x1D, 0x0F, 0x03, 0x03, 0x0E, 0x14, 0x0F, 0x07, 0xFF, 0xFF, 0x09, 
-    0x1A, 0x2B, 0x2F, 0x23, 0x0B, 0xF5, 0xEB, 0xEF, 0xFD, 0x06, 0x08, 0x05, 
-    0xFD, 0xF7, 0xF4, 0xFD, 0x0D, 0x14, 0x0C, 0xFB, 0xED, 0xE6, 0xEF, 0x02, 
-    0x17, 0x1E, 0x16, 0x03, 0xF5, 0xF1, 0xF8, 0x03, 0x0C, 0x10, 0x11, 0x10, 
-    0x0B, 0x0A, 0x0F, 0x1A, 0x1B, 0x11, 0x01, 0xF4, 0xF0, 0xF8, 0x0B, 0x1C, 
-    0x20, 0x16, 0x05, 0xF5, 0xEE, 0xF1, 0xFB, 0x04, 0x0B, 0x0A, 0x06, 0xFD, 
-    0xF7, 0xFA, 0x02, 0x04, 0xFB, 0xEC, 0xDA, 0xD6, 0xDB, 0xE9, 0xF9, 0xFE, 
-    0xF7, 0xE8, 0xDA, 0xD8, 0xE0, 0xED, 0xF7, 0xFC, 0xFE, 0xF7, 0xEE, 0xEB, 
-    0xF1, 0xFB, 0xFC, 0xF3, 0xE4, 0xD9, 0xD6, 0xDE, 0xEE, 0xF9, 0xFD, 0xF5, 
-    0xE9, 0xDF, 0xDF, 0xE8, 0xF1, 0xF7, 0xF7, 0xF3, 0xE7, 0xDD, 0xD6, 0xDB, 
-    0xE8, 0xEC, 0xE8, 0xDC, 0xCF, 0xCC, 0xD5, 0xE5, 0xEF, 0xF0, 0xE4, 0xD9, 
-    0xD2, 0xD5, 0xE2, 0xF0, 0xF9, 0xFA, 0xF3, 0xE7, 0xDD, 0xDC, 0xE6, 0xF2, 
-    0xF4, 0xE7, 0xDA, 0xD1, 0xD3, 0xE1, 0xF2, 0x04, 0x09, 0x05, 0xF8, 0xEE, 
-    0xF0, 0xFF, 0x0D, 0x15, 0x14, 0x0B, 0xFF, 0xF4, 0xF1, 0xFB, 0x0A, 0x0D, 
-    0x09, 0xFF, 0xFA, 0xFB, 0x05, 0x11, 0x18, 0x17, 0x0D, 0x01, 0xFA, 0xFE, 
-    0x0E, 0x1E, 0x27, 0x29, 0x23, 0x18, 0x0E, 0x0E, 0x15, 0x1D, 0x18, 0x0C, 
-    0x01, 0xFD, 0x02, 0x0E, 0x1A, 0x1F, 0x19, 0x0C, 0xFC, 0xF1, 0xF3, 0xFE, 
-    0x0F, 0x17, 0x18, 0x11, 0x02, 0xF7, 0xF6, 0xFF, 0x05, 0x04, 0xFA, 0xF4, 
-    0xF2, 0xF9, 0x07, 0x16, 0x21, 0x1D, 0x0F, 0x00, 0xF6, 0xFC, 0x09, 0x17, 
-    0x1F, 0x21, 0x1F, 0x17, 0x14, 0x16, 0x20, 0x25, 0x1F, 0x17, 0x0E, 0x07, 
-    0x0B, 0x17, 0x24, 0x2C, 0x25, 0x14, 0x07, 0x02, 0x09, 0x13, 0x1A, 0x1F, 
-    0x22, 0x20, 0x16, 0x0D, 0x0E, 0x1B, 0x23, 0x1D, 0x10, 0x04, 0xFE, 0x01, 
-    0x0E, 0x1A, 0x1D, 0x16, 0x08, 0xFA, 0xF8, 0x01, 0x0D, 0x16, 0x19, 0x18, 
-    0x13, 0x0C, 0x08, 0x0D, 0x17, 0x1B, 0x14, 0x09, 0x01, 0xFE, 0x04, 0x13, 
-    0x22, 0x29, 0x25, 0x1A, 0x11, 0x12, 0x1C, 0x28, 0x31, 0x35, 0x35, 0x2F, 
-    0x26, 0x20, 0x26, 0x32, 0x37, 0x2D, 0x1F, 0x15, 0x12, 0x1A, 0x26, 0x2F, 
-    0x2E, 0x27, 0x1C, 0x12, 0x0B, 0x0A, 0x0A, 0x0B, 0x08, 0x02, 0xF8, 0xED, 
-    0xEB, 0xF5, 0x04, 0x07, 0x00, 0xF5, 0xF1, 0xF0, 0xF6, 0x00, 0x07, 0x09, 
-    0x01, 0xF9, 0xF2, 0xF4, 0xFC, 0x04, 0x0B, 0x0C, 0x09, 0x02, 0xF9, 0xF6, 
-    0x00, 0x0E, 0x14, 0x0E, 0x05, 0xFF, 0xFB, 0xFF, 0x08, 0x0F, 0x0D, 0x02, 
-    0xF4, 0xED, 0xEF, 0xFB, 0x07, 0x0D, 0x0C, 0x08, 0x00, 0xF6, 0xF3, 0xF9, 
-    0x03, 0x02, 0xFB, 0xF3, 0xF2, 0xF5, 0xFD, 0x07, 0x0D, 0x0B, 0x01, 0xF6, 
-    0xED, 0xEF, 0xF6, 0xFD, 0x02, 0x03, 0x02, 0xFB, 0xEF, 0xE7, 0xE9, 0xF0, 
-    0xEE, 0xE5, 0xDE, 0xDE, 0xE3, 0xEC, 0xF5, 0xFA, 0xF8, 0xEF, 0xE8, 0xE2, 
-    0xE4, 0xEE, 0xF8, 0x00, 0x06, 0x08, 0x07, 0x00, 0xFB, 0xFF, 0x04, 0x04, 
-    0xFD, 0xF7, 0xF4, 0xF7, 0x02, 0x0E, 0x17, 0x14, 0x08, 0xFA, 0xF2, 0xF2, 
-    0xF9, 0x03, 0x0B, 0x0E, 0x0D, 0x06, 0xFA, 0xF5, 0xF8, 0xFD, 0xF6, 0xEA, 
-    0xE0, 0xDB, 0xDD, 0xE5, 0xF1, 0xF8, 0xF7, 0xEC, 0xE1, 0xD9, 0xDA, 0xE4, 
-    0xEF, 0xFA, 0x00, 0x02, 0xFE, 0xF9, 0xF6, 0xFD, 0x01, 0xFC, 0xF5, 0xF1, 
-    0xF3, 0xF7, 0xFE, 0x07, 0x0C, 0x08, 0xFE, 0xF4, 0xED, 0xEF, 0xF5, 0xFC, 
-    0x01, 0x02, 0xFE, 0xF5, 0xEC, 0xEA, 0xF3, 0xF8, 0xF0, 0xE1, 0xD9, 0xD9, 
-    0xDF, 0xEA, 0xF8, 0x00, 0xFE, 0xF6, 0xEC, 0xE8, 0xEC, 0xF5, 0xFD, 0x01, 
-    0x01, 0xFE, 0xF9, 0xF3, 0xF5, 0xFD, 0x03, 0xFE, 0xF3, 0xEB, 0xE8, 0xEB, 
-    0xF3, 0xFC, 0x00, 0xFD, 0xF6, 0xF1, 0xF0, 0xF3, 0xF8, 0xFC, 0xFF, 0x00, 
-    0xFD, 0xF7, 0xF1, 0xF2, 0xFA, 0xFF, 0xFA, 0xF1, 0xEB, 0xE9, 0xEA, 0xF0, 
-    0xF7, 0xF9, 0xF6, 0xEF, 0xEB, 0xEB, 0xF2, 0xFB, 0x02, 0x05, 0x04, 0x00, 
-    0xFA, 0xF6, 0xF8, 0xFE, 0x01, 0xFC, 0xF7, 0xF6, 0xF3, 0xF3, 0xF8, 0xFD, 
-    0xFF, 0xF7, 0xEC, 0xE2, 0xE0, 0xE5, 0xED, 0xF1, 0xF1, 0xED, 0xE3, 0xD7, 
-    0xCF, 0xD0, 0xD8, 0xDE, 0xDD, 0xDA, 0xD9, 0xDA, 0xDE, 0xE7, 0xF0, 0xF2, 
-    0xED, 0xE5, 0xE0, 0xE0, 0xE7, 0xF2, 0xFC, 0x03, 0x05, 0xFF, 0xF5, 0xED, 
-    0xEE, 0xF4, 0xF6, 0xF0, 0xEA, 0xE7, 0xE7, 0xE9, 0xEC, 0xF1, 0xEF, 0xE6, 
-    0xDA, 0xD1, 0xD0, 0xD6, 0xE3, 0xEE, 0xF4, 0xF6, 0xF3, 0xED, 0xE9, 0xEC, 
-    0xF1, 0xEE, 0xE6, 0xDE, 0xDB, 0xDB, 0xE2, 0xEC, 0xF4, 0xF2, 0xE5, 0xD7, 
-    0xCF, 0xD2, 0xDE, 0xEC, 0xF8, 0x01, 0x05, 0x04, 0xFF, 0xFD, 0x02, 0x08, 
-    0x08, 0x01, 0xFD, 0xFF, 0x06, 0x0E, 0x18, 0x1E, 0x1B, 0x11, 0x05, 0xFB, 
-    0xF7, 0xF8, 0xFE, 0x04, 0x0A, 0x0B, 0x09, 0x04, 0x02, 0x06, 0x09, 0x06, 
-    0x00, 0xFF, 0x03, 0x08, 0x0E, 0x17, 0x1F, 0x20, 0x19, 0x0E, 0x06, 0x03, 
-    0x07, 0x0A, 0x0C, 0x0C, 0x0A, 0x06, 0x01, 0xFE, 0x02, 0x05, 0x04, 0xFD, 
-    0xF8, 0xF6, 0xF7, 0xFD, 0x07, 0x12, 0x16, 0x14, 0x0D, 0x0A, 0x0A, 0x0E, 
-    0x15, 0x19, 0x1B, 0x18, 0x11, 0x0A, 0x0A, 0x11, 0x17, 0x15, 0x0C, 0x08, 
-    0x07, 0x07, 0x0A, 0x0F, 0x16, 0x1A, 0x18, 0x14, 0x0F, 0x0E, 0x12, 0x18, 
-    0x1E, 0x20, 0x1B, 0x11, 0x09, 0x08, 0x11, 0x1C, 0x21, 0x22, 0x21, 0x1E, 
-    0x1C, 0x1E, 0x24, 0x27, 0x22, 0x16, 0x0A, 0x04, 0x07, 0x10, 0x17, 0x1C, 
-    0x1B, 0x15, 0x0B, 0x02, 0x01, 0x08, 0x0D, 0x0B, 0x06, 0x02, 0x00, 0x01, 
-    0x05, 0x0B, 0x0E, 0x0B, 0x05, 0x00, 0x00, 0x06, 0x10, 0x1A, 0x1F, 0x1E, 
-    0x16, 0x0C, 0x06, 0x0B, 0x15, 0x1D, 0x1F, 0x20, 0x21, 0x22, 0x22, 0x23, 
-    0x29, 0x2D, 0x2E, 0x28, 0x21, 0x1E, 0x22, 0x2A, 0x32, 0x36, 0x34, 0x29, 
-    0x1B, 0x10, 0x0D, 0x0F, 0x0E, 0x08, 0x00, 0xFB, 0xF9, 0xF8, 0xF8, 0xF6, 
-    0xF1, 0xE8, 0xDE, 0xD9, 0xDB, 0xE4, 0xF0, 0xFD, 0x09, 0x0F, 0x0E, 0x08, 
-    0x01, 0x02, 0x06, 0x09, 0x08, 0x07, 0x09, 0x0B, 0x0E, 0x12, 0x18, 0x18, 
-    0x11, 0x05, 0xF9, 0xF2, 0xF3, 0xFA, 0x02, 0x09, 0x0B, 0x05, 0xFA, 0xF0, 
-    0xEC, 0xEC, 0xEB, 0xE7, 0xE4, 0xE5, 0xE8, 0xED, 0xF5, 0xFD, 0x02, 0x01, 
-    0xFA, 0xF2, 0xEE, 0xEF, 0xF5, 0xFC, 0x01, 0x02, 0xFB, 0xF3, 0xEE, 0xF3, 
-    0xFA, 0xFB, 0xF9, 0xF6, 0xF6, 0xF9, 0xFD, 0x04, 0x0B, 0x0E, 0x0C, 0x06, 
-    0xFD, 0xF8, 0xF8, 0xFD, 0x03, 0x07, 0x05, 0xFF, 0xF7, 0xF2, 0xF6, 0xFC, 
-    0xFB, 0xF6, 0xF0, 0xEC, 0xEA, 0xEC, 0xF3, 0xFA, 0xFD, 0xFA, 0xF4, 0xF0, 
-    0xF3, 0xFC, 0x06, 0x0E, 0x11, 0x11, 0x0B, 0x04, 0x03, 0x09, 0x0F, 0x10, 
-    0x0E, 0x0B, 0x0A, 0x09, 0x08, 0x09, 0x08, 0x05, 0xFE, 0xF6, 0xEE, 0xED, 
-    0xEF, 0xF1, 0xF2, 0xF0, 0xEA, 0xDF, 0xD3, 0xCF, 0xD5, 0xDD, 0xDF, 0xE0, 
-    0xDF, 0xE1, 0xE4, 0xE7, 0xEB, 0xF0, 0xF1, 0xF0, 0xEE, 0xEE, 0xF3, 0xFC, 
-    0x02, 0x05, 0x04, 0xFE, 0xF6, 0xED, 0xEE, 0xF5, 0xFA, 0xFA, 0xF6, 0xF4, 
-    0xF6, 0xF7, 0xF8, 0xF7, 0xF5, 0xF1, 0xED, 0xE8, 0xE6, 0xEA, 0xF3, 0xFD, 
-    0x05, 0x08, 0x04, 0xFB, 0xF1, 0xED, 0xF1, 0xF4, 0xF1, 0xED, 0xEC, 0xEC, 
-    0xEB, 0xE9, 0xE8, 0xEA, 0xEB, 0xEC, 0xEC, 0xEF, 0xF7, 0x02, 0x0D, 0x15, 
-    0x17, 0x15, 0x0B, 0x00, 0xFE, 0x02, 0x04, 0x02, 0x00, 0x02, 0x05, 0x07, 
-    0x08, 0x08, 0x07, 0x02, 0xF9, 0xF0, 0xEB, 0xEB, 0xF0, 0xF6, 0xFB, 0xFB, 
-    0xF5, 0xE8, 0xDD, 0xDA, 0xE1, 0xE7, 0xE7, 0xE5, 0xE3, 0xE6, 0xEB, 0xF0, 
-    0xF6, 0xF8, 0xF6, 0xF1, 0xEA, 0xE6, 0xE9, 0xEE, 0xF3, 0xF6, 0xF7, 0xF3, 
-    0xEB, 0xE3, 0xE4, 0xEA, 0xED, 0xEA, 0xE4, 0xE2, 0xE3, 0xE7, 0xED, 0xF3, 
-    0xF7, 0xF5, 0xF0, 0xE8, 0xE6, 0xEB, 0xF3, 0xFA, 0xFE, 0xFE, 0xFA, 0xF4, 
-    0xEE, 0xEF, 0xF2, 0xF0, 0xEA, 0xE4, 0xE3, 0xE4, 0xE4, 0xE4, 0xE6, 0xE7, 
-    0xE7, 0xE4, 0xE0, 0xE0, 0xE7, 0xF1, 0xF8, 0xFB, 0xFB, 0xF6, 0xF0, 0xEE, 
-    0xF3, 0xFB, 0xFD, 0xF9, 0xF4, 0xF4, 0xF6, 0xF6, 0xF5, 0xF3, 0xF1, 0xEC, 
-    0xE6, 0xDF, 0xDD, 0xDF, 0xE5, 0xEA, 0xEE, 0xEE, 0xE9, 0xE0, 0xDA, 0xDE, 
-    0xE7, 0xEB, 0xE9, 0xE6, 0xE6, 0xEA, 0xF0, 0xF3, 0xF5, 0xF6, 0xF4, 0xF4, 
-    0xF3, 0xF6, 0xFB, 0x00, 0x06, 0x0B, 0x0D, 0x0B, 0x05, 0x00, 0x04, 0x09, 
-    0x0A, 0x08, 0x05, 0x07, 0x0B, 0x0C, 0x0C, 0x0B, 0x09, 0x07, 0x04, 0x01, 
-    0x02, 0x08, 0x10, 0x17, 0x1A, 0x18, 0x11, 0x07, 0x00, 0x02, 0x06, 0x05, 
-    0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0xFE, 0xFC, 0xFF, 
-    0x09, 0x14, 0x1C, 0x20, 0x1E, 0x17, 0x0D, 0x09, 0x0E, 0x14, 0x16, 0x17, 
-    0x18, 0x1C, 0x1E, 0x1D, 0x1B, 0x17, 0x12, 0x0D, 0x07, 0x03, 0x03, 0x08, 
-    0x0F, 0x14, 0x16, 0x12, 0x08, 0xFD, 0xF8, 0xFE, 0x05, 0x06, 0x04, 0x05, 
-    0x0A, 0x11, 0x15, 0x17, 0x14, 0x0F, 0x09, 0x04, 0x01, 0x02, 0x09, 0x13, 
-    0x1B, 0x1F, 0x1F, 0x19, 0x12, 0x10, 0x15, 0x18, 0x16, 0x13, 0x15, 0x1D, 
-    0x25, 0x27, 0x26, 0x22, 0x1E, 0x1A, 0x15, 0x13, 0x13, 0x19, 0x20, 0x24, 
-    0x23, 0x1C, 0x11, 0x05, 0x01, 0x03, 0x05, 0x01, 0xFC, 0xFD, 0x02, 0x09, 
-    0x0D, 0x10, 0x11, 0x12, 0x13, 0x14, 0x16, 0x1B, 0x24, 0x2C, 0x34, 0x39, 
-    0x3C, 0x38, 0x32, 0x32, 0x37, 0x38, 0x36, 0x32, 0x31, 0x35, 0x37, 0x35, 
-    0x2E, 0x25, 0x1A, 0x10, 0x09, 0x04, 0x03, 0x02, 0x01, 0xFF, 0xFA, 0xF3, 
-    0xE8, 0xDE, 0xDC, 0xE1, 0xE2, 0xDF, 0xDD, 0xE0, 0xE8, 0xED, 0xED, 0xEC, 
-    0xED, 0xF0, 0xF2, 0xF2, 0xF3, 0xF5, 0xFB, 0x03, 0x0C, 0x11, 0x11, 0x0A, 
-    0x03, 0x05, 0x0B, 0x0C, 0x08, 0x04, 0x05, 0x0B, 0x0D, 0x0B, 0x09, 0x06, 
-    0x03, 0xFF, 0xFD, 0xFD, 0xFF, 0x04, 0x06, 0x06, 0x04, 0xFC, 0xF0, 0xE6, 
-    0xE7, 0xED, 0xF0, 0xED, 0xEB, 0xED, 0xF2, 0xF7, 0xFB, 0xFE, 0xFE, 0xFD, 
-    0xFD, 0xFF, 0x04, 0x0C, 0x13, 0x17, 0x18, 0x18, 0x14, 0x0C, 0x07, 0x08, 
-    0x0C, 0x0A, 0x05, 0x02, 0x04, 0x08, 0x07, 0x01, 0xFB, 0xF4, 0xED, 0xE8, 
-    0xE5, 0xE6, 0xEA, 0xEF, 0xF3, 0xF4, 0xF1, 0xEA, 0xE1, 0xDE, 0xE4, 0xEC, 
-    0xEC, 0xE9, 0xEA, 0xF4, 0x01, 0x08, 0x08, 0x05, 0x00, 0xFB, 0xF8, 0xF6, 
-    0xF6, 0xFA, 0xFF, 0x02, 0x03, 0x02, 0xFE, 0xF6, 0xF3, 0xF6, 0xF8, 0xF5, 
-    0xF1, 0xF3, 0xFB, 0x02, 0x04, 0x00, 0xFA, 0xF5, 0xEF, 0xEB, 0xEA, 0xEC, 
-    0xF1, 0xF6, 0xF9, 0xFA, 0xF8, 0xF5, 0xEE, 0xED, 0xF0, 0xF0, 0xEA, 0xE2, 
-    0xE2, 0xE9, 0xF4, 0xFA, 0xFB, 0xF9, 0xF5, 0xF4, 0xF7, 0xFA, 0xFF, 0x03, 
-    0x08, 0x0C, 0x10, 0x12, 0x0E, 0x05, 0x00, 0xFF, 0xFD, 0xF7, 0xF2, 0xF3, 
-    0xF9, 0x01, 0x01, 0xFB, 0xF6, 0xF1, 0xF0, 0xEF, 0xF0, 0xF0, 0xF1, 0xF4, 
-    0xF6, 0xF7, 0xF5, 0xEF, 0xE9, 0xEB, 0xEF, 0xF1, 0xED, 0xE9, 0xED, 0xF6, 
-    0xFF, 0x03, 0x02, 0xFF, 0xFC, 0xF8, 0xF4, 0xF2, 0xF2, 0xF5, 0xF9, 0xFC, 
-    0xFD, 0xFC, 0xF8, 0xF4, 0xF6, 0xF9, 0xF9, 0xF4, 0xF1, 0xF6, 0x00, 0x08, 
-    0x08, 0x03, 0xFD, 0xF8, 0xF6, 0xF7, 0xF8, 0xFA, 0xFB, 0xFD, 0xFD, 0xFB, 
-    0xF7, 0xEF, 0xE8, 0xE8, 0xEB, 0xE9, 0xE1, 0xDB, 0xDC, 0xE4, 0xED, 0xF0, 
-    0xED, 0xE9, 0xE5, 0xE6, 0xE9, 0xED, 0xF0, 0xF4, 0xF8, 0xFB, 0xFD, 0xFD, 
-    0xF8, 0xF3, 0xF5, 0xFA, 0xFB, 0xF7, 0xF5, 0xFA, 0x02, 0x0A, 0x09, 0x02, 
-    0xF7, 0xEF, 0xEA, 0xE9, 0xEA, 0xEA, 0xEA, 0xE8, 0xE6, 0xE3, 0xDF, 0xD9, 
-    0xD5, 0xD9, 0xDE, 0xDD, 0xDA, 0xD9, 0xDF, 0xE9, 0xF0, 0xF0, 0xE8, 0xE0, 
-    0xD9, 0xD7, 0xD9, 0xDD, 0xE3, 0xE8, 0xEB, 0xED, 0xEF, 0xEF, 0xED, 0xED, 
-    0xF1, 0xF4, 0xF3, 0xF1, 0xF5, 0xFC, 0x05, 0x08, 0x03, 0xFB, 0xF3, 0xED, 
-    0xEC, 0xEF, 0xF3, 0xF7, 0xF9, 0xFB, 0xFC, 0xFB, 0xF8, 0xF0, 0xEB, 0xEC, 
-    0xED, 0xEB, 0xE9, 0xEB, 0xF2, 0xFD, 0x05, 0x06, 0x04, 0xFE, 0xFB, 0xFE, 
-    0x06, 0x0F, 0x17, 0x1E, 0x23, 0x28, 0x29, 0x26, 0x1F, 0x1B, 0x1D, 0x1D, 
-    0x1B, 0x17, 0x18, 0x1E, 0x24, 0x25, 0x1F, 0x14, 0x09, 0xFF, 0xFA, 0xF7, 
-    0xF5, 0xF4, 0xF4, 0xF5, 0xF3, 0xF0, 0xEC, 0xE7, 0xE8, 0xEC, 0xEC, 0xE9, 
-    0xE7, 0xEC, 0xF7, 0x04, 0x0C, 0x0D, 0x0A, 0x04, 0xFF, 0xFE, 0x02, 0x08, 
-    0x0E, 0x12, 0x16, 0x18, 0x18, 0x15, 0x11, 0x12, 0x16, 0x18, 0x15, 0x12, 
-    0x14, 0x1B, 0x25, 0x2B, 0x29, 0x23, 0x1C, 0x16, 0x16, 0x18, 0x1B, 0x1A, 
-    0x16, 0x13, 0x0F, 0x0C, 0x09, 0x06, 0x08, 0x0D, 0x0A, 0x03, 0xFF, 0x03, 
-    0x0F, 0x1B, 0x22, 0x22, 0x1E, 0x1B, 0x19, 0x1C, 0x21, 0x28, 0x2C, 0x2E, 
-    0x2D, 0x2C, 0x28, 0x23, 0x20, 0x20, 0x22, 0x1E, 0x18, 0x16, 0x1A, 0x21, 
-    0x27, 0x24, 0x1C, 0x13, 0x0A, 0x05, 0x03, 0x02, 0x03, 0x00, 0xFD, 0xFD, 
-    0xFE, 0xFD, 0xFA, 0xFA, 0xFF, 0x05, 0x07, 0x04, 0x03, 0x08, 0x13, 0x1F, 
-    0x25, 0x24, 0x1F, 0x19, 0x17, 0x19, 0x1D, 0x22, 0x26, 0x29, 0x2C, 0x2D, 
-    0x2A, 0x25, 0x20, 0x21, 0x23, 0x1F, 0x17, 0x12, 0x14, 0x1A, 0x1E, 0x1C, 
-    0x14, 0x0B, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0x02, 0x01, 0x00, 0xFE, 0xFA, 
-    0xF5, 0xF0, 0xF1, 0xF1, 0xEC, 0xE6, 0xE2, 0xE5, 0xEE, 0xF8, 0xFE, 0xFE, 
-    0xF9, 0xF6, 0xF6, 0xFC, 0x04, 0x0C, 0x11, 0x12, 0x13, 0x14, 0x11, 0x0B, 
-    0x07, 0x07, 0x09, 0x06, 0x02, 0x02, 0x06, 0x0D, 0x13, 0x12, 0x0B, 0x02, 
-    0xFA, 0xF6, 0xF4, 0xF5, 0xF9, 0xFD, 0x00, 0x01, 0xFF, 0xFC, 0xF7, 0xF6, 
-    0xF9, 0xF9, 0xF2, 0xEB, 0xEA, 0xF2, 0xFD, 0x04, 0x03, 0xFB, 0xF3, 0xED, 
-    0xEB, 0xEC, 0xEF, 0xF3, 0xF7, 0xFA, 0xFC, 0xFC, 0xFA, 0xF4, 0xF2, 0xF5, 
-    0xF8, 0xF6, 0xF2, 0xF1, 0xF6, 0xFF, 0x08, 0x09, 0x04, 0xFC, 0xF7, 0xF6, 
-    0xF9, 0xFD, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFD, 0xF7, 0xF4, 0xF4, 0xF3, 
-    0xEF, 0xEB, 0xEC, 0xF4, 0xFF, 0x08, 0x08, 0x02, 0xF9, 0xF3, 0xF2, 0xF4, 
-    0xFA, 0xFF, 0x01, 0xFF, 0xFD, 0xFB, 0xF9, 0xF8, 0xFA, 0xFC, 0xF8, 0xF2, 
-    0xEE, 0xF2, 0xFA, 0x01, 0x03, 0xFC, 0xF3, 0xEC, 0xE9, 0xEA, 0xEB, 0xEC, 
-    0xEC, 0xEB, 0xEC, 0xF1, 0xF6, 0xF9, 0xF8, 0xF8, 0xF6, 0xEF, 0xE8, 0xE4, 
-    0xE7, 0xF0, 0xF9, 0xFD, 0xF9, 0xF0, 0xE9, 0xE6, 0xE8, 0xEB, 0xED, 0xED, 
-    0xEC, 0xEC, 0xF0, 0xF6, 0xF9, 0xFA, 0xFB, 0xFD, 0xFE, 0xFB, 0xF8, 0xFA, 
-    0x02, 0x0E, 0x16, 0x13, 0x0A, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFD, 
-    0xFD, 0x01, 0x01, 0xFD, 0xF8, 0xF6, 0xF6, 0xF3, 0xEB, 0xE7, 0xEC, 0xF8, 
-    0x05, 0x0C, 0x06, 0xFE, 0xF9, 0xF9, 0xFD, 0x01, 0x05, 0x07, 0x07, 0x07, 
-    0x09, 0x08, 0x05, 0x02, 0x02, 0x01, 0xFE, 0xF9, 0xF5, 0xF7, 0xFC, 0x03, 
-    0x08, 0x06, 0xFD, 0xF3, 0xEE, 0xEC, 0xEE, 0xEF, 0xEC, 0xE8, 0xE4, 0xE4, 
-    0xE3, 0xDE, 0xD9, 0xD6, 0xD2, 0xCC, 0xC6, 0xC5, 0xCA, 0xD3, 0xDE, 0xE3, 
-    0xE0, 0xD9, 0xD2, 0xD0, 0xD4, 0xDB, 0xE4, 0xEB, 0xEF, 0xF1, 0xF2, 0xF4, 
-    0xF2, 0xF5, 0xFC, 0x01, 0xFE, 0xF7, 0xF3, 0xF9, 0x03, 0x0C, 0x0E, 0x07, 
-    0xFD, 0xF4, 0xF0, 0xF2, 0xF5, 0xF9, 0xF8, 0xF5, 0xF3, 0xF3, 0xF3, 0xEE, 
-    0xEA, 0xE9, 0xE7, 0xE3, 0xDF, 0xE1, 0xE8, 0xF1, 0xF9, 0xFB, 0xF7, 0xF3, 
-    0xF0, 0xF0, 0xF1, 0xF5, 0xF9, 0xFC, 0xFB, 0xFA, 0xF9, 0xF8, 0xF4, 0xF2, 
-    0xF0, 0xEE, 0xE9, 0xE5, 0xE7, 0xED, 0xF6, 0xFE, 0xFF, 0xF9, 0xF1, 0xEA, 
-    0xE7, 0xE7, 0xEA, 0xEF, 0xF1, 0xF0, 0xF0, 0xEF, 0xEE, 0xEC, 0xEC, 0xEF, 
-    0xEE, 0xEA, 0xE8, 0xED, 0xF7, 0x02, 0x0A, 0x0B, 0x05, 0xFD, 0xF9, 0xFA, 
-    0xFF, 0x06, 0x0E, 0x12, 0x14, 0x16, 0x19, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 
-    0x14, 0x0E, 0x0D, 0x10, 0x17, 0x1B, 0x1A, 0x14, 0x0C, 0x04, 0x00, 0x01, 
-    0x02, 0x03, 0x00, 0x00, 0x03, 0x07, 0x09, 0x06, 0x06, 0x08, 0x05, 0xFF, 
-    0xFB, 0xFD, 0x07, 0x15, 0x20, 0x21, 0x1D, 0x15, 0x11, 0x10, 0x15, 0x19, 
-    0x1D, 0x1E, 0x1D, 0x1E, 0x20, 0x23, 0x21, 0x20, 0x1B, 0x16, 0x12, 0x13, 
-    0x14, 0x1F, 0x21, 0x2A, 0x2B, 0x0A, 0x05, 0xF3, 0xD8, 0xE5, 0xED, 0xF8, 
-    0x07, 0x0E, 0x14, 0x26, 0x29, 0x1F, 0x22, 0x1B, 0x1C, 0x0D, 0x0A, 0x12, 
-    0x15, 0x34, 0x3B, 0x4A, 0x54, 0x32, 0x24, 0x23, 0x33, 0x36, 0x33, 0x2F, 
-    0x21, 0x1C, 0x1B, 0x1E, 0x1D, 0x21, 0x1F, 0x1D, 0x18, 0x11, 0x12, 0x13, 
-    0x18, 0x17, 0x1C, 0x0D, 0xF8, 0xEE, 0xE5, 0xF6, 0x04, 0x0C, 0x16, 0x18, 
-    0x17, 0x16, 0x11, 0x0D, 0x08, 0x08, 0x0B, 0x04, 0x07, 0x15, 0x1D, 0x26, 
-    0x31, 0x2A, 0x20, 0x16, 0x0C, 0x17, 0x1E, 0x22, 0x1A, 0x10, 0x17, 0x10, 
-    0x11, 0x10, 0x14, 0x14, 0x12, 0x14, 0x15, 0x1B, 0x13, 0x1C, 0x27, 0x25, 
-    0x23, 0x13, 0x04, 0xF6, 0xF2, 0xF1, 0xEE, 0xED, 0xEE, 0xF5, 0xF4, 0xF7, 
-    0xF5, 0xF5, 0xF3, 0xEF, 0xE7, 0xE1, 0xDF, 0xE2, 0xEB, 0xF8, 0xFD, 0xEF, 
-    0xEB, 0xE1, 0xE7, 0xF0, 0xED, 0xEC, 0xEA, 0xF0, 0xF4, 0xF6, 0xF8, 0xFB, 
-    0xFB, 0xFF, 0xF5, 0xEC, 0xDF, 0xD7, 0xDA, 0xEE, 0x01, 0x09, 0x07, 0xFB, 
-    0xF7, 0xF4, 0xFB, 0xFF, 0x04, 0x02, 0xFC, 0xFE, 0x02, 0x07, 0x07, 0x04, 
-    0x01, 0xFB, 0xF8, 0xEE, 0xED, 0xF5, 0xFB, 0x00, 0x00, 0xFD, 0xF2, 0xEF, 
-    0xED, 0xF1, 0xFA, 0xF6, 0xF3, 0xF1, 0xF0, 0xF8, 0xF6, 0x00, 0x01, 0xFD, 
-    0xFB, 0xEC, 0xE2, 0xDE, 0xE4, 0xE6, 0xF3, 0xF5, 0xEF, 0xE8, 0xDD, 0xE0, 
-    0xE1, 0xE3, 0xE1, 0xDC, 0xDC, 0xD9, 0xD8, 0xD9, 0xD6, 0xD5, 0xD7, 0xCC, 
-    0xC0, 0xC1, 0xC4, 0xCD, 0xCA, 0xBD, 0xBE, 0xC8, 0xCF, 0xD1, 0xD8, 0xE0, 
-    0xDB, 0xD9, 0xD4, 0xD6, 0xDB, 0xE3, 0xFA, 0x02, 0x06, 0xFE, 0x08, 0x11, 
-    0x0C, 0x11, 0x1B, 0x25, 0x28, 0x2E, 0x24, 0x18, 0x10, 0x0C, 0x10, 0x0E, 
-    0x10, 0x11, 0x10, 0x10, 0x16, 0x0A, 0x0C, 0x04, 0x03, 0x04, 0xF1, 0xE3, 
-    0xE7, 0x00, 0x01, 0x03, 0xFD, 0x02, 0x07, 0x0F, 0x17, 0x25, 0x1C, 0x0D, 
-    0x1B, 0x0E, 0x0B, 0x13, 0x1C, 0x2D, 0x21, 0x18, 0x14, 0x09, 0x04, 0x02, 
-    0x03, 0x15, 0x22, 0x1B, 0x16, 0x07, 0x04, 0x04, 0x0D, 0x0D, 0x11, 0x09, 
-    0x05, 0x02, 0x02, 0x02, 0x01, 0x08, 0xF9, 0xFD, 0x00, 0x05, 0x11, 0x10, 
-    0x0F, 0x1D, 0x1D, 0x14, 0x10, 0x0C, 0x11, 0x0C, 0xFF, 0xFA, 0xFF, 0xFE, 
-    0xF8, 0x00, 0x0C, 0x14, 0x12, 0x19, 0x06, 0xFF, 0x03, 0x04, 0x1A, 0x1D, 
-    0x2C, 0x19, 0x08, 0xFB, 0xFB, 0x02, 0x0A, 0x14, 0x0F, 0x0A, 0x0E, 0x14, 
-    0x10, 0x1A, 0x20, 0x16, 0x06, 0x0F, 0x11, 0x03, 0x02, 0x0E, 0x0D, 0x0D, 
-    0x0C, 0x0E, 0x0C, 0x0D, 0x1B, 0x1D, 0x1A, 0x1D, 0x19, 0x14, 0x1C, 0x1F, 
-    0x14, 0x13, 0x21, 0x0C, 0xFA, 0xF1, 0xF6, 0x05, 0x0B, 0x11, 0x11, 0x04, 
-    0xF8, 0xF1, 0xEF, 0xF8, 0xF8, 0xF5, 0xEE, 0xE3, 0xE3, 0xE6, 0xEC, 0xE5, 
-    0xDD, 0xE0, 0xDE, 0xD3, 0xCD, 0xD0, 0xCB, 0xD5, 0xDE, 0xE8, 0xE6, 0xDB, 
-    0xD7, 0xDA, 0xF2, 0xF9, 0xE8, 0xE7, 0xE2, 0xED, 0xEF, 0xEF, 0xF6, 0xF9, 
-    0xF9, 0xED, 0xF3, 0xE8, 0xEE, 0xFE, 0x03, 0xF7, 0xFA, 0xFB, 0xF0, 0xEB, 
-    0xEC, 0xFA, 0x03, 0xF9, 0xF7, 0xFC, 0xF3, 0xF8, 0xF8, 0xF7, 0x03, 0x02, 
-    0xEC, 0xEB, 0xEA, 0xEC, 0xF3, 0xFD, 0x01, 0xFC, 0xF9, 0xFB, 0xF8, 0xED, 
-    0xF3, 0xFD, 0xFB, 0xEC, 0xE0, 0xDA, 0xE6, 0xE4, 0xE6, 0xE0, 0xDB, 0xDB, 
-    0xD3, 0xD6, 0xD2, 0xD5, 0xDD, 0xE9, 0xEA, 0xD9, 0xC8, 0xD4, 0xDF, 0xE5, 
-    0xF2, 0xE8, 0xE9, 0xE9, 0xF2, 0x00, 0x07, 0x0E, 0x0D, 0x19, 0x0E, 0x0E, 
-    0xFD, 0xF7, 0x00, 0x00, 0xFE, 0xF5, 0xF0, 0xE3, 0xE6, 0xF3, 0xFB, 0xFA, 
-    0x08, 0xFC, 0xF4, 0xF7, 0xF2, 0xFB, 0x02, 0x01, 0xF8, 0xF6, 0xFB, 0xF6, 
-    0xFF, 0x0F, 0x1E, 0x31, 0x2C, 0x22, 0x1F, 0x21, 0x27, 0x30, 0x30, 0x26, 
-    0x23, 0x1C, 0x18, 0x19, 0x17, 0x23, 0x22, 0x21, 0x15, 0x0D, 0x0F, 0x13, 
-    0x1E, 0x25, 0x21, 0x1F, 0x1C, 0x0C, 0x1B, 0x21, 0x23, 0x1D, 0x21, 0x1C, 
-    0x0F, 0x18, 0x16, 0x16, 0x24, 0x2B, 0x26, 0x1F, 0x05, 0x06, 0x17, 0x1C, 
-    0x27, 0x1B, 0x0F, 0x08, 0x03, 0xFC, 0xF3, 0xFE, 0xFD, 0x04, 0xFC, 0xF3, 
-    0xED, 0xF1, 0xFA, 0xFD, 0x04, 0xF9, 0xF2, 0xE1, 0xE3, 0xED, 0xF5, 0xFC, 
-    0xF5, 0xF5, 0xEC, 0xE9, 0xF8, 0x02, 0x0D, 0x0A, 0x09, 0x05, 0x03, 0x0A, 
-    0x0F, 0x18, 0x1A, 0x19, 0x17, 0x11, 0x02, 0xFD, 0x04, 0x1F, 0x27, 0x28, 
-    0x26, 0x20, 0x17, 0x12, 0x1C, 0x19, 0x15, 0x0F, 0x02, 0xFB, 0x02, 0x08, 
-    0x0C, 0x0B, 0x11, 0x10, 0x06, 0xF6, 0xF3, 0x02, 0x0E, 0x15, 0x08, 0xFB, 
-    0xF5, 0xF6, 0xF8, 0x00, 0x04, 0x05, 0xF3, 0xE8, 0xEB, 0xEC, 0xEF, 0xF6, 
-    0xFE, 0xFC, 0xEF, 0xE2, 0xDF, 0xDD, 0xE7, 0xEC, 0xFB, 0xF3, 0xEF, 0xEA, 
-    0xE1, 0xE8, 0xE7, 0xED, 0xED, 0xE1, 0xD6, 0xD1, 0xD2, 0xDA, 0xDE, 0xE1, 
-    0xE6, 0xDA, 0xD1, 0xD6, 0xCF, 0xDE, 0xE9, 0xEA, 0xEA, 0xDF, 0xE1, 0xDF, 
-    0xEA, 0xF7, 0xFB, 0xFB, 0xF7, 0xF4, 0xF0, 0xFA, 0xFD, 0x00, 0xFC, 0xFF, 
-    0xFD, 0xEA, 0xE5, 0xE5, 0xEB, 0xF7, 0xF9, 0xEB, 0xDE, 0xD0, 0xD5, 0xE2, 
-    0xF0, 0xF0, 0xEA, 0xDE, 0xD9, 0xE3, 0xEA, 0xEC, 0xE8, 0xF2, 0xF5, 0xEA, 
-    0xE8, 0xE5, 0xE2, 0xED, 0xFC, 0xFE, 0xF5, 0xF9, 0xF6, 0xF5, 0x01, 0x1C, 
-    0x24, 0x23, 0x1F, 0x12, 0x19, 0x16, 0x15, 0x14, 0x10, 0x0B, 0xFA, 0xEF, 
-    0xDC, 0xE4, 0xF5, 0xF9, 0xF6, 0xEF, 0xF5, 0xE9, 0xEA, 0xF0, 0xF0, 0xFA, 
-    0xEF, 0xEF, 0xF0, 0xE4, 0xF4, 0xF9, 0x04, 0x0C, 0x01, 0xFF, 0xFF, 0x02, 
-    0x0B, 0x1E, 0x26, 0x22, 0x18, 0x12, 0x0A, 0x0B, 0x0F, 0x15, 0x17, 0x13, 
-    0x13, 0x05, 0x0A, 0x10, 0x13, 0x15, 0x17, 0x14, 0x0B, 0x01, 0xFE, 0x0E, 
-    0x16, 0x1B, 0x1B, 0x13, 0x0A, 0x07, 0x06, 0x11, 0x21, 0x27, 0x2B, 0x23, 
-    0x19, 0x1E, 0x28, 0x34, 0x38, 0x31, 0x2D, 0x20, 0x16, 0x0D, 0x0F, 0x13, 
-    0x16, 0x1E, 0x10, 0x06, 0xFC, 0xFE, 0x06, 0x12, 0x0E, 0x06, 0x01, 0xF9, 
-    0xFC, 0xFB, 0x04, 0x0A, 0x09, 0xFE, 0xFD, 0xF4, 0xF2, 0xFD, 0x05, 0x08, 
-    0x00, 0x02, 0xFD, 0xF8, 0xF4, 0xFC, 0x0C, 0x0B, 0x06, 0xF7, 0xF0, 0xF4, 
-    0xFF, 0x09, 0x10, 0x13, 0x04, 0xFD, 0xFF, 0xFC, 0x05, 0x0C, 0x07, 0x06, 
-    0xFC, 0xF2, 0xEB, 0xED, 0xFA, 0x05, 0x13, 0x11, 0x01, 0xF9, 0xF6, 0x00, 
-    0x0B, 0x10, 0x0F, 0x02, 0xFA, 0xF4, 0xF3, 0xF9, 0x01, 0x04, 0xFB, 0xF0, 
-    0xEC, 0xED, 0xF1, 0xF9, 0x00, 0x02, 0xFD, 0xF4, 0xEF, 0xF1, 0xF7, 0x01, 
-    0x06, 0x04, 0xF6, 0xEE, 0xF1, 0xEF, 0xF3, 0xF5, 0xFD, 0x03, 0xFB, 0xEE, 
-    0xE0, 0xE3, 0xF2, 0x00, 0xF9, 0xF0, 0xDE, 0xD9, 0xE2, 0xE7, 0xE9, 0xE8, 
-    0xE9, 0xE0, 0xE0, 0xE0, 0xE6, 0xF4, 0xFF, 0xFE, 0xF8, 0xF1, 0xEB, 0xE5, 
-    0xEA, 0xF7, 0xFA, 0xF1, 0xE5, 0xE2, 0xD4, 0xD5, 0xE0, 0xE0, 0xDE, 0xDD, 
-    0xD3, 0xC6, 0xC0, 0xC8, 0xD8, 0xE0, 0xE0, 0xDC, 0xDA, 0xCC, 0xCC, 0xDA, 
-    0xE6, 0xF2, 0xF5, 0xF6, 0xF3, 0xE9, 0xEE, 0xF6, 0xFB, 0xFD, 0xF8, 0xF8, 
-    0xF3, 0xF6, 0xF8, 0x07, 0x13, 0x14, 0x13, 0x13, 0x0B, 0x0E, 0x16, 0x15, 
-    0x16, 0x11, 0x09, 0xFC, 0xF9, 0xF8, 0x01, 0x01, 0x04, 0x02, 0xF0, 0xE9, 
-    0xEB, 0xEF, 0xFD, 0x05, 0x06, 0x03, 0xFC, 0xFC, 0xFF, 0x0E, 0x1B, 0x1E, 
-    0x1C, 0x1B, 0x14, 0x18, 0x1E, 0x1E, 0x2D, 0x31, 0x28, 0x1E, 0x13, 0x0F, 
-    0x13, 0x18, 0x17, 0x16, 0x0E, 0x06, 0x00, 0xFC, 0x03, 0x0B, 0x0C, 0x06, 
-    0xFA, 0xF4, 0xF6, 0xFA, 0x02, 0x0D, 0x10, 0x0B, 0xFE, 0xFC, 0x02, 0x08, 
-    0x16, 0x1D, 0x1F, 0x1D, 0x16, 0x17, 0x1F, 0x2B, 0x37, 0x35, 0x32, 0x2A, 
-    0x25, 0x25, 0x21, 0x22, 0x1F, 0x1C, 0x14, 0x0B, 0x05, 0x03, 0x03, 0x08, 
-    0x06, 0x00, 0xFC, 0xF7, 0xF4, 0xF6, 0xFB, 0x06, 0x0F, 0x08, 0xFF, 0xF8, 
-    0xFD, 0xFF, 0x07, 0x10, 0x0E, 0x08, 0xF8, 0xF9, 0x01, 0x0B, 0x0F, 0x11, 
-    0x10, 0x0D, 0x08, 0x09, 0x11, 0x1A, 0x28, 0x29, 0x21, 0x1D, 0x17, 0x11, 
-    0x12, 0x10, 0x10, 0x10, 0x0E, 0x03, 0xF6, 0xF7, 0x02, 0x08, 0x08, 0x08, 
-    0xF7, 0xEF, 0xF0, 0xF5, 0x02, 0x04, 0x04, 0xFD, 0xF3, 0xF0, 0xF0, 0xF7, 
-    0xFC, 0xFA, 0xF2, 0xEB, 0xE7, 0xE4, 0xE9, 0xF3, 0xF8, 0xF8, 0xF4, 0xEB, 
-    0xE5, 0xDF, 0xE5, 0xF2, 0xFB, 0xFB, 0xF8, 0xEF, 0xEA, 0xF0, 0xF5, 0xFC, 
-    0xFD, 0xFC, 0xF2, 0xED, 0xEA, 0xF0, 0xF8, 0xFB, 0xFC, 0xF7, 0xF1, 0xE5, 
-    0xE0, 0xE6, 0xEF, 0xF2, 0xF1, 0xEF, 0xE9, 0xE7, 0xF1, 0xFD, 0x00, 0x00, 
-    0xFA, 0xF1, 0xEF, 0xF3, 0xF8, 0xFE, 0x06, 0x06, 0x01, 0xF7, 0xF1, 0xEF, 
-    0xF6, 0xFF, 0x00, 0xFB, 0xED, 0xE5, 0xE0, 0xE2, 0xE8, 0xE8, 0xE7, 0xE2, 
-    0xDA, 0xD3, 0xD2, 0xD8, 0xDF, 0xE6, 0xEA, 0xEB, 0xE4, 0xDC, 0xE2, 0xE7, 
-    0xEE, 0xF5, 0xF1, 0xEA, 0xE6, 0xE4, 0xEB, 0xF2, 0xF7, 0xF6, 0xF5, 0xF6, 
-    0xF5, 0xFA, 0xFB, 0x05, 0x0F, 0x0E, 0x0C, 0x04, 0xFF, 0xFD, 0x04, 0x0C, 
-    0x08, 0x04, 0xFB, 0xF5, 0xF0, 0xF1, 0xF8, 0xFA, 0xFE, 0xFE, 0xF4, 0xEF, 
-    0xF5, 0xFD, 0x0A, 0x12, 0x14, 0x15, 0x0E, 0x0F, 0x14, 0x1F, 0x28, 0x2B, 
-    0x28, 0x1C, 0x1C, 0x15, 0x16, 0x1A, 0x1D, 0x1F, 0x1B, 0x12, 0x08, 0x09, 
-    0x0D, 0x17, 0x18, 0x17, 0x0E, 0x03, 0x07, 0x0D, 0x11, 0x17, 0x1E, 0x1E, 
-    0x16, 0x14, 0x17, 0x1A, 0x20, 0x24, 0x28, 0x25, 0x23, 0x24, 0x2A, 0x34, 
-    0x38, 0x39, 0x35, 0x2C, 0x23, 0x1F, 0x1F, 0x1E, 0x1F, 0x1F, 0x14, 0x08, 
-    0xFF, 0xF7, 0xF7, 0xF5, 0xED, 0xEC, 0xE6, 0xDE, 0xDD, 0xDD, 0xE3, 0xEB, 
-    0xEE, 0xF6, 0xF6, 0xF0, 0xEC, 0xF1, 0xFC, 0x04, 0x0C, 0x0D, 0x08, 0x06, 
-    0x0B, 0x12, 0x14, 0x11, 0x12, 0x0D, 0x0A, 0x0B, 0x0B, 0x0E, 0x18, 0x1B, 
-    0x1A, 0x19, 0x12, 0x0A, 0x0C, 0x12, 0x18, 0x1B, 0x16, 0x0F, 0x05, 0x02, 
-    0x04, 0x05, 0x01, 0xFD, 0xFA, 0xF2, 0xEF, 0xF3, 0xF1, 0xFB, 0x03, 0x03, 
-    0x01, 0xFA, 0xF7, 0xF5, 0x02, 0x0C, 0x0C, 0x08, 0xFF, 0xFD, 0x01, 0x07, 
-    0x08, 0x06, 0x01, 0xF9, 0xF3, 0xEC, 0xEE, 0xF2, 0xF8, 0xFA, 0xF4, 0xF0, 
-    0xE7, 0xE5, 0xE8, 0xEE, 0xF0, 0xEE, 0xEC, 0xE3, 0xDD, 0xDC, 0xDB, 0xDD, 
-    0xDF, 0xDC, 0xD8, 0xD2, 0xCB, 0xCE, 0xD9, 0xE1, 0xE4, 0xED, 0xEB, 0xE7, 
-    0xE9, 0xEE, 0xF8, 0xFC, 0xFD, 0xF9, 0xF4, 0xF1, 0xF9, 0xFD, 0xFF, 0xFE, 
-    0xFA, 0xF7, 0xEC, 0xE9, 0xED, 0xF0, 0xF5, 0xFA, 0xF3, 0xE9, 0xE3, 0xE0, 
-    0xE0, 0xE3, 0xE9, 0xE4, 0xD9, 0xD2, 0xCD, 0xD4, 0xDE, 0xE3, 0xE0, 0xE2, 
-    0xE5, 0xE2, 0xE4, 0xEA, 0xED, 0xF2, 0xF8, 0xF6, 0xF4, 0xF4, 0xF5, 0xFD, 
-    0x07, 0x0E, 0x12, 0x11, 0x0D, 0x0F, 0x11, 0x17, 0x1C, 0x19, 0x1C, 0x18, 
-    0x14, 0x10, 0x10, 0x12, 0x11, 0x0E, 0x06, 0xFC, 0xF6, 0xF5, 0xF5, 0xFC, 
-    0xFF, 0xFC, 0xF6, 0xF1, 0xE9, 0xE8, 0xEA, 0xEA, 0xEF, 0xF0, 0xEF, 0xEC, 
-    0xEB, 0xEB, 0xF6, 0x01, 0x09, 0x0B, 0x01, 0x00, 0x04, 0x0F, 0x1B, 0x22, 
-    0x22, 0x1C, 0x18, 0x19, 0x1E, 0x1E, 0x1B, 0x18, 0x15, 0x11, 0x09, 0x02, 
-    0x05, 0x0D, 0x15, 0x18, 0x11, 0x0B, 0x06, 0x03, 0x0B, 0x19, 0x21, 0x22, 
-    0x1C, 0x17, 0x17, 0x21, 0x27, 0x24, 0x22, 0x1E, 0x1C, 0x1D, 0x1D, 0x1F, 
-    0x25, 0x26, 0x23, 0x1D, 0x12, 0x07, 0x05, 0x07, 0x0B, 0x11, 0x0F, 0x09, 
-    0x02, 0xFE, 0x02, 0x01, 0x00, 0x01, 0xFE, 0xFA, 0xF5, 0xF9, 0xFD, 0x05, 
-    0x0B, 0x0E, 0x0C, 0x09, 0x03, 0x07, 0x0E, 0x0F, 0x15, 0x0E, 0x06, 0xFF, 
-    0xFB, 0xFF, 0xFF, 0xFC, 0xF9, 0xF6, 0xF4, 0xEC, 0xEB, 0xF1, 0xFA, 0x02, 
-    0x07, 0x04, 0xFE, 0xFA, 0xF8, 0xFC, 0xFF, 0xFE, 0xFD, 0xF9, 0xF8, 0xFB, 
-    0xFC, 0x00, 0xFD, 0xFD, 0xFF, 0xF9, 0xF8, 0xF9, 0xFE, 0x05, 0x0A, 0x0E, 
-    0x06, 0xFF, 0xF7, 0xF5, 0xFB, 0xFE, 0xFE, 0xFA, 0xF5, 0xF0, 0xF0, 0xF1, 
-    0xF2, 0xF2, 0xF2, 0xF2, 0xF0, 0xEA, 0xE7, 0xE9, 0xEC, 0xF1, 0xF5, 0xED, 
-    0xE4, 0xE1, 0xE4, 0xEC, 0xF4, 0xF4, 0xF1, 0xEF, 0xED, 0xF3, 0xF6, 0xF9, 
-    0xFC, 0xFD, 0xFD, 0xF9, 0xF8, 0xF7, 0xF7, 0xFB, 0x01, 0x00, 0xF9, 0xF1, 
-    0xED, 0xEE, 0xF3, 0xF9, 0xF6, 0xF0, 0xE4, 0xDF, 0xDE, 0xDC, 0xDB, 0xD7, 
-    0xD4, 0xD2, 0xD0, 0xCB, 0xC8, 0xCC, 0xD2, 0xD8, 0xD9, 0xD3, 0xD1, 0xD1, 
-    0xDA, 0xE4, 0xEA, 0xEE, 0xED, 0xEB, 0xEC, 0xED, 0xF2, 0xF4, 0xF3, 0xF0, 
-    0xF4, 0xF6, 0xF5, 0xF9, 0xFF, 0x06, 0x09, 0x0A, 0x01, 0xFA, 0xF9, 0xFD, 
-    0x04, 0x0B, 0x0F, 0x0D, 0x07, 0x06, 0x05, 0x04, 0x02, 0xFB, 0xF9, 0xF9, 
-    0xF6, 0xF6, 0xF9, 0xFB, 0xFF, 0x06, 0x06, 0x01, 0xF9, 0xF8, 0x01, 0x07, 
-    0x0E, 0x11, 0x12, 0x11, 0x13, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 
-    0x18, 0x1C, 0x21, 0x26, 0x29, 0x28, 0x21, 0x19, 0x15, 0x1A, 0x1C, 0x1D, 
-    0x1B, 0x17, 0x13, 0x0B, 0x09, 0x07, 0x01, 0xFD, 0xFC, 0xFA, 0xF6, 0xF5, 
-    0xF9, 0x02, 0x0E, 0x13, 0x14, 0x0D, 0x0A, 0x0C, 0x11, 0x1A, 0x21, 0x21, 
-    0x1F, 0x24, 0x24, 0x27, 0x28, 0x26, 0x21, 0x1F, 0x19, 0x14, 0x12, 0x13, 
-    0x16, 0x16, 0x14, 0x0E, 0x05, 0xFE, 0xF9, 0xF9, 0xF8, 0xF9, 0xF7, 0xF5, 
-    0xF6, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xF6, 0xF4, 0xF6, 0xFB, 0x04, 
-    0x0A, 0x0D, 0x0D, 0x07, 0x04, 0x06, 0x0C, 0x13, 0x17, 0x17, 0x16, 0x1A, 
-    0x1E, 0x23, 0x25, 0x20, 0x1F, 0x1D, 0x1A, 0x14, 0x0B, 0x07, 0x07, 0x07, 
-    0x07, 0x01, 0xF8, 0xF7, 0xF7, 0xFB, 0xFC, 0xFB, 0xF8, 0xF3, 0xF2, 0xF3, 
-    0xF4, 0xF3, 0xF0, 0xEC, 0xE9, 0xE4, 0xE4, 0xE6, 0xEA, 0xF1, 0xF4, 0xF2, 
-    0xF0, 0xED, 0xED, 0xF1, 0xF4, 0xF6, 0xF6, 0xF5, 0xF5, 0xF6, 0xF4, 0xF2, 
-    0xEE, 0xEC, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEC, 0xEE, 0xEF, 0xED, 0xE7, 
-    0xE4, 0xE3, 0xE4, 0xE6, 0xE9, 0xEB, 0xEB, 0xEB, 0xEC, 0xEF, 0xF0, 0xF1, 
-    0xEE, 0xE9, 0xE9, 0xEB, 0xEF, 0xF2, 0xF5, 0xFA, 0xFB, 0xF8, 0xF5, 0xF2, 
-    0xEF, 0xF0, 0xF2, 0xF5, 0xF7, 0xF8, 0xF7, 0xF5, 0xF6, 0xF7, 0xF2, 0xEF, 
-    0xED, 0xED, 0xED, 0xEE, 0xF0, 0xF4, 0xF6, 0xF6, 0xF4, 0xEE, 0xEB, 0xEB, 
-    0xEE, 0xF0, 0xF0, 0xEF, 0xED, 0xEE, 0xF2, 0xF3, 0xF0, 0xEA, 0xE3, 0xE1, 
-    0xDF, 0xDE, 0xDF, 0xE2, 0xE7, 0xF1, 0xF6, 0xF5, 0xF2, 0xF0, 0xF0, 0xF1, 
-    0xF4, 0xF6, 0xFA, 0xFE, 0x02, 0x05, 0x08, 0x0A, 0x0A, 0x08, 0x02, 0xFF, 
-    0x00, 0x06, 0x0A, 0x0C, 0x12, 0x14, 0x12, 0x0D, 0x07, 0x06, 0x08, 0x0B, 
-    0x0E, 0x0D, 0x0E, 0x0E, 0x0C, 0x0F, 0x14, 0x13, 0x0C, 0x05, 0x01, 0x03, 
-    0x05, 0x09, 0x0D, 0x12, 0x14, 0x13, 0x11, 0x10, 0x12, 0x15, 0x17, 0x19, 
-    0x1C, 0x1F, 0x24, 0x28, 0x2B, 0x2E, 0x2E, 0x2A, 0x26, 0x22, 0x21, 0x21, 
-    0x24, 0x2B, 0x31, 0x34, 0x2F, 0x28, 0x23, 0x22, 0x24, 0x25, 0x20, 0x1B, 
-    0x16, 0x14, 0x12, 0x10, 0x0E, 0x07, 0xFF, 0xF3, 0xE8, 0xE3, 0xE3, 0xE6, 
-    0xEA, 0xEE, 0xEF, 0xEF, 0xF0, 0xED, 0xEF, 0xF4, 0xF9, 0xFB, 0xFB, 0xFB, 
-    0xFD, 0x01, 0x07, 0x0A, 0x0B, 0x09, 0x04, 0x03, 0x05, 0x08, 0x0D, 0x0F, 
-    0x11, 0x12, 0x0F, 0x0B, 0x0A, 0x0B, 0x0F, 0x11, 0x0F, 0x0B, 0x07, 0x04, 
-    0x03, 0x03, 0x00, 0xFB, 0xF5, 0xEF, 0xEA, 0xEA, 0xEE, 0xF4, 0xFA, 0xFD, 
-    0xFD, 0xFB, 0xFA, 0xFA, 0xFD, 0xFE, 0x00, 0x05, 0x0A, 0x0C, 0x0C, 0x0A, 
-    0x0C, 0x0F, 0x0E, 0x0D, 0x09, 0x06, 0x05, 0x07, 0x0A, 0x0B, 0x0B, 0x07, 
-    0x02, 0xFF, 0xFA, 0xF8, 0xF7, 0xF6, 0xF4, 0xF0, 0xEC, 0xEA, 0xEA, 0xEB, 
-    0xE7, 0xDF, 0xD6, 0xCF, 0xCD, 0xCF, 0xD0, 0xD3, 0xD6, 0xDB, 0xDD, 0xDA, 
-    0xD8, 0xD8, 0xDE, 0xE5, 0xEA, 0xED, 0xF0, 0xF3, 0xF6, 0xF9, 0xF9, 0xF8, 
-    0xF4, 0xEF, 0xE8, 0xE3, 0xE6, 0xED, 0xF5, 0xFA, 0xFA, 0xF6, 0xF1, 0xEA, 
-    0xE5, 0xE5, 0xE9, 0xEB, 0xEC, 0xED, 0xEF, 0xEE, 0xED, 0xEC, 0xEA, 0xE5, 
-    0xDE, 0xD9, 0xD7, 0xD9, 0xE0, 0xE5, 0xEA, 0xEF, 0xEF, 0xEC, 0xE8, 0xE6, 
-    0xEA, 0xF2, 0xF6, 0xF7, 0xF8, 0xFC, 0x03, 0x08, 0x0B, 0x0B, 0x06, 0x00, 
-    0x00, 0x00, 0x02, 0x04, 0x05, 0x06, 0x0A, 0x08, 0x06, 0x02, 0xFF, 0x02, 
-    0x05, 0x09, 0x08, 0x08, 0x09, 0x0B, 0x0E, 0x0C, 0x09, 0x05, 0xFA, 0xF2, 
-    0xEE, 0xF0, 0xF6, 0xFE, 0x01, 0x02, 0x04, 0x01, 0x03, 0x04, 0x09, 0x0A, 
-    0x11, 0x15, 0x14, 0x18, 0x14, 0x16, 0x18, 0x17, 0x15, 0x10, 0x0A, 0x0C, 
-    0x0E, 0x14, 0x17, 0x1A, 0x1F, 0x1E, 0x1C, 0x1A, 0x17, 0x16, 0x1A, 0x17, 
-    0x18, 0x16, 0x12, 0x18, 0x17, 0x17, 0x16, 0x13, 0x10, 0x09, 0x07, 0x06, 
-    0x0F, 0x16, 0x1B, 0x1C, 0x19, 0x16, 0x0F, 0x11, 0x15, 0x18, 0x1E, 0x1C, 
-    0x1B, 0x1C, 0x1A, 0x18, 0x1A, 0x1B, 0x1A, 0x17, 0x0E, 0x10, 0x12, 0x16, 
-    0x17, 0x19, 0x19, 0x17, 0x14, 0x0F, 0x0A, 0x0B, 0x0C, 0x08, 0x07, 0xFD, 
-    0xFC, 0xFF, 0x02, 0x00, 0xF8, 0xF2, 0xE8, 0xE3, 0xE2, 0xE5, 0xE5, 0xEA, 
-    0xED, 0xEE, 0xEB, 0xE8, 0xE6, 0xEB, 0xEF, 0xF1, 0xF1, 0xF3, 0xF7, 0xFA, 
-    0x01, 0x03, 0x07, 0x07, 0x02, 0xFF, 0xFC, 0xFE, 0x06, 0x0B, 0x11, 0x12, 
-    0x17, 0x14, 0x10, 0x0B, 0x05, 0x07, 0x04, 0x03, 0x03, 0x06, 0x03, 0x02, 
-    0xFE, 0xF6, 0xF1, 0xEB, 0xE5, 0xE4, 0xE6, 0xED, 0xF3, 0xF3, 0xF1, 0xEB, 
-    0xE9, 0xE4, 0xE4, 0xE2, 0xE8, 0xEC, 0xEE, 0xF4, 0xF7, 0xFE, 0x00, 0x00, 
-    0xFB, 0xF6, 0xF2, 0xF1, 0xF1, 0xF6, 0xFC, 0x02, 0x05, 0x05, 0x04, 0x00, 
-    0xFA, 0xF1, 0xED, 0xEE, 0xEE, 0xF1, 0xEF, 0xEE, 0xF0, 0xEF, 0xEB, 0xE5, 
-    0xDE, 0xD9, 0xD4, 0xCE, 0xCE, 0xD2, 0xD5, 0xDA, 0xDE, 0xE0, 0xE0, 0xDF, 
-    0xDD, 0xDF, 0xE0, 0xE4, 0xE5, 0xE8, 0xEC, 0xF3, 0xFA, 0xFC, 0xFB, 0xF9, 
-    0xF4, 0xEF, 0xEC, 0xED, 0xF2, 0xF4, 0xF9, 0xF9, 0xF9, 0xF9, 0xF4, 0xF0, 
-    0xEC, 0xEB, 0xE9, 0xE6, 0xE5, 0xE4, 0xE9, 0xEB, 0xEC, 0xE8, 0xE2, 0xE1, 
-    0xDE, 0xDA, 0xDA, 0xE1, 0xE9, 0xF5, 0xFA, 0xFF, 0x02, 0x02, 0x06, 0x09, 
-    0x0C, 0x0E, 0x0D, 0x0E, 0x12, 0x1B, 0x25, 0x2A, 0x2B, 0x29, 0x25, 0x23, 
-    0x20, 0x1E, 0x1E, 0x20, 0x21, 0x27, 0x29, 0x2B, 0x28, 0x25, 0x20, 0x1B, 
-    0x16, 0x11, 0x10, 0x0F, 0x11, 0x13, 0x13, 0x13, 0x11, 0x0B, 0x04, 0x01, 
-    0x01, 0x06, 0x08, 0x0A, 0x0E, 0x12, 0x14, 0x12, 0x0E, 0x0C, 0x0C, 0x0A, 
-    0x0D, 0x0E, 0x0E, 0x13, 0x18, 0x1B, 0x1D, 0x1C, 0x18, 0x14, 0x10, 0x12, 
-    0x17, 0x1B, 0x20, 0x21, 0x1E, 0x19, 0x13, 0x14, 0x14, 0x13, 0x11, 0x0C, 
-    0x0B, 0x0C, 0x0D, 0x0B, 0x08, 0x03, 0x01, 0x00, 0xFA, 0xF9, 0xFA, 0xFF, 
-    0x03, 0x03, 0x04, 0x01, 0x02, 0x00, 0x01, 0x03, 0x04, 0x04, 0x06, 0x09, 
-    0x0D, 0x11, 0x10, 0x10, 0x0E, 0x0C, 0x09, 0x03, 0x01, 0x03, 0x07, 0x0B, 
-    0x0B, 0x09, 0x09, 0x05, 0x01, 0xFE, 0xFD, 0xFF, 0x01, 0x03, 0x04, 0x05, 
-    0x06, 0x06, 0x03, 0x00, 0xFD, 0xF9, 0xF3, 0xF3, 0xF5, 0xF9, 0xFE, 0x01, 
-    0x00, 0xFE, 0xFB, 0xF6, 0xF6, 0xF6, 0xF6, 0xF4, 0xF5, 0xF8, 0xFD, 0x01, 
-    0x02, 0x01, 0xFF, 0xFE, 0xFA, 0xF0, 0xEB, 0xEA, 0xEF, 0xF2, 0xF4, 0xF5, 
-    0xF4, 0xF3, 0xEF, 0xED, 0xEB, 0xE9, 0xE9, 0xE9, 0xE8, 0xE7, 0xEA, 0xEB, 
-    0xE7, 0xE4, 0xE0, 0xDB, 0xD6, 0xD3, 0xD5, 0xD9, 0xDD, 0xDE, 0xDE, 0xE0, 
-    0xE1, 0xE2, 0xE7, 0xE9, 0xEC, 0xEC, 0xED, 0xF1, 0xF6, 0xF9, 0xFC, 0xFB, 
-    0xFC, 0xFB, 0xFA, 0xF8, 0xF4, 0xF6, 0xFB, 0x00, 0x04, 0x05, 0x06, 0x03, 
-    0x01, 0xFF, 0xFD, 0xFB, 0xF8, 0xF7, 0xF6, 0xF4, 0xF2, 0xEF, 0xED, 0xEB, 
-    0xE7, 0xE4, 0xE0, 0xE0, 0xE2, 0xE5, 0xE4, 0xE2, 0xE1, 0xE0, 0xDD, 0xDA, 
-    0xDA, 0xDA, 0xDA, 0xDD, 0xE2, 0xE7, 0xEC, 0xF1, 0xF4, 0xF7, 0xF9, 0xFC, 
-    0xFB, 0xFA, 0xFB, 0x00, 0x08, 0x0D, 0x0F, 0x10, 0x10, 0x0D, 0x0B, 0x0A, 
-    0x08, 0x06, 0x07, 0x07, 0x09, 0x0A, 0x0A, 0x0A, 0x07, 0x05, 0x04, 0x00, 
-    0xFB, 0xF8, 0xFA, 0x00, 0x06, 0x09, 0x0C, 0x0F, 0x0F, 0x0D, 0x0E, 0x10, 
-    0x14, 0x18, 0x1C, 0x1F, 0x25, 0x2A, 0x2E, 0x2D, 0x2C, 0x2C, 0x2A, 0x2A, 
-    0x27, 0x29, 0x2B, 0x2B, 0x2D, 0x2C, 0x29, 0x24, 0x1E, 0x1D, 0x1D, 0x1C, 
-    0x1A, 0x18, 0x17, 0x17, 0x17, 0x16, 0x11, 0x0D, 0x09, 0x03, 0x02, 0x02, 
-    0x05, 0x09, 0x0B, 0x0C, 0x0B, 0x0A, 0x07, 0x03, 0xFF, 0xFD, 0xFD, 0xFF, 
-    0x04, 0x07, 0x0B, 0x0F, 0x0F, 0x10, 0x0E, 0x0A, 0x05, 0x00, 0xFF, 0x01, 
-    0x04, 0x06, 0x07, 0x06, 0x05, 0x01, 0xFE, 0xFA, 0xF6, 0xF3, 0xEE, 0xED, 
-    0xEE, 0xF0, 0xF0, 0xEF, 0xEC, 0xEA, 0xEB, 0xE7, 0xE1, 0xDE, 0xE2, 0xE9, 
-    0xEF, 0xF3, 0xF8, 0xFC, 0xFD, 0xFD, 0xFC, 0xFB, 0xFC, 0x00, 0x07, 0x0E, 
-    0x11, 0x12, 0x12, 0x12, 0x13, 0x11, 0x0D, 0x09, 0x0A, 0x0D, 0x0F, 0x0F, 
-    0x0E, 0x0D, 0x0C, 0x07, 0x02, 0x00, 0xFE, 0xFD, 0xFA, 0xF6, 0xF3, 0xF2, 
-    0xF3, 0xF3, 0xF1, 0xF0, 0xEC, 0xE8, 0xE7, 0xE6, 0xEB, 0xEE, 0xEF, 0xF0, 
-    0xF1, 0xF0, 0xEA, 0xE6, 0xE4, 0xE3, 0xE5, 0xE8, 0xE9, 0xE9, 0xEB, 0xEB, 
-    0xEC, 0xEC, 0xED, 0xED, 0xEA, 0xE6, 0xE4, 0xE7, 0xEA, 0xEC, 0xEC, 0xEB, 
-    0xE8, 0xE4, 0xE1, 0xE0, 0xDF, 0xDC, 0xDA, 0xDA, 0xDB, 0xDC, 0xDE, 0xDC, 
-    0xDB, 0xDC, 0xDA, 0xD8, 0xD8, 0xDB, 0xE1, 0xE7, 0xEA, 0xED, 0xEF, 0xEF, 
-    0xED, 0xED, 0xED, 0xEC, 0xEF, 0xF1, 0xF6, 0xFA, 0xFD, 0xFE, 0xFC, 0xFA, 
-    0xFA, 0xF8, 0xF5, 0xF3, 0xF7, 0xFC, 0x00, 0x03, 0x03, 0x01, 0xFC, 0xF8, 
-    0xF7, 0xF6, 0xF8, 0xF9, 0xFB, 0xFA, 0xF9, 0xFA, 0xF9, 0xF8, 0xF6, 0xF7, 
-    0xF6, 0xF4, 0xF6, 0xFA, 0xFF, 0x03, 0x06, 0x08, 0x08, 0x07, 0x05, 0x02, 
-    0x00, 0x00, 0x02, 0x06, 0x0B, 0x0E, 0x0F, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 
-    0x0B, 0x0B, 0x0E, 0x10, 0x12, 0x15, 0x17, 0x17, 0x15, 0x10, 0x0D, 0x0B, 
-    0x08, 0x08, 0x09, 0x0A, 0x0C, 0x0E, 0x10, 0x11, 0x0F, 0x0C, 0x08, 0x07, 
-    0x09, 0x0E, 0x11, 0x14, 0x18, 0x1C, 0x20, 0x1D, 0x19, 0x17, 0x17, 0x1B, 
-    0x1C, 0x1F, 0x21, 0x22, 0x24, 0x26, 0x25, 0x24, 0x23, 0x20, 0x1D, 0x1C, 
-    0x1D, 0x20, 0x24, 0x29, 0x2A, 0x29, 0x25, 0x20, 0x1C, 0x1A, 0x18, 0x19, 
-    0x18, 0x16, 0x12, 0x0E, 0x0C, 0x0B, 0x0A, 0x06, 0x00, 0xFA, 0xFA, 0xFD, 
-    0xFF, 0x00, 0xFF, 0xFE, 0xFB, 0xF7, 0xF4, 0xF0, 0xEE, 0xEF, 0xF1, 0xF3, 
-    0xF4, 0xF4, 0xF3, 0xF5, 0xF8, 0xFB, 0xFC, 0xFA, 0xF6, 0xF4, 0xF6, 0xFA, 
-    0xFD, 0xFE, 0xFC, 0xFB, 0xF9, 0xF9, 0xF8, 0xF6, 0xF3, 0xF4, 0xF6, 0xF7, 
-    0xFA, 0xF9, 0xF7, 0xF5, 0xF5, 0xF4, 0xF1, 0xEE, 0xEE, 0xF0, 0xF3, 0xF7, 
-    0xFB, 0xFC, 0xFC, 0xFB, 0xFC, 0xFC, 0xFB, 0xFB, 0xFA, 0xFC, 0xFE, 0x00, 
-    0x02, 0x03, 0x02, 0x04, 0x06, 0x06, 0x03, 0x02, 0x03, 0x05, 0x08, 0x0A, 
-    0x0A, 0x08, 0x04, 0x00, 0xFD, 0xFA, 0xF8, 0xF7, 0xF5, 0xF2, 0xF0, 0xEF, 
-    0xEC, 0xE8, 0xE5, 0xE2, 0xE0, 0xDB, 0xD8, 0xD6, 0xD6, 0xD9, 0xDD, 0xE0, 
-    0xDE, 0xDB, 0xD6, 0xD6, 0xDA, 0xDF, 0xE4, 0xE8, 0xE9, 0xEA, 0xED, 0xEF, 
-    0xF0, 0xF2, 0xF4, 0xF4, 0xF2, 0xF0, 0xF1, 0xF1, 0xF5, 0xF7, 0xF5, 0xEE, 
-    0xE8, 0xE5, 0xE2, 0xDF, 0xDF, 0xDF, 0xE0, 0xDF, 0xDC, 0xDB, 0xDB, 0xDD, 
-    0xDF, 0xE1, 0xDE, 0xDC, 0xDD, 0xE2, 0xE8, 0xEF, 0xF5, 0xF9, 0xFA, 0xFA, 
-    0xFB, 0xFC, 0xFF, 0x03, 0x06, 0x0A, 0x0E, 0x10, 0x13, 0x14, 0x18, 0x1D, 
-    0x1D, 0x1B, 0x16, 0x16, 0x1A, 0x1F, 0x23, 0x24, 0x26, 0x26, 0x23, 0x1F, 
-    0x19, 0x16, 0x17, 0x16, 0x15, 0x14, 0x14, 0x13, 0x12, 0x12, 0x11, 0x11, 
-    0x0E, 0x0A, 0x0A, 0x0B, 0x0E, 0x10, 0x13, 0x16, 0x17, 0x17, 0x17, 0x17, 
-    0x19, 0x1D, 0x22, 0x24, 0x25, 0x26, 0x26, 0x25, 0x23, 0x24, 0x24, 0x23, 
-    0x1E, 0x1D, 0x1E, 0x20, 0x21, 0x21, 0x1E, 0x18, 0x11, 0x0B, 0x06, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x05, 0x09, 0x0B, 0x09, 0x06, 
-    0x04, 0x06, 0x09, 0x0F, 0x12, 0x11, 0x12, 0x12, 0x13, 0x13, 0x12, 0x11, 
-    0x12, 0x13, 0x12, 0x0F, 0x0A, 0x08, 0x0B, 0x10, 0x0F, 0x0C, 0x07, 0x04, 
-    0x04, 0x07, 0x09, 0x0B, 0x0A, 0x08, 0x07, 0x03, 0x00, 0xFF, 0xFE, 0xFE, 
-    0xFE, 0xFD, 0xFB, 0xF9, 0xF7, 0xF7, 0xF8, 0xF8, 0xF6, 0xF5, 0xF5, 0xF7, 
-    0xFA, 0xFD, 0x01, 0x03, 0x03, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x02, 0x03, 
-    0x02, 0x00, 0xFD, 0xF9, 0xF8, 0xF9, 0xF9, 0xF8, 0xF7, 0xF7, 0xF6, 0xF6, 
-    0xF9, 0xFA, 0xF8, 0xF4, 0xF2, 0xF1, 0xF0, 0xEE, 0xEC, 0xEA, 0xEA, 0xE9, 
-    0xE7, 0xE5, 0xE4, 0xE4, 0xE5, 0xE8, 0xE7, 0xE7, 0xE7, 0xE8, 0xE9, 0xEC, 
-    0xF1, 0xF2, 0xF2, 0xF2, 0xF3, 0xF4, 0xF5, 0xF7, 0xF9, 0xF8, 0xF5, 0xF0, 
-    0xEB, 0xE9, 0xEB, 0xEE, 0xEE, 0xEC, 0xEC, 0xEB, 0xEA, 0xED, 0xF1, 0xF4, 
-    0xF5, 0xF3, 0xF1, 0xEF, 0xED, 0xED, 0xEE, 0xEE, 0xF0, 0xEF, 0xED, 0xE8, 
-    0xE5, 0xE4, 0xE6, 0xE7, 0xE8, 0xE6, 0xE4, 0xE3, 0xE4, 0xE8, 0xEA, 0xEA, 
-    0xE8, 0xE9, 0xE8, 0xE8, 0xE9, 0xEB, 0xEF, 0xF2, 0xF1, 0xED, 0xEB, 0xEC, 
-    0xEF, 0xF1, 0xF0, 0xEF, 0xF0, 0xF2, 0xF4, 0xF7, 0xFB, 0xFC, 0xFC, 0xF9, 
-    0xF7, 0xF5, 0xF5, 0xF7, 0xFA, 0x00, 0x03, 0x03, 0x02, 0x01, 0x01, 0x03, 
-    0x06, 0x08, 0x09, 0x08, 0x08, 0x06, 0x08, 0x0B, 0x10, 0x12, 0x14, 0x15, 
-    0x16, 0x18, 0x1D, 0x22, 0x26, 0x27, 0x25, 0x24, 0x23, 0x25, 0x29, 0x2C, 
-    0x2C, 0x29, 0x28, 0x29, 0x2A, 0x2E, 0x32, 0x32, 0x2F, 0x2B, 0x2A, 0x28, 
-    0x26, 0x25, 0x26, 0x28, 0x28, 0x22, 0x1C, 0x19, 0x1A, 0x1B, 0x19, 0x14, 
-    0x0F, 0x0C, 0x08, 0x04, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 
-    0x07, 0x09, 0x08, 0x08, 0x06, 0x04, 0x03, 0x05, 0x08, 0x0B, 0x0C, 0x09, 
-    0x07, 0x06, 0x06, 0x09, 0x0B, 0x0A, 0x06, 0x01, 0xFD, 0xF9, 0xF7, 0xF6, 
-    0xF5, 0xF3, 0xF2, 0xEF, 0xEB, 0xE8, 0xE6, 0xE9, 0xEC, 0xEE, 0xEE, 0xEC, 
-    0xEB, 0xED, 0xEF, 0xF3, 0xF5, 0xF6, 0xF7, 0xFA, 0xFD, 0xFF, 0x02, 0x03, 
-    0x03, 0x01, 0x01, 0x02, 0x05, 0x09, 0x0D, 0x10, 0x12, 0x12, 0x13, 0x13, 
-    0x12, 0x10, 0x0F, 0x0D, 0x0A, 0x06, 0x03, 0x00, 0xFE, 0xFD, 0xFD, 0xFB, 
-    0xF6, 0xF0, 0xE9, 0xE5, 0xE7, 0xE9, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEC, 
-    0xED, 0xEE, 0xEE, 0xED, 0xEE, 0xED, 0xEF, 0xEE, 0xEF, 0xF1, 0xF3, 0xF4, 
-    0xF2, 0xED, 0xEC, 0xEE, 0xF1, 0xF3, 0xF1, 0xEE, 0xEC, 0xEC, 0xED, 0xEB, 
-    0xE8, 0xE5, 0xE2, 0xDF, 0xDB, 0xD6, 0xD4, 0xD3, 0xD4, 0xD5, 0xD5, 0xD4, 
-    0xD2, 0xD3, 0xD6, 0xDA, 0xDC, 0xDD, 0xDD, 0xDE, 0xE0, 0xE4, 0xE9, 0xEB, 
-    0xEC, 0xED, 0xEF, 0xF3, 0xF4, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xF4, 
-    0xF3, 0xF6, 0xFA, 0xFA, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xF8, 
-    0xF7, 0xF5, 0xF2, 0xF0, 0xEF, 0xF2, 0xF5, 0xF7, 0xF7, 0xF3, 0xEF, 0xED, 
-    0xF1, 0xF4, 0xF6, 0xF7, 0xF9, 0xFB, 0xFD, 0x02, 0x06, 0x09, 0x0C, 0x0E, 
-    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x15, 0x13, 0x10, 0x0E, 0x0E, 0x0F, 
-    0x11, 0x10, 0x0E, 0x0A, 0x09, 0x09, 0x0A, 0x0B, 0x0B, 0x09, 0x08, 0x08, 
-    0x09, 0x0C, 0x0E, 0x11, 0x13, 0x14, 0x13, 0x0F, 0x0B, 0x0B, 0x10, 0x17, 
-    0x1A, 0x19, 0x19, 0x18, 0x1A, 0x1D, 0x1F, 0x20, 0x20, 0x1F, 0x1E, 0x1D, 
-    0x1E, 0x20, 0x22, 0x23, 0x22, 0x20, 0x1D, 0x19, 0x17, 0x18, 0x19, 0x1A, 
-    0x1D, 0x1F, 0x1E, 0x1D, 0x1D, 0x1F, 0x1D, 0x18, 0x12, 0x0F, 0x0F, 0x14, 
-    0x17, 0x16, 0x12, 0x0C, 0x08, 0x06, 0x05, 0x03, 0x02, 0x01, 0xFF, 0xFE, 
-    0xFA, 0xF6, 0xF4, 0xF5, 0xF8, 0xF8, 0xF7, 0xF5, 0xF4, 0xF6, 0xF9, 0xFC, 
-    0xFD, 0xFD, 0xFB, 0xF8, 0xF3, 0xEF, 0xF0, 0xF3, 0xF4, 0xF3, 0xF3, 0xF4, 
-    0xF6, 0xF7, 0xF4, 0xF2, 0xEF, 0xED, 0xEE, 0xF0, 0xF1, 0xF3, 0xF6, 0xF9, 
-    0xFC, 0xFD, 0xFD, 0xFB, 0xFA, 0xFA, 0xFD, 0xFF, 0xFC, 0xF9, 0xF8, 0xF8, 
-    0xF9, 0xF9, 0xF7, 0xF4, 0xF2, 0xF1, 0xF2, 0xF5, 0xF9, 0xFD, 0x00, 0x01, 
-    0x01, 0x02, 0x03, 0x04, 0x06, 0x08, 0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 
-    0x0B, 0x08, 0x02, 0xFD, 0xFA, 0xF9, 0xF9, 0xF8, 0xF9, 0xFA, 0xFB, 0xF8, 
-    0xF2, 0xE9, 0xE2, 0xE0, 0xDF, 0xDE, 0xDB, 0xD7, 0xD7, 0xD8, 0xD9, 0xD9, 
-    0xD8, 0xD6, 0xD8, 0xDB, 0xDE, 0xDF, 0xE3, 0xE6, 0xE9, 0xEC, 0xEB, 0xEA, 
-    0xE8, 0xE7, 0xE6, 0xE8, 0xE9, 0xE8, 0xE9, 0xE8, 0xE9, 0xEB, 0xEC, 0xEB, 
-    0xE7, 0xE3, 0xE1, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE3, 0xE2, 0xDE, 0xDB, 
-    0xDA, 0xDF, 0xE5, 0xE9, 0xEA, 0xE8, 0xE7, 0xE9, 0xEF, 0xF4, 0xF4, 0xF2, 
-    0xEF, 0xF1, 0xF7, 0xFD, 0x03, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x0E, 0x10, 
-    0x16, 0x1D, 0x22, 0x24, 0x25, 0x27, 0x2A, 0x2D, 0x2B, 0x26, 0x1F, 0x1B, 
-    0x1B, 0x1A, 0x19, 0x17, 0x14, 0x13, 0x10, 0x0D, 0x08, 0x02, 0xFD, 0xFC, 
-    0xFD, 0xFE, 0xFD, 0xFE, 0x02, 0x08, 0x0F, 0x12, 0x12, 0x13, 0x14, 0x17, 
-    0x19, 0x1B, 0x20, 0x24, 0x27, 0x28, 0x25, 0x22, 0x20, 0x1F, 0x21, 0x22, 
-    0x21, 0x1F, 0x1C, 0x1B, 0x1D, 0x1C, 0x18, 0x11, 0x0B, 0x09, 0x08, 0x08, 
-    0x08, 0x09, 0x0B, 0x0C, 0x09, 0x04, 0xFF, 0xFD, 0xFF, 0x04, 0x08, 0x0A, 
-    0x0A, 0x0C, 0x0F, 0x12, 0x13, 0x11, 0x0D, 0x09, 0x08, 0x09, 0x0B, 0x0F, 
-    0x14, 0x17, 0x18, 0x16, 0x13, 0x0F, 0x0B, 0x0A, 0x0C, 0x0E, 0x0E, 0x0D, 
-    0x0C, 0x0E, 0x10, 0x0F, 0x0A, 0x02, 0xFB, 0xF9, 0xFA, 0xFA, 0xFC, 0xFF, 
-    0xFF, 0xFE, 0xFC, 0xF8, 0xF4, 0xF0, 0xEF, 0xEF, 0xEE, 0xED, 0xEB, 0xEB, 
-    0xEE, 0xF1, 0xF5, 0xF8, 0xF8, 0xF7, 0xF9, 0xFE, 0x02, 0x04, 0x07, 0x0A, 
-    0x09, 0x07, 0x03, 0x00, 0xFD, 0xFC, 0xFC, 0xFA, 0xF6, 0xF3, 0xF2, 0xF3, 
-    0xF5, 0xF3, 0xF0, 0xEA, 0xE6, 0xE6, 0xE7, 0xEA, 0xEE, 0xF2, 0xF5, 0xF8, 
-    0xF7, 0xF4, 0xF1, 0xEF, 0xF0, 0xF4, 0xF5, 0xF4, 0xF2, 0xF1, 0xF5, 0xF9, 
-    0xFC, 0xF8, 0xF2, 0xEE, 0xEC, 0xEF, 0xF1, 0xF3, 0xF4, 0xF3, 0xF2, 0xF1, 
-    0xF1, 0xF1, 0xF0, 0xF2, 0xF3, 0xF3, 0xF2, 0xF2, 0xF4, 0xF7, 0xF9, 0xF8, 
-    0xF3, 0xEE, 0xEB, 0xEC, 0xEE, 0xEF, 0xF2, 0xF4, 0xF3, 0xF0, 0xEA, 0xE5, 
-    0xE3, 0xE2, 0xE1, 0xE2, 0xE0, 0xDF, 0xDE, 0xDC, 0xDE, 0xE1, 0xE3, 0xE1, 
-    0xDC, 0xD9, 0xDB, 0xE0, 0xE5, 0xEA, 0xED, 0xEE, 0xED, 0xEC, 0xE9, 0xE7, 
-    0xE9, 0xEE, 0xF3, 0xF5, 0xF6, 0xF8, 0xFB, 0x00, 0x04, 0x04, 0x00, 0xF9, 
-    0xF6, 0xF8, 0xFA, 0xFE, 0x02, 0x06, 0x08, 0x09, 0x07, 0x04, 0x03, 0x03, 
-    0x06, 0x09, 0x0B, 0x0C, 0x0F, 0x13, 0x17, 0x19, 0x18, 0x13, 0x0C, 0x08, 
-    0x0A, 0x0E, 0x14, 0x19, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1D, 0x1E, 0x20, 
-    0x25, 0x29, 0x2C, 0x2E, 0x2F, 0x32, 0x32, 0x30, 0x2C, 0x27, 0x25, 0x25, 
-    0x26, 0x26, 0x27, 0x29, 0x27, 0x24, 0x20, 0x1A, 0x13, 0x0E, 0x0B, 0x0A, 
-    0x09, 0x06, 0x04, 0x04, 0x06, 0x09, 0x09, 0x05, 0x00, 0xFD, 0x00, 0x03, 
-    0x05, 0x06, 0x08, 0x0C, 0x10, 0x12, 0x10, 0x0D, 0x0D, 0x11, 0x14, 0x14, 
-    0x13, 0x11, 0x11, 0x11, 0x11, 0x0D, 0x07, 0x00, 0xFB, 0xF9, 0xF9, 0xFB, 
-    0xFC, 0xFE, 0xFE, 0xFA, 0xF6, 0xF1, 0xEE, 0xED, 0xED, 0xEC, 0xEB, 0xEC, 
-    0xF0, 0xF5, 0xF9, 0xFC, 0xFC, 0xFA, 0xF8, 0xF7, 0xF8, 0xFC, 0x02, 0x07, 
-    0x0A, 0x0C, 0x0B, 0x09, 0x05, 0x02, 0x00, 0x02, 0x05, 0x08, 0x0A, 0x0C, 
-    0x0E, 0x11, 0x14, 0x12, 0x0E, 0x09, 0x05, 0x03, 0x04, 0x04, 0x05, 0x03, 
-    0x01, 0xFE, 0xF9, 0xF2, 0xEC, 0xEB, 0xEB, 0xEB, 0xE9, 0xE6, 0xE5, 0xE5, 
-    0xE6, 0xE6, 0xE5, 0xE3, 0xE2, 0xE3, 0xE5, 0xE9, 0xED, 0xF2, 0xF5, 0xF7, 
-    0xF8, 0xF6, 0xF4, 0xF4, 0xF6, 0xF9, 0xFA, 0xF7, 0xF5, 0xF2, 0xF1, 0xF0, 
-    0xEE, 0xEA, 0xE4, 0xE0, 0xDB, 0xDE, 0xE0, 0xE6, 0xE9, 0xEB, 0xE7, 0xE4, 
-    0xE1, 0xDB, 0xD8, 0xD7, 0xDE, 0xE4, 0xEC, 0xF0, 0xEF, 0xF0, 0xF0, 0xEF, 
-    0xED, 0xED, 0xF0, 0xFC, 0x02, 0x0B, 0x14, 0x19, 0x1F, 0x1B, 0x15, 0x0F, 
-    0x04, 0x01, 0x00, 0x06, 0x0A, 0x07, 0x0E, 0x1A, 0x22, 0x1F, 0x10, 0xFD, 
-    0xF3, 0xEC, 0xF0, 0xF6, 0x02, 0x11, 0x18, 0x1D, 0x14, 0x0D, 0x07, 0x00, 
-    0x01, 0x04, 0x08, 0x12, 0x19, 0x1A, 0x1D, 0x13, 0x16, 0x14, 0x0E, 0x04, 
-    0xF3, 0xF5, 0xF7, 0x0A, 0x15, 0x21, 0x28, 0x2B, 0x28, 0x1D, 0x16, 0x16, 
-    0x16, 0x25, 0x29, 0x2B, 0x30, 0x2B, 0x32, 0x2B, 0x21, 0x17, 0x12, 0x16, 
-    0x19, 0x12, 0x17, 0x1C, 0x21, 0x26, 0x26, 0x1E, 0x1E, 0x1F, 0x18, 0x17, 
-    0x16, 0x17, 0x13, 0x14, 0x16, 0x14, 0x0D, 0x12, 0x0E, 0x0E, 0x05, 0x09, 
-    0x13, 0x1C, 0x2C, 0x22, 0x1E, 0x10, 0x09, 0xF8, 0xED, 0xEE, 0xF4, 0x03, 
-    0x10, 0x19, 0x1B, 0x22, 0x22, 0x1D, 0x12, 0x05, 0xFB, 0xFA, 0xFA, 0xFB, 
-    0x08, 0x14, 0x27, 0x35, 0x29, 0x15, 0xF5, 0xDB, 0xD7, 0xD8, 0xE6, 0xF1, 
-    0x03, 0x0C, 0x0C, 0x07, 0xFD, 0xF2, 0xE5, 0xE6, 0xDC, 0xDF, 0xE2, 0xED, 
-    0xF9, 0xFD, 0x03, 0x02, 0x06, 0x03, 0xF5, 0xE9, 0xF1, 0xF3, 0xFD, 0xFE, 
-    0x03, 0x08, 0x0B, 0x09, 0x06, 0xFF, 0xF2, 0xED, 0xEA, 0xED, 0xEF, 0xF5, 
-    0xF4, 0xF8, 0xF8, 0xEB, 0xDF, 0xE8, 0xEC, 0xF7, 0xF5, 0xE9, 0xE5, 0xDF, 
-    0xE4, 0xE9, 0xF7, 0x01, 0x03, 0xFE, 0xF5, 0xE7, 0xDE, 0xDF, 0xE8, 0xF2, 
-    0xF4, 0xF9, 0xF4, 0xF1, 0xE8, 0xE2, 0xE4, 0xEE, 0xF2, 0xF3, 0xF0, 0xE9, 
-    0xF3, 0xF5, 0xFF, 0x02, 0x07, 0x08, 0x03, 0xF8, 0xEF, 0xEA, 0xE1, 0xE4, 
-    0xE8, 0xEA, 0xEB, 0xF3, 0xF2, 0xF8, 0xF2, 0xE0, 0xD6, 0xD4, 0xCF, 0xC9, 
-    0xC0, 0xBC, 0xC3, 0xCC, 0xD7, 0xE0, 0xE9, 0xEE, 0xEC, 0xDE, 0xD7, 0xC8, 
-    0xC2, 0xC8, 0xD3, 0xEF, 0x00, 0x12, 0x16, 0x0D, 0x04, 0xF9, 0xFA, 0xFC, 
-    0x05, 0x03, 0x03, 0x02, 0x05, 0x0B, 0x07, 0x12, 0x14, 0x14, 0x0E, 0xFF, 
-    0xEF, 0xE7, 0xE9, 0xF6, 0x04, 0x0B, 0x0F, 0x0D, 0x0F, 0x07, 0x04, 0xFC, 
-    0x02, 0x06, 0x03, 0x00, 0xF9, 0x04, 0x08, 0x17, 0x22, 0x2C, 0x30, 0x2D, 
-    0x25, 0x19, 0x16, 0x0F, 0x12, 0x16, 0x1E, 0x2A, 0x38, 0x3C, 0x3D, 0x32, 
-    0x22, 0x1B, 0x15, 0x1C, 0x1D, 0x1E, 0x1F, 0x1D, 0x1B, 0x1A, 0x13, 0x19, 
-    0x1D, 0x1E, 0x1A, 0x07, 0xFE, 0xF9, 0xFD, 0x0D, 0x1A, 0x23, 0x2A, 0x23, 
-    0x18, 0x08, 0x01, 0x04, 0x10, 0x19, 0x16, 0x0B, 0x04, 0xFC, 0xF6, 0xFA, 
-    0x04, 0x10, 0x14, 0x15, 0x13, 0x16, 0x12, 0x19, 0x1D, 0x22, 0x21, 0x18, 
-    0x0C, 0x01, 0xF9, 0xF1, 0xF2, 0xFD, 0x0B, 0x11, 0x0E, 0x02, 0x02, 0xFB, 
-    0xF2, 0xEC, 0xED, 0xFB, 0x07, 0x10, 0x10, 0x0B, 0x0C, 0x06, 0x06, 0x0C, 
-    0x10, 0x12, 0x12, 0x0E, 0x04, 0xFF, 0xF5, 0xFA, 0x04, 0x08, 0x0A, 0x02, 
-    0xFC, 0xF5, 0xF3, 0xFA, 0x02, 0x0F, 0x15, 0x0A, 0xFA, 0xEE, 0xE4, 0xE6, 
-    0xFB, 0x07, 0x1A, 0x1C, 0x16, 0x0A, 0xF0, 0xDF, 0xE0, 0xE9, 0xF5, 0xEF, 
-    0xE8, 0xE3, 0xDA, 0xE1, 0xDC, 0xE8, 0xEF, 0xF3, 0xEB, 0xE2, 0xD8, 0xD7, 
-    0xDB, 0xE6, 0xF5, 0x01, 0x08, 0x04, 0x02, 0xF6, 0xF4, 0xE7, 0xE9, 0xF1, 
-    0xF6, 0xF7, 0xF0, 0xE9, 0xEA, 0xE4, 0xDF, 0xE2, 0xEC, 0xFA, 0xFB, 0xF4, 
-    0xEB, 0xE2, 0xDA, 0xDA, 0xE2, 0xF1, 0xFE, 0x07, 0x04, 0xFB, 0xED, 0xE5, 
-    0xEC, 0xF9, 0xF9, 0xF5, 0xE8, 0xDB, 0xD5, 0xCF, 0xE0, 0xF5, 0x0B, 0x15, 
-    0x0D, 0xF6, 0xD9, 0xC4, 0xBF, 0xC8, 0xDD, 0xE6, 0xF2, 0xFA, 0xF5, 0xF6, 
-    0xEB, 0xEE, 0xF3, 0xF5, 0xEC, 0xDD, 0xCF, 0xCD, 0xD4, 0xD9, 0xEE, 0xFE, 
-    0x10, 0x0F, 0x03, 0xF6, 0xEF, 0xEB, 0xED, 0xFD, 0x04, 0x16, 0x18, 0x18, 
-    0x10, 0x01, 0xF0, 0xED, 0xEE, 0xF4, 0xF7, 0xF1, 0xF1, 0xEF, 0xF0, 0xED, 
-    0xF4, 0xFE, 0x10, 0x13, 0x11, 0x01, 0xF5, 0xF5, 0xF8, 0x0D, 0x1D, 0x2D, 
-    0x36, 0x2F, 0x22, 0x12, 0x0A, 0x11, 0x21, 0x2E, 0x2B, 0x20, 0x13, 0x09, 
-    0x00, 0x0A, 0x18, 0x2C, 0x37, 0x31, 0x26, 0x18, 0x0E, 0x14, 0x21, 0x30, 
-    0x3B, 0x39, 0x35, 0x27, 0x1D, 0x12, 0x13, 0x1D, 0x2C, 0x2A, 0x1D, 0x0E, 
-    0x0C, 0x0A, 0x0C, 0x14, 0x1E, 0x32, 0x34, 0x38, 0x2C, 0x21, 0x18, 0x14, 
-    0x16, 0x19, 0x1C, 0x1C, 0x20, 0x14, 0x0A, 0x02, 0xFF, 0x07, 0x12, 0x17, 
-    0x15, 0x10, 0x02, 0xF9, 0xF0, 0xF1, 0xFA, 0x04, 0x0C, 0x03, 0xF0, 0xDF, 
-    0xD6, 0xDD, 0xF1, 0x02, 0x12, 0x16, 0x10, 0xFF, 0xEA, 0xE4, 0xEF, 0x04, 
-    0x12, 0x12, 0x09, 0x02, 0xFA, 0xF6, 0xFD, 0x0B, 0x1A, 0x22, 0x1E, 0x0B, 
-    0xF6, 0xE8, 0xEB, 0xF9, 0x06, 0x11, 0x0F, 0x08, 0x00, 0xF7, 0xF1, 0xED, 
-    0xF2, 0xFB, 0x01, 0xFD, 0xF9, 0xF9, 0xF5, 0xFB, 0xF9, 0x01, 0x0B, 0x0E, 
-    0x0E, 0x02, 0xF7, 0xEB, 0xEE, 0xEF, 0xF4, 0xF8, 0xFF, 0x02, 0xF7, 0xEC, 
-    0xDD, 0xDB, 0xEB, 0xFC, 0x09, 0x0B, 0x03, 0xF7, 0xE8, 0xE3, 0xE8, 0xF8, 
-    0x0D, 0x16, 0x11, 0x00, 0xE7, 0xD3, 0xD4, 0xE2, 0xEE, 0xF6, 0xF6, 0xF0, 
-    0xE3, 0xD7, 0xD3, 0xDD, 0xEC, 0xF3, 0xEB, 0xDB, 0xD1, 0xC7, 0xCC, 0xDA, 
-    0xED, 0x01, 0x0C, 0x07, 0xF9, 0xE5, 0xD6, 0xD6, 0xDC, 0xE8, 0xF0, 0xF8, 
-    0xFF, 0xFF, 0xFC, 0xF6, 0xEA, 0xE9, 0xE6, 0xE5, 0xDE, 0xD5, 0xD3, 0xD1, 
-    0xD5, 0xD8, 0xE1, 0xEA, 0xF3, 0xF4, 0xE9, 0xD8, 0xC5, 0xC2, 0xCA, 0xDA, 
-    0xED, 0xFF, 0x0A, 0x06, 0xF5, 0xE2, 0xDF, 0xE7, 0xF8, 0x07, 0x0A, 0x04, 
-    0xFD, 0xF5, 0xF4, 0xFF, 0x10, 0x1B, 0x1A, 0x10, 0xFA, 0xEB, 0xE5, 0xEE, 
-    0x03, 0x12, 0x1E, 0x1C, 0x15, 0x05, 0xF9, 0xF3, 0xFA, 0x0B, 0x18, 0x16, 
-    0x08, 0xFF, 0xFA, 0xFE, 0xFE, 0x05, 0x10, 0x15, 0x1A, 0x18, 0x10, 0x07, 
-    0x07, 0x0B, 0x13, 0x1B, 0x23, 0x26, 0x28, 0x25, 0x1A, 0x15, 0x17, 0x1A, 
-    0x1E, 0x20, 0x1F, 0x1B, 0x16, 0x12, 0x14, 0x20, 0x2E, 0x3E, 0x42, 0x35, 
-    0x21, 0x0B, 0x03, 0x0B, 0x1E, 0x2E, 0x39, 0x3E, 0x34, 0x23, 0x10, 0x06, 
-    0x0F, 0x1F, 0x28, 0x23, 0x17, 0x0D, 0x03, 0x01, 0x0B, 0x16, 0x1F, 0x1F, 
-    0x10, 0xFF, 0xF1, 0xEA, 0xF3, 0x04, 0x11, 0x1E, 0x20, 0x18, 0x0D, 0x01, 
-    0xF8, 0xF6, 0xFE, 0x07, 0x07, 0x00, 0xFB, 0xF4, 0xF7, 0xF7, 0xF9, 0xFF, 
-    0x00, 0x05, 0x02, 0xFC, 0xF6, 0xF4, 0xF6, 0xFF, 0x07, 0x10, 0x16, 0x17, 
-    0x0B, 0xFB, 0xED, 0xEC, 0xF8, 0x04, 0x08, 0x04, 0xFA, 0xEC, 0xE2, 0xDD, 
-    0xE8, 0xF6, 0x06, 0x0D, 0x0C, 0xFE, 0xEB, 0xE1, 0xE3, 0xF3, 0x07, 0x13, 
-    0x13, 0x0E, 0x01, 0xF8, 0xF4, 0xFD, 0x0A, 0x0A, 0x01, 0xF0, 0xDE, 0xD8, 
-    0xD7, 0xE3, 0xF4, 0x04, 0x08, 0xFE, 0xEF, 0xDA, 0xD7, 0xDA, 0xE2, 0xEF, 
-    0xFC, 0x03, 0x06, 0x07, 0xFF, 0xF6, 0xEE, 0xF0, 0xF0, 0xEB, 0xE8, 0xE1, 
-    0xDF, 0xDF, 0xDF, 0xE7, 0xEE, 0xF2, 0xF6, 0xF5, 0xEE, 0xE3, 0xD8, 0xD8, 
-    0xDC, 0xE9, 0xFC, 0x0B, 0x11, 0x0A, 0xF8, 0xE4, 0xDC, 0xE1, 0xEE, 0xF3, 
-    0xEF, 0xEA, 0xE0, 0xD6, 0xD7, 0xE2, 0xF2, 0xFF, 0xFE, 0xF1, 0xDF, 0xCF, 
-    0xC9, 0xD0, 0xE3, 0xF3, 0xFF, 0x02, 0xF6, 0xE6, 0xD6, 0xCF, 0xD6, 0xE5, 
-    0xEE, 0xE7, 0xDC, 0xD0, 0xCC, 0xD1, 0xDD, 0xE9, 0xF3, 0xF8, 0xF4, 0xF1, 
-    0xED, 0xEF, 0xF5, 0xFA, 0x02, 0x0A, 0x10, 0x17, 0x1A, 0x12, 0x0B, 0x04, 
-    0x03, 0x06, 0x02, 0xFE, 0xFA, 0xF8, 0xF5, 0xF4, 0xF7, 0xFF, 0x0B, 0x18, 
-    0x18, 0x12, 0x02, 0xF5, 0xF2, 0xF5, 0x02, 0x13, 0x23, 0x28, 0x27, 0x15, 
-    0x05, 0xFF, 0x08, 0x1A, 0x23, 0x20, 0x17, 0x0F, 0x0A, 0x0E, 0x1E, 0x31, 
-    0x38, 0x36, 0x27, 0x16, 0x04, 0x01, 0x0C, 0x18, 0x26, 0x32, 0x34, 0x2F, 
-    0x25, 0x1A, 0x15, 0x15, 0x1E, 0x21, 0x1C, 0x15, 0x10, 0x13, 0x1A, 0x21, 
-    0x27, 0x28, 0x28, 0x20, 0x19, 0x12, 0x0F, 0x14, 0x15, 0x1C, 0x19, 0x1A, 
-    0x21, 0x1C, 0x13, 0x04, 0xF7, 0xF9, 0x04, 0x0F, 0x14, 0x17, 0x0F, 0x07, 
-    0x02, 0xFE, 0x04, 0x0D, 0x18, 0x19, 0x17, 0x0C, 0xFF, 0xF7, 0xF9, 0xFE, 
-    0x05, 0x0C, 0x0C, 0x05, 0xF9, 0xEE, 0xEC, 0xFA, 0x07, 0x0C, 0x01, 0xF4, 
-    0xE9, 0xE1, 0xE8, 0xF8, 0x08, 0x15, 0x1B, 0x10, 0x04, 0xF7, 0xF2, 0xF6, 
-    0xFC, 0xFF, 0x06, 0x09, 0x0A, 0x0A, 0x03, 0x02, 0x00, 0x04, 0x04, 0xFE, 
-    0xF7, 0xF3, 0xF3, 0xF6, 0xFD, 0x04, 0x0E, 0x0E, 0x0A, 0x04, 0xF8, 0xED, 
-    0xE3, 0xE1, 0xE4, 0xE9, 0xF6, 0x03, 0x0A, 0x02, 0xF2, 0xE3, 0xDE, 0xE3, 
-    0xEA, 0xEE, 0xED, 0xEB, 0xE8, 0xE3, 0xE4, 0xEE, 0xFC, 0x04, 0x03, 0xFA, 
-    0xEE, 0xE7, 0xE8, 0xF1, 0x01, 0x0E, 0x13, 0x13, 0x09, 0xF5, 0xE6, 0xE0, 
-    0xE6, 0xF0, 0xF3, 0xEB, 0xE2, 0xD4, 0xCF, 0xD4, 0xDB, 0xEA, 0xF0, 0xF3, 
-    0xEA, 0xE3, 0xDC, 0xDA, 0xDE, 0xE5, 0xE6, 0xE9, 0xEE, 0xF3, 0xF6, 0xF0, 
-    0xED, 0xEA, 0xF3, 0xF3, 0xEE, 0xEB, 0xE5, 0xE3, 0xDF, 0xDD, 0xE0, 0xE8, 
-    0xEE, 0xF1, 0xEF, 0xE7, 0xDE, 0xD7, 0xD5, 0xD9, 0xE0, 0xEC, 0xF6, 0xFC, 
-    0xF7, 0xE9, 0xDA, 0xD6, 0xE0, 0xEB, 0xEE, 0xEA, 0xE4, 0xE1, 0xE3, 0xEE, 
-    0xFE, 0x10, 0x1B, 0x19, 0x0E, 0xFF, 0xF4, 0xF4, 0xFD, 0x0A, 0x14, 0x1B, 
-    0x1D, 0x18, 0x0D, 0x03, 0x00, 0x04, 0x0D, 0x0F, 0x08, 0x02, 0x00, 0x02, 
-    0x0A, 0x14, 0x1B, 0x1C, 0x1A, 0x13, 0x0E, 0x0A, 0x0A, 0x0F, 0x14, 0x1A, 
-    0x1A, 0x1C, 0x22, 0x28, 0x23, 0x19, 0x13, 0x13, 0x1C, 0x1F, 0x1F, 0x1B, 
-    0x15, 0x14, 0x12, 0x14, 0x1A, 0x22, 0x27, 0x25, 0x22, 0x19, 0x11, 0x10, 
-    0x11, 0x19, 0x26, 0x2C, 0x2F, 0x2B, 0x1D, 0x15, 0x15, 0x21, 0x2D, 0x2D, 
-    0x26, 0x19, 0x10, 0x0E, 0x11, 0x1B, 0x22, 0x23, 0x1D, 0x10, 0x00, 0xF3, 
-    0xF1, 0xF7, 0x00, 0x03, 0x08, 0x08, 0x0C, 0x0D, 0x08, 0x09, 0x06, 0x0C, 
-    0x0B, 0x01, 0xFB, 0xF6, 0xF8, 0x02, 0x0D, 0x15, 0x1A, 0x14, 0x0C, 0x05, 
-    0x00, 0xFB, 0xF8, 0xF9, 0xFB, 0x02, 0x0D, 0x19, 0x1C, 0x18, 0x09, 0xFB, 
-    0xF8, 0xFC, 0xFF, 0xFC, 0xF8, 0xF3, 0xF3, 0xF3, 0xF5, 0xF9, 0xFF, 0x01, 
-    0xFE, 0xF5, 0xEA, 0xE5, 0xE9, 0xF4, 0x01, 0x0D, 0x13, 0x14, 0x0D, 0xFE, 
-    0xF4, 0xF2, 0xF9, 0x06, 0x05, 0x00, 0xF5, 0xEA, 0xE9, 0xEE, 0xF9, 0x00, 
-    0x01, 0xF8, 0xED, 0xE5, 0xE3, 0xE6, 0xF1, 0xF9, 0xFE, 0x00, 0x00, 0x02, 
-    0xFD, 0xF6, 0xEF, 0xEF, 0xF6, 0xF7, 0xF0, 0xE5, 0xE1, 0xE3, 0xE6, 0xEE, 
-    0xF1, 0xF5, 0xF8, 0xF7, 0xF2, 0xEB, 0xE3, 0xDE, 0xDF, 0xE0, 0xE7, 0xEE, 
-    0xF4, 0xF8, 0xF4, 0xEA, 0xE0, 0xDF, 0xE3, 0xE8, 0xE8, 0xE0, 0xDA, 0xD6, 
-    0xD9, 0xE6, 0xF7, 0x04, 0x09, 0x02, 0xF4, 0xE7, 0xDE, 0xE0, 0xE8, 0xF1, 
-    0xF8, 0xFD, 0xFE, 0xF6, 0xE5, 0xD7, 0xD2, 0xDB, 0xE4, 0xE3, 0xD8, 0xCC, 
-    0xC8, 0xCF, 0xD7, 0xE2, 0xE9, 0xE8, 0xE4, 0xDA, 0xD3, 0xD1, 0xD6, 0xDF, 
-    0xEC, 0xF6, 0xFA, 0xFC, 0xFF, 0x01, 0x01, 0x00, 0x02, 0x0C, 0x13, 0x15, 
-    0x12, 0x0F, 0x0D, 0x10, 0x14, 0x19, 0x1D, 0x21, 0x20, 0x17, 0x0D, 0x04, 
-    0xFD, 0xFB, 0xFB, 0xFD, 0x03, 0x06, 0x0C, 0x09, 0x02, 0xFD, 0x01, 0x0E, 
-    0x16, 0x12, 0x08, 0xFD, 0xF8, 0x00, 0x0E, 0x1E, 0x2B, 0x31, 0x2E, 0x28, 
-    0x1E, 0x18, 0x19, 0x20, 0x29, 0x2D, 0x2D, 0x29, 0x26, 0x24, 0x22, 0x21, 
-    0x28, 0x2B, 0x26, 0x1B, 0x0B, 0x05, 0x08, 0x11, 0x1B, 0x23, 0x25, 0x1F, 
-    0x13, 0x08, 0x01, 0xFF, 0x02, 0x09, 0x0F, 0x13, 0x17, 0x1C, 0x1D, 0x18, 
-    0x0D, 0x05, 0x06, 0x0B, 0x0A, 0x05, 0xFF, 0xFD, 0x00, 0x05, 0x09, 0x10, 
-    0x14, 0x14, 0x0B, 0xFC, 0xF4, 0xF2, 0xFB, 0x08, 0x14, 0x1B, 0x1E, 0x1C, 
-    0x15, 0x0A, 0x00, 0xFE, 0x07, 0x0E, 0x0D, 0x00, 0xF0, 0xE6, 0xE8, 0xF5, 
-    0x04, 0x0C, 0x09, 0x00, 0xF3, 0xEA, 0xE8, 0xEC, 0xF5, 0xFE, 0x03, 0x05, 
-    0x04, 0x02, 0xFE, 0xF8, 0xF6, 0xFC, 0x06, 0x08, 0x02, 0xF9, 0xF6, 0xF8, 
-    0xFD, 0x04, 0x09, 0x0A, 0x09, 0x05, 0x03, 0x01, 0xFD, 0xFB, 0xFD, 0x02, 
-    0x08, 0x0A, 0x09, 0x03, 0xFC, 0xF3, 0xEB, 0xEA, 0xEE, 0xF0, 0xEA, 0xE0, 
-    0xD4, 0xD0, 0xD5, 0xE0, 0xEF, 0xFA, 0xFA, 0xEF, 0xE0, 0xD3, 0xD1, 0xDA, 
-    0xE8, 0xF6, 0x00, 0x03, 0x01, 0xFB, 0xF5, 0xF2, 0xF8, 0x03, 0x09, 0x05, 
-    0xF7, 0xE9, 0xE0, 0xE6, 0xF5, 0x02, 0x09, 0x06, 0xFA, 0xED, 0xE2, 0xDB, 
-    0xDD, 0xE4, 0xEB, 0xEC, 0xE7, 0xE2, 0xE1, 0xE5, 0xE6, 0xE5, 0xE5, 0xEC, 
-    0xF1, 0xED, 0xE5, 0xDC, 0xD7, 0xDA, 0xE2, 0xEB, 0xF4, 0xF8, 0xF4, 0xEE, 
-    0xE6, 0xE2, 0xE1, 0xE5, 0xEA, 0xF1, 0xF6, 0xF8, 0xF3, 0xE8, 0xDD, 0xD9, 
-    0xE0, 0xEF, 0xF8, 0xF2, 0xE5, 0xD6, 0xD1, 0xD8, 0xE9, 0xFA, 0x06, 0x08, 
-    0x01, 0xF5, 0xE8, 0xE4, 0xEB, 0xF9, 0x04, 0x0B, 0x0D, 0x0F, 0x0E, 0x0D, 
-    0x0C, 0x0F, 0x15, 0x16, 0x0D, 0xFE, 0xF3, 0xF2, 0xFB, 0x09, 0x16, 0x1E, 
-    0x20, 0x18, 0x0D, 0x04, 0x01, 0x04, 0x0A, 0x11, 0x16, 0x1B, 0x23, 0x2C, 
-    0x30, 0x2E, 0x25, 0x20, 0x22, 0x24, 0x22, 0x1C, 0x16, 0x13, 0x16, 0x1C, 
-    0x23, 0x28, 0x2C, 0x2A, 0x21, 0x16, 0x0B, 0x09, 0x10, 0x1B, 0x24, 0x28, 
-    0x27, 0x23, 0x1B, 0x13, 0x0E, 0x12, 0x1A, 0x1D, 0x17, 0x0D, 0x03, 0x01, 
-    0x09, 0x19, 0x27, 0x2C, 0x26, 0x16, 0x07, 0xFE, 0xFE, 0x09, 0x18, 0x1F, 
-    0x1F, 0x19, 0x12, 0x0E, 0x0C, 0x0A, 0x0A, 0x0C, 0x0D, 0x07, 0xFB, 0xF0, 
-    0xE9, 0xEB, 0xF2, 0xFA, 0x02, 0x06, 0x05, 0xFF, 0xF7, 0xEF, 0xEA, 0xEC, 
-    0xF4, 0xF9, 0x00, 0x07, 0x0D, 0x0D, 0x07, 0xFD, 0xF8, 0xFE, 0x08, 0x0F, 
-    0x0C, 0x03, 0xF7, 0xF0, 0xF3, 0x00, 0x12, 0x20, 0x23, 0x19, 0x0B, 0xFE, 
-    0xF8, 0xFC, 0x06, 0x10, 0x17, 0x19, 0x13, 0x07, 0xF9, 0xF0, 0xF4, 0x00, 
-    0x0A, 0x08, 0xFC, 0xEF, 0xE7, 0xE8, 0xF0, 0xFB, 0x03, 0x06, 0x02, 0xF9, 
-    0xEE, 0xE6, 0xE5, 0xEC, 0xF6, 0xFF, 0x02, 0xFE, 0xF7, 0xF1, 0xED, 0xEB, 
-    0xEF, 0xF3, 0xF3, 0xEC, 0xE5, 0xDF, 0xDC, 0xE1, 0xEB, 0xF6, 0xFF, 0x04, 
-    0x01, 0xF8, 0xE9, 0xDC, 0xD7, 0xDA, 0xE1, 0xE8, 0xF0, 0xF4, 0xEF, 0xE4, 
-    0xD8, 0xD4, 0xDE, 0xED, 0xF2, 0xEA, 0xDB, 0xCF, 0xCB, 0xD2, 0xE1, 0xF4, 
-    0x02, 0x04, 0xFC, 0xEE, 0xE0, 0xDA, 0xE0, 0xED, 0xFB, 0x01, 0xFF, 0xFB, 
-    0xF6, 0xF5, 0xF8, 0x00, 0x0A, 0x0A, 0xFE, 0xEA, 0xD9, 0xD4, 0xDB, 0xE8, 
-    0xF6, 0x00, 0xFF, 0xF5, 0xE4, 0xD5, 0xCD, 0xCC, 0xD4, 0xDD, 0xE5, 0xEB, 
-    0xF1, 0xF2, 0xEF, 0xE8, 0xE3, 0xE7, 0xF2, 0xFA, 0xF8, 0xF1, 0xEA, 0xE9, 
-    0xF1, 0x01, 0x12, 0x20, 0x26, 0x23, 0x19, 0x09, 0xFD, 0xF9, 0x02, 0x12, 
-    0x22, 0x2C, 0x2B, 0x1F, 0x0E, 0x00, 0xFE, 0x0C, 0x1D, 0x22, 0x16, 0x01, 
-    0xEE, 0xE7, 0xF0, 0x02, 0x16, 0x21, 0x1F, 0x12, 0xFF, 0xF2, 0xF2, 0x00, 
-    0x14, 0x23, 0x2A, 0x29, 0x25, 0x21, 0x1D, 0x1B, 0x1D, 0x26, 0x2D, 0x2D, 
-    0x23, 0x1A, 0x15, 0x1A, 0x25, 0x30, 0x35, 0x31, 0x28, 0x1F, 0x18, 0x13, 
-    0x10, 0x11, 0x16, 0x1D, 0x21, 0x25, 0x27, 0x23, 0x18, 0x0D, 0x0A, 0x0E, 
-    0x15, 0x16, 0x11, 0x07, 0xFC, 0xF6, 0xFB, 0x09, 0x17, 0x1E, 0x19, 0x0A, 
-    0xF8, 0xED, 0xED, 0xF9, 0x08, 0x14, 0x18, 0x15, 0x0D, 0x02, 0xF6, 0xF3, 
-    0xFE, 0x0B, 0x0D, 0x02, 0xF1, 0xE5, 0xE3, 0xEE, 0x00, 0x0F, 0x15, 0x12, 
-    0x07, 0xF8, 0xE9, 0xE2, 0xE8, 0xF5, 0x00, 0x06, 0x02, 0xFB, 0xF5, 0xF3, 
-    0xF5, 0xFC, 0x07, 0x0D, 0x0B, 0x02, 0xF9, 0xF4, 0xF5, 0xFB, 0x05, 0x0F, 
-    0x13, 0x15, 0x12, 0x0B, 0x01, 0xF8, 0xF6, 0xFA, 0x00, 0x07, 0x0C, 0x0D, 
-    0x08, 0xFE, 0xF6, 0xF9, 0x06, 0x12, 0x14, 0x0A, 0xFA, 0xE8, 0xDF, 0xE3, 
-    0xF2, 0x03, 0x0E, 0x0B, 0xFE, 0xED, 0xDF, 0xD7, 0xDA, 0xE5, 0xF2, 0xFA, 
-    0xFA, 0xF5, 0xEC, 0xE8, 0xEB, 0xF6, 0xFF, 0xFA, 0xEA, 0xD6, 0xC7, 0xC3, 
-    0xCB, 0xDB, 0xED, 0xF7, 0xFA, 0xF0, 0xE2, 0xD3, 0xCF, 0xD8, 0xE3, 0xE8, 
-    0xED, 0xF3, 0xF7, 0xF9, 0xF8, 0xF4, 0xEE, 0xED, 0xEC, 0xED, 0xE5, 0xDE, 
-    0xD5, 0xD4, 0xD9, 0xE1, 0xF1, 0xF4, 0xF5, 0xF2, 0xEB, 0xDD, 0xD4, 0xD3, 
-    0xD8, 0xE7, 0xF7, 0xFD, 0xFE, 0xF7, 0xEB, 0xE0, 0xE0, 0xEF, 0xFC, 0xFF, 
-    0xF6, 0xEC, 0xDD, 0xD7, 0xDA, 0xE6, 0xF5, 0x02, 0xFF, 0xF7, 0xEA, 0xDF, 
-    0xE5, 0xF1, 0x04, 0x0C, 0x11, 0x14, 0x16, 0x15, 0x0E, 0x16, 0x20, 0x2B, 
-    0x30, 0x25, 0x13, 0x08, 0x05, 0x05, 0x11, 0x15, 0x18, 0x1F, 0x16, 0x06, 
-    0xFA, 0xF8, 0xFE, 0x03, 0x09, 0x11, 0x0E, 0x0D, 0x0D, 0x0E, 0x10, 0x0D, 
-    0x14, 0x1E, 0x20, 0x21, 0x18, 0x0E, 0x0D, 0x0E, 0x18, 0x23, 0x30, 0x35, 
-    0x32, 0x26, 0x17, 0x0F, 0x10, 0x18, 0x1E, 0x21, 0x1E, 0x1A, 0x11, 0x08, 
-    0xFE, 0xFA, 0xFE, 0x07, 0x08, 0xFD, 0xEE, 0xE2, 0xE5, 0xEE, 0xFE, 0x0B, 
-    0x0F, 0x0C, 0x07, 0x01, 0xF5, 0xF4, 0xFA, 0x02, 0x0B, 0x0E, 0x0D, 0x07, 
-    0x00, 0xFA, 0xF5, 0xF7, 0x02, 0x0B, 0x0D, 0x08, 0x01, 0xFC, 0xFB, 0xFD, 
-    0x02, 0x0A, 0x12, 0x16, 0x12, 0x07, 0xF8, 0xF1, 0xF3, 0xFF, 0x0B, 0x13, 
-    0x18, 0x16, 0x0C, 0x00, 0xF8, 0xFE, 0x0D, 0x18, 0x17, 0x0B, 0xFA, 0xEB, 
-    0xE7, 0xF0, 0x05, 0x1A, 0x29, 0x2B, 0x22, 0x16, 0x0B, 0x06, 0x0B, 0x1A, 
-    0x28, 0x2E, 0x2E, 0x28, 0x21, 0x1E, 0x25, 0x32, 0x39, 0x34, 0x24, 0x13, 
-    0x09, 0x06, 0x09, 0x16, 0x23, 0x2B, 0x26, 0x17, 0x05, 0xF7, 0xF0, 0xF0, 
-    0xF5, 0xFA, 0xFF, 0xFF, 0xFD, 0xF7, 0xEF, 0xEA, 0xEC, 0xF1, 0xF3, 0xEE, 
-    0xE6, 0xDF, 0xDA, 0xD7, 0xD9, 0xE3, 0xEE, 0xF3, 0xEF, 0xE2, 0xD4, 0xC6, 
-    0xBE, 0xBE, 0xC3, 0xCD, 0xD6, 0xDB, 0xD9, 0xCC, 0xBF, 0xB9, 0xBF, 0xCC, 
-    0xD4, 0xCF, 0xC4, 0xBC, 0xB9, 0xBC, 0xC4, 0xD1, 0xDD, 0xE3, 0xDF, 0xD4, 
-    0xC9, 0xC0, 0xC2, 0xCC, 0xD7, 0xE0, 0xE3, 0xDF, 0xDB, 0xD9, 0xDC, 0xE6, 
-    0xF2, 0xFC, 0xFB, 0xF1, 0xE4, 0xDA, 0xD8, 0xDF, 0xEA, 0xF7, 0xFF, 0x04, 
-    0x03, 0xFE, 0xF9, 0xF6, 0xFB, 0x01, 0x06, 0x0B, 0x0E, 0x11, 0x0F, 0x0A, 
-    0x05, 0x06, 0x0A, 0x0C, 0x09, 0x01, 0xFC, 0xFA, 0xF9, 0xFE, 0x07, 0x12, 
-    0x1C, 0x21, 0x20, 0x17, 0x0E, 0x0B, 0x13, 0x20, 0x2E, 0x3A, 0x41, 0x41, 
-    0x3C, 0x33, 0x2B, 0x2B, 0x31, 0x38, 0x37, 0x2E, 0x23, 0x1B, 0x19, 0x1F, 
-    0x29, 0x33, 0x36, 0x30, 0x23, 0x14, 0x0B, 0x09, 0x0F, 0x17, 0x1F, 0x25, 
-    0x29, 0x25, 0x1A, 0x0F, 0x0B, 0x10, 0x15, 0x17, 0x11, 0x08, 0x00, 0xFC, 
-    0xF9, 0xF9, 0xFB, 0xFE, 0x01, 0x01, 0xFF, 0xFB, 0xF5, 0xF2, 0xF2, 0xF3, 
-    0xF3, 0xF4, 0xF6, 0xF6, 0xF2, 0xED, 0xEF, 0xFA, 0x03, 0x05, 0x00, 0xF8, 
-    0xF1, 0xED, 0xEA, 0xEC, 0xF5, 0x00, 0x08, 0x07, 0xFF, 0xF4, 0xEA, 0xE7, 
-    0xEB, 0xF3, 0xF9, 0xFB, 0xF8, 0xF5, 0xF1, 0xEC, 0xEF, 0xF8, 0xFE, 0xFE, 
-    0xF4, 0xE9, 0xE3, 0xE4, 0xED, 0xFD, 0x0D, 0x18, 0x17, 0x0E, 0xFD, 0xEF, 
-    0xE9, 0xEA, 0xF1, 0xF9, 0x00, 0x06, 0x09, 0x08, 0x05, 0x06, 0x0D, 0x14, 
-    0x15, 0x0E, 0x06, 0x02, 0x04, 0x09, 0x12, 0x1F, 0x2D, 0x34, 0x33, 0x29, 
-    0x1D, 0x13, 0x0D, 0x10, 0x19, 0x23, 0x2A, 0x2E, 0x2B, 0x23, 0x18, 0x13, 
-    0x19, 0x23, 0x29, 0x27, 0x22, 0x1B, 0x15, 0x0F, 0x0C, 0x10, 0x19, 0x1F, 
-    0x1B, 0x10, 0x06, 0x00, 0x02, 0x08, 0x0F, 0x14, 0x15, 0x13, 0x0A, 0xFE, 
-    0xF7, 0xF9, 0x03, 0x09, 0x05, 0xFC, 0xF0, 0xE6, 0xE0, 0xDF, 0xE3, 0xE8, 
-    0xEC, 0xEA, 0xE2, 0xD7, 0xD1, 0xD0, 0xD4, 0xD8, 0xDA, 0xDD, 0xDF, 0xDE, 
-    0xDA, 0xD3, 0xD1, 0xD7, 0xDF, 0xDE, 0xD6, 0xCB, 0xC5, 0xC4, 0xC5, 0xCA, 
-    0xD2, 0xDC, 0xE6, 0xEA, 0xE8, 0xE0, 0xD8, 0xD2, 0xD2, 0xD5, 0xDB, 0xE0, 
-    0xE4, 0xE3, 0xDD, 0xD5, 0xD1, 0xD6, 0xDE, 0xE1, 0xDA, 0xCF, 0xC8, 0xC6, 
-    0xC8, 0xCB, 0xD2, 0xDC, 0xE4, 0xE4, 0xDD, 0xD4, 0xD1, 0xD8, 0xE5, 0xF1, 
-    0xFB, 0xFE, 0xFC, 0xF5, 0xEB, 0xE7, 0xED, 0xFA, 0x05, 0x0A, 0x0A, 0x09, 
-    0x08, 0x0B, 0x0F, 0x15, 0x19, 0x1D, 0x1C, 0x18, 0x16, 0x15, 0x16, 0x1A, 
-    0x1F, 0x25, 0x28, 0x29, 0x2A, 0x27, 0x25, 0x23, 0x28, 0x30, 0x34, 0x33, 
-    0x2E, 0x2A, 0x27, 0x28, 0x28, 0x2B, 0x32, 0x3D, 0x43, 0x45, 0x42, 0x3D, 
-    0x39, 0x36, 0x36, 0x3A, 0x3E, 0x3F, 0x3B, 0x36, 0x32, 0x31, 0x38, 0x3E, 
-    0x41, 0x3A, 0x2F, 0x25, 0x1F, 0x1E, 0x22, 0x2B, 0x37, 0x3F, 0x3E, 0x36, 
-    0x2B, 0x22, 0x1E, 0x1D, 0x1C, 0x1A, 0x19, 0x18, 0x14, 0x0F, 0x0C, 0x0B, 
-    0x0F, 0x10, 0x0D, 0x07, 0x00, 0xFE, 0x00, 0x03, 0x06, 0x08, 0x07, 0xFF, 
-    0xF4, 0xEC, 0xE6, 0xE1, 0xE0, 0xE4, 0xEA, 0xEF, 0xF4, 0xF7, 0xF6, 0xF1, 
-    0xE6, 0xE0, 0xE0, 0xE2, 0xE2, 0xDF, 0xDB, 0xDA, 0xDA, 0xDA, 0xD9, 0xDC, 
-    0xE0, 0xE0, 0xDA, 0xD2, 0xCC, 0xCB, 0xCE, 0xD3, 0xDB, 0xE3, 0xEA, 0xED, 
-    0xEC, 0xE8, 0xE7, 0xED, 0xF8, 0x00, 0xFF, 0xF8, 0xEF, 0xEA, 0xE8, 0xEA, 
-    0xEC, 0xEE, 0xEE, 0xEC, 0xE9, 0xE6, 0xE4, 0xE5, 0xEA, 0xEF, 0xF2, 0xF4, 
-    0xF1, 0xF0, 0xEE, 0xEC, 0xED, 0xF2, 0xF7, 0xF6, 0xEF, 0xE7, 0xE4, 0xE5, 
-    0xE5, 0xE5, 0xE9, 0xEF, 0xF2, 0xF1, 0xED, 0xE8, 0xE4, 0xE4, 0xE8, 0xEE, 
-    0xF3, 0xF7, 0xFA, 0xFA, 0xF6, 0xEF, 0xEA, 0xEA, 0xED, 0xED, 0xEA, 0xE8, 
-    0xE9, 0xEE, 0xF0, 0xF5, 0xFC, 0x04, 0x05, 0xFE, 0xF3, 0xE9, 0xE7, 0xEB, 
-    0xF1, 0xF7, 0xFD, 0x00, 0x02, 0x00, 0xFA, 0xF5, 0xF8, 0xFE, 0x01, 0xFF, 
-    0xF9, 0xF4, 0xF1, 0xF4, 0xF7, 0xFB, 0x00, 0x03, 0x02, 0xFF, 0xFB, 0xF9, 
-    0xFE, 0x06, 0x0C, 0x0F, 0x0D, 0x0B, 0x09, 0x06, 0x01, 0xFB, 0x01, 0x09, 
-    0x0D, 0x0A, 0x03, 0x01, 0x02, 0x04, 0x02, 0x03, 0x06, 0x0C, 0x0F, 0x0F, 
-    0x0D, 0x0C, 0x0D, 0x10, 0x12, 0x13, 0x14, 0x15, 0x13, 0x11, 0x0F, 0x0F, 
-    0x14, 0x19, 0x18, 0x13, 0x0C, 0x08, 0x08, 0x0A, 0x0E, 0x15, 0x1C, 0x21, 
-    0x1F, 0x16, 0x0C, 0x06, 0x07, 0x0D, 0x10, 0x13, 0x16, 0x1B, 0x1F, 0x21, 
-    0x20, 0x24, 0x2A, 0x2D, 0x2A, 0x21, 0x1A, 0x16, 0x19, 0x1C, 0x21, 0x23, 
-    0x23, 0x1F, 0x17, 0x12, 0x0D, 0x0A, 0x09, 0x0B, 0x0D, 0x0F, 0x11, 0x13, 
-    0x14, 0x12, 0x0E, 0x0E, 0x11, 0x12, 0x10, 0x0C, 0x0A, 0x0C, 0x0E, 0x0D, 
-    0x0B, 0x09, 0x07, 0x02, 0xFC, 0xF7, 0xF5, 0xF7, 0xFB, 0xFF, 0x02, 0x06, 
-    0x09, 0x08, 0x03, 0xFB, 0xF7, 0xFB, 0x00, 0x00, 0xF9, 0xF0, 0xE7, 0xE3, 
-    0xE1, 0xE1, 0xE1, 0xE0, 0xDD, 0xD9, 0xD7, 0xD6, 0xD5, 0xD7, 0xDA, 0xDD, 
-    0xE0, 0xE2, 0xE3, 0xE2, 0xDF, 0xDB, 0xDD, 0xE0, 0xE1, 0xDC, 0xD3, 0xCC, 
-    0xCD, 0xD4, 0xDA, 0xDE, 0xE1, 0xE6, 0xE9, 0xEB, 0xEC, 0xEE, 0xEE, 0xEF, 
-    0xF1, 0xF2, 0xF4, 0xF7, 0xF8, 0xF7, 0xF3, 0xEF, 0xEE, 0xF0, 0xF0, 0xEC, 
-    0xE7, 0xE4, 0xE5, 0xE7, 0xEA, 0xED, 0xF0, 0xF3, 0xF3, 0xF1, 0xF0, 0xEF, 
-    0xF1, 0xF5, 0xFC, 0x04, 0x0B, 0x11, 0x12, 0x0D, 0x06, 0x01, 0x04, 0x05, 
-    0x01, 0xFA, 0xF3, 0xF0, 0xF2, 0xF5, 0xF7, 0xF8, 0xF9, 0xF8, 0xF6, 0xF4, 
-    0xF4, 0xF6, 0xFA, 0x00, 0x03, 0x02, 0xFE, 0xFB, 0xFA, 0xF6, 0xEE, 0xE8, 
-    0xEA, 0xED, 0xED, 0xE8, 0xE3, 0xE2, 0xE6, 0xEA, 0xEB, 0xEA, 0xEB, 0xED, 
-    0xEF, 0xF0, 0xF0, 0xF1, 0xF2, 0xF1, 0xEF, 0xEF, 0xF0, 0xF1, 0xEE, 0xE8, 
-    0xE3, 0xE5, 0xEC, 0xF1, 0xF2, 0xEF, 0xEB, 0xEA, 0xED, 0xEF, 0xF2, 0xF3, 
-    0xF5, 0xF4, 0xF5, 0xF5, 0xF2, 0xF0, 0xF0, 0xF4, 0xF6, 0xF5, 0xF4, 0xF6, 
-    0xF7, 0xF8, 0xF8, 0xFD, 0x04, 0x08, 0x07, 0x01, 0xFE, 0x02, 0x0B, 0x12, 
-    0x16, 0x17, 0x16, 0x13, 0x0F, 0x0A, 0x07, 0x04, 0x03, 0x03, 0x04, 0x07, 
-    0x0C, 0x10, 0x10, 0x0B, 0x08, 0x0B, 0x0E, 0x0D, 0x08, 0x05, 0x05, 0x0B, 
-    0x13, 0x17, 0x17, 0x16, 0x15, 0x12, 0x0F, 0x0B, 0x09, 0x0B, 0x0F, 0x13, 
-    0x16, 0x19, 0x1A, 0x1A, 0x16, 0x11, 0x0E, 0x11, 0x15, 0x14, 0x10, 0x0B, 
-    0x0A, 0x0F, 0x16, 0x1C, 0x1D, 0x1B, 0x17, 0x15, 0x16, 0x18, 0x1A, 0x1C, 
-    0x21, 0x24, 0x24, 0x25, 0x25, 0x23, 0x1E, 0x18, 0x19, 0x1E, 0x20, 0x1C, 
-    0x14, 0x10, 0x14, 0x1C, 0x21, 0x21, 0x1F, 0x1D, 0x1B, 0x1A, 0x19, 0x18, 
-    0x16, 0x14, 0x15, 0x16, 0x18, 0x1B, 0x1D, 0x1C, 0x1B, 0x1B, 0x1F, 0x1F, 
-    0x1B, 0x13, 0x0C, 0x09, 0x0A, 0x11, 0x17, 0x19, 0x18, 0x16, 0x12, 0x0D, 
-    0x09, 0x07, 0x06, 0x08, 0x0C, 0x0F, 0x12, 0x15, 0x16, 0x14, 0x10, 0x0F, 
-    0x12, 0x12, 0x0D, 0x05, 0x00, 0x02, 0x08, 0x0D, 0x0D, 0x0B, 0x08, 0x06, 
-    0x02, 0xFF, 0xFF, 0x00, 0x03, 0x05, 0x06, 0x05, 0x04, 0x02, 0x00, 0xFE, 
-    0xFD, 0xFD, 0xFE, 0xFD, 0xFD, 0xFD, 0xFC, 0xFE, 0x02, 0x07, 0x08, 0x08, 
-    0x05, 0x01, 0xFF, 0xFD, 0xFE, 0x01, 0x02, 0x00, 0xFC, 0xFA, 0xF9, 0xF8, 
-    0xF3, 0xED, 0xEB, 0xEE, 0xF1, 0xF1, 0xED, 0xE7, 0xE2, 0xE1, 0xE4, 0xE7, 
-    0xE8, 0xE8, 0xE6, 0xE4, 0xE2, 0xE3, 0xE1, 0xDC, 0xD8, 0xD6, 0xD4, 0xD2, 
-    0xD3, 0xD4, 0xD4, 0xD3, 0xD4, 0xD8, 0xDA, 0xD6, 0xCE, 0xC6, 0xC3, 0xC8, 
-    0xD0, 0xD4, 0xD1, 0xCE, 0xCB, 0xC7, 0xC3, 0xC1, 0xC0, 0xC1, 0xC1, 0xC2, 
-    0xC2, 0xC6, 0xCA, 0xCB, 0xC9, 0xC7, 0xCA, 0xCE, 0xCF, 0xCC, 0xC7, 0xC4, 
-    0xC5, 0xCA, 0xD0, 0xD1, 0xCF, 0xCC, 0xCC, 0xCF, 0xD0, 0xD2, 0xD2, 0xD6, 
-    0xDB, 0xE2, 0xE7, 0xEB, 0xEF, 0xF0, 0xF0, 0xEF, 0xF0, 0xF2, 0xF3, 0xF1, 
-    0xEF, 0xEE, 0xF1, 0xF6, 0xFB, 0xFE, 0xFE, 0xFC, 0xF9, 0xF7, 0xF9, 0xFD, 
-    0x00, 0x03, 0x06, 0x08, 0x0A, 0x0C, 0x0F, 0x10, 0x12, 0x17, 0x1C, 0x20, 
-    0x21, 0x1E, 0x19, 0x16, 0x1B, 0x24, 0x29, 0x27, 0x22, 0x1F, 0x1E, 0x1F, 
-    0x20, 0x21, 0x21, 0x20, 0x1F, 0x1E, 0x20, 0x24, 0x2A, 0x2A, 0x28, 0x28, 
-    0x2A, 0x28, 0x23, 0x1C, 0x18, 0x19, 0x1E, 0x22, 0x22, 0x1F, 0x1B, 0x17, 
-    0x15, 0x13, 0x14, 0x16, 0x17, 0x19, 0x18, 0x19, 0x1A, 0x1B, 0x1A, 0x15, 
-    0x10, 0x11, 0x16, 0x18, 0x12, 0x0A, 0x06, 0x0B, 0x15, 0x1E, 0x21, 0x1E, 
-    0x1B, 0x18, 0x18, 0x17, 0x18, 0x19, 0x1D, 0x1F, 0x1F, 0x1E, 0x1C, 0x1B, 
-    0x19, 0x16, 0x14, 0x14, 0x13, 0x10, 0x09, 0x04, 0x03, 0x08, 0x0F, 0x12, 
-    0x0F, 0x0A, 0x07, 0x07, 0x0B, 0x10, 0x15, 0x17, 0x1A, 0x19, 0x19, 0x17, 
-    0x18, 0x1A, 0x19, 0x14, 0x12, 0x16, 0x19, 0x16, 0x0D, 0x06, 0x04, 0x08, 
-    0x0C, 0x0E, 0x0B, 0x08, 0x07, 0x08, 0x09, 0x0A, 0x08, 0x06, 0x04, 0x03, 
-    0x02, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x02, 0x06, 0x04, 0xFC, 0xF3, 0xEF, 
-    0xF2, 0xF8, 0xFC, 0xFA, 0xF4, 0xEE, 0xE9, 0xE4, 0xE2, 0xE4, 0xE9, 0xEC, 
-    0xEB, 0xE9, 0xE9, 0xEB, 0xEE, 0xF0, 0xF0, 0xF0, 0xF1, 0xF0, 0xE9, 0xDF, 
-    0xD6, 0xD5, 0xDB, 0xE3, 0xE7, 0xE6, 0xE1, 0xDB, 0xD6, 0xD4, 0xD2, 0xD3, 
-    0xD6, 0xD8, 0xD8, 0xD8, 0xD7, 0xD8, 0xD8, 0xD7, 0xD6, 0xD7, 0xDB, 0xDB, 
-    0xD8, 0xD3, 0xD0, 0xD3, 0xDA, 0xE2, 0xE7, 0xE8, 0xE5, 0xE1, 0xDD, 0xDA, 
-    0xDC, 0xDF, 0xE4, 0xE6, 0xE6, 0xE3, 0xE1, 0xE1, 0xE2, 0xE4, 0xE4, 0xE8, 
-    0xED, 0xED, 0xEA, 0xE4, 0xE0, 0xE3, 0xEA, 0xF5, 0xFA, 0xFA, 0xF7, 0xF3, 
-    0xF2, 0xF4, 0xF6, 0xF8, 0xFB, 0xFC, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 0xFD, 
-    0xFC, 0xFE, 0xFF, 0xFB, 0xF4, 0xF0, 0xF2, 0xFA, 0x05, 0x11, 0x19, 0x1B, 
-    0x17, 0x13, 0x13, 0x16, 0x19, 0x1A, 0x1C, 0x1D, 0x1E, 0x21, 0x24, 0x25, 
-    0x26, 0x27, 0x28, 0x28, 0x27, 0x20, 0x15, 0x0F, 0x10, 0x19, 0x24, 0x2C, 
-    0x2C, 0x26, 0x1E, 0x19, 0x19, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x20, 
-    0x1E, 0x1B, 0x1B, 0x1B, 0x1D, 0x1D, 0x1A, 0x12, 0x0D, 0x0D, 0x13, 0x1B, 
-    0x21, 0x24, 0x21, 0x1B, 0x15, 0x12, 0x11, 0x11, 0x12, 0x16, 0x19, 0x19, 
-    0x14, 0x0F, 0x0D, 0x0D, 0x0D, 0x0C, 0x0E, 0x0F, 0x0C, 0x04, 0xFC, 0xF7, 
-    0xF9, 0xFF, 0x05, 0x08, 0x05, 0xFD, 0xF5, 0xEE, 0xEB, 0xEC, 0xF0, 0xF3, 
-    0xF5, 0xF6, 0xF5, 0xF5, 0xF9, 0xFF, 0x05, 0x0A, 0x10, 0x11, 0x0C, 0x04, 
-    0xFE, 0xFE, 0x04, 0x0C, 0x12, 0x13, 0x0F, 0x09, 0x04, 0x02, 0x01, 0x04, 
-    0x06, 0x05, 0x03, 0xFF, 0xFD, 0x00, 0x04, 0x06, 0x05, 0x05, 0x07, 0x05, 
-    0xFE, 0xF4, 0xEF, 0xF1, 0xF9, 0x00, 0x04, 0x05, 0x01, 0xFB, 0xF7, 0xF6, 
-    0xF5, 0xF6, 0xF9, 0xFD, 0x01, 0x03, 0x01, 0x00, 0xFE, 0xFD, 0xFD, 0xFF, 
-    0x00, 0xFA, 0xF0, 0xE6, 0xE3, 0xE8, 0xF0, 0xF3, 0xF3, 0xEF, 0xE9, 0xE0, 
-    0xD7, 0xD0, 0xCF, 0xD2, 0xD7, 0xD8, 0xD4, 0xCE, 0xCA, 0xCC, 0xD0, 0xD3, 
-    0xD5, 0xD6, 0xD4, 0xCD, 0xC4, 0xBF, 0xC0, 0xC6, 0xD0, 0xD8, 0xDC, 0xDB, 
-    0xD8, 0xD5, 0xD5, 0xD8, 0xDC, 0xDF, 0xE1, 0xE0, 0xDE, 0xDB, 0xDC, 0xDE, 
-    0xE0, 0xDF, 0xE1, 0xE5, 0xE5, 0xE0, 0xD8, 0xD4, 0xD6, 0xDA, 0xE0, 0xE5, 
-    0xE8, 0xE7, 0xE4, 0xE0, 0xDE, 0xDF, 0xE3, 0xE8, 0xEB, 0xED, 0xEB, 0xEB, 
-    0xEE, 0xF3, 0xF7, 0xFB, 0x00, 0x05, 0x05, 0xFE, 0xF4, 0xEF, 0xF4, 0x01, 
-    0x0E, 0x17, 0x17, 0x10, 0x09, 0x06, 0x09, 0x0C, 0x0E, 0x10, 0x13, 0x12, 
-    0x10, 0x11, 0x13, 0x15, 0x16, 0x19, 0x1D, 0x1D, 0x16, 0x0B, 0x05, 0x05, 
-    0x0D, 0x16, 0x1E, 0x20, 0x1D, 0x1A, 0x18, 0x16, 0x16, 0x17, 0x17, 0x18, 
-    0x19, 0x16, 0x12, 0x11, 0x16, 0x1B, 0x1E, 0x21, 0x27, 0x2A, 0x28, 0x20, 
-    0x17, 0x15, 0x19, 0x22, 0x2B, 0x2C, 0x25, 0x1D, 0x16, 0x14, 0x16, 0x1A, 
-    0x1D, 0x20, 0x21, 0x20, 0x1E, 0x1C, 0x1E, 0x20, 0x24, 0x29, 0x2C, 0x28, 
-    0x1D, 0x0E, 0x05, 0x06, 0x0C, 0x15, 0x19, 0x17, 0x10, 0x0A, 0x07, 0x08, 
-    0x09, 0x0B, 0x0E, 0x11, 0x0D, 0x09, 0x07, 0x0A, 0x10, 0x14, 0x15, 0x18, 
-    0x19, 0x15, 0x0C, 0x01, 0xFB, 0xFF, 0x09, 0x15, 0x1B, 0x1A, 0x12, 0x0A, 
-    0x04, 0x05, 0x05, 0x06, 0x07, 0x09, 0x09, 0x08, 0x06, 0x05, 0x05, 0x07, 
-    0x0A, 0x0E, 0x0D, 0x04, 0xF8, 0xED, 0xEB, 0xF0, 0xF9, 0x01, 0x03, 0x00, 
-    0xFB, 0xF5, 0xF1, 0xF2, 0xF8, 0x01, 0x09, 0x0C, 0x0A, 0x07, 0x06, 0x09, 
-    0x0D, 0x10, 0x11, 0x11, 0x0D, 0x06, 0xFE, 0xF9, 0xF9, 0x00, 0x08, 0x0F, 
-    0x10, 0x0A, 0x02, 0xFC, 0xFA, 0xFA, 0xF9, 0xF7, 0xF3, 0xED, 0xE6, 0xE4, 
-    0xE6, 0xE9, 0xE9, 0xE9, 0xEA, 0xEB, 0xE7, 0xDD, 0xD4, 0xD1, 0xD5, 0xDA, 
-    0xE0, 0xE4, 0xE7, 0xE4, 0xDF, 0xDC, 0xDD, 0xE2, 0xE8, 0xEC, 0xEF, 0xEF, 
-    0xEC, 0xEA, 0xEA, 0xEC, 0xEC, 0xEF, 0xF1, 0xEF, 0xE6, 0xDA, 0xCD, 0xC8, 
-    0xCE, 0xD9, 0xE1, 0xE4, 0xE0, 0xD7, 0xD0, 0xCE, 0xD0, 0xD4, 0xD6, 0xD9, 
-    0xD9, 0xD6, 0xD2, 0xD0, 0xD3, 0xD6, 0xDA, 0xDE, 0xE1, 0xE1, 0xDB, 0xD6, 
-    0xD6, 0xDE, 0xEC, 0xF9, 0x01, 0x02, 0xFF, 0xFC, 0xFD, 0xFE, 0x01, 0x03, 
-    0x05, 0x06, 0x05, 0x01, 0xFE, 0xFE, 0x04, 0x0B, 0x10, 0x11, 0x10, 0x0D, 
-    0x04, 0xFB, 0xF4, 0xF3, 0xF8, 0x00, 0x07, 0x0A, 0x07, 0x02, 0x00, 0x01, 
-    0x08, 0x0E, 0x15, 0x19, 0x1A, 0x19, 0x15, 0x14, 0x17, 0x1D, 0x24, 0x29, 
-    0x2A, 0x23, 0x18, 0x11, 0x12, 0x1B, 0x27, 0x2F, 0x31, 0x2E, 0x28, 0x21, 
-    0x1D, 0x1C, 0x1D, 0x1E, 0x20, 0x1F, 0x19, 0x11, 0x0B, 0x0A, 0x0E, 0x12, 
-    0x14, 0x12, 0x0C, 0x01, 0xF6, 0xF1, 0xF2, 0xFA, 0x02, 0x07, 0x09, 0x06, 
-    0x02, 0xFD, 0xFD, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0D, 0x10, 
-    0x0E, 0x0E, 0x10, 0x15, 0x15, 0x0E, 0x04, 0xFD, 0xFE, 0x05, 0x0C, 0x0E, 
-    0x0E, 0x0B, 0x08, 0x05, 0x03, 0x04, 0x06, 0x08, 0x09, 0x05, 0xFC, 0xF5, 
-    0xF4, 0xF9, 0xFC, 0xFF, 0x03, 0x05, 0x02, 0xFB, 0xF5, 0xF5, 0xFA, 0x05, 
-    0x0F, 0x15, 0x14, 0x0D, 0x05, 0x01, 0x04, 0x0A, 0x0F, 0x0F, 0x0C, 0x08, 
-    0x06, 0x09, 0x0F, 0x13, 0x17, 0x19, 0x1B, 0x19, 0x11, 0x05, 0xF8, 0xF2, 
-    0xF5, 0xFB, 0x01, 0x05, 0x08, 0x05, 0xFD, 0xFA, 0xF3, 0xEC, 0xEE, 0xF2, 
-    0xED, 0xE7, 0xE8, 0xF0, 0xF5, 0xF4, 0xE9, 0xE4, 0xE5, 0xE9, 0xE4, 0xE0, 
-    0xDF, 0xDD, 0xE9, 0xEB, 0xF1, 0xF3, 0xF3, 0xEF, 0xEA, 0xE8, 0xE6, 0xEC, 
-    0xF0, 0xEC, 0xEA, 0xE7, 0xE7, 0xED, 0xF8, 0xFD, 0xF9, 0xEE, 0xDE, 0xDD, 
-    0xD6, 0xD6, 0xD7, 0xE0, 0xED, 0xF4, 0xF2, 0xE6, 0xE5, 0xDE, 0xDF, 0xE7, 
-    0xF2, 0xFA, 0x01, 0x05, 0x0F, 0x14, 0x13, 0x16, 0x11, 0x13, 0x14, 0x0D, 
-    0x02, 0xF5, 0xE7, 0xE5, 0xF0, 0xF2, 0xFD, 0x07, 0x07, 0x07, 0xFD, 0x00, 
-    0x01, 0x08, 0x0A, 0x16, 0x16, 0x11, 0x10, 0x0C, 0x14, 0x0C, 0x0D, 0x0C, 
-    0x11, 0x21, 0x19, 0x10, 0x02, 0xF3, 0xF2, 0xF1, 0xF9, 0xFF, 0x08, 0x0A, 
-    0x0A, 0x07, 0x03, 0x05, 0x02, 0x07, 0x0C, 0x0E, 0x09, 0x07, 0x07, 0x0B, 
-    0x08, 0x0C, 0x08, 0x0A, 0x0B, 0x05, 0x07, 0xFC, 0xF9, 0xF8, 0xFF, 0x03, 
-    0x07, 0x0C, 0x10, 0x12, 0x13, 0x16, 0x16, 0x14, 0x14, 0x11, 0x11, 0x18, 
-    0x15, 0x13, 0x0E, 0x0B, 0x0A, 0x09, 0x09, 0x0B, 0x0B, 0x04, 0xFA, 0xF0, 
-    0xEC, 0xEE, 0xF3, 0xFA, 0x01, 0x04, 0x05, 0x04, 0x09, 0x0B, 0x10, 0x10, 
-    0x11, 0x0E, 0x0C, 0x0B, 0x0F, 0x1D, 0x28, 0x2E, 0x2F, 0x30, 0x33, 0x3A, 
-    0x3D, 0x3C, 0x32, 0x2D, 0x2A, 0x27, 0x23, 0x26, 0x25, 0x25, 0x22, 0x14, 
-    0x0A, 0xFE, 0xFB, 0xFD, 0x02, 0x07, 0x0A, 0x0A, 0x0E, 0x0D, 0x09, 0x07, 
-    0x05, 0x0E, 0x16, 0x1C, 0x10, 0x02, 0xF7, 0xF5, 0xFB, 0xFF, 0x06, 0x07, 
-    0x00, 0xF8, 0xF4, 0xF2, 0xF6, 0xFA, 0xFD, 0x02, 0x03, 0x02, 0x00, 0xFC, 
-    0xF7, 0xF6, 0xF4, 0xF2, 0xFA, 0x00, 0x06, 0xFD, 0xEC, 0xD9, 0xCC, 0xCA, 
-    0xCF, 0xD8, 0xDB, 0xD6, 0xCA, 0xC2, 0xBB, 0xC0, 0xC7, 0xCF, 0xD8, 0xDC, 
-    0xD9, 0xCD, 0xC8, 0xC3, 0xC8, 0xD3, 0xDA, 0xE4, 0xEA, 0xEC, 0xE4, 0xD8, 
-    0xD4, 0xD8, 0xE3, 0xED, 0xF6, 0xF6, 0xF4, 0xEF, 0xED, 0xEE, 0xF3, 0xFD, 
-    0x01, 0x02, 0xFB, 0xF5, 0xED, 0xEA, 0xE9, 0xEC, 0xE9, 0xE4, 0xE4, 0xE9, 
-    0xEE, 0xE8, 0xDF, 0xD0, 0xCD, 0xD1, 0xDD, 0xE8, 0xF7, 0x03, 0x09, 0x0C, 
-    0x0B, 0x12, 0x1D, 0x24, 0x26, 0x22, 0x15, 0x09, 0xFF, 0xFE, 0x05, 0x06, 
-    0x06, 0x04, 0x08, 0x0E, 0x10, 0x0B, 0x00, 0xF7, 0xF6, 0xFC, 0x06, 0x10, 
-    0x19, 0x1C, 0x17, 0x14, 0x11, 0x0A, 0x06, 0x00, 0xFF, 0xFE, 0xFB, 0xF8, 
-    0xF5, 0xF4, 0xF7, 0xFB, 0x01, 0x0E, 0x1B, 0x21, 0x18, 0x02, 0xEF, 0xE8, 
-    0xEF, 0x01, 0x10, 0x1A, 0x19, 0x0F, 0x04, 0xFE, 0x02, 0x08, 0x0F, 0x0F, 
-    0x0B, 0x03, 0xF6, 0xEE, 0xE7, 0xEA, 0xEA, 0xEF, 0xF6, 0xFD, 0xFF, 0xF6, 
-    0xE9, 0xDB, 0xD9, 0xDD, 0xE8, 0xF0, 0xFA, 0xFE, 0xF6, 0xEA, 0xDF, 0xE1, 
-    0xE8, 0xF0, 0xF9, 0xFC, 0xF9, 0xF4, 0xEE, 0xEE, 0xF2, 0xFA, 0x02, 0x08, 
-    0x10, 0x0D, 0x02, 0xF2, 0xE7, 0xE7, 0xF2, 0x00, 0x10, 0x19, 0x1A, 0x14, 
-    0x08, 0x02, 0x02, 0x07, 0x0F, 0x14, 0x13, 0x0D, 0x0A, 0x08, 0x0D, 0x17, 
-    0x1F, 0x23, 0x24, 0x2A, 0x33, 0x39, 0x33, 0x28, 0x1D, 0x18, 0x19, 0x1A, 
-    0x19, 0x17, 0x10, 0x04, 0xFD, 0xFB, 0x03, 0x0E, 0x1C, 0x28, 0x2F, 0x31, 
-    0x2C, 0x2C, 0x30, 0x35, 0x38, 0x39, 0x3F, 0x45, 0x46, 0x3D, 0x30, 0x26, 
-    0x25, 0x29, 0x2F, 0x34, 0x37, 0x32, 0x27, 0x1C, 0x16, 0x14, 0x14, 0x16, 
-    0x16, 0x1A, 0x1D, 0x1C, 0x18, 0x15, 0x11, 0x0B, 0x09, 0x0C, 0x13, 0x13, 
-    0x0B, 0xFE, 0xEF, 0xE8, 0xE7, 0xEE, 0xF6, 0xFC, 0xFB, 0xF1, 0xE2, 0xDA, 
-    0xDB, 0xE6, 0xF7, 0x03, 0x0E, 0x0F, 0x0B, 0x01, 0xFA, 0xF7, 0xF7, 0xF9, 
-    0xFA, 0xFF, 0xFF, 0xF9, 0xEC, 0xE0, 0xDB, 0xDB, 0xE0, 0xE4, 0xE8, 0xEB, 
-    0xE7, 0xDE, 0xD9, 0xD7, 0xD7, 0xDB, 0xDF, 0xE3, 0xE1, 0xDA, 0xD1, 0xCC, 
-    0xCA, 0xC9, 0xC8, 0xCC, 0xD5, 0xDB, 0xD7, 0xC8, 0xB6, 0xAB, 0xAF, 0xBC, 
-    0xCF, 0xE1, 0xEE, 0xF3, 0xF4, 0xF4, 0xF7, 0xFF, 0x08, 0x0E, 0x10, 0x0B, 
-    0xFF, 0xF4, 0xED, 0xEA, 0xE6, 0xDF, 0xDB, 0xDE, 0xE3, 0xE7, 0xE4, 0xDC, 
-    0xD8, 0xD8, 0xDF, 0xEB, 0xF7, 0x04, 0x0A, 0x09, 0x03, 0xFD, 0xFA, 0xFC, 
-    0x01, 0x09, 0x11, 0x14, 0x0F, 0x07, 0xFE, 0xF8, 0xF5, 0xF9, 0x05, 0x12, 
-    0x18, 0x14, 0x06, 0xFC, 0xF9, 0x00, 0x0F, 0x20, 0x2C, 0x2E, 0x25, 0x18, 
-    0x0F, 0x0A, 0x07, 0x07, 0x07, 0x07, 0x04, 0xFF, 0xF8, 0xF5, 0xF4, 0xF4, 
-    0xF6, 0x01, 0x12, 0x1F, 0x23, 0x1A, 0x0E, 0x06, 0x07, 0x11, 0x22, 0x2F, 
-    0x32, 0x28, 0x17, 0x04, 0xF5, 0xF1, 0xF8, 0x06, 0x11, 0x14, 0x0F, 0x07, 
-    0x00, 0xFE, 0xFC, 0xFE, 0x04, 0x0D, 0x0D, 0x04, 0xF3, 0xE3, 0xDE, 0xE6, 
-    0xF5, 0x02, 0x09, 0x08, 0xFF, 0xF2, 0xE8, 0xE0, 0xDF, 0xDF, 0xE2, 0xE3, 
-    0xE1, 0xDE, 0xDB, 0xDD, 0xE0, 0xE2, 0xE5, 0xEC, 0xFC, 0x0B, 0x10, 0x0B, 
-    0xFD, 0xF4, 0xF1, 0xF4, 0xFD, 0x07, 0x0A, 0x03, 0xF6, 0xEA, 0xE5, 0xE6, 
-    0xEF, 0xF9, 0x05, 0x0C, 0x0C, 0x09, 0x08, 0x0A, 0x0C, 0x0C, 0x0B, 0x0E, 
-    0x11, 0x10, 0x0C, 0x06, 0x02, 0x02, 0x04, 0x09, 0x0C, 0x0C, 0x08, 0x00, 
-    0xF7, 0xEF, 0xE7, 0xE1, 0xDF, 0xE5, 0xEE, 0xF7, 0xFC, 0xFE, 0xFE, 0xFA, 
-    0xF5, 0xF6, 0x03, 0x14, 0x22, 0x24, 0x1A, 0x0B, 0xFF, 0xFB, 0xFF, 0x07, 
-    0x0D, 0x10, 0x0D, 0x06, 0x01, 0x00, 0x04, 0x0B, 0x16, 0x1D, 0x1E, 0x19, 
-    0x11, 0x0C, 0x06, 0xFF, 0xF8, 0xFA, 0x06, 0x12, 0x15, 0x0F, 0x04, 0xFC, 
-    0xF9, 0xFD, 0x07, 0x15, 0x21, 0x26, 0x22, 0x19, 0x0F, 0x05, 0x04, 0x0B, 
-    0x16, 0x1F, 0x20, 0x1C, 0x16, 0x11, 0x0D, 0x0D, 0x16, 0x23, 0x2C, 0x29, 
-    0x18, 0x03, 0xF3, 0xEE, 0xF4, 0x02, 0x0F, 0x18, 0x18, 0x14, 0x11, 0x11, 
-    0x15, 0x19, 0x1E, 0x23, 0x22, 0x1B, 0x10, 0x04, 0xF9, 0xF0, 0xE8, 0xE4, 
-    0xE9, 0xF2, 0xF7, 0xF5, 0xEE, 0xE7, 0xE7, 0xEE, 0xFA, 0x08, 0x14, 0x1A, 
-    0x16, 0x0C, 0x06, 0x00, 0xFD, 0x00, 0x05, 0x08, 0x04, 0xFD, 0xF4, 0xF0, 
-    0xF1, 0xF1, 0xF2, 0xF8, 0xFF, 0xFE, 0xF3, 0xE5, 0xDC, 0xDB, 0xE1, 0xE8, 
-    0xF0, 0xF5, 0xF6, 0xF2, 0xEC, 0xE7, 0xE3, 0xE0, 0xDE, 0xDE, 0xDF, 0xDF, 
-    0xE0, 0xE1, 0xE3, 0xE2, 0xDD, 0xD8, 0xDA, 0xE6, 0xF0, 0xF2, 0xEC, 0xE4, 
-    0xDF, 0xDE, 0xE2, 0xEA, 0xF2, 0xF6, 0xF5, 0xEA, 0xDD, 0xD5, 0xD1, 0xD4, 
-    0xDB, 0xE2, 0xE5, 0xE3, 0xDE, 0xD9, 0xD7, 0xD7, 0xD7, 0xDA, 0xE1, 0xE7, 
-    0xE8, 0xE4, 0xDD, 0xDA, 0xDE, 0xE8, 0xF4, 0x00, 0x09, 0x0D, 0x07, 0xFB, 
-    0xEF, 0xE5, 0xDC, 0xD9, 0xDB, 0xE0, 0xE4, 0xE2, 0xDF, 0xDD, 0xDA, 0xDC, 
-    0xE4, 0xF5, 0x06, 0x0D, 0x07, 0xF9, 0xED, 0xEA, 0xF0, 0xFB, 0x06, 0x0B, 
-    0x05, 0xF2, 0xDB, 0xCC, 0xCA, 0xD5, 0xE5, 0xF5, 0x00, 0x03, 0x02, 0x00, 
-    0x00, 0xFF, 0xFF, 0x06, 0x10, 0x1A, 0x1A, 0x12, 0x06, 0xFC, 0xFA, 0xFE, 
-    0x05, 0x0C, 0x13, 0x17, 0x13, 0x07, 0xFE, 0xFC, 0x02, 0x0E, 0x1B, 0x24, 
-    0x27, 0x22, 0x1A, 0x11, 0x0D, 0x10, 0x1B, 0x2D, 0x3B, 0x3F, 0x36, 0x23, 
-    0x11, 0x0C, 0x14, 0x22, 0x2D, 0x31, 0x2F, 0x26, 0x18, 0x0D, 0x0C, 0x11, 
-    0x19, 0x20, 0x23, 0x1F, 0x17, 0x0F, 0x0A, 0x0A, 0x0B, 0x0C, 0x0F, 0x15, 
-    0x1B, 0x1D, 0x18, 0x11, 0x0E, 0x12, 0x1B, 0x27, 0x32, 0x3A, 0x3A, 0x31, 
-    0x23, 0x17, 0x15, 0x1A, 0x23, 0x2C, 0x2F, 0x29, 0x1E, 0x13, 0x0B, 0x07, 
-    0x09, 0x10, 0x18, 0x1A, 0x12, 0x01, 0xEE, 0xE3, 0xE1, 0xE8, 0xF1, 0xFC, 
-    0x03, 0x06, 0x05, 0xFF, 0xFF, 0x06, 0x0F, 0x17, 0x1B, 0x1D, 0x1B, 0x18, 
-    0x11, 0x07, 0xFB, 0xF2, 0xF1, 0xF7, 0xFF, 0x00, 0xF7, 0xE7, 0xDA, 0xD9, 
-    0xE4, 0xF8, 0x0E, 0x1F, 0x27, 0x23, 0x12, 0x00, 0xF6, 0xF6, 0xFD, 0x05, 
-    0x08, 0x01, 0xF3, 0xE2, 0xD6, 0xD1, 0xD2, 0xD9, 0xE3, 0xEB, 0xE9, 0xDD, 
-    0xCC, 0xC2, 0xC5, 0xD2, 0xE3, 0xF0, 0xF7, 0xF9, 0xF7, 0xEF, 0xE6, 0xE2, 
-    0xE4, 0xEC, 0xF7, 0x01, 0x01, 0xF8, 0xEB, 0xE0, 0xDB, 0xDC, 0xE4, 0xF2, 
-    0x01, 0x07, 0x01, 0xF1, 0xE1, 0xDB, 0xE2, 0xF1, 0x01, 0x0A, 0x09, 0x00, 
-    0xED, 0xDC, 0xD6, 0xDB, 0xE8, 0xF5, 0xFD, 0xF9, 0xEE, 0xE3, 0xE0, 0xE5, 
-    0xEF, 0xFA, 0x04, 0x09, 0x08, 0xFF, 0xF2, 0xE7, 0xE6, 0xEC, 0xF7, 0x03, 
-    0x0B, 0x0E, 0x0A, 0xFE, 0xEE, 0xE4, 0xE1, 0xE5, 0xEC, 0xF3, 0xF4, 0xEF, 
-    0xE7, 0xE0, 0xDF, 0xE2, 0xE9, 0xF7, 0x08, 0x15, 0x18, 0x11, 0x06, 0x03, 
-    0x0B, 0x1A, 0x28, 0x2E, 0x2B, 0x21, 0x12, 0x04, 0xFD, 0xFE, 0x08, 0x15, 
-    0x21, 0x28, 0x25, 0x20, 0x1D, 0x1E, 0x21, 0x23, 0x28, 0x2F, 0x35, 0x33, 
-    0x26, 0x12, 0x01, 0xFA, 0xFD, 0x04, 0x0C, 0x12, 0x15, 0x12, 0x08, 0xFD, 
-    0xF8, 0xFB, 0x07, 0x17, 0x24, 0x27, 0x20, 0x14, 0x0A, 0x08, 0x0B, 0x14, 
-    0x1F, 0x27, 0x27, 0x19, 0x08, 0xFA, 0xF8, 0x02, 0x12, 0x21, 0x2C, 0x30, 
-    0x2B, 0x1D, 0x10, 0x0A, 0x0C, 0x16, 0x23, 0x2C, 0x2C, 0x23, 0x13, 0x04, 
-    0xFC, 0xFA, 0xFD, 0x06, 0x12, 0x18, 0x16, 0x0A, 0xFC, 0xF4, 0xF6, 0x02, 
-    0x13, 0x23, 0x2A, 0x26, 0x17, 0x04, 0xF9, 0xF9, 0x03, 0x10, 0x19, 0x15, 
-    0x07, 0xF3, 0xE1, 0xD9, 0xDA, 0xE0, 0xE9, 0xF3, 0xF6, 0xEC, 0xD8, 0xC1, 
-    0xB5, 0xB8, 0xC6, 0xD8, 0xE6, 0xF0, 0xF3, 0xEF, 0xE7, 0xE4, 0xE9, 0xF6, 
-    0x05, 0x10, 0x14, 0x11, 0x06, 0xFA, 0xF2, 0xED, 0xEB, 0xEE, 0xF5, 0xFB, 
-    0xF7, 0xE9, 0xD7, 0xCA, 0xCD, 0xDC, 0xEE, 0xFF, 0x0A, 0x0C, 0x04, 0xF5, 
-    0xE9, 0xE8, 0xF1, 0xFD, 0x06, 0x09, 0x03, 0xF5, 0xE5, 0xDA, 0xD9, 0xDC, 
-    0xE4, 0xED, 0xF3, 0xF3, 0xEC, 0xE3, 0xDB, 0xDD, 0xE7, 0xF4, 0x01, 0x0C, 
-    0x13, 0x12, 0x07, 0xF9, 0xF1, 0xF0, 0xF3, 0xF7, 0xFA, 0xF9, 0xF3, 0xE9, 
-    0xE0, 0xDE, 0xE4, 0xEE, 0xFC, 0x0A, 0x10, 0x0D, 0x01, 0xF0, 0xE6, 0xE9, 
-    0xF6, 0x05, 0x11, 0x15, 0x0E, 0xFB, 0xE5, 0xDA, 0xDE, 0xEA, 0xF6, 0xFE, 
-    0x00, 0xFC, 0xF7, 0xF3, 0xF4, 0xF8, 0xFE, 0x06, 0x0F, 0x16, 0x15, 0x0D, 
-    0xFF, 0xF8, 0xF9, 0x02, 0x0C, 0x14, 0x18, 0x14, 0x04, 0xEE, 0xDE, 0xDB, 
-    0xE3, 0xEE, 0xF6, 0xF7, 0xF2, 0xE9, 0xDF, 0xD9, 0xDB, 0xE4, 0xF5, 0x08, 
-    0x16, 0x19, 0x0F, 0xFF, 0xF4, 0xF4, 0xFF, 0x0B, 0x12, 0x11, 0x08, 0xF8, 
-    0xE5, 0xD9, 0xD9, 0xE3, 0xEF, 0xF6, 0xF7, 0xF5, 0xF3, 0xF2, 0xF5, 0xFB, 
-    0x03, 0x0B, 0x11, 0x15, 0x14, 0x0C, 0xFD, 0xEE, 0xE7, 0xE9, 0xF2, 0xFD, 
-    0x05, 0x08, 0x00, 0xF2, 0xE5, 0xE4, 0xEE, 0xFE, 0x0E, 0x18, 0x1B, 0x1A, 
-    0x17, 0x16, 0x1B, 0x21, 0x27, 0x2C, 0x2E, 0x2C, 0x21, 0x11, 0xFF, 0xF5, 
-    0xF3, 0xF8, 0xFF, 0x06, 0x08, 0x05, 0xFD, 0xF6, 0xF8, 0x00, 0x0B, 0x13, 
-    0x16, 0x16, 0x14, 0x12, 0x0E, 0x0A, 0x04, 0x00, 0x00, 0x07, 0x0E, 0x0F, 
-    0x04, 0xF4, 0xE7, 0xE2, 0xEB, 0xFD, 0x10, 0x20, 0x27, 0x22, 0x18, 0x11, 
-    0x13, 0x1C, 0x25, 0x2B, 0x2B, 0x25, 0x1C, 0x11, 0x09, 0x02, 0xFD, 0xFD, 
-    0x02, 0x0A, 0x09, 0x01, 0xF2, 0xE5, 0xE1, 0xE6, 0xF1, 0xFF, 0x0C, 0x14, 
-    0x14, 0x0E, 0x09, 0x09, 0x0F, 0x18, 0x22, 0x28, 0x27, 0x1F, 0x13, 0x05, 
-    0xF9, 0xF0, 0xED, 0xF3, 0xFD, 0x03, 0xFD, 0xEE, 0xDD, 0xD5, 0xD9, 0xE9, 
-    0xFF, 0x12, 0x1D, 0x1B, 0x10, 0x04, 0xFF, 0x01, 0x09, 0x0F, 0x0F, 0x08, 
-    0xFD, 0xF5, 0xEF, 0xF1, 0xF3, 0xF6, 0xFB, 0x04, 0x0B, 0x0B, 0x05, 0xFE, 
-    0xFC, 0x03, 0x10, 0x20, 0x2E, 0x38, 0x36, 0x2A, 0x19, 0x0C, 0x07, 0x06, 
-    0x07, 0x06, 0x03, 0xFE, 0xF8, 0xF5, 0xF4, 0xF3, 0xF3, 0xF7, 0x01, 0x0C, 
-    0x0E, 0x09, 0x00, 0xFE, 0x03, 0x0E, 0x1B, 0x25, 0x28, 0x23, 0x16, 0x08, 
-    0x01, 0x02, 0x05, 0x06, 0x04, 0xFD, 0xF6, 0xF1, 0xF2, 0xF6, 0xF8, 0xF8, 
-    0xF8, 0xFC, 0x05, 0x0A, 0x09, 0x04, 0xFF, 0xFD, 0xFE, 0x01, 0x05, 0x08, 
-    0x09, 0x03, 0xF8, 0xEB, 0xE3, 0xE0, 0xDE, 0xDF, 0xDE, 0xDC, 0xD9, 0xD6, 
-    0xD9, 0xDE, 0xE5, 0xEB, 0xF4, 0x00, 0x07, 0x06, 0xFF, 0xF8, 0xF6, 0xF9, 
-    0x00, 0x05, 0x07, 0x05, 0xFC, 0xF0, 0xE6, 0xE2, 0xE4, 0xE8, 0xEC, 0xF1, 
-    0xF4, 0xF5, 0xF6, 0xF8, 0xFD, 0x02, 0x07, 0x0A, 0x10, 0x14, 0x11, 0x07, 
-    0xF9, 0xEC, 0xE5, 0xE5, 0xEA, 0xEF, 0xEF, 0xE6, 0xD3, 0xC1, 0xB9, 0xBD, 
-    0xC7, 0xD5, 0xE0, 0xE5, 0xE5, 0xE2, 0xE1, 0xE7, 0xF2, 0xFE, 0x06, 0x0A, 
-    0x08, 0xFC, 0xEC, 0xDB, 0xCF, 0xCD, 0xD3, 0xDF, 0xE7, 0xEB, 0xE7, 0xDE, 
-    0xD4, 0xD4, 0xDF, 0xF0, 0xFF, 0x0A, 0x0D, 0x0A, 0x06, 0x03, 0x05, 0x09, 
-    0x0F, 0x13, 0x18, 0x1A, 0x14, 0x05, 0xF3, 0xE7, 0xE8, 0xF2, 0xFF, 0x09, 
-    0x0D, 0x0A, 0xFF, 0xF1, 0xEC, 0xF1, 0xFF, 0x0E, 0x14, 0x11, 0x04, 0xF7, 
-    0xF0, 0xEF, 0xF2, 0xF6, 0xF9, 0xFA, 0xF9, 0xF1, 0xE3, 0xD1, 0xC5, 0xC5, 
-    0xCD, 0xDA, 0xE8, 0xF4, 0xFF, 0x04, 0x04, 0x05, 0x0C, 0x17, 0x23, 0x2C, 
-    0x2E, 0x29, 0x1F, 0x16, 0x0F, 0x0C, 0x0D, 0x0F, 0x10, 0x12, 0x10, 0x07, 
-    0xFA, 0xEF, 0xEB, 0xF2, 0x03, 0x17, 0x28, 0x31, 0x30, 0x25, 0x19, 0x14, 
-    0x17, 0x1E, 0x25, 0x27, 0x23, 0x1A, 0x0F, 0x04, 0xFC, 0xF9, 0xF8, 0xFA, 
-    0xFE, 0x02, 0x02, 0xFA, 0xED, 0xE6, 0xE8, 0xF5, 0x0A, 0x1F, 0x2D, 0x2E, 
-    0x22, 0x0F, 0x02, 0x01, 0x08, 0x12, 0x17, 0x14, 0x08, 0xFB, 0xED, 0xE7, 
-    0xE6, 0xED, 0xF9, 0x0A, 0x19, 0x1C, 0x14, 0x06, 0xFE, 0x02, 0x12, 0x28, 
-    0x3D, 0x4A, 0x49, 0x3B, 0x26, 0x14, 0x0D, 0x11, 0x19, 0x1E, 0x19, 0x0F, 
-    0x03, 0xFA, 0xF6, 0xF8, 0xFE, 0x0A, 0x19, 0x26, 0x29, 0x1E, 0x0B, 0xFC, 
-    0xFA, 0x05, 0x16, 0x26, 0x2F, 0x2C, 0x1D, 0x09, 0xF8, 0xF1, 0xF6, 0xFF, 
-    0x06, 0x05, 0xFB, 0xED, 0xE3, 0xDF, 0xE3, 0xED, 0xF9, 0x06, 0x14, 0x1B, 
-    0x18, 0x0D, 0x00, 0xFB, 0x00, 0x0A, 0x13, 0x18, 0x15, 0x09, 0xF9, 0xEA, 
-    0xE3, 0xE5, 0xEB, 0xF2, 0xF4, 0xF1, 0xEB, 0xE7, 0xE9, 0xF1, 0xF9, 0x00, 
-    0x05, 0x0C, 0x11, 0x0D, 0x01, 0xF1, 0xE6, 0xE3, 0xE6, 0xEC, 0xF1, 0xF2, 
-    0xED, 0xE0, 0xD5, 0xCF, 0xD1, 0xDA, 0xE3, 0xEA, 0xED, 0xEF, 0xF3, 0xFA, 
-    0x03, 0x0A, 0x0D, 0x10, 0x12, 0x15, 0x11, 0x07, 0xF9, 0xEF, 0xEB, 0xEC, 
-    0xEF, 0xF1, 0xF1, 0xEC, 0xE1, 0xD5, 0xCE, 0xD1, 0xDC, 0xE8, 0xF1, 0xF3, 
-    0xEF, 0xE8, 0xE6, 0xE8, 0xEC, 0xF2, 0xF8, 0xFF, 0x05, 0x03, 0xF7, 0xE3, 
-    0xCE, 0xC3, 0xC5, 0xCF, 0xDE, 0xEA, 0xEF, 0xE7, 0xDC, 0xD4, 0xD5, 0xE0, 
-    0xEF, 0xFD, 0x04, 0x02, 0xFE, 0xFA, 0xFA, 0xFC, 0xFE, 0x01, 0x05, 0x0B, 
-    0x0A, 0x00, 0xEF, 0xDD, 0xD3, 0xD2, 0xDD, 0xED, 0xFE, 0x0A, 0x09, 0x00, 
-    0xF8, 0xF5, 0xFE, 0x0F, 0x1E, 0x24, 0x1E, 0x0E, 0xFD, 0xF4, 0xF2, 0xF5, 
-    0xF9, 0xFD, 0x01, 0x01, 0xFA, 0xEC, 0xDD, 0xD6, 0xD9, 0xE5, 0xF5, 0x05, 
-    0x10, 0x12, 0x0B, 0x04, 0x03, 0x0B, 0x18, 0x22, 0x25, 0x1E, 0x10, 0x03, 
-    0xFA, 0xF8, 0xFA, 0xFC, 0xFE, 0x01, 0x05, 0x04, 0xFC, 0xF2, 0xED, 0xF3, 
-    0x02, 0x15, 0x27, 0x35, 0x3B, 0x37, 0x31, 0x2D, 0x2E, 0x32, 0x34, 0x30, 
-    0x27, 0x1B, 0x0E, 0x06, 0x04, 0x05, 0x06, 0x06, 0x08, 0x0E, 0x11, 0x11, 
-    0x0B, 0x05, 0x06, 0x0D, 0x17, 0x20, 0x25, 0x26, 0x23, 0x1D, 0x15, 0x0F, 
-    0x0D, 0x0D, 0x0C, 0x08, 0xFF, 0xF7, 0xF0, 0xED, 0xED, 0xEC, 0xEA, 0xEC, 
-    0xF4, 0xFF, 0x05, 0x01, 0xFA, 0xF8, 0xFC, 0x06, 0x13, 0x1E, 0x26, 0x26, 
-    0x1D, 0x11, 0x07, 0x04, 0x06, 0x07, 0x04, 0xFD, 0xF4, 0xF0, 0xF4, 0xFD, 
-    0x04, 0x09, 0x0E, 0x16, 0x1E, 0x20, 0x1A, 0x0E, 0x03, 0xFF, 0x03, 0x0C, 
-    0x16, 0x1D, 0x19, 0x0B, 0xFB, 0xEE, 0xE9, 0xEB, 0xF2, 0xFA, 0xFE, 0xFD, 
-    0xF9, 0xF6, 0xF7, 0xF9, 0xFC, 0x02, 0x0B, 0x15, 0x18, 0x13, 0x06, 0xFB, 
-    0xF7, 0xFC, 0x04, 0x08, 0x06, 0xFE, 0xF3, 0xEB, 0xE6, 0xE6, 0xEB, 0xF2, 
-    0xF8, 0xF8, 0xF5, 0xF2, 0xF3, 0xF9, 0x01, 0x05, 0x07, 0x0A, 0x0F, 0x11, 
-    0x0A, 0xFD, 0xF0, 0xEC, 0xEE, 0xF1, 0xF3, 0xF2, 0xEE, 0xEB, 0xE3, 0xDE, 
-    0xE0, 0xE7, 0xEF, 0xF2, 0xF2, 0xEB, 0xE7, 0xE6, 0xEA, 0xF3, 0xFA, 0xFE, 
-    0x03, 0x05, 0x04, 0xFB, 0xED, 0xE3, 0xE3, 0xE8, 0xF0, 0xF6, 0xF4, 0xF4, 
-    0xEE, 0xED, 0xEA, 0xEF, 0xF3, 0xF3, 0xFB, 0xF5, 0xF4, 0xF1, 0xEF, 0xF1, 
-    0xF3, 0xF2, 0xEE, 0xE8, 0xEB, 0xEC, 0xEB, 0xE6, 0xDB, 0xD2, 0xD2, 0xD4, 
-    0xD7, 0xDD, 0xDE, 0xDF, 0xE2, 0xE0, 0xE4, 0xE6, 0xE9, 0xED, 0xEF, 0xF3, 
-    0xF0, 0xF1, 0xF0, 0xF4, 0xF5, 0xF4, 0xF2, 0xF4, 0xFE, 0xFD, 0xF8, 0xEB, 
-    0xE0, 0xE4, 0xEA, 0xF3, 0xFE, 0x07, 0x0E, 0x12, 0x14, 0x13, 0x15, 0x15, 
-    0x1A, 0x1A, 0x17, 0x14, 0x0F, 0x0D, 0x0B, 0x07, 0x03, 0x01, 0x06, 0x11, 
-    0x11, 0x10, 0x00, 0xF4, 0xF2, 0xF7, 0x05, 0x11, 0x1B, 0x1D, 0x1D, 0x1B, 
-    0x1A, 0x19, 0x1F, 0x22, 0x23, 0x1E, 0x15, 0x08, 0x03, 0xFE, 0xFC, 0xFB, 
-    0xF9, 0xFB, 0xFB, 0xFD, 0xF7, 0xEE, 0xE5, 0xE2, 0xEA, 0xF8, 0x07, 0x11, 
-    0x15, 0x19, 0x1C, 0x24, 0x29, 0x2F, 0x33, 0x32, 0x32, 0x29, 0x1E, 0x14, 
-    0x13, 0x15, 0x19, 0x1C, 0x19, 0x19, 0x1C, 0x1B, 0x15, 0x0B, 0x07, 0x0E, 
-    0x18, 0x26, 0x29, 0x27, 0x21, 0x1F, 0x1D, 0x21, 0x1E, 0x1B, 0x19, 0x10, 
-    0x08, 0xFC, 0xF6, 0xF8, 0xFD, 0xFF, 0xFC, 0xF6, 0xF4, 0xF5, 0xF7, 0xF2, 
-    0xEA, 0xE4, 0xE4, 0xED, 0xF4, 0xFB, 0xFD, 0xFC, 0xFF, 0x00, 0x03, 0x08, 
-    0x09, 0x09, 0x0A, 0x07, 0x04, 0x05, 0x05, 0x09, 0x09, 0x08, 0x04, 0x05, 
-    0x07, 0x08, 0x04, 0xF8, 0xEF, 0xEB, 0xEF, 0xF5, 0xFB, 0xFE, 0xFE, 0xFF, 
-    0x01, 0x03, 0x06, 0x04, 0x03, 0x04, 0x04, 0x07, 0x06, 0x06, 0x04, 0x03, 
-    0x02, 0xFD, 0xFC, 0x00, 0x04, 0xFF, 0xF3, 0xE5, 0xDD, 0xDE, 0xE5, 0xEE, 
-    0xF6, 0xF9, 0xFB, 0xFB, 0xFC, 0xFD, 0xFF, 0x01, 0x09, 0x0D, 0x0C, 0x08, 
-    0x01, 0xFC, 0xF9, 0xF8, 0xF6, 0xF7, 0xF8, 0xFC, 0xF5, 0xEA, 0xDB, 0xD3, 
-    0xD3, 0xD8, 0xDF, 0xE6, 0xE8, 0xE7, 0xE9, 0xE7, 0xEB, 0xED, 0xF4, 0xFB, 
-    0x01, 0x00, 0xFE, 0xFA, 0xF5, 0xF6, 0xF5, 0xF8, 0xF7, 0xFA, 0xFC, 0xFA, 
-    0xEF, 0xE1, 0xDB, 0xDA, 0xE3, 0xEB, 0xF2, 0xF3, 0xF2, 0xEF, 0xF0, 0xF4, 
-    0xF6, 0xFD, 0xFE, 0xFE, 0xFD, 0xF5, 0xEF, 0xEC, 0xED, 0xF0, 0xF0, 0xEE, 
-    0xEE, 0xF0, 0xF2, 0xEF, 0xE7, 0xE1, 0xE2, 0xE6, 0xEA, 0xEC, 0xED, 0xEB, 
-    0xEA, 0xEE, 0xF0, 0xF2, 0xEF, 0xEC, 0xEC, 0xEC, 0xEC, 0xE9, 0xEA, 0xEB, 
-    0xEF, 0xF0, 0xF1, 0xF2, 0xF5, 0xFB, 0xFA, 0xF6, 0xEE, 0xEB, 0xEC, 0xF0, 
-    0xF5, 0xF8, 0xFB, 0xFD, 0x02, 0x07, 0x07, 0x05, 0x01, 0xFF, 0x01, 0x03, 
-    0x05, 0x05, 0x07, 0x0A, 0x0A, 0x0C, 0x0B, 0x0F, 0x15, 0x18, 0x15, 0x0D, 
-    0x07, 0x03, 0x03, 0x07, 0x0E, 0x16, 0x1B, 0x1D, 0x20, 0x1F, 0x1D, 0x1D, 
-    0x1F, 0x25, 0x29, 0x29, 0x27, 0x23, 0x23, 0x20, 0x21, 0x21, 0x23, 0x27, 
-    0x26, 0x1E, 0x11, 0x06, 0xFE, 0xFD, 0xFD, 0x03, 0x06, 0x08, 0x07, 0x08, 
-    0x07, 0x07, 0x09, 0x0A, 0x12, 0x14, 0x15, 0x13, 0x13, 0x15, 0x15, 0x17, 
-    0x16, 0x17, 0x1B, 0x1D, 0x1A, 0x0F, 0x05, 0x02, 0x04, 0x0A, 0x11, 0x16, 
-    0x18, 0x18, 0x19, 0x18, 0x16, 0x14, 0x15, 0x18, 0x1A, 0x18, 0x16, 0x15, 
-    0x17, 0x18, 0x18, 0x13, 0x0D, 0x0A, 0x09, 0x02, 0xF6, 0xED, 0xEB, 0xED, 
-    0xF1, 0xF6, 0xF8, 0xFA, 0xFB, 0xFF, 0x03, 0x05, 0x04, 0x02, 0x01, 0x01, 
-    0x01, 0xFF, 0x00, 0xFF, 0x01, 0x00, 0xFE, 0xFD, 0xFF, 0x03, 0x04, 0x01, 
-    0xFA, 0xF6, 0xF2, 0xF2, 0xF4, 0xF7, 0xF8, 0xF7, 0xF8, 0xF8, 0xF8, 0xF3, 
-    0xF0, 0xEF, 0xF1, 0xF4, 0xF9, 0xFB, 0xFD, 0x00, 0x02, 0x02, 0xFF, 0xFF, 
-    0x01, 0x04, 0x01, 0xFD, 0xF6, 0xF3, 0xF3, 0xF8, 0xFE, 0x03, 0x07, 0x09, 
-    0x0A, 0x08, 0x06, 0x02, 0x00, 0x01, 0x03, 0x03, 0x02, 0x00, 0xFF, 0xFC, 
-    0xF6, 0xF1, 0xF0, 0xF5, 0xFA, 0xFA, 0xF3, 0xEA, 0xE4, 0xE2, 0xE3, 0xE5, 
-    0xE5, 0xE3, 0xE1, 0xDE, 0xDC, 0xDB, 0xDA, 0xDA, 0xDB, 0xDC, 0xDA, 0xD9, 
-    0xDC, 0xDF, 0xE3, 0xE6, 0xE9, 0xEF, 0xF7, 0xFE, 0xFF, 0xF8, 0xF1, 0xEC, 
-    0xEC, 0xF0, 0xF4, 0xF8, 0xF8, 0xF6, 0xF4, 0xF2, 0xF0, 0xED, 0xE9, 0xE5, 
-    0xE4, 0xE4, 0xE4, 0xE7, 0xEB, 0xEE, 0xF2, 0xF6, 0xF8, 0xFC, 0x00, 0x01, 
-    0xFD, 0xF6, 0xEF, 0xEC, 0xEE, 0xF2, 0xF3, 0xF2, 0xEF, 0xED, 0xEC, 0xEE, 
-    0xEE, 0xEC, 0xEA, 0xE9, 0xEA, 0xE9, 0xEB, 0xED, 0xF3, 0xF7, 0xF9, 0xF9, 
-    0xF9, 0xFF, 0x03, 0x03, 0xFF, 0xFA, 0xF6, 0xF5, 0xF7, 0xF9, 0xFA, 0xFB, 
-    0xFD, 0xFF, 0x00, 0xFF, 0xFA, 0xF3, 0xED, 0xE7, 0xE4, 0xE6, 0xED, 0xF5, 
-    0xFB, 0xFF, 0x01, 0x06, 0x0E, 0x15, 0x16, 0x12, 0x0E, 0x0C, 0x0E, 0x11, 
-    0x16, 0x18, 0x17, 0x17, 0x13, 0x10, 0x0C, 0x09, 0x05, 0x01, 0x00, 0x02, 
-    0x08, 0x11, 0x17, 0x1B, 0x1A, 0x18, 0x18, 0x1C, 0x21, 0x21, 0x1B, 0x15, 
-    0x0F, 0x0D, 0x0F, 0x12, 0x13, 0x15, 0x14, 0x13, 0x11, 0x10, 0x0C, 0x09, 
-    0x05, 0x05, 0x07, 0x08, 0x0A, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x13, 0x1B, 
-    0x1E, 0x1B, 0x14, 0x0E, 0x0E, 0x12, 0x18, 0x1D, 0x20, 0x22, 0x23, 0x24, 
-    0x24, 0x21, 0x1C, 0x19, 0x17, 0x16, 0x15, 0x15, 0x17, 0x1B, 0x1B, 0x17, 
-    0x12, 0x0F, 0x10, 0x0E, 0x07, 0xFD, 0xF5, 0xF2, 0xF4, 0xF9, 0xFC, 0xFE, 
-    0xFE, 0xFE, 0xFE, 0xFD, 0xFE, 0xFF, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 
-    0x04, 0x03, 0x01, 0x00, 0x00, 0x05, 0x09, 0x08, 0x03, 0xFD, 0xFB, 0xFC, 
-    0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFB, 0xF9, 
-    0xF8, 0xF8, 0xF9, 0xFB, 0xFC, 0xFA, 0xF7, 0xF6, 0xF9, 0xFD, 0xFE, 0xF7, 
-    0xEE, 0xE8, 0xE7, 0xEA, 0xEE, 0xEF, 0xF1, 0xF4, 0xF9, 0xFC, 0xFC, 0xF9, 
-    0xF5, 0xF3, 0xF5, 0xF5, 0xF6, 0xF8, 0xFC, 0x00, 0x01, 0x00, 0xFD, 0xFF, 
-    0x04, 0x07, 0x03, 0xFB, 0xF5, 0xF2, 0xF3, 0xF2, 0xF0, 0xED, 0xEC, 0xEE, 
-    0xEE, 0xEC, 0xE8, 0xE5, 0xE4, 0xE7, 0xE9, 0xEA, 0xEB, 0xEC, 0xEF, 0xF1, 
-    0xF0, 0xEF, 0xF0, 0xF6, 0xFA, 0xF6, 0xEE, 0xE4, 0xE0, 0xE2, 0xE5, 0xE9, 
-    0xEC, 0xF1, 0xF6, 0xF9, 0xFC, 0xFA, 0xF9, 0xF7, 0xF6, 0xF5, 0xF3, 0xF2, 
-    0xF1, 0xF3, 0xF4, 0xF2, 0xEF, 0xED, 0xEF, 0xF1, 0xEC, 0xE3, 0xD9, 0xD4, 
-    0xD5, 0xDA, 0xDF, 0xE3, 0xE8, 0xEC, 0xF0, 0xF3, 0xF3, 0xF1, 0xF0, 0xF1, 
-    0xF3, 0xF6, 0xF8, 0xFA, 0xFD, 0xFF, 0x00, 0x00, 0x01, 0x06, 0x0B, 0x0B, 
-    0x04, 0xFC, 0xF8, 0xF8, 0xFB, 0xF9, 0xF5, 0xF1, 0xF0, 0xF1, 0xF1, 0xEF, 
-    0xEE, 0xEC, 0xEC, 0xEE, 0xF0, 0xF1, 0xF2, 0xF6, 0xFA, 0xFB, 0xFA, 0xF9, 
-    0xFC, 0x01, 0x03, 0xFE, 0xF8, 0xF6, 0xF9, 0xFF, 0x04, 0x06, 0x0A, 0x0F, 
-    0x13, 0x13, 0x10, 0x0A, 0x05, 0x03, 0x05, 0x08, 0x09, 0x0C, 0x11, 0x18, 
-    0x1C, 0x1C, 0x1A, 0x1B, 0x1E, 0x20, 0x1E, 0x19, 0x15, 0x13, 0x16, 0x1A, 
-    0x1C, 0x1D, 0x1E, 0x1D, 0x1C, 0x19, 0x14, 0x0F, 0x0C, 0x0C, 0x0E, 0x10, 
-    0x11, 0x12, 0x13, 0x11, 0x0E, 0x0B, 0x0A, 0x10, 0x18, 0x1C, 0x18, 0x12, 
-    0x0E, 0x0F, 0x14, 0x17, 0x19, 0x1B, 0x1C, 0x1D, 0x1E, 0x1C, 0x1A, 0x19, 
-    0x19, 0x1B, 0x1C, 0x1D, 0x1C, 0x1B, 0x1A, 0x16, 0x12, 0x11, 0x15, 0x1A, 
-    0x19, 0x0F, 0x05, 0x00, 0x01, 0x05, 0x07, 0x09, 0x0B, 0x0E, 0x0F, 0x0E, 
-    0x0A, 0x04, 0x01, 0x01, 0x05, 0x09, 0x0B, 0x0B, 0x0B, 0x08, 0x03, 0x00, 
-    0xFF, 0x03, 0x08, 0x09, 0x02, 0xF9, 0xF4, 0xF3, 0xF5, 0xF5, 0xF4, 0xF4, 
-    0xF4, 0xF5, 0xF5, 0xF3, 0xF0, 0xF0, 0xF3, 0xF8, 0xFC, 0xFE, 0xFD, 0xFA, 
-    0xF9, 0xF9, 0xF8, 0xF7, 0xF9, 0xFF, 0x04, 0x01, 0xF9, 0xF0, 0xEA, 0xE8, 
-    0xE8, 0xE8, 0xEA, 0xED, 0xF1, 0xF3, 0xF2, 0xF0, 0xEE, 0xF0, 0xF4, 0xFA, 
-    0xFE, 0x01, 0x04, 0x08, 0x0A, 0x0A, 0x09, 0x0A, 0x0F, 0x14, 0x12, 0x09, 
-    0xFF, 0xF9, 0xF8, 0xFB, 0xFD, 0xFF, 0x00, 0x02, 0x02, 0xFD, 0xF5, 0xEF, 
-    0xEA, 0xE8, 0xE8, 0xE9, 0xEA, 0xE9, 0xE9, 0xE6, 0xE0, 0xDC, 0xDC, 0xE2, 
-    0xE9, 0xEC, 0xE6, 0xDF, 0xDA, 0xD9, 0xDC, 0xDF, 0xE2, 0xE8, 0xF0, 0xF5, 
-    0xF7, 0xF5, 0xF3, 0xF2, 0xF5, 0xFA, 0xFE, 0x00, 0xFE, 0xFC, 0xF8, 0xF3, 
-    0xF0, 0xF0, 0xF5, 0xFC, 0xFD, 0xF7, 0xED, 0xE4, 0xE2, 0xE4, 0xE5, 0xE6, 
-    0xE7, 0xEA, 0xED, 0xEB, 0xE6, 0xDE, 0xDA, 0xDC, 0xE3, 0xEB, 0xF1, 0xF5, 
-    0xF8, 0xFA, 0xFA, 0xF8, 0xF6, 0xF7, 0xFD, 0x00, 0xFC, 0xF2, 0xEA, 0xE8, 
-    0xEA, 0xEE, 0xEF, 0xF1, 0xF4, 0xF6, 0xF6, 0xF0, 0xEA, 0xE7, 0xEC, 0xF4, 
-    0xFC, 0xFF, 0x00, 0xFE, 0xFD, 0xFB, 0xF8, 0xF5, 0xF5, 0xFB, 0x02, 0x05, 
-    0x00, 0xFC, 0xFB, 0xFE, 0x02, 0x03, 0x06, 0x09, 0x0C, 0x0E, 0x0B, 0x08, 
-    0x05, 0x04, 0x07, 0x0C, 0x10, 0x14, 0x17, 0x19, 0x18, 0x17, 0x16, 0x18, 
-    0x1D, 0x24, 0x27, 0x22, 0x1A, 0x15, 0x13, 0x14, 0x16, 0x18, 0x1B, 0x1D, 
-    0x1D, 0x1A, 0x14, 0x0C, 0x08, 0x08, 0x0B, 0x0F, 0x11, 0x13, 0x12, 0x10, 
-    0x0B, 0x06, 0x04, 0x07, 0x0F, 0x16, 0x17, 0x14, 0x11, 0x11, 0x15, 0x18, 
-    0x1A, 0x1E, 0x23, 0x29, 0x2A, 0x25, 0x1F, 0x1A, 0x1B, 0x20, 0x25, 0x28, 
-    0x27, 0x24, 0x1D, 0x14, 0x0C, 0x07, 0x09, 0x11, 0x16, 0x14, 0x0A, 0xFF, 
-    0xF8, 0xF6, 0xF7, 0xF8, 0xFB, 0x01, 0x07, 0x09, 0x06, 0x01, 0xFF, 0x01, 
-    0x09, 0x11, 0x18, 0x1C, 0x1C, 0x19, 0x15, 0x11, 0x0C, 0x0B, 0x0E, 0x10, 
-    0x0E, 0x06, 0xFC, 0xF3, 0xEE, 0xEF, 0xF2, 0xF9, 0x01, 0x05, 0x04, 0xFF, 
-    0xFA, 0xF6, 0xF7, 0xFC, 0x03, 0x0A, 0x0D, 0x0D, 0x0A, 0x04, 0xFE, 0xFA, 
-    0xFA, 0xFE, 0x03, 0x05, 0xFE, 0xF4, 0xEB, 0xE7, 0xEA, 0xEE, 0xF3, 0xF8, 
-    0xFB, 0xFC, 0xFB, 0xF8, 0xF4, 0xF2, 0xF2, 0xF6, 0xFB, 0xFE, 0xFF, 0x00, 
-    0xFD, 0xF9, 0xF6, 0xF6, 0xFC, 0x04, 0x08, 0x04, 0xFB, 0xF3, 0xF2, 0xF4, 
-    0xF8, 0xFE, 0x06, 0x0D, 0x10, 0x0D, 0x03, 0xF7, 0xEF, 0xEC, 0xEE, 0xF2, 
-    0xF3, 0xF3, 0xF0, 0xEC, 0xE6, 0xE1, 0xDF, 0xE2, 0xE8, 0xED, 0xED, 0xE9, 
-    0xE5, 0xE3, 0xE4, 0xE7, 0xEC, 0xF3, 0xF7, 0xF7, 0xF2, 0xEA, 0xE1, 0xDB, 
-    0xDB, 0xE1, 0xEA, 0xF3, 0xF8, 0xF8, 0xF5, 0xEF, 0xEA, 0xE7, 0xE9, 0xF0, 
-    0xF6, 0xF7, 0xF1, 0xE8, 0xDF, 0xDA, 0xDA, 0xE0, 0xE9, 0xF0, 0xF3, 0xEF, 
-    0xE9, 0xE2, 0xDE, 0xDF, 0xE6, 0xEE, 0xF4, 0xF8, 0xF7, 0xF5, 0xF1, 0xED, 
-    0xEB, 0xED, 0xF2, 0xFA, 0xFD, 0xF8, 0xF0, 0xE9, 0xE7, 0xEA, 0xF2, 0xFB, 
-    0x03, 0x06, 0x03, 0xFC, 0xF4, 0xEE, 0xEC, 0xF1, 0xF9, 0x01, 0x06, 0x07, 
-    0x05, 0xFF, 0xF7, 0xF1, 0xF1, 0xF7, 0xFF, 0x03, 0xFD, 0xF3, 0xEB, 0xE9, 
-    0xEC, 0xF1, 0xF8, 0xFE, 0x00, 0xFF, 0xFB, 0xF5, 0xF1, 0xF1, 0xF7, 0x02, 
-    0x0D, 0x15, 0x15, 0x13, 0x0F, 0x0D, 0x0E, 0x12, 0x1A, 0x23, 0x2A, 0x2C, 
-    0x28, 0x22, 0x1F, 0x1D, 0x1E, 0x24, 0x2A, 0x2E, 0x2D, 0x26, 0x1B, 0x11, 
-    0x0A, 0x09, 0x0D, 0x13, 0x17, 0x16, 0x11, 0x0B, 0x04, 0x01, 0x00, 0x03, 
-    0x0A, 0x10, 0x11, 0x0D, 0x04, 0xFD, 0xFB, 0xFD, 0x06, 0x12, 0x1B, 0x1E, 
-    0x1C, 0x17, 0x13, 0x12, 0x15, 0x1D, 0x26, 0x2D, 0x30, 0x2E, 0x29, 0x21, 
-    0x1A, 0x15, 0x14, 0x19, 0x20, 0x22, 0x1B, 0x0F, 0x03, 0xFB, 0xF7, 0xF9, 
-    0x00, 0x08, 0x0D, 0x0D, 0x09, 0x02, 0xFC, 0xFC, 0x03, 0x0F, 0x19, 0x1F, 
-    0x20, 0x1D, 0x16, 0x0E, 0x0A, 0x0B, 0x11, 0x17, 0x19, 0x13, 0x07, 0xFB, 
-    0xF4, 0xF3, 0xF8, 0x00, 0x08, 0x0E, 0x0D, 0x09, 0x01, 0xF9, 0xF2, 0xF2, 
-    0xF9, 0x01, 0x08, 0x0A, 0x07, 0x01, 0xFA, 0xF4, 0xF1, 0xF3, 0xF9, 0xFF, 
-    0x00, 0xF9, 0xEF, 0xE8, 0xE6, 0xE9, 0xF0, 0xF9, 0x01, 0x04, 0x00, 0xF9, 
-    0xF0, 0xEA, 0xEB, 0xF4, 0xFE, 0x05, 0x07, 0x06, 0x03, 0xFE, 0xFB, 0xFC, 
-    0x01, 0x0A, 0x11, 0x15, 0x12, 0x0D, 0x07, 0x02, 0xFF, 0x01, 0x07, 0x0C, 
-    0x0C, 0x06, 0xFE, 0xF4, 0xEC, 0xE9, 0xEA, 0xEF, 0xF4, 0xF9, 0xFC, 0xFB, 
-    0xF5, 0xED, 0xE8, 0xE8, 0xEE, 0xF4, 0xF7, 0xF3, 0xEC, 0xE5, 0xE1, 0xE1, 
-    0xE6, 0xF1, 0xFB, 0xFF, 0xFC, 0xF4, 0xEC, 0xE8, 0xE6, 0xEA, 0xF0, 0xF7, 
-    0xFD, 0x00, 0xFF, 0xF9, 0xF0, 0xE9, 0xE8, 0xEB, 0xEF, 0xF2, 0xEE, 0xE8, 
-    0xE1, 0xDC, 0xDA, 0xDB, 0xE2, 0xE9, 0xEF, 0xEF, 0xEB, 0xE5, 0xDF, 0xDC, 
-    0xE0, 0xEA, 0xF6, 0xFD, 0xFE, 0xFB, 0xF4, 0xEB, 0xE5, 0xE3, 0xE6, 0xED, 
-    0xF1, 0xEE, 0xE6, 0xDC, 0xD8, 0xD8, 0xDE, 0xE8, 0xF3, 0xFB, 0xFD, 0xF8, 
-    0xEF, 0xE7, 0xE5, 0xE9, 0xF3, 0xFC, 0x02, 0x04, 0x02, 0xFE, 0xFA, 0xF8, 
-    0xF9, 0xFE, 0x04, 0x08, 0x09, 0x04, 0xFB, 0xF4, 0xEF, 0xEF, 0xF7, 0x02, 
-    0x0A, 0x0A, 0x01, 0xF6, 0xEE, 0xEC, 0xF2, 0xFD, 0x09, 0x10, 0x12, 0x0E, 
-    0x09, 0x05, 0x03, 0x05, 0x0C, 0x15, 0x1D, 0x1F, 0x1C, 0x16, 0x10, 0x0C, 
-    0x0F, 0x16, 0x22, 0x2A, 0x2B, 0x25, 0x1B, 0x12, 0x0C, 0x0E, 0x15, 0x1B, 
-    0x1E, 0x1E, 0x1C, 0x17, 0x12, 0x0A, 0x07, 0x07, 0x0C, 0x12, 0x14, 0x0E, 
-    0x03, 0xF8, 0xF2, 0xF2, 0xF9, 0x06, 0x11, 0x18, 0x18, 0x13, 0x0C, 0x07, 
-    0x08, 0x11, 0x1F, 0x28, 0x2D, 0x2D, 0x2A, 0x23, 0x1B, 0x14, 0x11, 0x12, 
-    0x18, 0x1B, 0x18, 0x0F, 0x05, 0xFE, 0xF9, 0xFB, 0x02, 0x0C, 0x13, 0x14, 
-    0x0C, 0x01, 0xF7, 0xF2, 0xF6, 0x00, 0x0B, 0x13, 0x14, 0x10, 0x08, 0xFF, 
-    0xF8, 0xF6, 0xFA, 0x03, 0x0B, 0x0E, 0x09, 0x00, 0xF7, 0xF2, 0xF3, 0xFE, 
-    0x0D, 0x19, 0x1C, 0x19, 0x0F, 0x05, 0xFF, 0x00, 0x09, 0x12, 0x19, 0x19, 
-    0x14, 0x0D, 0x04, 0xFB, 0xF8, 0xF9, 0xFF, 0x07, 0x0A, 0x05, 0xFB, 0xF1, 
-    0xEB, 0xEB, 0xF2, 0xFC, 0x05, 0x06, 0xFF, 0xF1, 0xE3, 0xD9, 0xD7, 0xDD, 
-    0xE6, 0xEE, 0xF2, 0xF4, 0xF4, 0xF3, 0xF2, 0xF4, 0xF9, 0x02, 0x0B, 0x0F, 
-    0x0B, 0x04, 0x00, 0xFF, 0x03, 0x09, 0x10, 0x14, 0x15, 0x0E, 0x04, 0xFC, 
-    0xF6, 0xF6, 0xFA, 0xFE, 0x01, 0x01, 0xFF, 0xFD, 0xFA, 0xF5, 0xF2, 0xF0, 
-    0xF2, 0xF3, 0xF2, 0xEC, 0xE4, 0xDC, 0xD9, 0xDA, 0xDE, 0xE7, 0xEF, 0xF5, 
-    0xF5, 0xEF, 0xE7, 0xE2, 0xE3, 0xE9, 0xF4, 0xFC, 0x01, 0x01, 0xFD, 0xF9, 
-    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xEF, 0xE6, 0xDE, 0xD8, 0xD3, 0xD2, 
-    0xD7, 0xDF, 0xE7, 0xEA, 0xE8, 0xE3, 0xDE, 0xDC, 0xDE, 0xE5, 0xED, 0xF4, 
-    0xF8, 0xF8, 0xF6, 0xF2, 0xED, 0xEB, 0xEC, 0xF2, 0xF9, 0xFD, 0xFA, 0xF2, 
-    0xEB, 0xE4, 0xE4, 0xED, 0xF9, 0x04, 0x07, 0x01, 0xF5, 0xEB, 0xE6, 0xE9, 
-    0xF2, 0xFB, 0x02, 0x05, 0x03, 0xFF, 0xF8, 0xF3, 0xF0, 0xF2, 0xF6, 0xFC, 
-    0xFF, 0xFB, 0xF3, 0xED, 0xEA, 0xEB, 0xF1, 0xFC, 0x07, 0x0C, 0x09, 0xFF, 
-    0xF5, 0xF0, 0xF1, 0xF7, 0x01, 0x08, 0x0C, 0x0D, 0x0B, 0x07, 0x03, 0x02, 
-    0x05, 0x0B, 0x12, 0x15, 0x12, 0x09, 0x02, 0xFE, 0x00, 0x0A, 0x17, 0x23, 
-    0x28, 0x26, 0x1F, 0x16, 0x11, 0x12, 0x18, 0x1F, 0x24, 0x25, 0x22, 0x1E, 
-    0x1A, 0x17, 0x14, 0x13, 0x14, 0x16, 0x17, 0x14, 0x0E, 0x06, 0x01, 0xFE, 
-    0x01, 0x0A, 0x14, 0x1A, 0x19, 0x12, 0x09, 0x02, 0x02, 0x08, 0x12, 0x1B, 
-    0x21, 0x21, 0x1E, 0x1B, 0x17, 0x15, 0x13, 0x13, 0x15, 0x17, 0x14, 0x0C, 
-    0x04, 0xFF, 0xFE, 0x00, 0x05, 0x0E, 0x15, 0x19, 0x16, 0x0E, 0x07, 0x04, 
-    0x06, 0x0B, 0x10, 0x14, 0x16, 0x16, 0x14, 0x0F, 0x08, 0x03, 0x02, 0x06, 
-    0x0B, 0x0E, 0x0B, 0x04, 0xFF, 0xF9, 0xF6, 0xF9, 0x02, 0x0B, 0x10, 0x0D, 
-    0x04, 0xFA, 0xF3, 0xF2, 0xF6, 0xFE, 0x07, 0x0B, 0x0C, 0x09, 0x05, 0xFF, 
-    0xFB, 0xFA, 0xFD, 0x03, 0x05, 0x01, 0xF8, 0xF0, 0xEB, 0xEC, 0xF2, 0xFA, 
-    0x00, 0x03, 0x00, 0xF7, 0xEE, 0xE4, 0xE1, 0xE0, 0xE5, 0xEA, 0xF0, 0xF5, 
-    0xF7, 0xF4, 0xF3, 0xF4, 0xF3, 0xF9, 0x03, 0x0C, 0x0A, 0x04, 0x03, 0xFC, 
-    0xFC, 0xFB, 0x01, 0x0D, 0x15, 0x15, 0x0D, 0x07, 0xFA, 0xFD, 0xFE, 0x02, 
-    0x06, 0x08, 0x0A, 0x00, 0xFB, 0xF5, 0xEF, 0xF7, 0xF8, 0xF8, 0xFB, 0xF9, 
-    0xF6, 0xF1, 0xED, 0xE8, 0xE5, 0xE4, 0xED, 0xF5, 0xFA, 0xF7, 0xEE, 0xE9, 
-    0xE5, 0xEC, 0xEB, 0xF4, 0xFB, 0xFC, 0x02, 0x01, 0x00, 0xFC, 0xF6, 0xF4, 
-    0xFC, 0xFA, 0x05, 0x01, 0xFA, 0xF4, 0xE9, 0xE9, 0xE3, 0xEB, 0xF0, 0xF2, 
-    0xF1, 0xE1, 0xE4, 0xDE, 0xDC, 0xDF, 0xDD, 0xEE, 0xF0, 0xF2, 0xF3, 0xF2, 
-    0xE8, 0xE7, 0xE2, 0xEE, 0xEE, 0xEB, 0xEC, 0xDE, 0xE3, 0xE5, 0xE0, 0xE5, 
-    0xF3, 0xF5, 0xFB, 0xF7, 0xFA, 0xF2, 0xEB, 0xEC, 0xF4, 0xFA, 0x03, 0x07, 
-    0x03, 0x02, 0xFE, 0xFF, 0xF5, 0xFC, 0xFD, 0xFC, 0xFB, 0xFC, 0xF6, 0xEC, 
-    0xE6, 0xE5, 0xEC, 0xF1, 0xF8, 0xF6, 0xEF, 0xE7, 0xDF, 0xD6, 0xDB, 0xD8, 
-    0xDB, 0xE0, 0xDD, 0xDD, 0xDE, 0xD9, 0xE4, 0xE6, 0xE9, 0xF0, 0xEF, 0xF9, 
-    0xFA, 0xFB, 0xF7, 0xF9, 0xFD, 0x05, 0x0D, 0x1A, 0x27, 0x24, 0x27, 0x24, 
-    0x20, 0x1D, 0x1E, 0x23, 0x24, 0x26, 0x24, 0x21, 0x20, 0x1F, 0x18, 0x1E, 
-    0x22, 0x27, 0x30, 0x2E, 0x2A, 0x26, 0x22, 0x24, 0x2C, 0x2B, 0x34, 0x36, 
-    0x36, 0x32, 0x2E, 0x2A, 0x26, 0x2D, 0x32, 0x30, 0x34, 0x34, 0x2F, 0x33, 
-    0x2E, 0x2B, 0x26, 0x26, 0x26, 0x27, 0x28, 0x24, 0x1A, 0x15, 0x0F, 0x0C, 
-    0x10, 0x15, 0x20, 0x21, 0x23, 0x17, 0x10, 0x07, 0x02, 0x04, 0x06, 0x09, 
-    0x05, 0x05, 0xFC, 0xFB, 0xFA, 0xF9, 0xFB, 0xFB, 0x00, 0x01, 0xF9, 0xEF, 
-    0xE9, 0xE4, 0xE5, 0xE9, 0xF0, 0xF1, 0xF8, 0xF4, 0xED, 0xF0, 0xE6, 0xE3, 
-    0xE4, 0xEA, 0xEF, 0xF7, 0xF4, 0xF4, 0xF3, 0xEC, 0xEA, 0xE6, 0xEC, 0xEE, 
-    0xF2, 0xED, 0xE9, 0xDE, 0xDB, 0xD7, 0xD7, 0xE3, 0xEA, 0xF6, 0xF0, 0xE8, 
-    0xDD, 0xD5, 0xD1, 0xD7, 0xDD, 0xE2, 0xE4, 0xE1, 0xE6, 0xE1, 0xE5, 0xED, 
-    0xF2, 0xFF, 0x07, 0x0A, 0x08, 0x03, 0x01, 0x03, 0x04, 0x0A, 0x10, 0x1E, 
-    0x28, 0x2A, 0x28, 0x1C, 0x1F, 0x18, 0x1D, 0x19, 0x1C, 0x1F, 0x1C, 0x20, 
-    0x1B, 0x1C, 0x17, 0x1E, 0x1B, 0x21, 0x22, 0x1D, 0x18, 0x0E, 0x0C, 0x0C, 
-    0x12, 0x16, 0x1E, 0x1C, 0x1C, 0x11, 0x09, 0x08, 0x01, 0x02, 0x01, 0x03, 
-    0x07, 0x05, 0x04, 0x08, 0x07, 0x0E, 0x05, 0x03, 0x00, 0xFB, 0xFB, 0xF8, 
-    0xF1, 0xEE, 0xEF, 0xEB, 0xEB, 0xE7, 0xE7, 0xE9, 0xEC, 0xED, 0xE4, 0xDA, 
-    0xD5, 0xD0, 0xD4, 0xD7, 0xDD, 0xE0, 0xDD, 0xDA, 0xDA, 0xD2, 0xCE, 0xCE, 
-    0xCD, 0xD0, 0xCF, 0xCC, 0xC7, 0xC8, 0xC5, 0xC7, 0xCA, 0xD2, 0xDA, 0xE2, 
-    0xDB, 0xD4, 0xD4, 0xCE, 0xD0, 0xD0, 0xD7, 0xDE, 0xE7, 0xE9, 0xE4, 0xE1, 
-    0xDA, 0xD4, 0xD6, 0xDA, 0xDD, 0xE2, 0xE3, 0xD9, 0xD9, 0xD4, 0xD0, 0xDA, 
-    0xE2, 0xEE, 0xF3, 0xEF, 0xE8, 0xE0, 0xDF, 0xE1, 0xE8, 0xF6, 0xFB, 0xFB, 
-    0xF6, 0xF4, 0xEC, 0xF3, 0xF5, 0xFE, 0x0C, 0x0F, 0x1A, 0x16, 0x0D, 0x08, 
-    0x0B, 0x11, 0x1C, 0x1D, 0x28, 0x26, 0x29, 0x29, 0x23, 0x28, 0x27, 0x2B, 
-    0x2D, 0x31, 0x2D, 0x2C, 0x28, 0x2B, 0x2C, 0x30, 0x34, 0x3C, 0x3E, 0x3F, 
-    0x3D, 0x30, 0x2C, 0x2A, 0x2C, 0x33, 0x35, 0x39, 0x3D, 0x3A, 0x32, 0x2C, 
-    0x2D, 0x2C, 0x2C, 0x2C, 0x2C, 0x29, 0x29, 0x26, 0x28, 0x2A, 0x2B, 0x2E, 
-    0x2D, 0x2A, 0x24, 0x1C, 0x18, 0x13, 0x0F, 0x10, 0x08, 0x0A, 0x07, 0x07, 
-    0x09, 0x07, 0x06, 0x01, 0xF9, 0xF2, 0xEC, 0xED, 0xEB, 0xF3, 0xF4, 0xEF, 
-    0xF4, 0xEC, 0xEF, 0xEB, 0xED, 0xEF, 0xEF, 0xEC, 0xE4, 0xE2, 0xDC, 0xE7, 
-    0xE9, 0xF5, 0x02, 0x05, 0x0A, 0x05, 0xFE, 0xF6, 0xF3, 0xEF, 0xF7, 0xF7, 
-    0xFF, 0x02, 0x03, 0x06, 0x02, 0xFD, 0xF9, 0xF8, 0xF6, 0xF8, 0xEE, 0xE6, 
-    0xDC, 0xDD, 0xDA, 0xDE, 0xE3, 0xEE, 0xF7, 0xF7, 0xF5, 0xE4, 0xDE, 0xD7, 
-    0xDB, 0xE5, 0xED, 0xF5, 0xF7, 0xF6, 0xF0, 0xED, 0xEB, 0xEE, 0xFA, 0x04, 
-    0x0A, 0x06, 0x01, 0xFD, 0xFE, 0x05, 0x0D, 0x1B, 0x23, 0x25, 0x25, 0x1B, 
-    0x14, 0x10, 0x0D, 0x14, 0x17, 0x1F, 0x1D, 0x1E, 0x1A, 0x16, 0x13, 0x12, 
-    0x17, 0x19, 0x19, 0x19, 0x1A, 0x0F, 0x0F, 0x07, 0x10, 0x13, 0x1C, 0x25, 
-    0x22, 0x24, 0x19, 0x10, 0x0A, 0x09, 0x06, 0x0E, 0x11, 0x10, 0x0F, 0x06, 
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x00, 0xF9, 0xF3, 0xED, 0xEC, 0xF1, 
-    0xF3, 0xF3, 0xF1, 0xEF, 0xEB, 0xE9, 0xE8, 0xE4, 0xE6, 0xE7, 0xEB, 0xEC, 
-    0xEA, 0xEA, 0xEA, 0xF0, 0xEE, 0xEC, 0xE7, 0xE5, 0xE4, 0xE5, 0xE5, 0xDF, 
-    0xD9, 0xD4, 0xD0, 0xCB, 0xC9, 0xC9, 0xD0, 0xD3, 0xD6, 0xD6, 0xD1, 0xCF, 
-    0xCE, 0xD1, 0xD5, 0xD4, 0xD7, 0xD8, 0xDD, 0xDC, 0xDF, 0xDD, 0xE1, 0xE6, 
-    0xE7, 0xF1, 0xEC, 0xEA, 0xE3, 0xE1, 0xDB, 0xDC, 0xE0, 0xE6, 0xEA, 0xE9, 
-    0xEC, 0xE3, 0xDC, 0xD6, 0xCE, 0xCE, 0xD4, 0xD5, 0xD8, 0xD6, 0xD4, 0xD1, 
-    0xCF, 0xD4, 0xD7, 0xE4, 0xEB, 0xEC, 0xE6, 0xE0, 0xDA, 0xDA, 0xE5, 0xEF, 
-    0xFD, 0x06, 0x06, 0x06, 0xFF, 0xF7, 0xF2, 0xF2, 0xF7, 0xFC, 0xFB, 0xFC, 
-    0xF7, 0xF5, 0xF8, 0xFB, 0x01, 0x0B, 0x13, 0x16, 0x14, 0x09, 0x05, 0x04, 
-    0x09, 0x0F, 0x19, 0x25, 0x2B, 0x2D, 0x2C, 0x24, 0x1C, 0x18, 0x19, 0x1D, 
-    0x1E, 0x1C, 0x19, 0x18, 0x13, 0x11, 0x12, 0x12, 0x17, 0x19, 0x1B, 0x13, 
-    0x08, 0x00, 0x02, 0x09, 0x0F, 0x1B, 0x22, 0x29, 0x26, 0x22, 0x1E, 0x18, 
-    0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x20, 0x1E, 0x22, 0x28, 0x2A, 0x2D, 0x2C, 
-    0x2A, 0x28, 0x24, 0x20, 0x1B, 0x1B, 0x1D, 0x1F, 0x23, 0x26, 0x28, 0x28, 
-    0x26, 0x26, 0x26, 0x20, 0x1C, 0x1B, 0x1E, 0x24, 0x24, 0x28, 0x29, 0x2B, 
-    0x2C, 0x29, 0x23, 0x1D, 0x1E, 0x1B, 0x15, 0x0F, 0x08, 0x07, 0x09, 0x07, 
-    0x05, 0x09, 0x08, 0x09, 0x08, 0x05, 0xFF, 0xF9, 0xFA, 0xF8, 0xFF, 0x02, 
-    0x07, 0x0A, 0x08, 0x06, 0xFE, 0xF9, 0xF7, 0xFC, 0x02, 0x02, 0x02, 0xFD, 
-    0xFA, 0xF7, 0xF4, 0xF5, 0xFD, 0x08, 0x0C, 0x0B, 0x06, 0x02, 0xFD, 0xFF, 
-    0x06, 0x0C, 0x13, 0x14, 0x11, 0x0E, 0x06, 0x02, 0x05, 0x06, 0x0B, 0x13, 
-    0x0F, 0x07, 0xFF, 0xF8, 0xF0, 0xEB, 0xEC, 0xEF, 0xF2, 0xF0, 0xEB, 0xE3, 
-    0xDE, 0xD7, 0xD8, 0xD9, 0xDD, 0xE0, 0xDD, 0xDB, 0xD5, 0xD0, 0xCD, 0xCF, 
-    0xD1, 0xD7, 0xDE, 0xE0, 0xDB, 0xD0, 0xC5, 0xC2, 0xC4, 0xC9, 0xCE, 0xCD, 
-    0xC9, 0xC6, 0xC0, 0xBE, 0xC0, 0xC5, 0xCC, 0xD2, 0xD3, 0xCF, 0xCB, 0xCB, 
-    0xCF, 0xD6, 0xDE, 0xE2, 0xE6, 0xEA, 0xE9, 0xE4, 0xDB, 0xD9, 0xDC, 0xDD, 
-    0xDF, 0xDA, 0xD9, 0xDA, 0xDA, 0xDC, 0xDD, 0xDE, 0xD8, 0xD8, 0xD1, 0xCE, 
-    0xCC, 0xCA, 0xCD, 0xD1, 0xD8, 0xDA, 0xE0, 0xE3, 0xE8, 0xE9, 0xE7, 0xE6, 
-    0xE4, 0xE9, 0xEB, 0xEC, 0xF1, 0xF3, 0xF6, 0xFA, 0xFB, 0xFB, 0xF9, 0xF6, 
-    0xF2, 0xEA, 0xE9, 0xE6, 0xE8, 0xF0, 0xF9, 0x01, 0x04, 0x04, 0x02, 0x01, 
-    0x02, 0x08, 0x0A, 0x0A, 0x0A, 0x08, 0x08, 0x08, 0x0E, 0x19, 0x24, 0x2B, 
-    0x27, 0x20, 0x1A, 0x13, 0x11, 0x12, 0x16, 0x17, 0x1C, 0x1B, 0x17, 0x13, 
-    0x0F, 0x0F, 0x0F, 0x17, 0x17, 0x12, 0x0A, 0x02, 0x03, 0x08, 0x0E, 0x17, 
-    0x1F, 0x24, 0x28, 0x27, 0x23, 0x23, 0x22, 0x24, 0x27, 0x27, 0x27, 0x27, 
-    0x28, 0x26, 0x21, 0x19, 0x1A, 0x1B, 0x1F, 0x23, 0x1E, 0x18, 0x10, 0x0E, 
-    0x14, 0x19, 0x22, 0x28, 0x2C, 0x2B, 0x23, 0x1D, 0x16, 0x17, 0x19, 0x22, 
-    0x22, 0x23, 0x20, 0x19, 0x18, 0x13, 0x16, 0x1A, 0x1B, 0x18, 0x12, 0x08, 
-    0xFF, 0xF9, 0xFF, 0x04, 0x09, 0x09, 0x07, 0x04, 0xFF, 0xFF, 0xFD, 0xFA, 
-    0xFD, 0xFE, 0xFC, 0xFE, 0xFA, 0xF9, 0xFB, 0xFE, 0x00, 0xFF, 0xFE, 0xFC, 
-    0xFD, 0x00, 0xFD, 0xFC, 0xF9, 0xFA, 0xFD, 0xFD, 0xFE, 0xFD, 0x03, 0x01, 
-    0x02, 0x01, 0xFC, 0xFE, 0x02, 0x02, 0x03, 0xFC, 0xF8, 0xF9, 0xFC, 0x00, 
-    0x00, 0xFC, 0xF7, 0xF6, 0xF4, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xEE, 
-    0xEC, 0xED, 0xF3, 0xF7, 0xFE, 0xFC, 0xFB, 0xF8, 0xF5, 0xF3, 0xF5, 0xFA, 
-    0x01, 0x06, 0x05, 0x04, 0xFF, 0xFF, 0x04, 0x0F, 0x15, 0x18, 0x11, 0x09, 
-    0x06, 0x00, 0x01, 0x04, 0x07, 0x0C, 0x10, 0x0D, 0x0E, 0x0C, 0x0A, 0x0A, 
-    0x09, 0x09, 0x0B, 0x0C, 0x0D, 0x0F, 0x0F, 0x10, 0x10, 0x14, 0x18, 0x16, 
-    0x15, 0x0D, 0x05, 0x00, 0xFA, 0xFA, 0xFA, 0xFC, 0x00, 0x05, 0x04, 0xFE, 
-    0xF1, 0xE9, 0xE4, 0xE3, 0xE8, 0xE9, 0xEB, 0xEB, 0xEE, 0xED, 0xEE, 0xF1, 
-    0xF7, 0x00, 0x06, 0x00, 0xF9, 0xF3, 0xF0, 0xF5, 0xFA, 0xFC, 0xFE, 0x01, 
-    0x01, 0xFE, 0xF8, 0xF2, 0xEF, 0xF2, 0xF1, 0xEF, 0xEB, 0xE4, 0xE9, 0xEC, 
-    0xF4, 0xF8, 0xFB, 0xFC, 0xFF, 0x06, 0x08, 0x0A, 0x09, 0x0C, 0x0B, 0x0E, 
-    0x0C, 0x0E, 0x0F, 0x10, 0x0F, 0x0A, 0x09, 0x01, 0xFE, 0xFA, 0xF6, 0xF2, 
-    0xEF, 0xED, 0xED, 0xEF, 0xED, 0xED, 0xEA, 0xE8, 0xEA, 0xE7, 0xE4, 0xE2, 
-    0xE3, 0xE7, 0xEB, 0xF1, 0xF2, 0xF3, 0xF3, 0xF3, 0xF6, 0xF8, 0xF8, 0xF5, 
-    0xEF, 0xEC, 0xEB, 0xEF, 0xF5, 0xFB, 0xFE, 0xFC, 0xF7, 0xF1, 0xF1, 0xF3, 
-    0xFA, 0xFD, 0xFB, 0xFA, 0xFA, 0xFB, 0xFB, 0xFC, 0x00, 0x06, 0x0D, 0x11, 
-    0x0E, 0x09, 0x06, 0x06, 0x09, 0x0D, 0x10, 0x12, 0x12, 0x0D, 0x08, 0xFF, 
-    0xF8, 0xF6, 0xF9, 0xFA, 0xF7, 0xF0, 0xEB, 0xEC, 0xE9, 0xE8, 0xE4, 0xE4, 
-    0xEA, 0xEF, 0xF2, 0xEE, 0xE8, 0xE4, 0xE3, 0xE5, 0xEB, 0xF1, 0xF5, 0xF8, 
-    0xFB, 0xF9, 0xF8, 0xF5, 0xF4, 0xFA, 0x01, 0x02, 0xFE, 0xF7, 0xF2, 0xF1, 
-    0xF4, 0xFA, 0xFE, 0x04, 0x05, 0x04, 0x05, 0x03, 0x04, 0x0A, 0x0F, 0x11, 
-    0x0F, 0x0A, 0x04, 0x02, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x01, 0x07, 0x02, 
-    0xFF, 0xFB, 0xFA, 0xFF, 0xFC, 0xFA, 0xF7, 0xF5, 0xF5, 0xF8, 0xF8, 0xFB, 
-    0xFC, 0xFB, 0xFC, 0xFD, 0xFE, 0xFE, 0x02, 0x02, 0x02, 0x02, 0x04, 0x08, 
-    0x0C, 0x0E, 0x09, 0x03, 0xFE, 0x00, 0x04, 0x06, 0x07, 0x07, 0x0A, 0x0F, 
-    0x14, 0x18, 0x19, 0x19, 0x17, 0x11, 0x10, 0x10, 0x14, 0x1B, 0x21, 0x25, 
-    0x24, 0x24, 0x22, 0x23, 0x28, 0x25, 0x27, 0x24, 0x23, 0x22, 0x1A, 0x14, 
-    0x0F, 0x11, 0x15, 0x18, 0x16, 0x0E, 0x07, 0x01, 0xFF, 0x00, 0x03, 0x03, 
-    0x07, 0x06, 0x05, 0x04, 0x00, 0xFE, 0xFB, 0xFE, 0xFE, 0xFC, 0xF8, 0xF4, 
-    0xF5, 0xF6, 0xF5, 0xF4, 0xF5, 0xF8, 0xFA, 0xF9, 0xF5, 0xEE, 0xE7, 0xE5, 
-    0xE3, 0xE4, 0xE8, 0xE9, 0xEF, 0xF2, 0xF3, 0xF1, 0xF1, 0xF7, 0xFD, 0x04, 
-    0x02, 0xFC, 0xF8, 0xF6, 0xF8, 0xFB, 0xFD, 0xFF, 0x00, 0xFC, 0xF7, 0xF2, 
-    0xED, 0xE8, 0xE7, 0xE6, 0xE6, 0xE5, 0xE4, 0xE2, 0xDF, 0xDE, 0xDE, 0xE1, 
-    0xE3, 0xE8, 0xEB, 0xE9, 0xE9, 0xEA, 0xEE, 0xF6, 0xF9, 0xFC, 0xFB, 0xFA, 
-    0xF9, 0xF9, 0xFA, 0xF5, 0xF3, 0xEE, 0xEE, 0xEF, 0xF0, 0xF4, 0xF5, 0xF5, 
-    0xF6, 0xF6, 0xF5, 0xF6, 0xF8, 0xFA, 0xF7, 0xF5, 0xF4, 0xF9, 0xFF, 0x06, 
-    0x08, 0x08, 0x09, 0x0B, 0x0E, 0x10, 0x0F, 0x10, 0x0D, 0x0A, 0x08, 0x05, 
-    0x04, 0x01, 0x01, 0x04, 0x03, 0xFF, 0xFC, 0xF9, 0xFB, 0xFC, 0xFB, 0xFC, 
-    0x00, 0x01, 0x03, 0x00, 0xFB, 0xFA, 0xFD, 0x03, 0x06, 0x08, 0x07, 0x08, 
-    0x08, 0x0A, 0x0B, 0x0D, 0x0F, 0x0E, 0x0D, 0x07, 0x01, 0x00, 0x01, 0x06, 
-    0x0B, 0x09, 0x07, 0x07, 0x06, 0x06, 0x08, 0x09, 0x0B, 0x0F, 0x13, 0x14, 
-    0x17, 0x18, 0x16, 0x15, 0x12, 0x12, 0x15, 0x17, 0x19, 0x18, 0x17, 0x16, 
-    0x15, 0x17, 0x1B, 0x1E, 0x1B, 0x17, 0x0E, 0x08, 0x03, 0xFF, 0xFD, 0xFD, 
-    0x00, 0x02, 0x02, 0x01, 0xFE, 0xFB, 0xF8, 0xFA, 0x00, 0x06, 0x0A, 0x07, 
-    0x05, 0x00, 0xFF, 0x02, 0x08, 0x0C, 0x0F, 0x0D, 0x05, 0x01, 0x02, 0x06, 
-    0x0A, 0x0D, 0x0B, 0x09, 0x05, 0x05, 0x05, 0x04, 0x06, 0x05, 0x06, 0x07, 
-    0x06, 0x07, 0x09, 0x0C, 0x10, 0x13, 0x14, 0x16, 0x17, 0x18, 0x16, 0x0F, 
-    0x08, 0x05, 0x03, 0x03, 0x00, 0xFE, 0xFE, 0xFC, 0xFC, 0xFA, 0xF8, 0xF6, 
-    0xF6, 0xF5, 0xF4, 0xF3, 0xF0, 0xF1, 0xF2, 0xF6, 0xFB, 0x00, 0x01, 0x00, 
-    0x00, 0xFD, 0xFB, 0xFB, 0xFF, 0x05, 0x0A, 0x09, 0x04, 0xFF, 0xFB, 0xFA, 
-    0xFD, 0x03, 0x04, 0xFF, 0xF6, 0xF0, 0xED, 0xF2, 0xF9, 0x00, 0x08, 0x07, 
-    0x05, 0x01, 0xFE, 0x03, 0x07, 0x0A, 0x09, 0x05, 0x02, 0xFD, 0xFB, 0xF6, 
-    0xF2, 0xEF, 0xEE, 0xEF, 0xEE, 0xEA, 0xE2, 0xDB, 0xD4, 0xD2, 0xD2, 0xD2, 
-    0xD4, 0xD5, 0xD6, 0xD3, 0xD1, 0xCF, 0xD1, 0xD5, 0xD9, 0xDA, 0xDD, 0xE0, 
-    0xE2, 0xE2, 0xDD, 0xDB, 0xDD, 0xE4, 0xE9, 0xE9, 0xE4, 0xDB, 0xD5, 0xD3, 
-    0xD8, 0xDF, 0xE5, 0xE8, 0xE5, 0xDF, 0xDA, 0xD6, 0xD7, 0xDE, 0xE7, 0xEC, 
-    0xEB, 0xEA, 0xEA, 0xEE, 0xF3, 0xF6, 0xF8, 0xFA, 0xFB, 0xF9, 0xF8, 0xF7, 
-    0xF9, 0xFC, 0x00, 0x04, 0x03, 0xFF, 0xFA, 0xF6, 0xF5, 0xF4, 0xF3, 0xF2, 
-    0xF2, 0xF5, 0xF7, 0xF5, 0xF3, 0xF1, 0xF1, 0xF2, 0xF4, 0xF5, 0xF5, 0xF6, 
-    0xF9, 0xFC, 0xFE, 0x00, 0x03, 0x06, 0x08, 0x07, 0x02, 0xFE, 0xFE, 0xFF, 
-    0x02, 0x07, 0x0A, 0x0C, 0x0D, 0x0A, 0x05, 0xFF, 0xFF, 0x06, 0x0E, 0x12, 
-    0x10, 0x0B, 0x0A, 0x0B, 0x13, 0x1C, 0x25, 0x2C, 0x2C, 0x27, 0x20, 0x1C, 
-    0x1B, 0x20, 0x24, 0x25, 0x22, 0x1E, 0x18, 0x14, 0x12, 0x0E, 0x0E, 0x10, 
-    0x14, 0x14, 0x0F, 0x08, 0x03, 0x03, 0x06, 0x0C, 0x10, 0x14, 0x13, 0x0F, 
-    0x0B, 0x07, 0x05, 0x07, 0x0B, 0x10, 0x15, 0x18, 0x17, 0x14, 0x12, 0x11, 
-    0x11, 0x13, 0x16, 0x18, 0x17, 0x12, 0x0C, 0x07, 0x08, 0x0F, 0x17, 0x1D, 
-    0x1D, 0x18, 0x13, 0x11, 0x12, 0x17, 0x1B, 0x20, 0x23, 0x24, 0x21, 0x1D, 
-    0x18, 0x17, 0x1A, 0x1C, 0x1D, 0x19, 0x16, 0x13, 0x12, 0x11, 0x0F, 0x0F, 
-    0x0E, 0x0D, 0x09, 0x04, 0x00, 0xFC, 0xFA, 0xF9, 0xFA, 0xFC, 0xFD, 0x00, 
-    0x01, 0x00, 0xFD, 0xFB, 0xFE, 0x04, 0x07, 0x05, 0x01, 0xFF, 0x01, 0x03, 
-    0x05, 0x04, 0x02, 0x00, 0x01, 0x02, 0x00, 0xFD, 0xF8, 0xF6, 0xF5, 0xF6, 
-    0xF9, 0xFA, 0xFC, 0xFC, 0xFB, 0xFC, 0x00, 0x08, 0x0E, 0x0F, 0x0C, 0x06, 
-    0x04, 0x08, 0x0F, 0x15, 0x16, 0x13, 0x0C, 0x05, 0xFF, 0xFD, 0xFD, 0xFC, 
-    0xF8, 0xF3, 0xF0, 0xEB, 0xE9, 0xE9, 0xEA, 0xEB, 0xEC, 0xEA, 0xE6, 0xE4, 
-    0xE3, 0xE4, 0xE8, 0xEF, 0xF6, 0xFC, 0xFE, 0xFA, 0xF3, 0xEC, 0xE8, 0xE8, 
-    0xEA, 0xEB, 0xEA, 0xE6, 0xE5, 0xE4, 0xE5, 0xE3, 0xE0, 0xE1, 0xE3, 0xE5, 
-    0xE3, 0xE1, 0xE0, 0xE2, 0xE3, 0xE4, 0xE6, 0xEB, 0xF2, 0xF5, 0xF2, 0xEB, 
-    0xE6, 0xE7, 0xEC, 0xF2, 0xF8, 0xF8, 0xF4, 0xEA, 0xE2, 0xDF, 0xE1, 0xE6, 
-    0xEB, 0xEB, 0xE5, 0xDE, 0xD7, 0xD4, 0xD7, 0xDC, 0xE0, 0xE2, 0xE5, 0xE6, 
-    0xE5, 0xE3, 0xE2, 0xE3, 0xE7, 0xEC, 0xF0, 0xF2, 0xF1, 0xEE, 0xE9, 0xE9, 
-    0xEE, 0xF5, 0xFD, 0x00, 0xFE, 0xFB, 0xF6, 0xF3, 0xF5, 0xFA, 0xFF, 0x00, 
-    0xFE, 0xFA, 0xFA, 0xF8, 0xF9, 0xFA, 0xFE, 0x01, 0x05, 0x0A, 0x10, 0x13, 
-    0x0E, 0x09, 0x07, 0x0B, 0x11, 0x13, 0x10, 0x0E, 0x0B, 0x07, 0x05, 0x07, 
-    0x0B, 0x0E, 0x0D, 0x07, 0x00, 0xFC, 0xFD, 0x01, 0x04, 0x05, 0x05, 0x06, 
-    0x07, 0x06, 0x05, 0x05, 0x07, 0x0A, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0F, 
-    0x12, 0x17, 0x18, 0x19, 0x19, 0x15, 0x10, 0x10, 0x14, 0x1A, 0x1D, 0x1D, 
-    0x1A, 0x16, 0x13, 0x12, 0x13, 0x16, 0x17, 0x18, 0x16, 0x13, 0x12, 0x13, 
-    0x14, 0x17, 0x1B, 0x1F, 0x20, 0x1F, 0x1E, 0x1F, 0x1C, 0x16, 0x11, 0x12, 
-    0x16, 0x1A, 0x1A, 0x14, 0x0B, 0x03, 0x00, 0x02, 0x06, 0x09, 0x05, 0xFE, 
-    0xF8, 0xF4, 0xF3, 0xF8, 0x01, 0x08, 0x0B, 0x09, 0x03, 0xFC, 0xF8, 0xF6, 
-    0xF6, 0xF8, 0xFC, 0x00, 0x03, 0x03, 0xFF, 0xFB, 0xFA, 0x00, 0x05, 0x06, 
-    0x03, 0xFE, 0xFD, 0xFF, 0x03, 0x0A, 0x12, 0x1B, 0x21, 0x21, 0x1E, 0x18, 
-    0x15, 0x16, 0x17, 0x17, 0x16, 0x14, 0x13, 0x12, 0x0F, 0x0A, 0x03, 0xFD, 
-    0xF8, 0xF5, 0xF3, 0xF3, 0xF4, 0xF2, 0xEC, 0xE8, 0xE5, 0xE7, 0xEE, 0xF3, 
-    0xF5, 0xF0, 0xEC, 0xEB, 0xEE, 0xF3, 0xF5, 0xF3, 0xF0, 0xE9, 0xE7, 0xE7, 
-    0xEB, 0xF3, 0xF9, 0xFB, 0xFC, 0xFB, 0xF5, 0xF2, 0xED, 0xEE, 0xED, 0xF0, 
-    0xEC, 0xEB, 0xF3, 0xF7, 0xFE, 0xFC, 0xF6, 0xF4, 0xF0, 0xEC, 0xE8, 0xE3, 
-    0xE4, 0xE9, 0xF3, 0xFE, 0xFC, 0xF4, 0xEB, 0xE0, 0xD9, 0xDA, 0xD9, 0xDF, 
-    0xE5, 0xE6, 0xE9, 0xE6, 0xE3, 0xE0, 0xDC, 0xD9, 0xD3, 0xD2, 0xD0, 0xD5, 
-    0xDD, 0xE4, 0xE7, 0xE4, 0xE3, 0xDF, 0xDF, 0xDC, 0xD9, 0xDC, 0xDF, 0xE5, 
-    0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFB, 0xF8, 0xF4, 0xF7, 0xFD, 0x06, 0x0E, 
-    0x10, 0x0D, 0x09, 0x03, 0xFA, 0xF5, 0xF7, 0xFF, 0x03, 0x08, 0x09, 0x0D, 
-    0x0F, 0x0F, 0x0D, 0x09, 0x07, 0x05, 0x02, 0x00, 0x02, 0x06, 0x0F, 0x16, 
-    0x19, 0x18, 0x14, 0x0B, 0x04, 0xFD, 0xFA, 0xFD, 0x05, 0x10, 0x17, 0x1D, 
-    0x1B, 0x18, 0x14, 0x10, 0x12, 0x15, 0x19, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 
-    0x14, 0x0D, 0x08, 0x06, 0x09, 0x07, 0x07, 0x06, 0x0D, 0x13, 0x19, 0x18, 
-    0x11, 0x09, 0x02, 0xFB, 0xF8, 0xFC, 0x08, 0x19, 0x26, 0x2F, 0x2C, 0x23, 
-    0x15, 0x0C, 0x05, 0x04, 0x07, 0x0A, 0x12, 0x1C, 0x25, 0x23, 0x1C, 0x11, 
-    0x06, 0xFC, 0xF2, 0xE9, 0xE9, 0xF2, 0x02, 0x13, 0x20, 0x24, 0x1E, 0x17, 
-    0x09, 0x00, 0xF7, 0xF2, 0xF6, 0x00, 0x0C, 0x13, 0x12, 0x0D, 0x06, 0xFC, 
-    0xF5, 0xEF, 0xED, 0xF0, 0xF5, 0xFF, 0x06, 0x0C, 0x0C, 0x08, 0x03, 0xFD, 
-    0xFA, 0xF9, 0xFA, 0xFC, 0x03, 0x0B, 0x12, 0x13, 0x11, 0x09, 0x00, 0xF3, 
-    0xE9, 0xE5, 0xEB, 0xFB, 0x08, 0x0F, 0x0D, 0x0A, 0x05, 0xFD, 0xF9, 0xF8, 
-    0xFC, 0x02, 0x02, 0x07, 0x0B, 0x0E, 0x0F, 0x0A, 0x02, 0xFA, 0xF5, 0xF2, 
-    0xF3, 0xF6, 0xFC, 0x04, 0x11, 0x17, 0x15, 0x09, 0xFA, 0xEE, 0xE8, 0xE9, 
-    0xEE, 0xF9, 0x06, 0x12, 0x14, 0x0F, 0x04, 0xF7, 0xEB, 0xE4, 0xE1, 0xE2, 
-    0xE4, 0xE8, 0xF1, 0xF4, 0xF3, 0xEB, 0xE2, 0xDC, 0xDD, 0xE2, 0xE9, 0xEF, 
-    0xF4, 0xFE, 0x06, 0x0C, 0x0A, 0x06, 0xFD, 0xF2, 0xE8, 0xE0, 0xE1, 0xE8, 
-    0xF5, 0x01, 0x05, 0x03, 0xF8, 0xEC, 0xE1, 0xDE, 0xDF, 0xE4, 0xE4, 0xE6, 
-    0xF0, 0xF9, 0xFE, 0xFC, 0xF4, 0xEC, 0xE8, 0xE6, 0xE8, 0xEA, 0xF1, 0xFA, 
-    0x04, 0x0A, 0x0B, 0x05, 0xFC, 0xEF, 0xE2, 0xD8, 0xD4, 0xDA, 0xE4, 0xF0, 
-    0xF6, 0xF9, 0xF9, 0xF6, 0xF2, 0xED, 0xE8, 0xE4, 0xE4, 0xE3, 0xE9, 0xF0, 
-    0xF3, 0xF2, 0xEA, 0xE0, 0xD9, 0xD9, 0xDD, 0xE3, 0xE7, 0xEB, 0xF1, 0xF8, 
-    0xFF, 0xFE, 0xFB, 0xF3, 0xEE, 0xED, 0xF0, 0xF9, 0x06, 0x13, 0x1B, 0x1C, 
-    0x14, 0x0B, 0x01, 0xFE, 0xFC, 0xFD, 0xFF, 0x00, 0x05, 0x0E, 0x13, 0x15, 
-    0x13, 0x0E, 0x08, 0x03, 0x01, 0x03, 0x08, 0x0F, 0x17, 0x1E, 0x25, 0x27, 
-    0x23, 0x18, 0x0C, 0x01, 0xFC, 0xFD, 0x05, 0x10, 0x1B, 0x22, 0x23, 0x1F, 
-    0x1A, 0x15, 0x12, 0x12, 0x12, 0x11, 0x11, 0x19, 0x1E, 0x21, 0x1A, 0x0E, 
-    0x02, 0xFA, 0xFA, 0xFF, 0x04, 0x08, 0x0D, 0x13, 0x1A, 0x1D, 0x1C, 0x13, 
-    0x08, 0xFC, 0xF4, 0xF5, 0xFF, 0x0E, 0x1C, 0x24, 0x24, 0x20, 0x1B, 0x15, 
-    0x11, 0x0F, 0x0F, 0x13, 0x16, 0x1D, 0x27, 0x2C, 0x29, 0x1F, 0x0F, 0x03, 
-    0xFB, 0xFA, 0xFA, 0xF8, 0xFA, 0xFF, 0x07, 0x0D, 0x0F, 0x08, 0xFF, 0xF6, 
-    0xEE, 0xEC, 0xEE, 0xF6, 0xFE, 0x07, 0x08, 0x05, 0xFF, 0xFA, 0xF6, 0xF1, 
-    0xEE, 0xEC, 0xEE, 0xF6, 0x03, 0x0C, 0x0E, 0x0A, 0x02, 0xF9, 0xF4, 0xF4, 
-    0xF9, 0xFF, 0x05, 0x0B, 0x11, 0x17, 0x1A, 0x16, 0x0E, 0x02, 0xF7, 0xF0, 
-    0xF2, 0xF9, 0x04, 0x0D, 0x10, 0x0F, 0x09, 0x03, 0xFF, 0xFD, 0xFB, 0xFB, 
-    0xF9, 0xFA, 0x01, 0x09, 0x0C, 0x09, 0xFF, 0xF4, 0xED, 0xEC, 0xF0, 0xF4, 
-    0xF9, 0xFF, 0x05, 0x0C, 0x10, 0x10, 0x08, 0xFD, 0xF0, 0xE8, 0xE8, 0xF0, 
-    0xFB, 0x05, 0x0A, 0x0A, 0x06, 0x00, 0xFB, 0xF7, 0xF4, 0xEF, 0xEA, 0xE6, 
-    0xEA, 0xF0, 0xF4, 0xF2, 0xE8, 0xDE, 0xD6, 0xD6, 0xDD, 0xE3, 0xE9, 0xEC, 
-    0xF3, 0xFC, 0x03, 0x04, 0xFE, 0xF5, 0xEB, 0xE0, 0xDB, 0xDB, 0xE4, 0xF1, 
-    0xFA, 0xFB, 0xF6, 0xF0, 0xEB, 0xE9, 0xE9, 0xE8, 0xE9, 0xEA, 0xF1, 0xFB, 
-    0x00, 0x00, 0xFB, 0xF4, 0xEB, 0xE6, 0xE7, 0xED, 0xF3, 0xF9, 0xFE, 0x02, 
-    0x04, 0x06, 0x03, 0xFB, 0xEF, 0xE4, 0xDE, 0xE1, 0xE8, 0xF3, 0xFE, 0x03, 
-    0x03, 0xFD, 0xF5, 0xEF, 0xED, 0xEA, 0xE8, 0xE4, 0xE5, 0xEF, 0xFB, 0x01, 
-    0xFE, 0xF4, 0xE6, 0xDD, 0xDB, 0xDF, 0xE5, 0xE9, 0xED, 0xF2, 0xF8, 0xFE, 
-    0x01, 0x02, 0xFF, 0xF8, 0xF3, 0xF3, 0xFB, 0x07, 0x13, 0x1B, 0x1A, 0x19, 
-    0x18, 0x17, 0x17, 0x16, 0x15, 0x13, 0x11, 0x15, 0x1B, 0x21, 0x1F, 0x14, 
-    0x06, 0xFA, 0xF7, 0xFB, 0x01, 0x05, 0x07, 0x0B, 0x11, 0x14, 0x13, 0x0D, 
-    0x03, 0xF9, 0xF2, 0xF0, 0xF3, 0xFB, 0x04, 0x0C, 0x0E, 0x0C, 0x09, 0x08, 
-    0x0A, 0x0C, 0x0D, 0x0C, 0x0D, 0x15, 0x20, 0x26, 0x26, 0x1D, 0x11, 0x05, 
-    0xFD, 0xFC, 0x02, 0x08, 0x0D, 0x11, 0x16, 0x1B, 0x1E, 0x1C, 0x16, 0x0D, 
-    0x03, 0xFE, 0xFE, 0x04, 0x0D, 0x15, 0x1A, 0x19, 0x15, 0x11, 0x0E, 0x0E, 
-    0x0D, 0x0C, 0x0D, 0x11, 0x1C, 0x26, 0x2B, 0x27, 0x1C, 0x12, 0x0A, 0x08, 
-    0x09, 0x0A, 0x09, 0x08, 0x07, 0x06, 0x07, 0x06, 0x01, 0xF8, 0xEE, 0xE9, 
-    0xEB, 0xF3, 0xFD, 0x06, 0x0B, 0x0E, 0x0F, 0x0F, 0x0D, 0x0B, 0x09, 0x07, 
-    0x05, 0x07, 0x0F, 0x18, 0x1D, 0x1A, 0x0F, 0x01, 0xF8, 0xF7, 0xFB, 0x00, 
-    0x00, 0xFF, 0x04, 0x0B, 0x10, 0x10, 0x0C, 0x06, 0x00, 0xFC, 0xF8, 0xF7, 
-    0xF9, 0xFD, 0x00, 0xFF, 0xFD, 0xFB, 0xF9, 0xF8, 0xF6, 0xF5, 0xF6, 0xF9, 
-    0x02, 0x0C, 0x10, 0x0D, 0x04, 0xF9, 0xF0, 0xEC, 0xEB, 0xEF, 0xF2, 0xF4, 
-    0xF9, 0xFF, 0x03, 0x06, 0x04, 0x00, 0xF9, 0xF5, 0xF5, 0xF8, 0xFC, 0x00, 
-    0x05, 0x09, 0x08, 0x05, 0xFF, 0xFA, 0xF6, 0xF1, 0xEB, 0xE8, 0xEB, 0xF6, 
-    0xFE, 0xFE, 0xF8, 0xEC, 0xE3, 0xDD, 0xDA, 0xDC, 0xDF, 0xE2, 0xE7, 0xEF, 
-    0xF7, 0xFC, 0x00, 0xFF, 0xFA, 0xF3, 0xED, 0xE9, 0xE9, 0xEC, 0xEF, 0xF1, 
-    0xF2, 0xF4, 0xF8, 0xF8, 0xF7, 0xF5, 0xF3, 0xF5, 0xF8, 0xFF, 0x05, 0x06, 
-    0x02, 0xF9, 0xF1, 0xED, 0xED, 0xF1, 0xF4, 0xF3, 0xF3, 0xF7, 0xFC, 0xFE, 
-    0xFC, 0xF7, 0xF0, 0xEA, 0xE7, 0xE6, 0xE7, 0xEA, 0xEE, 0xF2, 0xF4, 0xF4, 
-    0xF3, 0xF0, 0xEC, 0xE7, 0xE4, 0xE4, 0xEA, 0xF5, 0x00, 0x05, 0x05, 0xFF, 
-    0xF6, 0xEF, 0xEA, 0xEA, 0xEC, 0xED, 0xEC, 0xED, 0xF1, 0xF5, 0xF7, 0xF7, 
-    0xF5, 0xF4, 0xF3, 0xF2, 0xF3, 0xF5, 0xFA, 0x02, 0x0A, 0x0E, 0x0F, 0x0D, 
-    0x0B, 0x09, 0x05, 0x03, 0x03, 0x09, 0x13, 0x1A, 0x19, 0x12, 0x09, 0x02, 
-    0x00, 0x00, 0x03, 0x06, 0x06, 0x07, 0x0B, 0x0E, 0x0F, 0x0D, 0x0B, 0x08, 
-    0x04, 0x04, 0x03, 0x05, 0x08, 0x09, 0x0C, 0x0E, 0x0E, 0x0F, 0x0D, 0x09, 
-    0x05, 0x01, 0x01, 0x08, 0x15, 0x1F, 0x23, 0x1F, 0x17, 0x10, 0x0D, 0x0D, 
-    0x10, 0x14, 0x14, 0x15, 0x19, 0x1E, 0x1E, 0x1B, 0x16, 0x11, 0x0F, 0x0B, 
-    0x07, 0x04, 0x04, 0x05, 0x08, 0x0C, 0x0F, 0x11, 0x11, 0x10, 0x0E, 0x0D, 
-    0x0F, 0x15, 0x20, 0x29, 0x2C, 0x2A, 0x24, 0x1F, 0x1A, 0x17, 0x16, 0x16, 
-    0x15, 0x12, 0x0F, 0x0C, 0x0A, 0x06, 0x00, 0xFA, 0xF5, 0xF4, 0xF5, 0xF8, 
-    0xFC, 0x01, 0x07, 0x0D, 0x11, 0x10, 0x0C, 0x09, 0x05, 0x00, 0xFC, 0xFC, 
-    0x03, 0x0E, 0x14, 0x12, 0x0B, 0x00, 0xF7, 0xF3, 0xF3, 0xF7, 0xF9, 0xF9, 
-    0xF9, 0xFD, 0x02, 0x04, 0x05, 0x03, 0xFF, 0xFA, 0xF7, 0xF4, 0xF3, 0xF2, 
-    0xF4, 0xF8, 0xFE, 0x03, 0x05, 0x04, 0x01, 0xFC, 0xFB, 0xFC, 0x00, 0x09, 
-    0x0F, 0x0F, 0x08, 0xFE, 0xF7, 0xF6, 0xF8, 0xFB, 0xFC, 0xFA, 0xF7, 0xF9, 
-    0xFB, 0xF9, 0xF7, 0xF3, 0xF1, 0xF2, 0xF3, 0xF5, 0xF6, 0xF8, 0xFA, 0xFF, 
-    0x02, 0x04, 0x04, 0x02, 0xFF, 0xFB, 0xF6, 0xF3, 0xF5, 0xFA, 0x00, 0x00, 
-    0xFA, 0xEF, 0xE3, 0xDA, 0xD7, 0xD8, 0xDD, 0xE3, 0xE5, 0xE8, 0xEC, 0xF0, 
-    0xF3, 0xF5, 0xF5, 0xF4, 0xF2, 0xF0, 0xEF, 0xF0, 0xF1, 0xF3, 0xF5, 0xF7, 
-    0xF7, 0xF6, 0xF5, 0xF3, 0xEE, 0xEA, 0xE9, 0xED, 0xF6, 0xFD, 0xFE, 0xF9, 
-    0xF1, 0xEB, 0xEC, 0xF2, 0xF8, 0xFB, 0xF8, 0xF5, 0xF6, 0xF6, 0xF5, 0xF3, 
-    0xEF, 0xEB, 0xE6, 0xE3, 0xE4, 0xE7, 0xE9, 0xE9, 0xE9, 0xEB, 0xEF, 0xF3, 
-    0xF4, 0xF3, 0xF1, 0xEF, 0xEF, 0xF1, 0xF8, 0xFD, 0xFD, 0xF7, 0xED, 0xE3, 
-    0xDF, 0xE2, 0xE7, 0xEB, 0xEB, 0xEB, 0xEE, 0xF3, 0xF5, 0xF6, 0xF6, 0xF5, 
-    0xF6, 0xF6, 0xF5, 0xF5, 0xF7, 0xFB, 0xFF, 0x05, 0x0A, 0x0D, 0x10, 0x12, 
-    0x11, 0x10, 0x0E, 0x0F, 0x13, 0x16, 0x16, 0x11, 0x08, 0xFF, 0xFA, 0xFC, 
-    0x00, 0x06, 0x09, 0x07, 0x05, 0x04, 0x04, 0x06, 0x09, 0x0A, 0x0B, 0x0A, 
-    0x09, 0x0A, 0x0D, 0x10, 0x10, 0x0E, 0x0D, 0x0B, 0x09, 0x08, 0x08, 0x04, 
-    0x02, 0x02, 0x08, 0x13, 0x1B, 0x1B, 0x15, 0x0C, 0x07, 0x07, 0x0C, 0x16, 
-    0x1D, 0x21, 0x20, 0x20, 0x1F, 0x20, 0x21, 0x21, 0x1F, 0x19, 0x15, 0x11, 
-    0x10, 0x10, 0x0F, 0x0F, 0x11, 0x16, 0x1C, 0x1F, 0x20, 0x1D, 0x1B, 0x1C, 
-    0x1E, 0x24, 0x27, 0x26, 0x21, 0x19, 0x11, 0x0D, 0x0E, 0x14, 0x19, 0x19, 
-    0x14, 0x0E, 0x09, 0x05, 0x01, 0xFD, 0xFB, 0xF9, 0xF8, 0xF7, 0xF8, 0xF8, 
-    0xF8, 0xF7, 0xF5, 0xF6, 0xF8, 0xFB, 0x01, 0x05, 0x07, 0x09, 0x0C, 0x11, 
-    0x17, 0x19, 0x16, 0x0C, 0x00, 0xF7, 0xF4, 0xF8, 0xFF, 0x05, 0x05, 0x03, 
-    0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF4, 0xF3, 0xF7, 0xFB, 0xFD, 
-    0xFD, 0xFD, 0xFC, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFF, 0x06, 0x09, 
-    0x08, 0x01, 0xF9, 0xF4, 0xF4, 0xF9, 0xFE, 0x02, 0x01, 0xFC, 0xF6, 0xF3, 
-    0xF5, 0xF9, 0xFC, 0xFB, 0xF9, 0xF8, 0xF9, 0xFB, 0xFD, 0xFE, 0xFD, 0xFD, 
-    0xFE, 0x00, 0x00, 0x01, 0x00, 0xFD, 0xFC, 0xFF, 0x05, 0x07, 0x04, 0xFA, 
-    0xED, 0xE1, 0xDB, 0xDC, 0xE5, 0xEE, 0xF3, 0xF1, 0xED, 0xEB, 0xEB, 0xEF, 
-    0xF2, 0xF6, 0xF6, 0xF3, 0xED, 0xE9, 0xE8, 0xE9, 0xEA, 0xEB, 0xED, 0xEF, 
-    0xF2, 0xF4, 0xF4, 0xF1, 0xEF, 0xEF, 0xF3, 0xF9, 0xFD, 0xFA, 0xF3, 0xE7, 
-    0xE0, 0xE0, 0xE5, 0xEE, 0xF3, 0xF2, 0xEA, 0xE2, 0xDE, 0xDE, 0xE0, 0xE4, 
-    0xE7, 0xEA, 0xEB, 0xED, 0xEE, 0xED, 0xEC, 0xEA, 0xE8, 0xE7, 0xEA, 0xEE, 
-    0xEF, 0xEB, 0xE6, 0xE6, 0xEB, 0xF3, 0xF7, 0xF6, 0xEE, 0xE2, 0xD8, 0xD4, 
-    0xD7, 0xDF, 0xE7, 0xEB, 0xE9, 0xE6, 0xE6, 0xE9, 0xEE, 0xF2, 0xF6, 0xF7, 
-    0xF8, 0xF9, 0xFB, 0xFE, 0x00, 0x02, 0x04, 0x08, 0x0C, 0x10, 0x13, 0x14, 
-    0x13, 0x13, 0x14, 0x17, 0x1A, 0x1A, 0x18, 0x13, 0x0C, 0x0A, 0x0D, 0x11, 
-    0x16, 0x18, 0x15, 0x0E, 0x06, 0x02, 0x03, 0x06, 0x0A, 0x0B, 0x0C, 0x0B, 
-    0x0C, 0x0B, 0x0A, 0x08, 0x07, 0x07, 0x06, 0x05, 0x07, 0x0B, 0x0D, 0x0F, 
-    0x12, 0x16, 0x1B, 0x1C, 0x19, 0x0F, 0x02, 0xFB, 0xFC, 0x05, 0x11, 0x19, 
-    0x19, 0x13, 0x11, 0x11, 0x13, 0x17, 0x1A, 0x1B, 0x1B, 0x19, 0x16, 0x14, 
-    0x15, 0x16, 0x16, 0x14, 0x11, 0x10, 0x11, 0x10, 0x0C, 0x09, 0x0A, 0x10, 
-    0x18, 0x1E, 0x1E, 0x19, 0x11, 0x0D, 0x0D, 0x12, 0x19, 0x1E, 0x1E, 0x17, 
-    0x0F, 0x08, 0x03, 0x03, 0x06, 0x0A, 0x0C, 0x0E, 0x0D, 0x09, 0x03, 0xFD, 
-    0xFB, 0xFD, 0x01, 0x04, 0x05, 0x05, 0x04, 0x03, 0x04, 0x07, 0x0E, 0x12, 
-    0x13, 0x0E, 0x04, 0xFB, 0xF7, 0xFA, 0x03, 0x0D, 0x15, 0x16, 0x12, 0x0A, 
-    0x04, 0x02, 0x04, 0x09, 0x0E, 0x0F, 0x0D, 0x0B, 0x0A, 0x09, 0x08, 0x09, 
-    0x0A, 0x0C, 0x0E, 0x0F, 0x0C, 0x08, 0x03, 0x00, 0xFE, 0x00, 0x02, 0x03, 
-    0x00, 0xF8, 0xF1, 0xF0, 0xF6, 0xFE, 0x05, 0x04, 0xFD, 0xF8, 0xF4, 0xF6, 
-    0xFA, 0xFF, 0x05, 0x08, 0x0A, 0x0B, 0x0A, 0x07, 0x03, 0xFE, 0xF9, 0xF9, 
-    0xFA, 0xFC, 0xFB, 0xF7, 0xF4, 0xF4, 0xF6, 0xFA, 0xFA, 0xF5, 0xED, 0xE4, 
-    0xDF, 0xE2, 0xE7, 0xEE, 0xF3, 0xF2, 0xEC, 0xE3, 0xDE, 0xDF, 0xE4, 0xE8, 
-    0xEB, 0xED, 0xED, 0xEC, 0xEB, 0xEC, 0xEE, 0xF4, 0xF9, 0xFC, 0xFE, 0xFD, 
-    0xFB, 0xF8, 0xF9, 0xFD, 0x00, 0x03, 0x03, 0x00, 0xFB, 0xF4, 0xEF, 0xEF, 
-    0xF4, 0xFB, 0x00, 0x01, 0xFC, 0xF1, 0xE5, 0xDD, 0xDF, 0xE6, 0xEE, 0xF4, 
-    0xF5, 0xF3, 0xEF, 0xEC, 0xEB, 0xEC, 0xED, 0xF0, 0xF2, 0xF4, 0xF3, 0xF0, 
-    0xEC, 0xEC, 0xED, 0xF1, 0xF5, 0xF5, 0xEF, 0xE5, 0xD8, 0xCF, 0xCF, 0xD8, 
-    0xE5, 0xF0, 0xF3, 0xED, 0xE5, 0xE2, 0xE2, 0xE6, 0xEC, 0xF1, 0xF4, 0xF6, 
-    0xF7, 0xF7, 0xF6, 0xF7, 0xF9, 0xFA, 0xFE, 0x04, 0x08, 0x07, 0x02, 0xFF, 
-    0x00, 0x03, 0x09, 0x0E, 0x12, 0x11, 0x0E, 0x0C, 0x0C, 0x0E, 0x10, 0x13, 
-    0x13, 0x0F, 0x09, 0x02, 0xFD, 0xFC, 0xFD, 0x00, 0x03, 0x06, 0x09, 0x07, 
-    0x03, 0xFD, 0xF9, 0xF6, 0xF7, 0xFB, 0x01, 0x06, 0x06, 0x07, 0x07, 0x07, 
-    0x07, 0x06, 0x04, 0x01, 0xFD, 0xFC, 0xFF, 0x04, 0x0C, 0x15, 0x1C, 0x1D, 
-    0x17, 0x10, 0x0E, 0x11, 0x17, 0x1D, 0x21, 0x23, 0x24, 0x25, 0x27, 0x26, 
-    0x24, 0x21, 0x1E, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x22, 0x22, 0x21, 0x20, 
-    0x1C, 0x18, 0x0F, 0x08, 0x05, 0x09, 0x0F, 0x16, 0x19, 0x16, 0x0C, 0x01, 
-    0xFB, 0xFA, 0xFE, 0x03, 0x06, 0x08, 0x09, 0x08, 0x04, 0xFE, 0xFA, 0xF8, 
-    0xF8, 0xFA, 0xFD, 0x01, 0x02, 0xFF, 0xFE, 0xFF, 0x03, 0x07, 0x07, 0x03, 
-    0xFB, 0xF4, 0xF1, 0xF3, 0xFB, 0x04, 0x0A, 0x0A, 0x03, 0xF8, 0xF1, 0xF0, 
-    0xF4, 0xFC, 0x06, 0x10, 0x17, 0x18, 0x16, 0x14, 0x14, 0x15, 0x14, 0x14, 
-    0x16, 0x18, 0x1A, 0x17, 0x13, 0x11, 0x0E, 0x0D, 0x0B, 0x07, 0x02, 0xFC, 
-    0xF9, 0xF9, 0xFB, 0xFE, 0x02, 0x04, 0x01, 0xFA, 0xF0, 0xEB, 0xEC, 0xF2, 
-    0xF7, 0xFC, 0xFE, 0xFE, 0xFC, 0xFA, 0xF7, 0xF4, 0xF2, 0xF2, 0xF5, 0xFA, 
-    0xFE, 0x00, 0x01, 0x02, 0x04, 0x03, 0x02, 0xFE, 0xFA, 0xF3, 0xED, 0xE8, 
-    0xE7, 0xEB, 0xF2, 0xF6, 0xF4, 0xEF, 0xE8, 0xE4, 0xE2, 0xE1, 0xE3, 0xE7, 
-    0xEC, 0xF0, 0xF2, 0xF2, 0xF2, 0xF0, 0xEC, 0xE8, 0xE6, 0xE8, 0xED, 0xF1, 
-    0xF4, 0xF7, 0xF8, 0xF9, 0xF9, 0xF7, 0xF4, 0xEF, 0xEC, 0xEB, 0xEE, 0xF3, 
-    0xF7, 0xF8, 0xF6, 0xEF, 0xE6, 0xE1, 0xE0, 0xE4, 0xEB, 0xF2, 0xF6, 0xF7, 
-    0xF5, 0xF1, 0xEE, 0xEC, 0xEA, 0xEC, 0xEE, 0xF0, 0xF3, 0xF6, 0xF7, 0xFB, 
-    0xFE, 0xFF, 0xFF, 0xF8, 0xEF, 0xE5, 0xDF, 0xDF, 0xE5, 0xEF, 0xF8, 0xFF, 
-    0xFF, 0xF9, 0xED, 0xE0, 0xD9, 0xDB, 0xE3, 0xED, 0xF4, 0xF9, 0xFB, 0xF8, 
-    0xF6, 0xF2, 0xF0, 0xF0, 0xF0, 0xF2, 0xF6, 0xFB, 0xFF, 0x01, 0x04, 0x07, 
-    0x0A, 0x0B, 0x08, 0x04, 0xFD, 0xF7, 0xF6, 0xFB, 0x05, 0x11, 0x19, 0x19, 
-    0x12, 0x08, 0x01, 0xFF, 0x03, 0x0A, 0x13, 0x18, 0x19, 0x15, 0x0F, 0x07, 
-    0xFF, 0xF9, 0xF7, 0xFA, 0xFF, 0x01, 0x01, 0xFD, 0xFC, 0xFB, 0xFB, 0xFA, 
-    0xF9, 0xF8, 0xF5, 0xF3, 0xF4, 0xF9, 0x00, 0x08, 0x0B, 0x0B, 0x06, 0xFE, 
-    0xF9, 0xF8, 0xFB, 0x00, 0x0B, 0x16, 0x1F, 0x24, 0x26, 0x24, 0x21, 0x1C, 
-    0x1A, 0x1D, 0x21, 0x27, 0x2E, 0x32, 0x38, 0x3B, 0x3A, 0x37, 0x33, 0x2F, 
-    0x2A, 0x26, 0x25, 0x27, 0x29, 0x2A, 0x29, 0x26, 0x20, 0x15, 0x0A, 0x01, 
-    0xFE, 0x01, 0x06, 0x0A, 0x0B, 0x08, 0x05, 0x03, 0x00, 0xFD, 0xF8, 0xF6, 
-    0xF7, 0xFB, 0x00, 0x04, 0x09, 0x0D, 0x0E, 0x0B, 0x03, 0xF9, 0xEE, 0xE2, 
-    0xE0, 0xE4, 0xEE, 0xF9, 0x01, 0x01, 0xFC, 0xF3, 0xE7, 0xE1, 0xE3, 0xED, 
-    0xFA, 0x05, 0x0D, 0x0F, 0x0F, 0x0F, 0x0E, 0x0D, 0x08, 0x08, 0x06, 0x05, 
-    0x05, 0x04, 0x04, 0x08, 0x0D, 0x16, 0x1F, 0x20, 0x1D, 0x11, 0x13, 0x02, 
-    0xF5, 0xFD, 0xEA, 0xE8, 0xE9, 0xE3, 0xEC, 0xED, 0xE8, 0xEC, 0xFB, 0xF5, 
-    0xF6, 0xFE, 0x03, 0x02, 0xE9, 0xEB, 0xE6, 0xE9, 0x01, 0x0B, 0x2B, 0x30, 
-    0x1E, 0x1D, 0x21, 0x25, 0x1B, 0x15, 0x05, 0xF6, 0xF3, 0xF4, 0xF9, 0x02, 
-    0x08, 0x06, 0x07, 0xF7, 0xE9, 0xDD, 0xD2, 0xCD, 0xD5, 0xE2, 0xD6, 0xD2, 
-    0xC5, 0xC6, 0xD3, 0xD6, 0xE1, 0xE5, 0xE4, 0xED, 0xF0, 0xFB, 0xFF, 0xFA, 
-    0xFF, 0xFE, 0xFC, 0xFF, 0x01, 0xFA, 0xFB, 0xFC, 0xFE, 0x07, 0x07, 0x08, 
-    0x0D, 0x0A, 0x05, 0xF0, 0xF0, 0xF1, 0xF0, 0xFB, 0xFF, 0x06, 0x01, 0x07, 
-    0x0A, 0x04, 0xF7, 0xED, 0xF2, 0xEE, 0xEC, 0xEB, 0xDF, 0xDF, 0xDF, 0xDE, 
-    0xDB, 0xDA, 0xD4, 0xD0, 0xCE, 0xCC, 0xD6, 0xDA, 0xE4, 0xE7, 0xE5, 0xDC, 
-    0xD6, 0xD0, 0xCA, 0xCA, 0xD5, 0xD4, 0xDD, 0xEB, 0xF0, 0xFE, 0xFA, 0xF3, 
-    0xEF, 0xEC, 0xEB, 0xEF, 0xED, 0xEF, 0xF2, 0xF8, 0xFF, 0x07, 0x09, 0x03, 
-    0xFE, 0xFB, 0xFF, 0x02, 0x10, 0x16, 0x25, 0x2E, 0x2B, 0x29, 0x20, 0x1A, 
-    0x0D, 0x06, 0x09, 0x0A, 0x11, 0x19, 0x26, 0x26, 0x1B, 0x1A, 0x14, 0x12, 
-    0x08, 0x09, 0x08, 0x0A, 0x11, 0x15, 0x19, 0x16, 0x1E, 0x1E, 0x10, 0x0B, 
-    0xFF, 0xFA, 0xFB, 0x00, 0x13, 0x14, 0x19, 0x15, 0x09, 0xFA, 0xF5, 0xEE, 
-    0xE7, 0xEE, 0xEE, 0x00, 0x05, 0x0C, 0x0F, 0x07, 0x09, 0x03, 0x01, 0x06, 
-    0x04, 0x0B, 0x0F, 0x19, 0x19, 0x17, 0x14, 0x14, 0x20, 0x1F, 0x1C, 0x0C, 
-    0x05, 0x12, 0x29, 0x30, 0x2F, 0x30, 0x29, 0x1E, 0x12, 0x03, 0xFB, 0xF8, 
-    0x06, 0x14, 0x1E, 0x1A, 0x11, 0x17, 0x10, 0x06, 0xFF, 0x07, 0x09, 0x13, 
-    0x16, 0x15, 0x15, 0x14, 0x1A, 0x17, 0x14, 0x06, 0x03, 0xFA, 0x01, 0x08, 
-    0x0B, 0x16, 0x13, 0x1F, 0x14, 0x00, 0xF0, 0xF5, 0xF4, 0xEA, 0xE7, 0xEE, 
-    0x03, 0x0B, 0x0D, 0x10, 0x0B, 0xE7, 0xED, 0xF5, 0xEB, 0xF6, 0xF7, 0x0B, 
-    0x16, 0x0C, 0x14, 0x0D, 0x08, 0x05, 0xF9, 0xF9, 0x02, 0x00, 0x0A, 0x14, 
-    0x14, 0x18, 0x0E, 0x11, 0x0B, 0x03, 0xF5, 0xF1, 0xF0, 0xF7, 0x03, 0x0B, 
-    0x09, 0xFD, 0xFD, 0xF3, 0xED, 0xE7, 0xDE, 0xE3, 0xF0, 0xF2, 0xFB, 0xFE, 
-    0xF7, 0xF4, 0xE5, 0xE2, 0xE1, 0xE0, 0xDA, 0xDC, 0xED, 0x03, 0x0B, 0x0E, 
-    0x0F, 0xFE, 0xF9, 0xE6, 0xE6, 0xE6, 0xF4, 0x01, 0xFC, 0x01, 0x08, 0x0B, 
-    0x0A, 0x0C, 0x07, 0xF9, 0xEF, 0xFA, 0xF5, 0xFC, 0x0A, 0x10, 0x0A, 0x10, 
-    0x14, 0x04, 0xF0, 0xEE, 0xF0, 0xEF, 0xF3, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 
-    0xEA, 0xE3, 0xE1, 0xD7, 0xDC, 0xE5, 0xE9, 0xE7, 0xFA, 0x02, 0xF1, 0xE6, 
-    0xDC, 0xE1, 0xE9, 0xED, 0xED, 0xF0, 0xEB, 0xEE, 0xEF, 0xF0, 0xED, 0xE3, 
-    0xDD, 0xD0, 0xCC, 0xCD, 0xD5, 0xE2, 0xE9, 0xF0, 0xF6, 0xE9, 0xDA, 0xD8, 
-    0xD2, 0xCA, 0xCA, 0xD8, 0xEB, 0xF3, 0xF9, 0xF6, 0xF1, 0x03, 0xF8, 0xEB, 
-    0xE4, 0xE2, 0xF0, 0xEE, 0xFF, 0x07, 0x00, 0xF8, 0xF9, 0xFA, 0xF2, 0xFB, 
-    0x08, 0x02, 0x00, 0x0F, 0x17, 0x18, 0x1A, 0x1B, 0x1A, 0x0F, 0xFF, 0xFD, 
-    0xF5, 0xF0, 0x01, 0x08, 0x12, 0x23, 0x16, 0x0A, 0x06, 0x00, 0xF5, 0xFD, 
-    0x08, 0x10, 0x1C, 0x20, 0x2A, 0x22, 0x15, 0x0F, 0x13, 0x09, 0x05, 0xFF, 
-    0x08, 0x13, 0x16, 0x19, 0x13, 0x1B, 0x13, 0x13, 0x09, 0xF7, 0xF1, 0xE9, 
-    0xEF, 0xFA, 0xF7, 0x00, 0x0D, 0x08, 0x0D, 0x08, 0x00, 0x00, 0xFE, 0x0A, 
-    0x0E, 0x1C, 0x1E, 0x23, 0x20, 0x12, 0x0F, 0x00, 0x0A, 0x0F, 0x1A, 0x21, 
-    0x2A, 0x29, 0x1F, 0x1E, 0x20, 0x16, 0x13, 0x1E, 0x0D, 0x13, 0x0D, 0x06, 
-    0x13, 0x18, 0x17, 0x16, 0x1C, 0x15, 0x01, 0xF8, 0xF3, 0x01, 0x0E, 0x0F, 
-    0x18, 0x15, 0x0C, 0x04, 0xFD, 0xF0, 0xF0, 0xF8, 0x00, 0x08, 0x08, 0x18, 
-    0x21, 0x1C, 0x1B, 0x0D, 0x0A, 0x04, 0xFA, 0xFD, 0xFE, 0x01, 0x11, 0x10, 
-    0x0F, 0x17, 0x10, 0x07, 0x04, 0x08, 0xFC, 0x01, 0x07, 0xFC, 0x02, 0x13, 
-    0x13, 0x13, 0x04, 0xF3, 0xF8, 0xF4, 0xFA, 0xFF, 0xFE, 0x0C, 0x19, 0x1C, 
-    0x0C, 0x03, 0xFA, 0xF0, 0xF2, 0xEB, 0xE9, 0xE8, 0xF6, 0xFB, 0x02, 0x02, 
-    0xFA, 0xF7, 0xEF, 0xF0, 0xEF, 0xF5, 0xF9, 0x01, 0x09, 0x07, 0x05, 0xFF, 
-    0xF8, 0xF1, 0xE4, 0xE6, 0xE6, 0xE9, 0xF1, 0xF7, 0xFE, 0x00, 0x02, 0x04, 
-    0x03, 0xF5, 0xE5, 0xE2, 0xE4, 0xE7, 0xF5, 0x04, 0x0F, 0x0A, 0x09, 0x05, 
-    0xF6, 0xF4, 0xF4, 0xF4, 0xFA, 0x01, 0x08, 0x09, 0x04, 0x03, 0xFB, 0xEB, 
-    0xE2, 0xE9, 0xEE, 0xF3, 0xF6, 0xF6, 0xFA, 0x05, 0x06, 0xFB, 0xEC, 0xE8, 
-    0xE0, 0xD4, 0xD2, 0xD7, 0xE0, 0xE7, 0xF3, 0xF7, 0xF3, 0xEB, 0xEA, 0xDD, 
-    0xD5, 0xCE, 0xD1, 0xE0, 0xE3, 0xF2, 0xF4, 0xF1, 0xE5, 0xDA, 0xDF, 0xDA, 
-    0xD8, 0xDE, 0xE5, 0xF1, 0xF8, 0xFD, 0xFE, 0xF9, 0xEB, 0xED, 0xE0, 0xD5, 
-    0xE0, 0xDE, 0xE5, 0xED, 0xF9, 0xFC, 0xF9, 0xFF, 0xFA, 0xF1, 0xEE, 0xF2, 
-    0xF1, 0xF8, 0x02, 0x09, 0x0B, 0x07, 0x10, 0x09, 0xFD, 0xF8, 0xF7, 0xFA, 
-    0x02, 0x0B, 0x0D, 0x0A, 0x0F, 0x11, 0x0C, 0x05, 0xF3, 0xEF, 0xE9, 0xEF, 
-    0xFE, 0x07, 0x07, 0x03, 0x06, 0xFF, 0xF6, 0xF1, 0xE2, 0xE4, 0xEC, 0xFA, 
-    0xF7, 0xFB, 0x07, 0xFB, 0xF3, 0xF0, 0xF4, 0xEA, 0xF1, 0xF0, 0xF4, 0xFE, 
-    0xFE, 0x0C, 0x15, 0x1D, 0x18, 0x14, 0x08, 0xF7, 0xFE, 0x00, 0x07, 0x08, 
-    0x17, 0x24, 0x1E, 0x22, 0x18, 0x17, 0x11, 0x06, 0x0F, 0x10, 0x19, 0x2A, 
-    0x25, 0x2A, 0x24, 0x16, 0x13, 0x16, 0x17, 0x19, 0x22, 0x25, 0x29, 0x2B, 
-    0x2E, 0x2C, 0x26, 0x1C, 0x19, 0x0F, 0x0E, 0x07, 0x00, 0x0E, 0x10, 0x14, 
-    0x1C, 0x26, 0x20, 0x17, 0x09, 0x05, 0x05, 0x04, 0x11, 0x19, 0x20, 0x1B, 
-    0x17, 0x0D, 0x07, 0x02, 0x02, 0x03, 0x00, 0x04, 0x09, 0x13, 0x17, 0x14, 
-    0x14, 0x0C, 0x01, 0xFA, 0xF5, 0xFC, 0xFA, 0x05, 0x09, 0x0B, 0x12, 0x12, 
-    0x10, 0x0D, 0x0C, 0xFC, 0xFE, 0xFC, 0xFE, 0xFF, 0xFE, 0x02, 0x04, 0x03, 
-    0x00, 0xFA, 0xEE, 0xF1, 0xF1, 0xFD, 0x02, 0x07, 0x13, 0x12, 0x0C, 0xFE, 
-    0xFC, 0xF8, 0xF2, 0xEE, 0xE9, 0xEF, 0xF8, 0x00, 0x07, 0x09, 0x00, 0xF6, 
-    0xF2, 0xEB, 0xE5, 0xE8, 0xEA, 0xF2, 0xFA, 0xFB, 0xFF, 0xF7, 0xF4, 0xF4, 
-    0xF5, 0xFA, 0xF6, 0xF1, 0xF7, 0xFC, 0x0C, 0x13, 0x0E, 0x08, 0x02, 0xFF, 
-    0xF2, 0xEA, 0xE5, 0xED, 0xF5, 0xFC, 0x04, 0x0F, 0x10, 0x0C, 0x07, 0x00, 
-    0xFF, 0xFC, 0xFF, 0x08, 0x0C, 0x0C, 0x0C, 0x09, 0x06, 0xFC, 0xFE, 0xFD, 
-    0xF5, 0xF5, 0xF4, 0xFD, 0x04, 0x06, 0x03, 0xFA, 0xF2, 0xF5, 0xEC, 0xE4, 
-    0xE0, 0xD5, 0xDA, 0xDF, 0xE5, 0xE8, 0xEB, 0xE6, 0xDA, 0xD6, 0xCC, 0xC8, 
-    0xCB, 0xCB, 0xCF, 0xD8, 0xDB, 0xDA, 0xD2, 0xCE, 0xCF, 0xD1, 0xD2, 0xDE, 
-    0xE3, 0xE1, 0xF2, 0xFC, 0xFB, 0xFB, 0xFB, 0xF3, 0xEA, 0xE5, 0xE9, 0xE5, 
-    0xE6, 0xEB, 0xF7, 0x02, 0xFE, 0xFE, 0xF9, 0xF8, 0xF5, 0xF0, 0xEE, 0xEA, 
-    0xED, 0xF9, 0xFD, 0x01, 0xFA, 0xF3, 0xF3, 0xF6, 0xF3, 0xF2, 0xF5, 0xFB, 
-    0x04, 0x13, 0x15, 0x07, 0x05, 0xFC, 0xF8, 0xF4, 0xEF, 0xE9, 0xE9, 0xEA, 
-    0xF0, 0xF7, 0xF4, 0xF9, 0xF5, 0xF0, 0xF2, 0xED, 0xED, 0xEF, 0xF4, 0xFF, 
-    0xFB, 0xFB, 0xFB, 0xF7, 0xF8, 0xF6, 0xEF, 0xF0, 0xEF, 0xF2, 0xFF, 0x03, 
-    0x0F, 0x1B, 0x14, 0x09, 0x02, 0xFD, 0xF9, 0xFA, 0xFE, 0x04, 0x0D, 0x0F, 
-    0x15, 0x13, 0x12, 0x14, 0x11, 0x10, 0x0F, 0x13, 0x1A, 0x1B, 0x17, 0x15, 
-    0x1A, 0x1B, 0x19, 0x15, 0x19, 0x1A, 0x1B, 0x1D, 0x1A, 0x20, 0x29, 0x2F, 
-    0x32, 0x2D, 0x27, 0x1C, 0x10, 0x10, 0x10, 0x16, 0x17, 0x1B, 0x20, 0x1F, 
-    0x1E, 0x17, 0x14, 0x10, 0x0E, 0x0F, 0x14, 0x15, 0x16, 0x15, 0x0F, 0x08, 
-    0xFE, 0xFC, 0x08, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0E, 0x17, 0x18, 0x17, 
-    0x0D, 0x03, 0x04, 0xFC, 0xF5, 0xF1, 0xF7, 0xFC, 0x02, 0x04, 0x04, 0x03, 
-    0x00, 0x03, 0xFB, 0xFC, 0x05, 0x07, 0x0B, 0x0B, 0x06, 0x04, 0x05, 0x05, 
-    0x00, 0xFF, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x04, 0x04, 0xFB, 0xFB, 0xFC, 
-    0xFD, 0xFD, 0xF8, 0xF8, 0xF6, 0xFA, 0xF9, 0xF7, 0xEF, 0xE9, 0xEB, 0xED, 
-    0xE9, 0xE8, 0xE9, 0xEA, 0xF1, 0xF4, 0xF9, 0xF5, 0xEF, 0xE9, 0xE8, 0xE7, 
-    0xEA, 0xF1, 0xEE, 0xF3, 0xF9, 0x04, 0x0B, 0x0C, 0x05, 0x00, 0xFD, 0xF9, 
-    0xFE, 0xFF, 0x05, 0x0A, 0x0E, 0x0A, 0x02, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 
-    0xFE, 0xFF, 0xFD, 0x01, 0x00, 0x00, 0x02, 0xFE, 0x01, 0x07, 0x04, 0xFC, 
-    0xF9, 0xF7, 0xFB, 0x04, 0x08, 0x09, 0x03, 0xFD, 0xF6, 0xF1, 0xEC, 0xEA, 
-    0xE7, 0xEA, 0xF3, 0xF1, 0xEA, 0xE2, 0xDC, 0xD8, 0xD7, 0xDB, 0xDB, 0xDF, 
-    0xE6, 0xE6, 0xE7, 0xDF, 0xDC, 0xDC, 0xDB, 0xE1, 0xE6, 0xE6, 0xE2, 0xDE, 
-    0xE0, 0xE5, 0xE9, 0xEB, 0xEA, 0xEE, 0xEE, 0xEC, 0xE4, 0xD9, 0xDB, 0xE4, 
-    0xF0, 0xFA, 0xFC, 0xF8, 0xED, 0xEA, 0xE5, 0xE2, 0xE5, 0xEA, 0xF0, 0xF2, 
-    0xF5, 0xF4, 0xF0, 0xF1, 0xF3, 0xEF, 0xF2, 0xF9, 0xFC, 0x02, 0x03, 0x03, 
-    0xFF, 0x00, 0x06, 0x06, 0x08, 0x05, 0x02, 0xFD, 0xFC, 0xFC, 0xF7, 0xFB, 
-    0xFE, 0x01, 0x01, 0xFE, 0xF3, 0xEE, 0xE9, 0xEC, 0xF3, 0xFC, 0x05, 0x07, 
-    0x06, 0x07, 0xFF, 0xF7, 0xFA, 0xFE, 0x01, 0x01, 0x07, 0x09, 0x0F, 0x10, 
-    0x12, 0x10, 0x0A, 0x08, 0x08, 0x0B, 0x0A, 0x0A, 0x0D, 0x0E, 0x10, 0x16, 
-    0x19, 0x17, 0x16, 0x1C, 0x1D, 0x19, 0x18, 0x1C, 0x1F, 0x27, 0x29, 0x29, 
-    0x29, 0x26, 0x25, 0x21, 0x1C, 0x19, 0x16, 0x19, 0x24, 0x26, 0x24, 0x1D, 
-    0x16, 0x0F, 0x0A, 0x0E, 0x0F, 0x0E, 0x10, 0x11, 0x14, 0x10, 0x0A, 0x02, 
-    0xFA, 0xFC, 0xFF, 0xFE, 0x02, 0x07, 0x05, 0x06, 0x06, 0x05, 0x04, 0x03, 
-    0x00, 0x03, 0x03, 0x00, 0xFC, 0xFD, 0x05, 0x0F, 0x15, 0x17, 0x1A, 0x14, 
-    0x09, 0x05, 0xFB, 0xF7, 0x02, 0x0B, 0x15, 0x18, 0x13, 0x0A, 0x01, 0x00, 
-    0xFD, 0xFE, 0x01, 0x03, 0x09, 0x0B, 0x0C, 0x09, 0x0A, 0x07, 0x08, 0x0B, 
-    0x0C, 0x0D, 0x0A, 0x0A, 0x04, 0x05, 0x08, 0x09, 0x0E, 0x0C, 0x0B, 0x04, 
-    0xFC, 0xF7, 0xF4, 0xF7, 0xFA, 0xFC, 0xFE, 0xFA, 0xF3, 0xEE, 0xE7, 0xE1, 
-    0xE4, 0xEB, 0xEF, 0xF8, 0x03, 0x01, 0x00, 0xF8, 0xF2, 0xEF, 0xF0, 0xF5, 
-    0xF8, 0xF8, 0xF8, 0xFB, 0xF9, 0xFE, 0xFC, 0x00, 0xFF, 0xFB, 0xFF, 0xFC, 
-    0xFA, 0xFC, 0x01, 0x02, 0x06, 0x06, 0x00, 0xFC, 0xFE, 0xFC, 0xF5, 0xF3, 
-    0xEF, 0xF3, 0xFB, 0x01, 0x00, 0xFE, 0xFF, 0xFA, 0xF5, 0xF3, 0xF3, 0xF2, 
-    0xF9, 0xFF, 0x01, 0x02, 0x01, 0xFD, 0xFD, 0xF9, 0xF5, 0xF4, 0xF6, 0xF9, 
-    0xF8, 0xF4, 0xF1, 0xEA, 0xE5, 0xE3, 0xDF, 0xE0, 0xDE, 0xE0, 0xE2, 0xE2, 
-    0xE4, 0xE6, 0xE7, 0xEB, 0xE8, 0xE9, 0xE8, 0xE4, 0xE2, 0xE4, 0xE8, 0xE7, 
-    0xEE, 0xF4, 0xFC, 0x00, 0xFC, 0xF4, 0xEC, 0xE5, 0xE4, 0xE9, 0xEB, 0xF0, 
-    0xF1, 0xEF, 0xEE, 0xEB, 0xE8, 0xE6, 0xE8, 0xEB, 0xEE, 0xF2, 0xF3, 0xF6, 
-    0xF5, 0xF5, 0xF7, 0xFA, 0xFC, 0xFD, 0xFC, 0xFB, 0xF6, 0xF4, 0xF8, 0xFC, 
-    0x03, 0x04, 0x05, 0x06, 0x04, 0x00, 0xFD, 0xFE, 0xFF, 0x01, 0x05, 0x05, 
-    0x03, 0xFE, 0xF6, 0xF6, 0xF7, 0xF1, 0xF3, 0xF8, 0xFF, 0x05, 0x06, 0x02, 
-    0xFE, 0xFC, 0xFB, 0x00, 0x07, 0x0A, 0x0E, 0x0C, 0x0B, 0x0E, 0x11, 0x18, 
-    0x1C, 0x1B, 0x16, 0x12, 0x0F, 0x0D, 0x0C, 0x10, 0x13, 0x18, 0x1A, 0x1A, 
-    0x1C, 0x16, 0x14, 0x11, 0x0D, 0x0E, 0x11, 0x1A, 0x20, 0x1F, 0x1A, 0x18, 
-    0x19, 0x1A, 0x19, 0x19, 0x1A, 0x1A, 0x1D, 0x1C, 0x1D, 0x20, 0x20, 0x20, 
-    0x1E, 0x19, 0x15, 0x16, 0x13, 0x15, 0x0F, 0x0A, 0x07, 0x04, 0x08, 0x07, 
-    0x05, 0x04, 0x01, 0x01, 0x04, 0x0D, 0x12, 0x11, 0x0F, 0x0A, 0x09, 0x0B, 
-    0x0C, 0x0D, 0x0E, 0x0D, 0x0B, 0x0D, 0x12, 0x17, 0x19, 0x12, 0x0C, 0x09, 
-    0x09, 0x0B, 0x09, 0x0A, 0x0F, 0x12, 0x0D, 0x07, 0x05, 0x04, 0x06, 0x09, 
-    0x06, 0x03, 0x02, 0x00, 0x01, 0xFF, 0xFD, 0xFC, 0xFF, 0x03, 0x02, 0x00, 
-    0xF9, 0xF4, 0xF5, 0xFC, 0x04, 0x08, 0x0A, 0x0A, 0x05, 0x01, 0xFD, 0xFB, 
-    0xFD, 0xFE, 0x07, 0x07, 0x06, 0xFE, 0xF3, 0xED, 0xED, 0xEF, 0xEF, 0xF3, 
-    0xF7, 0xFA, 0xFA, 0xF6, 0xF1, 0xEA, 0xEA, 0xF1, 0xF7, 0xFC, 0xFF, 0xFC, 
-    0xF8, 0xF6, 0xF8, 0x02, 0x09, 0x0D, 0x0E, 0x0B, 0x04, 0xFF, 0xFC, 0xFC, 
-    0xFE, 0x01, 0x03, 0x01, 0x01, 0xFD, 0xF8, 0xF5, 0xF5, 0xF6, 0xFB, 0x00, 
-    0x04, 0x03, 0x03, 0xFE, 0xFB, 0xFB, 0xFB, 0xF9, 0xF9, 0xF9, 0xF6, 0xF6, 
-    0xF6, 0xF7, 0xF9, 0xF7, 0xF9, 0xF6, 0xF6, 0xF7, 0xF6, 0xF1, 0xEB, 0xE7, 
-    0xE7, 0xEA, 0xEA, 0xE9, 0xE3, 0xE1, 0xDD, 0xDC, 0xDE, 0xDE, 0xE0, 0xE3, 
-    0xE4, 0xE1, 0xDC, 0xD9, 0xDA, 0xDB, 0xDE, 0xDD, 0xE1, 0xE4, 0xE9, 0xEF, 
-    0xF0, 0xEF, 0xEF, 0xEF, 0xEE, 0xEE, 0xEE, 0xEF, 0xF2, 0xF1, 0xED, 0xEA, 
-    0xE7, 0xE9, 0xEA, 0xEA, 0xEC, 0xEE, 0xEC, 0xEE, 0xF0, 0xF1, 0xF6, 0xFB, 
-    0xFE, 0x03, 0x07, 0x06, 0x03, 0xFE, 0xFB, 0xFE, 0x02, 0x0B, 0x12, 0x14, 
-    0x15, 0x10, 0x09, 0x04, 0xFF, 0xFD, 0xFE, 0xFE, 0xFE, 0xFA, 0xF4, 0xEE, 
-    0xEB, 0xE9, 0xE9, 0xED, 0xF0, 0xF9, 0xFE, 0x00, 0xFC, 0xF6, 0xF2, 0xF4, 
-    0xF9, 0x01, 0x06, 0x07, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0x14, 0x1B, 0x1C, 
-    0x17, 0x12, 0x0E, 0x0D, 0x0E, 0x0F, 0x12, 0x15, 0x17, 0x19, 0x16, 0x0E, 
-    0x08, 0x06, 0x0A, 0x10, 0x17, 0x1B, 0x19, 0x16, 0x10, 0x0D, 0x0F, 0x12, 
-    0x17, 0x1A, 0x17, 0x15, 0x15, 0x15, 0x17, 0x1D, 0x22, 0x24, 0x24, 0x21, 
-    0x1B, 0x16, 0x0E, 0x0A, 0x0A, 0x0A, 0x0D, 0x0F, 0x0E, 0x0B, 0x06, 0x02, 
-    0x02, 0x05, 0x0D, 0x13, 0x18, 0x17, 0x11, 0x0B, 0x06, 0x07, 0x0B, 0x0F, 
-    0x10, 0x10, 0x0F, 0x11, 0x10, 0x0F, 0x11, 0x0F, 0x0F, 0x0E, 0x10, 0x10, 
-    0x10, 0x0F, 0x0C, 0x08, 0x05, 0x07, 0x08, 0x09, 0x09, 0x07, 0x02, 0xFD, 
-    0xFE, 0x02, 0x05, 0x06, 0x04, 0x02, 0x04, 0x03, 0x01, 0xFB, 0xF8, 0xF7, 
-    0xFA, 0xFE, 0x01, 0x05, 0x06, 0x05, 0x02, 0x00, 0x00, 0x03, 0x03, 0x01, 
-    0xFE, 0xFB, 0xF7, 0xF3, 0xEF, 0xEE, 0xEC, 0xEB, 0xED, 0xF0, 0xF3, 0xF4, 
-    0xF1, 0xEE, 0xEC, 0xEA, 0xEB, 0xEE, 0xF4, 0xF7, 0xF7, 0xF3, 0xEE, 0xEF, 
-    0xF4, 0xFD, 0x07, 0x0B, 0x09, 0x03, 0xFE, 0xFF, 0x01, 0x00, 0x01, 0x06, 
-    0x0A, 0x0B, 0x07, 0xFF, 0xF8, 0xF6, 0xFA, 0x00, 0x05, 0x0A, 0x0B, 0x07, 
-    0x04, 0xFF, 0xFD, 0xFE, 0x02, 0x09, 0x0B, 0x06, 0xFA, 0xF2, 0xF2, 0xF9, 
-    0x00, 0x02, 0x03, 0x01, 0xFE, 0xF9, 0xF1, 0xE7, 0xE1, 0xE1, 0xE1, 0xE2, 
-    0xE5, 0xE3, 0xE0, 0xDB, 0xD8, 0xD5, 0xD6, 0xDD, 0xE4, 0xE9, 0xE8, 0xE1, 
-    0xD9, 0xD9, 0xDC, 0xE4, 0xE8, 0xE7, 0xE7, 0xE8, 0xEB, 0xEB, 0xEC, 0xEE, 
-    0xF1, 0xF5, 0xF6, 0xF7, 0xF8, 0xF5, 0xF3, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 
-    0xEF, 0xED, 0xE9, 0xE4, 0xE3, 0xE4, 0xE7, 0xEB, 0xEE, 0xF0, 0xF4, 0xF6, 
-    0xF5, 0xF4, 0xF3, 0xF4, 0xF5, 0xF6, 0xFB, 0x02, 0x06, 0x05, 0x04, 0x03, 
-    0x00, 0xFD, 0xFE, 0xFD, 0xFC, 0xFB, 0xF7, 0xF6, 0xF6, 0xF5, 0xF3, 0xF2, 
-    0xF4, 0xF8, 0xFC, 0xFF, 0x01, 0xFF, 0x00, 0x01, 0x02, 0x03, 0x06, 0x0A, 
-    0x0A, 0x09, 0x05, 0x01, 0xFF, 0x02, 0x09, 0x13, 0x17, 0x18, 0x16, 0x15, 
-    0x14, 0x14, 0x16, 0x19, 0x1E, 0x20, 0x1E, 0x19, 0x11, 0x0C, 0x0C, 0x0D, 
-    0x10, 0x12, 0x15, 0x16, 0x15, 0x13, 0x12, 0x14, 0x15, 0x18, 0x1C, 0x1F, 
-    0x1C, 0x15, 0x11, 0x12, 0x18, 0x1E, 0x20, 0x22, 0x1F, 0x1D, 0x1B, 0x15, 
-    0x10, 0x0C, 0x0C, 0x12, 0x12, 0x11, 0x0C, 0x06, 0x03, 0x02, 0x05, 0x09, 
-    0x0E, 0x12, 0x13, 0x10, 0x0C, 0x09, 0x05, 0x07, 0x09, 0x0C, 0x0C, 0x0A, 
-    0x08, 0x04, 0x02, 0x01, 0x03, 0x07, 0x0A, 0x0C, 0x0D, 0x0A, 0x08, 0x07, 
-    0x06, 0x0A, 0x0C, 0x0F, 0x0C, 0x08, 0x04, 0x01, 0x01, 0x00, 0x01, 0x03, 
-    0x05, 0x02, 0xFF, 0xFC, 0xF8, 0xF2, 0xF4, 0xF9, 0xFE, 0x05, 0x09, 0x0A, 
-    0x10, 0x13, 0x11, 0x0F, 0x08, 0x03, 0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 
-    0xFD, 0xF9, 0xF2, 0xEF, 0xED, 0xEB, 0xEC, 0xEA, 0xE9, 0xEB, 0xEE, 0xF0, 
-    0xF4, 0xF1, 0xF1, 0xF2, 0xF6, 0xFB, 0xF9, 0xFE, 0xF6, 0xF8, 0xFC, 0xFE, 
-    0x04, 0x02, 0x01, 0x01, 0x00, 0x05, 0x08, 0x0A, 0x0F, 0x10, 0x13, 0x12, 
-    0x0A, 0x02, 0xFC, 0xF8, 0xF9, 0xFC, 0xFB, 0xFE, 0xFA, 0xFB, 0xFD, 0xF7, 
-    0xF4, 0xF2, 0xF8, 0xF9, 0xF8, 0xF6, 0xF2, 0xF2, 0xF1, 0xF2, 0xF3, 0xF9, 
-    0xF9, 0xF5, 0xF5, 0xEB, 0xE8, 0xE8, 0xE7, 0xEE, 0xEE, 0xEF, 0xEB, 0xE8, 
-    0xE5, 0xE3, 0xE1, 0xE0, 0xE3, 0xE4, 0xE6, 0xE7, 0xE8, 0xE6, 0xE6, 0xE6, 
-    0xE8, 0xE9, 0xED, 0xEA, 0xEC, 0xE8, 0xE2, 0xE4, 0xE6, 0xEC, 0xEF, 0xF1, 
-    0xEE, 0xEA, 0xE7, 0xEB, 0xED, 0xF0, 0xF4, 0xF3, 0xF4, 0xF1, 0xEA, 0xE6, 
-    0xE6, 0xE6, 0xE8, 0xEB, 0xF0, 0xF3, 0xF5, 0xF6, 0xF8, 0xF9, 0xF7, 0xF6, 
-    0xFA, 0xFB, 0xFE, 0xFE, 0xFE, 0xFD, 0x00, 0x06, 0x06, 0x09, 0x04, 0x02, 
-    0x00, 0xFF, 0xFE, 0xFF, 0x01, 0x01, 0x03, 0x02, 0xFE, 0xFD, 0xFB, 0xFB, 
-    0xF9, 0xF3, 0xF5, 0xF5, 0xFA, 0xFC, 0xFB, 0xF7, 0xF5, 0xF5, 0xF8, 0xFD, 
-    0xFA, 0xFB, 0xF8, 0xF9, 0xFE, 0x05, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0F, 
-    0x16, 0x1C, 0x23, 0x25, 0x26, 0x21, 0x1E, 0x1B, 0x18, 0x18, 0x14, 0x14, 
-    0x14, 0x13, 0x17, 0x19, 0x17, 0x17, 0x17, 0x17, 0x1A, 0x18, 0x17, 0x15, 
-    0x12, 0x13, 0x17, 0x1A, 0x1F, 0x21, 0x1A, 0x13, 0x0A, 0x07, 0x05, 0x05, 
-    0x09, 0x0D, 0x0E, 0x0D, 0x09, 0x07, 0x08, 0x06, 0x07, 0x06, 0x09, 0x0D, 
-    0x11, 0x13, 0x12, 0x10, 0x0D, 0x0B, 0x0F, 0x11, 0x12, 0x10, 0x09, 0x01, 
-    0x00, 0x07, 0x0D, 0x15, 0x12, 0x0F, 0x0B, 0x09, 0x09, 0x0D, 0x11, 0x14, 
-    0x1A, 0x18, 0x16, 0x0E, 0x08, 0x01, 0xFD, 0xFA, 0xF7, 0xF8, 0xFB, 0x00, 
-    0x00, 0xFA, 0xF3, 0xF2, 0xF3, 0xF7, 0xF7, 0xF7, 0xF5, 0xF4, 0xF4, 0xF8, 
-    0xFD, 0xFF, 0x00, 0xFD, 0xFA, 0xF7, 0xF5, 0xF3, 0xF5, 0xF8, 0xFC, 0xFF, 
-    0xFE, 0xFC, 0xFA, 0xF9, 0xF3, 0xEE, 0xE9, 0xEB, 0xF1, 0xF7, 0xFB, 0xFB, 
-    0xFA, 0xF6, 0xF8, 0xFB, 0x00, 0x00, 0xFD, 0xFD, 0xFC, 0xFF, 0x04, 0x09, 
-    0x0B, 0x09, 0x03, 0x00, 0xFF, 0x02, 0x06, 0x0A, 0x0A, 0x09, 0x08, 0x06, 
-    0x05, 0x03, 0x00, 0xFD, 0xFD, 0xFD, 0xFF, 0x05, 0x07, 0x06, 0x05, 0x04, 
-    0x02, 0x02, 0xFF, 0xFD, 0xFB, 0xF6, 0xF4, 0xF3, 0xFB, 0xFF, 0xFD, 0xF7, 
-    0xED, 0xE9, 0xE6, 0xE5, 0xE4, 0xE6, 0xE7, 0xEC, 0xED, 0xEA, 0xE7, 0xE1, 
-    0xE0, 0xDE, 0xDC, 0xDB, 0xDB, 0xDE, 0xE1, 0xE0, 0xDF, 0xDA, 0xD7, 0xDB, 
-    0xE1, 0xE4, 0xE0, 0xDA, 0xD5, 0xD6, 0xDE, 0xE6, 0xEB, 0xED, 0xEA, 0xE9, 
-    0xE9, 0xEA, 0xEF, 0xF4, 0xF9, 0x01, 0x04, 0x02, 0xFE, 0xFA, 0xF7, 0xF4, 
-    0xF1, 0xF0, 0xF0, 0xF6, 0xFB, 0xFC, 0xF8, 0xF4, 0xF2, 0xF4, 0xFC, 0xFE, 
-    0xFE, 0xFA, 0xF9, 0xFD, 0xFE, 0x01, 0x01, 0x00, 0xFC, 0xF9, 0xF5, 0xF2, 
-    0xF0, 0xF0, 0xF3, 0xF7, 0xF9, 0xFB, 0xFC, 0xFF, 0xFE, 0xFA, 0xF5, 0xF3, 
-    0xF8, 0xFE, 0x04, 0x08, 0x09, 0x0A, 0x09, 0x08, 0x09, 0x0B, 0x0B, 0x0A, 
-    0x05, 0x03, 0x06, 0x0A, 0x0F, 0x11, 0x0F, 0x0A, 0x07, 0x0B, 0x10, 0x13, 
-    0x16, 0x16, 0x18, 0x1A, 0x1B, 0x19, 0x16, 0x13, 0x11, 0x0E, 0x0B, 0x0D, 
-    0x0F, 0x12, 0x11, 0x0F, 0x0E, 0x0D, 0x0D, 0x11, 0x10, 0x0E, 0x0B, 0x08, 
-    0x0B, 0x0E, 0x15, 0x16, 0x11, 0x0A, 0x05, 0x06, 0x09, 0x0B, 0x0C, 0x0D, 
-    0x0F, 0x15, 0x17, 0x15, 0x10, 0x0C, 0x0B, 0x09, 0x08, 0x08, 0x0C, 0x10, 
-    0x13, 0x14, 0x11, 0x0D, 0x0F, 0x13, 0x14, 0x11, 0x0B, 0x07, 0x0A, 0x10, 
-    0x15, 0x18, 0x17, 0x11, 0x0C, 0x08, 0x06, 0x05, 0x04, 0x04, 0x06, 0x09, 
-    0x0A, 0x09, 0x08, 0x05, 0x03, 0x00, 0xFE, 0x00, 0x02, 0x06, 0x08, 0x06, 
-    0x03, 0x02, 0x03, 0x08, 0x09, 0x08, 0x04, 0xFF, 0xFD, 0xFD, 0x01, 0x03, 
-    0x01, 0xFD, 0xF7, 0xF3, 0xF2, 0xF1, 0xF0, 0xEF, 0xF1, 0xF4, 0xF7, 0xFA, 
-    0xF7, 0xF2, 0xED, 0xE8, 0xE7, 0xE7, 0xEB, 0xEF, 0xF3, 0xF6, 0xF5, 0xF4, 
-    0xF4, 0xF6, 0xF7, 0xF6, 0xF5, 0xF2, 0xF2, 0xF7, 0xFA, 0xFF, 0x01, 0x00, 
-    0xFD, 0xFC, 0xFE, 0x02, 0x04, 0x03, 0x03, 0x04, 0x0A, 0x10, 0x11, 0x0E, 
-    0x09, 0x04, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x03, 0x03, 0x02, 0x00, 0xFE, 
-    0x03, 0x06, 0x04, 0xFF, 0xFC, 0xFE, 0x03, 0x05, 0x04, 0xFD, 0xF4, 0xEE, 
-    0xEC, 0xEA, 0xE6, 0xE3, 0xE2, 0xE4, 0xE8, 0xEA, 0xEA, 0xE6, 0xE3, 0xE1, 
-    0xE0, 0xDF, 0xDF, 0xE3, 0xE7, 0xEB, 0xEB, 0xE9, 0xEC, 0xED, 0xF0, 0xED, 
-    0xE8, 0xE4, 0xE1, 0xE3, 0xE7, 0xEB, 0xEE, 0xED, 0xE9, 0xE4, 0xE2, 0xE3, 
-    0xE6, 0xE6, 0xE6, 0xE8, 0xEB, 0xEF, 0xF2, 0xF3, 0xF1, 0xED, 0xE9, 0xE9, 
-    0xEC, 0xED, 0xEF, 0xF0, 0xF1, 0xF2, 0xF2, 0xF2, 0xF5, 0xF9, 0xFB, 0xFB, 
-    0xF5, 0xF2, 0xF4, 0xF8, 0xFD, 0xFE, 0xFB, 0xF6, 0xF3, 0xF3, 0xF4, 0xF4, 
-    0xF6, 0xFA, 0x00, 0x06, 0x08, 0x08, 0x04, 0xFE, 0xF8, 0xF6, 0xF7, 0xF9, 
-    0xFD, 0x01, 0x05, 0x07, 0x08, 0x06, 0x07, 0x0A, 0x0C, 0x0C, 0x0A, 0x08, 
-    0x0A, 0x0F, 0x14, 0x16, 0x13, 0x0E, 0x0B, 0x0A, 0x0B, 0x0B, 0x0A, 0x09, 
-    0x0B, 0x0E, 0x12, 0x15, 0x17, 0x16, 0x13, 0x10, 0x0D, 0x0D, 0x0F, 0x14, 
-    0x19, 0x1E, 0x20, 0x1F, 0x1D, 0x1D, 0x1F, 0x1D, 0x1A, 0x15, 0x15, 0x16, 
-    0x18, 0x1A, 0x17, 0x12, 0x0C, 0x06, 0x03, 0x03, 0x04, 0x04, 0x05, 0x09, 
-    0x0A, 0x0A, 0x09, 0x08, 0x05, 0x02, 0x01, 0x00, 0x00, 0x02, 0x04, 0x06, 
-    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0B, 0x07, 0x04, 0x03, 0x04, 0x07, 0x0C, 
-    0x0F, 0x0D, 0x08, 0x03, 0x02, 0x04, 0x08, 0x0C, 0x0E, 0x10, 0x13, 0x16, 
-    0x16, 0x13, 0x0F, 0x0A, 0x06, 0x02, 0x00, 0xFF, 0x01, 0x05, 0x06, 0x06, 
-    0x04, 0x03, 0x05, 0x08, 0x08, 0x04, 0xFF, 0xFD, 0xFF, 0x05, 0x08, 0x07, 
-    0x02, 0xFB, 0xF6, 0xF1, 0xEF, 0xEE, 0xEF, 0xF2, 0xF4, 0xF5, 0xF4, 0xF3, 
-    0xF2, 0xEF, 0xEC, 0xEB, 0xEC, 0xED, 0xF1, 0xF7, 0xFC, 0xFE, 0xFE, 0xFD, 
-    0xFF, 0x01, 0x01
-};
-
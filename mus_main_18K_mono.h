@@ -0,0 +1,6 @@
+/* mus_main_18K_mono.h
+ * generated by tools/assets.py from mus_main_16K_mono.raw, the data is in the asset pack */
+
+#define mus_main_18K_mono_bytes 159780
+
+extern const signed char mus_main_18K_mono [];
@@ -0,0 +1,28 @@
+#!/bin/sh
+# build each test against the host build of the game and run it
+#   tests/run.sh                  run them all
+#   tests/run.sh tests/test_x.c   run some of them
+# each test includes metroid.c to get at the game's structs and constants, and
+# has its own main(), so gba_host.c is built with HOST_TEST
+cd "$(dirname "$0")/.." || exit 1
+
+if [ $# -eq 0 ]; then
+    set -- tests/test_*.c
+fi
+
+mkdir -p tests/bin
+failed=0
+for test in "$@"; do
+    name=$(basename "$test" .c)
+    if ! gcc -O2 -DHOST -DHOST_TEST -no-pie -I. "$test" assets.s \
+            tools/gba_host.c tools/gba_render.c tools/gba_audio.c -o "tests/bin/$name"; then
+        echo "$name: does not build"
+        failed=1
+    elif ! "tests/bin/$name"; then
+        echo "$name: FAILED"
+        failed=1
+    else
+        echo "$name: ok"
+    fi
+done
+exit $failed
@@ -0,0 +1,91 @@
+/*
+ * test_ai.c
+ * however small the AI's cycle budget, every enemy which is due still gets
+ * to think, one a frame if it comes to that
+ *
+ * every enemy is put next to Samus, where it can see her, and starts out
+ * patrolling, so each one which has thought is chasing her
+ *
+ * and a zeela which can see her only fires when the solid grid covers the
+ * level, as otherwise it would shoot through walls
+ */
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    setup_background();
+    setup_sprite_image();
+    sprite_clear();
+
+    struct Samus samus;
+    samus_init(&samus);
+
+    /* flying enemies, with their eyes where she is aimed at */
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        struct Enemy* enemy = &enemies[i];
+        enemy->used = 1;
+        enemy->alive = 1;
+        enemy->activity = ENEMY_ACTIVE;
+        enemy->type = &enemy_types[ENEMY_METROID];
+        enemy->offset = enemy->type->offset;
+        enemy->height = enemy->type->height;
+        enemy->x = samus.x;
+        enemy->y = samus.y + 16 - enemy->offset - enemy->height / 2;
+        enemy->state = AI_PATROL;
+        enemy->think_frame = 0;
+    }
+
+    /* not even enough for one enemy, so only the first one a frame thinks */
+    ai_cycle_budget = 1;
+    for (int frame = 0; frame < MAX_ENEMIES; frame++) {
+        game_frame++;
+        ai_update(&samus);
+        if (ai_thinks != 1) {
+            printf("frame %d: %d enemies thought with a budget of 1\n", frame, ai_thinks);
+            failed = 1;
+        }
+    }
+
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (enemies[i].state != AI_CHASE) {
+            printf("enemy %d never thought with a budget of 1\n", i);
+            failed = 1;
+        }
+    }
+
+    /* a zeela next to her, on its own so it is the one to think */
+    for (int i = 1; i < MAX_ENEMIES; i++) {
+        enemies[i].used = 0;
+    }
+    struct Enemy* zeela = &enemies[0];
+    zeela->type = &enemy_types[ENEMY_ZEELA];
+    zeela->offset = zeela->type->offset;
+    zeela->height = zeela->type->height;
+    zeela->y = samus.y + 16 - zeela->offset - zeela->height / 2;
+
+    ranged_ai_enabled = 0;
+    zeela->state = AI_PATROL;
+    zeela->think_frame = 0;
+    game_frame++;
+    ai_update(&samus);
+    if (zeela->state == AI_FIRE) {
+        printf("a zeela fired without the solid grid\n");
+        failed = 1;
+    }
+
+    ranged_ai_enabled = 1;
+    zeela->state = AI_PATROL;
+    zeela->think_frame = 0;
+    game_frame++;
+    ai_update(&samus);
+    if (zeela->state != AI_FIRE) {
+        printf("a zeela which can see her didn't fire\n");
+        failed = 1;
+    }
+    return failed;
+}
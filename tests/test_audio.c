@@ -0,0 +1,65 @@
+/*
+ * test_audio.c
+ * the sound buffers have to be swapped at the same point in every vblank,
+ * however much the DMA queue has to copy first
+ *
+ * a heavy queue on every other frame takes about 48000 cycles (52 samples)
+ * of vblank, so restarting the sound DMA after flushing it loses samples at
+ * each swap, and restarting it first (as on_vblank does) loses none
+ */
+#include "metroid.c"
+#include "tools/gba_audio.h"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+/* what the queue copies into VRAM */
+#define HEAVY_COPY 12000
+static unsigned short heavy_source[HEAVY_COPY];
+
+/* run some frames with a heavy queue every other frame, the handler either
+ * restarting the sound DMA after the queue or being the game's own, and
+ * return the samples lost (after a few quiet frames for the sound to settle) */
+static long run_frames(int restart_last, int frames) {
+    for (int i = 0; i < 8; i++) {
+        host_vblank_start();
+        on_vblank();
+    }
+
+    long lost = audio_samples_lost();
+    for (int i = 0; i < frames; i++) {
+        if (i & 1) {
+            dma_queue_push((unsigned short*) HOST_VRAM, heavy_source, HEAVY_COPY, DMA_PRIORITY_TILES, 0);
+        }
+
+        host_vblank_start();
+        if (restart_last) {
+            dma_queue_flush(DMA_VBLANK_BUDGET);
+            music_restart();
+            music_vblank();
+        } else {
+            on_vblank();
+        }
+    }
+    return audio_samples_lost() - lost;
+}
+
+int main(void) {
+    int failed = 0;
+
+    host_init(1);
+    sound_init(1);
+
+    long late = run_frames(1, 60);
+    if (late == 0) {
+        printf("restarting after a heavy DMA queue lost no samples\n");
+        failed = 1;
+    }
+
+    long first = run_frames(0, 60);
+    if (first != 0) {
+        printf("restarting first thing in vblank lost %ld samples\n", first);
+        failed = 1;
+    }
+    return failed;
+}
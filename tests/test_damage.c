@@ -0,0 +1,70 @@
+/*
+ * test_damage.c
+ * metatiles flagged METATILE_DAMAGE hurt Samus when she stands on them or
+ * walks into them, and the rest of the level doesn't
+ */
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+/* empty, a floor which hurts and a floor which doesn't */
+static const struct Metatile test_metatiles[] = {
+    {{0, 0, 0, 0}, {SHAPE_EMPTY, SHAPE_EMPTY, SHAPE_EMPTY, SHAPE_EMPTY}, 0, SURFACE_NONE, 0, 0},
+    {{0, 0, 0, 0}, {SHAPE_SOLID, SHAPE_SOLID, SHAPE_SOLID, SHAPE_SOLID}, COLLISION_SOLID, SURFACE_ROCK, METATILE_DAMAGE, 0},
+    {{0, 0, 0, 0}, {SHAPE_SOLID, SHAPE_SOLID, SHAPE_SOLID, SHAPE_SOLID}, COLLISION_SOLID, SURFACE_ROCK, 0, 0}
+};
+
+/* 4x4 metatiles, with the floor along the bottom hurting on the left */
+static const unsigned char test_cells[] = {
+    0, 0, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 1,
+    1, 1, 2, 2
+};
+
+/* put Samus somewhere and see if the level hurts her */
+static int hurts(struct Samus* samus, int x, int y) {
+    struct Projectile projectile = {0};
+    samus->x = x;
+    samus->y = y;
+    samus->invulnerable = 0;
+    currentLife = 3;
+    collide_all(samus, &projectile);
+    return currentLife != 3 && samus->invulnerable;
+}
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    setup_sprite_image();
+    level_map.metatiles = test_metatiles;
+    level_map.cells = test_cells;
+    level_map.width = 4;
+    level_map.height = 4;
+
+    struct Samus samus;
+    samus_init(&samus);
+
+    if (!hurts(&samus, 8, 48 - SAMUS_FEET)) {
+        printf("standing on a damage metatile didn't hurt\n");
+        failed = 1;
+    }
+    if (hurts(&samus, 36, 48 - SAMUS_FEET)) {
+        printf("standing on a plain floor hurt\n");
+        failed = 1;
+    }
+    if (hurts(&samus, 28, 48 - SAMUS_FEET - 8)) {
+        printf("standing in the air hurt\n");
+        failed = 1;
+    }
+    if (!hurts(&samus, 40, 32 - SAMUS_FEET + 8)) {
+        printf("walking into a damage metatile didn't hurt\n");
+        failed = 1;
+    } else if (samus.knockback >= 0) {
+        printf("walking into a damage metatile on the right didn't knock her left\n");
+        failed = 1;
+    }
+    return failed;
+}
@@ -0,0 +1,75 @@
+/*
+ * test_dma.c
+ * a full DMA queue turns copies away rather than making them mid frame, and
+ * a sprite slot taken over before its old frame was copied isn't marked
+ * ready until the new one is
+ */
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+/* the budget which makes just one sprite frame's copy */
+#define ONE_SLOT_CYCLES (DMA_SETUP_CYCLES + SPRITE_SLOT_BYTES / 2 * DMA_CYCLES_PER_HALFWORD)
+
+static unsigned short source[DMA_QUEUE_SIZE + 1][8];
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    setup_sprite_image();
+
+    /* fill the queue, then one more which mustn't be copied now or later */
+    unsigned short* dest = (unsigned short*) screen_block(24);
+    for (int i = 0; i <= DMA_QUEUE_SIZE; i++) {
+        source[i][0] = i + 1;
+        dest[i * 8] = 0;
+        int queued = dma_queue_push(dest + i * 8, source[i], 8, DMA_PRIORITY_MAP, 0);
+        if (queued != (i < DMA_QUEUE_SIZE)) {
+            printf("copy %d of %d %s queued\n", i + 1, DMA_QUEUE_SIZE, queued ? "was" : "wasn't");
+            failed = 1;
+        }
+    }
+    if (dest[DMA_QUEUE_SIZE * 8] != 0) {
+        printf("a copy which didn't fit in the queue was made straight away\n");
+        failed = 1;
+    }
+    dma_queue_flush(VBLANK_CYCLES);
+    if (dest[(DMA_QUEUE_SIZE - 1) * 8] != DMA_QUEUE_SIZE || dest[DMA_QUEUE_SIZE * 8] != 0) {
+        printf("the queue didn't make just the copies it took\n");
+        failed = 1;
+    }
+
+    /* queue frame A into a slot, then give the slot to frame B before the
+     * copy is made, and only have time for one copy a vblank */
+    int slot = sprite_vram_acquire(0);
+    sprite_vram_flush(SPRITE_UPLOAD_BUDGET);
+    sprite_vram_release(slot);
+    sprite_slot_clock = slot;
+    int source_b = SPRITE_SLOT_TILES * 3;
+    if (sprite_vram_acquire(source_b) != slot) {
+        printf("the slot wasn't reused\n");
+        return 1;
+    }
+    sprite_vram_flush(SPRITE_UPLOAD_BUDGET);
+
+    for (int vblank = 0; vblank < 2 && !sprite_slots[slot].ready; vblank++) {
+        dma_queue_flush(ONE_SLOT_CYCLES);
+    }
+    const unsigned short* frame_b = (const unsigned short*) (gba_sprites_data + source_b * 32);
+    const unsigned short* copied = (const unsigned short*) sprite_image_memory + slot * (SPRITE_SLOT_BYTES / 2);
+    if (!sprite_slots[slot].ready) {
+        printf("the slot never became ready\n");
+        failed = 1;
+    } else {
+        for (int i = 0; i < SPRITE_SLOT_BYTES / 2; i++) {
+            if (copied[i] != frame_b[i]) {
+                printf("the slot was ready before its new frame was copied\n");
+                failed = 1;
+                break;
+            }
+        }
+    }
+    return failed;
+}
@@ -0,0 +1,163 @@
+/*
+ * test_ground.c
+ * walking up and down each height profile follows it a pixel at a time, and
+ * one way platforms can be landed on from above and jumped up through
+ *
+ * each case is a row of eight 8x8 tiles on a small map, over a solid floor
+ */
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+/* the map is 4x8 metatiles, built from the shape of each 8x8 tile */
+#define TILES_WIDE 8
+#define TILES_HIGH 16
+static unsigned char shapes[TILES_HIGH][TILES_WIDE];
+static struct Metatile test_metatiles[TILES_HIGH / 2 * TILES_WIDE / 2];
+static unsigned char test_cells[TILES_HIGH / 2 * TILES_WIDE / 2];
+
+/* the row the profiles are put on, and the solid floor under it */
+#define PROFILE_ROW 11
+#define FLOOR_ROW 12
+#define FLOOR_Y (FLOOR_ROW * 8)
+
+/* make level_map a row of shapes over the floor */
+static void build_map(const unsigned char row[TILES_WIDE], int floor_row) {
+    for (int y = 0; y < TILES_HIGH; y++) {
+        for (int x = 0; x < TILES_WIDE; x++) {
+            shapes[y][x] = y == PROFILE_ROW ? row[x] : y >= floor_row ? SHAPE_SOLID : SHAPE_EMPTY;
+        }
+    }
+
+    for (int my = 0; my < TILES_HIGH / 2; my++) {
+        for (int mx = 0; mx < TILES_WIDE / 2; mx++) {
+            int i = my * (TILES_WIDE / 2) + mx;
+            struct Metatile* metatile = &test_metatiles[i];
+            metatile->collision = 0;
+            for (int quarter = 0; quarter < 4; quarter++) {
+                int shape = shapes[my * 2 + (quarter >> 1)][mx * 2 + (quarter & 1)];
+                metatile->shapes[quarter] = shape;
+                if (shape != SHAPE_EMPTY) {
+                    metatile->collision |= 1 << quarter;
+                }
+            }
+            test_cells[i] = i;
+        }
+    }
+    level_map.metatiles = test_metatiles;
+    level_map.cells = test_cells;
+    level_map.width = TILES_WIDE / 2;
+    level_map.height = TILES_HIGH / 2;
+}
+
+/* where the ground is in a column, from the shapes rather than ground_find,
+ * one way platforms are walked under rather than stepped up onto */
+static int expected_ground(int x) {
+    int shape = shapes[PROFILE_ROW][x >> 3];
+    int height = shape >= SHAPE_ONE_WAY ? 0 : height_profiles[shape][x & 7];
+    return height ? PROFILE_ROW * 8 + 8 - height : FLOOR_Y;
+}
+
+/* walk along the row one way then back, the way enemy_walk does, checking
+ * the feet are always on the profile */
+static int walk(const char* name, const unsigned char row[TILES_WIDE]) {
+    build_map(row, FLOOR_ROW);
+
+    int feet = expected_ground(1);
+    for (int pass = 0; pass < 2; pass++) {
+        for (int step = 1; step < TILES_WIDE * 8 - 2; step++) {
+            int x = pass == 0 ? 1 + step : TILES_WIDE * 8 - 2 - step;
+            int ground = ground_find(&level_map, x, feet, feet);
+            if (ground != expected_ground(x)) {
+                printf("%s: walking %s at x %d the ground was %d, expected %d\n",
+                       name, pass ? "left" : "right", x, ground, expected_ground(x));
+                return 1;
+            }
+            feet = ground;
+        }
+    }
+    return 0;
+}
+
+/* jump from the floor under a one way platform, returning where Samus' feet
+ * are once she stands still, and the highest they got */
+static int jump(int x, int* highest) {
+    struct Samus samus;
+    samus_init(&samus);
+    samus.x = x - 8;
+    samus.y = FLOOR_Y + 16 - SAMUS_FEET;
+    samus_update(&samus);
+    samus_jump(&samus);
+
+    *highest = samus.y + SAMUS_FEET;
+    for (int frame = 0; frame < 240 && samus.falling; frame++) {
+        samus_update(&samus);
+        if (samus.y + SAMUS_FEET < *highest) {
+            *highest = samus.y + SAMUS_FEET;
+        }
+    }
+    return samus.falling ? NO_GROUND : samus.y + SAMUS_FEET;
+}
+
+#define E SHAPE_EMPTY
+#define S SHAPE_SOLID
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    setup_sprite_image();
+
+    const unsigned char up_right[] = {E, E, E, SHAPE_SLOPE_UP_RIGHT, S, S, S, S};
+    const unsigned char up_left[] = {S, S, S, S, SHAPE_SLOPE_UP_LEFT, E, E, E};
+    const unsigned char gentle_up_right[] = {E, E, SHAPE_SLOPE_LOW_UP_RIGHT, SHAPE_SLOPE_HIGH_UP_RIGHT, S, S, S, S};
+    const unsigned char gentle_up_left[] = {S, S, S, S, SHAPE_SLOPE_HIGH_UP_LEFT, SHAPE_SLOPE_LOW_UP_LEFT, E, E};
+    const unsigned char half[] = {E, E, SHAPE_HALF, SHAPE_HALF, E, E, E, E};
+    const unsigned char one_way[] = {E, E, SHAPE_ONE_WAY, SHAPE_ONE_WAY, SHAPE_ONE_WAY_HALF, SHAPE_ONE_WAY_HALF, E, E};
+
+    failed |= walk("slope up right", up_right);
+    failed |= walk("slope up left", up_left);
+    failed |= walk("gentle slope up right", gentle_up_right);
+    failed |= walk("gentle slope up left", gentle_up_left);
+    failed |= walk("half block", half);
+    failed |= walk("under one way platforms", one_way);
+
+    /* the floor two tiles further down, so there is room under the platforms */
+    build_map(one_way, FLOOR_ROW + 2);
+    for (int x = 16; x < 48; x += 8) {
+        int top = PROFILE_ROW * 8 + 8 - height_profiles[one_way[x >> 3]][0];
+        int highest;
+        int landed = jump(x + 4, &highest);
+        if (highest >= top) {
+            printf("one way platform at x %d: the jump only got to %d, not above %d\n", x, highest, top);
+            failed = 1;
+        } else if (landed != top) {
+            printf("one way platform at x %d: jumping up through it landed at %d, expected %d\n", x, landed, top);
+            failed = 1;
+        }
+
+        /* coming down onto it from above stops on it, from below doesn't */
+        if (ground_find(&level_map, x + 4, top + 2, top - 2) != top) {
+            printf("one way platform at x %d: falling onto it didn't stop on it\n", x);
+            failed = 1;
+        }
+        if (ground_find(&level_map, x + 4, top + 2, top + 6) != NO_GROUND) {
+            printf("one way platform at x %d: rising into it stopped on it\n", x);
+            failed = 1;
+        }
+    }
+
+    /* once on top, walking along steps down onto the lower platform */
+    int feet = PROFILE_ROW * 8;
+    for (int x = 17; x < 48; x++) {
+        int top = PROFILE_ROW * 8 + 8 - height_profiles[one_way[x >> 3]][x & 7];
+        feet = ground_find(&level_map, x, feet, feet);
+        if (feet != top) {
+            printf("walking along the one way platforms at x %d the ground was %d, expected %d\n", x, feet, top);
+            failed = 1;
+            break;
+        }
+    }
+    return failed;
+}
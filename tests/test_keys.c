@@ -0,0 +1,67 @@
+/*
+ * test_keys.c
+ * each button auto-repeats on its own timing, so tapping A to jump or
+ * changing direction doesn't stall holding B to keep firing
+ */
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+/* latch a frame with some buttons held */
+static void frame(unsigned short held) {
+    *buttons = ~held & BUTTON_ALL;
+    key_poll();
+}
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    key_repeat_limits(12, 12);
+
+    /* B goes down and repeats every 12 frames, while A is tapped and the
+     * direction changes in between */
+    int fired = 0;
+    for (int i = 0; i < 61; i++) {
+        unsigned short held = BUTTON_B;
+        if (i >= 5 && i < 8) {
+            held |= BUTTON_A;
+        }
+        if (i >= 14 && i < 30) {
+            held |= BUTTON_RIGHT;
+        } else if (i >= 30) {
+            held |= BUTTON_LEFT;
+        }
+        frame(held);
+
+        int expected = i % 12 == 0;
+        if (!key_repeat(BUTTON_B) != !expected) {
+            printf("frame %d: B %s\n", i, expected ? "didn't repeat" : "repeated early");
+            failed = 1;
+        }
+        if (key_repeat(BUTTON_B)) {
+            fired++;
+        }
+        if ((i == 5 && !key_repeat(BUTTON_A)) || (i == 14 && !key_repeat(BUTTON_RIGHT))) {
+            printf("frame %d: a button which was just pressed didn't count as a repeat\n", i);
+            failed = 1;
+        }
+    }
+    if (fired != 6) {
+        printf("B repeated %d times in 61 frames, expected 6\n", fired);
+        failed = 1;
+    }
+
+    /* letting go and pressing again starts the delay over */
+    frame(0);
+    frame(BUTTON_B);
+    for (int i = 1; i < 12; i++) {
+        frame(BUTTON_B);
+        if (key_repeat(BUTTON_B)) {
+            printf("B repeated %d frames after being pressed again\n", i);
+            failed = 1;
+        }
+    }
+    return failed;
+}
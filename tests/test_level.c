@@ -0,0 +1,48 @@
+/*
+ * test_level.c
+ * a level with more spawns than MAX_SPAWNS only uses the first ones, rather
+ * than running off the end of the spawn tables as the camera goes along
+ */
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+#define TOO_MANY_SPAWNS (MAX_SPAWNS + 16)
+static struct Spawn crowded_spawns[TOO_MANY_SPAWNS];
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    setup_background();
+    setup_sprite_image();
+    sprite_clear();
+
+    for (int i = 0; i < TOO_MANY_SPAWNS; i++) {
+        crowded_spawns[i].x = i * 16;
+        crowded_spawns[i].y = 48;
+        crowded_spawns[i].type = ENEMY_METROID;
+    }
+    const struct Level crowded = {crowded_spawns, TOO_MANY_SPAWNS};
+
+    camera_init(&camera, 40, 2);
+    level_start(&crowded);
+    if (spawn_count != MAX_SPAWNS || numEnemies != MAX_SPAWNS) {
+        printf("a level of %d spawns uses %d of them and needs %d killed, expected %d\n",
+               TOO_MANY_SPAWNS, spawn_count, numEnemies, MAX_SPAWNS);
+        failed = 1;
+    }
+
+    /* go along the whole level and back */
+    for (int step = 0; step < 2 * TOO_MANY_SPAWNS * 4 && !failed; step++) {
+        int x = step < TOO_MANY_SPAWNS * 4 ? step * 4 : (2 * TOO_MANY_SPAWNS * 4 - step) * 4;
+        camera.x = x;
+        level_update();
+        if (spawn_left < 0 || spawn_right > MAX_SPAWNS || spawn_left > spawn_right) {
+            printf("at x %d the spawn cursors are %d and %d\n", x, spawn_left, spawn_right);
+            failed = 1;
+        }
+    }
+    return failed;
+}
@@ -0,0 +1,85 @@
+/*
+ * test_mem.c
+ * mem_copy and mem_fill copy nothing for nothing, and split up copies
+ * longer than one DMA can make rather than running its count into the
+ * control bits
+ */
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+/* more than the 0xffff words one DMA can move */
+#define BUFFER_BYTES 0x50000
+static unsigned char source[BUFFER_BYTES];
+static unsigned char dest[BUFFER_BYTES];
+
+/* check a run of the destination, returns 0 with a message if a byte is wrong */
+static int check(const char* what, int from, int to, int (*expected)(int)) {
+    for (int i = from; i < to; i++) {
+        if (dest[i] != expected(i)) {
+            printf("%s: byte %#x is %#x, expected %#x\n", what, i, dest[i], expected(i));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int zero(int i) {
+    (void) i;
+    return 0;
+}
+
+static int copied(int i) {
+    return source[i];
+}
+
+static int copied_after_2(int i) {
+    return source[i - 2];
+}
+
+static int filled(int i) {
+    return i & 1 ? 0x12 : 0x34;
+}
+
+static void clear(void) {
+    for (int i = 0; i < BUFFER_BYTES; i++) {
+        dest[i] = 0;
+    }
+}
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    for (int i = 0; i < BUFFER_BYTES; i++) {
+        source[i] = i * 7 + (i >> 8);
+    }
+
+    mem_copy(dest, source, 0);
+    mem_copy(dest, source, -4);
+    failed |= !check("copying nothing", 0, BUFFER_BYTES, zero);
+
+    /* more words than one DMA can do, then more halfwords */
+    int words = 0x3fffc + 8;
+    mem_copy(dest, source, words);
+    failed |= !check("a long word copy", 0, words, copied);
+    failed |= !check("past a long word copy", words, BUFFER_BYTES, zero);
+
+    clear();
+    int halfwords = 0x1fffe + 6;
+    mem_copy(dest + 2, source, halfwords);
+    failed |= !check("before a long halfword copy", 0, 2, zero);
+    failed |= !check("a long halfword copy", 2, 2 + halfwords, copied_after_2);
+    failed |= !check("past a long halfword copy", 2 + halfwords, BUFFER_BYTES, zero);
+
+    /* word aligned but not in blocks of 32, so it is a DMA fill */
+    clear();
+    mem_fill(dest, 0x1234, 0);
+    failed |= !check("filling nothing", 0, BUFFER_BYTES, zero);
+    int fill = 0x3fffc + 12;
+    mem_fill(dest, 0x1234, fill);
+    failed |= !check("a long fill", 0, fill, filled);
+    failed |= !check("past a long fill", fill, BUFFER_BYTES, zero);
+    return failed;
+}
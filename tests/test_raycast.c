@@ -0,0 +1,206 @@
+/*
+ * test_raycast.c
+ * raycast against working out exactly which tiles each ray crosses, on
+ * random maps, and solid_grid_build turning away maps it can't wrap
+ *
+ * rays go between pixel centres, so in half pixels they start and end on odd
+ * coordinates and tile edges are multiples of 16 - a ray which only touches
+ * a corner of a tile may or may not be stopped by it, but one which crosses
+ * a solid tile has to be, and by the first one it crosses
+ */
+#include <stdlib.h>
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+/* every combination of solid quarters, and a 16x16 metatile map of them */
+#define MAP_METATILES 16
+#define MAP_PIXELS (MAP_METATILES * 16)
+static struct Metatile test_metatiles[16];
+static unsigned char test_cells[SOLID_GRID_SIZE / 2 * SOLID_GRID_SIZE / 2];
+
+/* a fraction with a positive denominator */
+struct Fraction {
+    long long n, d;
+};
+
+static int less(struct Fraction a, struct Fraction b) {
+    return a.n * b.d < b.n * a.d;
+}
+
+/* where a ray starting at a (in half pixels) going d crosses edge along one
+ * axis, as a fraction of the way along it */
+static struct Fraction crossing(long long edge, long long a, long long d) {
+    struct Fraction t = {edge - a, d};
+    if (d < 0) {
+        t.n = -t.n;
+        t.d = -t.d;
+    }
+    return t;
+}
+
+/* the part of a ray which is in a tile, returns 0 if it misses the tile,
+ * with open set to whether it goes through the inside rather than just
+ * touching a corner or an edge */
+static int ray_in_tile(long long ax, long long ay, long long dx, long long dy, int tx, int ty,
+        struct Fraction* enter, int* open) {
+    struct Fraction lo = {0, 1}, hi = {1, 1};
+    long long a[2] = {ax, ay}, d[2] = {dx, dy};
+    int t[2] = {tx, ty};
+
+    for (int axis = 0; axis < 2; axis++) {
+        long long low = t[axis] * 16, high = low + 16;
+        if (d[axis] == 0) {
+            /* the ends are never on an edge */
+            if (a[axis] < low || a[axis] > high) {
+                return 0;
+            }
+            continue;
+        }
+        struct Fraction t0 = crossing(low, a[axis], d[axis]);
+        struct Fraction t1 = crossing(high, a[axis], d[axis]);
+        if (less(t1, t0)) {
+            struct Fraction swap = t0;
+            t0 = t1;
+            t1 = swap;
+        }
+        if (less(lo, t0)) {
+            lo = t0;
+        }
+        if (less(t1, hi)) {
+            hi = t1;
+        }
+    }
+    if (less(hi, lo)) {
+        return 0;
+    }
+    *enter = lo;
+    *open = less(lo, hi);
+    return 1;
+}
+
+/* check one ray, returns 0 if raycast got it wrong */
+static int check_ray(int x0, int y0, int x1, int y1) {
+    int hit_x, hit_y;
+    int hit = raycast(x0, y0, x1, y1, &hit_x, &hit_y);
+
+    long long ax = 2 * x0 + 1, ay = 2 * y0 + 1;
+    long long dx = 2 * (x1 - x0), dy = 2 * (y1 - y0);
+    int start_x = x0 >> 3, start_y = y0 >> 3, end_x = x1 >> 3, end_y = y1 >> 3;
+
+    /* the first solid tile the ray crosses, not counting the ends */
+    int first = 0;
+    struct Fraction first_enter = {1, 1};
+    int min_x = start_x < end_x ? start_x : end_x, max_x = start_x < end_x ? end_x : start_x;
+    int min_y = start_y < end_y ? start_y : end_y, max_y = start_y < end_y ? end_y : start_y;
+    for (int ty = min_y; ty <= max_y; ty++) {
+        for (int tx = min_x; tx <= max_x; tx++) {
+            struct Fraction enter;
+            int open;
+            if ((tx == start_x && ty == start_y) || (tx == end_x && ty == end_y) ||
+                    !solid_grid_at(tx, ty) || !ray_in_tile(ax, ay, dx, dy, tx, ty, &enter, &open) || !open) {
+                continue;
+            }
+            if (!first || less(enter, first_enter)) {
+                first = 1;
+                first_enter = enter;
+            }
+        }
+    }
+
+    if (!hit) {
+        if (first) {
+            printf("(%d, %d) to (%d, %d) got through a solid tile\n", x0, y0, x1, y1);
+            return 0;
+        }
+        return 1;
+    }
+
+    struct Fraction enter;
+    int open;
+    if ((hit_x == start_x && hit_y == start_y) || (hit_x == end_x && hit_y == end_y) ||
+            !solid_grid_at(hit_x, hit_y) || !ray_in_tile(ax, ay, dx, dy, hit_x, hit_y, &enter, &open)) {
+        printf("(%d, %d) to (%d, %d) hit tile (%d, %d), which it doesn't pass\n", x0, y0, x1, y1, hit_x, hit_y);
+        return 0;
+    }
+    if (first && less(first_enter, enter)) {
+        printf("(%d, %d) to (%d, %d) hit tile (%d, %d), past the first solid one\n", x0, y0, x1, y1, hit_x, hit_y);
+        return 0;
+    }
+    return 1;
+}
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    for (int i = 0; i < 16; i++) {
+        test_metatiles[i].collision = i;
+    }
+    struct MetatileMap map = {test_metatiles, test_cells, MAP_METATILES, MAP_METATILES};
+
+    srand(305);
+    for (int round = 0; round < 20 && !failed; round++) {
+        /* from open to nearly full */
+        int density = 1 + round % 10;
+        for (int i = 0; i < MAP_METATILES * MAP_METATILES; i++) {
+            int cell = 0;
+            for (int quarter = 0; quarter < 4; quarter++) {
+                if (rand() % 16 < density) {
+                    cell |= 1 << quarter;
+                }
+            }
+            test_cells[i] = cell;
+        }
+        if (!solid_grid_build(&map)) {
+            printf("a %dx%d map was turned away\n", MAP_METATILES * 2, MAP_METATILES * 2);
+            return 1;
+        }
+
+        for (int ray = 0; ray < 10000; ray++) {
+            int x0 = rand() % MAP_PIXELS, y0 = rand() % MAP_PIXELS;
+            int x1 = rand() % MAP_PIXELS, y1 = rand() % MAP_PIXELS;
+            /* plenty of short, straight and diagonal ones too */
+            switch (ray % 4) {
+                case 1:
+                    x1 = x0 + rand() % 33 - 16;
+                    y1 = y0 + rand() % 33 - 16;
+                    break;
+                case 2:
+                    y1 = y0;
+                    break;
+                case 3:
+                    y1 = y0 + (x1 - x0) * (rand() & 1 ? 1 : -1);
+                    break;
+            }
+            if (x1 < 0 || x1 >= MAP_PIXELS || y1 < 0 || y1 >= MAP_PIXELS) {
+                continue;
+            }
+            if (!check_ray(x0, y0, x1, y1)) {
+                failed = 1;
+                break;
+            }
+        }
+    }
+
+    /* the grid only wraps sizes which are a power of two, up to 64 tiles */
+    const int sizes[][2] = {{24, 16}, {16, 24}, {64, 16}, {8, 0}};
+    int hit_x, hit_y;
+    for (int i = 0; i < 4; i++) {
+        struct MetatileMap odd = {test_metatiles, test_cells, sizes[i][0], sizes[i][1]};
+        if (solid_grid_build(&odd)) {
+            printf("a %dx%d map wasn't turned away\n", sizes[i][0] * 2, sizes[i][1] * 2);
+            failed = 1;
+        } else if (raycast(4, 4, 100, 60, &hit_x, &hit_y)) {
+            printf("a map which was turned away still blocks sight\n");
+            failed = 1;
+        }
+    }
+    struct MetatileMap biggest = {test_metatiles, test_cells, 32, 32};
+    if (!solid_grid_build(&biggest)) {
+        printf("a 64x64 map was turned away\n");
+        failed = 1;
+    }
+    return failed;
+}
@@ -0,0 +1,60 @@
+/*
+ * test_sfx.c
+ * a sound doesn't start again until its cooldown is up, even when it has
+ * already stopped or lost its channel, and waiting that out isn't counted
+ * as being merged into another request
+ */
+#include "metroid.c"
+
+/* metroid.c renames its main() for the host build */
+#undef main
+
+/* the channel hurt_sound is playing on, or -1 */
+static int hurt_channel(void) {
+    for (int channel = 0; channel < PSG_CHANNELS; channel++) {
+        if (psg_voices[channel].sound == &hurt_sound) {
+            return channel;
+        }
+    }
+    return -1;
+}
+
+int main(void) {
+    int failed = 0;
+
+    host_init(0);
+    sound_init(1);
+
+    sfx_request(&hurt_sound, PAN_CENTRE);
+    sfx_commit();
+    int channel = hurt_channel();
+    if (channel < 0) {
+        printf("hurt_sound didn't start\n");
+        return 1;
+    }
+
+    /* cut it off straight away, it still can't start again for a while */
+    psg_stop(channel);
+    for (int frame = 1; frame < hurt_sound.cooldown; frame++) {
+        sfx_request(&hurt_sound, PAN_CENTRE);
+        sfx_commit();
+        if (hurt_channel() >= 0) {
+            printf("hurt_sound started again %d frames later, its cooldown is %d\n", frame, hurt_sound.cooldown);
+            failed = 1;
+            break;
+        }
+    }
+    if (sfx_coalesced != 0 || sfx_cooling != hurt_sound.cooldown - 1) {
+        printf("%d requests coalesced and %d cooling, expected 0 and %d\n",
+               sfx_coalesced, sfx_cooling, hurt_sound.cooldown - 1);
+        failed = 1;
+    }
+
+    sfx_request(&hurt_sound, PAN_CENTRE);
+    sfx_commit();
+    if (hurt_channel() < 0) {
+        printf("hurt_sound didn't start once its cooldown was up\n");
+        failed = 1;
+    }
+    return failed;
+}
@@ -0,0 +1,654 @@
+#!/usr/bin/env python3
+"""
+assets.py
+builds the game's assets from their sources, as listed in assets.txt
+
+usage: assets.py [-j JOBS] [--force] [--check] [--manifest FILE] [OUTPUT ...]
+
+each line of the manifest is
+
+    kind source output [option ...]
+
+where kind is one of
+
+    png  a PNG image, converted to 8x8 tiles of 8 bit palette indices and a
+         palette, the way png2gba did it, making name_data and name_palette
+           set=I:RGB,...    put a 15 bit colour at palette index I after
+                            converting (the hand made white and the like)
+           index=RGB:I,...  use palette index I for a colour, rather than
+                            giving it the next free one
+    raw  signed 8 bit mono audio, converted with raw2gba.py, making name
+           from=RATE to=RATE loop  resample, as raw2gba.py does
+    map  a CSV of tile numbers (as exported by Tiled and most tile editors),
+         one row of the map per line, making name
+    metamap  the same, but stored as 16x16 metatiles: name_metatiles is a
+         table of the 2x2 blocks of tiles used, each with the shape of each
+         quarter, a collision byte with a bit for each quarter which isn't
+         empty, and surface and flags bytes, and name is a byte per metatile
+           solid=A-B,...    tile ranges which are solid all over
+           shape=N:A-B,...;N:A-B,...  tile ranges with height profile N
+                            (SHAPE_ in metroid.c: slopes, half blocks and
+                            one way platforms)
+           surface=S:A-B,...;S:A-B,...  surface type S for tiles in ranges
+           damage=A-B,...   tile ranges which hurt, setting flag bit 0
+    mod  a 4 channel MOD file, converted with mod2gba.py into samples
+         name_sample_N, name_patterns and name_order in the pack, and the
+         header also defines name_instruments and the struct Song name
+         itself, so it has to be included after struct Song is declared
+
+every kind but mod also takes lz77, which stores the asset's arrays compressed so
+they have to be loaded with asset_load()
+
+the output is the path of a small header which defines the asset's
+dimensions and sizes in bytes (uncompressed) and declares its arrays, and the
+name of the arrays is the header's file name without .h, or name=NAME
+
+all the arrays go into one asset pack, data/assets.pak, indexed by the hash
+of their names so metroid.c can find them at run time, and arrays with the
+same contents are only stored once - assets.s links the pack into the ROM
+with .incbin and gives the uncompressed arrays their names within it, so the
+compiler never sees the data, and assets.h has the hash of each name
+
+each conversion is cached under .asset_cache by a hash of the source's
+contents, the kind, the options and the converter version, so only assets
+whose source or options changed are converted again, and files are only
+written when their contents change so their times don't change either -
+conversions which have to run are spread across the cores
+
+--force converts everything again and --check only reports files which are
+out of date (for checking in CI that the checked in files match their sources),
+without writing anything, the cache included
+
+giving outputs only rebuilds those assets' headers (and --force only converts
+them again) - the pack is still put together from every asset, so ones which
+aren't cached are converted for it too
+"""
+import concurrent.futures
+import hashlib
+import os
+import pickle
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import mod2gba
+import raw2gba
+
+# bump this when a converter's output changes, so cached results are not used
+VERSION = 6
+
+CACHE = ".asset_cache"
+
+# the pack, the assembly file which links it in and the header of name hashes
+PACK = "data/assets.pak"
+ASSEMBLY = "assets.s"
+HASHES = "assets.h"
+
+# "APAK", and the entry types and compressions, as in metroid.c
+PACK_MAGIC = 0x4b415041
+TYPE_TILES = 1
+TYPE_PALETTE = 2
+TYPE_MAP = 3
+TYPE_SAMPLES = 4
+TYPE_METATILES = 5
+TYPE_METAMAP = 6
+TYPE_PATTERNS = 7
+TYPE_ORDER = 8
+
+# the flag bits of a metatile, and the shape of a solid tile
+METATILE_DAMAGE = 1
+SHAPE_SOLID = 1
+COMPRESSION_NONE = 0
+COMPRESSION_LZ77 = 1
+
+# everything in the pack is word aligned, for 32 bit DMA
+ALIGN = 2
+
+PALETTE_SIZE = 256
+TRANSPARENT = 0x7c1f
+
+
+class AssetError(Exception):
+    pass
+
+
+def read_png(path):
+    """returns width, height and the pixels as rows of (r, g, b, a)"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise AssetError("not a PNG file")
+
+    pos = 8
+    idat = b""
+    plte = b""
+    trns = b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += length + 12
+        if kind == b"IHDR":
+            width, height, depth, colour, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            plte = body
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+
+    if depth != 8 or interlace:
+        raise AssetError("only 8 bit, non interlaced PNGs are supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[colour]
+
+    # undo the filter on each line
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    previous = bytearray(stride)
+    lines = []
+    i = 0
+    for _ in range(height):
+        method = raw[i]
+        line = bytearray(raw[i + 1:i + 1 + stride])
+        i += stride + 1
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = previous[x]
+            c = previous[x - channels] if x >= channels else 0
+            if method == 1:
+                line[x] = (line[x] + a) & 0xff
+            elif method == 2:
+                line[x] = (line[x] + b) & 0xff
+            elif method == 3:
+                line[x] = (line[x] + (a + b) // 2) & 0xff
+            elif method == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[x] = (line[x] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        lines.append(line)
+        previous = line
+
+    rows = []
+    for line in lines:
+        row = []
+        for x in range(width):
+            p = line[x * channels:(x + 1) * channels]
+            if colour == 0:
+                row.append((p[0], p[0], p[0], 255))
+            elif colour == 2:
+                row.append((p[0], p[1], p[2], 255))
+            elif colour == 3:
+                index = p[0]
+                alpha = trns[index] if index < len(trns) else 255
+                row.append((plte[index * 3], plte[index * 3 + 1], plte[index * 3 + 2], alpha))
+            elif colour == 4:
+                row.append((p[0], p[0], p[0], p[1]))
+            else:
+                row.append(tuple(p))
+        rows.append(row)
+    return width, height, rows
+
+
+def colour15(r, g, b):
+    return ((b >> 3) << 10) | ((g >> 3) << 5) | (r >> 3)
+
+
+def parse_pairs(text, key, value):
+    pairs = []
+    for pair in text.split(","):
+        a, b = pair.split(":")
+        pairs.append((key(a), value(b)))
+    return pairs
+
+
+def convert_png(source, name, options):
+    width, height, rows = read_png(source)
+
+    # colours with a fixed index still go in the palette, but the pixels use the fixed index
+    fixed = dict(parse_pairs(options["index"], lambda c: int(c, 16), int)) if "index" in options else {}
+    palette = [TRANSPARENT]
+    lookup = {TRANSPARENT: 0}
+
+    # a tile at a time, left to right and top to bottom, with tiles at the
+    # right or bottom edge filled out with transparent pixels
+    data = []
+    for ty in range(0, height, 8):
+        for tx in range(0, width, 8):
+            for y in range(ty, ty + 8):
+                for x in range(tx, tx + 8):
+                    if x < width and y < height:
+                        r, g, b, a = rows[y][x]
+                        colour = colour15(r, g, b) if a else TRANSPARENT
+                    else:
+                        colour = TRANSPARENT
+                    if colour not in lookup:
+                        lookup[colour] = len(palette)
+                        palette.append(colour)
+                    data.append(fixed.get(colour, lookup[colour]))
+
+    if len(palette) > PALETTE_SIZE or max(data) >= PALETTE_SIZE:
+        raise AssetError("%d colours, the palette only has %d" % (len(palette), PALETTE_SIZE))
+    palette += [0] * (PALETTE_SIZE - len(palette))
+    if "set" in options:
+        for index, colour in parse_pairs(options["set"], int, lambda c: int(c, 16)):
+            palette[index] = colour
+
+    defines = [("width", width), ("height", height),
+               ("data_bytes", len(data)), ("palette_bytes", len(palette) * 2)]
+    arrays = [("unsigned char", name + "_data", TYPE_TILES, bytes(data)),
+              ("unsigned short", name + "_palette", TYPE_PALETTE, struct.pack("<%dH" % len(palette), *palette))]
+    return defines, arrays
+
+
+def convert_raw(source, name, options):
+    with open(source, "rb") as f:
+        samples = [b - 256 if b > 127 else b for b in f.read()]
+    if "from" in options:
+        samples = raw2gba.resample(samples, int(options["from"]), int(options["to"]), "loop" in options)
+
+    return [("bytes", len(samples))], [("signed char", name, TYPE_SAMPLES, bytes(s & 0xff for s in samples))]
+
+
+def read_csv_map(source):
+    with open(source) as f:
+        rows = [[int(v) for v in line.replace(",", " ").split()] for line in f if line.strip()]
+    width = len(rows[0])
+    if any(len(row) != width for row in rows):
+        raise AssetError("rows of the map are different lengths")
+    return width, rows
+
+
+def parse_ranges(text):
+    """a set of tile numbers from ranges like 540-551,556"""
+    tiles = set()
+    for part in text.split(","):
+        if part:
+            first, _, last = part.partition("-")
+            tiles.update(range(int(first), int(last or first) + 1))
+    return tiles
+
+
+def parse_numbered_ranges(text):
+    """tile numbers to values from N:ranges;N:ranges"""
+    values = {}
+    for part in text.split(";"):
+        if part:
+            value, _, ranges = part.partition(":")
+            values.update(dict.fromkeys(parse_ranges(ranges), int(value)))
+    return values
+
+
+def convert_map(source, name, options):
+    width, rows = read_csv_map(source)
+
+    entries = [v for row in rows for v in row]
+    defines = [("width", width), ("height", len(rows)), ("bytes", len(entries) * 2)]
+    return defines, [("unsigned short", name, TYPE_MAP, struct.pack("<%dH" % len(entries), *entries))]
+
+
+def convert_metamap(source, name, options):
+    width, rows = read_csv_map(source)
+    if width % 2 or len(rows) % 2:
+        raise AssetError("a metatile map has to be an even number of tiles each way")
+
+    damage = parse_ranges(options.get("damage", ""))
+    shapes = dict.fromkeys(parse_ranges(options.get("solid", "")), SHAPE_SOLID)
+    shapes.update(parse_numbered_ranges(options.get("shape", "")))
+    surfaces = parse_numbered_ranges(options.get("surface", ""))
+
+    # each 2x2 block of tiles becomes a metatile, the same blocks sharing one
+    metatiles = []
+    lookup = {}
+    cells = []
+    for y in range(0, len(rows), 2):
+        for x in range(0, width, 2):
+            tiles = (rows[y][x], rows[y][x + 1], rows[y + 1][x], rows[y + 1][x + 1])
+            if tiles not in lookup:
+                lookup[tiles] = len(metatiles)
+                metatiles.append(tiles)
+            cells.append(lookup[tiles])
+    if len(metatiles) > 256:
+        raise AssetError("%d metatiles, a byte can only pick from 256" % len(metatiles))
+
+    # the quarters go top left, top right, bottom left, bottom right, the
+    # collision byte has bits 0 to 3 for them, and the surface is the first one set
+    table = bytearray()
+    for tiles in metatiles:
+        quarters = [shapes.get(tile, 0) for tile in tiles]
+        collision = sum(1 << i for i, shape in enumerate(quarters) if shape)
+        surface = next((surfaces[tile] for tile in tiles if tile in surfaces), 0)
+        flags = METATILE_DAMAGE if any(tile in damage for tile in tiles) else 0
+        table += struct.pack("<4H4BBBBB", *tiles, *quarters, collision, surface, flags, 0)
+
+    defines = [("width", width), ("height", len(rows)), ("metatile_count", len(metatiles)),
+               ("metatiles_bytes", len(table)), ("bytes", len(cells))]
+    return defines, [("unsigned short", name + "_metatiles", TYPE_METATILES, bytes(table)),
+                     ("unsigned char", name, TYPE_METAMAP, bytes(cells))]
+
+
+def convert_mod(source, name, options):
+    """the song's data goes in the pack, but the instruments and the song
+    point at it, so they are C in the header rather than arrays"""
+    if "lz77" in options:
+        raise AssetError("%s: a song is played in place and can't be compressed" % source)
+    with open(source, "rb") as f:
+        instruments, patterns, order, restart = mod2gba.read_mod(f.read())
+
+    arrays = []
+    for number, instrument in enumerate(instruments, 1):
+        if instrument["length"]:
+            arrays.append(("signed char", "%s_sample_%d" % (name, number), TYPE_SAMPLES,
+                           bytes(instrument["data"])))
+    notes, dropped = mod2gba.pattern_notes(patterns)
+    mod2gba.report_dropped(source, dropped)
+    arrays.append(("struct Note", name + "_patterns", TYPE_PATTERNS, notes))
+    arrays.append(("unsigned char", name + "_order", TYPE_ORDER, bytes(order)))
+
+    code = "\nconst struct Instrument %s_instruments[] = {\n" % name
+    code += "".join("    %s,\n" % entry for entry in mod2gba.instrument_entries(name, instruments))
+    code += "};\n\n" + mod2gba.song_definition(name, order, restart)
+    return [("patterns_bytes", len(notes)), ("order_bytes", len(order))], arrays, code
+
+
+CONVERTERS = {"png": convert_png, "raw": convert_raw, "map": convert_map, "metamap": convert_metamap,
+              "mod": convert_mod}
+
+def read_manifest(path):
+    assets = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            words = line.split("#")[0].split()
+            if not words:
+                continue
+            if len(words) < 3 or words[0] not in CONVERTERS:
+                raise AssetError("%s:%d: expected kind source output [options]" % (path, number))
+            options = {}
+            for word in words[3:]:
+                key, _, value = word.partition("=")
+                options[key] = value
+            assets.append({"kind": words[0], "source": words[1], "output": words[2], "options": options})
+    return assets
+
+
+def asset_name(asset):
+    """the name of the asset's arrays, the header's file name unless name= is given"""
+    return asset["options"].get("name") or os.path.splitext(os.path.basename(asset["output"]))[0]
+
+
+def cache_key(asset):
+    """a hash of everything the output depends on"""
+    h = hashlib.sha256()
+    h.update(("%d %s %s" % (VERSION, asset["kind"], asset["output"])).encode())
+    for key in sorted(asset["options"]):
+        h.update((" %s=%s" % (key, asset["options"][key])).encode())
+    h.update(b"\0")
+    with open(asset["source"], "rb") as f:
+        h.update(f.read())
+    return h.hexdigest()
+
+
+def lz77(data):
+    """compresses data the way the BIOS LZ77UnComp calls expect: a header word
+    with the size in its top 24 bits, then blocks of a flag byte and 8 units,
+    a literal byte for each 0 bit and for each 1 bit a copy of 3 to 18 bytes
+    from up to 4096 bytes back - never from 1 byte back, which the VRAM
+    version can't do as it writes halfwords"""
+    out = bytearray(struct.pack("<I", (len(data) << 8) | 0x10))
+    starts = {}
+    pos = 0
+    while pos < len(data):
+        flags = len(out)
+        out.append(0)
+        for bit in range(8):
+            if pos >= len(data):
+                break
+            best, distance = 0, 0
+            for start in reversed(starts.get(data[pos:pos + 3], [])):
+                if pos - start > 4096:
+                    break
+                if pos - start < 2:
+                    continue
+                length = 3
+                while length < 18 and pos + length < len(data) and data[start + length] == data[pos + length]:
+                    length += 1
+                if length > best:
+                    best, distance = length, pos - start
+                    if length == 18:
+                        break
+            if best:
+                out[flags] |= 0x80 >> bit
+                out += bytes((((best - 3) << 4) | ((distance - 1) >> 8), (distance - 1) & 0xff))
+            else:
+                out.append(data[pos])
+                best = 1
+            for p in range(pos, pos + best):
+                starts.setdefault(data[p:p + 3], []).append(p)
+            pos += best
+    while len(out) % 4:
+        out.append(0)
+    return bytes(out)
+
+
+def convert(asset):
+    """runs in a worker process, returns the asset's defines, arrays and any C
+    for its header, with the arrays compressed if the asset asks for it"""
+    name = asset_name(asset)
+    result = CONVERTERS[asset["kind"]](asset["source"], name, asset["options"])
+    defines, arrays = result[:2]
+    code = result[2] if len(result) > 2 else ""
+    compression = COMPRESSION_LZ77 if "lz77" in asset["options"] else COMPRESSION_NONE
+    if compression == COMPRESSION_LZ77:
+        arrays = [(kind, symbol, type, lz77(data)) for kind, symbol, type, data in arrays]
+    return defines, [(kind, symbol, type, compression, data) for kind, symbol, type, data in arrays], code
+
+
+def fnv1a(name):
+    """the hash entries are found by, the same as asset_hash() in metroid.c"""
+    h = 0x811c9dc5
+    for c in name.encode():
+        h = ((h ^ c) * 0x01000193) & 0xffffffff
+    return h
+
+
+def asset_macro(symbol):
+    return "ASSET_" + symbol.upper()
+
+
+def header(asset, defines, arrays, code):
+    """the asset's header, declaring the arrays which can be used in place"""
+    name = asset_name(asset)
+    out = ["/* %s\n * generated by tools/assets.py from %s, the data is in the asset pack */\n\n"
+           % (os.path.basename(asset["output"]), asset["source"])]
+    for define, value in defines:
+        out.append("#define %s_%s %d\n" % (name, define, value))
+    out.append("\n")
+    for kind, symbol, _, compression, _ in arrays:
+        if compression == COMPRESSION_NONE:
+            out.append("extern const %s %s [];\n" % (kind, symbol))
+        else:
+            out.append("/* %s is compressed, load it with asset_load(%s, dest) */\n"
+                       % (symbol, asset_macro(symbol)))
+    out.append(code)
+    return "".join(out).encode()
+
+
+def pack(arrays):
+    """the asset pack: a magic word and the number of entries, the entries
+    sorted by the hash of their names, then the data, identical data stored once
+
+    each entry is its hash, the offset of its data from the start of the pack,
+    the size of the data as stored, and a byte each for its type, compression
+    and alignment (as a power of 2)"""
+    entries = sorted(arrays, key=lambda a: fnv1a(a[1]))
+    for first, second in zip(entries, entries[1:]):
+        if fnv1a(first[1]) == fnv1a(second[1]):
+            raise AssetError("%s and %s have the same hash" % (first[1], second[1]))
+
+    data = bytearray()
+    offsets = {}
+    index = []
+    symbols = []
+    start = 8 + len(entries) * 16
+    for _, symbol, type, compression, contents in entries:
+        key = (compression, contents)
+        if key in offsets:
+            print("%s is the same as %s, stored once" % (symbol, offsets[key][1]))
+        else:
+            while (start + len(data)) % (1 << ALIGN):
+                data.append(0)
+            offsets[key] = (start + len(data), symbol)
+            data += contents
+        offset = offsets[key][0]
+        index.append(struct.pack("<IIIBBBB", fnv1a(symbol), offset, len(contents), type, compression, ALIGN, 0))
+        if compression == COMPRESSION_NONE:
+            symbols.append((symbol, offset))
+
+    return struct.pack("<II", PACK_MAGIC, len(entries)) + b"".join(index) + bytes(data), symbols
+
+
+def assembly(symbols):
+    """assets.s, which links the pack into the ROM, and gives the arrays which
+    are stored uncompressed their own names within it"""
+    out = ["/* assets.s */\n"
+           "/* generated by tools/assets.py from assets.txt */\n\n"
+           "/* the pack and everything in it start on a word so they can be copied with 32 bit DMA */\n"
+           "/* (no @ comments, so the host build can assemble it too) */\n"
+           ".section .rodata\n"
+           ".balign 4\n"
+           ".global asset_pack\n"
+           ".type asset_pack,%%object\n"
+           "asset_pack:\n"
+           "\t.incbin \"%s\"\n"
+           ".size asset_pack,.-asset_pack\n\n" % PACK]
+    for symbol, offset in symbols:
+        out.append(".global %s\n.set %s,asset_pack+%d\n" % (symbol, symbol, offset))
+    out.append("\n/* nothing here runs from the stack, without this the host linker makes it executable */\n"
+               ".section .note.GNU-stack,\"\",%progbits\n")
+    return "".join(out).encode()
+
+
+def hashes(arrays):
+    """assets.h, the hashes to find each array in the pack by"""
+    out = ["/* assets.h\n * generated by tools/assets.py, the names of the entries in the asset pack */\n\n"]
+    for _, symbol, _, _, _ in arrays:
+        out.append("#define %s 0x%08x\n" % (asset_macro(symbol), fnv1a(symbol)))
+    return "".join(out).encode()
+
+
+def update(path, contents, check):
+    """write a file if its contents changed, returns whether it was out of date"""
+    try:
+        with open(path, "rb") as f:
+            if f.read() == contents:
+                return False
+    except OSError:
+        pass
+    if check:
+        print("%s is out of date" % path)
+    else:
+        print("wrote %s" % path)
+        if os.path.dirname(path):
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "wb") as f:
+            f.write(contents)
+    return True
+
+
+def main():
+    args = sys.argv[1:]
+    jobs = os.cpu_count()
+    force = check = False
+    manifest = "assets.txt"
+    wanted = []
+
+    i = 0
+    while i < len(args):
+        if args[i] == "-j" and i + 1 < len(args):
+            jobs = int(args[i + 1])
+            i += 1
+        elif args[i] == "--manifest" and i + 1 < len(args):
+            manifest = args[i + 1]
+            i += 1
+        elif args[i] == "--force":
+            force = True
+        elif args[i] == "--check":
+            check = True
+        elif args[i].startswith("-"):
+            print("usage: %s [-j JOBS] [--force] [--check] [--manifest FILE] [OUTPUT ...]"
+                  % sys.argv[0], file=sys.stderr)
+            sys.exit(1)
+        else:
+            wanted.append(os.path.normpath(args[i]))
+        i += 1
+
+    # paths in the manifest are relative to it
+    os.chdir(os.path.dirname(os.path.abspath(manifest)))
+    try:
+        assets = read_manifest(os.path.basename(manifest))
+    except (AssetError, OSError) as error:
+        print(error, file=sys.stderr)
+        sys.exit(1)
+    unknown = [output for output in wanted if output not in [os.path.normpath(a["output"]) for a in assets]]
+    if unknown:
+        print("%s is not in %s" % (unknown[0], manifest), file=sys.stderr)
+        sys.exit(1)
+    chosen = [a for a in assets if not wanted or os.path.normpath(a["output"]) in wanted]
+
+    # find what is already cached, and convert the rest in parallel
+    results = {}
+    pending = []
+    for asset in assets:
+        asset["key"] = cache_key(asset)
+        cached = os.path.join(CACHE, asset["key"])
+        if not (force and asset in chosen) and os.path.exists(cached):
+            with open(cached, "rb") as f:
+                results[asset["output"]] = pickle.load(f)
+        else:
+            pending.append(asset)
+
+    if pending:
+        failed = False
+        with concurrent.futures.ProcessPoolExecutor(max_workers=max(1, jobs)) as pool:
+            futures = {pool.submit(convert, asset): asset for asset in pending}
+            for future in concurrent.futures.as_completed(futures):
+                asset = futures[future]
+                try:
+                    result = future.result()
+                except (AssetError, OSError, ValueError) as error:
+                    print("%s: %s" % (asset["source"], error), file=sys.stderr)
+                    failed = True
+                    continue
+                print("converted %s" % asset["output"])
+                results[asset["output"]] = result
+                if check:
+                    continue
+                os.makedirs(CACHE, exist_ok=True)
+                cached = os.path.join(CACHE, asset["key"])
+                with open(cached + ".tmp", "wb") as f:
+                    pickle.dump(result, f)
+                os.replace(cached + ".tmp", cached)
+        if failed:
+            sys.exit(1)
+
+    # the pack is put together from every asset each time, which is quick,
+    # and only files whose contents changed are touched
+    arrays = [array for asset in assets for array in results[asset["output"]][1]]
+    try:
+        contents, symbols = pack(arrays)
+    except AssetError as error:
+        print(error, file=sys.stderr)
+        sys.exit(1)
+
+    stale = False
+    for asset in chosen:
+        stale = update(asset["output"], header(asset, *results[asset["output"]]), check) or stale
+    stale = update(PACK, contents, check) or stale
+    stale = update(ASSEMBLY, assembly(symbols), check) or stale
+    stale = update(HASHES, hashes(arrays), check) or stale
+
+    if check and stale:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
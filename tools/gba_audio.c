@@ -0,0 +1,294 @@
+/*
+ * gba_audio.c
+ * simulation of the direct sound hardware for the host build
+ *
+ * each direct sound channel has a 32 byte FIFO which loses a sample every
+ * time its timer overflows, and when it is down to 16 bytes or fewer its DMA
+ * channel (set to the special sound timing) moves 4 more words into it
+ * the game restarts the DMA on a fresh buffer every vblank and says how long
+ * that buffer is, so by counting the bytes DMA read from each buffer we can
+ * tell when it ran past the end (samples repeated or garbage) or was cut off
+ * early (samples dropped), and the FIFO itself can run dry or overflow
+ * the timers are run up to the cycle the host says the restart happened at,
+ * so a restart which comes later in vblank one frame than the next shows up
+ * as lost samples just as it would on the hardware
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "gba_host.h"
+#include "gba_audio.h"
+
+#define IO16(offset) (*(volatile uint16_t*) ((uintptr_t) HOST_IO + (offset)))
+#define IO32(offset) (*(volatile uint32_t*) ((uintptr_t) HOST_IO + (offset)))
+
+/* the registers the simulation reads */
+#define REG_SOUNDCNT_H 0x082
+#define REG_SOUNDCNT_X 0x084
+#define REG_FIFO_A 0x0a0
+#define REG_FIFO_B 0x0a4
+#define REG_DMA0 0x0b0
+#define REG_TM0CNT_L 0x100
+#define REG_TM0CNT_H 0x102
+#define REG_TM1CNT_L 0x104
+#define REG_TM1CNT_H 0x106
+
+#define FIFO_SIZE 32
+
+/* one direct sound channel: its FIFO, and the DMA which feeds it */
+struct Fifo {
+    int8_t data[FIFO_SIZE];
+    int head, count;
+
+    /* the sample playing now, which carries on if the FIFO runs dry */
+    int8_t output;
+
+    /* where the DMA reads next, how much it has read from this buffer and how long the game said it was */
+    uintptr_t source;
+    int fetched;
+    int length;
+    int dma_channel;
+};
+
+static struct Fifo fifos[2];
+
+/* the counts reported at the end */
+static long samples_played = 0;
+static long underruns = 0;
+static long overflows = 0;
+static long dropped = 0;
+static long duplicated = 0;
+static long dma_restarts = 0;
+
+/* cycles left over from the last run, for each timer, and the cycle the
+ * sound has been played up to */
+static long timer_cycles[2];
+static long audio_clock = 0;
+
+/* the WAV file being written */
+static FILE* wav = NULL;
+static long wav_frames = 0;
+static int wav_rate = 0;
+
+/* time spent in the game's profiled audio code */
+static struct timespec profile_started;
+static long profile_sections = 0;
+static double profile_total = 0;
+static unsigned int profile_peak = 0;
+
+static void put16(FILE* file, uint16_t value) {
+    fputc(value & 0xff, file);
+    fputc(value >> 8, file);
+}
+
+static void put32(FILE* file, uint32_t value) {
+    put16(file, value & 0xffff);
+    put16(file, value >> 16);
+}
+
+/* the header, with the sizes filled in once the length is known */
+static void write_wav_header(int rate, long frames) {
+    uint32_t bytes = frames * 4;
+    fwrite("RIFF", 1, 4, wav);
+    put32(wav, 36 + bytes);
+    fwrite("WAVEfmt ", 1, 8, wav);
+    put32(wav, 16);
+    put16(wav, 1);
+    put16(wav, 2);
+    put32(wav, rate);
+    put32(wav, rate * 4);
+    put16(wav, 4);
+    put16(wav, 16);
+    fwrite("data", 1, 4, wav);
+    put32(wav, bytes);
+}
+
+int audio_open_wav(const char* path) {
+    wav = fopen(path, "wb");
+    if (!wav) {
+        return -1;
+    }
+    write_wav_header(0, 0);
+    return 0;
+}
+
+/* move 4 words into a FIFO if it is low and its DMA is running */
+static void fifo_refill(struct Fifo* fifo) {
+    unsigned int base = REG_DMA0 + fifo->dma_channel * 12;
+    uint32_t control = IO32(base + 8);
+    int timing = (control >> 28) & 3;
+
+    if (fifo->count > 16 || !(control & 0x80000000) || timing != 3 || !fifo->source) {
+        return;
+    }
+
+    for (int i = 0; i < 16; i++) {
+        if (fifo->count == FIFO_SIZE) {
+            overflows++;
+            break;
+        }
+        fifo->data[(fifo->head + fifo->count) % FIFO_SIZE] = *(const int8_t*) (fifo->source + i);
+        fifo->count++;
+    }
+    fifo->source += 16;
+    fifo->fetched += 16;
+}
+
+/* play one sample from a FIFO */
+static void fifo_pop(struct Fifo* fifo) {
+    if (fifo->count == 0) {
+        underruns++;
+    } else {
+        fifo->output = fifo->data[fifo->head];
+        fifo->head = (fifo->head + 1) % FIFO_SIZE;
+        fifo->count--;
+    }
+    fifo_refill(fifo);
+}
+
+/* the cycles between overflows of a timer, or 0 if it is off */
+static int timer_period(int timer) {
+    uint16_t control = IO16(timer ? REG_TM1CNT_H : REG_TM0CNT_H);
+    static const int prescale[4] = {1, 64, 256, 1024};
+    if (!(control & 0x80) || (control & 0x4)) {
+        return 0;
+    }
+    return (65536 - IO16(timer ? REG_TM1CNT_L : REG_TM0CNT_L)) * prescale[control & 3];
+}
+
+void audio_run_until(long cycle) {
+    uint16_t control = IO16(REG_SOUNDCNT_H);
+    long cycles = cycle - audio_clock;
+
+    if (cycles <= 0) {
+        return;
+    }
+    audio_clock = cycle;
+
+    if (!(IO16(REG_SOUNDCNT_X) & 0x80)) {
+        return;
+    }
+
+    /* the FIFO reset bits empty the FIFOs (they always read back as 0) */
+    for (int channel = 0; channel < 2; channel++) {
+        uint16_t reset = channel ? 0x8000 : 0x0800;
+        if (control & reset) {
+            fifos[channel].head = fifos[channel].count = 0;
+            control &= ~reset;
+        }
+    }
+    IO16(REG_SOUNDCNT_H) = control;
+
+    /* channel A uses timer 1 if bit 10 is set, channel B if bit 14 is */
+    int timers[2] = {(control >> 10) & 1, (control >> 14) & 1};
+    int period = timer_period(timers[0]);
+    if (period == 0) {
+        return;
+    }
+    if (wav && wav_rate == 0) {
+        wav_rate = 16777216 / period;
+    }
+
+    /* both channels are run off the first channel's timer, which is all the game needs */
+    timer_cycles[timers[0]] += cycles;
+    while (timer_cycles[timers[0]] >= period) {
+        timer_cycles[timers[0]] -= period;
+
+        for (int channel = 0; channel < 2; channel++) {
+            if (timers[channel] == timers[0]) {
+                fifo_pop(&fifos[channel]);
+            }
+        }
+        samples_played++;
+
+        if (wav) {
+            /* bits 8/9 send A to the right/left, 12/13 do the same for B
+             * and bits 2/3 play A/B at full rather than half volume */
+            int left = 0, right = 0;
+            for (int channel = 0; channel < 2; channel++) {
+                int sample = fifos[channel].output * ((control >> (2 + channel)) & 1 ? 256 : 128);
+                if (control & (0x100 << (channel * 4))) {
+                    right += sample;
+                }
+                if (control & (0x200 << (channel * 4))) {
+                    left += sample;
+                }
+            }
+            left = left < -32768 ? -32768 : left > 32767 ? 32767 : left;
+            right = right < -32768 ? -32768 : right > 32767 ? 32767 : right;
+            put16(wav, (uint16_t) left);
+            put16(wav, (uint16_t) right);
+            wav_frames++;
+        }
+    }
+}
+
+void audio_dma_started(int channel, int length) {
+    unsigned int base = REG_DMA0 + channel * 12;
+    uint32_t dest = IO32(base + 4);
+    struct Fifo* fifo = dest == HOST_IO + REG_FIFO_A ? &fifos[0] : dest == HOST_IO + REG_FIFO_B ? &fifos[1] : NULL;
+
+    if (!fifo) {
+        return;
+    }
+
+    /* see how much of the last buffer was played */
+    if (fifo->source && fifo->length) {
+        if (fifo->fetched > fifo->length) {
+            duplicated += fifo->fetched - fifo->length;
+        } else {
+            dropped += fifo->length - fifo->fetched;
+        }
+    }
+
+    /* the DMA latches its source when it is switched on */
+    fifo->dma_channel = channel;
+    fifo->source = IO32(base);
+    fifo->fetched = 0;
+    fifo->length = length;
+    dma_restarts++;
+
+    /* it starts filling straight away if the FIFO is low */
+    fifo_refill(fifo);
+}
+
+long audio_samples_lost(void) {
+    return dropped + duplicated;
+}
+
+void audio_profile_start(void) {
+    clock_gettime(CLOCK_MONOTONIC, &profile_started);
+}
+
+unsigned int audio_profile_stop(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    unsigned int ns = (now.tv_sec - profile_started.tv_sec) * 1000000000L + (now.tv_nsec - profile_started.tv_nsec);
+
+    profile_sections++;
+    profile_total += ns;
+    if (ns > profile_peak) {
+        profile_peak = ns;
+    }
+    return ns;
+}
+
+void audio_report(FILE* out) {
+    fprintf(out, "audio: %ld samples played, %ld DMA restarts\n", samples_played, dma_restarts);
+    fprintf(out, "audio: %ld dropped, %ld duplicated, %ld FIFO underruns, %ld FIFO overflows\n",
+            dropped, duplicated, underruns, overflows);
+    if (profile_sections) {
+        fprintf(out, "audio: mixing took %.0f ns a frame on average, %u ns at most (%ld frames)\n",
+                profile_total / profile_sections, profile_peak, profile_sections);
+    }
+}
+
+void audio_close(void) {
+    if (wav) {
+        fseek(wav, 0, SEEK_SET);
+        write_wav_header(wav_rate, wav_frames);
+        fclose(wav);
+        wav = NULL;
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * gba_audio.h
+ * simulation of the direct sound hardware for the host build
+ *
+ * timer 0 is run up to the cycle the host asks for, each overflow
+ * playing a sample from the FIFOs of the direct sound channels which use it,
+ * and the sound DMA channels refill the FIFOs 16 bytes at a time from where
+ * the game pointed them, the way the hardware does - what comes out can be
+ * written to a WAV file, and any samples the game's buffers lost or repeated
+ * are counted (the PSG channels aren't simulated)
+ */
+#ifndef GBA_AUDIO_H
+#define GBA_AUDIO_H
+
+#include <stdio.h>
+
+/* write what is played to a 16 bit stereo WAV file, returns -1 if it can't be opened */
+int audio_open_wav(const char* path);
+
+/* play up to a cycle counted from the start, the host calls this at each
+ * vblank and again just before each sound DMA restart */
+void audio_run_until(long cycle);
+
+/* the game has restarted a sound DMA channel on a buffer of length bytes */
+void audio_dma_started(int channel, int length);
+
+/* the samples dropped or repeated at buffer swaps so far */
+long audio_samples_lost(void);
+
+/* time a section of the game's audio code, in nanoseconds */
+void audio_profile_start(void);
+unsigned int audio_profile_stop(void);
+
+/* print what happened, and finish the WAV file */
+void audio_report(FILE* out);
+void audio_close(void);
+
+#endif
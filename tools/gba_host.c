@@ -0,0 +1,448 @@
+/*
+ * gba_host.c
+ * runs metroid.c as a headless Linux program and captures what it draws
+ *
+ * usage: metroid_host [options]
+ *   --replay FILE   input to feed the game, see below (default: no buttons)
+ *   --frames N      stop after N frames (default 600)
+ *   --dump DIR      write the rendered frames into DIR
+ *   --every K       only dump every Kth frame (default 1)
+ *   --png           dump PNG images instead of PPM
+ *   --checksums     print a CRC of every rendered frame, for diffing runs
+ *   --bench N       at the end, render the last frame N times and report speed
+ *   --wav FILE      simulate the direct sound hardware and write what it plays to FILE
+ *   --audio-stats   simulate the sound and report lost or repeated samples and
+ *                   the time spent mixing each frame
+ *
+ * a replay file has one line per run of frames: a frame count followed by the
+ * buttons held for those frames, or '-' for none, e.g.
+ *   30 -
+ *   2 START
+ *   120 RIGHT B
+ * lines starting with '#' are comments, and after the last line no buttons are held
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "gba_host.h"
+#include "gba_render.h"
+#include "gba_audio.h"
+
+/* metroid.c renames its main to this in the host build */
+int game_main(void);
+
+#define IO16(offset) (*(volatile uint16_t*) ((uintptr_t) HOST_IO + (offset)))
+#define IO32(offset) (*(volatile uint32_t*) ((uintptr_t) HOST_IO + (offset)))
+
+/* the register offsets the host has to act on */
+#define REG_DISPSTAT 0x004
+#define REG_VCOUNT 0x006
+#define REG_DMA0 0x0b0
+#define REG_KEYINPUT 0x130
+#define REG_IE 0x200
+#define REG_IF 0x202
+#define REG_IME 0x208
+
+/* the BIOS jumps through this word when an interrupt happens */
+#define INTERRUPT_VECTOR 0x3007ffc
+
+/* the BIOS keeps its own copy of the interrupt flags here for IntrWait */
+#define BIOS_IF 0x3007ff8
+
+/* a frame is 228 lines of 1232 cycles, vblank starts after the first 160 */
+#define FRAME_CYCLES 280896
+#define VBLANK_START 197120
+
+/* the cycles from the start of the interrupt to the game's handler */
+#define IRQ_ENTRY_CYCLES 100
+
+/* what to do with the frames */
+static const char* dump_dir = NULL;
+static int dump_every = 1;
+static int dump_png = 0;
+static int print_checksums = 0;
+static int bench_frames = 0;
+static int max_frames = 600;
+static int audio_enabled = 0;
+static int audio_stats = 0;
+
+static int frame = 0;
+static uint32_t framebuffer[RENDER_WIDTH * RENDER_HEIGHT];
+
+/* the cycle the current vblank started at, and the cycles the DMA
+ * transfers have taken since then */
+static long vblank_cycle = 0;
+static long vblank_elapsed = 0;
+static int vblanks = 0;
+
+/* the replay being played back */
+static FILE* replay = NULL;
+static int replay_run = 0;
+static uint16_t replay_keys = 0;
+
+/* stand-ins for the ARM assembly helpers and BIOS calls the game links with */
+int calc_offset(int offset, int tileWidth) {
+    return offset + (tileWidth == 64 ? 0x800 : 0x400);
+}
+
+int get_index(int row, int col) {
+    return row * 32 + col;
+}
+
+/* the BIOS CpuSet and CpuFastSet calls: the low 21 bits of mode are the
+ * number of units, bit 24 fills with the first unit of source rather than
+ * copying and bit 26 makes the units words (CpuFastSet always uses words,
+ * and rounds the count up to a multiple of 8) */
+static void bios_set(const void* source, void* dest, unsigned int mode, int fast) {
+    unsigned int count = mode & 0x1fffff;
+    int fill = (mode & 0x1000000) != 0;
+    int words = fast || (mode & 0x4000000);
+
+    if (fast) {
+        count = (count + 7) & ~7u;
+    }
+
+    for (unsigned int i = 0; i < count; i++) {
+        unsigned int from = fill ? 0 : i;
+        if (words) {
+            ((volatile uint32_t*) dest)[i] = ((const volatile uint32_t*) source)[from];
+        } else {
+            ((volatile uint16_t*) dest)[i] = ((const volatile uint16_t*) source)[from];
+        }
+    }
+}
+
+void cpu_set(const void* source, void* dest, unsigned int mode) {
+    bios_set(source, dest, mode, 0);
+}
+
+void cpu_fast_set(const void* source, void* dest, unsigned int mode) {
+    bios_set(source, dest, mode, 1);
+}
+
+/* the BIOS LZ77UnCompWram and LZ77UnCompVram calls: a header word with the
+ * size in its top 24 bits, then blocks of a flag byte and 8 units, a literal
+ * byte for each 0 bit and for each 1 bit a copy of 3 to 18 bytes from up to
+ * 4096 bytes back (the VRAM call writes halfwords, which comes to the same
+ * thing here) */
+static void bios_lz77(const void* source, void* dest) {
+    const uint8_t* in = source;
+    uint8_t* out = dest;
+    uint32_t size = (in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t) in[3] << 24)) >> 8;
+    uint32_t written = 0;
+
+    in += 4;
+    while (written < size) {
+        uint8_t flags = *in++;
+        for (int bit = 0; bit < 8 && written < size; bit++) {
+            if (flags & (0x80 >> bit)) {
+                int length = (in[0] >> 4) + 3;
+                int distance = (((in[0] & 0xf) << 8) | in[1]) + 1;
+                in += 2;
+                for (int i = 0; i < length && written < size; i++, written++) {
+                    out[written] = out[written - distance];
+                }
+            } else {
+                out[written++] = *in++;
+            }
+        }
+    }
+}
+
+void lz77_uncomp_wram(const void* source, void* dest) {
+    bios_lz77(source, dest);
+}
+
+void lz77_uncomp_vram(const void* source, void* dest) {
+    bios_lz77(source, dest);
+}
+
+/* the game's interrupt handlers, indexed by source (see irq.s) */
+extern void (*irq_table[])(void);
+
+/* the dispatcher from irq.s: acknowledge the lowest enabled pending interrupt
+ * in IF and the BIOS copy of it, then call its handler
+ * the host only raises interrupts between frames so nothing can nest */
+void irq_dispatch(void) {
+    uint16_t pending = IO16(REG_IE) & IO16(REG_IF);
+
+    for (int source = 0; source < 14; source++) {
+        uint16_t bit = 1 << source;
+        if (pending & bit) {
+            IO16(REG_IF) &= ~bit;
+            *(volatile uint16_t*) BIOS_IF |= bit;
+            if (irq_table[source]) {
+                irq_table[source]();
+            }
+            return;
+        }
+    }
+}
+
+/* put plain memory at each of the addresses the game uses for hardware */
+static void map_memory(void) {
+    static const struct {
+        unsigned long start, size;
+    } regions[] = {
+        {HOST_EWRAM, HOST_EWRAM_SIZE},
+        {HOST_IWRAM, HOST_IWRAM_SIZE},
+        {HOST_IO, HOST_IO_SIZE},
+        {HOST_PALETTE, HOST_PALETTE_SIZE},
+        {HOST_VRAM, HOST_VRAM_SIZE},
+        {HOST_OAM, HOST_OAM_SIZE},
+    };
+
+    for (size_t i = 0; i < sizeof(regions) / sizeof(regions[0]); i++) {
+        void* address = mmap((void*) regions[i].start, regions[i].size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (address != (void*) regions[i].start) {
+            fprintf(stderr, "could not map GBA memory at 0x%lx (link with -no-pie)\n", regions[i].start);
+            exit(1);
+        }
+    }
+
+    /* no buttons are held, which reads as all ones */
+    IO16(REG_KEYINPUT) = 0x3ff;
+}
+
+/* the names used for buttons in replay files, in register bit order */
+static const char* button_names[] = {
+    "A", "B", "SELECT", "START", "RIGHT", "LEFT", "UP", "DOWN", "R", "L"
+};
+
+/* the buttons held for the next frame of the replay */
+static uint16_t replay_next(void) {
+    char text[256];
+
+    while (replay_run == 0) {
+        if (!replay || !fgets(text, sizeof(text), replay)) {
+            return 0;
+        }
+        if (text[0] == '#') {
+            continue;
+        }
+
+        char* token = strtok(text, " \t\r\n");
+        if (!token) {
+            continue;
+        }
+        replay_run = atoi(token);
+        replay_keys = 0;
+        while ((token = strtok(NULL, " \t\r\n"))) {
+            for (int i = 0; i < 10; i++) {
+                if (strcmp(token, button_names[i]) == 0) {
+                    replay_keys |= 1 << i;
+                }
+            }
+        }
+    }
+
+    replay_run--;
+    return replay_keys;
+}
+
+/* render the final picture over and over to time the renderer */
+static void run_benchmark(void) {
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < bench_frames; i++) {
+        render_frame(framebuffer);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("rendered %d frames in %.3f s: %.0f frames/s, %.1f us/frame\n", bench_frames, seconds,
+            bench_frames / seconds, seconds * 1e6 / bench_frames);
+}
+
+/* the game's hooks into the sound simulation */
+void host_sound_dma(int channel, int length) {
+    if (audio_enabled) {
+        audio_run_until(vblank_cycle + vblank_elapsed);
+        audio_dma_started(channel, length);
+    }
+}
+
+void host_profile_start(void) {
+    audio_profile_start();
+}
+
+unsigned int host_profile_stop(void) {
+    return audio_profile_stop();
+}
+
+void host_vblank_start(void) {
+    vblank_cycle = (long) vblanks * FRAME_CYCLES + VBLANK_START;
+    vblank_elapsed = IRQ_ENTRY_CYCLES;
+    vblanks++;
+
+    /* play the sound of the frame which just ended */
+    if (audio_enabled) {
+        audio_run_until(vblank_cycle);
+    }
+}
+
+/* the end of a frame: capture it, then run vblank with the next input */
+void host_wait_vblank(void) {
+    if (dump_dir || print_checksums || bench_frames) {
+        render_frame(framebuffer);
+    }
+
+    if (print_checksums) {
+        printf("%05d %08x\n", frame, render_checksum(framebuffer));
+    }
+
+    if (dump_dir && frame % dump_every == 0) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/frame_%05d.%s", dump_dir, frame, dump_png ? "png" : "ppm");
+        if ((dump_png ? render_write_png(path, framebuffer) : render_write_ppm(path, framebuffer)) != 0) {
+            fprintf(stderr, "could not write %s\n", path);
+            exit(1);
+        }
+    }
+
+    frame++;
+    if (frame >= max_frames) {
+        if (bench_frames) {
+            run_benchmark();
+        }
+        if (audio_stats) {
+            audio_report(stdout);
+        }
+        audio_close();
+        exit(0);
+    }
+
+    host_vblank_start();
+
+    /* the key register is active low */
+    IO16(REG_KEYINPUT) = ~replay_next() & 0x3ff;
+    IO16(REG_VCOUNT) = 160;
+
+    /* raise the vblank interrupt if the game has switched it on */
+    uint32_t handler = *(volatile uint32_t*) INTERRUPT_VECTOR;
+    if ((IO16(REG_IME) & 1) && (IO16(REG_IE) & 1) && (IO16(REG_DISPSTAT) & 0x08) && handler) {
+        IO16(REG_IF) |= 1;
+        ((void (*)(void)) (uintptr_t) handler)();
+    }
+}
+
+/* the cycles it takes DMA to read or write a unit at an address, going by
+ * the width of each memory's bus and its wait states (ROM is sequential) */
+static int access_cycles(uintptr_t address, int unit) {
+    switch (address >> 24) {
+        case HOST_IWRAM >> 24:
+        case HOST_IO >> 24:
+        case HOST_OAM >> 24:
+            return 1;
+        case HOST_PALETTE >> 24:
+        case HOST_VRAM >> 24:
+            return unit == 4 ? 2 : 1;
+        default:
+            /* EWRAM, and the ROM which the game's constant data is in on the host */
+            return unit == 4 ? 6 : 3;
+    }
+}
+
+/* perform the transfer programmed into a DMA channel
+ * only immediate transfers are done here, the sound channels
+ * which are synced to the FIFOs are left alone */
+void host_dma(int channel) {
+    unsigned int base = REG_DMA0 + channel * 12;
+    uint32_t control = IO32(base + 8);
+    int timing = (control >> 28) & 3;
+    if (!(control & 0x80000000) || timing != 0) {
+        return;
+    }
+
+    uintptr_t source = IO32(base);
+    uintptr_t dest = IO32(base + 4);
+    unsigned int count = control & 0xffff;
+    if (count == 0) {
+        count = channel == 3 ? 0x10000 : 0x4000;
+    }
+
+    /* 0: increment, 1: decrement, 2: fixed (3 is increment with reload for dest) */
+    int dest_mode = (control >> 21) & 3;
+    int source_mode = (control >> 23) & 3;
+    int unit = (control & 0x04000000) ? 4 : 2;
+    int dest_step = dest_mode == 1 ? -unit : dest_mode == 2 ? 0 : unit;
+    int source_step = source_mode == 1 ? -unit : source_mode == 2 ? 0 : unit;
+
+    /* the CPU is stopped while it runs */
+    vblank_elapsed += 2 + count * (access_cycles(source, unit) + access_cycles(dest, unit));
+
+    for (unsigned int i = 0; i < count; i++) {
+        if (unit == 4) {
+            *(volatile uint32_t*) dest = *(const volatile uint32_t*) source;
+        } else {
+            *(volatile uint16_t*) dest = *(const volatile uint16_t*) source;
+        }
+        dest += dest_step;
+        source += source_step;
+    }
+
+    /* the enable bit clears once an immediate transfer is done */
+    IO32(base + 8) = control & ~0x80000000;
+}
+
+void host_init(int audio) {
+    map_memory();
+    audio_enabled = audio;
+}
+
+#ifndef HOST_TEST
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        const char* option = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(option, "--png") == 0) {
+            dump_png = 1;
+        } else if (strcmp(option, "--checksums") == 0) {
+            print_checksums = 1;
+        } else if (strcmp(option, "--audio-stats") == 0) {
+            audio_enabled = 1;
+            audio_stats = 1;
+        } else if (value && strcmp(option, "--wav") == 0) {
+            if (audio_open_wav(value) != 0) {
+                fprintf(stderr, "could not open %s\n", value);
+                return 1;
+            }
+            audio_enabled = 1;
+            i++;
+        } else if (value && strcmp(option, "--replay") == 0) {
+            replay = fopen(value, "r");
+            if (!replay) {
+                fprintf(stderr, "could not open %s\n", value);
+                return 1;
+            }
+            i++;
+        } else if (value && strcmp(option, "--frames") == 0) {
+            max_frames = atoi(value);
+            i++;
+        } else if (value && strcmp(option, "--dump") == 0) {
+            dump_dir = value;
+            i++;
+        } else if (value && strcmp(option, "--every") == 0) {
+            dump_every = atoi(value) > 0 ? atoi(value) : 1;
+            i++;
+        } else if (value && strcmp(option, "--bench") == 0) {
+            bench_frames = atoi(value);
+            i++;
+        } else {
+            fprintf(stderr, "usage: %s [--replay FILE] [--frames N] [--dump DIR] [--every K] [--png]"
+                    " [--checksums] [--bench N] [--wav FILE] [--audio-stats]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    host_init(audio_enabled);
+    game_main();
+    return 0;
+}
+#endif
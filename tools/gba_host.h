@@ -0,0 +1,54 @@
+/*
+ * gba_host.h
+ * hooks which let metroid.c run as a normal Linux program
+ *
+ * the game talks to the hardware through pointers to fixed addresses, so the
+ * host build maps plain memory at those same addresses and everything the game
+ * writes to VRAM, palette, OAM and the IO registers lands in host arrays
+ * the only things which cannot work that way are waiting for the screen and
+ * DMA (which the hardware does on its own), so the game calls these instead
+ */
+#ifndef GBA_HOST_H
+#define GBA_HOST_H
+
+/* the start and size of each GBA memory region mapped on the host */
+#define HOST_EWRAM 0x2000000
+#define HOST_EWRAM_SIZE 0x40000
+#define HOST_IWRAM 0x3000000
+#define HOST_IWRAM_SIZE 0x8000
+#define HOST_IO 0x4000000
+#define HOST_IO_SIZE 0x1000
+#define HOST_PALETTE 0x5000000
+#define HOST_PALETTE_SIZE 0x400
+#define HOST_VRAM 0x6000000
+#define HOST_VRAM_SIZE 0x18000
+#define HOST_OAM 0x7000000
+#define HOST_OAM_SIZE 0x400
+
+/* map the GBA memory, and simulate the sound if audio is set - main() does
+ * this, the tests (built with HOST_TEST, which leaves main() out) call it themselves */
+void host_init(int audio);
+
+/* called by wait_vblank(): finishes the frame, runs the vblank interrupt
+ * and loads the next frame of input */
+void host_wait_vblank(void);
+
+/* the start of vblank: play the sound up to it and start counting the
+ * cycles the interrupt takes, host_wait_vblank() calls this before running
+ * the interrupt, and the tests can call it and then the handler's parts */
+void host_vblank_start(void);
+
+/* performs the transfer programmed into one of the four DMA channels, and
+ * counts the cycles it would have taken */
+void host_dma(int channel);
+
+/* called when the game restarts a sound DMA channel on a buffer of length
+ * bytes, the hardware latches the source address at that point - which is
+ * as many cycles into vblank as the DMA transfers made since it started took */
+void host_sound_dma(int channel, int length);
+
+/* stand in for the cycle counting timers, timing in nanoseconds instead */
+void host_profile_start(void);
+unsigned int host_profile_stop(void);
+
+#endif
@@ -0,0 +1,504 @@
+/*
+ * gba_render.c
+ * reference renderer for tile mode 0 backgrounds and sprites
+ *
+ * the picture is built one scanline at a time like the hardware does it:
+ * each enabled background and the sprites are drawn into their own line of
+ * palette indices (0 meaning transparent), then the lines are stacked from
+ * the lowest priority to the highest and looked up in the palette
+ *
+ * supported: text backgrounds of every size in 16 and 256 colors with flips
+ * and scrolling, and regular sprites of all 12 sizes with flips, priority and
+ * both tile mappings - affine sprites are drawn without their transform, and
+ * windows, blending and mosaic are ignored since the game doesn't use them
+ */
+#include <stdio.h>
+#include <string.h>
+#include "gba_host.h"
+#include "gba_render.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* the regions of GBA memory the renderer reads */
+#define IO16(offset) (*(const uint16_t*) ((uintptr_t) HOST_IO + (offset)))
+#define VRAM ((const uint8_t*) HOST_VRAM)
+#define PALETTE ((const uint16_t*) HOST_PALETTE)
+#define OAM ((const uint16_t*) HOST_OAM)
+
+/* backgrounds can only use the first 64K of VRAM, sprites the last 32K */
+#define BG_VRAM_SIZE 0x10000
+#define OBJ_VRAM_OFFSET 0x10000
+#define OBJ_VRAM_SIZE 0x8000
+
+/* sprite widths and heights indexed by [shape][size] */
+static const int sprite_widths[3][4] = {
+    {8, 16, 32, 64},
+    {16, 32, 32, 64},
+    {8, 8, 16, 32}
+};
+static const int sprite_heights[3][4] = {
+    {8, 16, 32, 64},
+    {8, 8, 16, 32},
+    {16, 32, 32, 64}
+};
+
+/* one sprite which is switched on, decoded from OAM once per frame */
+struct RenderSprite {
+    int x, y;
+    int width, height;
+    int tile;
+    int priority;
+    int bpp8;
+    int hflip, vflip;
+    int palette_bank;
+};
+
+/* the line buffers, padded so a row of tiles can run past the right edge */
+static uint16_t bg_lines[4][RENDER_WIDTH];
+static uint16_t obj_line[RENDER_WIDTH];
+static uint16_t obj_priority[RENDER_WIDTH];
+static uint16_t line[RENDER_WIDTH];
+static uint16_t tile_row_buffer[256 + 16];
+
+/* draw one 8 pixel row of a background tile as palette indices */
+static inline void bg_tile_row(uint16_t* dest, uint16_t entry, unsigned int char_base, int bpp8, int y) {
+    unsigned int tile = entry & 0x3ff;
+    int hflip = entry & 0x400;
+
+    /* vertical flip just picks the mirrored row */
+    if (entry & 0x800) {
+        y = 7 - y;
+    }
+
+    if (bpp8) {
+        unsigned int address = char_base + tile * 64 + y * 8;
+        if (address + 8 > BG_VRAM_SIZE) {
+            memset(dest, 0, 8 * sizeof(uint16_t));
+            return;
+        }
+        const uint8_t* source = VRAM + address;
+#ifdef __SSE2__
+        /* widen the 8 bytes to 8 halfwords, index 0 stays 0 so transparency is free */
+        __m128i pixels = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) source), _mm_setzero_si128());
+        if (hflip) {
+            pixels = _mm_shufflelo_epi16(pixels, 0x1b);
+            pixels = _mm_shufflehi_epi16(pixels, 0x1b);
+            pixels = _mm_shuffle_epi32(pixels, 0x4e);
+        }
+        _mm_storeu_si128((__m128i*) dest, pixels);
+#else
+        for (int i = 0; i < 8; i++) {
+            dest[i] = source[hflip ? 7 - i : i];
+        }
+#endif
+    } else {
+        unsigned int address = char_base + tile * 32 + y * 4;
+        if (address + 4 > BG_VRAM_SIZE) {
+            memset(dest, 0, 8 * sizeof(uint16_t));
+            return;
+        }
+        const uint8_t* source = VRAM + address;
+        uint16_t bank = (entry >> 12) << 4;
+
+        /* the left pixel of each pair is in the low nibble */
+        for (int i = 0; i < 8; i++) {
+            int x = hflip ? 7 - i : i;
+            int pixel = (source[x >> 1] >> ((x & 1) * 4)) & 0xf;
+            dest[i] = pixel ? (bank | pixel) : 0;
+        }
+    }
+}
+
+/* draw one scanline of a text background */
+static void render_bg_line(int bg, int scanline, uint16_t* dest) {
+    uint16_t control = IO16(0x8 + 2 * bg);
+    int xscroll = IO16(0x10 + 4 * bg) & 0x1ff;
+    int yscroll = IO16(0x12 + 4 * bg) & 0x1ff;
+
+    unsigned int char_base = ((control >> 2) & 3) * 0x4000;
+    const uint16_t* screen_base = (const uint16_t*) (VRAM + ((control >> 8) & 31) * 0x800);
+    int bpp8 = (control >> 7) & 1;
+
+    /* sizes are 256x256, 512x256, 256x512 and 512x512 */
+    int wide = (control >> 14) & 1;
+    int tall = (control >> 15) & 1;
+    int width_mask = wide ? 511 : 255;
+    int height_mask = tall ? 511 : 255;
+
+    int y = (scanline + yscroll) & height_mask;
+    int tile_y = y >> 3;
+    int x = xscroll & width_mask;
+    int tile_x = x >> 3;
+
+    /* 31 tiles cover the 240 visible pixels plus up to 7 of fine scroll */
+    for (int i = 0; i < 31; i++) {
+        int column = (tile_x + i) & (width_mask >> 3);
+
+        /* the larger maps are 32x32 screen blocks placed side by side, then below */
+        int block = (column >> 5) + (tile_y >> 5) * (wide ? 2 : 1);
+        const uint16_t* entries = screen_base + block * 1024;
+        if ((const uint8_t*) (entries + 1024) > VRAM + BG_VRAM_SIZE) {
+            memset(tile_row_buffer + i * 8, 0, 8 * sizeof(uint16_t));
+            continue;
+        }
+
+        uint16_t entry = entries[(tile_y & 31) * 32 + (column & 31)];
+        bg_tile_row(tile_row_buffer + i * 8, entry, char_base, bpp8, y & 7);
+    }
+
+    memcpy(dest, tile_row_buffer + (x & 7), RENDER_WIDTH * sizeof(uint16_t));
+}
+
+/* decode OAM into the list of sprites which are switched on */
+static int decode_sprites(struct RenderSprite* list) {
+    int count = 0;
+
+    for (int i = 0; i < 128; i++) {
+        uint16_t attribute0 = OAM[i * 4];
+        uint16_t attribute1 = OAM[i * 4 + 1];
+        uint16_t attribute2 = OAM[i * 4 + 2];
+
+        int affine = attribute0 & 0x100;
+        int shape = (attribute0 >> 14) & 3;
+        int mode = (attribute0 >> 10) & 3;
+
+        /* skip sprites which are disabled, object window or prohibited shapes */
+        if ((!affine && (attribute0 & 0x200)) || mode >= 2 || shape == 3) {
+            continue;
+        }
+
+        struct RenderSprite* sprite = &list[count];
+        int size = (attribute1 >> 14) & 3;
+        sprite->width = sprite_widths[shape][size];
+        sprite->height = sprite_heights[shape][size];
+        sprite->x = attribute1 & 0x1ff;
+        sprite->y = attribute0 & 0xff;
+        sprite->tile = attribute2 & 0x3ff;
+        sprite->priority = (attribute2 >> 10) & 3;
+        sprite->palette_bank = (attribute2 >> 12) << 4;
+        sprite->bpp8 = (attribute0 >> 13) & 1;
+
+        if (affine) {
+            /* no transform, but double size sprites are still centred in their box */
+            sprite->hflip = sprite->vflip = 0;
+            if (attribute0 & 0x200) {
+                sprite->x += sprite->width / 2;
+                sprite->y += sprite->height / 2;
+            }
+        } else {
+            sprite->hflip = (attribute1 >> 12) & 1;
+            sprite->vflip = (attribute1 >> 13) & 1;
+        }
+
+        /* x is a 9 bit value which wraps around to the left edge */
+        if (sprite->x >= 256) {
+            sprite->x -= 512;
+        }
+        count++;
+    }
+    return count;
+}
+
+/* draw the sprites which touch one scanline */
+static void render_obj_line(const struct RenderSprite* list, int count, int scanline, int map_1d) {
+    uint16_t pixels[64];
+
+    memset(obj_line, 0, sizeof(obj_line));
+    memset(obj_priority, 0, sizeof(obj_priority));
+
+    /* lower OAM indices win ties, so go in order and only replace on a lower priority */
+    for (int i = 0; i < count; i++) {
+        const struct RenderSprite* sprite = &list[i];
+
+        /* y wraps around at 256 */
+        int row = (scanline - sprite->y) & 255;
+        if (row >= sprite->height || sprite->x >= RENDER_WIDTH || sprite->x + sprite->width <= 0) {
+            continue;
+        }
+        if (sprite->vflip) {
+            row = sprite->height - 1 - row;
+        }
+
+        /* work out where this row of tiles starts */
+        int tile_size = sprite->bpp8 ? 2 : 1;
+        int tiles_wide = sprite->width / 8;
+        int stride = map_1d ? tiles_wide * tile_size : 32;
+        int base = sprite->tile;
+        if (sprite->bpp8 && !map_1d) {
+            base &= ~1;
+        }
+        int row_tile = base + (row >> 3) * stride;
+
+        /* fetch the whole row of the sprite before clipping */
+        for (int t = 0; t < tiles_wide; t++) {
+            unsigned int address = OBJ_VRAM_OFFSET + ((row_tile + t * tile_size) & 1023) * 32;
+            if (sprite->bpp8) {
+                const uint8_t* source = VRAM + address + (row & 7) * 8;
+                for (int p = 0; p < 8; p++) {
+                    pixels[t * 8 + p] = source[p] ? (256 | source[p]) : 0;
+                }
+            } else {
+                const uint8_t* source = VRAM + address + (row & 7) * 4;
+                for (int p = 0; p < 8; p++) {
+                    int pixel = (source[p >> 1] >> ((p & 1) * 4)) & 0xf;
+                    pixels[t * 8 + p] = pixel ? (256 | sprite->palette_bank | pixel) : 0;
+                }
+            }
+        }
+
+        int start = sprite->x < 0 ? -sprite->x : 0;
+        int end = sprite->x + sprite->width > RENDER_WIDTH ? RENDER_WIDTH - sprite->x : sprite->width;
+        for (int p = start; p < end; p++) {
+            uint16_t color = pixels[sprite->hflip ? sprite->width - 1 - p : p];
+            int x = sprite->x + p;
+
+            /* priority is stored plus one so zero can mean empty */
+            if (color && (obj_line[x] == 0 || sprite->priority + 1 < obj_priority[x])) {
+                obj_line[x] = color;
+                obj_priority[x] = sprite->priority + 1;
+            }
+        }
+    }
+}
+
+/* put the non-transparent pixels of a layer over the line */
+static inline void blend_layer(uint16_t* dest, const uint16_t* source) {
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    for (int i = 0; i < RENDER_WIDTH; i += 8) {
+        __m128i over = _mm_loadu_si128((const __m128i*) (source + i));
+        __m128i under = _mm_loadu_si128((const __m128i*) (dest + i));
+        __m128i clear = _mm_cmpeq_epi16(over, zero);
+        _mm_storeu_si128((__m128i*) (dest + i),
+                _mm_or_si128(_mm_and_si128(clear, under), _mm_andnot_si128(clear, over)));
+    }
+#else
+    for (int i = 0; i < RENDER_WIDTH; i++) {
+        if (source[i]) {
+            dest[i] = source[i];
+        }
+    }
+#endif
+}
+
+/* put the sprite pixels of one priority over the line */
+static inline void blend_sprites(uint16_t* dest, int priority) {
+#ifdef __SSE2__
+    const __m128i wanted = _mm_set1_epi16(priority + 1);
+    for (int i = 0; i < RENDER_WIDTH; i += 8) {
+        __m128i over = _mm_loadu_si128((const __m128i*) (obj_line + i));
+        __m128i under = _mm_loadu_si128((const __m128i*) (dest + i));
+        __m128i take = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*) (obj_priority + i)), wanted);
+        _mm_storeu_si128((__m128i*) (dest + i),
+                _mm_or_si128(_mm_andnot_si128(take, under), _mm_and_si128(take, over)));
+    }
+#else
+    for (int i = 0; i < RENDER_WIDTH; i++) {
+        if (obj_priority[i] == priority + 1) {
+            dest[i] = obj_line[i];
+        }
+    }
+#endif
+}
+
+/* render the current contents of video memory into a framebuffer */
+void render_frame(uint32_t* framebuffer) {
+    static struct RenderSprite sprites[128];
+    uint32_t colors[512];
+    uint16_t display = IO16(0x0);
+
+    /* forced blank shows a white screen */
+    if (display & 0x80) {
+        for (int i = 0; i < RENDER_WIDTH * RENDER_HEIGHT; i++) {
+            framebuffer[i] = 0xffffff;
+        }
+        return;
+    }
+
+    /* expand the 15 bit BGR palette to 24 bit RGB once for the frame */
+    for (int i = 0; i < 512; i++) {
+        uint16_t color = PALETTE[i];
+        uint32_t r = color & 31, g = (color >> 5) & 31, b = (color >> 10) & 31;
+        r = (r << 3) | (r >> 2);
+        g = (g << 3) | (g >> 2);
+        b = (b << 3) | (b >> 2);
+        colors[i] = (r << 16) | (g << 8) | b;
+    }
+
+    /* only text backgrounds are drawn, which means mode 0 */
+    int bg_enabled[4];
+    int bg_priority[4];
+    for (int bg = 0; bg < 4; bg++) {
+        bg_enabled[bg] = (display & 7) == 0 && (display & (0x100 << bg));
+        bg_priority[bg] = IO16(0x8 + 2 * bg) & 3;
+    }
+
+    int obj_enabled = display & 0x1000;
+    int map_1d = display & 0x40;
+    int sprite_count = obj_enabled ? decode_sprites(sprites) : 0;
+
+    for (int y = 0; y < RENDER_HEIGHT; y++) {
+        for (int bg = 0; bg < 4; bg++) {
+            if (bg_enabled[bg]) {
+                render_bg_line(bg, y, bg_lines[bg]);
+            }
+        }
+        if (sprite_count) {
+            render_obj_line(sprites, sprite_count, y, map_1d);
+        }
+
+        /* start from the backdrop (index 0) and stack the layers bottom up,
+         * lower numbered backgrounds go over higher ones of the same priority
+         * and sprites go over backgrounds of the same priority */
+        memset(line, 0, sizeof(line));
+        for (int priority = 3; priority >= 0; priority--) {
+            for (int bg = 3; bg >= 0; bg--) {
+                if (bg_enabled[bg] && bg_priority[bg] == priority) {
+                    blend_layer(line, bg_lines[bg]);
+                }
+            }
+            if (sprite_count) {
+                blend_sprites(line, priority);
+            }
+        }
+
+        uint32_t* out = framebuffer + y * RENDER_WIDTH;
+        for (int x = 0; x < RENDER_WIDTH; x++) {
+            out[x] = colors[line[x]];
+        }
+    }
+}
+
+/* a CRC32 of a framebuffer */
+uint32_t render_checksum(const uint32_t* framebuffer) {
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+    }
+
+    const uint8_t* bytes = (const uint8_t*) framebuffer;
+    uint32_t crc = 0xffffffff;
+    for (int i = 0; i < RENDER_WIDTH * RENDER_HEIGHT * 4; i++) {
+        crc = table[(crc ^ bytes[i]) & 0xff] ^ (crc >> 8);
+    }
+    return crc ^ 0xffffffff;
+}
+
+/* save a framebuffer as a binary PPM */
+int render_write_ppm(const char* path, const uint32_t* framebuffer) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return -1;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", RENDER_WIDTH, RENDER_HEIGHT);
+    for (int i = 0; i < RENDER_WIDTH * RENDER_HEIGHT; i++) {
+        uint8_t rgb[3] = {framebuffer[i] >> 16, framebuffer[i] >> 8, framebuffer[i]};
+        fwrite(rgb, 1, 3, file);
+    }
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+/* PNG chunks end with a CRC of the chunk type and data */
+static uint32_t png_crc(uint32_t crc, const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) {
+            crc = (crc & 1) ? 0xedb88320 ^ (crc >> 1) : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static void png_put32(uint8_t* out, uint32_t value) {
+    out[0] = value >> 24;
+    out[1] = value >> 16;
+    out[2] = value >> 8;
+    out[3] = value;
+}
+
+static void png_chunk(FILE* file, const char* type, const uint8_t* data, uint32_t length) {
+    uint8_t header[8];
+    png_put32(header, length);
+    memcpy(header + 4, type, 4);
+    fwrite(header, 1, 8, file);
+    fwrite(data, 1, length, file);
+
+    uint32_t crc = png_crc(0xffffffff, header + 4, 4);
+    crc = png_crc(crc, data, length) ^ 0xffffffff;
+    uint8_t trailer[4];
+    png_put32(trailer, crc);
+    fwrite(trailer, 1, 4, file);
+}
+
+/* save a framebuffer as a PNG, the image data is stored without compression
+ * which keeps the writer tiny and is fine for golden images */
+int render_write_png(const char* path, const uint32_t* framebuffer) {
+    enum { ROW = 1 + RENDER_WIDTH * 3, RAW = ROW * RENDER_HEIGHT };
+    static uint8_t raw[RAW];
+    static uint8_t zlib[2 + RAW + 5 * (RAW / 65535 + 1) + 4];
+
+    /* each row starts with filter type 0 */
+    for (int y = 0; y < RENDER_HEIGHT; y++) {
+        uint8_t* row = raw + y * ROW;
+        row[0] = 0;
+        for (int x = 0; x < RENDER_WIDTH; x++) {
+            uint32_t color = framebuffer[y * RENDER_WIDTH + x];
+            row[1 + x * 3] = color >> 16;
+            row[2 + x * 3] = color >> 8;
+            row[3 + x * 3] = color;
+        }
+    }
+
+    /* wrap the rows in zlib stored blocks */
+    size_t length = 0;
+    zlib[length++] = 0x78;
+    zlib[length++] = 0x01;
+    for (size_t done = 0; done < RAW;) {
+        size_t block = RAW - done > 65535 ? 65535 : RAW - done;
+        zlib[length++] = done + block == RAW;
+        zlib[length++] = block & 0xff;
+        zlib[length++] = block >> 8;
+        zlib[length++] = ~block & 0xff;
+        zlib[length++] = (~block >> 8) & 0xff;
+        memcpy(zlib + length, raw + done, block);
+        length += block;
+        done += block;
+    }
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < RAW; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    png_put32(zlib + length, (b << 16) | a);
+    length += 4;
+
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return -1;
+    }
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    fwrite(signature, 1, 8, file);
+
+    /* 8 bits per channel RGB */
+    uint8_t header[13];
+    png_put32(header, RENDER_WIDTH);
+    png_put32(header + 4, RENDER_HEIGHT);
+    header[8] = 8;
+    header[9] = 2;
+    header[10] = header[11] = header[12] = 0;
+    png_chunk(file, "IHDR", header, 13);
+    png_chunk(file, "IDAT", zlib, (uint32_t) length);
+    png_chunk(file, "IEND", NULL, 0);
+
+    return fclose(file) == 0 ? 0 : -1;
+}
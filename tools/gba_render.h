@@ -0,0 +1,29 @@
+/*
+ * gba_render.h
+ * reference renderer for tile mode 0 backgrounds and sprites
+ *
+ * it reads the display registers, palette, VRAM and OAM straight out of the
+ * GBA memory regions mapped by gba_host.c and produces the 240x160 picture
+ * the hardware would show, so frames can be checked without a GBA
+ */
+#ifndef GBA_RENDER_H
+#define GBA_RENDER_H
+
+#include <stdint.h>
+
+#define RENDER_WIDTH 240
+#define RENDER_HEIGHT 160
+
+/* render the current contents of video memory into a 24-bit framebuffer
+ * of 240x160 pixels, each stored as 0x00RRGGBB */
+void render_frame(uint32_t* framebuffer);
+
+/* a CRC32 of a framebuffer, used to compare frames against a known good run */
+uint32_t render_checksum(const uint32_t* framebuffer);
+
+/* save a framebuffer as a binary PPM or an uncompressed PNG
+ * these return 0 on success and -1 if the file can't be written */
+int render_write_ppm(const char* path, const uint32_t* framebuffer);
+int render_write_png(const char* path, const uint32_t* framebuffer);
+
+#endif
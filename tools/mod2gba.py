@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+mod2gba.py
+converts a 4 channel MOD file into a header for the music sequencer in metroid.c
+
+usage: mod2gba.py song.mod name > name.h
+
+the header defines name_instruments, name_patterns, name_order and the
+struct Song name, so it has to be included after struct Song is declared,
+and the song is started with music_play(&name)
+
+tools/assets.py builds songs listed in assets.txt with the mod kind the same
+way, putting the samples, patterns and order in the asset pack
+
+only what the sequencer plays is kept: notes, instruments, and the pan (8),
+volume slide (A), position jump (B), set volume (C), pattern break (D) and set
+speed (F) effects - any other effects are dropped and listed on stderr
+"""
+import struct
+import sys
+
+# the Amiga periods for finetune 0, from C-1 to B-3
+PERIODS = [
+    856, 808, 762, 720, 678, 640, 604, 570, 538, 508, 480, 453,
+    428, 404, 381, 360, 339, 320, 302, 285, 269, 254, 240, 226,
+    214, 202, 190, 180, 170, 160, 151, 143, 135, 127, 120, 113,
+]
+
+# period 428 (C-2) plays a sample at 8363 samples a second, and is note 13
+BASE_RATE = 8363
+BASE_NOTE = 13
+
+# the signatures of the 31 instrument, 4 channel formats
+SIGNATURES = [b"M.K.", b"M!K!", b"FLT4", b"4CHN"]
+
+CHANNELS = 4
+ROWS = 64
+
+# effects the sequencer understands
+KEPT_EFFECTS = {0x8, 0xA, 0xB, 0xC, 0xD, 0xF}
+
+EFFECT_NAMES = {
+    0x0: "arpeggio", 0x1: "porta up", 0x2: "porta down", 0x3: "tone porta",
+    0x4: "vibrato", 0x5: "tone porta + slide", 0x6: "vibrato + slide",
+    0x7: "tremolo", 0x8: "pan", 0x9: "sample offset", 0xE: "extended",
+}
+
+
+def note_from_period(period):
+    """the note number for a period, 0 for no note"""
+    if period == 0:
+        return 0
+    closest = min(range(len(PERIODS)), key=lambda i: abs(PERIODS[i] - period))
+    return closest + 1
+
+
+def read_mod(data):
+    if len(data) < 1084 or data[1080:1084] not in SIGNATURES:
+        raise ValueError("not a 4 channel MOD file (signature %r)" % data[1080:1084])
+
+    instruments = []
+    for i in range(31):
+        entry = data[20 + i * 30:20 + (i + 1) * 30]
+        name = entry[:22].split(b"\0")[0].decode("latin-1")
+        length, finetune, volume, loop_start, loop_length = struct.unpack(">HBBHH", entry[22:30])
+
+        # finetune is a signed nibble in 1/8 semitone steps
+        finetune = finetune & 0xf
+        if finetune > 7:
+            finetune -= 16
+
+        instruments.append({
+            "name": name,
+            "length": length * 2,
+            "rate": round(BASE_RATE * 2 ** (finetune / 96)),
+            "volume": min(volume, 64),
+            "loop_start": loop_start * 2,
+            "loop_length": loop_length * 2 if loop_length > 1 else 0,
+        })
+
+    length = data[950]
+    restart = data[951]
+    order = list(data[952:952 + length])
+    pattern_count = max(data[952:1080]) + 1
+
+    patterns = []
+    offset = 1084
+    for _ in range(pattern_count):
+        notes = []
+        for _ in range(ROWS * CHANNELS):
+            b0, b1, b2, b3 = data[offset:offset + 4]
+            offset += 4
+            notes.append({
+                "instrument": (b0 & 0xf0) | (b2 >> 4),
+                "period": ((b0 & 0x0f) << 8) | b1,
+                "effect": b2 & 0x0f,
+                "param": b3,
+            })
+        patterns.append(notes)
+
+    # the sample data follows the patterns in instrument order
+    for instrument in instruments:
+        instrument["data"] = data[offset:offset + instrument["length"]]
+        offset += instrument["length"]
+        if instrument["loop_length"]:
+            end = min(instrument["loop_start"] + instrument["loop_length"], instrument["length"])
+            instrument["length"] = end
+            instrument["loop_length"] = end - instrument["loop_start"]
+
+    if restart >= length:
+        restart = 0
+
+    return instruments, patterns, order, restart
+
+
+def c_bytes(data, indent="    ", per_line=12):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def pattern_notes(patterns):
+    """the notes of every pattern as the sequencer's struct Note, 4 bytes
+    each, and how many uses of each effect it doesn't know were dropped"""
+    data = bytearray()
+    dropped = {}
+    for notes in patterns:
+        for note in notes:
+            effect, param = note["effect"], note["param"]
+            if effect not in KEPT_EFFECTS:
+                if effect or param:
+                    dropped[effect] = dropped.get(effect, 0) + 1
+                effect, param = 0, 0
+            data += bytes((note_from_period(note["period"]), note["instrument"], effect, param))
+    return bytes(data), dropped
+
+
+def instrument_entries(name, instruments):
+    """the initializers of name_instruments, given the samples are name_sample_N"""
+    entries = []
+    for number, instrument in enumerate(instruments, 1):
+        if instrument["length"]:
+            entries.append("{%s_sample_%d, %d, %d, %d, %d, %d}" % (
+                name, number, instrument["length"], instrument["loop_start"],
+                instrument["loop_length"], instrument["rate"], instrument["volume"]))
+        else:
+            entries.append("{0, 0, 0, 0, %d, 0}" % BASE_RATE)
+    return entries
+
+
+def song_definition(name, order, restart):
+    """the struct Song itself, pointing at the other arrays"""
+    return ("const struct Song %s = {\n"
+            "    %s_instruments, %s_patterns, %s_order,\n"
+            "    %d, %d, %d, %d, 6, 125\n};\n" % (name, name, name, name, len(order), restart, CHANNELS, ROWS))
+
+
+def report_dropped(name, dropped):
+    for effect, count in sorted(dropped.items()):
+        print("%s: dropped %d uses of effect %X (%s)" % (
+            name, count, effect, EFFECT_NAMES.get(effect, "unknown")), file=sys.stderr)
+
+
+def write_header(name, instruments, patterns, order, restart, out):
+    out.write("/* %s.h\n * generated by mod2gba */\n\n" % name)
+
+    # the samples, skipping empty instruments
+    for number, instrument in enumerate(instruments, 1):
+        if instrument["length"]:
+            out.write("/* %d: %s */\n" % (number, instrument["name"]))
+            out.write("const signed char %s_sample_%d [] = {\n" % (name, number))
+            out.write(c_bytes(instrument["data"]) + "\n};\n\n")
+
+    out.write("const struct Instrument %s_instruments[] = {\n" % name)
+    for entry in instrument_entries(name, instruments):
+        out.write("    %s,\n" % entry)
+    out.write("};\n\n")
+
+    notes, dropped = pattern_notes(patterns)
+    out.write("const struct Note %s_patterns[] = {\n" % name)
+    for number in range(len(patterns)):
+        out.write("    /* pattern %d */\n" % number)
+        for row in range(ROWS):
+            start = (number * ROWS + row) * CHANNELS * 4
+            cells = ["{%d, %d, 0x%X, 0x%02X}" % tuple(notes[i:i + 4]) for i in range(start, start + CHANNELS * 4, 4)]
+            out.write("    " + ", ".join(cells) + ",\n")
+    out.write("};\n\n")
+
+    out.write("const unsigned char %s_order[] = {\n" % name)
+    out.write("    " + ", ".join(str(p) for p in order) + "\n};\n\n")
+
+    out.write(song_definition(name, order, restart))
+    report_dropped(name, dropped)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: %s song.mod name > name.h" % sys.argv[0], file=sys.stderr)
+        sys.exit(1)
+
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+
+    try:
+        instruments, patterns, order, restart = read_mod(data)
+    except ValueError as error:
+        print("%s: %s" % (sys.argv[1], error), file=sys.stderr)
+        sys.exit(1)
+
+    write_header(sys.argv[2], instruments, patterns, order, restart, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
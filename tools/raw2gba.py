@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+raw2gba.py
+converts raw signed 8 bit mono audio into a header of samples for the game
+
+usage: raw2gba.py sound.raw name [--from RATE --to RATE] [--loop] [--raw out.raw] > name.h
+
+with --from and --to the sound is resampled, which is how sounds are brought
+to a rate the game plays back at a whole number of samples per frame:
+a frame is 280896 cycles, so these rates (and the cycles per sample the sound
+timer is set to) give whole frames of samples
+
+    10512 Hz  1596 cycles  176 samples a frame
+    13379 Hz  1254 cycles  224 samples a frame
+    18157 Hz   924 cycles  304 samples a frame
+    21024 Hz   798 cycles  352 samples a frame
+
+--loop treats the sound as one which loops, so the filter wraps around the
+end rather than seeing silence there and the loop point stays click free
+--raw also writes the resampled samples out as a raw file
+"""
+import math
+import sys
+
+# the half width of the filter in input samples
+TAPS = 16
+
+# the frame rates which give whole samples per frame, for the check below
+FRAME_CYCLES = 280896
+CLOCK = 16777216
+
+
+def sinc(x):
+    return 1.0 if x == 0 else math.sin(math.pi * x) / (math.pi * x)
+
+
+def resample(samples, from_rate, to_rate, loop):
+    """windowed sinc resampling, which also low pass filters when going down"""
+    count = len(samples)
+    out_count = int(round(count * to_rate / from_rate))
+    ratio = from_rate / to_rate
+    cutoff = min(1.0, 1.0 / ratio)
+    width = int(math.ceil(TAPS / cutoff))
+
+    out = []
+    for i in range(out_count):
+        centre = i * ratio
+        first = int(math.floor(centre)) - width + 1
+        total = 0.0
+        weights = 0.0
+        for j in range(first, first + 2 * width):
+            distance = centre - j
+            # a Hann window over the filter
+            window = 0.5 + 0.5 * math.cos(math.pi * distance / width)
+            weight = cutoff * sinc(cutoff * distance) * window
+            if loop:
+                sample = samples[j % count]
+            elif 0 <= j < count:
+                sample = samples[j]
+            else:
+                sample = 0
+            total += sample * weight
+            weights += weight
+        value = int(round(total / weights)) if weights else 0
+        out.append(max(-128, min(127, value)))
+    return out
+
+
+def write_header(name, samples, out):
+    out.write("/* %s.h\n * generated by raw2gba */\n\n" % name)
+    out.write("#define %s_bytes %d\n\n" % (name, len(samples)))
+    out.write("const signed char %s [] = {\n" % name)
+    lines = []
+    for i in range(0, len(samples), 12):
+        lines.append("    " + ", ".join("0x%02X" % (s & 0xff) for s in samples[i:i + 12]))
+    out.write(", \n".join(lines) + "\n};\n\n")
+
+
+def main():
+    args = sys.argv[1:]
+    options = {"--from": None, "--to": None, "--raw": None}
+    loop = False
+    positional = []
+
+    i = 0
+    while i < len(args):
+        if args[i] in options and i + 1 < len(args):
+            options[args[i]] = args[i + 1]
+            i += 2
+        elif args[i] == "--loop":
+            loop = True
+            i += 1
+        else:
+            positional.append(args[i])
+            i += 1
+
+    if len(positional) != 2 or (options["--from"] is None) != (options["--to"] is None):
+        print("usage: %s sound.raw name [--from RATE --to RATE] [--loop] [--raw out.raw] > name.h"
+              % sys.argv[0], file=sys.stderr)
+        sys.exit(1)
+
+    with open(positional[0], "rb") as f:
+        samples = [b - 256 if b > 127 else b for b in f.read()]
+
+    if options["--from"]:
+        from_rate, to_rate = int(options["--from"]), int(options["--to"])
+        ticks = CLOCK // to_rate
+        if FRAME_CYCLES % ticks:
+            print("warning: %d Hz is not a whole number of samples per frame" % to_rate,
+                  file=sys.stderr)
+        samples = resample(samples, from_rate, to_rate, loop)
+
+    if options["--raw"]:
+        with open(options["--raw"], "wb") as f:
+            f.write(bytes(s & 0xff for s in samples))
+
+    write_header(positional[1], samples, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()